@@ -3,1965 +3,1944 @@
  * name: opendyslexic_14_regular
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_14_regular 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_14_regular 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_regularBitmaps[31237] = {
-    0x85, 0x59, 0x3D, 0x8C, 0xDE, 0xD8, 0x75, 0x7D, 0x24, 0x3D, 0x22, 0xB2, 0x84, 0xC3, 0x2D, 0xA2,
-    0xC0, 0x88, 0xB0, 0xCB, 0x36, 0x30, 0x76, 0xCD, 0x66, 0x8B, 0x2D, 0x34, 0xF3, 0x68, 0x09, 0x88,
-    0x0A, 0x15, 0x1E, 0x20, 0x19, 0xA5, 0x70, 0xB1, 0x29, 0x52, 0xD8, 0xF9, 0xC1, 0xA4, 0x48, 0xE1,
-    0x62, 0x66, 0x48, 0x4B, 0x80, 0x55, 0x08, 0x88, 0x27, 0x70, 0x1C, 0x20, 0x49, 0x61, 0x17, 0xEB,
-    0xC0, 0x9A, 0x14, 0x0A, 0x90, 0x2D, 0x04, 0x78, 0x66, 0xF8, 0xA4, 0x29, 0x54, 0xA8, 0x58, 0x6A,
-    0x5D, 0xA8, 0x30, 0x90, 0xA5, 0xB0, 0x32, 0x14, 0x6B, 0x0B, 0x71, 0xB5, 0x14, 0x96, 0x33, 0x7A,
-    0xE4, 0xCB, 0x39, 0xF7, 0x71, 0xFE, 0xE4, 0x4D, 0x3C, 0xF3, 0x91, 0x1F, 0xF9, 0x3E, 0xF2, 0xF1,
-    0xBE, 0xFB, 0x73, 0xEE, 0xB9, 0x97, 0xEA, 0xA7, 0x89, 0xC9, 0xD5, 0x76, 0xD4, 0xA5, 0x46, 0x2B,
-    0x2B, 0x5F, 0x81, 0x8D, 0xBB, 0xCC, 0xD4, 0xA1, 0x4D, 0xBA, 0xDC, 0xB8, 0x08, 0x5F, 0x4A, 0xA9,
-    0xA4, 0xD7, 0xAD, 0xBB, 0xE6, 0x32, 0x5B, 0x77, 0x65, 0x5B, 0xDF, 0x1B, 0x13, 0x5B, 0x1A, 0x77,
-    0xCF, 0xA6, 0x43, 0x59, 0xB9, 0xCB, 0x43, 0xDA, 0xD7, 0xF8, 0xB2, 0x69, 0xAF, 0xE4, 0x2F, 0x53,
-    0x49, 0xC5, 0x7B, 0x4C, 0xD4, 0xE2, 0x2B, 0xEA, 0xD4, 0xC0, 0xD1, 0x41, 0x2D, 0xF2, 0x6B, 0x49,
-    0x65, 0x05, 0xAF, 0xA9, 0xE2, 0x06, 0x5F, 0x71, 0x13, 0x62, 0xFA, 0xD2, 0xF1, 0x6F, 0xCA, 0xE5,
-    0xCB, 0xFD, 0xC9, 0x56, 0xBD, 0x75, 0xEB, 0xE9, 0x56, 0xA5, 0x52, 0x13, 0x75, 0x32, 0x41, 0xC0,
-    0x09, 0x02, 0xAB, 0x36, 0x38, 0x41, 0xAD, 0x72, 0xCE, 0x9E, 0x57, 0x09, 0x27, 0x48, 0xDB, 0x08,
-    0x4F, 0xD5, 0xFE, 0xCE, 0xD4, 0x7F, 0xFD, 0xE0, 0x70, 0x82, 0xAC, 0x89, 0x45, 0xF8, 0x2E, 0xB4,
-    0x9C, 0xC7, 0xE2, 0x5E, 0xFC, 0x39, 0xA5, 0x0D, 0xBE, 0xB4, 0x49, 0x29, 0xDE, 0xC2, 0x72, 0xB0,
-    0x2C, 0x52, 0xFF, 0xDE, 0x02, 0xF7, 0xF1, 0x5D, 0xCE, 0x1A, 0x74, 0x1F, 0x70, 0xEF, 0xDC, 0xFF,
-    0xE0, 0x6E, 0xCC, 0xE8, 0xF7, 0x95, 0x8A, 0xDD, 0xFE, 0x8B, 0x4D, 0x15, 0xB9, 0xED, 0xB7, 0x39,
-    0x4F, 0x96, 0x60, 0x25, 0xE5, 0x25, 0xDE, 0x91, 0x3D, 0xE0, 0x1D, 0x91, 0x5D, 0x93, 0x1F, 0x1C,
-    0x7F, 0x80, 0x30, 0xAD, 0x9C, 0xB8, 0x4D, 0xA5, 0xCE, 0x60, 0x79, 0x94, 0x76, 0xD5, 0x41, 0xDA,
-    0xE8, 0x2E, 0x67, 0x54, 0xDD, 0x2F, 0x1C, 0xA4, 0x3B, 0xFF, 0xB6, 0x1B, 0xF1, 0x43, 0x52, 0xBA,
-    0x62, 0xE9, 0xDF, 0x1E, 0x3A, 0x67, 0x44, 0x0B, 0x5D, 0x76, 0xBC, 0xEF, 0xF9, 0x6C, 0xCC, 0x75,
-    0x0E, 0x73, 0x50, 0x75, 0xE7, 0xF9, 0x0C, 0xDC, 0xC1, 0xE3, 0xE8, 0x6A, 0xA3, 0x5E, 0xF9, 0x8B,
-    0xB8, 0xB8, 0xB7, 0xD4, 0x59, 0x15, 0xB4, 0x89, 0x53, 0xA9, 0xFA, 0x20, 0x53, 0xB7, 0xA3, 0xEA,
-    0x8D, 0xC8, 0x7C, 0x55, 0xBD, 0xB3, 0xA8, 0xFE, 0x5E, 0x3D, 0xEA, 0x82, 0x26, 0xFA, 0x56, 0x11,
-    0x99, 0xC5, 0xDB, 0x58, 0xD5, 0x17, 0x06, 0xBB, 0x25, 0xA8, 0xE1, 0x1F, 0x9F, 0x53, 0x8C, 0xDD,
-    0x5D, 0xA5, 0x76, 0xCD, 0x5B, 0x2A, 0xFE, 0x6F, 0xF5, 0xAE, 0x5A, 0x7A, 0x47, 0xB5, 0x61, 0xD7,
-    0x46, 0x55, 0x7A, 0xCD, 0xBC, 0xA9, 0x6C, 0xF2, 0xB4, 0x8B, 0x9B, 0xD4, 0x55, 0x1A, 0xDE, 0x10,
-    0xF6, 0xA7, 0x1F, 0x7A, 0xC6, 0x41, 0x8E, 0x08, 0xD2, 0x2B, 0x35, 0x15, 0x35, 0xCD, 0x8B, 0x2B,
-    0xF0, 0xC9, 0x0B, 0x18, 0x0A, 0x16, 0x0A, 0x46, 0xEA, 0x3E, 0xE9, 0x4B, 0x5C, 0x90, 0x3F, 0xA3,
-    0x51, 0x6A, 0xDA, 0x34, 0xA1, 0x1E, 0x22, 0xC7, 0xC3, 0xFA, 0x63, 0x68, 0x2B, 0xEB, 0x74, 0x75,
-    0xE6, 0x47, 0xBC, 0x76, 0xD2, 0x26, 0xB4, 0xD9, 0x43, 0xAB, 0xE2, 0x2F, 0x6C, 0xD9, 0xA8, 0xCC,
-    0x5D, 0xC2, 0xA5, 0x75, 0xAB, 0x47, 0x55, 0x8E, 0xC1, 0x91, 0x56, 0x6E, 0x18, 0x68, 0xA8, 0x79,
-    0x1D, 0xAA, 0xD9, 0x9C, 0x05, 0x29, 0x1F, 0x8E, 0xE5, 0x7D, 0x5B, 0xDF, 0x18, 0xF0, 0xA1, 0x39,
-    0x0D, 0xFC, 0x2E, 0x53, 0x70, 0xC4, 0x35, 0x95, 0x56, 0x41, 0xA7, 0xF2, 0xF9, 0x58, 0xC6, 0x8B,
-    0x50, 0x06, 0x3A, 0xA5, 0xE7, 0x5D, 0x7B, 0x74, 0xC4, 0x1F, 0x82, 0x1E, 0xF7, 0x28, 0xCB, 0x8B,
-    0x77, 0x54, 0xCC, 0x61, 0xAC, 0x28, 0x33, 0x18, 0x49, 0xE4, 0x42, 0xCC, 0x60, 0xE6, 0x69, 0x97,
-    0xFC, 0x93, 0x30, 0x59, 0x83, 0x9F, 0xE5, 0x81, 0x16, 0x67, 0xB1, 0xC1, 0x1C, 0x4B, 0xB8, 0x04,
-    0xE7, 0x03, 0x6E, 0x99, 0x0F, 0xD6, 0xF1, 0xE8, 0x84, 0xCE, 0x4D, 0x97, 0xCE, 0x8B, 0xD4, 0xC4,
-    0x2D, 0x66, 0xA6, 0x7B, 0xEA, 0x22, 0x83, 0x5B, 0x8A, 0xD7, 0xD2, 0xD2, 0xF4, 0x12, 0xB5, 0x10,
-    0x99, 0x77, 0x36, 0xD2, 0xA4, 0xA9, 0xFF, 0x16, 0x0F, 0x74, 0x05, 0xB4, 0x08, 0xCF, 0x84, 0x1E,
-    0xFE, 0xA6, 0xBE, 0xD6, 0xFD, 0xE7, 0x52, 0x1C, 0x62, 0xFD, 0xF4, 0x05, 0x7A, 0x05, 0xE3, 0x0E,
-    0xCB, 0x4E, 0x4F, 0x7E, 0xD5, 0xCE, 0x7D, 0x4A, 0xEF, 0x4B, 0x7F, 0xEB, 0xB7, 0xBF, 0xA4, 0x1B,
-    0x21, 0x86, 0xD3, 0x3E, 0xEB, 0xB2, 0x2E, 0x6F, 0x75, 0x43, 0xF3, 0xE0, 0xFA, 0xFB, 0xCE, 0x59,
-    0x7C, 0x99, 0xEC, 0xE2, 0xA0, 0xF7, 0x2C, 0x07, 0x55, 0xE0, 0x95, 0xA9, 0x42, 0xFA, 0x74, 0x3F,
-    0xCB, 0x96, 0x2B, 0x3F, 0x11, 0x16, 0x8D, 0x90, 0xC1, 0xC9, 0x6D, 0x6C, 0x8B, 0x82, 0x00, 0x0C,
-    0x7F, 0x45, 0x35, 0x50, 0x8B, 0x4A, 0x6D, 0x33, 0xE0, 0xE6, 0xAB, 0x39, 0x8D, 0x04, 0x36, 0x0D,
-    0xB4, 0x7E, 0x38, 0x0D, 0x06, 0x63, 0x5C, 0x2D, 0x8E, 0x65, 0x05, 0x27, 0x94, 0x20, 0x45, 0x3A,
-    0x5F, 0x2D, 0x18, 0xB0, 0x33, 0x4F, 0x03, 0x23, 0xD0, 0x06, 0x7E, 0x1A, 0x5E, 0x4D, 0x64, 0xD0,
-    0xF3, 0xD5, 0xD4, 0x1E, 0x51, 0x45, 0x51, 0xD4, 0xD7, 0x45, 0x91, 0x39, 0x9D, 0x71, 0x15, 0x22,
-    0xC5, 0x26, 0x2D, 0xC2, 0x16, 0xA6, 0xED, 0x30, 0x7F, 0xBF, 0x11, 0x55, 0xC3, 0x7A, 0x62, 0xEC,
-    0x4E, 0x62, 0xB6, 0x77, 0xFC, 0xB7, 0xDD, 0x8D, 0x2A, 0xBB, 0x0B, 0xB0, 0xA9, 0x55, 0x68, 0xCB,
-    0x22, 0x1A, 0xB4, 0x49, 0x06, 0xBD, 0xBF, 0xDA, 0x23, 0x2C, 0x3B, 0x86, 0x74, 0x0C, 0xBD, 0x84,
-    0x8C, 0x5F, 0xCC, 0xA9, 0xBE, 0x02, 0x87, 0x33, 0x0A, 0x61, 0xBC, 0x61, 0xD5, 0xD7, 0xB4, 0x3C,
-    0x9E, 0x22, 0x59, 0x91, 0x12, 0x42, 0x42, 0x14, 0xC0, 0x96, 0x2A, 0xE5, 0x04, 0x40, 0x4A, 0x1C,
-    0x42, 0x1C, 0xE4, 0x06, 0xCE, 0x7B, 0x00, 0xA3, 0x40, 0xC9, 0xB7, 0x18, 0xDA, 0x67, 0x31, 0xE6,
-    0xDA, 0x88, 0x11, 0xBF, 0x99, 0x75, 0xCB, 0x2A, 0x6D, 0xFC, 0x1A, 0xB5, 0x5F, 0x1E, 0x57, 0xA4,
-    0x2B, 0x15, 0x8E, 0x8C, 0x10, 0x15, 0xE2, 0xE1, 0xBA, 0x07, 0x16, 0x15, 0x0C, 0xA2, 0xD4, 0x7F,
-    0x45, 0x1E, 0xFE, 0x2C, 0xA0, 0xF4, 0x39, 0x0E, 0x9B, 0x33, 0x98, 0xB5, 0x76, 0x43, 0x58, 0x88,
-    0xDE, 0x20, 0x6A, 0xD0, 0x7A, 0xCD, 0xBF, 0x29, 0xA7, 0x67, 0x57, 0xAB, 0x08, 0x50, 0x94, 0x32,
-    0x6E, 0x30, 0x25, 0x65, 0x13, 0xDD, 0x51, 0x87, 0x23, 0x1F, 0xF8, 0xDD, 0x15, 0xB7, 0x07, 0x01,
-    0x31, 0x65, 0x57, 0xC3, 0x79, 0x56, 0x27, 0x62, 0xEE, 0x57, 0x66, 0xBB, 0xC3, 0x9A, 0x08, 0x68,
-    0x15, 0x11, 0x31, 0xB0, 0xE5, 0xD0, 0x7E, 0x09, 0x7D, 0xDA, 0x25, 0x15, 0xF5, 0x88, 0x84, 0x0E,
-    0x8E, 0x8E, 0x74, 0xA2, 0x0B, 0xAD, 0xEA, 0x2D, 0xF1, 0x24, 0x8A, 0x45, 0x3D, 0x14, 0x7E, 0xAB,
-    0xB9, 0x55, 0xC7, 0x1B, 0x51, 0x72, 0xC2, 0x0A, 0x86, 0xB4, 0xF0, 0xFE, 0xD3, 0x7B, 0x9F, 0x3A,
-    0x3C, 0xDD, 0x2F, 0xB8, 0xBE, 0x02, 0xB1, 0x6E, 0xFE, 0x00, 0xCA, 0x53, 0x92, 0x01, 0x4A, 0x49,
-    0x09, 0x90, 0xBC, 0x50, 0xE5, 0xDE, 0xFE, 0xAA, 0x88, 0x8A, 0xC7, 0x5C, 0x05, 0x34, 0x04, 0xF5,
-    0xBE, 0x80, 0x0B, 0x55, 0xD0, 0x86, 0xD3, 0x4A, 0x41, 0x5F, 0xA1, 0xEB, 0xE5, 0xB3, 0x63, 0xD1,
-    0xEB, 0xD6, 0xCB, 0x51, 0xED, 0x62, 0xC6, 0xBA, 0xCF, 0xDA, 0x1A, 0x18, 0x55, 0xC3, 0xC5, 0x60,
-    0x1B, 0x8B, 0x79, 0xAD, 0xE6, 0x56, 0x04, 0x36, 0x6F, 0xE2, 0x81, 0xF3, 0xC2, 0xE8, 0x0D, 0x50,
-    0x07, 0x60, 0x26, 0xA9, 0x8C, 0xD0, 0x83, 0x55, 0xC1, 0xB8, 0x1B, 0x4C, 0x61, 0xE2, 0x97, 0xD4,
-    0x9E, 0x15, 0xAB, 0x85, 0x83, 0x58, 0x2B, 0xEE, 0x65, 0xA1, 0x69, 0xC7, 0x8C, 0x23, 0x76, 0x43,
-    0x06, 0xD0, 0xAD, 0x68, 0xAD, 0x36, 0x08, 0x3C, 0x8C, 0x1B, 0x75, 0x0E, 0x83, 0xF9, 0x3F, 0x13,
-    0x39, 0xD2, 0x22, 0x2D, 0x82, 0x0E, 0x26, 0x5A, 0x84, 0xF3, 0xA6, 0xC5, 0x3A, 0x26, 0x66, 0x02,
-    0x0C, 0xC7, 0x18, 0xBF, 0x02, 0x22, 0x43, 0x47, 0x9B, 0x3B, 0x13, 0xF7, 0xE1, 0x08, 0x44, 0xCD,
-    0xEF, 0x58, 0xF8, 0x1A, 0xE0, 0x7A, 0x84, 0x42, 0xF4, 0x0D, 0x00, 0x53, 0xE3, 0xAA, 0xBC, 0xCB,
-    0xB9, 0x7C, 0x6C, 0x40, 0x64, 0x98, 0xB6, 0xA4, 0x89, 0xAD, 0x1A, 0x91, 0xCC, 0x4D, 0x38, 0xAC,
-    0xAB, 0xE8, 0x39, 0xA6, 0xFE, 0x95, 0x51, 0xF9, 0x2D, 0xC8, 0xB0, 0x06, 0x23, 0x0E, 0x2A, 0xF9,
-    0x7C, 0x80, 0xFE, 0xB0, 0x20, 0xCC, 0x6D, 0xC3, 0xFA, 0xC9, 0xEC, 0x08, 0x4B, 0x0C, 0xC5, 0xD7,
-    0xB1, 0x1C, 0xFF, 0x4B, 0x0F, 0xDD, 0x57, 0xAB, 0x50, 0x68, 0xBE, 0x67, 0x35, 0x20, 0xF6, 0xD1,
-    0x9F, 0x1D, 0x63, 0x7F, 0x68, 0xF5, 0xDE, 0x58, 0xFE, 0x0A, 0x0B, 0x49, 0x3B, 0xFE, 0x67, 0x7D,
-    0xFE, 0x4A, 0x76, 0xF8, 0x6D, 0x90, 0x51, 0x73, 0x68, 0x0A, 0x6A, 0xE4, 0x0C, 0x58, 0x26, 0x90,
-    0x55, 0xBA, 0x1E, 0x0F, 0x68, 0xBF, 0xC4, 0x55, 0x73, 0x96, 0xA8, 0x99, 0xE3, 0x6A, 0xE6, 0xBE,
-    0x9C, 0x19, 0x30, 0xA8, 0xDD, 0x3E, 0x6F, 0x60, 0xDA, 0x38, 0x43, 0xB7, 0x52, 0xE7, 0xB8, 0x43,
-    0xCE, 0x53, 0x67, 0x2F, 0x78, 0x5F, 0x33, 0x27, 0x9F, 0x1E, 0x84, 0xB5, 0x0C, 0xDE, 0x59, 0x9E,
-    0xE1, 0xE0, 0x1B, 0x02, 0x09, 0x8F, 0xC5, 0x90, 0xC5, 0x71, 0x2A, 0xA2, 0x23, 0xD6, 0xA3, 0x9A,
-    0x45, 0x50, 0x25, 0x27, 0x4D, 0x2C, 0x9F, 0x64, 0xF9, 0xCC, 0x01, 0x1B, 0x50, 0x97, 0x12, 0xD4,
-    0xD4, 0xAD, 0x48, 0xF5, 0xFE, 0xD1, 0x53, 0xCE, 0x2E, 0x53, 0xA4, 0x82, 0x10, 0x91, 0x37, 0xAB,
-    0xFD, 0x9B, 0xA4, 0x1B, 0x12, 0x4B, 0x6A, 0xF7, 0x95, 0x6D, 0xF4, 0x41, 0x8D, 0xF4, 0x21, 0x61,
-    0x97, 0x63, 0x1E, 0x3C, 0x9B, 0xA9, 0x30, 0xC3, 0x50, 0xD6, 0x7E, 0xC9, 0xD6, 0xF8, 0xD8, 0x3B,
-    0xFC, 0x23, 0xF3, 0x11, 0x88, 0xC0, 0x6F, 0x79, 0xEB, 0x15, 0x78, 0x9C, 0x89, 0x37, 0xBD, 0x87,
-    0x12, 0x09, 0xF7, 0x19, 0x6E, 0xF4, 0xC7, 0x35, 0x0F, 0xC1, 0x1D, 0x13, 0xB2, 0x8A, 0x91, 0x85,
-    0x92, 0xA7, 0x88, 0x64, 0x1B, 0x3D, 0xE9, 0x42, 0x93, 0x56, 0x7F, 0x97, 0xAA, 0x37, 0x82, 0xE1,
-    0x35, 0x05, 0x66, 0x90, 0x17, 0x4D, 0xA2, 0xDE, 0x0E, 0x87, 0xAF, 0xAA, 0x2E, 0x32, 0xB9, 0x39,
-    0xA8, 0x8B, 0xDB, 0xA1, 0x8D, 0x5D, 0xAF, 0xF1, 0xA0, 0xEC, 0x13, 0x67, 0x02, 0x68, 0x0C, 0xBC,
-    0x89, 0x61, 0x4F, 0x1D, 0x49, 0x38, 0x84, 0x6E, 0x7F, 0x65, 0xC7, 0x47, 0x05, 0x85, 0x11, 0xBE,
-    0xC4, 0x2F, 0x4A, 0x75, 0xCE, 0xFD, 0xE6, 0x84, 0x1F, 0x08, 0x59, 0x91, 0x88, 0x8F, 0x9C, 0x30,
-    0x45, 0x99, 0x66, 0x57, 0xD8, 0xD9, 0xE7, 0xBC, 0x3C, 0xBB, 0x41, 0xD0, 0x1E, 0x33, 0x01, 0x7D,
-    0x82, 0x51, 0x5E, 0x89, 0xCA, 0x02, 0x41, 0x41, 0x52, 0x3D, 0xF0, 0xBE, 0x8E, 0x3A, 0xF4, 0xE8,
-    0x8A, 0x38, 0xC3, 0xA7, 0x16, 0xA5, 0x8E, 0x22, 0x81, 0x15, 0x32, 0xD8, 0x09, 0x47, 0x68, 0x85,
-    0x10, 0x1A, 0xD2, 0x3D, 0x77, 0x01, 0xFE, 0x19, 0x4E, 0xA4, 0xA8, 0xB1, 0x64, 0xB4, 0xB4, 0x3F,
-    0xBB, 0xB2, 0x4C, 0x8A, 0x37, 0x31, 0xAA, 0x1C, 0xE7, 0xAB, 0x89, 0x29, 0x3B, 0x7C, 0xD4, 0x80,
-    0xA9, 0xA3, 0x16, 0x43, 0x59, 0x55, 0x02, 0x65, 0x38, 0x59, 0x13, 0xD3, 0xE1, 0x32, 0x5E, 0x8F,
-    0x21, 0xF7, 0x4D, 0x22, 0x39, 0x71, 0x79, 0x94, 0x88, 0xC7, 0x8D, 0xE9, 0x67, 0x84, 0xFD, 0x7B,
-    0x00, 0x05, 0x87, 0xA1, 0x9C, 0x1E, 0xE7, 0x1E, 0xF1, 0xF9, 0x97, 0xB0, 0x0D, 0x64, 0x72, 0x55,
-    0xE9, 0x29, 0xA1, 0xF7, 0x4A, 0xFA, 0xF8, 0x2A, 0x66, 0x83, 0xD7, 0x8C, 0x88, 0xD2, 0x95, 0xEF,
-    0x10, 0xD4, 0x05, 0x13, 0x30, 0x83, 0xA7, 0xAB, 0x90, 0x55, 0x5C, 0x93, 0x9A, 0x49, 0x65, 0xC7,
-    0xDB, 0xB3, 0xE3, 0x9D, 0xA8, 0x8C, 0x77, 0x65, 0xBC, 0x18, 0xDC, 0x4C, 0x2D, 0xA4, 0xEE, 0xE0,
-    0xCA, 0x2E, 0x15, 0x41, 0x40, 0x75, 0x13, 0x45, 0x9F, 0x98, 0xD3, 0x27, 0x5A, 0x44, 0x9E, 0xE6,
-    0x7D, 0xB6, 0xA4, 0x61, 0x82, 0x99, 0xD5, 0x52, 0xAE, 0x4C, 0xF6, 0x25, 0x1C, 0xA8, 0xA5, 0x0A,
-    0x6A, 0xE1, 0xCE, 0xB5, 0xA1, 0x29, 0x6A, 0x68, 0x01, 0x92, 0x71, 0x38, 0x1A, 0x39, 0x9C, 0x0C,
-    0x1C, 0xCE, 0x3A, 0x0E, 0xEB, 0x3B, 0x7C, 0xB6, 0xE3, 0x70, 0x64, 0x8F, 0x87, 0x1D, 0x87, 0x33,
-    0x17, 0xBF, 0x58, 0xF9, 0xB6, 0x5F, 0xBD, 0x33, 0xE5, 0xA1, 0x40, 0x92, 0x45, 0x21, 0x8C, 0x28,
-    0x85, 0x21, 0x25, 0xEC, 0x2D, 0x58, 0xA1, 0xD8, 0x57, 0xF9, 0x33, 0x37, 0xBD, 0xE9, 0x1D, 0x86,
-    0x46, 0x97, 0x98, 0x91, 0xFC, 0xCE, 0x81, 0xFD, 0x2B, 0xEF, 0x2B, 0x2A, 0x4D, 0xFB, 0x78, 0x6B,
-    0x18, 0x49, 0xA7, 0xAE, 0x20, 0xF4, 0x32, 0x41, 0xB1, 0xB0, 0x18, 0xF9, 0x90, 0xEB, 0xD8, 0x3E,
-    0x73, 0x1E, 0x1B, 0x5C, 0xB1, 0x70, 0x65, 0xEB, 0x7D, 0xDC, 0xFB, 0x80, 0xB6, 0xE9, 0x7D, 0xA2,
-    0x3D, 0x4A, 0x26, 0x3E, 0xB7, 0x40, 0x5F, 0x50, 0x94, 0x25, 0xF4, 0xEB, 0xA7, 0x37, 0x0B, 0xE7,
-    0xAD, 0x41, 0x13, 0x88, 0x2F, 0x9D, 0x3A, 0xA5, 0xB1, 0x62, 0xEB, 0x8D, 0x51, 0x1E, 0x03, 0xCF,
-    0x99, 0x1A, 0x28, 0x12, 0x72, 0xD9, 0x90, 0xE2, 0x69, 0x5D, 0xC4, 0x02, 0x35, 0xBA, 0x93, 0x78,
-    0x91, 0x60, 0x90, 0xD8, 0x91, 0x52, 0x44, 0xEC, 0x2D, 0x93, 0xCC, 0x86, 0x55, 0x25, 0x63, 0x24,
-    0x80, 0xCB, 0xFE, 0x98, 0x2E, 0x10, 0xBA, 0xE9, 0xBD, 0x0E, 0x66, 0x9A, 0x78, 0xF5, 0xAA, 0xE5,
-    0x4C, 0xFA, 0x4F, 0x79, 0x8F, 0x4D, 0x26, 0xC6, 0x45, 0xE6, 0x7E, 0x76, 0xA5, 0x36, 0x52, 0x04,
-    0x49, 0x2D, 0x65, 0x65, 0xDF, 0x71, 0x3F, 0x11, 0x11, 0x00, 0x59, 0x7F, 0x84, 0x7B, 0xBE, 0x4B,
-    0xF7, 0xD1, 0xD7, 0xC8, 0xFE, 0xBA, 0x89, 0x6B, 0x90, 0xC5, 0xC8, 0x32, 0xF6, 0x64, 0x3D, 0xEE,
-    0x77, 0x0C, 0xEE, 0xAF, 0xAC, 0xD4, 0x7B, 0x42, 0xBE, 0xB9, 0x1B, 0xE5, 0x81, 0xEF, 0x71, 0xF7,
-    0x90, 0xBB, 0x17, 0x90, 0x2B, 0x1E, 0x41, 0xD6, 0x03, 0xF7, 0x1E, 0xD4, 0x5A, 0x3E, 0x21, 0x5D,
-    0xD9, 0x27, 0x61, 0x9D, 0xCA, 0x16, 0x6B, 0xA8, 0xB6, 0x2E, 0xF7, 0xF5, 0xE5, 0xBE, 0xBC, 0x74,
-    0xFA, 0x73, 0x7D, 0xE0, 0x07, 0x9C, 0xFD, 0xBE, 0x75, 0x1F, 0x5A, 0xA8, 0x2B, 0xB8, 0x49, 0xA6,
-    0x83, 0x4F, 0xE4, 0x3F, 0xF6, 0xFF, 0xFD, 0x0C, 0xF3, 0x27, 0xF6, 0x9F, 0xFE, 0xF8, 0x03, 0x63,
-    0xA6, 0xDD, 0xEB, 0x25, 0x48, 0x41, 0x5B, 0xBA, 0xA6, 0x44, 0xF8, 0x21, 0x74, 0x1F, 0x8B, 0xA6,
-    0x01, 0x0F, 0x84, 0x13, 0x20, 0x46, 0x87, 0x9B, 0x12, 0x24, 0x2D, 0xEC, 0x80, 0xA4, 0x69, 0x07,
-    0x0B, 0xA6, 0x2D, 0x31, 0xEE, 0x11, 0xF3, 0xD9, 0x27, 0xD4, 0xC0, 0xA7, 0x54, 0x18, 0xC1, 0x2C,
-    0x63, 0x5E, 0xC8, 0x98, 0x27, 0x48, 0xC3, 0x11, 0x4F, 0x64, 0x22, 0xFC, 0x21, 0x67, 0x16, 0xD2,
-    0x1F, 0x92, 0x97, 0xED, 0x61, 0x50, 0xDF, 0xC1, 0xA0, 0x36, 0x35, 0xA0, 0x08, 0x46, 0x81, 0x53,
-    0xA4, 0xF0, 0x7D, 0x13, 0x83, 0x9E, 0x80, 0x39, 0xDA, 0xD7, 0x2A, 0xEF, 0x72, 0x27, 0xB7, 0xFC,
-    0x4B, 0x36, 0xFD, 0xEA, 0x56, 0x7D, 0xF9, 0x56, 0x3E, 0xBD, 0xE5, 0x68, 0xEE, 0x93, 0xDB, 0x6B,
-    0x3F, 0x87, 0x97, 0xDD, 0x54, 0x94, 0xB7, 0x6C, 0x53, 0xAE, 0xC4, 0x05, 0x14, 0x94, 0x15, 0x65,
-    0x05, 0x71, 0x03, 0x08, 0x1C, 0xF1, 0xA4, 0x81, 0x8F, 0x90, 0xCD, 0x62, 0x7D, 0x2C, 0xCB, 0x5C,
-    0x7D, 0x61, 0x04, 0x8B, 0xF8, 0xB4, 0xCF, 0x3F, 0xB4, 0xD1, 0x58, 0x5F, 0x40, 0xE9, 0x55, 0xDE,
-    0x47, 0x0D, 0xE0, 0xD2, 0xA1, 0xBE, 0x66, 0xF3, 0x0E, 0xDF, 0xDA, 0xB8, 0x5B, 0x9D, 0xDB, 0x43,
-    0x6C, 0x8C, 0xA9, 0x45, 0x32, 0x77, 0xC6, 0xED, 0x8D, 0x11, 0x62, 0x05, 0x27, 0xB9, 0x2B, 0x70,
-    0x82, 0xA7, 0xE0, 0x04, 0x8F, 0x0D, 0xDC, 0x3D, 0x68, 0xBC, 0xC9, 0xC6, 0xB2, 0x8D, 0x80, 0xA1,
-    0x0F, 0x59, 0x01, 0xE7, 0x63, 0x29, 0xD9, 0x5E, 0xBC, 0xFC, 0xEB, 0xDF, 0x17, 0xD2, 0x00, 0x36,
-    0x14, 0x59, 0x32, 0x2B, 0x70, 0x38, 0x3A, 0x28, 0x7E, 0x84, 0x0D, 0x50, 0xFA, 0x0D, 0xDA, 0x15,
-    0xC1, 0x98, 0x42, 0xB0, 0xF2, 0xE2, 0xC1, 0xA8, 0xF2, 0x07, 0x08, 0x00, 0xD4, 0x90, 0x37, 0xC0,
-    0x80, 0xB2, 0xD6, 0x29, 0x97, 0x0C, 0x79, 0xA3, 0xEF, 0x4E, 0x91, 0xC5, 0x1C, 0x55, 0x7D, 0xD1,
-    0xEA, 0x0E, 0xF7, 0xA5, 0x16, 0xEE, 0xBA, 0x07, 0xB5, 0xFF, 0xA4, 0x73, 0x26, 0xFD, 0x02, 0x83,
-    0x80, 0x9C, 0x94, 0x69, 0xE1, 0x3A, 0x8C, 0x0E, 0x48, 0x06, 0x61, 0x1F, 0x20, 0x44, 0x36, 0xCD,
-    0x20, 0xCC, 0x30, 0x61, 0xFE, 0x7D, 0x06, 0x6D, 0x00, 0xFB, 0x5C, 0x93, 0x8C, 0x84, 0x61, 0xCD,
-    0xBC, 0x7C, 0x95, 0x17, 0x49, 0x34, 0x44, 0x23, 0x8D, 0x10, 0xBF, 0x20, 0xAC, 0xA4, 0x64, 0x49,
-    0x4A, 0xFF, 0x84, 0xB1, 0x5B, 0x13, 0xEC, 0xC2, 0x51, 0xC8, 0xC2, 0x3C, 0xCC, 0x2C, 0x27, 0xA1,
-    0x9A, 0xF4, 0x74, 0x91, 0xFA, 0xAE, 0x7B, 0x11, 0xAC, 0x3A, 0xC2, 0xB1, 0x1B, 0xA4, 0x96, 0x37,
-    0xA9, 0xC0, 0x5F, 0x2A, 0x88, 0x9B, 0x10, 0xCA, 0x20, 0x89, 0xD4, 0xF6, 0x82, 0x00, 0x3E, 0x25,
-    0x0D, 0xE1, 0x74, 0xCB, 0x99, 0x5D, 0xC0, 0x02, 0x10, 0x49, 0x83, 0xC1, 0x26, 0x1F, 0x01, 0x09,
-    0x06, 0x08, 0x34, 0x32, 0xEB, 0x7D, 0x0B, 0xE4, 0x76, 0x6F, 0xC6, 0xCA, 0x0E, 0x91, 0xD8, 0xA4,
-    0xD3, 0x4D, 0x9F, 0x33, 0x08, 0x0C, 0xA5, 0xF1, 0x80, 0x44, 0x4C, 0x11, 0x74, 0xA9, 0x8D, 0xA7,
-    0x09, 0x5C, 0x5B, 0x48, 0xEF, 0xAD, 0x7D, 0xE3, 0x60, 0x75, 0xF2, 0x8D, 0x8E, 0x81, 0xC3, 0x9F,
-    0x0A, 0x64, 0x15, 0xF1, 0xE8, 0xB9, 0xAA, 0x51, 0x93, 0xD0, 0x14, 0x76, 0x4D, 0x4A, 0xF1, 0xB5,
-    0x94, 0x39, 0x51, 0x85, 0xBE, 0x27, 0x54, 0x0A, 0xEE, 0x66, 0x66, 0x92, 0x1E, 0x0D, 0x7F, 0x56,
-    0xA3, 0x24, 0x28, 0x3D, 0xFF, 0xE0, 0x24, 0x77, 0x51, 0x11, 0x91, 0x4D, 0x06, 0xF5, 0x66, 0x00,
-    0x8F, 0xA8, 0xD2, 0xC9, 0x15, 0x7A, 0xFA, 0x0F, 0x28, 0x41, 0x54, 0xD1, 0x28, 0xDF, 0xDC, 0x48,
-    0x05, 0xB0, 0x78, 0x42, 0x49, 0x6A, 0xE7, 0xAA, 0xA3, 0xCE, 0x00, 0xEC, 0x53, 0x08, 0x2B, 0xEB,
-    0xFD, 0x89, 0x7A, 0x6D, 0xEB, 0x9F, 0x78, 0x25, 0x6B, 0x1F, 0xDC, 0x03, 0xE7, 0xA8, 0x52, 0x40,
-    0x21, 0xA8, 0x64, 0xD2, 0xA0, 0xF0, 0xDC, 0xE0, 0x41, 0x9B, 0x21, 0x01, 0x80, 0x47, 0xD7, 0x6C,
-    0xA7, 0x0C, 0x92, 0x62, 0x71, 0x50, 0xD1, 0x06, 0x4A, 0xFF, 0x7A, 0x75, 0x80, 0xA2, 0xE0, 0x3A,
-    0x58, 0x20, 0x30, 0x20, 0xED, 0x60, 0x6A, 0xC7, 0x83, 0x9E, 0x07, 0xD7, 0x61, 0x18, 0x0B, 0xC0,
-    0xA2, 0xF3, 0xA6, 0x23, 0x0F, 0xB0, 0xA6, 0x3F, 0x5C, 0xF1, 0x94, 0xC6, 0x48, 0xA1, 0x25, 0x0D,
-    0x27, 0x90, 0x42, 0xF7, 0x58, 0x2D, 0x23, 0x17, 0x1E, 0xE1, 0xB8, 0x24, 0x21, 0x9F, 0xB0, 0x7C,
-    0xBE, 0x56, 0xB9, 0x58, 0x55, 0x93, 0xB0, 0xF2, 0x1E, 0x81, 0x0E, 0xCE, 0x07, 0x2E, 0xD9, 0xC9,
-    0x9A, 0xA4, 0xC1, 0x25, 0xD1, 0x10, 0x0B, 0x6B, 0xCD, 0x1C, 0x39, 0x2A, 0x98, 0xB8, 0xDB, 0xAA,
-    0xE7, 0xFE, 0x4F, 0xC5, 0x9D, 0x15, 0x2A, 0x53, 0x11, 0x72, 0x7B, 0x76, 0x82, 0x1E, 0x1F, 0xE6,
-    0x19, 0xE9, 0x9D, 0x7D, 0xCC, 0xDD, 0x17, 0x02, 0xCA, 0x3F, 0x5B, 0x1E, 0xD5, 0x8A, 0x4F, 0x85,
-    0x9E, 0x6F, 0x79, 0x71, 0x44, 0x32, 0x3F, 0x28, 0x4D, 0xB9, 0x61, 0xCE, 0x2F, 0x73, 0xAA, 0x91,
-    0xAC, 0x13, 0x1F, 0x0F, 0x0A, 0x47, 0x13, 0x5A, 0x49, 0x06, 0x3C, 0x67, 0x2C, 0xFA, 0x90, 0x1F,
-    0x4C, 0xED, 0x11, 0x85, 0xA3, 0xD4, 0xF0, 0xB6, 0xD0, 0xD1, 0xDD, 0xEA, 0x7B, 0xF8, 0x21, 0xFF,
-    0x8C, 0xFD, 0x32, 0xFB, 0xCA, 0x60, 0x27, 0x69, 0x52, 0xF2, 0x25, 0x55, 0x53, 0x32, 0xB9, 0x30,
-    0x88, 0x19, 0xE5, 0x18, 0x9C, 0x64, 0xF0, 0xDA, 0xD1, 0x60, 0x8F, 0xC1, 0x70, 0x24, 0x5D, 0x73,
-    0x17, 0x1C, 0x9F, 0x50, 0x1F, 0x5C, 0xF1, 0xFA, 0xB0, 0xD1, 0x21, 0xA5, 0x71, 0xE2, 0x35, 0x05,
-    0x09, 0xC4, 0xAC, 0x8C, 0xBF, 0xC2, 0x02, 0x83, 0x9F, 0xD3, 0x15, 0x7D, 0xCA, 0x8A, 0x07, 0x52,
-    0x67, 0x16, 0x25, 0x87, 0xFB, 0xBC, 0xA5, 0xBD, 0xB4, 0x61, 0xA4, 0x94, 0x86, 0xB5, 0x98, 0xAB,
-    0xE8, 0xEC, 0x8E, 0x1F, 0x2E, 0xD3, 0x15, 0xD1, 0xC4, 0xA5, 0xC6, 0x72, 0x01, 0x17, 0xAA, 0x5B,
-    0xF2, 0x72, 0x94, 0x56, 0x4C, 0x01, 0x3D, 0x33, 0x78, 0x3A, 0xC0, 0x2D, 0x0E, 0x39, 0xB6, 0xEC,
-    0x23, 0xB1, 0x6D, 0x24, 0xCC, 0x37, 0x70, 0x5E, 0x31, 0x22, 0x14, 0x63, 0xBB, 0x94, 0xC8, 0x8E,
-    0xAC, 0x97, 0x52, 0x92, 0x0A, 0xB5, 0x79, 0xB9, 0xF3, 0xC3, 0x79, 0xE3, 0xFD, 0x45, 0x0C, 0x01,
-    0x73, 0xC8, 0xDD, 0xA8, 0xF1, 0x2C, 0x4D, 0x97, 0x76, 0x49, 0x4F, 0x9D, 0x6B, 0x03, 0x13, 0xA1,
-    0x08, 0x9D, 0x70, 0x84, 0x52, 0x05, 0x83, 0x70, 0x64, 0x76, 0x32, 0xA3, 0x11, 0xEC, 0x00, 0x27,
-    0xC9, 0x90, 0xBE, 0xB4, 0xB0, 0x60, 0xD6, 0xD5, 0xF7, 0x01, 0x8B, 0xC8, 0x44, 0x53, 0x46, 0x9D,
-    0xBB, 0xBC, 0xD7, 0x4F, 0x2C, 0x02, 0x1A, 0x95, 0xEE, 0xB3, 0x96, 0x24, 0x42, 0x51, 0x67, 0x99,
-    0xEB, 0x22, 0xC9, 0x5A, 0xCE, 0x88, 0x13, 0x0A, 0x07, 0xA5, 0xC5, 0x50, 0x22, 0x90, 0x53, 0x90,
-    0x97, 0xF5, 0xEA, 0xB0, 0x4A, 0x65, 0x2F, 0x07, 0xC1, 0x65, 0x66, 0x1C, 0x80, 0x5C, 0x70, 0x25,
-    0x21, 0xDE, 0xEC, 0x68, 0x4C, 0x2C, 0x50, 0xC0, 0xB7, 0x84, 0x29, 0x24, 0xC2, 0x03, 0xB9, 0x96,
-    0xE4, 0xA5, 0x27, 0xA5, 0x5C, 0x5E, 0x26, 0x6B, 0xF7, 0x75, 0x8A, 0x0C, 0xA4, 0xE2, 0xED, 0xB5,
-    0x68, 0x70, 0xA2, 0xEE, 0xF4, 0x73, 0x48, 0x15, 0xBA, 0x8B, 0x52, 0x06, 0xC5, 0xB4, 0x88, 0x01,
-    0x56, 0xA1, 0xCE, 0x80, 0x08, 0x35, 0xEA, 0x4E, 0x14, 0x21, 0x6C, 0x7B, 0x90, 0x23, 0x97, 0x52,
-    0x19, 0x94, 0xC2, 0x51, 0xBE, 0x4F, 0x92, 0x41, 0x86, 0x9F, 0x4A, 0x26, 0xA7, 0x5A, 0xA0, 0xB8,
-    0xAC, 0x15, 0xFA, 0x10, 0x88, 0xE7, 0x30, 0x9B, 0xB3, 0xF1, 0x18, 0x38, 0x42, 0xBA, 0xE6, 0x6A,
-    0x13, 0xC1, 0x12, 0xA9, 0x1D, 0xF3, 0xF1, 0xD8, 0x95, 0x69, 0x00, 0xDD, 0x1E, 0x72, 0x33, 0x0A,
-    0x41, 0xDA, 0x42, 0x39, 0x05, 0xD6, 0x38, 0xC8, 0x64, 0x2A, 0xDA, 0x11, 0x6E, 0x47, 0x25, 0x32,
-    0x2C, 0x3D, 0x9E, 0xE7, 0x1E, 0xBD, 0x8E, 0x56, 0x28, 0x87, 0xDD, 0xF1, 0x61, 0x2F, 0x87, 0x74,
-    0x06, 0xB9, 0x2C, 0xF5, 0x53, 0x4B, 0xE6, 0xF0, 0xDA, 0xF0, 0x87, 0xCD, 0x61, 0x1D, 0x9A, 0x08,
-    0x2E, 0xD4, 0x93, 0x1C, 0x76, 0x87, 0xB1, 0x7E, 0xC7, 0x1D, 0x16, 0x15, 0x6E, 0x12, 0x7C, 0x10,
-    0x52, 0xEB, 0x3A, 0xDC, 0x88, 0x94, 0xEC, 0x9A, 0x91, 0xF5, 0xBB, 0x3D, 0xDC, 0x81, 0xD5, 0x66,
-    0x47, 0xBB, 0xBC, 0x42, 0x2D, 0x38, 0xEF, 0xC4, 0x86, 0x47, 0xBB, 0x13, 0x4D, 0x50, 0x10, 0xF9,
-    0xF2, 0x68, 0xB7, 0xCB, 0x36, 0xDB, 0x2E, 0x1F, 0x5F, 0x3B, 0x70, 0x84, 0x95, 0x15, 0xDF, 0x0A,
-    0xFC, 0x0B, 0x95, 0x28, 0xF5, 0x01, 0xFB, 0x49, 0xE7, 0xD9, 0x11, 0xCC, 0xD8, 0xB1, 0x49, 0x2B,
-    0x94, 0x98, 0x51, 0xC3, 0x2E, 0x29, 0x92, 0x2B, 0xFB, 0xA6, 0xF0, 0x9A, 0x0D, 0x99, 0x93, 0x4D,
-    0x28, 0xC8, 0x33, 0x72, 0xE4, 0x7B, 0x2A, 0x42, 0x19, 0x5E, 0x8F, 0x58, 0x1C, 0x56, 0x26, 0xB3,
-    0x9F, 0x7A, 0xE2, 0x49, 0x51, 0x4E, 0xC9, 0x78, 0x52, 0xF8, 0x53, 0xAB, 0x3A, 0xB9, 0x5C, 0x3C,
-    0x23, 0xFD, 0x88, 0x9C, 0xFF, 0x81, 0x1B, 0x17, 0x56, 0x0A, 0xF5, 0xC7, 0xD2, 0x1A, 0x44, 0x4C,
-    0x3F, 0x69, 0x52, 0xD5, 0xBF, 0xAB, 0xDE, 0x50, 0x3E, 0x40, 0x9D, 0x7B, 0xC9, 0xDD, 0xBF, 0x6E,
-    0x6D, 0x6D, 0xDD, 0xD4, 0x44, 0x47, 0x00, 0x22, 0xFC, 0x29, 0xF0, 0x39, 0x38, 0x9C, 0x32, 0xD8,
-    0xF8, 0xA5, 0x89, 0x0F, 0xEA, 0x2E, 0xEA, 0x42, 0x1B, 0x52, 0x18, 0x78, 0x57, 0x83, 0xD5, 0xF6,
-    0x4C, 0x31, 0x58, 0x78, 0x7E, 0x95, 0xF4, 0x72, 0x1D, 0x40, 0x97, 0xEE, 0xFB, 0xE4, 0xCE, 0xFA,
-    0xA6, 0x8B, 0xDD, 0xB8, 0xAE, 0xF2, 0x21, 0x2B, 0x18, 0xF4, 0xD9, 0xC9, 0x5A, 0xE4, 0xA8, 0x7C,
-    0x39, 0x55, 0xCF, 0x7C, 0xE4, 0x4C, 0x44, 0xDF, 0x71, 0xD3, 0x6A, 0x0B, 0x07, 0xDB, 0x01, 0xDC,
-    0xA6, 0x77, 0x91, 0x7F, 0x7B, 0x24, 0xDD, 0x75, 0xD0, 0xC0, 0xEC, 0x3A, 0x88, 0xFF, 0x03, 0x42,
-    0x41, 0x59, 0x85, 0x36, 0x1D, 0xFF, 0x5C, 0xCA, 0x3A, 0xA2, 0x1F, 0x4B, 0x1F, 0xB6, 0x22, 0x30,
-    0xD3, 0xDC, 0x8C, 0x89, 0x39, 0x97, 0x55, 0xEE, 0xDF, 0x2B, 0xDC, 0xC8, 0xC7, 0x94, 0xBE, 0xA7,
-    0xBA, 0xE3, 0x3B, 0x06, 0x1B, 0x5E, 0x18, 0xCD, 0x1C, 0xFF, 0x63, 0xBA, 0x2C, 0x62, 0x61, 0x98,
-    0x33, 0xD4, 0xDC, 0x85, 0x65, 0x9C, 0x4B, 0xEB, 0x74, 0xFB, 0x44, 0x5B, 0x76, 0x6E, 0xB2, 0x02,
-    0xFA, 0x70, 0xC3, 0x0F, 0xC1, 0x68, 0x5F, 0xB6, 0xF9, 0x66, 0x39, 0xA4, 0x55, 0x34, 0xE1, 0xE7,
-    0xFA, 0x1A, 0xEC, 0xFF, 0x08, 0x84, 0x7B, 0x58, 0x67, 0x31, 0x0C, 0x34, 0xBE, 0xD4, 0x91, 0xA9,
-    0x29, 0xE0, 0x0E, 0x16, 0xC6, 0x42, 0xAF, 0x82, 0xB4, 0x6D, 0xE2, 0x2C, 0x1E, 0x36, 0x2C, 0xF9,
-    0x87, 0x9D, 0x1B, 0x98, 0xC1, 0x8B, 0x68, 0x88, 0x1A, 0xCC, 0xD1, 0x41, 0xA7, 0x6B, 0x4B, 0xEA,
-    0xCA, 0x36, 0xEE, 0x18, 0xA1, 0xC5, 0xDF, 0xEC, 0x14, 0xBE, 0x47, 0x27, 0x6D, 0xDD, 0x4A, 0xDA,
-    0x9D, 0x5F, 0x63, 0x77, 0x93, 0x3D, 0xAA, 0x80, 0xA9, 0xF7, 0x9C, 0xF4, 0x23, 0x63, 0x10, 0x8A,
-    0x56, 0x3A, 0xFA, 0xE7, 0xF9, 0xDA, 0x63, 0x11, 0xDA, 0x80, 0x59, 0xFF, 0xFA, 0xE0, 0xA7, 0xAF,
-    0x78, 0xF1, 0xBC, 0x03, 0x34, 0xD5, 0x7E, 0xA7, 0xCA, 0xCD, 0xEF, 0x80, 0x5C, 0x30, 0xA9, 0x5A,
-    0x94, 0xF8, 0x76, 0x09, 0x05, 0xF4, 0x22, 0x4C, 0xB9, 0x86, 0x65, 0xAC, 0xC1, 0x17, 0xFC, 0x16,
-    0x0F, 0x8B, 0x40, 0x02, 0xFD, 0x54, 0xEA, 0xD7, 0x1E, 0xD7, 0xF6, 0x91, 0x3B, 0xE8, 0x55, 0xF9,
-    0xCB, 0xCE, 0xB7, 0x64, 0xB3, 0xEE, 0xF7, 0x81, 0x0C, 0x99, 0x7F, 0x67, 0x53, 0xE4, 0xAC, 0xAE,
-    0x01, 0x14, 0x54, 0x99, 0x6C, 0xD5, 0x2B, 0x5B, 0xE1, 0x1B, 0xDA, 0xB2, 0x5D, 0x86, 0x7E, 0x50,
-    0x20, 0xB2, 0x49, 0x92, 0x0F, 0x71, 0x9F, 0x37, 0x01, 0xB3, 0xA0, 0xC5, 0x5A, 0xB7, 0xE1, 0x16,
-    0x27, 0x37, 0xCB, 0x0D, 0xCE, 0x34, 0xCA, 0x56, 0x05, 0x63, 0x8D, 0x2D, 0xBF, 0x38, 0xE8, 0xEB,
-    0xB6, 0x9E, 0xAB, 0xCD, 0xE5, 0x3C, 0xEC, 0xF2, 0xB0, 0xFD, 0x06, 0xF7, 0x9D, 0x8E, 0x0E, 0x3F,
-    0xA8, 0x6D, 0x43, 0x5F, 0x1D, 0x59, 0xF2, 0x40, 0x5F, 0x5E, 0xCE, 0x7F, 0xCB, 0x6C, 0xCB, 0xF3,
-    0xD3, 0xF1, 0x13, 0xFE, 0x1F, 0x1F, 0x28, 0xF6, 0xE4, 0x27, 0x6E, 0xE8, 0xC0, 0xA5, 0xC9, 0x9C,
-    0x94, 0x35, 0x47, 0xBD, 0xAF, 0xAC, 0x9A, 0x37, 0x16, 0x45, 0x27, 0xB7, 0xD9, 0x89, 0x34, 0x92,
-    0x84, 0x66, 0x68, 0x23, 0x81, 0x68, 0x26, 0x0E, 0x92, 0x4B, 0xEB, 0x01, 0x55, 0x8E, 0xC1, 0x36,
-    0x4A, 0xE0, 0x6E, 0x09, 0xD8, 0x2D, 0x81, 0xBA, 0x25, 0x40, 0xB7, 0x04, 0xED, 0xAA, 0x71, 0xD5,
-    0x02, 0xDF, 0xD1, 0x58, 0xBE, 0x3A, 0x39, 0x7C, 0x5F, 0xC2, 0x37, 0x87, 0x90, 0x7C, 0x07, 0x8F,
-    0x48, 0x9A, 0x90, 0x07, 0xBA, 0x48, 0x1B, 0xB8, 0xFB, 0xC8, 0x03, 0xB7, 0x07, 0xA8, 0x02, 0x35,
-    0x9B, 0x8A, 0x73, 0xBD, 0xDA, 0x76, 0x13, 0x50, 0x31, 0x65, 0x69, 0x8A, 0x6A, 0x01, 0x56, 0x0A,
-    0x06, 0x04, 0x39, 0x12, 0x8B, 0x19, 0x19, 0x0A, 0x6B, 0x90, 0x07, 0xAE, 0x71, 0xC7, 0x32, 0x4A,
-    0x18, 0x6C, 0x1B, 0x2A, 0xFE, 0xC8, 0x32, 0x56, 0x76, 0x60, 0x08, 0xA0, 0xD5, 0x2F, 0x3D, 0x6C,
-    0xD1, 0x02, 0x48, 0xDB, 0xF2, 0xEE, 0x67, 0x2A, 0x0B, 0xAC, 0x86, 0x05, 0x00, 0x2E, 0x99, 0x54,
-    0xB0, 0xAC, 0xB2, 0x5C, 0x1A, 0x19, 0x26, 0xEF, 0x93, 0x36, 0x6F, 0xA2, 0x2E, 0x37, 0x61, 0x0F,
-    0xC4, 0xE3, 0x36, 0xCC, 0x1B, 0x6C, 0x18, 0xC2, 0xB6, 0x7E, 0x2B, 0x4F, 0x6C, 0xB5, 0x41, 0x9E,
-    0xCA, 0xF7, 0x99, 0x4B, 0xAA, 0x64, 0xAA, 0xBB, 0x8C, 0xF7, 0x4A, 0x23, 0x5D, 0xAD, 0xC3, 0xFF,
-    0x37, 0x10, 0xB9, 0x4B, 0xD8, 0x36, 0x10, 0x07, 0x1B, 0x84, 0x29, 0xFD, 0xEB, 0x6F, 0xD3, 0x67,
-    0xF9, 0xEE, 0x0B, 0x85, 0x0A, 0x4B, 0x39, 0x26, 0x92, 0xAF, 0x6F, 0x2A, 0x9D, 0x83, 0xDC, 0xBE,
-    0x3C, 0xA8, 0x39, 0x00, 0xBA, 0x0B, 0x64, 0x06, 0x05, 0x58, 0x84, 0xA4, 0xD2, 0xC5, 0x5A, 0x0A,
-    0xE4, 0xA0, 0x51, 0x4B, 0xFC, 0xA9, 0xC9, 0xA7, 0x40, 0x48, 0x14, 0x3B, 0x06, 0x7D, 0xFC, 0x39,
-    0xC9, 0x14, 0xD2, 0x52, 0xD2, 0x2E, 0x30, 0x95, 0x7B, 0x90, 0x0A, 0x24, 0x35, 0x0A, 0xD7, 0x3F,
-    0x22, 0xB7, 0xC7, 0xAD, 0x8D, 0xCD, 0xB3, 0x24, 0x0C, 0x08, 0xB2, 0x09, 0xD5, 0x4F, 0x8A, 0xCA,
-    0x03, 0xB6, 0x00, 0x6B, 0x02, 0x60, 0x4F, 0x08, 0x5B, 0x2C, 0x49, 0x76, 0xDB, 0xBC, 0x79, 0x8D,
-    0xDE, 0xB7, 0xCE, 0xDD, 0x12, 0xA9, 0x24, 0x80, 0xC3, 0x92, 0xB5, 0x59, 0xB2, 0x27, 0x32, 0xE8,
-    0x71, 0x9B, 0x9C, 0x6C, 0x7E, 0x41, 0xCC, 0xDD, 0xDA, 0x61, 0x62, 0x96, 0x1C, 0xC9, 0x66, 0x66,
-    0x30, 0x73, 0xDD, 0xF4, 0x07, 0xFD, 0x12, 0x72, 0x9C, 0xBB, 0xE6, 0xFE, 0x05, 0xB4, 0xB2, 0x84,
-    0x5A, 0x19, 0x85, 0xD2, 0xB7, 0xA3, 0x49, 0xC8, 0x91, 0x80, 0xF4, 0xF0, 0x1F, 0xD2, 0xB5, 0xD5,
-    0x09, 0xBE, 0x30, 0xAA, 0xDD, 0x6F, 0x2E, 0xF3, 0x7D, 0x68, 0x3A, 0xC3, 0x6D, 0xFD, 0xD8, 0xE7,
-    0x53, 0x68, 0x0B, 0x14, 0x9C, 0x8D, 0x1E, 0xF5, 0x38, 0x96, 0x36, 0x8F, 0xE3, 0xBC, 0x00, 0x97,
-    0xB9, 0x0C, 0x8B, 0x2B, 0xFA, 0x04, 0xDF, 0x9D, 0xEC, 0xD0, 0x97, 0x23, 0x69, 0x1F, 0x59, 0xC2,
-    0x36, 0xA6, 0x81, 0x82, 0x8E, 0xDF, 0xF2, 0xF8, 0x57, 0x3E, 0x81, 0x7F, 0xBB, 0x91, 0xB1, 0xB3,
-    0x45, 0x84, 0x22, 0xAF, 0xDA, 0x51, 0xE1, 0x8B, 0x5E, 0x25, 0x0F, 0x1B, 0x95, 0xBF, 0x57, 0xA9,
-    0x9D, 0x0D, 0x80, 0x3A, 0xFC, 0x09, 0xE0, 0xA1, 0x7F, 0x08, 0x3F, 0xE2, 0xFB, 0x43, 0x7A, 0xD5,
-    0xA0, 0xDC, 0x0D, 0x9F, 0xC9, 0x51, 0xED, 0x32, 0xCD, 0x7E, 0x6C, 0x4A, 0xB6, 0x13, 0x05, 0x00,
-    0xA3, 0x4F, 0xF0, 0x9C, 0x6D, 0xC4, 0x56, 0x5A, 0x81, 0xC2, 0x75, 0xF2, 0xDA, 0x51, 0xC3, 0x41,
-    0x11, 0xD7, 0xCC, 0x76, 0x08, 0xB2, 0x5D, 0x3C, 0x3C, 0xE6, 0x6B, 0x00, 0x4E, 0x1A, 0x4C, 0xC3,
-    0xCC, 0x30, 0xC8, 0x35, 0xE4, 0xE5, 0x6A, 0x4D, 0xE0, 0xC3, 0xF1, 0x27, 0x92, 0x75, 0xA4, 0x86,
-    0xBB, 0xCB, 0x9A, 0xD0, 0x66, 0x66, 0x01, 0x89, 0x74, 0x0C, 0x86, 0xA8, 0x4F, 0x5B, 0xDD, 0x68,
-    0xFA, 0x40, 0xDC, 0xC5, 0xCF, 0x9D, 0xDD, 0x45, 0x40, 0xBA, 0x67, 0x4D, 0x24, 0x8D, 0xA4, 0x1C,
-    0x65, 0xB1, 0x09, 0x5C, 0xCF, 0x6A, 0x6B, 0x62, 0x0F, 0x0B, 0x5E, 0x83, 0xFA, 0xAA, 0x07, 0xB5,
-    0x92, 0x9C, 0x9C, 0x19, 0x00, 0xEA, 0x44, 0xFF, 0x82, 0xC3, 0xAB, 0x8C, 0x2F, 0x71, 0x69, 0x38,
-    0x21, 0x54, 0x6C, 0x4D, 0x93, 0xB5, 0x89, 0x3D, 0xF5, 0x33, 0xB6, 0x57, 0x5C, 0x21, 0xC4, 0xB6,
-    0xAC, 0xF2, 0x16, 0x36, 0x74, 0x17, 0xD9, 0xC3, 0x81, 0x73, 0x6B, 0x28, 0x72, 0x03, 0xCB, 0xDC,
-    0x81, 0x6A, 0x2D, 0x8C, 0x6A, 0xA3, 0x3E, 0x1C, 0xE0, 0xA4, 0x3D, 0x0A, 0xB4, 0x4E, 0x32, 0x8A,
-    0xFE, 0x10, 0x69, 0x86, 0x53, 0x80, 0x1E, 0xC5, 0x52, 0x86, 0x91, 0xD0, 0x55, 0xCC, 0xED, 0x42,
-    0xDE, 0xA5, 0x0B, 0x37, 0xB2, 0x3B, 0x26, 0x2D, 0x19, 0xF6, 0x66, 0xC8, 0x63, 0xF3, 0x4D, 0x61,
-    0xE5, 0x76, 0xDE, 0x46, 0x5F, 0xE4, 0xB0, 0xDA, 0x81, 0xF5, 0xC9, 0xFB, 0xA5, 0x1A, 0x68, 0x85,
-    0xFB, 0x91, 0xF7, 0x93, 0xF8, 0xE9, 0x83, 0xAD, 0x4D, 0xED, 0x5F, 0x26, 0xF5, 0xF2, 0xDE, 0xEA,
-    0x0C, 0x0B, 0x8D, 0x0A, 0x80, 0xC1, 0xAA, 0x69, 0x76, 0x81, 0x57, 0x5E, 0xF4, 0x21, 0xB6, 0x48,
-    0x52, 0x1B, 0xC5, 0x86, 0x5C, 0xE6, 0xB3, 0xEF, 0xAE, 0xF4, 0x12, 0x61, 0x33, 0x9E, 0x8C, 0x92,
-    0xC8, 0xE4, 0xD5, 0x6D, 0x4F, 0xD0, 0x83, 0xF7, 0xBD, 0x75, 0xFE, 0xE8, 0x6F, 0xED, 0x7B, 0xFE,
-    0xEF, 0xF6, 0xED, 0x0F, 0xF0, 0x57, 0xB3, 0x19, 0xEB, 0xEB, 0xF7, 0xD9, 0xC7, 0x9A, 0xA3, 0x39,
-    0x0A, 0x4E, 0x28, 0x6F, 0x98, 0x0A, 0xD1, 0x2D, 0x5F, 0xFE, 0x08, 0x16, 0x9D, 0x92, 0xE8, 0xF8,
-    0x84, 0xA2, 0x1B, 0x2A, 0x0B, 0x09, 0x33, 0x31, 0x6F, 0xFD, 0xC2, 0xFC, 0xD7, 0xDE, 0xDE, 0x3F,
-    0xC4, 0xE3, 0xBB, 0xE4, 0x05, 0xEA, 0x7F, 0x01, 0xD5, 0x5A, 0x4F, 0xAC, 0xDE, 0x54, 0x76, 0x3F,
-    0xB6, 0x49, 0x0C, 0x38, 0xC1, 0x48, 0x85, 0x11, 0x25, 0x01, 0x6F, 0x58, 0x50, 0x14, 0x62, 0x16,
-    0xB3, 0xC8, 0xE2, 0xE5, 0xD9, 0x99, 0x2C, 0x90, 0x3A, 0x0B, 0x52, 0x95, 0xB0, 0x28, 0x95, 0x66,
-    0x34, 0xED, 0xA2, 0x33, 0x2C, 0xD2, 0x4A, 0xB3, 0x48, 0xA5, 0xBC, 0x67, 0x43, 0x16, 0x2C, 0xA8,
-    0x34, 0x4F, 0xAA, 0xA8, 0xBA, 0x6B, 0x16, 0x99, 0xD1, 0x34, 0x5D, 0x4C, 0x16, 0x51, 0xF5, 0xA4,
-    0xBE, 0xF7, 0x6C, 0xF2, 0x16, 0x59, 0xB0, 0x88, 0x29, 0x55, 0x91, 0xBA, 0x89, 0xA3, 0x81, 0x52,
-    0x40, 0xA3, 0x38, 0x83, 0x91, 0x1C, 0x62, 0xFB, 0xF6, 0xF7, 0x3B, 0xD7, 0xDF, 0xF7, 0xDE, 0xCB,
-    0x1F, 0x60, 0x34, 0x61, 0x04, 0xDF, 0xE7, 0xEB, 0xEB, 0xEF, 0xDA, 0xBE, 0xF7, 0x9C, 0x73, 0xCF,
-    0xF9, 0x9D, 0x73, 0xEE, 0xFD, 0x8A, 0xEB, 0xE6, 0x92, 0x09, 0xBB, 0xA4, 0x2E, 0x52, 0x11, 0xD9,
-    0xDD, 0x24, 0xA5, 0x71, 0xFB, 0xA0, 0x89, 0xCB, 0xC2, 0xE9, 0xFD, 0x26, 0x2A, 0x13, 0xE9, 0xBD,
-    0x26, 0xB4, 0x55, 0x50, 0xC6, 0xB2, 0x26, 0xE7, 0xC5, 0xC1, 0x93, 0xA7, 0x44, 0xFC, 0x5C, 0xE4,
-    0xE4, 0xBC, 0x3A, 0xD1, 0x4B, 0x66, 0xCA, 0xD0, 0xFC, 0xB3, 0xDB, 0xAF, 0x4A, 0x12, 0xA4, 0x7E,
-    0x73, 0x41, 0x96, 0x51, 0x55, 0x17, 0x64, 0xDD, 0xFE, 0xCA, 0xBE, 0x9F, 0x7A, 0x43, 0x2B, 0xB1,
-    0xF9, 0xA5, 0x18, 0xD3, 0x78, 0xC6, 0xE4, 0xAE, 0x79, 0x5F, 0x42, 0x74, 0xD6, 0x88, 0x56, 0x5B,
-    0x9F, 0x17, 0x45, 0x5C, 0x33, 0x88, 0x63, 0x0C, 0x7A, 0xAD, 0xF7, 0x35, 0x61, 0x2D, 0xF7, 0x4B,
-    0x8F, 0x1B, 0x41, 0x69, 0xC7, 0x16, 0xAF, 0xC2, 0x69, 0x11, 0xC5, 0xC1, 0xCB, 0x12, 0x92, 0xF8,
-    0xD9, 0xFD, 0xC7, 0xCD, 0xB9, 0xB3, 0x78, 0xD3, 0xE4, 0x91, 0x31, 0x9D, 0xB8, 0x1D, 0x9A, 0x63,
-    0xD0, 0xE8, 0xF1, 0xC2, 0xA0, 0x14, 0x78, 0xB5, 0x78, 0x1F, 0xCF, 0x1A, 0x33, 0xAE, 0x14, 0x78,
-    0xF0, 0x6D, 0x94, 0x81, 0xC3, 0x06, 0xE2, 0x56, 0xF1, 0xB5, 0x4F, 0x5A, 0xBC, 0xD8, 0xF8, 0x6D,
-    0x5C, 0x06, 0xF8, 0x86, 0xA5, 0x5F, 0xA1, 0xD4, 0x61, 0x19, 0x54, 0x41, 0x1B, 0x57, 0x78, 0xAB,
-    0x8A, 0x8D, 0x69, 0x33, 0xD0, 0x16, 0xEF, 0x3A, 0xD2, 0xDE, 0x2F, 0x72, 0xEC, 0x11, 0x90, 0xF1,
-    0xE7, 0xA0, 0x63, 0x88, 0x4A, 0x49, 0xF2, 0x42, 0x82, 0xC6, 0xEB, 0xDD, 0x5E, 0xA2, 0x06, 0x42,
-    0x2D, 0xAE, 0xD5, 0xE2, 0x81, 0x0D, 0x09, 0x39, 0x76, 0x86, 0xB1, 0x3D, 0x12, 0x9A, 0x98, 0xDC,
-    0x23, 0x77, 0x85, 0xF9, 0xAF, 0x59, 0x4B, 0x39, 0xBB, 0x78, 0x0B, 0x2F, 0x80, 0x72, 0x90, 0x56,
-    0x5A, 0xAA, 0x93, 0x19, 0xF9, 0xB8, 0x38, 0xB0, 0x30, 0x7D, 0x54, 0x50, 0x87, 0x4E, 0xE2, 0xB3,
-    0xBA, 0x7A, 0x01, 0x1F, 0xD9, 0x3D, 0xA6, 0x10, 0x6E, 0x03, 0xF1, 0x9C, 0x82, 0x44, 0x1F, 0x93,
-    0xDA, 0x4A, 0x56, 0x36, 0xF8, 0xE2, 0x0D, 0xF0, 0x6C, 0x6A, 0x0E, 0xE9, 0xB7, 0xB2, 0x01, 0x31,
-    0x25, 0x61, 0x8E, 0x69, 0xAA, 0x24, 0xF1, 0xCD, 0x2F, 0x46, 0x97, 0x02, 0x38, 0x61, 0x5A, 0x10,
-    0x88, 0x37, 0x82, 0x9E, 0x94, 0x38, 0xA8, 0x43, 0x32, 0x09, 0x66, 0x13, 0x30, 0xBD, 0xCF, 0xDC,
-    0xD0, 0x21, 0xA3, 0x34, 0x3E, 0xDA, 0x79, 0x5D, 0x52, 0x26, 0x9B, 0xBD, 0xDF, 0x67, 0x65, 0x51,
-    0x3A, 0x1B, 0xF2, 0x90, 0x53, 0x3F, 0xB5, 0xF6, 0xD4, 0x8F, 0xF2, 0x3D, 0xFF, 0x28, 0x38, 0x1E,
-    0xF8, 0xAB, 0x72, 0xCF, 0x73, 0xE3, 0xFE, 0xA7, 0xEF, 0x7B, 0x2E, 0x38, 0x52, 0x39, 0x1C, 0x5F,
-    0xE2, 0xB3, 0xC1, 0x0F, 0xF2, 0xEA, 0xD0, 0x7E, 0xEF, 0xD5, 0x7C, 0xE1, 0x80, 0xF7, 0xD6, 0x07,
-    0xE8, 0xBA, 0x8C, 0xFF, 0x41, 0x5C, 0xDC, 0x5A, 0x70, 0x2A, 0xAF, 0x8E, 0xD3, 0x65, 0xB7, 0x0D,
-    0xEA, 0x24, 0x5D, 0xF7, 0x1A, 0xBF, 0x4E, 0x24, 0xAA, 0x8C, 0xC4, 0xB5, 0x2D, 0xBC, 0x8E, 0x30,
-    0xBD, 0xFB, 0x95, 0x25, 0xD9, 0xF8, 0x79, 0x8A, 0x49, 0xE8, 0x5F, 0xA1, 0x78, 0x64, 0x1D, 0xE4,
-    0x56, 0xDB, 0x2B, 0x27, 0x2D, 0x74, 0x46, 0x7B, 0x8A, 0x6F, 0xA2, 0x6C, 0xF8, 0xEE, 0x73, 0xA7,
-    0xF7, 0x1C, 0x7B, 0x7D, 0xCF, 0xCA, 0xF0, 0xC0, 0x9F, 0xFD, 0xCF, 0x9E, 0xBF, 0xDB, 0xDC, 0xF3,
-    0x27, 0x9B, 0x3F, 0x0D, 0x5F, 0xAB, 0x2D, 0x65, 0xC6, 0xFC, 0xF7, 0xB9, 0x9F, 0x2B, 0x67, 0xC1,
-    0x20, 0x3E, 0xA6, 0x64, 0xF0, 0x9B, 0x44, 0xC2, 0xA3, 0xB5, 0xAC, 0x2D, 0x4B, 0x70, 0x09, 0x15,
-    0x7E, 0x6D, 0x0E, 0x7E, 0x07, 0x61, 0x50, 0xC5, 0xC5, 0x28, 0x15, 0x6A, 0x05, 0x98, 0x13, 0x88,
-    0xD1, 0x56, 0xBB, 0xCF, 0x8D, 0xE7, 0x30, 0x66, 0xBD, 0xA3, 0x51, 0xE4, 0xAF, 0x67, 0x3A, 0xFD,
-    0xE8, 0xB9, 0xE2, 0x34, 0xC8, 0x7A, 0xF4, 0x18, 0xDF, 0x35, 0x0F, 0x04, 0xB2, 0x47, 0x9E, 0xF3,
-    0xCA, 0x67, 0xBD, 0x7A, 0xD1, 0x35, 0x57, 0x4C, 0x1A, 0x57, 0xF2, 0x34, 0x9A, 0x9E, 0x86, 0xAA,
-    0x9F, 0x94, 0x03, 0xB2, 0xFF, 0xE1, 0x53, 0x45, 0x9B, 0x55, 0xCE, 0xCA, 0x82, 0x5F, 0xB6, 0x91,
-    0xD7, 0x24, 0xA9, 0xAC, 0xCF, 0x4B, 0x6E, 0x4B, 0x96, 0xCB, 0x90, 0x95, 0x32, 0xEE, 0x28, 0xB5,
-    0x37, 0x82, 0x0A, 0x2D, 0xFF, 0x01, 0xBD, 0xFE, 0x77, 0x63, 0xB2, 0x0B, 0x59, 0x97, 0x5D, 0xC0,
-    0xA8, 0x98, 0x5E, 0x39, 0xA3, 0xE6, 0xE5, 0xA4, 0x59, 0xB5, 0x10, 0x0D, 0xDE, 0xA6, 0x29, 0x17,
-    0xB2, 0xDE, 0x7B, 0x1B, 0x55, 0xD1, 0x7B, 0xEF, 0x99, 0xF2, 0x70, 0xD2, 0x7B, 0x15, 0x2A, 0xAF,
-    0xF3, 0xAA, 0x24, 0xD7, 0x2A, 0x4B, 0x0F, 0x07, 0x2D, 0x1A, 0xD3, 0xC3, 0x21, 0x2B, 0x39, 0x1C,
-    0x35, 0xEE, 0x7F, 0x1A, 0x39, 0x98, 0x34, 0xEE, 0xAF, 0x6D, 0xF5, 0x21, 0xAA, 0xF8, 0x74, 0x9F,
-    0x5C, 0x82, 0x36, 0x3C, 0xEC, 0xC9, 0x0F, 0x83, 0x56, 0xAA, 0xBD, 0xAF, 0x5C, 0xAE, 0x77, 0x49,
-    0xEF, 0x9C, 0x77, 0xCB, 0x00, 0xEC, 0x34, 0x5E, 0x19, 0x7A, 0xE6, 0x32, 0x4C, 0x20, 0xF5, 0x46,
-    0x2F, 0xBF, 0x5A, 0xEE, 0x3F, 0xEF, 0xFD, 0xA5, 0xB3, 0xF9, 0x66, 0x53, 0xB4, 0x78, 0x3A, 0x75,
-    0xC4, 0x2D, 0x1F, 0x82, 0xF1, 0x26, 0x98, 0x45, 0x14, 0xA8, 0x81, 0x0F, 0x8D, 0xF0, 0x71, 0x9D,
-    0x9D, 0x86, 0x92, 0x25, 0x15, 0x2A, 0xAF, 0x8B, 0xCB, 0x30, 0x5F, 0x93, 0x43, 0x4E, 0x29, 0xE9,
-    0x1C, 0x29, 0x14, 0x10, 0xD4, 0x76, 0x44, 0xFE, 0x48, 0xCF, 0x1E, 0xCE, 0x0B, 0x7A, 0xBE, 0xC0,
-    0xB3, 0x53, 0xF3, 0x6C, 0x8F, 0x20, 0xE7, 0x39, 0xD4, 0x67, 0x9E, 0x05, 0x72, 0x95, 0x84, 0x92,
-    0x5F, 0x7D, 0x4C, 0xC1, 0x18, 0xE3, 0x36, 0x92, 0x1A, 0xE3, 0x95, 0x6E, 0xC9, 0x89, 0xC3, 0x3D,
-    0xE8, 0x5C, 0x58, 0x12, 0x64, 0x0E, 0x42, 0xB3, 0xD6, 0xE4, 0xEF, 0x2B, 0x4A, 0xF0, 0x7A, 0x25,
-    0x5E, 0xE3, 0xBD, 0x53, 0x8B, 0x5F, 0x05, 0xAF, 0xD6, 0x78, 0x30, 0x34, 0xA3, 0xC4, 0xC2, 0x33,
-    0xD0, 0x08, 0x7D, 0xF4, 0x3C, 0x3B, 0xE8, 0xD1, 0x6B, 0x9C, 0x63, 0x3C, 0x5B, 0x0A, 0x43, 0x5A,
-    0xA2, 0xB8, 0xD6, 0x6A, 0x2D, 0xE6, 0x59, 0x12, 0x69, 0xA2, 0x27, 0x49, 0x31, 0x0F, 0xDC, 0x38,
-    0x28, 0x13, 0x8D, 0xB8, 0x11, 0xA4, 0x04, 0x3B, 0x90, 0xE2, 0x16, 0xBF, 0xF4, 0xAA, 0x1F, 0x93,
-    0xC8, 0xDF, 0x9A, 0x2E, 0x31, 0x65, 0x73, 0x36, 0xB2, 0x1A, 0xD6, 0x28, 0x1A, 0xE2, 0xCD, 0xC3,
-    0xFA, 0x72, 0xAC, 0x02, 0x01, 0x1A, 0xFA, 0x15, 0x69, 0xF7, 0x6B, 0xBE, 0x1C, 0x60, 0xA8, 0x1A,
-    0x60, 0x44, 0xEA, 0x40, 0x86, 0xD3, 0x01, 0xF9, 0x7A, 0xD0, 0x09, 0x30, 0xA0, 0xC1, 0x14, 0xA6,
-    0x7C, 0x74, 0xA6, 0xFE, 0x24, 0xF1, 0xCD, 0x35, 0x2B, 0xD9, 0x4A, 0xCF, 0x0F, 0x6A, 0xEF, 0x30,
-    0x3C, 0xD2, 0x72, 0x40, 0xC9, 0x36, 0x29, 0x9B, 0x9E, 0xE9, 0x14, 0xF9, 0xDD, 0x5A, 0x31, 0x26,
-    0xA4, 0x3C, 0x71, 0x97, 0x62, 0x03, 0x15, 0x60, 0x3F, 0x06, 0x4C, 0xCA, 0x7D, 0x9E, 0xE9, 0x28,
-    0xD1, 0x7D, 0x1F, 0xC9, 0xAA, 0xC2, 0xB6, 0x15, 0xA9, 0x57, 0xBB, 0xBF, 0x91, 0x99, 0x4C, 0xC3,
-    0x34, 0x7C, 0x42, 0x26, 0xA1, 0xCA, 0x92, 0xAC, 0x3E, 0x29, 0x93, 0x54, 0x41, 0x2E, 0xCD, 0xC9,
-    0x8A, 0x95, 0xAF, 0xC5, 0x62, 0xE5, 0x2A, 0xA4, 0x37, 0xC1, 0xD5, 0x30, 0x15, 0xCA, 0x1C, 0xC5,
-    0xE9, 0xB6, 0xB9, 0x90, 0x47, 0x6C, 0x9B, 0x77, 0x87, 0x12, 0xA1, 0x64, 0x9C, 0xF3, 0x54, 0x7F,
-    0xFA, 0x74, 0x3F, 0x20, 0x04, 0xE0, 0xAD, 0x48, 0x0B, 0x13, 0x9B, 0x17, 0x3A, 0x8E, 0xA8, 0x92,
-    0xC7, 0xC2, 0x4E, 0x96, 0x3D, 0xF3, 0x49, 0x4F, 0xCF, 0x25, 0xFB, 0x46, 0xAB, 0x7F, 0x81, 0x8A,
-    0x28, 0x50, 0x38, 0x08, 0x74, 0x7E, 0x83, 0x56, 0x6F, 0x3C, 0x2C, 0x77, 0xFA, 0x84, 0xFA, 0x78,
-    0x91, 0x53, 0x47, 0x8D, 0x22, 0xA9, 0x0A, 0x7C, 0x83, 0x98, 0xEF, 0x7D, 0xCA, 0xF7, 0xA3, 0x37,
-    0xD8, 0x17, 0xBD, 0x88, 0xA8, 0xC5, 0x63, 0x78, 0x42, 0xD4, 0xE0, 0x28, 0x95, 0x1E, 0xA5, 0x9A,
-    0x73, 0xA0, 0x81, 0xB4, 0x82, 0x6C, 0x50, 0x8B, 0xA3, 0x60, 0x03, 0x0E, 0x80, 0x22, 0xE6, 0x15,
-    0x50, 0x6D, 0x1A, 0xBA, 0x3F, 0x53, 0x87, 0x3C, 0x97, 0xB4, 0x0D, 0xF3, 0xBD, 0x11, 0xE2, 0x18,
-    0x43, 0xF4, 0x40, 0xC8, 0x06, 0x2D, 0x24, 0xF4, 0xC2, 0xCC, 0x5C, 0x54, 0x71, 0x26, 0x80, 0x98,
-    0x2C, 0xEA, 0x19, 0xF9, 0x5D, 0x3E, 0xA4, 0x15, 0xFD, 0x2B, 0x97, 0x64, 0x47, 0xC5, 0x2B, 0xEE,
-    0x4D, 0x55, 0x8D, 0xCB, 0xEC, 0x70, 0x59, 0x5D, 0x70, 0x9B, 0xB1, 0xA1, 0x24, 0xDF, 0x1B, 0x74,
-    0xCC, 0x5E, 0x4B, 0xE1, 0x47, 0x25, 0x45, 0xB3, 0x21, 0x31, 0x8C, 0xB4, 0x95, 0x4C, 0x67, 0x02,
-    0x7D, 0x8D, 0x9C, 0x40, 0x34, 0x78, 0x8C, 0x19, 0x28, 0x77, 0x65, 0xC7, 0xE7, 0x39, 0x27, 0x97,
-    0x86, 0xDE, 0xDC, 0x1B, 0x02, 0xF4, 0x13, 0x74, 0x09, 0x27, 0xF0, 0x3A, 0xC5, 0xCA, 0xAB, 0x40,
-    0x27, 0x28, 0x53, 0xFE, 0x94, 0xAA, 0xC3, 0x07, 0x95, 0x55, 0xE8, 0x16, 0x50, 0xF6, 0xC1, 0x6F,
-    0x05, 0x0F, 0x9D, 0x87, 0xD1, 0xC2, 0xD5, 0x87, 0xD4, 0xCB, 0x7F, 0x17, 0xDA, 0x5D, 0x15, 0x20,
-    0xC2, 0x4F, 0x37, 0xBE, 0x0D, 0xCA, 0x15, 0x56, 0x24, 0x28, 0xC9, 0x69, 0x4F, 0xC6, 0x19, 0x79,
-    0x87, 0x51, 0x45, 0xD4, 0xC4, 0xCD, 0xB7, 0xC1, 0x34, 0xAC, 0x0D, 0xBC, 0xC3, 0xB3, 0xEF, 0x51,
-    0x2F, 0x9E, 0xD8, 0xAB, 0x2A, 0xA2, 0xC4, 0x1F, 0xFC, 0x22, 0x4B, 0xB0, 0x71, 0x64, 0x37, 0x7F,
-    0xDA, 0x31, 0x64, 0x2D, 0xB8, 0xC6, 0xAE, 0x92, 0x84, 0x0D, 0x1D, 0xE9, 0x0E, 0xDF, 0xD1, 0x48,
-    0x8F, 0x74, 0xBB, 0x1D, 0x11, 0x24, 0xAC, 0xC8, 0x5A, 0x46, 0x2D, 0x84, 0x52, 0x15, 0x6C, 0x20,
-    0x6B, 0x19, 0xE3, 0x3E, 0x1C, 0x60, 0x0D, 0x32, 0xC2, 0xC1, 0x78, 0xB5, 0xF4, 0x54, 0x73, 0x10,
-    0xA5, 0x02, 0x25, 0x79, 0xD9, 0x13, 0xC6, 0xC2, 0x36, 0x46, 0x3F, 0x88, 0x97, 0x40, 0x6F, 0x76,
-    0x89, 0xDD, 0x9B, 0xC9, 0x4D, 0x3A, 0x2F, 0xD2, 0xC2, 0x55, 0x04, 0xA2, 0x42, 0x60, 0xCD, 0x8E,
-    0x5A, 0xD2, 0x67, 0x9F, 0xF2, 0x6E, 0xAA, 0xE6, 0x8B, 0xFF, 0xA9, 0xAD, 0xC3, 0x4D, 0x5B, 0x47,
-    0xA7, 0x6D, 0x9D, 0x58, 0xCB, 0x90, 0x0D, 0xC7, 0x1C, 0xFF, 0x89, 0x06, 0xDB, 0x24, 0x81, 0xB4,
-    0x6A, 0xED, 0x51, 0xB3, 0x47, 0x05, 0x43, 0xED, 0x0F, 0xCC, 0xE8, 0x3C, 0x62, 0x0E, 0xF4, 0x77,
-    0xF6, 0xF1, 0x39, 0x93, 0x6B, 0xB0, 0xA5, 0x51, 0x9B, 0x33, 0xD5, 0xCA, 0x08, 0xE8, 0xA1, 0xC0,
-    0x58, 0xD3, 0x4B, 0xB2, 0x26, 0x27, 0x0C, 0xCA, 0x75, 0x82, 0xB4, 0xE3, 0x1D, 0x1F, 0xA7, 0x40,
-    0x28, 0x7A, 0x82, 0x2E, 0x82, 0x71, 0x6B, 0x68, 0x8E, 0xFF, 0x8D, 0x24, 0x34, 0x56, 0xDB, 0xB5,
-    0x4C, 0x71, 0xB4, 0xDF, 0xCD, 0x70, 0x59, 0x9D, 0x6F, 0x48, 0x05, 0x8A, 0xB6, 0x4E, 0xAA, 0x55,
-    0x7C, 0x8B, 0xEE, 0x00, 0x9D, 0xA4, 0xE2, 0x84, 0xE6, 0xF3, 0xE3, 0x1B, 0xD4, 0x95, 0x91, 0x84,
-    0x8D, 0x8E, 0x0E, 0xCD, 0x48, 0x8A, 0xD2, 0xD3, 0xD1, 0x90, 0x36, 0xC8, 0x0A, 0x49, 0xE0, 0x7C,
-    0x3A, 0x4A, 0x97, 0x4B, 0xBE, 0x18, 0x34, 0x38, 0xBF, 0x02, 0xA7, 0xEE, 0xA0, 0x4E, 0x4A, 0xE8,
-    0x9F, 0x9D, 0x61, 0x36, 0xD8, 0x7D, 0xDB, 0xA9, 0xDF, 0xF5, 0x22, 0x7B, 0xE3, 0x30, 0xA7, 0x09,
-    0x03, 0xE3, 0xE4, 0x6A, 0x68, 0x03, 0xD4, 0x07, 0x55, 0x21, 0x6D, 0xF8, 0xE0, 0x2F, 0x56, 0x3C,
-    0x4E, 0x12, 0x99, 0xC4, 0xB4, 0xA5, 0xE4, 0x60, 0xC7, 0x13, 0xF0, 0x4C, 0xE2, 0xDB, 0x49, 0xD4,
-    0x84, 0x64, 0xA4, 0x4A, 0x5C, 0x42, 0xB9, 0x6E, 0x33, 0x1A, 0x02, 0x1D, 0xA1, 0x90, 0x18, 0xEF,
-    0xD6, 0x13, 0xC0, 0xAF, 0x7D, 0x39, 0x9C, 0x1F, 0xFF, 0x1E, 0x6D, 0x04, 0x8C, 0x23, 0xD6, 0x30,
-    0x5D, 0xF8, 0xFE, 0xAD, 0x84, 0xCD, 0x28, 0x1D, 0x8F, 0xFF, 0xAB, 0x25, 0x0C, 0xE9, 0x81, 0x52,
-    0x3A, 0xDE, 0xF2, 0x84, 0x4A, 0x20, 0x23, 0xA5, 0xE8, 0xF0, 0x79, 0x94, 0xAB, 0x9C, 0x5D, 0x50,
-    0x6A, 0xD8, 0x50, 0x01, 0xD3, 0xA6, 0xBC, 0x8D, 0x33, 0xD7, 0x81, 0xB2, 0x16, 0x01, 0xC4, 0x19,
-    0x40, 0xF4, 0xB6, 0xB9, 0x3E, 0x4E, 0x49, 0xBD, 0x46, 0x82, 0x58, 0x92, 0x95, 0x3B, 0x49, 0x8A,
-    0x0D, 0x37, 0x5E, 0x3A, 0xBB, 0x25, 0x29, 0x12, 0xD4, 0xDD, 0xF2, 0x84, 0x3F, 0x27, 0x08, 0x8F,
-    0x71, 0xFC, 0xD7, 0x27, 0x49, 0x29, 0x41, 0xA9, 0xD3, 0x61, 0xE2, 0x0A, 0xB0, 0x80, 0xCC, 0xA6,
-    0x0C, 0x9B, 0xB0, 0xF1, 0x07, 0xBF, 0xBF, 0x55, 0xF1, 0xFE, 0x50, 0xC4, 0xA8, 0x45, 0xE1, 0x39,
-    0x78, 0x9C, 0x22, 0xDD, 0x41, 0xC2, 0xB9, 0x14, 0x41, 0x46, 0xC1, 0x53, 0x96, 0xFA, 0x77, 0x39,
-    0xE5, 0x50, 0x7D, 0x7B, 0x2A, 0x81, 0xBA, 0x05, 0x4F, 0x48, 0xCD, 0x79, 0x72, 0xF3, 0x53, 0xE1,
-    0x91, 0x26, 0xF1, 0xAB, 0x1D, 0x7D, 0x06, 0x6D, 0xF1, 0xFD, 0xB6, 0x78, 0xBE, 0xCD, 0x76, 0x1C,
-    0x5D, 0xF6, 0x3A, 0x8E, 0xBE, 0x78, 0xBB, 0x2F, 0x2E, 0xF7, 0xE6, 0xB2, 0xCA, 0x62, 0x41, 0x5D,
-    0x9A, 0xC9, 0x83, 0xD3, 0xF5, 0xB3, 0xB2, 0xFA, 0x43, 0x64, 0xE5, 0x3B, 0x69, 0x23, 0xB5, 0xF6,
-    0xC8, 0xBE, 0xF8, 0xC8, 0xB7, 0x1D, 0x25, 0x48, 0x9C, 0x0E, 0x33, 0x1D, 0x61, 0x19, 0xBE, 0xD5,
-    0x3B, 0x7D, 0x5C, 0xC5, 0xEF, 0x0E, 0xDE, 0x90, 0xD4, 0x49, 0x7D, 0xBB, 0x96, 0x3E, 0xB3, 0x42,
-    0x6B, 0x13, 0x24, 0x4E, 0xAC, 0x60, 0x0B, 0xCE, 0x97, 0x55, 0xB5, 0x9A, 0xEC, 0xAC, 0x42, 0x40,
-    0x0C, 0xAC, 0x88, 0x6D, 0x95, 0x34, 0xEA, 0x79, 0x88, 0xD9, 0x99, 0xF9, 0x48, 0xAC, 0x4D, 0xC1,
-    0x86, 0xE9, 0xAA, 0x6B, 0xAB, 0xBF, 0x35, 0xE1, 0x78, 0x37, 0x2A, 0x02, 0x73, 0x51, 0x69, 0xDC,
-    0x08, 0xDA, 0x89, 0xDB, 0xF0, 0x5C, 0x99, 0xAE, 0x2E, 0xF0, 0x16, 0x42, 0x52, 0xDE, 0x0A, 0x3A,
-    0x66, 0xCE, 0x5C, 0x04, 0xA0, 0xA6, 0x27, 0x17, 0x75, 0x5A, 0x8D, 0xDE, 0x02, 0x3C, 0xF1, 0x2D,
-    0x50, 0xA0, 0x6F, 0x95, 0x7C, 0x2B, 0xC2, 0xAD, 0xCF, 0x8E, 0xBF, 0x82, 0xBC, 0x3F, 0xB2, 0xE0,
-    0x98, 0x29, 0xFA, 0x58, 0x77, 0xA5, 0x64, 0x8C, 0x96, 0x8C, 0x9C, 0x14, 0x8E, 0x0A, 0x42, 0xC7,
-    0xD4, 0x6B, 0xA6, 0x20, 0x6C, 0xE1, 0x3C, 0x22, 0x84, 0x27, 0x18, 0x48, 0xFB, 0x47, 0x0C, 0x63,
-    0x85, 0xED, 0x31, 0xCE, 0x8F, 0x99, 0x88, 0x80, 0x00, 0x02, 0x21, 0xE8, 0x46, 0xEE, 0x8E, 0xF1,
-    0x46, 0x22, 0x5E, 0x72, 0x1A, 0x21, 0x49, 0x54, 0x43, 0x51, 0xFD, 0x36, 0x41, 0x22, 0x3F, 0x84,
-    0x9F, 0x40, 0xB9, 0x9E, 0xEF, 0x90, 0x77, 0xBF, 0x33, 0xC6, 0x55, 0xD0, 0x32, 0xEF, 0x02, 0x1A,
-    0x17, 0x62, 0x82, 0x2E, 0xAC, 0x93, 0x8B, 0xA3, 0x0B, 0x8C, 0x36, 0x25, 0x9A, 0x13, 0x58, 0x88,
-    0x09, 0x7B, 0x67, 0xCC, 0x36, 0x8D, 0x24, 0x57, 0x1A, 0x46, 0x35, 0x68, 0x14, 0x80, 0x10, 0xB8,
-    0x83, 0x3A, 0x43, 0x9E, 0x57, 0xC9, 0x46, 0x27, 0xBB, 0xF3, 0x3B, 0x47, 0xCB, 0xBB, 0xCF, 0xDE,
-    0x32, 0xA3, 0x27, 0x46, 0x0B, 0x15, 0x35, 0xA6, 0xE4, 0x26, 0x64, 0x97, 0x40, 0x83, 0x5B, 0x97,
-    0x74, 0x36, 0xF4, 0xCA, 0x49, 0xCD, 0x08, 0x21, 0xDB, 0x54, 0xC0, 0x78, 0xA1, 0xA1, 0x01, 0x11,
-    0x5B, 0xBC, 0x1B, 0x0A, 0xE0, 0x1F, 0xB2, 0xCF, 0xF8, 0x0A, 0x81, 0xB9, 0xA0, 0x58, 0xDD, 0xA9,
-    0x99, 0xB6, 0x99, 0xFC, 0xAC, 0x21, 0x34, 0x73, 0x76, 0xE3, 0xA6, 0x18, 0xD2, 0x97, 0x4D, 0x49,
-    0xB9, 0x72, 0xDD, 0xC3, 0x2E, 0x45, 0x19, 0x5D, 0x8E, 0xE1, 0x72, 0x91, 0xB5, 0xBE, 0x13, 0x66,
-    0x65, 0x8B, 0x2C, 0x4D, 0xDA, 0xDC, 0x6A, 0x96, 0xB9, 0x09, 0x72, 0x99, 0xD9, 0x0A, 0x94, 0x3C,
-    0xFE, 0xD5, 0x02, 0x64, 0xF5, 0x58, 0x9C, 0xD2, 0x1C, 0xB1, 0xC8, 0x35, 0xE8, 0x83, 0xA9, 0x11,
-    0x19, 0x30, 0xE3, 0x42, 0x14, 0x82, 0x8E, 0xCC, 0x6B, 0x23, 0x55, 0x8E, 0x8E, 0xCA, 0x53, 0xAF,
-    0xE7, 0x7F, 0x36, 0xCC, 0x99, 0x4A, 0xFE, 0x65, 0x8B, 0xA9, 0x41, 0x57, 0xB9, 0xA6, 0x66, 0x52,
-    0x30, 0xF2, 0xE9, 0xA0, 0x25, 0x80, 0x16, 0x17, 0xCD, 0x67, 0xCE, 0x09, 0xA3, 0xEC, 0x74, 0x81,
-    0x6A, 0x51, 0xA8, 0x7A, 0x13, 0xAA, 0x0E, 0x05, 0xEA, 0x13, 0x9C, 0x62, 0xDC, 0x02, 0x14, 0x27,
-    0x9D, 0x07, 0xFF, 0xD6, 0x99, 0x45, 0x1B, 0xBA, 0xA4, 0xC6, 0x10, 0xE7, 0x09, 0x79, 0xF2, 0x5B,
-    0xC1, 0xC3, 0x1A, 0x7D, 0x6F, 0xB0, 0x16, 0x70, 0xA2, 0x74, 0x55, 0xAC, 0xCE, 0xE8, 0x27, 0xF3,
-    0xEC, 0xDB, 0xA0, 0x5C, 0x7E, 0x43, 0x83, 0x88, 0x6D, 0x24, 0xAA, 0xB9, 0xC0, 0x14, 0xCB, 0x45,
-    0xCD, 0x37, 0x9F, 0xFA, 0x28, 0x5D, 0x73, 0xBB, 0x75, 0x89, 0x07, 0x05, 0x60, 0xE2, 0x76, 0x2F,
-    0x40, 0x0D, 0xE3, 0x0E, 0x33, 0xAA, 0xE7, 0xD6, 0x31, 0x73, 0xA4, 0x5E, 0x3B, 0x67, 0x7C, 0x47,
-    0xE8, 0x3F, 0xAD, 0xD1, 0xCA, 0x3C, 0x6D, 0xE3, 0x67, 0x16, 0xF6, 0xB9, 0xB7, 0xBD, 0x1D, 0xCE,
-    0xDC, 0x41, 0x54, 0xCE, 0xB2, 0x37, 0x7D, 0x7B, 0xB7, 0xB9, 0x51, 0xD8, 0x3E, 0xA6, 0x15, 0x5D,
-    0xD7, 0x7C, 0xAE, 0xD1, 0xAE, 0x04, 0xA3, 0x44, 0x56, 0xC3, 0x3B, 0x8D, 0xF5, 0x28, 0x32, 0x78,
-    0xE7, 0xD2, 0x2E, 0x1E, 0x65, 0x5C, 0x97, 0x25, 0x8A, 0x1B, 0x46, 0x9E, 0x98, 0x07, 0x4F, 0x43,
-    0x51, 0x50, 0xE0, 0x77, 0x7A, 0x81, 0x28, 0xB3, 0x09, 0xEC, 0x45, 0x5C, 0xF9, 0xF6, 0x02, 0x1E,
-    0xD6, 0x5E, 0x58, 0x50, 0x97, 0x01, 0x21, 0xB2, 0x3E, 0x63, 0x30, 0x85, 0xFA, 0x96, 0x79, 0xA1,
-    0xB5, 0xF1, 0x1F, 0x17, 0x81, 0x75, 0x88, 0xCC, 0x54, 0x2F, 0xDB, 0x41, 0xA7, 0x08, 0xD8, 0xA2,
-    0x3D, 0xE9, 0x51, 0x65, 0x97, 0xE9, 0x42, 0x69, 0xB6, 0x2A, 0xCF, 0x87, 0xFF, 0x77, 0x5A, 0x7B,
-    0xCD, 0x66, 0xEC, 0xCE, 0x42, 0x7B, 0x77, 0x26, 0xA3, 0x79, 0xA8, 0x12, 0xCE, 0x16, 0x41, 0xE6,
-    0x99, 0x56, 0x32, 0x93, 0xB0, 0x99, 0xDE, 0xD6, 0x10, 0x79, 0x2B, 0x37, 0x16, 0xBB, 0xE2, 0x6B,
-    0xE5, 0x39, 0x9B, 0xDB, 0x43, 0x77, 0x01, 0x32, 0x8B, 0xE2, 0x1B, 0x5B, 0x20, 0x6E, 0xC3, 0x93,
-    0xDB, 0x57, 0x3C, 0xA8, 0xC0, 0x05, 0xD3, 0x90, 0x98, 0x19, 0x6D, 0xC0, 0xD4, 0xCA, 0x35, 0xB7,
-    0x36, 0x42, 0xF4, 0x16, 0x30, 0x54, 0x73, 0xA3, 0xC6, 0x30, 0x6A, 0x67, 0xE3, 0xA8, 0x8D, 0xA7,
-    0xD9, 0x58, 0xCF, 0x1B, 0x07, 0x36, 0x16, 0x47, 0x07, 0xB2, 0x84, 0x58, 0x01, 0xC9, 0xE4, 0xF8,
-    0x66, 0xD1, 0xFB, 0x36, 0x8D, 0xA6, 0x9E, 0xC6, 0xB3, 0xE4, 0xA8, 0xA2, 0x58, 0x67, 0xFA, 0x34,
-    0x41, 0x77, 0x33, 0x47, 0xEE, 0xC3, 0x73, 0xD0, 0x7B, 0x30, 0xFD, 0x6A, 0xF0, 0xFD, 0xF8, 0x19,
-    0x91, 0x9F, 0xBC, 0x3E, 0x7C, 0xCD, 0xCC, 0x1C, 0xFF, 0x2A, 0xCC, 0x1C, 0x98, 0xAB, 0x7D, 0xC4,
-    0x99, 0x8E, 0x5E, 0xC0, 0x9D, 0x27, 0xC9, 0xD7, 0x5E, 0x71, 0xD3, 0x6F, 0xEE, 0x24, 0xC4, 0x5C,
-    0xB0, 0xD3, 0x55, 0x01, 0xBF, 0x43, 0x60, 0xEA, 0x8E, 0xD4, 0x5C, 0x40, 0x4D, 0x79, 0x47, 0x79,
-    0x33, 0x2F, 0xFB, 0x86, 0x28, 0x8F, 0xB3, 0x72, 0x37, 0xE5, 0x09, 0xF3, 0xDF, 0x61, 0x85, 0x8C,
-    0xD0, 0xE5, 0x93, 0x44, 0xAF, 0x63, 0x34, 0xAA, 0x28, 0x6F, 0x18, 0xFD, 0x16, 0x29, 0x08, 0x4B,
-    0x4A, 0xB8, 0x5F, 0x04, 0xB2, 0x49, 0x05, 0x26, 0xFD, 0x9E, 0x88, 0x6E, 0x9E, 0x27, 0xFD, 0x9F,
-    0x0E, 0x9A, 0x24, 0x6B, 0xBE, 0xCE, 0xCC, 0x81, 0xF2, 0x72, 0x75, 0x49, 0x41, 0x57, 0x17, 0xD4,
-    0xD8, 0xAD, 0x15, 0x2B, 0xC5, 0xF4, 0x7C, 0x12, 0x77, 0x16, 0xEF, 0xF8, 0xA6, 0xE6, 0xDC, 0x6C,
-    0x44, 0x18, 0x26, 0x4B, 0xC2, 0x75, 0x61, 0xAD, 0x3E, 0x40, 0x0B, 0xC0, 0x0D, 0x7E, 0x75, 0x39,
-    0x18, 0x7C, 0x04, 0x7A, 0x4B, 0x12, 0x5D, 0xAA, 0x64, 0x71, 0x49, 0xDC, 0x0F, 0xB5, 0x0A, 0xDF,
-    0xAB, 0xFC, 0x6E, 0xD9, 0x37, 0x10, 0x50, 0x9E, 0x99, 0xDC, 0x87, 0xFB, 0xD9, 0xF6, 0xBA, 0xAD,
-    0x44, 0xBE, 0x73, 0x0C, 0x53, 0x80, 0xE0, 0xB1, 0x8E, 0xD2, 0x30, 0xF7, 0xCA, 0x18, 0x81, 0x27,
-    0x44, 0x53, 0x2F, 0x42, 0xF0, 0x8B, 0xB2, 0x2E, 0x8B, 0x90, 0xDB, 0x22, 0x72, 0x3C, 0x96, 0xC4,
-    0x01, 0x9B, 0xF0, 0x03, 0x09, 0x98, 0x4E, 0x00, 0x4E, 0x19, 0x30, 0x16, 0x48, 0xBF, 0x8E, 0xB2,
-    0x88, 0xB2, 0x94, 0x1D, 0x7C, 0x69, 0x28, 0x62, 0xD3, 0xA3, 0x34, 0x45, 0x30, 0xF9, 0x77, 0x0E,
-    0xE2, 0xD7, 0x53, 0x0E, 0xE9, 0x6F, 0x5F, 0xDE, 0x8D, 0xAF, 0x22, 0x78, 0x36, 0x6B, 0x92, 0xFD,
-    0x1B, 0xA2, 0x4F, 0x38, 0xD0, 0x18, 0x09, 0x13, 0x26, 0x64, 0x1D, 0xA9, 0x6E, 0x7C, 0x04, 0x32,
-    0xAC, 0x4F, 0x89, 0xDB, 0x81, 0x16, 0x03, 0x5A, 0x8B, 0xD2, 0xFC, 0x93, 0x69, 0x12, 0xEE, 0x7D,
-    0x19, 0xDD, 0xC3, 0x79, 0xAF, 0x72, 0xCD, 0xAB, 0x90, 0xF1, 0x1F, 0x4F, 0x11, 0x1D, 0x57, 0xAD,
-    0x19, 0xCE, 0xE9, 0x5E, 0x62, 0xFF, 0x45, 0xD3, 0x18, 0x74, 0xA7, 0xA0, 0x1D, 0xD7, 0x24, 0xFA,
-    0x98, 0x39, 0x4A, 0xC0, 0xC5, 0xFD, 0xDE, 0xAB, 0x25, 0x4E, 0x1B, 0x20, 0xE3, 0x29, 0x71, 0xBA,
-    0x48, 0xEC, 0xEE, 0xDA, 0x5B, 0x2D, 0x78, 0x4C, 0x3E, 0x28, 0xB8, 0x85, 0x66, 0x18, 0xC4, 0x97,
-    0x91, 0xF9, 0x0C, 0xB1, 0x75, 0xBD, 0x64, 0x3B, 0xBA, 0x30, 0x39, 0x3A, 0x4E, 0xE3, 0x12, 0xE8,
-    0x3C, 0x89, 0xB1, 0x9F, 0x9A, 0xAD, 0x4C, 0xDE, 0x8B, 0x51, 0x1E, 0xA1, 0x90, 0xAA, 0x43, 0x12,
-    0x1E, 0xD8, 0x2B, 0xFE, 0xD1, 0x4B, 0xA9, 0x53, 0xC1, 0x88, 0x7E, 0xEA, 0xE6, 0xF7, 0x4C, 0x7C,
-    0x2E, 0xBE, 0x70, 0x90, 0xC8, 0x97, 0xF3, 0x2C, 0x8F, 0x9A, 0xA8, 0x09, 0xFA, 0xA0, 0xBF, 0xB7,
-    0x13, 0xC4, 0x35, 0x0B, 0xEF, 0x75, 0xAE, 0xB6, 0x60, 0x72, 0xFE, 0x16, 0x2E, 0x69, 0xEF, 0x5E,
-    0xD1, 0x6C, 0x6D, 0xC7, 0x1A, 0x9C, 0x3B, 0x46, 0xD0, 0xE4, 0x9B, 0xA5, 0xFF, 0x79, 0xD1, 0x78,
-    0x8D, 0xDB, 0xBB, 0x54, 0xB4, 0x0E, 0x92, 0x5A, 0x10, 0xB7, 0x85, 0xA4, 0x96, 0x31, 0xBD, 0xF1,
-    0x6B, 0xDC, 0xFB, 0x58, 0xE2, 0x96, 0xE6, 0x0D, 0x1B, 0x5D, 0x96, 0x19, 0x37, 0x79, 0xCD, 0xB0,
-    0x04, 0x7B, 0x89, 0x54, 0xDB, 0xFC, 0x1B, 0xDA, 0x57, 0xA4, 0xE9, 0xD6, 0xCD, 0x6B, 0xD0, 0x64,
-    0xF4, 0x68, 0x52, 0xA7, 0x46, 0xA7, 0x30, 0xA4, 0xC3, 0xEC, 0xB7, 0xDC, 0x75, 0x22, 0xEF, 0xD4,
-    0x43, 0x37, 0x0B, 0x1A, 0x10, 0xFD, 0x1F, 0x06, 0xC8, 0x8E, 0xA9, 0x0A, 0xC5, 0xA5, 0x4C, 0x5B,
-    0x2C, 0x54, 0xDC, 0x80, 0x64, 0x72, 0xB0, 0x1B, 0xF2, 0xC0, 0xB4, 0xCC, 0x95, 0x66, 0x5A, 0x55,
-    0x18, 0x35, 0x63, 0x6A, 0x88, 0x81, 0xFF, 0x74, 0x0A, 0xA6, 0x7C, 0x42, 0x0F, 0x12, 0xF4, 0x5F,
-    0xE4, 0x76, 0x01, 0x99, 0xBA, 0x41, 0xC5, 0x9F, 0xF6, 0x35, 0x97, 0xED, 0x82, 0x01, 0x3C, 0xB9,
-    0x6B, 0xDE, 0xCC, 0xB9, 0x11, 0x99, 0x20, 0x20, 0xCB, 0x60, 0x25, 0x2B, 0x36, 0x18, 0x62, 0x0C,
-    0xBC, 0x47, 0x2B, 0x62, 0x87, 0xCD, 0xAB, 0xDC, 0x76, 0xF2, 0xD4, 0x71, 0x39, 0xDF, 0x99, 0xB8,
-    0xED, 0xB3, 0x4F, 0x57, 0xDE, 0x52, 0x6E, 0xF4, 0x85, 0xA5, 0x34, 0xE0, 0xE6, 0xD4, 0xA2, 0xBC,
-    0xB4, 0x86, 0xB9, 0x20, 0x8D, 0x1F, 0xAD, 0xA7, 0xD6, 0x08, 0x97, 0xA7, 0x10, 0x2B, 0x69, 0xE5,
-    0xB1, 0xD0, 0xCE, 0x53, 0xAF, 0xBB, 0xF3, 0xFB, 0xC6, 0xDC, 0x26, 0x48, 0x27, 0xED, 0xF2, 0x12,
-    0x4D, 0x08, 0xAA, 0x2A, 0xBB, 0x57, 0xBE, 0x1A, 0x2E, 0xDE, 0x93, 0xF1, 0xA7, 0x6D, 0x0C, 0x0A,
-    0x82, 0xE0, 0xB7, 0xBA, 0x08, 0x97, 0xEF, 0xE7, 0xBB, 0x45, 0xF2, 0xAF, 0x63, 0x3C, 0x0F, 0x5A,
-    0xE6, 0xE3, 0x1B, 0xB4, 0x41, 0x1B, 0x76, 0xA1, 0x96, 0xAF, 0x8B, 0xB7, 0xC7, 0xA9, 0x02, 0xAE,
-    0xAE, 0xFF, 0x7E, 0x67, 0xCE, 0x4C, 0x4C, 0x35, 0x8B, 0x69, 0x1D, 0x07, 0xA7, 0x2B, 0x6A, 0xBC,
-    0xB7, 0xE3, 0x94, 0xFA, 0xAD, 0x53, 0x2F, 0xF8, 0x65, 0x17, 0xB9, 0x67, 0xB6, 0x99, 0x4A, 0x13,
-    0xBB, 0xCD, 0x41, 0xB7, 0xC6, 0x39, 0xF6, 0x9A, 0x64, 0x3A, 0x5A, 0xA0, 0xEB, 0xFD, 0xDC, 0xD3,
-    0xE0, 0xC2, 0x75, 0x70, 0x25, 0x0F, 0xF2, 0xD5, 0x40, 0x37, 0xF7, 0xB6, 0x6D, 0xB2, 0x62, 0x08,
-    0xAE, 0x1C, 0xC2, 0xEE, 0x82, 0x7C, 0xF6, 0x23, 0xD6, 0x77, 0x30, 0x1A, 0x31, 0x33, 0x99, 0xFF,
-    0x18, 0x14, 0xAE, 0xBF, 0x74, 0x05, 0x67, 0xCD, 0x2E, 0xB3, 0xAF, 0x69, 0x8F, 0xF4, 0xAD, 0xB3,
-    0x5F, 0xA5, 0xF6, 0x17, 0xDE, 0x56, 0xD9, 0x85, 0x1C, 0x3C, 0xB0, 0xB2, 0x15, 0xCC, 0x6E, 0x58,
-    0xAE, 0xEC, 0xCA, 0x72, 0xC9, 0x88, 0xB9, 0x9F, 0x2E, 0xED, 0x82, 0x27, 0x09, 0x0E, 0x0D, 0xB0,
-    0x3D, 0x30, 0xFD, 0x61, 0x44, 0x06, 0xEE, 0xA7, 0x40, 0xCD, 0x34, 0x58, 0xA3, 0x71, 0x21, 0x2A,
-    0x58, 0x52, 0xD9, 0xC2, 0xE1, 0xA7, 0x10, 0x33, 0x54, 0x37, 0xA0, 0xF8, 0x30, 0x19, 0x01, 0x0D,
-    0xCD, 0xFE, 0x69, 0x83, 0x6E, 0x37, 0xB1, 0x2E, 0x54, 0x3B, 0xDC, 0x25, 0x67, 0x10, 0x86, 0x9F,
-    0x97, 0xEB, 0xF5, 0x79, 0xCD, 0x34, 0xEB, 0x68, 0x67, 0x08, 0xE3, 0x1C, 0x93, 0x28, 0x1E, 0x19,
-    0x42, 0x94, 0x71, 0x1B, 0xD4, 0x71, 0xE5, 0x35, 0x71, 0xE9, 0xB6, 0x49, 0xEA, 0xB0, 0x74, 0x53,
-    0xE9, 0x93, 0xD4, 0xED, 0x93, 0xDC, 0x96, 0x6C, 0x5B, 0x29, 0x4A, 0x77, 0x60, 0x56, 0xBE, 0xC3,
-    0x78, 0x77, 0x5F, 0xB8, 0xB3, 0xF1, 0xC4, 0x37, 0x48, 0x66, 0x1E, 0x8C, 0x45, 0x13, 0x71, 0x0C,
-    0x88, 0x6A, 0x11, 0x3A, 0x05, 0xA5, 0x5A, 0x06, 0x70, 0x2C, 0xA2, 0x2C, 0x43, 0xB9, 0x96, 0xD1,
-    0x3E, 0x24, 0x1F, 0xBC, 0x4C, 0x27, 0xD1, 0x02, 0xBA, 0x90, 0xB5, 0x03, 0xCE, 0x34, 0x4A, 0x78,
-    0xFA, 0x76, 0xC3, 0xBD, 0x65, 0x69, 0xF0, 0xAE, 0x9F, 0xDF, 0x77, 0x6C, 0x32, 0xE9, 0x4F, 0x46,
-    0xBB, 0x88, 0xDF, 0xED, 0x41, 0xE4, 0xEC, 0x7E, 0xBE, 0x4B, 0x24, 0xBD, 0xE7, 0x63, 0xAD, 0x3B,
-    0xA5, 0x73, 0xF3, 0x48, 0xE9, 0x6D, 0x5E, 0x2C, 0xBD, 0x12, 0xE9, 0x6C, 0x99, 0x7C, 0x2D, 0x3C,
-    0x29, 0x28, 0xE8, 0x37, 0x44, 0x52, 0x6E, 0xBF, 0x5F, 0x8B, 0xEC, 0x54, 0xE1, 0x93, 0x59, 0x48,
-    0xC4, 0xCC, 0x3F, 0xBC, 0x3D, 0x6A, 0x71, 0x74, 0x15, 0x7F, 0x48, 0x66, 0x49, 0xE4, 0x0C, 0x3B,
-    0xA6, 0x34, 0x1A, 0xA1, 0xA7, 0xDD, 0xA7, 0xB2, 0x86, 0xE4, 0x4C, 0xDB, 0x04, 0x1A, 0x02, 0xAD,
-    0x4E, 0x71, 0x6E, 0x34, 0x6D, 0x07, 0x7B, 0xDB, 0xF7, 0x0E, 0x16, 0xA7, 0xFF, 0x5B, 0xF9, 0xD6,
-    0xDD, 0x49, 0xA1, 0x2B, 0x03, 0xB9, 0x6B, 0x0A, 0x98, 0x7B, 0x78, 0x2D, 0xEF, 0xFD, 0x77, 0x9B,
-    0x45, 0xB7, 0x59, 0x8A, 0xD2, 0x3E, 0x7A, 0xA3, 0x5A, 0xF4, 0xAE, 0xB6, 0xB1, 0xD3, 0x2D, 0x87,
-    0xE5, 0x72, 0xB8, 0x59, 0x27, 0x47, 0x91, 0xA0, 0xD3, 0xF3, 0xF2, 0x6F, 0x54, 0x35, 0xFF, 0x91,
-    0x04, 0x0B, 0xCB, 0x15, 0x35, 0x74, 0xF3, 0x7E, 0xDD, 0x6E, 0xEC, 0xAB, 0xB9, 0x07, 0xB3, 0xDD,
-    0x8E, 0x7E, 0x86, 0x91, 0xA9, 0xBD, 0x41, 0xBF, 0xA8, 0x29, 0xDD, 0xDC, 0xF0, 0x76, 0x91, 0xB1,
-    0xAD, 0xDD, 0x7A, 0xD9, 0xB7, 0x03, 0x6B, 0x00, 0xA0, 0x88, 0x89, 0x82, 0xF7, 0x2A, 0x89, 0x7F,
-    0x80, 0x00, 0x64, 0x19, 0xB6, 0xD5, 0x49, 0xF8, 0x2E, 0x4C, 0xFD, 0x67, 0xA5, 0x8C, 0x80, 0xCB,
-    0x0E, 0xE9, 0xFA, 0xAF, 0x3B, 0x31, 0x6F, 0xD8, 0x1D, 0x14, 0x6E, 0x7A, 0x34, 0x85, 0xB9, 0x52,
-    0x66, 0xDD, 0xB4, 0x14, 0x71, 0xC6, 0xCA, 0xE6, 0xA0, 0x4D, 0x04, 0x82, 0xD2, 0x0A, 0xE1, 0x6E,
-    0x1F, 0x77, 0x36, 0x58, 0xAA, 0x83, 0x7D, 0x06, 0x84, 0x79, 0x17, 0x68, 0xF3, 0xC2, 0xB6, 0xC1,
-    0x38, 0x76, 0xED, 0x8D, 0x48, 0x39, 0xBA, 0xCC, 0xEE, 0x25, 0x5C, 0x34, 0x26, 0x73, 0xCC, 0xD5,
-    0x7E, 0xFB, 0xA2, 0x23, 0x73, 0x84, 0xA4, 0x87, 0xF4, 0xD7, 0x30, 0x1B, 0xA7, 0x60, 0x17, 0x0F,
-    0xDF, 0xAB, 0x11, 0x00, 0xCE, 0x65, 0x96, 0x66, 0xEE, 0xE0, 0x0E, 0x41, 0x17, 0x76, 0xF1, 0x4E,
-    0x74, 0xFE, 0xFD, 0x05, 0xF6, 0xEC, 0xB4, 0x6A, 0xBA, 0x6A, 0xF5, 0x86, 0x6A, 0xB2, 0xDD, 0x0D,
-    0x7D, 0xC1, 0x67, 0xD9, 0x6E, 0x93, 0x2E, 0x47, 0x18, 0x18, 0xC9, 0x62, 0xEF, 0x37, 0x08, 0x7D,
-    0x5B, 0xB7, 0x43, 0xC6, 0x84, 0x68, 0x13, 0x8A, 0x92, 0x3D, 0x0F, 0x3A, 0x2E, 0xD7, 0x12, 0x5D,
-    0xA3, 0xEE, 0x54, 0x8C, 0x9C, 0x90, 0xE7, 0x30, 0x15, 0xCC, 0xED, 0xB2, 0x88, 0xB1, 0x0B, 0x1C,
-    0xFE, 0xA0, 0xFF, 0x49, 0xE4, 0x1F, 0xE2, 0x62, 0xDC, 0x06, 0x24, 0x4B, 0xBC, 0x32, 0x33, 0x81,
-    0x2D, 0x87, 0xC6, 0x1F, 0x63, 0xCA, 0x3F, 0x1B, 0xAE, 0xC5, 0x75, 0xCC, 0xA8, 0x3A, 0x78, 0xA7,
-    0x91, 0xD5, 0x53, 0x12, 0x46, 0xE2, 0x5D, 0x2A, 0x9D, 0xEB, 0xFA, 0x63, 0x29, 0x92, 0xC4, 0x2F,
-    0x93, 0x23, 0x6D, 0x81, 0x64, 0x28, 0x8D, 0x46, 0xEA, 0x20, 0xB7, 0xF9, 0x96, 0xB8, 0x08, 0xA6,
-    0xA9, 0x43, 0x3B, 0x65, 0x86, 0x9C, 0x1C, 0xB7, 0x85, 0xCB, 0x47, 0x41, 0xA6, 0xDB, 0x07, 0xFD,
-    0xCE, 0xB0, 0xF8, 0x0F, 0xCB, 0xED, 0xFF, 0x03, 0xD5, 0x5C, 0x3D, 0x90, 0xDD, 0xD6, 0x75, 0xBE,
-    0x00, 0x4C, 0xC2, 0x5E, 0x38, 0x84, 0x0A, 0xCB, 0x63, 0x8B, 0xB6, 0x91, 0x22, 0x85, 0xA3, 0x48,
-    0x44, 0x8A, 0x14, 0x2A, 0xC8, 0x05, 0x24, 0x15, 0x2C, 0x3C, 0x13, 0xED, 0x4C, 0xB4, 0x9C, 0xC4,
-    0x9E, 0x0C, 0x53, 0xB8, 0x90, 0xAD, 0x62, 0x5D, 0xA8, 0x70, 0xB1, 0x24, 0x20, 0xB1, 0x60, 0xA1,
-    0xC2, 0x5B, 0x44, 0x45, 0x2A, 0x29, 0x33, 0x72, 0xC6, 0x62, 0x0A, 0xB2, 0x70, 0xC1, 0x62, 0x97,
-    0x00, 0xC9, 0x82, 0x85, 0x0A, 0x41, 0x51, 0xE1, 0x99, 0x34, 0x02, 0x2D, 0xDA, 0x1E, 0x29, 0x05,
-    0x61, 0x0B, 0x1A, 0x61, 0x49, 0x3C, 0xDC, 0x7C, 0xDF, 0x39, 0x78, 0x3F, 0xBB, 0xDC, 0x25, 0x69,
-    0x53, 0xB2, 0xA9, 0x37, 0x0F, 0x78, 0x77, 0xEF, 0xC3, 0xC3, 0xBD, 0xE7, 0xDC, 0x73, 0xCF, 0xF9,
-    0xCE, 0x0F, 0xD6, 0x18, 0x73, 0x20, 0x35, 0x26, 0xB1, 0x36, 0x37, 0xAE, 0xB5, 0x83, 0xD9, 0xF7,
-    0xE5, 0xB5, 0x3C, 0xC7, 0x35, 0xCF, 0xB6, 0xC4, 0xC9, 0xB7, 0x29, 0x3B, 0x0A, 0x76, 0xF4, 0x3D,
-    0x3B, 0x7E, 0xDD, 0xE1, 0x9C, 0x1C, 0x6F, 0xD8, 0x11, 0x56, 0xC6, 0x04, 0x75, 0x9C, 0xA3, 0x23,
-    0xCD, 0x8C, 0x71, 0x7A, 0x33, 0x61, 0x87, 0xDB, 0xB3, 0xC3, 0x6F, 0xD8, 0x11, 0xD6, 0x7C, 0xC7,
-    0x25, 0x3A, 0xF0, 0xC6, 0xE8, 0xD6, 0x9A, 0x10, 0xA7, 0xDE, 0x64, 0x38, 0x77, 0x1E, 0x3B, 0x9A,
-    0x10, 0x77, 0x4B, 0xAA, 0x02, 0xF7, 0x29, 0xCE, 0xE0, 0x0E, 0x8E, 0x8D, 0xD0, 0xE1, 0xA1, 0x65,
-    0x1E, 0x31, 0xE7, 0x31, 0xDF, 0xC2, 0xDA, 0xF2, 0xD1, 0x74, 0x71, 0xA2, 0xC5, 0xD9, 0xD2, 0xB1,
-    0x43, 0xE3, 0x0C, 0xE7, 0x7B, 0xD3, 0x9B, 0xC2, 0x6C, 0x9A, 0xB0, 0x5C, 0x36, 0x6E, 0x1B, 0x1A,
-    0xB3, 0xE5, 0x97, 0x26, 0x7A, 0xB9, 0xC1, 0x3C, 0x36, 0x8D, 0xD7, 0x47, 0x18, 0xD3, 0x1B, 0x7E,
-    0x60, 0x4B, 0x8E, 0x13, 0x61, 0x5C, 0xC7, 0xDA, 0x93, 0x69, 0x30, 0xF8, 0x95, 0x59, 0x32, 0x0E,
-    0x46, 0x3C, 0x6A, 0xF0, 0x1B, 0x73, 0xD1, 0xAC, 0x93, 0x64, 0xD2, 0xEC, 0xD8, 0x89, 0x8C, 0x90,
-    0x9B, 0x7B, 0xBC, 0x1E, 0x2E, 0x66, 0x79, 0xA5, 0xB9, 0x60, 0x1A, 0x90, 0x13, 0x9B, 0x23, 0x06,
-    0x57, 0x1A, 0xFC, 0x06, 0xDF, 0xBE, 0xB5, 0x6B, 0xD2, 0xEE, 0x10, 0x61, 0x9E, 0xB7, 0x4B, 0xFF,
-    0x56, 0xD1, 0x78, 0x8D, 0xDB, 0xBB, 0x8D, 0x49, 0x4C, 0x67, 0x82, 0xEA, 0x28, 0xB8, 0x17, 0x19,
-    0x73, 0x1A, 0xDC, 0x8B, 0x5F, 0x69, 0x4C, 0xD8, 0x9C, 0x32, 0x41, 0x1F, 0x6E, 0xAF, 0x59, 0x8E,
-    0x5A, 0x62, 0xFC, 0xC6, 0xB7, 0x93, 0x53, 0x26, 0xEE, 0x22, 0x10, 0x49, 0x5A, 0x46, 0x16, 0x79,
-    0x96, 0xCD, 0x48, 0x78, 0x76, 0x89, 0x44, 0x7B, 0x1F, 0x93, 0xDC, 0xE8, 0x55, 0xF2, 0x65, 0x12,
-    0x81, 0x2F, 0x5E, 0x03, 0x72, 0x4C, 0x9C, 0x5F, 0x62, 0x07, 0xA8, 0x34, 0x7E, 0x43, 0xD6, 0xC5,
-    0x79, 0x80, 0x0B, 0x27, 0x06, 0x97, 0x80, 0xFA, 0x24, 0xE7, 0xBB, 0x60, 0x07, 0xDE, 0x81, 0x10,
-    0x9D, 0x90, 0x5C, 0x87, 0x44, 0xD7, 0xE4, 0x82, 0x2D, 0x13, 0xDC, 0xCD, 0x3E, 0x33, 0x90, 0x8A,
-    0x10, 0x77, 0xF0, 0xFB, 0x0C, 0x1D, 0xA1, 0x2C, 0xC3, 0x4F, 0x79, 0xF2, 0x65, 0xCD, 0x9E, 0x12,
-    0x42, 0x65, 0x59, 0x74, 0x72, 0x1C, 0xF3, 0x33, 0x64, 0x00, 0xA9, 0x39, 0x8A, 0x3B, 0x7D, 0x0B,
-    0x47, 0x90, 0x72, 0x05, 0x52, 0x2E, 0x24, 0xFE, 0x22, 0xE1, 0x2E, 0x1B, 0x1E, 0xF9, 0x13, 0x50,
-    0x26, 0x42, 0x4E, 0xE9, 0xB1, 0xD4, 0xDC, 0xD7, 0xCB, 0x29, 0xB6, 0x8D, 0x59, 0x83, 0xC0, 0x63,
-    0xE9, 0x27, 0x58, 0xF9, 0xD5, 0x17, 0x4C, 0xD2, 0x8E, 0xD2, 0xE5, 0x90, 0x14, 0x4F, 0xA4, 0x8A,
-    0x42, 0x45, 0xDE, 0x99, 0x50, 0x4E, 0x1C, 0x30, 0x9A, 0x9F, 0x84, 0xFB, 0xFC, 0x55, 0xC4, 0x8B,
-    0x43, 0xEC, 0xF9, 0x03, 0xA1, 0xBD, 0x75, 0xE2, 0x12, 0x79, 0x3A, 0x90, 0x96, 0x81, 0x2C, 0x95,
-    0x4D, 0x35, 0x98, 0xD8, 0xEA, 0x68, 0x6F, 0x8E, 0x33, 0x78, 0x03, 0x3F, 0xD3, 0xE9, 0x63, 0x3F,
-    0x84, 0xA5, 0x71, 0xDA, 0x3D, 0xA6, 0xE9, 0xDB, 0xD2, 0xC3, 0xF2, 0xD8, 0xFF, 0xCA, 0x21, 0xAA,
-    0x5C, 0x4A, 0x88, 0xB3, 0x8F, 0xB1, 0xB7, 0x30, 0x2D, 0xFC, 0xF2, 0x34, 0xFE, 0x6A, 0x29, 0xA3,
-    0xB8, 0xF1, 0x6B, 0x39, 0x56, 0x0E, 0x0B, 0xD9, 0x99, 0x78, 0x50, 0x26, 0x1C, 0x10, 0x71, 0x61,
-    0x9B, 0xAB, 0x69, 0x6E, 0x53, 0x78, 0x2B, 0x0C, 0x76, 0x48, 0xF6, 0xE1, 0xC3, 0xCB, 0x1A, 0xCC,
-    0xCE, 0xC5, 0xDD, 0xB3, 0xCA, 0x44, 0x27, 0x53, 0x3F, 0x7F, 0xD2, 0xA9, 0xCC, 0x4B, 0xD3, 0xC9,
-    0x65, 0x94, 0xD5, 0x32, 0xBC, 0xF5, 0x82, 0x6E, 0x66, 0xCA, 0x33, 0xB9, 0x40, 0x66, 0x6C, 0x29,
-    0x6B, 0xB2, 0x54, 0xF4, 0x59, 0xBC, 0xFD, 0xCF, 0x50, 0x32, 0x0D, 0x86, 0xCA, 0x5D, 0x7B, 0x43,
-    0x7F, 0xCC, 0x2D, 0xC2, 0x3D, 0x3F, 0x32, 0x24, 0xA9, 0xA6, 0xA7, 0x87, 0x5C, 0x56, 0x20, 0xD9,
-    0x24, 0x97, 0x22, 0x30, 0xD9, 0x63, 0xC6, 0x0F, 0x22, 0x24, 0x5F, 0x36, 0x4E, 0x8A, 0xAD, 0x15,
-    0x71, 0x37, 0x6D, 0x52, 0xD1, 0x34, 0x53, 0x16, 0x85, 0x5F, 0x90, 0x9D, 0x74, 0xC8, 0xF8, 0xE9,
-    0x51, 0xB7, 0x32, 0x9F, 0xB4, 0xC2, 0x9D, 0x28, 0x97, 0xAD, 0xB5, 0xF3, 0xF5, 0x40, 0x52, 0x23,
-    0xAA, 0xAC, 0x72, 0x6A, 0xB2, 0xE8, 0x08, 0xDB, 0x9F, 0xD6, 0xA2, 0xDC, 0x44, 0xEB, 0x35, 0xF2,
-    0xED, 0xFE, 0xDC, 0x89, 0xEC, 0xAD, 0x94, 0xF6, 0xC1, 0xD6, 0x86, 0x14, 0x74, 0x58, 0x2C, 0x9E,
-    0xA3, 0xD2, 0x29, 0x3A, 0xAE, 0x53, 0xDC, 0x52, 0x65, 0xC6, 0x0D, 0x67, 0x14, 0xD7, 0x14, 0xD0,
-    0xA4, 0xCC, 0xC8, 0xBD, 0xA7, 0x7B, 0x8E, 0xC1, 0x6E, 0xBF, 0x67, 0x77, 0xD8, 0xB0, 0x3B, 0xB9,
-    0x4C, 0xFE, 0xD8, 0x79, 0x77, 0xC2, 0x6E, 0xDF, 0x5E, 0x9E, 0xAC, 0x9E, 0xB0, 0x83, 0x6F, 0x47,
-    0xD3, 0x8B, 0xE9, 0x8B, 0x19, 0x13, 0x8D, 0x9E, 0xB3, 0xBB, 0xC6, 0x4C, 0x46, 0x86, 0xC5, 0x32,
-    0x65, 0x99, 0x78, 0xCC, 0x0F, 0xB7, 0x21, 0x55, 0xB1, 0x57, 0x93, 0x9C, 0x65, 0x0E, 0x32, 0x6D,
-    0x46, 0x6D, 0xC2, 0xC5, 0xF8, 0xA0, 0xA1, 0x95, 0x83, 0x4D, 0xB9, 0xF4, 0x34, 0xEE, 0x13, 0xE6,
-    0xDE, 0x40, 0xBA, 0x61, 0x8D, 0x97, 0x8D, 0x33, 0x18, 0x98, 0x77, 0xAC, 0xE1, 0x29, 0xDA, 0x12,
-    0x36, 0x2B, 0x50, 0xE5, 0x4E, 0xB8, 0xDE, 0x45, 0x45, 0xB3, 0x32, 0x08, 0xDD, 0x35, 0xED, 0x0C,
-    0x38, 0x16, 0xDB, 0x8F, 0x71, 0xEF, 0xB8, 0x5B, 0x9E, 0xAD, 0x8C, 0xFD, 0x90, 0x32, 0xC4, 0x69,
-    0x1A, 0xA3, 0x13, 0xE5, 0x4C, 0xF9, 0x91, 0x99, 0x83, 0xE4, 0x1A, 0x08, 0xC6, 0x9D, 0x48, 0x31,
-    0x4C, 0x10, 0x49, 0x86, 0x2D, 0x14, 0x0E, 0xC9, 0x57, 0x58, 0x34, 0x7E, 0x15, 0x74, 0x10, 0x8A,
-    0x16, 0x72, 0x04, 0x01, 0xC1, 0xB0, 0x57, 0x70, 0x87, 0x14, 0x57, 0xF0, 0x2B, 0x88, 0x1F, 0x7F,
-    0x05, 0x11, 0x93, 0x5F, 0x95, 0xFC, 0x55, 0x84, 0xAF, 0x3E, 0x59, 0x7D, 0x91, 0x0B, 0x21, 0xD6,
-    0x4E, 0x8C, 0xBE, 0xCE, 0x14, 0x43, 0xFA, 0xF2, 0x87, 0x7C, 0x95, 0x73, 0x86, 0xC3, 0xC6, 0x9C,
-    0x6F, 0x62, 0x69, 0x94, 0x79, 0x9B, 0x02, 0x63, 0xF0, 0x63, 0x50, 0xD9, 0x10, 0x3C, 0x70, 0x69,
-    0x78, 0x73, 0x72, 0x2D, 0xB1, 0x3F, 0xE3, 0x17, 0xB7, 0x81, 0x31, 0x36, 0xB2, 0x4E, 0x99, 0x06,
-    0x25, 0x5F, 0xE4, 0xE0, 0x6D, 0x54, 0x43, 0xD7, 0x83, 0x41, 0xC2, 0x33, 0xE8, 0xE7, 0x8C, 0x98,
-    0x24, 0xAE, 0xC0, 0xCB, 0xB8, 0x55, 0x96, 0xF9, 0x32, 0x74, 0xA1, 0x7C, 0xEB, 0xBB, 0x1D, 0x1C,
-    0x53, 0xA4, 0x66, 0x39, 0xE5, 0xF2, 0xC0, 0xCA, 0x1D, 0x02, 0x77, 0xE0, 0x79, 0x6E, 0x0F, 0xEE,
-    0x9B, 0x33, 0xBC, 0x09, 0x77, 0x79, 0x32, 0xC2, 0x08, 0x41, 0x51, 0x44, 0x0F, 0xD2, 0xF1, 0x9B,
-    0xEF, 0x6F, 0x78, 0xE4, 0x19, 0x77, 0x2D, 0x06, 0x4D, 0xB9, 0x25, 0x77, 0x5C, 0x81, 0xA5, 0x14,
-    0xC5, 0x41, 0xAE, 0xB4, 0x18, 0x6D, 0x20, 0x43, 0xAE, 0xE1, 0xF8, 0xBD, 0xE5, 0x6F, 0xCC, 0x81,
-    0x15, 0x9F, 0x18, 0x89, 0xF7, 0xD8, 0xEF, 0x75, 0xB8, 0x23, 0x8B, 0x52, 0xAF, 0xF3, 0x2A, 0x10,
-    0xDF, 0x40, 0xCB, 0xAC, 0x2F, 0x9B, 0x13, 0x9B, 0x18, 0x6E, 0x82, 0x1B, 0x7E, 0xB8, 0x85, 0x51,
-    0xC0, 0x04, 0x6E, 0x45, 0x42, 0x12, 0xEA, 0x8D, 0x6F, 0x90, 0x8F, 0xBE, 0x82, 0xC7, 0xDE, 0x1C,
-    0x1E, 0x72, 0x80, 0xAD, 0x97, 0xCC, 0x2F, 0xCD, 0x13, 0x60, 0x54, 0x4C, 0x31, 0x04, 0x5C, 0xC3,
-    0x71, 0x07, 0xD8, 0xD2, 0xD7, 0xA3, 0x2B, 0xE0, 0x19, 0x45, 0x61, 0x08, 0xA9, 0x37, 0xB6, 0x17,
-    0xE9, 0xDD, 0xC1, 0x80, 0xD7, 0x7E, 0x9C, 0xE2, 0x8A, 0x6A, 0xCE, 0x80, 0x7C, 0xD7, 0x15, 0xD9,
-    0x94, 0x01, 0xA0, 0xF5, 0x5D, 0x6E, 0x25, 0x4A, 0xC8, 0x94, 0x01, 0xED, 0xC1, 0xD4, 0xBC, 0x01,
-    0x04, 0x54, 0x7B, 0x95, 0x57, 0xB9, 0x14, 0x81, 0x02, 0x8A, 0xEE, 0x70, 0x7B, 0x77, 0x45, 0xF9,
-    0x19, 0x30, 0x43, 0xEC, 0xA2, 0x19, 0x46, 0x03, 0x16, 0x89, 0x16, 0xD8, 0x73, 0xAC, 0xD5, 0x67,
-    0x28, 0xC9, 0x64, 0x06, 0x6E, 0xDF, 0x85, 0x37, 0x76, 0x2F, 0xFE, 0x94, 0xD4, 0x61, 0xF5, 0x2D,
-    0x5D, 0xFC, 0x29, 0x33, 0x86, 0x5D, 0x57, 0x38, 0x33, 0x66, 0xE0, 0x86, 0xC7, 0x71, 0x5C, 0x27,
-    0x5E, 0x9C, 0x32, 0x43, 0xF7, 0x25, 0xD5, 0x3A, 0xB5, 0x3A, 0xE1, 0x61, 0xD8, 0x7E, 0xBE, 0x0C,
-    0x30, 0xCE, 0x2A, 0x65, 0xFB, 0x15, 0x92, 0xC7, 0x23, 0xD9, 0xD8, 0x4B, 0xB6, 0xD9, 0xB1, 0x7D,
-    0xE2, 0xCD, 0xB9, 0x6C, 0x93, 0xBC, 0x6E, 0xD7, 0x15, 0xFE, 0x8C, 0x3C, 0x5C, 0x46, 0x6A, 0xCE,
-    0x8E, 0xB2, 0x2D, 0xE4, 0xA5, 0x02, 0x6B, 0xEB, 0x11, 0xE4, 0x86, 0x64, 0x73, 0x76, 0x7F, 0x74,
-    0x9C, 0xDA, 0x45, 0x47, 0xBC, 0x40, 0x87, 0x11, 0x3A, 0xEC, 0x86, 0xDC, 0xD9, 0xCB, 0x05, 0xEB,
-    0x98, 0x6F, 0x8F, 0x47, 0x88, 0xFB, 0x3A, 0x17, 0x61, 0x6B, 0xE0, 0x5E, 0x1C, 0x01, 0xC2, 0x75,
-    0xFF, 0x40, 0xA3, 0x40, 0x0D, 0x4D, 0xE2, 0xBE, 0xFB, 0x17, 0x95, 0x78, 0x31, 0x76, 0x25, 0xA6,
-    0xD6, 0x02, 0x17, 0x2C, 0x6F, 0xE9, 0x42, 0xD3, 0x4E, 0x38, 0xE9, 0xE7, 0xBC, 0xE0, 0x23, 0x04,
-    0x92, 0x61, 0xC4, 0xDF, 0x0B, 0xC4, 0xD3, 0xB8, 0x18, 0x8B, 0x4F, 0x10, 0x8A, 0x3E, 0x3C, 0xB0,
-    0x73, 0xDC, 0x83, 0x85, 0x25, 0xD8, 0x51, 0xC5, 0xFE, 0x51, 0x91, 0xAA, 0xB7, 0x98, 0x88, 0xCF,
-    0x20, 0x3F, 0x26, 0xA7, 0x47, 0x10, 0x28, 0x10, 0x65, 0xDC, 0x46, 0x82, 0x45, 0x4C, 0xC6, 0x41,
-    0xA1, 0x8C, 0xCD, 0x6B, 0x54, 0xD2, 0xAE, 0x1D, 0x4E, 0x36, 0x60, 0xCA, 0xC0, 0xAB, 0xD7, 0x7A,
-    0xDE, 0x29, 0xF9, 0x27, 0xFE, 0xA6, 0x0F, 0x06, 0xFA, 0x57, 0x91, 0xFD, 0xF9, 0x89, 0xA2, 0x4C,
-    0xC4, 0x81, 0xCC, 0x66, 0x0E, 0x64, 0xC3, 0x33, 0xBE, 0x3F, 0x68, 0x47, 0x2C, 0x0E, 0xE6, 0x29,
-    0xEA, 0x49, 0x30, 0x34, 0x94, 0xB9, 0x57, 0xFA, 0x39, 0x66, 0x3D, 0xF7, 0x7C, 0xB3, 0x8D, 0x17,
-    0x3C, 0xDB, 0xF5, 0xA4, 0x3F, 0xCA, 0xB3, 0x1E, 0xC6, 0xB7, 0x3F, 0x06, 0xAF, 0x68, 0x1D, 0x73,
-    0x58, 0x37, 0xDE, 0x78, 0xF8, 0xDD, 0x31, 0xCC, 0x3D, 0xF9, 0xC8, 0x76, 0x58, 0x98, 0x96, 0xAA,
-    0xD7, 0xB3, 0xB7, 0x5A, 0x93, 0xBD, 0x47, 0x4D, 0xD0, 0x50, 0x23, 0x1C, 0x32, 0x45, 0x8D, 0xEF,
-    0x4A, 0x48, 0x44, 0x1A, 0x13, 0x26, 0x15, 0x18, 0x93, 0xEA, 0x8A, 0x40, 0x89, 0x73, 0x38, 0x66,
-    0x8E, 0x88, 0xC8, 0x93, 0x19, 0x85, 0xD0, 0xBE, 0x76, 0x4F, 0x04, 0xFC, 0x22, 0xD5, 0x7D, 0x4C,
-    0xDA, 0xC0, 0x87, 0xFF, 0xC6, 0x78, 0xED, 0xCC, 0xE1, 0x8B, 0xC5, 0x14, 0xDA, 0x7C, 0x8A, 0xF3,
-    0x14, 0xCA, 0xD1, 0x54, 0x2B, 0x0F, 0x47, 0xE4, 0x47, 0xD6, 0x7E, 0x65, 0x85, 0xAC, 0x8D, 0xED,
-    0x6F, 0xC4, 0x61, 0xFE, 0xA0, 0x27, 0x77, 0xDE, 0xA1, 0x14, 0x7D, 0xC2, 0x95, 0x09, 0x4B, 0xCE,
-    0x34, 0x73, 0xEC, 0xAD, 0xD5, 0x17, 0x7B, 0x75, 0xBF, 0x05, 0xCE, 0x94, 0x72, 0x9E, 0x42, 0x83,
-    0x35, 0x80, 0x32, 0x38, 0x82, 0xB5, 0x9F, 0x3A, 0x50, 0xBD, 0x7E, 0xE9, 0x8A, 0x9D, 0xC4, 0x38,
-    0x4B, 0x1B, 0x77, 0x4E, 0xFB, 0xF3, 0x64, 0xA9, 0x7C, 0x37, 0x7A, 0x14, 0xA6, 0xE0, 0x1A, 0x4B,
-    0x10, 0xE5, 0xAE, 0xFA, 0xEF, 0x61, 0x13, 0x4B, 0x3A, 0xD2, 0x33, 0xDD, 0xDD, 0x8C, 0x00, 0xFC,
-    0xCF, 0xC9, 0xC3, 0x87, 0x76, 0xB3, 0xEE, 0xF5, 0x92, 0xB8, 0x93, 0xB7, 0x38, 0x23, 0xD9, 0x37,
-    0x0B, 0x33, 0x1A, 0xE3, 0x53, 0xA9, 0x59, 0x34, 0xCB, 0x3E, 0x07, 0x66, 0xF8, 0xA9, 0x27, 0x4A,
-    0xC5, 0xD1, 0x8E, 0xCC, 0x66, 0x6C, 0xA9, 0xFE, 0x33, 0x31, 0xFA, 0x2B, 0x32, 0x6B, 0x12, 0xC0,
-    0x69, 0x98, 0xE0, 0xED, 0x92, 0xBA, 0x73, 0x1D, 0x27, 0xE3, 0x96, 0x0B, 0x34, 0x32, 0x7A, 0xF2,
-    0x23, 0xD1, 0x52, 0x67, 0x3A, 0x4E, 0x73, 0xE0, 0xAE, 0x96, 0x50, 0x90, 0x84, 0xC2, 0xAE, 0xF6,
-    0xEC, 0xB4, 0xF7, 0xE8, 0xDC, 0x5E, 0x5D, 0x2D, 0xAE, 0x92, 0xC5, 0x2D, 0x4F, 0x13, 0xE1, 0xF6,
-    0x49, 0x9E, 0x7E, 0xC5, 0xD3, 0x27, 0xE0, 0x8F, 0x3F, 0x81, 0x6F, 0xEF, 0xD8, 0x93, 0x74, 0x55,
-    0x7F, 0x47, 0x9F, 0x6D, 0x1B, 0x9D, 0xC1, 0x90, 0xD5, 0x58, 0xC0, 0xDC, 0x3C, 0x69, 0x14, 0x47,
-    0xAB, 0xD1, 0x6D, 0x37, 0x69, 0x24, 0xD7, 0xE9, 0xD4, 0x7D, 0x77, 0xF4, 0xB7, 0x84, 0x10, 0xC1,
-    0xC3, 0x5C, 0x07, 0x1A, 0x21, 0x8D, 0xFD, 0x1C, 0xA3, 0x28, 0x50, 0x86, 0x7D, 0xAE, 0x4C, 0xF4,
-    0x3D, 0xCC, 0xFE, 0x12, 0xD8, 0x40, 0xD9, 0xC2, 0xDD, 0x61, 0xEA, 0x81, 0xB1, 0x3B, 0x2C, 0x98,
-    0xD7, 0x00, 0x0B, 0x04, 0x25, 0xAC, 0x5F, 0x4C, 0x43, 0xB9, 0x09, 0xF3, 0xE7, 0x32, 0x4E, 0x16,
-    0xB2, 0x2B, 0xA1, 0x21, 0x9C, 0xE0, 0x62, 0xAF, 0x85, 0x40, 0x45, 0x15, 0x16, 0x35, 0x4B, 0x09,
-    0xBB, 0x82, 0x9A, 0x08, 0x22, 0xD4, 0x73, 0x33, 0x9E, 0xFB, 0xBD, 0xCF, 0xC9, 0x9C, 0xF2, 0xFE,
-    0xEF, 0x86, 0x73, 0xE7, 0xCE, 0x77, 0x3B, 0xAE, 0x11, 0xED, 0x26, 0xE7, 0x56, 0xCF, 0xFE, 0xE2,
-    0x79, 0x58, 0x5D, 0x5D, 0x6B, 0x29, 0x32, 0x91, 0x9E, 0xBB, 0xF9, 0x39, 0xEE, 0x28, 0x4E, 0x71,
-    0x87, 0x59, 0x8E, 0x3C, 0x52, 0xEA, 0x05, 0x81, 0xD2, 0x27, 0xEE, 0xA6, 0x11, 0x31, 0x09, 0xFB,
-    0x9C, 0x12, 0x86, 0x40, 0x02, 0x82, 0x9B, 0xB0, 0xE0, 0x31, 0x25, 0x1D, 0xD2, 0x51, 0xC1, 0x3D,
-    0x8B, 0xF2, 0x90, 0xC1, 0x38, 0x58, 0xDD, 0x19, 0xF5, 0x73, 0x86, 0x30, 0x5C, 0xEA, 0x35, 0x80,
-    0x47, 0x61, 0x05, 0x40, 0x90, 0xA4, 0x59, 0xEE, 0x4C, 0xE0, 0xEE, 0xFA, 0xED, 0x01, 0xF3, 0x6F,
-    0xD6, 0x79, 0xFB, 0x1F, 0xFD, 0xA3, 0xDF, 0x3E, 0xDA, 0xC4, 0xD7, 0xCD, 0x63, 0xBB, 0x41, 0x27,
-    0x1D, 0x3F, 0xC8, 0x77, 0x0C, 0x1F, 0x30, 0x05, 0x07, 0x71, 0x87, 0x68, 0x8F, 0x66, 0xC7, 0xAD,
-    0x8B, 0x7B, 0x0E, 0xDC, 0x25, 0xB0, 0x1F, 0x05, 0xB4, 0x38, 0xD7, 0x1A, 0x5B, 0x1E, 0x3E, 0x7A,
-    0xFE, 0xD4, 0xED, 0xF2, 0x83, 0x33, 0x57, 0xFF, 0xD5, 0xEF, 0x5F, 0x72, 0x17, 0x75, 0x3A, 0x7C,
-    0x2E, 0xF8, 0x5E, 0x31, 0xE3, 0xC7, 0x6E, 0x3D, 0x36, 0x37, 0x29, 0x0F, 0x90, 0x86, 0x84, 0xBC,
-    0x18, 0x9B, 0xA9, 0x40, 0x3A, 0xE7, 0xE9, 0xC2, 0xF6, 0xE0, 0xFF, 0xBB, 0xCF, 0xEF, 0xB5, 0x95,
-    0x5D, 0xB2, 0xB2, 0x9A, 0x7E, 0xF0, 0x07, 0xD1, 0x3D, 0x3E, 0x06, 0xD1, 0x37, 0xD3, 0x0F, 0x2B,
-    0x76, 0xCF, 0xD5, 0x0F, 0xAA, 0x84, 0x44, 0x3F, 0xCC, 0xA3, 0x9E, 0xE2, 0xA6, 0x72, 0x57, 0x88,
-    0xA4, 0x11, 0xEF, 0x91, 0x6E, 0xE3, 0x11, 0x0D, 0x5B, 0x8E, 0x7F, 0xC5, 0x2A, 0xD1, 0xC9, 0x1D,
-    0x1F, 0xAD, 0xE0, 0xB1, 0xA5, 0x37, 0xB2, 0x72, 0xF0, 0xBA, 0xB0, 0x4E, 0xF2, 0xD9, 0x47, 0x0F,
-    0xE9, 0x2A, 0xED, 0xF4, 0x63, 0x12, 0xB6, 0xD9, 0xBB, 0xF6, 0xF8, 0x10, 0x77, 0x4F, 0x38, 0xD5,
-    0x21, 0x40, 0xD5, 0xA2, 0x5C, 0x33, 0x41, 0x85, 0x0B, 0xFD, 0x5E, 0x4D, 0xB3, 0xC4, 0x01, 0x37,
-    0xDD, 0x26, 0x28, 0x8F, 0x98, 0x8B, 0xFC, 0x88, 0x4D, 0xEF, 0x35, 0x61, 0x99, 0xC8, 0x47, 0x95,
-    0x3D, 0x8D, 0x9F, 0x5D, 0x00, 0x1A, 0xE9, 0xDD, 0x36, 0x2A, 0x0B, 0xDC, 0xB7, 0x5D, 0x8C, 0x2F,
-    0x2D, 0xBD, 0x19, 0x57, 0xC5, 0x33, 0x13, 0xBF, 0x8D, 0x70, 0xE5, 0x8E, 0x8F, 0x97, 0x07, 0xBF,
-    0x8B, 0xEA, 0xEC, 0x8A, 0x0D, 0x30, 0x90, 0xBD, 0x6A, 0xB1, 0x80, 0xC1, 0x95, 0x66, 0xF3, 0x48,
-    0xF0, 0x4A, 0xB3, 0x19, 0x87, 0x57, 0x9B, 0x3E, 0xC1, 0x69, 0x92, 0xA5, 0xE7, 0x52, 0xF3, 0xF8,
-    0xAB, 0x2D, 0x94, 0x03, 0x8C, 0x64, 0xF2, 0x36, 0x1B, 0x20, 0x2C, 0xB9, 0x76, 0x1F, 0x8D, 0xB3,
-    0x74, 0x92, 0xA1, 0xDF, 0xB3, 0xB3, 0xDD, 0x42, 0xA3, 0x05, 0xB4, 0xC8, 0xBE, 0x07, 0x24, 0xD2,
-    0x16, 0xDA, 0x08, 0x5A, 0x4A, 0x3F, 0x87, 0x6F, 0xD0, 0xB0, 0x0A, 0x41, 0x9C, 0x40, 0x40, 0x06,
-    0xFC, 0x13, 0x7A, 0xE5, 0x05, 0xD5, 0x0B, 0xE1, 0x03, 0xB6, 0x42, 0x2C, 0xB6, 0x5A, 0x15, 0x38,
-    0x31, 0xE7, 0x71, 0x06, 0x11, 0xBA, 0xA2, 0xD4, 0x3F, 0x47, 0xC5, 0x5D, 0x2C, 0x2E, 0xE0, 0xCA,
-    0xD4, 0xF9, 0x8F, 0x9E, 0x91, 0x68, 0x49, 0x2C, 0x81, 0x93, 0x7A, 0x16, 0x38, 0x71, 0x17, 0x7A,
-    0xA5, 0x99, 0x48, 0x38, 0x65, 0xD6, 0x4C, 0xD8, 0xF4, 0x6A, 0x36, 0x97, 0xC7, 0x26, 0xE6, 0xB0,
-    0x4C, 0xF7, 0x43, 0xB6, 0xAA, 0xE8, 0x2D, 0xD5, 0x59, 0x02, 0xC4, 0x25, 0xFC, 0xE6, 0x48, 0x34,
-    0x21, 0xB1, 0x62, 0x41, 0x16, 0xAC, 0x12, 0x20, 0x9C, 0xDB, 0x53, 0x4D, 0xBA, 0xF5, 0x45, 0xB7,
-    0xF2, 0x5F, 0xCE, 0x1F, 0xFB, 0x25, 0xB7, 0x1C, 0x45, 0x99, 0xAE, 0x71, 0x45, 0xDB, 0x42, 0x2D,
-    0x63, 0xC5, 0x62, 0xEE, 0xF5, 0xC7, 0x20, 0x94, 0x42, 0xC9, 0x63, 0x23, 0x52, 0xA0, 0xC1, 0x6A,
-    0x48, 0x38, 0x66, 0x43, 0x59, 0x2F, 0x78, 0xE5, 0x23, 0x19, 0x0C, 0x65, 0xE7, 0xDB, 0x89, 0x03,
-    0x9D, 0x92, 0x0D, 0x50, 0xCF, 0xE3, 0xE0, 0x1B, 0xAA, 0x7B, 0xC1, 0x1D, 0x5A, 0x90, 0x8B, 0x7E,
-    0xB9, 0x68, 0x3E, 0xA8, 0x79, 0x49, 0x04, 0x50, 0x3E, 0xD5, 0x35, 0x59, 0xC1, 0x60, 0x49, 0xAC,
-    0x91, 0x92, 0xDD, 0x7F, 0xD6, 0xAA, 0xB3, 0x97, 0x55, 0x89, 0x53, 0x8B, 0x51, 0x63, 0x4D, 0x64,
-    0xF1, 0x22, 0xAE, 0x23, 0x56, 0xF8, 0x96, 0xD2, 0xED, 0x37, 0x0E, 0x23, 0x39, 0xC0, 0x57, 0x41,
-    0x83, 0x39, 0x07, 0x4C, 0xCB, 0x04, 0x0D, 0xF4, 0x72, 0xD8, 0x40, 0x16, 0xC2, 0x1A, 0x74, 0x87,
-    0xD7, 0x41, 0x48, 0x48, 0x48, 0x19, 0xFE, 0x1F, 0x15, 0x33, 0xD1, 0x6D, 0x64, 0x39, 0x19, 0x22,
-    0xD3, 0x88, 0x26, 0x39, 0xE6, 0xA6, 0x8C, 0xF9, 0x45, 0x4C, 0xD6, 0x26, 0xEF, 0x90, 0x29, 0x57,
-    0x19, 0xBD, 0xB9, 0x8C, 0xCE, 0xA4, 0x2C, 0xA0, 0x80, 0x80, 0x0C, 0x80, 0x5C, 0xA1, 0x4D, 0x33,
-    0xA0, 0x4E, 0xDC, 0xDC, 0xB5, 0x8B, 0xDE, 0xB5, 0x40, 0x12, 0x3D, 0xD5, 0xB3, 0xE8, 0x71, 0x39,
-    0xC5, 0x20, 0x62, 0xF6, 0xED, 0x34, 0xEA, 0x97, 0x8F, 0x07, 0x07, 0x5E, 0x3C, 0x46, 0x49, 0x4A,
-    0xB0, 0x86, 0x09, 0x53, 0x31, 0xC0, 0x8F, 0x09, 0x33, 0x50, 0x5C, 0x94, 0x5E, 0x9D, 0x03, 0x69,
-    0x33, 0xC6, 0x85, 0x51, 0x32, 0x20, 0x8D, 0x0C, 0x2A, 0x3F, 0xC3, 0x82, 0x67, 0x06, 0x0E, 0xBD,
-    0x5C, 0xB5, 0x0F, 0x38, 0x01, 0xA9, 0xD4, 0x4C, 0x72, 0x0C, 0x8A, 0x47, 0xB9, 0xDE, 0xB4, 0xF8,
-    0x07, 0xCC, 0x8A, 0x5F, 0x76, 0x4E, 0xB3, 0x69, 0xD6, 0x81, 0xFF, 0x13, 0x13, 0xBC, 0x9E, 0xBA,
-    0x37, 0x73, 0xFE, 0x8A, 0x12, 0x03, 0xDD, 0x89, 0xD6, 0xA7, 0xBD, 0x39, 0x96, 0x94, 0xD1, 0xF1,
-    0xCE, 0x2F, 0x8B, 0x97, 0x1B, 0x0C, 0xFC, 0x06, 0xC3, 0x9E, 0xEA, 0xB8, 0x70, 0xE5, 0xC2, 0x71,
-    0xFE, 0x77, 0x44, 0x38, 0xCB, 0x9D, 0x47, 0xBC, 0xCF, 0x91, 0xEC, 0x3E, 0xF2, 0xBD, 0x8F, 0xEC,
-    0xA3, 0xF3, 0x96, 0xA8, 0x6C, 0xF1, 0x30, 0xDF, 0x01, 0x06, 0xF0, 0x4B, 0xAF, 0x82, 0x26, 0xFD,
-    0xC5, 0x7C, 0xE8, 0xE7, 0x31, 0xA1, 0xB0, 0xC4, 0x9E, 0x02, 0x37, 0xD1, 0xF0, 0x6B, 0x87, 0x41,
-    0xB5, 0x28, 0x0D, 0x2A, 0x78, 0xCC, 0x5B, 0xE0, 0x78, 0x50, 0x41, 0x93, 0xC2, 0xD7, 0x4D, 0x43,
-    0x36, 0x68, 0x11, 0x02, 0x5B, 0x2E, 0xE5, 0xF7, 0x37, 0xE9, 0x07, 0x9A, 0xF0, 0x5E, 0x2F, 0xE2,
-    0x19, 0x42, 0x47, 0xFA, 0x08, 0x84, 0x7F, 0x44, 0xB0, 0xB0, 0x3F, 0x72, 0x73, 0x48, 0xF2, 0x81,
-    0xD4, 0x9D, 0x52, 0x22, 0x24, 0x9D, 0x86, 0x08, 0xF9, 0x95, 0x33, 0xA5, 0x44, 0x48, 0x1A, 0x29,
-    0x11, 0x92, 0xA0, 0x74, 0x9B, 0x62, 0x2E, 0x0E, 0xFE, 0xE0, 0xD8, 0xB4, 0x28, 0xE3, 0x3A, 0x68,
-    0x3D, 0xB8, 0xCF, 0x10, 0x87, 0xFD, 0x09, 0x75, 0x9A, 0xB8, 0x74, 0x79, 0xD4, 0x71, 0x09, 0x75,
-    0x34, 0x3B, 0xFE, 0x14, 0x42, 0x97, 0xFD, 0xF2, 0x58, 0x50, 0x1E, 0x0B, 0xF9, 0x3E, 0x25, 0x6F,
-    0xEE, 0xEC, 0x48, 0xDF, 0x29, 0xDF, 0xF1, 0xCE, 0x77, 0xB2, 0xEB, 0xCD, 0x7C, 0x04, 0x36, 0xE5,
-    0x3E, 0x53, 0xE5, 0x34, 0xBD, 0x36, 0x2E, 0xFD, 0x2E, 0x2E, 0x03, 0x1C, 0x61, 0xFF, 0x20, 0xEB,
-    0xE2, 0x97, 0xA2, 0x89, 0x7A, 0xB1, 0xB2, 0x98, 0x29, 0xF5, 0x71, 0xE7, 0x35, 0xA7, 0x1D, 0x80,
-    0xEE, 0xE2, 0x78, 0x95, 0xBC, 0xDB, 0x86, 0xDD, 0x96, 0xEC, 0xD5, 0xA0, 0x92, 0xB0, 0xCB, 0x96,
-    0xC4, 0x52, 0x80, 0x8C, 0x68, 0x92, 0x27, 0xFA, 0x07, 0xD3, 0x2D, 0x80, 0x2D, 0xBB, 0x76, 0xE2,
-    0x93, 0xFA, 0xD1, 0x99, 0x79, 0x78, 0x7D, 0xD4, 0xEF, 0x0A, 0x58, 0x47, 0x4C, 0xB6, 0x94, 0x2F,
-    0xEB, 0xAE, 0xD9, 0x94, 0x8F, 0xCB, 0xEA, 0x1D, 0x5F, 0x55, 0x6F, 0xF2, 0x9A, 0x5C, 0x1F, 0xBF,
-    0x23, 0xD7, 0xC7, 0x37, 0x35, 0xEC, 0xAC, 0x45, 0x04, 0xB1, 0x0E, 0x17, 0xB7, 0x73, 0x5D, 0x34,
-    0xAA, 0x9F, 0xDD, 0x1F, 0x9A, 0x4E, 0x77, 0xC4, 0x27, 0xC7, 0xCE, 0xCE, 0x35, 0x66, 0x22, 0x1F,
-    0xA1, 0x7E, 0x24, 0x7A, 0x49, 0x46, 0x0E, 0x81, 0x2A, 0x59, 0x47, 0x57, 0xA2, 0x5E, 0x60, 0x88,
-    0x7C, 0x84, 0xB5, 0x7C, 0x44, 0xE3, 0x8D, 0x55, 0x11, 0x17, 0x66, 0x21, 0xC5, 0xAB, 0x26, 0x54,
-    0x53, 0x3A, 0xB8, 0xB1, 0x42, 0xB5, 0xDD, 0x31, 0x2A, 0x67, 0x65, 0x1A, 0x32, 0x9F, 0x03, 0xD6,
-    0x1D, 0x08, 0xDE, 0xE1, 0x5D, 0xFC, 0x7A, 0x06, 0x58, 0xE1, 0xA8, 0xB8, 0xB7, 0x08, 0xB6, 0x87,
-    0x51, 0xAF, 0x32, 0xDB, 0xED, 0x03, 0xBC, 0x3A, 0xF6, 0x39, 0xE0, 0xC7, 0x0A, 0x33, 0xF9, 0x9A,
-    0x18, 0x49, 0x09, 0x5B, 0x49, 0x6E, 0x5C, 0x6C, 0x24, 0x15, 0xB5, 0x2B, 0x31, 0x8D, 0x1F, 0x72,
-    0xA0, 0xA3, 0xC2, 0xCD, 0x59, 0xDC, 0xC8, 0x2F, 0x67, 0xA9, 0x9A, 0xBD, 0x5F, 0x6E, 0x47, 0xDF,
-    0xCD, 0x52, 0x55, 0x26, 0x67, 0x2C, 0xAD, 0x23, 0xEE, 0xE5, 0x75, 0x54, 0xC5, 0x03, 0xC1, 0x75,
-    0x76, 0x86, 0xA9, 0x82, 0x6A, 0x80, 0x1D, 0x6A, 0x93, 0xF3, 0x00, 0xD0, 0x11, 0x6C, 0x4D, 0x71,
-    0xBC, 0x2B, 0xD2, 0xF8, 0xDD, 0x21, 0x84, 0x41, 0x2A, 0x5E, 0x99, 0x78, 0x7D, 0x8C, 0x1D, 0x64,
-    0x83, 0x2E, 0x68, 0x61, 0x57, 0xF0, 0x3B, 0xC0, 0x91, 0xF8, 0x6A, 0x9F, 0x34, 0xFE, 0x36, 0xC1,
-    0x91, 0xCD, 0xD0, 0x19, 0xD9, 0x86, 0xC2, 0xD3, 0x65, 0x70, 0x39, 0x87, 0xA8, 0xC7, 0x7A, 0x9C,
-    0xB5, 0x20, 0x0D, 0x63, 0x2F, 0x19, 0xC1, 0x86, 0x32, 0x73, 0x4A, 0x46, 0x3B, 0x93, 0xA1, 0x3B,
-    0x13, 0x6E, 0x2B, 0x26, 0x82, 0x50, 0x88, 0x97, 0xD7, 0x06, 0x75, 0x5C, 0x79, 0xDC, 0xC9, 0x2D,
-    0x90, 0x2F, 0x8F, 0x6E, 0x3C, 0xFA, 0x24, 0x75, 0xFB, 0x24, 0xD7, 0x23, 0x5B, 0x38, 0x00, 0xB7,
-    0x05, 0x65, 0x3C, 0xFE, 0x32, 0x6D, 0x66, 0x03, 0x63, 0x8E, 0x99, 0x77, 0x42, 0xA8, 0x50, 0xCF,
-    0xC2, 0x08, 0x5A, 0xDF, 0x2E, 0xB1, 0xC0, 0xD2, 0xE1, 0x4D, 0x4C, 0xF5, 0xD9, 0x5B, 0xF0, 0x9D,
-    0xDE, 0x85, 0x53, 0x1D, 0xB4, 0xD9, 0xAB, 0x2D, 0xA8, 0xAF, 0xA1, 0x5E, 0xB0, 0x19, 0xAB, 0xE4,
-    0x8A, 0x00, 0xD2, 0x22, 0x2F, 0x9E, 0x05, 0xA1, 0xF8, 0x5D, 0xD8, 0xC3, 0x0B, 0x04, 0xA1, 0xD9,
-    0xEB, 0x20, 0x34, 0xFC, 0x14, 0x9D, 0x8E, 0x25, 0xF5, 0x09, 0x09, 0xF5, 0xED, 0x75, 0x5A, 0x76,
-    0x52, 0x1F, 0xED, 0xA8, 0x8C, 0xF1, 0x06, 0x33, 0xE6, 0xF6, 0x35, 0x70, 0x24, 0xC8, 0x35, 0xE8,
-    0xA6, 0x41, 0x15, 0xF5, 0xFA, 0x45, 0x66, 0x3F, 0x23, 0xDA, 0x67, 0x7B, 0x28, 0x19, 0xBD, 0xF0,
-    0x64, 0xAA, 0x86, 0x73, 0xB5, 0xE4, 0x76, 0x67, 0xE2, 0xEF, 0x88, 0xC0, 0x3D, 0xC9, 0xFB, 0x89,
-    0x93, 0xAF, 0xB2, 0xF4, 0x37, 0x7B, 0xCB, 0xD2, 0x2F, 0xA2, 0x99, 0x2C, 0x5D, 0xD9, 0x5B, 0x96,
-    0xDA, 0x3F, 0x45, 0x96, 0x92, 0xFB, 0x94, 0x25, 0x27, 0x37, 0x7F, 0x6D, 0x5A, 0xCC, 0x7A, 0x19,
-    0x6A, 0x38, 0x1C, 0xC6, 0x9D, 0xFA, 0x79, 0xCA, 0x12, 0x37, 0x38, 0x55, 0xC4, 0x38, 0x16, 0xA3,
-    0x02, 0xCB, 0xF7, 0x28, 0xE9, 0xC1, 0xB8, 0x47, 0x62, 0xC9, 0xE4, 0x62, 0xDC, 0xB0, 0x82, 0xF5,
-    0x69, 0x70, 0xEF, 0x06, 0xE3, 0x60, 0x5C, 0xB7, 0x5B, 0x3C, 0xE0, 0x7D, 0xF7, 0x7A, 0xC0, 0x2D,
-    0xC8, 0xE1, 0x47, 0x8C, 0xC7, 0xC3, 0x21, 0xC3, 0x12, 0x8C, 0x5E, 0xA3, 0x5A, 0x65, 0xCA, 0xC0,
-    0x64, 0xCC, 0x19, 0x7F, 0xE9, 0xBE, 0x39, 0xEB, 0xEE, 0xC7, 0xD9, 0x49, 0x51, 0x4E, 0xF1, 0x9B,
-    0x00, 0xF8, 0x1E, 0x2B, 0x0B, 0xB8, 0x6E, 0xA7, 0x1E, 0x31, 0x13, 0x7F, 0x64, 0x9E, 0x24, 0xE7,
-    0xF6, 0x0C, 0xBD, 0xF3, 0x52, 0x9F, 0xA9, 0x66, 0x53, 0x0C, 0xCC, 0xCB, 0x0F, 0x54, 0xA5, 0x05,
-    0xD1, 0x1E, 0x6F, 0x1C, 0x8A, 0xC2, 0x8B, 0x18, 0xB6, 0x31, 0xC9, 0x7B, 0x92, 0xDC, 0x38, 0x49,
-    0x65, 0x3A, 0x30, 0xC7, 0xE1, 0x6D, 0x4B, 0x90, 0xE8, 0x53, 0x29, 0x05, 0x78, 0x9F, 0x1B, 0xF2,
-    0x92, 0x76, 0x73, 0xEF, 0x08, 0xCA, 0x36, 0xC5, 0x73, 0x82, 0x2C, 0x63, 0xBB, 0xF2, 0x75, 0xAB,
-    0xD1, 0x8E, 0xBC, 0xB0, 0x9A, 0xDF, 0x60, 0x9C, 0x56, 0x13, 0xA8, 0x92, 0x8B, 0xC5, 0x4C, 0xA6,
-    0x79, 0x74, 0xE7, 0xFB, 0xE7, 0x25, 0x5D, 0xB8, 0x74, 0x6E, 0x75, 0x65, 0x5F, 0xC9, 0x88, 0xB7,
-    0x19, 0x0C, 0xCC, 0x83, 0xA1, 0x68, 0x22, 0xF2, 0x0B, 0x56, 0x03, 0x86, 0xE2, 0xD4, 0x29, 0x63,
-    0x4E, 0xC3, 0x16, 0x33, 0xF3, 0x70, 0xFA, 0x34, 0x0E, 0xF4, 0x4F, 0x92, 0xDF, 0xFC, 0x80, 0xF1,
-    0xB2, 0x36, 0xC0, 0x90, 0x0E, 0x03, 0xC1, 0x14, 0x81, 0x25, 0x71, 0x53, 0x9E, 0x34, 0x7E, 0x4A,
-    0x37, 0xE4, 0xA8, 0xE4, 0x68, 0xB9, 0x65, 0xB5, 0x16, 0xAF, 0xD8, 0xB8, 0x4B, 0xB6, 0xE2, 0x21,
-    0x64, 0xD9, 0x41, 0x63, 0xDE, 0xF0, 0x53, 0xA7, 0xF6, 0x4A, 0x49, 0x34, 0x02, 0xB2, 0x33, 0xD1,
-    0x78, 0xE3, 0xEE, 0x9B, 0xEB, 0x41, 0x59, 0x48, 0x03, 0x74, 0x91, 0xF1, 0x44, 0xA6, 0xA5, 0x4B,
-    0xBE, 0xAD, 0xA4, 0xDB, 0x57, 0xD4, 0x9E, 0xEF, 0x5D, 0x01, 0x42, 0x49, 0xAF, 0x47, 0xCE, 0x79,
-    0xAC, 0x39, 0x48, 0x03, 0xFA, 0xA4, 0x25, 0xC1, 0x6E, 0x52, 0x2B, 0xEB, 0x12, 0xA9, 0x21, 0xE3,
-    0x19, 0x6E, 0x7C, 0x4A, 0x6D, 0x21, 0x4C, 0x92, 0x33, 0xC4, 0x7E, 0x7E, 0x9E, 0xF6, 0xCB, 0x35,
-    0xBC, 0x1E, 0x7A, 0x50, 0x72, 0x61, 0xCA, 0x3D, 0x29, 0x51, 0xAB, 0x03, 0x49, 0x0F, 0x48, 0x00,
-    0x2D, 0x1F, 0xD9, 0x27, 0x45, 0x00, 0x98, 0xCF, 0xDC, 0x63, 0x86, 0x6E, 0x0A, 0x72, 0x80, 0x05,
-    0xAF, 0x85, 0x7B, 0xEB, 0xB0, 0x7E, 0x11, 0xEF, 0x47, 0x53, 0xF3, 0xE8, 0xFD, 0x54, 0xB7, 0xC4,
-    0xA4, 0x2B, 0xB6, 0x82, 0x47, 0x0A, 0x29, 0x1B, 0x24, 0x7C, 0x95, 0x60, 0x53, 0x4D, 0x5F, 0x97,
-    0x1C, 0x25, 0x50, 0xC4, 0x5F, 0x64, 0x2A, 0x81, 0x0C, 0xDE, 0xE4, 0x2B, 0x4C, 0xDA, 0x2A, 0xB4,
-    0x92, 0x26, 0xC7, 0x19, 0x9A, 0x33, 0xC2, 0x5D, 0x89, 0x6F, 0x4E, 0x19, 0xB6, 0x2A, 0x49, 0x0D,
-    0xD2, 0x10, 0xDA, 0x9B, 0x5A, 0x6F, 0x28, 0xFA, 0x02, 0xAB, 0xC1, 0x2D, 0x5F, 0xA9, 0xF5, 0x23,
-    0xFF, 0x58, 0x6B, 0x22, 0xB1, 0x70, 0x3B, 0xC6, 0x26, 0xC6, 0xB4, 0xA2, 0xE4, 0xEB, 0x34, 0xB2,
-    0xCD, 0x0B, 0x6C, 0x2F, 0xD8, 0xAC, 0x60, 0x70, 0xDB, 0xA8, 0x7E, 0x90, 0xCA, 0x11, 0xFB, 0xF3,
-    0x54, 0x0A, 0x21, 0x38, 0x36, 0x77, 0x01, 0xD7, 0x49, 0x80, 0x33, 0x43, 0xD1, 0x13, 0xF5, 0x4B,
-    0x5C, 0xFB, 0x89, 0xB3, 0x26, 0xA2, 0xAD, 0xFC, 0x94, 0xBA, 0x40, 0x89, 0x93, 0xDB, 0xD9, 0x24,
-    0xE5, 0xD5, 0xF0, 0xFE, 0x52, 0x00, 0x00, 0x36, 0x67, 0x7A, 0xAD, 0x1A, 0x6B, 0x70, 0xAB, 0x90,
-    0x68, 0xEB, 0xD5, 0x6D, 0xB7, 0x0E, 0x86, 0xF3, 0xD0, 0x4E, 0x2D, 0xE4, 0x0F, 0x6A, 0x71, 0x3D,
-    0xE1, 0xD4, 0xBF, 0xBE, 0xB5, 0x2C, 0x93, 0x1B, 0x4E, 0x49, 0xCA, 0xF5, 0xA3, 0x2D, 0xCD, 0x39,
-    0x6E, 0x69, 0x02, 0xF0, 0xB4, 0xE6, 0x57, 0x13, 0x4D, 0x26, 0x41, 0x2E, 0xAD, 0x66, 0x03, 0xB9,
-    0x45, 0x30, 0x97, 0xDF, 0x69, 0x4E, 0x30, 0xE7, 0x86, 0x81, 0x8C, 0xCA, 0x5E, 0x7D, 0x72, 0x4C,
-    0xAB, 0x41, 0x58, 0x15, 0xE8, 0x09, 0x62, 0xFA, 0xDB, 0xDD, 0xAB, 0x78, 0xEE, 0x2D, 0x62, 0x76,
-    0x95, 0x11, 0xBA, 0x91, 0x9D, 0x61, 0xA4, 0x10, 0xE8, 0x70, 0x0B, 0xDE, 0xA4, 0x5F, 0xA3, 0x71,
-    0x09, 0x8D, 0xA8, 0x8A, 0xB1, 0x3B, 0x19, 0x2B, 0xCE, 0xC1, 0x38, 0x6E, 0xB6, 0x4E, 0x0A, 0x3B,
-    0xBC, 0xE1, 0x84, 0xCD, 0x13, 0xD8, 0x39, 0x8F, 0x45, 0xA3, 0xC0, 0x09, 0x16, 0xAB, 0x12, 0x36,
-    0x6C, 0x3C, 0x8B, 0x46, 0x97, 0x61, 0xEB, 0x5E, 0x1B, 0xC0, 0x43, 0x36, 0x7E, 0x35, 0x50, 0x6B,
-    0x7C, 0x93, 0xE6, 0x16, 0x98, 0xF3, 0x18, 0x03, 0x7F, 0xE1, 0x3C, 0x94, 0xB4, 0x7C, 0xB8, 0xBA,
-    0x6D, 0x9F, 0xB5, 0x43, 0x38, 0xFC, 0x30, 0x2B, 0x1D, 0x29, 0x5C, 0xC1, 0xFA, 0x64, 0x0C, 0xE8,
-    0x04, 0x0C, 0x41, 0x30, 0x34, 0x3D, 0x31, 0x11, 0x5C, 0xFE, 0xDA, 0x2C, 0x9D, 0xFB, 0x77, 0x6A,
-    0xAE, 0x8E, 0x33, 0x6F, 0x70, 0xBB, 0x2C, 0x0F, 0x21, 0x77, 0xB8, 0x5F, 0x50, 0xB1, 0x72, 0x92,
-    0x0D, 0xCC, 0xDC, 0x99, 0xB8, 0x8C, 0x9F, 0x62, 0xC2, 0x9D, 0x54, 0x5F, 0xA1, 0x91, 0x73, 0x43,
-    0x80, 0x7F, 0x6B, 0x0C, 0x39, 0xC3, 0xBA, 0x95, 0x66, 0x98, 0x4D, 0x98, 0x0D, 0x86, 0xF7, 0xEC,
-    0xD9, 0xE9, 0x84, 0x39, 0xF3, 0x09, 0x1B, 0xF5, 0x3E, 0x5B, 0x40, 0x62, 0xF0, 0x5C, 0x11, 0x49,
-    0x6C, 0xD9, 0xB1, 0x7E, 0x4B, 0x8A, 0x9F, 0x88, 0x99, 0x66, 0x79, 0x0E, 0xEF, 0xFA, 0x96, 0x77,
-    0x73, 0xE2, 0xB1, 0x58, 0xEB, 0x3F, 0x7C, 0x46, 0xE7, 0x46, 0xFD, 0xE1, 0x33, 0x56, 0xC3, 0x77,
-    0xA8, 0xEF, 0x96, 0xF4, 0x45, 0xDD, 0x3E, 0x83, 0x75, 0xCC, 0x41, 0xC1, 0x35, 0x8E, 0xA5, 0xBC,
-    0x08, 0x03, 0x64, 0x2C, 0x99, 0x31, 0x6E, 0x6E, 0xDE, 0xD0, 0x24, 0xC0, 0x72, 0x3C, 0x06, 0x3B,
-    0x04, 0x81, 0x7D, 0xFB, 0x2F, 0xBE, 0xD4, 0x4C, 0xA3, 0xF8, 0xF9, 0xC5, 0x20, 0x0F, 0xDE, 0xCF,
-    0x39, 0x53, 0xAE, 0x76, 0xBA, 0xB0, 0xDE, 0x61, 0xD1, 0x82, 0x27, 0xC6, 0xFE, 0x36, 0x65, 0xF1,
-    0x92, 0x94, 0x4B, 0x70, 0x8F, 0x66, 0xE2, 0xDD, 0x06, 0xF3, 0xE8, 0x5C, 0x45, 0x9E, 0xF8, 0xC3,
-    0xB4, 0x30, 0x54, 0xAB, 0x5D, 0x47, 0x3F, 0x46, 0xFD, 0x00, 0x4D, 0x80, 0x6F, 0xDE, 0x53, 0x67,
-    0x1D, 0x78, 0x2D, 0x95, 0xCD, 0xDB, 0x8C, 0xC5, 0x49, 0xA1, 0x00, 0x84, 0x6C, 0x1B, 0x7E, 0x93,
-    0x96, 0xAC, 0x49, 0xFD, 0xDD, 0xE8, 0xD2, 0x09, 0x18, 0x56, 0x28, 0x15, 0x08, 0xB6, 0x08, 0x25,
-    0x05, 0x16, 0x8A, 0x2A, 0x57, 0x53, 0x08, 0x70, 0xD3, 0x9B, 0x69, 0x3C, 0xD2, 0x48, 0x8F, 0x23,
-    0x8E, 0x96, 0x6F, 0xCB, 0x2F, 0x89, 0xF7, 0x55, 0xC0, 0x8B, 0xEC, 0x45, 0x95, 0xD5, 0xA2, 0x3C,
-    0xBC, 0x59, 0x19, 0xF1, 0xC4, 0x1C, 0xB4, 0x76, 0x7B, 0x3E, 0xB7, 0x9F, 0xEA, 0x7E, 0x8D, 0xD4,
-    0x4D, 0xA6, 0x57, 0xF6, 0xF8, 0x9D, 0x49, 0x52, 0xD8, 0x3E, 0x2C, 0x4A, 0x70, 0xE3, 0x51, 0xA1,
-    0xBE, 0x51, 0x57, 0x2F, 0x18, 0x34, 0x82, 0x2B, 0x19, 0x0E, 0x96, 0x15, 0x04, 0xCD, 0x21, 0xB0,
-    0x14, 0x63, 0x84, 0x5A, 0xE3, 0x52, 0x1E, 0x5E, 0x28, 0xD7, 0x5B, 0x9F, 0x3B, 0xA8, 0x52, 0x8A,
-    0xE8, 0x55, 0x9D, 0xD4, 0x71, 0xFC, 0x54, 0xCA, 0x15, 0x1E, 0xD9, 0x35, 0xE2, 0xBF, 0x3C, 0x3F,
-    0x2A, 0xCD, 0xB1, 0x86, 0x4B, 0x94, 0x9C, 0x6F, 0x37, 0x70, 0xE9, 0x98, 0xD1, 0x9B, 0x97, 0xA0,
-    0x6B, 0x35, 0xB6, 0x3A, 0xDA, 0xA2, 0xC4, 0x71, 0xF5, 0x0D, 0x39, 0x0F, 0x5A, 0x48, 0x92, 0x93,
-    0x02, 0x89, 0xFF, 0x47, 0x72, 0x56, 0x8F, 0x3B, 0xB2, 0x63, 0x15, 0x62, 0x0A, 0x2D, 0xDC, 0x04,
-    0xC3, 0x39, 0x2D, 0x73, 0xD6, 0xD2, 0x46, 0x45, 0x03, 0x83, 0x28, 0xDA, 0x0A, 0xEC, 0x9E, 0x81,
-    0x3C, 0xE6, 0xED, 0x25, 0x1B, 0xC0, 0x28, 0x4B, 0x02, 0x2A, 0x22, 0xF3, 0x84, 0x39, 0x34, 0x9B,
-    0xF7, 0xDA, 0x90, 0x86, 0x60, 0xF1, 0xA5, 0xA7, 0x57, 0xA4, 0xB6, 0x60, 0x5C, 0xD4, 0xE2, 0x86,
-    0x91, 0x84, 0x78, 0xCC, 0x70, 0xA0, 0x94, 0xAE, 0x9B, 0x1B, 0x3E, 0x6D, 0x7C, 0xA3, 0x25, 0x61,
-    0xBD, 0x5A, 0xC7, 0xAF, 0xAF, 0x8E, 0x16, 0xC2, 0x88, 0xBE, 0xA0, 0xFC, 0x13, 0x63, 0xDE, 0x30,
-    0x2B, 0xEA, 0x78, 0x8D, 0x34, 0x4E, 0x16, 0x48, 0xD7, 0x8A, 0x41, 0x31, 0xAD, 0x89, 0xAC, 0xAA,
-    0x3C, 0xE5, 0x30, 0xDA, 0x7D, 0xA7, 0x18, 0x85, 0xA2, 0x91, 0xA0, 0x43, 0xAD, 0x02, 0xA2, 0xA4,
-    0x3F, 0x42, 0x00, 0xEB, 0xDA, 0x73, 0xC5, 0xB4, 0x36, 0x51, 0x94, 0xBA, 0xE8, 0xF6, 0x3C, 0x91,
-    0xE2, 0x92, 0xC3, 0xCA, 0x45, 0xB3, 0xB1, 0x10, 0x59, 0x78, 0x42, 0xCE, 0x7F, 0x2F, 0x3B, 0xA0,
-    0x9C, 0xE5, 0xD7, 0x97, 0xD2, 0x07, 0xA4, 0xDC, 0xC3, 0xD5, 0xDF, 0x20, 0x3E, 0xE3, 0x0C, 0x71,
-    0xFC, 0x15, 0x8E, 0x9F, 0x88, 0x8A, 0x73, 0xDF, 0x24, 0x74, 0x77, 0xA6, 0x92, 0x62, 0x8E, 0x05,
-    0x5C, 0xBA, 0xE5, 0x05, 0x6E, 0xAC, 0xCF, 0xF3, 0x01, 0x5F, 0xB8, 0xDD, 0xB7, 0x04, 0x2D, 0x1A,
-    0xA6, 0x47, 0x4D, 0xF0, 0x6A, 0x29, 0x21, 0x61, 0x4A, 0xF2, 0xA1, 0xCF, 0x74, 0xF7, 0x51, 0xA0,
-    0xED, 0xFB, 0x3C, 0x7D, 0x2A, 0x00, 0xE1, 0xE7, 0x2B, 0x13, 0x60, 0x1C, 0xA5, 0x55, 0xF6, 0x8D,
-    0xCA, 0xD1, 0x64, 0xC6, 0x00, 0x29, 0x02, 0x96, 0xD5, 0xD6, 0x4A, 0x11, 0x89, 0xA3, 0x4B, 0x5A,
-    0xDF, 0x9F, 0x77, 0x8A, 0xDB, 0xAF, 0x01, 0x81, 0x7E, 0x56, 0x12, 0x50, 0xCC, 0xA2, 0x04, 0x62,
-    0x9F, 0x34, 0x2B, 0xAF, 0x59, 0xB7, 0x72, 0x9A, 0xD9, 0x19, 0x25, 0x28, 0x98, 0x85, 0x16, 0x7E,
-    0x34, 0xC6, 0x49, 0x73, 0x82, 0x34, 0x06, 0x9E, 0x24, 0xD0, 0xE7, 0x49, 0xCD, 0x57, 0x3F, 0x8D,
-    0xED, 0x55, 0x62, 0x59, 0x16, 0xE3, 0x83, 0xA2, 0xAF, 0x53, 0xC8, 0x71, 0xED, 0x0B, 0x04, 0x61,
-    0x25, 0x31, 0xC5, 0x52, 0x1E, 0x8B, 0x10, 0xD9, 0x84, 0xF6, 0x5E, 0xA2, 0x5A, 0x71, 0x78, 0x73,
-    0x3E, 0x18, 0xB1, 0x4E, 0xC9, 0xF1, 0x6F, 0xE6, 0x53, 0x9A, 0x24, 0x02, 0x66, 0xD2, 0x3D, 0xAA,
-    0xFB, 0xC9, 0x27, 0xC1, 0x38, 0xC2, 0xBC, 0xFF, 0x5D, 0x0D, 0x2B, 0x78, 0x76, 0x77, 0xF0, 0x69,
-    0xCE, 0xBC, 0x61, 0x46, 0xDD, 0x6E, 0x3E, 0xCD, 0x99, 0x27, 0xFB, 0x77, 0x37, 0x9F, 0x16, 0x98,
-    0x27, 0x7C, 0x4A, 0x66, 0xCC, 0x33, 0x63, 0x0A, 0x8A, 0xB1, 0xCA, 0x63, 0xE6, 0x3B, 0x7E, 0xE5,
-    0xD7, 0xEB, 0xE6, 0x74, 0x50, 0x6A, 0x71, 0x34, 0xD8, 0xC3, 0x88, 0xA0, 0xCC, 0x61, 0xA2, 0x53,
-    0xE9, 0x35, 0x7E, 0x37, 0xFF, 0x00, 0x88, 0x91, 0x3C, 0xA9, 0xB8, 0x10, 0x8C, 0x4B, 0x98, 0xB1,
-    0xBC, 0x62, 0x51, 0x1A, 0xDE, 0xFA, 0x23, 0xA5, 0x61, 0x77, 0x65, 0xED, 0x02, 0x95, 0x7F, 0x84,
-    0x34, 0xA8, 0xD1, 0x89, 0x72, 0x59, 0x6F, 0x80, 0x77, 0xB7, 0xE5, 0xED, 0x2E, 0xCB, 0x23, 0x2F,
-    0xA9, 0x4C, 0x21, 0x49, 0xB1, 0x5D, 0x7B, 0xA8, 0xFF, 0xB7, 0xA5, 0x53, 0x91, 0x45, 0xA6, 0xD5,
-    0x81, 0x19, 0xFD, 0x18, 0xD6, 0x88, 0x48, 0x7D, 0xBD, 0x93, 0x7E, 0x95, 0xDB, 0xD5, 0x4B, 0x8D,
-    0xF3, 0x41, 0x09, 0x0A, 0x2E, 0x3C, 0x75, 0x01, 0x32, 0x46, 0x04, 0xF4, 0x25, 0xF3, 0xC2, 0x3E,
-    0x15, 0x3F, 0xBF, 0x80, 0x89, 0xFB, 0x4F, 0xCB, 0xD9, 0xC2, 0xFE, 0xBB, 0xF2, 0xFC, 0x50, 0x71,
-    0x8D, 0x05, 0xDF, 0xBF, 0x9F, 0x77, 0x52, 0x25, 0x64, 0xAC, 0xA2, 0x10, 0xDF, 0xD2, 0x67, 0x7C,
-    0xDB, 0x19, 0xA4, 0xF3, 0x0C, 0x3B, 0x6B, 0x76, 0x76, 0xF3, 0xCE, 0x67, 0xF9, 0xF3, 0x8A, 0x49,
-    0xAF, 0x16, 0x34, 0xFB, 0x00, 0xC7, 0xAF, 0xAD, 0x59, 0x47, 0x1F, 0xDA, 0x99, 0xBA, 0x45, 0x5C,
-    0x01, 0xA8, 0x55, 0xDF, 0x4E, 0x71, 0x9D, 0xD3, 0xFA, 0x26, 0xFA, 0xE5, 0xB7, 0xCC, 0x85, 0x0B,
-    0x3F, 0x71, 0xCB, 0xDB, 0x65, 0x68, 0x26, 0xBB, 0xA3, 0x56, 0xAD, 0x09, 0x7E, 0x55, 0x99, 0xF8,
-    0x64, 0x6A, 0xB6, 0x4E, 0x1B, 0xF7, 0x93, 0xCE, 0x04, 0xEF, 0x01, 0x81, 0x3D, 0x07, 0xF8, 0x08,
-    0xCB, 0xD3, 0x01, 0x10, 0x7D, 0x00, 0x88, 0xFA, 0xB3, 0xDA, 0x1B, 0x62, 0x4D, 0x71, 0xB3, 0xFA,
-    0xF2, 0x0A, 0xE4, 0xD6, 0xB1, 0xD7, 0xA7, 0x52, 0x04, 0xF9, 0x5F, 0xA2, 0x09, 0x0B, 0xA8, 0xBA,
-    0x9C, 0xE7, 0xF7, 0xD3, 0x91, 0x59, 0xB5, 0x1F, 0x27, 0xA4, 0xF3, 0xAA, 0xD4, 0xC3, 0xCF, 0x38,
-    0xB1, 0xC0, 0x9E, 0xDD, 0x9C, 0x98, 0xB3, 0x87, 0x3E, 0xA5, 0x3B, 0xE1, 0x8E, 0xB4, 0xCF, 0x50,
-    0xDF, 0x96, 0xC5, 0xAD, 0x13, 0x6A, 0x6C, 0xA4, 0x94, 0x4C, 0x9E, 0x1B, 0xD0, 0xE7, 0xBB, 0x52,
-    0x79, 0x54, 0x61, 0xF6, 0x4A, 0x5F, 0x14, 0x8D, 0x39, 0xEC, 0x2A, 0xA4, 0x86, 0xA4, 0x6C, 0x9D,
-    0x02, 0x17, 0xC8, 0x94, 0x1A, 0x4C, 0xC9, 0x0D, 0x7C, 0x17, 0xAF, 0x9D, 0x72, 0x61, 0x64, 0xCA,
-    0x60, 0x92, 0x5F, 0x6B, 0xD9, 0x28, 0x8B, 0x2F, 0xE1, 0xD9, 0x7F, 0xDA, 0x44, 0x83, 0x86, 0xCC,
-    0x9F, 0xA2, 0x55, 0x0A, 0x89, 0x76, 0xBC, 0x9A, 0xE1, 0xED, 0x84, 0x4A, 0x5B, 0x8D, 0xE3, 0x63,
-    0x1B, 0x77, 0x8B, 0x8B, 0xDD, 0x43, 0x56, 0x66, 0x1C, 0x8A, 0x76, 0x73, 0xE8, 0xCC, 0xBE, 0x1C,
-    0xAA, 0xAC, 0xF8, 0xCF, 0xD0, 0x6C, 0x93, 0x80, 0x36, 0xDE, 0xB5, 0x1F, 0xFE, 0x40, 0xE1, 0x87,
-    0x38, 0xD2, 0xF4, 0x1C, 0xF4, 0x09, 0xB0, 0x09, 0x9D, 0xD4, 0x29, 0x34, 0xFF, 0x0E, 0x26, 0xFF,
-    0x14, 0x2C, 0x44, 0xE7, 0xB4, 0xF4, 0xBB, 0x18, 0x7E, 0x32, 0x3F, 0xDE, 0xAD, 0xC2, 0x82, 0x51,
-    0x62, 0x4E, 0xA9, 0xC4, 0x90, 0x57, 0xCF, 0xE5, 0x66, 0xB2, 0x28, 0x31, 0xE4, 0x55, 0x1E, 0x76,
-    0x85, 0x56, 0x0E, 0xB3, 0x26, 0x3D, 0xB0, 0x13, 0x18, 0xAC, 0xB3, 0x63, 0x44, 0x92, 0x41, 0x6F,
-    0xF3, 0x0F, 0x17, 0xF8, 0x90, 0xD7, 0x57, 0x79, 0x47, 0x8F, 0x8F, 0x79, 0x5D, 0x2E, 0xA7, 0x59,
-    0x56, 0xB7, 0xBE, 0x1B, 0xD8, 0xBD, 0x07, 0xA3, 0xAE, 0x7D, 0x26, 0xA2, 0xB4, 0xBD, 0xAF, 0x28,
-    0x65, 0x73, 0x51, 0x62, 0x32, 0xFB, 0x7F, 0x72, 0x4C, 0xDF, 0x98, 0xEF, 0x82, 0x8E, 0x0B, 0x0A,
-    0x29, 0xCC, 0x9B, 0x77, 0x84, 0x14, 0x1E, 0x54, 0xB2, 0x18, 0x85, 0x61, 0x89, 0x0E, 0xDE, 0x19,
-    0x15, 0x95, 0x04, 0x68, 0xF4, 0x69, 0xC6, 0x7B, 0x31, 0xCA, 0x17, 0x76, 0xDC, 0xA5, 0xE9, 0xF5,
-    0x63, 0x94, 0xC6, 0x59, 0x68, 0x0E, 0xD2, 0xAC, 0xF7, 0x6C, 0x56, 0xC2, 0x2C, 0x7D, 0x28, 0x49,
-    0x94, 0x91, 0xCA, 0x56, 0x34, 0x8B, 0x6B, 0xE5, 0xAA, 0x8D, 0x44, 0xB8, 0x16, 0xD9, 0x75, 0x70,
-    0x03, 0x6F, 0xB7, 0x63, 0x3D, 0x3B, 0xE3, 0xE2, 0xD4, 0xEB, 0x59, 0xFA, 0xD8, 0x8A, 0x79, 0x6C,
-    0x3F, 0x70, 0x45, 0xBE, 0xB1, 0xC4, 0x00, 0x12, 0x17, 0x49, 0xB3, 0x93, 0x66, 0x4E, 0x23, 0xDE,
-    0xD1, 0xA0, 0xC0, 0x16, 0x0D, 0x64, 0x0A, 0x59, 0xB1, 0xD0, 0xAC, 0x3D, 0x8D, 0xAA, 0xC9, 0x53,
-    0x1D, 0x83, 0x51, 0x8B, 0x02, 0x89, 0x97, 0xA7, 0x66, 0xA6, 0x32, 0xF8, 0x67, 0x10, 0xA3, 0xEA,
-    0xEE, 0x1A, 0x29, 0x9D, 0x3A, 0x7B, 0x4F, 0x8C, 0x0F, 0xC0, 0x4D, 0x6D, 0xDB, 0xE1, 0xB1, 0x18,
-    0x67, 0x6B, 0x94, 0x99, 0x4A, 0x65, 0x06, 0x2A, 0xBA, 0x05, 0xD9, 0xEF, 0x2D, 0xC8, 0x0C, 0x45,
-    0xA8, 0x33, 0xF6, 0x55, 0x7D, 0x50, 0x83, 0xA8, 0xAC, 0x29, 0xEC, 0xFB, 0x65, 0xC6, 0x58, 0x1A,
-    0x5D, 0xAD, 0xA3, 0x8A, 0xA3, 0x0F, 0x8D, 0x23, 0xD1, 0x68, 0xAE, 0x2D, 0x72, 0xF8, 0x88, 0x59,
-    0x4C, 0xEF, 0xE9, 0x83, 0x58, 0x2C, 0x5D, 0x5A, 0x1F, 0xD5, 0xC1, 0xD1, 0xB1, 0x04, 0xE4, 0x6B,
-    0x77, 0x2A, 0x2D, 0x35, 0x26, 0xE1, 0xC7, 0xAA, 0x3B, 0x92, 0x9F, 0xE9, 0x43, 0x51, 0x13, 0x79,
-    0x8C, 0x8C, 0xE1, 0x79, 0x51, 0x1B, 0xC9, 0x65, 0x59, 0x7D, 0x95, 0x1C, 0x6A, 0x24, 0x86, 0x03,
-    0x2A, 0x20, 0xEB, 0xB8, 0xE2, 0x64, 0x80, 0x18, 0x72, 0xCF, 0xA6, 0x3E, 0x0B, 0xF4, 0x98, 0x19,
-    0xA8, 0x70, 0x19, 0x85, 0x08, 0x66, 0x2E, 0xB0, 0x12, 0xCB, 0xA8, 0x93, 0x9B, 0x0D, 0x2B, 0xC7,
-    0xAE, 0xD8, 0xB8, 0xC6, 0x2D, 0x2D, 0x1C, 0x72, 0x2C, 0x82, 0xD7, 0x17, 0x95, 0x7D, 0xBD, 0x31,
-    0xC1, 0x6D, 0x28, 0x36, 0x80, 0xC5, 0x88, 0x0F, 0xEF, 0x8A, 0xB0, 0x95, 0xA1, 0xC2, 0x70, 0xF1,
-    0xC4, 0x3C, 0xDB, 0x4A, 0xA6, 0x30, 0x60, 0xB1, 0x10, 0xE6, 0x19, 0xF1, 0x69, 0x9F, 0x6A, 0x5E,
-    0xB9, 0xA5, 0x25, 0xE4, 0xFA, 0x0C, 0xA6, 0xE4, 0xA0, 0xA2, 0xF3, 0x92, 0x38, 0x04, 0xF5, 0x4E,
-    0x6D, 0x2E, 0xEC, 0xB7, 0xAD, 0x48, 0xC8, 0x07, 0x52, 0x41, 0x2F, 0xF5, 0xF4, 0x57, 0x08, 0x54,
-    0xFA, 0xA8, 0x3C, 0x60, 0xE2, 0x7C, 0xE2, 0x74, 0x5E, 0xCB, 0x30, 0x42, 0x62, 0x8A, 0xD0, 0xFA,
-    0x8D, 0xFF, 0x07, 0xDB, 0x5F, 0x32, 0x49, 0x61, 0x6F, 0xB2, 0x08, 0x9F, 0x61, 0x2C, 0x7B, 0xD3,
-    0x96, 0x8E, 0x6D, 0x19, 0xE4, 0x19, 0x58, 0xF5, 0x0A, 0x03, 0x0E, 0x3A, 0x5A, 0x49, 0x77, 0x7D,
-    0x63, 0xAA, 0x54, 0x34, 0xF0, 0x12, 0x9E, 0xA7, 0x63, 0x90, 0x32, 0x60, 0x37, 0x86, 0x06, 0xF6,
-    0x7C, 0x46, 0xDA, 0x97, 0x3A, 0xCC, 0x8E, 0x15, 0x6B, 0xBD, 0x86, 0x16, 0xB0, 0xB1, 0x8A, 0x94,
-    0xB5, 0x7E, 0x25, 0x1F, 0x2F, 0x02, 0xBB, 0xAB, 0x88, 0xFB, 0x54, 0x04, 0x93, 0xA5, 0x4F, 0xD1,
-    0xC7, 0x4C, 0x33, 0x48, 0x0E, 0x81, 0x55, 0x52, 0x52, 0x4A, 0x08, 0xD1, 0xAB, 0x66, 0x10, 0xB1,
-    0x9B, 0xE6, 0xE7, 0xB4, 0xC8, 0x3B, 0x93, 0x1C, 0x98, 0x3C, 0xCC, 0x37, 0xCC, 0xD2, 0xCB, 0x82,
-    0x32, 0x32, 0x81, 0x6E, 0xB9, 0x02, 0x28, 0xFE, 0x6C, 0xF9, 0xB4, 0x31, 0x6D, 0x90, 0x7B, 0xB9,
-    0xB3, 0xA7, 0x6A, 0xC2, 0xB7, 0x09, 0xE0, 0xD6, 0x69, 0xEE, 0x61, 0xC8, 0x41, 0xEF, 0x37, 0xA6,
-    0xF7, 0x5A, 0xB7, 0xC3, 0xCC, 0x5B, 0x33, 0xE0, 0x26, 0xD9, 0x71, 0x4C, 0xFB, 0x9D, 0xDA, 0x44,
-    0x37, 0xB1, 0x8F, 0xA5, 0x94, 0xAB, 0x94, 0x42, 0x15, 0xC9, 0x6C, 0x8F, 0x49, 0x3A, 0xF2, 0x8A,
-    0x85, 0x91, 0x6B, 0xBD, 0xD4, 0xF6, 0xB0, 0xC8, 0x87, 0xF9, 0xF2, 0x78, 0x43, 0x50, 0x25, 0x01,
-    0x7D, 0x8D, 0x7B, 0xFB, 0x9D, 0xD4, 0x06, 0xD3, 0x03, 0x2B, 0xF2, 0x7D, 0x9E, 0x36, 0x27, 0x26,
-    0x8D, 0xA4, 0x96, 0xB5, 0xCE, 0xF8, 0x80, 0xA0, 0x54, 0x4B, 0x81, 0x67, 0xEE, 0x44, 0x23, 0x73,
-    0x7C, 0xA0, 0x0D, 0x4B, 0x24, 0x71, 0x9C, 0x46, 0x8C, 0x29, 0x75, 0x43, 0xC6, 0x02, 0xF6, 0x50,
-    0xB3, 0xCF, 0x93, 0x69, 0x32, 0x3A, 0xD0, 0x5A, 0xA0, 0x99, 0x0D, 0x9B, 0xF3, 0x50, 0x93, 0xF2,
-    0xC5, 0x8C, 0x87, 0xE1, 0x8C, 0x87, 0xCE, 0x88, 0xD4, 0x64, 0xEB, 0x88, 0xE3, 0xA9, 0x65, 0x61,
-    0x63, 0xF0, 0x47, 0x3A, 0x5E, 0xB8, 0x4B, 0xA4, 0x5A, 0x42, 0xB5, 0x89, 0x3C, 0x5B, 0x28, 0x0E,
-    0xA0, 0x3B, 0x86, 0x71, 0x25, 0xC0, 0x8B, 0xC9, 0xC8, 0x5A, 0xDA, 0x85, 0xA6, 0x4C, 0xB1, 0x9D,
-    0x45, 0x28, 0xC4, 0xEE, 0x07, 0x32, 0x67, 0x29, 0x6C, 0x18, 0x9B, 0x13, 0x69, 0x52, 0x1A, 0x0A,
-    0xCD, 0x76, 0xD5, 0xD3, 0xC7, 0x06, 0xC4, 0x77, 0xE9, 0xC5, 0x9F, 0x6F, 0x05, 0xEB, 0x5F, 0x17,
-    0x3F, 0xE6, 0x9A, 0x06, 0x8D, 0xB5, 0x14, 0xE0, 0xE8, 0x18, 0x9B, 0x6D, 0x94, 0x0E, 0x6F, 0x6F,
-    0x13, 0xE5, 0xA9, 0x4E, 0xE4, 0x31, 0x51, 0x97, 0x86, 0x6E, 0x0C, 0xC3, 0x7E, 0x83, 0x3A, 0x33,
-    0x64, 0x22, 0x26, 0x49, 0x0E, 0x92, 0x95, 0xC9, 0xAD, 0x73, 0x1B, 0x89, 0xBA, 0x25, 0x1C, 0xB9,
-    0x9F, 0x55, 0xE1, 0xCF, 0xDD, 0xE9, 0xD1, 0xCB, 0xDE, 0xEB, 0xC1, 0x06, 0x77, 0x5E, 0x7C, 0xCB,
-    0x67, 0x61, 0xF5, 0x71, 0x52, 0x45, 0x3D, 0x42, 0xE7, 0x0E, 0x26, 0x99, 0x39, 0x93, 0xD2, 0x29,
-    0x93, 0x94, 0x5F, 0x8B, 0x4C, 0xEA, 0xE7, 0x4C, 0x9A, 0xCC, 0x99, 0xA4, 0xFC, 0x6A, 0x34, 0x2C,
-    0x24, 0x3E, 0xC7, 0xF8, 0x04, 0x95, 0x3E, 0x48, 0xA7, 0x4F, 0x19, 0x59, 0x89, 0x90, 0xEA, 0x53,
-    0x54, 0xED, 0xBE, 0x4F, 0x50, 0x3D, 0x30, 0x87, 0xBE, 0x69, 0xDC, 0x94, 0x3A, 0x9C, 0x8B, 0x11,
-    0x89, 0x30, 0x69, 0x08, 0x36, 0xCE, 0x67, 0x51, 0xC6, 0x2F, 0x8A, 0x5C, 0xD1, 0x8A, 0xB9, 0x95,
-    0xB9, 0x18, 0xA6, 0x26, 0xDE, 0x52, 0xAE, 0x89, 0x5C, 0xA5, 0x9F, 0x83, 0x5C, 0xA1, 0x1B, 0x0A,
-    0x67, 0xF2, 0xE5, 0x28, 0x97, 0x7F, 0x5D, 0x00, 0x9D, 0xB4, 0xCC, 0x53, 0xB2, 0xC7, 0x29, 0xE3,
-    0x1A, 0x66, 0xF4, 0x1A, 0xB3, 0x14, 0xA7, 0xFF, 0x07, 0x6D, 0x54, 0xCF, 0x6B, 0xDC, 0x46, 0x14,
-    0xFE, 0x66, 0xA7, 0xB1, 0x62, 0xCB, 0xF6, 0xF8, 0xE0, 0x86, 0xE2, 0x5F, 0xEA, 0xC1, 0x01, 0x07,
-    0x4C, 0x04, 0x25, 0x87, 0x3D, 0x6C, 0xAC, 0xA9, 0x7D, 0xE8, 0xAD, 0xEC, 0xC1, 0xEE, 0xB5, 0x7B,
-    0xE9, 0x21, 0x1B, 0x42, 0x7C, 0xAB, 0x31, 0xEB, 0xAC, 0x42, 0xEE, 0xC1, 0x7F, 0xC2, 0x52, 0x12,
-    0x48, 0x7D, 0x89, 0x49, 0x5A, 0x28, 0x74, 0xBB, 0x9A, 0x7A, 0xA1, 0x86, 0x18, 0x1A, 0x95, 0x42,
-    0x7B, 0xC8, 0x45, 0x97, 0xD2, 0x43, 0x0F, 0x55, 0x40, 0x0D, 0xB2, 0x91, 0xF6, 0xF5, 0x49, 0xEB,
-    0x04, 0x07, 0xFB, 0xF1, 0xD0, 0x9B, 0x19, 0x3D, 0xF1, 0xBE, 0xF7, 0xBD, 0x6F, 0xE4, 0x01, 0x39,
-    0x64, 0x0A, 0x15, 0x43, 0x68, 0xB1, 0x5B, 0xB3, 0x4C, 0xE2, 0xC8, 0x18, 0x35, 0x20, 0x80, 0x20,
-    0xDF, 0xEA, 0x47, 0x0B, 0xD8, 0x5A, 0xC4, 0xA8, 0x6D, 0x96, 0x7F, 0x34, 0xCF, 0xFB, 0xFD, 0x87,
-    0x56, 0x5E, 0xB5, 0x22, 0x14, 0xF6, 0xE1, 0x2A, 0x51, 0xE6, 0x11, 0x85, 0x38, 0xB5, 0xE6, 0x53,
-    0xA2, 0x35, 0x22, 0x1A, 0x94, 0xBB, 0xEF, 0x30, 0xB9, 0x85, 0xF9, 0x9B, 0x68, 0xB9, 0x94, 0xDA,
-    0x14, 0xE1, 0x5B, 0xB8, 0x0F, 0x32, 0xEF, 0x30, 0x6B, 0x1B, 0x47, 0xBB, 0x6B, 0xA9, 0x4C, 0x3D,
-    0xE3, 0xF5, 0x33, 0x8B, 0xF7, 0x81, 0x71, 0xA3, 0xFB, 0x91, 0xF4, 0xB7, 0xA4, 0x0F, 0xD8, 0xE1,
-    0xFE, 0xEF, 0x9F, 0xFE, 0x6A, 0x3B, 0xC9, 0x8C, 0x86, 0x32, 0xEC, 0x56, 0x0C, 0x2B, 0xAA, 0xA4,
-    0x60, 0x1F, 0x40, 0x0C, 0x30, 0x8D, 0xC2, 0xAB, 0x98, 0x57, 0x48, 0xE4, 0xDF, 0x21, 0x48, 0xE3,
-    0x1E, 0xB0, 0x34, 0x3C, 0x2F, 0xF2, 0x12, 0xD8, 0x31, 0xEC, 0x08, 0x4E, 0x08, 0x37, 0xC4, 0x6D,
-    0xCD, 0x1E, 0xFC, 0x46, 0x6B, 0xB9, 0x4A, 0xDD, 0xA8, 0x6D, 0x68, 0xB5, 0x84, 0xA7, 0x32, 0x95,
-    0xAA, 0xC4, 0x89, 0x9D, 0xD8, 0x8D, 0xBC, 0xB0, 0x6D, 0x50, 0xA1, 0xCF, 0x72, 0x95, 0x78, 0x51,
-    0xDB, 0x27, 0x99, 0xDB, 0x69, 0x45, 0xFF, 0xB5, 0x3D, 0x90, 0x7E, 0x84, 0xC6, 0xB2, 0xFD, 0xC5,
-    0x60, 0x7F, 0x19, 0xE8, 0x3D, 0xAE, 0x07, 0x94, 0x5F, 0xDA, 0xF8, 0x09, 0xB8, 0x59, 0xFA, 0x0A,
-    0xFB, 0xE4, 0xD8, 0xE4, 0xFC, 0x0F, 0x8D, 0xF9, 0x17, 0x4B, 0xB5, 0xA9, 0x11, 0xCC, 0x61, 0xD3,
-    0xCD, 0x9A, 0x9D, 0xE0, 0x75, 0xCF, 0xDF, 0x14, 0x46, 0x70, 0x95, 0xC6, 0x88, 0x3D, 0x18, 0x41,
-    0xE3, 0x1D, 0x5B, 0x6D, 0x22, 0xC3, 0x6B, 0x67, 0x2D, 0xE5, 0xD6, 0xDB, 0xC6, 0xF5, 0x99, 0x92,
-    0x92, 0x88, 0xC3, 0x92, 0x88, 0xB6, 0x39, 0xDB, 0xFD, 0x79, 0x8C, 0x98, 0x92, 0x68, 0xD8, 0x09,
-    0xC2, 0x89, 0xDB, 0x2F, 0xA3, 0x8A, 0x8E, 0x6A, 0x16, 0xF6, 0xAD, 0x9C, 0x5B, 0xAD, 0xB5, 0x5A,
-    0xAD, 0x6E, 0xB7, 0xFB, 0x64, 0x6F, 0xEF, 0x2E, 0xFD, 0xA3, 0xB7, 0xC3, 0x85, 0x47, 0x23, 0x9A,
-    0x87, 0xC6, 0xA3, 0xE3, 0x01, 0xF2, 0x18, 0x79, 0x98, 0xC5, 0x48, 0xC7, 0x0A, 0x7A, 0x61, 0x65,
-    0xB0, 0x5E, 0x19, 0xCB, 0x6F, 0xD9, 0xBA, 0x62, 0x2E, 0x98, 0x2B, 0x88, 0xFE, 0xD8, 0x7B, 0x5C,
-    0x2C, 0xDC, 0x02, 0x71, 0xCA, 0x8B, 0x73, 0x59, 0x01, 0xD1, 0x11, 0xF7, 0xC3, 0xC1, 0x74, 0x3A,
-    0x47, 0xDF, 0xEB, 0xBA, 0xB8, 0x23, 0xB8, 0xF0, 0x49, 0x2F, 0xE0, 0x62, 0xFC, 0xDD, 0x0B, 0x7C,
-    0xE2, 0x8F, 0x77, 0xE4, 0x12, 0x8E, 0x28, 0xDE, 0x58, 0xBF, 0x3E, 0x3A, 0x57, 0xFD, 0x65, 0xFC,
-    0xEA, 0x83, 0xB1, 0xCE, 0x81, 0x3F, 0x55, 0x5F, 0xAC, 0x7F, 0x8D, 0x7D, 0x19, 0x5E, 0x3B, 0x38,
-    0x38, 0x5F, 0xBD, 0xD3, 0x9D, 0x98, 0xAB, 0x73, 0x00, 0xAE, 0x03, 0x92, 0x95, 0xD5, 0x65, 0x1A,
-    0x7C, 0x88, 0xE4, 0xAD, 0xC6, 0xCE, 0x6B, 0xE7, 0x6C, 0xCF, 0x80, 0xA8, 0x04, 0x25, 0xCD, 0x3F,
-    0xAF, 0xE3, 0x3D, 0xBB, 0xB4, 0xEE, 0x12, 0x1D, 0x32, 0xE4, 0x62, 0x53, 0xC3, 0x7F, 0xB1, 0xFC,
-    0xD3, 0x38, 0x5F, 0x62, 0xA7, 0x2B, 0xDE, 0xC4, 0xF6, 0x2B, 0xE3, 0x36, 0x71, 0xEB, 0x2B, 0x4E,
-    0x61, 0xB8, 0xC8, 0xE0, 0x69, 0x15, 0x56, 0x18, 0x43, 0x1D, 0x12, 0x3C, 0x55, 0x86, 0x23, 0xB5,
-    0x3B, 0xF7, 0xEC, 0xDF, 0x6F, 0x5E, 0xAA, 0xCF, 0xAB, 0x4E, 0x12, 0x05, 0x3E, 0x2B, 0x75, 0x02,
-    0xD8, 0xC4, 0x30, 0x96, 0x66, 0x95, 0xF7, 0xC0, 0x2E, 0x39, 0x54, 0xC3, 0x67, 0xCC, 0xAA, 0x62,
-    0xE4, 0xB9, 0x3A, 0x09, 0x34, 0x72, 0xCF, 0xA8, 0x44, 0x64, 0x9E, 0x2F, 0xE8, 0x69, 0xDA, 0xF6,
-    0x31, 0x4B, 0xBB, 0x17, 0x7F, 0x33, 0xB4, 0x0A, 0x8B, 0x7D, 0xF5, 0x24, 0x41, 0x9C, 0x2A, 0xDD,
-    0xDA, 0x11, 0xC9, 0x8A, 0x0B, 0xC5, 0x52, 0x47, 0xB3, 0x7C, 0x2B, 0x98, 0x24, 0x49, 0x46, 0xF6,
-    0xE3, 0xAE, 0x88, 0x13, 0xDB, 0x74, 0x77, 0xD0, 0xCB, 0xAF, 0xC0, 0x1A, 0x9C, 0x69, 0x59, 0x68,
-    0x8D, 0xC0, 0xE2, 0x5B, 0xE1, 0xB1, 0x72, 0x3E, 0x3E, 0x3D, 0x9C, 0x6E, 0x7D, 0x34, 0x5D, 0x2F,
-    0x16, 0x97, 0x6F, 0x14, 0xCF, 0x1B, 0x93, 0x45, 0xA9, 0x50, 0x1C, 0x43, 0xF0, 0x25, 0x9A, 0x25,
-    0xC6, 0x74, 0x6A, 0x33, 0x34, 0xD8, 0x85, 0x38, 0xD6, 0xA2, 0x07, 0xA5, 0x8B, 0x9C, 0x6A, 0x99,
-    0x5F, 0x6A, 0x79, 0xFC, 0x4C, 0x95, 0x0F, 0x86, 0x41, 0xF9, 0xAC, 0x05, 0xB6, 0x74, 0x18, 0xB2,
-    0xE1, 0xE1, 0xF0, 0xD7, 0xF0, 0x96, 0x21, 0xFC, 0x0F, 0xCD, 0x7C, 0x3B, 0x90, 0xDD, 0x56, 0x9A,
-    0xDE, 0x01, 0x20, 0x12, 0x35, 0x82, 0xBD, 0x50, 0x20, 0xB9, 0xC6, 0xA2, 0x67, 0xB0, 0xC1, 0xBA,
-    0xCA, 0x9E, 0x15, 0x89, 0x74, 0x82, 0xEE, 0x3E, 0x90, 0x14, 0xA8, 0xCA, 0x0A, 0xD8, 0xDE, 0x62,
-    0xCB, 0x55, 0x56, 0xC0, 0xF1, 0xD6, 0x06, 0x3B, 0x5A, 0x97, 0x7B, 0x03, 0x05, 0x0A, 0xBA, 0x1B,
-    0xD0, 0x30, 0x60, 0xA0, 0x80, 0x74, 0xB9, 0xE4, 0xC0, 0x89, 0x18, 0x68, 0xD7, 0x12, 0xE9, 0x32,
-    0x15, 0xC8, 0x65, 0xDA, 0x75, 0xBB, 0x01, 0x89, 0xE5, 0x62, 0xD5, 0x32, 0x20, 0x24, 0x79, 0x4B,
-    0x81, 0x02, 0x42, 0x43, 0x6A, 0x39, 0x2B, 0x05, 0x04, 0x29, 0x48, 0x02, 0xBB, 0x01, 0x1C, 0x7F,
-    0xDF, 0x7F, 0x70, 0x6F, 0x3F, 0xD8, 0x6C, 0x71, 0x77, 0x28, 0xCF, 0x76, 0x5F, 0x9C, 0x83, 0xC7,
-    0xBD, 0xC0, 0x79, 0xFC, 0x8F, 0xEF, 0x7F, 0x1C, 0x28, 0xA5, 0x54, 0x58, 0x60, 0x2B, 0xB1, 0x55,
-    0x4A, 0x05, 0xB5, 0xDA, 0xF1, 0xB7, 0xB4, 0xB4, 0xF4, 0x47, 0xC6, 0x98, 0xAB, 0xD8, 0x62, 0x1C,
-    0x4E, 0x94, 0x72, 0x71, 0x3D, 0xC0, 0xF7, 0xA7, 0x87, 0xF7, 0x96, 0x96, 0x02, 0x63, 0xFA, 0xD8,
-    0x98, 0x66, 0xFF, 0xAB, 0x2F, 0xF2, 0xB7, 0xC6, 0x74, 0xB9, 0x31, 0x77, 0xB1, 0x5B, 0xF0, 0xB6,
-    0xC7, 0xD4, 0xBC, 0x6A, 0x55, 0xE3, 0x55, 0x5E, 0x39, 0x3E, 0xE8, 0x10, 0x9E, 0x34, 0xFD, 0xD6,
-    0x9E, 0x7B, 0x4C, 0x0F, 0xDF, 0x5C, 0x5A, 0xC4, 0xD5, 0x8F, 0x71, 0x8F, 0x17, 0xF7, 0xBD, 0x7A,
-    0x62, 0x7C, 0xC2, 0xD5, 0xF1, 0x81, 0xBC, 0xED, 0x93, 0x2A, 0xC4, 0x91, 0x51, 0x31, 0xCB, 0x44,
-    0xA9, 0x75, 0x79, 0xD8, 0x83, 0xCA, 0x8D, 0xFB, 0xCA, 0xFC, 0x62, 0xCF, 0x52, 0x9A, 0x6D, 0xCA,
-    0x08, 0x0F, 0x33, 0xCA, 0x6D, 0x95, 0x1A, 0x94, 0xC2, 0xFD, 0x7B, 0x69, 0x02, 0xCA, 0x15, 0x39,
-    0x5C, 0xD9, 0x3E, 0xE3, 0xC8, 0x55, 0x2D, 0xDF, 0xD4, 0xB5, 0x94, 0x99, 0x52, 0x7F, 0xA2, 0x94,
-    0x87, 0x1B, 0x45, 0xB8, 0x65, 0xA3, 0x94, 0x8F, 0x5D, 0xAD, 0x1E, 0xF0, 0xF7, 0xD4, 0xD2, 0xD2,
-    0xBF, 0x46, 0x93, 0x6F, 0x61, 0x7B, 0x0B, 0xDF, 0x4B, 0x95, 0xDC, 0xD2, 0xC7, 0xAD, 0xA2, 0x7D,
-    0x0E, 0x13, 0xE5, 0xE2, 0xC9, 0x01, 0x6E, 0x1A, 0x63, 0x40, 0x73, 0x1C, 0xA2, 0x81, 0x01, 0x9E,
-    0x1E, 0x63, 0x46, 0xF3, 0x4C, 0x0E, 0xC7, 0xBF, 0xC3, 0xE6, 0x2C, 0x7E, 0x60, 0x7A, 0x9C, 0x7B,
-    0x36, 0x4F, 0x30, 0xDB, 0x61, 0x89, 0x5B, 0xF8, 0xB5, 0xC6, 0x8F, 0x5A, 0x36, 0xE7, 0xED, 0x8D,
-    0xD9, 0x80, 0xC8, 0x74, 0x6D, 0x17, 0x32, 0xA2, 0x72, 0x27, 0x23, 0x63, 0x53, 0xAA, 0xC3, 0xEF,
-    0xA6, 0xC3, 0x7F, 0xC9, 0x3B, 0x8D, 0xCB, 0x1D, 0x87, 0xB8, 0xE5, 0x68, 0xD7, 0xAE, 0x7C, 0xFB,
-    0x0F, 0xCD, 0xBD, 0xE9, 0x33, 0xFF, 0xC9, 0x12, 0x8A, 0x98, 0x27, 0x3D, 0x4E, 0x86, 0xD2, 0x9C,
-    0x1D, 0xC7, 0xDC, 0x54, 0x8B, 0xD2, 0x48, 0x9C, 0x10, 0xAA, 0xE0, 0x50, 0x2B, 0xAF, 0x61, 0x19,
-    0x0A, 0x15, 0xC6, 0x43, 0xC2, 0x8B, 0x72, 0x23, 0xFC, 0x06, 0x23, 0x18, 0x19, 0x83, 0x1E, 0x39,
-    0xB9, 0xE1, 0x75, 0x5F, 0x4A, 0x8F, 0x67, 0xB0, 0xCF, 0x5B, 0x44, 0x46, 0x3D, 0x81, 0xD6, 0x75,
-    0xAE, 0x39, 0x8F, 0xAF, 0x44, 0x9C, 0xF4, 0x8C, 0x45, 0x27, 0x54, 0x90, 0xB1, 0x9D, 0x8D, 0x3A,
-    0x62, 0xF0, 0xE4, 0xF1, 0xEF, 0xFC, 0x8B, 0x4D, 0xFE, 0x62, 0x93, 0xBE, 0xB0, 0xFB, 0x73, 0xBA,
-    0xE5, 0xE7, 0x6A, 0x97, 0x5F, 0xED, 0xCC, 0xB5, 0xCE, 0x14, 0x71, 0xA6, 0x9F, 0x6F, 0xBD, 0x56,
-    0x17, 0xFA, 0x4A, 0xE7, 0x77, 0x69, 0x91, 0x16, 0xF7, 0x4F, 0xD8, 0xD3, 0x67, 0x65, 0x0E, 0x30,
-    0xFE, 0xAC, 0xA2, 0x52, 0x39, 0xDF, 0x57, 0x55, 0xCA, 0x19, 0xB6, 0xAB, 0x5A, 0xB9, 0x18, 0x99,
-    0xD8, 0x56, 0x20, 0x19, 0xCF, 0x56, 0xCA, 0x79, 0x97, 0x37, 0xC4, 0xC7, 0xB3, 0x9F, 0xEE, 0xC0,
-    0x4F, 0x3B, 0x7E, 0x7C, 0xFB, 0x69, 0xB6, 0x3F, 0x9C, 0xE9, 0xFA, 0x89, 0xB4, 0x4E, 0x4D, 0x95,
-    0x9A, 0x32, 0x35, 0x59, 0x3A, 0xA8, 0x74, 0x3A, 0x0E, 0x87, 0x92, 0xE9, 0x6C, 0xCF, 0xAA, 0x46,
-    0xE8, 0x73, 0x4F, 0x55, 0x3F, 0xA0, 0x32, 0x9B, 0xB6, 0xC2, 0x54, 0xF0, 0xA4, 0xDB, 0x3A, 0xA8,
-    0x4A, 0xB5, 0x6A, 0xAB, 0x05, 0x5B, 0xC5, 0x6E, 0xA5, 0x82, 0x59, 0xA5, 0x3D, 0x56, 0xCE, 0xC0,
-    0x0A, 0xF2, 0x03, 0xD7, 0x51, 0x75, 0x5A, 0xAA, 0x1A, 0x03, 0x1C, 0x98, 0x21, 0xF9, 0xE7, 0xB6,
-    0x75, 0x4F, 0x4A, 0x89, 0x9B, 0xA8, 0x4B, 0xC2, 0x35, 0xB8, 0x01, 0x79, 0x88, 0x6C, 0xBF, 0x22,
-    0x82, 0x80, 0x97, 0x26, 0xF6, 0x52, 0xBD, 0xF7, 0x12, 0x27, 0xDE, 0x9C, 0xF3, 0xA5, 0x6A, 0x22,
-    0xCA, 0x3A, 0xBF, 0x91, 0x4B, 0xEE, 0x9D, 0x9A, 0x5C, 0xEB, 0x7D, 0x0A, 0xAA, 0xC4, 0xD8, 0x9C,
-    0x14, 0x31, 0xB8, 0xB0, 0x42, 0x9E, 0x74, 0xEE, 0xC9, 0xA5, 0xE8, 0x53, 0x4B, 0xB0, 0xFC, 0x15,
-    0x7E, 0xBC, 0x22, 0x44, 0xF8, 0x3A, 0x65, 0x80, 0x39, 0x07, 0x16, 0xE2, 0x40, 0xED, 0x2C, 0x5F,
-    0x39, 0xA1, 0xB3, 0x25, 0x0C, 0x24, 0x39, 0x7D, 0x56, 0x26, 0xF7, 0x95, 0x6F, 0x0C, 0x96, 0x9A,
-    0xC9, 0xB7, 0x86, 0x14, 0x9C, 0xB6, 0x98, 0x1E, 0x95, 0x96, 0x0E, 0x58, 0x21, 0x15, 0x2E, 0x4B,
-    0x33, 0x76, 0x27, 0xB7, 0x65, 0xB1, 0xAB, 0xEC, 0x76, 0x94, 0x20, 0x22, 0x33, 0x96, 0xCE, 0xAC,
-    0xFC, 0x11, 0x1F, 0x72, 0x94, 0xC5, 0x1C, 0x8B, 0x4B, 0xCA, 0x0A, 0x1B, 0x19, 0x99, 0xFD, 0xFE,
-    0xFC, 0xDA, 0x31, 0x28, 0x40, 0x5A, 0x41, 0x0D, 0x92, 0x09, 0x6A, 0xB0, 0x5E, 0x50, 0x43, 0x6E,
-    0x84, 0x9C, 0x85, 0xB0, 0x82, 0xD4, 0x0C, 0x3F, 0x47, 0x93, 0xC3, 0x1B, 0x78, 0x68, 0xF8, 0x55,
-    0xCB, 0xB1, 0xE0, 0x20, 0x9B, 0x92, 0x85, 0xB0, 0x64, 0x42, 0xE6, 0xA6, 0x0C, 0xE6, 0x85, 0x98,
-    0x82, 0x57, 0x5F, 0x23, 0xF5, 0x5E, 0xC6, 0x49, 0xFD, 0x01, 0x4E, 0xEA, 0x22, 0xEF, 0x50, 0x68,
-    0x83, 0xFE, 0x85, 0x18, 0xAE, 0xC2, 0xE7, 0x14, 0xBB, 0xF8, 0xE6, 0x9F, 0x0A, 0xB3, 0x97, 0x33,
-    0xC1, 0x62, 0xF9, 0xFE, 0x95, 0xFB, 0x9B, 0x29, 0xA7, 0xC0, 0x39, 0xCA, 0x70, 0xB0, 0xF2, 0x0F,
-    0x7A, 0x72, 0x07, 0xC6, 0x38, 0xEE, 0xA0, 0xB4, 0x42, 0xF3, 0x3C, 0x5A, 0x6E, 0x4A, 0x83, 0xE9,
-    0x6A, 0x74, 0xE1, 0x0E, 0x03, 0xEE, 0x63, 0xD2, 0x53, 0x9D, 0x4A, 0xDF, 0xAA, 0x8C, 0x02, 0xD7,
-    0xEA, 0x22, 0xFA, 0xDC, 0x84, 0x0D, 0xFA, 0xF4, 0x61, 0xEF, 0xB7, 0x51, 0x9D, 0x3F, 0x0F, 0x46,
-    0x8E, 0x3F, 0x1A, 0x1C, 0x13, 0xB4, 0x68, 0xD5, 0xC7, 0x43, 0x9A, 0x45, 0x4D, 0x9A, 0x17, 0x7E,
-    0x1F, 0x99, 0xCA, 0x31, 0xA7, 0x21, 0x26, 0xD2, 0xCF, 0xD1, 0xBE, 0xA8, 0xD5, 0x3D, 0xE8, 0x3A,
-    0x34, 0x20, 0xA4, 0xC2, 0x4D, 0xD4, 0x39, 0xC8, 0xEF, 0xDA, 0x2B, 0x5D, 0x7C, 0x07, 0x9D, 0xCB,
-    0xD1, 0x75, 0x2B, 0xC0, 0x76, 0xFD, 0x61, 0xA6, 0x56, 0xD7, 0x50, 0x41, 0x9A, 0x76, 0x51, 0xE6,
-    0xB4, 0x61, 0xE9, 0xB6, 0x18, 0xE1, 0xC6, 0x6B, 0xBD, 0xDA, 0xE9, 0xC0, 0x88, 0x03, 0xDA, 0x9C,
-    0x1E, 0x07, 0x0F, 0x5C, 0x2F, 0x30, 0x7C, 0x18, 0x65, 0x8C, 0xA3, 0x8F, 0x7B, 0x91, 0xE7, 0xC9,
-    0xFE, 0x14, 0x08, 0x98, 0x10, 0xE5, 0x63, 0x28, 0xE3, 0x56, 0xC6, 0x55, 0x73, 0x2C, 0x71, 0x5A,
-    0x83, 0xF6, 0x4F, 0x40, 0x3D, 0xC4, 0x78, 0xF2, 0x67, 0x90, 0x35, 0xDF, 0x62, 0x34, 0xD6, 0x21,
-    0xAC, 0xE3, 0xE5, 0xBF, 0xE7, 0x09, 0x50, 0xEE, 0xB7, 0xD8, 0xFA, 0x5C, 0x14, 0x24, 0x3B, 0xB3,
-    0xC0, 0x79, 0xC0, 0xC4, 0x7A, 0x94, 0xAB, 0x3C, 0xF1, 0xD4, 0xF6, 0x24, 0xE5, 0x99, 0x48, 0x5C,
-    0x99, 0x0C, 0x11, 0xD7, 0x1B, 0x54, 0x0A, 0xDE, 0xD7, 0x9C, 0xB6, 0xE8, 0x0D, 0xFE, 0xA0, 0xA7,
-    0x42, 0xF2, 0xA8, 0x4E, 0x54, 0x9C, 0x51, 0x95, 0xF4, 0x56, 0x53, 0x51, 0xAE, 0xC7, 0x19, 0xD1,
-    0x45, 0xAF, 0x44, 0xE1, 0x90, 0x43, 0xF0, 0xC9, 0x45, 0xEE, 0xF7, 0x64, 0x7B, 0x8C, 0x37, 0x25,
-    0x74, 0x2D, 0x3C, 0x5B, 0x89, 0xC8, 0x2E, 0xA8, 0x19, 0xCC, 0x73, 0xE8, 0xB8, 0x3B, 0x84, 0xD4,
-    0x99, 0x1D, 0x65, 0x6F, 0xD8, 0xE4, 0xB6, 0xD5, 0x57, 0xF1, 0xC4, 0x78, 0x1F, 0x7D, 0x68, 0x7E,
-    0x83, 0x7B, 0xF4, 0x60, 0xEB, 0x75, 0xF0, 0xF4, 0x0A, 0xE6, 0xA1, 0x01, 0xA3, 0xDF, 0x00, 0x97,
-    0x9F, 0x29, 0xD4, 0x9A, 0x4E, 0x8E, 0x34, 0xF8, 0xED, 0x65, 0x63, 0x06, 0x3C, 0xA3, 0xD2, 0xA6,
-    0xC5, 0x44, 0xDE, 0xA4, 0x92, 0xC7, 0xCC, 0x45, 0xC5, 0x44, 0x79, 0xE5, 0x04, 0x32, 0x66, 0x02,
-    0xB1, 0x62, 0x6B, 0xAF, 0x5C, 0x5F, 0x5A, 0xCE, 0x72, 0xE8, 0x4C, 0x7C, 0x27, 0x9B, 0x40, 0xCF,
-    0x62, 0x86, 0x3B, 0x6C, 0xEB, 0xD8, 0x06, 0x6E, 0xEB, 0xEA, 0xE5, 0x21, 0xB7, 0xE8, 0xA5, 0xC5,
-    0x56, 0xE6, 0x50, 0x59, 0x3F, 0x84, 0x06, 0x17, 0x1D, 0x4A, 0x01, 0xA9, 0xDC, 0xCD, 0xF3, 0x3D,
-    0x65, 0x14, 0xE8, 0x40, 0x53, 0x9C, 0x86, 0x85, 0xDB, 0x50, 0x8E, 0xAD, 0x73, 0xCA, 0x70, 0x72,
-    0x41, 0x4E, 0x66, 0xC0, 0x2A, 0x98, 0xC6, 0x0D, 0x39, 0x99, 0xF1, 0x64, 0xA5, 0xA2, 0x04, 0x27,
-    0x71, 0x71, 0x83, 0x0F, 0x8F, 0x0B, 0x8F, 0x3C, 0x4F, 0xF5, 0xD2, 0x71, 0x06, 0xCC, 0x1D, 0x16,
-    0x2D, 0xA7, 0xA1, 0xE7, 0x8C, 0xEB, 0xE7, 0xC8, 0xF0, 0xC5, 0x1A, 0x5B, 0xFA, 0x43, 0x60, 0x41,
-    0x03, 0xC5, 0x87, 0xAE, 0x41, 0x04, 0xE9, 0x0C, 0x3C, 0x0B, 0xA2, 0x1F, 0x14, 0x19, 0xA1, 0xF3,
-    0x5A, 0x12, 0x7F, 0xD0, 0x86, 0x15, 0x29, 0x20, 0xAC, 0xF5, 0xAF, 0x38, 0x00, 0x51, 0x65, 0x44,
-    0x42, 0xE8, 0x4F, 0x3B, 0x4A, 0x1D, 0x95, 0x5E, 0xFF, 0x4E, 0x40, 0x49, 0x3E, 0xE2, 0x4A, 0x4C,
-    0xA9, 0xA8, 0x0A, 0x91, 0xAB, 0x24, 0x54, 0xF9, 0x16, 0x46, 0x4C, 0xBE, 0x05, 0xBA, 0x90, 0xDA,
-    0x1F, 0xC1, 0x61, 0x6A, 0x6B, 0xEA, 0x86, 0xD6, 0xCA, 0x64, 0xD6, 0x9E, 0xB9, 0x6D, 0x72, 0xD4,
-    0x7A, 0x48, 0x3B, 0x1C, 0x7B, 0x18, 0x92, 0x3B, 0xA8, 0xB5, 0x09, 0xCC, 0x87, 0xA6, 0x85, 0x80,
-    0x89, 0x8D, 0xC7, 0x11, 0xCA, 0x40, 0x60, 0xA6, 0x3D, 0x0C, 0x95, 0x87, 0x9F, 0x79, 0x9B, 0x17,
-    0x5B, 0x8B, 0x5D, 0xFC, 0xCA, 0xE2, 0x69, 0x70, 0x91, 0xDB, 0x38, 0x4B, 0x79, 0x16, 0x42, 0x96,
-    0x68, 0x62, 0x14, 0xA2, 0xC7, 0x60, 0xBC, 0xCA, 0x31, 0x59, 0x4F, 0x94, 0x7F, 0xB7, 0x52, 0x39,
-    0x06, 0x74, 0xC0, 0xA0, 0xD4, 0x24, 0xC0, 0x65, 0xA0, 0xB3, 0x7F, 0x08, 0xA2, 0xCE, 0xC9, 0xD4,
-    0x1F, 0x28, 0xF5, 0xAA, 0xFA, 0x09, 0xD5, 0x69, 0x08, 0x6A, 0x14, 0xF4, 0x45, 0x21, 0x04, 0xE1,
-    0x94, 0xEC, 0xAF, 0x49, 0x0E, 0x9F, 0xE3, 0xD0, 0xF7, 0x9C, 0x2D, 0x90, 0x73, 0xD0, 0xA1, 0x0B,
-    0x9E, 0x01, 0x79, 0xB9, 0xA6, 0xC0, 0xAC, 0xA0, 0xB5, 0x60, 0xF6, 0x3E, 0xA4, 0x28, 0x7B, 0x1E,
-    0x74, 0x7B, 0x1B, 0xAD, 0x0D, 0xBF, 0x03, 0xA6, 0x0A, 0xBE, 0x41, 0x17, 0xBC, 0x2E, 0xBD, 0xDC,
-    0x39, 0x43, 0x54, 0x9B, 0xC4, 0xA0, 0xB5, 0x65, 0xFA, 0xBA, 0x09, 0xD0, 0x3D, 0x74, 0x21, 0xAA,
-    0xD0, 0x85, 0x33, 0xB5, 0xDF, 0xC7, 0xB7, 0x5A, 0xC7, 0xBC, 0xB0, 0x85, 0x8E, 0x7E, 0x84, 0x59,
-    0x8E, 0xDA, 0xD4, 0x24, 0xFE, 0x00, 0xE9, 0xE9, 0x98, 0x53, 0xD0, 0x45, 0x69, 0x8D, 0x29, 0x8F,
-    0xBA, 0xDF, 0xAD, 0x36, 0x23, 0x19, 0x72, 0x26, 0x89, 0x64, 0x5C, 0x34, 0x14, 0xC2, 0x2D, 0x2A,
-    0xE2, 0x22, 0xA8, 0xC1, 0x61, 0x3C, 0x91, 0x83, 0xE9, 0xE2, 0x82, 0x52, 0x30, 0xAC, 0xDC, 0x0E,
-    0xD4, 0x92, 0xD3, 0x48, 0x28, 0x34, 0x5A, 0x17, 0x16, 0xA0, 0x79, 0xCC, 0xA4, 0xC3, 0x5B, 0xE7,
-    0x24, 0x78, 0x9C, 0xC8, 0x41, 0x5B, 0xC0, 0x80, 0xFA, 0xAF, 0x16, 0x49, 0x9E, 0x80, 0x8D, 0x26,
-    0x42, 0x8B, 0xF3, 0x2B, 0x6C, 0xCE, 0x9D, 0xAD, 0x0A, 0x14, 0xB1, 0xDA, 0xA9, 0x30, 0x8F, 0x2E,
-    0x26, 0xC1, 0xF5, 0x2B, 0x37, 0x6A, 0xEF, 0xEB, 0x3B, 0x6D, 0xE7, 0xB4, 0xDD, 0x5A, 0x9C, 0x75,
-    0x3A, 0x3A, 0x55, 0xA7, 0xE1, 0x95, 0xAA, 0xD7, 0xA7, 0xEE, 0xB4, 0xF1, 0xB5, 0xA2, 0x5B, 0xF3,
-    0x4C, 0xAD, 0xE3, 0x0C, 0x10, 0xFD, 0x6A, 0x1D, 0x75, 0xDE, 0xDD, 0x0E, 0x52, 0xBC, 0xCF, 0xC1,
-    0x6C, 0x7A, 0xB9, 0x78, 0x3A, 0x0B, 0x3F, 0x43, 0x67, 0xBD, 0x6F, 0x3B, 0x4E, 0x60, 0x4E, 0xD6,
-    0x48, 0x9E, 0xC6, 0x38, 0xFC, 0x92, 0x06, 0xA1, 0x3E, 0xC5, 0x51, 0xAA, 0xA9, 0x92, 0x3A, 0x91,
-    0xC6, 0xE4, 0x40, 0x7D, 0x99, 0xE3, 0x57, 0x9B, 0xEF, 0x39, 0x09, 0x96, 0xCF, 0x2F, 0x0B, 0xF2,
-    0x62, 0xD1, 0x93, 0xC3, 0xCC, 0x49, 0x16, 0x9F, 0xB2, 0xF8, 0x06, 0x63, 0xED, 0xF7, 0x29, 0xFB,
-    0x75, 0x92, 0x08, 0xE8, 0x16, 0x51, 0xF1, 0x3D, 0xEA, 0xD4, 0x21, 0xAD, 0x40, 0x36, 0x19, 0x80,
-    0xFE, 0x3D, 0xCB, 0xA7, 0x19, 0x68, 0xFE, 0x36, 0x26, 0x89, 0x14, 0x5B, 0x06, 0x02, 0x76, 0x34,
-    0x39, 0x84, 0x52, 0xC1, 0x91, 0x87, 0x7B, 0x3D, 0x1F, 0xE9, 0x7F, 0x43, 0xAD, 0x14, 0xDE, 0x12,
-    0x21, 0x41, 0xB1, 0xAB, 0xF2, 0x94, 0xE0, 0xA7, 0x27, 0xA3, 0x07, 0xE3, 0x69, 0x6A, 0xB2, 0x81,
-    0xDF, 0x0E, 0x1A, 0x4E, 0x74, 0xFE, 0xA1, 0xF9, 0xC6, 0x59, 0x36, 0x9E, 0x48, 0x3E, 0x11, 0x82,
-    0x05, 0x75, 0xCF, 0x20, 0xA6, 0xA3, 0x45, 0xA7, 0x34, 0x39, 0x76, 0x91, 0xFD, 0x28, 0xEC, 0xBB,
-    0x8D, 0xA5, 0xA5, 0x0E, 0xD2, 0x75, 0xB2, 0x63, 0xEB, 0x76, 0x6C, 0xFD, 0x41, 0x5B, 0xBE, 0x67,
-    0x8B, 0xF0, 0x48, 0xC8, 0xA2, 0xD6, 0x1D, 0x2E, 0x9A, 0x02, 0xD2, 0xB9, 0x83, 0xC4, 0xD6, 0x10,
-    0x18, 0xC1, 0xC7, 0xE0, 0xA1, 0x16, 0x1D, 0xED, 0xA9, 0x31, 0x8F, 0x43, 0x62, 0x70, 0x48, 0x2B,
-    0x6A, 0x4A, 0x0C, 0x68, 0x19, 0x0E, 0xEF, 0x12, 0xFA, 0x5B, 0xA3, 0x8C, 0xDA, 0x91, 0x72, 0x86,
-    0xC2, 0xD3, 0xE1, 0x89, 0xBC, 0x10, 0xA3, 0x42, 0x71, 0xCC, 0x5C, 0xD2, 0x76, 0x5E, 0x6E, 0xF7,
-    0x42, 0x86, 0x77, 0x19, 0x8F, 0x75, 0xD9, 0xC7, 0xD0, 0x2C, 0xFD, 0xA9, 0xD2, 0xC4, 0x8A, 0xC2,
-    0xE6, 0xFC, 0xB5, 0xDC, 0xD7, 0xA7, 0x70, 0x14, 0xB7, 0x80, 0xC8, 0x5E, 0xD2, 0x04, 0xAD, 0x96,
-    0x69, 0x21, 0xAA, 0x9F, 0xBF, 0x8A, 0xF8, 0x65, 0x42, 0x99, 0x43, 0xA1, 0xD9, 0x7C, 0x69, 0x83,
-    0x23, 0x39, 0x70, 0x50, 0x07, 0x47, 0x46, 0x33, 0x67, 0x11, 0x1B, 0xFB, 0xB4, 0xB7, 0x47, 0x79,
-    0x8C, 0xBF, 0xEB, 0x2C, 0xBE, 0x13, 0xFA, 0xF8, 0x8B, 0xC5, 0x5E, 0x2D, 0x8D, 0x40, 0x59, 0xF0,
-    0x86, 0x35, 0x06, 0xFB, 0x19, 0x7A, 0x96, 0x67, 0x7B, 0x6C, 0x8F, 0x23, 0x82, 0x3E, 0xCD, 0xA6,
-    0xCD, 0xF0, 0xB7, 0x4F, 0x0A, 0x46, 0x61, 0x9F, 0x21, 0x83, 0x94, 0x05, 0x54, 0x76, 0x1C, 0xEC,
-    0xC9, 0xB0, 0x9B, 0x41, 0x18, 0xF6, 0xF3, 0x87, 0x06, 0x6B, 0xF6, 0xEF, 0x71, 0x03, 0x44, 0x10,
-    0x6C, 0xE6, 0x17, 0x3A, 0xB7, 0xF1, 0x6A, 0xB7, 0x9E, 0x83, 0xD6, 0x0E, 0x4F, 0x67, 0xE0, 0xF8,
-    0x95, 0xF7, 0xB1, 0xEB, 0x5F, 0xE5, 0xEE, 0x64, 0x85, 0x67, 0xAF, 0xB4, 0x5E, 0xE3, 0x8B, 0x06,
-    0x86, 0x2C, 0xE4, 0x44, 0x7B, 0xA2, 0x97, 0x0E, 0xE7, 0x32, 0x68, 0x32, 0x0C, 0x76, 0x58, 0x52,
-    0xEE, 0xFA, 0x0F, 0xDC, 0xA5, 0xEA, 0x0D, 0x4A, 0x8B, 0x35, 0x40, 0x38, 0xF8, 0x0D, 0x7E, 0x2B,
-    0x80, 0x0B, 0x92, 0x08, 0x6A, 0xD6, 0x9A, 0xA1, 0xC2, 0xAC, 0x9C, 0x5C, 0x48, 0x60, 0x8C, 0x5B,
-    0xB0, 0x65, 0x27, 0x91, 0x83, 0x1F, 0x59, 0xC8, 0x21, 0x9A, 0x54, 0x4E, 0x84, 0xA2, 0x64, 0x73,
-    0x96, 0xFE, 0x20, 0xFA, 0xE0, 0xAE, 0xA1, 0x6A, 0x78, 0x1E, 0x37, 0x89, 0x5A, 0x9F, 0x42, 0xBE,
-    0x00, 0x9D, 0x85, 0x3D, 0xC7, 0x38, 0xA7, 0x78, 0xF2, 0x29, 0xA9, 0x1A, 0xD2, 0x54, 0xCA, 0xDB,
-    0x2C, 0xC2, 0x92, 0x9A, 0x83, 0x95, 0x16, 0xC2, 0x60, 0xF3, 0x8A, 0x55, 0xD8, 0x8C, 0x51, 0xA2,
-    0x56, 0x60, 0xFA, 0x45, 0xCF, 0xC2, 0xC0, 0x2C, 0x57, 0x95, 0xD3, 0xE0, 0xC4, 0x2A, 0xC0, 0x49,
-    0xF4, 0x1C, 0x4F, 0xAC, 0x43, 0x85, 0x02, 0xCB, 0xAC, 0xD3, 0x6A, 0xC4, 0x89, 0xA0, 0xDC, 0x00,
-    0x23, 0x80, 0x2B, 0x36, 0x82, 0xEA, 0xA9, 0xF4, 0x3F, 0x93, 0xAA, 0x88, 0x5A, 0x97, 0xAD, 0xC5,
-    0x2A, 0x06, 0x0E, 0x5B, 0x4F, 0x27, 0x46, 0x94, 0x8D, 0x03, 0x8F, 0xB3, 0xDE, 0x67, 0x78, 0xE2,
-    0xB2, 0x52, 0xF3, 0x98, 0xEA, 0x4D, 0x1C, 0x7E, 0x85, 0x79, 0xBC, 0xA8, 0xD4, 0x1A, 0x00, 0x1E,
-    0x0E, 0x03, 0x1C, 0xEA, 0xB7, 0x32, 0x77, 0xD0, 0x59, 0xDC, 0x92, 0xA7, 0x8C, 0xB9, 0x5D, 0x98,
-    0x36, 0x55, 0x4F, 0x71, 0x98, 0x38, 0x32, 0x04, 0x98, 0xE0, 0xCF, 0xE9, 0xA1, 0xF8, 0x86, 0x9E,
-    0x22, 0xAB, 0xA7, 0x2C, 0xF4, 0xDE, 0x62, 0x65, 0x7D, 0x47, 0xB1, 0xF0, 0x3D, 0xC5, 0x1C, 0x8B,
-    0xF9, 0x59, 0xB1, 0x9A, 0x4F, 0xA1, 0xB8, 0x2D, 0x6C, 0x17, 0x5A, 0x75, 0xC2, 0xAD, 0x83, 0xCA,
-    0xAF, 0x03, 0xE8, 0x8E, 0xB0, 0x88, 0x15, 0x6F, 0x3E, 0x01, 0xDE, 0xEB, 0x70, 0xBA, 0xF4, 0x78,
-    0x3A, 0x09, 0x8B, 0x48, 0x4E, 0xAF, 0xE0, 0x34, 0xAC, 0x6F, 0x9C, 0xAE, 0x7C, 0x7C, 0x33, 0xCC,
-    0x22, 0x50, 0x38, 0x1E, 0x86, 0x71, 0xE0, 0xE9, 0x62, 0xF7, 0xE9, 0x39, 0x9E, 0x56, 0x4D, 0xF0,
-    0xE5, 0x7F, 0xDD, 0xBC, 0x70, 0x53, 0x7C, 0x64, 0x94, 0x6A, 0x16, 0x9C, 0x89, 0xC6, 0x1F, 0x1D,
-    0x41, 0x9E, 0xF4, 0x3B, 0x14, 0x8C, 0x95, 0x4A, 0xA3, 0x4E, 0x80, 0xC8, 0xA7, 0x88, 0x40, 0x0A,
-    0x31, 0x19, 0x0E, 0x28, 0xE8, 0xC4, 0x81, 0x40, 0x25, 0x28, 0x05, 0xEE, 0x0C, 0x69, 0xC3, 0x12,
-    0x9B, 0xB3, 0x98, 0x9F, 0x15, 0xAB, 0xC4, 0xB1, 0x1D, 0xBF, 0x27, 0x45, 0x33, 0xFE, 0x82, 0xEE,
-    0x85, 0x1D, 0x7F, 0xE9, 0x65, 0xE1, 0x2B, 0x23, 0x37, 0xF6, 0xBA, 0x05, 0x69, 0x5B, 0x65, 0x1D,
-    0x49, 0xA7, 0xE4, 0xD2, 0x60, 0x2F, 0xB5, 0xBB, 0x2F, 0x19, 0x8A, 0x70, 0x23, 0xB7, 0xE4, 0xAF,
-    0xC0, 0x1A, 0x61, 0x2D, 0xAD, 0xD0, 0x97, 0x6B, 0x7A, 0x0D, 0x8C, 0x34, 0x03, 0xBA, 0x8B, 0x16,
-    0x33, 0x2F, 0x81, 0x32, 0x79, 0x09, 0x93, 0x6F, 0x8E, 0xB3, 0x49, 0x3E, 0x35, 0x18, 0x88, 0xB3,
-    0x91, 0xA9, 0x49, 0x6F, 0x98, 0x01, 0x2A, 0xCA, 0x0E, 0x53, 0x6B, 0xED, 0x25, 0x3E, 0x77, 0xE1,
-    0xFE, 0x43, 0x63, 0xCE, 0x82, 0x8B, 0x1B, 0x76, 0x5D, 0x63, 0x30, 0x71, 0x27, 0xDC, 0x36, 0x3C,
-    0x8E, 0xC7, 0x69, 0xD0, 0x3C, 0xD0, 0x10, 0x25, 0x3A, 0x3B, 0xAC, 0x85, 0xE9, 0xCF, 0xED, 0xF5,
-    0xD5, 0x39, 0x83, 0x93, 0xCB, 0xB0, 0x55, 0x68, 0xA2, 0xD7, 0x80, 0x05, 0x9C, 0xEE, 0xE9, 0x91,
-    0xDC, 0xED, 0x0C, 0xAD, 0x59, 0xD7, 0xDA, 0x76, 0x31, 0x9D, 0xA9, 0x5C, 0xC6, 0xE3, 0x95, 0xB3,
-    0x60, 0xD9, 0x74, 0xF8, 0xCB, 0xBC, 0xDF, 0xE3, 0xAB, 0xF3, 0x64, 0x9E, 0x97, 0xCD, 0x6F, 0x76,
-    0x8C, 0xAF, 0x43, 0x84, 0x99, 0xF9, 0xB4, 0x71, 0xAB, 0x28, 0x8B, 0xCA, 0xA8, 0x5A, 0xE3, 0x6C,
-    0x7D, 0xD0, 0x42, 0xA4, 0x44, 0xA7, 0x2B, 0x0C, 0x8F, 0x8E, 0x5E, 0xA7, 0x11, 0xB9, 0x86, 0x13,
-    0xCE, 0x37, 0xF4, 0x1A, 0x7A, 0xB7, 0x2A, 0xEA, 0xFE, 0xB7, 0x4E, 0x81, 0x50, 0x16, 0x52, 0xD2,
-    0xC3, 0x3D, 0xB6, 0xC1, 0xBF, 0x55, 0xD1, 0x27, 0x76, 0xF2, 0x79, 0xBA, 0x43, 0x57, 0x21, 0x8E,
-    0xC3, 0x3B, 0x4D, 0x34, 0xBC, 0x64, 0x4E, 0x97, 0x74, 0x01, 0x46, 0x09, 0x87, 0x13, 0x42, 0xCF,
-    0xF4, 0x10, 0x08, 0x47, 0x38, 0x90, 0xCE, 0x2B, 0xE7, 0x89, 0xDE, 0x1B, 0x6A, 0x8B, 0x04, 0x82,
-    0xF7, 0x12, 0xC4, 0x56, 0x90, 0xE1, 0x01, 0x97, 0x40, 0x82, 0xB2, 0x33, 0xA1, 0xC1, 0x52, 0xC4,
-    0x0D, 0xE8, 0x97, 0x7C, 0xEF, 0x71, 0x5E, 0x22, 0xEC, 0x10, 0xD4, 0x3B, 0xE6, 0xCD, 0x1C, 0x16,
-    0xA3, 0xD7, 0x43, 0xFE, 0xE9, 0x32, 0x87, 0x58, 0x26, 0xDC, 0x24, 0x56, 0x1E, 0xA0, 0xA1, 0xF4,
-    0xAF, 0x4D, 0xE2, 0x0D, 0x10, 0x46, 0xFA, 0x06, 0x77, 0xD2, 0xC6, 0x0A, 0x25, 0x9A, 0x96, 0x11,
-    0x24, 0xFA, 0x56, 0xE1, 0x6F, 0xE6, 0xB5, 0x47, 0xA4, 0x86, 0x1F, 0x29, 0xDA, 0x48, 0x73, 0x90,
-    0x3F, 0xA0, 0x8B, 0x35, 0x88, 0xAC, 0xF8, 0x57, 0xF4, 0x9F, 0xAD, 0x42, 0xA5, 0x84, 0xF7, 0x2C,
-    0x56, 0xA0, 0xD7, 0xA7, 0xF6, 0x4D, 0xBF, 0x0A, 0xA9, 0x1F, 0x8D, 0xD8, 0xE0, 0xA5, 0xFF, 0x86,
-    0x1B, 0x0D, 0xC0, 0x2F, 0xFF, 0x5D, 0x44, 0x05, 0x6D, 0x01, 0xB2, 0x0E, 0x3D, 0x3B, 0x6A, 0xFD,
-    0xF0, 0xBB, 0x2A, 0x8E, 0x4D, 0x43, 0xBD, 0xF8, 0x9C, 0x29, 0xD3, 0x3A, 0x07, 0x7A, 0x87, 0xB1,
-    0xA7, 0xAF, 0xE0, 0xCE, 0x77, 0x3A, 0xC8, 0x17, 0xF4, 0x2E, 0x47, 0x9F, 0x69, 0xEA, 0xA4, 0x1C,
-    0x20, 0xDC, 0x5D, 0x94, 0x49, 0x85, 0x21, 0x39, 0xAB, 0xF2, 0xCD, 0x04, 0x33, 0x86, 0x76, 0x4D,
-    0x60, 0xD6, 0x95, 0xAD, 0x3A, 0x86, 0xAA, 0xE2, 0x11, 0x1E, 0xC8, 0xD9, 0x04, 0x7D, 0xB4, 0x30,
-    0x70, 0x33, 0x35, 0x41, 0xD3, 0xAF, 0x65, 0xAA, 0xEB, 0x5F, 0xCA, 0xAF, 0xE1, 0x82, 0xA5, 0xAC,
-    0x64, 0xB4, 0x7B, 0xD0, 0xE8, 0x2B, 0x15, 0xC9, 0x45, 0x1A, 0x98, 0x3F, 0xA8, 0x6A, 0xC4, 0x06,
-    0x95, 0x6A, 0x2A, 0x49, 0x15, 0xA5, 0x6C, 0x44, 0xC7, 0x2D, 0xC0, 0x2A, 0x0C, 0x18, 0xB4, 0xB8,
-    0x86, 0x92, 0xD6, 0x50, 0xCF, 0x5E, 0x85, 0x9D, 0x85, 0xE9, 0xCE, 0x3A, 0xFE, 0xA3, 0x02, 0x12,
-    0xA8, 0xC1, 0x4E, 0x8E, 0x61, 0xCC, 0x47, 0x05, 0x3F, 0x90, 0xF6, 0x3E, 0xC1, 0x13, 0x56, 0xE8,
-    0xBD, 0x28, 0xA0, 0xCE, 0xDE, 0x51, 0x47, 0x5A, 0xDE, 0x38, 0x81, 0xB6, 0x2D, 0x71, 0xD7, 0x1A,
-    0xA3, 0xBD, 0xB2, 0xA0, 0x5E, 0x9A, 0xE0, 0x9B, 0x3D, 0x9A, 0xFA, 0xB7, 0xB0, 0x91, 0x20, 0x14,
-    0xA4, 0xBD, 0xE2, 0x51, 0xC3, 0xEC, 0xFD, 0x98, 0xD2, 0xC1, 0xCE, 0x36, 0x1A, 0x73, 0x64, 0xC8,
-    0x00, 0x99, 0x3B, 0x3E, 0x1B, 0x0A, 0x1B, 0xA3, 0xE7, 0x35, 0x61, 0x91, 0xB2, 0x23, 0x9A, 0x5A,
-    0x32, 0xAC, 0x3A, 0x8A, 0xEF, 0xE8, 0xCA, 0x1D, 0xB2, 0x4A, 0x7C, 0xFD, 0x5A, 0x65, 0x0D, 0x3D,
-    0x8B, 0x3E, 0x1A, 0xDB, 0x2D, 0xE9, 0xA1, 0x35, 0x09, 0x03, 0xB1, 0x04, 0x41, 0x7D, 0x82, 0x79,
-    0xAC, 0x5D, 0x98, 0x4B, 0x15, 0x0E, 0xE6, 0x36, 0xDB, 0xFA, 0x9D, 0xD1, 0x18, 0x66, 0x13, 0x75,
-    0xA8, 0x4C, 0x93, 0x36, 0x29, 0xF8, 0x08, 0xD3, 0x09, 0x8B, 0x71, 0x51, 0xA5, 0xBD, 0x93, 0x1C,
-    0x15, 0xC7, 0xDB, 0x9F, 0x2B, 0xB7, 0x50, 0x47, 0xA1, 0x36, 0xDD, 0x8B, 0x19, 0x35, 0x71, 0x08,
-    0xF5, 0x83, 0xF1, 0xA2, 0xD7, 0x01, 0x76, 0x76, 0xF2, 0x84, 0x98, 0xC4, 0x5E, 0x3B, 0x81, 0x85,
-    0x3B, 0x81, 0xB6, 0x9C, 0x28, 0xBD, 0x32, 0x51, 0xAB, 0xD8, 0xDA, 0x95, 0x89, 0x5B, 0x4F, 0x26,
-    0x7E, 0x39, 0x99, 0x84, 0xC5, 0x64, 0x12, 0xAB, 0xC9, 0x04, 0xCC, 0x37, 0x41, 0x17, 0x37, 0x20,
-    0xEF, 0xA1, 0x54, 0x3B, 0xBA, 0xFF, 0x30, 0x37, 0x9D, 0x9B, 0x3C, 0xA6, 0xBC, 0x4D, 0x7A, 0x02,
-    0x29, 0x68, 0x2C, 0x01, 0x3E, 0x8A, 0xFB, 0x86, 0xE0, 0xB2, 0x79, 0xAF, 0x71, 0x20, 0x65, 0xFC,
-    0x12, 0xA2, 0x09, 0xD0, 0x07, 0x7A, 0xCD, 0xFD, 0x0E, 0x54, 0x0A, 0x2A, 0x62, 0x48, 0x03, 0x04,
-    0x49, 0xA7, 0x7B, 0x78, 0x1B, 0xC0, 0x48, 0x03, 0x24, 0xE9, 0xDA, 0xAF, 0x74, 0x1D, 0x67, 0x69,
-    0xBD, 0xA1, 0xF2, 0x06, 0xE8, 0x8E, 0x9F, 0x3A, 0xE2, 0xA7, 0xB2, 0x9F, 0xD8, 0x2B, 0xA7, 0x9F,
-    0x82, 0x1F, 0xE8, 0x20, 0xD8, 0x41, 0x3A, 0xA1, 0x19, 0x0C, 0x43, 0xE3, 0xF1, 0xB3, 0xB8, 0x73,
-    0x7A, 0x6A, 0xA0, 0x93, 0x07, 0x32, 0xA2, 0xC5, 0x43, 0xF2, 0x9A, 0xB2, 0xE9, 0xF2, 0xED, 0x32,
-    0x32, 0x61, 0x9A, 0xAD, 0x77, 0xAB, 0x29, 0xAC, 0x9B, 0x66, 0x88, 0xCF, 0x5C, 0xF9, 0x75, 0xD7,
-    0xEB, 0x93, 0xA7, 0xB7, 0xEA, 0x7E, 0x23, 0x34, 0xA7, 0xBF, 0xED, 0xA2, 0x3E, 0xFA, 0xAA, 0xD6,
-    0x75, 0x7A, 0xB1, 0xC8, 0x5F, 0x1F, 0x72, 0x20, 0xB6, 0xAD, 0xCE, 0x59, 0x14, 0xDB, 0x2D, 0x2F,
-    0x7E, 0x06, 0xE0, 0x45, 0x89, 0xD4, 0x01, 0xF9, 0x84, 0x97, 0x9B, 0xBD, 0x3B, 0x9F, 0x34, 0x16,
-    0x53, 0x87, 0x9F, 0xB4, 0x80, 0x42, 0x42, 0x9C, 0x53, 0x2A, 0xBD, 0x21, 0x3B, 0x20, 0x73, 0xD8,
-    0x89, 0xCE, 0x74, 0xC7, 0x35, 0x80, 0xD7, 0xC0, 0x43, 0xCB, 0xD4, 0x4B, 0xBD, 0x1A, 0x9C, 0x0E,
-    0x0A, 0x02, 0x5C, 0xEB, 0x7C, 0xD3, 0x40, 0x00, 0x62, 0x92, 0x6F, 0x83, 0xB6, 0x18, 0xFE, 0xE1,
-    0x21, 0x18, 0xF7, 0xCC, 0x70, 0xA1, 0x8F, 0xC4, 0xC3, 0x04, 0xC3, 0x9C, 0x81, 0x07, 0xD1, 0xE7,
-    0x8C, 0x8E, 0x7C, 0x85, 0xED, 0x62, 0xA2, 0x16, 0x20, 0xBA, 0x37, 0xF1, 0xE5, 0xAF, 0xA0, 0xE3,
-    0x6E, 0x63, 0x04, 0xD6, 0xF1, 0x2C, 0xE0, 0x1E, 0x58, 0x76, 0xD1, 0xED, 0x4C, 0xA5, 0x1B, 0x38,
-    0x6C, 0x77, 0x1D, 0x62, 0xB6, 0x7F, 0x76, 0x56, 0xE9, 0xD8, 0x64, 0xDE, 0xD6, 0x66, 0x4E, 0xB8,
-    0xD9, 0x02, 0x82, 0x62, 0x34, 0x4B, 0x35, 0x0F, 0xBD, 0xE9, 0x55, 0xD0, 0x69, 0x0B, 0x8E, 0xEC,
-    0x80, 0x21, 0x79, 0xA9, 0x8C, 0xD1, 0x4C, 0x11, 0x57, 0x68, 0x45, 0xE3, 0x7F, 0x4D, 0x20, 0x8E,
-    0x79, 0x0C, 0xAA, 0x43, 0xD6, 0xE3, 0x4A, 0x98, 0xED, 0x08, 0x6F, 0x14, 0x16, 0xE2, 0x8C, 0xB1,
-    0x98, 0xA9, 0x77, 0x98, 0x12, 0xB6, 0x53, 0xE6, 0x2F, 0xB3, 0xB8, 0x10, 0xD8, 0x99, 0x5A, 0xA9,
-    0xB6, 0x4E, 0x6C, 0x29, 0x6C, 0x49, 0xA8, 0x09, 0x53, 0xCC, 0x35, 0x6F, 0x66, 0xA1, 0xF4, 0xB3,
-    0x1D, 0xC3, 0x36, 0xB9, 0x85, 0x67, 0xC3, 0xA2, 0x5F, 0x3C, 0x46, 0x4D, 0xBA, 0x6B, 0xE3, 0x8F,
-    0xE9, 0x0B, 0xD9, 0xBB, 0x11, 0xE0, 0xD3, 0xCA, 0xC0, 0x86, 0x7B, 0x6B, 0x48, 0xC4, 0x35, 0x40,
-    0xB9, 0x75, 0xB4, 0x12, 0xA6, 0xBD, 0x82, 0xC9, 0xEC, 0xB6, 0x0E, 0x0D, 0xE7, 0x01, 0x62, 0x35,
-    0x7D, 0x01, 0x63, 0x7C, 0x8D, 0x83, 0x53, 0x09, 0x62, 0xF5, 0x25, 0xBE, 0x54, 0x58, 0x8D, 0x4C,
-    0x81, 0x67, 0xAC, 0x15, 0xE3, 0x63, 0xD8, 0x97, 0x3B, 0x01, 0xE6, 0x34, 0xEC, 0x63, 0x74, 0x3B,
-    0x3E, 0x6B, 0xA3, 0x90, 0x53, 0x68, 0x93, 0xD3, 0xD0, 0xA3, 0x98, 0x2A, 0xA0, 0x93, 0x54, 0xEA,
-    0x15, 0x38, 0xDB, 0xBC, 0x46, 0xCF, 0xDA, 0x95, 0x64, 0x8A, 0xD1, 0x83, 0xAB, 0x3C, 0xDB, 0xAD,
-    0x61, 0x37, 0xBE, 0x3C, 0xFC, 0x9B, 0x7B, 0xCB, 0xAD, 0x00, 0x26, 0x25, 0x18, 0xDD, 0xFA, 0x90,
-    0x0E, 0x43, 0x62, 0x4D, 0x31, 0xBA, 0x7F, 0x00, 0x46, 0x17, 0x5C, 0x0D, 0x89, 0xE0, 0x51, 0xD1,
-    0x2C, 0x60, 0x17, 0x38, 0x9D, 0x9C, 0x57, 0x88, 0x83, 0xD2, 0x25, 0xD8, 0x66, 0xE8, 0x87, 0xE2,
-    0x97, 0x08, 0x1A, 0x96, 0x3B, 0x50, 0x09, 0xB8, 0xA3, 0x83, 0x71, 0xD2, 0xBB, 0x3D, 0x2C, 0x0E,
-    0xFD, 0x81, 0xB1, 0xC6, 0x19, 0x7D, 0x7D, 0x1D, 0xC3, 0x29, 0xC0, 0x7D, 0x61, 0x01, 0xC0, 0x4C,
-    0x48, 0x3D, 0x61, 0xB4, 0xC5, 0x81, 0xE6, 0x04, 0xC6, 0x9E, 0x9D, 0x88, 0x1C, 0x06, 0x71, 0xE6,
-    0x29, 0xBE, 0x01, 0xBA, 0xBD, 0xD1, 0x28, 0x97, 0xD8, 0xDD, 0x88, 0xED, 0x66, 0xAA, 0xEA, 0x97,
-    0xEA, 0xF7, 0xD5, 0xBF, 0x2B, 0xDD, 0x2B, 0x49, 0xF0, 0x13, 0x75, 0xF4, 0x55, 0xF5, 0x3F, 0x4A,
-    0xF7, 0xD3, 0x24, 0x3C, 0xA9, 0x56, 0x17, 0x5E, 0x6E, 0x72, 0x68, 0xAE, 0x33, 0x09, 0x84, 0x99,
-    0x12, 0xCF, 0x62, 0x98, 0x3D, 0x10, 0x10, 0x7F, 0x3F, 0x0C, 0xDE, 0x01, 0x7E, 0xF7, 0xC3, 0xBD,
-    0x41, 0xE5, 0x2C, 0x06, 0x85, 0xDC, 0x35, 0xA8, 0x88, 0x72, 0xE5, 0xB6, 0x04, 0xBC, 0x7E, 0x21,
-    0xF7, 0xB5, 0x20, 0x57, 0x6E, 0xB7, 0x67, 0xD7, 0x93, 0xDD, 0x39, 0xD9, 0x15, 0xF5, 0x23, 0x1C,
-    0x67, 0x6F, 0x2E, 0xA6, 0x8C, 0x45, 0x4E, 0x02, 0x68, 0x1D, 0x3B, 0x8C, 0x85, 0x20, 0x6D, 0x4D,
-    0x43, 0x8E, 0xDF, 0x78, 0x85, 0x6D, 0x20, 0xA5, 0x8A, 0xFA, 0x21, 0xC9, 0x43, 0x5F, 0xDC, 0x54,
-    0xFE, 0xE6, 0x85, 0x9A, 0x6E, 0x54, 0xE0, 0x68, 0x8C, 0xC1, 0x82, 0xF2, 0xCA, 0x71, 0x27, 0x2A,
-    0xBD, 0xD1, 0x7F, 0x8D, 0xE9, 0x1A, 0x5D, 0x05, 0xF4, 0x7E, 0xCF, 0xCD, 0x8A, 0x95, 0xB5, 0xDD,
-    0x05, 0x6F, 0xB7, 0x92, 0x9E, 0xCF, 0xA9, 0xF0, 0x82, 0x62, 0x85, 0xF7, 0x5A, 0xD5, 0xCA, 0xAD,
-    0x50, 0x78, 0xD5, 0xBA, 0xC6, 0x1D, 0xD7, 0x19, 0x25, 0x62, 0x91, 0xA0, 0xB8, 0xA9, 0xD6, 0x9F,
-    0xB0, 0x31, 0xE3, 0x95, 0xFB, 0x2A, 0x30, 0xF5, 0xC6, 0xF9, 0x01, 0x6A, 0x06, 0x42, 0xDF, 0xBB,
-    0x5A, 0xA8, 0xB9, 0x89, 0xF2, 0x3F, 0x2B, 0x1C, 0x62, 0xF9, 0x37, 0xC4, 0xB1, 0x78, 0x93, 0x50,
-    0xD2, 0x31, 0x79, 0x13, 0x24, 0x7E, 0xF3, 0x84, 0x4C, 0xF4, 0xD4, 0x4F, 0xA9, 0x13, 0xCA, 0x32,
-    0x8A, 0x27, 0x91, 0x05, 0xE9, 0x93, 0x50, 0x1F, 0xFF, 0xEB, 0xD9, 0xFC, 0x43, 0xC6, 0xE4, 0x30,
-    0x56, 0x4E, 0x7E, 0x13, 0xFD, 0x8B, 0x19, 0xAC, 0x37, 0xBD, 0x57, 0x2E, 0x00, 0x6F, 0x3C, 0x07,
-    0x58, 0x36, 0x1F, 0x82, 0x8E, 0x9A, 0x15, 0xE5, 0x7D, 0xF2, 0x31, 0x88, 0xE0, 0xF8, 0x8B, 0x99,
-    0x5A, 0x98, 0x07, 0x4D, 0x5C, 0xA2, 0xC3, 0xF4, 0xC6, 0x57, 0xC4, 0xB6, 0xA0, 0xC9, 0xD5, 0xB9,
-    0xA8, 0xF0, 0xEB, 0x5A, 0x7F, 0x99, 0x9F, 0x2A, 0x72, 0xD3, 0x85, 0xE0, 0x30, 0x40, 0xAA, 0xE5,
-    0x96, 0x5E, 0xB6, 0x3A, 0x5C, 0xD4, 0x2E, 0xA6, 0x12, 0x86, 0xB0, 0x97, 0x49, 0x45, 0xC3, 0xD8,
-    0x4A, 0x90, 0x3A, 0xBC, 0x29, 0x47, 0x0B, 0x4A, 0x87, 0x85, 0x77, 0xA7, 0x85, 0x1C, 0x48, 0xBC,
-    0xEF, 0x6A, 0x1B, 0x2C, 0x17, 0x02, 0x4D, 0x47, 0xC9, 0xE5, 0xB5, 0xEA, 0x81, 0x7F, 0x8F, 0x00,
-    0x59, 0x58, 0x3E, 0xF5, 0x8B, 0x09, 0xB8, 0xE9, 0x9C, 0x8D, 0x55, 0x09, 0x2C, 0xCF, 0xCF, 0xAA,
-    0xFE, 0x85, 0x1A, 0xF8, 0xAB, 0xE6, 0x08, 0x40, 0xF2, 0x9C, 0x01, 0x59, 0xE1, 0xA6, 0x43, 0x63,
-    0x25, 0x1B, 0x78, 0x52, 0x9A, 0x68, 0x32, 0xE7, 0x3F, 0x0A, 0xDA, 0x13, 0x1F, 0x48, 0xA3, 0xFE,
-    0xEC, 0x6F, 0xC7, 0x88, 0xBF, 0x14, 0x62, 0x9C, 0x68, 0x43, 0xE9, 0x03, 0x91, 0x94, 0x8B, 0xB5,
-    0x3D, 0xAF, 0x46, 0x8A, 0x1B, 0x0B, 0x0C, 0xBC, 0xDA, 0x20, 0x7A, 0x13, 0x0F, 0x77, 0x4E, 0xB1,
-    0x9E, 0x27, 0x98, 0x3A, 0xC3, 0x39, 0x1C, 0x68, 0xDD, 0xF6, 0x7B, 0x0B, 0xCF, 0x16, 0xB0, 0xED,
-    0xA1, 0xC4, 0xE9, 0xD7, 0x87, 0xB8, 0xF0, 0x7B, 0x77, 0x00, 0x82, 0xA1, 0xA4, 0x13, 0x4F, 0xD1,
-    0xD4, 0xC9, 0xA3, 0x60, 0x94, 0x1D, 0x4E, 0x24, 0x40, 0x18, 0x59, 0x8B, 0x65, 0x75, 0x6A, 0xE6,
-    0xCD, 0x14, 0xC0, 0xDF, 0x17, 0x33, 0x1E, 0xA2, 0x6B, 0xA0, 0x82, 0x3A, 0x6A, 0xBC, 0xD2, 0xC1,
-    0xF0, 0xBB, 0x55, 0x63, 0xD3, 0x1F, 0x42, 0xE1, 0x93, 0x5A, 0xD1, 0xE9, 0xC0, 0xA4, 0x93, 0xD2,
-    0x79, 0x87, 0x4E, 0x53, 0x7A, 0xF9, 0x40, 0x25, 0xA3, 0xF6, 0x80, 0xC8, 0x1E, 0x84, 0x32, 0x37,
-    0x9E, 0x5D, 0x94, 0x1F, 0x8D, 0x72, 0x15, 0xE4, 0x28, 0x43, 0x15, 0x8B, 0x77, 0x30, 0xE3, 0x93,
-    0x6F, 0xFA, 0x0C, 0xEF, 0x03, 0x5B, 0x99, 0x53, 0x9C, 0xBB, 0x7C, 0x48, 0xE2, 0xE7, 0x5B, 0x7D,
-    0xBA, 0xCB, 0xC7, 0x7E, 0x2C, 0xC6, 0x6E, 0x1D, 0xBB, 0xD5, 0x31, 0x96, 0x40, 0x85, 0xD3, 0xCF,
-    0x0B, 0x00, 0x8A, 0xE1, 0x07, 0x9D, 0xD3, 0xC5, 0x65, 0xFC, 0x49, 0xEF, 0xF5, 0xBA, 0xDA, 0x76,
-    0xD7, 0x6C, 0x07, 0xF2, 0x02, 0xEB, 0x22, 0x0A, 0x32, 0x09, 0xA5, 0x4E, 0x8F, 0x0A, 0x11, 0x20,
-    0xE1, 0x7D, 0x95, 0x8D, 0xEE, 0xD3, 0x62, 0x67, 0x18, 0xBE, 0xA3, 0x4F, 0xC8, 0xEF, 0x76, 0xDC,
-    0x70, 0x11, 0xD6, 0x9E, 0x7C, 0x6A, 0x7E, 0xDC, 0x07, 0x7C, 0x30, 0x0F, 0x3B, 0x3F, 0x90, 0x42,
-    0xA0, 0xF5, 0xB4, 0x88, 0x8C, 0xF8, 0x9C, 0xDF, 0x1E, 0x23, 0x1B, 0x28, 0xBE, 0xBC, 0x88, 0x22,
-    0x09, 0x77, 0x15, 0x2A, 0x3C, 0xA1, 0x7C, 0xEA, 0x43, 0x14, 0xEA, 0x7D, 0x16, 0x73, 0x01, 0x8A,
-    0x67, 0x66, 0xC5, 0x5C, 0xA8, 0xC2, 0xF3, 0x30, 0x7F, 0x43, 0x46, 0xB4, 0x43, 0x0B, 0x7E, 0xD5,
-    0x7B, 0xEA, 0xC7, 0x44, 0xAC, 0xEF, 0xA9, 0x80, 0xD5, 0x33, 0xA8, 0xB0, 0xFF, 0xCC, 0x78, 0x8A,
-    0x0A, 0xEE, 0xD8, 0xF9, 0x8B, 0x4B, 0xCD, 0x7B, 0x80, 0xB6, 0x77, 0xC1, 0x4B, 0xCE, 0x67, 0x98,
-    0x48, 0xFF, 0xDF, 0xE3, 0x66, 0xF3, 0xEF, 0xA9, 0x85, 0x0B, 0x77, 0x99, 0x1F, 0xF2, 0x06, 0xDA,
-    0x74, 0x73, 0xA4, 0x6C, 0xF1, 0xB0, 0x55, 0xA3, 0xC7, 0x28, 0x17, 0x8F, 0x1F, 0x19, 0x55, 0x92,
-    0x7D, 0xC4, 0x54, 0x22, 0x71, 0x3B, 0x0D, 0x50, 0x67, 0x70, 0x1B, 0xB4, 0xC8, 0xD9, 0x17, 0xDA,
-    0x76, 0x7B, 0x15, 0x31, 0x0C, 0xA4, 0xC9, 0x91, 0x13, 0x21, 0x68, 0xDA, 0x7F, 0x05, 0xBA, 0x1F,
-    0x73, 0xF6, 0x05, 0xE6, 0xD7, 0xD0, 0xA1, 0x61, 0x89, 0x61, 0xD6, 0x49, 0x9A, 0x39, 0x24, 0x6C,
-    0x9C, 0x70, 0x2A, 0x4B, 0x22, 0x2B, 0xF6, 0xC1, 0xCC, 0xB0, 0x79, 0x67, 0xD7, 0x54, 0x2E, 0xE0,
-    0xC7, 0x4D, 0x58, 0xFA, 0xE5, 0x86, 0x8A, 0x80, 0x1B, 0xD6, 0x75, 0xE2, 0xDE, 0x85, 0x9D, 0x74,
-    0x1D, 0xC6, 0x7F, 0x3F, 0x22, 0xDA, 0x4C, 0x46, 0x43, 0xE7, 0x10, 0x9C, 0x30, 0x27, 0x6B, 0x60,
-    0x81, 0xCC, 0x14, 0x1B, 0x8E, 0xF9, 0xB0, 0x75, 0xAD, 0xCE, 0x70, 0x9B, 0x51, 0xA8, 0xD3, 0xA9,
-    0xB6, 0xAD, 0xC9, 0x1F, 0x19, 0xF2, 0x06, 0x9D, 0xBF, 0xCF, 0xF8, 0xB2, 0xDB, 0x80, 0x08, 0xC8,
-    0xEF, 0x1A, 0x8C, 0x7F, 0xF8, 0xED, 0x07, 0x4A, 0xB8, 0x1F, 0x1A, 0x21, 0xAD, 0x30, 0x2B, 0x82,
-    0xF9, 0x11, 0xDF, 0xD4, 0x6A, 0xFE, 0xE0, 0x03, 0xF1, 0xE8, 0x37, 0xEA, 0x55, 0xC5, 0x88, 0x91,
-    0x9F, 0x28, 0xA7, 0x1C, 0xE9, 0xDD, 0x4A, 0x14, 0xF0, 0xA5, 0x37, 0x62, 0x25, 0xFA, 0x7C, 0xEC,
-    0x04, 0x51, 0x7B, 0x39, 0xCD, 0x88, 0x8C, 0xAC, 0xF3, 0xFB, 0x02, 0x25, 0x56, 0x04, 0xD9, 0xE9,
-    0xD2, 0x71, 0xF9, 0x1A, 0x3A, 0x14, 0xE1, 0x04, 0x2C, 0x92, 0xCD, 0x9C, 0xF1, 0xE0, 0x56, 0xFC,
-    0xD4, 0xD4, 0xB1, 0xAE, 0x19, 0x33, 0x9A, 0xCE, 0x8D, 0xD4, 0x44, 0xB2, 0xA2, 0xBA, 0x76, 0x24,
-    0x68, 0x63, 0x4A, 0xB1, 0xDD, 0x5E, 0xFE, 0xEB, 0x13, 0xA3, 0xBE, 0xD8, 0xE7, 0x09, 0xC4, 0xCA,
-    0x3F, 0x1F, 0x9F, 0x10, 0x15, 0x7A, 0x90, 0x88, 0x73, 0xEB, 0x4D, 0x9F, 0xE0, 0x2C, 0x9D, 0xB0,
-    0xB9, 0x63, 0xB5, 0xB8, 0x62, 0x0B, 0xF1, 0x88, 0xD1, 0x83, 0x1E, 0x13, 0x72, 0x63, 0x04, 0x51,
-    0x86, 0x2D, 0xE3, 0xB2, 0x18, 0x4C, 0xB7, 0x67, 0x70, 0xDA, 0xE5, 0x2C, 0xA2, 0x69, 0x8D, 0x20,
-    0x4A, 0xFA, 0xBB, 0x6E, 0xDD, 0x63, 0xA2, 0x58, 0x58, 0xAE, 0x43, 0x2D, 0xE8, 0xA4, 0xA3, 0xB1,
-    0xEC, 0xB4, 0x4E, 0x43, 0xE5, 0x16, 0xC0, 0x42, 0x0E, 0x0A, 0x60, 0xC9, 0x24, 0x7A, 0xB6, 0xA5,
-    0xEB, 0x2E, 0xA8, 0xE8, 0xD1, 0x83, 0x3A, 0xAE, 0x3C, 0x22, 0xCB, 0x81, 0x6C, 0x97, 0xF5, 0x00,
-    0x26, 0x61, 0x81, 0x96, 0x12, 0x1C, 0x46, 0x67, 0x38, 0x75, 0x04, 0x88, 0xF7, 0xA8, 0x78, 0x4B,
-    0xA7, 0x6A, 0xE6, 0x54, 0x7D, 0xD4, 0xCF, 0xE6, 0x82, 0xA4, 0x3E, 0xE6, 0x96, 0x73, 0x61, 0xF2,
-    0x7E, 0xF0, 0x42, 0xB1, 0xE0, 0xD6, 0xEE, 0x40, 0x72, 0x62, 0xD4, 0xD2, 0x6B, 0x75, 0x16, 0x16,
-    0x0C, 0xA7, 0x56, 0xA9, 0xD2, 0x5F, 0x35, 0xD1, 0xEB, 0xB0, 0x6D, 0x0F, 0xFF, 0x27, 0x8E, 0x0E,
-    0x31, 0x6B, 0xE2, 0x0D, 0xC9, 0x72, 0x43, 0xF7, 0xB5, 0xB1, 0xC2, 0x2B, 0xA7, 0x52, 0xA5, 0x3E,
-    0xA4, 0x27, 0x02, 0x40, 0x97, 0x10, 0xB4, 0x66, 0xFC, 0x83, 0x86, 0x92, 0x4A, 0x8F, 0xCB, 0x49,
-    0x1B, 0xE6, 0x49, 0x20, 0xDB, 0xA2, 0x7B, 0xB0, 0x6A, 0x24, 0x72, 0x22, 0xCE, 0xFC, 0x44, 0x1A,
-    0x2D, 0x61, 0x72, 0xDE, 0x1E, 0xA3, 0x41, 0xF2, 0x75, 0xCE, 0xAA, 0x3F, 0x89, 0x3B, 0x75, 0x69,
-    0x21, 0x4A, 0xDE, 0x9F, 0x04, 0x1F, 0x35, 0x13, 0xDF, 0xD4, 0x97, 0xAC, 0xCB, 0xA6, 0x02, 0x4B,
-    0x36, 0x80, 0xC2, 0x74, 0xE2, 0xAD, 0x63, 0x1E, 0xD7, 0xB0, 0xD1, 0x2A, 0x5A, 0x03, 0x6D, 0xAF,
-    0x69, 0x9A, 0x67, 0x5F, 0xBC, 0xDC, 0xC1, 0x86, 0xA2, 0xD7, 0x84, 0x79, 0x01, 0x19, 0xA1, 0xC8,
-    0xBE, 0x7F, 0xCB, 0x96, 0xE2, 0xB4, 0xC5, 0x8E, 0xD6, 0x55, 0xAD, 0x3C, 0x6B, 0xCE, 0xA3, 0x41,
-    0xE3, 0xD9, 0x2A, 0x95, 0x19, 0x4A, 0xBC, 0xD1, 0xD2, 0x21, 0xEC, 0xF3, 0x5B, 0x1B, 0x38, 0x30,
-    0x33, 0xD3, 0x83, 0xBB, 0x0C, 0xB8, 0x33, 0xA8, 0x40, 0x73, 0x08, 0x1B, 0xC5, 0xB8, 0x0C, 0x53,
-    0x26, 0x21, 0x79, 0x89, 0x84, 0x18, 0x1B, 0x5B, 0xC0, 0xD4, 0x8B, 0xE6, 0xC8, 0x0B, 0x91, 0xF5,
-    0x28, 0xE4, 0xE1, 0xBA, 0x62, 0xB0, 0x0E, 0x5F, 0xB1, 0x01, 0x88, 0xA8, 0xD1, 0xD6, 0x93, 0x7E,
-    0x7A, 0xB0, 0x8E, 0x06, 0xDB, 0xC2, 0x31, 0x24, 0xED, 0x8D, 0x5E, 0x88, 0xD8, 0xFA, 0x24, 0x1C,
-    0x33, 0x6B, 0xB0, 0x75, 0xBD, 0xF4, 0x3B, 0xBB, 0x4A, 0xF5, 0x23, 0x2E, 0x4E, 0x19, 0x3A, 0x4D,
-    0xFA, 0xA7, 0x0B, 0xC4, 0xAF, 0x20, 0x36, 0x62, 0x02, 0x3B, 0x3A, 0x35, 0x61, 0x4D, 0xC5, 0x09,
-    0xA5, 0x03, 0xF1, 0x6D, 0x27, 0x8E, 0x11, 0x1C, 0xF9, 0x77, 0xBB, 0xF1, 0xAE, 0x5A, 0xC2, 0x45,
-    0x82, 0x06, 0xAA, 0x31, 0x1E, 0xE2, 0x56, 0x44, 0xB4, 0x5F, 0x2C, 0xAD, 0xE5, 0x46, 0xF6, 0xC6,
-    0x62, 0xEA, 0x47, 0x57, 0xC1, 0xFF, 0x59, 0x5A, 0x4A, 0x31, 0xCD, 0x3D, 0xFD, 0x39, 0x0F, 0xC8,
-    0x63, 0xD8, 0x71, 0x38, 0xE6, 0x31, 0xEC, 0x4C, 0x6B, 0xC8, 0xF6, 0xA6, 0x35, 0x10, 0x4D, 0x65,
-    0xDB, 0x8A, 0x96, 0x48, 0x03, 0xB2, 0x62, 0xCD, 0xC2, 0xD3, 0xFC, 0x20, 0xC0, 0x91, 0xCC, 0x00,
-    0x47, 0x2B, 0xD9, 0xA3, 0x27, 0x40, 0x25, 0x83, 0x6C, 0x85, 0x6D, 0xCA, 0xCE, 0xCD, 0xD8, 0x46,
-    0xCB, 0x36, 0x3D, 0xC7, 0x06, 0xED, 0xDA, 0xAA, 0xFB, 0xB7, 0xC7, 0xCF, 0xBF, 0x03, 0x0C, 0x12,
-    0x8A, 0x6E, 0x09, 0x65, 0xB2, 0x52, 0xBA, 0x2D, 0xD5, 0xAE, 0x4F, 0x36, 0xFD, 0x8C, 0xC1, 0x4D,
-    0xC6, 0x36, 0xBF, 0x69, 0x47, 0x68, 0xC9, 0x40, 0x04, 0xFB, 0x32, 0x83, 0xAD, 0xA2, 0x3B, 0x6A,
-    0x89, 0xB3, 0xB6, 0xE4, 0x99, 0x12, 0xF2, 0xA4, 0x43, 0x57, 0xA2, 0x0F, 0x61, 0xB6, 0xD7, 0x1B,
-    0xC4, 0x7C, 0x50, 0x44, 0x2F, 0x96, 0xCA, 0xFB, 0x18, 0x74, 0xD9, 0x30, 0x90, 0x18, 0x67, 0x81,
-    0x09, 0x6A, 0xCF, 0x3C, 0xD7, 0x31, 0x8F, 0xD4, 0x80, 0x7B, 0x5E, 0x53, 0x7E, 0xA6, 0x6C, 0xF1,
-    0x84, 0x6F, 0x9A, 0x35, 0xEF, 0x4A, 0xF6, 0x7B, 0xAF, 0xA9, 0xFF, 0x99, 0x04, 0xEF, 0xAB, 0xAD,
-    0x6C, 0xB8, 0x04, 0xD2, 0x30, 0x2A, 0xAA, 0x98, 0x58, 0xC1, 0xC4, 0xD3, 0x68, 0x3B, 0xB1, 0xC2,
-    0xA7, 0x24, 0x68, 0x39, 0x23, 0x7B, 0x12, 0x2B, 0x3E, 0x1F, 0xA2, 0x87, 0x48, 0xAC, 0x70, 0x1F,
-    0x3A, 0xB1, 0xA2, 0xDD, 0x91, 0x58, 0x91, 0xDA, 0xDA, 0x9F, 0x26, 0x56, 0xF4, 0x63, 0x62, 0xC5,
-    0xAF, 0x1F, 0x94, 0x58, 0x01, 0xD1, 0x35, 0x6A, 0xD7, 0x70, 0x24, 0xF9, 0xB9, 0xB1, 0x1E, 0x93,
-    0xD8, 0xBC, 0x11, 0xDA, 0x41, 0xD4, 0x31, 0xF1, 0x25, 0xA2, 0xF1, 0xFB, 0x01, 0xEC, 0x05, 0xE8,
-    0x42, 0xC8, 0x49, 0xF7, 0xEE, 0x1D, 0x5A, 0x33, 0x17, 0xD3, 0x69, 0xB4, 0xCA, 0x8A, 0x81, 0xC8,
-    0x08, 0x67, 0xD5, 0xD2, 0xA2, 0x42, 0x72, 0x49, 0xA7, 0x4D, 0x36, 0xF9, 0x6D, 0x68, 0xCA, 0x5B,
-    0xD0, 0xFB, 0x61, 0x97, 0x5E, 0x46, 0x33, 0x82, 0x2E, 0xB2, 0x3D, 0x92, 0xC7, 0xFC, 0xB9, 0xD0,
-    0x29, 0x6C, 0xA8, 0x9B, 0x8A, 0x9A, 0x6C, 0xF3, 0x62, 0x67, 0x4D, 0x0F, 0xDA, 0x51, 0xA1, 0xCD,
-    0xE2, 0x05, 0xE4, 0x5B, 0xCA, 0x8B, 0x90, 0xDE, 0x0F, 0xF2, 0xD3, 0x91, 0xDA, 0xCE, 0x32, 0xAD,
-    0x81, 0xC8, 0xE6, 0x1D, 0x7B, 0xDF, 0xDC, 0x64, 0xE8, 0xDE, 0x98, 0xC8, 0x82, 0x5D, 0x75, 0xC4,
-    0x9C, 0x95, 0x54, 0x46, 0x62, 0xCB, 0x63, 0xA2, 0x2C, 0x1F, 0xCE, 0x7F, 0x18, 0x9A, 0xE4, 0x1F,
-    0x01, 0x87, 0x24, 0x6C, 0xDC, 0x3F, 0x66, 0x92, 0x06, 0x74, 0xD1, 0xDB, 0xBB, 0x13, 0xF9, 0x82,
-    0x31, 0xF5, 0x21, 0xAC, 0x41, 0xD9, 0x61, 0x35, 0x4B, 0x7D, 0xF8, 0xF5, 0x2C, 0xF5, 0xE1, 0x33,
-    0x42, 0xFE, 0xDB, 0xBB, 0x52, 0x1F, 0xE2, 0xDD, 0xA9, 0x0F, 0xFA, 0xE1, 0x52, 0x1F, 0x9A, 0x14,
-    0x9A, 0xB0, 0x9F, 0x25, 0x1D, 0x6E, 0x17, 0x92, 0xB5, 0x89, 0xE9, 0x89, 0xDC, 0xDA, 0xA9, 0xD7,
-    0x14, 0x26, 0xC6, 0xC5, 0xB4, 0xC4, 0x30, 0x71, 0xB7, 0x0A, 0xBA, 0x11, 0xBD, 0x69, 0x9E, 0x6B,
-    0xA1, 0x16, 0x60, 0xCE, 0xDC, 0xEA, 0xD4, 0x5A, 0x5C, 0xFB, 0xA5, 0x29, 0x56, 0x31, 0xFC, 0xA5,
-    0x64, 0x97, 0x95, 0xD2, 0x41, 0x95, 0x60, 0x00, 0x30, 0xDC, 0x13, 0x32, 0x10, 0x7D, 0x24, 0x14,
-    0x70, 0x8C, 0x12, 0xFD, 0x55, 0x46, 0x4C, 0xD8, 0x33, 0xB3, 0xF5, 0xCC, 0x47, 0x1D, 0x58, 0x8C,
-    0x3A, 0x2A, 0x3A, 0xF3, 0x69, 0xCD, 0x5D, 0xC6, 0x1D, 0xDE, 0xA2, 0x6A, 0x36, 0x36, 0x8F, 0x03,
-    0xBB, 0xDE, 0xBD, 0x81, 0x41, 0xD9, 0xB7, 0x3E, 0xC3, 0xC3, 0xBF, 0xE9, 0x99, 0x58, 0x71, 0x12,
-    0x8F, 0xC3, 0xAE, 0x8F, 0xFE, 0x2C, 0x97, 0xBA, 0x23, 0xA6, 0x33, 0x4C, 0x5E, 0xF1, 0x4D, 0xF9,
-    0x7B, 0x04, 0x9F, 0x05, 0xF0, 0x09, 0x40, 0x95, 0x5A, 0x81, 0xA1, 0xF7, 0xD3, 0x95, 0x79, 0x15,
-    0xBC, 0x15, 0x2B, 0xF7, 0xD6, 0x75, 0xDA, 0x64, 0x40, 0x8A, 0x0C, 0x4D, 0x5D, 0x5C, 0x57, 0xDE,
-    0x57, 0x80, 0x58, 0xDF, 0xD6, 0x83, 0x9A, 0x9F, 0x44, 0x55, 0xF4, 0x8A, 0x3B, 0x30, 0x6C, 0x54,
-    0x43, 0x0C, 0x62, 0xD8, 0xA1, 0x73, 0x4B, 0x98, 0xE7, 0x51, 0xA5, 0x2E, 0x6E, 0x1E, 0x07, 0xB8,
-    0xEF, 0x28, 0xAD, 0x0C, 0xF5, 0x84, 0x3E, 0xC5, 0x4C, 0x19, 0xE6, 0xA2, 0x78, 0x2D, 0x09, 0x73,
-    0xC8, 0xA7, 0xE1, 0x34, 0x99, 0x11, 0x5F, 0xF2, 0x9C, 0x47, 0x28, 0x91, 0x8C, 0x53, 0x12, 0x08,
-    0xEA, 0xEF, 0xB8, 0xCB, 0x3C, 0x1D, 0x3B, 0x27, 0x98, 0x63, 0xFA, 0x82, 0x3C, 0xEA, 0x47, 0x25,
-    0x33, 0x03, 0x01, 0x01, 0x66, 0xA6, 0xCE, 0x5B, 0x1B, 0x0D, 0xE6, 0x43, 0x2F, 0x7F, 0x91, 0x58,
-    0xB7, 0xB7, 0x90, 0xBB, 0x00, 0x59, 0x92, 0xA6, 0xE4, 0x21, 0x29, 0xC6, 0x7F, 0xBD, 0x1A, 0xDC,
-    0x22, 0xAE, 0x51, 0x4D, 0x45, 0x3F, 0x48, 0x22, 0x14, 0x05, 0xC4, 0x30, 0x55, 0xAA, 0x9C, 0x64,
-    0xFF, 0x6B, 0xA6, 0x2A, 0x5F, 0x46, 0x91, 0xFA, 0x10, 0x2E, 0x5D, 0x00, 0x48, 0x55, 0xE3, 0x2B,
-    0x00, 0x29, 0x83, 0x80, 0x3B, 0xDF, 0xE2, 0x3C, 0x5D, 0x12, 0xF2, 0x89, 0x56, 0x15, 0x3A, 0xA4,
-    0x7F, 0x45, 0xA4, 0xBD, 0x74, 0x9D, 0x08, 0x43, 0xE2, 0xC9, 0x9F, 0x8B, 0x50, 0xD1, 0x67, 0x84,
-    0xAB, 0x87, 0x31, 0xB7, 0x50, 0xF8, 0x2E, 0xB2, 0x88, 0x3B, 0x1D, 0xD3, 0xB9, 0x1A, 0x2B, 0x6C,
-    0x1A, 0xAB, 0x22, 0x6B, 0x2B, 0x99, 0x24, 0xF9, 0x5B, 0x06, 0x83, 0x68, 0x44, 0xA4, 0xD7, 0x07,
-    0x52, 0x41, 0xE3, 0x4A, 0x40, 0xDB, 0x93, 0xD4, 0x9E, 0x5A, 0x2A, 0x19, 0x15, 0x82, 0xDD, 0xC0,
-    0xFE, 0x9C, 0x58, 0x02, 0x38, 0x64, 0xA0, 0x6C, 0xA6, 0x62, 0xF4, 0x3E, 0xA6, 0xC8, 0x38, 0x8E,
-    0x1E, 0xCF, 0x81, 0xCE, 0x9C, 0xAD, 0xCA, 0xBA, 0xDE, 0x6C, 0x66, 0x03, 0x73, 0x26, 0xC4, 0x06,
-    0x08, 0x6F, 0xD3, 0x35, 0xC7, 0xC6, 0x33, 0x53, 0xD9, 0x93, 0x9C, 0xA2, 0x02, 0xF0, 0x7D, 0x01,
-    0x2A, 0x5F, 0x12, 0x66, 0x28, 0x15, 0x20, 0x59, 0x39, 0x82, 0xB2, 0xCB, 0xBC, 0x2D, 0x65, 0x3C,
-    0x01, 0x4C, 0x92, 0x12, 0xF3, 0xFD, 0xBB, 0xC3, 0xD2, 0xD2, 0xB2, 0xC5, 0x9C, 0x82, 0xAB, 0x1A,
-    0x49, 0x92, 0x78, 0x61, 0xC7, 0x2E, 0x71, 0x5A, 0x23, 0x59, 0x33, 0xB2, 0xDB, 0xA6, 0xF4, 0xBE,
-    0x9E, 0x26, 0xBD, 0xF7, 0xB2, 0x5B, 0xCE, 0x1C, 0x09, 0x76, 0x75, 0xC5, 0xFC, 0x3C, 0xB4, 0x38,
-    0x04, 0xE4, 0xA9, 0x52, 0x2D, 0x84, 0x60, 0x98, 0x55, 0xE5, 0x81, 0x11, 0xC3, 0x2B, 0xA0, 0x52,
-    0x68, 0x27, 0x28, 0x5B, 0x8F, 0x49, 0x7F, 0xA3, 0x64, 0xA2, 0xB1, 0x7F, 0x07, 0xBC, 0x75, 0x15,
-    0xDC, 0x01, 0x70, 0xD4, 0xE7, 0xD6, 0x80, 0x7D, 0x4F, 0x51, 0x20, 0xCD, 0xFE, 0xA4, 0x6F, 0xF4,
-    0x90, 0x67, 0xA2, 0x5B, 0x6F, 0xEC, 0x3C, 0xB4, 0x59, 0x23, 0x92, 0x0F, 0x54, 0xFC, 0x16, 0x87,
-    0x5F, 0x2C, 0xBD, 0x24, 0xAE, 0x4F, 0x49, 0xD9, 0x57, 0x36, 0x1D, 0x62, 0x76, 0x98, 0xDA, 0x43,
-    0x7F, 0x7A, 0xC8, 0xC1, 0x48, 0xC4, 0x8C, 0x21, 0xE6, 0x92, 0xC3, 0x6C, 0xE7, 0x21, 0x73, 0x89,
-    0x98, 0x9F, 0x40, 0xF0, 0x78, 0x8C, 0x73, 0x7F, 0x2D, 0xC3, 0x3D, 0xBE, 0xAE, 0x68, 0x87, 0x30,
-    0x9C, 0x08, 0x09, 0xEE, 0x4A, 0x50, 0x7A, 0x42, 0x99, 0x4E, 0x97, 0xAA, 0xA4, 0xA8, 0x93, 0x51,
-    0x42, 0x1A, 0x04, 0x9E, 0x3C, 0x4E, 0x7C, 0x87, 0x9A, 0xBA, 0x0C, 0xDF, 0x1C, 0xF8, 0x4D, 0x74,
-    0xB8, 0xA3, 0x3C, 0xD2, 0x3B, 0x3D, 0x51, 0xA9, 0x55, 0x96, 0xDB, 0x95, 0xB1, 0x58, 0x20, 0x7F,
-    0xB8, 0x2A, 0xDD, 0xAE, 0x2E, 0x0E, 0x52, 0xE1, 0xB1, 0xAC, 0x6E, 0xFA, 0x4D, 0x2A, 0xA0, 0xA9,
-    0xB3, 0x5F, 0x59, 0xB5, 0xD5, 0x82, 0xAD, 0x74, 0x2A, 0xE3, 0x37, 0x56, 0x0B, 0xB6, 0xDA, 0x90,
-    0x2A, 0xEA, 0xA4, 0x8A, 0x5B, 0x5B, 0x9D, 0x1D, 0x11, 0x9D, 0x31, 0xA3, 0x4C, 0x11, 0x91, 0x9F,
-    0x88, 0xE9, 0xBE, 0x21, 0xC6, 0x3B, 0xFD, 0x17, 0x36, 0x59, 0x51, 0x72, 0x15, 0xB3, 0xF1, 0x92,
-    0x63, 0x2F, 0xF9, 0xF6, 0x52, 0x64, 0x2F, 0xA5, 0xBB, 0x2E, 0x7D, 0x6B, 0x2A, 0x5E, 0xC2, 0xAC,
-    0xF0, 0x52, 0x15, 0xD4, 0xBF, 0x24, 0x04, 0xF1, 0xAD, 0x36, 0x0C, 0x2C, 0xF2, 0xA2, 0x3E, 0x5C,
-    0x13, 0xF7, 0x17, 0x45, 0x53, 0x2B, 0xF8, 0x48, 0x8C, 0xF6, 0x4C, 0x1C, 0x67, 0x1B, 0xEA, 0x48,
-    0x27, 0xA1, 0x08, 0x23, 0xAB, 0x91, 0xBC, 0x41, 0x7C, 0x49, 0x87, 0x76, 0xC6, 0xFF, 0x13, 0xCB,
-    0xC1, 0xD6, 0x28, 0xB7, 0x52, 0xC1, 0x35, 0xFF, 0x57, 0xCD, 0x56, 0xA6, 0x48, 0x15, 0x0D, 0xD2,
-    0x25, 0x7A, 0x36, 0xD9, 0x83, 0x24, 0x55, 0x12, 0xAD, 0xF4, 0x2A, 0x4F, 0x82, 0xFD, 0x97, 0x38,
-    0x73, 0x19, 0xA8, 0x61, 0x8D, 0x6C, 0x12, 0x66, 0x51, 0x46, 0xFF, 0x78, 0x89, 0xB6, 0xAC, 0xD2,
-    0x7B, 0xD6, 0xA2, 0x99, 0x98, 0xD3, 0x94, 0xA8, 0xBA, 0x43, 0xAB, 0x61, 0x53, 0x0F, 0x24, 0x4E,
-    0x7D, 0xDA, 0xA8, 0x24, 0x07, 0x20, 0x63, 0x84, 0xAB, 0x7F, 0xD6, 0x98, 0xDB, 0x83, 0x2B, 0xA6,
-    0xA1, 0x04, 0x58, 0x48, 0x26, 0x72, 0xD8, 0x2A, 0x41, 0x0B, 0xD2, 0xCE, 0x6C, 0xD6, 0x2E, 0x8B,
-    0x29, 0xC4, 0xBF, 0x05, 0xF2, 0x7A, 0xFA, 0x2C, 0xC6, 0x00, 0x72, 0x1E, 0x26, 0xEB, 0xBA, 0x5F,
-    0x86, 0x99, 0x57, 0x78, 0xD9, 0x02, 0x74, 0x67, 0xA8, 0xA8, 0x74, 0x7E, 0xEE, 0x95, 0x5E, 0xE1,
-    0x56, 0x61, 0x12, 0xA1, 0xB5, 0xF3, 0x30, 0x9A, 0x3B, 0xEB, 0xC1, 0xF0, 0x1A, 0xEF, 0x0E, 0x46,
-    0xF4, 0x1E, 0xC4, 0xD9, 0x44, 0xEC, 0xD3, 0x46, 0xCA, 0xE4, 0xB0, 0xB9, 0x65, 0xCE, 0xEE, 0xB2,
-    0x88, 0xF6, 0x66, 0x77, 0xBD, 0x79, 0x5F, 0x76, 0x57, 0xFF, 0x90, 0xD9, 0x5D, 0xF5, 0x76, 0x76,
-    0x97, 0x14, 0x37, 0xD5, 0x7F, 0xD8, 0x37, 0xBB, 0x8B, 0xF0, 0x9B, 0x8B, 0x73, 0x98, 0xB4, 0x27,
-    0x00, 0xD1, 0x11, 0x99, 0xC1, 0xE2, 0x42, 0x36, 0x4D, 0xF1, 0x3F, 0x30, 0xA6, 0x54, 0xD9, 0xA3,
-    0x69, 0x4C, 0xE9, 0x6F, 0x24, 0xA6, 0x14, 0x63, 0x38, 0x99, 0x97, 0xC9, 0xBB, 0x01, 0x0F, 0x5C,
-    0x10, 0x08, 0xF0, 0x77, 0xCF, 0x1D, 0x2B, 0x77, 0xA7, 0x89, 0x1D, 0x90, 0x3B, 0x56, 0xED, 0x93,
-    0x3B, 0xA6, 0xF7, 0xC9, 0x1D, 0xB3, 0xB0, 0x34, 0x9C, 0x22, 0xD2, 0x31, 0x29, 0xFD, 0xAF, 0x17,
-    0x5B, 0xE7, 0xA0, 0x64, 0x90, 0x6E, 0x17, 0x70, 0x9C, 0x9A, 0x4B, 0xB4, 0x44, 0x47, 0x29, 0xCB,
-    0xE6, 0xA6, 0x22, 0x04, 0x5F, 0xA7, 0x08, 0x63, 0x0E, 0x7C, 0x28, 0xD9, 0xAC, 0x8D, 0x92, 0xA8,
-    0x0F, 0x90, 0x3D, 0xD7, 0x02, 0x71, 0x0E, 0xD3, 0x82, 0xB0, 0xAE, 0x49, 0xE9, 0x18, 0xA0, 0x5A,
-    0xD2, 0x96, 0xA5, 0x9B, 0x69, 0x40, 0x3B, 0xEE, 0xB7, 0x1B, 0x9C, 0xA9, 0x31, 0x23, 0x2D, 0x14,
-    0x70, 0x3E, 0x48, 0xFF, 0x78, 0x32, 0x97, 0xA0, 0x38, 0x4F, 0x8A, 0xB6, 0xF7, 0x79, 0x72, 0x8D,
-    0x2A, 0x0E, 0xF2, 0x4F, 0x27, 0x5E, 0x1D, 0x65, 0x50, 0xF2, 0x74, 0x57, 0x94, 0x61, 0xE1, 0x57,
-    0x51, 0xE6, 0xD5, 0x71, 0x82, 0x2B, 0x68, 0x3A, 0xBF, 0xB5, 0x6E, 0x17, 0x01, 0xA4, 0xAD, 0x1D,
-    0x23, 0xE6, 0x8B, 0x71, 0x54, 0xF7, 0xD9, 0xA4, 0x5F, 0xC1, 0xB4, 0x5F, 0xB1, 0xF4, 0xAB, 0x92,
-    0x2C, 0x5D, 0xF6, 0xAB, 0xA5, 0xAA, 0xEE, 0xD8, 0xAF, 0x41, 0xFA, 0xC5, 0x76, 0xE6, 0xEC, 0x57,
-    0x3A, 0xED, 0x97, 0x3F, 0xEB, 0x17, 0x3D, 0x35, 0x14, 0xCA, 0x83, 0xA8, 0x9F, 0xEC, 0x01, 0xFD,
-    0x32, 0xFB, 0xF4, 0x0B, 0x5A, 0xFA, 0x67, 0x74, 0xFA, 0x64, 0xE0, 0xFE, 0x32, 0x46, 0x57, 0xBC,
-    0x1A, 0x72, 0x8B, 0xBC, 0x15, 0x67, 0x4C, 0xCD, 0x81, 0x04, 0xEA, 0x43, 0x49, 0x73, 0x51, 0xDE,
-    0x5D, 0xE6, 0xB8, 0x74, 0x36, 0x11, 0xCE, 0x33, 0x89, 0x2F, 0x29, 0xAB, 0x36, 0x7C, 0x60, 0x12,
-    0xA1, 0x17, 0xD2, 0x10, 0x3B, 0xE7, 0xB7, 0xDB, 0x96, 0x39, 0xC6, 0x49, 0x8C, 0x61, 0x6A, 0x04,
-    0x9D, 0x30, 0x1F, 0x9A, 0xDE, 0x7D, 0x89, 0xAD, 0xEA, 0x8C, 0x94, 0x1D, 0x95, 0xD6, 0xCD, 0x40,
-    0x8D, 0x67, 0xB3, 0xEE, 0xDC, 0xC1, 0x6C, 0x5B, 0xF9, 0xA9, 0xCD, 0x56, 0x12, 0x94, 0xA2, 0x9B,
-    0x59, 0x6A, 0x82, 0x2B, 0x6A, 0xC4, 0xE6, 0xDD, 0x85, 0xE2, 0xDB, 0xD6, 0x35, 0xBF, 0x94, 0x8A,
-    0x9B, 0x01, 0x86, 0x0B, 0xB5, 0x54, 0x82, 0xA9, 0x0E, 0xC8, 0xF0, 0x19, 0xD9, 0xD5, 0xDC, 0x94,
-    0xCC, 0x3B, 0xEB, 0x3B, 0x38, 0x7A, 0x5F, 0xF9, 0x63, 0x4A, 0x41, 0x10, 0xE6, 0x0A, 0xC4, 0x0B,
-    0xA0, 0x6D, 0x01, 0x62, 0x6C, 0x81, 0x07, 0xA3, 0xE3, 0x99, 0x85, 0x7E, 0x92, 0x21, 0x5B, 0x59,
-    0x95, 0xCC, 0x13, 0xEE, 0x26, 0x0C, 0x52, 0x06, 0xCE, 0x7B, 0x9F, 0x13, 0x06, 0x9E, 0xC7, 0x10,
-    0x12, 0xFD, 0x4F, 0x19, 0x9D, 0x66, 0xD2, 0x63, 0x76, 0x20, 0x20, 0x09, 0x7A, 0xA7, 0x16, 0x0F,
-    0xD3, 0x8A, 0xA8, 0x89, 0x48, 0xEE, 0xC5, 0x15, 0x5A, 0xAD, 0xF8, 0xE8, 0x36, 0xEC, 0x02, 0xAD,
-    0xDF, 0xEE, 0x82, 0x8D, 0xE6, 0xE5, 0x22, 0x6F, 0x63, 0x11, 0x43, 0xC1, 0x2C, 0x6F, 0x4D, 0x42,
-    0x76, 0xD6, 0xEC, 0xB6, 0x38, 0x78, 0x9A, 0x14, 0xE8, 0x8F, 0x1E, 0x8D, 0x57, 0xCE, 0xBF, 0xFD,
-    0x18, 0x1A, 0xF8, 0xAB, 0x12, 0x5C, 0x7C, 0x14, 0xFC, 0xEB, 0x3E, 0xDC, 0x8E, 0x1E, 0x33, 0x32,
-    0xB9, 0x53, 0x8F, 0x9E, 0x4C, 0x67, 0xBA, 0xA3, 0xCE, 0x42, 0x04, 0x9D, 0x60, 0x24, 0xBE, 0xB1,
-    0x2B, 0x2B, 0xA9, 0x78, 0xD6, 0x28, 0x85, 0x40, 0xAE, 0x0D, 0xF5, 0x4C, 0x09, 0x04, 0xA6, 0x93,
-    0x79, 0x4A, 0x01, 0x2A, 0x59, 0xA6, 0x1A, 0x15, 0x5E, 0xE3, 0x1B, 0x59, 0xFD, 0x06, 0x12, 0x95,
-    0x14, 0x65, 0x89, 0xC0, 0x6C, 0x7B, 0xD2, 0xF7, 0x39, 0x75, 0x17, 0xA2, 0x3E, 0xB8, 0x46, 0x0D,
-    0xBC, 0xCF, 0xD7, 0xD4, 0xBF, 0x50, 0xFF, 0x12, 0xCA, 0xA4, 0x9C, 0x53, 0xF3, 0xBB, 0x2B, 0x97,
-    0x2C, 0x7C, 0xA1, 0x57, 0xE9, 0x56, 0x29, 0x08, 0x91, 0xF8, 0x70, 0xCE, 0xCA, 0x2E, 0x56, 0xB0,
-    0x6B, 0x9E, 0xA9, 0xAD, 0x3C, 0x43, 0x25, 0x1A, 0x17, 0xBA, 0x3A, 0x00, 0x50, 0xA4, 0xE5, 0x46,
-    0xE0, 0x08, 0xC4, 0x98, 0x08, 0x72, 0xF4, 0xB6, 0x4F, 0xFC, 0xAA, 0x8A, 0x3E, 0xAD, 0x2E, 0x05,
-    0x4D, 0x7F, 0xCC, 0xEF, 0xF5, 0xF5, 0xAB, 0x02, 0x55, 0x4B, 0x63, 0xB6, 0xD0, 0xA9, 0x0A, 0x6A,
-    0xA7, 0xD0, 0x09, 0xB4, 0x58, 0xA5, 0x2E, 0x81, 0x47, 0x8E, 0x81, 0x69, 0x82, 0xCC, 0x32, 0xCD,
-    0x1F, 0xA8, 0x1F, 0xFF, 0x5C, 0x1D, 0xDD, 0xF1, 0x99, 0x9F, 0x7B, 0x15, 0x9F, 0x0D, 0xBD, 0x39,
-    0x44, 0x66, 0x70, 0x87, 0x05, 0xF5, 0xEA, 0xF4, 0xF3, 0xC4, 0xC2, 0x34, 0x5C, 0xB6, 0x73, 0xD3,
-    0x7B, 0xB6, 0x74, 0xBA, 0x2D, 0x9B, 0x04, 0x1C, 0x5A, 0xA5, 0x37, 0xFD, 0x1A, 0x8F, 0x22, 0x66,
-    0xBA, 0x84, 0x6D, 0xB2, 0xB6, 0x7B, 0x23, 0x26, 0xEA, 0xC7, 0x6D, 0x90, 0x05, 0xD0, 0x85, 0x15,
-    0xD1, 0xBB, 0xB6, 0xC4, 0x9A, 0xEF, 0xB2, 0xBD, 0x08, 0x3B, 0x27, 0x37, 0x25, 0xA3, 0x15, 0x71,
-    0xEB, 0x37, 0x71, 0xE9, 0xB4, 0x60, 0x91, 0x8E, 0xA1, 0x0A, 0x30, 0xC5, 0xCE, 0x8D, 0x4C, 0xD2,
-    0x01, 0xA5, 0xF4, 0xB2, 0x65, 0x4E, 0x9F, 0x67, 0x94, 0x03, 0x6A, 0xF9, 0xA6, 0xB5, 0x3C, 0xC4,
-    0x9C, 0xF8, 0x52, 0x16, 0x35, 0xD1, 0x69, 0xCD, 0x6B, 0xF8, 0x19, 0xED, 0xC1, 0x33, 0x15, 0xD5,
-    0x9F, 0x4D, 0xBF, 0xB4, 0xE9, 0xF2, 0xE6, 0xF5, 0x0B, 0xA4, 0xEC, 0x73, 0xCE, 0xF0, 0xE6, 0x76,
-    0xF6, 0xA5, 0x5D, 0x8C, 0x65, 0x13, 0x00, 0xD4, 0xE8, 0x39, 0x6C, 0xAD, 0x63, 0xE6, 0xA6, 0x3A,
-    0xA2, 0x6C, 0x2A, 0x83, 0x30, 0x43, 0x6D, 0x73, 0xD5, 0xC5, 0xD1, 0x41, 0xB5, 0x7C, 0xF8, 0x7F,
-    0x13, 0x24, 0x3C, 0x9D, 0xD9, 0x08, 0x1A, 0xEC, 0xEC, 0x43, 0x20, 0xC1, 0xD7, 0x9A, 0x39, 0xE5,
-    0x5D, 0x9B, 0x3E, 0xB2, 0x0E, 0xBF, 0x7C, 0xD3, 0x2E, 0xFC, 0x12, 0x6A, 0x5A, 0x9F, 0x6A, 0x48,
-    0x3D, 0x5C, 0x28, 0xC4, 0x7E, 0xF4, 0x78, 0x73, 0xC9, 0x4D, 0x54, 0xF1, 0x4D, 0x6B, 0x92, 0x89,
-    0x7F, 0x65, 0xB8, 0x20, 0x66, 0x97, 0x8C, 0x1C, 0x3A, 0x37, 0x1F, 0x54, 0xE0, 0x56, 0xB7, 0x4E,
-    0x49, 0x99, 0xCB, 0x62, 0xC1, 0xD8, 0x74, 0x03, 0xFC, 0xFC, 0xDF, 0xB2, 0x7C, 0x47, 0x85, 0x5F,
-    0x2C, 0xCE, 0x96, 0xFE, 0x59, 0xE8, 0x31, 0x02, 0x07, 0xC9, 0x57, 0xE7, 0x33, 0xD1, 0xE6, 0x5F,
-    0x58, 0x46, 0x17, 0xA9, 0x3F, 0xDA, 0xF2, 0x66, 0x9A, 0xB3, 0xC1, 0x60, 0xE0, 0xD9, 0xD9, 0x3A,
-    0x47, 0x71, 0xA5, 0xCC, 0x0E, 0x0E, 0x27, 0xE3, 0xBA, 0x5C, 0xAB, 0x38, 0xD6, 0x92, 0xF7, 0x1F,
-    0x03, 0xC1, 0xD7, 0x2B, 0x30, 0x00, 0x3E, 0xE7, 0x0D, 0x3F, 0x14, 0xDC, 0x14, 0x7D, 0xB9, 0x24,
-    0x82, 0xC5, 0x86, 0x22, 0x2C, 0x13, 0x49, 0x36, 0xFB, 0x70, 0xBE, 0xB2, 0x8B, 0x8E, 0x63, 0xAA,
-    0x19, 0x3A, 0x6B, 0xAC, 0x37, 0xE8, 0x9F, 0x8D, 0xE1, 0x9E, 0x87, 0x5B, 0x3A, 0x2C, 0xCD, 0x90,
-    0x7C, 0xCE, 0x9F, 0x2A, 0x2F, 0xB3, 0x96, 0xD9, 0x51, 0xB5, 0x6D, 0xC0, 0xCE, 0x7C, 0xD3, 0x53,
-    0x07, 0xF6, 0x81, 0x7F, 0x21, 0x6D, 0x7C, 0xC0, 0x13, 0x68, 0xCA, 0x56, 0xD0, 0x7E, 0x19, 0x56,
-    0x6C, 0xAD, 0x2E, 0x74, 0xC6, 0xD4, 0xFF, 0x3C, 0x1B, 0xEC, 0x52, 0x00, 0xAF, 0x25, 0x88, 0x71,
-    0x06, 0x59, 0x8D, 0x01, 0x9D, 0x9A, 0x5E, 0x63, 0x9F, 0xFC, 0xDE, 0xC8, 0xD2, 0xE5, 0x60, 0xF4,
-    0xD3, 0x85, 0x76, 0x08, 0xAD, 0x27, 0x4C, 0x59, 0xAC, 0xAC, 0xA6, 0x4E, 0x33, 0x21, 0x99, 0xD1,
-    0x47, 0x2D, 0xB5, 0x3F, 0xAE, 0x0C, 0x4E, 0xAD, 0x88, 0xF5, 0x46, 0x51, 0xAB, 0x07, 0xB3, 0x45,
-    0xE7, 0x0A, 0xF0, 0xE7, 0x35, 0xF1, 0x8A, 0x44, 0xF8, 0xCF, 0x60, 0x74, 0xE7, 0x5D, 0xCC, 0x25,
-    0xD7, 0xCF, 0x31, 0x82, 0x72, 0x8A, 0xE9, 0xA6, 0xA5, 0xA4, 0x0C, 0x9F, 0x53, 0xFF, 0x54, 0x09,
-    0xCE, 0x79, 0x5F, 0x62, 0x40, 0xB2, 0x84, 0x38, 0xB4, 0xAA, 0x6F, 0x74, 0x77, 0x07, 0xAD, 0x7A,
-    0x98, 0xBF, 0x94, 0x71, 0xC2, 0x04, 0xC4, 0xD3, 0x51, 0xD5, 0xF6, 0xC0, 0x29, 0x05, 0x53, 0x64,
-    0x8A, 0x5E, 0x1C, 0x0C, 0x92, 0x7F, 0x79, 0x87, 0x5C, 0xAE, 0x82, 0xEF, 0xBE, 0x6B, 0x6D, 0x6F,
-    0xED, 0x1A, 0x71, 0x8B, 0x09, 0xED, 0xB3, 0xC4, 0x0D, 0x3E, 0x0D, 0x27, 0xC9, 0x4C, 0x93, 0xDA,
-    0x06, 0xBB, 0xD6, 0x4E, 0xF4, 0x7E, 0xBE, 0x45, 0xA7, 0x51, 0x6F, 0xAE, 0x01, 0xFF, 0xC3, 0x4A,
-    0x06, 0x94, 0xD0, 0x7D, 0xD4, 0x47, 0x00, 0xBF, 0x65, 0xDE, 0xC4, 0xC3, 0xE8, 0x1D, 0x87, 0xCC,
-    0x67, 0xC0, 0x52, 0x63, 0x56, 0x98, 0x7F, 0xE8, 0xD1, 0xF0, 0xEF, 0x98, 0x8D, 0x05, 0x56, 0x8D,
-    0xDE, 0xA8, 0x95, 0x7F, 0xA3, 0x56, 0xCE, 0x66, 0x6B, 0x03, 0xF0, 0x0C, 0x71, 0x63, 0x0E, 0x32,
-    0xAF, 0x3D, 0x39, 0xA0, 0xFD, 0x71, 0x45, 0x9C, 0xC0, 0x20, 0xE7, 0xE5, 0x06, 0x92, 0x95, 0xCB,
-    0x21, 0x21, 0x38, 0xF4, 0x49, 0x89, 0xFB, 0x0A, 0x38, 0xE4, 0xA4, 0xD2, 0x9C, 0xD5, 0xC6, 0x62,
-    0x70, 0x31, 0x8A, 0x4E, 0x28, 0xF5, 0x13, 0xAF, 0xFA, 0x89, 0x5F, 0x1C, 0x0D, 0x93, 0xA3, 0xB1,
-    0x3A, 0x3A, 0xA7, 0xE6, 0x2E, 0xA9, 0x79, 0x26, 0xBC, 0x2A, 0xBD, 0xA9, 0xE6, 0xA2, 0x72, 0x8E,
-    0xF9, 0x09, 0x97, 0x56, 0xD4, 0xCA, 0x0A, 0x9D, 0x1A, 0x73, 0x24, 0x73, 0xDA, 0x35, 0x35, 0x8D,
-    0xB0, 0xC7, 0xC6, 0x65, 0x35, 0x12, 0x7B, 0x15, 0x7A, 0x90, 0x05, 0x4B, 0xB2, 0x62, 0x49, 0x71,
-    0xC9, 0x12, 0x57, 0x05, 0xCA, 0xC9, 0x5C, 0xC9, 0xAA, 0x25, 0xBB, 0x78, 0x93, 0xEB, 0x96, 0x94,
-    0x2C, 0x5C, 0x52, 0x0C, 0x4D, 0x31, 0x7B, 0x84, 0x76, 0x33, 0x71, 0x1B, 0x31, 0x81, 0xAC, 0x5E,
-    0xA2, 0x97, 0x4E, 0x56, 0x16, 0xF6, 0x8B, 0xCB, 0x38, 0xD9, 0x31, 0xE3, 0x96, 0x8B, 0x37, 0x43,
-    0xE1, 0x6C, 0x49, 0x2F, 0x13, 0x8B, 0x42, 0xA6, 0x59, 0x6C, 0x10, 0x71, 0xCB, 0x70, 0xF9, 0x54,
-    0x11, 0x14, 0x2B, 0x6A, 0xE2, 0x4B, 0x75, 0x09, 0x55, 0xB6, 0xA2, 0x5A, 0xBF, 0x08, 0x93, 0x89,
-    0x6A, 0x02, 0xA9, 0xEA, 0x80, 0x79, 0xEE, 0x2F, 0xD6, 0x41, 0xD7, 0x13, 0xAB, 0x93, 0x67, 0xE9,
-    0xBC, 0xA9, 0xC5, 0xF9, 0xA2, 0xC4, 0x99, 0x66, 0xFD, 0x2E, 0xB2, 0x72, 0xC9, 0xAE, 0x1E, 0xB5,
-    0x6E, 0x05, 0xEB, 0x58, 0xB0, 0x9E, 0x86, 0x83, 0x4F, 0xBF, 0xB9, 0xF4, 0x72, 0xE7, 0x6D, 0x5B,
-    0x56, 0xA5, 0x88, 0xAC, 0x67, 0x45, 0x22, 0x5B, 0x87, 0x43, 0x24, 0x2E, 0x07, 0xF1, 0x32, 0xBC,
-    0x4E, 0xB7, 0xC3, 0x20, 0x9E, 0x06, 0xC3, 0xD3, 0x79, 0x27, 0x2B, 0x97, 0x6A, 0xE9, 0x94, 0x65,
-    0x1A, 0xA1, 0xB2, 0x4E, 0xF8, 0xA6, 0x9A, 0xC2, 0x38, 0x4B, 0xE8, 0x87, 0xC4, 0x19, 0x51, 0x2F,
-    0xEC, 0xD8, 0xE8, 0x87, 0x18, 0xB7, 0x66, 0xB6, 0xD9, 0xBC, 0xF0, 0xE9, 0xD6, 0xD2, 0xD9, 0x30,
-    0x6E, 0x83, 0xB6, 0xA4, 0x30, 0xD8, 0x85, 0x77, 0xF4, 0xD3, 0xF1, 0x51, 0x4F, 0x25, 0xBF, 0xAB,
-    0xF1, 0x78, 0x76, 0x7B, 0x3C, 0x5A, 0x19, 0x8F, 0x6A, 0x5C, 0xC9, 0x35, 0xB5, 0x98, 0xA4, 0xB9,
-    0xD6, 0xAB, 0x26, 0x8B, 0x95, 0xAC, 0x25, 0x2A, 0xB1, 0x9C, 0x91, 0x36, 0x9C, 0x51, 0x1E, 0xEE,
-    0x1A, 0x1B, 0x3D, 0xDB, 0x76, 0x8C, 0xCB, 0xEE, 0xB1, 0x69, 0xF7, 0x8C, 0x4D, 0xAB, 0x13, 0x71,
-    0xCA, 0x0C, 0xA3, 0x15, 0xD8, 0x59, 0x4B, 0x8C, 0xBE, 0x4F, 0xF7, 0x1C, 0x61, 0x1A, 0x1D, 0x98,
-    0xD3, 0xB5, 0x5A, 0xEB, 0x16, 0xCD, 0xC8, 0x36, 0x3F, 0xDB, 0x80, 0x76, 0x31, 0x24, 0xD1, 0xD9,
-    0xA8, 0x13, 0x77, 0xA6, 0xF9, 0x9B, 0xCE, 0xDA, 0x6B, 0x92, 0x32, 0xF6, 0x80, 0x6D, 0x7A, 0x9D,
-    0x98, 0x50, 0x70, 0xE1, 0xE2, 0x2F, 0xD4, 0x1F, 0x17, 0xDE, 0x55, 0x15, 0x3E, 0xA3, 0xE6, 0xDE,
-    0x53, 0x77, 0x65, 0xF7, 0x18, 0x20, 0xC8, 0xCB, 0x35, 0xE4, 0x51, 0x7E, 0x86, 0xD0, 0xEB, 0x70,
-    0xC3, 0x08, 0x54, 0x9E, 0x40, 0x28, 0x06, 0xC0, 0x60, 0xEA, 0xF1, 0x77, 0xD0, 0xC6, 0x77, 0xB9,
-    0x90, 0x86, 0xE6, 0x0C, 0x8D, 0x97, 0xC0, 0x48, 0xF8, 0x22, 0x34, 0xE2, 0xAA, 0x8F, 0x8D, 0xAC,
-    0x44, 0xD2, 0x46, 0xFC, 0xA4, 0xA9, 0x91, 0x98, 0x03, 0xF4, 0x48, 0x7C, 0x1B, 0xFC, 0x96, 0x27,
-    0xF1, 0xF5, 0xD6, 0x1D, 0x50, 0x5D, 0xEB, 0xBC, 0x1E, 0xD5, 0x95, 0xDE, 0xEF, 0xF2, 0x4C, 0x5F,
-    0x36, 0x41, 0x8B, 0xEA, 0x43, 0x03, 0x9D, 0x90, 0xE9, 0xC2, 0x5C, 0xAC, 0xB9, 0xBA, 0x9A, 0x58,
-    0xAD, 0xD0, 0x65, 0x6A, 0x0A, 0x56, 0xDA, 0x56, 0xB1, 0x49, 0x58, 0xE1, 0x69, 0xA8, 0xAA, 0x10,
-    0x26, 0x7E, 0x91, 0x56, 0x3E, 0x0C, 0xCE, 0x32, 0xAD, 0xBC, 0x4E, 0x2A, 0x71, 0x88, 0x32, 0x7F,
-    0xDE, 0x1D, 0x43, 0x94, 0xFE, 0x68, 0xDC, 0x8F, 0xB9, 0x7B, 0x16, 0x9A, 0x8C, 0x92, 0xDC, 0xCE,
-    0xEE, 0xB8, 0xB8, 0xDF, 0x32, 0xFF, 0x8E, 0xC5, 0x51, 0x14, 0x38, 0x09, 0xCD, 0x43, 0x06, 0xAA,
-    0xB8, 0x38, 0x15, 0x4F, 0x8D, 0xF1, 0x94, 0xE2, 0x58, 0xE7, 0x6E, 0x15, 0xC7, 0x36, 0xBC, 0xAD,
-    0x22, 0xD6, 0xFE, 0x67, 0x85, 0xD6, 0xC7, 0xAF, 0x15, 0x3A, 0xBA, 0x7E, 0xA6, 0xD4, 0xA1, 0x39,
-    0x5E, 0xEA, 0xC0, 0x84, 0xA5, 0xF6, 0x86, 0xB0, 0xD2, 0x5E, 0x8F, 0xC2, 0xE9, 0x50, 0x24, 0x6F,
-    0x47, 0x5C, 0x7A, 0x6E, 0x1F, 0xD1, 0x4D, 0xB3, 0xFB, 0xC4, 0x0A, 0x70, 0x67, 0xFA, 0xDD, 0x3D,
-    0x7B, 0x62, 0x9D, 0x7F, 0x1B, 0x6B, 0xF6, 0x2F, 0x4D, 0x35, 0xFF, 0x00, 0x7C, 0x81, 0xEF, 0x6D,
-    0xF2, 0x8B, 0x5A, 0x65, 0xB8, 0x41, 0x8D, 0x6F, 0xC4, 0x90, 0x3E, 0xBD, 0x92, 0x1C, 0xA0, 0x8B,
-    0xFA, 0xED, 0xDE, 0xEA, 0x7A, 0xE6, 0x9C, 0x0A, 0x6E, 0x0B, 0x6A, 0xD7, 0xD2, 0x04, 0x26, 0x8E,
-    0x84, 0x1F, 0x49, 0xDC, 0x99, 0xAE, 0x09, 0xB7, 0x95, 0x7C, 0xD7, 0xE9, 0x02, 0x2D, 0xBE, 0x7D,
-    0x85, 0x52, 0x35, 0x2C, 0xD9, 0xE2, 0x74, 0x7C, 0x8D, 0x87, 0x18, 0x11, 0xFC, 0xE4, 0xE3, 0x5A,
-    0x07, 0x63, 0x24, 0xCC, 0x28, 0xCE, 0x76, 0x63, 0x99, 0xB5, 0xB1, 0xC1, 0x4A, 0x0A, 0xD7, 0xF4,
-    0x8A, 0x28, 0xFF, 0xC4, 0xA9, 0x40, 0x54, 0x73, 0xE8, 0x0F, 0xDD, 0x5A, 0x63, 0xDE, 0x7E, 0xF6,
-    0x80, 0x1E, 0xE4, 0xA7, 0x0B, 0xC7, 0x0C, 0xB5, 0x33, 0x5C, 0xA4, 0x11, 0x9C, 0xA3, 0xDB, 0x61,
-    0xB1, 0x80, 0xC1, 0x82, 0x15, 0xB0, 0x0E, 0xDD, 0x1C, 0xBD, 0x0E, 0x4D, 0xC0, 0x35, 0xF0, 0x5D,
-    0x94, 0xB8, 0xC6, 0x1B, 0x5E, 0x96, 0x4C, 0x08, 0xBE, 0x5A, 0x85, 0x59, 0x72, 0x27, 0x93, 0x80,
-    0xD1, 0x8E, 0xB0, 0xA0, 0x69, 0x95, 0xDA, 0x55, 0x52, 0xAE, 0x34, 0x4A, 0x50, 0x49, 0xA5, 0x0F,
-    0xC0, 0x34, 0xE2, 0x94, 0xB1, 0xCB, 0xDA, 0x43, 0x1B, 0x35, 0x94, 0xD7, 0x54, 0x6C, 0x09, 0x02,
-    0xA3, 0x69, 0xA3, 0xD6, 0x62, 0xC2, 0x8C, 0x46, 0x92, 0xFD, 0xA8, 0xD5, 0xD5, 0x86, 0x2B, 0x8B,
-    0xAC, 0x6D, 0xB0, 0x99, 0xBA, 0x51, 0x14, 0x13, 0x46, 0x33, 0x15, 0x2A, 0x1A, 0xC8, 0xEC, 0x56,
-    0x3F, 0x79, 0x92, 0x55, 0x64, 0x6A, 0x19, 0xA7, 0xC2, 0x9F, 0xBD, 0xFD, 0xC5, 0x4A, 0xB9, 0x9E,
-    0x33, 0x15, 0x48, 0x10, 0x22, 0xBA, 0x63, 0xEC, 0xDA, 0x5A, 0xF6, 0x3E, 0x4D, 0x52, 0x30, 0x62,
-    0x5C, 0x86, 0x6D, 0xD8, 0x78, 0x83, 0x37, 0xDC, 0xDF, 0xE8, 0x47, 0xB7, 0x54, 0xC4, 0x39, 0x61,
-    0x31, 0x86, 0x20, 0x31, 0x3D, 0xD6, 0xB9, 0xF5, 0x67, 0x3B, 0x63, 0x78, 0xD5, 0xDB, 0x1A, 0x99,
-    0xEA, 0xEB, 0x11, 0x21, 0x5F, 0xB6, 0x75, 0x74, 0xCA, 0xD6, 0x7A, 0x7C, 0xAF, 0xCF, 0x86, 0x63,
-    0x96, 0x5E, 0x11, 0x82, 0x17, 0x68, 0x8C, 0x51, 0x92, 0x9A, 0x2A, 0x99, 0x18, 0x06, 0x84, 0x26,
-    0xF7, 0x8B, 0x0A, 0xEB, 0x86, 0x04, 0x34, 0xB1, 0x41, 0xDE, 0x2F, 0xCF, 0x5B, 0x3F, 0x89, 0x05,
-    0x76, 0xCE, 0x58, 0x7B, 0xD6, 0x9F, 0x69, 0x43, 0x55, 0x7C, 0x77, 0x4E, 0x6D, 0x6B, 0xD2, 0x99,
-    0xD8, 0x08, 0x36, 0xA0, 0xBE, 0x6B, 0x74, 0xFC, 0x7B, 0x32, 0x36, 0x11, 0x84, 0x01, 0x86, 0xE7,
-    0x76, 0x19, 0x2B, 0x8C, 0x10, 0x09, 0x11, 0x83, 0x84, 0x67, 0xCC, 0x8B, 0x9D, 0x7B, 0x68, 0x39,
-    0x6B, 0xAD, 0x51, 0x32, 0x27, 0x90, 0xFE, 0x37, 0x18, 0xB0, 0x74, 0x51, 0x12, 0x81, 0x62, 0xBB,
-    0x80, 0x4F, 0x24, 0xC4, 0x2A, 0xA5, 0x1D, 0x3A, 0x8B, 0xC1, 0xBB, 0xA7, 0x7E, 0x34, 0xB6, 0x26,
-    0x11, 0x7F, 0x9F, 0x29, 0x7D, 0x71, 0xBF, 0x34, 0x1C, 0xC8, 0x7F, 0x05, 0x48, 0xFE, 0x23, 0xE5,
-    0x66, 0x73, 0xE2, 0x31, 0xBD, 0xC4, 0x37, 0x72, 0x48, 0x24, 0x72, 0x7B, 0xC5, 0x0A, 0x87, 0x79,
-    0x69, 0xFB, 0xAD, 0x03, 0xFB, 0xBC, 0x93, 0x80, 0x87, 0x5F, 0x2C, 0x9D, 0xE0, 0x1B, 0x0B, 0xF8,
-    0x6E, 0xA9, 0x7D, 0xAF, 0x2E, 0xED, 0x78, 0x63, 0x01, 0x5F, 0x7E, 0xA0, 0xE4, 0x3D, 0x20, 0xD9,
-    0x9E, 0xF7, 0x80, 0x1C, 0xF9, 0x61, 0x53, 0x51, 0x99, 0x87, 0x8B, 0x76, 0x24, 0xD8, 0x2A, 0xB6,
-    0xF6, 0x49, 0x71, 0xC8, 0x8A, 0x55, 0xB9, 0x61, 0x0D, 0x62, 0x67, 0xED, 0xCF, 0x30, 0x29, 0x4C,
-    0xCF, 0xD0, 0x6F, 0x2A, 0x18, 0x39, 0xAA, 0x0D, 0x19, 0xC2, 0x64, 0xA6, 0x1C, 0xC9, 0xE9, 0xC8,
-    0x4D, 0xC5, 0x7B, 0x44, 0xDB, 0xF7, 0x68, 0x77, 0xDC, 0x63, 0x6D, 0x6A, 0x44, 0xFF, 0xA1, 0x5D,
-    0x00, 0xD1, 0xEB, 0xBF, 0x50, 0x2B, 0x3F, 0xBD, 0xEF, 0x1E, 0xCD, 0x28, 0xB0, 0x63, 0xF9, 0xD7,
-    0xD3, 0x7F, 0xEA, 0xFE, 0x03, 0xFE, 0x1E, 0x61, 0xDB, 0xB3, 0x87, 0x6D, 0xFB, 0xF4, 0x1E, 0x3E,
-    0xEE, 0xC1, 0x15, 0x7F, 0xE1, 0x96, 0xA9, 0xA2, 0x3A, 0xAA, 0xE2, 0x3A, 0xAE, 0x9F, 0x5A, 0x7C,
-    0x6A, 0x51, 0xFC, 0x74, 0xA5, 0xE5, 0x06, 0xFB, 0xAA, 0x9E, 0xC1, 0x9A, 0xA1, 0x7E, 0x67, 0x33,
-    0x36, 0xF9, 0xC5, 0xEF, 0x35, 0x41, 0x3C, 0x06, 0x79, 0xC1, 0x27, 0xBE, 0x64, 0x66, 0x14, 0x90,
-    0x7B, 0x98, 0xE3, 0xDE, 0xE2, 0x2D, 0xEA, 0x20, 0x20, 0xFB, 0x4C, 0xE4, 0x4B, 0x31, 0x88, 0x72,
-    0x48, 0x4F, 0xC9, 0xC2, 0x78, 0x65, 0x4E, 0x7E, 0x6D, 0x71, 0x6F, 0x7A, 0xBD, 0x1E, 0x43, 0x31,
-    0x63, 0x5A, 0x45, 0xBB, 0xD3, 0xF0, 0x1A, 0xCD, 0xA2, 0x69, 0xC8, 0x73, 0xFA, 0x5A, 0x8B, 0xC8,
-    0x8C, 0x00, 0x73, 0xF4, 0x40, 0x19, 0x6B, 0xC6, 0x19, 0x5B, 0x87, 0x26, 0x1F, 0x58, 0x9B, 0x7B,
-    0xE6, 0x6B, 0xAE, 0xD2, 0x81, 0xCD, 0x72, 0x85, 0x2F, 0xA9, 0x80, 0x35, 0x16, 0x30, 0xC7, 0xAD,
-    0xCC, 0x81, 0x66, 0x2A, 0x3A, 0xEF, 0x1B, 0x81, 0xA1, 0x9D, 0xA8, 0x48, 0xBF, 0xF6, 0x25, 0x4C,
-    0x5B, 0x32, 0x15, 0x06, 0xE2, 0x81, 0x02, 0x02, 0x22, 0xB0, 0x3F, 0xB0, 0xFB, 0x87, 0xCF, 0xB9,
-    0xF8, 0xA7, 0x53, 0x0B, 0xD4, 0x40, 0x47, 0x35, 0x6F, 0xA5, 0x8B, 0x4E, 0xC0, 0xE6, 0xF3, 0xB5,
-    0x84, 0xB1, 0x22, 0xC6, 0x94, 0xD5, 0x90, 0xCA, 0x20, 0x0F, 0xC3, 0xE8, 0xCA, 0x2C, 0xA7, 0x39,
-    0xAC, 0xD3, 0xB7, 0x78, 0xA1, 0x8F, 0xE5, 0xF6, 0xA5, 0xD8, 0x8C, 0x58, 0x99, 0x55, 0x2C, 0x95,
-    0x6B, 0xAE, 0x77, 0x86, 0x6B, 0x8A, 0xD3, 0x9A, 0x0E, 0xB8, 0x8F, 0xF0, 0x5F, 0xE9, 0x3E, 0x80,
-    0x79, 0x59, 0x69, 0xC9, 0xAB, 0xEB, 0xFD, 0x36, 0x80, 0x2E, 0x8C, 0xAB, 0x3C, 0xDB, 0x25, 0x01,
-    0x7E, 0x80, 0x37, 0x74, 0x6C, 0x27, 0x0E, 0x5F, 0xBE, 0x3F, 0x71, 0x78, 0x51, 0xE2, 0xD5, 0x4F,
-    0x12, 0x4A, 0x84, 0xD6, 0x29, 0x0A, 0x3C, 0x41, 0xC7, 0x61, 0xA3, 0x98, 0xCC, 0x21, 0x37, 0xAE,
-    0xC5, 0xB5, 0xE4, 0x72, 0xF5, 0x25, 0x63, 0xFE, 0x63, 0xCC, 0xD6, 0xB3, 0xC9, 0x86, 0x89, 0x98,
-    0x35, 0x56, 0xA5, 0xF9, 0xB5, 0x38, 0x8E, 0x09, 0x0C, 0xEE, 0x59, 0x47, 0x30, 0xA7, 0x89, 0x0E,
-    0x16, 0x9B, 0x71, 0xEC, 0x74, 0x7E, 0xA1, 0x3F, 0xB0, 0x2B, 0x3A, 0x21, 0x22, 0x6B, 0xAB, 0x44,
-    0xEF, 0xBB, 0x19, 0x57, 0x3B, 0x95, 0x12, 0xA3, 0x1C, 0xC4, 0x69, 0x4D, 0xED, 0x8C, 0x46, 0x1E,
-    0x5A, 0xAE, 0x6C, 0xB2, 0xFA, 0x34, 0x8B, 0xD9, 0xC1, 0x33, 0xD7, 0x7D, 0xDE, 0xEC, 0x75, 0xF0,
-    0xA9, 0xC7, 0x95, 0xA7, 0xEF, 0x8E, 0xBA, 0x2A, 0x1F, 0x5F, 0xDC, 0x76, 0x1F, 0xA7, 0x3B, 0x8B,
-    0xE3, 0x6B, 0x3F, 0x1E, 0x3F, 0xB7, 0xFD, 0xDA, 0x0F, 0xFF, 0x01, 0xAF, 0xFD, 0x88, 0x66, 0xAF,
-    0xFD, 0xF0, 0xDB, 0x5D, 0xAF, 0xFD, 0x50, 0x07, 0xBF, 0xF6, 0x63, 0x53, 0x5E, 0xFB, 0x61, 0x1E,
-    0xF4, 0xDA, 0x0F, 0x26, 0x89, 0x3C, 0x4E, 0xCF, 0x15, 0xB6, 0x43, 0xC9, 0xA3, 0xCD, 0xCA, 0x75,
-    0x1B, 0x22, 0xC7, 0x81, 0x10, 0x4F, 0xD3, 0x77, 0x19, 0x51, 0x30, 0x04, 0x5D, 0xD0, 0xED, 0xE3,
-    0x90, 0xB0, 0x2F, 0x6E, 0x71, 0xFE, 0x6E, 0x2F, 0x6E, 0xC9, 0x4F, 0x3E, 0xC2, 0x17, 0xB7, 0x90,
-    0x17, 0x99, 0x1D, 0x8D, 0xF1, 0x2B, 0xC9, 0x0C, 0xFC, 0x7F, 0x94, 0xA3, 0xC1, 0x6C, 0x6C, 0x09,
-    0x51, 0x81, 0xA4, 0x9C, 0x81, 0xD3, 0x1E, 0xB4, 0x41, 0x3B, 0x0D, 0x46, 0xEC, 0x23, 0xFA, 0xFF,
-    0x01, 0xBE, 0xC0, 0x83, 0x92, 0x9F, 0x52, 0x1F, 0x12, 0x9F, 0xD2, 0x7E, 0x1F, 0x49, 0xEF, 0xE4,
-    0x74, 0xF4, 0x43, 0x98, 0xFB, 0x75, 0x94, 0xC8, 0x7A, 0xED, 0x4F, 0x81, 0x72, 0xDF, 0xB2, 0xCB,
-    0xFB, 0x86, 0x5A, 0x79, 0xDF, 0xF1, 0x10, 0x88, 0x53, 0x6F, 0x5E, 0x64, 0x56, 0x46, 0x46, 0x2D,
-    0x4D, 0xDE, 0x58, 0x26, 0xB2, 0x67, 0xE0, 0x37, 0x90, 0x85, 0xE2, 0x12, 0x78, 0x1D, 0x5E, 0x82,
-    0xFA, 0xA1, 0x8E, 0xA0, 0x17, 0x35, 0x7D, 0xAE, 0x1B, 0xDF, 0xA6, 0xE2, 0x74, 0x36, 0xA3, 0x76,
-    0x6B, 0x5C, 0x77, 0x68, 0x9A, 0x61, 0x3B, 0xCD, 0x96, 0xF6, 0xF7, 0x87, 0xF2, 0x5A, 0x40, 0x30,
-    0xF4, 0xB2, 0x2C, 0xD5, 0xEE, 0x6C, 0xA0, 0x55, 0xBC, 0x9F, 0x56, 0x61, 0x58, 0x4F, 0xD6, 0xD3,
-    0xE2, 0x87, 0xBD, 0x27, 0xAF, 0xE8, 0x09, 0x86, 0x8B, 0x75, 0x54, 0xD0, 0x34, 0xDE, 0xCE, 0xA8,
-    0x95, 0x75, 0x78, 0xE7, 0xDF, 0xDD, 0x38, 0x30, 0xA3, 0x96, 0xCB, 0xD0, 0xC0, 0xFB, 0x90, 0x38,
-    0x01, 0x23, 0x17, 0x5E, 0x6F, 0x73, 0x5D, 0x4D, 0xF6, 0x50, 0x9E, 0xB8, 0xDF, 0x45, 0x97, 0x25,
-    0x1C, 0x59, 0xF1, 0x9F, 0xA2, 0x82, 0x4C, 0x79, 0x80, 0xBE, 0xFE, 0x2D, 0x87, 0x27, 0xA2, 0x19,
-    0x45, 0xC4, 0x63, 0x9D, 0x22, 0xB0, 0x93, 0x59, 0x3C, 0x08, 0xF4, 0xFC, 0xFF, 0x5F, 0xB5, 0x1F,
-    0x25, 0x71, 0x42, 0x82, 0xB6, 0x70, 0x8C, 0xEF, 0xA7, 0xCC, 0x8B, 0xBD, 0x00, 0x2C, 0xDA, 0x32,
-    0xC9, 0x51, 0x48, 0xA7, 0x27, 0xB6, 0x97, 0xF9, 0x75, 0x62, 0xB8, 0x86, 0xA6, 0x1F, 0x81, 0x06,
-    0xB9, 0xA4, 0xE3, 0xFA, 0xAF, 0x63, 0x8B, 0xCB, 0x35, 0x93, 0xE8, 0x09, 0x16, 0xF9, 0x5B, 0xCA,
-    0x8E, 0xC3, 0xB9, 0xF8, 0x7F, 0xDA, 0x43, 0x8B, 0xBB, 0x7B, 0xFB, 0x8E, 0x52, 0xBF, 0xDC, 0xF1,
-    0xFE, 0x94, 0x6E, 0xF6, 0xFE, 0x94, 0x66, 0xE7, 0xFB, 0x53, 0xC2, 0x83, 0xDF, 0x9F, 0xE2, 0x1E,
-    0xF4, 0xFE, 0x14, 0x67, 0xD1, 0xB3, 0x7C, 0xDD, 0xFE, 0xAE, 0x16, 0x42, 0x04, 0x55, 0x50, 0xD1,
-    0x29, 0x66, 0xFF, 0x23, 0xF9, 0xDF, 0xF9, 0x7C, 0xA8, 0xC7, 0x27, 0x31, 0x9F, 0xEB, 0x5A, 0x92,
-    0x75, 0x99, 0xAB, 0x0F, 0xEB, 0x7E, 0x1C, 0x03, 0x97, 0xAD, 0xE1, 0x18, 0xE4, 0xE3, 0x18, 0xC4,
-    0xE3, 0x18, 0x04, 0x0F, 0x3F, 0x06, 0x7E, 0xE5, 0x57, 0x7C, 0x89, 0x14, 0x73, 0xE9, 0x68, 0x5A,
-    0x5B, 0xF3, 0xFA, 0x77, 0x33, 0x16, 0x0C, 0x58, 0xF9, 0x25, 0x54, 0x22, 0x3E, 0xF2, 0xE2, 0x3E,
-    0x28, 0xFD, 0x34, 0x79, 0x2A, 0x51, 0x4F, 0x3D, 0xC8, 0x3F, 0xC2, 0x37, 0xEC, 0x10, 0x74, 0x49,
-    0x9A, 0x95, 0xEA, 0xC4, 0x07, 0x0D, 0x08, 0x52, 0xD2, 0x98, 0x17, 0xCF, 0x07, 0x57, 0xEE, 0x53,
-    0xFA, 0xE4, 0x92, 0xD6, 0xCE, 0xFE, 0x36, 0x24, 0x47, 0x0E, 0x16, 0x5A, 0x32, 0x7D, 0xAB, 0xD0,
-    0xE8, 0x20, 0xB0, 0xC9, 0x0C, 0xC2, 0xEB, 0x36, 0x65, 0x43, 0x7C, 0x0C, 0x7E, 0x37, 0x8D, 0xFA,
-    0x0B, 0x56, 0xB6, 0x59, 0x84, 0x1C, 0x3E, 0xB5, 0xD3, 0x8A, 0x07, 0xE0, 0x87, 0xD0, 0x28, 0xED,
-    0xF2, 0xA1, 0x88, 0x50, 0x37, 0x2E, 0x1F, 0x4A, 0xBE, 0xB1, 0xBD, 0x5C, 0xFD, 0x8B, 0x5E, 0xAC,
-    0x49, 0x52, 0x18, 0xFD, 0x05, 0x74, 0x76, 0x53, 0x13, 0x62, 0xC6, 0x7D, 0xBE, 0x09, 0x41, 0x46,
-    0x57, 0x45, 0x74, 0xF1, 0x70, 0xB5, 0x2E, 0xDA, 0x4B, 0x1C, 0x2A, 0xEF, 0xD2, 0xB1, 0x59, 0xC7,
-    0xE2, 0x05, 0xB6, 0x7E, 0xB2, 0x3D, 0xAE, 0x70, 0xF1, 0x87, 0x2E, 0x77, 0x63, 0x42, 0xB5, 0x6B,
-    0x7D, 0x01, 0x24, 0x77, 0x19, 0x71, 0x68, 0xF4, 0x22, 0x4D, 0x52, 0x2E, 0xFD, 0xA5, 0x67, 0x62,
-    0x0F, 0xDE, 0x7C, 0x52, 0xA9, 0x3F, 0x7A, 0xC4, 0x2F, 0xB9, 0x81, 0xBC, 0x7B, 0xBE, 0x93, 0xF7,
-    0xDD, 0x5E, 0xEE, 0xBC, 0x7D, 0xDE, 0x77, 0xFB, 0xFB, 0xEA, 0x17, 0x7E, 0x12, 0xA8, 0x57, 0xD5,
-    0x7B, 0xA8, 0x92, 0x57, 0xD5, 0xFB, 0xB6, 0x6A, 0xFC, 0x22, 0x4A, 0x16, 0x5E, 0xE6, 0x1B, 0x00,
-    0x12, 0xBF, 0x6D, 0x6C, 0xF8, 0xB4, 0xB5, 0x70, 0xB5, 0x7D, 0x94, 0xAF, 0x43, 0x64, 0x6A, 0xD0,
-    0xB8, 0x26, 0x70, 0xCE, 0xA2, 0x69, 0x17, 0x8F, 0xF8, 0xD9, 0xF9, 0xB7, 0x8D, 0xB9, 0x21, 0xB9,
-    0xD2, 0x73, 0x3C, 0xE9, 0x15, 0x6C, 0x00, 0x5F, 0x2A, 0x44, 0x9A, 0x8D, 0x12, 0x4C, 0x9D, 0x23,
-    0xAF, 0xC5, 0x55, 0xE7, 0xF8, 0xFD, 0x43, 0x6A, 0x84, 0x31, 0x23, 0xB8, 0xC3, 0x15, 0x09, 0x73,
-    0xC6, 0xB5, 0x20, 0xA6, 0x3D, 0x56, 0xC4, 0x81, 0x7F, 0xCE, 0xEE, 0x57, 0xD1, 0xD4, 0xDF, 0xFF,
-    0x2A, 0x9A, 0xF1, 0x12, 0x43, 0xB2, 0x5E, 0x27, 0x30, 0x9D, 0xBF, 0x4A, 0x95, 0xBC, 0x6F, 0x46,
-    0xDB, 0x57, 0xD1, 0xAC, 0xEC, 0x7C, 0x15, 0x8D, 0x67, 0x5F, 0x45, 0x83, 0x5E, 0x18, 0x79, 0x45,
-    0x8E, 0xD7, 0x4B, 0xFE, 0x01, 0x5F, 0x45, 0xC3, 0x77, 0x27, 0x7C, 0x42, 0x9F, 0x88, 0x63, 0xCE,
-    0xF0, 0x4D, 0x39, 0xA0, 0x30, 0xBE, 0x82, 0xC3, 0x1A, 0xB4, 0x83, 0xC3, 0xB7, 0x2B, 0x3A, 0x66,
-    0xB6, 0x0E, 0x65, 0xFF, 0xBF, 0x47, 0xBD, 0x54, 0xF9, 0x71, 0x74, 0xFA, 0xF0, 0xD9, 0xE9, 0x7C,
-    0xDA, 0x54, 0x18, 0x51, 0x30, 0xB9, 0x28, 0x37, 0x31, 0x39, 0x75, 0x26, 0xFE, 0x79, 0x9B, 0x0E,
-    0x63, 0x53, 0xD5, 0xA7, 0x09, 0x31, 0xD3, 0x8C, 0x98, 0xE9, 0xC2, 0x17, 0x9B, 0x13, 0x33, 0xBE,
-    0x8B, 0x6A, 0xCC, 0x8A, 0x19, 0xDF, 0xD8, 0xE1, 0x8E, 0x56, 0xE4, 0x20, 0x2C, 0x65, 0x33, 0x63,
-    0x54, 0x6C, 0x17, 0xDB, 0xD8, 0xDC, 0x18, 0x9B, 0x1C, 0x63, 0xB3, 0x63, 0x12, 0x9B, 0x1E, 0xB3,
-    0x55, 0x4A, 0x7E, 0x8C, 0xB1, 0xAF, 0xA6, 0xB2, 0x37, 0x1A, 0x83, 0x9F, 0xC1, 0xEE, 0xD7, 0x1B,
-    0x72, 0xAD, 0x3C, 0x1D, 0x54, 0x0D, 0x63, 0x7C, 0xB8, 0x67, 0xCB, 0x78, 0xE5, 0x84, 0x84, 0x2D,
-    0x6E, 0x5D, 0x31, 0x3D, 0x6C, 0x20, 0x6B, 0x16, 0xD2, 0x92, 0xD4, 0x75, 0xE6, 0x61, 0xAA, 0x21,
-    0x96, 0x88, 0x64, 0x05, 0x81, 0xE6, 0xB7, 0x4F, 0x84, 0x95, 0x4B, 0xE4, 0x6F, 0xDB, 0x9D, 0x5A,
-    0x16, 0xFE, 0x7F, 0x95, 0x56, 0x31, 0xAC, 0x16, 0x45, 0x10, 0x9E, 0xBB, 0x7D, 0x72, 0xC0, 0xA9,
-    0x4B, 0x21, 0x31, 0x06, 0xF1, 0xB0, 0x43, 0x83, 0x1C, 0x09, 0x74, 0xFE, 0xFC, 0x7B, 0xC9, 0x8B,
-    0xC1, 0x4A, 0x29, 0x24, 0xB1, 0x92, 0xC6, 0xCA, 0x90, 0xD0, 0x58, 0x50, 0x3C, 0xB8, 0x13, 0x12,
-    0x2D, 0x45, 0x8D, 0x16, 0x56, 0xAF, 0xA6, 0x42, 0x43, 0xA1, 0x91, 0xF7, 0xEE, 0xE4, 0x95, 0xC4,
-    0xE4, 0xA2, 0xA5, 0xCD, 0x51, 0x53, 0xB8, 0x86, 0x2B, 0x8E, 0xB0, 0x77, 0xE3, 0x37, 0x7B, 0xF7,
-    0xDE, 0xFF, 0xA3, 0x0F, 0x82, 0x9B, 0x9B, 0x7F, 0x67, 0x77, 0x67, 0x77, 0x66, 0x67, 0xBE, 0x99,
-    0xFD, 0x4B, 0xE6, 0xBB, 0xCC, 0xAE, 0x64, 0xAE, 0xCA, 0xC7, 0x58, 0x1E, 0x16, 0x3F, 0x9F, 0xDC,
-    0x40, 0x03, 0xC3, 0x8F, 0xE4, 0xA7, 0x20, 0x34, 0x3F, 0x75, 0xE3, 0xC6, 0x45, 0xF6, 0xED, 0xCF,
-    0xB1, 0x6B, 0x69, 0x6C, 0x4F, 0x5D, 0x3C, 0x46, 0x87, 0x67, 0x74, 0x7C, 0x46, 0x6F, 0xED, 0xF6,
-    0x9D, 0x9E, 0xD1, 0x6C, 0x8D, 0x66, 0x97, 0x76, 0xFB, 0x7E, 0xF2, 0xDF, 0xAD, 0xA5, 0x4F, 0x8C,
-    0xE3, 0xBF, 0x76, 0x0C, 0x73, 0xF4, 0x78, 0x8B, 0x65, 0x72, 0xF0, 0xCA, 0xBD, 0x64, 0x95, 0xD7,
-    0xA6, 0x31, 0x4D, 0x6A, 0x13, 0xAB, 0x6D, 0xDC, 0x45, 0x90, 0xD7, 0x4E, 0x77, 0xBA, 0xD5, 0x18,
-    0xA7, 0x8D, 0xA9, 0xF3, 0x4A, 0xB6, 0x8D, 0x73, 0x09, 0xA4, 0xB6, 0xE7, 0xFE, 0xBB, 0x2F, 0xFF,
-    0x9D, 0x33, 0xFE, 0xA2, 0x57, 0x83, 0xEE, 0x62, 0x97, 0x36, 0x89, 0xCD, 0x0B, 0x53, 0x31, 0x95,
-    0xD7, 0xFA, 0x80, 0x63, 0x37, 0x9E, 0x62, 0xAC, 0x69, 0xB8, 0xE0, 0xD5, 0x5E, 0x39, 0xD9, 0x98,
-    0x57, 0xE5, 0xD5, 0x41, 0xF5, 0x72, 0xF2, 0xA8, 0x67, 0x37, 0x4D, 0xE6, 0x1E, 0x76, 0x6C, 0x71,
-    0x88, 0x43, 0x22, 0xBF, 0xCB, 0x54, 0xA6, 0xE6, 0xAC, 0xBC, 0x33, 0x10, 0x47, 0xE3, 0xFD, 0xF6,
-    0x80, 0xD6, 0x88, 0x02, 0x4B, 0x14, 0x61, 0x47, 0xF2, 0xD4, 0xE1, 0x45, 0xB6, 0x3E, 0x02, 0x0F,
-    0xCF, 0x91, 0xC2, 0x50, 0x63, 0x75, 0x06, 0xC2, 0xAA, 0xAA, 0x31, 0xCC, 0x88, 0x4E, 0x63, 0xD8,
-    0xFE, 0x9F, 0xE1, 0x2D, 0x10, 0x86, 0x01, 0x86, 0x01, 0xD8, 0xE7, 0x68, 0x5C, 0x7A, 0x56, 0x3A,
-    0xCF, 0xAD, 0x61, 0xEE, 0x72, 0xFE, 0xF6, 0x83, 0xC5, 0x7C, 0xF1, 0x04, 0xFA, 0x2E, 0x4B, 0x10,
-    0x36, 0xC8, 0x57, 0x07, 0xCF, 0x17, 0x4F, 0x96, 0x8B, 0x41, 0x0A, 0x14, 0x8A, 0x5F, 0x3D, 0x3C,
-    0x29, 0x80, 0x0E, 0xCA, 0x79, 0xA0, 0x14, 0x9B, 0x35, 0xB3, 0x55, 0xC0, 0x07, 0x26, 0xE1, 0x4B,
-    0xE6, 0x5A, 0x2C, 0xC0, 0xE4, 0x80, 0x49, 0xFE, 0x15, 0x64, 0x31, 0xE9, 0x30, 0xC9, 0xEF, 0x83,
-    0xFE, 0x00, 0x3D, 0x14, 0xBC, 0x08, 0x8C, 0x61, 0xDD, 0xC7, 0xB4, 0x49, 0x65, 0x53, 0xBA, 0xB2,
-    0x2D, 0x33, 0xB9, 0x7C, 0xB2, 0xDA, 0x99, 0x2D, 0x97, 0x57, 0x3B, 0x7D, 0x16, 0x74, 0x94, 0xAE,
-    0x82, 0x2A, 0xD5, 0x99, 0x4A, 0x39, 0xC2, 0x34, 0x99, 0x3A, 0xC2, 0x9A, 0xEA, 0xA9, 0xAC, 0x36,
-    0x36, 0x36, 0xB6, 0x21, 0x39, 0xDB, 0x57, 0x90, 0x0E, 0xDF, 0xA1, 0xA0, 0x39, 0x71, 0x82, 0x66,
-    0xEA, 0x24, 0x4C, 0x3F, 0x79, 0x82, 0xAC, 0x3A, 0x03, 0xD7, 0x9A, 0x06, 0x11, 0xEB, 0xC4, 0xDD,
-    0x74, 0x1C, 0x24, 0xF1, 0xC2, 0x70, 0x0C, 0xA9, 0x04, 0x80, 0x6E, 0x4F, 0xAE, 0x56, 0x16, 0x3F,
-    0x97, 0x5F, 0xDF, 0x9B, 0xE9, 0xCF, 0xDF, 0xFD, 0x3A, 0xB4, 0x1F, 0x7E, 0x7F, 0x64, 0xBE, 0xE7,
-    0x95, 0xAB, 0xBA, 0x7A, 0xFB, 0xBD, 0x7B, 0x6D, 0xD0, 0xAC, 0x1D, 0x5C, 0x40, 0x6B, 0x19, 0xD8,
-    0xCF, 0x02, 0x48, 0x69, 0x61, 0xA6, 0xB2, 0x7D, 0x94, 0x54, 0x69, 0x91, 0x53, 0x1F, 0x38, 0xD5,
-    0x46, 0x8D, 0xAE, 0xD2, 0xCC, 0xD0, 0x65, 0xEA, 0x42, 0xAB, 0x9A, 0xB8, 0xD2, 0xD9, 0x6B, 0x1E,
-    0x45, 0x63, 0xDB, 0x4F, 0x06, 0xD2, 0x71, 0xAD, 0x2C, 0x4C, 0xBF, 0x30, 0xCE, 0xAD, 0x63, 0x52,
-    0xB5, 0x41, 0x27, 0xF3, 0x1B, 0x60, 0xB1, 0xA4, 0xB3, 0x3D, 0xD5, 0x85, 0x85, 0x96, 0xA3, 0x74,
-    0x93, 0xAE, 0x2B, 0xAB, 0x6B, 0x5D, 0xC5, 0x8D, 0x28, 0x8B, 0xEB, 0xA4, 0x30, 0x04, 0x4D, 0x34,
-    0xC7, 0x25, 0xE7, 0xD0, 0x96, 0xA0, 0x54, 0xAC, 0x6D, 0xFB, 0x8D, 0xA8, 0xA4, 0xF0, 0x7E, 0x11,
-    0x6F, 0x59, 0x43, 0xBD, 0xE4, 0x36, 0xA5, 0xD4, 0x2B, 0x9B, 0x54, 0x73, 0x2C, 0x98, 0x4A, 0x5B,
-    0xB8, 0xBD, 0xC7, 0x86, 0xBD, 0x50, 0x0E, 0x47, 0xE1, 0xA4, 0x3A, 0x6C, 0x69, 0x83, 0x06, 0xE5,
-    0x7C, 0x12, 0xE1, 0x84, 0x23, 0xDE, 0x2F, 0x72, 0xD3, 0x37, 0x0B, 0xC8, 0xEE, 0x5F, 0x0F, 0x07,
-    0x4A, 0x1A, 0xEC, 0x8B, 0x3B, 0x70, 0x9C, 0x21, 0x64, 0xE2, 0x21, 0x12, 0x56, 0x23, 0xD7, 0xA2,
-    0x9E, 0x42, 0x86, 0x74, 0x6A, 0x11, 0x43, 0xF4, 0x5C, 0x25, 0x12, 0x1B, 0xC5, 0xD1, 0x20, 0x27,
-    0x25, 0x0F, 0xB9, 0xA2, 0xC0, 0x51, 0x09, 0x6C, 0x59, 0x84, 0x9E, 0x7B, 0xCA, 0x57, 0x1D, 0x69,
-    0xCE, 0xA2, 0xD6, 0xD4, 0x84, 0x7A, 0x87, 0x6A, 0x40, 0x86, 0x6B, 0x8D, 0x20, 0x02, 0x6C, 0xE4,
-    0xF7, 0x8E, 0x45, 0xAA, 0x6C, 0xD9, 0xCA, 0xC9, 0x43, 0x84, 0x33, 0x50, 0xA7, 0x8A, 0x04, 0xCB,
-    0x21, 0xE6, 0x4A, 0x2C, 0x83, 0x14, 0xD8, 0x54, 0xCC, 0xE0, 0x22, 0x06, 0x5A, 0x33, 0x33, 0x04,
-    0xDC, 0xC1, 0xA1, 0x2C, 0x78, 0xC8, 0x47, 0x84, 0xC7, 0xDD, 0xE8, 0x9A, 0xD2, 0x0F, 0xD7, 0x63,
-    0x78, 0xEE, 0x36, 0x1C, 0x8A, 0xAB, 0x3A, 0xDF, 0x05, 0x2E, 0x82, 0x7B, 0xCA, 0xD0, 0xC5, 0xB0,
-    0x8E, 0x15, 0x3A, 0xD9, 0xD4, 0x02, 0x02, 0xD7, 0x38, 0x71, 0x25, 0x46, 0x07, 0xC6, 0x3A, 0x11,
-    0x82, 0x5E, 0xB6, 0x50, 0xCF, 0x19, 0xCC, 0x6C, 0xCC, 0x37, 0xDC, 0x1E, 0x56, 0x0F, 0x60, 0x84,
-    0xED, 0x41, 0x9B, 0xFF, 0xA2, 0x9E, 0xA2, 0xBF, 0x1D, 0x45, 0x0F, 0x5A, 0x8A, 0x1E, 0x59, 0x8A,
-    0xB8, 0x16, 0xF3, 0x29, 0x81, 0x4B, 0xC4, 0x3B, 0x89, 0xDD, 0x85, 0x9A, 0x45, 0xD8, 0x53, 0xE0,
-    0x38, 0xC5, 0x58, 0xDC, 0x6C, 0xB0, 0x96, 0x4F, 0x24, 0xE6, 0x9C, 0x3B, 0x4B, 0x4B, 0x4F, 0x90,
-    0xAF, 0x34, 0x2F, 0x7E, 0x4A, 0x87, 0x4F, 0xD3, 0x5A, 0xC2, 0xAD, 0x38, 0xEA, 0xA5, 0x29, 0xBB,
-    0x95, 0x5C, 0xE4, 0xF9, 0x63, 0x44, 0x87, 0x7E, 0x29, 0x46, 0xF3, 0x29, 0x85, 0x33, 0xA2, 0xDF,
-    0x80, 0x96, 0xBD, 0xA7, 0x44, 0x4D, 0xBD, 0x02, 0x18, 0x03, 0x61, 0x2F, 0xAC, 0x7C, 0xB5, 0xF5,
-    0xD1, 0xA9, 0x1F, 0xEF, 0x5F, 0x82, 0x7D, 0x57, 0x28, 0xAA, 0x11, 0xE7, 0xCD, 0xF6, 0xE7, 0xBB,
-    0x5F, 0x1E, 0xFD, 0xE1, 0xCC, 0xCA, 0x81, 0x75, 0x7A, 0x95, 0xC2, 0x62, 0xAA, 0xC4, 0x72, 0x24,
-    0xB2, 0x2A, 0x2A, 0xC6, 0xC4, 0x0B, 0x9A, 0xB1, 0x4A, 0xFA, 0x6A, 0x27, 0x20, 0x94, 0xCA, 0x97,
-    0x4E, 0x82, 0x52, 0x72, 0xA4, 0xB8, 0xAA, 0x66, 0xD2, 0x2E, 0xB0, 0x70, 0x93, 0xE0, 0x7C, 0x12,
-    0x4C, 0x8A, 0x11, 0x6C, 0xB1, 0x64, 0xEE, 0xD9, 0xE5, 0x67, 0xE9, 0x10, 0xF0, 0x7B, 0x68, 0xC8,
-    0x50, 0x9D, 0x3A, 0xC0, 0xC3, 0x51, 0x7E, 0x1F, 0x25, 0x4E, 0x28, 0x8B, 0xBB, 0x34, 0x8B, 0x1D,
-    0xAE, 0x57, 0x2A, 0x2C, 0x4B, 0x61, 0xC4, 0xE6, 0x58, 0xB4, 0xE0, 0x7A, 0x81, 0x68, 0xD8, 0x94,
-    0xF8, 0x8B, 0x06, 0x9C, 0x9E, 0x48, 0x52, 0x37, 0xA3, 0x80, 0x92, 0x8A, 0x0E, 0x33, 0x42, 0x37,
-    0x9A, 0x12, 0x48, 0x8E, 0xF4, 0x52, 0x06, 0x05, 0x21, 0x34, 0x02, 0x19, 0x7D, 0x04, 0x50, 0x05,
-    0x20, 0xE9, 0xD5, 0xC4, 0x7B, 0x19, 0x01, 0x95, 0x54, 0x01, 0x09, 0x96, 0x04, 0x2D, 0x12, 0x87,
-    0xCA, 0x41, 0x03, 0x2D, 0x09, 0x14, 0xE3, 0xBD, 0xF6, 0xD1, 0x2E, 0x2D, 0x9D, 0x7A, 0xB1, 0x59,
-    0xCC, 0x92, 0x13, 0x14, 0x28, 0x94, 0x6C, 0x61, 0x9F, 0x3F, 0xA3, 0x0A, 0x9F, 0x3C, 0x76, 0x7B,
-    0x5B, 0x70, 0x4E, 0x6A, 0x8E, 0x4F, 0x0F, 0x46, 0x0A, 0x91, 0xB9, 0x7E, 0xB1, 0x0D, 0xEF, 0xD5,
-    0xC8, 0xE9, 0xF9, 0x0A, 0xAE, 0x20, 0x3E, 0xD6, 0x8D, 0x38, 0x75, 0x53, 0xF9, 0xBB, 0xEE, 0xB0,
-    0xBA, 0x9E, 0x8B, 0x53, 0x22, 0x41, 0x52, 0x71, 0x05, 0x4B, 0x16, 0x6C, 0xD8, 0x8B, 0x8B, 0x90,
-    0x35, 0x8D, 0x40, 0x6A, 0x53, 0x70, 0xA1, 0x1B, 0xB1, 0x60, 0x10, 0xD8, 0xED, 0xC6, 0xD6, 0xB4,
-    0xBF, 0x91, 0xB7, 0x6C, 0xD1, 0x50, 0x11, 0x10, 0x38, 0xA4, 0x70, 0x2F, 0x25, 0x00, 0x0E, 0xC9,
-    0x45, 0x36, 0x66, 0x01, 0x2C, 0xEF, 0xD8, 0x7D, 0x50, 0x62, 0x9A, 0xB3, 0xB8, 0x4B, 0xD0, 0xAA,
-    0xBA, 0x88, 0x29, 0x98, 0x21, 0xC1, 0x04, 0x11, 0x69, 0x25, 0xDE, 0x70, 0xC2, 0x4A, 0x42, 0x92,
-    0xA4, 0xE4, 0xC4, 0x06, 0x9E, 0x4D, 0x51, 0xEB, 0x10, 0x34, 0x61, 0x07, 0x14, 0x2B, 0xDC, 0x36,
-    0xB2, 0x92, 0x40, 0x39, 0x25, 0xD0, 0x6A, 0x25, 0x34, 0x39, 0x26, 0x71, 0x29, 0x25, 0x15, 0x61,
-    0xC1, 0xB2, 0xB0, 0x7A, 0x62, 0xDF, 0xC0, 0x71, 0x37, 0x97, 0x2C, 0xC7, 0x3B, 0x04, 0x07, 0xA4,
-    0x30, 0x5E, 0xCA, 0x9A, 0x1A, 0xE4, 0x12, 0xB9, 0xC5, 0x1B, 0x14, 0xF9, 0xEA, 0x53, 0xDA, 0xE5,
-    0x6B, 0xD6, 0x13, 0xC2, 0xD7, 0xA6, 0xF7, 0x46, 0x5E, 0x16, 0x41, 0xB5, 0x47, 0x74, 0x37, 0xFD,
-    0x51, 0x48, 0x81, 0x2A, 0xC0, 0xBD, 0xC7, 0xFB, 0x93, 0x7F, 0x86, 0x9A, 0xD4, 0xDC, 0x46, 0xDD,
-    0x91, 0x10, 0x24, 0x90, 0x8E, 0xA7, 0x1C, 0xF0, 0xF8, 0x97, 0xC7, 0xC9, 0x6C, 0x27, 0x47, 0x3D,
-    0x1D, 0x23, 0x68, 0xBC, 0x22, 0xC7, 0x9C, 0xB1, 0xA4, 0xEF, 0xC0, 0xA4, 0x86, 0x29, 0x6C, 0x71,
-    0x03, 0xA7, 0x5B, 0x2F, 0x2D, 0x68, 0x92, 0x0C, 0x11, 0x47, 0x78, 0x80, 0x6F, 0x6C, 0x1F, 0x53,
-    0x4D, 0xC0, 0x5E, 0xCE, 0xAD, 0xA3, 0xA0, 0x15, 0xB1, 0xFD, 0x1F, 0x4D, 0x50, 0xB1, 0x8E, 0xD3,
-    0x40, 0x10, 0x7D, 0xBB, 0xD6, 0xE1, 0x62, 0xCF, 0xF1, 0xF5, 0x38, 0x72, 0x43, 0x91, 0x62, 0x89,
-    0x53, 0xA4, 0x48, 0x11, 0x9D, 0x2D, 0x1A, 0x1A, 0x90, 0xEE, 0x07, 0x90, 0xAE, 0xA1, 0x4F, 0x11,
-    0xA4, 0x80, 0x72, 0x17, 0x23, 0x8A, 0x6B, 0xF9, 0x03, 0x2C, 0x44, 0x8F, 0x8B, 0x14, 0x14, 0xC0,
-    0x6E, 0x0D, 0x8D, 0x25, 0x8A, 0x2B, 0x68, 0xF6, 0x74, 0x3F, 0xB0, 0x85, 0x0B, 0x4B, 0x6C, 0x62,
-    0xC6, 0x4E, 0x84, 0xD0, 0x68, 0x56, 0x33, 0xB3, 0x33, 0xEF, 0xCD, 0xBC, 0x93, 0xEC, 0xD1, 0x62,
-    0x31, 0xFA, 0x18, 0xDD, 0x3F, 0xBB, 0x8F, 0xAC, 0x2C, 0xE7, 0xD7, 0x4D, 0x6A, 0x45, 0x05, 0xA0,
-    0xE2, 0x95, 0x5F, 0x04, 0xC5, 0xAC, 0xD8, 0xD6, 0xED, 0x0E, 0xB6, 0x37, 0x6C, 0xEA, 0x4B, 0x14,
-    0x28, 0xA1, 0xAA, 0xB3, 0x15, 0x24, 0xE4, 0xCB, 0xAF, 0xAA, 0xDE, 0x54, 0x7E, 0xF3, 0x18, 0x13,
-    0xAA, 0x7F, 0x36, 0xCD, 0xDC, 0x46, 0x65, 0xB0, 0x94, 0x69, 0xD3, 0x61, 0xD0, 0x5C, 0x44, 0x36,
-    0x27, 0x5B, 0x61, 0x8B, 0x1A, 0x96, 0x59, 0x4E, 0x28, 0xEC, 0x93, 0xF7, 0x24, 0xD7, 0x8B, 0x49,
-    0x24, 0x5E, 0x60, 0x0F, 0x63, 0xCB, 0x60, 0xEE, 0x3D, 0xFD, 0xAD, 0x37, 0xB9, 0xA8, 0xA6, 0xAB,
-    0x42, 0x9A, 0x61, 0x31, 0x5C, 0x8E, 0x93, 0x3D, 0x7B, 0x8E, 0x61, 0xEA, 0x52, 0x03, 0x76, 0x81,
-    0x38, 0xD9, 0x23, 0x6E, 0x5B, 0x9D, 0xD4, 0xC2, 0x24, 0x95, 0x67, 0x13, 0xCD, 0xEB, 0x34, 0x63,
-    0x9D, 0x37, 0x47, 0x77, 0x69, 0xC6, 0x5D, 0x9A, 0x1F, 0x7C, 0xF3, 0x9F, 0x2B, 0xCD, 0x77, 0xEC,
-    0x3B, 0xA4, 0x60, 0x7A, 0x10, 0x42, 0xCE, 0xA6, 0xAF, 0xEE, 0xEE, 0x6E, 0x6F, 0x6E, 0x3E, 0x04,
-    0xE3, 0x35, 0xB6, 0xD6, 0xFB, 0x65, 0x93, 0xF0, 0x8F, 0x8B, 0x5B, 0x93, 0xB4, 0x78, 0x68, 0xE8,
-    0xF2, 0xB5, 0x57, 0x32, 0xED, 0xD3, 0xE2, 0x25, 0xD7, 0x02, 0x32, 0x6C, 0xD5, 0x9E, 0x2E, 0x37,
-    0xEF, 0xFB, 0x8B, 0xE9, 0x96, 0x2F, 0xDC, 0xC6, 0x3A, 0x85, 0x72, 0x6A, 0x97, 0x54, 0x18, 0xE1,
-    0x14, 0xA3, 0xD0, 0xD0, 0x7D, 0x12, 0xD1, 0xD9, 0x5A, 0x35, 0x9B, 0x0A, 0x17, 0x30, 0xBC, 0x78,
-    0x70, 0x79, 0x5A, 0x4E, 0x4B, 0x55, 0xAB, 0x83, 0x7A, 0x35, 0x58, 0xFB, 0x83, 0xBA, 0x0B, 0xDE,
-    0x66, 0x7E, 0x36, 0xC0, 0x9B, 0xF6, 0xE7, 0x8E, 0xC8, 0x20, 0x1A, 0x49, 0xE2, 0x91, 0xA4, 0xB6,
-    0x91, 0x65, 0x50, 0x06, 0x2B, 0x99, 0x3A, 0x41, 0x6B, 0x28, 0x47, 0x1B, 0x74, 0x74, 0x33, 0x2C,
-    0x09, 0xBC, 0x97, 0x8E, 0x1B, 0xDE, 0x78, 0x4C, 0xEB, 0xC9, 0x4C, 0x7A, 0x8E, 0xDF, 0xBE, 0xD5,
-    0x53, 0x3B, 0x18, 0x8B, 0x77, 0x6D, 0x7E, 0x82, 0xD8, 0x4C, 0x67, 0x45, 0xD4, 0x49, 0xF7, 0xFA,
-    0x2A, 0xDE, 0x21, 0x80, 0xEC, 0xA5, 0xF3, 0x35, 0x1A, 0xC4, 0xF0, 0x0C, 0xD6, 0x08, 0x73, 0x66,
-    0x91, 0x1C, 0xE3, 0xBE, 0x9E, 0xF1, 0xBE, 0x60, 0x91, 0x1E, 0x1F, 0xF3, 0x2F, 0xEA, 0x3E, 0x58,
-    0x4D, 0x33, 0x70, 0x5D, 0xF3, 0x37, 0xF8, 0x5D, 0x99, 0xD7, 0x88, 0x35, 0x55, 0x44, 0xDF, 0x48,
-    0x08, 0xFA, 0x08, 0x7B, 0x7E, 0x60, 0x22, 0xB0, 0x8A, 0xBE, 0x7B, 0x42, 0x47, 0x99, 0xAF, 0x09,
-    0xE3, 0x9C, 0x5A, 0x28, 0x6F, 0x68, 0xE4, 0x18, 0x5C, 0x11, 0xB5, 0xD0, 0xC4, 0xE1, 0x70, 0x8D,
-    0x24, 0x0B, 0xB5, 0x6F, 0x08, 0xD9, 0x41, 0x21, 0xCD, 0x62, 0x1D, 0x1A, 0xE2, 0xFA, 0x0B, 0x6D,
-    0x56, 0xBF, 0x6F, 0xDD, 0x54, 0x14, 0x3E, 0xF6, 0x25, 0xB1, 0xA8, 0x87, 0xCB, 0x50, 0x18, 0x5A,
-    0xA9, 0x9E, 0xF9, 0x95, 0xF7, 0x0F, 0x94, 0x67, 0x97, 0x0E, 0x0C, 0x0C, 0x0D, 0xA2, 0x61, 0x61,
-    0x60, 0x45, 0x0C, 0xCD, 0xDA, 0x21, 0x89, 0x2D, 0x31, 0x30, 0x74, 0xA0, 0x43, 0x11, 0x63, 0x3B,
-    0xB4, 0x42, 0xB4, 0x48, 0x61, 0xC8, 0x10, 0xA1, 0x34, 0xB6, 0xC4, 0xC0, 0xD0, 0xA1, 0x9E, 0x60,
-    0x60, 0xA8, 0x05, 0x45, 0x41, 0x61, 0xB9, 0x80, 0x0B, 0x7E, 0xA9, 0xED, 0xC3, 0x77, 0x8E, 0xFD,
-    0x5E, 0xD2, 0x0A, 0xBF, 0xE4, 0x5C, 0xFB, 0xF8, 0xFE, 0x38, 0xF7, 0x3B, 0xDF, 0x77, 0xAE, 0x89,
-    0xBC, 0x5B, 0x67, 0x88, 0x8C, 0x9B, 0xC2, 0x54, 0x6F, 0x11, 0x05, 0xE5, 0x06, 0x51, 0x58, 0xEC,
-    0x11, 0xD9, 0xAC, 0x81, 0xE1, 0x19, 0x51, 0xCA, 0x3D, 0xF9, 0xCC, 0x1D, 0x9E, 0xBE, 0x6C, 0x28,
-    0xEE, 0x82, 0x82, 0xB8, 0x0D, 0x0B, 0x8F, 0x5B, 0x9B, 0x99, 0xB6, 0xB1, 0x49, 0xD0, 0xD4, 0x11,
-    0x85, 0x7F, 0xBA, 0x09, 0xD9, 0xBF, 0x31, 0x93, 0xFD, 0x15, 0x33, 0x45, 0x07, 0x98, 0x29, 0xFA,
-    0x03, 0x33, 0x45, 0x5C, 0x34, 0x30, 0x17, 0x6A, 0x18, 0xDF, 0x61, 0x92, 0x8B, 0x62, 0x9E, 0xFE,
-    0xB6, 0x1F, 0x32, 0x73, 0x6F, 0xC4, 0x78, 0x62, 0x68, 0x61, 0xBC, 0x7F, 0x98, 0x6F, 0xFB, 0x8B,
-    0x98, 0xCC, 0x71, 0x4C, 0x85, 0xC4, 0x94, 0xD4, 0x34, 0xBF, 0xBC, 0x1C, 0xF1, 0xAD, 0x1F, 0xC7,
-    0xF7, 0xC5, 0xC7, 0x14, 0xCB, 0x5B, 0x2E, 0xF0, 0x8E, 0x71, 0x63, 0x3A, 0x98, 0x00, 0xA3, 0x28,
-    0x74, 0x30, 0x56, 0x4D, 0x45, 0xA7, 0x4F, 0x47, 0x15, 0x6D, 0xB5, 0x30, 0x69, 0x17, 0x39, 0x4A,
-    0x93, 0xA8, 0xA6, 0x4D, 0x8A, 0x5A, 0xDA, 0xC0, 0x24, 0x99, 0x98, 0x7E, 0xFF, 0x44, 0x7C, 0xBE,
-    0x86, 0x96, 0x8B, 0x99, 0xF0, 0xB0, 0xDA, 0x6D, 0x7A, 0xEE, 0xBA, 0x4C, 0x70, 0x77, 0x58, 0x95,
-    0x5B, 0x4A, 0xAB, 0xB3, 0x0E, 0xAB, 0xBC, 0x48, 0xAD, 0x2C, 0x8C, 0x58, 0x30, 0xAF, 0xEC, 0x43,
-    0xBA, 0x30, 0xCB, 0x1C, 0x4E, 0x6F, 0x16, 0xEF, 0xCF, 0xF0, 0xDD, 0xDB, 0x02, 0x42, 0x16, 0x31,
-    0x37, 0xE4, 0x4B, 0xBC, 0x93, 0x0C, 0x23, 0xE4, 0x46, 0xB6, 0x91, 0x63, 0x68, 0xFE, 0x18, 0x7D,
-    0xB1, 0xFA, 0x75, 0xC4, 0xC1, 0x0F, 0x58, 0x36, 0x2C, 0xD7, 0x3E, 0xBA, 0x56, 0xDA, 0x6B, 0xE2,
-    0xB4, 0x89, 0x31, 0xA8, 0x47, 0xD3, 0x0E, 0x4D, 0x3F, 0x34, 0x4C, 0x9E, 0x36, 0x99, 0x87, 0x61,
-    0x71, 0x5E, 0x68, 0xB3, 0x5D, 0xFA, 0x68, 0xD2, 0xCF, 0x9D, 0x36, 0xD7, 0x6A, 0x6D, 0x3E, 0x6D,
-    0x4D, 0x8B, 0x8E, 0x72, 0xF5, 0x63, 0xF3, 0x1A, 0x1F, 0xF2, 0xBD, 0xFE, 0x6B, 0xC0, 0x1A, 0x7F,
-    0xDF, 0x0A, 0xBA, 0x93, 0xA1, 0xB1, 0x07, 0x43, 0xF3, 0x54, 0x9B, 0x80, 0xB5, 0x31, 0xD8, 0x81,
-    0xC7, 0xA0, 0x87, 0x36, 0x34, 0x36, 0x29, 0xA2, 0x8A, 0x00, 0x9D, 0xD0, 0x89, 0x33, 0xF2, 0xFB,
-    0x6D, 0x38, 0xC3, 0x8A, 0xF2, 0x4C, 0x76, 0x9A, 0xEA, 0x3E, 0x3A, 0xA3, 0xCB, 0x5D, 0x62, 0xDD,
-    0x5C, 0x9C, 0x51, 0x9C, 0x20, 0xF6, 0xA0, 0x25, 0xF1, 0x57, 0x48, 0x0A, 0xEB, 0x16, 0x18, 0x60,
-    0xF0, 0xE1, 0x2A, 0xE0, 0x11, 0xF8, 0x86, 0x9C, 0x52, 0x2A, 0x28, 0x6B, 0xCA, 0x65, 0x00, 0xAE,
-    0xE8, 0xD8, 0xED, 0xAB, 0x3B, 0x54, 0xBC, 0x26, 0x4A, 0x1E, 0xC1, 0x13, 0xE1, 0x64, 0xEA, 0x1F,
-    0x80, 0xF4, 0x8F, 0x72, 0xE9, 0x4B, 0xDF, 0x92, 0x80, 0x4E, 0x6F, 0x50, 0xA4, 0x2F, 0xC9, 0x88,
-    0x17, 0x46, 0xA7, 0x73, 0x9A, 0x48, 0x3A, 0x4F, 0x31, 0x66, 0x6A, 0xEC, 0x1A, 0x86, 0xC4, 0x6C,
-    0x24, 0xA2, 0xE8, 0xBD, 0x44, 0x62, 0x0C, 0x25, 0x40, 0x27, 0xFD, 0xAD, 0xE4, 0x77, 0x97, 0x4C,
-    0x8D, 0x4D, 0x82, 0x67, 0x2D, 0x7E, 0x3E, 0x17, 0x29, 0x45, 0x09, 0x45, 0x5D, 0x54, 0x04, 0xC8,
-    0x59, 0xF4, 0x83, 0xF3, 0x10, 0xAB, 0xF7, 0xA4, 0x03, 0x00, 0xE6, 0xFA, 0x7D, 0xD0, 0xB0, 0x04,
-    0x2F, 0xD6, 0xCB, 0xB0, 0x01, 0x19, 0x1E, 0xD4, 0x88, 0x3B, 0xE5, 0x5F, 0x3A, 0xCA, 0x8B, 0x65,
-    0x2E, 0x43, 0x04, 0x1B, 0x66, 0xB2, 0x7C, 0x0D, 0x01, 0x42, 0x05, 0xE7, 0x25, 0x1E, 0xE1, 0x54,
-    0x44, 0x10, 0x89, 0xEF, 0x4C, 0xE5, 0xD1, 0x0A, 0x7E, 0xBB, 0xA6, 0x4A, 0x05, 0xC1, 0x7F, 0x15,
-    0x4C, 0xBD, 0xAD, 0xEC, 0xC5, 0x1E, 0x34, 0xAB, 0x53, 0xB7, 0x47, 0xF6, 0xDA, 0xA3, 0x4B, 0x19,
-    0xED, 0xB5, 0x4D, 0x4D, 0xE1, 0xA3, 0x87, 0x0F, 0x13, 0xDA, 0x6A, 0xF6, 0x1D, 0x05, 0xFC, 0x8E,
-    0x50, 0xC7, 0xC5, 0x88, 0x9D, 0x8D, 0xC0, 0x5C, 0x81, 0x55, 0xA6, 0x13, 0x9A, 0x4C, 0x0A, 0x5B,
-    0x92, 0xD7, 0x2A, 0x59, 0x05, 0xE4, 0xA3, 0x1B, 0x02, 0xB2, 0xA6, 0x01, 0x74, 0x75, 0x34, 0x4D,
-    0xCB, 0x75, 0x47, 0xB3, 0x16, 0x12, 0x33, 0x07, 0x80, 0xA0, 0xB0, 0x37, 0x13, 0xC4, 0x37, 0xDD,
-    0x24, 0x9A, 0xD2, 0xAC, 0x5E, 0x42, 0x44, 0x07, 0xE5, 0xC4, 0xAF, 0xE0, 0xDE, 0x0B, 0x8B, 0xE9,
-    0xA6, 0x8F, 0x42, 0x31, 0xAB, 0x21, 0x68, 0x71, 0xD3, 0x6A, 0x74, 0x33, 0xC1, 0xAE, 0xB6, 0x36,
-    0x3D, 0x47, 0xDE, 0xAC, 0x36, 0x15, 0x05, 0x07, 0x25, 0x30, 0x8B, 0x6F, 0x26, 0x76, 0x16, 0xF4,
-    0xA2, 0x45, 0x50, 0x88, 0x96, 0x05, 0x5D, 0xA2, 0x57, 0xB6, 0xB3, 0xB9, 0xF4, 0xE5, 0x31, 0xC0,
-    0xD3, 0xCB, 0x57, 0x20, 0x3D, 0xE6, 0x9A, 0x34, 0x0F, 0x14, 0x26, 0xE4, 0x77, 0x6F, 0x62, 0x03,
-    0xDD, 0x0E, 0x99, 0x23, 0x78, 0x56, 0x28, 0x4F, 0x90, 0xB8, 0x0E, 0x9D, 0x8D, 0xC3, 0x93, 0x2D,
-    0x90, 0x96, 0x98, 0xBC, 0xDA, 0x57, 0x62, 0xD5, 0x22, 0xAA, 0x52, 0x4C, 0x42, 0xCB, 0xFD, 0xAB,
-    0xB4, 0xB6, 0xB6, 0x76, 0x59, 0xC4, 0xE9, 0x44, 0xFE, 0xC5, 0xA2, 0xCE, 0xA8, 0xB2, 0x4B, 0xE4,
-    0x03, 0x65, 0x66, 0xE6, 0x25, 0x22, 0x26, 0x00, 0x03, 0xDC, 0x85, 0x4F, 0x31, 0x1C, 0x4A, 0x59,
-    0x09, 0xD2, 0x08, 0x53, 0x62, 0x21, 0x0D, 0xAB, 0x8E, 0xA0, 0x8B, 0x27, 0xE2, 0x49, 0xE0, 0xA9,
-    0xC7, 0x51, 0x02, 0x2B, 0x45, 0x33, 0x51, 0x37, 0x86, 0x29, 0x96, 0x91, 0xD0, 0xF0, 0xAC, 0xEC,
-    0x40, 0x25, 0xC2, 0xFC, 0x68, 0x91, 0xC4, 0xEE, 0xCE, 0x6A, 0x47, 0x6B, 0xC3, 0x14, 0x64, 0xA5,
-    0x87, 0xA9, 0x5F, 0x82, 0xED, 0xEF, 0xCB, 0xBC, 0x88, 0x1B, 0x15, 0x25, 0x41, 0x7C, 0x92, 0x20,
-    0x95, 0xD8, 0x34, 0xFD, 0x2C, 0xA1, 0x17, 0x22, 0x99, 0x2C, 0xC0, 0x06, 0x31, 0xED, 0x75, 0xD5,
-    0xBE, 0x14, 0x74, 0x44, 0x67, 0xDE, 0x6D, 0x17, 0xAA, 0x50, 0xD2, 0x4F, 0xB4, 0x2C, 0xB6, 0x1A,
-    0x33, 0x8D, 0xE5, 0x53, 0xA2, 0xCA, 0xE6, 0x72, 0xA5, 0xF0, 0x28, 0x67, 0x2D, 0x36, 0x22, 0x2E,
-    0x64, 0xC7, 0x62, 0x57, 0x72, 0xB5, 0x52, 0x4D, 0xF1, 0x2C, 0x35, 0x66, 0x7F, 0x88, 0x1B, 0x83,
-    0x55, 0xB4, 0x92, 0x38, 0x19, 0xAA, 0xDA, 0x95, 0x07, 0x2D, 0xCC, 0xA2, 0xDB, 0x51, 0xB2, 0x5A,
-    0xD9, 0xE6, 0x42, 0xF5, 0xFE, 0xE7, 0x41, 0xC3, 0x1A, 0xE3, 0x1C, 0x85, 0xEB, 0xCB, 0x6E, 0xE7,
-    0x0F, 0xE8, 0x78, 0x8B, 0x46, 0x16, 0x10, 0x9D, 0x53, 0xCF, 0xD5, 0x05, 0x37, 0x96, 0x72, 0xEC,
-    0xDF, 0xD7, 0x78, 0x70, 0x82, 0x71, 0x12, 0xF0, 0xDB, 0xE5, 0x12, 0x28, 0x1E, 0x0A, 0x54, 0x04,
-    0x86, 0xD8, 0x86, 0x76, 0x00, 0x4B, 0xE1, 0x4B, 0x3D, 0x11, 0xDE, 0x20, 0x68, 0xB8, 0x21, 0x56,
-    0xB8, 0xD3, 0x0C, 0x6E, 0x64, 0x39, 0xBC, 0x21, 0xC7, 0x47, 0xCC, 0xFD, 0x47, 0x8E, 0xA4, 0x20,
-    0x16, 0xA6, 0x58, 0x6F, 0x39, 0xB1, 0x14, 0xBF, 0xCF, 0xA8, 0x03, 0x6D, 0xC8, 0xE4, 0x02, 0x17,
-    0xF1, 0xC1, 0x8F, 0x79, 0xA1, 0xD5, 0x52, 0x41, 0x68, 0xD5, 0x3A, 0xB1, 0x00, 0xE6, 0x14, 0x1F,
-    0x25, 0x5A, 0x35, 0x86, 0x12, 0x32, 0xD4, 0x13, 0x5C, 0xA7, 0x34, 0xD6, 0x0F, 0x56, 0x07, 0xB0,
-    0x95, 0x48, 0x8A, 0x95, 0x19, 0x80, 0x3B, 0x4D, 0xEB, 0x83, 0xE4, 0x62, 0x25, 0x85, 0x40, 0x4C,
-    0x0A, 0xBE, 0xE6, 0x4D, 0x2D, 0xC0, 0xCF, 0x15, 0xF3, 0x9F, 0xD5, 0x76, 0xC3, 0x43, 0x79, 0xF2,
-    0x5C, 0x0A, 0x4F, 0xBE, 0x19, 0xBB, 0xA5, 0x3A, 0x6F, 0x20, 0x6B, 0x25, 0x58, 0xF3, 0xF0, 0x5E,
-    0xA7, 0x6B, 0xB2, 0xD3, 0x9C, 0x71, 0xA1, 0xE5, 0xBF, 0x1F, 0x78, 0x88, 0x3E, 0xAF, 0x33, 0xDF,
-    0x3A, 0x3E, 0x72, 0x87, 0x3D, 0xD8, 0xA1, 0x49, 0x65, 0xA7, 0x85, 0xE5, 0x6F, 0xFC, 0x76, 0x87,
-    0xE2, 0x30, 0x09, 0xDC, 0x0E, 0x6D, 0xA1, 0x29, 0x77, 0xE8, 0x3E, 0x9A, 0xEA, 0x2A, 0xA5, 0x90,
-    0x5D, 0x7B, 0x15, 0x0C, 0xFD, 0x1D, 0xF8, 0x39, 0x2C, 0x93, 0x2D, 0xF3, 0xE3, 0x11, 0x80, 0x4F,
-    0xEE, 0xE2, 0x5A, 0xE7, 0x61, 0x95, 0x67, 0xAE, 0x33, 0xF2, 0xE6, 0x2B, 0x0D, 0x56, 0x43, 0x7E,
-    0x96, 0xFC, 0xD2, 0x43, 0x8B, 0xF6, 0xE0, 0xAC, 0xE6, 0x67, 0xBC, 0xAA, 0x12, 0xA9, 0x23, 0xCD,
-    0xE2, 0xE8, 0x7C, 0x9E, 0xE7, 0xE1, 0x31, 0xF9, 0x95, 0xE7, 0x28, 0x79, 0x02, 0xE2, 0x03, 0xC9,
-    0x9A, 0xC8, 0xB6, 0x1E, 0x08, 0x75, 0x5E, 0x9C, 0x3F, 0x89, 0x3C, 0x51, 0x39, 0x83, 0x9A, 0x72,
-    0x70, 0x01, 0xE4, 0x43, 0x21, 0x58, 0xFA, 0x10, 0x23, 0xA2, 0x42, 0x4F, 0x6F, 0x3B, 0x1C, 0xBD,
-    0x42, 0x68, 0xBC, 0x04, 0xA3, 0x64, 0x4E, 0x68, 0x13, 0xC5, 0x0C, 0x15, 0x46, 0xFE, 0x4F, 0xA1,
-    0xBE, 0xEF, 0x83, 0x71, 0xBD, 0xE2, 0x9D, 0x22, 0xEC, 0xBC, 0xF6, 0xE8, 0x4E, 0x7D, 0x85, 0xBC,
-    0xA7, 0xF2, 0x25, 0xD1, 0xA8, 0x78, 0xF3, 0x9A, 0xA6, 0xDF, 0xD5, 0xB4, 0x71, 0xA1, 0xF6, 0x1B,
-    0xAF, 0x8E, 0x2A, 0xEF, 0x08, 0x27, 0xB5, 0x1C, 0x9D, 0x7D, 0x72, 0x02, 0x95, 0x73, 0x73, 0x6E,
-    0xEB, 0x8D, 0x2C, 0x21, 0xA5, 0x31, 0xC7, 0xBC, 0x28, 0xC4, 0x89, 0xE9, 0xFF, 0xC2, 0x0E, 0xAC,
-    0x2D, 0x83, 0xCA, 0x6D, 0xD1, 0x9E, 0x35, 0x55, 0x58, 0xB8, 0x15, 0xDC, 0xF8, 0x2E, 0xCC, 0x50,
-    0x73, 0x77, 0xAD, 0x5F, 0xE1, 0x66, 0xE5, 0xF8, 0x06, 0xAF, 0xAA, 0x40, 0xFA, 0x6C, 0xA0, 0x73,
-    0x50, 0xCA, 0x17, 0x97, 0xA7, 0xB9, 0x08, 0xB4, 0xE6, 0x4E, 0x0E, 0xA5, 0xA4, 0xA8, 0xE6, 0xF1,
-    0x49, 0x82, 0xBA, 0x06, 0xEE, 0x85, 0xA5, 0x9C, 0xD7, 0xF8, 0xEB, 0x25, 0x05, 0xF8, 0x40, 0x41,
-    0x36, 0x84, 0x85, 0x05, 0xCF, 0xBF, 0x96, 0xD8, 0xD9, 0xE1, 0xFC, 0x66, 0x7C, 0x31, 0x8C, 0x27,
-    0xB0, 0x4A, 0x5D, 0xD8, 0x54, 0x78, 0x9A, 0xCD, 0x40, 0x35, 0x32, 0xEA, 0x5C, 0x13, 0x32, 0x8A,
-    0x5D, 0x0F, 0xE6, 0x41, 0xE4, 0x7A, 0x5E, 0xFF, 0x07, 0x95, 0x54, 0x31, 0x4F, 0x14, 0x41, 0x14,
-    0x7E, 0xBB, 0x43, 0xB2, 0xC6, 0x85, 0x1D, 0x0A, 0xEC, 0x30, 0xDB, 0x50, 0x9A, 0xDB, 0x86, 0xE2,
-    0x0A, 0x60, 0x36, 0xB9, 0xC2, 0x4A, 0x42, 0xE1, 0xDA, 0x68, 0x82, 0xFF, 0x40, 0x4B, 0x0A, 0xB8,
-    0x1D, 0x63, 0x61, 0x61, 0xA2, 0xFC, 0x0D, 0x62, 0x81, 0x05, 0x8D, 0x86, 0x83, 0x4D, 0x48, 0x6C,
-    0x19, 0x49, 0x0C, 0x85, 0xCD, 0x24, 0x96, 0x14, 0x6E, 0xE2, 0x10, 0x2F, 0xF1, 0x60, 0xFD, 0xDE,
-    0xDC, 0x1E, 0x62, 0x23, 0x71, 0xB2, 0x6F, 0x33, 0xF3, 0xF6, 0xCD, 0xF7, 0xBE, 0x79, 0xEF, 0x9B,
-    0xA5, 0x40, 0x13, 0xD1, 0x32, 0x4C, 0x62, 0x22, 0x6A, 0x4C, 0x46, 0xB0, 0x0C, 0x16, 0x1B, 0xA2,
-    0x60, 0x88, 0x49, 0xD9, 0x34, 0xCD, 0x37, 0xD8, 0x65, 0x9A, 0x63, 0xB5, 0x05, 0x0B, 0x1D, 0x7F,
-    0xAF, 0xF0, 0x52, 0xD4, 0xEE, 0x10, 0x8C, 0x73, 0x35, 0x62, 0x44, 0x8A, 0x0B, 0x4C, 0x1A, 0x00,
-    0xA8, 0xC6, 0x52, 0x7A, 0xBC, 0x5E, 0x45, 0xD6, 0xA9, 0x70, 0x28, 0xF3, 0x8B, 0x2D, 0x72, 0xE2,
-    0x24, 0x97, 0xF9, 0x14, 0x11, 0x03, 0x49, 0x86, 0xFD, 0xC7, 0x64, 0x01, 0x16, 0x99, 0x96, 0xD5,
-    0x38, 0x59, 0xDD, 0x12, 0xA6, 0xBE, 0x67, 0x73, 0x08, 0x76, 0x5F, 0x61, 0x9C, 0x91, 0x49, 0x46,
-    0x16, 0x13, 0xA6, 0xBE, 0xC2, 0x71, 0x55, 0xBB, 0xE1, 0xDE, 0x84, 0xDD, 0xCD, 0x49, 0xE7, 0x30,
-    0xB9, 0x6F, 0x64, 0xBE, 0x9C, 0x69, 0x27, 0xCD, 0x81, 0xEC, 0xD5, 0xC1, 0xE8, 0x7C, 0x44, 0x51,
-    0x73, 0x89, 0xCF, 0x0D, 0x12, 0x2B, 0xE6, 0xB3, 0x77, 0xFD, 0xC8, 0x64, 0xE9, 0x3D, 0x27, 0x8C,
-    0x35, 0x3F, 0x1D, 0x0A, 0x6B, 0x46, 0xDB, 0x44, 0x6E, 0x23, 0x19, 0x54, 0x80, 0x5F, 0x33, 0xE2,
-    0x5A, 0x36, 0x27, 0xCC, 0xC6, 0x21, 0x0A, 0x61, 0x1D, 0xE2, 0x70, 0xC7, 0xE1, 0xC2, 0x70, 0xF8,
-    0x34, 0x45, 0xD7, 0x51, 0x67, 0xD0, 0x04, 0x24, 0x4D, 0x2F, 0x29, 0xFC, 0xB9, 0x4B, 0x2B, 0x49,
-    0x26, 0x6C, 0x37, 0x7D, 0x40, 0xF6, 0xAE, 0xAF, 0x78, 0x82, 0x88, 0xAE, 0xCF, 0xDD, 0x2E, 0x43,
-    0x2C, 0x53, 0x7C, 0xCD, 0x7A, 0x2F, 0x5C, 0xB6, 0x9A, 0x51, 0xFA, 0xB1, 0xE6, 0xBD, 0x24, 0xAD,
-    0x87, 0xF2, 0xA3, 0x78, 0x57, 0x81, 0x84, 0x68, 0x76, 0xD6, 0x24, 0x8E, 0xAB, 0x60, 0x3F, 0x1C,
-    0x45, 0x47, 0x8E, 0x52, 0xE1, 0x68, 0x43, 0xB8, 0xC0, 0x0A, 0x90, 0x13, 0xAE, 0x43, 0x58, 0xFB,
-    0xD2, 0x85, 0x94, 0xEE, 0xAC, 0xB1, 0x0E, 0xF4, 0xA3, 0x5D, 0x80, 0xC5, 0x28, 0xED, 0xA1, 0xA5,
-    0xF8, 0xB4, 0xA2, 0x41, 0x0A, 0x9D, 0x2C, 0xD1, 0x80, 0xEA, 0xD8, 0x88, 0x6A, 0x40, 0x12, 0xAA,
-    0x59, 0x62, 0x89, 0x6C, 0xC3, 0xE6, 0xC0, 0xBD, 0xF6, 0x08, 0xB7, 0x61, 0x4B, 0xE8, 0x4A, 0x1D,
-    0xD9, 0xA8, 0x8A, 0x4D, 0x07, 0x9B, 0xF6, 0x48, 0x1E, 0x19, 0x92, 0xC7, 0xE0, 0x86, 0x96, 0xCA,
-    0x3A, 0x03, 0x7A, 0xC3, 0xF5, 0x1D, 0x0F, 0x9C, 0x26, 0xFE, 0x94, 0x53, 0xBF, 0x83, 0x66, 0x6E,
-    0x42, 0x66, 0xB5, 0xA8, 0x45, 0xA5, 0x48, 0xA2, 0x4E, 0xCB, 0x59, 0x4E, 0x1F, 0x1C, 0x05, 0xE8,
-    0x43, 0x34, 0xE4, 0x7E, 0x34, 0x46, 0x35, 0x4D, 0x7E, 0xAD, 0x68, 0xAC, 0x4C, 0xDA, 0xA7, 0x56,
-    0x00, 0x63, 0x91, 0x7A, 0xF1, 0x78, 0x05, 0xCB, 0x2F, 0x45, 0xF1, 0x50, 0x72, 0x23, 0xDE, 0x72,
-    0xA0, 0x17, 0xCB, 0x38, 0xC6, 0xF7, 0x48, 0x97, 0x45, 0x51, 0xE4, 0x63, 0xEF, 0x01, 0xB5, 0x02,
-    0xA2, 0xA0, 0xFA, 0x03, 0x3F, 0xEB, 0x63, 0x35, 0x7B, 0x56, 0x04, 0xAB, 0x6B, 0xC8, 0x21, 0xCA,
-    0x42, 0x14, 0xE2, 0x97, 0x3E, 0x33, 0x94, 0xBD, 0x11, 0xAF, 0x4D, 0x38, 0xEC, 0x26, 0xB1, 0xC9,
-    0xB4, 0xED, 0xC6, 0x9F, 0x87, 0x42, 0xDB, 0xF8, 0x48, 0x27, 0x42, 0xDF, 0x42, 0xC3, 0x12, 0x2F,
-    0x97, 0xAE, 0x07, 0xE1, 0x34, 0x89, 0xBF, 0x3C, 0x37, 0xBB, 0xDB, 0x31, 0x4D, 0x13, 0xB5, 0x7A,
-    0x59, 0x8F, 0xCF, 0x28, 0x58, 0x90, 0xB4, 0x19, 0x80, 0xFB, 0x7A, 0xC5, 0xF7, 0x61, 0x74, 0x45,
-    0xDD, 0x47, 0x89, 0x9A, 0x9D, 0xF5, 0x9D, 0xA2, 0x78, 0xEC, 0x97, 0x2C, 0xF4, 0x70, 0x38, 0xB9,
-    0x50, 0x34, 0x7F, 0x85, 0xBE, 0xBD, 0xF0, 0xDF, 0xBC, 0xD8, 0x1D, 0xE6, 0x70, 0x4F, 0xA5, 0x39,
-    0xDC, 0x1B, 0x2A, 0xB7, 0xDD, 0xA8, 0x56, 0x3D, 0x6D, 0x4B, 0x52, 0xAB, 0xE2, 0x95, 0x25, 0xD5,
-    0x4D, 0xC0, 0xB2, 0xB4, 0x0A, 0xFB, 0x4B, 0xCD, 0x4D, 0xEE, 0x0B, 0x86, 0xDA, 0xF0, 0x9A, 0x7C,
-    0x3A, 0x4B, 0x7F, 0x0F, 0xE1, 0xF5, 0x13, 0x57, 0x7C, 0x87, 0xA4, 0x0E, 0x9C, 0x6F, 0xCF, 0xBE,
-    0x7F, 0x14, 0xF1, 0x52, 0x6A, 0x71, 0x8E, 0x93, 0x18, 0xDF, 0x45, 0xE7, 0x7B, 0x37, 0xE0, 0x5F,
-    0x01, 0xF5, 0xF9, 0xC4, 0xA1, 0xF3, 0x8D, 0x34, 0xC1, 0x45, 0x51, 0x94, 0x9A, 0xFF, 0x11, 0x78,
-    0x32, 0x1D, 0xB0, 0xCE, 0x2A, 0xFE, 0x77, 0x45, 0xFE, 0xC6, 0xB4, 0xC3, 0x17, 0xD2, 0xFF, 0xCB,
-    0xF0, 0x8A, 0xBE, 0xA3, 0x8E, 0xA5, 0x34, 0x14, 0xD7, 0xCA, 0x06, 0x4D, 0x75, 0x3A, 0x4C, 0xCF,
-    0x44, 0x6F, 0x94, 0xCC, 0xCF, 0x20, 0xE4, 0xF9, 0x22, 0xEB, 0x00, 0x01, 0x91, 0xC0, 0xA6, 0x79,
-    0xE6, 0x3E, 0x71, 0x05, 0x70, 0xAD, 0xA9, 0x27, 0x33, 0xB1, 0x3D, 0xAC, 0x17, 0x9B, 0xBC, 0xAC,
-    0x80, 0xA3, 0x5E, 0x22, 0x61, 0xF6, 0x0C, 0xC5, 0xCA, 0xB8, 0xDA, 0x59, 0xFB, 0x2F, 0xFB, 0x0D,
-    0xAD, 0x54, 0xB1, 0x8E, 0xD6, 0x46, 0x10, 0xFE, 0xD6, 0x0B, 0x18, 0xC9, 0x85, 0x2B, 0x22, 0xC1,
-    0x09, 0x9C, 0x07, 0x20, 0xF8, 0x05, 0xC8, 0xD9, 0xA2, 0xA1, 0xBD, 0xE2, 0xA0, 0x48, 0x45, 0x4D,
-    0x73, 0x6D, 0x0A, 0xEE, 0xEC, 0x47, 0xA0, 0x08, 0x6F, 0x40, 0x7F, 0x42, 0x4A, 0x91, 0xE2, 0x0E,
-    0x5B, 0xBA, 0x82, 0xE2, 0x1A, 0x4B, 0x14, 0x14, 0x29, 0x62, 0xA4, 0x2B, 0x92, 0x2A, 0x8B, 0xB4,
-    0x80, 0x2F, 0xB1, 0x3D, 0x7C, 0xB3, 0xFE, 0xFF, 0xFB, 0x4F, 0x88, 0x92, 0x95, 0x77, 0xD6, 0x1E,
-    0xCF, 0xCE, 0xCE, 0x7C, 0xF3, 0xED, 0x00, 0xC9, 0x73, 0x20, 0x1D, 0x00, 0x1C, 0x73, 0x6E, 0x73,
-    0xE6, 0x9C, 0x19, 0xE7, 0x9D, 0xD5, 0xBC, 0x07, 0x71, 0x3F, 0x25, 0x32, 0xFE, 0x9C, 0xF5, 0xF9,
-    0xFD, 0xA2, 0x4C, 0x8E, 0x0E, 0x60, 0xC7, 0x7D, 0x44, 0xC3, 0x31, 0x8C, 0xE7, 0x74, 0x0D, 0xAC,
-    0x2B, 0xEA, 0xA4, 0xCB, 0x45, 0xDA, 0x54, 0xA4, 0xB4, 0x32, 0x03, 0x55, 0x8F, 0x65, 0x18, 0x3E,
-    0xCD, 0x39, 0xA2, 0x1E, 0xB1, 0xC8, 0x10, 0x79, 0x24, 0xF2, 0xAF, 0xBC, 0x75, 0x48, 0x67, 0x64,
-    0xE2, 0x90, 0x4C, 0xA0, 0x7F, 0xD8, 0x29, 0x44, 0x11, 0x71, 0xA7, 0x15, 0x6A, 0x74, 0x69, 0x51,
-    0xB4, 0xB0, 0x9F, 0x3D, 0xB2, 0x0E, 0xB6, 0x9F, 0x11, 0x3B, 0xC4, 0x7D, 0x51, 0x9B, 0x91, 0x4B,
-    0xDA, 0xA3, 0xE2, 0x12, 0x8D, 0xC8, 0xDA, 0xB8, 0xC7, 0x6B, 0xC4, 0x3E, 0xEE, 0xC0, 0x9F, 0x53,
-    0xD2, 0x81, 0x3F, 0x8B, 0xD3, 0x0E, 0x89, 0x47, 0x2A, 0x5C, 0x46, 0x18, 0xF9, 0x68, 0xF6, 0xE8,
-    0xB3, 0x10, 0x8E, 0x9A, 0x5A, 0x8E, 0x96, 0x81, 0x70, 0xF4, 0x48, 0xFE, 0x5A, 0x96, 0xB6, 0x11,
-    0xB5, 0x6E, 0x4D, 0x33, 0x97, 0x30, 0x2D, 0xBE, 0x31, 0x18, 0x08, 0xC3, 0x1C, 0x29, 0x62, 0x7A,
-    0x63, 0x88, 0x4C, 0xD2, 0x4C, 0xFA, 0xDD, 0x14, 0x35, 0xDD, 0x3F, 0x74, 0x84, 0xAF, 0x65, 0x0E,
-    0x69, 0x9F, 0xD3, 0xBF, 0xB3, 0x03, 0xF8, 0x34, 0x88, 0x26, 0x64, 0x3D, 0x93, 0xB2, 0x23, 0xAA,
-    0x12, 0x55, 0xCD, 0xBC, 0x52, 0x47, 0x4D, 0x34, 0xA5, 0xDC, 0x51, 0xBD, 0xA1, 0x87, 0xF4, 0x93,
-    0x46, 0x33, 0x37, 0x2A, 0x0F, 0x97, 0xC0, 0x38, 0x34, 0xC4, 0x51, 0x75, 0xED, 0x36, 0xD2, 0xDA,
-    0xF6, 0x18, 0xF0, 0xBD, 0x5E, 0xCC, 0x0E, 0x76, 0xF1, 0x5D, 0xBD, 0x3A, 0x33, 0x6C, 0xE2, 0xA5,
-    0x38, 0xE5, 0xFB, 0xAF, 0x04, 0x88, 0x99, 0xC4, 0xB5, 0xF2, 0x08, 0xF8, 0x1D, 0x88, 0x88, 0x61,
-    0x52, 0x02, 0x77, 0xF9, 0x49, 0x90, 0xEF, 0x33, 0xF5, 0x12, 0x96, 0x4A, 0x72, 0xF0, 0x80, 0x10,
-    0xD7, 0x5A, 0x67, 0xAC, 0xB6, 0x37, 0x5A, 0x27, 0x1D, 0x37, 0x1E, 0xF0, 0xAB, 0x5A, 0x7F, 0xB1,
-    0x90, 0x84, 0xCC, 0xC8, 0x4C, 0xEE, 0x26, 0x5D, 0x50, 0x04, 0xAA, 0x29, 0x8D, 0x91, 0xB6, 0x5F,
-    0x2B, 0x36, 0x16, 0xD1, 0x18, 0x14, 0x01, 0x5B, 0x56, 0xE2, 0x42, 0xE1, 0x82, 0x82, 0x41, 0xFE,
-    0x68, 0xD5, 0xB1, 0x57, 0x85, 0xF5, 0x0D, 0x15, 0xC9, 0xFF, 0x93, 0x1A, 0x88, 0x5A, 0xE4, 0xE1,
-    0xF8, 0x62, 0x56, 0xE3, 0xC6, 0xAB, 0x7C, 0xA4, 0x3E, 0x70, 0xB3, 0x34, 0x2F, 0x95, 0x6A, 0xD5,
-    0x08, 0x91, 0x13, 0x19, 0x93, 0xB3, 0xEC, 0xB0, 0xF6, 0xC4, 0xC4, 0xE3, 0x83, 0x23, 0x41, 0xA3,
-    0xD3, 0x9A, 0x08, 0xC5, 0xF7, 0x34, 0xC7, 0xDB, 0x7F, 0xF0, 0xB6, 0xE0, 0x15, 0xD5, 0x7D, 0xF2,
-    0xA6, 0x37, 0x84, 0x2A, 0xD5, 0x82, 0xFB, 0x4C, 0xA6, 0x42, 0xEA, 0x4C, 0xBA, 0x62, 0xC0, 0xB5,
-    0xBF, 0x71, 0x75, 0xC9, 0x73, 0x2B, 0x24, 0xA0, 0xC9, 0x92, 0x48, 0xD7, 0x95, 0x77, 0xFD, 0x26,
-    0xC5, 0x45, 0x12, 0x30, 0x0D, 0x2D, 0x04, 0x52, 0x94, 0x17, 0x99, 0xAE, 0x64, 0x15, 0xE4, 0x41,
-    0x90, 0xC7, 0x97, 0xE4, 0xF8, 0xB5, 0x34, 0xE3, 0x06, 0xB0, 0x28, 0x48, 0x1B, 0x32, 0xB4, 0x6E,
-    0x23, 0x63, 0xB7, 0x46, 0xCF, 0xD4, 0x39, 0x41, 0xCD, 0x42, 0x3D, 0x1A, 0xBD, 0x52, 0x7A, 0xB5,
-    0x02, 0x5F, 0xA7, 0x00, 0xCE, 0xD9, 0xC5, 0x95, 0xC9, 0x4F, 0xC6, 0xE2, 0xDD, 0x54, 0xBD, 0xDF,
-    0xDD, 0xDC, 0xA2, 0x68, 0x2C, 0x4E, 0xA6, 0xEA, 0xCF, 0x00, 0x23, 0x2F, 0xBC, 0x79, 0xF0, 0x9F,
-    0x87, 0x1B, 0xD2, 0xF2, 0xD9, 0xBE, 0xF1, 0xDB, 0x39, 0x81, 0x64, 0x16, 0x4F, 0x97, 0xDE, 0xB1,
-    0x13, 0xFA, 0x80, 0x3D, 0x71, 0x47, 0xC6, 0xF9, 0xA4, 0x3D, 0xDA, 0xC7, 0xEB, 0xE9, 0x07, 0xC4,
-    0xF3, 0x85, 0xAB, 0x7A, 0xD5, 0xA4, 0xA0, 0xA1, 0x29, 0xAD, 0xF0, 0x4C, 0xC3, 0xED, 0xB0, 0xF0,
-    0xED, 0xAA, 0xDF, 0x61, 0x57, 0x92, 0xF7, 0xCB, 0x85, 0x0F, 0xEA, 0x7C, 0x6D, 0x9D, 0xEA, 0xDE,
-    0x4A, 0x26, 0xED, 0x06, 0xA4, 0xD6, 0xA3, 0xCB, 0xEA, 0x23, 0x75, 0xD2, 0xAF, 0x50, 0x34, 0xFE,
-    0x72, 0x0F, 0x78, 0xB2, 0x06, 0x2B, 0xD1, 0x84, 0xF3, 0x49, 0x79, 0xE8, 0xB5, 0x21, 0x74, 0x4A,
-    0x10, 0x46, 0xD0, 0x28, 0x7A, 0x8D, 0x6E, 0xCE, 0xCF, 0x43, 0xA7, 0x60, 0x3B, 0xC1, 0x5E, 0x90,
-    0x04, 0x8C, 0x8C, 0xDD, 0x0A, 0x50, 0x6D, 0x05, 0x32, 0x2D, 0x90, 0x5E, 0x31, 0x21, 0x5B, 0xF9,
-    0x67, 0x27, 0xC0, 0x39, 0xFF, 0x86, 0x1B, 0x87, 0xC1, 0x08, 0x8F, 0x9F, 0xDB, 0x50, 0xD3, 0x00,
-    0x6B, 0x31, 0x04, 0xAB, 0x33, 0xAC, 0x8E, 0xA3, 0x3F, 0xFD, 0x99, 0x2F, 0x84, 0xD4, 0xC3, 0x22,
-    0x2D, 0x85, 0xD1, 0xC3, 0xF7, 0x84, 0x3C, 0x12, 0x39, 0x33, 0x0D, 0x4B, 0x62, 0xC3, 0xB9, 0x72,
-    0xBE, 0xA6, 0xC8, 0x15, 0x6C, 0x9A, 0x33, 0x7E, 0x91, 0xFE, 0x96, 0x42, 0x50, 0xC8, 0xFC, 0x02,
-    0xB7, 0x42, 0x9D, 0xBE, 0x00,
+static const uint8_t opendyslexic_14_regularBitmaps[30901] = {
+    0xD5, 0x9B, 0x3F, 0xCC, 0xE7, 0xC6, 0x99, 0xDF, 0x3F, 0xE4, 0xDC, 0x2E, 0x2F, 0x62, 0x7C, 0xA3,
+    0xE2, 0x64, 0x5C, 0xAC, 0x48, 0x6C, 0x52, 0x18, 0x86, 0xA4, 0x69, 0x5C, 0xB8, 0xD8, 0x7D, 0x87,
+    0x96, 0x80, 0xA8, 0x50, 0xE1, 0x05, 0x72, 0xAB, 0x00, 0x71, 0xE1, 0x2B, 0x52, 0x9C, 0x9D, 0x04,
+    0x9B, 0x22, 0x85, 0x8B, 0xDD, 0x97, 0xB4, 0x16, 0xB8, 0x2D, 0x04, 0xC4, 0x6F, 0x90, 0xF8, 0x80,
+    0x24, 0xC5, 0xA9, 0xB0, 0x83, 0xD3, 0x5E, 0x21, 0x03, 0x51, 0x21, 0xE0, 0xF6, 0x7D, 0x39, 0xD2,
+    0x16, 0x2A, 0x54, 0x88, 0xB2, 0x0B, 0x15, 0x06, 0x22, 0x0A, 0x92, 0xA1, 0x58, 0x2E, 0x34, 0xB2,
+    0x29, 0x98, 0x2B, 0x0D, 0xF9, 0xBD, 0x62, 0x7E, 0xEF, 0xBB, 0xEF, 0xAE, 0xE4, 0x3F, 0x89, 0xE5,
+    0x83, 0xCD, 0x77, 0x66, 0x48, 0xCE, 0x8F, 0x2F, 0xE7, 0xDF, 0x33, 0xCF, 0xBF, 0xEF, 0x43, 0x9E,
+    0xA9, 0x83, 0xE3, 0x86, 0x89, 0x36, 0x78, 0x92, 0x89, 0x36, 0xF8, 0x22, 0x55, 0xB1, 0x09, 0x43,
+    0x99, 0xEA, 0xE8, 0x82, 0x4C, 0xAA, 0x23, 0x50, 0xCF, 0x7E, 0xD2, 0x55, 0x35, 0x69, 0x88, 0xDD,
+    0x34, 0xBC, 0xBC, 0xD6, 0xA9, 0x0B, 0x7A, 0x39, 0xD9, 0xA5, 0xEB, 0xF5, 0xC4, 0x62, 0xE7, 0xA1,
+    0xD7, 0x13, 0xC9, 0xCE, 0x00, 0xD0, 0x50, 0xF7, 0x40, 0x1D, 0xCC, 0x04, 0x98, 0xC8, 0x02, 0xB0,
+    0x70, 0x1E, 0x60, 0x8F, 0xA6, 0x05, 0x9A, 0xBE, 0x1A, 0x81, 0x6A, 0x2C, 0x23, 0x74, 0x92, 0xA4,
+    0xCD, 0x49, 0x92, 0xF4, 0x2F, 0xAF, 0x0F, 0xD7, 0x9F, 0x7B, 0xF7, 0x7A, 0x8F, 0x0D, 0x26, 0x02,
+    0x26, 0x16, 0x0B, 0x50, 0x24, 0xF6, 0x01, 0x06, 0x5C, 0x0F, 0xB8, 0xBE, 0x1E, 0x01, 0x3B, 0x99,
+    0x19, 0x7C, 0xFE, 0x4F, 0x9B, 0x4F, 0x7F, 0x75, 0xFC, 0x82, 0x66, 0xAC, 0x22, 0x50, 0xC7, 0x32,
+    0x01, 0x26, 0x31, 0x00, 0x08, 0x1F, 0x00, 0x1F, 0xEC, 0x04, 0x9C, 0xB9, 0x50, 0x5C, 0x00, 0xE0,
+    0x9F, 0x9C, 0x01, 0xA8, 0x5E, 0x1A, 0x81, 0x22, 0x3E, 0x0F, 0x14, 0xD2, 0xFF, 0x85, 0x5A, 0x52,
+    0x2E, 0x7B, 0x2A, 0xDD, 0xFA, 0xE0, 0x00, 0xA3, 0x1B, 0x0F, 0x03, 0x6A, 0xEA, 0x16, 0xBA, 0xC7,
+    0x5F, 0x1A, 0xA1, 0x79, 0x2D, 0x3E, 0x0F, 0x26, 0x5D, 0x7E, 0x18, 0x90, 0xEA, 0x16, 0xAC, 0x34,
+    0x01, 0x92, 0x0E, 0xE0, 0xAC, 0xB4, 0x01, 0xF6, 0x92, 0x66, 0x30, 0x2F, 0x49, 0x40, 0xFC, 0x7B,
+    0x45, 0x38, 0xF7, 0xB0, 0x56, 0xB0, 0x75, 0xA7, 0x76, 0xEF, 0x7F, 0xBE, 0x2E, 0x05, 0x27, 0x49,
+    0xB1, 0xB9, 0x5D, 0xCE, 0xB5, 0x24, 0x4D, 0xDC, 0x2F, 0x6D, 0x2D, 0x70, 0xEE, 0x61, 0x00, 0x5B,
+    0xB7, 0x80, 0x79, 0x6A, 0xE4, 0xAE, 0xC3, 0x04, 0xE0, 0x21, 0xEE, 0xA3, 0x98, 0x6A, 0x61, 0x79,
+    0xBE, 0xE1, 0x05, 0xD3, 0x3F, 0x60, 0xC2, 0x67, 0xF8, 0xE2, 0x79, 0xFE, 0x13, 0x6F, 0xC6, 0x62,
+    0x34, 0x5F, 0x69, 0x4D, 0x38, 0xFF, 0x02, 0xB5, 0x7E, 0x11, 0xA8, 0xB5, 0x07, 0x67, 0xFE, 0xCB,
+    0xCF, 0x56, 0xB0, 0x47, 0x47, 0x70, 0x14, 0x1E, 0xA2, 0xFA, 0x3F, 0x7C, 0x89, 0xBD, 0x2F, 0x32,
+    0x95, 0x71, 0x32, 0xBD, 0xBD, 0x1A, 0x1E, 0x24, 0xD5, 0xEF, 0xC6, 0x6A, 0xB4, 0xEA, 0x3D, 0xF5,
+    0x5C, 0xCE, 0x77, 0x36, 0x7A, 0x56, 0x23, 0x18, 0x29, 0xC0, 0xD6, 0x0E, 0xD0, 0xF4, 0xE5, 0x4C,
+    0x39, 0xE3, 0x5A, 0x5C, 0x6F, 0x66, 0x8A, 0x95, 0x01, 0xEA, 0xB9, 0x0B, 0xE0, 0xDE, 0x8B, 0xC0,
+    0xB0, 0x00, 0xB5, 0x00, 0xA3, 0x05, 0x18, 0xDE, 0x98, 0xA0, 0x89, 0xBE, 0x3F, 0xFB, 0x5F, 0x57,
+    0x06, 0x36, 0x1F, 0xCA, 0xD4, 0xBC, 0x9E, 0xA8, 0x7E, 0x91, 0xBA, 0x91, 0x46, 0x8F, 0x0B, 0x86,
+    0xC9, 0xAF, 0x74, 0x6B, 0x71, 0x32, 0x2B, 0x4F, 0x87, 0x46, 0x1A, 0xEF, 0xE5, 0x7E, 0x1D, 0xEC,
+    0x3A, 0xD2, 0xBD, 0xBE, 0x76, 0xAF, 0xA4, 0xE1, 0xE9, 0x65, 0x78, 0x7A, 0x01, 0xAA, 0xC0, 0x42,
+    0x83, 0x99, 0xB8, 0x8C, 0xED, 0x8B, 0x88, 0xDB, 0x5D, 0x07, 0x16, 0x9A, 0xB6, 0x8C, 0x38, 0x4C,
+    0xC4, 0xEF, 0x8A, 0xE9, 0xE4, 0x2A, 0xE2, 0x28, 0x66, 0x6C, 0x4F, 0xC2, 0x06, 0x0E, 0xA9, 0x22,
+    0x9E, 0x72, 0xA6, 0x09, 0x24, 0xEA, 0x09, 0x8F, 0x59, 0x68, 0xC2, 0xEE, 0xB5, 0x7B, 0xB9, 0x25,
+    0x87, 0x19, 0x49, 0xB9, 0xC1, 0x84, 0xA3, 0x0A, 0xC5, 0xCC, 0x1E, 0xB6, 0x37, 0x13, 0x0B, 0xFE,
+    0xF8, 0xE2, 0x0A, 0x4D, 0x5B, 0x07, 0x13, 0x49, 0xEC, 0xE3, 0x5A, 0x1B, 0xAA, 0xA9, 0x9C, 0x49,
+    0x0C, 0xF8, 0xB6, 0x09, 0x76, 0xAA, 0x62, 0x1E, 0xCC, 0x39, 0x20, 0x72, 0xC6, 0x84, 0x2F, 0xEE,
+    0xDB, 0x7A, 0x1C, 0xFE, 0xC3, 0x42, 0xA3, 0x96, 0x7A, 0xA6, 0xD0, 0x4A, 0xF7, 0xEF, 0x87, 0xAB,
+    0xF1, 0xFB, 0x7B, 0x55, 0x39, 0xDE, 0x4B, 0xDD, 0xC2, 0xC3, 0x40, 0xDD, 0xC3, 0x02, 0xF6, 0xF4,
+    0x69, 0x90, 0x7E, 0x2A, 0x6D, 0x77, 0x56, 0x62, 0x7B, 0xF8, 0xB7, 0x80, 0x4D, 0x76, 0xB1, 0x73,
+    0x13, 0x9B, 0xE8, 0x26, 0x3F, 0x76, 0x01, 0x06, 0xE9, 0x15, 0x29, 0x0D, 0x52, 0x68, 0x1E, 0x5B,
+    0xFC, 0xCD, 0xD4, 0x05, 0xA0, 0xC8, 0x93, 0x49, 0x39, 0x01, 0xF3, 0xAE, 0x6F, 0x8E, 0xFC, 0x22,
+    0x33, 0x42, 0x11, 0x81, 0x17, 0x80, 0xF3, 0x40, 0x03, 0xD4, 0x01, 0xCC, 0x04, 0xC5, 0x0C, 0xDC,
+    0x00, 0xFC, 0xEE, 0xE9, 0x2A, 0x80, 0x89, 0xC0, 0x02, 0x5C, 0x39, 0x7E, 0x4D, 0x80, 0x6A, 0x82,
+    0x72, 0x06, 0x12, 0xB0, 0x07, 0x34, 0x6D, 0xFE, 0xC1, 0x44, 0x28, 0x16, 0xE0, 0x70, 0xF7, 0x9A,
+    0x26, 0x40, 0x3D, 0xED, 0x5E, 0x93, 0x80, 0x7D, 0xC0, 0xEF, 0x9E, 0xAE, 0x22, 0x94, 0x11, 0x98,
+    0x80, 0x7B, 0x01, 0x70, 0x33, 0xE5, 0x7C, 0x89, 0x3A, 0x54, 0xC1, 0xB6, 0xE5, 0xE4, 0x28, 0xE2,
+    0x1E, 0xCC, 0xFB, 0xA6, 0x5F, 0xAE, 0xD4, 0x21, 0x1D, 0xD6, 0xE1, 0xC6, 0x61, 0x3E, 0xA7, 0x23,
+    0xD3, 0xA7, 0x23, 0x8A, 0x34, 0x50, 0xA6, 0xAE, 0x35, 0x8B, 0x0F, 0xF5, 0xE2, 0x6F, 0x5D, 0x9A,
+    0x9D, 0x14, 0xAD, 0x34, 0x55, 0x52, 0x28, 0x25, 0x70, 0x33, 0xFC, 0x11, 0x74, 0x01, 0x45, 0xF6,
+    0x13, 0x7F, 0xE6, 0xC1, 0x06, 0x4C, 0x84, 0x04, 0x1E, 0x9A, 0x40, 0x15, 0x29, 0x12, 0x74, 0xD0,
+    0x04, 0xEA, 0x48, 0x99, 0x60, 0x00, 0x17, 0x6A, 0xE9, 0x43, 0x69, 0x1B, 0xA4, 0xE7, 0xA4, 0x89,
+    0xFB, 0xC0, 0x69, 0x32, 0x52, 0x6C, 0x0E, 0x9A, 0x78, 0x01, 0x3B, 0xE6, 0x31, 0xFA, 0x3C, 0xBC,
+    0x2A, 0x82, 0xEF, 0x29, 0x57, 0x68, 0x22, 0xA5, 0xC0, 0xCF, 0x54, 0x6A, 0x19, 0x16, 0x6C, 0x3E,
+    0x99, 0xCC, 0xFE, 0x52, 0x27, 0xFD, 0x4C, 0xD2, 0x78, 0x56, 0x13, 0x83, 0x96, 0xB2, 0x2D, 0x96,
+    0xBC, 0x60, 0xC5, 0x94, 0x67, 0xFE, 0x41, 0x60, 0xE6, 0xBE, 0x4B, 0xBD, 0xD1, 0x8C, 0xD5, 0x01,
+    0x34, 0x11, 0xEA, 0x98, 0xE7, 0xCE, 0xB7, 0xB0, 0x42, 0x15, 0xBF, 0x7E, 0x51, 0x37, 0xA5, 0xCD,
+    0x4A, 0x71, 0xD0, 0xC6, 0xA5, 0xAD, 0x07, 0xFE, 0x68, 0xB7, 0xEE, 0x37, 0xA0, 0x58, 0xC1, 0xAC,
+    0x60, 0x57, 0x70, 0xFB, 0xD0, 0xED, 0x41, 0xDA, 0xC3, 0xCC, 0x7B, 0x54, 0xD1, 0x63, 0x83, 0xC7,
+    0xB7, 0x9E, 0xE1, 0xBA, 0xD2, 0x90, 0xBB, 0x95, 0xA0, 0x6B, 0x73, 0x1E, 0x5A, 0x18, 0xFA, 0xDB,
+    0x19, 0xA4, 0xCD, 0x48, 0x8B, 0x6D, 0x33, 0xFD, 0xCC, 0x99, 0xA6, 0x8E, 0x6F, 0x6F, 0xB5, 0x18,
+    0xA9, 0x6D, 0xA4, 0xF0, 0xA7, 0xB8, 0x00, 0xAE, 0x87, 0x0E, 0x8A, 0x04, 0x75, 0x6C, 0xE9, 0x6E,
+    0xDE, 0xBA, 0xB4, 0x59, 0x29, 0x76, 0xD2, 0x53, 0xD2, 0x5C, 0x0C, 0xB7, 0x80, 0x5A, 0x13, 0x83,
+    0xA6, 0x72, 0xBB, 0xD8, 0xD6, 0x53, 0x26, 0x3D, 0xB7, 0x23, 0xAC, 0x2B, 0xC0, 0x95, 0x6E, 0xE5,
+    0x48, 0x0A, 0xC3, 0xDC, 0x4C, 0x43, 0x6F, 0xE6, 0x81, 0x62, 0x19, 0x20, 0x75, 0x90, 0x3C, 0x24,
+    0xDF, 0x16, 0xC9, 0x8D, 0xD5, 0x62, 0xA5, 0x58, 0x49, 0x63, 0x21, 0xB5, 0xB8, 0x05, 0xB2, 0x30,
+    0x18, 0xA4, 0x48, 0xB1, 0x0F, 0xD5, 0x08, 0x87, 0x79, 0xF6, 0x12, 0x34, 0x81, 0x72, 0x01, 0xDF,
+    0x53, 0xCD, 0x30, 0xB4, 0xD8, 0x08, 0xCA, 0xEB, 0xB6, 0x81, 0x9F, 0x30, 0x2B, 0x0C, 0x01, 0x9B,
+    0x40, 0x81, 0xFB, 0x37, 0x70, 0x7F, 0xBD, 0xE0, 0xB0, 0xAD, 0x6D, 0x8B, 0x58, 0x05, 0xCE, 0x97,
+    0x11, 0xDB, 0x5E, 0xA1, 0x1A, 0x6D, 0x30, 0xB1, 0x5C, 0xAB, 0x05, 0xA7, 0x85, 0x52, 0x33, 0x95,
+    0x14, 0xAA, 0xB9, 0x5C, 0xCD, 0x8C, 0x7B, 0x31, 0x61, 0xE2, 0x11, 0xAC, 0x2E, 0xE0, 0x9F, 0x9E,
+    0x69, 0x46, 0xF5, 0x2E, 0x3A, 0x69, 0x2E, 0xA4, 0x99, 0xB3, 0x3A, 0x80, 0x6E, 0xC6, 0x2A, 0xB1,
+    0x96, 0xA9, 0x0E, 0xE5, 0x72, 0x05, 0xF3, 0xB3, 0x88, 0xFD, 0x51, 0xC0, 0x3D, 0x07, 0xC3, 0x65,
+    0x8A, 0x75, 0xA1, 0xFE, 0xF9, 0x42, 0x77, 0x53, 0x52, 0x25, 0xA5, 0x72, 0x78, 0x67, 0x47, 0x08,
+    0x7B, 0x50, 0xCE, 0xF7, 0xD2, 0x84, 0xFC, 0xCB, 0xDC, 0x48, 0xFD, 0x25, 0x4D, 0xB8, 0x9B, 0xC9,
+    0xBF, 0xBE, 0x76, 0x6F, 0xFE, 0xF9, 0x6D, 0xDE, 0x5F, 0x26, 0x7F, 0x73, 0xED, 0x7E, 0xB4, 0x81,
+    0x8D, 0x36, 0xDA, 0xD8, 0xCC, 0xEE, 0x2E, 0xE9, 0xF0, 0x71, 0x26, 0xC3, 0x6E, 0x6B, 0x16, 0x11,
+    0x70, 0x11, 0x4A, 0x8D, 0x70, 0x69, 0x85, 0x4A, 0x23, 0x0C, 0xB7, 0xA0, 0x56, 0xBF, 0x93, 0x12,
+    0xC3, 0x08, 0x0C, 0x5B, 0x0B, 0x4E, 0x5B, 0x4B, 0x31, 0xE8, 0x16, 0x94, 0xD2, 0x02, 0x67, 0x95,
+    0x80, 0xFB, 0x13, 0xC0, 0x43, 0x70, 0xDF, 0xA3, 0x99, 0xD6, 0xC2, 0xE9, 0xD6, 0x8B, 0x72, 0x50,
+    0xEA, 0xA4, 0x17, 0x2F, 0xEC, 0xD8, 0xC1, 0x23, 0x00, 0xEE, 0x6D, 0xA0, 0x56, 0x7B, 0x5B, 0x14,
+    0xF5, 0xC0, 0xB0, 0xB2, 0xEB, 0x02, 0x5D, 0x02, 0xEA, 0x04, 0xA5, 0x12, 0xC5, 0xA0, 0xA5, 0x18,
+    0xB4, 0xD2, 0x69, 0x6B, 0x19, 0x74, 0xB0, 0xEB, 0xD5, 0x77, 0x4F, 0x5A, 0xB9, 0xEF, 0x02, 0xA5,
+    0xD4, 0x5A, 0x69, 0x72, 0xE3, 0xA5, 0xF9, 0x41, 0x4C, 0x02, 0x56, 0xE0, 0xE8, 0xAE, 0xBC, 0xE6,
+    0x4D, 0x6D, 0x96, 0xBC, 0xED, 0xDC, 0x08, 0xEA, 0xA9, 0x05, 0xCD, 0x02, 0xCD, 0xF4, 0x09, 0x79,
+    0xCC, 0x7B, 0xEF, 0xF8, 0xA8, 0x47, 0x32, 0x8B, 0x98, 0xC0, 0x4D, 0x79, 0x02, 0x6F, 0x4B, 0xE2,
+    0x83, 0x4C, 0xA1, 0x01, 0xAA, 0x5B, 0x74, 0x2D, 0xE5, 0x02, 0x97, 0x33, 0x0B, 0x8E, 0xB8, 0x16,
+    0xAA, 0xDE, 0x4C, 0xF5, 0xBB, 0x9C, 0x23, 0x99, 0x77, 0x62, 0x19, 0x6C, 0xFF, 0x1F, 0x2D, 0x0F,
+    0x14, 0xCB, 0x3D, 0xC4, 0x62, 0x74, 0xED, 0x58, 0xF3, 0x70, 0xB9, 0x7C, 0x86, 0x68, 0x82, 0x0B,
+    0x1F, 0x0E, 0xED, 0x0B, 0x65, 0xAA, 0x34, 0x7B, 0xDC, 0xD4, 0xBC, 0xA5, 0x50, 0xA8, 0xC5, 0x4E,
+    0xD8, 0x35, 0x4B, 0xDB, 0x05, 0xA0, 0xD4, 0xAD, 0x8B, 0x87, 0x79, 0x57, 0x4C, 0xE0, 0x24, 0x01,
+    0x4E, 0x8A, 0xC0, 0xFD, 0xFA, 0xC9, 0x29, 0x3A, 0x18, 0x61, 0xB7, 0xE3, 0x8D, 0x00, 0x9A, 0x15,
+    0xE0, 0x28, 0x01, 0xE6, 0xE7, 0x11, 0x68, 0x9E, 0x9E, 0x80, 0xB5, 0x09, 0x60, 0xA2, 0x6F, 0xC1,
+    0xF5, 0x47, 0xC0, 0x5A, 0x24, 0xA8, 0xA2, 0x99, 0xC1, 0xF5, 0x75, 0x84, 0x75, 0xC7, 0x5D, 0x7D,
+    0x8F, 0xEF, 0x19, 0x60, 0x85, 0x95, 0x5A, 0x52, 0xC2, 0x4B, 0x8A, 0x85, 0x24, 0x4D, 0x56, 0x92,
+    0x82, 0x0F, 0xA0, 0x47, 0x37, 0x28, 0x37, 0x3B, 0x43, 0x95, 0xBA, 0x00, 0x76, 0xBE, 0xEF, 0xE2,
+    0x05, 0x0A, 0x69, 0xA3, 0x92, 0x44, 0x13, 0x18, 0xE8, 0xE0, 0xB0, 0x48, 0xB0, 0x54, 0x11, 0x33,
+    0x35, 0x81, 0xA6, 0xEF, 0x28, 0x52, 0x21, 0x69, 0xAC, 0xA4, 0x85, 0x46, 0xDA, 0xE8, 0x28, 0xF4,
+    0xE5, 0x04, 0x43, 0x15, 0x73, 0x5F, 0xCB, 0xA5, 0x03, 0xFB, 0x7E, 0x02, 0xFF, 0x72, 0xA4, 0x50,
+    0x13, 0x70, 0xA9, 0x93, 0xF4, 0xA6, 0x24, 0x3D, 0x2E, 0x69, 0x69, 0x24, 0xF5, 0x5D, 0x56, 0x09,
+    0x33, 0x55, 0x0E, 0xB7, 0xE0, 0x92, 0x36, 0x4A, 0x69, 0xC5, 0xEA, 0xE2, 0x5F, 0xE2, 0x67, 0x40,
+    0x01, 0x0A, 0x65, 0x75, 0x15, 0xAA, 0x85, 0x4C, 0x25, 0xD8, 0x08, 0xD8, 0x89, 0xBC, 0xEA, 0xBB,
+    0x22, 0x02, 0xCD, 0x0C, 0x34, 0x09, 0xB0, 0xEA, 0x39, 0x63, 0xF5, 0xE1, 0x93, 0x47, 0xB5, 0x32,
+    0x43, 0xD5, 0x56, 0x48, 0xDA, 0x18, 0xA4, 0x0D, 0xA7, 0xDC, 0x5A, 0xA6, 0xD9, 0x4E, 0x3F, 0x81,
+    0x62, 0xA7, 0xD5, 0x4A, 0x13, 0x8D, 0xA4, 0x89, 0x8E, 0xB3, 0x9A, 0x8A, 0x04, 0xC3, 0x58, 0x45,
+    0x18, 0x42, 0x13, 0x60, 0xE8, 0x3B, 0x40, 0x45, 0x02, 0xB3, 0x56, 0x11, 0xEA, 0xA5, 0x09, 0xD0,
+    0xC4, 0x0E, 0xF0, 0x2F, 0x26, 0x40, 0x55, 0x04, 0x93, 0x6E, 0x57, 0xEB, 0xC5, 0x04, 0x8D, 0xAA,
+    0x0F, 0x2E, 0x7E, 0x35, 0x8F, 0x5E, 0xA1, 0x3B, 0xEE, 0x90, 0xA6, 0x4A, 0xD2, 0x46, 0x23, 0xA9,
+    0xA7, 0xD3, 0x76, 0x00, 0x50, 0x5C, 0xAC, 0x25, 0x3D, 0x25, 0x69, 0x92, 0x34, 0xF9, 0x83, 0x4C,
+    0x30, 0x66, 0xDE, 0xED, 0x19, 0xDF, 0xEE, 0x2A, 0x6E, 0x3D, 0xF9, 0x5D, 0xA4, 0x15, 0x9F, 0xF7,
+    0xDB, 0x68, 0x96, 0xBB, 0x9E, 0xA8, 0xE6, 0x2C, 0xA0, 0xE8, 0xA4, 0xB5, 0x91, 0x74, 0x4D, 0xD2,
+    0xFB, 0xCA, 0xBC, 0x41, 0xED, 0x99, 0x27, 0xAF, 0x7F, 0xD7, 0x4B, 0xAF, 0x49, 0x7A, 0x7C, 0xCE,
+    0x82, 0xF6, 0x44, 0x98, 0x64, 0xD9, 0x32, 0x48, 0xA5, 0x94, 0xAC, 0x14, 0xFD, 0xBB, 0xCF, 0xB6,
+    0xCA, 0xAB, 0x61, 0x23, 0xF8, 0x00, 0x77, 0xDE, 0x16, 0x82, 0x2A, 0xE5, 0xC5, 0xE8, 0x6E, 0x33,
+    0x9E, 0xB3, 0x83, 0x46, 0x4A, 0x49, 0x81, 0x4E, 0xEF, 0x0E, 0x6D, 0xA5, 0x16, 0xF0, 0x11, 0x28,
+    0x05, 0x60, 0x17, 0xC8, 0xEF, 0xCB, 0xEB, 0x4D, 0x95, 0x38, 0x5E, 0x58, 0xBA, 0x1E, 0x28, 0x36,
+    0xF8, 0x0E, 0xD5, 0x42, 0xA9, 0xED, 0x6B, 0x91, 0x4A, 0x9B, 0x0F, 0x70, 0x29, 0xA9, 0x05, 0xFF,
+    0xAF, 0x04, 0xA4, 0x7A, 0x83, 0x2A, 0x36, 0xFA, 0xDE, 0x93, 0x43, 0xF0, 0x92, 0x44, 0x27, 0x29,
+    0xD1, 0x49, 0x8A, 0x74, 0xD2, 0x06, 0x67, 0xB5, 0xB5, 0x7C, 0xAE, 0x85, 0xAF, 0xDB, 0x09, 0xFC,
+    0xD5, 0x05, 0x6C, 0xDC, 0xC0, 0x24, 0x1F, 0x40, 0x36, 0x82, 0xBF, 0x99, 0xC0, 0x46, 0xFD, 0x9A,
+    0xCA, 0x5B, 0x17, 0x2F, 0x0E, 0x37, 0x25, 0x69, 0x96, 0xA4, 0xD5, 0x4B, 0xD2, 0xD7, 0x24, 0xE9,
+    0x75, 0x49, 0xFA, 0x40, 0x2D, 0xD5, 0xDA, 0x8D, 0x14, 0xFA, 0xDA, 0x0C, 0xDD, 0x3B, 0x2B, 0x34,
+    0xB7, 0xD4, 0x52, 0x6F, 0xDD, 0x44, 0xA9, 0xFE, 0xFA, 0x13, 0xF3, 0xF0, 0xC4, 0xDC, 0x3D, 0x7E,
+    0x67, 0xBA, 0xB6, 0x74, 0xD7, 0x96, 0xEE, 0x95, 0x34, 0xBC, 0x92, 0xF4, 0x6A, 0x52, 0xA0, 0x78,
+    0x96, 0x72, 0xA5, 0x5C, 0x31, 0x39, 0xA5, 0x5F, 0x99, 0x96, 0x5D, 0xAA, 0x72, 0x9A, 0x6F, 0xA7,
+    0x3A, 0x62, 0xE3, 0xBD, 0x5D, 0xEC, 0x34, 0x75, 0x1A, 0x3B, 0xF5, 0xDD, 0x46, 0xF7, 0x36, 0x40,
+    0x15, 0x0B, 0x51, 0x45, 0xB3, 0x52, 0xC7, 0x6A, 0xA1, 0x8E, 0x36, 0x52, 0x47, 0x37, 0x61, 0x63,
+    0x17, 0xB0, 0x93, 0x5A, 0xEC, 0x9B, 0x1B, 0xD8, 0xB7, 0x12, 0xD8, 0x9F, 0x2E, 0x60, 0x15, 0xA1,
+    0xD1, 0x08, 0x8D, 0x7A, 0x68, 0xD4, 0x82, 0x53, 0x00, 0xA7, 0x08, 0x4E, 0x09, 0xFC, 0xAB, 0x02,
+    0x7F, 0x53, 0x01, 0xFF, 0xA2, 0x22, 0x3E, 0x0C, 0x09, 0x1F, 0xBC, 0xE8, 0x82, 0x55, 0xE8, 0x42,
+    0xA5, 0xD8, 0x85, 0x52, 0xE9, 0x9E, 0x3E, 0x93, 0xDC, 0xE9, 0xEC, 0x3E, 0x21, 0xFB, 0xBB, 0x73,
+    0xFF, 0xC9, 0xB9, 0x7B, 0xF7, 0x39, 0x75, 0xD2, 0x1D, 0xF9, 0x9E, 0xBF, 0x85, 0xF2, 0x59, 0x34,
+    0x42, 0x37, 0xD9, 0x0D, 0xAC, 0x0A, 0x45, 0x50, 0x6C, 0xD4, 0xE3, 0x54, 0x28, 0x61, 0x14, 0x1B,
+    0x8D, 0x74, 0x2A, 0x25, 0xAC, 0xA2, 0x7B, 0x2F, 0xA2, 0xE1, 0xD1, 0x55, 0xBD, 0xFB, 0xE9, 0xEC,
+    0x5E, 0x4D, 0x66, 0x1D, 0x1E, 0x4D, 0xDD, 0xD8, 0xBD, 0xB2, 0xF8, 0x9B, 0xB2, 0xCB, 0x70, 0x35,
+    0xB9, 0x28, 0xBB, 0xF8, 0xA0, 0xE7, 0xA2, 0x6E, 0x26, 0xAB, 0xD5, 0x26, 0x3F, 0x76, 0x0A, 0xBA,
+    0xB9, 0x1A, 0x25, 0x9B, 0xFC, 0xE8, 0xD4, 0xEA, 0xE6, 0x8A, 0xA2, 0x4D, 0x7E, 0xB2, 0x5B, 0xA1,
+    0x97, 0x37, 0xBA, 0xB1, 0x59, 0xBB, 0xC9, 0xA4, 0x42, 0xAF, 0x6F, 0x80, 0x5B, 0xBB, 0x08, 0x65,
+    0xE6, 0x83, 0x5F, 0xF8, 0xD6, 0x06, 0x36, 0x0E, 0x01, 0x93, 0xDC, 0x02, 0x9B, 0x15, 0xF8, 0xAB,
+    0x9A, 0xB0, 0x93, 0x12, 0xD5, 0xE2, 0xD5, 0x16, 0xAB, 0x7D, 0x2F, 0xD2, 0x3D, 0xF6, 0xE1, 0x8A,
+    0x7B, 0x6D, 0xF3, 0xA1, 0x9E, 0xBB, 0xA7, 0xE7, 0x72, 0x6D, 0x26, 0xA1, 0x7A, 0x71, 0xA3, 0x7F,
+    0x69, 0x33, 0xC9, 0xC6, 0xA1, 0x1F, 0x1E, 0x4B, 0x3E, 0xDA, 0x49, 0x36, 0x99, 0xE4, 0x6F, 0x8A,
+    0xEE, 0x6F, 0xA2, 0x82, 0xFD, 0x45, 0xF2, 0xB1, 0x90, 0x6C, 0xC2, 0xEB, 0x9A, 0xA8, 0xF4, 0xA6,
+    0x02, 0x5A, 0xBA, 0x48, 0xB3, 0xED, 0x98, 0x30, 0x9D, 0xD4, 0x53, 0xEB, 0x3D, 0x8D, 0x68, 0x2A,
+    0x34, 0xD6, 0x2B, 0x28, 0xF8, 0x11, 0xF4, 0xD4, 0x06, 0x85, 0x6C, 0x04, 0xB3, 0xFA, 0x00, 0xD5,
+    0x07, 0x2B, 0x60, 0xDF, 0x89, 0x80, 0xFF, 0x9B, 0x00, 0x0C, 0x1D, 0x50, 0xAE, 0x09, 0xA8, 0x77,
+    0xD5, 0x23, 0xB0, 0xF9, 0x00, 0xF5, 0xAC, 0x00, 0xC3, 0x4B, 0xFA, 0xA0, 0xB8, 0x24, 0x23, 0x49,
+    0x4B, 0x2D, 0x49, 0xC1, 0x4A, 0xDA, 0xB0, 0x92, 0x26, 0x6A, 0x69, 0x85, 0x62, 0xD8, 0xDA, 0x1D,
+    0xE7, 0x68, 0xB2, 0x48, 0x5A, 0xCA, 0xED, 0x39, 0x85, 0x23, 0xAA, 0xE4, 0x7A, 0x7C, 0x3D, 0x51,
+    0xFF, 0x60, 0xA1, 0x5C, 0x36, 0x58, 0x7D, 0x8F, 0xFF, 0xCA, 0xC4, 0x70, 0x73, 0xC7, 0x2B, 0xA3,
+    0x97, 0x46, 0xBB, 0x3D, 0x9B, 0x65, 0x86, 0xC8, 0x8C, 0xA8, 0x89, 0x99, 0xA7, 0x14, 0x02, 0x86,
+    0x90, 0xD5, 0x84, 0x7A, 0x85, 0x52, 0xED, 0x4E, 0x7D, 0x81, 0x4B, 0x5B, 0x76, 0x74, 0x2C, 0x50,
+    0xEA, 0xA7, 0x1A, 0x29, 0xD5, 0x56, 0x6B, 0xD6, 0x55, 0x03, 0x1B, 0x98, 0x85, 0x01, 0xE8, 0xF0,
+    0x3D, 0xD8, 0xA9, 0x09, 0x50, 0x66, 0x9F, 0x50, 0x67, 0x16, 0xA0, 0x09, 0x1B, 0x60, 0xA2, 0xEF,
+    0x81, 0xD5, 0x4E, 0x80, 0xDF, 0xFD, 0x20, 0xA0, 0x8E, 0x3E, 0x80, 0x49, 0xF5, 0xC2, 0x83, 0xC5,
+    0x56, 0xA8, 0xB7, 0x9B, 0x5A, 0xBF, 0xFD, 0x9D, 0x14, 0x6A, 0x49, 0x1A, 0xC9, 0xCE, 0x0D, 0x2B,
+    0x29, 0x82, 0x72, 0x4F, 0x06, 0xA9, 0x3F, 0xF1, 0x0C, 0xD0, 0xA9, 0x05, 0x2A, 0xCD, 0xF9, 0x86,
+    0x7B, 0xAE, 0xFF, 0x37, 0x90, 0x16, 0xAC, 0x14, 0x89, 0x74, 0xBD, 0x85, 0x54, 0x44, 0xEA, 0xB1,
+    0x81, 0xFD, 0x22, 0x52, 0x4F, 0x0D, 0xC5, 0x5A, 0x46, 0x86, 0xE0, 0xA4, 0xA5, 0x94, 0x56, 0x9C,
+    0xD4, 0x1B, 0x49, 0xF8, 0x1F, 0x5F, 0x5A, 0x4C, 0xC2, 0x8D, 0x3E, 0xB0, 0x99, 0x15, 0x1B, 0xFD,
+    0x88, 0xCC, 0x8A, 0x9D, 0xFD, 0x88, 0xAE, 0x6D, 0xD8, 0xD4, 0x4D, 0xE8, 0xE5, 0x0D, 0xBB, 0x76,
+    0x13, 0x9A, 0xE0, 0xB3, 0x17, 0xB3, 0x4A, 0x13, 0x30, 0x92, 0xC0, 0x4B, 0x89, 0x42, 0x6F, 0x73,
+    0x81, 0xFA, 0x36, 0x1F, 0x67, 0x85, 0x9D, 0xC0, 0xCA, 0xF2, 0x1A, 0xB7, 0xB5, 0x80, 0xD7, 0x2D,
+    0xC0, 0x2B, 0xB3, 0x0E, 0x4D, 0x50, 0x0C, 0x8A, 0x40, 0xA5, 0x08, 0x18, 0x4D, 0x40, 0xA5, 0x00,
+    0x34, 0xE2, 0x5E, 0x50, 0x2A, 0x75, 0x7D, 0xD8, 0xF9, 0x7F, 0x7A, 0x29, 0xCB, 0x22, 0xA9, 0xF7,
+    0x92, 0x66, 0xEE, 0x97, 0xDE, 0x3E, 0x96, 0x33, 0x9D, 0x24, 0xBD, 0x21, 0x49, 0xBF, 0x90, 0xA4,
+    0xF5, 0x7B, 0x17, 0x56, 0x2E, 0x66, 0x51, 0x98, 0xF5, 0xAD, 0xDC, 0x9D, 0x15, 0x8E, 0x2B, 0x27,
+    0xB2, 0xF2, 0x49, 0xB1, 0x9D, 0x88, 0x9A, 0x66, 0x3A, 0x56, 0x36, 0x72, 0xE5, 0xD0, 0xEF, 0xF4,
+    0x72, 0xEA, 0x74, 0x22, 0xB1, 0x86, 0x70, 0x5C, 0x69, 0xD3, 0x89, 0x0A, 0xA7, 0x00, 0x5D, 0xA0,
+    0x54, 0x13, 0x61, 0x78, 0x39, 0x81, 0x7B, 0x5F, 0x50, 0xA7, 0xBB, 0x2A, 0xA3, 0xA0, 0x4A, 0x3E,
+    0xEC, 0xB6, 0x53, 0x77, 0x33, 0x41, 0x33, 0x09, 0xAA, 0xC5, 0x07, 0x8A, 0xCD, 0x46, 0xE8, 0xAE,
+    0x9E, 0x54, 0xCE, 0x3E, 0x50, 0xAE, 0x76, 0x06, 0x3D, 0x2A, 0xE8, 0xC2, 0xF0, 0xE1, 0x93, 0x79,
+    0x3E, 0x92, 0x39, 0x56, 0x69, 0x84, 0x95, 0xD4, 0xD2, 0x69, 0xDB, 0x4D, 0xC6, 0x37, 0x5A, 0x28,
+    0xFE, 0xD6, 0xF7, 0xC7, 0x22, 0xAB, 0x5A, 0x9A, 0x31, 0x9B, 0x25, 0xC7, 0xA5, 0x9B, 0xEA, 0x05,
+    0x7C, 0x30, 0x09, 0xBA, 0x60, 0x56, 0x50, 0x5F, 0x6E, 0x20, 0x10, 0xA5, 0x40, 0xAD, 0xD9, 0x60,
+    0x08, 0x55, 0x82, 0x2E, 0xD8, 0x04, 0x7E, 0x6A, 0x16, 0x70, 0xD1, 0x45, 0x68, 0x66, 0x1F, 0xC1,
+    0x2E, 0xDD, 0x74, 0xA2, 0x63, 0x4B, 0x01, 0x8C, 0xD4, 0x83, 0x91, 0xF2, 0x6E, 0x02, 0xC8, 0x9D,
+    0xD2, 0x9A, 0x4D, 0x5E, 0x30, 0x29, 0xF7, 0xD2, 0xBE, 0x95, 0x00, 0x18, 0x9E, 0x88, 0xB9, 0xDA,
+    0x8D, 0x99, 0x5E, 0xBA, 0x3E, 0x2F, 0x87, 0x00, 0xCA, 0xD5, 0x24, 0xCC, 0x8C, 0x8D, 0xF5, 0x8C,
+    0x8B, 0xF8, 0xD0, 0x4C, 0x68, 0x2C, 0x36, 0x7C, 0xA8, 0xD5, 0xD7, 0x33, 0xC2, 0x0B, 0x1F, 0xCC,
+    0x5A, 0x6A, 0x43, 0xD4, 0x8B, 0xFD, 0x28, 0x55, 0x0B, 0x4D, 0x1C, 0x5E, 0x59, 0xDC, 0x88, 0xBF,
+    0xB9, 0x35, 0x51, 0x20, 0x37, 0xFB, 0x77, 0x12, 0xE5, 0xA6, 0x30, 0xBC, 0x37, 0x51, 0x69, 0x43,
+    0x6A, 0x69, 0x14, 0x8D, 0x12, 0x78, 0x85, 0x4A, 0x11, 0xB4, 0x62, 0x15, 0x28, 0x15, 0x71, 0x1B,
+    0x54, 0xEA, 0xE9, 0x66, 0x8E, 0xAD, 0xD4, 0x3A, 0x40, 0x3D, 0x66, 0x45, 0xC9, 0xF7, 0x98, 0x19,
+    0xDF, 0x66, 0xC5, 0xBB, 0x4C, 0xB0, 0xD1, 0x8C, 0x14, 0x6B, 0xD6, 0x8B, 0xEA, 0x08, 0x26, 0x75,
+    0x3D, 0xD4, 0x1F, 0x65, 0xA5, 0x74, 0x04, 0x9A, 0x8D, 0x63, 0xDA, 0x41, 0x23, 0x60, 0x15, 0x80,
+    0x41, 0x01, 0xAA, 0x4D, 0x3D, 0xF8, 0x9F, 0xA9, 0xA5, 0xD4, 0x63, 0x82, 0x66, 0xA9, 0x36, 0x50,
+    0xA8, 0x57, 0xEC, 0x8A, 0x4D, 0x0C, 0x13, 0x2E, 0x55, 0x02, 0x3F, 0xFB, 0x19, 0xBA, 0xE8, 0x5B,
+    0xE8, 0x6C, 0x04, 0xFF, 0xAD, 0x15, 0x9A, 0xE0, 0x03, 0x36, 0x56, 0x0B, 0xF5, 0x8C, 0x30, 0x89,
+    0x66, 0x2A, 0x57, 0xCC, 0x5A, 0x08, 0xBA, 0xA0, 0x16, 0x3B, 0x77, 0x81, 0x42, 0x7E, 0x04, 0xAF,
+    0x08, 0xB5, 0x66, 0x40, 0x09, 0x70, 0xEB, 0x6D, 0x52, 0xEE, 0x01, 0x3F, 0x1D, 0xEB, 0x66, 0xD5,
+    0x06, 0x94, 0xD9, 0x2C, 0x9C, 0x00, 0xBF, 0x00, 0x76, 0x23, 0xCF, 0x0E, 0xA5, 0x24, 0x45, 0x23,
+    0x49, 0x7D, 0xE6, 0xE7, 0x2E, 0x73, 0xAF, 0x93, 0x11, 0x02, 0x28, 0xDE, 0xBE, 0x9C, 0x01, 0xAB,
+    0x16, 0xD0, 0xB2, 0x53, 0xD7, 0x61, 0x48, 0x40, 0x9D, 0x67, 0x23, 0x5F, 0x8E, 0xC7, 0x76, 0x68,
+    0xAD, 0x09, 0x18, 0x36, 0xA0, 0x56, 0x3C, 0xDE, 0xEB, 0x2F, 0xEA, 0xD8, 0xA8, 0xD0, 0xD6, 0xE8,
+    0x58, 0xA9, 0x55, 0xAC, 0x35, 0x6A, 0xB5, 0x1A, 0x57, 0x6C, 0xC8, 0x4E, 0xCB, 0x84, 0x0D, 0x45,
+    0xA2, 0x39, 0x29, 0x5C, 0x5F, 0x2E, 0xC7, 0x85, 0x99, 0xF1, 0xED, 0x49, 0x71, 0xCA, 0x09, 0x5A,
+    0x45, 0xBA, 0x93, 0xE2, 0x88, 0x7A, 0xE2, 0x88, 0x5A, 0x71, 0x90, 0x55, 0xBC, 0x78, 0x31, 0xBB,
+    0x02, 0xFF, 0x82, 0x1A, 0x9E, 0xA7, 0x0A, 0x9C, 0xA3, 0x9C, 0x68, 0x60, 0xC6, 0xF6, 0xDC, 0xC0,
+    0x8C, 0x78, 0xCA, 0x48, 0xD3, 0x93, 0xA8, 0x03, 0xFB, 0x98, 0x88, 0x6F, 0x8B, 0x05, 0x1B, 0x58,
+    0xA9, 0x03, 0xDF, 0xC4, 0xC0, 0xBD, 0xC3, 0x5A, 0x6B, 0x1A, 0xB6, 0xFC, 0xF6, 0x3B, 0x5A, 0x3C,
+    0xDD, 0x95, 0x3B, 0xFA, 0x78, 0xBA, 0xF3, 0x77, 0x8C, 0xEA, 0xF4, 0x70, 0x59, 0xB1, 0x3F, 0xD0,
+    0xDA, 0xE8, 0x35, 0xAD, 0x67, 0x2E, 0xB6, 0x7C, 0x1E, 0xF6, 0x41, 0xAD, 0x79, 0x67, 0xB4, 0xCC,
+    0x5F, 0xE2, 0x01, 0xF2, 0x06, 0x95, 0x3E, 0x92, 0xA4, 0xFF, 0x71, 0xFD, 0xFA, 0xF5, 0x67, 0x3D,
+    0xAC, 0x98, 0x05, 0x1B, 0x29, 0xB2, 0x0C, 0x2E, 0xB7, 0x86, 0x4A, 0x1F, 0x85, 0xEA, 0xC3, 0x21,
+    0x9A, 0x58, 0xA6, 0x32, 0xE2, 0x59, 0xA8, 0xC7, 0x73, 0x94, 0x73, 0x03, 0xFB, 0x55, 0xC0, 0x3D,
+    0x15, 0xB1, 0xF1, 0x0A, 0x75, 0xB2, 0xB7, 0xB2, 0x70, 0x0F, 0x9D, 0x14, 0x2B, 0xAD, 0x57, 0x70,
+    0x4B, 0xD3, 0x76, 0x6D, 0xB6, 0xDB, 0x4F, 0x6C, 0x91, 0x13, 0xF3, 0xE5, 0x0E, 0x7B, 0xE6, 0x07,
+    0x0A, 0x46, 0xDA, 0xD0, 0x76, 0x69, 0xF2, 0x0B, 0x87, 0x75, 0xC2, 0xBE, 0xB4, 0x52, 0xCE, 0x03,
+    0x5C, 0x71, 0x81, 0xE6, 0x5A, 0xA4, 0x7A, 0x2D, 0x61, 0xE6, 0xAE, 0x2F, 0x93, 0x5D, 0xFF, 0xF5,
+    0x66, 0x24, 0x31, 0x64, 0xD3, 0xA7, 0x65, 0x10, 0xB0, 0x73, 0xC6, 0x54, 0x0A, 0x46, 0x09, 0xFD,
+    0xAF, 0xDE, 0x05, 0xCC, 0x0C, 0x5D, 0xF6, 0xA9, 0x1E, 0x66, 0x8F, 0xC1, 0x7E, 0xEE, 0x8C, 0x1F,
+    0x29, 0xF5, 0x9D, 0xDE, 0x4A, 0x78, 0x2D, 0x3B, 0x09, 0xB5, 0xF3, 0xC2, 0xD6, 0x61, 0xE7, 0x3A,
+    0xBD, 0x71, 0xCA, 0x2D, 0xBB, 0x73, 0xB2, 0x36, 0xB3, 0xC7, 0xEB, 0xDB, 0xC1, 0xEB, 0xA3, 0xC9,
+    0x1D, 0x74, 0x8B, 0xED, 0xCD, 0x66, 0x03, 0xC3, 0xD5, 0x89, 0xE6, 0xCD, 0x99, 0x6A, 0xB9, 0x02,
+    0x6B, 0xD3, 0xD2, 0x3D, 0x1E, 0x71, 0xAF, 0x6D, 0xB8, 0xD9, 0x4B, 0x5B, 0x25, 0xA9, 0x1F, 0xA4,
+    0xA9, 0x56, 0x5A, 0x70, 0xCB, 0x5E, 0x6E, 0xEC, 0xFE, 0x05, 0xA4, 0xD6, 0x2C, 0x66, 0xB4, 0x81,
+    0xD8, 0xC0, 0xE5, 0x3D, 0x9E, 0xBC, 0xE1, 0xA5, 0xB5, 0x93, 0x7E, 0x72, 0xD8, 0x66, 0x1F, 0xDD,
+    0x3E, 0x3B, 0x3D, 0x77, 0xE6, 0xCF, 0xAC, 0x94, 0x2A, 0x29, 0x15, 0x52, 0xE2, 0xFE, 0xAD, 0x07,
+    0xAA, 0xAD, 0xD0, 0xE4, 0x30, 0x13, 0xE7, 0x30, 0x81, 0xF3, 0x0C, 0xFA, 0x48, 0xFA, 0x77, 0x1F,
+    0x3E, 0x73, 0x17, 0x15, 0xEF, 0x8A, 0x3A, 0x32, 0xE4, 0x82, 0xEE, 0xE0, 0x2F, 0x8D, 0x96, 0x64,
+    0xA5, 0xD4, 0xF4, 0x5D, 0xDA, 0xA3, 0x49, 0xE7, 0xA9, 0xD3, 0x65, 0xAA, 0xE5, 0x32, 0x66, 0x97,
+    0xAB, 0xE5, 0x3C, 0x76, 0xF1, 0xEF, 0x6A, 0x69, 0xA4, 0xD9, 0x4A, 0xB3, 0xD1, 0x87, 0x33, 0xDD,
+    0x0F, 0x63, 0x76, 0xC9, 0x36, 0xF1, 0x4F, 0x18, 0xA6, 0x26, 0x63, 0x36, 0xAD, 0xD3, 0x46, 0x39,
+    0x4C, 0xD8, 0x90, 0xA7, 0xCD, 0xF6, 0x77, 0xE5, 0x36, 0x3B, 0xB4, 0x9B, 0x16, 0x9A, 0x27, 0x36,
+    0xDC, 0xA0, 0xD1, 0x49, 0xD1, 0x2D, 0xD5, 0xEC, 0xC6, 0x62, 0xF1, 0x81, 0xE4, 0x7B, 0x6E, 0xF8,
+    0xF6, 0x8E, 0x9C, 0x7C, 0x4B, 0xEA, 0x5A, 0xD6, 0xAE, 0x65, 0xED, 0xFA, 0x62, 0x1D, 0xFA, 0x62,
+    0x75, 0x8F, 0x2D, 0xFE, 0x5A, 0x1A, 0x76, 0xD6, 0xE6, 0x05, 0x57, 0x46, 0x57, 0x4E, 0x8F, 0x94,
+    0xD1, 0x95, 0xD1, 0x9B, 0xE3, 0xF4, 0xF8, 0x4C, 0x99, 0xAD, 0xA3, 0x44, 0x95, 0x76, 0xE6, 0xE5,
+    0xEE, 0xB8, 0x40, 0x31, 0x53, 0xCC, 0x14, 0x91, 0x22, 0x52, 0xFE, 0x92, 0x64, 0xA6, 0x3B, 0x52,
+    0x35, 0x62, 0x47, 0xBA, 0xD0, 0x28, 0x78, 0xD1, 0x9D, 0xF8, 0xBE, 0x9A, 0x7E, 0x97, 0x5B, 0x70,
+    0xA7, 0xF3, 0x8E, 0x88, 0x7C, 0x99, 0xF0, 0x55, 0xC4, 0x37, 0x01, 0xEF, 0x5B, 0xFC, 0x06, 0x3E,
+    0x65, 0x86, 0xEA, 0x37, 0xF0, 0x43, 0x4F, 0xE7, 0x27, 0x3A, 0xBB, 0xD0, 0x55, 0x1B, 0x5D, 0xA9,
+    0xBE, 0x43, 0xD3, 0x80, 0x4F, 0x67, 0xDA, 0x32, 0x92, 0xF0, 0x19, 0x0C, 0x4C, 0xEC, 0xD3, 0xF4,
+    0xD5, 0x58, 0xCC, 0x1C, 0xE2, 0xDA, 0x7A, 0x2C, 0x67, 0x0E, 0xF1, 0xAD, 0x1D, 0xCD, 0xCC, 0x8A,
+    0x6F, 0xAD, 0x6E, 0x2A, 0x0E, 0x89, 0x62, 0x6B, 0xEF, 0x9F, 0xB9, 0xA1, 0xAD, 0xD6, 0x68, 0xA5,
+    0x0F, 0x24, 0x14, 0x9C, 0x8A, 0xC5, 0x46, 0x14, 0xEA, 0xB0, 0x52, 0xCD, 0x5C, 0x6E, 0x02, 0x1D,
+    0xD5, 0x8B, 0x89, 0x6A, 0xE2, 0x8A, 0x0B, 0xEC, 0x53, 0xFD, 0x20, 0x51, 0x8F, 0x1C, 0xFA, 0x9E,
+    0x95, 0xFA, 0x87, 0x99, 0x6D, 0xF9, 0x96, 0x84, 0x7D, 0x6B, 0xA6, 0x09, 0x6C, 0x5D, 0x5B, 0x26,
+    0xEC, 0x3B, 0x11, 0xDF, 0xB3, 0x51, 0x5C, 0xA0, 0x71, 0x1B, 0x8D, 0x14, 0xDC, 0x5C, 0x4F, 0x6E,
+    0x34, 0xD1, 0x85, 0x72, 0xF6, 0x6D, 0x31, 0xFB, 0xB6, 0x58, 0x76, 0x39, 0xF9, 0xB6, 0x4C, 0xBE,
+    0xCF, 0xB9, 0x3B, 0x95, 0x87, 0x50, 0xAE, 0xB8, 0x5B, 0x94, 0x52, 0x5F, 0x6F, 0x43, 0x6C, 0x42,
+    0x39, 0x7B, 0x48, 0x7B, 0x70, 0xE5, 0x0A, 0xEC, 0x1F, 0xC2, 0xDE, 0x21, 0xEC, 0xEF, 0xC3, 0xBE,
+    0x87, 0xD5, 0xFF, 0xF8, 0xAB, 0xC9, 0x66, 0xEC, 0x6B, 0x2A, 0xA4, 0x3E, 0xFB, 0xA3, 0xBF, 0x70,
+    0x80, 0x77, 0xEA, 0xCD, 0x47, 0x1F, 0x0E, 0xB8, 0x85, 0xA5, 0x14, 0x55, 0x70, 0x23, 0xE7, 0xCB,
+    0x94, 0xBD, 0x58, 0x7B, 0x45, 0xC2, 0x4C, 0xCD, 0xC8, 0x5E, 0x29, 0xAA, 0xD1, 0x6D, 0x45, 0x32,
+    0x92, 0x82, 0x97, 0xE6, 0xEA, 0xE7, 0xDA, 0x18, 0xAC, 0xDA, 0x7A, 0x3A, 0x03, 0xDB, 0x4E, 0x6B,
+    0x2C, 0x12, 0xD9, 0x0A, 0x2D, 0xD3, 0x89, 0x72, 0x7B, 0xDB, 0xB5, 0x71, 0x70, 0x1F, 0x68, 0xF5,
+    0x54, 0xDB, 0xD0, 0x61, 0x47, 0xBB, 0xE1, 0x5A, 0xB3, 0xE1, 0x31, 0x1B, 0x57, 0x28, 0xD7, 0x5C,
+    0xDC, 0xA0, 0x4C, 0x5C, 0xC6, 0x24, 0xAE, 0x60, 0x12, 0x7B, 0xD4, 0x09, 0x77, 0xD0, 0x25, 0xAC,
+    0x94, 0xA8, 0xB3, 0x06, 0xBD, 0xDE, 0x00, 0x37, 0xED, 0x00, 0x62, 0x60, 0xB9, 0x7C, 0x2C, 0x98,
+    0xB5, 0x00, 0x3A, 0x80, 0x62, 0xA7, 0xEB, 0xDA, 0xBF, 0x9A, 0xF7, 0x34, 0x4A, 0x57, 0xF5, 0xDF,
+    0x9B, 0x48, 0xD7, 0x16, 0x89, 0x2A, 0x66, 0xBF, 0x5D, 0x99, 0xB0, 0x11, 0x1F, 0x50, 0x5B, 0x6D,
+    0x34, 0x0B, 0x5C, 0xDA, 0x5A, 0xAB, 0x95, 0xA3, 0x2F, 0x5F, 0x30, 0x01, 0xEC, 0x8E, 0xDD, 0x0E,
+    0x6F, 0x67, 0x79, 0xEA, 0xD4, 0x53, 0x0C, 0x3D, 0x0C, 0xBC, 0x5D, 0x25, 0x2B, 0x45, 0x49, 0x57,
+    0xA5, 0x74, 0x6C, 0x86, 0x55, 0x3D, 0xD5, 0x44, 0xB1, 0xC0, 0x21, 0xB8, 0xD6, 0x48, 0xEF, 0x4B,
+    0x89, 0x15, 0x7C, 0x8B, 0x1D, 0x4F, 0xA1, 0x3C, 0x19, 0xF2, 0x29, 0x32, 0xBA, 0xD1, 0x68, 0xAA,
+    0x94, 0x0A, 0x09, 0xAF, 0x70, 0x48, 0xF9, 0xC1, 0x4C, 0xFD, 0xFA, 0x88, 0xFB, 0x5A, 0xCF, 0xE1,
+    0x3E, 0xE5, 0xBC, 0x60, 0x7F, 0x18, 0xF1, 0xDF, 0x0E, 0x6C, 0x1E, 0xB3, 0x24, 0xEC, 0x5B, 0x0B,
+    0x7A, 0x3A, 0x4B, 0xF2, 0xC5, 0x4B, 0x71, 0xD0, 0x1B, 0xA1, 0x5B, 0x3A, 0x32, 0x48, 0x61, 0xDE,
+    0x8A, 0x70, 0xA3, 0xE9, 0xB1, 0x7D, 0xA2, 0x8C, 0xF5, 0x84, 0xC7, 0x53, 0x8F, 0xE5, 0x42, 0xC2,
+    0x06, 0xD7, 0x72, 0x64, 0x22, 0x55, 0x3C, 0x02, 0xFF, 0xED, 0x40, 0xB1, 0x2D, 0x3B, 0x0D, 0x43,
+    0xF3, 0x0E, 0x5C, 0x1D, 0x22, 0x1D, 0x50, 0xBF, 0x35, 0x93, 0x0D, 0x47, 0xEC, 0x4B, 0x09, 0x8A,
+    0xD4, 0x84, 0x33, 0xB8, 0x7E, 0x2D, 0x16, 0x33, 0xDB, 0xC9, 0x8F, 0x9E, 0xC1, 0xAA, 0x8A, 0xD5,
+    0xCF, 0x94, 0x8E, 0xF0, 0x83, 0xDE, 0x1B, 0x8D, 0xA4, 0x84, 0xD3, 0x7B, 0x0A, 0x85, 0x66, 0x2D,
+    0xD8, 0xAD, 0x52, 0x8B, 0x82, 0x8F, 0xD4, 0x73, 0x21, 0xCC, 0x8C, 0xEB, 0x9B, 0x50, 0x47, 0xB6,
+    0x22, 0x61, 0x66, 0xDF, 0xD2, 0xBC, 0x31, 0xE5, 0x85, 0x33, 0x22, 0xBB, 0xA6, 0x2B, 0xED, 0xD6,
+    0xD3, 0xBF, 0x37, 0x61, 0xA3, 0xDA, 0x72, 0x35, 0x89, 0xAE, 0x77, 0x53, 0x13, 0xD1, 0x63, 0x09,
+    0x93, 0xF6, 0xC1, 0x7B, 0xD8, 0x6F, 0x7A, 0x0E, 0xED, 0x48, 0xAA, 0x22, 0xC9, 0xCC, 0xE5, 0x52,
+    0x24, 0x33, 0xB3, 0x99, 0x48, 0xF7, 0x78, 0xC4, 0xBF, 0x3A, 0xD1, 0xBC, 0x37, 0x61, 0x35, 0x52,
+    0x29, 0x60, 0x14, 0x28, 0xD4, 0x83, 0x5A, 0x50, 0x36, 0x72, 0xAB, 0x15, 0x2E, 0x25, 0x9C, 0x22,
+    0x4E, 0x01, 0xB7, 0x81, 0x3B, 0x00, 0x93, 0x6D, 0x86, 0x64, 0xA4, 0x35, 0x1B, 0x39, 0xCD, 0x04,
+    0x43, 0x4F, 0xB9, 0x41, 0xBD, 0x64, 0x95, 0x4F, 0x3D, 0x66, 0xCB, 0x8A, 0x9F, 0xFF, 0xF0, 0xFA,
+    0x81, 0xCF, 0x60, 0xD2, 0xDC, 0x49, 0x89, 0xB3, 0xC2, 0xAA, 0xAF, 0x66, 0xCC, 0xC2, 0x31, 0x09,
+    0xDC, 0x05, 0xF4, 0x35, 0x23, 0xC3, 0x84, 0x1B, 0xA9, 0x37, 0x68, 0xB2, 0xF4, 0x3D, 0x02, 0xD7,
+    0x53, 0x4F, 0x98, 0x39, 0xFF, 0x5B, 0x9F, 0xA1, 0xDB, 0x19, 0xBF, 0x51, 0x0C, 0xFD, 0x43, 0xE7,
+    0x4E, 0x8E, 0xCB, 0xDF, 0xCC, 0xC7, 0x0B, 0x2F, 0x3C, 0xFF, 0xFC, 0xF3, 0xCF, 0x0F, 0x13, 0x4D,
+    0x86, 0x8C, 0x8E, 0x69, 0x6C, 0x3C, 0x79, 0x47, 0x4B, 0x3D, 0x65, 0x84, 0xA9, 0xA5, 0x12, 0xB8,
+    0x80, 0x8F, 0xF8, 0xFE, 0xCE, 0x1E, 0xDD, 0xBE, 0x11, 0x56, 0xC1, 0x28, 0xB0, 0xF5, 0xD4, 0xE1,
+    0xA1, 0xBF, 0x0F, 0xFF, 0xFB, 0xE6, 0xCD, 0xFF, 0x5C, 0xAD, 0x5F, 0xAA, 0x26, 0x80, 0x12, 0x38,
+    0x57, 0x8C, 0x66, 0x72, 0xED, 0x7E, 0x39, 0xD7, 0x93, 0x6F, 0x0F, 0x4D, 0xAC, 0x26, 0x4F, 0x33,
+    0x0A, 0x37, 0xE5, 0xDC, 0x8C, 0xA2, 0x21, 0xF1, 0xCF, 0x99, 0x00, 0xDA, 0x82, 0x32, 0xFC, 0x09,
+    0x75, 0xF0, 0xD4, 0xA3, 0xA7, 0x9E, 0x7C, 0x5B, 0x4D, 0xAE, 0xAD, 0x46, 0x4F, 0x77, 0x35, 0x55,
+    0xC9, 0x8F, 0xDD, 0xD5, 0x64, 0x16, 0x17, 0x6C, 0x7F, 0x83, 0x2F, 0x15, 0x81, 0xF6, 0x18, 0xB2,
+    0xC8, 0x98, 0xED, 0xCE, 0x9F, 0x4D, 0x3D, 0x9F, 0xA0, 0x40, 0x1F, 0x3F, 0x7E, 0xBF, 0x90, 0x02,
+    0xE0, 0xF9, 0x93, 0xD0, 0x0A, 0x1C, 0xEC, 0x30, 0x70, 0xEA, 0x00, 0xF0, 0x05, 0xFE, 0x5F, 0x0E,
+    0xDF, 0x02, 0xE5, 0xC6, 0xB1, 0x19, 0x4D, 0x37, 0x03, 0xE5, 0x47, 0x11, 0xB0, 0xAF, 0x06, 0x60,
+    0xDF, 0xF5, 0x60, 0xE6, 0x0E, 0xB0, 0x61, 0x05, 0x8E, 0xCA, 0x05, 0xCC, 0x5C, 0x45, 0x68, 0x82,
+    0x1D, 0xE1, 0x88, 0xAC, 0xE1, 0x65, 0x60, 0x79, 0x83, 0x8D, 0x32, 0x61, 0x66, 0xCC, 0x8C, 0x93,
+    0x14, 0x91, 0xA4, 0x50, 0x9D, 0xF8, 0x0C, 0x84, 0xC0, 0xAC, 0xF5, 0x02, 0xF5, 0xE2, 0x47, 0x68,
+    0xDE, 0x17, 0xE0, 0x47, 0xA8, 0x5B, 0x80, 0x0E, 0xC0, 0x6C, 0x00, 0xE7, 0x1F, 0x01, 0x4C, 0x78,
+    0x10, 0xF8, 0x3C, 0xF7, 0xFC, 0x21, 0x8C, 0xC1, 0x8E, 0x76, 0x04, 0xDF, 0xFB, 0x1E, 0x54, 0x6C,
+    0x50, 0xA5, 0x3A, 0x41, 0x13, 0x4F, 0x03, 0x63, 0xBF, 0xC7, 0xC4, 0xF5, 0x3B, 0xC3, 0x83, 0x5A,
+    0x0A, 0xAB, 0x0F, 0x2F, 0xFE, 0x6A, 0x3C, 0xE8, 0x6D, 0xE0, 0x00, 0x20, 0x9C, 0xB8, 0x7F, 0xCA,
+    0x1E, 0x28, 0x03, 0x14, 0xCF, 0xB5, 0x50, 0xAE, 0x39, 0x88, 0xA3, 0xE9, 0x77, 0xA6, 0x4C, 0x33,
+    0x71, 0x27, 0x20, 0xC9, 0x99, 0x3F, 0x77, 0xD2, 0x56, 0x67, 0x29, 0xAA, 0x7E, 0x6B, 0x7F, 0x99,
+    0xBD, 0xF3, 0xE3, 0x7F, 0x73, 0x60, 0xA4, 0xF9, 0x36, 0x7E, 0x33, 0xDD, 0xF5, 0xC4, 0x89, 0xCD,
+    0xA4, 0xCC, 0x7E, 0xB7, 0x46, 0xD2, 0xCB, 0x3B, 0xFC, 0x66, 0x85, 0x7B, 0xC8, 0x24, 0x6B, 0x4E,
+    0x07, 0xA3, 0xDC, 0xF8, 0xF5, 0xDB, 0xEE, 0xE2, 0xA3, 0x92, 0xA6, 0x21, 0x8B, 0xD9, 0xC5, 0xBE,
+    0xFD, 0x49, 0xC0, 0xD2, 0x0C, 0x6C, 0x17, 0x9F, 0xBD, 0x0D, 0x2C, 0x49, 0x33, 0xDB, 0x5D, 0x4F,
+    0x64, 0x60, 0xA9, 0x85, 0x66, 0x67, 0x86, 0xBF, 0x79, 0x6C, 0x83, 0x37, 0x92, 0x46, 0x8A, 0x71,
+    0x17, 0x93, 0xA2, 0x00, 0xCB, 0x0D, 0x98, 0xAB, 0xC0, 0x33, 0x7C, 0xFE, 0x34, 0x22, 0xFD, 0x8F,
+    0x85, 0x74, 0x15, 0x4B, 0x31, 0x33, 0xB0, 0xE1, 0x83, 0x0F, 0x36, 0xDA, 0x58, 0xAD, 0x77, 0x98,
+    0x01, 0xFF, 0xA8, 0x9D, 0x01, 0x13, 0xB1, 0x23, 0xAE, 0x67, 0x68, 0xEF, 0xE8, 0xC2, 0xF5, 0xB6,
+    0x9E, 0x19, 0xDA, 0x7A, 0xA6, 0x6B, 0xAB, 0x5F, 0x52, 0xF4, 0xD5, 0xB2, 0x2B, 0x42, 0x9D, 0x18,
+    0x42, 0x9D, 0x50, 0xB0, 0x09, 0x85, 0xB2, 0xBF, 0x6C, 0xBF, 0x1C, 0x7D, 0x75, 0x67, 0x24, 0x5C,
+    0x3D, 0x0F, 0x4F, 0xCC, 0xC3, 0x5D, 0x58, 0xD3, 0xE3, 0x4B, 0x77, 0x6D, 0xE9, 0xAE, 0xA5, 0xE1,
+    0x95, 0x34, 0xBC, 0x9A, 0xF4, 0x6A, 0xDA, 0x45, 0x59, 0x6D, 0x94, 0xEA, 0xEB, 0xAB, 0xD3, 0xC3,
+    0xBC, 0xF0, 0x17, 0xFC, 0xF1, 0x5D, 0x7D, 0x63, 0x38, 0x4E, 0xDD, 0xAF, 0x4E, 0xFD, 0xA9, 0x14,
+    0x18, 0x8E, 0x93, 0x76, 0xC9, 0x06, 0xFB, 0x62, 0x2A, 0x92, 0x1B, 0xDD, 0x0F, 0x57, 0xB3, 0xFA,
+    0xC9, 0x4F, 0x1F, 0xA7, 0xD2, 0x2F, 0x1C, 0x50, 0xAE, 0xE0, 0xC6, 0x1C, 0xEC, 0x33, 0x52, 0xFC,
+    0xBA, 0xD3, 0x44, 0xB1, 0xDD, 0x3E, 0xE5, 0xE8, 0x20, 0xB7, 0x0B, 0x12, 0x8A, 0x18, 0xED, 0x30,
+    0xC7, 0x0B, 0x00, 0x43, 0x3B, 0xC1, 0xB9, 0xEF, 0x7F, 0x11, 0x1E, 0xB0, 0x0F, 0x40, 0xF5, 0x65,
+    0x41, 0x31, 0x9E, 0x66, 0xF1, 0x5F, 0x2F, 0x2E, 0x80, 0x7F, 0x49, 0x60, 0xE3, 0x30, 0x62, 0x16,
+    0x9F, 0x60, 0xB3, 0x6A, 0xF1, 0x57, 0x15, 0x69, 0x26, 0xAD, 0x54, 0xB3, 0x1F, 0x42, 0xB1, 0xDA,
+    0x9F, 0xCE, 0x0C, 0x8F, 0x2F, 0xC2, 0xBD, 0xB6, 0xB9, 0xB1, 0x9E, 0xBB, 0xAB, 0xC9, 0x24, 0x37,
+    0x0D, 0xA8, 0x5E, 0xEC, 0xE4, 0x5F, 0xDA, 0xCA, 0x64, 0xA3, 0x42, 0x77, 0x35, 0xF9, 0x68, 0xA3,
+    0x6C, 0x2A, 0xB6, 0xEE, 0xA6, 0xF0, 0x6F, 0x44, 0x85, 0x4A, 0xC9, 0x47, 0xB4, 0x35, 0x89, 0x46,
+    0xD7, 0x84, 0xD1, 0x9B, 0x0A, 0x74, 0x0B, 0x67, 0xFB, 0x4F, 0x56, 0x16, 0xCE, 0x7E, 0xF7, 0xAE,
+    0x89, 0xBA, 0xB4, 0xB5, 0x3B, 0x5F, 0x7A, 0xA9, 0x8F, 0x34, 0xE3, 0x17, 0xBA, 0xB9, 0x54, 0x8B,
+    0x8F, 0x76, 0x06, 0x3F, 0x0D, 0xFD, 0xCE, 0xC9, 0x8C, 0xBE, 0x12, 0xA1, 0x58, 0xBB, 0x16, 0xCC,
+    0xAD, 0x74, 0x02, 0xDF, 0xB8, 0x37, 0x6E, 0xC3, 0x37, 0xBB, 0xEA, 0x19, 0xF0, 0xDF, 0x8E, 0x50,
+    0xAE, 0x3E, 0x82, 0x8B, 0xC3, 0xDA, 0x7E, 0x55, 0x41, 0x92, 0xB6, 0xD3, 0xEE, 0x3E, 0x23, 0x69,
+    0xA1, 0xCC, 0x44, 0x7D, 0xE9, 0x24, 0xF6, 0x70, 0x17, 0x1D, 0x45, 0x99, 0x1D, 0xBA, 0xB0, 0x8B,
+    0x88, 0xC3, 0x8C, 0x00, 0x9F, 0xFB, 0xCD, 0xF4, 0x83, 0xDF, 0x4B, 0x4C, 0x8A, 0x9D, 0x6B, 0xCC,
+    0x71, 0x22, 0x23, 0x9A, 0x23, 0xA0, 0x88, 0x8F, 0x00, 0x0F, 0xF0, 0xE0, 0x1F, 0xC2, 0x18, 0xAA,
+    0x58, 0x4F, 0xE0, 0xB2, 0x20, 0xCE, 0xDE, 0x6A, 0x93, 0xC0, 0xCE, 0x4D, 0xFC, 0x83, 0x20, 0xAE,
+    0x93, 0x9D, 0x71, 0x74, 0x7B, 0x63, 0x64, 0x4E, 0xFA, 0x71, 0x25, 0xFA, 0xD7, 0xA0, 0x31, 0xB9,
+    0xF2, 0x2E, 0x34, 0x26, 0xFE, 0x52, 0x34, 0x66, 0xF1, 0x81, 0x62, 0xB5, 0x11, 0x86, 0xC7, 0x56,
+    0xF0, 0xE3, 0x10, 0x68, 0xA2, 0xDB, 0xBE, 0x33, 0xA4, 0x2A, 0x6B, 0x66, 0x92, 0x7A, 0x27, 0x29,
+    0x18, 0x49, 0x23, 0x4D, 0x06, 0xF0, 0xB8, 0xBD, 0x1D, 0xE2, 0xC9, 0x6E, 0x38, 0x7F, 0x42, 0x48,
+    0xF7, 0xB4, 0xBF, 0xD9, 0x96, 0xF8, 0xDC, 0x33, 0xF0, 0x8D, 0x6B, 0xEB, 0xEF, 0x78, 0x30, 0x17,
+    0x7F, 0x93, 0xC1, 0x3C, 0xC4, 0x2E, 0xFC, 0x94, 0x66, 0x01, 0x9A, 0xAF, 0xF4, 0xF0, 0x20, 0x2F,
+    0xC0, 0x67, 0x28, 0xDB, 0xDF, 0xDF, 0x45, 0x70, 0xD9, 0x8C, 0xB4, 0x23, 0xD5, 0x52, 0x2D, 0x94,
+    0x5B, 0xB9, 0x81, 0xC2, 0x9D, 0x81, 0x72, 0xB7, 0xFB, 0x3D, 0xFF, 0xDE, 0x10, 0xCF, 0x2E, 0x58,
+    0xB3, 0x9A, 0x76, 0x4A, 0x57, 0xB5, 0x9C, 0xFA, 0xC5, 0xBD, 0x19, 0xE9, 0x74, 0x83, 0xEE, 0xEF,
+    0x84, 0xC7, 0x05, 0x87, 0x89, 0xB6, 0xE7, 0xD0, 0x04, 0xDC, 0x97, 0x23, 0xD5, 0x74, 0x99, 0x72,
+    0x71, 0xA0, 0x6A, 0x64, 0x08, 0xFA, 0x6B, 0x45, 0x9F, 0x9D, 0xC8, 0xA2, 0xD3, 0xEB, 0x63, 0xA9,
+    0x6F, 0xCD, 0xF0, 0xCF, 0x76, 0xBC, 0xBA, 0x0A, 0xA7, 0x02, 0x99, 0xD3, 0xAF, 0x22, 0xC7, 0x7A,
+    0xB9, 0x4C, 0xA3, 0xF7, 0x68, 0xDE, 0x55, 0xB0, 0xA1, 0x8E, 0x75, 0x20, 0x99, 0x09, 0xD7, 0x46,
+    0xEA, 0xF1, 0x32, 0xC5, 0xD2, 0xC0, 0x51, 0x1D, 0xF0, 0x2F, 0xCE, 0xB8, 0xE8, 0x7F, 0x3C, 0x24,
+    0x2B, 0xA9, 0x90, 0x14, 0x1A, 0x7D, 0x30, 0x33, 0x4C, 0x57, 0xF2, 0x8B, 0x9E, 0xDF, 0x19, 0x5E,
+    0x3E, 0xC2, 0x15, 0x07, 0xDF, 0x2C, 0x22, 0xFF, 0xE2, 0xD8, 0xE4, 0xFA, 0x14, 0x5A, 0x29, 0xE7,
+    0x72, 0x66, 0x63, 0xC3, 0xF7, 0x5D, 0xDF, 0xC4, 0x26, 0xD6, 0xA9, 0x4E, 0x9F, 0xF2, 0xF4, 0xFD,
+    0x7F, 0xC2, 0x0E, 0xDD, 0xD6, 0x72, 0x90, 0x0D, 0x98, 0x32, 0xC0, 0x3F, 0x85, 0x32, 0x60, 0xE7,
+    0xE3, 0x88, 0xCA, 0x72, 0xDE, 0xB1, 0x39, 0x17, 0x4E, 0x3C, 0x05, 0x1F, 0x3B, 0x3E, 0x15, 0x10,
+    0xE1, 0x1C, 0xF0, 0xCD, 0x5D, 0x88, 0x74, 0xCC, 0x11, 0xEB, 0x67, 0x0F, 0x7E, 0x33, 0xB6, 0xF4,
+    0xE9, 0x80, 0x18, 0xD9, 0x94, 0xB1, 0x13, 0xB8, 0x05, 0x5E, 0xD8, 0xA3, 0x1C, 0xAB, 0xFE, 0x2C,
+    0xF4, 0xBF, 0x8B, 0xF6, 0x4C, 0x34, 0xB1, 0x8A, 0x55, 0xAC, 0xE7, 0x7A, 0xB6, 0x8B, 0x9D, 0xED,
+    0x62, 0xE7, 0xDF, 0xD5, 0xD8, 0x3E, 0x07, 0x87, 0x94, 0x0B, 0x75, 0xE4, 0xB3, 0x27, 0x83, 0x71,
+    0x94, 0x11, 0x47, 0x39, 0xF1, 0xC8, 0xEE, 0xEA, 0x2E, 0xC8, 0x2F, 0xE2, 0xDB, 0x6A, 0x2E, 0xA6,
+    0x73, 0x55, 0x58, 0x9A, 0xF2, 0x99, 0x53, 0x61, 0xC6, 0xD1, 0x95, 0xF1, 0x91, 0x72, 0x72, 0x65,
+    0x74, 0x27, 0x18, 0x87, 0x99, 0xBB, 0x96, 0x3F, 0x06, 0x1B, 0xA8, 0x17, 0xEA, 0x37, 0xFA, 0xBA,
+    0x7F, 0xA1, 0xA6, 0x3A, 0x35, 0x77, 0x75, 0xA0, 0x8C, 0x70, 0x03, 0x1E, 0x81, 0xBA, 0x3F, 0xBE,
+    0x71, 0x7C, 0xA2, 0xC7, 0x2C, 0xA3, 0xF5, 0xBF, 0x56, 0x53, 0xBF, 0x91, 0x5D, 0x3F, 0x37, 0xF2,
+    0x17, 0x17, 0x2F, 0xDC, 0xBE, 0xCB, 0x41, 0xE0, 0xF6, 0x63, 0xA7, 0xAC, 0xB0, 0x73, 0x86, 0x67,
+    0xE8, 0xC2, 0xF7, 0x79, 0x7F, 0xFA, 0x3E, 0x53, 0x37, 0x31, 0x35, 0x77, 0x32, 0xE0, 0x4F, 0x01,
+    0x4E, 0x28, 0xDA, 0xBB, 0x76, 0xCF, 0xD9, 0xE7, 0x3F, 0x99, 0x7A, 0x7F, 0x6B, 0xD8, 0xE1, 0xF3,
+    0x1F, 0xDF, 0x39, 0xD5, 0xF8, 0x9B, 0xED, 0x9C, 0xDF, 0xB6, 0xED, 0xA2, 0xCD, 0xFC, 0xDA, 0x4E,
+    0xB0, 0xB7, 0xC0, 0xFC, 0x08, 0xA6, 0xAF, 0xFA, 0x33, 0xD0, 0x7E, 0xDA, 0x6D, 0x55, 0xB1, 0x8A,
+    0x75, 0xAC, 0x63, 0x1D, 0x6D, 0xB4, 0x73, 0xFE, 0xFB, 0x5D, 0x8C, 0xE9, 0x0C, 0x3B, 0xD0, 0xAC,
+    0xCF, 0xA4, 0x72, 0xFF, 0x1D, 0x34, 0xF7, 0xDB, 0x62, 0x09, 0xF0, 0x4C, 0xE6, 0x33, 0x8F, 0x64,
+    0x55, 0xAC, 0xCE, 0x21, 0xFE, 0xBF, 0xF4, 0x28, 0x8F, 0x1B, 0x6B, 0x39, 0xDC, 0xA7, 0xFC, 0x60,
+    0xA1, 0xFE, 0xE1, 0x84, 0xFF, 0xCA, 0xA9, 0xC6, 0x22, 0xFE, 0xDB, 0x93, 0xD9, 0x9C, 0xB4, 0x74,
+    0xD9, 0x77, 0xF0, 0x92, 0xD4, 0x15, 0x7A, 0x33, 0x9D, 0xB6, 0x86, 0x4C, 0x02, 0x9F, 0x30, 0xD3,
+    0x0D, 0xCE, 0x73, 0x99, 0xF6, 0x44, 0x55, 0xFD, 0xAD, 0x5B, 0xB0, 0xC1, 0x86, 0xAE, 0xED, 0xCA,
+    0xB5, 0x5C, 0xEB, 0xC5, 0x2E, 0xEE, 0xCE, 0x5D, 0xFA, 0x5B, 0x4F, 0x58, 0x36, 0x61, 0x2E, 0x52,
+    0xE5, 0x6F, 0x0A, 0x83, 0xD5, 0x7B, 0x92, 0x14, 0x6D, 0x0E, 0x5B, 0x9E, 0xEB, 0x94, 0xE3, 0x3C,
+    0xCC, 0x9A, 0x9D, 0x78, 0xE5, 0xB6, 0x0B, 0x93, 0x3A, 0x8E, 0xB6, 0xF3, 0x7D, 0xFE, 0x46, 0xA8,
+    0x19, 0x21, 0x87, 0xE9, 0x42, 0x29, 0xA5, 0x22, 0x01, 0x83, 0x44, 0xB7, 0x0B, 0x29, 0x6B, 0x02,
+    0x58, 0x7D, 0xAF, 0xAD, 0x22, 0x18, 0xF5, 0x19, 0x84, 0xD3, 0xB4, 0x8B, 0xFA, 0x9C, 0xF3, 0x37,
+    0x36, 0x36, 0x41, 0xA9, 0x0F, 0x8A, 0x4B, 0x62, 0xF7, 0xB9, 0x63, 0x9F, 0x23, 0xEE, 0x4F, 0x34,
+    0xA8, 0x63, 0xFB, 0x47, 0x52, 0x64, 0x90, 0x24, 0xAD, 0x14, 0xC3, 0xD6, 0x69, 0xA7, 0x4E, 0xD5,
+    0x0B, 0xB8, 0x5B, 0x0C, 0x6A, 0x4B, 0xE9, 0xE6, 0xAD, 0x72, 0xAA, 0xB7, 0xE7, 0x14, 0x98, 0x9B,
+    0x50, 0xAA, 0xE5, 0xB2, 0x07, 0xF1, 0xD9, 0xC3, 0x3D, 0x18, 0xA4, 0xED, 0x0A, 0x74, 0xD2, 0xBB,
+    0x87, 0x59, 0xEB, 0x3A, 0xCC, 0x9C, 0x7E, 0x7F, 0xA7, 0xAE, 0xE4, 0x50, 0x19, 0xFF, 0xE3, 0xAF,
+    0x2A, 0xB3, 0x7D, 0x49, 0xA9, 0x96, 0xDE, 0xC9, 0xCC, 0xBF, 0x97, 0x12, 0x6E, 0xE1, 0x7E, 0x1D,
+    0x7C, 0xE3, 0xFA, 0xF5, 0xEB, 0xD7, 0x4F, 0xA2, 0x2D, 0x7A, 0x80, 0x6F, 0x5C, 0xBF, 0x7E, 0xFD,
+    0xFA, 0xF5, 0xEB, 0x97, 0x72, 0x4F, 0x7F, 0x94, 0x4F, 0xC7, 0x3B, 0xAA, 0x1B, 0xFD, 0xE4, 0x27,
+    0x17, 0x9B, 0x68, 0x63, 0xBD, 0x54, 0xE9, 0xF8, 0xD3, 0x11, 0x1B, 0xED, 0xC9, 0xA7, 0x23, 0xDD,
+    0x0F, 0xD4, 0xEA, 0xDA, 0x6A, 0x36, 0xBB, 0xD4, 0xC9, 0x4D, 0x4D, 0xEC, 0x7A, 0x1F, 0xC4, 0x70,
+    0x75, 0x2D, 0x94, 0xB5, 0x1B, 0x9B, 0x7C, 0xF4, 0x93, 0x7A, 0x3D, 0xB6, 0x9A, 0xD4, 0x44, 0x1B,
+    0xBB, 0x30, 0x3C, 0xB5, 0x99, 0xD5, 0xCE, 0x4D, 0xCC, 0x11, 0xDA, 0x4D, 0x5B, 0x2C, 0xB8, 0xC7,
+    0x16, 0x5C, 0x30, 0x8B, 0x0F, 0x26, 0xE1, 0x6F, 0x26, 0xFC, 0x58, 0xA5, 0x2E, 0x98, 0x95, 0x21,
+    0xFC, 0x03, 0xAD, 0x98, 0xBF, 0x8F, 0x1E, 0xC7, 0x79, 0xC7, 0x3F, 0xBB, 0x63, 0x6B, 0x01, 0x6F,
+    0x31, 0x2E, 0x22, 0x20, 0x90, 0x60, 0x6C, 0x8A, 0x54, 0x06, 0xEC, 0xFD, 0x07, 0x78, 0xEF, 0xAC,
+    0xA9, 0xC2, 0x85, 0x0B, 0x32, 0x81, 0x4E, 0x29, 0x5C, 0x08, 0xE9, 0x6C, 0xA5, 0x60, 0x0A, 0x17,
+    0x29, 0xEE, 0x6E, 0xD7, 0x62, 0xA1, 0xC2, 0x05, 0x99, 0xC2, 0x69, 0xE5, 0x42, 0x71, 0x62, 0x29,
+    0x08, 0x9B, 0x04, 0x50, 0x80, 0xF7, 0xBD, 0x1D, 0xE9, 0x0A, 0x02, 0x61, 0xA1, 0xB5, 0x54, 0xB8,
+    0x70, 0xA1, 0xB5, 0x49, 0x80, 0xB6, 0x59, 0x70, 0x28, 0xAD, 0xAC, 0xE1, 0x71, 0x76, 0xBF, 0x29,
+    0xF6, 0x8E, 0x22, 0x65, 0xD9, 0x6E, 0xB2, 0xD8, 0x79, 0xE6, 0x17, 0xF6, 0xC7, 0x3C, 0xF3, 0xCC,
+    0x33, 0x9F, 0x67, 0x00, 0xBE, 0xC9, 0x1E, 0x91, 0xC9, 0x8C, 0x66, 0x60, 0xBD, 0xBE, 0xBC, 0xBF,
+    0xBF, 0x5F, 0x4B, 0xA9, 0x97, 0x3E, 0x0A, 0x50, 0x7A, 0xA8, 0x81, 0x2D, 0xE4, 0xE7, 0xD5, 0x1F,
+    0xEF, 0x5F, 0xEE, 0xA5, 0xF7, 0x25, 0x7D, 0xE7, 0x0B, 0x7B, 0x5F, 0xEC, 0xA5, 0x8F, 0x24, 0xDD,
+    0x92, 0x54, 0x4B, 0x09, 0xEC, 0x00, 0xD0, 0x77, 0x80, 0x11, 0x40, 0x35, 0x03, 0x1C, 0x27, 0xC0,
+    0x7C, 0x1C, 0x80, 0xEA, 0x47, 0x23, 0x30, 0x57, 0x1E, 0x4C, 0x70, 0x0D, 0xD4, 0xDD, 0x31, 0x30,
+    0x67, 0x09, 0x8A, 0x60, 0x26, 0xA8, 0xBB, 0x32, 0xC0, 0x4C, 0xE5, 0x29, 0x02, 0xAE, 0xC3, 0x75,
+    0xF4, 0x30, 0xC3, 0x4C, 0x29, 0x29, 0xE1, 0x24, 0x85, 0x4C, 0x92, 0x46, 0x2B, 0x49, 0xDE, 0x79,
+    0xD0, 0xC5, 0x05, 0xF2, 0xC5, 0x4E, 0x50, 0xA4, 0xD6, 0x83, 0x9D, 0x7A, 0xE9, 0xF7, 0x92, 0x6E,
+    0x8D, 0x50, 0x7B, 0x68, 0x61, 0xFD, 0x0A, 0x54, 0x1E, 0x5A, 0xFD, 0x26, 0x93, 0x66, 0x13, 0xD8,
+    0x59, 0xCF, 0x81, 0x83, 0x29, 0x61, 0x6E, 0x07, 0xEC, 0x35, 0xCF, 0x91, 0x6B, 0x9E, 0x9F, 0x24,
+    0x9D, 0x48, 0x8B, 0x95, 0x46, 0xA7, 0x48, 0xAF, 0x3B, 0xF4, 0x12, 0x5B, 0x2A, 0xBF, 0xC5, 0x0C,
+    0x5B, 0xF2, 0x71, 0x4B, 0x16, 0xD6, 0xDC, 0x0C, 0xBB, 0xFD, 0x2B, 0x5D, 0xAF, 0x99, 0x5E, 0xEA,
+    0xB6, 0x94, 0xD3, 0x16, 0xD2, 0x16, 0x76, 0x5B, 0x58, 0xB6, 0xB0, 0xEC, 0xF8, 0xEE, 0xD2, 0xAF,
+    0x1A, 0x8F, 0xBD, 0x34, 0xF4, 0x7A, 0xC8, 0xB3, 0xFB, 0xFB, 0x7F, 0x23, 0xE9, 0xAE, 0xA4, 0xD7,
+    0xBF, 0xE0, 0x17, 0x3F, 0x57, 0x6D, 0xC8, 0x67, 0x28, 0x27, 0xA8, 0x07, 0xE8, 0x1B, 0xF2, 0x05,
+    0xCA, 0x08, 0xF5, 0x08, 0x7D, 0x47, 0xBE, 0x00, 0xD4, 0x92, 0xA7, 0x94, 0x02, 0xF9, 0xE9, 0x9B,
+    0x33, 0x24, 0xEA, 0x06, 0x47, 0x39, 0x60, 0x7D, 0x3E, 0x61, 0x02, 0x3B, 0x88, 0xD4, 0x0D, 0x1B,
+    0xCA, 0x01, 0xDB, 0xE5, 0x11, 0x33, 0x72, 0x0C, 0x91, 0xBA, 0x63, 0x43, 0x39, 0x52, 0x35, 0x79,
+    0xA4, 0x1C, 0x38, 0xA6, 0x08, 0xD4, 0xDE, 0x44, 0xCA, 0x90, 0xCF, 0x98, 0x54, 0x4A, 0xD2, 0x03,
+    0x49, 0x8A, 0x4E, 0xD2, 0x6C, 0x07, 0x70, 0x17, 0x23, 0x58, 0x7F, 0x04, 0x45, 0xD8, 0xDF, 0xDF,
+    0xFF, 0xDB, 0x73, 0x93, 0xF8, 0x9C, 0xC1, 0x9C, 0x55, 0x1F, 0xEE, 0xEF, 0x97, 0xD2, 0x5C, 0x4B,
+    0xD3, 0x17, 0xF7, 0x7E, 0xE7, 0xCC, 0x9C, 0xCE, 0xAC, 0xCB, 0x23, 0xAA, 0x90, 0x2F, 0x64, 0xC2,
+    0x75, 0x36, 0x60, 0x66, 0x16, 0xD4, 0x60, 0x92, 0x89, 0x45, 0x82, 0x32, 0xDA, 0xD1, 0x79, 0xB0,
+    0xC1, 0xBD, 0xBA, 0x00, 0xD5, 0x28, 0x1B, 0x00, 0xF7, 0x8B, 0xA4, 0x06, 0x68, 0x3F, 0xFC, 0x34,
+    0x01, 0xF4, 0x92, 0x07, 0x90, 0x16, 0x80, 0x4C, 0x0A, 0x00, 0x46, 0x6A, 0x00, 0x4A, 0x25, 0x00,
+    0xDA, 0x35, 0x2F, 0xB4, 0xE6, 0xED, 0x9A, 0x17, 0x92, 0x22, 0xE0, 0xD6, 0xDC, 0xE8, 0xBE, 0xFA,
+    0x08, 0x6E, 0x69, 0x93, 0x22, 0x46, 0x0F, 0xF4, 0x40, 0x11, 0xA7, 0x52, 0xEF, 0x2A, 0x1A, 0x4D,
+    0xB5, 0x8C, 0xA2, 0x53, 0xA7, 0xD9, 0x28, 0x3E, 0xA3, 0x11, 0x29, 0x9A, 0xD3, 0x1B, 0x11, 0xCC,
+    0x04, 0xC5, 0x08, 0xD6, 0xC3, 0x06, 0xF2, 0x29, 0xDB, 0xEF, 0x3B, 0xAB, 0x09, 0xA7, 0x11, 0xAA,
+    0x00, 0xE5, 0x59, 0x6F, 0x0D, 0xEC, 0x1A, 0x8A, 0x8F, 0x46, 0xFA, 0x5B, 0xD2, 0x52, 0x4B, 0xA1,
+    0x97, 0xB8, 0xA2, 0xEB, 0xBC, 0x02, 0x50, 0x0D, 0xA0, 0x62, 0x82, 0xFE, 0x9D, 0x19, 0x5C, 0x70,
+    0x1D, 0x75, 0xB2, 0x23, 0x56, 0x2F, 0x44, 0x4A, 0x0D, 0xC2, 0x68, 0x72, 0x3E, 0x5F, 0x16, 0x1B,
+    0x50, 0x7B, 0x35, 0xD1, 0xBE, 0x3E, 0x0A, 0x77, 0x33, 0x39, 0x5F, 0xFD, 0x4A, 0x76, 0xB2, 0xA1,
+    0x7D, 0x77, 0x2E, 0x62, 0x15, 0xFA, 0x17, 0x52, 0x91, 0xEA, 0x9F, 0x2F, 0x99, 0xCA, 0x28, 0xDA,
+    0xF7, 0x97, 0xB6, 0xAB, 0xA6, 0xB6, 0xF7, 0xC5, 0x5C, 0x69, 0xCC, 0xF4, 0x9A, 0x26, 0xDA, 0x5F,
+    0x29, 0x51, 0x45, 0x37, 0x53, 0xC8, 0x8A, 0x4C, 0x3E, 0xEB, 0xF8, 0x6B, 0xF8, 0x01, 0x5F, 0x83,
+    0x0A, 0xDB, 0x90, 0x4B, 0x1D, 0x38, 0x79, 0xC8, 0x96, 0x86, 0x2F, 0xBC, 0x9E, 0xF9, 0x09, 0x90,
+    0xCD, 0x60, 0x43, 0xDB, 0x50, 0xA6, 0x6A, 0xC0, 0xC8, 0x44, 0x72, 0xF9, 0x05, 0x34, 0xB9, 0x8E,
+    0x7E, 0xB6, 0x01, 0xA7, 0x17, 0x12, 0xF5, 0xFD, 0x51, 0xD8, 0x4F, 0xA3, 0xF3, 0xE5, 0x27, 0x8B,
+    0x0D, 0x26, 0xB5, 0x27, 0x29, 0x5B, 0xAA, 0xA0, 0x46, 0x45, 0xAA, 0x87, 0xF6, 0x87, 0x2A, 0x27,
+    0xE7, 0xDB, 0x77, 0xE7, 0x6A, 0xAC, 0x42, 0x7F, 0x2D, 0x14, 0x73, 0x7D, 0x37, 0x66, 0xFA, 0xF6,
+    0xA3, 0x44, 0xFB, 0x73, 0x2D, 0x54, 0xB1, 0x55, 0x53, 0x2C, 0x95, 0x7C, 0xA6, 0xAB, 0x1A, 0x68,
+    0x83, 0x02, 0x55, 0x2A, 0x42, 0x26, 0x8A, 0x60, 0x66, 0xCA, 0x50, 0x44, 0xCA, 0x60, 0x03, 0x65,
+    0xA8, 0x47, 0x6C, 0x68, 0x3D, 0x76, 0x54, 0x83, 0xFD, 0xD5, 0x02, 0xF6, 0x76, 0x02, 0x7B, 0x2F,
+    0x82, 0x55, 0x80, 0x4A, 0x03, 0x54, 0xEA, 0xA0, 0x52, 0x03, 0xB5, 0x3C, 0xD4, 0x0A, 0x50, 0x2B,
+    0x81, 0x7B, 0x4F, 0xE0, 0x4E, 0xE4, 0x71, 0xEF, 0x28, 0xE0, 0x7C, 0x9F, 0x70, 0xDE, 0x89, 0xD6,
+    0x5B, 0xF9, 0xD6, 0x17, 0x0A, 0xAD, 0xCF, 0x95, 0xE8, 0x25, 0x5F, 0x4B, 0xA1, 0x94, 0x52, 0x9E,
+    0x68, 0xE9, 0xA9, 0x7C, 0xED, 0xCB, 0x50, 0x86, 0x3C, 0xE5, 0x89, 0x9E, 0x63, 0x6A, 0x5F, 0x77,
+    0x65, 0xB0, 0x63, 0x9E, 0xCC, 0x44, 0xCF, 0x8C, 0xF3, 0x0E, 0x1B, 0xAC, 0x37, 0xC9, 0x04, 0x94,
+    0x25, 0x9C, 0xEF, 0xB1, 0xC1, 0x79, 0x93, 0xFA, 0x11, 0xB9, 0x80, 0xFB, 0xDF, 0xCB, 0x80, 0x1B,
+    0xC8, 0x54, 0x45, 0xE8, 0x6F, 0x0A, 0xDC, 0x83, 0x47, 0x23, 0x75, 0x3A, 0x4C, 0xD8, 0xBE, 0xBA,
+    0xD1, 0x94, 0x1F, 0xDE, 0xBC, 0x1D, 0xCC, 0xC7, 0x0F, 0x62, 0xCA, 0x62, 0x3A, 0xAA, 0xBB, 0xE4,
+    0xAA, 0xAB, 0xA1, 0xB5, 0x37, 0xC7, 0xD9, 0x5D, 0x7D, 0x10, 0xEB, 0xF7, 0x7C, 0x3A, 0x32, 0x0A,
+    0xAE, 0xEE, 0x14, 0xED, 0xAD, 0x50, 0x25, 0xF3, 0x51, 0x32, 0x62, 0xEE, 0x51, 0xE3, 0xAE, 0xF8,
+    0xE7, 0x3A, 0xFB, 0xCB, 0x00, 0xE6, 0xF7, 0x09, 0xB2, 0xB9, 0x07, 0xDA, 0xE6, 0xB9, 0x06, 0xBE,
+    0x6F, 0x47, 0x70, 0x57, 0x23, 0xD8, 0xB0, 0x80, 0x49, 0xCE, 0x83, 0x6C, 0x00, 0x77, 0x92, 0xC0,
+    0x06, 0xFD, 0x99, 0xC6, 0x87, 0xFB, 0xFB, 0xFD, 0x89, 0x24, 0x4D, 0x92, 0x34, 0x3B, 0x49, 0x7A,
+    0x59, 0x92, 0x7E, 0x21, 0x49, 0x9F, 0xA8, 0xA1, 0x98, 0xDB, 0x81, 0x4C, 0x2F, 0x4F, 0xD0, 0xDE,
+    0x9D, 0xA1, 0x7A, 0xA8, 0x86, 0x72, 0x69, 0x47, 0x72, 0x75, 0x64, 0xFD, 0xC3, 0x75, 0x9D, 0x76,
+    0x94, 0xBA, 0xAF, 0x01, 0x8D, 0x99, 0x86, 0x72, 0x06, 0x79, 0x37, 0x80, 0x5E, 0x5D, 0x20, 0x93,
+    0x0D, 0x60, 0x66, 0xE7, 0xA1, 0xF8, 0x64, 0x06, 0xEC, 0xDD, 0x00, 0xB8, 0xD7, 0x3D, 0xD0, 0xB7,
+    0x40, 0x3E, 0x27, 0xA0, 0x3C, 0x6B, 0x1E, 0x80, 0xC5, 0x79, 0x28, 0x27, 0x79, 0xE8, 0xDF, 0xD5,
+    0x27, 0xD9, 0x15, 0x19, 0x49, 0x8A, 0xA5, 0x24, 0x79, 0x2B, 0x69, 0xC1, 0x4A, 0x1A, 0x29, 0xA5,
+    0x19, 0xB2, 0xFE, 0x29, 0xB3, 0x3F, 0x73, 0xF6, 0xE9, 0x78, 0x7F, 0x3F, 0x1D, 0xC3, 0xF6, 0x89,
+    0x94, 0x9E, 0x48, 0xF3, 0x9F, 0x4A, 0xFD, 0xE7, 0x52, 0xA5, 0x85, 0x42, 0x8A, 0xF9, 0x72, 0x43,
+    0xFE, 0x98, 0x22, 0xD5, 0x1D, 0xAE, 0x1C, 0x29, 0xDF, 0x8F, 0xE4, 0x71, 0x81, 0xD9, 0x75, 0xB8,
+    0x4B, 0x23, 0xFD, 0x89, 0xA4, 0x51, 0x52, 0x70, 0xD2, 0x60, 0x97, 0x9F, 0x61, 0x12, 0x20, 0xA0,
+    0xF5, 0xAB, 0x9F, 0x29, 0x12, 0x64, 0x02, 0x7A, 0x0F, 0x75, 0x80, 0x72, 0x86, 0x5C, 0x0D, 0xF4,
+    0xC3, 0x67, 0xA3, 0xC8, 0xFA, 0x87, 0x70, 0x45, 0x0B, 0xB9, 0x34, 0x63, 0xB5, 0xFF, 0x3D, 0xDC,
+    0x04, 0xC8, 0x9F, 0x3D, 0x6D, 0x12, 0x50, 0x44, 0xA0, 0x0C, 0x80, 0x0D, 0x80, 0x1D, 0x81, 0xEA,
+    0x33, 0x11, 0x80, 0x6A, 0x02, 0xAA, 0x04, 0x58, 0x75, 0x7C, 0xD9, 0xEA, 0xF4, 0xA5, 0xE3, 0x52,
+    0xD2, 0x62, 0x24, 0x2D, 0x99, 0xA4, 0x85, 0x5E, 0x5A, 0xA8, 0xB5, 0x7E, 0xED, 0x8D, 0x33, 0x7F,
+    0x2C, 0xE9, 0x43, 0x49, 0xFA, 0x54, 0x92, 0xE6, 0x7F, 0xBD, 0x3C, 0xB3, 0x0F, 0xAE, 0xE1, 0x8C,
+    0x37, 0xCC, 0x04, 0x30, 0xC3, 0x79, 0xE3, 0x08, 0x98, 0x08, 0x64, 0x0B, 0x40, 0xDB, 0x9D, 0xFF,
+    0x46, 0xF1, 0x59, 0x63, 0xDF, 0xB1, 0x8E, 0x99, 0x32, 0x01, 0xB9, 0x38, 0xD3, 0xC3, 0xDA, 0x68,
+    0xD3, 0x63, 0x84, 0x91, 0x87, 0x2D, 0x1C, 0x1E, 0xC1, 0xD6, 0x41, 0xAA, 0xBA, 0x2C, 0xDA, 0x21,
+    0x8F, 0x45, 0x30, 0x93, 0x89, 0x26, 0x64, 0xA9, 0x0C, 0x2C, 0x76, 0xA4, 0xBD, 0x34, 0xE0, 0x3E,
+    0xF4, 0x54, 0xF2, 0x58, 0x75, 0x14, 0x6A, 0x30, 0x5A, 0xDF, 0x9D, 0x2D, 0x60, 0xE6, 0x55, 0xE5,
+    0x75, 0xA4, 0x56, 0xC0, 0xC9, 0xE3, 0x16, 0x70, 0xE3, 0xB9, 0xA6, 0xBF, 0x22, 0x3D, 0xA4, 0x3C,
+    0xED, 0xDF, 0x4A, 0xF9, 0x64, 0x42, 0x1E, 0x2E, 0xE0, 0xB0, 0xAF, 0x75, 0x26, 0x70, 0xF0, 0x5F,
+    0x38, 0x8A, 0x5B, 0x9D, 0x09, 0x6C, 0x0F, 0x70, 0xD8, 0x9B, 0xD1, 0x4C, 0x45, 0x74, 0x92, 0xD4,
+    0x48, 0xD2, 0x68, 0x24, 0x45, 0x9E, 0xE9, 0xF5, 0xC6, 0xB9, 0x1A, 0x56, 0xB5, 0xB4, 0x0D, 0x50,
+    0xFC, 0xD1, 0x62, 0xE9, 0xA1, 0x1C, 0x56, 0xD6, 0x70, 0x1D, 0x66, 0xC2, 0x35, 0x2B, 0x70, 0xE5,
+    0x09, 0x16, 0xAA, 0x81, 0x6C, 0x46, 0x60, 0x52, 0x19, 0xC0, 0xA4, 0xB6, 0x83, 0xF2, 0xD1, 0x3A,
+    0x89, 0x03, 0x50, 0xAD, 0xC8, 0x11, 0x00, 0x34, 0x00, 0x56, 0x1E, 0xE8, 0xE5, 0xA1, 0x58, 0xD4,
+    0x81, 0xFB, 0x48, 0x0D, 0xB9, 0x5E, 0x10, 0x54, 0xB1, 0x58, 0x40, 0xBE, 0x9C, 0xB1, 0x33, 0x36,
+    0xD1, 0x8F, 0xD4, 0xA9, 0x10, 0xB8, 0xC9, 0x4D, 0xD0, 0x06, 0xE0, 0x72, 0x05, 0x17, 0x0A, 0x8F,
+    0xCD, 0x02, 0xC6, 0x1F, 0x42, 0xA8, 0x1A, 0x0E, 0x8A, 0x81, 0xEA, 0x5B, 0x13, 0xC5, 0x70, 0x48,
+    0x36, 0x55, 0x0D, 0x87, 0xE5, 0x40, 0x75, 0x71, 0xA2, 0x18, 0x76, 0xE4, 0x53, 0xDD, 0xB0, 0x2B,
+    0x07, 0xEA, 0x8B, 0x13, 0xE5, 0x70, 0x4C, 0x1E, 0xEB, 0x8E, 0xE3, 0x72, 0x7C, 0xB6, 0xFD, 0x17,
+    0x49, 0x4B, 0x2F, 0xE9, 0x8A, 0x24, 0xBF, 0xE2, 0x06, 0x09, 0x70, 0x40, 0xD5, 0x9D, 0x29, 0x3E,
+    0x0F, 0x98, 0x5F, 0x7A, 0xEC, 0x15, 0xD8, 0xDB, 0xC2, 0x69, 0xC0, 0xDC, 0xF3, 0x54, 0x37, 0xE0,
+    0x68, 0x4B, 0x76, 0x1A, 0x28, 0xEF, 0x79, 0xDC, 0xEB, 0x5D, 0xBE, 0xB8, 0xAE, 0x8E, 0x92, 0x82,
+    0x74, 0xDF, 0x2B, 0xB6, 0x3C, 0x9B, 0xA7, 0xD5, 0xEC, 0x6B, 0x0F, 0x3D, 0x9C, 0x57, 0x81, 0x63,
+    0x9E, 0x65, 0x7B, 0x4C, 0xCB, 0xF6, 0x18, 0xF7, 0x79, 0x71, 0xB0, 0x7B, 0x42, 0x6C, 0xFE, 0x8C,
+    0xB8, 0xB0, 0x63, 0xC3, 0xDE, 0x63, 0x71, 0xD8, 0x4B, 0x9A, 0x3F, 0x13, 0xEB, 0x10, 0x22, 0x2F,
+    0xE6, 0xA1, 0x1C, 0x8B, 0x50, 0xFA, 0xBA, 0xB3, 0xBE, 0x66, 0x87, 0x63, 0x9B, 0x4F, 0xA4, 0x3C,
+    0x94, 0x83, 0x09, 0xA5, 0xAF, 0x1B, 0xEB, 0x2B, 0x76, 0x38, 0x0E, 0xF2, 0x89, 0x98, 0x85, 0x72,
+    0x30, 0x63, 0xE1, 0x6B, 0x6C, 0x57, 0xB1, 0x65, 0xC3, 0x41, 0x1E, 0x88, 0x59, 0x28, 0xFD, 0xD3,
+    0xCD, 0x17, 0xF2, 0x40, 0x64, 0x2A, 0x7F, 0xF7, 0x6F, 0xA7, 0x6F, 0xDD, 0xA9, 0xA5, 0xD5, 0xAB,
+    0xAD, 0x70, 0x26, 0x75, 0x00, 0x3B, 0x00, 0x13, 0x60, 0x05, 0x17, 0x68, 0x01, 0x78, 0x11, 0xF7,
+    0x98, 0x08, 0x9C, 0x3C, 0x60, 0xBB, 0x3F, 0x29, 0xF4, 0x10, 0xAC, 0x34, 0x60, 0xBB, 0x22, 0x60,
+    0x3D, 0x09, 0xEB, 0x39, 0xC0, 0x7A, 0xF6, 0x1E, 0x8B, 0x43, 0xAC, 0xCF, 0x13, 0x56, 0x4A, 0x58,
+    0x69, 0x3A, 0x7B, 0x42, 0xA7, 0x4F, 0x81, 0x46, 0x7B, 0x32, 0x02, 0xC8, 0x76, 0x80, 0x49, 0x1B,
+    0x00, 0x3B, 0x46, 0x00, 0x77, 0x75, 0x04, 0x58, 0xD6, 0xAE, 0xF8, 0x74, 0x97, 0x96, 0x06, 0x64,
+    0xA5, 0x01, 0x93, 0x36, 0x54, 0x1E, 0x1B, 0x12, 0xD6, 0xE3, 0x4E, 0x02, 0x15, 0xC8, 0x7A, 0xF6,
+    0x30, 0xC9, 0xC1, 0x84, 0x0D, 0x89, 0x62, 0xC0, 0x9D, 0x04, 0x7A, 0xD0, 0x25, 0x29, 0x51, 0xCC,
+    0x4E, 0x1A, 0xA8, 0x26, 0x69, 0x86, 0xF6, 0xB6, 0x96, 0x8E, 0x6C, 0x55, 0x53, 0x04, 0x33, 0xAE,
+    0x63, 0xDD, 0xFC, 0x61, 0x55, 0xBA, 0x6E, 0xA4, 0xC9, 0x76, 0x45, 0x70, 0x98, 0x90, 0x28, 0x4E,
+    0x02, 0xF6, 0x92, 0x67, 0xCF, 0x91, 0x4D, 0x89, 0xFA, 0x44, 0x92, 0x95, 0x26, 0x27, 0x35, 0xD2,
+    0x4F, 0xCE, 0x89, 0x4A, 0xD7, 0xA1, 0xD5, 0x4C, 0xB6, 0x64, 0x7D, 0x57, 0x04, 0xEC, 0x68, 0x3D,
+    0x66, 0xAA, 0x3B, 0xB2, 0xF4, 0xDC, 0x99, 0xB9, 0xAF, 0x33, 0x74, 0x84, 0x91, 0xF4, 0x84, 0x38,
+    0x9F, 0xA9, 0x1E, 0x60, 0x79, 0xE5, 0x3A, 0xC5, 0xD2, 0x2E, 0x3F, 0xED, 0x67, 0x27, 0x29, 0xD5,
+    0x92, 0xA2, 0x95, 0x14, 0x8C, 0xA4, 0x8E, 0x2B, 0xFA, 0xCD, 0x13, 0xFA, 0xCD, 0x22, 0xA5, 0xBA,
+    0x62, 0xCC, 0xA4, 0xB1, 0xEA, 0xAA, 0xA1, 0x1A, 0x8F, 0x48, 0xD8, 0x77, 0x62, 0xE9, 0xA9, 0x5E,
+    0x1B, 0x1D, 0xB8, 0xEA, 0x87, 0x13, 0xEC, 0x8E, 0x4A, 0x4F, 0xF6, 0x49, 0x74, 0x60, 0xEE, 0x8E,
+    0x09, 0xEC, 0xEB, 0x57, 0x03, 0x6C, 0x5A, 0x79, 0x78, 0x28, 0x41, 0x71, 0x77, 0x9C, 0xA1, 0x7E,
+    0xF9, 0x85, 0x04, 0xF3, 0x61, 0x99, 0xB0, 0x0F, 0xA6, 0x6A, 0x79, 0x49, 0xAF, 0x0D, 0x4E, 0x4A,
+    0x55, 0xE3, 0xA4, 0xE1, 0x00, 0xA7, 0x39, 0x0B, 0x3C, 0xAF, 0x0E, 0xB2, 0x57, 0xDE, 0x24, 0x93,
+    0x26, 0x7A, 0xA9, 0xB1, 0x23, 0x6F, 0x9B, 0x89, 0xB2, 0x73, 0xF0, 0xB6, 0x09, 0x6B, 0x61, 0x6B,
+    0x22, 0xA5, 0xAF, 0x27, 0xB6, 0x48, 0xF2, 0x46, 0x4A, 0x54, 0x92, 0x2F, 0xA4, 0x94, 0xE9, 0xC7,
+    0xBD, 0x77, 0xDE, 0xCC, 0xC5, 0x84, 0x1B, 0x7A, 0xCC, 0x6C, 0x03, 0x6E, 0x10, 0x66, 0xA9, 0x26,
+    0xDC, 0xAF, 0xD5, 0x98, 0xC5, 0x4D, 0xB8, 0xDB, 0x6A, 0xCC, 0xD2, 0x4E, 0xAB, 0x53, 0x82, 0x7C,
+    0xA9, 0x28, 0xF4, 0xC8, 0x17, 0xA7, 0x7D, 0x30, 0x21, 0x4F, 0x79, 0xC0, 0x11, 0x29, 0x87, 0x0B,
+    0xE4, 0x53, 0x05, 0x47, 0x85, 0xA7, 0x7E, 0x35, 0x60, 0xC3, 0x21, 0x65, 0xB2, 0x0F, 0x57, 0x56,
+    0xF0, 0xAD, 0x14, 0x0A, 0xCD, 0x87, 0xD4, 0xB1, 0x3A, 0x63, 0x83, 0x97, 0xFE, 0x83, 0x42, 0x0B,
+    0xE5, 0xF2, 0x9F, 0x94, 0x61, 0x8D, 0x05, 0x4C, 0x80, 0x2C, 0x02, 0xBB, 0x67, 0x7E, 0x46, 0x5D,
+    0x6B, 0x2A, 0x25, 0x5D, 0xD4, 0xD0, 0x86, 0xDE, 0xE7, 0x4B, 0x3D, 0xE0, 0x6E, 0x06, 0xEC, 0x83,
+    0x44, 0x9E, 0x1C, 0xF4, 0x76, 0xC4, 0xBD, 0xBA, 0xD0, 0x0E, 0x4E, 0x0A, 0x85, 0x14, 0x70, 0x1A,
+    0xC9, 0x74, 0x9D, 0xFE, 0xB4, 0xB1, 0x12, 0x91, 0xAD, 0xED, 0xF2, 0x21, 0xF2, 0x4D, 0xDB, 0xE5,
+    0x63, 0x64, 0x6B, 0xB5, 0x20, 0x45, 0xDB, 0x15, 0x21, 0x62, 0xAF, 0x75, 0x6C, 0x23, 0xE5, 0x7B,
+    0x1D, 0x69, 0x7E, 0xA9, 0x7F, 0x4F, 0x8A, 0xAB, 0x65, 0x35, 0x67, 0x71, 0x4F, 0x2B, 0xDD, 0x1C,
+    0xE1, 0x68, 0xF5, 0x65, 0xFD, 0x1F, 0xCB, 0x26, 0xE8, 0x9B, 0x35, 0x3B, 0xF7, 0xA4, 0x48, 0x9E,
+    0x4A, 0x89, 0x2C, 0x58, 0x4F, 0x4D, 0x22, 0x0F, 0x76, 0xC0, 0x31, 0x63, 0x46, 0x3B, 0xB0, 0x39,
+    0x2F, 0xEC, 0xD8, 0x51, 0xF9, 0x72, 0x30, 0x13, 0x3B, 0x7A, 0xCA, 0xA1, 0x3F, 0xDB, 0xE0, 0x17,
+    0x27, 0xE9, 0x83, 0x00, 0x07, 0x75, 0x43, 0xE9, 0xDF, 0x80, 0x7F, 0xE7, 0xF9, 0x08, 0x52, 0x63,
+    0xA2, 0x19, 0xAC, 0x27, 0x54, 0x70, 0xB0, 0xE1, 0xA5, 0xAD, 0x93, 0xE6, 0x56, 0xFA, 0xED, 0xAE,
+    0x81, 0x43, 0xE0, 0x08, 0x70, 0x1D, 0xB8, 0x89, 0xBF, 0xB4, 0x52, 0x5A, 0x67, 0x5B, 0x89, 0xE7,
+    0x97, 0x2E, 0x4B, 0x24, 0x66, 0x4C, 0x34, 0xC1, 0x8E, 0x98, 0xC9, 0xFA, 0x16, 0xCA, 0xE0, 0xCC,
+    0x04, 0x76, 0x4C, 0xB5, 0x87, 0xEA, 0xE6, 0x83, 0x04, 0xD4, 0x1F, 0xBE, 0x37, 0xAE, 0x81, 0xDE,
+    0x4A, 0x1F, 0xD3, 0x3A, 0xAC, 0x0E, 0x60, 0x0D, 0x09, 0x4B, 0xC5, 0x15, 0xEF, 0x22, 0x50, 0xAE,
+    0x71, 0x61, 0x2F, 0x45, 0xB0, 0x8B, 0xEE, 0x47, 0xD0, 0xA7, 0x72, 0x11, 0xAB, 0x2A, 0xB9, 0x88,
+    0xA6, 0x76, 0x6A, 0xA3, 0xD5, 0x45, 0x0D, 0x7D, 0xE4, 0x32, 0xED, 0x9C, 0x35, 0xDF, 0x80, 0x0B,
+    0xF0, 0x8F, 0xE4, 0x9E, 0x6F, 0xA0, 0x21, 0xBF, 0xD1, 0x51, 0x7A, 0x2C, 0xEC, 0x91, 0x07, 0xE9,
+    0x44, 0xA9, 0x54, 0xF3, 0x55, 0x60, 0x8B, 0x89, 0x5B, 0xCA, 0xB8, 0xC5, 0xA6, 0x2D, 0xEE, 0x60,
+    0xCB, 0xE1, 0xC1, 0x96, 0x78, 0xB0, 0xCD, 0xC3, 0x76, 0x5B, 0x0C, 0xDB, 0xAD, 0xF5, 0xDB, 0x6D,
+    0xCD, 0x76, 0x7B, 0x44, 0xDA, 0x26, 0xD2, 0xF1, 0x44, 0xEA, 0x47, 0x52, 0xEF, 0x49, 0x7D, 0x43,
+    0xCA, 0x9B, 0x2F, 0x61, 0x4E, 0x13, 0xF4, 0x23, 0xD8, 0xD5, 0x00, 0xFF, 0x3F, 0xDE, 0x6B, 0x3B,
+    0xC7, 0x9E, 0x99, 0xB2, 0xA9, 0xEE, 0x8A, 0x21, 0x51, 0x5F, 0x1A, 0xD8, 0x1E, 0x93, 0x7F, 0x1A,
+    0xB0, 0x6A, 0x70, 0x11, 0x34, 0x62, 0x34, 0x62, 0xEF, 0x8F, 0xB4, 0x2E, 0x64, 0xC9, 0x85, 0x62,
+    0x74, 0xA1, 0xEE, 0xDA, 0x70, 0x4C, 0x3F, 0xE5, 0x52, 0x2E, 0xE5, 0xA1, 0xCA, 0x43, 0x95, 0x8F,
+    0xEB, 0x5D, 0x9B, 0xE1, 0xFC, 0xF6, 0xB5, 0xF1, 0x75, 0xE1, 0xEB, 0xDA, 0xD7, 0xAE, 0xA9, 0x81,
+    0xE7, 0x1A, 0xBE, 0x72, 0x5D, 0x0D, 0xED, 0xD5, 0x85, 0x7C, 0xB1, 0x09, 0x1B, 0x5D, 0xA4, 0x0F,
+    0x0A, 0x46, 0x27, 0xF7, 0x87, 0x4A, 0xB6, 0xED, 0x76, 0xE9, 0xB0, 0x35, 0x1F, 0x3F, 0x98, 0x96,
+    0xFA, 0xDA, 0xCD, 0x5F, 0xA7, 0xD9, 0xBD, 0xFC, 0xDA, 0xA3, 0x30, 0x1F, 0x5B, 0xBD, 0xF6, 0xFB,
+    0x54, 0xCD, 0xD5, 0xBD, 0xE0, 0x42, 0x7B, 0xC3, 0xF7, 0x3F, 0x5C, 0xFA, 0x2C, 0x95, 0x8F, 0x52,
+    0x76, 0xB9, 0x56, 0x80, 0xDE, 0x7F, 0x1D, 0xBE, 0x72, 0x35, 0x40, 0x72, 0x0D, 0xF6, 0x64, 0xFA,
+    0x7C, 0xE1, 0x83, 0x69, 0x65, 0x6A, 0xFB, 0x41, 0x24, 0x9B, 0x9D, 0xA4, 0x0F, 0xCE, 0xAD, 0xF4,
+    0xB6, 0xA4, 0xC5, 0x79, 0xEA, 0xDB, 0x89, 0xEC, 0xBC, 0x90, 0xAB, 0xF5, 0xD4, 0x81, 0x2B, 0x13,
+    0x56, 0x33, 0x4B, 0x96, 0x8A, 0x81, 0xE4, 0xC8, 0x3E, 0x99, 0x30, 0x77, 0x3D, 0xF6, 0x3E, 0xB8,
+    0x2D, 0xCC, 0x13, 0xE6, 0x6E, 0xC0, 0x5D, 0x5B, 0xDE, 0x9A, 0x2B, 0x69, 0x74, 0x12, 0x4E, 0x13,
+    0xCF, 0xCF, 0x00, 0xB9, 0xA4, 0x7B, 0x92, 0x6E, 0x34, 0x6C, 0x76, 0x70, 0x3A, 0x61, 0xEE, 0x0D,
+    0xD8, 0xFB, 0x0D, 0xED, 0x8E, 0x6C, 0x99, 0x28, 0x1E, 0x8D, 0x54, 0xF7, 0x3B, 0xDA, 0x63, 0xB2,
+    0x25, 0x3E, 0x55, 0x4D, 0xF0, 0xF5, 0xEB, 0xB8, 0x5A, 0x9D, 0x79, 0x74, 0xDA, 0x53, 0x47, 0x62,
+    0x2E, 0x0A, 0x5F, 0x0F, 0xEC, 0xE5, 0x09, 0x33, 0x56, 0x9E, 0x4D, 0x96, 0x30, 0x63, 0x35, 0xB0,
+    0xC9, 0x45, 0x31, 0xD4, 0x4B, 0x96, 0x8C, 0x24, 0xEF, 0xA4, 0xA9, 0xF8, 0x58, 0x0B, 0xBD, 0x55,
+    0x53, 0x8E, 0x5F, 0x86, 0xE5, 0x0C, 0xB3, 0xB3, 0xC4, 0x4A, 0x39, 0x79, 0x02, 0x9C, 0x7F, 0x62,
+    0x2B, 0x28, 0xE4, 0x8D, 0x12, 0xFA, 0x69, 0x57, 0x7B, 0xCC, 0x04, 0xED, 0xEA, 0xD5, 0x76, 0x50,
+    0x0E, 0x70, 0xB4, 0xA2, 0xA6, 0x1B, 0xC8, 0xF5, 0xE3, 0xCE, 0x4A, 0x38, 0x45, 0xEA, 0xA5, 0x59,
+    0x97, 0xCD, 0xD2, 0x4B, 0xCB, 0xE5, 0xC2, 0x7F, 0x89, 0x62, 0xE0, 0xA9, 0x54, 0x0E, 0xEB, 0x59,
+    0xC8, 0xE7, 0x93, 0x1D, 0xD7, 0x28, 0xC3, 0x06, 0x8E, 0xC0, 0x39, 0x38, 0xAA, 0x3A, 0x76, 0x76,
+    0x20, 0x15, 0x81, 0x64, 0xA6, 0x3C, 0x66, 0xC9, 0x4C, 0x2C, 0x26, 0xD0, 0x7E, 0x3B, 0xE0, 0xDE,
+    0x1B, 0xA9, 0xEE, 0x8F, 0x58, 0x0D, 0x14, 0xF2, 0x18, 0xF9, 0x75, 0x47, 0x56, 0x03, 0x5A, 0xA3,
+    0x98, 0x62, 0x86, 0x2B, 0x89, 0x5A, 0x81, 0x5A, 0x9E, 0x7A, 0x81, 0xFA, 0x3A, 0xC0, 0x37, 0x1F,
+    0xA3, 0x4D, 0x2F, 0x8D, 0xF4, 0x92, 0x7C, 0xD5, 0x38, 0x5A, 0xE3, 0x4D, 0x60, 0xFA, 0x27, 0x1C,
+    0xE5, 0xCD, 0xE6, 0x9C, 0xD1, 0xCB, 0x5B, 0xDE, 0x04, 0xD2, 0x11, 0x8E, 0xFA, 0x64, 0xF9, 0xBB,
+    0x87, 0x57, 0x62, 0x2D, 0x49, 0x48, 0xD2, 0xB8, 0x9E, 0x21, 0x3D, 0x23, 0xFD, 0xF6, 0x9C, 0xD1,
+    0x8B, 0x3F, 0xC1, 0xE8, 0x00, 0x35, 0xEC, 0x99, 0x80, 0x63, 0x43, 0x4D, 0x39, 0x54, 0x0D, 0xC9,
+    0x7A, 0xEC, 0x35, 0x4F, 0xAE, 0x01, 0x5C, 0x58, 0xBD, 0x70, 0x21, 0x30, 0x0A, 0x98, 0xB4, 0x90,
+    0x27, 0x3B, 0xE4, 0x73, 0x3E, 0x67, 0x0B, 0xEE, 0x1D, 0xAD, 0xC1, 0x19, 0x75, 0x43, 0x2A, 0x07,
+    0x5C, 0x3E, 0x61, 0xFD, 0x8E, 0x3C, 0x54, 0x0D, 0xDB, 0x62, 0xA0, 0xCE, 0x26, 0x4A, 0x7F, 0xF8,
+    0x59, 0x43, 0x95, 0x4D, 0x14, 0x7E, 0x8F, 0x2C, 0xD8, 0x86, 0x03, 0x73, 0x16, 0x94, 0x27, 0xB7,
+    0xC2, 0x82, 0xF5, 0x4F, 0x6C, 0x55, 0xDF, 0xE7, 0xAF, 0xF8, 0xFB, 0x21, 0xBF, 0xD9, 0x94, 0x5F,
+    0xE3, 0x1B, 0x3F, 0xE0, 0xBF, 0x87, 0xFC, 0x17, 0x8D, 0x7D, 0x99, 0xC3, 0xCD, 0x77, 0xA7, 0x5E,
+    0x43, 0x7B, 0xAD, 0x61, 0x0F, 0x22, 0x66, 0x5C, 0xD9, 0xEE, 0x8B, 0x81, 0xF8, 0xCF, 0x63, 0xF0,
+    0x13, 0xF0, 0xFB, 0x45, 0xDC, 0x5B, 0x8E, 0xD9, 0xE5, 0xD2, 0x1F, 0xD3, 0xB2, 0x2D, 0x47, 0x13,
+    0x4A, 0x7F, 0x8C, 0x63, 0x5B, 0x0E, 0x26, 0x14, 0x7E, 0x87, 0xE3, 0x60, 0x85, 0xDC, 0x1D, 0x9B,
+    0x3F, 0x28, 0x1A, 0xBF, 0x63, 0xC3, 0x85, 0x72, 0x30, 0xA3, 0x19, 0x7A, 0x9D, 0xAD, 0xB8, 0xF5,
+    0xE5, 0x1A, 0x38, 0x27, 0x27, 0xEB, 0x39, 0xB3, 0x7E, 0x6A, 0x0F, 0xE4, 0xD1, 0xCD, 0x50, 0x68,
+    0x80, 0x57, 0x66, 0x56, 0x4B, 0xE5, 0x90, 0xD5, 0xE4, 0x69, 0x75, 0x87, 0xE2, 0xF4, 0xAD, 0xC0,
+    0x86, 0xD2, 0x9B, 0x91, 0x3D, 0x36, 0x98, 0xE1, 0xAC, 0x50, 0x0D, 0xE6, 0xEC, 0xFC, 0x1A, 0xA3,
+    0xB3, 0xA3, 0x82, 0x63, 0xE0, 0xC2, 0x63, 0x71, 0x70, 0xF4, 0xB4, 0x68, 0x75, 0x87, 0x83, 0xF6,
+    0xCD, 0x9E, 0x83, 0x0D, 0xA5, 0x3F, 0xD8, 0x60, 0x86, 0x43, 0x47, 0x3E, 0x1E, 0x3A, 0xCC, 0xB8,
+    0x73, 0x54, 0xC3, 0xCE, 0x49, 0x7E, 0xE7, 0xA4, 0x66, 0xE7, 0x74, 0x87, 0xDD, 0x57, 0xA1, 0xF0,
+    0x70, 0xF0, 0x07, 0x99, 0x16, 0x8E, 0xDF, 0x5C, 0x4A, 0x4F, 0xDC, 0x62, 0x6E, 0x79, 0x2E, 0x6C,
+    0x29, 0x7E, 0xE9, 0xB3, 0xD4, 0x4B, 0x3F, 0x92, 0x42, 0xAF, 0x3B, 0x3C, 0xA3, 0xEB, 0x99, 0xFA,
+    0xA9, 0x6C, 0x8A, 0xE9, 0xAB, 0x98, 0xF0, 0xD9, 0x39, 0xA5, 0x6B, 0xAC, 0x66, 0x9C, 0xA6, 0xD5,
+    0x17, 0xB4, 0x7F, 0x81, 0x89, 0xFF, 0xF3, 0xAD, 0xFE, 0x5D, 0x69, 0x2E, 0xA4, 0x21, 0xEB, 0xEF,
+    0xB0, 0x47, 0x1D, 0x99, 0x8C, 0x66, 0x33, 0x6C, 0xD8, 0xDA, 0x8B, 0x23, 0x6F, 0xEF, 0x59, 0xB2,
+    0x30, 0x1D, 0x60, 0x3E, 0x78, 0x7F, 0xC4, 0x5E, 0xFA, 0x4E, 0xC7, 0x66, 0x6F, 0x0F, 0xDE, 0x56,
+    0xC4, 0xDC, 0xBE, 0x17, 0xB0, 0x97, 0xCA, 0x81, 0xC3, 0x0B, 0x95, 0x2F, 0x42, 0x70, 0xBF, 0xEB,
+    0xAF, 0xFA, 0x5E, 0xC9, 0xD2, 0x6B, 0xB8, 0xC0, 0x95, 0x08, 0x95, 0x82, 0xBD, 0xEC, 0xF2, 0xC1,
+    0x84, 0x0B, 0x38, 0xD3, 0x99, 0x70, 0x01, 0x97, 0x4F, 0x26, 0xAC, 0x1E, 0x24, 0xD8, 0x3B, 0x2E,
+    0x9F, 0x4C, 0xD8, 0xE0, 0xAC, 0x37, 0x0F, 0x22, 0xCE, 0x35, 0xE6, 0xD3, 0x80, 0x5B, 0xD7, 0x4D,
+    0xE1, 0xB7, 0xD4, 0xD9, 0x4F, 0xF8, 0xDE, 0xE3, 0x83, 0xC7, 0xFE, 0x3A, 0xF3, 0xB7, 0x83, 0xED,
+    0xF2, 0x70, 0x80, 0xF9, 0x60, 0xA0, 0xB8, 0x26, 0xA9, 0x95, 0x96, 0x69, 0xF5, 0x34, 0x75, 0xB3,
+    0xC2, 0xB0, 0xBA, 0xEC, 0x9F, 0x25, 0x5D, 0x5C, 0xCF, 0x24, 0x26, 0xFE, 0xE1, 0xB7, 0xFC, 0x1F,
+    0xD5, 0xBC, 0x5F, 0xAC, 0x1F, 0xC7, 0x95, 0xDF, 0xF9, 0xE9, 0x2E, 0x93, 0x6D, 0xB1, 0x65, 0x96,
+    0x80, 0x95, 0x06, 0x8E, 0x28, 0xBB, 0xF3, 0xE0, 0x05, 0x34, 0x1E, 0x99, 0x6D, 0x2C, 0xFC, 0xC0,
+    0x07, 0xF2, 0x76, 0x4B, 0x7A, 0x10, 0xB0, 0x06, 0x62, 0x26, 0x11, 0x85, 0xDD, 0x4C, 0x02, 0x19,
+    0xD9, 0x59, 0x60, 0xC6, 0xC6, 0x82, 0x5E, 0xC0, 0xC0, 0x6A, 0x07, 0x97, 0xEC, 0x96, 0xF5, 0xA0,
+    0x07, 0x2F, 0x76, 0x08, 0x24, 0x0E, 0x76, 0xF7, 0x65, 0x98, 0x40, 0x0E, 0x6C, 0xE6, 0x41, 0x44,
+    0xA2, 0x04, 0x04, 0x72, 0xC9, 0x2E, 0x89, 0xC0, 0x0A, 0x88, 0x80, 0xA8, 0x15, 0x2F, 0x56, 0xC0,
+    0xE4, 0xC1, 0xAD, 0x48, 0x8E, 0x77, 0x6C, 0x2C, 0x58, 0x1E, 0xB7, 0xD7, 0x4D, 0xA9, 0xBA, 0xBF,
+    0xFB, 0x50, 0xFD, 0xFB, 0xDD, 0x2B, 0xFE, 0x91, 0x94, 0xC8, 0x33, 0xA3, 0x69, 0xDC, 0xEE, 0xAA,
+    0x5F, 0xF3, 0xF7, 0x63, 0x57, 0x7D, 0xFB, 0x54, 0xD5, 0x39, 0xDF, 0x73, 0x4E, 0x75, 0xBF, 0xD0,
+    0xAB, 0xB2, 0x53, 0x35, 0x74, 0x35, 0x70, 0xD8, 0x57, 0x4E, 0x69, 0xC8, 0x7D, 0xE9, 0xBA, 0x24,
+    0x64, 0xBE, 0x70, 0x15, 0xC1, 0x78, 0x1B, 0x8B, 0xDC, 0x95, 0xEC, 0x71, 0x99, 0x04, 0xD8, 0x85,
+    0xAC, 0x85, 0x67, 0xB6, 0xC5, 0xD9, 0x40, 0x23, 0x67, 0xF5, 0xBF, 0xA5, 0xE1, 0x0A, 0x55, 0x5E,
+    0x67, 0xFE, 0x25, 0xCE, 0xE7, 0x75, 0xD6, 0xBF, 0xC4, 0xD5, 0xF8, 0xA9, 0xF9, 0x6A, 0x6D, 0xE6,
+    0x91, 0x52, 0x3F, 0x40, 0xF2, 0x46, 0x6A, 0x53, 0xBD, 0x83, 0x05, 0x3C, 0x58, 0x0E, 0x1E, 0x4F,
+    0x42, 0xAA, 0x99, 0x44, 0x0A, 0x34, 0xC3, 0x31, 0x6F, 0x07, 0x3E, 0x4D, 0x00, 0x72, 0x17, 0x9F,
+    0x8D, 0xE9, 0x81, 0x1D, 0x20, 0xF1, 0x80, 0xAD, 0x61, 0xFB, 0xEF, 0x0F, 0xEA, 0xD2, 0x0B, 0x89,
+    0xA4, 0xB6, 0x90, 0x26, 0xD2, 0x09, 0x28, 0x5B, 0x30, 0x13, 0x20, 0xA0, 0xEB, 0xA1, 0x7B, 0x07,
+    0x72, 0x69, 0xB9, 0xD0, 0x49, 0x7A, 0x4D, 0xD2, 0x0C, 0x90, 0x93, 0xF6, 0xE5, 0x8D, 0x9F, 0x8F,
+    0x85, 0xE4, 0xB3, 0xB1, 0x74, 0xB9, 0xCB, 0x9D, 0x75, 0x59, 0x6F, 0x5D, 0x36, 0x58, 0x97, 0xF7,
+    0xF9, 0x58, 0xF6, 0xB9, 0xD4, 0x97, 0xD2, 0xD8, 0x48, 0xA1, 0x3C, 0xF4, 0xE8, 0xF8, 0x69, 0x38,
+    0x7D, 0x3F, 0x24, 0x7F, 0xDB, 0xC3, 0x5C, 0x38, 0xAA, 0xB6, 0x23, 0xF7, 0x26, 0xA4, 0x81, 0xC2,
+    0x77, 0x35, 0xDD, 0x8D, 0x01, 0xA3, 0x00, 0x56, 0x40, 0xD3, 0x83, 0x09, 0x40, 0xA5, 0xD6, 0x48,
+    0x81, 0x4E, 0xFF, 0xD7, 0xE6, 0x8E, 0xDB, 0x54, 0x5E, 0xC6, 0x48, 0x13, 0x9D, 0xE4, 0x62, 0xAB,
+    0xAB, 0x4D, 0xF3, 0xAB, 0x96, 0x47, 0x4E, 0xAE, 0x07, 0x00, 0x27, 0x9E, 0x79, 0xE6, 0x99, 0x67,
+    0xAE, 0x5C, 0x79, 0xE9, 0xA5, 0x97, 0x5E, 0xE2, 0xF0, 0x52, 0x53, 0xCA, 0xB3, 0xCB, 0x2E, 0x9E,
+    0xCF, 0x32, 0x44, 0x64, 0xB9, 0x06, 0x54, 0x37, 0xA1, 0xD3, 0x60, 0xA4, 0x90, 0x8D, 0x5C, 0xCB,
+    0x1D, 0x95, 0x6D, 0xA9, 0xF2, 0x9E, 0x2A, 0xD3, 0x3F, 0x5D, 0x52, 0x69, 0xE6, 0xAC, 0x46, 0x68,
+    0x3C, 0xE4, 0x01, 0x4C, 0x48, 0xC8, 0x83, 0x95, 0x42, 0x29, 0x8D, 0x95, 0xD4, 0x1F, 0xD3, 0x4D,
+    0x00, 0x8A, 0xBA, 0x7C, 0x7C, 0x32, 0x53, 0xE5, 0xAA, 0xEB, 0x21, 0x0B, 0x8D, 0xEB, 0x5C, 0x72,
+    0x8D, 0xA3, 0xC9, 0xF0, 0x85, 0xBD, 0x2F, 0xFC, 0xFD, 0xF6, 0xDE, 0x7F, 0xC0, 0xBD, 0xFF, 0x80,
+    0x7B, 0xFE, 0x3B, 0x77, 0xEF, 0x97, 0x97, 0x87, 0x1E, 0xFE, 0xD4, 0x97, 0xF3, 0x47, 0xFB, 0xE4,
+    0x1A, 0x40, 0xF9, 0x42, 0xFE, 0x74, 0xDB, 0x9F, 0x78, 0xC8, 0x3C, 0xDB, 0x9E, 0x7C, 0xC4, 0xBC,
+    0xFC, 0x93, 0x60, 0xE5, 0xCA, 0xFF, 0xE5, 0xDA, 0xF7, 0xEB, 0x5C, 0x0A, 0xDF, 0x94, 0x1C, 0x5C,
+    0x85, 0xBC, 0x3F, 0x58, 0x24, 0x75, 0x27, 0xBD, 0x26, 0x85, 0x4E, 0xDA, 0x3C, 0x64, 0xFE, 0xCA,
+    0x97, 0x9F, 0xBB, 0xF7, 0xF4, 0xF3, 0xF7, 0x5E, 0x98, 0xEF, 0xF9, 0x9B, 0x7F, 0x72, 0xEF, 0xFF,
+    0x78, 0xFD, 0xDE, 0xDF, 0xBE, 0xFE, 0x6D, 0xFB, 0x9D, 0x21, 0x3E, 0x44, 0xFA, 0xBF, 0x2F, 0x7D,
+    0x1F, 0x80, 0x7C, 0x26, 0x53, 0x60, 0xCE, 0x7C, 0x85, 0x7D, 0x7C, 0x60, 0xEF, 0x3C, 0xF9, 0xAB,
+    0x03, 0x7B, 0x15, 0xF6, 0xFA, 0x9C, 0x4D, 0x56, 0xA2, 0x91, 0x43, 0x03, 0x00, 0x09, 0x30, 0x81,
+    0x6D, 0xD7, 0xE2, 0xF0, 0xA5, 0xE5, 0x52, 0x27, 0x0D, 0xEF, 0xBB, 0x09, 0xBF, 0xB7, 0x11, 0xCF,
+    0x07, 0x2E, 0x75, 0xCF, 0x49, 0xE1, 0x81, 0xD3, 0x40, 0xA2, 0x7B, 0x72, 0xEE, 0xE5, 0xCB, 0xC6,
+    0x7D, 0xC9, 0x0C, 0x3B, 0xA9, 0x7E, 0xAC, 0xBA, 0xEC, 0x79, 0x98, 0x7B, 0x79, 0xD8, 0x0E, 0x3C,
+    0xC3, 0x23, 0x3C, 0x74, 0xDF, 0x6E, 0x37, 0x36, 0x7D, 0x72, 0xE1, 0x64, 0xE6, 0xC6, 0xC2, 0xF8,
+    0xAA, 0xE6, 0xEA, 0xF6, 0x6C, 0xE3, 0xD9, 0xB4, 0xCC, 0x8D, 0x63, 0x79, 0xDF, 0x39, 0x98, 0xA5,
+    0x93, 0x96, 0x4E, 0x5A, 0xFE, 0xB5, 0xA4, 0x7F, 0x25, 0x35, 0x2F, 0x35, 0x53, 0xF3, 0x12, 0x30,
+    0x02, 0x17, 0x01, 0x9E, 0x4C, 0xEA, 0xA6, 0x3F, 0x59, 0xCC, 0xE6, 0xBA, 0xDC, 0xC9, 0x26, 0x98,
+    0xD7, 0xE4, 0x4E, 0x76, 0xC1, 0xBC, 0x29, 0x77, 0xAA, 0x0A, 0xA6, 0x97, 0x3B, 0x65, 0x26, 0xD3,
+    0x57, 0xED, 0x29, 0x33, 0x99, 0xBE, 0xA9, 0x4F, 0xE5, 0xA3, 0xE9, 0x55, 0x9F, 0xB2, 0xA3, 0xE9,
+    0xC5, 0xA9, 0xC2, 0xA7, 0xFF, 0x4E, 0x1C, 0xAF, 0x7C, 0xFA, 0x76, 0x2C, 0x7E, 0x2A, 0x8E, 0x97,
+    0xCF, 0x85, 0xEA, 0xD5, 0xD0, 0xB8, 0xFB, 0x0C, 0x5F, 0xCF, 0x47, 0xFA, 0xCF, 0x7C, 0xF3, 0xF5,
+    0xE1, 0x10, 0x21, 0xB9, 0x9C, 0xBA, 0x9C, 0x47, 0xF0, 0xC6, 0x59, 0xA3, 0xD7, 0x05, 0xB5, 0x59,
+    0x4C, 0xFB, 0x96, 0x7B, 0xE8, 0xB2, 0xF9, 0xBB, 0xC9, 0xF5, 0xEF, 0xF9, 0x6E, 0xCC, 0xC7, 0x15,
+    0xA0, 0xDC, 0xB1, 0x4A, 0x34, 0xFC, 0x17, 0x0E, 0xC0, 0x38, 0x38, 0x89, 0x71, 0xF0, 0x12, 0xC6,
+    0x91, 0x0C, 0x18, 0xB7, 0xFE, 0xE5, 0x2D, 0xC6, 0x61, 0xC1, 0x38, 0xBE, 0x04, 0x99, 0x63, 0x17,
+    0x5E, 0xFC, 0x19, 0x23, 0x48, 0xA9, 0xA7, 0x96, 0x8C, 0x4B, 0x1D, 0xD8, 0x36, 0x73, 0x50, 0x60,
+    0x1D, 0xEC, 0x70, 0xBC, 0x87, 0x3D, 0xFE, 0xE7, 0x1E, 0x46, 0x7E, 0xD1, 0x63, 0xBC, 0x79, 0x63,
+    0x20, 0xEB, 0xF3, 0x67, 0x07, 0x6C, 0x6B, 0xB5, 0x50, 0x62, 0xB5, 0xB0, 0x03, 0xA9, 0x27, 0x40,
+    0xEA, 0x93, 0x11, 0x8C, 0x4F, 0x4E, 0x83, 0xF1, 0xB1, 0x85, 0xD6, 0x03, 0xA4, 0x71, 0x2C, 0xC5,
+    0x99, 0x28, 0x36, 0x11, 0x0F, 0xCF, 0xC0, 0x49, 0x38, 0x09, 0x16, 0x8E, 0xB3, 0xB6, 0x11, 0x4F,
+    0x5E, 0xC3, 0x2E, 0x99, 0x23, 0xED, 0x7E, 0x60, 0xFA, 0x3F, 0x40, 0x4A, 0xFF, 0x4C, 0x53, 0x25,
+    0xE7, 0x5F, 0x28, 0xA2, 0xB0, 0x78, 0xD8, 0x85, 0x93, 0x70, 0x0A, 0x2C, 0x94, 0x90, 0x3B, 0x6C,
+    0x4D, 0xD6, 0x63, 0x1D, 0xD9, 0x40, 0xE6, 0xC8, 0x3D, 0x66, 0xA0, 0xF0, 0xA4, 0x1E, 0xEB, 0x49,
+    0x26, 0x72, 0x05, 0x02, 0x46, 0xE2, 0x2A, 0x74, 0x72, 0x0F, 0x6C, 0x24, 0x19, 0x48, 0xBF, 0xB7,
+    0x17, 0x91, 0xED, 0x01, 0x38, 0x02, 0x27, 0x81, 0x81, 0xBC, 0x86, 0x47, 0xC0, 0x63, 0x54, 0x73,
+    0x12, 0xBE, 0x38, 0x91, 0xB5, 0x90, 0x0E, 0x78, 0xC0, 0xF2, 0x25, 0x00, 0x9F, 0x39, 0xA0, 0x64,
+    0x84, 0x52, 0x7D, 0xC9, 0xA7, 0x8C, 0x26, 0xE3, 0x52, 0x77, 0xEC, 0x4F, 0xB9, 0xC2, 0x2E, 0x1B,
+    0x48, 0xCD, 0x90, 0xFE, 0xBF, 0x6C, 0x30, 0xB5, 0xB5, 0xFD, 0x1C, 0x2B, 0xA8, 0x9C, 0xE3, 0xCA,
+    0xE7, 0x59, 0x51, 0x4D, 0x3D, 0xD2, 0xB0, 0xC2, 0x6A, 0x1D, 0x94, 0x44, 0x5C, 0x79, 0x00, 0xA8,
+    0xC0, 0xCC, 0xEB, 0x19, 0x20, 0x0D, 0x90, 0x4C, 0x07, 0x26, 0xF6, 0xFB, 0xE3, 0x3D, 0x73, 0x87,
+    0xB3, 0x08, 0xD0, 0x8C, 0xA0, 0x1A, 0x13, 0x20, 0xF3, 0x60, 0x7B, 0x28, 0x5C, 0x9C, 0xFF, 0xAA,
+    0x7A, 0xFF, 0x2C, 0x5B, 0x28, 0x7A, 0x3E, 0x6B, 0x27, 0xCE, 0x1B, 0xFD, 0x3C, 0x20, 0x79, 0x8E,
+    0x2D, 0x75, 0x7C, 0xC6, 0x64, 0x5A, 0xB0, 0x57, 0x8E, 0x02, 0x27, 0x9E, 0xF9, 0x0A, 0x24, 0x7D,
+    0xE7, 0x20, 0xAB, 0xAF, 0x71, 0xA7, 0xC3, 0xF6, 0x00, 0x5D, 0x0B, 0x18, 0x01, 0x14, 0x33, 0xC0,
+    0xB5, 0x00, 0x98, 0x5F, 0x7A, 0xA0, 0xF8, 0xEE, 0x40, 0x9C, 0xDB, 0x31, 0x3E, 0x3E, 0xFE, 0x1A,
+    0x30, 0x27, 0x01, 0x32, 0x6F, 0x46, 0x28, 0xDB, 0xDC, 0xC3, 0x4C, 0xE1, 0xC8, 0x3C, 0x55, 0x4B,
+    0xD5, 0xD2, 0xC1, 0x0C, 0x33, 0xB9, 0xA4, 0x40, 0x25, 0xC9, 0x27, 0x92, 0x34, 0x58, 0x49, 0x72,
+    0x95, 0x03, 0x3D, 0xB6, 0x40, 0xBA, 0xD8, 0x11, 0xB2, 0xD0, 0x38, 0xB0, 0xE3, 0x66, 0xE8, 0xBC,
+    0xE1, 0x80, 0xCC, 0xD4, 0xC0, 0xE7, 0x3E, 0x03, 0x50, 0x79, 0x80, 0xE3, 0x7C, 0xC0, 0x11, 0x97,
+    0xB0, 0x69, 0xFB, 0xED, 0x44, 0x3D, 0x90, 0xDF, 0x70, 0x40, 0x55, 0x01, 0xC9, 0x74, 0x0D, 0xB0,
+    0x6F, 0x04, 0xA0, 0x32, 0x23, 0xA4, 0x53, 0x3E, 0x80, 0xED, 0x0B, 0x07, 0x0D, 0x55, 0x4D, 0x3A,
+    0xD1, 0x81, 0xED, 0x93, 0x00, 0x0D, 0x66, 0xC2, 0x4C, 0xE4, 0x1E, 0xDB, 0x63, 0x7B, 0x3A, 0x49,
+    0xCE, 0x48, 0x12, 0x85, 0xA4, 0x05, 0x49, 0x0A, 0x26, 0x80, 0x1D, 0xCB, 0x01, 0xCA, 0x41, 0x35,
+    0x34, 0xAF, 0x06, 0x40, 0xEB, 0xBB, 0x48, 0x9E, 0x04, 0x4A, 0x49, 0x71, 0xCD, 0x8B, 0x65, 0x27,
+    0x69, 0x84, 0x44, 0xF1, 0x5B, 0xE6, 0xBD, 0x05, 0x80, 0xEC, 0x97, 0xB1, 0xB4, 0xD7, 0x63, 0x59,
+    0x3C, 0x17, 0xCB, 0x2A, 0x8D, 0xE5, 0xB5, 0x44, 0x67, 0xBE, 0x01, 0x04, 0x24, 0x41, 0x3A, 0xC5,
+    0xD2, 0x78, 0xA4, 0x05, 0xF2, 0x21, 0x3E, 0xB5, 0x70, 0x88, 0xB8, 0x56, 0xAA, 0x06, 0x9A, 0x9F,
+    0x5D, 0x52, 0x0B, 0x48, 0x92, 0x83, 0x64, 0x2D, 0x8D, 0x24, 0x49, 0x21, 0x9F, 0x40, 0x52, 0xB0,
+    0x3E, 0x96, 0xE5, 0x00, 0x92, 0xE6, 0xCA, 0x81, 0xA4, 0x65, 0x0B, 0x6F, 0xA3, 0x3F, 0x25, 0xFE,
+    0xBC, 0x85, 0x4C, 0xD2, 0x00, 0x45, 0x2C, 0x1A, 0x0E, 0x6B, 0x20, 0x09, 0xD0, 0xF5, 0x64, 0x1E,
+    0x1A, 0x47, 0xE1, 0xA0, 0x6B, 0x69, 0x00, 0x91, 0x04, 0x30, 0x33, 0x99, 0x87, 0x7C, 0x2A, 0xA5,
+    0x91, 0xC2, 0x77, 0x52, 0x4F, 0xF5, 0x8A, 0xA4, 0x1A, 0x91, 0x79, 0x30, 0x81, 0xC2, 0x41, 0xE1,
+    0xE3, 0xAF, 0x5C, 0x12, 0xA0, 0x10, 0xD9, 0xAF, 0xCE, 0x7C, 0x53, 0x13, 0x45, 0x6C, 0x78, 0x23,
+    0x69, 0x89, 0xBD, 0x18, 0xC8, 0x62, 0x0B, 0x8B, 0xD8, 0xA8, 0x46, 0xCB, 0x05, 0x80, 0xBD, 0xD4,
+    0x41, 0xBE, 0x97, 0x03, 0x51, 0x4F, 0x18, 0x9A, 0x01, 0x4C, 0xDB, 0xDC, 0x22, 0x30, 0x67, 0x97,
+    0x1A, 0x0A, 0x69, 0x20, 0xD5, 0x7B, 0x1A, 0xA9, 0x26, 0x9A, 0x31, 0x55, 0x4D, 0xE5, 0xED, 0x08,
+    0xD5, 0xD0, 0xB5, 0xD0, 0x5C, 0x0F, 0x80, 0xBE, 0xE6, 0x21, 0x99, 0x9B, 0x1A, 0xCC, 0xCD, 0x00,
+    0xD8, 0x9F, 0x7A, 0xA0, 0xFC, 0xB1, 0x03, 0xBA, 0x06, 0x48, 0xD7, 0xDB, 0x23, 0x50, 0xFD, 0x91,
+    0x87, 0x74, 0xAE, 0x3C, 0x94, 0xBE, 0x9B, 0xEB, 0xDF, 0x95, 0x93, 0xA4, 0x25, 0x95, 0xA2, 0xE6,
+    0x27, 0xB5, 0x46, 0xD2, 0x44, 0x2A, 0xA9, 0x86, 0xB3, 0xBA, 0xB0, 0xB6, 0xA9, 0xA8, 0xF7, 0xD2,
+    0xE9, 0x2A, 0xE5, 0x4C, 0x3A, 0x83, 0x1C, 0x0A, 0x2C, 0x65, 0xAF, 0x74, 0xDE, 0xB4, 0xFA, 0xC1,
+    0x4D, 0x25, 0xAC, 0xA5, 0xD9, 0xAC, 0x3A, 0x99, 0x7F, 0xDF, 0x98, 0x5E, 0xF5, 0xBE, 0xF8, 0xF2,
+    0x36, 0x3F, 0xDA, 0xBC, 0xCF, 0xF4, 0xB6, 0x5F, 0xDB, 0x61, 0xD3, 0x04, 0xB7, 0x56, 0xAA, 0x16,
+    0xE0, 0xB0, 0x6E, 0x76, 0xAB, 0x00, 0x44, 0x2D, 0x31, 0xD5, 0xBB, 0x0A, 0x00, 0xF9, 0x42, 0xB1,
+    0x00, 0x14, 0x13, 0x56, 0x35, 0x50, 0x0D, 0x54, 0x72, 0x71, 0xE9, 0x6B, 0x9A, 0x3E, 0x4E, 0x2C,
+    0x2A, 0x07, 0x40, 0x98, 0x60, 0x3D, 0xB0, 0x90, 0x4D, 0xD6, 0x03, 0x33, 0xD6, 0xE7, 0xB1, 0x52,
+    0xF6, 0x59, 0xAC, 0x34, 0xED, 0x5A, 0x89, 0x12, 0xC1, 0x9C, 0x2E, 0xE4, 0x1E, 0x90, 0x09, 0x71,
+    0xB5, 0xD2, 0xD7, 0x46, 0x8A, 0x01, 0xE8, 0x6E, 0x0C, 0x34, 0x3D, 0xD0, 0xA8, 0xFF, 0xDD, 0xF8,
+    0xD0, 0x55, 0xB4, 0xA3, 0xA8, 0xD4, 0x40, 0x2E, 0x49, 0xAC, 0x95, 0x00, 0x60, 0xA3, 0xC4, 0x42,
+    0xF5, 0x1F, 0x57, 0x7D, 0xAE, 0xD9, 0x74, 0x77, 0x33, 0x66, 0xD3, 0x0D, 0x46, 0xD9, 0x06, 0x23,
+    0xBB, 0x99, 0xC2, 0xCB, 0x0D, 0xC2, 0xD5, 0x06, 0x61, 0xAD, 0xBF, 0x4E, 0xB4, 0xC1, 0x73, 0xF3,
+    0xEB, 0x7C, 0xF3, 0xEB, 0x62, 0xF3, 0x6E, 0x4F, 0xDC, 0x61, 0xD2, 0x4A, 0x2E, 0xB0, 0xAA, 0xA9,
+    0x5C, 0x01, 0x38, 0x05, 0x50, 0x42, 0xD4, 0xB8, 0x3E, 0xF2, 0x61, 0x46, 0xC8, 0xBC, 0xC0, 0x4C,
+    0x45, 0x4F, 0x12, 0x4C, 0x00, 0xD1, 0xB4, 0x74, 0xB5, 0xF5, 0x54, 0x2E, 0x59, 0x28, 0x7B, 0xAA,
+    0xBE, 0xF0, 0x64, 0xC1, 0x8E, 0xA0, 0x27, 0x02, 0x14, 0xBF, 0x9C, 0xC1, 0x48, 0x40, 0xA7, 0x1A,
+    0xAC, 0x1C, 0xA4, 0xEA, 0x37, 0x33, 0xA8, 0x9D, 0xB6, 0x1D, 0x52, 0x0B, 0x34, 0x03, 0x50, 0x4E,
+    0xF1, 0xD5, 0x83, 0x89, 0xF3, 0xCA, 0x00, 0x34, 0x13, 0x9C, 0x83, 0xAC, 0x8F, 0xC5, 0x4F, 0xA0,
+    0x59, 0xC8, 0xB4, 0x70, 0x3E, 0x9F, 0xB3, 0x3E, 0x1F, 0xCF, 0x51, 0xBC, 0xDA, 0xB3, 0x73, 0x8E,
+    0xF4, 0xA7, 0x3D, 0x3B, 0xE7, 0xB0, 0x6F, 0xF6, 0xD9, 0x74, 0x3E, 0x53, 0x26, 0xB5, 0x8D, 0xDA,
+    0x6C, 0xA9, 0x0F, 0xFE, 0x3C, 0x16, 0xF0, 0x5B, 0xA7, 0x49, 0x34, 0x93, 0x0D, 0x45, 0x6D, 0x5B,
+    0xE3, 0x4A, 0x92, 0xBE, 0x84, 0x61, 0x87, 0x62, 0xD8, 0xE1, 0x2A, 0x3B, 0x78, 0x76, 0x92, 0x9E,
+    0x9D, 0xA4, 0xA7, 0x4A, 0x3C, 0x15, 0x81, 0x8A, 0xA6, 0xAD, 0x28, 0x7D, 0x83, 0x09, 0x0D, 0x5C,
+    0x6D, 0x60, 0xA7, 0x81, 0x73, 0xCD, 0xF1, 0xA7, 0xE6, 0xAE, 0x54, 0xE8, 0x4A, 0xF9, 0x2E, 0x5F,
+    0x6A, 0xEE, 0x07, 0xCA, 0xFE, 0x04, 0xF6, 0x91, 0xCF, 0x90, 0x3D, 0xFE, 0x6A, 0x9D, 0xF4, 0x8D,
+    0xE3, 0xDB, 0xE9, 0x0A, 0x7A, 0xF9, 0x96, 0xA7, 0xD1, 0x1E, 0xCD, 0x3F, 0x13, 0x15, 0xA5, 0x2B,
+    0x31, 0xDE, 0xB6, 0x5C, 0x35, 0x8E, 0xF2, 0x51, 0x4F, 0x36, 0xEC, 0x92, 0x4E, 0x25, 0x28, 0xEB,
+    0xE9, 0x9C, 0xFE, 0x91, 0x7C, 0x25, 0x85, 0x4C, 0x12, 0x8D, 0xDE, 0xEC, 0x53, 0x3D, 0x3B, 0x92,
+    0x0E, 0x60, 0x9E, 0x07, 0x5C, 0x0F, 0xDF, 0x3A, 0x01, 0x9F, 0xF9, 0x0C, 0xA4, 0xBA, 0x65, 0x19,
+    0x4B, 0x97, 0x82, 0x4C, 0xEF, 0xB9, 0xEC, 0xDD, 0xCE, 0x1B, 0x9F, 0x86, 0xD4, 0x53, 0x31, 0x91,
+    0xF7, 0x27, 0x49, 0xC7, 0x02, 0xCE, 0x67, 0x8E, 0xF2, 0x3B, 0x1E, 0xEB, 0xCF, 0x91, 0x07, 0x7B,
+    0xF3, 0xAC, 0x8C, 0x24, 0xD7, 0x48, 0x3E, 0xD3, 0x7C, 0x8E, 0x72, 0x2A, 0x6A, 0x80, 0xEC, 0x26,
+    0xA4, 0x4B, 0x51, 0x68, 0x20, 0xD3, 0x7B, 0x37, 0xFA, 0x92, 0xEC, 0xDD, 0x4E, 0x75, 0x32, 0x18,
+    0x9F, 0xAA, 0xE5, 0x54, 0xEA, 0xA9, 0xDC, 0xA1, 0xB3, 0xED, 0x44, 0x2E, 0xC9, 0x9F, 0x24, 0x95,
+    0xF4, 0xFF, 0x14, 0xD0, 0x9C, 0x86, 0xCC, 0x51, 0x3A, 0x56, 0x55, 0x0C, 0xCE, 0x91, 0x0B, 0xB0,
+    0x37, 0xCF, 0xEA, 0x26, 0xF7, 0xAC, 0x2B, 0x45, 0xDD, 0x48, 0x92, 0xFA, 0x4C, 0x73, 0x23, 0x8D,
+    0x94, 0x53, 0xF1, 0x5F, 0xEB, 0x02, 0x90, 0x5F, 0xD8, 0x1F, 0x08, 0xD7, 0x00, 0x52, 0x1F, 0x97,
+    0x1B, 0x87, 0x95, 0xC2, 0x5A, 0x25, 0x1D, 0xD6, 0x15, 0xDC, 0xCA, 0xF4, 0xE4, 0x0A, 0xA7, 0x48,
+    0x96, 0xF4, 0x97, 0x8E, 0xAA, 0xCE, 0xF7, 0xC8, 0x06, 0x2A, 0xC7, 0x39, 0xD2, 0x89, 0xBC, 0xA7,
+    0xA8, 0xB9, 0x4A, 0xE2, 0xC9, 0x3D, 0x15, 0x54, 0x6D, 0xDE, 0x93, 0x2A, 0x1A, 0x91, 0xAA, 0xA1,
+    0x8A, 0x32, 0x37, 0x00, 0x5C, 0x4D, 0x5C, 0xF2, 0xDE, 0xA3, 0xCE, 0x5C, 0x7F, 0xC5, 0x19, 0xA7,
+    0xD6, 0xB8, 0xEA, 0xCE, 0x23, 0xA4, 0xBC, 0x49, 0x2A, 0xB5, 0xF9, 0xD2, 0xF9, 0xC2, 0xA5, 0x63,
+    0x05, 0x61, 0x07, 0xCE, 0x9D, 0x83, 0xF3, 0x57, 0x61, 0xE7, 0x2A, 0x9C, 0x3F, 0x0F, 0xE7, 0x2B,
+    0x98, 0xAB, 0x9F, 0xFC, 0x6E, 0xB0, 0xD2, 0x98, 0x4B, 0x43, 0x22, 0xB5, 0x94, 0xD3, 0xDA, 0xA9,
+    0xAA, 0x86, 0x6C, 0x5A, 0xF5, 0x25, 0x1B, 0x6E, 0x1F, 0xCD, 0x67, 0x1E, 0x93, 0x34, 0x57, 0x9B,
+    0x49, 0x66, 0x7D, 0xF4, 0x66, 0x9A, 0x6D, 0xDA, 0x55, 0x41, 0x89, 0x60, 0x25, 0x75, 0xB4, 0x0B,
+    0x12, 0xBF, 0x8E, 0xFE, 0x53, 0x40, 0xB1, 0x9A, 0x0F, 0x66, 0x58, 0xCD, 0x9C, 0xBD, 0xD5, 0xD0,
+    0xB7, 0x35, 0x64, 0xF1, 0x25, 0xD1, 0x4D, 0xA4, 0x52, 0x9B, 0xAA, 0x0B, 0x49, 0xB0, 0x37, 0xDA,
+    0x90, 0xFD, 0xC8, 0xEF, 0xA4, 0xFE, 0x5C, 0x51, 0x87, 0xE2, 0xBB, 0xFD, 0x8E, 0x79, 0x6B, 0x2C,
+    0x93, 0xE9, 0xBC, 0x75, 0xE7, 0xED, 0xF5, 0xA1, 0x7A, 0x5C, 0x37, 0x3B, 0xD7, 0x48, 0x7D, 0x2E,
+    0x0D, 0x74, 0x1A, 0xB0, 0x6A, 0x31, 0x7E, 0x55, 0x4D, 0xAF, 0x46, 0xB5, 0x15, 0xEB, 0x20, 0x1F,
+    0xD6, 0x96, 0x06, 0xE0, 0xFC, 0xDA, 0x61, 0xEB, 0x20, 0x1B, 0x20, 0xED, 0x01, 0xB7, 0xDF, 0xAD,
+    0x2F, 0x11, 0xB5, 0xF0, 0x2B, 0xB1, 0xA1, 0xA9, 0x87, 0xF4, 0xE2, 0x47, 0x9A, 0xAD, 0xCE, 0x47,
+    0x85, 0xEC, 0x7C, 0xD1, 0x72, 0xD5, 0xF6, 0x84, 0xCC, 0x13, 0xCC, 0x98, 0x4E, 0x49, 0x30, 0x23,
+    0x8B, 0xF1, 0x34, 0x4F, 0x78, 0xAA, 0xD7, 0x07, 0x8A, 0x1B, 0x03, 0x56, 0x3D, 0x99, 0x1C, 0x46,
+    0x8E, 0x44, 0x6D, 0x9C, 0xA7, 0x15, 0x67, 0xDC, 0x6C, 0x86, 0xB3, 0x81, 0x52, 0x9E, 0x52, 0x8E,
+    0x72, 0x81, 0xF2, 0xC2, 0x06, 0xF3, 0xDC, 0x91, 0x7A, 0xD8, 0x8B, 0x1F, 0x96, 0x3A, 0xD5, 0xCC,
+    0x5E, 0x39, 0x94, 0x5C, 0xCB, 0x5D, 0xFE, 0x86, 0xE7, 0xCA, 0x2E, 0xB6, 0xC0, 0xBC, 0xEA, 0x92,
+    0x5F, 0x78, 0xAE, 0xEC, 0x72, 0xAE, 0xA0, 0xCA, 0x5C, 0xF5, 0xE8, 0xD8, 0xB5, 0x8D, 0xEA, 0x62,
+    0x21, 0x1B, 0x48, 0x46, 0x38, 0x07, 0x45, 0x8D, 0xE9, 0x61, 0x5C, 0xE7, 0x67, 0x48, 0xC7, 0x74,
+    0x34, 0x93, 0x19, 0xCD, 0x94, 0x4D, 0x59, 0xC8, 0x43, 0x1E, 0xF2, 0xF0, 0x97, 0xD8, 0xDB, 0x43,
+    0x35, 0x54, 0x52, 0x4B, 0x7A, 0x50, 0x63, 0xBB, 0xE3, 0x2A, 0x01, 0xE5, 0xB0, 0x1D, 0xAF, 0x99,
+    0x6A, 0xA0, 0xEC, 0x00, 0x42, 0x00, 0xB2, 0xFF, 0x30, 0x01, 0xD5, 0x13, 0x1E, 0x08, 0xB6, 0x87,
+    0x7C, 0x28, 0x5B, 0xA8, 0xEA, 0x06, 0x92, 0xC0, 0x0C, 0xF9, 0x90, 0x06, 0xA8, 0xEA, 0xCC, 0x93,
+    0x04, 0xEC, 0x80, 0x1D, 0x28, 0x1D, 0x55, 0x4D, 0x55, 0xA7, 0x92, 0x84, 0x95, 0x14, 0x68, 0x24,
+    0x4D, 0x46, 0x92, 0xBC, 0xF5, 0x50, 0xF5, 0x5D, 0x0B, 0xDD, 0x73, 0x33, 0x24, 0x2A, 0x7C, 0x34,
+    0x91, 0xB8, 0x8F, 0x17, 0xB5, 0xD0, 0x49, 0xEE, 0x81, 0xFA, 0x60, 0x43, 0xBB, 0xE7, 0x5D, 0xA2,
+    0xC5, 0x27, 0xCB, 0x8B, 0x81, 0x40, 0xC7, 0x1E, 0xD6, 0xED, 0x90, 0x8E, 0x16, 0xAE, 0x66, 0x8E,
+    0xE2, 0x59, 0x4F, 0x3E, 0xEC, 0x61, 0x42, 0x51, 0xA7, 0x32, 0x4B, 0xD4, 0xAF, 0x7C, 0x21, 0x85,
+    0x44, 0x7A, 0xBA, 0xCE, 0x97, 0xAC, 0xE7, 0x08, 0x49, 0x0B, 0x27, 0xB1, 0xB0, 0x9A, 0x79, 0xAB,
+    0xFE, 0x3B, 0x6F, 0x0D, 0x9E, 0x0F, 0x5D, 0x52, 0x3F, 0x39, 0x60, 0x19, 0xC7, 0x65, 0x3C, 0x27,
+    0x29, 0x39, 0x1E, 0x97, 0xEC, 0x46, 0x90, 0xFC, 0xF0, 0x96, 0x46, 0xFF, 0x66, 0x56, 0x93, 0x4F,
+    0x9A, 0x4D, 0x08, 0xCF, 0x40, 0x64, 0x5A, 0x37, 0x5A, 0xD4, 0xC0, 0xB6, 0x71, 0x49, 0xF8, 0x8D,
+    0x02, 0x50, 0xD5, 0x71, 0x5A, 0x7B, 0x08, 0xC8, 0x6B, 0x48, 0x54, 0xC7, 0x89, 0x11, 0xCF, 0xBA,
+    0x8A, 0x99, 0x7E, 0xC3, 0xF1, 0xD8, 0x16, 0x78, 0xB0, 0xFE, 0x68, 0x4A, 0x5A, 0xD2, 0xDD, 0x84,
+    0xB3, 0x5A, 0x48, 0xA5, 0x19, 0xAB, 0x33, 0xBF, 0x4F, 0x35, 0xAE, 0xD2, 0x95, 0x88, 0x95, 0xFE,
+    0xCC, 0x26, 0x88, 0x3A, 0xAF, 0xF5, 0x1B, 0xB5, 0xBC, 0xD8, 0xBF, 0x78, 0xA0, 0x18, 0x89, 0x7C,
+    0x01, 0x56, 0x2D, 0x87, 0xAC, 0xDE, 0x7D, 0xEA, 0x5A, 0x2E, 0x69, 0x31, 0x92, 0x96, 0x44, 0x8A,
+    0x83, 0x6A, 0xA1, 0x54, 0x7C, 0xDA, 0x0B, 0x6B, 0x0B, 0x2E, 0x42, 0x11, 0x9B, 0xBF, 0x0B, 0xD6,
+    0x91, 0x8C, 0x77, 0x68, 0x66, 0x26, 0x67, 0x14, 0xD0, 0x3F, 0x6D, 0x4B, 0x87, 0x19, 0xA1, 0x89,
+    0xF3, 0xFF, 0x4A, 0x4C, 0x9E, 0x87, 0x6C, 0x84, 0xAA, 0x27, 0xD5, 0xF7, 0x5A, 0x2B, 0x51, 0x69,
+    0xA2, 0x5C, 0xD9, 0x87, 0x43, 0xD1, 0x88, 0xD9, 0xB0, 0x5F, 0xEF, 0x79, 0x30, 0xFD, 0x2E, 0x1C,
+    0xBD, 0x85, 0xE1, 0xFE, 0xA4, 0x41, 0x63, 0x21, 0x9D, 0xA0, 0xE9, 0x29, 0x9E, 0xAE, 0xB3, 0xF6,
+    0x4B, 0x49, 0xCF, 0xB7, 0xB7, 0x96, 0x6F, 0xA0, 0x92, 0xB3, 0xEF, 0xFE, 0x7E, 0x1C, 0xCC, 0x64,
+    0x1E, 0xCE, 0x6F, 0x59, 0xDA, 0x6C, 0x80, 0xA6, 0xC6, 0xCC, 0x50, 0xDE, 0xFC, 0x6F, 0x0E, 0x52,
+    0xFB, 0xFB, 0xD6, 0x54, 0xE9, 0x36, 0x80, 0x54, 0xFD, 0x41, 0xEB, 0xE1, 0x93, 0x0C, 0x48, 0x4B,
+    0x1A, 0xA0, 0x74, 0x98, 0xF9, 0x0E, 0x2D, 0xFE, 0x38, 0x42, 0xF2, 0x69, 0x92, 0x9A, 0xBC, 0x2E,
+    0x20, 0x1D, 0xF6, 0x80, 0xCE, 0x6F, 0x20, 0xB2, 0x7F, 0x45, 0x46, 0xD2, 0x51, 0xB2, 0xFA, 0x64,
+    0xDA, 0xF3, 0xAB, 0x11, 0x33, 0x43, 0xD1, 0xAE, 0x6C, 0xF4, 0xC1, 0xE3, 0x63, 0x49, 0x0D, 0x40,
+    0xDA, 0x27, 0x03, 0xA4, 0xC3, 0x71, 0x20, 0xFD, 0xF5, 0xB0, 0xB5, 0x4C, 0x4D, 0x24, 0x6D, 0xEF,
+    0x8E, 0x4E, 0xA1, 0x77, 0x6B, 0x68, 0xA4, 0x81, 0x44, 0xD2, 0x44, 0x26, 0x69, 0xA2, 0x70, 0x49,
+    0x37, 0xD1, 0x40, 0x39, 0x26, 0x01, 0x4A, 0x9F, 0x79, 0x28, 0x87, 0xC2, 0x41, 0xE5, 0x1A, 0x40,
+    0x8F, 0x06, 0x48, 0x97, 0xCC, 0x43, 0x16, 0x0A, 0x07, 0xD6, 0x37, 0x40, 0xF5, 0x72, 0x00, 0xB4,
+    0x7F, 0xBB, 0xF2, 0x0D, 0x64, 0x7A, 0x79, 0x3E, 0xF3, 0x94, 0x96, 0x4C, 0xEB, 0xD2, 0x2B, 0xB5,
+    0x8D, 0xA4, 0x29, 0x91, 0xA4, 0x36, 0x12, 0x44, 0xC5, 0x06, 0xB0, 0x72, 0x6B, 0x17, 0x50, 0xA6,
+    0x1E, 0x52, 0x7F, 0x1C, 0x28, 0xCD, 0x00, 0xC6, 0xEF, 0x00, 0xD5, 0xA6, 0x5A, 0x8C, 0x15, 0x58,
+    0xBD, 0xED, 0x31, 0xD2, 0x35, 0xB8, 0xF6, 0xA8, 0x06, 0x6C, 0x6B, 0x16, 0x8C, 0xA7, 0x1C, 0xD8,
+    0x21, 0x59, 0xC8, 0x7A, 0x8A, 0x81, 0x73, 0x30, 0x93, 0xF5, 0x14, 0x3D, 0x0D, 0xE9, 0x4C, 0x36,
+    0xD1, 0xF5, 0x54, 0x1B, 0x7E, 0x68, 0x20, 0x97, 0x16, 0x28, 0xF5, 0xCB, 0x01, 0xCA, 0x69, 0xE7,
+    0xAF, 0x1E, 0x93, 0x15, 0x71, 0xCB, 0xDD, 0x16, 0xBC, 0xBD, 0x8D, 0x65, 0x55, 0x49, 0x7E, 0x35,
+    0xAF, 0x08, 0x44, 0xD4, 0x2A, 0xFD, 0x91, 0xA3, 0xD2, 0x7B, 0x03, 0xE5, 0x85, 0x66, 0x8A, 0xA0,
+    0x59, 0x47, 0xD7, 0x9A, 0x81, 0x62, 0x48, 0x46, 0xB2, 0x29, 0x62, 0x56, 0xD4, 0x34, 0x75, 0xE6,
+    0x29, 0xFB, 0x64, 0xA1, 0x1C, 0x23, 0x64, 0x99, 0xA4, 0x96, 0x2E, 0xE2, 0x16, 0xA6, 0xF7, 0x21,
+    0x16, 0x35, 0x35, 0xD1, 0x48, 0xEE, 0xD0, 0xE9, 0xDB, 0x04, 0xEE, 0xD0, 0x93, 0xA5, 0xB4, 0xE4,
+    0x92, 0x9E, 0x93, 0xD4, 0x2E, 0x2B, 0x4D, 0x6D, 0xFB, 0x55, 0x8B, 0x9A, 0x37, 0x96, 0xC4, 0x4F,
+    0xFE, 0xCE, 0x05, 0x23, 0x8D, 0x48, 0x33, 0x95, 0x54, 0xDB, 0xE1, 0x96, 0x6F, 0x14, 0x7D, 0x9C,
+    0x38, 0x12, 0x45, 0x17, 0xE3, 0x52, 0x48, 0x7A, 0x55, 0xD2, 0x2F, 0xA2, 0x8F, 0xF2, 0xD0, 0xE9,
+    0x4C, 0xF2, 0x56, 0x1A, 0xEF, 0x2A, 0xFD, 0xC7, 0x26, 0x90, 0x6A, 0x33, 0x99, 0xDE, 0x3A, 0x7C,
+    0x01, 0xBB, 0x3B, 0x3C, 0xB5, 0x57, 0x49, 0x73, 0x23, 0xFD, 0xE9, 0xD5, 0x3A, 0x92, 0x0B, 0xE7,
+    0x57, 0x82, 0xAB, 0x1A, 0xF9, 0xAC, 0x8D, 0xB6, 0x7B, 0x48, 0xA4, 0xC0, 0xB1, 0xA5, 0x35, 0x8E,
+    0x6F, 0xF3, 0x12, 0x8F, 0x50, 0xD4, 0x25, 0x46, 0xAA, 0xA9, 0x54, 0xDF, 0xAE, 0x6C, 0xAD, 0xCE,
+    0xB0, 0xD3, 0x9D, 0x34, 0x95, 0xD2, 0x62, 0xA5, 0xC5, 0xDC, 0x3C, 0xD8, 0xDF, 0xF7, 0x01, 0xF0,
+    0xBD, 0x6F, 0xD4, 0x56, 0xEA, 0xF7, 0x01, 0x68, 0x6F, 0xF9, 0x46, 0xB3, 0x01, 0x40, 0xD2, 0x1B,
+    0x92, 0xA6, 0x46, 0xD2, 0x06, 0x80, 0xF1, 0x70, 0xCD, 0xC5, 0xAC, 0x65, 0x30, 0xBD, 0xE9, 0x53,
+    0xC9, 0xD1, 0x09, 0x8E, 0x8D, 0x1F, 0x3C, 0x51, 0xFE, 0x06, 0xC0, 0x88, 0x1E, 0xE4, 0x65, 0x5D,
+    0xC0, 0x0A, 0x7F, 0x80, 0x17, 0x7B, 0xFF, 0x71, 0xE6, 0x31, 0x49, 0x43, 0x27, 0x4D, 0x95, 0x34,
+    0xD9, 0x77, 0x6E, 0x7D, 0xF9, 0x9B, 0xAE, 0x2E, 0x67, 0x7E, 0x18, 0x5F, 0xFE, 0x06, 0x8C, 0xE5,
+    0x96, 0x6F, 0x24, 0x5B, 0x30, 0x24, 0x3D, 0x21, 0xE9, 0x2D, 0x49, 0x61, 0x03, 0x46, 0x1C, 0x97,
+    0xB9, 0x8F, 0xB3, 0xBA, 0x1D, 0x37, 0x2A, 0xE2, 0x9F, 0x1F, 0x00, 0x24, 0x67, 0x72, 0x49, 0xDF,
+    0x91, 0x34, 0x48, 0x1A, 0xAA, 0x0B, 0x77, 0x92, 0xED, 0x1E, 0xCC, 0xCD, 0xA7, 0x5E, 0xD8, 0x97,
+    0x6D, 0xA9, 0x37, 0xD3, 0x2D, 0xDF, 0xC8, 0xB6, 0xDD, 0x93, 0xE6, 0x42, 0xD2, 0xF3, 0xAB, 0x6C,
+    0x87, 0x46, 0x52, 0xCD, 0xB0, 0xAA, 0xB6, 0x27, 0x58, 0xF9, 0x85, 0xE6, 0xA3, 0xF5, 0xE3, 0xDC,
+    0x2D, 0xFD, 0x28, 0x0F, 0xF4, 0x03, 0x29, 0x70, 0x4C, 0x17, 0x60, 0x00, 0xD3, 0x46, 0x47, 0xDF,
+    0xE7, 0xD6, 0xD3, 0x4E, 0x90, 0x5C, 0x21, 0xED, 0xB9, 0xCC, 0x71, 0x3C, 0xE9, 0x9F, 0xF9, 0x48,
+    0x73, 0xA6, 0x23, 0xF0, 0xF0, 0x5F, 0xAA, 0xC4, 0x47, 0xBF, 0x69, 0xDA, 0x33, 0xDA, 0x9A, 0x9D,
+    0xAB, 0xF1, 0x45, 0x9B, 0x21, 0x12, 0x27, 0x7F, 0xAE, 0x2F, 0x7C, 0x55, 0x81, 0x6A, 0x80, 0x2E,
+    0xF2, 0xC7, 0x00, 0x57, 0x4A, 0x20, 0xAF, 0x2D, 0x70, 0x5F, 0xD4, 0x74, 0xF7, 0x8F, 0xC3, 0x9D,
+    0x7A, 0xD2, 0x75, 0x62, 0xFF, 0x59, 0x57, 0x47, 0x6B, 0xB1, 0xF2, 0xAC, 0x9C, 0xDF, 0x4A, 0x22,
+    0x57, 0x6E, 0x4B, 0x16, 0xC7, 0x61, 0x54, 0x0C, 0xAC, 0xCC, 0x10, 0xC9, 0x02, 0xDF, 0x23, 0x9B,
+    0x48, 0xB5, 0x3C, 0xED, 0xC9, 0xB4, 0x54, 0x0E, 0xCE, 0x06, 0xD5, 0x50, 0xFD, 0x6D, 0x01, 0x21,
+    0x5F, 0x20, 0xF3, 0x85, 0xBE, 0xFF, 0x54, 0xE7, 0x2A, 0x45, 0xBA, 0x71, 0x63, 0x40, 0x7A, 0x1A,
+    0x69, 0x81, 0xC3, 0xDA, 0x78, 0x02, 0x8D, 0x8B, 0x5A, 0x4F, 0x35, 0xC1, 0xB4, 0x83, 0x71, 0x59,
+    0x7B, 0x08, 0xF6, 0x2D, 0xDF, 0xE6, 0xC2, 0xEF, 0x1B, 0x4D, 0xC1, 0x4A, 0xA1, 0x68, 0x9B, 0xB0,
+    0x43, 0x11, 0x4E, 0x91, 0x87, 0x5D, 0xB2, 0x69, 0x17, 0xB3, 0x9E, 0xD9, 0x74, 0x0A, 0x3B, 0x55,
+    0x3F, 0xD3, 0x54, 0x48, 0xA3, 0x95, 0x46, 0xA3, 0x77, 0x47, 0x9A, 0x1F, 0xF9, 0xE8, 0x71, 0x28,
+    0xFC, 0x51, 0xBA, 0xA1, 0x90, 0x5C, 0x29, 0xD5, 0xA5, 0x16, 0xD2, 0x6E, 0x80, 0xC3, 0x35, 0x17,
+    0xE1, 0x28, 0xC6, 0xC1, 0x29, 0x8E, 0x03, 0x8D, 0x3C, 0xD0, 0x09, 0xE0, 0xEC, 0x87, 0x6A, 0xC0,
+    0xDF, 0xD4, 0x0C, 0xA5, 0x14, 0xC8, 0xB4, 0xFC, 0xB3, 0x91, 0x66, 0xDC, 0x1A, 0x7C, 0x91, 0x85,
+    0x57, 0xBB, 0xD1, 0xF3, 0xA2, 0x2A, 0x17, 0x89, 0xFC, 0x64, 0x61, 0xA3, 0xF9, 0x51, 0x0C, 0xDC,
+    0x73, 0x9A, 0xA6, 0xA5, 0xD4, 0x4F, 0x04, 0x8D, 0xDE, 0x0E, 0x70, 0x58, 0xAF, 0x8F, 0x60, 0x7E,
+    0x55, 0x79, 0xB0, 0xAE, 0x1B, 0xA0, 0x49, 0xF4, 0xEE, 0x99, 0x6F, 0x86, 0x68, 0x7E, 0x67, 0x92,
+    0xE4, 0x32, 0x49, 0xDA, 0xA8, 0x06, 0x67, 0xF5, 0x0E, 0x79, 0xCD, 0x90, 0xD5, 0x49, 0x6F, 0xFA,
+    0xCC, 0xA5, 0x52, 0x4B, 0xB7, 0xC0, 0x91, 0x0B, 0xB7, 0x37, 0xFB, 0xCF, 0x13, 0xD2, 0xD5, 0xC1,
+    0x13, 0xFD, 0x33, 0x5D, 0xCD, 0x4A, 0xA2, 0x7C, 0xE0, 0xFC, 0xF7, 0x49, 0x13, 0xCB, 0x7C, 0x38,
+    0x30, 0x77, 0xFB, 0x55, 0x01, 0xFF, 0x8B, 0xC4, 0xF0, 0x13, 0x3B, 0x58, 0xEF, 0x74, 0xC8, 0x6D,
+    0x85, 0x7E, 0x6D, 0x51, 0xCF, 0x1A, 0xC5, 0xB5, 0xB6, 0x68, 0xE5, 0xA7, 0xEA, 0x83, 0xEE, 0x2A,
+    0xB2, 0x25, 0x92, 0x85, 0x79, 0x88, 0x7C, 0x73, 0x3E, 0xAE, 0x60, 0x7B, 0xA8, 0x86, 0xBF, 0x20,
+    0xA0, 0xEF, 0x61, 0x25, 0x95, 0xA3, 0x27, 0x2C, 0x7F, 0xCD, 0x41, 0x5E, 0xEF, 0x42, 0x4E, 0x7A,
+    0x80, 0x45, 0xE6, 0xC1, 0x1A, 0xFE, 0xC0, 0x0E, 0x50, 0x3D, 0x37, 0x81, 0xF5, 0x0B, 0x98, 0x50,
+    0x39, 0x90, 0xF5, 0x50, 0x5D, 0x0F, 0x60, 0xBD, 0x3E, 0xE4, 0xE6, 0xCD, 0x33, 0x67, 0xBA, 0xEB,
+    0x92, 0x34, 0x6A, 0x43, 0xC0, 0xEB, 0x69, 0x49, 0x7A, 0x53, 0x92, 0x7E, 0xA5, 0x9A, 0x6C, 0x6E,
+    0x7A, 0x12, 0x3D, 0x3D, 0x42, 0xF3, 0xD3, 0x19, 0x8A, 0x9B, 0xAA, 0xC9, 0x97, 0x66, 0x20, 0x55,
+    0x1B, 0xE3, 0x44, 0xC2, 0x66, 0xD1, 0x1D, 0xF7, 0xC0, 0xB2, 0x0B, 0x17, 0x79, 0x78, 0xB5, 0xB7,
+    0xAC, 0x5B, 0x69, 0x78, 0x26, 0x56, 0x72, 0xDE, 0xB6, 0x2B, 0x65, 0x9F, 0x8C, 0x44, 0xA7, 0x15,
+    0xC5, 0x57, 0x17, 0xB8, 0x26, 0xD5, 0xA9, 0x24, 0xF2, 0x25, 0x99, 0x29, 0xFB, 0x64, 0x42, 0x18,
+    0x6F, 0x26, 0x72, 0x67, 0x7B, 0x4A, 0xAA, 0x9A, 0x3D, 0x66, 0x52, 0x6F, 0x46, 0xAC, 0xB3, 0x3D,
+    0x15, 0x4D, 0xCD, 0x9C, 0xCC, 0x98, 0x31, 0x9B, 0x28, 0xFA, 0x72, 0xA0, 0xA9, 0xD3, 0x09, 0xF2,
+    0xC1, 0x4C, 0x60, 0xE3, 0xD5, 0xAF, 0xD7, 0x70, 0xE7, 0x6B, 0xB5, 0xDF, 0xF3, 0xF0, 0x3B, 0xCB,
+    0xA5, 0x4B, 0x2F, 0x4E, 0xEF, 0xFB, 0xCE, 0xBE, 0xEB, 0x79, 0x8C, 0xD7, 0xEC, 0xE0, 0x75, 0x39,
+    0x73, 0xE6, 0xEC, 0x98, 0xCD, 0x50, 0xC4, 0xEB, 0xB4, 0x7F, 0x2D, 0xA7, 0x6C, 0x81, 0x72, 0xA2,
+    0xDA, 0x60, 0x14, 0x7B, 0x2F, 0x47, 0xA7, 0x85, 0x54, 0xD3, 0x86, 0x11, 0x2B, 0x6A, 0xE2, 0xE2,
+    0x9A, 0x8C, 0xDD, 0x40, 0x7E, 0x43, 0x23, 0xA5, 0xE4, 0xE9, 0x86, 0xA2, 0x4F, 0x67, 0x8A, 0xD6,
+    0x7A, 0x2A, 0xAA, 0x76, 0xBF, 0xF7, 0xFB, 0x80, 0x04, 0x66, 0x8C, 0xCF, 0x46, 0x6C, 0x5F, 0xF4,
+    0x54, 0x75, 0xD3, 0x26, 0x73, 0xBA, 0x90, 0x8D, 0x87, 0xF8, 0xBA, 0x92, 0xD7, 0xFE, 0x46, 0x76,
+    0xF2, 0x73, 0x27, 0x7D, 0xF9, 0xD6, 0xBE, 0xF7, 0x7B, 0xA3, 0x74, 0x92, 0xCE, 0xE4, 0x23, 0x65,
+    0x4F, 0x53, 0x27, 0x33, 0xD9, 0x48, 0x71, 0x87, 0xEA, 0x44, 0x31, 0xD0, 0xB4, 0xC9, 0x42, 0x16,
+    0x28, 0x3D, 0x9D, 0x4B, 0x85, 0x0D, 0x54, 0x1E, 0x39, 0xDB, 0x9E, 0x78, 0xCF, 0xBD, 0xFD, 0xDC,
+    0xF5, 0xBF, 0x97, 0x85, 0x6F, 0xA7, 0x07, 0xE7, 0xF4, 0xD4, 0x93, 0x3B, 0x4A, 0xB8, 0x42, 0x3A,
+    0xAC, 0xD5, 0x3D, 0x8C, 0xC7, 0x3A, 0x2A, 0x08, 0x9B, 0x6A, 0x9D, 0xCC, 0x40, 0xF2, 0x68, 0xA7,
+    0x50, 0x49, 0x6F, 0x3C, 0x79, 0xA7, 0xA1, 0x9C, 0xCE, 0x50, 0xF6, 0x9B, 0x22, 0x99, 0xA1, 0xF8,
+    0x90, 0x62, 0x81, 0x62, 0xD8, 0x16, 0x82, 0xD2, 0x93, 0xC6, 0xC2, 0x08, 0xAA, 0x58, 0xF0, 0x80,
+    0x89, 0x7A, 0x93, 0xBB, 0x85, 0x22, 0xF1, 0x50, 0x46, 0xB3, 0xF1, 0x78, 0xA4, 0x2D, 0xD7, 0x4F,
+    0x65, 0x94, 0xE8, 0xEA, 0xB6, 0x62, 0x84, 0xA6, 0xE6, 0xC8, 0xC5, 0xC6, 0x2D, 0x66, 0xB2, 0x43,
+    0xD5, 0x6E, 0x8B, 0x60, 0x7D, 0xE5, 0xB4, 0x29, 0x66, 0x3B, 0x36, 0x6F, 0xE8, 0x89, 0xA5, 0x9C,
+    0x1E, 0x49, 0xFA, 0xA3, 0x9C, 0xA0, 0x73, 0x67, 0xC9, 0xFB, 0xAA, 0x5D, 0xB2, 0xB0, 0x75, 0x90,
+    0x1F, 0x62, 0x2F, 0xF5, 0xB9, 0x3B, 0xCE, 0x95, 0xD4, 0xE7, 0xAE, 0x3C, 0x10, 0x45, 0x6B, 0xFB,
+    0xE6, 0xD1, 0xFE, 0x28, 0x97, 0x8D, 0xCB, 0x42, 0x3A, 0x16, 0xAE, 0x33, 0xC1, 0x8E, 0x07, 0xF9,
+    0xA5, 0x23, 0x2F, 0x94, 0x7D, 0xF7, 0xD8, 0x9C, 0x8D, 0x45, 0xDF, 0x3C, 0xFA, 0xBE, 0xE2, 0xD9,
+    0x25, 0x9B, 0x8A, 0xA1, 0x79, 0x45, 0x79, 0x28, 0xBD, 0xAE, 0xCB, 0x06, 0xF2, 0x57, 0xFC, 0xDE,
+    0xF1, 0xFC, 0x3B, 0x7E, 0xAF, 0xB4, 0xD7, 0x7D, 0xA8, 0xEC, 0x75, 0x3F, 0x37, 0xF5, 0xA5, 0x9A,
+    0x2F, 0x7E, 0x77, 0xC4, 0x84, 0xAE, 0xA6, 0x7A, 0x6D, 0xC4, 0x84, 0xA6, 0xA6, 0x7A, 0xF5, 0x23,
+    0x54, 0x9E, 0x1F, 0xC9, 0xA6, 0xA6, 0xA5, 0x79, 0x7E, 0x3A, 0x50, 0x19, 0x1B, 0x47, 0xF3, 0xD5,
+    0x40, 0x36, 0x76, 0xB1, 0x92, 0x8F, 0x72, 0x74, 0x36, 0x90, 0x7B, 0xC5, 0x70, 0x9B, 0xC2, 0x93,
+    0xE4, 0x82, 0x46, 0x3D, 0x99, 0x42, 0x74, 0xA8, 0xE7, 0x1A, 0xA0, 0x1B, 0x28, 0x6B, 0xD6, 0x00,
+    0xD6, 0xA8, 0x73, 0x3E, 0x11, 0xC0, 0x4C, 0xDD, 0x1A, 0xD9, 0xB5, 0x4E, 0xDC, 0xDD, 0xC1, 0x17,
+    0x78, 0x7A, 0x63, 0xFC, 0x17, 0x8F, 0x79, 0x48, 0x7D, 0x09, 0x94, 0xE9, 0xB0, 0x25, 0x4E, 0xD2,
+    0x03, 0x77, 0x3D, 0xA4, 0xBE, 0x02, 0x4A, 0xB3, 0xAD, 0x56, 0xC6, 0x83, 0x19, 0x2A, 0x60, 0x67,
+    0xAD, 0xD6, 0xB0, 0x93, 0x8D, 0xEB, 0x50, 0x8D, 0x7E, 0xAC, 0xAC, 0xDF, 0xC6, 0x4D, 0x95, 0x0E,
+    0x92, 0x35, 0x4A, 0x09, 0xC8, 0x0E, 0xAE, 0x4A, 0xC6, 0x91, 0x06, 0x52, 0xB5, 0xE9, 0x70, 0x25,
+    0xED, 0xB3, 0x67, 0xDB, 0x07, 0x5F, 0x22, 0x1F, 0x63, 0x80, 0x4A, 0x4D, 0xD5, 0x63, 0x3D, 0x31,
+    0xE0, 0x80, 0xCA, 0xDD, 0xF1, 0xC3, 0x02, 0x55, 0x8B, 0x1D, 0xC8, 0x26, 0x92, 0x05, 0x9A, 0x9A,
+    0xA2, 0x27, 0x1B, 0x49, 0x66, 0xE8, 0xA0, 0x72, 0xF7, 0x35, 0xBE, 0xD0, 0x94, 0x69, 0x4E, 0xB4,
+    0xD0, 0x2C, 0x14, 0x37, 0xD7, 0x87, 0x5F, 0x88, 0x73, 0x6F, 0xE7, 0xC8, 0x5F, 0x73, 0x5C, 0xC9,
+    0xDC, 0xC1, 0xE5, 0x23, 0x19, 0x63, 0x27, 0x8A, 0x18, 0x15, 0x9D, 0xFA, 0x48, 0x96, 0x94, 0x91,
+    0x29, 0xB9, 0xF5, 0xE3, 0x10, 0xE7, 0xEC, 0x9D, 0x38, 0x89, 0x9B, 0x21, 0xCE, 0x58, 0x33, 0x14,
+    0x9E, 0x22, 0x86, 0xDA, 0x64, 0xEF, 0xD6, 0x6B, 0x28, 0x4D, 0x22, 0x32, 0x6F, 0x66, 0x72, 0x9F,
+    0x4D, 0xE4, 0xDE, 0x7A, 0x72, 0x5F, 0x0E, 0x58, 0xDF, 0x38, 0xEC, 0xA0, 0x1A, 0xFB, 0xD6, 0x02,
+    0xF6, 0xED, 0x00, 0xF6, 0xE7, 0x13, 0x58, 0x79, 0x28, 0xD4, 0x43, 0xA1, 0x16, 0x0A, 0xD5, 0x50,
+    0xCA, 0x41, 0x29, 0x0F, 0xA5, 0x02, 0x54, 0xAF, 0x0B, 0xAA, 0xEB, 0x72, 0x54, 0x2F, 0xCB, 0x53,
+    0xB9, 0x2E, 0x50, 0xB9, 0x4A, 0x34, 0xCE, 0xCA, 0x35, 0x2E, 0x93, 0x6F, 0x5C, 0xAA, 0x83, 0xD6,
+    0x75, 0xE5, 0xB7, 0x97, 0x61, 0xCB, 0x1E, 0xBB, 0x8D, 0x0E, 0xA2, 0x7A, 0xA3, 0x0C, 0x10, 0x49,
+    0xC8, 0xA2, 0x8D, 0x7D, 0x2A, 0x0F, 0x9E, 0xAB, 0x24, 0x55, 0x69, 0xA0, 0xCA, 0x3C, 0x55, 0xE1,
+    0xA8, 0xAA, 0x9A, 0x6A, 0x81, 0x2A, 0x44, 0xE3, 0xA0, 0x5A, 0xA0, 0xEA, 0x5A, 0x9A, 0x6A, 0xA0,
+    0xB1, 0x13, 0x4D, 0xB6, 0xD0, 0xA4, 0x6A, 0x1B, 0x34, 0x74, 0x54, 0xE1, 0xAE, 0xCA, 0x89, 0x5A,
+    0x92, 0xD5, 0x3B, 0x99, 0x2C, 0xFB, 0x71, 0x8F, 0x79, 0x80, 0x43, 0x9C, 0xCE, 0xDC, 0x94, 0xF8,
+    0x3D, 0x76, 0x4F, 0x71, 0xBC, 0x22, 0xFF, 0xE3, 0x3A, 0xBD, 0xD1, 0x22, 0x47, 0xD5, 0x63, 0x03,
+    0x46, 0x8E, 0x5F, 0x07, 0x4E, 0x55, 0xAE, 0x78, 0x62, 0xCA, 0x5C, 0xF7, 0xAC, 0xB7, 0x13, 0x17,
+    0xA3, 0x9B, 0xD9, 0xB8, 0xF8, 0xE6, 0xEC, 0xDA, 0xFE, 0xDB, 0x18, 0x4E, 0xF7, 0xFE, 0xB3, 0xBC,
+    0xCB, 0x59, 0xDD, 0x7A, 0xB6, 0x77, 0x3E, 0x9B, 0x9F, 0xBD, 0xA8, 0x46, 0x7A, 0xDF, 0xC9, 0xE7,
+    0xB1, 0x64, 0xCE, 0xF4, 0x89, 0xE7, 0x07, 0x07, 0x43, 0xF3, 0x4B, 0xAC, 0x33, 0x9E, 0x40, 0x85,
+    0x75, 0xD9, 0x90, 0x4C, 0x9C, 0xA3, 0xA8, 0xF3, 0x3E, 0x1D, 0xB9, 0x4A, 0x59, 0xE7, 0xBD, 0x19,
+    0x99, 0xA9, 0x6A, 0xDB, 0x9B, 0x11, 0x85, 0x4A, 0xB9, 0xDC, 0x91, 0xF6, 0xA3, 0x35, 0xFA, 0x63,
+    0x35, 0xF8, 0x8E, 0xE1, 0x9D, 0x21, 0xAA, 0x8E, 0x76, 0x8C, 0xEA, 0x5F, 0x31, 0x40, 0xD9, 0xC7,
+    0xFF, 0xBC, 0x71, 0x1C, 0xAA, 0xD3, 0x4D, 0x4F, 0x8C, 0x27, 0x70, 0x9E, 0xA2, 0xCD, 0xFA, 0x64,
+    0xD3, 0x93, 0x74, 0xE4, 0xEA, 0xA6, 0x27, 0x33, 0x55, 0x6D, 0x75, 0x5D, 0xBE, 0xDB, 0x17, 0x87,
+    0x6C, 0x49, 0x54, 0x77, 0xAE, 0x1C, 0xF2, 0xD1, 0x84, 0x44, 0xA8, 0xBD, 0x7B, 0x47, 0x13, 0x5F,
+    0xBA, 0xD4, 0x97, 0x2E, 0x1D, 0x4A, 0x67, 0x86, 0x6A, 0x7B, 0xFE, 0xE7, 0x74, 0x74, 0x27, 0x73,
+    0xA7, 0x72, 0x77, 0xCA, 0xBA, 0x53, 0xD6, 0x9D, 0xB3, 0xEE, 0x9C, 0x75, 0xD8, 0x96, 0x22, 0xFE,
+    0xD5, 0x14, 0x35, 0xE5, 0xFB, 0xFF, 0xAA, 0x5B, 0xFE, 0x44, 0x25, 0x4A, 0xDD, 0xA5, 0xA9, 0xA9,
+    0x2F, 0x9D, 0x19, 0x4B, 0x97, 0x4D, 0xA5, 0xCB, 0xA7, 0xD2, 0xD9, 0xF0, 0x71, 0xDE, 0x4B, 0x16,
+    0xE3, 0x10, 0x02, 0x54, 0x60, 0x1D, 0xC6, 0xC3, 0x64, 0xFC, 0xF9, 0x24, 0x14, 0x6D, 0xF7, 0x44,
+    0x5F, 0xBD, 0x31, 0xDA, 0xE9, 0x2A, 0x94, 0x35, 0x79, 0x4F, 0x3A, 0xC2, 0x55, 0xA8, 0x6A, 0x6C,
+    0x8F, 0x19, 0x61, 0x8E, 0x1F, 0xE4, 0x8C, 0x3C, 0xDD, 0x2D, 0x23, 0xF1, 0x4B, 0x6B, 0xC4, 0x2F,
+    0xFB, 0xF4, 0xFA, 0x3A, 0xBF, 0x47, 0x85, 0x75, 0xD5, 0xC9, 0x8E, 0xB4, 0x3B, 0x71, 0xD4, 0xEC,
+    0x01, 0x14, 0x2F, 0x47, 0xEB, 0xF8, 0x7A, 0xB4, 0x26, 0x5F, 0xED, 0x01, 0xCA, 0xD7, 0x1D, 0x40,
+    0x79, 0x23, 0xD2, 0xCE, 0x31, 0x88, 0xA0, 0x8C, 0x8F, 0x2B, 0xC7, 0xFD, 0xB9, 0x68, 0x13, 0xD5,
+    0x7E, 0x4B, 0x11, 0xDD, 0xE9, 0x89, 0x5A, 0xB6, 0x71, 0x61, 0xE4, 0xB1, 0xB0, 0xB1, 0xA8, 0xE2,
+    0x57, 0x9A, 0xE6, 0x67, 0x2F, 0x0A, 0xE6, 0x46, 0x12, 0x69, 0x68, 0x24, 0x61, 0x7C, 0x23, 0x09,
+    0x3B, 0x34, 0x92, 0x36, 0xE1, 0x87, 0x55, 0x9C, 0x88, 0x63, 0xE8, 0xE1, 0xEA, 0xE2, 0x8D, 0x4B,
+    0x68, 0x74, 0xE9, 0x80, 0x8D, 0xAA, 0xDA, 0xAD, 0x1C, 0x55, 0x72, 0x7A, 0x43, 0x99, 0xEF, 0x2B,
+    0xAC, 0xEF, 0xD3, 0xE0, 0x93, 0x89, 0xE8, 0x7F, 0x59, 0x15, 0xD6, 0x7B, 0x20, 0x7D, 0x77, 0x5A,
+    0x63, 0xDA, 0x9A, 0x36, 0x7A, 0xBB, 0x33, 0x8D, 0x24, 0xFA, 0x5A, 0x4F, 0xD3, 0x57, 0x35, 0xF7,
+    0x33, 0x6F, 0x22, 0x02, 0x6C, 0xBF, 0x59, 0x23, 0x15, 0x20, 0x95, 0x67, 0x4D, 0x8C, 0x38, 0xC9,
+    0x1A, 0xBD, 0x13, 0x79, 0xA3, 0xCC, 0x6D, 0x5D, 0x35, 0x77, 0x3E, 0xD2, 0xA9, 0x1C, 0x40, 0x79,
+    0x80, 0xEA, 0x39, 0xB5, 0xD8, 0x41, 0x1E, 0x33, 0x55, 0x0B, 0x2C, 0x56, 0x8E, 0xE6, 0x39, 0x4D,
+    0x14, 0xFD, 0x22, 0xB2, 0xB1, 0x7A, 0xB1, 0x4F, 0xE7, 0xE2, 0xED, 0x40, 0xF7, 0xC4, 0xD4, 0xD5,
+    0xE5, 0x1B, 0x8B, 0xF5, 0xD6, 0x77, 0xDF, 0x99, 0x4D, 0x28, 0x87, 0xCA, 0x29, 0x9F, 0xF2, 0xB1,
+    0xBA, 0x2E, 0x16, 0xEB, 0xE5, 0xCA, 0xEB, 0xA1, 0xF2, 0xD9, 0x4D, 0xD9, 0x80, 0x9A, 0xEB, 0xA2,
+    0x90, 0x97, 0x33, 0x9A, 0x1A, 0x4F, 0xB3, 0x14, 0x01, 0xAB, 0xE7, 0x45, 0xA2, 0x01, 0x8E, 0xAC,
+    0xA1, 0x68, 0x27, 0x57, 0xC7, 0xC2, 0xB8, 0x95, 0xA1, 0xDB, 0x1D, 0x6E, 0xA7, 0x29, 0xCA, 0x85,
+    0x42, 0x72, 0xE5, 0x98, 0x0F, 0x65, 0x6F, 0x7C, 0xE9, 0xD2, 0xB1, 0xAA, 0x93, 0xB1, 0xAA, 0x93,
+    0x69, 0x3D, 0x43, 0x55, 0xA7, 0xA1, 0x6A, 0xE3, 0xD9, 0x1C, 0x38, 0x3B, 0x17, 0xE3, 0x57, 0xBF,
+    0xF8, 0xEC, 0x02, 0xD6, 0x77, 0x0E, 0x13, 0xCA, 0x09, 0x16, 0x2B, 0xA8, 0x9E, 0xD3, 0x80, 0x1D,
+    0x14, 0xC8, 0xA6, 0x4A, 0x75, 0x32, 0xDB, 0x1B, 0x9E, 0xE6, 0xF1, 0x77, 0x67, 0xCA, 0x37, 0x96,
+    0xCA, 0xE5, 0x63, 0xF3, 0xDD, 0x31, 0x9D, 0x8B, 0x41, 0x28, 0x9F, 0xCA, 0xBE, 0x7A, 0x65, 0x31,
+    0xC1, 0xFA, 0xAE, 0xED, 0x1E, 0x0F, 0x95, 0xB7, 0x83, 0x6C, 0x30, 0xA1, 0xBA, 0x2E, 0x9A, 0x3F,
+    0xF6, 0x72, 0xF6, 0xD7, 0xA1, 0xF2, 0x89, 0x64, 0x03, 0x95, 0x9E, 0x17, 0x99, 0xDE, 0x92, 0x43,
+    0x53, 0xE3, 0xD7, 0x58, 0x55, 0x0E, 0xC6, 0x69, 0x26, 0x31, 0x42, 0xDA, 0x6D, 0x48, 0xA5, 0x7C,
+    0xDA, 0x90, 0x2A, 0xD1, 0xEA, 0xEF, 0xDA, 0xDF, 0x5C, 0xDF, 0xB7, 0x63, 0xA8, 0x5A, 0xAD, 0xF0,
+    0x6A, 0x33, 0x0D, 0xEF, 0x47, 0xF9, 0x1C, 0x74, 0xFC, 0x1D, 0x4F, 0x87, 0x8D, 0xDF, 0xAF, 0x1C,
+    0xB6, 0xB2, 0xF4, 0x85, 0x3B, 0xCB, 0xD2, 0x0F, 0x8A, 0xAD, 0x2C, 0xBD, 0x72, 0x67, 0x59, 0x1A,
+    0xFF, 0x73, 0x64, 0xA9, 0xFA, 0x88, 0xB2, 0x94, 0xB4, 0xFC, 0x75, 0xC6, 0x64, 0x60, 0xC7, 0xB6,
+    0xD8, 0x65, 0x1D, 0xA9, 0x7F, 0x9E, 0xB2, 0x94, 0xBB, 0x38, 0x45, 0xAC, 0xCF, 0xB2, 0x1E, 0x76,
+    0x3E, 0x24, 0xA4, 0x27, 0x39, 0xCD, 0xF1, 0x72, 0xA1, 0x94, 0x5C, 0x39, 0xDA, 0xBE, 0x72, 0xC6,
+    0x57, 0x6D, 0xEA, 0xAB, 0x3A, 0x1D, 0xAB, 0x3A, 0x9D, 0x0E, 0x9E, 0x4D, 0x9D, 0x86, 0x78, 0x9A,
+    0xD0, 0xB4, 0x26, 0x74, 0xEB, 0xF9, 0xC9, 0x90, 0xE1, 0x5C, 0xC0, 0x59, 0xB5, 0x20, 0xD5, 0xD0,
+    0xBC, 0x03, 0x7C, 0xEA, 0x23, 0x23, 0x9B, 0xDE, 0x0D, 0xD9, 0xB9, 0x73, 0x1B, 0xFD, 0xCD, 0x04,
+    0x50, 0x20, 0xD1, 0x44, 0xB2, 0x0D, 0x4D, 0x3F, 0x74, 0x1A, 0x4A, 0xC9, 0x91, 0xDC, 0x45, 0xD9,
+    0x38, 0xA6, 0x0B, 0x90, 0x49, 0x13, 0x74, 0x8B, 0x66, 0xEC, 0x42, 0x31, 0xD3, 0xF5, 0xD8, 0x60,
+    0x66, 0xB0, 0x53, 0x39, 0x40, 0xE1, 0x05, 0x54, 0x3F, 0x0A, 0x40, 0xF3, 0x74, 0x0F, 0x2C, 0x0D,
+    0x9B, 0xA8, 0xFA, 0xFC, 0xD7, 0xFB, 0x51, 0xF5, 0xD7, 0xE2, 0xED, 0x99, 0x55, 0xCB, 0xA6, 0xFB,
+    0x5A, 0x80, 0x3C, 0x94, 0x3A, 0xFD, 0x5B, 0x8A, 0x6C, 0x47, 0xDB, 0x29, 0xFA, 0x37, 0xA4, 0x61,
+    0x4D, 0x56, 0xE8, 0xA4, 0x1E, 0x8E, 0x6D, 0xFD, 0xE8, 0xC9, 0xDF, 0x79, 0xD1, 0x5B, 0x69, 0x3C,
+    0x72, 0xE9, 0xCC, 0xE9, 0xBB, 0x4A, 0xC6, 0xC7, 0x8D, 0x0D, 0x3D, 0x02, 0x17, 0xE0, 0x4B, 0x64,
+    0x35, 0xEC, 0x72, 0x12, 0x88, 0xF1, 0x9F, 0x31, 0x16, 0xAF, 0xBB, 0xF0, 0x01, 0xDE, 0x8A, 0x4F,
+    0x20, 0x64, 0x87, 0xE1, 0x62, 0x56, 0x27, 0x83, 0x71, 0xA6, 0x4F, 0xA5, 0x16, 0x09, 0x8E, 0xBD,
+    0xF3, 0xC1, 0x83, 0xEB, 0xE3, 0x42, 0xC8, 0x1E, 0x5C, 0x21, 0xF3, 0x64, 0x9E, 0xD2, 0x51, 0x3A,
+    0x04, 0x22, 0x39, 0x1D, 0xD7, 0xF3, 0x3B, 0x47, 0x80, 0xC4, 0xE4, 0x8D, 0x88, 0x9C, 0x51, 0x9B,
+    0xA9, 0xCE, 0x67, 0x90, 0x8B, 0xD9, 0x1B, 0x11, 0xBA, 0xCA, 0x81, 0x1D, 0x2B, 0x07, 0xD9, 0xD8,
+    0xD4, 0x60, 0xA6, 0x86, 0xCD, 0x35, 0x0D, 0x07, 0xAE, 0x9B, 0xFB, 0x35, 0x98, 0xA9, 0x72, 0x90,
+    0x8F, 0x31, 0x81, 0x23, 0xA2, 0x67, 0x25, 0x69, 0xC8, 0xB5, 0x4D, 0x02, 0x6A, 0x57, 0xF8, 0xCA,
+    0x98, 0xCC, 0xD3, 0xED, 0x5B, 0xCC, 0xB9, 0x23, 0x6F, 0xCD, 0x88, 0x19, 0x93, 0x99, 0x24, 0xD0,
+    0x41, 0xC7, 0x03, 0x35, 0x0F, 0x7C, 0x94, 0xE8, 0x96, 0xF2, 0x26, 0x50, 0x6A, 0x82, 0x7C, 0xE9,
+    0x3C, 0x49, 0xA0, 0xAC, 0x57, 0xB2, 0x69, 0x20, 0xEB, 0x39, 0x07, 0xE7, 0xC9, 0x7B, 0xCC, 0xC0,
+    0x55, 0x38, 0x4F, 0x36, 0x90, 0x0D, 0x54, 0x30, 0x63, 0x96, 0x33, 0x9D, 0x23, 0x3A, 0xC7, 0x3B,
+    0x2D, 0x90, 0x48, 0x2D, 0xA4, 0x51, 0x01, 0xFB, 0xD2, 0xEA, 0x10, 0xE2, 0xCA, 0xAA, 0xA2, 0xA4,
+    0x1E, 0xF8, 0xED, 0x5B, 0x9F, 0x7F, 0xE9, 0x87, 0x35, 0x76, 0xED, 0x1D, 0x96, 0x6C, 0xC2, 0x63,
+    0x5D, 0x01, 0x57, 0x13, 0x4F, 0x36, 0x14, 0x70, 0x2D, 0xF1, 0x14, 0x7D, 0x49, 0x1E, 0x52, 0x49,
+    0x6D, 0x29, 0xF5, 0xA9, 0x34, 0x51, 0x49, 0xDE, 0x2C, 0x4F, 0xA9, 0xAD, 0x5C, 0x3A, 0x9B, 0x80,
+    0x1D, 0xAA, 0x1E, 0x99, 0x19, 0xEB, 0xAB, 0x1E, 0x3D, 0x3E, 0x63, 0xA7, 0x66, 0x40, 0xAF, 0x2E,
+    0xD8, 0xD0, 0x0C, 0xE8, 0xCD, 0x05, 0xBB, 0xF0, 0xD7, 0xC0, 0x93, 0x39, 0x4E, 0x91, 0xF8, 0x8D,
+    0xD6, 0x0A, 0xB0, 0x73, 0xAC, 0x7F, 0x4F, 0x8F, 0x6B, 0xB1, 0xCB, 0xEF, 0x35, 0x2E, 0x99, 0xC9,
+    0x3C, 0x85, 0xA3, 0x21, 0x0D, 0xE4, 0x9E, 0xCA, 0x21, 0xCC, 0x4C, 0x31, 0xD1, 0x0C, 0x1C, 0xB9,
+    0xF4, 0x0F, 0x41, 0x9A, 0xB0, 0x92, 0xC7, 0xD3, 0xB4, 0x16, 0x42, 0xE2, 0xC9, 0xFB, 0x02, 0xCE,
+    0x27, 0x9E, 0x7C, 0x28, 0x48, 0xE6, 0xD4, 0xD3, 0xB9, 0x52, 0x9A, 0x52, 0x69, 0xA6, 0x5C, 0xD3,
+    0x70, 0xA8, 0x7E, 0x72, 0x76, 0x32, 0x81, 0xB2, 0xAF, 0x1C, 0xCB, 0xB6, 0xC1, 0x66, 0xC6, 0x8E,
+    0x55, 0x8F, 0x9E, 0xDF, 0x34, 0xF8, 0xD5, 0x05, 0x3B, 0x37, 0x03, 0x07, 0x83, 0xBB, 0x6F, 0xB3,
+    0xB6, 0x50, 0xBB, 0xBA, 0x64, 0xB4, 0x46, 0x1E, 0xA5, 0xCB, 0x6A, 0xBA, 0x6F, 0x19, 0x7A, 0xF3,
+    0xD6, 0x55, 0x73, 0x63, 0x36, 0x5A, 0x8C, 0xFE, 0xF7, 0x2C, 0x90, 0x8D, 0xAB, 0xE4, 0x67, 0x9E,
+    0xDC, 0x93, 0x7B, 0x6C, 0xFC, 0x1B, 0x29, 0x26, 0x8A, 0xE9, 0x2E, 0x0F, 0x9B, 0x28, 0x46, 0x0A,
+    0x4F, 0xE9, 0x29, 0x07, 0xAA, 0x9E, 0xC6, 0xD1, 0xB5, 0xA4, 0x2D, 0x17, 0x23, 0x7D, 0xBD, 0x53,
+    0xAE, 0x66, 0xBA, 0xF1, 0xAB, 0xBB, 0xF7, 0x2F, 0xF7, 0x55, 0x43, 0x5E, 0x67, 0xED, 0x95, 0xBC,
+    0xCD, 0x7F, 0xDC, 0xD2, 0xB5, 0x58, 0x07, 0xF5, 0x81, 0xF7, 0x6D, 0xBB, 0xD1, 0x68, 0x41, 0xFF,
+    0xB1, 0x6E, 0x1C, 0x45, 0x4F, 0x0C, 0x9B, 0xA5, 0x81, 0x32, 0x26, 0x8C, 0xAE, 0xBC, 0x52, 0x4F,
+    0x31, 0x91, 0x2D, 0x9B, 0x90, 0xC6, 0x18, 0xA7, 0xB9, 0x6A, 0xE0, 0x51, 0x83, 0x8D, 0xAE, 0xDB,
+    0xBD, 0x0F, 0x1D, 0x6D, 0x87, 0xBE, 0x57, 0x43, 0x2E, 0xF9, 0xFD, 0x84, 0x05, 0x41, 0x73, 0x93,
+    0xFB, 0xD7, 0x60, 0xAB, 0x98, 0x21, 0x1B, 0x8D, 0x91, 0x99, 0xAD, 0xC7, 0x31, 0xD7, 0x05, 0xC0,
+    0x6A, 0xA9, 0xC1, 0x4A, 0xC3, 0x66, 0x12, 0xE7, 0xAC, 0x02, 0x1B, 0x26, 0x0D, 0x4D, 0x40, 0x22,
+    0x1F, 0xE3, 0xE5, 0x3E, 0x05, 0x95, 0xE8, 0x7E, 0xF6, 0x62, 0x4C, 0x14, 0xD1, 0x50, 0x49, 0x92,
+    0xD9, 0x06, 0xC0, 0xCE, 0x1C, 0x96, 0x6E, 0xEE, 0xB7, 0xED, 0x99, 0x38, 0x5E, 0x8B, 0x68, 0xE0,
+    0x65, 0x0E, 0xBE, 0x78, 0xBB, 0x7B, 0x4F, 0xEF, 0x20, 0xF5, 0xF9, 0x3B, 0x0F, 0x70, 0x32, 0x6A,
+    0x5C, 0x66, 0x84, 0x7C, 0x89, 0xDC, 0x63, 0xAA, 0x29, 0x3A, 0xC4, 0x73, 0x7F, 0xB4, 0x6E, 0x9C,
+    0x24, 0x1B, 0xA3, 0x33, 0xDC, 0xB1, 0x03, 0x81, 0x66, 0xBB, 0xFB, 0xA6, 0x55, 0x35, 0x02, 0xA6,
+    0x9F, 0x80, 0x13, 0x3C, 0x03, 0x49, 0xCD, 0x7D, 0xB7, 0x3C, 0xF1, 0xBF, 0x7D, 0x32, 0x66, 0x30,
+    0xB2, 0x9F, 0xDC, 0xE1, 0xC9, 0x74, 0x21, 0xA9, 0x37, 0xBE, 0xA8, 0xFD, 0xE0, 0xE9, 0x18, 0x47,
+    0x1C, 0x4D, 0xC4, 0xEE, 0x66, 0xCC, 0x50, 0x7F, 0x07, 0x62, 0xBE, 0x22, 0x8D, 0xD4, 0xC2, 0xE1,
+    0x4D, 0xCA, 0x96, 0xDB, 0xDA, 0x8A, 0x85, 0xD6, 0xF8, 0xB9, 0x1A, 0x23, 0x9F, 0x2F, 0x97, 0x62,
+    0x80, 0x6E, 0x0C, 0xCA, 0x8B, 0xEB, 0x58, 0x4C, 0xBE, 0xEC, 0x39, 0xAB, 0xAD, 0x7A, 0xC2, 0xE1,
+    0x3A, 0xF2, 0xD8, 0x82, 0x9D, 0x0A, 0xD3, 0x17, 0x3C, 0xC2, 0xD1, 0x83, 0xC9, 0x7E, 0x56, 0x33,
+    0xD7, 0x1E, 0x3D, 0x6D, 0x5C, 0x0C, 0x81, 0xA8, 0xEA, 0xB8, 0x0F, 0x42, 0xB7, 0x40, 0xA9, 0x96,
+    0xA4, 0x6B, 0xA1, 0xE3, 0x9D, 0x2C, 0x58, 0xC9, 0xC7, 0x60, 0xA6, 0x10, 0xE7, 0xF5, 0xDF, 0x3A,
+    0xC3, 0xAA, 0xFB, 0x18, 0x49, 0x50, 0x49, 0x81, 0x44, 0xEF, 0x70, 0x7A, 0x93, 0x70, 0xEA, 0xF6,
+    0x05, 0x64, 0xDC, 0x97, 0x9B, 0x18, 0xF0, 0x58, 0xE9, 0x26, 0x6B, 0x7C, 0xFE, 0xBA, 0x62, 0x25,
+    0xDD, 0x2A, 0x14, 0x1E, 0x30, 0x1A, 0xA2, 0x80, 0xC4, 0xAE, 0xDF, 0x07, 0x0A, 0xA9, 0x2E, 0x75,
+    0x9B, 0xA8, 0x3A, 0x49, 0x0A, 0x56, 0x92, 0xDA, 0x4A, 0xD2, 0xC8, 0xB1, 0x88, 0x22, 0x17, 0x0E,
+    0xD8, 0xC4, 0x8F, 0x00, 0xF0, 0x65, 0x20, 0xD2, 0xA3, 0xD1, 0x33, 0x7C, 0xA4, 0xFE, 0x98, 0x3D,
+    0x37, 0xC0, 0x67, 0xD7, 0xBC, 0x9E, 0x0C, 0xF8, 0x0C, 0xF0, 0x2D, 0x50, 0x4B, 0xFA, 0x02, 0x7C,
+    0x8A, 0x64, 0x23, 0x29, 0x9C, 0xCA, 0x5B, 0x60, 0xE7, 0x00, 0x1A, 0xBB, 0xFB, 0x4C, 0xF6, 0x5F,
+    0xB9, 0xD1, 0x77, 0x84, 0xB4, 0xB5, 0xF5, 0x49, 0xF2, 0xEF, 0x3A, 0xF2, 0x10, 0x25, 0xF9, 0xE8,
+    0x6F, 0x74, 0xF4, 0x35, 0x92, 0xF4, 0x63, 0x49, 0xFA, 0xB5, 0x24, 0xCD, 0xDF, 0x3F, 0x3D, 0x73,
+    0x66, 0xED, 0xAB, 0xED, 0xB7, 0x72, 0x34, 0x6F, 0x01, 0xB0, 0xC3, 0xE6, 0x6D, 0xC7, 0x18, 0x87,
+    0xA6, 0xDD, 0x38, 0xA4, 0xB3, 0xFD, 0x9B, 0x5D, 0xBB, 0x35, 0x65, 0xC3, 0xD6, 0x99, 0xDD, 0x6D,
+    0xED, 0x5B, 0x1B, 0xB6, 0xFE, 0xE4, 0xE8, 0x2F, 0x72, 0xFB, 0x79, 0x9E, 0x8F, 0xC4, 0x1D, 0x40,
+    0x36, 0x46, 0xF1, 0x1F, 0xAC, 0x0C, 0x5F, 0x4B, 0x36, 0x90, 0x4C, 0x70, 0x15, 0xCA, 0xDA, 0x48,
+    0xBF, 0x90, 0xC2, 0x86, 0x95, 0xEA, 0x31, 0xB7, 0x30, 0x5B, 0x49, 0x88, 0xEC, 0xBE, 0x86, 0x4C,
+    0x21, 0x91, 0xA8, 0xE4, 0xF8, 0x72, 0x5C, 0x10, 0x33, 0x48, 0x1D, 0x55, 0xCF, 0x91, 0x9A, 0xFB,
+    0x48, 0x20, 0x6B, 0xB3, 0x16, 0x76, 0xF3, 0x16, 0xB2, 0x1B, 0xED, 0xA6, 0x4F, 0x31, 0x03, 0xBC,
+    0xBE, 0x43, 0x5C, 0xBA, 0xA4, 0x59, 0x5A, 0x69, 0x35, 0xFD, 0xC9, 0x19, 0xDB, 0x1F, 0x3A, 0x7D,
+    0x3B, 0x4E, 0xFB, 0xE0, 0x2D, 0xDB, 0xDE, 0xDD, 0x8A, 0xD3, 0x3E, 0x78, 0xF9, 0x74, 0x07, 0x9C,
+    0x0E, 0x80, 0x17, 0x33, 0x4B, 0xB7, 0xE0, 0xB1, 0x3A, 0x4F, 0x4C, 0x0F, 0xA7, 0xF8, 0x7C, 0xD6,
+    0x67, 0xC3, 0x2E, 0xE7, 0x73, 0x17, 0xC3, 0x7A, 0x8D, 0xE4, 0x1B, 0x09, 0xDB, 0xC3, 0x1C, 0x9B,
+    0x12, 0x22, 0xF3, 0xB4, 0x5F, 0x14, 0x2E, 0x7A, 0xF8, 0x34, 0x24, 0x12, 0x85, 0x3C, 0x6B, 0x60,
+    0xC0, 0x41, 0x69, 0xF8, 0xE1, 0x7F, 0xA2, 0x34, 0xDC, 0x1A, 0x13, 0x7A, 0xA0, 0x97, 0xFF, 0x09,
+    0xD2, 0x10, 0x17, 0x9D, 0xA2, 0x25, 0x99, 0xA0, 0xAC, 0x49, 0x47, 0xAC, 0xF4, 0xB2, 0x14, 0xA8,
+    0x6A, 0xCC, 0x08, 0x55, 0x9D, 0xC7, 0xFD, 0x48, 0x5E, 0x93, 0xC2, 0xC6, 0x79, 0xD8, 0xC4, 0xB8,
+    0xB6, 0x46, 0x6D, 0xA6, 0x40, 0x13, 0x23, 0xC3, 0x93, 0xFA, 0x5E, 0x30, 0xC1, 0xD4, 0x24, 0x6F,
+    0xBB, 0x1E, 0x2E, 0x9F, 0xB8, 0x0C, 0x8F, 0x64, 0x01, 0x3E, 0xC5, 0xEF, 0xDF, 0x25, 0x56, 0xE5,
+    0x07, 0xF0, 0xC5, 0x7F, 0x2C, 0xC8, 0x43, 0xE3, 0x48, 0x55, 0x78, 0xE8, 0x5E, 0x0D, 0x50, 0xFE,
+    0x62, 0xFF, 0xA6, 0xF5, 0x6B, 0x4E, 0x76, 0xE1, 0x05, 0x59, 0xA8, 0x1C, 0xC9, 0x62, 0x3D, 0x34,
+    0xCF, 0x05, 0x28, 0x06, 0x41, 0x36, 0xED, 0xDF, 0x7C, 0x3C, 0x40, 0xD9, 0xAB, 0xC6, 0x8E, 0xA5,
+    0x27, 0x0B, 0xB9, 0xBE, 0x77, 0x56, 0x31, 0x07, 0xBE, 0xDA, 0x28, 0xF4, 0x1E, 0x49, 0x23, 0xD9,
+    0x36, 0x69, 0x2F, 0x19, 0x33, 0x8A, 0x97, 0x1E, 0xE2, 0xF2, 0xE5, 0x6F, 0xA5, 0xEE, 0x3D, 0x67,
+    0x99, 0x6F, 0xE5, 0x5B, 0x46, 0xF2, 0x37, 0x7B, 0xCA, 0xA7, 0x6B, 0xAE, 0x9E, 0x27, 0xFD, 0xD5,
+    0x44, 0xFE, 0xA3, 0x81, 0xEA, 0x6B, 0x8E, 0xA5, 0xC2, 0x4C, 0x01, 0xFB, 0xB6, 0xA7, 0xFA, 0xA3,
+    0xC1, 0x2C, 0x65, 0x74, 0xCE, 0x0E, 0x92, 0x5E, 0x91, 0x9A, 0x44, 0x6F, 0x6D, 0xA4, 0x28, 0x81,
+    0x23, 0x52, 0x4F, 0x2E, 0x4D, 0x71, 0x9F, 0x80, 0x3B, 0x1E, 0x4D, 0x7F, 0x37, 0x24, 0x0A, 0x0F,
+    0xDD, 0xF5, 0x00, 0xE5, 0x3E, 0x12, 0x07, 0xE0, 0xB9, 0x15, 0x89, 0x7D, 0x78, 0xC6, 0xCA, 0x91,
+    0xCE, 0x76, 0x04, 0x3D, 0x26, 0x68, 0x5C, 0xF7, 0xEE, 0x53, 0x71, 0xB1, 0x09, 0x66, 0x13, 0xF1,
+    0x1E, 0x33, 0x93, 0x6A, 0xCE, 0x1E, 0xCC, 0x27, 0xAB, 0xBF, 0x29, 0x19, 0x69, 0xB9, 0x25, 0x04,
+    0xB8, 0xAC, 0xB9, 0x7A, 0x8E, 0xF4, 0x57, 0x23, 0xF9, 0x9B, 0x03, 0xE5, 0xD3, 0x2D, 0x57, 0x77,
+    0x30, 0xE3, 0x06, 0x85, 0x15, 0x94, 0x85, 0xEA, 0x3F, 0xC4, 0x80, 0xC7, 0x25, 0x6E, 0xAB, 0xF3,
+    0x6B, 0x5F, 0x2C, 0x91, 0xEC, 0x3D, 0x81, 0x05, 0x8B, 0x71, 0x98, 0x21, 0x1B, 0xA0, 0x92, 0xDF,
+    0x2C, 0x8E, 0x0F, 0x5E, 0xF8, 0x20, 0x46, 0xE7, 0x43, 0x64, 0x65, 0x8B, 0x50, 0x71, 0x2B, 0x42,
+    0xCF, 0xDD, 0x15, 0xA1, 0x5E, 0x90, 0x8F, 0x55, 0x8F, 0x99, 0xF3, 0x40, 0xA2, 0x54, 0x7F, 0xFA,
+    0xBB, 0x51, 0xFD, 0xF0, 0x56, 0xD1, 0x72, 0x88, 0xB9, 0x4B, 0x33, 0x49, 0x5C, 0x74, 0x00, 0x3E,
+    0x8F, 0x71, 0x27, 0x38, 0xCA, 0x94, 0x8C, 0x89, 0xD4, 0x26, 0x9A, 0xE0, 0x1B, 0xB7, 0x4E, 0x61,
+    0xF9, 0x2A, 0x31, 0xE7, 0xA2, 0xC4, 0xBC, 0x39, 0x50, 0x7E, 0xAD, 0x65, 0x3E, 0x28, 0x31, 0x8E,
+    0xA5, 0x6A, 0xED, 0xD4, 0xC5, 0x98, 0xD7, 0xE7, 0x24, 0xE5, 0x9A, 0x43, 0xA6, 0xE7, 0x57, 0x2E,
+    0xED, 0x38, 0xC0, 0x57, 0x2E, 0x03, 0x0F, 0xDD, 0x0B, 0xE4, 0xA6, 0x86, 0xE4, 0x65, 0xB7, 0xF1,
+    0x0F, 0xA6, 0xC3, 0x07, 0x29, 0xBB, 0x1F, 0x02, 0xD4, 0xAB, 0xBF, 0x11, 0x51, 0xBA, 0x79, 0x57,
+    0x51, 0x6A, 0xF6, 0x45, 0xC9, 0xB6, 0xF0, 0xEF, 0x5A, 0x72, 0x03, 0x0F, 0xDF, 0x0B, 0x97, 0xA3,
+    0x4A, 0xC1, 0x0B, 0xB7, 0x19, 0xC3, 0x1F, 0x57, 0xB2, 0x92, 0xD3, 0x24, 0x35, 0x01, 0x02, 0x0D,
+    0x34, 0x91, 0x5A, 0x88, 0x79, 0x78, 0x1F, 0x06, 0x54, 0x16, 0xA0, 0xF4, 0x1F, 0x50, 0x35, 0x61,
+    0xE5, 0x17, 0x92, 0x03, 0xD5, 0xC5, 0x04, 0x28, 0x86, 0x3B, 0x56, 0xFB, 0xCA, 0x91, 0xCE, 0x31,
+    0x9D, 0xA6, 0xF4, 0x64, 0x21, 0xCA, 0x56, 0xB1, 0x65, 0x64, 0xDA, 0x38, 0x1B, 0x55, 0xD2, 0xCC,
+    0x41, 0xB8, 0x0E, 0x5F, 0xE0, 0xF0, 0x85, 0x74, 0x22, 0x9D, 0x58, 0x60, 0xA1, 0x69, 0x69, 0xEA,
+    0x07, 0x4F, 0xF3, 0xE0, 0xDD, 0x94, 0xAB, 0xB2, 0xE6, 0x2A, 0xC9, 0xB8, 0x9F, 0x4A, 0x1D, 0xB3,
+    0xAA, 0x5B, 0xAE, 0xC2, 0x84, 0xED, 0xB1, 0x8E, 0x05, 0x62, 0x4A, 0xE2, 0x81, 0xEA, 0x60, 0x22,
+    0x1F, 0x34, 0x90, 0x49, 0x0B, 0x71, 0x45, 0x49, 0xA5, 0x06, 0xF6, 0x65, 0xF0, 0x2F, 0x40, 0x8C,
+    0xFA, 0x0F, 0x9E, 0x91, 0xEA, 0x8D, 0xB1, 0xF7, 0xC8, 0x66, 0xDF, 0xA2, 0x75, 0x6D, 0x3B, 0xB6,
+    0x86, 0x91, 0x5C, 0x5D, 0x65, 0xA6, 0x8F, 0x32, 0x73, 0x9E, 0x74, 0x9C, 0xB0, 0x3F, 0x3A, 0x20,
+    0x33, 0x01, 0xFB, 0xF6, 0x84, 0xBE, 0x1B, 0x53, 0x0C, 0xA6, 0x4A, 0xF2, 0x9D, 0x7E, 0xEC, 0x9A,
+    0xA9, 0x89, 0xA6, 0xD6, 0xC9, 0xA8, 0x47, 0x1F, 0x5D, 0x9F, 0xD4, 0x39, 0x38, 0x7B, 0x10, 0xE1,
+    0x35, 0x85, 0x7F, 0x93, 0x7B, 0x58, 0x84, 0x35, 0xE8, 0x66, 0x77, 0x9D, 0x0E, 0x4E, 0xAE, 0xC1,
+    0x0B, 0xF7, 0xDF, 0x3E, 0x69, 0xC5, 0xC5, 0xC4, 0xFE, 0x32, 0xCE, 0x1D, 0xD5, 0x1F, 0xC5, 0x74,
+    0x9E, 0xB9, 0x5C, 0x77, 0x64, 0xEA, 0x6A, 0x80, 0xEA, 0xE5, 0x05, 0x58, 0x25, 0x07, 0xF2, 0xD1,
+    0x7A, 0x6C, 0x4F, 0xE5, 0xCA, 0x9E, 0xCE, 0x21, 0x9A, 0xD6, 0xA8, 0xCE, 0x26, 0x44, 0xB9, 0x50,
+    0xF6, 0x26, 0xA0, 0x80, 0xB0, 0x63, 0xAE, 0xC9, 0x04, 0xCA, 0xA1, 0xBA, 0xE1, 0x8B, 0x81, 0xE6,
+    0x15, 0x95, 0x43, 0x57, 0x23, 0x3B, 0x35, 0xD7, 0x03, 0x26, 0x74, 0xBD, 0xFE, 0xD8, 0x93, 0xBF,
+    0xA7, 0x54, 0x5D, 0x4B, 0xA1, 0xC9, 0x44, 0x61, 0x73, 0x36, 0xAA, 0xE1, 0x14, 0x72, 0x18, 0x8D,
+    0x54, 0x82, 0x5C, 0x8E, 0x6E, 0x82, 0x62, 0x89, 0xBB, 0xE9, 0x6C, 0x62, 0x8E, 0x62, 0xF0, 0x73,
+    0xCC, 0x1E, 0x6C, 0x1C, 0x50, 0xBC, 0x08, 0x64, 0x6E, 0x17, 0x92, 0x81, 0xCB, 0x77, 0x1B, 0x56,
+    0x40, 0xFE, 0xF6, 0x08, 0xCC, 0x55, 0x0B, 0xF6, 0x95, 0x00, 0x49, 0x28, 0xDC, 0x21, 0xCA, 0x76,
+    0x4E, 0x26, 0x33, 0xDA, 0xA1, 0xEA, 0x2B, 0x3A, 0xAB, 0xCC, 0x67, 0x7F, 0xA6, 0x70, 0x8D, 0xAA,
+    0xD3, 0x8D, 0xDE, 0x48, 0x0A, 0x94, 0xBA, 0x21, 0x97, 0x68, 0xD4, 0x84, 0x5D, 0x32, 0xD5, 0xC8,
+    0x55, 0x9E, 0x7C, 0x4C, 0xB4, 0x9A, 0x28, 0x31, 0x1E, 0xCF, 0x8E, 0x80, 0x7D, 0xB1, 0x06, 0x5B,
+    0x8F, 0x60, 0x57, 0x6A, 0xE0, 0x13, 0xB9, 0x61, 0x06, 0x49, 0x1B, 0x15, 0x28, 0x3B, 0xC1, 0xCE,
+    0x79, 0x18, 0xF3, 0xD6, 0xB4, 0xC9, 0xF0, 0x97, 0x92, 0x44, 0x5E, 0xD5, 0x55, 0x8D, 0x1D, 0x6C,
+    0x4F, 0x36, 0x65, 0x13, 0xA9, 0xD2, 0x05, 0xBA, 0xF6, 0x2E, 0x79, 0xD2, 0xB6, 0x87, 0xE2, 0x7A,
+    0x00, 0x3B, 0x34, 0x35, 0x99, 0xB7, 0x1E, 0x13, 0x92, 0x85, 0x74, 0x8E, 0xCC, 0x5C, 0x36, 0xD1,
+    0xD5, 0xA8, 0x6E, 0x1C, 0x85, 0xAF, 0x7A, 0xCC, 0x5C, 0x78, 0x68, 0x5E, 0x1F, 0xC1, 0x46, 0xBF,
+    0xE9, 0xBC, 0x71, 0xA3, 0xE6, 0x31, 0x8A, 0x65, 0xBB, 0x86, 0xED, 0x63, 0x18, 0xDD, 0xC9, 0xDD,
+    0x16, 0x43, 0xBB, 0xC5, 0x30, 0x59, 0x35, 0x35, 0x0F, 0x90, 0xB7, 0xDB, 0x80, 0xA6, 0x95, 0xFC,
+    0x69, 0x81, 0xBB, 0x29, 0x99, 0xAC, 0x1B, 0x32, 0x89, 0x4A, 0xD2, 0x14, 0x99, 0xF0, 0x34, 0x12,
+    0xBA, 0x60, 0x67, 0x00, 0x79, 0xD6, 0xFD, 0x0A, 0x37, 0xD5, 0x1A, 0xD0, 0xB8, 0x65, 0x28, 0x34,
+    0x11, 0x07, 0x07, 0xD1, 0x25, 0xBF, 0x56, 0x67, 0x20, 0x57, 0x4F, 0xB4, 0xAC, 0x63, 0xF8, 0x57,
+    0x0C, 0x78, 0xCF, 0x24, 0x29, 0x14, 0x5A, 0xD3, 0x9A, 0xE2, 0xF2, 0x1E, 0xD3, 0x1C, 0xA4, 0xD5,
+    0x89, 0xBD, 0xD9, 0x4B, 0xC1, 0xC7, 0x7E, 0x98, 0x3B, 0x2F, 0x51, 0x26, 0xCE, 0x89, 0xC1, 0x48,
+    0x73, 0x34, 0x69, 0x8A, 0x01, 0xBA, 0x96, 0x74, 0x89, 0xC6, 0x4C, 0x35, 0x80, 0x5A, 0xCC, 0x12,
+    0xA1, 0xAC, 0xDE, 0xBD, 0x74, 0xA1, 0x8A, 0x66, 0xC9, 0xD8, 0x48, 0x61, 0x1B, 0x3F, 0xBE, 0x6F,
+    0x4E, 0xAF, 0x56, 0xF6, 0x9D, 0x42, 0xF2, 0x0F, 0xEE, 0x58, 0x64, 0xB5, 0x26, 0x42, 0x46, 0xAD,
+    0x47, 0xFD, 0xAD, 0x20, 0xB1, 0x0F, 0x52, 0xBD, 0x01, 0x29, 0xE2, 0x75, 0x10, 0xA4, 0xB0, 0x0F,
+    0xD2, 0xBC, 0x0F, 0x52, 0xC4, 0xCB, 0x47, 0x5A, 0x48, 0x7A, 0x59, 0x5A, 0x73, 0x7F, 0x62, 0x0A,
+    0x58, 0xCC, 0x8F, 0x91, 0x27, 0x5B, 0xA3, 0x8E, 0xF3, 0xF1, 0xAE, 0xB9, 0x3F, 0x1F, 0x1B, 0xA1,
+    0xBF, 0x46, 0x5A, 0xC3, 0xE7, 0xB9, 0x02, 0x14, 0xB6, 0x8D, 0x1B, 0x1C, 0x6D, 0x77, 0x53, 0x3A,
+    0xF9, 0x57, 0x49, 0xAE, 0x20, 0x75, 0x69, 0xCF, 0x15, 0x5B, 0x53, 0x5E, 0x8D, 0xA8, 0x99, 0xE1,
+    0x8E, 0xD6, 0xF5, 0xC7, 0x97, 0x2B, 0xEC, 0x64, 0xE4, 0xE6, 0x4F, 0x17, 0x6D, 0xEA, 0xA9, 0x30,
+    0x9E, 0x1D, 0xCC, 0x5A, 0xBB, 0xE5, 0xD2, 0x90, 0x79, 0x1A, 0xB2, 0x91, 0xA6, 0xCE, 0xC6, 0xD5,
+    0x7B, 0x31, 0x61, 0x3D, 0x49, 0xBD, 0xDD, 0x27, 0x92, 0x93, 0xD0, 0x91, 0xA8, 0xCD, 0xAE, 0x0F,
+    0x9F, 0xE7, 0x99, 0x2F, 0x70, 0x4F, 0xEE, 0x1E, 0xF9, 0xD7, 0xEE, 0x5F, 0x5C, 0xBF, 0xFE, 0xBF,
+    0x66, 0xF3, 0x89, 0x2C, 0x0E, 0x8F, 0x07, 0x1E, 0x93, 0x42, 0x25, 0x6D, 0x85, 0xF7, 0x1B, 0x2F,
+    0x4A, 0x8F, 0x6F, 0x37, 0x2E, 0x7B, 0x89, 0xA3, 0xCF, 0xF0, 0xB9, 0x53, 0xEC, 0x96, 0x9A, 0x72,
+    0x0D, 0xFC, 0x90, 0xCD, 0xEE, 0x8E, 0xB7, 0x6F, 0xE3, 0x59, 0x0E, 0xCF, 0x0E, 0xA6, 0x7D, 0xC6,
+    0xB4, 0x90, 0xF7, 0x97, 0x7F, 0xF4, 0xE8, 0xBF, 0xCD, 0x8B, 0xF1, 0xC1, 0x1A, 0xEB, 0xB0, 0x2E,
+    0xF3, 0x64, 0xC3, 0x46, 0x03, 0x4B, 0x16, 0xEE, 0x87, 0xFB, 0xE1, 0x04, 0x9F, 0xB3, 0x8C, 0xE6,
+    0xA7, 0x3D, 0xAA, 0x39, 0x0F, 0x0F, 0xC7, 0xFB, 0xE9, 0x44, 0x3A, 0x92, 0x7B, 0xF2, 0x81, 0xA2,
+    0xA7, 0xEC, 0xF9, 0x66, 0xCD, 0x37, 0xEB, 0xEE, 0x0D, 0x3D, 0x3E, 0xDB, 0xA9, 0x1C, 0x1A, 0xA7,
+    0xC7, 0x22, 0xBD, 0x15, 0xEC, 0x64, 0xC7, 0xC2, 0x17, 0xBE, 0x1C, 0xAA, 0xBE, 0x71, 0xA4, 0x7A,
+    0x62, 0xB6, 0x63, 0x35, 0x34, 0xAD, 0xCC, 0x9C, 0x4F, 0x69, 0xFD, 0x93, 0x3F, 0x5C, 0x4C, 0x3B,
+    0xF0, 0xF5, 0x47, 0xF2, 0xA7, 0x96, 0xCB, 0x8F, 0xC0, 0xB5, 0xEF, 0x9F, 0xEE, 0x34, 0x1F, 0x3A,
+    0x73, 0x15, 0x4E, 0xC1, 0x29, 0xD8, 0x81, 0x9D, 0xA3, 0x47, 0x8E, 0x7E, 0xEE, 0xCA, 0xD7, 0x3F,
+    0xF7, 0x6F, 0x1E, 0x3E, 0x79, 0xDF, 0x61, 0x1E, 0xE2, 0x5B, 0x65, 0xF8, 0xC6, 0xC5, 0xEE, 0x17,
+    0xD7, 0xDA, 0x6F, 0x25, 0x2E, 0x01, 0xBE, 0x7E, 0x38, 0x5F, 0x0E, 0xF3, 0xF5, 0x2D, 0x5A, 0x6B,
+    0xAC, 0x70, 0xF1, 0xF8, 0x54, 0x5D, 0x0F, 0x8D, 0x2B, 0xDB, 0xF2, 0xB9, 0x60, 0xA6, 0xCA, 0x55,
+    0xAF, 0x86, 0x2C, 0x34, 0xAE, 0x71, 0x07, 0x7B, 0x7F, 0x7B, 0x1B, 0x39, 0xB8, 0x2F, 0x66, 0x5A,
+    0x0F, 0x27, 0x33, 0x2E, 0x67, 0x73, 0x3E, 0x70, 0x72, 0x77, 0x77, 0x77, 0x6F, 0x6F, 0xEF, 0x07,
+    0x97, 0x2E, 0x9D, 0xD5, 0xCF, 0xEB, 0x3F, 0xEC, 0x3F, 0xFF, 0xC2, 0xE1, 0xFA, 0x0B, 0xDC, 0xF3,
+    0x79, 0x9E, 0xC9, 0xAE, 0x0F, 0x89, 0x5A, 0x3A, 0x38, 0x09, 0x47, 0x20, 0xEF, 0xC9, 0x02, 0xD9,
+    0xBF, 0x77, 0x59, 0xBB, 0x9B, 0xD7, 0xA9, 0xBB, 0xC3, 0x7B, 0xDD, 0xDF, 0xCB, 0xB4, 0x54, 0x68,
+    0xE2, 0xB8, 0xB8, 0xF5, 0x5B, 0x07, 0x76, 0x47, 0xBD, 0x78, 0xF1, 0xB5, 0x7F, 0x59, 0x9F, 0x4E,
+    0xFE, 0x87, 0xE4, 0xE7, 0xF5, 0x1F, 0xBE, 0x7B, 0xAD, 0x53, 0x0B, 0xA5, 0xFE, 0x0D, 0xFF, 0x55,
+    0x7B, 0xEF, 0x45, 0xF3, 0x30, 0xAF, 0xC9, 0x9F, 0x79, 0xF2, 0xF8, 0x3D, 0x0F, 0x9D, 0xF8, 0x3F,
+    0xEF, 0xFD, 0x2F, 0x9F, 0x3B, 0x72, 0xF1, 0x95, 0xF6, 0xBE, 0xD3, 0x5F, 0x38, 0xFD, 0x3F, 0x71,
+    0xD9, 0xF4, 0xBF, 0xFD, 0xCA, 0x2B, 0xB7, 0x3F, 0xFD, 0xE2, 0xDE, 0x67, 0x1E, 0x3A, 0x0D, 0x17,
+    0xE3, 0xB6, 0x97, 0x3D, 0xEC, 0x81, 0x6D, 0x0F, 0x6C, 0x96, 0x70, 0xBB, 0xEC, 0x1C, 0xEC, 0x33,
+    0x24, 0x69, 0xA7, 0xD0, 0x48, 0x2F, 0x3F, 0x79, 0x87, 0x3C, 0xD9, 0x57, 0xD7, 0x9D, 0xC8, 0x4E,
+    0xF2, 0x2B, 0x6F, 0xDE, 0x74, 0xC5, 0xD3, 0x9C, 0xDB, 0x4B, 0xFE, 0x3F, 0x9F, 0xFF, 0x7B, 0x57,
+    0x7E, 0x83, 0x3F, 0xF8, 0xEF, 0x9F, 0x2C, 0xF5, 0x9A, 0x3C, 0x81, 0xAA, 0xB6, 0x7D, 0x7A, 0x11,
+    0x4E, 0x63, 0xE0, 0x21, 0xB8, 0x88, 0xA9, 0xCB, 0x87, 0xFE, 0xF9, 0x8D, 0x7F, 0xF2, 0xBA, 0xFD,
+    0x1B, 0x27, 0x8A, 0x71, 0xE8, 0x5A, 0xD3, 0xF2, 0x19, 0xF8, 0x16, 0xB1, 0x64, 0x3F, 0xA2, 0x37,
+    0x1F, 0xD8, 0x50, 0x44, 0x58, 0x4F, 0xAA, 0x11, 0x66, 0xFB, 0x6E, 0x57, 0x33, 0x57, 0xCE, 0x8E,
+    0x49, 0xA8, 0xDA, 0x44, 0x2F, 0x4E, 0x4D, 0xCB, 0x31, 0x5D, 0xB8, 0xF3, 0x6F, 0x36, 0xBB, 0x69,
+    0x90, 0x3C, 0xF6, 0xEE, 0x88, 0x9F, 0x6C, 0xBD, 0x7B, 0x2E, 0x19, 0x77, 0xCA, 0x38, 0x67, 0x7D,
+    0x63, 0x1B, 0x69, 0x65, 0xE4, 0xCC, 0x75, 0xBF, 0x97, 0xF8, 0x31, 0x77, 0x7B, 0xE7, 0xB8, 0x36,
+    0xFF, 0xD6, 0xC6, 0x31, 0xB3, 0x6A, 0xBB, 0x75, 0x4D, 0x97, 0xC1, 0xFD, 0x95, 0x83, 0xBF, 0xBE,
+    0xDE, 0xBC, 0x7F, 0xF7, 0xB3, 0xF7, 0x9F, 0x06, 0xF8, 0xF4, 0x57, 0x00, 0xBE, 0x72, 0x34, 0x06,
+    0xBD, 0xDC, 0x24, 0x39, 0x0F, 0xC7, 0x0E, 0x50, 0xFA, 0x0F, 0x6A, 0xB9, 0x40, 0x72, 0xB3, 0x4E,
+    0xAE, 0x45, 0x8F, 0x65, 0x7F, 0x02, 0xE0, 0x2B, 0x5F, 0x07, 0xB8, 0xF7, 0xC0, 0x53, 0x3E, 0xB5,
+    0x31, 0x2B, 0x3B, 0x49, 0xD2, 0x14, 0x8B, 0xC0, 0xBE, 0x13, 0x62, 0x8B, 0xD0, 0x36, 0x38, 0xCE,
+    0xF6, 0xB1, 0xBB, 0xF9, 0xFB, 0xC2, 0x54, 0xCE, 0x9C, 0x39, 0xF3, 0xB7, 0xD6, 0x2D, 0x91, 0xEF,
+    0x12, 0x45, 0x7C, 0xF3, 0xCC, 0x99, 0x5C, 0x9A, 0x4B, 0x69, 0xBC, 0xF3, 0xBF, 0x7E, 0x55, 0x52,
+    0x19, 0xE5, 0xF2, 0xCF, 0xD6, 0x0D, 0xE9, 0xB8, 0x1F, 0x2B, 0x49, 0x71, 0x85, 0xA8, 0xE3, 0xA6,
+    0x4B, 0x77, 0xBF, 0x5E, 0xBB, 0xED, 0xDA, 0xBD, 0x38, 0x47, 0x81, 0x77, 0xA0, 0xBE, 0xF0, 0x20,
+    0xD2, 0x89, 0x68, 0xB9, 0x31, 0xC3, 0x1E, 0xCC, 0xB0, 0x0B, 0x01, 0x76, 0xF7, 0xEF, 0x24, 0x01,
+    0x66, 0xAA, 0x09, 0x16, 0x2A, 0x0F, 0x0B, 0x55, 0x0B, 0xBF, 0xB7, 0xEF, 0x59, 0x1A, 0xA3, 0xB9,
+    0x53, 0xDD, 0x6D, 0x49, 0x7B, 0xE0, 0xCC, 0x99, 0xBF, 0x29, 0xE9, 0xA7, 0x92, 0xFE, 0xD8, 0x41,
+    0xDC, 0xD9, 0x26, 0xE6, 0xFD, 0xDC, 0xE1, 0x63, 0x4D, 0x3A, 0xC7, 0x55, 0xA6, 0xEC, 0xA1, 0xAB,
+    0xB7, 0x8B, 0x47, 0xB9, 0xBF, 0x96, 0x6C, 0xB9, 0xF3, 0x0B, 0xD0, 0x68, 0x26, 0x5D, 0x1E, 0xED,
+    0xEA, 0xDC, 0xC7, 0x6D, 0x38, 0x33, 0x5F, 0xD5, 0xA4, 0x53, 0x05, 0xBC, 0x70, 0x6D, 0x0B, 0x88,
+    0x24, 0x77, 0xE0, 0x12, 0xB6, 0xDC, 0x6E, 0x24, 0x34, 0x7B, 0x0E, 0xFF, 0xB0, 0x59, 0xFE, 0x8F,
+    0x2E, 0x54, 0x8A, 0xFB, 0x35, 0x6B, 0xB2, 0x92, 0x7C, 0x4C, 0xF0, 0xFA, 0x9D, 0x7D, 0x56, 0xFF,
+    0x93, 0xE9, 0xC6, 0x01, 0xB8, 0xF4, 0xD5, 0xB1, 0xFB, 0xEA, 0xD8, 0x3C, 0xF1, 0xFE, 0xBF, 0xE7,
+    0xA7, 0xE6, 0xF9, 0xA9, 0x79, 0x2D, 0x74, 0xAF, 0x05, 0xBD, 0x1E, 0xE4, 0xCA, 0xB6, 0x5A, 0xE7,
+    0x9D, 0xCD, 0x54, 0x7D, 0xFB, 0x0B, 0x7B, 0xF0, 0xC2, 0xC1, 0x54, 0x93, 0xE2, 0x23, 0xA4, 0x9A,
+    0x0C, 0xEF, 0x4B, 0x35, 0xD9, 0xE6, 0x98, 0xA4, 0xFB, 0x39, 0x26, 0x95, 0xE7, 0xFF, 0x07, 0xC5,
+    0xBC, 0x5F, 0xAC, 0xE6, 0xC6, 0x99, 0xE6, 0xF7, 0x23, 0xCB, 0x6A, 0x8E, 0x45, 0x4B, 0xA5, 0x0B,
+    0x29, 0x99, 0xB5, 0x24, 0x73, 0x02, 0x4C, 0x00, 0xCF, 0x6C, 0xAB, 0x69, 0x60, 0x7D, 0x21, 0x20,
+    0xA7, 0x4F, 0xD1, 0x16, 0x02, 0x05, 0x71, 0x76, 0xDD, 0x9B, 0xE8, 0x0C, 0x82, 0x18, 0x89, 0x8C,
+    0x60, 0x03, 0xEC, 0x38, 0x83, 0x69, 0x5F, 0x38, 0x80, 0x12, 0x9C, 0x3E, 0xA4, 0x2D, 0x20, 0xBA,
+    0x30, 0x10, 0x77, 0xB2, 0xEB, 0x04, 0xC8, 0x8D, 0x1A, 0x81, 0x67, 0x63, 0xCB, 0x01, 0xD4, 0x1B,
+    0x34, 0x10, 0xED, 0xE4, 0x74, 0xB3, 0xEC, 0x46, 0x22, 0x60, 0x85, 0x40, 0xB4, 0x27, 0x13, 0x5D,
+    0xF8, 0x42, 0xF4, 0x58, 0x5E, 0x4D, 0xEC, 0x0B, 0x95, 0x64, 0x6A, 0xCC, 0x56, 0x17, 0xF9, 0xE4,
+    0xA2, 0xF8, 0x9D, 0xEE, 0xD6, 0xBF, 0xD1, 0xEE, 0x4C, 0x30, 0xDF, 0x61, 0x55, 0x91, 0x1F, 0xBF,
+    0x43, 0xB2, 0x8A, 0x55, 0x6F, 0xBD, 0xEF, 0xF3, 0x3E, 0x6F, 0x91, 0x7D, 0x8F, 0x7C, 0x21, 0x5F,
+    0x30, 0x69, 0x8B, 0x1F, 0xBA, 0xCD, 0xDB, 0x56, 0xA4, 0x6D, 0xBA, 0xB5, 0x95, 0x01, 0x1B, 0xEE,
+    0x6B, 0x43, 0xAB, 0xB1, 0xD5, 0xD0, 0xAA, 0x6B, 0x57, 0xDA, 0xD7, 0x48, 0x9F, 0xBB, 0x1A, 0x40,
+    0x92, 0xBF, 0x55, 0x4C, 0x14, 0xEF, 0x2D, 0xC2, 0x07, 0x14, 0x7A, 0x27, 0x15, 0x1A, 0x09, 0x14,
+    0x3E, 0x9F, 0xB3, 0x40, 0x31, 0x70, 0x21, 0x15, 0xFB, 0xA9, 0xA8, 0xF3, 0x91, 0xF2, 0xA4, 0x70,
+    0x66, 0xA4, 0x1C, 0xB2, 0xD5, 0x8C, 0x94, 0xD2, 0x52, 0x0C, 0x94, 0x52, 0x74, 0x03, 0xA5, 0x14,
+    0x5A, 0x4F, 0xA9, 0xB5, 0xF9, 0x37, 0xD3, 0xD3, 0xDD, 0x0F, 0x40, 0x16, 0xE0, 0x05, 0x28, 0x3C,
+    0xF9, 0x08, 0x15, 0x94, 0x1E, 0x0E, 0xA1, 0x4E, 0xA7, 0x8E, 0xD3, 0xA9, 0xF0, 0xEE, 0x53, 0x92,
+    0xA4, 0x4B, 0x85, 0x24, 0x69, 0xAA, 0xC0, 0xFA, 0x62, 0x3A, 0x84, 0x9A, 0xFC, 0xCD, 0x00, 0x11,
+    0xF3, 0x8A, 0xC7, 0x04, 0xEC, 0x93, 0x60, 0x3D, 0xFB, 0x87, 0xE0, 0xC8, 0x6E, 0x04, 0x88, 0x54,
+    0xAF, 0x78, 0x8C, 0xA4, 0x0A, 0xAC, 0x34, 0x1D, 0x82, 0x93, 0xBE, 0x1E, 0x40, 0xBA, 0x44, 0x2B,
+    0x49, 0xFE, 0xF6, 0xFC, 0x2B, 0x4F, 0xB8, 0xEE, 0xA0, 0x01, 0xD7, 0xC1, 0x49, 0xDE, 0xBC, 0x27,
+    0xFF, 0xE6, 0x0A, 0x38, 0xC9, 0x43, 0x2B, 0x05, 0x68, 0xE7, 0x62, 0x82, 0x76, 0xC8, 0x66, 0x68,
+    0x3D, 0x11, 0xDA, 0x8E, 0x63, 0xE8, 0x53, 0xEE, 0xEF, 0xC8, 0xE3, 0x6D, 0xF9, 0x02, 0xDA, 0xF2,
+    0xEC, 0x24, 0xFF, 0x38, 0xC0, 0x23, 0x00, 0x7B, 0x00, 0x2F, 0x00, 0x4C, 0x40, 0x1E, 0x78, 0xDF,
+    0x4F, 0x11, 0x32, 0x51, 0x04, 0xB3, 0x50, 0x86, 0x62, 0xA6, 0x0C, 0x36, 0x50, 0x86, 0x7A, 0xC4,
+    0x86, 0xD6, 0x63, 0x47, 0x35, 0xD8, 0x9F, 0xAE, 0x60, 0x7F, 0x16, 0xC1, 0xFE, 0x72, 0x06, 0xAB,
+    0x00, 0x95, 0x06, 0xA8, 0xD4, 0x41, 0xA5, 0x06, 0x6A, 0x79, 0xA8, 0x15, 0xA0, 0x56, 0x04, 0xF7,
+    0xB2, 0xC0, 0x5D, 0x97, 0xC7, 0xFD, 0x40, 0x01, 0xE7, 0xFB, 0x88, 0xF3, 0x4E, 0xB4, 0xDE, 0xCA,
+    0xB7, 0xBE, 0x50, 0x68, 0x7D, 0xAE, 0xC8, 0x3F, 0x04, 0xB0, 0x03, 0xC0, 0x0A, 0x60, 0x03, 0xC0,
+    0x57, 0xDE, 0xFB, 0x98, 0x5F, 0x01, 0xA8, 0x06, 0x50, 0x31, 0x41, 0xFF, 0x83, 0x05, 0x5C, 0x70,
+    0x1D, 0x75, 0xB4, 0x23, 0x56, 0x8F, 0xCD, 0x94, 0x1A, 0x84, 0xD1, 0xE4, 0x7C, 0xBE, 0xAE, 0x36,
+    0xA0, 0xF6, 0xE9, 0x48, 0xFB, 0xEC, 0x28, 0xDC, 0x8B, 0xD1, 0xF9, 0xEA, 0xA7, 0xB2, 0x93, 0x0D,
+    0xED, 0x0F, 0x97, 0x62, 0xAE, 0x42, 0xFF, 0x58, 0x2C, 0x62, 0xFD, 0xA3, 0x35, 0x53, 0x39, 0x8B,
+    0xF6, 0xC7, 0x6B, 0xDB, 0x55, 0x53, 0xDB, 0xFB, 0x62, 0xA9, 0x34, 0x66, 0x7A, 0x46, 0x13, 0xED,
+    0x4F, 0x15, 0xA9, 0x66, 0xB7, 0x50, 0xC8, 0x8A, 0x4C, 0x3E, 0x6F, 0xB8, 0x64, 0x3C, 0xC1, 0x0C,
+    0xF9, 0x98, 0x49, 0x9E, 0x5E, 0x0D, 0xE5, 0xFC, 0x9E, 0x67, 0x3D, 0x86, 0x0B, 0x47, 0x70, 0xEC,
+    0x20, 0x56, 0x5D, 0x36, 0xDB, 0x21, 0x9F, 0x8B, 0x60, 0x26, 0x33, 0x9B, 0x90, 0xC5, 0x32, 0xB0,
+    0xDA, 0x91, 0xF6, 0x8B, 0x03, 0xEE, 0x55, 0x4F, 0x25, 0x8F, 0x55, 0x47, 0xA1, 0x06, 0x23, 0xC8,
+    0x05, 0xD9, 0x0A, 0x66, 0x81, 0x22, 0x42, 0x3D, 0x53, 0x2B, 0xE0, 0xE4, 0x71, 0x2B, 0xB8, 0x11,
+    0x9E, 0x80, 0x07, 0xEA, 0x86, 0xF2, 0x27, 0x03, 0xF9, 0x5F, 0x4C, 0x70, 0xF5, 0x2A, 0xD4, 0xE7,
+    0xFF, 0x15, 0xBF, 0x90, 0xF4, 0x17, 0x92, 0x96, 0x5E, 0x52, 0xC3, 0x0C, 0xEC, 0x03, 0xB6, 0x03,
+    0x33, 0x02, 0x33, 0xF0, 0x40, 0xAA, 0x56, 0x36, 0x03, 0xED, 0xF6, 0xBE, 0xCC, 0xCC, 0x07, 0x7E,
+    0x1E, 0x9C, 0x41, 0x6A, 0xCC, 0x6C, 0x06, 0xEB, 0x09, 0x15, 0x1C, 0xEE, 0xF3, 0x7B, 0xC7, 0x4E,
+    0x5A, 0x5A, 0xE9, 0xFF, 0xBD, 0xDA, 0xC0, 0x05, 0xE0, 0x68, 0x1B, 0x25, 0x6E, 0xE2, 0x37, 0xAD,
+    0x14, 0x0B, 0x29, 0x66, 0x52, 0xE4, 0xC1, 0xB5, 0xC3, 0x01, 0x29, 0xDB, 0x07, 0x70, 0x82, 0x5E,
+    0x2B, 0xF4, 0x2B, 0xC0, 0x59, 0x48, 0xD7, 0xD8, 0xB2, 0x7A, 0x86, 0x6B, 0x52, 0x43, 0x2F, 0x79,
+    0xFA, 0xB1, 0x1A, 0xE8, 0x9B, 0x62, 0x44, 0x98, 0xC0, 0x4A, 0x1E, 0x58, 0xDE, 0x9D, 0x99, 0x94,
+    0x65, 0x0B, 0x66, 0xCA, 0x16, 0x4C, 0xCC, 0x56, 0x8A, 0x25, 0x5F, 0xB1, 0x2B, 0xD0, 0x47, 0x40,
+    0x13, 0x20, 0x0F, 0xDC, 0x80, 0x53, 0x0D, 0x4C, 0x50, 0xA5, 0x76, 0xB9, 0x00, 0xD6, 0xDF, 0x3E,
+    0x8A, 0xA4, 0xD8, 0x4A, 0x2F, 0x8E, 0x70, 0x04, 0x65, 0x80, 0xFE, 0x83, 0x8A, 0x09, 0xFA, 0x26,
+    0x15, 0x5D, 0x12, 0xBD, 0xB9, 0x46, 0xF6, 0xB3, 0xC9, 0x0C, 0x59, 0xA8, 0xC8, 0xC7, 0x09, 0x8C,
+    0x07, 0xAB, 0x88, 0x53, 0x20, 0x80, 0x19, 0xC0, 0x0E, 0xD9, 0x77, 0x6B, 0x29, 0xB4, 0x52, 0xD7,
+    0x2B, 0x52, 0xAF, 0x0D, 0x00, 0xE7, 0xD7, 0xC6, 0x6A, 0xE1, 0xDA, 0xE7, 0xCE, 0x19, 0x0F, 0x76,
+    0x93, 0x33, 0xFD, 0x6B, 0xA9, 0xA9, 0x6A, 0x75, 0x64, 0x7D, 0x07, 0x3D, 0xAF, 0x15, 0xD1, 0x4A,
+    0x41, 0xD2, 0xD3, 0x52, 0xCC, 0xFA, 0xB5, 0xA9, 0x1F, 0x9B, 0xDD, 0x33, 0xB1, 0xDF, 0xEA, 0x71,
+    0xAE, 0xCE, 0x43, 0x9D, 0x8F, 0x67, 0xF2, 0x50, 0xE7, 0xC1, 0x99, 0xDD, 0xF6, 0xF8, 0x64, 0xBD,
+    0xFD, 0x41, 0xCC, 0x62, 0x3D, 0xD4, 0x7F, 0xB2, 0x98, 0xC5, 0x8D, 0x6E, 0x7C, 0x6F, 0x7F, 0x2F,
+    0x7D, 0x2A, 0x3A, 0x78, 0xE1, 0xD6, 0x91, 0x87, 0x98, 0x1A, 0xEA, 0xCE, 0x62, 0x49, 0x43, 0x39,
+    0x4F, 0xB3, 0x55, 0xA4, 0x88, 0x14, 0xF1, 0xB6, 0x0B, 0x9E, 0x23, 0x9B, 0xC8, 0x26, 0xB2, 0x40,
+    0x16, 0xC8, 0x3F, 0x60, 0x33, 0xE3, 0x1D, 0x5B, 0x31, 0x60, 0x07, 0x5A, 0x5F, 0xC9, 0x3B, 0xD1,
+    0x7E, 0x07, 0xC0, 0x48, 0x60, 0x7E, 0xF1, 0x3C, 0x98, 0xC6, 0xDE, 0x91, 0x61, 0x9F, 0xA0, 0xC0,
+    0x6A, 0x28, 0xB0, 0x5C, 0x29, 0xB0, 0xEC, 0x95, 0x58, 0x4E, 0x9F, 0x64, 0x7B, 0x16, 0xFB, 0x5C,
+    0xDC, 0xC7, 0x6A, 0x3A, 0xC4, 0xAA, 0x03, 0xE0, 0x32, 0xBF, 0x49, 0xEE, 0xB9, 0x4C, 0x49, 0xEE,
+    0x39, 0x4D, 0x09, 0x97, 0x39, 0xBD, 0x7D, 0x25, 0x69, 0x3C, 0xF3, 0xDC, 0xF3, 0x07, 0xD3, 0x65,
+    0xF6, 0x78, 0xCB, 0x13, 0xB2, 0x9F, 0x60, 0x7C, 0xF1, 0x07, 0x58, 0xCE, 0x5E, 0x66, 0xFF, 0xFB,
+    0x6F, 0x79, 0xA4, 0x6F, 0x62, 0xF4, 0xDA, 0xD6, 0xB3, 0x23, 0xDB, 0x20, 0xB3, 0xF2, 0xF4, 0x5A,
+    0xC9, 0x35, 0x93, 0xDE, 0x36, 0x55, 0xB3, 0x75, 0xEE, 0x6C, 0xEA, 0x47, 0xCA, 0x37, 0x34, 0x51,
+    0x4B, 0x81, 0x7E, 0xAC, 0x86, 0x7C, 0xA1, 0xEA, 0x6C, 0xC0, 0xE1, 0x3A, 0x8E, 0x59, 0xC8, 0x83,
+    0x99, 0x28, 0xBD, 0x1D, 0xA8, 0x71, 0x0D, 0x91, 0x05, 0x13, 0x8A, 0x09, 0x3B, 0x54, 0x03, 0xAE,
+    0x69, 0xBB, 0x6C, 0xC9, 0x57, 0x8A, 0x89, 0x6C, 0x4C, 0x5D, 0xE4, 0x30, 0xDD, 0xB8, 0x02, 0xBE,
+    0x7B, 0xC7, 0xAB, 0xDC, 0x27, 0x32, 0xD9, 0xA1, 0x18, 0xAE, 0x51, 0x3D, 0x1E, 0xB8, 0xEA, 0x9A,
+    0xFC, 0xAD, 0x99, 0xF2, 0x55, 0x8F, 0x5B, 0x40, 0x23, 0x46, 0x1D, 0x56, 0x1D, 0xAE, 0xF7, 0x59,
+    0x94, 0x2F, 0x82, 0x7C, 0xD5, 0xC9, 0x5F, 0xCB, 0xF4, 0xC3, 0x39, 0xD7, 0x00, 0x90, 0x4F, 0xC0,
+    0x35, 0xA0, 0xF2, 0x50, 0x4C, 0x77, 0x5C, 0xFF, 0x3E, 0xE0, 0x18, 0x33, 0x1F, 0x53, 0xCE, 0xC7,
+    0xD8, 0x78, 0x8C, 0x3B, 0x3C, 0xE6, 0xC2, 0xE1, 0x31, 0xF3, 0xE1, 0x71, 0x1E, 0x8E, 0x8F, 0x8B,
+    0xE1, 0xF8, 0xD8, 0xFA, 0xE3, 0xE3, 0x9A, 0xE3, 0xE3, 0x23, 0xE2, 0x71, 0x24, 0x5E, 0x9B, 0x88,
+    0xFD, 0x48, 0xEC, 0x3D, 0xB1, 0x6F, 0x88, 0xC6, 0x73, 0xC5, 0x78, 0x42, 0x3E, 0xE5, 0x01, 0xC9,
+    0xE3, 0xD4, 0x70, 0xEA, 0x3B, 0x1F, 0x28, 0x8E, 0x8E, 0xC0, 0x39, 0x38, 0xAA, 0x3A, 0xAE, 0xDA,
+    0x81, 0x58, 0x04, 0xA2, 0x99, 0xF2, 0x39, 0x8B, 0x66, 0x62, 0x35, 0x81, 0xF6, 0xF1, 0x80, 0x7B,
+    0x79, 0xA4, 0x7A, 0x63, 0xC4, 0x6A, 0xA0, 0x90, 0xC7, 0xC8, 0x93, 0xA9, 0x03, 0x35, 0x20, 0xC8,
+    0x04, 0xC5, 0x02, 0xE7, 0x23, 0xB5, 0x02, 0xB5, 0x3C, 0xF5, 0x0A, 0xF5, 0x45, 0x38, 0xC4, 0x3E,
+    0x89, 0x79, 0xC5, 0xF3, 0x76, 0xE0, 0xEC, 0x87, 0x1F, 0x48, 0xAF, 0x48, 0x13, 0x5F, 0x83, 0x87,
+    0xA1, 0x68, 0xC8, 0x86, 0xAD, 0xBF, 0x27, 0x89, 0x22, 0x45, 0x23, 0x29, 0xA9, 0x60, 0x87, 0xA4,
+    0x17, 0x54, 0x78, 0xC8, 0x26, 0xA0, 0x6D, 0xA0, 0xD2, 0x4A, 0xA1, 0xEF, 0x4F, 0xD9, 0x42, 0x45,
+    0x4B, 0x3E, 0x54, 0x9E, 0xA7, 0x8A, 0x40, 0x95, 0x2D, 0xD8, 0xCE, 0xBD, 0xD3, 0x8F, 0x56, 0x9A,
+    0x73, 0x69, 0xC1, 0x49, 0xE4, 0x5A, 0x53, 0x1B, 0x5C, 0xDA, 0x7A, 0x53, 0xD5, 0x40, 0x31, 0x24,
+    0x8D, 0xA9, 0x96, 0x86, 0x52, 0x9A, 0xF9, 0xD2, 0x9F, 0x3E, 0xB1, 0x09, 0xF7, 0xF7, 0xB9, 0xC3,
+    0x58, 0x79, 0x1E, 0xDD, 0xEE, 0x50, 0x79, 0xB7, 0x6A, 0xB4, 0xD2, 0x6C, 0x76, 0x77, 0xC8, 0x0E,
+    0x9E, 0xC0, 0x4A, 0x52, 0x70, 0x92, 0xE4, 0x25, 0x49, 0xB9, 0x1A, 0xEA, 0x39, 0x17, 0x99, 0xBA,
+    0x5C, 0xD8, 0x99, 0x7C, 0x45, 0x1D, 0xF9, 0x62, 0x27, 0xC8, 0x63, 0xDF, 0x40, 0xAE, 0x09, 0xE8,
+    0x75, 0x03, 0xEC, 0xEB, 0x37, 0x56, 0x88, 0x76, 0xB8, 0x4A, 0x39, 0xB8, 0x26, 0xE2, 0x58, 0xB2,
+    0x39, 0x9B, 0xF2, 0xC9, 0x84, 0xD2, 0x97, 0x43, 0xE9, 0x1D, 0x75, 0x53, 0x7D, 0x6E, 0xE6, 0x2A,
+    0xAE, 0x1C, 0xF3, 0x89, 0xE8, 0x1A, 0x3B, 0x9A, 0xB9, 0x96, 0xD6, 0x52, 0x52, 0xB7, 0x50, 0x7B,
+    0xEB, 0x2B, 0x4F, 0xB4, 0x9E, 0xEA, 0x5B, 0x9E, 0x4C, 0x9E, 0x5C, 0x37, 0x30, 0x7F, 0xF2, 0xE3,
+    0x21, 0x1B, 0xA7, 0x3D, 0xC2, 0x23, 0x45, 0xB7, 0x57, 0x36, 0xE1, 0x4C, 0x3E, 0xEC, 0xD9, 0xE6,
+    0x4A, 0xF9, 0xB8, 0xDF, 0xCF, 0x43, 0xBE, 0x36, 0x44, 0xA3, 0x19, 0x67, 0x66, 0xD7, 0x59, 0x1F,
+    0xCD, 0x5C, 0x8C, 0x2D, 0xEE, 0x97, 0x53, 0xF5, 0xF5, 0x5E, 0xF3, 0xA9, 0x7F, 0x24, 0xCD, 0x14,
+    0x92, 0x1A, 0xB3, 0x36, 0xE7, 0x27, 0xB3, 0x80, 0x92, 0xF0, 0xEA, 0xC1, 0xCC, 0xAE, 0x83, 0xDE,
+    0x8E, 0x50, 0x5F, 0x9F, 0xA0, 0x08, 0x0B, 0x64, 0x8B, 0xEB, 0xA0, 0xFD, 0xE2, 0x08, 0xF5, 0xF5,
+    0x08, 0x36, 0xA8, 0xA1, 0x88, 0xD5, 0x0D, 0x1E, 0x5C, 0x8C, 0x24, 0xD1, 0x4A, 0x6A, 0x4A, 0x49,
+    0x1D, 0xBD, 0xD4, 0x51, 0x48, 0x0D, 0x9C, 0xFA, 0x0E, 0x64, 0x17, 0xF9, 0x07, 0x75, 0xE4, 0x85,
+    0xFD, 0xAA, 0xB9, 0x72, 0x5C, 0xFE, 0x68, 0x3A, 0x2E, 0x14, 0x5E, 0x90, 0x7C, 0x21, 0x8D, 0x76,
+    0x28, 0xA6, 0x1A, 0xE2, 0x3E, 0x5C, 0xBD, 0x00, 0x47, 0x17, 0x60, 0xFF, 0x2A, 0x1C, 0x1D, 0xC1,
+    0x91, 0x83, 0xC5, 0xFD, 0xFC, 0x4B, 0xB1, 0x92, 0xA6, 0x52, 0x0A, 0x99, 0xD4, 0x51, 0x7F, 0xC0,
+    0xFC, 0x7C, 0x3E, 0xF5, 0x38, 0xB7, 0xC0, 0x26, 0x78, 0x00, 0xA3, 0xF4, 0xEB, 0x5E, 0xDB, 0xB7,
+    0x63, 0xDB, 0x40, 0xAE, 0xC6, 0x44, 0xC0, 0x79, 0x6A, 0x0F, 0xC5, 0x4C, 0xB6, 0x02, 0x4A, 0x5A,
+    0x9A, 0x0D, 0x20, 0xC8, 0x57, 0x28, 0x66, 0x70, 0x1E, 0x9C, 0xA7, 0x88, 0x49, 0x73, 0x51, 0x07,
+    0xF5, 0x98, 0xD4, 0x39, 0x91, 0x0B, 0xB0, 0x13, 0x6E, 0x04, 0x7A, 0x5F, 0x44, 0xA0, 0x88, 0x69,
+    0x6A, 0x75, 0x63, 0x35, 0x03, 0xB9, 0x72, 0x01, 0x54, 0x93, 0x0B, 0x00, 0x7A, 0x66, 0x05, 0x28,
+    0x93, 0x31, 0x42, 0xAB, 0xB8, 0xC9, 0xF3, 0x0E, 0xA0, 0xD6, 0x04, 0x90, 0xE9, 0xE4, 0x81, 0x01,
+    0xD0, 0x72, 0x7B, 0x55, 0x4B, 0x0F, 0xAC, 0xB6, 0xA3, 0x98, 0x6A, 0x70, 0x5C, 0x80, 0x48, 0xA4,
+    0x18, 0xF3, 0x40, 0x4D, 0x31, 0x12, 0xB1, 0xBE, 0x1C, 0xA9, 0x1B, 0x07, 0x47, 0x59, 0x84, 0x68,
+    0x47, 0xCC, 0xE4, 0xA0, 0x78, 0x2B, 0x6E, 0x57, 0x75, 0x02, 0xDA, 0x08, 0x68, 0x04, 0x23, 0x20,
+    0x1F, 0xD9, 0xC7, 0xFC, 0xFC, 0xE0, 0xA8, 0xD7, 0xC8, 0x3E, 0x66, 0xCB, 0x60, 0xD3, 0xB2, 0xCB,
+    0xFF, 0xE3, 0xE0, 0xA0, 0x6D, 0xA5, 0x45, 0xD2, 0xAF, 0x43, 0x12, 0x83, 0x2D, 0x64, 0x11, 0x8A,
+    0xF7, 0x39, 0x1C, 0xA0, 0x6F, 0xC8, 0x97, 0xA4, 0x1A, 0xD4, 0x03, 0xF4, 0x1D, 0xF9, 0x0A, 0xE5,
+    0x0C, 0xF5, 0xB8, 0xA9, 0x09, 0x9C, 0xEA, 0x6E, 0x4D, 0xB4, 0xAD, 0xF4, 0xA2, 0x14, 0x8F, 0xA0,
+    0x18, 0x3F, 0x44, 0xD3, 0x08, 0xB7, 0x34, 0x8D, 0xA4, 0xA7, 0xDE, 0x75, 0x70, 0xF0, 0x44, 0x25,
+    0xAD, 0x95, 0xB4, 0x56, 0x3E, 0x3D, 0xCA, 0xED, 0x49, 0xE9, 0xA1, 0x17, 0x49, 0xCB, 0xEE, 0xBB,
+    0x7A, 0x78, 0x57, 0x1A, 0xDF, 0x9B, 0xEE, 0x7E, 0xEE, 0xBB, 0x56, 0x8B, 0x85, 0xB4, 0xB5, 0x8A,
+    0xAD, 0x62, 0xD5, 0x70, 0xC7, 0xD6, 0xED, 0x36, 0x49, 0x4F, 0x4A, 0x7A, 0x45, 0xD2, 0xDB, 0xF3,
+    0xA6, 0x07, 0x56, 0x5D, 0xAA, 0xCB, 0x89, 0x8E, 0x59, 0xF9, 0xD4, 0x3C, 0xD9, 0xD2, 0xCF, 0xB4,
+    0xD2, 0x50, 0xCF, 0x79, 0x2C, 0x27, 0xAA, 0x1F, 0x46, 0x4C, 0xB8, 0x06, 0x17, 0xEA, 0x0E, 0xFB,
+    0x85, 0x01, 0xF3, 0xE3, 0x99, 0x6C, 0xBA, 0x06, 0xB1, 0xEE, 0x4A, 0x95, 0xC1, 0xE8, 0xF3, 0x91,
+    0x15, 0xA7, 0x42, 0xE1, 0x29, 0x8A, 0x8E, 0x94, 0xDD, 0x57, 0x68, 0x3A, 0x32, 0x2F, 0x76, 0xF7,
+    0x3E, 0xC5, 0xFF, 0xD6, 0x94, 0x57, 0xB8, 0xD9, 0xAD, 0x2F, 0xD8, 0x0E, 0x51, 0x8D, 0xF9, 0x4A,
+    0xB6, 0xE2, 0xBA, 0x2A, 0x60, 0x16, 0x56, 0xD4, 0x50, 0x44, 0x33, 0x17, 0x33, 0x94, 0x93, 0x1D,
+    0x9D, 0x07, 0x1B, 0xDC, 0x37, 0x56, 0xA0, 0xFA, 0xE9, 0x5A, 0x05, 0xC0, 0xBD, 0x12, 0xD5, 0x00,
+    0xED, 0xAB, 0xBF, 0x8E, 0x69, 0xE0, 0xA4, 0x6E, 0xAA, 0x24, 0x6F, 0x73, 0x29, 0x6C, 0xDD, 0xB5,
+    0x49, 0xBD, 0x38, 0x69, 0x37, 0x5B, 0x2F, 0x2E, 0x94, 0xCA, 0x56, 0x9A, 0xD3, 0xA1, 0xE6, 0x74,
+    0xA8, 0x19, 0x0A, 0xBD, 0xA1, 0x7E, 0x06, 0xB7, 0xB4, 0x51, 0x33, 0x46, 0x7F, 0xA6, 0x37, 0x35,
+    0xE3, 0x54, 0xEA, 0x87, 0x9A, 0x8D, 0xA6, 0x5A, 0x46, 0xB3, 0x53, 0xA7, 0x68, 0xB4, 0xCD, 0xAE,
+    0x76, 0xEB, 0xF2, 0x7B, 0x5B, 0xB9, 0xD9, 0x7A, 0x66, 0x53, 0xED, 0xF6, 0xF3, 0x60, 0x7D, 0x3E,
+    0x55, 0xF9, 0x84, 0xFD, 0x41, 0xD8, 0x87, 0xA3, 0xCA, 0x7A, 0xF2, 0xB7, 0xDE, 0x9C, 0xC0, 0x3E,
+    0xDF, 0x02, 0xBD, 0xFC, 0x4E, 0x0C, 0x54, 0x02, 0x32, 0x05, 0xA0, 0x95, 0x87, 0x4A, 0xDA, 0x3D,
+    0xB2, 0xFA, 0x37, 0x02, 0xEE, 0xF5, 0x28, 0x6F, 0x63, 0x7B, 0x5D, 0x46, 0x65, 0xAC, 0x52, 0x8D,
+    0x00, 0xF8, 0x2A, 0xC0, 0x29, 0x4E, 0xE9, 0x35, 0xA4, 0x68, 0xDE, 0x79, 0x3E, 0x26, 0x3B, 0xC1,
+    0x84, 0xA4, 0xF6, 0x39, 0xC8, 0x67, 0x0E, 0x7A, 0x6F, 0x35, 0x53, 0x6B, 0x84, 0x07, 0x43, 0x7A,
+    0xCB, 0xE5, 0x90, 0xA6, 0xA6, 0xAB, 0x60, 0xDE, 0x7E, 0x8D, 0xFE, 0x45, 0x49, 0x55, 0x52, 0x76,
+    0x79, 0x50, 0x17, 0xC9, 0xC7, 0xA4, 0x5B, 0x9E, 0x01, 0xCE, 0xD1, 0x2E, 0x59, 0xF3, 0x08, 0xEC,
+    0xC1, 0x57, 0xC9, 0x3D, 0x8F, 0xA0, 0x21, 0x7F, 0xBE, 0xA3, 0xF4, 0x58, 0x38, 0x4B, 0x1E, 0xA4,
+    0xEB, 0x8A, 0x56, 0xCD, 0x27, 0xE0, 0x5A, 0x43, 0x01, 0xF7, 0xC0, 0xD7, 0x50, 0x97, 0x7F, 0xE7,
+    0x4E, 0x7B, 0xB7, 0xDC, 0xEC, 0x5D, 0x1B, 0xEA, 0x01, 0x3B, 0x9E, 0xD8, 0xBB, 0x7F, 0x76, 0x62,
+    0xEF, 0xFE, 0x64, 0x82, 0xEA, 0x8D, 0x3B, 0xEC, 0xDD, 0xFA, 0x4E, 0x7B, 0xD7, 0x7D, 0x34, 0x7B,
+    0x77, 0x6A, 0xBB, 0x3C, 0x89, 0xA7, 0x47, 0xEE, 0xCC, 0xEE, 0x07, 0x08, 0xD6, 0x57, 0x79, 0xC8,
+    0xC2, 0x11, 0x95, 0xF5, 0xF9, 0x9B, 0x13, 0xB5, 0x23, 0xBF, 0xE9, 0x71, 0x33, 0x46, 0xE0, 0x02,
+    0x46, 0x9E, 0x7D, 0x61, 0x5E, 0x8F, 0x1C, 0xD5, 0xA1, 0x18, 0xE4, 0x2F, 0x18, 0x95, 0x43, 0xB5,
+    0x00, 0x03, 0xDC, 0x03, 0x34, 0xA5, 0xC7, 0xCC, 0x1C, 0x43, 0x8B, 0xF5, 0xD8, 0x91, 0x48, 0x1E,
+    0xB1, 0xFF, 0xBC, 0x73, 0x0D, 0x71, 0x29, 0x03, 0xF6, 0x5B, 0x3F, 0x8A, 0x64, 0xF3, 0xE2, 0x3A,
+    0xAA, 0x6F, 0xBD, 0x12, 0xC8, 0xE6, 0x65, 0x81, 0xFA, 0x59, 0x75, 0x5B, 0x97, 0xAD, 0xA5, 0x0E,
+    0x73, 0x63, 0x5D, 0xC1, 0x3D, 0xFB, 0x93, 0x19, 0xF3, 0xF6, 0xE2, 0x02, 0xEE, 0xC9, 0x41, 0xDE,
+    0xBC, 0xBD, 0x14, 0xA2, 0x3D, 0x3F, 0xB8, 0x58, 0x4C, 0xA0, 0xD0, 0x36, 0x14, 0x1A, 0xEE, 0x25,
+    0x0F, 0xC6, 0x67, 0x13, 0x81, 0xC8, 0x61, 0x38, 0xE4, 0x53, 0x87, 0x67, 0x29, 0x9F, 0xAD, 0xC9,
+    0x5F, 0x7F, 0x15, 0xAE, 0xA9, 0xC3, 0x69, 0xC0, 0x3E, 0x7F, 0x15, 0xF3, 0xCB, 0x97, 0x47, 0xFE,
+    0x22, 0xAC, 0x9C, 0x3D, 0xAE, 0xC6, 0xEA, 0x2B, 0xF9, 0x5A, 0x0C, 0xB8, 0x90, 0x45, 0x5A, 0x4F,
+    0x8B, 0x1B, 0x0A, 0xAD, 0xD5, 0xC8, 0xF3, 0xEF, 0x7C, 0x31, 0x90, 0xC7, 0x72, 0x06, 0x15, 0x11,
+    0xDC, 0xD3, 0x0B, 0x09, 0x80, 0x30, 0xB3, 0x80, 0xB5, 0xEF, 0xC0, 0xA5, 0x7E, 0x39, 0x40, 0xA1,
+    0x11, 0xB2, 0x4D, 0x95, 0x68, 0xB6, 0x57, 0x52, 0x4A, 0x60, 0xA2, 0x02, 0xC8, 0x8A, 0xF4, 0x4E,
+    0x6C, 0xA8, 0x85, 0x89, 0x46, 0x21, 0x13, 0x4E, 0xB4, 0xBE, 0x50, 0xA8, 0x02, 0xBD, 0x92, 0x04,
+    0xCA, 0x66, 0xB8, 0xEB, 0x4B, 0x3F, 0x6F, 0x70, 0x12, 0x48, 0x71, 0x53, 0x64, 0xCB, 0x01, 0xA8,
+    0x01, 0x62, 0x19, 0x30, 0xA1, 0x05, 0x7B, 0x7D, 0x02, 0xE7, 0x3A, 0x58, 0x67, 0x30, 0xF2, 0x24,
+    0xA3, 0xD1, 0x2D, 0xDB, 0x1C, 0x54, 0xFC, 0x6A, 0x85, 0xEA, 0xFA, 0x0A, 0x6D, 0xB1, 0x92, 0xC5,
+    0x72, 0xA5, 0x08, 0x76, 0xA5, 0xF6, 0x76, 0x45, 0x92, 0x2F, 0x92, 0x9E, 0xE7, 0x06, 0x2B, 0xC5,
+    0x6C, 0x85, 0xD4, 0x0F, 0xA1, 0xF6, 0x7D, 0xC7, 0x56, 0x75, 0xCC, 0xEC, 0x06, 0xB6, 0xDA, 0x83,
+    0xFB, 0x56, 0x60, 0xD7, 0x00, 0x98, 0x24, 0x41, 0xAA, 0xA4, 0x71, 0xB7, 0x6B, 0x9A, 0x0D, 0xA7,
+    0x24, 0x6C, 0xA6, 0x34, 0x45, 0x86, 0x24, 0x99, 0x02, 0xBB, 0xC6, 0xC0, 0x06, 0x05, 0xB6, 0xF6,
+    0x00, 0xE5, 0x0A, 0xA4, 0x26, 0x81, 0x2A, 0x18, 0x05, 0x52, 0xAB, 0x90, 0x89, 0x32, 0xFD, 0x7B,
+    0x26, 0x75, 0xC7, 0x85, 0xD6, 0x62, 0x84, 0xC9, 0x81, 0xF9, 0xF1, 0x04, 0xF6, 0x8B, 0x1E, 0xF6,
+    0x8E, 0x21, 0xBB, 0x39, 0x42, 0x21, 0xA0, 0x9A, 0x80, 0x7E, 0x80, 0x5C, 0x03, 0xD8, 0x37, 0x06,
+    0x70, 0x6E, 0x80, 0xE8, 0x06, 0x4C, 0x68, 0x3D, 0xD6, 0xF7, 0x9E, 0x7D, 0xE4, 0x3F, 0xD9, 0xC0,
+    0xEF, 0x9B, 0x19, 0xEC, 0xE8, 0x3A, 0x58, 0xCD, 0x0C, 0x36, 0xB8, 0x0E, 0x64, 0x22, 0xD8, 0xE0,
+    0xFC, 0x47, 0xDA, 0x5D, 0x0F, 0x0E, 0xCE, 0x27, 0x9D, 0xD3, 0x48, 0xD2, 0xD4, 0x4A, 0xD2, 0xE3,
+    0xB7, 0xED, 0x2E, 0x50, 0x4D, 0xED, 0x40, 0x96, 0x76, 0xE7, 0x76, 0x20, 0xD7, 0x33, 0x0B, 0xD4,
+    0x4B, 0x3B, 0xB0, 0xD9, 0x2A, 0x67, 0xD9, 0x19, 0x5C, 0x9C, 0x3D, 0x8B, 0x19, 0x27, 0xEC, 0xD3,
+    0x03, 0xFB, 0xB6, 0x21, 0x5E, 0xC0, 0xBC, 0x39, 0x61, 0x5F, 0x1C, 0x70, 0x55, 0x47, 0x3C, 0xC2,
+    0xBC, 0x29, 0x69, 0x93, 0x4C, 0xB1, 0x95, 0xDE, 0x8C, 0xD8, 0x97, 0x02, 0xAE, 0xF6, 0x2C, 0x7D,
+    0x32, 0x60, 0x2F, 0x43, 0x7E, 0x1B, 0x2C, 0x60, 0x66, 0xB0, 0xD2, 0xEA, 0x3A, 0x90, 0xF4, 0xB3,
+    0xDB, 0x0F, 0x21, 0xD5, 0x26, 0xA9, 0x4E, 0xFF, 0xCA, 0x87, 0x3F, 0x3F, 0xF8, 0x3D, 0x41, 0x6A,
+    0x02, 0x70, 0x92, 0xD4, 0x9C, 0x1C, 0xB6, 0xE9, 0xB0, 0xD8, 0x1D, 0x0E, 0x64, 0x6A, 0x28, 0x16,
+    0xA8, 0xE6, 0xED, 0xB0, 0xBB, 0xFD, 0x30, 0x57, 0x47, 0xB1, 0x42, 0x3D, 0xC3, 0x19, 0x32, 0xE9,
+    0xE5, 0x8E, 0x56, 0xBF, 0x1A, 0xA9, 0x60, 0xA6, 0xF4, 0x38, 0xF2, 0x80, 0xF5, 0x1C, 0x63, 0x02,
+    0x75, 0x43, 0xA4, 0x1C, 0x70, 0xE4, 0x13, 0x56, 0x5A, 0x30, 0x92, 0x1A, 0x24, 0x0D, 0x38, 0x69,
+    0xC6, 0x7A, 0x56, 0x4C, 0xC0, 0x75, 0x44, 0xEC, 0x88, 0xBB, 0x1D, 0x36, 0x6A, 0xD3, 0x64, 0x79,
+    0xAB, 0x50, 0xD2, 0x05, 0xFA, 0x8F, 0x56, 0xB4, 0xB7, 0x8A, 0xE7, 0x57, 0x5A, 0xE8, 0xA5, 0xA1,
+    0x85, 0xFE, 0xB5, 0x62, 0x6A, 0xA1, 0xEF, 0x88, 0xE9, 0x27, 0x17, 0x52, 0xB1, 0x9F, 0x0A, 0xD7,
+    0x82, 0x4E, 0x8A, 0xFD, 0x54, 0x5C, 0x6B, 0x41, 0x54, 0xB1, 0x05, 0x51, 0xCF, 0xA9, 0xB8, 0xB8,
+    0x69, 0x74, 0xD2, 0x26, 0x53, 0xE4, 0xA1, 0x6E, 0x70, 0xC9, 0xBA, 0x8D, 0x09, 0xBF, 0x08, 0x50,
+    0x8E, 0x58, 0x0F, 0x75, 0xB7, 0x9D, 0xCA, 0xD2, 0xA9, 0x22, 0x9D, 0xAA, 0xD2, 0xA9, 0xF6, 0x8E,
+    0x53, 0x7F, 0xA1, 0xB1, 0x1C, 0xA9, 0xA4, 0xA9, 0xEE, 0x68, 0xC7, 0x32, 0xFC, 0x3E, 0xD9, 0x4A,
+    0x91, 0x66, 0xC3, 0x32, 0x69, 0x5E, 0x55, 0x03, 0x47, 0xB0, 0x9F, 0x44, 0xD3, 0x0C, 0xC5, 0x98,
+    0x8C, 0xF6, 0x8E, 0xBA, 0x81, 0x6B, 0x3C, 0x18, 0x21, 0x8F, 0x68, 0x84, 0x32, 0x98, 0x15, 0xB8,
+    0xAB, 0xB9, 0xEB, 0x36, 0xFD, 0xB7, 0x6D, 0xD2, 0x08, 0x4E, 0x46, 0x79, 0x92, 0x0A, 0xB9, 0xFE,
+    0xEF, 0xA4, 0x29, 0xB3, 0x2B, 0xAA, 0xB5, 0xC1, 0x81, 0xD3, 0x44, 0xDD, 0xE1, 0x9A, 0x16, 0x3B,
+    0xE0, 0x30, 0xA3, 0x09, 0x54, 0xF0, 0x02, 0x11, 0xDB, 0x71, 0x86, 0x23, 0xCC, 0x80, 0xED, 0xAA,
+    0x2E, 0x9B, 0x28, 0x86, 0x62, 0xE4, 0x02, 0x26, 0x64, 0x33, 0x55, 0x63, 0x66, 0x5A, 0x8A, 0x31,
+    0x8F, 0x54, 0x3E, 0x8B, 0x66, 0xC5, 0x44, 0xDC, 0x33, 0xA2, 0xE9, 0xBB, 0x52, 0xCA, 0x43, 0xB5,
+    0x7C, 0x4E, 0x7A, 0x63, 0xCD, 0x25, 0x49, 0xF2, 0x4E, 0x92, 0xD4, 0xE4, 0x4A, 0xEA, 0xCE, 0x29,
+    0x25, 0x27, 0x44, 0xD6, 0x9D, 0x3C, 0x57, 0xD2, 0x29, 0xD6, 0x26, 0x49, 0xDF, 0x4F, 0x5E, 0x64,
+    0x9F, 0x42, 0x63, 0x16, 0xB8, 0x5A, 0x0C, 0xB6, 0x33, 0xDE, 0x74, 0xFB, 0x3C, 0x82, 0x65, 0x22,
+    0xF0, 0xA8, 0x19, 0x8C, 0xCF, 0x47, 0xDB, 0x54, 0x54, 0x9C, 0xE5, 0x90, 0x98, 0x10, 0x0C, 0x33,
+    0x99, 0x37, 0x57, 0x8A, 0x1B, 0x85, 0xC2, 0xB1, 0x95, 0xA4, 0xC9, 0x4A, 0x52, 0x73, 0x4A, 0xAF,
+    0xEB, 0xE2, 0x1D, 0x16, 0x51, 0xD6, 0xDF, 0x80, 0xF3, 0x5A, 0xC9, 0xA5, 0x05, 0xAB, 0x6F, 0xFF,
+    0x43, 0xDC, 0x0E, 0xF8, 0xCB, 0x44, 0xB2, 0x67, 0x28, 0x66, 0x92, 0x46, 0x9D, 0x6C, 0x1A, 0x3B,
+    0x02, 0xD5, 0xAD, 0x2C, 0x9C, 0x64, 0x11, 0xB0, 0x02, 0xAC, 0x5E, 0xE3, 0x0F, 0x4B, 0x49, 0xAB,
+    0x91, 0xB4, 0x66, 0x92, 0x56, 0x7A, 0x69, 0xA5, 0x92, 0x56, 0xB2, 0x5E, 0x37, 0x48, 0xF0, 0x02,
+    0x99, 0x07, 0xF0, 0xC0, 0xF7, 0xBB, 0x1D, 0x12, 0x4E, 0x21, 0x6F, 0x14, 0xD1, 0x3F, 0xE9, 0x6A,
+    0x8F, 0x99, 0xA0, 0x4D, 0x2A, 0xF2, 0x55, 0x28, 0xC7, 0x74, 0x34, 0x81, 0x1B, 0xC8, 0xF5, 0x2F,
+    0x3A, 0x2B, 0x51, 0x6B, 0xA6, 0x52, 0x43, 0xE6, 0xE1, 0x1E, 0xF8, 0xBE, 0xC7, 0x8E, 0x49, 0x04,
+    0xBC, 0x2A, 0x49, 0xBF, 0x96, 0xA4, 0xE5, 0x8F, 0xCE, 0x2D, 0x1C, 0x6C, 0xBE, 0x08, 0x3B, 0x00,
+    0x66, 0x02, 0x58, 0x4E, 0x1C, 0x14, 0x76, 0xD8, 0xD5, 0x36, 0x5B, 0x01, 0xDA, 0x6E, 0x57, 0xC9,
+    0xDB, 0xBE, 0xEC, 0x3B, 0x92, 0xE6, 0x4F, 0x19, 0x49, 0x98, 0x35, 0xF4, 0x1E, 0x70, 0x01, 0xB0,
+    0x91, 0xCD, 0x56, 0x4A, 0x36, 0xDE, 0xDE, 0x89, 0x8E, 0x6A, 0x3C, 0xF4, 0x09, 0x71, 0xFE, 0xD3,
+    0x73, 0x73, 0x86, 0x19, 0x13, 0xD6, 0xBC, 0x9F, 0xA0, 0xE6, 0xDB, 0x0F, 0xE3, 0x1D, 0x8A, 0xE3,
+    0xCE, 0x5C, 0xAA, 0xFD, 0x89, 0x94, 0x75, 0x0D, 0xB4, 0x36, 0x80, 0xFB, 0xFA, 0x02, 0x95, 0x77,
+    0x1E, 0x1B, 0x8A, 0x99, 0x72, 0x42, 0x98, 0x48, 0x35, 0xE6, 0x0B, 0x66, 0xC9, 0x04, 0xAD, 0x57,
+    0x83, 0x9D, 0x5A, 0x4F, 0x26, 0x37, 0x80, 0x4B, 0x43, 0x7A, 0x02, 0x14, 0x81, 0x7A, 0xB9, 0xF5,
+    0xC0, 0x1D, 0x09, 0x65, 0xC7, 0xCE, 0x40, 0xB1, 0x02, 0xB9, 0x3A, 0xA0, 0x1F, 0x01, 0x37, 0xB3,
+    0xCD, 0xF6, 0x85, 0x3A, 0x38, 0x82, 0xE8, 0xC8, 0x27, 0xD7, 0x98, 0x50, 0x75, 0x45, 0xB0, 0xBE,
+    0x1C, 0xCA, 0xC1, 0xFA, 0x62, 0xAC, 0x3A, 0x13, 0xEA, 0x26, 0x9F, 0x1C, 0x59, 0x3C, 0x82, 0x78,
+    0x15, 0xAE, 0x45, 0x68, 0xE7, 0xD4, 0x46, 0x75, 0x48, 0xAD, 0xFA, 0x3E, 0xC9, 0x35, 0xD0, 0x96,
+    0xBB, 0x7A, 0xD5, 0xDE, 0x79, 0xEC, 0x58, 0xCC, 0x94, 0x01, 0x61, 0x66, 0xAA, 0x60, 0x22, 0x66,
+    0xC9, 0x56, 0x68, 0xBD, 0xC0, 0xCE, 0xBD, 0x27, 0x53, 0xBB, 0xAB, 0x57, 0x71, 0x52, 0x2F, 0x2B,
+    0xCD, 0x18, 0x69, 0x05, 0x49, 0xDD, 0x07, 0xD4, 0x4B, 0xEF, 0x53, 0xAF, 0x4F, 0x36, 0xFC, 0x6E,
+    0x11, 0xA8, 0xBA, 0x88, 0x1D, 0xEA, 0xCE, 0x04, 0x13, 0xF2, 0x99, 0x48, 0xA4, 0xEE, 0x1C, 0x26,
+    0xD4, 0x0D, 0x8B, 0xF5, 0x54, 0xCF, 0x8C, 0x98, 0xB7, 0x26, 0xB8, 0x1A, 0xA1, 0x5A, 0xC1, 0xA8,
+    0x29, 0x24, 0xBD, 0xAD, 0x84, 0xF5, 0xAB, 0xC9, 0xD6, 0xAD, 0x0F, 0x55, 0xE3, 0xD6, 0x83, 0x36,
+    0xCB, 0xBC, 0x1C, 0xCA, 0x00, 0x95, 0x37, 0x33, 0xB8, 0x26, 0x5B, 0x60, 0x85, 0x9E, 0x3C, 0x82,
+    0xEB, 0x8A, 0x09, 0xAA, 0x21, 0xC1, 0x0C, 0xCE, 0x83, 0x89, 0x6D, 0x07, 0xF9, 0xAA, 0x5B, 0x56,
+    0x7E, 0x3B, 0xB3, 0xEB, 0x6E, 0x69, 0xBC, 0xA6, 0x37, 0x99, 0x4B, 0x40, 0xB1, 0xAA, 0x03, 0x1B,
+    0x7B, 0x0F, 0x2E, 0xB8, 0x00, 0xED, 0x58, 0xCD, 0x20, 0x6F, 0x17, 0x8C, 0x1A, 0x23, 0xCA, 0x95,
+    0x5C, 0x5D, 0x15, 0x41, 0xAF, 0xB9, 0x09, 0xDA, 0x84, 0x1D, 0x3C, 0xF2, 0x9E, 0xFC, 0x37, 0x2B,
+    0x78, 0xC1, 0x8C, 0x1C, 0x72, 0x96, 0xB3, 0x94, 0xDE, 0xC1, 0x5C, 0x43, 0xF5, 0xC5, 0x2E, 0xA9,
+    0x7E, 0xCE, 0xA7, 0x01, 0x69, 0x62, 0xD2, 0x05, 0xF3, 0x77, 0x66, 0xB2, 0xE8, 0x1A, 0x96, 0x22,
+    0x20, 0x56, 0x7A, 0xEC, 0xD0, 0x76, 0xB9, 0x76, 0x03, 0xFD, 0xAB, 0xC0, 0xC7, 0x52, 0x43, 0x54,
+    0xD2, 0x92, 0x85, 0x42, 0x52, 0x73, 0x08, 0x75, 0x47, 0x05, 0xE5, 0x48, 0xE1, 0xC9, 0x67, 0xB2,
+    0x00, 0xD7, 0x92, 0x1F, 0xF3, 0xAF, 0x76, 0x42, 0x92, 0x06, 0x7A, 0x49, 0x33, 0xB5, 0xA4, 0x95,
+    0x52, 0xDA, 0x90, 0x94, 0x62, 0x3C, 0x71, 0xED, 0x24, 0x3D, 0x38, 0xD9, 0xE2, 0xBB, 0x13, 0xF0,
+    0x95, 0xE7, 0xBE, 0xF3, 0xB1, 0x42, 0xFA, 0xC6, 0xC0, 0x1E, 0x8F, 0x60, 0x7C, 0xFE, 0xD1, 0x76,
+    0x9C, 0x34, 0x26, 0x1D, 0x37, 0xD9, 0xC2, 0xD5, 0xE6, 0xC1, 0xA5, 0x02, 0xB8, 0x78, 0x00, 0x4F,
+    0xE4, 0x11, 0x33, 0x95, 0x01, 0x3B, 0x54, 0x1D, 0xAE, 0x39, 0x82, 0x85, 0x19, 0x33, 0x99, 0x01,
+    0x3B, 0xD8, 0x06, 0xD7, 0x9C, 0x85, 0xC8, 0x8C, 0x09, 0x79, 0xC0, 0x79, 0x33, 0x15, 0xA2, 0x94,
+    0x22, 0x85, 0x5E, 0x0F, 0x6C, 0x1E, 0x98, 0x5B, 0x48, 0xFA, 0xFB, 0x7C, 0xF5, 0xD6, 0x45, 0x28,
+    0x5F, 0xF6, 0x50, 0xBF, 0xCF, 0xCF, 0xF8, 0x34, 0xBF, 0x63, 0xBC, 0x19, 0xF6, 0x38, 0x7B, 0x67,
+    0x91, 0x0F, 0xE5, 0x60, 0xBF, 0xBF, 0xD0, 0xDE, 0x1C, 0xE0, 0x6C, 0xD2, 0x0F, 0xF7, 0x92, 0xEC,
+    0xDA, 0x03, 0xF3, 0x2A, 0x9C, 0x0E, 0x49, 0x9E, 0x05, 0xB8, 0x8B, 0x04, 0xAB, 0x96, 0x2F, 0x0E,
+    0xE4, 0x6F, 0x4E, 0x10, 0x2F, 0x80, 0xAB, 0x1A, 0xEC, 0x8B, 0x03, 0xE6, 0xD6, 0x17, 0xDF, 0x18,
+    0xAB, 0x57, 0xC6, 0x17, 0xCA, 0x69, 0x39, 0x53, 0x2C, 0xEE, 0xD5, 0x97, 0xF4, 0xB8, 0xA4, 0x41,
+    0xBA, 0x39, 0x15, 0x1A, 0x17, 0xAC, 0x77, 0x4D, 0x3E, 0xDA, 0x91, 0x17, 0x8A, 0x99, 0x33, 0xD9,
+    0x4A, 0xD9, 0xA5, 0x41, 0xF3, 0xDB, 0xFC, 0xE6, 0xA3, 0x3C, 0x72, 0xDB, 0x76, 0x76, 0xEF, 0x6B,
+    0x67, 0xF7, 0xBE, 0x76, 0xCD, 0xBD, 0xB3, 0x56, 0x5A, 0xF3, 0x75, 0x9F, 0xAF, 0xED, 0xB6, 0xFB,
+    0xF6, 0x77, 0xEE, 0xB2, 0xDB, 0x93, 0x7B, 0x57, 0x6A, 0x77, 0xE9, 0xBC, 0x9A, 0x56, 0x1A, 0xDB,
+    0xD7, 0x8A, 0xD0, 0x76, 0x4C, 0x2D, 0xBC, 0xD0, 0xC2, 0xF1, 0xD1, 0x9D, 0x29, 0xB6, 0xB0, 0x6C,
+    0x69, 0xB5, 0x3E, 0x35, 0x9D, 0xED, 0xDE, 0x95, 0x9A, 0x64, 0xBE, 0x57, 0x0D, 0x54, 0x5F, 0x58,
+    0xA9, 0x7B, 0x0D, 0xB5, 0x14, 0xEA, 0xB9, 0x98, 0xEA, 0x21, 0x9B, 0x9D, 0x27, 0xBA, 0x8E, 0x63,
+    0xD7, 0xDC, 0x91, 0xA2, 0x6B, 0x88, 0x6D, 0xC3, 0xD2, 0x36, 0x2C, 0x6D, 0x97, 0x2D, 0x7D, 0x97,
+    0x2D, 0xC0, 0xF9, 0xD7, 0x92, 0xE5, 0x31, 0x40, 0xAE, 0x5F, 0xAC, 0x90, 0xAF, 0x14, 0x03, 0xD9,
+    0x02, 0xC7, 0xAE, 0x59, 0xC0, 0x7E, 0x6B, 0x6C, 0xA1, 0x78, 0x4B, 0x92, 0xB4, 0x24, 0x85, 0xE2,
+    0xEB, 0xDF, 0x97, 0xB4, 0x5E, 0xCA, 0xD6, 0x6F, 0xB3, 0xD5, 0x70, 0xE7, 0x58, 0x36, 0x09, 0x7C,
+    0xD9, 0x90, 0xC3, 0x39, 0x01, 0x33, 0xAF, 0xF1, 0x20, 0xF4, 0x92, 0x3C, 0x65, 0xD2, 0xF0, 0x7A,
+    0x29, 0x42, 0x21, 0xDD, 0x00, 0x4E, 0xFD, 0xF1, 0x45, 0xE0, 0x93, 0x5D, 0xF2, 0xA0, 0x95, 0x43,
+    0x75, 0x57, 0x1E, 0x78, 0x6A, 0xDA, 0xC3, 0xBC, 0xBC, 0xBB, 0x65, 0xB0, 0xBF, 0xF8, 0x76, 0xF2,
+    0x8F, 0x5A, 0x0F, 0x5C, 0xDD, 0xCD, 0x90, 0x6E, 0xFD, 0xBE, 0x47, 0x8A, 0x18, 0xC9, 0x73, 0x4A,
+    0x17, 0x81, 0xFA, 0xB5, 0x64, 0x92, 0xCD, 0x40, 0xB5, 0x7E, 0x3F, 0x80, 0x89, 0xD8, 0x0E, 0x56,
+    0x38, 0x5B, 0x8E, 0x75, 0x47, 0x1E, 0x5A, 0x13, 0xE0, 0xFC, 0xE3, 0x92, 0xA4, 0x98, 0xEA, 0xE4,
+    0xFF, 0x23, 0x49, 0xFA, 0x2E, 0xF6, 0xE7, 0xE7, 0x4E, 0x3C, 0xE4, 0x49, 0xF5, 0xD8, 0x14, 0x07,
+    0xCA, 0x24, 0xB5, 0xDC, 0x0D, 0xF8, 0x72, 0x1A, 0xE8, 0x60, 0xB5, 0xB3, 0xE5, 0x95, 0xA0, 0xA9,
+    0x11, 0xE8, 0xD7, 0x8B, 0x27, 0x74, 0x00, 0xCA, 0xE4, 0xCD, 0x4A, 0x07, 0xA7, 0x1A, 0x80, 0x4F,
+    0x5E, 0xDC, 0x26, 0x8E, 0xA3, 0xE6, 0xCA, 0xC7, 0xCC, 0x40, 0x38, 0x3C, 0x43, 0xF6, 0x53, 0x49,
+    0xFA, 0xA1, 0x24, 0x35, 0xD5, 0x2F, 0x0E, 0xE0, 0x90, 0xCD, 0x15, 0x91, 0x06, 0xD1, 0x04, 0x54,
+    0xEB, 0x73, 0x23, 0x4E, 0xEA, 0xA8, 0xB5, 0xC2, 0x83, 0xBA, 0xB8, 0xA1, 0x41, 0x0F, 0x6D, 0xEE,
+    0x9E, 0xE7, 0xBE, 0x30, 0xF5, 0x5F, 0x98, 0xDA, 0xC7, 0xEF, 0xDC, 0x9E, 0x99, 0xDB, 0x67, 0xE6,
+    0xF6, 0xA5, 0xD8, 0xBF, 0x14, 0xF5, 0x72, 0x94, 0x87, 0x53, 0x0D, 0x97, 0x00, 0x3E, 0x85, 0xE9,
+    0x92, 0x65, 0xF6, 0x08, 0xB7, 0x0C, 0xD8, 0x13, 0x6C, 0x7A, 0x07, 0x60, 0x7F, 0xE8, 0xC7, 0x86,
+    0x4C, 0xD4, 0x23, 0x55, 0x30, 0x33, 0x02, 0x37, 0xD8, 0xD1, 0x4E, 0xE0, 0xBC, 0xEB, 0x5A, 0x0F,
+    0x7D, 0xB7, 0x9A, 0x08, 0xC8, 0xCC, 0xF5, 0x08, 0xD9, 0x6A, 0x43, 0x52, 0xF4, 0xDA, 0x97, 0x27,
+    0xA0, 0x58, 0xD4, 0xFA, 0x04, 0x3E, 0xC7, 0x04, 0x2F, 0x27, 0x7C, 0xB9, 0xDA, 0xE0, 0x66, 0xB7,
+    0xC1, 0x6E, 0x7D, 0x02, 0xFD, 0x8A, 0x13, 0x8C, 0x5A, 0x7E, 0x83, 0xF3, 0xFC, 0x66, 0xD1, 0x74,
+    0x9B, 0x69, 0xD6, 0x81, 0x5B, 0x75, 0x53, 0x1D, 0x46, 0xAF, 0xEB, 0x65, 0x75, 0x38, 0x55, 0xAA,
+    0xD4, 0x19, 0x85, 0x3E, 0xD6, 0xEA, 0x9C, 0x3E, 0xAF, 0xE0, 0xF4, 0xB4, 0x66, 0xAB, 0xC1, 0xA9,
+    0x83, 0x4B, 0xFC, 0x2D, 0x20, 0xF7, 0x5C, 0x01, 0x0A, 0x5F, 0x78, 0xC0, 0xA6, 0xA9, 0x6F, 0x83,
+    0xBB, 0xCB, 0x99, 0x8F, 0xF2, 0x69, 0x71, 0xB8, 0x86, 0x95, 0x68, 0x66, 0x58, 0x4C, 0xA8, 0x3C,
+    0x79, 0xB4, 0x7E, 0x01, 0x33, 0xBB, 0x32, 0x40, 0xF1, 0x66, 0x6C, 0x81, 0xF2, 0xD7, 0xBF, 0x9E,
+    0x53, 0x6D, 0x3D, 0x50, 0xA5, 0x7B, 0xB9, 0x74, 0x2F, 0xA7, 0x64, 0x3D, 0xAC, 0xA9, 0x1F, 0x27,
+    0xE5, 0x41, 0x2B, 0x50, 0x4B, 0x2B, 0x18, 0xF5, 0x37, 0x57, 0x70, 0x8B, 0x5E, 0x5E, 0x31, 0x7A,
+    0x51, 0x76, 0xC5, 0x2D, 0xD5, 0x52, 0xAD, 0x46, 0x43, 0x3F, 0xD5, 0xEB, 0x86, 0x8E, 0xE7, 0x91,
+    0x63, 0x16, 0x1C, 0xC2, 0xFA, 0x16, 0x13, 0x5C, 0x47, 0xAC, 0x3C, 0xFB, 0x76, 0xA0, 0xFA, 0x66,
+    0xA0, 0xF8, 0x59, 0x20, 0x7B, 0x67, 0x4E, 0x0E, 0xF8, 0x7A, 0x6D, 0x28, 0xA5, 0xCE, 0xCC, 0x4F,
+    0xAE, 0xAC, 0xD4, 0xA3, 0x6B, 0xB2, 0xC5, 0x0E, 0xD4, 0xD7, 0x27, 0xCC, 0x9B, 0x0B, 0x2C, 0x6D,
+    0x83, 0x7B, 0x72, 0xC0, 0x0E, 0x49, 0x39, 0x34, 0x31, 0x39, 0xE9, 0x9C, 0x92, 0x0E, 0x6E, 0x56,
+    0xE0, 0x09, 0x78, 0xD8, 0x8C, 0x0F, 0x17, 0xFE, 0x11, 0xDB, 0x3C, 0x52, 0xF3, 0xC8, 0x1E, 0x7B,
+    0x2F, 0x70, 0x36, 0xE0, 0x06, 0xDC, 0x3B, 0xEC, 0x55, 0xC3, 0x5E, 0x1E, 0x0E, 0x79, 0xE1, 0x90,
+    0xC3, 0x43, 0xF6, 0x8E, 0xD9, 0x83, 0x43, 0xB2, 0x99, 0x2A, 0x50, 0x79, 0x3E, 0x06, 0x6D, 0xEA,
+    0xDC, 0x0A, 0xA9, 0x3F, 0xE4, 0x31, 0x99, 0x9E, 0x95, 0xA7, 0xF6, 0x65, 0xA0, 0x0C, 0x79, 0x24,
+    0x8F, 0xF4, 0x70, 0x8D, 0xDA, 0x53, 0x77, 0x65, 0xC0, 0x8E, 0x79, 0xC4, 0x4C, 0xF4, 0xB0, 0x50,
+    0x7B, 0x5C, 0x63, 0x03, 0xD6, 0x9B, 0x88, 0x09, 0x88, 0x2C, 0xE2, 0x3C, 0x2D, 0x36, 0x50, 0x7B,
+    0xB3, 0x9C, 0x3B, 0x1F, 0x50, 0x74, 0x13, 0x6E, 0xB5, 0x13, 0x56, 0x4D, 0x72, 0xBA, 0x6C, 0x16,
+    0x45, 0x39, 0xEF, 0x6C, 0x90, 0x4C, 0x94, 0x8A, 0xF4, 0xF2, 0xA5, 0x3F, 0xE4, 0xB8, 0xF0, 0xA5,
+    0x3F, 0xE4, 0x85, 0xC2, 0x97, 0xDD, 0x21, 0x73, 0xE1, 0x6D, 0x73, 0xCC, 0x54, 0x7A, 0xDB, 0x1C,
+    0x13, 0x4A, 0x5F, 0x71, 0xF5, 0x0B, 0xA1, 0x8C, 0x0B, 0x7D, 0x47, 0x36, 0x81, 0x03, 0x13, 0x3E,
+    0xD9, 0xC0, 0xEF, 0xB3, 0x82, 0x99, 0x13, 0xEE, 0x62, 0x47, 0x70, 0x3E, 0x81, 0x0A, 0x02, 0x13,
+    0x13, 0xB0, 0x90, 0x90, 0x86, 0x0F, 0xFF, 0xFA, 0xDB, 0x07, 0x5F, 0x8A, 0xE6, 0x96, 0x65, 0x35,
+    0x38, 0x49, 0xFA, 0x9C, 0x24, 0x2D, 0x09, 0x70, 0xA8, 0x26, 0x68, 0x87, 0x76, 0x20, 0xD3, 0xD7,
+    0xD5, 0x50, 0xAC, 0xC5, 0x02, 0x95, 0xAA, 0x09, 0xFA, 0xD8, 0x8E, 0xE4, 0x0A, 0x40, 0xB6, 0x0D,
+    0x1A, 0x00, 0x17, 0x81, 0x56, 0xE3, 0x4E, 0x8D, 0x4B, 0x1D, 0xFD, 0x2E, 0x38, 0x43, 0x16, 0xF6,
+    0x6F, 0x4B, 0x8E, 0x7C, 0x97, 0xA6, 0x93, 0x24, 0xDD, 0x9E, 0x66, 0x87, 0xD9, 0xA5, 0xD5, 0xA5,
+    0xAE, 0xB0, 0x42, 0xB6, 0x24, 0x9C, 0xCE, 0x45, 0x78, 0xA0, 0xF9, 0x9B, 0x6A, 0x8F, 0xCF, 0xDD,
+    0x6A, 0x8F, 0xB9, 0x9A, 0xA0, 0x1F, 0xDB, 0x71, 0xD3, 0xC6, 0x93, 0xC5, 0x64, 0x56, 0x76, 0xA8,
+    0x1A, 0xAD, 0x67, 0xB3, 0x44, 0x29, 0x27, 0x76, 0x7D, 0x23, 0xDB, 0xE4, 0xE1, 0x1D, 0x6D, 0xE3,
+    0x4E, 0xD2, 0x6D, 0xED, 0x72, 0x67, 0xDB, 0xCC, 0xEF, 0x6A, 0x9B, 0xD9, 0x35, 0x66, 0xDE, 0x26,
+    0x97, 0x65, 0xD3, 0x91, 0xE6, 0x84, 0x7D, 0xE6, 0x97, 0x0E, 0xE0, 0x89, 0x95, 0x2C, 0x5E, 0x83,
+    0x78, 0x2D, 0x19, 0x31, 0xF1, 0xC2, 0x96, 0xCE, 0x9E, 0xA4, 0x2C, 0x3A, 0x4C, 0xAC, 0x2E, 0x56,
+    0xD1, 0x4A, 0x31, 0xD3, 0xBF, 0x88, 0xC9, 0x5E, 0xCB, 0xE2, 0x76, 0xBD, 0xF7, 0x49, 0xBB, 0xF3,
+    0x59, 0xD8, 0xF4, 0xC2, 0x73, 0x5F, 0xE6, 0x3F, 0xF5, 0xE6, 0x25, 0xEC, 0x69, 0xF6, 0x2E, 0xF3,
+    0x96, 0x37, 0x2F, 0x61, 0xCF, 0x70, 0x7C, 0xF4, 0xA5, 0x20, 0xF9, 0xFE, 0x5B, 0xB0, 0xC7, 0xA9,
+    0x89, 0x7A, 0xA0, 0x6F, 0x72, 0x4F, 0x09, 0xA7, 0xB9, 0xFB, 0xBB, 0x90, 0x7F, 0x0F, 0xBB, 0x40,
+    0x91, 0x78, 0x3B, 0xA5, 0xA8, 0xD2, 0xD8, 0xAF, 0xD4, 0x51, 0x8B, 0x4A, 0x1E, 0x27, 0x2A, 0x0D,
+    0xB4, 0xA2, 0xD6, 0x48, 0x2F, 0xEA, 0x37, 0x02, 0xEA, 0x9B, 0xFA, 0xD5, 0x39, 0x5F, 0xFB, 0xA6,
+    0x7E, 0x39, 0x9A, 0xA5, 0x6F, 0xEA, 0x17, 0x97, 0x22, 0xF6, 0x9D, 0xBB, 0xAE, 0x72, 0xEE, 0x3B,
+    0xF7, 0x43, 0xD9, 0xA0, 0xCE, 0x79, 0x3D, 0x1F, 0xE4, 0x9D, 0x97, 0x06, 0x79, 0x37, 0xB4, 0xF2,
+    0xF2, 0x6E, 0x70, 0xA9, 0xA8, 0xD5, 0xC8, 0xBB, 0xC1, 0x0A, 0x79, 0x37, 0xDA, 0x35, 0x93, 0x6F,
+    0xC7, 0x62, 0xC9, 0x34, 0xB4, 0xA3, 0x89, 0x99, 0x86, 0x76, 0x84, 0x5C, 0x43, 0x1B, 0x20, 0xDF,
+    0x5C, 0x94, 0xC5, 0x66, 0xDC, 0xA7, 0x79, 0xBB, 0x4C, 0xAA, 0xC9, 0x26, 0xC9, 0xD3, 0xDB, 0xDD,
+    0x38, 0x70, 0x69, 0xF0, 0x6F, 0x26, 0x1B, 0xC9, 0x23, 0x56, 0x37, 0xD5, 0x98, 0x1C, 0x55, 0x6D,
+    0x57, 0x4D, 0xC8, 0xD7, 0x31, 0x93, 0x3F, 0x13, 0xF3, 0x9B, 0xFE, 0xCC, 0x35, 0x73, 0xD3, 0xD7,
+    0xAE, 0xF8, 0x89, 0x77, 0xEE, 0x8B, 0x2F, 0x7B, 0x57, 0xBD, 0xFA, 0xAD, 0xC1, 0x59, 0x7D, 0x71,
+    0x70, 0xA5, 0xEC, 0xE0, 0xCC, 0x6A, 0x47, 0x67, 0x16, 0x3B, 0xBA, 0x2C, 0xDA, 0xD1, 0x35, 0xDF,
+    0xA9, 0x82, 0x6B, 0xB6, 0x5B, 0x44, 0xB6, 0x57, 0x95, 0xCD, 0x3B, 0xF6, 0x86, 0x09, 0x40, 0x7E,
+    0xF1, 0x89, 0xAB, 0x57, 0xAF, 0x5E, 0xBD, 0x7A, 0xED, 0x28, 0x7D, 0xDA, 0xD6, 0x39, 0xE7, 0x1C,
+    0x96, 0x7C, 0x20, 0x91, 0x5F, 0xB8, 0xC0, 0x31, 0xB0, 0x11, 0x47, 0x17, 0x80, 0xAF, 0x34, 0x1F,
+    0x32, 0x17, 0x2D, 0xB7, 0x6A, 0xEB, 0xC2, 0x09, 0x38, 0x55, 0xBE, 0xE1, 0x49, 0x1C, 0x0D, 0xB2,
+    0xF9, 0x1A, 0x60, 0x7F, 0x14, 0x01, 0x67, 0x26, 0xC8, 0xE7, 0x72, 0x04, 0x3B, 0x24, 0xAF, 0xA9,
+    0x6B, 0xC8, 0x67, 0x7A, 0xB0, 0x43, 0x16, 0xA1, 0xDD, 0xD8, 0xAE, 0x65, 0xC0, 0x0E, 0xD8, 0x64,
+    0xE3, 0xF8, 0xE4, 0x67, 0xAF, 0x24, 0xAD, 0x48, 0x52, 0x1A, 0xAC, 0x53, 0x72, 0x56, 0xAA, 0x81,
+    0xF6, 0xC5, 0x08, 0xA8, 0xC9, 0x46, 0xF6, 0xD8, 0xC3, 0x62, 0xBB, 0xAA, 0x43, 0xF2, 0xC9, 0xC1,
+    0xF3, 0xBE, 0x35, 0xE8, 0x9F, 0xF1, 0x99, 0xD6, 0x90, 0xAD, 0xCF, 0x47, 0x22, 0x3D, 0xC7, 0x58,
+    0xBF, 0x4F, 0x3E, 0x59, 0xB8, 0x5A, 0x78, 0xAA, 0xAF, 0x07, 0xCA, 0xF1, 0x18, 0x13, 0xAB, 0x26,
+    0x97, 0x59, 0xBF, 0x24, 0x2F, 0x29, 0x54, 0x89, 0xD2, 0xF6, 0x64, 0x53, 0xAE, 0xC5, 0x80, 0xF5,
+    0x55, 0x07, 0x2D, 0x3D, 0xE4, 0x31, 0x8F, 0x60, 0x27, 0x3B, 0x81, 0x1B, 0xDD, 0x87, 0xE8, 0x34,
+    0xAE, 0x21, 0x79, 0xD9, 0x37, 0x58, 0x85, 0x76, 0x02, 0xF2, 0x9B, 0x01, 0xB0, 0x2F, 0x7B, 0xE0,
+    0xA8, 0xEE, 0xC0, 0x4C, 0x2D, 0x60, 0xFD, 0x02, 0x5C, 0xCB, 0x67, 0x30, 0x53, 0x72, 0x36, 0xDB,
+    0x61, 0x9B, 0x98, 0xCC, 0x44, 0x0B, 0x95, 0x67, 0x85, 0x95, 0x34, 0x3F, 0x99, 0x89, 0x5A, 0x52,
+    0x40, 0x4A, 0x44, 0x03, 0xA9, 0x73, 0x92, 0x92, 0x94, 0x5B, 0xCA, 0x19, 0xCA, 0xD9, 0x0D, 0x50,
+    0xBD, 0x29, 0xC0, 0x0D, 0x44, 0x22, 0x6D, 0xD3, 0x52, 0x0F, 0xF5, 0x60, 0x67, 0x3B, 0x99, 0xD5,
+    0xAC, 0xEF, 0x7D, 0xE8, 0x7C, 0xAD, 0x28, 0x74, 0xD3, 0x17, 0xEF, 0xF4, 0xC1, 0x84, 0x3C, 0xE6,
+    0x01, 0xC7, 0x4C, 0x39, 0xEC, 0x91, 0x4F, 0x15, 0x1C, 0x15, 0x9E, 0xFA, 0x1B, 0x01, 0x1B, 0x2E,
+    0x50, 0x46, 0x7B, 0xE3, 0xBC, 0xCC, 0xC6, 0xA3, 0x0D, 0x85, 0x96, 0x0B, 0xD4, 0x73, 0xB5, 0xBD,
+    0x84, 0xEC, 0x89, 0xA4, 0x63, 0x28, 0x26, 0xD6, 0xAC, 0x62, 0xD2, 0x69, 0x35, 0x41, 0xB6, 0xB9,
+    0x57, 0xCD, 0xCD, 0x6D, 0x50, 0xFD, 0x6A, 0xD3, 0x90, 0xAF, 0xA7, 0xB2, 0x7A, 0x3A, 0x95, 0x2E,
+    0x35, 0x1F, 0xD7, 0x32, 0x1D, 0x7C, 0x05, 0x88, 0x48, 0x82, 0x7C, 0x4E, 0xA5, 0x09, 0xC9, 0x6F,
+    0x5B, 0x8E, 0x49, 0xA9, 0xAE, 0x7C, 0x82, 0x21, 0x5D, 0x97, 0x8E, 0xDB, 0x5F, 0x3C, 0x97, 0x70,
+    0x92, 0xA4, 0xD8, 0x65, 0x5B, 0x69, 0x12, 0x9E, 0x99, 0x5C, 0x55, 0x52, 0xB4, 0x21, 0x95, 0xF5,
+    0x98, 0x1C, 0xE9, 0x2E, 0x39, 0xD4, 0xEF, 0x68, 0x9D, 0xE2, 0x06, 0xE4, 0x6B, 0x55, 0x69, 0xA4,
+    0xD0, 0xCD, 0x37, 0x86, 0x9A, 0xE2, 0x9D, 0x5E, 0x4D, 0x36, 0x9A, 0x90, 0xAB, 0xE3, 0x6C, 0x1E,
+    0x70, 0xFE, 0xAE, 0xF3, 0xDD, 0x9C, 0x8C, 0x92, 0x3D, 0x72, 0x49, 0x7F, 0x5E, 0x41, 0x7B, 0x0E,
+    0x8A, 0xC4, 0xC3, 0xC8, 0x43, 0x92, 0x10, 0x17, 0x28, 0x05, 0xD8, 0x1B, 0xE7, 0x75, 0x83, 0x8F,
+    0x6F, 0x4F, 0xD3, 0xB4, 0x92, 0xA4, 0xA1, 0xD0, 0xD2, 0x4A, 0x13, 0xF5, 0x5C, 0xFD, 0xBB, 0xBA,
+    0xC8, 0xC7, 0xC9, 0xBB, 0x3D, 0x2C, 0x13, 0x2F, 0x64, 0x92, 0xCF, 0xB5, 0xEC, 0x68, 0x05, 0x3B,
+    0x10, 0xF4, 0xE0, 0xE0, 0xE0, 0x0B, 0x92, 0x6A, 0x29, 0x1E, 0x6F, 0x34, 0x06, 0x9F, 0xFC, 0x5E,
+    0xBB, 0xC3, 0x9F, 0x1F, 0x3C, 0x51, 0x4B, 0x53, 0x2F, 0xFD, 0xF8, 0x7D, 0xCF, 0x1E, 0xD4, 0x52,
+    0xEC, 0xA5, 0xB7, 0x24, 0xBD, 0x24, 0x89, 0xBC, 0xE1, 0x92, 0xE9, 0xDE, 0x45, 0x97, 0x7D, 0xF0,
+    0xFF, 0x5F, 0xDE, 0x68, 0xD6, 0xBF, 0x46, 0x2D, 0x35, 0xB5, 0x34, 0xD6, 0xD2, 0x74, 0x3F, 0x55,
+    0x4C, 0x93, 0x3E, 0xD7, 0x92, 0x41, 0x9C, 0x1D, 0xFD, 0xE7, 0xD2, 0xDA, 0x4A, 0x8B, 0xFB, 0x36,
+    0x87, 0x67, 0x60, 0xB6, 0xE4, 0xC1, 0x0C, 0xD5, 0x80, 0xD4, 0xF0, 0xE0, 0x6B, 0x64, 0xFD, 0x6B,
+    0x54, 0xB7, 0xAE, 0x31, 0xDF, 0x76, 0x8D, 0xA3, 0x9D, 0x11, 0xFD, 0xB7, 0xA5, 0xD5, 0x49, 0x8B,
+    0xFB, 0x23, 0x0E, 0x3F, 0xF5, 0x9E, 0x6B, 0x4C, 0x9B, 0xC0, 0xAE, 0x7D, 0xED, 0x6B, 0xEF, 0x76,
+    0x7F, 0x43, 0xFB, 0xA1, 0xB6, 0xCB, 0x5F, 0xE3, 0xB3, 0x77, 0x1F, 0xF5, 0xD9, 0x77, 0xD7, 0x28,
+    0x86, 0x6A, 0xB0, 0xD2, 0x60, 0x6F, 0x6A, 0xAC, 0x42, 0x35, 0xD6, 0xA1, 0x0E, 0x0F, 0x9C, 0x7B,
+    0xE0, 0x1C, 0x94, 0x43, 0x39, 0xA4, 0xD1, 0x90, 0x18, 0xED, 0x6B, 0x32, 0x43, 0x8B, 0x98, 0x18,
+    0x9B, 0x75, 0xA8, 0xC3, 0x5F, 0x6A, 0x82, 0x98, 0x48, 0xEB, 0xCB, 0x99, 0x22, 0xB2, 0xE2, 0x3C,
+    0x76, 0x32, 0xB3, 0x59, 0x92, 0xBE, 0x55, 0x05, 0xA8, 0x47, 0xD7, 0x09, 0x70, 0x7E, 0x2D, 0x67,
+    0xA0, 0x7D, 0x3A, 0x3A, 0x0F, 0xE8, 0xC9, 0x5F, 0x25, 0xBD, 0xB7, 0x7D, 0x35, 0x6C, 0xAE, 0x98,
+    0x8D, 0x56, 0x31, 0xDF, 0x6E, 0x78, 0x6D, 0x66, 0xD1, 0xCE, 0xE5, 0x99, 0x6D, 0xEC, 0x8B, 0x4A,
+    0x9B, 0x82, 0xB9, 0x21, 0x50, 0x4A, 0x66, 0x9C, 0x52, 0x69, 0xD5, 0xAF, 0x1A, 0x41, 0x37, 0xF4,
+    0x2B, 0x8D, 0x58, 0xBD, 0xA8, 0x17, 0x35, 0xA2, 0x58, 0xAB, 0xD4, 0x68, 0x35, 0xF4, 0xD1, 0x6A,
+    0xD4, 0x6A, 0x34, 0x59, 0x8D, 0x10, 0xB3, 0x08, 0x14, 0xA1, 0x08, 0x40, 0x3D, 0xD4, 0x03, 0xA0,
+    0x46, 0x0D, 0x98, 0xD5, 0x2C, 0x1F, 0x5A, 0xFD, 0x53, 0x97, 0xF2, 0x4B, 0xF9, 0x25, 0xEC, 0x60,
+    0x7D, 0xED, 0xA9, 0xBC, 0xCB, 0x22, 0x38, 0x1F, 0xED, 0x08, 0xEE, 0xB1, 0xD0, 0x03, 0x6D, 0x75,
+    0x7D, 0x02, 0xD6, 0xD6, 0x75, 0xC0, 0xBA, 0x6E, 0x50, 0xE6, 0xB0, 0xE3, 0xB0, 0x42, 0x91, 0x2A,
+    0x55, 0x6B, 0xB8, 0x75, 0xAA, 0xD6, 0xA6, 0x2B, 0x6B, 0x4C, 0x42, 0x72, 0x24, 0xD7, 0xAB, 0x51,
+    0x23, 0x75, 0x6C, 0x83, 0x46, 0xA3, 0x1F, 0xE9, 0x47, 0x1A, 0xDD, 0x52, 0xEA, 0xF3, 0x1A, 0x1D,
+    0x8E, 0x25, 0x5B, 0x8A, 0xB9, 0x9C, 0xEA, 0xB1, 0x1E, 0xFB, 0xEE, 0x0E, 0x09, 0x70, 0x4A, 0x23,
+    0xD2, 0x6C, 0xDE, 0x79, 0x7E, 0x4E, 0x4E, 0x81, 0x62, 0x4C, 0xC8, 0xC6, 0x3E, 0xE4, 0x53, 0x76,
+    0xD0, 0x77, 0x56, 0x53, 0x32, 0x07, 0xAB, 0xE4, 0xD9, 0x4A, 0x5E, 0x2F, 0xE0, 0x6A, 0x43, 0xF1,
+    0xD6, 0x48, 0xFF, 0x92, 0xB4, 0xD6, 0x52, 0xE8, 0x25, 0xCE, 0xEB, 0x22, 0xB7, 0x88, 0xC3, 0xD7,
+    0xDF, 0x4B, 0x1C, 0x3E, 0x47, 0xA6, 0x89, 0xFB, 0xF3, 0x21, 0x21, 0x69, 0x5F, 0x85, 0x12, 0xF2,
+    0x01, 0x37, 0x91, 0x3F, 0xDF, 0xA5, 0x0B, 0x07, 0xB0, 0x0D, 0x79, 0x30, 0x12, 0x4E, 0x7E, 0xF3,
+    0xD9, 0x9A, 0x44, 0x36, 0x6C, 0xC8, 0x92, 0x53, 0xA4, 0xF2, 0x14, 0x81, 0x3C, 0x42, 0x0F, 0xF6,
+    0x46, 0x02, 0x82, 0x8B, 0x90, 0xA0, 0xA9, 0xC4, 0x38, 0xCE, 0x62, 0xE1, 0xDD, 0x0F, 0xA4, 0x58,
+    0x4B, 0x4D, 0xAB, 0x90, 0x26, 0xD1, 0xF7, 0x5C, 0xCC, 0x35, 0xD8, 0x01, 0x33, 0xC3, 0x0A, 0x6D,
+    0x87, 0x9D, 0x40, 0x13, 0x77, 0x9D, 0x1F, 0xA1, 0x6E, 0x6E, 0xB1, 0x98, 0x33, 0x2A, 0x7F, 0xB5,
+    0x88, 0xB5, 0xF4, 0x75, 0x69, 0x32, 0x5A, 0xC8, 0xBE, 0xB7, 0xCD, 0x55, 0xBD, 0x04, 0x2E, 0xBD,
+    0x9E, 0x3B, 0x47, 0xF7, 0x39, 0xD2, 0x40, 0xBC, 0xFB, 0x52, 0xDB, 0x50, 0xC6, 0x6A, 0xC0, 0xA8,
+    0x98, 0xC9, 0xE5, 0x57, 0xD0, 0xE4, 0x3A, 0xFA, 0xC5, 0x06, 0x9C, 0x1E, 0x8B, 0x54, 0x6F, 0x8C,
+    0xC2, 0xFE, 0x7A, 0x76, 0xBE, 0x98, 0x57, 0x1B, 0x4C, 0x6C, 0xAF, 0xC7, 0x6C, 0xAD, 0x82, 0x50,
+    0x11, 0xEB, 0xA1, 0xFD, 0xBA, 0xCA, 0xC9, 0xF9, 0xF6, 0x87, 0x4B, 0x35, 0x56, 0xA1, 0xFF, 0x56,
+    0x28, 0x96, 0xFA, 0xF5, 0x39, 0xD3, 0xE3, 0xEF, 0x44, 0xDA, 0x1F, 0x49, 0x54, 0x73, 0xAB, 0xA6,
+    0x58, 0x2B, 0xF9, 0x4C, 0x4F, 0x6B, 0xA0, 0x0D, 0x0A, 0xC9, 0x35, 0xD5, 0xDC, 0x2D, 0x05, 0x2B,
+    0x85, 0xBB, 0x9A, 0xBF, 0x5E, 0x56, 0x6E, 0x3E, 0xE5, 0x13, 0xAC, 0x2C, 0xE0, 0xBA, 0xB6, 0xA3,
+    0x0A, 0x75, 0xA0, 0x8C, 0x65, 0x7C, 0x1F, 0x40, 0x22, 0x85, 0x72, 0x64, 0xFF, 0x72, 0xA1, 0x1C,
+    0xFD, 0x93, 0x7F, 0x8D, 0xA1, 0x1C, 0x76, 0xB0, 0xDE, 0x0E, 0xD5, 0x50, 0x8D, 0xD5, 0x50, 0x8F,
+    0xE9, 0xEF, 0xAF, 0xB3, 0x35, 0x28, 0xBD, 0xF5, 0xE0, 0x1A, 0xD7, 0x90, 0xAD, 0xD9, 0x02, 0xE5,
+    0x5C, 0xCE, 0x3B, 0x67, 0xC4, 0xFB, 0x88, 0xFE, 0x1B, 0x6C, 0x48, 0x43, 0xA9, 0x37, 0x34, 0xA0,
+    0x31, 0xD3, 0x50, 0x2E, 0x20, 0xEF, 0x06, 0xD0, 0x37, 0x56, 0xC8, 0x64, 0x03, 0x98, 0xC5, 0x79,
+    0x28, 0xDE, 0x5E, 0x00, 0xFB, 0x7A, 0x00, 0xDC, 0xB3, 0x1E, 0xE8, 0x5B, 0x20, 0x5F, 0x22, 0x50,
+    0x6E, 0x5F, 0x0F, 0xC0, 0xEA, 0x3C, 0x94, 0x93, 0x3C, 0xF4, 0x3F, 0xD4, 0xDB, 0x59, 0xD2, 0xB4,
+    0x34, 0x97, 0x92, 0xE4, 0xAD, 0xA4, 0x15, 0x2B, 0x29, 0x45, 0x61, 0x41, 0xD6, 0xAF, 0xBB, 0x8E,
+    0x51, 0x0E, 0xE5, 0xE0, 0x3A, 0xD7, 0xAD, 0xAC, 0x45, 0x2C, 0xE2, 0xFB, 0x48, 0xFA, 0xAC, 0x1F,
+    0x70, 0x9A, 0xCC, 0x5C, 0x84, 0xAA, 0x31, 0x21, 0x52, 0xBC, 0x32, 0x60, 0x9F, 0x05, 0x77, 0x0C,
+    0x6B, 0xC0, 0xFC, 0x7A, 0xC0, 0x3E, 0xEB, 0x59, 0xDD, 0x3B, 0xCF, 0x4F, 0xAD, 0xD4, 0x49, 0x11,
+    0x69, 0xE0, 0xFC, 0x04, 0xB9, 0x5E, 0x83, 0x52, 0x1A, 0xA8, 0xA4, 0x05, 0xBB, 0xFE, 0x9E, 0x06,
+    0x3B, 0x53, 0xC4, 0x62, 0x86, 0xF6, 0xF3, 0x11, 0x6C, 0x58, 0x21, 0x8B, 0x89, 0x51, 0x7B, 0x53,
+    0xD2, 0x9F, 0x48, 0xD2, 0xB4, 0xDE, 0xA2, 0xD9, 0x06, 0x70, 0x3F, 0x5C, 0xA1, 0x0A, 0xED, 0xC4,
+    0xF9, 0xD9, 0x2A, 0xA9, 0x02, 0x5A, 0x13, 0xFA, 0x99, 0x26, 0x8C, 0x84, 0x64, 0x7D, 0xF2, 0x22,
+    0x50, 0xDF, 0x20, 0x97, 0xBA, 0x72, 0x7D, 0x3E, 0x54, 0x3E, 0x9F, 0xDC, 0x6D, 0x8C, 0xDA, 0x5E,
+    0x5A, 0xFB, 0xE7, 0xBE, 0x77, 0xED, 0x43, 0x19, 0xB5, 0x8E, 0x7D, 0xA8, 0x7C, 0xE5, 0x29, 0xA7,
+    0x32, 0x60, 0x96, 0xC4, 0x75, 0x55, 0xF7, 0x91, 0x90, 0xB8, 0xBF, 0x89, 0x2A, 0x97, 0x43, 0x39,
+    0xD8, 0xD1, 0x8E, 0x76, 0xAC, 0xC6, 0x2A, 0x54, 0xE1, 0x43, 0xE7, 0xEB, 0xBF, 0x62, 0xF3, 0x54,
+    0x5D, 0xD5, 0x51, 0xFB, 0xDA, 0x27, 0x50, 0xC4, 0x0D, 0xCE, 0xF3, 0xC1, 0x4A, 0xCF, 0x29, 0x5D,
+    0x84, 0x56, 0x0B, 0xD9, 0x9A, 0xF5, 0x5D, 0x11, 0xB0, 0xA3, 0xF5, 0x98, 0xA9, 0xEE, 0xC8, 0xE2,
+    0x27, 0x37, 0xBB, 0x94, 0xAB, 0xC9, 0x2F, 0x65, 0x24, 0xDD, 0x96, 0xED, 0xA4, 0x48, 0x0F, 0xB0,
+    0x7E, 0xE5, 0x22, 0xC5, 0xDA, 0xAE, 0xFF, 0xA4, 0x5F, 0x9C, 0x92, 0x8C, 0xD7, 0x6C, 0x25, 0x05,
+    0x23, 0xA9, 0xE3, 0xBC, 0xFE, 0x7C, 0xB3, 0xA0, 0x9B, 0xBA, 0x71, 0x9D, 0xEB, 0x92, 0x3A, 0xD6,
+    0xFA, 0xD6, 0xF7, 0xFE, 0xDD, 0x0A, 0x58, 0x75, 0x53, 0xCD, 0x23, 0x54, 0xC3, 0x7D, 0x98, 0xB0,
+    0x59, 0xC4, 0x11, 0x58, 0xB0, 0x5A, 0x36, 0x45, 0x63, 0x81, 0x2C, 0xDE, 0x8F, 0x99, 0xCF, 0x9C,
+    0x3B, 0x1F, 0x6A, 0x69, 0xA8, 0xA4, 0x26, 0xEB, 0x5F, 0x03, 0xB8, 0xEF, 0x54, 0xAF, 0xC9, 0x4A,
+    0xF3, 0x5D, 0xE7, 0xEE, 0xAC, 0xED, 0x77, 0xE1, 0xF7, 0x6F, 0x8B, 0x09, 0x8B, 0x27, 0x31, 0x61,
+    0xD3, 0xED, 0x31, 0x61, 0xF6, 0xC3, 0x63, 0xC2, 0xF2, 0x0F, 0x8E, 0x09, 0x83, 0xEC, 0x9C, 0x49,
+    0xE3, 0x7A, 0xFE, 0x9B, 0x0A, 0x84, 0x28, 0xC7, 0x72, 0xB4, 0x61, 0xF7, 0x57, 0x85, 0x2A, 0x54,
+    0x77, 0xF4, 0xB5, 0x27, 0xE0, 0xFE, 0xAB, 0x70, 0xD5, 0x41, 0xAC, 0x3B, 0xA2, 0xF5, 0xF9, 0x5C,
+    0x6E, 0x6D, 0x90, 0xC7, 0x22, 0xB5, 0x41, 0xBF, 0xB5, 0x41, 0xBD, 0xB5, 0x41, 0xF9, 0xD1, 0xDB,
+    0xA0, 0x18, 0x8B, 0xB1, 0x0C, 0x65, 0x28, 0x83, 0x0D, 0x76, 0x4A, 0x7F, 0x7F, 0x53, 0x6D, 0x41,
+    0x31, 0x50, 0x0C, 0xF9, 0x44, 0x3E, 0xB1, 0xC0, 0x42, 0xDB, 0xD0, 0x36, 0x0F, 0x34, 0x3C, 0xF0,
+    0x41, 0xF8, 0xC8, 0x31, 0x5C, 0xA0, 0x18, 0x13, 0xCD, 0x8A, 0x48, 0x36, 0x53, 0x75, 0xD8, 0x21,
+    0x9F, 0x37, 0xE4, 0xC3, 0xCC, 0x26, 0x40, 0xE5, 0x7B, 0x60, 0xB5, 0x23, 0x14, 0xD3, 0x02, 0xB8,
+    0x57, 0x3D, 0x64, 0x4A, 0xBC, 0x93, 0x6E, 0x07, 0x10, 0x24, 0x32, 0x43, 0x1D, 0x4E, 0x28, 0x1B,
+    0x6E, 0x48, 0xA4, 0xFB, 0xCD, 0xEB, 0x5F, 0x2B, 0xEC, 0x58, 0x84, 0x6E, 0x3D, 0x01, 0x1C, 0x77,
+    0x82, 0x9F, 0x72, 0xB0, 0x43, 0x0A, 0x1F, 0xAA, 0x86, 0x7A, 0xA0, 0x1E, 0x3E, 0x92, 0x7C, 0xAB,
+    0x3A, 0xAC, 0x37, 0x81, 0x62, 0xE4, 0x88, 0x7C, 0xC2, 0x0E, 0x44, 0xB2, 0x88, 0x03, 0xD7, 0xD4,
+    0x1D, 0x45, 0xB0, 0x03, 0xAC, 0x26, 0x40, 0xF5, 0xA3, 0x08, 0x26, 0xAE, 0x40, 0xDB, 0x77, 0x60,
+    0x35, 0xEC, 0x58, 0xC7, 0x2E, 0x9E, 0xE0, 0x64, 0xEF, 0x82, 0xC2, 0xAB, 0x09, 0x38, 0x1F, 0x37,
+    0x42, 0x75, 0x9E, 0xB0, 0x80, 0x99, 0xAD, 0xC5, 0xAD, 0xB7, 0xBE, 0x6D, 0xDA, 0x7C, 0xC9, 0x17,
+    0x3B, 0xDB, 0xE9, 0x5D, 0xFA, 0xE6, 0xFD, 0xF0, 0xEF, 0x07, 0xCC, 0x4F, 0x3C, 0xF6, 0x3C, 0x9C,
+    0x3D, 0x86, 0x77, 0x02, 0xE6, 0x97, 0x9E, 0xEA, 0x79, 0x38, 0x3A, 0x26, 0x7B, 0x27, 0x50, 0xFE,
+    0xD2, 0xE3, 0x9E, 0xED, 0xF2, 0xD5, 0x75, 0xF5, 0x2C, 0x29, 0x48, 0x6F, 0x78, 0xCD, 0x2D, 0x0F,
+    0xE4, 0x31, 0xB1, 0x7F, 0x6A, 0x4F, 0x82, 0x6F, 0xA0, 0x0C, 0x55, 0x57, 0x3D, 0x16, 0xCD, 0xEC,
+    0xBC, 0xBB, 0x1E, 0x4D, 0x6C, 0x7D, 0xEB, 0xEF, 0x6C, 0x8E, 0xDF, 0xE2, 0xCB, 0x45, 0x53, 0xF2,
+    0x35, 0x2E, 0x17, 0x4D, 0xD9, 0x7C, 0x8D, 0x2B, 0xA9, 0x98, 0x0A, 0x5F, 0x35, 0xFB, 0x5F, 0x9A,
+    0x72, 0xA9, 0x29, 0xE6, 0x29, 0xB9, 0x4F, 0xE7, 0xA4, 0xAE, 0xCE, 0x0F, 0x1C, 0x1C, 0xFC, 0x7D,
+    0x49, 0xAF, 0x4B, 0x7A, 0xF6, 0xC3, 0xE3, 0x06, 0x3C, 0xB4, 0xEF, 0x8A, 0x1B, 0x68, 0xEE, 0x8C,
+    0x1B, 0x18, 0xC8, 0xB5, 0xC5, 0x04, 0xEE, 0x25, 0x6D, 0x3A, 0xEF, 0xE0, 0x77, 0x9F, 0xFB, 0x8E,
+    0xF4, 0x33, 0x8F, 0x85, 0x3D, 0x08, 0x18, 0x8F, 0x6D, 0xB8, 0x40, 0x36, 0x51, 0x0C, 0x54, 0x0D,
+    0x47, 0x64, 0x33, 0xC5, 0x0C, 0x97, 0xC8, 0x3B, 0xEE, 0x62, 0x53, 0x63, 0x36, 0xE5, 0x8E, 0x62,
+    0x2E, 0xE6, 0x64, 0xF8, 0x8D, 0xC0, 0xBB, 0xAC, 0x88, 0x0F, 0xFD, 0x64, 0xB2, 0x1D, 0x60, 0xE2,
+    0x7E, 0x82, 0x39, 0x13, 0x0E, 0xF8, 0xF4, 0xC8, 0x16, 0xA7, 0x01, 0x66, 0x4E, 0xA7, 0xC6, 0x3B,
+    0x4F, 0xE9, 0x06, 0x98, 0xE8, 0xA4, 0x06, 0x1B, 0x66, 0x5A, 0x70, 0xD7, 0x03, 0x0E, 0x64, 0x3D,
+    0x87, 0x98, 0xE8, 0x60, 0xC2, 0x86, 0x88, 0x19, 0x70, 0xD7, 0x03, 0x55, 0x83, 0xAC, 0xCF, 0x23,
+    0x66, 0x71, 0x52, 0xA0, 0x9A, 0x24, 0x35, 0xB4, 0x7F, 0x22, 0x4D, 0x64, 0xFA, 0x96, 0xDE, 0x81,
+    0x62, 0xE5, 0x2A, 0x57, 0x37, 0x83, 0x76, 0xCD, 0x56, 0x32, 0x65, 0x3A, 0x89, 0x43, 0x79, 0xFF,
+    0xCF, 0x35, 0x60, 0xEF, 0x24, 0x3B, 0x3C, 0xBA, 0x33, 0x6B, 0xF5, 0x1A, 0x87, 0xED, 0x73, 0x3D,
+    0x87, 0xFB, 0x94, 0xFE, 0x70, 0x1F, 0x33, 0x5C, 0x70, 0xE4, 0xE3, 0x05, 0x87, 0x19, 0xAF, 0x3A,
+    0xAA, 0xE1, 0xAA, 0x93, 0xFC, 0x55, 0x27, 0x35, 0x57, 0x9D, 0x5E, 0xE3, 0xEA, 0xDD, 0x1D, 0x9C,
+    0xBA, 0xB8, 0x7B, 0x9F, 0x89, 0x0A, 0x03, 0x4B, 0x9A, 0xD8, 0xFA, 0x84, 0xCA, 0xBA, 0xCE, 0xCC,
+    0xEC, 0xE8, 0x30, 0x89, 0xAA, 0xBE, 0x23, 0xC4, 0xEC, 0x18, 0x31, 0xBB, 0xC0, 0x97, 0xC4, 0x89,
+    0x61, 0x9B, 0xE1, 0x13, 0x2B, 0x26, 0xD1, 0x62, 0x36, 0x87, 0x0A, 0xC5, 0xAA, 0x86, 0x1D, 0x33,
+    0x86, 0x3A, 0x05, 0xDB, 0x24, 0x6E, 0x4C, 0x22, 0xC7, 0x24, 0x76, 0x4C, 0x93, 0xE8, 0x31, 0x37,
+    0x87, 0x2A, 0x82, 0x34, 0xB9, 0xE9, 0x24, 0x78, 0x61, 0x73, 0x7E, 0x96, 0xEB, 0x1D, 0x72, 0xCC,
+    0x36, 0x1C, 0x52, 0x78, 0x26, 0xF2, 0x90, 0x07, 0x98, 0x0B, 0x0F, 0xC7, 0xB6, 0xD9, 0x60, 0xDD,
+    0x2A, 0x9E, 0x38, 0xB2, 0x4E, 0x5C, 0x5A, 0xD5, 0x42, 0xE2, 0x61, 0xB2, 0xD6, 0x9E, 0x3C, 0xDA,
+    0x91, 0x62, 0x2A, 0xE6, 0xFB, 0xEC, 0x98, 0x6B, 0x72, 0x3E, 0x3D, 0x77, 0x3B, 0x6E, 0x9E, 0x56,
+    0xBD, 0x94, 0xD0, 0x25, 0x7F, 0xE7, 0xAE, 0xD6, 0x5B, 0xD9, 0x57, 0x9E, 0x7B, 0xEE, 0xB9, 0xE7,
+    0x9E, 0x7B, 0xEE, 0x7C, 0x42, 0xC2, 0x7E, 0x92, 0x8A, 0xDD, 0x04, 0x70, 0x9A, 0x87, 0xF7, 0x38,
+    0xB3, 0xC7, 0x23, 0xEF, 0xB7, 0x9D, 0xDD, 0x63, 0xEF, 0x90, 0xBD, 0xA7, 0xDE, 0x6F, 0x7B, 0x81,
+    0xBD, 0x17, 0xD8, 0xBB, 0x72, 0xDB, 0xD6, 0x4B, 0xD2, 0x1B, 0x92, 0x74, 0x53, 0x1B, 0x20, 0x79,
+    0x47, 0xD8, 0x91, 0x24, 0xAD, 0x92, 0xA4, 0x7E, 0x83, 0x0A, 0x6D, 0xB4, 0xB3, 0x9D, 0xAA, 0x50,
+    0x85, 0x7A, 0x74, 0x43, 0xEB, 0xA1, 0x1D, 0xDC, 0xE8, 0xC6, 0x3A, 0x54, 0xC1, 0x86, 0x72, 0x4E,
+    0x50, 0xCA, 0x7B, 0x7F, 0xE5, 0x7E, 0xAA, 0x4E, 0xD7, 0x95, 0xAB, 0x8C, 0x45, 0xAC, 0x82, 0x0D,
+    0xCE, 0xBB, 0x41, 0x4D, 0xFF, 0xC3, 0x75, 0x63, 0x88, 0xC3, 0xA9, 0x14, 0xCD, 0x99, 0x85, 0x14,
+    0x28, 0x58, 0x7D, 0xE8, 0xE1, 0x79, 0x05, 0x49, 0x3F, 0xD1, 0x8D, 0x03, 0xCC, 0x9D, 0x82, 0xC1,
+    0x0C, 0x49, 0x0C, 0x9D, 0x4D, 0xAB, 0x05, 0x7C, 0xF4, 0xC3, 0x2B, 0x29, 0xFE, 0x20, 0x6B, 0x20,
+    0x4B, 0xBE, 0x3A, 0x6C, 0xF3, 0xD1, 0xD3, 0x93, 0xC9, 0x27, 0xD5, 0xEA, 0xDB, 0x4F, 0xDC, 0xFA,
+    0xBE, 0xFB, 0x80, 0xF4, 0xDF, 0x37, 0x55, 0xE2, 0x8F, 0xFA, 0x07, 0x9E, 0xEC, 0x3E, 0xF8, 0x77,
+    0x65, 0x07, 0xA6, 0xDB, 0x98, 0xD8, 0xDD, 0x26, 0x79, 0x34, 0xD3, 0x26, 0x1D, 0xD9, 0xDB, 0xA4,
+    0x19, 0xC6, 0x4C, 0x52, 0xD3, 0x27, 0x4F, 0xDD, 0x6C, 0x37, 0x9E, 0xE6, 0x0F, 0x94, 0x00, 0x8C,
+    0xE8, 0x24, 0x7D, 0x71, 0x53, 0xC0, 0x6F, 0x48, 0xD2, 0x57, 0x9E, 0x7B, 0xEE, 0xB9, 0x06, 0xFE,
+    0x01, 0xD7, 0xE8, 0xC7, 0x3E, 0xF6, 0x53, 0xDF, 0x5C, 0x01, 0xAA, 0xC7, 0x66, 0x77, 0x3D, 0xB6,
+    0x7E, 0x57, 0x5E, 0xBD, 0x7A, 0x75, 0xD7, 0x13, 0xF6, 0x3E, 0xDE, 0x61, 0xF3, 0x7F, 0x9B, 0x6C,
+    0xFC, 0xCC, 0x67, 0xD8, 0x33, 0x7F, 0x87, 0xB2, 0xFB, 0x3B, 0x9F, 0x21, 0x98, 0xC7, 0x39, 0x8B,
+    0x1B, 0x0B, 0xCF, 0xCC, 0x44, 0x0A, 0x6A, 0x31, 0x7E, 0x8B, 0xB5, 0xAF, 0x76, 0x7C, 0xF4, 0xE3,
+    0xAD, 0x25, 0x4D, 0x68, 0xE0, 0xC2, 0xBF, 0xF1, 0x1B, 0x8D, 0xFD, 0xAF, 0xFF, 0x9D, 0xFF, 0x2E,
+    0x0F, 0xFF, 0xE1, 0xFF, 0xF8, 0x5B, 0xFB, 0xA7, 0xFE, 0xD6, 0x37, 0xAC, 0xFF, 0xB7, 0xFE, 0xDE,
+    0x4F, 0xA7, 0x6C, 0x3C, 0x7C, 0xE0, 0x56, 0xCF, 0xB1, 0xC1, 0x9E, 0xF4, 0x1C, 0x1B, 0x5D, 0x70,
+    0xA3, 0x3A, 0x3D, 0xB6, 0x98, 0x58, 0x05, 0x1B, 0x5A, 0xDF, 0x7F, 0x63, 0x35, 0x8B, 0x9D, 0xAA,
+    0x70, 0xFB, 0x34, 0x95, 0x37, 0xA6, 0xF9, 0x38, 0x95, 0xAF, 0xBB, 0x96, 0x25, 0x8B, 0x66, 0x2A,
+    0x46, 0xEB, 0xEB, 0xC6, 0x71, 0x81, 0x39, 0x0F, 0x66, 0x2C, 0xBD, 0x6D, 0x3E, 0x75, 0x12, 0x56,
+    0x04, 0x77, 0xE3, 0xA8, 0x7C, 0x39, 0x98, 0xC0, 0xC4, 0x1F, 0x6C, 0xB1, 0xA5, 0x77, 0xE3, 0xCC,
+    0x94, 0xCD, 0x95, 0x2F, 0x87, 0xAB, 0x38, 0x13, 0x98, 0x6C, 0x73, 0xCA, 0xFF, 0xC1, 0xAD, 0xBB,
+    0x7C, 0x9A, 0xCB, 0x5C, 0x34, 0xC1, 0x0E, 0xD6, 0x97, 0x63, 0xE5, 0xEB, 0xAE, 0x1C, 0xAA, 0xCE,
+    0x61, 0x7D, 0xCD, 0x3E, 0xB6, 0xD9, 0xE7, 0x02, 0x15, 0xA7, 0x39, 0xBC, 0x15, 0xC5, 0xD4, 0x93,
+    0xFF, 0xB2, 0x2B, 0xAF, 0x07, 0xC7, 0x02, 0x94, 0xD4, 0x89, 0xB8, 0xB0, 0x4F, 0x8F, 0xF3, 0x36,
+    0x98, 0xC8, 0xC2, 0x69, 0x7E, 0x03, 0x2E, 0x71, 0x8C, 0xC3, 0x0E, 0xF9, 0xC4, 0x55, 0x56, 0x13,
+    0x6D, 0x70, 0xDE, 0xB1, 0xC7, 0x6F, 0xB1, 0x23, 0xE6, 0xFC, 0x6E, 0xC7, 0xC2, 0xDD, 0x97, 0xF2,
+    0x95, 0x6A, 0x34, 0x91, 0x72, 0xCE, 0x57, 0xD4, 0xE0, 0x06, 0x17, 0xDC, 0x08, 0x6A, 0xB0, 0x89,
+    0x36, 0x90, 0x2B, 0xC9, 0xCE, 0xDE, 0x03, 0xF2, 0x55, 0x52, 0xA3, 0x92, 0x22, 0x52, 0xDD, 0x90,
+    0x27, 0x8B, 0xF4, 0x0A, 0x26, 0xD4, 0xDE, 0x68, 0xA1, 0x7D, 0x2C, 0x62, 0xD5, 0x14, 0x93, 0x1B,
+    0xD0, 0x44, 0xFF, 0xF4, 0x82, 0xD3, 0x60, 0x13, 0xC7, 0x7F, 0x83, 0x96, 0x52, 0x70, 0xD8, 0xA4,
+    0x00, 0xD4, 0x6B, 0x21, 0x0F, 0xA5, 0xBA, 0x4A, 0x90, 0x2B, 0xD0, 0x47, 0xE8, 0x23, 0x46, 0x81,
+    0x5A, 0x0D, 0x56, 0x5D, 0xA9, 0xC1, 0x35, 0x6E, 0xCD, 0x34, 0x9B, 0x29, 0x4B, 0x41, 0x61, 0xDD,
+    0xED, 0x1E, 0xC2, 0x0D, 0xB4, 0xBF, 0x54, 0xFA, 0x9A, 0x63, 0x13, 0xAC, 0x77, 0x44, 0x13, 0xAC,
+    0x77, 0x59, 0x2C, 0x42, 0xE5, 0xFB, 0x3C, 0x96, 0xA1, 0xF6, 0x32, 0xB1, 0x0C, 0x40, 0x39, 0xB9,
+    0x51, 0x4F, 0xAB, 0x8A, 0x7D, 0x80, 0xFB, 0x92, 0x18, 0xC8, 0x03, 0xFC, 0xEB, 0x81, 0x5C, 0x6A,
+    0xAC, 0x34, 0xBA, 0x7F, 0xA4, 0xE9, 0x61, 0xF3, 0xAB, 0x88, 0x09, 0x0B, 0x26, 0x5C, 0x7B, 0x57,
+    0x5A, 0x28, 0xDE, 0x8C, 0x14, 0xBF, 0x9A, 0x28, 0x6E, 0x06, 0x0A, 0x0D, 0x94, 0xEA, 0xA8, 0xD6,
+    0xA4, 0x8A, 0x55, 0xE1, 0x7D, 0xD2, 0x6D, 0x3A, 0xD7, 0x2E, 0x5C, 0xD0, 0x8D, 0xC9, 0xDD, 0xD7,
+    0x6E, 0xA9, 0x0F, 0x70, 0x70, 0xEE, 0x76, 0xA1, 0x0E, 0x5C, 0xE1, 0xDE, 0xAF, 0xF1, 0xF0, 0x59,
+    0x0E, 0x2B, 0x4D, 0x85, 0x3C, 0xF7, 0x6F, 0x83, 0xD7, 0x00, 0xE5, 0x27, 0x4E, 0xC3, 0x83, 0xFF,
+    0x7B, 0xB7, 0xAD, 0x62, 0x52, 0xCF, 0x50, 0xFC, 0x5F, 0x87, 0xF0, 0x1B, 0x9F, 0x05, 0x18, 0x3E,
+    0x46, 0xDE, 0x70, 0x99, 0x7B, 0x3E, 0xF6, 0xDF, 0x5E, 0xFF, 0x4F, 0x3E, 0xFB, 0xBF, 0xFE, 0xF2,
+    0xA9, 0x6A, 0xE5, 0x88, 0x62, 0xC8, 0x57, 0xAE, 0x4D, 0xFF, 0xEC, 0xA5, 0x6F, 0x7D, 0xFA, 0x9F,
+    0x3E, 0xFE, 0xB1, 0xFB, 0x2E, 0xF1, 0x10, 0x79, 0x77, 0x2B, 0x5A, 0xAE, 0x6C, 0xA0, 0xE8, 0xD2,
+    0xC0, 0xCB, 0xC6, 0x2D, 0x64, 0xEE, 0x4A, 0x12, 0x97, 0x9C, 0xDD, 0x42, 0x7E, 0xEC, 0xB6, 0x12,
+    0x46, 0xE1, 0x13, 0x35, 0x39, 0x0F, 0xDB, 0x62, 0x2A, 0x71, 0xFB, 0xE1, 0xFE, 0xF6, 0xC3, 0xAA,
+    0x4B, 0x9D, 0xAD, 0x1C, 0xB6, 0x68, 0xEE, 0x5B, 0x3E, 0x8D, 0x05, 0x1E, 0x5C, 0x1B, 0x5A, 0xCD,
+    0x38, 0x45, 0xDA, 0x5F, 0xCA, 0xBB, 0x5F, 0xCA, 0xBB, 0xA6, 0x9C, 0xEB, 0xA6, 0x8C, 0x06, 0x7A,
+    0xD3, 0xD0, 0x36, 0x89, 0xAD, 0x56, 0x8E, 0x90, 0xCF, 0x9B, 0x3F, 0xF6, 0xDA, 0x66, 0xE6, 0xD6,
+    0x5D, 0x52, 0xF7, 0xEC, 0xB8, 0x31, 0x4D, 0x43, 0x42, 0x68, 0xF3, 0x9D, 0x2F, 0x7D, 0x67, 0x95,
+    0x2A, 0x99, 0xC4, 0xF9, 0x56, 0x16, 0x6A, 0x52, 0xC0, 0x87, 0x1A, 0xCC, 0xB6, 0x9F, 0x69, 0xEB,
+    0x54, 0xAD, 0xDF, 0x08, 0xC7, 0x21, 0xF1, 0xD6, 0x8A, 0x98, 0x2C, 0x85, 0x5B, 0x3F, 0xE8, 0x52,
+    0xBD, 0x3E, 0xFE, 0xBE, 0x48, 0xC1, 0x6E, 0xDE, 0x1F, 0xD2, 0x63, 0x15, 0x73, 0x8A, 0x76, 0xC9,
+    0xB7, 0x08, 0x61, 0xE4, 0x37, 0xE2, 0xC2, 0x2D, 0x4F, 0x36, 0x90, 0x1D, 0x9C, 0xA8, 0x22, 0xD2,
+    0x02, 0xEE, 0xE2, 0xF9, 0x29, 0xFF, 0xE9, 0x80, 0xF3, 0xFB, 0x1F, 0x83, 0xC5, 0x8C, 0x60, 0xC7,
+    0x7D, 0xE0, 0x9A, 0x19, 0xA1, 0xBC, 0xB5, 0x6B, 0x87, 0x7D, 0xC8, 0x62, 0x31, 0x82, 0xEB, 0x8E,
+    0xA0, 0x0C, 0xC5, 0x48, 0xBE, 0x70, 0x0D, 0xD4, 0x95, 0x23, 0x7D, 0xE0, 0x1A, 0xF5, 0x8C, 0x1D,
+    0xF3, 0x15, 0x56, 0xEA, 0xF1, 0x7D, 0x77, 0x07, 0xEE, 0x1E, 0xB3, 0xE6, 0x5D, 0xAE, 0x09, 0xEB,
+    0x71, 0x03, 0x0B, 0xC5, 0x42, 0x35, 0xD2, 0x8E, 0xF9, 0x4A, 0x29, 0x5C, 0x40, 0x27, 0xCF, 0xFD,
+    0xC0, 0xB9, 0x1D, 0x31, 0xA5, 0x92, 0x3C, 0x66, 0x2E, 0x44, 0xB6, 0x47, 0x39, 0xE5, 0x01, 0x6A,
+    0x5F, 0x03, 0x31, 0x0F, 0x60, 0xBD, 0x03, 0xA2, 0xD9, 0xED, 0x66, 0xD1, 0x04, 0xA8, 0x3B, 0x07,
+    0x26, 0x98, 0x00, 0x2B, 0x0E, 0x9C, 0x2F, 0x02, 0xD5, 0x44, 0x4B, 0xB5, 0x50, 0x04, 0xA3, 0x86,
+    0x16, 0xE7, 0x29, 0x83, 0x89, 0xD0, 0xDF, 0xDA, 0x15, 0xCE, 0x63, 0xB7, 0xDD, 0xDF, 0x81, 0xEC,
+    0xF2, 0xED, 0xDA, 0xF4, 0x4C, 0x9E, 0xC8, 0x45, 0xA3, 0x89, 0x98, 0x15, 0x37, 0xD0, 0x06, 0xB3,
+    0x6C, 0x5C, 0x9A, 0xFE, 0x0E, 0xD3, 0x7B, 0xD8, 0x7A, 0xF8, 0xE1, 0x36, 0xDF, 0xD8, 0x26, 0xF5,
+    0xEA, 0x3C, 0x6C, 0xF3, 0xCE, 0x1E, 0x50, 0x63, 0x26, 0xDB, 0xB1, 0x98, 0x81, 0xF6, 0xEB, 0x81,
+    0x7A, 0x3C, 0xA6, 0x9C, 0xF7, 0xB7, 0x55, 0x03, 0xCA, 0x6D, 0x0C, 0x30, 0x6D, 0x93, 0x93, 0xDB,
+    0x0D, 0x8E, 0x61, 0xBB, 0x4C, 0xDC, 0x9C, 0x4C, 0xF5, 0xE3, 0x01, 0xFB, 0xC3, 0x88, 0x19, 0x45,
+    0x3E, 0x39, 0x4F, 0xB4, 0x13, 0x6E, 0x1B, 0x25, 0xE5, 0x90, 0xFA, 0x6F, 0x16, 0x37, 0x70, 0xC7,
+    0x6D, 0x72, 0xBA, 0x1C, 0xB7, 0x58, 0x84, 0xDD, 0xD8, 0xFA, 0xF4, 0x8E, 0x26, 0x7D, 0x57, 0xF3,
+    0xDB, 0x5F, 0xFD, 0xEA, 0xA7, 0xFF, 0xA7, 0x87, 0x7E, 0xF6, 0xEF, 0xFD, 0xEC, 0xA1, 0x70, 0xFA,
+    0xF2, 0xDE, 0xD1, 0xEC, 0x42, 0x39, 0x00, 0x43, 0x3E, 0x14, 0x97, 0xEE, 0xB9, 0xF4, 0xE8, 0xA5,
+    0x2B, 0x93, 0x16, 0x02, 0x81, 0x00, 0xED, 0xF4, 0x65, 0x2E, 0x71, 0x99, 0x7E, 0xB8, 0xEF, 0x29,
+    0x4E, 0x73, 0xFA, 0x3F, 0x3B, 0xEE, 0xA7, 0x76, 0x28, 0xE6, 0x47, 0xF8, 0x0C, 0x97, 0x78, 0x7E,
+    0x9C, 0xF7, 0xC2, 0x43, 0x97, 0xEF, 0xF9, 0xDA, 0x69, 0x37, 0x97, 0x03, 0x68, 0xE1, 0x21, 0x1E,
+    0x62, 0x8F, 0x3D, 0x9E, 0xE2, 0x0A, 0x13, 0x21, 0x0B, 0x79, 0x80, 0xEC, 0x3B, 0xE6, 0xF3, 0x9D,
+    0xFF, 0xEA, 0x67, 0x1E, 0x2A, 0xFF, 0x63, 0x56, 0xC6, 0x70, 0xF9, 0x9E, 0x3D, 0xF3, 0xF8, 0x4F,
+    0x7C, 0xDB, 0x95, 0xC3, 0x67, 0x9F, 0xBA, 0x74, 0x7A, 0x7C, 0xF8, 0xD2, 0xC3, 0x5F, 0x3B, 0x53,
+    0xAF, 0xD9, 0xDF, 0xE5, 0x61, 0x17, 0xDD, 0x48, 0x76, 0x8E, 0xAA, 0x5E, 0xA9, 0x24, 0x5F, 0x4F,
+    0xE5, 0x58, 0x0F, 0x26, 0xD4, 0x3E, 0x9F, 0x5C, 0x93, 0x4D, 0xAE, 0xC9, 0xE6, 0x2D, 0x45, 0xD7,
+    0xE4, 0xD1, 0x75, 0x29, 0xB5, 0xB7, 0xA5, 0xDE, 0xE7, 0x4B, 0x76, 0x8D, 0xD3, 0x65, 0xE6, 0xEF,
+    0xB5, 0x9C, 0x7E, 0xF4, 0xB3, 0xFF, 0xC5, 0x4F, 0x7F, 0xFA, 0xCA, 0x33, 0xCF, 0x3C, 0x7B, 0xCF,
+    0x99, 0x43, 0xAE, 0x04, 0xF3, 0x27, 0xA1, 0xB6, 0x37, 0x63, 0xA5, 0xB1, 0x16, 0x0F, 0x8E, 0xC0,
+    0xA1, 0xB9, 0x9C, 0xF9, 0x82, 0x87, 0xB8, 0x9C, 0xFB, 0x92, 0xD3, 0x56, 0xFD, 0x0A, 0xED, 0x78,
+    0xF1, 0x29, 0x4E, 0x73, 0x9A, 0x3D, 0x5E, 0xC8, 0x43, 0xE5, 0x1D, 0x7D, 0xEC, 0x97, 0x7A, 0xE0,
+    0xD3, 0x7C, 0x82, 0x4F, 0xDB, 0x91, 0x2B, 0x9C, 0xE6, 0xA1, 0xFB, 0x0E, 0xFB, 0xB9, 0x1D, 0x38,
+    0xC7, 0x98, 0x5F, 0x3A, 0xF5, 0xE5, 0x4F, 0x5C, 0xFE, 0xEC, 0xE5, 0x7E, 0xEA, 0x53, 0xEB, 0x4D,
+    0x64, 0xFA, 0xE7, 0x7C, 0x9A, 0x4B, 0xB9, 0x9A, 0xA2, 0xB9, 0x97, 0xFF, 0x4A, 0x2F, 0x6D, 0x84,
+    0x8D, 0xD3, 0x7C, 0x86, 0xCB, 0xF4, 0x61, 0x3E, 0x7D, 0xF9, 0x9E, 0xCB, 0xF7, 0x3C, 0x75, 0xDA,
+    0xC5, 0x72, 0x84, 0x3E, 0xF2, 0x10, 0xA7, 0xD9, 0xE3, 0x51, 0xBE, 0xC6, 0x95, 0xD4, 0x74, 0xF9,
+    0x98, 0xCF, 0x26, 0xF3, 0xFE, 0x33, 0x8F, 0x9E, 0x36, 0x31, 0x7F, 0xE5, 0xEB, 0xFE, 0xB3, 0xE1,
+    0xDE, 0x33, 0xE5, 0xD3, 0xEA, 0xEE, 0xA2, 0x1A, 0x3F, 0xFB, 0xE8, 0xA5, 0x87, 0xC6, 0x87, 0x2F,
+    0x3D, 0xFC, 0x5F, 0x5E, 0xA8, 0x16, 0xEE, 0xE1, 0xB4, 0x8B, 0x6E, 0xA4, 0xF0, 0xCC, 0x54, 0x98,
+    0x91, 0x43, 0x6C, 0x97, 0x05, 0xEA, 0x6D, 0xDF, 0x33, 0x53, 0x35, 0x79, 0xA0, 0xC6, 0x04, 0xDC,
+    0x96, 0x8D, 0x27, 0x7B, 0x81, 0x9A, 0x6C, 0xC2, 0x76, 0x44, 0xAC, 0xE7, 0x2A, 0x45, 0x48, 0xB1,
+    0x68, 0x95, 0x27, 0x52, 0x6E, 0xE1, 0x66, 0x95, 0xDF, 0x2E, 0xBB, 0x9F, 0xEE, 0x54, 0x63, 0x06,
+    0x62, 0xBA, 0x61, 0xA4, 0xA6, 0xF0, 0xD9, 0xC4, 0x3E, 0xB6, 0x33, 0x23, 0x33, 0x6E, 0xB7, 0x73,
+    0x81, 0xAA, 0x29, 0xBD, 0x09, 0x44, 0x8E, 0xA8, 0x1B, 0xEB, 0x8B, 0x31, 0x9F, 0x88, 0xF4, 0xB8,
+    0xA6, 0xF2, 0x76, 0x2C, 0x02, 0x90, 0x5D, 0xFA, 0x24, 0x98, 0xB0, 0x0F, 0x66, 0x3C, 0x0B, 0xC5,
+    0x70, 0x08, 0xA5, 0x3F, 0x06, 0xDB, 0xCD, 0x60, 0x75, 0x03, 0xDA, 0x5B, 0x81, 0x45, 0xFF, 0xC3,
+    0x8C, 0x5B, 0x0A, 0x8F, 0x62, 0xE9, 0x33, 0x45, 0xDB, 0x99, 0x38, 0xDB, 0xA6, 0x98, 0xA7, 0x8A,
+    0xF2, 0xCD, 0x50, 0x63, 0x7F, 0x15, 0xF6, 0xB1, 0x3F, 0x1B, 0xCF, 0x52, 0xBD, 0x3E, 0x1C, 0x52,
+    0xFD, 0xD2, 0x1F, 0x53, 0xC9, 0xCF, 0x54, 0xFA, 0xDC, 0x44, 0xA5, 0x3C, 0x60, 0xF5, 0x58, 0xC0,
+    0xEA, 0xE6, 0xCF, 0xAF, 0xBD, 0x3B, 0xB0, 0xE8, 0x24, 0xCB, 0xFE, 0x42, 0xFA, 0x4E, 0x7E, 0xF2,
+    0x4C, 0xE6, 0xD6, 0x33, 0xF9, 0x19, 0x6C, 0x33, 0xFD, 0x95, 0x03, 0x9F, 0xEE, 0xBF, 0xBF, 0x1A,
+    0x39, 0x8A, 0xD5, 0x48, 0xBB, 0x54, 0x81, 0xB6, 0xA9, 0x26, 0x2E, 0x50, 0x45, 0x0E, 0xB1, 0xEA,
+    0x0E, 0xB1, 0x5A, 0xAF, 0xDD, 0xF6, 0x7C, 0xF9, 0xAD, 0xC0, 0xA7, 0x5A, 0xE9, 0x6E, 0xEF, 0x59,
+    0xAB, 0xE5, 0x09, 0xC8, 0xB5, 0x90, 0x49, 0x91, 0x76, 0x7C, 0x30, 0xD8, 0x91, 0x8F, 0x13, 0x77,
+    0x6B, 0x38, 0x1C, 0x6E, 0x3A, 0x71, 0x2E, 0x89, 0x5A, 0x0A, 0x09, 0xE4, 0xDE, 0x9D, 0xFF, 0xA4,
+    0x9E, 0xFB, 0x4E, 0x26, 0xA9, 0xAB, 0xA4, 0x99, 0x7C, 0xDE, 0x66, 0x4C, 0x33, 0x6F, 0x53, 0x51,
+    0x3F, 0xA4, 0xF5, 0x90, 0x4A, 0x69, 0xBD, 0xD8, 0x6F, 0xEC, 0x84, 0x65, 0x67, 0xCF, 0xD7, 0x23,
+    0x28, 0xD9, 0xCC, 0x4A, 0x61, 0x30, 0x6B, 0x82, 0xA0, 0xD6, 0x84, 0x8C, 0xAD, 0xE0, 0x44, 0xB6,
+    0x82, 0x53, 0x97, 0x2D, 0xE0, 0x7A, 0x9F, 0x2D, 0xE0, 0x9E, 0x1F, 0xF2, 0x05, 0xDA, 0x6F, 0x85,
+    0x7C, 0x81, 0xF6, 0x9B, 0x53, 0xBE, 0x40, 0xFB, 0x74, 0x34, 0x31, 0x45, 0x61, 0x6A, 0xDD, 0x8A,
+    0xDF, 0xD5, 0x2F, 0xF4, 0xFD, 0xF5, 0x7B, 0xC8, 0xBB, 0xEB, 0x11, 0xE4, 0xEB, 0x54, 0xD8, 0xD7,
+    0x53, 0x71, 0x33, 0x82, 0x7C, 0xA1, 0x08, 0xF2, 0x46, 0x33, 0x99, 0x7C, 0x96, 0x0A, 0xB6, 0xA2,
+    0x9D, 0xD3, 0xBA, 0x2C, 0x9B, 0x8B, 0x28, 0x5F, 0x9F, 0x97, 0xA7, 0x1C, 0xE9, 0xBB, 0x2D, 0xB4,
+    0xF0, 0x1A, 0xA4, 0xE5, 0x45, 0xF4, 0x45, 0x49, 0x5A, 0x70, 0x5D, 0xE2, 0xFC, 0x16, 0x11, 0x23,
+    0x69, 0xC4, 0x4A, 0xEB, 0xCE, 0x31, 0xA9, 0x5F, 0x9C, 0xDB, 0xB1, 0xE2, 0x13, 0xD7, 0xEC, 0x36,
+    0x86, 0x61, 0x32, 0x2B, 0xAB, 0x5B, 0x5F, 0x27, 0x38, 0x24, 0xF1, 0xCC, 0xEB, 0x89, 0xAD, 0x3D,
+    0x13, 0x53, 0x0A, 0xCA, 0xD4, 0x90, 0xF9, 0x3B, 0x09, 0x49, 0xBF, 0xCC, 0x9C, 0x8C, 0xED, 0x0A,
+    0xA0, 0x4C, 0x66, 0x8D, 0xF1, 0x69, 0x3D, 0x82, 0x90, 0x14, 0xFC, 0x3D, 0x1C, 0xD4, 0xB3, 0x3D,
+    0xE8, 0x3D, 0x4E, 0x46, 0x1A, 0xA8, 0xFE, 0x7E, 0x23, 0x8D, 0x94, 0x29, 0x80, 0xC9, 0xF8, 0xA4,
+    0x41, 0xBF, 0x80, 0x99, 0xCA, 0x91, 0x6A, 0x24, 0x12, 0xC9, 0xE5, 0x5B, 0xAA, 0x86, 0x6A, 0xA9,
+    0x7C, 0x31, 0x42, 0xF5, 0x62, 0xC8, 0x22, 0x64, 0x6F, 0x2F, 0xB4, 0x98, 0x8B, 0x57, 0xDB, 0xA6,
+    0x1A, 0x72, 0xE9, 0xFC, 0x50, 0xCE, 0x99, 0xF4, 0xD2, 0x94, 0x8B, 0x56, 0x7F, 0xB6, 0xD0, 0xFB,
+    0x53, 0x1A, 0xCA, 0x0E, 0xCA, 0xEE, 0x10, 0x98, 0x0A, 0x0F, 0xB6, 0xD9, 0x03, 0x82, 0x19, 0xA0,
+    0xE2, 0x2C, 0xE4, 0xC1, 0x8C, 0x19, 0x67, 0x38, 0xC3, 0x0B, 0x66, 0x6C, 0x4F, 0x82, 0xE5, 0xD4,
+    0x4A, 0xD2, 0x68, 0x1F, 0x5B, 0x4B, 0xCF, 0xD4, 0x86, 0x63, 0xEC, 0x37, 0x5F, 0xFD, 0x62, 0xC7,
+    0x71, 0x9C, 0x27, 0xCA, 0x57, 0x5F, 0x7E, 0xB9, 0xE1, 0x68, 0xBE, 0x16, 0x28, 0xF4, 0xB8, 0x36,
+    0xD7, 0x9E, 0x91, 0x59, 0xC1, 0x8D, 0xF5, 0x88, 0x59, 0xB2, 0x05, 0x6A, 0x6F, 0x07, 0xB2, 0xC8,
+    0x86, 0x12, 0x64, 0xEF, 0xFC, 0xE3, 0x44, 0x5C, 0x18, 0x36, 0x7E, 0xC2, 0x7E, 0x3B, 0x9C, 0x0F,
+    0xDC, 0x88, 0x94, 0xC1, 0xBC, 0x3E, 0x52, 0x7A, 0xFB, 0x6C, 0x83, 0x6D, 0xF6, 0x2F, 0xC0, 0x3E,
+    0x37, 0xA6, 0xBB, 0x78, 0xC1, 0xBC, 0x3E, 0xD4, 0xF9, 0x68, 0x9F, 0x6D, 0x8E, 0x4B, 0xBF, 0x7F,
+    0x21, 0x0F, 0x35, 0x37, 0xA6, 0xD2, 0x1F, 0x9B, 0xD7, 0x87, 0x9A, 0x73, 0xD5, 0xB3, 0xCD, 0x21,
+    0x1C, 0x5D, 0xC8, 0x02, 0xD9, 0x8D, 0xC9, 0x8C, 0x14, 0xAF, 0x0F, 0xE5, 0x88, 0x7B, 0xB6, 0xB1,
+    0x37, 0x8A, 0xF5, 0x30, 0x45, 0x80, 0x71, 0x2A, 0x31, 0x1F, 0xFE, 0xB5, 0xE7, 0x77, 0x50, 0x5D,
+    0x36, 0x92, 0xD4, 0xDF, 0x07, 0xFE, 0xF0, 0x09, 0x90, 0x26, 0x8C, 0x34, 0x40, 0xD9, 0x90, 0x2F,
+    0x8F, 0x80, 0x5B, 0xAE, 0x60, 0xDE, 0xD1, 0xC0, 0x19, 0xFA, 0x86, 0xC0, 0x42, 0xD1, 0x99, 0xC0,
+    0x19, 0xAC, 0xE7, 0x05, 0x1C, 0xD9, 0x94, 0x47, 0x8C, 0x34, 0x25, 0x6F, 0x56, 0x29, 0x35, 0x9C,
+    0x5A, 0x7F, 0x87, 0x83, 0x83, 0x83, 0x27, 0x72, 0x49, 0x61, 0x0B, 0x97, 0xDD, 0xE4, 0xCC, 0x92,
+    0xA2, 0x39, 0x5A, 0x2D, 0xD8, 0x1B, 0x59, 0x8A, 0x09, 0xAB, 0xFD, 0xC6, 0x35, 0x74, 0x59, 0x93,
+    0x6D, 0xAB, 0x09, 0x8D, 0x09, 0x1E, 0x72, 0x5B, 0x80, 0xBB, 0x93, 0x7C, 0xA1, 0xB7, 0x37, 0x12,
+    0x9C, 0x99, 0xB6, 0xFF, 0xCA, 0x16, 0xA0, 0xBA, 0xB1, 0xE9, 0x90, 0x45, 0x72, 0xA7, 0x2D, 0xF0,
+    0xE0, 0x16, 0x0C, 0xFF, 0x97, 0x47, 0x3C, 0xDE, 0x07, 0xAC, 0x57, 0x01, 0x97, 0xD6, 0x0C, 0x68,
+    0x36, 0xFC, 0x5C, 0x2B, 0xB0, 0xDF, 0x3E, 0xD3, 0xF0, 0xB1, 0x6D, 0x75, 0x81, 0x69, 0x0B, 0x69,
+    0x70, 0xEA, 0xB6, 0x85, 0x0F, 0xCD, 0x17, 0xDE, 0x15, 0xF1, 0x58, 0xBF, 0x5F, 0xC4, 0x63, 0x91,
+    0xC2, 0xAB, 0x5A, 0xA9, 0x83, 0xF2, 0x9D, 0x5E, 0xC0, 0x35, 0x8A, 0xB8, 0x45, 0x0B, 0xA7, 0xE5,
+    0x28, 0x23, 0x76, 0xA4, 0x1C, 0x61, 0x85, 0x6B, 0xE9, 0xB9, 0xE5, 0xD3, 0xA0, 0xC5, 0xA6, 0xA8,
+    0x81, 0x1D, 0x57, 0x25, 0x85, 0xF4, 0xFD, 0xE2, 0xDC, 0x2D, 0x7A, 0xA8, 0x6E, 0x53, 0xAD, 0xB3,
+    0xF7, 0x39, 0x48, 0x20, 0xE0, 0x06, 0x66, 0xD6, 0x5B, 0xF0, 0x6F, 0x73, 0xEB, 0x00, 0xB2, 0x4B,
+    0x6C, 0xBD, 0x00, 0x3E, 0x05, 0xC0, 0x53, 0x27, 0x7D, 0xE3, 0xAE, 0x5E, 0x03, 0xB9, 0x24, 0x4F,
+    0xAB, 0x55, 0x4D, 0xA1, 0xCF, 0x0F, 0x77, 0xE1, 0x42, 0xD9, 0x90, 0x89, 0x47, 0xC0, 0xCE, 0x5C,
+    0x01, 0xE7, 0xF3, 0x01, 0x44, 0xD9, 0x50, 0x44, 0x1E, 0x81, 0x6A, 0xE4, 0x0A, 0xB4, 0x5D, 0x3E,
+    0x90, 0xAD, 0x94, 0xFF, 0x98, 0x62, 0xC6, 0x69, 0x7D, 0x32, 0x20, 0xAD, 0xCE, 0x1B, 0x7F, 0x3E,
+    0xAA, 0xB1, 0xB8, 0xFF, 0x40, 0xEC, 0x11, 0x4B, 0x11, 0x8A, 0x50, 0xE9, 0xF5, 0xFF, 0xA7, 0x4F,
+    0x61, 0xC1, 0xB4, 0x92, 0x22, 0xAD, 0xA4, 0xB0, 0x45, 0x86, 0xDF, 0xAD, 0x77, 0x9A, 0x93, 0x95,
+    0x4D, 0xC2, 0xAD, 0x55, 0x4D, 0xEE, 0x06, 0xC8, 0x7E, 0xEF, 0x5C, 0x6A, 0xEC, 0x29, 0xB1, 0x03,
+    0xC7, 0x44, 0xCB, 0xEB, 0xE0, 0x7E, 0xCE, 0xA7, 0x21, 0xB7, 0x71, 0x2B, 0x93, 0x7B, 0xA3, 0xDC,
+    0xE0, 0xC4, 0x5D, 0x20, 0x4D, 0x7F, 0x1B, 0x54, 0xB8, 0xA4, 0x83, 0xE1, 0x3D, 0x58, 0xDE, 0xEE,
+    0xCC, 0xF6, 0xB3, 0x76, 0x5B, 0xC3, 0x65, 0x84, 0x06, 0xA7, 0x5F, 0x7C, 0x3F, 0xC5, 0xBD, 0x2B,
+    0xA4, 0x75, 0xB0, 0x3C, 0x2E, 0xB1, 0xFE, 0xDA, 0xF4, 0xEE, 0xFE, 0xB6, 0x74, 0xE9, 0xD6, 0x94,
+    0xBB, 0x91, 0x5A, 0x52, 0xD1, 0x46, 0x5A, 0x79, 0xAB, 0xFF, 0x25, 0x8F, 0x57, 0x70, 0x65, 0x53,
+    0x84, 0x2B, 0x1C, 0x95, 0x4D, 0x31, 0x5C, 0xE1, 0x6A, 0xD9, 0x14, 0xE3, 0x53, 0xB4, 0x45, 0x67,
+    0xE2, 0x53, 0xD4, 0xFA, 0x73, 0x12, 0x68, 0xD5, 0x9D, 0xD2, 0x6B, 0x5B, 0x03, 0x7C, 0xE5, 0x04,
+    0xEC, 0x7C, 0xF7, 0x7A, 0x7C, 0x9F, 0x7C, 0xEE, 0xB9, 0xE7, 0x9E, 0xFB, 0x9F, 0xB5, 0xAD, 0xE4,
+    0x23, 0x7D, 0x68, 0xB8, 0xEF, 0xF8, 0xA1, 0xE1, 0xBE, 0xEF, 0xEE, 0xE7, 0xB7, 0x85, 0xFB, 0x6A,
+    0x17, 0xEE, 0xBB, 0xD9, 0xF1, 0xB8, 0x64, 0x1C, 0x14, 0x1D, 0xEC, 0xD1, 0x4B, 0xAF, 0x48, 0x0B,
+    0xA5, 0xA7, 0x98, 0xE8, 0x57, 0x4A, 0x35, 0xF4, 0x0B, 0x77, 0x7D, 0x69, 0xF3, 0x5D, 0xC4, 0x74,
+    0xEF, 0x6D, 0x35, 0x29, 0x35, 0xD8, 0x19, 0xE4, 0x77, 0x38, 0x45, 0x36, 0x41, 0x36, 0xDD, 0x4D,
+    0xF6, 0xF6, 0x35, 0x32, 0xAD, 0x14, 0x1A, 0x69, 0x17, 0xE8, 0xA7, 0x8C, 0x3F, 0x9A, 0xFE, 0x90,
+    0xEC, 0x66, 0x5A, 0x2E, 0xAF, 0x56, 0x43, 0x3F, 0xB1, 0xFF, 0xC7, 0x13, 0x87, 0x9F, 0x9B, 0xF2,
+    0x39, 0x9B, 0xAA, 0x31, 0x7B, 0x47, 0x5D, 0xA6, 0x99, 0xEC, 0x0E, 0x8C, 0xFA, 0x53, 0xBB, 0xBE,
+    0xFD, 0xA9, 0x2D, 0x14, 0x31, 0xD3, 0x0C, 0xBD, 0x46, 0x2A, 0xA9, 0x31, 0xEB, 0x5B, 0x11, 0x67,
+    0xED, 0x50, 0x8C, 0xE1, 0x88, 0x63, 0x6B, 0xC6, 0xD2, 0x87, 0x33, 0x1C, 0xDB, 0x3C, 0x94, 0x5D,
+    0xA8, 0x79, 0xC1, 0xE6, 0x63, 0xD9, 0x85, 0x33, 0xB7, 0x76, 0x8E, 0x6D, 0x3E, 0x16, 0x3E, 0x9C,
+    0xE1, 0xD0, 0x9A, 0xB1, 0x18, 0xC2, 0x3E, 0x64, 0xD2, 0x08, 0x85, 0x34, 0x43, 0xFD, 0x0B, 0xC5,
+    0x6D, 0xCC, 0xA7, 0x75, 0x02, 0xCA, 0xB4, 0xFA, 0x6D, 0x47, 0xDD, 0xB1, 0xC2, 0x82, 0x99, 0x31,
+    0x13, 0x76, 0xA4, 0xF7, 0xDA, 0x69, 0x4B, 0x0A, 0x36, 0xCD, 0xDF, 0x5A, 0xBF, 0xB7, 0x9B, 0x81,
+    0xD1, 0x26, 0xD5, 0x7C, 0x26, 0x49, 0x14, 0x09, 0x74, 0xDE, 0x22, 0x02, 0xE2, 0xAD, 0xC1, 0xDE,
+    0x0F, 0x27, 0x83, 0x3C, 0xCD, 0xD7, 0x59, 0xB7, 0x81, 0x19, 0xB6, 0xDB, 0x90, 0xF7, 0xB8, 0xD9,
+    0xEE, 0xE5, 0xB0, 0x5B, 0x6B, 0x49, 0xD2, 0xCF, 0x24, 0xAD, 0x27, 0x0B, 0x0E, 0xA6, 0x55, 0x4F,
+    0xEE, 0x8C, 0xA3, 0xBC, 0xC3, 0xC5, 0x53, 0x36, 0x9B, 0x6A, 0xA8, 0x39, 0xC5, 0x07, 0x55, 0x2F,
+    0x3F, 0xE9, 0x8B, 0x71, 0x72, 0xF9, 0x6C, 0x9B, 0xE5, 0x02, 0x93, 0xF9, 0x71, 0x63, 0x9B, 0x8F,
+    0x25, 0x4B, 0xD1, 0x36, 0x7C, 0xE8, 0xCE, 0x6F, 0x27, 0x57, 0xE9, 0x6E, 0x89, 0x95, 0x93, 0xD8,
+    0xB2, 0x6E, 0x33, 0x26, 0xF3, 0xA9, 0xDF, 0x86, 0xDE, 0xB2, 0x5B, 0xBE, 0x6E, 0xB7, 0x2C, 0xE9,
+    0xFE, 0x66, 0x39, 0x9A, 0x00, 0x9C, 0xDE, 0x3D, 0xDD, 0x5F, 0x7E, 0xD3, 0xFB, 0x99, 0x78, 0x7C,
+    0xB0, 0xCD, 0xD9, 0xBA, 0x9B, 0xEC, 0x70, 0xCD, 0x3E, 0x16, 0xB2, 0xF8, 0x76, 0xA4, 0xD0, 0xBA,
+    0x79, 0x50, 0xDD, 0xB0, 0x61, 0x41, 0xB7, 0x3E, 0x23, 0x97, 0x61, 0x9F, 0xB2, 0xA3, 0xEC, 0x38,
+    0x43, 0x1E, 0x60, 0xE2, 0x10, 0xCC, 0x60, 0x01, 0x6B, 0xA4, 0xB4, 0x26, 0x48, 0x22, 0xC7, 0x32,
+    0xA5, 0xC5, 0x8A, 0xCE, 0x40, 0xD9, 0x31, 0x91, 0x07, 0xCC, 0xC0, 0x21, 0x7C, 0x62, 0x5B, 0x29,
+    0x69, 0xFB, 0xDC, 0x93, 0x46, 0x5D, 0xB5, 0x92, 0xFF, 0xFA, 0x79, 0xF6, 0xEF, 0xAD, 0xCD, 0xF8,
+    0x68, 0xF5, 0x77, 0x19, 0x1F, 0xC6, 0x74, 0x70, 0x2F, 0xF0, 0x28, 0x30, 0xB2, 0x1D, 0xE6, 0x3C,
+    0x4A, 0xC5, 0xF8, 0x70, 0xFD, 0xD8, 0xD7, 0xA7, 0xFA, 0xEF, 0xD5, 0x54, 0x7F, 0x1C, 0xA8, 0xD6,
+    0x34, 0x8E, 0xEE, 0xD9, 0x2E, 0x79, 0xF0, 0x7D, 0x2F, 0xC9, 0xE8, 0x7B, 0xE7, 0xEC, 0x94, 0x5C,
+    0x40, 0xBF, 0x9A, 0x28, 0xAE, 0x4F, 0x54, 0x66, 0xE2, 0x29, 0x33, 0x65, 0xA3, 0x99, 0xCA, 0xCE,
+    0x4C, 0x67, 0x30, 0x53, 0x6A, 0xBA, 0x9C, 0xEA, 0x7B, 0xE7, 0x68, 0xA5, 0xEE, 0xF7, 0x9E, 0xDF,
+    0xBC, 0x87, 0xFD, 0x48, 0xF9, 0x8A, 0xE7, 0x6A, 0x45, 0x39, 0xEC, 0x71, 0x95, 0x50, 0x0E, 0xC6,
+    0x5F, 0xC5, 0x96, 0x03, 0x7B, 0x17, 0x80, 0x8B, 0xC9, 0x9F, 0x9A, 0x05, 0x30, 0x81, 0xBB, 0x4D,
+    0x60, 0xAF, 0x18, 0x09, 0xC5, 0x58, 0xF8, 0x72, 0x38, 0x43, 0x39, 0x5C, 0xC1, 0x5E, 0x1F, 0xB0,
+    0x2F, 0xA7, 0x89, 0xD1, 0x86, 0x5A, 0xEA, 0x6E, 0xA3, 0x42, 0x77, 0x50, 0xFE, 0x9F, 0x0D, 0x47,
+    0x67, 0x28, 0xC6, 0x43, 0x1C, 0xC1, 0x04, 0xE3, 0x1D, 0x36, 0x0F, 0x9C, 0xAD, 0x1B, 0xFE, 0xD9,
+    0x94, 0x16, 0x26, 0x49, 0x50, 0xEA, 0xE0, 0x36, 0x9A, 0xF7, 0xF6, 0xF1, 0x9B, 0xB3, 0x7C, 0xB7,
+    0x32, 0xEC, 0x09, 0x1C, 0x55, 0x35, 0x80, 0xFD, 0xD3, 0x83, 0x83, 0x27, 0xAC, 0x24, 0x7D, 0xCB,
+    0x9F, 0x44, 0x31, 0xBB, 0x0D, 0x8E, 0x95, 0xBA, 0xF6, 0xE0, 0xE0, 0xA0, 0x49, 0xDF, 0x5E, 0x3B,
+    0x81, 0x88, 0x33, 0x7F, 0x27, 0x17, 0x0E, 0xD3, 0x79, 0x60, 0xDF, 0x78, 0x30, 0xB3, 0xF5, 0x1B,
+    0x47, 0xDF, 0xDC, 0xEC, 0x7E, 0x39, 0x50, 0xFF, 0x37, 0xE6, 0x9B, 0x43, 0x3E, 0x3F, 0x7A, 0x6F,
+    0x39, 0xD4, 0xDD, 0xF8, 0x68, 0xF9, 0xA3, 0xD9, 0x74, 0x63, 0x79, 0xBD, 0xBB, 0xD7, 0x74, 0xBF,
+    0x01, 0x8F, 0xDE, 0x0B, 0x30, 0x3E, 0x0A, 0x98, 0x6E, 0x04, 0xEE, 0x35, 0x1D, 0x1F, 0xE5, 0xEB,
+    0xED, 0xF3, 0x09, 0x76, 0xBD, 0xD5, 0x84, 0x93, 0x3A, 0xA6, 0x05, 0x6A, 0x0E, 0xB3, 0x83, 0x83,
+    0x83, 0x27, 0x7D, 0xBF, 0xF3, 0x39, 0x59, 0xBF, 0xFB, 0x95, 0x09, 0xBD, 0xA4, 0xF0, 0xC0, 0xC1,
+    0xC1, 0x97, 0xC2, 0x4E, 0xC6, 0xE7, 0xF3, 0x6E, 0x40, 0xA5, 0x50, 0x4C, 0x00, 0x2E, 0xFE, 0xF6,
+    0xBF, 0xF4, 0x73, 0x99, 0x6E, 0x24, 0x6F, 0xEE, 0x35, 0xDD, 0xC7, 0xAA, 0xE6, 0xD1, 0x7B, 0x79,
+    0xCA, 0x35, 0xE3, 0xA3, 0x45, 0x70, 0x8F, 0x75, 0x63, 0x8B, 0xFB, 0x7B, 0xE6, 0x99, 0x11, 0xF7,
+    0xE8, 0xBD, 0xFB, 0xD0, 0x8E, 0x6E, 0x84, 0xB6, 0x5B, 0x81, 0x23, 0x33, 0x02, 0x4F, 0xDD, 0x03,
+    0xF0, 0xE5, 0xFB, 0xDE, 0x4D, 0x06, 0x86, 0x8B, 0x50, 0xFA, 0x3C, 0x80, 0xED, 0xB6, 0xD0, 0xB4,
+    0x63, 0x38, 0x06, 0x47, 0x36, 0x81, 0xED, 0xCC, 0xDB, 0x07, 0x07, 0x5F, 0x1A, 0xD2, 0xB2, 0x1D,
+    0x0E, 0xE0, 0xEA, 0x11, 0xC0, 0x91, 0xF5, 0x90, 0x4F, 0x46, 0x92, 0x86, 0x6C, 0x39, 0x38, 0x68,
+    0x3B, 0x8E, 0xE0, 0x08, 0xEA, 0x2E, 0x8B, 0x60, 0x7D, 0x3E, 0x41, 0x01, 0xBB, 0x09, 0xF1, 0xFF,
+    0x03, 0xAD, 0x95, 0x31, 0x8F, 0xE5, 0x48, 0x15, 0x85, 0xBF, 0x72, 0xED, 0x8C, 0x91, 0xAC, 0xA1,
+    0xA2, 0x41, 0x62, 0x67, 0xC1, 0x04, 0x84, 0x30, 0x4E, 0x36, 0x6C, 0xBA, 0xAC, 0x25, 0x20, 0xED,
+    0x60, 0x97, 0x00, 0x11, 0x10, 0x43, 0xD0, 0x84, 0x1B, 0x6C, 0xB7, 0x2D, 0xF1, 0x07, 0x3A, 0x80,
+    0x7F, 0xB0, 0x09, 0x43, 0x30, 0x42, 0x22, 0x20, 0xE8, 0x5E, 0x97, 0x34, 0xC1, 0x06, 0x93, 0x58,
+    0x42, 0x62, 0x03, 0x02, 0x6A, 0xA5, 0x09, 0x40, 0x04, 0x53, 0x48, 0x06, 0xDC, 0x4D, 0xD9, 0x87,
+    0xC0, 0x7E, 0xDD, 0xAD, 0x16, 0xE1, 0x5A, 0x7A, 0xF7, 0xAB, 0x77, 0xE5, 0xE7, 0x77, 0xEA, 0xD6,
+    0xB9, 0xD7, 0xD0, 0x02, 0x36, 0x00, 0x3E, 0x40, 0xF9, 0x76, 0x84, 0xCE, 0x8D, 0x54, 0xC9, 0x47,
+    0xA3, 0xF0, 0xC5, 0x5C, 0xFF, 0xC3, 0xFE, 0x30, 0x7F, 0xFD, 0xBD, 0x27, 0x36, 0xF0, 0xCB, 0xF7,
+    0xC1, 0x84, 0x11, 0x4A, 0xDB, 0xC2, 0x7B, 0x4F, 0xE0, 0x36, 0x65, 0x4A, 0xDB, 0x9E, 0xF8, 0x9F,
+    0x3E, 0xA9, 0xE2, 0x90, 0xDE, 0x57, 0xDB, 0x85, 0xB7, 0x23, 0xFE, 0x57, 0x19, 0x9A, 0xD3, 0x1E,
+    0x9A, 0x09, 0x68, 0x5A, 0xE0, 0xBB, 0x00, 0xD5, 0x05, 0xB8, 0x19, 0xB8, 0x02, 0x8E, 0x81, 0x06,
+    0xA8, 0x81, 0x6F, 0xEF, 0x9F, 0xE7, 0x28, 0x7D, 0xBF, 0x52, 0xFE, 0x41, 0x1D, 0x9B, 0x23, 0xDF,
+    0x56, 0x97, 0xE7, 0xD8, 0x7C, 0x46, 0x31, 0x5F, 0x61, 0xA6, 0x2B, 0x4C, 0x1A, 0xB0, 0xC9, 0xF7,
+    0xD5, 0xD8, 0x48, 0xC1, 0x49, 0xAD, 0xD5, 0x0A, 0x5D, 0x64, 0xBB, 0x0C, 0x98, 0xE1, 0x9A, 0x22,
+    0x52, 0x4A, 0x73, 0x31, 0x51, 0xE9, 0xAD, 0xFE, 0x94, 0x70, 0x2B, 0xB5, 0x12, 0xD5, 0x02, 0x4A,
+    0xD8, 0x05, 0xDC, 0x4C, 0xB1, 0x82, 0x15, 0x08, 0xAC, 0x02, 0x3E, 0x60, 0xFF, 0x33, 0x51, 0x8F,
+    0xD8, 0xB8, 0x52, 0x26, 0xCA, 0xE8, 0x7B, 0x93, 0x29, 0xA3, 0x8B, 0x74, 0x94, 0xB1, 0xC8, 0xD4,
+    0xA1, 0x8C, 0x7C, 0x46, 0x39, 0x95, 0x23, 0xBE, 0x37, 0x4B, 0x35, 0xE2, 0x22, 0xFE, 0xF5, 0x48,
+    0x35, 0xE1, 0x34, 0x52, 0x65, 0x8C, 0xFE, 0x65, 0x4E, 0x05, 0x5E, 0x92, 0x7A, 0x9C, 0x24, 0x05,
+    0x2A, 0x49, 0x8A, 0x54, 0x7F, 0xDD, 0x10, 0x06, 0x69, 0xA4, 0x0A, 0x66, 0x58, 0x5B, 0x4C, 0xE0,
+    0xFF, 0x5C, 0xF5, 0x08, 0xB8, 0x0C, 0x94, 0x02, 0xAC, 0x22, 0x98, 0x25, 0x03, 0x83, 0xEF, 0xC1,
+    0xFF, 0x28, 0x41, 0x13, 0x56, 0x70, 0xB1, 0x09, 0x54, 0xC9, 0xCE, 0xD8, 0x99, 0x81, 0x62, 0xA1,
+    0x8E, 0x08, 0x9B, 0xE9, 0x5A, 0xBA, 0xDE, 0x07, 0x5C, 0xAA, 0x23, 0xC5, 0xE2, 0x12, 0x74, 0x9F,
+    0x67, 0x70, 0xFF, 0x96, 0xA4, 0x75, 0x90, 0xA4, 0x97, 0x9B, 0x30, 0xA0, 0x92, 0x94, 0x07, 0x49,
+    0xE1, 0x18, 0xD7, 0xDB, 0xC8, 0xCC, 0x57, 0xB5, 0x30, 0x27, 0x7C, 0xC8, 0x57, 0xFA, 0xD4, 0x64,
+    0xE6, 0x3B, 0xBD, 0x83, 0xF4, 0x5A, 0xCA, 0x1F, 0x83, 0x89, 0x50, 0xF6, 0xF0, 0x1C, 0xF8, 0x03,
+    0x14, 0x23, 0x54, 0x2D, 0x7C, 0x0F, 0x08, 0x70, 0x04, 0xAE, 0xC5, 0x8E, 0x30, 0xC3, 0x39, 0xD4,
+    0x3D, 0x65, 0x82, 0xFD, 0xE7, 0x83, 0xB4, 0x1D, 0xC4, 0xD3, 0x0F, 0xA4, 0xDC, 0x1D, 0xBE, 0xE1,
+    0x95, 0xC1, 0x68, 0xBD, 0x80, 0x6A, 0x04, 0xF0, 0x00, 0x66, 0x06, 0x70, 0xE1, 0x61, 0xE2, 0xEE,
+    0x8E, 0x22, 0x03, 0xB8, 0x08, 0xD0, 0xB5, 0x77, 0x89, 0x04, 0xD0, 0xF5, 0xF0, 0x1D, 0x9B, 0xC1,
+    0x4C, 0x2E, 0x81, 0x9D, 0x86, 0x1E, 0xAA, 0xFF, 0x2E, 0x80, 0x53, 0x02, 0x1A, 0x05, 0xC0, 0xAF,
+    0x00, 0xC3, 0x04, 0xF0, 0x51, 0x0B, 0xF0, 0xCD, 0xD6, 0x7C, 0x8A, 0xD3, 0xD8, 0x65, 0xA4, 0x57,
+    0xCA, 0xD5, 0x9B, 0xFA, 0x65, 0x3F, 0x1D, 0xE3, 0x26, 0xFE, 0x99, 0xA8, 0x43, 0xF1, 0xBA, 0xE7,
+    0x98, 0xF2, 0x39, 0xCC, 0x7C, 0xEB, 0x8F, 0xD8, 0xC4, 0xEF, 0x13, 0x75, 0xAC, 0x3E, 0x8F, 0x46,
+    0x92, 0x93, 0x5E, 0x6A, 0xAA, 0xB5, 0x78, 0xF5, 0xB5, 0x46, 0x3F, 0xF3, 0xF8, 0x6F, 0x3C, 0xDA,
+    0xF6, 0xF9, 0x6C, 0x06, 0x50, 0x06, 0xEC, 0xFC, 0x35, 0xA0, 0x8C, 0x77, 0x5B, 0xDC, 0x62, 0xDD,
+    0x73, 0xE8, 0x67, 0x7C, 0x7B, 0xBB, 0xD3, 0x3D, 0x76, 0x00, 0x9C, 0xC3, 0xDE, 0xE0, 0x87, 0x98,
+    0x1F, 0x46, 0x93, 0xEF, 0x0A, 0x56, 0xCC, 0x00, 0x76, 0x02, 0xB0, 0xE9, 0x2E, 0x96, 0xE9, 0x50,
+    0x3D, 0xD3, 0x37, 0x23, 0xD4, 0x52, 0x80, 0x41, 0xEA, 0xC1, 0x4B, 0x40, 0xA5, 0x05, 0x60, 0x78,
+    0x73, 0xDB, 0x32, 0xCD, 0xAB, 0xEC, 0xBF, 0x58, 0xBA, 0x2F, 0x3F, 0xBC, 0xEB, 0xA2, 0x22, 0xFB,
+    0x57, 0x4B, 0xF7, 0x97, 0x15, 0xA0, 0x58, 0x31, 0x1F, 0xDC, 0x4C, 0xA4, 0xD9, 0xB5, 0x9F, 0x9C,
+    0x99, 0xE9, 0xB8, 0xC1, 0xA9, 0x85, 0x9F, 0x6F, 0xB3, 0xE3, 0x04, 0xAC, 0x82, 0x7D, 0x95, 0x2E,
+    0x4D, 0x9A, 0xAA, 0x70, 0x79, 0xC6, 0x67, 0xCB, 0x37, 0x28, 0xD7, 0xDB, 0x47, 0xF5, 0xFB, 0x90,
+    0x22, 0xB1, 0xD9, 0x8A, 0x4F, 0x00, 0x3B, 0xB2, 0xF9, 0xED, 0xD1, 0x74, 0xD2, 0x48, 0xFA, 0x72,
+    0x6B, 0x78, 0x3B, 0xEE, 0xE3, 0x8D, 0x04, 0xB8, 0x1E, 0xE8, 0xB4, 0x38, 0x49, 0xB9, 0xD3, 0x47,
+    0xF7, 0xD3, 0x97, 0x80, 0x8D, 0x7B, 0x15, 0xCD, 0x74, 0x7F, 0x06, 0xFC, 0xEC, 0x50, 0xAC, 0x4A,
+    0x40, 0xB3, 0x80, 0xD1, 0x04, 0xA5, 0x46, 0x68, 0xD4, 0xC2, 0x30, 0x03, 0x43, 0x04, 0x9A, 0x6B,
+    0xA0, 0xD4, 0xDA, 0xC2, 0xA9, 0xD6, 0x16, 0x6A, 0xE9, 0x02, 0x9E, 0x49, 0xC0, 0x33, 0x85, 0xDB,
+    0x92, 0xBE, 0x63, 0x00, 0x8C, 0xFE, 0x7E, 0x02, 0x83, 0xB4, 0xFE, 0x9A, 0xA7, 0x2F, 0x25, 0x80,
+    0x1F, 0x5F, 0xD8, 0x16, 0x60, 0x01, 0xF0, 0x33, 0x60, 0xF4, 0x86, 0xFD, 0xEF, 0xA8, 0xD5, 0x02,
+    0xCD, 0x66, 0xC8, 0x6B, 0xA0, 0x50, 0x0F, 0x66, 0x88, 0x70, 0xAA, 0x99, 0xC7, 0xD2, 0x1B, 0x33,
+    0x68, 0xC1, 0x4A, 0x17, 0xA0, 0xEB, 0x83, 0x45, 0xDE, 0xE1, 0x6E, 0x38, 0xF3, 0x13, 0xC5, 0x77,
+    0x25, 0x65, 0xAF, 0xF5, 0x37, 0xBC, 0x7B, 0xEF, 0x9C, 0xEA, 0x99, 0x21, 0xD4, 0x2B, 0x43, 0x72,
+    0x81, 0x63, 0xEC, 0x48, 0x0D, 0x89, 0x32, 0x70, 0x44, 0x91, 0xA8, 0xE1, 0x92, 0x41, 0x92, 0x4E,
+    0x25, 0xE9, 0xCF, 0x7A, 0xF1, 0xBB, 0x9B, 0x4F, 0xEB, 0x9E, 0x2B, 0xCA, 0x48, 0xD3, 0x9A, 0x99,
+    0x6A, 0xA4, 0xA3, 0x98, 0xA8, 0x03, 0x0B, 0x65, 0xC2, 0xF7, 0x26, 0xE3, 0x22, 0x03, 0x76, 0xA6,
+    0x09, 0xAC, 0x54, 0x09, 0xDF, 0x17, 0x0F, 0x92, 0xBB, 0x9D, 0xED, 0x0C, 0xF8, 0xBE, 0x5C, 0xCB,
+    0x6C, 0x14, 0x87, 0xE0, 0x0F, 0x07, 0x7B, 0x74, 0x78, 0x47, 0x1E, 0x01, 0x83, 0x52, 0x5D, 0x49,
+    0x45, 0xFA, 0xC5, 0xCD, 0x45, 0xC3, 0x39, 0x45, 0x2A, 0x23, 0xFB, 0x22, 0xD1, 0xD0, 0x6D, 0x0B,
+    0x4F, 0x87, 0x4D, 0x55, 0xC2, 0x33, 0x3C, 0x5C, 0xB4, 0x03, 0xE5, 0xB4, 0xB9, 0xAD, 0x9E, 0x99,
+    0xA9, 0x57, 0xCE, 0x70, 0x81, 0xBA, 0xB5, 0x23, 0xD5, 0x48, 0xA2, 0x48, 0x1C, 0x41, 0xC6, 0x81,
+    0x67, 0x50, 0x72, 0xA1, 0x51, 0xB6, 0xE9, 0xF1, 0xF0, 0x5B, 0x32, 0x75, 0x8F, 0xA7, 0x8C, 0xB8,
+    0xDE, 0xCC, 0x94, 0x91, 0x0E, 0x33, 0x53, 0x07, 0xCE, 0x29, 0x13, 0xF5, 0xF6, 0xBA, 0x62, 0xC0,
+    0xCC, 0x34, 0x81, 0x73, 0xAA, 0x44, 0x1D, 0x8A, 0x4C, 0xA9, 0x71, 0xC0, 0x68, 0x6A, 0x02, 0xDD,
+    0xEE, 0xE7, 0xAD, 0x1D, 0xB7, 0x4E, 0xA4, 0x58, 0xE8, 0x62, 0x21, 0xBB, 0x1A, 0xC5, 0x4A, 0x76,
+    0xB5, 0x09, 0xD7, 0xB3, 0x9F, 0x02, 0x36, 0x1C, 0xD0, 0x00, 0xE5, 0x86, 0x41, 0x92, 0xDA, 0x79,
+    0xC3, 0x74, 0x7A, 0xF3, 0x62, 0x78, 0xD1, 0x4E, 0x65, 0xA4, 0x69, 0x79, 0x88, 0x74, 0x80, 0xDF,
+    0xD1, 0x33, 0xEF, 0xA8, 0xEE, 0xC1, 0xEC, 0xC8, 0xF7, 0x51, 0x1C, 0xB0, 0xA9, 0x7E, 0x04, 0x5D,
+    0x2C, 0x44, 0xD3, 0x1A, 0xC5, 0x4A, 0x34, 0x6C, 0x52, 0xFD, 0xAE, 0xD5, 0xEF, 0x62, 0xFD, 0xAE,
+    0xD6, 0xEF, 0x72, 0x8F, 0x77, 0xBD, 0xE7, 0xB7, 0xDC, 0x14, 0x9F, 0x6D, 0xFE, 0xE1, 0xC0, 0xAB,
+    0x3B, 0xA6, 0x5B, 0xFA, 0x03, 0xFB, 0x7B, 0xDC, 0x94, 0x2F, 0x0F, 0xB8, 0xBB, 0x0C, 0x6D, 0xB2,
+    0x19, 0x0E, 0x5C, 0xEE, 0xB7, 0xF5, 0xC7, 0xDC, 0xCD, 0xBF, 0xFB, 0xE8, 0x6E, 0xDA, 0x62, 0xC6,
+    0x4A, 0xAD, 0x94, 0xDD, 0x9B, 0xA7, 0x48, 0x8B, 0xDB, 0xA6, 0x63, 0xBD, 0xC1, 0x8D, 0x1B, 0xD6,
+    0x16, 0x3B, 0x61, 0x35, 0x63, 0x13, 0x74, 0xEA, 0x6D, 0x02, 0x4E, 0xA3, 0x4D, 0x80, 0x4B, 0x36,
+    0x61, 0x2F, 0xEA, 0x64, 0x67, 0x9C, 0x94, 0x4A, 0x65, 0x2F, 0xC5, 0x0D, 0xA1, 0x54, 0x7E, 0xAC,
+    0x6B, 0x0A, 0xE5, 0xFF, 0x01,
 };
 
 static const EpdGlyph opendyslexic_14_regularGlyphs[] = {
@@ -2060,7 +2039,7 @@ static const EpdGlyph opendyslexic_14_regularGlyphs[] = {
     { 4, 25, 7, 2, 21, 25, 8572 }, // |
     { 13, 27, 16, 2, 22, 88, 8597 }, // }
     { 11, 6, 14, 1, 22, 17, 8685 }, // ~
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
+    { 0, 0, 25, 0, 0, 0, 8702 }, //  
     { 7, 29, 10, 1, 22, 51, 0 }, // ¡
     { 14, 25, 22, 4, 22, 88, 51 }, // ¢
     { 18, 28, 20, 1, 28, 126, 139 }, // £
@@ -2071,625 +2050,631 @@ static const EpdGlyph opendyslexic_14_regularGlyphs[] = {
     { 14, 5, 16, 1, 23, 18, 562 }, // ¨
     { 12, 11, 16, 2, 26, 33, 580 }, // ©
     { 10, 10, 12, 2, 22, 25, 613 }, // ª
-    { 15, 14, 19, 2, 14, 53, 638 }, // «
-    { 14, 9, 18, 2, 10, 32, 691 }, // ¬
-    { 14, 3, 16, 2, 10, 11, 723 }, // ­
-    { 12, 11, 16, 2, 31, 33, 734 }, // ®
-    { 11, 3, 15, 2, 21, 9, 767 }, // ¯
-    { 14, 14, 16, 1, 23, 49, 776 }, // °
-    { 14, 17, 18, 2, 16, 60, 825 }, // ±
-    { 7, 11, 9, 1, 24, 20, 885 }, // ²
-    { 8, 11, 9, 1, 23, 22, 905 }, // ³
-    { 6, 6, 8, 1, 23, 9, 927 }, // ´
-    { 16, 19, 23, 3, 16, 76, 936 }, // µ
-    { 14, 24, 18, 2, 21, 84, 1012 }, // ¶
-    { 6, 5, 8, 1, 12, 8, 1096 }, // ·
-    { 6, 8, 10, 2, 1, 12, 1104 }, // ¸
-    { 7, 11, 8, 1, 24, 20, 1116 }, // ¹
-    { 9, 9, 12, 3, 21, 21, 1136 }, // º
-    { 15, 14, 19, 2, 14, 53, 1157 }, // »
-    { 24, 28, 32, 5, 26, 168, 1210 }, // ¼
-    { 25, 27, 32, 5, 25, 169, 1378 }, // ½
-    { 26, 27, 32, 3, 25, 176, 1547 }, // ¾
-    { 16, 32, 17, 0, 17, 128, 1723 }, // ¿
-    { 23, 33, 33, 5, 33, 190, 1851 }, // À
-    { 23, 38, 33, 5, 38, 219, 2041 }, // Á
-    { 23, 34, 33, 5, 34, 196, 2260 }, // Â
-    { 23, 33, 33, 5, 33, 190, 2456 }, // Ã
-    { 23, 33, 33, 5, 33, 190, 2646 }, // Ä
-    { 23, 35, 33, 5, 35, 202, 2836 }, // Å
-    { 32, 26, 42, 5, 25, 208, 3038 }, // Æ
-    { 20, 33, 29, 4, 26, 165, 3246 }, // Ç
-    { 17, 32, 27, 5, 32, 136, 3411 }, // È
-    { 17, 38, 27, 5, 38, 162, 3547 }, // É
-    { 17, 33, 27, 5, 33, 141, 3709 }, // Ê
-    { 17, 33, 27, 5, 33, 141, 3850 }, // Ë
-    { 10, 35, 13, 0, 35, 88, 3991 }, // Ì
-    { 6, 40, 13, 4, 40, 60, 4079 }, // Í
-    { 12, 36, 13, 0, 36, 108, 4139 }, // Î
-    { 14, 35, 13, -1, 35, 123, 4247 }, // Ï
-    { 27, 25, 32, 1, 25, 169, 4370 }, // Ð
-    { 21, 32, 31, 5, 32, 168, 4539 }, // Ñ
-    { 23, 33, 33, 5, 32, 190, 4707 }, // Ò
-    { 23, 38, 33, 5, 37, 219, 4897 }, // Ó
-    { 23, 34, 33, 5, 33, 196, 5116 }, // Ô
-    { 23, 33, 33, 5, 32, 190, 5312 }, // Õ
-    { 23, 33, 33, 5, 32, 190, 5502 }, // Ö
-    { 13, 8, 17, 2, 11, 26, 5692 }, // ×
-    { 36, 52, 35, -1, 38, 468, 5718 }, // Ø
-    { 21, 35, 31, 5, 34, 184, 6186 }, // Ù
-    { 21, 39, 31, 5, 38, 205, 6370 }, // Ú
-    { 21, 35, 31, 5, 34, 184, 6575 }, // Û
-    { 21, 35, 31, 5, 34, 184, 6759 }, // Ü
-    { 21, 39, 31, 5, 39, 205, 6943 }, // Ý
-    { 14, 23, 16, 1, 23, 81, 7148 }, // Þ
-    { 16, 23, 20, 2, 23, 92, 7229 }, // ß
-    { 17, 23, 24, 3, 23, 98, 7321 }, // à
-    { 17, 28, 24, 3, 28, 119, 7419 }, // á
-    { 17, 24, 24, 3, 24, 102, 7538 }, // â
-    { 17, 23, 24, 3, 23, 98, 7640 }, // ã
-    { 17, 23, 24, 3, 23, 98, 7738 }, // ä
-    { 17, 25, 24, 3, 25, 107, 7836 }, // å
-    { 29, 17, 36, 3, 17, 124, 7943 }, // æ
-    { 14, 24, 22, 4, 17, 84, 8067 }, // ç
-    { 16, 27, 24, 4, 27, 108, 8151 }, // è
-    { 16, 32, 24, 4, 32, 128, 8259 }, // é
-    { 16, 28, 24, 4, 28, 112, 8387 }, // ê
-    { 16, 27, 24, 4, 27, 108, 8499 }, // ë
-    { 10, 24, 13, 0, 24, 60, 8607 }, // ì
-    { 6, 29, 13, 4, 29, 44, 8667 }, // í
-    { 13, 25, 13, 0, 25, 82, 8711 }, // î
-    { 14, 25, 13, -1, 25, 88, 8793 }, // ï
-    { 22, 23, 24, 2, 23, 127, 8881 }, // ð
-    { 16, 25, 24, 4, 25, 100, 9008 }, // ñ
-    { 16, 26, 24, 4, 26, 104, 9108 }, // ò
-    { 16, 31, 24, 4, 31, 124, 9212 }, // ó
-    { 16, 27, 24, 4, 27, 108, 9336 }, // ô
-    { 16, 26, 24, 4, 26, 104, 9444 }, // õ
-    { 16, 26, 24, 4, 26, 104, 9548 }, // ö
-    { 18, 18, 22, 2, 18, 81, 9652 }, // ÷
-    { 17, 45, 24, 3, 30, 192, 9733 }, // ø
-    { 15, 25, 23, 4, 24, 94, 9925 }, // ù
-    { 15, 30, 23, 4, 29, 113, 10019 }, // ú
-    { 15, 26, 23, 4, 25, 98, 10132 }, // û
-    { 15, 25, 23, 4, 24, 94, 10230 }, // ü
-    { 16, 39, 24, 4, 31, 156, 10324 }, // ý
-    { 13, 30, 16, 2, 24, 98, 10480 }, // þ
-    { 16, 35, 24, 4, 27, 140, 10578 }, // ÿ
-    { 23, 32, 33, 5, 32, 184, 0 }, // Ā
-    { 17, 22, 24, 3, 22, 94, 184 }, // ā
-    { 23, 36, 33, 5, 36, 207, 278 }, // Ă
-    { 17, 25, 24, 3, 25, 107, 485 }, // ă
-    { 23, 32, 33, 5, 25, 184, 592 }, // Ą
-    { 17, 22, 24, 3, 17, 94, 776 }, // ą
-    { 20, 39, 29, 4, 38, 195, 870 }, // Ć
-    { 14, 28, 22, 4, 27, 98, 1065 }, // ć
-    { 20, 37, 29, 4, 36, 185, 1163 }, // Ĉ
-    { 14, 25, 22, 4, 24, 88, 1348 }, // ĉ
-    { 20, 37, 29, 4, 36, 185, 1436 }, // Ċ
-    { 14, 26, 22, 4, 25, 91, 1621 }, // ċ
-    { 20, 39, 29, 4, 38, 195, 1712 }, // Č
-    { 14, 27, 22, 4, 26, 95, 1907 }, // č
-    { 23, 36, 32, 5, 36, 207, 2002 }, // Ď
-    { 22, 26, 25, 4, 25, 143, 2209 }, // ď
-    { 27, 25, 32, 1, 25, 169, 2352 }, // Đ
-    { 21, 26, 25, 4, 25, 137, 2521 }, // đ
-    { 17, 32, 27, 5, 32, 136, 2658 }, // Ē
-    { 16, 26, 24, 4, 26, 104, 2794 }, // ē
-    { 17, 35, 27, 5, 35, 149, 2898 }, // Ĕ
-    { 16, 30, 24, 4, 30, 120, 3047 }, // ĕ
-    { 17, 34, 27, 5, 34, 145, 3167 }, // Ė
-    { 16, 28, 24, 4, 28, 112, 3312 }, // ė
-    { 17, 31, 27, 5, 25, 132, 3424 }, // Ę
-    { 16, 24, 24, 4, 17, 96, 3556 }, // ę
-    { 17, 35, 27, 5, 35, 149, 3652 }, // Ě
-    { 16, 30, 24, 4, 30, 120, 3801 }, // ě
-    { 23, 34, 33, 5, 34, 196, 3921 }, // Ĝ
-    { 16, 32, 23, 4, 25, 128, 4117 }, // ĝ
-    { 23, 36, 33, 5, 36, 207, 4245 }, // Ğ
-    { 16, 33, 23, 4, 26, 132, 4452 }, // ğ
-    { 23, 34, 33, 5, 34, 196, 4584 }, // Ġ
-    { 16, 32, 23, 4, 25, 128, 4780 }, // ġ
-    { 23, 39, 33, 5, 26, 225, 4908 }, // Ģ
-    { 16, 34, 23, 4, 27, 136, 5133 }, // ģ
-    { 21, 33, 31, 5, 33, 174, 5269 }, // Ĥ
-    { 19, 31, 24, 1, 31, 148, 5443 }, // ĥ
-    { 24, 24, 31, 3, 24, 144, 5591 }, // Ħ
-    { 19, 25, 24, 1, 25, 119, 5735 }, // ħ
-    { 11, 36, 13, 1, 36, 99, 5854 }, // Ĩ
-    { 11, 25, 13, 1, 25, 69, 5953 }, // ĩ
-    { 14, 34, 13, -1, 34, 119, 6022 }, // Ī
-    { 14, 23, 13, 0, 23, 81, 6141 }, // ī
-    { 7, 31, 18, 7, 25, 55, 6222 }, // Į
-    { 7, 32, 13, 3, 26, 56, 6277 }, // į
-    { 7, 36, 13, 3, 36, 63, 6333 }, // İ
-    { 5, 17, 13, 4, 17, 22, 6396 }, // ı
-    { 18, 32, 27, 4, 25, 144, 6418 }, // Ĳ
-    { 22, 34, 13, 4, 26, 187, 6562 }, // ĳ
-    { 13, 39, 22, 5, 32, 127, 6749 }, // Ĵ
-    { 15, 32, 19, 4, 24, 120, 6876 }, // ĵ
-    { 20, 35, 30, 5, 25, 175, 6996 }, // Ķ
-    { 16, 37, 24, 4, 24, 148, 7171 }, // ķ
-    { 13, 16, 19, 3, 16, 52, 7319 }, // ĸ
-    { 16, 35, 27, 5, 35, 140, 7371 }, // Ĺ
-    { 9, 34, 16, 3, 34, 77, 7511 }, // ĺ
-    { 16, 38, 27, 5, 25, 152, 7588 }, // Ļ
-    { 9, 36, 16, 3, 24, 81, 7740 }, // ļ
-    { 16, 25, 27, 5, 25, 100, 7821 }, // Ľ
-    { 12, 25, 16, 3, 25, 75, 7921 }, // ľ
-    { 16, 25, 27, 5, 25, 100, 7996 }, // Ŀ
-    { 13, 24, 16, 3, 24, 78, 8096 }, // ŀ
-    { 28, 41, 27, -7, 32, 287, 8174 }, // Ł
-    { 19, 24, 16, -6, 24, 114, 8461 }, // ł
-    { 21, 35, 31, 5, 35, 184, 8575 }, // Ń
-    { 16, 28, 24, 4, 28, 112, 8759 }, // ń
-    { 21, 35, 31, 5, 25, 184, 8871 }, // Ņ
-    { 16, 27, 24, 4, 17, 108, 9055 }, // ņ
-    { 21, 35, 31, 5, 35, 184, 9163 }, // Ň
-    { 16, 28, 24, 4, 28, 112, 9347 }, // ň
-    { 16, 30, 20, 2, 30, 120, 9459 }, // ŉ
-    { 21, 30, 31, 5, 25, 158, 9579 }, // Ŋ
-    { 16, 23, 24, 4, 17, 92, 9737 }, // ŋ
-    { 23, 32, 33, 5, 31, 184, 9829 }, // Ō
-    { 16, 25, 24, 4, 25, 100, 10013 }, // ō
-    { 23, 36, 33, 5, 35, 207, 10113 }, // Ŏ
-    { 16, 29, 24, 4, 29, 116, 10320 }, // ŏ
-    { 24, 34, 33, 5, 33, 204, 10436 }, // Ő
-    { 22, 27, 24, 2, 27, 149, 10640 }, // ő
-    { 33, 25, 35, 5, 25, 207, 10789 }, // Œ
-    { 28, 17, 31, 4, 17, 119, 10996 }, // œ
-    { 18, 34, 28, 5, 34, 153, 11115 }, // Ŕ
-    { 11, 25, 19, 4, 25, 69, 11268 }, // ŕ
-    { 18, 39, 28, 5, 25, 176, 11337 }, // Ŗ
-    { 12, 31, 19, 3, 16, 93, 11513 }, // ŗ
-    { 18, 34, 28, 5, 34, 153, 11606 }, // Ř
-    { 13, 25, 19, 2, 25, 82, 11759 }, // ř
-    { 23, 38, 33, 5, 37, 219, 11841 }, // Ś
-    { 15, 26, 23, 4, 26, 98, 12060 }, // ś
-    { 23, 36, 33, 5, 35, 207, 12158 }, // Ŝ
-    { 15, 24, 23, 4, 24, 90, 12365 }, // ŝ
-    { 23, 33, 33, 5, 26, 190, 12455 }, // Ş
-    { 15, 24, 23, 4, 16, 90, 12645 }, // ş
-    { 23, 38, 33, 5, 37, 219, 12735 }, // Š
-    { 15, 26, 23, 4, 26, 98, 12954 }, // š
-    { 21, 31, 31, 5, 25, 163, 13052 }, // Ţ
-    { 13, 28, 21, 4, 22, 91, 13215 }, // ţ
-    { 21, 35, 31, 5, 35, 184, 13306 }, // Ť
-    { 14, 25, 21, 4, 25, 88, 13490 }, // ť
-    { 21, 25, 31, 5, 25, 132, 13578 }, // Ŧ
-    { 14, 22, 21, 3, 22, 77, 13710 }, // ŧ
-    { 21, 36, 31, 5, 35, 189, 13787 }, // Ũ
-    { 15, 26, 23, 4, 25, 98, 13976 }, // ũ
-    { 21, 34, 31, 5, 33, 179, 14074 }, // Ū
-    { 15, 24, 23, 4, 23, 90, 14253 }, // ū
-    { 21, 37, 31, 5, 36, 195, 14343 }, // Ŭ
-    { 15, 27, 23, 4, 26, 102, 14538 }, // ŭ
-    { 21, 38, 31, 5, 37, 200, 14640 }, // Ů
-    { 15, 28, 23, 4, 27, 105, 14840 }, // ů
-    { 22, 36, 31, 5, 35, 198, 14945 }, // Ű
-    { 22, 26, 23, 1, 25, 143, 15143 }, // ű
-    { 21, 31, 31, 5, 25, 163, 15286 }, // Ų
-    { 15, 23, 23, 4, 16, 87, 15449 }, // ų
-    { 31, 34, 42, 5, 34, 264, 15536 }, // Ŵ
-    { 22, 26, 30, 4, 26, 143, 15800 }, // ŵ
-    { 21, 35, 31, 5, 35, 184, 15943 }, // Ŷ
-    { 16, 35, 24, 4, 27, 140, 16127 }, // ŷ
-    { 21, 34, 31, 5, 34, 179, 16267 }, // Ÿ
-    { 23, 35, 33, 5, 35, 202, 16446 }, // Ź
-    { 16, 27, 24, 4, 27, 108, 16648 }, // ź
-    { 23, 33, 33, 5, 33, 190, 16756 }, // Ż
-    { 16, 25, 24, 4, 25, 100, 16946 }, // ż
-    { 23, 35, 33, 5, 35, 202, 17046 }, // Ž
-    { 16, 27, 24, 4, 27, 108, 17248 }, // ž
-    { 10, 24, 15, 4, 24, 60, 17356 }, // ſ
-    { 10, 5, 0, 1, 22, 13, 0 }, // ̀
-    { 6, 6, 0, 1, 23, 9, 13 }, // ́
-    { 12, 6, 0, 2, 0, 18, 22 }, // ̂
-    { 11, 6, 0, 1, 22, 17, 40 }, // ̃
-    { 14, 4, 0, 2, 20, 14, 57 }, // ̄
-    { 19, 4, 0, 2, 26, 19, 71 }, // ̅
-    { 12, 6, 0, 2, 21, 18, 90 }, // ̆
-    { 6, 5, 0, 1, 22, 8, 108 }, // ̇
-    { 14, 5, 0, 1, 23, 18, 116 }, // ̈
-    { 7, 6, 0, 0, 19, 11, 134 }, // ̉
-    { 7, 6, 0, 1, 22, 11, 145 }, // ̊
-    { 22, 5, 0, 1, 22, 28, 156 }, // ̋
-    { 12, 6, 0, 2, 22, 18, 184 }, // ̌
-    { 22, 5, 0, -6, 24, 28, 202 }, // ̏
-    { 7, 9, 0, 1, 22, 16, 230 }, // ̒
-    { 8, 9, 0, 1, 22, 18, 246 }, // ̓
-    { 7, 9, 0, 1, 22, 16, 264 }, // ̔
-    { 5, 7, 0, 2, -1, 9, 280 }, // ̘
-    { 5, 7, 0, 2, -1, 9, 289 }, // ̙
-    { 12, 7, 0, 2, 23, 21, 298 }, // ̚
-    { 4, 6, 0, 2, 18, 6, 319 }, // ̛
-    { 3, 6, 0, 2, -2, 5, 325 }, // ̜
-    { 7, 5, 0, 2, 3, 9, 330 }, // ̝
-    { 7, 5, 0, 2, -1, 9, 339 }, // ̞
-    { 6, 7, 0, 2, -2, 11, 348 }, // ̟
-    { 14, 4, 0, 2, -4, 14, 359 }, // ̠
-    { 6, 5, 0, 1, 1, 8, 373 }, // ̣
-    { 14, 5, 0, 1, -1, 18, 381 }, // ̤
-    { 7, 6, 0, 1, 22, 11, 399 }, // ̥
-    { 8, 10, 0, 1, 5, 20, 410 }, // ̦
-    { 6, 8, 0, 2, 1, 12, 430 }, // ̧
-    { 6, 8, 0, 2, 1, 12, 442 }, // ̨
-    { 4, 8, 0, 2, -2, 8, 454 }, // ̩
-    { 9, 5, 0, 2, -1, 12, 462 }, // ̪
-    { 12, 6, 0, 2, 0, 18, 474 }, // ̬
-    { 13, 6, 0, 1, -1, 20, 492 }, // ̭
-    { 11, 6, 0, 1, 22, 17, 512 }, // ̰
-    { 11, 3, 0, 2, 21, 9, 529 }, // ̱
-    { 12, 4, 0, 2, -2, 12, 538 }, // ̲
-    { 11, 6, 0, 1, 22, 17, 550 }, // ̴
-    { 14, 3, 0, 2, 10, 11, 567 }, // ̵
-    { 3, 6, 0, 2, -2, 5, 578 }, // ̹
-    { 9, 5, 0, 2, -1, 12, 583 }, // ̺
-    { 9, 8, 0, 2, 0, 18, 595 }, // ̻
-    { 9, 6, 0, 2, 0, 14, 613 }, // ̼
-    { 7, 6, 0, 3, 22, 11, 627 }, // ̽
-    { 11, 6, 0, 1, 22, 17, 638 }, // ͂
-    { 4, 5, 0, 2, 24, 5, 655 }, // ̓
-    { 14, 13, 0, 1, 31, 46, 660 }, // ̈́
-    { 9, 5, 0, 2, 23, 12, 706 }, // ͆
-    { 14, 11, 0, 2, 0, 39, 718 }, // ͇
-    { 11, 8, 0, 2, 0, 22, 757 }, // ͈
-    { 9, 7, 0, 2, -2, 16, 779 }, // ͉
-    { 11, 16, 0, 1, 27, 44, 795 }, // ͊
-    { 24, 13, 0, 1, 26, 78, 839 }, // ͋
-    { 17, 15, 0, 3, 16, 64, 917 }, // ͌
-    { 15, 7, 0, 2, -3, 27, 981 }, // ͍
-    { 4, 4, 0, 2, 3, 4, 1008 }, // ͎
-    { 24, 6, 0, 2, 0, 36, 1012 }, // ͜
-    { 24, 6, 0, 2, 23, 36, 1048 }, // ͡
-    { 28, 7, 0, 2, -2, 49, 1084 }, // ͢
-    { 15, 30, 18, 2, 30, 113, 0 }, // Ѐ
-    { 15, 28, 18, 2, 28, 105, 113 }, // Ё
-    { 24, 24, 30, 3, 24, 144, 218 }, // Ђ
-    { 15, 34, 19, 2, 34, 128, 362 }, // Ѓ
-    { 20, 24, 27, 4, 23, 120, 490 }, // Є
-    { 23, 27, 33, 5, 26, 156, 610 }, // Ѕ
-    { 6, 25, 13, 4, 25, 38, 766 }, // І
-    { 14, 35, 13, -1, 35, 123, 804 }, // Ї
-    { 12, 33, 22, 5, 26, 99, 927 }, // Ј
-    { 28, 23, 34, 3, 22, 161, 1026 }, // Љ
-    { 27, 22, 33, 3, 22, 149, 1187 }, // Њ
-    { 24, 25, 31, 5, 25, 150, 1336 }, // Ћ
-    { 20, 35, 30, 5, 35, 175, 1486 }, // Ќ
-    { 21, 33, 31, 5, 33, 174, 1661 }, // Ѝ
-    { 16, 34, 20, 2, 33, 136, 1835 }, // Ў
-    { 17, 27, 21, 2, 21, 115, 1971 }, // Џ
-    { 23, 25, 33, 5, 25, 144, 2086 }, // А
-    { 15, 21, 19, 2, 21, 79, 2230 }, // Б
-    { 16, 21, 20, 2, 21, 84, 2309 }, // В
-    { 15, 22, 19, 2, 22, 83, 2393 }, // Г
-    { 21, 24, 24, 2, 21, 126, 2476 }, // Д
-    { 15, 22, 18, 2, 22, 83, 2602 }, // Е
-    { 31, 25, 42, 5, 25, 194, 2685 }, // Ж
-    { 15, 22, 19, 2, 22, 83, 2879 }, // З
-    { 21, 25, 31, 5, 25, 132, 2962 }, // И
-    { 21, 35, 31, 5, 35, 184, 3094 }, // Й
-    { 20, 25, 30, 5, 25, 125, 3278 }, // К
-    { 17, 22, 22, 2, 21, 94, 3403 }, // Л
-    { 21, 21, 25, 2, 21, 111, 3497 }, // М
-    { 21, 25, 31, 5, 25, 132, 3608 }, // Н
-    { 23, 26, 33, 5, 25, 150, 3740 }, // О
-    { 16, 22, 20, 2, 22, 88, 3890 }, // П
-    { 17, 25, 27, 5, 25, 107, 3978 }, // Р
-    { 20, 27, 29, 4, 26, 135, 4085 }, // С
-    { 21, 25, 31, 5, 25, 132, 4220 }, // Т
-    { 16, 24, 20, 2, 23, 96, 4352 }, // У
-    { 22, 22, 25, 2, 22, 121, 4448 }, // Ф
-    { 23, 25, 33, 5, 25, 144, 4569 }, // Х
-    { 17, 27, 21, 2, 22, 115, 4713 }, // Ц
-    { 15, 22, 19, 2, 22, 83, 4828 }, // Ч
-    { 20, 22, 24, 2, 22, 110, 4911 }, // Ш
-    { 23, 27, 26, 2, 22, 156, 5021 }, // Щ
-    { 20, 22, 19, -3, 22, 110, 5177 }, // Ъ
-    { 27, 23, 33, 2, 23, 156, 5287 }, // Ы
-    { 15, 22, 19, 2, 22, 83, 5443 }, // Ь
-    { 20, 24, 27, 3, 23, 120, 5526 }, // Э
-    { 23, 22, 29, 3, 22, 127, 5646 }, // Ю
-    { 18, 25, 28, 5, 25, 113, 5773 }, // Я
-    { 17, 17, 24, 3, 17, 73, 5886 }, // а
-    { 17, 23, 20, 2, 23, 98, 5959 }, // б
-    { 14, 18, 21, 4, 18, 63, 6057 }, // в
-    { 14, 17, 17, 2, 17, 60, 6120 }, // г
-    { 18, 20, 22, 2, 17, 90, 6180 }, // д
-    { 16, 17, 24, 4, 17, 68, 6270 }, // е
-    { 27, 20, 35, 4, 20, 135, 6338 }, // ж
-    { 11, 16, 13, 1, 16, 44, 6473 }, // з
-    { 16, 17, 20, 2, 17, 68, 6517 }, // и
-    { 16, 22, 20, 2, 22, 88, 6585 }, // й
-    { 15, 17, 23, 4, 17, 64, 6673 }, // к
-    { 12, 16, 15, 1, 15, 48, 6737 }, // л
-    { 19, 19, 27, 4, 19, 91, 6785 }, // м
-    { 18, 19, 27, 4, 19, 86, 6876 }, // н
-    { 15, 16, 19, 2, 16, 60, 6962 }, // о
-    { 15, 17, 19, 2, 17, 64, 7022 }, // п
-    { 18, 24, 24, 2, 16, 108, 7086 }, // р
-    { 14, 18, 22, 4, 17, 63, 7194 }, // с
-    { 16, 16, 20, 2, 16, 64, 7257 }, // т
-    { 16, 24, 24, 4, 16, 96, 7321 }, // у
-    { 22, 23, 25, 2, 16, 127, 7417 }, // ф
-    { 17, 16, 21, 2, 16, 68, 7544 }, // х
-    { 17, 21, 21, 2, 17, 90, 7612 }, // ц
-    { 11, 15, 13, 1, 15, 42, 7702 }, // ч
-    { 20, 17, 24, 2, 17, 85, 7744 }, // ш
-    { 22, 22, 26, 2, 17, 121, 7829 }, // щ
-    { 18, 16, 22, 2, 16, 72, 7950 }, // ъ
-    { 20, 17, 24, 2, 17, 85, 8022 }, // ы
-    { 14, 17, 18, 2, 17, 60, 8107 }, // ь
-    { 15, 16, 19, 2, 16, 60, 8167 }, // э
-    { 19, 17, 23, 2, 17, 81, 8227 }, // ю
-    { 14, 16, 18, 2, 16, 56, 8308 }, // я
-    { 16, 28, 24, 4, 28, 112, 8364 }, // ѐ
-    { 15, 22, 19, 2, 22, 83, 8476 }, // ё
-    { 20, 29, 24, 1, 25, 145, 8559 }, // ђ
-    { 14, 25, 17, 2, 25, 88, 8704 }, // ѓ
-    { 15, 17, 19, 2, 16, 64, 8792 }, // є
-    { 15, 16, 23, 4, 16, 60, 8856 }, // ѕ
-    { 6, 26, 13, 4, 26, 39, 8916 }, // і
-    { 14, 25, 13, -1, 25, 88, 8955 }, // ї
-    { 12, 33, 19, 4, 25, 99, 9043 }, // ј
-    { 20, 16, 23, 2, 15, 80, 9142 }, // љ
-    { 19, 15, 23, 2, 15, 72, 9222 }, // њ
-    { 19, 25, 24, 1, 25, 119, 9294 }, // ћ
-    { 15, 26, 23, 4, 26, 98, 9413 }, // ќ
-    { 16, 25, 20, 2, 25, 100, 9511 }, // ѝ
-    { 16, 36, 24, 4, 28, 144, 9611 }, // ў
-    { 13, 20, 15, 1, 15, 65, 9755 }, // џ
-    { 17, 23, 24, 4, 22, 98, 9820 }, // Ѣ
-    { 17, 22, 21, 2, 21, 94, 9918 }, // ѣ
-    { 23, 21, 30, 3, 21, 121, 10012 }, // Ѫ
-    { 17, 15, 21, 2, 15, 64, 10133 }, // ѫ
-    { 21, 27, 31, 5, 26, 142, 10197 }, // Ѳ
-    { 16, 20, 24, 4, 20, 80, 10339 }, // ѳ
-    { 30, 33, 34, 5, 33, 248, 10419 }, // Ѵ
-    { 19, 20, 24, 3, 20, 95, 10667 }, // ѵ
-    { 10, 9, 0, 2, 27, 23, 10762 }, // ҆
-    { 15, 25, 19, 2, 25, 94, 10785 }, // Ґ
-    { 14, 20, 17, 2, 20, 70, 10879 }, // ґ
-    { 16, 22, 19, 1, 22, 88, 10949 }, // Ғ
-    { 12, 15, 13, 0, 15, 45, 11037 }, // ғ
-    { 17, 24, 20, 2, 24, 102, 11082 }, // Ҕ
-    { 10, 15, 12, 1, 15, 38, 11184 }, // ҕ
-    { 31, 29, 37, 3, 25, 225, 11222 }, // Җ
-    { 22, 21, 26, 2, 18, 116, 11447 }, // җ
-    { 15, 25, 21, 3, 22, 94, 11563 }, // Ҙ
-    { 11, 23, 13, 1, 16, 64, 11657 }, // ҙ
-    { 20, 29, 26, 3, 25, 145, 11721 }, // Қ
-    { 14, 21, 18, 2, 18, 74, 11866 }, // қ
-    { 22, 21, 28, 3, 21, 116, 11940 }, // Ҝ
-    { 17, 15, 21, 2, 15, 64, 12056 }, // ҝ
-    { 21, 25, 30, 4, 25, 132, 12120 }, // Ҟ
-    { 19, 23, 24, 1, 23, 110, 12252 }, // ҟ
-    { 27, 25, 30, -2, 25, 169, 12362 }, // Ҡ
-    { 19, 18, 20, -2, 18, 86, 12531 }, // ҡ
-    { 22, 28, 27, 3, 25, 154, 12617 }, // Ң
-    { 15, 20, 19, 2, 17, 75, 12771 }, // ң
-    { 30, 26, 31, 5, 26, 195, 12846 }, // Ҥ
-    { 21, 17, 22, 3, 17, 90, 13041 }, // ҥ
-    { 28, 24, 34, 3, 24, 168, 13131 }, // Ҧ
-    { 27, 27, 31, 2, 19, 183, 13299 }, // ҧ
-    { 29, 25, 35, 3, 24, 182, 13482 }, // Ҩ
-    { 23, 20, 27, 2, 19, 115, 13664 }, // ҩ
-    { 20, 31, 29, 4, 26, 155, 13779 }, // Ҫ
-    { 14, 21, 22, 4, 17, 74, 13934 }, // ҫ
-    { 21, 28, 27, 3, 25, 147, 14008 }, // Ҭ
-    { 15, 19, 19, 2, 17, 72, 14155 }, // ҭ
-    { 21, 25, 31, 5, 25, 132, 14227 }, // Ү
-    { 16, 21, 19, 2, 15, 84, 14359 }, // ү
-    { 21, 25, 31, 5, 25, 132, 14443 }, // Ұ
-    { 17, 22, 19, 1, 15, 94, 14575 }, // ұ
-    { 24, 29, 29, 3, 25, 174, 14669 }, // Ҳ
-    { 17, 20, 20, 2, 17, 85, 14843 }, // ҳ
-    { 25, 27, 31, 3, 21, 169, 14928 }, // Ҵ
-    { 18, 19, 22, 2, 15, 86, 15097 }, // ҵ
-    { 19, 28, 24, 2, 21, 133, 15183 }, // Ҷ
-    { 14, 20, 17, 1, 15, 70, 15316 }, // ҷ
-    { 17, 22, 21, 2, 22, 94, 15386 }, // Ҹ
-    { 12, 15, 15, 1, 15, 45, 15480 }, // ҹ
-    { 16, 24, 22, 3, 24, 96, 15525 }, // Һ
-    { 16, 25, 24, 4, 25, 100, 15621 }, // һ
-    { 25, 22, 28, 0, 21, 138, 15721 }, // Ҽ
-    { 18, 16, 20, 0, 16, 72, 15859 }, // ҽ
-    { 26, 25, 32, 3, 21, 163, 15931 }, // Ҿ
-    { 19, 19, 23, 2, 16, 91, 16094 }, // ҿ
-    { 6, 25, 13, 4, 25, 38, 16185 }, // Ӏ
-    { 31, 35, 42, 5, 35, 272, 16223 }, // Ӂ
-    { 27, 31, 35, 4, 31, 210, 16495 }, // ӂ
-    { 17, 29, 23, 3, 22, 124, 16705 }, // Ӄ
-    { 12, 20, 16, 2, 15, 60, 16829 }, // ӄ
-    { 21, 27, 22, 2, 22, 142, 16889 }, // Ӆ
-    { 14, 18, 15, 2, 15, 63, 17031 }, // ӆ
-    { 23, 32, 31, 5, 25, 184, 17094 }, // Ӈ
-    { 16, 22, 22, 3, 17, 88, 17278 }, // ӈ
-    { 23, 34, 31, 5, 25, 196, 17366 }, // Ӊ
-    { 16, 23, 22, 3, 17, 92, 17562 }, // ӊ
-    { 16, 27, 20, 1, 21, 108, 17654 }, // Ӌ
-    { 11, 18, 15, 2, 15, 50, 17762 }, // ӌ
-    { 28, 34, 36, 5, 25, 238, 17812 }, // Ӎ
-    { 20, 23, 25, 3, 17, 115, 18050 }, // ӎ
-    { 4, 21, 8, 2, 21, 21, 18165 }, // ӏ
-    { 23, 35, 33, 5, 35, 202, 18186 }, // Ӑ
-    { 17, 26, 24, 3, 26, 111, 18388 }, // ӑ
-    { 23, 34, 33, 5, 34, 196, 18499 }, // Ӓ
-    { 17, 25, 24, 3, 25, 107, 18695 }, // ӓ
-    { 32, 26, 42, 5, 25, 208, 18802 }, // Ӕ
-    { 29, 17, 36, 3, 17, 124, 19010 }, // ӕ
-    { 15, 31, 18, 2, 31, 117, 19134 }, // Ӗ
-    { 16, 29, 24, 4, 29, 116, 19251 }, // ӗ
-    { 16, 17, 24, 4, 16, 68, 19367 }, // Ә
-    { 16, 18, 24, 5, 17, 72, 19435 }, // ә
-    { 16, 29, 24, 4, 28, 116, 19507 }, // Ӛ
-    { 16, 20, 24, 5, 17, 80, 19623 }, // ӛ
-    { 31, 34, 38, 5, 34, 264, 19703 }, // Ӝ
-    { 27, 29, 35, 4, 29, 196, 19967 }, // ӝ
-    { 15, 30, 19, 2, 30, 113, 20163 }, // Ӟ
-    { 14, 24, 13, 1, 24, 84, 20276 }, // ӟ
-    { 14, 22, 17, 2, 21, 77, 20360 }, // Ӡ
-    { 14, 22, 17, 2, 16, 77, 20437 }, // ӡ
-    { 21, 31, 31, 5, 31, 163, 20514 }, // Ӣ
-    { 16, 23, 20, 2, 23, 92, 20677 }, // ӣ
-    { 21, 33, 31, 5, 33, 174, 20769 }, // Ӥ
-    { 16, 24, 20, 2, 24, 96, 20943 }, // ӥ
-    { 23, 34, 33, 5, 33, 196, 21039 }, // Ӧ
-    { 15, 25, 19, 2, 25, 94, 21235 }, // ӧ
-    { 21, 22, 31, 5, 21, 116, 21329 }, // Ө
-    { 16, 16, 24, 4, 16, 64, 21445 }, // ө
-    { 21, 34, 31, 5, 33, 179, 21509 }, // Ӫ
-    { 16, 27, 24, 4, 27, 108, 21688 }, // ӫ
-    { 20, 32, 27, 3, 31, 160, 21796 }, // Ӭ
-    { 16, 24, 19, 1, 24, 96, 21956 }, // ӭ
-    { 16, 31, 20, 2, 30, 124, 22052 }, // Ӯ
-    { 16, 33, 24, 4, 25, 132, 22176 }, // ӯ
-    { 16, 32, 20, 2, 31, 128, 22308 }, // Ӱ
-    { 16, 35, 24, 4, 27, 140, 22436 }, // ӱ
-    { 22, 33, 20, 0, 32, 182, 22576 }, // Ӳ
-    { 21, 36, 24, 3, 28, 189, 22758 }, // ӳ
-    { 15, 30, 19, 2, 30, 113, 22947 }, // Ӵ
-    { 14, 24, 13, -1, 24, 84, 23060 }, // ӵ
-    { 15, 26, 19, 2, 22, 98, 23144 }, // Ӷ
-    { 11, 18, 13, 1, 15, 50, 23242 }, // ӷ
-    { 27, 32, 33, 2, 32, 216, 23292 }, // Ӹ
-    { 20, 26, 24, 2, 26, 130, 23508 }, // ӹ
-    { 28, 28, 33, 5, 25, 196, 23638 }, // Ӽ
-    { 20, 20, 23, 3, 18, 100, 23834 }, // ӽ
-    { 0, 0, 24, 0, 0, 0, 0 }, //  
-    { 0, 0, 39, 0, 0, 0, 0 }, //  
-    { 0, 0, 24, 0, 0, 0, 0 }, //  
-    { 0, 0, 39, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 14, 3, 16, 2, 10, 11, 0 }, // ‐
-    { 14, 3, 16, 2, 10, 11, 11 }, // ‑
-    { 20, 3, 22, 2, 10, 15, 22 }, // ‒
-    { 19, 4, 23, 2, 10, 19, 37 }, // –
-    { 29, 4, 33, 2, 10, 29, 56 }, // —
-    { 29, 4, 33, 2, 10, 29, 85 }, // ―
-    { 12, 25, 16, 2, 21, 75, 114 }, // ‖
-    { 21, 9, 23, 2, -3, 48, 189 }, // ‗
-    { 8, 9, 10, 1, 25, 18, 237 }, // ‘
-    { 8, 9, 10, 1, 25, 18, 255 }, // ’
-    { 8, 10, 9, 1, 5, 20, 273 }, // ‚
-    { 8, 9, 10, 1, 25, 18, 293 }, // ‛
-    { 15, 9, 16, 1, 25, 34, 311 }, // “
-    { 15, 9, 17, 1, 25, 34, 345 }, // ”
-    { 8, 10, 9, 1, 5, 20, 379 }, // „
-    { 15, 9, 17, 1, 25, 34, 399 }, // ‟
-    { 15, 38, 17, 1, 30, 143, 433 }, // †
-    { 16, 38, 18, 1, 30, 152, 576 }, // ‡
-    { 17, 17, 15, -1, 20, 73, 728 }, // •
-    { 8, 9, 11, 2, 13, 18, 801 }, // ‣
-    { 6, 5, 8, 1, 5, 8, 819 }, // ․
-    { 6, 5, 8, 1, 5, 8, 827 }, // ‥
-    { 26, 5, 28, 1, 5, 33, 835 }, // …
-    { 4, 3, 7, 2, 10, 3, 868 }, // ‧
-    { 0, 0, 37, 0, 0, 0, 871 }, //  
-    { 18, 25, 32, 7, 23, 113, 871 }, // ‰
-    { 8, 9, 9, 1, 25, 18, 984 }, // ′
-    { 15, 9, 16, 1, 25, 34, 1002 }, // ″
-    { 23, 9, 25, 1, 25, 52, 1036 }, // ‴
-    { 8, 9, 10, 1, 24, 18, 1088 }, // ‵
-    { 14, 9, 15, 0, 24, 32, 1106 }, // ‶
-    { 23, 9, 25, 1, 25, 52, 1138 }, // ‷
-    { 12, 5, 16, 2, 23, 15, 1190 }, // ‸
-    { 8, 14, 12, 2, 15, 28, 1205 }, // ‹
-    { 8, 14, 12, 2, 15, 28, 1233 }, // ›
-    { 30, 29, 39, 6, 26, 218, 1261 }, // ※
-    { 7, 29, 10, 1, 29, 51, 1479 }, // ‼
-    { 16, 37, 22, 2, 35, 148, 1530 }, // ‽
-    { 14, 4, 16, 2, 24, 14, 1678 }, // ‾
-    { 12, 6, 16, 2, 20, 18, 1692 }, // ‿
-    { 19, 18, 23, 2, 25, 86, 1710 }, // ⁂
-    { 17, 24, 32, 8, 22, 102, 1796 }, // ⁄
-    { 33, 33, 37, 2, 33, 273, 1898 }, // ⁇
-    { 22, 33, 29, 2, 33, 182, 2171 }, // ⁈
-    { 22, 35, 24, 1, 33, 193, 2353 }, // ⁉
-    { 17, 46, 22, 2, 32, 196, 2546 }, // ⁒
-    { 0, 0, 141, 0, 0, 0, 2742 }, //  
-    { 8, 11, 9, 1, 24, 22, 0 }, // ⁰
-    { 8, 11, 9, 1, 24, 22, 22 }, // ⁴
-    { 8, 12, 9, 1, 25, 24, 44 }, // ⁵
-    { 8, 11, 9, 1, 24, 22, 68 }, // ⁶
-    { 8, 13, 10, 1, 25, 26, 90 }, // ⁷
-    { 9, 11, 10, 0, 24, 25, 116 }, // ⁸
-    { 8, 11, 10, 1, 24, 22, 141 }, // ⁹
-    { 16, 17, 24, 4, 17, 68, 163 }, // ⁿ
-    { 11, 15, 13, 1, 15, 42, 231 }, // ₀
-    { 7, 12, 9, 1, 7, 21, 273 }, // ₁
-    { 8, 12, 10, 1, 7, 24, 294 }, // ₂
-    { 8, 11, 9, 1, 6, 22, 318 }, // ₃
-    { 8, 11, 10, 1, 6, 22, 340 }, // ₄
-    { 7, 12, 9, 1, 7, 21, 362 }, // ₅
-    { 8, 12, 10, 1, 7, 24, 383 }, // ₆
-    { 8, 12, 10, 1, 7, 24, 407 }, // ₇
-    { 9, 11, 10, 0, 6, 25, 431 }, // ₈
-    { 8, 11, 10, 1, 6, 22, 456 }, // ₉
-    { 10, 39, 13, 2, 29, 98, 478 }, // ₍
-    { 9, 39, 13, 1, 29, 88, 576 }, // ₎
-    { 20, 37, 29, 4, 31, 185, 0 }, // ₡
-    { 20, 27, 29, 4, 26, 135, 185 }, // ₢
-    { 18, 28, 20, 1, 28, 126, 320 }, // ₤
-    { 28, 25, 31, 2, 25, 175, 446 }, // ₦
-    { 23, 25, 27, 1, 25, 144, 621 }, // ₧
-    { 29, 24, 33, 4, 24, 174, 765 }, // ₨
-    { 22, 24, 25, 1, 24, 132, 939 }, // ₩
-    { 23, 23, 31, 4, 23, 133, 1071 }, // ₪
-    { 19, 23, 20, 2, 23, 110, 1204 }, // ₫
-    { 18, 26, 22, 2, 23, 117, 1314 }, // €
-    { 21, 25, 31, 5, 25, 132, 1431 }, // ₮
-    { 26, 25, 19, 0, 25, 163, 1563 }, // ₱
-    { 23, 34, 33, 5, 30, 196, 1726 }, // ₲
-    { 26, 27, 27, 2, 26, 176, 1922 }, // ₴
-    { 14, 22, 22, 4, 20, 77, 2098 }, // ₵
-    { 21, 26, 31, 5, 26, 137, 2175 }, // ₸
-    { 14, 22, 18, 2, 22, 77, 2312 }, // ₹
-    { 16, 21, 20, 2, 20, 84, 2389 }, // ₺
-    { 18, 23, 18, 0, 23, 104, 2473 }, // ₼
-    { 23, 25, 27, -1, 25, 144, 2577 }, // ₽
-    { 18, 18, 22, 2, 16, 81, 0 }, // ←
-    { 18, 18, 22, 2, 18, 81, 81 }, // ↑
-    { 18, 18, 22, 2, 16, 81, 162 }, // →
-    { 18, 18, 22, 2, 18, 81, 243 }, // ↓
-    { 22, 16, 26, 2, 16, 88, 324 }, // ↔
-    { 15, 23, 19, 2, 23, 87, 412 }, // ↕
-    { 15, 14, 19, 2, 15, 53, 499 }, // ↖
-    { 15, 14, 19, 2, 15, 53, 552 }, // ↗
-    { 15, 15, 19, 2, 16, 57, 605 }, // ↘
-    { 15, 15, 19, 2, 16, 57, 662 }, // ↙
-    { 21, 19, 25, 2, 18, 100, 719 }, // ⇐
-    { 23, 21, 27, 2, 21, 121, 819 }, // ⇑
-    { 21, 19, 25, 2, 18, 100, 940 }, // ⇒
-    { 23, 22, 27, 2, 21, 127, 1040 }, // ⇓
-    { 24, 19, 28, 2, 18, 114, 1167 }, // ⇔
-    { 19, 24, 23, 2, 16, 114, 1281 }, // ⇕
-    { 16, 23, 20, 2, 23, 92, 0 }, // ∂
-    { 29, 28, 33, 2, 26, 203, 92 }, // ∅
-    { 21, 22, 25, 2, 22, 116, 295 }, // ∆
-    { 18, 21, 22, 2, 21, 95, 411 }, // ∏
-    { 18, 21, 22, 2, 21, 95, 506 }, // ∐
-    { 14, 22, 17, 2, 21, 77, 601 }, // ∑
-    { 14, 4, 18, 2, 10, 14, 678 }, // −
-    { 23, 25, 27, 2, 23, 144, 692 }, // √
-    { 23, 15, 27, 2, 18, 87, 836 }, // ∞
-    { 24, 33, 25, 1, 26, 198, 923 }, // ∫
-    { 6, 18, 8, 1, 18, 27, 1121 }, // ∶
-    { 17, 15, 23, 3, 16, 64, 1148 }, // ≈
-    { 19, 24, 32, 7, 22, 114, 1212 }, // ≠
-    { 21, 22, 25, 2, 20, 116, 1326 }, // ≤
-    { 21, 22, 25, 2, 20, 116, 1442 }, // ≥
+    { 15, 14, 19, 2, 14, 53, 8702 }, // «
+    { 14, 9, 18, 2, 10, 32, 638 }, // ¬
+    { 14, 3, 16, 2, 10, 11, 670 }, // ­
+    { 12, 11, 16, 2, 31, 33, 681 }, // ®
+    { 11, 3, 15, 2, 21, 9, 714 }, // ¯
+    { 14, 14, 16, 1, 23, 49, 723 }, // °
+    { 14, 17, 18, 2, 16, 60, 772 }, // ±
+    { 7, 11, 9, 1, 24, 20, 832 }, // ²
+    { 8, 11, 9, 1, 23, 22, 852 }, // ³
+    { 6, 6, 8, 1, 23, 9, 874 }, // ´
+    { 16, 19, 23, 3, 16, 76, 883 }, // µ
+    { 14, 24, 18, 2, 21, 84, 959 }, // ¶
+    { 6, 5, 8, 1, 12, 8, 1043 }, // ·
+    { 6, 8, 10, 2, 1, 12, 1051 }, // ¸
+    { 7, 11, 8, 1, 24, 20, 1063 }, // ¹
+    { 9, 9, 12, 3, 21, 21, 1083 }, // º
+    { 15, 14, 19, 2, 14, 53, 8755 }, // »
+    { 24, 28, 32, 5, 26, 168, 1104 }, // ¼
+    { 25, 27, 32, 5, 25, 169, 1272 }, // ½
+    { 26, 27, 32, 3, 25, 176, 1441 }, // ¾
+    { 16, 32, 17, 0, 17, 128, 1617 }, // ¿
+    { 23, 33, 33, 5, 33, 190, 8808 }, // À
+    { 23, 38, 33, 5, 38, 219, 8998 }, // Á
+    { 23, 34, 33, 5, 34, 196, 9217 }, // Â
+    { 23, 33, 33, 5, 33, 190, 1745 }, // Ã
+    { 23, 33, 33, 5, 33, 190, 9413 }, // Ä
+    { 23, 35, 33, 5, 35, 202, 1935 }, // Å
+    { 32, 26, 42, 5, 25, 208, 2137 }, // Æ
+    { 20, 33, 29, 4, 26, 165, 9603 }, // Ç
+    { 17, 32, 27, 5, 32, 136, 9768 }, // È
+    { 17, 38, 27, 5, 38, 162, 9904 }, // É
+    { 17, 33, 27, 5, 33, 141, 10066 }, // Ê
+    { 17, 33, 27, 5, 33, 141, 10207 }, // Ë
+    { 10, 35, 13, 0, 35, 88, 10348 }, // Ì
+    { 6, 40, 13, 4, 40, 60, 10436 }, // Í
+    { 12, 36, 13, 0, 36, 108, 10496 }, // Î
+    { 14, 35, 13, -1, 35, 123, 10604 }, // Ï
+    { 27, 25, 32, 1, 25, 169, 2345 }, // Ð
+    { 21, 32, 31, 5, 32, 168, 10727 }, // Ñ
+    { 23, 33, 33, 5, 32, 190, 10895 }, // Ò
+    { 23, 38, 33, 5, 37, 219, 11085 }, // Ó
+    { 23, 34, 33, 5, 33, 196, 11304 }, // Ô
+    { 23, 33, 33, 5, 32, 190, 2514 }, // Õ
+    { 23, 33, 33, 5, 32, 190, 11500 }, // Ö
+    { 13, 8, 17, 2, 11, 26, 2704 }, // ×
+    { 36, 52, 35, -1, 38, 468, 2730 }, // Ø
+    { 21, 35, 31, 5, 34, 184, 11690 }, // Ù
+    { 21, 39, 31, 5, 38, 205, 11874 }, // Ú
+    { 21, 35, 31, 5, 34, 184, 12079 }, // Û
+    { 21, 35, 31, 5, 34, 184, 12263 }, // Ü
+    { 21, 39, 31, 5, 39, 205, 3198 }, // Ý
+    { 14, 23, 16, 1, 23, 81, 3403 }, // Þ
+    { 16, 23, 20, 2, 23, 92, 3484 }, // ß
+    { 17, 23, 24, 3, 23, 98, 12447 }, // à
+    { 17, 28, 24, 3, 28, 119, 12545 }, // á
+    { 17, 24, 24, 3, 24, 102, 12664 }, // â
+    { 17, 23, 24, 3, 23, 98, 3576 }, // ã
+    { 17, 23, 24, 3, 23, 98, 12766 }, // ä
+    { 17, 25, 24, 3, 25, 107, 3674 }, // å
+    { 29, 17, 36, 3, 17, 124, 3781 }, // æ
+    { 14, 24, 22, 4, 17, 84, 12864 }, // ç
+    { 16, 27, 24, 4, 27, 108, 12948 }, // è
+    { 16, 32, 24, 4, 32, 128, 13056 }, // é
+    { 16, 28, 24, 4, 28, 112, 13184 }, // ê
+    { 16, 27, 24, 4, 27, 108, 13296 }, // ë
+    { 10, 24, 13, 0, 24, 60, 13404 }, // ì
+    { 6, 29, 13, 4, 29, 44, 13464 }, // í
+    { 13, 25, 13, 0, 25, 82, 13508 }, // î
+    { 14, 25, 13, -1, 25, 88, 13590 }, // ï
+    { 22, 23, 24, 2, 23, 127, 3905 }, // ð
+    { 16, 25, 24, 4, 25, 100, 13678 }, // ñ
+    { 16, 26, 24, 4, 26, 104, 13778 }, // ò
+    { 16, 31, 24, 4, 31, 124, 13882 }, // ó
+    { 16, 27, 24, 4, 27, 108, 14006 }, // ô
+    { 16, 26, 24, 4, 26, 104, 4032 }, // õ
+    { 16, 26, 24, 4, 26, 104, 14114 }, // ö
+    { 18, 18, 22, 2, 18, 81, 4136 }, // ÷
+    { 17, 45, 24, 3, 30, 192, 4217 }, // ø
+    { 15, 25, 23, 4, 24, 94, 14218 }, // ù
+    { 15, 30, 23, 4, 29, 113, 14312 }, // ú
+    { 15, 26, 23, 4, 25, 98, 14425 }, // û
+    { 15, 25, 23, 4, 24, 94, 14523 }, // ü
+    { 16, 39, 24, 4, 31, 156, 4409 }, // ý
+    { 13, 30, 16, 2, 24, 98, 4565 }, // þ
+    { 16, 35, 24, 4, 27, 140, 4663 }, // ÿ
+    { 23, 32, 33, 5, 32, 184, 4803 }, // Ā
+    { 17, 22, 24, 3, 22, 94, 4987 }, // ā
+    { 23, 36, 33, 5, 36, 207, 5081 }, // Ă
+    { 17, 25, 24, 3, 25, 107, 5288 }, // ă
+    { 23, 32, 33, 5, 25, 184, 5395 }, // Ą
+    { 17, 22, 24, 3, 17, 94, 5579 }, // ą
+    { 20, 39, 29, 4, 38, 195, 5673 }, // Ć
+    { 14, 28, 22, 4, 27, 98, 5868 }, // ć
+    { 20, 37, 29, 4, 36, 185, 5966 }, // Ĉ
+    { 14, 25, 22, 4, 24, 88, 6151 }, // ĉ
+    { 20, 37, 29, 4, 36, 185, 6239 }, // Ċ
+    { 14, 26, 22, 4, 25, 91, 6424 }, // ċ
+    { 20, 39, 29, 4, 38, 195, 6515 }, // Č
+    { 14, 27, 22, 4, 26, 95, 6710 }, // č
+    { 23, 36, 32, 5, 36, 207, 6805 }, // Ď
+    { 22, 26, 25, 4, 25, 143, 7012 }, // ď
+    { 27, 25, 32, 1, 25, 169, 7155 }, // Đ
+    { 21, 26, 25, 4, 25, 137, 7324 }, // đ
+    { 17, 32, 27, 5, 32, 136, 7461 }, // Ē
+    { 16, 26, 24, 4, 26, 104, 7597 }, // ē
+    { 17, 35, 27, 5, 35, 149, 7701 }, // Ĕ
+    { 16, 30, 24, 4, 30, 120, 7850 }, // ĕ
+    { 17, 34, 27, 5, 34, 145, 7970 }, // Ė
+    { 16, 28, 24, 4, 28, 112, 8115 }, // ė
+    { 17, 31, 27, 5, 25, 132, 8227 }, // Ę
+    { 16, 24, 24, 4, 17, 96, 8359 }, // ę
+    { 17, 35, 27, 5, 35, 149, 8455 }, // Ě
+    { 16, 30, 24, 4, 30, 120, 8604 }, // ě
+    { 23, 34, 33, 5, 34, 196, 8724 }, // Ĝ
+    { 16, 32, 23, 4, 25, 128, 8920 }, // ĝ
+    { 23, 36, 33, 5, 36, 207, 9048 }, // Ğ
+    { 16, 33, 23, 4, 26, 132, 9255 }, // ğ
+    { 23, 34, 33, 5, 34, 196, 9387 }, // Ġ
+    { 16, 32, 23, 4, 25, 128, 9583 }, // ġ
+    { 23, 39, 33, 5, 26, 225, 9711 }, // Ģ
+    { 16, 34, 23, 4, 27, 136, 9936 }, // ģ
+    { 21, 33, 31, 5, 33, 174, 10072 }, // Ĥ
+    { 19, 31, 24, 1, 31, 148, 10246 }, // ĥ
+    { 24, 24, 31, 3, 24, 144, 10394 }, // Ħ
+    { 19, 25, 24, 1, 25, 119, 10538 }, // ħ
+    { 11, 36, 13, 1, 36, 99, 10657 }, // Ĩ
+    { 11, 25, 13, 1, 25, 69, 10756 }, // ĩ
+    { 14, 34, 13, -1, 34, 119, 10825 }, // Ī
+    { 14, 23, 13, 0, 23, 81, 10944 }, // ī
+    { 7, 31, 18, 7, 25, 55, 11025 }, // Į
+    { 7, 32, 13, 3, 26, 56, 11080 }, // į
+    { 7, 36, 13, 3, 36, 63, 11136 }, // İ
+    { 5, 17, 13, 4, 17, 22, 11199 }, // ı
+    { 18, 32, 27, 4, 25, 144, 11221 }, // Ĳ
+    { 22, 34, 13, 4, 26, 187, 11365 }, // ĳ
+    { 13, 39, 22, 5, 32, 127, 11552 }, // Ĵ
+    { 15, 32, 19, 4, 24, 120, 11679 }, // ĵ
+    { 20, 35, 30, 5, 25, 175, 11799 }, // Ķ
+    { 16, 37, 24, 4, 24, 148, 11974 }, // ķ
+    { 13, 16, 19, 3, 16, 52, 12122 }, // ĸ
+    { 16, 35, 27, 5, 35, 140, 12174 }, // Ĺ
+    { 9, 34, 16, 3, 34, 77, 12314 }, // ĺ
+    { 16, 38, 27, 5, 25, 152, 12391 }, // Ļ
+    { 9, 36, 16, 3, 24, 81, 12543 }, // ļ
+    { 16, 25, 27, 5, 25, 100, 12624 }, // Ľ
+    { 12, 25, 16, 3, 25, 75, 12724 }, // ľ
+    { 16, 25, 27, 5, 25, 100, 12799 }, // Ŀ
+    { 13, 24, 16, 3, 24, 78, 12899 }, // ŀ
+    { 28, 41, 27, -7, 32, 287, 12977 }, // Ł
+    { 19, 24, 16, -6, 24, 114, 13264 }, // ł
+    { 21, 35, 31, 5, 35, 184, 13378 }, // Ń
+    { 16, 28, 24, 4, 28, 112, 13562 }, // ń
+    { 21, 35, 31, 5, 25, 184, 13674 }, // Ņ
+    { 16, 27, 24, 4, 17, 108, 13858 }, // ņ
+    { 21, 35, 31, 5, 35, 184, 13966 }, // Ň
+    { 16, 28, 24, 4, 28, 112, 14150 }, // ň
+    { 16, 30, 20, 2, 30, 120, 14262 }, // ŉ
+    { 21, 30, 31, 5, 25, 158, 14382 }, // Ŋ
+    { 16, 23, 24, 4, 17, 92, 14540 }, // ŋ
+    { 23, 32, 33, 5, 31, 184, 14632 }, // Ō
+    { 16, 25, 24, 4, 25, 100, 14816 }, // ō
+    { 23, 36, 33, 5, 35, 207, 14916 }, // Ŏ
+    { 16, 29, 24, 4, 29, 116, 15123 }, // ŏ
+    { 24, 34, 33, 5, 33, 204, 15239 }, // Ő
+    { 22, 27, 24, 2, 27, 149, 15443 }, // ő
+    { 33, 25, 35, 5, 25, 207, 14617 }, // Œ
+    { 28, 17, 31, 4, 17, 119, 14824 }, // œ
+    { 18, 34, 28, 5, 34, 153, 15592 }, // Ŕ
+    { 11, 25, 19, 4, 25, 69, 15745 }, // ŕ
+    { 18, 39, 28, 5, 25, 176, 15814 }, // Ŗ
+    { 12, 31, 19, 3, 16, 93, 15990 }, // ŗ
+    { 18, 34, 28, 5, 34, 153, 16083 }, // Ř
+    { 13, 25, 19, 2, 25, 82, 16236 }, // ř
+    { 23, 38, 33, 5, 37, 219, 16318 }, // Ś
+    { 15, 26, 23, 4, 26, 98, 16537 }, // ś
+    { 23, 36, 33, 5, 35, 207, 16635 }, // Ŝ
+    { 15, 24, 23, 4, 24, 90, 16842 }, // ŝ
+    { 23, 33, 33, 5, 26, 190, 16932 }, // Ş
+    { 15, 24, 23, 4, 16, 90, 17122 }, // ş
+    { 23, 38, 33, 5, 37, 219, 17212 }, // Š
+    { 15, 26, 23, 4, 26, 98, 17431 }, // š
+    { 21, 31, 31, 5, 25, 163, 17529 }, // Ţ
+    { 13, 28, 21, 4, 22, 91, 17692 }, // ţ
+    { 21, 35, 31, 5, 35, 184, 17783 }, // Ť
+    { 14, 25, 21, 4, 25, 88, 17967 }, // ť
+    { 21, 25, 31, 5, 25, 132, 18055 }, // Ŧ
+    { 14, 22, 21, 3, 22, 77, 18187 }, // ŧ
+    { 21, 36, 31, 5, 35, 189, 18264 }, // Ũ
+    { 15, 26, 23, 4, 25, 98, 18453 }, // ũ
+    { 21, 34, 31, 5, 33, 179, 18551 }, // Ū
+    { 15, 24, 23, 4, 23, 90, 18730 }, // ū
+    { 21, 37, 31, 5, 36, 195, 18820 }, // Ŭ
+    { 15, 27, 23, 4, 26, 102, 19015 }, // ŭ
+    { 21, 38, 31, 5, 37, 200, 19117 }, // Ů
+    { 15, 28, 23, 4, 27, 105, 19317 }, // ů
+    { 22, 36, 31, 5, 35, 198, 19422 }, // Ű
+    { 22, 26, 23, 1, 25, 143, 19620 }, // ű
+    { 21, 31, 31, 5, 25, 163, 19763 }, // Ų
+    { 15, 23, 23, 4, 16, 87, 19926 }, // ų
+    { 31, 34, 42, 5, 34, 264, 20013 }, // Ŵ
+    { 22, 26, 30, 4, 26, 143, 20277 }, // ŵ
+    { 21, 35, 31, 5, 35, 184, 20420 }, // Ŷ
+    { 16, 35, 24, 4, 27, 140, 20604 }, // ŷ
+    { 21, 34, 31, 5, 34, 179, 20744 }, // Ÿ
+    { 23, 35, 33, 5, 35, 202, 20923 }, // Ź
+    { 16, 27, 24, 4, 27, 108, 21125 }, // ź
+    { 23, 33, 33, 5, 33, 190, 21233 }, // Ż
+    { 16, 25, 24, 4, 25, 100, 21423 }, // ż
+    { 23, 35, 33, 5, 35, 202, 21523 }, // Ž
+    { 16, 27, 24, 4, 27, 108, 21725 }, // ž
+    { 10, 24, 15, 4, 24, 60, 21833 }, // ſ
+    { 10, 5, 0, 1, 22, 13, 21893 }, // ̀
+    { 6, 6, 0, 1, 23, 9, 21906 }, // ́
+    { 12, 6, 0, 2, 0, 18, 21915 }, // ̂
+    { 11, 6, 0, 1, 22, 17, 21933 }, // ̃
+    { 14, 4, 0, 2, 20, 14, 21950 }, // ̄
+    { 19, 4, 0, 2, 26, 19, 21964 }, // ̅
+    { 12, 6, 0, 2, 21, 18, 21983 }, // ̆
+    { 6, 5, 0, 1, 22, 8, 22001 }, // ̇
+    { 14, 5, 0, 1, 23, 18, 22009 }, // ̈
+    { 7, 6, 0, 0, 19, 11, 22027 }, // ̉
+    { 7, 6, 0, 1, 22, 11, 22038 }, // ̊
+    { 22, 5, 0, 1, 22, 28, 22049 }, // ̋
+    { 12, 6, 0, 2, 22, 18, 22077 }, // ̌
+    { 22, 5, 0, -6, 24, 28, 22095 }, // ̏
+    { 7, 9, 0, 1, 22, 16, 22123 }, // ̒
+    { 8, 9, 0, 1, 22, 18, 22139 }, // ̓
+    { 7, 9, 0, 1, 22, 16, 22157 }, // ̔
+    { 5, 7, 0, 2, -1, 9, 22173 }, // ̘
+    { 5, 7, 0, 2, -1, 9, 22182 }, // ̙
+    { 12, 7, 0, 2, 23, 21, 22191 }, // ̚
+    { 4, 6, 0, 2, 18, 6, 22212 }, // ̛
+    { 3, 6, 0, 2, -2, 5, 22218 }, // ̜
+    { 7, 5, 0, 2, 3, 9, 22223 }, // ̝
+    { 7, 5, 0, 2, -1, 9, 22232 }, // ̞
+    { 6, 7, 0, 2, -2, 11, 22241 }, // ̟
+    { 14, 4, 0, 2, -4, 14, 22252 }, // ̠
+    { 6, 5, 0, 1, 1, 8, 22266 }, // ̣
+    { 14, 5, 0, 1, -1, 18, 22274 }, // ̤
+    { 7, 6, 0, 1, 22, 11, 22292 }, // ̥
+    { 8, 10, 0, 1, 5, 20, 22303 }, // ̦
+    { 6, 8, 0, 2, 1, 12, 22323 }, // ̧
+    { 6, 8, 0, 2, 1, 12, 22335 }, // ̨
+    { 4, 8, 0, 2, -2, 8, 22347 }, // ̩
+    { 9, 5, 0, 2, -1, 12, 22355 }, // ̪
+    { 12, 6, 0, 2, 0, 18, 22367 }, // ̬
+    { 13, 6, 0, 1, -1, 20, 22385 }, // ̭
+    { 11, 6, 0, 1, 22, 17, 22405 }, // ̰
+    { 11, 3, 0, 2, 21, 9, 22422 }, // ̱
+    { 12, 4, 0, 2, -2, 12, 22431 }, // ̲
+    { 11, 6, 0, 1, 22, 17, 22443 }, // ̴
+    { 14, 3, 0, 2, 10, 11, 22460 }, // ̵
+    { 3, 6, 0, 2, -2, 5, 22471 }, // ̹
+    { 9, 5, 0, 2, -1, 12, 22476 }, // ̺
+    { 9, 8, 0, 2, 0, 18, 22488 }, // ̻
+    { 9, 6, 0, 2, 0, 14, 22506 }, // ̼
+    { 7, 6, 0, 3, 22, 11, 22520 }, // ̽
+    { 11, 6, 0, 1, 22, 17, 22531 }, // ͂
+    { 4, 5, 0, 2, 24, 5, 22548 }, // ̓
+    { 14, 13, 0, 1, 31, 46, 22553 }, // ̈́
+    { 9, 5, 0, 2, 23, 12, 22599 }, // ͆
+    { 14, 11, 0, 2, 0, 39, 22611 }, // ͇
+    { 11, 8, 0, 2, 0, 22, 22650 }, // ͈
+    { 9, 7, 0, 2, -2, 16, 22672 }, // ͉
+    { 11, 16, 0, 1, 27, 44, 22688 }, // ͊
+    { 24, 13, 0, 1, 26, 78, 22732 }, // ͋
+    { 17, 15, 0, 3, 16, 64, 22810 }, // ͌
+    { 15, 7, 0, 2, -3, 27, 22874 }, // ͍
+    { 4, 4, 0, 2, 3, 4, 22901 }, // ͎
+    { 24, 6, 0, 2, 0, 36, 22905 }, // ͜
+    { 24, 6, 0, 2, 23, 36, 22941 }, // ͡
+    { 28, 7, 0, 2, -2, 49, 22977 }, // ͢
+    { 15, 30, 18, 2, 30, 113, 23026 }, // Ѐ
+    { 15, 28, 18, 2, 28, 105, 0 }, // Ё
+    { 24, 24, 30, 3, 24, 144, 23139 }, // Ђ
+    { 15, 34, 19, 2, 34, 128, 23283 }, // Ѓ
+    { 20, 24, 27, 4, 23, 120, 23411 }, // Є
+    { 23, 27, 33, 5, 26, 156, 23531 }, // Ѕ
+    { 6, 25, 13, 4, 25, 38, 23687 }, // І
+    { 14, 35, 13, -1, 35, 123, 23725 }, // Ї
+    { 12, 33, 22, 5, 26, 99, 0 }, // Ј
+    { 28, 23, 34, 3, 22, 161, 99 }, // Љ
+    { 27, 22, 33, 3, 22, 149, 260 }, // Њ
+    { 24, 25, 31, 5, 25, 150, 409 }, // Ћ
+    { 20, 35, 30, 5, 35, 175, 559 }, // Ќ
+    { 21, 33, 31, 5, 33, 174, 734 }, // Ѝ
+    { 16, 34, 20, 2, 33, 136, 908 }, // Ў
+    { 17, 27, 21, 2, 21, 115, 1044 }, // Џ
+    { 23, 25, 33, 5, 25, 144, 105 }, // А
+    { 15, 21, 19, 2, 21, 79, 249 }, // Б
+    { 16, 21, 20, 2, 21, 84, 328 }, // В
+    { 15, 22, 19, 2, 22, 83, 412 }, // Г
+    { 21, 24, 24, 2, 21, 126, 495 }, // Д
+    { 15, 22, 18, 2, 22, 83, 621 }, // Е
+    { 31, 25, 42, 5, 25, 194, 704 }, // Ж
+    { 15, 22, 19, 2, 22, 83, 898 }, // З
+    { 21, 25, 31, 5, 25, 132, 981 }, // И
+    { 21, 35, 31, 5, 35, 184, 1113 }, // Й
+    { 20, 25, 30, 5, 25, 125, 1297 }, // К
+    { 17, 22, 22, 2, 21, 94, 1422 }, // Л
+    { 21, 21, 25, 2, 21, 111, 1516 }, // М
+    { 21, 25, 31, 5, 25, 132, 1627 }, // Н
+    { 23, 26, 33, 5, 25, 150, 1759 }, // О
+    { 16, 22, 20, 2, 22, 88, 1909 }, // П
+    { 17, 25, 27, 5, 25, 107, 1997 }, // Р
+    { 20, 27, 29, 4, 26, 135, 2104 }, // С
+    { 21, 25, 31, 5, 25, 132, 2239 }, // Т
+    { 16, 24, 20, 2, 23, 96, 2371 }, // У
+    { 22, 22, 25, 2, 22, 121, 2467 }, // Ф
+    { 23, 25, 33, 5, 25, 144, 2588 }, // Х
+    { 17, 27, 21, 2, 22, 115, 2732 }, // Ц
+    { 15, 22, 19, 2, 22, 83, 2847 }, // Ч
+    { 20, 22, 24, 2, 22, 110, 2930 }, // Ш
+    { 23, 27, 26, 2, 22, 156, 3040 }, // Щ
+    { 20, 22, 19, -3, 22, 110, 3196 }, // Ъ
+    { 27, 23, 33, 2, 23, 156, 3306 }, // Ы
+    { 15, 22, 19, 2, 22, 83, 3462 }, // Ь
+    { 20, 24, 27, 3, 23, 120, 3545 }, // Э
+    { 23, 22, 29, 3, 22, 127, 3665 }, // Ю
+    { 18, 25, 28, 5, 25, 113, 3792 }, // Я
+    { 17, 17, 24, 3, 17, 73, 3905 }, // а
+    { 17, 23, 20, 2, 23, 98, 3978 }, // б
+    { 14, 18, 21, 4, 18, 63, 4076 }, // в
+    { 14, 17, 17, 2, 17, 60, 4139 }, // г
+    { 18, 20, 22, 2, 17, 90, 4199 }, // д
+    { 16, 17, 24, 4, 17, 68, 4289 }, // е
+    { 27, 20, 35, 4, 20, 135, 4357 }, // ж
+    { 11, 16, 13, 1, 16, 44, 4492 }, // з
+    { 16, 17, 20, 2, 17, 68, 4536 }, // и
+    { 16, 22, 20, 2, 22, 88, 4604 }, // й
+    { 15, 17, 23, 4, 17, 64, 4692 }, // к
+    { 12, 16, 15, 1, 15, 48, 4756 }, // л
+    { 19, 19, 27, 4, 19, 91, 4804 }, // м
+    { 18, 19, 27, 4, 19, 86, 4895 }, // н
+    { 15, 16, 19, 2, 16, 60, 4981 }, // о
+    { 15, 17, 19, 2, 17, 64, 5041 }, // п
+    { 18, 24, 24, 2, 16, 108, 5105 }, // р
+    { 14, 18, 22, 4, 17, 63, 5213 }, // с
+    { 16, 16, 20, 2, 16, 64, 5276 }, // т
+    { 16, 24, 24, 4, 16, 96, 5340 }, // у
+    { 22, 23, 25, 2, 16, 127, 5436 }, // ф
+    { 17, 16, 21, 2, 16, 68, 5563 }, // х
+    { 17, 21, 21, 2, 17, 90, 5631 }, // ц
+    { 11, 15, 13, 1, 15, 42, 5721 }, // ч
+    { 20, 17, 24, 2, 17, 85, 5763 }, // ш
+    { 22, 22, 26, 2, 17, 121, 5848 }, // щ
+    { 18, 16, 22, 2, 16, 72, 5969 }, // ъ
+    { 20, 17, 24, 2, 17, 85, 6041 }, // ы
+    { 14, 17, 18, 2, 17, 60, 6126 }, // ь
+    { 15, 16, 19, 2, 16, 60, 6186 }, // э
+    { 19, 17, 23, 2, 17, 81, 6246 }, // ю
+    { 14, 16, 18, 2, 16, 56, 6327 }, // я
+    { 16, 28, 24, 4, 28, 112, 1159 }, // ѐ
+    { 15, 22, 19, 2, 22, 83, 6383 }, // ё
+    { 20, 29, 24, 1, 25, 145, 1271 }, // ђ
+    { 14, 25, 17, 2, 25, 88, 1416 }, // ѓ
+    { 15, 17, 19, 2, 16, 64, 1504 }, // є
+    { 15, 16, 23, 4, 16, 60, 1568 }, // ѕ
+    { 6, 26, 13, 4, 26, 39, 1628 }, // і
+    { 14, 25, 13, -1, 25, 88, 1667 }, // ї
+    { 12, 33, 19, 4, 25, 99, 1755 }, // ј
+    { 20, 16, 23, 2, 15, 80, 1854 }, // љ
+    { 19, 15, 23, 2, 15, 72, 1934 }, // њ
+    { 19, 25, 24, 1, 25, 119, 2006 }, // ћ
+    { 15, 26, 23, 4, 26, 98, 2125 }, // ќ
+    { 16, 25, 20, 2, 25, 100, 2223 }, // ѝ
+    { 16, 36, 24, 4, 28, 144, 2323 }, // ў
+    { 13, 20, 15, 1, 15, 65, 2467 }, // џ
+    { 17, 23, 24, 4, 22, 98, 2532 }, // Ѣ
+    { 17, 22, 21, 2, 21, 94, 2630 }, // ѣ
+    { 23, 21, 30, 3, 21, 121, 2724 }, // Ѫ
+    { 17, 15, 21, 2, 15, 64, 2845 }, // ѫ
+    { 21, 27, 31, 5, 26, 142, 2909 }, // Ѳ
+    { 16, 20, 24, 4, 20, 80, 3051 }, // ѳ
+    { 30, 33, 34, 5, 33, 248, 3131 }, // Ѵ
+    { 19, 20, 24, 3, 20, 95, 3379 }, // ѵ
+    { 10, 9, 0, 2, 27, 23, 3474 }, // ҆
+    { 15, 25, 19, 2, 25, 94, 3497 }, // Ґ
+    { 14, 20, 17, 2, 20, 70, 3591 }, // ґ
+    { 16, 22, 19, 1, 22, 88, 3661 }, // Ғ
+    { 12, 15, 13, 0, 15, 45, 3749 }, // ғ
+    { 17, 24, 20, 2, 24, 102, 3794 }, // Ҕ
+    { 10, 15, 12, 1, 15, 38, 3896 }, // ҕ
+    { 31, 29, 37, 3, 25, 225, 3934 }, // Җ
+    { 22, 21, 26, 2, 18, 116, 4159 }, // җ
+    { 15, 25, 21, 3, 22, 94, 4275 }, // Ҙ
+    { 11, 23, 13, 1, 16, 64, 4369 }, // ҙ
+    { 20, 29, 26, 3, 25, 145, 4433 }, // Қ
+    { 14, 21, 18, 2, 18, 74, 4578 }, // қ
+    { 22, 21, 28, 3, 21, 116, 4652 }, // Ҝ
+    { 17, 15, 21, 2, 15, 64, 4768 }, // ҝ
+    { 21, 25, 30, 4, 25, 132, 4832 }, // Ҟ
+    { 19, 23, 24, 1, 23, 110, 4964 }, // ҟ
+    { 27, 25, 30, -2, 25, 169, 5074 }, // Ҡ
+    { 19, 18, 20, -2, 18, 86, 5243 }, // ҡ
+    { 22, 28, 27, 3, 25, 154, 5329 }, // Ң
+    { 15, 20, 19, 2, 17, 75, 5483 }, // ң
+    { 30, 26, 31, 5, 26, 195, 5558 }, // Ҥ
+    { 21, 17, 22, 3, 17, 90, 5753 }, // ҥ
+    { 28, 24, 34, 3, 24, 168, 5843 }, // Ҧ
+    { 27, 27, 31, 2, 19, 183, 6011 }, // ҧ
+    { 29, 25, 35, 3, 24, 182, 6194 }, // Ҩ
+    { 23, 20, 27, 2, 19, 115, 6376 }, // ҩ
+    { 20, 31, 29, 4, 26, 155, 6491 }, // Ҫ
+    { 14, 21, 22, 4, 17, 74, 6646 }, // ҫ
+    { 21, 28, 27, 3, 25, 147, 6720 }, // Ҭ
+    { 15, 19, 19, 2, 17, 72, 6867 }, // ҭ
+    { 21, 25, 31, 5, 25, 132, 6939 }, // Ү
+    { 16, 21, 19, 2, 15, 84, 7071 }, // ү
+    { 21, 25, 31, 5, 25, 132, 7155 }, // Ұ
+    { 17, 22, 19, 1, 15, 94, 7287 }, // ұ
+    { 24, 29, 29, 3, 25, 174, 7381 }, // Ҳ
+    { 17, 20, 20, 2, 17, 85, 7555 }, // ҳ
+    { 25, 27, 31, 3, 21, 169, 7640 }, // Ҵ
+    { 18, 19, 22, 2, 15, 86, 7809 }, // ҵ
+    { 19, 28, 24, 2, 21, 133, 7895 }, // Ҷ
+    { 14, 20, 17, 1, 15, 70, 8028 }, // ҷ
+    { 17, 22, 21, 2, 22, 94, 8098 }, // Ҹ
+    { 12, 15, 15, 1, 15, 45, 8192 }, // ҹ
+    { 16, 24, 22, 3, 24, 96, 8237 }, // Һ
+    { 16, 25, 24, 4, 25, 100, 8333 }, // һ
+    { 25, 22, 28, 0, 21, 138, 8433 }, // Ҽ
+    { 18, 16, 20, 0, 16, 72, 8571 }, // ҽ
+    { 26, 25, 32, 3, 21, 163, 8643 }, // Ҿ
+    { 19, 19, 23, 2, 16, 91, 8806 }, // ҿ
+    { 6, 25, 13, 4, 25, 38, 8897 }, // Ӏ
+    { 31, 35, 42, 5, 35, 272, 8935 }, // Ӂ
+    { 27, 31, 35, 4, 31, 210, 9207 }, // ӂ
+    { 17, 29, 23, 3, 22, 124, 9417 }, // Ӄ
+    { 12, 20, 16, 2, 15, 60, 9541 }, // ӄ
+    { 21, 27, 22, 2, 22, 142, 9601 }, // Ӆ
+    { 14, 18, 15, 2, 15, 63, 9743 }, // ӆ
+    { 23, 32, 31, 5, 25, 184, 9806 }, // Ӈ
+    { 16, 22, 22, 3, 17, 88, 9990 }, // ӈ
+    { 23, 34, 31, 5, 25, 196, 10078 }, // Ӊ
+    { 16, 23, 22, 3, 17, 92, 10274 }, // ӊ
+    { 16, 27, 20, 1, 21, 108, 10366 }, // Ӌ
+    { 11, 18, 15, 2, 15, 50, 10474 }, // ӌ
+    { 28, 34, 36, 5, 25, 238, 10524 }, // Ӎ
+    { 20, 23, 25, 3, 17, 115, 10762 }, // ӎ
+    { 4, 21, 8, 2, 21, 21, 10877 }, // ӏ
+    { 23, 35, 33, 5, 35, 202, 10898 }, // Ӑ
+    { 17, 26, 24, 3, 26, 111, 11100 }, // ӑ
+    { 23, 34, 33, 5, 34, 196, 11211 }, // Ӓ
+    { 17, 25, 24, 3, 25, 107, 11407 }, // ӓ
+    { 32, 26, 42, 5, 25, 208, 11514 }, // Ӕ
+    { 29, 17, 36, 3, 17, 124, 11722 }, // ӕ
+    { 15, 31, 18, 2, 31, 117, 11846 }, // Ӗ
+    { 16, 29, 24, 4, 29, 116, 11963 }, // ӗ
+    { 16, 17, 24, 4, 16, 68, 12079 }, // Ә
+    { 16, 18, 24, 5, 17, 72, 12147 }, // ә
+    { 16, 29, 24, 4, 28, 116, 12219 }, // Ӛ
+    { 16, 20, 24, 5, 17, 80, 12335 }, // ӛ
+    { 31, 34, 38, 5, 34, 264, 12415 }, // Ӝ
+    { 27, 29, 35, 4, 29, 196, 12679 }, // ӝ
+    { 15, 30, 19, 2, 30, 113, 12875 }, // Ӟ
+    { 14, 24, 13, 1, 24, 84, 12988 }, // ӟ
+    { 14, 22, 17, 2, 21, 77, 13072 }, // Ӡ
+    { 14, 22, 17, 2, 16, 77, 13149 }, // ӡ
+    { 21, 31, 31, 5, 31, 163, 13226 }, // Ӣ
+    { 16, 23, 20, 2, 23, 92, 13389 }, // ӣ
+    { 21, 33, 31, 5, 33, 174, 13481 }, // Ӥ
+    { 16, 24, 20, 2, 24, 96, 13655 }, // ӥ
+    { 23, 34, 33, 5, 33, 196, 13751 }, // Ӧ
+    { 15, 25, 19, 2, 25, 94, 13947 }, // ӧ
+    { 21, 22, 31, 5, 21, 116, 14041 }, // Ө
+    { 16, 16, 24, 4, 16, 64, 14157 }, // ө
+    { 21, 34, 31, 5, 33, 179, 14221 }, // Ӫ
+    { 16, 27, 24, 4, 27, 108, 14400 }, // ӫ
+    { 20, 32, 27, 3, 31, 160, 14508 }, // Ӭ
+    { 16, 24, 19, 1, 24, 96, 14668 }, // ӭ
+    { 16, 31, 20, 2, 30, 124, 14764 }, // Ӯ
+    { 16, 33, 24, 4, 25, 132, 14888 }, // ӯ
+    { 16, 32, 20, 2, 31, 128, 15020 }, // Ӱ
+    { 16, 35, 24, 4, 27, 140, 15148 }, // ӱ
+    { 22, 33, 20, 0, 32, 182, 15288 }, // Ӳ
+    { 21, 36, 24, 3, 28, 189, 15470 }, // ӳ
+    { 15, 30, 19, 2, 30, 113, 15659 }, // Ӵ
+    { 14, 24, 13, -1, 24, 84, 15772 }, // ӵ
+    { 15, 26, 19, 2, 22, 98, 15856 }, // Ӷ
+    { 11, 18, 13, 1, 15, 50, 15954 }, // ӷ
+    { 27, 32, 33, 2, 32, 216, 16004 }, // Ӹ
+    { 20, 26, 24, 2, 26, 130, 16220 }, // ӹ
+    { 28, 28, 33, 5, 25, 196, 16350 }, // Ӽ
+    { 20, 20, 23, 3, 18, 100, 16546 }, // ӽ
+    { 0, 0, 24, 0, 0, 0, 16646 }, //  
+    { 0, 0, 39, 0, 0, 0, 16646 }, //  
+    { 0, 0, 24, 0, 0, 0, 16646 }, //  
+    { 0, 0, 39, 0, 0, 0, 16646 }, //  
+    { 0, 0, 19, 0, 0, 0, 16646 }, //  
+    { 0, 0, 17, 0, 0, 0, 16646 }, //  
+    { 0, 0, 14, 0, 0, 0, 16646 }, //  
+    { 0, 0, 19, 0, 0, 0, 16646 }, //  
+    { 0, 0, 8, 0, 0, 0, 16646 }, //  
+    { 0, 0, 15, 0, 0, 0, 16646 }, //  
+    { 0, 0, 14, 0, 0, 0, 16646 }, //  
+    { 0, 0, 9, 0, 0, 0, 16646 }, // ​
+    { 0, 0, 0, 0, 0, 0, 16646 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 16646 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 16646 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 16646 }, // ‏
+    { 14, 3, 16, 2, 10, 11, 16646 }, // ‐
+    { 14, 3, 16, 2, 10, 11, 16657 }, // ‑
+    { 20, 3, 22, 2, 10, 15, 16668 }, // ‒
+    { 19, 4, 23, 2, 10, 19, 14943 }, // –
+    { 29, 4, 33, 2, 10, 29, 14962 }, // —
+    { 29, 4, 33, 2, 10, 29, 16683 }, // ―
+    { 12, 25, 16, 2, 21, 75, 16712 }, // ‖
+    { 21, 9, 23, 2, -3, 48, 16787 }, // ‗
+    { 8, 9, 10, 1, 25, 18, 14991 }, // ‘
+    { 8, 9, 10, 1, 25, 18, 15009 }, // ’
+    { 8, 10, 9, 1, 5, 20, 16835 }, // ‚
+    { 8, 9, 10, 1, 25, 18, 16855 }, // ‛
+    { 15, 9, 16, 1, 25, 34, 15027 }, // “
+    { 15, 9, 17, 1, 25, 34, 15061 }, // ”
+    { 8, 10, 9, 1, 5, 20, 16873 }, // „
+    { 15, 9, 17, 1, 25, 34, 16893 }, // ‟
+    { 15, 38, 17, 1, 30, 143, 16927 }, // †
+    { 16, 38, 18, 1, 30, 152, 17070 }, // ‡
+    { 17, 17, 15, -1, 20, 73, 17222 }, // •
+    { 8, 9, 11, 2, 13, 18, 17295 }, // ‣
+    { 6, 5, 8, 1, 5, 8, 17313 }, // ․
+    { 6, 5, 8, 1, 5, 8, 17321 }, // ‥
+    { 26, 5, 28, 1, 5, 33, 15095 }, // …
+    { 4, 3, 7, 2, 10, 3, 17329 }, // ‧
+    { 0, 0, 37, 0, 0, 0, 17332 }, //  
+    { 18, 25, 32, 7, 23, 113, 17332 }, // ‰
+    { 8, 9, 9, 1, 25, 18, 17445 }, // ′
+    { 15, 9, 16, 1, 25, 34, 17463 }, // ″
+    { 23, 9, 25, 1, 25, 52, 17497 }, // ‴
+    { 8, 9, 10, 1, 24, 18, 17549 }, // ‵
+    { 14, 9, 15, 0, 24, 32, 17567 }, // ‶
+    { 23, 9, 25, 1, 25, 52, 17599 }, // ‷
+    { 12, 5, 16, 2, 23, 15, 17651 }, // ‸
+    { 8, 14, 12, 2, 15, 28, 17666 }, // ‹
+    { 8, 14, 12, 2, 15, 28, 17694 }, // ›
+    { 30, 29, 39, 6, 26, 218, 17722 }, // ※
+    { 7, 29, 10, 1, 29, 51, 17940 }, // ‼
+    { 16, 37, 22, 2, 35, 148, 17991 }, // ‽
+    { 14, 4, 16, 2, 24, 14, 18139 }, // ‾
+    { 12, 6, 16, 2, 20, 18, 18153 }, // ‿
+    { 19, 18, 23, 2, 25, 86, 18171 }, // ⁂
+    { 17, 24, 32, 8, 22, 102, 18257 }, // ⁄
+    { 33, 33, 37, 2, 33, 273, 18359 }, // ⁇
+    { 22, 33, 29, 2, 33, 182, 18632 }, // ⁈
+    { 22, 35, 24, 1, 33, 193, 18814 }, // ⁉
+    { 17, 46, 22, 2, 32, 196, 19007 }, // ⁒
+    { 0, 0, 141, 0, 0, 0, 19203 }, //  
+    { 8, 11, 9, 1, 24, 22, 19203 }, // ⁰
+    { 8, 11, 9, 1, 24, 22, 19225 }, // ⁴
+    { 8, 12, 9, 1, 25, 24, 19247 }, // ⁵
+    { 8, 11, 9, 1, 24, 22, 19271 }, // ⁶
+    { 8, 13, 10, 1, 25, 26, 19293 }, // ⁷
+    { 9, 11, 10, 0, 24, 25, 19319 }, // ⁸
+    { 8, 11, 10, 1, 24, 22, 19344 }, // ⁹
+    { 16, 17, 24, 4, 17, 68, 19366 }, // ⁿ
+    { 11, 15, 13, 1, 15, 42, 19434 }, // ₀
+    { 7, 12, 9, 1, 7, 21, 19476 }, // ₁
+    { 8, 12, 10, 1, 7, 24, 19497 }, // ₂
+    { 8, 11, 9, 1, 6, 22, 19521 }, // ₃
+    { 8, 11, 10, 1, 6, 22, 19543 }, // ₄
+    { 7, 12, 9, 1, 7, 21, 19565 }, // ₅
+    { 8, 12, 10, 1, 7, 24, 19586 }, // ₆
+    { 8, 12, 10, 1, 7, 24, 19610 }, // ₇
+    { 9, 11, 10, 0, 6, 25, 19634 }, // ₈
+    { 8, 11, 10, 1, 6, 22, 19659 }, // ₉
+    { 10, 39, 13, 2, 29, 98, 19681 }, // ₍
+    { 9, 39, 13, 1, 29, 88, 19779 }, // ₎
+    { 20, 37, 29, 4, 31, 185, 19867 }, // ₡
+    { 20, 27, 29, 4, 26, 135, 20052 }, // ₢
+    { 18, 28, 20, 1, 28, 126, 20187 }, // ₤
+    { 28, 25, 31, 2, 25, 175, 20313 }, // ₦
+    { 23, 25, 27, 1, 25, 144, 20488 }, // ₧
+    { 29, 24, 33, 4, 24, 174, 20632 }, // ₨
+    { 22, 24, 25, 1, 24, 132, 20806 }, // ₩
+    { 23, 23, 31, 4, 23, 133, 20938 }, // ₪
+    { 19, 23, 20, 2, 23, 110, 21071 }, // ₫
+    { 18, 26, 22, 2, 23, 117, 21181 }, // €
+    { 21, 25, 31, 5, 25, 132, 21298 }, // ₮
+    { 26, 25, 19, 0, 25, 163, 21430 }, // ₱
+    { 23, 34, 33, 5, 30, 196, 21593 }, // ₲
+    { 26, 27, 27, 2, 26, 176, 21789 }, // ₴
+    { 14, 22, 22, 4, 20, 77, 21965 }, // ₵
+    { 21, 26, 31, 5, 26, 137, 22042 }, // ₸
+    { 14, 22, 18, 2, 22, 77, 22179 }, // ₹
+    { 16, 21, 20, 2, 20, 84, 22256 }, // ₺
+    { 18, 23, 18, 0, 23, 104, 22340 }, // ₼
+    { 23, 25, 27, -1, 25, 144, 22444 }, // ₽
+    { 18, 18, 22, 2, 16, 81, 22588 }, // ←
+    { 18, 18, 22, 2, 18, 81, 22669 }, // ↑
+    { 18, 18, 22, 2, 16, 81, 22750 }, // →
+    { 18, 18, 22, 2, 18, 81, 22831 }, // ↓
+    { 22, 16, 26, 2, 16, 88, 22912 }, // ↔
+    { 15, 23, 19, 2, 23, 87, 23000 }, // ↕
+    { 15, 14, 19, 2, 15, 53, 23087 }, // ↖
+    { 15, 14, 19, 2, 15, 53, 23140 }, // ↗
+    { 15, 15, 19, 2, 16, 57, 23193 }, // ↘
+    { 15, 15, 19, 2, 16, 57, 23250 }, // ↙
+    { 21, 19, 25, 2, 18, 100, 23307 }, // ⇐
+    { 23, 21, 27, 2, 21, 121, 23407 }, // ⇑
+    { 21, 19, 25, 2, 18, 100, 23528 }, // ⇒
+    { 23, 22, 27, 2, 21, 127, 23628 }, // ⇓
+    { 24, 19, 28, 2, 18, 114, 23755 }, // ⇔
+    { 19, 24, 23, 2, 16, 114, 0 }, // ⇕
+    { 16, 23, 20, 2, 23, 92, 114 }, // ∂
+    { 29, 28, 33, 2, 26, 203, 206 }, // ∅
+    { 21, 22, 25, 2, 22, 116, 409 }, // ∆
+    { 18, 21, 22, 2, 21, 95, 525 }, // ∏
+    { 18, 21, 22, 2, 21, 95, 620 }, // ∐
+    { 14, 22, 17, 2, 21, 77, 715 }, // ∑
+    { 14, 4, 18, 2, 10, 14, 792 }, // −
+    { 23, 25, 27, 2, 23, 144, 806 }, // √
+    { 23, 15, 27, 2, 18, 87, 950 }, // ∞
+    { 24, 33, 25, 1, 26, 198, 1037 }, // ∫
+    { 6, 18, 8, 1, 18, 27, 1235 }, // ∶
+    { 17, 15, 23, 3, 16, 64, 1262 }, // ≈
+    { 19, 24, 32, 7, 22, 114, 1326 }, // ≠
+    { 21, 22, 25, 2, 20, 116, 1440 }, // ≤
+    { 21, 22, 25, 2, 20, 116, 1556 }, // ≥
+    { 21, 24, 29, 4, 24, 126, 1672 }, // ﬀ
+    { 18, 26, 25, 4, 26, 117, 1798 }, // ﬁ
+    { 21, 24, 29, 4, 24, 126, 1915 }, // ﬂ
+    { 28, 26, 37, 4, 26, 182, 2041 }, // ﬃ
+    { 32, 24, 40, 4, 24, 192, 2223 }, // ﬄ
+    { 28, 21, 36, 4, 21, 147, 2415 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_14_regularIntervals[] = {
@@ -2749,30 +2734,90 @@ static const EpdUnicodeInterval opendyslexic_14_regularIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_14_regularGroups[] = {
-    { 0, 4632, 8702, 95, 0 },
-    { 4632, 4192, 10718, 96, 95 },
-    { 8824, 6369, 17416, 126, 191 },
-    { 15193, 752, 1133, 61, 317 },
-    { 15945, 10410, 23934, 213, 378 },
-    { 26355, 1368, 2742, 63, 591 },
-    { 27723, 484, 664, 20, 654 },
-    { 28207, 1482, 2721, 20, 674 },
-    { 29689, 759, 1395, 16, 694 },
-    { 30448, 789, 1558, 15, 710 },
+    { 0, 6194, 15128, 151, 0 },
+    { 6194, 3422, 6466, 66, 379 },
+    { 9616, 8991, 23848, 241, 96 },
+    { 18607, 11090, 23869, 251, 386 },
+    { 29697, 1204, 2562, 22, 709 },
+};
+
+static const uint8_t opendyslexic_14_regularGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2,
+    2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const uint16_t opendyslexic_14_regularGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_14_regular = {
     opendyslexic_14_regularBitmaps,
     opendyslexic_14_regularGlyphs,
     opendyslexic_14_regularIntervals,
-    56,
+    58,
     53,
     38,
     -16,
     true,
     opendyslexic_14_regularGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    nullptr,
+    0,
+    0,
+    opendyslexic_14_regularGlyphLookup,
+    opendyslexic_14_regularGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,1052 +3,1035 @@
  * name: opendyslexic_8_bold
  * size: 8
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_8_bold 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_8_bold 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_boldBitmaps[16636] = {
-    0x4D, 0x57, 0x3D, 0x8C, 0x14, 0xC9, 0x15, 0x7E, 0xDD, 0xC5, 0x6E, 0xCB, 0xB4, 0x44, 0x11, 0x70,
-    0xF2, 0xE9, 0x38, 0xBB, 0x1C, 0x38, 0xF1, 0x19, 0x6F, 0x3B, 0xB8, 0x00, 0x59, 0x33, 0x53, 0x6D,
-    0x08, 0x90, 0x8C, 0xAD, 0x25, 0x00, 0x59, 0x96, 0x2D, 0x9D, 0x03, 0x07, 0xB6, 0xA5, 0xD3, 0x26,
-    0x04, 0x17, 0xCC, 0x4C, 0xB7, 0x41, 0xF6, 0x05, 0x0E, 0x6E, 0x1D, 0x5C, 0xE2, 0x0B, 0x20, 0xC0,
-    0x92, 0x0F, 0x02, 0x4E, 0x32, 0xB2, 0x08, 0x66, 0x77, 0x0A, 0x26, 0xD8, 0xC0, 0x01, 0x0D, 0x7B,
-    0x32, 0x01, 0xC1, 0x36, 0x3F, 0x27, 0x24, 0x13, 0x6C, 0x2D, 0x34, 0x47, 0xB3, 0x5B, 0xDD, 0xCF,
-    0x5F, 0xF5, 0xEC, 0xD9, 0x37, 0x53, 0xFD, 0x53, 0x3D, 0xD5, 0xAF, 0xAA, 0xBE, 0xF7, 0xBD, 0xEF,
-    0xBD, 0x21, 0x41, 0xB6, 0x27, 0xC5, 0x2D, 0x3B, 0x54, 0xF1, 0x6D, 0x3B, 0x8C, 0xC8, 0x7F, 0xE4,
-    0xEC, 0x65, 0x3B, 0xFD, 0xEB, 0xEA, 0x3B, 0x7F, 0xBA, 0xC2, 0x6A, 0xB3, 0xCA, 0xE4, 0x5D, 0xA7,
-    0x4F, 0xD9, 0x36, 0x31, 0x14, 0x5F, 0x28, 0x89, 0x06, 0x32, 0x27, 0xAA, 0xFA, 0x44, 0xA2, 0xA8,
-    0x48, 0x32, 0x73, 0x95, 0xE1, 0x64, 0x7E, 0xFE, 0x72, 0xED, 0x2C, 0xC9, 0xDB, 0x96, 0x48, 0x4B,
-    0x43, 0xFE, 0xD1, 0x0C, 0x47, 0xB3, 0xB0, 0xF2, 0xC9, 0x17, 0x67, 0x68, 0x5D, 0xE5, 0x14, 0x56,
-    0x6B, 0x44, 0x07, 0xFF, 0x72, 0x85, 0xE6, 0x1F, 0x89, 0xA3, 0x47, 0xB4, 0xF8, 0x3A, 0x0D, 0x98,
-    0x61, 0xC7, 0xD2, 0xFA, 0x90, 0xC2, 0x97, 0x96, 0xE2, 0x3D, 0x83, 0xEE, 0x2A, 0x8E, 0x9A, 0x42,
-    0x1C, 0xD1, 0x25, 0x7B, 0xE8, 0xDB, 0xCA, 0x70, 0xCB, 0x31, 0xB3, 0x5D, 0xE4, 0xD7, 0x44, 0x4B,
-    0x78, 0xF7, 0x26, 0x51, 0x50, 0xE0, 0xBA, 0x98, 0x12, 0xD9, 0x24, 0x5F, 0x8A, 0xBF, 0x25, 0x4C,
-    0x59, 0x56, 0xF1, 0x21, 0x45, 0xD9, 0x66, 0x11, 0x56, 0x13, 0x22, 0x95, 0xE4, 0xE2, 0xE9, 0xCF,
-    0x68, 0xF8, 0x59, 0x29, 0xFF, 0x7C, 0x28, 0xB4, 0x59, 0x31, 0x0A, 0xEA, 0x83, 0x58, 0xBC, 0x7A,
-    0x42, 0xA3, 0x11, 0x7D, 0x26, 0x7D, 0x9B, 0x24, 0xA4, 0x1D, 0xC9, 0x92, 0xB4, 0x3D, 0x32, 0x99,
-    0xF4, 0x9D, 0x5A, 0x6B, 0x22, 0x37, 0xE5, 0x5A, 0xB3, 0x8B, 0x5F, 0x93, 0x9E, 0xD5, 0xFA, 0x64,
-    0xA5, 0x4F, 0x5C, 0x26, 0x1B, 0x9B, 0xA1, 0x28, 0x15, 0x39, 0x51, 0x28, 0x9A, 0x84, 0x56, 0xE6,
-    0x03, 0xDC, 0xE3, 0xA9, 0x4A, 0x71, 0x13, 0xD6, 0xB8, 0x2D, 0xA5, 0x79, 0x2B, 0xED, 0x53, 0x42,
-    0x32, 0x8F, 0x8C, 0x28, 0x43, 0x4B, 0x15, 0xD5, 0x34, 0xC1, 0x77, 0x88, 0xAF, 0xBF, 0x3A, 0xAA,
-    0x83, 0x4A, 0x58, 0x8C, 0x2D, 0x94, 0xD1, 0xE9, 0xEF, 0xE7, 0x38, 0xBC, 0xB9, 0x33, 0xE3, 0xE6,
-    0x68, 0x4B, 0x59, 0xA5, 0xF9, 0xE1, 0x83, 0x5F, 0xD1, 0x0D, 0xFF, 0xF8, 0x30, 0xC5, 0x39, 0xF6,
-    0x18, 0xE7, 0x9A, 0x37, 0xB9, 0x81, 0x9D, 0xAE, 0x1B, 0xD0, 0x3B, 0x17, 0x9D, 0xBE, 0x08, 0x9F,
-    0x94, 0x53, 0xDE, 0x66, 0xFB, 0xBD, 0x41, 0x36, 0xED, 0xD0, 0x3C, 0x06, 0x97, 0x00, 0x07, 0x0A,
-    0x2C, 0x85, 0x25, 0x3C, 0x43, 0x02, 0xDE, 0x02, 0x8E, 0x39, 0xC9, 0x94, 0x54, 0x87, 0x18, 0x3C,
-    0x36, 0x24, 0x2C, 0x02, 0xB6, 0x30, 0x16, 0xAB, 0x13, 0x68, 0x25, 0x45, 0xC5, 0xFE, 0x40, 0x95,
-    0x62, 0xE9, 0x34, 0x20, 0x7A, 0x97, 0x08, 0x98, 0x86, 0x35, 0xED, 0x56, 0x4B, 0xD1, 0xAC, 0xE8,
-    0x0D, 0x5F, 0xDC, 0xBF, 0x33, 0x9E, 0xBC, 0x7A, 0x76, 0x67, 0x30, 0x8A, 0x9E, 0xDA, 0x46, 0xF3,
-    0x6D, 0x76, 0x92, 0x29, 0xC9, 0x83, 0xD5, 0xA8, 0x16, 0x2D, 0x6D, 0xE5, 0x30, 0x53, 0xE3, 0x4D,
-    0xD9, 0xDD, 0x44, 0xFC, 0x9C, 0x9B, 0x29, 0xA7, 0x47, 0x6B, 0xC1, 0x76, 0xBC, 0x62, 0x30, 0x25,
-    0x26, 0x70, 0x18, 0x1F, 0xDB, 0xA8, 0x09, 0x18, 0x3B, 0xDA, 0xE0, 0x26, 0xE3, 0xC2, 0x0F, 0xA8,
-    0x0E, 0x47, 0x06, 0x34, 0x88, 0x4C, 0x56, 0xC5, 0x9C, 0x06, 0x8E, 0xA2, 0x7B, 0x1F, 0x37, 0x7E,
-    0x40, 0x9D, 0x34, 0x1E, 0x1B, 0xAC, 0x71, 0x4A, 0xCA, 0x8A, 0x2D, 0xBA, 0x51, 0x29, 0x79, 0xF2,
-    0x3F, 0xED, 0x94, 0xBF, 0xBC, 0xC6, 0xA4, 0xF2, 0xA0, 0x86, 0x41, 0xBF, 0x73, 0xD8, 0xD0, 0x7C,
-    0xD2, 0x1B, 0xC1, 0x96, 0x35, 0x66, 0xAF, 0x8E, 0x28, 0xCC, 0xF9, 0x5D, 0x35, 0x63, 0x97, 0xF1,
-    0x29, 0x2E, 0x82, 0x94, 0x02, 0x36, 0xEC, 0x92, 0x73, 0x18, 0x35, 0x6A, 0x22, 0xAE, 0xA7, 0xEF,
-    0xFD, 0xAB, 0x18, 0xAC, 0x89, 0xA7, 0xE5, 0x40, 0x6F, 0xDF, 0x65, 0x17, 0xB5, 0x30, 0x13, 0x33,
-    0xBC, 0xEE, 0x97, 0x29, 0xF3, 0xA0, 0xA2, 0x24, 0xC5, 0xC4, 0x19, 0xC5, 0x96, 0x5A, 0x70, 0x23,
-    0x68, 0x28, 0xF8, 0x3B, 0xE9, 0x26, 0xB4, 0x13, 0x99, 0x56, 0x3A, 0x36, 0x99, 0x77, 0x96, 0xFC,
-    0x77, 0x35, 0x12, 0xCF, 0xAD, 0xDC, 0x28, 0x33, 0x50, 0x35, 0x61, 0x13, 0x3F, 0xA1, 0xA8, 0x0E,
-    0xB9, 0xEA, 0xC5, 0x1B, 0x69, 0xFF, 0x86, 0xB8, 0x9F, 0x0F, 0x06, 0x2B, 0x8F, 0xB8, 0x5D, 0xE4,
-    0x92, 0xFA, 0x83, 0xEB, 0x33, 0x70, 0xAA, 0xE9, 0x1C, 0xBE, 0xB1, 0xE3, 0x3A, 0xA7, 0x69, 0xB5,
-    0xF1, 0xDC, 0x51, 0x50, 0x27, 0x70, 0xA9, 0xF1, 0x0F, 0x16, 0x4E, 0xB8, 0xE4, 0x76, 0x8D, 0x58,
-    0x7B, 0xC3, 0xF7, 0xB0, 0xEC, 0x1A, 0x2B, 0xCF, 0x43, 0x2E, 0x42, 0x5E, 0xC5, 0x0D, 0xA9, 0x16,
-    0x7D, 0x44, 0xC6, 0x0A, 0x17, 0x74, 0xB4, 0x99, 0xF3, 0x3F, 0x64, 0xA7, 0xD9, 0xBF, 0x7D, 0xEE,
-    0x04, 0xEE, 0xDA, 0xFC, 0x08, 0x1E, 0x81, 0x09, 0x49, 0xBD, 0x7F, 0x34, 0xDD, 0x35, 0xE2, 0x74,
-    0xC5, 0x73, 0x7A, 0x55, 0xB4, 0x29, 0x1D, 0x9F, 0x07, 0x60, 0x5C, 0x05, 0xF0, 0xE3, 0xDD, 0xFA,
-    0x4D, 0x70, 0x06, 0x84, 0x01, 0x4F, 0x86, 0x1D, 0xDC, 0xA9, 0xAC, 0x48, 0xA7, 0x40, 0x02, 0x9D,
-    0x6F, 0xEC, 0x07, 0x6B, 0xB8, 0xEA, 0x19, 0x92, 0x51, 0xE8, 0xD0, 0xF9, 0x0D, 0x22, 0x08, 0xAB,
-    0x59, 0x0B, 0x4B, 0x50, 0xED, 0x5D, 0x31, 0x73, 0xC7, 0xE2, 0x9F, 0x1C, 0x7B, 0x5B, 0xFE, 0xF4,
-    0xED, 0xB7, 0xE5, 0x47, 0xEE, 0xB8, 0x9C, 0x6D, 0x23, 0x14, 0x16, 0x53, 0xD1, 0x04, 0x3E, 0xB2,
-    0xBD, 0x14, 0x18, 0x5A, 0x6C, 0xF3, 0x79, 0xD0, 0xA7, 0x9D, 0x09, 0x5D, 0x90, 0x07, 0x7D, 0xD7,
-    0x92, 0x5A, 0x4E, 0x43, 0xEB, 0x48, 0xC7, 0x45, 0x54, 0x8E, 0x09, 0xF1, 0xAD, 0x98, 0x2F, 0x30,
-    0x76, 0x92, 0xCA, 0xFB, 0x00, 0xDF, 0x03, 0xCD, 0x66, 0x1C, 0xD9, 0x51, 0xE0, 0xDB, 0xF8, 0x97,
-    0x25, 0xBA, 0x19, 0x57, 0xA3, 0xC0, 0x8D, 0xC8, 0x65, 0xD7, 0xE0, 0x61, 0x34, 0x08, 0xD0, 0xAA,
-    0xB7, 0x9E, 0xB4, 0x01, 0xB7, 0x11, 0x37, 0xB2, 0x3A, 0x00, 0x0A, 0x60, 0x0F, 0x68, 0x19, 0x5A,
-    0x4E, 0xBA, 0x5C, 0xD0, 0xDC, 0x28, 0x6E, 0x62, 0x06, 0x03, 0x9B, 0xAC, 0xCD, 0x95, 0x1F, 0xC9,
-    0x0F, 0xEB, 0xD0, 0x8D, 0x29, 0x79, 0x0F, 0x3A, 0x51, 0xD2, 0xEB, 0x9A, 0xF4, 0x98, 0xE4, 0xA5,
-    0x7C, 0xE5, 0x29, 0xF3, 0x4B, 0xF6, 0x96, 0x9D, 0x82, 0x00, 0x7D, 0x9F, 0x2D, 0xC4, 0x6C, 0xF7,
-    0x1C, 0x64, 0x4D, 0x13, 0x35, 0xBF, 0x05, 0xE3, 0x24, 0x1B, 0xDC, 0x02, 0xA2, 0xDD, 0xAB, 0xD2,
-    0x8F, 0xC3, 0xE8, 0x52, 0xF1, 0x3D, 0x6E, 0x92, 0x8F, 0x4F, 0x58, 0x8C, 0x12, 0x1E, 0xEC, 0x8B,
-    0x60, 0xA6, 0x07, 0x71, 0xFF, 0x14, 0x41, 0x1A, 0xDF, 0xFA, 0x14, 0x44, 0x6B, 0xB0, 0xCF, 0x1A,
-    0xE2, 0x72, 0xC6, 0x7B, 0x1D, 0xFE, 0xC1, 0xAF, 0xA4, 0xCC, 0x8F, 0xCE, 0x64, 0xC4, 0xB6, 0x09,
-    0xA6, 0x9B, 0x8E, 0xC6, 0x71, 0x7B, 0x0D, 0x73, 0x70, 0x81, 0x23, 0x5D, 0xC4, 0xE6, 0x34, 0x25,
-    0xD2, 0xC4, 0x9B, 0x36, 0xAC, 0x1C, 0xAD, 0x69, 0xD2, 0xCB, 0x46, 0x6E, 0x5A, 0x51, 0xB5, 0x57,
-    0x5B, 0xCD, 0xFC, 0x11, 0xF3, 0x63, 0x58, 0x6C, 0x00, 0x57, 0xAA, 0x2F, 0x15, 0xD2, 0x6A, 0x39,
-    0xB3, 0xEE, 0x6B, 0x27, 0x55, 0x78, 0x4E, 0xC8, 0x82, 0xE6, 0x6B, 0xB6, 0x84, 0x9D, 0x8C, 0x3D,
-    0xBB, 0xA2, 0x12, 0x4C, 0xA7, 0xB5, 0xF9, 0xA3, 0x33, 0x19, 0x56, 0x2D, 0xB9, 0x00, 0x4B, 0x17,
-    0x52, 0xE4, 0x80, 0x5A, 0xEC, 0x40, 0xAF, 0x1A, 0x1A, 0x64, 0xA4, 0xA6, 0x60, 0x50, 0x8E, 0x28,
-    0xA2, 0x69, 0xE1, 0xE9, 0x24, 0x39, 0x17, 0xEC, 0xC8, 0x01, 0x05, 0xE9, 0xD4, 0x2D, 0x2E, 0x12,
-    0x2F, 0x2C, 0x90, 0x94, 0xD8, 0x7C, 0x7D, 0x8E, 0xFD, 0xDB, 0x37, 0x24, 0x23, 0xA4, 0x01, 0x51,
-    0xA1, 0x4D, 0x64, 0x39, 0xD5, 0xB3, 0x96, 0x58, 0xBA, 0xB8, 0xD1, 0xB5, 0xAE, 0x78, 0x07, 0xFA,
-    0xB6, 0xC5, 0xCB, 0xDB, 0xBC, 0xA6, 0xF5, 0x6E, 0xE5, 0x78, 0xEB, 0xF1, 0x0E, 0xEB, 0x8F, 0x66,
-    0x75, 0x9B, 0xC9, 0xCD, 0xD7, 0xCD, 0x82, 0x2C, 0x17, 0x52, 0xF9, 0xA1, 0x15, 0x77, 0xDB, 0xA0,
-    0xCA, 0xCC, 0x28, 0xA9, 0xD5, 0x69, 0x8E, 0xEE, 0xED, 0x3D, 0xB2, 0xED, 0x64, 0xA2, 0x2F, 0x5D,
-    0x97, 0x8F, 0x79, 0x56, 0x67, 0xB6, 0x95, 0x4E, 0xDF, 0x66, 0x65, 0x81, 0xE8, 0xCA, 0x13, 0x40,
-    0x5C, 0x13, 0x7F, 0x52, 0x47, 0x40, 0xC8, 0xC3, 0x8E, 0x98, 0x9E, 0x41, 0xDF, 0x91, 0x82, 0x9C,
-    0x77, 0x05, 0xA7, 0x99, 0xCF, 0x4C, 0xF0, 0x3E, 0x24, 0x87, 0xF3, 0x45, 0x7E, 0xB2, 0x4F, 0x72,
-    0x9A, 0x22, 0x7A, 0x9B, 0xD8, 0x20, 0x25, 0x54, 0x2E, 0xDA, 0x64, 0x5E, 0xF6, 0xB1, 0x95, 0xB7,
-    0xAB, 0xFB, 0xBB, 0x49, 0xE1, 0xAC, 0xA8, 0xF2, 0x71, 0x9A, 0xFA, 0xB1, 0x80, 0x04, 0x79, 0xAB,
-    0xCC, 0xF2, 0x24, 0x97, 0x60, 0x43, 0x54, 0xC0, 0x38, 0x38, 0x2C, 0xEC, 0x00, 0x87, 0x0E, 0x44,
-    0xA9, 0x4F, 0x3E, 0x2B, 0x12, 0x44, 0x00, 0x9C, 0x98, 0xFB, 0xB1, 0x34, 0x45, 0xD4, 0x10, 0xD4,
-    0x00, 0x32, 0xE5, 0xA7, 0x43, 0x38, 0x43, 0x35, 0x96, 0xC2, 0x72, 0x29, 0xB0, 0x68, 0x03, 0xBC,
-    0x05, 0x88, 0x80, 0x29, 0xCE, 0x27, 0xAD, 0xCF, 0x3B, 0x27, 0x91, 0x7D, 0x5C, 0x76, 0xD1, 0xD1,
-    0x7C, 0x52, 0xC5, 0x06, 0xDC, 0xA3, 0xF5, 0xC0, 0x2F, 0x07, 0xD0, 0x12, 0x48, 0x44, 0x9A, 0x53,
-    0x18, 0x86, 0x35, 0x1F, 0xED, 0xE6, 0x66, 0x08, 0xCA, 0x82, 0x79, 0x6C, 0x0F, 0xCE, 0xF7, 0x85,
-    0x44, 0xBC, 0xC5, 0xFC, 0x0A, 0x6C, 0xF6, 0xD2, 0x0F, 0x6F, 0xC7, 0x1D, 0x19, 0x3C, 0xEF, 0xB0,
-    0x21, 0x70, 0x42, 0xEC, 0x77, 0x72, 0x9F, 0x04, 0xE7, 0x04, 0xF2, 0xD4, 0x72, 0xD4, 0xFC, 0x8F,
-    0x67, 0x40, 0x10, 0xC8, 0x69, 0x59, 0x40, 0x53, 0xD9, 0x22, 0x39, 0xAA, 0x2E, 0x8A, 0x3A, 0x0D,
-    0x23, 0xFF, 0xAB, 0xBA, 0x50, 0x53, 0xE3, 0xF3, 0x9A, 0x2C, 0x92, 0x3C, 0x31, 0x0D, 0x65, 0x5E,
-    0x39, 0x75, 0x1E, 0xB6, 0x40, 0x0C, 0x99, 0x1D, 0x7C, 0xE9, 0x94, 0x28, 0x03, 0xD3, 0x79, 0xAE,
-    0x04, 0x9E, 0x1C, 0x01, 0xC2, 0x1C, 0x79, 0x06, 0x53, 0x8B, 0x2A, 0x31, 0x47, 0x84, 0x55, 0x66,
-    0x2D, 0x82, 0x0D, 0x46, 0x2A, 0x7D, 0xC4, 0xCB, 0x45, 0xFC, 0x82, 0xEF, 0x98, 0x68, 0x8F, 0xB7,
-    0x4D, 0xC4, 0xCF, 0x3C, 0xE5, 0xEE, 0x73, 0x2A, 0x50, 0x56, 0x40, 0xF4, 0x2E, 0x30, 0xA4, 0x90,
-    0x7C, 0x22, 0x88, 0x0D, 0x58, 0x1A, 0x59, 0x44, 0xC8, 0xE9, 0x82, 0x1A, 0x07, 0xE7, 0x23, 0xEE,
-    0x4B, 0x0A, 0xFD, 0x9E, 0xBA, 0x99, 0xFD, 0x22, 0xB2, 0x65, 0x8B, 0xB0, 0x98, 0xB9, 0xB0, 0xD5,
-    0xA8, 0x51, 0xAA, 0xB0, 0xF6, 0x1E, 0x5B, 0x8F, 0x4B, 0xBF, 0xF8, 0xE4, 0x7A, 0x4E, 0x7E, 0x8D,
-    0x10, 0xA4, 0xCC, 0x90, 0xA8, 0x3B, 0x2C, 0xBE, 0xBA, 0x38, 0x5F, 0xE1, 0x14, 0x53, 0x46, 0xDA,
-    0x80, 0xE8, 0x02, 0x63, 0x01, 0xA8, 0x11, 0x07, 0xDE, 0x74, 0x83, 0x4E, 0xEE, 0xFD, 0xA9, 0xDB,
-    0xAB, 0xD1, 0xBC, 0x0C, 0xFA, 0x10, 0x38, 0x83, 0x8A, 0xB6, 0xF2, 0x55, 0xC2, 0x30, 0xB0, 0x91,
-    0xC1, 0x25, 0x44, 0x95, 0x90, 0x7C, 0x55, 0x33, 0xD4, 0xA2, 0x94, 0x79, 0x9F, 0x40, 0xFA, 0xE5,
-    0x0E, 0xC0, 0xEF, 0x20, 0xDD, 0x1E, 0x47, 0xF2, 0xFA, 0x01, 0xB2, 0xB4, 0x84, 0xC8, 0xC6, 0x46,
-    0x14, 0xBE, 0x76, 0x40, 0x12, 0xF2, 0x1E, 0x3B, 0x4F, 0x3F, 0xA4, 0xC3, 0xDA, 0x32, 0x0C, 0xEC,
-    0x9B, 0xEB, 0x11, 0x8C, 0x4B, 0xD4, 0x19, 0x95, 0xB7, 0xD4, 0x19, 0x8C, 0x73, 0x98, 0xCF, 0x76,
-    0x90, 0x35, 0xF7, 0x2B, 0x2B, 0x2C, 0x7B, 0xCF, 0xF6, 0x63, 0x9F, 0x16, 0xB0, 0x7C, 0x30, 0xB9,
-    0x3A, 0x77, 0xEE, 0xEC, 0x08, 0x31, 0x9F, 0x75, 0x03, 0xB2, 0x9B, 0x8A, 0x67, 0x85, 0x3B, 0x1E,
-    0x6D, 0xA4, 0xBD, 0xF3, 0x20, 0x7A, 0x93, 0x70, 0x39, 0x1D, 0x93, 0x2F, 0x1E, 0x90, 0x8D, 0x55,
-    0x57, 0x97, 0xED, 0xAC, 0x76, 0x32, 0x67, 0xF5, 0x89, 0xD2, 0x89, 0x99, 0x95, 0x3E, 0x2C, 0x18,
-    0xEA, 0x4B, 0x53, 0x4B, 0x47, 0xBA, 0x60, 0xF9, 0x31, 0x97, 0x0D, 0x46, 0x2A, 0x5F, 0x41, 0x34,
-    0xBF, 0x56, 0x1C, 0x4C, 0x73, 0x5F, 0x81, 0xCC, 0x2D, 0x0C, 0x61, 0x2C, 0x7E, 0x66, 0x98, 0xE5,
-    0x03, 0xD7, 0x8B, 0x76, 0x4A, 0xF5, 0x61, 0xB1, 0x2E, 0x3D, 0x71, 0xEC, 0xD1, 0x67, 0x06, 0xBE,
-    0x69, 0xEB, 0xC1, 0x37, 0x67, 0xDC, 0x8E, 0xFF, 0x76, 0x0A, 0xAA, 0xC4, 0x0F, 0xB9, 0x0D, 0xE1,
-    0x36, 0x30, 0x70, 0x7A, 0xB1, 0x90, 0x01, 0xE8, 0xBA, 0xF1, 0x45, 0xB7, 0xB7, 0xA8, 0x54, 0xF9,
-    0x98, 0x16, 0xBF, 0xDC, 0xE1, 0xB6, 0xAF, 0x9E, 0xE6, 0xEB, 0xE7, 0x23, 0x9C, 0xB4, 0x17, 0xDA,
-    0x98, 0x8B, 0x03, 0x3D, 0x8A, 0x6F, 0xEF, 0x41, 0x68, 0x43, 0xCE, 0xD5, 0xFF, 0x05, 0x08, 0x15,
-    0x4C, 0xDB, 0x08, 0x9F, 0xDA, 0xAA, 0x41, 0x50, 0xD6, 0xD1, 0xAC, 0x4C, 0x54, 0x3E, 0xC9, 0xA0,
-    0x66, 0xD2, 0x8C, 0xD6, 0xD6, 0x3F, 0xC5, 0xF6, 0xFC, 0x67, 0x38, 0x44, 0x0D, 0x78, 0x39, 0x02,
-    0xB0, 0xDD, 0x27, 0xA1, 0x9B, 0x21, 0x80, 0x5C, 0xA2, 0x1B, 0x61, 0x87, 0x2E, 0xA4, 0x84, 0x7D,
-    0xB0, 0xCF, 0x95, 0xAD, 0xF4, 0xE5, 0x17, 0x0C, 0x57, 0x57, 0xC4, 0x96, 0x91, 0xC8, 0x57, 0x86,
-    0x3C, 0x15, 0x53, 0xE4, 0xC1, 0xD1, 0xF4, 0x0F, 0xD5, 0xD4, 0x2C, 0x89, 0xA2, 0xEF, 0x9B, 0xE9,
-    0x45, 0x66, 0xE8, 0xDB, 0xE7, 0xD9, 0x46, 0xE7, 0x5F, 0xB5, 0x7E, 0x1A, 0x99, 0x61, 0x1B, 0x49,
-    0xBE, 0x1E, 0x25, 0x61, 0x35, 0xD0, 0xA1, 0x1D, 0x68, 0x44, 0xBA, 0x3F, 0xC6, 0x51, 0xA9, 0xC7,
-    0x31, 0x74, 0x83, 0xC4, 0x76, 0xA9, 0x79, 0x56, 0x8D, 0xFA, 0x62, 0xB3, 0x18, 0xF4, 0x91, 0x8C,
-    0xF4, 0x58, 0xBC, 0xB2, 0x3A, 0x44, 0x98, 0xD5, 0x83, 0xE8, 0xBE, 0x19, 0x0C, 0xC5, 0x8B, 0x97,
-    0xD8, 0xF8, 0x5D, 0xAE, 0x3D, 0xB1, 0x0F, 0x40, 0x91, 0x8D, 0xDC, 0x45, 0xA8, 0x1C, 0x97, 0xA6,
-    0xE7, 0x5B, 0xD1, 0x93, 0x2D, 0x22, 0xBF, 0x52, 0xD0, 0xE2, 0x05, 0x1F, 0x5B, 0x68, 0xF0, 0xE8,
-    0xEF, 0xE6, 0xD9, 0x7B, 0x17, 0x69, 0xB5, 0xEC, 0xC9, 0xF2, 0x83, 0xB8, 0x38, 0x1F, 0x15, 0xC3,
-    0x18, 0x12, 0x63, 0x7C, 0xC1, 0xC2, 0xB7, 0x08, 0xF5, 0x9B, 0x6F, 0xAF, 0x29, 0x4C, 0x93, 0x49,
-    0xD2, 0x24, 0x9F, 0x27, 0xD8, 0xB2, 0xEE, 0xBE, 0x48, 0x9D, 0xD8, 0x7F, 0x25, 0xAF, 0xC1, 0xAB,
-    0x50, 0x9A, 0x18, 0xC5, 0x59, 0xD9, 0x22, 0xE1, 0xDC, 0x9A, 0x96, 0x73, 0xCC, 0x3E, 0xE8, 0x6A,
-    0x3E, 0xCD, 0x48, 0x1A, 0x7D, 0xA4, 0x76, 0x14, 0x11, 0x15, 0x0D, 0x2E, 0x4B, 0x27, 0xBC, 0x2F,
-    0x3F, 0x10, 0xF7, 0x4D, 0x7F, 0x28, 0x36, 0xCD, 0xA0, 0x17, 0x3D, 0x2E, 0xB0, 0x76, 0x94, 0x42,
-    0xF1, 0x5E, 0xD9, 0xA7, 0x01, 0xA8, 0xAC, 0xD2, 0x1A, 0x7F, 0x15, 0xA2, 0xC7, 0xA5, 0xD8, 0x33,
-    0x3E, 0xAD, 0x78, 0x0D, 0x4B, 0x47, 0x24, 0x5E, 0x94, 0x34, 0xD0, 0x71, 0x74, 0x6F, 0xC7, 0x4D,
-    0x54, 0xB6, 0x05, 0xFA, 0xD4, 0x3E, 0x03, 0x4E, 0xD9, 0x8A, 0xBA, 0xF5, 0x45, 0x42, 0x47, 0x6F,
-    0xE3, 0xC4, 0x23, 0x1B, 0x20, 0x1C, 0xA7, 0xBE, 0x24, 0xC1, 0xEB, 0x62, 0xCF, 0xCA, 0x4D, 0xC8,
-    0x48, 0xD3, 0xA7, 0x7A, 0x22, 0x8A, 0x5A, 0x85, 0x55, 0x2D, 0x5E, 0x14, 0x31, 0xE4, 0x19, 0x55,
-    0xE2, 0x7E, 0xDA, 0x8B, 0x7D, 0x3F, 0x81, 0x7A, 0xFA, 0x98, 0xB0, 0xBE, 0x66, 0x6A, 0x60, 0x0A,
-    0x15, 0x67, 0x62, 0x44, 0x7B, 0x56, 0xFA, 0xF0, 0xF5, 0xC5, 0xCF, 0x14, 0xEE, 0x90, 0xA6, 0x2B,
-    0x68, 0x51, 0x8F, 0x40, 0x03, 0xA0, 0x64, 0x23, 0xD4, 0xC6, 0x51, 0x81, 0x88, 0xCC, 0x4A, 0x18,
-    0xFC, 0x05, 0x85, 0xCF, 0xDE, 0xFF, 0xE7, 0x83, 0xF7, 0x5F, 0x6D, 0xF5, 0x5E, 0xDC, 0xE9, 0xE9,
-    0x1C, 0x74, 0x48, 0xA8, 0xFB, 0x79, 0xE4, 0x2B, 0x60, 0x54, 0x2C, 0xB9, 0x2E, 0x60, 0xC2, 0x62,
-    0x52, 0x0D, 0xB9, 0xCB, 0xCC, 0x41, 0x48, 0xF7, 0xB1, 0xF6, 0x1F, 0x97, 0xFE, 0x78, 0xE4, 0xBF,
-    0xA5, 0x57, 0x4D, 0x6C, 0xD4, 0xE8, 0x19, 0x7E, 0xED, 0x8F, 0xC4, 0x2A, 0xAE, 0xF8, 0xF6, 0xC0,
-    0xB6, 0x74, 0x7F, 0x64, 0x0E, 0x54, 0xEA, 0xF2, 0x33, 0xEE, 0x61, 0x0F, 0x51, 0x35, 0x33, 0x9F,
-    0xE9, 0x4A, 0x45, 0xDA, 0x95, 0x9A, 0x1C, 0xE8, 0xA5, 0x3D, 0x2C, 0x87, 0x1E, 0x50, 0xB5, 0x2A,
-    0x1C, 0x72, 0xA0, 0xD2, 0xCC, 0xD8, 0x10, 0xED, 0x09, 0x69, 0xC9, 0x65, 0x4F, 0xAD, 0x5A, 0x5A,
-    0x41, 0xC5, 0x22, 0xA4, 0x70, 0xC8, 0x21, 0x95, 0x48, 0xC6, 0x64, 0x0E, 0x39, 0xF4, 0x80, 0xD9,
-    0x48, 0xCD, 0xA5, 0xD2, 0x3A, 0x64, 0xB5, 0x69, 0xB7, 0x2B, 0x61, 0x88, 0x59, 0x0C, 0xD8, 0x7E,
-    0xFB, 0x7C, 0x76, 0x06, 0xC2, 0xEF, 0x4A, 0xE0, 0x19, 0xCF, 0x8C, 0x3D, 0x9F, 0xDF, 0xDF, 0xE7,
-    0x7D, 0xDE, 0xF7, 0xDB, 0x3B, 0x95, 0xAB, 0xC5, 0xDC, 0x0D, 0xA8, 0x3A, 0xF6, 0xC8, 0x83, 0xA9,
-    0xF4, 0xF0, 0xCE, 0x64, 0x30, 0x67, 0x07, 0xB3, 0xA3, 0xB8, 0x77, 0x9C, 0xDE, 0x22, 0x9B, 0xEC,
-    0xD4, 0x29, 0xE5, 0x25, 0xEB, 0x9F, 0xC6, 0xED, 0xB0, 0x7B, 0x59, 0x16, 0x26, 0xC7, 0x4E, 0x46,
-    0x31, 0x8D, 0xD1, 0x88, 0x7E, 0xCE, 0x58, 0x20, 0x9B, 0x23, 0x69, 0x4C, 0x4B, 0x22, 0xBC, 0xAD,
-    0x80, 0x7C, 0x0E, 0xF1, 0x36, 0x63, 0x32, 0x13, 0x72, 0x62, 0x52, 0x3C, 0xAD, 0x38, 0xDD, 0x7B,
-    0xF1, 0x9C, 0x56, 0x62, 0x9B, 0xCC, 0x16, 0xA7, 0xF2, 0x74, 0xD8, 0x76, 0x3C, 0xCE, 0x25, 0xE7,
-    0x8A, 0x93, 0xDD, 0x26, 0xB5, 0x49, 0xD9, 0xB1, 0xA2, 0x52, 0x79, 0x92, 0x03, 0x93, 0x43, 0x52,
-    0x21, 0x59, 0x4C, 0x2E, 0x87, 0x92, 0x89, 0x9C, 0xC7, 0x2E, 0x02, 0xB2, 0x62, 0xAD, 0x79, 0xFF,
-    0xC6, 0xB5, 0xA6, 0x47, 0x3F, 0x59, 0xFB, 0x64, 0x6C, 0x95, 0x44, 0x26, 0xF8, 0x6A, 0x74, 0xA4,
-    0xE7, 0xC9, 0xC2, 0xBE, 0x39, 0x08, 0x53, 0x2E, 0x5C, 0x36, 0x20, 0x29, 0x8D, 0x5B, 0x7D, 0xB6,
-    0x4B, 0x7A, 0xE7, 0x0D, 0x79, 0x7A, 0x69, 0xE3, 0xDB, 0xBC, 0x70, 0xA2, 0x3F, 0xCC, 0x7E, 0xFB,
-    0xD1, 0xBF, 0xDF, 0x7A, 0xF0, 0x51, 0x6F, 0x56, 0x46, 0x44, 0xF9, 0x9E, 0xE5, 0xEF, 0xFD, 0x6C,
-    0xF5, 0x3E, 0xC4, 0xED, 0xDE, 0xBD, 0x7F, 0xAC, 0xDD, 0x6D, 0x77, 0xDD, 0xB6, 0xF5, 0x20, 0xEE,
-    0xCD, 0x5B, 0xA7, 0xBD, 0x09, 0x4F, 0x7D, 0xF6, 0x1E, 0xE7, 0x3F, 0x98, 0x09, 0xA9, 0x43, 0x56,
-    0x44, 0x47, 0x15, 0x0F, 0x38, 0x77, 0x22, 0x3F, 0xFD, 0xCF, 0xA5, 0x2F, 0xFE, 0x94, 0x7F, 0xD3,
-    0x4B, 0x1D, 0x48, 0x70, 0x8B, 0xBD, 0xE7, 0x61, 0x15, 0xEE, 0x66, 0x9D, 0xB4, 0x59, 0xE6, 0xBE,
-    0xBE, 0xFB, 0x5B, 0xB2, 0x03, 0x9A, 0x13, 0x5C, 0xEC, 0x2D, 0xA7, 0xF5, 0x2F, 0xC8, 0x77, 0xF5,
-    0xC3, 0xF8, 0x6E, 0x6C, 0x8B, 0xDE, 0xDD, 0x7F, 0x40, 0xAE, 0x4E, 0x34, 0xE8, 0xC8, 0xAE, 0xAE,
-    0x79, 0x6D, 0x75, 0x7A, 0x44, 0x9C, 0x8A, 0x92, 0x06, 0xA5, 0xB9, 0x58, 0x4E, 0xE4, 0x78, 0xD8,
-    0x56, 0x46, 0x56, 0xD8, 0x6B, 0xCC, 0x67, 0xB8, 0x6C, 0x97, 0x59, 0x42, 0x02, 0x29, 0xB2, 0x37,
-    0x16, 0xB9, 0xA9, 0x36, 0x56, 0xCA, 0x96, 0x5A, 0xBB, 0x5E, 0xB6, 0xAC, 0xB5, 0x68, 0xBE, 0x25,
-    0x97, 0xA3, 0xA2, 0x25, 0x07, 0xD7, 0xF3, 0x03, 0xEE, 0xE2, 0x72, 0x7E, 0xE0, 0x75, 0xCF, 0x6B,
-    0xF7, 0xFC, 0xDF, 0x6D, 0xB3, 0x45, 0xF2, 0x67, 0xF5, 0xBE, 0xB7, 0x4B, 0x52, 0xF8, 0xD3, 0xEF,
-    0x3B, 0xD7, 0x27, 0x88, 0xB2, 0xB1, 0xB5, 0xF7, 0x55, 0x9C, 0x21, 0x59, 0x23, 0x34, 0x36, 0x29,
-    0xEE, 0xC6, 0xF6, 0x17, 0x41, 0xBB, 0x2B, 0x6F, 0x0E, 0xEE, 0x26, 0xFB, 0x9B, 0x86, 0x49, 0x3A,
-    0xD7, 0xAE, 0x67, 0x46, 0xFB, 0x3C, 0x2B, 0xB4, 0x3C, 0xE9, 0xD9, 0x5E, 0x83, 0x6C, 0xAF, 0x89,
-    0x73, 0x8E, 0xD4, 0xAD, 0xE4, 0xB2, 0xDA, 0x58, 0x4D, 0xC9, 0x1A, 0xCC, 0x92, 0xFC, 0xE5, 0x24,
-    0xB9, 0x8D, 0x7F, 0x50, 0x57, 0x15, 0x94, 0xD3, 0x09, 0x23, 0xA5, 0x39, 0x03, 0xF2, 0x0D, 0x8D,
-    0x83, 0x14, 0x78, 0xD8, 0xE7, 0x89, 0x88, 0x26, 0xE9, 0x04, 0x41, 0x0A, 0xD1, 0x2C, 0x30, 0xA0,
-    0xC5, 0x50, 0x5F, 0x7E, 0xEC, 0xA9, 0x5B, 0xB7, 0xD9, 0xA3, 0xD6, 0xCE, 0x31, 0xB2, 0x43, 0x11,
-    0x52, 0x8A, 0x90, 0x2A, 0x72, 0xC9, 0x0A, 0x91, 0x85, 0x0C, 0x19, 0x77, 0xC9, 0xCD, 0x2B, 0x20,
-    0x02, 0x32, 0xF4, 0xE3, 0x59, 0x33, 0xA2, 0x31, 0x2B, 0x1C, 0xB9, 0x2C, 0x3D, 0x99, 0x36, 0x88,
-    0x3A, 0x4D, 0x72, 0xB3, 0xF4, 0xB2, 0xBA, 0x7D, 0x2B, 0x25, 0xB1, 0x0C, 0x43, 0x3E, 0x99, 0x24,
-    0xA7, 0x31, 0x47, 0x6D, 0x18, 0x72, 0xE5, 0x91, 0x21, 0x54, 0x92, 0x99, 0x92, 0x1D, 0xD1, 0x1B,
-    0x35, 0xA8, 0xC9, 0x08, 0xA0, 0x05, 0xA6, 0x8A, 0x84, 0xFC, 0xD0, 0xBA, 0xA7, 0x2F, 0xE0, 0x49,
-    0x48, 0x0E, 0x51, 0x8B, 0xBC, 0xC2, 0x0E, 0xB9, 0xA4, 0xFE, 0x74, 0x6D, 0x7E, 0x05, 0x2B, 0x40,
-    0x6D, 0x78, 0xE0, 0x8E, 0x1B, 0x92, 0x28, 0x88, 0xFC, 0x98, 0xE4, 0x0C, 0x96, 0xA4, 0xE4, 0xCA,
-    0x50, 0x24, 0xF3, 0xD4, 0xB3, 0x62, 0xC9, 0x00, 0x18, 0x67, 0x2E, 0xF3, 0x20, 0xA5, 0xC2, 0x27,
-    0x19, 0x93, 0xE1, 0x11, 0xC1, 0x5B, 0x1B, 0x5F, 0x09, 0x3D, 0x71, 0x48, 0x8F, 0x4C, 0xF8, 0xA7,
-    0x22, 0xB2, 0x4A, 0xA2, 0xFB, 0xA8, 0x8C, 0x71, 0xCF, 0x4C, 0x72, 0xC0, 0x3E, 0xB2, 0xE2, 0x1E,
-    0x31, 0x27, 0x0E, 0xF3, 0x29, 0x46, 0x3D, 0x78, 0x72, 0x25, 0x81, 0x1F, 0x96, 0x47, 0x06, 0x1E,
-    0xF0, 0xB1, 0xF2, 0x50, 0xF4, 0xD2, 0x52, 0x9A, 0xC7, 0xC9, 0xBE, 0x4B, 0xB4, 0x9E, 0xD0, 0xF6,
-    0x1F, 0xBD, 0xA4, 0x57, 0x67, 0x8F, 0x42, 0x4B, 0x68, 0x66, 0xD0, 0xF2, 0x97, 0xF0, 0xA5, 0x0D,
-    0xD9, 0x7C, 0x00, 0xAA, 0xB5, 0x05, 0x2F, 0x2B, 0x85, 0xFE, 0xDE, 0x07, 0x03, 0x2C, 0x30, 0x23,
-    0xAD, 0x7C, 0xDE, 0xC3, 0x07, 0x4A, 0xC3, 0x81, 0x23, 0x24, 0xCF, 0x14, 0x47, 0xC9, 0x5A, 0x66,
-    0x46, 0xAA, 0xFB, 0x60, 0x9F, 0x54, 0xC3, 0x08, 0x9E, 0x00, 0x7C, 0xCC, 0x17, 0xA7, 0x7D, 0xD6,
-    0x52, 0x02, 0xB8, 0xE7, 0x84, 0x82, 0xF9, 0x61, 0x40, 0xC9, 0x2D, 0x0D, 0x2E, 0x2D, 0x2E, 0x64,
-    0xBA, 0x0D, 0xA9, 0x57, 0x9E, 0x7E, 0xFB, 0x78, 0x43, 0x41, 0x3C, 0xA2, 0xB8, 0x70, 0xB8, 0xB0,
-    0xB9, 0x30, 0xB8, 0x00, 0x11, 0x12, 0xA0, 0xBA, 0x1D, 0x41, 0x0B, 0x64, 0xA8, 0x31, 0x66, 0xC7,
-    0xB5, 0x88, 0x19, 0x14, 0x36, 0xCB, 0xFF, 0x1E, 0xAE, 0x81, 0x76, 0xE7, 0xAC, 0xE4, 0x48, 0x71,
-    0x8D, 0x39, 0xF9, 0xF5, 0x05, 0xC5, 0xB7, 0x98, 0x57, 0xB4, 0xC5, 0x6F, 0x6B, 0x58, 0x00, 0x7B,
-    0xAF, 0x6F, 0xC5, 0xC5, 0x3E, 0x4E, 0x10, 0xEB, 0xFB, 0xBF, 0x82, 0x48, 0x3C, 0x5F, 0x1C, 0x15,
-    0x20, 0x47, 0x0E, 0x6B, 0x51, 0xF7, 0x2F, 0x82, 0x1F, 0x7D, 0xBE, 0xC3, 0x5C, 0x69, 0x4A, 0x74,
-    0x36, 0x1E, 0x24, 0xF2, 0xE7, 0x35, 0xB8, 0xB6, 0x57, 0xDC, 0x59, 0x7E, 0xFA, 0x1E, 0xEE, 0xE3,
-    0xE1, 0x5F, 0x13, 0x17, 0x82, 0x93, 0x5A, 0x4E, 0x79, 0x71, 0x0A, 0x9E, 0x72, 0xE1, 0x73, 0x26,
-    0x97, 0x22, 0xE5, 0x7A, 0xF9, 0xC2, 0xE8, 0xDF, 0xCE, 0x55, 0x8F, 0x99, 0x7D, 0xD6, 0xAC, 0x7B,
-    0x7E, 0xA2, 0x36, 0xF0, 0x5F, 0x81, 0x62, 0x10, 0xB1, 0xA8, 0x85, 0x5C, 0x3C, 0xCB, 0xBC, 0xC4,
-    0xFC, 0x21, 0x88, 0x87, 0x34, 0x26, 0x6A, 0x1B, 0x45, 0xF2, 0xBC, 0x97, 0x95, 0x1A, 0xE2, 0x6A,
-    0xBC, 0x99, 0x50, 0x39, 0x48, 0x72, 0xB5, 0xE5, 0x63, 0x29, 0x45, 0x97, 0x40, 0xE6, 0x0A, 0x11,
-    0x3D, 0x4C, 0xB9, 0xD2, 0x4A, 0x5F, 0xF0, 0x61, 0xA5, 0xD4, 0x76, 0x9D, 0x33, 0x4B, 0x1B, 0x77,
-    0x2E, 0x7C, 0x36, 0x04, 0x89, 0xB6, 0x03, 0x98, 0x78, 0xE6, 0x0F, 0xAC, 0x47, 0xFE, 0x70, 0x72,
-    0xAC, 0x71, 0x6B, 0x64, 0x66, 0x6E, 0x64, 0xD4, 0xC5, 0xD9, 0x56, 0x48, 0x83, 0x3E, 0xF1, 0xBB,
-    0x67, 0x64, 0xA3, 0xC8, 0xB3, 0xCE, 0x23, 0xE7, 0x38, 0x13, 0x9C, 0xE0, 0xA2, 0xE3, 0x9A, 0x72,
-    0xEC, 0xC6, 0x90, 0x2A, 0x26, 0xC4, 0x6A, 0x4E, 0xA9, 0x1F, 0x74, 0x9D, 0xC4, 0xF9, 0xA0, 0xB4,
-    0x3E, 0xE7, 0xAB, 0xE9, 0x42, 0x76, 0x45, 0xCD, 0xB8, 0x72, 0xFD, 0x7F, 0x83, 0x0C, 0xA1, 0x76,
-    0x72, 0x35, 0xC5, 0x32, 0xE9, 0x2F, 0xE5, 0x32, 0x21, 0x20, 0x8B, 0x34, 0x61, 0x15, 0x0F, 0x53,
-    0x69, 0x80, 0x48, 0x5C, 0x8E, 0x45, 0x79, 0x2C, 0x76, 0xC0, 0x6A, 0x39, 0x39, 0x03, 0xB8, 0x24,
-    0x03, 0xCA, 0x7B, 0x70, 0x2E, 0x47, 0x7C, 0xA0, 0x1F, 0x08, 0xCC, 0x01, 0xEA, 0xC8, 0x85, 0xD5,
-    0x6F, 0xF2, 0x74, 0xFD, 0xA4, 0x57, 0xB5, 0x4E, 0x30, 0x22, 0x89, 0xE8, 0x49, 0xE2, 0xA0, 0x63,
-    0x5F, 0xA2, 0xC1, 0x66, 0xC4, 0x7F, 0xCC, 0xAC, 0x44, 0xA4, 0x08, 0x51, 0x25, 0x0A, 0x91, 0x45,
-    0x23, 0xCC, 0x75, 0xD8, 0xD8, 0xF3, 0x01, 0x40, 0xB4, 0x55, 0x4E, 0x6D, 0xE0, 0x6C, 0x94, 0xBF,
-    0xDC, 0x4C, 0x1B, 0x6A, 0x0D, 0x68, 0x16, 0xDA, 0x55, 0x19, 0x0C, 0xC5, 0x8D, 0x96, 0x1E, 0x4A,
-    0x22, 0x90, 0xF7, 0xFA, 0x81, 0x4F, 0x0A, 0xE0, 0xF1, 0x91, 0xF8, 0xBC, 0x4D, 0xE2, 0x56, 0xA6,
-    0x33, 0x08, 0x83, 0x53, 0x0B, 0xC0, 0xE2, 0x04, 0x25, 0xE3, 0xF5, 0xA1, 0xF8, 0x18, 0x1E, 0xD0,
-    0x47, 0xEB, 0x5D, 0x32, 0x0A, 0xA0, 0x1E, 0xF0, 0xDA, 0xB5, 0xE7, 0xD5, 0x1C, 0x3E, 0x77, 0x94,
-    0xC4, 0x0D, 0x54, 0xFB, 0xB5, 0x88, 0xFA, 0xCA, 0x7B, 0x55, 0xCB, 0x14, 0x26, 0x89, 0x48, 0x64,
-    0xD4, 0x8F, 0xDC, 0xFE, 0xC7, 0x13, 0x87, 0xB7, 0x84, 0xEE, 0xCD, 0xA0, 0x06, 0x50, 0xF5, 0x59,
-    0x45, 0xD6, 0x4A, 0x6A, 0x40, 0x57, 0x95, 0x90, 0x55, 0x4E, 0xD4, 0x5D, 0xA7, 0x4E, 0x63, 0xBF,
-    0xF2, 0xAA, 0x0F, 0xB1, 0xA6, 0xAE, 0x58, 0xD2, 0xAE, 0xE9, 0x25, 0x52, 0xFF, 0x8D, 0x69, 0x45,
-    0x47, 0xD4, 0xDA, 0xC0, 0xD3, 0x72, 0x0A, 0x7C, 0x48, 0xD6, 0x1A, 0x12, 0x80, 0x6A, 0xCB, 0xB5,
-    0x0A, 0x55, 0x3A, 0xFA, 0x0F, 0xD6, 0x4D, 0x5E, 0x63, 0x4D, 0x5B, 0x06, 0x9F, 0x75, 0xE3, 0xBF,
-    0xA7, 0xF5, 0x57, 0x35, 0x2C, 0x2B, 0xCD, 0x56, 0xA5, 0x59, 0x54, 0x9A, 0xCD, 0x5A, 0x33, 0xD7,
-    0xFA, 0x2B, 0x87, 0xBA, 0xF5, 0x40, 0x56, 0xFB, 0x80, 0x1E, 0xAA, 0x2B, 0xDA, 0x7C, 0xC4, 0x9A,
-    0x28, 0x12, 0x71, 0xAF, 0xA0, 0x42, 0x91, 0x1A, 0x0F, 0xE5, 0x32, 0x40, 0x91, 0x57, 0x17, 0x32,
-    0x44, 0x94, 0x44, 0x52, 0x18, 0x3A, 0x48, 0x40, 0xC2, 0x49, 0x44, 0xDD, 0xD9, 0xA4, 0x3A, 0x74,
-    0x68, 0x74, 0x54, 0xDD, 0x96, 0xE6, 0x9E, 0x02, 0x98, 0x13, 0xC9, 0xF5, 0x74, 0x28, 0xE4, 0xA1,
-    0xC4, 0x7C, 0x53, 0x62, 0x6A, 0x81, 0xA0, 0x72, 0x57, 0x93, 0x24, 0x80, 0xC6, 0x95, 0x81, 0x00,
-    0x2B, 0xC8, 0x0F, 0x63, 0x95, 0x7D, 0x2A, 0x7E, 0x04, 0xFF, 0x82, 0x4A, 0xDF, 0x7B, 0xDC, 0xA4,
-    0xF1, 0xDA, 0x24, 0x2D, 0xCD, 0xF3, 0x11, 0x9A, 0x45, 0xD4, 0xA9, 0xCF, 0x29, 0x26, 0xC0, 0xCA,
-    0xB5, 0xE9, 0xB3, 0x94, 0x77, 0x49, 0xB9, 0x81, 0x73, 0xED, 0x55, 0xE4, 0x54, 0x8D, 0x77, 0xB2,
-    0x32, 0xCB, 0x78, 0xAA, 0xF1, 0x0E, 0x79, 0x47, 0x2E, 0xA6, 0x66, 0x26, 0xC1, 0xAC, 0x0B, 0x76,
-    0xAC, 0x25, 0xB9, 0x33, 0x01, 0x31, 0x58, 0x0F, 0x19, 0xF2, 0xD1, 0x0F, 0x91, 0x11, 0x15, 0x3C,
-    0xFC, 0xCA, 0x2B, 0x27, 0x51, 0x40, 0xEC, 0xA9, 0x5C, 0x1E, 0x9B, 0x0A, 0x93, 0xA4, 0xD3, 0x82,
-    0x62, 0x51, 0x22, 0x84, 0x4D, 0xAD, 0xC8, 0x2C, 0x91, 0x70, 0x23, 0x69, 0xDA, 0xA7, 0xD2, 0x46,
-    0xC3, 0x9B, 0x4B, 0xC4, 0xED, 0x18, 0xB1, 0x52, 0x08, 0xBF, 0x40, 0x13, 0x1A, 0xE7, 0x7C, 0xEF,
-    0xEF, 0x3D, 0xC7, 0xA3, 0xDE, 0x10, 0x5F, 0xE4, 0xCF, 0x39, 0x3C, 0x88, 0xF2, 0x31, 0x6B, 0xC9,
-    0x6B, 0x4E, 0xA2, 0x51, 0x61, 0x40, 0x8D, 0xFB, 0x3D, 0x08, 0xC3, 0xC4, 0x9C, 0xD6, 0xA3, 0xF4,
-    0x30, 0xBD, 0x0F, 0x4E, 0x72, 0x8E, 0xB9, 0x2E, 0xE8, 0x4C, 0x8A, 0x25, 0xAF, 0xAB, 0xF8, 0x73,
-    0x2E, 0xED, 0xBB, 0x3A, 0x40, 0x76, 0x80, 0xE0, 0x60, 0xEA, 0xDC, 0x64, 0x89, 0x67, 0x8B, 0x34,
-    0x7F, 0x41, 0x0B, 0xC7, 0x77, 0xF4, 0xE9, 0x76, 0xFC, 0x22, 0x69, 0xCE, 0xF8, 0x62, 0x9A, 0xBB,
-    0x67, 0x16, 0xCF, 0x5D, 0x78, 0xA1, 0xCE, 0xD7, 0x30, 0x6E, 0x9B, 0xDF, 0xE8, 0xB6, 0x7D, 0xF6,
-    0x85, 0x6E, 0xE8, 0x24, 0x94, 0x5F, 0x65, 0xC0, 0x3D, 0x87, 0xA9, 0xBA, 0x3E, 0x37, 0x06, 0xB4,
-    0xBC, 0x4D, 0xE5, 0xA7, 0x87, 0x3C, 0x9F, 0x5E, 0xE3, 0x0A, 0x40, 0xCC, 0x66, 0xC1, 0x55, 0xC5,
-    0xF6, 0x0F, 0x72, 0x5C, 0xC0, 0x73, 0x47, 0x0F, 0xD5, 0xC5, 0x91, 0x6A, 0x52, 0x97, 0xDE, 0xA8,
-    0xE6, 0xF4, 0xAE, 0x9E, 0x09, 0x1E, 0x05, 0xAD, 0x6E, 0xD1, 0x91, 0xBC, 0x39, 0xB5, 0xDA, 0x51,
-    0xBC, 0xFE, 0xF5, 0xE1, 0x2E, 0xE8, 0xAC, 0x74, 0x38, 0x76, 0x53, 0xDA, 0xA9, 0xF3, 0x73, 0xA2,
-    0x22, 0xCE, 0xC7, 0x0E, 0x14, 0x54, 0x99, 0xB5, 0x7F, 0x38, 0xE0, 0xB2, 0x77, 0x1E, 0x93, 0x93,
-    0xE2, 0x55, 0x2E, 0x4D, 0xE0, 0x16, 0x4B, 0x23, 0x70, 0x61, 0xDA, 0xFD, 0xCE, 0xA5, 0xDB, 0x47,
-    0x4F, 0xEA, 0xD8, 0x0C, 0xB2, 0xE2, 0x3B, 0x97, 0x76, 0x61, 0x6C, 0xAF, 0x2E, 0x89, 0x26, 0x25,
-    0x22, 0x94, 0xD4, 0x31, 0x12, 0x2B, 0x72, 0xBC, 0x1D, 0x07, 0x9A, 0x3B, 0x71, 0x7B, 0x67, 0x53,
-    0x1F, 0x9D, 0x4E, 0xB7, 0x5B, 0x8D, 0x3B, 0x98, 0x76, 0x16, 0x92, 0x86, 0x55, 0x8F, 0x51, 0xB2,
-    0x6A, 0xE9, 0xF5, 0x07, 0x70, 0xEB, 0xE8, 0x19, 0xD4, 0xD1, 0x23, 0x24, 0x56, 0xCF, 0xCF, 0xD7,
-    0x0C, 0x3E, 0x7C, 0x59, 0xFA, 0x15, 0x59, 0x75, 0xDE, 0x4F, 0xD4, 0x3C, 0xE2, 0xE8, 0xF9, 0x07,
-    0x2E, 0x15, 0x7A, 0xA4, 0xF2, 0xAF, 0x91, 0xC3, 0x28, 0x91, 0x3E, 0xB5, 0x44, 0x6C, 0x45, 0xD8,
-    0x4F, 0x7D, 0x80, 0x41, 0x07, 0x1C, 0x0C, 0xCF, 0xB1, 0xC5, 0x33, 0x6E, 0x04, 0xEA, 0x92, 0x38,
-    0x16, 0xEC, 0xA9, 0xD3, 0xD8, 0x2E, 0xF1, 0x9F, 0x3A, 0xB4, 0x1C, 0xB5, 0x5A, 0x62, 0x2D, 0x6A,
-    0xF7, 0xB0, 0x25, 0x50, 0xBE, 0x48, 0x1E, 0x03, 0xAC, 0x0B, 0xF2, 0x98, 0x8A, 0xBB, 0x1D, 0xB1,
-    0x1E, 0x2A, 0xF5, 0x9B, 0x35, 0x3D, 0x0A, 0x05, 0x6E, 0x54, 0x87, 0x7D, 0xEE, 0xB1, 0xB0, 0x9B,
-    0xA0, 0xF9, 0xAC, 0x6D, 0xAD, 0x84, 0xED, 0x8E, 0xD8, 0xB8, 0xB3, 0xA0, 0xF8, 0x3A, 0x67, 0x9A,
-    0xD6, 0x30, 0xA2, 0x87, 0x16, 0x1F, 0xDC, 0x8C, 0xF8, 0x73, 0x56, 0x89, 0x25, 0xEA, 0x1F, 0xDF,
-    0xE1, 0xD3, 0x5F, 0xA7, 0x9F, 0xAB, 0x73, 0x98, 0x8F, 0x7B, 0xF9, 0x0B, 0xD5, 0xBD, 0x33, 0xDC,
-    0x1B, 0x9A, 0xD5, 0x3A, 0x20, 0x10, 0x43, 0x50, 0xA2, 0x77, 0x05, 0x4F, 0xFC, 0x43, 0xD8, 0xD6,
-    0xEA, 0x66, 0x3B, 0xA7, 0x03, 0x87, 0xC8, 0x63, 0x9F, 0x2A, 0x62, 0xED, 0x16, 0x12, 0xD3, 0x87,
-    0xC5, 0xB1, 0x9C, 0x49, 0x9D, 0x76, 0xE6, 0xB4, 0xAE, 0x38, 0x45, 0x26, 0x35, 0xCD, 0xC4, 0x48,
-    0xB5, 0xA8, 0x56, 0x21, 0x05, 0x76, 0xA8, 0x5B, 0x0A, 0xDA, 0x9C, 0x4B, 0xD8, 0x04, 0xA3, 0x44,
-    0x68, 0x6B, 0xDC, 0xAC, 0xA0, 0xD5, 0x11, 0x2B, 0x61, 0xAB, 0x29, 0xD6, 0xC2, 0x5E, 0x0B, 0xDB,
-    0xB8, 0x52, 0x57, 0xC8, 0xC2, 0xB3, 0xE2, 0x76, 0x42, 0xAF, 0xEB, 0x88, 0xE5, 0xB0, 0xDD, 0xC4,
-    0x7E, 0x0E, 0x8E, 0xDC, 0x40, 0xD1, 0x3D, 0x88, 0x2B, 0xA4, 0x3E, 0x8A, 0xDB, 0x73, 0x56, 0x39,
-    0xE3, 0x57, 0xB7, 0x16, 0xF0, 0xF3, 0x64, 0x49, 0x0D, 0x17, 0x68, 0x1E, 0x79, 0x8A, 0x12, 0x45,
-    0x84, 0x5D, 0x78, 0x4B, 0x9E, 0x4C, 0xDC, 0xF1, 0x40, 0xB5, 0xA8, 0x9F, 0x10, 0xF6, 0xCB, 0x05,
-    0xD5, 0x93, 0xE0, 0x3C, 0xAE, 0xE1, 0x33, 0x58, 0xBE, 0x05, 0xD8, 0x82, 0x6F, 0x38, 0x00, 0x11,
-    0x7E, 0x38, 0x88, 0x92, 0xF4, 0x40, 0x4B, 0x8E, 0x1F, 0x1A, 0xAC, 0xC4, 0x9C, 0xA8, 0x58, 0x06,
-    0xF8, 0x2B, 0xC5, 0x1A, 0xED, 0xF8, 0x00, 0x92, 0xC2, 0xC2, 0x37, 0xCF, 0x5F, 0xD8, 0xA2, 0xA5,
-    0x45, 0xD9, 0x15, 0x11, 0x65, 0x8E, 0x99, 0x66, 0x62, 0x23, 0xB2, 0x99, 0x64, 0x86, 0x2C, 0xD7,
-    0x9B, 0x32, 0x5B, 0x5F, 0xA3, 0x92, 0x17, 0x88, 0xFE, 0x0F, 0xAD, 0x58, 0x3D, 0x8C, 0xDD, 0xD6,
-    0x95, 0x3E, 0x97, 0x57, 0x12, 0x61, 0x11, 0xF0, 0x75, 0x31, 0x4A, 0x02, 0x19, 0x16, 0x9B, 0x2D,
-    0x0C, 0xED, 0x66, 0x88, 0x00, 0x5B, 0x08, 0xC1, 0x7B, 0x8F, 0x94, 0x27, 0x80, 0x80, 0xB8, 0x90,
-    0x0A, 0x19, 0xBB, 0x48, 0xB3, 0x5B, 0x6C, 0x91, 0x4D, 0x33, 0x5B, 0xA8, 0x98, 0xE2, 0xFD, 0xD0,
-    0x12, 0x16, 0x2A, 0x52, 0x58, 0xC5, 0xBA, 0x96, 0x0A, 0x1B, 0x48, 0xE4, 0x62, 0x16, 0xD8, 0x14,
-    0x2A, 0x9E, 0x1E, 0x29, 0x4D, 0xA1, 0x22, 0xC0, 0x9A, 0xF2, 0x04, 0x51, 0xB7, 0xA2, 0x2D, 0x2F,
-    0x0C, 0x28, 0xC0, 0xCE, 0x55, 0x4C, 0xD9, 0x9C, 0x11, 0xC9, 0xB3, 0xDF, 0x21, 0xE7, 0xBD, 0x99,
-    0x31, 0x64, 0x39, 0x23, 0xE7, 0x3D, 0x92, 0xEF, 0x97, 0xF7, 0xDC, 0x73, 0xEE, 0x39, 0xDF, 0xF7,
-    0x9D, 0x4B, 0xF4, 0x1A, 0x05, 0x9C, 0x6A, 0xAE, 0x68, 0xDF, 0xC3, 0x44, 0xE4, 0xE0, 0x8B, 0x30,
-    0x23, 0xB7, 0x21, 0xDA, 0xB1, 0xE4, 0x9F, 0x8F, 0x1C, 0x5B, 0x51, 0xE8, 0x65, 0x6E, 0x3E, 0x26,
-    0x66, 0xEB, 0x33, 0x5F, 0x66, 0xAE, 0xC2, 0xC8, 0x3C, 0xB0, 0xD4, 0xFC, 0xE0, 0xA3, 0x2B, 0x5C,
-    0x9D, 0x7E, 0x3F, 0xDA, 0xBD, 0xDD, 0x7D, 0xF6, 0x2E, 0x57, 0x7D, 0xB3, 0x11, 0x0F, 0x2F, 0xE9,
-    0x7B, 0xD1, 0x28, 0xE4, 0x4F, 0xB8, 0xF1, 0xBE, 0xCE, 0x29, 0x5A, 0x22, 0x7F, 0x3D, 0x25, 0x2E,
-    0xC8, 0xAD, 0x5F, 0xDA, 0x16, 0x91, 0x63, 0x87, 0x3E, 0xC7, 0x49, 0x3E, 0x1F, 0x61, 0x72, 0xCB,
-    0xE7, 0x8D, 0xAC, 0x3A, 0xE3, 0xDE, 0x8B, 0x7A, 0x97, 0xDC, 0x4D, 0xAE, 0x03, 0xCE, 0x93, 0xF1,
-    0x4B, 0x0C, 0x8C, 0x3B, 0xD4, 0x53, 0x22, 0xDF, 0x62, 0xCC, 0xDD, 0xB1, 0xFD, 0xFF, 0x53, 0x5C,
-    0x99, 0x15, 0x7B, 0xC6, 0xBD, 0x93, 0x19, 0x37, 0x1A, 0x19, 0x2E, 0x30, 0x7A, 0xF0, 0x30, 0xA5,
-    0x1F, 0x93, 0x93, 0x93, 0x57, 0x90, 0x69, 0xE7, 0xA1, 0x22, 0xF2, 0x22, 0x32, 0x44, 0xCB, 0xF3,
-    0x59, 0x05, 0x8D, 0xE2, 0xC6, 0xE5, 0xDA, 0x14, 0x47, 0xFC, 0x94, 0xC2, 0x48, 0x8E, 0x09, 0x8E,
-    0x98, 0xC2, 0xFC, 0x68, 0xC8, 0xB5, 0xCF, 0xB5, 0xC7, 0xB5, 0xE2, 0x9A, 0x2E, 0x51, 0x8F, 0x7C,
-    0x3A, 0x2A, 0xD1, 0x4B, 0xCE, 0x72, 0x5E, 0xB7, 0x1F, 0xDD, 0x8C, 0xEA, 0x7F, 0xF6, 0x59, 0x25,
-    0x71, 0x3B, 0x0D, 0xF8, 0x11, 0xD3, 0xB3, 0x5C, 0x67, 0xB7, 0x0E, 0x3D, 0x3C, 0xD1, 0x29, 0xD2,
-    0xA5, 0x7A, 0x96, 0x0F, 0x3D, 0x8C, 0xE5, 0xE0, 0xBB, 0x3C, 0x8C, 0x74, 0x4A, 0x43, 0xB1, 0x11,
-    0xFE, 0xA3, 0x62, 0x7B, 0x0C, 0xBE, 0x1F, 0xC7, 0x90, 0x91, 0x1C, 0x61, 0x7C, 0x58, 0x0B, 0xEA,
-    0x06, 0xDD, 0xC6, 0x8F, 0x6D, 0x20, 0x9E, 0xE7, 0x80, 0x4E, 0xD7, 0x24, 0xFC, 0x61, 0x2A, 0x6E,
-    0x1C, 0x39, 0x74, 0x7C, 0xDE, 0x3C, 0xF6, 0xEE, 0x57, 0xD6, 0xAD, 0xE4, 0xE6, 0x0B, 0xF4, 0xAD,
-    0x0E, 0x1C, 0xA5, 0x0B, 0xAA, 0x28, 0xC9, 0x2F, 0x49, 0x95, 0x44, 0x3F, 0xDA, 0x35, 0xA2, 0x78,
-    0x87, 0x26, 0x5C, 0x62, 0xA1, 0xAF, 0xE6, 0xDE, 0x93, 0x92, 0x6E, 0x23, 0x2D, 0xAE, 0xC7, 0xFA,
-    0x8B, 0x9C, 0xEA, 0x92, 0x06, 0x63, 0x95, 0x5C, 0x67, 0x7E, 0xC0, 0xFC, 0x04, 0xC9, 0x30, 0x61,
-    0x99, 0x3F, 0x96, 0xDE, 0x5F, 0x22, 0xF5, 0x65, 0x46, 0x7E, 0x8F, 0xD4, 0xD7, 0x69, 0xB0, 0x3E,
-    0x34, 0x6C, 0xF5, 0x57, 0x4C, 0x3D, 0xD7, 0xBA, 0xF1, 0x98, 0x46, 0x5E, 0xAE, 0xB9, 0x21, 0x9F,
-    0x2D, 0xAD, 0xAE, 0x63, 0xFC, 0x06, 0x27, 0xE7, 0x38, 0x4B, 0x55, 0x3A, 0x15, 0x6C, 0x8F, 0x70,
-    0x0E, 0x42, 0xCE, 0x42, 0x39, 0xF1, 0x7E, 0xAC, 0xCA, 0x63, 0x70, 0x55, 0x5C, 0xE1, 0x0A, 0xA7,
-    0xC5, 0x19, 0xB5, 0x86, 0x86, 0xE4, 0xE1, 0x9B, 0xF5, 0xC7, 0xA4, 0x2C, 0xCD, 0xA6, 0x48, 0x48,
-    0xAA, 0x93, 0x14, 0x66, 0x4E, 0xA9, 0xD2, 0xCD, 0x66, 0xF8, 0x1C, 0xC3, 0x8A, 0xC2, 0x2F, 0xC7,
-    0xD7, 0xD3, 0x84, 0xCF, 0xBE, 0x7F, 0x71, 0x1E, 0x3A, 0x27, 0x61, 0x83, 0xB4, 0xFD, 0xF0, 0x42,
-    0x45, 0xDA, 0x92, 0xF9, 0x63, 0x1C, 0x72, 0xC4, 0x95, 0xBC, 0x45, 0x20, 0x6F, 0xDE, 0x60, 0xBE,
-    0xC7, 0xFC, 0x4F, 0x98, 0xD9, 0x89, 0xB7, 0xF0, 0x2F, 0x8E, 0xF7, 0x57, 0xB6, 0x53, 0x53, 0x53,
-    0x0E, 0x7E, 0xB8, 0xC1, 0xCD, 0xF8, 0xC3, 0x73, 0x88, 0x1E, 0x7F, 0xCA, 0x8D, 0x23, 0xF3, 0xA1,
-    0xBE, 0xC1, 0x18, 0xC4, 0x29, 0x00, 0xA1, 0x7D, 0x1C, 0x97, 0x7B, 0x6D, 0xF3, 0xFE, 0x4A, 0x37,
-    0xEC, 0x2F, 0x88, 0x6B, 0xCD, 0x56, 0xDE, 0x12, 0x35, 0x37, 0xAF, 0x30, 0x63, 0x81, 0x10, 0xDA,
-    0x23, 0x67, 0xCF, 0xA2, 0x40, 0x38, 0x5A, 0xCD, 0xBE, 0xDB, 0xC8, 0x94, 0xBA, 0x39, 0x9E, 0x3E,
-    0x9C, 0x1B, 0x25, 0x99, 0x58, 0x55, 0x74, 0x32, 0xFE, 0x4E, 0x0B, 0x7F, 0xCB, 0x96, 0x79, 0x63,
-    0xE7, 0x9D, 0x6E, 0x96, 0xF5, 0x2F, 0x35, 0x17, 0x86, 0x53, 0xBC, 0x85, 0x85, 0x9D, 0x9B, 0x30,
-    0x36, 0xE1, 0xA7, 0x58, 0xAD, 0x65, 0x09, 0xBF, 0x2E, 0xC9, 0xCD, 0x5F, 0x1C, 0x92, 0x33, 0x40,
-    0x04, 0x95, 0x93, 0x9F, 0x21, 0xBF, 0x25, 0x73, 0x2F, 0x0C, 0x7C, 0x0A, 0xAD, 0x0C, 0xFD, 0xF7,
-    0x8B, 0x99, 0xFC, 0xA5, 0x26, 0x75, 0x3A, 0xB3, 0x80, 0x23, 0x13, 0xED, 0x5F, 0x0D, 0x0A, 0x32,
-    0xB3, 0x75, 0xE5, 0xD3, 0x61, 0xC8, 0x5F, 0x3C, 0xBE, 0x38, 0x22, 0x24, 0x96, 0x0F, 0x70, 0x29,
-    0x08, 0xC9, 0x4D, 0x41, 0x4C, 0x0E, 0xD6, 0x6E, 0xD9, 0x3B, 0xB0, 0x7E, 0xF2, 0x38, 0xF9, 0x5B,
-    0x24, 0x4E, 0x8D, 0xFC, 0x28, 0xBD, 0x6D, 0xBA, 0x80, 0xB2, 0x22, 0x14, 0xB9, 0x96, 0xCC, 0x4D,
-    0x7F, 0x7A, 0x61, 0x42, 0x6C, 0x6B, 0x95, 0x6C, 0x56, 0x34, 0xF6, 0x9A, 0x8F, 0x30, 0x17, 0xCE,
-    0x70, 0x46, 0xC7, 0xF8, 0x1A, 0xA1, 0x2C, 0x75, 0x41, 0x61, 0xA1, 0xB3, 0x72, 0x3E, 0x94, 0xBA,
-    0x3D, 0x85, 0xC5, 0x62, 0x72, 0x35, 0x9E, 0xBD, 0xA1, 0xCA, 0x35, 0x2F, 0x67, 0x7E, 0x8B, 0x6B,
-    0x07, 0x08, 0xBD, 0x92, 0x52, 0xE0, 0x3C, 0x2B, 0xE1, 0x4B, 0xD0, 0xFD, 0x5B, 0x59, 0xD4, 0x1B,
-    0x6A, 0xC4, 0x6B, 0xE8, 0xAF, 0x36, 0x21, 0xA2, 0x5B, 0xCB, 0x1E, 0x67, 0xF0, 0x78, 0x37, 0xE9,
-    0x56, 0x57, 0x7D, 0x7E, 0x74, 0xBF, 0x59, 0xF3, 0xBE, 0x88, 0xC6, 0x6B, 0xDE, 0x23, 0x81, 0xF2,
-    0x2C, 0xA9, 0x65, 0x32, 0xD3, 0x20, 0xB9, 0xC2, 0x56, 0xE6, 0xA2, 0xB1, 0x6A, 0x7E, 0xDC, 0x42,
-    0xB4, 0xFA, 0xCD, 0x81, 0x79, 0x1C, 0xBB, 0x19, 0x39, 0x18, 0x3A, 0xC4, 0xFA, 0x35, 0xD1, 0x92,
-    0xC1, 0x04, 0x80, 0x29, 0x58, 0x08, 0x72, 0xED, 0xAB, 0xFF, 0xE1, 0xA7, 0x21, 0x90, 0x7E, 0xB5,
-    0x60, 0xF2, 0x2F, 0xF3, 0x4D, 0xE4, 0x32, 0x17, 0x38, 0x33, 0x95, 0x7C, 0x4E, 0x34, 0x22, 0x2F,
-    0xA3, 0x19, 0x1D, 0xBF, 0xD6, 0x0D, 0xF3, 0xD5, 0x13, 0x6E, 0xFA, 0xFE, 0x17, 0xF1, 0xEC, 0x92,
-    0x8B, 0x8B, 0xD0, 0x17, 0xA0, 0x28, 0x3B, 0xD2, 0x23, 0xEF, 0xEE, 0xB3, 0x32, 0x64, 0x59, 0x16,
-    0x01, 0x3B, 0x41, 0xCA, 0x5A, 0x06, 0xC7, 0x62, 0x75, 0x3E, 0x7F, 0xE3, 0xA1, 0x6E, 0x5E, 0xA3,
-    0xA4, 0x75, 0x37, 0x4E, 0xAE, 0x1D, 0xD5, 0x98, 0x88, 0x41, 0x95, 0x20, 0x37, 0x54, 0xA5, 0x3F,
-    0x74, 0xAD, 0x61, 0x93, 0xBD, 0x5E, 0x87, 0xA9, 0x9B, 0x27, 0x8F, 0x93, 0x88, 0xDB, 0x08, 0x16,
-    0xB4, 0xBA, 0x4D, 0xC4, 0x32, 0x7E, 0x8D, 0x3A, 0x40, 0xC6, 0x9C, 0x8E, 0xFE, 0xC2, 0xB8, 0x08,
-    0xF1, 0xC6, 0x6D, 0x5A, 0x6F, 0xC5, 0x6E, 0x3A, 0xE7, 0x89, 0x8A, 0xA6, 0x21, 0x05, 0xE7, 0x53,
-    0x6F, 0xD3, 0x3A, 0x45, 0x45, 0x75, 0x48, 0xE1, 0xF9, 0xD4, 0x6C, 0xEE, 0x7C, 0x54, 0x32, 0x37,
-    0x21, 0xF3, 0x7B, 0xCC, 0x8F, 0x0A, 0xBD, 0x8D, 0x1A, 0x98, 0x44, 0x58, 0xB9, 0xBC, 0xF5, 0x83,
-    0x33, 0x2A, 0xFA, 0x73, 0x2F, 0x80, 0xBB, 0x5E, 0x0A, 0xD2, 0x25, 0xD4, 0x2F, 0x0D, 0xE0, 0xC3,
-    0x56, 0x26, 0x72, 0xA1, 0xF6, 0xA3, 0x81, 0xCA, 0x4D, 0x3C, 0xD4, 0x79, 0xA0, 0x4A, 0x2F, 0x9D,
-    0x68, 0xEB, 0xA7, 0x95, 0x49, 0x3D, 0x24, 0x7F, 0x10, 0x55, 0x74, 0xDB, 0x7D, 0xFA, 0x0F, 0x08,
-    0x16, 0x17, 0x8C, 0x28, 0x57, 0xD4, 0x68, 0x98, 0x44, 0x24, 0x72, 0x7C, 0x15, 0xC3, 0xB4, 0x2E,
-    0x74, 0xE9, 0x67, 0x26, 0x17, 0xAB, 0xAA, 0x1D, 0x5B, 0x25, 0xB9, 0x24, 0x9E, 0x18, 0x6A, 0x6A,
-    0x94, 0x61, 0x6A, 0xEE, 0x17, 0x3A, 0x3F, 0x45, 0xA5, 0x9B, 0x0E, 0x1C, 0xEB, 0xC7, 0x53, 0xD7,
-    0x86, 0x0A, 0x06, 0xFA, 0x3F, 0xE1, 0xDF, 0xCF, 0x59, 0x56, 0x03, 0x90, 0x42, 0xAA, 0xBE, 0xF9,
-    0xE2, 0x67, 0xAF, 0x2C, 0xD5, 0xFF, 0x95, 0xFC, 0x77, 0xEB, 0xC3, 0x12, 0x59, 0x9D, 0x1A, 0x24,
-    0xBF, 0x75, 0x53, 0x1F, 0xF0, 0x5C, 0x1C, 0xFD, 0xC5, 0x65, 0xC0, 0xCE, 0xCD, 0x7D, 0x75, 0x85,
-    0xE2, 0xAD, 0x5E, 0x74, 0x51, 0x35, 0x9D, 0x5C, 0x5F, 0xE1, 0xEA, 0x5F, 0xDF, 0xE9, 0xCA, 0xF7,
-    0xA8, 0x00, 0x88, 0x59, 0x5C, 0x7C, 0x41, 0x70, 0x3F, 0x52, 0x10, 0x03, 0x12, 0x81, 0x83, 0xC7,
-    0x9D, 0xFA, 0x94, 0x4E, 0xC3, 0x77, 0xB1, 0x40, 0xFE, 0x5B, 0x45, 0x70, 0xF9, 0x03, 0x31, 0x47,
-    0x56, 0x0E, 0x65, 0x7D, 0x55, 0xF8, 0x67, 0x6D, 0x4F, 0x57, 0x60, 0xC0, 0x81, 0xB9, 0xF7, 0xA4,
-    0x4D, 0xE7, 0x2A, 0x34, 0x1B, 0x76, 0xDF, 0x65, 0x12, 0x2D, 0xF5, 0xE4, 0x31, 0x1C, 0x8E, 0x46,
-    0xB7, 0xC9, 0xDC, 0xCB, 0xA8, 0x1A, 0x91, 0x7F, 0x2F, 0x53, 0x25, 0x5E, 0xAE, 0x66, 0x0E, 0x5E,
-    0x82, 0x73, 0x99, 0x53, 0x8C, 0x29, 0x74, 0x73, 0x6D, 0xE5, 0xC5, 0x6A, 0x9B, 0x40, 0xE7, 0x58,
-    0xA9, 0xC1, 0x31, 0xBD, 0x82, 0x64, 0x42, 0x72, 0xF9, 0x9C, 0x4A, 0x7C, 0x4F, 0x76, 0x79, 0xFA,
-    0xA6, 0x73, 0x35, 0xEB, 0xCF, 0xF4, 0xC3, 0x5D, 0x15, 0xF5, 0xA6, 0xDE, 0x4C, 0x7B, 0x3D, 0xBD,
-    0x21, 0x97, 0x7B, 0x69, 0x6F, 0xE4, 0xDE, 0xCB, 0x86, 0x63, 0x40, 0x4F, 0x49, 0x49, 0x8C, 0x42,
-    0xFA, 0x6D, 0x17, 0x26, 0x12, 0x12, 0x07, 0x1D, 0x66, 0xC3, 0x39, 0x0E, 0x17, 0x02, 0x29, 0x30,
-    0xB3, 0x38, 0x80, 0xA9, 0xDD, 0x81, 0x8A, 0xC2, 0x81, 0x00, 0x9A, 0x74, 0x09, 0xB5, 0xC7, 0x82,
-    0xEE, 0x61, 0x4D, 0x4A, 0x38, 0x9C, 0xD6, 0x40, 0xF5, 0xE3, 0x62, 0x38, 0x47, 0x43, 0xAC, 0xF9,
-    0x2D, 0x28, 0x27, 0x2F, 0x86, 0xA4, 0xFA, 0x1D, 0x94, 0x95, 0x89, 0x74, 0x86, 0x55, 0x03, 0x1D,
-    0x89, 0x24, 0xD8, 0x85, 0xCA, 0x94, 0xBC, 0x16, 0xB5, 0x25, 0x41, 0x51, 0xFB, 0x27, 0xA3, 0x45,
-    0x0E, 0x34, 0x54, 0x4D, 0xC0, 0xB9, 0x91, 0xB9, 0x9E, 0xBA, 0x5B, 0x29, 0xE4, 0x01, 0x4D, 0x2C,
-    0x01, 0x54, 0x00, 0x55, 0x1A, 0x1F, 0x40, 0xAC, 0x61, 0x68, 0xCD, 0x06, 0xBB, 0x76, 0x52, 0x04,
-    0x92, 0x6A, 0xA2, 0xDC, 0x62, 0xC9, 0xE5, 0xE2, 0x03, 0xFD, 0x30, 0x35, 0x55, 0xEB, 0x56, 0xA4,
-    0x39, 0x82, 0xAE, 0x1C, 0x25, 0xEF, 0x16, 0x49, 0xBA, 0x07, 0xD0, 0xB0, 0x25, 0xB8, 0x2D, 0xAF,
-    0x0A, 0x0C, 0xFC, 0xC6, 0x19, 0xAF, 0xEF, 0xFC, 0x0F, 0x25, 0x22, 0x78, 0x32, 0x5D, 0x43, 0x93,
-    0x0D, 0x67, 0xA4, 0x88, 0xFE, 0x4E, 0x12, 0xA1, 0xC3, 0xEA, 0xA9, 0xF8, 0x83, 0x92, 0x09, 0x5A,
-    0x12, 0xE8, 0xE8, 0x6C, 0xF1, 0xF6, 0x62, 0x28, 0x15, 0x01, 0xCD, 0x11, 0xB9, 0x11, 0xD6, 0xBF,
-    0x8D, 0x86, 0x93, 0xF7, 0x75, 0x86, 0xA3, 0xA7, 0xD3, 0xA1, 0x2B, 0xC7, 0xE8, 0x5C, 0x35, 0xC9,
-    0x40, 0x3B, 0x48, 0x0B, 0x1C, 0x60, 0x02, 0xD1, 0x46, 0xF3, 0x29, 0x61, 0xE4, 0xC5, 0x61, 0x9E,
-    0x73, 0x5C, 0x34, 0x10, 0x55, 0x9D, 0x7E, 0x8A, 0xFB, 0x04, 0xB4, 0x37, 0xD1, 0x6E, 0xEE, 0x0F,
-    0x95, 0x75, 0xFF, 0xE0, 0xDB, 0x49, 0x47, 0xD5, 0xBF, 0x3A, 0x5B, 0xBB, 0x36, 0x88, 0x71, 0xA1,
-    0x2E, 0x28, 0x76, 0xC9, 0x4B, 0x8B, 0x50, 0x23, 0x67, 0xB5, 0x1D, 0xEE, 0x4D, 0xFA, 0x04, 0x06,
-    0x0B, 0x85, 0xC4, 0x32, 0xE4, 0xBD, 0x4F, 0xCB, 0xCB, 0x83, 0xFE, 0xA0, 0x4F, 0xF2, 0xEC, 0xE1,
-    0x39, 0xDC, 0x7D, 0x8E, 0xA2, 0x49, 0x3A, 0xC9, 0x76, 0x07, 0x1A, 0x78, 0x77, 0x4A, 0x64, 0x61,
-    0x75, 0xF2, 0xCA, 0x7E, 0xEF, 0xF7, 0x06, 0x5A, 0x6E, 0x6F, 0xEF, 0xF7, 0xFB, 0xE3, 0xDE, 0xAC,
-    0xF7, 0xAB, 0x83, 0x43, 0x2C, 0xDC, 0x94, 0x58, 0x4A, 0x9E, 0x09, 0xDE, 0xCB, 0x0C, 0x09, 0xF5,
-    0x45, 0xDE, 0xC7, 0x42, 0x8D, 0x53, 0x51, 0x9A, 0xF8, 0xDA, 0x61, 0xC9, 0x4A, 0x7C, 0x2D, 0x0B,
-    0xD8, 0x22, 0x7D, 0x4B, 0x3B, 0xED, 0x27, 0xD5, 0xFE, 0x56, 0x41, 0x56, 0x27, 0x12, 0x6C, 0x81,
-    0xD7, 0x70, 0xC2, 0x85, 0x53, 0x74, 0xF5, 0xDE, 0xE1, 0x75, 0xAB, 0x00, 0xCE, 0xEC, 0xD3, 0x15,
-    0xF8, 0x8C, 0x3F, 0xF4, 0xDB, 0x5E, 0x00, 0x39, 0x28, 0x32, 0x6D, 0x80, 0xDA, 0xCE, 0x25, 0x11,
-    0x12, 0xAB, 0x6A, 0x4C, 0xC8, 0xBF, 0x40, 0x50, 0xA3, 0x0A, 0x0A, 0x01, 0x34, 0x0D, 0x79, 0x20,
-    0xFF, 0x59, 0x9A, 0x0F, 0x70, 0x91, 0xCA, 0x09, 0xF5, 0xFD, 0xDC, 0x3F, 0x57, 0xB9, 0x9F, 0x30,
-    0x32, 0xC9, 0x8E, 0x82, 0x59, 0x60, 0xFE, 0xF4, 0xFB, 0x8D, 0xED, 0x1D, 0xDB, 0x80, 0x81, 0xAE,
-    0xB2, 0xC9, 0x79, 0xA3, 0x0A, 0x9E, 0x30, 0xD2, 0xFB, 0x28, 0x39, 0x19, 0x62, 0xB8, 0xA0, 0x78,
-    0xBD, 0x05, 0x78, 0xDC, 0x28, 0x46, 0x7D, 0xBD, 0x99, 0x0D, 0xFA, 0x90, 0xA9, 0xE1, 0x58, 0x7F,
-    0x6D, 0xC3, 0xA3, 0x91, 0xB9, 0x6A, 0xF5, 0xFD, 0x46, 0x15, 0x93, 0x74, 0x14, 0x94, 0xFE, 0xDB,
-    0xEC, 0x7E, 0xF2, 0xEC, 0x33, 0xDB, 0x4C, 0xA7, 0xE1, 0xF5, 0x75, 0xF3, 0x88, 0x37, 0xCA, 0x89,
-    0x6D, 0x4C, 0x15, 0xDE, 0x65, 0xDF, 0xB6, 0x81, 0x90, 0x66, 0x06, 0x29, 0x63, 0x16, 0x25, 0x73,
-    0xF1, 0x05, 0xA3, 0xE3, 0x47, 0x3F, 0x83, 0xBE, 0x0A, 0x52, 0x94, 0xF2, 0x44, 0x0A, 0xD4, 0xC9,
-    0x87, 0x12, 0x63, 0xE9, 0x9E, 0xFA, 0xFB, 0xE8, 0xEC, 0x04, 0x0D, 0xFC, 0xD4, 0x9C, 0x2B, 0xDD,
-    0xFB, 0xAC, 0x8A, 0x24, 0x1F, 0x05, 0x95, 0xFF, 0xF6, 0xD6, 0xAF, 0x37, 0x76, 0xFE, 0x6C, 0x9B,
-    0xF1, 0x34, 0x7C, 0x8F, 0xCD, 0xA7, 0x98, 0x49, 0x68, 0xD9, 0xAB, 0x26, 0x29, 0xD3, 0xAB, 0x20,
-    0x87, 0x75, 0x32, 0x82, 0x8E, 0x73, 0x76, 0xC7, 0x63, 0xD0, 0xA0, 0x1C, 0x75, 0x31, 0x32, 0x51,
-    0xD1, 0xD7, 0x79, 0x61, 0xAE, 0xE6, 0xA1, 0x1F, 0x57, 0x93, 0x76, 0xD5, 0x50, 0x35, 0xB7, 0x91,
-    0xEC, 0xEE, 0x8D, 0xBD, 0x3F, 0x83, 0x68, 0xC2, 0x73, 0x9B, 0x59, 0xBF, 0xAF, 0x1F, 0x65, 0x03,
-    0xCC, 0x36, 0x0F, 0xF1, 0xD7, 0x43, 0x86, 0x03, 0xE8, 0x17, 0xA2, 0x31, 0xA8, 0x5E, 0x18, 0x62,
-    0xB0, 0xB8, 0x6E, 0xA4, 0xF9, 0xE8, 0x78, 0x14, 0xEA, 0x1E, 0xF2, 0xFD, 0x80, 0xB6, 0x68, 0x24,
-    0x91, 0x62, 0xB3, 0x9D, 0xC4, 0x13, 0x0A, 0x21, 0x8A, 0x27, 0xC2, 0x0D, 0x03, 0xD2, 0xE8, 0x2A,
-    0x80, 0xD2, 0x14, 0x9A, 0xC2, 0x85, 0x60, 0x96, 0x3E, 0x82, 0xA3, 0x84, 0x4B, 0x5A, 0x6D, 0x3A,
-    0x80, 0x52, 0x8E, 0x08, 0xE9, 0x74, 0x21, 0x5C, 0x15, 0x97, 0x03, 0xF7, 0x41, 0x3A, 0x18, 0xEA,
-    0x2F, 0x9F, 0x42, 0x5B, 0xDC, 0xE7, 0x12, 0x02, 0x54, 0x5A, 0x63, 0xFD, 0x18, 0xC5, 0x02, 0x69,
-    0xE1, 0x15, 0xDF, 0xDB, 0xE8, 0x11, 0x75, 0x76, 0x47, 0x44, 0xF9, 0x6E, 0x35, 0x7D, 0x9B, 0xD1,
-    0x3E, 0x4D, 0x55, 0xA9, 0xAD, 0x97, 0xFB, 0x0B, 0xBC, 0xA3, 0xD5, 0xCF, 0x51, 0x55, 0x0D, 0x89,
-    0x49, 0x2C, 0x76, 0x26, 0x81, 0x09, 0x51, 0x54, 0xB0, 0x09, 0x66, 0xD1, 0xED, 0xFB, 0x30, 0x43,
-    0x5C, 0xBB, 0xF6, 0x39, 0xF3, 0xC0, 0xE6, 0x2A, 0xD9, 0xEE, 0x3C, 0x05, 0x5D, 0x07, 0xD1, 0x58,
-    0x17, 0x5E, 0xBE, 0x4F, 0xA7, 0xD3, 0x04, 0x28, 0x9C, 0x83, 0xAA, 0xC0, 0x25, 0x43, 0xAC, 0x73,
-    0xBD, 0x1A, 0x6B, 0xD4, 0xA2, 0x48, 0x49, 0xF9, 0x95, 0x56, 0xF3, 0x13, 0xEF, 0x40, 0xB5, 0x01,
-    0xB3, 0xB6, 0x13, 0xAE, 0xC4, 0x26, 0xF0, 0x02, 0x23, 0xE0, 0xF2, 0xF4, 0xDA, 0x00, 0xC2, 0x12,
-    0xBD, 0x3A, 0x2E, 0x13, 0x49, 0xA5, 0x50, 0xB8, 0x08, 0xA6, 0x77, 0x7E, 0xE3, 0xCB, 0x1D, 0x30,
-    0xCE, 0x8D, 0x42, 0x79, 0x73, 0x67, 0x6C, 0xDB, 0xFB, 0x1C, 0x75, 0xBE, 0xB5, 0x92, 0x4F, 0xFE,
-    0xFD, 0x09, 0xD4, 0x55, 0x3D, 0xD4, 0x3B, 0xEF, 0x9B, 0x3F, 0xD6, 0x20, 0x01, 0xC8, 0x10, 0x84,
-    0xA8, 0x76, 0x6A, 0xAF, 0x16, 0x19, 0x0C, 0xFE, 0x91, 0xAA, 0x6D, 0xC1, 0xD7, 0x6F, 0x64, 0x03,
-    0x64, 0xD9, 0xC9, 0x97, 0x95, 0xC5, 0x31, 0x80, 0x7F, 0x68, 0xDC, 0x20, 0xE1, 0x71, 0x5D, 0xB1,
-    0xE1, 0x4A, 0x11, 0xAE, 0x94, 0xE1, 0x4A, 0x35, 0xB9, 0x52, 0xB5, 0x6D, 0xBE, 0x4E, 0xBD, 0xD8,
-    0x08, 0x20, 0x4D, 0x83, 0x3A, 0xF8, 0x43, 0x00, 0x60, 0x0A, 0xDB, 0x67, 0xCB, 0x53, 0x28, 0x69,
-    0x54, 0x1B, 0xCA, 0x08, 0x98, 0x8A, 0xCA, 0xDB, 0xD5, 0x93, 0x87, 0xB4, 0x71, 0x02, 0x8A, 0x28,
-    0x88, 0xC3, 0x68, 0x02, 0x92, 0xB9, 0xF8, 0x5C, 0x4B, 0x4B, 0x2A, 0xF2, 0xDF, 0x8E, 0x5D, 0xB4,
-    0x9E, 0xF8, 0xFF, 0xBF, 0xBD, 0x8C, 0x8D, 0x7F, 0x39, 0x76, 0xFE, 0xBD, 0x18, 0x89, 0x95, 0x92,
-    0x64, 0xFC, 0xCC, 0x06, 0xB5, 0xF7, 0x14, 0xE5, 0x37, 0xC5, 0xF0, 0x26, 0xD5, 0xC0, 0xB9, 0x76,
-    0x47, 0x03, 0x5C, 0x2C, 0x9C, 0xEF, 0xE4, 0x73, 0x6C, 0x53, 0xD0, 0x7D, 0xA0, 0x71, 0x2F, 0x7F,
-    0x4D, 0xB0, 0x56, 0x50, 0x34, 0xB9, 0x86, 0xE8, 0x82, 0x69, 0x51, 0x30, 0x0A, 0xB9, 0xEB, 0x54,
-    0x5E, 0x1C, 0xDC, 0x41, 0x23, 0x80, 0x45, 0xA2, 0xF5, 0xDD, 0x0A, 0x58, 0x12, 0xA0, 0x5C, 0xEB,
-    0x5A, 0x9F, 0xA0, 0x30, 0x1F, 0x09, 0x51, 0x6E, 0x93, 0x57, 0x01, 0x7D, 0x1B, 0x48, 0xD0, 0x3B,
-    0xDD, 0x4E, 0xCE, 0xAB, 0x24, 0x81, 0x13, 0xE9, 0xD9, 0xDF, 0x6B, 0x92, 0x80, 0xDE, 0xBE, 0xEC,
-    0x4E, 0x15, 0x34, 0x53, 0xAD, 0x3D, 0x98, 0xC5, 0xBD, 0x32, 0x09, 0x14, 0x06, 0x49, 0xBB, 0x0F,
-    0xDC, 0xBA, 0xE5, 0x54, 0xC8, 0x07, 0xB4, 0xA4, 0xF6, 0x38, 0x7F, 0x3E, 0xA7, 0x8F, 0x08, 0xF0,
-    0x35, 0xB3, 0xCB, 0x6E, 0x2A, 0x34, 0x11, 0xED, 0xFC, 0xA7, 0x69, 0x27, 0x0B, 0x66, 0x1F, 0x9B,
-    0xAD, 0x47, 0x5C, 0xBD, 0xDE, 0xBC, 0xCC, 0xF8, 0xAF, 0x63, 0x7C, 0xD9, 0x25, 0x9A, 0x4A, 0x6F,
-    0x43, 0xAA, 0x43, 0xAA, 0xE7, 0xF8, 0x74, 0x97, 0x73, 0x97, 0xA4, 0xA3, 0xC8, 0x91, 0xF5, 0x4E,
-    0xFC, 0x4B, 0xF2, 0x57, 0x51, 0x08, 0xA9, 0xE8, 0x44, 0x11, 0x8F, 0xDF, 0xC3, 0xB5, 0x53, 0x4E,
-    0x76, 0xBB, 0x74, 0x1A, 0xE1, 0x0C, 0x41, 0xD5, 0x6F, 0x75, 0x0D, 0xE9, 0xFE, 0x90, 0xF9, 0x6B,
-    0xC6, 0x8A, 0x4D, 0xDB, 0xAD, 0x1D, 0x88, 0x31, 0xE1, 0xBE, 0xBA, 0x63, 0x86, 0xAC, 0x0D, 0x76,
-    0xDD, 0x36, 0x31, 0xD2, 0xCB, 0x64, 0xD2, 0x04, 0xD1, 0x0F, 0x53, 0xA9, 0x3C, 0xE7, 0x5A, 0x27,
-    0xD1, 0x06, 0xE8, 0xBB, 0x43, 0xB4, 0xE8, 0x59, 0xBF, 0x13, 0x64, 0x05, 0x0D, 0x6E, 0x98, 0x0A,
-    0x2A, 0x09, 0xFA, 0x8A, 0x5E, 0x4F, 0x5D, 0x0C, 0x18, 0xFD, 0x0D, 0x4D, 0xA7, 0xE2, 0xB6, 0x18,
-    0x79, 0x65, 0xB1, 0xE9, 0xC2, 0xDC, 0x99, 0xB7, 0x22, 0xE6, 0x6F, 0xCF, 0xCD, 0xEB, 0x6F, 0x9A,
-    0x6F, 0xBA, 0x1E, 0x4A, 0x0A, 0x12, 0xBC, 0x3A, 0x54, 0xF9, 0x54, 0xE7, 0x17, 0x41, 0xF7, 0x21,
-    0x4B, 0x14, 0x60, 0x71, 0xEF, 0x78, 0x8C, 0x34, 0xC3, 0x11, 0x7D, 0x8B, 0x67, 0x09, 0xDA, 0x54,
-    0xC1, 0xEC, 0xE7, 0x78, 0xD6, 0x76, 0x45, 0xB2, 0x85, 0x80, 0x56, 0x16, 0xB8, 0x83, 0xA6, 0x0F,
-    0x22, 0x04, 0x9A, 0x88, 0x76, 0x62, 0x08, 0xBF, 0x16, 0xE4, 0x6F, 0x01, 0x72, 0xD6, 0xE8, 0x8D,
-    0x9A, 0x9C, 0x9F, 0xEF, 0x6B, 0xDE, 0xBA, 0x96, 0x48, 0x9A, 0x25, 0xAB, 0xF7, 0x3A, 0xA7, 0x0D,
-    0x88, 0xEA, 0x0A, 0x1A, 0x3D, 0x9A, 0xA0, 0x99, 0xB9, 0x8B, 0x7E, 0x06, 0x9A, 0xC2, 0xE5, 0x16,
-    0xB2, 0xF5, 0x03, 0x48, 0x04, 0xB3, 0xD8, 0x00, 0x5C, 0xD3, 0x0F, 0xD2, 0xFE, 0x10, 0xBA, 0x7A,
-    0xD0, 0x73, 0x1F, 0x65, 0x40, 0xDD, 0xCF, 0xB8, 0xF1, 0x9E, 0xE5, 0x20, 0x58, 0xD9, 0x95, 0x4B,
-    0xF8, 0xC0, 0x4E, 0xC0, 0xE1, 0xAD, 0xD1, 0x3B, 0x68, 0x48, 0xC2, 0x9D, 0xF8, 0xC5, 0xD6, 0xD4,
-    0xCF, 0x5E, 0x23, 0x04, 0x2A, 0x60, 0x72, 0x9A, 0xEF, 0x65, 0x4D, 0xFA, 0xFF, 0xFD, 0xBB, 0xAE,
-    0x6E, 0x0C, 0x6B, 0x30, 0xD9, 0xD3, 0x8F, 0xD2, 0x71, 0x1F, 0x2D, 0x69, 0x23, 0xBB, 0xAE, 0x33,
-    0xD9, 0xFF, 0x3C, 0x95, 0xB5, 0x3D, 0xF1, 0xAD, 0x83, 0xCD, 0x30, 0xEC, 0x5D, 0xCF, 0x0E, 0xDA,
-    0xDB, 0xDC, 0xB5, 0x07, 0x1E, 0xCB, 0xFC, 0x0D, 0xA4, 0x4B, 0x22, 0x5B, 0x75, 0xBB, 0x9B, 0x96,
-    0x52, 0x2B, 0x61, 0xAA, 0xDB, 0x7D, 0xBF, 0x17, 0x9B, 0x2C, 0xA5, 0x3B, 0x0C, 0x9D, 0x52, 0x8C,
-    0x2E, 0x1E, 0x6E, 0xD7, 0x5F, 0x82, 0xC0, 0x42, 0x34, 0xA3, 0xB5, 0x86, 0x5D, 0xD3, 0xF2, 0x19,
-    0x1A, 0x44, 0x69, 0x11, 0xD1, 0x2B, 0x66, 0xD2, 0x96, 0x30, 0x56, 0xA2, 0x54, 0xB2, 0x11, 0xD0,
-    0x59, 0x5D, 0xB0, 0x98, 0xDD, 0x63, 0xB1, 0x35, 0x9D, 0x29, 0x6B, 0x22, 0x37, 0x45, 0x21, 0x20,
-    0x95, 0x7A, 0x50, 0x8D, 0x45, 0x10, 0xCB, 0x36, 0xA0, 0x07, 0xCE, 0x95, 0x35, 0x3D, 0xA4, 0x73,
-    0x48, 0xF8, 0x1F, 0x93, 0x30, 0x84, 0x64, 0xF0, 0x37, 0xD6, 0x2E, 0x9F, 0xB5, 0x3B, 0x50, 0x2E,
-    0x46, 0xBD, 0x45, 0xA7, 0x04, 0xE2, 0xBD, 0x96, 0x9D, 0x7B, 0x72, 0x49, 0xDA, 0x92, 0xC7, 0x67,
-    0xEF, 0xB2, 0x3D, 0xA0, 0xCC, 0x80, 0xCE, 0x48, 0x7E, 0x55, 0x21, 0xE9, 0x9D, 0x12, 0x0D, 0x83,
-    0x2E, 0x82, 0xF4, 0x4D, 0xE9, 0xC8, 0x67, 0x2E, 0x1C, 0x65, 0x2F, 0x37, 0x9F, 0xF1, 0xF9, 0xCC,
-    0xFB, 0x92, 0x3F, 0x4E, 0xDD, 0x67, 0xBC, 0x05, 0xDC, 0xF9, 0x13, 0xC3, 0x83, 0x07, 0xD2, 0xF5,
-    0x6C, 0x20, 0x39, 0xF8, 0x2D, 0x16, 0xC5, 0xCC, 0xBB, 0x0E, 0x93, 0x6C, 0x7A, 0xB9, 0x5B, 0x91,
-    0xB2, 0xFB, 0x05, 0xE0, 0x88, 0xF4, 0x97, 0x39, 0x1A, 0x2D, 0xCF, 0xFD, 0xE4, 0x49, 0x35, 0xF5,
-    0x27, 0x0F, 0x53, 0x20, 0xBD, 0x69, 0xA5, 0x87, 0xD5, 0x65, 0x23, 0x3B, 0xEB, 0xF3, 0x3E, 0x51,
-    0xB4, 0x63, 0x62, 0x69, 0xD9, 0x4B, 0x0F, 0x66, 0x01, 0xF8, 0xE5, 0x6E, 0xE1, 0x94, 0xD2, 0xA7,
-    0xCF, 0xBC, 0x5C, 0x22, 0x14, 0xAC, 0xC7, 0x68, 0x29, 0xC9, 0x34, 0x2D, 0x40, 0x8A, 0x58, 0x0D,
-    0xE3, 0xC5, 0x4B, 0x27, 0xDA, 0x7E, 0x87, 0xD5, 0xA4, 0x71, 0xE1, 0xC5, 0xC5, 0xBE, 0x91, 0x0A,
-    0xFD, 0x99, 0x35, 0x2B, 0xF9, 0xD0, 0xDB, 0xCC, 0xCD, 0xC7, 0x51, 0x00, 0x62, 0xCA, 0x29, 0x89,
-    0xBA, 0x36, 0x2B, 0x90, 0xCF, 0x09, 0x5A, 0x63, 0x11, 0x95, 0x25, 0x41, 0x62, 0xEA, 0x3F, 0x57,
-    0x74, 0xFA, 0x64, 0xFC, 0x7D, 0x27, 0x23, 0xA4, 0x78, 0xA9, 0x75, 0x50, 0x75, 0xF1, 0xEF, 0x54,
-    0x48, 0x36, 0xC1, 0xAA, 0x0A, 0xFF, 0x85, 0xB8, 0xB7, 0x12, 0xA8, 0x12, 0x60, 0x81, 0xEA, 0x34,
-    0xD2, 0x81, 0x3E, 0xBE, 0x01, 0xC8, 0x3A, 0x87, 0x50, 0xE1, 0x25, 0xA5, 0x37, 0x44, 0x7A, 0x00,
-    0x92, 0xE6, 0x2D, 0x03, 0xE4, 0x30, 0xB7, 0xFD, 0x25, 0x32, 0x5D, 0xF6, 0x7B, 0xC2, 0xFF, 0x8D,
-    0xDA, 0x7F, 0x63, 0x09, 0xA2, 0xB6, 0xE5, 0x91, 0x8D, 0xC0, 0x0F, 0x5E, 0xD2, 0xD8, 0x54, 0x30,
-    0x1F, 0x63, 0x9F, 0x8E, 0xBE, 0xCB, 0x98, 0xEC, 0x00, 0x7B, 0xD2, 0xDC, 0xB7, 0x7E, 0x9A, 0x45,
-    0x8C, 0x0E, 0x6F, 0x13, 0xBA, 0xDD, 0x44, 0x61, 0x21, 0x60, 0xBC, 0xD7, 0x59, 0x19, 0xB6, 0x22,
-    0x82, 0x65, 0x4F, 0xAB, 0x6B, 0x35, 0x1A, 0xB4, 0xA9, 0xD0, 0x64, 0x96, 0xA2, 0xF0, 0x53, 0xFE,
-    0x35, 0xEA, 0xB2, 0xD4, 0x39, 0xE8, 0x66, 0xB1, 0x89, 0x83, 0x7B, 0xFE, 0x1F, 0x4D, 0x50, 0x41,
-    0x6B, 0x13, 0x41, 0x14, 0xFE, 0x36, 0x93, 0x10, 0x65, 0x21, 0x1B, 0x21, 0x01, 0x59, 0x6C, 0xD6,
-    0x83, 0x1E, 0x52, 0x12, 0xE2, 0xB1, 0x48, 0x92, 0x59, 0x2D, 0x52, 0xD0, 0x83, 0x39, 0x24, 0x1E,
-    0xC5, 0x63, 0x6F, 0x5E, 0x7A, 0x10, 0xDC, 0xED, 0xA6, 0x06, 0xF1, 0xA0, 0xA0, 0xFE, 0x00, 0xB5,
-    0x87, 0x1E, 0xD4, 0x83, 0x17, 0xC1, 0x93, 0x69, 0x52, 0x73, 0xCC, 0xA5, 0x52, 0xC4, 0x63, 0x57,
-    0x7A, 0x10, 0xEC, 0x21, 0x63, 0x5D, 0xDA, 0x95, 0xCE, 0xEE, 0x73, 0x36, 0x0D, 0xEA, 0xC7, 0xCC,
-    0xBC, 0x99, 0x8F, 0x79, 0xDF, 0xFB, 0xDE, 0x73, 0xB1, 0x0A, 0x0F, 0xC8, 0xB0, 0x07, 0xDB, 0x02,
-    0x40, 0x09, 0xD9, 0x40, 0x3B, 0xF6, 0x1D, 0xBD, 0x6B, 0x55, 0xE2, 0xF7, 0xAF, 0x1E, 0x16, 0xD0,
-    0xB9, 0x4A, 0x92, 0xC7, 0x5D, 0xA0, 0x5D, 0xA3, 0xC8, 0x7B, 0xFB, 0x06, 0x30, 0x16, 0x47, 0x24,
-    0x3C, 0x01, 0x1B, 0x65, 0x63, 0xF4, 0x53, 0x02, 0x75, 0xC7, 0x75, 0xFB, 0xFD, 0x85, 0xD3, 0x95,
-    0xBC, 0x95, 0xDB, 0x0B, 0x1D, 0x84, 0x29, 0x61, 0x75, 0x6B, 0xA9, 0x90, 0x25, 0x8A, 0x70, 0xF4,
-    0xB5, 0x63, 0x3F, 0x1B, 0x2A, 0x69, 0x05, 0x17, 0xA1, 0x2A, 0x28, 0x55, 0xC9, 0x28, 0x79, 0x0E,
-    0xB2, 0x82, 0xB3, 0xB0, 0x36, 0x7C, 0x6D, 0x3E, 0x8F, 0xAC, 0x4F, 0x21, 0x5F, 0x12, 0xF3, 0x3D,
-    0x59, 0x5B, 0x93, 0xC6, 0x76, 0xAC, 0xDF, 0xD8, 0x09, 0xAA, 0x1A, 0x16, 0x8C, 0x5E, 0xE0, 0xE7,
-    0x51, 0x6E, 0x19, 0xB4, 0x75, 0x4B, 0xA0, 0x0E, 0x03, 0x73, 0xA5, 0xAA, 0x73, 0x3E, 0x5D, 0x5D,
-    0x68, 0x9C, 0x42, 0x06, 0x82, 0x8F, 0xA4, 0x5A, 0x06, 0x5A, 0x28, 0x6C, 0x16, 0x60, 0x0E, 0x7A,
-    0x24, 0x8B, 0x1D, 0xE5, 0xEC, 0xD1, 0x81, 0xAC, 0xD7, 0x13, 0x5F, 0xC0, 0xD4, 0x95, 0x12, 0xE6,
-    0xBD, 0xC0, 0x33, 0xFC, 0xB4, 0xCE, 0xC4, 0x4B, 0x7E, 0xDD, 0x2E, 0x59, 0x37, 0x17, 0x23, 0xCF,
-    0x46, 0xB1, 0xA9, 0xB0, 0xEA, 0x45, 0x74, 0x34, 0xDE, 0xB5, 0xCA, 0x58, 0x6F, 0xD6, 0x6C, 0x1E,
-    0x80, 0xDB, 0xB8, 0x07, 0x5C, 0x80, 0xEA, 0x81, 0x0B, 0x76, 0x24, 0x9A, 0x29, 0xD1, 0xB8, 0x1C,
-    0x4D, 0xF8, 0x47, 0xC7, 0x24, 0x83, 0x7C, 0x60, 0x9E, 0x2C, 0xFA, 0xD2, 0xB1, 0x67, 0xE4, 0x80,
-    0x26, 0x24, 0xF2, 0xCE, 0x9C, 0xB3, 0xA2, 0xBA, 0x0A, 0xDD, 0xD0, 0xA5, 0x88, 0xA2, 0x4E, 0xDB,
-    0xFB, 0x4D, 0xDF, 0x97, 0x5E, 0x94, 0x54, 0xF0, 0x33, 0x77, 0x68, 0xE7, 0xFE, 0x93, 0x1F, 0x67,
-    0x70, 0xD1, 0x16, 0x06, 0x5B, 0x9E, 0x8D, 0x97, 0x3D, 0x7D, 0xF7, 0x0C, 0x2B, 0xAA, 0x2D, 0x0B,
-    0x19, 0x1B, 0xFF, 0xA0, 0x3F, 0xEE, 0xFD, 0x12, 0x52, 0xCE, 0x5C, 0x99, 0x83, 0xD1, 0xB4, 0x2B,
-    0xA0, 0x46, 0xEA, 0xA6, 0x62, 0xA3, 0xDA, 0x98, 0x01, 0x50, 0xD4, 0xB5, 0xBE, 0x16, 0x68, 0x49,
-    0xFE, 0x25, 0xBE, 0x39, 0x98, 0x1C, 0xC6, 0x1F, 0x24, 0xEB, 0x32, 0x5B, 0x57, 0xC3, 0xCA, 0xE1,
-    0x1C, 0xF2, 0x27, 0x9A, 0x29, 0xE5, 0x9A, 0x25, 0x5B, 0xFC, 0x2D, 0x93, 0x8D, 0x35, 0x69, 0xD1,
-    0x67, 0xC9, 0xC7, 0x87, 0x92, 0x6F, 0x51, 0x50, 0xBC, 0x6D, 0xDA, 0xCA, 0x0A, 0x60, 0x4E, 0x13,
-    0xC2, 0xB2, 0x77, 0xB0, 0x3F, 0x8E, 0x0A, 0xE6, 0x95, 0x8D, 0x82, 0xB7, 0xB7, 0xBF, 0xEB, 0x2E,
-    0x7B, 0x43, 0x6D, 0x03, 0x5A, 0x9A, 0x7D, 0x1D, 0xE6, 0x6D, 0x9C, 0xAD, 0xA4, 0x93, 0x6F, 0x4A,
-    0xF2, 0x5B, 0x80, 0xBB, 0x1A, 0xA9, 0xB1, 0x14, 0xDB, 0x40, 0xB1, 0x05, 0x83, 0x62, 0x4D, 0x51,
-    0x39, 0xA8, 0xFA, 0xFF, 0x61, 0x9D, 0x11, 0x51, 0x64, 0xA8, 0x23, 0x50, 0xAF, 0xEA, 0x09, 0xF9,
-    0x07, 0xA5, 0x5A, 0x4D, 0x8C, 0xDD, 0xD6, 0x75, 0x3E, 0x7C, 0xD7, 0x23, 0x36, 0x62, 0xEB, 0xAB,
-    0x02, 0x76, 0xDB, 0xC4, 0xB6, 0xB8, 0x49, 0x01, 0x27, 0x90, 0x86, 0x5D, 0x78, 0xA1, 0xC5, 0x7B,
-    0xEF, 0x52, 0x1E, 0x20, 0x02, 0x2A, 0xA0, 0x9A, 0x85, 0xDC, 0x2E, 0x02, 0x54, 0x5E, 0x64, 0xE1,
-    0xB8, 0x41, 0x94, 0x85, 0x50, 0xB8, 0xE9, 0x9B, 0x47, 0x4A, 0xB3, 0x10, 0x10, 0xB5, 0x90, 0xB2,
-    0x48, 0xBA, 0xE8, 0x42, 0x6E, 0x61, 0xA7, 0xC9, 0x38, 0xA8, 0x04, 0x44, 0x05, 0x26, 0xED, 0x9B,
-    0x21, 0xA5, 0x57, 0x40, 0x40, 0x06, 0x88, 0x28, 0x4D, 0x6D, 0x2D, 0x8C, 0x56, 0x94, 0x65, 0x47,
-    0x85, 0x0D, 0x54, 0x77, 0x2C, 0xDA, 0xA6, 0x46, 0x24, 0x4F, 0xBF, 0xC3, 0x37, 0x23, 0x8D, 0x1C,
-    0x29, 0x71, 0xD3, 0xF7, 0xC8, 0xE1, 0xCF, 0x23, 0x2F, 0x79, 0xEF, 0x39, 0xE7, 0x3B, 0xDF, 0x77,
-    0xEE, 0xE8, 0x94, 0x74, 0x46, 0x5E, 0x46, 0x1B, 0x1F, 0xC5, 0xAC, 0xB9, 0x34, 0x07, 0xA9, 0x24,
-    0x95, 0x93, 0x7E, 0x33, 0x36, 0x4C, 0x5C, 0xC9, 0x6E, 0x4C, 0xD1, 0xC2, 0x77, 0x99, 0x8F, 0x33,
-    0xFB, 0x5C, 0xE9, 0x8B, 0x99, 0x09, 0xC2, 0x6A, 0x79, 0xDB, 0x3F, 0xBE, 0xD6, 0xDE, 0xD6, 0x49,
-    0x70, 0x5B, 0x65, 0x5E, 0x9F, 0xAD, 0x48, 0x59, 0xD2, 0x6F, 0xE1, 0xB6, 0x10, 0xB7, 0x61, 0x37,
-    0x25, 0xB3, 0xF0, 0x2A, 0xF3, 0x45, 0xE6, 0x43, 0xDC, 0xC8, 0x95, 0xCC, 0x65, 0xC4, 0x9C, 0xBA,
-    0x29, 0xD1, 0x80, 0x48, 0x36, 0x4B, 0x44, 0x1E, 0xE7, 0x94, 0x70, 0xEA, 0xD9, 0x21, 0x8D, 0x3A,
-    0xD6, 0x4B, 0xFD, 0x76, 0x73, 0xA1, 0xA1, 0xA5, 0x20, 0x9D, 0xDA, 0x3B, 0x4B, 0x8F, 0x11, 0x9D,
-    0x23, 0x95, 0xD2, 0xF4, 0xE6, 0x7B, 0x92, 0x3C, 0x8E, 0xED, 0xE4, 0x71, 0x78, 0x06, 0xD1, 0x83,
-    0xBB, 0x85, 0xEC, 0xD2, 0xE1, 0x8C, 0x0C, 0xA7, 0x3A, 0x8F, 0x9C, 0xC2, 0x29, 0x02, 0x9A, 0x9A,
-    0x61, 0xC6, 0x09, 0x8B, 0xEE, 0xC8, 0x65, 0xAA, 0x56, 0x55, 0xC0, 0x1C, 0x33, 0x17, 0x2E, 0xDE,
-    0xCD, 0xE3, 0xB0, 0x6D, 0x79, 0x2A, 0x24, 0x9F, 0x53, 0xC5, 0x05, 0x2D, 0x3B, 0x6D, 0x2B, 0x15,
-    0xDE, 0xEF, 0x0E, 0xEE, 0xC0, 0xEF, 0x09, 0x13, 0xF9, 0x25, 0x51, 0x90, 0x2E, 0x76, 0x2A, 0x9F,
-    0x79, 0x9E, 0xD9, 0x6E, 0xE7, 0x77, 0xE5, 0x36, 0xA3, 0xC7, 0xB6, 0xDA, 0xF2, 0xC7, 0xC7, 0x98,
-    0xF6, 0xFB, 0x06, 0x9F, 0x8D, 0x91, 0xB5, 0x8F, 0xFA, 0xBA, 0x05, 0x75, 0x0A, 0x31, 0xC3, 0x96,
-    0x5E, 0x0C, 0xC9, 0x29, 0xC9, 0xCD, 0x29, 0x08, 0x31, 0x3C, 0xED, 0xA9, 0xD9, 0x48, 0x71, 0xA9,
-    0x39, 0x33, 0xB5, 0xBC, 0xA1, 0xBC, 0x9E, 0x23, 0x03, 0xDA, 0xF5, 0x42, 0xD2, 0x9D, 0x0C, 0x83,
-    0x73, 0x8E, 0x1C, 0xBB, 0x1B, 0x83, 0xEA, 0x71, 0xEC, 0x77, 0xB8, 0x72, 0xE3, 0xC5, 0xE0, 0xF9,
-    0x7C, 0x5A, 0xE5, 0x8B, 0xDE, 0xF7, 0x8B, 0x65, 0x9C, 0x30, 0x61, 0x52, 0x6E, 0x0F, 0xE9, 0xFE,
-    0xA7, 0x94, 0xB5, 0x93, 0x52, 0xA9, 0xEE, 0xAF, 0xCC, 0xEB, 0x18, 0x0F, 0x2E, 0x4A, 0xC5, 0x55,
-    0xA9, 0xB2, 0x11, 0xD6, 0xB9, 0x52, 0xBD, 0x87, 0x7D, 0x2E, 0xB1, 0xE6, 0x07, 0x37, 0xEE, 0x15,
-    0x13, 0x6E, 0xAE, 0xF2, 0x92, 0x14, 0xC4, 0xF7, 0x57, 0xC3, 0x32, 0xEE, 0x05, 0x99, 0xB4, 0x24,
-    0x13, 0x0F, 0xC8, 0x84, 0xB2, 0x8E, 0xB0, 0x3F, 0x59, 0x1D, 0x12, 0x5B, 0x3A, 0xB0, 0x42, 0x31,
-    0x19, 0x99, 0x86, 0xAA, 0x88, 0xFA, 0x26, 0xD4, 0xA7, 0x53, 0xF7, 0x56, 0xEA, 0xC0, 0x19, 0x22,
-    0x4B, 0x41, 0x41, 0x5E, 0x83, 0x8E, 0xE6, 0x24, 0x56, 0x33, 0x56, 0x8F, 0xD9, 0xB5, 0x51, 0xE1,
-    0x62, 0x5C, 0x87, 0x70, 0x1C, 0x4B, 0x5B, 0x3F, 0x4E, 0x41, 0xB3, 0x3D, 0x6A, 0x74, 0x1C, 0xCD,
-    0xE7, 0x26, 0x2F, 0xFD, 0xAA, 0xAF, 0x59, 0x5F, 0xBC, 0x35, 0xBE, 0xFD, 0x89, 0xAD, 0xEF, 0x54,
-    0xA6, 0x8A, 0x74, 0xE3, 0x5F, 0xE1, 0x7D, 0x45, 0x72, 0xA1, 0x0E, 0xB2, 0x24, 0x76, 0x28, 0x34,
-    0x67, 0xC2, 0xA4, 0xA2, 0x28, 0xDE, 0x6C, 0xE1, 0x49, 0x7A, 0x62, 0xCE, 0x29, 0x2A, 0xEF, 0x7C,
-    0xD9, 0x57, 0xB6, 0x70, 0x6F, 0xA6, 0xBA, 0x21, 0x5F, 0xFA, 0x40, 0x91, 0xB4, 0xAE, 0xE5, 0xD8,
-    0x58, 0x6A, 0x26, 0x4F, 0x53, 0x37, 0x33, 0x7D, 0x3A, 0xEC, 0xCF, 0xD1, 0x9D, 0x5F, 0xDA, 0xE5,
-    0x26, 0xE2, 0xF2, 0x8D, 0xF5, 0x53, 0x70, 0x6D, 0x9F, 0xE8, 0x25, 0xB8, 0x6A, 0x48, 0x1D, 0xF8,
-    0x90, 0xC9, 0xC8, 0xC5, 0xDD, 0xEB, 0x96, 0xFC, 0x03, 0x61, 0x07, 0xAE, 0x6B, 0xBC, 0xCC, 0xCD,
-    0x87, 0xE8, 0x9D, 0x85, 0x27, 0x1D, 0x63, 0xB1, 0x90, 0xBE, 0x8A, 0x27, 0xBC, 0xF0, 0x42, 0xC0,
-    0x2B, 0x6F, 0x3E, 0x6F, 0x69, 0x44, 0xFE, 0x1D, 0x97, 0xAF, 0xDB, 0xC1, 0xC0, 0x3D, 0xA4, 0x6E,
-    0x72, 0x81, 0x2B, 0xDE, 0xA5, 0x27, 0x43, 0x8F, 0xB3, 0xB3, 0xDA, 0xA3, 0x23, 0x67, 0xBD, 0xFD,
-    0x9C, 0x27, 0xA5, 0xF7, 0x42, 0x71, 0x56, 0xAD, 0x50, 0xF7, 0x5F, 0xCF, 0xAC, 0x70, 0x95, 0x34,
-    0x93, 0xDE, 0x30, 0x8F, 0x11, 0xC9, 0x0F, 0x09, 0x8C, 0xC9, 0x6E, 0x28, 0x4E, 0x4D, 0x5C, 0xC3,
-    0xD3, 0x33, 0xE7, 0xA3, 0x39, 0xF2, 0x55, 0xEE, 0xD8, 0xBE, 0x6C, 0x3A, 0xD8, 0x04, 0x93, 0xCD,
-    0x50, 0xE5, 0xC1, 0xBA, 0xB8, 0xB8, 0x44, 0xC9, 0x51, 0xEB, 0x14, 0xDB, 0xE9, 0x0B, 0x9B, 0x6D,
-    0x37, 0xFA, 0x4D, 0xEA, 0x8B, 0x0B, 0xA9, 0x8F, 0x5E, 0xD4, 0x9C, 0x02, 0x25, 0x5A, 0xC0, 0xF0,
-    0xDF, 0x7F, 0x2D, 0xE2, 0xEB, 0x6D, 0xB8, 0xC3, 0x42, 0xC9, 0x7C, 0x41, 0x4D, 0xF0, 0x4E, 0x45,
-    0xFA, 0x62, 0x51, 0x53, 0xA7, 0xAE, 0x97, 0x31, 0x0A, 0x49, 0x02, 0xE3, 0xB1, 0xC4, 0x1A, 0x02,
-    0x5E, 0xE2, 0x38, 0x95, 0xE3, 0xA2, 0x3D, 0x19, 0x23, 0x08, 0xB9, 0x84, 0xD9, 0x1B, 0x8E, 0x75,
-    0x1D, 0x1D, 0xAA, 0x60, 0xB5, 0x77, 0x38, 0x0D, 0x0A, 0x9F, 0xF7, 0x76, 0x2C, 0xF0, 0x22, 0x50,
-    0x80, 0xA3, 0x58, 0x06, 0xE6, 0x8B, 0xDE, 0x0A, 0x7F, 0xC8, 0xE5, 0xE1, 0x82, 0xE6, 0xE8, 0x09,
-    0x1D, 0x9A, 0xF9, 0xDC, 0xCF, 0x4B, 0x5D, 0xF6, 0x5D, 0xD6, 0xF3, 0x3C, 0x5E, 0xBB, 0x6B, 0xAB,
-    0xBA, 0x32, 0xC3, 0x48, 0xB3, 0x3F, 0xE6, 0xE3, 0x45, 0x72, 0xB9, 0x0E, 0x6C, 0xB2, 0xBF, 0x08,
-    0xF2, 0x29, 0x0A, 0xD5, 0xFB, 0x16, 0x98, 0x46, 0x5E, 0xF9, 0x80, 0x07, 0xFD, 0x1F, 0xDB, 0xD1,
-    0xE3, 0x52, 0xAD, 0x55, 0x54, 0xD6, 0xD4, 0x8F, 0xC8, 0x4F, 0xF0, 0xF6, 0xB1, 0x83, 0xAE, 0x24,
-    0x19, 0x05, 0x25, 0x3A, 0x15, 0x23, 0x7E, 0xA8, 0xC2, 0xC0, 0xE8, 0xCA, 0x3F, 0x8F, 0x31, 0x7E,
-    0xE1, 0xA0, 0x66, 0x0B, 0x2C, 0xAA, 0x8C, 0xB2, 0x15, 0xF0, 0xA1, 0xAF, 0xD3, 0xD2, 0xA8, 0xBC,
-    0xF2, 0x67, 0xEC, 0x9C, 0xBE, 0x50, 0x18, 0x93, 0x56, 0xB5, 0x12, 0x97, 0x36, 0xB1, 0x3F, 0xAE,
-    0x3A, 0x95, 0xC9, 0xCC, 0x98, 0xBD, 0xCA, 0x58, 0x8C, 0xF5, 0xE9, 0xAA, 0xCF, 0x77, 0xC7, 0x37,
-    0x9B, 0x51, 0xDF, 0xBC, 0x3D, 0xBE, 0x5D, 0x8D, 0x8C, 0x7F, 0x62, 0x0C, 0xE7, 0x30, 0x2D, 0x38,
-    0xC1, 0xAC, 0x81, 0x4E, 0xBD, 0x55, 0xDB, 0x29, 0x2A, 0x5A, 0x32, 0x64, 0x0E, 0xA4, 0x7A, 0xD5,
-    0xAA, 0xA2, 0x59, 0x68, 0x0C, 0xF3, 0x49, 0xE6, 0x1B, 0x18, 0xD1, 0x9A, 0x9A, 0x28, 0x34, 0xA7,
-    0x33, 0x6D, 0xE9, 0xF0, 0xBB, 0x18, 0xE3, 0x92, 0xF8, 0xEF, 0x4B, 0x17, 0x57, 0x19, 0x58, 0x09,
-    0xE6, 0x19, 0xE7, 0x64, 0xFC, 0x98, 0x2A, 0x03, 0xFF, 0xE0, 0x30, 0x82, 0xEB, 0x30, 0xAC, 0x51,
-    0xC0, 0x18, 0xF1, 0xB6, 0x09, 0xBA, 0xD1, 0x93, 0x2F, 0xCC, 0x4E, 0x7C, 0x2A, 0x9E, 0xEB, 0x3B,
-    0x45, 0xE9, 0xAE, 0xE6, 0xFE, 0x81, 0x2D, 0xBB, 0xE9, 0x9C, 0x71, 0x8A, 0x1F, 0x6E, 0x3B, 0x85,
-    0x2B, 0x93, 0xB2, 0xC3, 0xB5, 0x97, 0x8E, 0x02, 0x2A, 0x2A, 0x77, 0x95, 0xF9, 0x80, 0x20, 0x75,
-    0xDC, 0x9C, 0xBA, 0xE7, 0x7A, 0x35, 0xB9, 0xC5, 0x64, 0xC8, 0x83, 0x06, 0x18, 0xE6, 0x72, 0xAD,
-    0x8B, 0xC7, 0xFC, 0xF6, 0x27, 0x2C, 0x51, 0x28, 0x41, 0x69, 0xF2, 0x29, 0xC3, 0xB5, 0x8F, 0x86,
-    0xB8, 0x76, 0xB8, 0x06, 0xCC, 0x5C, 0x63, 0xFE, 0x04, 0xAE, 0x08, 0xDB, 0x0B, 0xDE, 0x20, 0x63,
-    0x01, 0x33, 0xD1, 0x94, 0xDC, 0x02, 0xE8, 0x54, 0x1B, 0x07, 0x31, 0xE9, 0x7C, 0x12, 0xA0, 0xAB,
-    0x36, 0x70, 0xB3, 0x52, 0x8F, 0x33, 0xFF, 0x34, 0x99, 0x92, 0xA2, 0x8C, 0x98, 0x9C, 0x8A, 0x5C,
-    0x81, 0x59, 0x1C, 0x03, 0xE1, 0x27, 0xF6, 0xEF, 0x70, 0xA3, 0x3E, 0xB8, 0xFB, 0x4E, 0x5A, 0x76,
-    0xCF, 0x0E, 0xB5, 0xCF, 0xB7, 0xD0, 0xC7, 0xCC, 0x00, 0x74, 0x80, 0x31, 0x78, 0x27, 0xC0, 0x0C,
-    0x6E, 0x22, 0xF8, 0xAC, 0x1F, 0x7B, 0x29, 0xEC, 0xED, 0x5A, 0x0C, 0xF8, 0xFE, 0x8C, 0xEA, 0xAA,
-    0x4D, 0x18, 0x26, 0x87, 0x5F, 0x93, 0x00, 0x03, 0x6C, 0xDE, 0x69, 0x6A, 0x8A, 0x0E, 0x58, 0x6D,
-    0x0D, 0x4C, 0xD8, 0x3C, 0x41, 0x61, 0xAF, 0x93, 0x6F, 0x59, 0x6C, 0x7F, 0xB2, 0xA8, 0x8D, 0xC5,
-    0xC8, 0xC0, 0xC8, 0xD2, 0x42, 0xB1, 0xBC, 0xCD, 0x0E, 0x67, 0xA7, 0x73, 0x33, 0xFC, 0x69, 0x36,
-    0x7D, 0xD6, 0xFB, 0xB1, 0xFA, 0xE0, 0x58, 0xCD, 0x6C, 0xEE, 0x9E, 0xFF, 0xAE, 0x38, 0xBE, 0x8F,
-    0x4C, 0xF9, 0x04, 0x4D, 0xE9, 0xE3, 0xAB, 0x37, 0xAE, 0x17, 0x65, 0x39, 0xD7, 0xEF, 0xFB, 0x07,
-    0x4E, 0xCE, 0xAF, 0xDE, 0xC8, 0x71, 0xD0, 0xEB, 0xF7, 0x35, 0x0E, 0xAE, 0xE0, 0x60, 0x91, 0x59,
-    0xCC, 0xFE, 0x9D, 0x85, 0x85, 0x53, 0xFD, 0xED, 0x3A, 0xC6, 0x75, 0x0A, 0x97, 0xE3, 0xAE, 0x1C,
-    0x97, 0xC4, 0x45, 0xAF, 0xAF, 0x32, 0x1C, 0xCE, 0xAC, 0xE6, 0xBD, 0xF6, 0x70, 0x1A, 0xE9, 0xBE,
-    0xD1, 0x82, 0x3C, 0x00, 0x21, 0x92, 0x1C, 0x2F, 0x41, 0x4D, 0xAF, 0xE2, 0xC0, 0xE0, 0xAD, 0x74,
-    0x8B, 0xD3, 0x84, 0x5F, 0x90, 0x74, 0x90, 0x7A, 0x14, 0x06, 0xC0, 0x06, 0xD4, 0x3B, 0x9C, 0xCA,
-    0x01, 0x67, 0xAD, 0xF7, 0x21, 0x39, 0x8E, 0x63, 0xEA, 0x58, 0x5C, 0x35, 0xEA, 0xC2, 0x36, 0x5A,
-    0x4E, 0xA4, 0x38, 0x81, 0x98, 0x1E, 0x21, 0x67, 0x06, 0x07, 0x94, 0xF5, 0x56, 0xD3, 0x51, 0xA7,
-    0xF8, 0x28, 0xA1, 0x65, 0x9C, 0x30, 0x27, 0x39, 0xD4, 0xF9, 0xB3, 0xD2, 0x74, 0x77, 0xE3, 0x8F,
-    0x8C, 0xF8, 0x4C, 0x5A, 0x75, 0xBD, 0xF1, 0x5B, 0x78, 0x95, 0x19, 0xB4, 0x9C, 0x9C, 0x22, 0x64,
-    0xB7, 0xDA, 0xCB, 0x47, 0x34, 0xF7, 0x24, 0x5E, 0x0C, 0x59, 0x5B, 0xCB, 0x40, 0xE1, 0x79, 0xFA,
-    0x52, 0xEE, 0xC3, 0xA9, 0x8B, 0x08, 0x34, 0x04, 0x08, 0x16, 0x6D, 0x86, 0xB1, 0xB7, 0x97, 0xE3,
-    0x73, 0x11, 0x7B, 0x07, 0xCE, 0x17, 0xFF, 0x62, 0xBD, 0x13, 0x4C, 0x83, 0x24, 0x57, 0x2B, 0x0D,
-    0x80, 0xD1, 0xBA, 0x2B, 0xFE, 0x5B, 0xE5, 0x59, 0xE6, 0xFD, 0x2E, 0xE7, 0x67, 0x9F, 0x2A, 0xC4,
-    0x47, 0x91, 0xCF, 0xBC, 0x74, 0xD1, 0x8B, 0x47, 0x3A, 0x1E, 0xC1, 0x59, 0x5D, 0xAE, 0x90, 0x22,
-    0x11, 0xB4, 0xDE, 0xF9, 0x4A, 0xA7, 0x88, 0xD9, 0xDA, 0xB4, 0xCB, 0x46, 0xB6, 0x5B, 0xF4, 0x79,
-    0x9C, 0x55, 0x7B, 0xDC, 0x8B, 0x61, 0xF7, 0x08, 0x7C, 0xBA, 0x0E, 0x00, 0xBC, 0xC3, 0xF6, 0xA7,
-    0x59, 0x3A, 0x8C, 0xD6, 0x3C, 0x4E, 0x87, 0xA4, 0xD6, 0xC2, 0x36, 0xC8, 0x6D, 0xA3, 0x6F, 0x58,
-    0xFF, 0x64, 0x3A, 0x0C, 0x8E, 0x97, 0x08, 0xF9, 0x04, 0xEF, 0x18, 0x73, 0xBE, 0xBE, 0x68, 0xBB,
-    0xEB, 0x25, 0x97, 0x76, 0x7A, 0x3D, 0xE1, 0x06, 0x1C, 0x0B, 0xD1, 0x54, 0xF5, 0x05, 0x90, 0xCD,
-    0x83, 0x7F, 0x5A, 0x88, 0x2D, 0x64, 0xF9, 0xB8, 0x70, 0xD6, 0x8A, 0xCE, 0x5A, 0xA1, 0xD6, 0x0A,
-    0xEF, 0x72, 0x01, 0x1B, 0x19, 0x6E, 0x82, 0x85, 0x25, 0x5F, 0x88, 0x93, 0xB8, 0x5D, 0x53, 0xF6,
-    0x7F, 0x1F, 0x50, 0x3C, 0x7C, 0x7D, 0x9F, 0xE4, 0xDB, 0xEB, 0xDC, 0x74, 0x38, 0x74, 0xF3, 0x46,
-    0x67, 0xAA, 0x60, 0xE4, 0xE1, 0x6A, 0x19, 0xA3, 0x35, 0x5C, 0x42, 0x1F, 0x02, 0x44, 0x3C, 0x0C,
-    0x68, 0x05, 0x64, 0xB3, 0x09, 0xDB, 0x22, 0xF1, 0x3B, 0x07, 0x81, 0x1E, 0x7A, 0x35, 0x47, 0x59,
-    0x80, 0x3B, 0x4A, 0x3F, 0xFB, 0x7E, 0xAA, 0xF6, 0x7E, 0x43, 0xDB, 0xCE, 0xE5, 0x3F, 0x3B, 0x59,
-    0x07, 0x79, 0x57, 0x59, 0x1B, 0x8C, 0x53, 0xD6, 0xBA, 0xEA, 0x2D, 0xDB, 0x4F, 0x6E, 0x8E, 0xD9,
-    0xD7, 0xC5, 0xC0, 0x9C, 0x47, 0x5C, 0x8B, 0xED, 0x77, 0x3C, 0x16, 0x9C, 0x39, 0x0E, 0x0A, 0xB0,
-    0x99, 0x42, 0xF3, 0x2F, 0xEE, 0x09, 0x1E, 0xD7, 0xE3, 0x15, 0x7B, 0x7B, 0xD4, 0xBF, 0x76, 0xE0,
-    0xF6, 0x6A, 0x51, 0x54, 0x7D, 0x78, 0xDC, 0x4A, 0xDA, 0xB3, 0x4A, 0xC6, 0xC0, 0x2D, 0x29, 0xB1,
-    0xDE, 0xE9, 0xAC, 0x8C, 0xE2, 0x6D, 0x0B, 0x1E, 0x0C, 0x85, 0xAF, 0x6E, 0x3F, 0xBE, 0xF1, 0x9F,
-    0x9D, 0x12, 0x3C, 0xA0, 0xD2, 0x1C, 0x2D, 0xCD, 0xB8, 0x34, 0xAB, 0x95, 0xF9, 0x00, 0xB0, 0x37,
-    0xEA, 0x61, 0x59, 0x1E, 0xF5, 0x7A, 0xA3, 0xFE, 0x1F, 0x08, 0x0D, 0x8B, 0x7B, 0x8B, 0xEA, 0xED,
-    0xB4, 0x37, 0x92, 0x3F, 0xCB, 0x6F, 0x5C, 0xC3, 0x38, 0xF2, 0xAD, 0x74, 0x58, 0xB9, 0x79, 0x07,
-    0x28, 0x01, 0xD0, 0xBE, 0x9A, 0xF6, 0x07, 0xEA, 0xF6, 0x47, 0x70, 0xB3, 0xCB, 0x5C, 0x62, 0x84,
-    0x60, 0x0C, 0xA0, 0x56, 0x1E, 0xC0, 0xC8, 0x88, 0xBC, 0xD2, 0xDB, 0xB2, 0x2B, 0xD8, 0x09, 0x5E,
-    0xE9, 0x27, 0xA9, 0x5E, 0xB7, 0x3A, 0xDB, 0xA3, 0xD3, 0xAE, 0x2C, 0x59, 0x57, 0x37, 0x60, 0x76,
-    0xC8, 0x38, 0x59, 0x30, 0x25, 0xEE, 0x66, 0x5A, 0xBA, 0xF1, 0xF5, 0xB6, 0x87, 0xC9, 0x5E, 0xCE,
-    0x6B, 0x38, 0xAC, 0x2F, 0x30, 0x52, 0xBF, 0xE8, 0xB3, 0x93, 0xC0, 0x33, 0x4B, 0xE6, 0xEB, 0x48,
-    0xF6, 0x01, 0x02, 0x00, 0x6E, 0x4F, 0x5E, 0xBB, 0x5B, 0x6D, 0x98, 0xB2, 0x47, 0xE5, 0x48, 0x65,
-    0xA5, 0xDF, 0x01, 0xA5, 0xBA, 0x9D, 0x79, 0x4C, 0xBA, 0xA4, 0x60, 0x83, 0xEA, 0x79, 0x72, 0x0C,
-    0x9A, 0xB3, 0x2C, 0xDE, 0x0B, 0xB6, 0xCA, 0xB9, 0x7F, 0xEB, 0xD6, 0x38, 0x2B, 0xFA, 0x5D, 0xFD,
-    0xFC, 0x8D, 0xB4, 0xE8, 0x9B, 0x03, 0x5F, 0xBD, 0xCC, 0xE2, 0x98, 0x4D, 0xCB, 0x94, 0xC0, 0x23,
-    0x64, 0x33, 0xD5, 0x8E, 0x93, 0x3E, 0x66, 0xDD, 0xAB, 0x59, 0x07, 0xC9, 0x10, 0x94, 0xB4, 0x01,
-    0x8A, 0xC5, 0xA0, 0x05, 0xFE, 0xD8, 0x9A, 0xE7, 0x25, 0xB3, 0xF7, 0x55, 0xBE, 0x75, 0x99, 0x20,
-    0xD0, 0x04, 0x6C, 0xBE, 0xB0, 0x30, 0x01, 0x9B, 0x62, 0xC7, 0x8E, 0xEC, 0x86, 0xFA, 0x9B, 0xC7,
-    0x9F, 0x5B, 0xE4, 0xFC, 0x07, 0xF1, 0xE3, 0xB4, 0x07, 0x80, 0x71, 0x72, 0x03, 0x5E, 0x36, 0x10,
-    0x65, 0xF5, 0xD1, 0x88, 0x32, 0x3F, 0x41, 0x14, 0x5C, 0xA9, 0x70, 0xCD, 0x26, 0x84, 0x2C, 0x2C,
-    0x9C, 0x89, 0xDB, 0xE1, 0x02, 0x61, 0x22, 0x27, 0xFC, 0xBD, 0x54, 0xC1, 0xC7, 0x52, 0x7A, 0x9A,
-    0x9C, 0xF7, 0xC8, 0xAF, 0x9D, 0xCB, 0xF9, 0x33, 0x1A, 0xE4, 0x4E, 0x08, 0xF4, 0x76, 0x40, 0xCB,
-    0x45, 0xA2, 0x35, 0x84, 0xFF, 0xB7, 0x48, 0xEF, 0x9C, 0x55, 0x17, 0x99, 0xD6, 0xAE, 0xE4, 0xBD,
-    0x23, 0x7B, 0xF4, 0xA1, 0x46, 0x5D, 0x6D, 0xA4, 0xA3, 0xA9, 0x8B, 0x3B, 0xBF, 0xBD, 0x97, 0xAF,
-    0xEE, 0xFB, 0x4F, 0x1D, 0xDD, 0x41, 0x4F, 0xD1, 0xC6, 0x36, 0x95, 0x09, 0x1A, 0x0A, 0xF8, 0xAC,
-    0x85, 0xA3, 0xA4, 0x42, 0x12, 0xCF, 0x93, 0x99, 0x13, 0xFC, 0x27, 0x5D, 0xDD, 0xCF, 0x76, 0x71,
-    0xF8, 0x93, 0xFF, 0x51, 0x3F, 0x37, 0xC9, 0x1E, 0x2E, 0xB2, 0x24, 0x04, 0xA5, 0x8B, 0x4A, 0xAD,
-    0x8E, 0xE6, 0x5D, 0x5F, 0xA5, 0x88, 0x6C, 0x86, 0xE3, 0x1A, 0x6F, 0x6C, 0xEB, 0x44, 0x67, 0x5E,
-    0x2C, 0x26, 0x58, 0x7A, 0x80, 0x00, 0x3C, 0x22, 0xA2, 0xF4, 0x81, 0xB0, 0x2C, 0xFD, 0xD3, 0xF1,
-    0xFD, 0x0B, 0x83, 0x4C, 0xDF, 0x9A, 0xBF, 0x3E, 0x30, 0x7C, 0xF3, 0xFD, 0x83, 0x73, 0x40, 0xAF,
-    0xC6, 0xE7, 0x3C, 0x28, 0x1C, 0x41, 0x40, 0x72, 0x92, 0xBC, 0x83, 0xD0, 0x85, 0x1F, 0x50, 0x53,
-    0xB7, 0xEA, 0xE3, 0x72, 0xA1, 0xF2, 0x9D, 0x48, 0x1C, 0x29, 0xDC, 0xCE, 0x8F, 0x47, 0x48, 0x20,
-    0x47, 0xAB, 0x08, 0xCC, 0xDE, 0x92, 0x7B, 0x0A, 0xAA, 0x46, 0x53, 0x27, 0xA7, 0x27, 0xE8, 0x57,
-    0xC1, 0x41, 0xA7, 0x74, 0xD6, 0x6D, 0xD7, 0x9D, 0x7F, 0x33, 0x8C, 0x40, 0xEB, 0xA9, 0xB7, 0x6D,
-    0x9E, 0xE1, 0xA2, 0xE1, 0xCB, 0x92, 0x6D, 0x83, 0x42, 0xBF, 0x01, 0x84, 0x86, 0x40, 0xF1, 0x90,
-    0xDC, 0xF2, 0x06, 0xC6, 0x3A, 0x9F, 0x48, 0x0A, 0x9C, 0x5B, 0x5A, 0xFE, 0x11, 0xE4, 0x81, 0x7C,
-    0x06, 0x83, 0xB9, 0x39, 0xEC, 0xE2, 0xEF, 0x52, 0xDB, 0x63, 0x95, 0x6E, 0x7E, 0x5D, 0xF9, 0x66,
-    0x70, 0xE6, 0x57, 0xDD, 0x34, 0xD8, 0xE8, 0x1C, 0x2D, 0x76, 0x72, 0x2F, 0x9E, 0xA6, 0x73, 0x9D,
-    0x4C, 0x87, 0x3D, 0xB2, 0x26, 0x65, 0xC9, 0xD7, 0x53, 0x5F, 0xA3, 0xA0, 0xA2, 0xA7, 0x77, 0xC9,
-    0xB2, 0x2B, 0xB0, 0xBB, 0x76, 0x8F, 0x76, 0xED, 0xEA, 0x76, 0xA7, 0x47, 0x8B, 0x81, 0x7D, 0x11,
-    0xB1, 0xBF, 0x43, 0xC5, 0xE9, 0xE3, 0x8A, 0x7A, 0xDF, 0x04, 0x3D, 0xBC, 0x11, 0xDF, 0xFC, 0x2F,
-    0xB5, 0xEF, 0x95, 0xC7, 0x97, 0x40, 0xC5, 0x3F, 0xFB, 0xA8, 0x38, 0x00, 0x5E, 0xC0, 0xA9, 0x16,
-    0x61, 0xD0, 0x93, 0xB7, 0x5C, 0xCD, 0xBB, 0x23, 0x75, 0x0D, 0xBC, 0x19, 0xC0, 0x11, 0xC1, 0xBD,
-    0xE9, 0xA7, 0xB5, 0x3E, 0x8E, 0x3B, 0x24, 0xF9, 0xBB, 0xF9, 0x3D, 0xC5, 0x0A, 0x8E, 0xD5, 0xA9,
-    0xBA, 0xDA, 0x82, 0x2A, 0xBD, 0x7D, 0x4B, 0x0F, 0x07, 0x66, 0xCD, 0xF2, 0xBE, 0x71, 0x25, 0x9C,
-    0x44, 0x98, 0xC0, 0x8E, 0x30, 0xE0, 0x38, 0x02, 0xD3, 0x3F, 0xB5, 0xC5, 0xD4, 0x9F, 0x35, 0x2A,
-    0xC9, 0xEE, 0xDC, 0xFA, 0x05, 0xDE, 0x34, 0x2A, 0x56, 0x90, 0x0F, 0xF2, 0xE0, 0x0C, 0x2A, 0x08,
-    0x02, 0x28, 0xC5, 0x0E, 0xA8, 0x2F, 0x84, 0x8A, 0x12, 0xC9, 0x0B, 0xD0, 0xEC, 0x29, 0xAE, 0x91,
-    0x4D, 0x84, 0x64, 0x7E, 0x59, 0x9E, 0x2A, 0xBF, 0xB6, 0x0B, 0x3A, 0x2E, 0x3B, 0xE0, 0x42, 0x72,
-    0x65, 0x4F, 0xD9, 0xE9, 0xCE, 0x3A, 0xA4, 0x19, 0xB0, 0xAB, 0xA2, 0x97, 0x5F, 0xDB, 0xBE, 0xB0,
-    0xF0, 0x1A, 0x22, 0xA9, 0x94, 0x55, 0x95, 0xBE, 0x75, 0x6A, 0x11, 0x1F, 0xDC, 0x66, 0x5F, 0x20,
-    0x75, 0xAC, 0x3E, 0xF9, 0x20, 0x75, 0x11, 0x93, 0x7A, 0xFC, 0x8E, 0xD5, 0xF3, 0xD7, 0x8B, 0x60,
-    0x26, 0xAF, 0x82, 0x7D, 0xD9, 0x52, 0xAB, 0x86, 0x71, 0x97, 0x30, 0x31, 0x07, 0x2C, 0x04, 0x50,
-    0x30, 0x97, 0xEB, 0xAE, 0xDD, 0xD9, 0x3D, 0xD7, 0xEB, 0x0E, 0xDC, 0x02, 0xA4, 0xF9, 0xF8, 0x95,
-    0xBB, 0x1F, 0xC1, 0xF9, 0x2B, 0xE3, 0x36, 0xDB, 0xF8, 0x8E, 0xC8, 0xD8, 0xE4, 0x8C, 0x35, 0x61,
-    0xE3, 0xC7, 0xFE, 0x4A, 0xAE, 0x3E, 0x2C, 0xA9, 0x4A, 0x28, 0xF2, 0xDF, 0x13, 0xE6, 0x97, 0x27,
-    0x6C, 0x3D, 0xD8, 0xEA, 0x70, 0x4E, 0xDE, 0x65, 0x1B, 0xDD, 0xBC, 0x70, 0x93, 0xF5, 0x09, 0x9C,
-    0xC1, 0x9B, 0xA8, 0x7C, 0xE8, 0x53, 0x39, 0x50, 0xB6, 0x3E, 0x3C, 0xCF, 0x35, 0x72, 0x69, 0xA7,
-    0xCD, 0x8F, 0x4F, 0x89, 0xD7, 0x00, 0x4E, 0xFD, 0x1C, 0x54, 0x32, 0x05, 0xA5, 0xCC, 0xBD, 0x1C,
-    0x8E, 0x0B, 0xFE, 0x0B, 0x72, 0xB6, 0x4C, 0x1E, 0x1E, 0xE4, 0x54, 0xB8, 0xC0, 0x9C, 0x44, 0x93,
-    0x77, 0x45, 0xB7, 0x4A, 0x22, 0x6F, 0xA8, 0x25, 0x50, 0x42, 0x9A, 0x85, 0x45, 0x4D, 0x3E, 0xD0,
-    0xF7, 0x73, 0x5D, 0xB2, 0xD3, 0x4E, 0xEE, 0xAB, 0x4C, 0xEF, 0x4B, 0xBD, 0x4B, 0xB1, 0xBA, 0x15,
-    0x82, 0xF4, 0x77, 0x9A, 0x96, 0xDF, 0x3D, 0x4B, 0xDD, 0x2F, 0xA3, 0x1B, 0x80, 0xE0, 0xAE, 0xF0,
-    0x12, 0x57, 0x08, 0x29, 0xA0, 0xE7, 0xE1, 0x22, 0x47, 0xEE, 0xD8, 0xC8, 0xA7, 0xC0, 0x0C, 0x5C,
-    0x0B, 0x8C, 0x12, 0xA6, 0xFB, 0xE9, 0x20, 0xBB, 0x57, 0x50, 0x90, 0x25, 0x95, 0x5B, 0xC1, 0x2E,
-    0xB0, 0x4C, 0xF6, 0xEF, 0x2F, 0x99, 0x2C, 0xDB, 0x7F, 0xE4, 0xF3, 0x4E, 0x4A, 0xEA, 0xE0, 0xA0,
-    0x4F, 0x93, 0xEF, 0xA6, 0xDA, 0xF2, 0xB6, 0xA4, 0x00, 0xE0, 0x01, 0xDB, 0x65, 0xEF, 0x8A, 0xD5,
-    0x27, 0xD2, 0x69, 0x43, 0x65, 0x65, 0x56, 0x2D, 0x4F, 0xED, 0x0D, 0x59, 0xFD, 0x87, 0xA6, 0x6E,
-    0xC8, 0xAB, 0xE3, 0x4B, 0x6E, 0x77, 0xF0, 0x21, 0xB2, 0xA8, 0x2A, 0x22, 0x0B, 0xF5, 0x00, 0xE7,
-    0x85, 0xC6, 0xBC, 0x21, 0x69, 0x5B, 0x5F, 0xAA, 0x30, 0x3E, 0x41, 0x72, 0xAB, 0x4D, 0xD2, 0xDC,
-    0x8A, 0x6D, 0xE1, 0xCB, 0x89, 0x20, 0xA0, 0x6A, 0x4F, 0xB4, 0xA7, 0xB1, 0x8B, 0xBF, 0xD1, 0xCD,
-    0x8F, 0x91, 0xF4, 0xD9, 0x5F, 0xE5, 0x30, 0xB1, 0xD1, 0x8C, 0x5C, 0xD3, 0x2A, 0x6B, 0xA4, 0xFA,
-    0x16, 0xB1, 0x3E, 0x4F, 0xDA, 0x5F, 0xCD, 0x7C, 0xF3, 0x4D, 0xEA, 0xD5, 0x76, 0x52, 0xC3, 0x28,
-    0x91, 0x2D, 0x80, 0x3F, 0xF0, 0xD7, 0xF5, 0x4F, 0xAC, 0x39, 0xB1, 0x82, 0xC6, 0x15, 0xAE, 0xFC,
-    0x6D, 0x7A, 0xA8, 0xCE, 0xD2, 0x1B, 0x3A, 0xCB, 0xB1, 0x2D, 0xED, 0xD8, 0xC2, 0x11, 0xF6, 0x9D,
-    0xAC, 0x4D, 0xB6, 0x07, 0xE3, 0x7D, 0x44, 0xA7, 0xCF, 0x92, 0x77, 0x01, 0xDC, 0x1C, 0x0A, 0x76,
-    0x25, 0x17, 0x6E, 0xAC, 0x01, 0xBF, 0xE0, 0x1B, 0xBE, 0x70, 0x8C, 0x58, 0x4A, 0x26, 0x1D, 0x1C,
-    0x05, 0x70, 0x7F, 0xBC, 0xAD, 0x39, 0x50, 0x43, 0x79, 0x34, 0x93, 0xF7, 0xDC, 0x29, 0x1C, 0x6A,
-    0xD7, 0x40, 0x5D, 0x0A, 0xFB, 0x56, 0x89, 0xC3, 0x00, 0x6B, 0xA2, 0xDC, 0x3B, 0x93, 0x2E, 0x26,
-    0x6D, 0xE2, 0x88, 0x1F, 0x43, 0x22, 0x09, 0x30, 0xF2, 0x01, 0x7C, 0xAC, 0x0F, 0x2D, 0xDE, 0x3F,
-    0xD2, 0x50, 0xFF, 0x2F, 0x2B, 0xEA, 0x27, 0x85, 0xA4, 0xF7, 0xB6, 0xD0, 0x30, 0xFC, 0xB7, 0x9A,
-    0x86, 0xE7, 0x38, 0x9C, 0x03, 0xCD, 0x5F, 0xC2, 0xD3, 0xBE, 0x0E, 0x33, 0xFD, 0x16, 0xD1, 0x33,
-    0x8E, 0xDD, 0x3D, 0x93, 0xEE, 0xBE, 0x14, 0x4F, 0xDF, 0x92, 0x18, 0xEA, 0x71, 0xD8, 0x5B, 0xC9,
-    0xBB, 0x1D, 0xE8, 0xAF, 0x52, 0xD7, 0x95, 0x53, 0x6F, 0x68, 0xB7, 0xF0, 0x57, 0x6B, 0x37, 0xD8,
-    0x15, 0xC7, 0x67, 0xFE, 0x1B, 0xEC, 0x43, 0x18, 0xB2, 0xFE, 0xE3, 0x50, 0x47, 0xA4, 0xD1, 0xC5,
-    0xA2, 0x5D, 0x44, 0x43, 0xC7, 0xFE, 0xE1, 0xDC, 0xDF, 0x5F, 0x41, 0x28, 0xCF, 0x33, 0x44, 0xA1,
-    0x3E, 0x99, 0x49, 0xCB, 0x0E, 0x7C, 0xDD, 0x95, 0xDE, 0x8B, 0x80, 0xC8, 0x24, 0x45, 0x4B, 0xE3,
-    0x02, 0x02, 0xD2, 0x3A, 0x94, 0x56, 0x2A, 0xCD, 0xF3, 0xC9, 0xA3, 0xDF, 0x1C, 0xD0, 0x5F, 0x67,
-    0xF0, 0x70, 0xCF, 0x4A, 0x1C, 0xE1, 0xA7, 0x6B, 0x99, 0xF6, 0xB3, 0x21, 0x19, 0x17, 0x71, 0xB4,
-    0x65, 0x63, 0x95, 0x8D, 0xC8, 0x78, 0xEB, 0x6F, 0xD8, 0x04, 0xEE, 0x86, 0x7C, 0x8B, 0xCD, 0x7E,
-    0xEB, 0x16, 0x88, 0xDD, 0x13, 0xD6, 0xAD, 0x26, 0x6C, 0xBD, 0x7B, 0x4E, 0x7B, 0xB1, 0x5D, 0xD4,
-    0xFB, 0xE3, 0x62, 0xE9, 0xD0, 0x7E, 0x2E, 0x12, 0xDE, 0x9F, 0x96, 0xE2, 0xD7, 0x4F, 0x13, 0xC5,
-    0xD0, 0x2E, 0x0C, 0x9D, 0x98, 0xB0, 0xE8, 0x45, 0x38, 0xB5, 0xD7, 0xAA, 0x21, 0xA9, 0x06, 0x48,
-    0xA8, 0x48, 0xD5, 0xEC, 0xFD, 0x33, 0x02, 0x53, 0x42, 0x2B, 0x58, 0x8A, 0x2F, 0x20, 0x8E, 0x3A,
-    0x83, 0xA4, 0x82, 0x7C, 0x8C, 0x9D, 0x5A, 0xB8, 0x46, 0x57, 0xF1, 0x38, 0xED, 0x1D, 0xEC, 0xBA,
-    0x48, 0x1F, 0x03, 0xEA, 0x61, 0x83, 0xD1, 0x11, 0x60, 0x7B, 0x6F, 0x24, 0x47, 0x1B, 0xB1, 0x04,
-    0x3F, 0x43, 0x04, 0xA1, 0x39, 0xF8, 0x41, 0x05, 0xA5, 0x05, 0x5C, 0x88, 0x37, 0x77, 0x38, 0x03,
-    0xD1, 0xE6, 0x03, 0xA9, 0xC9, 0x2A, 0x9C, 0x71, 0x2F, 0xA5, 0x26, 0xEC, 0x55, 0x6E, 0x81, 0x9D,
-    0xE8, 0x78, 0x55, 0xB9, 0x65, 0xF4, 0x95, 0xF0, 0x4B, 0x7B, 0xC3, 0x49, 0x95, 0x09, 0x4F, 0xC6,
-    0x0B, 0x0D, 0xBC, 0x9C, 0xE6, 0xEE, 0xAD, 0x76, 0x63, 0xE5, 0x1C, 0x2B, 0xF0, 0xBA, 0x58, 0x02,
-    0xE7, 0xEA, 0x63, 0x0D, 0x26, 0xDB, 0x71, 0x8D, 0xB5, 0x22, 0xA9, 0x1B, 0xD2, 0x06, 0x34, 0x99,
-    0xB5, 0x65, 0x0A, 0xD6, 0xD9, 0xFA, 0xE7, 0x8B, 0xA1, 0x97, 0x16, 0xDE, 0x3C, 0x60, 0x5A, 0xE0,
-    0xDF, 0xF6, 0xDD, 0x2B, 0xA5, 0x4E, 0x1B, 0x3E, 0x56, 0x1B, 0xA1, 0xEE, 0x82, 0x6A, 0xE8, 0xF2,
-    0x53, 0x1B, 0xB9, 0x02, 0x89, 0x0B, 0x11, 0x59, 0x0E, 0xCB, 0x41, 0x57, 0x4F, 0x6B, 0xB5, 0x32,
-    0x3F, 0xBE, 0x5C, 0xDC, 0x15, 0xA6, 0x73, 0x0C, 0x1D, 0x74, 0xC2, 0x47, 0x6A, 0x58, 0x59, 0x36,
-    0x35, 0xAC, 0x96, 0x36, 0x6B, 0xA9, 0xB5, 0xFC, 0xF3, 0x44, 0xE4, 0xFD, 0x32, 0x8B, 0xDC, 0xC6,
-    0x71, 0x45, 0x2F, 0xD1, 0x16, 0x91, 0xBB, 0xB4, 0x55, 0xE4, 0x2E, 0x6D, 0x15, 0xB9, 0x4D, 0x8B,
-    0x96, 0x7A, 0x53, 0x9D, 0x45, 0xB8, 0xC5, 0xEE, 0x44, 0xAC, 0x23, 0x96, 0x26, 0x2A, 0x11, 0x72,
-    0xD5, 0x43, 0xC8, 0x18, 0xD2, 0x17, 0x8A, 0x4E, 0x29, 0x78, 0xBC, 0x2C, 0x70, 0x5C, 0x51, 0x00,
-    0x6E, 0x86, 0x78, 0xD1, 0x68, 0x21, 0x4A, 0x49, 0xD4, 0x2F, 0xDE, 0x71, 0x73, 0x53, 0xD1, 0x5C,
-    0xC7, 0x56, 0x20, 0x95, 0x73, 0x0A, 0xA0, 0x75, 0x29, 0x0E, 0x46, 0xA2, 0x69, 0x11, 0x17, 0x0F,
-    0x00, 0xEB, 0x96, 0x46, 0x97, 0xBC, 0x5C, 0x4A, 0x07, 0xE6, 0x30, 0x42, 0x47, 0xC4, 0x2F, 0xA2,
-    0x80, 0x1D, 0x51, 0x91, 0x0F, 0x34, 0xFA, 0x04, 0xCD, 0x96, 0x52, 0xED, 0x70, 0xCF, 0x5B, 0x7D,
-    0x32, 0x35, 0x3D, 0xA9, 0xEB, 0x71, 0xDA, 0xA9, 0x55, 0xDB, 0xD5, 0xB0, 0x6D, 0xB4, 0xF3, 0x2A,
-    0xFA, 0x0A, 0xCD, 0xE5, 0x14, 0x5E, 0x0E, 0x67, 0xD4, 0xA9, 0x53, 0x4B, 0x14, 0xB6, 0x05, 0x33,
-    0x34, 0x01, 0x34, 0xC0, 0x51, 0xA8, 0x1A, 0xB8, 0xAD, 0xB6, 0x7E, 0x9E, 0xCC, 0x57, 0x1E, 0x32,
-    0xC1, 0xA2, 0xA8, 0x01, 0x68, 0x10, 0xDA, 0xAD, 0x52, 0x7B, 0xCE, 0xBD, 0x26, 0x66, 0x46, 0x0E,
-    0x4F, 0x5D, 0xA6, 0xB2, 0x34, 0x18, 0xAC, 0x9C, 0x3E, 0xB7, 0x51, 0xA9, 0xBC, 0x91, 0xC9, 0x0A,
-    0xEF, 0x7B, 0xF4, 0xCA, 0x62, 0xA1, 0x8D, 0x55, 0x2A, 0x41, 0x1B, 0x6B, 0x52, 0x5E, 0x3E, 0xF3,
-    0x77, 0xE1, 0x9E, 0x67, 0x28, 0x3F, 0xA2, 0x8E, 0x66, 0x8F, 0xBB, 0x61, 0x77, 0x27, 0x2E, 0x11,
-    0x87, 0x47, 0xF2, 0x91, 0x60, 0x3B, 0xE8, 0xCC, 0x8E, 0x54, 0x3E, 0x59, 0x06, 0xED, 0xD2, 0x43,
-    0x27, 0x38, 0xD7, 0x9C, 0xDF, 0xCF, 0xFA, 0xEA, 0x5D, 0xE9, 0x87, 0x74, 0x05, 0x00, 0x3A, 0x78,
-    0xF5, 0x59, 0xDB, 0x3D, 0x8B, 0xEF, 0x91, 0x81, 0xA9, 0xA6, 0x06, 0x6D, 0x26, 0x43, 0x54, 0x92,
-    0xBE, 0xA7, 0xFD, 0x7F, 0x72, 0xE2, 0xC7, 0xB7, 0x3F, 0x58, 0x9E, 0x68, 0xFF, 0x35, 0xDB, 0x1D,
-    0x6C, 0x17, 0xAB, 0xB6, 0x64, 0xFD, 0x6F, 0x7F, 0x6E, 0x40, 0xD6, 0x3F, 0x3E, 0xFA, 0x33, 0xEA,
-    0xEE, 0xA6, 0x8D, 0x0A, 0x7D, 0x2C, 0x8A, 0x1D, 0xAD, 0x0B, 0x01, 0x28, 0xCC, 0xF3, 0xB6, 0x74,
-    0xC7, 0xB9, 0xAF, 0xE3, 0x41, 0xDF, 0xB1, 0x95, 0x77, 0x79, 0xF6, 0x49, 0x49, 0x50, 0x9B, 0xB2,
-    0xA4, 0x2F, 0xEC, 0x0B, 0x6F, 0x0F, 0xF2, 0xD5, 0x77, 0x72, 0xB9, 0x32, 0x00, 0xF5, 0x8A, 0xD4,
-    0x9A, 0xC0, 0x03, 0x79, 0xEF, 0x4A, 0x46, 0xB6, 0xE4, 0xD4, 0x01, 0x4C, 0x45, 0x23, 0xA4, 0x17,
-    0xBE, 0x8A, 0xB5, 0x99, 0x3A, 0xB4, 0xFE, 0xFA, 0x6C, 0xCB, 0x95, 0xDD, 0x3B, 0xF4, 0x2A, 0x62,
-    0xBD, 0x11, 0x3A, 0x22, 0x8C, 0x07, 0x83, 0xE5, 0x1C, 0xC4, 0x8A, 0xED, 0xB0, 0xEC, 0x6A, 0x85,
-    0x2C, 0x58, 0x3F, 0xC5, 0x7C, 0x0A, 0x8C, 0x96, 0xFC, 0xF7, 0xA1, 0xE2, 0xEB, 0x16, 0xFE, 0x69,
-    0xDB, 0x1D, 0x71, 0x7B, 0xC9, 0xF8, 0xC5, 0x92, 0x38, 0xCF, 0xC8, 0x48, 0x8D, 0x19, 0xE8, 0xC5,
-    0xF9, 0x93, 0xD1, 0xFB, 0xDF, 0x6B, 0x53, 0x3B, 0x52, 0x7C, 0xF8, 0x45, 0x41, 0x9C, 0x6C, 0x52,
-    0x1E, 0xEC, 0x88, 0x66, 0xA5, 0x9F, 0xCA, 0x0F, 0x22, 0x36, 0xB7, 0x89, 0x2D, 0xF1, 0xAC, 0xC8,
-    0x7E, 0xCD, 0xDF, 0x77, 0x7C, 0xA2, 0x37, 0x84, 0x79, 0x49, 0xA7, 0x3A, 0xCD, 0x8F, 0xDB, 0x3A,
-    0x22, 0x48, 0x1B, 0x7D, 0x0B, 0x6F, 0xF9, 0xD0, 0x5A, 0x7C, 0xFB, 0x29, 0xBA, 0x6D, 0xF6, 0x94,
-    0xAE, 0xF0, 0x44, 0xFF, 0x3D, 0xFC, 0x03, 0xBE, 0x82, 0x10, 0x35, 0x27, 0xCA, 0x04, 0xAA, 0xBE,
-    0x46, 0xF4, 0x25, 0xD1, 0x61, 0xA0, 0xF7, 0xAD, 0x5B, 0xA9, 0x74, 0x3D, 0x13, 0x45, 0x6D, 0x25,
-    0x03, 0xE3, 0x8F, 0xD3, 0x8E, 0x82, 0x8C, 0x47, 0x47, 0x20, 0xB3, 0xC3, 0x49, 0x02, 0x22, 0x78,
-    0xE8, 0x2A, 0xDC, 0xE4, 0x78, 0x99, 0x6C, 0xD0, 0x0F, 0xEF, 0x58, 0xBE, 0xA1, 0xBD, 0x3B, 0x1C,
-    0x3F, 0xF4, 0x89, 0x60, 0x00, 0x3A, 0xEB, 0x94, 0x4D, 0xAB, 0xDB, 0x23, 0xF4, 0xF3, 0xD3, 0xBA,
-    0x3D, 0x7D, 0xB4, 0x6E, 0xDF, 0x0D, 0x5D, 0xB6, 0xA4, 0x56, 0xAD, 0x8E, 0xC2, 0x7E, 0x89, 0x4C,
-    0xE6, 0x4A, 0x4E, 0x0A, 0x13, 0x3E, 0x56, 0x98, 0xFD, 0xA9, 0x31, 0x04, 0x98, 0x5D, 0x9B, 0xF5,
-    0xE5, 0x74, 0x90, 0x4F, 0x34, 0xCF, 0xD3, 0xAF, 0xEC, 0xB2, 0xD3, 0xB9, 0x01, 0x28, 0x9B, 0xA2,
-    0x3B, 0xE8, 0x3E, 0x33, 0xD8, 0x4D, 0x3D, 0x84, 0x3A, 0x9A, 0x77, 0x5E, 0x38, 0xD8, 0xD6, 0xDB,
-    0x41, 0xD1, 0xC7, 0x56, 0x60, 0x03, 0xEC, 0xAA, 0xAF, 0x53, 0x3D, 0x6F, 0x55, 0x8E, 0x10, 0x35,
-    0x34, 0xA7, 0xD3, 0x60, 0xA6, 0x82, 0x28, 0xD0, 0x99, 0x54, 0xDB, 0x32, 0x29, 0x91, 0x75, 0x2A,
-    0xDA, 0xB6, 0xD0, 0xE1, 0xF4, 0x9C, 0xDD, 0xDD, 0xF5, 0xE0, 0x06, 0xA9, 0xB5, 0xDD, 0xAE, 0xD1,
-    0xDF, 0x81, 0x7D, 0xDA, 0x42, 0x65, 0xA0, 0x90, 0x6E, 0xB0, 0x99, 0x69, 0x37, 0x66, 0xA6, 0xAD,
-    0x3C, 0x9A, 0x99, 0xF5, 0x37, 0x4A, 0xD3, 0xCE, 0xA1, 0xB4, 0x9B, 0x42, 0x55, 0xC8, 0x32, 0x57,
-    0x0B, 0x05, 0x3F, 0x41, 0xC6, 0xD1, 0x75, 0xCB, 0x0D, 0xFD, 0xB6, 0xFC, 0xD8, 0x45, 0x9B, 0xDD,
-    0xAE, 0x3B, 0x4E, 0x07, 0xBD, 0x0D, 0x1E, 0xF7, 0xDE, 0xA8, 0x07, 0x0D, 0xD0, 0xC7, 0x95, 0x4E,
-    0x39, 0xA9, 0x82, 0x7E, 0xB6, 0x67, 0x94, 0x78, 0xC6, 0xC5, 0x42, 0xD5, 0xED, 0x33, 0xC4, 0xEF,
-    0xE0, 0xFA, 0x6D, 0x75, 0x3E, 0x6E, 0x1F, 0x93, 0x5A, 0xAD, 0xD2, 0xAE, 0x76, 0x6C, 0xFF, 0xAB,
-    0x69, 0x1B, 0xE9, 0x7A, 0xAF, 0xED, 0x01, 0xA6, 0x75, 0x1B, 0x3D, 0x96, 0xB6, 0xC5, 0x4F, 0x3A,
-    0xB3, 0x95, 0x77, 0xAF, 0xFA, 0xB9, 0xE8, 0x5E, 0xB1, 0x66, 0x46, 0x20, 0xBE, 0x90, 0x08, 0xF3,
-    0x25, 0xC6, 0x9D, 0x4D, 0xC0, 0x44, 0x2C, 0x85, 0x3B, 0x7E, 0xF7, 0xFC, 0xCF, 0xBC, 0x67, 0x77,
-    0xBD, 0xBA, 0xC6, 0xE7, 0xFF, 0x89, 0x46, 0xCA, 0x82, 0xFE, 0xD1, 0x0E, 0x93, 0xBA, 0x56, 0xA3,
-    0xBF, 0xE8, 0x2A, 0x78, 0x56, 0x9A, 0x64, 0xA6, 0x34, 0x85, 0x66, 0x1F, 0xC1, 0x79, 0x8D, 0xC3,
-    0x86, 0xEF, 0x66, 0xC6, 0xAC, 0x17, 0xFA, 0x52, 0xDD, 0xA8, 0x35, 0x36, 0x71, 0x05, 0xE6, 0x1C,
-    0xE9, 0xD5, 0xD2, 0xCF, 0x66, 0xA5, 0xBC, 0xAF, 0xE1, 0x0F, 0xF2, 0xCA, 0xED, 0x5C, 0x04, 0x7C,
-    0x53, 0xEA, 0x94, 0xB4, 0xFD, 0x94, 0x71, 0xAC, 0x51, 0xD6, 0x1C, 0xB7, 0x66, 0xC5, 0x9A, 0x5B,
-    0xB6, 0xD7, 0xD8, 0x6E, 0x5D, 0x74, 0x47, 0x45, 0xEF, 0x0F, 0x8B, 0x16, 0xCE, 0x06, 0x02, 0x04,
-    0x54, 0x0C, 0x06, 0x22, 0x07, 0xF1, 0xE9, 0xF5, 0x7A, 0x5F, 0x6A, 0x13, 0xD8, 0x1B, 0xA9, 0xC3,
-    0xED, 0x5C, 0xCB, 0xBD, 0xB9, 0xB5, 0xFF, 0xE3, 0x84, 0xC5, 0x8E, 0x29, 0xF5, 0xBE, 0x05, 0xA1,
-    0x4B, 0x26, 0x19, 0xD1, 0xBD, 0x7B, 0x94, 0xAB, 0x9E, 0x1E, 0xC7, 0x83, 0x23, 0xEA, 0x62, 0x38,
-    0x67, 0xF8, 0x0A, 0x37, 0xDE, 0x27, 0x39, 0x15, 0xE0, 0x03, 0x07, 0x42, 0xE7, 0xCE, 0xFD, 0xBA,
-    0x7B, 0xD1, 0x66, 0x67, 0x31, 0x86, 0x80, 0xFC, 0x19, 0x72, 0x70, 0x49, 0xA0, 0x41, 0x8D, 0x96,
-    0x68, 0xE8, 0x02, 0x44, 0x25, 0xA3, 0x94, 0x01, 0x0B, 0x37, 0xAE, 0xC1, 0xB9, 0xF2, 0x7E, 0xA0,
-    0xDE, 0x29, 0x22, 0xF3, 0x95, 0x8D, 0x59, 0xC7, 0x47, 0x3D, 0x88, 0x7E, 0x20, 0xF3, 0x74, 0xCB,
-    0xDC, 0x92, 0xAD, 0xD7, 0x91, 0x8B, 0xDB, 0xDA, 0x01, 0x1E, 0x01, 0x66, 0x56, 0xBF, 0x44, 0x52,
-    0x94, 0x46, 0x56, 0x4B, 0x90, 0x88, 0x0A, 0x3F, 0x17, 0xF6, 0x5E, 0x0A, 0xBB, 0xE6, 0x85, 0x53,
-    0xC8, 0xC0, 0xE8, 0x54, 0x8C, 0x07, 0xFB, 0x69, 0x8B, 0x44, 0xF7, 0xF0, 0xA0, 0xF9, 0x45, 0x29,
-    0x41, 0x97, 0x16, 0xE6, 0xF2, 0xE2, 0x1E, 0xE0, 0xD3, 0x33, 0xD4, 0x7C, 0x6F, 0x5F, 0x18, 0xD1,
-    0x0E, 0x9E, 0x4C, 0x8F, 0x70, 0xA7, 0xE6, 0x46, 0xBA, 0x3F, 0xF2, 0x31, 0x98, 0x5B, 0x82, 0xBC,
-    0x9D, 0xA7, 0xCC, 0xEB, 0xD9, 0x09, 0x56, 0x9B, 0x3F, 0x95, 0xD9, 0x54, 0xB6, 0x2D, 0x6C, 0x3B,
-    0xCD, 0xC2, 0x3E, 0xA9, 0x1D, 0x54, 0x11, 0xDB, 0xC7, 0x9C, 0xBD, 0x77, 0x46, 0x48, 0x73, 0x51,
-    0xF6, 0x6B, 0xEB, 0x11, 0x6D, 0xCD, 0xFA, 0x94, 0x08, 0x01, 0x18, 0xE2, 0xDB, 0x67, 0x26, 0x55,
-    0x6F, 0xB5, 0xB6, 0x20, 0xED, 0x48, 0x31, 0x77, 0x26, 0xD7, 0xE9, 0xD0, 0xCB, 0x05, 0x2C, 0x0E,
-    0xB7, 0x3C, 0xC6, 0x2F, 0x3D, 0xA1, 0x8A, 0xFF, 0x0E, 0xF3, 0xBB, 0x6F, 0x4B, 0x2D, 0x7D, 0x9C,
-    0x2E, 0xFA, 0xC9, 0xFD, 0xA9, 0x2F, 0x0C, 0xFA, 0xDC, 0x1C, 0xDD, 0xAF, 0x70, 0x24, 0xEF, 0xA2,
-    0x65, 0xD0, 0xB4, 0x6A, 0xE7, 0x1B, 0x78, 0x9A, 0x84, 0x49, 0xF5, 0x72, 0xC2, 0x93, 0xD9, 0xCE,
-    0xAC, 0x54, 0xD6, 0x3F, 0x56, 0x0A, 0x38, 0x3F, 0xF5, 0xEE, 0xA3, 0x1A, 0x0F, 0xA4, 0x71, 0xDF,
-    0xEF, 0x7C, 0x68, 0x37, 0x27, 0x3F, 0x5B, 0x32, 0x35, 0x12, 0x67, 0x93, 0x2A, 0x83, 0xBE, 0x94,
-    0x3E, 0x1C, 0x76, 0xC1, 0x6F, 0xC7, 0x25, 0x25, 0xBE, 0x70, 0xE8, 0xD5, 0x12, 0x00, 0x50, 0x35,
-    0xC9, 0xC6, 0x94, 0x91, 0x12, 0x6B, 0x6E, 0x4E, 0x19, 0x89, 0x6E, 0x12, 0xA3, 0xB5, 0x53, 0x46,
-    0xEE, 0xE6, 0x94, 0x51, 0xEA, 0x35, 0xE6, 0x64, 0xE5, 0xB1, 0x7F, 0x7D, 0xD3, 0x72, 0x6A, 0x15,
-    0x3B, 0xEE, 0x55, 0xF9, 0x73, 0x33, 0xFF, 0xF4, 0xC3, 0xB6, 0x9D, 0x5A, 0xD8, 0x1E, 0xAB, 0x02,
-    0xA6, 0xC6, 0x63, 0xF0, 0x9E, 0xCB, 0xCB, 0x42, 0xB4, 0x96, 0xAB, 0x07, 0x2B, 0xA5, 0x99, 0x20,
-    0x6E, 0xD9, 0x22, 0x2E, 0xB9, 0x35, 0x27, 0x13, 0xC4, 0x45, 0xBF, 0x7D, 0x6F, 0xE5, 0xC2, 0xC7,
-    0xC5, 0xFD, 0x9A, 0xD0, 0xAF, 0x9C, 0xA3, 0xEA, 0xF5, 0x64, 0x2A, 0x18, 0x8D, 0x16, 0x9F, 0xFB,
-    0x06, 0xFD, 0x8E, 0xF3, 0x0D, 0x90, 0x81, 0xDD, 0x53, 0x7F, 0xAE, 0x6B, 0xAF, 0xC5, 0xF7, 0x31,
-    0xCB, 0x5C, 0xDF, 0x12, 0x49, 0x91, 0x14, 0x62, 0xC1, 0x0F, 0x55, 0xFE, 0x0F, 0xA5, 0x14, 0x99,
-    0xDB, 0x1A, 0xC4, 0xE4, 0xF7, 0xEA, 0xC1, 0xDF, 0xAF, 0xDF, 0xFF, 0x9D, 0x3A, 0x89, 0xED, 0x20,
-    0x09, 0xBD, 0x30, 0xFB, 0xFF, 0x99, 0xCF, 0x22, 0x0A, 0x21, 0xF0, 0xB9, 0xFE, 0x8C, 0x65, 0x15,
-    0x6F, 0x25, 0x85, 0x79, 0x49, 0x94, 0xEA, 0x6F, 0x3E, 0x0B, 0x8B, 0x46, 0xDA, 0xEC, 0x34, 0xB9,
-    0xD9, 0xEA, 0x71, 0x9A, 0x68, 0x55, 0x75, 0x8D, 0xFD, 0xF8, 0xEE, 0xF8, 0xDA, 0x69, 0x5D, 0x0D,
-    0xCC, 0x65, 0xCB, 0xEE, 0xAA, 0xF5, 0xC5, 0xE7, 0x17, 0x17, 0x49, 0xDD, 0xB6, 0x5B, 0x7D, 0xC7,
-    0x49, 0x4E, 0xB5, 0x2A, 0xB6, 0x81, 0xF8, 0x4A, 0x75, 0x86, 0x81, 0x19, 0x83, 0x7E, 0x22, 0xB4,
-    0xAA, 0x21, 0xA9, 0x76, 0x5A, 0xAB, 0x76, 0x58, 0x4A, 0x93, 0x70, 0xDD, 0x2C, 0x40, 0x6E, 0x7E,
-    0x8A, 0xDB, 0x78, 0x98, 0x9E, 0x96, 0x8C, 0x78, 0xFB, 0x81, 0x09, 0xE4, 0x20, 0x73, 0x39, 0xEF,
-    0xBB, 0x97, 0xAD, 0x3E, 0x8E, 0x8E, 0xBF, 0x85, 0x64, 0x91, 0x45, 0x8D, 0x94, 0x84, 0x3E, 0x0F,
-    0x7C, 0x28, 0x25, 0x1E, 0xD8, 0x2D, 0x22, 0x8A, 0xFC, 0x18, 0x7A, 0x18, 0x46, 0xE5, 0x2A, 0x21,
-    0xE3, 0xBF, 0x97, 0x48, 0xC1, 0x24, 0xBA, 0x57, 0x30, 0xD9, 0xAC, 0x42, 0xFF, 0x62, 0x39, 0xE2,
-    0x4F, 0xDE, 0xBB, 0x57, 0x85, 0x6E, 0x27, 0xDB, 0x4B, 0xEA, 0xF7, 0xC9, 0xBF, 0xD6, 0xBE, 0xFD,
-    0xB6, 0x50, 0xEA, 0x1F, 0xA2, 0x38, 0xCE, 0xD7, 0x7E, 0xEA, 0x5F, 0xCC, 0x55, 0xDB, 0x22, 0x73,
-    0x90, 0xEA, 0x8B, 0x77, 0x0E, 0x5B, 0x78, 0xB4, 0x2F, 0x75, 0xDF, 0x9A, 0x9E, 0x2A, 0xE9, 0x81,
-    0xFA, 0x63, 0x90, 0xF9, 0x3C, 0x9F, 0xCF, 0x0D, 0xFF, 0xE2, 0x26, 0xF3, 0xF0, 0xAB, 0x37, 0x64,
-    0x8A, 0x2C, 0xC6, 0x5B, 0x22, 0x84, 0xA5, 0xF5, 0xD3, 0x0F, 0x72, 0x0B, 0x30, 0x2A, 0x84, 0x89,
-    0x2A, 0x82, 0x63, 0xD6, 0x29, 0x0E, 0x02, 0x71, 0xDA, 0xB0, 0xB6, 0xED, 0x7F, 0x34, 0x18, 0x13,
-    0x47, 0x27, 0x19, 0x2F, 0x28, 0xB2, 0xA7, 0x90, 0x29, 0xF7, 0x49, 0xFB, 0x81, 0xB7, 0x32, 0x96,
-    0xA1, 0x79, 0x68, 0xA9, 0xB5, 0x25, 0x4F, 0x7B, 0x01, 0xCB, 0x9F, 0x72, 0x34, 0x99, 0x36, 0x2F,
-    0x7E, 0xDD, 0xB4, 0xF9, 0xD4, 0xCB, 0xA7, 0x0C, 0x9F, 0x5F, 0x78, 0xFD, 0x41, 0x2F, 0xFD, 0x8C,
-    0x95, 0x38, 0xF7, 0x62, 0xEA, 0xFB, 0xB4, 0x74, 0xAF, 0x60, 0x3B, 0x15, 0x4E, 0xF9, 0x40, 0xFC,
-    0x8E, 0x1D, 0xEA, 0xB8, 0xEA, 0x39, 0x77, 0xAC, 0xE2, 0x18, 0xFC, 0x06, 0xA9, 0x11, 0xC9, 0x70,
-    0x4E, 0xB4, 0x2C, 0xC7, 0x10, 0x49, 0x6D, 0x56, 0x97, 0x11, 0x9C, 0x9B, 0xDB, 0x9A, 0x77, 0x3E,
-    0x7B, 0x01, 0x70, 0xE4, 0x14, 0xE0, 0x3B, 0x7B, 0x4B, 0x55, 0x6C, 0x75, 0xF3, 0x59, 0x27, 0x74,
-    0x33, 0x1F, 0xA2, 0x05, 0x41, 0x3E, 0x0F, 0xBD, 0x8C, 0x84, 0x39, 0x44, 0x7A, 0xC5, 0x20, 0x3A,
-    0x40, 0x4C, 0x61, 0xFA, 0xF2, 0xEF, 0x09, 0xE2, 0xB6, 0x55, 0x7B, 0x16, 0x88, 0xD0, 0xE2, 0x68,
-    0xC7, 0xBA, 0x90, 0x38, 0x43, 0xD7, 0x7A, 0xD9, 0xA7, 0xC0, 0x48, 0x87, 0x7D, 0x88, 0x00, 0x58,
-    0x11, 0x0A, 0x7A, 0x49, 0x18, 0x7D, 0x01, 0x90, 0x47, 0x6A, 0x6C, 0x39, 0x73, 0x4B, 0x52, 0xE4,
-    0xDD, 0x3A, 0x93, 0xB3, 0xA2, 0x7F, 0x82, 0xB6, 0x67, 0xAD, 0xB1, 0x24, 0x80, 0xB6, 0xCE, 0x1B,
-    0x1E, 0xBD, 0xF3, 0xE0, 0xBC, 0x21, 0x52, 0xFF, 0x60, 0x34, 0xAA, 0x71, 0xD3, 0x73, 0x7B, 0x9E,
-    0xDB, 0xF3, 0x47, 0x7B, 0x9E, 0x5B, 0x34, 0xE5, 0xF6, 0x97, 0x68, 0x0F, 0xBE, 0xBF, 0xF6, 0x1F,
-    0x05, 0x52, 0x3A, 0x43, 0x52, 0x6B, 0x3B, 0x4B, 0xA6, 0x1A, 0xFE, 0xF0, 0x15, 0x7A, 0x05, 0x6D,
-    0x4E, 0xBE, 0x43, 0x7A, 0x7C, 0x43, 0x61, 0x89, 0xEB, 0xB5, 0x71, 0xF9, 0xA9, 0x98, 0xBA, 0xF7,
-    0xF9, 0x8D, 0x27, 0x09, 0x65, 0xAC, 0xD7, 0xAC, 0x64, 0xA7, 0xE0, 0xF0, 0xD6, 0xFF, 0x5C, 0xA1,
-    0x67, 0xF1, 0xC0, 0xA7, 0xEF, 0xCD, 0x20, 0xFC, 0x55, 0xA8, 0xFD, 0x4A, 0x5D, 0xDC, 0x1F, 0x7F,
-    0x94, 0xE5, 0xBD, 0xA8, 0xD4, 0x87, 0x4A, 0x95, 0xC9, 0x74, 0x2D, 0x9C, 0x2F, 0x06, 0x23, 0xC2,
-    0xB0, 0xC1, 0x6F, 0x6A, 0x91, 0x92, 0x76, 0x52, 0x6B, 0x0C, 0xB2, 0x76, 0xCA, 0x56, 0xEA, 0x3A,
-    0x9D, 0xA6, 0x01, 0x2A, 0xF3, 0x8B, 0xDA, 0x1A, 0x90, 0xDA, 0xA0, 0x9E, 0xE8, 0x20, 0x0C, 0x68,
-    0x27, 0xD3, 0xFB, 0x62, 0x75, 0xAD, 0x9D, 0xDE, 0xAD, 0x44, 0xE2, 0xC0, 0x88, 0xFA, 0x64, 0x16,
-    0xB8, 0x55, 0x2B, 0xCA, 0xE9, 0x7F, 0x01, 0x6D, 0x53, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x6E,
-    0x06, 0xB2, 0xC8, 0x23, 0x31, 0x29, 0xD2, 0x10, 0xC4, 0x6D, 0x4A, 0x73, 0x22, 0x5E, 0x89, 0x2A,
-    0x48, 0xE7, 0x9B, 0x91, 0x5D, 0x50, 0x20, 0x24, 0x17, 0x71, 0x43, 0x45, 0x89, 0x68, 0x68, 0x10,
-    0x02, 0xE9, 0xEC, 0x5D, 0x71, 0x02, 0x77, 0xE1, 0xC4, 0x1F, 0x10, 0x39, 0x92, 0x85, 0x6C, 0xD7,
-    0x29, 0xAE, 0x70, 0xB2, 0x23, 0x9F, 0x20, 0x12, 0x0D, 0x6B, 0xBB, 0xA0, 0x5D, 0x28, 0x28, 0xC9,
-    0x44, 0x0C, 0xD2, 0x02, 0xBB, 0x37, 0xBC, 0xD9, 0xBD, 0xC4, 0x16, 0xE2, 0xCD, 0xCE, 0xCF, 0x9D,
-    0x79, 0xF3, 0xBD, 0xEF, 0x7D, 0x93, 0xFB, 0xA7, 0xDE, 0xE6, 0x5D, 0x43, 0xAD, 0xB7, 0x00, 0xA4,
-    0xF7, 0x17, 0xDE, 0xBB, 0xED, 0xED, 0xBB, 0x34, 0x01, 0xF7, 0x64, 0x8A, 0xEA, 0xB3, 0x6D, 0xB2,
-    0xFF, 0x5B, 0x99, 0xDD, 0x7E, 0xB8, 0x4E, 0x65, 0xD8, 0x15, 0x47, 0xC5, 0x5E, 0x29, 0xB4, 0xD1,
-    0xD1, 0xDE, 0x02, 0x9D, 0x3D, 0x9F, 0x1E, 0x0B, 0x9B, 0x72, 0xA7, 0xBE, 0xAC, 0x07, 0x93, 0x5A,
-    0x4D, 0x5C, 0x2A, 0xCB, 0x17, 0x83, 0x17, 0xBF, 0x8E, 0x6F, 0x7E, 0x5B, 0xAB, 0x3D, 0xDB, 0xC8,
-    0xF3, 0x8A, 0xBA, 0x5C, 0x16, 0x83, 0xAF, 0x0F, 0x7C, 0x7C, 0x51, 0xA5, 0xB4, 0x90, 0x4A, 0xEA,
-    0x71, 0x79, 0xE6, 0xBF, 0x5B, 0xA1, 0x21, 0x01, 0x8B, 0x18, 0xBD, 0xAE, 0xE1, 0xBE, 0xCE, 0xFD,
-    0xF7, 0xC9, 0xDD, 0xE5, 0x14, 0x09, 0xD8, 0x65, 0x53, 0x62, 0x0D, 0x28, 0x71, 0x0D, 0xB8, 0x1E,
-    0x40, 0x4E, 0xBB, 0xB3, 0xB2, 0x3B, 0xCB, 0xFE, 0x7C, 0x37, 0x9C, 0x2D, 0xAE, 0xB8, 0xAA, 0x72,
-    0x6F, 0x12, 0xFD, 0xDC, 0xC1, 0xAB, 0xC0, 0x87, 0x60, 0x4B, 0x6A, 0x28, 0x42, 0x1B, 0xBA, 0xD4,
-    0x3B, 0xE1, 0xBD, 0xF6, 0xBE, 0x22, 0x3E, 0x33, 0xEF, 0xEB, 0xD8, 0xFB, 0x53, 0xEA, 0x92, 0x96,
-    0xDD, 0x66, 0x70, 0x7C, 0x3C, 0x05, 0xCF, 0xD2, 0xBD, 0x26, 0xDD, 0xD4, 0xC0, 0xEA, 0xCE, 0xE3,
-    0x3C, 0xD4, 0x37, 0xD9, 0xF4, 0xA3, 0x51, 0x54, 0xD6, 0xA9, 0x28, 0xEB, 0x5C, 0xD8, 0xE6, 0x8B,
-    0xF2, 0x65, 0xBC, 0x75, 0x6D, 0xAB, 0xCF, 0x0E, 0x25, 0xBE, 0x13, 0x59, 0x7F, 0xCF, 0xF0, 0x79,
-    0x11, 0x70, 0xC0, 0x01, 0x27, 0xC0, 0x18, 0x18, 0xAD, 0xEE, 0xC7, 0xFD, 0x77, 0xE4, 0x57, 0x3F,
-    0xBE, 0x67, 0x7E, 0x3D, 0x9D, 0x02, 0x2B, 0xFB, 0xCA, 0x2C, 0xB8, 0x8D, 0xCD, 0x02, 0x2B, 0x0F,
-    0x8E, 0xE4, 0xB3, 0x46, 0xFE, 0x52, 0xCB, 0xD3, 0x2A, 0x9E, 0x3B, 0x62, 0x26, 0x60, 0x3C, 0x3D,
-    0x3B, 0xB7, 0xAE, 0x72, 0xB3, 0x93, 0x4F, 0xEF, 0x0C, 0xDB, 0x9C, 0x48, 0x5E, 0x8C, 0x45, 0x18,
-    0x7C, 0x6E, 0xC7, 0xD5, 0xDA, 0x50, 0xBE, 0xD1, 0xAE, 0xF6, 0xFB, 0x32, 0x7A, 0x72, 0x51, 0xCE,
-    0x4E, 0x86, 0x52, 0x44, 0x3A, 0xAC, 0x3C, 0x44, 0x5C, 0x88, 0xA7, 0x1B, 0x07, 0x47, 0xC0, 0xAD,
-    0xE1, 0x68, 0x47, 0x45, 0xE5, 0x6E, 0x94, 0x6D, 0x51, 0xE4, 0x77, 0x98, 0x15, 0x85, 0x92, 0xE7,
-    0xEE, 0x76, 0x8F, 0x36, 0x1E, 0x04, 0x97, 0x19, 0xD0, 0xAB, 0xD1, 0x6B, 0x92, 0xB9, 0x13, 0x16,
-    0x0B, 0x28, 0xA3, 0x0C, 0x16, 0x34, 0x8C, 0xFE, 0x6E, 0x30, 0x4A, 0xFC, 0xDE, 0xCF, 0xA5, 0xB7,
-    0x8F, 0x52, 0xD1, 0x88, 0xDF, 0x1E, 0x78, 0x7B, 0x44, 0x74, 0x19, 0xC4, 0xFF, 0x78, 0x62, 0x50,
-    0xD6, 0xF0, 0x26, 0xB5, 0xCA, 0xF6, 0x68, 0xA9, 0x25, 0xB5, 0xA4, 0x66, 0x97, 0x6A, 0x14, 0xE0,
-    0x7F, 0xDC, 0x26, 0x48, 0xC2, 0x49, 0x1D, 0xBE, 0xB8, 0x67, 0xE9, 0xE3, 0x9D, 0xB8, 0x48, 0x35,
-    0x93, 0x2A, 0xFD, 0xE1, 0x30, 0x8C, 0x33, 0xF0, 0x56, 0x02, 0x63, 0xC4, 0x0D, 0xF3, 0x8D, 0xF8,
-    0xA4, 0xC6, 0x23, 0xC7, 0xFE, 0x28, 0xC4, 0x4F, 0x5A, 0x8D, 0x11, 0x72, 0x04, 0x69, 0xA1, 0x34,
-    0x9A, 0x70, 0xC1, 0x4B, 0x4B, 0x79, 0x72, 0xCA, 0xB0, 0x41, 0x0A, 0xD6, 0x40, 0x3A, 0xA8, 0x12,
-    0xED, 0xDB, 0xA0, 0x78, 0x36, 0xE7, 0xDE, 0x26, 0x01, 0x48, 0x50, 0xC8, 0xFB, 0x5B, 0x50, 0x8E,
-    0x6E, 0x03, 0xF3, 0x19, 0xEE, 0x4F, 0xF1, 0xF6, 0xBD, 0xEB, 0xBF, 0x7B, 0x97, 0x5C, 0x54, 0x94,
-    0xF1, 0xC9, 0x67, 0x1F, 0xE0, 0x95, 0x8E, 0x2D, 0x6E, 0xB0, 0x1E, 0x72, 0x45, 0x28, 0x66, 0x88,
-    0x0C, 0x46, 0x41, 0x2C, 0x52, 0x53, 0xDE, 0xA2, 0xA2, 0x9B, 0x5C, 0xDA, 0x63, 0x2D, 0x2A, 0xE6,
-    0xAB, 0xD8, 0x9B, 0xBF, 0xE2, 0x6F, 0xCE, 0xEA, 0x1B, 0xCC, 0x66, 0x71, 0x00, 0xCF, 0x0B, 0x92,
-    0x1C, 0x25, 0x3B, 0x0A, 0xBE, 0x08, 0xA8, 0xC2, 0xEB, 0x16, 0xB9, 0x26, 0x70, 0xB9, 0xE6, 0x2D,
-    0xFE, 0x1A, 0xA4, 0x76, 0x15, 0x90, 0xBF, 0x16, 0x94, 0x7B, 0xC5, 0x56, 0xC1, 0xA6, 0x88, 0x35,
-    0x2A, 0x88, 0x92, 0x62, 0xE2, 0x55, 0x88, 0xAD, 0xB5, 0xA4, 0xC0, 0x2D, 0xBA, 0x8A, 0x4F, 0xDC,
-    0x2E, 0x86, 0x37, 0x7A, 0x96, 0xBC, 0x4B, 0x4D, 0x5A, 0x72, 0x82, 0xB2, 0x40, 0xF8, 0xB8, 0x15,
-    0x86, 0x28, 0xA0, 0x4C, 0x68, 0x69, 0xC8, 0x7D, 0x4D, 0x85, 0x65, 0xD2, 0xB4, 0xBC, 0x5E, 0xB1,
-    0x95, 0x70, 0x7D, 0x70, 0x1B, 0xD3, 0x76, 0x56, 0x43, 0xD1, 0x33, 0x67, 0x47, 0xE1, 0xCF, 0x56,
-    0x9A, 0x45, 0xB9, 0xD7, 0xF9, 0x59, 0x2D, 0xF6, 0x79, 0x31, 0xC3, 0x48, 0x66, 0xBC, 0xAC, 0xB0,
-    0x2E, 0x33, 0x61, 0x5C, 0x54, 0xC9, 0x8D, 0x05, 0x5C, 0x92, 0xF1, 0x0D, 0x92, 0x31, 0xC5, 0xC0,
-    0xF4, 0xD2, 0x21, 0xAB, 0x06, 0x48, 0xE6, 0x96, 0xD7, 0x0A, 0xEA, 0x89, 0x65, 0x87, 0xCB, 0x65,
-    0x52, 0x27, 0x41, 0xA4, 0x67, 0x1A, 0x64, 0x4F, 0x38, 0xD7, 0x70, 0x22, 0x75, 0xB2, 0x69, 0xE4,
-    0xB9, 0x65, 0x07, 0x15, 0x88, 0x9A, 0xC0, 0x12, 0x81, 0x27, 0x86, 0xC2, 0xE3, 0xA0, 0x97, 0x31,
-    0x8A, 0x8C, 0xDC, 0xA0, 0x78, 0x1A, 0x6E, 0x07, 0x9A, 0xB6, 0xEC, 0x50, 0xD4, 0x94, 0x47, 0x83,
-    0xA8, 0x6C, 0x99, 0x2F, 0xBB, 0xB7, 0xFE, 0x2F, 0x4D, 0x8E, 0x31, 0x4B, 0xC3, 0x40, 0x18, 0x86,
-    0xBF, 0xCB, 0x37, 0x44, 0x92, 0xEA, 0xED, 0x22, 0xDC, 0x2E, 0x85, 0x74, 0x48, 0x21, 0x85, 0xA6,
-    0x77, 0x98, 0xC1, 0xC5, 0xC1, 0x1F, 0x10, 0xA1, 0x83, 0x83, 0x88, 0x93, 0x38, 0x38, 0x54, 0x1B,
-    0xFD, 0x05, 0x6E, 0x2E, 0x15, 0x04, 0x57, 0x9D, 0x5C, 0x3B, 0x5C, 0x9A, 0xC1, 0xD1, 0x93, 0xFC,
-    0x81, 0x13, 0x07, 0x07, 0x07, 0x33, 0x04, 0xBC, 0xE1, 0x40, 0xAF, 0xE2, 0x20, 0xEF, 0xF0, 0x3D,
-    0x7C, 0x3C, 0xC3, 0x13, 0x74, 0xEE, 0x6E, 0x3E, 0x8E, 0x9F, 0x5F, 0x6F, 0x09, 0x9C, 0xD0, 0xEC,
-    0x74, 0x2A, 0x13, 0x40, 0xD3, 0xC3, 0xD6, 0x5B, 0x74, 0xF9, 0xC5, 0x15, 0xAD, 0x04, 0xDF, 0xCE,
-    0xE3, 0x85, 0x01, 0x00, 0xDF, 0x12, 0xD9, 0x45, 0x99, 0xF8, 0x62, 0x37, 0xC8, 0xF2, 0x7E, 0x69,
-    0xFA, 0x95, 0x05, 0x60, 0xD9, 0xC6, 0xB8, 0xDA, 0x63, 0x65, 0xCE, 0x85, 0x73, 0xF0, 0x53, 0xF3,
-    0xEF, 0xAA, 0x3D, 0x4B, 0xB1, 0x56, 0xA3, 0x14, 0xDF, 0x35, 0x3F, 0xC7, 0xAF, 0x86, 0x07, 0x98,
-    0x0F, 0x9E, 0xEE, 0x9D, 0xCF, 0x60, 0x85, 0x0A, 0x15, 0xAF, 0xFA, 0xD7, 0x36, 0xDA, 0x3A, 0x02,
-    0x39, 0xA4, 0x59, 0xCB, 0x55, 0x24, 0x3A, 0x44, 0x1A, 0x52, 0xD9, 0x4D, 0x41, 0x44, 0xB2, 0x76,
-    0x79, 0x30, 0x55, 0x43, 0x94, 0x40, 0xDF, 0x40, 0x72, 0xF1, 0x68, 0xF6, 0xC3, 0x65, 0xC5, 0xAC,
-    0x57, 0xCF, 0x58, 0xF1, 0xAF, 0x62, 0x1C, 0x66, 0x3B, 0x83, 0xD2, 0xC4, 0xF5, 0x43, 0x54, 0xFC,
-    0x55, 0xBC, 0xFC, 0x56, 0x34, 0xA1, 0x9C, 0xA0, 0x66, 0x60, 0x51, 0x31, 0x98, 0x7B, 0x0D, 0x2D,
-    0x46, 0x8E, 0xDD, 0x97, 0x09, 0x07, 0x9E, 0x71, 0xA8, 0xA9, 0x5C, 0x17, 0x29, 0x44, 0x40, 0x0B,
-    0x5F, 0xA2, 0xF6, 0x1A, 0x68, 0xC1, 0xC0, 0xDC, 0x6D, 0xE2, 0xB6, 0xBC, 0x16, 0x0C, 0x69, 0xB1,
-    0x71, 0xAE, 0x62, 0xAE, 0xE2, 0x10, 0x7E, 0x00, 0x4D, 0x53, 0x41, 0x6B, 0x14, 0x49, 0x14, 0xFE,
-    0xBA, 0xCB, 0xD0, 0x2C, 0x75, 0xA8, 0x3D, 0x18, 0x04, 0xC5, 0xF4, 0x5D, 0x92, 0xF4, 0x1F, 0x98,
-    0x4D, 0x8D, 0xE6, 0x10, 0xF0, 0x92, 0x1C, 0xF6, 0x26, 0x8B, 0x7F, 0xC2, 0x85, 0x11, 0x12, 0xBA,
-    0x57, 0x0F, 0xDE, 0xD6, 0x41, 0xF0, 0xEC, 0x25, 0x07, 0x89, 0x48, 0x3C, 0x78, 0x50, 0xC9, 0x64,
-    0x3A, 0x44, 0x18, 0x58, 0x0F, 0x36, 0xEA, 0x3D, 0xBD, 0x37, 0x35, 0xE2, 0x16, 0x4B, 0x47, 0x3B,
-    0xD2, 0xDD, 0xCF, 0xAF, 0x26, 0x71, 0xD9, 0xE6, 0x15, 0x55, 0x5D, 0xF5, 0xEA, 0xBD, 0xEF, 0x7D,
-    0xDF, 0x2B, 0xA8, 0x3F, 0x41, 0x8B, 0x7E, 0x83, 0x9E, 0x47, 0xDC, 0x05, 0xD2, 0x45, 0xD2, 0x9A,
-    0x6E, 0x90, 0x7C, 0x7A, 0x62, 0x77, 0x9C, 0x5D, 0x77, 0x76, 0x50, 0xDA, 0xA3, 0xC2, 0x7E, 0x79,
-    0x67, 0xA5, 0x8D, 0xA5, 0xD5, 0xD2, 0x86, 0xB4, 0x57, 0x50, 0xAF, 0xBD, 0x9D, 0x7E, 0xC9, 0x8F,
-    0x8B, 0xD5, 0x99, 0x38, 0x87, 0xCD, 0x60, 0xAF, 0x3C, 0x4C, 0x97, 0xDB, 0x74, 0x39, 0xB7, 0x6F,
-    0x5F, 0xFE, 0x77, 0x31, 0x90, 0x96, 0xBE, 0xC1, 0x2E, 0xB4, 0x14, 0x26, 0x18, 0x8E, 0x25, 0xA7,
-    0x45, 0x19, 0x52, 0xC9, 0x69, 0x61, 0x89, 0x0B, 0x25, 0xAC, 0x0C, 0xAD, 0x54, 0x97, 0xB6, 0x36,
-    0x31, 0x8B, 0x25, 0x04, 0x0D, 0x2A, 0x44, 0x4D, 0x54, 0x20, 0xAE, 0xE2, 0x3E, 0xC6, 0x6E, 0x03,
-    0xA1, 0xBC, 0xA9, 0xC2, 0x6D, 0xF9, 0xE7, 0xA3, 0x11, 0x61, 0xBC, 0x6E, 0xA9, 0x81, 0xAA, 0xC5,
-    0xC1, 0xFC, 0x2D, 0xCC, 0x7C, 0x5B, 0x00, 0xD1, 0x0D, 0xEF, 0x18, 0x37, 0x45, 0xA6, 0x65, 0x88,
-    0x44, 0x8A, 0x99, 0xD1, 0xF5, 0x77, 0xA9, 0x48, 0x6D, 0xF2, 0x0D, 0xA6, 0xA8, 0x20, 0x92, 0x2B,
-    0xA9, 0x61, 0x3E, 0x00, 0x96, 0x5E, 0x0D, 0xA0, 0x2A, 0xC0, 0x14, 0x40, 0xDA, 0xE7, 0x56, 0xC9,
-    0x7F, 0xC9, 0x80, 0xC1, 0x3C, 0x10, 0xFD, 0xC1, 0xDD, 0xC1, 0x45, 0x2E, 0x6E, 0x15, 0xDA, 0xED,
-    0x36, 0xC1, 0xA1, 0x96, 0x6C, 0x1E, 0xE3, 0x06, 0xC7, 0x7A, 0xBF, 0x08, 0xEB, 0x1D, 0x0B, 0x75,
-    0xB0, 0xEF, 0x92, 0x51, 0x63, 0x57, 0xE4, 0xAF, 0x5B, 0x9B, 0x71, 0x39, 0x4D, 0xFC, 0x13, 0xC2,
-    0xBE, 0xC3, 0xC0, 0x40, 0x73, 0x7A, 0x62, 0x22, 0xE3, 0xF1, 0x8E, 0x45, 0xDC, 0xCD, 0xB6, 0x8C,
-    0xE4, 0x33, 0x51, 0x14, 0xAA, 0x6D, 0x60, 0xEF, 0xE6, 0xAA, 0x6A, 0x90, 0xE8, 0x6C, 0x96, 0x19,
-    0xA4, 0x38, 0x9B, 0xCA, 0xF2, 0xA4, 0x58, 0xEF, 0x0D, 0xC2, 0xFD, 0xC9, 0xD5, 0x85, 0xDE, 0xEF,
-    0xFF, 0xBE, 0x9D, 0xAC, 0x2E, 0xF4, 0x6E, 0x38, 0x35, 0x59, 0xCD, 0x7A, 0x37, 0xC6, 0x0F, 0x26,
-    0x57, 0xA4, 0x41, 0xB0, 0x9D, 0x03, 0x25, 0xCE, 0x7F, 0x63, 0x69, 0x7E, 0xB1, 0x5B, 0x2A, 0x29,
-    0xF5, 0x4A, 0xA9, 0x55, 0xA1, 0x57, 0x0A, 0x46, 0x09, 0xA5, 0xC4, 0xAF, 0xFD, 0xAD, 0xAD, 0xA1,
-    0xC8, 0x14, 0x8D, 0x6E, 0x91, 0x76, 0x90, 0xC7, 0x2C, 0x34, 0x91, 0xDC, 0x4A, 0x1E, 0x54, 0x08,
-    0xDC, 0xE9, 0xDA, 0x57, 0xDF, 0x91, 0xDC, 0x0E, 0xB6, 0xF3, 0x9E, 0xE4, 0x40, 0xE4, 0x40, 0xE4,
-    0xAB, 0x30, 0xD5, 0x68, 0x0D, 0x49, 0x8D, 0xA4, 0x85, 0x25, 0x5B, 0xED, 0xCF, 0x7E, 0x8A, 0x4F,
-    0x7F, 0x10, 0x50, 0x68, 0xC3, 0xF8, 0xE3, 0x1A, 0x3E, 0x14, 0xF4, 0xA4, 0x0E, 0x1E, 0x7D, 0x93,
-    0x0F, 0x68, 0x54, 0x39, 0x93, 0x5E, 0x3B, 0xEE, 0x1B, 0x0A, 0xA4, 0xC4, 0x4B, 0xD2, 0x91, 0xD4,
-    0x4D, 0x12, 0x4C, 0xDC, 0xCA, 0x0B, 0xE3, 0xB3, 0x58, 0x32, 0x1D, 0x17, 0xBE, 0x23, 0xB8, 0x30,
-    0x9C, 0x7B, 0x1C, 0x3C, 0x24, 0x10, 0xF6, 0x0B, 0x25, 0xAA, 0xF5, 0x91, 0x83, 0xBD, 0x93, 0xA1,
-    0x99, 0xE3, 0xAD, 0x75, 0xC4, 0x7B, 0xD2, 0xD8, 0x48, 0xAA, 0x6E, 0x2E, 0xBE, 0x27, 0xCF, 0x47,
-    0x8C, 0x5C, 0x45, 0xE2, 0x8B, 0x7D, 0x0F, 0x3C, 0x05, 0x42, 0xC6, 0x9A, 0xF9, 0xD1, 0x90, 0xC7,
-    0x5E, 0x7A, 0x6E, 0x5C, 0x66, 0x71, 0x88, 0x09, 0x4F, 0xE4, 0x90, 0xA3, 0xF6, 0x87, 0x54, 0x41,
-    0xB6, 0x39, 0xCA, 0x06, 0x43, 0xD8, 0xC3, 0x29, 0xC6, 0x9C, 0x39, 0xB3, 0x93, 0xBB, 0x25, 0x81,
-    0xA4, 0x45, 0x5A, 0x2F, 0xB9, 0xB8, 0x17, 0xBD, 0x0E, 0xBE, 0xE6, 0xB6, 0xA6, 0xE2, 0x69, 0xE9,
-    0xE3, 0xFB, 0xCF, 0xC8, 0xB4, 0x8F, 0x71, 0x42, 0xD4, 0x84, 0x2C, 0xCD, 0xA6, 0xF7, 0xFB, 0x21,
-    0x91, 0x27, 0x7D, 0x84, 0xD5, 0xB4, 0x30, 0xF5, 0xBF, 0x29, 0x63, 0x83, 0xD2, 0xF3, 0x40, 0x9C,
-    0x09, 0x44, 0xB8, 0x68, 0x22, 0x3E, 0x05, 0x2F, 0x81, 0x25, 0x21, 0x74, 0xE9, 0xA0, 0x72, 0x98,
-    0x33, 0xB0, 0x55, 0x48, 0x41, 0x8E, 0x20, 0xA3, 0x60, 0x5C, 0x99, 0x6E, 0xD1, 0xEE, 0x55, 0xAB,
-    0xE3, 0xCC, 0x56, 0x38, 0x9E, 0x26, 0x5B, 0x03, 0x9E, 0x79, 0x53, 0x42, 0x62, 0x0B, 0x23, 0x65,
-    0xFC, 0xC2, 0x25, 0x37, 0xDD, 0xE2, 0xC0, 0xCD, 0xD1, 0xD6, 0x5D, 0xFC, 0xCB, 0xD4, 0x36, 0x4E,
-    0x1A, 0x9F, 0xA2, 0xF0, 0xA1, 0x42, 0xE7, 0x3B, 0x48, 0xF8, 0x88, 0x76, 0xA2, 0xE2, 0x9C, 0xC8,
-    0x65, 0x82, 0x25, 0x65, 0x59, 0xDC, 0x0D, 0xBD, 0x0E, 0xAC, 0xA4, 0x6F, 0x7D, 0x31, 0xB4, 0x88,
-    0x50, 0xBF, 0x03, 0x5D, 0x51, 0xB1, 0x6E, 0x13, 0x41, 0x14, 0x9C, 0x3D, 0x47, 0xD9, 0x44, 0x27,
-    0x65, 0x4D, 0x47, 0x95, 0xE5, 0x07, 0xCC, 0xF1, 0x01, 0xC6, 0x77, 0x4A, 0xEB, 0x86, 0x4F, 0xE0,
-    0x03, 0x62, 0x39, 0xD5, 0x89, 0x02, 0x74, 0x4B, 0x1A, 0x17, 0x14, 0xF0, 0x03, 0x88, 0x16, 0x1D,
-    0x52, 0x22, 0x24, 0x24, 0x28, 0x12, 0xBC, 0x49, 0x0A, 0x4A, 0x56, 0x50, 0x46, 0x22, 0x67, 0x97,
-    0x8E, 0x04, 0x2B, 0x61, 0xD9, 0x07, 0xBA, 0xCB, 0xE3, 0xF9, 0x5C, 0x80, 0x58, 0xAD, 0xF4, 0xB4,
-    0xBB, 0x33, 0xF3, 0x66, 0xDE, 0xE2, 0x1E, 0x50, 0xA2, 0x55, 0x40, 0x19, 0xC4, 0x54, 0x67, 0x54,
-    0x6B, 0x83, 0xD0, 0x22, 0xF0, 0xC0, 0x1C, 0x68, 0x03, 0x5B, 0x80, 0xB2, 0xD0, 0x35, 0x34, 0xB9,
-    0xE8, 0xE8, 0xA3, 0xEA, 0x3F, 0x4B, 0xF6, 0x0A, 0xE0, 0x03, 0x70, 0x17, 0x08, 0x0D, 0x02, 0x3E,
-    0xF0, 0xDA, 0x06, 0x74, 0x02, 0xE9, 0x20, 0xE6, 0xAC, 0x13, 0xD3, 0x0D, 0x04, 0xEB, 0xFA, 0x15,
-    0x57, 0x35, 0x80, 0xBF, 0xE8, 0x86, 0xAA, 0xFA, 0xA3, 0xBD, 0xDF, 0xD7, 0x45, 0x44, 0x4E, 0x90,
-    0x83, 0x76, 0x80, 0x6D, 0x60, 0xC9, 0x03, 0x74, 0x15, 0x54, 0xF2, 0x38, 0x28, 0x84, 0x1F, 0x13,
-    0x8D, 0x88, 0xCA, 0x5D, 0xC6, 0x3F, 0x0A, 0x8D, 0x30, 0x0F, 0x81, 0x17, 0x88, 0x13, 0x75, 0x23,
-    0xBF, 0x97, 0xEF, 0xA6, 0x76, 0x07, 0x28, 0xB0, 0x83, 0x83, 0xE9, 0xE8, 0xDB, 0x89, 0x26, 0xC4,
-    0x06, 0x6B, 0x2F, 0x9B, 0xC7, 0xCC, 0x0C, 0x7F, 0x61, 0x6C, 0x55, 0x86, 0x79, 0xA5, 0x5A, 0xDE,
-    0xB3, 0x0D, 0x4E, 0x2A, 0xE8, 0x35, 0xA7, 0xD8, 0xAC, 0x91, 0x39, 0x7D, 0x24, 0xA7, 0x93, 0x72,
-    0xB7, 0x27, 0x26, 0x06, 0xB7, 0x79, 0x00, 0xDB, 0xFA, 0xB0, 0x38, 0xED, 0x04, 0x4B, 0xA7, 0x2A,
-    0xC4, 0xE7, 0x54, 0x45, 0x64, 0x56, 0x52, 0x87, 0xA6, 0xD7, 0x55, 0x17, 0x17, 0xBE, 0x73, 0x1A,
-    0x50, 0xA2, 0x0B, 0x41, 0x95, 0xA2, 0xB5, 0x51, 0x1C, 0x00, 0x3D, 0x20, 0xE2, 0x3D, 0xCB, 0x23,
-    0xA2, 0x2B, 0xBE, 0x26, 0x1E, 0xDF, 0x2C, 0xE7, 0xE0, 0xE8, 0x70, 0x33, 0xC6, 0xDC, 0x02, 0xE4,
-    0x3E, 0xC4, 0xC2, 0x23, 0x1B, 0x5A, 0xBD, 0x20, 0xB9, 0x1C, 0x54, 0x27, 0xE9, 0xD7, 0x2F, 0x72,
-    0xB0, 0x81, 0xD4, 0x41, 0x0E, 0xF0, 0x4F, 0x11, 0x1B, 0x6B, 0x61, 0x0E, 0xF1, 0x84, 0x87, 0x65,
-    0xF3, 0xBC, 0x8A, 0x89, 0xBB, 0x05, 0x3F, 0x89, 0xE6, 0xF9, 0x9B, 0x72, 0xF5, 0x53, 0xE8, 0x02,
-    0x0C, 0x6B, 0x27, 0xFF, 0x71, 0xB9, 0xDC, 0x49, 0x5D, 0xFF, 0xD3, 0xE0, 0x7E, 0x96, 0x5E, 0x9D,
-    0xD1, 0xD0, 0xCB, 0x45, 0x05, 0x3D, 0xE4, 0x37, 0x0B, 0xD1, 0x6E, 0x64, 0x25, 0x0B, 0xF7, 0xA4,
-    0x0B, 0x7C, 0x68, 0xA3, 0xD9, 0xF1, 0x39, 0x11, 0x7D, 0xB6, 0x88, 0x14, 0x6B, 0xEB, 0xD9, 0xD8,
-    0xE8, 0xA7, 0x25, 0x3A, 0x2D, 0x8B, 0x76, 0x63, 0xA2, 0xE5, 0x10, 0x3B, 0x49, 0xC5, 0x78, 0xB8,
-    0xAC, 0xDF, 0x4F, 0xD2, 0x33, 0x5C, 0xA2, 0xB5, 0x8F, 0x97, 0x6F, 0x9F, 0x2F, 0x7E, 0xBC, 0xBA,
-    0xE6, 0x11, 0x24, 0xA1, 0x47, 0x08, 0xFC, 0x01, 0x7D, 0x52, 0xB1, 0x6E, 0x14, 0x31, 0x10, 0x7D,
-    0xF6, 0x12, 0xB9, 0xD8, 0xC2, 0x29, 0x8E, 0x26, 0x14, 0x57, 0x53, 0xC0, 0xFE, 0xC0, 0xB1, 0xF6,
-    0x29, 0x45, 0xDA, 0x14, 0xD0, 0xD0, 0x23, 0x21, 0x24, 0x94, 0x1F, 0x20, 0xD9, 0xE3, 0x0B, 0xB8,
-    0x22, 0x9F, 0x90, 0x02, 0xAE, 0xA2, 0xA0, 0xB8, 0x02, 0xB4, 0x56, 0xAE, 0xA4, 0x59, 0x71, 0xF4,
-    0x39, 0x29, 0xE9, 0x52, 0x60, 0x45, 0x46, 0x72, 0xA2, 0xDD, 0x1D, 0xC6, 0x7B, 0xA4, 0x8D, 0x65,
-    0x4B, 0xB6, 0x66, 0xDE, 0x9B, 0x79, 0x6F, 0x0C, 0x00, 0x63, 0x0B, 0x02, 0x4A, 0x60, 0x09, 0xB9,
-    0x41, 0x6E, 0xE9, 0xBD, 0xA6, 0xD0, 0x15, 0xAB, 0x8D, 0xD1, 0x76, 0x69, 0x0E, 0x9A, 0x9A, 0x40,
-    0x01, 0xB5, 0xC5, 0xB0, 0x8E, 0xAE, 0x26, 0x28, 0xE8, 0x8F, 0xD3, 0xB7, 0xD5, 0x46, 0xB4, 0xA2,
-    0x83, 0x41, 0xE5, 0x33, 0x5F, 0x54, 0x28, 0xF3, 0xB5, 0x57, 0x97, 0xDE, 0xC0, 0xB4, 0x99, 0xCF,
-    0x68, 0x4A, 0x30, 0x44, 0x5E, 0x11, 0x75, 0x82, 0x88, 0x66, 0x65, 0x4E, 0x73, 0x0C, 0x24, 0x3B,
-    0x80, 0x68, 0x01, 0xD3, 0x40, 0x71, 0xE1, 0x3E, 0x60, 0xFC, 0xC9, 0x65, 0xFE, 0x07, 0x4E, 0x94,
-    0xD7, 0x8D, 0x99, 0xB6, 0xB2, 0x35, 0x56, 0xAF, 0x18, 0xC7, 0xF8, 0x5F, 0x8B, 0xC5, 0x17, 0x86,
-    0x98, 0xF4, 0xE8, 0xF2, 0x73, 0xFF, 0xC0, 0xDE, 0x99, 0x1E, 0xF2, 0x7E, 0x38, 0x67, 0xCB, 0x33,
-    0x08, 0xC9, 0xA8, 0x35, 0x74, 0x1E, 0xA0, 0x1D, 0x4B, 0x10, 0x11, 0xCA, 0xB1, 0x01, 0x25, 0xC6,
-    0x6E, 0x1B, 0x58, 0x7C, 0xDE, 0xAB, 0x57, 0xD4, 0x3E, 0x7E, 0x05, 0xC8, 0xC5, 0x9C, 0x35, 0x41,
-    0xFD, 0x06, 0x22, 0xA0, 0x2D, 0x84, 0xE7, 0x8E, 0x98, 0x61, 0x03, 0x1C, 0x23, 0x11, 0x7C, 0xE5,
-    0x28, 0xCD, 0x60, 0x02, 0x04, 0x2B, 0xD2, 0x1C, 0xC6, 0xE1, 0x23, 0x14, 0x7F, 0x49, 0x12, 0xF5,
-    0xFA, 0x63, 0x9C, 0x4C, 0xA4, 0xFB, 0x16, 0xF4, 0xFE, 0x9A, 0x8D, 0x60, 0x43, 0xA2, 0x8A, 0x95,
-    0x03, 0x46, 0xC9, 0xFC, 0x39, 0x14, 0xF7, 0x13, 0x77, 0xEF, 0x79, 0x0B, 0xA4, 0x29, 0xA4, 0x71,
-    0x64, 0x0D, 0xF0, 0x02, 0xA9, 0x2F, 0x7C, 0x00, 0x72, 0x87, 0x37, 0x91, 0x7D, 0xB0, 0x92, 0x3C,
-    0x54, 0xDC, 0x0E, 0x23, 0x5F, 0x85, 0xDE, 0xCC, 0xF8, 0x52, 0xE8, 0x75, 0xEC, 0x19, 0x19, 0x9F,
-    0x56, 0x37, 0xD7, 0x3F, 0xBB, 0xD1, 0xDE, 0xF4, 0x6C, 0x54, 0x5D, 0x5E, 0x5F, 0x1C, 0xBF, 0xAD,
-    0x9C, 0x38, 0x1B, 0x72, 0x95, 0x45, 0xE6, 0x20, 0x99, 0x94, 0xE9, 0x69, 0x9F, 0xE8, 0x26, 0x19,
-    0x51, 0x42, 0x13, 0x1D, 0xF0, 0x9C, 0x74, 0x93, 0x2A, 0xB1, 0x24, 0xE9, 0xF1, 0x7F, 0x3D, 0xE3,
-    0x02, 0x21, 0x09, 0x13, 0xD4, 0xA0, 0x0A, 0x90, 0x64, 0x39, 0xFB, 0x96, 0x35, 0xB2, 0xD6, 0x27,
-    0x2C, 0x54, 0x7C, 0xCF, 0xFA, 0xD3, 0x44, 0xD0, 0x88, 0x77, 0xE4, 0xEE, 0x61, 0xCF, 0xF9, 0xD4,
-    0x73, 0x3E, 0x81, 0xE5, 0xA5, 0xA6, 0x18, 0x76, 0xD4, 0x89, 0x9A, 0xAE, 0x34, 0xFF, 0x80, 0xD4,
-    0xAE, 0x7D, 0xBD, 0x64, 0x17, 0xBC, 0xB9, 0x7B, 0x39, 0x00, 0xFE, 0x01,
+static const uint8_t opendyslexic_8_boldBitmaps[16361] = {
+    0xA5, 0x58, 0x3D, 0x8C, 0x1C, 0x47, 0x76, 0xFE, 0xBA, 0x4B, 0xDC, 0x82, 0xD9, 0x80, 0x4A, 0x01,
+    0x05, 0x1F, 0x44, 0x9D, 0x4B, 0xC1, 0x25, 0x77, 0xE6, 0xB1, 0x1D, 0x28, 0x20, 0x8C, 0x99, 0xA9,
+    0x3E, 0x6E, 0x40, 0xC0, 0xB2, 0x41, 0x06, 0x22, 0x0C, 0xFB, 0x0C, 0xC8, 0x81, 0x03, 0x9D, 0x81,
+    0x03, 0x1D, 0x30, 0x60, 0x30, 0x33, 0xDD, 0x12, 0x71, 0x56, 0x70, 0x01, 0xD7, 0x06, 0x94, 0xF8,
+    0x02, 0x12, 0x86, 0x0E, 0x90, 0x28, 0x03, 0x14, 0x60, 0xC1, 0x60, 0x30, 0xBB, 0x5D, 0xE4, 0x04,
+    0x1B, 0x38, 0x60, 0x91, 0x7B, 0x10, 0x83, 0x0B, 0xD8, 0x22, 0x75, 0x58, 0x58, 0x0C, 0x58, 0x2B,
+    0x16, 0x8F, 0xBD, 0x64, 0x75, 0x7F, 0x0E, 0x66, 0x56, 0xA2, 0x64, 0xF1, 0xE4, 0xD3, 0x55, 0x63,
+    0x6A, 0xBA, 0x1B, 0x0F, 0x5F, 0xBF, 0x7A, 0x3F, 0x55, 0xDF, 0x7B, 0x10, 0xF0, 0x03, 0x25, 0xAE,
+    0xF8, 0xB1, 0xCE, 0xAE, 0xFA, 0xB1, 0x04, 0x00, 0xA8, 0xF9, 0x83, 0xBE, 0xFE, 0xB7, 0xB5, 0x1F,
+    0xFC, 0xF3, 0x3B, 0xD4, 0x5B, 0xA1, 0x54, 0xD7, 0xA3, 0x39, 0xE6, 0xFB, 0xDC, 0x22, 0x7B, 0xB3,
+    0x01, 0x46, 0xAA, 0x02, 0xC2, 0x10, 0x10, 0x2E, 0x40, 0x91, 0x0C, 0x25, 0x49, 0xFB, 0xD7, 0x0F,
+    0xD6, 0x5F, 0x85, 0xBA, 0xEA, 0x01, 0xA3, 0x2C, 0x4A, 0x92, 0x73, 0x92, 0xDD, 0xBE, 0x53, 0xBF,
+    0xF8, 0xCD, 0x09, 0x6C, 0xE8, 0x0A, 0x69, 0x58, 0x07, 0xF6, 0xFF, 0xCB, 0x3B, 0x58, 0x0C, 0x05,
+    0x60, 0x00, 0xAC, 0xEC, 0x16, 0x09, 0x09, 0x45, 0x8F, 0x8D, 0x31, 0xD2, 0x07, 0x1E, 0xD9, 0x63,
+    0x0B, 0xC5, 0x35, 0x28, 0xB6, 0x48, 0xD9, 0x42, 0x9E, 0xF7, 0xCF, 0xFE, 0x89, 0xB6, 0xEC, 0x99,
+    0x91, 0x7E, 0x85, 0xBB, 0xC0, 0x61, 0x00, 0x97, 0x81, 0xC4, 0x01, 0x58, 0x29, 0x00, 0x9F, 0x57,
+    0x87, 0xB3, 0xEF, 0x0A, 0xDB, 0x34, 0x21, 0x7B, 0x56, 0xA3, 0xDC, 0x72, 0x69, 0x98, 0x01, 0x3A,
+    0xAF, 0xC4, 0xF6, 0x5F, 0x61, 0xFC, 0x41, 0xA3, 0x7E, 0xFE, 0x6C, 0xEA, 0x4B, 0x37, 0x49, 0xDA,
+    0xFD, 0x15, 0xA0, 0x3F, 0xC1, 0x64, 0x82, 0x0F, 0x14, 0x3E, 0x50, 0x98, 0xE5, 0x30, 0x11, 0xAA,
+    0x81, 0xF1, 0x07, 0x66, 0xB3, 0x61, 0xD4, 0xEB, 0x9D, 0x8C, 0x35, 0x5B, 0xC3, 0x98, 0xED, 0xC2,
+    0xCC, 0x5B, 0xB3, 0x1A, 0xCC, 0xD1, 0x0B, 0xF0, 0x99, 0x1D, 0x8B, 0x46, 0x23, 0x0A, 0xA7, 0x31,
+    0x4B, 0xBD, 0xAA, 0x46, 0x88, 0xC2, 0x67, 0x56, 0x17, 0x23, 0xC4, 0xB4, 0x15, 0x3E, 0x6B, 0x94,
+    0x7D, 0xA1, 0x18, 0x22, 0x87, 0xAA, 0xA4, 0x15, 0x4D, 0xEA, 0x11, 0xD0, 0x62, 0x86, 0x19, 0xC6,
+    0x18, 0x63, 0x86, 0x19, 0x22, 0xDA, 0x24, 0x08, 0x2F, 0x7C, 0xE6, 0xB4, 0x35, 0xC5, 0x3F, 0x2E,
+    0xEC, 0xF0, 0x9D, 0x9D, 0x39, 0xBB, 0x83, 0x3D, 0xCA, 0x60, 0xF8, 0xF1, 0xAF, 0xFF, 0x0E, 0x1F,
+    0x02, 0xC0, 0x73, 0xC8, 0x2A, 0x5C, 0x46, 0x56, 0x19, 0x6E, 0xB1, 0x43, 0xBB, 0x78, 0x4C, 0xF0,
+    0x83, 0xB3, 0xD1, 0x9C, 0x0D, 0xA5, 0x6A, 0x6A, 0xDE, 0xA3, 0xFF, 0xFE, 0xA8, 0xAC, 0x01, 0x00,
+    0x87, 0x80, 0x00, 0x78, 0x24, 0x1E, 0x69, 0x03, 0xE1, 0x20, 0x2C, 0x32, 0x0B, 0x55, 0x41, 0x15,
+    0xD0, 0xC0, 0x61, 0x60, 0x08, 0x8C, 0x81, 0x19, 0xD0, 0x02, 0x01, 0xA9, 0x87, 0xF0, 0x10, 0x0D,
+    0xA4, 0x5B, 0x0A, 0xEA, 0x02, 0x39, 0x30, 0x02, 0x5E, 0x06, 0x0A, 0x20, 0x6D, 0xF1, 0x28, 0x1C,
+    0x96, 0x73, 0x37, 0x18, 0xDF, 0xBF, 0x79, 0x6D, 0x3A, 0x7B, 0x78, 0xF7, 0xDA, 0x68, 0x22, 0xB7,
+    0x7D, 0x67, 0x78, 0x95, 0x51, 0x11, 0x79, 0x95, 0xAC, 0xC9, 0x56, 0xF4, 0xB8, 0x55, 0x89, 0x06,
+    0x2D, 0x46, 0x50, 0x95, 0x68, 0xD0, 0x4A, 0x7E, 0xC6, 0xAE, 0x66, 0x71, 0xB0, 0x15, 0xF4, 0xD3,
+    0x53, 0x16, 0x33, 0x64, 0x16, 0x11, 0x79, 0x95, 0x79, 0xD9, 0x25, 0xAC, 0x0C, 0x37, 0xD9, 0x95,
+    0x74, 0x07, 0x5B, 0xC1, 0xF0, 0x9C, 0xB4, 0x18, 0x40, 0xDA, 0x32, 0x64, 0x2C, 0x92, 0x08, 0x79,
+    0xE3, 0xED, 0xCE, 0x70, 0x93, 0x6D, 0xDE, 0x01, 0x0A, 0xC2, 0xA3, 0x86, 0xF6, 0xE2, 0x16, 0x3E,
+    0x0C, 0x5A, 0xAD, 0x7E, 0xDA, 0xD7, 0xFC, 0xED, 0xFB, 0x84, 0xAE, 0x92, 0x16, 0x79, 0x05, 0x00,
+    0x82, 0xC1, 0x70, 0xD5, 0x62, 0x00, 0x61, 0x61, 0x5A, 0xC9, 0x70, 0x40, 0x5B, 0xCC, 0xBE, 0xA7,
+    0xE7, 0x8C, 0x25, 0x8F, 0xD1, 0x25, 0x05, 0x12, 0x5A, 0xC6, 0xFC, 0xE4, 0xAA, 0xC5, 0xA4, 0x93,
+    0x6C, 0xEB, 0xD7, 0xFE, 0xDB, 0x8D, 0xD6, 0xC5, 0x76, 0x33, 0x32, 0xF7, 0xAE, 0x33, 0xCA, 0x1E,
+    0x40, 0xC6, 0x58, 0xD3, 0x22, 0x42, 0x55, 0x49, 0x40, 0x5E, 0x08, 0x8F, 0x12, 0x99, 0x47, 0x0F,
+    0xD5, 0x24, 0x1D, 0x92, 0x77, 0x61, 0xBA, 0xD4, 0xCF, 0x54, 0x11, 0x4C, 0x66, 0xCB, 0x1E, 0x65,
+    0x50, 0x1F, 0x85, 0x89, 0xF8, 0xCC, 0xAB, 0xCD, 0xA6, 0x54, 0x6C, 0x73, 0xDA, 0xEC, 0x13, 0xC8,
+    0x36, 0x65, 0x18, 0x64, 0x9B, 0xC5, 0xF0, 0x43, 0x71, 0xB3, 0x1A, 0x8D, 0x4E, 0xDD, 0x66, 0xBF,
+    0xC2, 0x06, 0xC3, 0xD1, 0xA5, 0x39, 0x5B, 0xD3, 0x01, 0x80, 0xDA, 0xDC, 0x89, 0x35, 0x00, 0x18,
+    0xBD, 0xF9, 0x59, 0x44, 0xD2, 0xE6, 0x67, 0xA3, 0xB1, 0x00, 0xB0, 0xEF, 0x68, 0xCC, 0xAF, 0xB6,
+    0xE6, 0x98, 0x7F, 0x1E, 0x00, 0x0A, 0x24, 0x2D, 0x12, 0x56, 0x29, 0x5D, 0xCA, 0xB5, 0x84, 0x15,
+    0x74, 0x8F, 0x84, 0x5C, 0xC3, 0x29, 0x3A, 0x1C, 0xEC, 0x16, 0xF1, 0x9F, 0x32, 0x1A, 0x5A, 0x00,
+    0x27, 0x8F, 0x32, 0x9A, 0xBE, 0x3A, 0x00, 0xA4, 0x01, 0xC8, 0xDB, 0xE5, 0xAF, 0x03, 0xF2, 0x16,
+    0x92, 0xC5, 0x29, 0xB6, 0x86, 0x6B, 0xA2, 0x2F, 0x70, 0x64, 0x91, 0x80, 0x59, 0x48, 0x18, 0xD5,
+    0xF5, 0xF6, 0x3B, 0x89, 0x87, 0x70, 0x50, 0x05, 0xC6, 0x10, 0x1E, 0x75, 0xA1, 0x02, 0x4C, 0x81,
+    0x08, 0xE1, 0xF1, 0x47, 0xCB, 0x64, 0x4D, 0xD7, 0xA0, 0x2A, 0x94, 0x48, 0x23, 0x80, 0x7F, 0x00,
+    0x34, 0x2B, 0xAC, 0xA7, 0x4D, 0xDA, 0xE0, 0x65, 0x31, 0x8F, 0x87, 0xB2, 0xBF, 0x38, 0xF4, 0xA2,
+    0xFA, 0xCB, 0x17, 0x5F, 0x54, 0xE7, 0xE2, 0x11, 0x35, 0xBF, 0xE7, 0xB3, 0x66, 0xA5, 0x10, 0x5D,
+    0x52, 0x24, 0xA4, 0x45, 0x49, 0x8B, 0x95, 0xBE, 0x5A, 0x24, 0x7D, 0x81, 0x34, 0x02, 0xC6, 0x41,
+    0xF6, 0xC0, 0x23, 0x0F, 0x7D, 0xBC, 0x48, 0x7D, 0x84, 0xC9, 0x9C, 0x6C, 0xA6, 0x20, 0xBD, 0x26,
+    0xDF, 0x24, 0xA3, 0x29, 0xD4, 0x4D, 0x8F, 0xBE, 0xEC, 0x51, 0xD2, 0x4E, 0xA5, 0x9F, 0x24, 0x7E,
+    0x92, 0xF8, 0xE9, 0x8F, 0x9B, 0x92, 0xB6, 0x64, 0x98, 0x24, 0x71, 0x82, 0x58, 0xBE, 0x1F, 0x4B,
+    0xC6, 0x92, 0xA1, 0xE4, 0x1A, 0x00, 0xE4, 0x7D, 0xC2, 0x5E, 0xB2, 0x53, 0xE1, 0x19, 0x6D, 0x61,
+    0x0A, 0x98, 0x02, 0x65, 0x81, 0xB2, 0x82, 0x69, 0xF6, 0x19, 0x76, 0x9A, 0x5D, 0xC6, 0x2E, 0x61,
+    0x57, 0xF6, 0x95, 0x66, 0x2F, 0xC9, 0x8F, 0xDB, 0x34, 0x4E, 0x91, 0xBF, 0x56, 0x89, 0xED, 0x06,
+    0xBB, 0x2D, 0xCC, 0x14, 0xEA, 0x7C, 0x75, 0x6A, 0x9B, 0x7C, 0x40, 0xC6, 0x92, 0x51, 0xB3, 0xC5,
+    0x9F, 0xD2, 0x93, 0xF3, 0x47, 0x27, 0x95, 0x85, 0x01, 0xBA, 0xD7, 0x05, 0x83, 0xA2, 0x35, 0x40,
+    0x84, 0x78, 0x74, 0x51, 0x31, 0x96, 0x7C, 0x40, 0x36, 0x9A, 0x37, 0xD8, 0xE5, 0x6F, 0x1F, 0xF5,
+    0x30, 0x10, 0x6C, 0x0D, 0xCF, 0x32, 0x18, 0x08, 0x8F, 0xE5, 0x24, 0x3D, 0xF0, 0xC2, 0x7B, 0xC8,
+    0xD8, 0x81, 0x6C, 0xB3, 0x5D, 0x9C, 0x30, 0x16, 0xE8, 0x00, 0xE1, 0x01, 0x6D, 0xFF, 0xFC, 0x44,
+    0x09, 0xFA, 0x2E, 0xA9, 0xB7, 0x22, 0xA6, 0x59, 0xFF, 0x7E, 0x50, 0xA4, 0x53, 0x64, 0xB1, 0xC2,
+    0x35, 0x18, 0xE4, 0xCA, 0x66, 0x5B, 0x3E, 0x0D, 0x11, 0xEB, 0x06, 0xE6, 0xB8, 0x55, 0x5B, 0x5E,
+    0x84, 0xFE, 0x62, 0x6F, 0xC8, 0x73, 0xE4, 0x1D, 0xB2, 0xED, 0xD0, 0x97, 0x85, 0x39, 0xEF, 0x94,
+    0x37, 0x6A, 0xEE, 0xE3, 0x13, 0x93, 0x76, 0x48, 0x03, 0x94, 0xC3, 0x42, 0x67, 0x0F, 0x65, 0x31,
+    0x45, 0xD2, 0x42, 0x36, 0xC8, 0x0B, 0xAC, 0x2F, 0x5E, 0x9D, 0x28, 0x05, 0x5B, 0x45, 0x67, 0x3A,
+    0xEC, 0x2B, 0xA0, 0xE6, 0xAD, 0xD8, 0x89, 0x68, 0x3B, 0x8C, 0x4A, 0xE8, 0x1A, 0x92, 0x55, 0x42,
+    0x8B, 0xDA, 0x21, 0x6F, 0xA1, 0x58, 0x09, 0x46, 0x44, 0x5A, 0xA3, 0xA2, 0xBE, 0x42, 0x97, 0x03,
+    0x33, 0xA4, 0x1E, 0x99, 0x7D, 0xF2, 0x1B, 0xCB, 0xDB, 0xE7, 0x15, 0x3B, 0xC3, 0x07, 0xA4, 0x33,
+    0x56, 0x7A, 0x16, 0x66, 0xDE, 0x83, 0x2A, 0x66, 0x9D, 0x69, 0x4D, 0xE0, 0x0E, 0xB7, 0x78, 0x8B,
+    0xC7, 0xEF, 0x71, 0xDD, 0x98, 0x47, 0x21, 0xF2, 0xD6, 0x9D, 0x1D, 0x9A, 0x73, 0xF3, 0xB6, 0x2F,
+    0xD5, 0xD6, 0x6E, 0xB7, 0x4F, 0x35, 0xFB, 0x0A, 0xF5, 0x96, 0x17, 0xD7, 0xFB, 0x24, 0x94, 0x76,
+    0x92, 0xB7, 0xFA, 0x15, 0xCA, 0x1B, 0x8F, 0x6F, 0xFB, 0x7E, 0x36, 0x33, 0xE7, 0x2F, 0xA9, 0x3B,
+    0x9C, 0xB7, 0xA5, 0xEF, 0x55, 0x34, 0x57, 0xA9, 0xBD, 0xB1, 0x38, 0xF5, 0x09, 0x32, 0xB6, 0xE0,
+    0x2F, 0x5A, 0xE9, 0x45, 0x30, 0x90, 0x3E, 0x42, 0xCD, 0x1B, 0x18, 0x5D, 0x21, 0x1A, 0x08, 0xCF,
+    0xA2, 0x9C, 0x93, 0x94, 0x64, 0xC8, 0xC8, 0x6A, 0x85, 0x9F, 0x2C, 0x83, 0x1C, 0x75, 0x9B, 0xB2,
+    0xCB, 0xEC, 0x2C, 0x47, 0x88, 0x72, 0x8B, 0x3C, 0xCE, 0x68, 0x58, 0xF5, 0x6B, 0xCB, 0xD5, 0x14,
+    0xE8, 0x20, 0x03, 0x80, 0x7D, 0x05, 0x50, 0xB7, 0x90, 0x24, 0x54, 0x53, 0x56, 0x79, 0xA5, 0xAC,
+    0x81, 0x74, 0x06, 0xA2, 0x99, 0x42, 0xF8, 0x11, 0x84, 0x37, 0x89, 0x68, 0xCC, 0xEA, 0x5D, 0x97,
+    0x93, 0x56, 0x91, 0x95, 0x24, 0x81, 0x9A, 0x15, 0xC0, 0x06, 0x30, 0x2D, 0x00, 0xE8, 0x1E, 0x39,
+    0xED, 0xE1, 0xB4, 0x39, 0x9C, 0xF8, 0xC3, 0x89, 0x1F, 0x09, 0x6F, 0xE8, 0x0C, 0xAD, 0xA1, 0x33,
+    0xAB, 0xDE, 0xAC, 0x06, 0xB3, 0xDA, 0x9A, 0xD5, 0x58, 0x9E, 0x8D, 0x58, 0x7C, 0x54, 0xD3, 0x0A,
+    0x06, 0x6C, 0x24, 0x50, 0x16, 0x88, 0x40, 0xB6, 0x0B, 0x18, 0x16, 0xA8, 0x09, 0xE8, 0x16, 0xC8,
+    0xED, 0xE5, 0x34, 0x6A, 0xF2, 0x2C, 0xE9, 0xF7, 0x2F, 0xD6, 0x55, 0x92, 0xB7, 0xC8, 0x87, 0x64,
+    0xC4, 0x0C, 0xC8, 0x0B, 0x64, 0x0E, 0x69, 0x00, 0x3A, 0xC0, 0x14, 0x50, 0x0E, 0x62, 0xF9, 0x50,
+    0x41, 0x35, 0x58, 0x04, 0xD0, 0x96, 0x17, 0x21, 0xA2, 0xFB, 0x3C, 0xCE, 0x7C, 0x44, 0x34, 0x30,
+    0xCA, 0xE9, 0x39, 0xE9, 0x6B, 0xB6, 0x9A, 0x5D, 0xC2, 0x0E, 0x00, 0x0C, 0x84, 0x8F, 0xD0, 0x6F,
+    0xB6, 0xE8, 0x84, 0x17, 0x5E, 0xB9, 0xBC, 0xCA, 0x6D, 0x87, 0x32, 0xF3, 0xE8, 0x4D, 0x95, 0xF6,
+    0x1D, 0x24, 0x3D, 0x14, 0x2B, 0xE4, 0x1D, 0x50, 0x7A, 0x80, 0x8B, 0x9D, 0x00, 0x06, 0x48, 0xA2,
+    0x29, 0x90, 0xB6, 0xA6, 0x82, 0x08, 0xB9, 0x3D, 0x20, 0xBC, 0xB6, 0xEB, 0xD2, 0x2B, 0xC7, 0xAC,
+    0x51, 0xB7, 0x79, 0xDC, 0x65, 0xF7, 0x79, 0xCD, 0xCA, 0xC7, 0xBC, 0x67, 0x25, 0xEF, 0xB2, 0x12,
+    0xBC, 0xC9, 0x42, 0x70, 0x4E, 0xA4, 0x7C, 0x93, 0x48, 0x08, 0x42, 0x57, 0x99, 0x8D, 0x68, 0xA5,
+    0x37, 0xC8, 0x5F, 0x71, 0xE8, 0x22, 0x32, 0x16, 0x30, 0x0D, 0xD2, 0x0E, 0x30, 0x1E, 0x8A, 0x55,
+    0xDA, 0x77, 0x28, 0x8F, 0x7B, 0xE5, 0xCD, 0x3C, 0xA6, 0xBD, 0x81, 0xBA, 0x1A, 0xD2, 0x56, 0x59,
+    0x83, 0x8D, 0xAC, 0x11, 0x3E, 0x22, 0xBF, 0x54, 0x81, 0x1E, 0xAA, 0x07, 0x4A, 0x0B, 0xD1, 0x02,
+    0xA6, 0xFA, 0xFC, 0x2F, 0x42, 0x91, 0xAE, 0x66, 0x27, 0x49, 0x07, 0xDD, 0x42, 0x10, 0xA0, 0x85,
+    0xF1, 0x50, 0x1D, 0x04, 0x2B, 0xB0, 0x81, 0xE9, 0x2F, 0xCA, 0x05, 0x0D, 0x7A, 0x8B, 0x8C, 0x2A,
+    0x1A, 0x1F, 0x84, 0xD3, 0x18, 0x27, 0x5E, 0x5A, 0x8D, 0x71, 0xEA, 0x33, 0x9B, 0xEF, 0x71, 0x86,
+    0x56, 0x34, 0xAA, 0x1A, 0x82, 0x5B, 0x3C, 0xDE, 0x01, 0xC0, 0x4B, 0x78, 0x19, 0x47, 0x30, 0xC0,
+    0x0F, 0xA1, 0xA1, 0xA0, 0xAA, 0xCC, 0x0A, 0x27, 0x9A, 0xD4, 0x27, 0x01, 0x11, 0x33, 0x9C, 0xC6,
+    0x9F, 0xE1, 0x39, 0xE3, 0x69, 0xF3, 0x3D, 0xB8, 0x01, 0x82, 0x70, 0xAA, 0x18, 0x22, 0x88, 0x66,
+    0x09, 0x98, 0x55, 0x39, 0x66, 0xE5, 0x0E, 0x37, 0xB9, 0x64, 0x56, 0x22, 0xE2, 0xB1, 0x1F, 0x66,
+    0x16, 0x80, 0x22, 0xB7, 0xC8, 0x70, 0xF2, 0xE4, 0xAB, 0x13, 0x4C, 0x51, 0x02, 0x00, 0xCA, 0xCB,
+    0x9A, 0x73, 0x17, 0x8F, 0xC8, 0xCD, 0x62, 0x70, 0x5A, 0x6E, 0xB1, 0xCB, 0xD9, 0xD4, 0x53, 0x20,
+    0xF1, 0x90, 0x16, 0x1A, 0x18, 0x00, 0x3B, 0x6B, 0x82, 0x41, 0xD1, 0x9B, 0xA3, 0x4D, 0x14, 0x73,
+    0xAF, 0x32, 0x3B, 0xCB, 0xD9, 0x94, 0x44, 0xED, 0x71, 0x00, 0x00, 0xEA, 0x1F, 0xB1, 0xE9, 0x30,
+    0x80, 0x86, 0x74, 0xE8, 0xFE, 0x5E, 0x33, 0xA9, 0x2B, 0x60, 0x0F, 0x61, 0x8C, 0xC4, 0x67, 0x77,
+    0x2D, 0xA9, 0x7E, 0x1D, 0x07, 0x72, 0xA7, 0xD1, 0x6F, 0xB9, 0x0D, 0xC5, 0x56, 0xD3, 0x1F, 0xBC,
+    0x6B, 0xD3, 0x0E, 0x7D, 0x3B, 0xFA, 0xE3, 0x39, 0xFB, 0xE9, 0x2F, 0x8F, 0x39, 0x18, 0x7E, 0xCC,
+    0x3E, 0x65, 0x01, 0xA8, 0xA6, 0x3E, 0xEB, 0x54, 0xC2, 0x87, 0xDC, 0xFC, 0x8D, 0xAA, 0x46, 0x68,
+    0x65, 0xA3, 0xAB, 0x29, 0x56, 0x7E, 0xBB, 0xC3, 0x7E, 0xA8, 0xB7, 0xAB, 0x8D, 0xD3, 0x72, 0xBB,
+    0xDA, 0x30, 0xBC, 0xC1, 0x2E, 0xA3, 0x7B, 0x66, 0x80, 0xEC, 0xEA, 0xE3, 0xD6, 0x30, 0x65, 0xA5,
+    0xBF, 0xD8, 0x80, 0x46, 0x40, 0xDF, 0x09, 0x46, 0x75, 0x3D, 0x8C, 0x92, 0xA6, 0x95, 0xF3, 0x26,
+    0xD7, 0xD5, 0xAC, 0x14, 0x3B, 0x51, 0xD9, 0xC9, 0xFA, 0xC6, 0x7B, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+    0xC6, 0xE3, 0xC9, 0x04, 0x17, 0xA4, 0xCD, 0x17, 0xE1, 0x98, 0xE3, 0x72, 0xDA, 0x64, 0xD5, 0x61,
+    0x7C, 0x98, 0x3A, 0x55, 0x0C, 0xE1, 0x8D, 0xA5, 0x0C, 0xC0, 0x62, 0x67, 0x6B, 0x90, 0x55, 0x18,
+    0x01, 0xE1, 0x1D, 0x71, 0xCB, 0xAA, 0x08, 0x63, 0xC1, 0x42, 0xB0, 0xD0, 0xAC, 0x26, 0xF5, 0x1B,
+    0xA1, 0xB6, 0x87, 0x85, 0x1B, 0x0A, 0x37, 0x14, 0x76, 0x20, 0xED, 0x58, 0xDA, 0xB1, 0xFC, 0x55,
+    0xB9, 0xD9, 0x01, 0x80, 0xDE, 0x78, 0xA5, 0xD1, 0xBC, 0xD7, 0xE6, 0x67, 0xDB, 0x49, 0x9E, 0x86,
+    0x91, 0x49, 0xFD, 0xC8, 0x08, 0x6F, 0x8C, 0xF0, 0x66, 0x2A, 0x1B, 0x33, 0xCD, 0x9C, 0x01, 0xC4,
+    0xBD, 0xC6, 0x70, 0x1E, 0x26, 0x43, 0xB1, 0xE5, 0x46, 0x43, 0xB1, 0xDD, 0x98, 0xA9, 0x78, 0xE8,
+    0x4D, 0xDA, 0x25, 0x6C, 0x47, 0xF2, 0xA6, 0x1D, 0x8D, 0xC5, 0xFD, 0x07, 0x1B, 0x86, 0xD7, 0xD9,
+    0xA6, 0x1D, 0xF0, 0x0C, 0x74, 0x6D, 0xD5, 0x23, 0xAF, 0xDC, 0x11, 0x65, 0x07, 0xCA, 0x0E, 0x94,
+    0x1B, 0xA8, 0x3E, 0x6A, 0x06, 0x4D, 0x97, 0xEF, 0x83, 0x01, 0x0C, 0x30, 0x05, 0x7E, 0xB2, 0x38,
+    0xBD, 0x1F, 0x79, 0xCD, 0x66, 0xA0, 0x9A, 0x33, 0x99, 0x3B, 0x2D, 0xDD, 0x38, 0xB3, 0x86, 0x36,
+    0xA7, 0xCD, 0x78, 0x05, 0xA2, 0x87, 0xE8, 0x21, 0x76, 0x91, 0x16, 0xF9, 0x2C, 0xEF, 0xF2, 0x5F,
+    0xE5, 0xC8, 0x61, 0x60, 0x60, 0x50, 0x16, 0x00, 0xF2, 0xA0, 0xDE, 0x87, 0x47, 0xB6, 0x8B, 0x2C,
+    0x42, 0x36, 0x7D, 0x6F, 0x78, 0xA5, 0x6E, 0x16, 0x36, 0x3B, 0x83, 0x11, 0x54, 0x65, 0xA8, 0xE8,
+    0x86, 0x50, 0x85, 0x70, 0x08, 0x18, 0x5D, 0x50, 0x51, 0xB0, 0x00, 0xCE, 0x88, 0x9B, 0x76, 0x38,
+    0x16, 0x5B, 0x76, 0x34, 0x90, 0x77, 0xDC, 0x86, 0xE1, 0x6D, 0xF6, 0xD9, 0xE3, 0x66, 0x88, 0x51,
+    0x8E, 0xB1, 0x2E, 0x5A, 0x75, 0xD5, 0xCB, 0x3B, 0x8D, 0x78, 0x6C, 0x13, 0x5A, 0xB0, 0x40, 0x5D,
+    0x4C, 0x20, 0xEE, 0x37, 0x18, 0x99, 0x4C, 0xDE, 0xD8, 0x89, 0x33, 0x5D, 0xDE, 0xB2, 0x64, 0xAB,
+    0xC8, 0xA2, 0xA6, 0x17, 0x6D, 0x0F, 0x93, 0x39, 0x00, 0x50, 0x36, 0x8A, 0xDB, 0x3E, 0xA1, 0x43,
+    0x5D, 0xA1, 0x44, 0x42, 0x2B, 0x1E, 0x7B, 0xB5, 0xD5, 0x9A, 0xAA, 0x1B, 0xA2, 0x9D, 0x09, 0xD7,
+    0xEA, 0x34, 0xB4, 0xE2, 0xBE, 0xCB, 0x08, 0xD5, 0x22, 0x5F, 0x1E, 0x7B, 0x99, 0xCB, 0x88, 0x3C,
+    0x60, 0x03, 0x50, 0xF4, 0x86, 0x16, 0x1D, 0x94, 0x4D, 0x22, 0x72, 0x2B, 0xFA, 0x57, 0x15, 0x43,
+    0x49, 0x8F, 0xBA, 0xA8, 0x9D, 0x81, 0xB2, 0xA2, 0x41, 0x8B, 0x29, 0x08, 0x53, 0x65, 0x1E, 0x13,
+    0xE8, 0x42, 0xBA, 0x24, 0xA0, 0x6C, 0x54, 0x8B, 0xBF, 0x41, 0x7A, 0xF7, 0xA7, 0xFF, 0xF5, 0xEB,
+    0x9F, 0x3E, 0xBC, 0x35, 0xB8, 0x7F, 0x6D, 0x60, 0x2A, 0x15, 0x91, 0x43, 0xBA, 0x24, 0x60, 0x02,
+    0x55, 0x89, 0x1E, 0x65, 0x65, 0x9C, 0xB2, 0xC2, 0x23, 0xC2, 0x80, 0x55, 0x69, 0xF7, 0x17, 0xD0,
+    0x87, 0xFA, 0xFF, 0x3C, 0xFF, 0xB3, 0x03, 0x00, 0x5E, 0x7A, 0xE9, 0xD0, 0x91, 0xD1, 0x64, 0x34,
+    0xC9, 0x47, 0xF2, 0x71, 0x33, 0x5D, 0x97, 0x3F, 0x2F, 0x4E, 0x14, 0x40, 0xB2, 0x0F, 0x47, 0x4E,
+    0x8B, 0x87, 0x4D, 0x76, 0xAB, 0x1A, 0x4D, 0xD4, 0xBD, 0xF9, 0x43, 0x7F, 0x68, 0x90, 0xA4, 0x48,
+    0x02, 0x20, 0x1B, 0x40, 0xDB, 0xBD, 0x33, 0x0A, 0x01, 0xC8, 0x2D, 0x44, 0x07, 0x94, 0x0D, 0xD4,
+    0x25, 0x24, 0x21, 0x20, 0x57, 0x56, 0xF8, 0x75, 0x4C, 0x65, 0xA3, 0xC8, 0x84, 0x6C, 0x73, 0x72,
+    0x1E, 0xD0, 0x95, 0x50, 0x0D, 0x92, 0x02, 0x18, 0x00, 0x59, 0x01, 0x78, 0x7C, 0x65, 0xFC, 0xBE,
+    0x7C, 0x0C, 0xB2, 0x40, 0x12, 0x81, 0xD2, 0x43, 0x1F, 0x73, 0xDF, 0x1A, 0xE5, 0xC2, 0xEB, 0xD0,
+    0xC7, 0x6D, 0xDA, 0x46, 0x98, 0xF3, 0xF6, 0x5B, 0xA3, 0xFC, 0x3E, 0x8C, 0x0F, 0x19, 0xA0, 0x1C,
+    0xF6, 0x37, 0x50, 0x95, 0xB2, 0xC8, 0x1C, 0xB2, 0x65, 0x10, 0x5F, 0xE2, 0x9C, 0x54, 0xFF, 0xF3,
+    0xEA, 0x82, 0xAC, 0x3C, 0xB8, 0xA0, 0xE8, 0x0C, 0x97, 0x14, 0xE6, 0xD3, 0x77, 0x0D, 0x77, 0xC8,
+    0x9B, 0x64, 0x85, 0xEF, 0x2E, 0x37, 0xB7, 0xE7, 0x9F, 0xB4, 0xDF, 0xFF, 0x93, 0x1A, 0x02, 0x80,
+    0x87, 0x6A, 0xF0, 0xD8, 0xAB, 0xA3, 0x0B, 0x27, 0xEC, 0x67, 0x34, 0xF4, 0xFD, 0xDB, 0xAB, 0x0B,
+    0x6E, 0xF1, 0xB7, 0x60, 0x27, 0xE8, 0x17, 0x38, 0xFD, 0xC5, 0xB3, 0xA4, 0x66, 0x57, 0xB2, 0x55,
+    0x9B, 0xCE, 0xE4, 0x45, 0xDC, 0x58, 0xF9, 0xF7, 0x45, 0xDD, 0x9C, 0xD6, 0x54, 0x8C, 0xE6, 0x97,
+    0x27, 0x16, 0x0A, 0x7E, 0x54, 0x19, 0x16, 0x8C, 0x4B, 0x82, 0x72, 0xF1, 0x02, 0xB9, 0x49, 0xBE,
+    0xC6, 0x7E, 0x04, 0x65, 0xC5, 0xD2, 0xDB, 0xC2, 0x3F, 0xED, 0x92, 0x21, 0x11, 0x57, 0x9A, 0xB0,
+    0x34, 0xFF, 0x97, 0x39, 0xA3, 0xDA, 0x0C, 0x68, 0x60, 0x0A, 0xD5, 0x09, 0x17, 0xF6, 0x96, 0xFB,
+    0x24, 0x9D, 0xFD, 0xBA, 0x49, 0x06, 0x8C, 0x72, 0x7D, 0x6E, 0xF3, 0xFE, 0x83, 0x77, 0xDF, 0xDB,
+    0xF3, 0xEA, 0x5E, 0x22, 0x7C, 0xDD, 0x8D, 0x0C, 0xC0, 0xF0, 0x9F, 0x90, 0x47, 0x64, 0x87, 0x97,
+    0xF2, 0xC9, 0x09, 0xF1, 0x71, 0x44, 0x28, 0xAB, 0x89, 0xF6, 0xFA, 0x95, 0x5E, 0xDE, 0xE0, 0x95,
+    0xB0, 0xD1, 0xCE, 0xCC, 0xA5, 0x5C, 0x6D, 0xDF, 0x9D, 0xB7, 0xF4, 0xBD, 0x8E, 0xE6, 0x2C, 0x95,
+    0xAF, 0x37, 0xA3, 0xF2, 0x68, 0x01, 0x44, 0x00, 0xDD, 0xE7, 0x2E, 0x49, 0xEA, 0x35, 0xE4, 0x6C,
+    0x44, 0x7F, 0xAA, 0xD1, 0x56, 0xB9, 0x08, 0x3D, 0xF7, 0x30, 0xAA, 0x42, 0x9C, 0x42, 0xF8, 0x08,
+    0x35, 0xEF, 0x12, 0x2A, 0x32, 0x6A, 0xD2, 0xE5, 0xEC, 0x71, 0x70, 0x51, 0x3C, 0x00, 0xC5, 0xA2,
+    0x29, 0x31, 0x06, 0x84, 0xFB, 0x6A, 0xA2, 0x7C, 0x7B, 0x5A, 0x29, 0x2C, 0x60, 0x0A, 0x08, 0x16,
+    0x18, 0xAA, 0x6A, 0x0F, 0x6E, 0xA5, 0x2F, 0x50, 0xB3, 0x52, 0xBB, 0x75, 0x55, 0xC2, 0xAC, 0x7A,
+    0x94, 0xCA, 0x22, 0x8E, 0x20, 0x76, 0x5A, 0xA8, 0xB9, 0x87, 0x51, 0x41, 0x46, 0x43, 0xFA, 0x92,
+    0x2C, 0x6A, 0xB6, 0x38, 0xD5, 0x17, 0x00, 0x80, 0x77, 0x5E, 0x87, 0xB8, 0xED, 0xA1, 0xAF, 0x39,
+    0xD4, 0xA6, 0xF8, 0x43, 0xE1, 0xD2, 0x06, 0x30, 0x8B, 0x8A, 0x71, 0x6F, 0xC8, 0x20, 0x76, 0xBB,
+    0x27, 0xC8, 0xDF, 0x92, 0x09, 0x2A, 0xAB, 0xE6, 0x5E, 0xF8, 0x2E, 0x89, 0x86, 0xCC, 0xC8, 0x37,
+    0x48, 0xA7, 0xB9, 0xB0, 0x53, 0x02, 0xA4, 0x0E, 0xF0, 0xC0, 0xE5, 0xFF, 0x63, 0x37, 0xED, 0xD4,
+    0x76, 0xF8, 0x32, 0x9D, 0x0C, 0x4B, 0x3A, 0x69, 0xD5, 0x3C, 0x48, 0x4F, 0xC6, 0x9C, 0xBD, 0x24,
+    0x8B, 0x92, 0xC5, 0xB2, 0x31, 0x94, 0x35, 0xC8, 0xFA, 0x45, 0xB7, 0x69, 0xCF, 0xAB, 0x8B, 0xEA,
+    0xE6, 0x4B, 0x2A, 0x1D, 0x5F, 0xA8, 0x14, 0x11, 0x4D, 0x51, 0x2A, 0xF2, 0x2A, 0xD9, 0x94, 0x0C,
+    0x92, 0x61, 0x51, 0xB2, 0x5E, 0x40, 0x9C, 0xC0, 0xE4, 0x95, 0xBE, 0xF6, 0x87, 0xE0, 0xE8, 0x02,
+    0x53, 0x24, 0x11, 0xBF, 0x8B, 0x39, 0x0D, 0x20, 0x2B, 0x04, 0xEC, 0x7B, 0x62, 0xDD, 0xF2, 0xF1,
+    0x1B, 0x8C, 0x43, 0x35, 0xAF, 0xC6, 0xA7, 0xC5, 0x66, 0x31, 0x31, 0xBC, 0xC1, 0x3E, 0x7B, 0xD8,
+    0x00, 0xC8, 0xAA, 0xA4, 0xC3, 0x34, 0xE8, 0x65, 0x90, 0x7D, 0x3D, 0xA4, 0x3E, 0x7E, 0x35, 0xC4,
+    0xFC, 0xDC, 0xD5, 0x77, 0xDE, 0xFD, 0x06, 0xB4, 0xAF, 0xD0, 0xB0, 0x9C, 0x09, 0x2B, 0x55, 0xAC,
+    0x78, 0x44, 0x4C, 0xA0, 0x9E, 0xD4, 0x7D, 0x41, 0x73, 0x9C, 0xBA, 0x77, 0xF6, 0xE3, 0xB1, 0xE1,
+    0xF6, 0xA7, 0xAF, 0x4E, 0x20, 0xD8, 0x6B, 0x36, 0x79, 0xC0, 0x01, 0x08, 0x8B, 0x33, 0x50, 0x5F,
+    0xF5, 0xDE, 0xD3, 0x98, 0xDA, 0x19, 0x28, 0x27, 0x58, 0x84, 0xC9, 0x37, 0x8A, 0xEE, 0x5F, 0x79,
+    0x23, 0xC4, 0xFC, 0xDC, 0xBC, 0xED, 0xBE, 0x51, 0x74, 0x82, 0x29, 0xA6, 0x8B, 0x08, 0x18, 0xC0,
+    0x0B, 0xAB, 0x30, 0x4E, 0xBC, 0x74, 0xBA, 0x78, 0xF6, 0x87, 0x83, 0x03, 0x00, 0x0E, 0x7C, 0xC1,
+    0xDB, 0x00, 0x55, 0xA4, 0x11, 0x1B, 0xFE, 0xB0, 0xB4, 0x7B, 0xDD, 0x44, 0xBF, 0x37, 0x25, 0x1E,
+    0x1A, 0x49, 0x80, 0x2E, 0x80, 0xC1, 0x78, 0x32, 0x59, 0x5F, 0x5F, 0xE4, 0xE1, 0xDE, 0x25, 0xAD,
+    0xB4, 0xD2, 0x49, 0x97, 0xDC, 0xAE, 0xCC, 0x7F, 0x88, 0x53, 0xD5, 0xF7, 0x2E, 0x00, 0x00, 0x46,
+    0xBD, 0x60, 0x34, 0xC7, 0xB6, 0xDC, 0x70, 0x28, 0xEE, 0xB8, 0xD1, 0x54, 0x3C, 0x6C, 0x4C, 0x29,
+    0xFC, 0x97, 0xFC, 0x9F, 0x3B, 0xCD, 0xB3, 0xCD, 0x64, 0x2C, 0xB6, 0xAD, 0x31, 0x3F, 0xBE, 0xC3,
+    0x4E, 0xB3, 0xCA, 0xDD, 0xC2, 0x7C, 0x97, 0xBF, 0x64, 0xBE, 0xA7, 0x51, 0xB7, 0xD3, 0xD0, 0x56,
+    0xF2, 0x47, 0x4B, 0xCB, 0x3D, 0x45, 0x6A, 0xCF, 0x68, 0xBB, 0xF1, 0x77, 0x49, 0x3D, 0xA9, 0x99,
+    0xAC, 0x86, 0x63, 0x71, 0xD3, 0x0E, 0x07, 0xE2, 0x8E, 0x9D, 0x0E, 0xB3, 0x3B, 0xEC, 0x73, 0x36,
+    0xF5, 0xC6, 0xD7, 0x69, 0xF6, 0x14, 0x62, 0x86, 0x33, 0x50, 0xEE, 0x0B, 0xCD, 0x9E, 0x22, 0xA5,
+    0x8F, 0x5F, 0x79, 0x32, 0x2E, 0x9F, 0x86, 0x75, 0xAA, 0x79, 0xFE, 0x64, 0x4A, 0xB2, 0x53, 0xBB,
+    0x35, 0xA3, 0xB6, 0xCA, 0xC1, 0x20, 0x6B, 0x60, 0x90, 0x3D, 0x58, 0x1B, 0x21, 0x63, 0x33, 0x45,
+    0xC6, 0xA6, 0x84, 0xF2, 0x30, 0x95, 0xF2, 0x30, 0xE4, 0xA3, 0x77, 0x35, 0xC9, 0x2E, 0x23, 0xD9,
+    0x27, 0x35, 0xB9, 0x28, 0x66, 0xD2, 0xDD, 0xEC, 0x13, 0x49, 0xDE, 0x5B, 0x6D, 0xCA, 0x9F, 0xED,
+    0x78, 0xC5, 0x6E, 0x2C, 0x1E, 0xBD, 0xAD, 0x3E, 0xEA, 0x20, 0x96, 0x9D, 0xE7, 0x2E, 0xED, 0xB2,
+    0x45, 0x5F, 0xED, 0xF3, 0x4A, 0x67, 0xD1, 0x16, 0x24, 0x69, 0x48, 0xEE, 0x9C, 0x3C, 0x79, 0xF2,
+    0xE4, 0xC5, 0xCC, 0x97, 0x22, 0x98, 0x37, 0xE3, 0xE7, 0xED, 0xD3, 0x8B, 0x2F, 0xFC, 0x6B, 0x34,
+    0x6F, 0xF9, 0x4E, 0xDD, 0x68, 0xCD, 0x5B, 0xBE, 0x56, 0x6E, 0xD1, 0xED, 0x6E, 0x4B, 0x75, 0xA3,
+    0x2D, 0xD5, 0x56, 0x5B, 0xE2, 0xFB, 0xE9, 0xDA, 0xEB, 0x23, 0xD9, 0xC4, 0x32, 0x6B, 0x62, 0x9D,
+    0xF9, 0xEE, 0x7F, 0x01, 0x95, 0x95, 0x31, 0x88, 0x1D, 0xC7, 0x19, 0xC7, 0xFF, 0x6F, 0xC7, 0xD2,
+    0x82, 0x06, 0x3C, 0x2A, 0xAC, 0x24, 0x38, 0x8E, 0xA7, 0x71, 0xE1, 0x22, 0x78, 0x9B, 0x14, 0x2A,
+    0xDE, 0xDB, 0x59, 0x59, 0x85, 0x0B, 0x41, 0x9E, 0x0A, 0x8B, 0x14, 0x29, 0xE4, 0x36, 0x10, 0x50,
+    0x0A, 0x57, 0xE1, 0xEE, 0xBD, 0xB5, 0xAF, 0x10, 0x44, 0x81, 0x53, 0x9A, 0x34, 0x29, 0x64, 0x82,
+    0x1D, 0xC2, 0x25, 0xE0, 0x83, 0x24, 0x70, 0x31, 0xCF, 0xB7, 0x73, 0xD9, 0xE2, 0x8A, 0x83, 0x64,
+    0xE4, 0x87, 0xAD, 0xC2, 0x04, 0xEF, 0xF9, 0x1C, 0x04, 0x36, 0x44, 0x73, 0xD1, 0xC8, 0x1E, 0x4B,
+    0xB3, 0xFB, 0x4F, 0xF1, 0xCE, 0x89, 0x5C, 0xA4, 0xC8, 0xF0, 0xE7, 0x9B, 0xFF, 0x34, 0x1F, 0xC3,
+    0x7C, 0xDF, 0xFC, 0x3E, 0xB5, 0xEF, 0x4C, 0x51, 0xA5, 0xDD, 0xD3, 0xBF, 0x7E, 0x13, 0x00, 0x90,
+    0x35, 0x54, 0x4C, 0xE6, 0xAD, 0xCB, 0x09, 0xC2, 0x43, 0x7D, 0x50, 0x1B, 0x56, 0x4C, 0xC2, 0x43,
+    0x59, 0x98, 0xAD, 0x37, 0xC8, 0x7D, 0xF2, 0x2A, 0x07, 0xA8, 0x0A, 0x59, 0x02, 0x8C, 0x43, 0x3E,
+    0x00, 0x0F, 0x3D, 0xF4, 0xB4, 0xCA, 0x7C, 0x82, 0x91, 0x2E, 0xEF, 0x66, 0x20, 0xBD, 0x26, 0x5F,
+    0x27, 0x93, 0xA9, 0xD4, 0x1D, 0x8F, 0xE1, 0xCA, 0x95, 0x82, 0x07, 0xEF, 0xBF, 0xE8, 0xB1, 0x80,
+    0xFE, 0x32, 0xE7, 0xA1, 0x5F, 0x5B, 0xCB, 0xAF, 0x8A, 0xBB, 0x0C, 0x4C, 0xE6, 0x13, 0x9C, 0xAB,
+    0x24, 0xDD, 0xB6, 0x92, 0x78, 0x75, 0x5B, 0x5E, 0x62, 0xD7, 0x44, 0x79, 0x25, 0x6C, 0x8B, 0x03,
+    0x8C, 0xDF, 0x79, 0xFB, 0x80, 0xA9, 0x19, 0x00, 0x00, 0x20, 0x5B, 0x52, 0x59, 0x18, 0x60, 0x75,
+    0xBB, 0xAF, 0xDB, 0x0A, 0x09, 0x00, 0x7B, 0x68, 0xBA, 0xD1, 0x83, 0x75, 0x68, 0xD1, 0x8D, 0x7C,
+    0x09, 0x2D, 0xBA, 0xCC, 0x97, 0x28, 0x56, 0xDB, 0x4C, 0x74, 0xC5, 0x43, 0x6E, 0x90, 0xA9, 0x20,
+    0x5F, 0xF3, 0xA3, 0x70, 0x06, 0x4F, 0x7F, 0x95, 0x7B, 0x50, 0xEF, 0xA3, 0x04, 0x22, 0xC4, 0x83,
+    0x57, 0x14, 0xAD, 0x21, 0x22, 0x44, 0x07, 0xFD, 0xE9, 0x9B, 0x73, 0x1E, 0x92, 0xFB, 0x24, 0x72,
+    0xDF, 0x6C, 0x04, 0x0C, 0xC5, 0xC7, 0x09, 0x6A, 0x3F, 0xF4, 0xC8, 0xFA, 0x7E, 0x17, 0x30, 0x4D,
+    0x03, 0xE4, 0x64, 0x05, 0x34, 0xB4, 0x80, 0xA2, 0x05, 0x72, 0x06, 0x20, 0x27, 0x6B, 0x48, 0x32,
+    0x42, 0x0E, 0x03, 0x6B, 0xD5, 0xCF, 0xAF, 0x26, 0x35, 0xE8, 0x8F, 0x69, 0x8B, 0xA0, 0x79, 0x21,
+    0xF3, 0x58, 0x43, 0x21, 0x08, 0xD6, 0x58, 0x40, 0x3F, 0x27, 0x0F, 0xF8, 0x2F, 0xC6, 0x6B, 0x01,
+    0xEB, 0x78, 0x4A, 0x55, 0x66, 0xA3, 0xD3, 0x5D, 0x54, 0xB1, 0xCC, 0xA9, 0x36, 0xD8, 0x1E, 0x3F,
+    0xF2, 0xA9, 0x4F, 0x66, 0x36, 0x57, 0xD4, 0x2D, 0xAF, 0x87, 0xE6, 0x76, 0x5F, 0xF8, 0xE6, 0x52,
+    0x28, 0xBA, 0x53, 0xA8, 0xC4, 0xA7, 0x1E, 0x4C, 0x90, 0x11, 0x5F, 0x5B, 0xFF, 0x5F, 0x1E, 0xD5,
+    0x46, 0x71, 0x9C, 0x10, 0x7B, 0x94, 0x73, 0xE8, 0x06, 0x39, 0xEB, 0x11, 0x2D, 0x1A, 0x87, 0x22,
+    0x42, 0xB1, 0x16, 0x4C, 0x48, 0xB4, 0x46, 0x25, 0xBD, 0x47, 0x37, 0xBA, 0xF2, 0xB2, 0xA2, 0x37,
+    0xB4, 0xC9, 0x08, 0x9F, 0x54, 0xEB, 0x4B, 0x65, 0xA3, 0x11, 0x5D, 0xD2, 0x17, 0xFD, 0xBA, 0xFA,
+    0x4B, 0x30, 0xC6, 0xA6, 0x5E, 0x78, 0x00, 0xA6, 0xD6, 0x6D, 0xCA, 0x92, 0x71, 0xA6, 0xA5, 0x4C,
+    0xC6, 0xB3, 0xE5, 0xAD, 0x54, 0xF2, 0x51, 0x7B, 0x77, 0x58, 0x94, 0xE6, 0xC3, 0xF6, 0x7E, 0x5A,
+    0x18, 0x7D, 0xA3, 0xF5, 0x58, 0x18, 0x28, 0x0B, 0xC0, 0xA0, 0x50, 0x56, 0x2E, 0x7D, 0x16, 0x12,
+    0xDE, 0x35, 0x30, 0x53, 0xAB, 0x96, 0x5E, 0x84, 0x61, 0x6B, 0x30, 0xE4, 0x26, 0x79, 0x44, 0xC6,
+    0x1E, 0xC3, 0xBC, 0x32, 0xB7, 0x9C, 0xF2, 0xB8, 0xF6, 0x09, 0x24, 0x23, 0xF8, 0xAB, 0x98, 0x7B,
+    0x11, 0x0C, 0x72, 0x9F, 0xA0, 0xDA, 0x0E, 0x46, 0xD7, 0x48, 0x06, 0xC2, 0xB3, 0x9A, 0xB7, 0x24,
+    0x73, 0x32, 0x48, 0xB2, 0x3E, 0xCD, 0x4F, 0x00, 0x00, 0xE7, 0xAE, 0x5C, 0x5E, 0xF5, 0x54, 0xBD,
+    0x5E, 0x8E, 0x42, 0xCC, 0x97, 0x9D, 0x9E, 0x3E, 0x66, 0xED, 0xBA, 0x19, 0x85, 0xDF, 0x9E, 0xBE,
+    0x09, 0xA0, 0x89, 0x19, 0x7B, 0x69, 0x17, 0x05, 0x42, 0xCA, 0x97, 0xE4, 0x94, 0xC9, 0xB0, 0x1E,
+    0x6E, 0xFE, 0xA7, 0xF5, 0x7A, 0xE4, 0x61, 0xF5, 0xE4, 0xC5, 0x30, 0xE2, 0x90, 0xB3, 0x57, 0xE1,
+    0x09, 0x6D, 0x61, 0x2A, 0x98, 0x0A, 0xF3, 0x0A, 0xF3, 0x1A, 0xA6, 0x3B, 0x65, 0xD8, 0x6B, 0xF6,
+    0x92, 0xFD, 0x88, 0xFD, 0x9C, 0xFC, 0x88, 0xFC, 0x82, 0x4C, 0x58, 0x00, 0x45, 0x05, 0xE9, 0x90,
+    0x05, 0xA0, 0x07, 0x4C, 0x05, 0xE5, 0x20, 0x4E, 0x0E, 0x35, 0x54, 0x07, 0x60, 0x14, 0xC4, 0xD2,
+    0x17, 0xB9, 0x8B, 0xAA, 0x75, 0xFA, 0x16, 0x4C, 0xC4, 0xDC, 0x81, 0x18, 0x25, 0xE4, 0x0E, 0x06,
+    0x26, 0x82, 0x56, 0xAC, 0xEA, 0x9F, 0x71, 0x10, 0x9F, 0x3D, 0xFA, 0xD8, 0xC6, 0xF1, 0xF6, 0x4C,
+    0x69, 0xDE, 0x6B, 0x49, 0x67, 0xD8, 0x61, 0x06, 0x68, 0x8B, 0xDC, 0x63, 0x94, 0x80, 0x06, 0xD0,
+    0xB5, 0xB4, 0x09, 0x31, 0xF7, 0x06, 0xC5, 0x25, 0x87, 0x3E, 0x41, 0xB2, 0x82, 0xE9, 0x90, 0xF5,
+    0x80, 0xF1, 0x50, 0xAC, 0xB3, 0xA1, 0xC7, 0x7C, 0xEA, 0x95, 0x37, 0x6D, 0xCA, 0x86, 0xA7, 0x50,
+    0x4D, 0xB2, 0xEE, 0x31, 0xF9, 0x72, 0x25, 0x71, 0x22, 0xC3, 0xB4, 0x12, 0x10, 0x81, 0x08, 0xE0,
+    0xEC, 0xE8, 0xD9, 0xD1, 0xDD, 0xEA, 0xCF, 0xEE, 0x85, 0x6D, 0xF9, 0x7B, 0xF1, 0xD9, 0xEB, 0x3D,
+    0x69, 0x1E, 0xED, 0xFD, 0xC2, 0x63, 0x0D, 0x1A, 0xB9, 0x7D, 0x0A, 0xA7, 0xD4, 0xF5, 0xE5, 0xD1,
+    0x61, 0x88, 0x71, 0xBD, 0x2C, 0xF5, 0x74, 0x73, 0x63, 0x79, 0xD4, 0x85, 0x18, 0x27, 0x65, 0xA9,
+    0xA6, 0x9B, 0x1B, 0xEF, 0x1D, 0x75, 0x61, 0x87, 0x1C, 0x0C, 0xF9, 0xB3, 0xAD, 0xAD, 0x9B, 0xE5,
+    0x19, 0x55, 0xC7, 0xF5, 0x52, 0x1C, 0x86, 0xA8, 0xAE, 0x2F, 0xBB, 0x52, 0x4D, 0xEB, 0x30, 0x29,
+    0x85, 0x0B, 0x51, 0x5D, 0x5C, 0x76, 0x13, 0x35, 0xAD, 0xC3, 0xE4, 0x05, 0x41, 0x0E, 0x8A, 0x4C,
+    0x86, 0xF4, 0x80, 0xAA, 0x81, 0x12, 0xC0, 0x1B, 0xF4, 0x30, 0x09, 0x50, 0x80, 0xB0, 0x80, 0x07,
+    0x4C, 0x0F, 0x45, 0x27, 0x6C, 0x82, 0x2F, 0x30, 0xB9, 0x66, 0x15, 0x9D, 0xA0, 0x03, 0x60, 0x00,
+    0xC8, 0xB6, 0x46, 0xE6, 0x3D, 0xB0, 0x18, 0x03, 0x85, 0x02, 0x64, 0x6B, 0x91, 0x79, 0x06, 0x2C,
+    0x0C, 0xAB, 0x62, 0x2A, 0xBC, 0x5C, 0xDA, 0x45, 0x16, 0x1E, 0x34, 0xD8, 0x35, 0xAC, 0xCC, 0x26,
+    0x2B, 0xD5, 0x3D, 0x0F, 0x61, 0x31, 0x3E, 0x09, 0x74, 0x86, 0x17, 0x6D, 0x1A, 0xCB, 0xF6, 0x83,
+    0x64, 0x78, 0x91, 0x0E, 0xCD, 0x4D, 0x70, 0x40, 0x2F, 0xBB, 0x05, 0xD6, 0xCF, 0x41, 0xD5, 0x86,
+    0x5E, 0x31, 0x01, 0x06, 0x50, 0x7F, 0xEB, 0xF4, 0x11, 0x19, 0xE6, 0x4C, 0x8A, 0x3D, 0xE6, 0x5F,
+    0x7D, 0x63, 0x79, 0x81, 0xF5, 0x1F, 0xE7, 0x94, 0xD3, 0xBD, 0xF0, 0x27, 0x2F, 0x6F, 0x10, 0x6B,
+    0x4D, 0x27, 0x0E, 0x06, 0x8C, 0xDF, 0xF1, 0xF9, 0x81, 0xFE, 0x20, 0x6E, 0x93, 0x97, 0x72, 0x76,
+    0xDB, 0xDF, 0x0E, 0x40, 0x13, 0x05, 0xA3, 0xB4, 0x3B, 0xB2, 0x5E, 0xA8, 0x7A, 0x21, 0xED, 0x22,
+    0x67, 0xCA, 0x98, 0x04, 0x93, 0xDC, 0x4B, 0xCA, 0x26, 0xBD, 0xD7, 0x9B, 0xBD, 0xDE, 0xEC, 0xF5,
+    0xAB, 0xD4, 0xF3, 0x1D, 0xCD, 0xD6, 0xA5, 0xF3, 0xF9, 0x7E, 0x35, 0x7E, 0x35, 0x5F, 0xB2, 0x2F,
+    0xD8, 0x35, 0x33, 0x00, 0xC0, 0x65, 0x5C, 0x43, 0x13, 0x25, 0xED, 0x0C, 0xE2, 0xB8, 0x52, 0xF4,
+    0x86, 0x7E, 0x50, 0x47, 0x5E, 0x6F, 0xDA, 0x59, 0x71, 0x3D, 0x1A, 0xDA, 0xA6, 0xC7, 0xBC, 0x66,
+    0xF7, 0x70, 0xC7, 0x8F, 0x1F, 0x46, 0x46, 0xFF, 0xC2, 0xC3, 0x86, 0x03, 0xA3, 0x61, 0xCB, 0x54,
+    0x42, 0x78, 0x98, 0xAF, 0x07, 0x00, 0x60, 0x00, 0x03, 0x3E, 0x0F, 0xA3, 0xE3, 0x90, 0x1D, 0x07,
+    0x71, 0x1C, 0xE4, 0xED, 0x60, 0x48, 0xC3, 0xA1, 0xD8, 0x7A, 0x57, 0x63, 0x0D, 0x40, 0xD6, 0x63,
+    0x88, 0xE5, 0x37, 0x5B, 0x0E, 0xB3, 0xB7, 0x5E, 0x72, 0x30, 0x3C, 0xE4, 0x90, 0xB1, 0xCA, 0xBB,
+    0x41, 0x39, 0x11, 0x58, 0xD4, 0x48, 0xBB, 0x06, 0x98, 0xBD, 0xDB, 0x03, 0x05, 0x23, 0xA0, 0xE8,
+    0x81, 0x9C, 0x0E, 0x90, 0xEC, 0x00, 0xC3, 0x84, 0x11, 0xC9, 0x4A, 0xF6, 0x9C, 0xBB, 0x22, 0xB0,
+    0x88, 0xDA, 0xFD, 0xD2, 0x8A, 0x0B, 0x3F, 0x56, 0x3E, 0xBB, 0xFD, 0x83, 0xCD, 0xBE, 0xE8, 0xC6,
+    0xC2, 0xFB, 0xA2, 0xB5, 0x54, 0x2A, 0x4D, 0x76, 0xFD, 0x17, 0x77, 0x5B, 0x6A, 0x15, 0xD6, 0xCC,
+    0x5E, 0x48, 0xB9, 0x03, 0x70, 0xF6, 0x89, 0xE2, 0xED, 0xEB, 0xB4, 0xF3, 0xFA, 0xA4, 0x00, 0xDD,
+    0x73, 0xE7, 0x8B, 0x27, 0x55, 0x7B, 0xE0, 0xEF, 0x2F, 0xCA, 0x8F, 0xA6, 0xF7, 0x97, 0x21, 0xA4,
+    0x72, 0x52, 0x8A, 0x03, 0x3B, 0xF1, 0xA2, 0xC7, 0xBC, 0xCE, 0x23, 0x1A, 0x2F, 0x6F, 0xB9, 0x38,
+    0xAF, 0x4F, 0x6F, 0x49, 0xCA, 0xA9, 0x9C, 0x4A, 0xA5, 0x94, 0x52, 0x4A, 0x1B, 0xFD, 0xFC, 0x29,
+    0x00, 0x05, 0xA2, 0x79, 0x2D, 0x9A, 0x36, 0x9A, 0x65, 0x32, 0x9F, 0xA5, 0x92, 0x8B, 0x09, 0x17,
+    0x93, 0xDD, 0xC5, 0x64, 0xB2, 0x28, 0xBF, 0x95, 0x00, 0x59, 0x4F, 0x76, 0xC4, 0x87, 0x76, 0xB2,
+    0x10, 0x1F, 0xDA, 0xC9, 0xEE, 0xEF, 0x3E, 0xE2, 0x40, 0xDE, 0xB3, 0xB3, 0x94, 0x77, 0x59, 0x3F,
+    0x62, 0x2C, 0xF3, 0x3B, 0xB6, 0x5C, 0x13, 0xF7, 0x1F, 0xEC, 0x1A, 0xDE, 0x66, 0xCC, 0x7A, 0x18,
+    0x7A, 0xB2, 0xED, 0x0A, 0x55, 0x2F, 0xCA, 0xCC, 0x47, 0xF9, 0x98, 0xB5, 0x00, 0xF0, 0x04, 0x74,
+    0x63, 0xD5, 0x43, 0xAF, 0xDC, 0x79, 0x65, 0xC7, 0xCA, 0x8E, 0x95, 0x1B, 0xAB, 0x21, 0x69, 0x06,
+    0x4D, 0x57, 0x9C, 0x82, 0x01, 0x0C, 0x30, 0x03, 0x7E, 0x04, 0x00, 0x68, 0x2E, 0xB0, 0xEB, 0x31,
+    0x86, 0x46, 0xEE, 0xD0, 0xBF, 0xA2, 0x39, 0x6A, 0x6A, 0xC3, 0x48, 0x1E, 0xE6, 0x16, 0x05, 0xB0,
+    0x40, 0xE6, 0x21, 0x2D, 0x8A, 0x93, 0x51, 0x0B, 0x60, 0x82, 0xB8, 0x10, 0x2E, 0xEA, 0x2C, 0x44,
+    0x71, 0xDF, 0x49, 0x42, 0x45, 0x14, 0x6E, 0x35, 0x8C, 0xA5, 0x93, 0x44, 0x11, 0xB0, 0x0B, 0x40,
+    0x02, 0xD7, 0xD8, 0xE9, 0x7B, 0xF7, 0x5A, 0x17, 0xCA, 0xB1, 0x7A, 0xF1, 0xC8, 0x86, 0xD2, 0x4C,
+    0x7F, 0x78, 0x9B, 0x4C, 0x19, 0x07, 0x20, 0x00, 0xAA, 0x02, 0x02, 0x70, 0x0A, 0x28, 0x10, 0xD5,
+    0xEB, 0x3E, 0xBF, 0xE3, 0x32, 0xD6, 0x20, 0x30, 0x20, 0x63, 0x2D, 0xE9, 0x74, 0xEB, 0xCD, 0x8B,
+    0x09, 0x40, 0x29, 0xBA, 0xC7, 0xB5, 0x22, 0xD0, 0x0A, 0x36, 0x4F, 0x6F, 0xAD, 0x60, 0x13, 0xCE,
+    0x9E, 0x75, 0x47, 0xE2, 0xE7, 0x4F, 0x7E, 0x6F, 0x87, 0xDD, 0x6F, 0xEA, 0x27, 0x71, 0xBE, 0x3C,
+    0xA3, 0x36, 0x4F, 0xF0, 0x72, 0x42, 0x94, 0xE5, 0xFF, 0x26, 0xCA, 0xC6, 0x8A, 0x28, 0x71, 0x52,
+    0x8A, 0x2E, 0xEC, 0x7C, 0x85, 0x90, 0xAD, 0xAD, 0xB7, 0x6B, 0x60, 0x06, 0x8C, 0x02, 0x30, 0xAA,
+    0xBE, 0x61, 0x45, 0xC2, 0xC8, 0xE2, 0x19, 0x8C, 0xFE, 0x01, 0xDD, 0x8F, 0x6E, 0x77, 0xDF, 0x51,
+    0x23, 0x76, 0x3A, 0x02, 0x67, 0x00, 0xB1, 0x0F, 0x1C, 0x5B, 0x8C, 0x7F, 0x02, 0xF5, 0xEC, 0x65,
+    0xB1, 0x4F, 0x1C, 0xBF, 0xD7, 0x4D, 0x5E, 0x3D, 0xAF, 0xAE, 0x0E, 0xE2, 0xCE, 0x80, 0x00, 0xD8,
+    0x1C, 0xCF, 0xE0, 0xA7, 0x17, 0x78, 0xE7, 0xA5, 0xBF, 0xAB, 0xF9, 0x97, 0xAC, 0x01, 0xDD, 0x9F,
+    0x16, 0x0E, 0x6B, 0xD0, 0x82, 0x0E, 0xC7, 0xD5, 0xA2, 0x49, 0x32, 0xA2, 0x6B, 0x2E, 0xDE, 0xE0,
+    0xF7, 0xC7, 0xAA, 0x74, 0xDF, 0x65, 0xF5, 0x87, 0x7F, 0x8A, 0xBF, 0x9A, 0xE6, 0x3C, 0x83, 0x6B,
+    0x2A, 0x9C, 0xC3, 0x3C, 0x2A, 0xF1, 0x5A, 0x37, 0xD6, 0xC2, 0x32, 0x49, 0xEE, 0x85, 0x64, 0x64,
+    0xEB, 0xFB, 0x46, 0x39, 0x35, 0xAD, 0x62, 0xD4, 0xB7, 0xEA, 0xFF, 0x8E, 0xFF, 0xC2, 0xA9, 0x7B,
+    0x1B, 0x87, 0x6B, 0x86, 0x77, 0x3F, 0x7D, 0x79, 0x1D, 0x82, 0x83, 0x66, 0x57, 0x84, 0x7F, 0x03,
+    0xAD, 0x9A, 0x4F, 0x8C, 0xDD, 0x56, 0x96, 0xDE, 0x7F, 0xE4, 0x55, 0x99, 0xB1, 0x19, 0xE8, 0x2A,
+    0x40, 0x69, 0xC6, 0x91, 0xDB, 0xE2, 0x2C, 0x3C, 0x80, 0xAD, 0xB6, 0x8A, 0x13, 0xA0, 0x17, 0x42,
+    0xE3, 0xBD, 0x77, 0x29, 0x2B, 0x89, 0x80, 0x36, 0x10, 0xD5, 0x42, 0x4E, 0x82, 0x19, 0x60, 0xA6,
+    0x17, 0xB3, 0x70, 0x1A, 0x83, 0xC8, 0x0B, 0x2D, 0x14, 0xE4, 0xBD, 0x22, 0x6D, 0xA1, 0xA1, 0x85,
+    0x83, 0xB1, 0x06, 0x48, 0xEF, 0x92, 0xD8, 0x01, 0xEC, 0xA0, 0x5B, 0x1E, 0x44, 0x06, 0x46, 0x08,
+    0x14, 0xA0, 0xAA, 0x78, 0xAD, 0xB7, 0xD0, 0xC2, 0x40, 0x4C, 0xB9, 0x66, 0xA2, 0x4D, 0x10, 0x53,
+    0x5D, 0x9D, 0x28, 0x70, 0x0F, 0xA2, 0x2B, 0x8B, 0xB6, 0x29, 0xE9, 0x92, 0x27, 0x0B, 0x56, 0x95,
+    0x4A, 0x1E, 0xDB, 0x3D, 0xB2, 0xC3, 0x22, 0xF8, 0xFE, 0xD4, 0x7B, 0xE7, 0xBB, 0xE7, 0xBC, 0x7B,
+    0xBF, 0xF3, 0x9D, 0x73, 0x79, 0xE8, 0xAC, 0x37, 0x57, 0x7C, 0x5A, 0x00, 0xC0, 0x33, 0xFA, 0x68,
+    0xA3, 0xB3, 0x46, 0x67, 0xAD, 0x2E, 0x2E, 0xC7, 0xC5, 0xA5, 0xC7, 0x80, 0x57, 0xF8, 0x1E, 0x31,
+    0x71, 0x93, 0xF4, 0xFA, 0xCF, 0xA3, 0x0F, 0x82, 0x4F, 0xED, 0xEC, 0x3D, 0xDD, 0x85, 0x52, 0x27,
+    0x2D, 0x35, 0x47, 0x58, 0x00, 0x08, 0xD6, 0x89, 0xA5, 0xD2, 0xC1, 0x79, 0x0D, 0x1A, 0xA2, 0x82,
+    0x5C, 0x6C, 0x2E, 0x36, 0xAC, 0x09, 0x1D, 0x49, 0x8D, 0x91, 0xF3, 0x46, 0x9A, 0x43, 0x17, 0xDE,
+    0x06, 0x9E, 0x89, 0x43, 0x91, 0x48, 0x1A, 0xFD, 0xBA, 0x9D, 0x24, 0x99, 0x78, 0x2D, 0xDE, 0x88,
+    0xFB, 0x9D, 0x90, 0x09, 0x26, 0xAE, 0x0D, 0xBD, 0xC9, 0xB4, 0x14, 0xA1, 0x58, 0x8C, 0x25, 0x12,
+    0x52, 0xB1, 0x5A, 0x20, 0x79, 0xE8, 0x45, 0x41, 0x54, 0x03, 0x3C, 0x7F, 0xE7, 0xC3, 0x51, 0xC6,
+    0xB3, 0x9B, 0x7F, 0x7A, 0xE4, 0x06, 0xAA, 0x55, 0xF2, 0x7E, 0xF5, 0xE3, 0x95, 0x4C, 0x77, 0xF1,
+    0xAD, 0xB9, 0x6D, 0xA4, 0x4B, 0x25, 0x90, 0x22, 0x6C, 0xEA, 0x71, 0x29, 0x71, 0xCF, 0x73, 0x07,
+    0xF4, 0xEB, 0x57, 0xEF, 0x7C, 0xEE, 0xBB, 0xA4, 0xFA, 0x57, 0x97, 0x3E, 0xFF, 0x93, 0xFF, 0xF1,
+    0xBD, 0xFB, 0x7F, 0xB2, 0x72, 0x49, 0x57, 0xE0, 0x9F, 0xD9, 0x78, 0xFC, 0x87, 0x37, 0xEE, 0x99,
+    0x5F, 0x1C, 0x13, 0xFF, 0x5B, 0x17, 0x2D, 0x53, 0xA2, 0x8A, 0x97, 0x8D, 0xCC, 0xC5, 0x27, 0x55,
+    0xDE, 0xFC, 0x9F, 0x3F, 0xFF, 0xF8, 0xDF, 0xF9, 0xBF, 0x5E, 0x69, 0x92, 0x0A, 0xD2, 0xEE, 0xD0,
+    0x3B, 0x90, 0x54, 0x79, 0xD3, 0x4E, 0x9B, 0x51, 0xEF, 0xF3, 0x26, 0xA9, 0xF8, 0x63, 0xE2, 0x82,
+    0xCB, 0x4A, 0xBA, 0x43, 0xFD, 0xF9, 0xB8, 0xE0, 0x32, 0x90, 0xCA, 0x5C, 0x3C, 0xB0, 0xB4, 0xA7,
+    0xFA, 0xC1, 0xF3, 0x87, 0xF5, 0x8D, 0xE5, 0x25, 0x7E, 0xFC, 0xE4, 0x2C, 0xFC, 0xF0, 0xC6, 0xF9,
+    0x05, 0xF5, 0x5A, 0xE5, 0x96, 0x68, 0xBC, 0xDA, 0x70, 0xFA, 0x84, 0x9D, 0x98, 0xA0, 0xED, 0xE2,
+    0x4D, 0x91, 0x37, 0xA4, 0x9F, 0xF4, 0xAD, 0x43, 0x15, 0x10, 0xDF, 0xB9, 0x22, 0x23, 0x73, 0xE7,
+    0x7A, 0x3F, 0x36, 0x9B, 0xD7, 0xFA, 0x71, 0xB4, 0x59, 0xAD, 0x8D, 0xF5, 0x46, 0xD5, 0x8D, 0xF5,
+    0xFC, 0x9A, 0x3F, 0x9C, 0x5E, 0xD9, 0xF0, 0x87, 0xF7, 0x67, 0xD9, 0x64, 0x25, 0xFF, 0xC9, 0x9E,
+    0x58, 0xB9, 0xFF, 0x60, 0x7E, 0x94, 0x3D, 0xA9, 0xB1, 0xBF, 0xF7, 0x77, 0x93, 0x6B, 0xCB, 0xD0,
+    0x1E, 0xD9, 0xFC, 0x91, 0xA9, 0xDB, 0xC7, 0x80, 0x34, 0x0B, 0xAB, 0xEF, 0x67, 0x91, 0x8D, 0x32,
+    0x9D, 0xC5, 0xD9, 0x12, 0x71, 0x36, 0x22, 0xCE, 0x2E, 0x63, 0x6E, 0xBB, 0xF7, 0xCC, 0x9D, 0x1B,
+    0x0D, 0xD1, 0xFC, 0x12, 0xFA, 0x9F, 0x9C, 0x26, 0x5D, 0xFA, 0xAF, 0xCC, 0x4C, 0x87, 0xE7, 0x4C,
+    0xD0, 0x70, 0x39, 0x58, 0x86, 0x00, 0x08, 0x1A, 0x16, 0xF8, 0x7E, 0xA6, 0x2A, 0x4E, 0x73, 0x86,
+    0x28, 0xD3, 0x70, 0x29, 0xAC, 0x89, 0xB3, 0x11, 0x94, 0xFA, 0xA7, 0x99, 0xB9, 0xFD, 0xA9, 0x64,
+    0x8C, 0x17, 0x8F, 0x10, 0x5B, 0x65, 0x69, 0x98, 0x62, 0x48, 0x89, 0xAC, 0xAE, 0x68, 0x43, 0xB1,
+    0x29, 0xA9, 0x07, 0x20, 0xA9, 0xE1, 0x77, 0x2F, 0x85, 0x15, 0x47, 0x22, 0xBB, 0xF0, 0x9E, 0xCE,
+    0x74, 0xB3, 0x04, 0xD3, 0x11, 0x69, 0xDB, 0xBC, 0x67, 0x3E, 0xBD, 0xDD, 0xA0, 0x36, 0x2E, 0xA1,
+    0xFF, 0xF4, 0x34, 0xC9, 0xD2, 0x65, 0x26, 0xA6, 0x63, 0xF5, 0xC1, 0x40, 0xE8, 0x09, 0x1B, 0xE2,
+    0x8A, 0x03, 0xC3, 0x24, 0x25, 0x28, 0x30, 0xE0, 0x51, 0x8E, 0xDC, 0x46, 0x77, 0x31, 0xD0, 0x10,
+    0x59, 0x12, 0x18, 0x93, 0x75, 0xB1, 0x95, 0x9E, 0xF2, 0x3C, 0xC0, 0xE8, 0x15, 0xE2, 0x2F, 0xE0,
+    0xA6, 0xE3, 0x89, 0xBF, 0x3F, 0x7C, 0xB7, 0x81, 0xD4, 0xA2, 0x3A, 0xC8, 0x6B, 0xF4, 0x45, 0x82,
+    0xA6, 0x21, 0xD5, 0x56, 0xB9, 0x35, 0x56, 0xA2, 0x5A, 0x8B, 0x04, 0x22, 0x6D, 0x2A, 0x32, 0x6F,
+    0xE8, 0x72, 0x74, 0x8D, 0xCE, 0x08, 0x3D, 0xA4, 0x16, 0x1A, 0xB6, 0x8F, 0xAD, 0x37, 0x4D, 0x45,
+    0xD4, 0xC3, 0x3D, 0x47, 0x72, 0x22, 0x0B, 0x9D, 0xC7, 0xC4, 0x55, 0x54, 0xAF, 0x20, 0xE2, 0x12,
+    0x91, 0xD7, 0x44, 0xBC, 0xC9, 0xF4, 0x75, 0x47, 0x0F, 0xFF, 0xA9, 0x14, 0x58, 0x17, 0x29, 0x30,
+    0xF2, 0x4E, 0x86, 0x91, 0x02, 0x92, 0xBC, 0x06, 0xFD, 0x46, 0xF7, 0x32, 0xD1, 0x86, 0x08, 0xCA,
+    0x95, 0x62, 0xC3, 0x26, 0xA9, 0x41, 0xA4, 0x85, 0x52, 0xE4, 0xC2, 0xF9, 0x5C, 0x44, 0xBC, 0x29,
+    0xB4, 0x48, 0x62, 0x95, 0x48, 0x35, 0x04, 0x40, 0x7A, 0x02, 0x91, 0x3A, 0x10, 0x69, 0x83, 0x36,
+    0xF4, 0x41, 0xCB, 0x2C, 0x68, 0x99, 0x18, 0xA9, 0x8C, 0x91, 0xCA, 0x04, 0x2D, 0x2B, 0x41, 0xFB,
+    0x58, 0x1F, 0x88, 0x74, 0x81, 0x88, 0x0F, 0x44, 0x5C, 0x20, 0x92, 0x31, 0xFE, 0x01, 0x41, 0x57,
+    0x11, 0x1B, 0x78, 0xF2, 0x99, 0xC1, 0x54, 0x79, 0x9E, 0x54, 0x6A, 0xD5, 0x9F, 0xAA, 0x13, 0xAB,
+    0x2B, 0x4F, 0x32, 0x77, 0x18, 0x5D, 0xE0, 0x57, 0x50, 0xCE, 0xA3, 0xE7, 0x5D, 0x20, 0x5A, 0xC4,
+    0x27, 0x22, 0x55, 0x2A, 0x3D, 0x4F, 0xC9, 0x79, 0x00, 0x93, 0x64, 0x52, 0xA9, 0x96, 0xB2, 0x4A,
+    0xCB, 0x9F, 0x2E, 0x9F, 0xE4, 0xC1, 0xF1, 0x54, 0x01, 0xA0, 0x2D, 0x80, 0xAE, 0x00, 0x22, 0x07,
+    0xA0, 0x1C, 0x40, 0xD8, 0x02, 0x04, 0xC3, 0xAC, 0xE8, 0x00, 0x28, 0x81, 0xA0, 0x2C, 0x33, 0x08,
+    0x45, 0x0A, 0x50, 0xFD, 0xA9, 0x1A, 0x02, 0xAF, 0x3B, 0xC0, 0x6B, 0xB1, 0x60, 0xA2, 0x3B, 0x0E,
+    0xF4, 0xD9, 0xD6, 0x43, 0xB4, 0xE9, 0x0D, 0xD0, 0x7B, 0x6D, 0xC1, 0xF4, 0x89, 0x03, 0x2D, 0xE2,
+    0x21, 0x10, 0xE9, 0x00, 0x23, 0x3D, 0x90, 0xCA, 0x5D, 0x40, 0xD7, 0x00, 0xDA, 0x01, 0x44, 0x2D,
+    0x80, 0xF2, 0x00, 0xE1, 0x80, 0x2C, 0x03, 0x7E, 0x06, 0x30, 0x1B, 0x08, 0x70, 0x7B, 0x8A, 0x65,
+    0x70, 0x1A, 0x34, 0x04, 0x8E, 0xAF, 0x3C, 0x0C, 0xFA, 0x4A, 0x13, 0xB6, 0xDA, 0x1A, 0xD6, 0xE3,
+    0x5A, 0x39, 0x4F, 0x7A, 0xB1, 0x40, 0x1C, 0xBA, 0x87, 0xDC, 0xA2, 0x5A, 0x30, 0xC5, 0xCE, 0x83,
+    0x07, 0x34, 0xCA, 0x22, 0x99, 0xF1, 0xFA, 0xD4, 0x59, 0xEB, 0xDC, 0x74, 0x9C, 0x6B, 0x51, 0x3D,
+    0x8E, 0x11, 0x1A, 0xC2, 0x1E, 0xD3, 0x07, 0x6E, 0x14, 0xBF, 0xD6, 0x2C, 0x2D, 0x65, 0x97, 0x9D,
+    0xFA, 0xB4, 0xD6, 0xF3, 0xC6, 0x28, 0xD7, 0xA9, 0x0D, 0x91, 0x13, 0xE2, 0x0F, 0xFD, 0xCB, 0x2C,
+    0xFC, 0xC7, 0xAC, 0xBF, 0xB2, 0xB7, 0xE4, 0xD3, 0x1A, 0x80, 0xE8, 0xFE, 0xAB, 0xE2, 0xC7, 0x7A,
+    0x5E, 0x4C, 0x4F, 0xAB, 0xAB, 0xD9, 0xCC, 0xC8, 0x47, 0xD2, 0xC7, 0x5F, 0xD4, 0xEC, 0x23, 0x29,
+    0xC2, 0xBF, 0x26, 0xB5, 0xBC, 0x35, 0x0C, 0x36, 0xBF, 0x9C, 0xC8, 0xBC, 0xF2, 0x47, 0xA2, 0xAB,
+    0xD9, 0xE8, 0x74, 0xB4, 0x21, 0x5D, 0x2A, 0x75, 0xB9, 0x02, 0x10, 0xF4, 0xFF, 0xBB, 0x0D, 0x44,
+    0xC4, 0x36, 0xE6, 0xDA, 0xE5, 0x23, 0x91, 0xC8, 0xD3, 0xF4, 0x3F, 0x3B, 0x9E, 0xE5, 0xEC, 0x13,
+    0x11, 0x9F, 0x8A, 0x48, 0xD8, 0x49, 0x9F, 0x01, 0x70, 0x66, 0x08, 0x65, 0x92, 0x61, 0xA4, 0x52,
+    0xD2, 0x41, 0x43, 0xFE, 0x21, 0x89, 0x38, 0xE5, 0x4A, 0xC6, 0xAA, 0x8E, 0xAA, 0x09, 0xE6, 0x45,
+    0xAB, 0xC4, 0xA3, 0x25, 0x23, 0x2D, 0x50, 0x57, 0x29, 0x5F, 0xD9, 0x9B, 0xF3, 0x1F, 0xCF, 0x03,
+    0x69, 0x95, 0xC8, 0xD9, 0x7A, 0x36, 0x55, 0x37, 0xAD, 0x31, 0x7F, 0xB0, 0x29, 0x5D, 0x22, 0x45,
+    0x5A, 0xF1, 0xDC, 0x36, 0x9D, 0x87, 0x1E, 0x20, 0x12, 0x39, 0x2B, 0xE2, 0x96, 0xE1, 0xCB, 0xFF,
+    0x81, 0xEF, 0xC1, 0x14, 0x2E, 0x43, 0x43, 0xE0, 0x08, 0x1D, 0xAA, 0x46, 0x59, 0x22, 0x4B, 0x69,
+    0x23, 0xA9, 0xF5, 0xC5, 0x26, 0x99, 0xB4, 0xC9, 0x78, 0x35, 0xE9, 0x5A, 0x2D, 0x4D, 0x24, 0x75,
+    0x28, 0x99, 0x72, 0xA8, 0x9A, 0xA8, 0x22, 0xB6, 0x68, 0x8B, 0x2E, 0x48, 0xE1, 0x08, 0xEC, 0x03,
+    0x34, 0x9C, 0x41, 0xD9, 0x21, 0x89, 0x3D, 0x74, 0xA8, 0x4A, 0xBF, 0x6E, 0xC7, 0xFA, 0x55, 0x97,
+    0x9E, 0x28, 0xCC, 0x98, 0xD2, 0x21, 0x45, 0xD8, 0xA1, 0x1C, 0xDA, 0xB2, 0x46, 0xE9, 0x42, 0xC9,
+    0xE2, 0x9A, 0x31, 0x3A, 0x53, 0x15, 0x52, 0x18, 0xAF, 0xFF, 0x68, 0x5E, 0xB9, 0xE6, 0xF0, 0x58,
+    0x9F, 0x38, 0x3E, 0xBF, 0x5E, 0x8B, 0x33, 0xB5, 0x2E, 0x54, 0x45, 0xC3, 0x18, 0x20, 0x9A, 0xBB,
+    0xF4, 0x84, 0xED, 0xF2, 0xF0, 0x9D, 0x9F, 0xEF, 0x42, 0x19, 0xD3, 0xAE, 0xAA, 0xAA, 0x4D, 0xC2,
+    0xA6, 0x55, 0x77, 0xAA, 0x58, 0xD0, 0x2D, 0x69, 0x35, 0xB0, 0x5B, 0x5C, 0xC5, 0x42, 0xDA, 0xB0,
+    0x0E, 0xB0, 0x8F, 0x54, 0xAC, 0x12, 0xBF, 0x7B, 0x88, 0x8F, 0x4A, 0x42, 0xBF, 0xF5, 0xEE, 0x59,
+    0xF1, 0x87, 0x7E, 0x96, 0x6D, 0x7D, 0xFD, 0xEB, 0x26, 0x4F, 0xB6, 0x48, 0x72, 0xD1, 0x22, 0x0D,
+    0x51, 0xF7, 0x1D, 0x08, 0x2F, 0x74, 0xD3, 0x44, 0x8A, 0xB2, 0xDE, 0xB6, 0xF0, 0x35, 0x53, 0xF0,
+    0xD1, 0x0D, 0xEB, 0x8C, 0xE0, 0x33, 0x48, 0x1C, 0xE4, 0x5B, 0xB6, 0x93, 0xFF, 0x1B, 0x88, 0xD7,
+    0xC7, 0xDC, 0x91, 0xE8, 0xFD, 0x4A, 0x47, 0xD9, 0x4C, 0x4B, 0x93, 0x4A, 0x9D, 0x7E, 0x6C, 0x39,
+    0x4C, 0x58, 0x13, 0x37, 0x5B, 0x44, 0x10, 0x64, 0xC4, 0x19, 0x1A, 0x96, 0xB6, 0x47, 0x95, 0xF6,
+    0x81, 0xF4, 0x91, 0x74, 0xBA, 0xD9, 0x93, 0x58, 0x4C, 0x86, 0xC9, 0xC8, 0x33, 0xF2, 0x02, 0x53,
+    0x2F, 0x18, 0xE9, 0x12, 0xE9, 0x62, 0xE9, 0x02, 0xE9, 0x38, 0xCD, 0x88, 0x84, 0x85, 0x0C, 0x28,
+    0x8F, 0x4A, 0xDD, 0x31, 0x22, 0x21, 0xAA, 0xE8, 0x7E, 0x9C, 0x48, 0x50, 0x16, 0x00, 0x09, 0x98,
+    0x82, 0xFB, 0xB5, 0xAA, 0x2E, 0x3F, 0xB2, 0x79, 0x38, 0x88, 0x6A, 0x83, 0xFB, 0xF5, 0x34, 0x2E,
+    0x20, 0xEC, 0x02, 0xA9, 0x4D, 0xA6, 0xB6, 0xA4, 0x88, 0xF9, 0xE7, 0x81, 0xB8, 0xC7, 0x7A, 0x78,
+    0x02, 0xD2, 0x8C, 0x34, 0xC3, 0x14, 0x8F, 0x8A, 0x10, 0xBC, 0xC5, 0x1A, 0x26, 0xD3, 0xF5, 0xD7,
+    0x38, 0xA0, 0xEC, 0x19, 0xEE, 0x39, 0x8C, 0x25, 0x81, 0x3D, 0x8F, 0x1C, 0x9F, 0x67, 0x1F, 0x7B,
+    0xF5, 0x73, 0x17, 0x79, 0x12, 0x58, 0xE6, 0x6B, 0x1D, 0x58, 0x60, 0x39, 0x68, 0x5A, 0x92, 0x96,
+    0xA0, 0x85, 0x27, 0xB7, 0xC9, 0x56, 0xEE, 0x91, 0x4B, 0x9B, 0x88, 0x9C, 0xAB, 0xE3, 0xDB, 0x2D,
+    0x6B, 0x2B, 0xE8, 0x37, 0x0B, 0x75, 0xB3, 0xA6, 0x6B, 0x99, 0xAC, 0x04, 0xE5, 0x9B, 0x22, 0xD7,
+    0x45, 0x6E, 0x8B, 0xB8, 0x5C, 0x6A, 0xC0, 0x41, 0xB2, 0x48, 0x70, 0xA7, 0x22, 0x19, 0x11, 0x7C,
+    0x61, 0xD3, 0x8B, 0x53, 0x2D, 0x4E, 0x7D, 0x2E, 0x8C, 0x22, 0x17, 0x15, 0x2B, 0xCC, 0xE2, 0x5A,
+    0x49, 0x4F, 0x22, 0x8E, 0x53, 0x17, 0xBF, 0x7D, 0xBA, 0xC4, 0xC1, 0x94, 0x58, 0x7C, 0x70, 0xF1,
+    0x13, 0x02, 0xC7, 0xFA, 0x2A, 0x22, 0x74, 0xA5, 0x1D, 0x45, 0xEE, 0x60, 0xD0, 0x46, 0xD5, 0x3A,
+    0x22, 0x45, 0x22, 0x2E, 0x58, 0x5F, 0xE5, 0x89, 0x8B, 0xB6, 0x94, 0xA3, 0x3F, 0xDB, 0x49, 0x85,
+    0x61, 0x29, 0x5A, 0xBC, 0x79, 0x67, 0xD9, 0xA3, 0x1C, 0xFA, 0xBF, 0x17, 0x46, 0x32, 0xF1, 0x03,
+    0x81, 0x98, 0x0B, 0x6F, 0x89, 0x5C, 0x15, 0xF9, 0x23, 0xE9, 0xD9, 0xFF, 0x82, 0x78, 0x23, 0xC5,
+    0xEE, 0x95, 0x1D, 0x76, 0xF4, 0xED, 0xE4, 0xB7, 0xE7, 0xD2, 0xAF, 0xBC, 0x73, 0xBC, 0xC2, 0xC8,
+    0x0D, 0xE9, 0x43, 0xC9, 0x80, 0xB1, 0xCE, 0xC4, 0x23, 0x96, 0x7D, 0xC3, 0x27, 0x9F, 0x10, 0x6F,
+    0xC4, 0xF5, 0x3F, 0x3B, 0x36, 0x98, 0xFD, 0x7D, 0xA4, 0x53, 0xE2, 0xB4, 0xC5, 0x40, 0x7F, 0xE1,
+    0xAC, 0x48, 0x22, 0x5D, 0x2E, 0xED, 0x9E, 0xA3, 0x47, 0xC5, 0x6B, 0xC9, 0x4E, 0x55, 0xBF, 0x19,
+    0x64, 0x75, 0x8B, 0xE4, 0x0E, 0x3D, 0x9A, 0x1B, 0x2D, 0xBA, 0x08, 0x3C, 0x07, 0x8A, 0xDF, 0x88,
+    0xF0, 0x7D, 0x71, 0x22, 0xF3, 0x7B, 0x2F, 0x0D, 0xA3, 0xEC, 0x5E, 0x56, 0xD2, 0x68, 0xB1, 0x83,
+    0xA2, 0xBB, 0x77, 0x41, 0x8B, 0xCF, 0xE5, 0x33, 0x91, 0x7A, 0x09, 0x1C, 0xAA, 0xDD, 0xD2, 0xF9,
+    0x5F, 0x1F, 0x92, 0x23, 0xE8, 0x2C, 0xA8, 0x49, 0x2A, 0xD6, 0x80, 0x3D, 0x2C, 0x4F, 0x12, 0x8C,
+    0xC3, 0xC0, 0x0F, 0x76, 0x46, 0xF2, 0xB7, 0x85, 0x54, 0x76, 0xDD, 0x85, 0x1E, 0x9D, 0x3D, 0x94,
+    0x0B, 0xD2, 0x4A, 0xDF, 0x3A, 0x7B, 0x63, 0x6A, 0xE4, 0xE6, 0x27, 0x27, 0x67, 0x28, 0xE9, 0x13,
+    0xA9, 0xD3, 0x06, 0x65, 0x21, 0x2D, 0x08, 0xA5, 0x60, 0x29, 0x2E, 0xBE, 0x9C, 0x40, 0x0E, 0xFC,
+    0x82, 0x58, 0x3A, 0x44, 0xDA, 0xF8, 0x2E, 0xCB, 0xC6, 0x42, 0x37, 0x68, 0xA0, 0xC4, 0xFE, 0x70,
+    0x39, 0x47, 0x5C, 0x17, 0x94, 0x1B, 0x9E, 0x95, 0xB8, 0x7F, 0xB7, 0xD1, 0x22, 0x95, 0x16, 0xC9,
+    0x1E, 0x93, 0xF3, 0x30, 0x42, 0x35, 0x98, 0x46, 0x55, 0xED, 0xB6, 0xA9, 0x60, 0x6D, 0x35, 0x91,
+    0xBA, 0xC9, 0xCF, 0x15, 0xEB, 0x4F, 0x07, 0xED, 0x99, 0xB8, 0x16, 0x79, 0x41, 0xBA, 0x50, 0x1A,
+    0x8E, 0x59, 0xD2, 0xF0, 0x7E, 0xAB, 0xC5, 0xA6, 0xC3, 0xA7, 0x03, 0x37, 0x25, 0x92, 0x9A, 0xB8,
+    0xE7, 0xFF, 0xDB, 0x80, 0xE0, 0xF2, 0x52, 0x2C, 0x55, 0xDA, 0x6C, 0x4F, 0xBA, 0x53, 0xA7, 0x12,
+    0xD9, 0xBC, 0xD6, 0x9F, 0x89, 0x6F, 0x66, 0x2B, 0x67, 0xE2, 0x4D, 0xE9, 0x52, 0xA9, 0xCA, 0x8E,
+    0x63, 0x96, 0xD5, 0xB4, 0x3C, 0x2B, 0x2E, 0x6D, 0x41, 0xD5, 0x90, 0x14, 0x90, 0x43, 0xF0, 0xF3,
+    0x87, 0xC6, 0xF1, 0xD8, 0x85, 0x2C, 0x14, 0xC9, 0x8C, 0xF4, 0x61, 0x9F, 0x2D, 0x6A, 0x07, 0x26,
+    0x03, 0x0F, 0x91, 0xDB, 0xFB, 0x6F, 0x13, 0x6B, 0xBC, 0xC9, 0x4E, 0x35, 0x42, 0xF2, 0x9A, 0x5C,
+    0xE8, 0x94, 0x48, 0xA3, 0x44, 0xAA, 0xA0, 0xFC, 0x15, 0xCC, 0x88, 0x2B, 0xD6, 0x79, 0xE2, 0xFC,
+    0x60, 0xE6, 0xF3, 0xDB, 0xD2, 0x8F, 0x93, 0x9B, 0xC5, 0xFA, 0xE9, 0xE8, 0x66, 0xB1, 0x6E, 0xE4,
+    0x23, 0xE9, 0x62, 0xA9, 0xF6, 0x8C, 0x88, 0xAF, 0xDC, 0x6F, 0x8D, 0x84, 0x52, 0xA0, 0x6B, 0x30,
+    0x05, 0x74, 0x83, 0x06, 0x4D, 0xED, 0xB6, 0xE4, 0xDC, 0x7D, 0x04, 0x17, 0xCE, 0x53, 0x4A, 0xA5,
+    0x45, 0x8A, 0xF2, 0xFC, 0x82, 0xF2, 0x83, 0x6A, 0x35, 0x10, 0x78, 0xF5, 0x4E, 0xE4, 0xB4, 0xE8,
+    0xEA, 0xA9, 0xCE, 0xD8, 0xA8, 0x2E, 0x3F, 0x29, 0x33, 0x91, 0x0E, 0x91, 0x86, 0x53, 0x77, 0x41,
+    0xD0, 0x35, 0x1D, 0xDA, 0x86, 0x9E, 0x43, 0xD9, 0xDF, 0x32, 0x2E, 0x40, 0x54, 0xA0, 0x5A, 0xA2,
+    0x5B, 0x45, 0x64, 0xB7, 0xF3, 0x84, 0x67, 0xD5, 0x90, 0x9E, 0xB0, 0xF1, 0x86, 0x0B, 0x1B, 0x4F,
+    0x67, 0x30, 0x27, 0xAC, 0xDE, 0xB8, 0xF7, 0x6E, 0x2B, 0xD2, 0x1B, 0x91, 0x37, 0x44, 0x36, 0x1B,
+    0x75, 0xB7, 0xA3, 0xCF, 0x33, 0x63, 0xA9, 0xA1, 0x03, 0xA9, 0x68, 0xC6, 0xDB, 0x5E, 0x24, 0x10,
+    0x5B, 0x42, 0x07, 0xAB, 0x30, 0x01, 0x7D, 0xAB, 0x52, 0xE2, 0xE9, 0x92, 0x6C, 0x12, 0xD4, 0xBA,
+    0x98, 0xAA, 0x3A, 0x0D, 0xDA, 0xD8, 0xE6, 0xCA, 0x25, 0xD6, 0x6B, 0x1B, 0x5B, 0x43, 0x9A, 0x79,
+    0xD6, 0xA2, 0xCF, 0xFE, 0x59, 0x6B, 0x44, 0x1A, 0x11, 0xA9, 0x3C, 0xBD, 0xBA, 0xF7, 0x6E, 0xAB,
+    0x45, 0x6A, 0x23, 0x52, 0x88, 0xF4, 0xAA, 0x51, 0x6D, 0x52, 0xE9, 0x3A, 0xCF, 0x8C, 0x0D, 0x1C,
+    0xAC, 0x12, 0x94, 0x75, 0x28, 0x0D, 0xA1, 0x83, 0xBE, 0xC3, 0x88, 0xD5, 0xD7, 0x1A, 0x55, 0x1F,
+    0xA4, 0x8D, 0xEC, 0x24, 0x74, 0x49, 0xB1, 0x1A, 0x39, 0x13, 0x78, 0x6D, 0xC7, 0xFF, 0x40, 0x3E,
+    0xD8, 0xCE, 0xB2, 0xCA, 0x69, 0x6B, 0xF0, 0x5F, 0x7E, 0x48, 0xAA, 0xC7, 0x17, 0xBB, 0xBF, 0x28,
+    0xFF, 0xDB, 0x18, 0x60, 0x11, 0xA7, 0xAC, 0x66, 0x84, 0x8B, 0x6C, 0xC2, 0x2C, 0x68, 0x16, 0x7E,
+    0xFF, 0x35, 0xF1, 0xE6, 0xC2, 0xAE, 0x75, 0xA5, 0x2D, 0xFE, 0x9B, 0x2E, 0x41, 0xC7, 0x81, 0x8B,
+    0xC7, 0xC4, 0xFF, 0x8B, 0x97, 0x86, 0xE5, 0xBB, 0x00, 0x0E, 0xBD, 0x73, 0x49, 0x08, 0x1C, 0x49,
+    0x16, 0x34, 0x68, 0xEB, 0xBF, 0x7C, 0xBE, 0xDF, 0x1D, 0x54, 0xD6, 0xBC, 0xDA, 0x42, 0xF2, 0x42,
+    0x93, 0xBE, 0xF6, 0x36, 0xA0, 0x71, 0x1A, 0xA7, 0x03, 0x97, 0x04, 0x4D, 0x72, 0xD4, 0x8D, 0x94,
+    0x4F, 0x2C, 0x13, 0x7D, 0xF5, 0xF6, 0xCF, 0x01, 0xBC, 0xD1, 0x73, 0xB7, 0xEB, 0x92, 0x67, 0x8B,
+    0xA3, 0xD1, 0x68, 0x34, 0x9A, 0x4E, 0x67, 0xB3, 0x35, 0xF4, 0xD5, 0x0A, 0x3F, 0x23, 0xB9, 0x5A,
+    0x05, 0xED, 0x8C, 0xE4, 0x5C, 0x15, 0xB6, 0x33, 0xD2, 0xE3, 0x55, 0xD8, 0xAC, 0x60, 0xA2, 0x5A,
+    0xB9, 0x15, 0x4C, 0xE4, 0x94, 0x2B, 0x31, 0xB1, 0x53, 0x0E, 0x56, 0x78, 0x5C, 0xD7, 0x48, 0x47,
+    0x22, 0x36, 0x94, 0x86, 0x03, 0xC3, 0x3C, 0x7D, 0x36, 0x3C, 0x57, 0x8D, 0xD7, 0xD5, 0xC7, 0x5B,
+    0x2A, 0xEA, 0x59, 0xB5, 0x61, 0x47, 0x23, 0x35, 0xB7, 0xA3, 0x91, 0xBA, 0x6A, 0x47, 0xB3, 0xE8,
+    0x6A, 0x35, 0x5D, 0x89, 0x0B, 0x5A, 0xCA, 0x42, 0x3B, 0x7E, 0x31, 0x84, 0x09, 0x8C, 0x45, 0x9C,
+    0xAA, 0xA6, 0xDB, 0x3C, 0xDC, 0xA0, 0x1A, 0x94, 0x7B, 0x70, 0x46, 0xF5, 0xD6, 0x19, 0x57, 0xC4,
+    0x15, 0xDA, 0xA2, 0xED, 0x62, 0x62, 0x8D, 0x14, 0x46, 0x32, 0xD3, 0x11, 0x2C, 0x0F, 0x7A, 0x3F,
+    0xCF, 0x56, 0x9A, 0xE9, 0x36, 0x1B, 0x86, 0x8E, 0xCB, 0x2C, 0x11, 0x17, 0x61, 0xCD, 0x25, 0x0E,
+    0x0F, 0xCA, 0xD7, 0x29, 0x8F, 0x90, 0x6F, 0x13, 0x66, 0x6A, 0x89, 0x1D, 0xAA, 0x85, 0x0E, 0x72,
+    0x38, 0x90, 0xED, 0xCC, 0x81, 0x1E, 0x9F, 0x33, 0x31, 0x99, 0x7E, 0xD3, 0x46, 0xB7, 0x6C, 0x20,
+    0x35, 0xB9, 0x23, 0x6D, 0x88, 0x7B, 0x94, 0xD4, 0x88, 0x60, 0x8C, 0xD3, 0x73, 0x89, 0x5C, 0xDE,
+    0xA4, 0xB0, 0x4A, 0x58, 0x13, 0x17, 0x4C, 0xA0, 0x79, 0x5B, 0x7D, 0x6C, 0xB5, 0xC7, 0x58, 0x24,
+    0x53, 0x92, 0x25, 0x52, 0xCC, 0xCA, 0x57, 0x9B, 0xD2, 0x3E, 0x20, 0x68, 0x72, 0x42, 0x8F, 0xAE,
+    0xC8, 0x09, 0x4E, 0xC2, 0xD3, 0x47, 0xE2, 0x71, 0xF8, 0x3F, 0x29, 0x31, 0x99, 0xAE, 0x54, 0xC7,
+    0xFD, 0x7A, 0xBA, 0x4E, 0x00, 0xCF, 0x83, 0x63, 0xE0, 0xEA, 0x55, 0x42, 0x47, 0x6C, 0x49, 0xB7,
+    0x3A, 0x09, 0x43, 0x6A, 0xD8, 0x7A, 0x7A, 0xD2, 0x48, 0x23, 0x72, 0x5D, 0x24, 0x8B, 0x32, 0x97,
+    0x0C, 0xD1, 0x08, 0xEB, 0xB1, 0xAA, 0xC6, 0xAA, 0x1A, 0x29, 0x3B, 0x8D, 0xEC, 0x34, 0xB2, 0xB3,
+    0xE3, 0x3E, 0xAF, 0x92, 0x8A, 0xC4, 0x92, 0x58, 0xD2, 0x02, 0x93, 0xED, 0x28, 0x52, 0x62, 0xFB,
+    0xE0, 0xD4, 0x5F, 0x71, 0x9E, 0xD4, 0xD2, 0xE9, 0x41, 0x3F, 0x15, 0x63, 0x1A, 0x55, 0xE9, 0x6C,
+    0x6B, 0xEE, 0x4F, 0x03, 0x17, 0xFD, 0x65, 0xE2, 0xF2, 0x21, 0x55, 0xFF, 0xE4, 0x68, 0x17, 0xB9,
+    0xB4, 0xE8, 0x22, 0xC7, 0x10, 0x14, 0xB7, 0x18, 0xDB, 0xC6, 0x28, 0xEB, 0xB5, 0x72, 0xD3, 0x07,
+    0x83, 0xDE, 0xAF, 0xA5, 0x33, 0xF2, 0x99, 0x48, 0xC5, 0x02, 0x09, 0x4B, 0x4B, 0x93, 0xF1, 0x64,
+    0xCC, 0x98, 0x31, 0x23, 0x46, 0x4C, 0xB7, 0xFE, 0x66, 0x59, 0x6E, 0xF3, 0x6A, 0xCB, 0xD0, 0x24,
+    0x7E, 0xBF, 0x35, 0x91, 0xF3, 0x07, 0xCE, 0xEE, 0xF6, 0xFE, 0x81, 0xA1, 0x25, 0xC6, 0x8C, 0x19,
+    0x8F, 0xC7, 0x2B, 0xA3, 0xF5, 0xD1, 0x4F, 0x1E, 0x36, 0xB1, 0xE3, 0x66, 0x01, 0x4C, 0x19, 0xF8,
+    0x9E, 0x74, 0x68, 0x19, 0x11, 0x7F, 0x68, 0x21, 0x5D, 0x05, 0xCA, 0x1A, 0x42, 0x01, 0x74, 0x03,
+    0x18, 0x0B, 0xF8, 0xED, 0x5E, 0x80, 0xB1, 0x10, 0x08, 0xA0, 0xFD, 0x42, 0x46, 0x29, 0x92, 0x45,
+    0x22, 0x1D, 0x26, 0x97, 0x26, 0x6C, 0xB6, 0x5B, 0x08, 0x1D, 0x0C, 0x0A, 0xE0, 0xC8, 0x2E, 0x5D,
+    0x51, 0x43, 0x03, 0x63, 0xD0, 0x19, 0xAA, 0x02, 0x07, 0x13, 0x47, 0x52, 0x93, 0x56, 0x94, 0x2E,
+    0xE8, 0xA6, 0x90, 0x2C, 0x13, 0x79, 0x02, 0xC9, 0x50, 0x96, 0xA0, 0x06, 0x07, 0x8B, 0xDB, 0x06,
+    0x4E, 0xD2, 0xE6, 0x8C, 0x93, 0x3A, 0x39, 0xEE, 0xA3, 0x8F, 0xE4, 0xD5, 0xA6, 0x74, 0xB3, 0x74,
+    0x3D, 0xD5, 0xBF, 0xFE, 0x60, 0x7E, 0xF7, 0x9E, 0xEB, 0x8D, 0x37, 0xE7, 0x44, 0xD7, 0x32, 0xF7,
+    0xE9, 0x6D, 0x51, 0x9E, 0x05, 0xC2, 0x8A, 0x11, 0x3B, 0x29, 0x5E, 0xDD, 0xAA, 0x8D, 0xCC, 0x9B,
+    0xD9, 0x58, 0x6D, 0x54, 0x93, 0xB1, 0xBA, 0x59, 0x9B, 0x15, 0xF5, 0x85, 0x33, 0x0B, 0x99, 0x3E,
+    0xE7, 0xD4, 0xB5, 0x3E, 0x68, 0x72, 0x3B, 0x4B, 0xDB, 0xE4, 0x45, 0x89, 0x3E, 0xBA, 0xFF, 0x4B,
+    0xD7, 0xAF, 0xAE, 0x9A, 0x37, 0x2F, 0xEA, 0x4D, 0x99, 0xB7, 0xB9, 0xEB, 0xB5, 0x37, 0x57, 0x24,
+    0x71, 0xC6, 0x02, 0xF4, 0x60, 0x32, 0xF4, 0xCE, 0x92, 0x39, 0xF9, 0x0D, 0xD6, 0x39, 0x49, 0x52,
+    0x05, 0x9E, 0xD4, 0xAA, 0x86, 0x9C, 0x60, 0x99, 0xB0, 0x9E, 0x92, 0xAE, 0x12, 0x7A, 0x18, 0xEF,
+    0x4A, 0x67, 0xFB, 0x99, 0x24, 0x56, 0x1F, 0x6F, 0xA3, 0x6B, 0x12, 0x34, 0x65, 0x3D, 0x4B, 0x7D,
+    0xF2, 0xE2, 0xAD, 0xD7, 0xE7, 0xF7, 0x3E, 0x75, 0xFD, 0xCA, 0xAA, 0x79, 0x43, 0xF4, 0x0D, 0x99,
+    0xB7, 0xC6, 0x49, 0xEC, 0x73, 0x2B, 0xEC, 0x0D, 0x6A, 0x7D, 0x11, 0xED, 0x48, 0xD8, 0xCE, 0xEE,
+    0xC0, 0xA4, 0x47, 0x44, 0x35, 0x33, 0x9D, 0x35, 0x63, 0x55, 0x37, 0xFA, 0x5C, 0x6D, 0x92, 0xC2,
+    0xE7, 0xCA, 0x0D, 0x2C, 0xB0, 0x46, 0x5A, 0x44, 0x6F, 0x3D, 0xF8, 0xB0, 0x12, 0x6F, 0x8E, 0x6F,
+    0x54, 0xE3, 0xB1, 0xDA, 0xAC, 0x26, 0x2B, 0xEA, 0x8B, 0xDA, 0xE4, 0xCA, 0x3D, 0x62, 0x38, 0x74,
+    0x8D, 0x69, 0x49, 0xFC, 0x37, 0x86, 0x98, 0xC8, 0xA9, 0x9E, 0x7C, 0xEB, 0x87, 0x88, 0xC4, 0x61,
+    0xA4, 0x7A, 0x48, 0x5B, 0xF4, 0x19, 0xA5, 0x14, 0xFA, 0x6E, 0x59, 0xE4, 0x98, 0x63, 0x8E, 0x5C,
+    0x5B, 0xFC, 0x04, 0x75, 0xBB, 0x45, 0xCF, 0x1D, 0x46, 0x37, 0x91, 0x37, 0x22, 0x2E, 0x17, 0xC9,
+    0x4A, 0x69, 0x39, 0xB5, 0xD5, 0xDA, 0x08, 0x42, 0xF1, 0x46, 0xEC, 0x8E, 0x70, 0x0D, 0xA4, 0x9D,
+    0x44, 0xD7, 0xED, 0x64, 0xAA, 0xEE, 0x7C, 0xB6, 0x6E, 0xE4, 0x9A, 0xB4, 0x61, 0x07, 0xD9, 0x22,
+    0xEA, 0x13, 0x87, 0x96, 0x82, 0xB8, 0xF9, 0xCE, 0xA0, 0x7B, 0x82, 0xA3, 0xF7, 0xBC, 0x96, 0x6C,
+    0x6B, 0x35, 0x7D, 0x1D, 0xE8, 0x98, 0xD5, 0xA0, 0x55, 0x2E, 0xAE, 0x93, 0x1D, 0xBE, 0xE3, 0xD4,
+    0xAF, 0x08, 0xA5, 0x47, 0xDF, 0x2D, 0x8B, 0xC4, 0xEA, 0xCA, 0x10, 0x39, 0x83, 0x72, 0x13, 0x94,
+    0x5B, 0x41, 0x39, 0x83, 0x72, 0xA6, 0x4A, 0x9C, 0x19, 0xCA, 0xE7, 0x2A, 0x16, 0x29, 0x82, 0xF2,
+    0xEE, 0xE0, 0x69, 0xA3, 0xEA, 0x34, 0x5B, 0x51, 0x4D, 0x5C, 0xEF, 0xD2, 0xE9, 0xE4, 0x3D, 0xAA,
+    0x9E, 0x91, 0xD0, 0x32, 0x55, 0x8E, 0xEE, 0x54, 0xA1, 0xA4, 0x23, 0x92, 0x7A, 0xE8, 0x95, 0x8D,
+    0xE0, 0x0C, 0xB8, 0xA1, 0xB8, 0x23, 0xE9, 0x49, 0xC5, 0x2E, 0x85, 0xF5, 0x52, 0xE0, 0x96, 0x02,
+    0x37, 0x51, 0xCE, 0x48, 0x65, 0xC4, 0x1A, 0xA9, 0xCC, 0x31, 0x67, 0x8E, 0x35, 0xE6, 0x58, 0x6B,
+    0x8E, 0xF9, 0xFC, 0xAC, 0x07, 0x82, 0x4C, 0xD9, 0xB8, 0xD0, 0x40, 0xBA, 0x9A, 0x76, 0xE9, 0x5F,
+    0xA6, 0xA4, 0x18, 0x0C, 0x66, 0xC8, 0x1A, 0xCA, 0xA3, 0x5A, 0x54, 0x43, 0xE4, 0x88, 0xDD, 0xB6,
+    0xBA, 0x7B, 0x44, 0x8C, 0xFD, 0x99, 0xB1, 0x69, 0x61, 0xB2, 0x9C, 0x92, 0x93, 0x5F, 0x89, 0xB4,
+    0x18, 0x64, 0xC9, 0x8B, 0x45, 0xD4, 0x13, 0x78, 0x78, 0xE5, 0xDB, 0x60, 0xFC, 0xF1, 0x63, 0x27,
+    0xDE, 0x28, 0xA4, 0xD0, 0x96, 0x02, 0x58, 0x77, 0x69, 0x17, 0x7F, 0x16, 0x3A, 0x56, 0x31, 0x68,
+    0xAB, 0x5C, 0xD0, 0x0D, 0x5D, 0xC3, 0x4B, 0xA0, 0x07, 0x8A, 0x1A, 0x98, 0x26, 0x10, 0x8F, 0x91,
+    0x2C, 0xAE, 0xF7, 0xE1, 0x07, 0x4E, 0x2B, 0xCF, 0xA3, 0xA4, 0x21, 0x16, 0x47, 0x20, 0x05, 0xA1,
+    0x8F, 0x8B, 0xF4, 0x7D, 0x91, 0xD6, 0x88, 0x70, 0x71, 0x6B, 0x3E, 0x2E, 0xA2, 0x2C, 0x67, 0x86,
+    0x42, 0x24, 0x6D, 0xF4, 0xBB, 0x38, 0xE2, 0xBB, 0xC4, 0x9E, 0xA8, 0xEE, 0x7B, 0x23, 0xEF, 0x0F,
+    0x7D, 0x95, 0xBD, 0xA0, 0x1A, 0x90, 0x8A, 0xF1, 0x83, 0x92, 0x65, 0x21, 0x23, 0x11, 0xAB, 0xA4,
+    0x61, 0x3D, 0x40, 0x5B, 0xF0, 0x10, 0xDF, 0x05, 0x23, 0x19, 0xA5, 0x40, 0xD2, 0x42, 0x6A, 0x2F,
+    0x87, 0x3E, 0x19, 0x1A, 0x6D, 0x4F, 0xC8, 0xAF, 0xB6, 0xC9, 0x3C, 0x0B, 0x3D, 0xEB, 0x6E, 0x29,
+    0xB2, 0x10, 0x4A, 0x76, 0xEF, 0x3D, 0x0D, 0xE5, 0x79, 0x4A, 0xCB, 0x8A, 0xBE, 0xB5, 0x29, 0xFE,
+    0xA9, 0xFE, 0xDB, 0xD8, 0x7F, 0x4A, 0x7E, 0x85, 0xCE, 0x08, 0x56, 0x21, 0xB1, 0x04, 0x03, 0x6F,
+    0x7C, 0x85, 0x4F, 0x57, 0xA4, 0x8E, 0x60, 0x9D, 0x27, 0x6A, 0x5A, 0xC2, 0xE2, 0x65, 0x92, 0x53,
+    0x90, 0x5B, 0x02, 0xC7, 0x76, 0x7F, 0xEE, 0x5B, 0xBA, 0x76, 0x30, 0xAC, 0xD6, 0xDA, 0xB0, 0x27,
+    0x2E, 0xD8, 0xC7, 0x37, 0xB8, 0x96, 0x8B, 0x7C, 0x2C, 0xF2, 0x85, 0x88, 0x67, 0x15, 0xD2, 0x8C,
+    0xB8, 0x22, 0x6C, 0xA0, 0x1B, 0x78, 0xBA, 0x42, 0x6D, 0xBD, 0x18, 0x2A, 0x8B, 0x0A, 0x66, 0xF0,
+    0xDB, 0x96, 0xB8, 0x26, 0x3C, 0x3F, 0x08, 0xA6, 0x09, 0xBA, 0x30, 0xA2, 0xA5, 0xDA, 0x6A, 0x0C,
+    0x36, 0x4C, 0xDE, 0xD2, 0x5E, 0x49, 0x56, 0x93, 0xF3, 0x94, 0x8D, 0x2A, 0xC2, 0xEC, 0x19, 0x56,
+    0x57, 0x89, 0x3D, 0xAC, 0xC2, 0xE3, 0x3B, 0x2D, 0x10, 0x91, 0x01, 0xDE, 0x85, 0x0E, 0xD6, 0xB6,
+    0xE1, 0xD5, 0x97, 0xE1, 0xFB, 0xA1, 0xA2, 0x61, 0x04, 0x53, 0x98, 0x06, 0xF5, 0xAA, 0xAA, 0x4F,
+    0xAA, 0x1A, 0x23, 0x18, 0xC9, 0x54, 0xC5, 0x83, 0xF3, 0x13, 0x94, 0xA0, 0x24, 0xFB, 0x1A, 0xCF,
+    0x4A, 0xB1, 0xA9, 0xB8, 0xAF, 0xF4, 0x0C, 0xA2, 0x82, 0x16, 0x5D, 0x68, 0xB1, 0xD2, 0xD1, 0x28,
+    0xE9, 0x8C, 0x54, 0x3A, 0xE3, 0x5E, 0xA1, 0x3D, 0x52, 0x01, 0x97, 0x2B, 0xCC, 0x19, 0x9E, 0xEE,
+    0x08, 0x7F, 0xB4, 0xAB, 0x94, 0x1A, 0x0A, 0x94, 0x13, 0x56, 0x6F, 0x38, 0xF5, 0xA0, 0x8E, 0x99,
+    0x3B, 0xE5, 0x3C, 0xDE, 0x64, 0xB9, 0x16, 0xB9, 0x22, 0x52, 0xE7, 0xD2, 0x44, 0xD2, 0x00, 0xA8,
+    0xEB, 0x94, 0x4E, 0xEF, 0xB4, 0xE3, 0xCE, 0xA8, 0xEB, 0x76, 0x3C, 0x55, 0x1B, 0x76, 0x32, 0x8A,
+    0x36, 0xAB, 0x75, 0x23, 0xBF, 0x94, 0x3E, 0xBE, 0x5F, 0x13, 0x2C, 0x07, 0xD2, 0x51, 0xCA, 0x43,
+    0x75, 0xF9, 0xA3, 0xA3, 0xF1, 0xD2, 0x31, 0xF1, 0xE6, 0x5E, 0xF1, 0xCD, 0x68, 0xC1, 0x3F, 0xDC,
+    0x87, 0x78, 0x52, 0x21, 0xEC, 0xBF, 0x13, 0x1A, 0xC1, 0xC3, 0x3D, 0xD0, 0xA8, 0x18, 0x4F, 0xD5,
+    0x75, 0x3B, 0x1E, 0xA9, 0x4D, 0xBB, 0x32, 0x8E, 0x37, 0xA5, 0x4F, 0xA5, 0x2E, 0xD7, 0x59, 0x82,
+    0x83, 0x15, 0x91, 0x83, 0xCB, 0x0F, 0x97, 0xA6, 0x79, 0x66, 0xDE, 0xAC, 0x1E, 0xC6, 0xDB, 0xD8,
+    0xC2, 0xC3, 0xE8, 0x2A, 0x99, 0x8B, 0xB8, 0x52, 0xDA, 0x64, 0xBB, 0x85, 0x48, 0xE0, 0x30, 0x56,
+    0x79, 0x12, 0x7E, 0x03, 0x64, 0x1B, 0xBA, 0xA4, 0x30, 0x61, 0x1B, 0xED, 0xDE, 0xDD, 0x88, 0x86,
+    0x6A, 0xAF, 0x32, 0x98, 0xCC, 0xD3, 0x29, 0xA7, 0x1A, 0x6D, 0x75, 0x65, 0x30, 0x78, 0xBC, 0x72,
+    0xCA, 0xE9, 0x2A, 0xB1, 0x46, 0x84, 0x52, 0xDA, 0x40, 0xA4, 0xDA, 0x42, 0xDD, 0xC9, 0x29, 0xEE,
+    0x41, 0x4E, 0x39, 0xA3, 0xAA, 0xC0, 0xE9, 0x2C, 0xB2, 0x63, 0x34, 0x2D, 0xA3, 0xA8, 0xA6, 0x49,
+    0x0B, 0x25, 0x3D, 0xB1, 0xB4, 0xC4, 0xF7, 0xEB, 0x47, 0x75, 0x6E, 0x04, 0x87, 0x21, 0x1E, 0x0A,
+    0xDC, 0x2F, 0xFD, 0x76, 0xF5, 0xBA, 0x91, 0x1B, 0xD2, 0x47, 0xF7, 0x6B, 0x2E, 0x73, 0x90, 0xC0,
+    0x13, 0x5B, 0x86, 0x45, 0x32, 0x6C, 0x2F, 0x85, 0x62, 0x21, 0x7E, 0xCD, 0x3D, 0xA4, 0x93, 0xE0,
+    0xA4, 0xC9, 0x08, 0xBC, 0x29, 0x08, 0xDB, 0xB4, 0x40, 0x35, 0xA9, 0x7D, 0x56, 0xB9, 0xC4, 0xAE,
+    0x47, 0x4E, 0x57, 0x12, 0xD7, 0xFA, 0x97, 0x72, 0xA2, 0x8A, 0xEF, 0xC8, 0x87, 0x36, 0xBA, 0x2F,
+    0xB7, 0xAC, 0x92, 0x5F, 0x4B, 0xA1, 0xE4, 0xBA, 0x64, 0x4A, 0xE6, 0x42, 0x28, 0x2F, 0x08, 0x81,
+    0x6C, 0x6D, 0x22, 0x71, 0x06, 0x92, 0x8A, 0xE8, 0x56, 0x16, 0xB8, 0xDD, 0x72, 0x6C, 0x86, 0xBA,
+    0x53, 0x33, 0x31, 0x71, 0xF4, 0xD1, 0x6D, 0xBF, 0x9A, 0xE4, 0x1F, 0x5B, 0x91, 0x56, 0x8B, 0x64,
+    0xA5, 0x38, 0xD5, 0xF6, 0x98, 0xB8, 0xDA, 0xAE, 0xDA, 0x42, 0x0F, 0xA5, 0x63, 0x29, 0xB6, 0xDF,
+    0x79, 0xA7, 0x09, 0x2E, 0x11, 0x35, 0xAC, 0x34, 0x71, 0xD1, 0xEC, 0xB2, 0xD4, 0xA8, 0x5F, 0x3A,
+    0x7D, 0xAC, 0x9E, 0xC6, 0x1B, 0xB5, 0xFE, 0x30, 0x4B, 0x3D, 0xA6, 0xA6, 0xCC, 0x86, 0xA2, 0x27,
+    0xCD, 0x52, 0x4F, 0x59, 0x85, 0x2D, 0x84, 0xAE, 0xC5, 0x24, 0x85, 0xFA, 0xD4, 0x73, 0xE8, 0x40,
+    0xF1, 0x5D, 0x07, 0xF3, 0x37, 0xB6, 0xD2, 0x44, 0xBA, 0x58, 0xA4, 0xCA, 0xA5, 0x23, 0x90, 0x02,
+    0xE3, 0xD0, 0x1E, 0x25, 0x20, 0x15, 0xA6, 0x45, 0xF7, 0x28, 0xF9, 0xE4, 0xAD, 0x5C, 0xE4, 0xB8,
+    0x48, 0x9B, 0x8B, 0x58, 0x9E, 0x06, 0x47, 0x54, 0xEC, 0x08, 0x78, 0x11, 0x25, 0x1E, 0x5D, 0xE1,
+    0x49, 0x6C, 0xE8, 0x31, 0xFF, 0x2B, 0x13, 0x39, 0x2E, 0x02, 0x49, 0x46, 0xD0, 0x0C, 0x6D, 0xB9,
+    0xB7, 0xBF, 0x25, 0xD8, 0x2A, 0x61, 0x83, 0xAE, 0x86, 0x96, 0xCE, 0x37, 0x82, 0x01, 0xE3, 0xD8,
+    0x22, 0x0E, 0xE5, 0x41, 0xEF, 0xC4, 0xE8, 0xD1, 0x31, 0x61, 0xA2, 0x33, 0xD3, 0x60, 0xB2, 0x5D,
+    0x75, 0x8E, 0x16, 0x67, 0xC4, 0xD2, 0xA1, 0xED, 0x20, 0xFC, 0xFB, 0x93, 0x5A, 0x9A, 0x5C, 0x1C,
+    0x99, 0xB9, 0x21, 0xAF, 0x57, 0x86, 0x56, 0xD5, 0xBA, 0x78, 0xD0, 0x52, 0x01, 0x66, 0xAC, 0x90,
+    0xC3, 0x82, 0x7A, 0xAD, 0x72, 0xC0, 0x41, 0xA2, 0x66, 0xD8, 0x53, 0x48, 0x9E, 0xEF, 0xFF, 0xE2,
+    0xCD, 0x9F, 0x2E, 0xF2, 0xD2, 0x0B, 0xE2, 0x4D, 0x5F, 0xC0, 0xC9, 0x54, 0xBA, 0xFC, 0xC2, 0x2F,
+    0x40, 0x1F, 0x9B, 0x8B, 0xCB, 0x1D, 0x19, 0xCF, 0xE9, 0xF9, 0x6D, 0x0F, 0xA3, 0xE9, 0x6C, 0xB6,
+    0xB6, 0x76, 0xE4, 0xF1, 0xE7, 0xF7, 0x25, 0x7B, 0x37, 0xDB, 0xE9, 0xC0, 0x15, 0x69, 0xD8, 0x0E,
+    0x1B, 0xB8, 0xD3, 0xF8, 0xD5, 0xFB, 0x75, 0xD4, 0x72, 0x70, 0x98, 0xDD, 0x2D, 0x2B, 0x78, 0xF2,
+    0xA1, 0xAF, 0x56, 0x46, 0xCE, 0xA8, 0x36, 0xB5, 0x3F, 0x3F, 0xF0, 0x67, 0x5D, 0x72, 0xA5, 0x35,
+    0xC7, 0xDD, 0xA1, 0xB3, 0x3E, 0x7D, 0xD5, 0xEB, 0xAA, 0x8F, 0x5F, 0xDC, 0x68, 0x0E, 0x07, 0x1C,
+    0xD1, 0x67, 0x9B, 0x7A, 0x1F, 0xCF, 0x2D, 0x6B, 0x79, 0xFF, 0x9F, 0x0E, 0x1B, 0x9F, 0x4F, 0x1F,
+    0x3C, 0x3C, 0xFD, 0x9D, 0x3D, 0x87, 0x8F, 0x8C, 0xFF, 0x0E, 0x0B, 0x38, 0x33, 0xF7, 0x66, 0xEE,
+    0x35, 0xCB, 0x2C, 0xAE, 0x2F, 0x72, 0xA0, 0x3C, 0x2B, 0x7E, 0xFF, 0x4B, 0x3C, 0xA7, 0xCF, 0x7D,
+    0xEA, 0x47, 0xA3, 0xD9, 0x6C, 0x6D, 0x0D, 0x92, 0xBD, 0x9B, 0xED, 0xF4, 0xD0, 0x59, 0x6F, 0xCE,
+    0x36, 0xB9, 0xAE, 0xB7, 0x6F, 0x80, 0x38, 0x98, 0x9C, 0x38, 0xD6, 0xE5, 0x19, 0xFB, 0x27, 0x93,
+    0xC9, 0x64, 0x25, 0xEF, 0xE4, 0x8B, 0x0F, 0x3E, 0x4E, 0x9E, 0xE3, 0xAD, 0x49, 0xBA, 0x15, 0xD8,
+    0x33, 0xF0, 0x0C, 0xCA, 0x61, 0x9C, 0xFA, 0xC2, 0x4D, 0x42, 0x37, 0xFE, 0x61, 0x77, 0xCB, 0xAC,
+    0x4E, 0x0F, 0x88, 0x96, 0x1A, 0x0E, 0x49, 0x22, 0x7F, 0xF5, 0x52, 0xB6, 0xF5, 0x66, 0x29, 0xB7,
+    0xC4, 0xED, 0x9B, 0x3E, 0x3D, 0x3D, 0x0D, 0xB4, 0xB3, 0x76, 0x26, 0x9D, 0x74, 0x2F, 0x9D, 0xCC,
+    0xEF, 0xCA, 0xCD, 0xE3, 0xFF, 0xFE, 0x60, 0x7E, 0x57, 0xEA, 0x85, 0x1F, 0xCB, 0xC6, 0xBF, 0xFE,
+    0x37, 0x9F, 0xFC, 0x3D, 0x7E, 0x37, 0x73, 0x5A, 0xBD, 0xBC, 0x15, 0x5E, 0xF5, 0xC6, 0x7F, 0x3E,
+    0xBF, 0x7B, 0xA7, 0x68, 0xA7, 0x4C, 0x7E, 0xFD, 0xEC, 0x1D, 0xE7, 0xFD, 0xD6, 0xA8, 0x0E, 0x94,
+    0x73, 0xF1, 0xFB, 0x5F, 0xDA, 0x75, 0x97, 0xC8, 0xF8, 0xF0, 0x78, 0xEB, 0x00, 0x99, 0xCB, 0x3F,
+    0x5A, 0x0B, 0x9A, 0x20, 0x03, 0x7E, 0xCF, 0xAC, 0x97, 0xB7, 0x3E, 0xEF, 0xFF, 0x8B, 0x57, 0x85,
+    0xCA, 0x62, 0x34, 0x7B, 0xF9, 0xDE, 0x76, 0x9D, 0x16, 0xD6, 0x43, 0xD5, 0xAD, 0x1E, 0xB0, 0x5A,
+    0xD4, 0x07, 0x3E, 0x91, 0x6B, 0xDE, 0x7C, 0xF0, 0xB9, 0x37, 0xEF, 0x4B, 0xB3, 0xFF, 0x0F, 0x0F,
+    0x64, 0x24, 0x30, 0xDC, 0x39, 0x11, 0xB6, 0xCF, 0xE5, 0x9F, 0xFE, 0xFA, 0x83, 0x6E, 0xF1, 0xC0,
+    0xD1, 0xB7, 0x17, 0xF3, 0xCD, 0x5F, 0x7F, 0x3C, 0x7B, 0x39, 0xB7, 0xC1, 0xDB, 0x04, 0x7B, 0xD4,
+    0x75, 0xBB, 0x2F, 0xE3, 0xC9, 0xE7, 0xF7, 0x00, 0xD4, 0x70, 0xA3, 0xE1, 0x54, 0x20, 0x52, 0xB3,
+    0xFF, 0x24, 0xEC, 0x5F, 0x46, 0x4B, 0x1F, 0x34, 0x9C, 0xDA, 0x0B, 0x7B, 0x77, 0x73, 0xC1, 0x5B,
+    0x4A, 0x44, 0x3A, 0x2D, 0x22, 0x0D, 0x70, 0x78, 0xA7, 0x4B, 0xA7, 0x2B, 0xE2, 0x9D, 0xB2, 0x4C,
+    0x89, 0x68, 0x69, 0xCD, 0x49, 0x5A, 0x54, 0x8D, 0xFE, 0xAB, 0xC2, 0x08, 0xE2, 0x55, 0x8D, 0x2E,
+    0xC8, 0x2F, 0xFC, 0x99, 0xC8, 0x39, 0x91, 0x44, 0x3C, 0x10, 0x6E, 0xAD, 0x86, 0xC8, 0xC2, 0x14,
+    0x22, 0x0B, 0x6B, 0x10, 0x4B, 0x4D, 0x29, 0x36, 0x76, 0x2B, 0xAC, 0x86, 0x2E, 0xB6, 0x09, 0xAB,
+    0xA1, 0x8B, 0xAF, 0xF4, 0xAC, 0xA5, 0x76, 0xE1, 0xE8, 0x32, 0x7B, 0xE0, 0x12, 0xCA, 0x3E, 0xD8,
+    0xD2, 0x63, 0xB8, 0x9F, 0xE8, 0x6F, 0x36, 0x75, 0xB6, 0x9E, 0x36, 0x68, 0x0B, 0xA7, 0x2A, 0x8C,
+    0x58, 0x5D, 0xE7, 0x41, 0x13, 0x34, 0x29, 0x0B, 0xC7, 0x44, 0x30, 0xE2, 0x54, 0x0D, 0x06, 0x54,
+    0xA7, 0x7C, 0x2A, 0x52, 0x88, 0x34, 0x91, 0xF4, 0xC4, 0x83, 0xF0, 0xF8, 0x7F, 0xA5, 0x9A, 0x5F,
+    0xAC, 0x1D, 0xC7, 0x7D, 0xDF, 0x3F, 0xBB, 0x63, 0x72, 0x6D, 0xAE, 0xA3, 0x61, 0x01, 0x09, 0x81,
+    0x2D, 0x89, 0x9B, 0x87, 0x14, 0x50, 0x04, 0x92, 0x6B, 0x14, 0x32, 0x40, 0x03, 0xE7, 0x9E, 0x59,
+    0x8A, 0x40, 0x08, 0x44, 0x2D, 0x78, 0x1F, 0xA4, 0x3E, 0xD4, 0x4A, 0xAD, 0x07, 0x3F, 0xB8, 0xAA,
+    0x61, 0x06, 0x85, 0x1A, 0xD0, 0xED, 0x39, 0x77, 0x57, 0xBC, 0x28, 0x08, 0x54, 0xA8, 0x79, 0x1B,
+    0xC0, 0xC9, 0x4B, 0x5A, 0xCB, 0xAD, 0x9C, 0x5A, 0x94, 0x13, 0x0A, 0x08, 0x1F, 0xAE, 0xDB, 0x73,
+    0xEF, 0x0E, 0x79, 0xD2, 0x12, 0x30, 0x81, 0x72, 0xC9, 0xEB, 0x56, 0x0F, 0x01, 0xC2, 0x95, 0x25,
+    0x59, 0x89, 0x54, 0x98, 0x43, 0x69, 0x24, 0x2D, 0xC9, 0xD9, 0xFD, 0xF5, 0xE1, 0xDC, 0xCB, 0x3F,
+    0x8E, 0xDD, 0x18, 0xE8, 0xCC, 0xFE, 0x66, 0x67, 0x66, 0xCF, 0xFC, 0xD9, 0xD9, 0xF9, 0xFD, 0xFB,
+    0xCE, 0x61, 0x57, 0x41, 0x26, 0x56, 0x89, 0x67, 0x33, 0x42, 0x5B, 0x08, 0x90, 0xDE, 0x04, 0x23,
+    0x05, 0xB5, 0x40, 0xD6, 0x41, 0x6E, 0xD7, 0xE3, 0x90, 0x89, 0xAC, 0x8A, 0xB8, 0x3D, 0xF2, 0x36,
+    0x80, 0xD1, 0x73, 0x17, 0xEE, 0x49, 0xB2, 0x06, 0xC6, 0x63, 0x63, 0x8C, 0x01, 0x00, 0xE5, 0x7E,
+    0x59, 0x4C, 0x3C, 0xB1, 0x47, 0x37, 0x18, 0x08, 0x28, 0x87, 0xB6, 0xAC, 0x10, 0x75, 0x24, 0x2D,
+    0x79, 0xC1, 0xC6, 0xA2, 0x6A, 0xB9, 0x54, 0xD2, 0x69, 0x69, 0x4C, 0xCF, 0xAE, 0x02, 0x25, 0x9E,
+    0x48, 0x06, 0x18, 0xA5, 0x05, 0x3A, 0x6E, 0x50, 0xF6, 0x1C, 0x91, 0x3B, 0x00, 0x93, 0x54, 0xAA,
+    0x2C, 0x96, 0x90, 0x54, 0xEB, 0xF9, 0x93, 0xED, 0x41, 0xD5, 0xAE, 0xA7, 0x7F, 0xE8, 0x37, 0x63,
+    0x09, 0xA6, 0xA8, 0xBB, 0x3D, 0x05, 0x77, 0x43, 0x07, 0x74, 0xB1, 0xA5, 0x53, 0x77, 0x49, 0xE4,
+    0x56, 0x25, 0x22, 0xBE, 0x53, 0x12, 0x3A, 0xD5, 0xCC, 0x3A, 0xD5, 0x4C, 0x3B, 0xF5, 0x4E, 0xE8,
+    0x94, 0x74, 0x9D, 0x92, 0xF6, 0xE9, 0xED, 0xB6, 0xA5, 0x88, 0xDD, 0x21, 0xF2, 0x02, 0xF2, 0xEA,
+    0x2E, 0x19, 0x69, 0x30, 0xE2, 0x31, 0xB6, 0xC3, 0x54, 0x13, 0x4C, 0x31, 0xC1, 0x14, 0x33, 0x4C,
+    0xB5, 0xA0, 0x08, 0x94, 0x25, 0x6A, 0xC1, 0x2F, 0x56, 0x66, 0x20, 0x94, 0x8C, 0x4D, 0xA1, 0xBF,
+    0x63, 0x93, 0xEB, 0x36, 0x92, 0x96, 0xD2, 0x91, 0x7B, 0xD2, 0x01, 0x25, 0x2D, 0x22, 0x18, 0xE3,
+    0xF4, 0x5C, 0x12, 0x57, 0xFA, 0xA4, 0x81, 0x15, 0x48, 0x1C, 0xF7, 0x86, 0xC8, 0xB3, 0xBC, 0xC4,
+    0xA0, 0xAB, 0x72, 0xB5, 0x35, 0x6D, 0x97, 0x85, 0xB1, 0x16, 0x7D, 0xF1, 0xFA, 0xFC, 0xC3, 0x4F,
+    0x5C, 0x7F, 0x33, 0x98, 0x50, 0xEA, 0x21, 0xBB, 0x2A, 0x47, 0x7D, 0x7D, 0xA1, 0xCF, 0x9B, 0xBA,
+    0x8A, 0x28, 0xCC, 0xD9, 0xA2, 0x0E, 0x94, 0xD5, 0x4E, 0x0F, 0x0F, 0xF1, 0xE0, 0x34, 0xF2, 0x21,
+    0x3D, 0xDF, 0x8D, 0x95, 0xF3, 0xC9, 0xBB, 0x56, 0x0F, 0x64, 0x1E, 0x63, 0x29, 0x89, 0x3C, 0xDA,
+    0xEA, 0x01, 0xE3, 0x18, 0x16, 0xA3, 0xA9, 0x77, 0x1B, 0xFD, 0x9D, 0x62, 0x3C, 0xE5, 0xE6, 0xDF,
+    0xCA, 0xCA, 0x50, 0x4A, 0xF7, 0xDA, 0xAD, 0xB5, 0xC4, 0x92, 0xC1, 0xD7, 0x48, 0x2B, 0x0C, 0x6C,
+    0xDC, 0x37, 0xDD, 0xB8, 0x67, 0xE8, 0xC6, 0xBF, 0x3E, 0x97, 0x61, 0xE5, 0x7B, 0x47, 0x1B, 0x8C,
+    0xBC, 0x29, 0x43, 0x2C, 0x45, 0xE4, 0x60, 0x46, 0x54, 0xB7, 0xB1, 0x78, 0x62, 0x07, 0x43, 0x8F,
+    0x11, 0xAB, 0xAF, 0x78, 0xD5, 0xEE, 0xA3, 0x4B, 0xEC, 0x38, 0x76, 0x59, 0x35, 0x4B, 0x9C, 0x79,
+    0x31, 0x94, 0x2D, 0xB9, 0x23, 0x59, 0xE3, 0x1C, 0x9A, 0xB8, 0xE5, 0x41, 0x8C, 0xCC, 0x25, 0x8C,
+    0x51, 0x0E, 0x73, 0x7F, 0x02, 0xC4, 0x5D, 0x74, 0xCB, 0x8D, 0x92, 0xD5, 0xFF, 0x55, 0x94, 0x21,
+    0xA9, 0x58, 0xDA, 0xBD, 0x2A, 0x21, 0x93, 0xE2, 0xF9, 0x35, 0x20, 0xF7, 0xFA, 0x35, 0x1C, 0xE9,
+    0x4D, 0xD2, 0x40, 0xD2, 0x0E, 0x83, 0x91, 0xF3, 0x75, 0x0B, 0x4C, 0x37, 0x36, 0x5F, 0x85, 0xD1,
+    0x68, 0x34, 0x1A, 0x4D, 0x26, 0xD3, 0x29, 0x8C, 0x26, 0xD3, 0xE9, 0xC6, 0x06, 0x80, 0xB2, 0x3B,
+    0x31, 0xB1, 0x89, 0x4D, 0x9A, 0xA4, 0xE1, 0xE5, 0xC4, 0xE6, 0x8B, 0xB7, 0xCB, 0x59, 0x8F, 0xDB,
+    0xB4, 0x3A, 0xC8, 0xB9, 0xB8, 0xD1, 0xC5, 0x12, 0xCE, 0x58, 0x49, 0x3C, 0xEC, 0xFA, 0x2A, 0x79,
+    0xE0, 0x91, 0xFD, 0x3C, 0xB2, 0x9F, 0xFD, 0xB9, 0xDB, 0x7F, 0x60, 0xB6, 0x7F, 0xFF, 0x68, 0x74,
+    0x70, 0xB6, 0x9E, 0xBB, 0xE7, 0xA0, 0xDD, 0xAB, 0x2A, 0xFB, 0x80, 0x62, 0xE9, 0x1B, 0x88, 0xBC,
+    0x55, 0xBD, 0xFB, 0x57, 0xEA, 0xE8, 0x89, 0x07, 0x36, 0x5A, 0xD3, 0xFE, 0xEA, 0xAB, 0x12, 0x05,
+    0x6D, 0x59, 0x46, 0x13, 0xB5, 0x2C, 0x01, 0x6A, 0xAB, 0x1D, 0xCD, 0xD4, 0x35, 0x4C, 0x93, 0x74,
+    0x94, 0x55, 0x2A, 0xFC, 0xB0, 0xD7, 0xA7, 0xBA, 0xC4, 0x92, 0x36, 0x24, 0xED, 0xCE, 0xD7, 0x50,
+    0xD6, 0xE8, 0x38, 0x8C, 0xB4, 0x73, 0x32, 0xFF, 0xCB, 0xEB, 0x7A, 0x65, 0x62, 0x6E, 0x38, 0x39,
+    0x3A, 0x0F, 0xD9, 0x31, 0x3B, 0x05, 0xA2, 0xBD, 0x45, 0x2E, 0x55, 0x19, 0x28, 0xD7, 0xEE, 0xF9,
+    0x84, 0x4B, 0x74, 0x33, 0xD5, 0x74, 0x59, 0xEC, 0x3B, 0xF5, 0x61, 0x93, 0x0A, 0xBA, 0x23, 0xDF,
+    0xE6, 0xE1, 0xB4, 0x49, 0x85, 0xDC, 0xB3, 0x09, 0xE0, 0xF6, 0xDD, 0x1B, 0x65, 0x90, 0x41, 0x55,
+    0xAA, 0x8A, 0x00, 0x54, 0x43, 0x29, 0xB6, 0x14, 0xAB, 0x1A, 0x54, 0x8B, 0x92, 0x56, 0x49, 0x50,
+    0x6E, 0xA4, 0xDC, 0x92, 0x92, 0x3E, 0x96, 0x80, 0x04, 0x1E, 0x5F, 0x03, 0x54, 0xBB, 0x7D, 0x19,
+    0xB1, 0xAA, 0x45, 0x0D, 0x6B, 0x4A, 0x82, 0x72, 0x4B, 0xCA, 0x1D, 0x8C, 0x6F, 0x6D, 0xC6, 0xD2,
+    0x47, 0x12, 0x78, 0xFE, 0x95, 0x3D, 0x67, 0xCE, 0xBC, 0xA2, 0x45, 0x3A, 0x2D, 0xD2, 0xA9, 0x2E,
+    0x73, 0x51, 0x6F, 0x2C, 0xA5, 0x80, 0xE9, 0x89, 0x44, 0x2A, 0xF5, 0xC9, 0xFB, 0x36, 0xD9, 0x7A,
+    0xAB, 0xD5, 0xF3, 0x9F, 0x38, 0xBD, 0xFA, 0xA6, 0xCF, 0x8F, 0xB4, 0x21, 0x3F, 0xDA, 0x6C, 0x00,
+    0x5A, 0x3A, 0x2D, 0x5D, 0xB2, 0xD5, 0x46, 0x52, 0xC5, 0x52, 0xA5, 0xD3, 0x56, 0x8F, 0xDC, 0xBE,
+    0xD1, 0xB9, 0xA5, 0xD1, 0x24, 0xF1, 0xB9, 0x92, 0x53, 0x57, 0x6F, 0x7F, 0xE4, 0x83, 0x09, 0x26,
+    0x19, 0x76, 0xCB, 0x4D, 0x6A, 0xA1, 0x3E, 0xEB, 0x4C, 0x31, 0x64, 0x55, 0x76, 0xA9, 0x55, 0x1F,
+    0x74, 0x84, 0x9A, 0x32, 0x7B, 0xA7, 0x9C, 0x8B, 0xB4, 0xB5, 0xB8, 0x54, 0x3C, 0xC7, 0x5B, 0xD2,
+    0x2B, 0xAE, 0x7C, 0xF7, 0xC2, 0xBB, 0xA2, 0x5F, 0x72, 0xA9, 0x50, 0x8A, 0x6A, 0x57, 0x32, 0xBA,
+    0x89, 0x72, 0xFD, 0xF1, 0x55, 0xE9, 0x13, 0x69, 0xE3, 0x1E, 0xE0, 0x61, 0x20, 0xB7, 0x90, 0xB5,
+    0x01, 0x6D, 0x0D, 0x49, 0x9B, 0xB6, 0xCA, 0x11, 0x08, 0x98, 0x62, 0x93, 0xD4, 0x99, 0x22, 0x0A,
+    0xB9, 0xC5, 0x9C, 0x6E, 0x49, 0x6F, 0x7B, 0x22, 0x09, 0x60, 0x06, 0x48, 0xA5, 0x20, 0x12, 0x0B,
+    0x66, 0xE7, 0x6B, 0x1E, 0x84, 0xE9, 0x08, 0x77, 0x30, 0x6A, 0x33, 0xD5, 0xE8, 0xA3, 0x36, 0xBD,
+    0x5C, 0xA9, 0xEB, 0x85, 0x12, 0xE2, 0x01, 0x7A, 0x78, 0x8C, 0xD1, 0xE3, 0xC1, 0x04, 0x46, 0x8C,
+    0xC0, 0x91, 0xCC, 0x45, 0xB4, 0x84, 0x7B, 0x44, 0xEF, 0xFD, 0xD9, 0x7E, 0x9B, 0x81, 0x60, 0x42,
+    0x32, 0x97, 0x60, 0x64, 0xDE, 0xFE, 0x3C, 0x7F, 0x6D, 0x4B, 0x78, 0xB4, 0x04, 0x2D, 0x41, 0x5B,
+    0xB4, 0x45, 0xC4, 0x8B, 0xF8, 0x45, 0xFE, 0xEE, 0xD5, 0xA0, 0x1B, 0xF6, 0xBC, 0x9A, 0xC9, 0x3E,
+    0xEA, 0x3E, 0x7F, 0x3A, 0x63, 0x11, 0x01, 0x91, 0xB9, 0x48, 0x6A, 0xC9, 0x61, 0x46, 0xEC, 0x48,
+    0xA5, 0xCD, 0xC5, 0x6D, 0xA6, 0x57, 0x9D, 0x7E, 0xC9, 0x1E, 0x34, 0x74, 0xC1, 0x6C, 0x39, 0xD9,
+    0x75, 0xB8, 0x10, 0xF5, 0x63, 0xCD, 0xA8, 0x90, 0xAD, 0xF9, 0xE5, 0x64, 0x34, 0xF9, 0xA0, 0x01,
+    0xE5, 0x4B, 0x57, 0x93, 0x38, 0x99, 0x7B, 0xF4, 0x5B, 0x92, 0x57, 0xE8, 0xCB, 0x21, 0x40, 0x5E,
+    0x5F, 0x6F, 0xC1, 0x88, 0x00, 0xA5, 0x78, 0xA0, 0x96, 0x0A, 0x94, 0x08, 0xDB, 0xD5, 0x4A, 0x44,
+    0xA0, 0x7C, 0xF7, 0x63, 0x29, 0x12, 0xC9, 0xB6, 0xA4, 0xA8, 0x5D, 0x79, 0x44, 0x2A, 0x20, 0x6A,
+    0x01, 0x92, 0x0A, 0xE0, 0x73, 0xE8, 0x6C, 0xAB, 0xC9, 0xCC, 0x37, 0x58, 0xEA, 0xDD, 0x42, 0x0D,
+    0x76, 0xC4, 0xD2, 0x92, 0x4B, 0xAB, 0x6E, 0x7D, 0xE2, 0xCC, 0x4B, 0x97, 0x3C, 0x28, 0xE0, 0xB3,
+    0xE4, 0x3E, 0x93, 0xC3, 0xB1, 0x63, 0x42, 0xAE, 0x04, 0xA9, 0x98, 0x91, 0xFD, 0xA6, 0xBE, 0x24,
+    0x1F, 0x48, 0x77, 0xDC, 0x47, 0x8E, 0x09, 0x90, 0x35, 0x7F, 0x68, 0xD5, 0xE1, 0xAF, 0x6B, 0x17,
+    0x5F, 0x39, 0x7A, 0xBA, 0x37, 0xCD, 0x21, 0x02, 0x2F, 0x68, 0xFB, 0x18, 0xE9, 0x85, 0xC0, 0xCC,
+    0x14, 0xFA, 0x52, 0x4B, 0x1F, 0xD0, 0x75, 0x81, 0x38, 0xB2, 0x40, 0x24, 0x15, 0x59, 0x47, 0x2C,
+    0x8E, 0x5C, 0xAC, 0xFA, 0x58, 0x0A, 0x73, 0xAC, 0x57, 0xDE, 0x0C, 0x8B, 0x79, 0xEE, 0x03, 0x96,
+    0xF7, 0x4F, 0xD4, 0xE5, 0x62, 0xEC, 0x54, 0xC0, 0x14, 0x89, 0xA7, 0x6C, 0xD3, 0xB3, 0x76, 0xBD,
+    0xB6, 0x3C, 0x42, 0x54, 0x7D, 0x8A, 0xA8, 0xC8, 0xD1, 0x4D, 0x4E, 0x6E, 0xC7, 0x94, 0x8C, 0x5F,
+    0x18, 0x18, 0xFF, 0x7E, 0x60, 0x5C, 0x7B, 0x8C, 0x38, 0x8C, 0x78, 0x56, 0xFE, 0x5B, 0xCF, 0xCA,
+    0x39, 0x29, 0xA6, 0x94, 0xCD, 0x06, 0x59, 0xF7, 0xCF, 0xD8, 0xF3, 0xEA, 0xA7, 0xE1, 0xD1, 0xC8,
+    0x1D, 0x38, 0x62, 0x0F, 0x5C, 0xAE, 0x0E, 0x5E, 0xC7, 0xF4, 0x2C, 0x49, 0xB1, 0x74, 0xA9, 0x1D,
+    0xC5, 0x41, 0xCF, 0x3B, 0xDD, 0x87, 0xA8, 0xEF, 0x19, 0x97, 0x64, 0x75, 0x91, 0x48, 0x15, 0x89,
+    0xA5, 0x6E, 0xC8, 0x3B, 0xB4, 0x54, 0x4A, 0x02, 0x41, 0xAC, 0xD1, 0x21, 0x3B, 0x2F, 0x4D, 0x6A,
+    0x91, 0xC0, 0xD9, 0xBF, 0x26, 0xAD, 0xD0, 0x15, 0xFA, 0x77, 0x0A, 0x5D, 0xA2, 0x03, 0xDA, 0xA3,
+    0x3D, 0xBA, 0x27, 0x93, 0x2A, 0x3B, 0xDE, 0x66, 0x4F, 0x05, 0x09, 0xF9, 0xAA, 0xDC, 0x08, 0xE8,
+    0xD3, 0x0D, 0xE3, 0x92, 0xE8, 0xB6, 0x27, 0x91, 0x8A, 0x2C, 0x40, 0xDD, 0x10, 0x4B, 0x85, 0x96,
+    0x0A, 0x23, 0x96, 0x20, 0x56, 0x39, 0xB1, 0xD9, 0x79, 0x69, 0xE4, 0xF4, 0x8B, 0xDF, 0x98, 0xF0,
+    0xAF, 0x9B, 0x78, 0x20, 0x75, 0xE4, 0x16, 0xB1, 0xEA, 0x5A, 0xA3, 0xB3, 0x66, 0x05, 0x93, 0xB4,
+    0xCA, 0xDD, 0x73, 0x73, 0xCA, 0x95, 0x98, 0xF4, 0xD6, 0x6B, 0xAE, 0x16, 0x49, 0x45, 0x5C, 0x2D,
+    0xF2, 0x94, 0x4B, 0x7C, 0x4D, 0xF9, 0x92, 0x4B, 0x02, 0x28, 0x0B, 0xA3, 0x73, 0x3A, 0xAD, 0xDC,
+    0xBA, 0x7E, 0xAA, 0xF2, 0x1B, 0x5F, 0x79, 0x4A, 0x7C, 0x2D, 0x4F, 0xD9, 0x2E, 0x68, 0xCB, 0x23,
+    0x50, 0x19, 0x72, 0xF1, 0x81, 0x5A, 0xB6, 0x5C, 0xEC, 0xD1, 0x36, 0x6D, 0x30, 0x98, 0x82, 0x40,
+    0x8F, 0x72, 0xCA, 0xA3, 0xDF, 0x3B, 0xDB, 0x62, 0x44, 0x2A, 0x44, 0x06, 0x94, 0x48, 0x87, 0x6E,
+    0x74, 0x4B, 0x59, 0x98, 0x2A, 0xEA, 0x11, 0x18, 0x29, 0x99, 0xDB, 0xA5, 0xA7, 0x47, 0x89, 0x55,
+    0x76, 0xC2, 0x52, 0x62, 0x95, 0x04, 0x8C, 0x58, 0xF5, 0xCE, 0x8C, 0xA5, 0xC4, 0x6E, 0xF3, 0x92,
+    0x14, 0x88, 0x78, 0xF4, 0x7B, 0x75, 0x41, 0x50, 0x1D, 0xDA, 0x9A, 0x6A, 0x27, 0x23, 0x4D, 0x50,
+    0x22, 0xC7, 0xAC, 0x69, 0x42, 0x50, 0x5D, 0x72, 0xD9, 0x9A, 0x62, 0x29, 0x24, 0x3E, 0xB9, 0x6C,
+    0xCB, 0x53, 0x21, 0x24, 0x5D, 0xF9, 0xDB, 0xC5, 0x6F, 0x1D, 0x2E, 0x16, 0x86, 0x4A, 0x4B, 0x79,
+    0xB6, 0x65, 0x92, 0xB6, 0x4C, 0xEF, 0x90, 0xDB, 0x26, 0x69, 0xA7, 0xA9, 0x04, 0x52, 0xBF, 0x41,
+    0x6A, 0xC7, 0xA4, 0x36, 0x5F, 0xDC, 0xE7, 0x3D, 0xE9, 0x3C, 0xB0, 0xEB, 0xF0, 0xF2, 0x42, 0xA1,
+    0x59, 0x30, 0x37, 0x36, 0xC9, 0x6F, 0x89, 0xCB, 0xCE, 0xFB, 0x95, 0xD4, 0xFA, 0x74, 0xD5, 0x8D,
+    0x54, 0xD3, 0x65, 0xB1, 0x1B, 0x27, 0x57, 0x3B, 0x6D, 0x07, 0x39, 0xD9, 0x1B, 0x71, 0x46, 0xA4,
+    0x4F, 0x44, 0x3A, 0x1E, 0xDE, 0xD6, 0x15, 0x33, 0x22, 0xC9, 0xAB, 0x6E, 0xA5, 0x9B, 0x8C, 0xF4,
+    0x41, 0xAD, 0x2E, 0xAD, 0xCE, 0xAF, 0xF8, 0xDB, 0xC1, 0x88, 0x9C, 0x14, 0x29, 0xA2, 0x85, 0x39,
+    0x96, 0x0F, 0x91, 0x0C, 0x89, 0xF4, 0xDA, 0x7F, 0x2A, 0xB3, 0x98, 0x62, 0xE7, 0xAA, 0x30, 0xED,
+    0x2E, 0x23, 0xBD, 0x96, 0x3E, 0x91, 0x1E, 0xE9, 0xF9, 0xB3, 0x85, 0xD5, 0x46, 0x7D, 0x58, 0xDA,
+    0x9E, 0x11, 0x19, 0x49, 0x43, 0xFF, 0x5C, 0x26, 0xBB, 0xA5, 0x0A, 0x7C, 0x8D, 0x52, 0xE4, 0x9A,
+    0xC8, 0x27, 0x22, 0x81, 0x0D, 0xC8, 0x0B, 0xD2, 0x86, 0xD8, 0xC3, 0x06, 0x98, 0x02, 0xDD, 0xA0,
+    0x3C, 0x0C, 0x60, 0x5A, 0x74, 0x00, 0x0D, 0xCA, 0x96, 0x72, 0x4D, 0xDC, 0x3E, 0x92, 0x2A, 0x6A,
+    0x99, 0x90, 0x91, 0xD8, 0x28, 0x90, 0x12, 0x15, 0x06, 0x7D, 0xC1, 0xC7, 0x9D, 0xB6, 0x86, 0xCD,
+    0xB4, 0x55, 0x2E, 0x90, 0x9F, 0xAD, 0x10, 0x87, 0x1E, 0xA0, 0xB4, 0xA8, 0x0E, 0x4C, 0x75, 0xE7,
+    0x16, 0x98, 0xC6, 0x2E, 0xE8, 0x93, 0x6E, 0xAA, 0xAE, 0x3A, 0x7D, 0xB9, 0xCA, 0x67, 0x18, 0x87,
+    0x54, 0xD1, 0x7D, 0x82, 0xF5, 0x9E, 0x4E, 0x37, 0xD2, 0x36, 0x71, 0x01, 0x73, 0xBC, 0x8A, 0xC4,
+    0xA1, 0x85, 0x4C, 0x24, 0x12, 0x71, 0xF7, 0x77, 0xFA, 0x20, 0xCB, 0x9D, 0x9E, 0xBB, 0x71, 0x72,
+    0xDE, 0xE9, 0xD3, 0xD6, 0x2C, 0x51, 0x3A, 0xC4, 0xC6, 0xBD, 0x12, 0xB9, 0x26, 0x52, 0x18, 0x08,
+    0xC4, 0x2F, 0x93, 0x17, 0xDA, 0x86, 0xC8, 0xA7, 0xAD, 0xC1, 0x68, 0x1B, 0xF5, 0x1D, 0x5A, 0xC0,
+    0x34, 0xA8, 0x00, 0x65, 0x8B, 0x96, 0x42, 0x0D, 0x81, 0x5A, 0xBB, 0xAC, 0xAD, 0x57, 0x43, 0xDA,
+    0xC3, 0x3A, 0xA4, 0x15, 0xEC, 0xE5, 0x80, 0xB2, 0xEE, 0x5C, 0x72, 0x8D, 0xDC, 0xD2, 0x91, 0xDB,
+    0x44, 0xE8, 0x3A, 0xA3, 0x1B, 0x5A, 0x3E, 0xB3, 0x6D, 0xEC, 0xBE, 0xD5, 0x94, 0xF2, 0x56, 0x43,
+    0x50, 0xBF, 0x9C, 0x44, 0xFA, 0x3B, 0x04, 0xD3, 0x1D, 0xAA, 0xBB, 0x2B, 0x67, 0xFF, 0xA8, 0x38,
+    0xF4, 0x28, 0xED, 0x0B, 0xEA, 0xC5, 0xE6, 0x81, 0xA4, 0x18, 0xED, 0x43, 0x44, 0x49, 0x00, 0x87,
+    0xB2, 0xF0, 0x74, 0xB4, 0x3C, 0x53, 0xED, 0xE2, 0x9A, 0xA8, 0x76, 0xA2, 0xDA, 0xA5, 0xB4, 0x35,
+    0xD2, 0x6A, 0x69, 0xEF, 0x6A, 0x7D, 0xF5, 0x36, 0x2A, 0xA0, 0x02, 0x4C, 0x60, 0xF2, 0xF2, 0x63,
+    0x6E, 0xF4, 0xFA, 0xE8, 0xF5, 0xD1, 0x0B, 0x13, 0x13, 0x76, 0x4D, 0x18, 0x31, 0xC2, 0x90, 0xA3,
+    0xF7, 0x46, 0xFB, 0xA2, 0x77, 0x8B, 0x1F, 0x36, 0x07, 0xFF, 0xFC, 0xA5, 0x1F, 0x7C, 0xF8, 0xFE,
+    0x66, 0x2F, 0x62, 0x6E, 0x9F, 0xBF, 0xE1, 0x46, 0x93, 0x3D, 0x19, 0x89, 0xDD, 0xBB, 0xB7, 0x79,
+    0x4B, 0xFD, 0xBB, 0xFF, 0x69, 0xD6, 0xA5, 0xFD, 0xF8, 0xC5, 0x1F, 0x31, 0x3A, 0x00, 0x1D, 0xAA,
+    0x45, 0x57, 0x8C, 0x21, 0xA0, 0xA4, 0xD3, 0xE2, 0xCD, 0x93, 0xAE, 0x4B, 0xE6, 0x6D, 0xA6, 0xAB,
+    0xC9, 0x38, 0x72, 0x21, 0xBD, 0xB2, 0xFC, 0x10, 0xD9, 0x8E, 0x4E, 0xB2, 0x8C, 0x61, 0xE8, 0x95,
+    0x04, 0x7D, 0xC5, 0x8F, 0xA3, 0xB6, 0x4B, 0xE6, 0x6D, 0x9E, 0x55, 0xB3, 0x52, 0xDD, 0x08, 0xDA,
+    0x42, 0xFA, 0x36, 0xA4, 0xE2, 0x88, 0xFA, 0xFC, 0xB4, 0x35, 0xCC, 0x44, 0x44, 0xDE, 0x10, 0x91,
+    0x61, 0xD7, 0x57, 0x6E, 0x7D, 0x6F, 0x99, 0x0D, 0x20, 0xB9, 0xC9, 0xCB, 0x18, 0x19, 0x88, 0x44,
+    0x5A, 0x94, 0xF4, 0x10, 0x3D, 0x0D, 0x51, 0x0F, 0x2B, 0xDD, 0x48, 0xAB, 0xB9, 0x48, 0xFF, 0xB0,
+    0xC8, 0x5A, 0xDC, 0x42, 0xF6, 0x5E, 0x43, 0xDD, 0x13, 0x49, 0x05, 0xBB, 0x6F, 0x02, 0xF5, 0x00,
+    0xA9, 0xDF, 0xD0, 0xD6, 0x30, 0x33, 0x22, 0xE2, 0x6B, 0x11, 0x69, 0x1F, 0x2A, 0xDF, 0xFB, 0x36,
+    0xF4, 0x40, 0x3C, 0x14, 0xBF, 0x89, 0x12, 0x69, 0x48, 0x44, 0x0A, 0x62, 0xE9, 0x80, 0x1F, 0x02,
+    0x71, 0x03, 0xEC, 0x06, 0x78, 0x1A, 0x4A, 0xF7, 0xD5, 0xEC, 0xE8, 0x29, 0x91, 0x60, 0x44, 0xAC,
+    0x6A, 0x60, 0x0C, 0xF1, 0xF0, 0x03, 0xB4, 0x58, 0x72, 0x0F, 0xBF, 0x07, 0xC9, 0x2F, 0x74, 0xE7,
+    0x00, 0xF0, 0x23, 0xC0, 0x08, 0x90, 0x08, 0xC0, 0xA7, 0xF8, 0xC5, 0x21, 0x0A, 0x79, 0xDB, 0x63,
+    0x5E, 0xEA, 0x6A, 0xD4, 0x8D, 0xDE, 0x14, 0xD4, 0xE5, 0xF1, 0x0A, 0x7D, 0xFD, 0xBA, 0x25, 0x12,
+    0x69, 0x20, 0x17, 0x07, 0x4A, 0x1C, 0x44, 0xD2, 0xB3, 0x58, 0x8F, 0x58, 0x64, 0x20, 0x96, 0xBA,
+    0x6E, 0x95, 0x7C, 0xE5, 0x0D, 0x51, 0x72, 0xAA, 0xAB, 0xB7, 0xCD, 0x8F, 0xF4, 0x64, 0x0B, 0x89,
+    0x34, 0x10, 0x4B, 0xF5, 0x0B, 0x47, 0x4C, 0x9C, 0xE8, 0x26, 0xEE, 0x86, 0xBC, 0x22, 0x6C, 0x96,
+    0x50, 0x6E, 0xF4, 0x90, 0x4B, 0x07, 0x5A, 0x1C, 0x24, 0x62, 0x21, 0x95, 0x16, 0x8C, 0x04, 0x22,
+    0x11, 0x29, 0xD2, 0x5E, 0xCA, 0x26, 0xF7, 0x92, 0x77, 0x07, 0x74, 0xD5, 0x6D, 0xA8, 0x2D, 0xA7,
+    0xCB, 0x62, 0xDC, 0x45, 0x62, 0x93, 0x9E, 0x4C, 0x8A, 0x5A, 0x4E, 0x7A, 0xF3, 0x94, 0x35, 0x86,
+    0x10, 0xD4, 0x8D, 0xE5, 0xCC, 0x26, 0x3D, 0x79, 0xBB, 0xF0, 0x65, 0x1E, 0x39, 0xB1, 0xDF, 0x1D,
+    0x6C, 0x8D, 0x35, 0x95, 0xF1, 0xA3, 0xC9, 0xE8, 0xD1, 0xC9, 0x01, 0x96, 0xA2, 0x40, 0x0B, 0xD1,
+    0x33, 0x4F, 0x23, 0x82, 0x11, 0xAB, 0xE7, 0x4E, 0xB9, 0x40, 0x30, 0x8C, 0xB5, 0xD5, 0xAB, 0x4E,
+    0xB5, 0x21, 0xF2, 0x86, 0xA9, 0xB6, 0xF9, 0x91, 0x60, 0xAC, 0xE8, 0xC6, 0x54, 0xE8, 0x86, 0xC4,
+    0x11, 0x07, 0x76, 0x9F, 0x89, 0xC5, 0x9E, 0x73, 0x07, 0x46, 0xA9, 0x56, 0x73, 0xEB, 0xDC, 0x68,
+    0x64, 0xF4, 0xBF, 0x55, 0x0D, 0x8E, 0x99, 0x21, 0x57, 0x2E, 0xF6, 0x86, 0xFC, 0x88, 0x8B, 0xBD,
+    0xC1, 0x1C, 0x71, 0xCA, 0x1B, 0xCC, 0x91, 0x5B, 0xAF, 0x75, 0x46, 0x64, 0x55, 0xA4, 0x33, 0x22,
+    0xAB, 0x5E, 0x85, 0xB2, 0x30, 0x6F, 0x78, 0x35, 0x80, 0x6E, 0xD1, 0x3D, 0x91, 0x58, 0xB2, 0xB7,
+    0x01, 0x46, 0x6A, 0x6E, 0x47, 0xA3, 0x64, 0x6E, 0x27, 0x4B, 0xDB, 0x76, 0xDC, 0x3B, 0xB3, 0xA5,
+    0xA4, 0x65, 0x8C, 0x6E, 0xA3, 0x0E, 0xF8, 0x95, 0xC7, 0xE8, 0xCA, 0xC2, 0x5C, 0xF4, 0xAA, 0x07,
+    0xDD, 0x42, 0x0F, 0xDA, 0x12, 0x07, 0x30, 0x15, 0x30, 0x52, 0xD6, 0x69, 0x65, 0x47, 0x3A, 0x72,
+    0xE3, 0x2F, 0x5B, 0x11, 0x25, 0x41, 0x1F, 0x76, 0x4B, 0x49, 0x83, 0xB6, 0x8C, 0xC1, 0xB1, 0xBB,
+    0x7A, 0x28, 0x5A, 0x0E, 0xE9, 0x56, 0x9B, 0x1D, 0xAB, 0xA6, 0xE3, 0xC8, 0xAF, 0x27, 0x57, 0x9D,
+    0x39, 0x22, 0x7D, 0x22, 0x9E, 0xD4, 0x92, 0xC1, 0x84, 0x68, 0x47, 0x60, 0x3A, 0xA2, 0x62, 0xEF,
+    0xDF, 0x3B, 0xFF, 0xA3, 0xF4, 0xB1, 0xFD, 0x2F, 0xDF, 0x90, 0xF3, 0xFF, 0x85, 0x99, 0x72, 0x9A,
+    0x11, 0x7B, 0x8D, 0x4D, 0x9C, 0xF6, 0x2A, 0xA8, 0x01, 0x41, 0x6C, 0xDD, 0x98, 0xCE, 0x78, 0x2D,
+    0x59, 0xAF, 0xE4, 0x9A, 0x14, 0x83, 0xDC, 0x6E, 0x8C, 0xB9, 0xE5, 0xF5, 0xE5, 0x7E, 0x50, 0x37,
+    0xC4, 0x54, 0xC1, 0x9C, 0x6E, 0x4B, 0xBD, 0xD5, 0x65, 0xCD, 0xF2, 0x00, 0x68, 0x07, 0x71, 0x00,
+    0x06, 0xC0, 0x14, 0x90, 0x59, 0xD8, 0xB3, 0x66, 0x22, 0x67, 0x94, 0x33, 0xA7, 0x9C, 0xB9, 0xE4,
+    0xCC, 0x75, 0xB7, 0x34, 0xB8, 0x51, 0xEF, 0x47, 0x33, 0xBF, 0xF4, 0xF7, 0x3D, 0x4C, 0x61, 0x02,
+    0x33, 0xF0, 0x93, 0xC9, 0x64, 0x32, 0x9D, 0x4E, 0xA7, 0xD3, 0xA5, 0xA5, 0xA5, 0xDF, 0x02, 0xC8,
+    0x5F, 0xB3, 0x91, 0x78, 0xD2, 0xE1, 0xCE, 0x5E, 0xD4, 0xC5, 0x62, 0x49, 0x1A, 0x92, 0x01, 0x6E,
+    0x39, 0xB2, 0x63, 0x45, 0xEC, 0x02, 0x26, 0x6D, 0x92, 0x76, 0x05, 0x11, 0x97, 0x89, 0x9C, 0x14,
+    0x09, 0xA6, 0xD0, 0x6F, 0x38, 0x86, 0xBD, 0xBB, 0xD4, 0x7B, 0xCE, 0x0C, 0xD4, 0x0B, 0x8D, 0x98,
+    0xDC, 0x7E, 0x51, 0xC2, 0x92, 0x9E, 0x57, 0x93, 0x17, 0xD4, 0xC5, 0x62, 0x6A, 0xE4, 0xAA, 0x0C,
+    0xE9, 0x27, 0x2D, 0xDE, 0xA3, 0x8F, 0x15, 0xD1, 0xCD, 0xEE, 0xCE, 0x40, 0x1E, 0x72, 0x8B, 0xEA,
+    0x17, 0x42, 0xFE, 0x2C, 0x91, 0xF7, 0xE4, 0xDA, 0x2A, 0xB7, 0xC1, 0x4A, 0xD2, 0x6A, 0x91, 0x48,
+    0xA4, 0xCB, 0x45, 0xE6, 0x9E, 0xBE, 0x44, 0xB7, 0xE3, 0x5C, 0xFD, 0xC4, 0x97, 0xE6, 0xB7, 0xFF,
+    0xD3, 0x2B, 0xFF, 0xCF, 0x81, 0xF8, 0x93, 0x5A, 0x60, 0x53, 0xA4, 0xC2, 0xC8, 0xF7, 0x0A, 0x8C,
+    0x54, 0x90, 0x95, 0x2D, 0xE8, 0xD3, 0xFD, 0xD7, 0x48, 0xB6, 0x44, 0x50, 0xAE, 0x16, 0x1B, 0xFB,
+    0xAC, 0x05, 0x91, 0x0E, 0x6A, 0x91, 0x33, 0x6B, 0xA5, 0x88, 0x04, 0x53, 0x69, 0x91, 0xCC, 0x2A,
+    0x91, 0xE6, 0xAE, 0x3C, 0x18, 0x7E, 0xDA, 0x45, 0x22, 0x62, 0xBD, 0xB9, 0xB2, 0x7E, 0x28, 0x11,
+    0x79, 0x94, 0xE1, 0xDB, 0x47, 0x8B, 0x92, 0xBD, 0x22, 0x12, 0x72, 0x11, 0x89, 0x7B, 0x19, 0x0A,
+    0x60, 0x96, 0x45, 0xE2, 0xEF, 0x61, 0x72, 0x2D, 0xC1, 0x48, 0xDB, 0x2F, 0x2F, 0x64, 0xB5, 0xF9,
+    0xC7, 0x48, 0x50, 0xE2, 0x74, 0xC5, 0x98, 0x68, 0x38, 0x73, 0x54, 0x86, 0x4C, 0x42, 0x29, 0xEE,
+    0x53, 0xD1, 0xE1, 0x9B, 0x33, 0x2D, 0x45, 0xD9, 0xFC, 0x9D, 0x38, 0x03, 0x10, 0xCB, 0x9A, 0x12,
+    0x41, 0xC4, 0xFD, 0xAB, 0xB3, 0xFD, 0x42, 0xD7, 0xDE, 0x38, 0x23, 0xA1, 0x94, 0x41, 0x8B, 0x1C,
+    0x69, 0xB5, 0x5D, 0x49, 0xDB, 0x54, 0x5A, 0x8E, 0xAF, 0x01, 0x64, 0x5D, 0x2A, 0xAE, 0x96, 0xBF,
+    0x60, 0x46, 0xF2, 0x97, 0xD2, 0x97, 0x32, 0xB7, 0xEB, 0x59, 0x7D, 0x17, 0x3D, 0xF1, 0x9E, 0xE9,
+    0x94, 0xEC, 0x3B, 0x3B, 0xE5, 0xFA, 0x6D, 0x44, 0xAC, 0x91, 0xB0, 0xEF, 0x35, 0x29, 0xD0, 0x2D,
+    0x84, 0xE7, 0x6B, 0x59, 0x00, 0x66, 0x4D, 0xA7, 0x5C, 0x76, 0xB2, 0x8B, 0xA5, 0xE3, 0xE1, 0xB7,
+    0x7F, 0x59, 0xE7, 0x79, 0x4D, 0x59, 0x65, 0x59, 0xFC, 0x81, 0xDB, 0xC1, 0xCF, 0x00, 0x66, 0x33,
+    0x20, 0xCF, 0x01, 0x7D, 0xD9, 0xFE, 0x62, 0xB1, 0xAB, 0x5C, 0x39, 0xEF, 0xA8, 0xB3, 0x1B, 0x01,
+    0xBD, 0xD5, 0xF5, 0x44, 0x61, 0xA8, 0xC1, 0xD4, 0x35, 0x28, 0x91, 0x0A, 0x6A, 0xB1, 0xA0, 0xA5,
+    0x01, 0x25, 0x1D, 0x24, 0x22, 0x15, 0x89, 0x48, 0x47, 0x3A, 0x0C, 0x62, 0xD3, 0xC1, 0x9C, 0x0E,
+    0xA9, 0x64, 0x6F, 0xEE, 0x7C, 0x39, 0xB5, 0xD5, 0x40, 0xF2, 0x46, 0x03, 0xC9, 0xBB, 0xED, 0xCF,
+    0x0F, 0xB6, 0x7B, 0xED, 0xCC, 0x9E, 0x4A, 0x79, 0xC9, 0x6C, 0x14, 0x06, 0x03, 0x9B, 0x9B, 0x1B,
+    0x60, 0x36, 0xC3, 0x1D, 0x89, 0xDB, 0x40, 0x2A, 0x0D, 0x18, 0xE9, 0x88, 0x44, 0x84, 0xA4, 0x97,
+    0x7A, 0x21, 0x71, 0x21, 0xCB, 0xD2, 0x4B, 0x17, 0x3E, 0xF6, 0x77, 0x7A, 0xFB, 0x85, 0xBE, 0x53,
+    0xBA, 0xED, 0x3B, 0xB1, 0xB4, 0x34, 0x1E, 0x1B, 0x03, 0x89, 0xFF, 0xCC, 0xD7, 0xF9, 0xB5, 0xE8,
+    0xEB, 0x2A, 0x70, 0x60, 0xD7, 0x3F, 0xD5, 0x7D, 0xDA, 0x81, 0x96, 0xB9, 0x38, 0x66, 0x6C, 0xD0,
+    0x53, 0x56, 0x59, 0x20, 0x2B, 0x54, 0xFB, 0xDD, 0x4E, 0xFA, 0x5C, 0xD8, 0x64, 0xE7, 0x79, 0xB8,
+    0xFF, 0xF9, 0x9B, 0x77, 0x9F, 0x13, 0xD7, 0x2E, 0x96, 0x9E, 0x67, 0x96, 0xEF, 0x7F, 0xBF, 0x29,
+    0x0F, 0xEA, 0xC2, 0xAC, 0xB6, 0x59, 0xDB, 0xE9, 0x6E, 0x9C, 0x88, 0x5E, 0x95, 0xF9, 0x8D, 0xDB,
+    0x2E, 0xF4, 0xC1, 0xAC, 0x94, 0x5A, 0xB2, 0xB9, 0x9C, 0xF2, 0xF5, 0x95, 0x3E, 0x77, 0xF5, 0x53,
+    0x3E, 0x6F, 0xA1, 0x28, 0x45, 0x49, 0xFF, 0x2B, 0xC2, 0x2A, 0xE9, 0x25, 0x1B, 0x7F, 0xE0, 0x08,
+    0xE1, 0xFF, 0x07, 0xC8, 0x4B, 0x2F, 0x2D, 0xB4, 0xD3, 0xA2, 0xB1, 0xD3, 0x73, 0x5B, 0x6B, 0x15,
+    0x46, 0xC6, 0x7D, 0x7C, 0x7B, 0x7E, 0xED, 0x3B, 0x3A, 0x4C, 0xCC, 0x15, 0x27, 0xC9, 0x96, 0xCB,
+    0x0A, 0x60, 0x7D, 0x1D, 0xF5, 0xA1, 0xBB, 0x77, 0xEF, 0x44, 0xF5, 0x1A, 0xB9, 0xB4, 0x6A, 0x38,
+    0xDE, 0x66, 0x56, 0x37, 0x81, 0x6C, 0xEE, 0x30, 0xBA, 0x22, 0xAC, 0xA0, 0x5C, 0x40, 0xCF, 0xFB,
+    0x48, 0xB4, 0x48, 0xC8, 0x44, 0x9A, 0x5C, 0x06, 0x1E, 0x96, 0x35, 0x80, 0x83, 0x07, 0x09, 0x41,
+    0x7D, 0x78, 0x1F, 0x06, 0x99, 0x37, 0x89, 0xB4, 0xE3, 0xE4, 0x8A, 0xD3, 0xA7, 0xAC, 0xD1, 0xFF,
+    0xBB, 0x33, 0xD2, 0x94, 0x03, 0x79, 0xC3, 0xE7, 0x40, 0x3A, 0x44, 0xAC, 0x24, 0xBE, 0xA4, 0xCC,
+    0x2A, 0x7D, 0x49, 0xE4, 0x03, 0x91, 0x50, 0x63, 0xB2, 0x77, 0xEA, 0xB9, 0x48, 0x5B, 0xDE, 0x01,
+    0x4C, 0xE2, 0x3E, 0x92, 0x6E, 0x9C, 0xBC, 0xF1, 0xD3, 0xCD, 0x52, 0x3E, 0x79, 0x67, 0xD3, 0xC8,
+    0x15, 0xE9, 0x16, 0x18, 0x09, 0x5D, 0xC7, 0x78, 0x4C, 0x76, 0xCD, 0x02, 0xEC, 0x2E, 0x30, 0x03,
+    0x46, 0x9C, 0x39, 0xDF, 0x67, 0x36, 0xBB, 0xD8, 0xAA, 0x0F, 0x44, 0x42, 0x2D, 0x92, 0x5B, 0x7D,
+    0xF1, 0xE6, 0x71, 0x27, 0xD2, 0x65, 0x12, 0x62, 0xE9, 0x79, 0xB8, 0x43, 0x1F, 0x2B, 0xBA, 0x6E,
+    0x87, 0x3B, 0xF3, 0x26, 0x93, 0xD5, 0x76, 0xBA, 0xF2, 0xCF, 0xDF, 0x15, 0x59, 0xF9, 0xF2, 0x5B,
+    0xD2, 0x67, 0x52, 0xE5, 0x0D, 0xDE, 0x33, 0x1E, 0xDF, 0xC3, 0xC2, 0xDB, 0x02, 0x64, 0x28, 0x94,
+    0x74, 0xCA, 0xE7, 0x27, 0x5D, 0xE4, 0x9F, 0x66, 0xBC, 0x60, 0x6B, 0x07, 0x01, 0x8C, 0xA9, 0xCA,
+    0xD3, 0x22, 0x57, 0x44, 0x9C, 0x11, 0x1F, 0xC9, 0x36, 0x7B, 0xE4, 0x79, 0x7A, 0x69, 0xFE, 0xA1,
+    0x83, 0xAC, 0xDF, 0xAD, 0x1A, 0x26, 0x64, 0x4A, 0x1A, 0x6E, 0x14, 0xB3, 0x3A, 0xA4, 0x1D, 0x80,
+    0x91, 0xC3, 0x22, 0xD1, 0xCF, 0x6D, 0x34, 0x1F, 0xD2, 0xF3, 0xFE, 0xEF, 0x42, 0x5E, 0x77, 0x3D,
+    0xBF, 0x66, 0xE4, 0xFC, 0x99, 0xEF, 0xDD, 0xBF, 0x4B, 0x7F, 0x45, 0x24, 0x2E, 0xB9, 0x68, 0xB3,
+    0x8C, 0x8D, 0x3B, 0x40, 0xEC, 0xAE, 0x62, 0x57, 0x56, 0x4C, 0x4D, 0xEC, 0x56, 0x74, 0x15, 0x96,
+    0xA2, 0x9B, 0x4E, 0x49, 0x95, 0xF4, 0x68, 0x47, 0x66, 0x99, 0xA2, 0x9C, 0x92, 0x4A, 0x87, 0x85,
+    0x56, 0x47, 0x1F, 0x2B, 0xA6, 0xD3, 0x7B, 0xF5, 0xCE, 0xAF, 0x0E, 0x00, 0xCE, 0x22, 0xAF, 0x6D,
+    0x7E, 0xB8, 0x53, 0xFE, 0xDE, 0x6D, 0xBE, 0x1C, 0x15, 0x49, 0x93, 0x15, 0xDA, 0xCE, 0xC8, 0x56,
+    0x5B, 0x8C, 0x2E, 0x58, 0x99, 0x80, 0xB4, 0x44, 0x52, 0xA0, 0xC2, 0x02, 0xE1, 0xCE, 0x0A, 0x08,
+    0x20, 0x2D, 0x4A, 0x16, 0xE6, 0x46, 0xEC, 0x92, 0xD6, 0xB0, 0x92, 0xB8, 0xB4, 0xF9, 0x39, 0x61,
+    0xA4, 0x8B, 0x31, 0x39, 0x9E, 0x71, 0x62, 0xD9, 0x18, 0x43, 0xF0, 0xC4, 0x62, 0x51, 0x03, 0xA4,
+    0x1E, 0xB4, 0x05, 0x03, 0xF1, 0xA2, 0x36, 0xED, 0x17, 0x50, 0x3D, 0xA4, 0x97, 0xE6, 0x1F, 0xBA,
+    0x10, 0x60, 0xDB, 0x77, 0x78, 0x3D, 0xFD, 0x81, 0x7A, 0xFF, 0xC5, 0x9B, 0x22, 0xE6, 0xF6, 0xF9,
+    0x7F, 0xEF, 0xB6, 0x3D, 0x42, 0x98, 0x4C, 0x66, 0xB3, 0xBE, 0x87, 0x27, 0x0E, 0x3D, 0x71, 0xE8,
+    0x0B, 0x87, 0x9E, 0x58, 0x37, 0xDD, 0x9E, 0xAF, 0x71, 0x88, 0x43, 0x3B, 0xD0, 0xD5, 0xDF, 0x02,
+    0xCE, 0xEE, 0x64, 0x2D, 0x67, 0x61, 0x04, 0xAF, 0x63, 0xC2, 0xCA, 0xF7, 0x4F, 0x70, 0x82, 0xC9,
+    0x76, 0x5C, 0xE1, 0x81, 0x6D, 0x0F, 0x8B, 0xF1, 0x78, 0x21, 0xD3, 0x7F, 0x8E, 0xA7, 0xEE, 0x04,
+    0x03, 0xA4, 0xF3, 0x8A, 0xD8, 0x39, 0x98, 0x8D, 0x20, 0xD7, 0x90, 0xCE, 0x2D, 0xB1, 0x13, 0xCF,
+    0xCC, 0x48, 0x91, 0x1F, 0x53, 0x2E, 0xDD, 0xB2, 0xB3, 0xD8, 0x7F, 0x54, 0xB3, 0x69, 0xA4, 0x30,
+    0xA7, 0xA5, 0xD0, 0x2D, 0x10, 0xDD, 0x70, 0x4C, 0xA7, 0xE4, 0xC7, 0xEF, 0x3D, 0xFC, 0xE0, 0x31,
+    0xD0, 0x8F, 0xA0, 0x2E, 0xC2, 0x0D, 0xCB, 0xE8, 0x9B, 0x85, 0xCE, 0x82, 0xBA, 0xF8, 0x54, 0xF5,
+    0x51, 0xD3, 0x2E, 0x95, 0x9D, 0xFE, 0x4A, 0xA7, 0x9A, 0xAC, 0x4A, 0xAD, 0xB6, 0xBA, 0x52, 0xCE,
+    0x10, 0xFB, 0x0D, 0xE8, 0x03, 0x94, 0x6E, 0x81, 0x35, 0xE6, 0x0D, 0x18, 0x07, 0x12, 0x88, 0x87,
+    0x81, 0xC4, 0xCB, 0x73, 0xDA, 0x99, 0x60, 0x6C, 0xDE, 0x2F, 0xFC, 0x20, 0xD8, 0x17, 0x37, 0xFA,
+    0x68, 0xA5, 0xAE, 0x11, 0xF7, 0x10, 0x88, 0x7A, 0x94, 0xA0, 0x4F, 0x37, 0x79, 0x12, 0x88, 0x17,
+    0x70, 0xDC, 0x75, 0x71, 0xDB, 0x89, 0x5C, 0x17, 0x71, 0xB0, 0xC0, 0xE4, 0xC4, 0x88, 0xC8, 0x8D,
+    0x67, 0x9E, 0x79, 0xE6, 0x19, 0x58, 0x3F, 0x70, 0x6E, 0xE9, 0xDC, 0xD2, 0xB9, 0xD1, 0x22, 0xFA,
+    0x91, 0x1F, 0xB9, 0x7B, 0xA2, 0x11, 0xF1, 0x72, 0xD7, 0xCC, 0xD8, 0x29, 0x3E, 0xBE, 0x1A, 0xCC,
+    0xAA, 0x2F, 0x75, 0x7B, 0x26, 0x75, 0xA5, 0xF2, 0xE6, 0x64, 0xB8, 0x5B, 0xF3, 0xF9, 0x3F, 0x08,
+    0xE6, 0x94, 0xEB, 0xF5, 0xD5, 0xCE, 0x9C, 0x72, 0xB5, 0x6E, 0x28, 0xD0, 0xE0, 0xC8, 0x88, 0x16,
+    0x89, 0x92, 0x50, 0xCB, 0x7F, 0xCF, 0x9F, 0xDE, 0x2E, 0x92, 0x13, 0xDF, 0x4D, 0x5A, 0x0E, 0x42,
+    0xCB, 0x6E, 0xD8, 0x0B, 0xB0, 0xB6, 0x68, 0xAB, 0x17, 0x6D, 0xE3, 0x8F, 0x8E, 0x4A, 0xA8, 0xA5,
+    0xB9, 0xA7, 0xAB, 0xAE, 0x16, 0x9B, 0x17, 0x3B, 0x1D, 0x3C, 0x00, 0xCF, 0x11, 0x6F, 0xBF, 0x26,
+    0x46, 0x9C, 0x12, 0xA1, 0x14, 0x9F, 0x8A, 0x14, 0x0B, 0xD8, 0xBA, 0x5A, 0x08, 0xDB, 0x0B, 0x0B,
+    0x9B, 0x68, 0x4B, 0xA4, 0x7F, 0xFC, 0xCC, 0x99, 0x35, 0x54, 0x55, 0x9E, 0xEA, 0xCB, 0x23, 0x05,
+    0x3C, 0x36, 0xDD, 0xAC, 0x1F, 0x9B, 0x6E, 0xD6, 0xDF, 0x6C, 0x77, 0xB1, 0x7F, 0xF7, 0xF2, 0xBE,
+    0xF8, 0xFB, 0x9A, 0x3F, 0x49, 0xAB, 0x7D, 0xA7, 0xAC, 0x9A, 0x37, 0x44, 0x0E, 0x3C, 0xCC, 0x60,
+    0x02, 0xE3, 0xC7, 0x5E, 0xCE, 0xF6, 0x7D, 0x49, 0xFF, 0x9B, 0x1F, 0x3D, 0x65, 0x7F, 0x72, 0x61,
+    0x0D, 0xF6, 0xBC, 0x6C, 0xEC, 0xA0, 0x5C, 0x66, 0x07, 0xF6, 0x7C, 0xF7, 0x55, 0x7D, 0xA3, 0xD7,
+    0x6F, 0x06, 0x7D, 0xA1, 0xCB, 0xE6, 0xDE, 0x9C, 0x72, 0x80, 0xBA, 0x70, 0xE5, 0xAA, 0xF3, 0x9D,
+    0x5F, 0x9F, 0xBD, 0x70, 0x68, 0xB4, 0xE0, 0x29, 0xD5, 0x4C, 0x52, 0x80, 0x13, 0x6E, 0xD2, 0x1D,
+    0x1C, 0xE9, 0x47, 0x01, 0xD8, 0xB7, 0x4F, 0x27, 0x17, 0xB7, 0xDA, 0xF5, 0xD9, 0x48, 0xA7, 0x49,
+    0x01, 0x70, 0x8E, 0xAC, 0x49, 0xAF, 0x3F, 0xF9, 0xCA, 0xAB, 0xF0, 0x1B, 0xA3, 0xF1, 0xD4, 0x24,
+    0xED, 0x4A, 0x52, 0x2D, 0x13, 0x73, 0x28, 0x76, 0x69, 0x63, 0xF4, 0x55, 0x7F, 0x20, 0x2A, 0xE0,
+    0x15, 0x40, 0x57, 0x10, 0x05, 0xA2, 0x3E, 0x9F, 0xFB, 0xD4, 0x31, 0x60, 0xAC, 0xB1, 0x0C, 0xA9,
+    0x23, 0xB9, 0xD5, 0x33, 0xCE, 0xE5, 0xD4, 0x1B, 0xAD, 0xB8, 0x8D, 0x32, 0xED, 0xD3, 0x9F, 0x7E,
+    0x57, 0xDC, 0xAB, 0x94, 0x62, 0xC9, 0x6E, 0x0B, 0x4A, 0x74, 0x40, 0x6C, 0xE9, 0x8C, 0x8B, 0x64,
+    0xA1, 0xC1, 0x54, 0x0B, 0xAC, 0xB0, 0x7D, 0x1A, 0xF6, 0x3C, 0xC0, 0x9A, 0xC6, 0xEB, 0xC2, 0xEB,
+    0xC2, 0x67, 0x91, 0xCB, 0x22, 0xA7, 0xB6, 0x75, 0xB1, 0x37, 0xAB, 0x5D, 0xF9, 0x3F, 0xBE, 0x0F,
+    0x50, 0xA1, 0x0A, 0x34, 0x4C, 0xC8, 0xFA, 0x58, 0xFA, 0xF4, 0x78, 0x60, 0xC3, 0xC7, 0x1F, 0x36,
+    0xE9, 0xE5, 0xC2, 0x4C, 0x10, 0xA7, 0x04, 0xED, 0x30, 0x05, 0x3D, 0xAA, 0xBD, 0xE3, 0xDF, 0x2A,
+    0x47, 0x66, 0x29, 0x89, 0x7B, 0xB4, 0xC7, 0xB4, 0x8B, 0xDD, 0x0B, 0xFA, 0xC8, 0x5C, 0x5C, 0xDE,
+    0x02, 0xEC, 0x85, 0x7F, 0xB4, 0x8C, 0xF1, 0x28, 0x4F, 0x2C, 0x15, 0xFF, 0x71, 0x8D, 0x7F, 0xF0,
+    0xAD, 0xBD, 0x3F, 0x13, 0x9F, 0x6F, 0x75, 0xA9, 0xC8, 0xEA, 0xEF, 0xFF, 0x13, 0x3E, 0xBD, 0x58,
+    0x2D, 0x65, 0x59, 0x22, 0x72, 0x68, 0x58, 0x27, 0xB1, 0x8C, 0x89, 0x1D, 0xBA, 0x60, 0x46, 0xD2,
+    0x2C, 0x0A, 0x77, 0xC3, 0x66, 0x91, 0x76, 0xB1, 0x74, 0x99, 0xD8, 0x9B, 0xD9, 0xE9, 0x2B, 0xE1,
+    0xC1, 0xD8, 0x55, 0x19, 0x4C, 0x50, 0x0D, 0x19, 0x78, 0x12, 0xCB, 0x12, 0xAA, 0xC5, 0xF0, 0xB0,
+    0xA3, 0x2E, 0xB4, 0xA7, 0x2E, 0x94, 0x5B, 0x40, 0x92, 0xBA, 0x59, 0x20, 0xF4, 0x9F, 0x83, 0xB5,
+    0xFB, 0x99, 0x3F, 0x5E, 0x23, 0x2B, 0xE8, 0x48, 0x5B, 0x4A, 0x54, 0x47, 0x66, 0x77, 0xB4, 0x38,
+    0xBF, 0x91, 0x89, 0x55, 0xAB, 0x7E, 0x85, 0xD1, 0x83, 0x91, 0x4B, 0x2C, 0xBA, 0x98, 0x80, 0x4F,
+    0x2D, 0x19, 0x33, 0x94, 0x4B, 0x6D, 0xDC, 0x13, 0x90, 0x42, 0x5B, 0xDD, 0x10, 0x08, 0xC4, 0x95,
+    0xB6, 0xC0, 0x7D, 0x9A, 0x73, 0x4F, 0x41, 0xA0, 0x23, 0xB3, 0x99, 0x8D, 0xFB, 0x38, 0x60, 0x1A,
+    0x88, 0x5F, 0x05, 0x58, 0x2E, 0xAB, 0xA4, 0x96, 0xA2, 0xBE, 0x12, 0xD2, 0x97, 0x55, 0xB3, 0xCE,
+    0x58, 0x57, 0xAA, 0xED, 0x58, 0xD2, 0x55, 0x6A, 0x7D, 0xD2, 0xE9, 0x27, 0x07, 0x7C, 0x5E, 0xA9,
+    0x27, 0x3D, 0x98, 0x82, 0x78, 0x47, 0x68, 0xC5, 0xDD, 0xE3, 0xE4, 0x73, 0xA7, 0x82, 0xC1, 0x5C,
+    0x74, 0xF1, 0xF7, 0xB7, 0xAB, 0x53, 0x48, 0x2C, 0xF1, 0xE2, 0x2C, 0x75, 0x02, 0x07, 0x99, 0xE9,
+    0x22, 0x3F, 0x62, 0xF5, 0x55, 0x17, 0xBF, 0xD2, 0xC1, 0x12, 0x64, 0x90, 0x5A, 0x54, 0xCB, 0xE2,
+    0x20, 0x8D, 0x71, 0x62, 0xF5, 0x93, 0x3E, 0xB5, 0xBD, 0x72, 0x8F, 0x17, 0x1D, 0x4C, 0x21, 0x07,
+    0x6D, 0x49, 0x5A, 0x62, 0x07, 0xED, 0x82, 0xB7, 0xF7, 0x7C, 0xF6, 0x3F, 0xFF, 0x87, 0xF7, 0xFF,
+    0xC5, 0xE5, 0x37, 0x5F, 0x8E, 0x78, 0x41, 0x1F, 0x39, 0x51, 0xDA, 0x43, 0xA8, 0xEE, 0x0B, 0xCA,
+    0xC7, 0x17, 0xF6, 0x9B, 0x17, 0xD7, 0xF4, 0xBC, 0x30, 0x47, 0x9F, 0x7D, 0xE2, 0x42, 0x07, 0x24,
+    0x21, 0xB2, 0xFB, 0x95, 0x3D, 0x94, 0x14, 0xCB, 0x7B, 0x8E, 0x3C, 0xFB, 0xC5, 0xF3, 0xDD, 0x17,
+    0xE7, 0x01, 0xB2, 0x23, 0x8F, 0x3C, 0x37, 0xFF, 0xDD, 0xEC, 0xFC, 0xB3, 0xA6, 0x00, 0xD4, 0xF5,
+    0xD6, 0xC8, 0xDC, 0x4F, 0x97, 0xD4, 0x56, 0x33, 0x5E, 0x52, 0xEF, 0xB6, 0x66, 0x45, 0x7D, 0xE2,
+    0xCC, 0x1E, 0xF5, 0xEC, 0x97, 0x2E, 0xFE, 0xE0, 0x8B, 0xF3, 0x90, 0xF1, 0x69, 0x5D, 0x34, 0x4F,
+    0xFC, 0x5A, 0xF2, 0x47, 0x21, 0x7F, 0xF2, 0xEB, 0xD8, 0x91, 0x3E, 0xE2, 0x4D, 0x93, 0x17, 0x9F,
+    0x8D, 0x6C, 0x17, 0xCD, 0xC3, 0xE3, 0x45, 0x54, 0x1C, 0x7A, 0xE0, 0xE4, 0xD7, 0xCA, 0x66, 0xA4,
+    0x2C, 0xFA, 0x2D, 0xAC, 0x29, 0xFE, 0xBC, 0xFB, 0x6A, 0x3A, 0x2F, 0xCC, 0xD1, 0x3F, 0xFE, 0xC2,
+    0xD6, 0x1F, 0x67, 0xD5, 0x3D, 0xB3, 0x78, 0x2E, 0x3D, 0xF2, 0x0F, 0xBF, 0x74, 0xBE, 0x7B, 0x62,
+    0xEB, 0x4F, 0xF3, 0x6A, 0x7B, 0x16, 0x57, 0x9E, 0x35, 0x05, 0xB8, 0xD4, 0x4E, 0x54, 0x9B, 0x11,
+    0x54, 0x93, 0x31, 0x8B, 0x9D, 0xAE, 0xC6, 0x04, 0xE5, 0x52, 0x9B, 0x15, 0x63, 0x42, 0xDC, 0x29,
+    0x97, 0xB6, 0xDA, 0x7E, 0xBE, 0x58, 0x22, 0x47, 0x57, 0x89, 0x55, 0x6D, 0xEC, 0xF0, 0x74, 0xCC,
+    0x98, 0x31, 0x61, 0xC2, 0x8C, 0x19, 0x81, 0x2E, 0xF2, 0xCA, 0x29, 0x97, 0x36, 0x99, 0x35, 0xC5,
+    0xF3, 0xA0, 0xBE, 0x85, 0xFA, 0x16, 0xC9, 0xEF, 0x92, 0xEE, 0x27, 0xDB, 0xC1, 0x72, 0x87, 0x13,
+    0xF9, 0xFF, 0x79, 0xDD, 0xCC, 0x9C, 0x99, 0x38, 0x73, 0xA2, 0x35, 0x1F, 0x35, 0xE6, 0xE3, 0x1F,
+    0x1B, 0xE9, 0x33, 0xE9, 0x53, 0xE9, 0x63, 0xE9, 0xE3, 0x4B, 0xA8, 0xCB, 0xA8, 0xCB, 0x77, 0xCC,
+    0xC7, 0xFB, 0x41, 0xE0, 0x0A, 0xF3, 0xE4, 0xF7, 0xCB, 0x23, 0x7D, 0x79, 0xC4, 0x9A, 0xAD, 0xBF,
+    0xB8, 0xD3, 0x30, 0x92, 0x1E, 0x88, 0x36, 0x49, 0xA5, 0xD1, 0xD1, 0x5A, 0x2D, 0xB6, 0x16, 0x9B,
+    0x54, 0xDB, 0xC7, 0x88, 0x71, 0xCB, 0xC3, 0x2D, 0x46, 0xD6, 0x8C, 0xF8, 0xC7, 0xCF, 0xBC, 0xC2,
+    0x43, 0x8C, 0x89, 0x02, 0x9E, 0x24, 0x24, 0x0D, 0x99, 0xCF, 0x0A, 0x6A, 0x37, 0x25, 0x96, 0xAB,
+    0x3E, 0x3E, 0x2B, 0xD7, 0xDF, 0xD3, 0x22, 0xD2, 0x33, 0x8C, 0x03, 0xAA, 0x13, 0x87, 0x7E, 0x53,
+    0x2C, 0x66, 0x55, 0x40, 0xD2, 0x40, 0x12, 0xF4, 0x82, 0x0D, 0x53, 0x59, 0x23, 0x97, 0x66, 0xD7,
+    0xC6, 0x57, 0x7E, 0x5C, 0x8A, 0x74, 0xDA, 0x4E, 0x31, 0xE2, 0x11, 0xB1, 0x4A, 0x3A, 0xF4, 0xDF,
+    0x2C, 0xB4, 0x73, 0x00, 0xE5, 0x41, 0x37, 0x50, 0x16, 0x0B, 0x1D, 0xA9, 0xA4, 0x82, 0x13, 0xFB,
+    0x21, 0x79, 0xB1, 0x81, 0x13, 0x8F, 0x42, 0x72, 0xB2, 0x49, 0xDD, 0x66, 0x88, 0xDE, 0x4F, 0xA5,
+    0xDA, 0x4F, 0x1D, 0xB8, 0x99, 0xCE, 0x9B, 0xB8, 0x9B, 0x19, 0xD4, 0xB5, 0xB9, 0xCB, 0x37, 0x82,
+    0x39, 0x2A, 0x3F, 0x3A, 0xF9, 0x4A, 0xB6, 0x30, 0x25, 0x3F, 0x43, 0x5C, 0x38, 0x4E, 0x68, 0xD2,
+    0xC2, 0xF1, 0xBA, 0x4E, 0xB4, 0x16, 0x91, 0x5A, 0xC4, 0x7D, 0xB3, 0x6F, 0x13, 0xF9, 0x19, 0x46,
+    0x1A, 0xD5, 0x07, 0xCC, 0x69, 0xAB, 0x7C, 0x20, 0x4F, 0xAB, 0x87, 0x20, 0x91, 0xE6, 0xC1, 0x52,
+    0x8E, 0x5C, 0x6C, 0x26, 0xA3, 0x13, 0xF1, 0xFC, 0xE2, 0xEF, 0x1C, 0x18, 0xFD, 0xCB, 0x0F, 0xB6,
+    0x2E, 0x1E, 0x3B, 0x30, 0x7A, 0xC1, 0xA9, 0x8B, 0xC7, 0xAA, 0xD1, 0x0B, 0xF5, 0x77, 0x2E, 0x3E,
+    0x29, 0x81, 0xE8, 0xAC, 0x85, 0x96, 0xCF, 0xDF, 0x22, 0x17, 0x68, 0xD9, 0x6C, 0x95, 0xB4, 0xE9,
+    0xD1, 0x36, 0x55, 0x4D, 0x7A, 0xB4, 0x49, 0xA4, 0x89, 0xA5, 0xE5, 0xE9, 0xE2, 0xCC, 0x99, 0x35,
+    0x59, 0x18, 0xB6, 0x69, 0x4F, 0x39, 0x20, 0x7F, 0x4A, 0x20, 0x17, 0x6B, 0xC4, 0x46, 0x9E, 0xC8,
+    0x6D, 0xE7, 0x09, 0x30, 0x14, 0xD4, 0x03, 0x66, 0x20, 0xED, 0x17, 0x7F, 0x90, 0xB8, 0x83, 0xC4,
+    0x2F, 0x93, 0x77, 0xE4, 0x3D, 0xA6, 0x43, 0xF7, 0x7B, 0x31, 0x1D, 0xD9, 0x76, 0x81, 0xC8, 0x54,
+    0xE8, 0x16, 0xEA, 0x0E, 0x72, 0xB1, 0xA4, 0x17, 0xBB, 0xE8, 0xB5, 0x5B, 0xF2, 0x37, 0x04, 0xD5,
+    0xEE, 0x2A, 0xBF, 0x7C, 0xB3, 0xD0, 0xD2, 0x2F, 0x4E, 0xEC, 0x64, 0x00, 0xF3, 0xCA, 0xC2, 0x8E,
+    0x53, 0x8E, 0x05, 0xE0, 0x69, 0x0A, 0xC8, 0x1A, 0x20, 0x2A, 0x40, 0x03, 0x23, 0xC0, 0x41, 0x3D,
+    0x90, 0x49, 0x8F, 0x48, 0x97, 0x7E, 0xE4, 0x30, 0xA7, 0x2A, 0xC2, 0x3E, 0x94, 0x9B, 0x90, 0x9D,
+    0x97, 0x60, 0x12, 0xF1, 0xC3, 0xBE, 0xEC, 0x0F, 0xE4, 0x87, 0x1B, 0x4A, 0xC4, 0x27, 0x22, 0x4D,
+    0x2C, 0x7F, 0x0D, 0xE7, 0x16, 0x38, 0xE9, 0xAE, 0x9D, 0x0D, 0x79, 0x73, 0xDB, 0x79, 0x3D, 0x1C,
+    0x80, 0x8C, 0x5C, 0x44, 0xDE, 0x17, 0x91, 0xC5, 0x01, 0x84, 0x88, 0x9C, 0x15, 0x91, 0x36, 0xB0,
+    0x86, 0x79, 0xBF, 0x47, 0x89, 0x58, 0xB2, 0x1D, 0xD0, 0xA2, 0x65, 0x44, 0xD9, 0x94, 0xDD, 0xD8,
+    0x65, 0xA3, 0xE4, 0x72, 0xF4, 0x89, 0x35, 0x5D, 0x2A, 0x55, 0xD9, 0xC6, 0xCD, 0x0E, 0xA4, 0x71,
+    0xC7, 0x4D, 0x2C, 0x45, 0x2E, 0x8A, 0x84, 0x87, 0xCA, 0x6F, 0x17, 0xB1, 0x83, 0xBC, 0x20, 0x5E,
+    0x48, 0x3E, 0x75, 0xCF, 0xAD, 0x42, 0x75, 0x94, 0x72, 0x4D, 0x9C, 0x8E, 0x44, 0x4A, 0xB9, 0x16,
+    0x92, 0x3E, 0x12, 0x1B, 0x79, 0x0C, 0xDA, 0x2A, 0xCF, 0x80, 0xB2, 0xE8, 0x4F, 0x61, 0x7C, 0x2C,
+    0xD6, 0x7C, 0x84, 0x6C, 0x44, 0xB5, 0xD7, 0xC3, 0x41, 0x73, 0xDE, 0x1F, 0xAB, 0x2B, 0xE3, 0xB9,
+    0x09, 0xC0, 0x32, 0xAC, 0xC3, 0x3A, 0x4A, 0x0A, 0x2D, 0x8D, 0x96, 0x36, 0xFB, 0xAF, 0x2E, 0xFF,
+    0xA6, 0x3B, 0x78, 0xC2, 0xED, 0x3B, 0xE1, 0xF6, 0x4D, 0x5C, 0xB6, 0xE4, 0xB2, 0x25, 0x97, 0x4D,
+    0x17, 0x1B, 0xBF, 0xEE, 0x88, 0xA5, 0x27, 0xB5, 0x33, 0x72, 0x3C, 0xB3, 0xA4, 0xF9, 0x75, 0x91,
+    0xC3, 0x22, 0x21, 0x11, 0xA9, 0xB2, 0x61, 0x0D, 0xE5, 0xD0, 0x22, 0x85, 0x91, 0x1E, 0x7A, 0x48,
+    0x3C, 0xF0, 0x85, 0xBB, 0xB0, 0xBA, 0x91, 0xBE, 0x94, 0x3E, 0xAB, 0x48, 0x2D, 0xF1, 0xC2, 0x30,
+    0xD9, 0x0B, 0x9F, 0x06, 0x6D, 0xC9, 0x7A, 0x32, 0x69, 0xF2, 0x3F, 0xDB, 0xD4, 0x4F, 0xBD, 0x54,
+    0x3C, 0xD9, 0xC2, 0x3A, 0x1C, 0x84, 0xB4, 0x22, 0xDE, 0xD9, 0xFC, 0x64, 0x05, 0x49, 0x43, 0xE4,
+    0x8D, 0xF4, 0x46, 0x06, 0xA2, 0x6E, 0xDB, 0xA4, 0xD6, 0x3B, 0x07, 0xDD, 0xDB, 0xBF, 0x5E, 0x87,
+    0x83, 0xE8, 0xA7, 0x4E, 0x3D, 0x79, 0xEB, 0xFD, 0x36, 0x97, 0x26, 0x92, 0x86, 0xAC, 0x81, 0x85,
+    0x46, 0x2B, 0x96, 0x19, 0x69, 0x74, 0x31, 0x89, 0xDB, 0xC8, 0xD5, 0x22, 0xA7, 0x44, 0xBA, 0x7D,
+    0x1C, 0xE4, 0x44, 0x5A, 0x45, 0xD5, 0x73, 0xB0, 0x86, 0x29, 0xF4, 0x90, 0xFC, 0xAC, 0x3B, 0xF7,
+    0x13, 0xFB, 0x00, 0xB4, 0x3C, 0xC0, 0xEF, 0xFD, 0xE4, 0xD4, 0x5F, 0xCD, 0x32, 0xC1, 0x54, 0x2C,
+    0xE6, 0xB2, 0xFB, 0xAC, 0xAB, 0x25, 0xBD, 0x49, 0x6D, 0x75, 0x89, 0x0F, 0x5A, 0x39, 0xA7, 0x2D,
+    0x5F, 0xF8, 0xBF, 0x7D, 0x93, 0xBD, 0x6F, 0x1D, 0x55, 0x10, 0xC5, 0x7F, 0x77, 0xD7, 0xE1, 0x0A,
+    0x6D, 0x71, 0x8D, 0x14, 0x24, 0x48, 0x24, 0x2E, 0x2D, 0x85, 0xBD, 0xFF, 0xC0, 0x7B, 0xEF, 0xAE,
+    0xE5, 0x22, 0x05, 0x05, 0x2E, 0x80, 0x02, 0x5A, 0x90, 0x22, 0x14, 0xCB, 0x54, 0xAE, 0xE2, 0xEC,
+    0x3A, 0xFC, 0x01, 0x71, 0x91, 0x16, 0xD1, 0xA4, 0x08, 0x0F, 0x89, 0x0F, 0x09, 0x84, 0x8B, 0x98,
+    0x77, 0xE3, 0x57, 0x50, 0x50, 0xB0, 0xC4, 0xA1, 0xA2, 0xC8, 0xE6, 0x83, 0xC6, 0x2E, 0x72, 0x09,
+    0x8B, 0x73, 0x1D, 0xED, 0xBE, 0xA1, 0x78, 0x09, 0x20, 0x8A, 0x8C, 0x46, 0x3A, 0xC5, 0xCC, 0x39,
+    0x1A, 0xCD, 0x99, 0x01, 0x25, 0xD7, 0xAD, 0xD4, 0x2F, 0xF4, 0x94, 0xB5, 0xFD, 0x52, 0xDF, 0xBB,
+    0x1B, 0x5F, 0x1B, 0xA9, 0xBB, 0x15, 0xAF, 0x90, 0x36, 0x2F, 0xDA, 0xCB, 0xCD, 0xDE, 0x52, 0xF2,
+    0xB8, 0x36, 0x1D, 0x6E, 0x5F, 0xBA, 0x5C, 0x2A, 0x80, 0xCB, 0xD5, 0x68, 0x60, 0xA6, 0xD3, 0xB0,
+    0xB4, 0x97, 0x48, 0x61, 0x1B, 0x25, 0x9D, 0x11, 0x0F, 0x00, 0x1F, 0xC3, 0x08, 0x72, 0xC8, 0x0F,
+    0xC7, 0xB9, 0xC8, 0x1D, 0x0F, 0x22, 0xBD, 0x3D, 0x1C, 0xAB, 0x08, 0x4B, 0xA0, 0x80, 0x97, 0x40,
+    0x5F, 0x40, 0x1D, 0x07, 0xCA, 0x0D, 0x6F, 0x8F, 0x45, 0x3F, 0x5E, 0xEF, 0x6E, 0x6C, 0x1E, 0xDC,
+    0xD2, 0xEB, 0x0B, 0x6C, 0xD6, 0xE8, 0x75, 0xFE, 0x03, 0x6A, 0x61, 0x2E, 0xDC, 0xC0, 0x16, 0x64,
+    0x7E, 0x3C, 0xEE, 0x9C, 0x88, 0x27, 0xF9, 0x53, 0xA4, 0x1D, 0x7F, 0x11, 0x21, 0xC2, 0x00, 0x16,
+    0x60, 0xB1, 0xF8, 0x1F, 0x57, 0xAF, 0xF3, 0xFA, 0x66, 0xFD, 0xE6, 0x8F, 0xEB, 0xC3, 0x72, 0xF3,
+    0xCE, 0x4D, 0xD9, 0x08, 0xFA, 0xB8, 0xC3, 0x6E, 0xC0, 0xA6, 0x47, 0x2D, 0x02, 0xA0, 0x69, 0x18,
+    0xE9, 0x3A, 0x09, 0x99, 0xCF, 0x0F, 0xBF, 0xDA, 0x17, 0x91, 0x9F, 0x3D, 0xB9, 0x11, 0x69, 0xED,
+    0xE1, 0xA4, 0xB2, 0xDB, 0x91, 0xA5, 0xD4, 0xB3, 0xB8, 0x00, 0x90, 0xD6, 0xB8, 0x5A, 0x4B, 0x33,
+    0xD9, 0x78, 0xDC, 0x7F, 0x7F, 0x77, 0xF3, 0x26, 0xBF, 0x91, 0x5E, 0xE0, 0xD3, 0x6F, 0xAE, 0x1C,
+    0x3F, 0xFC, 0xEC, 0xA8, 0x33, 0x52, 0x64, 0x81, 0x6C, 0x3E, 0xAD, 0x2D, 0x10, 0x18, 0xC1, 0x2E,
+    0x49, 0x43, 0x56, 0xC8, 0xBA, 0x91, 0xB6, 0xCF, 0xA7, 0x8D, 0x33, 0xC5, 0xAE, 0x3B, 0x57, 0x4F,
+    0x04, 0x69, 0x99, 0x14, 0xF3, 0xEE, 0x8D, 0x07, 0x03, 0x72, 0x79, 0xE8, 0xCD, 0x49, 0xD9, 0xA8,
+    0x4E, 0xF5, 0x38, 0xCA, 0x90, 0x86, 0xBC, 0x64, 0x94, 0x1D, 0x04, 0x7D, 0x3F, 0x38, 0x5C, 0x97,
+    0x86, 0x54, 0x56, 0x04, 0x27, 0x12, 0xB4, 0x48, 0xAF, 0x44, 0xA4, 0x1A, 0x65, 0xB2, 0x43, 0x01,
+    0x70, 0x0A, 0x54, 0x07, 0xAE, 0x46, 0x0B, 0xCC, 0x5A, 0xEC, 0x15, 0x9F, 0x86, 0x3D, 0x2E, 0xE9,
+    0x60, 0x6A, 0xB7, 0xD2, 0x25, 0x9D, 0x2B, 0xCC, 0x54, 0xA4, 0x77, 0x22, 0xB7, 0xC6, 0xE3, 0xCF,
+    0x01, 0x27, 0xBD, 0x93, 0x3E, 0xDB, 0x0F, 0xCF, 0xC9, 0x53, 0x2B, 0x6B, 0xA7, 0x56, 0xD6, 0x9E,
+    0xDF, 0x33, 0xD7, 0x01, 0x20, 0x95, 0xCE, 0xC9, 0x7E, 0x8B, 0xF1, 0x38, 0x54, 0x44, 0x7B, 0x76,
+    0x19, 0x61, 0xFD, 0xBC, 0x30, 0xBE, 0x7E, 0x66, 0x32, 0x95, 0xEE, 0xE5, 0x77, 0x20, 0x19, 0xEF,
+    0xE0, 0x3A, 0xF4, 0x6D, 0x88, 0x60, 0x0A, 0x54, 0x00, 0x07, 0xE9, 0xDC, 0x67, 0xE3, 0xF9, 0xBA,
+    0x43, 0x4B, 0x85, 0x6B, 0x51, 0x02, 0x26, 0x00, 0x6B, 0x0B, 0xE4, 0x7F, 0x49, 0x22, 0x32, 0x33,
+    0xDB, 0x71, 0x30, 0x48, 0xFC, 0xB7, 0xAD, 0x59, 0x3D, 0x10, 0x11, 0x2D, 0x12, 0x75, 0x2C, 0x3D,
+    0x9C, 0x06, 0xEC, 0x0E, 0xBA, 0x87, 0xB8, 0xF8, 0x4C, 0x37, 0x87, 0xA4, 0x81, 0x11, 0xA4, 0x35,
+    0x0C, 0x41, 0x7B, 0xB8, 0x08, 0x99, 0xE7, 0xC3, 0x88, 0x93, 0x22, 0x91, 0x80, 0x8E, 0x73, 0x33,
+    0xB2, 0x69, 0x3B, 0x73, 0x15, 0x90, 0x9B, 0x83, 0x38, 0x83, 0x24, 0xBE, 0x51, 0x3E, 0x3A, 0xFA,
+    0xA9, 0x3F, 0x7D, 0x66, 0xE5, 0xDA, 0xE9, 0xF2, 0xFE, 0xD1, 0x9D, 0xAD, 0xF3, 0xA5, 0x57, 0xD7,
+    0xE6, 0xD7, 0x53, 0x90, 0x7A, 0x92, 0x1A, 0x1A, 0x90, 0x55, 0x91, 0x47, 0xD2, 0xC3, 0x08, 0x23,
+    0x72, 0x4E, 0x24, 0x98, 0x1A, 0xED, 0x49, 0x1B, 0x92, 0xC0, 0xD3, 0x58, 0x82, 0xAC, 0x45, 0x4B,
+    0xA5, 0xA4, 0xA6, 0x6C, 0x49, 0xA4, 0xC0, 0xC8, 0x09, 0x4A, 0xA4, 0xE2, 0xAC, 0x80, 0xBA, 0x91,
+    0xCE, 0xAE, 0x62, 0x44, 0x6A, 0xF5, 0xD1, 0xB3, 0xA7, 0x82, 0x65, 0x60, 0xB2, 0x03, 0x93, 0x16,
+    0xEC, 0x0C, 0x12, 0x29, 0xD8, 0xE8, 0xD5, 0x44, 0x1E, 0x18, 0xD9, 0xC1, 0x55, 0x50, 0xBC, 0xB7,
+    0xAB, 0x45, 0x82, 0x7B, 0xF2, 0xF6, 0x33, 0x0E, 0x6E, 0x7B, 0x96, 0x45, 0xD7, 0xB4, 0xA9, 0x37,
+    0x0C, 0xB4, 0xC8, 0xAC, 0x14, 0xB9, 0x77, 0xF2, 0xFE, 0xEF, 0xA6, 0xD8, 0x52, 0x51, 0xD7, 0xB6,
+    0xFA, 0x17, 0xB2, 0x06, 0xCE, 0xC3, 0x5E, 0x1A, 0xFB, 0x2C, 0xCE, 0x4C, 0x81, 0x81, 0xB2, 0x1B,
+    0x94, 0xDD, 0x20, 0xBF, 0x7A, 0xD1, 0x14, 0x17, 0x6D, 0xF5, 0x4F, 0x6E, 0xD9, 0x6A, 0x0F, 0x5E,
+    0xC5, 0x5D, 0x0E, 0x59, 0x5C, 0xA6, 0x4D, 0x1A, 0xC3, 0x48, 0xCB, 0xB4, 0x2E, 0xBB, 0x61, 0x72,
+    0xB2, 0x5A, 0x9B, 0x62, 0xA8, 0x62, 0x5A, 0xDB, 0x6A, 0xA8, 0x62, 0x7A, 0xDB, 0x56, 0xEE, 0x97,
+    0x98, 0xCE, 0x00, 0xAE, 0x01, 0xBA, 0xC9, 0xFD, 0x24, 0xDF, 0x16, 0xDD, 0x4D, 0xB2, 0x6A, 0x04,
+    0xCB, 0xB4, 0xA4, 0x22, 0x62, 0x8C, 0x48, 0x37, 0xB0, 0xBF, 0x96, 0x6B, 0xC1, 0x11, 0x53, 0xDF,
+    0xA5, 0x8D, 0x49, 0x83, 0xF1, 0x43, 0xE3, 0x1D, 0xAD, 0xA3, 0x4B, 0x9B, 0x2E, 0x0D, 0xB6, 0x02,
+    0xF8, 0x80, 0x99, 0x8E, 0xCB, 0x4C, 0x3E, 0x99, 0x99, 0x6A, 0x48, 0x48, 0x6B, 0xC3, 0x80, 0xD6,
+    0x8A, 0xC4, 0xA1, 0x16, 0x99, 0x99, 0xE2, 0x87, 0x77, 0x4F, 0x56, 0x6B, 0x53, 0x6C, 0x11, 0x74,
+    0x63, 0x8B, 0x81, 0x8A, 0xBA, 0xB6, 0x5C, 0x52, 0xAD, 0xBE, 0x6D, 0xAB, 0x2D, 0x25, 0xBA, 0xC9,
+    0xAB, 0xB2, 0x7E, 0xBA, 0xA3, 0xAC, 0x00, 0x5A, 0xC0, 0x14, 0x89, 0xBC, 0x25, 0xFE, 0xC9, 0x77,
+    0xD2, 0x19, 0x54, 0x4B, 0xB9, 0x63, 0x61, 0x72, 0x33, 0x80, 0xB3, 0x98, 0xA3, 0x3F, 0x9E, 0xAC,
+    0x4A, 0x6F, 0xBB, 0xB3, 0x33, 0xE6, 0xA6, 0xFC, 0x0D,
 };
 
 static const EpdGlyph opendyslexic_8_boldGlyphs[] = {
@@ -1147,7 +1130,7 @@ static const EpdGlyph opendyslexic_8_boldGlyphs[] = {
     { 3, 16, 7, 2, 13, 12, 3381 }, // |
     { 9, 17, 9, 0, 13, 39, 3393 }, // }
     { 7, 4, 8, 0, 12, 7, 3432 }, // ~
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
+    { 0, 0, 14, 0, 0, 0, 3439 }, //  
     { 6, 22, 12, 3, 19, 33, 0 }, // ¡
     { 9, 15, 13, 2, 12, 34, 33 }, // ¢
     { 12, 15, 12, 0, 14, 45, 67 }, // £
@@ -1158,625 +1141,631 @@ static const EpdGlyph opendyslexic_8_boldGlyphs[] = {
     { 9, 4, 9, 0, 14, 9, 236 }, // ¨
     { 8, 7, 11, 2, 16, 14, 245 }, // ©
     { 6, 6, 11, 3, 13, 9, 259 }, // ª
-    { 9, 10, 9, 0, 10, 23, 268 }, // «
-    { 10, 6, 10, 0, 6, 15, 291 }, // ¬
-    { 10, 2, 10, 0, 6, 5, 306 }, // ­
-    { 8, 7, 11, 2, 18, 14, 311 }, // ®
-    { 8, 3, 9, 0, 13, 6, 325 }, // ¯
-    { 8, 8, 11, 2, 13, 16, 331 }, // °
-    { 10, 11, 10, 0, 9, 28, 347 }, // ±
-    { 5, 7, 5, 0, 14, 9, 375 }, // ²
-    { 5, 7, 6, 0, 14, 9, 384 }, // ³
-    { 5, 4, 5, 0, 13, 5, 393 }, // ´
-    { 11, 11, 14, 1, 9, 31, 398 }, // µ
-    { 10, 15, 13, 1, 12, 38, 429 }, // ¶
-    { 4, 4, 4, 0, 8, 4, 467 }, // ·
-    { 5, 6, 5, 0, 1, 8, 471 }, // ¸
-    { 5, 7, 5, 0, 14, 9, 479 }, // ¹
-    { 6, 6, 11, 3, 13, 9, 488 }, // º
-    { 10, 10, 12, 1, 10, 25, 497 }, // »
-    { 16, 16, 21, 2, 14, 64, 522 }, // ¼
-    { 18, 17, 21, 2, 15, 77, 586 }, // ½
-    { 16, 15, 21, 2, 13, 60, 663 }, // ¾
-    { 11, 21, 11, 0, 12, 58, 723 }, // ¿
-    { 14, 19, 16, 1, 19, 67, 781 }, // À
-    { 14, 22, 16, 1, 22, 77, 848 }, // Á
-    { 14, 20, 16, 1, 20, 70, 925 }, // Â
-    { 14, 19, 16, 1, 19, 67, 995 }, // Ã
-    { 14, 20, 16, 1, 20, 70, 1062 }, // Ä
-    { 14, 20, 16, 1, 20, 70, 1132 }, // Å
-    { 21, 15, 23, 1, 14, 79, 1202 }, // Æ
-    { 12, 19, 17, 2, 15, 57, 1281 }, // Ç
-    { 11, 19, 15, 2, 19, 53, 1338 }, // È
-    { 11, 22, 15, 2, 22, 61, 1391 }, // É
-    { 11, 21, 15, 2, 21, 58, 1452 }, // Ê
-    { 11, 20, 15, 2, 20, 55, 1510 }, // Ë
-    { 8, 20, 9, 0, 20, 40, 1565 }, // Ì
-    { 5, 23, 9, 2, 23, 29, 1605 }, // Í
-    { 10, 21, 9, 0, 21, 53, 1634 }, // Î
-    { 9, 21, 9, 0, 21, 48, 1687 }, // Ï
-    { 16, 14, 18, -1, 14, 56, 1735 }, // Ð
-    { 13, 19, 17, 2, 19, 62, 1791 }, // Ñ
-    { 15, 20, 19, 2, 19, 75, 1853 }, // Ò
-    { 15, 23, 19, 2, 22, 87, 1928 }, // Ó
-    { 15, 21, 19, 2, 20, 79, 2015 }, // Ô
-    { 15, 20, 19, 2, 19, 75, 2094 }, // Õ
-    { 15, 21, 19, 2, 20, 79, 2169 }, // Ö
-    { 10, 6, 10, 0, 7, 15, 2248 }, // ×
-    { 25, 33, 19, -3, 24, 207, 2263 }, // Ø
-    { 13, 21, 17, 2, 20, 69, 2470 }, // Ù
-    { 13, 24, 17, 2, 23, 78, 2539 }, // Ú
-    { 13, 22, 17, 2, 21, 72, 2617 }, // Û
-    { 13, 22, 17, 2, 21, 72, 2689 }, // Ü
-    { 14, 24, 18, 2, 24, 84, 2761 }, // Ý
-    { 9, 14, 9, 0, 14, 32, 2845 }, // Þ
-    { 11, 13, 11, 0, 12, 36, 2877 }, // ß
-    { 10, 14, 14, 2, 14, 35, 2913 }, // à
-    { 10, 17, 14, 2, 17, 43, 2948 }, // á
-    { 10, 16, 14, 2, 16, 40, 2991 }, // â
-    { 10, 15, 14, 2, 15, 38, 3031 }, // ã
-    { 10, 15, 14, 2, 15, 38, 3069 }, // ä
-    { 10, 16, 14, 2, 16, 40, 3107 }, // å
-    { 17, 10, 21, 2, 10, 43, 3147 }, // æ
-    { 9, 14, 13, 2, 10, 32, 3190 }, // ç
-    { 10, 16, 14, 2, 16, 40, 3222 }, // è
-    { 10, 19, 14, 2, 19, 48, 3262 }, // é
-    { 10, 17, 14, 2, 17, 43, 3310 }, // ê
-    { 10, 17, 14, 2, 17, 43, 3353 }, // ë
-    { 7, 14, 8, 0, 14, 25, 3396 }, // ì
-    { 4, 17, 8, 2, 17, 17, 3421 }, // í
-    { 10, 16, 8, -1, 16, 40, 3438 }, // î
-    { 8, 15, 8, 0, 15, 30, 3478 }, // ï
-    { 14, 16, 12, -1, 15, 56, 3508 }, // ð
-    { 10, 15, 15, 2, 15, 38, 3564 }, // ñ
-    { 10, 14, 14, 2, 14, 35, 3602 }, // ò
-    { 10, 17, 14, 2, 17, 43, 3637 }, // ó
-    { 10, 15, 14, 2, 15, 38, 3680 }, // ô
-    { 10, 14, 14, 2, 14, 35, 3718 }, // õ
-    { 10, 15, 14, 2, 15, 38, 3753 }, // ö
-    { 13, 12, 15, 1, 12, 39, 3791 }, // ÷
-    { 12, 28, 14, 1, 19, 84, 3830 }, // ø
-    { 10, 14, 14, 2, 14, 35, 3914 }, // ù
-    { 10, 17, 14, 2, 17, 43, 3949 }, // ú
-    { 10, 15, 14, 2, 15, 38, 3992 }, // û
-    { 10, 15, 14, 2, 15, 38, 4030 }, // ü
-    { 11, 24, 15, 2, 19, 66, 4068 }, // ý
-    { 9, 18, 9, 0, 14, 41, 4134 }, // þ
-    { 11, 22, 15, 2, 17, 61, 4175 }, // ÿ
-    { 14, 20, 16, 1, 20, 70, 0 }, // Ā
-    { 10, 15, 14, 2, 15, 38, 70 }, // ā
-    { 14, 20, 16, 1, 20, 70, 108 }, // Ă
-    { 10, 16, 14, 2, 16, 40, 178 }, // ă
-    { 14, 19, 16, 1, 14, 67, 218 }, // Ą
-    { 11, 15, 14, 2, 10, 42, 285 }, // ą
-    { 12, 20, 17, 2, 20, 60, 327 }, // Ć
-    { 9, 14, 13, 2, 14, 32, 387 }, // ć
-    { 12, 21, 17, 2, 21, 63, 419 }, // Ĉ
-    { 10, 15, 13, 2, 15, 38, 482 }, // ĉ
-    { 12, 20, 17, 2, 20, 60, 520 }, // Ċ
-    { 9, 14, 13, 2, 14, 32, 580 }, // ċ
-    { 12, 21, 17, 2, 21, 63, 612 }, // Č
-    { 10, 15, 13, 2, 15, 38, 675 }, // č
-    { 13, 21, 18, 2, 21, 69, 713 }, // Ď
-    { 14, 14, 15, 2, 14, 49, 782 }, // ď
-    { 16, 14, 18, -1, 14, 56, 831 }, // Đ
-    { 13, 14, 15, 2, 14, 46, 887 }, // đ
-    { 11, 20, 15, 2, 20, 55, 933 }, // Ē
-    { 10, 17, 14, 2, 17, 43, 988 }, // ē
-    { 11, 21, 15, 2, 21, 58, 1031 }, // Ĕ
-    { 10, 17, 14, 2, 17, 43, 1089 }, // ĕ
-    { 11, 20, 15, 2, 20, 55, 1132 }, // Ė
-    { 10, 17, 14, 2, 17, 43, 1187 }, // ė
-    { 11, 19, 15, 2, 14, 53, 1230 }, // Ę
-    { 10, 16, 14, 2, 9, 40, 1283 }, // ę
-    { 11, 22, 15, 2, 22, 61, 1323 }, // Ě
-    { 10, 18, 14, 2, 18, 45, 1384 }, // ě
-    { 15, 23, 19, 2, 23, 87, 1429 }, // Ĝ
-    { 11, 21, 14, 2, 16, 58, 1516 }, // ĝ
-    { 15, 23, 19, 2, 23, 87, 1574 }, // Ğ
-    { 10, 21, 14, 2, 16, 53, 1661 }, // ğ
-    { 15, 22, 19, 2, 22, 83, 1714 }, // Ġ
-    { 10, 20, 14, 2, 15, 50, 1797 }, // ġ
-    { 15, 25, 19, 2, 25, 94, 1847 }, // Ģ
-    { 10, 21, 14, 2, 16, 53, 1941 }, // ģ
-    { 13, 21, 18, 2, 21, 69, 1994 }, // Ĥ
-    { 13, 20, 15, 0, 20, 65, 2063 }, // ĥ
-    { 15, 14, 18, 1, 14, 53, 2128 }, // Ħ
-    { 13, 14, 15, 0, 14, 46, 2181 }, // ħ
-    { 7, 21, 9, 1, 21, 37, 2227 }, // Ĩ
-    { 7, 16, 8, 0, 16, 28, 2264 }, // ĩ
-    { 10, 21, 9, -1, 21, 53, 2292 }, // Ī
-    { 10, 15, 8, -1, 15, 38, 2345 }, // ī
-    { 6, 19, 9, 1, 14, 29, 2383 }, // Į
-    { 6, 20, 8, 1, 15, 30, 2412 }, // į
-    { 5, 21, 9, 2, 21, 27, 2442 }, // İ
-    { 4, 10, 8, 2, 10, 10, 2469 }, // ı
-    { 14, 21, 26, 6, 14, 74, 2479 }, // Ĳ
-    { 10, 19, 8, 2, 15, 48, 2553 }, // ĳ
-    { 12, 25, 15, 2, 21, 75, 2601 }, // Ĵ
-    { 9, 22, 10, 2, 17, 50, 2676 }, // ĵ
-    { 13, 23, 18, 2, 23, 75, 2726 }, // Ķ
-    { 11, 23, 15, 2, 14, 64, 2801 }, // ķ
-    { 9, 9, 11, 1, 9, 21, 2865 }, // ĸ
-    { 11, 19, 15, 2, 19, 53, 2886 }, // Ĺ
-    { 6, 21, 10, 2, 21, 32, 2939 }, // ĺ
-    { 12, 22, 15, 1, 22, 66, 2971 }, // Ļ
-    { 7, 23, 10, 1, 14, 41, 3037 }, // ļ
-    { 11, 14, 15, 2, 14, 39, 3078 }, // Ľ
-    { 8, 17, 10, 2, 17, 34, 3117 }, // ľ
-    { 11, 14, 15, 2, 14, 39, 3151 }, // Ŀ
-    { 8, 14, 10, 2, 14, 28, 3190 }, // ŀ
-    { 19, 26, 15, -5, 20, 124, 3218 }, // Ł
-    { 13, 14, 10, -4, 14, 46, 3342 }, // ł
-    { 13, 20, 17, 2, 20, 65, 3388 }, // Ń
-    { 10, 16, 15, 2, 16, 40, 3453 }, // ń
-    { 13, 21, 17, 2, 14, 69, 3493 }, // Ņ
-    { 10, 17, 15, 2, 10, 43, 3562 }, // ņ
-    { 13, 21, 17, 2, 21, 69, 3605 }, // Ň
-    { 11, 17, 15, 2, 17, 47, 3674 }, // ň
-    { 10, 17, 15, 2, 17, 43, 3721 }, // ŉ
-    { 13, 18, 17, 2, 14, 59, 3764 }, // Ŋ
-    { 10, 14, 15, 2, 10, 35, 3823 }, // ŋ
-    { 15, 21, 19, 2, 20, 79, 3858 }, // Ō
-    { 10, 15, 14, 2, 15, 38, 3937 }, // ō
-    { 15, 21, 19, 2, 20, 79, 3975 }, // Ŏ
-    { 10, 15, 14, 2, 15, 38, 4054 }, // ŏ
-    { 16, 20, 19, 2, 19, 80, 4092 }, // Ő
-    { 15, 14, 14, 1, 14, 53, 4172 }, // ő
-    { 20, 15, 20, 2, 14, 75, 4225 }, // Œ
-    { 17, 9, 18, 2, 9, 39, 4300 }, // œ
-    { 12, 20, 16, 2, 19, 60, 4339 }, // Ŕ
-    { 8, 14, 12, 2, 14, 28, 4399 }, // ŕ
-    { 12, 24, 16, 2, 23, 72, 4427 }, // Ŗ
-    { 8, 17, 12, 2, 17, 34, 4499 }, // ŗ
-    { 12, 22, 16, 2, 21, 66, 4533 }, // Ř
-    { 9, 15, 12, 1, 15, 34, 4599 }, // ř
-    { 14, 21, 18, 2, 20, 74, 4633 }, // Ś
-    { 10, 15, 14, 2, 14, 38, 4707 }, // ś
-    { 14, 22, 18, 2, 21, 77, 4745 }, // Ŝ
-    { 10, 16, 14, 2, 15, 40, 4822 }, // ŝ
-    { 14, 19, 18, 2, 15, 67, 4862 }, // Ş
-    { 10, 14, 14, 2, 10, 35, 4929 }, // ş
-    { 14, 22, 18, 2, 21, 77, 4964 }, // Š
-    { 10, 16, 14, 2, 15, 40, 5041 }, // š
-    { 13, 19, 18, 2, 14, 62, 5081 }, // Ţ
-    { 9, 17, 13, 2, 13, 39, 5143 }, // ţ
-    { 13, 21, 18, 2, 21, 69, 5182 }, // Ť
-    { 12, 16, 13, 2, 15, 48, 5251 }, // ť
-    { 13, 14, 18, 2, 14, 46, 5299 }, // Ŧ
-    { 10, 14, 13, 1, 13, 35, 5345 }, // ŧ
-    { 13, 22, 17, 2, 21, 72, 5380 }, // Ũ
-    { 10, 15, 14, 2, 15, 38, 5452 }, // ũ
-    { 13, 22, 17, 2, 21, 72, 5490 }, // Ū
-    { 10, 15, 14, 2, 15, 38, 5562 }, // ū
-    { 13, 22, 17, 2, 21, 72, 5600 }, // Ŭ
-    { 10, 16, 14, 2, 16, 40, 5672 }, // ŭ
-    { 13, 23, 17, 2, 22, 75, 5712 }, // Ů
-    { 10, 16, 14, 2, 16, 40, 5787 }, // ů
-    { 15, 21, 17, 2, 20, 79, 5827 }, // Ű
-    { 15, 14, 14, 1, 14, 53, 5906 }, // ű
-    { 13, 19, 17, 2, 14, 62, 5959 }, // Ų
-    { 10, 14, 14, 2, 9, 35, 6021 }, // ų
-    { 20, 21, 24, 2, 21, 105, 6056 }, // Ŵ
-    { 14, 19, 19, 2, 17, 67, 6161 }, // ŵ
-    { 14, 22, 18, 2, 22, 77, 6228 }, // Ŷ
-    { 11, 23, 15, 2, 18, 64, 6305 }, // ŷ
-    { 14, 22, 18, 2, 22, 77, 6369 }, // Ÿ
-    { 14, 19, 18, 2, 19, 67, 6446 }, // Ź
-    { 11, 15, 15, 2, 15, 42, 6513 }, // ź
-    { 14, 19, 18, 2, 19, 67, 6555 }, // Ż
-    { 11, 15, 15, 2, 15, 42, 6622 }, // ż
-    { 14, 21, 18, 2, 21, 74, 6664 }, // Ž
-    { 11, 17, 15, 2, 17, 47, 6738 }, // ž
-    { 7, 15, 10, 1, 14, 27, 6785 }, // ſ
-    { 7, 4, 0, 0, 13, 7, 0 }, // ̀
-    { 5, 4, 0, 0, 13, 5, 7 }, // ́
-    { 10, 5, 0, 0, 1, 13, 12 }, // ̂
-    { 7, 4, 0, 0, 12, 7, 25 }, // ̃
-    { 10, 3, 0, 0, 12, 8, 32 }, // ̄
-    { 12, 3, 0, 0, 15, 9, 40 }, // ̅
-    { 9, 5, 0, 0, 13, 12, 49 }, // ̆
-    { 5, 4, 0, 2, 14, 5, 61 }, // ̇
-    { 8, 4, 0, 0, 13, 8, 66 }, // ̈
-    { 4, 4, 0, 3, 11, 4, 74 }, // ̉
-    { 5, 4, 0, 0, 13, 5, 78 }, // ̊
-    { 15, 4, 0, 0, 13, 15, 83 }, // ̋
-    { 10, 5, 0, 0, 13, 13, 98 }, // ̌
-    { 15, 4, 0, -4, 13, 15, 111 }, // ̏
-    { 6, 6, 0, 0, 13, 9, 126 }, // ̒
-    { 6, 6, 0, 0, 13, 9, 135 }, // ̓
-    { 6, 6, 0, -1, 13, 9, 144 }, // ̔
-    { 5, 5, 0, 0, 0, 7, 153 }, // ̘
-    { 5, 5, 0, 0, 0, 7, 160 }, // ̙
-    { 9, 5, 0, 0, 14, 12, 167 }, // ̚
-    { 4, 5, 0, 0, 11, 5, 179 }, // ̛
-    { 4, 6, 0, 0, 0, 6, 184 }, // ̜
-    { 6, 4, 0, 0, 3, 6, 190 }, // ̝
-    { 6, 4, 0, 0, 0, 6, 196 }, // ̞
-    { 4, 5, 0, 1, -1, 5, 202 }, // ̟
-    { 10, 3, 0, 0, -2, 8, 207 }, // ̠
-    { 5, 4, 0, 0, 2, 5, 215 }, // ̣
-    { 8, 4, 0, 0, -1, 8, 220 }, // ̤
-    { 5, 4, 0, 0, 13, 5, 228 }, // ̥
-    { 6, 6, 0, 0, 3, 9, 233 }, // ̦
-    { 5, 6, 0, 0, 1, 8, 242 }, // ̧
-    { 5, 6, 0, 1, 1, 8, 250 }, // ̨
-    { 4, 6, 0, 0, 0, 6, 258 }, // ̩
-    { 7, 4, 0, 0, 0, 7, 264 }, // ̪
-    { 11, 5, 0, -1, 1, 14, 271 }, // ̬
-    { 11, 5, 0, -1, 1, 14, 285 }, // ̭
-    { 7, 4, 0, 1, 14, 7, 299 }, // ̰
-    { 9, 3, 0, 0, 14, 7, 306 }, // ̱
-    { 9, 3, 0, 0, -1, 7, 313 }, // ̲
-    { 7, 4, 0, 1, 14, 7, 320 }, // ̴
-    { 9, 2, 0, 0, 6, 5, 327 }, // ̵
-    { 4, 6, 0, 0, 0, 6, 332 }, // ̹
-    { 8, 6, 0, 0, 1, 12, 338 }, // ̺
-    { 7, 6, 0, 0, 1, 11, 350 }, // ̻
-    { 7, 5, 0, 0, 1, 9, 361 }, // ̼
-    { 6, 4, 0, 1, 13, 6, 370 }, // ̽
-    { 7, 4, 0, 0, 12, 7, 376 }, // ͂
-    { 3, 5, 0, 4, 15, 4, 383 }, // ̓
-    { 9, 12, 0, 0, 21, 27, 387 }, // ̈́
-    { 7, 4, 0, 0, 14, 7, 414 }, // ͆
-    { 10, 7, 0, 0, 0, 18, 421 }, // ͇
-    { 8, 5, 0, 0, 0, 10, 439 }, // ͈
-    { 7, 6, 0, 0, 0, 11, 449 }, // ͉
-    { 8, 13, 0, 1, 18, 26, 460 }, // ͊
-    { 16, 13, 0, 0, 19, 52, 486 }, // ͋
-    { 10, 10, 0, 7, 10, 25, 538 }, // ͌
-    { 9, 4, 0, 1, -2, 9, 563 }, // ͍
-    { 4, 3, 0, 0, 2, 3, 572 }, // ͎
-    { 15, 5, 0, 0, 1, 19, 575 }, // ͜
-    { 15, 5, 0, 0, 14, 19, 594 }, // ͡
-    { 19, 6, 0, 0, 0, 29, 613 }, // ͢
-    { 11, 20, 15, 2, 20, 55, 0 }, // Ѐ
-    { 11, 20, 15, 2, 20, 55, 55 }, // Ё
-    { 14, 16, 11, -2, 15, 56, 110 }, // Ђ
-    { 11, 20, 11, 0, 19, 55, 166 }, // Ѓ
-    { 14, 15, 14, 0, 13, 53, 221 }, // Є
-    { 14, 16, 18, 2, 15, 56, 274 }, // Ѕ
-    { 5, 14, 9, 2, 14, 18, 330 }, // І
-    { 8, 21, 9, 0, 21, 42, 348 }, // Ї
-    { 11, 18, 15, 2, 14, 50, 390 }, // Ј
-    { 17, 15, 19, 1, 13, 64, 440 }, // Љ
-    { 16, 15, 10, -3, 14, 60, 504 }, // Њ
-    { 16, 16, 18, 2, 16, 64, 564 }, // Ћ
-    { 13, 19, 18, 2, 19, 62, 628 }, // Ќ
-    { 13, 21, 17, 2, 21, 69, 690 }, // Ѝ
-    { 11, 22, 13, 1, 20, 61, 759 }, // Ў
-    { 11, 17, 13, 1, 13, 47, 820 }, // Џ
-    { 14, 14, 16, 1, 14, 49, 867 }, // А
-    { 9, 13, 11, 1, 13, 30, 916 }, // Б
-    { 10, 14, 11, 1, 13, 35, 946 }, // В
-    { 11, 14, 11, 0, 13, 39, 981 }, // Г
-    { 14, 15, 14, 0, 13, 53, 1020 }, // Д
-    { 11, 15, 15, 2, 15, 42, 1073 }, // Е
-    { 21, 14, 19, -1, 14, 74, 1115 }, // Ж
-    { 9, 13, 11, 1, 13, 30, 1189 }, // З
-    { 13, 14, 17, 2, 14, 46, 1219 }, // И
-    { 13, 22, 17, 2, 22, 72, 1265 }, // Й
-    { 13, 14, 18, 2, 14, 46, 1337 }, // К
-    { 11, 15, 10, -1, 13, 42, 1383 }, // Л
-    { 14, 14, 14, 0, 13, 49, 1425 }, // М
-    { 13, 14, 18, 2, 14, 46, 1474 }, // Н
-    { 15, 15, 19, 2, 14, 57, 1520 }, // О
-    { 11, 14, 11, 0, 13, 39, 1577 }, // П
-    { 11, 15, 15, 2, 15, 42, 1616 }, // Р
-    { 12, 15, 17, 2, 15, 45, 1658 }, // С
-    { 13, 14, 18, 2, 14, 46, 1703 }, // Т
-    { 11, 15, 13, 1, 13, 42, 1749 }, // У
-    { 13, 13, 15, 1, 13, 43, 1791 }, // Ф
-    { 14, 14, 19, 2, 14, 49, 1834 }, // Х
-    { 12, 17, 12, 0, 13, 51, 1883 }, // Ц
-    { 9, 13, 11, 1, 13, 30, 1934 }, // Ч
-    { 13, 14, 14, 0, 13, 46, 1964 }, // Ш
-    { 15, 16, 15, 0, 13, 60, 2010 }, // Щ
-    { 13, 12, 10, -3, 12, 39, 2070 }, // Ъ
-    { 17, 14, 19, 0, 14, 60, 2109 }, // Ы
-    { 10, 12, 10, 0, 12, 30, 2169 }, // Ь
-    { 13, 15, 14, 0, 13, 49, 2199 }, // Э
-    { 14, 13, 15, 1, 13, 46, 2248 }, // Ю
-    { 12, 15, 16, 2, 14, 45, 2294 }, // Я
-    { 10, 10, 14, 2, 10, 25, 2339 }, // а
-    { 11, 16, 12, 0, 15, 44, 2364 }, // б
-    { 8, 9, 12, 2, 9, 18, 2408 }, // в
-    { 10, 11, 10, 0, 9, 28, 2426 }, // г
-    { 12, 12, 13, 0, 9, 36, 2454 }, // д
-    { 10, 9, 14, 2, 9, 23, 2490 }, // е
-    { 20, 12, 24, 2, 12, 60, 2513 }, // ж
-    { 7, 9, 8, 0, 9, 16, 2573 }, // з
-    { 11, 11, 11, 0, 9, 31, 2589 }, // и
-    { 9, 16, 11, 1, 16, 36, 2620 }, // й
-    { 10, 9, 13, 2, 9, 23, 2656 }, // к
-    { 8, 10, 7, -1, 9, 20, 2679 }, // л
-    { 12, 11, 14, 1, 11, 33, 2699 }, // м
-    { 10, 11, 14, 2, 11, 28, 2732 }, // н
-    { 10, 9, 14, 2, 9, 23, 2760 }, // о
-    { 11, 11, 11, 0, 9, 31, 2783 }, // п
-    { 12, 15, 16, 2, 10, 45, 2814 }, // р
-    { 9, 10, 13, 2, 10, 23, 2859 }, // с
-    { 11, 11, 11, 0, 9, 31, 2882 }, // т
-    { 11, 14, 15, 2, 9, 39, 2913 }, // у
-    { 14, 13, 15, 0, 9, 46, 2952 }, // ф
-    { 12, 11, 12, 0, 9, 33, 2998 }, // х
-    { 12, 12, 12, 0, 9, 36, 3031 }, // ц
-    { 7, 9, 8, 0, 9, 16, 3067 }, // ч
-    { 13, 10, 14, 0, 9, 33, 3083 }, // ш
-    { 15, 13, 15, 0, 9, 49, 3116 }, // щ
-    { 10, 10, 8, -3, 10, 25, 3165 }, // ъ
-    { 13, 11, 15, 0, 11, 36, 3190 }, // ы
-    { 7, 10, 8, 0, 10, 18, 3226 }, // ь
-    { 9, 10, 11, 1, 10, 23, 3244 }, // э
-    { 11, 9, 12, 1, 9, 25, 3267 }, // ю
-    { 10, 11, 14, 2, 11, 28, 3292 }, // я
-    { 10, 17, 14, 2, 17, 43, 3320 }, // ѐ
-    { 10, 16, 14, 2, 16, 40, 3363 }, // ё
-    { 13, 16, 15, 0, 14, 52, 3403 }, // ђ
-    { 10, 15, 10, 0, 13, 38, 3455 }, // ѓ
-    { 10, 10, 10, 0, 9, 25, 3493 }, // є
-    { 10, 11, 14, 2, 10, 28, 3518 }, // ѕ
-    { 4, 15, 8, 2, 15, 15, 3546 }, // і
-    { 8, 15, 8, 0, 15, 30, 3561 }, // ї
-    { 7, 20, 10, 2, 15, 35, 3591 }, // ј
-    { 12, 10, 13, 1, 9, 30, 3626 }, // љ
-    { 11, 9, 7, -2, 9, 25, 3656 }, // њ
-    { 13, 14, 15, 0, 14, 46, 3681 }, // ћ
-    { 10, 14, 13, 2, 14, 35, 3727 }, // ќ
-    { 11, 17, 11, 0, 15, 47, 3762 }, // ѝ
-    { 11, 22, 15, 2, 17, 61, 3809 }, // ў
-    { 8, 13, 10, 1, 10, 26, 3870 }, // џ
-    { 12, 14, 12, 0, 13, 42, 3896 }, // Ѣ
-    { 12, 14, 11, -1, 13, 42, 3938 }, // ѣ
-    { 16, 14, 14, -1, 13, 56, 3980 }, // Ѫ
-    { 12, 10, 10, -1, 10, 30, 4036 }, // ѫ
-    { 13, 18, 18, 3, 18, 59, 4066 }, // Ѳ
-    { 11, 13, 14, 2, 13, 36, 4125 }, // ѳ
-    { 17, 17, 19, 2, 17, 73, 4161 }, // Ѵ
-    { 12, 12, 14, 1, 12, 36, 4234 }, // ѵ
-    { 8, 6, 0, 1, 16, 12, 4270 }, // ҆
-    { 11, 15, 11, 0, 14, 42, 4282 }, // Ґ
-    { 10, 14, 10, 0, 12, 35, 4324 }, // ґ
-    { 12, 14, 11, -1, 13, 42, 4359 }, // Ғ
-    { 8, 9, 8, -1, 9, 18, 4401 }, // ғ
-    { 11, 16, 10, -1, 15, 44, 4419 }, // Ҕ
-    { 7, 10, 6, 0, 9, 18, 4463 }, // ҕ
-    { 23, 17, 24, 1, 14, 98, 4481 }, // Җ
-    { 15, 11, 17, 1, 9, 42, 4579 }, // җ
-    { 9, 16, 11, 1, 13, 36, 4621 }, // Ҙ
-    { 7, 14, 8, 0, 9, 25, 4657 }, // ҙ
-    { 14, 17, 12, 1, 14, 60, 4682 }, // Қ
-    { 10, 11, 8, 1, 9, 28, 4742 }, // қ
-    { 16, 14, 18, 1, 13, 56, 4770 }, // Ҝ
-    { 12, 9, 12, 0, 9, 27, 4826 }, // ҝ
-    { 13, 14, 18, 2, 14, 46, 4853 }, // Ҟ
-    { 12, 14, 15, 1, 14, 42, 4899 }, // ҟ
-    { 15, 14, 18, 0, 14, 53, 4941 }, // Ҡ
-    { 11, 9, 12, 0, 9, 25, 4994 }, // ҡ
-    { 14, 16, 13, 0, 14, 56, 5019 }, // Ң
-    { 10, 11, 9, 0, 9, 28, 5075 }, // ң
-    { 19, 14, 18, 2, 14, 67, 5103 }, // Ҥ
-    { 14, 9, 12, 1, 9, 32, 5170 }, // ҥ
-    { 18, 16, 21, 2, 15, 72, 5202 }, // Ҧ
-    { 16, 17, 21, 2, 12, 68, 5274 }, // ҧ
-    { 17, 14, 11, -3, 13, 60, 5342 }, // Ҩ
-    { 13, 11, 9, -2, 10, 36, 5402 }, // ҩ
-    { 12, 17, 17, 2, 15, 51, 5438 }, // Ҫ
-    { 9, 12, 13, 2, 10, 27, 5489 }, // ҫ
-    { 13, 16, 13, 0, 14, 52, 5516 }, // Ҭ
-    { 9, 11, 9, 0, 9, 25, 5568 }, // ҭ
-    { 14, 14, 18, 2, 14, 49, 5593 }, // Ү
-    { 11, 13, 13, 1, 9, 36, 5642 }, // ү
-    { 14, 14, 18, 2, 14, 49, 5678 }, // Ұ
-    { 11, 14, 13, 1, 10, 39, 5727 }, // ұ
-    { 14, 17, 13, 2, 14, 60, 5766 }, // Ҳ
-    { 10, 11, 9, 1, 9, 28, 5826 }, // ҳ
-    { 16, 16, 10, -3, 13, 64, 5854 }, // Ҵ
-    { 11, 12, 7, -2, 9, 33, 5918 }, // ҵ
-    { 12, 17, 11, 0, 13, 51, 5951 }, // Ҷ
-    { 8, 12, 8, 0, 9, 24, 6002 }, // ҷ
-    { 9, 13, 11, 1, 13, 30, 6026 }, // Ҹ
-    { 7, 9, 8, 0, 9, 16, 6056 }, // ҹ
-    { 11, 15, 11, 0, 14, 42, 6072 }, // Һ
-    { 11, 14, 15, 2, 14, 39, 6114 }, // һ
-    { 18, 13, 16, -3, 12, 59, 6153 }, // Ҽ
-    { 14, 9, 12, -3, 9, 32, 6212 }, // ҽ
-    { 19, 15, 15, -3, 12, 72, 6244 }, // Ҿ
-    { 14, 12, 11, -2, 10, 42, 6316 }, // ҿ
-    { 5, 14, 9, 2, 14, 18, 6358 }, // Ӏ
-    { 21, 23, 19, -1, 23, 121, 6376 }, // Ӂ
-    { 20, 20, 24, 2, 20, 100, 6497 }, // ӂ
-    { 11, 18, 12, 1, 13, 50, 6597 }, // Ӄ
-    { 8, 13, 8, 0, 9, 26, 6647 }, // ӄ
-    { 13, 17, 10, -1, 13, 56, 6673 }, // Ӆ
-    { 9, 12, 7, -1, 9, 27, 6729 }, // ӆ
-    { 14, 19, 18, 2, 14, 67, 6756 }, // Ӈ
-    { 10, 13, 12, 1, 9, 33, 6823 }, // ӈ
-    { 14, 20, 18, 2, 14, 70, 6856 }, // Ӊ
-    { 11, 13, 12, 1, 9, 36, 6926 }, // ӊ
-    { 11, 17, 11, 0, 13, 47, 6962 }, // Ӌ
-    { 7, 12, 10, 2, 9, 21, 7009 }, // ӌ
-    { 17, 20, 19, 2, 14, 85, 7030 }, // Ӎ
-    { 12, 13, 13, 1, 9, 39, 7115 }, // ӎ
-    { 4, 13, 10, 3, 12, 13, 7154 }, // ӏ
-    { 14, 20, 16, 1, 20, 70, 7167 }, // Ӑ
-    { 10, 15, 14, 2, 15, 38, 7237 }, // ӑ
-    { 14, 19, 16, 1, 19, 67, 7275 }, // Ӓ
-    { 10, 15, 14, 2, 15, 38, 7342 }, // ӓ
-    { 21, 15, 23, 1, 14, 79, 7380 }, // Ӕ
-    { 17, 10, 21, 2, 10, 43, 7459 }, // ӕ
-    { 11, 21, 15, 2, 21, 58, 7502 }, // Ӗ
-    { 10, 17, 14, 2, 17, 43, 7560 }, // ӗ
-    { 13, 15, 18, 3, 14, 49, 7603 }, // Ә
-    { 10, 11, 14, 3, 10, 28, 7652 }, // ә
-    { 13, 20, 18, 3, 19, 65, 7680 }, // Ӛ
-    { 10, 14, 14, 3, 10, 35, 7745 }, // ӛ
-    { 21, 22, 23, 1, 22, 116, 7780 }, // Ӝ
-    { 20, 19, 24, 2, 19, 95, 7896 }, // ӝ
-    { 9, 21, 11, 1, 21, 48, 7991 }, // Ӟ
-    { 8, 13, 8, -1, 13, 26, 8039 }, // ӟ
-    { 9, 14, 11, 1, 13, 32, 8065 }, // Ӡ
-    { 9, 14, 11, 1, 10, 32, 8097 }, // ӡ
-    { 13, 22, 17, 2, 22, 72, 8129 }, // Ӣ
-    { 11, 17, 11, 0, 15, 47, 8201 }, // ӣ
-    { 13, 21, 17, 2, 21, 69, 8248 }, // Ӥ
-    { 11, 16, 11, 0, 14, 44, 8317 }, // ӥ
-    { 15, 20, 19, 2, 19, 75, 8361 }, // Ӧ
-    { 11, 16, 14, 1, 16, 44, 8436 }, // ӧ
-    { 13, 14, 19, 3, 14, 46, 8480 }, // Ө
-    { 10, 9, 14, 2, 9, 23, 8526 }, // ө
-    { 13, 19, 19, 3, 19, 62, 8549 }, // Ӫ
-    { 10, 14, 14, 2, 14, 35, 8611 }, // ӫ
-    { 13, 22, 14, 0, 20, 72, 8646 }, // Ӭ
-    { 9, 14, 11, 1, 14, 32, 8718 }, // ӭ
-    { 11, 22, 13, 1, 20, 61, 8750 }, // Ӯ
-    { 11, 22, 15, 2, 17, 61, 8811 }, // ӯ
-    { 11, 21, 13, 1, 19, 58, 8872 }, // Ӱ
-    { 11, 22, 15, 2, 17, 61, 8930 }, // ӱ
-    { 15, 21, 13, 0, 19, 79, 8991 }, // Ӳ
-    { 15, 21, 15, 2, 16, 79, 9070 }, // ӳ
-    { 9, 17, 11, 1, 17, 39, 9149 }, // Ӵ
-    { 8, 13, 8, 0, 13, 26, 9188 }, // ӵ
-    { 11, 16, 11, 0, 13, 44, 9214 }, // Ӷ
-    { 8, 11, 8, 0, 9, 22, 9258 }, // ӷ
-    { 17, 22, 19, 0, 22, 94, 9280 }, // Ӹ
-    { 13, 18, 15, 0, 18, 59, 9374 }, // ӹ
-    { 16, 16, 19, 2, 14, 64, 9433 }, // Ӽ
-    { 12, 11, 13, 1, 9, 33, 9497 }, // ӽ
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 9, 2, 9, 0, 6, 5, 0 }, // ‐
-    { 9, 2, 9, 0, 6, 5, 5 }, // ‑
-    { 13, 2, 9, -2, 6, 7, 10 }, // ‒
-    { 13, 4, 13, 0, 7, 13, 17 }, // –
-    { 18, 4, 19, 0, 7, 18, 30 }, // —
-    { 18, 4, 19, 0, 7, 18, 48 }, // ―
-    { 8, 16, 9, 2, 13, 32, 66 }, // ‖
-    { 15, 6, 9, -3, -1, 23, 98 }, // ‗
-    { 6, 6, 7, 1, 15, 9, 121 }, // ‘
-    { 6, 6, 7, 1, 15, 9, 130 }, // ’
-    { 6, 6, 5, 0, 3, 9, 139 }, // ‚
-    { 6, 6, 7, 1, 15, 9, 148 }, // ‛
-    { 11, 6, 13, 1, 15, 17, 157 }, // “
-    { 11, 6, 13, 1, 15, 17, 174 }, // ”
-    { 6, 6, 5, 0, 3, 9, 191 }, // „
-    { 11, 6, 13, 1, 15, 17, 200 }, // ‟
-    { 10, 24, 13, 2, 18, 60, 217 }, // †
-    { 10, 23, 14, 3, 17, 58, 277 }, // ‡
-    { 14, 13, 8, -3, 15, 46, 335 }, // •
-    { 6, 7, 10, 2, 8, 11, 381 }, // ‣
-    { 4, 4, 10, 3, 4, 4, 392 }, // ․
-    { 4, 4, 10, 3, 4, 4, 396 }, // ‥
-    { 16, 4, 16, 0, 4, 16, 400 }, // …
-    { 3, 2, 9, 3, 6, 2, 416 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 418 }, //  
-    { 13, 15, 19, 3, 13, 49, 418 }, // ‰
-    { 7, 6, 9, 2, 15, 11, 467 }, // ′
-    { 12, 6, 13, 2, 15, 18, 478 }, // ″
-    { 13, 6, 7, 1, 14, 20, 496 }, // ‴
-    { 5, 6, 7, 1, 14, 8, 516 }, // ‵
-    { 8, 6, 7, 0, 14, 12, 524 }, // ‶
-    { 13, 6, 7, -3, 14, 20, 536 }, // ‷
-    { 10, 4, 11, 0, 14, 10, 556 }, // ‸
-    { 5, 10, 7, 1, 10, 13, 566 }, // ‹
-    { 6, 10, 7, 0, 10, 15, 579 }, // ›
-    { 18, 22, 23, 3, 17, 99, 594 }, // ※
-    { 6, 22, 10, 2, 19, 33, 693 }, // ‼
-    { 11, 27, 14, 1, 23, 75, 726 }, // ‽
-    { 9, 2, 9, 0, 14, 5, 801 }, // ‾
-    { 9, 5, 9, 0, 12, 12, 806 }, // ‿
-    { 13, 12, 11, -1, 15, 39, 818 }, // ⁂
-    { 11, 15, 21, 5, 13, 42, 857 }, // ⁄
-    { 21, 21, 25, 2, 19, 111, 899 }, // ⁇
-    { 18, 22, 20, 1, 19, 99, 1010 }, // ⁈
-    { 14, 22, 13, -1, 19, 77, 1109 }, // ⁉
-    { 13, 29, 15, 1, 20, 95, 1186 }, // ⁒
-    { 0, 0, 78, 0, 0, 0, 1281 }, //  
-    { 5, 7, 6, 0, 14, 9, 0 }, // ⁰
-    { 6, 6, 6, 0, 14, 9, 9 }, // ⁴
-    { 6, 8, 6, 0, 14, 12, 18 }, // ⁵
-    { 6, 7, 6, 0, 14, 11, 30 }, // ⁶
-    { 6, 8, 6, 0, 15, 12, 41 }, // ⁷
-    { 6, 7, 6, 0, 14, 11, 53 }, // ⁸
-    { 6, 8, 6, 0, 14, 12, 64 }, // ⁹
-    { 10, 10, 15, 2, 10, 25, 76 }, // ⁿ
-    { 6, 7, 6, 0, 4, 11, 101 }, // ₀
-    { 5, 7, 6, 0, 4, 9, 112 }, // ₁
-    { 6, 7, 6, 0, 4, 11, 121 }, // ₂
-    { 6, 7, 6, 0, 4, 11, 132 }, // ₃
-    { 6, 7, 6, 0, 4, 11, 143 }, // ₄
-    { 5, 8, 6, 0, 5, 10, 154 }, // ₅
-    { 6, 7, 6, 0, 4, 11, 164 }, // ₆
-    { 6, 8, 6, 0, 5, 12, 175 }, // ₇
-    { 6, 7, 6, 0, 4, 11, 187 }, // ₈
-    { 6, 8, 6, 0, 4, 12, 198 }, // ₉
-    { 7, 23, 8, 1, 17, 41, 210 }, // ₍
-    { 8, 23, 7, -1, 17, 46, 251 }, // ₎
-    { 12, 22, 17, 2, 18, 66, 0 }, // ₡
-    { 12, 15, 17, 2, 15, 45, 66 }, // ₢
-    { 12, 14, 12, 0, 13, 42, 111 }, // ₤
-    { 19, 14, 17, -1, 14, 67, 153 }, // ₦
-    { 15, 15, 15, 0, 15, 57, 220 }, // ₧
-    { 18, 15, 22, 2, 14, 68, 277 }, // ₨
-    { 14, 14, 14, 0, 14, 49, 345 }, // ₩
-    { 14, 13, 18, 2, 13, 46, 394 }, // ₪
-    { 12, 14, 9, -1, 13, 42, 440 }, // ₫
-    { 12, 17, 12, 0, 14, 51, 482 }, // €
-    { 13, 14, 18, 2, 14, 46, 533 }, // ₮
-    { 17, 15, 11, -1, 15, 64, 579 }, // ₱
-    { 15, 21, 19, 2, 18, 79, 643 }, // ₲
-    { 17, 15, 17, 3, 14, 64, 722 }, // ₴
-    { 9, 13, 10, 2, 11, 30, 786 }, // ₵
-    { 14, 16, 18, 2, 16, 56, 816 }, // ₸
-    { 9, 13, 12, 1, 12, 30, 872 }, // ₹
-    { 11, 13, 12, 0, 11, 36, 902 }, // ₺
-    { 12, 14, 14, 1, 14, 42, 938 }, // ₼
-    { 15, 15, 15, -2, 15, 57, 980 }, // ₽
-    { 12, 11, 12, 0, 9, 33, 0 }, // ←
-    { 13, 12, 13, 0, 10, 39, 33 }, // ↑
-    { 12, 11, 13, 0, 9, 33, 72 }, // →
-    { 13, 12, 13, 0, 11, 39, 105 }, // ↓
-    { 14, 9, 17, 2, 9, 32, 144 }, // ↔
-    { 10, 14, 13, 2, 15, 35, 176 }, // ↕
-    { 10, 10, 13, 2, 10, 25, 211 }, // ↖
-    { 10, 10, 11, 0, 10, 25, 236 }, // ↗
-    { 10, 10, 11, 0, 9, 25, 261 }, // ↘
-    { 10, 10, 11, 0, 9, 25, 286 }, // ↙
-    { 13, 12, 16, 2, 10, 39, 311 }, // ⇐
-    { 14, 14, 18, 2, 13, 49, 350 }, // ⇑
-    { 13, 12, 16, 2, 10, 39, 399 }, // ⇒
-    { 14, 14, 18, 2, 13, 49, 438 }, // ⇓
-    { 15, 12, 18, 2, 10, 45, 487 }, // ⇔
-    { 11, 15, 15, 2, 9, 42, 532 }, // ⇕
-    { 11, 16, 11, 0, 15, 44, 0 }, // ∂
-    { 18, 16, 19, 0, 15, 72, 44 }, // ∅
-    { 14, 14, 14, 0, 13, 49, 116 }, // ∆
-    { 12, 14, 12, 0, 13, 42, 165 }, // ∏
-    { 12, 14, 12, 0, 13, 42, 207 }, // ∐
-    { 10, 14, 10, 0, 13, 35, 249 }, // ∑
-    { 10, 3, 10, 0, 6, 8, 284 }, // −
-    { 14, 15, 16, 1, 14, 53, 292 }, // √
-    { 15, 10, 15, 0, 11, 38, 345 }, // ∞
-    { 14, 18, 14, 0, 13, 63, 383 }, // ∫
-    { 5, 12, 5, 0, 12, 15, 446 }, // ∶
-    { 10, 10, 24, 7, 10, 25, 461 }, // ≈
-    { 13, 15, 21, 4, 14, 49, 486 }, // ≠
-    { 15, 15, 13, -1, 13, 57, 535 }, // ≤
-    { 15, 14, 14, 0, 12, 53, 592 }, // ≥
+    { 9, 10, 9, 0, 10, 23, 3439 }, // «
+    { 10, 6, 10, 0, 6, 15, 268 }, // ¬
+    { 10, 2, 10, 0, 6, 5, 283 }, // ­
+    { 8, 7, 11, 2, 18, 14, 288 }, // ®
+    { 8, 3, 9, 0, 13, 6, 302 }, // ¯
+    { 8, 8, 11, 2, 13, 16, 308 }, // °
+    { 10, 11, 10, 0, 9, 28, 324 }, // ±
+    { 5, 7, 5, 0, 14, 9, 352 }, // ²
+    { 5, 7, 6, 0, 14, 9, 361 }, // ³
+    { 5, 4, 5, 0, 13, 5, 370 }, // ´
+    { 11, 11, 14, 1, 9, 31, 375 }, // µ
+    { 10, 15, 13, 1, 12, 38, 406 }, // ¶
+    { 4, 4, 4, 0, 8, 4, 444 }, // ·
+    { 5, 6, 5, 0, 1, 8, 448 }, // ¸
+    { 5, 7, 5, 0, 14, 9, 456 }, // ¹
+    { 6, 6, 11, 3, 13, 9, 465 }, // º
+    { 10, 10, 12, 1, 10, 25, 3462 }, // »
+    { 16, 16, 21, 2, 14, 64, 474 }, // ¼
+    { 18, 17, 21, 2, 15, 77, 538 }, // ½
+    { 16, 15, 21, 2, 13, 60, 615 }, // ¾
+    { 11, 21, 11, 0, 12, 58, 675 }, // ¿
+    { 14, 19, 16, 1, 19, 67, 3487 }, // À
+    { 14, 22, 16, 1, 22, 77, 3554 }, // Á
+    { 14, 20, 16, 1, 20, 70, 3631 }, // Â
+    { 14, 19, 16, 1, 19, 67, 733 }, // Ã
+    { 14, 20, 16, 1, 20, 70, 3701 }, // Ä
+    { 14, 20, 16, 1, 20, 70, 800 }, // Å
+    { 21, 15, 23, 1, 14, 79, 870 }, // Æ
+    { 12, 19, 17, 2, 15, 57, 3771 }, // Ç
+    { 11, 19, 15, 2, 19, 53, 3828 }, // È
+    { 11, 22, 15, 2, 22, 61, 3881 }, // É
+    { 11, 21, 15, 2, 21, 58, 3942 }, // Ê
+    { 11, 20, 15, 2, 20, 55, 4000 }, // Ë
+    { 8, 20, 9, 0, 20, 40, 4055 }, // Ì
+    { 5, 23, 9, 2, 23, 29, 4095 }, // Í
+    { 10, 21, 9, 0, 21, 53, 4124 }, // Î
+    { 9, 21, 9, 0, 21, 48, 4177 }, // Ï
+    { 16, 14, 18, -1, 14, 56, 949 }, // Ð
+    { 13, 19, 17, 2, 19, 62, 4225 }, // Ñ
+    { 15, 20, 19, 2, 19, 75, 4287 }, // Ò
+    { 15, 23, 19, 2, 22, 87, 4362 }, // Ó
+    { 15, 21, 19, 2, 20, 79, 4449 }, // Ô
+    { 15, 20, 19, 2, 19, 75, 1005 }, // Õ
+    { 15, 21, 19, 2, 20, 79, 4528 }, // Ö
+    { 10, 6, 10, 0, 7, 15, 1080 }, // ×
+    { 25, 33, 19, -3, 24, 207, 1095 }, // Ø
+    { 13, 21, 17, 2, 20, 69, 4607 }, // Ù
+    { 13, 24, 17, 2, 23, 78, 4676 }, // Ú
+    { 13, 22, 17, 2, 21, 72, 4754 }, // Û
+    { 13, 22, 17, 2, 21, 72, 4826 }, // Ü
+    { 14, 24, 18, 2, 24, 84, 1302 }, // Ý
+    { 9, 14, 9, 0, 14, 32, 1386 }, // Þ
+    { 11, 13, 11, 0, 12, 36, 1418 }, // ß
+    { 10, 14, 14, 2, 14, 35, 4898 }, // à
+    { 10, 17, 14, 2, 17, 43, 4933 }, // á
+    { 10, 16, 14, 2, 16, 40, 4976 }, // â
+    { 10, 15, 14, 2, 15, 38, 1454 }, // ã
+    { 10, 15, 14, 2, 15, 38, 5016 }, // ä
+    { 10, 16, 14, 2, 16, 40, 1492 }, // å
+    { 17, 10, 21, 2, 10, 43, 1532 }, // æ
+    { 9, 14, 13, 2, 10, 32, 5054 }, // ç
+    { 10, 16, 14, 2, 16, 40, 5086 }, // è
+    { 10, 19, 14, 2, 19, 48, 5126 }, // é
+    { 10, 17, 14, 2, 17, 43, 5174 }, // ê
+    { 10, 17, 14, 2, 17, 43, 5217 }, // ë
+    { 7, 14, 8, 0, 14, 25, 5260 }, // ì
+    { 4, 17, 8, 2, 17, 17, 5285 }, // í
+    { 10, 16, 8, -1, 16, 40, 5302 }, // î
+    { 8, 15, 8, 0, 15, 30, 5342 }, // ï
+    { 14, 16, 12, -1, 15, 56, 1575 }, // ð
+    { 10, 15, 15, 2, 15, 38, 5372 }, // ñ
+    { 10, 14, 14, 2, 14, 35, 5410 }, // ò
+    { 10, 17, 14, 2, 17, 43, 5445 }, // ó
+    { 10, 15, 14, 2, 15, 38, 5488 }, // ô
+    { 10, 14, 14, 2, 14, 35, 1631 }, // õ
+    { 10, 15, 14, 2, 15, 38, 5526 }, // ö
+    { 13, 12, 15, 1, 12, 39, 1666 }, // ÷
+    { 12, 28, 14, 1, 19, 84, 1705 }, // ø
+    { 10, 14, 14, 2, 14, 35, 5564 }, // ù
+    { 10, 17, 14, 2, 17, 43, 5599 }, // ú
+    { 10, 15, 14, 2, 15, 38, 5642 }, // û
+    { 10, 15, 14, 2, 15, 38, 5680 }, // ü
+    { 11, 24, 15, 2, 19, 66, 1789 }, // ý
+    { 9, 18, 9, 0, 14, 41, 1855 }, // þ
+    { 11, 22, 15, 2, 17, 61, 1896 }, // ÿ
+    { 14, 20, 16, 1, 20, 70, 1957 }, // Ā
+    { 10, 15, 14, 2, 15, 38, 2027 }, // ā
+    { 14, 20, 16, 1, 20, 70, 2065 }, // Ă
+    { 10, 16, 14, 2, 16, 40, 2135 }, // ă
+    { 14, 19, 16, 1, 14, 67, 2175 }, // Ą
+    { 11, 15, 14, 2, 10, 42, 2242 }, // ą
+    { 12, 20, 17, 2, 20, 60, 2284 }, // Ć
+    { 9, 14, 13, 2, 14, 32, 2344 }, // ć
+    { 12, 21, 17, 2, 21, 63, 2376 }, // Ĉ
+    { 10, 15, 13, 2, 15, 38, 2439 }, // ĉ
+    { 12, 20, 17, 2, 20, 60, 2477 }, // Ċ
+    { 9, 14, 13, 2, 14, 32, 2537 }, // ċ
+    { 12, 21, 17, 2, 21, 63, 2569 }, // Č
+    { 10, 15, 13, 2, 15, 38, 2632 }, // č
+    { 13, 21, 18, 2, 21, 69, 2670 }, // Ď
+    { 14, 14, 15, 2, 14, 49, 2739 }, // ď
+    { 16, 14, 18, -1, 14, 56, 2788 }, // Đ
+    { 13, 14, 15, 2, 14, 46, 2844 }, // đ
+    { 11, 20, 15, 2, 20, 55, 2890 }, // Ē
+    { 10, 17, 14, 2, 17, 43, 2945 }, // ē
+    { 11, 21, 15, 2, 21, 58, 2988 }, // Ĕ
+    { 10, 17, 14, 2, 17, 43, 3046 }, // ĕ
+    { 11, 20, 15, 2, 20, 55, 3089 }, // Ė
+    { 10, 17, 14, 2, 17, 43, 3144 }, // ė
+    { 11, 19, 15, 2, 14, 53, 3187 }, // Ę
+    { 10, 16, 14, 2, 9, 40, 3240 }, // ę
+    { 11, 22, 15, 2, 22, 61, 3280 }, // Ě
+    { 10, 18, 14, 2, 18, 45, 3341 }, // ě
+    { 15, 23, 19, 2, 23, 87, 3386 }, // Ĝ
+    { 11, 21, 14, 2, 16, 58, 3473 }, // ĝ
+    { 15, 23, 19, 2, 23, 87, 3531 }, // Ğ
+    { 10, 21, 14, 2, 16, 53, 3618 }, // ğ
+    { 15, 22, 19, 2, 22, 83, 3671 }, // Ġ
+    { 10, 20, 14, 2, 15, 50, 3754 }, // ġ
+    { 15, 25, 19, 2, 25, 94, 3804 }, // Ģ
+    { 10, 21, 14, 2, 16, 53, 3898 }, // ģ
+    { 13, 21, 18, 2, 21, 69, 3951 }, // Ĥ
+    { 13, 20, 15, 0, 20, 65, 4020 }, // ĥ
+    { 15, 14, 18, 1, 14, 53, 4085 }, // Ħ
+    { 13, 14, 15, 0, 14, 46, 4138 }, // ħ
+    { 7, 21, 9, 1, 21, 37, 4184 }, // Ĩ
+    { 7, 16, 8, 0, 16, 28, 4221 }, // ĩ
+    { 10, 21, 9, -1, 21, 53, 4249 }, // Ī
+    { 10, 15, 8, -1, 15, 38, 4302 }, // ī
+    { 6, 19, 9, 1, 14, 29, 4340 }, // Į
+    { 6, 20, 8, 1, 15, 30, 4369 }, // į
+    { 5, 21, 9, 2, 21, 27, 4399 }, // İ
+    { 4, 10, 8, 2, 10, 10, 4426 }, // ı
+    { 14, 21, 26, 6, 14, 74, 4436 }, // Ĳ
+    { 10, 19, 8, 2, 15, 48, 4510 }, // ĳ
+    { 12, 25, 15, 2, 21, 75, 4558 }, // Ĵ
+    { 9, 22, 10, 2, 17, 50, 4633 }, // ĵ
+    { 13, 23, 18, 2, 23, 75, 4683 }, // Ķ
+    { 11, 23, 15, 2, 14, 64, 4758 }, // ķ
+    { 9, 9, 11, 1, 9, 21, 4822 }, // ĸ
+    { 11, 19, 15, 2, 19, 53, 4843 }, // Ĺ
+    { 6, 21, 10, 2, 21, 32, 4896 }, // ĺ
+    { 12, 22, 15, 1, 22, 66, 4928 }, // Ļ
+    { 7, 23, 10, 1, 14, 41, 4994 }, // ļ
+    { 11, 14, 15, 2, 14, 39, 5035 }, // Ľ
+    { 8, 17, 10, 2, 17, 34, 5074 }, // ľ
+    { 11, 14, 15, 2, 14, 39, 5108 }, // Ŀ
+    { 8, 14, 10, 2, 14, 28, 5147 }, // ŀ
+    { 19, 26, 15, -5, 20, 124, 5175 }, // Ł
+    { 13, 14, 10, -4, 14, 46, 5299 }, // ł
+    { 13, 20, 17, 2, 20, 65, 5345 }, // Ń
+    { 10, 16, 15, 2, 16, 40, 5410 }, // ń
+    { 13, 21, 17, 2, 14, 69, 5450 }, // Ņ
+    { 10, 17, 15, 2, 10, 43, 5519 }, // ņ
+    { 13, 21, 17, 2, 21, 69, 5562 }, // Ň
+    { 11, 17, 15, 2, 17, 47, 5631 }, // ň
+    { 10, 17, 15, 2, 17, 43, 5678 }, // ŉ
+    { 13, 18, 17, 2, 14, 59, 5721 }, // Ŋ
+    { 10, 14, 15, 2, 10, 35, 5780 }, // ŋ
+    { 15, 21, 19, 2, 20, 79, 5815 }, // Ō
+    { 10, 15, 14, 2, 15, 38, 5894 }, // ō
+    { 15, 21, 19, 2, 20, 79, 5932 }, // Ŏ
+    { 10, 15, 14, 2, 15, 38, 6011 }, // ŏ
+    { 16, 20, 19, 2, 19, 80, 6049 }, // Ő
+    { 15, 14, 14, 1, 14, 53, 6129 }, // ő
+    { 20, 15, 20, 2, 14, 75, 5718 }, // Œ
+    { 17, 9, 18, 2, 9, 39, 5793 }, // œ
+    { 12, 20, 16, 2, 19, 60, 6182 }, // Ŕ
+    { 8, 14, 12, 2, 14, 28, 6242 }, // ŕ
+    { 12, 24, 16, 2, 23, 72, 6270 }, // Ŗ
+    { 8, 17, 12, 2, 17, 34, 6342 }, // ŗ
+    { 12, 22, 16, 2, 21, 66, 6376 }, // Ř
+    { 9, 15, 12, 1, 15, 34, 6442 }, // ř
+    { 14, 21, 18, 2, 20, 74, 6476 }, // Ś
+    { 10, 15, 14, 2, 14, 38, 6550 }, // ś
+    { 14, 22, 18, 2, 21, 77, 6588 }, // Ŝ
+    { 10, 16, 14, 2, 15, 40, 6665 }, // ŝ
+    { 14, 19, 18, 2, 15, 67, 6705 }, // Ş
+    { 10, 14, 14, 2, 10, 35, 6772 }, // ş
+    { 14, 22, 18, 2, 21, 77, 6807 }, // Š
+    { 10, 16, 14, 2, 15, 40, 6884 }, // š
+    { 13, 19, 18, 2, 14, 62, 6924 }, // Ţ
+    { 9, 17, 13, 2, 13, 39, 6986 }, // ţ
+    { 13, 21, 18, 2, 21, 69, 7025 }, // Ť
+    { 12, 16, 13, 2, 15, 48, 7094 }, // ť
+    { 13, 14, 18, 2, 14, 46, 7142 }, // Ŧ
+    { 10, 14, 13, 1, 13, 35, 7188 }, // ŧ
+    { 13, 22, 17, 2, 21, 72, 7223 }, // Ũ
+    { 10, 15, 14, 2, 15, 38, 7295 }, // ũ
+    { 13, 22, 17, 2, 21, 72, 7333 }, // Ū
+    { 10, 15, 14, 2, 15, 38, 7405 }, // ū
+    { 13, 22, 17, 2, 21, 72, 7443 }, // Ŭ
+    { 10, 16, 14, 2, 16, 40, 7515 }, // ŭ
+    { 13, 23, 17, 2, 22, 75, 7555 }, // Ů
+    { 10, 16, 14, 2, 16, 40, 7630 }, // ů
+    { 15, 21, 17, 2, 20, 79, 7670 }, // Ű
+    { 15, 14, 14, 1, 14, 53, 7749 }, // ű
+    { 13, 19, 17, 2, 14, 62, 7802 }, // Ų
+    { 10, 14, 14, 2, 9, 35, 7864 }, // ų
+    { 20, 21, 24, 2, 21, 105, 7899 }, // Ŵ
+    { 14, 19, 19, 2, 17, 67, 8004 }, // ŵ
+    { 14, 22, 18, 2, 22, 77, 8071 }, // Ŷ
+    { 11, 23, 15, 2, 18, 64, 8148 }, // ŷ
+    { 14, 22, 18, 2, 22, 77, 8212 }, // Ÿ
+    { 14, 19, 18, 2, 19, 67, 8289 }, // Ź
+    { 11, 15, 15, 2, 15, 42, 8356 }, // ź
+    { 14, 19, 18, 2, 19, 67, 8398 }, // Ż
+    { 11, 15, 15, 2, 15, 42, 8465 }, // ż
+    { 14, 21, 18, 2, 21, 74, 8507 }, // Ž
+    { 11, 17, 15, 2, 17, 47, 8581 }, // ž
+    { 7, 15, 10, 1, 14, 27, 8628 }, // ſ
+    { 7, 4, 0, 0, 13, 7, 8655 }, // ̀
+    { 5, 4, 0, 0, 13, 5, 8662 }, // ́
+    { 10, 5, 0, 0, 1, 13, 8667 }, // ̂
+    { 7, 4, 0, 0, 12, 7, 8680 }, // ̃
+    { 10, 3, 0, 0, 12, 8, 8687 }, // ̄
+    { 12, 3, 0, 0, 15, 9, 8695 }, // ̅
+    { 9, 5, 0, 0, 13, 12, 8704 }, // ̆
+    { 5, 4, 0, 2, 14, 5, 8716 }, // ̇
+    { 8, 4, 0, 0, 13, 8, 8721 }, // ̈
+    { 4, 4, 0, 3, 11, 4, 8729 }, // ̉
+    { 5, 4, 0, 0, 13, 5, 8733 }, // ̊
+    { 15, 4, 0, 0, 13, 15, 8738 }, // ̋
+    { 10, 5, 0, 0, 13, 13, 8753 }, // ̌
+    { 15, 4, 0, -4, 13, 15, 8766 }, // ̏
+    { 6, 6, 0, 0, 13, 9, 8781 }, // ̒
+    { 6, 6, 0, 0, 13, 9, 8790 }, // ̓
+    { 6, 6, 0, -1, 13, 9, 8799 }, // ̔
+    { 5, 5, 0, 0, 0, 7, 8808 }, // ̘
+    { 5, 5, 0, 0, 0, 7, 8815 }, // ̙
+    { 9, 5, 0, 0, 14, 12, 8822 }, // ̚
+    { 4, 5, 0, 0, 11, 5, 8834 }, // ̛
+    { 4, 6, 0, 0, 0, 6, 8839 }, // ̜
+    { 6, 4, 0, 0, 3, 6, 8845 }, // ̝
+    { 6, 4, 0, 0, 0, 6, 8851 }, // ̞
+    { 4, 5, 0, 1, -1, 5, 8857 }, // ̟
+    { 10, 3, 0, 0, -2, 8, 8862 }, // ̠
+    { 5, 4, 0, 0, 2, 5, 8870 }, // ̣
+    { 8, 4, 0, 0, -1, 8, 8875 }, // ̤
+    { 5, 4, 0, 0, 13, 5, 8883 }, // ̥
+    { 6, 6, 0, 0, 3, 9, 8888 }, // ̦
+    { 5, 6, 0, 0, 1, 8, 8897 }, // ̧
+    { 5, 6, 0, 1, 1, 8, 8905 }, // ̨
+    { 4, 6, 0, 0, 0, 6, 8913 }, // ̩
+    { 7, 4, 0, 0, 0, 7, 8919 }, // ̪
+    { 11, 5, 0, -1, 1, 14, 8926 }, // ̬
+    { 11, 5, 0, -1, 1, 14, 8940 }, // ̭
+    { 7, 4, 0, 1, 14, 7, 8954 }, // ̰
+    { 9, 3, 0, 0, 14, 7, 8961 }, // ̱
+    { 9, 3, 0, 0, -1, 7, 8968 }, // ̲
+    { 7, 4, 0, 1, 14, 7, 8975 }, // ̴
+    { 9, 2, 0, 0, 6, 5, 8982 }, // ̵
+    { 4, 6, 0, 0, 0, 6, 8987 }, // ̹
+    { 8, 6, 0, 0, 1, 12, 8993 }, // ̺
+    { 7, 6, 0, 0, 1, 11, 9005 }, // ̻
+    { 7, 5, 0, 0, 1, 9, 9016 }, // ̼
+    { 6, 4, 0, 1, 13, 6, 9025 }, // ̽
+    { 7, 4, 0, 0, 12, 7, 9031 }, // ͂
+    { 3, 5, 0, 4, 15, 4, 9038 }, // ̓
+    { 9, 12, 0, 0, 21, 27, 9042 }, // ̈́
+    { 7, 4, 0, 0, 14, 7, 9069 }, // ͆
+    { 10, 7, 0, 0, 0, 18, 9076 }, // ͇
+    { 8, 5, 0, 0, 0, 10, 9094 }, // ͈
+    { 7, 6, 0, 0, 0, 11, 9104 }, // ͉
+    { 8, 13, 0, 1, 18, 26, 9115 }, // ͊
+    { 16, 13, 0, 0, 19, 52, 9141 }, // ͋
+    { 10, 10, 0, 7, 10, 25, 9193 }, // ͌
+    { 9, 4, 0, 1, -2, 9, 9218 }, // ͍
+    { 4, 3, 0, 0, 2, 3, 9227 }, // ͎
+    { 15, 5, 0, 0, 1, 19, 9230 }, // ͜
+    { 15, 5, 0, 0, 14, 19, 9249 }, // ͡
+    { 19, 6, 0, 0, 0, 29, 9268 }, // ͢
+    { 11, 20, 15, 2, 20, 55, 9297 }, // Ѐ
+    { 11, 20, 15, 2, 20, 55, 0 }, // Ё
+    { 14, 16, 11, -2, 15, 56, 9352 }, // Ђ
+    { 11, 20, 11, 0, 19, 55, 9408 }, // Ѓ
+    { 14, 15, 14, 0, 13, 53, 9463 }, // Є
+    { 14, 16, 18, 2, 15, 56, 0 }, // Ѕ
+    { 5, 14, 9, 2, 14, 18, 56 }, // І
+    { 8, 21, 9, 0, 21, 42, 74 }, // Ї
+    { 11, 18, 15, 2, 14, 50, 116 }, // Ј
+    { 17, 15, 19, 1, 13, 64, 166 }, // Љ
+    { 16, 15, 10, -3, 14, 60, 230 }, // Њ
+    { 16, 16, 18, 2, 16, 64, 290 }, // Ћ
+    { 13, 19, 18, 2, 19, 62, 354 }, // Ќ
+    { 13, 21, 17, 2, 21, 69, 416 }, // Ѝ
+    { 11, 22, 13, 1, 20, 61, 485 }, // Ў
+    { 11, 17, 13, 1, 13, 47, 546 }, // Џ
+    { 14, 14, 16, 1, 14, 49, 55 }, // А
+    { 9, 13, 11, 1, 13, 30, 104 }, // Б
+    { 10, 14, 11, 1, 13, 35, 134 }, // В
+    { 11, 14, 11, 0, 13, 39, 169 }, // Г
+    { 14, 15, 14, 0, 13, 53, 208 }, // Д
+    { 11, 15, 15, 2, 15, 42, 261 }, // Е
+    { 21, 14, 19, -1, 14, 74, 303 }, // Ж
+    { 9, 13, 11, 1, 13, 30, 377 }, // З
+    { 13, 14, 17, 2, 14, 46, 407 }, // И
+    { 13, 22, 17, 2, 22, 72, 453 }, // Й
+    { 13, 14, 18, 2, 14, 46, 525 }, // К
+    { 11, 15, 10, -1, 13, 42, 571 }, // Л
+    { 14, 14, 14, 0, 13, 49, 613 }, // М
+    { 13, 14, 18, 2, 14, 46, 662 }, // Н
+    { 15, 15, 19, 2, 14, 57, 708 }, // О
+    { 11, 14, 11, 0, 13, 39, 765 }, // П
+    { 11, 15, 15, 2, 15, 42, 804 }, // Р
+    { 12, 15, 17, 2, 15, 45, 846 }, // С
+    { 13, 14, 18, 2, 14, 46, 891 }, // Т
+    { 11, 15, 13, 1, 13, 42, 937 }, // У
+    { 13, 13, 15, 1, 13, 43, 979 }, // Ф
+    { 14, 14, 19, 2, 14, 49, 1022 }, // Х
+    { 12, 17, 12, 0, 13, 51, 1071 }, // Ц
+    { 9, 13, 11, 1, 13, 30, 1122 }, // Ч
+    { 13, 14, 14, 0, 13, 46, 1152 }, // Ш
+    { 15, 16, 15, 0, 13, 60, 1198 }, // Щ
+    { 13, 12, 10, -3, 12, 39, 1258 }, // Ъ
+    { 17, 14, 19, 0, 14, 60, 1297 }, // Ы
+    { 10, 12, 10, 0, 12, 30, 1357 }, // Ь
+    { 13, 15, 14, 0, 13, 49, 1387 }, // Э
+    { 14, 13, 15, 1, 13, 46, 1436 }, // Ю
+    { 12, 15, 16, 2, 14, 45, 1482 }, // Я
+    { 10, 10, 14, 2, 10, 25, 1527 }, // а
+    { 11, 16, 12, 0, 15, 44, 1552 }, // б
+    { 8, 9, 12, 2, 9, 18, 1596 }, // в
+    { 10, 11, 10, 0, 9, 28, 1614 }, // г
+    { 12, 12, 13, 0, 9, 36, 1642 }, // д
+    { 10, 9, 14, 2, 9, 23, 1678 }, // е
+    { 20, 12, 24, 2, 12, 60, 1701 }, // ж
+    { 7, 9, 8, 0, 9, 16, 1761 }, // з
+    { 11, 11, 11, 0, 9, 31, 1777 }, // и
+    { 9, 16, 11, 1, 16, 36, 1808 }, // й
+    { 10, 9, 13, 2, 9, 23, 1844 }, // к
+    { 8, 10, 7, -1, 9, 20, 1867 }, // л
+    { 12, 11, 14, 1, 11, 33, 1887 }, // м
+    { 10, 11, 14, 2, 11, 28, 1920 }, // н
+    { 10, 9, 14, 2, 9, 23, 1948 }, // о
+    { 11, 11, 11, 0, 9, 31, 1971 }, // п
+    { 12, 15, 16, 2, 10, 45, 2002 }, // р
+    { 9, 10, 13, 2, 10, 23, 2047 }, // с
+    { 11, 11, 11, 0, 9, 31, 2070 }, // т
+    { 11, 14, 15, 2, 9, 39, 2101 }, // у
+    { 14, 13, 15, 0, 9, 46, 2140 }, // ф
+    { 12, 11, 12, 0, 9, 33, 2186 }, // х
+    { 12, 12, 12, 0, 9, 36, 2219 }, // ц
+    { 7, 9, 8, 0, 9, 16, 2255 }, // ч
+    { 13, 10, 14, 0, 9, 33, 2271 }, // ш
+    { 15, 13, 15, 0, 9, 49, 2304 }, // щ
+    { 10, 10, 8, -3, 10, 25, 2353 }, // ъ
+    { 13, 11, 15, 0, 11, 36, 2378 }, // ы
+    { 7, 10, 8, 0, 10, 18, 2414 }, // ь
+    { 9, 10, 11, 1, 10, 23, 2432 }, // э
+    { 11, 9, 12, 1, 9, 25, 2455 }, // ю
+    { 10, 11, 14, 2, 11, 28, 2480 }, // я
+    { 10, 17, 14, 2, 17, 43, 593 }, // ѐ
+    { 10, 16, 14, 2, 16, 40, 2508 }, // ё
+    { 13, 16, 15, 0, 14, 52, 636 }, // ђ
+    { 10, 15, 10, 0, 13, 38, 688 }, // ѓ
+    { 10, 10, 10, 0, 9, 25, 726 }, // є
+    { 10, 11, 14, 2, 10, 28, 751 }, // ѕ
+    { 4, 15, 8, 2, 15, 15, 779 }, // і
+    { 8, 15, 8, 0, 15, 30, 794 }, // ї
+    { 7, 20, 10, 2, 15, 35, 824 }, // ј
+    { 12, 10, 13, 1, 9, 30, 859 }, // љ
+    { 11, 9, 7, -2, 9, 25, 889 }, // њ
+    { 13, 14, 15, 0, 14, 46, 914 }, // ћ
+    { 10, 14, 13, 2, 14, 35, 960 }, // ќ
+    { 11, 17, 11, 0, 15, 47, 995 }, // ѝ
+    { 11, 22, 15, 2, 17, 61, 1042 }, // ў
+    { 8, 13, 10, 1, 10, 26, 1103 }, // џ
+    { 12, 14, 12, 0, 13, 42, 1129 }, // Ѣ
+    { 12, 14, 11, -1, 13, 42, 1171 }, // ѣ
+    { 16, 14, 14, -1, 13, 56, 1213 }, // Ѫ
+    { 12, 10, 10, -1, 10, 30, 1269 }, // ѫ
+    { 13, 18, 18, 3, 18, 59, 1299 }, // Ѳ
+    { 11, 13, 14, 2, 13, 36, 1358 }, // ѳ
+    { 17, 17, 19, 2, 17, 73, 1394 }, // Ѵ
+    { 12, 12, 14, 1, 12, 36, 1467 }, // ѵ
+    { 8, 6, 0, 1, 16, 12, 1503 }, // ҆
+    { 11, 15, 11, 0, 14, 42, 1515 }, // Ґ
+    { 10, 14, 10, 0, 12, 35, 1557 }, // ґ
+    { 12, 14, 11, -1, 13, 42, 1592 }, // Ғ
+    { 8, 9, 8, -1, 9, 18, 1634 }, // ғ
+    { 11, 16, 10, -1, 15, 44, 1652 }, // Ҕ
+    { 7, 10, 6, 0, 9, 18, 1696 }, // ҕ
+    { 23, 17, 24, 1, 14, 98, 1714 }, // Җ
+    { 15, 11, 17, 1, 9, 42, 1812 }, // җ
+    { 9, 16, 11, 1, 13, 36, 1854 }, // Ҙ
+    { 7, 14, 8, 0, 9, 25, 1890 }, // ҙ
+    { 14, 17, 12, 1, 14, 60, 1915 }, // Қ
+    { 10, 11, 8, 1, 9, 28, 1975 }, // қ
+    { 16, 14, 18, 1, 13, 56, 2003 }, // Ҝ
+    { 12, 9, 12, 0, 9, 27, 2059 }, // ҝ
+    { 13, 14, 18, 2, 14, 46, 2086 }, // Ҟ
+    { 12, 14, 15, 1, 14, 42, 2132 }, // ҟ
+    { 15, 14, 18, 0, 14, 53, 2174 }, // Ҡ
+    { 11, 9, 12, 0, 9, 25, 2227 }, // ҡ
+    { 14, 16, 13, 0, 14, 56, 2252 }, // Ң
+    { 10, 11, 9, 0, 9, 28, 2308 }, // ң
+    { 19, 14, 18, 2, 14, 67, 2336 }, // Ҥ
+    { 14, 9, 12, 1, 9, 32, 2403 }, // ҥ
+    { 18, 16, 21, 2, 15, 72, 2435 }, // Ҧ
+    { 16, 17, 21, 2, 12, 68, 2507 }, // ҧ
+    { 17, 14, 11, -3, 13, 60, 2575 }, // Ҩ
+    { 13, 11, 9, -2, 10, 36, 2635 }, // ҩ
+    { 12, 17, 17, 2, 15, 51, 2671 }, // Ҫ
+    { 9, 12, 13, 2, 10, 27, 2722 }, // ҫ
+    { 13, 16, 13, 0, 14, 52, 2749 }, // Ҭ
+    { 9, 11, 9, 0, 9, 25, 2801 }, // ҭ
+    { 14, 14, 18, 2, 14, 49, 2826 }, // Ү
+    { 11, 13, 13, 1, 9, 36, 2875 }, // ү
+    { 14, 14, 18, 2, 14, 49, 2911 }, // Ұ
+    { 11, 14, 13, 1, 10, 39, 2960 }, // ұ
+    { 14, 17, 13, 2, 14, 60, 2999 }, // Ҳ
+    { 10, 11, 9, 1, 9, 28, 3059 }, // ҳ
+    { 16, 16, 10, -3, 13, 64, 3087 }, // Ҵ
+    { 11, 12, 7, -2, 9, 33, 3151 }, // ҵ
+    { 12, 17, 11, 0, 13, 51, 3184 }, // Ҷ
+    { 8, 12, 8, 0, 9, 24, 3235 }, // ҷ
+    { 9, 13, 11, 1, 13, 30, 3259 }, // Ҹ
+    { 7, 9, 8, 0, 9, 16, 3289 }, // ҹ
+    { 11, 15, 11, 0, 14, 42, 3305 }, // Һ
+    { 11, 14, 15, 2, 14, 39, 3347 }, // һ
+    { 18, 13, 16, -3, 12, 59, 3386 }, // Ҽ
+    { 14, 9, 12, -3, 9, 32, 3445 }, // ҽ
+    { 19, 15, 15, -3, 12, 72, 3477 }, // Ҿ
+    { 14, 12, 11, -2, 10, 42, 3549 }, // ҿ
+    { 5, 14, 9, 2, 14, 18, 3591 }, // Ӏ
+    { 21, 23, 19, -1, 23, 121, 3609 }, // Ӂ
+    { 20, 20, 24, 2, 20, 100, 3730 }, // ӂ
+    { 11, 18, 12, 1, 13, 50, 3830 }, // Ӄ
+    { 8, 13, 8, 0, 9, 26, 3880 }, // ӄ
+    { 13, 17, 10, -1, 13, 56, 3906 }, // Ӆ
+    { 9, 12, 7, -1, 9, 27, 3962 }, // ӆ
+    { 14, 19, 18, 2, 14, 67, 3989 }, // Ӈ
+    { 10, 13, 12, 1, 9, 33, 4056 }, // ӈ
+    { 14, 20, 18, 2, 14, 70, 4089 }, // Ӊ
+    { 11, 13, 12, 1, 9, 36, 4159 }, // ӊ
+    { 11, 17, 11, 0, 13, 47, 4195 }, // Ӌ
+    { 7, 12, 10, 2, 9, 21, 4242 }, // ӌ
+    { 17, 20, 19, 2, 14, 85, 4263 }, // Ӎ
+    { 12, 13, 13, 1, 9, 39, 4348 }, // ӎ
+    { 4, 13, 10, 3, 12, 13, 4387 }, // ӏ
+    { 14, 20, 16, 1, 20, 70, 4400 }, // Ӑ
+    { 10, 15, 14, 2, 15, 38, 4470 }, // ӑ
+    { 14, 19, 16, 1, 19, 67, 4508 }, // Ӓ
+    { 10, 15, 14, 2, 15, 38, 4575 }, // ӓ
+    { 21, 15, 23, 1, 14, 79, 4613 }, // Ӕ
+    { 17, 10, 21, 2, 10, 43, 4692 }, // ӕ
+    { 11, 21, 15, 2, 21, 58, 4735 }, // Ӗ
+    { 10, 17, 14, 2, 17, 43, 4793 }, // ӗ
+    { 13, 15, 18, 3, 14, 49, 4836 }, // Ә
+    { 10, 11, 14, 3, 10, 28, 4885 }, // ә
+    { 13, 20, 18, 3, 19, 65, 4913 }, // Ӛ
+    { 10, 14, 14, 3, 10, 35, 4978 }, // ӛ
+    { 21, 22, 23, 1, 22, 116, 5013 }, // Ӝ
+    { 20, 19, 24, 2, 19, 95, 5129 }, // ӝ
+    { 9, 21, 11, 1, 21, 48, 5224 }, // Ӟ
+    { 8, 13, 8, -1, 13, 26, 5272 }, // ӟ
+    { 9, 14, 11, 1, 13, 32, 5298 }, // Ӡ
+    { 9, 14, 11, 1, 10, 32, 5330 }, // ӡ
+    { 13, 22, 17, 2, 22, 72, 5362 }, // Ӣ
+    { 11, 17, 11, 0, 15, 47, 5434 }, // ӣ
+    { 13, 21, 17, 2, 21, 69, 5481 }, // Ӥ
+    { 11, 16, 11, 0, 14, 44, 5550 }, // ӥ
+    { 15, 20, 19, 2, 19, 75, 5594 }, // Ӧ
+    { 11, 16, 14, 1, 16, 44, 5669 }, // ӧ
+    { 13, 14, 19, 3, 14, 46, 5713 }, // Ө
+    { 10, 9, 14, 2, 9, 23, 5759 }, // ө
+    { 13, 19, 19, 3, 19, 62, 5782 }, // Ӫ
+    { 10, 14, 14, 2, 14, 35, 5844 }, // ӫ
+    { 13, 22, 14, 0, 20, 72, 5879 }, // Ӭ
+    { 9, 14, 11, 1, 14, 32, 5951 }, // ӭ
+    { 11, 22, 13, 1, 20, 61, 5983 }, // Ӯ
+    { 11, 22, 15, 2, 17, 61, 6044 }, // ӯ
+    { 11, 21, 13, 1, 19, 58, 6105 }, // Ӱ
+    { 11, 22, 15, 2, 17, 61, 6163 }, // ӱ
+    { 15, 21, 13, 0, 19, 79, 6224 }, // Ӳ
+    { 15, 21, 15, 2, 16, 79, 6303 }, // ӳ
+    { 9, 17, 11, 1, 17, 39, 6382 }, // Ӵ
+    { 8, 13, 8, 0, 13, 26, 6421 }, // ӵ
+    { 11, 16, 11, 0, 13, 44, 6447 }, // Ӷ
+    { 8, 11, 8, 0, 9, 22, 6491 }, // ӷ
+    { 17, 22, 19, 0, 22, 94, 6513 }, // Ӹ
+    { 13, 18, 15, 0, 18, 59, 6607 }, // ӹ
+    { 16, 16, 19, 2, 14, 64, 6666 }, // Ӽ
+    { 12, 11, 13, 1, 9, 33, 6730 }, // ӽ
+    { 0, 0, 11, 0, 0, 0, 6763 }, //  
+    { 0, 0, 19, 0, 0, 0, 6763 }, //  
+    { 0, 0, 11, 0, 0, 0, 6763 }, //  
+    { 0, 0, 19, 0, 0, 0, 6763 }, //  
+    { 0, 0, 8, 0, 0, 0, 6763 }, //  
+    { 0, 0, 7, 0, 0, 0, 6763 }, //  
+    { 0, 0, 5, 0, 0, 0, 6763 }, //  
+    { 0, 0, 12, 0, 0, 0, 6763 }, //  
+    { 0, 0, 4, 0, 0, 0, 6763 }, //  
+    { 0, 0, 6, 0, 0, 0, 6763 }, //  
+    { 0, 0, 5, 0, 0, 0, 6763 }, //  
+    { 0, 0, 3, 0, 0, 0, 6763 }, // ​
+    { 0, 0, 0, 0, 0, 0, 6763 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 6763 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 6763 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 6763 }, // ‏
+    { 9, 2, 9, 0, 6, 5, 6763 }, // ‐
+    { 9, 2, 9, 0, 6, 5, 6768 }, // ‑
+    { 13, 2, 9, -2, 6, 7, 6773 }, // ‒
+    { 13, 4, 13, 0, 7, 13, 5832 }, // –
+    { 18, 4, 19, 0, 7, 18, 5845 }, // —
+    { 18, 4, 19, 0, 7, 18, 6780 }, // ―
+    { 8, 16, 9, 2, 13, 32, 6798 }, // ‖
+    { 15, 6, 9, -3, -1, 23, 6830 }, // ‗
+    { 6, 6, 7, 1, 15, 9, 5863 }, // ‘
+    { 6, 6, 7, 1, 15, 9, 5872 }, // ’
+    { 6, 6, 5, 0, 3, 9, 6853 }, // ‚
+    { 6, 6, 7, 1, 15, 9, 6862 }, // ‛
+    { 11, 6, 13, 1, 15, 17, 5881 }, // “
+    { 11, 6, 13, 1, 15, 17, 5898 }, // ”
+    { 6, 6, 5, 0, 3, 9, 6871 }, // „
+    { 11, 6, 13, 1, 15, 17, 6880 }, // ‟
+    { 10, 24, 13, 2, 18, 60, 6897 }, // †
+    { 10, 23, 14, 3, 17, 58, 6957 }, // ‡
+    { 14, 13, 8, -3, 15, 46, 7015 }, // •
+    { 6, 7, 10, 2, 8, 11, 7061 }, // ‣
+    { 4, 4, 10, 3, 4, 4, 7072 }, // ․
+    { 4, 4, 10, 3, 4, 4, 7076 }, // ‥
+    { 16, 4, 16, 0, 4, 16, 5915 }, // …
+    { 3, 2, 9, 3, 6, 2, 7080 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 7082 }, //  
+    { 13, 15, 19, 3, 13, 49, 7082 }, // ‰
+    { 7, 6, 9, 2, 15, 11, 7131 }, // ′
+    { 12, 6, 13, 2, 15, 18, 7142 }, // ″
+    { 13, 6, 7, 1, 14, 20, 7160 }, // ‴
+    { 5, 6, 7, 1, 14, 8, 7180 }, // ‵
+    { 8, 6, 7, 0, 14, 12, 7188 }, // ‶
+    { 13, 6, 7, -3, 14, 20, 7200 }, // ‷
+    { 10, 4, 11, 0, 14, 10, 7220 }, // ‸
+    { 5, 10, 7, 1, 10, 13, 7230 }, // ‹
+    { 6, 10, 7, 0, 10, 15, 7243 }, // ›
+    { 18, 22, 23, 3, 17, 99, 7258 }, // ※
+    { 6, 22, 10, 2, 19, 33, 7357 }, // ‼
+    { 11, 27, 14, 1, 23, 75, 7390 }, // ‽
+    { 9, 2, 9, 0, 14, 5, 7465 }, // ‾
+    { 9, 5, 9, 0, 12, 12, 7470 }, // ‿
+    { 13, 12, 11, -1, 15, 39, 7482 }, // ⁂
+    { 11, 15, 21, 5, 13, 42, 7521 }, // ⁄
+    { 21, 21, 25, 2, 19, 111, 7563 }, // ⁇
+    { 18, 22, 20, 1, 19, 99, 7674 }, // ⁈
+    { 14, 22, 13, -1, 19, 77, 7773 }, // ⁉
+    { 13, 29, 15, 1, 20, 95, 7850 }, // ⁒
+    { 0, 0, 78, 0, 0, 0, 7945 }, //  
+    { 5, 7, 6, 0, 14, 9, 7945 }, // ⁰
+    { 6, 6, 6, 0, 14, 9, 7954 }, // ⁴
+    { 6, 8, 6, 0, 14, 12, 7963 }, // ⁵
+    { 6, 7, 6, 0, 14, 11, 7975 }, // ⁶
+    { 6, 8, 6, 0, 15, 12, 7986 }, // ⁷
+    { 6, 7, 6, 0, 14, 11, 7998 }, // ⁸
+    { 6, 8, 6, 0, 14, 12, 8009 }, // ⁹
+    { 10, 10, 15, 2, 10, 25, 8021 }, // ⁿ
+    { 6, 7, 6, 0, 4, 11, 8046 }, // ₀
+    { 5, 7, 6, 0, 4, 9, 8057 }, // ₁
+    { 6, 7, 6, 0, 4, 11, 8066 }, // ₂
+    { 6, 7, 6, 0, 4, 11, 8077 }, // ₃
+    { 6, 7, 6, 0, 4, 11, 8088 }, // ₄
+    { 5, 8, 6, 0, 5, 10, 8099 }, // ₅
+    { 6, 7, 6, 0, 4, 11, 8109 }, // ₆
+    { 6, 8, 6, 0, 5, 12, 8120 }, // ₇
+    { 6, 7, 6, 0, 4, 11, 8132 }, // ₈
+    { 6, 8, 6, 0, 4, 12, 8143 }, // ₉
+    { 7, 23, 8, 1, 17, 41, 8155 }, // ₍
+    { 8, 23, 7, -1, 17, 46, 8196 }, // ₎
+    { 12, 22, 17, 2, 18, 66, 8242 }, // ₡
+    { 12, 15, 17, 2, 15, 45, 8308 }, // ₢
+    { 12, 14, 12, 0, 13, 42, 8353 }, // ₤
+    { 19, 14, 17, -1, 14, 67, 8395 }, // ₦
+    { 15, 15, 15, 0, 15, 57, 8462 }, // ₧
+    { 18, 15, 22, 2, 14, 68, 8519 }, // ₨
+    { 14, 14, 14, 0, 14, 49, 8587 }, // ₩
+    { 14, 13, 18, 2, 13, 46, 8636 }, // ₪
+    { 12, 14, 9, -1, 13, 42, 8682 }, // ₫
+    { 12, 17, 12, 0, 14, 51, 8724 }, // €
+    { 13, 14, 18, 2, 14, 46, 8775 }, // ₮
+    { 17, 15, 11, -1, 15, 64, 8821 }, // ₱
+    { 15, 21, 19, 2, 18, 79, 8885 }, // ₲
+    { 17, 15, 17, 3, 14, 64, 8964 }, // ₴
+    { 9, 13, 10, 2, 11, 30, 9028 }, // ₵
+    { 14, 16, 18, 2, 16, 56, 9058 }, // ₸
+    { 9, 13, 12, 1, 12, 30, 9114 }, // ₹
+    { 11, 13, 12, 0, 11, 36, 9144 }, // ₺
+    { 12, 14, 14, 1, 14, 42, 9180 }, // ₼
+    { 15, 15, 15, -2, 15, 57, 9222 }, // ₽
+    { 12, 11, 12, 0, 9, 33, 9279 }, // ←
+    { 13, 12, 13, 0, 10, 39, 9312 }, // ↑
+    { 12, 11, 13, 0, 9, 33, 9351 }, // →
+    { 13, 12, 13, 0, 11, 39, 9384 }, // ↓
+    { 14, 9, 17, 2, 9, 32, 9423 }, // ↔
+    { 10, 14, 13, 2, 15, 35, 9455 }, // ↕
+    { 10, 10, 13, 2, 10, 25, 9490 }, // ↖
+    { 10, 10, 11, 0, 10, 25, 0 }, // ↗
+    { 10, 10, 11, 0, 9, 25, 25 }, // ↘
+    { 10, 10, 11, 0, 9, 25, 50 }, // ↙
+    { 13, 12, 16, 2, 10, 39, 75 }, // ⇐
+    { 14, 14, 18, 2, 13, 49, 114 }, // ⇑
+    { 13, 12, 16, 2, 10, 39, 163 }, // ⇒
+    { 14, 14, 18, 2, 13, 49, 202 }, // ⇓
+    { 15, 12, 18, 2, 10, 45, 251 }, // ⇔
+    { 11, 15, 15, 2, 9, 42, 296 }, // ⇕
+    { 11, 16, 11, 0, 15, 44, 338 }, // ∂
+    { 18, 16, 19, 0, 15, 72, 382 }, // ∅
+    { 14, 14, 14, 0, 13, 49, 454 }, // ∆
+    { 12, 14, 12, 0, 13, 42, 503 }, // ∏
+    { 12, 14, 12, 0, 13, 42, 545 }, // ∐
+    { 10, 14, 10, 0, 13, 35, 587 }, // ∑
+    { 10, 3, 10, 0, 6, 8, 622 }, // −
+    { 14, 15, 16, 1, 14, 53, 630 }, // √
+    { 15, 10, 15, 0, 11, 38, 683 }, // ∞
+    { 14, 18, 14, 0, 13, 63, 721 }, // ∫
+    { 5, 12, 5, 0, 12, 15, 784 }, // ∶
+    { 10, 10, 24, 7, 10, 25, 799 }, // ≈
+    { 13, 15, 21, 4, 14, 49, 824 }, // ≠
+    { 15, 15, 13, -1, 13, 57, 873 }, // ≤
+    { 15, 14, 14, 0, 12, 53, 930 }, // ≥
+    { 14, 14, 18, 2, 14, 49, 983 }, // ﬀ
+    { 12, 15, 16, 2, 15, 45, 1032 }, // ﬁ
+    { 14, 14, 18, 2, 14, 49, 1077 }, // ﬂ
+    { 19, 15, 22, 2, 15, 72, 1126 }, // ﬃ
+    { 21, 14, 25, 2, 14, 74, 1198 }, // ﬄ
+    { 18, 14, 20, 1, 13, 63, 1272 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_8_boldIntervals[] = {
@@ -1836,30 +1825,90 @@ static const EpdUnicodeInterval opendyslexic_8_boldIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_8_boldGroups[] = {
-    { 0, 2336, 3439, 95, 0 },
-    { 2336, 2266, 4236, 96, 95 },
-    { 4602, 3331, 6812, 126, 191 },
-    { 7933, 516, 642, 61, 317 },
-    { 8449, 5478, 9530, 213, 378 },
-    { 13927, 833, 1281, 63, 591 },
-    { 14760, 272, 297, 20, 654 },
-    { 15032, 731, 1037, 20, 674 },
-    { 15763, 437, 574, 16, 694 },
-    { 16200, 436, 645, 15, 710 },
+    { 0, 3316, 5931, 151, 0 },
+    { 3316, 1692, 2548, 66, 379 },
+    { 5008, 4829, 9516, 238, 96 },
+    { 9837, 5638, 9515, 246, 383 },
+    { 15475, 886, 1335, 30, 701 },
+};
+
+static const uint8_t opendyslexic_8_boldGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const uint16_t opendyslexic_8_boldGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_8_bold = {
     opendyslexic_8_boldBitmaps,
     opendyslexic_8_boldGlyphs,
     opendyslexic_8_boldIntervals,
-    56,
+    58,
     30,
     22,
     -9,
     true,
     opendyslexic_8_boldGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    nullptr,
+    0,
+    0,
+    opendyslexic_8_boldGlyphLookup,
+    opendyslexic_8_boldGlyphGroups,
+    false,
+    nullptr,
 };
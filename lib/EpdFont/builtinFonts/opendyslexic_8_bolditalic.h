@@ -3,1184 +3,1165 @@
  * name: opendyslexic_8_bolditalic
  * size: 8
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_8_bolditalic 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_8_bolditalic 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_bolditalicBitmaps[18744] = {
-    0x55, 0x57, 0x3D, 0x6C, 0x1C, 0xC7, 0x15, 0x7E, 0xB3, 0x6B, 0x71, 0x2D, 0x6D, 0x94, 0x61, 0x61,
-    0x02, 0x01, 0xA8, 0x68, 0x5D, 0xA4, 0x70, 0x04, 0x5B, 0xE3, 0xD2, 0x08, 0x8E, 0x37, 0xAB, 0xA8,
-    0x10, 0x60, 0x15, 0x56, 0x21, 0x21, 0x40, 0x54, 0xA4, 0x88, 0xAB, 0x20, 0x30, 0x53, 0x05, 0x42,
-    0x70, 0xE4, 0xAE, 0x6C, 0x20, 0x29, 0x5C, 0x88, 0x85, 0x82, 0x14, 0x29, 0xC2, 0x42, 0x45, 0xA0,
-    0x14, 0x74, 0xA1, 0x42, 0x08, 0x48, 0xEE, 0xCA, 0x2C, 0x54, 0x6A, 0x62, 0x15, 0x2A, 0x0C, 0x44,
-    0xAB, 0xC4, 0x89, 0x81, 0xB8, 0xD0, 0xC4, 0x5E, 0x23, 0x43, 0x72, 0x77, 0x27, 0xDF, 0x9B, 0x3D,
-    0xEA, 0xE7, 0x70, 0xBC, 0x5B, 0xEE, 0xCD, 0xCC, 0xFB, 0xFB, 0xDE, 0xF7, 0xBE, 0x25, 0x22, 0x7A,
-    0x95, 0x22, 0x43, 0x2B, 0x94, 0xD4, 0x74, 0x97, 0x64, 0x2E, 0x2C, 0x29, 0x8A, 0x1B, 0x9A, 0xF1,
-    0x8D, 0x37, 0xE8, 0xF9, 0x6B, 0x97, 0xA4, 0x89, 0x7A, 0xD2, 0x75, 0xF4, 0x67, 0x3A, 0xF3, 0xEE,
-    0xA6, 0xFE, 0xD8, 0xEA, 0xDF, 0x59, 0xB5, 0x67, 0xB3, 0x3D, 0x27, 0x3F, 0xEB, 0x88, 0x26, 0x12,
-    0x8B, 0x54, 0x5A, 0x13, 0xC9, 0x8F, 0x1A, 0xA2, 0xE4, 0x9E, 0xA5, 0xC8, 0xE3, 0x45, 0xE1, 0x63,
-    0xA9, 0x5F, 0xBD, 0x92, 0xD3, 0x54, 0x96, 0x58, 0x73, 0xC1, 0x50, 0x82, 0x7B, 0x5D, 0x8C, 0x8F,
-    0x9E, 0x7E, 0xF2, 0x6D, 0x7F, 0x85, 0x44, 0xA7, 0xB1, 0x7B, 0x27, 0xCB, 0x89, 0xCE, 0x9C, 0x28,
-    0xD9, 0x9C, 0xC0, 0x25, 0x9F, 0x38, 0x21, 0x2A, 0xF6, 0x29, 0xF3, 0x56, 0xF8, 0x75, 0x78, 0x60,
-    0x49, 0xC3, 0xAF, 0xE1, 0x03, 0x8A, 0xBD, 0xC3, 0xF9, 0xB0, 0xBB, 0x8A, 0xBF, 0xC2, 0x7E, 0x3F,
-    0xF2, 0xF7, 0xFC, 0x56, 0xAF, 0xBC, 0x37, 0xCB, 0xBE, 0x25, 0x4A, 0xF3, 0xB0, 0x95, 0x2C, 0x9F,
-    0xC5, 0x61, 0xDC, 0x89, 0x5C, 0xD4, 0xA4, 0xA7, 0x92, 0xFA, 0xE4, 0xA9, 0x8C, 0x4E, 0x4D, 0x26,
-    0x94, 0xB5, 0x2D, 0xA5, 0x0F, 0x0D, 0xAC, 0xFC, 0xC9, 0x90, 0xBA, 0xD6, 0xD0, 0xF6, 0x27, 0x8D,
-    0xB0, 0x4F, 0x4C, 0x62, 0x7C, 0x2D, 0xCB, 0x29, 0x9D, 0xE1, 0x9D, 0xCA, 0x90, 0xBC, 0x9A, 0xC7,
-    0xF5, 0x84, 0x26, 0x71, 0x19, 0xDF, 0x6B, 0x29, 0xEB, 0x49, 0x78, 0x18, 0x34, 0xAF, 0x65, 0x37,
-    0x2E, 0xEE, 0xD9, 0x69, 0xAB, 0x85, 0x47, 0x1C, 0x46, 0x21, 0x92, 0xA2, 0xC9, 0x79, 0x8F, 0x57,
-    0xF7, 0x6D, 0xA7, 0x7F, 0xBB, 0x49, 0xC8, 0x67, 0xD4, 0x52, 0x62, 0x28, 0x2B, 0x09, 0xE1, 0x6D,
-    0x13, 0xB5, 0x14, 0x5B, 0xBE, 0x81, 0x2C, 0x21, 0x13, 0x19, 0xCE, 0x27, 0xFE, 0x65, 0x7A, 0xF4,
-    0xD6, 0xE1, 0x8D, 0x9B, 0x48, 0x84, 0xAC, 0x79, 0xD9, 0x8C, 0x08, 0xF1, 0x39, 0x12, 0x88, 0xD6,
-    0xF2, 0xEE, 0xF8, 0x68, 0x37, 0x56, 0xAD, 0xF1, 0x2F, 0xB8, 0x8D, 0x1B, 0x38, 0x6B, 0x46, 0x22,
-    0x5C, 0x2A, 0xDE, 0x82, 0x0A, 0xAA, 0x1C, 0xBF, 0xF2, 0xEB, 0x0E, 0xFD, 0xFC, 0x7E, 0xE2, 0xBB,
-    0xD4, 0xE7, 0xD9, 0x10, 0xFB, 0x21, 0x9D, 0x6C, 0x8A, 0x90, 0x16, 0x3A, 0x46, 0x51, 0x83, 0xCA,
-    0xC7, 0xB5, 0xF2, 0xDF, 0xF8, 0x01, 0xDE, 0x49, 0x3E, 0xE2, 0x15, 0x8A, 0x6E, 0x65, 0x66, 0x37,
-    0xB6, 0xFA, 0x7A, 0x47, 0xDA, 0xDF, 0xF7, 0xDD, 0x89, 0x8B, 0x0F, 0xFF, 0xDB, 0x3D, 0x03, 0x42,
-    0x00, 0x05, 0x1F, 0x80, 0xCD, 0x84, 0xCD, 0xF8, 0x48, 0xB9, 0x64, 0x19, 0xDF, 0x5F, 0xE1, 0x8F,
-    0x19, 0x7F, 0xB4, 0xBC, 0x82, 0x97, 0xC1, 0x63, 0x62, 0xBF, 0xE6, 0x2B, 0xA6, 0xCF, 0x56, 0xB8,
-    0x67, 0x2B, 0x9A, 0xA3, 0x15, 0x92, 0x33, 0xC8, 0x50, 0xE0, 0xD8, 0x42, 0xE8, 0x24, 0xDA, 0x97,
-    0x56, 0x9C, 0xE4, 0xFB, 0x8B, 0xC1, 0x91, 0x65, 0x43, 0xBB, 0x6D, 0x64, 0x27, 0x49, 0x3D, 0x91,
-    0x7F, 0x9F, 0xC8, 0xF5, 0x59, 0xB6, 0xE2, 0xD4, 0xC4, 0xE9, 0xC8, 0xEA, 0x8B, 0x56, 0x7B, 0xA3,
-    0x7D, 0x99, 0x0D, 0xB4, 0xF0, 0x05, 0xD1, 0x42, 0x99, 0x74, 0xE4, 0xCB, 0x93, 0xA8, 0x1F, 0x5B,
-    0x9C, 0x72, 0x0D, 0xB6, 0x91, 0xE1, 0xCC, 0xEF, 0xF9, 0x4E, 0x7B, 0xE4, 0xAC, 0x45, 0xA4, 0xB9,
-    0xFC, 0x83, 0x15, 0x5C, 0x26, 0xB8, 0x88, 0xE4, 0xA9, 0x92, 0x8A, 0x9A, 0xAA, 0x5A, 0xE0, 0x77,
-    0x20, 0xB8, 0xF2, 0xB5, 0xF6, 0xF0, 0x16, 0x4B, 0x95, 0xCF, 0x8F, 0x73, 0x0A, 0x67, 0xEC, 0xA6,
-    0x1C, 0x28, 0x05, 0x22, 0x12, 0x78, 0xE8, 0xA2, 0x7F, 0xF7, 0xE3, 0xD2, 0x7C, 0x79, 0x60, 0x0F,
-    0xAF, 0xB1, 0xA1, 0x82, 0x60, 0xFC, 0x37, 0x36, 0xB9, 0x51, 0xCE, 0x56, 0x92, 0xAF, 0x7A, 0xED,
-    0xDB, 0xDB, 0xBE, 0x46, 0x3D, 0x53, 0x33, 0x46, 0xCA, 0xAF, 0x0A, 0x6D, 0x32, 0x20, 0xA9, 0x38,
-    0x15, 0x59, 0x8D, 0x7D, 0x99, 0x00, 0xF0, 0xE7, 0x90, 0x20, 0x77, 0x3C, 0x69, 0x01, 0x7E, 0x05,
-    0xE3, 0x03, 0x89, 0x4B, 0x48, 0xC2, 0x40, 0x45, 0x1F, 0xED, 0x5F, 0x46, 0xDE, 0x65, 0x55, 0x66,
-    0xBE, 0x51, 0x8F, 0xAC, 0x3E, 0x67, 0xA7, 0xC2, 0x4E, 0x51, 0xB1, 0x2D, 0x00, 0xB1, 0x4C, 0xF7,
-    0x39, 0x63, 0x7E, 0x28, 0xE0, 0x78, 0x07, 0x28, 0x01, 0x35, 0x3B, 0x08, 0x36, 0x72, 0xB0, 0x27,
-    0x1B, 0xC1, 0x3D, 0x8C, 0xC4, 0xDF, 0x82, 0xDB, 0x75, 0xFA, 0x37, 0x1B, 0x9B, 0x89, 0x68, 0x0B,
-    0x84, 0x8F, 0xA6, 0xCC, 0xE5, 0x23, 0x2B, 0xEB, 0xB5, 0xA4, 0x51, 0xC2, 0x65, 0x75, 0xE1, 0x1B,
-    0xE9, 0x1B, 0xFA, 0x80, 0x7B, 0xB6, 0x11, 0xDE, 0xC5, 0x66, 0x96, 0xE6, 0x68, 0xF3, 0xC9, 0x77,
-    0xA9, 0x93, 0x7F, 0x74, 0xD2, 0xB7, 0x11, 0x12, 0x12, 0x37, 0x3F, 0xDA, 0xC2, 0xD2, 0xBC, 0x1A,
-    0xC1, 0x86, 0x44, 0xA8, 0xB2, 0x4F, 0x47, 0x80, 0xC9, 0x72, 0x37, 0x6E, 0x15, 0xD7, 0x5F, 0xD6,
-    0xB1, 0x8D, 0x50, 0x83, 0x79, 0xBC, 0xE2, 0x32, 0x21, 0x0E, 0xD2, 0x65, 0x56, 0x4B, 0xC3, 0x61,
-    0x01, 0x75, 0x01, 0x0B, 0x15, 0x7A, 0xB1, 0x87, 0x67, 0x39, 0x79, 0x83, 0xFE, 0xDE, 0x80, 0x53,
-    0x43, 0x4E, 0xAB, 0x70, 0x43, 0x54, 0xF0, 0x3A, 0xE5, 0xCD, 0xA9, 0x6F, 0x2A, 0xCF, 0x88, 0x5B,
-    0xBA, 0xA4, 0xFD, 0x87, 0xFE, 0x80, 0x28, 0x1F, 0x11, 0x22, 0x5D, 0xC8, 0x0F, 0xF6, 0x94, 0xC4,
-    0x55, 0x43, 0x11, 0x56, 0xBD, 0xCB, 0xFC, 0x17, 0x54, 0x6D, 0x50, 0xBC, 0x31, 0xB7, 0xBD, 0xE0,
-    0x40, 0x27, 0x30, 0xDB, 0x51, 0x9E, 0x05, 0x50, 0x61, 0x2B, 0x40, 0x26, 0x3A, 0x4A, 0xF1, 0x76,
-    0x14, 0x87, 0x6B, 0xF0, 0x1D, 0xFD, 0xE0, 0xA8, 0x3C, 0x62, 0x33, 0xA0, 0x15, 0xB7, 0x74, 0xFE,
-    0xAC, 0x0F, 0x2A, 0xB8, 0xB0, 0xBB, 0xC5, 0x68, 0x79, 0x87, 0x1B, 0xA7, 0x8E, 0xEF, 0xB7, 0xDF,
-    0xA1, 0x3B, 0x8F, 0xA8, 0x96, 0x6F, 0xFF, 0xEA, 0x4D, 0xF1, 0x8D, 0x4F, 0x73, 0xA5, 0x0E, 0x4D,
-    0xD4, 0x8A, 0x0D, 0xCA, 0x9A, 0xD7, 0xC0, 0x0B, 0x21, 0xA2, 0x1E, 0xA7, 0xFD, 0xF5, 0xE8, 0x10,
-    0xB4, 0x6A, 0x82, 0xA0, 0x11, 0x2D, 0x50, 0x95, 0x3C, 0x28, 0xC9, 0x39, 0x52, 0xB2, 0x4E, 0x9A,
-    0x0E, 0x19, 0x46, 0x57, 0x76, 0xE0, 0x49, 0x03, 0x92, 0xD4, 0xA5, 0xFC, 0xD2, 0x22, 0x63, 0x9E,
-    0x5D, 0xB7, 0x51, 0x9B, 0xE5, 0x9A, 0xDA, 0xB8, 0xC9, 0x68, 0xFD, 0x6A, 0x93, 0xE2, 0x26, 0x56,
-    0x65, 0xA5, 0x8E, 0x5A, 0x20, 0xE0, 0xF6, 0xC0, 0x74, 0x54, 0x78, 0x97, 0xFA, 0xFD, 0xB9, 0xF3,
-    0x55, 0x43, 0x05, 0x50, 0x01, 0xB2, 0xAC, 0x36, 0x16, 0x93, 0x36, 0x04, 0x81, 0x5A, 0x00, 0x0B,
-    0xB8, 0xE4, 0x4C, 0xD1, 0xEB, 0xD8, 0x53, 0x4B, 0x20, 0x30, 0xF3, 0x8C, 0x6E, 0x14, 0x0C, 0xD7,
-    0x02, 0xE7, 0x80, 0xC1, 0x6D, 0x6C, 0x13, 0x1C, 0x2C, 0x1C, 0x10, 0xEE, 0x80, 0xD9, 0x16, 0x48,
-    0xB2, 0x59, 0x99, 0x58, 0x55, 0xAE, 0xA2, 0xC5, 0xB8, 0x2B, 0x7C, 0x5E, 0x20, 0xAE, 0x0A, 0xD5,
-    0x42, 0xBE, 0x8D, 0x84, 0xA1, 0xE1, 0xF7, 0x1C, 0x1B, 0x80, 0x47, 0xFA, 0xA7, 0x28, 0x87, 0xA5,
-    0x6A, 0x60, 0x42, 0x03, 0xEA, 0x49, 0xFD, 0x67, 0x33, 0x0E, 0x3B, 0x6C, 0x8A, 0x56, 0xC1, 0x86,
-    0x12, 0x06, 0xE5, 0xBF, 0x2E, 0xA1, 0x53, 0x18, 0x00, 0x30, 0x0C, 0x30, 0x01, 0xEF, 0x58, 0x0E,
-    0x8B, 0x20, 0x50, 0x42, 0xCA, 0x0A, 0xEC, 0xE3, 0xEE, 0xA7, 0x5F, 0x30, 0x6C, 0x81, 0x60, 0xFC,
-    0xF9, 0xF2, 0x15, 0x8E, 0x02, 0xE5, 0x0A, 0x49, 0x94, 0xCD, 0xE9, 0x9B, 0xD2, 0xA8, 0x5E, 0xD6,
-    0xCB, 0x7D, 0x86, 0xB4, 0xCB, 0x61, 0xCB, 0x4A, 0xEF, 0x1B, 0x4E, 0x07, 0x6D, 0xED, 0x33, 0xFF,
-    0xAE, 0xA1, 0x1D, 0xB6, 0xE1, 0x43, 0x87, 0xA2, 0x74, 0xC0, 0xA3, 0x8B, 0x6D, 0xDC, 0xA6, 0x4D,
-    0x62, 0xE5, 0xC1, 0xB8, 0x36, 0x0B, 0x4C, 0x8E, 0x90, 0x4A, 0x5D, 0x17, 0xB9, 0x2E, 0x2B, 0x2A,
-    0x72, 0xEC, 0xE9, 0x04, 0x68, 0x06, 0x6B, 0x9B, 0xC4, 0xA4, 0xF0, 0x4B, 0x96, 0xAA, 0xD4, 0x79,
-    0xC1, 0x4E, 0x85, 0x88, 0xE0, 0x29, 0x77, 0x32, 0xBB, 0xCA, 0x97, 0xEB, 0x2F, 0x5D, 0x72, 0x0E,
-    0xF8, 0x72, 0x27, 0x5C, 0x2E, 0xAA, 0x52, 0x20, 0x3D, 0xDC, 0x56, 0x05, 0x80, 0xBA, 0x94, 0x87,
-    0x99, 0x69, 0xA9, 0x03, 0x49, 0x3C, 0xC4, 0x6C, 0x43, 0x65, 0x0E, 0xDB, 0x00, 0x7F, 0x0D, 0xCE,
-    0x07, 0x8C, 0x19, 0xCE, 0x9A, 0x67, 0x4E, 0x4F, 0xF2, 0x73, 0xD0, 0xB1, 0xEC, 0x22, 0xA7, 0x3A,
-    0xE6, 0x1D, 0x24, 0x0B, 0xE7, 0xAE, 0x3F, 0xFF, 0x6E, 0xE7, 0xDF, 0x6E, 0xE9, 0x3D, 0xDF, 0x17,
-    0xFE, 0x6B, 0xC4, 0x41, 0x15, 0x46, 0xA6, 0xB4, 0x31, 0x1A, 0x2F, 0xAF, 0x6A, 0xE5, 0xA4, 0x8B,
-    0xFD, 0x47, 0x3E, 0xD7, 0x5D, 0x65, 0x93, 0xA7, 0x0F, 0x3C, 0xED, 0xF8, 0xC3, 0x46, 0x3E, 0x18,
-    0x76, 0x85, 0xF3, 0x0F, 0x8C, 0xBA, 0xF1, 0x6D, 0x17, 0xB7, 0x1E, 0x91, 0xCB, 0x87, 0x2E, 0xB5,
-    0x97, 0xAB, 0x9C, 0x96, 0x00, 0xEE, 0x02, 0xB6, 0xAA, 0x7C, 0x1B, 0xE9, 0xEE, 0x84, 0xBF, 0x87,
-    0x96, 0xFF, 0xD4, 0xC6, 0x87, 0x7B, 0x36, 0xF9, 0xDF, 0x23, 0x23, 0xBF, 0xFC, 0xAA, 0x96, 0x0F,
-    0x7D, 0xAD, 0xF6, 0x70, 0xE6, 0x9E, 0x27, 0xFD, 0x21, 0xB8, 0xEF, 0xDC, 0xC0, 0x90, 0xDB, 0x60,
-    0x02, 0xA2, 0xB8, 0x5F, 0x35, 0x31, 0xE7, 0x1A, 0xF4, 0x8A, 0x06, 0x92, 0xF5, 0x0E, 0x9A, 0x4D,
-    0xC3, 0x55, 0x78, 0xDA, 0x25, 0x6E, 0x61, 0x00, 0xC6, 0xB0, 0xD5, 0x33, 0x3A, 0x11, 0xEC, 0xEA,
-    0xF0, 0x5C, 0x6E, 0x24, 0xEC, 0xBD, 0x07, 0x83, 0x38, 0xD1, 0xA6, 0xA5, 0x42, 0xAD, 0x80, 0x96,
-    0xC2, 0x9B, 0x14, 0x08, 0x1D, 0x6E, 0x52, 0x56, 0x23, 0xD0, 0x80, 0x64, 0x06, 0x74, 0x15, 0xB6,
-    0x2C, 0x71, 0x53, 0x72, 0xDA, 0x7C, 0x29, 0xFA, 0x04, 0x66, 0x91, 0x0D, 0xA4, 0xAD, 0x5C, 0x67,
-    0x4E, 0xCA, 0x45, 0x30, 0x1A, 0xDB, 0xC5, 0x29, 0x7A, 0xAB, 0x0A, 0x46, 0x51, 0x72, 0xB0, 0x3B,
-    0x0C, 0xF1, 0xA1, 0xB0, 0xC8, 0xC3, 0xBB, 0x19, 0xCD, 0x23, 0xFD, 0x8C, 0xC1, 0xBC, 0xC5, 0xEC,
-    0x07, 0xDC, 0xC9, 0xA1, 0xBF, 0x10, 0x28, 0x77, 0x09, 0x9A, 0x61, 0x1A, 0x75, 0x59, 0x39, 0xA4,
-    0x56, 0x9F, 0xEF, 0x94, 0x99, 0x73, 0x1A, 0xAC, 0x83, 0x56, 0x58, 0x92, 0x64, 0x66, 0x91, 0xA7,
-    0x48, 0xA8, 0x3C, 0x70, 0x07, 0x46, 0xE6, 0x5F, 0xE0, 0x17, 0xAA, 0x3D, 0x88, 0x86, 0x09, 0xDD,
-    0xD7, 0x1E, 0x6D, 0x5B, 0x71, 0x71, 0x3D, 0x26, 0xAC, 0xEF, 0x2A, 0xB8, 0xC3, 0x14, 0xB6, 0x33,
-    0xA2, 0x05, 0x15, 0x86, 0x68, 0x60, 0x68, 0xEB, 0x11, 0xDD, 0xA0, 0x1E, 0x69, 0x02, 0x2F, 0x81,
-    0x06, 0x06, 0x7C, 0xF7, 0x51, 0x87, 0xBC, 0xBA, 0x08, 0xB9, 0x8D, 0xDB, 0x04, 0xE8, 0x0C, 0x38,
-    0x36, 0xA9, 0x91, 0x8C, 0xD0, 0x5A, 0x61, 0xB6, 0x61, 0xDE, 0x23, 0x67, 0x99, 0xEF, 0xC7, 0xF8,
-    0xC2, 0x3C, 0x4D, 0x1F, 0x60, 0xF4, 0xA0, 0x7F, 0x00, 0x0B, 0x33, 0x44, 0x5D, 0xDA, 0x14, 0x54,
-    0xC9, 0x26, 0xFD, 0x1A, 0xDC, 0x50, 0xE5, 0x29, 0x1A, 0xB5, 0xE8, 0x02, 0x7D, 0x16, 0xD0, 0x29,
-    0xFD, 0xBC, 0x14, 0xCC, 0x79, 0x1D, 0x73, 0x86, 0xC3, 0x07, 0x28, 0x26, 0xBF, 0x94, 0x36, 0xFA,
-    0x1C, 0x0F, 0x88, 0xD8, 0xE9, 0xB2, 0x90, 0x00, 0x6F, 0xA1, 0x3B, 0xE8, 0x9F, 0x6A, 0xC0, 0x31,
-    0x3D, 0x6C, 0x55, 0x1D, 0xB7, 0xBC, 0x05, 0x99, 0x57, 0xA6, 0xE2, 0x19, 0x0A, 0x2C, 0x01, 0x4A,
-    0x59, 0x8E, 0x91, 0x5B, 0x46, 0x0E, 0xEA, 0x45, 0x23, 0x4A, 0xF9, 0x18, 0x45, 0x44, 0x62, 0xA0,
-    0xA6, 0x46, 0x32, 0x92, 0x4C, 0x4A, 0x30, 0x2E, 0x9F, 0x02, 0xD3, 0xFF, 0xE8, 0x29, 0xB3, 0xBA,
-    0xCE, 0xAC, 0x6C, 0xE1, 0xB7, 0x56, 0xB9, 0xBA, 0xD0, 0x64, 0xD7, 0x41, 0x8B, 0xD8, 0x2A, 0x1F,
-    0x83, 0x99, 0x1A, 0x76, 0x32, 0xB3, 0x47, 0x7C, 0x5D, 0x05, 0x32, 0xCB, 0x78, 0xD8, 0xCC, 0x6B,
-    0x1B, 0xD8, 0x0B, 0xFF, 0xBD, 0xF0, 0x57, 0xC0, 0x0A, 0xE8, 0x90, 0xCB, 0x2C, 0x02, 0x1D, 0x1F,
-    0xDC, 0x02, 0x79, 0x32, 0xE5, 0x30, 0x0D, 0x71, 0xF1, 0xB9, 0xE9, 0xE0, 0xF7, 0x34, 0xA8, 0x95,
-    0x71, 0x38, 0xB0, 0xD8, 0x19, 0x55, 0x01, 0xE4, 0x49, 0x32, 0xDE, 0x6A, 0xC3, 0xF4, 0x3F, 0x7B,
-    0x74, 0x8B, 0x99, 0x6B, 0xBC, 0x05, 0xDA, 0x93, 0x3D, 0xC0, 0x3F, 0x46, 0xC6, 0xAF, 0x57, 0xDF,
-    0x78, 0x67, 0x36, 0x9B, 0x4C, 0x26, 0x2B, 0x2B, 0xD3, 0xA9, 0xD6, 0xD3, 0xC9, 0xDB, 0x8B, 0x2C,
-    0x38, 0xDC, 0xC8, 0xFE, 0x75, 0xD8, 0xF7, 0xFC, 0x6A, 0xFA, 0xE2, 0x55, 0xFA, 0xE2, 0x15, 0x0B,
-    0x8E, 0xE7, 0x57, 0x2B, 0xE1, 0x7C, 0x24, 0x40, 0x1E, 0x55, 0x69, 0x42, 0xA9, 0x15, 0x87, 0x66,
-    0x25, 0x68, 0x31, 0xA0, 0x1A, 0xBA, 0xC6, 0x5F, 0xBF, 0x72, 0xE5, 0xD2, 0x14, 0xBB, 0xD6, 0xC7,
-    0x41, 0x30, 0x34, 0xCA, 0x5F, 0xB7, 0x6B, 0x92, 0xDA, 0x3B, 0xF1, 0x1E, 0xDA, 0xDC, 0x77, 0x0A,
-    0xFA, 0xE1, 0x71, 0x2E, 0x42, 0x18, 0xA3, 0x7E, 0x2C, 0x69, 0xE5, 0x7D, 0xC2, 0xE0, 0x19, 0x50,
-    0x5F, 0xBB, 0x1D, 0x43, 0xDF, 0xCB, 0xEB, 0x0E, 0xD0, 0xF7, 0x7D, 0x84, 0x84, 0xF1, 0xA4, 0xA6,
-    0xA8, 0x47, 0xEE, 0x20, 0xC6, 0xCB, 0xF0, 0xAC, 0x10, 0xED, 0x6F, 0x64, 0x9E, 0x56, 0x9B, 0x71,
-    0x04, 0x4F, 0x46, 0xFF, 0xEF, 0xF2, 0x89, 0xD1, 0x01, 0x44, 0xFB, 0x40, 0xEB, 0xAB, 0x46, 0xE6,
-    0x9D, 0x68, 0xB2, 0xF2, 0x6C, 0x02, 0xFA, 0x60, 0x44, 0x02, 0x66, 0xBB, 0x2C, 0xAE, 0xC5, 0xD0,
-    0x26, 0x4F, 0xAE, 0x49, 0xCC, 0xE8, 0xDB, 0x37, 0x15, 0xC8, 0xD1, 0x83, 0x85, 0x9B, 0x88, 0xFB,
-    0x84, 0x98, 0xB3, 0x4A, 0xA8, 0x35, 0x08, 0x0F, 0xAB, 0x06, 0xD1, 0x03, 0x3A, 0x60, 0x10, 0xC5,
-    0x62, 0x46, 0x53, 0x0A, 0x4B, 0xCB, 0x9F, 0xD7, 0x18, 0x7D, 0xA2, 0xAD, 0x68, 0x92, 0xD8, 0x24,
-    0xDF, 0xA5, 0x3B, 0x59, 0xCD, 0x33, 0x0E, 0xA3, 0x8E, 0x65, 0x89, 0x40, 0x4E, 0x53, 0x13, 0x1D,
-    0x3A, 0x56, 0x36, 0x0B, 0x2C, 0x17, 0x56, 0x42, 0x7D, 0x1C, 0xA7, 0x14, 0x8E, 0xC7, 0x87, 0x6D,
-    0x0C, 0x4D, 0xDC, 0xCE, 0x24, 0xD4, 0x63, 0x39, 0x53, 0xB9, 0xD3, 0x90, 0x41, 0xB1, 0x85, 0xEE,
-    0xA5, 0x13, 0xC8, 0x72, 0x90, 0x2B, 0xFC, 0x3A, 0x8D, 0x48, 0xE2, 0x1A, 0x3B, 0xEE, 0xE2, 0x84,
-    0x2C, 0x08, 0x19, 0xDC, 0x7D, 0x9F, 0xA3, 0xCD, 0xE6, 0x73, 0xFC, 0x18, 0x9F, 0x0C, 0xDD, 0x86,
-    0x24, 0x4E, 0x9E, 0x7D, 0x8B, 0x66, 0x4C, 0xEA, 0x72, 0x03, 0xF2, 0x8D, 0xDD, 0xBC, 0x46, 0xCC,
-    0xD6, 0xE5, 0xFC, 0xFB, 0xDD, 0x7C, 0xC5, 0x45, 0x40, 0x6A, 0x0B, 0x9D, 0x19, 0x31, 0xB3, 0xD4,
-    0xEB, 0xC5, 0xA7, 0x2D, 0x5C, 0xBD, 0x06, 0x5B, 0xAD, 0xC0, 0xBC, 0x89, 0xEB, 0x04, 0xD3, 0x46,
-    0x42, 0xA7, 0x9C, 0x65, 0x26, 0xAE, 0xAB, 0x11, 0x52, 0xB2, 0xBA, 0xD8, 0xF0, 0xB3, 0x55, 0xA9,
-    0xCF, 0xB7, 0xB3, 0xC4, 0x4C, 0x93, 0xBA, 0x4B, 0x6B, 0x30, 0x94, 0x93, 0x3F, 0xB6, 0x0A, 0xEA,
-    0x17, 0x3D, 0x9A, 0x9A, 0x1D, 0x56, 0xA4, 0x14, 0x3D, 0xC5, 0x00, 0x74, 0x49, 0xBB, 0x9D, 0xD6,
-    0x33, 0x99, 0xBB, 0x8C, 0x5A, 0x1D, 0x16, 0xEC, 0x82, 0x54, 0x90, 0x7F, 0xFC, 0xD4, 0x6C, 0xCB,
-    0x7C, 0x06, 0x82, 0x53, 0x57, 0xC1, 0x4B, 0x10, 0x7C, 0x75, 0x34, 0xD7, 0x0D, 0x53, 0x0F, 0x18,
-    0x6D, 0x01, 0x55, 0x6F, 0x82, 0x01, 0x3E, 0x01, 0x75, 0xD6, 0x89, 0x3D, 0x4D, 0x0A, 0xF3, 0x29,
-    0xF0, 0x35, 0x12, 0xBB, 0xF4, 0xD2, 0xCC, 0xDB, 0x9C, 0x03, 0x71, 0xF9, 0x11, 0x78, 0xB2, 0x39,
-    0x0D, 0x36, 0x02, 0xC7, 0xE7, 0x6B, 0x91, 0x01, 0xC5, 0xA0, 0x94, 0xDC, 0x8E, 0x96, 0x8E, 0xAD,
-    0x03, 0xFB, 0x88, 0xBD, 0xA5, 0x85, 0x90, 0x3C, 0x20, 0x56, 0xF5, 0xF1, 0x7E, 0xBE, 0xC6, 0xC0,
-    0x0E, 0xF5, 0x6D, 0xC3, 0x5C, 0x0D, 0x8D, 0x98, 0xFD, 0x05, 0xCF, 0x2E, 0xE2, 0x20, 0x48, 0x2D,
-    0x1D, 0x1F, 0x02, 0xD1, 0x66, 0x75, 0xAE, 0x32, 0xE9, 0x2D, 0xD4, 0x22, 0x85, 0xA1, 0x9F, 0x79,
-    0xB3, 0x8D, 0xDC, 0x48, 0xC0, 0x2E, 0x3E, 0x80, 0x68, 0xD4, 0xAC, 0xF1, 0xDD, 0xDD, 0xF8, 0x33,
-    0xA3, 0x60, 0x7F, 0x92, 0x3C, 0xB1, 0xFA, 0x82, 0xEF, 0x82, 0x84, 0x2E, 0x57, 0xF0, 0x00, 0x5A,
-    0x2B, 0xA6, 0xF3, 0x1D, 0xE4, 0xF4, 0x46, 0x19, 0xB3, 0xB2, 0xAF, 0x49, 0xA3, 0x52, 0x63, 0x4B,
-    0x59, 0xCC, 0xD0, 0xF3, 0xC6, 0x76, 0xF2, 0xBD, 0xFB, 0x66, 0xEA, 0x0B, 0x04, 0xDA, 0x8E, 0xCA,
-    0x08, 0x8C, 0x79, 0xA3, 0xA1, 0xEE, 0x48, 0xAF, 0x23, 0xDD, 0xC9, 0x3F, 0x01, 0xC4, 0x8E, 0xA2,
-    0x21, 0x28, 0x13, 0x8C, 0xE9, 0xE8, 0xD0, 0x52, 0x0F, 0x61, 0x70, 0x8E, 0x9F, 0xD7, 0x58, 0x2E,
-    0xB0, 0x7F, 0xD0, 0x6B, 0x1F, 0xC3, 0x00, 0xA0, 0xE7, 0xF9, 0x71, 0x18, 0xCD, 0x31, 0xD7, 0x0B,
-    0x6B, 0x81, 0xD6, 0xF9, 0xC1, 0x01, 0x0E, 0x53, 0x98, 0x7B, 0xE8, 0x0C, 0x7E, 0x14, 0x01, 0xEF,
-    0xE3, 0xE1, 0xA3, 0xE0, 0x9B, 0xC2, 0x5F, 0xC6, 0xDD, 0xBC, 0x62, 0x5E, 0xC2, 0x33, 0x04, 0x3F,
-    0xA4, 0x84, 0x9D, 0xDB, 0xCC, 0xE4, 0x90, 0xAC, 0x48, 0x24, 0xA4, 0xBC, 0x0A, 0x0F, 0x8A, 0x72,
-    0x7C, 0xA4, 0x0C, 0x4A, 0x12, 0xA4, 0xC8, 0x8A, 0x15, 0x10, 0x94, 0xF9, 0x44, 0x34, 0x10, 0xED,
-    0xC2, 0xA6, 0xE5, 0x84, 0x6C, 0x52, 0xBE, 0x35, 0x7E, 0x40, 0x91, 0x32, 0xCB, 0xE9, 0xF9, 0xA3,
-    0x22, 0xB6, 0xED, 0x70, 0x28, 0x98, 0xA5, 0xBA, 0x1C, 0x21, 0xCA, 0x02, 0x03, 0x25, 0x80, 0x1E,
-    0xFE, 0x21, 0xD1, 0xF1, 0xEF, 0xE9, 0x5F, 0xFE, 0xDA, 0xBD, 0xBE, 0xF1, 0x7F, 0xAD, 0x58, 0x4D,
-    0x8C, 0x1C, 0x47, 0x15, 0x7E, 0x55, 0xE5, 0xB8, 0xC1, 0xED, 0xA4, 0x72, 0x70, 0x08, 0x38, 0x24,
-    0xCD, 0x05, 0x29, 0x41, 0x78, 0xFB, 0xE2, 0x83, 0x0F, 0x33, 0xD3, 0x1D, 0xFB, 0x90, 0x43, 0x90,
-    0xEC, 0x43, 0xB8, 0x90, 0x0B, 0x87, 0x1C, 0x7C, 0x40, 0x72, 0x0E, 0x91, 0x30, 0x62, 0xBD, 0xD3,
-    0x76, 0x0E, 0x96, 0xB0, 0x44, 0x16, 0x09, 0x6E, 0x48, 0x2C, 0xB0, 0x48, 0xC1, 0x48, 0xC4, 0x42,
-    0x39, 0xEC, 0x61, 0xD6, 0x53, 0xF6, 0x1E, 0x7C, 0x88, 0x90, 0x2B, 0x5E, 0x44, 0x0E, 0x88, 0xA4,
-    0x9D, 0x10, 0x45, 0x71, 0x00, 0x57, 0xEC, 0x76, 0xDC, 0x66, 0xBB, 0xA7, 0xF8, 0x5E, 0xF5, 0xCC,
-    0x7A, 0x37, 0x3F, 0x04, 0x48, 0x5A, 0x96, 0xE7, 0x67, 0xAB, 0xDE, 0xCF, 0xF7, 0xDE, 0xFB, 0xDE,
-    0x7B, 0x43, 0x67, 0x69, 0x68, 0x12, 0x1B, 0x3B, 0x59, 0xD3, 0xE6, 0xF3, 0x2C, 0x8D, 0x68, 0x40,
-    0x49, 0x1E, 0x19, 0xE9, 0xA8, 0xA6, 0x3E, 0x69, 0x8A, 0x8C, 0x28, 0x69, 0x31, 0xFC, 0x55, 0xE5,
-    0x38, 0x10, 0x91, 0x6C, 0xA5, 0xB7, 0xC3, 0x3F, 0xE9, 0x9F, 0x8B, 0x1B, 0x26, 0x3D, 0x20, 0x6F,
-    0x17, 0x89, 0xA7, 0x61, 0x49, 0x4B, 0x74, 0x1F, 0x51, 0xDE, 0xC9, 0x19, 0xE7, 0xD2, 0x57, 0xA2,
-    0xFA, 0x0A, 0x3D, 0x47, 0xF4, 0x30, 0x51, 0x54, 0x50, 0xE2, 0xCB, 0xD8, 0xD7, 0x94, 0x10, 0xC5,
-    0x86, 0x52, 0x4B, 0x99, 0x5F, 0xD2, 0xBE, 0x95, 0x67, 0xCF, 0x86, 0x1B, 0xC5, 0x01, 0xE5, 0x1B,
-    0xE5, 0x2B, 0xF5, 0xA6, 0x8B, 0xD7, 0x9C, 0xF6, 0x36, 0xF3, 0x2E, 0xF3, 0xE5, 0x1E, 0x91, 0x2B,
-    0x27, 0x5D, 0x5C, 0x66, 0xA4, 0xD7, 0x1D, 0xA5, 0x9E, 0x68, 0xE8, 0x88, 0xF0, 0x22, 0x7D, 0x4E,
-    0x7E, 0x42, 0x1A, 0x6F, 0x05, 0xEC, 0x8F, 0x5B, 0x52, 0x90, 0x9E, 0x35, 0xD0, 0x55, 0x12, 0xA5,
-    0x53, 0x33, 0x9E, 0x55, 0xE6, 0x5E, 0x3A, 0xA7, 0xCC, 0x0E, 0xFE, 0xB0, 0x8B, 0x9E, 0x93, 0x46,
-    0xD3, 0x7E, 0x69, 0xEE, 0xE1, 0x8F, 0xE7, 0x89, 0x8F, 0xC7, 0x07, 0x73, 0xBA, 0x43, 0x94, 0xB4,
-    0xA4, 0xAF, 0x3B, 0x51, 0xC6, 0x34, 0xF7, 0x6D, 0x27, 0x7D, 0x4B, 0x11, 0xEB, 0x70, 0xB4, 0x3C,
-    0x07, 0xA5, 0x46, 0x8C, 0x17, 0x69, 0xEF, 0xAE, 0xC3, 0x97, 0xDE, 0xB9, 0xF1, 0x41, 0xD3, 0x8A,
-    0x96, 0x7E, 0x70, 0x4E, 0xFF, 0xFA, 0x94, 0xDB, 0x9F, 0xBE, 0x22, 0xDE, 0xB3, 0xAC, 0x8E, 0xCE,
-    0x3F, 0xBA, 0x7E, 0xEF, 0x0F, 0xD7, 0xFE, 0xCE, 0x62, 0xBF, 0x20, 0xE9, 0xF8, 0xC3, 0xD2, 0x8D,
-    0xF4, 0x69, 0x3B, 0xD0, 0x45, 0x76, 0xD8, 0xE8, 0x35, 0x17, 0x9D, 0xB4, 0x92, 0x8A, 0xF4, 0xDD,
-    0x43, 0xBE, 0xFD, 0xD2, 0x4B, 0x06, 0x10, 0xEB, 0x82, 0x96, 0x53, 0xFF, 0x16, 0xFC, 0xAF, 0xD5,
-    0xC6, 0xC5, 0xB7, 0x9F, 0xBD, 0xFE, 0xD5, 0xFE, 0xEB, 0x7A, 0xCC, 0x26, 0xC1, 0x92, 0x6F, 0xFC,
-    0x06, 0x2F, 0x0F, 0x59, 0x58, 0x50, 0xAD, 0xA4, 0xFA, 0xE0, 0x86, 0x83, 0x71, 0x0B, 0xF8, 0x6A,
-    0x89, 0x68, 0x85, 0x10, 0x92, 0xD8, 0x37, 0xF2, 0xA5, 0x77, 0x49, 0x59, 0x12, 0x6E, 0x1A, 0xB6,
-    0x9D, 0xDE, 0x45, 0xBE, 0xE1, 0x77, 0xC9, 0xC9, 0x6F, 0x09, 0xF3, 0x5C, 0x3F, 0xAE, 0x08, 0x4A,
-    0x76, 0x8B, 0x0B, 0x95, 0x3A, 0xE3, 0x9E, 0x21, 0xA1, 0xD6, 0xAE, 0x94, 0x34, 0xAF, 0xCA, 0xB8,
-    0xE8, 0x53, 0x15, 0x03, 0x85, 0x46, 0xBA, 0xA4, 0xC8, 0x54, 0x15, 0x79, 0x4F, 0x63, 0xEF, 0xF4,
-    0x78, 0x22, 0x2D, 0x51, 0x6F, 0x2A, 0x2F, 0xBD, 0x9C, 0x67, 0x6F, 0x99, 0xF4, 0x96, 0xD3, 0xCD,
-    0x8A, 0x9A, 0xF4, 0x69, 0x78, 0x98, 0xF4, 0x25, 0x13, 0xBD, 0x59, 0xAA, 0xAA, 0x12, 0x4D, 0x8F,
-    0x26, 0x09, 0x0D, 0x9F, 0x2C, 0xB2, 0x35, 0xAB, 0x4B, 0x27, 0x8E, 0xEC, 0x21, 0x7D, 0x66, 0xFD,
-    0xD6, 0x8B, 0x82, 0xCE, 0xE9, 0xC7, 0xE7, 0xB3, 0x53, 0x8B, 0x3B, 0x95, 0x59, 0xDA, 0xBF, 0x3B,
-    0xBD, 0x70, 0x04, 0x82, 0xE4, 0x8F, 0x76, 0x1F, 0xC8, 0xCC, 0x2A, 0x0B, 0xFD, 0xDA, 0x0E, 0xEA,
-    0xDD, 0x47, 0xC9, 0x13, 0x56, 0xBA, 0x9A, 0xEA, 0x81, 0xAC, 0xCF, 0xAB, 0xF7, 0x6B, 0x65, 0x9C,
-    0xC8, 0x73, 0xBA, 0x9F, 0x95, 0x52, 0x80, 0x3C, 0x32, 0x48, 0x23, 0x27, 0x2C, 0x8C, 0xE9, 0x91,
-    0xCE, 0x95, 0x91, 0xA5, 0xF2, 0xF9, 0x68, 0x7F, 0xE6, 0x12, 0x8D, 0xE8, 0xAE, 0xC1, 0xE7, 0xEA,
-    0x0D, 0xA2, 0xC1, 0x81, 0x92, 0xF4, 0x65, 0x9F, 0x4B, 0x37, 0x76, 0x40, 0xB4, 0xC7, 0x49, 0x5B,
-    0x88, 0x23, 0xAC, 0x88, 0x85, 0x21, 0xC9, 0x04, 0x4B, 0x9C, 0xA7, 0x03, 0xA4, 0x4C, 0x90, 0xA6,
-    0x19, 0xB2, 0x1E, 0xD2, 0x5B, 0xB7, 0xB2, 0x3C, 0x92, 0xB9, 0x34, 0xAD, 0x80, 0xE0, 0x4F, 0x4A,
-    0xBE, 0x99, 0x53, 0x85, 0xA3, 0xBA, 0xC0, 0xB5, 0x46, 0x20, 0x2B, 0x8C, 0x6E, 0x21, 0x74, 0xDC,
-    0xE1, 0x2B, 0x5B, 0xFC, 0xF7, 0xF5, 0x73, 0x7C, 0x00, 0xF9, 0x9B, 0x1A, 0x65, 0x54, 0x43, 0x8E,
-    0x0E, 0x99, 0x3E, 0xA5, 0xB5, 0x3E, 0x74, 0xC8, 0xAB, 0x12, 0x07, 0x57, 0x32, 0xB8, 0xB0, 0xBB,
-    0xA4, 0x78, 0xED, 0xF7, 0x10, 0xEB, 0x2B, 0x3A, 0x71, 0xCF, 0x42, 0xA8, 0xA4, 0xCE, 0x28, 0x9A,
-    0x10, 0x35, 0xE1, 0xDF, 0xF2, 0xAC, 0xD8, 0x16, 0x49, 0x5B, 0x4A, 0x50, 0x0D, 0x05, 0xF9, 0x3C,
-    0x6A, 0xF9, 0x53, 0xCA, 0x01, 0xE6, 0x30, 0xCC, 0x53, 0xDE, 0x8F, 0x2C, 0x72, 0x2F, 0xBA, 0xD3,
-    0x1D, 0x9E, 0x47, 0xF9, 0x41, 0x0B, 0xCE, 0x4C, 0x1F, 0x40, 0x45, 0x43, 0x7C, 0x51, 0x85, 0x5A,
-    0x98, 0xAF, 0x49, 0xBF, 0x50, 0x48, 0xD7, 0xD0, 0x82, 0x36, 0xDA, 0x34, 0xD2, 0x7B, 0x33, 0xF4,
-    0xAD, 0xF6, 0x7E, 0xBD, 0xA6, 0xC9, 0x90, 0x34, 0xA7, 0xE9, 0x1E, 0xDC, 0x32, 0x44, 0x8F, 0xE0,
-    0xAD, 0xA3, 0x0F, 0x3F, 0x50, 0x0D, 0xCF, 0x59, 0x1E, 0x8D, 0x2D, 0x45, 0x97, 0x0B, 0x1A, 0x0C,
-    0x88, 0x05, 0x26, 0xCF, 0x3B, 0x6A, 0xB4, 0x89, 0x91, 0x29, 0x90, 0xA8, 0xBC, 0xAF, 0xB2, 0x42,
-    0x5F, 0x6D, 0x28, 0x2B, 0x3A, 0x3B, 0x20, 0x99, 0xA5, 0x7B, 0x47, 0xF1, 0x49, 0xB7, 0x69, 0x1A,
-    0xFC, 0x82, 0x57, 0x5C, 0x98, 0x6C, 0x9B, 0x7A, 0xAB, 0xA4, 0x54, 0x1B, 0x51, 0xA3, 0x90, 0x4D,
-    0xC3, 0x19, 0x87, 0xC4, 0x43, 0x91, 0xFB, 0x43, 0xB0, 0x2E, 0x31, 0x0A, 0x25, 0x9C, 0x7C, 0x93,
-    0xA8, 0x05, 0x7C, 0x59, 0x4E, 0x5F, 0x7E, 0xB4, 0x33, 0x69, 0x84, 0x78, 0x43, 0x54, 0x66, 0x83,
-    0x8B, 0xC9, 0x80, 0xA8, 0xAE, 0x81, 0xAF, 0x63, 0x1F, 0x95, 0xCB, 0x50, 0x9A, 0x8D, 0x80, 0x39,
-    0x70, 0xD2, 0x4E, 0x28, 0x3B, 0xED, 0x18, 0x63, 0x7A, 0x6C, 0x2F, 0xD1, 0x2A, 0x62, 0xD1, 0x2C,
-    0xC0, 0x9F, 0xC9, 0x36, 0xFF, 0x18, 0x2F, 0x36, 0x8A, 0xA5, 0xB1, 0x83, 0x40, 0x8C, 0xAD, 0x62,
-    0x71, 0xEC, 0x21, 0x63, 0xC6, 0x66, 0xB1, 0x3C, 0xB8, 0x58, 0x76, 0xA8, 0x21, 0x69, 0x28, 0x33,
-    0x21, 0x7E, 0xEC, 0xEA, 0x16, 0xF4, 0xFF, 0x67, 0x17, 0xC5, 0xEF, 0x3C, 0x5F, 0xF3, 0x1E, 0xC8,
-    0xF9, 0x6B, 0x4F, 0x51, 0xA0, 0x2F, 0x48, 0x66, 0x02, 0x8E, 0x5F, 0x79, 0x1B, 0x05, 0x7E, 0x22,
-    0xC3, 0xDF, 0xA2, 0x12, 0x04, 0x44, 0x19, 0xBB, 0x0E, 0xB4, 0xA1, 0x04, 0x42, 0xCE, 0x16, 0xB0,
-    0x0E, 0x11, 0x48, 0x0D, 0x3B, 0xDD, 0x90, 0xF7, 0xDB, 0x22, 0x28, 0xC6, 0x25, 0x82, 0x53, 0x80,
-    0x1A, 0x68, 0xBC, 0x78, 0x7F, 0x84, 0x18, 0x02, 0x46, 0xD9, 0x74, 0x91, 0x41, 0xA0, 0x84, 0xCF,
-    0xBF, 0xCB, 0xB2, 0x34, 0x38, 0x33, 0x41, 0x6E, 0xA6, 0xDE, 0x92, 0x2A, 0x3A, 0xA2, 0xFC, 0x47,
-    0xC7, 0x99, 0xA4, 0xF0, 0x5F, 0x52, 0x04, 0x62, 0x9C, 0xB1, 0x4A, 0x4B, 0x7C, 0xE7, 0xDD, 0x23,
-    0xEC, 0x2D, 0x20, 0x55, 0xB7, 0x96, 0xA0, 0x05, 0x04, 0x54, 0x72, 0x1E, 0xE3, 0xAC, 0x9C, 0x9C,
-    0x85, 0x71, 0x33, 0x12, 0x61, 0x19, 0x26, 0xA4, 0xD6, 0x1C, 0x2C, 0xCA, 0x3F, 0x94, 0x5F, 0xC7,
-    0x18, 0xD8, 0x86, 0x26, 0x3F, 0xE3, 0x48, 0x70, 0x2A, 0x67, 0xDF, 0x01, 0xCB, 0x3A, 0x1A, 0x83,
-    0xC5, 0x4D, 0x20, 0xF1, 0xF4, 0xDA, 0x12, 0x6C, 0xCC, 0x87, 0xDE, 0x71, 0xAE, 0x05, 0xFB, 0x60,
-    0x4B, 0xD2, 0x90, 0x7A, 0xB5, 0xFA, 0xFF, 0xA5, 0x5C, 0x75, 0x94, 0xBC, 0x60, 0xA8, 0x1D, 0x92,
-    0xFC, 0xE5, 0x8B, 0x5B, 0x5D, 0x43, 0x8B, 0x61, 0x39, 0xB1, 0x09, 0xBE, 0x51, 0x7B, 0x34, 0x08,
-    0x4A, 0x11, 0x80, 0x59, 0x17, 0xB9, 0xB6, 0x04, 0xFF, 0x2D, 0x7B, 0x07, 0xD0, 0x49, 0x54, 0x14,
-    0xDB, 0xCD, 0xD6, 0xC2, 0xA5, 0x8C, 0x68, 0x03, 0x4A, 0x36, 0x63, 0x40, 0x91, 0x65, 0x5E, 0x37,
-    0x68, 0x9A, 0x69, 0xA1, 0x2A, 0x64, 0x1A, 0x87, 0x8F, 0x8E, 0x10, 0xA8, 0xA5, 0x17, 0x72, 0x68,
-    0xEB, 0x83, 0x1B, 0x38, 0x7A, 0x82, 0xB3, 0x08, 0xAF, 0x83, 0x20, 0xDA, 0xB0, 0x15, 0x48, 0xEF,
-    0x12, 0xA1, 0x43, 0x80, 0xA3, 0x2E, 0xBE, 0x11, 0xBE, 0x2E, 0xE4, 0x86, 0x49, 0x66, 0x22, 0x38,
-    0xB3, 0x59, 0x59, 0xCA, 0xAF, 0x8A, 0xC9, 0x0B, 0x7A, 0x59, 0x5E, 0x01, 0xB0, 0xA0, 0x18, 0x49,
-    0xC9, 0x59, 0xBE, 0x7C, 0x54, 0xD4, 0x8D, 0xAA, 0x1A, 0xF5, 0x41, 0x73, 0x57, 0x6D, 0xE0, 0x1F,
-    0xE8, 0x82, 0x5A, 0xDC, 0xC0, 0x65, 0xC8, 0x81, 0x5E, 0x98, 0x80, 0xDB, 0x60, 0x21, 0xE4, 0xCC,
-    0xB0, 0x2B, 0x12, 0x4E, 0xC3, 0x04, 0x18, 0x01, 0x42, 0x54, 0x9A, 0x02, 0xE9, 0xC3, 0xCA, 0x55,
-    0xD2, 0x4F, 0xFA, 0x26, 0x5A, 0xF7, 0x13, 0xE9, 0xA2, 0x52, 0xD4, 0xB2, 0x8A, 0x38, 0x41, 0x3C,
-    0xE7, 0x27, 0x67, 0x75, 0x1E, 0xFB, 0x40, 0x56, 0x73, 0x07, 0x20, 0x04, 0x11, 0xFB, 0xC3, 0xDD,
-    0x72, 0x79, 0x00, 0xD7, 0x87, 0x70, 0x78, 0x9C, 0x8F, 0xC8, 0x17, 0xA8, 0xDA, 0x0B, 0x95, 0xF4,
-    0x17, 0x9D, 0xDA, 0x40, 0x73, 0xBC, 0xFD, 0x9A, 0xD5, 0xEF, 0xBC, 0x67, 0xF4, 0xBA, 0x37, 0xE9,
-    0x9A, 0xCF, 0xB3, 0x35, 0x08, 0x3C, 0x85, 0x84, 0x7A, 0x7C, 0xD2, 0xD1, 0x1E, 0xDB, 0x17, 0x6C,
-    0xBF, 0x9B, 0x4A, 0x7F, 0x43, 0xFD, 0xC0, 0x42, 0xFF, 0x74, 0x45, 0x2D, 0xE4, 0x82, 0x3A, 0xCD,
-    0x00, 0x2E, 0x21, 0x36, 0x35, 0x0E, 0xAF, 0xC2, 0xB9, 0x4C, 0x4C, 0xC4, 0xB8, 0x18, 0x76, 0xD5,
-    0x5C, 0xA2, 0x76, 0x4A, 0x7A, 0xC8, 0x17, 0x33, 0x01, 0x20, 0x42, 0x02, 0xDD, 0x04, 0x26, 0xD4,
-    0xF4, 0xD1, 0x87, 0x1B, 0xBE, 0x42, 0xA9, 0xA8, 0xF6, 0x98, 0x65, 0xE7, 0x81, 0x6B, 0x86, 0xD8,
-    0x68, 0x34, 0x32, 0x85, 0x59, 0x44, 0x56, 0x4C, 0x18, 0x51, 0xBD, 0x73, 0x02, 0xFA, 0x81, 0xC5,
-    0x9E, 0x2B, 0x0F, 0xD2, 0x8F, 0x4D, 0xB6, 0x0A, 0x99, 0xA3, 0xAE, 0xFC, 0xB8, 0xC8, 0x67, 0xCC,
-    0x48, 0x0F, 0xDD, 0x61, 0x70, 0x11, 0xE3, 0x3F, 0x23, 0x01, 0xF3, 0xC4, 0x64, 0x18, 0x70, 0x00,
-    0x7E, 0x83, 0xCC, 0x1A, 0xC0, 0xEC, 0x34, 0xE7, 0xAC, 0x1A, 0x16, 0xC7, 0x4A, 0xE0, 0x59, 0x21,
-    0x8F, 0x6B, 0x14, 0x56, 0x8D, 0x74, 0xDD, 0x84, 0xF2, 0x11, 0xD8, 0xAD, 0x5F, 0xA7, 0xC0, 0x93,
-    0xE2, 0x54, 0xFE, 0xF9, 0x00, 0xC2, 0x9C, 0x99, 0x1E, 0x46, 0x1A, 0x5C, 0x42, 0x4E, 0xDC, 0xDC,
-    0x32, 0x0F, 0x7E, 0x46, 0x73, 0x31, 0xCE, 0x61, 0x8C, 0xD1, 0x28, 0x4F, 0xAB, 0xAF, 0x9B, 0xA7,
-    0x1E, 0x98, 0xD5, 0xCE, 0xDE, 0xA9, 0xE2, 0x78, 0x8A, 0x8A, 0x9C, 0x45, 0x77, 0x3C, 0x23, 0x6B,
-    0xF3, 0x09, 0x07, 0x86, 0xD3, 0xF8, 0xBC, 0xD4, 0x95, 0x03, 0xB4, 0x76, 0x55, 0xF1, 0x5A, 0x07,
-    0xBD, 0xB6, 0xE3, 0xA0, 0x5A, 0x55, 0x69, 0xA0, 0x56, 0x1A, 0xC4, 0xB7, 0x83, 0x88, 0xF8, 0x4A,
-    0x3B, 0xE8, 0x6A, 0x60, 0x1C, 0x87, 0xAB, 0xDA, 0x9B, 0x20, 0x53, 0xF8, 0x5B, 0xE3, 0x60, 0x4D,
-    0x32, 0x93, 0xE5, 0x7D, 0x27, 0x2B, 0xF3, 0x1D, 0x3E, 0x7A, 0xFA, 0xAA, 0x66, 0xD1, 0x9D, 0xC1,
-    0x96, 0x4E, 0xBD, 0x8C, 0xA7, 0x80, 0xC9, 0xD9, 0x81, 0xF3, 0x53, 0x3F, 0x1F, 0xFB, 0x68, 0x66,
-    0xF1, 0x51, 0x1E, 0xE6, 0xD2, 0x62, 0xDB, 0xD7, 0x13, 0x9A, 0xA0, 0xC4, 0x5A, 0x09, 0x6A, 0x57,
-    0xB5, 0x44, 0xBE, 0x61, 0x32, 0x73, 0x0A, 0x83, 0x6F, 0xE4, 0xB4, 0x8D, 0x2D, 0xB7, 0x74, 0x6D,
-    0x52, 0xC3, 0x45, 0x96, 0x84, 0x62, 0xE3, 0xD2, 0xDC, 0x24, 0x45, 0x0C, 0x18, 0xA2, 0xEC, 0xC8,
-    0x57, 0xE7, 0xF4, 0x71, 0xCF, 0x67, 0x93, 0xDF, 0xCD, 0x0B, 0x1C, 0x83, 0xE8, 0x7A, 0x4E, 0x7A,
-    0x4B, 0x1B, 0xFC, 0x4C, 0x72, 0x8F, 0xA2, 0xCD, 0xD7, 0xAB, 0x24, 0x6B, 0x10, 0xD9, 0xAD, 0xE6,
-    0xF3, 0xB3, 0x77, 0x4F, 0x28, 0x6E, 0x94, 0x5F, 0xF2, 0x71, 0x50, 0x60, 0x74, 0xB8, 0x51, 0xC9,
-    0x6A, 0x41, 0xD4, 0x89, 0x69, 0x14, 0xE6, 0x9B, 0xB6, 0xA5, 0x74, 0xC2, 0x03, 0xBF, 0xF0, 0xA1,
-    0x6D, 0x82, 0x41, 0x91, 0x76, 0xE8, 0xD7, 0xA2, 0x0D, 0xD8, 0x02, 0x56, 0xA0, 0x3A, 0xB4, 0xD2,
-    0x97, 0xFA, 0x09, 0xD3, 0xD3, 0xA2, 0x6C, 0xE2, 0xEB, 0x26, 0x6B, 0xC4, 0x84, 0xE2, 0x82, 0x67,
-    0xB5, 0x25, 0xE6, 0x69, 0xB0, 0x03, 0x58, 0xC0, 0x38, 0xF5, 0xEA, 0x48, 0xBC, 0xDF, 0xD2, 0x0A,
-    0x7A, 0x02, 0x66, 0xD2, 0xC3, 0x45, 0x7C, 0xB1, 0x46, 0x1D, 0x8A, 0x26, 0x32, 0x63, 0x5E, 0x69,
-    0xDC, 0x3D, 0x4F, 0x2F, 0x06, 0x12, 0xCF, 0x66, 0xB9, 0x4C, 0x62, 0x52, 0xA6, 0xFE, 0xA4, 0x3B,
-    0xA1, 0xA9, 0x7A, 0x59, 0xAD, 0x99, 0x21, 0xFA, 0x5B, 0xEA, 0xCB, 0xF4, 0x8D, 0x3C, 0xB8, 0x71,
-    0x9C, 0xB1, 0x9F, 0x8E, 0x90, 0xB3, 0x67, 0xB8, 0x22, 0x7D, 0x1D, 0x5D, 0xA8, 0x70, 0x63, 0x1F,
-    0xB9, 0x5E, 0xC4, 0x72, 0x71, 0x25, 0xBE, 0xCD, 0xF3, 0x2D, 0x8B, 0xF5, 0x56, 0x95, 0x2B, 0x9F,
-    0x7E, 0x78, 0xE7, 0x17, 0x29, 0xF9, 0x23, 0xED, 0x6B, 0xA8, 0xF7, 0x5F, 0x1C, 0x4E, 0x75, 0xA1,
-    0x5F, 0xB1, 0xD1, 0xCD, 0x4A, 0x2E, 0xCF, 0xDA, 0x68, 0xB4, 0x01, 0xDE, 0x2B, 0x71, 0x5C, 0x99,
-    0xBE, 0xB4, 0x9A, 0x1C, 0x08, 0x82, 0xDB, 0x2E, 0x58, 0xE0, 0x04, 0xF1, 0x2E, 0x88, 0x52, 0xFB,
-    0x3E, 0x37, 0x33, 0x39, 0x6D, 0x5E, 0xC9, 0x3F, 0x21, 0x3E, 0x89, 0xAC, 0xD3, 0x4F, 0xE6, 0x3D,
-    0x48, 0xF7, 0xFE, 0x22, 0x9A, 0x49, 0x5B, 0x4D, 0xA5, 0xFD, 0x85, 0x79, 0xC9, 0x9B, 0xF9, 0xA4,
-    0xFA, 0x9E, 0x46, 0x19, 0x5E, 0xB1, 0xFA, 0xDA, 0x72, 0x0F, 0xC3, 0x0C, 0x88, 0xC5, 0xA3, 0xA0,
-    0x79, 0xCA, 0x58, 0xF0, 0x8B, 0x61, 0x22, 0x17, 0xDE, 0x2E, 0xA0, 0x6B, 0x61, 0x03, 0x4A, 0x49,
-    0xDE, 0x59, 0x0C, 0x1B, 0x28, 0x3E, 0x3C, 0x98, 0xA3, 0x6F, 0x1E, 0x0D, 0x65, 0x00, 0xDD, 0xB2,
-    0xDA, 0x3E, 0xE1, 0x5A, 0x31, 0xA9, 0xA2, 0xAB, 0xC7, 0x35, 0x6C, 0x38, 0xFB, 0xD3, 0x94, 0xEE,
-    0x4F, 0xB1, 0xF8, 0x30, 0x17, 0x02, 0x69, 0xAC, 0x84, 0xE8, 0xD4, 0x08, 0xF5, 0x87, 0x5B, 0x35,
-    0xCD, 0x56, 0x80, 0x68, 0xC3, 0xE2, 0x2E, 0xBA, 0x82, 0xF8, 0xD7, 0x6F, 0xD1, 0xC5, 0x72, 0x5C,
-    0xE6, 0x95, 0x33, 0xAD, 0x66, 0x7D, 0x1A, 0x4B, 0x01, 0x1A, 0xB5, 0x70, 0xFB, 0xB6, 0xA9, 0xA4,
-    0xE1, 0x2A, 0x2D, 0x3C, 0x58, 0x80, 0x44, 0xA1, 0x33, 0x36, 0x3B, 0x64, 0xE8, 0x97, 0x45, 0x50,
-    0xBA, 0xEB, 0x60, 0x21, 0xEA, 0x11, 0x33, 0xEF, 0xB6, 0x36, 0x3D, 0xBB, 0x99, 0x5C, 0xCF, 0xA1,
-    0x91, 0x89, 0x1D, 0x57, 0xA5, 0xC3, 0x3E, 0x83, 0xF9, 0x04, 0xE4, 0xC4, 0x77, 0x63, 0xB4, 0xE5,
-    0xAE, 0x27, 0x8A, 0x52, 0x59, 0x65, 0x22, 0x13, 0x17, 0x3A, 0x4F, 0x90, 0x56, 0x19, 0xCF, 0x5E,
-    0xBC, 0x35, 0x89, 0xBB, 0x13, 0x22, 0xD8, 0xA1, 0xE2, 0x15, 0x09, 0x09, 0xAB, 0xAC, 0xE0, 0x8B,
-    0x59, 0xF8, 0x7E, 0x1F, 0x01, 0xDD, 0x8D, 0x72, 0x2E, 0x62, 0xBA, 0x3D, 0xCE, 0xA8, 0x61, 0x58,
-    0xE2, 0x31, 0xB7, 0xCF, 0x0E, 0x31, 0xB7, 0x53, 0x74, 0xC9, 0x34, 0x4D, 0xF2, 0x8B, 0x8E, 0xAE,
-    0x1E, 0xE9, 0x56, 0x28, 0xFC, 0x6D, 0x05, 0x87, 0x21, 0x28, 0x0B, 0x33, 0x58, 0x78, 0xFA, 0x53,
-    0xFA, 0x86, 0x10, 0xDE, 0x45, 0x79, 0x14, 0x45, 0x0D, 0x0A, 0xDF, 0x0B, 0x6F, 0x93, 0xE7, 0xD1,
-    0x42, 0x31, 0x77, 0xF4, 0x31, 0x75, 0x2C, 0x60, 0xE6, 0x18, 0xC2, 0x87, 0x0C, 0x7C, 0xC9, 0x8B,
-    0x2A, 0xC9, 0xF5, 0x5C, 0xB6, 0x96, 0x6E, 0x3A, 0x7A, 0xF4, 0x99, 0x59, 0xF3, 0xE4, 0xDD, 0xBE,
-    0x8C, 0xAA, 0x11, 0xF6, 0x54, 0xAA, 0x74, 0x31, 0xAF, 0x2C, 0xAE, 0x63, 0xB0, 0x8E, 0x31, 0x96,
-    0x73, 0x6D, 0xB3, 0x69, 0xEE, 0x6E, 0x60, 0x91, 0xB5, 0xE5, 0x48, 0xE7, 0xF3, 0x09, 0xD5, 0xE9,
-    0xD3, 0x55, 0x82, 0x52, 0xF5, 0x46, 0xF2, 0x34, 0xB2, 0x23, 0xAC, 0x53, 0x2F, 0x07, 0x82, 0xDC,
-    0x9E, 0x0B, 0x9F, 0x78, 0x25, 0xF8, 0x32, 0xCC, 0x01, 0x8C, 0xB2, 0xA3, 0x4F, 0x39, 0x1C, 0xFF,
-    0x98, 0x92, 0xBF, 0x52, 0xAF, 0x99, 0x5A, 0xFE, 0x1F, 0x4E, 0xEE, 0xDD, 0x95, 0xA3, 0xBD, 0x72,
-    0xFD, 0x34, 0xED, 0x96, 0xAC, 0x82, 0x93, 0xE5, 0x48, 0xD9, 0x44, 0xA0, 0xAF, 0xAE, 0x1E, 0xB3,
-    0x38, 0xAF, 0x78, 0x0A, 0x45, 0x96, 0xEF, 0xCA, 0x79, 0x3E, 0xC3, 0xE8, 0x21, 0x42, 0x9C, 0x31,
-    0x86, 0xAE, 0x61, 0xEA, 0xCF, 0xBB, 0x5F, 0x02, 0x46, 0x81, 0x41, 0x66, 0x6D, 0x92, 0xBA, 0xC5,
-    0x2E, 0xC4, 0x20, 0xB0, 0x73, 0x18, 0x6A, 0x56, 0xA6, 0x03, 0x39, 0x71, 0xE7, 0x0B, 0xD9, 0xC0,
-    0xDD, 0x21, 0x6E, 0xF8, 0xD7, 0x13, 0x5E, 0xB8, 0xF8, 0xA7, 0x94, 0x3B, 0x1B, 0xC0, 0xF1, 0x32,
-    0x20, 0x4D, 0x27, 0xBC, 0xF8, 0xF1, 0xB6, 0xE1, 0x9B, 0xEE, 0xE7, 0x95, 0xAE, 0x97, 0xB0, 0xEE,
-    0xC8, 0x76, 0x83, 0x27, 0xCF, 0x8E, 0xD3, 0x71, 0x6C, 0xD4, 0xFD, 0x1C, 0xD4, 0x2D, 0xDB, 0x41,
-    0x55, 0x33, 0xB5, 0x13, 0x33, 0x9B, 0x7A, 0xB3, 0x44, 0x81, 0x8F, 0x7A, 0xCA, 0xB9, 0xE4, 0xB4,
-    0x69, 0x13, 0xEF, 0x86, 0xDE, 0x8C, 0x27, 0xE1, 0x34, 0x0C, 0xEA, 0x6F, 0x5D, 0xA4, 0x98, 0xA5,
-    0xEB, 0x15, 0x75, 0xC5, 0xA6, 0x9A, 0x9A, 0x5E, 0x74, 0xD5, 0x65, 0x4F, 0xF8, 0x26, 0x61, 0xD6,
-    0x29, 0x3A, 0xF3, 0x13, 0x8B, 0x40, 0xE8, 0x83, 0x25, 0xBB, 0xA0, 0xCF, 0x14, 0xFD, 0x7D, 0xD2,
-    0x39, 0xBD, 0x66, 0x16, 0x12, 0x55, 0x0D, 0xFD, 0x05, 0xEF, 0x83, 0x2F, 0xA3, 0x01, 0x35, 0xAB,
-    0xA2, 0x69, 0x37, 0xB9, 0x09, 0x42, 0xE7, 0xC0, 0x61, 0xD2, 0xC1, 0x88, 0x5E, 0x54, 0xCE, 0x6B,
-    0x3B, 0xE4, 0x85, 0xD8, 0x04, 0xB1, 0x9C, 0x0B, 0x8C, 0xD0, 0xCB, 0x1F, 0xB3, 0xA6, 0x6C, 0xB6,
-    0x89, 0x22, 0xC5, 0xCC, 0xE4, 0x68, 0xA4, 0x43, 0x8D, 0xAA, 0x9B, 0x36, 0x0C, 0x72, 0x29, 0x6F,
-    0xDD, 0x45, 0x80, 0x85, 0x51, 0x01, 0x70, 0x63, 0xF4, 0x0A, 0xA0, 0x15, 0x16, 0xEC, 0x11, 0x0F,
-    0xD5, 0xD3, 0x66, 0x61, 0xF5, 0x0B, 0xA6, 0xAF, 0x85, 0xEB, 0xC5, 0x17, 0xCB, 0x41, 0x92, 0x7F,
-    0x50, 0x47, 0xBE, 0x00, 0x59, 0xD4, 0x5C, 0x42, 0x49, 0x07, 0x20, 0x3F, 0xD5, 0x08, 0x34, 0x85,
-    0x06, 0x78, 0x03, 0x63, 0xD3, 0xAF, 0x96, 0x3F, 0x3A, 0x2F, 0xA0, 0x66, 0xD0, 0x3B, 0xD8, 0x0C,
-    0x5A, 0xC0, 0xCC, 0x9F, 0xF5, 0xC3, 0xCF, 0x56, 0xC1, 0x8E, 0xA4, 0xEC, 0x82, 0x81, 0x15, 0x80,
-    0x0D, 0x49, 0xF1, 0x75, 0x56, 0x85, 0x75, 0x8F, 0xFE, 0x0D, 0xAD, 0x59, 0x3D, 0x8C, 0x1D, 0xD7,
-    0x75, 0x3E, 0x77, 0x46, 0xBB, 0x03, 0x6B, 0x80, 0x5C, 0x22, 0x08, 0x13, 0x83, 0x84, 0x77, 0x5C,
-    0xB8, 0x70, 0x9C, 0x70, 0xA7, 0x71, 0xE1, 0xC0, 0xBB, 0x3B, 0xA3, 0xB8, 0x30, 0x60, 0x15, 0x61,
-    0x41, 0x05, 0x41, 0x02, 0xA4, 0x76, 0x52, 0x64, 0x53, 0xA8, 0x60, 0xF1, 0x76, 0x67, 0x68, 0x97,
-    0x6E, 0x58, 0x38, 0x85, 0xE1, 0xC2, 0xEB, 0x40, 0x06, 0x22, 0x31, 0x00, 0x5D, 0xB0, 0xD8, 0x62,
-    0xC9, 0x19, 0x99, 0x85, 0x0B, 0x17, 0x1A, 0x47, 0x80, 0x53, 0xA4, 0xE0, 0xC8, 0x36, 0xAC, 0x58,
-    0x06, 0xC2, 0x51, 0x32, 0xB4, 0x87, 0xDA, 0x79, 0xEF, 0xE6, 0xFB, 0xCE, 0x9D, 0xF7, 0xF6, 0x2D,
-    0x45, 0x59, 0xBF, 0x4F, 0x7A, 0xFB, 0xF8, 0xDE, 0xCC, 0xBD, 0xE7, 0xBB, 0xE7, 0xE7, 0x3B, 0x3F,
-    0x23, 0x22, 0x46, 0x24, 0x75, 0xB5, 0x24, 0xAE, 0x93, 0x73, 0xAF, 0x00, 0xDF, 0xCD, 0x88, 0x7F,
-    0xB8, 0x5C, 0xA4, 0x6A, 0x44, 0x66, 0x83, 0xC8, 0xDE, 0x1E, 0xEE, 0xB6, 0xB8, 0xFB, 0x9B, 0x9D,
-    0xD8, 0x7A, 0x94, 0xD8, 0x39, 0x89, 0x9C, 0x6B, 0x42, 0xE7, 0xFA, 0x70, 0x90, 0x05, 0x16, 0x64,
-    0xA5, 0xFC, 0xF1, 0xAD, 0x3C, 0x71, 0xED, 0xB3, 0x2F, 0x5F, 0x3B, 0xDB, 0x2D, 0x3A, 0x2D, 0x63,
-    0xD7, 0x46, 0xAF, 0xF6, 0x61, 0xBD, 0x1B, 0x34, 0x56, 0xBA, 0xA4, 0xCE, 0x5C, 0x17, 0xBB, 0x41,
-    0xAA, 0x03, 0x5C, 0xBE, 0x00, 0x14, 0xF6, 0x56, 0x23, 0xA1, 0x6B, 0x45, 0xB2, 0xE6, 0x13, 0x41,
-    0xB1, 0xB5, 0x59, 0x1A, 0xEC, 0x6F, 0x17, 0x22, 0x17, 0x57, 0xFB, 0x15, 0xC7, 0x38, 0x6D, 0x09,
-    0x1C, 0xD2, 0xD9, 0xFC, 0x8A, 0x74, 0x61, 0x5D, 0x08, 0x80, 0x04, 0x6E, 0x21, 0xF1, 0xEF, 0x28,
-    0x37, 0x05, 0xD6, 0x4E, 0xC5, 0xA5, 0xBD, 0x44, 0xAF, 0x95, 0x32, 0x0C, 0x94, 0x15, 0xB5, 0xA3,
-    0x8C, 0xB6, 0x4E, 0xDD, 0x48, 0x41, 0xCE, 0xCD, 0xB3, 0xD2, 0xBE, 0xD9, 0x09, 0xF6, 0xB6, 0xA5,
-    0x04, 0xBF, 0x04, 0xE8, 0x5A, 0xE4, 0x64, 0x12, 0x62, 0x16, 0x6D, 0xEA, 0x6E, 0x74, 0x07, 0x56,
-    0xFA, 0x3B, 0xE1, 0xFD, 0xBA, 0xB0, 0x6E, 0x4C, 0x5D, 0x9B, 0x3E, 0x28, 0xE5, 0x50, 0xA2, 0x5A,
-    0xD2, 0x56, 0xB2, 0xDC, 0xDF, 0x89, 0x0F, 0x8B, 0x8F, 0x3B, 0x10, 0x5A, 0xAE, 0x30, 0x6E, 0x3A,
-    0x00, 0x5F, 0x00, 0x67, 0x17, 0x2C, 0xF2, 0x3C, 0x01, 0xAA, 0xB9, 0x48, 0x0C, 0x50, 0x38, 0x14,
-    0x25, 0x46, 0xA3, 0x94, 0x16, 0x47, 0xCE, 0x70, 0xBA, 0xC2, 0x35, 0x52, 0x51, 0x37, 0x1D, 0x37,
-    0x3A, 0x16, 0xA3, 0x1B, 0x57, 0x79, 0x3A, 0x37, 0x03, 0xA1, 0xCD, 0xA8, 0xC1, 0xF8, 0x57, 0xB0,
-    0x87, 0x5C, 0x1E, 0xA6, 0xFD, 0xAF, 0x88, 0xDF, 0x0A, 0xBA, 0x0E, 0xDA, 0xD9, 0x99, 0xAE, 0xF7,
-    0x07, 0x68, 0x71, 0xA0, 0x5C, 0xA9, 0x6E, 0x5E, 0x30, 0x10, 0x1A, 0xF6, 0x5E, 0xB0, 0x6D, 0xFD,
-    0x3B, 0xE9, 0x02, 0xA1, 0x64, 0x0B, 0x78, 0x91, 0x9B, 0x4B, 0x80, 0x37, 0x5F, 0x61, 0x2D, 0xC1,
-    0x28, 0xE6, 0xB4, 0x91, 0x7E, 0x5B, 0xAD, 0x36, 0xC7, 0xE5, 0x3C, 0x6A, 0x25, 0x6C, 0xC5, 0x74,
-    0xAA, 0x98, 0xF4, 0x3B, 0xF8, 0xA9, 0x96, 0xFD, 0x96, 0xFA, 0x39, 0xC2, 0x76, 0xD0, 0xD7, 0x3D,
-    0xAC, 0x1C, 0x3E, 0xDE, 0xB1, 0x5F, 0x92, 0xA8, 0x91, 0xCC, 0xBB, 0x08, 0x8E, 0x9D, 0xBC, 0xC7,
-    0xB1, 0xFB, 0x2D, 0x80, 0x87, 0xB8, 0x00, 0xFB, 0xC8, 0xAE, 0xA8, 0xD7, 0xAF, 0x5E, 0xA6, 0x6A,
-    0xF5, 0xE0, 0xB1, 0x83, 0x2B, 0x3D, 0x36, 0x12, 0xF5, 0xFE, 0xE4, 0x01, 0x37, 0x5D, 0x4C, 0xCA,
-    0xE2, 0xD1, 0xE1, 0x5F, 0xB5, 0x38, 0xA8, 0x2D, 0x71, 0xFD, 0x74, 0xF6, 0xAF, 0x6F, 0xE6, 0x21,
-    0xFC, 0xC6, 0xE2, 0xF6, 0xD9, 0x6A, 0xD7, 0xB4, 0x91, 0x04, 0x1A, 0xC0, 0x51, 0x21, 0x3B, 0xF1,
-    0x4E, 0x8C, 0xF3, 0x1B, 0x28, 0x76, 0x93, 0xFB, 0x99, 0xFC, 0x8F, 0xC4, 0xBC, 0x8D, 0x25, 0x15,
-    0x94, 0x90, 0xE1, 0x87, 0x4F, 0x9F, 0x81, 0x81, 0x06, 0x0C, 0x3C, 0x2C, 0x70, 0xAE, 0x0B, 0xBB,
-    0xA8, 0x0F, 0x3B, 0x33, 0x60, 0xA3, 0x21, 0x86, 0x6A, 0x6D, 0x1D, 0x74, 0x49, 0x19, 0x75, 0x69,
-    0xB9, 0xDF, 0x64, 0x80, 0x82, 0x77, 0x5E, 0x00, 0x45, 0xE5, 0x6E, 0xD2, 0x06, 0xD4, 0xEC, 0xDB,
-    0x50, 0xC9, 0x0C, 0x1B, 0x6F, 0x03, 0x8C, 0x3D, 0x94, 0xF8, 0x37, 0xAF, 0x31, 0x12, 0x25, 0xF9,
-    0x6E, 0x2F, 0x36, 0x1F, 0xE1, 0x64, 0x87, 0x30, 0x79, 0x91, 0x63, 0x89, 0x8F, 0x78, 0xB3, 0xA0,
-    0x76, 0x32, 0x57, 0xE2, 0xDB, 0x9C, 0x71, 0x54, 0x87, 0x5D, 0xD8, 0x43, 0x9B, 0x7B, 0x72, 0x57,
-    0xEC, 0xF3, 0xF0, 0xF6, 0xD7, 0xDD, 0x22, 0xE8, 0xA2, 0xD6, 0x0C, 0x41, 0x1F, 0xCD, 0x71, 0x78,
-    0xEA, 0xDF, 0xE1, 0x6E, 0x97, 0xC7, 0xEE, 0xB1, 0x4C, 0x72, 0xC3, 0x46, 0x18, 0x41, 0xC1, 0xED,
-    0x5F, 0xAB, 0x3F, 0xA7, 0xB7, 0x85, 0x96, 0x8C, 0x7E, 0x35, 0x57, 0xA9, 0x5B, 0xB0, 0xC9, 0x36,
-    0x94, 0x4A, 0xC7, 0xA2, 0xD0, 0xE8, 0x14, 0x4B, 0x82, 0x5B, 0x1D, 0x7E, 0x68, 0xE4, 0x07, 0x2F,
-    0xAC, 0x93, 0xCE, 0x26, 0x50, 0x20, 0x1C, 0x65, 0xF1, 0x2F, 0x12, 0x4F, 0xBA, 0x99, 0x7F, 0x1D,
-    0xC6, 0xE1, 0xBD, 0xA5, 0xC0, 0x1E, 0x54, 0x6A, 0xFA, 0xD6, 0x11, 0x80, 0x34, 0x08, 0x44, 0xFC,
-    0x4A, 0x1B, 0x5D, 0xCC, 0x8D, 0xAE, 0xBB, 0x29, 0xEF, 0x7A, 0xD1, 0x14, 0x0F, 0xF3, 0xE8, 0x8D,
-    0xEB, 0x58, 0x51, 0x26, 0xAF, 0x7C, 0x3B, 0xE8, 0x8C, 0xE2, 0x20, 0x5A, 0xFA, 0x4F, 0xD0, 0x5C,
-    0x87, 0x37, 0xAB, 0xBD, 0x64, 0x23, 0xFF, 0x58, 0x30, 0xE2, 0xE7, 0x1A, 0x71, 0xEA, 0xF8, 0x6B,
-    0x3B, 0x7D, 0x40, 0x18, 0xF4, 0x59, 0x68, 0x89, 0xBC, 0x10, 0x1C, 0xAD, 0xE2, 0xD1, 0x35, 0x60,
-    0x0E, 0x82, 0x00, 0x29, 0x85, 0x0C, 0x84, 0xBF, 0x55, 0x0C, 0xD5, 0x82, 0xD1, 0xC3, 0xDB, 0x01,
-    0x21, 0x54, 0x27, 0xE8, 0x48, 0x81, 0x20, 0x46, 0x01, 0xC3, 0x30, 0x6C, 0xFE, 0xED, 0x09, 0xE9,
-    0x66, 0xD1, 0x43, 0xB8, 0x75, 0x03, 0x64, 0xA7, 0x72, 0x01, 0xA2, 0xAD, 0x6B, 0x29, 0xF9, 0xC3,
-    0xCA, 0x80, 0xA5, 0x65, 0x22, 0x84, 0x83, 0xF7, 0xDF, 0x5D, 0x78, 0x33, 0x96, 0xC4, 0x39, 0x57,
-    0xA8, 0x87, 0x7A, 0xEF, 0x0F, 0xDF, 0x80, 0x93, 0xC2, 0x07, 0x09, 0x57, 0x3E, 0x7F, 0x5E, 0x57,
-    0x80, 0x24, 0x0C, 0x34, 0x60, 0x62, 0xE0, 0x10, 0x54, 0xF8, 0xE8, 0x48, 0x51, 0x21, 0x85, 0x28,
-    0x71, 0x24, 0xA5, 0x57, 0x7F, 0x86, 0x38, 0x2C, 0x88, 0x96, 0xC9, 0xCB, 0x9A, 0x56, 0x63, 0x1C,
-    0xBA, 0x96, 0x1D, 0x79, 0xDA, 0xAB, 0xCA, 0x69, 0x05, 0x33, 0xFC, 0x3D, 0x4C, 0x3E, 0xC8, 0xE1,
-    0x2B, 0x57, 0x69, 0x06, 0x46, 0x3D, 0xE0, 0x4A, 0x3C, 0x9F, 0x98, 0x0C, 0x49, 0x82, 0x06, 0x21,
-    0xFD, 0xB5, 0xC7, 0x4F, 0xDB, 0xE6, 0x1F, 0x5F, 0xC2, 0x56, 0x00, 0x99, 0xC1, 0xDA, 0x76, 0x90,
-    0x5C, 0x79, 0x82, 0x8C, 0xCE, 0xC4, 0x81, 0xEC, 0xF3, 0xEB, 0xDC, 0x36, 0xE9, 0x5C, 0x46, 0x53,
-    0x35, 0x49, 0x13, 0xF4, 0xE2, 0xDE, 0x22, 0x63, 0x42, 0x04, 0x17, 0xC8, 0x6D, 0x8D, 0x9A, 0x17,
-    0x3D, 0xC5, 0xA4, 0x03, 0xF8, 0x71, 0x76, 0x2E, 0x02, 0x7E, 0xCB, 0xE3, 0x94, 0xD1, 0x7F, 0x8C,
-    0xB2, 0x13, 0x75, 0xA6, 0x49, 0xCB, 0xF8, 0xB9, 0x51, 0x7D, 0xA5, 0x80, 0xEB, 0x55, 0x10, 0xF5,
-    0x87, 0x64, 0x93, 0x3C, 0x38, 0x05, 0xD1, 0x91, 0x50, 0x95, 0x40, 0xE3, 0x00, 0x87, 0x56, 0x27,
-    0xA4, 0xD6, 0xDF, 0xE5, 0x7E, 0x9B, 0xAF, 0xE4, 0xB8, 0x32, 0x27, 0x81, 0x41, 0xB7, 0xE5, 0x33,
-    0x92, 0xD6, 0x5E, 0xBE, 0x3F, 0x6A, 0xBB, 0xF5, 0x6D, 0x99, 0x07, 0xF0, 0x84, 0xFA, 0xF2, 0x1C,
-    0xB4, 0x9F, 0xE6, 0x76, 0x71, 0x1B, 0xBE, 0x09, 0xE7, 0xD4, 0x05, 0xCF, 0x32, 0xB0, 0x4C, 0x7B,
-    0x1D, 0xAE, 0x3A, 0x68, 0xD6, 0x58, 0xCB, 0xA7, 0x72, 0xF9, 0xBF, 0x6A, 0xE2, 0x35, 0x7D, 0x25,
-    0xCC, 0xA5, 0x51, 0x7E, 0x4F, 0x08, 0x98, 0x5A, 0x25, 0xA7, 0x06, 0xB4, 0x0C, 0x11, 0x83, 0xC0,
-    0xD2, 0xAA, 0x84, 0x0A, 0x64, 0x82, 0x4C, 0x67, 0x05, 0xC9, 0xA8, 0xBB, 0x3E, 0xE1, 0xAF, 0xD4,
-    0x70, 0xAC, 0x21, 0x38, 0x27, 0x5A, 0xEA, 0x97, 0x60, 0xA3, 0xCE, 0x63, 0xA5, 0x76, 0x09, 0x95,
-    0xCA, 0x25, 0x52, 0xEA, 0x56, 0x81, 0xAA, 0x6A, 0x19, 0xB0, 0x58, 0x90, 0x22, 0x2D, 0xBF, 0xB4,
-    0x06, 0x12, 0xA5, 0x06, 0x31, 0x42, 0xA7, 0x84, 0x78, 0x27, 0xA9, 0x89, 0x10, 0x2A, 0x25, 0x40,
-    0x93, 0x12, 0x1F, 0x35, 0x0A, 0x78, 0x48, 0x43, 0x32, 0xF1, 0x3E, 0x88, 0x52, 0x35, 0x65, 0xA1,
-    0xDC, 0xB8, 0x9D, 0xEC, 0x2B, 0x4F, 0xD1, 0x6D, 0x0A, 0x3F, 0x24, 0xD8, 0xAC, 0x35, 0xAB, 0x05,
-    0xBC, 0x39, 0x1C, 0xA2, 0x1F, 0xA8, 0x66, 0x33, 0xD9, 0xEF, 0x09, 0x37, 0x74, 0xB7, 0x46, 0x55,
-    0x2C, 0x30, 0xE7, 0x93, 0x2B, 0xA0, 0x72, 0x60, 0x16, 0x2C, 0x74, 0x19, 0xCF, 0xFA, 0x05, 0x35,
-    0x9F, 0xB9, 0x7B, 0x42, 0xC5, 0x26, 0xCF, 0x6B, 0x8D, 0xF2, 0x62, 0xDC, 0x52, 0xAD, 0xE0, 0x6D,
-    0x9F, 0xA2, 0xBD, 0x52, 0xEF, 0x52, 0xA7, 0x21, 0x4E, 0xB0, 0xBF, 0x4A, 0xA3, 0xBB, 0x13, 0xEE,
-    0x53, 0xC6, 0xDB, 0x99, 0x67, 0x9D, 0x20, 0x5C, 0x47, 0x39, 0x41, 0x40, 0x8F, 0x01, 0xF8, 0x3D,
-    0xEC, 0x82, 0x81, 0x4C, 0x1F, 0xB7, 0x51, 0x67, 0xDF, 0xF1, 0x2A, 0x04, 0xA7, 0x37, 0x29, 0xD3,
-    0x4A, 0x99, 0xD5, 0x45, 0x9E, 0x95, 0x15, 0xF7, 0xB9, 0xA2, 0x9E, 0x8D, 0x7C, 0xB4, 0x0A, 0x85,
-    0x5D, 0xCD, 0x74, 0x90, 0xD7, 0x33, 0xB5, 0x87, 0xA7, 0x38, 0xD3, 0x18, 0xF7, 0x33, 0x5B, 0xEF,
-    0xD8, 0x72, 0x96, 0xE6, 0x43, 0x66, 0xFA, 0x22, 0xEC, 0xEE, 0x21, 0x6C, 0xD7, 0x64, 0x6E, 0x3E,
-    0xFE, 0xEB, 0x39, 0x64, 0x2C, 0xF0, 0x9E, 0xBF, 0xAF, 0x4C, 0x48, 0x38, 0xB8, 0x1A, 0xB9, 0x36,
-    0x5E, 0xE4, 0x90, 0x10, 0xA8, 0x84, 0xE8, 0xBC, 0x84, 0xCC, 0x4B, 0xD8, 0xFD, 0x62, 0x30, 0xAF,
-    0xFF, 0xA0, 0x90, 0xCF, 0xAD, 0x38, 0x93, 0x5C, 0x3D, 0xB2, 0x26, 0x48, 0xF9, 0x09, 0xC6, 0x49,
-    0x72, 0xE0, 0xC0, 0xAD, 0x20, 0xD8, 0x7B, 0xF4, 0xA2, 0xA4, 0xA6, 0xA6, 0xCD, 0xFF, 0xD6, 0xD9,
-    0xBF, 0x47, 0xFB, 0xF9, 0x67, 0xFD, 0x42, 0x30, 0xC7, 0x2E, 0x43, 0x7F, 0x26, 0x71, 0x89, 0x73,
-    0x25, 0x5C, 0x40, 0xD2, 0x37, 0xD7, 0x8C, 0x1B, 0x43, 0x37, 0x9C, 0x33, 0xF8, 0xC8, 0xFF, 0x4D,
-    0x4F, 0x72, 0xC2, 0x6D, 0x10, 0x01, 0x69, 0x70, 0x3A, 0xF0, 0x12, 0x64, 0xC0, 0xED, 0xA0, 0xAF,
-    0xC2, 0x07, 0x96, 0xB9, 0x5A, 0x39, 0xA6, 0x5F, 0xF9, 0xBD, 0x42, 0xB0, 0x70, 0x04, 0xCC, 0x80,
-    0xDF, 0xB0, 0xDB, 0x01, 0x37, 0x03, 0x25, 0x95, 0x01, 0xDC, 0x31, 0x87, 0x17, 0x55, 0xB8, 0x88,
-    0x65, 0x19, 0x62, 0xCC, 0x6F, 0x74, 0xC4, 0x3B, 0x32, 0x5F, 0x9E, 0xF8, 0x7D, 0x6D, 0x0E, 0xC6,
-    0x83, 0xAE, 0xB0, 0xF1, 0x2E, 0x3F, 0xAD, 0x5E, 0xEF, 0x64, 0x9B, 0x85, 0xAC, 0xAF, 0x8D, 0xB8,
-    0xF5, 0x21, 0x3D, 0x6C, 0x15, 0x6A, 0xEF, 0x27, 0x97, 0x6A, 0x6A, 0x77, 0xC3, 0x7A, 0x16, 0x97,
-    0x7D, 0x12, 0x76, 0x19, 0x23, 0xD6, 0x96, 0x51, 0x03, 0x7B, 0x9E, 0xE0, 0x0E, 0x8B, 0x52, 0x01,
-    0x6E, 0x70, 0x88, 0x2D, 0x6C, 0x83, 0x4D, 0x50, 0x73, 0x83, 0x97, 0xA3, 0x16, 0x3A, 0xBE, 0x8B,
-    0x7F, 0xB2, 0x64, 0x86, 0x64, 0xB0, 0x49, 0x8D, 0xBA, 0x65, 0x30, 0x83, 0xE7, 0xC8, 0x4F, 0xB1,
-    0xA0, 0x83, 0xFF, 0xA3, 0x10, 0x80, 0xDB, 0x93, 0x1C, 0xFE, 0x6C, 0x4D, 0xBB, 0xCF, 0x42, 0x97,
-    0x11, 0x4B, 0x10, 0x6E, 0x07, 0x1A, 0x98, 0x7E, 0xDE, 0xC2, 0xC1, 0x2C, 0x74, 0x10, 0xD6, 0xA6,
-    0xC3, 0xE9, 0xEE, 0xA0, 0xCE, 0xDD, 0xC1, 0x41, 0xB7, 0xA0, 0x43, 0x4B, 0x1C, 0x58, 0x11, 0x40,
-    0xCB, 0xD4, 0x4F, 0x38, 0x4E, 0x45, 0xDE, 0xCB, 0x72, 0xA6, 0x76, 0x1F, 0xCD, 0x0B, 0x08, 0x3B,
-    0x4E, 0xD6, 0xA8, 0x91, 0x49, 0x9C, 0xD9, 0x45, 0x65, 0xDD, 0xF5, 0xBE, 0xA3, 0xA9, 0x05, 0x5C,
-    0xA5, 0x17, 0x14, 0xF4, 0x38, 0x5D, 0x48, 0x73, 0x55, 0xD9, 0x33, 0x71, 0xAB, 0xA9, 0x88, 0x5E,
-    0xC1, 0xF6, 0x42, 0x36, 0xAE, 0x2E, 0xF7, 0xDB, 0xF6, 0xE5, 0x2C, 0x2E, 0x6E, 0x47, 0xF5, 0x9A,
-    0xC3, 0x84, 0xBE, 0x35, 0xB0, 0x5A, 0xA5, 0x03, 0xB5, 0x26, 0xD1, 0x1D, 0x5F, 0xF2, 0xF7, 0x5A,
-    0x20, 0x5E, 0x46, 0xB0, 0xCE, 0x7D, 0x9D, 0x79, 0xD6, 0xA9, 0x94, 0x6A, 0x61, 0x52, 0x49, 0xE5,
-    0xF9, 0xEF, 0xD2, 0x19, 0xF6, 0x93, 0xB4, 0x0E, 0xDF, 0x86, 0xF5, 0xFE, 0x0A, 0x26, 0x03, 0xAD,
-    0x3F, 0x84, 0xBF, 0xCF, 0x95, 0x9A, 0xA3, 0x85, 0x26, 0x15, 0x01, 0x21, 0x45, 0x24, 0xA5, 0x7D,
-    0x68, 0x32, 0xEB, 0xE2, 0xB6, 0xEA, 0x7C, 0x95, 0xDE, 0x69, 0xE8, 0xEE, 0x68, 0x9F, 0x63, 0xBF,
-    0x96, 0x87, 0x0F, 0x40, 0x80, 0x25, 0xBB, 0x9D, 0x02, 0x7D, 0x09, 0x13, 0x61, 0x1D, 0xBD, 0x09,
-    0x86, 0x70, 0x6B, 0x48, 0x9C, 0x02, 0x43, 0xDC, 0x00, 0x0A, 0xAC, 0x67, 0x78, 0xDE, 0x9F, 0xD7,
-    0x9F, 0xB9, 0x13, 0xFC, 0x0F, 0x7E, 0x87, 0x9F, 0x20, 0x09, 0xF6, 0xC1, 0x83, 0x7A, 0x87, 0xFE,
-    0x92, 0xF3, 0x78, 0x9D, 0x1E, 0x95, 0xE6, 0x50, 0x3F, 0x85, 0x16, 0x57, 0x9F, 0xCD, 0xF4, 0xD9,
-    0xBE, 0x90, 0xB9, 0x47, 0xCE, 0xFD, 0x44, 0xAB, 0x96, 0x16, 0x78, 0xE0, 0xB9, 0x2B, 0x3D, 0x42,
-    0x2F, 0xC7, 0xD8, 0x02, 0x96, 0xDE, 0xF3, 0xF1, 0x62, 0x7D, 0xBC, 0xC0, 0xC6, 0x7B, 0xEC, 0x02,
-    0x58, 0x35, 0xC3, 0x8E, 0xA9, 0xDA, 0xE5, 0x50, 0x75, 0x3B, 0x72, 0x57, 0xA4, 0x5A, 0x58, 0x0D,
-    0x56, 0xC5, 0xF6, 0xD6, 0xCD, 0x13, 0x76, 0x5D, 0x53, 0x8C, 0xC8, 0x35, 0x2A, 0x13, 0xD6, 0x21,
-    0x13, 0xB4, 0x3C, 0xCC, 0xC5, 0x5C, 0x5D, 0x63, 0x15, 0x31, 0xA5, 0x8F, 0x20, 0x3B, 0x7D, 0xC7,
-    0xEF, 0x7B, 0xB0, 0xAF, 0xC4, 0xE3, 0x19, 0xD1, 0x1F, 0x91, 0xAA, 0xE7, 0xCC, 0x04, 0x85, 0xEF,
-    0x5B, 0x0E, 0xBC, 0xEC, 0x0D, 0x33, 0x6C, 0x07, 0xDD, 0x6E, 0xD8, 0xCD, 0xA2, 0x96, 0x85, 0x3A,
-    0x3B, 0x53, 0x30, 0xC1, 0x8D, 0x6B, 0x28, 0x4F, 0x50, 0x9D, 0x68, 0x71, 0xB2, 0x21, 0xDC, 0x32,
-    0x6C, 0xCC, 0x1B, 0x9D, 0x1C, 0x0F, 0xA4, 0xB8, 0x44, 0x8B, 0x3E, 0x9C, 0xCF, 0x78, 0x9B, 0xF8,
-    0x9F, 0x78, 0x53, 0x4B, 0xC1, 0x7A, 0x4A, 0x4A, 0xA0, 0xA1, 0x5E, 0x45, 0x05, 0x3E, 0x06, 0x5D,
-    0x21, 0xE3, 0x25, 0x54, 0xF0, 0x74, 0x45, 0xC8, 0xC0, 0x41, 0x83, 0xE1, 0x62, 0x0E, 0x06, 0x85,
-    0x10, 0x3D, 0xE9, 0xF5, 0x89, 0x59, 0x2E, 0x85, 0xBF, 0xE8, 0x76, 0x0F, 0xA3, 0xD7, 0xDA, 0xC1,
-    0xAB, 0x71, 0x9B, 0x7B, 0x16, 0xF5, 0xDA, 0x59, 0xF8, 0x3A, 0xCB, 0xC2, 0x8A, 0x64, 0xD9, 0x42,
-    0x98, 0x5E, 0x2F, 0xA4, 0x87, 0xFA, 0x8B, 0x53, 0x47, 0x2E, 0x34, 0xF1, 0x4D, 0xEB, 0x9D, 0xFE,
-    0x4D, 0xF4, 0x82, 0xD6, 0x10, 0x0A, 0x97, 0x51, 0xA2, 0x4C, 0x67, 0x17, 0x8C, 0x08, 0xE4, 0x63,
-    0xE6, 0xF5, 0x05, 0x0B, 0x39, 0x78, 0xA1, 0x9B, 0x3C, 0x79, 0xB9, 0x42, 0x7C, 0xDF, 0xF8, 0x17,
-    0xE7, 0x53, 0xA9, 0x86, 0xEA, 0xF6, 0xB2, 0x0A, 0x9B, 0x2D, 0x71, 0x51, 0x78, 0xA2, 0xF0, 0x2E,
-    0x88, 0x29, 0x16, 0x37, 0x58, 0x7B, 0x99, 0xFC, 0x78, 0xBA, 0xAC, 0xC2, 0x53, 0x05, 0xD8, 0xFA,
-    0x95, 0x71, 0xAE, 0xFA, 0x5E, 0xBE, 0x2E, 0xE2, 0x8C, 0x05, 0x34, 0x59, 0xE5, 0x27, 0xA8, 0x26,
-    0x46, 0xE3, 0x5E, 0xED, 0x03, 0xF7, 0xA3, 0x2E, 0x3C, 0xBD, 0xDF, 0x45, 0xBF, 0xFB, 0xCF, 0xC6,
-    0xBE, 0xF9, 0x9B, 0xDA, 0xBE, 0xEE, 0xEA, 0xF4, 0xBE, 0xCB, 0xB3, 0xFB, 0x68, 0x6F, 0xBE, 0xE1,
-    0xA4, 0x7A, 0x8E, 0x84, 0xB1, 0xA1, 0x81, 0x72, 0xAC, 0x06, 0x5A, 0x8E, 0x23, 0x1E, 0xA2, 0xD2,
-    0x18, 0xA2, 0xFE, 0x24, 0xAE, 0x67, 0x36, 0x1F, 0x12, 0xE9, 0xB3, 0xA0, 0x63, 0x32, 0x42, 0x1C,
-    0x7C, 0x64, 0x39, 0x5E, 0xA7, 0xA4, 0x69, 0x50, 0xEF, 0x54, 0xE5, 0xAC, 0x8A, 0xB8, 0xDF, 0x23,
-    0xD1, 0x5C, 0xA3, 0x1B, 0x46, 0x4B, 0x8F, 0x06, 0xBB, 0x6A, 0x5D, 0x46, 0x8E, 0xB3, 0x0F, 0x27,
-    0xD2, 0xDB, 0x7A, 0xA2, 0x5A, 0xB9, 0x06, 0xB3, 0x13, 0x64, 0xDA, 0xA4, 0xA8, 0x5D, 0x41, 0xD2,
-    0x2E, 0x6A, 0x88, 0x12, 0xEC, 0x88, 0x72, 0xE8, 0xE0, 0x40, 0xB2, 0xEF, 0xDD, 0x16, 0xC2, 0x8C,
-    0x3B, 0xD7, 0x84, 0xA0, 0x0E, 0x59, 0xC0, 0xEC, 0x1E, 0x67, 0x9C, 0xFF, 0x50, 0xEC, 0x6D, 0xD8,
-    0xA2, 0xF5, 0x6E, 0x73, 0xE1, 0xDC, 0xB8, 0xE8, 0x61, 0xAB, 0x65, 0x74, 0xF1, 0x3C, 0xBB, 0x54,
-    0xF8, 0xDD, 0x20, 0xB3, 0xB0, 0x09, 0xBB, 0x54, 0x27, 0x34, 0xF7, 0x56, 0xA5, 0x53, 0xD4, 0xAC,
-    0xBC, 0x4E, 0xB9, 0x77, 0xAA, 0x76, 0x9E, 0xF6, 0x8A, 0xAB, 0x72, 0x6A, 0x4E, 0xC5, 0xCC, 0x53,
-    0x2D, 0xED, 0xE8, 0x13, 0xBB, 0x74, 0x53, 0xD3, 0x59, 0xE5, 0x63, 0x8E, 0x5C, 0x32, 0x6E, 0x14,
-    0x0C, 0x0C, 0xEA, 0x8F, 0x68, 0x02, 0x12, 0x6D, 0xE6, 0xA9, 0xFB, 0x03, 0x18, 0x1A, 0x21, 0xEE,
-    0x6A, 0xB3, 0xA4, 0xC8, 0xF7, 0x9A, 0x9F, 0x5D, 0x7E, 0x4C, 0xEC, 0x28, 0xFA, 0x7F, 0x86, 0xBA,
-    0x30, 0x4F, 0xEA, 0x2C, 0x0F, 0x3B, 0xF8, 0xEB, 0x88, 0xD5, 0x7B, 0x00, 0x9C, 0xA2, 0x31, 0xB6,
-    0x75, 0x51, 0xEE, 0xB3, 0x06, 0x42, 0x85, 0xC3, 0x49, 0x18, 0xDE, 0x9B, 0xAB, 0x72, 0x01, 0x1B,
-    0x43, 0x9F, 0xF1, 0x7A, 0xF1, 0xA1, 0x63, 0x95, 0x36, 0x6A, 0x4F, 0xC2, 0x26, 0x81, 0x02, 0xCA,
-    0xBB, 0xFB, 0x4D, 0xC2, 0xD2, 0x17, 0xBB, 0xDD, 0x5C, 0x0D, 0xD1, 0x6A, 0x3F, 0x44, 0x2B, 0x9A,
-    0x4F, 0x0E, 0xCA, 0x33, 0x00, 0xF3, 0xCE, 0x09, 0x8E, 0x88, 0x34, 0x71, 0x73, 0xBD, 0xA5, 0x45,
-    0x9F, 0xD2, 0x9E, 0x48, 0x1F, 0xD5, 0x89, 0x0C, 0xC1, 0xA3, 0x4A, 0x67, 0x0D, 0x08, 0xF5, 0x40,
-    0xEB, 0xDA, 0x13, 0x4D, 0x00, 0x60, 0xC2, 0xB9, 0x59, 0x2F, 0xA0, 0x36, 0x17, 0x30, 0x1C, 0xBA,
-    0x60, 0xB1, 0x58, 0x00, 0x1E, 0x28, 0x48, 0x0C, 0x1C, 0x38, 0x20, 0x89, 0xF7, 0x88, 0x68, 0x30,
-    0x1B, 0xEB, 0x87, 0xB0, 0x33, 0x0B, 0x53, 0x95, 0x11, 0x79, 0x44, 0x9B, 0xA7, 0x94, 0x55, 0xC3,
-    0xE5, 0x55, 0x62, 0xDA, 0x03, 0xF5, 0x22, 0x51, 0x85, 0x5D, 0xDC, 0xAE, 0x77, 0xD9, 0x4C, 0xC9,
-    0xC4, 0x64, 0xF3, 0x19, 0x38, 0x03, 0x95, 0xF2, 0xDF, 0x81, 0x0F, 0xD9, 0x35, 0xC2, 0x44, 0x0A,
-    0x0B, 0x7B, 0xBE, 0x70, 0x8D, 0x93, 0x0E, 0x66, 0xC7, 0x9F, 0x39, 0xD7, 0x29, 0x04, 0xD2, 0x52,
-    0xA1, 0x1E, 0xE9, 0xFE, 0x46, 0xED, 0x4B, 0x8D, 0x18, 0xFD, 0xCB, 0x8A, 0x22, 0x69, 0x22, 0x4E,
-    0x72, 0x50, 0xC0, 0xBE, 0x4C, 0x30, 0x1C, 0x16, 0xEA, 0x5F, 0x53, 0xB9, 0x69, 0x02, 0xA6, 0xD2,
-    0xEF, 0xE5, 0x80, 0xFB, 0x50, 0x0E, 0xE3, 0xFE, 0x9F, 0x42, 0xE8, 0x12, 0x5E, 0xB3, 0x78, 0xE5,
-    0xEA, 0xDD, 0xFD, 0xCE, 0x18, 0xDC, 0x3D, 0x40, 0xB1, 0xE8, 0x8A, 0x1F, 0x6B, 0x9F, 0xF9, 0x19,
-    0x9D, 0x93, 0x58, 0x99, 0xE6, 0x75, 0x96, 0x1B, 0x76, 0x61, 0xB3, 0x2B, 0x9D, 0x95, 0x93, 0xA8,
-    0xDE, 0x8B, 0x5A, 0xCB, 0x7E, 0xBB, 0x0B, 0xB1, 0xFD, 0x68, 0xCB, 0x2A, 0x6A, 0xB3, 0x6F, 0x8C,
-    0xB6, 0x71, 0x71, 0x9F, 0x29, 0xEF, 0xC6, 0xB9, 0x61, 0xD6, 0xDC, 0xC8, 0xCD, 0x29, 0x9A, 0xA1,
-    0xF0, 0x71, 0xAE, 0xD5, 0x1B, 0x8E, 0x9B, 0xFB, 0x83, 0x2C, 0xD5, 0xC1, 0xAE, 0xBB, 0x23, 0x4B,
-    0x90, 0x5D, 0xFE, 0x61, 0x55, 0xF9, 0x7D, 0x58, 0x71, 0x1B, 0xEC, 0x71, 0xA7, 0x64, 0x9F, 0xD6,
-    0x5A, 0x01, 0xBC, 0x97, 0xE0, 0x0D, 0xE4, 0xF1, 0x84, 0x85, 0x70, 0xEF, 0xCB, 0xA6, 0x7F, 0x96,
-    0x35, 0xA9, 0xF0, 0x2B, 0xA1, 0x58, 0x0B, 0x4E, 0x87, 0xDC, 0xB0, 0x45, 0x45, 0xAA, 0xED, 0xBB,
-    0x50, 0xB2, 0xAD, 0xE1, 0x78, 0x28, 0x20, 0x07, 0x94, 0x8C, 0x0D, 0x22, 0xF3, 0x2B, 0x3E, 0xDF,
-    0x04, 0xE5, 0xE7, 0xCD, 0xA3, 0x9E, 0xF9, 0x70, 0x6F, 0x9A, 0x94, 0x41, 0x36, 0x7A, 0x2A, 0x08,
-    0x9F, 0x2A, 0xEF, 0x92, 0x19, 0xD1, 0x97, 0xDD, 0x5E, 0xA3, 0x5B, 0x3E, 0x6B, 0xC4, 0xF9, 0x92,
-    0xF4, 0xD0, 0xE9, 0xF1, 0xC8, 0xE8, 0x2E, 0x58, 0xEF, 0xEA, 0x0C, 0x21, 0xFB, 0xA5, 0x70, 0xCA,
-    0xC1, 0x2B, 0x12, 0xCD, 0xB5, 0x57, 0x2B, 0x13, 0xA4, 0x52, 0x17, 0xD2, 0x4C, 0x1A, 0x76, 0x17,
-    0x98, 0x4E, 0xAE, 0x78, 0xFE, 0x47, 0xBC, 0x27, 0xB7, 0x50, 0x7A, 0x9A, 0x77, 0xB0, 0x0C, 0x45,
-    0x7E, 0x78, 0x3A, 0x66, 0xAE, 0x59, 0xF6, 0x5D, 0x3B, 0x53, 0x2B, 0x8D, 0xCC, 0x74, 0x6E, 0x68,
-    0x00, 0x42, 0xF6, 0x53, 0xA3, 0x9A, 0xA2, 0x75, 0x40, 0xAC, 0xC3, 0xEC, 0x9B, 0x5E, 0x36, 0x8B,
-    0x60, 0x8D, 0x54, 0xDB, 0x52, 0x78, 0xA2, 0x43, 0xBD, 0x85, 0x8E, 0x39, 0xF4, 0xE4, 0xAD, 0x92,
-    0x38, 0x36, 0x38, 0x4E, 0x7C, 0xE8, 0x48, 0xF4, 0x56, 0xCD, 0x56, 0xFF, 0xB0, 0xD4, 0x2A, 0xD7,
-    0xD6, 0xF6, 0x21, 0xFA, 0xA8, 0x9E, 0x13, 0xCC, 0xA5, 0x3C, 0xEC, 0x19, 0xC0, 0x71, 0x93, 0xE6,
-    0x02, 0xC5, 0x91, 0x1A, 0xED, 0x63, 0xD1, 0xB9, 0x15, 0xA5, 0x19, 0xCE, 0x07, 0x16, 0xD2, 0x46,
-    0x3D, 0xFC, 0xB8, 0x86, 0x57, 0x1A, 0xE2, 0xB8, 0x33, 0xCD, 0x28, 0x4B, 0x0E, 0x54, 0x3D, 0xF9,
-    0x3C, 0xF5, 0xB8, 0xD5, 0x20, 0xAC, 0xAE, 0xE4, 0xCB, 0xB9, 0x0F, 0xE9, 0xA3, 0x4B, 0xBE, 0x50,
-    0x60, 0xF1, 0xAA, 0xF3, 0xA0, 0x65, 0xDA, 0xA5, 0x8B, 0x50, 0x9C, 0x32, 0x23, 0x90, 0xB0, 0x29,
-    0x57, 0xBA, 0xE7, 0xC9, 0x89, 0x85, 0xB1, 0xE5, 0xC1, 0xD8, 0xD6, 0x00, 0x0D, 0x22, 0x84, 0x8D,
-    0xF1, 0x30, 0x9D, 0xFD, 0x4A, 0x50, 0x9A, 0xDF, 0x82, 0x69, 0x07, 0x9F, 0x2A, 0xBC, 0x1D, 0x0B,
-    0xA4, 0xB9, 0x5B, 0xC2, 0xE3, 0x27, 0x68, 0xDB, 0x52, 0x3E, 0x29, 0x40, 0xA2, 0x53, 0xA7, 0xBD,
-    0xEC, 0xF3, 0x68, 0xE6, 0xDC, 0x8F, 0xB1, 0x11, 0xA2, 0xB2, 0x64, 0x92, 0xB8, 0xEB, 0x2D, 0x3D,
-    0x6A, 0x55, 0x1F, 0x7A, 0x87, 0x64, 0x22, 0xBA, 0xA7, 0xC5, 0x08, 0x43, 0xE2, 0x59, 0xDF, 0x35,
-    0xFC, 0x89, 0xBF, 0xFC, 0xA7, 0x13, 0xCD, 0x36, 0xEC, 0xD1, 0xEA, 0xD8, 0xFD, 0xD4, 0xCD, 0x83,
-    0xB3, 0x22, 0xF4, 0xBF, 0x61, 0x5D, 0x3B, 0x37, 0x2C, 0x61, 0x37, 0x3B, 0xED, 0x17, 0x3E, 0x17,
-    0xE4, 0xE1, 0xCF, 0x3B, 0xCE, 0x80, 0x78, 0xF8, 0x60, 0x99, 0xC8, 0xE0, 0x40, 0x63, 0xA1, 0xC5,
-    0xED, 0x40, 0xF4, 0xEC, 0x26, 0x46, 0x59, 0x8E, 0xD3, 0xE0, 0xA6, 0x54, 0x44, 0xE1, 0x27, 0x0A,
-    0xF3, 0x65, 0x21, 0x85, 0x86, 0x41, 0x47, 0x6B, 0x41, 0x7B, 0x62, 0xBA, 0x8B, 0xB0, 0x5C, 0x00,
-    0xAB, 0x72, 0x24, 0x5B, 0x6B, 0x55, 0xD6, 0x69, 0x39, 0x94, 0x1D, 0x71, 0x2C, 0x15, 0x42, 0x6B,
-    0x6B, 0x07, 0x8D, 0x56, 0x07, 0xCD, 0x38, 0x8C, 0x1C, 0x9F, 0x7E, 0x50, 0x3F, 0xF7, 0x67, 0x61,
-    0x0B, 0xEF, 0xE8, 0x13, 0xD7, 0xF0, 0x7C, 0x03, 0x57, 0xD4, 0xDC, 0x96, 0xCF, 0x4E, 0x00, 0x7F,
-    0xFB, 0x4B, 0x40, 0xF6, 0xA2, 0xC8, 0xFF, 0x61, 0xED, 0xF7, 0xCF, 0x4F, 0x53, 0x17, 0xFA, 0x58,
-    0x65, 0x1E, 0x8C, 0x66, 0x0C, 0x87, 0x60, 0x0C, 0xFB, 0xB0, 0x8F, 0x3A, 0xB2, 0x2F, 0x9A, 0xF9,
-    0x26, 0x6E, 0xE0, 0x89, 0xF8, 0x2F, 0xAD, 0x39, 0x18, 0x4E, 0x74, 0x40, 0xCC, 0x71, 0xF2, 0xD4,
-    0xB0, 0x6E, 0x7D, 0x09, 0xAD, 0x49, 0x9C, 0xAC, 0x12, 0x5B, 0x67, 0xBF, 0x55, 0xEE, 0x5E, 0x09,
-    0xBA, 0xCE, 0xDE, 0xAF, 0x0F, 0x93, 0x10, 0x45, 0xF2, 0xAB, 0xCE, 0xF9, 0x90, 0x63, 0xAC, 0xEA,
-    0xA0, 0x6A, 0xFE, 0xAE, 0x72, 0xE0, 0xE3, 0x20, 0xD8, 0x78, 0x01, 0x4D, 0x67, 0xE0, 0x56, 0x4D,
-    0x21, 0x73, 0xC3, 0xB6, 0xF4, 0xC0, 0xB0, 0x13, 0x76, 0x3B, 0x51, 0x3B, 0xB3, 0x88, 0xFC, 0x1A,
-    0xFF, 0xD3, 0x37, 0xE5, 0x45, 0xF0, 0x47, 0x05, 0x00, 0xC5, 0xF0, 0xAE, 0x59, 0xDA, 0xC7, 0x01,
-    0x71, 0xFD, 0x12, 0x33, 0x66, 0x08, 0x09, 0x17, 0xCF, 0x34, 0x51, 0x1E, 0x87, 0x0D, 0x60, 0x58,
-    0x19, 0xC3, 0xFA, 0xD0, 0x74, 0x59, 0x0E, 0x10, 0x09, 0x1F, 0x48, 0x51, 0x1B, 0x28, 0xE7, 0x65,
-    0xAB, 0x99, 0x86, 0x50, 0xF9, 0x27, 0xAA, 0x11, 0xD8, 0xFD, 0xCB, 0xA5, 0x99, 0xAB, 0xD7, 0x2D,
-    0x7F, 0xD9, 0x83, 0x4A, 0xEE, 0xC4, 0xF7, 0xEB, 0xCC, 0x9A, 0x61, 0x66, 0x7F, 0xEA, 0x1C, 0xDC,
-    0x89, 0xF1, 0x68, 0x7A, 0x0E, 0x52, 0x4A, 0xB6, 0x6E, 0xE1, 0x93, 0x23, 0x30, 0xDB, 0x5A, 0xF6,
-    0x43, 0x59, 0x4E, 0x14, 0xF8, 0x86, 0x0E, 0x31, 0xCB, 0x33, 0x0E, 0x1D, 0x46, 0x21, 0x10, 0x7C,
-    0x03, 0x39, 0xF3, 0x1B, 0x80, 0x75, 0xFA, 0xE0, 0x00, 0x94, 0x3B, 0xEA, 0x43, 0x8E, 0xD5, 0xF3,
-    0x23, 0x76, 0x23, 0x01, 0x1F, 0x09, 0xE2, 0x20, 0xFD, 0xF2, 0x97, 0x59, 0xD8, 0x06, 0xAD, 0xCD,
-    0x63, 0xD4, 0x72, 0x30, 0x92, 0xF0, 0xD1, 0x47, 0x3D, 0xD7, 0x3A, 0x0B, 0x2A, 0x52, 0xFA, 0xFC,
-    0xC8, 0x0A, 0x60, 0xDF, 0xC0, 0x1C, 0x41, 0xBD, 0xC6, 0xF5, 0xD2, 0x21, 0x8E, 0xC3, 0xD7, 0x9B,
-    0x14, 0x86, 0xD8, 0x89, 0xDE, 0xE8, 0x8A, 0xAF, 0xBA, 0x31, 0x61, 0x5B, 0x55, 0x1A, 0x7D, 0xB2,
-    0x56, 0x9D, 0x3D, 0xDD, 0x93, 0xA9, 0x25, 0xD1, 0xF9, 0x4B, 0xF4, 0x90, 0x14, 0xF6, 0x97, 0xED,
-    0xDA, 0x35, 0x4E, 0x82, 0x47, 0x0E, 0xF2, 0x07, 0xFC, 0x89, 0x60, 0xD1, 0xAB, 0xB6, 0xCD, 0x0C,
-    0xCA, 0xD3, 0x22, 0xC2, 0x2F, 0x85, 0x1D, 0x0B, 0x29, 0x32, 0x74, 0xED, 0x45, 0xB5, 0x40, 0x65,
-    0x3D, 0x07, 0x9E, 0x6A, 0x64, 0x12, 0xEC, 0xAA, 0x46, 0xAA, 0x06, 0x69, 0xAE, 0xAA, 0x51, 0x18,
-    0xB1, 0x44, 0xD0, 0x07, 0x60, 0x38, 0xE7, 0x2C, 0x39, 0xA7, 0x71, 0xE4, 0x91, 0x5D, 0xD8, 0xAD,
-    0xDF, 0xC9, 0xC2, 0xD7, 0xDF, 0xEE, 0x6D, 0xF5, 0xA0, 0xD6, 0x41, 0x29, 0xD3, 0xB7, 0xCB, 0xED,
-    0x2F, 0x06, 0xC9, 0xEC, 0xD9, 0xF8, 0xE1, 0x8A, 0x76, 0x13, 0xCC, 0xF8, 0x37, 0xBA, 0xF5, 0x19,
-    0x56, 0x96, 0xE6, 0xE9, 0x57, 0xDB, 0xE4, 0xC6, 0x68, 0x61, 0xEE, 0xDA, 0x3E, 0x40, 0x46, 0x6D,
-    0xD9, 0xE7, 0x25, 0x1D, 0x09, 0x84, 0x94, 0x51, 0xF9, 0xBE, 0xBF, 0x39, 0xEB, 0xCA, 0xF9, 0x3D,
-    0x3C, 0xAD, 0x65, 0x3B, 0x6A, 0xCE, 0x35, 0x92, 0x01, 0x74, 0x9E, 0x40, 0x91, 0x83, 0x24, 0xDF,
-    0x02, 0x9D, 0xEC, 0x6A, 0xCA, 0x0A, 0x98, 0x57, 0x07, 0xCF, 0xC0, 0x07, 0x4A, 0x47, 0x31, 0x27,
-    0x09, 0xBD, 0xEF, 0x4B, 0xE4, 0x20, 0x03, 0xCC, 0xD2, 0xFE, 0xA4, 0xDD, 0xFC, 0xD7, 0x97, 0x9E,
-    0x18, 0xAF, 0x7D, 0x38, 0x68, 0x5A, 0x41, 0x75, 0xD3, 0x7B, 0x4A, 0xBD, 0xD3, 0x44, 0x18, 0x9A,
-    0xD5, 0xC6, 0x73, 0xED, 0x9D, 0x0C, 0x7E, 0x3E, 0xC2, 0x6A, 0xBF, 0xE0, 0x13, 0x38, 0x54, 0x74,
-    0x19, 0x9F, 0xC9, 0x38, 0xD6, 0xDA, 0x1A, 0x74, 0x7F, 0xAE, 0x4A, 0x4B, 0xD6, 0x7A, 0x48, 0x4B,
-    0xD5, 0x2E, 0x47, 0x0C, 0x53, 0xBF, 0xF5, 0x28, 0x47, 0xDE, 0x8D, 0x59, 0x93, 0x2A, 0x41, 0x6B,
-    0x3E, 0xA4, 0x33, 0x7F, 0xE1, 0x13, 0x40, 0xB0, 0xA7, 0x09, 0x8B, 0xD3, 0xE0, 0xA3, 0x0F, 0x86,
-    0x40, 0xE7, 0xB2, 0x20, 0x0B, 0xF5, 0xC6, 0x4A, 0xFC, 0x43, 0xE5, 0xD5, 0xFC, 0x06, 0xB7, 0x64,
-    0xFA, 0xBC, 0x8E, 0xD5, 0xC6, 0xDA, 0x9B, 0x2D, 0x0C, 0xA7, 0x3F, 0x64, 0x24, 0x3E, 0xB5, 0x8A,
-    0xDD, 0x5B, 0x37, 0x59, 0xFD, 0x1B, 0xAE, 0x60, 0x6A, 0x99, 0x2A, 0x6D, 0x38, 0x1C, 0xCD, 0x56,
-    0x4C, 0x3A, 0x5E, 0xDF, 0x59, 0x88, 0x8A, 0x60, 0x03, 0x7F, 0x83, 0xE5, 0xEC, 0xE2, 0x1A, 0xE0,
-    0xF2, 0xE0, 0xAD, 0x36, 0x47, 0x15, 0x7A, 0x4C, 0xC6, 0x44, 0x4F, 0xCA, 0xD9, 0xE6, 0xC4, 0xEB,
-    0xFC, 0x74, 0xD6, 0x27, 0xA7, 0xFF, 0x07, 0x85, 0x52, 0x31, 0x6F, 0xD3, 0x40, 0x14, 0xFE, 0xCE,
-    0x4E, 0xE4, 0x12, 0x17, 0x8E, 0x21, 0x95, 0x50, 0x40, 0xB8, 0x03, 0x03, 0x48, 0xA9, 0xC2, 0xD0,
-    0xA1, 0x42, 0x89, 0xCF, 0x05, 0x09, 0x46, 0x3A, 0xC4, 0x33, 0x2B, 0x20, 0x66, 0xD4, 0x21, 0xD4,
-    0x2D, 0x52, 0xC5, 0xD0, 0xA1, 0xF9, 0x03, 0x48, 0x1D, 0x18, 0x28, 0x2C, 0x19, 0x2A, 0x11, 0x89,
-    0x50, 0x9B, 0x66, 0xE8, 0x88, 0x09, 0x03, 0x03, 0x48, 0x1C, 0xB4, 0x88, 0x85, 0xE1, 0x4A, 0x5D,
-    0x64, 0xA9, 0x67, 0x1F, 0xE7, 0x22, 0xA1, 0x6C, 0xBC, 0xE1, 0xA4, 0x77, 0xEF, 0xDD, 0xF7, 0x7D,
-    0xEF, 0xBB, 0xE7, 0xC2, 0xC5, 0x12, 0x40, 0xCC, 0xE1, 0x88, 0x03, 0x98, 0x81, 0x95, 0xE0, 0x98,
-    0xBB, 0x56, 0x74, 0xEA, 0x1C, 0x7B, 0xF0, 0x30, 0x9D, 0xEE, 0x62, 0x6A, 0x5E, 0x65, 0x2C, 0xEF,
-    0x02, 0x6D, 0x47, 0xE5, 0xC1, 0x8B, 0xCD, 0x19, 0x6B, 0x4D, 0xBD, 0x57, 0x71, 0xD9, 0xAB, 0xDC,
-    0xFA, 0x70, 0x24, 0x01, 0x6B, 0x77, 0x78, 0x28, 0xA4, 0x5C, 0xBC, 0x30, 0xB7, 0x01, 0x7A, 0x66,
-    0x2F, 0xE9, 0x1B, 0xDC, 0x8A, 0x24, 0x49, 0x98, 0xB7, 0xAD, 0x01, 0xD1, 0xB2, 0xA2, 0x63, 0xAE,
-    0x41, 0x5B, 0x45, 0xD2, 0x41, 0x6A, 0x24, 0x16, 0xA7, 0x71, 0x63, 0x59, 0x67, 0xA1, 0x97, 0x13,
-    0x69, 0x26, 0x96, 0xA8, 0x74, 0x8D, 0xE7, 0x4E, 0x1C, 0x9A, 0x82, 0xAD, 0x48, 0xDC, 0xF7, 0xD8,
-    0xB2, 0x13, 0xD1, 0xD8, 0x12, 0x66, 0x4A, 0xCF, 0xBF, 0xE3, 0xBD, 0x12, 0x9A, 0x46, 0xEA, 0x44,
-    0xA2, 0x8C, 0x7B, 0x0B, 0x61, 0xE6, 0x0F, 0x34, 0x4A, 0xBF, 0x62, 0xBC, 0x3D, 0x48, 0xAE, 0x82,
-    0xD0, 0x7A, 0x6B, 0x02, 0x30, 0x6F, 0x7E, 0x55, 0x76, 0x84, 0x45, 0x47, 0xC8, 0x39, 0xA0, 0x34,
-    0xB9, 0x7D, 0x09, 0x95, 0x70, 0xA8, 0xE4, 0x94, 0x8F, 0x1A, 0xDD, 0xFD, 0x95, 0xD2, 0xF5, 0x27,
-    0x1F, 0x47, 0xBF, 0x05, 0xFE, 0xEA, 0x23, 0x9B, 0xC6, 0x09, 0x2B, 0x8D, 0x59, 0x44, 0xD0, 0xA3,
-    0xF3, 0x1D, 0xF6, 0xB8, 0x0B, 0x72, 0x90, 0x88, 0x60, 0x8D, 0xA3, 0x6C, 0xED, 0x88, 0xF4, 0x51,
-    0x03, 0x8D, 0x9C, 0x65, 0xAD, 0x4E, 0xA7, 0x73, 0x05, 0x1B, 0x4B, 0x0D, 0x2F, 0x14, 0xC8, 0x41,
-    0x38, 0x48, 0x17, 0x34, 0x42, 0x10, 0x5B, 0x3F, 0xB8, 0x6B, 0x08, 0xE7, 0x34, 0x7B, 0xFA, 0x4A,
-    0xF6, 0x92, 0x9A, 0x72, 0x54, 0x04, 0xD4, 0xC2, 0x75, 0xF5, 0xDD, 0xF7, 0xE8, 0x9A, 0x7D, 0x38,
-    0xFC, 0x12, 0x7F, 0xE3, 0x4C, 0xED, 0x2A, 0xB9, 0xD0, 0xAF, 0xB7, 0xB4, 0x28, 0x98, 0x23, 0xE1,
-    0x3A, 0xD7, 0x55, 0xAA, 0x3B, 0xFD, 0xB6, 0x93, 0x37, 0xB2, 0xA6, 0x8E, 0x20, 0x0D, 0x13, 0xD2,
-    0xA6, 0x72, 0xE6, 0xE7, 0xB5, 0xCF, 0x67, 0x31, 0xD1, 0xDD, 0xA2, 0xE6, 0xDD, 0x7F, 0xC6, 0xCF,
-    0x76, 0x06, 0x1B, 0x30, 0x23, 0x6C, 0xE1, 0x22, 0x88, 0x87, 0xB1, 0x30, 0xF7, 0xB8, 0xEB, 0xDA,
-    0x9F, 0x62, 0x96, 0x31, 0x39, 0x18, 0xA4, 0x7D, 0xF2, 0x52, 0xC3, 0x0A, 0xBF, 0xAD, 0x4B, 0xB6,
-    0xE2, 0x81, 0x2A, 0xCC, 0xA5, 0xB7, 0x6F, 0x0C, 0x77, 0x0E, 0x44, 0x92, 0x36, 0x0B, 0xE7, 0xC3,
-    0x3D, 0xB5, 0xFA, 0xC6, 0x10, 0x65, 0x0D, 0x53, 0x02, 0x26, 0x61, 0x64, 0x3D, 0xA2, 0x9A, 0x78,
-    0x9D, 0x83, 0x85, 0x30, 0xB4, 0xF6, 0x18, 0xD0, 0xFF, 0xDF, 0x03, 0x66, 0x01, 0x2D, 0xB7, 0x3A,
-    0x4E, 0xA7, 0xF9, 0x35, 0x67, 0xB1, 0x1E, 0x4B, 0x63, 0x97, 0x04, 0x65, 0xCD, 0x66, 0x48, 0x4B,
-    0x65, 0xC1, 0x8A, 0xA2, 0x4A, 0xFB, 0xD9, 0xD8, 0x27, 0x45, 0x97, 0x7B, 0x52, 0x7E, 0x56, 0xB5,
-    0xB3, 0x96, 0x73, 0x47, 0xDA, 0xB6, 0x36, 0x1E, 0x0E, 0xE7, 0xEC, 0x48, 0x0C, 0x82, 0xB8, 0x5A,
-    0xF3, 0xAA, 0x7A, 0xCD, 0xFE, 0x1B, 0x06, 0x2C, 0x3D, 0xC6, 0xF4, 0xE5, 0x52, 0x91, 0xC4, 0x20,
-    0xA3, 0x7D, 0x04, 0x86, 0x52, 0x31, 0xFC, 0x05, 0xC0, 0xF7, 0xC0, 0x54, 0x6A, 0xC6, 0x64, 0xBB,
-    0x0E, 0xD4, 0xC7, 0x9F, 0xCD, 0xE9, 0x1E, 0x95, 0x51, 0x7D, 0x24, 0x38, 0x99, 0xA4, 0x88, 0x3F,
-    0xB5, 0x5A, 0x5D, 0x6C, 0x1C, 0xD7, 0x75, 0x3E, 0x77, 0x46, 0xE4, 0xD8, 0x9E, 0x46, 0x57, 0x0F,
-    0x56, 0x80, 0x58, 0x36, 0x27, 0x8F, 0xB6, 0x2B, 0x71, 0xF2, 0x60, 0x14, 0x0A, 0xB0, 0xBB, 0x33,
-    0x92, 0x80, 0x1A, 0xA8, 0x1F, 0xA4, 0x07, 0xA9, 0x45, 0x2B, 0xA0, 0xF2, 0x83, 0x51, 0x18, 0x46,
-    0x53, 0x26, 0x80, 0x0A, 0x30, 0xE8, 0x72, 0x67, 0x14, 0x3E, 0xE4, 0x21, 0x0F, 0xE2, 0x83, 0xED,
-    0x3C, 0x9A, 0x69, 0x15, 0xC0, 0xA0, 0xD0, 0x88, 0x68, 0x85, 0x82, 0x45, 0x97, 0xDC, 0x4B, 0x11,
-    0xA8, 0x1E, 0xF4, 0xC0, 0x91, 0xD8, 0xA4, 0x40, 0x05, 0x54, 0x63, 0xC9, 0x89, 0x11, 0x09, 0x28,
-    0xAF, 0xAC, 0x91, 0x3D, 0x12, 0x67, 0xF7, 0xF6, 0x3B, 0x77, 0x96, 0x34, 0x29, 0xC9, 0x4A, 0x6C,
-    0xB4, 0x6B, 0xAF, 0x48, 0xEE, 0xCE, 0xDC, 0x9F, 0x73, 0xBE, 0xF3, 0x9D, 0xEF, 0x9C, 0x3B, 0x44,
-    0x5D, 0x22, 0x57, 0x13, 0xC9, 0x8C, 0xBE, 0x78, 0xF5, 0x8C, 0x92, 0xA6, 0x10, 0xF7, 0x63, 0x0A,
-    0xF1, 0x6D, 0x4E, 0xD4, 0x39, 0x41, 0xBE, 0xC9, 0xC9, 0x54, 0x24, 0x53, 0x12, 0x05, 0x51, 0x34,
-    0x37, 0xEB, 0x1A, 0x43, 0x89, 0xD1, 0x3E, 0x7E, 0x90, 0xFB, 0x91, 0xA6, 0xE0, 0xAC, 0xA2, 0x7E,
-    0x42, 0xCE, 0xCF, 0x3E, 0xDC, 0x1C, 0x66, 0xD4, 0xF4, 0x29, 0x32, 0x9A, 0x06, 0xEF, 0x91, 0xAF,
-    0x70, 0x0F, 0x3E, 0xEA, 0xBF, 0x4D, 0x1E, 0x3E, 0x09, 0x4D, 0x4A, 0x15, 0x91, 0x87, 0xA1, 0xC3,
-    0xDB, 0xB3, 0x64, 0x4C, 0xE6, 0x61, 0x98, 0x10, 0xE3, 0xF3, 0x4B, 0xE2, 0x6F, 0x63, 0xCC, 0x99,
-    0x45, 0x22, 0x87, 0x97, 0x96, 0x12, 0x4D, 0xE1, 0x57, 0x53, 0xE2, 0x9B, 0x92, 0xA2, 0x23, 0x5A,
-    0x14, 0x9E, 0xF2, 0x55, 0x48, 0x2D, 0x51, 0x52, 0x99, 0x28, 0xEF, 0x6A, 0x9F, 0xBE, 0x39, 0x12,
-    0xE3, 0x4E, 0x81, 0x37, 0xEE, 0x38, 0x80, 0xA1, 0xD5, 0xB6, 0xFD, 0xF8, 0x18, 0xD8, 0x18, 0x15,
-    0xC4, 0x76, 0xBC, 0xA8, 0xDE, 0x71, 0x07, 0x9F, 0x63, 0xD3, 0x98, 0x32, 0x50, 0xE4, 0x94, 0xF8,
-    0x3C, 0xB6, 0x9F, 0xD3, 0xE8, 0x80, 0x70, 0x35, 0x2C, 0xD2, 0xC1, 0x97, 0x5D, 0xAC, 0xFC, 0x18,
-    0x36, 0x21, 0x8C, 0x49, 0x37, 0x37, 0x31, 0x10, 0x06, 0x9B, 0x2F, 0xB0, 0x73, 0x98, 0xA9, 0xC2,
-    0xE8, 0xF1, 0x70, 0x9E, 0xBD, 0x18, 0xCB, 0x28, 0x07, 0x9F, 0x05, 0xD9, 0x9E, 0x2D, 0xCB, 0x3E,
-    0x20, 0xBB, 0x5F, 0x7C, 0x43, 0x82, 0x2F, 0x1D, 0x88, 0xDC, 0x2B, 0x02, 0xDC, 0x6C, 0xB0, 0x9B,
-    0x1E, 0x26, 0xC3, 0x34, 0x95, 0x28, 0x1C, 0xED, 0x6A, 0x37, 0xF7, 0x32, 0x5F, 0x49, 0x25, 0xD3,
-    0x30, 0x8D, 0xE2, 0x84, 0x12, 0xA2, 0xA2, 0xF0, 0x2E, 0xAB, 0x28, 0xDA, 0xDA, 0x8B, 0x54, 0x58,
-    0x03, 0x5C, 0xE0, 0xF3, 0x4F, 0x2A, 0xC9, 0xCB, 0xD8, 0x49, 0x15, 0xBB, 0x29, 0x4C, 0xA9, 0x4F,
-    0x9E, 0xE6, 0xFD, 0xC0, 0x14, 0xA5, 0xBD, 0x96, 0x2F, 0x72, 0x8A, 0xFA, 0xD7, 0xCE, 0x8E, 0x5F,
-    0xED, 0xDA, 0xF0, 0xEB, 0xA2, 0xFD, 0x75, 0x4F, 0x98, 0x0A, 0x76, 0x2F, 0xBC, 0x9C, 0x60, 0x49,
-    0x7B, 0x63, 0xEB, 0x87, 0x1C, 0x2B, 0xC6, 0x5F, 0xA1, 0x0B, 0x0B, 0x65, 0x0D, 0xA2, 0x06, 0xCC,
-    0xEA, 0xAA, 0x05, 0xA2, 0x05, 0x69, 0x62, 0x19, 0x9B, 0xBE, 0xD0, 0x81, 0x9B, 0x8F, 0x3B, 0x79,
-    0xCB, 0xCD, 0x5A, 0x13, 0xCB, 0x95, 0x6B, 0xCA, 0x28, 0xED, 0xF5, 0x9D, 0x99, 0xCD, 0xD5, 0x8A,
-    0x7C, 0x04, 0x17, 0xE3, 0xF6, 0x26, 0xFC, 0x12, 0xD0, 0x24, 0x96, 0x7D, 0x80, 0x60, 0xBC, 0xDF,
-    0xC2, 0xC2, 0x46, 0xB7, 0x9D, 0xFB, 0x8B, 0xE3, 0x74, 0x51, 0x1E, 0x8D, 0x1B, 0xDE, 0x8A, 0x0A,
-    0x4E, 0xDE, 0x05, 0x9A, 0x8A, 0x05, 0xD7, 0xE4, 0xCF, 0x0F, 0x6F, 0xC7, 0x95, 0x55, 0x62, 0xCC,
-    0x15, 0xB6, 0x54, 0x54, 0xE3, 0xA5, 0x6F, 0xB1, 0xCA, 0xCB, 0x0A, 0x4D, 0xE1, 0xF6, 0x65, 0x1A,
-    0x51, 0xE1, 0x69, 0x19, 0x2F, 0x39, 0x5A, 0x66, 0x91, 0xA8, 0x18, 0xAE, 0xB4, 0x07, 0xB7, 0x62,
-    0x6B, 0x58, 0xB1, 0x93, 0xDB, 0x81, 0xBA, 0xA1, 0x72, 0xEF, 0xC2, 0x2D, 0x47, 0x15, 0x55, 0x7D,
-    0x72, 0xD7, 0x61, 0x34, 0x0C, 0x84, 0xFD, 0x79, 0xBC, 0x3D, 0x98, 0xCA, 0x14, 0x00, 0x66, 0x41,
-    0xD1, 0x84, 0xA6, 0x2A, 0xD2, 0x7E, 0xDE, 0xD3, 0xB5, 0xB1, 0xF8, 0xED, 0x16, 0x76, 0x8C, 0x8A,
-    0x8E, 0xBB, 0xB9, 0xCC, 0x83, 0xB8, 0x17, 0x77, 0xBD, 0xCA, 0xD5, 0x89, 0x96, 0xD3, 0x26, 0xED,
-    0x46, 0x7D, 0xF7, 0xDE, 0xE7, 0x5A, 0x5E, 0x98, 0x50, 0x49, 0x31, 0x70, 0xCC, 0x8F, 0x0B, 0x59,
-    0x45, 0x2A, 0x51, 0xC6, 0xE9, 0xFB, 0xB8, 0x6F, 0x84, 0x62, 0x7A, 0xB8, 0x08, 0x53, 0xA6, 0x14,
-    0x6E, 0x0F, 0xB1, 0xBD, 0xF4, 0xBC, 0xD0, 0x1E, 0x1C, 0x5D, 0x52, 0x15, 0x92, 0x5C, 0xC9, 0x68,
-    0xA9, 0x8B, 0x15, 0xC0, 0x5F, 0x39, 0xB9, 0xC0, 0x24, 0x7C, 0xC9, 0x0E, 0xC2, 0x5A, 0x01, 0x9B,
-    0x48, 0x93, 0xF7, 0xF1, 0xD0, 0xFD, 0x71, 0x04, 0xA0, 0xE4, 0x11, 0x4D, 0xB9, 0xB9, 0xAF, 0xA6,
-    0xA8, 0x04, 0x5C, 0xE2, 0x4A, 0x68, 0x20, 0x46, 0x14, 0x6E, 0x1E, 0xE2, 0x73, 0x20, 0x2B, 0x32,
-    0x95, 0x73, 0xE1, 0x76, 0x4C, 0xEC, 0x6D, 0xDC, 0x34, 0xCB, 0x77, 0x02, 0x25, 0xC0, 0x06, 0x01,
-    0x81, 0x21, 0xF6, 0xBA, 0x9A, 0x52, 0x59, 0x52, 0x28, 0x95, 0x97, 0x03, 0x7D, 0x52, 0x21, 0xF6,
-    0x3C, 0x1B, 0x76, 0xFD, 0x28, 0x95, 0x9F, 0x20, 0x66, 0xE9, 0xC4, 0x71, 0x00, 0xD9, 0xBD, 0x7F,
-    0x0C, 0x06, 0x05, 0xC6, 0x7C, 0xC0, 0xDF, 0xE4, 0x72, 0x5A, 0x4B, 0x91, 0x07, 0x6E, 0x16, 0xF2,
-    0x1C, 0x14, 0x61, 0x51, 0x27, 0x10, 0x98, 0xDA, 0x55, 0x0D, 0x37, 0x6D, 0x78, 0xF1, 0x02, 0x5F,
-    0x63, 0xD2, 0xDD, 0x7F, 0x9A, 0xBF, 0x44, 0x7A, 0xBF, 0xA3, 0x5B, 0x17, 0x74, 0x62, 0xB2, 0xDE,
-    0x20, 0xFE, 0x5A, 0x81, 0x08, 0xFC, 0x09, 0x50, 0x48, 0x78, 0x52, 0xB9, 0x79, 0x97, 0xDA, 0x12,
-    0x01, 0x58, 0x50, 0x19, 0xC4, 0xF2, 0xB0, 0x76, 0x74, 0x44, 0x8B, 0x5E, 0x9E, 0xDC, 0x36, 0x6F,
-    0x00, 0x47, 0x3D, 0x33, 0xF0, 0x41, 0x08, 0x6F, 0xD3, 0x87, 0xDB, 0x66, 0x89, 0x83, 0xE3, 0x76,
-    0x96, 0x16, 0xF6, 0xFD, 0xEB, 0x63, 0x1C, 0x68, 0x12, 0xA6, 0xC4, 0xF0, 0x98, 0xDD, 0x7D, 0x38,
-    0xC7, 0xCC, 0xC4, 0xA4, 0xD3, 0x03, 0x1D, 0x91, 0xAF, 0xCD, 0xD5, 0x0A, 0xE6, 0x31, 0x2B, 0x05,
-    0xBC, 0x6D, 0xCE, 0x66, 0xE4, 0xF4, 0x4D, 0x02, 0xDE, 0x19, 0x98, 0x25, 0x62, 0x36, 0xA8, 0x2C,
-    0x2B, 0xF2, 0xA2, 0x22, 0xA3, 0x6A, 0x86, 0xB4, 0xE8, 0xD4, 0x1C, 0xF1, 0x00, 0x27, 0xF5, 0x56,
-    0x3F, 0x19, 0xC0, 0x7F, 0x72, 0xCD, 0xC4, 0x61, 0x15, 0x2C, 0xE3, 0xEB, 0xDE, 0x8C, 0x67, 0xD4,
-    0x2E, 0x19, 0x03, 0xFA, 0xF0, 0x18, 0x96, 0x53, 0x30, 0x37, 0xB9, 0x59, 0x9A, 0xB8, 0xA6, 0x02,
-    0x19, 0x30, 0xEA, 0xBE, 0x2E, 0xAA, 0x28, 0xDE, 0x43, 0xF2, 0x3C, 0x22, 0x1E, 0x80, 0x09, 0x2D,
-    0xC2, 0x5D, 0x2D, 0x8E, 0x21, 0x16, 0xD2, 0x29, 0xA7, 0xEF, 0xE8, 0x40, 0x4B, 0xAC, 0xA0, 0x25,
-    0x07, 0x8E, 0x36, 0x85, 0x5C, 0xBD, 0xA1, 0x5A, 0x8B, 0x3D, 0x61, 0xD6, 0x4A, 0x7F, 0x10, 0x64,
-    0x91, 0x36, 0xA0, 0xAF, 0xCA, 0x2F, 0x18, 0x8E, 0xA1, 0x0F, 0xB8, 0x27, 0xE4, 0xAD, 0x69, 0x8A,
-    0x60, 0xF5, 0x8D, 0xC2, 0x92, 0x59, 0x54, 0x22, 0xBE, 0x52, 0xF2, 0x11, 0x1A, 0x51, 0x9F, 0xD8,
-    0x05, 0xF2, 0x7A, 0x45, 0x91, 0xAC, 0x9C, 0x32, 0x84, 0x21, 0x46, 0x4E, 0x1C, 0xB3, 0x56, 0x80,
-    0xF1, 0xBC, 0x1C, 0x18, 0x82, 0xF3, 0xAA, 0x88, 0x18, 0x47, 0x21, 0x80, 0x02, 0x34, 0x7B, 0x19,
-    0xAE, 0xF6, 0x72, 0xA7, 0x0A, 0xE3, 0x10, 0xBF, 0xF6, 0xDD, 0x7C, 0x98, 0x56, 0xE0, 0xF1, 0x48,
-    0x85, 0x4A, 0xEA, 0x20, 0xF7, 0x2A, 0x59, 0xB8, 0xE6, 0x28, 0x1C, 0x75, 0xC7, 0x50, 0xC7, 0xAC,
-    0xAB, 0x30, 0xFA, 0x3C, 0x97, 0xAB, 0x9F, 0x15, 0xEE, 0xAD, 0xAA, 0x72, 0x0A, 0x0C, 0x88, 0x68,
-    0x45, 0x6C, 0xFB, 0xC3, 0xA0, 0xE9, 0x22, 0x05, 0x80, 0x8D, 0xC1, 0x6A, 0xF8, 0x16, 0x51, 0xAE,
-    0x9D, 0x12, 0x74, 0x59, 0xF8, 0x39, 0x62, 0xFF, 0xE1, 0x05, 0x8D, 0x94, 0x91, 0xC3, 0x11, 0xC0,
-    0x25, 0x80, 0x99, 0xC2, 0x52, 0x31, 0x78, 0x88, 0x92, 0x98, 0x44, 0x6F, 0x06, 0x7E, 0x1A, 0x90,
-    0xDB, 0x9F, 0xC8, 0x5C, 0xBE, 0x11, 0x31, 0x0E, 0x10, 0x48, 0xB5, 0x48, 0x1C, 0x45, 0x4E, 0x01,
-    0x0A, 0xAC, 0xBC, 0x72, 0x14, 0x9C, 0x0E, 0xC8, 0x44, 0xCC, 0xF2, 0x78, 0xD3, 0xC4, 0x60, 0x33,
-    0x4E, 0x4F, 0xC4, 0x12, 0x06, 0x60, 0xD0, 0x52, 0x17, 0x14, 0x93, 0xB6, 0x40, 0x37, 0x59, 0x48,
-    0x5D, 0x57, 0x4B, 0xD5, 0xA2, 0xD2, 0xCB, 0x82, 0x98, 0x3F, 0x57, 0x18, 0xD5, 0x99, 0x7D, 0xC1,
-    0x02, 0xDD, 0x63, 0xEF, 0x23, 0x81, 0xA4, 0xA5, 0x28, 0xFC, 0x34, 0xC4, 0x4A, 0x6D, 0xAA, 0xCC,
-    0x40, 0x6E, 0x34, 0x78, 0x77, 0x1B, 0xCA, 0xBD, 0x82, 0x8D, 0xB2, 0x49, 0x95, 0x3D, 0x50, 0x2F,
-    0x4F, 0x5F, 0x01, 0x3A, 0x7B, 0xF8, 0x2B, 0x5C, 0xE1, 0xC0, 0xDE, 0x12, 0xE6, 0x8B, 0x90, 0x76,
-    0x0D, 0x7D, 0xDB, 0xB5, 0x29, 0x67, 0x00, 0xCC, 0x15, 0xF0, 0x7D, 0x06, 0x37, 0x98, 0xCB, 0x00,
-    0x67, 0x0F, 0x4B, 0x66, 0x23, 0x2F, 0xD6, 0x8C, 0xCE, 0x91, 0x94, 0x5A, 0xD6, 0x8A, 0xEA, 0x98,
-    0x5F, 0xAA, 0x39, 0xB3, 0xCE, 0xAE, 0x20, 0x82, 0xB6, 0x28, 0x65, 0x2A, 0x97, 0xE1, 0xFB, 0x26,
-    0xF9, 0xD7, 0x15, 0x25, 0x40, 0x3D, 0x3B, 0x7B, 0xB8, 0x30, 0x7B, 0x75, 0x84, 0x94, 0x02, 0x74,
-    0x75, 0xE2, 0xE1, 0xE2, 0xCC, 0xA1, 0x87, 0x0F, 0x2E, 0xEA, 0x6A, 0xF7, 0xE9, 0x48, 0x9E, 0xEA,
-    0x99, 0x15, 0xD8, 0x1A, 0x3B, 0xE2, 0x21, 0x97, 0xEC, 0x42, 0x31, 0x2F, 0xCF, 0x84, 0x68, 0x43,
-    0x7C, 0xAA, 0x20, 0x75, 0x30, 0x03, 0x20, 0xA3, 0x48, 0xDE, 0xC0, 0xA8, 0x1C, 0x2D, 0x49, 0x56,
-    0x6F, 0x45, 0xF2, 0x96, 0x60, 0x62, 0xB9, 0xAE, 0x49, 0xDE, 0xEC, 0x53, 0xA0, 0x23, 0x05, 0xC0,
-    0x62, 0xB5, 0x7B, 0x44, 0x2C, 0xD3, 0x36, 0xC1, 0x66, 0x01, 0x21, 0x1D, 0x4A, 0x6A, 0x21, 0x70,
-    0xB2, 0x16, 0xB5, 0xDD, 0x4C, 0xAA, 0x36, 0x95, 0x18, 0x37, 0x2E, 0x1D, 0x78, 0x1A, 0xF4, 0xC6,
-    0x96, 0xA8, 0x95, 0x48, 0xBD, 0xBE, 0xF8, 0xF9, 0x31, 0x91, 0x5F, 0xF4, 0x8F, 0xA8, 0xC6, 0x4B,
-    0x42, 0xCF, 0xCB, 0xE9, 0xE5, 0xBE, 0x34, 0x1A, 0x51, 0xF6, 0xAD, 0x53, 0xC8, 0x3F, 0x88, 0x3A,
-    0xE6, 0xC1, 0xE7, 0x69, 0x17, 0x76, 0x0C, 0xA7, 0xB5, 0x9B, 0x42, 0x77, 0xDB, 0x8E, 0x2E, 0xBB,
-    0x6E, 0x5E, 0x94, 0xDE, 0x55, 0x5D, 0xF8, 0x97, 0xB4, 0x96, 0x2B, 0x1F, 0x21, 0xF6, 0xAE, 0xE5,
-    0x81, 0xB7, 0x52, 0xE3, 0x08, 0xEF, 0x57, 0xE7, 0xE6, 0x62, 0xAA, 0x5E, 0x09, 0xA9, 0x9C, 0x6A,
-    0x89, 0xA2, 0xDB, 0xC4, 0x3D, 0x6D, 0xDC, 0xB3, 0xE0, 0xE2, 0x1E, 0x0F, 0xF7, 0xF8, 0x7C, 0xCF,
-    0x91, 0x6B, 0xB9, 0xAC, 0xEF, 0x29, 0xA2, 0xFA, 0x0D, 0x4B, 0x60, 0x4A, 0xAB, 0x7A, 0x9E, 0x8B,
-    0x61, 0xC9, 0x04, 0x7B, 0x9E, 0x24, 0xB2, 0x0C, 0x20, 0x4C, 0xCE, 0xC4, 0x9A, 0xB5, 0x5D, 0xD5,
-    0xF5, 0x7E, 0x55, 0xFA, 0x46, 0xB3, 0x35, 0xEA, 0x5D, 0x70, 0x68, 0x83, 0xC9, 0x78, 0x57, 0xC8,
-    0x5D, 0xA5, 0x60, 0xEA, 0xF5, 0x59, 0x85, 0xE1, 0xAF, 0x0A, 0x37, 0x82, 0xF3, 0xB1, 0xAB, 0xB8,
-    0xE9, 0xA9, 0x8A, 0x74, 0xE8, 0x6A, 0xDC, 0x1F, 0x80, 0xBA, 0xD5, 0x80, 0x4C, 0x39, 0xCC, 0x52,
-    0xCC, 0xF6, 0xC8, 0x7D, 0x63, 0x44, 0x17, 0xF9, 0x67, 0x30, 0x00, 0x14, 0x31, 0x99, 0x74, 0xF4,
-    0xD4, 0xC4, 0x8F, 0x4C, 0x35, 0x9C, 0x6B, 0xF4, 0x81, 0x4D, 0xA1, 0xC1, 0x99, 0x3E, 0x15, 0xA2,
-    0x1C, 0x41, 0x2C, 0x58, 0x81, 0x03, 0xA4, 0xD7, 0x92, 0x4B, 0x19, 0xD1, 0x07, 0x3B, 0x72, 0x5C,
-    0x21, 0x28, 0x00, 0xB6, 0x87, 0x5B, 0x30, 0x25, 0x91, 0x25, 0xB9, 0x7B, 0x0D, 0x13, 0x5E, 0xC9,
-    0xDB, 0xDE, 0xD9, 0xB4, 0xE1, 0x1B, 0x6A, 0xC8, 0x3E, 0x4D, 0xC2, 0xB1, 0x65, 0x80, 0x58, 0xD8,
-    0xDF, 0x39, 0xA9, 0x1B, 0x89, 0x51, 0x07, 0x23, 0x13, 0x9F, 0xF6, 0xCB, 0x4D, 0x4D, 0xC9, 0xAA,
-    0x4F, 0x09, 0x3D, 0x8E, 0x14, 0x56, 0xB2, 0x4B, 0x45, 0x11, 0x20, 0x52, 0x58, 0x72, 0x68, 0x2C,
-    0x31, 0xF5, 0x32, 0x88, 0x45, 0x84, 0x75, 0x15, 0xAA, 0x20, 0x37, 0x64, 0x8E, 0x94, 0x5B, 0x33,
-    0x0E, 0xF2, 0xD0, 0x9C, 0xD1, 0x53, 0x92, 0x8A, 0x8B, 0xEE, 0x8A, 0x4A, 0xA0, 0xB9, 0x42, 0x93,
-    0x87, 0x37, 0x86, 0x49, 0xE5, 0x19, 0x12, 0x13, 0xB1, 0x53, 0xAB, 0x53, 0x00, 0xD1, 0xFF, 0xA5,
-    0x55, 0x6F, 0x81, 0x29, 0x9D, 0x3E, 0x6C, 0x13, 0x83, 0x2A, 0xC0, 0x23, 0xAF, 0x17, 0x8E, 0x19,
-    0xD4, 0x59, 0x78, 0x06, 0x70, 0x4C, 0xE5, 0xF9, 0x74, 0x72, 0xCC, 0xD9, 0x60, 0xD3, 0x4F, 0xCA,
-    0xC3, 0xBF, 0xE9, 0x22, 0xD5, 0x40, 0xF6, 0x38, 0xA6, 0x0F, 0x6E, 0x1E, 0x26, 0x3C, 0xC5, 0x98,
-    0xC6, 0xFF, 0xC8, 0xC4, 0x18, 0x76, 0x28, 0xC0, 0x60, 0x4E, 0x50, 0x62, 0xBB, 0x4B, 0x65, 0x45,
-    0x45, 0xE9, 0xDE, 0x2D, 0xE4, 0x25, 0x64, 0x9F, 0x7E, 0xCF, 0x54, 0x4B, 0x73, 0xC5, 0x02, 0x9B,
-    0x0E, 0xF1, 0x95, 0x89, 0x41, 0xE1, 0x7D, 0x34, 0x09, 0xB1, 0x1A, 0xCC, 0xBD, 0x1B, 0x42, 0x5A,
-    0xB1, 0x1D, 0xE1, 0xF4, 0xD8, 0x29, 0x5A, 0xEE, 0x55, 0x30, 0x58, 0xE4, 0x5F, 0xC6, 0x9E, 0x23,
-    0xF9, 0x01, 0x52, 0x7B, 0x12, 0x26, 0x1C, 0x0F, 0x11, 0xCB, 0x61, 0x63, 0x55, 0x87, 0x19, 0xE6,
-    0x16, 0x65, 0x73, 0x0B, 0x3E, 0xE9, 0xAD, 0x6F, 0x20, 0x39, 0x99, 0xE0, 0x16, 0x24, 0x72, 0x15,
-    0x82, 0xD9, 0x45, 0x9F, 0xDE, 0x57, 0x34, 0x2F, 0x2E, 0x42, 0x29, 0xF8, 0xF4, 0x53, 0xD5, 0xCB,
-    0x91, 0x04, 0x1C, 0xE4, 0x90, 0x22, 0x50, 0x8D, 0x40, 0x07, 0x41, 0xE9, 0x9F, 0x5D, 0x74, 0xD7,
-    0x57, 0x0F, 0x99, 0xCB, 0xAA, 0xB7, 0x82, 0xF8, 0x42, 0xE8, 0x4C, 0xD9, 0xF5, 0xEF, 0xD9, 0x45,
-    0x0F, 0x97, 0xA8, 0x57, 0xD5, 0x59, 0xC3, 0x4D, 0x67, 0xBD, 0x23, 0xB9, 0xEF, 0x67, 0x32, 0x54,
-    0x63, 0x7F, 0xA7, 0xC6, 0xEF, 0xA4, 0xD1, 0x6A, 0x1C, 0x05, 0x34, 0x85, 0xDD, 0x62, 0x8F, 0x9F,
-    0x69, 0xB1, 0x01, 0x35, 0xCB, 0x7A, 0x04, 0x49, 0x07, 0x2E, 0x0E, 0x93, 0xB4, 0x89, 0x1B, 0xE7,
-    0x66, 0x82, 0xCA, 0x59, 0x53, 0x8D, 0x49, 0xF7, 0x4A, 0x7C, 0x51, 0x4B, 0x29, 0x6E, 0xE6, 0x53,
-    0xCD, 0x11, 0x61, 0xFD, 0x81, 0x88, 0x8A, 0x0E, 0x17, 0xC1, 0xD5, 0xCA, 0x2F, 0x8D, 0x3B, 0xE8,
-    0xA9, 0x8D, 0x41, 0xFE, 0xC3, 0x7E, 0xD1, 0x4A, 0xDA, 0xF2, 0x54, 0xE4, 0x5D, 0x3A, 0x9A, 0xD6,
-    0x1A, 0xA6, 0x2D, 0x34, 0x88, 0x91, 0x20, 0x58, 0x30, 0x99, 0xA3, 0xFD, 0xDB, 0x4B, 0x5C, 0x03,
-    0x04, 0x50, 0x2D, 0xE0, 0xE3, 0x88, 0xA5, 0x2B, 0x8C, 0x68, 0x4A, 0x2F, 0xEF, 0xE2, 0xDA, 0x80,
-    0xCA, 0xF0, 0x24, 0x04, 0x33, 0x94, 0x85, 0x72, 0x1E, 0xB0, 0x7D, 0x62, 0x18, 0x07, 0xA1, 0x18,
-    0xB0, 0xFA, 0x69, 0x42, 0xF4, 0x08, 0xDC, 0xC5, 0x13, 0xE3, 0x67, 0xDA, 0xDD, 0x92, 0x58, 0x2D,
-    0x03, 0x8C, 0x5F, 0x40, 0x6E, 0xDF, 0x0F, 0x07, 0xCE, 0x53, 0xE5, 0x2A, 0x4F, 0x8F, 0x51, 0x88,
-    0x24, 0x67, 0xA1, 0x0E, 0x45, 0xB9, 0x77, 0x87, 0x34, 0x9E, 0xAD, 0x6F, 0x73, 0xFA, 0xC2, 0x40,
-    0xFA, 0xCB, 0x54, 0x00, 0xB1, 0xE4, 0x3C, 0x98, 0x09, 0x0C, 0x4D, 0x00, 0x81, 0x55, 0x64, 0xCA,
-    0x3D, 0x5D, 0x96, 0xDC, 0x88, 0x63, 0x78, 0x1A, 0x12, 0xA5, 0x46, 0xCA, 0xB0, 0x74, 0x2A, 0x59,
-    0xC0, 0x07, 0xC0, 0x4D, 0x49, 0xC1, 0x4F, 0xE0, 0xD8, 0x26, 0x70, 0xA8, 0xB1, 0x5A, 0xF8, 0x75,
-    0x28, 0xC5, 0xA7, 0x2C, 0x1B, 0xFB, 0x2C, 0xF2, 0x30, 0x6D, 0x9D, 0x61, 0x32, 0x54, 0x49, 0x08,
-    0xD1, 0xA5, 0x1E, 0x58, 0xA8, 0xD1, 0xF4, 0xCF, 0x68, 0xDD, 0x94, 0x2B, 0xBF, 0xB9, 0xDF, 0x47,
-    0x16, 0xCA, 0x78, 0x8D, 0x5C, 0xCE, 0x70, 0x2D, 0x33, 0x8E, 0x6B, 0x8F, 0x33, 0x43, 0x40, 0xEF,
-    0x5D, 0xD2, 0xD4, 0x46, 0xFA, 0x62, 0x25, 0x97, 0x59, 0xB1, 0xC8, 0x99, 0xA0, 0x47, 0x72, 0xAD,
-    0x70, 0x0B, 0xAB, 0xFD, 0xB1, 0x88, 0x2E, 0xB2, 0x8F, 0x04, 0x1E, 0x40, 0x13, 0x42, 0x37, 0x9D,
-    0xBC, 0xE1, 0x82, 0xAF, 0x0B, 0x48, 0x98, 0x77, 0x20, 0x1B, 0x30, 0xA0, 0x9F, 0xEE, 0xDA, 0xB5,
-    0x7F, 0xFF, 0x6B, 0x07, 0xBF, 0x73, 0xFA, 0x07, 0x90, 0x1C, 0xAF, 0xCE, 0x52, 0x26, 0x94, 0xA3,
-    0xCF, 0x21, 0xAD, 0x01, 0xD6, 0x96, 0xDC, 0xEE, 0x82, 0x10, 0x6F, 0x3E, 0x91, 0x10, 0x1F, 0xBF,
-    0x6E, 0x07, 0x71, 0x5A, 0x02, 0x7C, 0x75, 0x0E, 0xF3, 0x58, 0x02, 0xE4, 0x9D, 0x8F, 0xD0, 0x37,
-    0xC1, 0xF1, 0xB4, 0x9F, 0x76, 0x93, 0xFB, 0x1F, 0xC2, 0xA8, 0xF9, 0x8B, 0x8D, 0xA6, 0x34, 0x5E,
-    0x6D, 0x02, 0x01, 0x50, 0x34, 0x3D, 0x90, 0xD5, 0x3C, 0xB5, 0x77, 0x93, 0x1F, 0xFF, 0x9A, 0x74,
-    0x50, 0x49, 0xE7, 0xD2, 0xB2, 0x3E, 0xD8, 0x68, 0x79, 0x66, 0x3A, 0xEB, 0xE5, 0xED, 0x61, 0x39,
-    0x40, 0x1E, 0xF0, 0x2E, 0x01, 0xBF, 0xFD, 0x2F, 0x35, 0x0E, 0x44, 0x55, 0x52, 0x0B, 0x8B, 0xA4,
-    0x78, 0xCE, 0x32, 0xDE, 0x68, 0x1E, 0x22, 0xD1, 0x5F, 0x12, 0x65, 0x34, 0x10, 0x9B, 0x35, 0x99,
-    0xB3, 0x3C, 0xA0, 0x4F, 0x4D, 0xF6, 0x5D, 0x7D, 0x30, 0x28, 0x76, 0xFB, 0xA5, 0x77, 0xE4, 0x1F,
-    0x5D, 0x75, 0xE5, 0x4E, 0xFE, 0x03, 0xA3, 0x5F, 0x0E, 0xEA, 0xBB, 0x4F, 0x80, 0x9A, 0x0E, 0xF8,
-    0x87, 0xD5, 0xE9, 0x71, 0x2F, 0x35, 0x95, 0x6F, 0x96, 0x75, 0x15, 0xC9, 0x15, 0xDD, 0x4F, 0xE0,
-    0x57, 0x2E, 0x77, 0xB4, 0x4D, 0xA8, 0x3B, 0x5F, 0x5F, 0x1E, 0xE2, 0x84, 0x62, 0x06, 0x05, 0x9B,
-    0x7B, 0x4F, 0xEF, 0xBC, 0xA3, 0x17, 0xE3, 0x0E, 0x51, 0xFE, 0x25, 0x63, 0xAF, 0x33, 0x77, 0x0C,
-    0xB7, 0x58, 0x95, 0x3A, 0x20, 0x1F, 0x94, 0x0B, 0xA8, 0x4C, 0x1D, 0xF3, 0x4C, 0xEE, 0x0F, 0x62,
-    0x80, 0xCE, 0xD9, 0x80, 0x32, 0xAA, 0xBC, 0xA2, 0x2D, 0x55, 0x03, 0xF9, 0x30, 0x8C, 0x4B, 0x00,
-    0x1B, 0xD4, 0xB8, 0xF4, 0x87, 0x9A, 0x2B, 0x81, 0x44, 0xD3, 0xBE, 0x3A, 0x5F, 0xE0, 0x52, 0x76,
-    0x24, 0xAC, 0xFB, 0xBB, 0x89, 0xAB, 0x17, 0xB7, 0x16, 0x65, 0xFC, 0xD1, 0xFD, 0x38, 0xEC, 0x73,
-    0x35, 0x36, 0x3A, 0x6D, 0x4A, 0x88, 0xC7, 0x5F, 0xD8, 0xA2, 0xD9, 0xA4, 0xC1, 0x79, 0x64, 0x0B,
-    0x01, 0x8E, 0xEF, 0xE1, 0x1E, 0x77, 0x03, 0x50, 0xCF, 0x26, 0x6A, 0xFE, 0x7D, 0x0E, 0xE3, 0x31,
-    0x2B, 0xDB, 0x3F, 0xC6, 0x10, 0xBA, 0x2E, 0x38, 0x1C, 0x19, 0xB5, 0x89, 0x6A, 0x4E, 0xE2, 0x1B,
-    0xC2, 0x66, 0xAB, 0x2A, 0xF8, 0x20, 0x1D, 0x5E, 0x80, 0xB4, 0xD7, 0x60, 0xB3, 0x2D, 0xE0, 0x52,
-    0x5C, 0x18, 0xD5, 0x4A, 0xFE, 0x2D, 0x0E, 0x95, 0x60, 0xE8, 0x12, 0x54, 0x84, 0x6D, 0xAE, 0xCB,
-    0x20, 0x8D, 0x1B, 0x5B, 0x3F, 0x85, 0xFD, 0xD9, 0xA6, 0x7D, 0xE0, 0xF1, 0xD8, 0xAD, 0xE7, 0x3E,
-    0x91, 0x72, 0xA0, 0xBC, 0xF8, 0x22, 0xF9, 0xCF, 0x91, 0x3B, 0xDD, 0xA7, 0xEC, 0x13, 0x35, 0x3F,
-    0x3F, 0x7F, 0xB0, 0x55, 0x36, 0x64, 0xF9, 0x2C, 0xC3, 0x21, 0x8E, 0x7D, 0x27, 0x95, 0x6E, 0x2C,
-    0x4F, 0xC5, 0xE0, 0x8E, 0xFD, 0xF2, 0x6F, 0x0E, 0x7E, 0x63, 0xEC, 0xB5, 0xB1, 0xEE, 0xF7, 0x43,
-    0x9B, 0x0A, 0x7F, 0x4F, 0xAB, 0xF2, 0x02, 0x47, 0x98, 0x0B, 0x39, 0x5D, 0xD6, 0xE5, 0x62, 0x80,
-    0x8A, 0x6C, 0x82, 0xBC, 0x75, 0x1B, 0xBD, 0x86, 0x8D, 0xC7, 0x0B, 0x01, 0xFB, 0xC9, 0x37, 0xCA,
-    0x3A, 0x1C, 0xAB, 0x1A, 0xD7, 0x9B, 0xAF, 0x71, 0x30, 0xCF, 0xA1, 0xCA, 0x5D, 0x36, 0xE2, 0xAE,
-    0x49, 0x17, 0x36, 0xB2, 0x56, 0x55, 0x04, 0x55, 0xDB, 0xAF, 0x22, 0xB7, 0x92, 0x69, 0xE5, 0x0D,
-    0x35, 0x6C, 0x7E, 0x80, 0x38, 0x49, 0x71, 0x2A, 0xAC, 0x0B, 0xEC, 0x9D, 0x2F, 0x10, 0x08, 0xA4,
-    0xA8, 0x22, 0x84, 0x2E, 0x75, 0x50, 0xAD, 0x31, 0x83, 0x70, 0x5A, 0x08, 0xB9, 0xC8, 0xC8, 0xEB,
-    0x09, 0xD9, 0x86, 0xC8, 0x17, 0x2C, 0xC3, 0x99, 0x43, 0xA2, 0xDA, 0xEC, 0xD2, 0xC9, 0x0E, 0xE2,
-    0xDD, 0x40, 0x6D, 0xD6, 0xF0, 0x0F, 0xE1, 0x1D, 0xEB, 0xC8, 0x00, 0xCC, 0x08, 0x38, 0x16, 0x1C,
-    0x35, 0x1B, 0x22, 0xC9, 0xAE, 0x9A, 0x12, 0x70, 0x01, 0x3F, 0x99, 0xC3, 0xA0, 0x33, 0x67, 0x2D,
-    0x6F, 0x46, 0x50, 0x72, 0x25, 0x2A, 0xB9, 0x77, 0x62, 0x3A, 0xC6, 0x50, 0x6A, 0xB2, 0x06, 0xE9,
-    0x99, 0x18, 0x45, 0x93, 0x99, 0xF5, 0x8C, 0x0E, 0x0F, 0xE7, 0x95, 0x7F, 0xE4, 0x21, 0x64, 0x03,
-    0x46, 0x8C, 0x5F, 0x3D, 0x47, 0xF4, 0xC2, 0xDC, 0xDC, 0x0C, 0x92, 0xD3, 0x80, 0xB5, 0x67, 0x66,
-    0xAB, 0x11, 0x79, 0x8F, 0x57, 0x33, 0xE0, 0xBA, 0x2B, 0xE3, 0xBC, 0x05, 0xEB, 0x94, 0x50, 0xD9,
-    0xC1, 0xD1, 0xD4, 0xBB, 0xA6, 0x51, 0x5C, 0x42, 0x05, 0x46, 0x6F, 0xE4, 0xD5, 0xF6, 0xEE, 0x12,
-    0xD7, 0x5E, 0x6B, 0x39, 0xF5, 0x32, 0x46, 0x73, 0xE7, 0x06, 0x35, 0x3E, 0x55, 0x07, 0x0E, 0xCE,
-    0x07, 0x07, 0x9A, 0xF5, 0x15, 0x49, 0x3C, 0x8B, 0x7C, 0xF7, 0x7A, 0x0E, 0x56, 0x8B, 0x48, 0x94,
-    0x48, 0x57, 0x7E, 0x86, 0x74, 0x18, 0x3E, 0xF8, 0x10, 0xE3, 0xF3, 0x64, 0x77, 0x4A, 0x28, 0x63,
-    0x97, 0x3B, 0x1D, 0x30, 0xCA, 0x92, 0x45, 0x19, 0xA4, 0xA8, 0x54, 0x08, 0xD9, 0xE4, 0x3D, 0xF6,
-    0x19, 0x24, 0x8B, 0xCB, 0x3A, 0xDE, 0x63, 0x0A, 0x75, 0x2C, 0xCF, 0x78, 0x79, 0x41, 0xC9, 0x2D,
-    0xE5, 0x22, 0x8B, 0xCA, 0xD7, 0x35, 0xCF, 0xCD, 0xFD, 0x8D, 0x25, 0xC0, 0x3B, 0x0B, 0x00, 0xE6,
-    0x92, 0x16, 0x27, 0x32, 0xD6, 0x44, 0x2E, 0xB3, 0xF6, 0x83, 0x2F, 0x42, 0x9D, 0x7B, 0x28, 0xB7,
-    0x90, 0x0A, 0xB0, 0x95, 0x40, 0x45, 0x31, 0x4F, 0x22, 0x73, 0xB7, 0x44, 0xE5, 0xB4, 0x04, 0x91,
-    0x1E, 0xAE, 0x94, 0xE4, 0x7F, 0x5A, 0x61, 0x8E, 0x3E, 0xEF, 0x8C, 0x53, 0x36, 0x74, 0xBD, 0x61,
-    0xB9, 0x3E, 0xD4, 0xBC, 0x78, 0x01, 0xAC, 0x8B, 0x93, 0x82, 0x15, 0x5F, 0x5B, 0x52, 0xBB, 0xC5,
-    0xB9, 0xB5, 0x55, 0x70, 0xA5, 0x0F, 0xC5, 0x8D, 0x10, 0xA5, 0x97, 0xA9, 0xFD, 0x4E, 0x89, 0x25,
-    0x6B, 0xE0, 0x94, 0x23, 0x01, 0x6E, 0xB0, 0x2D, 0xB8, 0x8A, 0x05, 0x61, 0x58, 0x57, 0xC9, 0xC3,
-    0xF6, 0x47, 0x2D, 0xF1, 0xC5, 0xB0, 0x43, 0xB0, 0xA5, 0x7F, 0xC9, 0xC2, 0x12, 0x99, 0x14, 0xB2,
-    0x0C, 0x22, 0xAE, 0xB4, 0xC9, 0x26, 0xB4, 0xD7, 0xE2, 0x66, 0x56, 0xF5, 0xFD, 0x6D, 0x97, 0x3E,
-    0x52, 0x88, 0x0F, 0x25, 0xF5, 0x13, 0x0A, 0xF1, 0x7A, 0x0A, 0x31, 0x97, 0xA2, 0x1C, 0x4D, 0x1D,
-    0x53, 0x04, 0xEF, 0xD9, 0x36, 0x0E, 0xA2, 0x64, 0xD3, 0x53, 0x10, 0x62, 0x06, 0x39, 0xC9, 0x76,
-    0x09, 0x8B, 0x7A, 0x56, 0xA8, 0x2B, 0x53, 0x78, 0x45, 0xE4, 0xE0, 0xF3, 0xCA, 0xC9, 0xA1, 0x9B,
-    0x83, 0xD7, 0x2B, 0xFF, 0x52, 0x25, 0xDE, 0x3C, 0x0E, 0xCB, 0xB8, 0xBF, 0x8C, 0x73, 0xFA, 0x5B,
-    0x0A, 0x0B, 0x79, 0xD4, 0x9D, 0x5E, 0xFE, 0xF7, 0xEC, 0x9F, 0x6C, 0xC4, 0xA1, 0x00, 0xCF, 0xB9,
-    0x77, 0x85, 0x22, 0x95, 0x0B, 0xF0, 0x2B, 0x39, 0x17, 0xE0, 0x17, 0x14, 0x17, 0xE0, 0xBD, 0xC7,
-    0x0A, 0xF0, 0xEC, 0xB1, 0x02, 0x9C, 0x83, 0x6A, 0xF5, 0x9E, 0x2D, 0xC0, 0x6F, 0x9A, 0x14, 0x05,
-    0x78, 0x66, 0xF2, 0xA1, 0x4D, 0x78, 0xF0, 0xB4, 0x66, 0x32, 0x6A, 0x24, 0x47, 0x63, 0xF9, 0xC1,
-    0x6A, 0x2C, 0x36, 0xEE, 0x80, 0x5A, 0xB8, 0x06, 0x31, 0x75, 0x71, 0xC2, 0x2D, 0x3B, 0xFF, 0xCE,
-    0x0D, 0x15, 0xAC, 0xDD, 0xE2, 0x89, 0x76, 0x5B, 0x72, 0x79, 0x6A, 0x05, 0x5F, 0xD6, 0x15, 0xFC,
-    0x38, 0xEF, 0x1A, 0xCA, 0xE7, 0x31, 0x45, 0xA6, 0x11, 0xB5, 0x0D, 0xF8, 0x68, 0x77, 0xCE, 0x96,
-    0x09, 0x5E, 0xE7, 0xB6, 0x52, 0xEC, 0xDE, 0x02, 0x60, 0xE0, 0xF0, 0x41, 0x69, 0x21, 0xC2, 0x51,
-    0x8C, 0xC9, 0x6D, 0xD7, 0x87, 0x7B, 0x8E, 0x48, 0x06, 0xD7, 0x21, 0x82, 0x65, 0x5F, 0x54, 0xC1,
-    0x80, 0xB3, 0x67, 0x6C, 0x5B, 0x58, 0x88, 0xCC, 0xBB, 0xDA, 0xFB, 0x80, 0xC6, 0x35, 0xB8, 0x08,
-    0x02, 0x22, 0x52, 0x60, 0x6C, 0x3F, 0x49, 0x1B, 0xD1, 0x39, 0xD6, 0x0F, 0x0E, 0x17, 0x36, 0x23,
-    0xB1, 0xA7, 0xE0, 0xB1, 0x12, 0xC1, 0x20, 0xE3, 0x50, 0x89, 0xCF, 0xDF, 0xC0, 0x75, 0xFF, 0x82,
-    0x12, 0x6E, 0x9D, 0xE9, 0xCB, 0x30, 0xD6, 0x07, 0x24, 0x1E, 0xAC, 0x63, 0xFE, 0xEF, 0x25, 0x19,
-    0x2A, 0x67, 0x14, 0xDD, 0xA8, 0xC4, 0x46, 0x67, 0xE8, 0x1D, 0xDB, 0xAB, 0x9B, 0xF7, 0xA1, 0xE3,
-    0xD3, 0xB1, 0x2B, 0x4A, 0xFE, 0x9B, 0x72, 0x21, 0xB3, 0x6E, 0x94, 0x74, 0x6F, 0x22, 0x9D, 0x64,
-    0x22, 0x0E, 0x7D, 0x5C, 0x9D, 0x90, 0xFF, 0xC9, 0xB6, 0x1E, 0x41, 0xFA, 0xBB, 0x7A, 0x04, 0x0D,
-    0x98, 0x97, 0x2E, 0x9C, 0x63, 0x82, 0x47, 0x95, 0xF7, 0x27, 0x71, 0xB3, 0x64, 0xD1, 0x0D, 0xCC,
-    0x43, 0x4F, 0x02, 0xD8, 0xAA, 0x93, 0x5C, 0x2A, 0x4C, 0x1A, 0x19, 0xF8, 0x7D, 0xD8, 0x7F, 0x08,
-    0x7F, 0xDF, 0xB1, 0xA3, 0x5B, 0x57, 0xDB, 0x85, 0xFB, 0x0B, 0xA4, 0x2A, 0x99, 0xC3, 0xEC, 0x91,
-    0x76, 0x6F, 0xA8, 0x85, 0x1E, 0xA3, 0x3B, 0x42, 0xD9, 0x2B, 0x95, 0x9F, 0x79, 0x39, 0x32, 0x16,
-    0x6A, 0x7D, 0x20, 0x79, 0x09, 0x6C, 0x19, 0xC5, 0x61, 0x2A, 0x6F, 0x5F, 0xE0, 0x16, 0xB3, 0xE6,
-    0x86, 0x22, 0xB7, 0x1E, 0xF9, 0xE3, 0x14, 0x95, 0xC6, 0x6F, 0x25, 0xF2, 0x76, 0x5C, 0x77, 0x0B,
-    0x45, 0x9D, 0xB2, 0xC1, 0xA3, 0x88, 0x53, 0x4F, 0x2D, 0xF8, 0x69, 0x21, 0xDF, 0x47, 0x0D, 0xA9,
-    0x51, 0x6D, 0xB4, 0xBC, 0xAC, 0xC9, 0xA5, 0xCC, 0x6B, 0x44, 0xDF, 0xA6, 0x2E, 0xC3, 0x1E, 0x13,
-    0x99, 0x3E, 0xB7, 0x23, 0x60, 0xA1, 0x38, 0xE0, 0x30, 0xAB, 0x6B, 0x67, 0x2E, 0x41, 0x72, 0xDB,
-    0x68, 0x9B, 0x33, 0xB6, 0x95, 0xCD, 0x3D, 0x54, 0xAE, 0xAB, 0x58, 0x41, 0x91, 0x5B, 0xB2, 0x5E,
-    0xE3, 0xEE, 0x04, 0x20, 0xCF, 0x35, 0xBE, 0xAB, 0x92, 0xCA, 0x4B, 0xFF, 0xF5, 0x38, 0x28, 0x9B,
-    0x24, 0x56, 0x10, 0x38, 0xF9, 0xB0, 0xB2, 0x57, 0xD4, 0x39, 0x55, 0x27, 0x83, 0x4D, 0xDA, 0x64,
-    0xB8, 0x30, 0x9F, 0x0D, 0xCE, 0x17, 0x2C, 0x04, 0x59, 0x85, 0x4A, 0xD6, 0xA1, 0xFC, 0x4F, 0x8E,
-    0x75, 0x7A, 0x50, 0x5F, 0x95, 0xAF, 0xA2, 0x7C, 0x0A, 0x8C, 0xAB, 0x9A, 0x32, 0x4D, 0xE2, 0x46,
-    0x10, 0xF7, 0xA8, 0x1B, 0xC6, 0x46, 0x16, 0x11, 0x0D, 0x64, 0xBE, 0x97, 0xFE, 0x7C, 0xA4, 0x66,
-    0x0B, 0x46, 0xDB, 0x1D, 0x58, 0xF6, 0x0C, 0x68, 0xED, 0x30, 0xEA, 0x01, 0xB8, 0x3A, 0x42, 0xB0,
-    0xB7, 0xB0, 0xF4, 0x29, 0x10, 0x39, 0x2A, 0xA2, 0x82, 0x02, 0x14, 0x2B, 0x61, 0xDC, 0xC5, 0xAE,
-    0x16, 0x08, 0x61, 0x4C, 0x53, 0x00, 0x75, 0x17, 0x84, 0xF8, 0xF6, 0x66, 0x7F, 0xF6, 0x05, 0x4E,
-    0x96, 0x5C, 0x2F, 0x0E, 0x7A, 0xB9, 0x6B, 0x50, 0xC5, 0xF5, 0xBC, 0x6C, 0x41, 0xAA, 0x42, 0x1E,
-    0x2E, 0xC6, 0x1D, 0x1D, 0xB9, 0xD9, 0xA2, 0xAB, 0x5B, 0x49, 0x16, 0x4D, 0x9B, 0x81, 0x63, 0xEA,
-    0x72, 0xB2, 0xA0, 0x7D, 0xC3, 0xEE, 0xB0, 0xC3, 0x41, 0x9E, 0xC4, 0x4B, 0x49, 0x37, 0x90, 0x47,
-    0x56, 0x96, 0xF3, 0x85, 0x46, 0x33, 0xF2, 0xD6, 0x38, 0xD1, 0x98, 0x43, 0xC6, 0xCC, 0x00, 0xF6,
-    0x5F, 0x34, 0x46, 0x7A, 0x4F, 0x6D, 0x8C, 0xC4, 0x6F, 0x6E, 0x6F, 0x8C, 0x04, 0x30, 0xDF, 0x44,
-    0x4D, 0x9A, 0x5B, 0x72, 0x7E, 0x97, 0x55, 0x23, 0x90, 0xF3, 0x0F, 0x51, 0x65, 0x60, 0xC0, 0x30,
-    0x75, 0x66, 0x9E, 0xDA, 0x3D, 0x71, 0x76, 0x76, 0x4F, 0x7E, 0x85, 0x08, 0xD7, 0xB6, 0x99, 0x6A,
-    0xFD, 0x73, 0x0B, 0x0E, 0xD5, 0x50, 0x3B, 0xCE, 0x17, 0x6A, 0xE7, 0x34, 0xB4, 0x29, 0x96, 0x0C,
-    0x7C, 0x86, 0x71, 0xF8, 0x7A, 0x1E, 0x9C, 0xA9, 0xE0, 0x04, 0x24, 0x8B, 0x1B, 0x19, 0xD7, 0xA6,
-    0x48, 0x73, 0xB0, 0x13, 0xEC, 0xCB, 0xCC, 0xDD, 0xB3, 0xCB, 0x0E, 0x40, 0x63, 0x30, 0x6A, 0x25,
-    0xA7, 0x75, 0x57, 0x42, 0x38, 0x47, 0xB4, 0xA4, 0x11, 0x24, 0x1E, 0x1F, 0x1E, 0x00, 0x9E, 0x4E,
-    0x59, 0xB7, 0xFA, 0xAD, 0xCA, 0xC2, 0x90, 0x69, 0x47, 0x54, 0xA2, 0xE2, 0x3F, 0x38, 0x1C, 0xEA,
-    0xD6, 0x1F, 0x84, 0x04, 0x77, 0x7A, 0x99, 0x05, 0x79, 0xE5, 0x18, 0x97, 0x03, 0x96, 0x07, 0xA6,
-    0x63, 0xDC, 0x4B, 0xE9, 0x12, 0xE4, 0x07, 0xB4, 0x2C, 0x75, 0xA7, 0xC8, 0x5F, 0x4D, 0xF9, 0x7A,
-    0x0F, 0x48, 0x4C, 0x52, 0x98, 0x2B, 0x63, 0xC6, 0x1F, 0xD2, 0xFD, 0x73, 0xF6, 0x84, 0x05, 0xA2,
-    0x07, 0x09, 0x01, 0x25, 0x44, 0x4C, 0x1D, 0x58, 0x40, 0xDE, 0x48, 0x6D, 0xF3, 0x99, 0x7A, 0xAA,
-    0x1E, 0x33, 0xA8, 0xEA, 0xEC, 0x16, 0xAC, 0x43, 0xCB, 0xAD, 0x61, 0x99, 0x79, 0x92, 0x06, 0xB9,
-    0xE4, 0x92, 0x35, 0xAB, 0xCF, 0x5D, 0x88, 0x71, 0x81, 0x1A, 0xEB, 0xC0, 0x18, 0x79, 0xFF, 0x6D,
-    0x95, 0x53, 0xC4, 0x5A, 0x99, 0x1B, 0xEC, 0x61, 0x08, 0x88, 0xC1, 0xC8, 0x39, 0x07, 0x50, 0x8D,
-    0xBF, 0x66, 0xCF, 0xAC, 0xA9, 0xBA, 0x7B, 0xC6, 0x5D, 0x35, 0x4E, 0xC3, 0x6D, 0x07, 0x71, 0xD5,
-    0xA4, 0xD2, 0x55, 0x20, 0xF5, 0x4B, 0x86, 0xA5, 0x89, 0xF9, 0xA2, 0x57, 0x9C, 0x47, 0xFD, 0xF9,
-    0x0B, 0xFF, 0x90, 0x36, 0xBE, 0x21, 0xF2, 0xEF, 0xFB, 0x8E, 0x6A, 0xEC, 0x26, 0x3D, 0xE9, 0xF1,
-    0x35, 0xB6, 0xBB, 0xD3, 0xB0, 0x5D, 0x75, 0x54, 0x26, 0xB7, 0x74, 0x70, 0x34, 0xEE, 0x36, 0x5C,
-    0x14, 0x26, 0x3F, 0x5E, 0xEE, 0xDB, 0xF8, 0x55, 0x90, 0x3F, 0xF0, 0xBF, 0x6F, 0xD3, 0xAD, 0xE1,
-    0x82, 0x0C, 0x3A, 0x35, 0xA0, 0x97, 0x9F, 0x6D, 0x8C, 0x9D, 0xDE, 0x3F, 0xDF, 0x98, 0x5F, 0x48,
-    0x8A, 0xBD, 0x1A, 0x3B, 0xC8, 0x45, 0x81, 0xCB, 0xF4, 0xF6, 0x6E, 0xD2, 0xCF, 0xF4, 0x3F, 0xAF,
-    0x4E, 0xAF, 0x0F, 0xBB, 0x49, 0xC1, 0x29, 0x3A, 0xBD, 0x20, 0xA6, 0x79, 0xBE, 0x5D, 0xBB, 0x5E,
-    0x7C, 0xF1, 0xB5, 0x83, 0x7F, 0xF4, 0x5A, 0x82, 0xF2, 0xA9, 0x35, 0xFB, 0x72, 0x2E, 0x18, 0x0A,
-    0xB4, 0x59, 0x1F, 0xB2, 0xE0, 0x84, 0xBF, 0x91, 0x07, 0x11, 0x91, 0xBA, 0x51, 0x6B, 0xCE, 0x80,
-    0xFB, 0xA4, 0x65, 0xE4, 0x6C, 0xAA, 0xD3, 0xF6, 0x17, 0x17, 0xBB, 0x56, 0x9D, 0xFA, 0x3B, 0xD5,
-    0x69, 0x62, 0xD5, 0xE9, 0x77, 0x49, 0x2C, 0x1D, 0x82, 0x01, 0xCD, 0xF4, 0xE0, 0xC8, 0x83, 0x10,
-    0x24, 0xB6, 0x3C, 0x45, 0x13, 0x1C, 0x47, 0x7C, 0x4C, 0x46, 0xD1, 0xED, 0xF7, 0xEC, 0x51, 0x0F,
-    0xF6, 0x24, 0x66, 0x38, 0x15, 0xC6, 0x0C, 0x09, 0x66, 0x1B, 0x58, 0x7A, 0xE4, 0x18, 0x52, 0xD2,
-    0x92, 0x3F, 0xD3, 0x59, 0x08, 0xCD, 0x9F, 0xA9, 0x7D, 0xF8, 0x3C, 0xB9, 0x1D, 0x73, 0x36, 0xEC,
-    0x9D, 0xB7, 0x32, 0xC7, 0x7F, 0x40, 0x3F, 0xAC, 0x47, 0x8F, 0xCC, 0x91, 0xE1, 0xE8, 0x67, 0xA6,
-    0xC4, 0x85, 0xAD, 0xD1, 0x93, 0x87, 0x3F, 0xB7, 0x91, 0x80, 0xFA, 0xBF, 0x1E, 0x9D, 0xEC, 0xE8,
-    0x82, 0x19, 0xAA, 0x81, 0xD1, 0xAD, 0xD3, 0xBD, 0xD4, 0x9E, 0xB8, 0xEC, 0x25, 0x8D, 0xEC, 0x3E,
-    0x58, 0x7C, 0x49, 0x98, 0x87, 0xA5, 0x9D, 0x7F, 0xE9, 0xE7, 0xB6, 0x0B, 0x26, 0x6F, 0x03, 0xFC,
-    0x26, 0x15, 0xA7, 0x4A, 0x9B, 0x58, 0x5F, 0xFB, 0x1D, 0x07, 0x5E, 0x9B, 0x47, 0x3F, 0xEA, 0xA2,
-    0x3D, 0x00, 0xE2, 0x19, 0x6C, 0xFF, 0xD0, 0x1E, 0xAF, 0x7D, 0xE9, 0xEB, 0xFF, 0xA3, 0x83, 0x8F,
-    0x89, 0xB7, 0x2D, 0x42, 0x58, 0xDD, 0xF1, 0xC4, 0x45, 0xFC, 0x5F, 0xF5, 0x75, 0x68, 0x0C, 0x6A,
-    0xF4, 0x66, 0x41, 0xCD, 0x0E, 0xF9, 0x88, 0x3E, 0x5C, 0x83, 0x98, 0x73, 0x6A, 0x79, 0xE0, 0x41,
-    0xF3, 0x76, 0x61, 0x28, 0x35, 0x25, 0x4A, 0x2F, 0x8B, 0xA8, 0x56, 0x80, 0x7C, 0x32, 0x54, 0xD9,
-    0xF6, 0x05, 0xBF, 0x6E, 0xAA, 0x97, 0x2E, 0x3A, 0xFF, 0x03, 0x72, 0x01, 0x6D, 0x99, 0x4C, 0xA2,
-    0x1C, 0x00, 0xF4, 0x10, 0x9D, 0x00, 0xC8, 0x58, 0x5D, 0x7A, 0x3D, 0xB9, 0x75, 0x9F, 0x95, 0x8F,
-    0xB4, 0xEE, 0xBD, 0x32, 0x2C, 0x42, 0x65, 0xD2, 0x0F, 0x99, 0x66, 0xFD, 0xDC, 0xD6, 0x1C, 0x0E,
-    0xD4, 0xC6, 0xDC, 0x0C, 0xC4, 0xC9, 0x4D, 0x75, 0xA0, 0xE1, 0x5E, 0x4E, 0x1B, 0x17, 0xFD, 0xA3,
-    0xA4, 0x75, 0x2B, 0xB8, 0xFC, 0x23, 0x70, 0x2E, 0x7B, 0xFA, 0xAB, 0xF7, 0xE8, 0xB3, 0x9E, 0x95,
-    0xC8, 0x48, 0x29, 0xCC, 0x34, 0xDC, 0xD1, 0x18, 0xF6, 0x04, 0x5C, 0x35, 0x39, 0xE6, 0x64, 0x17,
-    0x25, 0x32, 0x31, 0x32, 0x62, 0xCF, 0x1C, 0x31, 0xFD, 0xE0, 0xA7, 0xE0, 0x49, 0x14, 0x01, 0xDC,
-    0xF1, 0xA8, 0xBB, 0x1C, 0x5F, 0xEF, 0x4C, 0x20, 0x1B, 0x6A, 0xFA, 0xD4, 0xEE, 0x8A, 0x75, 0xF1,
-    0xB0, 0xBA, 0xE5, 0x43, 0x2C, 0x35, 0xE9, 0x21, 0xEB, 0xC7, 0xDA, 0x26, 0x7E, 0x48, 0xDB, 0xAC,
-    0xE9, 0xA9, 0x36, 0x68, 0x83, 0xEB, 0xEA, 0x94, 0x59, 0xE6, 0x5B, 0x90, 0x5A, 0xAF, 0xC0, 0x09,
-    0xE0, 0x2D, 0x84, 0xF3, 0x38, 0x95, 0x07, 0x1C, 0xDD, 0xF2, 0x59, 0x22, 0x48, 0xB3, 0x55, 0x7B,
-    0xA7, 0x5C, 0xCB, 0x26, 0x36, 0x73, 0x14, 0x9C, 0x14, 0x76, 0xED, 0xFA, 0x83, 0x6F, 0x80, 0x2D,
-    0x1A, 0xDF, 0x59, 0x88, 0x8A, 0x17, 0xE6, 0x11, 0xF4, 0x90, 0xFA, 0xF8, 0x0F, 0x0A, 0x93, 0x50,
-    0x4C, 0x68, 0x6C, 0xC8, 0xC4, 0x3D, 0xC8, 0x49, 0x09, 0xF1, 0x3E, 0x6D, 0xE2, 0xA8, 0xEA, 0x69,
-    0x6F, 0x7D, 0xD5, 0xD0, 0xA2, 0xD9, 0xC8, 0xE5, 0xEA, 0x60, 0x49, 0x94, 0x66, 0x35, 0x0B, 0xCF,
-    0xDE, 0xAF, 0x80, 0x6C, 0xEC, 0x43, 0xAE, 0xA1, 0xFA, 0x38, 0x8E, 0xA2, 0x94, 0xC4, 0x60, 0x58,
-    0xA1, 0xD8, 0xE6, 0x2F, 0x6F, 0x87, 0x9B, 0x51, 0x02, 0x65, 0x92, 0x0E, 0xF8, 0x54, 0x2F, 0x91,
-    0x79, 0x74, 0xBD, 0x90, 0x1B, 0x95, 0x77, 0x61, 0xDD, 0xB9, 0x7E, 0x27, 0xFD, 0xF4, 0x5E, 0xD6,
-    0xFE, 0xAB, 0x9A, 0x4D, 0xB1, 0x42, 0xDF, 0x96, 0xBC, 0xDC, 0x52, 0x8A, 0xF8, 0x20, 0x23, 0xA4,
-    0x0A, 0x32, 0x22, 0xE6, 0x93, 0x8D, 0xF4, 0x15, 0x0E, 0x69, 0x14, 0x8E, 0xF2, 0x3C, 0xBB, 0x25,
-    0xDF, 0xAA, 0x64, 0x6A, 0xB8, 0x73, 0x95, 0xC2, 0x36, 0x63, 0xE5, 0x84, 0x3A, 0x8A, 0xDA, 0x08,
-    0x9F, 0x16, 0x4A, 0xC6, 0x10, 0x9B, 0x0F, 0xA6, 0x39, 0x19, 0xF1, 0xA9, 0x38, 0x30, 0x06, 0xEB,
-    0xF3, 0x49, 0x39, 0xB2, 0xD2, 0x00, 0x37, 0x44, 0xE9, 0x93, 0x8F, 0x43, 0x93, 0x05, 0x2E, 0x1A,
-    0xBC, 0x65, 0x58, 0x45, 0xC6, 0x07, 0x48, 0x43, 0x13, 0xF1, 0xE9, 0x1C, 0x77, 0x6C, 0xFD, 0xCF,
-    0xF9, 0xAA, 0x06, 0x98, 0xB2, 0x0B, 0x6A, 0xAD, 0xB6, 0x35, 0x62, 0xC2, 0xE1, 0x86, 0x39, 0x3F,
-    0x30, 0x6E, 0x90, 0xDE, 0xE4, 0xD9, 0xD4, 0x2E, 0xA1, 0xC3, 0x67, 0x3A, 0x52, 0x71, 0xC0, 0xF1,
-    0x0A, 0x98, 0xC9, 0x22, 0x88, 0xC5, 0x84, 0x05, 0x83, 0xFC, 0x89, 0x72, 0x0A, 0x2C, 0xE5, 0x94,
-    0x72, 0xFE, 0xFE, 0xDC, 0xEF, 0xBD, 0x00, 0x71, 0x7E, 0xC8, 0x13, 0x00, 0x8D, 0xB9, 0x7D, 0x9C,
-    0x03, 0x9B, 0xEF, 0x1B, 0x30, 0xF1, 0xFA, 0x57, 0x7E, 0x3D, 0x8B, 0xF4, 0xC9, 0xE5, 0x84, 0x97,
-    0xB3, 0xD0, 0x8B, 0x58, 0x34, 0xD4, 0x71, 0x8E, 0xF4, 0x35, 0x97, 0xB2, 0xF2, 0x41, 0x84, 0xF3,
-    0x11, 0xAB, 0x60, 0xF1, 0xB9, 0xA3, 0x33, 0xE4, 0x6D, 0x5C, 0xCF, 0xF9, 0x02, 0xE0, 0xBC, 0xF8,
-    0x6B, 0x89, 0x6F, 0xAF, 0x65, 0xF2, 0xF6, 0xB9, 0x86, 0x67, 0xEB, 0x57, 0x53, 0x84, 0x7C, 0x6B,
-    0xAF, 0x03, 0x35, 0x44, 0x7A, 0xB3, 0x7B, 0xC0, 0xA7, 0xCA, 0xF1, 0xF6, 0x6A, 0x9A, 0x0F, 0x3B,
-    0xF9, 0x61, 0x0D, 0xF6, 0x0B, 0xE7, 0x58, 0x3E, 0xEE, 0xE4, 0xC7, 0x35, 0xB8, 0xBA, 0x61, 0xF9,
-    0xC8, 0x4D, 0x83, 0x68, 0x6E, 0xD6, 0x3E, 0x8B, 0x91, 0xD8, 0x6E, 0x3B, 0x3B, 0x70, 0xD3, 0x13,
-    0x6A, 0xE7, 0xC1, 0x74, 0xDD, 0xDE, 0x42, 0x92, 0x8F, 0xBD, 0x8F, 0x26, 0xB9, 0x5B, 0x15, 0xCC,
-    0xBD, 0xEB, 0x68, 0x01, 0x03, 0x69, 0xAE, 0x50, 0xD8, 0xD6, 0x3C, 0xBD, 0x3D, 0x2C, 0x07, 0x6D,
-    0x62, 0x8D, 0xA3, 0xF1, 0x04, 0xC7, 0x14, 0x34, 0x1B, 0x1F, 0x21, 0x23, 0x68, 0x0C, 0xF2, 0x38,
-    0x30, 0x3E, 0xA1, 0xF8, 0x91, 0x0D, 0x31, 0x3C, 0xFC, 0x1D, 0xE5, 0x83, 0x84, 0xD4, 0x18, 0x81,
-    0xB4, 0xB7, 0x57, 0x1B, 0xB3, 0x62, 0xFA, 0xD2, 0xC5, 0xC5, 0xDC, 0x90, 0xDF, 0x7C, 0xC1, 0xC7,
-    0xEE, 0x2D, 0x88, 0x8B, 0x0B, 0xE9, 0xD6, 0x47, 0xC7, 0xB9, 0xC6, 0x8C, 0xB9, 0x96, 0xE7, 0xA3,
-    0x88, 0xB7, 0x46, 0x39, 0x5C, 0xED, 0xC3, 0x13, 0x89, 0x95, 0x94, 0xDA, 0x53, 0x10, 0xF7, 0x7F,
-    0x5C, 0xD5, 0x4F, 0x58, 0x7C, 0x3C, 0xD4, 0x8B, 0x00, 0x1D, 0x22, 0xA9, 0xE2, 0xA9, 0x46, 0xDA,
-    0x92, 0x0F, 0x3D, 0x0A, 0xE9, 0xA2, 0x36, 0x56, 0x4E, 0x9F, 0x82, 0x00, 0x65, 0x0C, 0x75, 0x3A,
-    0xDB, 0xF7, 0xEB, 0xAE, 0xB1, 0x05, 0xBC, 0xFF, 0xE4, 0x7F, 0xE5, 0xAA, 0xFA, 0xF2, 0x2C, 0xE3,
-    0xE9, 0x1E, 0xCA, 0x54, 0x44, 0x21, 0x67, 0x99, 0x92, 0xCB, 0x54, 0x51, 0x99, 0x89, 0x74, 0xB3,
-    0x4C, 0xB5, 0x12, 0xDD, 0x9A, 0x78, 0x33, 0xCB, 0x24, 0xFC, 0xAF, 0xB3, 0xBD, 0x4C, 0xBD, 0xFE,
-    0x09, 0xB7, 0x18, 0x8E, 0x5E, 0x83, 0x61, 0x81, 0x51, 0x93, 0x3D, 0xB2, 0x08, 0xFF, 0x8A, 0xFA,
-    0xB2, 0x45, 0x38, 0xE7, 0x5E, 0x71, 0x66, 0x3E, 0x14, 0x55, 0xCB, 0x87, 0xA2, 0x5B, 0x8A, 0xE4,
-    0x59, 0xCE, 0x32, 0xC1, 0x56, 0x96, 0xF1, 0x4D, 0xB2, 0x85, 0xBB, 0xA7, 0x67, 0x19, 0xDE, 0x48,
-    0xDD, 0xA2, 0xEC, 0x3F, 0xD2, 0xD9, 0xEC, 0xCD, 0xF0, 0x51, 0x15, 0x97, 0xBC, 0xA0, 0x73, 0xC0,
-    0x29, 0x02, 0xB3, 0xD7, 0xCF, 0x10, 0xB8, 0xD9, 0x33, 0x9E, 0x66, 0x9B, 0x62, 0x13, 0xC3, 0x93,
-    0x6B, 0x1A, 0x1F, 0xE7, 0xA8, 0x5F, 0x5C, 0x64, 0x9B, 0xF7, 0xC9, 0x39, 0x89, 0x35, 0x10, 0x7D,
-    0xCF, 0x76, 0xA4, 0xF7, 0xD3, 0xB3, 0x6D, 0x2B, 0xFB, 0xF2, 0xFA, 0x81, 0x1E, 0xB8, 0x8B, 0x65,
-    0x4A, 0x98, 0x82, 0xA8, 0x80, 0x2E, 0x6E, 0xBE, 0xA4, 0xD0, 0x64, 0xD7, 0xE0, 0x4A, 0x85, 0x1A,
-    0x2F, 0x4C, 0x87, 0x97, 0x45, 0xDC, 0x3D, 0x42, 0xAC, 0x00, 0x3F, 0x81, 0xBD, 0xCC, 0x7F, 0xFC,
-    0x32, 0xE8, 0xD5, 0x21, 0xE6, 0x4F, 0xD0, 0xD7, 0x3F, 0xFA, 0x26, 0x8A, 0x85, 0x7D, 0x3E, 0x69,
-    0x3B, 0xB1, 0xE5, 0x7C, 0xB6, 0xA6, 0xDD, 0x65, 0x20, 0x38, 0xC9, 0xFD, 0xB3, 0x8B, 0xB4, 0x71,
-    0x2F, 0x0B, 0xAA, 0xB6, 0x63, 0xB8, 0xA0, 0x42, 0x72, 0x19, 0xB6, 0x30, 0xD9, 0x55, 0xC0, 0xD1,
-    0x26, 0x1F, 0x7D, 0xAD, 0x23, 0xFC, 0x47, 0xFB, 0xC4, 0x0B, 0xA8, 0x30, 0x91, 0xB7, 0xBC, 0xCA,
-    0xBB, 0x3C, 0x70, 0x6E, 0xAD, 0xC7, 0x98, 0x39, 0xB9, 0xAB, 0x43, 0x5D, 0x49, 0xDD, 0xDA, 0x9A,
-    0xB8, 0x0D, 0x22, 0x0C, 0xC3, 0x47, 0xF0, 0x31, 0xF1, 0x31, 0xEB, 0x1B, 0xC8, 0x85, 0x93, 0x05,
-    0xB2, 0x59, 0x82, 0x37, 0x9F, 0x4C, 0x73, 0xD1, 0xC0, 0x47, 0xA6, 0x84, 0x12, 0x8C, 0x22, 0x31,
-    0x10, 0xBD, 0x34, 0xA9, 0xC9, 0x90, 0xF9, 0x26, 0xA7, 0x7D, 0x9B, 0x87, 0x8E, 0x4F, 0x0A, 0x88,
-    0xA7, 0x1C, 0xBF, 0x90, 0x78, 0x0B, 0xB0, 0xEE, 0x13, 0x9F, 0x15, 0xF6, 0x0E, 0x97, 0x6E, 0x81,
-    0x89, 0xD2, 0x40, 0x81, 0xA7, 0x10, 0xFC, 0x65, 0xA0, 0x02, 0xD5, 0x7B, 0x1F, 0x66, 0x06, 0xE9,
-    0xC3, 0x43, 0xCC, 0x12, 0xA3, 0x83, 0xED, 0xE3, 0xFD, 0x57, 0x15, 0x98, 0x2A, 0x7C, 0x7F, 0xDB,
-    0x78, 0x34, 0x44, 0x3D, 0xA0, 0xE4, 0x3C, 0xAC, 0x91, 0x35, 0x32, 0x03, 0xB5, 0xC5, 0x27, 0xDC,
-    0x05, 0x6C, 0x95, 0x23, 0x45, 0x2A, 0xD4, 0xF1, 0x5C, 0xBA, 0x03, 0xD1, 0xA0, 0xF1, 0xC4, 0x19,
-    0x9C, 0xAC, 0x6A, 0x66, 0xEF, 0xDB, 0x6A, 0x6F, 0x1F, 0xDF, 0x06, 0xBB, 0x60, 0x88, 0xAD, 0x7D,
-    0x3C, 0x7D, 0x46, 0x4E, 0x15, 0x9B, 0x11, 0xEF, 0x7C, 0xA6, 0xBF, 0x3C, 0xE2, 0xF7, 0x7D, 0x5C,
-    0xB7, 0xB9, 0xF8, 0xF2, 0x0E, 0xD7, 0x9E, 0x10, 0xEE, 0x1D, 0x5B, 0xE9, 0xD8, 0xC2, 0x3C, 0xB1,
-    0x7D, 0x26, 0x2C, 0x74, 0xF8, 0x90, 0x02, 0xBF, 0xB8, 0xCD, 0xC6, 0x6A, 0xC3, 0x06, 0x60, 0x1D,
-    0x8C, 0x99, 0x95, 0xA0, 0x36, 0xBE, 0x07, 0xE9, 0x8E, 0xF1, 0xDD, 0x15, 0x85, 0x85, 0x5B, 0x20,
-    0x05, 0x7D, 0x9A, 0x6D, 0xF0, 0x39, 0xF1, 0x68, 0xCE, 0x5D, 0x90, 0xC6, 0x33, 0x5E, 0x0E, 0xDD,
-    0xB7, 0x2D, 0xF1, 0xF2, 0x01, 0xA7, 0xC9, 0xC4, 0x63, 0xBC, 0x00, 0x12, 0x0C, 0xF8, 0x39, 0xA2,
-    0xC0, 0x3E, 0x47, 0xB4, 0xC8, 0xCF, 0x11, 0xC5, 0x4F, 0x7F, 0x8E, 0xE8, 0x2F, 0xEA, 0x46, 0xEA,
-    0xE8, 0xDC, 0xBB, 0x4F, 0xDC, 0xF4, 0xD7, 0xED, 0x44, 0x03, 0xD3, 0xCE, 0xA7, 0xDC, 0x26, 0xDA,
-    0x36, 0x96, 0x40, 0x25, 0x8A, 0xC2, 0x8E, 0xF8, 0x89, 0x83, 0x4B, 0x5F, 0xE1, 0x89, 0x03, 0xCB,
-    0x51, 0x16, 0xEC, 0x55, 0xF5, 0x84, 0xF5, 0x7D, 0xF5, 0xA3, 0xB6, 0x10, 0x7E, 0x5B, 0x14, 0xA5,
-    0x53, 0x78, 0x3B, 0xDC, 0xCD, 0xEB, 0xE3, 0x27, 0xB1, 0x78, 0x81, 0xAC, 0x80, 0x79, 0x85, 0x6C,
-    0x43, 0x5E, 0x22, 0x1B, 0x91, 0xD7, 0x68, 0x89, 0x27, 0xAA, 0xC5, 0x22, 0xDB, 0x21, 0xD2, 0xC3,
-    0x65, 0xC2, 0xF4, 0x90, 0xCD, 0x20, 0xB6, 0x28, 0xEE, 0x3C, 0xC1, 0x8E, 0xA8, 0x6A, 0xC8, 0x1A,
-    0x92, 0x57, 0x6A, 0x2D, 0xE9, 0xDE, 0xCB, 0xEA, 0x21, 0x78, 0xB1, 0xD6, 0x96, 0xF6, 0x70, 0x89,
-    0x8D, 0xC9, 0xCB, 0x62, 0x6B, 0xB2, 0x0A, 0xDE, 0x6C, 0xEC, 0x13, 0xCC, 0x09, 0xA8, 0x76, 0xB8,
-    0x84, 0x91, 0x75, 0x45, 0xDA, 0xB4, 0xCF, 0x37, 0xAC, 0x2C, 0x0F, 0x90, 0xD4, 0x1E, 0x79, 0xBE,
-    0x01, 0xBC, 0x74, 0xED, 0x53, 0xCD, 0xE6, 0xF2, 0x7C, 0xF7, 0x48, 0xBA, 0x9C, 0xFD, 0x40, 0x07,
-    0x95, 0x33, 0x47, 0x6E, 0x2C, 0xD4, 0x57, 0x79, 0xFC, 0x0A, 0xD4, 0xDF, 0xAD, 0xCB, 0xBA, 0xD3,
-    0xBC, 0xD0, 0xAC, 0xF5, 0xA1, 0x9B, 0x02, 0x96, 0xC8, 0x0A, 0xC3, 0xE6, 0x6F, 0xC4, 0x0F, 0x19,
-    0x3C, 0x3B, 0x24, 0x8F, 0x5A, 0x9A, 0x3D, 0x76, 0xE0, 0xB5, 0xF5, 0x9A, 0xB2, 0x76, 0x72, 0x58,
-    0x19, 0x4B, 0x3E, 0x86, 0x98, 0x84, 0xE2, 0x74, 0x58, 0x2A, 0x4B, 0x5E, 0x42, 0x52, 0xC2, 0x9B,
-    0x10, 0x0E, 0x99, 0x3C, 0xA4, 0x23, 0x6A, 0xF8, 0xAA, 0x12, 0xF7, 0x97, 0x3C, 0xE4, 0x6A, 0x0D,
-    0xC9, 0x3E, 0x60, 0x83, 0xEF, 0x48, 0x90, 0xC1, 0xA9, 0xF8, 0x31, 0x3C, 0xBC, 0xC9, 0xD9, 0xE9,
-    0x45, 0x18, 0x60, 0x9E, 0xDA, 0x6E, 0xEA, 0x64, 0xBB, 0x8F, 0x49, 0x4A, 0x74, 0x83, 0x0F, 0x10,
-    0x77, 0x4B, 0x99, 0x26, 0x65, 0xD3, 0x31, 0x67, 0x86, 0xAB, 0xFB, 0xAA, 0x8F, 0xA7, 0x0C, 0xF8,
-    0xF1, 0x14, 0x4E, 0x2A, 0x7D, 0xAA, 0x1F, 0xDE, 0xDC, 0x85, 0xFD, 0x43, 0x21, 0x16, 0xB4, 0x91,
-    0xF1, 0xE3, 0x45, 0x1D, 0xEE, 0x72, 0xC0, 0x63, 0xF2, 0x6C, 0xD6, 0xF1, 0xED, 0x81, 0x30, 0xD1,
-    0xFF, 0x02, 0x75, 0x54, 0x31, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0xB3, 0x93, 0xDC, 0x4A, 0x5E, 0xE4,
-    0x69, 0x52, 0x39, 0x51, 0x36, 0x45, 0x24, 0x64, 0xCB, 0xCE, 0xD2, 0x41, 0xB1, 0xF1, 0x6C, 0x12,
-    0x89, 0x02, 0x9A, 0x14, 0x71, 0x87, 0x04, 0x74, 0x28, 0x0D, 0xAD, 0x85, 0x8C, 0x6F, 0xB1, 0x0B,
-    0x17, 0x6E, 0xF2, 0x13, 0x2C, 0x61, 0x24, 0x93, 0x86, 0xC6, 0xC5, 0x15, 0x96, 0x6F, 0x9D, 0x2B,
-    0xA0, 0x5C, 0x62, 0x24, 0xB7, 0x4B, 0x43, 0x9B, 0x01, 0x36, 0x62, 0x2D, 0xED, 0xDD, 0xF0, 0xBE,
-    0xBD, 0x3B, 0xB0, 0x91, 0x18, 0xE9, 0x4E, 0xB3, 0xDF, 0xCE, 0xF7, 0xBD, 0xEF, 0x7B, 0xEF, 0xCD,
-    0x5A, 0xFF, 0xA3, 0x6F, 0xAD, 0xFC, 0x25, 0xDE, 0x3B, 0xEF, 0x7D, 0x0E, 0x40, 0x79, 0x89, 0xF9,
-    0x47, 0x1B, 0x1B, 0x4F, 0x21, 0xAB, 0xCF, 0xF8, 0x39, 0x7F, 0xFE, 0xE6, 0xC6, 0xC6, 0xC6, 0xB3,
-    0xFF, 0x09, 0x6D, 0xAE, 0xA1, 0x4E, 0xE1, 0x52, 0x55, 0x0D, 0x82, 0xD2, 0xE9, 0xC2, 0x85, 0x67,
-    0x55, 0xB4, 0x53, 0x1A, 0x5D, 0x98, 0x30, 0xBF, 0x1B, 0x65, 0x6B, 0x06, 0xA9, 0xC1, 0xE6, 0x03,
-    0x1C, 0xA7, 0x88, 0xBC, 0x9F, 0x18, 0x82, 0x60, 0xB6, 0x88, 0xDD, 0x10, 0xB0, 0x5E, 0xC9, 0x6C,
-    0x11, 0x17, 0x51, 0xA5, 0xEB, 0xA0, 0x0D, 0x8E, 0x74, 0x1D, 0x3A, 0x53, 0x26, 0x45, 0x1F, 0xC1,
-    0x61, 0x5C, 0x9E, 0x6A, 0x67, 0xBF, 0x69, 0x71, 0xF5, 0xC8, 0xCA, 0x47, 0x07, 0xE6, 0xF7, 0xB1,
-    0x6A, 0x6D, 0x9E, 0xEC, 0x39, 0x5D, 0x9F, 0x62, 0x68, 0xCA, 0xE0, 0xE8, 0x79, 0x36, 0xB6, 0x45,
-    0xDF, 0x94, 0xF6, 0x63, 0x97, 0x8C, 0xEA, 0x78, 0xD4, 0x5C, 0x4B, 0xFF, 0x27, 0xC5, 0xEE, 0x3A,
-    0xED, 0xBA, 0x14, 0xE9, 0xA0, 0x86, 0x81, 0x72, 0x78, 0x00, 0x5D, 0x62, 0x4B, 0xF9, 0x89, 0xF5,
-    0xBF, 0xC6, 0xCF, 0x02, 0x87, 0xF5, 0x2E, 0x80, 0x28, 0xE7, 0x89, 0x18, 0xF3, 0xC0, 0x2A, 0x54,
-    0x8E, 0x1B, 0xD3, 0xDE, 0x9F, 0x4A, 0x32, 0x53, 0x83, 0x4A, 0xDE, 0xE8, 0x02, 0xB7, 0x7F, 0x09,
-    0xFC, 0x24, 0xF4, 0x13, 0x9E, 0x67, 0x3D, 0x3C, 0x04, 0xF3, 0x63, 0x5F, 0x59, 0x5F, 0xA9, 0xB7,
-    0x52, 0x41, 0xCF, 0x0F, 0x06, 0xE4, 0x3A, 0xEB, 0x6A, 0x18, 0xDF, 0x90, 0xD1, 0x4A, 0x7B, 0x9F,
-    0xC5, 0x7E, 0x0C, 0x2A, 0x11, 0x7A, 0x5F, 0x90, 0x11, 0x6E, 0x5B, 0x92, 0xC5, 0x64, 0xBF, 0xE3,
-    0xFD, 0x98, 0x9C, 0xB9, 0x95, 0x97, 0x2F, 0x73, 0xA8, 0xD2, 0xEE, 0x4E, 0xFA, 0x7B, 0xCC, 0x5E,
-    0x88, 0x46, 0x7F, 0xB4, 0xD3, 0xBF, 0xEC, 0x60, 0x29, 0x79, 0xEC, 0xD6, 0x2D, 0xC7, 0xEA, 0x47,
-    0x6E, 0x9C, 0x3A, 0x51, 0x05, 0x0B, 0x60, 0xD3, 0x44, 0x7B, 0xDF, 0x64, 0xF8, 0x8A, 0xFD, 0xA4,
-    0x03, 0x48, 0xBB, 0x08, 0x0B, 0xE2, 0x66, 0x5D, 0x7F, 0x68, 0x3E, 0x7F, 0xA1, 0xDD, 0x6F, 0x07,
-    0xD1, 0xD9, 0xB7, 0x2F, 0x12, 0x9C, 0xE7, 0xCB, 0x0C, 0x05, 0x47, 0x61, 0x1D, 0xCD, 0xE9, 0x3F,
-    0x7A, 0xAE, 0xC8, 0xE9, 0x70, 0xC6, 0xA9, 0x13, 0x4E, 0xB9, 0xF4, 0xEE, 0xAB, 0x57, 0x95, 0x73,
-    0x6E, 0xB0, 0xF9, 0xC1, 0xEA, 0x9D, 0xE9, 0x1C, 0xBA, 0xDC, 0x34, 0xB2, 0x49, 0x8F, 0xD3, 0xC1,
-    0x5A, 0xBA, 0xB8, 0x3A, 0x8D, 0x9A, 0xE8, 0xC9, 0xE8, 0x75, 0x75, 0x3C, 0x48, 0x17, 0x17, 0xA3,
-    0x2E, 0x92, 0xC2, 0x54, 0xD1, 0x9B, 0x9D, 0xC3, 0xEF, 0xB9, 0xCF, 0x8C, 0xAA, 0x93, 0xC0, 0x45,
-    0x55, 0x54, 0x9A, 0x8E, 0xD3, 0x4C, 0xE7, 0x61, 0xA9, 0x2B, 0x5D, 0x25, 0x8F, 0x1A, 0x5D, 0x74,
-    0x2C, 0xF7, 0xC4, 0x95, 0xE8, 0xEC, 0x92, 0x70, 0x3B, 0xD4, 0x97, 0x2D, 0x74, 0x83, 0x21, 0x60,
-    0x8B, 0xA4, 0x80, 0x9A, 0x18, 0x0E, 0x64, 0xFE, 0xE2, 0x81, 0x64, 0x38, 0x61, 0xEA, 0x9F, 0x3E,
-    0xDF, 0xC6, 0xA9, 0x65, 0xFB, 0x0B, 0x3F, 0xF8, 0xEC, 0x88, 0x7E, 0xE3, 0xAB, 0xC0, 0x0F, 0x29,
-    0xB5, 0x1F, 0x79, 0xBA, 0xB7, 0x4A, 0x1A, 0x24, 0x35, 0x7C, 0x31, 0x77, 0xE0, 0x56, 0xD7, 0xA8,
-    0x3C, 0xAA, 0x0E, 0x66, 0x29, 0x9F, 0xC6, 0xDF, 0x81, 0xAA, 0xB0, 0x26, 0x6A, 0x6D, 0xC1, 0x88,
-    0x09, 0x12, 0xD1, 0xEF, 0xA1, 0xB0, 0x77, 0x07, 0xFF, 0xAE, 0x3E, 0x07, 0x52, 0x13, 0x58, 0xDA,
-    0x6F, 0x1A, 0xC8, 0x64, 0x48, 0x7A, 0x4A, 0x0E, 0x46, 0x13, 0x1A, 0xBC, 0x0A, 0x5B, 0xDA, 0xC0,
-    0xC0, 0xEC, 0x15, 0xFA, 0xB5, 0x53, 0x6F, 0x6B, 0x9C, 0x36, 0xB0, 0x2D, 0x4C, 0x0D, 0x5D, 0x77,
-    0xB3, 0x9D, 0x02, 0xB7, 0xE6, 0xF5, 0x68, 0x13, 0x09, 0x75, 0x03, 0x22, 0x76, 0x88, 0xF8, 0x60,
-    0xFD, 0x85, 0x6F, 0x97, 0x7B, 0xFB, 0xFE, 0x67, 0x5F, 0x2A, 0xF6, 0x09, 0xDC, 0xFC, 0x89, 0x93,
-    0x75, 0x89, 0xC3, 0x0A, 0xEF, 0x7E, 0x81, 0xE5, 0x8B, 0x7B, 0x6F, 0x7C, 0x93, 0x9C, 0x37, 0xB1,
-    0xF7, 0x1F, 0x7E, 0xF7, 0x09, 0xEE, 0xCF, 0xC8, 0x06, 0x2D, 0x20, 0x9E, 0x13, 0x1B, 0x8B, 0x25,
-    0x65, 0xDA, 0xAB, 0x16, 0x58, 0x17, 0x0B, 0x4C, 0x41, 0x23, 0x86, 0x12, 0x5C, 0x5B, 0xFD, 0xBC,
-    0x77, 0x49, 0x03, 0x9F, 0xD1, 0x98, 0x97, 0x66, 0xBF, 0x3C, 0x51, 0x59, 0x72, 0x43, 0xB2, 0x07,
-    0x92, 0x4F, 0x32, 0x78, 0x3C, 0xEE, 0xEE, 0x40, 0x83, 0xB8, 0xC0, 0x30, 0x0F, 0x39, 0x14, 0xB5,
-    0xC9, 0x61, 0x65, 0x32, 0xD2, 0x49, 0x5A, 0x79, 0xC9, 0x38, 0xCB, 0x7D, 0x04, 0xD9, 0xB5, 0xD2,
-    0xCB, 0x50, 0x07, 0x92, 0xC7, 0x13, 0x51, 0x89, 0x6D, 0xCE, 0x98, 0xE9, 0x66, 0xFE, 0xF2, 0x76,
-    0x85, 0x5B, 0x8A, 0xC2, 0xAD, 0xEA, 0xDA, 0x72, 0x88, 0x2C, 0x96, 0xB6, 0x13, 0x69, 0x74, 0x5D,
-    0xE6, 0xF9, 0x9A, 0xED, 0xAA, 0x46, 0xF0, 0x1D, 0x47, 0x1B, 0xE6, 0xEC, 0x5C, 0xA0, 0x88, 0xA7,
-    0xB3, 0x40, 0x8A, 0xFC, 0x07, 0x8B, 0x1E, 0x1A, 0x53, 0x42, 0x35, 0xA6, 0x85, 0x74, 0x2B, 0x48,
-    0x22, 0x74, 0x6F, 0xA6, 0x17, 0xEE, 0x7D, 0xC9, 0x3B, 0x29, 0x9F, 0xBF, 0x7E, 0x75, 0x02, 0x73,
-    0x40, 0xC1, 0x1D, 0x41, 0x63, 0x12, 0x42, 0x88, 0x86, 0x8A, 0x5B, 0x6E, 0xFB, 0x05, 0x1A, 0xAA,
-    0x61, 0x1E, 0xB3, 0xFE, 0x7B, 0x96, 0x59, 0xA1, 0xDC, 0xB1, 0xCF, 0xAE, 0xA0, 0xB4, 0x4B, 0xEC,
-    0x71, 0xC4, 0x4B, 0xDE, 0xF6, 0xC9, 0xDC, 0xBE, 0x43, 0xEF, 0xF0, 0xCA, 0xDB, 0x40, 0x0C, 0x26,
-    0x02, 0x08, 0x7F, 0x1D, 0xF5, 0x9D, 0xF1, 0xD8, 0xBF, 0xC9, 0x49, 0xE3, 0x36, 0xC4, 0x0C, 0x14,
-    0x69, 0x21, 0x17, 0xD1, 0x08, 0xDC, 0x51, 0xDB, 0x89, 0xD3, 0x29, 0xD3, 0x5D, 0xD6, 0xA0, 0xCB,
-    0xFD, 0x54, 0xC0, 0x38, 0x41, 0x78, 0xC1, 0x47, 0x4B, 0xBB, 0x4E, 0x4B, 0x8A, 0x6D, 0x4F, 0xE6,
-    0xB9, 0x22, 0xA4, 0xA2, 0xB9, 0xB0, 0x38, 0xFB, 0x50, 0x01, 0x7F, 0x03, 0x3D, 0x4E, 0xBB, 0x4A,
-    0x03, 0x41, 0x14, 0x3D, 0x33, 0x23, 0x3B, 0xC5, 0x42, 0xD2, 0x2A, 0xA8, 0xDB, 0x58, 0x08, 0x06,
-    0xD7, 0x62, 0x05, 0x91, 0x25, 0x33, 0x22, 0x58, 0xFB, 0x03, 0xF6, 0x29, 0x22, 0x24, 0x62, 0xB9,
-    0xEA, 0x88, 0x95, 0x5D, 0x20, 0x6D, 0xBA, 0xD8, 0x0A, 0x16, 0x82, 0x16, 0x21, 0x3B, 0x49, 0x8A,
-    0x10, 0x6D, 0xF6, 0x13, 0xF2, 0x07, 0xAE, 0xB0, 0xC5, 0x14, 0x1B, 0x75, 0x26, 0x10, 0x2F, 0xA7,
-    0xB8, 0x9C, 0xC7, 0xBD, 0x87, 0xAA, 0xD9, 0x5E, 0xFF, 0xF9, 0x70, 0x62, 0xB6, 0x81, 0xF3, 0x2D,
-    0x6F, 0xD4, 0x13, 0x59, 0x04, 0xFC, 0xAC, 0x53, 0x43, 0xC6, 0xF1, 0xDD, 0x59, 0x87, 0x7F, 0x67,
-    0xE2, 0xA1, 0xD7, 0x9E, 0x14, 0x00, 0x58, 0x49, 0x75, 0xE4, 0x63, 0x5E, 0x23, 0xD2, 0x53, 0x1F,
-    0x9B, 0x59, 0xD9, 0x9E, 0x9A, 0x35, 0xF8, 0xE3, 0xC7, 0x83, 0xEE, 0x45, 0x38, 0x6A, 0x0C, 0xE1,
-    0x86, 0x7E, 0xCD, 0xD9, 0xAF, 0xE1, 0xC5, 0xC0, 0xD7, 0x49, 0x55, 0x9A, 0x00, 0x85, 0xA0, 0xB9,
-    0x60, 0xF9, 0x90, 0xE7, 0xDE, 0xFD, 0xEC, 0xB8, 0x7B, 0x79, 0x35, 0x2D, 0xF6, 0x41, 0x54, 0x42,
-    0x55, 0xC4, 0xC9, 0xAB, 0xD0, 0x3C, 0xDF, 0xC9, 0x98, 0x8C, 0xB9, 0xBE, 0x3D, 0x5D, 0x80, 0xE5,
-    0xE8, 0x70, 0x62, 0xF0, 0x92, 0x9E, 0x3C, 0x01, 0x2A, 0xAE, 0x4C, 0x1A, 0xA9, 0xBE, 0xF6, 0x01,
-    0xB2, 0xD8, 0x65, 0x52, 0xC8, 0xA3, 0xD4, 0x53, 0xC4, 0x6C, 0x60, 0xC1, 0x9B, 0xB5, 0xD6, 0x9B,
-    0x32, 0x80, 0x5F, 0x32, 0xD5, 0xAA, 0x90, 0x2C, 0xA6, 0xD2, 0xD3, 0xAE, 0x54, 0xF4, 0xD9, 0xAC,
-    0x4B, 0x57, 0xAA, 0xFF, 0x5F, 0xEA, 0x1D, 0xB4, 0x00, 0xCF, 0x10, 0x28, 0x08, 0x60, 0x00, 0x14,
-    0xEE, 0x91, 0x25, 0x7C, 0x8D, 0xAA, 0x42, 0x00, 0x84, 0x70, 0x4A, 0x7D, 0x05, 0xB1, 0x84, 0x25,
-    0x03, 0x89, 0xAA, 0x76, 0xB6, 0x04, 0x28, 0x01, 0x03, 0xDB, 0x8D, 0xE6, 0x2E, 0xCD, 0x56, 0x69,
-    0xEB, 0xBA, 0x71, 0x8A, 0xA5, 0x2D, 0x61, 0x6F, 0x25, 0x20, 0xCB, 0x35, 0x74, 0x11, 0x36, 0x47,
-    0x28, 0xAD, 0xFA, 0x07, 0x4D, 0x54, 0x3D, 0x6F, 0xDE, 0x54, 0x18, 0x3D, 0xF7, 0x5E, 0xD2, 0x2B,
-    0xC5, 0xA8, 0x97, 0x81, 0xA9, 0x15, 0xF5, 0x8E, 0xDA, 0x78, 0xED, 0x60, 0xC5, 0x96, 0xF8, 0x01,
-    0xE9, 0x40, 0x47, 0x04, 0xBF, 0x80, 0x2C, 0x1D, 0x8A, 0xF4, 0xA6, 0x36, 0x1F, 0x5B, 0x97, 0x0E,
-    0xF9, 0x01, 0x19, 0x8A, 0x44, 0xDB, 0x05, 0xA1, 0x77, 0x60, 0x08, 0xB1, 0xAB, 0x0C, 0x8C, 0x31,
-    0x19, 0x10, 0x52, 0x85, 0x62, 0x41, 0x85, 0x04, 0x95, 0xD0, 0xA5, 0x31, 0x92, 0x13, 0x6C, 0x3F,
-    0x9C, 0xEB, 0x97, 0xD0, 0xBE, 0xF2, 0x23, 0xF9, 0xE3, 0xF9, 0x38, 0xCF, 0x39, 0xE7, 0xBE, 0x40,
-    0x74, 0x1D, 0xB8, 0x7C, 0x13, 0xB8, 0xFE, 0x35, 0x70, 0xB3, 0x85, 0x92, 0x16, 0x31, 0xA3, 0x92,
-    0x5A, 0xCB, 0x51, 0x6E, 0xE5, 0x03, 0xB8, 0x93, 0x14, 0xC9, 0xCF, 0x77, 0x90, 0xED, 0x7B, 0x64,
-    0x7F, 0x37, 0x28, 0x4E, 0x7F, 0x42, 0x21, 0x03, 0x32, 0xE9, 0x91, 0x48, 0x07, 0xC7, 0x78, 0xAD,
-    0xC3, 0xAB, 0x9F, 0xAA, 0x5A, 0x26, 0x96, 0x11, 0x73, 0xAB, 0x07, 0x6F, 0xD9, 0x0E, 0xC8, 0x72,
-    0xE8, 0xE1, 0xCA, 0x9E, 0x6B, 0xAB, 0x3A, 0xFB, 0xBC, 0x51, 0x72, 0xED, 0x23, 0x23, 0x52, 0x3B,
-    0x99, 0x38, 0xB3, 0x63, 0xB3, 0x66, 0x55, 0x58, 0xE5, 0x5A, 0x3A, 0xE5, 0xD7, 0x8C, 0x8C, 0x4A,
-    0x04, 0xB6, 0xE4, 0x67, 0x1F, 0x71, 0x5C, 0x0C, 0x6C, 0xE7, 0x90, 0xA9, 0xCC, 0xA4, 0x5B, 0x7F,
-    0xFC, 0x88, 0x23, 0x6E, 0x99, 0x16, 0xD6, 0xDB, 0x06, 0x51, 0x17, 0xD5, 0x70, 0xBD, 0x63, 0xEE,
-    0x10, 0xE7, 0xC8, 0x86, 0x04, 0x57, 0xAA, 0xA9, 0xFA, 0x2A, 0x13, 0x61, 0xEB, 0x69, 0x73, 0x80,
-    0x1A, 0xB3, 0x9E, 0xE3, 0xB3, 0x0E, 0x66, 0xC8, 0x3C, 0x6C, 0x9F, 0x78, 0x56, 0xC5, 0xFF, 0xCD,
-    0x2C, 0x06, 0xCE, 0x15, 0xAC, 0x8D, 0xDB, 0xBB, 0x2C, 0x19, 0xB4, 0x8F, 0x4B, 0x13, 0x66, 0xCB,
-    0x88, 0x28, 0x2C, 0xF9, 0x7B, 0x8E, 0xB8, 0x06, 0x92, 0x72, 0xDE, 0x02, 0x05, 0xA3, 0x9A, 0xB1,
-    0x86, 0xFA, 0x8C, 0xC5, 0x70, 0x96, 0xEF, 0xEC, 0xA7, 0x7C, 0xD6, 0xCD, 0x92, 0xCF, 0x3E, 0x45,
-    0x56, 0x6E, 0x0A, 0x36, 0xF7, 0x62, 0xC1, 0x9B, 0xEC, 0x52, 0x9B, 0xE7, 0xC6, 0x7B, 0x24, 0x79,
-    0xBF, 0x80, 0xF2, 0xDF, 0x25, 0xF9, 0xBD, 0x3E, 0x73, 0x4D, 0x36, 0xAC, 0x7F, 0xB6, 0x67, 0xFB,
-    0x15, 0x8A, 0x75, 0xE8, 0x32, 0xC5, 0x35, 0x78, 0x2C, 0x4D, 0x6D, 0x6A, 0xB7, 0xEE, 0x48, 0x80,
-    0xBC, 0x60, 0xD8, 0x93, 0x23, 0xB2, 0xF0, 0x2D, 0x09, 0xAD, 0xD5, 0x54, 0xC1, 0xBE, 0x24, 0x1B,
-    0xF7, 0x6B, 0xEC, 0x24, 0xAC, 0xDA, 0x9D, 0xF1, 0xAB, 0x3C, 0x91, 0xDA, 0xBB, 0x7A, 0x79, 0xD7,
-    0xD4, 0xEF, 0xDC, 0x50, 0xC7, 0xF7, 0xB7, 0xF0, 0xCD, 0xAF, 0x87, 0x75, 0xBA, 0x7C, 0xD9, 0x5E,
-    0x4E, 0xD1, 0xD9, 0xAD, 0x7C, 0xA1, 0x0F, 0xCF, 0x2A, 0xF8, 0x4C, 0x4A, 0xA8, 0x27, 0x01, 0x77,
-    0x04, 0x5C, 0x3A, 0x28, 0xA9, 0x24, 0x6F, 0x73, 0x24, 0xFB, 0x30, 0x94, 0xFE, 0x06, 0xE9, 0x6B,
-    0x17, 0xB0, 0xEF, 0x05, 0x27, 0xE4, 0xF3, 0x6E, 0x6F, 0xDF, 0xC2, 0xBB, 0x8F, 0xF7, 0x34, 0xB5,
-    0x5A, 0xC1, 0x4C, 0x38, 0x5C, 0x4A, 0x33, 0x3D, 0xC4, 0x01, 0x27, 0xCB, 0x6C, 0x81, 0x24, 0x87,
-    0x09, 0xFE, 0x09, 0xC6, 0x68, 0x70, 0x8F, 0x54, 0x74, 0xF3, 0xB7, 0xD0, 0x32, 0x1A, 0xE7, 0x32,
-    0x12, 0xFB, 0x3D, 0xB9, 0xAD, 0x84, 0xB5, 0xBF, 0x91, 0xBA, 0x16, 0xC9, 0x88, 0x78, 0x84, 0x96,
-    0x2F, 0x98, 0x56, 0xA2, 0xE8, 0xC2, 0x15, 0x4D, 0xC0, 0x56, 0x03, 0x15, 0x38, 0x8D, 0x79, 0xAF,
-    0xD9, 0x12, 0x9B, 0x71, 0xA3, 0x9E, 0x9C, 0xCB, 0x23, 0xEC, 0x68, 0xAF, 0x3E, 0xFC, 0x51, 0xDE,
-    0x47, 0x00, 0x13, 0x5C, 0xA3, 0xA9, 0x10, 0xB2, 0x2F, 0x39, 0xCF, 0xB3, 0xE0, 0x20, 0x08, 0xC1,
-    0xD5, 0x54, 0x98, 0x98, 0xD4, 0xFF, 0x7B, 0x91, 0xEB, 0xC1, 0x61, 0x15, 0xDB, 0x0F, 0x29, 0xC6,
-    0x48, 0x34, 0x23, 0x64, 0xFF, 0x0D, 0x3D, 0xA4, 0x30, 0xDD, 0x5D, 0x96, 0x2F, 0xE1, 0xDA, 0x69,
-    0xD7, 0x35, 0x32, 0xBA, 0xA7, 0x32, 0xC6, 0xC7, 0xBF, 0x74, 0xEE, 0x9F, 0x17, 0xDE, 0x89, 0xB4,
-    0x74, 0x42, 0x83, 0xEA, 0xEC, 0x55, 0x9B, 0xB5, 0x8B, 0xBE, 0x55, 0x17, 0x00, 0x72, 0xB2, 0xB2,
-    0xC1, 0xFA, 0x2E, 0x90, 0x29, 0x72, 0xCC, 0x98, 0x2E, 0x56, 0x96, 0x1F, 0x18, 0x62, 0xFC, 0xA5,
-    0x1C, 0xEE, 0x0F, 0x32, 0x9D, 0x04, 0xC0, 0x57, 0xE5, 0xC1, 0x45, 0x0B, 0x53, 0xE2, 0x0E, 0xB6,
-    0x9B, 0x64, 0xB4, 0x7F, 0xE2, 0xBC, 0x89, 0x53, 0x7D, 0x5A, 0x27, 0x83, 0x12, 0x6F, 0x27, 0x1A,
-    0x01, 0xF9, 0x9C, 0x43, 0x10, 0xE3, 0x45, 0x3E, 0x5B, 0xD6, 0x05, 0x29, 0xBC, 0x5D, 0xDC, 0x06,
-    0x76, 0xF8, 0x62, 0x58, 0x85, 0xA2, 0x87, 0x0C, 0xE1, 0x18, 0xA2, 0x89, 0x18, 0x8E, 0x80, 0x82,
-    0x65, 0x8D, 0x0C, 0x96, 0x14, 0xC6, 0x41, 0x25, 0x27, 0x3E, 0xA6, 0x40, 0x3E, 0x5C, 0xAA, 0x0B,
-    0x25, 0xBA, 0x87, 0x99, 0x2F, 0x2C, 0xA0, 0xFF, 0x2A, 0xDD, 0xA4, 0xAA, 0x2E, 0x3E, 0x2B, 0x2B,
-    0x51, 0x45, 0xEF, 0xCE, 0x36, 0x8A, 0x43, 0x1F, 0x57, 0x54, 0x4A, 0x3F, 0x5F, 0x1D, 0xE9, 0x3C,
-    0xE4, 0x21, 0x2A, 0xA1, 0x27, 0x6A, 0xDD, 0x13, 0x4C, 0x1D, 0x4D, 0xFB, 0x38, 0x7F, 0x56, 0xBA,
-    0xB4, 0x53, 0xA7, 0x47, 0xD8, 0xF8, 0xC4, 0x9B, 0x67, 0x1F, 0x23, 0x3D, 0x6D, 0xEC, 0xC9, 0xE2,
-    0xB5, 0x3F, 0x83, 0x70, 0xBE, 0xE8, 0x4F, 0x32, 0xD4, 0xC3, 0x36, 0x1B, 0xD0, 0x3E, 0x29, 0xD7,
-    0xE6, 0xC3, 0x2F, 0xCD, 0x4C, 0xAF, 0xF0, 0x84, 0x11, 0x3A, 0xFD, 0xEE, 0xA9, 0xED, 0xB0, 0x3A,
-    0x66, 0x41, 0xC1, 0x7F, 0x01, 0x35, 0x92, 0xB1, 0x6F, 0xD3, 0x40, 0x14, 0xC6, 0xBF, 0x3B, 0x97,
-    0x98, 0xE2, 0x88, 0xCB, 0xD0, 0xA1, 0x42, 0xAA, 0xBC, 0x74, 0xA8, 0x50, 0xC0, 0x6B, 0x84, 0x9C,
-    0xD8, 0x55, 0xC7, 0x0A, 0xFE, 0x86, 0xFE, 0x05, 0xB0, 0x21, 0x86, 0x52, 0xBB, 0xEA, 0xC0, 0xC0,
-    0x92, 0x1D, 0xC4, 0x8C, 0xBC, 0x94, 0xA1, 0x82, 0x0C, 0xA0, 0x18, 0x3A, 0x74, 0xA8, 0xE4, 0xB8,
-    0x73, 0x25, 0x62, 0xA0, 0x80, 0xC4, 0x52, 0x4B, 0xB5, 0x84, 0x0B, 0xB6, 0x1F, 0xEF, 0x92, 0x72,
-    0xBA, 0xE1, 0x74, 0x7A, 0xDF, 0xF7, 0x7E, 0xEF, 0xBB, 0x03, 0x80, 0x1E, 0x50, 0x40, 0x66, 0x30,
-    0x3E, 0x7E, 0x50, 0xE7, 0xB5, 0x43, 0xC3, 0x20, 0x85, 0x13, 0xC3, 0xCA, 0x21, 0x0A, 0x60, 0x0B,
-    0x68, 0x01, 0x4E, 0x28, 0x28, 0xB5, 0xA8, 0xF0, 0x9E, 0x56, 0xA3, 0xED, 0x5E, 0x67, 0xA4, 0x25,
-    0xE0, 0x82, 0x5C, 0x0B, 0xAF, 0xD6, 0x0A, 0xA0, 0x00, 0x2B, 0xDC, 0xD9, 0x48, 0xBD, 0x26, 0x6F,
-    0x51, 0x85, 0x56, 0x0D, 0xA3, 0x82, 0xCA, 0x60, 0x87, 0x58, 0xD4, 0xF5, 0xB8, 0x03, 0x98, 0xF1,
-    0xEC, 0xD4, 0x87, 0xB5, 0xF9, 0x6C, 0xFD, 0xF2, 0x77, 0xAE, 0x28, 0xC7, 0xB8, 0x80, 0xC9, 0x86,
-    0xAB, 0x33, 0x9F, 0x2D, 0xB4, 0x61, 0xC4, 0x8C, 0xD5, 0x15, 0x38, 0x10, 0x3F, 0xE8, 0x8C, 0x4B,
-    0x5E, 0x50, 0x4E, 0x43, 0x3C, 0x3A, 0x29, 0x01, 0x4F, 0x94, 0x30, 0x72, 0x64, 0xBA, 0xD9, 0xD5,
-    0x92, 0xA1, 0xA8, 0xD9, 0x63, 0xF0, 0xF7, 0xF8, 0xC1, 0x9A, 0x48, 0xD1, 0x9D, 0xCB, 0x8D, 0x10,
-    0x2E, 0x64, 0x2C, 0x56, 0x30, 0xFA, 0xF6, 0x89, 0x2A, 0x93, 0x60, 0xC5, 0x58, 0x02, 0x6E, 0xED,
-    0x8E, 0x49, 0x35, 0xBE, 0x57, 0xA2, 0xA9, 0xE5, 0x17, 0xDA, 0x8C, 0x83, 0x87, 0x58, 0xBB, 0x39,
-    0x84, 0x47, 0xC3, 0x16, 0x85, 0x56, 0x23, 0x9B, 0x32, 0x38, 0x3C, 0x2D, 0xD4, 0x7D, 0xF4, 0xAF,
-    0xEB, 0xF1, 0x6C, 0x19, 0x16, 0xAE, 0x79, 0x14, 0xF6, 0x0F, 0x04, 0x41, 0xE5, 0x5E, 0x63, 0x52,
-    0xDA, 0x7A, 0x0F, 0x5C, 0xE3, 0x10, 0x56, 0x6D, 0x63, 0x2F, 0x75, 0xB7, 0xE5, 0xC4, 0xB7, 0x73,
-    0xD4, 0x50, 0x14, 0x8F, 0x2B, 0xF3, 0x3B, 0xA4, 0xAF, 0x07, 0x9C, 0x8D, 0xCA, 0xC4, 0x36, 0xD1,
-    0xDE, 0x9F, 0xE8, 0xB5, 0xF3, 0x2B, 0x1A, 0x06, 0xD4, 0x88, 0x0A, 0x9A, 0x0F, 0xCB, 0x9A, 0xBC,
-    0xC3, 0xB1, 0xBD, 0x81, 0xBC, 0xC8, 0xE0, 0x4D, 0x32, 0xA3, 0x09, 0xD2, 0xE0, 0xED, 0xF4, 0xF0,
-    0xEB, 0xC4, 0x5E, 0x54, 0xBD, 0x0E, 0xEE, 0xA5, 0x90, 0x53, 0x0E, 0xD5, 0x65, 0xB3, 0x0C, 0xE2,
-    0xD4, 0x87, 0x58, 0xD0, 0xA2, 0x36, 0x1B, 0xA4, 0xC0, 0x00, 0x9C, 0x3F, 0x7B, 0xEF, 0x46, 0x51,
-    0x7D, 0x3B, 0xDA, 0x3F, 0x22, 0xE2, 0x37, 0x2C, 0xE7, 0xF7, 0x21, 0xB0, 0xCE, 0x55, 0xAF, 0xE6,
-    0xEA, 0x2E, 0xE7, 0xFD, 0x98, 0x15, 0x3F, 0x43, 0xB1, 0x31, 0x59, 0x50, 0xCF, 0x5D, 0x57, 0x7D,
-    0x7E, 0x57, 0xA8, 0x9A, 0x7C, 0xEB, 0xA2, 0x84, 0x35, 0x8D, 0x61, 0xBE, 0x64, 0x51, 0x47, 0x73,
-    0xB7, 0x19, 0xDC, 0x88, 0x99, 0x7C, 0xC0, 0xE8, 0x33, 0x7F, 0x0D, 0x1F, 0xD5, 0x4C, 0xBF, 0x1F,
-    0x07, 0xDC, 0x43, 0x54, 0x46, 0xC1, 0x15, 0x3C, 0xDE, 0xB2, 0x6E, 0xC3, 0xBF, 0x67, 0xEC, 0x4B,
-    0xBA, 0xB4, 0xA6, 0xB5, 0x93, 0x2C, 0x79, 0x09, 0x6E, 0x24, 0x10, 0xFF, 0xF7, 0xDD, 0x04, 0x7C,
-    0xA3, 0x92, 0x27, 0xC6, 0x79, 0x2D, 0xE8, 0x0C, 0x3B, 0xE0, 0x07, 0xF8, 0x07, 0x4D, 0x52, 0x31,
-    0x8E, 0xD4, 0x40, 0x10, 0x2C, 0xDB, 0xB7, 0x3B, 0xD2, 0x4E, 0x30, 0xC9, 0x6D, 0x42, 0xE2, 0x1F,
-    0xAC, 0x3F, 0xB0, 0x6B, 0x5B, 0xF0, 0x00, 0x08, 0x8E, 0xF8, 0x1E, 0x40, 0xB0, 0x1F, 0x00, 0x6C,
-    0x7E, 0x40, 0x4E, 0x42, 0x40, 0x80, 0x36, 0x21, 0xB9, 0x70, 0xF7, 0x76, 0xEE, 0x3E, 0x80, 0x03,
-    0x1E, 0x60, 0x10, 0x01, 0x19, 0x23, 0xCE, 0x48, 0xC3, 0xC9, 0x76, 0x53, 0xE3, 0x45, 0x27, 0x5A,
-    0x1A, 0xC9, 0xD3, 0x53, 0x55, 0xDD, 0x5D, 0x6D, 0x80, 0x61, 0x6A, 0xA8, 0x0E, 0xD8, 0xF0, 0xAB,
-    0x44, 0x62, 0x11, 0x39, 0x35, 0x5C, 0x29, 0xE9, 0x95, 0x1B, 0x63, 0x97, 0x95, 0x5E, 0xDB, 0x5C,
-    0x37, 0x46, 0xDA, 0x58, 0x5A, 0x64, 0x4D, 0x60, 0x44, 0x25, 0xE6, 0xE3, 0x01, 0x89, 0x48, 0x0D,
-    0xB9, 0xEC, 0x50, 0x3C, 0x96, 0xDA, 0x34, 0x87, 0x1E, 0x3E, 0x33, 0x36, 0x7B, 0x6A, 0x7D, 0x72,
-    0x47, 0x62, 0xE1, 0x13, 0xA7, 0xC6, 0xF9, 0x88, 0x4A, 0xA4, 0xD1, 0x22, 0x3E, 0x16, 0x19, 0xB1,
-    0xD9, 0x8E, 0x40, 0x19, 0x54, 0xB0, 0x04, 0x94, 0x03, 0xA4, 0x44, 0xD1, 0x41, 0xFF, 0xAC, 0x23,
-    0xDF, 0xA3, 0x30, 0xD6, 0xD8, 0x21, 0xF6, 0xA6, 0xA9, 0x70, 0x6D, 0xAC, 0xFE, 0x25, 0x22, 0x85,
-    0xC8, 0xB7, 0xDD, 0xEE, 0x23, 0x19, 0xAC, 0xF8, 0x55, 0xC4, 0x99, 0x27, 0xAD, 0xBA, 0xE9, 0x62,
-    0xB7, 0x87, 0xCF, 0xB1, 0x31, 0x65, 0xAA, 0xAC, 0xBE, 0x75, 0x49, 0xEB, 0xA3, 0x6E, 0x83, 0x7D,
-    0x8A, 0xE5, 0xAC, 0xC4, 0xC5, 0x0C, 0x4C, 0x27, 0x4D, 0x07, 0x5F, 0x20, 0xD3, 0x56, 0xD9, 0x0E,
-    0x5D, 0x8E, 0x5C, 0x5B, 0x7D, 0xE3, 0x02, 0x2E, 0x37, 0x75, 0x21, 0x83, 0x09, 0x33, 0x9C, 0xA2,
-    0x10, 0x9B, 0x8A, 0x4B, 0xD8, 0xD1, 0x81, 0x56, 0xD0, 0x87, 0x93, 0x29, 0x2B, 0xE0, 0x35, 0x70,
-    0x0D, 0x1C, 0x85, 0x84, 0x66, 0xB1, 0x7B, 0x8F, 0xC5, 0xF1, 0x56, 0x86, 0xE5, 0x73, 0x72, 0x16,
-    0x3B, 0x42, 0xA9, 0xA0, 0xBE, 0xB0, 0x39, 0x7A, 0x13, 0x93, 0x0D, 0xF2, 0xD0, 0xF3, 0xBC, 0x0A,
-    0xA2, 0x3C, 0x59, 0x09, 0x4D, 0xBD, 0x44, 0x08, 0x38, 0x12, 0x90, 0x12, 0x90, 0x04, 0x00, 0xCE,
-    0x50, 0x46, 0xF2, 0xB9, 0x53, 0x22, 0xBD, 0x79, 0xE3, 0xD7, 0x29, 0xDA, 0xF5, 0x2A, 0x6E, 0x5F,
-    0x66, 0x22, 0x5D, 0x2A, 0xD2, 0x6A, 0x7F, 0xAC, 0x03, 0x88, 0x51, 0xD1, 0xB2, 0xAA, 0x05, 0x72,
-    0xDE, 0x32, 0x4C, 0xAB, 0x82, 0xB6, 0xD4, 0x61, 0x2E, 0x0A, 0x45, 0x3D, 0xA6, 0x6E, 0xFF, 0x7F,
-    0x8C, 0xDE, 0xB5, 0x50, 0x12, 0x1C, 0x66, 0x41, 0xDD, 0xE1, 0x21, 0xFA, 0xA8, 0x8F, 0xFB, 0xC4,
-    0x9F, 0x2E, 0x9A, 0x86, 0x67, 0xB6, 0xB0, 0xD1, 0x87, 0x73, 0x3D, 0x6C, 0xD2, 0xCB, 0x5E, 0xEB,
-    0xA0, 0x97, 0xB6, 0x6D, 0xF1, 0xDB, 0xED, 0xAB, 0xE6, 0xFC, 0x51, 0xF9, 0x8F, 0xB6, 0xE6, 0xE1,
-    0x53, 0xCC, 0xB2, 0x9A, 0xB9, 0x74, 0xA0, 0x65, 0xE3, 0x24, 0xAE, 0x58, 0x8C, 0x7B, 0xE1, 0x1C,
-    0x2E, 0xFA, 0x73, 0x6A, 0x8A, 0x03, 0x4F, 0xBD, 0x9C, 0xE2, 0x8A, 0x14, 0x3F, 0x4D, 0xAF, 0xB9,
-    0xEE, 0xAA, 0x3B, 0x0D, 0x53, 0xC9, 0x5B, 0xCC, 0xC3, 0x02, 0xE6, 0x12, 0x34, 0x9B, 0xE4, 0xFE,
-    0x19, 0x1B, 0xA6, 0xE0, 0xF2, 0x53, 0xFF, 0x40, 0x5D, 0x05, 0x17, 0x09, 0x4E, 0xF9, 0xDF, 0x44,
-    0xF2, 0x7D, 0xAA, 0x8B, 0x6D, 0x1F, 0x6D, 0xE5, 0x47, 0xC2, 0xAB, 0x62, 0xE6, 0x6C, 0xF6, 0x82,
-    0xAB, 0x13, 0x5B, 0xDC, 0x5F, 0x4C, 0x94, 0xBF,
+static const uint8_t opendyslexic_8_bolditalicBitmaps[18436] = {
+    0xAD, 0x99, 0x3F, 0xAC, 0x67, 0x47, 0x75, 0xC7, 0x3F, 0x33, 0x63, 0xEF, 0x05, 0xDF, 0xC0, 0x6C,
+    0xE1, 0x15, 0x91, 0x17, 0x7C, 0x29, 0x52, 0x18, 0xCB, 0xDE, 0x4B, 0x89, 0xA2, 0xDF, 0xFB, 0xCD,
+    0xD8, 0x2E, 0x2C, 0xE1, 0xC2, 0x5B, 0x78, 0x95, 0x28, 0x2E, 0x12, 0x29, 0x14, 0x16, 0x8A, 0x78,
+    0xA9, 0xA2, 0x55, 0xF4, 0xF6, 0xDD, 0x31, 0x48, 0x71, 0x41, 0xB1, 0x5B, 0x18, 0xA5, 0x48, 0xC1,
+    0x46, 0x72, 0x61, 0x9C, 0xC2, 0x28, 0x72, 0xB1, 0x8A, 0xDE, 0x7B, 0x77, 0xCC, 0x16, 0x5B, 0xA4,
+    0xF0, 0x85, 0x95, 0x70, 0x81, 0x14, 0xAE, 0x81, 0x04, 0x05, 0x14, 0x79, 0xC0, 0xE3, 0x70, 0xD7,
+    0x6F, 0xEE, 0x3D, 0x29, 0x7E, 0xBF, 0xB7, 0x7F, 0x20, 0x98, 0x04, 0x18, 0xFD, 0x7E, 0xBF, 0x19,
+    0x8D, 0xCE, 0x9C, 0x39, 0x33, 0xE7, 0xCC, 0x39, 0xDF, 0x73, 0x7E, 0x00, 0x1F, 0x41, 0x0F, 0xEC,
+    0x50, 0x45, 0xAE, 0x61, 0xBD, 0x4A, 0xB4, 0x98, 0x91, 0x3D, 0xAA, 0xC8, 0x23, 0xDC, 0x69, 0x47,
+    0xD8, 0x41, 0xCF, 0xB8, 0xA8, 0x5F, 0xE5, 0xD1, 0xCF, 0x5F, 0x75, 0x5F, 0x4D, 0xEE, 0xA5, 0xD4,
+    0x5E, 0x4F, 0xCD, 0xF5, 0xC9, 0x7E, 0xA7, 0xC0, 0xCA, 0x02, 0x6D, 0x1D, 0xC1, 0x7E, 0x65, 0x84,
+    0xEA, 0xCD, 0x84, 0x16, 0x11, 0x41, 0x44, 0x84, 0x33, 0xF3, 0xEE, 0x05, 0xCF, 0xDA, 0x06, 0x68,
+    0x9F, 0x1E, 0xA8, 0x44, 0xA4, 0x18, 0x11, 0x99, 0xF9, 0x93, 0xF7, 0xE7, 0x0B, 0xA8, 0xE2, 0x80,
+    0xC3, 0xC6, 0xC3, 0xA3, 0x0F, 0x04, 0x00, 0xE5, 0xC1, 0x02, 0x2B, 0xE8, 0x6E, 0xD1, 0x48, 0x52,
+    0xB2, 0x8F, 0x1D, 0x12, 0xAE, 0x8A, 0x2C, 0x5F, 0xC2, 0xC8, 0x84, 0x96, 0x02, 0xBB, 0x05, 0xBA,
+    0xF4, 0x29, 0x2D, 0x6F, 0xCA, 0xEB, 0x73, 0x2B, 0x32, 0x9C, 0x95, 0x0C, 0xB5, 0x87, 0x15, 0x90,
+    0x00, 0x1E, 0x01, 0xDE, 0xD0, 0x93, 0x1E, 0xEB, 0x4F, 0x56, 0xF1, 0x63, 0x9F, 0x6C, 0xF8, 0xE4,
+    0x6A, 0x45, 0x93, 0x33, 0xF5, 0xCD, 0x01, 0xEC, 0xD7, 0x07, 0xDA, 0x8B, 0x23, 0x07, 0xDF, 0x1C,
+    0x55, 0x7A, 0x67, 0xA8, 0x06, 0x89, 0x36, 0xAC, 0x79, 0x14, 0xA0, 0x1D, 0xB0, 0xCF, 0x7B, 0x13,
+    0x57, 0xAC, 0x4C, 0x30, 0x6F, 0x66, 0x9A, 0x19, 0x25, 0xD0, 0x0D, 0x0F, 0x36, 0x97, 0x9F, 0xB9,
+    0x9E, 0xD6, 0xD9, 0x29, 0x31, 0x22, 0x43, 0x2B, 0x33, 0xDD, 0xE8, 0x01, 0xA4, 0xBD, 0x91, 0x8A,
+    0xFB, 0xBB, 0xAB, 0x70, 0x0D, 0x9D, 0xA9, 0x06, 0x9A, 0x80, 0x83, 0x03, 0xC8, 0x98, 0x44, 0x35,
+    0x50, 0x47, 0x6C, 0xA0, 0x81, 0x16, 0x1C, 0xAC, 0x4F, 0x3E, 0x0E, 0x1C, 0xB4, 0xD0, 0x78, 0x6C,
+    0xA4, 0x8E, 0xEC, 0x41, 0x81, 0x09, 0x35, 0xA1, 0x13, 0x26, 0x61, 0x4E, 0x56, 0xB7, 0x70, 0x09,
+    0x26, 0x74, 0xA2, 0x8E, 0x34, 0xB0, 0x87, 0x4A, 0xD4, 0x91, 0x16, 0x0A, 0x66, 0xA4, 0xF5, 0x4C,
+    0x00, 0xBC, 0xC1, 0x5F, 0xDE, 0xA8, 0xA4, 0xD4, 0xE2, 0x9B, 0xC5, 0xC8, 0x52, 0xAF, 0xAE, 0xAA,
+    0x04, 0xC0, 0xFD, 0xE8, 0x91, 0x1D, 0x4C, 0x6C, 0xE5, 0x3D, 0x59, 0xC8, 0x58, 0x54, 0xE2, 0x3E,
+    0xF4, 0x2B, 0xCD, 0x70, 0x64, 0x92, 0x7B, 0xB1, 0xE0, 0xE4, 0x86, 0x94, 0x07, 0x9E, 0xB9, 0xF9,
+    0xB3, 0x72, 0xDB, 0x10, 0x1E, 0x61, 0x7B, 0xAF, 0x7A, 0x04, 0x4C, 0x04, 0xEA, 0x00, 0x34, 0x00,
+    0x3B, 0x00, 0x7B, 0x00, 0x19, 0xD0, 0x09, 0x30, 0x03, 0x50, 0xC7, 0x13, 0x8A, 0xF5, 0x6D, 0x8A,
+    0xE9, 0x36, 0xC5, 0x78, 0x42, 0x61, 0x3D, 0xE0, 0x00, 0x2E, 0x01, 0x14, 0x40, 0xE5, 0x7B, 0x28,
+    0x3E, 0x06, 0x70, 0x1A, 0x80, 0xB3, 0x03, 0x47, 0x59, 0xA7, 0x55, 0x15, 0x57, 0xF6, 0xDF, 0x56,
+    0x76, 0x7F, 0xAF, 0xD9, 0x99, 0xDA, 0xD5, 0xE4, 0x74, 0x72, 0xCF, 0x24, 0x27, 0x83, 0x93, 0xD0,
+    0x2C, 0x9C, 0xFA, 0x11, 0x9C, 0x0A, 0x55, 0x41, 0xC2, 0xC7, 0x32, 0x0D, 0x3A, 0xB1, 0xA6, 0x1A,
+    0x38, 0xC0, 0xC6, 0x46, 0xAE, 0x4B, 0x71, 0x12, 0x69, 0x33, 0x4E, 0xBC, 0xFD, 0xFB, 0xA4, 0x38,
+    0x80, 0x35, 0xB4, 0x9E, 0x36, 0xD0, 0x45, 0xFA, 0xA8, 0x24, 0x22, 0x42, 0x2F, 0xD1, 0x49, 0x82,
+    0x36, 0xD3, 0x8A, 0xFF, 0xA8, 0x4A, 0xB0, 0x07, 0x97, 0xB0, 0x0B, 0xB5, 0x40, 0x35, 0xC2, 0xA4,
+    0xFF, 0x63, 0xDE, 0x90, 0xFA, 0xB3, 0x0B, 0xC0, 0x45, 0xAA, 0x81, 0x8E, 0xAA, 0xF0, 0xB7, 0xA9,
+    0xBA, 0x1C, 0xF6, 0x76, 0xAA, 0x9F, 0xCE, 0x4E, 0xF2, 0x6B, 0x12, 0xD5, 0x44, 0x3D, 0x6C, 0x4E,
+    0x0A, 0xD0, 0x0B, 0xB2, 0x90, 0x50, 0x09, 0x3D, 0x62, 0x24, 0x54, 0x92, 0xD4, 0x13, 0x13, 0x4C,
+    0x1F, 0xAD, 0x72, 0x23, 0xA9, 0x95, 0xE8, 0x16, 0xD4, 0x79, 0xA8, 0x17, 0xBA, 0x59, 0xDF, 0x7A,
+    0xCE, 0x44, 0x6C, 0x1F, 0x1A, 0x19, 0xDB, 0xB7, 0x93, 0x7B, 0x22, 0xAD, 0x55, 0x5A, 0x9B, 0xE4,
+    0x5E, 0x1F, 0x5A, 0x09, 0xF5, 0x2D, 0xC0, 0xC8, 0xD2, 0x49, 0xA4, 0xD0, 0x78, 0x93, 0x38, 0xC4,
+    0x46, 0x3D, 0xE1, 0xB0, 0xA3, 0x9A, 0x71, 0x11, 0xF4, 0x2B, 0xD4, 0x12, 0xEB, 0x6F, 0x27, 0x33,
+    0xAC, 0x54, 0xEE, 0x70, 0x42, 0x25, 0xDE, 0xBE, 0x9D, 0x6C, 0xBC, 0x54, 0x8D, 0xAD, 0x9A, 0x9A,
+    0xD8, 0xC9, 0x68, 0x65, 0xE4, 0x4B, 0x01, 0xDA, 0x51, 0xC9, 0x64, 0x86, 0xBD, 0xDA, 0xAF, 0x2C,
+    0xAB, 0x8F, 0x53, 0xEC, 0x3F, 0x4C, 0x56, 0xB2, 0x96, 0x84, 0x19, 0xFF, 0xF8, 0xF5, 0xD8, 0x89,
+    0xEF, 0x37, 0xC6, 0x46, 0x35, 0xB6, 0x61, 0xAE, 0x37, 0x06, 0x66, 0xC3, 0x91, 0xC9, 0xED, 0x00,
+    0xD8, 0x68, 0x92, 0x2E, 0xC8, 0xF6, 0xBC, 0xEA, 0x39, 0x16, 0x3A, 0x5C, 0x68, 0xA2, 0x1D, 0xD4,
+    0x79, 0xE0, 0xBE, 0x8D, 0x2D, 0xF4, 0x03, 0xED, 0x4C, 0x2D, 0x1E, 0x19, 0xD0, 0x72, 0x85, 0x4A,
+    0x16, 0xCF, 0xAE, 0x8C, 0xA8, 0x3E, 0x42, 0x0D, 0x50, 0xCB, 0xD8, 0x4B, 0x00, 0xCE, 0x9C, 0x77,
+    0xF2, 0x65, 0xF9, 0x00, 0xFC, 0xC6, 0x42, 0xEC, 0x04, 0xF5, 0x02, 0x95, 0x04, 0x94, 0x44, 0xCE,
+    0x2E, 0xEC, 0xCA, 0xD4, 0xC8, 0x8F, 0xE8, 0xAF, 0x60, 0xAE, 0x6C, 0xF7, 0x3E, 0x35, 0xD1, 0x48,
+    0xB4, 0x43, 0xC1, 0x37, 0x50, 0x47, 0xCC, 0x88, 0xCA, 0xA8, 0x42, 0x5D, 0xA8, 0x27, 0x4C, 0x46,
+    0x15, 0x38, 0x82, 0x3F, 0x3A, 0x51, 0x8F, 0xBA, 0x0A, 0x13, 0x1C, 0x81, 0xF3, 0xB7, 0xDF, 0x41,
+    0x1F, 0xE0, 0xE8, 0x75, 0x58, 0xF3, 0x39, 0x2C, 0x2A, 0x9A, 0x1B, 0xF9, 0x0F, 0x78, 0xE3, 0x6D,
+    0xA2, 0xFD, 0xEC, 0x5F, 0x3F, 0xA6, 0xDE, 0x93, 0xDA, 0xB7, 0xED, 0xF1, 0xA0, 0xB3, 0xBA, 0x42,
+    0x33, 0x3E, 0x08, 0x22, 0x03, 0x5A, 0x66, 0x50, 0xFF, 0x72, 0xC2, 0xA4, 0x85, 0x2A, 0x81, 0x78,
+    0xDA, 0x4C, 0xF5, 0x56, 0x60, 0x9A, 0x68, 0x6D, 0xAC, 0xC6, 0x42, 0xB1, 0xB1, 0x95, 0x52, 0x89,
+    0x0C, 0x22, 0xB3, 0x0B, 0xF6, 0xC7, 0x89, 0x05, 0x99, 0x68, 0x24, 0xE9, 0xDC, 0x78, 0x47, 0x36,
+    0x63, 0xC3, 0xFE, 0xF3, 0x63, 0x2D, 0x13, 0x22, 0x43, 0x13, 0x9C, 0xCE, 0x26, 0xB9, 0xD7, 0x16,
+    0x23, 0x32, 0x74, 0x32, 0xD5, 0x72, 0x6B, 0x2B, 0x7C, 0x3F, 0xD2, 0x49, 0xA8, 0xA5, 0xD0, 0x5F,
+    0x39, 0x5D, 0x65, 0x70, 0x1E, 0x5D, 0xC0, 0x8E, 0xE0, 0x02, 0x4A, 0xF8, 0xB4, 0x11, 0x89, 0x56,
+    0x16, 0x1A, 0xC9, 0xB4, 0x32, 0x80, 0x2C, 0x28, 0x91, 0x41, 0x8B, 0x24, 0x93, 0xAA, 0x6C, 0x92,
+    0x9A, 0xAA, 0x91, 0xA9, 0x1E, 0xC8, 0x36, 0xEA, 0xD4, 0x84, 0x2A, 0xB5, 0x61, 0x77, 0x70, 0x22,
+    0xD1, 0x89, 0xF8, 0x4E, 0x66, 0x7A, 0xB9, 0x02, 0xBB, 0x32, 0x58, 0x29, 0x2C, 0x5F, 0xA3, 0x05,
+    0x93, 0xC0, 0xFD, 0x19, 0x95, 0x24, 0xFA, 0x05, 0x1B, 0x51, 0x13, 0xB4, 0x3F, 0xB9, 0x6A, 0x44,
+    0x7C, 0x27, 0xA9, 0x16, 0x81, 0x5D, 0x09, 0xAD, 0x0C, 0xF6, 0xDF, 0xCF, 0x57, 0x03, 0x3A, 0x81,
+    0x2C, 0x74, 0xE2, 0x5B, 0x89, 0x36, 0x52, 0x8D, 0xE8, 0x0C, 0x33, 0x74, 0xD0, 0x46, 0x80, 0x2F,
+    0xBE, 0x42, 0x2D, 0x33, 0x4E, 0x66, 0x24, 0xDC, 0xA7, 0x0B, 0x98, 0xBC, 0xB9, 0x44, 0x3B, 0x3E,
+    0xFC, 0xB2, 0x1D, 0xDA, 0xD9, 0xC6, 0xB3, 0x73, 0x33, 0xE8, 0x6C, 0x97, 0xD7, 0x93, 0x15, 0x19,
+    0x8D, 0xC8, 0xC0, 0xEB, 0xB7, 0xE0, 0x80, 0x4B, 0x14, 0x0E, 0xD4, 0x44, 0xD1, 0x59, 0x15, 0x93,
+    0xF4, 0x64, 0x92, 0xC9, 0xF5, 0x58, 0x25, 0xFB, 0xC1, 0x86, 0xB6, 0x11, 0x19, 0x5A, 0x91, 0xE8,
+    0x82, 0x8B, 0x9D, 0x77, 0xA1, 0xA7, 0xF3, 0x14, 0x8A, 0xCA, 0x3A, 0x99, 0x64, 0xC6, 0x6A, 0xA8,
+    0xA3, 0x8D, 0x36, 0xB4, 0xC1, 0xF9, 0x8E, 0x0E, 0x50, 0x13, 0xD8, 0x08, 0x0E, 0x74, 0xDE, 0x0C,
+    0xF7, 0xEF, 0x19, 0x9A, 0xB4, 0x19, 0x1E, 0x82, 0x49, 0x9C, 0x6E, 0x83, 0x92, 0x82, 0x95, 0x91,
+    0x6E, 0x81, 0x33, 0x1E, 0x68, 0xEB, 0x44, 0xE9, 0xA8, 0x6E, 0x26, 0x9C, 0xF3, 0x1C, 0x67, 0x6A,
+    0xF1, 0xB8, 0x09, 0x25, 0x81, 0x7A, 0x01, 0x37, 0xA3, 0x64, 0xC6, 0x7E, 0xAF, 0xE0, 0x6C, 0xD1,
+    0x53, 0x5B, 0xE0, 0x12, 0x3A, 0x61, 0x23, 0xFB, 0x77, 0xFA, 0xBC, 0xED, 0xA7, 0x33, 0xCF, 0xCA,
+    0xDC, 0xC9, 0xCF, 0x45, 0x22, 0x3D, 0x76, 0xB0, 0xC9, 0x14, 0xC4, 0xF7, 0xB1, 0x9D, 0xEC, 0x64,
+    0xE4, 0x2B, 0xE2, 0x5D, 0xE9, 0x53, 0xF5, 0xEE, 0x5B, 0xC2, 0xA1, 0x1C, 0x8F, 0xF6, 0xAD, 0xE5,
+    0x48, 0x4D, 0xF2, 0xD6, 0xD0, 0x5E, 0x7E, 0xBF, 0x98, 0x2C, 0x2E, 0x76, 0xF6, 0xE6, 0x54, 0xA7,
+    0xE7, 0x7A, 0xCF, 0x19, 0xD6, 0x74, 0x5C, 0xA2, 0xF7, 0x07, 0x48, 0x28, 0x4A, 0xDE, 0xCC, 0x5A,
+    0xBE, 0x95, 0xCC, 0xF1, 0xF5, 0x54, 0xFD, 0xE2, 0xED, 0xC1, 0xFE, 0xF8, 0xA7, 0xD1, 0xDE, 0x94,
+    0xD8, 0x5E, 0x17, 0xEF, 0xAE, 0x0B, 0xEE, 0xCB, 0x42, 0xFF, 0xC4, 0x02, 0xAA, 0xBF, 0x82, 0x91,
+    0x05, 0x33, 0xEF, 0x0E, 0x26, 0xAB, 0x62, 0x32, 0x8E, 0x09, 0x1B, 0x0F, 0x31, 0xA3, 0x43, 0x67,
+    0x1B, 0x29, 0xD5, 0x74, 0x6A, 0x51, 0x22, 0xE2, 0x9D, 0x48, 0xA8, 0x45, 0x02, 0xBB, 0xCB, 0x1D,
+    0xB8, 0x51, 0x49, 0xA4, 0x17, 0x6C, 0x98, 0x54, 0xAE, 0x43, 0xAB, 0x27, 0x23, 0x42, 0x27, 0x43,
+    0x2D, 0x99, 0xE5, 0x65, 0x9A, 0x88, 0x9E, 0xC0, 0x79, 0xAA, 0x0C, 0x3D, 0x00, 0x67, 0x80, 0x7E,
+    0x42, 0x89, 0x04, 0x35, 0x57, 0x59, 0x15, 0xF6, 0x99, 0xB1, 0x61, 0x9F, 0x6A, 0x6C, 0xBD, 0xCA,
+    0x36, 0x52, 0x4C, 0x3A, 0xBD, 0xA6, 0xD8, 0xDE, 0x3B, 0x91, 0x60, 0x45, 0xA2, 0x12, 0x89, 0xD4,
+    0x92, 0xA1, 0x12, 0x40, 0xC6, 0xCD, 0xF6, 0x6E, 0xA2, 0x95, 0x68, 0x7D, 0x36, 0x71, 0xA5, 0x53,
+    0xC3, 0xD4, 0x04, 0x27, 0xB1, 0x95, 0x68, 0x25, 0x9B, 0xB4, 0xD6, 0xA5, 0x09, 0x4B, 0x9D, 0xDC,
+    0x53, 0xA5, 0x1D, 0xB6, 0x3E, 0xED, 0x0C, 0x34, 0x12, 0xB5, 0x14, 0x9A, 0xE1, 0x34, 0x07, 0x5B,
+    0xCD, 0xDF, 0x82, 0x56, 0x02, 0x8D, 0x44, 0x94, 0x78, 0x58, 0xD4, 0x58, 0xE5, 0x46, 0x24, 0x8A,
+    0x4C, 0xF4, 0x0B, 0x38, 0x91, 0x1B, 0x22, 0xA5, 0x17, 0x09, 0x66, 0x84, 0xC3, 0x8D, 0xB5, 0x14,
+    0x68, 0x02, 0x26, 0x83, 0xDB, 0x58, 0xF7, 0x11, 0xD8, 0x01, 0x55, 0x80, 0x85, 0x45, 0x15, 0x66,
+    0x5D, 0x54, 0x31, 0x93, 0x2E, 0x26, 0x9B, 0x5C, 0x25, 0x93, 0xEA, 0xB1, 0x4A, 0x76, 0xA8, 0x07,
+    0x1B, 0x6D, 0xB4, 0xB1, 0x8D, 0x8D, 0x88, 0x6F, 0x44, 0x68, 0x64, 0xDE, 0x9C, 0x0F, 0x28, 0xD4,
+    0x6F, 0x45, 0x35, 0xCD, 0x38, 0x3B, 0xD8, 0x61, 0xD1, 0xA5, 0x1E, 0x3B, 0x7A, 0x3B, 0xD6, 0x3F,
+    0x2F, 0xF4, 0xBD, 0xAF, 0x25, 0xD1, 0x15, 0x2A, 0x09, 0x74, 0x89, 0x6A, 0xDE, 0xAA, 0xC2, 0x79,
+    0x28, 0xCE, 0xA3, 0x27, 0xE7, 0x31, 0xC9, 0xF9, 0xF3, 0xF5, 0xE8, 0x9E, 0x98, 0x9A, 0xD8, 0x99,
+    0xC9, 0x85, 0xCE, 0x96, 0x8E, 0xCE, 0x95, 0x99, 0xAE, 0x5F, 0x0A, 0xFD, 0x2C, 0x99, 0xBE, 0x48,
+    0xA2, 0x4F, 0xFD, 0x40, 0x3F, 0xF4, 0x91, 0x3E, 0xF6, 0x1E, 0xD6, 0x34, 0xDE, 0xC6, 0x26, 0xE8,
+    0xC9, 0x06, 0x9C, 0x8D, 0xD8, 0xEF, 0x47, 0xB4, 0x44, 0xE8, 0x86, 0x8D, 0x33, 0xB2, 0x05, 0xAC,
+    0x04, 0xEC, 0xBB, 0x09, 0xFB, 0x83, 0x99, 0x26, 0xB9, 0xD8, 0x24, 0x9B, 0x29, 0xB8, 0xD6, 0xB7,
+    0x4F, 0x8F, 0xCD, 0x8B, 0xC5, 0x46, 0x67, 0xA3, 0xFD, 0xFE, 0xA0, 0x65, 0xA4, 0x4B, 0x34, 0xE9,
+    0xC4, 0x5F, 0xF7, 0xE0, 0x02, 0xCD, 0x00, 0x6C, 0x75, 0x3B, 0x68, 0x91, 0x04, 0xEE, 0xAE, 0x6F,
+    0x37, 0x42, 0x3F, 0x82, 0x8C, 0x28, 0x19, 0xD0, 0xF2, 0xC1, 0x2B, 0x88, 0x2C, 0x74, 0x22, 0xA1,
+    0x15, 0x19, 0x41, 0x49, 0xA0, 0x1F, 0x58, 0xC3, 0xED, 0xE0, 0x40, 0x62, 0x8B, 0x0A, 0xAC, 0xA7,
+    0xDA, 0x4C, 0x65, 0xD8, 0x83, 0x73, 0x27, 0x53, 0x3A, 0x9D, 0x4C, 0xB5, 0x60, 0x67, 0x8C, 0x6C,
+    0x4E, 0x06, 0xF0, 0x91, 0x47, 0x3E, 0xB7, 0xB7, 0xB7, 0x5A, 0xAD, 0x76, 0x76, 0xD6, 0x6B, 0xE7,
+    0xD6, 0xAB, 0xCF, 0x9E, 0x96, 0x48, 0x3B, 0x6D, 0xBC, 0x7F, 0x84, 0x7C, 0xF7, 0x68, 0x7D, 0xF7,
+    0xA8, 0xBE, 0x7B, 0xA4, 0xD2, 0xDD, 0xA3, 0x1D, 0xB4, 0x44, 0xBA, 0x84, 0x3D, 0xD1, 0xD2, 0x8A,
+    0x3A, 0xA9, 0xE3, 0x61, 0xA7, 0x0E, 0x80, 0x12, 0x29, 0x4E, 0xE4, 0xC5, 0x0B, 0x17, 0xCE, 0xAF,
+    0x59, 0xB3, 0xBF, 0x09, 0x04, 0xCB, 0xD8, 0xCA, 0x8B, 0xE9, 0x92, 0x25, 0xBF, 0x61, 0xAE, 0xC7,
+    0xCE, 0x4A, 0x69, 0x65, 0x6C, 0xBF, 0xEF, 0x15, 0x58, 0xBF, 0xC5, 0x8F, 0x81, 0x9D, 0x2F, 0x20,
+    0xA5, 0x5A, 0xA6, 0x26, 0xA6, 0x03, 0x73, 0x3D, 0x35, 0xF6, 0xC5, 0xC9, 0x49, 0x94, 0x59, 0xCB,
+    0xC0, 0x79, 0x00, 0x3D, 0x2B, 0x19, 0xF6, 0xB1, 0x41, 0x25, 0x5A, 0xF4, 0xAD, 0x2B, 0x8D, 0xB0,
+    0x3B, 0x6E, 0x42, 0xF0, 0x6A, 0x23, 0xFF, 0x35, 0xB0, 0x5E, 0x7F, 0x90, 0x94, 0x2C, 0xEC, 0xEF,
+    0x0E, 0xD6, 0x17, 0x35, 0x36, 0xE1, 0x5C, 0x95, 0xB5, 0x08, 0x8D, 0x24, 0xBA, 0x23, 0x68, 0x07,
+    0xB5, 0xE4, 0xEA, 0x9D, 0x8B, 0x56, 0xA6, 0xE6, 0xB5, 0x97, 0x5B, 0x4E, 0xB7, 0x92, 0xAC, 0x8C,
+    0x5A, 0x3C, 0x60, 0x0A, 0x12, 0x1A, 0xF4, 0xA8, 0x24, 0xB5, 0x8B, 0x9A, 0xBD, 0x8D, 0x4C, 0xB4,
+    0xDE, 0x24, 0x1C, 0xF5, 0x08, 0x67, 0xBF, 0x17, 0x6B, 0x99, 0x54, 0xEE, 0x59, 0x55, 0xA9, 0xF2,
+    0x47, 0xBC, 0xD1, 0xC4, 0x5A, 0x0A, 0x9D, 0x04, 0x2D, 0x09, 0xD5, 0x42, 0x3D, 0xE8, 0xE3, 0x09,
+    0x27, 0x9C, 0x92, 0x00, 0x3B, 0xB0, 0x07, 0x13, 0x64, 0x54, 0xC2, 0x1C, 0x67, 0x23, 0xA5, 0xCE,
+    0x7B, 0x36, 0xAE, 0x6C, 0xD8, 0x6B, 0xFD, 0xE4, 0x54, 0xEE, 0x4C, 0x3A, 0x32, 0x89, 0x07, 0xA8,
+    0x37, 0x70, 0x05, 0xE0, 0x61, 0xAC, 0x37, 0x51, 0x25, 0xAE, 0xB1, 0x43, 0x83, 0x8D, 0x26, 0x01,
+    0x5F, 0xC0, 0x8C, 0x34, 0xDB, 0x38, 0x7E, 0x3F, 0xEC, 0xA1, 0x47, 0xAC, 0x67, 0x75, 0xBB, 0x57,
+    0xE3, 0xE6, 0x52, 0xCF, 0x8E, 0x88, 0x37, 0xD3, 0x56, 0x47, 0x3A, 0x61, 0xC3, 0xB6, 0xFF, 0xBC,
+    0xDF, 0x99, 0xB4, 0x04, 0x9B, 0xE9, 0xA2, 0x96, 0x68, 0x25, 0xEE, 0x77, 0xDF, 0xCA, 0x12, 0xB8,
+    0xC8, 0x35, 0xB2, 0x4A, 0x66, 0x34, 0xB1, 0x8A, 0x36, 0x58, 0xDF, 0x70, 0x8E, 0x35, 0x5D, 0xEC,
+    0x37, 0x26, 0x65, 0xFB, 0x67, 0x46, 0x2D, 0x22, 0xC1, 0x3D, 0x95, 0xF7, 0xAA, 0x61, 0x5D, 0xC5,
+    0x52, 0xC7, 0xA9, 0x09, 0x93, 0x7D, 0x32, 0xB5, 0x3A, 0x39, 0x93, 0x5C, 0x3D, 0x1C, 0x56, 0x23,
+    0xA0, 0xDF, 0x1D, 0x8D, 0x4C, 0x55, 0x3E, 0xA8, 0xE3, 0x9E, 0xF5, 0x53, 0x43, 0x76, 0x3A, 0x39,
+    0x93, 0x8E, 0xAA, 0x44, 0x3B, 0x28, 0x99, 0xAA, 0xF1, 0xC0, 0xFA, 0xBD, 0x86, 0xA9, 0x7D, 0x3E,
+    0x37, 0x32, 0x5A, 0x89, 0x7A, 0x8B, 0x1B, 0xD6, 0x82, 0x92, 0xD7, 0xA9, 0xD3, 0x63, 0x38, 0xFF,
+    0x4D, 0x8A, 0x89, 0x55, 0x7A, 0x98, 0xF6, 0x38, 0x23, 0x12, 0x6A, 0x99, 0x70, 0x67, 0xEE, 0x89,
+    0x79, 0x57, 0xB7, 0x86, 0x78, 0xF6, 0xED, 0xD8, 0xCA, 0xF8, 0x70, 0x95, 0x2C, 0xA5, 0xF2, 0x97,
+    0xF4, 0xD0, 0xD1, 0x4B, 0x68, 0x64, 0xD0, 0x92, 0xB8, 0x7F, 0x3F, 0xD2, 0x26, 0x6C, 0xE6, 0x94,
+    0x07, 0x50, 0xC7, 0x43, 0x3B, 0x9B, 0x5B, 0xFE, 0x12, 0xF5, 0x56, 0xBF, 0x99, 0x6E, 0x63, 0xAD,
+    0x12, 0x9A, 0x7F, 0xE2, 0x0D, 0xD4, 0x07, 0xD0, 0x07, 0x9C, 0x39, 0x2E, 0x4E, 0x86, 0xDD, 0x2D,
+    0xCA, 0xE4, 0x71, 0x1A, 0xEA, 0xD8, 0xCA, 0x9F, 0xCB, 0x70, 0xC0, 0x1A, 0x4B, 0x15, 0xCD, 0x07,
+    0xC8, 0xE0, 0x32, 0x0D, 0xD3, 0x35, 0xF3, 0x9D, 0xA1, 0xB5, 0x94, 0x55, 0xF5, 0x4E, 0x72, 0x4F,
+    0x4B, 0x69, 0x24, 0xB5, 0x12, 0x76, 0x58, 0xDB, 0xD8, 0xEA, 0xD4, 0x70, 0x68, 0x7D, 0x73, 0x39,
+    0x18, 0x89, 0x48, 0xC4, 0x8D, 0xD8, 0xCD, 0x93, 0x4A, 0x19, 0xFB, 0xD4, 0x90, 0x8A, 0x7D, 0xF6,
+    0xC6, 0xB0, 0x96, 0x0E, 0x91, 0xBC, 0x41, 0x46, 0x33, 0xEE, 0xF2, 0x48, 0x39, 0xC1, 0xEB, 0xA5,
+    0x8E, 0xD5, 0x0F, 0x13, 0xAE, 0xA0, 0x17, 0x68, 0x23, 0xF5, 0x82, 0x3E, 0x4E, 0xCC, 0x6D, 0x70,
+    0x4F, 0x14, 0x98, 0x74, 0x32, 0xA9, 0xA1, 0x8E, 0x13, 0xCD, 0x57, 0x23, 0x6E, 0x07, 0x24, 0xA1,
+    0x05, 0xAA, 0x2D, 0x5E, 0xB8, 0x04, 0x55, 0xA2, 0x16, 0x70, 0x19, 0x16, 0x00, 0x11, 0x9C, 0x44,
+    0x9A, 0x40, 0xEB, 0xE9, 0x60, 0x41, 0xC9, 0x73, 0x88, 0xF8, 0x5E, 0x46, 0xA8, 0x0A, 0x6D, 0xC6,
+    0xC1, 0x25, 0x38, 0x80, 0x82, 0xCA, 0xB4, 0x09, 0x17, 0x69, 0x23, 0x75, 0xC4, 0x6E, 0x52, 0x4A,
+    0x4F, 0x9B, 0x69, 0x12, 0xEA, 0x2A, 0xA0, 0x46, 0xEB, 0x57, 0x6A, 0xAC, 0xFD, 0x4A, 0xA5, 0x3A,
+    0xAC, 0x48, 0x55, 0x78, 0x7C, 0xF3, 0x43, 0x33, 0xD2, 0x0F, 0xB8, 0x6D, 0xAA, 0xD8, 0x78, 0x0E,
+    0xD1, 0x0B, 0x55, 0xC6, 0x85, 0x8D, 0x89, 0x5E, 0x42, 0x27, 0x25, 0xA1, 0x9E, 0xF8, 0x0C, 0x7C,
+    0xF4, 0x0F, 0xDD, 0x5F, 0xFD, 0xCD, 0xF4, 0xE9, 0x2B, 0x00, 0x1F, 0xD1, 0x5C, 0xFC, 0x94, 0x4E,
+    0x07, 0xF6, 0xA5, 0x61, 0x6D, 0x83, 0x7B, 0x36, 0xDA, 0xEB, 0xA9, 0x7A, 0x71, 0xD0, 0x04, 0xE0,
+    0xD3, 0xF7, 0xB1, 0xFA, 0x38, 0xCD, 0xD3, 0x83, 0x4E, 0x13, 0xD3, 0x5A, 0x4F, 0x47, 0xE6, 0x67,
+    0x93, 0x89, 0x49, 0x79, 0x0F, 0x7B, 0xDB, 0x98, 0x38, 0x9C, 0xC4, 0x78, 0x9D, 0xA0, 0x03, 0x9B,
+    0xD1, 0xE2, 0xD9, 0x9B, 0xB0, 0x97, 0x83, 0x4E, 0x85, 0x7D, 0x1B, 0x6D, 0x2C, 0x5A, 0x24, 0x76,
+    0x32, 0x5B, 0x91, 0x9B, 0x13, 0x4B, 0x87, 0x1D, 0x81, 0x07, 0x41, 0x47, 0x78, 0xF8, 0x24, 0xB5,
+    0xBF, 0xA7, 0xB5, 0xA0, 0x0A, 0xD8, 0x0C, 0xFD, 0x40, 0xF5, 0x56, 0x60, 0xBD, 0x46, 0xA7, 0x42,
+    0xF3, 0x95, 0x44, 0xB1, 0xB1, 0x16, 0xA1, 0x93, 0xD9, 0x88, 0x64, 0x17, 0xEC, 0x3B, 0x05, 0x17,
+    0x36, 0x72, 0x8C, 0x9B, 0xF8, 0x23, 0x89, 0xFA, 0xC5, 0x74, 0x5B, 0xB4, 0x26, 0x82, 0x78, 0xEA,
+    0x19, 0xF6, 0x26, 0xCC, 0x0F, 0x47, 0x5A, 0x1B, 0xD5, 0xE4, 0xB0, 0xB1, 0xD0, 0x4B, 0xAA, 0x44,
+    0x06, 0x27, 0xF2, 0xD4, 0xC4, 0xD2, 0x44, 0x33, 0xC1, 0x67, 0x1E, 0x82, 0x43, 0x07, 0x65, 0x1F,
+    0x55, 0x96, 0x7B, 0xE4, 0xA2, 0x03, 0xC4, 0xA3, 0xC5, 0x53, 0xBD, 0x15, 0xB0, 0x97, 0x03, 0xAD,
+    0x8D, 0xEC, 0xDB, 0x48, 0xB1, 0x51, 0x8B, 0xC4, 0x4A, 0x64, 0xB0, 0x22, 0x83, 0x0B, 0x76, 0xDC,
+    0x9E, 0xF6, 0xFF, 0x02, 0xDE, 0xFD, 0x5F, 0xFC, 0x32, 0x78, 0x37, 0x01, 0x5A, 0x0F, 0xFF, 0xB5,
+    0xC9, 0x4A, 0x31, 0x23, 0x34, 0x01, 0x8E, 0x4E, 0xE4, 0x39, 0x25, 0x33, 0x22, 0xD1, 0xFE, 0xE7,
+    0x79, 0x9D, 0xC0, 0x81, 0x79, 0xFF, 0x2A, 0x9D, 0x50, 0xCB, 0xB8, 0x45, 0x1E, 0x7A, 0x79, 0x0D,
+    0x27, 0xB9, 0x12, 0xA1, 0x97, 0xB4, 0x4D, 0xF3, 0x13, 0x9C, 0xDB, 0x14, 0x66, 0xEE, 0x69, 0xFF,
+    0x6F, 0xC8, 0x6F, 0x36, 0xB2, 0x34, 0x05, 0xF3, 0xED, 0xFC, 0xDB, 0x73, 0x79, 0x27, 0xD1, 0x5C,
+    0x8E, 0xCC, 0x1D, 0xFA, 0x1F, 0x5F, 0xBD, 0xFB, 0x68, 0x4E, 0x12, 0xCB, 0xD7, 0xA8, 0x37, 0xB0,
+    0x9C, 0xF9, 0x05, 0x2A, 0x49, 0xB4, 0x12, 0x28, 0x9B, 0x1B, 0x69, 0x7F, 0x72, 0x15, 0x91, 0xA1,
+    0x12, 0xA1, 0x95, 0x82, 0xCA, 0xD4, 0x03, 0xED, 0xED, 0x73, 0x15, 0x6C, 0x54, 0x99, 0x16, 0x73,
+    0x57, 0xA9, 0x80, 0x89, 0x36, 0x98, 0x4C, 0x47, 0x95, 0x80, 0xF3, 0x54, 0x9E, 0xD5, 0xA6, 0xB6,
+    0x71, 0x57, 0x33, 0x09, 0x1B, 0x6F, 0x83, 0xF3, 0x35, 0x2A, 0x53, 0x47, 0x1C, 0x4C, 0xD4, 0x23,
+    0xCE, 0xAB, 0xB2, 0x59, 0x0E, 0x55, 0xC4, 0x05, 0x7D, 0x1C, 0x9B, 0x13, 0x16, 0x0E, 0x0A, 0xD5,
+    0x70, 0xBB, 0x7C, 0xD3, 0x78, 0x0E, 0x30, 0x09, 0x1B, 0x38, 0xC2, 0x64, 0x9A, 0x48, 0x07, 0xBC,
+    0xF2, 0x82, 0x9A, 0x8A, 0xC9, 0xC5, 0xFC, 0xF7, 0x9D, 0x8A, 0x0C, 0x65, 0xEB, 0x10, 0xB6, 0x25,
+    0xA2, 0xF1, 0xA4, 0xC6, 0xB4, 0x29, 0x14, 0x05, 0x9C, 0xA7, 0xDB, 0x98, 0x20, 0xE7, 0x3E, 0x07,
+    0x5D, 0x86, 0x7F, 0x1E, 0x6F, 0xAF, 0xFE, 0x6D, 0x51, 0x3E, 0x7B, 0x6C, 0x9C, 0x19, 0xE5, 0x6E,
+    0x73, 0xF8, 0x11, 0x88, 0x04, 0xE4, 0xF9, 0xCC, 0x4C, 0xC7, 0x8C, 0x8D, 0x6B, 0x4C, 0x6A, 0x3D,
+    0x93, 0x8D, 0x1C, 0x9A, 0x84, 0x53, 0x8B, 0xEA, 0x43, 0xB7, 0xB1, 0xF7, 0x51, 0x8B, 0x8C, 0x9C,
+    0x95, 0x70, 0xC2, 0xE0, 0x41, 0xE0, 0x31, 0x36, 0x6F, 0xDC, 0xF2, 0xAB, 0xED, 0xF7, 0x90, 0x5C,
+    0xC0, 0x39, 0xB6, 0x90, 0x53, 0xB8, 0xFD, 0xE6, 0x39, 0x7B, 0x0B, 0x9C, 0x8C, 0xB8, 0xEF, 0xCE,
+    0x38, 0xDF, 0x44, 0xE7, 0x4D, 0xB2, 0x81, 0x52, 0x0F, 0xAC, 0x4D, 0xA2, 0xF5, 0x05, 0x1B, 0xBB,
+    0xB0, 0x3B, 0x36, 0x9B, 0xC0, 0x30, 0xD1, 0xCB, 0xC4, 0x29, 0xB9, 0x7D, 0x95, 0x9F, 0x79, 0x08,
+    0xDA, 0x67, 0x23, 0xF6, 0xC6, 0x48, 0xF5, 0xDE, 0x74, 0x67, 0xBB, 0xDF, 0x99, 0xF3, 0x04, 0xEC,
+    0x03, 0x6D, 0xB8, 0xE7, 0x2E, 0x7E, 0x87, 0x5C, 0x00, 0x38, 0x0F, 0x6A, 0xDC, 0xBC, 0x6D, 0xEB,
+    0xF9, 0xDF, 0xDA, 0xEF, 0xC6, 0x7F, 0xE3, 0xA4, 0x75, 0x81, 0xEA, 0x5D, 0x8F, 0xD5, 0xE3, 0xEF,
+    0x87, 0xEF, 0x0B, 0x8F, 0xC0, 0x74, 0x88, 0x9E, 0x0A, 0xE6, 0xFD, 0xF2, 0x7B, 0x93, 0x77, 0x53,
+    0x7C, 0xED, 0xF8, 0x70, 0xAC, 0x0C, 0x8F, 0xC1, 0x45, 0x48, 0xA8, 0xF3, 0xF7, 0x6C, 0xDD, 0x5D,
+    0xD3, 0x32, 0x55, 0x6F, 0x66, 0x4B, 0x7E, 0x9C, 0xB4, 0xAA, 0x92, 0x93, 0xD4, 0xCA, 0x58, 0xFF,
+    0x62, 0x60, 0x05, 0x1D, 0xC8, 0x60, 0xC6, 0x6B, 0xBF, 0x99, 0xB8, 0xB5, 0xC1, 0xFE, 0xEB, 0x50,
+    0xBD, 0x97, 0xF5, 0x2B, 0x27, 0x5E, 0xAD, 0x3A, 0x0E, 0xB5, 0x8C, 0xD5, 0x9B, 0xD9, 0xC4, 0x1D,
+    0x3D, 0x58, 0x52, 0x13, 0x9D, 0xA4, 0x5A, 0x26, 0xFA, 0x4B, 0xBF, 0x0E, 0x90, 0x77, 0xA3, 0x4A,
+    0x7C, 0xC2, 0x57, 0x89, 0x17, 0xC0, 0x7A, 0xEA, 0x01, 0x9D, 0xEF, 0x8D, 0x96, 0x1F, 0x02, 0xBF,
+    0xEF, 0x87, 0xCA, 0x63, 0xE2, 0xAF, 0x38, 0xB8, 0x6D, 0xE0, 0x9E, 0xA9, 0x8E, 0x87, 0xEA, 0x9D,
+    0x8B, 0x46, 0x16, 0xF5, 0xC1, 0x37, 0xFC, 0x01, 0xBE, 0x95, 0x64, 0x64, 0xA2, 0xCD, 0x27, 0xDE,
+    0xCD, 0x14, 0xF4, 0x71, 0x54, 0xE9, 0xF1, 0x7B, 0xB6, 0xA4, 0x3B, 0x64, 0xFF, 0x13, 0xC1, 0xC9,
+    0xD8, 0xBC, 0xF6, 0x72, 0x1D, 0xEF, 0xD3, 0x22, 0x38, 0x09, 0x5A, 0x3C, 0x3C, 0xF0, 0x64, 0x50,
+    0xD3, 0x01, 0xED, 0xB3, 0xF1, 0x1E, 0xE7, 0x76, 0xB2, 0xB2, 0x79, 0xD7, 0x57, 0xEF, 0x5C, 0x44,
+    0x24, 0x34, 0xAF, 0xBD, 0xAC, 0x93, 0xA2, 0x95, 0x84, 0x2C, 0x68, 0xF1, 0xD4, 0xD1, 0xA4, 0x8D,
+    0x17, 0x52, 0xA3, 0x19, 0x4C, 0xAC, 0x62, 0x1D, 0xAC, 0x6F, 0x70, 0x38, 0x50, 0xDE, 0x44, 0x3D,
+    0xAA, 0x3B, 0x78, 0x41, 0x8D, 0x64, 0x56, 0x34, 0xD4, 0xC1, 0x0C, 0x2A, 0x51, 0xB6, 0x85, 0xD8,
+    0xC7, 0xA9, 0x32, 0xC7, 0xE3, 0xB9, 0x2A, 0x02, 0x17, 0xB1, 0x9E, 0x44, 0xB3, 0xA9, 0x91, 0x57,
+    0x91, 0x82, 0x8D, 0x54, 0x37, 0x62, 0x29, 0xCD, 0xD7, 0xC3, 0x36, 0x35, 0x30, 0x03, 0xAB, 0xBB,
+    0xFE, 0x39, 0x71, 0x98, 0x04, 0xFA, 0xA6, 0xD7, 0xF3, 0xC0, 0x7B, 0x89, 0x47, 0xBE, 0x70, 0xE2,
+    0x6E, 0x16, 0xAC, 0x8C, 0x55, 0x3E, 0xD0, 0xA9, 0x21, 0xDB, 0xB0, 0x67, 0x06, 0xA7, 0x93, 0x8D,
+    0xA5, 0x1E, 0xBB, 0x4D, 0x1A, 0x19, 0x4F, 0x02, 0x03, 0x1F, 0x8A, 0xCB, 0xEF, 0x83, 0x15, 0xBC,
+    0x81, 0x1A, 0x7F, 0x59, 0x97, 0x1F, 0x02, 0xE5, 0x77, 0xA0, 0xF3, 0x1C, 0x8F, 0x66, 0x38, 0xF8,
+    0x0D, 0xC4, 0x0F, 0x3D, 0xE0, 0xED, 0x8D, 0xB1, 0x7A, 0x2F, 0xEB, 0x32, 0xDF, 0xA5, 0x6B, 0x19,
+    0xAB, 0xF1, 0xC0, 0x0C, 0x8D, 0x4A, 0x36, 0x1C, 0xEE, 0x0E, 0x8D, 0x8C, 0x46, 0x12, 0xED, 0x15,
+    0xB8, 0x06, 0x65, 0x53, 0x96, 0x00, 0xF6, 0xCC, 0x0F, 0x46, 0xFB, 0x8C, 0x3F, 0x58, 0x99, 0x94,
+    0x9A, 0x97, 0xE2, 0xDC, 0x48, 0xEA, 0x24, 0xF6, 0x0B, 0x70, 0x1A, 0x13, 0xD9, 0x41, 0xDF, 0x2D,
+    0xF6, 0xAF, 0xC5, 0xE9, 0x1B, 0xBC, 0xD1, 0x0C, 0x1C, 0x8F, 0xF6, 0xC9, 0x11, 0x54, 0xB2, 0x5F,
+    0x0D, 0x3B, 0x8F, 0xEB, 0x94, 0xEC, 0xF5, 0xB8, 0xDF, 0x98, 0xDC, 0xC9, 0x9B, 0x22, 0x5A, 0x26,
+    0x38, 0x58, 0x53, 0x0E, 0x55, 0x99, 0x6F, 0x3F, 0x96, 0x86, 0xE9, 0x1C, 0xF9, 0x71, 0x9D, 0x56,
+    0x26, 0xAD, 0xAA, 0x71, 0xCF, 0x0E, 0x9D, 0xC4, 0x4E, 0x62, 0x2B, 0x01, 0xD5, 0x87, 0x0B, 0xCF,
+    0x51, 0x8B, 0x48, 0xC6, 0x7D, 0x57, 0x24, 0x31, 0xD3, 0xC1, 0x26, 0xE5, 0x30, 0x09, 0xF9, 0x53,
+    0xEA, 0x01, 0x29, 0xD8, 0xA8, 0xA4, 0x60, 0xA3, 0x29, 0xD0, 0x0C, 0xD5, 0x04, 0x8D, 0xC8, 0xF2,
+    0x0D, 0xAC, 0x88, 0x2C, 0xD4, 0x22, 0xB2, 0xA0, 0x7A, 0x91, 0xF9, 0xCE, 0xFD, 0x1F, 0xF9, 0x4A,
+    0xE4, 0x5D, 0xF6, 0xEB, 0xFC, 0x25, 0x33, 0x36, 0x32, 0x35, 0x2C, 0xAF, 0x9D, 0x3F, 0xDC, 0x4D,
+    0x4A, 0x89, 0xC8, 0x64, 0x44, 0x64, 0xD4, 0xB7, 0xEA, 0x99, 0x3B, 0xC9, 0xF9, 0x13, 0x17, 0x2E,
+    0x6C, 0x3C, 0x48, 0x27, 0x22, 0x37, 0x45, 0x44, 0xEE, 0xBF, 0x70, 0xE1, 0xC2, 0x73, 0x8F, 0x7A,
+    0x17, 0x9B, 0x58, 0x8F, 0x26, 0xEB, 0xA2, 0x5F, 0x35, 0xB9, 0x4A, 0x76, 0x68, 0x63, 0xC7, 0xA3,
+    0x9F, 0xBF, 0x6A, 0x7F, 0x36, 0xAB, 0xE2, 0x42, 0xFB, 0x52, 0x32, 0xF9, 0x88, 0xDE, 0x0E, 0xFA,
+    0xD5, 0x2F, 0xFA, 0xD9, 0xC5, 0xCE, 0x0E, 0xEE, 0x99, 0xD4, 0x5E, 0xCF, 0xCD, 0xF5, 0x89, 0x07,
+    0xFC, 0xD5, 0x87, 0xDA, 0x27, 0xD3, 0xDA, 0x99, 0x74, 0xD4, 0xD5, 0x69, 0xFE, 0x1F, 0x6D, 0x96,
+    0x31, 0xAC, 0x16, 0xC7, 0x15, 0x85, 0xBF, 0x9D, 0x01, 0x36, 0xF2, 0x48, 0x0C, 0x85, 0x1D, 0x29,
+    0x91, 0xCC, 0xA4, 0x4C, 0x2C, 0xCC, 0xA6, 0x48, 0x41, 0xA4, 0xF7, 0xDE, 0xAC, 0xA1, 0x48, 0x91,
+    0xC2, 0x14, 0x90, 0xC6, 0x52, 0xDC, 0x5A, 0x69, 0x90, 0x25, 0x0A, 0xA2, 0xFC, 0x8F, 0x7F, 0x1D,
+    0x8A, 0x14, 0x29, 0x4C, 0xE1, 0x24, 0x65, 0x88, 0x94, 0xC2, 0x7A, 0x28, 0x82, 0x82, 0x82, 0xE2,
+    0x87, 0x1D, 0x78, 0x05, 0x85, 0x0B, 0x16, 0x93, 0xB8, 0x71, 0xE1, 0xC1, 0x8E, 0x6D, 0xC9, 0x2E,
+    0x18, 0xC7, 0x63, 0x7B, 0x81, 0xD9, 0xBD, 0x29, 0xFE, 0x67, 0xCB, 0x56, 0x32, 0xD2, 0x74, 0x73,
+    0x74, 0xEE, 0xCC, 0x3D, 0xF7, 0x9C, 0x41, 0x3F, 0x48, 0xB8, 0xD7, 0x03, 0xD3, 0x12, 0xF5, 0xB7,
+    0x37, 0xD9, 0x5B, 0x07, 0x64, 0xC2, 0x4B, 0x62, 0xFE, 0x13, 0x26, 0x80, 0x07, 0xA6, 0x57, 0xA8,
+    0x25, 0xD1, 0x48, 0x47, 0x81, 0x3A, 0x42, 0xF3, 0xC9, 0x25, 0x44, 0x86, 0x5A, 0x84, 0x46, 0x0A,
+    0xD0, 0x40, 0x9D, 0x40, 0x5A, 0x9A, 0x4C, 0x7D, 0xB7, 0x63, 0x1C, 0x69, 0x6C, 0xA8, 0x63, 0xA1,
+    0xD8, 0xD0, 0x48, 0xA9, 0x45, 0x06, 0x91, 0xC9, 0x77, 0xF6, 0xE3, 0xC4, 0xCC, 0xE9, 0x53, 0x4A,
+    0x8A, 0xFE, 0xE2, 0xA4, 0x8E, 0xD4, 0x03, 0x46, 0x3A, 0x23, 0xD1, 0x5E, 0x48, 0xB6, 0x8A, 0x4E,
+    0x0F, 0x8D, 0x04, 0x2F, 0xF8, 0x7F, 0xC3, 0x69, 0x94, 0x24, 0x1D, 0x36, 0x74, 0xB7, 0x51, 0xB7,
+    0xD7, 0x8D, 0x44, 0x2B, 0xDD, 0xC1, 0x5F, 0xC5, 0x67, 0x49, 0x47, 0x54, 0xDA, 0xBA, 0x92, 0x96,
+    0x32, 0xF4, 0x73, 0xBB, 0x57, 0xB9, 0x91, 0x82, 0x48, 0x70, 0x2D, 0x2A, 0x81, 0x07, 0x9D, 0xE0,
+    0x3C, 0x98, 0x01, 0x0A, 0xB8, 0x80, 0x1A, 0xC1, 0xB7, 0xE8, 0x04, 0x58, 0x89, 0x95, 0x4C, 0x34,
+    0x2F, 0x05, 0x1D, 0x57, 0x2C, 0x6C, 0x67, 0x42, 0x66, 0x74, 0xAD, 0x3D, 0x9E, 0x54, 0xF2, 0xDC,
+    0xA8, 0xE3, 0xF2, 0x13, 0xF9, 0xA5, 0x48, 0xEA, 0x65, 0x36, 0xC1, 0x84, 0x57, 0x78, 0xF3, 0x5B,
+    0x2C, 0xAD, 0x3B, 0x85, 0x4A, 0xB0, 0x05, 0xF5, 0x87, 0x27, 0xE9, 0x67, 0xAC, 0x04, 0x46, 0x70,
+    0x2D, 0xFA, 0xF1, 0x0E, 0x5E, 0x52, 0x2D, 0x42, 0x2F, 0x09, 0x4C, 0x92, 0x7B, 0x85, 0x3A, 0xC9,
+    0x6E, 0x46, 0x67, 0x79, 0x7D, 0x40, 0x4D, 0xB2, 0xEC, 0x60, 0x96, 0x9B, 0x80, 0x48, 0x81, 0xF5,
+    0x49, 0xBC, 0x04, 0xA0, 0x97, 0x00, 0x5A, 0x24, 0x81, 0x13, 0x19, 0xA1, 0xBF, 0xFB, 0xF1, 0x4C,
+    0x2D, 0xF6, 0xBE, 0xB4, 0x4D, 0x71, 0xB7, 0x24, 0xD0, 0x5F, 0xAC, 0x25, 0xEC, 0xB3, 0x2D, 0x9B,
+    0xA8, 0xA4, 0xA5, 0x75, 0x19, 0x12, 0x7A, 0xE8, 0x96, 0x5A, 0x8A, 0x93, 0xD0, 0x8C, 0x00, 0x14,
+    0x4E, 0xE9, 0x68, 0xA3, 0x6B, 0xFB, 0x76, 0x55, 0x17, 0x9D, 0x96, 0xC9, 0x5E, 0x90, 0x6E, 0xE5,
+    0x27, 0xFD, 0xF9, 0x57, 0xC9, 0x5E, 0x39, 0x13, 0x96, 0x79, 0x56, 0xF2, 0x87, 0x6C, 0x8B, 0x0F,
+    0xCB, 0x20, 0x6A, 0x32, 0x19, 0x68, 0x0F, 0x61, 0x2F, 0x47, 0x1A, 0x81, 0x26, 0x02, 0xE8, 0x54,
+    0x9D, 0xB4, 0x9D, 0xEF, 0xB6, 0xD5, 0xA4, 0x92, 0x4B, 0xF6, 0x96, 0x84, 0x2D, 0x3B, 0xAB, 0x24,
+    0xD9, 0xDE, 0x7D, 0x2F, 0x6C, 0xDD, 0xE8, 0x2B, 0xB9, 0x3F, 0x9A, 0xD9, 0x0D, 0x3E, 0x49, 0x25,
+    0xBA, 0x98, 0xDC, 0x0C, 0xD0, 0x98, 0x44, 0x59, 0x52, 0xDF, 0x4F, 0x78, 0xDF, 0xF2, 0x24, 0x63,
+    0xA4, 0xC5, 0x8F, 0x54, 0xD2, 0x61, 0x66, 0xF0, 0x13, 0x95, 0x4C, 0xD8, 0x77, 0x0B, 0xDE, 0x16,
+    0x35, 0x36, 0x05, 0xF6, 0x9F, 0x3E, 0x89, 0x97, 0x80, 0x08, 0x75, 0x1C, 0x69, 0xCC, 0x40, 0xF1,
+    0xD4, 0xB1, 0xD0, 0xD4, 0x03, 0xA5, 0xA1, 0x1E, 0x0A, 0xBE, 0x8E, 0xAA, 0x34, 0x6D, 0x33, 0x14,
+    0x26, 0x1D, 0xD7, 0xDD, 0xEF, 0xF1, 0xF8, 0xD0, 0x04, 0x9B, 0x5C, 0xAC, 0x8B, 0xCD, 0x5A, 0x5E,
+    0x2C, 0xC8, 0xA7, 0xC2, 0x79, 0x79, 0x18, 0x1A, 0xFF, 0x55, 0xB4, 0x77, 0xBF, 0xCC, 0xFA, 0x83,
+    0x52, 0x54, 0x2E, 0x9E, 0x82, 0xEB, 0x3C, 0x66, 0x58, 0x63, 0x57, 0x6C, 0x53, 0x58, 0x55, 0x23,
+    0x45, 0xE5, 0xAA, 0xE8, 0xA4, 0x46, 0x9D, 0x74, 0x36, 0xB1, 0x4E, 0xF6, 0xF1, 0x95, 0x64, 0x45,
+    0xA2, 0x13, 0x19, 0x1A, 0x91, 0xE0, 0x3B, 0x1F, 0x96, 0xAD, 0xEF, 0x7A, 0x96, 0x2D, 0x55, 0x7F,
+    0x11, 0x2D, 0x33, 0x7A, 0x3A, 0x33, 0xE8, 0x5C, 0x15, 0x9D, 0xF1, 0x8C, 0xD8, 0x70, 0x03, 0x1D,
+    0x3D, 0x2A, 0xDB, 0x40, 0xA9, 0xC7, 0x03, 0x73, 0x25, 0x22, 0xAD, 0x17, 0xE9, 0x8C, 0x48, 0xC7,
+    0x99, 0x79, 0x4F, 0xB1, 0xCF, 0x9C, 0x6E, 0xAD, 0x4C, 0x88, 0x04, 0xC7, 0x4A, 0x25, 0xDB, 0x6D,
+    0x91, 0xEB, 0xA1, 0x61, 0xA5, 0x93, 0x0D, 0x5B, 0x8C, 0xF5, 0xE0, 0xDA, 0x95, 0x4A, 0x36, 0x78,
+    0x46, 0x75, 0xE9, 0x87, 0x2D, 0x40, 0x2D, 0x81, 0x5E, 0xB0, 0xDD, 0x58, 0x65, 0xD3, 0x35, 0x6A,
+    0xD4, 0x22, 0x2C, 0x65, 0x30, 0x92, 0x99, 0xDF, 0xF8, 0x96, 0xCA, 0xEB, 0x0C, 0xFD, 0xD7, 0x53,
+    0x5D, 0xF5, 0x91, 0xA5, 0x74, 0x46, 0x0A, 0xFD, 0xC5, 0x43, 0x75, 0x06, 0xDF, 0xA2, 0x0A, 0xD8,
+    0x08, 0xBE, 0xA3, 0x12, 0x7E, 0xA4, 0x45, 0x82, 0x95, 0x19, 0x27, 0x99, 0x46, 0x06, 0xBC, 0xC8,
+    0x1D, 0x91, 0xD2, 0x8B, 0x74, 0x3A, 0xC2, 0x0D, 0xB0, 0x61, 0x3D, 0x49, 0x1D, 0x3A, 0x83, 0x5F,
+    0xCF, 0xFC, 0x4D, 0xB0, 0x03, 0x55, 0x59, 0x13, 0x35, 0x2C, 0xAA, 0xD1, 0x76, 0xF6, 0x56, 0xA2,
+    0x6C, 0x62, 0xDE, 0x0D, 0x2C, 0x33, 0x7A, 0x06, 0xBF, 0x57, 0x18, 0xD8, 0x01, 0x5F, 0xD0, 0x02,
+    0xE7, 0xDB, 0xBD, 0xE2, 0xE4, 0x85, 0xC7, 0x8F, 0xAE, 0xA5, 0x72, 0xF0, 0xAC, 0xB7, 0x2F, 0xF7,
+    0xB2, 0x2B, 0x32, 0x2C, 0x65, 0xA8, 0x0A, 0xDC, 0x04, 0xDF, 0x62, 0x03, 0x75, 0x02, 0xB6, 0x70,
+    0xAD, 0x0D, 0xAE, 0x53, 0xA3, 0xED, 0xF0, 0x36, 0x60, 0xDF, 0x0B, 0x28, 0x09, 0xB0, 0x1C, 0xD6,
+    0x57, 0xB1, 0x05, 0xAC, 0x74, 0xD8, 0x87, 0x09, 0xFB, 0xFE, 0x84, 0x4B, 0x3E, 0xB8, 0x64, 0x33,
+    0x1C, 0xAA, 0x5A, 0xDB, 0x2D, 0xC8, 0xA6, 0x73, 0x64, 0x95, 0x2C, 0x5B, 0x2A, 0xE9, 0x61, 0x8B,
+    0x85, 0x1E, 0x6C, 0x58, 0x30, 0xDA, 0xE0, 0xDA, 0x51, 0x89, 0x44, 0x2F, 0x45, 0x8B, 0x04, 0xAA,
+    0xF5, 0x15, 0x81, 0xAA, 0x7D, 0xFA, 0x70, 0x15, 0xAF, 0x99, 0x13, 0x61, 0xE3, 0xD9, 0x2A, 0x5D,
+    0xB5, 0x17, 0x6E, 0x4D, 0x56, 0x92, 0x93, 0xF0, 0x83, 0x97, 0xE1, 0x3A, 0x7A, 0xC0, 0xC2, 0xD3,
+    0xEC, 0xA3, 0x6C, 0x6E, 0x31, 0x2E, 0x36, 0xAB, 0xB4, 0x5A, 0xA8, 0x34, 0xAE, 0x74, 0xCC, 0x63,
+    0x7D, 0x2F, 0x65, 0x73, 0x3B, 0x25, 0xBB, 0xFB, 0x20, 0xD9, 0x0B, 0x6F, 0x47, 0x57, 0xEF, 0xAE,
+    0x75, 0x24, 0x12, 0x9E, 0xDB, 0xD9, 0x69, 0x29, 0x3F, 0x69, 0x18, 0xB7, 0xB7, 0xAA, 0xBC, 0xDA,
+    0x54, 0x69, 0x5C, 0xE8, 0x98, 0xAF, 0xEB, 0x7B, 0x29, 0xD7, 0xB7, 0x53, 0x32, 0xBB, 0x0F, 0x92,
+    0x3D, 0xF1, 0x76, 0xB4, 0x6B, 0x4C, 0xF6, 0xEB, 0x9D, 0x40, 0x0F, 0x60, 0x02, 0x3C, 0xD5, 0xFA,
+    0xC2, 0xB2, 0xC0, 0x39, 0xC8, 0x90, 0xA8, 0x24, 0x2A, 0x29, 0x7A, 0x58, 0xE8, 0xB0, 0xAA, 0xDF,
+    0x19, 0x8D, 0x24, 0x2B, 0xDD, 0x9E, 0x04, 0x32, 0x60, 0x82, 0x01, 0xCF, 0x06, 0x8C, 0x55, 0xA4,
+    0x1E, 0x4C, 0x4B, 0xC3, 0x06, 0x94, 0x4A, 0xA2, 0x8E, 0x46, 0x92, 0x6B, 0x37, 0xEB, 0x50, 0x48,
+    0x8D, 0x4E, 0xF5, 0x3B, 0xA3, 0x0B, 0x8D, 0x84, 0x19, 0x19, 0x75, 0xDE, 0x13, 0xD2, 0x25, 0x74,
+    0xE0, 0x30, 0x5C, 0x43, 0x07, 0xDC, 0x4C, 0x2F, 0x7A, 0x58, 0x58, 0x95, 0xB6, 0xCF, 0xFC, 0x5E,
+    0xCA, 0x1E, 0xD7, 0x81, 0x47, 0x54, 0x32, 0xE3, 0x5E, 0x9B, 0xC8, 0xD5, 0xB8, 0x1F, 0x1D, 0x2B,
+    0x91, 0xCE, 0xC8, 0x04, 0x2A, 0x81, 0x0D, 0x52, 0x4D, 0xB5, 0x48, 0xB2, 0x22, 0xAD, 0x97, 0x4C,
+    0xF3, 0xF8, 0x1B, 0x99, 0x52, 0x0D, 0xCB, 0xA8, 0xDF, 0x96, 0x51, 0xBF, 0x15, 0x17, 0xF5, 0xEB,
+    0xDD, 0x86, 0x11, 0x36, 0xEC, 0xC4, 0x39, 0x5B, 0x18, 0xDD, 0x4A, 0xA5, 0x23, 0xE7, 0x5F, 0x4A,
+    0x1B, 0x4B, 0x09, 0xC7, 0xBC, 0xB4, 0x67, 0xCD, 0xB8, 0x87, 0xEB, 0x13, 0x8D, 0x84, 0x2A, 0x1D,
+    0xC5, 0xB6, 0x23, 0x0B, 0x3D, 0x54, 0xD9, 0x51, 0x4B, 0xC1, 0x4A, 0xA2, 0x97, 0xAE, 0x1E, 0x26,
+    0xBC, 0x4E, 0xAA, 0x34, 0xC1, 0x45, 0x41, 0x4E, 0x8C, 0xDF, 0x30, 0xCE, 0xB1, 0x91, 0xD7, 0xD2,
+    0xB6, 0x25, 0x5F, 0xD3, 0xBB, 0x61, 0x69, 0xA5, 0x34, 0x12, 0x9B, 0xF7, 0xF6, 0x42, 0xE5, 0x7B,
+    0x54, 0x67, 0x5A, 0x25, 0x11, 0x29, 0xF8, 0x16, 0xF3, 0x2F, 0x10, 0xC1, 0xC9, 0xA8, 0x26, 0x17,
+    0x9A, 0xB6, 0xE8, 0xE4, 0x3A, 0xFF, 0x8B, 0xAC, 0x64, 0xC6, 0x4A, 0x47, 0x73, 0x11, 0x25, 0x9D,
+    0xBD, 0xDC, 0x9D, 0x3B, 0xAC, 0x9E, 0x24, 0x2B, 0xDD, 0x39, 0x7B, 0xFC, 0xA3, 0x95, 0x95, 0xB8,
+    0x9C, 0x51, 0x32, 0x69, 0x29, 0x7B, 0x81, 0x17, 0xB0, 0x01, 0x1B, 0x68, 0x3A, 0x7C, 0xBB, 0x27,
+    0x33, 0xDC, 0x8C, 0x9F, 0x58, 0xAC, 0x18, 0x0B, 0x79, 0xD4, 0x9F, 0x65, 0x7B, 0x3B, 0xF5, 0x32,
+    0xF5, 0x52, 0x6E, 0xEE, 0xE4, 0xEB, 0x2A, 0x01, 0x34, 0x43, 0x35, 0xE7, 0xFA, 0xC1, 0x39, 0x2B,
+    0xA3, 0xDB, 0x79, 0xA3, 0xE1, 0x50, 0x23, 0xC9, 0x4A, 0x54, 0xD2, 0xAA, 0xBC, 0xA5, 0xEF, 0x8D,
+    0x14, 0x6F, 0xEE, 0x24, 0x7A, 0x6F, 0xFF, 0x1A, 0xF0, 0xCB, 0x66, 0x09, 0x56, 0x7C, 0x81, 0x5A,
+    0xFA, 0x04, 0x4A, 0xF6, 0xB2, 0x25, 0x80, 0x13, 0x49, 0xD0, 0x3F, 0x7C, 0x52, 0xA8, 0xC5, 0x7D,
+    0x20, 0x34, 0xA5, 0xB9, 0x25, 0xA1, 0x9A, 0xF8, 0x73, 0xE0, 0x6A, 0x75, 0x4D, 0x17, 0x0C, 0x7F,
+    0x09, 0x7D, 0x6C, 0x22, 0x2A, 0xBA, 0x36, 0xBB, 0xB0, 0xE1, 0x92, 0x73, 0xA3, 0x79, 0xFD, 0x86,
+    0x7E, 0x78, 0xF7, 0x05, 0xB9, 0x13, 0xFA, 0xDD, 0xE4, 0xC3, 0x68, 0xC3, 0x36, 0x00, 0x87, 0xF6,
+    0xF1, 0xF8, 0x26, 0x7D, 0x59, 0xA7, 0x86, 0xEE, 0x2E, 0xD5, 0x27, 0xA2, 0x31, 0x83, 0x6D, 0xC2,
+    0xE1, 0xDF, 0x85, 0xA3, 0x9F, 0x76, 0xFE, 0x6E, 0xEB, 0x1D, 0xDB, 0x1E, 0x16, 0x2B, 0xBE, 0x4C,
+    0xD5, 0x93, 0xA0, 0x04, 0x5D, 0x30, 0x19, 0x3B, 0xD1, 0x2C, 0xBB, 0xCD, 0x26, 0xB2, 0x73, 0xD1,
+    0x15, 0x75, 0x3F, 0x6C, 0x9C, 0xD3, 0x6F, 0xB5, 0xD7, 0x92, 0xB5, 0xD5, 0xFB, 0x71, 0x7B, 0x73,
+    0x7F, 0xD5, 0x02, 0xAC, 0x74, 0xF4, 0xC7, 0xB3, 0xBB, 0x57, 0xCC, 0x28, 0x7A, 0xEE, 0xC3, 0x93,
+    0x39, 0xFE, 0x76, 0xCA, 0x5B, 0xCB, 0x85, 0x7D, 0xD9, 0xD7, 0xB7, 0x5F, 0xEC, 0x00, 0x6C, 0xBB,
+    0xA8, 0x92, 0xE9, 0x1A, 0xB2, 0x8E, 0x8E, 0x6D, 0x95, 0xCC, 0x27, 0x37, 0x11, 0x19, 0x9C, 0x14,
+    0x95, 0x6D, 0xF0, 0xD5, 0x08, 0xCD, 0x50, 0xC9, 0x58, 0xC7, 0x95, 0x6D, 0x17, 0x8E, 0xB1, 0x79,
+    0x29, 0x3B, 0x89, 0x56, 0x82, 0x7A, 0x84, 0x12, 0x69, 0x45, 0xC2, 0xA6, 0x4A, 0x8E, 0xD1, 0x84,
+    0x4D, 0x1D, 0x9B, 0x2A, 0xDB, 0xB0, 0xD2, 0xD1, 0x57, 0xD9, 0x76, 0xAB, 0xAF, 0x65, 0xC3, 0x96,
+    0x50, 0xC9, 0x15, 0x4C, 0x3A, 0x82, 0x6F, 0xAF, 0x52, 0x74, 0xA8, 0xD3, 0x61, 0x9A, 0x27, 0x19,
+    0x91, 0xCE, 0xC8, 0x88, 0x7F, 0x06, 0x95, 0xD7, 0x96, 0x79, 0x1E, 0xD4, 0xA5, 0x35, 0x4C, 0x4D,
+    0x95, 0x0C, 0xE7, 0xB1, 0x5D, 0x95, 0x68, 0x50, 0x8F, 0x2E, 0x3A, 0xE1, 0x4C, 0x6C, 0xA4, 0x78,
+    0x19, 0x0F, 0xAD, 0x60, 0x84, 0x8C, 0x4A, 0xE8, 0xC4, 0x5A, 0x29, 0x76, 0x1D, 0x51, 0xA3, 0x4A,
+    0x3A, 0x39, 0x4C, 0x18, 0x71, 0x7F, 0x0C, 0xF8, 0x4D, 0x90, 0x84, 0x12, 0xA8, 0xC7, 0x35, 0xC9,
+    0x36, 0xD4, 0x09, 0x23, 0xE0, 0x33, 0xAC, 0x13, 0x66, 0xE0, 0x80, 0xCC, 0xF4, 0x37, 0xFB, 0xFA,
+    0x5E, 0xDA, 0xD8, 0x34, 0xAF, 0xA5, 0xB4, 0x69, 0x77, 0x3F, 0xFA, 0x62, 0x32, 0x22, 0x83, 0x91,
+    0x11, 0x12, 0xD4, 0x01, 0x8E, 0x02, 0xA7, 0xA0, 0xCA, 0x26, 0xD8, 0xDB, 0x89, 0xC5, 0x0D, 0xB4,
+    0xB4, 0x34, 0x03, 0xBA, 0x80, 0x0C, 0xF8, 0x1E, 0x7B, 0x3F, 0xEB, 0xEC, 0x02, 0x80, 0x09, 0x2B,
+    0xDB, 0x8D, 0xB6, 0xCD, 0x8E, 0xD4, 0x54, 0x69, 0x53, 0xC5, 0x0D, 0x3D, 0x2C, 0x25, 0xF7, 0x92,
+    0x7E, 0x73, 0x39, 0x52, 0x07, 0x4C, 0xB7, 0x6F, 0xDF, 0x91, 0x23, 0x3F, 0x3B, 0xF6, 0xD3, 0xB3,
+    0xAF, 0xA6, 0x65, 0x7A, 0xEE, 0x12, 0x43, 0x15, 0x54, 0xFA, 0xFB, 0x4A, 0xA7, 0x3C, 0xAE, 0xCD,
+    0xED, 0xB3, 0x64, 0x77, 0xDF, 0xFF, 0xBF, 0x86, 0xF8, 0xBF, 0xE7, 0xBE, 0x63, 0x9C, 0xD9, 0x8B,
+    0xA4, 0xE7, 0x76, 0x2E, 0xC7, 0xB5, 0x01, 0xDA, 0x00, 0xFB, 0xF9, 0x7E, 0x70, 0x89, 0x23, 0x1C,
+    0x44, 0xFF, 0xB3, 0x92, 0x70, 0xF5, 0xDA, 0xC6, 0xA6, 0x95, 0x7A, 0xFD, 0x04, 0x55, 0x07, 0x9B,
+    0x35, 0x3A, 0x5C, 0x65, 0x71, 0x10, 0xD3, 0x7E, 0x48, 0x72, 0xC5, 0xAA, 0xDB, 0xB7, 0xD2, 0xB1,
+    0x8D, 0xAD, 0x5A, 0x2E, 0x0C, 0x7D, 0x5C, 0xAC, 0x5B, 0xA3, 0xA9, 0x31, 0xD8, 0x8B, 0xAE, 0x1C,
+    0x79, 0x76, 0xE3, 0x79, 0x5F, 0x96, 0xEB, 0x8F, 0xC5, 0x32, 0x3F, 0xA5, 0x03, 0x87, 0x39, 0x10,
+    0x9B, 0x19, 0x7D, 0xBB, 0x1A, 0xFD, 0x5C, 0xC9, 0x9E, 0x3B, 0xA8, 0x5B, 0x33, 0xFF, 0x91, 0xE1,
+    0xE7, 0xE9, 0x98, 0xCB, 0x07, 0xCD, 0x58, 0x9F, 0xF8, 0x87, 0x0E, 0x6F, 0x7D, 0x1A, 0x5F, 0x95,
+    0xF4, 0x63, 0xB7, 0x46, 0x9F, 0xA6, 0x4F, 0xCF, 0x9B, 0xE3, 0xE1, 0xEC, 0xD1, 0xBA, 0x93, 0x62,
+    0xE4, 0x56, 0x2A, 0xDE, 0xEE, 0xA6, 0x69, 0x69, 0x07, 0xEC, 0x8B, 0x6D, 0x7D, 0x27, 0xE8, 0xCF,
+    0x13, 0xDF, 0x59, 0x7D, 0x5B, 0xCD, 0xB9, 0x1A, 0x7F, 0x8D, 0x48, 0x77, 0x7E, 0xE7, 0x64, 0xC3,
+    0x21, 0x23, 0x05, 0x99, 0x31, 0x13, 0xFF, 0x05, 0xAD, 0x9A, 0x4F, 0xAC, 0x25, 0xD5, 0x9D, 0xDF,
+    0x3F, 0xA7, 0x0E, 0xDD, 0x67, 0xDC, 0x85, 0x7D, 0x50, 0x04, 0x13, 0x07, 0xC6, 0x5D, 0xB3, 0x70,
+    0x24, 0xC6, 0xA1, 0xBB, 0xB2, 0x60, 0xD1, 0xC9, 0xDC, 0xF7, 0xCE, 0xC1, 0x48, 0xB1, 0x14, 0x22,
+    0xB9, 0x17, 0xCD, 0x2C, 0x62, 0x29, 0xAB, 0x59, 0x78, 0xAC, 0x91, 0x9A, 0x05, 0x4A, 0x88, 0xF2,
+    0xFA, 0x55, 0xC1, 0x28, 0x1A, 0x29, 0x48, 0x71, 0x47, 0xB2, 0x17, 0xA3, 0x24, 0xCA, 0x4B, 0x82,
+    0x25, 0x03, 0x51, 0x60, 0x81, 0x94, 0x27, 0xE5, 0x76, 0xD7, 0x81, 0x5E, 0xB0, 0x40, 0x11, 0x65,
+    0x18, 0x8D, 0x17, 0x4E, 0x86, 0x03, 0xD8, 0x43, 0x8C, 0x47, 0xD3, 0x07, 0x5C, 0x40, 0xB5, 0xFB,
+    0x54, 0xFD, 0xB2, 0xA8, 0xFB, 0xFE, 0x80, 0x21, 0x1E, 0x0F, 0x94, 0x74, 0x75, 0x75, 0x6F, 0xDD,
+    0x7B, 0x7E, 0xBF, 0xF3, 0x3B, 0xBF, 0x3F, 0xDF, 0xEF, 0xEF, 0x57, 0x3C, 0x45, 0x13, 0xAA, 0xBE,
+    0x4C, 0xC5, 0xC8, 0xE1, 0xF5, 0x10, 0x6B, 0xB6, 0xA9, 0xBC, 0x09, 0x45, 0x62, 0x64, 0x0B, 0x8B,
+    0x09, 0x2A, 0x72, 0x19, 0x00, 0xED, 0x79, 0x08, 0x43, 0x31, 0x15, 0xD2, 0x37, 0x7F, 0x6A, 0xFF,
+    0x83, 0x7A, 0x37, 0xD4, 0xE7, 0x8A, 0x0F, 0xDA, 0x4A, 0x68, 0x22, 0x7B, 0x7C, 0x01, 0xFC, 0xB2,
+    0x4E, 0xE7, 0x0B, 0x19, 0xD4, 0xF0, 0x77, 0x78, 0x18, 0xBE, 0x04, 0xA6, 0xA5, 0x92, 0x58, 0xCA,
+    0x48, 0x05, 0x65, 0xA0, 0xEE, 0x71, 0xB2, 0x67, 0x65, 0x2A, 0x9E, 0x7A, 0xCA, 0x03, 0xB4, 0xE7,
+    0xB4, 0x64, 0x2D, 0x83, 0x7E, 0x23, 0x95, 0xD7, 0x92, 0x95, 0xDE, 0x49, 0x72, 0x12, 0x6F, 0x57,
+    0x5E, 0xA7, 0x22, 0x95, 0xD1, 0x61, 0x5F, 0x4D, 0xD4, 0x02, 0x4D, 0x02, 0x81, 0x42, 0x3C, 0x32,
+    0x63, 0x05, 0xD4, 0x08, 0xE5, 0x84, 0x96, 0x11, 0x97, 0xC1, 0x44, 0xA8, 0x37, 0x6A, 0x3C, 0xA4,
+    0xC3, 0xE7, 0x79, 0x56, 0x87, 0x5B, 0x00, 0x4E, 0xF1, 0x70, 0x11, 0x2C, 0xF7, 0x16, 0xE1, 0x04,
+    0xC0, 0x55, 0x70, 0x99, 0xF2, 0xAB, 0x9E, 0x1B, 0x50, 0x4D, 0xD8, 0xEB, 0x49, 0xC5, 0x92, 0xB3,
+    0x0F, 0xA6, 0x42, 0x26, 0x8C, 0x40, 0x91, 0x78, 0xE2, 0x2C, 0xB5, 0x04, 0xD5, 0x5D, 0xE6, 0xCE,
+    0x53, 0x5F, 0x7F, 0xF1, 0xAD, 0x77, 0xDF, 0xCF, 0x93, 0x9A, 0xF8, 0x97, 0xCF, 0xDA, 0xFF, 0xFA,
+    0x58, 0xBA, 0xB7, 0x7E, 0x49, 0xFD, 0xAC, 0x37, 0x11, 0xB8, 0x7A, 0xF7, 0xAB, 0x9F, 0xFF, 0x57,
+    0xD7, 0xFE, 0xB2, 0xFE, 0xE9, 0xFD, 0x32, 0xFD, 0xE6, 0x33, 0x81, 0x35, 0xB6, 0xE5, 0x89, 0x5A,
+    0xDE, 0x94, 0xA9, 0x18, 0xF5, 0xCD, 0x17, 0x7E, 0xF2, 0xD0, 0xF5, 0xDF, 0xDA, 0xFA, 0x73, 0xDB,
+    0x71, 0x15, 0xA8, 0xA6, 0xAF, 0x7C, 0x0F, 0xB8, 0xAB, 0x37, 0xC2, 0xB0, 0x5F, 0xDB, 0xAF, 0xDE,
+    0x4C, 0xD5, 0xC4, 0x2E, 0xB0, 0x07, 0xFB, 0xB0, 0x45, 0x29, 0xB9, 0x78, 0xE6, 0xA7, 0xE8, 0x1E,
+    0x95, 0x36, 0x07, 0x73, 0x52, 0x92, 0x91, 0x0C, 0x50, 0x3D, 0xFA, 0x4F, 0x54, 0x78, 0x78, 0xAB,
+    0x1C, 0xC0, 0xB6, 0xB7, 0xAA, 0xE7, 0x07, 0xFD, 0x78, 0xFA, 0x7D, 0x94, 0xBE, 0xF6, 0x4A, 0x64,
+    0x47, 0xC7, 0xB2, 0xDD, 0x62, 0x28, 0x83, 0x25, 0x17, 0xA9, 0x6A, 0x9D, 0x1E, 0x8C, 0x08, 0x9D,
+    0x24, 0xDB, 0xCD, 0x45, 0x0F, 0xAB, 0xCD, 0x7A, 0xF5, 0xCB, 0xDE, 0xBD, 0x19, 0xEA, 0xF7, 0x92,
+    0xCD, 0xFB, 0x7A, 0xDE, 0xA2, 0xF9, 0x3A, 0xF6, 0xC5, 0x60, 0xDE, 0x88, 0x7A, 0x18, 0x54, 0x5E,
+    0x31, 0x57, 0x34, 0x0F, 0xB4, 0xEE, 0x5A, 0x6F, 0x63, 0x52, 0xE7, 0x6F, 0xC7, 0x3E, 0xFE, 0xEA,
+    0x7B, 0xDF, 0x57, 0x3C, 0x6B, 0xEF, 0xDB, 0x71, 0x8F, 0x5D, 0x3E, 0xA9, 0xC3, 0xDE, 0xBD, 0xB7,
+    0xD6, 0xCF, 0x9F, 0x87, 0xBA, 0xF8, 0x37, 0xB7, 0x9E, 0x73, 0xE1, 0x0A, 0xDC, 0x06, 0xD4, 0x40,
+    0x91, 0x30, 0xE1, 0x0B, 0x90, 0x54, 0xCF, 0x8A, 0x15, 0xD6, 0xEB, 0x50, 0x44, 0x2D, 0x7E, 0x7D,
+    0xAF, 0x4B, 0x95, 0x05, 0x73, 0x2D, 0xC1, 0xF0, 0x1A, 0x6C, 0x9F, 0x8B, 0xD8, 0x97, 0xC5, 0x17,
+    0xA9, 0x4B, 0xAC, 0x59, 0x51, 0x79, 0xD3, 0xAA, 0xF3, 0xB0, 0x2C, 0x56, 0x06, 0x14, 0x35, 0xEC,
+    0x70, 0x0E, 0x1D, 0x54, 0xCF, 0x0A, 0x8B, 0xEE, 0x59, 0xB1, 0x8D, 0x9D, 0x8A, 0x78, 0xDE, 0xA5,
+    0xBA, 0x1E, 0x50, 0xE9, 0xDF, 0x45, 0x2A, 0x6F, 0x3C, 0x03, 0x3B, 0xD8, 0xB6, 0x0C, 0x64, 0x95,
+    0x29, 0x83, 0x9D, 0x58, 0xD3, 0x2D, 0x16, 0x2C, 0x26, 0xE0, 0xEF, 0x3E, 0xCB, 0x0E, 0x96, 0x8A,
+    0x3A, 0xE8, 0xA0, 0x33, 0x89, 0xFB, 0xC3, 0x16, 0xF5, 0x68, 0xEF, 0xBF, 0x5F, 0x74, 0x4C, 0xB0,
+    0xEF, 0xA0, 0xBE, 0x35, 0x52, 0x5E, 0xFB, 0xEF, 0xA8, 0x24, 0x03, 0x97, 0x4E, 0xEC, 0x52, 0x79,
+    0x13, 0x16, 0xA5, 0x98, 0x21, 0x43, 0x86, 0x27, 0x0E, 0x02, 0xE6, 0x32, 0xB6, 0xA7, 0x0A, 0xD4,
+    0x2D, 0xE2, 0xCD, 0x84, 0xED, 0xA9, 0x61, 0x0B, 0x56, 0xB0, 0x83, 0xDF, 0x32, 0x7D, 0x2D, 0xC1,
+    0xDC, 0x58, 0x7E, 0x5C, 0xDD, 0x03, 0x53, 0xA4, 0x74, 0x9E, 0x2F, 0xDE, 0xBD, 0x7C, 0xB5, 0x06,
+    0x93, 0xC0, 0xF5, 0x14, 0xE2, 0xA9, 0xB6, 0x61, 0x1C, 0x29, 0xAF, 0x25, 0x76, 0x6D, 0xD0, 0xC9,
+    0x51, 0x4B, 0x56, 0x22, 0x83, 0x15, 0xE9, 0x67, 0xDC, 0x1F, 0x27, 0x66, 0x40, 0xF7, 0xE0, 0x02,
+    0xCC, 0x50, 0xC4, 0xC3, 0xD8, 0x2D, 0x12, 0x54, 0x01, 0xC4, 0x53, 0x4E, 0xB0, 0x33, 0xA2, 0xDF,
+    0x8C, 0xD4, 0x36, 0xA8, 0xD1, 0x61, 0x43, 0xA6, 0x93, 0x64, 0x44, 0x7A, 0x27, 0x72, 0xFF, 0xC8,
+    0x5C, 0x05, 0x3D, 0x82, 0x7A, 0x5A, 0x12, 0x54, 0x22, 0x2D, 0xC8, 0xDB, 0x17, 0xC0, 0x0A, 0xC0,
+    0x3C, 0x02, 0xE5, 0x4B, 0x3F, 0xD9, 0x83, 0x4B, 0x4E, 0x5A, 0x4C, 0x94, 0x09, 0x9C, 0x49, 0xA0,
+    0x45, 0x02, 0x38, 0x91, 0xA7, 0xDA, 0x42, 0x44, 0x84, 0x3A, 0xD4, 0x92, 0x55, 0x46, 0xE4, 0xC0,
+    0x59, 0x71, 0xD2, 0x52, 0xC9, 0x44, 0x29, 0x12, 0x74, 0xD2, 0x83, 0xCA, 0x6C, 0x73, 0x05, 0xFB,
+    0x80, 0x64, 0xF3, 0xAA, 0xCC, 0x45, 0x32, 0x51, 0x8D, 0xC5, 0x60, 0x26, 0x44, 0x04, 0x27, 0x42,
+    0x25, 0xE2, 0x4B, 0xB9, 0x01, 0x70, 0xFA, 0x1E, 0xB0, 0x7F, 0x0E, 0xA5, 0xF3, 0xA8, 0xC7, 0x36,
+    0x91, 0x7C, 0xF1, 0xC7, 0x20, 0xD2, 0x22, 0xDF, 0x18, 0x98, 0x68, 0x98, 0xB0, 0x61, 0x1B, 0x9D,
+    0x6A, 0xCF, 0x68, 0x03, 0x57, 0x74, 0xC2, 0xA9, 0x59, 0x75, 0x6D, 0x23, 0xD2, 0x5B, 0x91, 0x58,
+    0x88, 0x44, 0xEE, 0x92, 0x76, 0x49, 0x5C, 0x6F, 0x24, 0x23, 0xD8, 0x44, 0xD7, 0xDB, 0xEB, 0xE1,
+    0xC2, 0x1D, 0x9B, 0x45, 0xB9, 0x73, 0xB9, 0x4D, 0xB9, 0xD1, 0xBC, 0xC8, 0x9B, 0x1B, 0xDD, 0x41,
+    0x98, 0x84, 0x4F, 0xF8, 0x41, 0x03, 0x80, 0xEA, 0x9E, 0xE9, 0x01, 0x10, 0x19, 0x96, 0x8D, 0xFF,
+    0x70, 0x06, 0xC0, 0xF6, 0x5D, 0x04, 0xD0, 0x43, 0x2D, 0x00, 0x6C, 0x97, 0x1F, 0x24, 0x80, 0xF2,
+    0x95, 0x69, 0x1B, 0x80, 0xDC, 0x95, 0x3D, 0x80, 0x95, 0x90, 0x01, 0x94, 0xBC, 0xD7, 0xB5, 0x00,
+    0xD5, 0xC1, 0x5A, 0x22, 0xF3, 0xC6, 0x98, 0xCB, 0x2E, 0xEC, 0xE6, 0x5D, 0xCF, 0x1B, 0x1D, 0x36,
+    0x9B, 0xA3, 0xDE, 0xF8, 0x40, 0xB9, 0x49, 0xE4, 0xC5, 0xC1, 0x0F, 0xAE, 0x6E, 0xF6, 0xF9, 0x3B,
+    0xFC, 0xD2, 0x75, 0x3B, 0xDC, 0x03, 0x67, 0xA1, 0xE2, 0x63, 0x2E, 0x1B, 0xF4, 0xBB, 0x43, 0x31,
+    0xEC, 0xAA, 0xB1, 0x0A, 0x59, 0xA7, 0xCC, 0x34, 0x51, 0xCF, 0x18, 0x41, 0x09, 0x38, 0x4F, 0x15,
+    0x28, 0x13, 0x7A, 0x44, 0x4D, 0xC0, 0x79, 0x74, 0xC0, 0x7A, 0x9A, 0xBE, 0x90, 0x68, 0xBF, 0x16,
+    0x56, 0x56, 0xC5, 0x5C, 0x5E, 0x0F, 0x2E, 0xAB, 0x99, 0xB2, 0x65, 0x05, 0x7B, 0x80, 0x19, 0xB1,
+    0xD2, 0x96, 0x21, 0xE9, 0x1F, 0xAC, 0xD5, 0x3B, 0x13, 0xFB, 0x89, 0xED, 0x15, 0xD5, 0xD7, 0xDB,
+    0xF2, 0x85, 0x51, 0xA7, 0x5A, 0x65, 0x13, 0x3A, 0x49, 0x4E, 0xD2, 0x89, 0x6F, 0x5C, 0x86, 0x93,
+    0x9F, 0xA3, 0xFA, 0x5F, 0x9C, 0xC9, 0xAC, 0xF6, 0x0F, 0x6C, 0xBE, 0x5F, 0xC8, 0x68, 0x9E, 0x1F,
+    0x2C, 0xC3, 0x19, 0xD2, 0xCA, 0x24, 0x27, 0xA9, 0x96, 0x58, 0x7E, 0xD0, 0x83, 0xA7, 0xEC, 0xF9,
+    0x17, 0x5E, 0x65, 0x8A, 0x7E, 0x13, 0x6C, 0x7F, 0x55, 0xC8, 0x58, 0x99, 0x3E, 0xD9, 0x07, 0xFC,
+    0x6A, 0x65, 0x92, 0xC8, 0x0B, 0x32, 0x17, 0xD3, 0x62, 0x5B, 0x73, 0xF3, 0x47, 0xB1, 0x10, 0x91,
+    0xB0, 0x53, 0x0D, 0x7F, 0x68, 0x11, 0x79, 0xA5, 0xB7, 0x6F, 0x3F, 0xB1, 0x32, 0x03, 0x5A, 0x44,
+    0x86, 0x5A, 0x44, 0xE8, 0x76, 0x65, 0x29, 0x7B, 0x6C, 0x6D, 0x3C, 0xC2, 0x7A, 0x8C, 0x64, 0x4A,
+    0xC9, 0x70, 0x16, 0x25, 0x2B, 0x4A, 0xC9, 0x54, 0x7F, 0x34, 0xE0, 0x8A, 0xC4, 0x96, 0x8E, 0xEC,
+    0x96, 0x81, 0x46, 0x3C, 0x6E, 0x86, 0x72, 0x00, 0xCA, 0x7F, 0x4B, 0xF5, 0x7F, 0x58, 0x65, 0xEE,
+    0xFE, 0x7D, 0x80, 0xBA, 0x57, 0x32, 0x9A, 0xB8, 0xB6, 0x7E, 0xA7, 0x62, 0xAC, 0xBF, 0x31, 0x54,
+    0x12, 0xAD, 0x84, 0xE2, 0x06, 0x9C, 0xF2, 0x98, 0x1E, 0x3D, 0xA0, 0x32, 0x80, 0x11, 0xB9, 0x26,
+    0x92, 0xFC, 0x52, 0x16, 0xD6, 0xE0, 0x8E, 0xBC, 0x11, 0x28, 0xC2, 0x46, 0xAF, 0x22, 0x02, 0x16,
+    0x60, 0x1F, 0xD0, 0x01, 0xD8, 0x86, 0xA5, 0x70, 0x58, 0x0F, 0x65, 0x86, 0x42, 0x46, 0xA8, 0x9A,
+    0x04, 0x37, 0x6E, 0x06, 0xCC, 0xCB, 0x0D, 0xD4, 0xF3, 0x00, 0x9D, 0x04, 0x90, 0xBC, 0x54, 0x53,
+    0xAC, 0x07, 0x32, 0x60, 0x7A, 0xC0, 0x01, 0x6A, 0x00, 0x6C, 0x58, 0xD2, 0x14, 0xDA, 0x6F, 0xF2,
+    0x32, 0xA0, 0xE2, 0x22, 0xF4, 0x39, 0x50, 0x9E, 0x8F, 0xBF, 0x6C, 0x5B, 0xE3, 0x54, 0x62, 0x6D,
+    0x5B, 0x35, 0xAE, 0xD1, 0x3F, 0xEF, 0xB1, 0x02, 0x75, 0x82, 0xA6, 0x85, 0xBC, 0x08, 0x6A, 0xA0,
+    0x4B, 0x68, 0xF1, 0xD8, 0x08, 0xAC, 0xD1, 0xF1, 0xC0, 0x95, 0x7A, 0xFB, 0xED, 0xB0, 0x65, 0x55,
+    0x5A, 0x95, 0x2F, 0xC4, 0xED, 0xCA, 0xBF, 0x3F, 0x1A, 0x69, 0xEB, 0x81, 0x11, 0xDD, 0x53, 0x2D,
+    0x3A, 0x01, 0x0C, 0x6B, 0x8A, 0x21, 0xA3, 0xDF, 0x1D, 0x39, 0xF9, 0x5F, 0x9E, 0xF8, 0x25, 0x35,
+    0xC6, 0x22, 0x91, 0x4D, 0x60, 0x6D, 0x5B, 0x76, 0x6B, 0x70, 0x5B, 0xE0, 0xF2, 0xA2, 0x47, 0x15,
+    0x97, 0xFD, 0x55, 0x1E, 0x1A, 0xA8, 0x33, 0xB8, 0x01, 0xDC, 0x12, 0x58, 0x0A, 0x6A, 0x09, 0x54,
+    0x47, 0x79, 0xED, 0x28, 0xD1, 0xAA, 0x0C, 0x88, 0x87, 0xAE, 0x87, 0x9D, 0x11, 0xB6, 0xB7, 0xA1,
+    0xB6, 0x81, 0xEA, 0x8F, 0x12, 0x36, 0x64, 0x4A, 0x11, 0x8C, 0x48, 0xAF, 0x45, 0x06, 0x3D, 0x32,
+    0xAB, 0x8C, 0x6B, 0xF9, 0xCD, 0xA7, 0x7D, 0x25, 0xF1, 0xD4, 0x93, 0x17, 0x8E, 0x56, 0x33, 0x37,
+    0xDB, 0x52, 0xA2, 0x79, 0x7E, 0xD0, 0x61, 0xAB, 0xE8, 0x2D, 0xA9, 0x0A, 0x4E, 0x52, 0x29, 0x23,
+    0xDD, 0x25, 0xE0, 0x36, 0x05, 0xF6, 0xE9, 0x1E, 0x2D, 0x11, 0x5C, 0xFF, 0x99, 0x68, 0x71, 0xFA,
+    0x64, 0xAB, 0x64, 0xC4, 0xCE, 0x70, 0xC7, 0xE1, 0x7A, 0xCD, 0x3E, 0xB5, 0xB4, 0xE6, 0xF9, 0x81,
+    0x64, 0xFD, 0x19, 0x92, 0x0E, 0x0D, 0x4E, 0x52, 0x21, 0x33, 0xE5, 0x07, 0xFD, 0x52, 0xDB, 0x4D,
+    0x02, 0xF1, 0xD4, 0x03, 0xE6, 0xE5, 0x96, 0x71, 0xA4, 0xB6, 0xC1, 0xC4, 0x4C, 0xB6, 0xA1, 0x96,
+    0x6C, 0x44, 0x7A, 0x91, 0xC9, 0xB5, 0xF6, 0xAD, 0xC4, 0x0C, 0xB6, 0xA5, 0xF8, 0xF1, 0x52, 0xA9,
+    0x0E, 0xCE, 0x4A, 0xCD, 0xB1, 0x96, 0x47, 0xD3, 0x25, 0xCB, 0xF0, 0x9C, 0xBE, 0x16, 0x1A, 0x2B,
+    0xB9, 0x96, 0x58, 0xBF, 0xD6, 0xB2, 0x8B, 0x09, 0xD4, 0x11, 0xB7, 0x71, 0x27, 0x7F, 0xE8, 0x60,
+    0xA6, 0x3D, 0xD4, 0xF1, 0xA4, 0xB4, 0x4A, 0x66, 0x6A, 0x49, 0xC5, 0xEC, 0x7D, 0xD5, 0xC3, 0xB4,
+    0xE4, 0x66, 0xD7, 0xC2, 0x0C, 0x26, 0xD3, 0x5A, 0x11, 0x9C, 0x8C, 0x34, 0xD2, 0xD3, 0x89, 0x87,
+    0x84, 0x85, 0xFD, 0x8D, 0x9F, 0x76, 0xBE, 0x9E, 0xD4, 0x88, 0x6D, 0xD9, 0xA1, 0x48, 0x94, 0x7F,
+    0xE1, 0x2B, 0xE1, 0xAE, 0x03, 0x04, 0x7C, 0x86, 0x65, 0x29, 0x89, 0x14, 0x71, 0xE7, 0xC8, 0xD6,
+    0x17, 0x47, 0x8C, 0x8C, 0xD4, 0x92, 0xE8, 0x2E, 0xDF, 0xA6, 0x26, 0xD0, 0xC3, 0x22, 0xD8, 0xC6,
+    0xE5, 0x55, 0xA5, 0x02, 0x2B, 0x82, 0x95, 0x19, 0x23, 0x13, 0x85, 0x4C, 0x4B, 0xE5, 0x09, 0x14,
+    0x19, 0x75, 0xB3, 0x67, 0x38, 0xBB, 0xC1, 0x21, 0x46, 0xBC, 0x89, 0xE8, 0x88, 0x4A, 0xB0, 0x86,
+    0xFA, 0x4F, 0x30, 0x12, 0xB8, 0x18, 0x01, 0xB5, 0xB7, 0x38, 0xE4, 0x55, 0xD0, 0xE3, 0xA7, 0xDB,
+    0xF6, 0x13, 0x98, 0x1E, 0xB7, 0xC9, 0x26, 0x9D, 0xAF, 0x3E, 0x61, 0xDB, 0xC3, 0x69, 0xA8, 0xAE,
+    0x6E, 0x8A, 0xC6, 0xD6, 0xE2, 0xF5, 0x87, 0x97, 0xEA, 0x22, 0x46, 0x46, 0x4A, 0xC9, 0x94, 0x37,
+    0x14, 0x66, 0x58, 0x76, 0x5E, 0xE4, 0x05, 0x0C, 0xE1, 0xDA, 0x65, 0xEB, 0x5A, 0x24, 0x20, 0x12,
+    0xA9, 0x64, 0xD8, 0xEC, 0xFD, 0x9B, 0x27, 0xBD, 0xFE, 0xA0, 0xC7, 0x0E, 0xB0, 0x73, 0xB8, 0x6A,
+    0xDD, 0x53, 0x4D, 0x98, 0x08, 0x23, 0x54, 0x8B, 0x13, 0xD7, 0x7F, 0x82, 0x92, 0xC4, 0xC9, 0x19,
+    0x50, 0xFE, 0x76, 0xD4, 0x3B, 0x03, 0x74, 0x61, 0x49, 0x41, 0x5F, 0x3C, 0x52, 0x46, 0x66, 0x94,
+    0x48, 0x5F, 0x88, 0x24, 0x9D, 0xCC, 0xA0, 0x93, 0x1A, 0x4D, 0x64, 0x2C, 0x7B, 0x06, 0x1B, 0x8A,
+    0x54, 0xB5, 0x26, 0xD5, 0xED, 0xC5, 0xDE, 0x89, 0x04, 0x27, 0xE2, 0x1B, 0x99, 0xE8, 0xE4, 0x32,
+    0xA0, 0x23, 0xF0, 0x8E, 0x87, 0x9D, 0x01, 0xCE, 0xEE, 0x80, 0xDD, 0xA5, 0xFC, 0xD9, 0xCB, 0xBE,
+    0x92, 0x48, 0xF5, 0xEF, 0x07, 0xAC, 0xCF, 0x98, 0x76, 0x97, 0x22, 0x36, 0x9E, 0x6E, 0x13, 0xF1,
+    0x6A, 0x1E, 0x3F, 0x2D, 0x90, 0xD1, 0x11, 0x74, 0x4F, 0x21, 0x33, 0xC5, 0x33, 0x3F, 0x05, 0x0B,
+    0xF5, 0x33, 0x28, 0x99, 0x31, 0x7F, 0x31, 0x61, 0x7D, 0xE6, 0xB4, 0x1A, 0x39, 0x6B, 0x06, 0x6A,
+    0x49, 0x54, 0x92, 0x30, 0x37, 0x23, 0x14, 0x4F, 0x27, 0x6A, 0xE9, 0xF9, 0xDE, 0x83, 0xC7, 0x93,
+    0xCE, 0x49, 0x99, 0x70, 0x92, 0x98, 0xBF, 0x4B, 0xB9, 0xB1, 0xCD, 0xF4, 0x4D, 0x8C, 0x24, 0x6A,
+    0x69, 0x39, 0xE0, 0x3D, 0x6F, 0xEF, 0x21, 0xD2, 0x1B, 0x11, 0x6A, 0xC9, 0xC0, 0x1D, 0x5E, 0xC9,
+    0x84, 0x3B, 0x28, 0x64, 0xC7, 0xAF, 0xBA, 0xA7, 0xBA, 0xEE, 0xCD, 0xEB, 0x8F, 0x20, 0xD2, 0x56,
+    0x4F, 0x7D, 0xA7, 0x48, 0x8A, 0x5A, 0x12, 0x32, 0x2F, 0xE5, 0xA0, 0xE8, 0x1F, 0xC1, 0x4A, 0x4F,
+    0x35, 0xC1, 0x09, 0xFF, 0xA9, 0xD4, 0x28, 0xEF, 0xEB, 0x91, 0x09, 0x23, 0xFE, 0xD8, 0x4A, 0x7F,
+    0x4D, 0x35, 0xB0, 0x2D, 0x6A, 0x04, 0xE7, 0x29, 0xF6, 0x0E, 0xE3, 0x51, 0x7A, 0x2B, 0x99, 0xF9,
+    0xBB, 0xD4, 0xA0, 0x13, 0xB8, 0x7F, 0x8A, 0x91, 0x44, 0x37, 0x63, 0x03, 0x6A, 0x84, 0xFA, 0xED,
+    0x3D, 0x2D, 0xE2, 0x1B, 0x49, 0xA5, 0xC8, 0x52, 0x13, 0x77, 0x61, 0x82, 0xEF, 0x7F, 0x44, 0xBA,
+    0x9A, 0x07, 0xF3, 0xFA, 0x23, 0x56, 0xC6, 0xEA, 0xA9, 0xEF, 0xD4, 0xDC, 0x56, 0x4B, 0xB2, 0x12,
+    0x0B, 0xF1, 0xBF, 0xB6, 0x0C, 0xDD, 0xC3, 0x26, 0x21, 0x5C, 0xFA, 0xD5, 0xAB, 0x03, 0x09, 0xDD,
+    0x53, 0x7A, 0x6C, 0x5C, 0x3C, 0x74, 0xF1, 0x7E, 0xFD, 0xFA, 0x00, 0x12, 0x60, 0x17, 0xB8, 0xFB,
+    0xC3, 0xB6, 0xBA, 0x28, 0x3D, 0x22, 0x81, 0xF9, 0xBB, 0x14, 0x69, 0x51, 0x4A, 0xBF, 0xB7, 0x87,
+    0x91, 0x44, 0x29, 0x71, 0xA9, 0x64, 0xED, 0x62, 0x7E, 0x27, 0x03, 0x8D, 0x24, 0x3A, 0x49, 0x60,
+    0x55, 0xA4, 0xBA, 0x0A, 0xF5, 0x31, 0x02, 0xF8, 0xE1, 0xAB, 0xF3, 0x54, 0xD7, 0xBD, 0x1A, 0xFF,
+    0x19, 0x56, 0x46, 0x76, 0x9F, 0x3A, 0x5F, 0x24, 0x45, 0x29, 0x19, 0x2B, 0x91, 0x72, 0xE2, 0x00,
+    0x5A, 0x34, 0x80, 0x9D, 0x40, 0xC7, 0xFD, 0x8F, 0x5B, 0xE6, 0x5B, 0x4F, 0x40, 0x27, 0x3D, 0x4E,
+    0x26, 0xEC, 0x88, 0x2F, 0x32, 0xE0, 0xFC, 0x52, 0x38, 0x98, 0xD5, 0x4F, 0xBD, 0xED, 0xEB, 0x89,
+    0xAC, 0xBA, 0xBE, 0xEA, 0x8B, 0x01, 0x79, 0x5B, 0xB0, 0x22, 0x11, 0x27, 0x13, 0x3C, 0x73, 0x03,
+    0xE0, 0xE1, 0x25, 0xC5, 0xD4, 0x23, 0x2A, 0xED, 0x7C, 0x28, 0x02, 0xDE, 0x4F, 0x74, 0xD2, 0x9A,
+    0x57, 0x32, 0x2B, 0x93, 0x54, 0x5F, 0xB7, 0xE5, 0x7D, 0x99, 0x5A, 0x12, 0x8D, 0xB4, 0x74, 0x19,
+    0xFE, 0x56, 0x82, 0xDA, 0x17, 0x37, 0x47, 0xAC, 0x04, 0x2E, 0x8E, 0x00, 0x65, 0xD1, 0x2F, 0x18,
+    0xA7, 0x14, 0xCF, 0x2F, 0xBB, 0xDF, 0xC9, 0xA7, 0x3C, 0xA5, 0x4C, 0x68, 0x91, 0x1E, 0x69, 0x6F,
+    0xA1, 0x0E, 0x8B, 0xFC, 0x65, 0xAB, 0xF1, 0xF4, 0x77, 0x98, 0x0A, 0xE9, 0x6D, 0xB8, 0x6B, 0x52,
+    0x13, 0xB5, 0xB7, 0xF3, 0x33, 0x09, 0x91, 0x79, 0xF9, 0xC3, 0x29, 0xB9, 0x0C, 0x2A, 0x3E, 0xB2,
+    0x20, 0x2C, 0x89, 0xC7, 0xEB, 0x29, 0x77, 0xFD, 0x28, 0xD0, 0x49, 0xAB, 0x86, 0x0E, 0x1D, 0x1A,
+    0x8C, 0xBF, 0x4A, 0x79, 0xDF, 0x82, 0x1E, 0x8D, 0x8C, 0x14, 0x92, 0x16, 0x8D, 0xCB, 0x9E, 0xBA,
+    0x6B, 0x71, 0xC2, 0x46, 0x65, 0xB6, 0x81, 0x2B, 0xC0, 0xC4, 0x47, 0xFD, 0x95, 0x6F, 0x3D, 0x41,
+    0x29, 0x13, 0x4E, 0x26, 0xA4, 0xBD, 0xA5, 0xC8, 0x8B, 0xB2, 0x26, 0x2D, 0xBA, 0xDA, 0xBE, 0x9E,
+    0x6C, 0xB8, 0x6B, 0xAA, 0xFA, 0x62, 0xB0, 0xF3, 0x33, 0xC9, 0x8A, 0x44, 0x2D, 0xD2, 0x2F, 0xA6,
+    0x2D, 0x03, 0x64, 0xA8, 0x5B, 0x8A, 0x27, 0x8E, 0x29, 0x59, 0xCA, 0xA8, 0x86, 0x8E, 0x95, 0x49,
+    0xC6, 0x5F, 0xE5, 0xB9, 0x2A, 0x94, 0x92, 0x69, 0xA4, 0x2D, 0x24, 0xA1, 0x6A, 0x28, 0xFB, 0xE2,
+    0xE6, 0x88, 0x13, 0x4E, 0x2E, 0x84, 0x63, 0x06, 0x1A, 0xBF, 0xA0, 0x51, 0xDB, 0x43, 0x19, 0x37,
+    0xE7, 0xCB, 0xC7, 0xD8, 0xB6, 0x96, 0x01, 0x27, 0x13, 0x2E, 0xAA, 0xC3, 0x3F, 0x98, 0x04, 0x7A,
+    0x34, 0xDF, 0x63, 0x2A, 0xA4, 0x77, 0x5C, 0x1C, 0xAA, 0xBE, 0x18, 0xB4, 0x3C, 0x9D, 0x11, 0x99,
+    0xB1, 0x22, 0x7E, 0xE3, 0x0A, 0x2E, 0xA0, 0x47, 0x68, 0xC0, 0xF6, 0x14, 0x19, 0xBE, 0xE2, 0x01,
+    0xD4, 0x95, 0x35, 0x9D, 0xB4, 0xD5, 0x03, 0x49, 0x87, 0x86, 0x87, 0xCB, 0x58, 0xDE, 0x97, 0xE9,
+    0x24, 0x2C, 0x25, 0x7A, 0x31, 0xEA, 0x15, 0xEA, 0xAE, 0xD5, 0x92, 0x0E, 0x4C, 0xBA, 0x29, 0x6E,
+    0x8D, 0x87, 0x9B, 0x11, 0x7D, 0xAC, 0xB8, 0xAF, 0xB9, 0x44, 0x66, 0xAD, 0x46, 0x72, 0x31, 0xA8,
+    0xAC, 0x53, 0x31, 0xEA, 0xA4, 0x87, 0x32, 0x9A, 0x64, 0x7F, 0xB1, 0x98, 0xB0, 0x12, 0xE9, 0x6B,
+    0x91, 0xE0, 0x5A, 0x17, 0x1A, 0xEF, 0xDA, 0x8E, 0xC6, 0x73, 0x06, 0x9C, 0x47, 0xFA, 0xE2, 0x30,
+    0x14, 0xB6, 0x60, 0x07, 0x46, 0x18, 0x50, 0x09, 0x7D, 0x73, 0xD0, 0x92, 0xCB, 0x61, 0xC7, 0x86,
+    0x95, 0x6D, 0x77, 0x6A, 0x3F, 0x3A, 0x35, 0x34, 0x3A, 0x5D, 0xD5, 0xE9, 0xB8, 0xCC, 0x93, 0x37,
+    0x7E, 0x6F, 0xB2, 0x22, 0xB3, 0x15, 0x99, 0x7E, 0xA5, 0xCC, 0x2D, 0xB8, 0x74, 0xDE, 0x48, 0x2C,
+    0x67, 0xAF, 0x12, 0xC5, 0xCD, 0x41, 0x4B, 0x36, 0x1F, 0x96, 0xE0, 0x16, 0x09, 0x5B, 0xF7, 0x16,
+    0x53, 0xF8, 0x42, 0xC3, 0x97, 0x0F, 0x73, 0x26, 0x0E, 0x32, 0xA6, 0xA7, 0x86, 0x8C, 0x8E, 0x54,
+    0x9E, 0x35, 0x3A, 0x61, 0x5B, 0xAE, 0xA2, 0x07, 0xAA, 0x40, 0x03, 0xEA, 0xDD, 0xE0, 0xFE, 0x9B,
+    0xB9, 0xE8, 0x7F, 0x7B, 0xEF, 0x00, 0xE8, 0x6F, 0xA1, 0x03, 0x3B, 0x94, 0x2D, 0x03, 0x15, 0x3A,
+    0x2D, 0xD4, 0xE0, 0x82, 0x92, 0xAC, 0x65, 0xFC, 0xD0, 0x81, 0x67, 0xC8, 0xA8, 0x81, 0x22, 0xA1,
+    0x13, 0x3A, 0x62, 0x7A, 0xCA, 0x80, 0x0D, 0xD8, 0x96, 0xBA, 0xC5, 0x79, 0x9A, 0x25, 0xB0, 0xD4,
+    0xF9, 0x4E, 0x2A, 0x39, 0xE8, 0x5D, 0x7C, 0x92, 0x10, 0x1B, 0xC8, 0x54, 0xBE, 0x48, 0x38, 0x74,
+    0xE4, 0x12, 0x65, 0x20, 0x63, 0xDB, 0x62, 0xC4, 0x79, 0x93, 0xE8, 0xA8, 0xBC, 0x0E, 0xB8, 0x56,
+    0x2D, 0xAC, 0x8E, 0x3D, 0xCA, 0x80, 0x3B, 0x64, 0xE9, 0x2A, 0x62, 0x3D, 0x2B, 0x54, 0xA2, 0x6C,
+    0xD9, 0x42, 0x25, 0x6C, 0xC0, 0x51, 0x24, 0xCE, 0x82, 0xF8, 0x05, 0x1B, 0xA1, 0x23, 0xBB, 0xD8,
+    0xFE, 0x28, 0xD4, 0x7E, 0x95, 0xDC, 0x06, 0x54, 0xDC, 0xD2, 0x61, 0xA7, 0x6C, 0x87, 0x4A, 0x27,
+    0x07, 0xDB, 0xD8, 0xD6, 0xF4, 0x6A, 0x64, 0x8D, 0xF3, 0x36, 0xE8, 0xC4, 0xC8, 0x2E, 0x95, 0xB7,
+    0x7D, 0x91, 0xC8, 0x38, 0xAA, 0xD6, 0x44, 0x3D, 0x70, 0x05, 0x87, 0x0D, 0x26, 0xAA, 0xCC, 0x44,
+    0x1D, 0x6C, 0x28, 0x46, 0x35, 0x2E, 0x39, 0xF2, 0x73, 0x65, 0x02, 0x99, 0xA1, 0x92, 0x80, 0x96,
+    0x04, 0x7F, 0xEF, 0x98, 0x75, 0x4F, 0x61, 0x7A, 0x13, 0x74, 0xD2, 0x89, 0x0C, 0x7C, 0x6B, 0xF3,
+    0xF5, 0x69, 0xCA, 0xD6, 0x7A, 0x1D, 0x74, 0x50, 0x49, 0x25, 0x9E, 0x63, 0x9F, 0x15, 0x5B, 0x9C,
+    0xA6, 0xC2, 0x7A, 0x1B, 0x74, 0xD0, 0xA9, 0x88, 0x0B, 0x91, 0xD3, 0x79, 0x03, 0xF2, 0x9E, 0xE4,
+    0xC8, 0xEC, 0x4B, 0x34, 0xCF, 0x09, 0xF6, 0xAB, 0x63, 0xA9, 0xD1, 0xC4, 0xA5, 0xBA, 0x90, 0x37,
+    0x99, 0xC8, 0xB1, 0x94, 0x96, 0xB2, 0x5F, 0x6E, 0xA8, 0x71, 0x73, 0xD3, 0xB1, 0x74, 0x5B, 0x6D,
+    0xE0, 0x96, 0x32, 0x62, 0x24, 0xA1, 0x65, 0x44, 0xC9, 0x08, 0x27, 0xCE, 0x1F, 0xAC, 0x77, 0x76,
+    0x81, 0xB3, 0x92, 0x38, 0x6B, 0xC2, 0x31, 0x87, 0xD1, 0x0B, 0x35, 0xB0, 0x1E, 0x12, 0x9C, 0x5E,
+    0x3A, 0x5B, 0xAB, 0x05, 0xF2, 0x0F, 0x50, 0xC1, 0x5D, 0x11, 0x3D, 0x1D, 0x32, 0xB2, 0x0D, 0x53,
+    0x69, 0x29, 0xF2, 0x92, 0x4A, 0xBA, 0x25, 0xFF, 0xDD, 0x79, 0xA4, 0xFB, 0xBA, 0x0E, 0xFA, 0x9D,
+    0x4C, 0xF5, 0xF5, 0x40, 0x9E, 0xD0, 0xD7, 0x7B, 0xEA, 0x09, 0x24, 0x62, 0x66, 0xA8, 0x47, 0x90,
+    0x01, 0x23, 0x03, 0xEE, 0x62, 0x22, 0xBB, 0x54, 0xC6, 0x2E, 0x2D, 0x28, 0x3D, 0xC1, 0x08, 0x2B,
+    0xA8, 0xC1, 0xFE, 0x63, 0xAF, 0x5F, 0x6B, 0x0B, 0x69, 0x11, 0x4F, 0x13, 0xA8, 0x33, 0x56, 0x82,
+    0x79, 0x2B, 0x17, 0x83, 0x1C, 0xD3, 0x44, 0xC0, 0xB5, 0x54, 0x01, 0xDB, 0x53, 0x26, 0xD4, 0x79,
+    0xE0, 0x8D, 0xF0, 0xA5, 0xE7, 0x8A, 0xBF, 0xC2, 0xB5, 0x26, 0x31, 0x61, 0x87, 0xE2, 0xB5, 0xB0,
+    0x6A, 0x40, 0x79, 0x4E, 0x43, 0x5A, 0x48, 0xB6, 0x1A, 0x16, 0x3F, 0x55, 0xE3, 0xD1, 0x7B, 0xBF,
+    0x79, 0x8F, 0x0F, 0x3A, 0x79, 0x4F, 0xE4, 0x25, 0x11, 0x20, 0xB2, 0xA2, 0x6C, 0x39, 0xB4, 0xA3,
+    0x69, 0xD9, 0xC7, 0x7A, 0x95, 0xD8, 0x5E, 0xE2, 0xC5, 0x2E, 0xF1, 0x52, 0x44, 0xB6, 0x31, 0x99,
+    0x6E, 0xE1, 0xB2, 0x35, 0x38, 0xD8, 0x85, 0x35, 0x64, 0xD4, 0x48, 0x31, 0xA0, 0x13, 0x26, 0x52,
+    0xC6, 0x07, 0xAD, 0x4C, 0x95, 0xE4, 0x05, 0x1E, 0x02, 0x5C, 0xA0, 0xC8, 0xE8, 0x11, 0x9D, 0xB0,
+    0x91, 0x2A, 0x70, 0x87, 0x07, 0x15, 0x8F, 0x22, 0xA6, 0x5D, 0x22, 0xC8, 0x6E, 0x3E, 0x97, 0x2D,
+    0xDB, 0x28, 0xA1, 0xCC, 0x47, 0x89, 0x7E, 0x0F, 0x17, 0x98, 0x28, 0x23, 0xCD, 0xC2, 0x5B, 0x2E,
+    0x2D, 0xB2, 0x4F, 0xA8, 0xF1, 0x6C, 0x91, 0xB6, 0x74, 0xDA, 0x31, 0x71, 0x2C, 0x7B, 0x6C, 0xA0,
+    0x6A, 0xA9, 0x1F, 0xBD, 0xE0, 0x64, 0x68, 0x24, 0x75, 0x92, 0xE0, 0x04, 0x94, 0x2D, 0xBA, 0x57,
+    0xAF, 0x27, 0xF6, 0x47, 0xB6, 0xA0, 0x02, 0xDB, 0xA2, 0x03, 0x6A, 0x39, 0x93, 0xE5, 0xAB, 0xB2,
+    0x45, 0x47, 0x94, 0x2C, 0xDC, 0x80, 0x4B, 0xCB, 0x41, 0x3D, 0x9F, 0x4C, 0xCC, 0x45, 0x6A, 0xC8,
+    0x77, 0xB6, 0xBB, 0x50, 0x7B, 0x6C, 0xC0, 0x44, 0x8A, 0xF1, 0x0E, 0x2F, 0xD2, 0x37, 0x92, 0x6A,
+    0xC9, 0xF0, 0xC8, 0x26, 0xB3, 0xDC, 0xA9, 0xDF, 0x4C, 0x5B, 0xBB, 0xE6, 0xE5, 0x38, 0x2E, 0x66,
+    0x3C, 0x8B, 0x8E, 0x34, 0xE1, 0xD8, 0x5E, 0x00, 0x8E, 0xAA, 0x30, 0xD8, 0xF6, 0x00, 0xCA, 0xA3,
+    0x86, 0x11, 0xA0, 0xDE, 0x05, 0xD0, 0x12, 0x60, 0x19, 0x47, 0x70, 0x60, 0x8B, 0xA5, 0xD5, 0x57,
+    0x85, 0xA5, 0xF3, 0xB7, 0x74, 0xF5, 0x96, 0xD4, 0x1B, 0x01, 0xEC, 0x7C, 0xE2, 0x3C, 0x68, 0x91,
+    0x09, 0x98, 0x97, 0x36, 0xEA, 0x45, 0xD9, 0x78, 0xF2, 0xC1, 0x3F, 0x58, 0x78, 0xE3, 0x3F, 0xF8,
+    0x70, 0x29, 0x55, 0x71, 0x89, 0xA2, 0x05, 0x85, 0xED, 0x1C, 0xE8, 0x95, 0x58, 0x1A, 0x78, 0x3A,
+    0xDE, 0x86, 0x6A, 0xE6, 0x47, 0x3B, 0xE9, 0x51, 0x7E, 0x7F, 0x73, 0x5B, 0x09, 0x4B, 0x9B, 0x03,
+    0xE2, 0xF2, 0xCF, 0xD2, 0xC3, 0x89, 0xA3, 0x55, 0xEF, 0x60, 0x9B, 0x86, 0x4B, 0x74, 0x7E, 0x8D,
+    0xB4, 0x59, 0xC9, 0xF3, 0x43, 0x21, 0x2F, 0x24, 0x7D, 0xF3, 0x5A, 0x32, 0x1F, 0xFC, 0xB0, 0xB7,
+    0x6F, 0xFD, 0x2C, 0xD8, 0x57, 0x25, 0xD4, 0xD7, 0xC4, 0xBB, 0x6B, 0x82, 0x7B, 0x4C, 0xE8, 0xEE,
+    0x9B, 0x81, 0x13, 0xB0, 0x82, 0xFD, 0xA3, 0xF1, 0x04, 0x14, 0xD7, 0xA3, 0x96, 0xD1, 0x0C, 0xEB,
+    0x32, 0xEC, 0x58, 0x3F, 0x56, 0x0C, 0xAE, 0x48, 0x4E, 0xA7, 0xAB, 0x26, 0xFD, 0xCD, 0xE5, 0x2C,
+    0x36, 0x55, 0x19, 0x8A, 0xF1, 0x00, 0xE5, 0x1C, 0x82, 0xB8, 0xFF, 0x8F, 0x44, 0x75, 0x01, 0x3D,
+    0x62, 0x0E, 0x3C, 0xDA, 0xF9, 0x05, 0x97, 0xED, 0x57, 0x1E, 0x7B, 0x7D, 0x93, 0xF4, 0x4E, 0x7F,
+    0x04, 0xAD, 0x5C, 0x60, 0xA4, 0xE1, 0x12, 0x75, 0x5F, 0x63, 0x47, 0x1B, 0x8C, 0x98, 0xBE, 0x90,
+    0x17, 0x12, 0x73, 0xCA, 0x34, 0x97, 0x2E, 0xE1, 0xFE, 0xD3, 0x33, 0xD8, 0x57, 0x25, 0x94, 0x49,
+    0x7A, 0x9D, 0x5D, 0x62, 0x2E, 0xF3, 0x46, 0xCF, 0xD2, 0x3F, 0x8B, 0x7D, 0x66, 0xE9, 0x27, 0x6D,
+    0x1F, 0x75, 0xC9, 0x0E, 0x2D, 0x83, 0x95, 0x48, 0xF3, 0x40, 0x28, 0x52, 0x85, 0xF5, 0x23, 0x3B,
+    0xBA, 0xD7, 0xA9, 0xC6, 0x86, 0xCC, 0xD5, 0x43, 0xE8, 0x64, 0xFA, 0x43, 0xAF, 0xD3, 0x09, 0x0E,
+    0xD0, 0xCE, 0xC7, 0x5D, 0x65, 0xD7, 0x6E, 0xC8, 0x29, 0x6A, 0xAA, 0x81, 0x32, 0xEC, 0x00, 0x5B,
+    0x3A, 0x82, 0x4A, 0xD6, 0x83, 0x0D, 0x6B, 0xC0, 0xE9, 0x04, 0xC5, 0x58, 0x85, 0xBF, 0xF1, 0x11,
+    0x14, 0x19, 0xDC, 0x92, 0xBA, 0xFF, 0x1A, 0x07, 0x5D, 0xF6, 0x48, 0x50, 0x07, 0x29, 0xF2, 0x93,
+    0xFA, 0x67, 0x77, 0xDD, 0x00, 0x27, 0x11, 0xF7, 0x67, 0x13, 0xCE, 0x57, 0xC1, 0x79, 0x9D, 0x6C,
+    0x4B, 0x2E, 0x7B, 0xB6, 0x75, 0xA2, 0xF6, 0x19, 0x1B, 0x9A, 0xF6, 0x62, 0xAC, 0x44, 0x06, 0x2D,
+    0x32, 0xD2, 0xC9, 0xC8, 0xC9, 0x43, 0xB8, 0x80, 0xC2, 0x2E, 0xD3, 0xC4, 0x23, 0x1B, 0x4F, 0x18,
+    0x89, 0x26, 0xAE, 0x75, 0x5F, 0xA9, 0x64, 0xDB, 0x2B, 0x17, 0xFB, 0x4A, 0xA2, 0x96, 0x44, 0x7D,
+    0xF9, 0xB0, 0x89, 0x16, 0x96, 0x26, 0x5A, 0xD3, 0x7F, 0x76, 0xAA, 0xDC, 0x02, 0xEA, 0x17, 0x6B,
+    0x2A, 0xF1, 0x34, 0x97, 0x8F, 0x53, 0x5A, 0x69, 0x4D, 0x5C, 0x33, 0x98, 0x50, 0x31, 0x16, 0xEF,
+    0x75, 0xBE, 0x92, 0x88, 0x64, 0x8A, 0x1B, 0x00, 0x6B, 0x35, 0x50, 0x86, 0xAA, 0x65, 0x52, 0xC7,
+    0x01, 0xD4, 0xC9, 0xD9, 0x2F, 0x43, 0x0E, 0xFB, 0x5E, 0xE7, 0x99, 0x68, 0xB0, 0x3D, 0x99, 0x6D,
+    0x74, 0x2A, 0x06, 0x6C, 0x6B, 0x03, 0x57, 0x70, 0xE8, 0xA4, 0x66, 0xD5, 0xB5, 0x46, 0x64, 0x5A,
+    0xC8, 0x53, 0x2D, 0x33, 0x87, 0xA3, 0x0E, 0xD8, 0x66, 0x4D, 0x2E, 0x06, 0x9D, 0xCA, 0x78, 0x9C,
+    0x65, 0x2B, 0x19, 0x31, 0x71, 0x8D, 0xF5, 0x3B, 0x54, 0x8C, 0xD4, 0xDF, 0x18, 0xA8, 0x24, 0x62,
+    0x25, 0x6C, 0xD4, 0xFA, 0x12, 0x58, 0xB0, 0x07, 0x2D, 0x5D, 0x3B, 0x53, 0x4A, 0xD2, 0xFD, 0x16,
+    0xC9, 0xB2, 0x36, 0x61, 0xDB, 0x44, 0x2B, 0xA9, 0x94, 0xA4, 0x65, 0x22, 0xDB, 0xB6, 0x33, 0xD1,
+    0x3D, 0x96, 0x6D, 0x2F, 0xE5, 0xE0, 0x02, 0x40, 0xE9, 0x55, 0x64, 0xC5, 0x09, 0xAF, 0x6E, 0xF6,
+    0xF5, 0xA4, 0x6F, 0xF8, 0x4B, 0x94, 0x81, 0x91, 0xDA, 0xEB, 0x61, 0x33, 0x30, 0x81, 0xBA, 0xC7,
+    0x46, 0xF4, 0x32, 0x3C, 0xC8, 0xF0, 0x07, 0x87, 0xA0, 0xEB, 0xD7, 0x15, 0x77, 0xC2, 0x17, 0xF9,
+    0xA0, 0xCE, 0xD6, 0xCB, 0x84, 0xEE, 0x93, 0x04, 0x9F, 0xE0, 0x3C, 0x95, 0x6D, 0xA9, 0x87, 0x05,
+    0xB1, 0x3C, 0xC4, 0x31, 0xA9, 0x74, 0x82, 0xEE, 0xB7, 0xB0, 0x24, 0xD6, 0x26, 0xE8, 0xB8, 0x8B,
+    0x95, 0x44, 0x27, 0x68, 0x99, 0xB0, 0x61, 0xA4, 0x33, 0x51, 0x8F, 0x75, 0xB0, 0xBD, 0xD0, 0xDD,
+    0xBF, 0xA4, 0xFA, 0xA2, 0xBD, 0x5B, 0xBD, 0x37, 0xD0, 0x05, 0xB6, 0x37, 0x4D, 0x2A, 0x75, 0xB3,
+    0x2F, 0xA4, 0xD7, 0x37, 0xFC, 0x06, 0xF4, 0xB6, 0xD4, 0x7E, 0x83, 0x78, 0x17, 0x8B, 0x9E, 0x5E,
+    0x12, 0x76, 0xE9, 0x0F, 0xF2, 0x0D, 0x8D, 0x50, 0x4A, 0xA2, 0xF1, 0xBE, 0x48, 0x4B, 0xDF, 0xCF,
+    0xFD, 0x18, 0xBA, 0x19, 0x1A, 0x01, 0x33, 0x81, 0x1E, 0x4D, 0x5B, 0xF5, 0x8D, 0x88, 0x16, 0x89,
+    0x85, 0x8C, 0xC0, 0x6D, 0xE8, 0xC0, 0x99, 0x25, 0xF5, 0x2A, 0x69, 0xAB, 0xA7, 0x79, 0x0E, 0xF5,
+    0x0B, 0xE8, 0x5A, 0x9C, 0xBE, 0x99, 0x9D, 0xF4, 0x07, 0x94, 0x67, 0xB5, 0x61, 0xB1, 0xD2, 0x7F,
+    0x98, 0xAF, 0xDF, 0xC1, 0xA6, 0x61, 0x13, 0x68, 0xBC, 0x67, 0xBD, 0x81, 0x72, 0x72, 0x79, 0x91,
+    0x5D, 0x49, 0x58, 0x82, 0xC4, 0x46, 0xD3, 0x56, 0x7D, 0x25, 0x12, 0x9C, 0xCC, 0x94, 0x1B, 0xA7,
+    0x2F, 0x22, 0xCC, 0x20, 0x89, 0xFD, 0x6A, 0xF1, 0x5A, 0xCC, 0xDB, 0xA1, 0xE8, 0x61, 0xB7, 0xA5,
+    0x98, 0xC1, 0x06, 0x7B, 0x3D, 0x59, 0x19, 0x54, 0x17, 0x0F, 0xE5, 0x55, 0x12, 0x0A, 0xC9, 0x54,
+    0xFD, 0x6D, 0xAC, 0x97, 0xF4, 0x66, 0x6F, 0x40, 0x2D, 0x2D, 0x95, 0x04, 0x94, 0x78, 0x98, 0x89,
+    0x66, 0xB0, 0x22, 0x41, 0x64, 0x54, 0xDD, 0x0C, 0xCF, 0x6D, 0xDA, 0x83, 0xED, 0xE1, 0xB8, 0xF5,
+    0xE3, 0xB7, 0xDB, 0x8D, 0x44, 0xCA, 0xC8, 0xEF, 0xFA, 0x25, 0x9A, 0xF6, 0xEE, 0x5C, 0x6A, 0xB4,
+    0x9E, 0x16, 0x98, 0x70, 0x58, 0xF1, 0xD4, 0xF9, 0x65, 0x73, 0xB5, 0x04, 0xAA, 0xFE, 0x36, 0xCA,
+    0xB0, 0xC9, 0xB4, 0x72, 0x79, 0xD1, 0x45, 0x49, 0x66, 0x51, 0xC6, 0x46, 0x15, 0xCD, 0xA0, 0x44,
+    0x32, 0x22, 0xE3, 0x66, 0xEF, 0x67, 0x8A, 0x56, 0xBD, 0x9F, 0x28, 0xC7, 0x25, 0x4B, 0x2F, 0xE7,
+    0xD8, 0x44, 0xAA, 0xA7, 0x29, 0x7A, 0xA8, 0xF6, 0x96, 0x51, 0x9C, 0xC3, 0x5E, 0x4F, 0x5A, 0x26,
+    0xEE, 0x3A, 0x9C, 0xDF, 0xBD, 0x28, 0x92, 0x3B, 0x91, 0x56, 0x47, 0xB8, 0xB2, 0x9C, 0x74, 0x86,
+    0xAA, 0x45, 0x2F, 0x0E, 0x69, 0x12, 0x5C, 0x05, 0xDB, 0xA3, 0x32, 0x9C, 0x5A, 0x00, 0xFB, 0xDF,
+    0x5E, 0x6E, 0x6F, 0x86, 0x77, 0x45, 0xCF, 0x0E, 0x65, 0x28, 0xE5, 0x07, 0x32, 0x15, 0x47, 0xF8,
+    0xEF, 0xFF, 0x22, 0xBD, 0x9D, 0x54, 0x8F, 0xE3, 0x64, 0xE2, 0x0A, 0xF0, 0xE5, 0xC2, 0xEB, 0x37,
+    0x12, 0x76, 0x84, 0x4B, 0x50, 0x1C, 0xD4, 0x10, 0x2D, 0x92, 0x1B, 0x91, 0x97, 0x44, 0x46, 0xB6,
+    0x17, 0x20, 0x9F, 0x39, 0xE8, 0x64, 0x39, 0x8F, 0x4E, 0xD0, 0x2C, 0x64, 0x7E, 0x3A, 0xC0, 0x30,
+    0x26, 0x2C, 0x5D, 0xAD, 0x22, 0xAE, 0x55, 0xBA, 0x83, 0x35, 0x85, 0x0C, 0x4A, 0x26, 0xCA, 0x80,
+    0x8E, 0x90, 0x60, 0x07, 0xDC, 0x1E, 0x76, 0x42, 0x8B, 0x3F, 0xBE, 0x51, 0x73, 0xB8, 0x51, 0x27,
+    0xBD, 0x91, 0xFC, 0xF1, 0x1B, 0x5D, 0x5A, 0xEE, 0x2A, 0x51, 0x86, 0x42, 0x86, 0x4A, 0xFA, 0x32,
+    0x94, 0x32, 0x3A, 0xE9, 0x4D, 0xC0, 0xED, 0x21, 0xBD, 0x16, 0x0F, 0x67, 0xCF, 0x41, 0xF3, 0x30,
+    0xFC, 0x3C, 0xC1, 0x7F, 0xFE, 0x70, 0x23, 0x73, 0x66, 0x56, 0x99, 0xA9, 0xC8, 0x2A, 0xEB, 0xB1,
+    0xC8, 0x7A, 0xD0, 0x83, 0x49, 0x3A, 0x95, 0xD1, 0x24, 0xDB, 0x97, 0xBD, 0x0D, 0x36, 0xD8, 0x50,
+    0x87, 0x4A, 0xC4, 0x57, 0x22, 0x9B, 0x4E, 0xEE, 0x86, 0x2B, 0x9E, 0x3E, 0x87, 0xC4, 0xF2, 0x70,
+    0xFC, 0xA9, 0x92, 0x7D, 0xBC, 0xDD, 0x3A, 0x53, 0xA4, 0x64, 0xAF, 0x85, 0xDD, 0x4A, 0x0F, 0x8D,
+    0x3C, 0x2F, 0xB2, 0x84, 0x1C, 0x17, 0x40, 0x26, 0xF4, 0xA6, 0xA7, 0xFF, 0x59, 0x69, 0x70, 0xE2,
+    0x41, 0x64, 0x2E, 0xE4, 0x90, 0x8F, 0x51, 0x31, 0x9E, 0x65, 0x38, 0x53, 0xA4, 0x95, 0x4E, 0x2B,
+    0x13, 0x77, 0x6C, 0xDF, 0x48, 0x68, 0x24, 0xD4, 0xD2, 0xC2, 0xC3, 0xA7, 0xA1, 0x9B, 0xA0, 0x19,
+    0x7F, 0xA9, 0x8D, 0xF5, 0x69, 0x94, 0x78, 0xE4, 0x4E, 0x2A, 0x69, 0xB5, 0xB4, 0x87, 0xAD, 0x2B,
+    0x95, 0x6C, 0xBB, 0xAF, 0xFB, 0x33, 0x45, 0xB2, 0x64, 0x1D, 0x76, 0x55, 0x72, 0xBE, 0x91, 0x50,
+    0x49, 0x5A, 0xAC, 0x51, 0xB6, 0x70, 0xBA, 0xDF, 0xF4, 0x7F, 0xFC, 0x67, 0x6A, 0x11, 0x13, 0xF8,
+    0xDD, 0x56, 0x4D, 0xE8, 0xC3, 0x12, 0x6D, 0xC2, 0xF6, 0x59, 0x86, 0xE7, 0xCA, 0x6B, 0xC1, 0x59,
+    0x35, 0xEE, 0xD8, 0x1F, 0x88, 0x18, 0xC9, 0xA5, 0x44, 0xD4, 0xA0, 0x23, 0x55, 0xEB, 0x50, 0xA3,
+    0xFE, 0x68, 0xF7, 0xC9, 0x46, 0x1B, 0x69, 0x70, 0xBE, 0xC8, 0x2A, 0x63, 0x63, 0x99, 0x70, 0xDE,
+    0x79, 0x95, 0xC9, 0x94, 0xD1, 0x24, 0x9C, 0xAF, 0x3D, 0x99, 0x8C, 0x4E, 0x65, 0xA2, 0x12, 0xF1,
+    0x34, 0x92, 0x51, 0x22, 0xFD, 0xE1, 0xE8, 0x66, 0x99, 0x1D, 0x56, 0xC1, 0xA9, 0xBC, 0x81, 0xE6,
+    0xC0, 0x8E, 0x8E, 0x45, 0xB4, 0xBE, 0xF4, 0x6B, 0x56, 0x3A, 0x91, 0xAA, 0xD6, 0x84, 0x89, 0x4A,
+    0x12, 0x8D, 0x04, 0xBA, 0xF9, 0x53, 0x18, 0xC0, 0xB6, 0x4B, 0x8D, 0xA8, 0xC3, 0xD2, 0xAA, 0x5B,
+    0x1C, 0x62, 0x5F, 0xBF, 0xDA, 0xD7, 0x96, 0xBC, 0x32, 0xAF, 0xA7, 0xE6, 0x6B, 0x92, 0x2B, 0x49,
+    0xB5, 0xB4, 0x2A, 0x61, 0xA1, 0x3B, 0x1A, 0xAC, 0xB1, 0x61, 0x03, 0x45, 0x06, 0xCC, 0x75, 0x0F,
+    0xF6, 0xAB, 0xF1, 0xD8, 0x3D, 0xE7, 0x21, 0x3B, 0x4F, 0x31, 0x3A, 0x8F, 0x49, 0xCE, 0x9F, 0xB7,
+    0xD1, 0xA9, 0xB1, 0x0A, 0x8D, 0x19, 0x9D, 0x6F, 0x6C, 0x6E, 0x68, 0x5C, 0x9E, 0x68, 0xBA, 0x39,
+    0xD3, 0x4D, 0x32, 0xD0, 0x65, 0x49, 0x74, 0xA9, 0xEB, 0xE9, 0xFA, 0x2E, 0xD0, 0x85, 0xCE, 0xC3,
+    0x97, 0x16, 0x82, 0x52, 0xCE, 0xB0, 0xF3, 0xA1, 0x27, 0x07, 0xAC, 0x67, 0xBD, 0x85, 0xEE, 0x87,
+    0x95, 0xD3, 0xAF, 0xBE, 0x33, 0xD8, 0xEE, 0xB5, 0xE0, 0x64, 0x42, 0x24, 0x69, 0x11, 0x6F, 0xDF,
+    0x1C, 0x71, 0xF6, 0x88, 0xF9, 0x9F, 0x01, 0x1B, 0xB1, 0x33, 0xE5, 0xA3, 0xE9, 0x78, 0xFB, 0xC8,
+    0xD5, 0xBE, 0xFE, 0x5A, 0xAC, 0x1E, 0xCD, 0x36, 0x38, 0x1B, 0xEC, 0x6B, 0x7D, 0x21, 0x91, 0x26,
+    0x51, 0xA5, 0x83, 0xC1, 0x78, 0xB7, 0x50, 0xEE, 0xFE, 0x88, 0x10, 0xE3, 0x5A, 0xF4, 0xCD, 0xC0,
+    0x59, 0xD3, 0x7F, 0x64, 0xEC, 0xAB, 0x53, 0x45, 0x19, 0x46, 0xAA, 0xC7, 0x03, 0x6E, 0x0B, 0x24,
+    0x51, 0x08, 0x98, 0x71, 0xC9, 0xC0, 0x97, 0xC0, 0x24, 0x4A, 0x59, 0x66, 0xBE, 0x33, 0xC0, 0x25,
+    0x87, 0xB3, 0xAD, 0x7D, 0x29, 0x7E, 0x74, 0x90, 0xFC, 0xEB, 0xAA, 0xA6, 0xFC, 0xE6, 0x3C, 0xD2,
+    0x66, 0x30, 0xBF, 0x3C, 0xBF, 0x11, 0xB5, 0xC8, 0x40, 0x27, 0x19, 0xEC, 0xB1, 0x57, 0x35, 0x2E,
+    0xAD, 0x09, 0x37, 0x42, 0x33, 0x40, 0x37, 0x3F, 0x89, 0x13, 0x69, 0x2B, 0x91, 0x58, 0x8A, 0x8C,
+    0xC0, 0x3D, 0x70, 0x06, 0xAA, 0x63, 0xF4, 0xCD, 0x4A, 0xD2, 0x72, 0xC0, 0xEE, 0x37, 0x54, 0xE7,
+    0x3D, 0x6F, 0x65, 0x28, 0x65, 0xDE, 0x30, 0x56, 0x35, 0x6E, 0xF8, 0xE4, 0x57, 0x3E, 0x03, 0x0D,
+    0xB6, 0xA1, 0x6A, 0xB1, 0xFD, 0xD1, 0x18, 0xE6, 0x57, 0x68, 0x00, 0xB0, 0x55, 0xB6, 0x8B, 0x37,
+    0x76, 0x07, 0x4F, 0x29, 0x1C, 0xB4, 0x4E, 0x64, 0xC6, 0x89, 0xF8, 0x52, 0x24, 0x2C, 0xF3, 0x8E,
+    0xCD, 0x4B, 0x49, 0x4B, 0x21, 0x2D, 0x5A, 0x5A, 0x8C, 0x78, 0x4A, 0x79, 0xFB, 0xB2, 0x16, 0x19,
+    0x95, 0xC8, 0x4C, 0x27, 0x07, 0x28, 0x77, 0xDB, 0x7A, 0xDC, 0xB0, 0xE0, 0x9B, 0x0F, 0x47, 0xBF,
+    0x08, 0x5A, 0x96, 0xEA, 0x5A, 0x2C, 0x3F, 0xB0, 0x11, 0x25, 0x17, 0xB0, 0x32, 0xD0, 0x49, 0x04,
+    0x05, 0x5D, 0x30, 0x82, 0xF3, 0x0C, 0x98, 0xC0, 0x59, 0x18, 0x3E, 0xD2, 0x18, 0xCD, 0x1B, 0x24,
+    0xBD, 0xCD, 0x2E, 0x9B, 0x67, 0xEB, 0xE0, 0x0C, 0x66, 0xE0, 0x66, 0xDC, 0x36, 0xE1, 0x73, 0x5F,
+    0x74, 0x7F, 0xF8, 0xCF, 0xC7, 0xDF, 0xBE, 0xCC, 0x1D, 0xF7, 0xC9, 0xE4, 0xE6, 0xCB, 0x70, 0xA1,
+    0x92, 0xB9, 0x79, 0xEA, 0xC9, 0x33, 0xE6, 0x71, 0xF9, 0x81, 0xF4, 0x27, 0xFC, 0xA9, 0xAF, 0xBD,
+    0xFA, 0x5E, 0x06, 0xF3, 0xE2, 0xB5, 0x9F, 0xA7, 0x9C, 0x1F, 0xF9, 0xAD, 0x73, 0x7B, 0xD8, 0x2F,
+    0xBC, 0x39, 0xEC, 0x17, 0xD1, 0x84, 0xAC, 0x06, 0xE7, 0xAF, 0x02, 0x6C, 0x99, 0x70, 0x33, 0x9A,
+    0x81, 0x2D, 0x80, 0x1D, 0xC6, 0x62, 0x30, 0xD1, 0xF6, 0x75, 0x0B, 0x74, 0x7E, 0x56, 0x59, 0x0F,
+    0x26, 0x9D, 0xBA, 0x5C, 0x7C, 0xBF, 0xEA, 0x3B, 0x9D, 0xDC, 0xA3, 0x99, 0x6F, 0x79, 0xD7, 0x56,
+    0xC1, 0xF6, 0x26, 0xE9, 0xD1, 0xDE, 0xF5, 0x72, 0x7C, 0xF6, 0x16, 0x56, 0xC5, 0x58, 0x85, 0x74,
+    0x82, 0x3F, 0x38, 0xDF, 0x4D, 0x0F, 0xAE, 0xD9, 0x61, 0xFF, 0x54, 0xF1, 0xFC, 0x3B, 0xC3, 0xDF,
+    0x47, 0xD9, 0x7B, 0xB6, 0x7E, 0x03, 0xF4, 0x3F, 0x7A, 0x5D, 0xCA, 0xC0, 0x23, 0x55, 0xCA, 0xE7,
+    0xE0, 0x96, 0x5B, 0xAF, 0x7E, 0x99, 0x53, 0xDD, 0x35, 0xC9, 0x77, 0x3C, 0xC8, 0x9D, 0xF6, 0xC5,
+    0x77, 0x47, 0xFB, 0xED, 0x3F, 0xFE, 0xE1, 0x2B, 0xEF, 0x27, 0x16, 0xFD, 0xD4, 0x93, 0x45, 0xD6,
+    0x83, 0x49, 0xB6, 0x77, 0xE1, 0xF0, 0x71, 0x3F, 0xD4, 0x3B, 0x43, 0x6A, 0x1E, 0x8F, 0x9C, 0x30,
+    0x2F, 0xA4, 0xF1, 0x52, 0x4D, 0x3D, 0xBB, 0x69, 0x6B, 0x67, 0x67, 0xE7, 0x77, 0xD8, 0xDB, 0xAD,
+    0x7D, 0x97, 0x98, 0x51, 0x11, 0x75, 0x19, 0x1B, 0x68, 0x7A, 0xF3, 0x56, 0xDC, 0x2E, 0x52, 0xF5,
+    0x79, 0xF7, 0x1F, 0xFF, 0x47, 0x7E, 0x76, 0xB8, 0x53, 0x2A, 0x09, 0x70, 0x67, 0xF7, 0x6D, 0xF9,
+    0xC9, 0x83, 0xDE, 0x3E, 0x5E, 0xFE, 0xFC, 0xDA, 0x6B, 0xFD, 0x1B, 0xD1, 0xC9, 0x8B, 0x92, 0xCF,
+    0xEF, 0xDF, 0xB3, 0x75, 0x0E, 0xD0, 0xAF, 0xA4, 0xED, 0xEA, 0xAB, 0x32, 0x56, 0x12, 0x1E, 0xBC,
+    0x50, 0xCD, 0xF5, 0xB4, 0x5A, 0xAD, 0x56, 0xCD, 0xD8, 0x0D, 0xEA, 0x82, 0xCD, 0x67, 0xFE, 0xF2,
+    0x1F, 0xFE, 0xEF, 0xDB, 0xF8, 0x8D, 0xCB, 0xCF, 0x59, 0xFD, 0xCD, 0x43, 0xC3, 0xDF, 0xBB, 0xB3,
+    0xDE, 0x43, 0x07, 0x9E, 0xE3, 0xF4, 0x47, 0x9E, 0x40, 0xD1, 0x6F, 0xC6, 0xED, 0xED, 0xF2, 0x47,
+    0xBD, 0x9B, 0x5C, 0x5E, 0xAF, 0xC7, 0x7D, 0xF5, 0xF4, 0x58, 0x49, 0x7A, 0xF0, 0x02, 0x50, 0x4A,
+    0x6C, 0xA4, 0x05, 0xEC, 0xD7, 0xEF, 0xBF, 0xF6, 0xC2, 0x3B, 0x69, 0x18, 0x57, 0x5B, 0x40, 0xF7,
+    0xA6, 0xFC, 0xEB, 0x2B, 0x45, 0x3A, 0xE1, 0xE1, 0x16, 0xB8, 0x95, 0x62, 0x7A, 0x56, 0xC9, 0x8A,
+    0xFF, 0x39, 0xE3, 0x3A, 0x8A, 0x00, 0x3D, 0x44, 0x78, 0x16, 0xEE, 0x85, 0x73, 0x70, 0xFB, 0x22,
+    0xE8, 0xFF, 0x01, 0x9D, 0x9A, 0x5D, 0x8C, 0x1D, 0xC7, 0x95, 0xDF, 0x7F, 0x55, 0x45, 0xB2, 0xD7,
+    0x6C, 0x9B, 0xA5, 0x07, 0x29, 0x88, 0xF5, 0xC1, 0xF6, 0xC3, 0x02, 0xB1, 0xBC, 0x24, 0xCB, 0x0F,
+    0x4A, 0xA2, 0x04, 0x77, 0x6E, 0xB5, 0x2C, 0xC0, 0x06, 0xD6, 0x0F, 0xE4, 0x83, 0x84, 0x20, 0x71,
+    0x16, 0x72, 0x00, 0x23, 0x30, 0x0C, 0x3B, 0xB4, 0x03, 0x05, 0x60, 0x82, 0xCB, 0xE9, 0x92, 0x19,
+    0xC0, 0x58, 0xE8, 0x41, 0x04, 0x56, 0xF6, 0xBE, 0x2C, 0x60, 0x26, 0xA6, 0x01, 0x99, 0x42, 0x56,
+    0xC4, 0x86, 0xC8, 0x4E, 0x90, 0xE1, 0xDC, 0xA2, 0x06, 0x08, 0xB3, 0xAB, 0x07, 0xB6, 0xC4, 0x64,
+    0x1D, 0x44, 0x48, 0xD4, 0x16, 0xB5, 0x6B, 0x58, 0x02, 0x96, 0x25, 0xB1, 0x15, 0x37, 0xC5, 0xBA,
+    0xF7, 0xE4, 0xA1, 0xEF, 0x8C, 0x46, 0x92, 0xED, 0x75, 0xDC, 0x98, 0x8F, 0x8B, 0x46, 0xDD, 0x3A,
+    0xA7, 0x4E, 0x9D, 0xFA, 0x9F, 0x73, 0xFE, 0xA7, 0x00, 0x80, 0xC3, 0x80, 0xE9, 0x80, 0x75, 0xDE,
+    0x7F, 0x14, 0xFB, 0x29, 0x45, 0xE7, 0x42, 0x16, 0xCD, 0x53, 0x62, 0x25, 0xD9, 0xD6, 0xBD, 0xA1,
+    0x3A, 0x60, 0x0A, 0xA0, 0xCE, 0xDF, 0x5D, 0x2E, 0xD6, 0xAA, 0x27, 0x72, 0x59, 0x26, 0xA0, 0xEA,
+    0x3A, 0xFF, 0x6E, 0xDA, 0x6C, 0xDA, 0xBB, 0xEF, 0xAD, 0xEF, 0xE6, 0x28, 0x7F, 0xE3, 0xA3, 0x29,
+    0x02, 0x7C, 0xEA, 0xD3, 0xFB, 0x00, 0x5A, 0xD4, 0x2B, 0x6F, 0xD0, 0x68, 0x91, 0x96, 0xC7, 0x4F,
+    0xC0, 0xE3, 0x35, 0x5E, 0x06, 0xD3, 0xAA, 0xAD, 0x23, 0x70, 0x64, 0xEF, 0xD7, 0x1E, 0xD6, 0x22,
+    0xB2, 0xB0, 0x22, 0xD2, 0x03, 0x0F, 0xEF, 0xBC, 0xDE, 0x04, 0x93, 0xC0, 0xB6, 0x7B, 0x86, 0xCE,
+    0x25, 0x5A, 0xE9, 0xD5, 0xBB, 0x35, 0x6E, 0x5C, 0xDE, 0xFA, 0xE3, 0x94, 0xD2, 0x21, 0x19, 0x1B,
+    0x50, 0x3D, 0xF8, 0x0B, 0xE7, 0x8C, 0x08, 0x8D, 0xA4, 0x52, 0x04, 0x00, 0x2B, 0xD2, 0x8A, 0xC8,
+    0x53, 0x97, 0x41, 0x27, 0xB0, 0x01, 0x4E, 0x83, 0x96, 0x01, 0x2B, 0x03, 0xFE, 0xD1, 0xA4, 0xFA,
+    0x22, 0x96, 0xD1, 0x31, 0x55, 0x03, 0x43, 0x13, 0x8B, 0x97, 0x17, 0xFC, 0xAD, 0xFD, 0x35, 0xA0,
+    0x80, 0x04, 0x47, 0xA1, 0x88, 0x7B, 0x94, 0x28, 0x25, 0x23, 0x12, 0xAB, 0x1A, 0x9D, 0xC0, 0x8F,
+    0x6A, 0xAE, 0x43, 0xD9, 0x42, 0x86, 0x2A, 0xA2, 0x07, 0xF0, 0x35, 0x26, 0x01, 0x07, 0x96, 0x20,
+    0x82, 0x6D, 0xD7, 0xC9, 0x6C, 0x96, 0x91, 0x13, 0x5E, 0x92, 0x12, 0x09, 0x65, 0x04, 0x0F, 0x2C,
+    0x95, 0x18, 0x91, 0xBE, 0x14, 0x89, 0x56, 0x32, 0xA5, 0xD4, 0x2B, 0x39, 0xF7, 0x40, 0x25, 0x51,
+    0x4B, 0xA6, 0x6A, 0xEF, 0xDA, 0x35, 0xC7, 0x6D, 0x70, 0x12, 0xA8, 0x24, 0xA2, 0xA4, 0x86, 0xA5,
+    0xEA, 0x8A, 0xBE, 0x12, 0x89, 0x22, 0x03, 0xF3, 0x25, 0x90, 0xC9, 0xAA, 0xD7, 0xC9, 0x24, 0xD3,
+    0x15, 0x6D, 0x19, 0x6D, 0xB4, 0xC1, 0x05, 0x5F, 0x37, 0x34, 0xD0, 0xF7, 0xC5, 0xD5, 0xE8, 0xFD,
+    0xEE, 0x5A, 0x6C, 0xC4, 0xA3, 0x7A, 0xCA, 0x88, 0x87, 0x81, 0xA2, 0xC5, 0x41, 0xC6, 0x74, 0xB8,
+    0xC0, 0x82, 0x22, 0x51, 0x45, 0x40, 0x0D, 0x60, 0x47, 0x85, 0x75, 0x3F, 0x7E, 0x5C, 0xFF, 0xC0,
+    0x47, 0x93, 0xC6, 0x8F, 0x97, 0xC1, 0x24, 0xEE, 0x72, 0x41, 0x49, 0xC6, 0x4A, 0x47, 0xB3, 0x84,
+    0x7B, 0x6A, 0xC0, 0x4A, 0x87, 0x92, 0x25, 0x38, 0x13, 0xD1, 0xED, 0x04, 0x26, 0x45, 0xC4, 0xC4,
+    0x0D, 0xD8, 0xB0, 0x52, 0xDB, 0x5A, 0x16, 0x2A, 0x55, 0xA6, 0x3B, 0xA6, 0xBB, 0xA9, 0x69, 0xA7,
+    0x27, 0xAF, 0x64, 0x23, 0x83, 0x0F, 0xF3, 0x85, 0x3E, 0xBB, 0xEB, 0xBF, 0xDD, 0x7E, 0xD8, 0x30,
+    0x91, 0x35, 0x12, 0x15, 0xA7, 0x28, 0xE3, 0x51, 0x8C, 0xC8, 0xCF, 0x10, 0x91, 0x34, 0xD3, 0xEF,
+    0x5E, 0x3E, 0xC6, 0x25, 0x7B, 0xBC, 0x9E, 0x14, 0xDB, 0xB1, 0xFA, 0xD2, 0xDB, 0xA9, 0x94, 0x7E,
+    0xC3, 0x48, 0x77, 0xF7, 0xEA, 0xEB, 0x46, 0x24, 0x37, 0x22, 0x2F, 0x89, 0x0C, 0x78, 0x28, 0x3A,
+    0x58, 0x80, 0x6D, 0x51, 0xB2, 0xC4, 0x49, 0x6F, 0x16, 0x36, 0x78, 0xFA, 0x22, 0xD9, 0x7A, 0x4B,
+    0x27, 0xDB, 0x7A, 0x95, 0x4D, 0x07, 0xDC, 0x05, 0x26, 0xC2, 0x04, 0x74, 0x37, 0xBA, 0xA6, 0x8B,
+    0xE6, 0xED, 0x4C, 0x75, 0x3C, 0x92, 0x17, 0x98, 0x9B, 0x2D, 0x6E, 0x01, 0xD2, 0x51, 0x2C, 0xC1,
+    0x0D, 0x20, 0x3D, 0x85, 0xF4, 0xF8, 0x93, 0x89, 0xEC, 0x53, 0xD9, 0xCD, 0xD3, 0x68, 0x2C, 0xDD,
+    0x83, 0xE9, 0x01, 0xC8, 0x3C, 0x66, 0x3A, 0xDB, 0x55, 0xF5, 0xBC, 0xDE, 0x2C, 0xB2, 0x49, 0x4D,
+    0xB2, 0x67, 0x24, 0x6C, 0xFA, 0x85, 0xB9, 0xF5, 0xF3, 0x64, 0x5F, 0x38, 0x19, 0x9B, 0x7E, 0xA9,
+    0xE5, 0x3B, 0xBD, 0xCD, 0x3E, 0x36, 0x51, 0xF4, 0xA2, 0xEC, 0x61, 0x3F, 0x35, 0xEF, 0x5D, 0xC6,
+    0x4A, 0xC0, 0xED, 0x3D, 0x17, 0xF7, 0x70, 0xB7, 0x4A, 0x45, 0xB4, 0x61, 0x20, 0x3B, 0xEC, 0x76,
+    0xCB, 0xD6, 0x26, 0x85, 0x80, 0xEF, 0x30, 0x19, 0x5C, 0xC0, 0x24, 0x58, 0x60, 0x24, 0xE2, 0x13,
+    0xC5, 0x1B, 0xAB, 0xED, 0xAF, 0xBD, 0x4E, 0xA6, 0xF3, 0x9C, 0x36, 0x5D, 0x19, 0x4F, 0x33, 0x94,
+    0xD1, 0xD6, 0x59, 0x25, 0x1B, 0x9C, 0xEA, 0x4D, 0xE7, 0x38, 0x6D, 0x44, 0xA2, 0x97, 0xAC, 0x5F,
+    0x78, 0xB3, 0xA6, 0x07, 0x0B, 0x9C, 0x03, 0x8A, 0x88, 0x49, 0x90, 0x3F, 0x0C, 0x01, 0xAE, 0x55,
+    0xCB, 0xBE, 0xF8, 0xC9, 0x29, 0x2B, 0x43, 0x75, 0xE1, 0x59, 0xC7, 0x5D, 0x4E, 0x92, 0x95, 0x4E,
+    0x4B, 0xCD, 0x1A, 0x9C, 0x3E, 0x51, 0x48, 0x57, 0x2E, 0x6B, 0x95, 0xD0, 0x77, 0x7A, 0x23, 0xB9,
+    0xE8, 0x67, 0x36, 0x4E, 0x6C, 0x98, 0xB9, 0x7A, 0xF0, 0xAA, 0xF7, 0x26, 0x6D, 0xFD, 0x4E, 0xC2,
+    0x27, 0x9A, 0xC4, 0x7D, 0x01, 0x80, 0x84, 0x8E, 0x94, 0x81, 0xFD, 0x68, 0x59, 0x18, 0xC9, 0xA6,
+    0xA3, 0x68, 0x29, 0x23, 0x36, 0x62, 0x23, 0x2E, 0xE0, 0x6B, 0x56, 0x0E, 0x3D, 0xAF, 0xA7, 0x97,
+    0x6D, 0xFD, 0x93, 0x77, 0x6B, 0xB7, 0x30, 0x91, 0xB5, 0x03, 0x67, 0x64, 0x70, 0xC2, 0x1F, 0xD7,
+    0x80, 0x92, 0x50, 0x3D, 0xCF, 0x25, 0xD4, 0x7B, 0x30, 0x0F, 0x78, 0x73, 0x27, 0x7B, 0x69, 0x4F,
+    0x0E, 0x00, 0x1C, 0xA4, 0x8C, 0x26, 0xE9, 0xBC, 0x42, 0x4E, 0x5B, 0x9B, 0xA8, 0x12, 0x1B, 0xAC,
+    0x51, 0x61, 0xA3, 0x49, 0x14, 0x57, 0x63, 0xCE, 0xD5, 0xF7, 0xC3, 0x6A, 0x80, 0x69, 0x99, 0x50,
+    0x44, 0x36, 0xB0, 0xB5, 0x4A, 0xF8, 0xF1, 0xA4, 0x7F, 0x05, 0xD3, 0x51, 0xAD, 0x4E, 0xEF, 0x7E,
+    0x98, 0xA1, 0x3B, 0x6C, 0xCD, 0x64, 0xF7, 0xBF, 0xEA, 0xB0, 0x35, 0x33, 0xEE, 0xEB, 0x90, 0xDA,
+    0x8C, 0xB2, 0x1F, 0x0F, 0xF8, 0x9E, 0xFB, 0xEF, 0xA7, 0x3C, 0x88, 0x39, 0xB3, 0xA0, 0xFD, 0x69,
+    0xBC, 0x78, 0xF1, 0xE2, 0xC3, 0xD3, 0x61, 0x62, 0x87, 0x8F, 0x01, 0xA6, 0xAE, 0x4B, 0x1D, 0xAC,
+    0xA9, 0xED, 0x13, 0x75, 0x25, 0xF9, 0x88, 0xFD, 0x17, 0x0F, 0x7F, 0xE2, 0xF0, 0x43, 0x87, 0x37,
+    0xBF, 0xE9, 0x7A, 0xE0, 0xD7, 0xB5, 0xAA, 0x49, 0xB0, 0x1F, 0x4C, 0xC0, 0xC4, 0x95, 0x17, 0x57,
+    0x0E, 0x7B, 0x92, 0xE2, 0x26, 0x5A, 0x40, 0x60, 0x5E, 0xE3, 0x7B, 0x5C, 0x13, 0xEC, 0x17, 0x87,
+    0x11, 0xF1, 0xF2, 0x78, 0xA4, 0x77, 0x9E, 0x63, 0xAA, 0xB7, 0x8F, 0x64, 0x73, 0x45, 0xD4, 0xDB,
+    0x12, 0x36, 0xEE, 0xB4, 0xD3, 0xDC, 0x57, 0x79, 0x56, 0x66, 0x6F, 0xB2, 0x0D, 0xB9, 0x58, 0xF9,
+    0x63, 0x77, 0x14, 0x24, 0xC3, 0x3C, 0xAD, 0xCE, 0xFD, 0x07, 0x9F, 0x41, 0x27, 0x72, 0x11, 0xD9,
+    0xB4, 0x81, 0x75, 0x07, 0x7E, 0x0D, 0x7C, 0x06, 0x97, 0xA0, 0xEA, 0x46, 0x81, 0x55, 0x0D, 0x0D,
+    0xB8, 0x0C, 0xBE, 0x07, 0x3F, 0x9A, 0xDD, 0xEA, 0xF6, 0x61, 0xAB, 0xDB, 0x89, 0x55, 0xDD, 0xA4,
+    0x7C, 0xA4, 0x9B, 0x94, 0x75, 0xF2, 0x12, 0x24, 0x73, 0x04, 0x12, 0x0A, 0x80, 0x29, 0x73, 0xB9,
+    0x26, 0x43, 0x19, 0x18, 0xA8, 0xE4, 0x73, 0x92, 0xBD, 0xBE, 0xDE, 0xAD, 0x79, 0xD9, 0x96, 0xC1,
+    0x0B, 0x5F, 0xAB, 0x39, 0x41, 0x19, 0x58, 0x43, 0xF5, 0xCC, 0xA5, 0x9E, 0x82, 0x9C, 0x2B, 0x24,
+    0xB9, 0xCF, 0x75, 0xB9, 0x7C, 0xF4, 0xBD, 0x6C, 0x25, 0x79, 0xA9, 0x3F, 0x73, 0x1E, 0xEE, 0xBD,
+    0x70, 0xE1, 0xAC, 0x11, 0x59, 0xE2, 0x45, 0x5A, 0xBD, 0x28, 0x7B, 0xEC, 0xAD, 0x0C, 0x7E, 0x09,
+    0xA5, 0xB4, 0x18, 0x11, 0xC8, 0x43, 0x8F, 0xAF, 0x8E, 0x87, 0xE2, 0x95, 0x94, 0xC9, 0xDE, 0x46,
+    0xFF, 0xC5, 0x2E, 0xEF, 0x8D, 0x54, 0x5E, 0x52, 0x71, 0xBD, 0x63, 0xDE, 0xD2, 0x24, 0xD6, 0x5F,
+    0x63, 0xF2, 0x4E, 0x3C, 0xFA, 0xF0, 0xC5, 0xEA, 0xE8, 0xDA, 0x38, 0xA2, 0xA9, 0xCF, 0x51, 0xC8,
+    0x17, 0x3A, 0xFC, 0xDC, 0xA3, 0x86, 0x79, 0xA6, 0x6C, 0x25, 0xE2, 0x6E, 0x3F, 0x87, 0x91, 0x0C,
+    0xFE, 0xAD, 0x01, 0x9D, 0x4D, 0xA2, 0x8A, 0x36, 0xB2, 0x85, 0xC7, 0x24, 0x95, 0xB1, 0xD1, 0xB6,
+    0x34, 0xDF, 0x15, 0x10, 0xE9, 0x31, 0x22, 0x81, 0x42, 0x06, 0xD0, 0x4B, 0x80, 0xA2, 0xEB, 0x69,
+    0x6E, 0x44, 0x73, 0x43, 0xB0, 0x5F, 0x48, 0xCC, 0x5B, 0xAC, 0x74, 0x6C, 0x95, 0xD1, 0xB4, 0x15,
+    0x15, 0x03, 0x97, 0x4F, 0xB6, 0x4A, 0x96, 0x18, 0x49, 0xE8, 0xDB, 0xEF, 0x1F, 0xDB, 0x08, 0xFE,
+    0x46, 0xC2, 0xA5, 0x4C, 0x15, 0x7D, 0x6D, 0xA3, 0x6D, 0x6D, 0x67, 0x86, 0x32, 0xB1, 0x55, 0xF4,
+    0xB8, 0xED, 0x81, 0xF2, 0x9D, 0x8C, 0x5E, 0x2E, 0x60, 0x2E, 0x50, 0x49, 0x4D, 0x21, 0x01, 0x25,
+    0x11, 0x9A, 0x71, 0xE7, 0x3F, 0x06, 0x97, 0x4F, 0xA9, 0x76, 0x66, 0xE2, 0xCC, 0x32, 0x9B, 0x32,
+    0xDB, 0x64, 0xDA, 0xE3, 0x3B, 0x7C, 0xC4, 0xD7, 0xF0, 0x69, 0x66, 0x5F, 0x1B, 0xA4, 0x27, 0xA9,
+    0x04, 0xAA, 0x83, 0xB5, 0x31, 0x9C, 0x67, 0xD5, 0x83, 0x1B, 0x23, 0xC8, 0x0A, 0x95, 0x2F, 0x83,
+    0x8D, 0xA8, 0x15, 0x70, 0xF5, 0xB0, 0x1B, 0xB0, 0x8A, 0x88, 0x4E, 0xA5, 0x0C, 0x46, 0x16, 0x0C,
+    0x70, 0x1A, 0x1C, 0xD8, 0x88, 0x49, 0xE8, 0x01, 0x16, 0x7B, 0x86, 0x7E, 0x28, 0x50, 0x6B, 0x91,
+    0xCE, 0x4B, 0xFE, 0x05, 0x81, 0x7A, 0x14, 0xA1, 0x2E, 0x04, 0xBF, 0x30, 0x41, 0x4B, 0x5F, 0x7D,
+    0x97, 0x44, 0x85, 0xEE, 0xD8, 0xD9, 0x29, 0xE9, 0x9C, 0xF4, 0x65, 0xC4, 0x74, 0xD0, 0x8F, 0x52,
+    0x25, 0x58, 0xE9, 0x8B, 0xDE, 0xEB, 0xBE, 0x8C, 0x59, 0x77, 0x53, 0xD5, 0x57, 0x5F, 0xC8, 0xE5,
+    0x8B, 0x59, 0x7D, 0xF9, 0x31, 0x0A, 0x31, 0xFF, 0xA3, 0xEE, 0xF8, 0x57, 0xB8, 0xDE, 0x1E, 0x37,
+    0x67, 0xAE, 0xFC, 0xD7, 0xF6, 0x4F, 0x3A, 0x80, 0x32, 0x49, 0xB7, 0xA0, 0x48, 0x72, 0x7D, 0xC0,
+    0xF4, 0xF2, 0x52, 0x87, 0x5E, 0xC8, 0x0B, 0x11, 0x96, 0x32, 0x07, 0x44, 0x32, 0x30, 0x97, 0x04,
+    0x78, 0x69, 0x47, 0x27, 0x02, 0x23, 0x92, 0xA0, 0x12, 0xC9, 0x30, 0xBF, 0x76, 0x6B, 0x49, 0x21,
+    0xF6, 0x75, 0x09, 0x2E, 0x57, 0xAD, 0x74, 0x2B, 0x9B, 0x00, 0x65, 0x18, 0x91, 0x8C, 0x49, 0x73,
+    0xBC, 0xB6, 0xDF, 0xBF, 0x56, 0xAB, 0x3B, 0x6F, 0x05, 0xBC, 0x04, 0xAC, 0x44, 0xB4, 0x44, 0xB4,
+    0x64, 0xCA, 0xB7, 0x5E, 0x8B, 0xD5, 0xF5, 0x1B, 0x19, 0x38, 0x04, 0x98, 0x9A, 0xF9, 0xD9, 0x42,
+    0xE2, 0x3E, 0x5B, 0xB3, 0x86, 0x4E, 0x46, 0xEA, 0xAA, 0x87, 0x84, 0x69, 0x43, 0x63, 0x64, 0xA8,
+    0x24, 0xBA, 0x81, 0x63, 0xD0, 0xA3, 0x6A, 0xD4, 0x82, 0xEF, 0x45, 0x2E, 0xAA, 0x4B, 0x26, 0x53,
+    0xF2, 0x87, 0x71, 0x9E, 0x5C, 0x62, 0x82, 0x0B, 0x87, 0x3A, 0xD3, 0x41, 0xF5, 0x85, 0x44, 0xF6,
+    0xB5, 0xB9, 0xD1, 0xE3, 0x7C, 0xCD, 0x72, 0xA0, 0x90, 0x80, 0xCB, 0x20, 0x71, 0x0C, 0x46, 0x4B,
+    0x90, 0x25, 0xE5, 0xAB, 0x0B, 0xBC, 0x5D, 0xA8, 0x5C, 0x2D, 0x3B, 0x28, 0x6B, 0x98, 0x00, 0x27,
+    0x78, 0x3B, 0x15, 0xDF, 0xE7, 0x58, 0x42, 0x28, 0x12, 0x3E, 0x2A, 0x09, 0x65, 0x13, 0x26, 0xFE,
+    0x3C, 0xB4, 0x68, 0xB8, 0x9B, 0xFD, 0x75, 0x11, 0xF5, 0xC0, 0xC0, 0x16, 0xB6, 0x76, 0x51, 0xFD,
+    0xFC, 0x8B, 0x09, 0xFF, 0x9F, 0x32, 0xE6, 0xA6, 0xC0, 0x5C, 0x5A, 0xAC, 0x2C, 0x51, 0xB7, 0x6F,
+    0xF6, 0xB8, 0x6F, 0x34, 0xAD, 0x49, 0x46, 0x58, 0xC7, 0xE6, 0x03, 0x67, 0xF9, 0xDA, 0x59, 0x80,
+    0x8B, 0x65, 0x98, 0x94, 0xE1, 0xF0, 0x4B, 0xD1, 0xFE, 0x97, 0x68, 0x24, 0xEA, 0xD7, 0x06, 0x6E,
+    0x9D, 0x0C, 0xA7, 0xCC, 0x00, 0xAE, 0x4C, 0x46, 0x1A, 0xCA, 0x9F, 0x26, 0xBC, 0xAF, 0xB9, 0xD3,
+    0x53, 0x4A, 0xC0, 0x0F, 0x28, 0x09, 0x94, 0x4B, 0xF0, 0x0B, 0x94, 0x2C, 0xB0, 0xAF, 0x66, 0xBC,
+    0xCD, 0x7A, 0x70, 0x19, 0x26, 0x78, 0xE1, 0x85, 0xF3, 0x4C, 0xD0, 0x09, 0xFB, 0xBB, 0xF5, 0xDA,
+    0xA0, 0x25, 0xD8, 0x1E, 0x1F, 0xB5, 0x44, 0x2B, 0x71, 0xBD, 0x79, 0xB1, 0x97, 0xE0, 0xA5, 0x4C,
+    0x92, 0x1B, 0x8A, 0xEB, 0x09, 0xF7, 0xEB, 0xCE, 0xED, 0x6F, 0xBC, 0x3C, 0xEB, 0xCD, 0x1F, 0x33,
+    0x0F, 0xB6, 0x53, 0x0B, 0x7C, 0x32, 0xAF, 0xC5, 0x8D, 0x39, 0x78, 0x3C, 0x55, 0xB0, 0xB1, 0x6C,
+    0x8B, 0xCE, 0x24, 0xDD, 0xAB, 0x4C, 0x66, 0x8B, 0x06, 0x5F, 0xBB, 0x60, 0xDF, 0x7C, 0xA1, 0x2D,
+    0x44, 0x92, 0x11, 0xC9, 0x88, 0x08, 0x0D, 0x3E, 0xB8, 0x58, 0xFD, 0xCC, 0x26, 0x2B, 0xF5, 0x98,
+    0xC4, 0xA8, 0x34, 0xA6, 0xEA, 0xED, 0xC4, 0xC4, 0x59, 0x11, 0x37, 0xCA, 0xD0, 0xDB, 0xEF, 0xA5,
+    0x4A, 0x92, 0x93, 0x6E, 0x5A, 0xB4, 0x6B, 0xE5, 0x00, 0x0F, 0xC1, 0xA7, 0xD8, 0xA4, 0x91, 0xCE,
+    0xC6, 0x52, 0x16, 0x6A, 0x20, 0x83, 0xAB, 0xAB, 0x88, 0x49, 0x7A, 0x00, 0x8F, 0xAF, 0x29, 0xBB,
+    0x22, 0x81, 0x5C, 0x10, 0xB0, 0x22, 0x1D, 0x4A, 0x64, 0x01, 0x4E, 0x24, 0x62, 0x06, 0x93, 0xA1,
+    0xA9, 0x7D, 0xA0, 0x4C, 0x45, 0x0F, 0x26, 0x36, 0xB9, 0x08, 0xFF, 0xF9, 0xB1, 0xB2, 0x4E, 0x58,
+    0x95, 0xA8, 0x74, 0x87, 0x93, 0x16, 0x2F, 0x91, 0xF5, 0x27, 0xC6, 0x60, 0xB0, 0x03, 0x9B, 0x19,
+    0x44, 0x06, 0x58, 0x3E, 0xDF, 0xA3, 0xFA, 0xB2, 0x47, 0x27, 0x9B, 0x30, 0xC9, 0x26, 0x4C, 0x57,
+    0x49, 0x2A, 0x5A, 0x27, 0xB9, 0x8C, 0xBE, 0x3B, 0x6D, 0xA3, 0x8F, 0x6B, 0x36, 0x34, 0xF5, 0xA4,
+    0xAA, 0xE7, 0x6C, 0xBA, 0x5A, 0x6C, 0xEF, 0x59, 0xDA, 0xEE, 0x1E, 0xFE, 0xF1, 0xFE, 0x11, 0x2D,
+    0x64, 0x49, 0xF9, 0xD6, 0x02, 0xFB, 0x54, 0xA6, 0xFA, 0x5C, 0xC6, 0x99, 0x01, 0x6F, 0x7A, 0xA6,
+    0x45, 0xE2, 0x74, 0x29, 0xED, 0xA6, 0x95, 0x9E, 0xEA, 0xE5, 0x01, 0x57, 0x6F, 0xE2, 0xD9, 0x60,
+    0xAA, 0x7A, 0x4E, 0xBB, 0xC4, 0xA6, 0x8B, 0x7C, 0x75, 0x27, 0x6D, 0xBC, 0x17, 0xA8, 0x12, 0xD8,
+    0xE5, 0xBC, 0x33, 0x32, 0x97, 0x30, 0x2F, 0xDA, 0x0D, 0x1B, 0x7B, 0xFB, 0xB9, 0xFE, 0x98, 0x4E,
+    0xDE, 0xB4, 0x97, 0x4D, 0x9A, 0x36, 0xAD, 0x3F, 0x23, 0x4B, 0x2D, 0x22, 0xC9, 0x8A, 0xF4, 0xDC,
+    0xB7, 0x4A, 0x5A, 0x75, 0x87, 0x5E, 0x34, 0xF5, 0x56, 0xB3, 0x59, 0xD9, 0x47, 0xB7, 0xAF, 0x74,
+    0x1B, 0x93, 0x35, 0x5F, 0x5C, 0x97, 0xE4, 0x45, 0x1E, 0x11, 0x39, 0xCB, 0x89, 0x9D, 0xD4, 0x76,
+    0xDE, 0x31, 0x97, 0x50, 0x4A, 0x66, 0x7E, 0xF6, 0xAE, 0xA2, 0x07, 0x5F, 0xA3, 0x33, 0xD8, 0x0E,
+    0x7C, 0x40, 0x49, 0xFD, 0x65, 0x23, 0x12, 0xAD, 0x2C, 0xA9, 0xA4, 0xA7, 0x92, 0x96, 0x93, 0x23,
+    0x68, 0x02, 0x7A, 0xA1, 0xA4, 0x5D, 0xDF, 0x67, 0x6B, 0x95, 0x70, 0xE8, 0xF7, 0xDA, 0x4A, 0xD4,
+    0xBC, 0x73, 0x41, 0x9F, 0xC5, 0x8B, 0x5C, 0x15, 0xC9, 0x73, 0x91, 0x60, 0x76, 0xA1, 0x95, 0x0C,
+    0x55, 0x40, 0x8F, 0xD0, 0x5A, 0x24, 0xD8, 0x02, 0xFB, 0x17, 0xA8, 0x45, 0x02, 0x0B, 0xBA, 0xC3,
+    0xC9, 0x0D, 0x59, 0x90, 0x38, 0x8C, 0x7E, 0x3F, 0xDB, 0x79, 0x92, 0x02, 0x4E, 0x90, 0xF1, 0xAE,
+    0x76, 0x5F, 0xE8, 0xAA, 0xA7, 0xB2, 0x8D, 0xDE, 0x46, 0xFB, 0x5A, 0xAB, 0xA5, 0xA3, 0x49, 0x54,
+    0x09, 0xD3, 0xA3, 0x32, 0xCC, 0xC1, 0x07, 0xAA, 0x16, 0xA6, 0xAA, 0xCF, 0xF6, 0x4C, 0xDA, 0xB4,
+    0xDB, 0xAD, 0xF3, 0x6C, 0x25, 0x2D, 0xA1, 0xC8, 0x54, 0x2D, 0x0D, 0x7A, 0x18, 0x2B, 0x10, 0x6C,
+    0x34, 0xC9, 0xD5, 0x2E, 0xAC, 0xAB, 0xAC, 0xB2, 0x8D, 0x26, 0x2D, 0xB0, 0xAF, 0x76, 0x38, 0x81,
+    0x79, 0xC2, 0x4B, 0xD6, 0x22, 0x09, 0x1B, 0x61, 0x0E, 0x66, 0x80, 0xAA, 0x05, 0x4E, 0xA8, 0xDA,
+    0x86, 0x4D, 0xB2, 0x0D, 0x76, 0x3B, 0xB1, 0x79, 0x9A, 0xF2, 0x5A, 0x60, 0x9E, 0x28, 0x16, 0xD0,
+    0x04, 0x23, 0xD2, 0x7A, 0xC9, 0x3B, 0x70, 0x7F, 0x30, 0xC0, 0x69, 0x1C, 0x36, 0x56, 0xB5, 0xE9,
+    0xAB, 0x9A, 0xF5, 0x2A, 0x60, 0x5F, 0x0B, 0x18, 0x89, 0x30, 0x8F, 0xE3, 0x9C, 0x55, 0x1E, 0xA3,
+    0x5B, 0x75, 0xB3, 0xA3, 0xBA, 0x9E, 0xA9, 0xBA, 0x26, 0x54, 0x9D, 0x4D, 0xA0, 0xDB, 0xB1, 0x1C,
+    0xE4, 0x6E, 0x20, 0x1D, 0xE6, 0xE8, 0x61, 0x8A, 0xFF, 0x03, 0x02, 0x1E, 0x5C, 0x8B, 0x1B, 0x70,
+    0x0E, 0x67, 0x3A, 0xE8, 0xE0, 0x53, 0x2B, 0xFF, 0x5B, 0x9B, 0xCB, 0xF5, 0x58, 0xD5, 0x9B, 0x3A,
+    0xD9, 0x30, 0xA5, 0x37, 0x6D, 0xC5, 0x4C, 0x77, 0x36, 0xAE, 0x31, 0x98, 0x58, 0x89, 0xBC, 0x28,
+    0x32, 0x78, 0x91, 0xF7, 0x6B, 0xC9, 0xCE, 0x2F, 0x2E, 0xBE, 0xF0, 0x83, 0x30, 0xF9, 0x84, 0xEA,
+    0xBE, 0x59, 0xEA, 0x38, 0x39, 0x44, 0x3A, 0x55, 0xC8, 0xE0, 0xA5, 0xC5, 0x8E, 0x48, 0x79, 0x0F,
+    0xE7, 0x37, 0xCD, 0x8D, 0x54, 0x1D, 0xAF, 0x37, 0x27, 0xE6, 0xED, 0x64, 0xBF, 0x73, 0x65, 0x51,
+    0x49, 0x72, 0x12, 0x99, 0xA2, 0x12, 0x65, 0xC4, 0xD7, 0x08, 0xC5, 0x80, 0x69, 0xA9, 0xF8, 0xF4,
+    0xC7, 0x26, 0x87, 0x9F, 0x3C, 0x72, 0x71, 0x72, 0x71, 0xA3, 0xE9, 0xEF, 0x49, 0x24, 0x3A, 0xD5,
+    0xAB, 0x44, 0x52, 0xF5, 0xDD, 0x87, 0x55, 0x77, 0xA9, 0x7C, 0x34, 0x4E, 0x1E, 0xF8, 0x77, 0xE9,
+    0x3F, 0x5E, 0x3B, 0x73, 0x73, 0x61, 0x25, 0x55, 0x12, 0xAB, 0x27, 0x78, 0x72, 0x43, 0x9D, 0x69,
+    0xB1, 0xEC, 0xDB, 0x77, 0xFF, 0xFD, 0x0F, 0x3D, 0xFC, 0xF7, 0x1E, 0x6A, 0x52, 0x93, 0xA6, 0xE7,
+    0x3E, 0xDD, 0xA9, 0x96, 0x09, 0x6C, 0xC2, 0x00, 0x3D, 0x2A, 0xA1, 0x13, 0x46, 0xFA, 0x42, 0x72,
+    0x99, 0x26, 0x63, 0xCE, 0x59, 0x91, 0x3D, 0x83, 0xD7, 0x3B, 0xD9, 0xE9, 0xEC, 0xFD, 0xC1, 0xE6,
+    0x4E, 0x6F, 0x24, 0x97, 0x1F, 0xCC, 0x4E, 0x1B, 0x93, 0xB6, 0x4C, 0xFA, 0x07, 0xA8, 0xAD, 0x47,
+    0x06, 0x9C, 0x9C, 0x59, 0x3E, 0x7A, 0xDB, 0x15, 0x22, 0x57, 0x4E, 0x73, 0x52, 0xA4, 0xC7, 0x8A,
+    0xB4, 0xF8, 0x37, 0xBF, 0x8B, 0x1A, 0x80, 0x62, 0x50, 0x67, 0xA9, 0x44, 0x6A, 0xBC, 0x64, 0x70,
+    0xD2, 0xC1, 0xFE, 0x13, 0x5C, 0x54, 0x5B, 0xE5, 0xD9, 0xF5, 0x0D, 0x27, 0xFF, 0x28, 0xDE, 0x27,
+    0x99, 0xE6, 0xCD, 0xBA, 0x0C, 0x30, 0x7F, 0x1E, 0x23, 0x89, 0xF2, 0x36, 0xFF, 0x7A, 0x9C, 0xDD,
+    0xCB, 0xA3, 0xAB, 0xD9, 0x9F, 0x3A, 0xAD, 0x5E, 0xD8, 0x9D, 0xBD, 0x79, 0xEF, 0x87, 0xE8, 0x1E,
+    0x28, 0xFB, 0x71, 0x76, 0xF0, 0x92, 0x51, 0x4E, 0x5A, 0x26, 0xFB, 0x4F, 0x8C, 0x9B, 0x5E, 0x04,
+    0xE0, 0x2E, 0xEE, 0x21, 0x15, 0x62, 0x96, 0x97, 0x1F, 0x50, 0xF2, 0xDE, 0x80, 0x93, 0x8E, 0xAD,
+    0x1F, 0x62, 0x5A, 0xB0, 0x6F, 0x26, 0x2A, 0x09, 0xEA, 0x89, 0x81, 0x43, 0xC0, 0x43, 0x7F, 0x43,
+    0x1D, 0xBE, 0x53, 0x91, 0xC6, 0x4B, 0x80, 0x91, 0x04, 0x68, 0x89, 0xAB, 0xAA, 0xFF, 0x97, 0x3E,
+    0x65, 0x92, 0x97, 0x33, 0x45, 0x92, 0xED, 0x1E, 0xD3, 0xCB, 0x33, 0x2D, 0x7A, 0x21, 0x4D, 0x80,
+    0xA5, 0x6C, 0x7D, 0x24, 0x81, 0x88, 0x1F, 0x49, 0x20, 0x06, 0x98, 0x5F, 0xFB, 0xE9, 0x92, 0x42,
+    0xEC, 0x75, 0xA9, 0x5D, 0xAE, 0xAE, 0x48, 0x04, 0xF4, 0x1E, 0x25, 0x94, 0xB4, 0xBF, 0x4C, 0x09,
+    0xDD, 0x4F, 0xCD, 0xCB, 0x03, 0xD9, 0x97, 0x57, 0x13, 0x73, 0x6F, 0xBF, 0x1F, 0xF1, 0x8D, 0x6B,
+    0xC0, 0x8A, 0xCF, 0x50, 0xC8, 0x3C, 0x81, 0x96, 0x95, 0xC4, 0x08, 0x95, 0x48, 0x82, 0xF9, 0xCD,
+    0x3B, 0x99, 0x42, 0xAA, 0x1B, 0x82, 0xCB, 0xEE, 0x8A, 0x44, 0x0E, 0x97, 0xD1, 0xBC, 0xDE, 0xB3,
+    0xB6, 0x4E, 0xF9, 0x5A, 0x40, 0x12, 0x55, 0x46, 0x8F, 0xE9, 0x41, 0xF1, 0xD6, 0xC0, 0xA6, 0x8D,
+    0x36, 0x9E, 0x56, 0x43, 0xD1, 0x7A, 0xC6, 0x0C, 0xD0, 0x27, 0x8A, 0xBC, 0xCB, 0x64, 0xBD, 0x1E,
+    0x1F, 0xB8, 0xA4, 0xFF, 0x1A, 0x1F, 0x8A, 0x84, 0xB4, 0xD6, 0xAA, 0x2E, 0x4D, 0x2C, 0xBA, 0x55,
+    0x03, 0x87, 0xC7, 0xD2, 0xEB, 0xF1, 0x13, 0x78, 0x89, 0x88, 0x50, 0x74, 0x03, 0xAE, 0x6C, 0xC9,
+    0x9E, 0xA2, 0x1D, 0x70, 0x45, 0x4B, 0x76, 0x14, 0x6D, 0xC6, 0x17, 0x5D, 0x31, 0xB8, 0xDE, 0x45,
+    0x09, 0xCF, 0xE9, 0x0C, 0x65, 0x07, 0x0D, 0xE8, 0xF3, 0x70, 0xE1, 0xAC, 0x5D, 0xA8, 0xD7, 0xE3,
+    0xD1, 0x89, 0xB9, 0x1A, 0x26, 0x97, 0xCA, 0xE3, 0xA4, 0x34, 0xAD, 0xAE, 0x7E, 0xBB, 0xA7, 0xC2,
+    0xB4, 0x6C, 0x72, 0x9A, 0xCC, 0xA6, 0x1A, 0xC8, 0xBA, 0x57, 0xD9, 0x24, 0x3D, 0x98, 0x64, 0xFA,
+    0xB2, 0x2B, 0x92, 0x7D, 0xEF, 0x85, 0x64, 0x45, 0xBA, 0x4A, 0xA4, 0x75, 0x22, 0xD1, 0x07, 0x1F,
+    0x9B, 0xDA, 0xB7, 0x73, 0x9A, 0x16, 0x5C, 0xC4, 0x48, 0xC4, 0x48, 0x4D, 0xB1, 0x5C, 0xED, 0xFE,
+    0xA9, 0xC3, 0xBA, 0xBD, 0x64, 0x4D, 0x9C, 0x55, 0xBA, 0x9B, 0xCB, 0xA3, 0xB2, 0xA8, 0xFE, 0x30,
+    0x6D, 0xDA, 0x88, 0xC3, 0xE4, 0x91, 0x78, 0xF9, 0x0D, 0xE4, 0x85, 0x5D, 0x79, 0xF8, 0x00, 0x0D,
+    0xB0, 0x80, 0x55, 0x75, 0x6B, 0xE2, 0xC4, 0xC4, 0x53, 0x45, 0xE8, 0x6D, 0x9D, 0xEC, 0xF7, 0x52,
+    0x25, 0x9D, 0x93, 0x76, 0xAD, 0x88, 0xB3, 0x32, 0x52, 0xB4, 0x94, 0x01, 0x0B, 0x9F, 0x64, 0x7F,
+    0xFD, 0xA0, 0x8D, 0xA7, 0xAB, 0x7A, 0xB3, 0x22, 0x1F, 0x63, 0x38, 0xAA, 0xD3, 0xB4, 0x4C, 0x4E,
+    0x3A, 0x2B, 0xBB, 0xB5, 0x77, 0xC0, 0xD6, 0x34, 0xB0, 0x05, 0x3D, 0x9C, 0x60, 0xDF, 0xBE, 0x8F,
+    0x7F, 0xE2, 0xFE, 0xFB, 0x1F, 0x9A, 0x7C, 0x76, 0xC3, 0xF7, 0xF7, 0x5E, 0x64, 0xA0, 0x27, 0x91,
+    0xA8, 0x99, 0x63, 0x5B, 0x9B, 0x4C, 0x46, 0xEA, 0x79, 0x74, 0x83, 0x1D, 0x8C, 0x9C, 0x91, 0xDA,
+    0xE7, 0x79, 0x2A, 0x6E, 0x5E, 0x13, 0x2E, 0xCB, 0x9D, 0xCE, 0x5E, 0x5B, 0x6E, 0xA9, 0x41, 0xAE,
+    0xB5, 0xEE, 0x99, 0x77, 0xB3, 0xE9, 0xC5, 0xC7, 0xC6, 0x5E, 0x1F, 0xCA, 0xF4, 0xD8, 0xBC, 0x06,
+    0xB5, 0x5C, 0x55, 0x28, 0xA6, 0x67, 0x5C, 0x8E, 0x6D, 0x41, 0x3D, 0x87, 0x49, 0x15, 0xD9, 0xC6,
+    0xC6, 0x76, 0xFE, 0xD5, 0xDE, 0xDE, 0xC9, 0xC5, 0x0B, 0x37, 0xF5, 0xAB, 0x6F, 0x85, 0x77, 0x6E,
+    0xB5, 0xB3, 0x7F, 0x3E, 0xA2, 0xA9, 0xAD, 0x29, 0x03, 0x26, 0xA2, 0xFA, 0x32, 0x7A, 0x86, 0xA2,
+    0x75, 0x64, 0xD3, 0x55, 0xF5, 0xA6, 0x49, 0x36, 0x3C, 0x08, 0xDC, 0xA5, 0xC0, 0x3E, 0x1F, 0x31,
+    0xD2, 0xED, 0x56, 0x32, 0xA3, 0xBB, 0x27, 0x50, 0x19, 0x90, 0x1A, 0xE6, 0x2D, 0xCC, 0x06, 0x98,
+    0x4E, 0xC1, 0xD9, 0x48, 0x75, 0x26, 0x61, 0x63, 0xA6, 0x14, 0xA1, 0x10, 0x69, 0x8D, 0x48, 0x6F,
+    0x06, 0x96, 0x2A, 0xE3, 0xC3, 0x2F, 0x66, 0x69, 0x9A, 0x0D, 0x9C, 0x84, 0xE2, 0x4A, 0x4F, 0xB2,
+    0xF5, 0x51, 0x92, 0x89, 0x0D, 0x5E, 0x92, 0x96, 0x25, 0xE5, 0xCF, 0x5B, 0x60, 0x32, 0x83, 0xCD,
+    0x4D, 0xC8, 0x7B, 0x48, 0x15, 0xB7, 0x5A, 0xB0, 0xD4, 0x68, 0xA9, 0x29, 0xAE, 0x05, 0xEC, 0x33,
+    0x01, 0x67, 0x23, 0xEB, 0x36, 0x92, 0x6D, 0xD4, 0x22, 0xB1, 0x10, 0x69, 0xAD, 0x48, 0xEB, 0x83,
+    0xED, 0x1A, 0x6C, 0x87, 0x7D, 0x3A, 0xEA, 0x3E, 0xE3, 0x9F, 0x88, 0xFA, 0xDF, 0x9F, 0xFF, 0xB5,
+    0x15, 0x50, 0xCF, 0xAF, 0x70, 0x22, 0x80, 0xBC, 0xF9, 0x18, 0x58, 0x01, 0x58, 0x0E, 0x40, 0xF9,
+    0xD2, 0x5F, 0x9E, 0x83, 0xD3, 0x5E, 0x02, 0x45, 0x27, 0x0B, 0xF0, 0x45, 0xDA, 0x39, 0xE7, 0x5E,
+    0xE4, 0x42, 0xD0, 0x22, 0x22, 0xB8, 0xE8, 0x24, 0xAB, 0x8C, 0x48, 0xDA, 0x0B, 0x1D, 0xC5, 0x9D,
+    0x57, 0x3B, 0x2D, 0x22, 0x71, 0x56, 0xF5, 0x5F, 0xB7, 0x88, 0xBC, 0xD2, 0xDA, 0x37, 0xCF, 0x4F,
+    0x8A, 0x1E, 0x23, 0x22, 0xBD, 0x13, 0x11, 0xE6, 0xEB, 0x72, 0x16, 0xD2, 0x0E, 0x7B, 0xD0, 0xC3,
+    0xFE, 0x7A, 0x6F, 0x35, 0x8D, 0x48, 0xAD, 0xDE, 0x1D, 0xE3, 0xA4, 0xE9, 0xA0, 0xF8, 0xCB, 0x13,
+    0x94, 0xD2, 0x61, 0x25, 0x62, 0xC3, 0x48, 0x1A, 0xF8, 0x0B, 0xE7, 0xF0, 0x92, 0x68, 0x24, 0x8D,
+    0x30, 0xA8, 0x76, 0x76, 0x22, 0x7E, 0x90, 0x2F, 0x1B, 0xA9, 0x2A, 0xAA, 0x9B, 0x75, 0xF1, 0x93,
+    0x53, 0x88, 0x84, 0xEA, 0xC2, 0xB3, 0x3A, 0x29, 0x9C, 0x24, 0x64, 0x89, 0x96, 0x1A, 0xF6, 0xD7,
+    0x23, 0x87, 0x27, 0x03, 0x22, 0xFD, 0x81, 0xFA, 0x64, 0x0B, 0xEE, 0x11, 0x91, 0x5C, 0x88, 0x74,
+    0x4E, 0x84, 0x99, 0x1E, 0xE8, 0x4F, 0x46, 0x2D, 0x03, 0x6A, 0x39, 0xEA, 0x7A, 0x40, 0x6A, 0x2F,
+    0x41, 0x44, 0x31, 0xE3, 0x9E, 0x24, 0xB2, 0x2D, 0x0B, 0x6B, 0x3A, 0x27, 0xB8, 0x5D, 0x0E, 0x93,
+    0xCD, 0x4D, 0xCC, 0x8D, 0x8E, 0xEA, 0x85, 0xB0, 0xFB, 0xEA, 0x31, 0x68, 0xA4, 0x36, 0x22, 0xC1,
+    0x8A, 0xD4, 0x5F, 0x39, 0xB0, 0x00, 0xDD, 0x57, 0x22, 0xB1, 0x91, 0xA5, 0x16, 0x49, 0x45, 0x74,
+    0xC1, 0x7E, 0x3E, 0x8F, 0xC4, 0xEF, 0x1B, 0xAB, 0x7C, 0xB1, 0x35, 0x32, 0x18, 0xC9, 0x8A, 0x19,
+    0xFB, 0x67, 0x56, 0xB2, 0x95, 0xDE, 0x9A, 0x54, 0x4A, 0xD4, 0x0B, 0xAA, 0x0A, 0xEF, 0x59, 0xDF,
+    0xCB, 0xFD, 0x63, 0xAE, 0xB7, 0x40, 0xF1, 0xE3, 0x16, 0xB0, 0xD7, 0xE2, 0x2F, 0x8F, 0x32, 0x45,
+    0x9A, 0x77, 0x0B, 0x4C, 0x2F, 0xDB, 0x3D, 0x66, 0x90, 0x97, 0x3A, 0x54, 0x96, 0x93, 0x61, 0xA7,
+    0x4C, 0x9D, 0x4B, 0x06, 0x9A, 0x3D, 0x51, 0xA6, 0x91, 0x08, 0x7A, 0x6F, 0x99, 0xFA, 0xEA, 0x4F,
+    0x97, 0x18, 0x39, 0xFE, 0x8A, 0x84, 0x2A, 0xDB, 0x28, 0xED, 0x87, 0x94, 0x28, 0x5F, 0x8A, 0xBF,
+    0x4C, 0x09, 0x7D, 0xFE, 0x41, 0x7D, 0xF6, 0x39, 0x95, 0xA7, 0xE5, 0x76, 0x62, 0xCB, 0xDB, 0x67,
+    0x22, 0xBE, 0xA9, 0x76, 0xA3, 0x4C, 0x29, 0xCD, 0xAE, 0xDF, 0xFD, 0xEA, 0x28, 0x03, 0x14, 0x57,
+    0xA3, 0xB9, 0x95, 0x58, 0x7C, 0x88, 0xA5, 0x9C, 0x9F, 0xA5, 0xC9, 0xEC, 0xB3, 0x35, 0xA6, 0x45,
+    0x27, 0x7C, 0x4F, 0x35, 0x52, 0x9B, 0xA6, 0xFD, 0xAD, 0x22, 0x19, 0xC9, 0x4A, 0x32, 0x6E, 0x58,
+    0xB1, 0x5E, 0xC7, 0x98, 0x4E, 0xB9, 0x7C, 0x19, 0x50, 0x0B, 0xF4, 0x97, 0xA0, 0x84, 0x6F, 0x60,
+    0x32, 0x1C, 0xE1, 0x63, 0x33, 0xDC, 0x80, 0xEB, 0xC6, 0x3E, 0x43, 0x6C, 0x04, 0x35, 0xE0, 0x82,
+    0xE9, 0x71, 0x2D, 0xF3, 0x16, 0x1B, 0x98, 0xF2, 0x4A, 0x5F, 0x49, 0xF4, 0x0B, 0x5C, 0x58, 0x0D,
+    0xF3, 0x02, 0x19, 0x17, 0xF5, 0x40, 0xD5, 0x32, 0x6F, 0x29, 0x3F, 0x3A, 0x0C, 0x0E, 0xAE, 0x7C,
+    0xFE, 0xF1, 0xD1, 0x70, 0x49, 0x9D, 0xB0, 0xC1, 0x87, 0xD3, 0x7A, 0xA1, 0x53, 0x95, 0xEC, 0x15,
+    0x89, 0x53, 0xBB, 0xD4, 0x49, 0x7A, 0x7B, 0xED, 0xB5, 0x38, 0xBD, 0x3C, 0x57, 0x72, 0x7D, 0x28,
+    0x97, 0x55, 0xEB, 0x93, 0x28, 0x31, 0xB9, 0xEC, 0x47, 0x87, 0xAF, 0x95, 0x2C, 0x56, 0x6C, 0xC2,
+    0x8E, 0x85, 0xBB, 0xAA, 0x5E, 0x2B, 0x92, 0xB9, 0x22, 0xCC, 0x9A, 0xAE, 0x7C, 0xE6, 0x32, 0x77,
+    0x6E, 0xB5, 0x55, 0x9E, 0x69, 0xB1, 0xD1, 0xC7, 0xC1, 0xA4, 0x15, 0x85, 0x69, 0xAE, 0xB7, 0x54,
+    0xD5, 0x2E, 0x1E, 0xFD, 0x46, 0x7C, 0xB5, 0x3D, 0x5E, 0xAF, 0x36, 0x61, 0x7C, 0x36, 0x8A, 0x76,
+    0xAD, 0x48, 0xB6, 0xC8, 0xC5, 0xD5, 0xA5, 0xBE, 0x71, 0xB3, 0xBE, 0x73, 0xAB, 0x6D, 0xDE, 0x4E,
+    0x2E, 0x65, 0x9B, 0xA6, 0xBB, 0x82, 0x67, 0x33, 0x70, 0xEE, 0x43, 0xFE, 0x71, 0xF2, 0x0D, 0x10,
+    0x09, 0xC8, 0x97, 0x7A, 0x16, 0x34, 0x2C, 0xB0, 0x71, 0x8A, 0x49, 0xAE, 0x66, 0xB0, 0x91, 0xCB,
+    0x26, 0xE1, 0xD5, 0x52, 0xCD, 0x43, 0x33, 0x82, 0x61, 0xA7, 0x45, 0x3A, 0xEE, 0x93, 0x95, 0x31,
+    0x7F, 0xD1, 0x81, 0xC0, 0xB5, 0x4A, 0x86, 0xA2, 0xDB, 0xB4, 0xF5, 0xAC, 0x62, 0x70, 0x5F, 0xEA,
+    0x2B, 0xE9, 0xAC, 0x44, 0x7D, 0x1B, 0xD4, 0x57, 0xA0, 0x59, 0x50, 0xCA, 0x82, 0xF9, 0xE7, 0x06,
+    0xD3, 0x9B, 0xE4, 0x42, 0x15, 0x45, 0xA4, 0x10, 0x19, 0xAA, 0x58, 0xC5, 0xF9, 0xF7, 0x44, 0x89,
+    0xF4, 0x46, 0xA4, 0x2E, 0xA4, 0xE7, 0xC0, 0x72, 0xEF, 0x7C, 0xFF, 0x2B, 0x57, 0x92, 0xDD, 0xF7,
+    0xF6, 0xCC, 0xC7, 0xCA, 0xEB, 0xA7, 0x53, 0xF4, 0x7B, 0xA3, 0x67, 0xED, 0x3F, 0x8B, 0x92, 0x1E,
+    0x27, 0xBD, 0x5E, 0x94, 0x9D, 0x6D, 0x6D, 0xDC, 0xA2, 0x31, 0x22, 0xB9, 0x12, 0xE9, 0x1A, 0x1A,
+    0xBD, 0xFC, 0x52, 0x1E, 0x91, 0x7D, 0x41, 0x25, 0x2D, 0xF7, 0x0D, 0x80, 0x73, 0x4C, 0xA7, 0xEF,
+    0xAF, 0xE3, 0x57, 0x4B, 0xB4, 0xCF, 0x84, 0xDD, 0x13, 0xAF, 0xFF, 0x6F, 0xFA, 0xE5, 0x27, 0xFE,
+    0xBE, 0x37, 0x46, 0x9A, 0x2B, 0x00, 0xEB, 0x45, 0x0F, 0xAC, 0xB1, 0x0E, 0xDC, 0x8D, 0x0D, 0x23,
+    0xFF, 0x05, 0x38, 0xE9, 0x77, 0xFA, 0x72, 0x8C, 0x34, 0x9B, 0x8F, 0x4D, 0x0D, 0xD5, 0xCE, 0x61,
+    0x6C, 0x81, 0xF1, 0x6F, 0xB9, 0x0C, 0x1F, 0x98, 0xDF, 0x6C, 0x47, 0xE7, 0x46, 0x47, 0xAA, 0x16,
+    0x9C, 0x9B, 0xC0, 0x29, 0x0E, 0x74, 0xA5, 0x04, 0x26, 0xBF, 0x55, 0x74, 0x7E, 0xB9, 0x37, 0xF0,
+    0x4A, 0xC6, 0x4B, 0xAB, 0x3E, 0x82, 0x0B, 0xA9, 0x88, 0x55, 0x18, 0xC8, 0x15, 0x76, 0xBB, 0xE5,
+    0xF2, 0x26, 0x85, 0xD4, 0xBF, 0xBA, 0xBD, 0xF1, 0x4F, 0x46, 0x22, 0xF5, 0xC0, 0x85, 0x67, 0x7F,
+    0xE1, 0xA2, 0x7F, 0x53, 0x26, 0xDA, 0x1E, 0xAF, 0xF5, 0x3B, 0x89, 0x3D, 0x4D, 0x34, 0x50, 0x27,
+    0x54, 0x5D, 0x31, 0x63, 0xB0, 0xC1, 0xBE, 0x98, 0xC8, 0x6B, 0x94, 0xAF, 0x46, 0x9A, 0x1E, 0xB3,
+    0x04, 0xBF, 0xE2, 0x19, 0xC1, 0xB6, 0xF8, 0x8C, 0x11, 0x58, 0xDF, 0x89, 0x6D, 0xC5, 0xD5, 0x88,
+    0x73, 0x1F, 0x8C, 0xFA, 0xBB, 0xFA, 0x99, 0x54, 0x51, 0xC6, 0x81, 0xEA, 0xE9, 0x88, 0x5F, 0x03,
+    0x49, 0x68, 0x81, 0x62, 0xD5, 0x8C, 0x3B, 0x0D, 0x45, 0xA2, 0x94, 0x51, 0xB9, 0xE5, 0x98, 0x30,
+    0xAC, 0x73, 0x59, 0x0D, 0xBA, 0x2F, 0x3E, 0xB0, 0xDD, 0xEA, 0x84, 0xAA, 0x55, 0x2A, 0x22, 0x83,
+    0x0D, 0x64, 0x07, 0x79, 0x0D, 0x2E, 0x6F, 0x42, 0xD3, 0x83, 0xEF, 0xC0, 0x47, 0x70, 0x61, 0xDC,
+    0xD6, 0xC5, 0x68, 0x07, 0x9F, 0x56, 0x6A, 0xEA, 0x54, 0xB4, 0x64, 0x35, 0xE0, 0xEB, 0xF5, 0x5F,
+    0x60, 0x47, 0x1B, 0x1C, 0xE4, 0x22, 0x52, 0xC6, 0x01, 0xD6, 0x1D, 0x98, 0x5B, 0xED, 0x38, 0x85,
+    0x16, 0x46, 0x5B, 0x92, 0x19, 0x8D, 0x59, 0xA4, 0xD1, 0x9A, 0x46, 0xEA, 0x5D, 0x62, 0x1F, 0xFD,
+    0x4E, 0xB2, 0xCF, 0x84, 0xF5, 0x2D, 0xC0, 0x8E, 0x15, 0xE9, 0xDA, 0x03, 0x2A, 0x5D, 0xB4, 0xDB,
+    0x57, 0x96, 0x56, 0xFA, 0x4A, 0xE2, 0x27, 0x9F, 0x80, 0x0D, 0x4C, 0x8B, 0x05, 0xCC, 0xF5, 0x57,
+    0xDE, 0x49, 0x39, 0x43, 0x51, 0x9A, 0x47, 0xC3, 0x95, 0xF6, 0x5B, 0xA9, 0xCA, 0xFA, 0x02, 0xA6,
+    0x56, 0xF1, 0xFF, 0xA7, 0x3D, 0xDB, 0xA2, 0x37, 0xC7, 0xB2, 0xEE, 0x49, 0xD0, 0xD2, 0x4E, 0x9F,
+    0x33, 0x81, 0x53, 0xD8, 0x7A, 0x87, 0xFC, 0xF5, 0x70, 0x8E, 0x8F, 0xAD, 0xC0, 0x63, 0x4C, 0xCD,
+    0xDE, 0x07, 0xB2, 0x0F, 0x3F, 0xA7, 0x01, 0x9D, 0x74, 0xC4, 0x46, 0x0B, 0x53, 0x4E, 0xA1, 0x7A,
+    0xDD, 0x52, 0x46, 0x0B, 0x9E, 0x66, 0x60, 0xD0, 0x92, 0x8B, 0xD6, 0x3E, 0x92, 0x3C, 0x93, 0x32,
+    0x66, 0xF5, 0xEE, 0x56, 0x91, 0x4A, 0x49, 0x3E, 0xF8, 0x25, 0x8B, 0x0F, 0x45, 0xE9, 0xEA, 0x89,
+    0xFA, 0x23, 0xFE, 0xF0, 0x65, 0x30, 0xED, 0xFD, 0x58, 0x2E, 0x32, 0x33, 0x41, 0xB7, 0x87, 0x4E,
+    0x58, 0x9A, 0x34, 0xD1, 0x2F, 0x5E, 0x49, 0x87, 0xAC, 0x0D, 0xCD, 0xB0, 0xA6, 0xE5, 0xA9, 0x95,
+    0x76, 0x53, 0xAA, 0xDA, 0xC6, 0x2A, 0xE8, 0xC1, 0x06, 0xBC, 0x8D, 0xD8, 0xD7, 0x46, 0x06, 0x98,
+    0xA6, 0x1D, 0x09, 0x25, 0x9B, 0xC1, 0x4A, 0xC0, 0xDE, 0x4C, 0xD8, 0xD7, 0x97, 0x54, 0xC9, 0xA7,
+    0x2A, 0xD9, 0x05, 0x63, 0x4F, 0x79, 0x1F, 0xBA, 0x3B, 0x4A, 0xEA, 0xB9, 0xD3, 0xD2, 0xD4, 0xAC,
+    0x83, 0x60, 0xA4, 0xB6, 0xCF, 0xB4, 0xEB, 0x65, 0x1A, 0xAF, 0x15, 0x78, 0xB9, 0x2A, 0xD9, 0xCB,
+    0x55, 0xC9, 0x4E, 0x24, 0x89, 0xAC, 0x80, 0xB6, 0x11, 0x91, 0xEB, 0x22, 0x22, 0xFB, 0x1F, 0x7F,
+    0xFC, 0xF1, 0xC7, 0x00, 0x4E, 0x1D, 0xA5, 0x9F, 0x90, 0x26, 0xAA, 0xDB, 0xD0, 0x6D, 0x32, 0x31,
+    0x15, 0x57, 0xBA, 0xF2, 0xDB, 0xAD, 0x35, 0xD1, 0x16, 0xE1, 0x70, 0x59, 0x1F, 0xB5, 0x4C, 0x2C,
+    0xA7, 0x8E, 0x71, 0x69, 0x42, 0x29, 0xB2, 0xB4, 0x63, 0x15, 0x3B, 0xC2, 0xDB, 0x48, 0x8E, 0xF4,
+    0xFA, 0x7C, 0xD5, 0x6E, 0x99, 0xE4, 0x9F, 0xCA, 0x7C, 0xA6, 0xF6, 0xB1, 0x8A, 0x65, 0x67, 0x7A,
+    0x9D, 0xF7, 0xBE, 0xFE, 0xDD, 0x73, 0xF6, 0xED, 0x85, 0xCA, 0x3E, 0xF8, 0x33, 0xC9, 0xA4, 0x2D,
+    0xE6, 0xE3, 0xBD, 0x81, 0x1E, 0x8B, 0x4A, 0x1C, 0xC3, 0xB4, 0xCC, 0x94, 0x2C, 0xBD, 0xFC, 0xA4,
+    0x7A, 0x4C, 0x27, 0xA6, 0x98, 0x96, 0x19, 0x65, 0xA0, 0xA7, 0x62, 0xE7, 0xC5, 0x11, 0x54, 0x60,
+    0xDF, 0x28, 0xFB, 0xC4, 0x0E, 0xC3, 0xD1, 0x61, 0x5A, 0x4C, 0xE4, 0xBE, 0xFF, 0xAE, 0x65, 0x59,
+    0xC8, 0x92, 0x0A, 0x8E, 0xAD, 0xA8, 0x8D, 0x4A, 0x3A, 0x2F, 0x9D, 0x7A, 0x17, 0x9D, 0x30, 0x3B,
+    0x03, 0x75, 0x80, 0x7A, 0x75, 0xF5, 0x60, 0xA0, 0x91, 0xCE, 0x88, 0xD4, 0x95, 0x2C, 0x10, 0x49,
+    0x85, 0x48, 0xF4, 0x22, 0x88, 0xE4, 0x52, 0xA4, 0xF3, 0x22, 0xDF, 0x1E, 0xEF, 0x3E, 0xA4, 0xCF,
+    0x5C, 0xB8, 0x10, 0x50, 0xAD, 0x3F, 0xB3, 0x6C, 0xBE, 0x53, 0xC3, 0xC1, 0x72, 0xFB, 0x9D, 0x7C,
+    0xB0, 0xDC, 0x7E, 0x27, 0x4F, 0x12, 0x70, 0x8A, 0x83, 0x24, 0xA6, 0x26, 0xF2, 0xF7, 0x6D, 0xCD,
+    0xBF, 0x39, 0x06, 0x93, 0x8D, 0x91, 0xCC, 0x2D, 0x22, 0xD8, 0x1A, 0xD6, 0x80, 0xE1, 0x9F, 0x9D,
+    0x35, 0xE9, 0xAF, 0xCE, 0x95, 0x57, 0x7E, 0x70, 0xD6, 0x71, 0x3D, 0x3C, 0x08, 0xE8, 0xE7, 0x8A,
+    0xBE, 0x4C, 0xB6, 0x75, 0xB1, 0x41, 0x3F, 0xF7, 0x35, 0xB5, 0xF0, 0x71, 0x6E, 0x5B, 0xFF, 0xC5,
+    0xE4, 0xB6, 0x53, 0xB5, 0x3D, 0x00, 0x98, 0x33, 0x2F, 0xBE, 0xD8, 0xA5, 0x94, 0x36, 0x4E, 0x3D,
+    0x7C, 0xE4, 0xFE, 0x51, 0x6F, 0xD3, 0x9E, 0xB2, 0x00, 0x93, 0x4B, 0x93, 0x8D, 0xA3, 0x93, 0x43,
+    0xE3, 0x75, 0x0D, 0x6B, 0xCB, 0x47, 0xB7, 0x5F, 0xE9, 0x2E, 0x6D, 0x4C, 0x0E, 0x1D, 0x2A, 0x01,
+    0x98, 0x60, 0xBB, 0xF2, 0xE6, 0xB7, 0xCF, 0xFF, 0x08, 0xA8, 0xAD, 0xEA, 0x9D, 0x4E, 0x65, 0x57,
+    0xB6, 0x96, 0x7D, 0x40, 0x6D, 0x42, 0xD1, 0x9A, 0xCE, 0x74, 0xEE, 0x91, 0xC1, 0xC4, 0x7D, 0x00,
+    0x07, 0x02, 0x2B, 0x2C, 0xC0, 0x05, 0x98, 0x9B, 0xDB, 0x19, 0x33, 0x30, 0x07, 0x1F, 0x5D, 0x44,
+    0x2D, 0x6D, 0x02, 0xFB, 0xF3, 0x0C, 0x6E, 0xBE, 0x34, 0x9D, 0xB9, 0x25, 0x61, 0x9D, 0x2D, 0x9F,
+    0x6C, 0x7B, 0xF0, 0x05, 0xA9, 0x9F, 0xA3, 0x94, 0x0C, 0x5A, 0xE6, 0x2D, 0xC8, 0xB6, 0x40, 0xD3,
+    0xB9, 0x01, 0xD7, 0x23, 0xBB, 0x89, 0xC2, 0x6C, 0x75, 0xA9, 0x61, 0x55, 0xBB, 0x71, 0xEF, 0x0A,
+    0x62, 0x3E, 0x8E, 0xEA, 0x38, 0x8A, 0x89, 0xCC, 0xB0, 0x81, 0x1E, 0x87, 0xE9, 0x58, 0xA3, 0x88,
+    0xDC, 0xBF, 0xE7, 0x94, 0x35, 0xD8, 0x4E, 0x2D, 0xF1, 0xAD, 0x7E, 0x6E, 0x7C, 0x31, 0x36, 0x27,
+    0x2C, 0x14, 0x91, 0x72, 0x89, 0x93, 0xAE, 0xC8, 0x33, 0x2A, 0x8B, 0xFD, 0x4E, 0x34, 0xAF, 0x24,
+    0xF5, 0x6E, 0xCF, 0xD6, 0x80, 0xCF, 0xD8, 0x1E, 0xD3, 0x43, 0x86, 0xAD, 0x91, 0x21, 0xDC, 0x2D,
+    0x22, 0x57, 0x5C, 0x68, 0xA4, 0x4A, 0x94, 0x19, 0xBC, 0xFC, 0x58, 0xF2, 0x83, 0x07, 0x9E, 0x96,
+    0x97, 0xA5, 0x55, 0xA0, 0x60, 0xFF, 0x7F, 0xA3, 0x14, 0xD8, 0x82, 0x79, 0xC7, 0xDF, 0xF9, 0x2A,
+    0x0F, 0xFE, 0xF8, 0x53, 0x37, 0x65, 0x70, 0xD7, 0x87, 0x4A, 0xE4, 0xF3, 0x3F, 0xFC, 0xA7, 0xFC,
+    0xF6, 0xCA, 0xD8, 0x90, 0xC0, 0xB4, 0x63, 0xAF, 0xE7, 0xD8, 0xB8, 0xDA, 0xBD, 0x2E, 0x30, 0x05,
+    0x86, 0x51, 0x68, 0x19, 0xC7, 0xE2, 0x71, 0xEF, 0xDA, 0xC2, 0x81, 0xDB, 0x54, 0x72, 0x45, 0x16,
+    0xDC, 0xB6, 0x4F, 0xB7, 0x9B, 0xAA, 0x76, 0xFB, 0x54, 0x82, 0x0D, 0x8A, 0x88, 0xE9, 0x70, 0x50,
+    0x41, 0x8F, 0x1A, 0xA8, 0x22, 0xF3, 0x50, 0x64, 0xEC, 0xC0, 0x3C, 0xE0, 0x57, 0x94, 0xAE, 0x8D,
+    0xD8, 0x96, 0x39, 0xFC, 0x36, 0xFA, 0x83, 0x8D, 0xDD, 0x07, 0x51, 0xE7, 0x50, 0x03, 0x36, 0x52,
+    0xB6, 0xAC, 0x83, 0xDF, 0xE9, 0x6E, 0x03, 0xF7, 0x75, 0xDC, 0xAD, 0x24, 0x73, 0xC4, 0xF4, 0x9E,
+    0x09, 0x75, 0xC5, 0x0C, 0x1C, 0x03, 0x4C, 0x49, 0x70, 0x5A, 0x27, 0xD4, 0x60, 0x3A, 0x5C, 0x32,
+    0x2D, 0xF3, 0x50, 0x46, 0x32, 0x36, 0xAA, 0x8C, 0xA9, 0xF5, 0x00, 0x1F, 0x96, 0x75, 0x20, 0xB0,
+    0xC0, 0x06, 0xB5, 0xC0, 0x05, 0x93, 0xF1, 0xB5, 0xC9, 0xC0, 0x81, 0xD5, 0x7E, 0xF1, 0xA9, 0x93,
+    0xED, 0xD8, 0x14, 0x6D, 0xBA, 0x4D, 0xEC, 0x39, 0x13, 0x49, 0x4C, 0xA8, 0x28, 0xA3, 0xE9, 0x18,
+    0x58, 0xC3, 0x53, 0xC6, 0x26, 0x32, 0x54, 0x09, 0xFB, 0xB9, 0x01, 0x3E, 0xEB, 0x19, 0xC3, 0x12,
+    0x5F, 0xDE, 0x23, 0x25, 0xDF, 0x0B, 0x6E, 0x3B, 0x61, 0x72, 0x03, 0xCD, 0xD3, 0x89, 0x03, 0xE7,
+    0xF7, 0x26, 0x23, 0x91, 0x71, 0x03, 0x54, 0x62, 0x34, 0x3D, 0x33, 0xC0, 0xB4, 0x63, 0x30, 0x5C,
+    0xA7, 0xC7, 0xF4, 0x65, 0xE0, 0x60, 0x98, 0xEC, 0x5C, 0xC3, 0xAA, 0x18, 0x37, 0x87, 0x32, 0x8E,
+    0xBC, 0x28, 0x3A, 0x01, 0xF6, 0x09, 0xC6, 0xD8, 0x5F, 0xFC, 0x38, 0x81, 0xBF, 0x37, 0xAC, 0xA6,
+    0x0C, 0xAB, 0x44, 0xCB, 0x74, 0x2B, 0x16, 0x40, 0xF5, 0xAB, 0x96, 0xDD, 0xD8, 0x31, 0xD0, 0xE1,
+    0xCF, 0x7E, 0xE7, 0x07, 0xFF, 0xE1, 0xEF, 0x6E, 0x0F, 0x87, 0xE1, 0xC4, 0x03, 0x07, 0xAE, 0xFC,
+    0x91, 0x6F, 0x1F, 0x82, 0xE5, 0xDF, 0xD6, 0x83, 0x7A, 0x71, 0xD2, 0x7C, 0xFE, 0x6C, 0xF1, 0x76,
+    0xEB, 0xCF, 0xFC, 0xD1, 0xB7, 0xB6, 0x7B, 0xC0, 0x64, 0x1D, 0x1F, 0x2A, 0xE9, 0x8E, 0xA8, 0xFA,
+    0x40, 0xF8, 0xF3, 0xFB, 0xDB, 0xFC, 0xAD, 0xAB, 0xC3, 0x3E, 0xCA, 0x17, 0x7F, 0xFF, 0xB3, 0x7F,
+    0xF0, 0x7B, 0xEE, 0xCA, 0x57, 0xB7, 0xC6, 0x25, 0xDD, 0xEC, 0x8C, 0x0C, 0x45, 0xBF, 0x59, 0xC6,
+    0x99, 0xAD, 0x87, 0x8A, 0xDE, 0xEB, 0xE4, 0x4D, 0xDA, 0x2A, 0xD2, 0x81, 0xA7, 0xFE, 0xEC, 0x1F,
+    0xFE, 0xC1, 0x37, 0xFE, 0xE5, 0xD5, 0xFE, 0x18, 0x2A, 0xCC, 0x74, 0x78, 0xA8, 0x50, 0x97, 0x7C,
+    0x2C, 0xD2, 0x6F, 0xB7, 0xA6, 0x9E, 0x14, 0x71, 0xFD, 0xD1, 0x05, 0x26, 0x71, 0xB6, 0x50, 0x03,
+    0x17, 0xE7, 0x8F, 0x9C, 0x87, 0x30, 0x39, 0xB4, 0xFD, 0xD5, 0x79, 0x7C, 0xB2, 0x04, 0xB5, 0xF8,
+    0xB4, 0xA9, 0x7D, 0xFD, 0xF0, 0xFC, 0x40, 0x50, 0xC3, 0x27, 0x59, 0x14, 0x5F, 0x3F, 0xF2, 0xCD,
+    0x3F, 0x0D, 0x03, 0x94, 0xD9, 0x84, 0x6F, 0x1E, 0x52, 0xED, 0x44, 0xD7, 0x07, 0xE2, 0x9F, 0xDF,
+    0xDF, 0xE6, 0x87, 0x5E, 0xFA, 0xFA, 0xB4, 0x2E, 0x5F, 0xFC, 0xFD, 0xCF, 0xFE, 0x60, 0x57, 0xA9,
+    0x0D, 0x74, 0x4F, 0xD1, 0x52, 0x05, 0x3C, 0x6C, 0x42, 0x8F, 0x49, 0x3B, 0xB7, 0x3F, 0x02, 0x15,
+    0x38, 0xF0, 0x30, 0xDD, 0xF9, 0xF1, 0x23, 0x17, 0x0F, 0x55, 0x8D, 0x8D, 0x94, 0x91, 0x19, 0x64,
+    0x18, 0x50, 0x03, 0x3A, 0x61, 0x12, 0x66, 0xE7, 0xDB, 0x0E, 0x4E, 0xC3, 0x80, 0x4E, 0x94, 0x91,
+    0x0A, 0x66, 0x2B, 0xF2, 0x7C, 0xF7, 0xFE, 0x53, 0x3D, 0xEE, 0xD7, 0x11, 0x38, 0xF4, 0x30, 0x1C,
+    0xB9, 0x08, 0x0F, 0x77, 0x28, 0xE9, 0xA8, 0xA4, 0x63, 0x2E, 0x51, 0xCB, 0xB5, 0xBA, 0x90, 0xDF,
+    0xC3, 0xBE, 0x36, 0xC1, 0xFD, 0xEF, 0x27, 0xF1, 0x9B, 0x09, 0xFF, 0x6E, 0x4B, 0x73, 0xEB, 0x7F,
+    0xD2, 0x48, 0xC6, 0xCB, 0x80, 0x93, 0x1E, 0x2B, 0xFD, 0xDE, 0x19, 0xF6, 0x64, 0x65, 0xF3, 0x8E,
+    0xE6, 0xA3, 0x3D, 0x9F, 0x7B, 0xCF, 0xD9, 0x6E, 0x1E, 0xFD, 0x99, 0x56, 0xC9, 0xE1, 0x0F, 0xF4,
+    0x7C, 0xDC, 0x4E, 0x19, 0x37, 0xAF, 0xB5, 0xF4, 0x2A, 0xED, 0x37, 0xB2, 0x50, 0x22, 0x14, 0x81,
+    0x4A, 0x52, 0x29, 0x03, 0x15, 0x9C, 0xAC, 0x91, 0x65, 0xF0, 0xD2, 0x1F, 0xBC, 0xF0, 0x23, 0x50,
+    0x27, 0x4C, 0x47, 0x91, 0x8A, 0x96, 0xB2, 0x2F, 0x23, 0x76, 0xB0, 0x81, 0x2A, 0x57, 0x35, 0x3E,
+    0x3B, 0xEE, 0x9D, 0x2F, 0xE7, 0xCF, 0x79, 0x11, 0xE9, 0x59, 0x4E, 0x33, 0x6A, 0xE1, 0x07, 0x74,
+    0xF6, 0x3D, 0x26, 0xFB, 0x44, 0x31, 0xB8, 0x44, 0xD9, 0x57, 0x2B, 0x99, 0x4D, 0x86, 0xB9, 0xB0,
+    0x7F, 0x71, 0xF2, 0x59, 0x2F, 0x92, 0x75, 0xAA, 0x82, 0x11, 0xA1, 0x90, 0x05, 0xA5, 0xF4, 0xD8,
+    0x9F, 0xD5, 0x54, 0x3B, 0x49, 0x64, 0x0D, 0x4D, 0x0D, 0x73, 0x18, 0xA9, 0x33, 0x7C, 0x06, 0x6C,
+    0x51, 0x43, 0xF1, 0x54, 0x0B, 0xBA, 0xBD, 0x04, 0xA4, 0x09, 0x3E, 0x4C, 0x85, 0xE9, 0xB9, 0x4A,
+    0xF8, 0x38, 0xA5, 0x44, 0xF3, 0x86, 0x49, 0x09, 0x57, 0x0F, 0x33, 0x54, 0xBA, 0xEC, 0xEA, 0xF5,
+    0xC1, 0xDB, 0xD6, 0xE7, 0x83, 0xDF, 0x3E, 0x57, 0xAC, 0xE0, 0xE4, 0x20, 0x3A, 0x4C, 0x38, 0x4C,
+    0xE2, 0x92, 0x89, 0x26, 0xDA, 0x83, 0x56, 0x89, 0xC8, 0x5B, 0x22, 0x52, 0xBC, 0x76, 0x8D, 0x4A,
+    0x36, 0x68, 0x24, 0xAA, 0xE5, 0x9C, 0xE2, 0x9D, 0x31, 0x6D, 0x3E, 0xED, 0x80, 0x67, 0x81, 0x26,
+    0xAB, 0xDA, 0x49, 0x4C, 0x36, 0x5E, 0x3A, 0x65, 0xE2, 0x03, 0x47, 0xD5, 0x2B, 0x4F, 0x1F, 0xE7,
+    0x4F, 0x6E, 0x6C, 0xC7, 0xC9, 0xA5, 0x77, 0xBA, 0x43, 0x13, 0xFA, 0xE2, 0x78, 0x3D, 0xD3, 0xDB,
+    0xB7, 0xE7, 0x24, 0x2F, 0x01, 0xF5, 0x7C, 0x0B, 0x94, 0x70, 0x60, 0x2B, 0xE0, 0x05, 0xCA, 0x1A,
+    0xB7, 0x89, 0x91, 0x8E, 0xA3, 0x55, 0x4D, 0x37, 0xA3, 0x78, 0xB4, 0xA3, 0x92, 0x1A, 0x9F, 0xE1,
+    0xEE, 0x13, 0x7C, 0xE6, 0xC2, 0xB9, 0x91, 0xFC, 0x06, 0x70, 0x03, 0x95, 0x04, 0xB3, 0x3C, 0xCF,
+    0x16, 0x34, 0x82, 0x95, 0x1E, 0x57, 0x63, 0x3A, 0xD4, 0x58, 0xDF, 0xB0, 0x0E, 0x45, 0x0F, 0x8D,
+    0x60, 0xA4, 0xA3, 0x1C, 0x53, 0xC0, 0xBD, 0xBD, 0xBA, 0xBF, 0x82, 0x79, 0x87, 0x5B, 0x50, 0x2D,
+    0xD0, 0xF2, 0x6F, 0x31, 0x12, 0x68, 0x7A, 0x9A, 0x9E, 0x72, 0x09, 0xC7, 0xDB, 0x31, 0xC0, 0x55,
+    0x4B, 0xD0, 0x92, 0x61, 0x5A, 0xB5, 0xEA, 0xF9, 0xF7, 0xE4, 0x47, 0x9C, 0xD6, 0x49, 0x3D, 0xF1,
+    0x17, 0xF2, 0x18, 0x22, 0x91, 0x4A, 0x7A, 0xB4, 0x2C, 0xC0, 0xFF, 0x70, 0x05, 0x72, 0x5B, 0x3B,
+    0xF4, 0xE9, 0x62, 0x45, 0xAA, 0xEE, 0xB4, 0x16, 0xEA, 0xF1, 0x72, 0x97, 0x05, 0x4E, 0x9E, 0xA7,
+    0x94, 0x05, 0x5E, 0x16, 0xC8, 0xE6, 0x3E, 0x9D, 0x27, 0x98, 0xFE, 0x14, 0x45, 0xBA, 0x84, 0xED,
+    0x96, 0xCF, 0xDA, 0x56, 0x16, 0xF6, 0x8A, 0x2C, 0xAA, 0x57, 0x5E, 0xEF, 0xED, 0x9D, 0xB7, 0x92,
+    0x15, 0xE9, 0x8C, 0x48, 0xCB, 0xFC, 0xF6, 0xFB, 0xD3, 0xEC, 0xDF, 0x25, 0x5B, 0x7A, 0xD0, 0x92,
+    0x40, 0x15, 0xDD, 0x08, 0x6C, 0x5E, 0x44, 0x5E, 0x11, 0x91, 0xE5, 0xCE, 0x92, 0xE5, 0x65, 0x11,
+    0x11, 0x93, 0x0E, 0xD4, 0xD8, 0x37, 0x05, 0x9C, 0x2C, 0xE0, 0x3E, 0xD9, 0x65, 0xCC, 0x4C, 0xE0,
+    0x49, 0x4E, 0xB6, 0x6E, 0x51, 0xFC, 0x35, 0xEF, 0xB5, 0xD5, 0x44, 0xDF, 0x8A, 0x2E, 0x2B, 0x49,
+    0xC5, 0x92, 0xC3, 0xEF, 0x67, 0x5A, 0xB2, 0x9B, 0x45, 0x7B, 0x91, 0xD8, 0x88, 0x84, 0xC7, 0x9B,
+    0xC7, 0xC7, 0xC4, 0x3C, 0x8F, 0xBF, 0x6A, 0x18, 0x29, 0x64, 0x93, 0xA0, 0x4C, 0x63, 0x22, 0x5C,
+    0x45, 0xF8, 0x7F, 0x55, 0x94, 0x3F, 0x6C, 0x1C, 0xC7, 0x15, 0x87, 0xBF, 0x99, 0x21, 0xB9, 0xB1,
+    0x46, 0xC8, 0xA8, 0xA0, 0x00, 0xC3, 0x81, 0xB0, 0x8D, 0x0B, 0x23, 0x50, 0xB8, 0x2D, 0x11, 0xDC,
+    0xDD, 0xAE, 0xAD, 0xD2, 0x48, 0xE2, 0xC2, 0x41, 0x4A, 0xBB, 0x0F, 0x60, 0x76, 0x41, 0x02, 0x9C,
+    0xB4, 0x2B, 0xB0, 0x70, 0x91, 0x22, 0xEC, 0x15, 0x04, 0x2E, 0x52, 0x08, 0xD7, 0x28, 0x85, 0x90,
+    0xA8, 0x38, 0xFA, 0x46, 0x52, 0xE1, 0xC2, 0x00, 0xB9, 0x41, 0x9C, 0x4A, 0x40, 0xB8, 0x56, 0xE8,
+    0xFC, 0x51, 0xA3, 0x89, 0x39, 0x86, 0x87, 0xCC, 0xEE, 0xBE, 0x14, 0x27, 0xD9, 0xC8, 0xC3, 0x34,
+    0xF3, 0x06, 0xDF, 0xE0, 0xF7, 0x7B, 0xF3, 0xE6, 0x19, 0xE9, 0x33, 0xE9, 0xC9, 0x71, 0x12, 0x9D,
+    0x84, 0xBC, 0xA7, 0x0C, 0x94, 0x01, 0x15, 0x51, 0x09, 0x9D, 0x30, 0x09, 0x93, 0x60, 0x8E, 0xFE,
+    0x4F, 0xE3, 0x46, 0xB5, 0x8A, 0xF9, 0x79, 0xB3, 0x12, 0x55, 0x27, 0x77, 0xBE, 0x53, 0x3F, 0x0E,
+    0xF9, 0x8A, 0x55, 0xA7, 0x4F, 0x01, 0x50, 0x15, 0xCC, 0xC1, 0x36, 0xE8, 0x11, 0x25, 0x89, 0x52,
+    0xBC, 0x1D, 0x97, 0x5C, 0x3C, 0x69, 0xDC, 0x24, 0xAA, 0xB3, 0x63, 0x76, 0x7E, 0x15, 0xCC, 0x93,
+    0x0F, 0x98, 0x9C, 0xB5, 0xD9, 0xC9, 0x9C, 0x6F, 0xA3, 0xEE, 0xA1, 0x10, 0x8F, 0x6B, 0x12, 0x59,
+    0xBB, 0x83, 0x0E, 0x45, 0xB3, 0x29, 0xE2, 0x9D, 0x48, 0x6B, 0x44, 0x5A, 0xE4, 0xDF, 0x15, 0x26,
+    0xA0, 0x44, 0x02, 0x22, 0x3D, 0x94, 0x15, 0x14, 0x7E, 0x4D, 0xEF, 0x42, 0x44, 0x77, 0x98, 0x87,
+    0x87, 0xEE, 0xF9, 0x50, 0xC8, 0x41, 0xDD, 0x52, 0x78, 0x6C, 0x40, 0x45, 0x78, 0x1F, 0xB6, 0xA0,
+    0x68, 0x94, 0xB4, 0x56, 0x62, 0x79, 0xB3, 0x7F, 0x30, 0xDF, 0xBD, 0xF2, 0x00, 0x22, 0x04, 0x54,
+    0x40, 0x77, 0x2F, 0x55, 0x5C, 0x03, 0x07, 0xB6, 0xB9, 0x75, 0xA3, 0x2D, 0xC7, 0xB0, 0x25, 0x3D,
+    0x5B, 0x03, 0xA6, 0xC7, 0x75, 0xE4, 0x0D, 0xAF, 0x40, 0x80, 0x1F, 0x40, 0xE6, 0x21, 0xC0, 0x14,
+    0xFB, 0xF6, 0x87, 0x6F, 0x9E, 0x7F, 0x1D, 0x9C, 0x04, 0x56, 0x91, 0x2C, 0xC2, 0xEB, 0x00, 0xBC,
+    0xCF, 0x65, 0x8C, 0x67, 0x97, 0xEB, 0x8A, 0xFB, 0xEA, 0x1F, 0x72, 0x1A, 0x9C, 0xDC, 0x91, 0x20,
+    0x07, 0xEC, 0xFD, 0x39, 0x41, 0xA9, 0x12, 0x26, 0xD0, 0xE1, 0xBE, 0xF1, 0xAF, 0x1B, 0x35, 0xB0,
+    0x8A, 0xB3, 0xFF, 0x7E, 0xFA, 0xE3, 0x37, 0x54, 0xCB, 0xF5, 0x35, 0x6E, 0x1A, 0x26, 0x68, 0xAF,
+    0xAE, 0xF1, 0xE0, 0xEF, 0x8F, 0xA4, 0xCF, 0x04, 0xEB, 0xD9, 0x86, 0xD7, 0x6E, 0xAF, 0xC4, 0x8D,
+    0x55, 0x99, 0x18, 0x07, 0xFD, 0xB9, 0xBC, 0xED, 0xEB, 0x0F, 0x78, 0xE3, 0xBB, 0x07, 0x94, 0x72,
+    0xB0, 0x25, 0x8D, 0x1D, 0xF5, 0x98, 0xEA, 0xC7, 0x4F, 0xA2, 0xFB, 0x11, 0xD3, 0xEF, 0xA0, 0x3B,
+    0x72, 0xDD, 0xC4, 0x49, 0xF6, 0x49, 0x33, 0xBD, 0xAF, 0x04, 0x17, 0xCA, 0x31, 0x93, 0x76, 0x6B,
+    0x09, 0x9B, 0x10, 0x5F, 0xCF, 0xCD, 0x7E, 0x3B, 0x99, 0xEB, 0xE3, 0x2A, 0x0F, 0x0C, 0x38, 0xF1,
+    0xAB, 0x3E, 0xFB, 0x02, 0x5D, 0xC1, 0x74, 0x6D, 0x35, 0x41, 0x2E, 0xB2, 0x7F, 0xB1, 0xB8, 0x5B,
+    0x3C, 0x5B, 0x1C, 0xD4, 0x32, 0xAA, 0x1E, 0x8C, 0x87, 0x57, 0x01, 0xAE, 0xC0, 0xB5, 0x3F, 0xA0,
+    0xCF, 0x3A, 0xCA, 0xE3, 0xCE, 0x8C, 0x75, 0x5B, 0xFF, 0xF1, 0xE4, 0xF1, 0xD3, 0xE3, 0xFC, 0x15,
+    0xB7, 0x7B, 0x85, 0x1F, 0xB6, 0xE8, 0x13, 0x70, 0x13, 0x98, 0x76, 0xA8, 0x27, 0x15, 0x6A, 0x03,
+    0xE0, 0x32, 0x98, 0x16, 0x66, 0xA0, 0x42, 0x2E, 0x72, 0x7B, 0xB1, 0x18, 0xBE, 0xBF, 0xB8, 0xF7,
+    0x89, 0x48, 0x87, 0x49, 0xEB, 0x7C, 0x03, 0x6F, 0x82, 0xF9, 0xDD, 0x9A, 0xBE, 0x1E, 0xE0, 0x17,
+    0x2D, 0xFC, 0xB3, 0x51, 0x37, 0x8E, 0x37, 0xDC, 0xAF, 0x27, 0x13, 0xF7, 0xB7, 0x3F, 0x45, 0x37,
+    0x48, 0x65, 0xCF, 0x12, 0xF6, 0xC4, 0x93, 0xFD, 0x16, 0xD4, 0x15, 0x74, 0xC5, 0x65, 0xA6, 0x18,
+    0x9F, 0x79, 0x66, 0xA4, 0xF5, 0xFD, 0xB2, 0x7F, 0xB1, 0x58, 0x0C, 0xC5, 0xB3, 0xC5, 0x3D, 0x5F,
+    0x8B, 0x74, 0xAA, 0x37, 0x11, 0xE3, 0xA7, 0xF0, 0xAA, 0x6A, 0x60, 0x17, 0x56, 0x95, 0x96, 0x73,
+    0x7B, 0x32, 0x14, 0x47, 0xDB, 0xE5, 0x11, 0x97, 0x8E, 0x50, 0x2F, 0xD7, 0xCE, 0x11, 0xE5, 0x11,
+    0xEE, 0xE8, 0x97, 0xE6, 0xF9, 0xA0, 0xE4, 0x94, 0x5B, 0xB0, 0xBD, 0x7E, 0x32, 0xD7, 0x90, 0x45,
+    0x98, 0x82, 0xAB, 0x30, 0x1E, 0x15, 0xB2, 0xE1, 0x7E, 0x26, 0x7D, 0x16, 0x46, 0x1D, 0x8A, 0x2A,
+    0x59, 0x3F, 0xB3, 0xAD, 0x93, 0x4E, 0x4B, 0x47, 0xD1, 0xBE, 0xF8, 0x1E, 0x5B, 0xE3, 0x21, 0x46,
+    0xA4, 0x41, 0xDE, 0x8B, 0x94, 0x6F, 0x49, 0xE3, 0xDA, 0xC3, 0x9E, 0x54, 0x38, 0x5F, 0xFC, 0xC4,
+    0x27, 0x73, 0x16, 0x8A, 0xAA, 0x4C, 0x26, 0x64, 0xE3, 0xD6, 0x48, 0x2D, 0xD2, 0x5A, 0x91, 0xA4,
+    0x45, 0x46, 0xA6, 0x7B, 0x23, 0x54, 0x00, 0x5C, 0x85, 0x2C, 0x80, 0x54, 0x94, 0x11, 0xFB, 0xBC,
+    0x51, 0xA9, 0xA7, 0x74, 0xDE, 0xF9, 0x41, 0x27, 0xD7, 0xD6, 0x7C, 0xEC, 0xBC, 0xFD, 0x52, 0x44,
+    0x4A, 0x91, 0xA7, 0x8B, 0xC5, 0x5D, 0xC0, 0x88, 0x7C, 0x2E, 0x12, 0xDC, 0x8D, 0x2E, 0x7B, 0x18,
+    0x75, 0x58, 0x92, 0x66, 0x4C, 0x5D, 0x95, 0x67, 0xDE, 0x3E, 0x0A, 0xA6, 0x4B, 0x2A, 0x4E, 0x59,
+    0xE6, 0x5C, 0xDD, 0xAC, 0x78, 0x77, 0x93, 0x3C, 0xF3, 0xA6, 0x8D, 0xA4, 0x92, 0xC2, 0xFA, 0xCC,
+    0x47, 0xE2, 0x8C, 0x99, 0xF5, 0xF6, 0x61, 0x50, 0x71, 0xCA, 0xCC, 0x35, 0xA5, 0x0C, 0x4E, 0xA4,
+    0x79, 0xD1, 0xBA, 0xA5, 0xF8, 0x5C, 0x82, 0x09, 0x70, 0x08, 0xCE, 0xA3, 0xD6, 0x45, 0xD9, 0x81,
+    0x5B, 0xF0, 0x31, 0xAC, 0xA4, 0x29, 0xA5, 0xBD, 0xB4, 0xF8, 0x88, 0x4B, 0xAB, 0x47, 0x32, 0x5C,
+    0xFD, 0x29, 0x70, 0x69, 0x01, 0x4E, 0x1A, 0xB2, 0xCF, 0xD6, 0x8D, 0xA0, 0x03, 0x10, 0x81, 0x1E,
+    0xB8, 0x09, 0x94, 0x40, 0x51, 0x61, 0x9D, 0xC7, 0x48, 0x0B, 0xAB, 0x00, 0x79, 0x04, 0xD3, 0x03,
+    0x6C, 0x50, 0x29, 0x39, 0x8E, 0x99, 0x48, 0xEF, 0x6E, 0xA7, 0x49, 0x4E, 0x37, 0xD9, 0xD1, 0xDD,
+    0xBC, 0x10, 0x89, 0xB9, 0x48, 0x67, 0xD3, 0xAA, 0x81, 0x0D, 0x80, 0xBA, 0x82, 0xBA, 0x83, 0xD9,
+    0x06, 0x14, 0x80, 0xAB, 0xC0, 0x7A, 0x30, 0x1D, 0xA8, 0x00, 0x24, 0x60, 0xCA, 0xFF, 0x1D, 0xAA,
+    0x3B, 0x1D, 0x99, 0x04, 0x90, 0x08, 0x36, 0x7E, 0x3B, 0xA4, 0x7A, 0xD5, 0xEB, 0xDE, 0xA4, 0xF5,
+    0xC6, 0x7A, 0xE7, 0x0B, 0x5F, 0x7A, 0xF5, 0xFB, 0x6D, 0x3B, 0x4C, 0xF3, 0xF7, 0x7A, 0x6B, 0x03,
+    0x90, 0x77, 0x5D, 0xF9, 0x55, 0x58, 0xD6, 0xED, 0xF6, 0x6B, 0xD5, 0x0B, 0x6C, 0x02, 0x04, 0xD0,
+    0x1E, 0x6C, 0x05, 0xF9, 0x40, 0x29, 0x23, 0x12, 0x21, 0xF3, 0x28, 0x91, 0x90, 0x89, 0x04, 0x75,
+    0xBE, 0x16, 0xE5, 0xFC, 0x5A, 0xCB, 0x3A, 0xEE, 0x83, 0x4D, 0xB0, 0x0A, 0x58, 0xA9, 0xA8, 0xE3,
+    0xDA, 0x4C, 0x2D, 0x07, 0x6C, 0x89, 0x34, 0x6C, 0x89, 0x07, 0xDB, 0x9A, 0x8B, 0x77, 0xC8, 0x44,
+    0x22, 0x57, 0xEF, 0xF5, 0xDF, 0xA0, 0x3B, 0x40, 0xD9, 0x41, 0x3E, 0x82, 0x92, 0x53, 0xC8, 0x07,
+    0xD8, 0xEB, 0xD5, 0x9E, 0xFC, 0xCB, 0xC8, 0x29, 0xD9, 0x29, 0x6C, 0x6C, 0xFE, 0xDC, 0xE7, 0x22,
+    0xBE, 0xBC, 0x78, 0x77, 0xCD, 0x14, 0x7E, 0x85, 0xEC, 0x0F, 0x2A, 0x66, 0x5E, 0x77, 0xAE, 0xCA,
+    0x45, 0xFA, 0x42, 0x24, 0xE5, 0x7F, 0xAD, 0xDF, 0x71, 0x7E, 0x46, 0xDE, 0xDC, 0xA4, 0xA8, 0x96,
+    0x94, 0xF4, 0x94, 0x2A, 0x71, 0xA8, 0x23, 0xC0, 0x47, 0xE0, 0xBC, 0xE9, 0x4B, 0xCA, 0xA7, 0xBD,
+    0x0A, 0x60, 0x1B, 0x94, 0x7C, 0xD9, 0x5A, 0xF9, 0x4D, 0x95, 0x7F, 0x36, 0xA1, 0x54, 0x9D, 0x4A,
+    0xAE, 0xB2, 0xED, 0x94, 0x52, 0x05, 0x7A, 0xE7, 0x6D, 0x3B, 0x03, 0xA0, 0x43, 0x32, 0xEF, 0xD2,
+    0x8C, 0x39, 0x41, 0x77, 0xD6, 0xD7, 0xFD, 0x4C, 0x4B, 0x17, 0xB2, 0xAF, 0xAC, 0x77, 0x7E, 0xC6,
+    0x2D, 0xA2, 0x8E, 0x99, 0x77, 0x7E, 0x46, 0x89, 0xBC, 0x15, 0xB3, 0x01, 0x80, 0xCD, 0x75, 0xF5,
+    0xD5, 0x60, 0xBF, 0x0E, 0x4A, 0xEC, 0xD8, 0x93, 0x4C, 0x0B, 0x73, 0x1D, 0x40, 0x44, 0x06, 0x6A,
+    0x11, 0xA9, 0xEC, 0x17, 0x7B, 0x77, 0xBC, 0x0E, 0xF6, 0x51, 0x47, 0x6F, 0xBA, 0xC8, 0x4C, 0xC5,
+    0x09, 0x45, 0xB5, 0x2C, 0x70, 0xBE, 0x74, 0xDE, 0x84, 0x7C, 0x7F, 0x3D, 0xF6, 0xB3, 0xC6, 0xF4,
+    0xAE, 0x5B, 0x22, 0xFB, 0x83, 0xAB, 0x72, 0xE6, 0x2A, 0xE8, 0xCE, 0x55, 0x85, 0x12, 0x91, 0xC7,
+    0x6D, 0x21, 0x92, 0xE6, 0x6A, 0xF8, 0xD9, 0x0B, 0x45, 0x51, 0xA5, 0xAC, 0xCD, 0x29, 0xAA, 0xA5,
+    0x0E, 0x26, 0x38, 0x3F, 0xA3, 0x54, 0xC9, 0x0C, 0xB6, 0x2D, 0xAA, 0xDA, 0xBF, 0x2C, 0xBC, 0x05,
+    0x58, 0x02, 0xA6, 0x63, 0x2F, 0x4A, 0x6F, 0x9E, 0x7D, 0x2A, 0xE1, 0x1A, 0xA6, 0x63, 0x76, 0xE0,
+    0x2A, 0x8A, 0x6E, 0x0E, 0xF6, 0x2F, 0x1D, 0xA3, 0xB8, 0xBB, 0x4E, 0x62, 0x1D, 0xBE, 0x37, 0x2A,
+    0x59, 0xD3, 0xFF, 0x03,
 };
 
 static const EpdGlyph opendyslexic_8_bolditalicGlyphs[] = {
@@ -1279,7 +1260,7 @@ static const EpdGlyph opendyslexic_8_bolditalicGlyphs[] = {
     { 7, 16, 7, 1, 13, 28, 4060 }, // |
     { 11, 17, 12, -1, 13, 47, 4088 }, // }
     { 8, 4, 8, 3, 12, 8, 4135 }, // ~
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
+    { 0, 0, 14, 0, 0, 0, 4143 }, //  
     { 9, 22, 9, 2, 19, 50, 0 }, // ¡
     { 10, 15, 13, 1, 12, 38, 50 }, // ¢
     { 13, 15, 12, 0, 14, 49, 88 }, // £
@@ -1290,625 +1271,631 @@ static const EpdGlyph opendyslexic_8_bolditalicGlyphs[] = {
     { 9, 4, 9, 3, 14, 9, 303 }, // ¨
     { 10, 7, 11, 4, 16, 18, 312 }, // ©
     { 6, 6, 11, 5, 13, 9, 330 }, // ª
-    { 12, 10, 14, 1, 10, 30, 339 }, // «
-    { 10, 6, 10, 1, 6, 15, 369 }, // ¬
-    { 10, 2, 10, 1, 6, 5, 384 }, // ­
-    { 9, 7, 11, 5, 18, 16, 389 }, // ®
-    { 8, 3, 9, 3, 13, 6, 405 }, // ¯
-    { 10, 8, 11, 3, 13, 20, 411 }, // °
-    { 13, 12, 14, 0, 9, 39, 431 }, // ±
-    { 6, 7, 5, 6, 14, 11, 470 }, // ²
-    { 6, 7, 6, 6, 14, 11, 481 }, // ³
-    { 5, 4, 5, 3, 13, 5, 492 }, // ´
-    { 14, 12, 14, -1, 9, 42, 497 }, // µ
-    { 13, 15, 13, 1, 12, 49, 539 }, // ¶
-    { 5, 4, 4, 1, 8, 5, 588 }, // ·
-    { 6, 6, 5, -1, 1, 9, 593 }, // ¸
-    { 5, 7, 5, 6, 14, 9, 602 }, // ¹
-    { 7, 6, 11, 5, 13, 11, 611 }, // º
-    { 12, 10, 12, -3, 10, 30, 622 }, // »
-    { 18, 17, 22, 1, 15, 77, 652 }, // ¼
-    { 19, 17, 22, 1, 15, 81, 729 }, // ½
-    { 18, 15, 22, 1, 13, 68, 810 }, // ¾
-    { 12, 21, 11, -1, 12, 63, 878 }, // ¿
-    { 14, 19, 19, 1, 19, 67, 941 }, // À
-    { 15, 22, 19, 1, 22, 83, 1008 }, // Á
-    { 15, 20, 19, 1, 20, 75, 1091 }, // Â
-    { 15, 19, 19, 1, 19, 72, 1166 }, // Ã
-    { 16, 20, 19, 1, 20, 80, 1238 }, // Ä
-    { 15, 20, 19, 1, 20, 75, 1318 }, // Å
-    { 23, 15, 23, 1, 14, 87, 1393 }, // Æ
-    { 15, 19, 16, 1, 15, 72, 1480 }, // Ç
-    { 14, 19, 15, 1, 19, 67, 1552 }, // È
-    { 14, 22, 15, 1, 22, 77, 1619 }, // É
-    { 14, 20, 15, 1, 20, 70, 1696 }, // Ê
-    { 15, 20, 15, 1, 20, 75, 1766 }, // Ë
-    { 10, 20, 9, 1, 20, 50, 1841 }, // Ì
-    { 11, 23, 9, 1, 23, 64, 1891 }, // Í
-    { 11, 21, 9, 1, 21, 58, 1955 }, // Î
-    { 12, 21, 9, 1, 21, 63, 2013 }, // Ï
-    { 17, 14, 17, 0, 14, 60, 2076 }, // Ð
-    { 16, 19, 17, 1, 19, 76, 2136 }, // Ñ
-    { 17, 20, 19, 1, 19, 85, 2212 }, // Ò
-    { 17, 23, 19, 1, 22, 98, 2297 }, // Ó
-    { 17, 21, 19, 1, 20, 90, 2395 }, // Ô
-    { 17, 20, 19, 1, 19, 85, 2485 }, // Õ
-    { 17, 21, 19, 1, 20, 90, 2570 }, // Ö
-    { 11, 6, 10, 0, 7, 17, 2660 }, // ×
-    { 34, 30, 19, -7, 22, 255, 2677 }, // Ø
-    { 16, 21, 17, 1, 20, 84, 2932 }, // Ù
-    { 16, 24, 17, 1, 23, 96, 3016 }, // Ú
-    { 16, 22, 17, 1, 21, 88, 3112 }, // Û
-    { 16, 22, 17, 1, 21, 88, 3200 }, // Ü
-    { 13, 24, 18, 5, 24, 78, 3288 }, // Ý
-    { 11, 14, 9, 0, 14, 39, 3366 }, // Þ
-    { 13, 14, 11, 0, 13, 46, 3405 }, // ß
-    { 11, 14, 14, 1, 14, 39, 3451 }, // à
-    { 12, 17, 14, 1, 17, 51, 3490 }, // á
-    { 12, 15, 14, 1, 15, 45, 3541 }, // â
-    { 12, 15, 14, 1, 15, 45, 3586 }, // ã
-    { 13, 15, 14, 1, 15, 49, 3631 }, // ä
-    { 11, 16, 14, 1, 16, 44, 3680 }, // å
-    { 18, 10, 21, 1, 10, 45, 3724 }, // æ
-    { 10, 14, 13, 1, 10, 35, 3769 }, // ç
-    { 12, 16, 14, 1, 16, 48, 3804 }, // è
-    { 13, 19, 14, 1, 19, 62, 3852 }, // é
-    { 13, 17, 14, 1, 17, 56, 3914 }, // ê
-    { 14, 17, 14, 1, 17, 60, 3970 }, // ë
-    { 8, 14, 7, 0, 14, 28, 4030 }, // ì
-    { 9, 17, 7, 0, 17, 39, 4058 }, // í
-    { 10, 15, 7, -1, 15, 38, 4097 }, // î
-    { 10, 14, 7, 0, 14, 35, 4135 }, // ï
-    { 16, 16, 12, 0, 15, 64, 4170 }, // ð
-    { 13, 15, 14, 1, 15, 49, 4234 }, // ñ
-    { 12, 14, 14, 1, 14, 42, 4283 }, // ò
-    { 12, 17, 14, 1, 17, 51, 4325 }, // ó
-    { 12, 15, 14, 1, 15, 45, 4376 }, // ô
-    { 12, 14, 14, 1, 14, 42, 4421 }, // õ
-    { 13, 15, 14, 1, 15, 49, 4463 }, // ö
-    { 13, 12, 15, 3, 12, 39, 4512 }, // ÷
-    { 19, 28, 14, -2, 19, 133, 4551 }, // ø
-    { 11, 14, 14, 2, 14, 39, 4684 }, // ù
-    { 11, 17, 14, 2, 17, 47, 4723 }, // ú
-    { 11, 15, 14, 2, 15, 42, 4770 }, // û
-    { 12, 15, 14, 2, 15, 45, 4812 }, // ü
-    { 15, 24, 15, 0, 19, 90, 4857 }, // ý
-    { 11, 18, 9, 0, 14, 50, 4947 }, // þ
-    { 16, 22, 15, 0, 17, 88, 4997 }, // ÿ
-    { 17, 20, 19, 1, 20, 85, 0 }, // Ā
-    { 13, 15, 14, 1, 15, 49, 85 }, // ā
-    { 17, 20, 19, 1, 20, 85, 134 }, // Ă
-    { 14, 15, 14, 1, 15, 53, 219 }, // ă
-    { 14, 19, 19, 1, 14, 67, 272 }, // Ą
-    { 11, 15, 14, 1, 10, 42, 339 }, // ą
-    { 15, 20, 16, 1, 20, 75, 381 }, // Ć
-    { 11, 14, 13, 1, 14, 39, 456 }, // ć
-    { 16, 21, 16, 1, 21, 84, 495 }, // Ĉ
-    { 13, 15, 13, 1, 15, 49, 579 }, // ĉ
-    { 15, 20, 16, 1, 20, 75, 628 }, // Ċ
-    { 11, 14, 13, 1, 14, 39, 703 }, // ċ
-    { 17, 21, 16, 1, 21, 90, 742 }, // Č
-    { 14, 15, 13, 1, 15, 53, 832 }, // č
-    { 16, 21, 17, 1, 21, 84, 885 }, // Ď
-    { 17, 14, 15, 1, 14, 60, 969 }, // ď
-    { 17, 14, 17, 0, 14, 60, 1029 }, // Đ
-    { 16, 14, 15, 1, 14, 56, 1089 }, // đ
-    { 15, 20, 15, 1, 20, 75, 1145 }, // Ē
-    { 14, 17, 14, 1, 17, 60, 1220 }, // ē
-    { 15, 20, 15, 1, 20, 75, 1280 }, // Ĕ
-    { 14, 17, 14, 1, 17, 60, 1355 }, // ĕ
-    { 14, 20, 15, 1, 20, 70, 1415 }, // Ė
-    { 12, 17, 14, 1, 17, 51, 1485 }, // ė
-    { 14, 19, 15, 1, 14, 67, 1536 }, // Ę
-    { 12, 16, 14, 1, 9, 48, 1603 }, // ę
-    { 16, 22, 15, 1, 22, 88, 1651 }, // Ě
-    { 15, 18, 14, 1, 18, 68, 1739 }, // ě
-    { 18, 23, 19, 1, 23, 104, 1807 }, // Ĝ
-    { 15, 21, 14, 0, 16, 79, 1911 }, // ĝ
-    { 18, 22, 19, 1, 22, 99, 1990 }, // Ğ
-    { 16, 20, 14, 0, 15, 80, 2089 }, // ğ
-    { 16, 22, 19, 1, 22, 88, 2169 }, // Ġ
-    { 14, 20, 14, 0, 15, 70, 2257 }, // ġ
-    { 17, 25, 19, 1, 25, 107, 2327 }, // Ģ
-    { 14, 21, 14, 0, 16, 74, 2434 }, // ģ
-    { 16, 21, 17, 1, 21, 84, 2508 }, // Ĥ
-    { 12, 20, 15, 1, 20, 60, 2592 }, // ĥ
-    { 16, 14, 17, 1, 14, 56, 2652 }, // Ħ
-    { 12, 14, 15, 1, 14, 42, 2708 }, // ħ
-    { 11, 21, 9, 1, 21, 58, 2750 }, // Ĩ
-    { 10, 15, 7, 0, 15, 38, 2808 }, // ĩ
-    { 12, 21, 9, 1, 21, 63, 2846 }, // Ī
-    { 10, 15, 7, 0, 15, 38, 2909 }, // ī
-    { 10, 19, 9, -1, 14, 48, 2947 }, // Į
-    { 11, 20, 7, -2, 15, 55, 2995 }, // į
-    { 10, 21, 9, 1, 21, 53, 3050 }, // İ
-    { 6, 9, 7, 0, 9, 14, 3103 }, // ı
-    { 18, 21, 26, 4, 14, 95, 3117 }, // Ĳ
-    { 17, 19, 7, 0, 15, 81, 3212 }, // ĳ
-    { 17, 25, 15, 0, 21, 107, 3293 }, // Ĵ
-    { 14, 22, 10, 1, 17, 77, 3400 }, // ĵ
-    { 15, 23, 17, 1, 23, 87, 3477 }, // Ķ
-    { 13, 23, 15, -1, 14, 75, 3564 }, // ķ
-    { 10, 9, 11, -2, 9, 23, 3639 }, // ĸ
-    { 11, 19, 15, 1, 19, 53, 3662 }, // Ĺ
-    { 10, 21, 10, 1, 21, 53, 3715 }, // ĺ
-    { 12, 23, 15, 0, 14, 69, 3768 }, // Ļ
-    { 11, 23, 10, -2, 14, 64, 3837 }, // ļ
-    { 12, 14, 15, 1, 14, 42, 3901 }, // Ľ
-    { 13, 17, 10, 1, 17, 56, 3943 }, // ľ
-    { 13, 14, 15, 1, 14, 46, 3999 }, // Ŀ
-    { 10, 14, 10, 1, 14, 35, 4045 }, // ŀ
-    { 26, 24, 15, -8, 19, 156, 4080 }, // Ł
-    { 18, 14, 10, -6, 14, 63, 4236 }, // ł
-    { 16, 20, 17, 1, 20, 80, 4299 }, // Ń
-    { 12, 16, 14, 1, 16, 48, 4379 }, // ń
-    { 16, 21, 17, 1, 14, 84, 4427 }, // Ņ
-    { 12, 17, 14, 1, 10, 51, 4511 }, // ņ
-    { 17, 21, 17, 1, 21, 90, 4562 }, // Ň
-    { 15, 17, 14, 1, 17, 64, 4652 }, // ň
-    { 23, 17, 14, -10, 17, 98, 4716 }, // ŉ
-    { 16, 18, 17, 1, 14, 72, 4814 }, // Ŋ
-    { 12, 14, 14, 1, 10, 42, 4886 }, // ŋ
-    { 17, 21, 19, 1, 20, 90, 4928 }, // Ō
-    { 13, 15, 14, 1, 15, 49, 5018 }, // ō
-    { 17, 21, 19, 1, 20, 90, 5067 }, // Ŏ
-    { 14, 15, 14, 1, 15, 53, 5157 }, // ŏ
-    { 19, 20, 19, 1, 19, 95, 5210 }, // Ő
-    { 16, 14, 14, 1, 14, 56, 5305 }, // ő
-    { 24, 15, 20, 1, 14, 90, 5361 }, // Œ
-    { 19, 9, 18, 1, 9, 43, 5451 }, // œ
-    { 13, 20, 16, 1, 19, 65, 5494 }, // Ŕ
-    { 10, 13, 12, 1, 13, 33, 5559 }, // ŕ
-    { 13, 24, 16, 1, 23, 78, 5592 }, // Ŗ
-    { 10, 17, 12, 1, 17, 43, 5670 }, // ŗ
-    { 15, 22, 16, 1, 21, 83, 5713 }, // Ř
-    { 12, 15, 12, 1, 15, 45, 5796 }, // ř
-    { 15, 20, 17, 1, 20, 75, 5841 }, // Ś
-    { 11, 15, 14, 1, 14, 42, 5916 }, // ś
-    { 16, 21, 17, 1, 21, 84, 5958 }, // Ŝ
-    { 13, 16, 14, 1, 15, 52, 6042 }, // ŝ
-    { 15, 19, 17, 1, 15, 72, 6094 }, // Ş
-    { 11, 14, 14, 1, 10, 39, 6166 }, // ş
-    { 17, 21, 17, 1, 21, 90, 6205 }, // Š
-    { 14, 16, 14, 1, 15, 56, 6295 }, // š
-    { 14, 19, 17, 4, 14, 67, 6351 }, // Ţ
-    { 10, 17, 13, 2, 13, 43, 6418 }, // ţ
-    { 14, 21, 17, 4, 21, 74, 6461 }, // Ť
-    { 13, 15, 13, 3, 15, 49, 6535 }, // ť
-    { 14, 14, 17, 4, 14, 49, 6584 }, // Ŧ
-    { 11, 13, 13, 1, 13, 36, 6633 }, // ŧ
-    { 16, 22, 17, 1, 21, 88, 6669 }, // Ũ
-    { 11, 15, 14, 2, 15, 42, 6757 }, // ũ
-    { 16, 22, 17, 1, 21, 88, 6799 }, // Ū
-    { 12, 15, 14, 2, 15, 45, 6887 }, // ū
-    { 16, 22, 17, 1, 21, 88, 6932 }, // Ŭ
-    { 13, 15, 14, 2, 15, 49, 7020 }, // ŭ
-    { 16, 23, 17, 1, 22, 92, 7069 }, // Ů
-    { 11, 16, 14, 2, 16, 44, 7161 }, // ů
-    { 19, 21, 17, 1, 20, 100, 7205 }, // Ű
-    { 15, 14, 14, 2, 14, 53, 7305 }, // ű
-    { 16, 19, 17, 1, 14, 76, 7358 }, // Ų
-    { 11, 14, 14, 2, 9, 39, 7434 }, // ų
-    { 20, 21, 23, 4, 21, 105, 7473 }, // Ŵ
-    { 15, 18, 18, 3, 16, 68, 7578 }, // ŵ
-    { 13, 22, 18, 5, 22, 72, 7646 }, // Ŷ
-    { 15, 22, 15, 0, 17, 83, 7718 }, // ŷ
-    { 13, 22, 18, 5, 22, 72, 7801 }, // Ÿ
-    { 17, 19, 18, 1, 19, 81, 7873 }, // Ź
-    { 13, 15, 15, 1, 15, 49, 7954 }, // ź
-    { 17, 19, 18, 1, 19, 81, 8003 }, // Ż
-    { 13, 15, 15, 1, 15, 49, 8084 }, // ż
-    { 17, 21, 18, 1, 21, 90, 8133 }, // Ž
-    { 15, 17, 15, 1, 17, 64, 8223 }, // ž
-    { 11, 15, 10, 1, 14, 42, 8287 }, // ſ
-    { 7, 4, 0, 3, 13, 7, 0 }, // ̀
-    { 5, 4, 0, 3, 13, 5, 7 }, // ́
-    { 10, 5, 0, -1, 1, 13, 12 }, // ̂
-    { 8, 4, 0, 3, 12, 8, 25 }, // ̃
-    { 10, 3, 0, 3, 12, 8, 33 }, // ̄
-    { 12, 3, 0, 4, 15, 9, 41 }, // ̅
-    { 9, 4, 0, 3, 12, 9, 50 }, // ̆
-    { 5, 4, 0, 3, 14, 5, 59 }, // ̇
-    { 9, 4, 0, 2, 13, 9, 64 }, // ̈
-    { 4, 5, 0, 6, 11, 5, 73 }, // ̉
-    { 5, 4, 0, 3, 13, 5, 78 }, // ̊
-    { 14, 4, 0, 3, 13, 14, 83 }, // ̋
-    { 10, 5, 0, 3, 13, 13, 97 }, // ̌
-    { 14, 4, 0, -6, 13, 14, 110 }, // ̏
-    { 7, 6, 0, 2, 13, 11, 124 }, // ̒
-    { 7, 6, 0, 2, 13, 11, 135 }, // ̓
-    { 8, 6, 0, -4, 13, 12, 146 }, // ̔
-    { 5, 5, 0, 0, 0, 7, 158 }, // ̘
-    { 6, 5, 0, 0, 0, 8, 165 }, // ̙
-    { 8, 5, 0, 4, 14, 10, 173 }, // ̚
-    { 5, 5, 0, 2, 11, 7, 183 }, // ̛
-    { 4, 6, 0, -1, 0, 6, 190 }, // ̜
-    { 5, 6, 0, 1, 4, 8, 196 }, // ̝
-    { 5, 5, 0, -1, 0, 7, 204 }, // ̞
-    { 4, 5, 0, 0, -1, 5, 211 }, // ̟
-    { 10, 3, 0, -1, -2, 8, 216 }, // ̠
-    { 5, 4, 0, -2, 2, 5, 224 }, // ̣
-    { 9, 4, 0, -2, -1, 9, 229 }, // ̤
-    { 5, 4, 0, 3, 13, 5, 238 }, // ̥
-    { 8, 6, 0, -1, 3, 12, 243 }, // ̦
-    { 6, 6, 0, -1, 1, 9, 255 }, // ̧
-    { 5, 7, 0, 0, 2, 9, 264 }, // ̨
-    { 5, 6, 0, -1, 0, 8, 273 }, // ̩
-    { 8, 4, 0, -1, 0, 8, 281 }, // ̪
-    { 11, 5, 0, -1, 1, 14, 289 }, // ̬
-    { 11, 5, 0, -1, 1, 14, 303 }, // ̭
-    { 8, 4, 0, 4, 14, 8, 317 }, // ̰
-    { 9, 3, 0, 4, 14, 7, 325 }, // ̱
-    { 9, 3, 0, -1, -1, 7, 332 }, // ̲
-    { 9, 4, 0, 4, 14, 9, 339 }, // ̴
-    { 10, 2, 0, 1, 6, 5, 348 }, // ̵
-    { 4, 6, 0, 1, 0, 6, 353 }, // ̹
-    { 10, 6, 0, -3, 1, 15, 359 }, // ̺
-    { 8, 6, 0, -1, 1, 12, 374 }, // ̻
-    { 8, 5, 0, -1, 1, 10, 386 }, // ̼
-    { 6, 4, 0, 3, 13, 6, 396 }, // ̽
-    { 8, 4, 0, 3, 12, 8, 402 }, // ͂
-    { 4, 5, 0, 7, 15, 5, 410 }, // ̓
-    { 10, 12, 0, 3, 21, 30, 415 }, // ̈́
-    { 8, 4, 0, 3, 14, 8, 445 }, // ͆
-    { 11, 7, 0, -2, 0, 20, 453 }, // ͇
-    { 9, 5, 0, -1, 0, 12, 473 }, // ͈
-    { 7, 6, 0, -1, 0, 11, 485 }, // ͉
-    { 13, 14, 0, 2, 18, 46, 496 }, // ͊
-    { 18, 13, 0, 5, 19, 59, 542 }, // ͋
-    { 12, 9, 0, 9, 9, 27, 601 }, // ͌
-    { 9, 19, 0, 1, 6, 43, 628 }, // ͍
-    { 4, 3, 0, 8, 2, 3, 671 }, // ͎
-    { 15, 5, 0, 0, 1, 19, 674 }, // ͜
-    { 15, 5, 0, 3, 14, 19, 693 }, // ͡
-    { 19, 6, 0, -1, 0, 29, 712 }, // ͢
-    { 14, 20, 14, 1, 20, 70, 0 }, // Ѐ
-    { 15, 20, 15, 1, 20, 75, 70 }, // Ё
-    { 15, 16, 11, 2, 15, 60, 145 }, // Ђ
-    { 14, 20, 11, 0, 19, 70, 205 }, // Ѓ
-    { 15, 15, 14, 1, 13, 57, 275 }, // Є
-    { 15, 15, 17, 1, 15, 57, 332 }, // Ѕ
-    { 8, 14, 9, 1, 14, 28, 389 }, // І
-    { 11, 20, 9, 1, 20, 55, 417 }, // Ї
-    { 15, 18, 15, 0, 14, 68, 472 }, // Ј
-    { 18, 15, 19, 1, 13, 68, 540 }, // Љ
-    { 17, 14, 10, -3, 13, 60, 608 }, // Њ
-    { 14, 16, 17, 4, 16, 56, 668 }, // Ћ
-    { 15, 19, 17, 1, 19, 72, 724 }, // Ќ
-    { 15, 18, 16, 1, 18, 68, 796 }, // Ѝ
-    { 14, 22, 13, 0, 20, 77, 864 }, // Ў
-    { 14, 17, 13, 1, 13, 60, 941 }, // Џ
-    { 14, 14, 19, 1, 14, 49, 1001 }, // А
-    { 12, 13, 11, 1, 13, 39, 1050 }, // Б
-    { 12, 14, 11, 1, 13, 42, 1089 }, // В
-    { 14, 14, 11, 0, 13, 49, 1131 }, // Г
-    { 14, 15, 14, 1, 13, 53, 1180 }, // Д
-    { 14, 15, 14, 1, 15, 53, 1233 }, // Е
-    { 24, 14, 25, 0, 14, 84, 1286 }, // Ж
-    { 11, 14, 11, 1, 13, 39, 1370 }, // З
-    { 15, 14, 16, 1, 14, 53, 1409 }, // И
-    { 15, 19, 16, 1, 19, 72, 1462 }, // Й
-    { 15, 14, 17, 1, 14, 53, 1534 }, // К
-    { 15, 15, 10, -1, 13, 57, 1587 }, // Л
-    { 17, 14, 14, 0, 13, 60, 1644 }, // М
-    { 16, 14, 17, 1, 14, 56, 1704 }, // Н
-    { 17, 15, 19, 1, 14, 64, 1760 }, // О
-    { 14, 14, 11, 0, 13, 49, 1824 }, // П
-    { 14, 15, 15, 1, 15, 53, 1873 }, // Р
-    { 15, 15, 16, 1, 15, 57, 1926 }, // С
-    { 14, 14, 17, 4, 14, 49, 1983 }, // Т
-    { 14, 15, 13, 0, 13, 53, 2032 }, // У
-    { 13, 13, 15, 3, 13, 43, 2085 }, // Ф
-    { 17, 14, 18, 1, 14, 60, 2128 }, // Х
-    { 14, 17, 12, 0, 13, 60, 2188 }, // Ц
-    { 11, 13, 11, 2, 13, 36, 2248 }, // Ч
-    { 16, 14, 14, 0, 13, 56, 2284 }, // Ш
-    { 16, 16, 15, 0, 13, 64, 2340 }, // Щ
-    { 12, 13, 10, -1, 12, 39, 2404 }, // Ъ
-    { 19, 15, 19, 0, 14, 72, 2443 }, // Ы
-    { 11, 13, 10, 0, 12, 36, 2515 }, // Ь
-    { 15, 15, 16, 1, 13, 57, 2551 }, // Э
-    { 16, 14, 15, 1, 13, 56, 2608 }, // Ю
-    { 15, 15, 15, 0, 14, 57, 2664 }, // Я
-    { 11, 10, 14, 1, 10, 28, 2721 }, // а
-    { 14, 16, 12, 1, 15, 56, 2749 }, // б
-    { 11, 9, 12, -1, 9, 25, 2805 }, // в
-    { 12, 11, 10, 0, 9, 33, 2830 }, // г
-    { 12, 12, 13, 1, 9, 36, 2863 }, // д
-    { 12, 9, 14, 1, 9, 27, 2899 }, // е
-    { 24, 12, 25, 0, 12, 72, 2926 }, // ж
-    { 9, 9, 8, -2, 9, 21, 2998 }, // з
-    { 13, 11, 11, 0, 9, 36, 3019 }, // и
-    { 12, 14, 11, 0, 14, 42, 3055 }, // й
-    { 12, 9, 13, -1, 9, 27, 3097 }, // к
-    { 10, 10, 7, -2, 9, 25, 3124 }, // л
-    { 13, 11, 14, -1, 11, 36, 3149 }, // м
-    { 14, 11, 14, -1, 11, 39, 3185 }, // н
-    { 12, 9, 14, 1, 9, 27, 3224 }, // о
-    { 13, 11, 11, 0, 9, 36, 3251 }, // п
-    { 15, 15, 16, -1, 10, 57, 3287 }, // р
-    { 10, 10, 13, 1, 10, 25, 3344 }, // с
-    { 12, 11, 11, 2, 9, 33, 3369 }, // т
-    { 15, 14, 15, 0, 9, 53, 3402 }, // у
-    { 15, 13, 15, 1, 9, 49, 3455 }, // ф
-    { 14, 11, 12, 0, 9, 39, 3504 }, // х
-    { 12, 12, 12, 1, 9, 36, 3543 }, // ц
-    { 8, 9, 8, 0, 9, 18, 3579 }, // ч
-    { 16, 10, 14, 0, 9, 40, 3597 }, // ш
-    { 16, 13, 15, 0, 9, 52, 3637 }, // щ
-    { 9, 11, 8, -2, 10, 25, 3689 }, // ъ
-    { 14, 12, 15, -1, 11, 42, 3714 }, // ы
-    { 8, 11, 8, -1, 10, 22, 3756 }, // ь
-    { 10, 11, 11, 1, 10, 28, 3778 }, // э
-    { 13, 11, 12, 0, 10, 36, 3806 }, // ю
-    { 10, 11, 14, 1, 11, 28, 3842 }, // я
-    { 12, 17, 14, 1, 17, 51, 3870 }, // ѐ
-    { 13, 16, 14, 1, 16, 52, 3921 }, // ё
-    { 12, 18, 15, 1, 14, 54, 3973 }, // ђ
-    { 12, 15, 10, 0, 13, 45, 4027 }, // ѓ
-    { 10, 10, 10, -1, 9, 25, 4072 }, // є
-    { 11, 11, 14, 1, 10, 31, 4097 }, // ѕ
-    { 9, 15, 7, 0, 15, 34, 4128 }, // і
-    { 10, 14, 7, 0, 14, 35, 4162 }, // ї
-    { 11, 20, 10, 1, 15, 55, 4197 }, // ј
-    { 13, 10, 13, -1, 9, 33, 4252 }, // љ
-    { 12, 10, 7, -4, 9, 30, 4285 }, // њ
-    { 12, 14, 15, 1, 14, 42, 4315 }, // ћ
-    { 13, 14, 13, -1, 14, 46, 4357 }, // ќ
-    { 13, 17, 11, 0, 15, 56, 4403 }, // ѝ
-    { 16, 22, 15, 0, 17, 88, 4459 }, // ў
-    { 11, 13, 10, -1, 10, 36, 4547 }, // џ
-    { 10, 14, 12, 3, 13, 35, 4583 }, // Ѣ
-    { 11, 14, 11, 2, 13, 39, 4618 }, // ѣ
-    { 18, 14, 14, -1, 13, 63, 4657 }, // Ѫ
-    { 13, 11, 10, -2, 10, 36, 4720 }, // ѫ
-    { 19, 18, 19, 1, 18, 86, 4756 }, // Ѳ
-    { 15, 13, 14, 1, 13, 49, 4842 }, // ѳ
-    { 17, 17, 18, 5, 17, 73, 4891 }, // Ѵ
-    { 12, 11, 14, 3, 11, 33, 4964 }, // ѵ
-    { 8, 6, 0, 5, 16, 12, 4997 }, // ҆
-    { 14, 15, 11, 0, 14, 53, 5009 }, // Ґ
-    { 13, 14, 10, 0, 12, 46, 5062 }, // ґ
-    { 14, 14, 11, 0, 13, 49, 5108 }, // Ғ
-    { 10, 9, 8, -2, 9, 23, 5157 }, // ғ
-    { 13, 16, 10, 0, 15, 52, 5180 }, // Ҕ
-    { 9, 10, 6, -2, 9, 23, 5232 }, // ҕ
-    { 24, 17, 25, 0, 14, 102, 5255 }, // Җ
-    { 17, 11, 17, -2, 9, 47, 5357 }, // җ
-    { 11, 16, 11, 1, 13, 44, 5404 }, // Ҙ
-    { 9, 13, 8, -2, 9, 30, 5448 }, // ҙ
-    { 15, 17, 12, 0, 14, 64, 5478 }, // Қ
-    { 11, 11, 8, -2, 9, 31, 5542 }, // қ
-    { 18, 14, 18, 1, 13, 63, 5573 }, // Ҝ
-    { 13, 9, 12, 0, 9, 30, 5636 }, // ҝ
-    { 15, 14, 17, 1, 14, 53, 5666 }, // Ҟ
-    { 11, 14, 15, 1, 14, 39, 5719 }, // ҟ
-    { 15, 14, 17, 1, 14, 53, 5758 }, // Ҡ
-    { 10, 9, 12, -1, 9, 23, 5811 }, // ҡ
-    { 17, 17, 13, -2, 14, 73, 5834 }, // Ң
-    { 12, 11, 9, -3, 9, 33, 5907 }, // ң
-    { 22, 14, 17, 1, 14, 77, 5940 }, // Ҥ
-    { 16, 9, 12, -1, 9, 36, 6017 }, // ҥ
-    { 20, 16, 21, 1, 15, 80, 6053 }, // Ҧ
-    { 16, 17, 21, 3, 12, 68, 6133 }, // ҧ
-    { 18, 14, 11, -2, 13, 63, 6201 }, // Ҩ
-    { 14, 11, 17, 1, 10, 39, 6264 }, // ҩ
-    { 15, 17, 16, 1, 15, 64, 6303 }, // Ҫ
-    { 10, 12, 13, 1, 10, 30, 6367 }, // ҫ
-    { 14, 16, 13, 2, 14, 56, 6397 }, // Ҭ
-    { 10, 11, 9, -1, 9, 28, 6453 }, // ҭ
-    { 13, 14, 18, 5, 14, 46, 6481 }, // Ү
-    { 11, 13, 13, 3, 9, 36, 6527 }, // ү
-    { 15, 14, 18, 3, 14, 53, 6563 }, // Ұ
-    { 14, 14, 13, 0, 10, 49, 6616 }, // ұ
-    { 17, 17, 13, 1, 14, 73, 6665 }, // Ҳ
-    { 13, 11, 13, 0, 9, 36, 6738 }, // ҳ
-    { 14, 16, 10, 0, 13, 56, 6774 }, // Ҵ
-    { 11, 12, 15, 2, 9, 33, 6830 }, // ҵ
-    { 11, 17, 11, 2, 13, 47, 6863 }, // Ҷ
-    { 8, 12, 8, 0, 9, 24, 6910 }, // ҷ
-    { 11, 13, 11, 2, 13, 36, 6934 }, // Ҹ
-    { 8, 9, 8, 0, 9, 18, 6970 }, // ҹ
-    { 12, 15, 11, 0, 14, 45, 6988 }, // Һ
-    { 12, 14, 15, 1, 14, 42, 7033 }, // һ
-    { 19, 13, 24, 3, 12, 62, 7075 }, // Ҽ
-    { 14, 9, 12, 1, 9, 32, 7137 }, // ҽ
-    { 19, 15, 15, 4, 12, 72, 7169 }, // Ҿ
-    { 15, 12, 11, 1, 10, 45, 7241 }, // ҿ
-    { 8, 14, 9, 1, 14, 28, 7286 }, // Ӏ
-    { 24, 23, 25, 0, 23, 138, 7314 }, // Ӂ
-    { 24, 19, 25, 0, 19, 114, 7452 }, // ӂ
-    { 14, 18, 12, 0, 13, 63, 7566 }, // Ӄ
-    { 10, 13, 8, -2, 9, 33, 7629 }, // ӄ
-    { 15, 17, 10, -1, 13, 64, 7662 }, // Ӆ
-    { 10, 12, 7, -1, 9, 30, 7726 }, // ӆ
-    { 16, 19, 17, 1, 14, 76, 7756 }, // Ӈ
-    { 11, 13, 12, -1, 9, 36, 7832 }, // ӈ
-    { 16, 20, 17, 1, 14, 80, 7868 }, // Ӊ
-    { 12, 13, 12, 0, 9, 39, 7948 }, // ӊ
-    { 12, 17, 11, 2, 13, 51, 7987 }, // Ӌ
-    { 8, 12, 10, 1, 9, 24, 8038 }, // ӌ
-    { 18, 20, 19, 1, 14, 90, 8062 }, // Ӎ
-    { 13, 13, 13, 0, 9, 43, 8152 }, // ӎ
-    { 7, 13, 10, 3, 12, 23, 8195 }, // ӏ
-    { 17, 20, 19, 1, 20, 85, 8218 }, // Ӑ
-    { 14, 15, 14, 1, 15, 53, 8303 }, // ӑ
-    { 16, 19, 19, 1, 19, 76, 8356 }, // Ӓ
-    { 14, 15, 14, 1, 15, 53, 8432 }, // ӓ
-    { 23, 15, 23, 1, 14, 87, 8485 }, // Ӕ
-    { 18, 10, 21, 1, 10, 45, 8572 }, // ӕ
-    { 16, 20, 14, 1, 20, 80, 8617 }, // Ӗ
-    { 14, 17, 14, 1, 17, 60, 8697 }, // ӗ
-    { 15, 14, 18, 5, 13, 53, 8757 }, // Ә
-    { 11, 11, 14, 5, 10, 31, 8810 }, // ә
-    { 15, 20, 18, 5, 19, 75, 8841 }, // Ӛ
-    { 12, 14, 14, 4, 10, 42, 8916 }, // ӛ
-    { 24, 22, 23, 2, 22, 132, 8958 }, // Ӝ
-    { 24, 19, 25, 0, 19, 114, 9090 }, // ӝ
-    { 13, 22, 11, 1, 21, 72, 9204 }, // Ӟ
-    { 12, 13, 8, -2, 13, 39, 9276 }, // ӟ
-    { 11, 14, 11, 2, 13, 39, 9315 }, // Ӡ
-    { 11, 14, 11, 1, 10, 39, 9354 }, // ӡ
-    { 15, 19, 15, 1, 19, 72, 9393 }, // Ӣ
-    { 14, 17, 11, 0, 15, 60, 9465 }, // ӣ
-    { 15, 18, 16, 1, 18, 68, 9525 }, // Ӥ
-    { 13, 16, 11, 0, 14, 52, 9593 }, // ӥ
-    { 17, 20, 19, 1, 19, 85, 9645 }, // Ӧ
-    { 12, 16, 14, 1, 16, 48, 9730 }, // ӧ
-    { 15, 14, 18, 2, 14, 53, 9778 }, // Ө
-    { 12, 9, 14, 1, 9, 27, 9831 }, // ө
-    { 15, 19, 18, 2, 19, 72, 9858 }, // Ӫ
-    { 12, 14, 14, 1, 14, 42, 9930 }, // ӫ
-    { 25, 22, 16, 1, 20, 138, 9972 }, // Ӭ
-    { 11, 15, 11, 1, 14, 42, 10110 }, // ӭ
-    { 14, 22, 13, 0, 20, 77, 10152 }, // Ӯ
-    { 16, 22, 15, 0, 17, 88, 10229 }, // ӯ
-    { 14, 21, 13, 0, 19, 74, 10317 }, // Ӱ
-    { 15, 22, 15, 0, 17, 83, 10391 }, // ӱ
-    { 16, 21, 13, 0, 19, 84, 10474 }, // Ӳ
-    { 18, 21, 15, 0, 16, 95, 10558 }, // ӳ
-    { 11, 17, 11, 2, 17, 47, 10653 }, // Ӵ
-    { 9, 13, 8, 0, 13, 30, 10700 }, // ӵ
-    { 14, 16, 11, 0, 13, 56, 10730 }, // Ӷ
-    { 10, 11, 8, -2, 9, 28, 10786 }, // ӷ
-    { 19, 22, 19, 0, 21, 105, 10814 }, // Ӹ
-    { 15, 19, 15, -1, 18, 72, 10919 }, // ӹ
-    { 17, 16, 18, 1, 14, 68, 10991 }, // Ӽ
-    { 12, 11, 13, -1, 9, 33, 11059 }, // ӽ
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 10, 2, 9, 1, 6, 5, 0 }, // ‐
-    { 10, 2, 9, 1, 6, 5, 5 }, // ‑
-    { 15, 2, 9, -1, 6, 8, 10 }, // ‒
-    { 14, 4, 13, 1, 7, 14, 18 }, // –
-    { 19, 4, 19, 1, 7, 19, 32 }, // —
-    { 19, 4, 19, 1, 7, 19, 51 }, // ―
-    { 12, 16, 9, 1, 13, 48, 70 }, // ‖
-    { 16, 6, 9, -4, -1, 24, 118 }, // ‗
-    { 8, 6, 7, 3, 15, 12, 142 }, // ‘
-    { 8, 6, 7, 3, 15, 12, 154 }, // ’
-    { 7, 6, 5, -1, 3, 11, 166 }, // ‚
-    { 8, 6, 7, 3, 15, 12, 177 }, // ‛
-    { 13, 6, 13, 3, 15, 20, 189 }, // “
-    { 13, 6, 13, 3, 15, 20, 209 }, // ”
-    { 7, 6, 5, -1, 3, 11, 229 }, // „
-    { 13, 6, 13, 3, 15, 20, 240 }, // ‟
-    { 10, 24, 13, 4, 18, 60, 260 }, // †
-    { 12, 23, 14, 3, 17, 69, 320 }, // ‡
-    { 15, 13, 8, -2, 15, 49, 389 }, // •
-    { 6, 7, 10, 3, 8, 11, 438 }, // ‣
-    { 5, 4, 10, 3, 4, 5, 449 }, // ․
-    { 5, 4, 10, 3, 4, 5, 454 }, // ‥
-    { 16, 4, 16, 0, 4, 16, 459 }, // …
-    { 3, 2, 9, 3, 6, 2, 475 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 477 }, //  
-    { 16, 15, 19, 2, 13, 60, 477 }, // ‰
-    { 8, 6, 9, 5, 15, 12, 537 }, // ′
-    { 13, 6, 13, 5, 15, 20, 549 }, // ″
-    { 13, 6, 7, -2, 14, 20, 569 }, // ‴
-    { 5, 6, 7, 4, 14, 8, 589 }, // ‵
-    { 8, 6, 7, 3, 14, 12, 597 }, // ‶
-    { 13, 6, 7, 0, 14, 20, 609 }, // ‷
-    { 10, 4, 11, 3, 14, 10, 629 }, // ‸
-    { 7, 10, 7, 2, 10, 18, 639 }, // ‹
-    { 7, 10, 7, -2, 10, 18, 657 }, // ›
-    { 22, 22, 23, 1, 17, 121, 675 }, // ※
-    { 10, 22, 10, 1, 19, 55, 796 }, // ‼
-    { 13, 27, 14, 3, 23, 88, 851 }, // ‽
-    { 10, 2, 9, 3, 14, 5, 939 }, // ‾
-    { 9, 4, 13, 3, 11, 9, 944 }, // ‿
-    { 13, 12, 11, 1, 15, 39, 953 }, // ⁂
-    { 16, 15, 22, 3, 13, 60, 992 }, // ⁄
-    { 23, 21, 25, 4, 19, 121, 1052 }, // ⁇
-    { 20, 22, 20, 3, 19, 110, 1173 }, // ⁈
-    { 18, 22, 13, -1, 19, 99, 1283 }, // ⁉
-    { 19, 29, 15, -1, 20, 138, 1382 }, // ⁒
-    { 0, 0, 78, 0, 0, 0, 1520 }, //  
-    { 6, 7, 6, 6, 14, 11, 0 }, // ⁰
-    { 6, 6, 6, 6, 14, 9, 11 }, // ⁴
-    { 6, 8, 6, 6, 14, 12, 20 }, // ⁵
-    { 6, 7, 6, 6, 14, 11, 32 }, // ⁶
-    { 6, 8, 6, 7, 15, 12, 43 }, // ⁷
-    { 6, 7, 6, 6, 14, 11, 55 }, // ⁸
-    { 6, 8, 6, 6, 14, 12, 66 }, // ⁹
-    { 12, 10, 14, 1, 10, 30, 78 }, // ⁿ
-    { 6, 7, 6, -5, 4, 11, 108 }, // ₀
-    { 6, 7, 6, -6, 4, 11, 119 }, // ₁
-    { 7, 7, 6, -6, 4, 13, 130 }, // ₂
-    { 7, 7, 6, -6, 4, 13, 143 }, // ₃
-    { 6, 7, 6, -5, 4, 11, 156 }, // ₄
-    { 6, 8, 6, -5, 5, 12, 167 }, // ₅
-    { 7, 7, 6, -6, 4, 13, 179 }, // ₆
-    { 6, 8, 6, -4, 5, 12, 192 }, // ₇
-    { 6, 7, 6, -5, 4, 11, 204 }, // ₈
-    { 6, 8, 6, -5, 4, 12, 215 }, // ₉
-    { 12, 23, 8, 1, 17, 69, 227 }, // ₍
-    { 11, 23, 7, -5, 17, 64, 296 }, // ₎
-    { 16, 22, 16, 2, 18, 88, 0 }, // ₡
-    { 15, 15, 16, 1, 15, 57, 88 }, // ₢
-    { 13, 14, 12, 0, 13, 46, 145 }, // ₤
-    { 20, 14, 17, -1, 14, 70, 191 }, // ₦
-    { 16, 15, 15, 1, 15, 60, 261 }, // ₧
-    { 21, 15, 22, -1, 14, 79, 321 }, // ₨
-    { 15, 14, 14, -1, 14, 53, 400 }, // ₩
-    { 17, 13, 18, 2, 13, 56, 453 }, // ₪
-    { 15, 14, 9, -1, 13, 53, 509 }, // ₫
-    { 14, 17, 14, 1, 14, 60, 562 }, // €
-    { 14, 14, 17, 4, 14, 49, 622 }, // ₮
-    { 18, 15, 11, 0, 15, 68, 671 }, // ₱
-    { 16, 22, 19, 1, 19, 88, 739 }, // ₲
-    { 19, 15, 17, 5, 14, 72, 827 }, // ₴
-    { 10, 13, 10, 1, 11, 33, 899 }, // ₵
-    { 16, 16, 17, 4, 16, 64, 932 }, // ₸
-    { 12, 13, 12, 2, 12, 39, 996 }, // ₹
-    { 11, 13, 12, 1, 11, 36, 1035 }, // ₺
-    { 14, 15, 14, 2, 14, 53, 1071 }, // ₼
-    { 17, 15, 15, -2, 15, 64, 1124 }, // ₽
-    { 12, 12, 12, -3, 9, 36, 0 }, // ←
-    { 12, 12, 13, 2, 10, 36, 36 }, // ↑
-    { 12, 12, 13, 3, 9, 36, 72 }, // →
-    { 13, 12, 13, 4, 11, 39, 108 }, // ↓
-    { 19, 10, 17, -1, 8, 48, 147 }, // ↔
-    { 10, 19, 13, 3, 18, 48, 195 }, // ↕
-    { 11, 8, 13, -1, 8, 22, 243 }, // ↖
-    { 11, 8, 11, 2, 8, 22, 265 }, // ↗
-    { 10, 11, 11, 3, 9, 28, 287 }, // ↘
-    { 10, 11, 11, -2, 9, 28, 315 }, // ↙
-    { 14, 11, 16, 0, 10, 39, 343 }, // ⇐
-    { 15, 14, 18, 3, 13, 53, 382 }, // ⇑
-    { 14, 11, 16, 2, 10, 39, 435 }, // ⇒
-    { 15, 14, 18, 6, 13, 53, 474 }, // ⇓
-    { 18, 11, 18, 0, 10, 50, 527 }, // ⇔
-    { 12, 17, 15, 4, 9, 51, 577 }, // ⇕
-    { 13, 16, 11, 1, 15, 52, 0 }, // ∂
-    { 18, 16, 19, 0, 15, 72, 52 }, // ∅
-    { 14, 14, 14, 0, 13, 49, 124 }, // ∆
-    { 13, 14, 12, 2, 13, 46, 173 }, // ∏
-    { 13, 14, 12, 5, 13, 46, 219 }, // ∐
-    { 13, 14, 10, 0, 13, 46, 265 }, // ∑
-    { 10, 3, 10, 1, 6, 8, 311 }, // −
-    { 17, 15, 16, 2, 14, 64, 319 }, // √
-    { 16, 10, 15, 1, 11, 40, 383 }, // ∞
-    { 17, 18, 14, 0, 13, 77, 423 }, // ∫
-    { 8, 12, 5, 0, 12, 24, 500 }, // ∶
-    { 12, 9, 24, 9, 9, 27, 524 }, // ≈
-    { 16, 15, 22, 3, 14, 60, 551 }, // ≠
-    { 16, 15, 13, -2, 13, 60, 611 }, // ≤
-    { 16, 14, 14, 0, 12, 56, 671 }, // ≥
+    { 12, 10, 14, 1, 10, 30, 4143 }, // «
+    { 10, 6, 10, 1, 6, 15, 339 }, // ¬
+    { 10, 2, 10, 1, 6, 5, 354 }, // ­
+    { 9, 7, 11, 5, 18, 16, 359 }, // ®
+    { 8, 3, 9, 3, 13, 6, 375 }, // ¯
+    { 10, 8, 11, 3, 13, 20, 381 }, // °
+    { 13, 12, 14, 0, 9, 39, 401 }, // ±
+    { 6, 7, 5, 6, 14, 11, 440 }, // ²
+    { 6, 7, 6, 6, 14, 11, 451 }, // ³
+    { 5, 4, 5, 3, 13, 5, 462 }, // ´
+    { 14, 12, 14, -1, 9, 42, 467 }, // µ
+    { 13, 15, 13, 1, 12, 49, 509 }, // ¶
+    { 5, 4, 4, 1, 8, 5, 558 }, // ·
+    { 6, 6, 5, -1, 1, 9, 563 }, // ¸
+    { 5, 7, 5, 6, 14, 9, 572 }, // ¹
+    { 7, 6, 11, 5, 13, 11, 581 }, // º
+    { 12, 10, 12, -3, 10, 30, 4173 }, // »
+    { 18, 17, 22, 1, 15, 77, 592 }, // ¼
+    { 19, 17, 22, 1, 15, 81, 669 }, // ½
+    { 18, 15, 22, 1, 13, 68, 750 }, // ¾
+    { 12, 21, 11, -1, 12, 63, 818 }, // ¿
+    { 14, 19, 19, 1, 19, 67, 4203 }, // À
+    { 15, 22, 19, 1, 22, 83, 4270 }, // Á
+    { 15, 20, 19, 1, 20, 75, 4353 }, // Â
+    { 15, 19, 19, 1, 19, 72, 881 }, // Ã
+    { 16, 20, 19, 1, 20, 80, 4428 }, // Ä
+    { 15, 20, 19, 1, 20, 75, 953 }, // Å
+    { 23, 15, 23, 1, 14, 87, 1028 }, // Æ
+    { 15, 19, 16, 1, 15, 72, 4508 }, // Ç
+    { 14, 19, 15, 1, 19, 67, 4580 }, // È
+    { 14, 22, 15, 1, 22, 77, 4647 }, // É
+    { 14, 20, 15, 1, 20, 70, 4724 }, // Ê
+    { 15, 20, 15, 1, 20, 75, 4794 }, // Ë
+    { 10, 20, 9, 1, 20, 50, 4869 }, // Ì
+    { 11, 23, 9, 1, 23, 64, 4919 }, // Í
+    { 11, 21, 9, 1, 21, 58, 4983 }, // Î
+    { 12, 21, 9, 1, 21, 63, 5041 }, // Ï
+    { 17, 14, 17, 0, 14, 60, 1115 }, // Ð
+    { 16, 19, 17, 1, 19, 76, 5104 }, // Ñ
+    { 17, 20, 19, 1, 19, 85, 5180 }, // Ò
+    { 17, 23, 19, 1, 22, 98, 5265 }, // Ó
+    { 17, 21, 19, 1, 20, 90, 5363 }, // Ô
+    { 17, 20, 19, 1, 19, 85, 1175 }, // Õ
+    { 17, 21, 19, 1, 20, 90, 5453 }, // Ö
+    { 11, 6, 10, 0, 7, 17, 1260 }, // ×
+    { 34, 30, 19, -7, 22, 255, 1277 }, // Ø
+    { 16, 21, 17, 1, 20, 84, 5543 }, // Ù
+    { 16, 24, 17, 1, 23, 96, 5627 }, // Ú
+    { 16, 22, 17, 1, 21, 88, 5723 }, // Û
+    { 16, 22, 17, 1, 21, 88, 5811 }, // Ü
+    { 13, 24, 18, 5, 24, 78, 1532 }, // Ý
+    { 11, 14, 9, 0, 14, 39, 1610 }, // Þ
+    { 13, 14, 11, 0, 13, 46, 1649 }, // ß
+    { 11, 14, 14, 1, 14, 39, 5899 }, // à
+    { 12, 17, 14, 1, 17, 51, 5938 }, // á
+    { 12, 15, 14, 1, 15, 45, 5989 }, // â
+    { 12, 15, 14, 1, 15, 45, 1695 }, // ã
+    { 13, 15, 14, 1, 15, 49, 6034 }, // ä
+    { 11, 16, 14, 1, 16, 44, 1740 }, // å
+    { 18, 10, 21, 1, 10, 45, 1784 }, // æ
+    { 10, 14, 13, 1, 10, 35, 6083 }, // ç
+    { 12, 16, 14, 1, 16, 48, 6118 }, // è
+    { 13, 19, 14, 1, 19, 62, 6166 }, // é
+    { 13, 17, 14, 1, 17, 56, 6228 }, // ê
+    { 14, 17, 14, 1, 17, 60, 6284 }, // ë
+    { 8, 14, 7, 0, 14, 28, 6344 }, // ì
+    { 9, 17, 7, 0, 17, 39, 6372 }, // í
+    { 10, 15, 7, -1, 15, 38, 6411 }, // î
+    { 10, 14, 7, 0, 14, 35, 6449 }, // ï
+    { 16, 16, 12, 0, 15, 64, 1829 }, // ð
+    { 13, 15, 14, 1, 15, 49, 6484 }, // ñ
+    { 12, 14, 14, 1, 14, 42, 6533 }, // ò
+    { 12, 17, 14, 1, 17, 51, 6575 }, // ó
+    { 12, 15, 14, 1, 15, 45, 6626 }, // ô
+    { 12, 14, 14, 1, 14, 42, 1893 }, // õ
+    { 13, 15, 14, 1, 15, 49, 6671 }, // ö
+    { 13, 12, 15, 3, 12, 39, 1935 }, // ÷
+    { 19, 28, 14, -2, 19, 133, 1974 }, // ø
+    { 11, 14, 14, 2, 14, 39, 6720 }, // ù
+    { 11, 17, 14, 2, 17, 47, 6759 }, // ú
+    { 11, 15, 14, 2, 15, 42, 6806 }, // û
+    { 12, 15, 14, 2, 15, 45, 6848 }, // ü
+    { 15, 24, 15, 0, 19, 90, 2107 }, // ý
+    { 11, 18, 9, 0, 14, 50, 2197 }, // þ
+    { 16, 22, 15, 0, 17, 88, 2247 }, // ÿ
+    { 17, 20, 19, 1, 20, 85, 2335 }, // Ā
+    { 13, 15, 14, 1, 15, 49, 2420 }, // ā
+    { 17, 20, 19, 1, 20, 85, 2469 }, // Ă
+    { 14, 15, 14, 1, 15, 53, 2554 }, // ă
+    { 14, 19, 19, 1, 14, 67, 2607 }, // Ą
+    { 11, 15, 14, 1, 10, 42, 2674 }, // ą
+    { 15, 20, 16, 1, 20, 75, 2716 }, // Ć
+    { 11, 14, 13, 1, 14, 39, 2791 }, // ć
+    { 16, 21, 16, 1, 21, 84, 2830 }, // Ĉ
+    { 13, 15, 13, 1, 15, 49, 2914 }, // ĉ
+    { 15, 20, 16, 1, 20, 75, 2963 }, // Ċ
+    { 11, 14, 13, 1, 14, 39, 3038 }, // ċ
+    { 17, 21, 16, 1, 21, 90, 3077 }, // Č
+    { 14, 15, 13, 1, 15, 53, 3167 }, // č
+    { 16, 21, 17, 1, 21, 84, 3220 }, // Ď
+    { 17, 14, 15, 1, 14, 60, 3304 }, // ď
+    { 17, 14, 17, 0, 14, 60, 3364 }, // Đ
+    { 16, 14, 15, 1, 14, 56, 3424 }, // đ
+    { 15, 20, 15, 1, 20, 75, 3480 }, // Ē
+    { 14, 17, 14, 1, 17, 60, 3555 }, // ē
+    { 15, 20, 15, 1, 20, 75, 3615 }, // Ĕ
+    { 14, 17, 14, 1, 17, 60, 3690 }, // ĕ
+    { 14, 20, 15, 1, 20, 70, 3750 }, // Ė
+    { 12, 17, 14, 1, 17, 51, 3820 }, // ė
+    { 14, 19, 15, 1, 14, 67, 3871 }, // Ę
+    { 12, 16, 14, 1, 9, 48, 3938 }, // ę
+    { 16, 22, 15, 1, 22, 88, 3986 }, // Ě
+    { 15, 18, 14, 1, 18, 68, 4074 }, // ě
+    { 18, 23, 19, 1, 23, 104, 4142 }, // Ĝ
+    { 15, 21, 14, 0, 16, 79, 4246 }, // ĝ
+    { 18, 22, 19, 1, 22, 99, 4325 }, // Ğ
+    { 16, 20, 14, 0, 15, 80, 4424 }, // ğ
+    { 16, 22, 19, 1, 22, 88, 4504 }, // Ġ
+    { 14, 20, 14, 0, 15, 70, 4592 }, // ġ
+    { 17, 25, 19, 1, 25, 107, 4662 }, // Ģ
+    { 14, 21, 14, 0, 16, 74, 4769 }, // ģ
+    { 16, 21, 17, 1, 21, 84, 4843 }, // Ĥ
+    { 12, 20, 15, 1, 20, 60, 4927 }, // ĥ
+    { 16, 14, 17, 1, 14, 56, 4987 }, // Ħ
+    { 12, 14, 15, 1, 14, 42, 5043 }, // ħ
+    { 11, 21, 9, 1, 21, 58, 5085 }, // Ĩ
+    { 10, 15, 7, 0, 15, 38, 5143 }, // ĩ
+    { 12, 21, 9, 1, 21, 63, 5181 }, // Ī
+    { 10, 15, 7, 0, 15, 38, 5244 }, // ī
+    { 10, 19, 9, -1, 14, 48, 5282 }, // Į
+    { 11, 20, 7, -2, 15, 55, 5330 }, // į
+    { 10, 21, 9, 1, 21, 53, 5385 }, // İ
+    { 6, 9, 7, 0, 9, 14, 5438 }, // ı
+    { 18, 21, 26, 4, 14, 95, 5452 }, // Ĳ
+    { 17, 19, 7, 0, 15, 81, 5547 }, // ĳ
+    { 17, 25, 15, 0, 21, 107, 5628 }, // Ĵ
+    { 14, 22, 10, 1, 17, 77, 5735 }, // ĵ
+    { 15, 23, 17, 1, 23, 87, 5812 }, // Ķ
+    { 13, 23, 15, -1, 14, 75, 5899 }, // ķ
+    { 10, 9, 11, -2, 9, 23, 5974 }, // ĸ
+    { 11, 19, 15, 1, 19, 53, 5997 }, // Ĺ
+    { 10, 21, 10, 1, 21, 53, 6050 }, // ĺ
+    { 12, 23, 15, 0, 14, 69, 6103 }, // Ļ
+    { 11, 23, 10, -2, 14, 64, 6172 }, // ļ
+    { 12, 14, 15, 1, 14, 42, 6236 }, // Ľ
+    { 13, 17, 10, 1, 17, 56, 6278 }, // ľ
+    { 13, 14, 15, 1, 14, 46, 6334 }, // Ŀ
+    { 10, 14, 10, 1, 14, 35, 6380 }, // ŀ
+    { 26, 24, 15, -8, 19, 156, 6415 }, // Ł
+    { 18, 14, 10, -6, 14, 63, 6571 }, // ł
+    { 16, 20, 17, 1, 20, 80, 6634 }, // Ń
+    { 12, 16, 14, 1, 16, 48, 6714 }, // ń
+    { 16, 21, 17, 1, 14, 84, 6762 }, // Ņ
+    { 12, 17, 14, 1, 10, 51, 6846 }, // ņ
+    { 17, 21, 17, 1, 21, 90, 6897 }, // Ň
+    { 15, 17, 14, 1, 17, 64, 6987 }, // ň
+    { 23, 17, 14, -10, 17, 98, 7051 }, // ŉ
+    { 16, 18, 17, 1, 14, 72, 7149 }, // Ŋ
+    { 12, 14, 14, 1, 10, 42, 7221 }, // ŋ
+    { 17, 21, 19, 1, 20, 90, 7263 }, // Ō
+    { 13, 15, 14, 1, 15, 49, 7353 }, // ō
+    { 17, 21, 19, 1, 20, 90, 7402 }, // Ŏ
+    { 14, 15, 14, 1, 15, 53, 7492 }, // ŏ
+    { 19, 20, 19, 1, 19, 95, 7545 }, // Ő
+    { 16, 14, 14, 1, 14, 56, 7640 }, // ő
+    { 24, 15, 20, 1, 14, 90, 6893 }, // Œ
+    { 19, 9, 18, 1, 9, 43, 6983 }, // œ
+    { 13, 20, 16, 1, 19, 65, 7696 }, // Ŕ
+    { 10, 13, 12, 1, 13, 33, 7761 }, // ŕ
+    { 13, 24, 16, 1, 23, 78, 7794 }, // Ŗ
+    { 10, 17, 12, 1, 17, 43, 7872 }, // ŗ
+    { 15, 22, 16, 1, 21, 83, 7915 }, // Ř
+    { 12, 15, 12, 1, 15, 45, 7998 }, // ř
+    { 15, 20, 17, 1, 20, 75, 8043 }, // Ś
+    { 11, 15, 14, 1, 14, 42, 8118 }, // ś
+    { 16, 21, 17, 1, 21, 84, 8160 }, // Ŝ
+    { 13, 16, 14, 1, 15, 52, 8244 }, // ŝ
+    { 15, 19, 17, 1, 15, 72, 8296 }, // Ş
+    { 11, 14, 14, 1, 10, 39, 8368 }, // ş
+    { 17, 21, 17, 1, 21, 90, 8407 }, // Š
+    { 14, 16, 14, 1, 15, 56, 8497 }, // š
+    { 14, 19, 17, 4, 14, 67, 8553 }, // Ţ
+    { 10, 17, 13, 2, 13, 43, 8620 }, // ţ
+    { 14, 21, 17, 4, 21, 74, 8663 }, // Ť
+    { 13, 15, 13, 3, 15, 49, 8737 }, // ť
+    { 14, 14, 17, 4, 14, 49, 8786 }, // Ŧ
+    { 11, 13, 13, 1, 13, 36, 8835 }, // ŧ
+    { 16, 22, 17, 1, 21, 88, 8871 }, // Ũ
+    { 11, 15, 14, 2, 15, 42, 8959 }, // ũ
+    { 16, 22, 17, 1, 21, 88, 9001 }, // Ū
+    { 12, 15, 14, 2, 15, 45, 9089 }, // ū
+    { 16, 22, 17, 1, 21, 88, 9134 }, // Ŭ
+    { 13, 15, 14, 2, 15, 49, 9222 }, // ŭ
+    { 16, 23, 17, 1, 22, 92, 9271 }, // Ů
+    { 11, 16, 14, 2, 16, 44, 9363 }, // ů
+    { 19, 21, 17, 1, 20, 100, 9407 }, // Ű
+    { 15, 14, 14, 2, 14, 53, 9507 }, // ű
+    { 16, 19, 17, 1, 14, 76, 9560 }, // Ų
+    { 11, 14, 14, 2, 9, 39, 9636 }, // ų
+    { 20, 21, 23, 4, 21, 105, 9675 }, // Ŵ
+    { 15, 18, 18, 3, 16, 68, 9780 }, // ŵ
+    { 13, 22, 18, 5, 22, 72, 9848 }, // Ŷ
+    { 15, 22, 15, 0, 17, 83, 9920 }, // ŷ
+    { 13, 22, 18, 5, 22, 72, 10003 }, // Ÿ
+    { 17, 19, 18, 1, 19, 81, 10075 }, // Ź
+    { 13, 15, 15, 1, 15, 49, 10156 }, // ź
+    { 17, 19, 18, 1, 19, 81, 10205 }, // Ż
+    { 13, 15, 15, 1, 15, 49, 10286 }, // ż
+    { 17, 21, 18, 1, 21, 90, 10335 }, // Ž
+    { 15, 17, 15, 1, 17, 64, 10425 }, // ž
+    { 11, 15, 10, 1, 14, 42, 10489 }, // ſ
+    { 7, 4, 0, 3, 13, 7, 10531 }, // ̀
+    { 5, 4, 0, 3, 13, 5, 10538 }, // ́
+    { 10, 5, 0, -1, 1, 13, 10543 }, // ̂
+    { 8, 4, 0, 3, 12, 8, 10556 }, // ̃
+    { 10, 3, 0, 3, 12, 8, 10564 }, // ̄
+    { 12, 3, 0, 4, 15, 9, 10572 }, // ̅
+    { 9, 4, 0, 3, 12, 9, 10581 }, // ̆
+    { 5, 4, 0, 3, 14, 5, 10590 }, // ̇
+    { 9, 4, 0, 2, 13, 9, 10595 }, // ̈
+    { 4, 5, 0, 6, 11, 5, 10604 }, // ̉
+    { 5, 4, 0, 3, 13, 5, 10609 }, // ̊
+    { 14, 4, 0, 3, 13, 14, 10614 }, // ̋
+    { 10, 5, 0, 3, 13, 13, 10628 }, // ̌
+    { 14, 4, 0, -6, 13, 14, 10641 }, // ̏
+    { 7, 6, 0, 2, 13, 11, 10655 }, // ̒
+    { 7, 6, 0, 2, 13, 11, 10666 }, // ̓
+    { 8, 6, 0, -4, 13, 12, 10677 }, // ̔
+    { 5, 5, 0, 0, 0, 7, 10689 }, // ̘
+    { 6, 5, 0, 0, 0, 8, 10696 }, // ̙
+    { 8, 5, 0, 4, 14, 10, 10704 }, // ̚
+    { 5, 5, 0, 2, 11, 7, 10714 }, // ̛
+    { 4, 6, 0, -1, 0, 6, 10721 }, // ̜
+    { 5, 6, 0, 1, 4, 8, 10727 }, // ̝
+    { 5, 5, 0, -1, 0, 7, 10735 }, // ̞
+    { 4, 5, 0, 0, -1, 5, 10742 }, // ̟
+    { 10, 3, 0, -1, -2, 8, 10747 }, // ̠
+    { 5, 4, 0, -2, 2, 5, 10755 }, // ̣
+    { 9, 4, 0, -2, -1, 9, 10760 }, // ̤
+    { 5, 4, 0, 3, 13, 5, 10769 }, // ̥
+    { 8, 6, 0, -1, 3, 12, 10774 }, // ̦
+    { 6, 6, 0, -1, 1, 9, 10786 }, // ̧
+    { 5, 7, 0, 0, 2, 9, 10795 }, // ̨
+    { 5, 6, 0, -1, 0, 8, 10804 }, // ̩
+    { 8, 4, 0, -1, 0, 8, 10812 }, // ̪
+    { 11, 5, 0, -1, 1, 14, 10820 }, // ̬
+    { 11, 5, 0, -1, 1, 14, 10834 }, // ̭
+    { 8, 4, 0, 4, 14, 8, 10848 }, // ̰
+    { 9, 3, 0, 4, 14, 7, 10856 }, // ̱
+    { 9, 3, 0, -1, -1, 7, 10863 }, // ̲
+    { 9, 4, 0, 4, 14, 9, 10870 }, // ̴
+    { 10, 2, 0, 1, 6, 5, 10879 }, // ̵
+    { 4, 6, 0, 1, 0, 6, 10884 }, // ̹
+    { 10, 6, 0, -3, 1, 15, 10890 }, // ̺
+    { 8, 6, 0, -1, 1, 12, 10905 }, // ̻
+    { 8, 5, 0, -1, 1, 10, 10917 }, // ̼
+    { 6, 4, 0, 3, 13, 6, 10927 }, // ̽
+    { 8, 4, 0, 3, 12, 8, 10933 }, // ͂
+    { 4, 5, 0, 7, 15, 5, 10941 }, // ̓
+    { 10, 12, 0, 3, 21, 30, 10946 }, // ̈́
+    { 8, 4, 0, 3, 14, 8, 10976 }, // ͆
+    { 11, 7, 0, -2, 0, 20, 10984 }, // ͇
+    { 9, 5, 0, -1, 0, 12, 11004 }, // ͈
+    { 7, 6, 0, -1, 0, 11, 11016 }, // ͉
+    { 13, 14, 0, 2, 18, 46, 11027 }, // ͊
+    { 18, 13, 0, 5, 19, 59, 0 }, // ͋
+    { 12, 9, 0, 9, 9, 27, 59 }, // ͌
+    { 9, 19, 0, 1, 6, 43, 86 }, // ͍
+    { 4, 3, 0, 8, 2, 3, 129 }, // ͎
+    { 15, 5, 0, 0, 1, 19, 132 }, // ͜
+    { 15, 5, 0, 3, 14, 19, 151 }, // ͡
+    { 19, 6, 0, -1, 0, 29, 170 }, // ͢
+    { 14, 20, 14, 1, 20, 70, 199 }, // Ѐ
+    { 15, 20, 15, 1, 20, 75, 0 }, // Ё
+    { 15, 16, 11, 2, 15, 60, 269 }, // Ђ
+    { 14, 20, 11, 0, 19, 70, 329 }, // Ѓ
+    { 15, 15, 14, 1, 13, 57, 399 }, // Є
+    { 15, 15, 17, 1, 15, 57, 456 }, // Ѕ
+    { 8, 14, 9, 1, 14, 28, 513 }, // І
+    { 11, 20, 9, 1, 20, 55, 541 }, // Ї
+    { 15, 18, 15, 0, 14, 68, 596 }, // Ј
+    { 18, 15, 19, 1, 13, 68, 664 }, // Љ
+    { 17, 14, 10, -3, 13, 60, 732 }, // Њ
+    { 14, 16, 17, 4, 16, 56, 792 }, // Ћ
+    { 15, 19, 17, 1, 19, 72, 848 }, // Ќ
+    { 15, 18, 16, 1, 18, 68, 920 }, // Ѝ
+    { 14, 22, 13, 0, 20, 77, 988 }, // Ў
+    { 14, 17, 13, 1, 13, 60, 1065 }, // Џ
+    { 14, 14, 19, 1, 14, 49, 75 }, // А
+    { 12, 13, 11, 1, 13, 39, 124 }, // Б
+    { 12, 14, 11, 1, 13, 42, 163 }, // В
+    { 14, 14, 11, 0, 13, 49, 205 }, // Г
+    { 14, 15, 14, 1, 13, 53, 254 }, // Д
+    { 14, 15, 14, 1, 15, 53, 307 }, // Е
+    { 24, 14, 25, 0, 14, 84, 360 }, // Ж
+    { 11, 14, 11, 1, 13, 39, 444 }, // З
+    { 15, 14, 16, 1, 14, 53, 483 }, // И
+    { 15, 19, 16, 1, 19, 72, 536 }, // Й
+    { 15, 14, 17, 1, 14, 53, 608 }, // К
+    { 15, 15, 10, -1, 13, 57, 661 }, // Л
+    { 17, 14, 14, 0, 13, 60, 718 }, // М
+    { 16, 14, 17, 1, 14, 56, 778 }, // Н
+    { 17, 15, 19, 1, 14, 64, 834 }, // О
+    { 14, 14, 11, 0, 13, 49, 898 }, // П
+    { 14, 15, 15, 1, 15, 53, 947 }, // Р
+    { 15, 15, 16, 1, 15, 57, 1000 }, // С
+    { 14, 14, 17, 4, 14, 49, 1057 }, // Т
+    { 14, 15, 13, 0, 13, 53, 1106 }, // У
+    { 13, 13, 15, 3, 13, 43, 1159 }, // Ф
+    { 17, 14, 18, 1, 14, 60, 1202 }, // Х
+    { 14, 17, 12, 0, 13, 60, 1262 }, // Ц
+    { 11, 13, 11, 2, 13, 36, 1322 }, // Ч
+    { 16, 14, 14, 0, 13, 56, 1358 }, // Ш
+    { 16, 16, 15, 0, 13, 64, 1414 }, // Щ
+    { 12, 13, 10, -1, 12, 39, 1478 }, // Ъ
+    { 19, 15, 19, 0, 14, 72, 1517 }, // Ы
+    { 11, 13, 10, 0, 12, 36, 1589 }, // Ь
+    { 15, 15, 16, 1, 13, 57, 1625 }, // Э
+    { 16, 14, 15, 1, 13, 56, 1682 }, // Ю
+    { 15, 15, 15, 0, 14, 57, 1738 }, // Я
+    { 11, 10, 14, 1, 10, 28, 1795 }, // а
+    { 14, 16, 12, 1, 15, 56, 1823 }, // б
+    { 11, 9, 12, -1, 9, 25, 1879 }, // в
+    { 12, 11, 10, 0, 9, 33, 1904 }, // г
+    { 12, 12, 13, 1, 9, 36, 1937 }, // д
+    { 12, 9, 14, 1, 9, 27, 1973 }, // е
+    { 24, 12, 25, 0, 12, 72, 2000 }, // ж
+    { 9, 9, 8, -2, 9, 21, 2072 }, // з
+    { 13, 11, 11, 0, 9, 36, 2093 }, // и
+    { 12, 14, 11, 0, 14, 42, 2129 }, // й
+    { 12, 9, 13, -1, 9, 27, 2171 }, // к
+    { 10, 10, 7, -2, 9, 25, 2198 }, // л
+    { 13, 11, 14, -1, 11, 36, 2223 }, // м
+    { 14, 11, 14, -1, 11, 39, 2259 }, // н
+    { 12, 9, 14, 1, 9, 27, 2298 }, // о
+    { 13, 11, 11, 0, 9, 36, 2325 }, // п
+    { 15, 15, 16, -1, 10, 57, 2361 }, // р
+    { 10, 10, 13, 1, 10, 25, 2418 }, // с
+    { 12, 11, 11, 2, 9, 33, 2443 }, // т
+    { 15, 14, 15, 0, 9, 53, 2476 }, // у
+    { 15, 13, 15, 1, 9, 49, 2529 }, // ф
+    { 14, 11, 12, 0, 9, 39, 2578 }, // х
+    { 12, 12, 12, 1, 9, 36, 2617 }, // ц
+    { 8, 9, 8, 0, 9, 18, 2653 }, // ч
+    { 16, 10, 14, 0, 9, 40, 2671 }, // ш
+    { 16, 13, 15, 0, 9, 52, 2711 }, // щ
+    { 9, 11, 8, -2, 10, 25, 2763 }, // ъ
+    { 14, 12, 15, -1, 11, 42, 2788 }, // ы
+    { 8, 11, 8, -1, 10, 22, 2830 }, // ь
+    { 10, 11, 11, 1, 10, 28, 2852 }, // э
+    { 13, 11, 12, 0, 10, 36, 2880 }, // ю
+    { 10, 11, 14, 1, 11, 28, 2916 }, // я
+    { 12, 17, 14, 1, 17, 51, 1125 }, // ѐ
+    { 13, 16, 14, 1, 16, 52, 2944 }, // ё
+    { 12, 18, 15, 1, 14, 54, 1176 }, // ђ
+    { 12, 15, 10, 0, 13, 45, 1230 }, // ѓ
+    { 10, 10, 10, -1, 9, 25, 1275 }, // є
+    { 11, 11, 14, 1, 10, 31, 1300 }, // ѕ
+    { 9, 15, 7, 0, 15, 34, 1331 }, // і
+    { 10, 14, 7, 0, 14, 35, 1365 }, // ї
+    { 11, 20, 10, 1, 15, 55, 1400 }, // ј
+    { 13, 10, 13, -1, 9, 33, 1455 }, // љ
+    { 12, 10, 7, -4, 9, 30, 1488 }, // њ
+    { 12, 14, 15, 1, 14, 42, 1518 }, // ћ
+    { 13, 14, 13, -1, 14, 46, 1560 }, // ќ
+    { 13, 17, 11, 0, 15, 56, 1606 }, // ѝ
+    { 16, 22, 15, 0, 17, 88, 1662 }, // ў
+    { 11, 13, 10, -1, 10, 36, 1750 }, // џ
+    { 10, 14, 12, 3, 13, 35, 1786 }, // Ѣ
+    { 11, 14, 11, 2, 13, 39, 1821 }, // ѣ
+    { 18, 14, 14, -1, 13, 63, 1860 }, // Ѫ
+    { 13, 11, 10, -2, 10, 36, 1923 }, // ѫ
+    { 19, 18, 19, 1, 18, 86, 1959 }, // Ѳ
+    { 15, 13, 14, 1, 13, 49, 2045 }, // ѳ
+    { 17, 17, 18, 5, 17, 73, 2094 }, // Ѵ
+    { 12, 11, 14, 3, 11, 33, 2167 }, // ѵ
+    { 8, 6, 0, 5, 16, 12, 2200 }, // ҆
+    { 14, 15, 11, 0, 14, 53, 2212 }, // Ґ
+    { 13, 14, 10, 0, 12, 46, 2265 }, // ґ
+    { 14, 14, 11, 0, 13, 49, 2311 }, // Ғ
+    { 10, 9, 8, -2, 9, 23, 2360 }, // ғ
+    { 13, 16, 10, 0, 15, 52, 2383 }, // Ҕ
+    { 9, 10, 6, -2, 9, 23, 2435 }, // ҕ
+    { 24, 17, 25, 0, 14, 102, 2458 }, // Җ
+    { 17, 11, 17, -2, 9, 47, 2560 }, // җ
+    { 11, 16, 11, 1, 13, 44, 2607 }, // Ҙ
+    { 9, 13, 8, -2, 9, 30, 2651 }, // ҙ
+    { 15, 17, 12, 0, 14, 64, 2681 }, // Қ
+    { 11, 11, 8, -2, 9, 31, 2745 }, // қ
+    { 18, 14, 18, 1, 13, 63, 2776 }, // Ҝ
+    { 13, 9, 12, 0, 9, 30, 2839 }, // ҝ
+    { 15, 14, 17, 1, 14, 53, 2869 }, // Ҟ
+    { 11, 14, 15, 1, 14, 39, 2922 }, // ҟ
+    { 15, 14, 17, 1, 14, 53, 2961 }, // Ҡ
+    { 10, 9, 12, -1, 9, 23, 3014 }, // ҡ
+    { 17, 17, 13, -2, 14, 73, 3037 }, // Ң
+    { 12, 11, 9, -3, 9, 33, 3110 }, // ң
+    { 22, 14, 17, 1, 14, 77, 3143 }, // Ҥ
+    { 16, 9, 12, -1, 9, 36, 3220 }, // ҥ
+    { 20, 16, 21, 1, 15, 80, 3256 }, // Ҧ
+    { 16, 17, 21, 3, 12, 68, 3336 }, // ҧ
+    { 18, 14, 11, -2, 13, 63, 3404 }, // Ҩ
+    { 14, 11, 17, 1, 10, 39, 3467 }, // ҩ
+    { 15, 17, 16, 1, 15, 64, 3506 }, // Ҫ
+    { 10, 12, 13, 1, 10, 30, 3570 }, // ҫ
+    { 14, 16, 13, 2, 14, 56, 3600 }, // Ҭ
+    { 10, 11, 9, -1, 9, 28, 3656 }, // ҭ
+    { 13, 14, 18, 5, 14, 46, 3684 }, // Ү
+    { 11, 13, 13, 3, 9, 36, 3730 }, // ү
+    { 15, 14, 18, 3, 14, 53, 3766 }, // Ұ
+    { 14, 14, 13, 0, 10, 49, 3819 }, // ұ
+    { 17, 17, 13, 1, 14, 73, 3868 }, // Ҳ
+    { 13, 11, 13, 0, 9, 36, 3941 }, // ҳ
+    { 14, 16, 10, 0, 13, 56, 3977 }, // Ҵ
+    { 11, 12, 15, 2, 9, 33, 4033 }, // ҵ
+    { 11, 17, 11, 2, 13, 47, 4066 }, // Ҷ
+    { 8, 12, 8, 0, 9, 24, 4113 }, // ҷ
+    { 11, 13, 11, 2, 13, 36, 4137 }, // Ҹ
+    { 8, 9, 8, 0, 9, 18, 4173 }, // ҹ
+    { 12, 15, 11, 0, 14, 45, 4191 }, // Һ
+    { 12, 14, 15, 1, 14, 42, 4236 }, // һ
+    { 19, 13, 24, 3, 12, 62, 4278 }, // Ҽ
+    { 14, 9, 12, 1, 9, 32, 4340 }, // ҽ
+    { 19, 15, 15, 4, 12, 72, 4372 }, // Ҿ
+    { 15, 12, 11, 1, 10, 45, 4444 }, // ҿ
+    { 8, 14, 9, 1, 14, 28, 4489 }, // Ӏ
+    { 24, 23, 25, 0, 23, 138, 4517 }, // Ӂ
+    { 24, 19, 25, 0, 19, 114, 4655 }, // ӂ
+    { 14, 18, 12, 0, 13, 63, 4769 }, // Ӄ
+    { 10, 13, 8, -2, 9, 33, 4832 }, // ӄ
+    { 15, 17, 10, -1, 13, 64, 4865 }, // Ӆ
+    { 10, 12, 7, -1, 9, 30, 4929 }, // ӆ
+    { 16, 19, 17, 1, 14, 76, 4959 }, // Ӈ
+    { 11, 13, 12, -1, 9, 36, 5035 }, // ӈ
+    { 16, 20, 17, 1, 14, 80, 5071 }, // Ӊ
+    { 12, 13, 12, 0, 9, 39, 5151 }, // ӊ
+    { 12, 17, 11, 2, 13, 51, 5190 }, // Ӌ
+    { 8, 12, 10, 1, 9, 24, 5241 }, // ӌ
+    { 18, 20, 19, 1, 14, 90, 5265 }, // Ӎ
+    { 13, 13, 13, 0, 9, 43, 5355 }, // ӎ
+    { 7, 13, 10, 3, 12, 23, 5398 }, // ӏ
+    { 17, 20, 19, 1, 20, 85, 5421 }, // Ӑ
+    { 14, 15, 14, 1, 15, 53, 5506 }, // ӑ
+    { 16, 19, 19, 1, 19, 76, 5559 }, // Ӓ
+    { 14, 15, 14, 1, 15, 53, 5635 }, // ӓ
+    { 23, 15, 23, 1, 14, 87, 5688 }, // Ӕ
+    { 18, 10, 21, 1, 10, 45, 5775 }, // ӕ
+    { 16, 20, 14, 1, 20, 80, 5820 }, // Ӗ
+    { 14, 17, 14, 1, 17, 60, 5900 }, // ӗ
+    { 15, 14, 18, 5, 13, 53, 5960 }, // Ә
+    { 11, 11, 14, 5, 10, 31, 6013 }, // ә
+    { 15, 20, 18, 5, 19, 75, 6044 }, // Ӛ
+    { 12, 14, 14, 4, 10, 42, 6119 }, // ӛ
+    { 24, 22, 23, 2, 22, 132, 6161 }, // Ӝ
+    { 24, 19, 25, 0, 19, 114, 6293 }, // ӝ
+    { 13, 22, 11, 1, 21, 72, 6407 }, // Ӟ
+    { 12, 13, 8, -2, 13, 39, 6479 }, // ӟ
+    { 11, 14, 11, 2, 13, 39, 6518 }, // Ӡ
+    { 11, 14, 11, 1, 10, 39, 6557 }, // ӡ
+    { 15, 19, 15, 1, 19, 72, 6596 }, // Ӣ
+    { 14, 17, 11, 0, 15, 60, 6668 }, // ӣ
+    { 15, 18, 16, 1, 18, 68, 6728 }, // Ӥ
+    { 13, 16, 11, 0, 14, 52, 6796 }, // ӥ
+    { 17, 20, 19, 1, 19, 85, 6848 }, // Ӧ
+    { 12, 16, 14, 1, 16, 48, 6933 }, // ӧ
+    { 15, 14, 18, 2, 14, 53, 6981 }, // Ө
+    { 12, 9, 14, 1, 9, 27, 7034 }, // ө
+    { 15, 19, 18, 2, 19, 72, 7061 }, // Ӫ
+    { 12, 14, 14, 1, 14, 42, 7133 }, // ӫ
+    { 25, 22, 16, 1, 20, 138, 7175 }, // Ӭ
+    { 11, 15, 11, 1, 14, 42, 7313 }, // ӭ
+    { 14, 22, 13, 0, 20, 77, 7355 }, // Ӯ
+    { 16, 22, 15, 0, 17, 88, 7432 }, // ӯ
+    { 14, 21, 13, 0, 19, 74, 7520 }, // Ӱ
+    { 15, 22, 15, 0, 17, 83, 7594 }, // ӱ
+    { 16, 21, 13, 0, 19, 84, 7677 }, // Ӳ
+    { 18, 21, 15, 0, 16, 95, 7761 }, // ӳ
+    { 11, 17, 11, 2, 17, 47, 7856 }, // Ӵ
+    { 9, 13, 8, 0, 13, 30, 7903 }, // ӵ
+    { 14, 16, 11, 0, 13, 56, 7933 }, // Ӷ
+    { 10, 11, 8, -2, 9, 28, 7989 }, // ӷ
+    { 19, 22, 19, 0, 21, 105, 8017 }, // Ӹ
+    { 15, 19, 15, -1, 18, 72, 8122 }, // ӹ
+    { 17, 16, 18, 1, 14, 68, 8194 }, // Ӽ
+    { 12, 11, 13, -1, 9, 33, 8262 }, // ӽ
+    { 0, 0, 11, 0, 0, 0, 8295 }, //  
+    { 0, 0, 19, 0, 0, 0, 8295 }, //  
+    { 0, 0, 11, 0, 0, 0, 8295 }, //  
+    { 0, 0, 19, 0, 0, 0, 8295 }, //  
+    { 0, 0, 8, 0, 0, 0, 8295 }, //  
+    { 0, 0, 7, 0, 0, 0, 8295 }, //  
+    { 0, 0, 5, 0, 0, 0, 8295 }, //  
+    { 0, 0, 12, 0, 0, 0, 8295 }, //  
+    { 0, 0, 4, 0, 0, 0, 8295 }, //  
+    { 0, 0, 6, 0, 0, 0, 8295 }, //  
+    { 0, 0, 5, 0, 0, 0, 8295 }, //  
+    { 0, 0, 3, 0, 0, 0, 8295 }, // ​
+    { 0, 0, 0, 0, 0, 0, 8295 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 8295 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 8295 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 8295 }, // ‏
+    { 10, 2, 9, 1, 6, 5, 8295 }, // ‐
+    { 10, 2, 9, 1, 6, 5, 8300 }, // ‑
+    { 15, 2, 9, -1, 6, 8, 8305 }, // ‒
+    { 14, 4, 13, 1, 7, 14, 7026 }, // –
+    { 19, 4, 19, 1, 7, 19, 7040 }, // —
+    { 19, 4, 19, 1, 7, 19, 8313 }, // ―
+    { 12, 16, 9, 1, 13, 48, 8332 }, // ‖
+    { 16, 6, 9, -4, -1, 24, 8380 }, // ‗
+    { 8, 6, 7, 3, 15, 12, 7059 }, // ‘
+    { 8, 6, 7, 3, 15, 12, 7071 }, // ’
+    { 7, 6, 5, -1, 3, 11, 8404 }, // ‚
+    { 8, 6, 7, 3, 15, 12, 8415 }, // ‛
+    { 13, 6, 13, 3, 15, 20, 7083 }, // “
+    { 13, 6, 13, 3, 15, 20, 7103 }, // ”
+    { 7, 6, 5, -1, 3, 11, 8427 }, // „
+    { 13, 6, 13, 3, 15, 20, 8438 }, // ‟
+    { 10, 24, 13, 4, 18, 60, 8458 }, // †
+    { 12, 23, 14, 3, 17, 69, 8518 }, // ‡
+    { 15, 13, 8, -2, 15, 49, 8587 }, // •
+    { 6, 7, 10, 3, 8, 11, 8636 }, // ‣
+    { 5, 4, 10, 3, 4, 5, 8647 }, // ․
+    { 5, 4, 10, 3, 4, 5, 8652 }, // ‥
+    { 16, 4, 16, 0, 4, 16, 7123 }, // …
+    { 3, 2, 9, 3, 6, 2, 8657 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 8659 }, //  
+    { 16, 15, 19, 2, 13, 60, 8659 }, // ‰
+    { 8, 6, 9, 5, 15, 12, 8719 }, // ′
+    { 13, 6, 13, 5, 15, 20, 8731 }, // ″
+    { 13, 6, 7, -2, 14, 20, 8751 }, // ‴
+    { 5, 6, 7, 4, 14, 8, 8771 }, // ‵
+    { 8, 6, 7, 3, 14, 12, 8779 }, // ‶
+    { 13, 6, 7, 0, 14, 20, 8791 }, // ‷
+    { 10, 4, 11, 3, 14, 10, 8811 }, // ‸
+    { 7, 10, 7, 2, 10, 18, 8821 }, // ‹
+    { 7, 10, 7, -2, 10, 18, 8839 }, // ›
+    { 22, 22, 23, 1, 17, 121, 8857 }, // ※
+    { 10, 22, 10, 1, 19, 55, 8978 }, // ‼
+    { 13, 27, 14, 3, 23, 88, 9033 }, // ‽
+    { 10, 2, 9, 3, 14, 5, 9121 }, // ‾
+    { 9, 4, 13, 3, 11, 9, 9126 }, // ‿
+    { 13, 12, 11, 1, 15, 39, 9135 }, // ⁂
+    { 16, 15, 22, 3, 13, 60, 9174 }, // ⁄
+    { 23, 21, 25, 4, 19, 121, 9234 }, // ⁇
+    { 20, 22, 20, 3, 19, 110, 9355 }, // ⁈
+    { 18, 22, 13, -1, 19, 99, 9465 }, // ⁉
+    { 19, 29, 15, -1, 20, 138, 9564 }, // ⁒
+    { 0, 0, 78, 0, 0, 0, 9702 }, //  
+    { 6, 7, 6, 6, 14, 11, 9702 }, // ⁰
+    { 6, 6, 6, 6, 14, 9, 9713 }, // ⁴
+    { 6, 8, 6, 6, 14, 12, 9722 }, // ⁵
+    { 6, 7, 6, 6, 14, 11, 9734 }, // ⁶
+    { 6, 8, 6, 7, 15, 12, 9745 }, // ⁷
+    { 6, 7, 6, 6, 14, 11, 9757 }, // ⁸
+    { 6, 8, 6, 6, 14, 12, 9768 }, // ⁹
+    { 12, 10, 14, 1, 10, 30, 9780 }, // ⁿ
+    { 6, 7, 6, -5, 4, 11, 9810 }, // ₀
+    { 6, 7, 6, -6, 4, 11, 9821 }, // ₁
+    { 7, 7, 6, -6, 4, 13, 9832 }, // ₂
+    { 7, 7, 6, -6, 4, 13, 9845 }, // ₃
+    { 6, 7, 6, -5, 4, 11, 9858 }, // ₄
+    { 6, 8, 6, -5, 5, 12, 9869 }, // ₅
+    { 7, 7, 6, -6, 4, 13, 9881 }, // ₆
+    { 6, 8, 6, -4, 5, 12, 9894 }, // ₇
+    { 6, 7, 6, -5, 4, 11, 9906 }, // ₈
+    { 6, 8, 6, -5, 4, 12, 9917 }, // ₉
+    { 12, 23, 8, 1, 17, 69, 9929 }, // ₍
+    { 11, 23, 7, -5, 17, 64, 9998 }, // ₎
+    { 16, 22, 16, 2, 18, 88, 10062 }, // ₡
+    { 15, 15, 16, 1, 15, 57, 10150 }, // ₢
+    { 13, 14, 12, 0, 13, 46, 10207 }, // ₤
+    { 20, 14, 17, -1, 14, 70, 10253 }, // ₦
+    { 16, 15, 15, 1, 15, 60, 10323 }, // ₧
+    { 21, 15, 22, -1, 14, 79, 10383 }, // ₨
+    { 15, 14, 14, -1, 14, 53, 10462 }, // ₩
+    { 17, 13, 18, 2, 13, 56, 10515 }, // ₪
+    { 15, 14, 9, -1, 13, 53, 10571 }, // ₫
+    { 14, 17, 14, 1, 14, 60, 10624 }, // €
+    { 14, 14, 17, 4, 14, 49, 10684 }, // ₮
+    { 18, 15, 11, 0, 15, 68, 10733 }, // ₱
+    { 16, 22, 19, 1, 19, 88, 10801 }, // ₲
+    { 19, 15, 17, 5, 14, 72, 10889 }, // ₴
+    { 10, 13, 10, 1, 11, 33, 10961 }, // ₵
+    { 16, 16, 17, 4, 16, 64, 10994 }, // ₸
+    { 12, 13, 12, 2, 12, 39, 0 }, // ₹
+    { 11, 13, 12, 1, 11, 36, 39 }, // ₺
+    { 14, 15, 14, 2, 14, 53, 75 }, // ₼
+    { 17, 15, 15, -2, 15, 64, 128 }, // ₽
+    { 12, 12, 12, -3, 9, 36, 192 }, // ←
+    { 12, 12, 13, 2, 10, 36, 228 }, // ↑
+    { 12, 12, 13, 3, 9, 36, 264 }, // →
+    { 13, 12, 13, 4, 11, 39, 300 }, // ↓
+    { 19, 10, 17, -1, 8, 48, 339 }, // ↔
+    { 10, 19, 13, 3, 18, 48, 387 }, // ↕
+    { 11, 8, 13, -1, 8, 22, 435 }, // ↖
+    { 11, 8, 11, 2, 8, 22, 457 }, // ↗
+    { 10, 11, 11, 3, 9, 28, 479 }, // ↘
+    { 10, 11, 11, -2, 9, 28, 507 }, // ↙
+    { 14, 11, 16, 0, 10, 39, 535 }, // ⇐
+    { 15, 14, 18, 3, 13, 53, 574 }, // ⇑
+    { 14, 11, 16, 2, 10, 39, 627 }, // ⇒
+    { 15, 14, 18, 6, 13, 53, 666 }, // ⇓
+    { 18, 11, 18, 0, 10, 50, 719 }, // ⇔
+    { 12, 17, 15, 4, 9, 51, 769 }, // ⇕
+    { 13, 16, 11, 1, 15, 52, 820 }, // ∂
+    { 18, 16, 19, 0, 15, 72, 872 }, // ∅
+    { 14, 14, 14, 0, 13, 49, 944 }, // ∆
+    { 13, 14, 12, 2, 13, 46, 993 }, // ∏
+    { 13, 14, 12, 5, 13, 46, 1039 }, // ∐
+    { 13, 14, 10, 0, 13, 46, 1085 }, // ∑
+    { 10, 3, 10, 1, 6, 8, 1131 }, // −
+    { 17, 15, 16, 2, 14, 64, 1139 }, // √
+    { 16, 10, 15, 1, 11, 40, 1203 }, // ∞
+    { 17, 18, 14, 0, 13, 77, 1243 }, // ∫
+    { 8, 12, 5, 0, 12, 24, 1320 }, // ∶
+    { 12, 9, 24, 9, 9, 27, 1344 }, // ≈
+    { 16, 15, 22, 3, 14, 60, 1371 }, // ≠
+    { 16, 15, 13, -2, 13, 60, 1431 }, // ≤
+    { 16, 14, 14, 0, 12, 56, 1491 }, // ≥
+    { 16, 13, 18, 2, 13, 52, 1547 }, // ﬀ
+    { 15, 15, 16, 2, 15, 57, 1599 }, // ﬁ
+    { 15, 14, 18, 2, 14, 53, 1656 }, // ﬂ
+    { 21, 15, 22, 2, 15, 79, 1709 }, // ﬃ
+    { 22, 14, 25, 2, 14, 77, 1788 }, // ﬄ
+    { 19, 14, 20, 0, 13, 67, 1865 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_8_bolditalicIntervals[] = {
@@ -1968,30 +1955,98 @@ static const EpdUnicodeInterval opendyslexic_8_bolditalicIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_8_bolditalicGroups[] = {
-    { 0, 2573, 4143, 95, 0 },
-    { 2573, 2685, 5085, 96, 95 },
-    { 5258, 3885, 8329, 126, 191 },
-    { 9143, 569, 741, 61, 317 },
-    { 9712, 6018, 11092, 213, 378 },
-    { 15730, 938, 1520, 63, 591 },
-    { 16668, 296, 360, 20, 654 },
-    { 16964, 801, 1188, 20, 674 },
-    { 17765, 488, 628, 16, 694 },
-    { 18253, 491, 727, 15, 710 },
+    { 0, 3694, 7139, 151, 0 },
+    { 3694, 1930, 2996, 66, 379 },
+    { 5624, 5419, 11073, 227, 96 },
+    { 11043, 6128, 11058, 246, 371 },
+    { 17171, 1265, 1932, 41, 690 },
+};
+
+static const uint8_t opendyslexic_8_bolditalicGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 1, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const EpdLigaturePair opendyslexic_8_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t opendyslexic_8_bolditalicGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_8_bolditalic = {
     opendyslexic_8_bolditalicBitmaps,
     opendyslexic_8_bolditalicGlyphs,
     opendyslexic_8_bolditalicIntervals,
-    56,
+    58,
     30,
     22,
     -9,
     true,
     opendyslexic_8_bolditalicGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    opendyslexic_8_bolditalicLigatures,
+    5,
+    0x4000000001ull,
+    opendyslexic_8_bolditalicGlyphLookup,
+    opendyslexic_8_bolditalicGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,1100 +3,1062 @@
  * name: opendyslexic_8_italic
  * size: 8
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_8_italic 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_8_italic 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_italicBitmaps[17405] = {
-    0x6D, 0x57, 0x5F, 0x88, 0x5C, 0x57, 0x19, 0xFF, 0xDD, 0x7B, 0xEC, 0x5E, 0xBB, 0x37, 0x99, 0x13,
-    0x21, 0xD1, 0x96, 0xEC, 0xEC, 0xED, 0x43, 0x1F, 0x96, 0xB2, 0xBB, 0x77, 0x85, 0x45, 0x56, 0xBC,
-    0x33, 0xF7, 0x34, 0x01, 0x7D, 0x28, 0xD5, 0x08, 0x0D, 0x45, 0x7C, 0x30, 0x6F, 0x82, 0x14, 0x36,
-    0x0F, 0xFB, 0x30, 0xC2, 0x24, 0x73, 0xDB, 0x22, 0x01, 0x15, 0xBA, 0x0F, 0xDA, 0x07, 0x41, 0x2C,
-    0x28, 0x28, 0xC9, 0x43, 0x06, 0x59, 0x75, 0x85, 0x4D, 0xE6, 0x24, 0x79, 0x90, 0x92, 0x82, 0x57,
-    0x2A, 0xED, 0x83, 0x0F, 0x3D, 0xAD, 0xAD, 0xC5, 0x88, 0x72, 0xB5, 0x57, 0x3A, 0xE9, 0xCE, 0xCE,
-    0xF1, 0xF7, 0xDD, 0xD9, 0xAC, 0x45, 0xBC, 0xC9, 0x99, 0xD9, 0x7B, 0xFE, 0x7C, 0xE7, 0xFB, 0xF3,
-    0xFB, 0x7E, 0xDF, 0x37, 0x08, 0x10, 0x58, 0x0C, 0xB1, 0x81, 0x36, 0x62, 0x28, 0x1B, 0x94, 0x7C,
-    0xC9, 0xB0, 0x88, 0xD8, 0xC0, 0x04, 0x06, 0x35, 0x6E, 0x20, 0x07, 0x4E, 0x9E, 0xD2, 0x5F, 0xB9,
-    0xF3, 0x4E, 0x35, 0xEE, 0xA7, 0x7A, 0xEE, 0x85, 0x6D, 0xA0, 0x5C, 0x07, 0x22, 0x1E, 0x44, 0xA6,
-    0xD1, 0xBC, 0xC5, 0xDE, 0xFB, 0xEA, 0xD4, 0x8D, 0x6F, 0x9C, 0x47, 0x50, 0x6E, 0x01, 0x5A, 0x71,
-    0xAD, 0xD7, 0x02, 0x9E, 0x7D, 0xEF, 0xB7, 0xCF, 0xC8, 0x9A, 0xC3, 0xEE, 0x22, 0x28, 0xBF, 0x02,
-    0x12, 0x59, 0x7B, 0xE6, 0x13, 0x90, 0xE7, 0x53, 0x40, 0xF8, 0x7D, 0x4E, 0x4D, 0x8D, 0xF2, 0x07,
-    0xC8, 0x5F, 0x45, 0xF0, 0xD1, 0x3A, 0xF4, 0x96, 0x45, 0xFE, 0x26, 0x30, 0x38, 0x00, 0x52, 0x6F,
-    0xF0, 0x53, 0x0F, 0xF5, 0xE5, 0x83, 0xE0, 0xD8, 0xA0, 0xCA, 0xBD, 0xBF, 0xE2, 0x7D, 0x7D, 0xDA,
-    0xDF, 0x07, 0x3E, 0x4B, 0x29, 0xDF, 0x69, 0x84, 0x18, 0x60, 0x3D, 0x72, 0x0F, 0x87, 0x2F, 0x86,
-    0xC5, 0xDA, 0xDA, 0x05, 0x35, 0xF7, 0x08, 0xF2, 0xDF, 0x01, 0xE7, 0xC6, 0xC0, 0xC6, 0x45, 0x6A,
-    0x02, 0xE5, 0x2E, 0xE0, 0x37, 0xCF, 0x61, 0x39, 0x35, 0x21, 0x66, 0x4F, 0x30, 0x05, 0xFE, 0xDD,
-    0x47, 0x5B, 0xD9, 0xD0, 0xEE, 0x62, 0xB1, 0x0B, 0x8C, 0x0C, 0x92, 0x12, 0xF1, 0x5B, 0x78, 0xB2,
-    0xCE, 0x56, 0x72, 0x7C, 0x78, 0xC7, 0x45, 0x55, 0xFE, 0xF2, 0x34, 0xF0, 0xD3, 0xE1, 0xDC, 0xD4,
-    0xC8, 0x99, 0x67, 0xF6, 0xFA, 0x59, 0x17, 0xAA, 0x08, 0x2D, 0xED, 0x2E, 0x51, 0xE1, 0x22, 0x9D,
-    0xB6, 0x80, 0x16, 0x22, 0x13, 0x5A, 0xB8, 0xC6, 0x83, 0x91, 0x38, 0xF3, 0x22, 0x67, 0x23, 0x43,
-    0x47, 0x6E, 0x40, 0x83, 0x2E, 0xBC, 0x08, 0xAE, 0xD3, 0x15, 0xEB, 0x87, 0xDF, 0x5B, 0x14, 0xC2,
-    0x2D, 0x3C, 0x12, 0x83, 0x8B, 0xCA, 0x70, 0x23, 0x67, 0x3E, 0xFE, 0x11, 0x15, 0xDC, 0xF5, 0x10,
-    0x70, 0x02, 0x8F, 0x84, 0xAF, 0x6E, 0xA4, 0x2E, 0xAC, 0xE3, 0x6F, 0xDE, 0x5E, 0xC2, 0xC3, 0xC0,
-    0x63, 0x3C, 0xC9, 0x38, 0x15, 0x03, 0xCF, 0xA3, 0xCB, 0x22, 0x8E, 0xD6, 0x98, 0x49, 0x72, 0xA6,
-    0xEA, 0xCC, 0x15, 0x4F, 0x5C, 0x4D, 0xBC, 0x9D, 0x17, 0x73, 0x20, 0x96, 0x52, 0xB2, 0x5C, 0xC9,
-    0xF8, 0x70, 0xBC, 0xC2, 0xB1, 0xC6, 0xB1, 0xC1, 0xC1, 0xCB, 0x9B, 0x93, 0xF1, 0xFF, 0x6E, 0x62,
-    0x74, 0x78, 0xF1, 0xFF, 0xD9, 0x54, 0x48, 0xEC, 0x78, 0xD3, 0xC7, 0x37, 0xAD, 0xE3, 0xC1, 0x33,
-    0x67, 0xB0, 0xBE, 0x86, 0x72, 0x49, 0xD9, 0xA5, 0xE8, 0xE9, 0xA5, 0xB8, 0xBD, 0xA1, 0x17, 0xB6,
-    0x5A, 0xA8, 0x16, 0x03, 0x97, 0x44, 0x65, 0xE2, 0x0B, 0xED, 0x11, 0x8E, 0x65, 0xE3, 0x65, 0xFC,
-    0x9D, 0x72, 0x33, 0xCA, 0xDF, 0xA2, 0x98, 0x2A, 0x70, 0x9F, 0x79, 0x6F, 0x30, 0x1D, 0x1D, 0xD0,
-    0xD4, 0xC0, 0xBB, 0x70, 0x7B, 0xA7, 0x11, 0xBA, 0x25, 0x57, 0xA8, 0x12, 0x49, 0x81, 0x9B, 0x88,
-    0x6B, 0xA4, 0xEF, 0x99, 0xDC, 0xD3, 0x60, 0x83, 0x51, 0x89, 0x6D, 0xAE, 0x2E, 0x01, 0x8F, 0x8B,
-    0x31, 0x9F, 0x2E, 0xC1, 0x49, 0x2A, 0x4F, 0xB5, 0x42, 0xFB, 0xE8, 0x66, 0x91, 0x7B, 0xA4, 0x75,
-    0x03, 0x08, 0xBA, 0xDE, 0xA8, 0x0A, 0x1F, 0x22, 0x1B, 0xEA, 0x96, 0xFA, 0xC3, 0xBB, 0x03, 0x7F,
-    0xEB, 0xD9, 0x3F, 0xA2, 0x8F, 0xB8, 0x40, 0xA3, 0x88, 0xF2, 0xE5, 0x82, 0x98, 0xAC, 0x88, 0xBD,
-    0x31, 0xCE, 0xF7, 0x81, 0x1D, 0x84, 0xBC, 0x32, 0xFC, 0x5B, 0xAD, 0x7D, 0x91, 0xBE, 0x2B, 0xF1,
-    0x46, 0x32, 0xE1, 0x2C, 0x03, 0x4A, 0x17, 0xC5, 0x23, 0xAB, 0xFF, 0xE0, 0x34, 0xAA, 0x36, 0xFF,
-    0xD3, 0xAC, 0xD8, 0x6A, 0x6F, 0x1A, 0x9B, 0x52, 0x6F, 0x03, 0x47, 0x9D, 0x33, 0x86, 0x5F, 0x53,
-    0x3E, 0x21, 0x55, 0x31, 0x6B, 0xF6, 0x68, 0x2B, 0x30, 0xBF, 0x8D, 0x9D, 0x25, 0x94, 0x0B, 0xA1,
-    0x5D, 0x0E, 0xED, 0x16, 0xF6, 0x1D, 0x46, 0x45, 0xF4, 0xBC, 0xA3, 0x6F, 0x96, 0x51, 0x75, 0xC2,
-    0x32, 0xBD, 0x5E, 0xC4, 0x04, 0xF9, 0xC0, 0xE8, 0xA7, 0xCC, 0xB0, 0xA5, 0x4C, 0xB6, 0x00, 0x37,
-    0x8C, 0x9E, 0x2F, 0x2F, 0x29, 0x5F, 0x05, 0x3F, 0xB7, 0x68, 0x07, 0x41, 0xC5, 0x0C, 0x18, 0x39,
-    0xBA, 0x24, 0xB6, 0xF9, 0xA1, 0xBB, 0x95, 0x4D, 0x31, 0x01, 0xEA, 0xE8, 0xC1, 0xCC, 0x49, 0x55,
-    0x25, 0xD8, 0x8D, 0xEC, 0x29, 0x08, 0xA0, 0x82, 0x09, 0xA2, 0x1A, 0x89, 0x43, 0x5E, 0x40, 0xD3,
-    0x92, 0x11, 0xD5, 0xDC, 0xE4, 0x48, 0x0B, 0x01, 0x14, 0xDF, 0x0F, 0x1E, 0x6A, 0x00, 0x7D, 0x2A,
-    0xF4, 0x12, 0xCA, 0x90, 0xD3, 0x37, 0x29, 0x94, 0x3B, 0x78, 0x86, 0xBA, 0xE0, 0xB4, 0x9D, 0xF3,
-    0xDB, 0x3C, 0xD5, 0x35, 0x47, 0x11, 0xDE, 0xDC, 0x0E, 0xEF, 0xD5, 0x21, 0x7A, 0x4C, 0x78, 0xC8,
-    0xE7, 0x10, 0x34, 0x3A, 0xB2, 0x48, 0x25, 0xB0, 0xCA, 0x09, 0x38, 0xF8, 0x36, 0xD7, 0x1C, 0x98,
-    0xA7, 0x20, 0xE0, 0x81, 0xB2, 0x88, 0x68, 0x60, 0xF2, 0xD5, 0x12, 0x2B, 0x38, 0x46, 0xC0, 0x86,
-    0xA6, 0x7D, 0x19, 0xDB, 0xAD, 0xC7, 0xEC, 0xE3, 0xD1, 0x85, 0xB5, 0x63, 0xEA, 0xB5, 0xA5, 0x79,
-    0x7C, 0x30, 0x4D, 0xD0, 0x39, 0xD9, 0x85, 0x26, 0xC0, 0x42, 0xD1, 0x2D, 0xF7, 0x8C, 0xA7, 0xA7,
-    0x3E, 0x0F, 0x9D, 0x43, 0x23, 0x8B, 0x91, 0xC4, 0x08, 0x58, 0x1C, 0x42, 0xDD, 0x65, 0xA4, 0x76,
-    0xB0, 0x18, 0x19, 0x65, 0x7B, 0x34, 0xB9, 0x48, 0xD0, 0x57, 0xDE, 0xDB, 0x91, 0x9F, 0x24, 0x26,
-    0xBA, 0xE3, 0x70, 0x49, 0xCC, 0xED, 0x3C, 0x6B, 0x5B, 0xA4, 0x04, 0xD3, 0x0E, 0x6D, 0x02, 0xF2,
-    0x4A, 0xF7, 0xBA, 0x6D, 0x0B, 0x53, 0x91, 0x95, 0xA2, 0x5B, 0x2E, 0x72, 0x37, 0x47, 0x64, 0x12,
-    0x06, 0xFA, 0xDD, 0x43, 0xF8, 0x1E, 0x90, 0xBE, 0x4A, 0x45, 0xE4, 0xF0, 0x4E, 0x26, 0x0F, 0x2D,
-    0x61, 0x04, 0xE5, 0x62, 0x86, 0x52, 0x0C, 0x11, 0xDF, 0xE4, 0xD3, 0xBD, 0xD0, 0x0B, 0x94, 0x6B,
-    0x0C, 0xA6, 0x47, 0x7E, 0x11, 0x35, 0xB5, 0x9F, 0x20, 0x0B, 0xC6, 0x41, 0x19, 0x54, 0xCC, 0xCC,
-    0x32, 0x83, 0x7E, 0xD2, 0xA1, 0x43, 0xFE, 0xAC, 0x32, 0xC4, 0x24, 0xBC, 0x9B, 0xD1, 0xBD, 0x11,
-    0xA3, 0xE8, 0x0D, 0x19, 0x52, 0xF9, 0xFA, 0x30, 0x86, 0x3C, 0x34, 0x9A, 0x1A, 0x3D, 0xCB, 0x27,
-    0x52, 0x23, 0xD1, 0xC7, 0x3B, 0x10, 0xD1, 0xF6, 0x5D, 0xF2, 0xE7, 0x6C, 0x3E, 0x95, 0x13, 0x9E,
-    0x0E, 0xA9, 0x9A, 0x43, 0x9A, 0x5A, 0xFE, 0xF5, 0x9C, 0xEC, 0xAC, 0x9A, 0x40, 0xA4, 0x9E, 0x53,
-    0x96, 0xBE, 0x67, 0x30, 0x44, 0xE3, 0xAC, 0x51, 0x5A, 0x17, 0x92, 0x3D, 0x7C, 0xBE, 0x66, 0xA8,
-    0x31, 0xA6, 0xE6, 0x44, 0x4A, 0x9B, 0x38, 0xB3, 0xC7, 0x35, 0x83, 0x40, 0x28, 0x18, 0x83, 0x77,
-    0x5C, 0x30, 0xC8, 0xA1, 0xCE, 0x8E, 0x83, 0x9A, 0xBA, 0x81, 0xBA, 0x85, 0xE2, 0x8F, 0x93, 0xFC,
-    0xD7, 0x43, 0x87, 0xC0, 0xCF, 0x78, 0x49, 0x9F, 0x63, 0x37, 0x74, 0xA8, 0x15, 0x8D, 0x53, 0x65,
-    0x58, 0x45, 0x64, 0x72, 0xD2, 0x79, 0xA9, 0x65, 0x18, 0x4D, 0x20, 0x6A, 0x82, 0x30, 0x29, 0xBA,
-    0x48, 0x0D, 0x77, 0xEF, 0x52, 0x8B, 0x2A, 0xA8, 0x42, 0xA7, 0x4A, 0xBA, 0xDA, 0xC6, 0x85, 0x2E,
-    0xB4, 0x49, 0xE8, 0xC2, 0x43, 0x34, 0xAC, 0x82, 0xA2, 0xB9, 0x4F, 0x4C, 0xAC, 0xC5, 0x8A, 0xB0,
-    0xC9, 0xF4, 0x19, 0x7A, 0x98, 0x9B, 0xBA, 0x31, 0xA0, 0x2B, 0xAA, 0x32, 0x2D, 0x73, 0xD7, 0x40,
-    0x70, 0x31, 0xB2, 0x61, 0x59, 0x23, 0xEB, 0x20, 0x7A, 0xA9, 0xC0, 0xAF, 0x2B, 0xE8, 0x3E, 0xE9,
-    0x82, 0xD6, 0xF3, 0x20, 0xD3, 0x60, 0x50, 0x31, 0x3B, 0x0D, 0xFE, 0x39, 0x41, 0xA2, 0x2B, 0xE5,
-    0x46, 0xA6, 0x23, 0xB3, 0x8D, 0xFF, 0x48, 0xA3, 0x2B, 0xCD, 0xB7, 0x95, 0x9B, 0x2B, 0xB9, 0x67,
-    0x55, 0x2E, 0xE6, 0x77, 0x72, 0xB5, 0xF2, 0xFE, 0x8E, 0x3F, 0x8C, 0x24, 0x01, 0x76, 0x19, 0xB9,
-    0xD1, 0x65, 0x5C, 0x87, 0x13, 0x90, 0x6C, 0x6C, 0x6B, 0xA2, 0xF7, 0xC2, 0xB7, 0x6E, 0xEF, 0x17,
-    0x9D, 0xBD, 0x7E, 0xAD, 0xEE, 0xBE, 0xF5, 0x13, 0xD3, 0x1F, 0xFC, 0xAB, 0xD2, 0x57, 0x0E, 0x72,
-    0xD4, 0xF9, 0x15, 0x97, 0x9C, 0xAD, 0x6E, 0xAA, 0xAA, 0xA3, 0xCB, 0x5C, 0xD2, 0x6D, 0x86, 0x22,
-    0xA6, 0xBE, 0xA2, 0xE9, 0x4C, 0xCD, 0x9A, 0xE5, 0x24, 0xA3, 0xFA, 0xAB, 0x48, 0xFA, 0xDA, 0xC4,
-    0x2F, 0x71, 0xE1, 0xF5, 0xDB, 0x2E, 0xA8, 0x6A, 0xF2, 0xC2, 0x6A, 0x1F, 0xDD, 0xE8, 0x1F, 0x48,
-    0x8C, 0x37, 0xCC, 0x68, 0x9E, 0xD0, 0x8C, 0x47, 0xC8, 0x12, 0x93, 0x5E, 0xE3, 0xD1, 0xA0, 0xA6,
-    0x47, 0x98, 0xC9, 0xD8, 0x23, 0x7E, 0x7A, 0x74, 0x47, 0x8F, 0xD0, 0xD8, 0x11, 0x23, 0x56, 0x10,
-    0xBA, 0x1C, 0x71, 0x99, 0xDE, 0x1B, 0x15, 0x89, 0xF7, 0x0D, 0xEA, 0x42, 0xBF, 0x3D, 0xBB, 0x3B,
-    0xBF, 0x0F, 0x75, 0x6F, 0x8C, 0x2D, 0x65, 0x63, 0x89, 0x9B, 0x2A, 0x16, 0x19, 0x04, 0x29, 0xA8,
-    0x53, 0x23, 0x60, 0xDE, 0x6B, 0x40, 0x71, 0x88, 0x69, 0x55, 0x3D, 0x48, 0xCE, 0xF3, 0x84, 0x85,
-    0xB7, 0xE8, 0x9E, 0x11, 0xC2, 0xDA, 0x65, 0x1C, 0x7A, 0xDC, 0x9C, 0xE9, 0xFF, 0x5E, 0xCC, 0x4B,
-    0x83, 0xAA, 0x1B, 0x9C, 0x2D, 0xF3, 0x2F, 0x79, 0x9B, 0x1E, 0x5D, 0x3A, 0x11, 0x85, 0x79, 0xDE,
-    0xCF, 0xF8, 0x21, 0x1F, 0xA3, 0x75, 0xCD, 0x46, 0x18, 0xAA, 0x62, 0x19, 0x65, 0x82, 0x6F, 0x6F,
-    0x1A, 0x02, 0x99, 0xC0, 0x8C, 0xEC, 0x8E, 0x72, 0x8B, 0xA8, 0xE3, 0xA2, 0xAF, 0x5C, 0x1E, 0x8C,
-    0xB5, 0xBD, 0x29, 0xF4, 0x53, 0x35, 0x9C, 0x79, 0xBF, 0x01, 0xA3, 0x54, 0x9A, 0xA0, 0x96, 0x74,
-    0x30, 0x1C, 0x44, 0xF1, 0x26, 0x47, 0x6A, 0x25, 0xDD, 0x7F, 0x70, 0x7A, 0x22, 0x48, 0x63, 0x66,
-    0x07, 0xA3, 0x59, 0x05, 0x4E, 0x25, 0x62, 0x4C, 0xB8, 0xC3, 0x6C, 0xC9, 0x66, 0x35, 0x69, 0x77,
-    0x26, 0xA8, 0x9A, 0x19, 0xE7, 0x1A, 0x84, 0x89, 0xD1, 0x87, 0x61, 0x89, 0xAD, 0x72, 0x5D, 0x2E,
-    0xD1, 0xF5, 0x11, 0xFF, 0x24, 0x60, 0xCD, 0x98, 0x9C, 0x61, 0x43, 0x97, 0xF0, 0xCF, 0x5D, 0x64,
-    0xA1, 0x0B, 0x9D, 0x2E, 0x53, 0xD6, 0x18, 0x46, 0x9E, 0xD9, 0x37, 0xBA, 0x7F, 0xC4, 0x5C, 0x05,
-    0x32, 0x96, 0x8C, 0x2B, 0x36, 0xA8, 0xFA, 0xE8, 0xD0, 0xB7, 0x45, 0x26, 0x59, 0xD0, 0x45, 0x47,
-    0x5B, 0xF5, 0x76, 0x8D, 0x2E, 0xDB, 0x01, 0xFA, 0x8F, 0xF6, 0x2B, 0xC2, 0x31, 0x2F, 0x9B, 0x3C,
-    0xC6, 0x2E, 0x15, 0x52, 0xB7, 0xA9, 0xC7, 0x2A, 0x01, 0x8D, 0x6A, 0x95, 0xCC, 0x5D, 0x8C, 0x75,
-    0x99, 0x29, 0xE7, 0xCF, 0x3A, 0xFD, 0x94, 0x90, 0xDD, 0xA5, 0xBD, 0x31, 0xF6, 0xDF, 0xDE, 0xB7,
-    0xCA, 0x93, 0x1C, 0x75, 0x9D, 0x54, 0xA4, 0xEA, 0xDC, 0x50, 0xE3, 0x43, 0x9D, 0xD9, 0x7C, 0xD1,
-    0xB2, 0x8A, 0xA3, 0xC3, 0xA8, 0x44, 0x2F, 0x52, 0xF2, 0x07, 0x42, 0x0F, 0x14, 0x1A, 0x71, 0x84,
-    0xB5, 0x10, 0x0F, 0xC7, 0x3E, 0x79, 0xB2, 0x62, 0x44, 0x2A, 0xD2, 0x70, 0x1D, 0xB1, 0x4B, 0xA0,
-    0x80, 0x1E, 0x56, 0x33, 0xF4, 0x3B, 0xBC, 0x58, 0x95, 0x29, 0x93, 0x6F, 0x15, 0x7A, 0x02, 0x62,
-    0x2C, 0x66, 0x77, 0x63, 0x05, 0x06, 0x4C, 0xD4, 0xBC, 0xA1, 0x53, 0x86, 0xC8, 0x17, 0x42, 0x9E,
-    0x38, 0xFF, 0x75, 0x7A, 0x2F, 0xE2, 0x88, 0x29, 0x5D, 0x73, 0xB0, 0x15, 0x92, 0xF4, 0x42, 0x6E,
-    0x67, 0x63, 0x40, 0x4B, 0x46, 0x1F, 0x5D, 0x25, 0x11, 0x79, 0x16, 0xBE, 0x86, 0x8D, 0xAE, 0x72,
-    0xD6, 0x4A, 0x7A, 0xE9, 0xA6, 0x3D, 0x38, 0x24, 0x25, 0x86, 0xF3, 0x68, 0x2A, 0x38, 0x9A, 0x6A,
-    0xCF, 0xA6, 0x9A, 0x42, 0xCD, 0xD2, 0x21, 0x91, 0xE3, 0x54, 0x3C, 0x81, 0x62, 0x6D, 0x08, 0x8E,
-    0xAF, 0xBF, 0xF3, 0xDD, 0xE5, 0x5F, 0xDE, 0x5D, 0xF9, 0xD5, 0x1B, 0x27, 0x9E, 0x28, 0xE4, 0x3A,
-    0xD9, 0xE5, 0x9A, 0xB3, 0x5B, 0xCD, 0xF1, 0xAC, 0x11, 0xDA, 0x6A, 0x84, 0x30, 0x2D, 0x28, 0x9A,
-    0xA2, 0x78, 0x61, 0x30, 0xDB, 0x34, 0xC4, 0x61, 0x5D, 0x5A, 0x86, 0x9A, 0xD2, 0x31, 0xF3, 0xB8,
-    0xAC, 0xBE, 0x08, 0x3C, 0x71, 0xF5, 0x17, 0x03, 0x81, 0x2A, 0x2E, 0xE8, 0xA6, 0x65, 0x61, 0x91,
-    0x63, 0x69, 0xDF, 0x5D, 0x8D, 0xCC, 0xD6, 0x46, 0x68, 0xAD, 0x8E, 0xB0, 0x97, 0x5C, 0x77, 0xD2,
-    0x59, 0xFC, 0x58, 0x56, 0x77, 0x05, 0x45, 0x95, 0x74, 0x6C, 0x0E, 0xAB, 0x5E, 0xDD, 0xEF, 0x77,
-    0x83, 0xD7, 0x6D, 0xBB, 0x17, 0xDE, 0x35, 0xBD, 0xE9, 0x26, 0xC1, 0x2C, 0xCE, 0x6F, 0x40, 0x68,
-    0x2F, 0x5F, 0x98, 0xD5, 0x7A, 0xEA, 0x41, 0x9E, 0x87, 0x9E, 0x62, 0x64, 0x31, 0xEB, 0xA4, 0xA4,
-    0x23, 0x1E, 0x36, 0x4D, 0xCC, 0x02, 0x4E, 0xDF, 0x45, 0xBA, 0x5F, 0xAC, 0xC4, 0x65, 0x5B, 0xEA,
-    0x42, 0x4F, 0x15, 0x2B, 0x20, 0xE4, 0x72, 0x36, 0x12, 0xF4, 0xDF, 0xA8, 0x37, 0x2B, 0xAB, 0x26,
-    0x3E, 0x6B, 0x86, 0x73, 0xD1, 0x8F, 0x26, 0xE9, 0x74, 0xBB, 0x14, 0x89, 0x7A, 0xFB, 0x1C, 0x0B,
-    0x7E, 0xD2, 0x34, 0x29, 0xA4, 0x23, 0x0A, 0x0D, 0x08, 0x13, 0x73, 0xC9, 0x48, 0x9F, 0x29, 0xA0,
-    0xA0, 0xAD, 0x2B, 0x4D, 0x79, 0x48, 0x9F, 0x0E, 0xF6, 0x27, 0xAA, 0x98, 0x44, 0x18, 0xB7, 0x50,
-    0x1F, 0x43, 0x75, 0x4C, 0x39, 0x7D, 0x9D, 0xCC, 0x6C, 0xC3, 0x7D, 0xCA, 0x31, 0x27, 0x06, 0x18,
-    0x4C, 0x84, 0x1D, 0x03, 0x88, 0x6B, 0xC4, 0x91, 0x6B, 0x8D, 0x76, 0x34, 0xE4, 0x8D, 0xED, 0xD0,
-    0xD7, 0xAA, 0xEE, 0x29, 0xBB, 0x11, 0x99, 0x75, 0x8D, 0x8B, 0x1A, 0xC3, 0x45, 0x76, 0x24, 0x81,
-    0xCB, 0xE8, 0xD7, 0xC7, 0x99, 0x10, 0x92, 0x70, 0x01, 0x8F, 0x39, 0x65, 0x16, 0xF0, 0x8A, 0x2A,
-    0xDA, 0x0D, 0x1C, 0xC5, 0xCD, 0x24, 0xA8, 0xF9, 0xE2, 0x90, 0x36, 0x0B, 0x89, 0xE3, 0x50, 0xBE,
-    0x8F, 0x63, 0xD6, 0xE7, 0x1E, 0x97, 0x5B, 0x66, 0x7D, 0xEE, 0x10, 0x9B, 0x85, 0x1A, 0x3F, 0xE8,
-    0x59, 0x0C, 0xDF, 0xB5, 0xB4, 0x5C, 0xCB, 0x4B, 0xEA, 0xF7, 0xF8, 0x82, 0x25, 0xDC, 0x3C, 0x5A,
-    0xE3, 0xE0, 0xCD, 0x32, 0xCB, 0xD5, 0xAD, 0x09, 0x4E, 0x04, 0xB4, 0x76, 0xE3, 0xE8, 0x23, 0x0B,
-    0x5C, 0x4C, 0x2C, 0x10, 0xE5, 0xEF, 0x57, 0xA4, 0xE6, 0xEB, 0xA3, 0x32, 0x55, 0xD5, 0x86, 0xC6,
-    0xCE, 0xF1, 0xA8, 0xC8, 0xD4, 0x99, 0x92, 0xA5, 0x9D, 0x5E, 0xAD, 0xC4, 0x82, 0x95, 0xB0, 0x5C,
-    0x61, 0x88, 0xA5, 0xB4, 0x19, 0xF2, 0x59, 0x1A, 0x99, 0xAA, 0x1D, 0x15, 0x5B, 0xCB, 0xFC, 0xB1,
-    0xA1, 0x23, 0xDB, 0x5B, 0x0D, 0x5D, 0xCD, 0xB5, 0x91, 0xD1, 0xD7, 0x4C, 0xD5, 0x8A, 0xB0, 0x9C,
-    0xC1, 0x39, 0xF5, 0x62, 0xB1, 0xAC, 0xAF, 0xB9, 0x74, 0xDA, 0xC0, 0xFC, 0xE4, 0x0D, 0x22, 0x67,
-    0x07, 0x79, 0x48, 0x0A, 0x5F, 0x46, 0x2F, 0x2C, 0x62, 0xB3, 0x8E, 0x71, 0x84, 0xE4, 0x2F, 0x4E,
-    0xD8, 0xEE, 0xF3, 0x53, 0x81, 0x9D, 0x80, 0x68, 0x65, 0x46, 0x39, 0xCD, 0xF3, 0xE8, 0xC9, 0xD0,
-    0xF7, 0xE3, 0x33, 0x35, 0xC3, 0xBB, 0x1C, 0xBA, 0x75, 0x55, 0xAE, 0xC7, 0xB6, 0x33, 0x28, 0x18,
-    0xBD, 0xF8, 0x7D, 0xA2, 0xF5, 0x84, 0x24, 0x12, 0x5B, 0x58, 0xE9, 0xB8, 0xF0, 0x39, 0x97, 0x8C,
-    0x35, 0x85, 0x13, 0x5B, 0x2C, 0x64, 0x48, 0x9B, 0x5E, 0x27, 0x75, 0xEA, 0x87, 0xD2, 0xCB, 0xB2,
-    0x97, 0x3A, 0x40, 0x40, 0x6A, 0xCC, 0x82, 0x97, 0xD9, 0x27, 0x14, 0x83, 0xC6, 0x67, 0x43, 0x38,
-    0xF6, 0x87, 0x53, 0x55, 0x44, 0x6C, 0x12, 0x34, 0xFD, 0xBC, 0xCA, 0xFC, 0xCF, 0xD9, 0x3A, 0x0E,
-    0x37, 0x94, 0x2D, 0x69, 0xC7, 0x16, 0x5B, 0xCA, 0x8A, 0x1D, 0xCD, 0xAE, 0xF6, 0x44, 0xB1, 0x19,
-    0x3C, 0x27, 0xED, 0x88, 0x55, 0xDF, 0xC3, 0x72, 0x3B, 0xB0, 0x1B, 0x6C, 0x31, 0x2B, 0x36, 0x4B,
-    0xD2, 0x3E, 0x5B, 0x69, 0xEF, 0x9A, 0xD0, 0xD1, 0xF1, 0xC1, 0x9F, 0x6D, 0x51, 0x55, 0xE3, 0x5E,
-    0xE6, 0x33, 0xED, 0x0F, 0xD4, 0xD4, 0xE3, 0x20, 0x37, 0xDD, 0x58, 0x7E, 0xAD, 0xC5, 0xD0, 0xB1,
-    0x09, 0xFF, 0x64, 0xA4, 0x05, 0x24, 0x4F, 0x90, 0x0B, 0xE2, 0x3D, 0xC4, 0x2F, 0x99, 0xF8, 0x05,
-    0x32, 0x58, 0x87, 0xB2, 0x35, 0xB6, 0x22, 0xD3, 0x62, 0x31, 0xBB, 0xC5, 0x9F, 0x3F, 0x15, 0x56,
-    0x77, 0x10, 0x31, 0xBF, 0xA6, 0x4D, 0x39, 0xE1, 0x01, 0x29, 0xE1, 0x25, 0x06, 0x65, 0xD3, 0x68,
-    0xCA, 0xC3, 0xDF, 0x6F, 0xDF, 0xBA, 0xF1, 0xA0, 0xDE, 0x4A, 0x15, 0x22, 0x74, 0x68, 0x38, 0xD9,
-    0x3F, 0xF7, 0xE2, 0xC5, 0x50, 0xD8, 0xAA, 0x49, 0xB8, 0x15, 0x48, 0xED, 0x94, 0xC6, 0xC0, 0x91,
-    0x43, 0x09, 0xC1, 0x4C, 0xCE, 0xB0, 0x7F, 0xFD, 0x19, 0x61, 0x15, 0x16, 0xC7, 0xB1, 0x16, 0x34,
-    0x1F, 0x76, 0x9E, 0xE8, 0xE2, 0xC7, 0x3A, 0xEC, 0x83, 0x6C, 0x6C, 0x1C, 0xAA, 0xE5, 0x47, 0x58,
-    0xC9, 0x1A, 0x9E, 0x30, 0x4F, 0x24, 0x33, 0xF9, 0x52, 0xB1, 0x96, 0x6F, 0xA3, 0xFD, 0xC9, 0xD7,
-    0x5E, 0xE6, 0xDD, 0xFF, 0x01, 0xAD, 0x58, 0x4D, 0x6C, 0x1B, 0xC7, 0x19, 0x7D, 0x33, 0x63, 0x6B,
-    0x1D, 0xAE, 0xC4, 0xCD, 0xC1, 0x07, 0x25, 0xA1, 0x44, 0x1F, 0x0C, 0x54, 0x71, 0x25, 0xD1, 0x07,
-    0x15, 0x55, 0x01, 0x4A, 0x9C, 0x54, 0x05, 0x7A, 0x70, 0x81, 0x08, 0x45, 0x0E, 0x6D, 0x4F, 0x3A,
-    0xE4, 0x10, 0x20, 0x29, 0xC2, 0x03, 0x0F, 0x4A, 0x21, 0x47, 0xE3, 0x04, 0x48, 0x8B, 0xB6, 0x07,
-    0x9D, 0x8A, 0x5E, 0x0A, 0xF0, 0x90, 0x43, 0xD0, 0x22, 0x10, 0x51, 0xA8, 0x00, 0x83, 0xCA, 0xE6,
-    0xD8, 0x3A, 0xB4, 0x41, 0x73, 0xD8, 0x34, 0x05, 0xDA, 0xE3, 0x36, 0x08, 0x50, 0xD7, 0x3E, 0x64,
-    0x83, 0x12, 0x08, 0xAD, 0x50, 0x9C, 0xBE, 0x99, 0x65, 0x1C, 0xC9, 0xCE, 0x7F, 0x32, 0x10, 0xB9,
-    0xCB, 0xDD, 0x99, 0x37, 0xDF, 0xEF, 0xFB, 0xBE, 0x91, 0x58, 0x4F, 0xEC, 0x2A, 0xFA, 0x40, 0x8C,
-    0x2D, 0x91, 0xC5, 0xBA, 0x8E, 0x5C, 0x99, 0x19, 0x74, 0x94, 0x2D, 0x63, 0x09, 0x61, 0x08, 0x83,
-    0x14, 0x17, 0xD1, 0x13, 0x23, 0xF3, 0x3F, 0xB4, 0x6C, 0x7D, 0xA3, 0xBC, 0xA4, 0x7E, 0x8D, 0x0F,
-    0xD0, 0x18, 0x48, 0xC7, 0xE7, 0x67, 0xC7, 0xB3, 0x34, 0x22, 0xA7, 0xE5, 0x3B, 0xF3, 0x58, 0x06,
-    0x94, 0x86, 0x5F, 0x3D, 0xBE, 0x3C, 0x72, 0x4B, 0x2B, 0xD7, 0x87, 0x32, 0xC0, 0x1E, 0x70, 0x15,
-    0x68, 0x1C, 0xEE, 0x28, 0xE7, 0x8C, 0xC4, 0x4E, 0xEF, 0x28, 0xFA, 0xBE, 0xC9, 0x96, 0xCB, 0x89,
-    0x74, 0xF9, 0x9F, 0xDF, 0x7D, 0x0C, 0x0F, 0x7A, 0xA8, 0x5C, 0xD9, 0x05, 0x65, 0xD5, 0x5F, 0x2C,
-    0x7A, 0x16, 0x89, 0x85, 0xFA, 0x07, 0x1A, 0x0E, 0xE8, 0x02, 0x2B, 0x40, 0x75, 0x1D, 0x6E, 0x08,
-    0x95, 0x72, 0x5A, 0xB1, 0x71, 0x53, 0x9A, 0x29, 0x5C, 0xA4, 0x90, 0x7E, 0x94, 0x78, 0x67, 0x4B,
-    0xDC, 0xD4, 0x86, 0x9F, 0x3D, 0x8D, 0xEF, 0x54, 0x30, 0xE1, 0x67, 0x01, 0xB5, 0x01, 0x92, 0xDF,
-    0xE4, 0xC2, 0x2A, 0x3D, 0x8F, 0xA6, 0x18, 0x3D, 0x8B, 0x09, 0x67, 0x21, 0x89, 0xB2, 0x8A, 0xC4,
-    0x59, 0xE5, 0xB2, 0xB0, 0xE4, 0x81, 0x52, 0xB2, 0x76, 0xF0, 0xF7, 0x7C, 0xA2, 0xFD, 0xD0, 0xA9,
-    0xB9, 0x53, 0x1B, 0x67, 0x7E, 0x7A, 0xF6, 0xDC, 0xCE, 0x69, 0x3E, 0x8E, 0xCD, 0x8B, 0xA7, 0x27,
-    0x1F, 0xCD, 0x9E, 0xD7, 0x38, 0x27, 0x90, 0xCD, 0x47, 0xDA, 0x7F, 0x56, 0x62, 0x53, 0x55, 0x69,
-    0x84, 0x54, 0x40, 0x5F, 0x78, 0xA2, 0x4A, 0xB8, 0x0C, 0x2D, 0xCC, 0xE3, 0xC2, 0xEF, 0xFD, 0xFD,
-    0x7A, 0xF4, 0xBD, 0xE9, 0x2B, 0xDF, 0xB8, 0x32, 0xFD, 0x8B, 0xE9, 0xF6, 0x84, 0x86, 0x70, 0x85,
-    0x48, 0xCF, 0xEA, 0xE7, 0x5A, 0x4B, 0xE5, 0x79, 0x75, 0x69, 0xED, 0xBA, 0x4B, 0x6B, 0x06, 0x12,
-    0x98, 0x03, 0x52, 0x49, 0xA5, 0xFC, 0x15, 0xC2, 0x4F, 0xAA, 0x39, 0xFF, 0x3D, 0x81, 0x8D, 0xB3,
-    0xF3, 0xCB, 0x0D, 0x83, 0xD3, 0x38, 0x03, 0xD3, 0x96, 0xBA, 0x79, 0x15, 0x91, 0x5A, 0x33, 0x1A,
-    0x59, 0x8C, 0x65, 0x65, 0x67, 0xFC, 0xB5, 0xA5, 0xEC, 0xBC, 0xC8, 0x13, 0xEC, 0xC7, 0xA6, 0xE1,
-    0xB2, 0xAA, 0xEB, 0x4F, 0x6D, 0x3F, 0xA3, 0xB8, 0x58, 0x7B, 0x9F, 0x08, 0x34, 0x4A, 0x70, 0x53,
-    0xE2, 0x68, 0x52, 0x0C, 0x2B, 0x18, 0xCE, 0x61, 0x6F, 0x09, 0xF9, 0x45, 0x91, 0x37, 0x55, 0xDA,
-    0x8E, 0x6C, 0x9A, 0x58, 0x5B, 0x7D, 0xCC, 0x36, 0xA4, 0x49, 0xA2, 0x1B, 0x6D, 0x9C, 0x12, 0xEB,
-    0xD3, 0x5D, 0x94, 0x4E, 0x9F, 0x99, 0x9C, 0x1E, 0xA1, 0xB4, 0xF6, 0x83, 0xF5, 0xD7, 0xA7, 0xB7,
-    0x89, 0x73, 0x56, 0xA4, 0xCB, 0x22, 0x5B, 0x40, 0x67, 0x46, 0xA5, 0xDD, 0xC5, 0xC8, 0xE6, 0x15,
-    0x51, 0xB8, 0xA9, 0x0E, 0x9C, 0x36, 0xD0, 0xE7, 0x71, 0x5E, 0xD1, 0xEE, 0x4D, 0x61, 0xF8, 0x35,
-    0x71, 0xB3, 0x02, 0x77, 0x40, 0x9D, 0xD2, 0x0E, 0x96, 0xBE, 0x89, 0x72, 0x69, 0x43, 0xDE, 0xF8,
-    0x25, 0x3A, 0x8D, 0xFE, 0x3C, 0x2A, 0x52, 0x4B, 0x2B, 0x69, 0x84, 0x87, 0xA9, 0x23, 0x17, 0xC1,
-    0x4A, 0x13, 0xA1, 0x82, 0x39, 0x61, 0x27, 0x6E, 0x96, 0x07, 0x8D, 0xFC, 0x5F, 0x73, 0x98, 0x42,
-    0x1B, 0x99, 0xD2, 0x25, 0x62, 0x77, 0x62, 0x1B, 0x63, 0x80, 0x66, 0x7C, 0xA4, 0xF4, 0x85, 0x36,
-    0xD4, 0x80, 0x3B, 0x9E, 0x83, 0x16, 0x74, 0xF6, 0x00, 0x3B, 0x58, 0x2A, 0x01, 0x76, 0x43, 0xEE,
-    0x46, 0xA8, 0x66, 0xCD, 0x73, 0x50, 0xDF, 0xB5, 0x7E, 0x3F, 0xF5, 0xC2, 0x6F, 0xB1, 0x3C, 0xD7,
-    0x96, 0xF6, 0xDD, 0x94, 0x1B, 0xC2, 0xF8, 0x18, 0x11, 0x6D, 0x3A, 0xCF, 0x0B, 0x1B, 0x62, 0x74,
-    0x11, 0x0C, 0x76, 0x65, 0xB1, 0x8D, 0x38, 0x65, 0x44, 0x45, 0xFE, 0x8D, 0xC8, 0x10, 0x6B, 0xCC,
-    0xC2, 0xAC, 0xEE, 0xA2, 0x96, 0x16, 0x51, 0x75, 0x1E, 0xFE, 0xB1, 0x5F, 0x39, 0x1E, 0x82, 0x50,
-    0x0D, 0x3E, 0xC8, 0x21, 0x6E, 0x53, 0xF7, 0x0E, 0xE2, 0x4B, 0x5A, 0x64, 0x2D, 0xD4, 0x23, 0x13,
-    0x9B, 0x4D, 0x91, 0x47, 0xB6, 0xE1, 0x86, 0xB1, 0x73, 0xD7, 0xFB, 0xD8, 0x5A, 0x45, 0xE4, 0x61,
-    0x18, 0xFA, 0x92, 0xEB, 0x2B, 0x63, 0x6F, 0x9C, 0x1C, 0x55, 0x7E, 0x86, 0x01, 0x0F, 0x3F, 0x63,
-    0x88, 0xFF, 0x0D, 0x58, 0x58, 0x80, 0x07, 0x4C, 0xB8, 0x6F, 0x37, 0x32, 0x91, 0xAD, 0x32, 0xEA,
-    0x87, 0xD2, 0xB9, 0xBC, 0xAA, 0x23, 0x3B, 0x40, 0x75, 0x8C, 0xB1, 0xC9, 0xBC, 0x7A, 0x85, 0x02,
-    0x4E, 0x17, 0x3F, 0xB7, 0xF8, 0x93, 0x18, 0x35, 0x1B, 0xE4, 0x4A, 0xE6, 0x99, 0x63, 0x7B, 0x88,
-    0xAE, 0xA4, 0x5E, 0x30, 0x99, 0xCD, 0x72, 0x9F, 0x2D, 0x10, 0x83, 0x92, 0xD9, 0xCB, 0xA8, 0xAA,
-    0x0C, 0x97, 0xB9, 0x68, 0xE6, 0x0C, 0xF0, 0xFA, 0x06, 0x26, 0x92, 0x8F, 0xE4, 0xF9, 0x52, 0x38,
-    0xF5, 0x05, 0xA6, 0x25, 0x93, 0xF2, 0xE5, 0xA7, 0x4E, 0x2A, 0xD6, 0xF0, 0xB9, 0x87, 0x80, 0xE4,
-    0x35, 0xA3, 0xA9, 0x30, 0x1B, 0x69, 0x0F, 0xE5, 0x55, 0xF3, 0xC6, 0x62, 0xFE, 0x5B, 0x8F, 0xE5,
-    0x75, 0x2B, 0xCC, 0x25, 0x77, 0x80, 0x97, 0xE0, 0x3D, 0x72, 0xD2, 0x4A, 0x5E, 0x2A, 0x62, 0xCD,
-    0x76, 0x02, 0x14, 0x85, 0x22, 0x92, 0xB2, 0x9B, 0x1E, 0x88, 0x32, 0x79, 0x9C, 0x9E, 0x1B, 0x12,
-    0xE6, 0xA0, 0x10, 0x29, 0x8C, 0xC8, 0xF9, 0x6C, 0x6B, 0xB8, 0x3B, 0x5C, 0x1E, 0x52, 0x69, 0xC1,
-    0x87, 0x8F, 0x7C, 0xCB, 0x7B, 0x65, 0xB6, 0x1A, 0x38, 0x66, 0xFB, 0x88, 0x5A, 0x0A, 0x47, 0xF0,
-    0xBE, 0x77, 0x72, 0x6C, 0xA8, 0x06, 0xB6, 0x49, 0x53, 0x5C, 0xE1, 0xDC, 0x80, 0x54, 0xC3, 0x74,
-    0x52, 0x99, 0x20, 0x4F, 0x1D, 0x93, 0x67, 0xE2, 0x08, 0xB1, 0x4B, 0x15, 0x67, 0x0D, 0x3C, 0x6F,
-    0x20, 0xB2, 0x3E, 0x9E, 0xBC, 0x98, 0xB2, 0x88, 0x0F, 0x1F, 0xA7, 0x8D, 0xD1, 0x3E, 0xDD, 0x66,
-    0x12, 0x82, 0xD5, 0x46, 0xF0, 0xC9, 0x22, 0xD6, 0x7D, 0x36, 0x07, 0xDD, 0x18, 0x83, 0x28, 0x17,
-    0xF6, 0x2E, 0x86, 0x62, 0xE6, 0xF7, 0x46, 0xDA, 0xBB, 0x82, 0x10, 0xB3, 0x44, 0x4A, 0x3D, 0x04,
-    0x75, 0xF0, 0x01, 0x8A, 0xF1, 0xF3, 0x9A, 0xCB, 0x29, 0x17, 0x65, 0x1A, 0xB3, 0x9E, 0x0F, 0xD0,
-    0x88, 0x68, 0xE9, 0x3D, 0x61, 0xD5, 0xF0, 0x66, 0x7D, 0xC7, 0xAF, 0x48, 0x8A, 0x08, 0x5E, 0xF0,
-    0x3B, 0x64, 0xA0, 0xBA, 0x5E, 0xCD, 0xE2, 0xB9, 0x2C, 0x90, 0x3C, 0x20, 0x48, 0x59, 0xA8, 0x1A,
-    0x28, 0x4F, 0x92, 0xA7, 0xBE, 0xF8, 0x72, 0x61, 0xDA, 0xA8, 0x2F, 0x22, 0x3E, 0xC8, 0xBE, 0xB4,
-    0x3A, 0x1A, 0x33, 0x61, 0x52, 0xE1, 0x39, 0x2B, 0x33, 0x5A, 0xB4, 0x4E, 0x93, 0xC6, 0x86, 0x2C,
-    0x9F, 0xD3, 0x50, 0x8B, 0x48, 0x78, 0xCB, 0x04, 0x1C, 0x86, 0xC0, 0xE2, 0x98, 0xF2, 0x89, 0xD5,
-    0x3C, 0xA1, 0x38, 0x3D, 0xD1, 0x45, 0xA2, 0xB9, 0xA0, 0x0A, 0x42, 0xAC, 0xF8, 0x24, 0xDF, 0xF2,
-    0x42, 0x93, 0xF5, 0x35, 0xD7, 0x36, 0x42, 0x20, 0x2D, 0x31, 0xED, 0xC5, 0x0D, 0xF3, 0x05, 0x56,
-    0xB4, 0x9F, 0x8C, 0x0E, 0xD2, 0x46, 0x55, 0x1F, 0xDB, 0xE7, 0x43, 0x0E, 0xA9, 0xFA, 0x9A, 0x44,
-    0x19, 0x13, 0xEF, 0x4D, 0x22, 0x24, 0x86, 0x20, 0x5C, 0xC8, 0x92, 0x35, 0x96, 0x53, 0x32, 0x90,
-    0x12, 0x1A, 0xA4, 0x2E, 0x07, 0x22, 0x13, 0x79, 0xAC, 0x55, 0x5A, 0x47, 0xF2, 0x93, 0x43, 0xB3,
-    0xE2, 0x46, 0xC8, 0xEB, 0x88, 0x6D, 0x8E, 0x6B, 0xD1, 0xAD, 0x5E, 0x5E, 0x73, 0x4E, 0x3B, 0x6F,
-    0x93, 0x41, 0x88, 0x56, 0xE6, 0x76, 0xE5, 0xAF, 0xAC, 0x45, 0xB3, 0x05, 0xCC, 0xC3, 0xDC, 0x22,
-    0xB1, 0xE4, 0x84, 0x5C, 0xA5, 0xF2, 0x88, 0x02, 0x3B, 0xD3, 0xC5, 0xE5, 0x7C, 0x05, 0x8B, 0x75,
-    0xBE, 0x78, 0x3C, 0x36, 0xD1, 0xC1, 0x5B, 0xA9, 0xCC, 0x5F, 0xCB, 0x31, 0xA8, 0xF2, 0x85, 0x3A,
-    0x42, 0x0D, 0x8E, 0x2B, 0x1A, 0x76, 0x2C, 0x74, 0x07, 0xA1, 0x76, 0x16, 0xC5, 0x85, 0x62, 0x8D,
-    0x34, 0x6A, 0x7F, 0xC8, 0x30, 0x14, 0x7D, 0x86, 0x6D, 0x97, 0x2A, 0xED, 0x93, 0x00, 0x37, 0xA9,
-    0xC7, 0x26, 0x77, 0xDC, 0xA3, 0xCF, 0xF3, 0x05, 0x2A, 0xD4, 0xA0, 0xB1, 0x6A, 0xB7, 0x7A, 0xA6,
-    0x4A, 0x4F, 0x79, 0x2D, 0xA4, 0xDB, 0x39, 0x6E, 0x71, 0x82, 0xFB, 0x92, 0x1E, 0xDF, 0x47, 0x6D,
-    0x5F, 0x1D, 0xDF, 0x77, 0x1E, 0xEC, 0x13, 0xC4, 0x0B, 0xE6, 0xEB, 0xC1, 0x6B, 0x9D, 0x03, 0xDE,
-    0xD8, 0x80, 0x38, 0xB0, 0x77, 0xA9, 0xF8, 0x2B, 0x63, 0xB6, 0x9F, 0x64, 0x82, 0x30, 0x0E, 0xFE,
-    0x9D, 0x7F, 0x5D, 0x7A, 0x4B, 0x89, 0xF7, 0x99, 0x38, 0xD5, 0x6C, 0x71, 0xF1, 0xA4, 0x3D, 0x95,
-    0x3D, 0x71, 0x49, 0x3F, 0xF1, 0x52, 0x7B, 0x3F, 0x5C, 0xAE, 0xED, 0x86, 0x6C, 0x1C, 0x7A, 0x9E,
-    0x02, 0xF6, 0xE5, 0x28, 0x10, 0xBC, 0xFC, 0xC0, 0xAF, 0x5F, 0x90, 0xEF, 0xF9, 0x97, 0x89, 0xC8,
-    0x37, 0x7D, 0x34, 0x5F, 0xA1, 0x44, 0xDC, 0xF9, 0xCD, 0x3C, 0x94, 0x82, 0x3F, 0x05, 0x2E, 0x44,
-    0xA3, 0x1F, 0x7B, 0x9C, 0x78, 0x14, 0x70, 0x48, 0x81, 0x41, 0xC5, 0xF1, 0xE5, 0xB0, 0x90, 0x76,
-    0x50, 0x88, 0x36, 0xFC, 0x94, 0xCB, 0x3B, 0xF7, 0x84, 0x85, 0xB0, 0x85, 0x9C, 0xE2, 0x2E, 0xA3,
-    0xC6, 0x56, 0x65, 0xAB, 0xCC, 0xA3, 0x3E, 0xF6, 0x59, 0x12, 0xB2, 0x1A, 0x13, 0x6F, 0x40, 0x4E,
-    0x27, 0x07, 0x54, 0x79, 0xDB, 0x65, 0xDE, 0x64, 0x32, 0x4B, 0xD2, 0x9A, 0x66, 0x25, 0xE4, 0xFE,
-    0x29, 0x7A, 0x77, 0x70, 0xB7, 0x29, 0x0D, 0x85, 0x35, 0xBD, 0x1B, 0xD4, 0xC7, 0xC2, 0x8F, 0x79,
-    0x90, 0xB0, 0x80, 0xAE, 0xA0, 0xC6, 0x6C, 0x1C, 0x70, 0x93, 0xD4, 0x6F, 0x12, 0x3C, 0xA2, 0x52,
-    0xB2, 0x09, 0xD3, 0xB6, 0xAB, 0xA8, 0x63, 0x12, 0x28, 0xC8, 0xB3, 0xB4, 0x3E, 0x69, 0xEC, 0x45,
-    0x56, 0x41, 0xBB, 0xF3, 0xA1, 0x84, 0x0D, 0xD6, 0xDE, 0x8F, 0x97, 0x70, 0xF3, 0x93, 0x25, 0x94,
-    0x96, 0x84, 0x40, 0x6B, 0x3E, 0xF5, 0xE8, 0x71, 0x65, 0xBF, 0x14, 0x94, 0xAF, 0x20, 0x6D, 0x6F,
-    0x3D, 0x75, 0x6F, 0x1B, 0xB1, 0x49, 0x06, 0xC0, 0xD6, 0x0A, 0xF2, 0x45, 0x95, 0xD6, 0x12, 0x5D,
-    0xA5, 0x6E, 0x43, 0x24, 0xB9, 0xEF, 0x6D, 0x62, 0xEB, 0xF9, 0xA8, 0xA6, 0x3D, 0x15, 0xF5, 0x02,
-    0x05, 0x78, 0xC6, 0xEA, 0xA3, 0xD3, 0x55, 0xB6, 0x53, 0x46, 0xDA, 0x8C, 0xE5, 0xF5, 0x7E, 0xD2,
-    0x43, 0x63, 0x87, 0xC0, 0xCC, 0x61, 0x76, 0xED, 0x78, 0x24, 0x65, 0x83, 0x28, 0xEC, 0xB4, 0x34,
-    0x7B, 0x6A, 0x4D, 0x47, 0x0F, 0x20, 0x2E, 0x21, 0x89, 0xF4, 0xAC, 0x4C, 0x17, 0xC8, 0x56, 0x22,
-    0x5B, 0x71, 0xF6, 0x35, 0xC6, 0xD2, 0xD9, 0x30, 0x7B, 0x33, 0x04, 0x9C, 0x61, 0x75, 0x58, 0x8C,
-    0xAF, 0xA4, 0x33, 0x65, 0x74, 0x2E, 0xAA, 0xEB, 0xB6, 0x16, 0xDD, 0x1E, 0x24, 0xEC, 0x43, 0xFF,
-    0x53, 0x88, 0x9A, 0xB2, 0x33, 0x3C, 0x46, 0xD4, 0x71, 0x06, 0x37, 0x88, 0x5F, 0xC8, 0x5A, 0xD1,
-    0x9A, 0x99, 0x9F, 0x44, 0xDE, 0x8C, 0xAF, 0x1F, 0x8E, 0x48, 0x7A, 0xD1, 0x9D, 0xD4, 0x73, 0x49,
-    0x94, 0x61, 0x72, 0xBA, 0x80, 0xE5, 0x3C, 0x99, 0x75, 0x23, 0xDD, 0x22, 0x2E, 0x27, 0x56, 0x64,
-    0x5E, 0xDD, 0xCD, 0x08, 0xEC, 0x67, 0x56, 0x27, 0xF1, 0xAD, 0x1F, 0xE1, 0x62, 0x88, 0xC6, 0xDA,
-    0x2B, 0xC8, 0xBA, 0x4A, 0xB7, 0x62, 0x74, 0xA6, 0xEE, 0x99, 0x36, 0xF7, 0x00, 0xB6, 0x16, 0xB0,
-    0xBF, 0xF2, 0xD9, 0x80, 0xE4, 0x84, 0x33, 0x06, 0x3F, 0x0C, 0xB5, 0x90, 0xD9, 0xC3, 0xA4, 0x34,
-    0xEC, 0x74, 0x75, 0x6B, 0x59, 0x5A, 0x9B, 0x44, 0xD8, 0xE7, 0xCC, 0x86, 0x33, 0xDB, 0xBF, 0x1B,
-    0x7B, 0x76, 0xE0, 0xD5, 0x70, 0x6F, 0xDA, 0xC5, 0x38, 0x9B, 0x8A, 0xF4, 0xE5, 0xA7, 0xD3, 0x2C,
-    0x76, 0x37, 0x89, 0x49, 0x17, 0xD5, 0x58, 0x4C, 0x77, 0x8F, 0x26, 0xF8, 0xDA, 0xE5, 0xD1, 0x9D,
-    0xDB, 0xC1, 0x81, 0x35, 0xFB, 0xFC, 0x46, 0x9D, 0x35, 0x2E, 0xF1, 0x2A, 0xFA, 0x3A, 0x93, 0x8C,
-    0x78, 0xB0, 0x61, 0x07, 0x66, 0x78, 0x7A, 0xEA, 0x07, 0xEF, 0xEE, 0x85, 0xBF, 0x0F, 0x7B, 0x8C,
-    0x3E, 0xBD, 0x10, 0x63, 0xE3, 0xB9, 0xDD, 0x1B, 0xEE, 0xBF, 0x53, 0xC1, 0xD6, 0x77, 0x4E, 0x4B,
-    0xD7, 0x17, 0xE3, 0x4E, 0xC4, 0x7A, 0x9B, 0x76, 0xEE, 0x49, 0xAD, 0xAB, 0x58, 0x98, 0x92, 0x76,
-    0x7A, 0xF6, 0xE9, 0xBC, 0x77, 0xB8, 0xA6, 0x7D, 0x87, 0xB1, 0xFA, 0x98, 0xEE, 0x1D, 0x61, 0x3B,
-    0xF3, 0xD5, 0x92, 0x64, 0x1A, 0x95, 0x3E, 0xC7, 0xCC, 0xB9, 0x87, 0x7C, 0x34, 0x0D, 0x2E, 0x7F,
-    0x04, 0xFC, 0xAC, 0x96, 0x69, 0x4A, 0x61, 0x38, 0xBD, 0x36, 0xDA, 0x59, 0x0A, 0xD2, 0x70, 0x7E,
-    0xCD, 0xE9, 0x68, 0xC4, 0x96, 0x26, 0x41, 0x80, 0xE5, 0x71, 0x04, 0x3C, 0x07, 0xCD, 0x21, 0x8B,
-    0xFC, 0x09, 0xD2, 0xE7, 0xA4, 0x34, 0x8C, 0xAB, 0xF4, 0x78, 0xEE, 0xB7, 0x49, 0xEB, 0x15, 0x4E,
-    0x55, 0x46, 0xF8, 0xBA, 0x5E, 0x0F, 0xDD, 0xF1, 0x00, 0x6F, 0x9A, 0xF0, 0x36, 0xBB, 0xEF, 0x6D,
-    0x12, 0xFD, 0xFC, 0xE0, 0xED, 0xF6, 0xCB, 0xC5, 0x21, 0x8F, 0x1B, 0x4C, 0xB1, 0xE1, 0x91, 0xC5,
-    0x11, 0xAB, 0x8E, 0xBB, 0x9D, 0x6B, 0xB7, 0x38, 0xDC, 0x3D, 0x7D, 0x2B, 0x14, 0xDB, 0x07, 0x97,
-    0x50, 0x7D, 0xCF, 0x8A, 0xEC, 0x55, 0xEA, 0x95, 0xA3, 0xA9, 0x8C, 0xB4, 0x04, 0x7D, 0x89, 0x31,
-    0xC3, 0xB8, 0xAD, 0x7A, 0x71, 0xD4, 0x01, 0xD4, 0x8F, 0x0D, 0x0E, 0xEC, 0xF8, 0x40, 0xB0, 0x3D,
-    0x44, 0x2D, 0xD2, 0x89, 0x48, 0x23, 0xD3, 0x92, 0x96, 0xC2, 0x27, 0xD8, 0x8A, 0xCC, 0x22, 0x33,
-    0x51, 0x7F, 0x8C, 0x6F, 0xE2, 0x3E, 0x0E, 0xF7, 0x12, 0x64, 0x4D, 0x79, 0x60, 0xCB, 0x65, 0x2C,
-    0x33, 0x42, 0x0E, 0xAF, 0x49, 0x97, 0xB1, 0x2A, 0x8F, 0x7D, 0x33, 0x75, 0x9F, 0x6F, 0xF8, 0x6E,
-    0xF5, 0x55, 0x65, 0x97, 0x2B, 0xE8, 0xE4, 0xEA, 0x45, 0xC3, 0x65, 0x9D, 0xD5, 0x5D, 0xD3, 0x1B,
-    0xF8, 0xD3, 0x69, 0xE1, 0x9B, 0x89, 0xD2, 0xE7, 0x98, 0xC9, 0x9E, 0xFD, 0x8D, 0x8D, 0x63, 0x1D,
-    0xFB, 0xA7, 0x89, 0x42, 0x3F, 0x6E, 0xD2, 0x8F, 0x5B, 0x1F, 0x09, 0xD1, 0xD3, 0xEA, 0x56, 0xCA,
-    0xD9, 0x84, 0xAE, 0x23, 0x5B, 0xE6, 0x9F, 0xB4, 0xC4, 0x66, 0x7F, 0x4A, 0x1C, 0xDF, 0xA6, 0xF5,
-    0x43, 0x03, 0x4E, 0x93, 0x3C, 0xD1, 0x0B, 0x27, 0xE1, 0xF3, 0xA1, 0xA3, 0x09, 0x59, 0xEC, 0x09,
-    0x76, 0x12, 0xE1, 0x9C, 0xCA, 0x88, 0x0D, 0x59, 0x22, 0xC6, 0xC5, 0x3F, 0xF2, 0x45, 0x8F, 0xAE,
-    0xA2, 0x80, 0xF5, 0x6F, 0x5B, 0x34, 0xFF, 0x68, 0x91, 0xBF, 0x65, 0xF1, 0xF6, 0x81, 0xC1, 0x3F,
-    0x2F, 0xB1, 0x64, 0x5C, 0xE3, 0xC7, 0x77, 0xC4, 0x69, 0x61, 0x95, 0xCC, 0xF3, 0x62, 0xB1, 0xD2,
-    0x2B, 0x32, 0x53, 0x9C, 0x22, 0xB1, 0x7E, 0x2C, 0x90, 0xD3, 0xD0, 0x0B, 0xFA, 0x7D, 0x29, 0x61,
-    0x96, 0x28, 0xBD, 0x5C, 0x11, 0x69, 0x27, 0x56, 0xB6, 0x9E, 0x48, 0x9F, 0x85, 0xEE, 0x48, 0x1C,
-    0x15, 0x06, 0x26, 0x1B, 0xCE, 0x05, 0x41, 0xEE, 0x0E, 0xDA, 0x8B, 0xC7, 0xE2, 0xB4, 0x1C, 0xA1,
-    0x35, 0x2F, 0x6D, 0x9E, 0x28, 0xDB, 0x65, 0x86, 0x37, 0x9C, 0xDE, 0x7E, 0xC6, 0xF7, 0x14, 0x72,
-    0x80, 0xCA, 0xF4, 0x67, 0x4D, 0x6B, 0x9F, 0x8F, 0x6E, 0x78, 0x2E, 0x0D, 0x80, 0x9F, 0x2E, 0x42,
-    0x29, 0xE8, 0xEF, 0x49, 0xF9, 0xFE, 0xE3, 0x5D, 0x87, 0xC7, 0x73, 0x91, 0x2A, 0x93, 0x23, 0x67,
-    0xB8, 0xB2, 0xD3, 0x7B, 0x95, 0x75, 0x94, 0x86, 0x30, 0xE1, 0x1F, 0x1A, 0x99, 0x6F, 0x13, 0x65,
-    0xDF, 0xF3, 0x71, 0x9C, 0x1D, 0x6B, 0xA8, 0x08, 0xC7, 0x83, 0x97, 0x83, 0x7A, 0x1C, 0x95, 0x32,
-    0xDA, 0x73, 0x4A, 0xA7, 0x93, 0x11, 0x9A, 0x2D, 0xF9, 0x2B, 0x93, 0xF4, 0xA9, 0x81, 0x08, 0xB9,
-    0xBF, 0x54, 0x6C, 0x98, 0xB0, 0x21, 0xBC, 0x91, 0xC9, 0x71, 0x86, 0x84, 0x31, 0x8F, 0x9C, 0xB4,
-    0x85, 0xAC, 0x8E, 0x3A, 0xF9, 0x26, 0x81, 0xBC, 0xCD, 0x00, 0x67, 0x21, 0xC8, 0x42, 0x2B, 0x3B,
-    0x08, 0xA7, 0x0E, 0x52, 0xC1, 0x91, 0x37, 0x45, 0x18, 0xFF, 0x07, 0xAD, 0x59, 0x4F, 0x6C, 0x1C,
-    0x57, 0x19, 0xFF, 0x66, 0x5E, 0xEC, 0x49, 0x3C, 0xF6, 0xBE, 0x1C, 0x82, 0x48, 0x89, 0xED, 0xF5,
-    0x21, 0x95, 0x0C, 0x72, 0x76, 0x7C, 0xB0, 0x90, 0x51, 0x77, 0x3D, 0xAF, 0xAD, 0xC4, 0xA5, 0x42,
-    0xB2, 0xD4, 0x16, 0xA9, 0x70, 0x20, 0x07, 0x0E, 0x15, 0x45, 0xC4, 0x42, 0x3E, 0xB8, 0x92, 0x1B,
-    0xBF, 0xB6, 0x88, 0x6B, 0x73, 0x28, 0x15, 0xE2, 0x82, 0x05, 0xE5, 0xD2, 0x0A, 0xB2, 0x48, 0x16,
-    0x5A, 0x51, 0x37, 0xFB, 0xDA, 0x1E, 0x39, 0x30, 0x55, 0x25, 0x90, 0x40, 0xA8, 0x53, 0xA8, 0x90,
-    0x9A, 0x54, 0xD5, 0x20, 0x46, 0xB0, 0x4D, 0xD6, 0xFB, 0xF8, 0x7D, 0xEF, 0xCD, 0xFE, 0x49, 0x1A,
-    0xDA, 0xA4, 0xED, 0x26, 0xEB, 0x1D, 0x8F, 0xE7, 0xBD, 0xDF, 0xF7, 0xF7, 0xF7, 0x7D, 0xDF, 0x5B,
-    0x22, 0x7E, 0x75, 0xFB, 0x44, 0x8F, 0xD0, 0xF8, 0x55, 0xC7, 0x3B, 0xE5, 0xFB, 0x44, 0xC1, 0x35,
-    0x22, 0xF1, 0x07, 0xA2, 0xF8, 0x21, 0x45, 0x8B, 0x91, 0xA2, 0x66, 0xA4, 0xA9, 0x13, 0xE9, 0xA0,
-    0x88, 0x8C, 0xB0, 0xD6, 0xC4, 0x78, 0xD7, 0x55, 0x64, 0x36, 0x28, 0xCA, 0x88, 0x4E, 0x51, 0xF7,
-    0x88, 0xD7, 0x27, 0x9A, 0x6C, 0x2F, 0xCC, 0x3B, 0x91, 0xDA, 0xAE, 0x51, 0x7B, 0x96, 0x8A, 0xF9,
-    0xB0, 0xA8, 0x5F, 0xCE, 0xA5, 0xCD, 0xA3, 0x0F, 0x33, 0x0F, 0xB1, 0x35, 0x4B, 0xB4, 0x51, 0x02,
-    0x4A, 0xD3, 0x4D, 0xAF, 0x4F, 0x09, 0xBD, 0x74, 0x8C, 0xD6, 0xE6, 0x29, 0x2D, 0x68, 0x5A, 0xDD,
-    0x81, 0x00, 0x00, 0x11, 0x85, 0xC3, 0x58, 0x6C, 0x3B, 0x88, 0x83, 0x03, 0x46, 0x10, 0x66, 0x87,
-    0x01, 0xEA, 0xB4, 0xCB, 0xFB, 0x77, 0x6D, 0x1F, 0xDB, 0xBF, 0x91, 0xD3, 0x53, 0x44, 0x33, 0x44,
-    0x21, 0x36, 0x5E, 0xC5, 0x47, 0x3E, 0x94, 0xF4, 0x0A, 0x49, 0xAB, 0x3B, 0x0D, 0x40, 0xAC, 0x87,
-    0xC6, 0xC8, 0x88, 0x0E, 0x81, 0x90, 0x5A, 0xBD, 0xF7, 0x6B, 0x0A, 0x35, 0x41, 0xBD, 0xC5, 0xB1,
-    0x56, 0x6B, 0x6E, 0x8B, 0xC0, 0xD0, 0x2D, 0xAF, 0x0B, 0x19, 0x5B, 0x2C, 0x55, 0x24, 0x35, 0x09,
-    0xEC, 0xBC, 0x4B, 0x24, 0x15, 0x05, 0x90, 0x2D, 0xF1, 0x22, 0xA6, 0xB8, 0x6F, 0xAF, 0x99, 0xC4,
-    0xF6, 0xC8, 0x5A, 0x15, 0xD9, 0x0A, 0xDD, 0xD0, 0x3A, 0xC5, 0x44, 0xCA, 0xFF, 0xD6, 0xA5, 0x8B,
-    0xE7, 0x25, 0x05, 0x19, 0x35, 0x49, 0x68, 0xFC, 0x45, 0x64, 0x94, 0xF6, 0xA8, 0xEB, 0xD1, 0x96,
-    0xF1, 0xEE, 0x11, 0xCD, 0x9D, 0xBE, 0x09, 0x78, 0xFA, 0x88, 0x42, 0x5B, 0x32, 0x32, 0xC3, 0x6E,
-    0x90, 0xC3, 0x04, 0x34, 0x4B, 0x10, 0xF2, 0xA5, 0x71, 0xD8, 0x64, 0xAF, 0x17, 0xA1, 0xB5, 0x5A,
-    0xD8, 0x23, 0x1A, 0x81, 0xE3, 0xB5, 0x4E, 0xE1, 0xFB, 0x74, 0xFA, 0x38, 0xAE, 0xC2, 0x3E, 0xC0,
-    0x85, 0xA1, 0x05, 0xA2, 0x82, 0xD1, 0x6B, 0x44, 0x2D, 0x2C, 0xCB, 0x87, 0xF0, 0x27, 0x88, 0xC5,
-    0xE1, 0x7B, 0x74, 0xAB, 0x00, 0xB1, 0xCD, 0x44, 0xE9, 0x84, 0x03, 0x7E, 0x84, 0xC7, 0x4B, 0xE7,
-    0x19, 0x86, 0x47, 0x04, 0x08, 0xDC, 0x4F, 0x07, 0x87, 0x8C, 0x2E, 0x21, 0xE9, 0xDE, 0xC0, 0xAF,
-    0x8B, 0xE1, 0xA5, 0x60, 0xDF, 0x5D, 0x26, 0xE6, 0xE2, 0xF9, 0x26, 0x80, 0x25, 0xE3, 0xE6, 0x80,
-    0x90, 0x83, 0x21, 0x2A, 0x5C, 0x75, 0x96, 0x82, 0xF7, 0x89, 0x8D, 0xF4, 0xB9, 0x98, 0x3C, 0x50,
-    0x9B, 0xB5, 0x6D, 0xD8, 0x37, 0xA0, 0x3B, 0x30, 0x39, 0xAB, 0x0D, 0x77, 0xD7, 0xA0, 0xF7, 0xC2,
-    0x4D, 0xD8, 0x89, 0x45, 0x5C, 0x5A, 0x23, 0x4C, 0x5D, 0x2F, 0x40, 0xD5, 0x36, 0xB5, 0x60, 0xB9,
-    0x72, 0x11, 0xAB, 0x0F, 0x48, 0xE2, 0xF2, 0x50, 0x52, 0x9C, 0x5F, 0x7C, 0xD9, 0x42, 0xE9, 0x52,
-    0x5A, 0x4B, 0xA9, 0x65, 0x0F, 0x0B, 0xFC, 0x88, 0x60, 0xEB, 0x78, 0x1E, 0x6E, 0x5C, 0x21, 0x9A,
-    0x5F, 0xA7, 0x0B, 0x2B, 0x27, 0x43, 0xDB, 0xA1, 0xF8, 0x81, 0x92, 0x16, 0x20, 0xFA, 0x4A, 0x90,
-    0xD3, 0x7A, 0x98, 0xD1, 0x3A, 0xAC, 0x98, 0x42, 0x88, 0xD4, 0x1A, 0x8A, 0xFF, 0x3B, 0xCE, 0xAC,
-    0x10, 0xBA, 0x48, 0xDB, 0xA7, 0x66, 0xD8, 0x0B, 0xF2, 0xA0, 0x80, 0x0D, 0xB3, 0x26, 0xC9, 0x6F,
-    0x5D, 0xD7, 0x2D, 0x3B, 0xA0, 0xA2, 0x49, 0xB1, 0x29, 0xE8, 0x4A, 0x74, 0xB5, 0x5B, 0x24, 0xD0,
-    0xD8, 0xDA, 0x42, 0xE0, 0xF9, 0x0A, 0x18, 0x98, 0x5F, 0xB9, 0xAE, 0x08, 0xFE, 0xC7, 0x65, 0x70,
-    0xD8, 0xA6, 0xE4, 0x86, 0x0E, 0xB3, 0x57, 0x1D, 0x6C, 0x3B, 0xD2, 0x42, 0x9F, 0xA3, 0x1A, 0x2E,
-    0x19, 0x15, 0x02, 0x53, 0x77, 0x67, 0xAC, 0x2D, 0x5C, 0x36, 0xB5, 0x39, 0xFC, 0x45, 0x00, 0xBE,
-    0x3B, 0x50, 0x92, 0x38, 0x4E, 0x38, 0x35, 0x20, 0x2E, 0xFC, 0x8B, 0xA8, 0xCA, 0xA8, 0x03, 0x17,
-    0xF8, 0xFB, 0x09, 0x63, 0xB3, 0xDE, 0xB8, 0x1E, 0xB1, 0x49, 0xE5, 0x37, 0x15, 0x66, 0x59, 0x4C,
-    0xE7, 0x17, 0x9F, 0x28, 0x92, 0xC1, 0xA5, 0x35, 0x8E, 0x41, 0xDA, 0xB8, 0x5F, 0x25, 0x70, 0x11,
-    0x42, 0x83, 0xFD, 0xB2, 0x3A, 0x47, 0xE2, 0x9A, 0x26, 0x99, 0x4D, 0x58, 0xFC, 0xEE, 0x61, 0x97,
-    0x8E, 0xD3, 0xF6, 0x04, 0x93, 0xDC, 0x09, 0x38, 0xDD, 0xE3, 0x83, 0xFC, 0xA9, 0x49, 0x5F, 0xA7,
-    0xCC, 0x50, 0xEF, 0xF2, 0xEE, 0x00, 0x81, 0x7F, 0xE8, 0x1C, 0x4B, 0x93, 0xD3, 0x1E, 0x02, 0x5F,
-    0x53, 0x75, 0x3F, 0xF4, 0xA8, 0x0C, 0x4E, 0xA1, 0xE1, 0x3B, 0x8F, 0x8F, 0x33, 0xA4, 0xA4, 0x83,
-    0x35, 0x60, 0x3E, 0x79, 0xF9, 0x75, 0xFB, 0xDE, 0x9C, 0x83, 0xFC, 0x70, 0x0A, 0x49, 0x1B, 0x58,
-    0xFD, 0xA9, 0x34, 0x9B, 0xF5, 0x1C, 0x56, 0x1F, 0xA9, 0x14, 0x3F, 0xA8, 0xDA, 0xD3, 0xD1, 0xCF,
-    0xFA, 0xD0, 0x28, 0xE3, 0x28, 0x96, 0x97, 0x36, 0xA1, 0x50, 0xBD, 0x47, 0xA7, 0x29, 0x70, 0x04,
-    0xD6, 0x18, 0x6B, 0x73, 0xBB, 0x74, 0xBA, 0x7B, 0xDB, 0x9E, 0x3F, 0x4B, 0xAF, 0x10, 0xE5, 0x93,
-    0x9B, 0x9C, 0xC9, 0x60, 0xD9, 0x95, 0xE0, 0xE9, 0x7F, 0x76, 0x63, 0xFB, 0xE2, 0x1A, 0xFF, 0x51,
-    0xBC, 0x7B, 0x0A, 0xCC, 0xE0, 0xEC, 0x0A, 0x32, 0xA1, 0x8B, 0x00, 0x9A, 0xF6, 0xCF, 0x3E, 0xA6,
-    0xA8, 0x6B, 0x8D, 0x7C, 0x37, 0xA0, 0x43, 0x72, 0xF5, 0x06, 0x19, 0xCB, 0xA4, 0xC1, 0xDC, 0x51,
-    0xA7, 0xBD, 0xBC, 0x43, 0xDF, 0x79, 0xA3, 0xA0, 0x35, 0x99, 0x47, 0x59, 0xE2, 0x20, 0xFB, 0x94,
-    0x0C, 0x94, 0xE7, 0x5D, 0x54, 0xB8, 0xEC, 0x52, 0x85, 0x19, 0xBF, 0xA5, 0xEA, 0x5D, 0x53, 0x13,
-    0x45, 0x44, 0x3D, 0xA1, 0x5B, 0x64, 0x24, 0xAD, 0x4A, 0x2D, 0x2F, 0x67, 0x02, 0x42, 0x26, 0x1D,
-    0x66, 0xAB, 0x93, 0x7B, 0x54, 0xB7, 0xD0, 0x84, 0xE8, 0x18, 0xAF, 0xC0, 0x26, 0x02, 0xA4, 0x2B,
-    0x7F, 0x43, 0x93, 0xE1, 0x35, 0xF5, 0x3C, 0x38, 0xAC, 0x4F, 0x03, 0x75, 0x32, 0x36, 0xCE, 0xFB,
-    0xE1, 0x98, 0x44, 0x51, 0xA5, 0x06, 0xB1, 0x9E, 0xEA, 0xA7, 0xC8, 0xA2, 0x01, 0x3D, 0x15, 0xBA,
-    0xAC, 0xB2, 0x26, 0x44, 0x48, 0xD0, 0xD9, 0x80, 0x96, 0x91, 0xFF, 0xBD, 0x71, 0x88, 0x25, 0xDF,
-    0x08, 0x6E, 0xF4, 0x85, 0xEE, 0x43, 0xA0, 0x1A, 0x95, 0xA8, 0x57, 0xB3, 0x22, 0x87, 0x3C, 0x12,
-    0x0B, 0x6E, 0xC0, 0x31, 0x0A, 0xE2, 0xEC, 0xF5, 0x69, 0xAF, 0xF0, 0xFC, 0xC3, 0xCB, 0xCA, 0xB1,
-    0x27, 0x9D, 0x20, 0x30, 0x33, 0x0C, 0xC3, 0x02, 0x40, 0x8E, 0x78, 0x44, 0xA6, 0x2C, 0x46, 0x83,
-    0xBE, 0xF8, 0x6F, 0x98, 0x25, 0xD5, 0xF5, 0x07, 0x20, 0x05, 0xF3, 0x8A, 0xB3, 0x4A, 0xCE, 0xB5,
-    0x2C, 0xBC, 0xF4, 0xA9, 0x24, 0x78, 0x4C, 0x71, 0xE4, 0x42, 0xF1, 0xC4, 0x3B, 0xE2, 0x70, 0x44,
-    0xA2, 0xF0, 0xC3, 0xDF, 0xF3, 0x60, 0x0F, 0x6A, 0x3F, 0xD8, 0x0B, 0x4A, 0x76, 0x03, 0x30, 0x9D,
-    0xD6, 0xD5, 0xEB, 0xD4, 0xE4, 0x0A, 0x96, 0xF7, 0x14, 0xDF, 0xED, 0xB3, 0xC0, 0x58, 0x8F, 0x34,
-    0x9A, 0xD6, 0x77, 0x2F, 0x4F, 0xDB, 0x6F, 0x21, 0xBE, 0x3E, 0xC4, 0x38, 0x46, 0x3B, 0xF0, 0xE2,
-    0x01, 0xE8, 0xB9, 0x80, 0x37, 0x0A, 0xEA, 0x20, 0x03, 0x4B, 0x91, 0x05, 0x85, 0xC8, 0xC2, 0x22,
-    0xB2, 0x36, 0x47, 0xF7, 0x80, 0xCD, 0xF0, 0x56, 0xD2, 0x24, 0x28, 0x77, 0x29, 0x3A, 0x91, 0x0D,
-    0x4A, 0x14, 0x21, 0xD3, 0xF0, 0x73, 0xCB, 0x95, 0x98, 0x15, 0x97, 0x75, 0xAB, 0x6E, 0x7F, 0x44,
-    0xED, 0x9F, 0x2E, 0x21, 0xFD, 0x44, 0xB9, 0x23, 0xCC, 0x7A, 0xA4, 0xD6, 0x24, 0x6D, 0x49, 0x6A,
-    0x2F, 0x52, 0xD1, 0x0A, 0xF2, 0x26, 0x42, 0xFF, 0x2C, 0xF2, 0x66, 0x07, 0x80, 0x15, 0x28, 0x94,
-    0xE9, 0x00, 0xA4, 0x1F, 0x5D, 0x7D, 0xA9, 0xBC, 0x05, 0x14, 0x6D, 0xCB, 0x2D, 0xA0, 0x00, 0xFA,
-    0xDA, 0x66, 0x60, 0xF7, 0x3D, 0x50, 0xF0, 0x97, 0x31, 0x50, 0xFC, 0x51, 0xA0, 0x9D, 0xD5, 0xD9,
-    0x17, 0x82, 0x67, 0x47, 0xA5, 0x66, 0x97, 0xF9, 0xA4, 0x44, 0xBA, 0x01, 0xB1, 0xC1, 0x06, 0x6C,
-    0x72, 0x42, 0x74, 0xB8, 0xBE, 0x95, 0x70, 0x07, 0x4A, 0x1A, 0xAA, 0x69, 0xF8, 0x4C, 0xF8, 0x53,
-    0xF3, 0x7A, 0xB6, 0xC4, 0x0B, 0x96, 0x00, 0x07, 0xAA, 0xE4, 0xB4, 0x40, 0xD9, 0xF0, 0x05, 0x94,
-    0x77, 0xDB, 0x44, 0xDA, 0x0D, 0x37, 0xC5, 0x5E, 0xD8, 0xB5, 0xC5, 0x19, 0x8C, 0xCD, 0x1A, 0xEC,
-    0x1D, 0x3C, 0x83, 0x80, 0xEA, 0x70, 0xD1, 0x84, 0xE7, 0x76, 0x79, 0x63, 0xEE, 0x12, 0x98, 0xD4,
-    0x1E, 0xF1, 0x39, 0xD2, 0xC6, 0x6E, 0xB3, 0x14, 0xF9, 0x72, 0xCC, 0xD5, 0x92, 0x29, 0xA0, 0x85,
-    0xCF, 0x5D, 0x2C, 0x2B, 0xA9, 0x08, 0x8A, 0x30, 0x17, 0x99, 0x30, 0x91, 0x89, 0x8D, 0xD4, 0x75,
-    0x95, 0xA8, 0xB3, 0x74, 0x9E, 0x93, 0x85, 0xDB, 0x84, 0x46, 0xD5, 0x23, 0x9C, 0xC4, 0x36, 0x39,
-    0x99, 0xC0, 0x84, 0x28, 0x2E, 0x11, 0xD8, 0x45, 0xC2, 0xAE, 0xAB, 0x9E, 0x8B, 0x62, 0x1A, 0x15,
-    0x7F, 0xCE, 0x7A, 0xC4, 0x6F, 0x89, 0xDD, 0xEB, 0x10, 0x15, 0x6A, 0xB3, 0xA3, 0x1B, 0xD0, 0x9A,
-    0xBD, 0x8C, 0x60, 0x48, 0x9D, 0x03, 0x85, 0x5E, 0x8B, 0x68, 0xBF, 0x16, 0x64, 0x4D, 0x88, 0xBF,
-    0x2B, 0xB2, 0x58, 0x37, 0xA9, 0x04, 0x3A, 0xF5, 0x82, 0x42, 0x52, 0x83, 0xE3, 0xA1, 0x41, 0x4D,
-    0x91, 0x45, 0xA6, 0x09, 0x77, 0x69, 0xA9, 0x4B, 0x2A, 0x25, 0xD5, 0x71, 0xBF, 0x38, 0x47, 0x29,
-    0xD6, 0x04, 0x3D, 0x28, 0x08, 0x5A, 0xCB, 0x28, 0x62, 0xDE, 0x3A, 0x4B, 0x6C, 0x82, 0x45, 0xE0,
-    0xB2, 0xB4, 0x5F, 0xA6, 0x8A, 0x1C, 0xC0, 0xDD, 0x5B, 0xD0, 0xBA, 0x8D, 0x8A, 0x99, 0x47, 0x30,
-    0xEC, 0x0C, 0xEE, 0xD4, 0x60, 0x87, 0x05, 0x64, 0x3F, 0xDC, 0x01, 0x21, 0x99, 0xCA, 0x10, 0x5A,
-    0xB8, 0xA2, 0x19, 0x4E, 0xCD, 0x6C, 0xD4, 0x49, 0xB9, 0x8D, 0x5F, 0xF3, 0xC5, 0xFA, 0x4B, 0xE4,
-    0x7A, 0x92, 0xA6, 0xE7, 0xB4, 0xCE, 0x28, 0xAB, 0x1A, 0xBE, 0xC0, 0x54, 0xF7, 0x0F, 0x7C, 0x4D,
-    0x29, 0x5C, 0x5B, 0x85, 0x5C, 0x07, 0x93, 0x08, 0xD0, 0xE5, 0xC6, 0x90, 0x4D, 0xD0, 0x2B, 0xD3,
-    0x07, 0x90, 0xD5, 0xB7, 0x7C, 0x40, 0x46, 0x9F, 0xC2, 0x21, 0x06, 0x09, 0xB9, 0x13, 0x8D, 0x7C,
-    0xC2, 0xCC, 0xB9, 0x3E, 0x72, 0x78, 0xBF, 0x4D, 0xC1, 0x15, 0xDF, 0xF2, 0xF1, 0x6B, 0x11, 0xC6,
-    0xCD, 0x60, 0xDB, 0x16, 0x45, 0xCF, 0x69, 0xFA, 0x1D, 0x3C, 0xBD, 0x4B, 0x01, 0xCC, 0x90, 0xA0,
-    0x50, 0x20, 0xCF, 0x90, 0x76, 0x71, 0x57, 0xD1, 0xBF, 0xFA, 0x54, 0x97, 0x85, 0xC8, 0xBB, 0xAA,
-    0xC5, 0x77, 0xC9, 0xB7, 0x50, 0x55, 0x4F, 0xA5, 0xA9, 0xF2, 0x94, 0xE0, 0xC0, 0x80, 0xBC, 0x19,
-    0xAD, 0x2C, 0x8B, 0x3F, 0xD2, 0x7D, 0x26, 0x2A, 0xC8, 0x52, 0xAD, 0x17, 0xFC, 0x39, 0x6B, 0xA6,
-    0xE2, 0x35, 0xBF, 0x90, 0x36, 0xA9, 0xAE, 0xB0, 0xB4, 0xC9, 0x0B, 0x37, 0x49, 0xCC, 0x44, 0x2B,
-    0x33, 0xED, 0x9A, 0xA9, 0xA3, 0x51, 0xBB, 0xCF, 0xFC, 0x30, 0x7F, 0xA7, 0xE4, 0x68, 0x9D, 0x75,
-    0xC9, 0x51, 0x3D, 0x0E, 0xDF, 0x2C, 0xB2, 0x29, 0x7C, 0x58, 0xBA, 0x4F, 0xE9, 0xC2, 0x33, 0xE3,
-    0xCF, 0x8B, 0x2F, 0xBF, 0x61, 0xAD, 0xF4, 0x6D, 0xCC, 0x2C, 0x2B, 0xD8, 0xA6, 0x2A, 0xBA, 0x9C,
-    0x38, 0x35, 0x36, 0xC9, 0x0A, 0xDF, 0xDF, 0xE6, 0x9A, 0x56, 0x60, 0x2B, 0xB8, 0x30, 0x35, 0x95,
-    0x1A, 0x08, 0x7A, 0xCD, 0xF5, 0x7A, 0x18, 0xFC, 0x05, 0xEF, 0x3E, 0x4A, 0x82, 0x97, 0x0A, 0x6B,
-    0xDF, 0xB0, 0x55, 0x3F, 0x0A, 0x99, 0xEB, 0xDC, 0xC3, 0xE2, 0x41, 0x8E, 0x86, 0x93, 0x01, 0xDA,
-    0x84, 0xF5, 0xD1, 0x8F, 0x66, 0x90, 0xC7, 0xD8, 0xD6, 0x3A, 0xAF, 0x64, 0x29, 0x15, 0x52, 0x2F,
-    0xBB, 0x65, 0xF0, 0xE4, 0x8E, 0x73, 0x64, 0x31, 0x1B, 0x14, 0x2B, 0x61, 0xB6, 0x26, 0xCC, 0x12,
-    0xF6, 0x8E, 0x99, 0xDA, 0x58, 0x7E, 0x80, 0xA0, 0x62, 0xA6, 0xDC, 0x7C, 0xAE, 0xD1, 0x9B, 0x26,
-    0xAE, 0xD1, 0xFA, 0x59, 0x88, 0x1C, 0x73, 0xC0, 0xF8, 0xCF, 0x26, 0x37, 0x15, 0xF8, 0x4C, 0xD1,
-    0x78, 0xF9, 0x0D, 0x77, 0xFD, 0x86, 0x0B, 0x20, 0x8A, 0x30, 0x7F, 0x1C, 0xBB, 0xE1, 0x7F, 0xF4,
-    0xD1, 0x0D, 0x4F, 0x71, 0x7C, 0x38, 0x13, 0xBC, 0x99, 0xAD, 0xB4, 0xC4, 0x8F, 0xF5, 0x6D, 0x4D,
-    0x80, 0xC4, 0xA4, 0x61, 0xBD, 0x67, 0xDB, 0x49, 0x77, 0xB9, 0x73, 0xC0, 0xDD, 0xE4, 0x5F, 0x39,
-    0xD0, 0xE4, 0x81, 0xEB, 0xF1, 0xF8, 0x32, 0x2C, 0xF9, 0x52, 0x2A, 0xCF, 0x46, 0xE4, 0x23, 0xBA,
-    0xFA, 0x5B, 0xE4, 0xB6, 0x7B, 0xF2, 0xFA, 0x65, 0x5C, 0x3E, 0x87, 0x62, 0x49, 0xBB, 0x2C, 0x43,
-    0x64, 0xC6, 0xCF, 0x1A, 0xEF, 0x97, 0x8A, 0x77, 0xAA, 0xF0, 0x8D, 0xAB, 0xEA, 0xBF, 0xE0, 0x59,
-    0x98, 0xD3, 0x84, 0xB6, 0x8F, 0xD1, 0xD4, 0xF5, 0xE7, 0xCF, 0xBC, 0x97, 0xFB, 0x80, 0x86, 0xB4,
-    0x2E, 0x18, 0xBD, 0xC0, 0x2C, 0xEE, 0x6A, 0xF5, 0xE0, 0xB1, 0x11, 0x8B, 0x29, 0x50, 0x04, 0x93,
-    0x41, 0x07, 0xC2, 0xB4, 0x10, 0xBD, 0x60, 0x93, 0x5E, 0xAC, 0xA3, 0xB7, 0x41, 0xC8, 0xFF, 0x78,
-    0xAD, 0xA0, 0xB2, 0xEC, 0xD0, 0x6E, 0x0B, 0x7F, 0x88, 0x7F, 0x4E, 0xF2, 0xE9, 0x1B, 0x1A, 0x2E,
-    0x02, 0x53, 0x4B, 0xAC, 0x70, 0x9B, 0xCE, 0xBA, 0xE9, 0x69, 0x6B, 0x34, 0x67, 0x61, 0xBF, 0x00,
-    0xC5, 0xAC, 0xD8, 0x16, 0x66, 0x3B, 0xD2, 0xDB, 0x31, 0xDC, 0x49, 0x45, 0x3D, 0xC8, 0x1B, 0x61,
-    0xDE, 0x12, 0x3E, 0xA1, 0xA7, 0xB5, 0x30, 0x02, 0x34, 0x07, 0xCC, 0x92, 0xBA, 0xC8, 0xFD, 0x34,
-    0x6F, 0x50, 0x7D, 0x57, 0xAA, 0xF8, 0x39, 0xFC, 0xE1, 0xAD, 0xD7, 0xD1, 0x7D, 0x97, 0x25, 0x1D,
-    0x36, 0x76, 0x69, 0x23, 0xFA, 0x00, 0x21, 0x6F, 0x55, 0x6C, 0x60, 0x73, 0xC6, 0xF4, 0x5D, 0x23,
-    0x8F, 0xC0, 0xAC, 0x3F, 0x12, 0x91, 0x49, 0x39, 0xDC, 0xF7, 0xB8, 0x91, 0x35, 0x49, 0xA4, 0x8A,
-    0x05, 0xC0, 0xAE, 0x08, 0x53, 0xC8, 0xC8, 0xEC, 0x00, 0xB5, 0x74, 0x36, 0xEF, 0x73, 0x41, 0x4D,
-    0xD8, 0x85, 0x33, 0x9C, 0xBE, 0x0A, 0xB6, 0x9C, 0xDF, 0xF6, 0xCD, 0x08, 0x2D, 0x8D, 0x3B, 0x2D,
-    0xA4, 0xA3, 0x37, 0x45, 0x4A, 0xB7, 0x9A, 0x02, 0xED, 0x7F, 0x59, 0x7C, 0x9C, 0x29, 0x4E, 0x4F,
-    0xD1, 0xCC, 0x36, 0x0B, 0x14, 0xD0, 0x1D, 0x9A, 0x82, 0xFB, 0xC9, 0xDB, 0x8C, 0x7D, 0xE8, 0xE0,
-    0x7A, 0xD4, 0x5B, 0xA1, 0x7C, 0x3E, 0xCC, 0xA0, 0x48, 0x13, 0x7A, 0xC4, 0xBA, 0x23, 0x55, 0x59,
-    0xA7, 0xE2, 0x33, 0x1B, 0x90, 0xA7, 0x49, 0xCC, 0xA3, 0xCC, 0x87, 0x34, 0xA3, 0x3E, 0xC1, 0x6E,
-    0x28, 0x9B, 0x05, 0x9F, 0x00, 0x38, 0x65, 0x40, 0x27, 0xB6, 0x18, 0x8F, 0x4B, 0x68, 0x8F, 0x92,
-    0x97, 0x21, 0x42, 0x50, 0xC2, 0x88, 0x1D, 0x44, 0xE8, 0x61, 0xAC, 0x68, 0x07, 0xFA, 0xEC, 0x30,
-    0xE5, 0x30, 0x31, 0x9C, 0x43, 0xF3, 0x94, 0x52, 0x9C, 0x25, 0x57, 0xBB, 0xBA, 0x8E, 0x26, 0x87,
-    0xA7, 0xAB, 0xD0, 0x56, 0xCD, 0xD4, 0x13, 0x7D, 0xFA, 0xD5, 0xC4, 0x71, 0x4A, 0x57, 0x89, 0xAB,
-    0x30, 0x77, 0x3E, 0x4F, 0xED, 0x26, 0xE5, 0xEB, 0xF8, 0x1F, 0x9A, 0x8D, 0xCB, 0x3A, 0x19, 0x50,
-    0x0C, 0x81, 0x03, 0xBD, 0x04, 0x6E, 0x83, 0x9B, 0x31, 0xB3, 0xF1, 0x20, 0xF1, 0x79, 0x09, 0xE1,
-    0xCF, 0x58, 0x36, 0xCA, 0x5B, 0x4F, 0x58, 0x3E, 0x5E, 0x9A, 0xD0, 0xC4, 0x68, 0xE3, 0xD1, 0x4B,
-    0x6C, 0x4E, 0x4D, 0xAE, 0xB9, 0x44, 0xE1, 0xF5, 0x2B, 0xA8, 0xF8, 0x51, 0xC6, 0xB2, 0xA0, 0xF2,
-    0x24, 0xA0, 0x9A, 0x48, 0x33, 0x07, 0xB1, 0x30, 0x10, 0x8C, 0x1B, 0x93, 0x06, 0x9C, 0x96, 0x28,
-    0x96, 0x06, 0xCD, 0x0E, 0xCF, 0x83, 0x20, 0xB4, 0xC1, 0xC4, 0x14, 0x25, 0x69, 0x5D, 0x18, 0x49,
-    0xE3, 0x20, 0x72, 0x14, 0x03, 0x52, 0xBD, 0x8A, 0xEA, 0x5D, 0xC3, 0x7C, 0xD9, 0x16, 0xA8, 0x9A,
-    0x10, 0x49, 0xE8, 0x15, 0x82, 0x4C, 0x21, 0x98, 0x82, 0x85, 0x82, 0x52, 0x4F, 0xD8, 0x2C, 0xBC,
-    0xDE, 0x85, 0x7E, 0x7D, 0x14, 0x64, 0xA0, 0xA3, 0x4A, 0xC0, 0x22, 0xAE, 0x6B, 0x94, 0x1C, 0x69,
-    0xA1, 0x2D, 0x40, 0x87, 0x18, 0x3E, 0xCE, 0x71, 0x5F, 0x02, 0x59, 0x2E, 0x72, 0x2E, 0xC5, 0x19,
-    0x4F, 0x58, 0x1C, 0x11, 0x16, 0x5D, 0x28, 0x04, 0x82, 0x91, 0x02, 0xDB, 0x1D, 0xBA, 0x3A, 0x7E,
-    0xB7, 0x9E, 0x89, 0xAB, 0x6F, 0x3F, 0xA8, 0x0A, 0x69, 0x4E, 0xCF, 0xD3, 0xEF, 0xBB, 0xCF, 0x1A,
-    0x39, 0x78, 0x71, 0x9D, 0x67, 0x10, 0x0D, 0xB6, 0xDF, 0xB8, 0xCC, 0xF3, 0xD6, 0x35, 0x9B, 0xE1,
-    0xB9, 0x9E, 0xE7, 0x26, 0x9E, 0x24, 0xCC, 0x78, 0x82, 0x11, 0x18, 0xC5, 0xAE, 0x1E, 0xD2, 0x16,
-    0xD8, 0x3E, 0x34, 0x73, 0xE8, 0xB5, 0x5F, 0x28, 0x79, 0xC4, 0x03, 0xE2, 0x6E, 0xAC, 0x36, 0x82,
-    0x5C, 0x2A, 0xF8, 0x6D, 0x43, 0x14, 0x75, 0xDD, 0x8F, 0xB1, 0xA9, 0x0A, 0x35, 0x36, 0x60, 0x83,
-    0x7C, 0x35, 0xAF, 0xF7, 0xD0, 0xA9, 0x98, 0xC0, 0x77, 0x30, 0x89, 0x3F, 0x6F, 0xE9, 0x51, 0xED,
-    0x65, 0x13, 0xC1, 0x0A, 0x50, 0x3F, 0xAB, 0xD3, 0x93, 0x17, 0x14, 0x14, 0x42, 0xC7, 0x1B, 0x99,
-    0x03, 0x01, 0x3B, 0x97, 0xB1, 0xDE, 0x15, 0x79, 0x1A, 0xF4, 0xA4, 0xB9, 0x32, 0x69, 0x40, 0xC3,
-    0x45, 0x88, 0xBB, 0x81, 0xDE, 0x70, 0x7C, 0x14, 0x3F, 0xC0, 0x34, 0x04, 0xBB, 0x30, 0xA9, 0xBB,
-    0x86, 0x30, 0x76, 0xB6, 0x1A, 0x8F, 0x96, 0x1A, 0xBF, 0xA2, 0xDE, 0x16, 0x9E, 0x82, 0xA1, 0xD7,
-    0x33, 0x9A, 0xDB, 0x50, 0xA1, 0x3E, 0x8D, 0x62, 0x53, 0x81, 0xFA, 0xA5, 0x92, 0x2A, 0xF8, 0xBF,
-    0x8A, 0x11, 0xED, 0xFB, 0xAE, 0x63, 0x8D, 0xC6, 0x5C, 0x0A, 0xC1, 0x2D, 0xBC, 0x03, 0x39, 0x2E,
-    0xB9, 0x61, 0x85, 0x9B, 0x10, 0x66, 0xBE, 0xB4, 0x74, 0x43, 0x24, 0x4D, 0x0F, 0x7C, 0x32, 0xC7,
-    0xC5, 0x89, 0xFB, 0xBB, 0xA6, 0x6B, 0x8F, 0xF8, 0xBC, 0xEF, 0xCC, 0x68, 0x90, 0x70, 0x35, 0x70,
-    0x6B, 0x22, 0x5B, 0xD0, 0x40, 0x87, 0x9A, 0x6F, 0xA2, 0xB5, 0x3A, 0x03, 0x63, 0x9B, 0x7B, 0x2E,
-    0x84, 0xB6, 0x17, 0xD9, 0x2A, 0xFA, 0xB9, 0xA0, 0x2C, 0x82, 0x98, 0x56, 0x97, 0xAB, 0x90, 0x46,
-    0x0B, 0x83, 0x38, 0x60, 0xF0, 0x56, 0x55, 0x36, 0x78, 0x7C, 0x67, 0x74, 0xC9, 0x6B, 0x2E, 0xE4,
-    0x0C, 0xCD, 0xEF, 0x70, 0xF3, 0x42, 0xC1, 0x8D, 0x3B, 0xCF, 0x32, 0x23, 0xFC, 0x19, 0x3E, 0xB4,
-    0xC2, 0xB8, 0x71, 0xCC, 0xC5, 0x72, 0x57, 0xD7, 0x1E, 0x81, 0x8E, 0xA8, 0x48, 0x51, 0x49, 0xD3,
-    0x70, 0x43, 0x31, 0xFD, 0x6D, 0xD3, 0x1D, 0x04, 0xEE, 0xEC, 0x08, 0x48, 0x89, 0x35, 0xC1, 0x87,
-    0xBE, 0x42, 0x02, 0x28, 0x60, 0x6D, 0xAD, 0x72, 0xA7, 0x01, 0x0E, 0x27, 0x31, 0x7C, 0xA0, 0xF4,
-    0xFC, 0x99, 0x3E, 0xC3, 0x20, 0xC8, 0x03, 0x4C, 0xD5, 0x2E, 0x49, 0x80, 0x42, 0xC7, 0x7D, 0xEB,
-    0x47, 0x49, 0x2E, 0x7E, 0xC2, 0xE5, 0x08, 0x8D, 0xDA, 0x91, 0xEB, 0xD5, 0x9A, 0xC1, 0x0B, 0x45,
-    0x62, 0xF5, 0x5E, 0x8F, 0x1F, 0xF9, 0x2E, 0x53, 0xBD, 0xAC, 0x6C, 0x2B, 0x1E, 0xC0, 0xE6, 0xED,
-    0x8F, 0x1C, 0x7E, 0x25, 0x7D, 0xA7, 0xF2, 0x45, 0xE5, 0x36, 0xAC, 0x55, 0x1A, 0x73, 0xCF, 0xCF,
-    0x7D, 0xD2, 0x99, 0x9E, 0x57, 0x38, 0x31, 0xF7, 0x4E, 0xBB, 0x03, 0x28, 0xD6, 0xF7, 0xC2, 0x90,
-    0x4D, 0xF4, 0x66, 0xF8, 0x37, 0x3F, 0x25, 0x7C, 0xA2, 0xBD, 0x13, 0xEE, 0x8E, 0xB0, 0x63, 0x75,
-    0x20, 0xD0, 0xF4, 0x85, 0xCC, 0xF7, 0xB2, 0x54, 0xF8, 0xC3, 0xD7, 0xDC, 0x59, 0x3D, 0xF2, 0x73,
-    0x79, 0x00, 0x73, 0x87, 0x95, 0x96, 0xAC, 0x5F, 0x1E, 0x66, 0xC9, 0x60, 0xD8, 0xFB, 0x2F, 0x80,
-    0x55, 0xD2, 0x3C, 0xCD, 0x4F, 0x20, 0xF1, 0xEA, 0x4E, 0x3F, 0x3E, 0x0D, 0x60, 0x4E, 0xDB, 0x1F,
-    0x9F, 0xAA, 0xDD, 0x25, 0x20, 0x83, 0xCC, 0xD1, 0x6F, 0x4D, 0xED, 0x54, 0x98, 0x81, 0x63, 0x5C,
-    0x17, 0x28, 0xF9, 0xD1, 0x05, 0x1E, 0x89, 0xD3, 0x1C, 0xCD, 0xF4, 0x47, 0xF7, 0xC4, 0xDA, 0x99,
-    0x81, 0xE6, 0x80, 0xA5, 0x62, 0xD4, 0xE8, 0x4E, 0xEE, 0xC9, 0xD3, 0x89, 0x0E, 0xB3, 0xD8, 0xEA,
-    0xF5, 0xB0, 0xFB, 0x0B, 0x8B, 0xE1, 0x15, 0x5D, 0x4A, 0x0F, 0xDB, 0x49, 0x26, 0x8F, 0x7D, 0x4D,
-    0x27, 0x1E, 0x46, 0xF8, 0x95, 0x13, 0x05, 0x54, 0x31, 0x8F, 0xF5, 0x78, 0x2C, 0x09, 0x8B, 0x3A,
-    0x2E, 0x0F, 0xA9, 0x25, 0x72, 0x9E, 0x4B, 0x90, 0xE8, 0xD4, 0xE2, 0xD6, 0x25, 0xD6, 0xB1, 0x4E,
-    0xD5, 0xAB, 0xE4, 0x4F, 0x0F, 0xD4, 0x68, 0x8E, 0xDE, 0x59, 0x15, 0xF7, 0xEA, 0xE3, 0xCD, 0x6A,
-    0x84, 0x08, 0x4D, 0x2E, 0x85, 0x5A, 0x9F, 0x0F, 0xB2, 0x76, 0x8C, 0x9A, 0x2A, 0x43, 0x3E, 0x86,
-    0xB6, 0x47, 0xC1, 0x51, 0xD5, 0xF4, 0x72, 0x40, 0x3F, 0x3A, 0xC1, 0x17, 0x20, 0x11, 0xA4, 0x1A,
-    0xAA, 0x68, 0x84, 0x4B, 0xC8, 0xA0, 0x58, 0x06, 0x4C, 0x53, 0x90, 0x41, 0x61, 0x82, 0x0D, 0xF3,
-    0x30, 0x97, 0x59, 0xA2, 0xF8, 0xFC, 0x04, 0x01, 0x49, 0xDD, 0x0F, 0xAB, 0x95, 0xA3, 0x01, 0xB1,
-    0x46, 0x6D, 0x30, 0x79, 0x56, 0x8B, 0x68, 0x7B, 0x25, 0x44, 0x55, 0x15, 0xA6, 0x23, 0x2D, 0x40,
-    0xD5, 0xDE, 0xF7, 0xD9, 0x95, 0x9B, 0x34, 0x87, 0x6C, 0x4F, 0xCA, 0xC9, 0x7A, 0x36, 0x85, 0x7F,
-    0x87, 0xB4, 0xE1, 0xF4, 0x43, 0xC9, 0x46, 0xF9, 0x46, 0x25, 0x29, 0xA5, 0xE6, 0xC1, 0x0B, 0x63,
-    0x18, 0x93, 0x9B, 0x30, 0x0D, 0x38, 0xFB, 0x28, 0x2C, 0xF9, 0xA0, 0x44, 0x5A, 0x3E, 0x20, 0x1E,
-    0x46, 0xDF, 0x49, 0x71, 0xBF, 0x91, 0xFD, 0xD1, 0x79, 0x49, 0x1E, 0x0B, 0xDD, 0x9C, 0xA3, 0x7C,
-    0x2B, 0x7A, 0xC0, 0xAC, 0xA0, 0xF1, 0x68, 0xC6, 0xDA, 0x0E, 0x84, 0x2D, 0xA3, 0xFF, 0x18, 0x37,
-    0x43, 0xD1, 0x8F, 0x20, 0xC6, 0x12, 0x8D, 0x12, 0xC2, 0xBF, 0x18, 0xBE, 0x08, 0xCA, 0xDB, 0xC3,
-    0x47, 0x1F, 0x03, 0x0F, 0xBA, 0x7C, 0xD8, 0x71, 0x14, 0x7D, 0x32, 0x7C, 0xA8, 0x4E, 0x20, 0x96,
-    0x9A, 0xC8, 0xD4, 0xFD, 0x49, 0x6C, 0xA0, 0xF5, 0x58, 0x77, 0x77, 0x12, 0x00, 0xAB, 0xC3, 0x09,
-    0x19, 0xA3, 0xB3, 0xAF, 0xD9, 0xEC, 0x18, 0x5C, 0x89, 0xE1, 0xD9, 0xD9, 0x6C, 0xF7, 0xD4, 0x96,
-    0x23, 0x7C, 0x0C, 0x12, 0x18, 0x23, 0xD4, 0xE6, 0xD4, 0x30, 0xBD, 0x51, 0x1E, 0x72, 0x49, 0x6B,
-    0x42, 0xCF, 0xF3, 0x8C, 0x81, 0xA2, 0xD9, 0xA4, 0x02, 0x4B, 0xF9, 0xA0, 0x3C, 0x1B, 0x3A, 0x9D,
-    0xBD, 0xBC, 0x81, 0xD0, 0xBF, 0xBD, 0x97, 0x3B, 0xB7, 0xF1, 0xF2, 0x91, 0x3F, 0xF0, 0x3D, 0x3B,
-    0x6C, 0xCC, 0x6F, 0x76, 0xB3, 0xB8, 0xC9, 0xCD, 0xBB, 0x4C, 0xD7, 0xCB, 0x5C, 0x0B, 0x83, 0x7C,
-    0x34, 0xC7, 0xF2, 0xAC, 0x8C, 0xA6, 0xB9, 0xFA, 0xA2, 0x81, 0xBF, 0xFD, 0xE8, 0x20, 0x09, 0xC5,
-    0xEB, 0x78, 0xA2, 0xE1, 0x8E, 0x3C, 0x1B, 0x1C, 0xD0, 0x3D, 0x89, 0x59, 0x3C, 0xB7, 0x0F, 0xE6,
-    0xF2, 0xA1, 0x41, 0x9D, 0x5A, 0x4F, 0x1D, 0xF6, 0xE8, 0xC6, 0x3B, 0x37, 0x8C, 0xB0, 0xD1, 0x11,
-    0xC9, 0xB2, 0x5E, 0x60, 0x06, 0x4D, 0x15, 0x32, 0xAA, 0xEF, 0x3B, 0x7F, 0xD4, 0x8F, 0xB9, 0x13,
-    0x7E, 0xE2, 0x9B, 0x6A, 0x12, 0xE6, 0xC7, 0xF0, 0x2D, 0x63, 0x8A, 0xA2, 0x77, 0xD0, 0xB4, 0x4D,
-    0x38, 0x49, 0x0C, 0x2C, 0x1D, 0xA5, 0x6A, 0x83, 0x4F, 0xBC, 0x96, 0xDD, 0x17, 0x09, 0x6F, 0x56,
-    0x84, 0xBF, 0x43, 0x8D, 0x26, 0x3A, 0x5A, 0xA0, 0x8A, 0x2C, 0x91, 0xAA, 0x0E, 0x0B, 0xF7, 0x09,
-    0x5D, 0x22, 0x7A, 0x02, 0x3C, 0x2C, 0x5D, 0xBD, 0x4B, 0x69, 0xD8, 0x01, 0x72, 0x4E, 0xBF, 0xE2,
-    0x0E, 0x28, 0xFD, 0x6B, 0x85, 0x8A, 0x48, 0x6D, 0x53, 0xDE, 0xA4, 0xE6, 0x02, 0x49, 0xF4, 0x17,
-    0xD7, 0x14, 0xED, 0x61, 0x59, 0xEE, 0xBE, 0x22, 0xE8, 0x39, 0x13, 0xBD, 0x4A, 0x10, 0x39, 0xEC,
-    0x55, 0x2B, 0xCE, 0x2F, 0x53, 0xB1, 0x1B, 0x14, 0xBD, 0x91, 0xCB, 0xEF, 0x4A, 0x00, 0x0E, 0x96,
-    0xAD, 0xAA, 0x42, 0x1E, 0x9B, 0x88, 0x1B, 0xE6, 0x20, 0xF6, 0xD0, 0xD4, 0xA3, 0xFC, 0xDC, 0x9E,
-    0xFB, 0xDA, 0x89, 0x88, 0x0F, 0xBC, 0xE1, 0xAE, 0xF0, 0x68, 0x3C, 0x01, 0x45, 0x4C, 0xDF, 0xF6,
-    0xA5, 0x7D, 0x61, 0x9D, 0x3F, 0x79, 0x24, 0x9C, 0x77, 0x13, 0x51, 0x3E, 0x2E, 0xB9, 0x7B, 0x47,
-    0xF4, 0xBD, 0x57, 0xC7, 0x47, 0x39, 0x87, 0x1C, 0x95, 0xB0, 0x2F, 0xAA, 0x13, 0x7F, 0x61, 0xC0,
-    0xB3, 0xA2, 0xFF, 0x7A, 0xEB, 0xC5, 0xC9, 0x33, 0x5E, 0x2E, 0xFB, 0xA8, 0x1A, 0x5F, 0xF8, 0x26,
-    0x33, 0x35, 0xDE, 0xAC, 0x30, 0x7F, 0x37, 0x83, 0x4A, 0xE7, 0x9A, 0x33, 0x6E, 0xBC, 0xF9, 0x5D,
-    0xE7, 0x42, 0x36, 0x78, 0x09, 0x31, 0xE8, 0xB8, 0xAA, 0xEF, 0x6C, 0x0A, 0x80, 0x70, 0xFF, 0xCE,
-    0xD0, 0x79, 0x6C, 0x59, 0x3E, 0xEF, 0x69, 0xD5, 0x0F, 0x9F, 0x9F, 0xDD, 0x04, 0x4B, 0xC7, 0x69,
-    0x6E, 0x9F, 0xF5, 0x1A, 0x75, 0x9C, 0x9F, 0x20, 0x04, 0x2A, 0x60, 0xA4, 0xC0, 0xE2, 0x06, 0xB2,
-    0xF3, 0xC9, 0x98, 0x3B, 0x70, 0xCA, 0xDD, 0x91, 0x1E, 0x9E, 0xFE, 0x1F, 0x3D, 0x51, 0xBD, 0x4B,
-    0x23, 0x41, 0x1C, 0x7D, 0x33, 0x6B, 0xE2, 0x6E, 0xE2, 0x3A, 0x8B, 0x24, 0x70, 0x8A, 0xC9, 0xAE,
-    0xB2, 0xC5, 0x46, 0x84, 0x13, 0x4D, 0x91, 0x62, 0x63, 0x86, 0x58, 0x88, 0xDD, 0xEA, 0x5F, 0x10,
-    0x24, 0x8D, 0xBD, 0x85, 0xC5, 0x4A, 0x46, 0x84, 0x6B, 0xCE, 0xCA, 0xC2, 0xBF, 0x20, 0xC5, 0x91,
-    0x2A, 0x85, 0x45, 0x8A, 0x80, 0x7B, 0xD8, 0x5E, 0xB1, 0x68, 0x77, 0xD5, 0x0A, 0x82, 0xED, 0x16,
-    0x29, 0x2C, 0x82, 0xEB, 0x4C, 0xFC, 0x78, 0xC5, 0xCC, 0xEF, 0x0D, 0xBF, 0xAF, 0xF7, 0xA6, 0xC3,
-    0x90, 0xCE, 0x6B, 0x7B, 0x82, 0x6B, 0x60, 0xB1, 0xE7, 0x01, 0x15, 0xFD, 0xDF, 0x8D, 0x0D, 0x89,
-    0xD6, 0x5B, 0x59, 0x5D, 0x59, 0x16, 0xCB, 0xD3, 0xC2, 0x96, 0xB9, 0x3B, 0x62, 0xF1, 0x72, 0x33,
-    0x34, 0x0A, 0x6C, 0xEF, 0xFE, 0x21, 0xED, 0x1E, 0x78, 0x56, 0x41, 0x5F, 0x72, 0x47, 0x94, 0xEB,
-    0x0C, 0xBE, 0x8F, 0x04, 0xA8, 0xBB, 0x2C, 0x2A, 0xA2, 0x43, 0xB8, 0x64, 0x55, 0x9C, 0x95, 0x68,
-    0xCA, 0x78, 0xA8, 0x25, 0x5A, 0x32, 0x66, 0x17, 0x69, 0x0D, 0xE7, 0x92, 0x63, 0x4C, 0x05, 0x8C,
-    0x70, 0x01, 0xE8, 0x34, 0x1D, 0xB4, 0xFE, 0x94, 0x43, 0x34, 0x50, 0x9F, 0xDB, 0xEE, 0xAE, 0xB5,
-    0x01, 0xE7, 0x76, 0x19, 0xCF, 0x35, 0x17, 0xFA, 0x89, 0x85, 0x72, 0xEF, 0x0D, 0xF0, 0xFC, 0x71,
-    0x21, 0xBF, 0x7F, 0xFF, 0xF8, 0x34, 0x99, 0x8D, 0x22, 0x7C, 0x6A, 0xB7, 0xD3, 0x66, 0x5E, 0x60,
-    0x8E, 0x04, 0x3F, 0x46, 0xC8, 0x15, 0x34, 0xDC, 0x02, 0x8B, 0xE6, 0xA6, 0x6F, 0xB5, 0x5E, 0x8C,
-    0x40, 0x74, 0x9C, 0x81, 0xDA, 0x03, 0x60, 0xA8, 0x46, 0x5B, 0xEE, 0x97, 0x16, 0x92, 0x45, 0x33,
-    0x29, 0xE9, 0xB7, 0xBC, 0x8D, 0x81, 0x9D, 0x45, 0xCE, 0x12, 0x0F, 0x7E, 0x99, 0xAD, 0x04, 0x1B,
-    0xD7, 0xB9, 0xE0, 0xF7, 0x74, 0xE5, 0x68, 0xFD, 0x30, 0x00, 0xA8, 0x88, 0xAF, 0x3E, 0xB3, 0x5C,
-    0xDD, 0x91, 0x65, 0x94, 0x93, 0x88, 0x48, 0x13, 0x68, 0xFB, 0x32, 0x4E, 0x27, 0xE3, 0xDE, 0xFF,
-    0x05, 0x2E, 0x90, 0xE3, 0x77, 0x53, 0xD5, 0x13, 0x3F, 0x33, 0x12, 0x60, 0x73, 0xB5, 0xD1, 0x38,
-    0xAD, 0x0F, 0x87, 0x41, 0x50, 0xDE, 0x9F, 0x6A, 0x51, 0x43, 0xCD, 0x84, 0x0E, 0xAB, 0xE2, 0xED,
-    0xF4, 0x8F, 0x53, 0x2A, 0xC3, 0x92, 0xCA, 0x55, 0x5D, 0xB4, 0x08, 0xE4, 0x4E, 0x54, 0x8B, 0x7F,
-    0x93, 0xD0, 0x46, 0x2F, 0xA9, 0xC8, 0xE7, 0xE6, 0xAC, 0x11, 0xE8, 0xAB, 0xC1, 0xCC, 0x55, 0x43,
-    0x9B, 0xC8, 0xB8, 0x18, 0x3B, 0x7E, 0x7D, 0xE8, 0xD8, 0x6A, 0xEF, 0x92, 0x2C, 0x57, 0xD0, 0x61,
-    0xC0, 0x11, 0xE0, 0x80, 0xB4, 0xAA, 0x9B, 0x1F, 0xF4, 0x41, 0x07, 0x7D, 0xC2, 0xE1, 0x59, 0xEA,
-    0x7F, 0x3E, 0x60, 0x16, 0xB3, 0x2C, 0x93, 0x0E, 0x10, 0x31, 0xA3, 0xEF, 0xA5, 0x5A, 0x4F, 0x6C,
-    0x1C, 0xD7, 0x79, 0xFF, 0xE6, 0x3D, 0x8B, 0xCF, 0xE2, 0x70, 0x77, 0x7C, 0x90, 0x01, 0x39, 0x5E,
-    0x72, 0x7C, 0xE0, 0x81, 0x75, 0x97, 0x5C, 0x1E, 0xB6, 0xC1, 0x06, 0x1E, 0xEE, 0x8E, 0x44, 0x34,
-    0x3A, 0xA8, 0x85, 0xD9, 0x22, 0x46, 0x0F, 0x29, 0x1A, 0x05, 0xC8, 0x21, 0x68, 0xDC, 0x8A, 0x87,
-    0x0D, 0xCC, 0x22, 0x94, 0x76, 0x24, 0x36, 0xD0, 0x21, 0x68, 0xC5, 0x00, 0x75, 0x0E, 0x6D, 0x9D,
-    0x6C, 0x01, 0x1F, 0x52, 0xD9, 0x8D, 0x36, 0xC9, 0xD6, 0x60, 0x1A, 0x8A, 0xFB, 0x24, 0x1D, 0x7C,
-    0x30, 0x1A, 0x3F, 0x5B, 0x4D, 0x0D, 0x14, 0x68, 0x34, 0xB6, 0x93, 0xBA, 0x91, 0xDA, 0xF8, 0xD9,
-    0x9E, 0x34, 0x2B, 0x6B, 0xB9, 0xD3, 0xDF, 0xF7, 0x76, 0x49, 0xCB, 0x4E, 0x52, 0xDB, 0xF5, 0xD2,
-    0xBB, 0x94, 0x67, 0x67, 0xDE, 0x9F, 0xEF, 0xCF, 0xEF, 0xFB, 0xFD, 0xBE, 0x47, 0x3A, 0x40, 0xA4,
-    0x62, 0x12, 0x29, 0xB9, 0x97, 0xC8, 0x07, 0xF2, 0x87, 0x9F, 0x92, 0x09, 0x5F, 0xF3, 0x89, 0x82,
-    0x3C, 0x2D, 0x3E, 0x12, 0x97, 0x88, 0xCA, 0x44, 0xF5, 0x0B, 0x71, 0x2B, 0x4F, 0x7A, 0x79, 0x4C,
-    0x87, 0xEF, 0xA6, 0x5A, 0xE9, 0x43, 0xDC, 0x4F, 0xF7, 0x56, 0xF2, 0x9C, 0x9A, 0x44, 0x1D, 0xA2,
-    0x94, 0xBC, 0x14, 0x4F, 0xA5, 0xF2, 0xE7, 0x6B, 0x52, 0x97, 0x55, 0x5C, 0xF2, 0xA9, 0x1C, 0x50,
-    0xAD, 0x28, 0xEC, 0xBC, 0x4A, 0xDC, 0x90, 0x78, 0x7A, 0x91, 0xEF, 0xBB, 0xE3, 0xE5, 0xE5, 0x43,
-    0x81, 0x59, 0x34, 0xF1, 0x44, 0x09, 0x05, 0x31, 0x05, 0x44, 0x21, 0xD1, 0x02, 0xD1, 0x12, 0x51,
-    0x44, 0xB4, 0x8D, 0x9B, 0xFC, 0x3E, 0x55, 0x8E, 0xE9, 0x79, 0xAA, 0xCD, 0xD0, 0x24, 0xBE, 0x96,
-    0x37, 0xDA, 0x58, 0x1C, 0x59, 0xF7, 0x7D, 0x60, 0x4E, 0x6E, 0xE4, 0xB9, 0xEE, 0xE5, 0x46, 0xE5,
-    0xA3, 0x59, 0xA8, 0x67, 0xA9, 0x92, 0x6B, 0xEF, 0x16, 0xF1, 0x70, 0x54, 0xC3, 0x24, 0x19, 0x1E,
-    0xC2, 0x6A, 0x65, 0x8E, 0xB9, 0x4F, 0xE2, 0x5D, 0xD1, 0xB8, 0x8B, 0xFE, 0xEA, 0xFE, 0x81, 0x9F,
-    0xE7, 0xA6, 0x97, 0x0F, 0xBC, 0xDE, 0x30, 0x76, 0x8F, 0xAE, 0xD3, 0x16, 0x65, 0x64, 0x3D, 0x2B,
-    0x52, 0x69, 0xA4, 0x56, 0xDA, 0x4F, 0x82, 0x24, 0x88, 0x43, 0x6A, 0xE0, 0x87, 0xDA, 0x27, 0xFC,
-    0x0D, 0x5D, 0xAF, 0xEC, 0x2F, 0x5E, 0x69, 0x5E, 0x67, 0x46, 0x58, 0x3E, 0x96, 0xBC, 0x45, 0xD2,
-    0xF0, 0xEA, 0xD7, 0xD9, 0xE4, 0x41, 0x82, 0xF5, 0x7B, 0x96, 0x02, 0xCD, 0x0F, 0xBA, 0xD7, 0x68,
-    0x4B, 0xEB, 0x7C, 0x23, 0x9E, 0xC1, 0xF2, 0x85, 0xE5, 0x27, 0xF0, 0x30, 0xC6, 0xF1, 0x93, 0xF1,
-    0xC6, 0xEB, 0xBC, 0xE5, 0xB0, 0x4F, 0x8D, 0x94, 0xEA, 0x58, 0xD3, 0x81, 0x47, 0x9C, 0xE9, 0x49,
-    0x52, 0x95, 0x3C, 0x0D, 0x03, 0xB6, 0xE1, 0x8B, 0x2A, 0x8C, 0x55, 0xA2, 0x3C, 0x9D, 0xA4, 0x4E,
-    0x51, 0xC6, 0x91, 0x38, 0xA3, 0x8B, 0x94, 0xB6, 0xD5, 0xD1, 0xAC, 0x29, 0xF2, 0xFE, 0x36, 0xE5,
-    0xD9, 0xA1, 0xFD, 0x25, 0xA6, 0x5E, 0x82, 0x27, 0xDB, 0xB8, 0xBD, 0x4A, 0x93, 0xF8, 0x94, 0x8F,
-    0x7F, 0x86, 0x28, 0xCF, 0xF3, 0xA4, 0x43, 0xA6, 0x5C, 0xA3, 0x55, 0x55, 0xA0, 0x48, 0x3C, 0x4B,
-    0x45, 0xF5, 0x8A, 0x56, 0xB9, 0x4D, 0x45, 0x3E, 0xF2, 0x0E, 0xBC, 0x7A, 0x35, 0xCF, 0xFB, 0x34,
-    0x83, 0x38, 0x30, 0xCE, 0xCE, 0xF2, 0x75, 0x43, 0xBD, 0x1C, 0xFB, 0xE9, 0x90, 0xF5, 0xB1, 0xD0,
-    0x8E, 0x4C, 0x8B, 0xB4, 0xE4, 0x19, 0xA5, 0x23, 0x1A, 0x60, 0x0F, 0xA3, 0x17, 0xEE, 0xC5, 0xFA,
-    0x68, 0x75, 0xDF, 0xBD, 0xE9, 0x3A, 0xF9, 0xCB, 0x86, 0x22, 0x18, 0xE3, 0xD5, 0x94, 0xFC, 0x93,
-    0xB0, 0x81, 0x85, 0xD3, 0x71, 0x1B, 0x4C, 0xD0, 0xD0, 0xF8, 0x27, 0xF6, 0xDE, 0x8B, 0x29, 0x6A,
-    0xC1, 0x5A, 0x18, 0xFE, 0xEC, 0x2E, 0x2D, 0xC9, 0x01, 0x9E, 0xDC, 0xE4, 0x87, 0xF1, 0xDE, 0x74,
-    0xE3, 0x6C, 0xD1, 0xE7, 0xA5, 0x51, 0x69, 0x40, 0x8D, 0x78, 0x4D, 0x0E, 0x84, 0xA9, 0xD8, 0x40,
-    0xDC, 0x4C, 0xD6, 0xC3, 0x25, 0x91, 0xBE, 0x61, 0x83, 0x87, 0x8F, 0xEB, 0x28, 0xAB, 0x7B, 0xB7,
-    0xCF, 0x64, 0xC1, 0x20, 0xD0, 0x0D, 0xDD, 0xF0, 0x06, 0x02, 0xC3, 0x1F, 0x12, 0xA4, 0x44, 0x42,
-    0x08, 0x8B, 0x89, 0x78, 0xBC, 0x9E, 0x22, 0x6C, 0x87, 0x05, 0x77, 0xA6, 0x69, 0x3A, 0x20, 0xF9,
-    0x6C, 0x4C, 0x6F, 0x69, 0xAA, 0x60, 0x5D, 0x58, 0x53, 0xDF, 0xF9, 0xA6, 0xCE, 0x81, 0x21, 0x87,
-    0x44, 0x88, 0x1E, 0x2F, 0x11, 0xB1, 0xF5, 0x4C, 0x8D, 0x6F, 0xAF, 0xF9, 0x34, 0x2D, 0xB5, 0x4F,
-    0xA9, 0xD4, 0x4D, 0x4A, 0xCB, 0xD4, 0x0C, 0xA8, 0xAC, 0x6E, 0x5C, 0x14, 0xB0, 0x24, 0x6F, 0x7A,
-    0xD1, 0x05, 0xB7, 0x7B, 0xC1, 0x87, 0xD2, 0xF2, 0x28, 0x34, 0xD3, 0x21, 0xF9, 0x1C, 0x51, 0xB7,
-    0x4B, 0x33, 0x2A, 0x96, 0x7A, 0x8D, 0xB6, 0x54, 0x12, 0xD2, 0xBA, 0x74, 0xE1, 0x3A, 0x08, 0x63,
-    0x75, 0x35, 0xA5, 0x53, 0x2E, 0xD3, 0x76, 0x39, 0x01, 0xF6, 0x72, 0xC0, 0xCF, 0x93, 0x80, 0x4C,
-    0x91, 0xDA, 0xD3, 0x94, 0x2E, 0x7C, 0x5A, 0x37, 0xF2, 0xB8, 0x71, 0x6B, 0x3C, 0x36, 0xBE, 0x8A,
-    0x64, 0x9C, 0x1E, 0x54, 0x71, 0xB5, 0xAC, 0x92, 0xBC, 0x2F, 0x1F, 0xEF, 0x96, 0xA8, 0xD3, 0x91,
-    0x57, 0x7F, 0xB8, 0x13, 0xE6, 0xB6, 0xB7, 0xFB, 0xC1, 0x33, 0x0A, 0x66, 0xFF, 0xC9, 0x3A, 0x95,
-    0x64, 0x22, 0xB0, 0x1F, 0x6C, 0x4E, 0xC5, 0x16, 0xC1, 0x44, 0x45, 0xCF, 0x08, 0x53, 0xA6, 0x2D,
-    0x89, 0x69, 0x73, 0x2C, 0x14, 0x9B, 0x8F, 0x44, 0x8C, 0x9F, 0x0F, 0x02, 0x06, 0x75, 0x95, 0x2D,
-    0x90, 0xBA, 0x3C, 0xC0, 0x64, 0xD9, 0x0E, 0x3E, 0x2A, 0x95, 0x87, 0x91, 0x73, 0xCF, 0x3F, 0x0F,
-    0xE3, 0xDF, 0xBE, 0x89, 0xDC, 0x0C, 0x31, 0x29, 0x72, 0x50, 0xF3, 0x1A, 0xAD, 0x5B, 0x28, 0x7F,
-    0xE0, 0xFF, 0xBD, 0x21, 0xD2, 0x59, 0xEC, 0x0E, 0x5B, 0xB1, 0xD8, 0x6D, 0x9C, 0xB7, 0x62, 0x18,
-    0xBE, 0x8C, 0x08, 0xB9, 0x17, 0xD3, 0xC4, 0xF7, 0x04, 0x6E, 0x92, 0xD4, 0x3B, 0xC9, 0x19, 0xC1,
-    0x00, 0xA3, 0xA9, 0x38, 0xF9, 0x49, 0x0B, 0xAB, 0xF4, 0x7E, 0xBC, 0x17, 0x65, 0x22, 0xF5, 0xDA,
-    0x48, 0xD2, 0x24, 0xA2, 0x5D, 0x2F, 0x0D, 0xAC, 0x1F, 0xF7, 0x74, 0xE4, 0x7F, 0xCB, 0xB3, 0xEB,
-    0x99, 0xBF, 0xF1, 0xAC, 0x5E, 0x5A, 0xAA, 0xD0, 0x5B, 0xA6, 0xAF, 0x7E, 0xA6, 0x4C, 0xC3, 0x36,
-    0x28, 0xA7, 0x81, 0xB2, 0x3E, 0x7C, 0x26, 0x68, 0x05, 0x71, 0x8F, 0x65, 0x22, 0x54, 0xEE, 0x1B,
-    0x8F, 0x43, 0x2B, 0x41, 0x1C, 0xB8, 0x71, 0xEC, 0x78, 0x1C, 0xF5, 0xB3, 0x3B, 0xC7, 0x79, 0x33,
-    0xFD, 0xE5, 0x71, 0x66, 0x94, 0x16, 0x26, 0xE3, 0x10, 0x57, 0xE7, 0x13, 0x7A, 0x06, 0x39, 0xBF,
-    0xEE, 0x22, 0xBC, 0x82, 0xDC, 0x46, 0x24, 0xB7, 0xAC, 0x0B, 0xF0, 0x37, 0x06, 0x14, 0x06, 0x56,
-    0xA6, 0xBD, 0xD8, 0xC5, 0x77, 0x90, 0x6B, 0x75, 0x03, 0x18, 0xD3, 0x25, 0x1B, 0xD1, 0x5A, 0x40,
-    0xF3, 0x2A, 0x0E, 0x80, 0x37, 0x89, 0x15, 0x88, 0x13, 0x3B, 0x4F, 0x5B, 0x01, 0x86, 0xD7, 0x9C,
-    0xC7, 0x00, 0xAF, 0xBE, 0x9F, 0xFA, 0xE6, 0xA1, 0xE4, 0x4B, 0x74, 0x5D, 0x3E, 0xAD, 0xA2, 0x72,
-    0x1A, 0xBD, 0xF1, 0x52, 0xFC, 0xCA, 0xF5, 0xB2, 0x3A, 0x6E, 0xED, 0x7C, 0xE5, 0x5C, 0x62, 0xD7,
-    0xE7, 0xE1, 0x6E, 0xBB, 0xC0, 0x21, 0x74, 0x08, 0x3F, 0x6B, 0x70, 0x74, 0x17, 0x9E, 0xB6, 0x08,
-    0x68, 0x4B, 0x5B, 0xD8, 0x55, 0x26, 0x8D, 0x67, 0xA5, 0x11, 0x56, 0xE5, 0x79, 0xCA, 0x98, 0x17,
-    0xF0, 0x3B, 0x0E, 0x74, 0x05, 0x09, 0xDD, 0xA0, 0x30, 0xA9, 0x53, 0x05, 0x95, 0x02, 0x20, 0x58,
-    0x79, 0x2A, 0xA5, 0x81, 0x97, 0x01, 0x9A, 0xB6, 0x80, 0x4A, 0xDB, 0x7E, 0xCC, 0x8B, 0xA3, 0x35,
-    0xE0, 0x40, 0x77, 0x9E, 0x78, 0x61, 0x22, 0x6D, 0x90, 0x6F, 0x2A, 0x37, 0x7A, 0x49, 0x08, 0xE4,
-    0x0F, 0xD8, 0x71, 0xF9, 0xE6, 0x3E, 0xDC, 0xF4, 0x72, 0xBD, 0xF4, 0x08, 0x80, 0xA1, 0xA9, 0xE2,
-    0xB2, 0xD0, 0x01, 0x59, 0x99, 0xD4, 0x3C, 0x33, 0x4D, 0x1D, 0x9F, 0x22, 0xA9, 0x67, 0xBC, 0xD4,
-    0x8F, 0xBB, 0x0C, 0x16, 0x88, 0x68, 0x79, 0xA3, 0x4F, 0x4D, 0x4E, 0xA9, 0x88, 0xEF, 0x9A, 0x01,
-    0xE4, 0xE6, 0xBB, 0xD4, 0x18, 0xC6, 0x98, 0x96, 0x43, 0x14, 0x00, 0xCA, 0x28, 0x39, 0xCE, 0xA6,
-    0x3D, 0x0C, 0xA5, 0x89, 0x5D, 0xC4, 0xAE, 0x91, 0xF8, 0xA6, 0xEF, 0x92, 0x95, 0xEF, 0x1E, 0xDD,
-    0x26, 0x46, 0xB7, 0x49, 0x5C, 0x6F, 0x0C, 0xB7, 0x39, 0x31, 0x83, 0x3C, 0xA3, 0xD6, 0xF0, 0xD7,
-    0xE1, 0x99, 0x76, 0x40, 0xCC, 0x15, 0xC2, 0x8E, 0xA6, 0x49, 0x5D, 0x82, 0xF0, 0x80, 0x0E, 0x7F,
-    0x44, 0x5C, 0x13, 0x9C, 0xF0, 0x9E, 0xE9, 0x50, 0x6D, 0x8D, 0x82, 0xC8, 0xC1, 0x02, 0xD2, 0x3A,
-    0x4C, 0xF8, 0x26, 0xDC, 0xAE, 0x2C, 0xC7, 0x64, 0x30, 0xDE, 0x7D, 0x25, 0x37, 0x33, 0x81, 0x5C,
-    0x3E, 0x92, 0xCE, 0xAD, 0xCE, 0xCB, 0x63, 0xCB, 0x97, 0x6D, 0x2B, 0xDF, 0x45, 0x74, 0xC7, 0x70,
-    0x05, 0x67, 0x20, 0xCF, 0x82, 0x14, 0x04, 0xE0, 0x8F, 0x53, 0x39, 0x66, 0x9F, 0xE1, 0xBD, 0x84,
-    0x4B, 0x6A, 0x03, 0x97, 0xDF, 0xC2, 0x1B, 0xE3, 0x91, 0xC2, 0x9B, 0xE1, 0x4B, 0x20, 0x86, 0xC4,
-    0x6D, 0x83, 0x8D, 0xC1, 0xC6, 0xB6, 0x82, 0x6B, 0x2A, 0xC5, 0xF5, 0x81, 0x4B, 0x72, 0x5D, 0x10,
-    0x1A, 0xD9, 0x8B, 0x32, 0x8B, 0xE4, 0xAD, 0x06, 0x9C, 0xBB, 0x16, 0x78, 0x51, 0xF6, 0x4C, 0x24,
-    0x90, 0xBB, 0xB6, 0x07, 0x20, 0xF7, 0x1C, 0xA8, 0x78, 0x40, 0xA6, 0x57, 0x92, 0x42, 0x15, 0x28,
-    0x1F, 0x75, 0xE4, 0x5F, 0x52, 0x66, 0x2B, 0x7E, 0x6E, 0x2B, 0x5F, 0x67, 0x43, 0x44, 0x34, 0x42,
-    0x6E, 0xFF, 0xE8, 0x19, 0x1D, 0x15, 0xB1, 0xD9, 0x66, 0x4D, 0x1D, 0xD5, 0xA6, 0x1C, 0x28, 0xB2,
-    0xB5, 0xB2, 0x4C, 0x4C, 0x3A, 0xAD, 0x64, 0xDC, 0x99, 0xC3, 0x4C, 0xA6, 0x83, 0x98, 0x49, 0xB0,
-    0x27, 0xFA, 0x55, 0x0F, 0xF8, 0x8A, 0x52, 0x3C, 0x10, 0x9B, 0xB4, 0xF4, 0xAE, 0x07, 0x60, 0x04,
-    0xAE, 0xCA, 0x65, 0x72, 0x65, 0x5F, 0x60, 0x7F, 0x62, 0x9B, 0x53, 0xB8, 0x46, 0x32, 0xA6, 0x56,
-    0x16, 0x78, 0x26, 0x2D, 0x4C, 0xD3, 0x8B, 0x97, 0xB7, 0x1B, 0xF9, 0xF2, 0x5E, 0xF9, 0xF6, 0xE2,
-    0x29, 0x40, 0xB1, 0xC7, 0x35, 0x11, 0xCF, 0x65, 0x92, 0x2B, 0x63, 0x15, 0x71, 0xA7, 0xF2, 0x78,
-    0x09, 0x9B, 0x94, 0x28, 0x76, 0x66, 0xDD, 0x33, 0x85, 0x20, 0x29, 0xDF, 0xAF, 0x33, 0x99, 0x67,
-    0x15, 0x6A, 0xF4, 0x39, 0x48, 0xF8, 0xA5, 0xB1, 0xDB, 0xFF, 0x73, 0x7C, 0x70, 0x09, 0xFF, 0x6B,
-    0xC8, 0x32, 0x3F, 0x5E, 0x65, 0x6A, 0x00, 0x00, 0xBC, 0xB0, 0x45, 0x0D, 0xA6, 0x32, 0xA0, 0x30,
-    0xA1, 0xCA, 0x7C, 0xD3, 0x02, 0xD6, 0x21, 0xB4, 0xEF, 0x1F, 0xEE, 0x15, 0x0D, 0x18, 0xA9, 0x65,
-    0xE4, 0x59, 0xD3, 0x51, 0xC7, 0x01, 0x95, 0x05, 0xAA, 0x05, 0x65, 0xAA, 0x15, 0x6A, 0x54, 0x0D,
-    0x33, 0xEA, 0xCC, 0x5B, 0xEC, 0xBC, 0x2B, 0x4D, 0x75, 0xE7, 0x64, 0xB2, 0xDA, 0xCA, 0xA9, 0x7D,
-    0x7F, 0xB6, 0xC7, 0x6C, 0x0C, 0xBD, 0xFD, 0x34, 0x95, 0x3D, 0x2D, 0xE3, 0x39, 0x5A, 0x93, 0x89,
-    0xFA, 0x49, 0x17, 0x41, 0x42, 0x28, 0xB3, 0x9C, 0xAB, 0x91, 0x4C, 0x95, 0x5E, 0x42, 0x6A, 0xEB,
-    0x30, 0x1E, 0x48, 0x1B, 0xB8, 0xC5, 0xED, 0x20, 0xA1, 0x92, 0xAD, 0x05, 0x15, 0x37, 0x11, 0x7B,
-    0x1A, 0x5E, 0xD8, 0x0E, 0x2F, 0xA6, 0x0D, 0x98, 0xFD, 0x09, 0x37, 0xE4, 0xBD, 0x9B, 0xFE, 0x10,
-    0xD1, 0x8E, 0x68, 0x6A, 0x7E, 0x0E, 0x88, 0x1C, 0x98, 0x2C, 0x12, 0x2F, 0xA7, 0xFE, 0xB1, 0x38,
-    0x0A, 0x8F, 0xA5, 0x8D, 0x21, 0x55, 0x5C, 0x28, 0x36, 0x32, 0xE5, 0xE9, 0x4E, 0xA9, 0xA8, 0xE2,
-    0xDC, 0x94, 0xE4, 0x46, 0x52, 0xAB, 0xFA, 0xC7, 0x10, 0x10, 0x7D, 0xFE, 0xAE, 0x95, 0xFB, 0x1C,
-    0x89, 0x01, 0x23, 0xE9, 0x3C, 0x3B, 0x3F, 0x22, 0x7F, 0x54, 0xBB, 0xC3, 0x01, 0xCD, 0x45, 0x54,
-    0x05, 0x25, 0x40, 0x7D, 0xEB, 0x08, 0x6D, 0x55, 0x9C, 0x56, 0x9E, 0xCA, 0x1A, 0x79, 0x56, 0xA5,
-    0xCE, 0x03, 0x94, 0xD0, 0xC9, 0xD8, 0x5F, 0x8E, 0x3B, 0x13, 0xEA, 0xAF, 0x07, 0x95, 0xE1, 0xA6,
-    0xE1, 0xEA, 0x12, 0x6C, 0xAE, 0x54, 0xF2, 0x18, 0x5C, 0x85, 0x0E, 0x1D, 0xA0, 0x58, 0x5E, 0xC9,
-    0xD6, 0x68, 0xBE, 0x81, 0x0C, 0x7B, 0xEB, 0x25, 0x7C, 0x77, 0x0A, 0xFE, 0x6E, 0xF5, 0x19, 0xEF,
-    0x31, 0x38, 0xC3, 0x3D, 0x8A, 0x04, 0x85, 0xBD, 0x4B, 0xE4, 0xBF, 0xF6, 0x9A, 0x95, 0xFD, 0x61,
-    0x23, 0xF1, 0xBE, 0xE9, 0x4D, 0x20, 0x24, 0xA6, 0x10, 0xD3, 0x65, 0x9A, 0x5B, 0xB0, 0x15, 0x36,
-    0x41, 0xC9, 0xB3, 0x9D, 0x70, 0xE3, 0xCC, 0xBF, 0x17, 0x0A, 0x8B, 0xAB, 0xAF, 0x5C, 0xF9, 0x41,
-    0xB1, 0x98, 0x56, 0x5B, 0xE2, 0x8A, 0x0D, 0xDC, 0x1A, 0x6F, 0xC7, 0x60, 0x32, 0x48, 0x10, 0x5A,
-    0x2F, 0xAB, 0x34, 0x7D, 0x6C, 0x79, 0xF9, 0x77, 0x4A, 0xB5, 0xCE, 0x77, 0x37, 0x36, 0xB6, 0x0A,
-    0xA1, 0xEE, 0x6C, 0x63, 0x37, 0x9B, 0x6D, 0xF5, 0x30, 0x95, 0x2D, 0xBD, 0xCE, 0x15, 0xBD, 0x11,
-    0x03, 0x85, 0xFD, 0x3A, 0xD5, 0x2E, 0x09, 0xE3, 0x92, 0x26, 0x18, 0xD0, 0x8B, 0x49, 0xA9, 0x2A,
-    0x37, 0x68, 0xB1, 0xA3, 0x10, 0x44, 0x26, 0xE2, 0x9A, 0xED, 0x6D, 0x8A, 0x64, 0x5B, 0xD8, 0x86,
-    0xD7, 0x0F, 0xF5, 0xAE, 0xDF, 0xFD, 0xBE, 0xFC, 0x87, 0xC7, 0x2E, 0xBF, 0xB4, 0x6D, 0xBF, 0x3D,
-    0xD8, 0x8A, 0xEA, 0x4B, 0x61, 0x10, 0x1C, 0x4F, 0x60, 0xA1, 0x4D, 0x2F, 0x79, 0xA7, 0xEC, 0x27,
-    0x81, 0x30, 0xA8, 0xBE, 0x39, 0x22, 0xC5, 0x2E, 0x3C, 0xB2, 0x1D, 0xC4, 0x75, 0xA5, 0x19, 0x47,
-    0x28, 0x4C, 0xFD, 0x73, 0x67, 0x4C, 0xA9, 0xE6, 0x3D, 0x1B, 0x97, 0x57, 0x51, 0xFA, 0xBB, 0x3B,
-    0x3D, 0x94, 0xBB, 0x70, 0x4C, 0x78, 0x51, 0xA1, 0x3B, 0x72, 0x43, 0x4F, 0x17, 0xA9, 0xD3, 0x94,
-    0x57, 0x74, 0x31, 0xA0, 0xEE, 0x9A, 0xBC, 0x62, 0xB0, 0xB5, 0x43, 0x97, 0x80, 0x2D, 0x5D, 0x6A,
-    0x88, 0x04, 0xC4, 0x99, 0xD6, 0x44, 0xE2, 0xC7, 0x55, 0xEA, 0x2B, 0x0A, 0xFF, 0x23, 0x65, 0xA2,
-    0xFB, 0x89, 0x21, 0xD0, 0xC2, 0x01, 0xC8, 0x3C, 0xD1, 0x3E, 0xD5, 0x62, 0x16, 0x7B, 0xFA, 0x44,
-    0x44, 0xD3, 0xF0, 0x26, 0x9C, 0x91, 0x02, 0xBC, 0x82, 0x21, 0xF5, 0x34, 0x5B, 0xFA, 0x85, 0xC2,
-    0x5D, 0x9E, 0x81, 0x55, 0x25, 0x67, 0x02, 0x9E, 0x65, 0x8F, 0x13, 0xE3, 0x31, 0x70, 0xB9, 0x28,
-    0xB5, 0xBC, 0x6C, 0xC8, 0x5A, 0x5A, 0xE8, 0x92, 0x82, 0x61, 0x86, 0x0E, 0x37, 0x03, 0x87, 0x6A,
-    0xA8, 0x67, 0x2D, 0x43, 0x95, 0x71, 0x26, 0x22, 0x87, 0x80, 0x6A, 0xC5, 0x87, 0x95, 0x4C, 0xEC,
-    0xDC, 0xE2, 0x8C, 0xFC, 0xA4, 0x30, 0xD5, 0x4E, 0x14, 0xF8, 0x37, 0x6F, 0xA6, 0x48, 0x12, 0x57,
-    0xBF, 0x47, 0xD8, 0xC9, 0x1A, 0x63, 0xC4, 0x39, 0x05, 0x36, 0x00, 0xC0, 0xFC, 0x8E, 0xA6, 0x2F,
-    0xC5, 0x0C, 0xA7, 0x43, 0x92, 0xD7, 0x09, 0x36, 0x5C, 0x72, 0xEB, 0x9E, 0xC6, 0x77, 0x0A, 0x7B,
-    0x04, 0x5D, 0x6D, 0xCA, 0xA3, 0xBA, 0x04, 0x02, 0x5B, 0x7F, 0x2A, 0x65, 0x90, 0x2C, 0xEF, 0xE9,
-    0x82, 0xC3, 0x53, 0xB3, 0x53, 0x8B, 0x73, 0x8B, 0xD5, 0xDF, 0xB2, 0x95, 0x0E, 0xBC, 0xED, 0xE0,
-    0xB2, 0x59, 0x2A, 0xF8, 0xF2, 0xB2, 0x06, 0x24, 0x15, 0xD5, 0xF2, 0x19, 0xD3, 0xA9, 0x02, 0x6F,
-    0x18, 0x60, 0xEA, 0x17, 0xBF, 0x85, 0x82, 0xF6, 0x3E, 0xB7, 0x5C, 0x3C, 0xC7, 0xC0, 0xEF, 0x20,
-    0x38, 0xE5, 0x15, 0x34, 0x92, 0x09, 0xEC, 0x1B, 0x48, 0x9E, 0x16, 0x45, 0x62, 0x4A, 0x25, 0x79,
-    0xE5, 0x66, 0xE6, 0x08, 0x96, 0x47, 0x14, 0x37, 0xA9, 0xE0, 0x03, 0x37, 0x2D, 0x94, 0xCB, 0x2D,
-    0x79, 0xC6, 0xCC, 0x35, 0x4B, 0xE2, 0x2B, 0x42, 0xD7, 0x6C, 0xBD, 0x57, 0x94, 0xF9, 0x19, 0x37,
-    0x93, 0x60, 0x5C, 0x45, 0x49, 0xA0, 0x60, 0x57, 0xD1, 0x8B, 0x7A, 0x2E, 0x9D, 0x3E, 0xDD, 0xAB,
-    0x0C, 0xC7, 0x1E, 0x49, 0x27, 0x99, 0x9F, 0x60, 0x26, 0xB8, 0x42, 0x5C, 0xA6, 0xAD, 0xC6, 0x50,
-    0x38, 0x18, 0x91, 0x47, 0xFA, 0xDE, 0xD5, 0xB3, 0xFA, 0x3B, 0xC9, 0x62, 0x55, 0x4F, 0x4D, 0xB5,
-    0x95, 0xCA, 0xC4, 0xD9, 0x27, 0xC8, 0x5C, 0xBB, 0x6C, 0x17, 0x73, 0x7B, 0x38, 0xDC, 0x97, 0x44,
-    0xFF, 0x64, 0x0A, 0x8A, 0x4E, 0x94, 0xBD, 0x24, 0x85, 0x5E, 0x59, 0x78, 0x54, 0x00, 0x80, 0xE5,
-    0x91, 0x14, 0x61, 0x5A, 0x70, 0xCE, 0x9F, 0xDB, 0xF7, 0xFD, 0x44, 0x46, 0xDD, 0xAA, 0x4F, 0x27,
-    0xFE, 0xEC, 0xE2, 0x95, 0xFC, 0xA7, 0x05, 0xA7, 0x72, 0x6E, 0x1D, 0x10, 0x79, 0xE6, 0xE5, 0x89,
-    0xA7, 0x17, 0x27, 0x3C, 0xF6, 0xE0, 0x6F, 0x9A, 0x09, 0xA1, 0x57, 0xE5, 0x72, 0x3E, 0xC0, 0x00,
-    0x5D, 0x12, 0x3F, 0x3F, 0x0C, 0xEC, 0x51, 0xA3, 0xA5, 0xC2, 0xDE, 0x9F, 0x58, 0xF1, 0xF2, 0xF6,
-    0x58, 0xB8, 0xFD, 0xDB, 0x26, 0x9E, 0x95, 0x19, 0x84, 0x5B, 0x0D, 0xB1, 0x17, 0xD0, 0x2A, 0x2A,
-    0xCA, 0x0C, 0xD9, 0x25, 0x2F, 0x8D, 0x50, 0x8E, 0xB0, 0xBE, 0xD0, 0x85, 0x1D, 0xD8, 0xF4, 0x2A,
-    0x2F, 0x25, 0xFE, 0xF5, 0x50, 0xF2, 0xC7, 0x54, 0x2B, 0x4F, 0xD2, 0x65, 0xD0, 0xEA, 0x0C, 0xE1,
-    0xB3, 0xF4, 0x31, 0x99, 0xDB, 0xA0, 0x3F, 0xB2, 0x8D, 0x7C, 0x9C, 0x37, 0xD0, 0x21, 0x6F, 0x97,
-    0xBC, 0x1D, 0x14, 0x61, 0xEF, 0x6B, 0xB6, 0x02, 0x6C, 0xC3, 0xB7, 0xB3, 0x22, 0x75, 0x09, 0xE4,
-    0x61, 0x5D, 0xA9, 0x04, 0xB1, 0x6C, 0xCB, 0x64, 0xDA, 0x55, 0xC7, 0x40, 0x9D, 0xBB, 0xFA, 0x4A,
-    0xFB, 0x49, 0xB7, 0x66, 0x06, 0xEC, 0x02, 0x5C, 0x07, 0x13, 0xA7, 0xD0, 0x9C, 0x91, 0xF3, 0x29,
-    0x7E, 0xA1, 0xF2, 0x4F, 0xEE, 0x45, 0x6C, 0x02, 0x0F, 0x63, 0x0A, 0xFC, 0x2E, 0xF0, 0x03, 0xB8,
-    0xB5, 0xC0, 0xEC, 0x7C, 0xE4, 0x95, 0x0E, 0x9D, 0x4C, 0xA4, 0x5B, 0x0C, 0xB3, 0xB2, 0x07, 0x66,
-    0x69, 0x6A, 0x8A, 0x84, 0x24, 0x71, 0x64, 0x48, 0xBA, 0xBD, 0x79, 0xA2, 0x3A, 0x3B, 0x5B, 0xD8,
-    0x8E, 0x94, 0xC3, 0x8A, 0xBB, 0x88, 0xA6, 0x24, 0xFF, 0x37, 0x3B, 0x81, 0xEA, 0x90, 0x2D, 0x4E,
-    0x4D, 0x9D, 0x28, 0x4D, 0x6D, 0x2E, 0x6C, 0xE9, 0x46, 0xFA, 0xE1, 0xCC, 0xC7, 0x74, 0xA3, 0xCD,
-    0xF1, 0x56, 0x1D, 0x99, 0x4D, 0x2E, 0x27, 0xA5, 0x08, 0xB2, 0x43, 0x6E, 0xB3, 0x0A, 0x1D, 0x70,
-    0x06, 0x96, 0xFB, 0xF4, 0x4A, 0xE6, 0x2F, 0x23, 0x95, 0xEE, 0x76, 0x5E, 0x2E, 0x8F, 0xF6, 0xF2,
-    0xEB, 0xA1, 0xF0, 0x6E, 0x0F, 0x01, 0xA5, 0x39, 0xD7, 0xF7, 0x85, 0x0D, 0x57, 0x36, 0x58, 0x14,
-    0x54, 0xAB, 0x16, 0xC0, 0x68, 0xB1, 0xBC, 0xAA, 0x11, 0x4C, 0x14, 0x5A, 0x47, 0x88, 0x06, 0x8E,
-    0x2B, 0x31, 0x25, 0x07, 0x26, 0xC6, 0x28, 0x33, 0xA3, 0x5C, 0xA5, 0x95, 0xD5, 0xC2, 0x24, 0x69,
-    0x53, 0x9A, 0x82, 0x84, 0xAC, 0xCE, 0xA1, 0x72, 0xB7, 0x1B, 0xBB, 0x34, 0x0B, 0xB1, 0x49, 0xF7,
-    0xC0, 0x64, 0x32, 0xEF, 0x57, 0x6E, 0xC0, 0x88, 0xF0, 0x73, 0x9E, 0x06, 0x02, 0xC8, 0x56, 0x16,
-    0x1B, 0x6F, 0xA3, 0x24, 0x78, 0x2E, 0xE7, 0x44, 0xE2, 0xDC, 0x80, 0x3A, 0x44, 0xF2, 0x5F, 0xBC,
-    0x61, 0x67, 0x6B, 0x32, 0x12, 0xE7, 0x27, 0xAE, 0xE5, 0x36, 0x77, 0x15, 0x10, 0x02, 0x22, 0x0E,
-    0x6F, 0x5C, 0xD4, 0xD2, 0x22, 0x2C, 0x4E, 0xE1, 0xED, 0x7F, 0x05, 0x4E, 0xC2, 0xEC, 0x1E, 0xBE,
-    0x17, 0xD7, 0xBE, 0x82, 0xFC, 0x30, 0x06, 0xE4, 0xAA, 0x0A, 0xAA, 0x51, 0xA0, 0xEE, 0x8C, 0x4C,
-    0x46, 0x18, 0x19, 0x05, 0xF4, 0x45, 0x83, 0x10, 0xF9, 0x8D, 0x7F, 0xF6, 0x9E, 0x3D, 0x3C, 0x35,
-    0x77, 0xA2, 0xFD, 0x82, 0x0B, 0xBD, 0x4A, 0x12, 0x89, 0xD7, 0x12, 0x13, 0x00, 0xE0, 0x9F, 0xE9,
-    0x65, 0x20, 0x9A, 0xB1, 0x32, 0x21, 0x10, 0x06, 0x36, 0xA6, 0x0C, 0x2B, 0x80, 0xAA, 0x0B, 0xA1,
-    0xB7, 0xBB, 0xCA, 0xF8, 0x3A, 0x00, 0x4B, 0x01, 0x70, 0x51, 0x65, 0xE4, 0x6B, 0x2F, 0x2B, 0xA9,
-    0xDF, 0xAD, 0x05, 0xBD, 0x54, 0xDE, 0x00, 0xDA, 0x22, 0x9B, 0x3A, 0xA0, 0x9C, 0x35, 0x94, 0x6D,
-    0xA1, 0xEB, 0x17, 0x13, 0xE4, 0xAE, 0x9F, 0xED, 0x1B, 0xF1, 0x63, 0x09, 0x97, 0xAC, 0xDF, 0xE6,
-    0xDA, 0xB5, 0x06, 0x8E, 0x87, 0x11, 0x41, 0xEB, 0x35, 0x22, 0x2C, 0xE4, 0x68, 0x8B, 0x98, 0x75,
-    0x5A, 0x66, 0x7F, 0x06, 0xD8, 0x16, 0xB0, 0xCB, 0xEA, 0x21, 0x5C, 0xD0, 0xEF, 0x8F, 0x85, 0x4D,
-    0xC0, 0xD9, 0xD5, 0x60, 0x2E, 0x92, 0xEF, 0x79, 0x46, 0xFC, 0x88, 0xE6, 0xE1, 0x98, 0x4E, 0x51,
-    0xE8, 0x8E, 0x0F, 0xC6, 0x16, 0xD1, 0x33, 0x06, 0x85, 0x09, 0xE4, 0x11, 0x44, 0x12, 0x11, 0x7D,
-    0x2D, 0x87, 0xC3, 0x37, 0xD9, 0x1B, 0x00, 0x96, 0x10, 0xF4, 0xFC, 0x91, 0x15, 0xC6, 0x4A, 0x84,
-    0xD9, 0x9A, 0x23, 0xA4, 0x81, 0xE3, 0xA4, 0x8C, 0xB0, 0x99, 0x23, 0xAE, 0xFB, 0xED, 0x07, 0xD0,
-    0x46, 0x2F, 0x1F, 0xF8, 0xEE, 0xA2, 0x65, 0xA9, 0xC7, 0x04, 0x9D, 0x13, 0xB1, 0xF2, 0x6E, 0x11,
-    0x18, 0xE6, 0x59, 0x78, 0xA3, 0xFD, 0xCB, 0x22, 0x50, 0xE5, 0xCE, 0x83, 0xBD, 0xAC, 0x04, 0x0F,
-    0xCB, 0x04, 0x05, 0x83, 0x2E, 0x5C, 0x00, 0x69, 0x1E, 0x00, 0xDF, 0x38, 0x06, 0xD9, 0x21, 0x4D,
-    0xA7, 0x39, 0x69, 0xF7, 0x8F, 0xB0, 0x8C, 0x0E, 0xC4, 0x3E, 0xAE, 0x77, 0x98, 0x80, 0xAD, 0xF9,
-    0xDA, 0x3F, 0xCA, 0x99, 0xA0, 0x06, 0x07, 0x69, 0x8A, 0x66, 0xDA, 0xE5, 0xD9, 0xEA, 0xEC, 0xE2,
-    0xE2, 0x67, 0x0D, 0x2D, 0xF9, 0x16, 0x62, 0xC2, 0xB7, 0x5B, 0x14, 0xF8, 0x2F, 0x00, 0x1E, 0xCE,
-    0x3F, 0xAB, 0x49, 0xB1, 0x06, 0x94, 0xD7, 0x77, 0x98, 0xD3, 0xF6, 0xC7, 0x74, 0xC0, 0xE3, 0x4E,
-    0x83, 0xE2, 0x50, 0xA9, 0xA0, 0xC4, 0x51, 0x6F, 0x07, 0x80, 0x39, 0x18, 0xF6, 0x62, 0x3F, 0xDB,
-    0x85, 0x80, 0x7F, 0x71, 0xB7, 0xF2, 0x53, 0xDE, 0xE3, 0xD4, 0xB8, 0x6D, 0xC4, 0x5E, 0x3C, 0xBB,
-    0x99, 0x4C, 0x2F, 0xD5, 0xE8, 0xAD, 0x1F, 0x90, 0xFA, 0x92, 0x66, 0x23, 0xCB, 0x5D, 0xD7, 0xEB,
-    0x01, 0x3F, 0x0A, 0x2E, 0xAE, 0xCB, 0x57, 0x5F, 0x65, 0x2F, 0x26, 0x9C, 0xBA, 0xF7, 0xC6, 0x70,
-    0xC6, 0x5D, 0xB0, 0x08, 0x72, 0xBE, 0xEB, 0x7D, 0x3A, 0x09, 0x32, 0xC7, 0xEE, 0x0C, 0xF9, 0xCB,
-    0x47, 0xB6, 0xA1, 0xBC, 0x10, 0x17, 0xCA, 0x81, 0xE9, 0x7B, 0x29, 0x48, 0x23, 0xB9, 0x07, 0xB2,
-    0x73, 0x82, 0x85, 0xC1, 0xBC, 0x42, 0x99, 0xB4, 0xAC, 0xEA, 0x7C, 0xA8, 0xD8, 0x37, 0xC1, 0xF3,
-    0xB7, 0x1D, 0x23, 0x6F, 0x68, 0x57, 0x34, 0x7B, 0xB8, 0xD0, 0x8A, 0xBD, 0x37, 0x07, 0x54, 0x09,
-    0x20, 0xE3, 0x7A, 0xF1, 0xBA, 0x1A, 0x3C, 0x00, 0x58, 0x66, 0xBF, 0x78, 0x67, 0x93, 0xB9, 0x8E,
-    0x7C, 0x94, 0x1E, 0x8B, 0x51, 0x4E, 0xFB, 0x14, 0x1A, 0x94, 0xC0, 0x6A, 0x5F, 0xB1, 0x56, 0x4C,
-    0x46, 0x4D, 0x88, 0x25, 0xCF, 0xF8, 0xF1, 0xFC, 0x57, 0x53, 0xF9, 0xF4, 0x1A, 0x3D, 0xF6, 0x3C,
-    0xF9, 0x18, 0x14, 0x36, 0x99, 0xE9, 0x25, 0xF2, 0xB9, 0x4B, 0x14, 0xBD, 0x95, 0xA9, 0xF3, 0xA1,
-    0xCE, 0x28, 0x77, 0x16, 0x90, 0xC9, 0x17, 0xCB, 0xE2, 0x19, 0x5D, 0x18, 0xA0, 0x32, 0xCB, 0x8B,
-    0xBA, 0xF4, 0x9A, 0xFE, 0xF6, 0xC3, 0x09, 0x8B, 0xCE, 0x70, 0x90, 0xD1, 0xFA, 0x48, 0x74, 0xFE,
-    0x8F, 0x5B, 0x1E, 0x8B, 0xCE, 0xC6, 0xBE, 0xE8, 0x0C, 0x7A, 0xC9, 0x7B, 0x45, 0xE7, 0x3D, 0x90,
-    0xEF, 0x41, 0x4E, 0x9F, 0x59, 0x61, 0x72, 0x50, 0x93, 0xCF, 0xD3, 0x43, 0x1A, 0x3C, 0x29, 0xA7,
-    0x62, 0xDF, 0x7B, 0xC9, 0x44, 0x0D, 0x79, 0x79, 0xD0, 0xC8, 0xCF, 0xD8, 0x0B, 0x97, 0x80, 0xC5,
-    0x36, 0x73, 0x03, 0x2F, 0x21, 0x4E, 0x6E, 0x8F, 0x76, 0x8C, 0x91, 0x79, 0x45, 0x0A, 0xEF, 0x3A,
-    0xA2, 0x1C, 0x43, 0xAB, 0xAB, 0x03, 0xAA, 0x23, 0x77, 0xB2, 0x80, 0x03, 0x5E, 0x0D, 0xA7, 0xE9,
-    0x5A, 0x52, 0x4A, 0xC5, 0x00, 0x74, 0x42, 0x19, 0x28, 0xA5, 0xE2, 0x96, 0x77, 0xD5, 0x94, 0x1B,
-    0xE4, 0x44, 0xE9, 0x1D, 0x82, 0x14, 0x49, 0x95, 0x21, 0x9E, 0x2D, 0x8B, 0x52, 0xC5, 0xF8, 0x00,
-    0x51, 0x1A, 0x8C, 0x44, 0x29, 0xC8, 0xB0, 0x13, 0xA5, 0x49, 0x03, 0x50, 0x75, 0x9A, 0x1A, 0x53,
-    0x63, 0xF7, 0xCF, 0x12, 0x97, 0x40, 0xB3, 0xAA, 0x84, 0x23, 0x0F, 0x55, 0x75, 0x24, 0xDF, 0x85,
-    0x8A, 0x89, 0x94, 0x4E, 0x67, 0xFC, 0xF8, 0x1F, 0xC7, 0x81, 0xE2, 0xE8, 0x3C, 0xA2, 0xA9, 0x4B,
-    0x75, 0x04, 0xB2, 0x93, 0x72, 0x96, 0x7D, 0x19, 0xB2, 0xCC, 0x13, 0x9C, 0xCC, 0x88, 0xFE, 0x0A,
-    0xEF, 0x81, 0x83, 0xAF, 0xC7, 0xFC, 0x25, 0x70, 0xFC, 0xC1, 0xA9, 0x2A, 0xD6, 0xC2, 0x10, 0x9B,
-    0x9E, 0x13, 0x96, 0x90, 0xC3, 0x80, 0xC1, 0x86, 0x2D, 0xA1, 0x72, 0xB4, 0x8B, 0x18, 0xB7, 0x4A,
-    0xD3, 0x9E, 0xEB, 0x80, 0x49, 0x4C, 0x50, 0x04, 0xE8, 0x34, 0xFD, 0x58, 0x00, 0x74, 0xC8, 0xBB,
-    0x70, 0x81, 0xC1, 0x0E, 0xE1, 0x98, 0x20, 0xC1, 0x9A, 0xD8, 0x98, 0xCF, 0x39, 0xC6, 0xC5, 0xAB,
-    0x48, 0xA7, 0x77, 0xE1, 0xE9, 0x9F, 0x74, 0xCB, 0xD4, 0x07, 0xF3, 0x0B, 0xA8, 0x16, 0x79, 0xA9,
-    0x3C, 0x96, 0xCC, 0xD3, 0x2A, 0x54, 0xF0, 0x9F, 0x06, 0x14, 0x8D, 0x68, 0xBF, 0x04, 0x5E, 0x01,
-    0x19, 0xE0, 0x1D, 0xD4, 0x50, 0xA4, 0x3D, 0x98, 0x21, 0x94, 0xAA, 0x45, 0x42, 0xA7, 0xC0, 0xF4,
-    0x3C, 0xAB, 0x89, 0x8C, 0x95, 0xDA, 0x34, 0x6E, 0x28, 0xE0, 0x86, 0x12, 0x6E, 0xC0, 0x4D, 0x90,
-    0x3C, 0x07, 0xBD, 0x11, 0xCA, 0x78, 0xD8, 0xA4, 0xD8, 0x1D, 0x49, 0x65, 0x08, 0xA5, 0x5D, 0xF0,
-    0x8F, 0xA3, 0x40, 0x1B, 0x5A, 0xAD, 0x29, 0xAA, 0x4D, 0xC3, 0x66, 0x50, 0x6A, 0x60, 0x60, 0xD1,
-    0x69, 0xDA, 0x0D, 0x86, 0x8F, 0x42, 0xB8, 0x03, 0xC2, 0xF3, 0x5B, 0xCC, 0x78, 0xF6, 0xFA, 0x1E,
-    0x0C, 0x6C, 0x35, 0xA8, 0x1F, 0x14, 0x02, 0xB3, 0x7A, 0xB8, 0x54, 0x90, 0x47, 0x93, 0xCB, 0x69,
-    0x54, 0xD8, 0x3A, 0x9A, 0xE7, 0xDB, 0xEA, 0xED, 0x21, 0x7D, 0x18, 0xFD, 0x1D, 0x37, 0xF2, 0xC1,
-    0x9E, 0xFE, 0x86, 0xE0, 0x71, 0x49, 0xF1, 0x80, 0x03, 0x9E, 0x7D, 0xD2, 0x3A, 0xEF, 0x48, 0xAB,
-    0xB7, 0x47, 0x5A, 0x13, 0x4A, 0xFC, 0x84, 0x2B, 0xC6, 0xF3, 0xF0, 0x0C, 0x03, 0xD1, 0xA8, 0xB7,
-    0x3B, 0xC3, 0x32, 0x99, 0x25, 0x33, 0x7B, 0x6E, 0x7B, 0x54, 0xC3, 0x62, 0x66, 0x19, 0x5C, 0xD3,
-    0x0A, 0x0E, 0x32, 0x1B, 0xF9, 0x97, 0xBF, 0x08, 0xBE, 0x30, 0x09, 0xAE, 0xEA, 0x68, 0x59, 0x84,
-    0x87, 0x30, 0xD4, 0x09, 0x62, 0xF8, 0x5C, 0x88, 0x38, 0x41, 0xEC, 0x82, 0x34, 0x95, 0x20, 0x0E,
-    0x17, 0x58, 0x00, 0x20, 0x54, 0x91, 0x87, 0x18, 0x02, 0x96, 0x87, 0x8F, 0x1B, 0x4E, 0xD1, 0x37,
-    0xE5, 0xB9, 0xA4, 0x53, 0x2B, 0xC2, 0x45, 0x51, 0x53, 0xFE, 0x80, 0xEA, 0x1A, 0x78, 0x50, 0xE1,
-    0x79, 0x23, 0xDE, 0x1F, 0x06, 0xDC, 0xD0, 0x2A, 0xC9, 0xA4, 0x5E, 0x90, 0xDA, 0xBF, 0x6A, 0x3C,
-    0x64, 0x1B, 0xD0, 0x27, 0x70, 0xC8, 0x33, 0x39, 0x4C, 0x78, 0x59, 0x18, 0x0A, 0xC1, 0xE3, 0x73,
-    0x1E, 0x24, 0x07, 0xF6, 0x58, 0xF6, 0x59, 0xF0, 0x14, 0x38, 0x10, 0xB7, 0x36, 0x79, 0xC5, 0x0F,
-    0xE6, 0x6D, 0x6E, 0x97, 0x8C, 0xF0, 0x9C, 0x56, 0xF6, 0xAB, 0xB6, 0xD4, 0x08, 0x0A, 0xCD, 0xFD,
-    0x11, 0x9E, 0x88, 0x3C, 0xD7, 0x07, 0xE0, 0x46, 0x2A, 0xBC, 0xC2, 0x86, 0xE6, 0xB6, 0x83, 0xBC,
-    0xCD, 0xA1, 0xD9, 0xC7, 0xBB, 0x81, 0xB7, 0x9F, 0xE2, 0xFA, 0x60, 0x71, 0x9C, 0x1B, 0x93, 0xE4,
-    0x25, 0x87, 0x49, 0xAF, 0xD2, 0xCB, 0x06, 0x90, 0x33, 0xEA, 0x31, 0xA3, 0x7E, 0xCA, 0xF3, 0x14,
-    0x04, 0x71, 0xA4, 0xFE, 0xDC, 0xD1, 0x0A, 0xAC, 0xF5, 0xCA, 0x97, 0x4F, 0xC5, 0xA6, 0x48, 0x8B,
-    0x2A, 0x46, 0x50, 0x4F, 0x22, 0x40, 0xE3, 0x1A, 0x69, 0xD7, 0x9A, 0xA9, 0x31, 0xA4, 0x3B, 0xB1,
-    0x3E, 0x60, 0x74, 0x72, 0xA7, 0x06, 0xBA, 0xF7, 0xC6, 0xD9, 0x64, 0xD3, 0x2C, 0x2E, 0x4E, 0x95,
-    0x0E, 0x4E, 0x4A, 0x79, 0xE1, 0x65, 0x7C, 0xA7, 0xB8, 0xE6, 0xD3, 0x61, 0x6A, 0x3B, 0x1D, 0x53,
-    0xA0, 0xCE, 0x2A, 0x28, 0xF7, 0x82, 0xFA, 0x64, 0xE6, 0xDF, 0x76, 0xFC, 0xAA, 0xC9, 0x3C, 0x0B,
-    0xFB, 0x7B, 0x28, 0xA1, 0x27, 0x98, 0x7D, 0x79, 0xF1, 0x5D, 0x07, 0x4A, 0x93, 0x73, 0x85, 0xD9,
-    0xA9, 0xD9, 0x08, 0x32, 0xB1, 0x0A, 0x22, 0x76, 0x82, 0x9E, 0xC6, 0x00, 0x87, 0x8A, 0x54, 0xAE,
-    0xD2, 0x2B, 0x9A, 0xD5, 0x5A, 0x8D, 0xDE, 0xB8, 0x76, 0xFC, 0xDC, 0x5F, 0xEC, 0x06, 0xB9, 0x0D,
-    0x5F, 0x4B, 0x0A, 0xC8, 0x0D, 0x4B, 0xC7, 0xB8, 0x51, 0x08, 0x12, 0xB9, 0xBA, 0x59, 0xFD, 0xF8,
-    0x1F, 0x16, 0x5F, 0xF7, 0x6E, 0x27, 0x87, 0xCD, 0xC1, 0x55, 0x86, 0xCF, 0xB1, 0xA6, 0xC1, 0x0A,
-    0x3B, 0x8C, 0x70, 0xB7, 0xA6, 0x67, 0xE8, 0x9A, 0x2E, 0x38, 0xC5, 0xD5, 0x05, 0xA0, 0xAD, 0x71,
-    0xE1, 0xAA, 0xB9, 0x7E, 0xAC, 0x63, 0x66, 0xF4, 0xAF, 0xEF, 0x30, 0x33, 0xF5, 0x2B, 0x98, 0xD9,
-    0x0A, 0x44, 0x72, 0x7A, 0xEA, 0x92, 0x3C, 0xD2, 0xFB, 0x71, 0x59, 0x5E, 0x77, 0x7D, 0xD9, 0xE0,
-    0xEF, 0x57, 0xB8, 0xF1, 0x8C, 0x88, 0x66, 0x24, 0x60, 0x2A, 0xD1, 0x42, 0x65, 0xEF, 0xFD, 0x98,
-    0x1E, 0xA8, 0x2C, 0x3F, 0x71, 0xD0, 0xBF, 0xD5, 0xCE, 0x87, 0xC5, 0x4F, 0x79, 0x1C, 0x16, 0x94,
-    0x67, 0x82, 0x33, 0x63, 0xC5, 0xA7, 0xDC, 0x9C, 0xFA, 0x1E, 0x0F, 0x32, 0x27, 0x2F, 0x8E, 0x07,
-    0xF9, 0xD4, 0x3B, 0x83, 0xC4, 0xEC, 0xF6, 0xF1, 0x20, 0xDC, 0x1A, 0xE7, 0x7C, 0xA0, 0x83, 0x7E,
-    0xFA, 0x8B, 0x33, 0x67, 0x86, 0x7F, 0x3B, 0x93, 0x5F, 0x7D, 0x1C, 0x6A, 0x4F, 0x9A, 0x7B, 0x90,
-    0x2A, 0x3D, 0x03, 0x03, 0xDD, 0xF5, 0x7E, 0xC7, 0x10, 0x74, 0xB7, 0x60, 0xBC, 0x15, 0xCC, 0x8B,
-    0x98, 0x74, 0xBC, 0x8B, 0x05, 0x72, 0x23, 0xAB, 0x85, 0xD2, 0xBC, 0x1E, 0xA2, 0x7A, 0x05, 0xC7,
-    0x5F, 0xB6, 0x24, 0xDE, 0xCC, 0x98, 0x39, 0xA0, 0x5A, 0x50, 0xB0, 0xB3, 0xC5, 0x95, 0x97, 0x19,
-    0x6E, 0x63, 0xE0, 0xE8, 0x96, 0xFB, 0xE0, 0x95, 0xF2, 0xC5, 0xF0, 0x75, 0x0C, 0x57, 0xB9, 0xFE,
-    0x1A, 0xA2, 0xFF, 0x5A, 0x3F, 0xA7, 0xCA, 0xCB, 0xC3, 0x90, 0x23, 0x7A, 0x05, 0xF1, 0xE3, 0x83,
-    0xCC, 0x53, 0x2B, 0x1D, 0x35, 0xE6, 0xF7, 0x5F, 0x87, 0x0E, 0x1C, 0x19, 0xE9, 0xFE, 0x85, 0x0F,
-    0xA1, 0xFB, 0x69, 0xE5, 0x10, 0xA5, 0x5D, 0xEF, 0x8A, 0x11, 0xCF, 0x26, 0xF2, 0xEB, 0xA4, 0xD6,
-    0x39, 0x6F, 0x82, 0x5B, 0x34, 0x1D, 0x26, 0xC8, 0x01, 0x50, 0xA5, 0x35, 0x61, 0x32, 0x3E, 0x15,
-    0x49, 0xE8, 0x24, 0x79, 0x83, 0xF1, 0x11, 0xC0, 0x67, 0xF5, 0xAC, 0x9E, 0x32, 0x8A, 0xA1, 0xE7,
-    0x45, 0xBD, 0x5A, 0xAD, 0x31, 0x10, 0x86, 0x74, 0x00, 0xE1, 0x7F, 0x21, 0x51, 0x79, 0x2A, 0x4C,
-    0x93, 0x6C, 0x19, 0x80, 0x8A, 0xC2, 0xCD, 0xFA, 0x5C, 0x6A, 0x2B, 0x0C, 0x2A, 0xCE, 0x0C, 0xAD,
-    0x05, 0xF1, 0x29, 0x39, 0xA8, 0x23, 0x23, 0x18, 0xFA, 0x11, 0x9D, 0x13, 0xC9, 0xB8, 0x17, 0xA0,
-    0x47, 0xBD, 0x80, 0x55, 0xEE, 0x05, 0xA4, 0x51, 0xC8, 0xF1, 0x52, 0xA6, 0x0F, 0xD1, 0x41, 0xD5,
-    0x77, 0x74, 0x50, 0x75, 0xDD, 0x1D, 0x2A, 0x01, 0x04, 0x58, 0x3D, 0xBB, 0xCD, 0xBB, 0xD7, 0x94,
-    0xA7, 0x57, 0x7D, 0x91, 0xD4, 0x30, 0x45, 0x53, 0x71, 0xCF, 0x26, 0xB7, 0x35, 0x75, 0xC6, 0x2C,
-    0xF8, 0xC0, 0x4F, 0xC9, 0x45, 0xD2, 0x99, 0xF1, 0x23, 0x34, 0x6D, 0x5D, 0xA3, 0x14, 0x6B, 0x67,
-    0x14, 0xE2, 0x03, 0x0C, 0x7A, 0xF2, 0x97, 0xA6, 0x3D, 0xBA, 0x3F, 0xED, 0xBC, 0xCF, 0xC7, 0x4E,
-    0xEE, 0x94, 0xCA, 0x1D, 0xD1, 0x1C, 0xA4, 0x36, 0xB7, 0x22, 0x02, 0x10, 0xBA, 0xAA, 0xD0, 0x26,
-    0x90, 0x5F, 0xEE, 0xAB, 0xDC, 0x8C, 0x98, 0x2E, 0xAC, 0x81, 0x2C, 0x1B, 0xFD, 0x76, 0x9D, 0xB5,
-    0xDF, 0x97, 0x9F, 0x9B, 0x32, 0xDF, 0xFD, 0x9B, 0x73, 0xFF, 0xCD, 0x14, 0xF0, 0xF0, 0x5E, 0x1C,
-    0xA0, 0xE4, 0xA0, 0x4E, 0xC7, 0x81, 0xF1, 0x33, 0x54, 0x7E, 0xC8, 0x39, 0x5D, 0x1C, 0x04, 0xDB,
-    0xE2, 0xFA, 0x95, 0xDB, 0xC9, 0xD2, 0xF6, 0x7A, 0x26, 0x9F, 0xBB, 0xFE, 0x8D, 0x78, 0xBD, 0xF5,
-    0xA6, 0x0D, 0xCE, 0xED, 0x36, 0x28, 0x6B, 0x9C, 0x4B, 0xC3, 0x65, 0xBB, 0x23, 0xED, 0x52, 0x60,
-    0x1A, 0xEC, 0xDC, 0x51, 0xCD, 0x72, 0xB5, 0xC1, 0x35, 0xA2, 0x98, 0xC3, 0x7D, 0x0C, 0x30, 0x73,
-    0x10, 0x0C, 0x5B, 0x99, 0x53, 0x41, 0x3A, 0x28, 0xBC, 0xFA, 0x5F, 0xA5, 0x5F, 0xAC, 0x45, 0xC3,
-    0xB5, 0xDA, 0xA0, 0xDB, 0xEC, 0xDA, 0x2E, 0xD7, 0x82, 0x26, 0x57, 0x08, 0xAE, 0x13, 0x80, 0xBE,
-    0x48, 0x26, 0x4D, 0x6C, 0xAB, 0xE8, 0x99, 0x32, 0x94, 0xBA, 0x1C, 0x0B, 0xC1, 0x55, 0x10, 0x82,
-    0x7A, 0xE6, 0x9A, 0xB5, 0xEF, 0x7A, 0xB1, 0xA5, 0x38, 0x85, 0x60, 0x78, 0xEF, 0x26, 0xB9, 0xF3,
-    0x19, 0xFF, 0x78, 0xCC, 0x07, 0x34, 0x14, 0x21, 0xE0, 0xB6, 0x54, 0xE2, 0x38, 0x09, 0x9C, 0xEB,
-    0x3B, 0x36, 0xA2, 0xE0, 0x58, 0x35, 0xEA, 0xD9, 0x56, 0x27, 0x49, 0xDC, 0xD4, 0x0E, 0x96, 0xC7,
-    0x6A, 0x3F, 0xE1, 0x76, 0x9D, 0x48, 0xB7, 0x1C, 0xE0, 0x03, 0x70, 0x50, 0xE1, 0x4B, 0xC2, 0x7A,
-    0x28, 0x97, 0x7C, 0x64, 0xE7, 0x9A, 0x76, 0x6B, 0x30, 0x60, 0x06, 0xB7, 0x3C, 0xF9, 0xCD, 0x8F,
-    0xBC, 0x06, 0xCF, 0x20, 0x4D, 0x80, 0x8C, 0x9F, 0x7F, 0x70, 0x7F, 0xA4, 0x9D, 0x13, 0x14, 0x5C,
-    0x4C, 0xF8, 0x7C, 0x4A, 0xC1, 0x26, 0xD0, 0x33, 0xBC, 0x04, 0xC5, 0x07, 0x88, 0x17, 0x53, 0xAE,
-    0x4E, 0x34, 0x6E, 0x1C, 0x8E, 0x4E, 0x2B, 0xF9, 0xA8, 0x05, 0x57, 0x6F, 0x8D, 0x93, 0x93, 0xE6,
-    0x99, 0x8B, 0x8B, 0x6B, 0xBC, 0xBB, 0x19, 0x5E, 0x13, 0xD9, 0x16, 0x92, 0x24, 0x70, 0x87, 0x33,
-    0x19, 0x8A, 0x28, 0x0A, 0xE9, 0x92, 0x13, 0xFA, 0xEE, 0xF8, 0x94, 0xBB, 0x28, 0x4B, 0x78, 0x3C,
-    0x85, 0x2A, 0xCA, 0xF3, 0x3B, 0xCD, 0x2A, 0xFA, 0xB0, 0x49, 0x9E, 0xBF, 0xA0, 0x17, 0xFC, 0xB4,
-    0xA0, 0xE2, 0x53, 0x5F, 0x30, 0x08, 0xD7, 0xFF, 0x9C, 0x62, 0x17, 0x21, 0x56, 0xB1, 0x96, 0xDD,
-    0x09, 0x3E, 0x72, 0xB4, 0xEA, 0xD6, 0xCD, 0xD1, 0x41, 0x56, 0xF5, 0x20, 0x2D, 0x6C, 0xEF, 0x1B,
-    0xF2, 0x83, 0x1D, 0x34, 0x3B, 0x97, 0xC2, 0xA3, 0xA1, 0x79, 0x67, 0xE2, 0x93, 0xB1, 0x30, 0xC6,
-    0xA7, 0x13, 0x33, 0x5F, 0xB0, 0x95, 0xE1, 0x66, 0xD5, 0x21, 0x7F, 0xFD, 0x48, 0x5C, 0x81, 0x36,
-    0x1C, 0xF2, 0x69, 0x06, 0xFE, 0xB1, 0x79, 0x7A, 0xA4, 0x8F, 0x2E, 0xE4, 0xCB, 0xC3, 0x47, 0xA7,
-    0xC8, 0xCC, 0xCE, 0xF0, 0xB9, 0xCC, 0xB8, 0xF4, 0x02, 0xDA, 0x87, 0xDE, 0xEF, 0x6D, 0xBB, 0x9E,
-    0xC4, 0xE5, 0x8B, 0x79, 0xF0, 0xD3, 0xEE, 0xAC, 0x4C, 0x56, 0xD7, 0xE8, 0xB4, 0x9B, 0xCF, 0x5F,
-    0xD6, 0xF2, 0x4A, 0xEA, 0x8D, 0x9B, 0x0F, 0xFB, 0x2A, 0xFB, 0x16, 0x13, 0x20, 0x71, 0x64, 0xD4,
-    0x52, 0x92, 0xFA, 0xC1, 0x9E, 0x09, 0x6E, 0x75, 0xF8, 0x78, 0x76, 0x73, 0xED, 0x4E, 0x21, 0xD9,
-    0x83, 0xC8, 0xEB, 0x7B, 0x47, 0xB6, 0xDD, 0x3E, 0x4A, 0x13, 0xBD, 0x01, 0x46, 0x3F, 0x48, 0xA9,
-    0x52, 0x50, 0xA7, 0x71, 0x18, 0xC4, 0xF7, 0x4D, 0x72, 0xE9, 0xE6, 0x52, 0xC0, 0x45, 0x9F, 0xE4,
-    0x8B, 0xF6, 0xCE, 0x59, 0x82, 0x33, 0xBB, 0x3E, 0xA2, 0xA0, 0x05, 0xA6, 0xB0, 0x54, 0x39, 0x87,
-    0xA0, 0x7B, 0x8E, 0xDD, 0xF4, 0x16, 0x53, 0x83, 0xFA, 0xDB, 0x4E, 0x38, 0xD9, 0x31, 0xBC, 0x52,
-    0x6B, 0x40, 0x23, 0x90, 0xC5, 0x07, 0xC3, 0x2D, 0x28, 0x2A, 0xF5, 0x5A, 0xDF, 0x00, 0xB6, 0x3C,
-    0xFC, 0xEA, 0x80, 0x7A, 0xE7, 0xFA, 0x2D, 0x0C, 0xFF, 0x39, 0x88, 0x1D, 0x8E, 0x1D, 0xCF, 0xF6,
-    0xEF, 0x38, 0x7B, 0x8F, 0x57, 0xEE, 0xA2, 0xA8, 0x72, 0x2C, 0x11, 0xD7, 0xDE, 0x80, 0x80, 0xA8,
-    0x43, 0x6F, 0xFE, 0xE2, 0x47, 0x3C, 0x76, 0x32, 0xD2, 0xB0, 0x90, 0x0A, 0xF0, 0x7B, 0x9F, 0xBC,
-    0xDB, 0xB7, 0x0D, 0xED, 0x9C, 0x6E, 0x51, 0xE3, 0xFC, 0xAB, 0x78, 0xBC, 0x19, 0x21, 0xA2, 0xBD,
-    0xB6, 0x0B, 0xE8, 0x7B, 0x71, 0x83, 0xF1, 0x98, 0xAE, 0xB9, 0x72, 0xFB, 0x69, 0xCD, 0x64, 0x05,
-    0x31, 0x2C, 0x58, 0x79, 0x3E, 0x79, 0x92, 0x50, 0x3D, 0xC7, 0xC7, 0x74, 0x73, 0xF7, 0x31, 0x17,
-    0xEB, 0x9F, 0x1A, 0x4F, 0xFD, 0x4D, 0x82, 0xF2, 0x62, 0x02, 0x37, 0xE5, 0xCE, 0x3A, 0xCA, 0x2C,
-    0xC7, 0x16, 0xEC, 0xB8, 0xF3, 0xD8, 0x1A, 0x78, 0x7F, 0xA0, 0x1D, 0x1A, 0xCE, 0x30, 0x71, 0x42,
-    0xA2, 0x17, 0xC9, 0x4B, 0xE7, 0xD6, 0x21, 0x45, 0xC3, 0x94, 0xBC, 0x47, 0x78, 0xCF, 0x42, 0x7B,
-    0xCC, 0xED, 0x2B, 0xB1, 0xF7, 0x27, 0x0C, 0x06, 0x45, 0x6F, 0xC3, 0xB4, 0x06, 0x62, 0xB8, 0xB7,
-    0x33, 0x14, 0x34, 0x37, 0xD4, 0x0C, 0x4A, 0x44, 0x06, 0xF6, 0xAD, 0x03, 0x13, 0x42, 0xBE, 0x6C,
-    0xF9, 0x03, 0xA9, 0x4F, 0xA7, 0xA1, 0x7A, 0x3E, 0xDE, 0x8A, 0xD6, 0xE5, 0xB5, 0x17, 0x6D, 0xB0,
-    0x10, 0x24, 0xA7, 0xD3, 0x53, 0x32, 0x97, 0x36, 0xB0, 0x81, 0x6E, 0xD1, 0x25, 0x07, 0xC8, 0xA3,
-    0xB3, 0x54, 0xD7, 0x6B, 0xF6, 0xBD, 0x7E, 0x51, 0x35, 0x0B, 0x85, 0xC5, 0x52, 0xAD, 0x53, 0x4E,
-    0xD3, 0x87, 0x12, 0xD3, 0x12, 0x9A, 0xBB, 0xCD, 0x22, 0xD9, 0xA4, 0x10, 0x04, 0x75, 0x7B, 0xE9,
-    0xFF, 0x7F, 0x46, 0x3D, 0x77, 0x98, 0xB6, 0x22, 0xEA, 0x6F, 0xBF, 0xFF, 0x6C, 0xB4, 0xD9, 0x06,
-    0x51, 0xB7, 0xEF, 0x8A, 0x94, 0x8F, 0x7A, 0x62, 0x67, 0xD7, 0xD4, 0x55, 0xF3, 0xE0, 0xE4, 0x78,
-    0xF2, 0x3E, 0x6D, 0xAD, 0xA9, 0x78, 0xB5, 0xE6, 0x5D, 0x36, 0xBE, 0xA2, 0xA8, 0x2C, 0xCC, 0x4E,
-    0x0F, 0x31, 0xE6, 0x8D, 0x8C, 0x3A, 0x71, 0xCB, 0x9D, 0xD8, 0x86, 0x31, 0xD7, 0xA8, 0xAE, 0x9F,
-    0x08, 0x03, 0xBE, 0x0E, 0xDB, 0xAE, 0x2B, 0x2D, 0xD2, 0x30, 0xAE, 0x70, 0x9B, 0x8C, 0xDB, 0x32,
-    0x2C, 0x8D, 0x47, 0x19, 0x10, 0x07, 0x4F, 0xC5, 0x36, 0xF0, 0x29, 0x02, 0x68, 0xA4, 0x6A, 0x39,
-    0x89, 0x82, 0xA7, 0x4C, 0x65, 0xE8, 0xF2, 0xCF, 0xC3, 0x66, 0x38, 0x1E, 0xD7, 0xEB, 0xF4, 0x9E,
-    0x97, 0xB7, 0x13, 0x73, 0x34, 0x2B, 0x03, 0x75, 0x44, 0xF3, 0x28, 0x83, 0x5D, 0xAE, 0xB4, 0x4B,
-    0xAE, 0xB9, 0xB3, 0xF5, 0x2B, 0x9A, 0x3B, 0x8C, 0xB0, 0x00, 0xD8, 0x3B, 0xF1, 0xB5, 0x17, 0xBB,
-    0x46, 0x0F, 0xE8, 0x80, 0xC5, 0xCC, 0x35, 0xCF, 0x80, 0xDF, 0xD6, 0x2F, 0xC6, 0xE3, 0x46, 0xCF,
-    0xA4, 0x88, 0x3D, 0xDB, 0x85, 0x6C, 0xDF, 0x27, 0x4D, 0x90, 0x1F, 0xDF, 0x3B, 0x89, 0x10, 0xEC,
-    0x2A, 0xD7, 0xF3, 0xA8, 0xD1, 0x83, 0x4F, 0x25, 0x92, 0x41, 0x0F, 0x68, 0x84, 0x1C, 0x8C, 0x2F,
-    0x31, 0x72, 0x42, 0xE1, 0x79, 0x7B, 0x27, 0xCE, 0xEF, 0xFA, 0x3B, 0x10, 0xBF, 0x4F, 0xED, 0x11,
-    0xE9, 0x4C, 0x25, 0x62, 0xAE, 0x7C, 0x97, 0xE0, 0xA3, 0x98, 0xDE, 0xD8, 0xC2, 0x7C, 0x88, 0xBD,
-    0xD7, 0xB1, 0xBF, 0xE3, 0x48, 0xD1, 0x7E, 0xA0, 0x23, 0x45, 0xF0, 0x1A, 0x6F, 0xE5, 0x0E, 0xDB,
-    0x60, 0x43, 0x2A, 0x6E, 0x52, 0x1A, 0x51, 0x34, 0x0D, 0x72, 0x8F, 0x72, 0x04, 0x5B, 0x81, 0x71,
-    0xA7, 0xAE, 0x88, 0x8E, 0xFE, 0x80, 0xE1, 0x12, 0x41, 0xFE, 0x89, 0xBD, 0x2C, 0x07, 0xCA, 0xC0,
-    0xCC, 0x6A, 0x3F, 0x64, 0xAA, 0x04, 0xC3, 0x74, 0xF8, 0x8C, 0x19, 0x59, 0x5C, 0x44, 0x76, 0x3D,
-    0x4F, 0xFC, 0xF7, 0x11, 0xA0, 0x2E, 0x2A, 0x75, 0x2A, 0xAB, 0xCF, 0x45, 0x39, 0x00, 0x37, 0xE1,
-    0xAD, 0x06, 0x7E, 0x0C, 0xBD, 0x23, 0xFE, 0xAE, 0xFD, 0x51, 0x96, 0x00, 0xB9, 0x20, 0x8C, 0x1F,
-    0xDF, 0x47, 0xFB, 0x38, 0x2A, 0xE2, 0x83, 0xC4, 0xE5, 0xB2, 0x0C, 0x6B, 0x37, 0x61, 0xBA, 0x97,
-    0x53, 0xB7, 0x0E, 0x6E, 0x13, 0x33, 0x87, 0x3A, 0x4D, 0x6E, 0x25, 0xE0, 0x35, 0xCC, 0x0F, 0xB0,
-    0x3A, 0xB7, 0x16, 0xD0, 0xE2, 0x7B, 0x98, 0x78, 0x40, 0xD2, 0xBC, 0x37, 0x64, 0x70, 0x95, 0x1B,
-    0x9F, 0x32, 0xB1, 0xDC, 0xF9, 0xA4, 0x28, 0xE2, 0x3E, 0xBA, 0xEB, 0x86, 0xB0, 0x4E, 0x64, 0x4A,
-    0x56, 0x1F, 0x0D, 0x09, 0xBA, 0x14, 0x66, 0xB4, 0xD7, 0xFE, 0x04, 0xA4, 0x58, 0x18, 0x67, 0x6E,
-    0x5C, 0x4E, 0x57, 0xE5, 0x46, 0x52, 0x70, 0x9A, 0xE6, 0x8A, 0x2E, 0x16, 0x29, 0x8B, 0x7C, 0x10,
-    0x79, 0xDA, 0x59, 0x1B, 0xF3, 0xA5, 0x88, 0xC4, 0xD1, 0x64, 0x2B, 0x0A, 0x8E, 0x8F, 0xBC, 0x19,
-    0xC7, 0x87, 0xA6, 0x84, 0xA7, 0x17, 0xE7, 0xA4, 0x8C, 0x3F, 0x6E, 0xC5, 0x6D, 0x6E, 0xF2, 0x16,
-    0xDE, 0xFF, 0x6F, 0x2F, 0x76, 0x98, 0x73, 0x8D, 0x9B, 0x15, 0x32, 0x3F, 0xCA, 0x8D, 0xEC, 0x2A,
-    0x8D, 0xFB, 0x6F, 0xA9, 0xD3, 0x69, 0x7C, 0x4C, 0x01, 0x2C, 0x5D, 0xE0, 0x03, 0x9B, 0xAF, 0xB6,
-    0xDF, 0xB5, 0xCF, 0x43, 0xC4, 0x7F, 0x2A, 0x84, 0xCA, 0xB8, 0xC5, 0x32, 0x0B, 0xEA, 0x8D, 0x35,
-    0x1C, 0xC6, 0x6E, 0x81, 0x29, 0x06, 0x1E, 0xD8, 0x2E, 0xAA, 0x2F, 0x04, 0x9D, 0xE9, 0x8B, 0xCB,
-    0xDB, 0x01, 0x44, 0xF8, 0x51, 0x8B, 0x80, 0xDC, 0x3B, 0x39, 0x9F, 0x80, 0x74, 0xB3, 0xC0, 0xCB,
-    0xE0, 0x8E, 0xCA, 0x0D, 0x63, 0x99, 0x0E, 0x95, 0xE0, 0x45, 0x9D, 0x6F, 0xD6, 0x0A, 0x62, 0xE3,
-    0x88, 0x9E, 0xEB, 0x94, 0xE5, 0x79, 0x79, 0xD3, 0xA6, 0x8D, 0xFE, 0xF4, 0x3B, 0x35, 0xCF, 0x9D,
-    0x55, 0x63, 0x52, 0xD6, 0x4C, 0xEA, 0x2C, 0xF2, 0xF7, 0xCD, 0xF4, 0x03, 0x9D, 0x55, 0xEF, 0x55,
-    0x12, 0xB5, 0xCF, 0x99, 0x44, 0x32, 0xE7, 0xE9, 0x36, 0xA4, 0x1F, 0x7D, 0xDF, 0xC5, 0x8A, 0x93,
-    0xAA, 0xEA, 0x3C, 0xCD, 0x04, 0xF1, 0x3A, 0x82, 0x9F, 0x0F, 0xE1, 0xE9, 0x7F, 0x01, 0x5D, 0x54,
-    0x3D, 0x8C, 0x1B, 0x45, 0x14, 0xFE, 0x66, 0x86, 0xBB, 0xBD, 0xF3, 0xDA, 0xB7, 0x2E, 0x2E, 0xCA,
-    0x11, 0xEC, 0xDB, 0x34, 0x41, 0xAB, 0xC3, 0x17, 0xBB, 0x70, 0xE1, 0x62, 0xED, 0x9B, 0xD0, 0x44,
-    0xA2, 0x89, 0x10, 0xA1, 0x26, 0x15, 0x4A, 0x87, 0x91, 0x28, 0xAE, 0x88, 0x74, 0xA3, 0x08, 0xA5,
-    0x08, 0x05, 0xA7, 0x28, 0x0D, 0x54, 0x2E, 0x93, 0x4D, 0x73, 0xC5, 0x21, 0x5D, 0x61, 0xC4, 0x34,
-    0x54, 0x34, 0x2B, 0x21, 0x0A, 0xBA, 0xE5, 0xA7, 0x4B, 0xB3, 0x44, 0x46, 0x58, 0xB0, 0x77, 0xC3,
-    0x37, 0xB6, 0x39, 0x01, 0x2B, 0x6B, 0x67, 0xF6, 0xBD, 0x6F, 0xDE, 0xFB, 0xDE, 0xF7, 0xDE, 0x78,
-    0x2F, 0x8B, 0x9D, 0xDD, 0xF3, 0xAF, 0x6B, 0x59, 0x76, 0xC7, 0xB9, 0x7C, 0x2F, 0x7B, 0x76, 0xE4,
-    0x2A, 0x00, 0x7B, 0x59, 0xF6, 0xFC, 0x03, 0xE7, 0x5C, 0x81, 0xFF, 0x7F, 0x60, 0xBC, 0x23, 0xCD,
-    0x71, 0x43, 0xA1, 0xD7, 0x12, 0x66, 0xE2, 0xD7, 0xBA, 0xB0, 0x93, 0x9A, 0xD2, 0xBD, 0x3A, 0xEC,
-    0xBD, 0x9A, 0xD4, 0x7D, 0xAE, 0x63, 0x0F, 0xAC, 0x65, 0xD9, 0x13, 0xB7, 0x88, 0xE6, 0x9F, 0x23,
-    0xE7, 0xDE, 0xC9, 0xB2, 0xC9, 0xB6, 0x2A, 0xBA, 0x98, 0x85, 0x36, 0x09, 0xED, 0x3C, 0x56, 0xC5,
-    0x7D, 0x08, 0x5D, 0xC5, 0x6F, 0x97, 0xC3, 0x75, 0x73, 0xE9, 0xD9, 0xDE, 0x56, 0xBF, 0x14, 0x5D,
-    0xEE, 0xCB, 0xF0, 0x3B, 0x9B, 0x24, 0xE2, 0x96, 0x9E, 0x56, 0xD1, 0xE7, 0xB7, 0x7E, 0x2B, 0x87,
-    0xC3, 0xF5, 0x47, 0xE6, 0x12, 0x3F, 0x1A, 0xC9, 0x57, 0x65, 0x74, 0x47, 0x4F, 0xA7, 0xF2, 0xC9,
-    0x31, 0xFA, 0x68, 0x20, 0x80, 0xB4, 0xC8, 0xD1, 0x43, 0xFB, 0x5D, 0x77, 0xFE, 0x9E, 0x81, 0xC5,
-    0x18, 0x09, 0xED, 0x0A, 0xC2, 0x62, 0x42, 0x48, 0x9D, 0x10, 0x61, 0xD0, 0x5C, 0x10, 0x92, 0x86,
-    0x2E, 0x82, 0xE9, 0xAB, 0x81, 0x4E, 0xFC, 0x00, 0x77, 0x21, 0x06, 0x60, 0x04, 0x05, 0xB4, 0xC0,
-    0x13, 0x57, 0x9F, 0x2A, 0x16, 0x3D, 0x5E, 0x41, 0xC7, 0x1E, 0x2A, 0x97, 0xD5, 0x5C, 0xB9, 0x4B,
-    0x4F, 0xEC, 0x8C, 0x3B, 0x57, 0x6E, 0xD6, 0x75, 0xD6, 0xB9, 0xD0, 0x55, 0x07, 0xEE, 0x95, 0x73,
-    0x84, 0x06, 0x3F, 0xCF, 0x27, 0x2C, 0x7F, 0x77, 0xE4, 0x7F, 0x98, 0xEC, 0xEC, 0xCA, 0x22, 0x1D,
-    0xA9, 0x7C, 0x7A, 0x23, 0xE7, 0x49, 0xB3, 0x86, 0x9E, 0x6C, 0x6E, 0xE2, 0x4D, 0x69, 0xD4, 0xF5,
-    0x31, 0x52, 0x26, 0x62, 0x3A, 0x26, 0x05, 0x53, 0x93, 0x88, 0xFC, 0x16, 0xF8, 0xF8, 0x7D, 0xDD,
-    0xBE, 0xF1, 0x54, 0x3D, 0x7C, 0xBC, 0xC8, 0x75, 0xA9, 0xD4, 0x7F, 0x85, 0xA0, 0x67, 0xA7, 0xD1,
-    0x48, 0x5B, 0xED, 0xFE, 0xA0, 0x73, 0xAF, 0xD7, 0xF7, 0xC8, 0x5E, 0x3F, 0xA9, 0x73, 0x49, 0xC6,
-    0xE9, 0x27, 0xAD, 0xC1, 0x66, 0x0B, 0x2B, 0x1B, 0x01, 0x49, 0xA7, 0x5E, 0xAF, 0x6F, 0xFA, 0xAA,
-    0xED, 0x5B, 0xB7, 0x6F, 0x6B, 0x34, 0xDB, 0xA1, 0x32, 0x0F, 0x64, 0x11, 0xA1, 0xA9, 0x03, 0xBD,
-    0x85, 0x8E, 0xCA, 0xE7, 0x11, 0xF4, 0x52, 0x16, 0x0C, 0x91, 0xCE, 0x21, 0xCB, 0xF0, 0x1C, 0x88,
-    0x4C, 0x4C, 0x6B, 0x15, 0x59, 0x20, 0xF8, 0xA3, 0x04, 0xD6, 0x8F, 0x2A, 0x1C, 0xE3, 0xF7, 0x0B,
-    0xDC, 0x44, 0xFC, 0x51, 0xAE, 0x72, 0x44, 0x0E, 0xDE, 0x35, 0xE3, 0xC9, 0xAA, 0x4B, 0x94, 0xC3,
-    0x05, 0x70, 0x60, 0xE2, 0x12, 0x71, 0xA1, 0x9C, 0x67, 0x39, 0xF5, 0x34, 0xD6, 0x7C, 0x6C, 0xE1,
-    0x15, 0x3C, 0x61, 0xA1, 0x6D, 0x84, 0x50, 0x56, 0xE4, 0xFC, 0x48, 0xB1, 0x8B, 0x50, 0x43, 0x0B,
-    0x8D, 0x19, 0xBE, 0xC6, 0x81, 0xA7, 0xC0, 0x9A, 0x39, 0x30, 0x85, 0xBC, 0x98, 0x8B, 0x56, 0x8A,
-    0x4E, 0x8A, 0xC1, 0x00, 0x87, 0xA7, 0xF8, 0xAA, 0xC0, 0x5F, 0x96, 0x09, 0x04, 0xC9, 0x15, 0x60,
-    0x6E, 0x65, 0x19, 0xD2, 0x8B, 0x16, 0x03, 0x5D, 0xF8, 0xB3, 0x47, 0x7E, 0x5A, 0x39, 0xCF, 0xAC,
-    0x7B, 0x73, 0x74, 0x16, 0x79, 0xC1, 0xB1, 0x01, 0x7C, 0x61, 0xB0, 0x0F, 0x64, 0x1A, 0xD7, 0x19,
-    0xFC, 0xD3, 0x0F, 0xBF, 0xFC, 0x35, 0x96, 0xF9, 0xF3, 0x1F, 0xEF, 0x6E, 0x88, 0xD5, 0x70, 0x92,
-    0x5C, 0xC2, 0xDA, 0xE0, 0xF9, 0xB1, 0xCF, 0x1C, 0x14, 0x28, 0xBD, 0x68, 0x4A, 0xB2, 0xE0, 0x22,
-    0x97, 0xE6, 0xF6, 0xD2, 0xBC, 0x78, 0xC4, 0x37, 0xBA, 0x5B, 0x04, 0x2F, 0x7F, 0xFA, 0xB3, 0x5A,
-    0x43, 0xA9, 0x53, 0xA0, 0x44, 0xC7, 0xBF, 0x52, 0xC8, 0x1C, 0x87, 0x08, 0x2C, 0xF7, 0x31, 0x49,
-    0x8A, 0x0A, 0x5D, 0x1D, 0x14, 0xA8, 0x10, 0x1A, 0x51, 0x22, 0xD2, 0xA4, 0x1E, 0x79, 0xF2, 0xAF,
-    0x71, 0xF4, 0x97, 0xA1, 0x52, 0x2F, 0x40, 0x4A, 0x17, 0xEE, 0xE3, 0xDA, 0xD2, 0xF4, 0xC6, 0x0C,
-    0xE1, 0x8B, 0xBC, 0x79, 0x1C, 0x6F, 0x31, 0x66, 0x8E, 0xAD, 0x16, 0xE4, 0xF7, 0x16, 0x87, 0x03,
-    0xC4, 0x81, 0x0E, 0x6D, 0x19, 0x94, 0x11, 0xCE, 0x44, 0x11, 0xE9, 0x21, 0x4A, 0x65, 0x5F, 0xC7,
-    0x36, 0x05, 0x46, 0x22, 0xB8, 0x3F, 0xC0, 0x34, 0x28, 0x57, 0x14, 0x25, 0x3B, 0xA1, 0x5E, 0x96,
-    0xD8, 0x30, 0xFB, 0x2C, 0x22, 0xD0, 0xCA, 0xC8, 0x9C, 0x9A, 0x97, 0x54, 0xFD, 0x94, 0xF9, 0xCE,
-    0xD0, 0xA6, 0x92, 0xA1, 0x9A, 0x53, 0xC7, 0x19, 0x44, 0xF1, 0x00, 0x38, 0xBD, 0x49, 0x36, 0x35,
-    0xDF, 0x28, 0x1F, 0x70, 0xC2, 0x2A, 0xCE, 0xA0, 0xCA, 0x21, 0xC4, 0xEA, 0x16, 0x8B, 0xD5, 0x80,
-    0xF0, 0x6A, 0x01, 0xFE, 0xEF, 0xC0, 0x5F, 0x74, 0xCE, 0xED, 0x3E, 0x67, 0x2D, 0xE2, 0x15, 0x59,
-    0xFF, 0x0C, 0x4B, 0x89, 0xD8, 0x99, 0x85, 0x96, 0xFF, 0x06, 0xA1, 0x73, 0x02, 0x34, 0xA8, 0x54,
-    0xC8, 0x22, 0x83, 0x7F, 0x40, 0xBE, 0x45, 0x9E, 0xF0, 0xC9, 0x0A, 0x94, 0xAC, 0xC8, 0xE3, 0x6F,
-    0x4D, 0x4E, 0x31, 0x4E, 0xC3, 0x40, 0x10, 0x9C, 0xBB, 0x93, 0x39, 0x64, 0x9B, 0x38, 0x85, 0x0B,
-    0x17, 0x0E, 0x72, 0x91, 0xC2, 0x44, 0xC8, 0x58, 0x88, 0x02, 0xD1, 0x64, 0xA5, 0x14, 0x21, 0x82,
-    0x82, 0x82, 0x07, 0x84, 0x88, 0x07, 0xA4, 0x48, 0x41, 0x45, 0x2E, 0xA6, 0x09, 0x28, 0x85, 0xC5,
-    0x1B, 0xF2, 0x88, 0x74, 0x5C, 0x94, 0x8A, 0x2E, 0x4F, 0xF0, 0x13, 0xAE, 0xA0, 0xA0, 0x83, 0x2D,
-    0x28, 0x68, 0x76, 0x67, 0x67, 0x66, 0x47, 0x23, 0xB0, 0xCC, 0xAA, 0xEB, 0xC9, 0xD0, 0xC5, 0x00,
-    0xEA, 0xC7, 0xDB, 0x79, 0x65, 0xFC, 0x05, 0x65, 0x72, 0x2D, 0x6F, 0x1A, 0x40, 0x1A, 0x73, 0xA5,
-    0x92, 0x87, 0x01, 0xC3, 0x1E, 0xDD, 0x95, 0x79, 0x18, 0x48, 0x12, 0x58, 0xC6, 0x5B, 0x97, 0xBD,
-    0xE5, 0x27, 0x10, 0xB4, 0xCA, 0x5E, 0xC2, 0x63, 0xDB, 0x7D, 0x06, 0x63, 0xFD, 0x63, 0xCF, 0x34,
-    0xB9, 0x8E, 0x36, 0xB3, 0x53, 0x65, 0x5D, 0xA4, 0xED, 0x53, 0x21, 0x9B, 0xAF, 0x88, 0xD0, 0xC6,
-    0x3B, 0x8D, 0xC7, 0xE7, 0x49, 0xFA, 0xE9, 0x2B, 0xB9, 0x33, 0x1F, 0x36, 0x32, 0x9C, 0x6D, 0xCB,
-    0xF8, 0x50, 0x05, 0xEE, 0xC0, 0x8C, 0x50, 0xA7, 0x81, 0xDA, 0xCF, 0xC9, 0x23, 0x0F, 0xB4, 0xC1,
-    0x36, 0xE7, 0x3C, 0xA4, 0xDE, 0xE2, 0xBE, 0x6F, 0x4B, 0x0D, 0xDF, 0x50, 0x5B, 0xAC, 0xE5, 0x90,
-    0x4B, 0x88, 0xBA, 0xEE, 0x0D, 0x56, 0xE5, 0x2E, 0x29, 0xD0, 0x33, 0x89, 0xC2, 0xF4, 0x48, 0xD8,
-    0x2E, 0x40, 0x55, 0x58, 0x7F, 0x97, 0xBB, 0xB4, 0xE0, 0x16, 0xAF, 0xF1, 0x64, 0xE4, 0xDB, 0xA4,
-    0x0F, 0x28, 0x23, 0xAD, 0xB0, 0xD8, 0xC3, 0x61, 0x8A, 0x4B, 0xA4, 0x68, 0x41, 0x93, 0xB4, 0x68,
-    0xF8, 0xE8, 0x40, 0x83, 0xB5, 0x29, 0xB3, 0x9A, 0xC4, 0x9E, 0x99, 0x88, 0x7F, 0xF9, 0x66, 0xBD,
-    0x05, 0x5C, 0xFC, 0xED, 0x19, 0x87, 0xB0, 0x85, 0x5F, 0x02, 0xB0, 0xA8, 0x88, 0x8D, 0xCC, 0xFC,
-    0x1F, 0xDA, 0xB0, 0xCB, 0xC3, 0x2F, 0x3D, 0x53, 0x31, 0x68, 0x1C, 0x47, 0x14, 0x7D, 0xB3, 0x83,
-    0xBC, 0x44, 0xA3, 0xD3, 0x04, 0x12, 0xE1, 0x80, 0x85, 0xB6, 0x49, 0x21, 0xEC, 0x8B, 0xF6, 0x8A,
-    0x35, 0x1C, 0xF8, 0x94, 0x9D, 0xC4, 0x10, 0x97, 0x76, 0x13, 0x52, 0xA7, 0x31, 0xC6, 0x81, 0xC4,
-    0xA5, 0x0B, 0x19, 0xAD, 0x71, 0x99, 0x22, 0x47, 0x30, 0xB8, 0x55, 0xE1, 0x42, 0x96, 0xC0, 0xBE,
-    0xC2, 0x85, 0x0B, 0xCB, 0x37, 0xB6, 0xC0, 0x69, 0x5C, 0x6C, 0x88, 0xDC, 0x99, 0xB0, 0x0A, 0x02,
-    0x61, 0x61, 0xAC, 0x89, 0x72, 0x21, 0x6B, 0xF9, 0x6E, 0x7F, 0xFE, 0xEC, 0xC9, 0xFA, 0x30, 0xCB,
-    0xCC, 0xCE, 0x9F, 0xFF, 0xFE, 0x7F, 0xFF, 0x7D, 0xC0, 0x9B, 0x9C, 0x06, 0xA6, 0x67, 0x81, 0xD9,
-    0x36, 0x90, 0x96, 0x08, 0x68, 0x00, 0xFD, 0x97, 0x45, 0xBA, 0x69, 0xF0, 0xFE, 0x67, 0x88, 0xFF,
-    0x1A, 0x90, 0x7F, 0x36, 0x11, 0xBE, 0x4A, 0xA0, 0xCA, 0x1E, 0xB4, 0xCB, 0xA1, 0x0F, 0x9E, 0x42,
-    0x13, 0x41, 0x51, 0xC5, 0x6B, 0x84, 0x69, 0x2A, 0xD1, 0x4C, 0x80, 0xA4, 0x07, 0xF4, 0x2C, 0x60,
-    0x0C, 0xC6, 0x76, 0x62, 0xC4, 0xF7, 0xB9, 0x1C, 0x00, 0x25, 0xB0, 0x00, 0x84, 0x7C, 0xC9, 0x07,
-    0x8D, 0xB7, 0x81, 0xD3, 0xDD, 0x34, 0xB0, 0xB2, 0x6C, 0x23, 0x7D, 0x3F, 0x0C, 0x88, 0xB2, 0x88,
-    0x71, 0x97, 0x2B, 0x1C, 0x9B, 0x30, 0x08, 0xC9, 0x04, 0x3B, 0x4D, 0x70, 0x5E, 0x92, 0x23, 0x3E,
-    0x59, 0x45, 0x44, 0x16, 0x8C, 0x73, 0x6A, 0xCF, 0x48, 0xF6, 0x96, 0x19, 0xF0, 0x10, 0xD8, 0xE0,
-    0xB4, 0x0F, 0xBB, 0x92, 0x43, 0xF0, 0xAB, 0x09, 0xA8, 0x4C, 0x5A, 0xE9, 0x82, 0x42, 0x8C, 0xE0,
-    0xD0, 0x37, 0x4B, 0xF8, 0xB2, 0x58, 0x40, 0xB4, 0xA4, 0x8D, 0xFA, 0x25, 0xB4, 0x29, 0x11, 0x7D,
-    0xF3, 0x6F, 0xF5, 0xCE, 0x0C, 0x17, 0xF8, 0x22, 0x7C, 0x8B, 0xC8, 0x90, 0xD1, 0x36, 0xE5, 0x17,
-    0xDA, 0x71, 0x9C, 0x11, 0x70, 0xF8, 0x04, 0xCA, 0x74, 0x42, 0xA2, 0xA1, 0x70, 0x2A, 0x0B, 0xB3,
-    0x25, 0xA4, 0x94, 0x83, 0x2B, 0xF4, 0xC9, 0xC7, 0xA8, 0x4B, 0x91, 0xF9, 0x78, 0x3B, 0xE4, 0xAD,
-    0xF3, 0xC9, 0xDE, 0xE3, 0x15, 0x12, 0x7F, 0x3E, 0x6F, 0xF0, 0x27, 0xE7, 0x1C, 0x25, 0xD8, 0x7D,
-    0x36, 0x42, 0x64, 0xFB, 0x03, 0xF1, 0x52, 0x92, 0xF9, 0x08, 0x7A, 0x9F, 0x4B, 0xB9, 0xDE, 0xC4,
-    0x46, 0x90, 0xF7, 0xB0, 0xA1, 0xA5, 0x45, 0xBB, 0xA3, 0x71, 0x79, 0xDB, 0x75, 0x24, 0xA9, 0x9B,
-    0x4E, 0x0D, 0x10, 0x64, 0x58, 0x69, 0xA3, 0x21, 0x33, 0x61, 0x13, 0xCC, 0xCB, 0xF3, 0xE7, 0xBF,
-    0x26, 0xAA, 0xCE, 0xEC, 0xEF, 0x67, 0x67, 0xCB, 0x42, 0xFE, 0xF8, 0x02, 0xE7, 0xEE, 0x5B, 0x79,
-    0x50, 0x22, 0x8D, 0x8C, 0xFC, 0xDD, 0xA1, 0x13, 0x41, 0xDE, 0x2C, 0x80, 0xDB, 0x0C, 0xB9, 0x3C,
-    0x82, 0x89, 0xBF, 0xB3, 0x3D, 0x8D, 0xA4, 0x2D, 0x4D, 0xA3, 0x21, 0x9E, 0xDE, 0xBA, 0x80, 0xDE,
-    0xF6, 0x33, 0xDB, 0x4E, 0x7A, 0x45, 0x63, 0x0A, 0x49, 0x18, 0xA2, 0x19, 0xD8, 0x22, 0x42, 0x1E,
-    0x7B, 0xA2, 0x7E, 0xE0, 0x0A, 0xF0, 0x29, 0xC0, 0xE9, 0xF6, 0x1D, 0x4E, 0x6E, 0xE1, 0x71, 0x8E,
-    0x5D, 0x87, 0x95, 0x0E, 0x5A, 0x0D, 0xCC, 0x2B, 0xA8, 0x0B, 0x56, 0x50, 0x81, 0xF8, 0x2E, 0x66,
-    0xBE, 0x35, 0x9A, 0xDC, 0xB8, 0x27, 0x13, 0x0C, 0x54, 0xE2, 0x06, 0xD0, 0x61, 0xC9, 0x7C, 0x8C,
-    0xFE, 0x08, 0x5C, 0x84, 0xD8, 0x66, 0x31, 0xE4, 0xF8, 0x02, 0x50, 0x40, 0xC0, 0x9E, 0xFD, 0x12,
-    0x6A, 0xE4, 0x9D, 0x63, 0xA2, 0x4D, 0x62, 0xE6, 0xE6, 0xF8, 0x3F, 0xE3, 0xA5, 0x39, 0x4E, 0xED,
-    0xB0, 0x88, 0x80, 0x8B, 0x2C, 0xB3, 0x11, 0x04, 0x13, 0xF6, 0x09, 0xE7, 0xBF, 0x38, 0x16, 0x06,
-    0x93, 0x59, 0x37, 0x40, 0xAF, 0x17, 0x08, 0x4D, 0x07, 0x67, 0xF6, 0x1E, 0xAC, 0x4E, 0x1E, 0xAE,
-    0xBF, 0xC6, 0x75, 0xBE, 0x8D, 0x19, 0x41, 0x53, 0xB7, 0x76, 0xF4, 0x18, 0xBE, 0x0B, 0xFE, 0x61,
-    0xDD, 0x06, 0x6D, 0x3F, 0xF4, 0xA1, 0x36, 0x3E, 0x7D, 0xC6, 0x21, 0xB7, 0x58, 0x2E, 0x4E, 0xEF,
-    0x8A, 0xC0, 0x5D, 0xC3, 0x8D, 0x49, 0x28, 0x9B, 0x63, 0x30, 0x05, 0x26, 0x40, 0xB8, 0xA8, 0x5A,
-    0x08, 0xEE, 0xFC, 0xE3, 0x92, 0x24, 0xBD, 0x15, 0x31, 0xC5, 0xCE, 0x8B, 0x39, 0xAE, 0x0C, 0xA6,
-    0xC6, 0xAF, 0x51, 0x77, 0x93, 0x59, 0x8A, 0xC9, 0x9F, 0x7E, 0xC2, 0x11, 0x16, 0x7A, 0x7E, 0x5C,
-    0xAC, 0xD7, 0x3E, 0x99, 0xAB, 0x6B, 0x6B, 0xAB, 0xB5, 0x27, 0x57, 0x49, 0x5F, 0x11, 0x9F, 0xC2,
-    0x77, 0x33, 0x19, 0x63, 0x92, 0xF1, 0xBF, 0x58, 0xA5, 0xB4, 0x73, 0x9C, 0x92, 0xE4, 0xB8, 0xC1,
-    0x30, 0x3C, 0x94, 0x2F, 0xC4, 0x1F, 0xF8, 0x3B, 0x6B, 0x77, 0xA7, 0x5B, 0xF2, 0x0D, 0xA8, 0x50,
-    0x43, 0x64, 0x90, 0x9E, 0xA3, 0x23, 0xE3, 0x97, 0xF6, 0xF4, 0x83, 0xAB, 0xC6, 0x73, 0xE6, 0x59,
-    0xAE, 0xD7, 0x23, 0xD4, 0x63, 0x23, 0xDC, 0xB8, 0x76, 0xC9, 0x9C, 0x85, 0xCC, 0xA7, 0x1A, 0xA7,
-    0xDA, 0x27, 0xCC, 0x43, 0x58, 0x9E, 0x0D, 0x85, 0xB4, 0x2B, 0x99, 0x5A, 0xCB, 0xCD, 0x60, 0x89,
-    0x2E, 0xD6, 0x5E, 0xBE, 0xC7, 0xE2, 0xB9, 0x89, 0x5D, 0x94, 0xCB, 0x87, 0x97, 0xC2, 0x21, 0x13,
-    0x5F, 0x05, 0x36, 0x77, 0x73, 0x8F, 0x82, 0x31, 0xEA, 0x09, 0x60, 0x12, 0x1E, 0x8F, 0x27, 0xB5,
-    0x2A, 0xD4, 0x15, 0xA7, 0x93, 0x95, 0x46, 0x2B, 0x9F, 0x6D, 0xD9, 0xF9, 0xEF, 0x6D, 0xF2, 0x6B,
-    0xD6, 0xDA, 0x34, 0xD7, 0x7E, 0x63, 0x54, 0x66, 0x5F, 0xEE, 0x95, 0x75, 0x6B, 0x34, 0xFC, 0x6A,
-    0x63, 0x8E, 0x47, 0x84, 0x28, 0xD7, 0x54, 0x99, 0x89, 0xC7, 0xC0, 0xE9, 0x6A, 0x05, 0xCB, 0xAC,
-    0x15, 0x31, 0x38, 0x4A, 0xF4, 0x68, 0xFD, 0x0F, 0x2D, 0x91, 0xBF, 0x6A, 0xDB, 0x50, 0x14, 0xC6,
-    0x7F, 0xBA, 0xAA, 0x7D, 0xD3, 0x58, 0xC2, 0x19, 0x34, 0x04, 0x52, 0xC7, 0x09, 0x78, 0x70, 0x8B,
-    0x5C, 0x94, 0x92, 0x12, 0x0F, 0x29, 0xD6, 0x0B, 0x04, 0x3C, 0x76, 0xF4, 0xD4, 0xA5, 0x83, 0x35,
-    0x74, 0x75, 0x2D, 0xE8, 0xD6, 0x0C, 0x15, 0xB4, 0x63, 0x07, 0xCF, 0x99, 0xF2, 0x00, 0x01, 0x5F,
-    0x6A, 0xDC, 0x2E, 0x25, 0x88, 0xE4, 0x05, 0x04, 0x09, 0x09, 0x14, 0x0A, 0x1A, 0xBA, 0xA4, 0xC4,
-    0x55, 0x8F, 0xD4, 0x9E, 0x7B, 0xE1, 0x9E, 0x7B, 0xCE, 0xF9, 0xBE, 0xF3, 0x8F, 0x21, 0x36, 0xEC,
-    0xA3, 0x4C, 0xCB, 0x1D, 0x67, 0x45, 0xA2, 0x0D, 0x72, 0x6D, 0x53, 0x5A, 0x4B, 0xA9, 0xC1, 0x8A,
-    0xED, 0x9F, 0xEA, 0x9B, 0xDF, 0xEF, 0xF6, 0x49, 0xD1, 0xD0, 0x45, 0xDE, 0xD2, 0xBD, 0x03, 0x33,
-    0xD1, 0x1F, 0x63, 0xC6, 0x37, 0xC6, 0x9A, 0xC7, 0xB4, 0xB1, 0x32, 0xB6, 0x2B, 0x2B, 0x58, 0x15,
-    0x87, 0x5B, 0xC5, 0x47, 0xA4, 0x26, 0xBD, 0xFA, 0xC0, 0x3C, 0x67, 0x0A, 0x9D, 0x7F, 0xD4, 0x1D,
-    0xF1, 0xD7, 0x61, 0x13, 0xF3, 0x2A, 0x4C, 0x9E, 0xDC, 0x6D, 0xDD, 0xEA, 0x6B, 0xAC, 0xB3, 0x3E,
-    0xE8, 0x30, 0xC3, 0x4A, 0x55, 0x95, 0x60, 0x47, 0x00, 0x27, 0xD9, 0xE5, 0x11, 0x86, 0x91, 0x20,
-    0x1C, 0xC4, 0x6C, 0x44, 0x11, 0xA0, 0x69, 0x05, 0xC9, 0x8F, 0x53, 0x9D, 0x13, 0xC0, 0x6B, 0xFD,
-    0x3B, 0x7C, 0x8B, 0x7E, 0x41, 0x34, 0xD1, 0x9C, 0x05, 0x24, 0xFA, 0x13, 0xB5, 0xB9, 0x11, 0x70,
-    0xE3, 0xB3, 0xCA, 0xA2, 0x89, 0xF5, 0x25, 0xD4, 0xC2, 0xB5, 0x8F, 0xFF, 0xD0, 0x75, 0x1A, 0x8E,
-    0xFD, 0x52, 0x5D, 0x93, 0x17, 0x79, 0x6D, 0x86, 0x47, 0x3F, 0x8E, 0x92, 0x6C, 0x64, 0x9E, 0xC5,
-    0x07, 0x3C, 0xA5, 0xBD, 0x5A, 0x1F, 0x4A, 0x6D, 0xCA, 0x94, 0x4D, 0x4A, 0xDD, 0x0C, 0x8A, 0x95,
-    0x0F, 0x76, 0x5C, 0x6A, 0xF7, 0x32, 0x17, 0x0E, 0xA5, 0x35, 0x89, 0x78, 0x10, 0xE2, 0x76, 0x69,
-    0x37, 0xC3, 0xDE, 0xE2, 0x4D, 0x6F, 0xF7, 0xD8, 0xF7, 0x92, 0x74, 0x2D, 0xC0, 0x7E, 0x84, 0xF5,
-    0x1E, 0x3E, 0x42, 0x60, 0x70, 0x46, 0x12, 0xB7, 0x01, 0x82, 0x97, 0xB1, 0x91, 0x09, 0x41, 0xC5,
-    0xAC, 0x2E, 0x8A, 0xA2, 0x9A, 0x71, 0x99, 0x45, 0x2C, 0x6B, 0xF0, 0x0E, 0xBC, 0x04, 0xB5, 0x09,
-    0x0B, 0xE9, 0xD9, 0xAC, 0xD7, 0x3B, 0x9D, 0xFC, 0x6B, 0xAB, 0x11, 0x9D, 0x33, 0x19, 0xA0, 0x8F,
-    0x61, 0x97, 0xFF, 0xB2, 0x21, 0x20, 0xBF, 0x5A, 0x44, 0x54, 0x51, 0x16, 0xF7, 0x65, 0x79, 0x8B,
-    0x18, 0x95, 0xCA, 0xC7, 0xD8, 0x72, 0x38, 0x94, 0x98, 0xB2, 0x46, 0x59, 0x84, 0xFE, 0xC5, 0xF3,
-    0x3F, 0xF6, 0xB2, 0x3B, 0xF0, 0xAC, 0xEF, 0x43, 0xF6, 0x42, 0x96, 0xD8, 0x1E, 0xCE, 0x50, 0xEF,
-    0x85, 0xCD, 0x25, 0x4D, 0x6F, 0xE6, 0x4E, 0xE3, 0x76, 0x2A, 0x3B, 0xFA, 0x0B, 0x4D, 0x92, 0xB1,
-    0x6E, 0x13, 0x41, 0x10, 0x86, 0xBF, 0xBB, 0x45, 0x39, 0xD9, 0x87, 0x7D, 0x14, 0x44, 0x02, 0x61,
-    0xC7, 0x29, 0x52, 0x50, 0xD8, 0x5C, 0x0A, 0x0A, 0x17, 0x4E, 0x7C, 0x11, 0x2F, 0x90, 0x9A, 0x47,
-    0x40, 0x42, 0x72, 0x61, 0x24, 0x0A, 0x24, 0xEF, 0x23, 0xA4, 0xA1, 0xA7, 0xA6, 0xB1, 0x0B, 0x17,
-    0x29, 0x48, 0xBC, 0xCA, 0x13, 0x2C, 0x6F, 0xB0, 0x48, 0x69, 0x10, 0xCD, 0x59, 0x72, 0x61, 0x82,
-    0xE3, 0x65, 0xEE, 0x7C, 0x11, 0x8C, 0xF4, 0xDF, 0xCE, 0xCD, 0xCC, 0xFE, 0xFF, 0xCC, 0xDC, 0x81,
-    0x58, 0xAC, 0x61, 0x06, 0x2D, 0xA8, 0x13, 0xA8, 0xAC, 0xB3, 0x34, 0x07, 0x75, 0xDB, 0x24, 0x8F,
-    0xE8, 0x87, 0xA6, 0xC5, 0xE5, 0x7B, 0x3A, 0x5B, 0x82, 0x7B, 0x2A, 0x4B, 0x57, 0x5F, 0xB8, 0x9E,
-    0xE6, 0x6C, 0x82, 0x15, 0xDF, 0xD8, 0xF2, 0x89, 0x5F, 0xA6, 0xC7, 0x0F, 0x97, 0xE0, 0x3E, 0x46,
-    0xDA, 0xF5, 0x42, 0x2B, 0xEE, 0xDC, 0xC5, 0x7A, 0xE8, 0x62, 0x1B, 0xDF, 0x4D, 0x5D, 0xE8, 0x7D,
-    0x1E, 0x14, 0xF8, 0xEE, 0x2F, 0xF8, 0x67, 0x27, 0x42, 0xA5, 0x39, 0x70, 0x24, 0x03, 0x92, 0x84,
-    0xF8, 0x8D, 0x8D, 0xF4, 0xA5, 0x32, 0x1D, 0x65, 0xA3, 0x1B, 0xC7, 0xF2, 0xEE, 0xEB, 0xD5, 0xC2,
-    0x7B, 0x62, 0xC1, 0xBC, 0xC7, 0x20, 0xA6, 0xA9, 0x74, 0x94, 0xD9, 0xD0, 0x8C, 0xC8, 0xBB, 0xF4,
-    0x9B, 0xB4, 0x55, 0x16, 0x07, 0x46, 0x99, 0x19, 0xAE, 0xCF, 0x51, 0x9D, 0x24, 0x34, 0x45, 0x72,
-    0xDC, 0x94, 0x4A, 0xF1, 0x66, 0x8C, 0xDA, 0x34, 0x94, 0x56, 0x3A, 0x67, 0xD6, 0xA5, 0x17, 0x65,
-    0xA9, 0xDF, 0x84, 0x7E, 0x5D, 0x87, 0xC7, 0xE5, 0xB0, 0x47, 0x70, 0x4C, 0xA0, 0x79, 0x89, 0xD2,
-    0x8C, 0x89, 0x7C, 0x9E, 0x7A, 0x5D, 0x34, 0xB6, 0x3F, 0xDC, 0x16, 0x47, 0x22, 0x13, 0x77, 0xE5,
-    0x1C, 0x0B, 0x1C, 0x84, 0x06, 0x22, 0xC9, 0x27, 0xF2, 0xFA, 0x4A, 0x30, 0x80, 0xF3, 0x15, 0x2C,
-    0x73, 0x58, 0x58, 0x98, 0x48, 0x7A, 0x98, 0x49, 0xD9, 0x7D, 0x47, 0x9F, 0x5E, 0xFD, 0x39, 0x33,
-    0x27, 0x7B, 0x0D, 0xDC, 0xB3, 0x63, 0x95, 0x59, 0x3B, 0x99, 0x2A, 0x3F, 0xCD, 0xA3, 0xF5, 0x69,
-    0xB9, 0x6D, 0xBB, 0xE3, 0x29, 0x38, 0x4B, 0x7E, 0xA5, 0x2B, 0x91, 0x82, 0x39, 0xB0, 0xFF, 0x47,
-    0xE7, 0x0F, 0x51, 0xB7, 0x13, 0x2C, 0x2F, 0x9E, 0x89, 0xE2, 0x44, 0x3A, 0x54, 0x5E, 0x24, 0xEB,
-    0xE5, 0x46, 0xF3, 0xD8, 0x0C, 0xAB, 0xAD, 0x2A, 0x93, 0xB2, 0x29, 0x9C, 0x70, 0x5D, 0x4B, 0x1A,
-    0xAD, 0x9A, 0x5A, 0x95, 0x9A, 0x87, 0x83, 0xD7, 0xB3, 0xC3, 0x8E, 0xD9, 0xD5, 0x64, 0xE5, 0xF0,
-    0x35, 0xA9, 0x11, 0xBA, 0x0F, 0xC8, 0x5E, 0x82, 0x48, 0xC2, 0x22, 0xDD, 0x7F, 0x2A, 0x1F, 0xCA,
-    0x16, 0xA3, 0x8E, 0xA0, 0x5D, 0x75, 0xF1, 0x60, 0xF2, 0x9F, 0x84, 0x42, 0xBD, 0xC8, 0x48, 0x2D,
-    0xC1, 0x5A, 0xB2, 0x5B, 0x61, 0x5A, 0xFC, 0x86, 0x3D, 0x2F, 0xE9, 0xE7, 0x3C, 0x91, 0xA7, 0xFF,
-    0x79, 0x4E, 0xF0, 0x2E, 0xA7, 0x6A, 0x36, 0xAD, 0x30, 0x14, 0x4C, 0x08, 0x16, 0xF6, 0x85, 0xBF,
-    0x48, 0xE4, 0xC6, 0x6D, 0x51, 0xF0, 0x88, 0xB7, 0xDE, 0x5D, 0x7F, 0x86, 0xBF,
+static const uint8_t opendyslexic_8_italicBitmaps[16797] = {
+    0xAD, 0x98, 0x4F, 0x88, 0x5C, 0xC9, 0x7D, 0xC7, 0x3F, 0x55, 0x65, 0xA9, 0xBC, 0xF3, 0xA4, 0x2E,
+    0x05, 0xB4, 0x89, 0x36, 0x3B, 0x33, 0xCF, 0x07, 0x1D, 0x26, 0xCB, 0xCC, 0x3C, 0x05, 0x86, 0xD0,
+    0x21, 0xAF, 0xFB, 0xD5, 0xAE, 0x20, 0x39, 0x2C, 0x4E, 0x36, 0xB0, 0x8B, 0x31, 0x39, 0x58, 0x07,
+    0x43, 0x4C, 0x6C, 0x90, 0x0E, 0x73, 0x18, 0x87, 0x96, 0xBA, 0x76, 0x97, 0x64, 0x21, 0x09, 0xEC,
+    0x1C, 0x12, 0x1F, 0x02, 0x21, 0x82, 0x2C, 0xC4, 0xD1, 0x12, 0xD4, 0x84, 0x49, 0xD2, 0x0E, 0xB3,
+    0xEA, 0x92, 0x74, 0x48, 0x8C, 0x0C, 0x2E, 0xE3, 0x60, 0x1F, 0x72, 0xD8, 0xF2, 0x5A, 0x8E, 0xF1,
+    0x2E, 0x09, 0xE5, 0xF8, 0x05, 0xB7, 0xA4, 0x9E, 0xAE, 0x1C, 0x7A, 0x46, 0x92, 0xE3, 0xFF, 0x6B,
+    0x17, 0xF4, 0x6B, 0xBA, 0xFA, 0xF7, 0x7E, 0xF5, 0xFB, 0xFF, 0xFB, 0xFE, 0x0A, 0x81, 0xF0, 0x8C,
+    0xE8, 0xB2, 0x42, 0x81, 0xF2, 0x22, 0x30, 0xA2, 0x66, 0x95, 0xC2, 0x62, 0x85, 0xA5, 0xE5, 0x2D,
+    0x1A, 0x38, 0xFD, 0xA4, 0xF9, 0x9D, 0xDB, 0xEF, 0xA4, 0xE9, 0xA0, 0x32, 0xC7, 0x5F, 0xD9, 0x85,
+    0xB0, 0x05, 0x5A, 0x78, 0xA8, 0x0D, 0x10, 0xB6, 0x28, 0x72, 0xCE, 0xE9, 0xC9, 0xB7, 0x3E, 0xF6,
+    0x12, 0x22, 0x6C, 0x83, 0x51, 0x1E, 0x76, 0x3A, 0xF0, 0x91, 0x6F, 0x7C, 0xEE, 0xC5, 0x22, 0xE7,
+    0x1C, 0x19, 0xAF, 0x82, 0xF2, 0x09, 0x4A, 0xE5, 0xE1, 0xC5, 0x0F, 0x00, 0xF0, 0x0B, 0x20, 0xFF,
+    0x0C, 0xCA, 0xB9, 0x55, 0xF9, 0x80, 0xE6, 0xF3, 0x88, 0xFB, 0x5B, 0x98, 0x6D, 0x4F, 0xF3, 0x55,
+    0x18, 0x1E, 0x40, 0x95, 0x2D, 0x7F, 0x93, 0x51, 0xBF, 0x7D, 0x20, 0x4E, 0x0C, 0x53, 0x93, 0xF3,
+    0x6B, 0x39, 0xB7, 0x4F, 0xE7, 0x7B, 0xF0, 0xAB, 0x1E, 0xFE, 0x08, 0x00, 0x0B, 0x5B, 0x3A, 0x3E,
+    0x21, 0x5F, 0x95, 0xEE, 0xDC, 0xB9, 0x0B, 0xEA, 0xF8, 0x19, 0x9A, 0x7F, 0x85, 0x17, 0xA6, 0xD0,
+    0xBD, 0x84, 0x51, 0xA8, 0x78, 0x81, 0x7F, 0xFE, 0x14, 0xEB, 0x95, 0x95, 0x2C, 0x96, 0x98, 0xC3,
+    0xFF, 0x0E, 0x58, 0x51, 0x5E, 0xFA, 0x31, 0xAB, 0x7D, 0x98, 0x58, 0xCA, 0x40, 0xF1, 0x36, 0xCF,
+    0xB6, 0xF5, 0x46, 0xC3, 0x77, 0x6F, 0x47, 0x9D, 0x9A, 0xCF, 0xCC, 0x45, 0x9E, 0x8F, 0x8E, 0xCF,
+    0x2D, 0xC0, 0x8B, 0xFB, 0x83, 0xBA, 0x8F, 0x72, 0xD2, 0x0B, 0x4F, 0x20, 0x71, 0x89, 0x2E, 0xCB,
+    0x74, 0xD0, 0x56, 0x7A, 0x22, 0x5D, 0x56, 0xD0, 0x08, 0xCF, 0x25, 0x96, 0xD1, 0x56, 0x04, 0xBA,
+    0x18, 0x84, 0xE5, 0x12, 0xD2, 0xD3, 0x81, 0xAD, 0xC3, 0xEF, 0x6D, 0x94, 0x63, 0x19, 0x22, 0x05,
+    0x5C, 0x42, 0x59, 0xBA, 0x28, 0xF7, 0x3D, 0x0F, 0xED, 0xD8, 0xE6, 0x18, 0x9C, 0xE2, 0x8C, 0xFC,
+    0x7C, 0xB7, 0x8A, 0xB2, 0x2D, 0x7E, 0xFF, 0xD6, 0x1A, 0x4F, 0xC0, 0x87, 0x58, 0xA6, 0x40, 0xB9,
+    0x61, 0xE6, 0x12, 0xEB, 0x74, 0x00, 0x84, 0x9D, 0x95, 0xCF, 0xA5, 0xDE, 0x71, 0xF7, 0xCC, 0xB5,
+    0x32, 0xFB, 0xA5, 0xD5, 0x3E, 0x20, 0x01, 0x65, 0x41, 0x7A, 0x20, 0x00, 0x57, 0x81, 0x73, 0x40,
+    0x17, 0x58, 0x06, 0x3A, 0x40, 0xF1, 0xFF, 0x89, 0x12, 0xB0, 0xFD, 0x83, 0x88, 0x1C, 0x28, 0x0F,
+    0xE2, 0x71, 0xA2, 0x2D, 0x8E, 0xD6, 0x71, 0xCB, 0xD6, 0x39, 0xC2, 0x9A, 0xF2, 0x6B, 0xFA, 0xC3,
+    0x6B, 0xC5, 0x4A, 0xD7, 0x2C, 0x6F, 0x77, 0x48, 0xAB, 0x22, 0x96, 0x3A, 0x94, 0xD9, 0x99, 0x8C,
+    0x9C, 0x02, 0x5C, 0xE1, 0xBF, 0x58, 0xA6, 0xA6, 0xCB, 0x36, 0x89, 0x24, 0xE2, 0x2F, 0x7D, 0x63,
+    0x38, 0x9F, 0x1C, 0x70, 0x0C, 0x91, 0xA3, 0xDC, 0xDD, 0x83, 0x2D, 0xD8, 0x86, 0x84, 0x0A, 0x94,
+    0x8E, 0x1B, 0x14, 0x2D, 0xD5, 0x37, 0x6C, 0x93, 0xDD, 0x30, 0x5B, 0x26, 0x81, 0xDD, 0x6D, 0x58,
+    0x83, 0xB3, 0x70, 0x8E, 0x5F, 0x0C, 0x64, 0x8B, 0xF4, 0x88, 0x80, 0xF4, 0x4F, 0x5D, 0x74, 0x4D,
+    0xA6, 0x6A, 0x01, 0x4B, 0x17, 0x63, 0x55, 0xE2, 0xBB, 0xD4, 0x23, 0xD3, 0x51, 0x5F, 0xBA, 0x3B,
+    0xCC, 0x37, 0x3F, 0xF2, 0xEF, 0x0C, 0x28, 0x1C, 0x53, 0x00, 0x95, 0xC3, 0x32, 0x04, 0x14, 0x94,
+    0x53, 0x5E, 0x1A, 0xC0, 0x1E, 0x32, 0x50, 0xCA, 0xF7, 0x5A, 0x93, 0x5D, 0x75, 0x17, 0x78, 0x91,
+    0x72, 0xC6, 0x1E, 0xC2, 0xA3, 0x2C, 0xC5, 0xC4, 0x9B, 0x2F, 0x45, 0x43, 0x5A, 0x21, 0xAD, 0x88,
+    0x58, 0x16, 0xDE, 0x64, 0x2B, 0xA7, 0x40, 0x95, 0xBD, 0x88, 0x6C, 0x53, 0xB3, 0x82, 0xA1, 0x70,
+    0xCA, 0xCB, 0x44, 0xCB, 0x3E, 0x57, 0x80, 0xA5, 0x5D, 0xF6, 0xD6, 0x08, 0xCB, 0xD2, 0xAF, 0x4B,
+    0xBF, 0xCD, 0x83, 0xC8, 0xC4, 0xE9, 0x97, 0x63, 0x87, 0xB4, 0x4E, 0xEA, 0xC9, 0x50, 0x5D, 0x77,
+    0xC5, 0x01, 0x0C, 0xAD, 0x79, 0xDE, 0x8E, 0x3A, 0xCA, 0xD6, 0xCB, 0xC4, 0x91, 0x7E, 0x39, 0x5C,
+    0x56, 0x39, 0x89, 0xBF, 0xF5, 0xAC, 0x08, 0x91, 0xAA, 0x6C, 0x27, 0x11, 0x52, 0xE1, 0x9B, 0x43,
+    0x73, 0x2B, 0x5F, 0x31, 0x83, 0x56, 0x1F, 0xED, 0x9C, 0x56, 0xA9, 0x64, 0xAC, 0xFD, 0x93, 0xC0,
+    0x25, 0xC4, 0x0C, 0xDD, 0x52, 0x46, 0x1A, 0x87, 0xB9, 0x0B, 0x93, 0x29, 0x5C, 0x9C, 0x42, 0xE5,
+    0xE0, 0x14, 0x30, 0x39, 0x38, 0x66, 0x01, 0x9E, 0x94, 0x39, 0x01, 0xD2, 0xC1, 0x0D, 0x50, 0x53,
+    0x28, 0x23, 0x0C, 0x2D, 0x4F, 0xFB, 0xE3, 0x79, 0x77, 0x32, 0xA5, 0x6F, 0x1F, 0x7A, 0xF8, 0xE2,
+    0xAE, 0x7C, 0xB7, 0x95, 0xEC, 0x40, 0x0D, 0x3B, 0x30, 0x42, 0x44, 0xB4, 0xA7, 0x42, 0x4E, 0x51,
+    0x11, 0xE5, 0xD1, 0x9E, 0xE3, 0x16, 0x60, 0x09, 0x4A, 0x38, 0x12, 0x16, 0x7D, 0x00, 0xE5, 0xEF,
+    0x06, 0x36, 0x38, 0xC1, 0x3A, 0xD2, 0xAE, 0x5C, 0x61, 0xB7, 0xF3, 0x21, 0x7F, 0x56, 0x5F, 0x38,
+    0x77, 0x42, 0x7D, 0x61, 0x6D, 0x89, 0xEF, 0xCC, 0x4B, 0x7A, 0xA7, 0xFB, 0x18, 0x0F, 0xF2, 0xE0,
+    0x98, 0xA5, 0xC9, 0x01, 0x99, 0xA7, 0x70, 0xEC, 0x05, 0xA0, 0x04, 0x95, 0x60, 0x02, 0xAB, 0x23,
+    0xD4, 0x1D, 0xD8, 0xDB, 0x63, 0x55, 0x5B, 0xE5, 0x77, 0x18, 0x6B, 0x57, 0x32, 0x50, 0x39, 0xFB,
+    0x49, 0x9E, 0x95, 0x56, 0xDF, 0x8E, 0x5C, 0x66, 0x32, 0xA5, 0xF7, 0x11, 0xDF, 0x61, 0x4B, 0xDB,
+    0x15, 0xE9, 0x4B, 0xF2, 0x01, 0xFD, 0xEB, 0x7E, 0x85, 0xDA, 0x60, 0x94, 0xD7, 0x37, 0xA3, 0x8E,
+    0x37, 0x26, 0xA9, 0xC9, 0xAD, 0xC9, 0x77, 0x0F, 0xC3, 0xF7, 0x80, 0x22, 0x07, 0xD5, 0xC2, 0x14,
+    0xFA, 0xA0, 0x3D, 0xB4, 0x50, 0x82, 0x4C, 0xD0, 0x2C, 0x6C, 0xD3, 0xCC, 0xF7, 0x65, 0xCE, 0xCE,
+    0xE4, 0x96, 0xE1, 0xFC, 0xA1, 0x5D, 0x64, 0x9E, 0x62, 0xF2, 0x8C, 0x5A, 0x4C, 0x45, 0x10, 0xA9,
+    0x40, 0x85, 0x1A, 0xF3, 0x6C, 0xA4, 0x57, 0x58, 0x52, 0x4D, 0xE1, 0x13, 0x37, 0xF4, 0xBB, 0x93,
+    0x54, 0xE5, 0x6C, 0x73, 0x4E, 0x2A, 0xB7, 0x87, 0x3E, 0xCC, 0x33, 0x26, 0x73, 0x6B, 0x16, 0xF9,
+    0xB4, 0x0A, 0x32, 0x40, 0x33, 0x47, 0xE7, 0xC0, 0x18, 0x0E, 0xF7, 0xAB, 0x9C, 0x54, 0xCE, 0x34,
+    0x39, 0x01, 0x60, 0x72, 0x50, 0xDF, 0x7A, 0x41, 0x06, 0x48, 0x50, 0x43, 0x95, 0x31, 0xD9, 0x2B,
+    0x8F, 0x88, 0xD0, 0x42, 0x0D, 0x25, 0x18, 0x87, 0x0A, 0x00, 0x1F, 0xB5, 0x32, 0x67, 0xE6, 0xF6,
+    0x54, 0x05, 0x3A, 0xC0, 0x3E, 0x18, 0x8B, 0x48, 0x50, 0x32, 0x7C, 0x27, 0x8A, 0x61, 0x83, 0x3A,
+    0x3F, 0x15, 0x6D, 0x95, 0x33, 0x39, 0x27, 0x99, 0xEF, 0xC2, 0x69, 0x4E, 0xB3, 0x43, 0x8F, 0x3D,
+    0x6A, 0x12, 0x03, 0x12, 0x63, 0x19, 0x69, 0x55, 0x10, 0x49, 0x05, 0x99, 0x74, 0xCE, 0xB1, 0xC8,
+    0x39, 0x98, 0x9C, 0x83, 0xB1, 0xC6, 0x57, 0x18, 0xDF, 0x50, 0xBA, 0x3E, 0x95, 0x65, 0xC0, 0x98,
+    0x96, 0x24, 0x92, 0x8C, 0x2A, 0x28, 0xAF, 0x7D, 0xE1, 0x8C, 0x33, 0xB6, 0xA4, 0x39, 0x8A, 0x86,
+    0x4D, 0xE8, 0xC1, 0x00, 0xC6, 0xD0, 0x42, 0x42, 0x26, 0x54, 0x38, 0x8C, 0x9E, 0xC2, 0x61, 0xA0,
+    0x84, 0x3E, 0xEC, 0x53, 0x4E, 0x69, 0x22, 0x7D, 0x0B, 0xAB, 0xDA, 0xCB, 0xD0, 0x52, 0xF7, 0xD0,
+    0xAF, 0x3B, 0xFE, 0x29, 0x61, 0x06, 0x88, 0x0C, 0x55, 0x40, 0xCD, 0x60, 0x98, 0x28, 0x26, 0x96,
+    0x6F, 0xCF, 0x28, 0x4D, 0x52, 0x71, 0x62, 0x7B, 0x6A, 0x06, 0x40, 0x42, 0x3B, 0x36, 0x20, 0xA1,
+    0x3D, 0x9B, 0x90, 0x50, 0x9E, 0x4D, 0x68, 0x51, 0x9E, 0xF2, 0x5A, 0xCA, 0xF9, 0x76, 0x3E, 0xF4,
+    0xA4, 0x4A, 0x5C, 0xA1, 0xB1, 0x26, 0x14, 0xAD, 0x9C, 0x91, 0xDD, 0xD0, 0x77, 0x66, 0x66, 0x5F,
+    0xBE, 0x7D, 0xEB, 0x81, 0xEB, 0xED, 0x0F, 0x5A, 0x75, 0xE7, 0xED, 0xBF, 0xB6, 0x83, 0xE1, 0xFF,
+    0x24, 0xF3, 0xDA, 0x41, 0x43, 0xDB, 0xBC, 0x16, 0xCB, 0xF3, 0xE9, 0x86, 0x4A, 0x3D, 0x13, 0x1A,
+    0xC4, 0xEC, 0x30, 0x8A, 0x9C, 0xF2, 0x2A, 0xC9, 0xC8, 0x8C, 0x96, 0x89, 0xAD, 0x69, 0xE2, 0x26,
+    0xE5, 0xC0, 0xD8, 0xE2, 0x75, 0xE5, 0xD5, 0x97, 0x6F, 0x45, 0x91, 0xDA, 0x96, 0xFD, 0xCD, 0x01,
+    0x7D, 0xFD, 0xDF, 0x94, 0x36, 0xDB, 0xC2, 0x37, 0x5E, 0x25, 0x93, 0x40, 0xCE, 0x2D, 0xD5, 0x9B,
+    0x91, 0x99, 0x68, 0x65, 0x62, 0xAC, 0x3D, 0xFB, 0x85, 0x65, 0xC7, 0xC0, 0xCE, 0x2A, 0xEC, 0x6D,
+    0x40, 0xDA, 0x40, 0xC6, 0x86, 0x22, 0x54, 0xEF, 0x4E, 0x5C, 0x99, 0x33, 0x26, 0xCF, 0x90, 0x79,
+    0x77, 0x71, 0x76, 0x73, 0x0F, 0xF5, 0xEE, 0x94, 0x6D, 0xE5, 0x0B, 0x6A, 0x92, 0x72, 0xAB, 0x22,
+    0xC9, 0x7C, 0x40, 0x33, 0xB7, 0xDA, 0x2F, 0x1C, 0xEF, 0x8E, 0x62, 0x5A, 0xA5, 0xA3, 0xE4, 0x7C,
+    0x09, 0x74, 0xF6, 0xF4, 0x9F, 0x4B, 0xB4, 0x8C, 0x55, 0x60, 0x47, 0x7B, 0x6A, 0xF3, 0xE8, 0xE0,
+    0xB4, 0x81, 0x48, 0x7D, 0x71, 0x3E, 0x34, 0xBF, 0x95, 0x7D, 0xF5, 0xF0, 0xD0, 0x19, 0xC8, 0x39,
+    0x90, 0x17, 0xF5, 0xA1, 0x99, 0xD2, 0x79, 0xD3, 0x6B, 0x46, 0xCA, 0xAD, 0x13, 0x4A, 0x3E, 0x7D,
+    0xD1, 0x36, 0x73, 0x4C, 0xF6, 0xDA, 0xEF, 0xA9, 0xB8, 0x4A, 0x5B, 0xB8, 0x81, 0x8A, 0x8D, 0x98,
+    0x1A, 0x7F, 0x03, 0x98, 0x24, 0xAA, 0xEC, 0xC5, 0x3D, 0x30, 0x16, 0xBA, 0x20, 0x5A, 0x50, 0xD9,
+    0xA2, 0x72, 0x84, 0x8B, 0x11, 0x2A, 0x0F, 0x13, 0xFE, 0xFC, 0xE9, 0x59, 0x91, 0x73, 0x98, 0xE4,
+    0x99, 0x98, 0x2C, 0x3A, 0x70, 0x95, 0xF3, 0xED, 0x9C, 0xA7, 0x47, 0xD9, 0x52, 0x2F, 0x7A, 0xD2,
+    0x78, 0xC1, 0x28, 0x2D, 0x94, 0x8B, 0xD0, 0x5B, 0x64, 0xF0, 0xA1, 0x5B, 0x0A, 0xAF, 0x62, 0x9F,
+    0x92, 0x96, 0x7D, 0xED, 0x55, 0xAC, 0x30, 0x76, 0xCA, 0x40, 0x79, 0x19, 0x4B, 0x8C, 0x1D, 0x53,
+    0xCB, 0x28, 0xA3, 0x09, 0x95, 0x6D, 0xF2, 0x8C, 0x9C, 0x03, 0x93, 0x7B, 0x0F, 0x2B, 0x97, 0xA3,
+    0x1E, 0x50, 0xBC, 0xE6, 0x45, 0x1A, 0xD0, 0x53, 0xBE, 0x70, 0xB5, 0x48, 0x2A, 0xF4, 0xE9, 0x19,
+    0xAF, 0xBE, 0xD6, 0xD2, 0xEF, 0xA3, 0xB2, 0xA7, 0x99, 0xA2, 0x32, 0x34, 0x01, 0x56, 0x81, 0xF1,
+    0x18, 0xD4, 0xAD, 0x08, 0x9B, 0x85, 0x83, 0xB4, 0x49, 0x2A, 0xDC, 0xD4, 0x84, 0x5A, 0xC5, 0x7C,
+    0x3E, 0x9A, 0xE7, 0xE7, 0x25, 0xBD, 0xCB, 0xFB, 0x53, 0x1E, 0x7C, 0xED, 0x81, 0x57, 0x59, 0x1F,
+    0x60, 0xDA, 0x32, 0xD1, 0xB8, 0xC6, 0x32, 0x3B, 0x92, 0x99, 0xC2, 0x2A, 0x4F, 0x52, 0x9E, 0x9E,
+    0x0A, 0xE8, 0x57, 0x03, 0x7C, 0x27, 0x40, 0x13, 0x41, 0x47, 0x90, 0x2D, 0xC8, 0x0C, 0xF2, 0x41,
+    0x40, 0xA6, 0x19, 0x32, 0x55, 0xC8, 0x56, 0x47, 0xD9, 0x32, 0x63, 0x87, 0xCD, 0x9A, 0x41, 0x8F,
+    0xB4, 0xA9, 0x42, 0x65, 0x6C, 0xB9, 0x89, 0x99, 0x61, 0x12, 0x45, 0xA0, 0xF0, 0x18, 0x47, 0x65,
+    0x69, 0x60, 0x02, 0x98, 0x9C, 0x9D, 0xCA, 0xD9, 0xF3, 0xD2, 0xEF, 0x25, 0xD0, 0x09, 0x8A, 0x08,
+    0x26, 0x42, 0x19, 0xA0, 0x0A, 0xD0, 0xF8, 0xC5, 0x67, 0xE8, 0x60, 0x72, 0xFF, 0x1A, 0x4D, 0xCE,
+    0xDE, 0xE4, 0x9C, 0x80, 0x6B, 0x30, 0xF4, 0x6C, 0x80, 0x01, 0xE5, 0x38, 0x2C, 0x4A, 0x5D, 0x1E,
+    0x6D, 0x89, 0x87, 0x5B, 0x2B, 0x8B, 0x2D, 0x8F, 0x08, 0x30, 0x82, 0x1A, 0x56, 0xA0, 0x98, 0xA1,
+    0x0E, 0x40, 0x9C, 0xDC, 0x7A, 0xE7, 0x4F, 0xD6, 0xFF, 0xE1, 0xCE, 0xC6, 0x3F, 0x7E, 0xE5, 0xD4,
+    0x33, 0x8E, 0x66, 0x41, 0x15, 0x21, 0xC1, 0x36, 0x74, 0xA1, 0x86, 0x0D, 0xE8, 0x80, 0x81, 0xC2,
+    0xA2, 0x1C, 0xCA, 0x23, 0x03, 0x62, 0x41, 0x34, 0xE2, 0xB0, 0x2F, 0xAD, 0xA3, 0xE6, 0xC8, 0xBC,
+    0xC4, 0x15, 0xF5, 0x9B, 0xF0, 0xCC, 0xB5, 0xCF, 0x0E, 0xF3, 0x0C, 0xB8, 0x60, 0x48, 0x00, 0x37,
+    0x30, 0xD9, 0x8D, 0x37, 0xB5, 0xDD, 0xEE, 0x4A, 0xEF, 0x8D, 0x66, 0xBF, 0xBC, 0x1E, 0x9B, 0xEC,
+    0x86, 0x7F, 0x05, 0x30, 0xC6, 0x58, 0x12, 0x06, 0x11, 0xD9, 0xCC, 0xEA, 0xDE, 0xA0, 0x2F, 0xBE,
+    0xEC, 0x57, 0x76, 0xE4, 0x1D, 0xBB, 0x33, 0xBF, 0x68, 0xB2, 0x6F, 0xE2, 0xC2, 0x35, 0x95, 0xBF,
+    0x72, 0x61, 0xD1, 0xEB, 0x95, 0x23, 0xD2, 0xC3, 0xCC, 0x99, 0x78, 0x16, 0x48, 0x4A, 0x78, 0x18,
+    0xC1, 0x16, 0x2C, 0xF3, 0xF4, 0x1D, 0xAA, 0x07, 0x6E, 0xA3, 0x08, 0x2B, 0x22, 0x15, 0xEC, 0x28,
+    0xB7, 0x41, 0x2C, 0x69, 0x26, 0xDE, 0xE4, 0xC4, 0x64, 0x67, 0xD1, 0x56, 0x6D, 0x71, 0xDE, 0x8E,
+    0x8E, 0xEB, 0xBF, 0x9C, 0x55, 0xF3, 0xDD, 0x80, 0x72, 0x98, 0xDD, 0x17, 0xAA, 0x6C, 0xCB, 0x29,
+    0x80, 0x09, 0x05, 0xCA, 0x0A, 0xAF, 0xB2, 0xBD, 0x6C, 0x3B, 0x68, 0xAB, 0x3C, 0x89, 0x1D, 0x36,
+    0x30, 0x40, 0xF5, 0x61, 0xF1, 0x60, 0xA6, 0xDC, 0x4C, 0x33, 0xED, 0xD0, 0x9E, 0x20, 0x9D, 0x50,
+    0xD1, 0x5C, 0x0F, 0x26, 0x7B, 0xF9, 0xC0, 0x61, 0xEC, 0xA9, 0x21, 0xC3, 0x19, 0xC3, 0x84, 0x00,
+    0xD6, 0xA1, 0x0B, 0xE7, 0x60, 0x04, 0x11, 0xBE, 0xB2, 0x2B, 0x73, 0xAB, 0xDA, 0x1D, 0xE5, 0xBB,
+    0xDA, 0x6E, 0x19, 0x2E, 0x19, 0x46, 0xAB, 0xA4, 0x9E, 0x88, 0xB5, 0x0C, 0x9C, 0x95, 0xD1, 0x58,
+    0x40, 0xB0, 0x4E, 0x54, 0x76, 0x99, 0xAB, 0xCA, 0xAD, 0x90, 0x94, 0x07, 0x6A, 0x64, 0x62, 0xC9,
+    0x1D, 0x96, 0x4D, 0xC7, 0x0A, 0x8C, 0x50, 0x8E, 0x93, 0x2C, 0x70, 0xEE, 0x49, 0x38, 0x77, 0x88,
+    0x73, 0x47, 0x5C, 0x74, 0x6A, 0x7A, 0x84, 0x59, 0x2C, 0x23, 0x0C, 0x04, 0xD6, 0xD7, 0xD4, 0x17,
+    0xF9, 0x0D, 0xAF, 0x13, 0x99, 0xCE, 0x54, 0x7C, 0x35, 0xD4, 0x8D, 0xBA, 0x39, 0xE3, 0x94, 0x08,
+    0x05, 0xDD, 0x87, 0x8F, 0x5A, 0xC4, 0x82, 0xC6, 0x67, 0xF8, 0x66, 0xBA, 0x42, 0x73, 0x7D, 0x12,
+    0x2A, 0x95, 0xBA, 0x86, 0xBD, 0x93, 0xDA, 0xD5, 0xEA, 0xB9, 0xB0, 0x22, 0x7D, 0x2A, 0x48, 0x3B,
+    0xCA, 0x77, 0x37, 0x64, 0xD8, 0x30, 0x24, 0x63, 0x11, 0x56, 0x67, 0x5F, 0x69, 0x9B, 0x56, 0xB4,
+    0xDB, 0x5E, 0x57, 0x3E, 0x19, 0xED, 0x77, 0x36, 0x65, 0x6C, 0x8D, 0x65, 0x62, 0xCD, 0x9B, 0x36,
+    0x75, 0x34, 0xEB, 0x35, 0x31, 0xAA, 0x57, 0xDD, 0xBA, 0x79, 0x33, 0x56, 0x73, 0xAA, 0x00, 0xA7,
+    0xDF, 0x42, 0xCD, 0xF7, 0x68, 0xA4, 0x53, 0x7E, 0x9D, 0x1D, 0xE9, 0x0A, 0xBB, 0xC5, 0x54, 0x53,
+    0xFE, 0x67, 0x94, 0x79, 0xC6, 0xAF, 0xCF, 0x29, 0x16, 0x15, 0x66, 0x63, 0x51, 0x72, 0x00, 0x78,
+    0xEA, 0xB4, 0xCC, 0x83, 0xE2, 0xB9, 0x76, 0x45, 0xA4, 0x75, 0x19, 0xB7, 0x54, 0xD8, 0x2A, 0x7C,
+    0x6F, 0xE8, 0xAA, 0x6C, 0x8B, 0x6F, 0x42, 0xE7, 0x14, 0x26, 0x52, 0x3A, 0x4E, 0x01, 0xFC, 0x5A,
+    0x2C, 0xA7, 0xC6, 0x29, 0x2F, 0x22, 0x2D, 0x35, 0x15, 0xC6, 0x43, 0x15, 0xD5, 0x5F, 0xB0, 0x06,
+    0x23, 0xC4, 0x01, 0xE2, 0x06, 0xD4, 0xE2, 0x33, 0xA9, 0xCA, 0x6E, 0x38, 0x05, 0x18, 0x11, 0x65,
+    0xA8, 0xE6, 0xCA, 0x69, 0x6B, 0x30, 0xAC, 0xB0, 0x49, 0x13, 0x9B, 0xD8, 0x61, 0xD4, 0x55, 0x3E,
+    0x74, 0x34, 0xDB, 0xEB, 0xD2, 0x27, 0xA3, 0xFC, 0xD8, 0xE4, 0xD8, 0x64, 0x3B, 0xFC, 0x14, 0x20,
+    0xBD, 0xFA, 0x53, 0xD6, 0x57, 0x84, 0xEF, 0x76, 0x48, 0x49, 0xDD, 0xA1, 0x68, 0xA9, 0x3C, 0x37,
+    0x00, 0xA8, 0x51, 0x5F, 0x44, 0x7C, 0xDD, 0xBB, 0x94, 0xA6, 0x3B, 0x75, 0xAE, 0x4D, 0x3E, 0x50,
+    0xF3, 0xCC, 0x41, 0x63, 0xFB, 0x85, 0x87, 0x9D, 0x02, 0x53, 0x58, 0xF9, 0x1F, 0x96, 0xA1, 0xC5,
+    0x38, 0x8A, 0x48, 0xB1, 0x4F, 0xF1, 0xBA, 0x2D, 0x5E, 0x49, 0x85, 0xEB, 0x21, 0xBD, 0x61, 0x5B,
+    0xDB, 0x8E, 0xF2, 0xEA, 0x66, 0x20, 0x25, 0x36, 0xF7, 0xD0, 0x33, 0x98, 0x43, 0x03, 0xC6, 0xA1,
+    0x3D, 0x45, 0x60, 0x18, 0xA8, 0x0E, 0xC3, 0x63, 0x78, 0xC0, 0x1F, 0xBC, 0x75, 0xD4, 0x6F, 0x61,
+    0x1F, 0x99, 0x30, 0x9E, 0x2A, 0xFB, 0x26, 0x7B, 0x40, 0xCE, 0xD8, 0x59, 0x24, 0xDC, 0x06, 0xCA,
+    0xAB, 0xC4, 0x00, 0x22, 0xAB, 0xC8, 0x40, 0x8D, 0xF2, 0x34, 0x8E, 0x37, 0xE0, 0x92, 0x74, 0x27,
+    0x39, 0x27, 0xDC, 0x49, 0xCE, 0x09, 0xBF, 0xC4, 0x39, 0xFC, 0x12, 0x5B, 0xF8, 0xA3, 0x6C, 0xA4,
+    0xA5, 0xC6, 0xA0, 0xAD, 0x0C, 0x5C, 0xA1, 0xB4, 0x1D, 0x0C, 0xCA, 0xC9, 0x40, 0x2A, 0x5A, 0xB9,
+    0xCB, 0xCA, 0x07, 0xBF, 0xF0, 0x99, 0x12, 0xF8, 0x90, 0x20, 0xAE, 0x6B, 0x1B, 0xD7, 0xB5, 0xED,
+    0x15, 0xAE, 0x54, 0x41, 0x13, 0x04, 0xD6, 0x9E, 0x16, 0xA1, 0x2B, 0xE2, 0x06, 0xA3, 0x15, 0x15,
+    0xC6, 0x9B, 0xDA, 0xA7, 0x65, 0xC1, 0x29, 0x38, 0x0B, 0x22, 0x42, 0xE1, 0x8E, 0x7A, 0x81, 0x58,
+    0x74, 0xCD, 0x22, 0x21, 0xDE, 0x83, 0x7A, 0x44, 0xF1, 0xBC, 0x15, 0x71, 0x9B, 0x5A, 0xBB, 0xC2,
+    0xED, 0x88, 0xA4, 0x7D, 0x93, 0x67, 0x45, 0xCE, 0x37, 0x5B, 0x06, 0x7D, 0x74, 0x58, 0xCC, 0x47,
+    0xD2, 0x2D, 0xE6, 0xA8, 0x47, 0x40, 0xFA, 0x68, 0x95, 0xC0, 0x0C, 0x8A, 0x04, 0x7F, 0xE8, 0x51,
+    0x77, 0x60, 0x63, 0x03, 0x11, 0xB7, 0x31, 0x22, 0x32, 0xD6, 0x4E, 0xFB, 0x92, 0x26, 0xCF, 0x64,
+    0xCE, 0xA9, 0xB4, 0xDA, 0x4F, 0x29, 0x0F, 0x79, 0xEC, 0x80, 0xFA, 0x2C, 0x9C, 0x3D, 0xB3, 0xF8,
+    0x39, 0x58, 0x34, 0xF4, 0xCA, 0x23, 0xDE, 0x03, 0xB3, 0x0E, 0x7B, 0x7B, 0xE8, 0x97, 0x03, 0xB5,
+    0x76, 0x32, 0xAE, 0x52, 0x32, 0x20, 0xE7, 0x54, 0xE4, 0xEC, 0x2F, 0x53, 0xAA, 0xC8, 0x65, 0xA0,
+    0xDE, 0x80, 0x71, 0x0F, 0xDE, 0xF8, 0xC4, 0xF7, 0x0A, 0xD4, 0x00, 0x13, 0x10, 0xEF, 0x81, 0xBA,
+    0x03, 0xC5, 0xF3, 0x96, 0x55, 0x6D, 0xA9, 0xB5, 0x63, 0xAC, 0x9D, 0x48, 0xDA, 0xAB, 0x9C, 0x7D,
+    0x91, 0xB3, 0x2F, 0xAD, 0xF6, 0x87, 0x6A, 0xFE, 0xF4, 0xF8, 0xB9, 0x9A, 0xC3, 0x29, 0x10, 0x2F,
+    0xC0, 0x71, 0xD0, 0x0E, 0x84, 0x5D, 0xCC, 0x9A, 0x83, 0x23, 0x69, 0xDE, 0x17, 0x3C, 0x86, 0xB3,
+    0xA0, 0x0F, 0xA7, 0xD4, 0xC7, 0x57, 0x93, 0x7D, 0x91, 0xEF, 0x92, 0xC0, 0x2C, 0xFC, 0xBA, 0x01,
+    0x2A, 0x47, 0x86, 0x07, 0x14, 0x8E, 0xC3, 0x7D, 0xB9, 0xE0, 0xA4, 0x72, 0x06, 0x22, 0x94, 0x0E,
+    0x75, 0x1C, 0xF8, 0xC0, 0x4F, 0xFF, 0xBA, 0x70, 0x57, 0xA9, 0x37, 0x29, 0x6E, 0xC7, 0xF7, 0xAD,
+    0x8E, 0x65, 0x05, 0x79, 0xA4, 0x87, 0xF6, 0x72, 0x51, 0x38, 0x4A, 0x0A, 0xA7, 0x02, 0x89, 0x01,
+    0x9B, 0x18, 0xA7, 0x82, 0x48, 0xCC, 0x8E, 0xC0, 0xF5, 0x49, 0xA4, 0xE3, 0xD2, 0xF7, 0x28, 0xAE,
+    0xFD, 0x51, 0x5F, 0x2B, 0x91, 0x91, 0x1E, 0xCA, 0x1F, 0x0D, 0xC1, 0xC6, 0x8A, 0x44, 0x83, 0x4A,
+    0xB0, 0x45, 0x11, 0xC4, 0x2D, 0xF7, 0x53, 0xBC, 0x71, 0xF5, 0xE3, 0xFA, 0x76, 0x68, 0x4A, 0xFB,
+    0xD8, 0x39, 0x9B, 0x8F, 0x12, 0x7D, 0x8C, 0x0A, 0x18, 0x18, 0x20, 0x23, 0xC6, 0xD1, 0x43, 0x24,
+    0x8C, 0x5F, 0xC8, 0xB9, 0x71, 0x06, 0x96, 0xFF, 0x0D, 0x9E, 0x58, 0x5D, 0xBC, 0xFA, 0xCB, 0x18,
+    0x8C, 0xD7, 0x4E, 0x27, 0x15, 0xE4, 0x01, 0x89, 0xEC, 0xC6, 0x5C, 0x4E, 0x3D, 0x36, 0x6B, 0x83,
+    0xF9, 0x9D, 0xC2, 0xE9, 0xDB, 0x5F, 0x0E, 0x32, 0x7D, 0x2E, 0x31, 0x2D, 0xC7, 0x5C, 0x56, 0x07,
+    0x54, 0x64, 0x8C, 0x6F, 0x8E, 0xEA, 0xF0, 0x08, 0xE8, 0x01, 0xE2, 0x70, 0x22, 0xFB, 0x19, 0xA1,
+    0xF4, 0x62, 0xF9, 0xC5, 0x9D, 0x47, 0xF1, 0x7D, 0x79, 0xFB, 0xB3, 0xF3, 0xDF, 0x02, 0xDE, 0x02,
+    0xF1, 0x8A, 0xFB, 0xF9, 0xF0, 0xBB, 0xFA, 0x71, 0x44, 0x6C, 0x51, 0x5F, 0x4B, 0x3F, 0x37, 0x19,
+    0x85, 0x07, 0x15, 0x40, 0x3C, 0x2C, 0x7F, 0xEF, 0x1F, 0x45, 0x8B, 0xC3, 0x12, 0x18, 0x1E, 0x7A,
+    0xE8, 0x31, 0x5B, 0x26, 0xA6, 0xC6, 0x69, 0xDF, 0xA3, 0x12, 0x89, 0x69, 0xE1, 0x55, 0xE8, 0x53,
+    0x92, 0x18, 0x6B, 0xAF, 0xC2, 0x26, 0x86, 0x31, 0x63, 0xD5, 0x16, 0xC1, 0xE4, 0x4C, 0x93, 0x5B,
+    0xAA, 0xF9, 0x63, 0x95, 0x54, 0x79, 0xD8, 0xF4, 0x08, 0xBF, 0x7B, 0x24, 0x61, 0x43, 0x69, 0x7F,
+    0xB0, 0x84, 0x3B, 0x3F, 0x5C, 0x42, 0xE9, 0x23, 0xA6, 0x70, 0x7C, 0xE2, 0x57, 0x1E, 0x57, 0xF6,
+    0x7D, 0xB1, 0x3A, 0x0D, 0x5D, 0xD8, 0x01, 0xA8, 0x9C, 0xCA, 0x71, 0xB3, 0x78, 0x39, 0xAC, 0x74,
+    0x18, 0x9D, 0x53, 0x37, 0x7D, 0xA5, 0xDF, 0x9B, 0x9A, 0x1C, 0xCB, 0x6F, 0x2E, 0x34, 0x08, 0x2C,
+    0xF1, 0x58, 0xB2, 0x16, 0x91, 0x3C, 0x2D, 0x5E, 0x89, 0xDB, 0xFA, 0xBC, 0x5B, 0x3F, 0x41, 0xBA,
+    0x54, 0xDC, 0xBC, 0x3F, 0x57, 0x79, 0xAA, 0xEF, 0x05, 0x94, 0x43, 0x47, 0x4E, 0x9C, 0x59, 0xB0,
+    0x25, 0x4F, 0x65, 0x1C, 0x6B, 0xBB, 0xDD, 0x61, 0x74, 0x82, 0xB4, 0x2C, 0x53, 0x79, 0x3D, 0x9A,
+    0x1C, 0xF5, 0xBD, 0xC0, 0xDA, 0x13, 0x0C, 0x36, 0xD8, 0xEF, 0xFD, 0x78, 0xCA, 0x1F, 0x86, 0x63,
+    0x3F, 0x08, 0x8E, 0x73, 0xB4, 0x70, 0x0A, 0xF6, 0x60, 0xEF, 0xD1, 0x1D, 0x5F, 0xCB, 0xDE, 0x56,
+    0xC1, 0x85, 0x4F, 0x5F, 0xBF, 0x95, 0xBF, 0x75, 0x12, 0xBA, 0x70, 0xEF, 0x98, 0xCC, 0xAD, 0xC8,
+    0xEE, 0x30, 0x63, 0x96, 0x16, 0xB9, 0xF8, 0xD8, 0x12, 0x6F, 0xB1, 0x71, 0x52, 0xFA, 0x33, 0xAB,
+    0x9F, 0x4C, 0x93, 0xFB, 0xE7, 0x2D, 0x1D, 0xE8, 0x3F, 0x6B, 0x27, 0x07, 0x0C, 0x23, 0x9C, 0x84,
+    0xB7, 0xD0, 0x4B, 0x3F, 0x01, 0xE5, 0xDA, 0x53, 0x0C, 0x7A, 0x4C, 0x2F, 0x3F, 0x62, 0x7C, 0xD1,
+    0xCA, 0x10, 0x0A, 0x2E, 0xAC, 0x7E, 0x32, 0x55, 0xF3, 0xDD, 0x2D, 0xE8, 0x42, 0xFF, 0x59, 0x5B,
+    0x65, 0xAB, 0xE7, 0x1C, 0xC7, 0xB0, 0x04, 0x50, 0xD0, 0x25, 0x68, 0xD6, 0x88, 0xDA, 0xD6, 0x24,
+    0x10, 0x48, 0x27, 0x3C, 0x8F, 0xDA, 0x83, 0xF0, 0x5C, 0x65, 0xEB, 0xF0, 0x4A, 0x55, 0x04, 0x12,
+    0x35, 0x48, 0xC7, 0x94, 0x2F, 0x39, 0x10, 0x9E, 0xF8, 0x7D, 0xFF, 0x1A, 0xFD, 0xDA, 0xED, 0x77,
+    0xAE, 0xBE, 0x01, 0xC0, 0x25, 0xBA, 0x9C, 0x44, 0x23, 0x3D, 0x8B, 0x2B, 0x40, 0x03, 0xA8, 0xDB,
+    0xA8, 0x8F, 0x3A, 0x6E, 0xFB, 0xC5, 0xD5, 0x2C, 0xC3, 0x19, 0x95, 0xB6, 0x46, 0x04, 0xED, 0xB6,
+    0xA5, 0xAF, 0x49, 0x86, 0x81, 0x76, 0x9B, 0x32, 0x1A, 0xFB, 0x03, 0xCC, 0x5C, 0xB4, 0xDC, 0xDF,
+    0x33, 0xC4, 0x4B, 0xF2, 0xB6, 0xEF, 0x74, 0xE8, 0x76, 0xA5, 0xBF, 0x7F, 0x43, 0xE6, 0x28, 0x0F,
+    0x8E, 0x0A, 0xD3, 0xC9, 0xEF, 0x33, 0xB3, 0x3C, 0xA0, 0xFF, 0xF7, 0xCA, 0x77, 0x97, 0x19, 0x25,
+    0xF5, 0xAA, 0xEB, 0x74, 0x18, 0xF5, 0xAF, 0xBB, 0xC9, 0x94, 0x89, 0x3D, 0x34, 0xF3, 0xF1, 0xA5,
+    0x9F, 0x80, 0x72, 0xED, 0x29, 0x76, 0x7A, 0x4C, 0x07, 0x8F, 0x18, 0x4F, 0xAC, 0x7A, 0x37, 0x18,
+    0xE2, 0x32, 0xA3, 0x9A, 0xD8, 0x25, 0x76, 0xA5, 0xEF, 0x5F, 0x77, 0xD5, 0x9C, 0xA2, 0x05, 0x10,
+    0x01, 0x19, 0x16, 0xE8, 0xA6, 0x2B, 0x7D, 0x34, 0xCA, 0x76, 0x97, 0x45, 0x18, 0x15, 0xCA, 0xD7,
+    0x46, 0xC6, 0x26, 0xBB, 0x7C, 0x20, 0x0E, 0x46, 0x47, 0xF8, 0x7F, 0x0D, 0xE1, 0x1F, 0x93, 0xFA,
+    0x47, 0x22, 0xD9, 0x2D, 0xE4, 0x94, 0xE5, 0x33, 0x3F, 0x8E, 0xEC, 0xEA, 0x59, 0x7D, 0x2B, 0x54,
+    0x66, 0x91, 0x52, 0x3F, 0x52, 0x04, 0x99, 0x3F, 0x99, 0x83, 0xBC, 0x3F, 0xC9, 0x33, 0x66, 0x62,
+    0x0A, 0xD5, 0x21, 0x62, 0x9D, 0x41, 0x8B, 0x71, 0x18, 0x64, 0x4E, 0x22, 0xD2, 0xCC, 0xD9, 0x40,
+    0x25, 0x64, 0xE0, 0x0A, 0x34, 0x14, 0x01, 0x99, 0xF3, 0x0C, 0xCA, 0x9C, 0x73, 0x22, 0xE7, 0x9C,
+    0x11, 0x79, 0x72, 0x84, 0x38, 0x8A, 0xBB, 0x65, 0x50, 0xEF, 0xBE, 0x7D, 0xDE, 0x26, 0xE3, 0xCF,
+    0x2C, 0xF3, 0x2F, 0x93, 0x57, 0xBD, 0x99, 0xBF, 0xD1, 0x25, 0xA2, 0xDC, 0x26, 0xF4, 0xAF, 0xDF,
+    0x3B, 0x26, 0xF3, 0x7B, 0x39, 0x14, 0x77, 0xCB, 0xE9, 0xA3, 0x89, 0xF4, 0x99, 0x6B, 0xD7, 0xFE,
+    0xEE, 0x63, 0x39, 0xE7, 0xB8, 0xB8, 0xBC, 0x8D, 0x15, 0x6D, 0xE1, 0xD7, 0x0A, 0x3F, 0x2D, 0x55,
+    0xFC, 0x04, 0xA7, 0x4F, 0xAB, 0xAF, 0xC7, 0xAA, 0xA2, 0x4D, 0xC5, 0x1D, 0xBF, 0xB6, 0x26, 0x9E,
+    0xB5, 0xFB, 0x33, 0xF3, 0xFA, 0xB3, 0xDF, 0x4E, 0xBD, 0xDE, 0xF1, 0x3F, 0x76, 0x4B, 0x5C, 0x3D,
+    0xB3, 0x2A, 0x63, 0xDD, 0x57, 0x61, 0xFF, 0xFF, 0x00, 0x8D, 0x95, 0x4F, 0x8C, 0x64, 0x45, 0x1D,
+    0xC7, 0x3F, 0xAF, 0x4A, 0xB7, 0x94, 0xB7, 0xDD, 0xE5, 0x61, 0x49, 0xD6, 0xD0, 0x33, 0xCF, 0x83,
+    0x87, 0x49, 0x7C, 0x33, 0x3D, 0x87, 0x36, 0x69, 0xE3, 0xEB, 0x79, 0x05, 0x93, 0xB0, 0x87, 0x35,
+    0x81, 0x03, 0x9C, 0xBC, 0x70, 0xF0, 0x68, 0xC2, 0x1C, 0x3A, 0x61, 0x12, 0x06, 0xBA, 0x96, 0x39,
+    0x70, 0x30, 0x91, 0xB9, 0xE8, 0xC1, 0x04, 0x33, 0x47, 0x03, 0x08, 0x4F, 0xEC, 0x98, 0x89, 0x0E,
+    0xDB, 0x35, 0xBB, 0x07, 0x0E, 0x24, 0x52, 0x62, 0x08, 0x27, 0x43, 0x41, 0x44, 0x12, 0x36, 0x81,
+    0x42, 0x9E, 0x49, 0xAF, 0xF4, 0x74, 0x79, 0x98, 0x19, 0xA2, 0xD1, 0xA8, 0xF7, 0xDF, 0xEF, 0xF3,
+    0xAB, 0xDF, 0x9F, 0xEF, 0xB7, 0xB8, 0xFA, 0x15, 0x86, 0x3D, 0x00, 0x10, 0x69, 0x21, 0xDF, 0x7E,
+    0x44, 0x5A, 0x94, 0x21, 0x07, 0x9D, 0x42, 0xF7, 0x51, 0xD3, 0x83, 0x12, 0xB6, 0x5E, 0x30, 0x93,
+    0x64, 0x67, 0xC9, 0x40, 0x01, 0x32, 0xC2, 0x0C, 0x56, 0x1B, 0xE4, 0x1B, 0x30, 0x9D, 0xB2, 0xAA,
+    0x8C, 0x74, 0xBB, 0x1C, 0x29, 0x5B, 0xB0, 0x27, 0x53, 0x72, 0xB3, 0xB4, 0x28, 0x8C, 0xBA, 0x1D,
+    0x78, 0x0A, 0x10, 0xE9, 0x54, 0x3A, 0xA4, 0x43, 0x5A, 0x94, 0x25, 0x4F, 0x56, 0xE3, 0xBB, 0x1C,
+    0xAE, 0x10, 0x36, 0xBE, 0xEF, 0xEA, 0x64, 0xEA, 0xBB, 0x67, 0x0F, 0x20, 0x4F, 0xB6, 0x92, 0x26,
+    0x7C, 0x55, 0x99, 0x41, 0xA9, 0x6C, 0x9A, 0xCB, 0x9F, 0x4C, 0x7B, 0x34, 0x8D, 0xBC, 0xFD, 0xF6,
+    0xCD, 0x22, 0xC5, 0xD9, 0x29, 0x40, 0x96, 0x96, 0xE2, 0xED, 0x47, 0xBE, 0xA0, 0x69, 0x83, 0x86,
+    0x02, 0x36, 0x60, 0x04, 0x15, 0x1C, 0x03, 0x79, 0x72, 0x7C, 0xB0, 0x47, 0x4F, 0x5A, 0xE1, 0xC6,
+    0x0C, 0x73, 0x94, 0x89, 0x34, 0x5D, 0xBA, 0x99, 0x17, 0xBE, 0xE4, 0x48, 0xBA, 0x3A, 0x25, 0x99,
+    0x92, 0x1F, 0x52, 0x09, 0x23, 0xCC, 0xFF, 0xD5, 0xFA, 0x96, 0x6A, 0x37, 0x50, 0x27, 0x8B, 0x02,
+    0xDA, 0x9B, 0x05, 0xF4, 0xFB, 0x0F, 0x19, 0xE4, 0x9B, 0x6F, 0x1A, 0xF8, 0xFC, 0x8E, 0x85, 0x22,
+    0x39, 0x90, 0xC9, 0x41, 0x96, 0x22, 0x64, 0x69, 0x09, 0x59, 0x4A, 0x8E, 0x6C, 0x99, 0x16, 0x88,
+    0xD3, 0xE5, 0xC4, 0x88, 0xD3, 0xFA, 0xB9, 0x28, 0x96, 0xC5, 0x7B, 0x09, 0xEE, 0x45, 0x27, 0xF3,
+    0x35, 0x0D, 0x25, 0x84, 0xEC, 0x71, 0xEA, 0x40, 0x16, 0x10, 0x8E, 0xEE, 0x3D, 0x0F, 0xC6, 0x3A,
+    0x99, 0xD9, 0x9F, 0xCF, 0xA7, 0x82, 0x08, 0xD9, 0xA1, 0x36, 0x85, 0xAD, 0x38, 0xCD, 0x82, 0x8E,
+    0xB9, 0x99, 0xB9, 0x2A, 0x7F, 0x39, 0x8B, 0x7B, 0x6D, 0xBE, 0xFF, 0xBA, 0x1B, 0x8D, 0xFA, 0x7C,
+    0xE6, 0xE7, 0xEA, 0x63, 0xE5, 0xEB, 0x58, 0x93, 0x58, 0xA8, 0x98, 0x7B, 0x10, 0x3C, 0x4C, 0x57,
+    0x41, 0xBF, 0x85, 0xAF, 0x9F, 0x73, 0x78, 0x58, 0x1B, 0x6D, 0x2B, 0x4E, 0xB3, 0x78, 0xCE, 0x51,
+    0x1F, 0xFF, 0x33, 0xE7, 0xAF, 0xE1, 0xDF, 0x39, 0xAB, 0xCA, 0x09, 0xDF, 0x52, 0x8D, 0x50, 0xCF,
+    0x59, 0x7E, 0x13, 0xD1, 0x7B, 0x64, 0x09, 0xFA, 0x1E, 0xB9, 0x80, 0x49, 0x24, 0x9F, 0x19, 0x3E,
+    0x5D, 0x50, 0xE8, 0x28, 0xC3, 0xCC, 0x8C, 0xE4, 0x02, 0x74, 0x72, 0xEA, 0xA3, 0x20, 0xFD, 0x94,
+    0x58, 0xB1, 0xAB, 0x59, 0x57, 0x46, 0x4B, 0xA7, 0x6C, 0x14, 0x6E, 0x97, 0xB8, 0xCE, 0x91, 0x66,
+    0xA1, 0xDC, 0x15, 0x20, 0x6B, 0x99, 0xE7, 0x21, 0xF7, 0xDF, 0xB5, 0x4F, 0xF2, 0xAE, 0x7C, 0x49,
+    0x55, 0x65, 0xA8, 0x3E, 0x7D, 0xC7, 0xBC, 0xFF, 0x6E, 0xA9, 0xAE, 0xC7, 0xB8, 0xDE, 0x7F, 0xD6,
+    0xC6, 0xBD, 0x75, 0xE9, 0x88, 0x1B, 0x48, 0xC7, 0x15, 0xAE, 0xB0, 0xCB, 0x88, 0x29, 0x15, 0x91,
+    0x3D, 0x22, 0x47, 0x22, 0xD0, 0x4A, 0x9F, 0x45, 0xE9, 0x45, 0x54, 0x29, 0x85, 0x3C, 0x25, 0xAF,
+    0x53, 0xF2, 0xDA, 0x68, 0xD7, 0x47, 0xBB, 0x9A, 0xC2, 0x6E, 0xD1, 0x37, 0x88, 0xA5, 0xA1, 0xFF,
+    0x62, 0x60, 0x91, 0xB5, 0x22, 0x72, 0xA4, 0x1C, 0xC7, 0xB9, 0x61, 0x57, 0xC3, 0xEE, 0x2A, 0x4C,
+    0xD7, 0x21, 0xAE, 0x23, 0x42, 0x4D, 0xEE, 0xFB, 0x1F, 0xCD, 0x6C, 0x91, 0x12, 0x3A, 0x2D, 0x10,
+    0xE9, 0xE0, 0x62, 0x11, 0xCC, 0x92, 0x1B, 0x3D, 0x1A, 0xBA, 0x8C, 0x95, 0x29, 0x85, 0xD3, 0x44,
+    0x69, 0x87, 0x99, 0x5F, 0xA1, 0xC9, 0xA9, 0xA4, 0x5B, 0xCD, 0x42, 0x6E, 0xA6, 0xD2, 0x41, 0x7D,
+    0x17, 0xF9, 0xD1, 0x9C, 0xB1, 0x74, 0x39, 0x15, 0x51, 0xDA, 0xD5, 0x2C, 0x8A, 0x74, 0x4A, 0xBD,
+    0x34, 0xCA, 0xC1, 0x31, 0x68, 0x0B, 0xED, 0x17, 0x6A, 0xAA, 0x2F, 0x0A, 0x5C, 0x3A, 0x25, 0x4F,
+    0x5E, 0xB6, 0x30, 0x87, 0x2D, 0x50, 0xEE, 0x22, 0x4C, 0x9C, 0x85, 0xC9, 0x39, 0xD4, 0xCB, 0x63,
+    0x91, 0x92, 0xD5, 0xA9, 0x65, 0xB2, 0x04, 0xA0, 0x9F, 0xD2, 0xED, 0x94, 0xE6, 0xAC, 0x82, 0xF0,
+    0x50, 0x81, 0x74, 0x70, 0x04, 0xDA, 0x40, 0x3C, 0x2B, 0x13, 0x60, 0x74, 0x06, 0x5C, 0x00, 0x07,
+    0xC2, 0x0C, 0x85, 0xCB, 0x09, 0x99, 0x6F, 0x18, 0xEE, 0xA2, 0x2B, 0xE4, 0x12, 0x66, 0x50, 0x58,
+    0x94, 0x43, 0x06, 0x54, 0xA4, 0x0E, 0xE8, 0xF3, 0xEE, 0xFB, 0xC9, 0xAF, 0x6A, 0xB9, 0x7D, 0x7F,
+    0x58, 0xDB, 0x59, 0x97, 0xD7, 0xB6, 0x4F, 0xE2, 0x24, 0x9D, 0x66, 0x29, 0x19, 0xA6, 0xA0, 0x81,
+    0x08, 0x1B, 0x20, 0xFD, 0x85, 0x94, 0x8D, 0x74, 0x44, 0xE9, 0x18, 0x49, 0x8F, 0xDA, 0xF7, 0xF0,
+    0x99, 0x87, 0x3A, 0x80, 0x0A, 0x20, 0x5A, 0x10, 0x09, 0xC4, 0xE7, 0x1E, 0x11, 0x17, 0x88, 0xD8,
+    0x47, 0xB4, 0x2A, 0x88, 0x96, 0x05, 0x40, 0xE6, 0x3A, 0xC2, 0xF5, 0xA4, 0x2D, 0x95, 0x19, 0xE6,
+    0x0C, 0x34, 0x4D, 0x97, 0xB8, 0x42, 0x28, 0x33, 0x5F, 0x09, 0x57, 0xA7, 0x38, 0x4B, 0x81, 0xCC,
+    0x21, 0x1D, 0x19, 0x3D, 0xDE, 0xB7, 0x9D, 0x81, 0x78, 0x9D, 0xAA, 0x91, 0x3F, 0xA6, 0x8D, 0xFD,
+    0x3C, 0xC5, 0xFE, 0xCF, 0x11, 0x9E, 0x0A, 0xE9, 0x00, 0xF2, 0x07, 0x6E, 0xB8, 0xAA, 0x9B, 0x13,
+    0xC6, 0x43, 0xF5, 0x80, 0xF3, 0xA5, 0x56, 0xC4, 0x61, 0x29, 0xAD, 0x0F, 0x2B, 0x4A, 0x9A, 0x66,
+    0xAD, 0x27, 0xAD, 0x6F, 0x74, 0x4A, 0x76, 0x92, 0x4E, 0xF9, 0x4F, 0x09, 0xB9, 0x22, 0x0C, 0x4B,
+    0x69, 0x7C, 0xE8, 0xFD, 0x4B, 0x42, 0x9C, 0xA4, 0x64, 0xA1, 0x04, 0x02, 0x08, 0xEA, 0x20, 0x8E,
+    0x11, 0x8E, 0x21, 0xD2, 0x30, 0x69, 0x75, 0xE6, 0x43, 0x67, 0x85, 0xB7, 0x4E, 0x8E, 0xEB, 0xB4,
+    0x9D, 0xEC, 0xD9, 0x64, 0x32, 0x73, 0x19, 0xF6, 0x32, 0x47, 0x6E, 0x4B, 0x68, 0xA5, 0x45, 0x33,
+    0x40, 0x04, 0x95, 0xCC, 0x88, 0xB8, 0x22, 0x5D, 0x17, 0xBF, 0x97, 0xF9, 0x8E, 0xB6, 0xE5, 0x7D,
+    0xAE, 0x95, 0xA9, 0xED, 0x53, 0xCF, 0x65, 0x3C, 0x4B, 0x76, 0xF4, 0xFE, 0x3B, 0x3F, 0x9F, 0x93,
+    0xFF, 0x34, 0x0A, 0x97, 0x9B, 0x1D, 0x86, 0x20, 0xAD, 0x78, 0xE1, 0x88, 0x3A, 0x19, 0x68, 0xA0,
+    0x50, 0x6D, 0xEE, 0x27, 0x69, 0x21, 0x53, 0xE2, 0xBE, 0xA5, 0xB9, 0x38, 0x3A, 0xE9, 0x26, 0x5E,
+    0x3E, 0xE3, 0x1B, 0x75, 0x9D, 0x61, 0xDE, 0x61, 0xA8, 0x4B, 0x86, 0x9D, 0x21, 0x83, 0xA2, 0xA5,
+    0x59, 0x8F, 0x84, 0xE1, 0x54, 0xFA, 0xC1, 0xCD, 0xC7, 0xED, 0xCE, 0x24, 0x71, 0x78, 0x5F, 0x7B,
+    0xDE, 0x46, 0xF2, 0xFC, 0xFD, 0x25, 0xCA, 0xCC, 0x49, 0xB3, 0xC6, 0xAE, 0xB4, 0xEA, 0x83, 0x29,
+    0xFD, 0x84, 0x4A, 0x91, 0xB8, 0x41, 0x25, 0x83, 0x72, 0x23, 0xE6, 0xB9, 0x2B, 0xCC, 0x42, 0x46,
+    0x6D, 0x01, 0x6E, 0xA2, 0x93, 0x3D, 0xDA, 0x50, 0x66, 0x3C, 0x14, 0xCE, 0x69, 0xC5, 0x71, 0xF1,
+    0x4A, 0xA8, 0x93, 0x9D, 0x3C, 0x0F, 0xC0, 0xBD, 0x07, 0xF9, 0x92, 0x16, 0x0D, 0xE3, 0x1F, 0x88,
+    0xB4, 0xD0, 0xBE, 0xAD, 0xC4, 0x7B, 0x21, 0xBF, 0x66, 0xAA, 0xE2, 0x5A, 0xA8, 0x97, 0xF4, 0x0F,
+    0x00, 0xEA, 0x56, 0x65, 0xAE, 0xE9, 0x75, 0x95, 0x49, 0xBE, 0x27, 0xF7, 0xED, 0x70, 0x90, 0x5F,
+    0x4B, 0x71, 0x36, 0x07, 0x98, 0xA4, 0x1C, 0x22, 0x9A, 0x2C, 0xB0, 0x8E, 0x74, 0x54, 0xE4, 0x0E,
+    0x80, 0x62, 0xC1, 0x5A, 0xC5, 0x60, 0xC8, 0xCE, 0x98, 0xD0, 0x08, 0x17, 0x95, 0x09, 0xFD, 0x17,
+    0xDB, 0x3A, 0xB5, 0x03, 0x9A, 0x6F, 0x60, 0x79, 0xDC, 0xE4, 0xDB, 0xA6, 0xB9, 0xA4, 0x7E, 0xB6,
+    0xE8, 0x2F, 0x0F, 0x3C, 0xD2, 0xA2, 0x0F, 0x1E, 0xEE, 0x27, 0x53, 0xCC, 0xE1, 0xCA, 0x97, 0x31,
+    0xF2, 0x56, 0xBB, 0xCB, 0x7A, 0xBD, 0x0A, 0x9F, 0xBD, 0x63, 0xD1, 0x4F, 0x05, 0x98, 0xCC, 0x41,
+    0x26, 0x20, 0x45, 0x98, 0x24, 0x4B, 0x31, 0x7B, 0x8D, 0xFC, 0xC3, 0x0F, 0xA3, 0x9C, 0x2F, 0x6B,
+    0x9B, 0xFD, 0x22, 0xBB, 0x84, 0xE0, 0xB2, 0x68, 0x29, 0x59, 0xDB, 0x88, 0x7D, 0x0B, 0xF4, 0xB2,
+    0xD8, 0x14, 0xFB, 0x37, 0xFE, 0xD4, 0xE9, 0x6C, 0xEE, 0xBC, 0x7F, 0xEB, 0xF7, 0xDD, 0x6E, 0x18,
+    0x4C, 0xC4, 0xAD, 0xA8, 0x01, 0xF8, 0xDC, 0x70, 0x08, 0x28, 0xF6, 0x4A, 0x15, 0xC2, 0x13, 0xDB,
+    0xDB, 0xDF, 0xEB, 0x0D, 0x9B, 0x5F, 0xEF, 0xEF, 0x1F, 0x75, 0x0A, 0xD7, 0x1C, 0x4B, 0xC7, 0xC1,
+    0xA1, 0x7A, 0x88, 0x32, 0xF2, 0x09, 0x79, 0xA4, 0x36, 0x59, 0x22, 0xDF, 0x62, 0xF8, 0x9A, 0xF0,
+    0x0B, 0x00, 0xBD, 0xE0, 0x2D, 0xDB, 0x1B, 0xC8, 0x7D, 0x36, 0x1B, 0xD5, 0xC5, 0xFB, 0xAA, 0x07,
+    0x64, 0x07, 0xC2, 0x1E, 0x8B, 0x58, 0x67, 0xF3, 0xC2, 0x9D, 0xE6, 0xD3, 0xDF, 0xC9, 0x5F, 0x3E,
+    0x71, 0xF2, 0xCE, 0x71, 0xFC, 0xD5, 0xE2, 0xA8, 0xDA, 0x1A, 0x15, 0x5A, 0x5F, 0xB7, 0xB9, 0xE3,
+    0x20, 0xB3, 0x63, 0x42, 0xC9, 0x58, 0x53, 0x2A, 0xAB, 0x85, 0x57, 0x36, 0x25, 0x3F, 0x49, 0x71,
+    0xE3, 0xD1, 0x63, 0x6D, 0xB6, 0x94, 0xD3, 0x06, 0x28, 0x42, 0xFE, 0xEC, 0x0D, 0xDF, 0x1B, 0x66,
+    0xAF, 0x9B, 0x72, 0x47, 0xBE, 0xC1, 0xF4, 0xE6, 0x4C, 0x26, 0x57, 0x84, 0xB3, 0x83, 0x28, 0x52,
+    0x6C, 0xE4, 0xBE, 0x5B, 0xE9, 0xD2, 0x8C, 0xE5, 0x2D, 0xD7, 0xD5, 0x4C, 0x77, 0xE5, 0x2D, 0xAF,
+    0xE1, 0xCA, 0x6B, 0xC8, 0xE5, 0x94, 0x5A, 0x58, 0xE9, 0x4A, 0x76, 0x85, 0xCD, 0xCD, 0x80, 0xB9,
+    0xA2, 0xF8, 0x4B, 0x10, 0x69, 0xC1, 0x77, 0x96, 0xE4, 0x67, 0x36, 0xB5, 0xCE, 0xB9, 0x60, 0xCF,
+    0x1C, 0xC7, 0x3D, 0xFD, 0x58, 0xC5, 0x0A, 0x1A, 0x69, 0x09, 0x8C, 0xD0, 0x4B, 0x66, 0x0E, 0x26,
+    0xE9, 0x0F, 0x9D, 0x2F, 0x65, 0x9E, 0x12, 0xE9, 0x18, 0x92, 0x1B, 0x22, 0x1A, 0x84, 0xD3, 0x8C,
+    0x95, 0xE9, 0x4A, 0x27, 0x4F, 0x3C, 0x31, 0xB2, 0x31, 0x45, 0x2D, 0x60, 0x09, 0x35, 0x68, 0x8B,
+    0x72, 0xE4, 0x9E, 0x89, 0xA7, 0x7F, 0xAE, 0x44, 0x69, 0xE8, 0x27, 0xDF, 0x7D, 0x48, 0x49, 0x1B,
+    0xD7, 0x36, 0x57, 0xE5, 0x83, 0xC2, 0x0F, 0x9A, 0x4A, 0xE7, 0x77, 0xEE, 0x84, 0x49, 0x5A, 0x64,
+    0x69, 0x79, 0xE1, 0x9D, 0x22, 0xC0, 0x95, 0xB3, 0x2F, 0xD4, 0x95, 0xF8, 0x86, 0x57, 0x1D, 0x4F,
+    0x1A, 0x46, 0xB0, 0x44, 0xBE, 0x8B, 0xBE, 0x6E, 0x47, 0xD2, 0x01, 0x2B, 0xF8, 0x46, 0x49, 0x57,
+    0x76, 0x09, 0x63, 0xF9, 0x80, 0xEB, 0xDD, 0x43, 0xB3, 0xF5, 0x62, 0x48, 0xC9, 0x50, 0xC2, 0xD9,
+    0x98, 0xAE, 0x5E, 0xFE, 0xE6, 0xE5, 0xCD, 0xB5, 0xCD, 0xC1, 0xB7, 0x63, 0xBF, 0xE1, 0x10, 0x0F,
+    0x30, 0xEE, 0x75, 0x72, 0x79, 0xE2, 0xE2, 0xB0, 0xEC, 0xAA, 0xED, 0x1B, 0xBE, 0x19, 0x94, 0xB9,
+    0x92, 0xD6, 0x37, 0x5B, 0xAF, 0xBC, 0xAC, 0x52, 0xFA, 0x1F, 0x21, 0xAF, 0x3C, 0x9B, 0xD2, 0xFC,
+    0xCC, 0x82, 0x03, 0xAC, 0x50, 0xDB, 0x4B, 0x53, 0x14, 0xCC, 0x42, 0x57, 0x58, 0xDF, 0xEB, 0xC9,
+    0x5B, 0x77, 0xDA, 0xFA, 0x2E, 0x90, 0x81, 0x19, 0xD3, 0xC9, 0xC9, 0x5C, 0xA4, 0xD4, 0x77, 0xE5,
+    0x0D, 0xBF, 0x36, 0xEE, 0x89, 0x1F, 0x09, 0x37, 0x8C, 0x5B, 0xB3, 0xAE, 0x4C, 0x37, 0x3C, 0x80,
+    0x20, 0x73, 0x34, 0x0C, 0xD1, 0xA7, 0x8A, 0xB7, 0xDC, 0x5A, 0x58, 0x79, 0x7A, 0xD6, 0x5F, 0x9E,
+    0x6F, 0x24, 0xDC, 0x23, 0x1C, 0x5D, 0x08, 0x7A, 0x89, 0x38, 0xE1, 0xA8, 0x5E, 0x8A, 0xA5, 0x01,
+    0xE4, 0xFD, 0xF3, 0xEC, 0xF6, 0x33, 0xEE, 0x55, 0xBB, 0x39, 0x70, 0x97, 0x2F, 0x1F, 0x2A, 0xD5,
+    0x8A, 0x67, 0x9E, 0xC7, 0xFF, 0xF1, 0x24, 0x6E, 0xA6, 0x78, 0xF5, 0xE2, 0x42, 0xE0, 0xB7, 0xBE,
+    0xA3, 0x78, 0xAC, 0xCC, 0x6C, 0x90, 0xC9, 0x6C, 0xFC, 0x50, 0xF8, 0xB0, 0x22, 0xEF, 0x0F, 0x3D,
+    0x32, 0xB7, 0x79, 0x29, 0xB3, 0xC0, 0xB7, 0xFC, 0x25, 0xE1, 0x76, 0xE4, 0x76, 0x5A, 0xF4, 0x60,
+    0x8A, 0xF8, 0xDB, 0x55, 0x95, 0xA2, 0x5A, 0x02, 0xFC, 0x03, 0xAD, 0x9A, 0x6F, 0x68, 0x64, 0x59,
+    0x7A, 0xDE, 0x7F, 0xE7, 0x9C, 0x96, 0xAE, 0x5A, 0x47, 0xAA, 0x23, 0x96, 0x1E, 0xDC, 0xB3, 0x23,
+    0xE9, 0x2A, 0x46, 0x26, 0x9A, 0x71, 0xB5, 0x4A, 0x38, 0x4A, 0x52, 0x8B, 0x4B, 0xBA, 0x67, 0xBA,
+    0x83, 0x17, 0xB3, 0x31, 0x51, 0xEC, 0xD9, 0x10, 0x27, 0x1F, 0x2C, 0xC2, 0x7E, 0x70, 0xB2, 0xB6,
+    0x5B, 0x04, 0x7D, 0xD0, 0x42, 0xF5, 0xE8, 0xCC, 0x6E, 0x58, 0x42, 0x6C, 0xD8, 0x26, 0x6C, 0x06,
+    0x13, 0x08, 0x11, 0xC9, 0x04, 0x4C, 0x2F, 0xEB, 0xAE, 0x04, 0xC5, 0x54, 0x58, 0x4D, 0xD7, 0x99,
+    0xE9, 0x0F, 0xC1, 0x78, 0xC1, 0x77, 0x32, 0x49, 0x1C, 0x6C, 0x42, 0xCE, 0x3A, 0x43, 0xB2, 0xEE,
+    0x31, 0xF6, 0x59, 0x7C, 0xC9, 0xD6, 0xF4, 0x94, 0xEA, 0xE4, 0xC3, 0x2D, 0xFD, 0x99, 0xDE, 0xD9,
+    0x19, 0xF7, 0xAE, 0x2F, 0x94, 0x2E, 0x94, 0xEE, 0x3D, 0xEF, 0xF9, 0xF3, 0x9E, 0xE7, 0x7D, 0x9E,
+    0xE7, 0x94, 0xD8, 0x31, 0x7E, 0x9B, 0x0A, 0x34, 0x5D, 0x11, 0xB4, 0xED, 0x10, 0x95, 0x5B, 0xA2,
+    0xA7, 0x7C, 0x83, 0x4D, 0x00, 0x10, 0x8E, 0x92, 0x0D, 0x06, 0x62, 0xEC, 0xFE, 0x8C, 0x7D, 0xDF,
+    0xD9, 0x6D, 0x6C, 0xAA, 0x5F, 0xE3, 0x7D, 0x8A, 0xA1, 0x4C, 0x6C, 0x70, 0x6D, 0xF2, 0x94, 0x25,
+    0x4B, 0x56, 0xBE, 0xD3, 0xA4, 0x0D, 0xCA, 0xC2, 0xE6, 0xF9, 0xED, 0xB9, 0x47, 0x56, 0xA5, 0x0A,
+    0xE5, 0xE0, 0x18, 0x5E, 0x87, 0xE2, 0xF1, 0x5D, 0x95, 0x92, 0x93, 0xDC, 0x1D, 0x9C, 0x66, 0x9F,
+    0x76, 0xA1, 0xDD, 0x30, 0x32, 0xC5, 0x6F, 0xFC, 0xE9, 0x8B, 0x2C, 0x00, 0x44, 0xE5, 0x6F, 0x28,
+    0xAF, 0xFE, 0xB3, 0x67, 0xE0, 0x31, 0x1E, 0xF5, 0x5F, 0x29, 0x12, 0xF4, 0x61, 0x0B, 0xF2, 0x1D,
+    0xD2, 0x08, 0x55, 0x42, 0xAC, 0x03, 0xEF, 0x49, 0x37, 0xCF, 0x86, 0x70, 0x00, 0xCC, 0xB2, 0x21,
+    0xFC, 0x2C, 0x9B, 0x78, 0x00, 0x06, 0x96, 0x4F, 0x2D, 0x32, 0x0D, 0xEC, 0x41, 0x6B, 0x88, 0x79,
+    0x35, 0x0A, 0xAF, 0x6C, 0x93, 0x3D, 0x31, 0xBE, 0xCD, 0x74, 0xF2, 0xC8, 0x08, 0xDB, 0x98, 0xE4,
+    0x55, 0x0A, 0x00, 0x5C, 0x9D, 0x35, 0xB7, 0x1E, 0xFE, 0x97, 0x38, 0x7D, 0xF4, 0xEC, 0x95, 0xB5,
+    0x2B, 0xBB, 0x33, 0xBF, 0x7C, 0x6D, 0xE5, 0xEE, 0x14, 0xA0, 0xDD, 0x97, 0xA6, 0xE6, 0x9E, 0x0F,
+    0x2F, 0xDB, 0x17, 0x5E, 0xCA, 0x93, 0x27, 0xB0, 0x4F, 0x93, 0x17, 0xEE, 0xE5, 0xC9, 0xB3, 0x93,
+    0xFD, 0x8D, 0xEB, 0xAF, 0xFC, 0xE5, 0x57, 0xAE, 0xFF, 0xD3, 0xEB, 0x47, 0xD3, 0x16, 0x91, 0xEA,
+    0xD0, 0xB7, 0xED, 0x17, 0xF6, 0x37, 0x1B, 0x4D, 0xF5, 0x99, 0x5B, 0x6F, 0xA4, 0xB2, 0xE5, 0x90,
+    0xB0, 0x06, 0xA5, 0x4C, 0x23, 0xD6, 0xA0, 0x44, 0x00, 0xB4, 0x12, 0xC0, 0x34, 0xBB, 0xD7, 0x9A,
+    0xED, 0xC2, 0x31, 0xC5, 0x0C, 0xEE, 0x48, 0xDA, 0xBD, 0xD7, 0xC9, 0xD4, 0x2D, 0x67, 0x09, 0x9A,
+    0xB6, 0xF2, 0x4B, 0x04, 0xCD, 0xBE, 0xF2, 0x4D, 0x11, 0x0D, 0x27, 0xDA, 0x15, 0x29, 0xE4, 0xA9,
+    0x9A, 0x3F, 0xFC, 0x25, 0x05, 0x58, 0x40, 0x08, 0x8A, 0x59, 0xD2, 0xBC, 0x38, 0x9D, 0x13, 0xA3,
+    0x45, 0x46, 0x6B, 0x1C, 0x6F, 0x12, 0x37, 0x44, 0xDC, 0x53, 0xE5, 0x51, 0xE6, 0x4B, 0xE3, 0x7D,
+    0xFE, 0xA2, 0x2F, 0xA4, 0x33, 0xD9, 0x9B, 0x47, 0x5C, 0x11, 0x3B, 0xD7, 0xFB, 0xCC, 0x4E, 0xCD,
+    0xCC, 0x5D, 0x1F, 0x33, 0x7B, 0xEB, 0x6F, 0xEE, 0xFC, 0xF6, 0xF5, 0xC3, 0x7A, 0x2A, 0x3B, 0x30,
+    0xE5, 0xB0, 0xAB, 0xAC, 0x2A, 0x66, 0xD9, 0x13, 0x6E, 0x96, 0xBD, 0xE9, 0x6F, 0x2F, 0x92, 0x1E,
+    0x4A, 0x28, 0x7B, 0x6C, 0xFE, 0x38, 0x8D, 0xD9, 0x5D, 0xF9, 0xE6, 0x3F, 0xA3, 0x57, 0x54, 0x4D,
+    0x16, 0xA5, 0x95, 0x5E, 0x7A, 0xF8, 0x24, 0x82, 0x55, 0x56, 0xF1, 0xD2, 0x65, 0x2C, 0xB2, 0x26,
+    0xFC, 0xF4, 0xB7, 0x1B, 0xC3, 0x22, 0xFE, 0x8F, 0x35, 0xE6, 0x39, 0x22, 0x28, 0x3B, 0x4B, 0x87,
+    0x9E, 0xF6, 0x9A, 0x21, 0x7B, 0xFA, 0x54, 0xD9, 0x17, 0x8E, 0x50, 0x43, 0x60, 0x05, 0x2B, 0xDC,
+    0x3C, 0x43, 0xEE, 0xB2, 0x39, 0x0B, 0x7E, 0x57, 0xDE, 0xCF, 0xC8, 0xC3, 0xDE, 0x0A, 0xEA, 0xA6,
+    0x67, 0xF3, 0xC7, 0x51, 0x5F, 0xFC, 0x75, 0xDA, 0x6B, 0x47, 0xD2, 0xFF, 0x69, 0xD9, 0x64, 0x11,
+    0x47, 0x04, 0x71, 0x84, 0x76, 0x74, 0x26, 0x59, 0xB7, 0x0E, 0x15, 0xCA, 0x73, 0x88, 0x2E, 0xE9,
+    0x93, 0x39, 0x3A, 0x88, 0x80, 0xB6, 0x2C, 0xE3, 0xB6, 0xEF, 0xD3, 0x2A, 0xEB, 0xC1, 0x2D, 0xCD,
+    0xC0, 0x6F, 0xEF, 0x32, 0x6D, 0x38, 0xBF, 0xBA, 0xA0, 0x22, 0xB4, 0x3C, 0xE2, 0x5D, 0x30, 0x4D,
+    0x38, 0x3E, 0x26, 0x7B, 0xA5, 0xA4, 0x93, 0x39, 0x19, 0x96, 0xC9, 0xE9, 0x92, 0x52, 0xD4, 0x29,
+    0xF9, 0x3B, 0xE4, 0x2A, 0x70, 0x07, 0x90, 0x77, 0xE1, 0xCB, 0x90, 0x39, 0x2E, 0x5D, 0x79, 0xDD,
+    0xD2, 0x00, 0x96, 0x7B, 0xA8, 0xDF, 0x81, 0xE3, 0x63, 0x96, 0x33, 0xAB, 0xFC, 0x01, 0xFD, 0xCC,
+    0xE5, 0x74, 0x55, 0x4A, 0x7E, 0x90, 0x46, 0xB9, 0xCD, 0x1E, 0xD6, 0xCD, 0x00, 0x90, 0xA5, 0xE4,
+    0xA1, 0x48, 0xEF, 0x81, 0x4A, 0x00, 0x37, 0x86, 0x80, 0x7C, 0xBB, 0x04, 0x96, 0x73, 0x80, 0x78,
+    0x78, 0x0A, 0x46, 0xA4, 0x08, 0x95, 0x76, 0xA0, 0xDD, 0x16, 0x70, 0x98, 0x2A, 0x50, 0x29, 0xA5,
+    0x21, 0x5B, 0x14, 0x29, 0xA8, 0x20, 0x52, 0xBA, 0xD4, 0x21, 0x99, 0x86, 0x98, 0x34, 0xA2, 0x23,
+    0x87, 0x22, 0x88, 0xA8, 0xAD, 0x2A, 0x3B, 0x98, 0xBF, 0xF7, 0xD8, 0x6D, 0xA5, 0x31, 0xB1, 0x83,
+    0xF6, 0x91, 0x07, 0xD9, 0xA3, 0x41, 0x6C, 0xA5, 0x64, 0x53, 0x8A, 0x2A, 0x0D, 0x01, 0xF6, 0x57,
+    0xE0, 0x9B, 0xBB, 0x88, 0x87, 0xBE, 0xCE, 0x2B, 0x40, 0x8E, 0x2D, 0xAD, 0xAF, 0x05, 0x46, 0xA2,
+    0x92, 0x91, 0x7E, 0xE6, 0x39, 0xD1, 0x96, 0x03, 0x03, 0x07, 0xCB, 0x70, 0x7C, 0x03, 0xE2, 0x0D,
+    0x64, 0x28, 0xD0, 0x65, 0xEB, 0xD1, 0xC0, 0xE5, 0x29, 0x61, 0xD2, 0x08, 0x99, 0xEE, 0xD6, 0xAF,
+    0x4B, 0xBE, 0x6B, 0x0D, 0x79, 0x58, 0x5F, 0xE7, 0x03, 0x97, 0xF2, 0x1F, 0xB8, 0x95, 0xDF, 0xF7,
+    0xD6, 0xFA, 0x6E, 0x09, 0xF0, 0xE0, 0x7E, 0x00, 0x18, 0xA9, 0x0A, 0xE0, 0x44, 0x8E, 0x01, 0xBA,
+    0xF2, 0x7D, 0x0F, 0xDC, 0x90, 0xDF, 0x09, 0x80, 0x11, 0xF1, 0x00, 0xC8, 0x5E, 0x89, 0x37, 0x00,
+    0xF9, 0x56, 0x34, 0x00, 0xFF, 0xB1, 0xD2, 0x0E, 0x28, 0x2A, 0x5D, 0x02, 0x7A, 0x7C, 0x3F, 0x00,
+    0x22, 0xA5, 0x08, 0x30, 0xB9, 0x3D, 0xAE, 0x7B, 0x3B, 0xAC, 0xBB, 0x36, 0xFA, 0x88, 0xDB, 0x3B,
+    0x3C, 0x71, 0x2D, 0xC0, 0x11, 0xC2, 0xA3, 0xEC, 0x13, 0xFF, 0x38, 0x60, 0xBD, 0x43, 0x77, 0x8B,
+    0xB8, 0xAE, 0xCA, 0x96, 0xB1, 0xF9, 0x3A, 0x66, 0x84, 0x89, 0xE8, 0x12, 0xED, 0x31, 0x8E, 0x96,
+    0xA5, 0x80, 0x01, 0xD0, 0x43, 0x79, 0xF2, 0x8A, 0x5E, 0x5F, 0xF9, 0x5E, 0x83, 0x72, 0x4F, 0xCB,
+    0x37, 0x2A, 0x33, 0xA0, 0xB8, 0x2B, 0x3C, 0x1A, 0xDA, 0xC0, 0x73, 0x25, 0xC7, 0x9B, 0xC2, 0x5F,
+    0x97, 0xEE, 0x58, 0xDD, 0xB2, 0xD9, 0x55, 0xF4, 0x2C, 0x26, 0xB3, 0xCB, 0xB2, 0xBC, 0x41, 0xEC,
+    0x88, 0xB0, 0x95, 0xFC, 0x7F, 0x1A, 0x43, 0x3E, 0xC7, 0x5F, 0xFD, 0xBB, 0x6C, 0x44, 0x80, 0xD6,
+    0x6F, 0x10, 0xFA, 0xCA, 0xEE, 0x6B, 0x7A, 0xF3, 0xC4, 0x45, 0x19, 0xF3, 0xFB, 0xC1, 0xA4, 0x90,
+    0xBD, 0x57, 0x82, 0x65, 0xC6, 0xF1, 0xB3, 0x10, 0x00, 0x1E, 0x60, 0x92, 0xEB, 0xAF, 0x67, 0x76,
+    0xBF, 0x2D, 0xBD, 0x37, 0x19, 0x27, 0xF9, 0xFD, 0x50, 0x24, 0x77, 0xF8, 0xAF, 0x26, 0x39, 0x30,
+    0xD4, 0x81, 0x94, 0xDE, 0xF2, 0xEB, 0x3A, 0xCC, 0x67, 0xF6, 0xCE, 0xE7, 0xCB, 0xA0, 0xD3, 0xB7,
+    0xE7, 0x88, 0x08, 0xDF, 0x82, 0xFC, 0xFE, 0xE9, 0x34, 0x29, 0xA5, 0x98, 0xBD, 0xF7, 0xEE, 0x7B,
+    0x93, 0xD1, 0xF7, 0x6B, 0xC8, 0xFD, 0xFC, 0x23, 0x64, 0x1A, 0xB2, 0xB0, 0x49, 0xFE, 0x1D, 0x2F,
+    0xC2, 0xD7, 0x69, 0x10, 0xD9, 0x53, 0x4E, 0xFA, 0x45, 0xF4, 0x97, 0x4B, 0xF2, 0x31, 0xE4, 0x65,
+    0xBD, 0x39, 0xBF, 0xB9, 0x7B, 0x69, 0x6B, 0xEA, 0x8A, 0xC7, 0xC7, 0x86, 0xB0, 0x27, 0x1F, 0xFA,
+    0x46, 0x83, 0x76, 0x5B, 0xFA, 0xC7, 0x0F, 0x64, 0x0A, 0xF2, 0x14, 0x96, 0xA1, 0x42, 0xDE, 0x05,
+    0x10, 0x2F, 0x0D, 0x52, 0x00, 0x56, 0x91, 0x01, 0x63, 0x01, 0x04, 0x30, 0x07, 0xAC, 0x01, 0x1B,
+    0x40, 0x00, 0xE1, 0x41, 0x39, 0xC8, 0x40, 0x8E, 0xC1, 0x0C, 0x2C, 0x9D, 0xBF, 0xEE, 0xD9, 0xFB,
+    0x0F, 0x9E, 0xF8, 0xB6, 0xE7, 0x0F, 0x1F, 0x3A, 0x7E, 0xEF, 0x33, 0x90, 0x1E, 0x40, 0x1A, 0x42,
+    0x51, 0x42, 0xAF, 0x7E, 0x53, 0x4E, 0xDE, 0x34, 0xC0, 0x52, 0x0D, 0x90, 0xEC, 0x9C, 0x77, 0x72,
+    0x16, 0xB2, 0xBA, 0xC8, 0x3D, 0xB9, 0xF8, 0xD0, 0x53, 0x7E, 0x49, 0x94, 0xCA, 0x45, 0xE2, 0x3E,
+    0x9D, 0x0E, 0xFA, 0xEB, 0x88, 0x04, 0x85, 0xC3, 0x78, 0x54, 0x40, 0x44, 0x64, 0x45, 0x5E, 0xA1,
+    0xC3, 0xF9, 0x3B, 0x9E, 0x0C, 0x9A, 0x90, 0x50, 0x7F, 0x8B, 0xC5, 0x06, 0x47, 0x6B, 0xCA, 0x96,
+    0x73, 0x19, 0x7B, 0xFB, 0xF2, 0x57, 0x9D, 0xA9, 0xD8, 0x44, 0x78, 0x66, 0x61, 0xB3, 0x0E, 0x68,
+    0x32, 0x97, 0xBD, 0x19, 0xE4, 0xD1, 0x6B, 0x17, 0x51, 0x9B, 0xC4, 0xCC, 0xEE, 0x13, 0x3A, 0x74,
+    0x96, 0x30, 0x06, 0xF9, 0xAE, 0xE5, 0xD0, 0x63, 0x02, 0x2A, 0xC2, 0x10, 0xBA, 0xF0, 0x3A, 0xD9,
+    0x29, 0x72, 0x78, 0xB9, 0xB3, 0x83, 0x11, 0xBC, 0xF4, 0x41, 0x34, 0xA3, 0x00, 0x06, 0x20, 0xDE,
+    0x05, 0xF5, 0x3B, 0xA0, 0x3F, 0x63, 0x59, 0xCE, 0x2C, 0x9D, 0xCC, 0xD1, 0xCF, 0x9C, 0x88, 0x99,
+    0x57, 0x29, 0x79, 0x9D, 0x92, 0xCF, 0x6D, 0xE6, 0xB7, 0xC9, 0x4A, 0xB8, 0xC6, 0xE0, 0x14, 0xA0,
+    0xE5, 0x48, 0x43, 0x19, 0xFA, 0x99, 0xDD, 0x6F, 0xD0, 0x9B, 0x7B, 0x32, 0xF9, 0x00, 0xF6, 0xE6,
+    0x60, 0xBB, 0x82, 0xDC, 0x7D, 0x70, 0xDE, 0x7E, 0xC0, 0xD0, 0x2B, 0x57, 0xD8, 0x5C, 0xA4, 0x88,
+    0x4C, 0xDB, 0x3F, 0x47, 0x07, 0x9E, 0x1A, 0xAD, 0x67, 0x41, 0x5A, 0xD8, 0x00, 0x79, 0xBE, 0x5C,
+    0xDF, 0x77, 0xD7, 0x7C, 0x1D, 0xE9, 0x98, 0x83, 0xE5, 0x8B, 0x51, 0x6D, 0xC2, 0x6C, 0x9D, 0x87,
+    0x1F, 0xBC, 0x6E, 0x97, 0x0C, 0x4E, 0x29, 0x2C, 0xC6, 0xA1, 0x02, 0x74, 0xC1, 0x58, 0x44, 0x84,
+    0x56, 0xDD, 0xC5, 0xC2, 0xA1, 0xD2, 0xBB, 0xBE, 0x95, 0x86, 0xA4, 0x64, 0xB3, 0x09, 0x47, 0xC1,
+    0xD3, 0x46, 0x9F, 0xA7, 0xDD, 0x80, 0x97, 0x77, 0x0D, 0xA2, 0xA4, 0x83, 0x72, 0xB4, 0x51, 0x25,
+    0xC5, 0x90, 0x41, 0x1D, 0x6D, 0xAD, 0x06, 0xB6, 0xF9, 0xEB, 0x1F, 0x08, 0x3C, 0x7D, 0x8A, 0x4C,
+    0x15, 0x85, 0x45, 0x05, 0xD8, 0x06, 0x11, 0xC1, 0x58, 0xE8, 0x82, 0x8C, 0x60, 0x3C, 0x14, 0x0E,
+    0xD2, 0xE3, 0x28, 0x53, 0x72, 0x2A, 0x9D, 0x72, 0x1E, 0x1C, 0x68, 0x23, 0xFF, 0x98, 0xEB, 0x33,
+    0x80, 0x1C, 0xF1, 0xF2, 0xAE, 0xF2, 0x2C, 0x41, 0x44, 0x39, 0x1A, 0xB0, 0x05, 0x29, 0x9C, 0x85,
+    0xBF, 0x5A, 0xE3, 0xF8, 0xD6, 0x93, 0x23, 0x9F, 0x3E, 0x45, 0xA7, 0x52, 0x55, 0x30, 0x84, 0x6D,
+    0xC8, 0x3C, 0x54, 0x90, 0xD7, 0xE1, 0x0B, 0x50, 0x43, 0x28, 0xC6, 0x27, 0x32, 0x25, 0x67, 0x52,
+    0xC5, 0xE1, 0x78, 0x02, 0x0C, 0x56, 0x79, 0x71, 0x04, 0x40, 0xCB, 0xBF, 0xBC, 0xDB, 0x61, 0x09,
+    0x83, 0x72, 0x04, 0xB6, 0x30, 0xE3, 0xB3, 0xA8, 0xB0, 0xB1, 0x8A, 0xF8, 0x63, 0xD0, 0xFC, 0xC5,
+    0x4C, 0xB9, 0xB0, 0x3B, 0x8D, 0x7D, 0x3A, 0x35, 0x6B, 0xFB, 0xB8, 0x29, 0x07, 0xAE, 0xCE, 0x42,
+    0xA3, 0xAC, 0x41, 0xE3, 0xE2, 0x6A, 0x25, 0x47, 0x4A, 0x5E, 0xF9, 0xDC, 0x2D, 0x91, 0xD3, 0x63,
+    0x4B, 0x79, 0xAA, 0x65, 0x54, 0x79, 0x8C, 0x51, 0x9E, 0x13, 0x83, 0x0E, 0x2F, 0x7F, 0x2D, 0xC9,
+    0x94, 0x2A, 0x93, 0x12, 0x45, 0xB2, 0xD4, 0x00, 0x93, 0xCD, 0x80, 0x5E, 0x84, 0xF9, 0x26, 0x2C,
+    0xB6, 0xB9, 0xDD, 0x5C, 0x90, 0xA9, 0x8F, 0xBE, 0x59, 0xB1, 0x24, 0x22, 0x4D, 0x11, 0x68, 0xCB,
+    0x92, 0x76, 0xE6, 0x29, 0x06, 0x9E, 0x22, 0x79, 0xF4, 0x77, 0xDD, 0x0F, 0x4B, 0x07, 0x94, 0x85,
+    0x45, 0x78, 0xE1, 0xB1, 0x25, 0x9D, 0xC2, 0x22, 0xE2, 0xA4, 0x47, 0xEB, 0x7D, 0x27, 0xCB, 0xD7,
+    0x59, 0x12, 0x91, 0x5E, 0xE6, 0x94, 0xBB, 0x41, 0x43, 0x44, 0x8A, 0x81, 0x27, 0x25, 0x18, 0x1C,
+    0x5C, 0x8C, 0xF6, 0x70, 0xCC, 0xD4, 0x39, 0x58, 0xAA, 0x34, 0x62, 0x30, 0xB6, 0x06, 0x88, 0xB0,
+    0x0C, 0xB2, 0x84, 0x62, 0x4C, 0x96, 0x4A, 0xFA, 0x35, 0xC0, 0x46, 0x68, 0xA5, 0xA8, 0x52, 0xA2,
+    0x48, 0x91, 0x0B, 0x34, 0x99, 0xAC, 0x9B, 0x95, 0x65, 0xA9, 0xD9, 0x5D, 0xFE, 0x7C, 0x6C, 0x8D,
+    0xEF, 0x6E, 0x42, 0x1B, 0xB6, 0x5F, 0xB4, 0xAD, 0x64, 0xB3, 0x71, 0x8D, 0xFA, 0x1B, 0xF3, 0xA8,
+    0x77, 0x1D, 0xA6, 0xBC, 0x4C, 0x33, 0x9E, 0x3A, 0xEC, 0xCA, 0x0C, 0xFB, 0x97, 0x90, 0xE4, 0xCF,
+    0x13, 0x9C, 0x67, 0xEB, 0x24, 0xBF, 0x73, 0x79, 0xAD, 0x8B, 0xE4, 0x75, 0x7A, 0x87, 0x08, 0x06,
+    0x44, 0x80, 0x1B, 0xA0, 0x52, 0xE0, 0xF0, 0x14, 0xED, 0x98, 0x7C, 0x2F, 0xEB, 0xA8, 0x2A, 0x25,
+    0x90, 0x1E, 0x03, 0xBF, 0x78, 0xB1, 0x43, 0x2A, 0x8E, 0x37, 0x35, 0xBB, 0x5F, 0xB8, 0xFF, 0x66,
+    0xFA, 0xA3, 0x79, 0x68, 0xC3, 0x7B, 0x53, 0x32, 0x55, 0xA2, 0x26, 0x7A, 0x4F, 0x3D, 0xB2, 0xB9,
+    0x1A, 0xC3, 0xF2, 0xF3, 0x21, 0xE9, 0x5B, 0xB6, 0x37, 0x9D, 0xFD, 0xCB, 0x51, 0x6B, 0x7C, 0xB7,
+    0x44, 0x39, 0xCC, 0xDD, 0x9D, 0x56, 0xB2, 0xF9, 0x90, 0xEB, 0x08, 0xC7, 0x1C, 0x5C, 0xA2, 0x6C,
+    0x1F, 0xB6, 0x9D, 0x9E, 0x7E, 0x6E, 0x77, 0x57, 0xF9, 0xC6, 0x84, 0x73, 0x9C, 0x5D, 0xCF, 0x95,
+    0xB2, 0x2C, 0x9B, 0xE2, 0x95, 0xFF, 0x33, 0xD0, 0xE9, 0xB5, 0x4D, 0x08, 0xA8, 0x77, 0xAE, 0xE9,
+    0x54, 0x66, 0x63, 0xA0, 0x01, 0xBC, 0x0C, 0x6A, 0xBA, 0x7E, 0xF6, 0xE7, 0x2D, 0x83, 0xE4, 0xCD,
+    0x3B, 0x82, 0x13, 0xC8, 0x4A, 0x68, 0x01, 0x55, 0x8D, 0x1D, 0x39, 0x87, 0xA1, 0xCF, 0x2F, 0x3C,
+    0x8C, 0x6C, 0x9A, 0x90, 0x95, 0xAD, 0x94, 0x28, 0xD2, 0x88, 0xD6, 0xD8, 0xD6, 0xB8, 0x3B, 0x82,
+    0xF2, 0xEE, 0x19, 0xB9, 0x78, 0xDB, 0xE6, 0x03, 0xDF, 0x50, 0x31, 0x63, 0xA8, 0xDC, 0x16, 0xDE,
+    0xB0, 0x61, 0x9C, 0xB9, 0x5F, 0xAA, 0x14, 0x69, 0xF5, 0x61, 0x8B, 0x85, 0x43, 0xF2, 0x44, 0x96,
+    0xE0, 0x0A, 0xB5, 0xC8, 0x52, 0x78, 0xCC, 0x6F, 0x72, 0x39, 0xBD, 0xA6, 0xBE, 0x8A, 0x4E, 0x23,
+    0xC6, 0x76, 0x41, 0x7B, 0xB8, 0x33, 0x41, 0xCE, 0x1A, 0x44, 0x45, 0xCC, 0xC6, 0xDA, 0x4D, 0x8D,
+    0x0A, 0x94, 0x1D, 0x73, 0x47, 0xA6, 0x14, 0x55, 0x4A, 0x5E, 0xA6, 0x77, 0x60, 0x55, 0xB0, 0xB6,
+    0x44, 0x3E, 0xBC, 0x48, 0xB1, 0xD6, 0xCF, 0x88, 0xF7, 0x47, 0xCA, 0x8D, 0x32, 0x86, 0x0D, 0xAA,
+    0x39, 0xE2, 0x9C, 0x0A, 0xE6, 0x7E, 0x69, 0x92, 0x97, 0xEF, 0x3B, 0x8C, 0x5D, 0x38, 0xE4, 0x70,
+    0xC4, 0x61, 0xAC, 0xF1, 0x67, 0xDA, 0x9E, 0x61, 0xE5, 0x45, 0x47, 0x5A, 0x29, 0x9A, 0x77, 0x84,
+    0x8C, 0x70, 0x07, 0xF4, 0x39, 0x98, 0x8A, 0x98, 0x8D, 0xD7, 0xF9, 0x91, 0x3F, 0x8B, 0x6C, 0x16,
+    0x2E, 0xBF, 0x99, 0x52, 0x34, 0x29, 0xD5, 0xB3, 0x12, 0x90, 0x61, 0x42, 0xA3, 0x9E, 0xBA, 0x07,
+    0x3F, 0x6F, 0x65, 0x4A, 0x8C, 0xED, 0x42, 0xAB, 0x5E, 0x88, 0x93, 0x73, 0x10, 0xCD, 0x39, 0xFC,
+    0xC3, 0x20, 0x0E, 0x0B, 0xD4, 0xAD, 0xA1, 0xA8, 0x5A, 0x29, 0x91, 0x52, 0x94, 0xE9, 0x82, 0x37,
+    0x5F, 0xBB, 0xFC, 0x86, 0x8C, 0xD4, 0xFE, 0xC1, 0x08, 0x2A, 0x44, 0x44, 0x95, 0x4C, 0xBB, 0xA7,
+    0xEF, 0x4F, 0xAF, 0x6E, 0x42, 0xFD, 0xD4, 0x59, 0x8C, 0x2B, 0x1C, 0xB0, 0xC5, 0x31, 0x1D, 0x22,
+    0x5D, 0x22, 0x7D, 0x11, 0xA8, 0x54, 0x29, 0xA2, 0x2A, 0x65, 0xCC, 0x52, 0x0A, 0x3A, 0xA5, 0xD2,
+    0xA4, 0x54, 0x1A, 0x6B, 0x7C, 0x0B, 0xE3, 0x0B, 0x72, 0xB7, 0x4D, 0xCB, 0x32, 0x0F, 0x2D, 0xCB,
+    0xDE, 0x51, 0x4D, 0xA7, 0x68, 0xC3, 0x06, 0xF4, 0x20, 0xC0, 0x7F, 0xBF, 0x2B, 0x53, 0xA5, 0xAA,
+    0x03, 0xE5, 0xDB, 0x99, 0xDD, 0x34, 0xEC, 0x19, 0x7A, 0xCB, 0xC4, 0x2D, 0x11, 0x3A, 0xB2, 0x64,
+    0x95, 0xEB, 0x1C, 0xD0, 0x39, 0x0B, 0x2A, 0x22, 0x7D, 0x9D, 0xD2, 0x28, 0x7B, 0x74, 0xAF, 0x7A,
+    0x22, 0xA8, 0xCF, 0x9F, 0x0C, 0xDA, 0x84, 0x4F, 0xED, 0x88, 0x74, 0x54, 0x07, 0x12, 0xBF, 0x7F,
+    0x11, 0x48, 0x7F, 0x6F, 0xA0, 0x83, 0x8D, 0xB9, 0x57, 0xC5, 0x97, 0xFC, 0x85, 0x88, 0xD5, 0x8E,
+    0x0A, 0x83, 0x88, 0xAC, 0xA3, 0x4A, 0x3A, 0x64, 0x9E, 0x3E, 0xC6, 0x51, 0x91, 0xA3, 0x22, 0x05,
+    0xC8, 0x2F, 0xCA, 0x5F, 0xF7, 0x6F, 0x96, 0x2B, 0x00, 0x2B, 0x34, 0x99, 0x47, 0x21, 0x3C, 0x81,
+    0x76, 0x5D, 0x40, 0x3D, 0xB0, 0xA3, 0xD3, 0x79, 0x6E, 0x8B, 0x88, 0x76, 0x6C, 0x41, 0x24, 0xF3,
+    0xE7, 0x12, 0x3B, 0x87, 0x3E, 0x2A, 0x60, 0x2C, 0x5D, 0x54, 0xC4, 0x78, 0x40, 0xA5, 0xF0, 0x52,
+    0xBD, 0x47, 0x7A, 0xB4, 0x99, 0x23, 0xAB, 0xCB, 0xF1, 0x3E, 0x1D, 0x0C, 0xB0, 0x45, 0x87, 0x2E,
+    0x7D, 0x2A, 0xA2, 0x88, 0x32, 0xA8, 0x52, 0xF9, 0xCC, 0x6B, 0x6F, 0x5C, 0x6E, 0x5B, 0x76, 0x95,
+    0x5D, 0xBA, 0x35, 0x4D, 0x58, 0x9F, 0x70, 0x84, 0x05, 0x7A, 0x04, 0xBC, 0xF0, 0xD2, 0x29, 0x97,
+    0x59, 0x83, 0xE1, 0x3A, 0x1B, 0x35, 0x16, 0x69, 0xCE, 0x8B, 0x3F, 0x64, 0x5E, 0x06, 0x2A, 0x3A,
+    0xE4, 0x68, 0xA7, 0x4A, 0x22, 0x5D, 0xD6, 0x31, 0x4E, 0x95, 0x22, 0x32, 0xA2, 0x00, 0x68, 0x2A,
+    0xB7, 0x99, 0x71, 0xD4, 0x10, 0x65, 0x47, 0x79, 0xBA, 0xAA, 0xD4, 0xAE, 0x43, 0xA5, 0xBD, 0x61,
+    0x28, 0xA2, 0x61, 0x5D, 0x44, 0x55, 0xAE, 0xD3, 0x51, 0x65, 0xE6, 0x3B, 0xF4, 0xB5, 0x33, 0xAE,
+    0xA2, 0x32, 0xE4, 0x22, 0xAA, 0x78, 0x83, 0x42, 0x79, 0xC4, 0x10, 0x95, 0xA0, 0x28, 0xC9, 0x6A,
+    0xA1, 0x01, 0x7D, 0x96, 0xA9, 0xD8, 0x02, 0x9E, 0x67, 0x02, 0x0E, 0xD2, 0xB3, 0xA7, 0x1C, 0x3D,
+    0x65, 0x09, 0x19, 0xC2, 0xCF, 0x22, 0x7D, 0x03, 0xE5, 0x96, 0x50, 0xB6, 0x43, 0x46, 0x87, 0x06,
+    0x30, 0x5F, 0x2B, 0x88, 0xD9, 0x6A, 0x22, 0x7A, 0x6A, 0x26, 0x45, 0x16, 0xE0, 0x8D, 0xBA, 0x58,
+    0x7F, 0x12, 0x54, 0x80, 0x4E, 0x8D, 0x69, 0xFD, 0xF3, 0x5D, 0xB5, 0x5E, 0x17, 0x98, 0xC9, 0xF7,
+    0xC7, 0x75, 0x4D, 0x89, 0xB0, 0x05, 0xDA, 0x93, 0x0F, 0x51, 0x63, 0xD8, 0x3E, 0x43, 0x93, 0xCC,
+    0xC2, 0x9F, 0xC0, 0x6A, 0x4D, 0xF9, 0x1A, 0x20, 0x4A, 0x68, 0xD6, 0x4A, 0x66, 0x13, 0xB2, 0x7A,
+    0xC3, 0xCC, 0x03, 0xFE, 0xFC, 0xFB, 0x1E, 0xE2, 0x41, 0x4D, 0xF9, 0x00, 0x96, 0x33, 0x2F, 0xCB,
+    0x8A, 0xCE, 0x16, 0xD9, 0x57, 0x1C, 0xBF, 0x15, 0x31, 0x5D, 0x44, 0x82, 0x56, 0x89, 0x1A, 0xC1,
+    0x61, 0x44, 0x0F, 0x2C, 0xDF, 0x19, 0x91, 0x9B, 0xA8, 0xC2, 0xC0, 0x6E, 0xA9, 0x5A, 0x1F, 0xB7,
+    0x38, 0xE7, 0x54, 0x8E, 0xC9, 0x4A, 0x29, 0x4B, 0x0F, 0x03, 0x25, 0xCD, 0x35, 0xF5, 0xBB, 0xFC,
+    0xA4, 0xCF, 0x22, 0x89, 0xC6, 0x50, 0xFC, 0x5E, 0xD9, 0x29, 0xD4, 0x1B, 0x13, 0x61, 0xBD, 0x43,
+    0x6E, 0x55, 0xA0, 0x83, 0x71, 0xEC, 0xA0, 0x66, 0xB3, 0xE6, 0x6C, 0xAF, 0xE1, 0x73, 0x0A, 0xFB,
+    0x93, 0xFE, 0x1F, 0x87, 0x6F, 0x55, 0x08, 0xCF, 0x1C, 0x84, 0x09, 0x03, 0xDB, 0x41, 0x79, 0x96,
+    0xE1, 0x78, 0x92, 0x96, 0xC7, 0x28, 0x8F, 0x81, 0x3E, 0xAA, 0xC4, 0xC0, 0xCB, 0x5F, 0x7B, 0x98,
+    0x92, 0xA9, 0x69, 0xCC, 0x1C, 0xCA, 0xD1, 0x3B, 0x93, 0xEB, 0xCA, 0xD2, 0xA3, 0x81, 0x28, 0x69,
+    0xA2, 0x1C, 0xFB, 0x68, 0x88, 0x2C, 0x23, 0x3D, 0x85, 0x9F, 0x0C, 0x23, 0x92, 0x39, 0x6E, 0x5C,
+    0x24, 0x7F, 0x44, 0x5D, 0xDA, 0x04, 0xF7, 0x62, 0x4A, 0x0F, 0xD3, 0x84, 0x8F, 0xAA, 0x40, 0x0E,
+    0x43, 0x32, 0xCF, 0xF3, 0xC0, 0x82, 0x28, 0x35, 0xED, 0xF3, 0x3F, 0x1D, 0x11, 0x34, 0x85, 0x4F,
+    0x00, 0x59, 0x59, 0x10, 0x8D, 0x5B, 0x3B, 0x73, 0xDA, 0x0E, 0xE0, 0x18, 0xE2, 0x9C, 0x88, 0x4D,
+    0x59, 0x6E, 0x2A, 0xBF, 0xA2, 0x3C, 0xDA, 0x61, 0x2C, 0x06, 0xF2, 0x7B, 0xB1, 0x48, 0xB1, 0x48,
+    0x01, 0x36, 0x79, 0xCB, 0xEB, 0x06, 0xED, 0x55, 0x51, 0xD6, 0x66, 0x40, 0x7D, 0xAF, 0x4D, 0x2E,
+    0x28, 0x3C, 0xA9, 0x6E, 0xB0, 0x5B, 0x37, 0xB8, 0x44, 0xDC, 0x92, 0xE1, 0x17, 0x95, 0x47, 0x79,
+    0xB2, 0xEF, 0x6D, 0xF0, 0x1A, 0xD9, 0x64, 0x0A, 0xDE, 0x2A, 0x9B, 0x5B, 0xEA, 0xCB, 0xEE, 0x43,
+    0xA7, 0x80, 0xDD, 0x7A, 0xC3, 0x9D, 0xA1, 0xAB, 0xD1, 0x00, 0x07, 0xC7, 0x80, 0xFC, 0x03, 0x0B,
+    0x98, 0x63, 0x80, 0x43, 0x0B, 0xC8, 0x0A, 0x98, 0xC8, 0xEF, 0x2E, 0xD4, 0x19, 0x3D, 0xF9, 0x5F,
+    0x36, 0x02, 0xF8, 0xC2, 0xE3, 0xFB, 0x90, 0x7D, 0x25, 0x8D, 0xA0, 0x5B, 0xA4, 0x40, 0xE6, 0x2F,
+    0x9E, 0xF5, 0x13, 0x1B, 0x85, 0x33, 0xF5, 0x9E, 0xD9, 0x3A, 0x70, 0x63, 0x22, 0xBA, 0x9B, 0xF5,
+    0x36, 0x61, 0xFF, 0x0A, 0x53, 0x8F, 0xBF, 0xFA, 0xDC, 0x1F, 0x85, 0x3A, 0xA1, 0xA5, 0x07, 0x35,
+    0xAA, 0x3F, 0x75, 0x77, 0x37, 0x26, 0x0F, 0x5E, 0x39, 0x47, 0x31, 0x2B, 0x03, 0x91, 0x11, 0x7D,
+    0x0E, 0xED, 0x16, 0xAD, 0xD2, 0x60, 0x86, 0xDA, 0x65, 0xFF, 0x4B, 0x95, 0xF2, 0x7F, 0xBF, 0x11,
+    0xA9, 0xAA, 0x3E, 0xDD, 0xAD, 0x2D, 0x5A, 0xFA, 0x5F, 0x63, 0x5E, 0x79, 0xDF, 0x65, 0x65, 0x51,
+    0xCA, 0x68, 0x22, 0x23, 0x35, 0xAA, 0x6D, 0x84, 0x35, 0xD8, 0xBB, 0x90, 0xF7, 0xC2, 0x8A, 0x14,
+    0x65, 0xDC, 0x57, 0x7E, 0x3F, 0x73, 0xFB, 0x9A, 0x68, 0x88, 0xB9, 0x08, 0xEB, 0x32, 0x6C, 0x4D,
+    0x3C, 0xAB, 0x69, 0xA7, 0xBC, 0x8A, 0x32, 0x30, 0xA2, 0x62, 0x60, 0x3B, 0x14, 0x61, 0x9D, 0xBC,
+    0x6B, 0xAC, 0xFE, 0x8A, 0xF2, 0xEA, 0xED, 0x37, 0x83, 0x88, 0x55, 0xC5, 0xC9, 0x7A, 0x97, 0xED,
+    0xEC, 0x4F, 0xC8, 0x6D, 0xB2, 0xDA, 0x17, 0x5E, 0x45, 0x33, 0x31, 0xB3, 0x0B, 0x20, 0xB7, 0xA0,
+    0x5D, 0xED, 0x8D, 0xC9, 0xA3, 0x3A, 0x6E, 0x96, 0x7C, 0x2B, 0xB3, 0x71, 0x29, 0x73, 0xFB, 0x4D,
+    0xE5, 0xA3, 0xC9, 0xFC, 0xC1, 0xBA, 0x0C, 0x95, 0xB1, 0xC0, 0x88, 0xAC, 0xA4, 0x05, 0x91, 0x59,
+    0x07, 0xD8, 0x05, 0x58, 0xDC, 0xAF, 0xC9, 0x08, 0x2B, 0x17, 0x4C, 0x4B, 0x1C, 0x4D, 0xA6, 0xA2,
+    0xE0, 0xC9, 0xA9, 0xF0, 0x91, 0x2A, 0x7E, 0xD4, 0x54, 0x5C, 0x9F, 0x62, 0x76, 0x1F, 0xE5, 0xCF,
+    0xF5, 0xCF, 0xC7, 0x4E, 0x85, 0x72, 0x98, 0x0F, 0x91, 0x7D, 0x96, 0xC1, 0x90, 0x61, 0x93, 0xB0,
+    0x28, 0xCB, 0xA6, 0xF2, 0x9D, 0xCC, 0x1F, 0x68, 0xD7, 0x37, 0xB6, 0xCA, 0x27, 0x76, 0xFE, 0x0F,
+    0x33, 0x81, 0xAA, 0x02, 0x39, 0x82, 0x7C, 0x08, 0xB3, 0xF6, 0x63, 0xE6, 0xAD, 0x8B, 0x8E, 0x0C,
+    0x26, 0x83, 0xD9, 0x41, 0xA5, 0x78, 0x21, 0x97, 0x7E, 0x38, 0xCF, 0x93, 0xCF, 0x8F, 0xF8, 0x77,
+    0x97, 0xEC, 0x94, 0x81, 0x55, 0x8F, 0x4A, 0x43, 0x58, 0xA4, 0xD7, 0x21, 0xB4, 0x09, 0x6D, 0xE9,
+    0xB7, 0xEF, 0xBB, 0xD6, 0x18, 0x5D, 0x81, 0x70, 0x2B, 0x08, 0x7F, 0x04, 0xC9, 0xC3, 0xB3, 0xFC,
+    0x85, 0x75, 0xA2, 0xF6, 0x58, 0xB6, 0xAB, 0x27, 0x1D, 0x96, 0x8F, 0xEE, 0x8D, 0xF4, 0x1A, 0x59,
+    0x1A, 0xC4, 0xCE, 0xD4, 0xE5, 0x77, 0xEE, 0x22, 0x1F, 0x3F, 0x40, 0xC5, 0xAC, 0x94, 0x91, 0xBE,
+    0x88, 0xB4, 0x38, 0x26, 0x73, 0x1D, 0x44, 0x58, 0x86, 0x63, 0x6D, 0xE9, 0xC8, 0x92, 0x75, 0x46,
+    0xB4, 0x6C, 0xEB, 0xD1, 0xC0, 0x65, 0x29, 0x79, 0x52, 0xF2, 0xE8, 0xF1, 0x25, 0x15, 0x65, 0x68,
+    0x2B, 0x6F, 0xB8, 0x48, 0xA2, 0x89, 0xD3, 0xA7, 0x1E, 0x95, 0xC4, 0x06, 0x8B, 0xF5, 0xA9, 0x53,
+    0x9B, 0xA0, 0x5C, 0x93, 0xED, 0xFB, 0x4E, 0xA6, 0x80, 0xAE, 0x26, 0xB0, 0x20, 0x3C, 0xF8, 0x0B,
+    0xF1, 0xA0, 0x92, 0xE3, 0xD1, 0x09, 0x7B, 0x9A, 0xB6, 0xF4, 0xF3, 0x22, 0x66, 0xAF, 0x56, 0x2A,
+    0x05, 0xD2, 0x88, 0xAE, 0xB6, 0xDB, 0x22, 0x18, 0xDB, 0xCF, 0xFC, 0xB6, 0x8A, 0xB9, 0x1B, 0xE9,
+    0x80, 0xB2, 0xD2, 0x09, 0x8F, 0x05, 0xFE, 0x5A, 0xC8, 0x87, 0xC6, 0x29, 0x2F, 0x6A, 0xF2, 0xD0,
+    0xAA, 0xAD, 0x8E, 0x21, 0x8D, 0xAF, 0xF9, 0x8C, 0x9E, 0x72, 0x4D, 0xCA, 0x9C, 0x2F, 0xDC, 0xB6,
+    0xC5, 0x18, 0x93, 0x7C, 0xE6, 0x8F, 0x55, 0x58, 0xA6, 0xD2, 0xAE, 0xAB, 0x42, 0x21, 0x86, 0xC6,
+    0x3F, 0xB8, 0xDC, 0xF7, 0x33, 0x2B, 0x8F, 0xE1, 0x99, 0x72, 0x53, 0xBF, 0xC2, 0x61, 0x30, 0x8E,
+    0xC8, 0x72, 0xCD, 0xC5, 0xB4, 0x3F, 0xF3, 0x8E, 0x27, 0xF9, 0xCD, 0x88, 0xDC, 0xAA, 0x58, 0xA3,
+    0x1F, 0x88, 0x2F, 0x3A, 0x5A, 0xF6, 0xC2, 0x3F, 0x7E, 0xAA, 0x81, 0x4D, 0x09, 0xFB, 0x6F, 0xAD,
+    0xB1, 0xE2, 0xFB, 0x0E, 0x0C, 0x8E, 0xEA, 0x82, 0xBF, 0xC9, 0x65, 0x97, 0x52, 0x27, 0x64, 0x1A,
+    0x91, 0xDF, 0x85, 0xAA, 0xAE, 0xFF, 0xB9, 0x85, 0xA2, 0x82, 0x62, 0x0C, 0xD3, 0xE3, 0x7A, 0x1F,
+    0xE9, 0x78, 0xF5, 0xC5, 0x81, 0x1F, 0xA4, 0x53, 0x9D, 0x92, 0x7F, 0xEE, 0x9C, 0xC3, 0x97, 0x68,
+    0xD8, 0xBB, 0x94, 0xA8, 0x7C, 0x6A, 0x47, 0x3A, 0x34, 0xE4, 0x25, 0xCF, 0x05, 0x94, 0x7F, 0xF6,
+    0xB6, 0x4C, 0xC3, 0xEC, 0xEC, 0x40, 0x42, 0x03, 0xCB, 0x25, 0x6C, 0xAC, 0x4D, 0xB2, 0x29, 0xA2,
+    0x53, 0x24, 0xBF, 0x5B, 0xE3, 0x43, 0x9B, 0x5A, 0x39, 0x17, 0x15, 0x98, 0xE4, 0xE0, 0x76, 0x00,
+    0x1D, 0x41, 0x47, 0xB9, 0x73, 0x3B, 0xEA, 0x94, 0xCA, 0x56, 0x4A, 0x9C, 0xC7, 0x9F, 0x85, 0x6D,
+    0xD4, 0x4F, 0x71, 0x45, 0x00, 0x0C, 0x5C, 0xE3, 0x25, 0x8E, 0x90, 0x9E, 0xAC, 0x62, 0x7A, 0x08,
+    0x71, 0xFA, 0xEF, 0xFB, 0xC1, 0x58, 0xA4, 0x50, 0x47, 0x6A, 0x25, 0x2F, 0xDE, 0xAB, 0x8B, 0x53,
+    0x1B, 0x44, 0x05, 0x2A, 0x59, 0x54, 0x0A, 0x75, 0x9C, 0x96, 0x87, 0x01, 0x5F, 0x7D, 0x6E, 0xA4,
+    0x53, 0x2A, 0x07, 0x69, 0x24, 0x06, 0x63, 0x8B, 0xA8, 0xA3, 0x30, 0x33, 0x39, 0x83, 0x68, 0x05,
+    0xF5, 0x2F, 0x58, 0x83, 0x1E, 0xE2, 0x14, 0xF1, 0x00, 0x3A, 0xE2, 0xD5, 0xD8, 0x4A, 0xEE, 0x70,
+    0xC8, 0x0C, 0x7C, 0x0E, 0x56, 0x26, 0xC5, 0x0F, 0xD4, 0x4D, 0x8B, 0xEA, 0x7D, 0x8F, 0xEF, 0xD4,
+    0x1A, 0xA1, 0x53, 0xE4, 0x65, 0x8B, 0x2A, 0xEB, 0xC2, 0x76, 0x07, 0x48, 0x65, 0x6D, 0x38, 0x3F,
+    0x37, 0xAC, 0x07, 0xDC, 0xF2, 0x3F, 0x36, 0x9D, 0x64, 0x4A, 0x55, 0x2B, 0x25, 0x6E, 0x9F, 0x6D,
+    0x64, 0xB7, 0x23, 0xFF, 0xE7, 0xD9, 0x39, 0xC9, 0xC7, 0xCC, 0x77, 0x2B, 0xA5, 0x87, 0x29, 0x0D,
+    0xCF, 0xB4, 0x78, 0xA7, 0xAE, 0x21, 0x35, 0x8D, 0x24, 0xD6, 0xBE, 0x67, 0x80, 0xAD, 0xBA, 0xEA,
+    0x8E, 0x40, 0x38, 0x90, 0xE7, 0x07, 0x2E, 0x3D, 0x82, 0x2C, 0x5B, 0xE3, 0x33, 0xDA, 0xBD, 0xC4,
+    0x3A, 0x45, 0x28, 0xC2, 0x55, 0xF0, 0xB9, 0x85, 0x5A, 0x88, 0xE7, 0x0E, 0x8E, 0x2E, 0x0C, 0xAD,
+    0xA7, 0x0C, 0x08, 0x3D, 0xE6, 0xF9, 0xF7, 0xBE, 0x71, 0x4D, 0x96, 0x32, 0x05, 0xE5, 0xD8, 0xC7,
+    0x40, 0x64, 0x09, 0x19, 0x28, 0x82, 0x1A, 0x7F, 0x48, 0x9B, 0x99, 0x67, 0x76, 0xEC, 0x64, 0x1A,
+    0xD5, 0x86, 0xC2, 0xF7, 0xB6, 0x89, 0x46, 0x39, 0x59, 0xEA, 0xE4, 0xDA, 0x72, 0xF0, 0x6F, 0xD2,
+    0x48, 0x39, 0x51, 0x32, 0xA4, 0x08, 0x66, 0x08, 0x1C, 0x39, 0xAE, 0xFE, 0x1C, 0x6C, 0x54, 0x97,
+    0x6A, 0x97, 0x6D, 0x61, 0xDC, 0x90, 0xAE, 0x2A, 0x65, 0xCC, 0x31, 0xEE, 0x84, 0x2D, 0x15, 0x44,
+    0x34, 0x68, 0xD7, 0x65, 0x4B, 0x06, 0xA2, 0x76, 0xDA, 0x15, 0xF6, 0x75, 0x6A, 0xE1, 0x6E, 0xCF,
+    0x25, 0xEC, 0xC1, 0x86, 0xFA, 0x31, 0x37, 0xD3, 0x99, 0xB0, 0x77, 0xE9, 0x83, 0x51, 0xB6, 0xBD,
+    0x28, 0xCA, 0x9E, 0x56, 0xBE, 0x63, 0x64, 0x28, 0x92, 0x4B, 0xA7, 0xE2, 0x74, 0xC2, 0x37, 0x4D,
+    0x72, 0x7C, 0xF6, 0x12, 0x5E, 0xA8, 0x50, 0x90, 0xDB, 0x8A, 0x93, 0xCC, 0xAB, 0xD0, 0xC2, 0xD8,
+    0x21, 0x5D, 0xE5, 0x65, 0xC8, 0x31, 0xF6, 0x80, 0x8E, 0x0C, 0x32, 0x98, 0xB2, 0x65, 0x8B, 0x34,
+    0x22, 0xA5, 0x92, 0xC1, 0xD9, 0x79, 0xCA, 0xB9, 0x36, 0x6B, 0xD0, 0x6B, 0x2B, 0x5F, 0x36, 0x32,
+    0xF6, 0x9B, 0xD2, 0x47, 0xA3, 0x7C, 0xDF, 0xA4, 0x50, 0x24, 0x7B, 0xF8, 0x4B, 0x20, 0xD9, 0x61,
+    0x3E, 0x83, 0x56, 0x75, 0xB9, 0x94, 0x4C, 0x31, 0xC5, 0x09, 0xDB, 0x2A, 0x88, 0x68, 0xAC, 0xF6,
+    0x5D, 0xB6, 0x65, 0xA4, 0x32, 0x2E, 0xF3, 0x1D, 0xD6, 0x45, 0xA4, 0xD2, 0x4E, 0xF9, 0x75, 0xD6,
+    0x39, 0x95, 0x95, 0x4A, 0xC9, 0x9B, 0x74, 0x8A, 0x3E, 0xCF, 0xBE, 0x05, 0xF5, 0xA2, 0x37, 0xA3,
+    0x73, 0xAB, 0x22, 0x68, 0xE5, 0x3A, 0xF3, 0x84, 0xBD, 0xEC, 0xA6, 0x6F, 0x1A, 0x62, 0x47, 0xBB,
+    0x34, 0x56, 0xA9, 0xCA, 0xFE, 0x9F, 0x87, 0x4F, 0x02, 0xFF, 0x04, 0xE4, 0x0A, 0xE7, 0x1B, 0xA2,
+    0xBE, 0x4E, 0xD8, 0x56, 0x51, 0x54, 0x1F, 0x1E, 0x3E, 0xFB, 0x88, 0xF0, 0xD3, 0x8E, 0x9F, 0x83,
+    0xF3, 0x95, 0xFB, 0xC8, 0xF0, 0xD2, 0x5E, 0xC5, 0xD0, 0x61, 0xED, 0x22, 0x3F, 0x01, 0x64, 0x64,
+    0xA8, 0xC2, 0x44, 0xF9, 0x7B, 0x15, 0xB4, 0x57, 0xA5, 0x71, 0x99, 0x37, 0x68, 0x97, 0x63, 0xEC,
+    0x3A, 0x86, 0x75, 0xD6, 0x29, 0xEC, 0xEB, 0x14, 0x69, 0x44, 0x91, 0xAA, 0xF3, 0xF8, 0xA2, 0xD4,
+    0x22, 0x68, 0xBB, 0x33, 0x75, 0xB6, 0xBD, 0x5D, 0x93, 0x60, 0xD8, 0x54, 0x6E, 0x51, 0x94, 0x9A,
+    0x9E, 0xF2, 0x1D, 0xE2, 0x3A, 0x45, 0x72, 0x26, 0x95, 0x67, 0x8B, 0xAE, 0xBD, 0x0A, 0xDB, 0xE4,
+    0x7C, 0xF8, 0x2A, 0xF7, 0x3F, 0x64, 0x95, 0x4F, 0x6B, 0xAF, 0x75, 0xF5, 0x8C, 0x13, 0x7F, 0x70,
+    0x99, 0xD5, 0x07, 0x96, 0xB9, 0x8B, 0x72, 0xAC, 0x81, 0x47, 0x84, 0x73, 0x09, 0x89, 0x18, 0x02,
+    0x73, 0x13, 0x8F, 0x7F, 0x19, 0xE8, 0xF7, 0x41, 0xBD, 0x19, 0x60, 0x5D, 0x3B, 0x88, 0xEB, 0x44,
+    0xED, 0x86, 0xA6, 0xEC, 0xA8, 0x90, 0x6E, 0x05, 0xF3, 0x99, 0x71, 0xCE, 0xD6, 0x9D, 0x93, 0x21,
+    0xEF, 0x7F, 0xEB, 0x7D, 0xAF, 0x52, 0x76, 0x8A, 0xA9, 0xF2, 0x48, 0xE1, 0x0A, 0xCB, 0x88, 0x51,
+    0x4D, 0xBA, 0x8D, 0x67, 0xFE, 0x6A, 0x2D, 0xB6, 0xA6, 0x3A, 0xA8, 0xDF, 0x45, 0xBE, 0xED, 0x7D,
+    0x8C, 0xC3, 0xE3, 0x4E, 0xEA, 0x98, 0x74, 0xAA, 0xC6, 0x89, 0xD3, 0xC2, 0x6E, 0x6B, 0x0F, 0x6B,
+    0xB0, 0x0D, 0x6F, 0xB9, 0xA7, 0x3E, 0xFA, 0xAC, 0xD5, 0x16, 0xDF, 0x80, 0xDD, 0xD5, 0x1F, 0xF8,
+    0x0C, 0x6B, 0x77, 0x8D, 0xD8, 0x15, 0x71, 0xF8, 0x83, 0x9C, 0xBD, 0xD6, 0x60, 0xB6, 0x37, 0xA9,
+    0x90, 0x57, 0x2E, 0xE5, 0x4D, 0x4A, 0x43, 0x8A, 0x34, 0x62, 0xEA, 0xB3, 0x03, 0xE0, 0x10, 0x78,
+    0x00, 0x8C, 0x41, 0x9C, 0x82, 0x3C, 0xBD, 0x10, 0x1F, 0xD9, 0x10, 0x74, 0xBA, 0x77, 0xA4, 0x52,
+    0x1A, 0x91, 0x52, 0x02, 0x16, 0x61, 0x03, 0xC2, 0x45, 0xC9, 0x3D, 0x3C, 0xE5, 0x1F, 0xBD, 0x7E,
+    0xE1, 0xA2, 0x9C, 0x20, 0x23, 0xC6, 0xD3, 0x4A, 0xBE, 0x48, 0xBE, 0xFE, 0x31, 0x81, 0x0C, 0xC0,
+    0x6B, 0x97, 0xED, 0xD5, 0x14, 0x48, 0x29, 0xF2, 0xCC, 0xDF, 0x19, 0x81, 0x18, 0x81, 0x1C, 0xD6,
+    0xC7, 0x22, 0x59, 0x05, 0xBA, 0x02, 0x13, 0xEB, 0x4F, 0x1E, 0xA0, 0x35, 0xBE, 0xE7, 0x4C, 0x8D,
+    0x55, 0x23, 0x20, 0x22, 0xE3, 0x44, 0x3C, 0x7C, 0x7C, 0x74, 0xBB, 0x00, 0x6B, 0xBB, 0x35, 0xAC,
+    0xD6, 0xBA, 0xEF, 0x87, 0x9F, 0x82, 0x95, 0x19, 0xE6, 0x8F, 0xC8, 0xDC, 0x05, 0xD9, 0xFB, 0x98,
+    0x4E, 0xA0, 0x63, 0x66, 0x95, 0x93, 0x9E, 0x48, 0x9B, 0xA5, 0xDA, 0xEB, 0x09, 0x1C, 0xD3, 0x21,
+    0x87, 0x5D, 0x43, 0xCC, 0xD4, 0x2D, 0x67, 0x15, 0xA6, 0x5C, 0x5B, 0x83, 0xA5, 0x99, 0x6F, 0xBE,
+    0x9A, 0x03, 0x14, 0xE3, 0x67, 0xEA, 0xAE, 0x96, 0xC0, 0x02, 0x1B, 0xF3, 0xDB, 0x7D, 0x53, 0x3E,
+    0xBB, 0xD5, 0x9D, 0xFC, 0x8E, 0xE7, 0x73, 0x3F, 0xBD, 0xB6, 0x30, 0x3B, 0xF3, 0x89, 0xD5, 0xBE,
+    0xB4, 0x33, 0x86, 0x4E, 0x87, 0x00, 0x9B, 0xAB, 0xC6, 0x6B, 0x76, 0x85, 0xED, 0x10, 0x96, 0x39,
+    0xB8, 0x26, 0xA3, 0xB1, 0x5D, 0x15, 0x54, 0x38, 0x31, 0xAF, 0xC4, 0xE7, 0xB9, 0x23, 0xA3, 0xE1,
+    0x44, 0x3A, 0xAE, 0x76, 0xE7, 0x60, 0x77, 0x6B, 0x85, 0xE2, 0x37, 0x9E, 0xE9, 0xD2, 0x66, 0xF3,
+    0xCA, 0x4F, 0x7C, 0xEE, 0x2F, 0xDD, 0x84, 0x95, 0xE3, 0x67, 0x79, 0xE7, 0xF9, 0x55, 0x66, 0xFE,
+    0xE1, 0x02, 0xCF, 0x1C, 0x8E, 0x61, 0xAD, 0x73, 0x32, 0x3B, 0xFD, 0xE9, 0x87, 0x6F, 0x7F, 0xAB,
+    0x9A, 0x9D, 0xF9, 0xC4, 0x6A, 0x5F, 0xD8, 0x51, 0x7E, 0x33, 0x6E, 0x4D, 0xBB, 0xC9, 0x4F, 0x6D,
+    0xA6, 0x66, 0x15, 0xC7, 0xD0, 0x98, 0x6F, 0x76, 0x16, 0x8A, 0xFF, 0x7B, 0x75, 0xC7, 0xED, 0xAE,
+    0xDC, 0xAB, 0x89, 0xAC, 0x61, 0xD9, 0x6F, 0xAC, 0x9E, 0x8D, 0x65, 0xF2, 0xD3, 0xA1, 0x14, 0xCF,
+    0x87, 0xF7, 0xC2, 0xBD, 0x3C, 0xF9, 0x95, 0x4F, 0xD8, 0x9D, 0x2F, 0xCF, 0x17, 0x81, 0x17, 0xFE,
+    0xF9, 0xD4, 0xCE, 0xAF, 0x8E, 0x3E, 0xF9, 0xB3, 0x3F, 0xFA, 0xB7, 0x77, 0x40, 0xBA, 0xF2, 0xD7,
+    0x26, 0x4F, 0xAD, 0xCE, 0xAC, 0x00, 0xD2, 0x0A, 0x2F, 0x4A, 0x90, 0x37, 0xBF, 0x54, 0xC6, 0xEA,
+    0xE4, 0xF0, 0xF7, 0xE7, 0xAC, 0x63, 0xCA, 0x0E, 0x26, 0xCE, 0x4C, 0x12, 0x3B, 0x34, 0x17, 0xDB,
+    0xED, 0xFD, 0xCD, 0x5E, 0x6F, 0x67, 0xE7, 0x99, 0x4F, 0x8F, 0x94, 0x6F, 0x03, 0x82, 0x19, 0x16,
+    0x96, 0xD6, 0xFE, 0xCA, 0x6B, 0xFF, 0x20, 0x4A, 0x66, 0x6A, 0x33, 0x56, 0x94, 0xA0, 0x3C, 0x62,
+    0xE0, 0x96, 0xF5, 0x1B, 0xA1, 0x9B, 0x73, 0x18, 0x96, 0x38, 0x17, 0x73, 0x72, 0x78, 0xD5, 0xCC,
+    0x2F, 0x5E, 0x55, 0x15, 0xA0, 0xCB, 0x95, 0xCE, 0x66, 0x6F, 0x25, 0xF7, 0xC0, 0x35, 0x66, 0x00,
+    0x98, 0xE1, 0x2A, 0x2B, 0x0E, 0x0B, 0x37, 0xE1, 0x73, 0xD3, 0xF7, 0x5E, 0x43, 0xDE, 0x7B, 0x4D,
+    0x58, 0xD6, 0x16, 0x2E, 0x64, 0xFE, 0xBC, 0x4E, 0x29, 0x85, 0x9A, 0x7F, 0xD4, 0x25, 0x8A, 0xCC,
+    0x9E, 0x9F, 0xAD, 0xCA, 0x34, 0x52, 0xFF, 0xED, 0x25, 0xE5, 0xC8, 0x2C, 0x1A, 0x4C, 0x0A, 0x8D,
+    0xCF, 0xDA, 0x45, 0x68, 0xC2, 0xF6, 0x3D, 0x7B, 0x98, 0xDC, 0x20, 0xD9, 0xFF, 0x0F, 0xA5, 0x9A,
+    0x6F, 0x8C, 0x9C, 0xC7, 0x7D, 0xDF, 0x3F, 0x33, 0x23, 0x72, 0xC4, 0x7B, 0x6E, 0x77, 0x08, 0x94,
+    0x42, 0x68, 0x69, 0xEF, 0x1E, 0xBE, 0x60, 0x8A, 0x33, 0xBD, 0xBC, 0x3D, 0x14, 0xDB, 0x60, 0x5B,
+    0x3F, 0x77, 0x3B, 0x24, 0xD1, 0xB0, 0xA9, 0x1A, 0x88, 0x69, 0x25, 0xE4, 0x45, 0x8A, 0x9A, 0x0E,
+    0x0C, 0xC3, 0xB0, 0xDD, 0xF0, 0x0A, 0x9C, 0xE1, 0x2B, 0x7A, 0xE4, 0x0E, 0xC5, 0xB8, 0x4A, 0xE3,
+    0x14, 0xBC, 0x18, 0x76, 0x8B, 0x36, 0x75, 0x73, 0x05, 0xF4, 0x42, 0x3E, 0x05, 0xE5, 0x16, 0xBD,
+    0x18, 0x97, 0xF4, 0xC4, 0x1D, 0x8A, 0x68, 0x85, 0xC2, 0xA9, 0x35, 0x36, 0xED, 0x06, 0x2D, 0x5A,
+    0xEB, 0xD1, 0x9F, 0x56, 0x35, 0x95, 0x44, 0x23, 0xE9, 0x71, 0xBC, 0x14, 0xF7, 0x76, 0xFA, 0x62,
+    0x97, 0x94, 0xE4, 0x18, 0x70, 0xDB, 0x3C, 0xC0, 0xFE, 0xC1, 0x60, 0x76, 0x7E, 0x33, 0xBF, 0xF9,
+    0xFD, 0xFD, 0x7E, 0x17, 0x1E, 0x6A, 0xA5, 0xC4, 0x1A, 0xF4, 0xA1, 0x44, 0x94, 0xC8, 0x54, 0xAA,
+    0x1F, 0xAC, 0x2B, 0xDF, 0xD4, 0xB6, 0x91, 0xD1, 0x34, 0x74, 0xEA, 0x32, 0x9E, 0xD4, 0x0E, 0x80,
+    0x06, 0x2C, 0x41, 0xC9, 0xFB, 0x1E, 0x91, 0xC6, 0xF2, 0xBB, 0x8F, 0x2B, 0x8F, 0x72, 0x68, 0x87,
+    0xB1, 0x18, 0xC8, 0x61, 0x11, 0x96, 0xA1, 0x80, 0x3D, 0x20, 0x1B, 0xD2, 0x3A, 0xEB, 0x4F, 0xD2,
+    0x99, 0x67, 0xC6, 0x80, 0xBA, 0xBD, 0x25, 0xD3, 0x88, 0x08, 0x05, 0x98, 0x70, 0xE1, 0x4A, 0x4A,
+    0x7E, 0x90, 0x82, 0x4E, 0x13, 0x29, 0x0C, 0x22, 0xAD, 0xE4, 0xC5, 0x1D, 0x30, 0x16, 0x3A, 0x20,
+    0x2A, 0x50, 0xC9, 0xA2, 0x52, 0x09, 0x17, 0x4A, 0x68, 0x79, 0x18, 0xF0, 0xE5, 0x47, 0x46, 0x59,
+    0x4A, 0x61, 0x90, 0x46, 0x62, 0x30, 0xB6, 0x00, 0x6C, 0xB0, 0x4B, 0x45, 0x14, 0x51, 0x96, 0x2A,
+    0x28, 0xAF, 0x7D, 0xE6, 0x8C, 0x33, 0x36, 0xA7, 0x4B, 0x17, 0xB6, 0xCE, 0x67, 0x57, 0xFC, 0x4A,
+    0xEB, 0xFE, 0xE6, 0xB5, 0x67, 0x11, 0x2A, 0x94, 0x27, 0x87, 0x5D, 0x54, 0xC0, 0xC0, 0x06, 0xB2,
+    0xC4, 0x38, 0x96, 0x11, 0x11, 0xE3, 0xE9, 0x4E, 0x67, 0x4F, 0x8E, 0xB4, 0x01, 0xBB, 0x50, 0x41,
+    0x44, 0x46, 0x54, 0x40, 0x79, 0xB4, 0x27, 0x73, 0xD3, 0x83, 0xAF, 0xC0, 0x1E, 0xF9, 0x90, 0x6E,
+    0xC9, 0x8A, 0x85, 0x03, 0x4F, 0x80, 0x49, 0x25, 0x8A, 0x36, 0xC2, 0x37, 0x60, 0x2B, 0x83, 0xB6,
+    0x72, 0x34, 0x48, 0xE5, 0x0C, 0xFD, 0xBA, 0xB2, 0x85, 0xBC, 0xEC, 0xEB, 0x94, 0x5B, 0xFA, 0x74,
+    0xB5, 0x26, 0xD3, 0x70, 0x8F, 0x54, 0x1D, 0xB9, 0xBF, 0xC5, 0x52, 0x38, 0xDA, 0x6C, 0xD1, 0xA0,
+    0xCD, 0x0C, 0x0D, 0xD4, 0x57, 0x3E, 0x06, 0x29, 0x25, 0xD7, 0x27, 0x34, 0x3B, 0xAC, 0xEA, 0x1A,
+    0x85, 0x7C, 0x81, 0xBA, 0x7E, 0xC5, 0xEB, 0x14, 0x4B, 0x99, 0x26, 0xB7, 0xD3, 0x4A, 0xE9, 0x66,
+    0x4A, 0x43, 0xE6, 0x41, 0x06, 0x28, 0x40, 0xBD, 0x19, 0x18, 0x24, 0x8C, 0xEF, 0x13, 0x33, 0x72,
+    0xFA, 0xAA, 0xAC, 0xB3, 0x2C, 0x82, 0xF6, 0x05, 0x23, 0xE5, 0xA7, 0xE2, 0x02, 0x64, 0xC0, 0xEA,
+    0xFD, 0xEB, 0x2D, 0x37, 0xC8, 0xCE, 0x04, 0x8A, 0x65, 0xC4, 0xAB, 0x25, 0xD9, 0x05, 0x58, 0x8E,
+    0x88, 0x04, 0x59, 0x05, 0x5D, 0x8F, 0x48, 0x9E, 0x6C, 0x60, 0x29, 0x7A, 0x88, 0x98, 0x30, 0x4F,
+    0xEE, 0xB3, 0xAC, 0x46, 0xC0, 0x26, 0x88, 0x12, 0xC4, 0x26, 0x00, 0xBB, 0x7C, 0x4A, 0x05, 0x5D,
+    0x1A, 0xBA, 0x76, 0x5D, 0x8D, 0x64, 0x68, 0x45, 0x23, 0xDF, 0x70, 0x1B, 0xF9, 0xB2, 0x2C, 0xDF,
+    0x8A, 0xE6, 0xB1, 0x47, 0x7D, 0x51, 0xAD, 0x88, 0xBB, 0x97, 0x2B, 0x33, 0x32, 0xBE, 0xEB, 0xBB,
+    0x62, 0x24, 0x2B, 0x38, 0x22, 0xD1, 0xD2, 0x91, 0x1C, 0x07, 0xED, 0x74, 0x3F, 0x75, 0xDA, 0xCA,
+    0x17, 0xF4, 0xE7, 0x98, 0x33, 0xA8, 0x17, 0x2C, 0xEF, 0x78, 0x5A, 0x25, 0x59, 0x44, 0x0C, 0x61,
+    0x03, 0x56, 0x60, 0x80, 0x1A, 0xC3, 0x1D, 0x10, 0x4E, 0xDA, 0x28, 0x42, 0x87, 0xFE, 0x1C, 0x9D,
+    0x8C, 0x39, 0xE5, 0x33, 0x4A, 0xE5, 0xD7, 0x28, 0x9B, 0xAC, 0x19, 0x9A, 0xFA, 0xF6, 0x35, 0x99,
+    0x92, 0x23, 0xC0, 0x12, 0x34, 0x26, 0x12, 0x6A, 0x70, 0x12, 0x16, 0xEE, 0x5F, 0xC0, 0xC1, 0x8A,
+    0x9D, 0x76, 0xC6, 0xF9, 0x7F, 0x70, 0xED, 0xF9, 0xF4, 0xFD, 0x1A, 0x74, 0xE0, 0xCE, 0x01, 0x99,
+    0x2A, 0x91, 0x1C, 0x4D, 0xF8, 0x2B, 0xE7, 0x44, 0xDA, 0x9A, 0x7A, 0xCF, 0x7F, 0xDB, 0x94, 0xA9,
+    0x52, 0xD5, 0xBA, 0xF2, 0x9D, 0xCC, 0xB6, 0x0D, 0xAB, 0x86, 0xFE, 0x3C, 0x71, 0x59, 0x94, 0x85,
+    0x2E, 0xC9, 0x4B, 0x72, 0x0F, 0x20, 0x1D, 0xAB, 0xD4, 0xC0, 0x02, 0xBD, 0x94, 0x41, 0xC4, 0x20,
+    0x4A, 0x4E, 0xA2, 0x3C, 0x05, 0x99, 0x87, 0x4F, 0xD3, 0x69, 0xCE, 0x70, 0xC3, 0xD3, 0xAA, 0x94,
+    0x65, 0xF9, 0x61, 0x95, 0xA2, 0x19, 0x02, 0xB4, 0x4A, 0xF5, 0x15, 0x16, 0xA0, 0x8F, 0xD8, 0x47,
+    0x5C, 0x87, 0x42, 0xFC, 0xD3, 0xD8, 0x4A, 0xAE, 0x37, 0x84, 0xE3, 0xB2, 0x34, 0x16, 0x10, 0x34,
+    0x29, 0x95, 0x6D, 0xB0, 0xA5, 0xDC, 0x1C, 0x51, 0x79, 0x8C, 0x7E, 0xEA, 0xE6, 0x2B, 0x5B, 0x4F,
+    0x03, 0xB0, 0x4A, 0x87, 0x1A, 0x1A, 0xE9, 0x29, 0x59, 0xA3, 0xC0, 0x00, 0x14, 0xC8, 0xC8, 0xCC,
+    0xD4, 0xFF, 0x94, 0x63, 0x0E, 0xFA, 0x28, 0x47, 0x0D, 0x56, 0x91, 0x9E, 0x1A, 0x2C, 0x21, 0x3D,
+    0x75, 0xE8, 0x73, 0xC1, 0xA9, 0x21, 0x00, 0xBD, 0xC8, 0xB1, 0xE3, 0xCC, 0xCE, 0x22, 0x15, 0xF2,
+    0xD4, 0x18, 0xBF, 0xB5, 0x79, 0xBE, 0x7D, 0xFC, 0x78, 0x6D, 0xAF, 0xD0, 0x23, 0x80, 0x07, 0x60,
+    0x56, 0x31, 0xAB, 0x38, 0x7E, 0x90, 0x6E, 0xAA, 0x96, 0x66, 0x67, 0xCF, 0x37, 0x66, 0x37, 0x17,
+    0x77, 0x7D, 0xB7, 0x04, 0xFE, 0x1F, 0xD4, 0x27, 0x03, 0x6C, 0xA1, 0xA1, 0x3D, 0x51, 0x9B, 0x3A,
+    0xE3, 0x1A, 0x05, 0xEF, 0x78, 0xB5, 0x47, 0xCB, 0x33, 0x42, 0x8F, 0x68, 0x0E, 0x79, 0xA5, 0xCA,
+    0xCE, 0x44, 0x78, 0x10, 0x4E, 0x42, 0x73, 0x72, 0x96, 0x86, 0x88, 0xFD, 0xFC, 0xCA, 0xE5, 0xFF,
+    0x51, 0xAB, 0x2D, 0xAD, 0xBE, 0xF2, 0xFC, 0x37, 0xEB, 0xF5, 0xB2, 0xDD, 0x93, 0xCF, 0x47, 0x03,
+    0x0F, 0x0A, 0xD4, 0x29, 0xCF, 0xC0, 0xBF, 0x67, 0x5D, 0x40, 0x46, 0x21, 0xC2, 0x1C, 0x1D, 0x83,
+    0xD1, 0x56, 0xDD, 0xF4, 0xFC, 0x7E, 0x20, 0x8F, 0xA8, 0x21, 0x8C, 0x60, 0x05, 0x72, 0x68, 0x59,
+    0x91, 0x2C, 0xD7, 0x27, 0x3F, 0x90, 0x9C, 0x5B, 0xAD, 0xCD, 0xE0, 0x43, 0x63, 0x56, 0x5E, 0xF6,
+    0xED, 0x05, 0xAD, 0xEC, 0x56, 0x77, 0x9F, 0xE3, 0x28, 0x38, 0x8C, 0xF4, 0x2A, 0x0D, 0x5B, 0xB7,
+    0x59, 0x25, 0x83, 0x54, 0x1A, 0x79, 0x39, 0x34, 0x9A, 0xF2, 0xCA, 0xBB, 0x55, 0x37, 0x89, 0x14,
+    0x26, 0xC6, 0x50, 0xB2, 0x46, 0x1A, 0x19, 0xD4, 0x77, 0xC4, 0xB8, 0xBF, 0x3B, 0x53, 0xC8, 0xAB,
+    0x07, 0x6F, 0xA5, 0x98, 0x2A, 0x80, 0x6E, 0x4A, 0x36, 0xBF, 0x7D, 0xCD, 0xAB, 0x98, 0x79, 0x2E,
+    0x66, 0x9E, 0xEC, 0x8B, 0x0E, 0x92, 0x45, 0xA4, 0x0A, 0x79, 0xEB, 0x8B, 0xC8, 0x1B, 0x21, 0x88,
+    0xD0, 0x6F, 0x13, 0x3B, 0x35, 0x76, 0xE6, 0x95, 0x03, 0xF2, 0x14, 0x0B, 0xC3, 0xE7, 0x82, 0xD8,
+    0xE7, 0xC3, 0xFF, 0x59, 0xBC, 0x70, 0x74, 0x76, 0xE1, 0xFC, 0xD6, 0xB7, 0x3C, 0x40, 0xCB, 0x15,
+    0xF2, 0x75, 0x17, 0x8C, 0x7E, 0x8C, 0xAF, 0x0F, 0x2A, 0x06, 0xC9, 0xEA, 0x90, 0xB3, 0xCC, 0xB2,
+    0x28, 0xA9, 0x0C, 0xCA, 0x17, 0xE4, 0x22, 0xB2, 0xA3, 0x43, 0xE6, 0x4D, 0xDA, 0xA7, 0x95, 0x02,
+    0xAD, 0xC9, 0x5D, 0x8B, 0xAA, 0xA1, 0x7F, 0xBE, 0x63, 0x06, 0xA5, 0xBA, 0x1D, 0x0C, 0x65, 0x83,
+    0x7E, 0x41, 0xEC, 0x50, 0x76, 0xA4, 0x5F, 0xB9, 0xE6, 0x5A, 0x63, 0xB2, 0xEA, 0xBE, 0x12, 0x1F,
+    0x76, 0xA0, 0xD2, 0x5F, 0x83, 0xDE, 0x70, 0x1D, 0x55, 0x8A, 0xC8, 0x32, 0xDA, 0xCB, 0x48, 0x8E,
+    0x81, 0x82, 0x21, 0x44, 0xED, 0x51, 0x61, 0x19, 0xCC, 0x99, 0x08, 0x2B, 0xB9, 0x85, 0xE1, 0x10,
+    0x54, 0xF2, 0x60, 0xC6, 0x40, 0x37, 0x02, 0xE9, 0xDE, 0xCD, 0xC8, 0xEF, 0x71, 0xB2, 0x10, 0xA1,
+    0x5F, 0x97, 0xBE, 0x9F, 0x29, 0xD7, 0x2C, 0xF8, 0x7A, 0x10, 0x09, 0x1D, 0xC9, 0x1D, 0x74, 0xB8,
+    0x95, 0x68, 0xB2, 0x09, 0x12, 0x84, 0xCF, 0x53, 0x99, 0x3D, 0x71, 0x4E, 0x79, 0x28, 0x61, 0x1D,
+    0x96, 0xC1, 0x80, 0xF6, 0xC8, 0x12, 0x2A, 0x28, 0xE0, 0x7E, 0x0E, 0x08, 0x68, 0x91, 0x46, 0x19,
+    0x14, 0x10, 0xD1, 0x8E, 0x93, 0x10, 0x51, 0x9E, 0xD6, 0x07, 0x73, 0x5B, 0x9E, 0xAA, 0xFC, 0xF6,
+    0xD6, 0x9F, 0xCD, 0x6D, 0x3A, 0x49, 0x47, 0xC9, 0xA0, 0x6A, 0x90, 0xA1, 0x9C, 0x08, 0xB0, 0xBD,
+    0xED, 0x4C, 0x1A, 0x09, 0x0F, 0x4D, 0x50, 0x0E, 0xD6, 0x20, 0x4B, 0x8E, 0xFD, 0xBF, 0x8B, 0xA1,
+    0x2F, 0x82, 0xA6, 0x49, 0x5F, 0xF9, 0x3A, 0xEB, 0x99, 0xCF, 0x4E, 0x97, 0x80, 0x1E, 0x1D, 0x62,
+    0x96, 0xF9, 0xAD, 0xE6, 0xF1, 0xF6, 0xF1, 0xA5, 0xA5, 0x8F, 0x07, 0x96, 0xB3, 0xB8, 0x42, 0x2B,
+    0x8B, 0xBB, 0x98, 0xEC, 0x5B, 0x11, 0x73, 0xF5, 0x05, 0x8F, 0x7E, 0xF1, 0x45, 0x8B, 0x7A, 0xE9,
+    0x3A, 0xC8, 0x34, 0x04, 0x52, 0x04, 0x91, 0x4A, 0xD0, 0xA9, 0x82, 0x56, 0x1A, 0xC1, 0xE0, 0xFA,
+    0x18, 0x39, 0x1A, 0x0F, 0x6C, 0x56, 0xED, 0x77, 0x7D, 0xF7, 0xDB, 0xFB, 0xAD, 0xEF, 0x03, 0xCC,
+    0x4E, 0x73, 0x37, 0x20, 0x9E, 0xDC, 0x74, 0x73, 0xCB, 0x1D, 0xDE, 0xF9, 0x26, 0xFA, 0x1F, 0x7A,
+    0xBA, 0x11, 0xB5, 0x0F, 0x83, 0x48, 0x37, 0x39, 0x73, 0x6D, 0x43, 0xBD, 0xFA, 0x6A, 0x05, 0x38,
+    0x78, 0x80, 0x87, 0xAC, 0x4A, 0xFE, 0x01, 0xED, 0xA8, 0xC3, 0x8E, 0xF8, 0x25, 0x67, 0x2A, 0xE8,
+    0x43, 0x20, 0x3B, 0x73, 0x6A, 0xCF, 0x24, 0xDF, 0x1A, 0xA2, 0x61, 0x01, 0xC4, 0x33, 0xE2, 0x20,
+    0x92, 0x59, 0x59, 0xD1, 0x64, 0x61, 0x31, 0x76, 0xDD, 0x61, 0x1E, 0xE2, 0x20, 0xBB, 0x70, 0x52,
+    0x7B, 0x75, 0x23, 0x52, 0x2C, 0x93, 0x3D, 0x66, 0x79, 0xBB, 0xC4, 0xEC, 0x21, 0x13, 0x74, 0x3D,
+    0x7A, 0x04, 0x83, 0x12, 0xD3, 0xB3, 0xE2, 0xED, 0x11, 0x2D, 0x53, 0xAA, 0x30, 0xB0, 0x1B, 0x7A,
+    0x74, 0x0C, 0x0E, 0x02, 0x41, 0x3C, 0xE9, 0x16, 0xFA, 0xEA, 0xB3, 0x7C, 0xDE, 0x66, 0x81, 0x21,
+    0x79, 0x50, 0x2F, 0xD1, 0x1E, 0xEA, 0x2C, 0x80, 0x9B, 0x64, 0x82, 0x65, 0x11, 0x32, 0x7B, 0xF2,
+    0x37, 0x4B, 0xF5, 0x3B, 0xEB, 0x7C, 0xFE, 0x45, 0xB2, 0xAE, 0x27, 0x45, 0xE6, 0x07, 0x4E, 0x7D,
+    0xE3, 0x39, 0x8A, 0x77, 0x2A, 0x7D, 0x35, 0xF7, 0x15, 0x09, 0x60, 0x56, 0xB9, 0xCF, 0x35, 0xE5,
+    0xD7, 0x7D, 0x6D, 0x44, 0x2F, 0xA8, 0x6B, 0xBE, 0xF1, 0xBA, 0xFF, 0xB7, 0x8F, 0x39, 0xE6, 0xB5,
+    0xCF, 0x47, 0x15, 0x1B, 0xCB, 0xE8, 0xAB, 0x8E, 0x3F, 0x2D, 0x31, 0x7B, 0x88, 0x04, 0xDD, 0x80,
+    0x1A, 0x41, 0x2F, 0x62, 0x06, 0x8E, 0xB7, 0x46, 0xE4, 0x26, 0xAA, 0x72, 0x60, 0x97, 0xD5, 0x08,
+    0x0E, 0xA3, 0xAD, 0x49, 0x7C, 0xEC, 0x9C, 0x08, 0x34, 0x3B, 0xEA, 0x45, 0x3E, 0xEA, 0xB3, 0x48,
+    0xA2, 0x3E, 0x14, 0x7F, 0x18, 0x8A, 0xAE, 0xBA, 0x31, 0xEA, 0xA6, 0xCB, 0x71, 0xFB, 0x39, 0x63,
+    0x89, 0x15, 0xFA, 0xAA, 0x63, 0x79, 0x0F, 0xEE, 0x4E, 0x4E, 0xDC, 0x0D, 0x90, 0x40, 0x27, 0x58,
+    0x19, 0xC3, 0x5B, 0x23, 0xF4, 0xCD, 0x11, 0x2B, 0x59, 0x45, 0x65, 0x22, 0xA0, 0xC7, 0x73, 0xDC,
+    0x72, 0x8D, 0x52, 0x8E, 0xE8, 0xA2, 0x03, 0x03, 0xEA, 0xBB, 0xE2, 0x66, 0x68, 0x76, 0xE1, 0x08,
+    0x47, 0xD8, 0xA1, 0x20, 0xB2, 0x41, 0x64, 0x57, 0x44, 0x2A, 0x59, 0x12, 0x55, 0x10, 0x51, 0x7B,
+    0x15, 0xB3, 0x94, 0x4A, 0x93, 0x52, 0x30, 0x29, 0xF9, 0xDC, 0x1A, 0xDF, 0xC2, 0xB8, 0x2E, 0x2D,
+    0x7B, 0x89, 0xEE, 0xEC, 0xF4, 0xFA, 0x8F, 0x03, 0x35, 0xC2, 0xAA, 0x96, 0xBE, 0x59, 0xA7, 0x6C,
+    0xEB, 0x53, 0x69, 0x3F, 0x4B, 0xB1, 0xD0, 0xBE, 0x9C, 0xCF, 0xEC, 0xEF, 0x4E, 0x0D, 0x05, 0x94,
+    0x93, 0x69, 0xC4, 0x0E, 0x2B, 0xDB, 0xCE, 0xA0, 0x3D, 0x44, 0x76, 0x21, 0xC7, 0x58, 0x64, 0x29,
+    0x22, 0x2C, 0xD3, 0x02, 0x9D, 0x52, 0x09, 0x83, 0x34, 0x06, 0x93, 0x52, 0x80, 0x8A, 0x11, 0xB4,
+    0x30, 0x1E, 0x15, 0xC5, 0x10, 0x56, 0x68, 0x59, 0x50, 0x74, 0x63, 0x43, 0x7A, 0xB6, 0xEA, 0x28,
+    0xD7, 0x66, 0x4E, 0x04, 0x06, 0x09, 0x95, 0x46, 0xD4, 0x45, 0xC9, 0x5A, 0x66, 0xA5, 0x2F, 0x40,
+    0x6C, 0x6F, 0x43, 0x37, 0x45, 0x94, 0xCB, 0x61, 0x4D, 0x96, 0x64, 0x2C, 0x43, 0x54, 0x9E, 0x3A,
+    0x97, 0xF6, 0x45, 0xC8, 0xFE, 0xE7, 0x4E, 0x93, 0xA1, 0xBA, 0xE2, 0x0D, 0x9D, 0x42, 0x94, 0xEA,
+    0xAC, 0x3B, 0xC9, 0xEA, 0x8E, 0xF2, 0xBF, 0x62, 0x28, 0x8C, 0x03, 0x50, 0x69, 0x1F, 0xE5, 0x9A,
+    0x68, 0x5B, 0x90, 0xB1, 0x8E, 0x61, 0x87, 0x79, 0x22, 0x27, 0x29, 0x29, 0x44, 0xAA, 0x3A, 0xB2,
+    0x2A, 0x50, 0x7E, 0x0E, 0x6D, 0x6B, 0x64, 0x34, 0x30, 0xAC, 0x63, 0x54, 0xE4, 0x90, 0x98, 0x44,
+    0x19, 0xB1, 0x0B, 0x72, 0x1F, 0x54, 0x04, 0x59, 0xEA, 0x7D, 0x4A, 0x73, 0xDA, 0xF7, 0x33, 0x56,
+    0x3B, 0x9A, 0xCE, 0x9C, 0xF4, 0xCD, 0x8C, 0x72, 0x59, 0xF9, 0xE2, 0x12, 0xFB, 0x66, 0xFC, 0xD9,
+    0x3C, 0xA5, 0x24, 0x52, 0xBA, 0x83, 0xB8, 0x17, 0xA2, 0x4A, 0x18, 0x42, 0x47, 0x57, 0x99, 0xBC,
+    0xEC, 0xC3, 0xEA, 0xD1, 0x46, 0x4D, 0x9D, 0x76, 0x37, 0xCA, 0xA2, 0xB6, 0x7B, 0x3A, 0xA5, 0x3D,
+    0xFD, 0xEE, 0xF8, 0xBD, 0x9A, 0x62, 0x9F, 0x2C, 0x05, 0x55, 0xC1, 0x10, 0x56, 0x40, 0x7B, 0xA8,
+    0x20, 0x07, 0x19, 0xA1, 0x0B, 0x6A, 0x88, 0xED, 0xA6, 0x91, 0x4C, 0xC9, 0x99, 0x54, 0xD1, 0x4A,
+    0x13, 0xA7, 0x38, 0x06, 0xCB, 0x93, 0xF2, 0xCE, 0x5F, 0x3A, 0x5F, 0x70, 0x12, 0x83, 0x72, 0xA2,
+    0x64, 0x19, 0x33, 0x66, 0xE0, 0x70, 0x99, 0xA3, 0x9B, 0xD2, 0x8B, 0x29, 0x95, 0x22, 0x30, 0x2D,
+    0xB0, 0xE7, 0x21, 0xB3, 0xA8, 0x80, 0x88, 0xB0, 0x37, 0xC9, 0x61, 0x96, 0xCC, 0xA3, 0x86, 0x50,
+    0x03, 0x09, 0xDD, 0xF4, 0x85, 0xCF, 0xD9, 0x06, 0x33, 0x28, 0x2B, 0x3C, 0x7D, 0x0A, 0xE6, 0xC9,
+    0x1C, 0xE7, 0x81, 0x75, 0x16, 0x0B, 0x36, 0x96, 0x89, 0x8B, 0x2A, 0xB4, 0x8C, 0xCD, 0x17, 0x31,
+    0x23, 0x4C, 0x24, 0x0B, 0x64, 0x1E, 0xE3, 0x68, 0x59, 0xBA, 0x30, 0x80, 0x35, 0xF5, 0x94, 0xEB,
+    0x77, 0xEA, 0xEA, 0x8A, 0x2F, 0xD6, 0xD4, 0x37, 0x59, 0xF1, 0xB2, 0xA2, 0x85, 0x0A, 0x14, 0x68,
+    0xCF, 0x3C, 0xD9, 0x15, 0xAF, 0x5D, 0xA5, 0xFC, 0xA2, 0xF2, 0xD9, 0xCD, 0x20, 0xFE, 0xB4, 0xA4,
+    0x1B, 0x31, 0x91, 0x6E, 0x72, 0x33, 0x63, 0xC7, 0x0A, 0xB4, 0x2C, 0xC6, 0x93, 0x45, 0xC0, 0x1D,
+    0x60, 0x4D, 0xDB, 0xBA, 0xF2, 0xEA, 0x49, 0x4F, 0x59, 0x52, 0x44, 0xCC, 0x1A, 0x6A, 0xC8, 0x89,
+    0xB4, 0x65, 0xD2, 0x68, 0x1A, 0xCF, 0x39, 0x77, 0x3F, 0x6B, 0x2B, 0x2F, 0x4A, 0xE5, 0x29, 0x94,
+    0x27, 0xBB, 0xE2, 0x11, 0xEF, 0x84, 0x89, 0xB3, 0x65, 0x25, 0xA8, 0x0A, 0xD4, 0x18, 0xD4, 0x5D,
+    0x8F, 0x8A, 0x43, 0x54, 0xEC, 0xA2, 0x62, 0x56, 0xAA, 0x8A, 0xD1, 0xD2, 0xD4, 0x37, 0x66, 0x10,
+    0xEE, 0x28, 0x7E, 0x95, 0x97, 0x03, 0x9F, 0xB7, 0x93, 0x42, 0x5F, 0xEC, 0xA3, 0xAE, 0x62, 0x8C,
+    0x2D, 0xF4, 0xAF, 0xC2, 0x83, 0x40, 0x37, 0x3D, 0xFF, 0x85, 0x8B, 0x36, 0xD4, 0x59, 0xD2, 0xB6,
+    0x21, 0xFD, 0x0C, 0x51, 0xD9, 0x0E, 0x7E, 0x8E, 0x7E, 0x46, 0x47, 0xF9, 0x3A, 0x29, 0xC5, 0x5E,
+    0x1A, 0x41, 0x1D, 0xB4, 0x45, 0xFA, 0xC1, 0x5B, 0x4F, 0xBA, 0xCD, 0xB0, 0xB4, 0x34, 0xDB, 0x38,
+    0x34, 0xA3, 0xD4, 0xF6, 0xCB, 0x69, 0x84, 0x46, 0x3A, 0x38, 0xCA, 0x56, 0x5F, 0x5D, 0xF1, 0x73,
+    0x35, 0xFA, 0xAB, 0xEA, 0x86, 0x5F, 0xD4, 0x3F, 0x5B, 0x65, 0x77, 0x3D, 0x75, 0x58, 0x43, 0x7A,
+    0x0C, 0x7C, 0xD4, 0xF1, 0x55, 0x58, 0x45, 0xD8, 0x07, 0x0E, 0x34, 0x66, 0x16, 0x6A, 0xC7, 0x67,
+    0x8F, 0x17, 0xF9, 0x90, 0x36, 0x4B, 0x9C, 0xE7, 0x77, 0x38, 0xCA, 0x91, 0x3A, 0xCD, 0x36, 0xAF,
+    0x78, 0xFD, 0x18, 0xCD, 0x0E, 0x6F, 0xDD, 0x7A, 0xF4, 0xA9, 0x7F, 0xB2, 0x6F, 0x52, 0xCC, 0x5F,
+    0x77, 0xB5, 0x93, 0xAC, 0x46, 0xCE, 0x7A, 0x50, 0xDC, 0xF0, 0xAB, 0x9B, 0xED, 0x9F, 0xF9, 0x3B,
+    0xF5, 0x37, 0xC5, 0x5D, 0x77, 0x34, 0x1C, 0x5A, 0x05, 0x47, 0x13, 0xE5, 0xE9, 0xA0, 0x2D, 0x7D,
+    0xCC, 0xC0, 0xDD, 0x99, 0x9B, 0xE7, 0x96, 0xAF, 0x75, 0xC4, 0x0B, 0xB6, 0xB9, 0xA3, 0x5E, 0x64,
+    0x9D, 0x26, 0x74, 0x60, 0x69, 0xDA, 0x16, 0xF2, 0x5F, 0xDE, 0xAB, 0xCC, 0xF4, 0x8F, 0xA9, 0xCC,
+    0xCE, 0x69, 0x9B, 0xCA, 0x8B, 0xCF, 0xA9, 0x53, 0x83, 0xD7, 0x9A, 0xEA, 0xA5, 0xE4, 0x07, 0x69,
+    0x64, 0xBE, 0x76, 0x4E, 0x94, 0x90, 0x83, 0x18, 0x82, 0x49, 0xFB, 0xF4, 0x92, 0x67, 0xF0, 0x1A,
+    0xC7, 0x5A, 0x67, 0xBE, 0x7A, 0x28, 0xBB, 0xB3, 0x95, 0xC6, 0xF5, 0xC7, 0x85, 0x67, 0x1E, 0x52,
+    0x25, 0xC7, 0xC0, 0xB9, 0x8C, 0x14, 0x2E, 0xFE, 0x9E, 0x3A, 0x35, 0x78, 0x6D, 0x41, 0x5D, 0x9B,
+    0x2E, 0xF2, 0xF8, 0x7B, 0x8B, 0x58, 0x93, 0x46, 0xF7, 0x16, 0x61, 0x75, 0xE2, 0x0F, 0x1C, 0xCA,
+    0xCA, 0x1F, 0x5E, 0xBE, 0x3C, 0xFE, 0x97, 0xF3, 0xE9, 0xE6, 0x57, 0x6C, 0x1B, 0x15, 0x0E, 0xB7,
+    0x12, 0x83, 0xC0, 0x79, 0x1E, 0xF8, 0x49, 0xBD, 0x20, 0x0F, 0x4A, 0x40, 0x4B, 0x0F, 0x24, 0x0F,
+    0x1F, 0xA8, 0x02, 0x41, 0x95, 0xBD, 0xD3, 0x25, 0x1B, 0xF9, 0x8D, 0x88, 0x79, 0xF4, 0xE5, 0x88,
+    0x7C, 0xBB, 0xAA, 0xA0, 0x18, 0x55, 0x60, 0xAE, 0xEF, 0x82, 0x48, 0x23, 0xA0, 0x3B, 0x02, 0xF2,
+    0x04, 0xE4, 0xA9, 0x84, 0x3C, 0x8D, 0x20, 0x7F, 0x33, 0x79, 0x5A, 0x2F, 0xBD, 0x5E, 0xD1, 0xBA,
+    0x35, 0x4C, 0xB4, 0x5E, 0x1E, 0xE7, 0x11, 0x38, 0xF7, 0x20, 0x64, 0xCA, 0x42, 0xAF, 0x9C, 0x74,
+    0x47, 0xF7, 0x9F, 0x23, 0x07, 0x4E, 0x59, 0xF5, 0x7C, 0xB5, 0xCE, 0x62, 0x77, 0x1E, 0xDE, 0xF9,
+    0x43, 0x87, 0xB9, 0x58, 0x42, 0x6F, 0x08, 0x2A, 0x4D, 0x13, 0x7D, 0x2F, 0x39, 0xF2, 0xC1, 0x73,
+    0x64, 0xAF, 0xBF, 0x1E, 0xD5, 0x70, 0xDC, 0x75, 0x9C, 0x3B, 0x42, 0xB9, 0x23, 0x9E, 0x0F, 0xF2,
+    0x05, 0xA7, 0xFE, 0x15, 0x7A, 0x83, 0x2C, 0x62, 0xEE, 0x30, 0x97, 0xBB, 0x42, 0xF9, 0x42, 0x84,
+    0x75, 0x19, 0x2A, 0xE5, 0xD1, 0x8E, 0x0B, 0x88, 0xD1, 0xB4, 0x0F, 0xFB, 0xB8, 0x3F, 0xEE, 0x67,
+    0x83, 0x0E, 0xAA, 0xE2, 0xDB, 0x7E, 0xB5, 0xDD, 0xA9, 0x91, 0x91, 0x73, 0x00, 0x66, 0xB6, 0x9D,
+    0x4E, 0xA5, 0x0C, 0x6B, 0xC4, 0x26, 0x85, 0xE1, 0xA4, 0x76, 0x46, 0x06, 0xE5, 0xA3, 0x0C, 0x05,
+    0x71, 0x9E, 0x75, 0x63, 0x2F, 0xAA, 0xD1, 0x8A, 0xD8, 0x87, 0x16, 0x18, 0x38, 0xE8, 0x00, 0x33,
+    0xE2, 0xDB, 0xBE, 0xD1, 0x56, 0x57, 0x58, 0x5A, 0xD5, 0x75, 0x42, 0x59, 0xE4, 0x50, 0xD2, 0x9C,
+    0x24, 0xAB, 0x75, 0x96, 0xDF, 0x9F, 0xB0, 0x64, 0x49, 0xA5, 0x82, 0x88, 0x2A, 0xC8, 0xA8, 0x53,
+    0x2A, 0xB3, 0x69, 0xB2, 0x32, 0x93, 0x64, 0xE5, 0xBB, 0xE4, 0x7E, 0x85, 0x96, 0x07, 0xE3, 0xA1,
+    0xE5, 0x26, 0x87, 0x07, 0x60, 0x56, 0xF8, 0xD5, 0x4C, 0xBA, 0x4E, 0x9D, 0xB0, 0xA6, 0x65, 0x1A,
+    0x99, 0x14, 0x3B, 0xFA, 0x72, 0x58, 0xCC, 0x18, 0xA2, 0x02, 0x83, 0x89, 0x1A, 0xFF, 0xAF, 0x45,
+    0x86, 0xF7, 0x89, 0x74, 0x93, 0x2C, 0x65, 0x1C, 0xE4, 0xC0, 0x0A, 0xB0, 0x01, 0x3C, 0xFD, 0x67,
+    0xC4, 0x9E, 0xBE, 0x2F, 0xF6, 0x64, 0x46, 0x44, 0x06, 0xCC, 0xB4, 0x4F, 0x3E, 0xC4, 0xD6, 0x9A,
+    0x7A, 0xDE, 0x9B, 0x3A, 0xEB, 0x6D, 0xE9, 0x83, 0x51, 0x5F, 0x18, 0xEA, 0x14, 0x26, 0x95, 0x2E,
+    0x25, 0xDA, 0x4E, 0x3F, 0x01, 0xFC, 0xDF, 0x52, 0x9F, 0x98, 0x0D, 0xFF, 0xEE, 0xB7, 0x9E, 0xFA,
+    0x63, 0xFA, 0xCA, 0x1F, 0xBD, 0x67, 0x07, 0x2A, 0x72, 0x89, 0xAE, 0x35, 0x21, 0xAB, 0xE4, 0x88,
+    0xE4, 0x7A, 0xBE, 0x3E, 0x32, 0x7B, 0xF2, 0xA5, 0xE7, 0xEF, 0xBA, 0xE5, 0xBD, 0x8D, 0x4A, 0x7D,
+    0xE3, 0xA5, 0xDF, 0xB6, 0x1B, 0xBD, 0xB7, 0xA3, 0x79, 0x6A, 0xBF, 0x4B, 0xD5, 0x7D, 0xAA, 0xCC,
+    0xCF, 0xC4, 0xEB, 0x2A, 0x2E, 0x9B, 0xD0, 0x45, 0x8C, 0x26, 0x0B, 0x4C, 0x72, 0x43, 0xE6, 0x81,
+    0x0A, 0x78, 0x18, 0xE9, 0x0E, 0xA9, 0xB0, 0xAC, 0xC3, 0x45, 0x53, 0x8E, 0x6A, 0xAF, 0xFE, 0x51,
+    0xE3, 0x87, 0xEB, 0xC5, 0x78, 0xBD, 0x33, 0xDA, 0x59, 0xDB, 0x89, 0x3B, 0x22, 0xC2, 0x1A, 0x44,
+    0x44, 0x00, 0x84, 0x2B, 0x94, 0x5B, 0xCB, 0x88, 0x75, 0x11, 0x9A, 0xD2, 0x77, 0xD4, 0xB4, 0x11,
+    0x5C, 0x9D, 0x85, 0x95, 0x0A, 0x72, 0xC7, 0x07, 0x9E, 0x1C, 0xE8, 0x02, 0x03, 0x10, 0x6F, 0x80,
+    0xFA, 0x06, 0x64, 0x8F, 0x5A, 0xE6, 0xB5, 0xA5, 0xD0, 0x8E, 0x5D, 0xED, 0x44, 0xD4, 0x5E, 0xA5,
+    0xE4, 0xB3, 0x94, 0x7C, 0x6E, 0xB5, 0x5F, 0x41, 0x07, 0x00, 0xDA, 0x33, 0xC8, 0x37, 0x3C, 0xD9,
+    0x7D, 0x10, 0xA9, 0xE5, 0x30, 0xC9, 0xC9, 0x72, 0x97, 0x35, 0x6D, 0xEB, 0xF4, 0xF1, 0x86, 0x86,
+    0x8C, 0xE2, 0xDD, 0x31, 0x26, 0x95, 0xF4, 0xBE, 0x0A, 0xAC, 0x17, 0x50, 0x6D, 0xC0, 0xD3, 0xCF,
+    0xFC, 0xB9, 0xF7, 0x20, 0x42, 0xC4, 0x9C, 0xF5, 0x7C, 0xEA, 0xC4, 0xFD, 0x95, 0xAE, 0x9F, 0xC7,
+    0x5C, 0x73, 0xF4, 0xE7, 0xD0, 0xAC, 0xD1, 0x91, 0x1E, 0x6F, 0xD0, 0xEC, 0x91, 0x5F, 0x2B, 0xE9,
+    0x26, 0x37, 0xD9, 0xC3, 0x3D, 0xC8, 0x28, 0x25, 0x0F, 0xDD, 0x74, 0x67, 0xEA, 0x9C, 0x9C, 0x1C,
+    0x02, 0xF2, 0x56, 0x00, 0xE6, 0x73, 0x80, 0xD8, 0xDB, 0x07, 0x23, 0x52, 0x84, 0x2A, 0x73, 0x90,
+    0xB9, 0x65, 0xA0, 0x97, 0x2A, 0x50, 0x29, 0xA5, 0x21, 0xCB, 0x74, 0x53, 0xA9, 0x4A, 0x91, 0xD2,
+    0xFB, 0xD5, 0x2A, 0x87, 0x59, 0x49, 0x4A, 0xDF, 0xF2, 0x8B, 0x59, 0x59, 0xD3, 0xF6, 0xE2, 0x67,
+    0x42, 0x99, 0xA5, 0xFF, 0x3D, 0x4B, 0x44, 0xF8, 0x16, 0xE4, 0xD7, 0xF6, 0x0F, 0x92, 0x52, 0x8A,
+    0xFA, 0xCE, 0x1B, 0x77, 0x26, 0x9A, 0x3C, 0xC4, 0xE2, 0xDE, 0x7D, 0x45, 0xCA, 0x34, 0x52, 0xDF,
+    0x7D, 0x5C, 0x39, 0xB4, 0x25, 0x03, 0x93, 0xCA, 0xFA, 0x13, 0xB6, 0x01, 0x4D, 0x58, 0xD9, 0xB6,
+    0xBD, 0xE4, 0x06, 0x93, 0x5E, 0x6A, 0x75, 0x96, 0x95, 0x8A, 0x3C, 0xBC, 0x27, 0xF8, 0x82, 0x95,
+    0x21, 0x64, 0x9C, 0x9F, 0xFF, 0x4C, 0x6C, 0x8D, 0x37, 0xDB, 0xD0, 0x81, 0x95, 0x53, 0xB6, 0x95,
+    0xAC, 0x1E, 0x23, 0xC7, 0xB6, 0x95, 0xEC, 0xE6, 0xA5, 0x49, 0x7F, 0xB4, 0x9D, 0xCE, 0x8C, 0x3F,
+    0x3B, 0x4B, 0x38, 0x3E, 0x4F, 0xEB, 0xDE, 0x0A, 0xD9, 0x3E, 0xBD, 0xB1, 0xF8, 0x85, 0x3D, 0xE8,
+    0x23, 0x6E, 0x5C, 0x4B, 0xE6, 0xFB, 0x3B, 0xC7, 0x95, 0x5B, 0x5D, 0xE7, 0x92, 0x05, 0xC8, 0xCE,
+    0x78, 0xF5, 0x7C, 0x29, 0xA6, 0xE0, 0xC3, 0xFD, 0x2E, 0xFB, 0x0E, 0x59, 0x0A, 0xF2, 0xD4, 0x10,
+    0x0C, 0x28, 0x7F, 0x62, 0x10, 0xCC, 0x9D, 0xBE, 0xA2, 0xCD, 0xE6, 0xFA, 0xFB, 0x1B, 0xC9, 0x41,
+    0x10, 0x69, 0x28, 0x4E, 0xED, 0x41, 0x13, 0x1A, 0x07, 0x07, 0x23, 0xF3, 0xFD, 0x9D, 0x43, 0x94,
+    0x5A, 0x7B, 0x93, 0x6C, 0x6E, 0xEC, 0x87, 0x66, 0x80, 0x99, 0x83, 0x40, 0x76, 0xC5, 0x83, 0xFA,
+    0x76, 0x7C, 0xBF, 0x14, 0x73, 0x79, 0x3F, 0x73, 0x22, 0xF6, 0xB4, 0x67, 0xB9, 0xF5, 0x94, 0x27,
+    0xFB, 0xC6, 0xAD, 0x00, 0xEF, 0xBC, 0x13, 0x60, 0xE5, 0xDD, 0x12, 0x74, 0x8A, 0xD3, 0xF0, 0x4A,
+    0x6F, 0xC4, 0x24, 0xC8, 0xD2, 0x4B, 0x11, 0x7A, 0x83, 0x04, 0x83, 0xDE, 0x6F, 0x07, 0x06, 0x8F,
+    0xBD, 0x3A, 0x62, 0xF0, 0xD4, 0xB0, 0xE7, 0xE1, 0x13, 0x0B, 0x60, 0xCE, 0x7A, 0x44, 0x1C, 0xBE,
+    0x0F, 0x00, 0xB5, 0xE7, 0x1E, 0xA0, 0x68, 0x9D, 0x75, 0xF2, 0xD6, 0x5B, 0x25, 0x66, 0x65, 0x1D,
+    0x7E, 0xF8, 0x3D, 0xD0, 0xC9, 0x4D, 0x7A, 0x58, 0x93, 0x40, 0xA5, 0x21, 0xE2, 0xEE, 0xDD, 0xC0,
+    0xF5, 0x4B, 0x3D, 0xBA, 0x57, 0x5F, 0x1D, 0xC2, 0x5A, 0x41, 0xB5, 0x21, 0xB6, 0x9E, 0x01, 0x78,
+    0x08, 0x95, 0x82, 0x20, 0x4E, 0xD3, 0xED, 0x2F, 0x79, 0x35, 0x06, 0xED, 0x90, 0x1E, 0xE5, 0x9E,
+    0xBE, 0x40, 0xDA, 0x67, 0xF0, 0x1A, 0x00, 0x0B, 0x1F, 0x62, 0x63, 0x99, 0xE1, 0xC5, 0xA9, 0xE8,
+    0x67, 0x10, 0x07, 0x41, 0xC2, 0x2C, 0xB2, 0x82, 0x26, 0x2C, 0xB0, 0x18, 0x69, 0x39, 0x80, 0xDE,
+    0x48, 0xFC, 0xA2, 0x67, 0x87, 0x82, 0x79, 0xD4, 0x10, 0x11, 0xA8, 0x23, 0xCA, 0x85, 0x8D, 0x2C,
+    0xB9, 0xBC, 0x44, 0x3C, 0x41, 0x6F, 0x84, 0xF4, 0x22, 0xB2, 0x4B, 0xCB, 0x8A, 0xBF, 0x07, 0x91,
+    0xBA, 0xB8, 0x12, 0x7A, 0x23, 0x39, 0xBE, 0x77, 0x32, 0xF2, 0x89, 0x89, 0xCE, 0x73, 0x80, 0x8A,
+    0xA1, 0xF2, 0x26, 0xE4, 0x24, 0x76, 0xB3, 0x91, 0xF2, 0x97, 0xCA, 0x5C, 0xBF, 0x68, 0x77, 0x8B,
+    0x0D, 0x75, 0xEB, 0xDB, 0xD1, 0x2C, 0x1A, 0x77, 0xA9, 0xBC, 0xA8, 0x92, 0x8A, 0x26, 0x1A, 0xDF,
+    0xE3, 0x39, 0xE0, 0x08, 0x83, 0xFD, 0xA9, 0xD3, 0xB0, 0x91, 0x89, 0x61, 0x5D, 0xAF, 0xD5, 0x6A,
+    0x4B, 0x8D, 0x4E, 0xBF, 0x59, 0x96, 0x1F, 0x75, 0xA1, 0x27, 0xFD, 0x9E, 0xF2, 0x48, 0xB7, 0x49,
+    0x9E, 0x59, 0xF6, 0x96, 0xFF, 0xFF, 0x81, 0xC2, 0x85, 0xA3, 0xEC, 0x16, 0x0C, 0xF7, 0x7E, 0xB2,
+    0x34, 0x36, 0xB7, 0x90, 0x65, 0xFC, 0x80, 0xA5, 0xC8, 0xB1, 0xA5, 0xF5, 0x6C, 0xC9, 0x48, 0x54,
+    0x32, 0xB2, 0xAB, 0x3D, 0x7B, 0x99, 0x65, 0xDD, 0xC0, 0xFA, 0x3C, 0xEC, 0x9C, 0x84, 0x78, 0x12,
+    0x59, 0x76, 0xC9, 0x42, 0xEB, 0xF6, 0xC0, 0xE5, 0x29, 0x61, 0xD2, 0x08, 0x99, 0xA6, 0xC1, 0x3B,
+    0xAE, 0xEB, 0x9B, 0xE1, 0xC4, 0xCC, 0x54, 0xF8, 0x90, 0xDD, 0x75, 0x6D, 0x57, 0x3B, 0xE2, 0x46,
+    0xC8, 0x34, 0x45, 0x53, 0x86, 0xEB, 0x03, 0x52, 0x14, 0x13, 0xA5, 0x1E, 0xBC, 0x83, 0x48, 0x63,
+    0x72, 0x5B, 0x10, 0xD9, 0xC9, 0x9C, 0x0C, 0xDD, 0x94, 0xA8, 0xD8, 0xD0, 0x5E, 0x96, 0xB9, 0x6D,
+    0xD1, 0x4D, 0x15, 0x83, 0x64, 0x19, 0x4C, 0xFD, 0x7A, 0x60, 0xCD, 0xB3, 0x36, 0x9A, 0x8C, 0xA2,
+    0x9B, 0xCA, 0x52, 0x9F, 0x71, 0x85, 0x79, 0x36, 0xB4, 0xC6, 0xB4, 0x02, 0x88, 0xCD, 0x2D, 0xCC,
+    0x59, 0xCF, 0xC6, 0x0A, 0x3F, 0xF2, 0x88, 0xEB, 0x96, 0x5E, 0x72, 0x3A, 0x18, 0x0A, 0x4E, 0xCA,
+    0x92, 0x1D, 0x93, 0x92, 0x5F, 0x26, 0x17, 0x91, 0xDD, 0x1F, 0x03, 0xEE, 0xB0, 0x5E, 0x50, 0x6D,
+    0x7C, 0x20, 0xBE, 0x0E, 0xAC, 0xBA, 0x1D, 0x0C, 0xB1, 0x49, 0xEC, 0xA6, 0xB2, 0x23, 0x42, 0x47,
+    0xF9, 0x95, 0x6B, 0x76, 0x0A, 0xF4, 0xCC, 0x48, 0x2B, 0xE2, 0x0E, 0x2D, 0x73, 0xBF, 0x68, 0x1A,
+    0x38, 0x7E, 0xEF, 0x02, 0x4D, 0x76, 0x34, 0xCA, 0x41, 0x87, 0x13, 0xCF, 0x3A, 0x95, 0x2A, 0xC8,
+    0x40, 0xC4, 0x9E, 0x7D, 0x4E, 0xA7, 0xE4, 0xBB, 0x29, 0x8A, 0xA9, 0x29, 0x7F, 0x10, 0x8C, 0xCF,
+    0x86, 0x6C, 0x4D, 0x8A, 0xCE, 0x52, 0x25, 0x47, 0xF3, 0x01, 0x59, 0x76, 0xC7, 0x0C, 0xA6, 0x1A,
+    0x7E, 0x08, 0x93, 0xEE, 0x21, 0xD4, 0x9B, 0xD2, 0x76, 0xA4, 0xCF, 0x28, 0x45, 0x88, 0x74, 0xD6,
+    0x31, 0x05, 0x6A, 0x0C, 0x03, 0xC8, 0x1D, 0xDA, 0xA3, 0x4A, 0x74, 0xA4, 0x5B, 0x62, 0x36, 0xEF,
+    0x45, 0xEC, 0x52, 0x9C, 0x7B, 0x9F, 0x6E, 0x9A, 0x44, 0x6D, 0xD7, 0x28, 0x0B, 0x8A, 0x39, 0x8C,
+    0x41, 0xBE, 0x61, 0xE9, 0x79, 0x4C, 0x89, 0x8A, 0x30, 0x41, 0x91, 0x9F, 0x43, 0xEF, 0x23, 0xEF,
+    0x79, 0xF9, 0x87, 0x66, 0x30, 0x67, 0xBD, 0xBE, 0x6F, 0x32, 0x6D, 0x82, 0xA1, 0x2F, 0xFD, 0x3A,
+    0x6B, 0x05, 0xF5, 0x79, 0xD4, 0x8B, 0x90, 0x1C, 0x2D, 0x8F, 0x2E, 0x11, 0x11, 0x86, 0x88, 0x11,
+    0x66, 0x88, 0x7A, 0x0D, 0x30, 0x99, 0xCD, 0x6E, 0x06, 0xF9, 0xAF, 0xB7, 0xFE, 0x3C, 0x5B, 0x38,
+    0xCA, 0x96, 0x0C, 0x99, 0xFD, 0x10, 0xF7, 0xE3, 0xA8, 0xB4, 0x87, 0xA8, 0xD3, 0xA7, 0xA9, 0x1C,
+    0x6B, 0x4D, 0x78, 0xB9, 0x44, 0xBD, 0x08, 0x66, 0x38, 0x61, 0x47, 0x2E, 0x81, 0x88, 0x60, 0x1C,
+    0x62, 0x04, 0xC9, 0x4D, 0xF6, 0xC2, 0x03, 0x1C, 0xA6, 0xAF, 0xBC, 0xB1, 0xC5, 0x8F, 0x9A, 0x4C,
+    0x5F, 0x79, 0x11, 0xE6, 0x50, 0x2E, 0x62, 0xB4, 0xA5, 0x28, 0xE0, 0xF7, 0x03, 0x22, 0x81, 0x1A,
+    0x4E, 0x4A, 0xB2, 0x95, 0xC9, 0x92, 0x2D, 0x4B, 0x5E, 0x71, 0x0F, 0xFE, 0x44, 0x94, 0xD1, 0x9C,
+    0xF5, 0x0B, 0xD3, 0x74, 0xBA, 0xAA, 0xAE, 0xB8, 0x5A, 0x8D, 0xFE, 0xAA, 0x7A, 0xDE, 0xD7, 0xEB,
+    0x54, 0x45, 0xE6, 0x07, 0x89, 0xEB, 0xEB, 0xD3, 0x7A, 0xA9, 0x40, 0x9E, 0x76, 0xBB, 0x85, 0x79,
+    0x74, 0x72, 0x9B, 0xD6, 0x1E, 0x99, 0x95, 0xC2, 0x2F, 0x2D, 0x28, 0x65, 0x7F, 0x26, 0xCA, 0xBB,
+    0xB0, 0x45, 0xED, 0x27, 0x53, 0x4A, 0xD7, 0xE1, 0xD0, 0x3D, 0xB0, 0x42, 0xA5, 0xD3, 0x9E, 0x92,
+    0x36, 0x53, 0xFC, 0xAD, 0xE4, 0xC1, 0x29, 0x71, 0xD2, 0x87, 0x45, 0x03, 0xF2, 0x37, 0xB7, 0x3E,
+    0x70, 0xCE, 0x23, 0x78, 0xB4, 0x6F, 0xC0, 0xAE, 0xF4, 0x18, 0xDB, 0x81, 0xA8, 0x2C, 0x8B, 0xF4,
+    0x2A, 0x15, 0x8C, 0x08, 0x05, 0x65, 0x4D, 0xFB, 0x39, 0xC2, 0x50, 0xDE, 0xD8, 0x33, 0xB6, 0x9B,
+    0x4E, 0x47, 0x95, 0xDC, 0x3D, 0x0A, 0xE8, 0xA0, 0x74, 0xC4, 0x5D, 0x5A, 0xE6, 0x7D, 0x99, 0x5B,
+    0x5B, 0x42, 0x9F, 0x86, 0x41, 0xFA, 0xB4, 0xD9, 0xA9, 0xC9, 0x2B, 0xA7, 0xFC, 0x42, 0xBF, 0xA9,
+    0xAE, 0xAA, 0x37, 0x62, 0xD9, 0x1D, 0xCE, 0xBD, 0x97, 0xF3, 0xAC, 0xF2, 0x44, 0xE9, 0x29, 0x64,
+    0x40, 0x3F, 0x19, 0xE0, 0xED, 0x12, 0xBA, 0x25, 0xE8, 0x12, 0x64, 0x05, 0x32, 0x81, 0xBC, 0x1B,
+    0x90, 0x71, 0x84, 0x8C, 0x2D, 0x64, 0xA5, 0x4B, 0x59, 0x71, 0x2F, 0x93, 0xE8, 0xFB, 0x35, 0x93,
+    0x74, 0x0B, 0xC2, 0x6F, 0xF1, 0x8A, 0xE7, 0xDF, 0xC3, 0xC6, 0xB4, 0x55, 0xD5, 0x57, 0x99, 0x37,
+    0x76, 0x43, 0x47, 0x54, 0x09, 0x9C, 0xD8, 0xCE, 0x93, 0x3F, 0xB1, 0x9D, 0x27, 0xFF, 0xF0, 0xF6,
+    0xF6, 0x63, 0x29, 0x85, 0x13, 0xDB, 0xDB, 0x5F, 0xFB, 0x58, 0x4A, 0x53, 0x82, 0x68, 0xF5, 0xA8,
+    0x74, 0x9B, 0x35, 0xC5, 0x52, 0x43, 0xB8, 0xAD, 0x9A, 0x62, 0x69, 0x56, 0xF8, 0xAD, 0x19, 0x65,
+    0x97, 0x66, 0xF1, 0xE7, 0x67, 0xA4, 0x6D, 0xCF, 0xE2, 0x57, 0x01, 0x66, 0xB6, 0xB7, 0xBF, 0x94,
+    0xD2, 0x68, 0x2A, 0xB9, 0x97, 0xD2, 0xDF, 0xD8, 0xDE, 0xDE, 0x12, 0x76, 0x94, 0x9F, 0x8E, 0xCB,
+    0x07, 0xDD, 0x11, 0x55, 0xB6, 0xA8, 0x32, 0xBF, 0x70, 0x7F, 0x64, 0x65, 0x45, 0xBE, 0x1D, 0xCD,
+    0x63, 0x76, 0x6F, 0x4F, 0x7E, 0x69, 0x93, 0xF6, 0x3D, 0xAE, 0x21, 0xB0, 0xC4, 0xDC, 0x2F, 0xA4,
+    0xFD, 0xBF, 0xED, 0xF0, 0xAC, 0xB2, 0x40, 0x0D, 0x85, 0xF0, 0x6C, 0xD1, 0x66, 0x16, 0x8D, 0x70,
+    0x1C, 0x9E, 0x9E, 0x6D, 0x42, 0x36, 0x08, 0xCF, 0x0C, 0xB4, 0xE1, 0xBB, 0xA4, 0xB1, 0xE8, 0x40,
+    0x40, 0x41, 0x03, 0xB6, 0xF8, 0xA9, 0x2F, 0xAB, 0x54, 0xB2, 0x3A, 0x9D, 0xBA, 0x8A, 0xF0, 0xC8,
+    0x69, 0xA0, 0x78, 0x5C, 0xA5, 0x32, 0x4F, 0x2E, 0xED, 0xAB, 0x54, 0xB5, 0x92, 0x4F, 0x29, 0x4B,
+    0xA3, 0x6E, 0x7A, 0x3B, 0x25, 0x47, 0x4D, 0xBF, 0x32, 0xDC, 0x82, 0x99, 0xF9, 0x95, 0x99, 0xF9,
+    0x95, 0x9F, 0x0E, 0x13, 0x90, 0x61, 0x49, 0x1E, 0x3E, 0xC4, 0x5F, 0x94, 0x4E, 0x1D, 0x5B, 0xA5,
+    0x68, 0x80, 0x9A, 0x70, 0x60, 0x1D, 0x98, 0x01, 0xF9, 0x1F, 0xE0, 0xEF, 0x3F, 0x61, 0xE7, 0x7E,
+    0xFA, 0xCB, 0xEA, 0xC9, 0x5F, 0x9F, 0xDC, 0xA1, 0x1F, 0xE6, 0xAA, 0xFC, 0x14, 0xE2, 0x94, 0xDD,
+    0x1B, 0x99, 0xAB, 0xA7, 0xDE, 0x8A, 0xCB, 0xCB, 0x07, 0xFF, 0x91, 0x03, 0x8E, 0xD6, 0x6A, 0x45,
+    0x63, 0xAE, 0xDD, 0x69, 0x9E, 0x5F, 0x6A, 0x03, 0x2C, 0xB5, 0x17, 0x66, 0x81, 0x85, 0xD5, 0x62,
+    0xAD, 0xD1, 0x39, 0x34, 0x01, 0x5F, 0x97, 0xDA, 0x0B, 0xED, 0x4E, 0x73, 0xA1, 0x39, 0x3B, 0x3B,
+    0x7B, 0x08, 0x90, 0xFE, 0x23, 0x67, 0xCF, 0x5A, 0x0E, 0xCF, 0x65, 0xCA, 0x6D, 0xC8, 0xD2, 0x70,
+    0xD8, 0x6A, 0x5B, 0xA7, 0xA9, 0xC2, 0xD0, 0x60, 0x27, 0xAA, 0x60, 0x99, 0x62, 0x88, 0x8C, 0xD9,
+    0x3E, 0x18, 0x97, 0x5B, 0x18, 0x19, 0x0F, 0xFA, 0x87, 0x11, 0x0E, 0xF6, 0x46, 0x6C, 0xF2, 0x83,
+    0x31, 0x8B, 0xE4, 0x17, 0x82, 0x0A, 0x98, 0x04, 0xE8, 0x1F, 0x56, 0x20, 0x47, 0x2D, 0x0F, 0x89,
+    0x31, 0x74, 0x5D, 0x1E, 0xC9, 0x4B, 0x95, 0x1C, 0x13, 0x32, 0x96, 0x03, 0x13, 0x92, 0x48, 0x78,
+    0xFA, 0x74, 0x98, 0x9B, 0x80, 0x27, 0xE1, 0x1E, 0xEC, 0x63, 0xB1, 0xC2, 0x52, 0xF1, 0x1C, 0x5D,
+    0x40, 0x42, 0x06, 0xBD, 0x52, 0x8E, 0x87, 0xA2, 0x51, 0xD0, 0x2C, 0xE8, 0x74, 0x58, 0xDF, 0xE1,
+    0x77, 0x4B, 0xEE, 0x7A, 0x12, 0x62, 0x88, 0x2C, 0xA7, 0x2C, 0xA8, 0x80, 0x99, 0x09, 0x3F, 0x02,
+    0x5D, 0xE8, 0x4D, 0x6D, 0x10, 0x96, 0x0E, 0xAD, 0xEC, 0x9A, 0x00, 0xF0, 0x20, 0xFC, 0x73, 0xC7,
+    0x49, 0xD8, 0xB6, 0x1C, 0x43, 0xF2, 0xAB, 0x9F, 0xFC, 0x17, 0xAF, 0xE5, 0x32, 0x7C, 0xED, 0xBF,
+    0x3E, 0xFE, 0xE0, 0x3D, 0x18, 0xCD, 0xC2, 0x02, 0x1C, 0x04, 0xE1, 0x61, 0x15, 0x66, 0x41, 0x59,
+    0x08, 0xB0, 0x00, 0x19, 0xC8, 0xC9, 0xF0, 0xDC, 0x64, 0x78, 0x12, 0x82, 0x06, 0xB6, 0x55, 0xEA,
+    0x37, 0x5E, 0x7E, 0x77, 0x74, 0x80, 0x68, 0x0B, 0x88, 0x34, 0x21, 0x52, 0x20, 0x03, 0xEB, 0x68,
+    0x4F, 0x24, 0x47, 0x05, 0x31, 0xA2, 0x65, 0x75, 0xC9, 0x88, 0xCC, 0x89, 0x88, 0xB1, 0xB2, 0xC4,
+    0xA0, 0x02, 0x0F, 0x30, 0x85, 0x00, 0x29, 0xC8, 0x2C, 0x05, 0xC6, 0xF2, 0x29, 0x1E, 0x9E, 0x0C,
+    0x3D, 0x52, 0x91, 0x3D, 0x1B, 0x0E, 0x6F, 0xE6, 0x75, 0x88, 0x81, 0x7A, 0x03, 0x79, 0xCB, 0xB3,
+    0xDE, 0x21, 0xD7, 0x36, 0xF3, 0x51, 0x47, 0xC3, 0xAE, 0x28, 0x8D, 0x5D, 0x26, 0x2A, 0xFF, 0x21,
+    0x8E, 0xC0, 0x01, 0x16, 0x44, 0x54, 0xBE, 0xCB, 0x9E, 0x8E, 0xF7, 0x6B, 0x0C, 0x50, 0x6F, 0x44,
+    0x1E, 0x74, 0x27, 0xC9, 0xD0, 0x56, 0x39, 0x19, 0x44, 0x20, 0xD2, 0x67, 0x87, 0x82, 0x5D, 0xE6,
+    0xC4, 0x90, 0x4C, 0x0D, 0x51, 0xBE, 0x42, 0x94, 0x1B, 0xB0, 0xB3, 0x08, 0xC5, 0x0C, 0x08, 0xE0,
+    0x00, 0x5B, 0x68, 0xBF, 0x8B, 0x8A, 0xCB, 0x93, 0x76, 0x8F, 0xC9, 0xB8, 0x74, 0x80, 0x67, 0x42,
+    0xC9, 0xAF, 0x02, 0x1D, 0x38, 0xD9, 0x00, 0x53, 0x83, 0x83, 0x5F, 0x64, 0xA2, 0x22, 0xE5, 0x27,
+    0xBA, 0x7C, 0xFF, 0x24, 0x9A, 0x7D, 0xA8, 0x15, 0x90, 0x3D, 0x0C, 0xFA, 0xDE, 0xA4, 0x00, 0x44,
+    0xA0, 0x3F, 0x9D, 0x74, 0x9F, 0x04, 0x15, 0xFC, 0xDA, 0xB1, 0x27, 0xFF, 0xFA, 0x2F, 0x9F, 0x8D,
+    0x47, 0x80, 0xCD, 0x4F, 0xFC, 0xCD, 0xDE, 0x93, 0x6E, 0xE6, 0xB2, 0x3D, 0x26, 0x9F, 0x96, 0x8F,
+    0x96, 0x20, 0x9D, 0xFB, 0xAB, 0xEA, 0xE8, 0xC7, 0xCF, 0x94, 0x70, 0xC2, 0x9E, 0x5B, 0x5A, 0x98,
+    0xCD, 0xA4, 0x15, 0xFC, 0xDA, 0x91, 0x1B, 0xF1, 0xD8, 0xAF, 0x2F, 0x7C, 0x18, 0x61, 0x7F, 0xE3,
+    0xD8, 0x95, 0xD9, 0x79, 0x7F, 0xFC, 0x12, 0x08, 0xAB, 0x93, 0x6F, 0x69, 0x1B, 0xE7, 0xB4, 0x5B,
+    0x6B, 0x2A, 0x1F, 0x8D, 0xF6, 0xEB, 0x8B, 0xB2, 0xAC, 0x8C, 0xE5, 0x30, 0x5F, 0xB2, 0xE7, 0xCF,
+    0xFF, 0xA5, 0xA3, 0x8D, 0xFF, 0x34, 0xA3, 0xE4, 0x4D, 0x37, 0xF0, 0xC6, 0x81, 0xF4, 0x4B, 0x47,
+    0x1E, 0x54, 0x59, 0x3C, 0xE8, 0x7E, 0x8E, 0xCD, 0x46, 0xA6, 0x42, 0xCF, 0x1E, 0xB0, 0x07, 0xB0,
+    0xBB, 0xDC, 0x58, 0xB8, 0x04, 0x34, 0x0E, 0x5C, 0x7E, 0xBC, 0xEB, 0x97, 0x34, 0x33, 0xCE, 0x1E,
+    0x16, 0x4F, 0xCB, 0xB3, 0x25, 0x88, 0xCD, 0xCD, 0x13, 0x67, 0x7E, 0x63, 0xE9, 0xE6, 0xD1, 0x45,
+    0x4E, 0xB8, 0xA3, 0x8A, 0xD5, 0x9A, 0xF0, 0xC7, 0xC1, 0x3E, 0x39, 0xBB, 0x39, 0x5C, 0xBA, 0xD9,
+    0x58, 0x44, 0xD8, 0x7F, 0x7C, 0xE4, 0x97, 0x7F, 0x6E, 0xC6, 0x1F, 0xED, 0x82, 0x72, 0xD2, 0x0B,
+    0x4F, 0x20, 0xB2, 0x4A, 0x87, 0x06, 0x75, 0xB4, 0x95, 0x9E, 0x92, 0x0E, 0x73, 0x68, 0x84, 0x67,
+    0x95, 0x06, 0xDA, 0x8A, 0x40, 0x07, 0x83, 0xB0, 0x13, 0x42, 0xB4, 0x0E, 0xED, 0xE9, 0xE7, 0x1A,
+    0xCA, 0xD1, 0x80, 0x92, 0x0C, 0x56, 0x51, 0x96, 0x0E, 0xCA, 0x7D, 0xE0, 0x4D, 0x3B, 0xD6, 0x38,
+    0x70, 0x0F, 0x5A, 0xAA, 0x43, 0xBD, 0x01, 0x8D, 0x0E, 0x74, 0x87, 0xC8, 0x54, 0x61, 0x5E, 0xF1,
+    0x74, 0x6F, 0x5A, 0xEE, 0x7E, 0x11, 0xF1, 0xC3, 0x1A, 0xEA, 0x7B, 0x4D, 0xF4, 0x7F, 0x6F, 0x93,
+    0x0D, 0xFB, 0x98, 0x18, 0x30, 0x6F, 0xDF, 0xC0, 0xA4, 0x44, 0x96, 0xC6, 0x64, 0x69, 0x9F, 0x7A,
+    0x1A, 0xD2, 0x6C, 0x43, 0xBB, 0x0F, 0x7D, 0x0F, 0xD6, 0xFE, 0x38, 0x60, 0x79, 0xF1, 0x3E, 0xB0,
+    0x6C, 0xF8, 0x13, 0x19, 0xCD, 0x66, 0x57, 0x7A, 0x35, 0xEC, 0xD0, 0xBD, 0x3B, 0x92, 0x29, 0xB9,
+    0x3C, 0x55, 0xF4, 0xC6, 0xEF, 0x6F, 0x64, 0xD0, 0xC9, 0xCA, 0xD7, 0x9A, 0x74, 0x26, 0x86, 0x73,
+    0xFD, 0x19, 0xF2, 0xE4, 0x69, 0xC3, 0x23, 0xB7, 0xAD, 0x4A, 0x15, 0xCA, 0xC1, 0x0E, 0x3C, 0x07,
+    0xDD, 0x77, 0x37, 0xD5, 0xA4, 0x7D, 0x3D, 0x40, 0xE6, 0x94, 0x57, 0x51, 0x96, 0x62, 0x9F, 0xC8,
+    0xC0, 0x6E, 0xB0, 0x52, 0x2E, 0x92, 0x6F, 0x18, 0x9B, 0x5D, 0xD5, 0xBE, 0x9B, 0x52, 0xFA, 0xD9,
+    0x1F, 0x8C, 0xEF, 0xD8, 0xD1, 0xE2, 0x06, 0x2B, 0xFA, 0x4F, 0xC8, 0x6D, 0xB2, 0xC6, 0x77, 0xBD,
+    0x8A, 0x26, 0x42, 0x77, 0x1F, 0xDE, 0xBD, 0x4E, 0x66, 0x0B, 0x9D, 0xD2, 0x48, 0xC4, 0xCC, 0x69,
+    0xB7, 0x41, 0x37, 0x05, 0xD2, 0x10, 0xED, 0x27, 0x3C, 0xDD, 0x10, 0x54, 0x98, 0x7C, 0x1D, 0x4D,
+    0x91, 0x0E, 0xBE, 0xC6, 0x84, 0x44, 0xE1, 0x78, 0x0D, 0x08, 0x6D, 0x50, 0x78, 0x68, 0xE4, 0xE4,
+    0x7E, 0x50, 0x89, 0xEF, 0xAA, 0x64, 0x0F, 0x61, 0xDE, 0xA4, 0xC3, 0x7A, 0x93, 0xE7, 0x64, 0xE8,
+    0xF3, 0x9C, 0x51, 0x9E, 0x4E, 0x61, 0xF8, 0xE4, 0xCB, 0xB1, 0x50, 0x29, 0xBB, 0x1C, 0xB3, 0x0A,
+    0xE9, 0xD8, 0xEA, 0x50, 0x53, 0x4E, 0xF8, 0x36, 0x0B, 0xEA, 0xCC, 0x99, 0xD3, 0x29, 0x8D, 0x3F,
+    0xF2, 0xE6, 0x9B, 0xEE, 0x2F, 0x0F, 0x4B, 0xF5, 0x2B, 0x7F, 0xC0, 0x47, 0xFF, 0x8D, 0x57, 0x6F,
+    0x0F, 0xE9, 0xE6, 0x56, 0x7D, 0x2B, 0x52, 0xE4, 0xA8, 0xCB, 0x25, 0x7C, 0x19, 0xE8, 0xED, 0x63,
+    0x5B, 0xBF, 0xE8, 0xFB, 0x86, 0x76, 0x47, 0xD9, 0x5A, 0x4D, 0xDC, 0xB8, 0x72, 0x96, 0xFE, 0xCB,
+    0xCF, 0xFB, 0x4E, 0xBB, 0x5F, 0xD6, 0x66, 0x69, 0x6B, 0x4D, 0x53, 0xFA, 0x32, 0x27, 0xB4, 0x92,
+    0x83, 0xCF, 0x04, 0xE0, 0x08, 0xD4, 0x60, 0x10, 0xF9, 0xA9, 0xEF, 0xB0, 0x17, 0x78, 0x3D, 0xB2,
+    0x55, 0xB0, 0x54, 0x63, 0x21, 0x23, 0x3B, 0xEB, 0x45, 0x2A, 0x69, 0x3D, 0xCD, 0x43, 0x4F, 0x58,
+    0x93, 0xA6, 0x71, 0xE3, 0x00, 0xF4, 0x86, 0x5C, 0x84, 0x02, 0xEA, 0x87, 0x19, 0xEC, 0xA3, 0x3C,
+    0xE2, 0x65, 0x4C, 0x0A, 0x9C, 0x9C, 0x84, 0xC3, 0x08, 0x83, 0x21, 0xD9, 0x3E, 0x1C, 0xF8, 0xD1,
+    0x7F, 0x7D, 0x74, 0x03, 0x8F, 0xBC, 0x46, 0x36, 0x84, 0xC7, 0x86, 0xC8, 0x7D, 0x44, 0x82, 0xBF,
+    0x50, 0xC2, 0xF2, 0xC4, 0x30, 0x46, 0x4C, 0x2E, 0xC0, 0x3C, 0x5B, 0xA2, 0x6D, 0xC1, 0x47, 0x6E,
+    0x5F, 0x7B, 0x66, 0xE6, 0xDD, 0x67, 0xBF, 0xCF, 0xBA, 0xF6, 0xB4, 0x52, 0xC0, 0xA4, 0x4D, 0xB4,
+    0x9F, 0xC8, 0x60, 0x38, 0x05, 0x98, 0x5A, 0x4C, 0xAA, 0x41, 0xF5, 0x5E, 0x03, 0xE5, 0xE1, 0x28,
+    0xE8, 0xEF, 0x90, 0xA7, 0x68, 0x5E, 0x17, 0x32, 0xAE, 0x72, 0x71, 0x86, 0xCC, 0x07, 0xAA, 0x59,
+    0x72, 0x82, 0x88, 0xF9, 0x78, 0x51, 0xFE, 0xB3, 0x77, 0x62, 0xBB, 0xDD, 0xBD, 0x92, 0x9F, 0x4E,
+    0x29, 0x9A, 0x94, 0x68, 0x8D, 0x2D, 0xB3, 0xD3, 0xF8, 0xC5, 0xB4, 0x61, 0x6E, 0x25, 0x0F, 0x5C,
+    0x60, 0x2A, 0x8B, 0x3E, 0xA0, 0x3C, 0x26, 0xA5, 0x64, 0x3F, 0xBD, 0xBD, 0xFD, 0xCC, 0xBD, 0xFF,
+    0xB6, 0xA4, 0x53, 0x69, 0x7B, 0xFB, 0x19, 0x7D, 0xE7, 0x21, 0x47, 0x9E, 0x92, 0xA5, 0x95, 0x12,
+    0x3C, 0x92, 0x5E, 0x7B, 0x0F, 0xBE, 0x05, 0x2F, 0x47, 0xFA, 0x5D, 0xF5, 0x07, 0xE2, 0x16, 0x6F,
+    0xB9, 0xCE, 0x66, 0x7D, 0x49, 0xFD, 0x11, 0xA9, 0xCC, 0x46, 0x38, 0x54, 0x4A, 0xF7, 0x1B, 0xF8,
+    0x56, 0x4A, 0xFE, 0xC4, 0xB5, 0x4F, 0x5B, 0xE6, 0x81, 0x62, 0xFA, 0xDA, 0x9D, 0x60, 0x68, 0x22,
+    0x4E, 0xCE, 0xAE, 0x4A, 0xD0, 0x61, 0x8A, 0xAD, 0xC1, 0x20, 0xB1, 0x80, 0xF0, 0x79, 0xF2, 0x19,
+    0xDD, 0x4D, 0x35, 0x44, 0x7A, 0x4E, 0xA2, 0x02, 0xCB, 0x53, 0x90, 0xAB, 0x86, 0xF8, 0x8F, 0xB6,
+    0x15, 0xF3, 0xA0, 0x76, 0xCE, 0xE9, 0x91, 0xDC, 0x67, 0x2C, 0x7D, 0x88, 0xF3, 0xBB, 0xD3, 0x6A,
+    0xFE, 0x20, 0xCC, 0xC0, 0x3C, 0xA4, 0xA0, 0xC6, 0x65, 0xF6, 0xA9, 0x68, 0xDA, 0x5B, 0xB5, 0xA5,
+    0xD0, 0x58, 0xF2, 0x0B, 0x1F, 0xF7, 0xED, 0x2F, 0xB9, 0xA5, 0x9B, 0x76, 0xF5, 0x05, 0x50, 0x69,
+    0x13, 0x75, 0x7B, 0x88, 0xB6, 0x05, 0x86, 0x02, 0x43, 0x87, 0x79, 0x11, 0x27, 0x18, 0xE6, 0xD8,
+    0x1E, 0xD8, 0x83, 0x13, 0xE3, 0x2D, 0x7A, 0x29, 0x22, 0xAA, 0xE9, 0x46, 0xA7, 0x2F, 0xCE, 0xA1,
+    0x26, 0xF1, 0x69, 0xAE, 0x76, 0xA1, 0x4C, 0x9B, 0xDA, 0xA3, 0x3D, 0xCA, 0xA3, 0xEE, 0x9B, 0xD5,
+    0x3E, 0xF3, 0x7F, 0x2C, 0x5F, 0x68, 0x76, 0x16, 0x3A, 0x84, 0x29, 0x8F, 0x1B, 0x50, 0x13, 0x8E,
+    0x69, 0x0B, 0xC2, 0x87, 0xF1, 0x17, 0xFE, 0x97, 0x17, 0x03, 0x47, 0x8E, 0x28, 0x99, 0x87, 0x2D,
+    0x00, 0xE1, 0x51, 0x50, 0x83, 0x05, 0x58, 0x25, 0xF8, 0xF0, 0xEA, 0x55, 0x06, 0x91, 0xDE, 0x84,
+    0x5C, 0x04, 0x8E, 0xA3, 0x38, 0x08, 0x47, 0xF1, 0x9F, 0xB4, 0x9B, 0x27, 0xEE, 0x3C, 0xF2, 0xBA,
+    0x7E, 0x0D, 0xB1, 0xD7, 0x01, 0x6D, 0x4B, 0x44, 0x90, 0x70, 0x0C, 0x8E, 0xD1, 0x63, 0xBB, 0xBC,
+    0xF5, 0xF3, 0x78, 0xCE, 0x73, 0x9C, 0x59, 0x24, 0x78, 0x8E, 0x73, 0x10, 0xFC, 0xDC, 0xD2, 0xE6,
+    0xED, 0xBE, 0x8E, 0x2C, 0xC1, 0x67, 0xF4, 0xBB, 0xF6, 0x12, 0x7A, 0x99, 0xD5, 0x8B, 0x9A, 0xBD,
+    0x25, 0x36, 0xFF, 0x0F, 0x4D, 0x92, 0x3F, 0x6B, 0x5C, 0x47, 0x14, 0xC5, 0x7F, 0x33, 0x63, 0xFB,
+    0x59, 0x3B, 0xDA, 0x1D, 0x17, 0x1B, 0x70, 0xC8, 0x4A, 0x2B, 0x83, 0x0A, 0x15, 0x6F, 0xBD, 0x72,
+    0x50, 0xC8, 0x16, 0x4F, 0x7E, 0xCF, 0xF8, 0x0B, 0xA8, 0x0C, 0xA9, 0x5C, 0x07, 0x02, 0x5B, 0x6C,
+    0xC0, 0x45, 0xCC, 0x4E, 0xEC, 0x2E, 0x6E, 0x04, 0x89, 0x53, 0xA5, 0x50, 0xED, 0x14, 0x7A, 0xC5,
+    0x16, 0x2E, 0x62, 0x69, 0xB0, 0x50, 0xAA, 0x10, 0x26, 0x21, 0x1F, 0x60, 0x02, 0x2E, 0xF2, 0xA7,
+    0x19, 0xC3, 0x06, 0x64, 0x65, 0x57, 0x93, 0x62, 0x57, 0x24, 0x07, 0x6E, 0x73, 0xB8, 0x9C, 0x73,
+    0xEE, 0xE1, 0x66, 0x5F, 0x73, 0xF5, 0xD8, 0x31, 0x46, 0x7F, 0x2B, 0xC3, 0xF0, 0x91, 0x78, 0x55,
+    0x65, 0x6C, 0xB0, 0x43, 0xBE, 0xD2, 0x5C, 0xD5, 0xAB, 0xEA, 0x23, 0xF9, 0x9A, 0x98, 0xE2, 0xD5,
+    0x03, 0xDA, 0x0C, 0xEC, 0x70, 0x3F, 0x3C, 0x70, 0xEF, 0xDB, 0x0F, 0xB9, 0x4D, 0x77, 0xDE, 0xD8,
+    0x03, 0xA4, 0x03, 0x0F, 0x43, 0x28, 0xD3, 0x3C, 0x07, 0x65, 0xA1, 0x4C, 0x33, 0xE5, 0xA0, 0x00,
+    0x01, 0x5C, 0xA9, 0x68, 0x6E, 0xD1, 0x35, 0x55, 0xEF, 0x64, 0xD4, 0xBB, 0xF5, 0x34, 0x6F, 0xEF,
+    0xFB, 0xEB, 0xDB, 0xA8, 0x0E, 0xE2, 0x4B, 0xF8, 0x0A, 0xB6, 0x1D, 0xAB, 0x0F, 0x80, 0x1B, 0x90,
+    0x43, 0x06, 0x84, 0x32, 0xCD, 0x40, 0x3A, 0xE4, 0x2F, 0x29, 0x39, 0x94, 0x43, 0x3A, 0x00, 0x79,
+    0x1D, 0x9E, 0x40, 0x7B, 0x1F, 0x79, 0x13, 0x4E, 0x60, 0xC3, 0x35, 0xAE, 0x6D, 0x6E, 0xC6, 0x1F,
+    0xD6, 0xF4, 0xF0, 0x27, 0x1E, 0x95, 0x64, 0x4F, 0xE1, 0x16, 0x4B, 0xDC, 0x90, 0x8E, 0x1C, 0x4F,
+    0xC6, 0x10, 0x42, 0x99, 0xD2, 0x2C, 0x07, 0x75, 0x62, 0x91, 0xBE, 0x4C, 0xC9, 0x29, 0xA7, 0x1C,
+    0x85, 0x74, 0x08, 0x80, 0x03, 0xB2, 0x29, 0x1F, 0x5C, 0xA8, 0xD3, 0xAD, 0xB2, 0x2D, 0x7E, 0xDC,
+    0xE3, 0x4E, 0xC5, 0x29, 0xAA, 0xCD, 0xEA, 0x5E, 0x76, 0xA7, 0x32, 0xA7, 0x98, 0xF6, 0x41, 0x73,
+    0x6C, 0xBB, 0x9E, 0xAD, 0x85, 0xB8, 0xB6, 0x50, 0x43, 0x07, 0x1A, 0x08, 0x55, 0x75, 0xDF, 0xB8,
+    0xF5, 0x86, 0x6F, 0x11, 0x33, 0x06, 0xD2, 0x75, 0x78, 0xF1, 0x29, 0xDD, 0x0B, 0xC4, 0xFC, 0x32,
+    0x4B, 0x7F, 0x7A, 0xC0, 0xD1, 0x61, 0x64, 0x26, 0xA6, 0x7C, 0xCF, 0x05, 0x9F, 0xF3, 0x97, 0xEB,
+    0xF1, 0x5B, 0x30, 0x84, 0x87, 0x99, 0x0D, 0x3D, 0xE9, 0x83, 0x61, 0x12, 0xB4, 0x2D, 0x83, 0xF6,
+    0xFA, 0xFC, 0x30, 0xC8, 0x94, 0xA2, 0x48, 0x29, 0x8A, 0x9F, 0xD3, 0x3E, 0xFF, 0x61, 0x17, 0xFA,
+    0x96, 0xF5, 0x80, 0x29, 0x30, 0x06, 0x7D, 0xDF, 0x67, 0xF6, 0x85, 0x72, 0x5D, 0xE5, 0xB3, 0x57,
+    0x81, 0x37, 0xE7, 0xCF, 0x5F, 0x1E, 0xA7, 0x84, 0x4E, 0x89, 0x49, 0x8F, 0x42, 0xD3, 0x52, 0x36,
+    0xAB, 0xBC, 0x74, 0x43, 0x62, 0xCE, 0xA0, 0xC5, 0x9A, 0xAA, 0xB4, 0x70, 0xCA, 0xD5, 0x84, 0x01,
+    0x9B, 0x0D, 0x8C, 0x74, 0xD2, 0x0D, 0x19, 0xB5, 0x68, 0x29, 0x27, 0x5D, 0xCD, 0x70, 0x8D, 0xA6,
+    0xB2, 0xCA, 0x46, 0xEA, 0x9C, 0x5E, 0x56, 0xF5, 0xD3, 0x4C, 0xA6, 0xB3, 0x06, 0xAC, 0x42, 0x07,
+    0x36, 0x61, 0x1B, 0x61, 0xD9, 0x42, 0x59, 0x46, 0x64, 0x29, 0xF6, 0x93, 0x05, 0x78, 0xA7, 0xBC,
+    0x00, 0x30, 0x73, 0xC8, 0x81, 0x11, 0x10, 0x16, 0xCF, 0x91, 0x59, 0x30, 0xC0, 0x6D, 0xA0, 0x80,
+    0xBD, 0x29, 0xBC, 0x89, 0x70, 0xEC, 0x61, 0xEC, 0xA0, 0xAC, 0x40, 0xCE, 0xBB, 0xF6, 0xEE, 0xCB,
+    0x7F, 0xEE, 0xB9, 0xDD, 0x6B, 0x4D, 0xC2, 0xCD, 0x6D, 0x55, 0x79, 0x3F, 0x3E, 0x54, 0xE9, 0x30,
+    0x66, 0x67, 0x77, 0x01, 0xB4, 0x5F, 0xE8, 0x10, 0x58, 0xE8, 0x2B, 0xBB, 0x34, 0x31, 0x80, 0xF0,
+    0xFF, 0x67, 0x27, 0x97, 0x6C, 0x58, 0x18, 0x92, 0x59, 0xB8, 0x17, 0x61, 0x7C, 0x01, 0x2A, 0x39,
+    0x68, 0xEC, 0x03, 0x44, 0xED, 0xCA, 0x65, 0xAB, 0xCA, 0xF5, 0x99, 0x01, 0xC8, 0xB3, 0x15, 0xD3,
+    0xEC, 0xAC, 0xA8, 0x29, 0xA0, 0xFD, 0x46, 0xB1, 0x53, 0x6F, 0x74, 0xDD, 0x62, 0xA7, 0x82, 0x4D,
+    0x58, 0x01, 0x69, 0xE1, 0x33, 0xFA, 0x69, 0x26, 0x32, 0xC0, 0xC3, 0xA0, 0x2D, 0x52, 0xF2, 0xD2,
+    0xC1, 0x10, 0xD6, 0x96, 0x29, 0x2E, 0xA1, 0x2D, 0x72, 0x06, 0xC7, 0x15, 0x7D, 0x8F, 0x38, 0x03,
+    0x75, 0x51, 0xC1, 0xF1, 0x5B, 0xB8, 0x96, 0x80, 0x77, 0xB9, 0x01, 0xA4, 0x3F, 0xF6, 0x10, 0x9F,
+    0x44, 0x96, 0x61, 0xFB, 0xCB, 0x29, 0x2D, 0x8C, 0x11, 0xC7, 0xFE, 0xBD, 0xB4, 0x6F, 0xDE, 0xC2,
+    0x6B, 0x80, 0x2B, 0x7C, 0x9C, 0xC2, 0xD1, 0xB3, 0xA5, 0xFC, 0xDC, 0x78, 0x4D, 0xCD, 0x8E, 0xAA,
+    0x84, 0xEB, 0x50, 0xA6, 0x54, 0x1D, 0x7D, 0xF7, 0x3B, 0xA1, 0x85, 0xAE, 0x46, 0x14, 0xD2, 0x11,
+    0x0D, 0x99, 0x7D, 0x48, 0x4F, 0x7A, 0xA2, 0x01, 0xD8, 0x44, 0x06, 0x95, 0xAA, 0x1C, 0x3C, 0x19,
+    0xA4, 0x99, 0xF8, 0x3B, 0xA8, 0x27, 0x55, 0xAF, 0x43, 0xAC, 0xD5, 0x89, 0x5D, 0x5F, 0x63, 0x32,
+    0x51, 0x27, 0x0E, 0xA0, 0x52, 0xD3, 0x82, 0x5A, 0xD9, 0x26, 0xB5, 0x70, 0x86, 0xE4, 0x7D, 0xF6,
+    0x6B, 0xCE, 0x40, 0x39, 0x5D, 0x0D, 0x88, 0xBA, 0x32, 0x44, 0x11, 0x5A, 0xEC, 0x8A, 0xB9, 0x72,
+    0x7D, 0x0F, 0xC8, 0x0A, 0x64, 0x50, 0xD3, 0xF2, 0x4C, 0xBA, 0x1C, 0x7C, 0x13, 0x86, 0x19, 0xA4,
+    0x94, 0x5C, 0xFF, 0xF9, 0x79, 0xAD, 0xEC, 0x60, 0x47, 0xFA, 0xB5, 0x55, 0xA2, 0xD6, 0x14, 0xEA,
+    0xC4, 0xAE, 0x8B, 0x10, 0x74, 0x35, 0x99, 0x28, 0x57, 0x14, 0x2C, 0x8E, 0x2B, 0xEF, 0x4F, 0x73,
+    0x6A, 0xCD, 0x00, 0xDF, 0x64, 0x24, 0x5C, 0x87, 0x68, 0x52, 0xF2, 0x41, 0xFF, 0x79, 0xF4, 0x85,
+    0x53, 0x76, 0xA0, 0x9C, 0xAE, 0x46, 0xCA, 0x1A, 0xEA, 0xAC, 0x32, 0x44, 0xCD, 0xBA, 0x08, 0x86,
+    0x9E, 0xF4, 0xC6, 0x17, 0xCA, 0x75, 0xFD, 0x65, 0xEF, 0x2B, 0x00, 0x35, 0xA0, 0x1C, 0xFD, 0x90,
+    0xA2, 0x7A, 0xC6, 0x84, 0x2D, 0x94, 0x23, 0x62, 0x90, 0x73, 0x46, 0x88, 0x23, 0xE9, 0xA0, 0x30,
+    0xC8, 0x6F, 0xE2, 0x2E, 0xFD, 0xF4, 0x38, 0x31, 0x9E, 0xEA, 0x19, 0xFF, 0x02,
 };
 
 static const EpdGlyph opendyslexic_8_italicGlyphs[] = {
@@ -1195,7 +1157,7 @@ static const EpdGlyph opendyslexic_8_italicGlyphs[] = {
     { 7, 15, 4, 0, 12, 27, 3745 }, // |
     { 9, 16, 11, 0, 13, 36, 3772 }, // }
     { 7, 4, 10, 3, 13, 7, 3808 }, // ~
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
+    { 0, 0, 14, 0, 0, 0, 3815 }, //  
     { 7, 18, 7, 1, 13, 32, 0 }, // ¡
     { 9, 16, 11, 1, 14, 36, 32 }, // ¢
     { 14, 16, 12, 0, 16, 56, 68 }, // £
@@ -1206,625 +1168,631 @@ static const EpdGlyph opendyslexic_8_italicGlyphs[] = {
     { 9, 3, 9, 3, 13, 7, 273 }, // ¨
     { 8, 7, 9, 4, 16, 14, 280 }, // ©
     { 7, 6, 7, 2, 13, 11, 294 }, // ª
-    { 12, 8, 14, 1, 8, 24, 305 }, // «
-    { 9, 5, 10, 2, 6, 12, 329 }, // ¬
-    { 9, 2, 9, 2, 6, 5, 341 }, // ­
-    { 8, 7, 9, 4, 18, 14, 346 }, // ®
-    { 7, 3, 9, 4, 13, 6, 360 }, // ¯
-    { 9, 8, 9, 2, 14, 18, 366 }, // °
-    { 11, 10, 12, 0, 9, 28, 384 }, // ±
-    { 5, 7, 5, 2, 14, 9, 412 }, // ²
-    { 6, 7, 5, 2, 14, 11, 421 }, // ³
-    { 5, 4, 5, 3, 13, 5, 432 }, // ´
-    { 13, 12, 12, -1, 10, 39, 437 }, // µ
-    { 12, 14, 10, 0, 12, 42, 476 }, // ¶
-    { 5, 3, 4, 1, 7, 4, 518 }, // ·
-    { 5, 5, 5, 0, 1, 7, 522 }, // ¸
-    { 4, 7, 5, 2, 14, 7, 529 }, // ¹
-    { 6, 6, 7, 3, 12, 9, 536 }, // º
-    { 11, 8, 11, -2, 8, 22, 545 }, // »
-    { 14, 16, 18, 4, 15, 56, 567 }, // ¼
-    { 15, 15, 18, 4, 14, 57, 623 }, // ½
-    { 15, 15, 18, 3, 14, 57, 680 }, // ¾
-    { 11, 19, 10, -1, 10, 53, 737 }, // ¿
-    { 14, 19, 17, 0, 19, 67, 790 }, // À
-    { 15, 22, 17, 0, 22, 83, 857 }, // Á
-    { 15, 19, 17, 0, 19, 72, 940 }, // Â
-    { 15, 19, 17, 0, 19, 72, 1012 }, // Ã
-    { 16, 19, 17, 0, 19, 76, 1084 }, // Ä
-    { 14, 20, 17, 0, 20, 70, 1160 }, // Å
-    { 23, 16, 24, 0, 15, 92, 1230 }, // Æ
-    { 14, 20, 14, 1, 16, 70, 1322 }, // Ç
-    { 14, 19, 13, 0, 19, 67, 1392 }, // È
-    { 14, 22, 13, 0, 22, 77, 1459 }, // É
-    { 14, 18, 13, 0, 18, 63, 1536 }, // Ê
-    { 14, 19, 13, 0, 19, 67, 1599 }, // Ë
-    { 9, 21, 7, 0, 21, 48, 1666 }, // Ì
-    { 10, 24, 7, 0, 24, 60, 1714 }, // Í
-    { 10, 20, 7, 0, 20, 50, 1774 }, // Î
-    { 11, 21, 7, 0, 21, 58, 1824 }, // Ï
-    { 15, 15, 16, 0, 15, 57, 1882 }, // Ð
-    { 17, 18, 16, 0, 18, 77, 1939 }, // Ñ
-    { 16, 21, 17, 1, 20, 84, 2016 }, // Ò
-    { 16, 24, 17, 1, 23, 96, 2100 }, // Ó
-    { 16, 20, 17, 1, 19, 80, 2196 }, // Ô
-    { 16, 21, 17, 1, 20, 84, 2276 }, // Õ
-    { 16, 21, 17, 1, 20, 84, 2360 }, // Ö
-    { 9, 5, 10, 1, 7, 12, 2444 }, // ×
-    { 29, 29, 17, -6, 22, 211, 2456 }, // Ø
-    { 15, 20, 15, 1, 19, 75, 2667 }, // Ù
-    { 15, 23, 15, 1, 22, 87, 2742 }, // Ú
-    { 15, 20, 15, 1, 19, 75, 2829 }, // Û
-    { 15, 20, 15, 1, 19, 75, 2904 }, // Ü
-    { 12, 23, 15, 4, 23, 69, 2979 }, // Ý
-    { 11, 13, 9, 0, 13, 36, 3048 }, // Þ
-    { 12, 13, 11, 1, 13, 39, 3084 }, // ß
-    { 11, 14, 13, 0, 14, 39, 3123 }, // à
-    { 11, 17, 13, 0, 17, 47, 3162 }, // á
-    { 12, 14, 13, 0, 14, 42, 3209 }, // â
-    { 12, 13, 13, 0, 13, 39, 3251 }, // ã
-    { 12, 14, 13, 0, 14, 42, 3290 }, // ä
-    { 11, 15, 13, 0, 15, 42, 3332 }, // å
-    { 18, 11, 20, 0, 11, 50, 3374 }, // æ
-    { 9, 15, 11, 1, 11, 34, 3424 }, // ç
-    { 11, 16, 13, 1, 16, 44, 3458 }, // è
-    { 11, 19, 13, 1, 19, 53, 3502 }, // é
-    { 11, 15, 13, 1, 15, 42, 3555 }, // ê
-    { 12, 16, 13, 1, 16, 48, 3597 }, // ë
-    { 7, 14, 6, 0, 14, 25, 3645 }, // ì
-    { 9, 17, 6, 0, 17, 39, 3670 }, // í
-    { 9, 13, 6, 0, 13, 30, 3709 }, // î
-    { 9, 14, 6, 0, 14, 32, 3739 }, // ï
-    { 15, 14, 14, 1, 14, 53, 3771 }, // ð
-    { 13, 14, 12, 0, 14, 46, 3824 }, // ñ
-    { 11, 16, 13, 1, 16, 44, 3870 }, // ò
-    { 11, 19, 13, 1, 19, 53, 3914 }, // ó
-    { 11, 15, 13, 1, 15, 42, 3967 }, // ô
-    { 11, 16, 13, 1, 16, 44, 4009 }, // õ
-    { 12, 16, 13, 1, 16, 48, 4053 }, // ö
-    { 11, 10, 13, 2, 10, 28, 4101 }, // ÷
-    { 16, 27, 13, -2, 18, 108, 4129 }, // ø
-    { 11, 15, 12, 1, 15, 42, 4237 }, // ù
-    { 11, 18, 12, 1, 18, 50, 4279 }, // ú
-    { 11, 14, 12, 1, 14, 39, 4329 }, // û
-    { 11, 15, 12, 1, 15, 42, 4368 }, // ü
-    { 13, 24, 13, 0, 19, 78, 4410 }, // ý
-    { 11, 18, 9, 0, 14, 50, 4488 }, // þ
-    { 13, 21, 13, 0, 16, 69, 4538 }, // ÿ
-    { 16, 19, 17, 0, 19, 76, 0 }, // Ā
-    { 12, 13, 13, 0, 13, 39, 76 }, // ā
-    { 16, 21, 17, 0, 21, 84, 115 }, // Ă
-    { 12, 15, 13, 0, 15, 45, 199 }, // ă
-    { 14, 19, 17, 0, 14, 67, 244 }, // Ą
-    { 11, 15, 13, 0, 11, 42, 311 }, // ą
-    { 14, 24, 14, 1, 23, 84, 353 }, // Ć
-    { 10, 17, 11, 1, 16, 43, 437 }, // ć
-    { 15, 22, 14, 1, 21, 83, 480 }, // Ĉ
-    { 11, 16, 11, 1, 15, 44, 563 }, // ĉ
-    { 14, 23, 14, 1, 22, 81, 607 }, // Ċ
-    { 9, 16, 11, 1, 15, 36, 688 }, // ċ
-    { 14, 24, 14, 1, 23, 84, 724 }, // Č
-    { 10, 17, 11, 1, 16, 43, 808 }, // č
-    { 15, 21, 16, 0, 21, 79, 851 }, // Ď
-    { 16, 16, 13, 1, 15, 64, 930 }, // ď
-    { 15, 15, 16, 0, 15, 57, 994 }, // Đ
-    { 15, 16, 13, 1, 15, 60, 1051 }, // đ
-    { 14, 19, 13, 0, 19, 67, 1111 }, // Ē
-    { 12, 15, 13, 1, 15, 45, 1178 }, // ē
-    { 14, 21, 13, 0, 21, 74, 1223 }, // Ĕ
-    { 12, 17, 13, 1, 17, 51, 1297 }, // ĕ
-    { 14, 20, 13, 0, 20, 70, 1348 }, // Ė
-    { 11, 16, 13, 1, 16, 44, 1418 }, // ė
-    { 14, 19, 13, 0, 15, 67, 1462 }, // Ę
-    { 11, 15, 13, 1, 10, 42, 1529 }, // ę
-    { 14, 21, 13, 0, 21, 74, 1571 }, // Ě
-    { 11, 17, 13, 1, 17, 47, 1645 }, // ě
-    { 15, 19, 17, 1, 19, 72, 1692 }, // Ĝ
-    { 13, 20, 12, 0, 15, 65, 1764 }, // ĝ
-    { 15, 21, 17, 1, 21, 79, 1829 }, // Ğ
-    { 12, 21, 12, 0, 16, 63, 1908 }, // ğ
-    { 14, 20, 17, 1, 20, 70, 1971 }, // Ġ
-    { 12, 20, 12, 0, 15, 60, 2041 }, // ġ
-    { 14, 23, 17, 1, 15, 81, 2101 }, // Ģ
-    { 12, 21, 12, 0, 16, 63, 2182 }, // ģ
-    { 16, 19, 16, 0, 19, 76, 2245 }, // Ĥ
-    { 12, 19, 13, 0, 19, 57, 2321 }, // ĥ
-    { 16, 15, 16, 0, 15, 60, 2378 }, // Ħ
-    { 12, 15, 13, 0, 15, 45, 2438 }, // ħ
-    { 10, 21, 7, 0, 21, 53, 2483 }, // Ĩ
-    { 9, 15, 6, 0, 15, 34, 2536 }, // ĩ
-    { 11, 20, 7, 0, 20, 55, 2570 }, // Ī
-    { 9, 14, 6, 0, 14, 32, 2625 }, // ī
-    { 8, 19, 10, 2, 15, 38, 2657 }, // Į
-    { 8, 19, 6, -1, 15, 38, 2695 }, // į
-    { 9, 21, 7, 0, 21, 48, 2733 }, // İ
-    { 6, 10, 6, 0, 10, 15, 2781 }, // ı
-    { 14, 19, 15, 0, 15, 67, 2796 }, // Ĳ
-    { 16, 20, 6, 0, 15, 80, 2863 }, // ĳ
-    { 14, 23, 10, -1, 19, 81, 2943 }, // Ĵ
-    { 14, 20, 11, 1, 15, 70, 3024 }, // ĵ
-    { 14, 21, 15, 0, 15, 74, 3094 }, // Ķ
-    { 10, 22, 13, 0, 14, 55, 3168 }, // ķ
-    { 8, 9, 9, 0, 9, 18, 3223 }, // ĸ
-    { 11, 20, 13, 0, 20, 55, 3241 }, // Ĺ
-    { 10, 20, 8, 0, 20, 50, 3296 }, // ĺ
-    { 11, 22, 13, 0, 15, 61, 3346 }, // Ļ
-    { 7, 21, 8, 0, 14, 37, 3407 }, // ļ
-    { 12, 15, 13, 0, 15, 45, 3444 }, // Ľ
-    { 11, 14, 8, 0, 14, 39, 3489 }, // ľ
-    { 12, 14, 13, 0, 14, 42, 3528 }, // Ŀ
-    { 10, 14, 8, 0, 14, 35, 3570 }, // ŀ
-    { 23, 21, 13, -8, 17, 121, 3605 }, // Ł
-    { 16, 14, 8, -6, 14, 56, 3726 }, // ł
-    { 17, 20, 16, 0, 20, 85, 3782 }, // Ń
-    { 12, 16, 12, 0, 16, 48, 3867 }, // ń
-    { 17, 21, 16, 0, 15, 90, 3915 }, // Ņ
-    { 11, 16, 12, 0, 10, 44, 4005 }, // ņ
-    { 17, 20, 16, 0, 20, 85, 4049 }, // Ň
-    { 12, 16, 12, 0, 16, 48, 4134 }, // ň
-    { 12, 18, 11, -2, 18, 54, 4182 }, // ŉ
-    { 17, 19, 16, 0, 15, 81, 4236 }, // Ŋ
-    { 11, 14, 12, 0, 10, 39, 4317 }, // ŋ
-    { 16, 20, 17, 1, 19, 80, 4356 }, // Ō
-    { 12, 15, 13, 1, 15, 45, 4436 }, // ō
-    { 16, 22, 17, 1, 21, 88, 4481 }, // Ŏ
-    { 12, 18, 13, 1, 18, 54, 4569 }, // ŏ
-    { 17, 21, 17, 1, 20, 90, 4623 }, // Ő
-    { 14, 17, 13, 1, 17, 60, 4713 }, // ő
-    { 22, 15, 20, 1, 15, 83, 4773 }, // Œ
-    { 18, 11, 18, 1, 11, 50, 4856 }, // œ
-    { 13, 20, 14, 0, 20, 65, 4906 }, // Ŕ
-    { 9, 14, 10, 0, 14, 32, 4971 }, // ŕ
-    { 13, 22, 14, 0, 14, 72, 5003 }, // Ŗ
-    { 10, 19, 10, -1, 10, 48, 5075 }, // ŗ
-    { 13, 20, 14, 0, 20, 65, 5123 }, // Ř
-    { 9, 14, 10, 0, 14, 32, 5188 }, // ř
-    { 15, 22, 16, 0, 21, 83, 5220 }, // Ś
-    { 11, 16, 12, 0, 16, 44, 5303 }, // ś
-    { 16, 21, 16, 0, 20, 84, 5347 }, // Ŝ
-    { 11, 15, 12, 0, 15, 42, 5431 }, // ŝ
-    { 15, 19, 16, 0, 15, 72, 5473 }, // Ş
-    { 11, 14, 12, 0, 10, 39, 5545 }, // ş
-    { 15, 23, 16, 0, 22, 87, 5584 }, // Š
-    { 11, 16, 12, 0, 16, 44, 5671 }, // š
-    { 14, 17, 16, 3, 14, 60, 5715 }, // Ţ
-    { 8, 16, 11, 2, 13, 32, 5775 }, // ţ
-    { 14, 20, 16, 3, 20, 70, 5807 }, // Ť
-    { 10, 14, 11, 2, 14, 35, 5877 }, // ť
-    { 14, 14, 16, 3, 14, 49, 5912 }, // Ŧ
-    { 9, 13, 11, 1, 13, 30, 5961 }, // ŧ
-    { 15, 21, 15, 1, 20, 79, 5991 }, // Ũ
-    { 11, 15, 12, 1, 15, 42, 6070 }, // ũ
-    { 15, 20, 15, 1, 19, 75, 6112 }, // Ū
-    { 11, 14, 12, 1, 14, 39, 6187 }, // ū
-    { 15, 22, 15, 1, 21, 83, 6226 }, // Ŭ
-    { 11, 16, 12, 1, 16, 44, 6309 }, // ŭ
-    { 15, 22, 15, 1, 21, 83, 6353 }, // Ů
-    { 11, 16, 12, 1, 16, 44, 6436 }, // ů
-    { 16, 21, 15, 1, 20, 84, 6480 }, // Ű
-    { 13, 15, 12, 1, 15, 49, 6564 }, // ű
-    { 15, 19, 15, 1, 15, 72, 6613 }, // Ų
-    { 11, 15, 12, 1, 10, 42, 6685 }, // ų
-    { 19, 18, 21, 3, 18, 86, 6727 }, // Ŵ
-    { 13, 14, 16, 3, 14, 46, 6813 }, // ŵ
-    { 12, 19, 15, 4, 19, 57, 6859 }, // Ŷ
-    { 13, 21, 13, 0, 16, 69, 6916 }, // ŷ
-    { 12, 20, 15, 4, 20, 60, 6985 }, // Ÿ
-    { 17, 20, 16, 0, 20, 85, 7045 }, // Ź
-    { 12, 16, 13, 0, 16, 48, 7130 }, // ź
-    { 17, 19, 16, 0, 19, 81, 7178 }, // Ż
-    { 12, 15, 13, 0, 15, 45, 7259 }, // ż
-    { 17, 20, 16, 0, 20, 85, 7304 }, // Ž
-    { 12, 16, 13, 0, 16, 48, 7389 }, // ž
-    { 9, 14, 9, 2, 14, 32, 7437 }, // ſ
-    { 5, 3, 0, 4, 13, 4, 0 }, // ̀
-    { 5, 4, 0, 3, 13, 5, 4 }, // ́
-    { 8, 4, 0, -1, 0, 8, 9 }, // ̂
-    { 7, 4, 0, 3, 13, 7, 17 }, // ̃
-    { 8, 3, 0, 3, 12, 6, 24 }, // ̄
-    { 11, 3, 0, 5, 15, 9, 30 }, // ̅
-    { 8, 4, 0, 3, 13, 8, 39 }, // ̆
-    { 4, 3, 0, 3, 13, 3, 47 }, // ̇
-    { 9, 3, 0, 3, 13, 7, 50 }, // ̈
-    { 4, 4, 0, 3, 11, 4, 57 }, // ̉
-    { 5, 4, 0, 3, 13, 5, 61 }, // ̊
-    { 12, 3, 0, 3, 13, 9, 66 }, // ̋
-    { 8, 4, 0, 3, 13, 8, 75 }, // ̌
-    { 12, 3, 0, -5, 14, 9, 83 }, // ̏
-    { 6, 5, 0, 2, 13, 8, 92 }, // ̒
-    { 6, 5, 0, 2, 12, 8, 100 }, // ̓
-    { 6, 5, 0, -3, 12, 8, 108 }, // ̔
-    { 4, 5, 0, 0, 0, 5, 116 }, // ̘
-    { 4, 5, 0, 1, 0, 5, 121 }, // ̙
-    { 8, 4, 0, 4, 13, 8, 126 }, // ̚
-    { 3, 4, 0, 3, 11, 3, 134 }, // ̛
-    { 3, 3, 0, 0, -1, 3, 137 }, // ̜
-    { 4, 4, 0, 2, 3, 4, 140 }, // ̝
-    { 4, 4, 0, 0, 0, 4, 144 }, // ̞
-    { 4, 4, 0, 0, -1, 4, 148 }, // ̟
-    { 8, 3, 0, 0, -2, 6, 152 }, // ̠
-    { 4, 3, 0, 0, 1, 3, 158 }, // ̣
-    { 9, 3, 0, -1, 0, 7, 161 }, // ̤
-    { 5, 4, 0, 3, 13, 5, 168 }, // ̥
-    { 6, 6, 0, 0, 3, 9, 173 }, // ̦
-    { 5, 5, 0, 0, 1, 7, 182 }, // ̧
-    { 5, 5, 0, 0, 0, 7, 189 }, // ̨
-    { 4, 5, 0, -1, -1, 5, 196 }, // ̩
-    { 6, 3, 0, 0, -1, 5, 201 }, // ̪
-    { 7, 4, 0, 0, 0, 7, 206 }, // ̬
-    { 8, 4, 0, -1, 0, 8, 213 }, // ̭
-    { 7, 4, 0, 3, 13, 7, 221 }, // ̰
-    { 7, 3, 0, 4, 13, 6, 228 }, // ̱
-    { 7, 3, 0, 0, -1, 6, 234 }, // ̲
-    { 7, 4, 0, 3, 13, 7, 240 }, // ̴
-    { 9, 2, 0, 2, 6, 5, 247 }, // ̵
-    { 3, 3, 0, 1, -1, 3, 252 }, // ̹
-    { 6, 4, 0, -1, 0, 6, 255 }, // ̺
-    { 6, 4, 0, 0, 0, 6, 261 }, // ̻
-    { 6, 4, 0, 0, 0, 6, 267 }, // ̼
-    { 5, 4, 0, 3, 13, 5, 273 }, // ̽
-    { 7, 4, 0, 3, 13, 7, 278 }, // ͂
-    { 4, 3, 0, 3, 14, 3, 285 }, // ̓
-    { 9, 8, 0, 3, 18, 18, 288 }, // ̈́
-    { 6, 3, 0, 4, 13, 5, 306 }, // ͆
-    { 10, 6, 0, -1, 0, 15, 311 }, // ͇
-    { 8, 5, 0, 0, 0, 10, 326 }, // ͈
-    { 6, 5, 0, 0, -1, 8, 336 }, // ͉
-    { 8, 10, 0, 3, 16, 20, 344 }, // ͊
-    { 16, 7, 0, 5, 15, 28, 364 }, // ͋
-    { 12, 9, 0, 3, 9, 27, 392 }, // ͌
-    { 9, 5, 0, 1, 0, 12, 419 }, // ͍
-    { 3, 3, 0, 2, 2, 3, 431 }, // ͎
-    { 14, 3, 0, 1, 0, 11, 434 }, // ͜
-    { 14, 3, 0, 3, 13, 11, 445 }, // ͡
-    { 17, 5, 0, 0, -1, 22, 456 }, // ͢
-    { 12, 17, 11, 1, 17, 51, 0 }, // Ѐ
-    { 12, 16, 11, 1, 16, 48, 51 }, // Ё
-    { 12, 14, 17, 5, 14, 42, 99 }, // Ђ
-    { 12, 20, 11, 1, 20, 60, 141 }, // Ѓ
-    { 13, 14, 15, 1, 13, 46, 201 }, // Є
-    { 15, 16, 16, 0, 15, 60, 247 }, // Ѕ
-    { 8, 15, 7, 0, 15, 30, 307 }, // І
-    { 11, 21, 7, 0, 21, 58, 337 }, // Ї
-    { 12, 19, 10, -1, 15, 57, 395 }, // Ј
-    { 17, 14, 19, 2, 13, 60, 452 }, // Љ
-    { 17, 14, 19, 2, 13, 60, 512 }, // Њ
-    { 14, 14, 16, 3, 14, 49, 572 }, // Ћ
-    { 15, 21, 15, 0, 21, 79, 621 }, // Ќ
-    { 15, 18, 16, 1, 18, 68, 700 }, // Ѝ
-    { 13, 20, 12, -1, 19, 65, 768 }, // Ў
-    { 13, 16, 12, 1, 12, 52, 833 }, // Џ
-    { 14, 14, 17, 0, 14, 49, 885 }, // А
-    { 12, 14, 11, 1, 13, 42, 934 }, // Б
-    { 11, 14, 11, 1, 13, 39, 976 }, // В
-    { 12, 12, 11, 1, 12, 36, 1015 }, // Г
-    { 14, 14, 14, 1, 12, 49, 1051 }, // Д
-    { 12, 12, 11, 1, 12, 36, 1100 }, // Е
-    { 21, 15, 21, 0, 15, 79, 1136 }, // Ж
-    { 11, 14, 12, 1, 13, 39, 1215 }, // З
-    { 15, 15, 16, 1, 15, 57, 1254 }, // И
-    { 15, 19, 16, 1, 19, 72, 1311 }, // Й
-    { 14, 15, 15, 0, 15, 53, 1383 }, // К
-    { 13, 13, 12, 1, 12, 43, 1436 }, // Л
-    { 15, 12, 14, 1, 12, 45, 1479 }, // М
-    { 16, 15, 16, 0, 15, 60, 1524 }, // Н
-    { 16, 16, 17, 1, 15, 64, 1584 }, // О
-    { 13, 13, 11, 1, 13, 43, 1648 }, // П
-    { 14, 15, 13, 0, 15, 53, 1691 }, // Р
-    { 14, 17, 14, 1, 16, 60, 1744 }, // С
-    { 14, 14, 16, 3, 14, 49, 1804 }, // Т
-    { 13, 14, 12, -1, 13, 46, 1853 }, // У
-    { 14, 13, 15, 3, 13, 46, 1899 }, // Ф
-    { 17, 15, 17, 0, 15, 64, 1945 }, // Х
-    { 12, 16, 12, 1, 13, 48, 2009 }, // Ц
-    { 10, 12, 11, 3, 12, 30, 2057 }, // Ч
-    { 15, 13, 14, 1, 13, 49, 2087 }, // Ш
-    { 15, 16, 15, 1, 13, 60, 2136 }, // Щ
-    { 10, 13, 11, 1, 12, 33, 2196 }, // Ъ
-    { 18, 14, 18, 1, 13, 63, 2229 }, // Ы
-    { 10, 13, 11, 1, 12, 33, 2292 }, // Ь
-    { 14, 14, 15, 1, 13, 49, 2325 }, // Э
-    { 16, 14, 17, 2, 13, 56, 2374 }, // Ю
-    { 14, 14, 14, 0, 14, 49, 2430 }, // Я
-    { 11, 11, 13, 0, 11, 31, 2479 }, // а
-    { 11, 14, 12, 2, 14, 39, 2510 }, // б
-    { 10, 11, 10, 0, 11, 28, 2549 }, // в
-    { 10, 10, 10, 1, 10, 25, 2577 }, // г
-    { 12, 12, 13, 1, 10, 36, 2602 }, // д
-    { 11, 10, 13, 1, 10, 28, 2638 }, // е
-    { 18, 12, 18, 0, 12, 54, 2666 }, // ж
-    { 8, 9, 7, 0, 9, 18, 2720 }, // з
-    { 11, 10, 11, 1, 10, 28, 2738 }, // и
-    { 11, 13, 11, 1, 13, 36, 2766 }, // й
-    { 11, 10, 11, 0, 10, 28, 2802 }, // к
-    { 10, 10, 8, 0, 9, 25, 2830 }, // л
-    { 13, 11, 14, 0, 11, 36, 2855 }, // м
-    { 13, 11, 13, 0, 11, 36, 2891 }, // н
-    { 10, 12, 14, 2, 11, 30, 2927 }, // о
-    { 11, 10, 11, 1, 10, 28, 2957 }, // п
-    { 14, 15, 14, -1, 10, 53, 2985 }, // р
-    { 9, 12, 11, 1, 11, 27, 3038 }, // с
-    { 10, 9, 11, 3, 9, 23, 3065 }, // т
-    { 13, 15, 13, 0, 10, 49, 3088 }, // у
-    { 14, 14, 15, 2, 10, 49, 3137 }, // ф
-    { 12, 10, 12, 1, 10, 30, 3186 }, // х
-    { 11, 13, 12, 1, 10, 36, 3216 }, // ц
-    { 8, 9, 8, 1, 9, 18, 3252 }, // ч
-    { 14, 10, 14, 1, 10, 35, 3270 }, // ш
-    { 14, 13, 15, 1, 10, 46, 3305 }, // щ
-    { 10, 10, 13, 3, 9, 25, 3351 }, // ъ
-    { 14, 11, 14, 1, 10, 39, 3376 }, // ы
-    { 9, 11, 10, 1, 10, 25, 3415 }, // ь
-    { 10, 11, 11, 1, 10, 28, 3440 }, // э
-    { 13, 11, 13, 1, 10, 36, 3468 }, // ю
-    { 11, 10, 10, 1, 10, 28, 3504 }, // я
-    { 11, 16, 13, 1, 16, 44, 3532 }, // ѐ
-    { 11, 13, 11, 2, 12, 36, 3576 }, // ё
-    { 12, 18, 13, 0, 15, 54, 3612 }, // ђ
-    { 10, 14, 10, 1, 14, 35, 3666 }, // ѓ
-    { 10, 10, 10, 0, 9, 25, 3701 }, // є
-    { 11, 10, 12, 0, 10, 28, 3726 }, // ѕ
-    { 7, 15, 6, 0, 15, 27, 3754 }, // і
-    { 9, 14, 6, 0, 14, 32, 3781 }, // ї
-    { 11, 20, 11, 1, 15, 55, 3813 }, // ј
-    { 13, 10, 13, 0, 9, 33, 3868 }, // љ
-    { 12, 10, 13, 1, 9, 30, 3901 }, // њ
-    { 12, 15, 13, 0, 15, 45, 3931 }, // ћ
-    { 11, 15, 11, 0, 15, 42, 3976 }, // ќ
-    { 11, 14, 11, 1, 14, 39, 4018 }, // ѝ
-    { 13, 22, 13, 0, 17, 72, 4057 }, // ў
-    { 10, 12, 9, 0, 9, 30, 4129 }, // џ
-    { 10, 13, 14, 4, 12, 33, 4159 }, // Ѣ
-    { 9, 13, 12, 3, 12, 30, 4192 }, // ѣ
-    { 17, 12, 17, 1, 12, 51, 4222 }, // Ѫ
-    { 11, 10, 12, 1, 9, 28, 4273 }, // ѫ
-    { 15, 16, 16, 1, 15, 60, 4301 }, // Ѳ
-    { 12, 12, 13, 1, 12, 36, 4361 }, // ѳ
-    { 19, 18, 17, 4, 18, 86, 4397 }, // Ѵ
-    { 11, 12, 14, 3, 12, 33, 4483 }, // ѵ
-    { 7, 5, 0, 4, 15, 9, 4516 }, // ҆
-    { 13, 14, 11, 1, 14, 46, 4525 }, // Ґ
-    { 11, 12, 10, 1, 12, 33, 4571 }, // ґ
-    { 12, 12, 11, 1, 12, 36, 4604 }, // Ғ
-    { 9, 8, 8, 0, 8, 18, 4640 }, // ғ
-    { 14, 14, 11, 1, 14, 49, 4658 }, // Ҕ
-    { 8, 9, 7, 0, 9, 18, 4707 }, // ҕ
-    { 20, 18, 21, -1, 15, 90, 4725 }, // Җ
-    { 14, 12, 15, -1, 10, 42, 4815 }, // җ
-    { 11, 15, 12, 1, 13, 42, 4857 }, // Ҙ
-    { 8, 13, 7, 0, 9, 26, 4899 }, // ҙ
-    { 14, 17, 15, -1, 15, 60, 4925 }, // Қ
-    { 10, 11, 10, -1, 10, 28, 4985 }, // қ
-    { 14, 13, 16, 2, 13, 46, 5013 }, // Ҝ
-    { 11, 9, 12, 1, 9, 25, 5059 }, // ҝ
-    { 14, 15, 15, 0, 15, 53, 5084 }, // Ҟ
-    { 10, 14, 13, 0, 14, 35, 5137 }, // ҟ
-    { 15, 15, 15, -1, 15, 57, 5172 }, // Ҡ
-    { 10, 11, 10, -1, 11, 28, 5229 }, // ҡ
-    { 16, 17, 16, -1, 15, 68, 5257 }, // Ң
-    { 11, 12, 11, -1, 11, 33, 5325 }, // ң
-    { 22, 15, 16, 0, 15, 83, 5358 }, // Ҥ
-    { 15, 10, 11, 0, 10, 38, 5441 }, // ҥ
-    { 18, 14, 20, 2, 14, 63, 5479 }, // Ҧ
-    { 16, 16, 18, 1, 11, 64, 5542 }, // ҧ
-    { 17, 15, 20, 2, 14, 64, 5606 }, // Ҩ
-    { 14, 12, 16, 1, 11, 42, 5670 }, // ҩ
-    { 14, 19, 14, 1, 16, 67, 5712 }, // Ҫ
-    { 9, 13, 11, 1, 11, 30, 5779 }, // ҫ
-    { 13, 16, 16, 2, 14, 52, 5809 }, // Ҭ
-    { 9, 12, 11, 1, 10, 27, 5861 }, // ҭ
-    { 12, 14, 15, 4, 14, 42, 5888 }, // Ү
-    { 10, 12, 11, 3, 9, 30, 5930 }, // ү
-    { 13, 14, 15, 3, 14, 46, 5960 }, // Ұ
-    { 13, 13, 11, 0, 9, 43, 6006 }, // ұ
-    { 17, 17, 17, -1, 15, 73, 6049 }, // Ҳ
-    { 12, 12, 11, -1, 10, 36, 6122 }, // ҳ
-    { 13, 15, 18, 4, 12, 49, 6158 }, // Ҵ
-    { 9, 11, 13, 3, 8, 25, 6207 }, // ҵ
-    { 11, 16, 14, 3, 12, 44, 6232 }, // Ҷ
-    { 8, 12, 10, 1, 9, 24, 6276 }, // ҷ
-    { 11, 12, 12, 3, 12, 33, 6300 }, // Ҹ
-    { 9, 9, 8, 1, 9, 21, 6333 }, // ҹ
-    { 10, 14, 13, 2, 14, 35, 6354 }, // Һ
-    { 12, 15, 13, 0, 15, 45, 6389 }, // һ
-    { 14, 13, 16, 1, 13, 46, 6434 }, // Ҽ
-    { 10, 9, 12, 0, 9, 23, 6480 }, // ҽ
-    { 14, 15, 18, 3, 13, 53, 6503 }, // Ҿ
-    { 10, 12, 13, 2, 10, 30, 6556 }, // ҿ
-    { 8, 15, 7, 0, 15, 30, 6586 }, // Ӏ
-    { 21, 21, 21, 0, 21, 111, 6616 }, // Ӂ
-    { 18, 18, 18, 0, 18, 81, 6727 }, // ӂ
-    { 12, 17, 13, 2, 13, 51, 6808 }, // Ӄ
-    { 9, 12, 9, 0, 9, 27, 6859 }, // ӄ
-    { 13, 16, 12, 1, 13, 52, 6886 }, // Ӆ
-    { 10, 11, 9, 0, 9, 28, 6938 }, // ӆ
-    { 16, 19, 16, 0, 15, 76, 6966 }, // Ӈ
-    { 11, 14, 11, 0, 11, 39, 7042 }, // ӈ
-    { 16, 20, 16, 0, 15, 80, 7081 }, // Ӊ
-    { 11, 15, 11, 0, 11, 42, 7161 }, // ӊ
-    { 11, 15, 11, 2, 12, 42, 7203 }, // Ӌ
-    { 7, 11, 8, 2, 9, 20, 7245 }, // ӌ
-    { 18, 20, 21, 0, 15, 90, 7265 }, // Ӎ
-    { 12, 14, 14, 0, 10, 42, 7355 }, // ӎ
-    { 6, 12, 5, 1, 12, 18, 7397 }, // ӏ
-    { 16, 21, 17, 0, 21, 84, 7415 }, // Ӑ
-    { 14, 16, 13, 0, 16, 56, 7499 }, // ӑ
-    { 16, 19, 17, 0, 19, 76, 7555 }, // Ӓ
-    { 15, 15, 13, 0, 15, 57, 7631 }, // ӓ
-    { 23, 16, 24, 0, 15, 92, 7688 }, // Ӕ
-    { 18, 11, 20, 0, 11, 50, 7780 }, // ӕ
-    { 12, 18, 11, 1, 18, 54, 7830 }, // Ӗ
-    { 12, 17, 13, 1, 17, 51, 7884 }, // ӗ
-    { 11, 11, 13, 1, 10, 31, 7935 }, // Ә
-    { 11, 12, 14, 5, 11, 33, 7966 }, // ә
-    { 13, 18, 13, 1, 17, 59, 7999 }, // Ӛ
-    { 12, 13, 14, 4, 11, 39, 8058 }, // ӛ
-    { 21, 20, 22, 0, 20, 105, 8097 }, // Ӝ
-    { 18, 17, 18, 0, 17, 77, 8202 }, // ӝ
-    { 12, 18, 12, 1, 17, 54, 8279 }, // Ӟ
-    { 12, 14, 7, 0, 14, 42, 8333 }, // ӟ
-    { 10, 13, 10, 2, 13, 33, 8375 }, // Ӡ
-    { 10, 13, 10, 1, 9, 33, 8408 }, // ӡ
-    { 15, 17, 16, 1, 17, 64, 8441 }, // Ӣ
-    { 12, 13, 11, 1, 13, 39, 8505 }, // ӣ
-    { 15, 18, 16, 1, 18, 68, 8544 }, // Ӥ
-    { 12, 14, 11, 1, 14, 42, 8612 }, // ӥ
-    { 16, 21, 17, 1, 20, 84, 8654 }, // Ӧ
-    { 11, 16, 14, 2, 15, 44, 8738 }, // ӧ
-    { 15, 13, 16, 1, 12, 49, 8782 }, // Ө
-    { 11, 10, 13, 1, 10, 28, 8831 }, // ө
-    { 15, 20, 16, 1, 19, 75, 8859 }, // Ӫ
-    { 12, 16, 13, 1, 16, 48, 8934 }, // ӫ
-    { 14, 19, 15, 1, 18, 67, 8982 }, // Ӭ
-    { 11, 15, 11, 1, 14, 42, 9049 }, // ӭ
-    { 13, 18, 12, -1, 17, 59, 9091 }, // Ӯ
-    { 13, 21, 13, 0, 16, 69, 9150 }, // ӯ
-    { 13, 19, 12, -1, 18, 62, 9219 }, // Ӱ
-    { 13, 21, 13, 0, 16, 69, 9281 }, // ӱ
-    { 15, 19, 12, -1, 18, 72, 9350 }, // Ӳ
-    { 15, 22, 13, 0, 17, 83, 9422 }, // ӳ
-    { 11, 17, 11, 3, 17, 47, 9505 }, // Ӵ
-    { 10, 14, 8, 1, 14, 35, 9552 }, // ӵ
-    { 12, 15, 11, 1, 12, 45, 9587 }, // Ӷ
-    { 9, 10, 8, 0, 8, 23, 9632 }, // ӷ
-    { 18, 19, 18, 1, 18, 86, 9655 }, // Ӹ
-    { 14, 16, 14, 1, 15, 56, 9741 }, // ӹ
-    { 17, 18, 17, 0, 15, 77, 9797 }, // Ӽ
-    { 12, 13, 11, 0, 11, 39, 9874 }, // ӽ
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 22, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 22, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 9, 2, 9, 2, 6, 5, 0 }, // ‐
-    { 9, 2, 9, 2, 6, 5, 5 }, // ‑
-    { 13, 2, 12, 2, 6, 7, 10 }, // ‒
-    { 12, 3, 13, 2, 6, 9, 17 }, // –
-    { 17, 3, 19, 2, 6, 13, 26 }, // —
-    { 17, 3, 19, 2, 6, 13, 39 }, // ―
-    { 11, 15, 9, 0, 12, 42, 52 }, // ‖
-    { 14, 6, 13, 0, -1, 21, 94 }, // ‗
-    { 6, 6, 6, 3, 15, 9, 115 }, // ‘
-    { 6, 5, 6, 3, 14, 8, 124 }, // ’
-    { 6, 6, 5, 0, 3, 9, 132 }, // ‚
-    { 6, 6, 6, 3, 15, 9, 141 }, // ‛
-    { 10, 6, 9, 3, 15, 15, 150 }, // “
-    { 10, 6, 9, 3, 15, 15, 165 }, // ”
-    { 6, 6, 5, 0, 3, 9, 180 }, // „
-    { 10, 5, 9, 3, 15, 13, 189 }, // ‟
-    { 9, 22, 10, 3, 17, 50, 202 }, // †
-    { 11, 22, 10, 1, 17, 61, 252 }, // ‡
-    { 11, 10, 8, 0, 12, 28, 313 }, // •
-    { 5, 6, 7, 2, 8, 8, 341 }, // ‣
-    { 4, 3, 4, 0, 3, 3, 349 }, // ․
-    { 4, 3, 4, 0, 3, 3, 352 }, // ‥
-    { 16, 3, 16, 0, 3, 12, 355 }, // …
-    { 3, 2, 4, 1, 6, 2, 367 }, // ‧
-    { 0, 0, 21, 0, 0, 0, 369 }, //  
-    { 14, 15, 18, 4, 13, 53, 369 }, // ‰
-    { 6, 5, 5, 3, 14, 8, 422 }, // ′
-    { 10, 6, 9, 3, 15, 15, 430 }, // ″
-    { 12, 6, 14, -2, 14, 18, 445 }, // ‴
-    { 4, 6, 6, 4, 14, 6, 463 }, // ‵
-    { 8, 6, 9, 3, 14, 12, 469 }, // ‶
-    { 12, 6, 14, 4, 14, 18, 481 }, // ‷
-    { 7, 3, 9, 4, 13, 6, 499 }, // ‸
-    { 6, 8, 7, 2, 8, 12, 505 }, // ‹
-    { 6, 8, 7, -1, 8, 12, 517 }, // ›
-    { 22, 17, 22, 0, 15, 94, 529 }, // ※
-    { 9, 17, 6, 0, 17, 39, 623 }, // ‼
-    { 12, 21, 12, 3, 20, 63, 662 }, // ‽
-    { 9, 2, 9, 4, 14, 5, 725 }, // ‾
-    { 8, 4, 11, 3, 12, 8, 730 }, // ‿
-    { 12, 12, 13, 3, 16, 36, 738 }, // ⁂
-    { 14, 14, 18, 4, 13, 49, 774 }, // ⁄
-    { 20, 19, 21, 4, 19, 95, 823 }, // ⁇
-    { 14, 19, 17, 4, 19, 67, 918 }, // ⁈
-    { 17, 20, 13, 0, 19, 85, 985 }, // ⁉
-    { 17, 26, 12, -1, 18, 111, 1070 }, // ⁒
-    { 0, 0, 80, 0, 0, 0, 1181 }, //  
-    { 6, 7, 5, 2, 14, 11, 0 }, // ⁰
-    { 5, 6, 5, 2, 14, 8, 11 }, // ⁴
-    { 6, 7, 5, 2, 14, 11, 19 }, // ⁵
-    { 6, 7, 5, 2, 14, 11, 30 }, // ⁶
-    { 5, 7, 6, 3, 14, 9, 41 }, // ⁷
-    { 6, 7, 6, 2, 14, 11, 50 }, // ⁸
-    { 6, 7, 6, 2, 14, 11, 61 }, // ⁹
-    { 11, 10, 12, 0, 10, 28, 72 }, // ⁿ
-    { 9, 9, 8, 0, 9, 21, 100 }, // ₀
-    { 5, 7, 5, -1, 4, 9, 121 }, // ₁
-    { 6, 7, 5, -1, 4, 11, 130 }, // ₂
-    { 6, 7, 5, -1, 4, 11, 141 }, // ₃
-    { 6, 7, 6, -1, 4, 11, 152 }, // ₄
-    { 6, 7, 5, -1, 4, 11, 163 }, // ₅
-    { 6, 7, 6, -1, 4, 11, 174 }, // ₆
-    { 6, 7, 5, 0, 4, 11, 185 }, // ₇
-    { 6, 7, 6, -1, 4, 11, 196 }, // ₈
-    { 6, 7, 6, -1, 4, 11, 207 }, // ₉
-    { 9, 23, 7, 2, 17, 52, 218 }, // ₍
-    { 10, 23, 7, -4, 17, 58, 270 }, // ₎
-    { 16, 23, 14, 0, 19, 92, 0 }, // ₡
-    { 14, 17, 14, 1, 16, 60, 92 }, // ₢
-    { 14, 16, 12, 0, 16, 56, 152 }, // ₤
-    { 17, 15, 16, 0, 15, 64, 208 }, // ₦
-    { 15, 15, 13, 0, 15, 57, 272 }, // ₧
-    { 19, 15, 19, 0, 15, 72, 329 }, // ₨
-    { 14, 15, 13, -1, 15, 53, 401 }, // ₩
-    { 17, 13, 18, 2, 13, 56, 454 }, // ₪
-    { 13, 14, 11, 1, 14, 46, 510 }, // ₫
-    { 13, 16, 14, 1, 14, 52, 556 }, // €
-    { 14, 14, 16, 3, 14, 49, 608 }, // ₮
-    { 17, 15, 11, 0, 15, 64, 657 }, // ₱
-    { 14, 21, 17, 1, 18, 74, 721 }, // ₲
-    { 19, 16, 15, 1, 15, 76, 795 }, // ₴
-    { 9, 14, 11, 1, 13, 32, 871 }, // ₵
-    { 16, 15, 16, 3, 15, 60, 903 }, // ₸
-    { 10, 13, 10, 2, 13, 33, 963 }, // ₹
-    { 10, 13, 11, 2, 12, 33, 996 }, // ₺
-    { 12, 13, 10, 1, 13, 39, 1029 }, // ₼
-    { 16, 15, 13, -2, 15, 60, 1068 }, // ₽
-    { 11, 11, 13, -2, 8, 31, 0 }, // ←
-    { 11, 10, 13, 2, 10, 28, 31 }, // ↑
-    { 11, 11, 13, 4, 8, 31, 59 }, // →
-    { 11, 10, 13, 5, 10, 28, 90 }, // ↓
-    { 18, 9, 15, -1, 8, 41, 118 }, // ↔
-    { 9, 17, 11, 2, 16, 39, 159 }, // ↕
-    { 10, 7, 11, -2, 7, 18, 198 }, // ↖
-    { 11, 7, 11, 2, 7, 20, 216 }, // ↗
-    { 8, 10, 11, 4, 9, 20, 236 }, // ↘
-    { 8, 10, 11, -1, 9, 20, 256 }, // ↙
-    { 13, 11, 14, 0, 10, 36, 276 }, // ⇐
-    { 13, 12, 15, 3, 12, 39, 312 }, // ⇑
-    { 13, 11, 14, 2, 10, 36, 351 }, // ⇒
-    { 13, 13, 15, 6, 12, 43, 387 }, // ⇓
-    { 17, 11, 16, 0, 10, 47, 430 }, // ⇔
-    { 11, 16, 13, 4, 10, 44, 477 }, // ⇕
-    { 13, 14, 11, 1, 14, 46, 0 }, // ∂
-    { 17, 17, 17, 0, 16, 73, 46 }, // ∅
-    { 13, 13, 14, 1, 13, 43, 119 }, // ∆
-    { 13, 12, 12, 2, 12, 39, 162 }, // ∏
-    { 13, 12, 12, 5, 12, 39, 201 }, // ∐
-    { 11, 13, 10, 1, 12, 36, 240 }, // ∑
-    { 8, 3, 10, 2, 6, 6, 276 }, // −
-    { 16, 14, 16, 2, 13, 56, 282 }, // √
-    { 15, 8, 15, 2, 10, 30, 338 }, // ∞
-    { 18, 19, 14, 0, 15, 86, 368 }, // ∫
-    { 7, 10, 5, 0, 10, 18, 454 }, // ∶
-    { 12, 9, 13, 3, 9, 27, 472 }, // ≈
-    { 14, 15, 18, 4, 13, 53, 499 }, // ≠
-    { 15, 13, 14, -1, 12, 49, 552 }, // ≤
-    { 14, 13, 14, 1, 12, 46, 601 }, // ≥
+    { 12, 8, 14, 1, 8, 24, 3815 }, // «
+    { 9, 5, 10, 2, 6, 12, 305 }, // ¬
+    { 9, 2, 9, 2, 6, 5, 317 }, // ­
+    { 8, 7, 9, 4, 18, 14, 322 }, // ®
+    { 7, 3, 9, 4, 13, 6, 336 }, // ¯
+    { 9, 8, 9, 2, 14, 18, 342 }, // °
+    { 11, 10, 12, 0, 9, 28, 360 }, // ±
+    { 5, 7, 5, 2, 14, 9, 388 }, // ²
+    { 6, 7, 5, 2, 14, 11, 397 }, // ³
+    { 5, 4, 5, 3, 13, 5, 408 }, // ´
+    { 13, 12, 12, -1, 10, 39, 413 }, // µ
+    { 12, 14, 10, 0, 12, 42, 452 }, // ¶
+    { 5, 3, 4, 1, 7, 4, 494 }, // ·
+    { 5, 5, 5, 0, 1, 7, 498 }, // ¸
+    { 4, 7, 5, 2, 14, 7, 505 }, // ¹
+    { 6, 6, 7, 3, 12, 9, 512 }, // º
+    { 11, 8, 11, -2, 8, 22, 3839 }, // »
+    { 14, 16, 18, 4, 15, 56, 521 }, // ¼
+    { 15, 15, 18, 4, 14, 57, 577 }, // ½
+    { 15, 15, 18, 3, 14, 57, 634 }, // ¾
+    { 11, 19, 10, -1, 10, 53, 691 }, // ¿
+    { 14, 19, 17, 0, 19, 67, 3861 }, // À
+    { 15, 22, 17, 0, 22, 83, 3928 }, // Á
+    { 15, 19, 17, 0, 19, 72, 4011 }, // Â
+    { 15, 19, 17, 0, 19, 72, 744 }, // Ã
+    { 16, 19, 17, 0, 19, 76, 4083 }, // Ä
+    { 14, 20, 17, 0, 20, 70, 816 }, // Å
+    { 23, 16, 24, 0, 15, 92, 886 }, // Æ
+    { 14, 20, 14, 1, 16, 70, 4159 }, // Ç
+    { 14, 19, 13, 0, 19, 67, 4229 }, // È
+    { 14, 22, 13, 0, 22, 77, 4296 }, // É
+    { 14, 18, 13, 0, 18, 63, 4373 }, // Ê
+    { 14, 19, 13, 0, 19, 67, 4436 }, // Ë
+    { 9, 21, 7, 0, 21, 48, 4503 }, // Ì
+    { 10, 24, 7, 0, 24, 60, 4551 }, // Í
+    { 10, 20, 7, 0, 20, 50, 4611 }, // Î
+    { 11, 21, 7, 0, 21, 58, 4661 }, // Ï
+    { 15, 15, 16, 0, 15, 57, 978 }, // Ð
+    { 17, 18, 16, 0, 18, 77, 4719 }, // Ñ
+    { 16, 21, 17, 1, 20, 84, 4796 }, // Ò
+    { 16, 24, 17, 1, 23, 96, 4880 }, // Ó
+    { 16, 20, 17, 1, 19, 80, 4976 }, // Ô
+    { 16, 21, 17, 1, 20, 84, 1035 }, // Õ
+    { 16, 21, 17, 1, 20, 84, 5056 }, // Ö
+    { 9, 5, 10, 1, 7, 12, 1119 }, // ×
+    { 29, 29, 17, -6, 22, 211, 1131 }, // Ø
+    { 15, 20, 15, 1, 19, 75, 5140 }, // Ù
+    { 15, 23, 15, 1, 22, 87, 5215 }, // Ú
+    { 15, 20, 15, 1, 19, 75, 5302 }, // Û
+    { 15, 20, 15, 1, 19, 75, 5377 }, // Ü
+    { 12, 23, 15, 4, 23, 69, 1342 }, // Ý
+    { 11, 13, 9, 0, 13, 36, 1411 }, // Þ
+    { 12, 13, 11, 1, 13, 39, 1447 }, // ß
+    { 11, 14, 13, 0, 14, 39, 5452 }, // à
+    { 11, 17, 13, 0, 17, 47, 5491 }, // á
+    { 12, 14, 13, 0, 14, 42, 5538 }, // â
+    { 12, 13, 13, 0, 13, 39, 1486 }, // ã
+    { 12, 14, 13, 0, 14, 42, 5580 }, // ä
+    { 11, 15, 13, 0, 15, 42, 1525 }, // å
+    { 18, 11, 20, 0, 11, 50, 1567 }, // æ
+    { 9, 15, 11, 1, 11, 34, 5622 }, // ç
+    { 11, 16, 13, 1, 16, 44, 5656 }, // è
+    { 11, 19, 13, 1, 19, 53, 5700 }, // é
+    { 11, 15, 13, 1, 15, 42, 5753 }, // ê
+    { 12, 16, 13, 1, 16, 48, 5795 }, // ë
+    { 7, 14, 6, 0, 14, 25, 5843 }, // ì
+    { 9, 17, 6, 0, 17, 39, 5868 }, // í
+    { 9, 13, 6, 0, 13, 30, 5907 }, // î
+    { 9, 14, 6, 0, 14, 32, 5937 }, // ï
+    { 15, 14, 14, 1, 14, 53, 1617 }, // ð
+    { 13, 14, 12, 0, 14, 46, 5969 }, // ñ
+    { 11, 16, 13, 1, 16, 44, 6015 }, // ò
+    { 11, 19, 13, 1, 19, 53, 6059 }, // ó
+    { 11, 15, 13, 1, 15, 42, 6112 }, // ô
+    { 11, 16, 13, 1, 16, 44, 1670 }, // õ
+    { 12, 16, 13, 1, 16, 48, 6154 }, // ö
+    { 11, 10, 13, 2, 10, 28, 1714 }, // ÷
+    { 16, 27, 13, -2, 18, 108, 1742 }, // ø
+    { 11, 15, 12, 1, 15, 42, 6202 }, // ù
+    { 11, 18, 12, 1, 18, 50, 6244 }, // ú
+    { 11, 14, 12, 1, 14, 39, 6294 }, // û
+    { 11, 15, 12, 1, 15, 42, 6333 }, // ü
+    { 13, 24, 13, 0, 19, 78, 1850 }, // ý
+    { 11, 18, 9, 0, 14, 50, 1928 }, // þ
+    { 13, 21, 13, 0, 16, 69, 1978 }, // ÿ
+    { 16, 19, 17, 0, 19, 76, 2047 }, // Ā
+    { 12, 13, 13, 0, 13, 39, 2123 }, // ā
+    { 16, 21, 17, 0, 21, 84, 2162 }, // Ă
+    { 12, 15, 13, 0, 15, 45, 2246 }, // ă
+    { 14, 19, 17, 0, 14, 67, 2291 }, // Ą
+    { 11, 15, 13, 0, 11, 42, 2358 }, // ą
+    { 14, 24, 14, 1, 23, 84, 2400 }, // Ć
+    { 10, 17, 11, 1, 16, 43, 2484 }, // ć
+    { 15, 22, 14, 1, 21, 83, 2527 }, // Ĉ
+    { 11, 16, 11, 1, 15, 44, 2610 }, // ĉ
+    { 14, 23, 14, 1, 22, 81, 2654 }, // Ċ
+    { 9, 16, 11, 1, 15, 36, 2735 }, // ċ
+    { 14, 24, 14, 1, 23, 84, 2771 }, // Č
+    { 10, 17, 11, 1, 16, 43, 2855 }, // č
+    { 15, 21, 16, 0, 21, 79, 2898 }, // Ď
+    { 16, 16, 13, 1, 15, 64, 2977 }, // ď
+    { 15, 15, 16, 0, 15, 57, 3041 }, // Đ
+    { 15, 16, 13, 1, 15, 60, 3098 }, // đ
+    { 14, 19, 13, 0, 19, 67, 3158 }, // Ē
+    { 12, 15, 13, 1, 15, 45, 3225 }, // ē
+    { 14, 21, 13, 0, 21, 74, 3270 }, // Ĕ
+    { 12, 17, 13, 1, 17, 51, 3344 }, // ĕ
+    { 14, 20, 13, 0, 20, 70, 3395 }, // Ė
+    { 11, 16, 13, 1, 16, 44, 3465 }, // ė
+    { 14, 19, 13, 0, 15, 67, 3509 }, // Ę
+    { 11, 15, 13, 1, 10, 42, 3576 }, // ę
+    { 14, 21, 13, 0, 21, 74, 3618 }, // Ě
+    { 11, 17, 13, 1, 17, 47, 3692 }, // ě
+    { 15, 19, 17, 1, 19, 72, 3739 }, // Ĝ
+    { 13, 20, 12, 0, 15, 65, 3811 }, // ĝ
+    { 15, 21, 17, 1, 21, 79, 3876 }, // Ğ
+    { 12, 21, 12, 0, 16, 63, 3955 }, // ğ
+    { 14, 20, 17, 1, 20, 70, 4018 }, // Ġ
+    { 12, 20, 12, 0, 15, 60, 4088 }, // ġ
+    { 14, 23, 17, 1, 15, 81, 4148 }, // Ģ
+    { 12, 21, 12, 0, 16, 63, 4229 }, // ģ
+    { 16, 19, 16, 0, 19, 76, 4292 }, // Ĥ
+    { 12, 19, 13, 0, 19, 57, 4368 }, // ĥ
+    { 16, 15, 16, 0, 15, 60, 4425 }, // Ħ
+    { 12, 15, 13, 0, 15, 45, 4485 }, // ħ
+    { 10, 21, 7, 0, 21, 53, 4530 }, // Ĩ
+    { 9, 15, 6, 0, 15, 34, 4583 }, // ĩ
+    { 11, 20, 7, 0, 20, 55, 4617 }, // Ī
+    { 9, 14, 6, 0, 14, 32, 4672 }, // ī
+    { 8, 19, 10, 2, 15, 38, 4704 }, // Į
+    { 8, 19, 6, -1, 15, 38, 4742 }, // į
+    { 9, 21, 7, 0, 21, 48, 4780 }, // İ
+    { 6, 10, 6, 0, 10, 15, 4828 }, // ı
+    { 14, 19, 15, 0, 15, 67, 4843 }, // Ĳ
+    { 16, 20, 6, 0, 15, 80, 4910 }, // ĳ
+    { 14, 23, 10, -1, 19, 81, 4990 }, // Ĵ
+    { 14, 20, 11, 1, 15, 70, 5071 }, // ĵ
+    { 14, 21, 15, 0, 15, 74, 5141 }, // Ķ
+    { 10, 22, 13, 0, 14, 55, 5215 }, // ķ
+    { 8, 9, 9, 0, 9, 18, 5270 }, // ĸ
+    { 11, 20, 13, 0, 20, 55, 5288 }, // Ĺ
+    { 10, 20, 8, 0, 20, 50, 5343 }, // ĺ
+    { 11, 22, 13, 0, 15, 61, 5393 }, // Ļ
+    { 7, 21, 8, 0, 14, 37, 5454 }, // ļ
+    { 12, 15, 13, 0, 15, 45, 5491 }, // Ľ
+    { 11, 14, 8, 0, 14, 39, 5536 }, // ľ
+    { 12, 14, 13, 0, 14, 42, 5575 }, // Ŀ
+    { 10, 14, 8, 0, 14, 35, 5617 }, // ŀ
+    { 23, 21, 13, -8, 17, 121, 5652 }, // Ł
+    { 16, 14, 8, -6, 14, 56, 5773 }, // ł
+    { 17, 20, 16, 0, 20, 85, 5829 }, // Ń
+    { 12, 16, 12, 0, 16, 48, 5914 }, // ń
+    { 17, 21, 16, 0, 15, 90, 5962 }, // Ņ
+    { 11, 16, 12, 0, 10, 44, 6052 }, // ņ
+    { 17, 20, 16, 0, 20, 85, 6096 }, // Ň
+    { 12, 16, 12, 0, 16, 48, 6181 }, // ň
+    { 12, 18, 11, -2, 18, 54, 6229 }, // ŉ
+    { 17, 19, 16, 0, 15, 81, 6283 }, // Ŋ
+    { 11, 14, 12, 0, 10, 39, 6364 }, // ŋ
+    { 16, 20, 17, 1, 19, 80, 6403 }, // Ō
+    { 12, 15, 13, 1, 15, 45, 6483 }, // ō
+    { 16, 22, 17, 1, 21, 88, 6528 }, // Ŏ
+    { 12, 18, 13, 1, 18, 54, 6616 }, // ŏ
+    { 17, 21, 17, 1, 20, 90, 6670 }, // Ő
+    { 14, 17, 13, 1, 17, 60, 6760 }, // ő
+    { 22, 15, 20, 1, 15, 83, 6375 }, // Œ
+    { 18, 11, 18, 1, 11, 50, 6458 }, // œ
+    { 13, 20, 14, 0, 20, 65, 6820 }, // Ŕ
+    { 9, 14, 10, 0, 14, 32, 6885 }, // ŕ
+    { 13, 22, 14, 0, 14, 72, 6917 }, // Ŗ
+    { 10, 19, 10, -1, 10, 48, 6989 }, // ŗ
+    { 13, 20, 14, 0, 20, 65, 7037 }, // Ř
+    { 9, 14, 10, 0, 14, 32, 7102 }, // ř
+    { 15, 22, 16, 0, 21, 83, 7134 }, // Ś
+    { 11, 16, 12, 0, 16, 44, 7217 }, // ś
+    { 16, 21, 16, 0, 20, 84, 7261 }, // Ŝ
+    { 11, 15, 12, 0, 15, 42, 7345 }, // ŝ
+    { 15, 19, 16, 0, 15, 72, 7387 }, // Ş
+    { 11, 14, 12, 0, 10, 39, 7459 }, // ş
+    { 15, 23, 16, 0, 22, 87, 7498 }, // Š
+    { 11, 16, 12, 0, 16, 44, 7585 }, // š
+    { 14, 17, 16, 3, 14, 60, 7629 }, // Ţ
+    { 8, 16, 11, 2, 13, 32, 7689 }, // ţ
+    { 14, 20, 16, 3, 20, 70, 7721 }, // Ť
+    { 10, 14, 11, 2, 14, 35, 7791 }, // ť
+    { 14, 14, 16, 3, 14, 49, 7826 }, // Ŧ
+    { 9, 13, 11, 1, 13, 30, 7875 }, // ŧ
+    { 15, 21, 15, 1, 20, 79, 7905 }, // Ũ
+    { 11, 15, 12, 1, 15, 42, 7984 }, // ũ
+    { 15, 20, 15, 1, 19, 75, 8026 }, // Ū
+    { 11, 14, 12, 1, 14, 39, 8101 }, // ū
+    { 15, 22, 15, 1, 21, 83, 8140 }, // Ŭ
+    { 11, 16, 12, 1, 16, 44, 8223 }, // ŭ
+    { 15, 22, 15, 1, 21, 83, 8267 }, // Ů
+    { 11, 16, 12, 1, 16, 44, 8350 }, // ů
+    { 16, 21, 15, 1, 20, 84, 8394 }, // Ű
+    { 13, 15, 12, 1, 15, 49, 8478 }, // ű
+    { 15, 19, 15, 1, 15, 72, 8527 }, // Ų
+    { 11, 15, 12, 1, 10, 42, 8599 }, // ų
+    { 19, 18, 21, 3, 18, 86, 8641 }, // Ŵ
+    { 13, 14, 16, 3, 14, 46, 8727 }, // ŵ
+    { 12, 19, 15, 4, 19, 57, 8773 }, // Ŷ
+    { 13, 21, 13, 0, 16, 69, 8830 }, // ŷ
+    { 12, 20, 15, 4, 20, 60, 8899 }, // Ÿ
+    { 17, 20, 16, 0, 20, 85, 8959 }, // Ź
+    { 12, 16, 13, 0, 16, 48, 9044 }, // ź
+    { 17, 19, 16, 0, 19, 81, 9092 }, // Ż
+    { 12, 15, 13, 0, 15, 45, 9173 }, // ż
+    { 17, 20, 16, 0, 20, 85, 9218 }, // Ž
+    { 12, 16, 13, 0, 16, 48, 9303 }, // ž
+    { 9, 14, 9, 2, 14, 32, 9351 }, // ſ
+    { 5, 3, 0, 4, 13, 4, 9383 }, // ̀
+    { 5, 4, 0, 3, 13, 5, 9387 }, // ́
+    { 8, 4, 0, -1, 0, 8, 9392 }, // ̂
+    { 7, 4, 0, 3, 13, 7, 9400 }, // ̃
+    { 8, 3, 0, 3, 12, 6, 9407 }, // ̄
+    { 11, 3, 0, 5, 15, 9, 9413 }, // ̅
+    { 8, 4, 0, 3, 13, 8, 9422 }, // ̆
+    { 4, 3, 0, 3, 13, 3, 9430 }, // ̇
+    { 9, 3, 0, 3, 13, 7, 9433 }, // ̈
+    { 4, 4, 0, 3, 11, 4, 9440 }, // ̉
+    { 5, 4, 0, 3, 13, 5, 9444 }, // ̊
+    { 12, 3, 0, 3, 13, 9, 9449 }, // ̋
+    { 8, 4, 0, 3, 13, 8, 9458 }, // ̌
+    { 12, 3, 0, -5, 14, 9, 9466 }, // ̏
+    { 6, 5, 0, 2, 13, 8, 9475 }, // ̒
+    { 6, 5, 0, 2, 12, 8, 9483 }, // ̓
+    { 6, 5, 0, -3, 12, 8, 9491 }, // ̔
+    { 4, 5, 0, 0, 0, 5, 9499 }, // ̘
+    { 4, 5, 0, 1, 0, 5, 9504 }, // ̙
+    { 8, 4, 0, 4, 13, 8, 9509 }, // ̚
+    { 3, 4, 0, 3, 11, 3, 9517 }, // ̛
+    { 3, 3, 0, 0, -1, 3, 9520 }, // ̜
+    { 4, 4, 0, 2, 3, 4, 9523 }, // ̝
+    { 4, 4, 0, 0, 0, 4, 9527 }, // ̞
+    { 4, 4, 0, 0, -1, 4, 9531 }, // ̟
+    { 8, 3, 0, 0, -2, 6, 9535 }, // ̠
+    { 4, 3, 0, 0, 1, 3, 9541 }, // ̣
+    { 9, 3, 0, -1, 0, 7, 9544 }, // ̤
+    { 5, 4, 0, 3, 13, 5, 9551 }, // ̥
+    { 6, 6, 0, 0, 3, 9, 9556 }, // ̦
+    { 5, 5, 0, 0, 1, 7, 9565 }, // ̧
+    { 5, 5, 0, 0, 0, 7, 9572 }, // ̨
+    { 4, 5, 0, -1, -1, 5, 9579 }, // ̩
+    { 6, 3, 0, 0, -1, 5, 9584 }, // ̪
+    { 7, 4, 0, 0, 0, 7, 9589 }, // ̬
+    { 8, 4, 0, -1, 0, 8, 9596 }, // ̭
+    { 7, 4, 0, 3, 13, 7, 9604 }, // ̰
+    { 7, 3, 0, 4, 13, 6, 9611 }, // ̱
+    { 7, 3, 0, 0, -1, 6, 9617 }, // ̲
+    { 7, 4, 0, 3, 13, 7, 9623 }, // ̴
+    { 9, 2, 0, 2, 6, 5, 9630 }, // ̵
+    { 3, 3, 0, 1, -1, 3, 9635 }, // ̹
+    { 6, 4, 0, -1, 0, 6, 9638 }, // ̺
+    { 6, 4, 0, 0, 0, 6, 9644 }, // ̻
+    { 6, 4, 0, 0, 0, 6, 9650 }, // ̼
+    { 5, 4, 0, 3, 13, 5, 9656 }, // ̽
+    { 7, 4, 0, 3, 13, 7, 9661 }, // ͂
+    { 4, 3, 0, 3, 14, 3, 9668 }, // ̓
+    { 9, 8, 0, 3, 18, 18, 9671 }, // ̈́
+    { 6, 3, 0, 4, 13, 5, 9689 }, // ͆
+    { 10, 6, 0, -1, 0, 15, 9694 }, // ͇
+    { 8, 5, 0, 0, 0, 10, 9709 }, // ͈
+    { 6, 5, 0, 0, -1, 8, 9719 }, // ͉
+    { 8, 10, 0, 3, 16, 20, 9727 }, // ͊
+    { 16, 7, 0, 5, 15, 28, 9747 }, // ͋
+    { 12, 9, 0, 3, 9, 27, 9775 }, // ͌
+    { 9, 5, 0, 1, 0, 12, 9802 }, // ͍
+    { 3, 3, 0, 2, 2, 3, 9814 }, // ͎
+    { 14, 3, 0, 1, 0, 11, 9817 }, // ͜
+    { 14, 3, 0, 3, 13, 11, 9828 }, // ͡
+    { 17, 5, 0, 0, -1, 22, 9839 }, // ͢
+    { 12, 17, 11, 1, 17, 51, 9861 }, // Ѐ
+    { 12, 16, 11, 1, 16, 48, 0 }, // Ё
+    { 12, 14, 17, 5, 14, 42, 0 }, // Ђ
+    { 12, 20, 11, 1, 20, 60, 42 }, // Ѓ
+    { 13, 14, 15, 1, 13, 46, 102 }, // Є
+    { 15, 16, 16, 0, 15, 60, 148 }, // Ѕ
+    { 8, 15, 7, 0, 15, 30, 208 }, // І
+    { 11, 21, 7, 0, 21, 58, 238 }, // Ї
+    { 12, 19, 10, -1, 15, 57, 296 }, // Ј
+    { 17, 14, 19, 2, 13, 60, 353 }, // Љ
+    { 17, 14, 19, 2, 13, 60, 413 }, // Њ
+    { 14, 14, 16, 3, 14, 49, 473 }, // Ћ
+    { 15, 21, 15, 0, 21, 79, 522 }, // Ќ
+    { 15, 18, 16, 1, 18, 68, 601 }, // Ѝ
+    { 13, 20, 12, -1, 19, 65, 669 }, // Ў
+    { 13, 16, 12, 1, 12, 52, 734 }, // Џ
+    { 14, 14, 17, 0, 14, 49, 48 }, // А
+    { 12, 14, 11, 1, 13, 42, 97 }, // Б
+    { 11, 14, 11, 1, 13, 39, 139 }, // В
+    { 12, 12, 11, 1, 12, 36, 178 }, // Г
+    { 14, 14, 14, 1, 12, 49, 214 }, // Д
+    { 12, 12, 11, 1, 12, 36, 263 }, // Е
+    { 21, 15, 21, 0, 15, 79, 299 }, // Ж
+    { 11, 14, 12, 1, 13, 39, 378 }, // З
+    { 15, 15, 16, 1, 15, 57, 417 }, // И
+    { 15, 19, 16, 1, 19, 72, 474 }, // Й
+    { 14, 15, 15, 0, 15, 53, 546 }, // К
+    { 13, 13, 12, 1, 12, 43, 599 }, // Л
+    { 15, 12, 14, 1, 12, 45, 642 }, // М
+    { 16, 15, 16, 0, 15, 60, 687 }, // Н
+    { 16, 16, 17, 1, 15, 64, 747 }, // О
+    { 13, 13, 11, 1, 13, 43, 811 }, // П
+    { 14, 15, 13, 0, 15, 53, 854 }, // Р
+    { 14, 17, 14, 1, 16, 60, 907 }, // С
+    { 14, 14, 16, 3, 14, 49, 967 }, // Т
+    { 13, 14, 12, -1, 13, 46, 1016 }, // У
+    { 14, 13, 15, 3, 13, 46, 1062 }, // Ф
+    { 17, 15, 17, 0, 15, 64, 1108 }, // Х
+    { 12, 16, 12, 1, 13, 48, 1172 }, // Ц
+    { 10, 12, 11, 3, 12, 30, 1220 }, // Ч
+    { 15, 13, 14, 1, 13, 49, 1250 }, // Ш
+    { 15, 16, 15, 1, 13, 60, 1299 }, // Щ
+    { 10, 13, 11, 1, 12, 33, 1359 }, // Ъ
+    { 18, 14, 18, 1, 13, 63, 1392 }, // Ы
+    { 10, 13, 11, 1, 12, 33, 1455 }, // Ь
+    { 14, 14, 15, 1, 13, 49, 1488 }, // Э
+    { 16, 14, 17, 2, 13, 56, 1537 }, // Ю
+    { 14, 14, 14, 0, 14, 49, 1593 }, // Я
+    { 11, 11, 13, 0, 11, 31, 1642 }, // а
+    { 11, 14, 12, 2, 14, 39, 1673 }, // б
+    { 10, 11, 10, 0, 11, 28, 1712 }, // в
+    { 10, 10, 10, 1, 10, 25, 1740 }, // г
+    { 12, 12, 13, 1, 10, 36, 1765 }, // д
+    { 11, 10, 13, 1, 10, 28, 1801 }, // е
+    { 18, 12, 18, 0, 12, 54, 1829 }, // ж
+    { 8, 9, 7, 0, 9, 18, 1883 }, // з
+    { 11, 10, 11, 1, 10, 28, 1901 }, // и
+    { 11, 13, 11, 1, 13, 36, 1929 }, // й
+    { 11, 10, 11, 0, 10, 28, 1965 }, // к
+    { 10, 10, 8, 0, 9, 25, 1993 }, // л
+    { 13, 11, 14, 0, 11, 36, 2018 }, // м
+    { 13, 11, 13, 0, 11, 36, 2054 }, // н
+    { 10, 12, 14, 2, 11, 30, 2090 }, // о
+    { 11, 10, 11, 1, 10, 28, 2120 }, // п
+    { 14, 15, 14, -1, 10, 53, 2148 }, // р
+    { 9, 12, 11, 1, 11, 27, 2201 }, // с
+    { 10, 9, 11, 3, 9, 23, 2228 }, // т
+    { 13, 15, 13, 0, 10, 49, 2251 }, // у
+    { 14, 14, 15, 2, 10, 49, 2300 }, // ф
+    { 12, 10, 12, 1, 10, 30, 2349 }, // х
+    { 11, 13, 12, 1, 10, 36, 2379 }, // ц
+    { 8, 9, 8, 1, 9, 18, 2415 }, // ч
+    { 14, 10, 14, 1, 10, 35, 2433 }, // ш
+    { 14, 13, 15, 1, 10, 46, 2468 }, // щ
+    { 10, 10, 13, 3, 9, 25, 2514 }, // ъ
+    { 14, 11, 14, 1, 10, 39, 2539 }, // ы
+    { 9, 11, 10, 1, 10, 25, 2578 }, // ь
+    { 10, 11, 11, 1, 10, 28, 2603 }, // э
+    { 13, 11, 13, 1, 10, 36, 2631 }, // ю
+    { 11, 10, 10, 1, 10, 28, 2667 }, // я
+    { 11, 16, 13, 1, 16, 44, 786 }, // ѐ
+    { 11, 13, 11, 2, 12, 36, 2695 }, // ё
+    { 12, 18, 13, 0, 15, 54, 830 }, // ђ
+    { 10, 14, 10, 1, 14, 35, 884 }, // ѓ
+    { 10, 10, 10, 0, 9, 25, 919 }, // є
+    { 11, 10, 12, 0, 10, 28, 944 }, // ѕ
+    { 7, 15, 6, 0, 15, 27, 972 }, // і
+    { 9, 14, 6, 0, 14, 32, 999 }, // ї
+    { 11, 20, 11, 1, 15, 55, 1031 }, // ј
+    { 13, 10, 13, 0, 9, 33, 1086 }, // љ
+    { 12, 10, 13, 1, 9, 30, 1119 }, // њ
+    { 12, 15, 13, 0, 15, 45, 1149 }, // ћ
+    { 11, 15, 11, 0, 15, 42, 1194 }, // ќ
+    { 11, 14, 11, 1, 14, 39, 1236 }, // ѝ
+    { 13, 22, 13, 0, 17, 72, 1275 }, // ў
+    { 10, 12, 9, 0, 9, 30, 1347 }, // џ
+    { 10, 13, 14, 4, 12, 33, 1377 }, // Ѣ
+    { 9, 13, 12, 3, 12, 30, 1410 }, // ѣ
+    { 17, 12, 17, 1, 12, 51, 1440 }, // Ѫ
+    { 11, 10, 12, 1, 9, 28, 1491 }, // ѫ
+    { 15, 16, 16, 1, 15, 60, 1519 }, // Ѳ
+    { 12, 12, 13, 1, 12, 36, 1579 }, // ѳ
+    { 19, 18, 17, 4, 18, 86, 1615 }, // Ѵ
+    { 11, 12, 14, 3, 12, 33, 1701 }, // ѵ
+    { 7, 5, 0, 4, 15, 9, 1734 }, // ҆
+    { 13, 14, 11, 1, 14, 46, 1743 }, // Ґ
+    { 11, 12, 10, 1, 12, 33, 1789 }, // ґ
+    { 12, 12, 11, 1, 12, 36, 1822 }, // Ғ
+    { 9, 8, 8, 0, 8, 18, 1858 }, // ғ
+    { 14, 14, 11, 1, 14, 49, 1876 }, // Ҕ
+    { 8, 9, 7, 0, 9, 18, 1925 }, // ҕ
+    { 20, 18, 21, -1, 15, 90, 1943 }, // Җ
+    { 14, 12, 15, -1, 10, 42, 2033 }, // җ
+    { 11, 15, 12, 1, 13, 42, 2075 }, // Ҙ
+    { 8, 13, 7, 0, 9, 26, 2117 }, // ҙ
+    { 14, 17, 15, -1, 15, 60, 2143 }, // Қ
+    { 10, 11, 10, -1, 10, 28, 2203 }, // қ
+    { 14, 13, 16, 2, 13, 46, 2231 }, // Ҝ
+    { 11, 9, 12, 1, 9, 25, 2277 }, // ҝ
+    { 14, 15, 15, 0, 15, 53, 2302 }, // Ҟ
+    { 10, 14, 13, 0, 14, 35, 2355 }, // ҟ
+    { 15, 15, 15, -1, 15, 57, 2390 }, // Ҡ
+    { 10, 11, 10, -1, 11, 28, 2447 }, // ҡ
+    { 16, 17, 16, -1, 15, 68, 2475 }, // Ң
+    { 11, 12, 11, -1, 11, 33, 2543 }, // ң
+    { 22, 15, 16, 0, 15, 83, 2576 }, // Ҥ
+    { 15, 10, 11, 0, 10, 38, 2659 }, // ҥ
+    { 18, 14, 20, 2, 14, 63, 2697 }, // Ҧ
+    { 16, 16, 18, 1, 11, 64, 2760 }, // ҧ
+    { 17, 15, 20, 2, 14, 64, 2824 }, // Ҩ
+    { 14, 12, 16, 1, 11, 42, 2888 }, // ҩ
+    { 14, 19, 14, 1, 16, 67, 2930 }, // Ҫ
+    { 9, 13, 11, 1, 11, 30, 2997 }, // ҫ
+    { 13, 16, 16, 2, 14, 52, 3027 }, // Ҭ
+    { 9, 12, 11, 1, 10, 27, 3079 }, // ҭ
+    { 12, 14, 15, 4, 14, 42, 3106 }, // Ү
+    { 10, 12, 11, 3, 9, 30, 3148 }, // ү
+    { 13, 14, 15, 3, 14, 46, 3178 }, // Ұ
+    { 13, 13, 11, 0, 9, 43, 3224 }, // ұ
+    { 17, 17, 17, -1, 15, 73, 3267 }, // Ҳ
+    { 12, 12, 11, -1, 10, 36, 3340 }, // ҳ
+    { 13, 15, 18, 4, 12, 49, 3376 }, // Ҵ
+    { 9, 11, 13, 3, 8, 25, 3425 }, // ҵ
+    { 11, 16, 14, 3, 12, 44, 3450 }, // Ҷ
+    { 8, 12, 10, 1, 9, 24, 3494 }, // ҷ
+    { 11, 12, 12, 3, 12, 33, 3518 }, // Ҹ
+    { 9, 9, 8, 1, 9, 21, 3551 }, // ҹ
+    { 10, 14, 13, 2, 14, 35, 3572 }, // Һ
+    { 12, 15, 13, 0, 15, 45, 3607 }, // һ
+    { 14, 13, 16, 1, 13, 46, 3652 }, // Ҽ
+    { 10, 9, 12, 0, 9, 23, 3698 }, // ҽ
+    { 14, 15, 18, 3, 13, 53, 3721 }, // Ҿ
+    { 10, 12, 13, 2, 10, 30, 3774 }, // ҿ
+    { 8, 15, 7, 0, 15, 30, 3804 }, // Ӏ
+    { 21, 21, 21, 0, 21, 111, 3834 }, // Ӂ
+    { 18, 18, 18, 0, 18, 81, 3945 }, // ӂ
+    { 12, 17, 13, 2, 13, 51, 4026 }, // Ӄ
+    { 9, 12, 9, 0, 9, 27, 4077 }, // ӄ
+    { 13, 16, 12, 1, 13, 52, 4104 }, // Ӆ
+    { 10, 11, 9, 0, 9, 28, 4156 }, // ӆ
+    { 16, 19, 16, 0, 15, 76, 4184 }, // Ӈ
+    { 11, 14, 11, 0, 11, 39, 4260 }, // ӈ
+    { 16, 20, 16, 0, 15, 80, 4299 }, // Ӊ
+    { 11, 15, 11, 0, 11, 42, 4379 }, // ӊ
+    { 11, 15, 11, 2, 12, 42, 4421 }, // Ӌ
+    { 7, 11, 8, 2, 9, 20, 4463 }, // ӌ
+    { 18, 20, 21, 0, 15, 90, 4483 }, // Ӎ
+    { 12, 14, 14, 0, 10, 42, 4573 }, // ӎ
+    { 6, 12, 5, 1, 12, 18, 4615 }, // ӏ
+    { 16, 21, 17, 0, 21, 84, 4633 }, // Ӑ
+    { 14, 16, 13, 0, 16, 56, 4717 }, // ӑ
+    { 16, 19, 17, 0, 19, 76, 4773 }, // Ӓ
+    { 15, 15, 13, 0, 15, 57, 4849 }, // ӓ
+    { 23, 16, 24, 0, 15, 92, 4906 }, // Ӕ
+    { 18, 11, 20, 0, 11, 50, 4998 }, // ӕ
+    { 12, 18, 11, 1, 18, 54, 5048 }, // Ӗ
+    { 12, 17, 13, 1, 17, 51, 5102 }, // ӗ
+    { 11, 11, 13, 1, 10, 31, 5153 }, // Ә
+    { 11, 12, 14, 5, 11, 33, 5184 }, // ә
+    { 13, 18, 13, 1, 17, 59, 5217 }, // Ӛ
+    { 12, 13, 14, 4, 11, 39, 5276 }, // ӛ
+    { 21, 20, 22, 0, 20, 105, 5315 }, // Ӝ
+    { 18, 17, 18, 0, 17, 77, 5420 }, // ӝ
+    { 12, 18, 12, 1, 17, 54, 5497 }, // Ӟ
+    { 12, 14, 7, 0, 14, 42, 5551 }, // ӟ
+    { 10, 13, 10, 2, 13, 33, 5593 }, // Ӡ
+    { 10, 13, 10, 1, 9, 33, 5626 }, // ӡ
+    { 15, 17, 16, 1, 17, 64, 5659 }, // Ӣ
+    { 12, 13, 11, 1, 13, 39, 5723 }, // ӣ
+    { 15, 18, 16, 1, 18, 68, 5762 }, // Ӥ
+    { 12, 14, 11, 1, 14, 42, 5830 }, // ӥ
+    { 16, 21, 17, 1, 20, 84, 5872 }, // Ӧ
+    { 11, 16, 14, 2, 15, 44, 5956 }, // ӧ
+    { 15, 13, 16, 1, 12, 49, 6000 }, // Ө
+    { 11, 10, 13, 1, 10, 28, 6049 }, // ө
+    { 15, 20, 16, 1, 19, 75, 6077 }, // Ӫ
+    { 12, 16, 13, 1, 16, 48, 6152 }, // ӫ
+    { 14, 19, 15, 1, 18, 67, 6200 }, // Ӭ
+    { 11, 15, 11, 1, 14, 42, 6267 }, // ӭ
+    { 13, 18, 12, -1, 17, 59, 6309 }, // Ӯ
+    { 13, 21, 13, 0, 16, 69, 6368 }, // ӯ
+    { 13, 19, 12, -1, 18, 62, 6437 }, // Ӱ
+    { 13, 21, 13, 0, 16, 69, 6499 }, // ӱ
+    { 15, 19, 12, -1, 18, 72, 6568 }, // Ӳ
+    { 15, 22, 13, 0, 17, 83, 6640 }, // ӳ
+    { 11, 17, 11, 3, 17, 47, 6723 }, // Ӵ
+    { 10, 14, 8, 1, 14, 35, 6770 }, // ӵ
+    { 12, 15, 11, 1, 12, 45, 6805 }, // Ӷ
+    { 9, 10, 8, 0, 8, 23, 6850 }, // ӷ
+    { 18, 19, 18, 1, 18, 86, 6873 }, // Ӹ
+    { 14, 16, 14, 1, 15, 56, 6959 }, // ӹ
+    { 17, 18, 17, 0, 15, 77, 7015 }, // Ӽ
+    { 12, 13, 11, 0, 11, 39, 7092 }, // ӽ
+    { 0, 0, 14, 0, 0, 0, 7131 }, //  
+    { 0, 0, 22, 0, 0, 0, 7131 }, //  
+    { 0, 0, 14, 0, 0, 0, 7131 }, //  
+    { 0, 0, 22, 0, 0, 0, 7131 }, //  
+    { 0, 0, 11, 0, 0, 0, 7131 }, //  
+    { 0, 0, 10, 0, 0, 0, 7131 }, //  
+    { 0, 0, 8, 0, 0, 0, 7131 }, //  
+    { 0, 0, 11, 0, 0, 0, 7131 }, //  
+    { 0, 0, 4, 0, 0, 0, 7131 }, //  
+    { 0, 0, 9, 0, 0, 0, 7131 }, //  
+    { 0, 0, 8, 0, 0, 0, 7131 }, //  
+    { 0, 0, 5, 0, 0, 0, 7131 }, // ​
+    { 0, 0, 0, 0, 0, 0, 7131 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 7131 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 7131 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 7131 }, // ‏
+    { 9, 2, 9, 2, 6, 5, 7131 }, // ‐
+    { 9, 2, 9, 2, 6, 5, 7136 }, // ‑
+    { 13, 2, 12, 2, 6, 7, 7141 }, // ‒
+    { 12, 3, 13, 2, 6, 9, 6508 }, // –
+    { 17, 3, 19, 2, 6, 13, 6517 }, // —
+    { 17, 3, 19, 2, 6, 13, 7148 }, // ―
+    { 11, 15, 9, 0, 12, 42, 7161 }, // ‖
+    { 14, 6, 13, 0, -1, 21, 7203 }, // ‗
+    { 6, 6, 6, 3, 15, 9, 6530 }, // ‘
+    { 6, 5, 6, 3, 14, 8, 6539 }, // ’
+    { 6, 6, 5, 0, 3, 9, 7224 }, // ‚
+    { 6, 6, 6, 3, 15, 9, 7233 }, // ‛
+    { 10, 6, 9, 3, 15, 15, 6547 }, // “
+    { 10, 6, 9, 3, 15, 15, 6562 }, // ”
+    { 6, 6, 5, 0, 3, 9, 7242 }, // „
+    { 10, 5, 9, 3, 15, 13, 7251 }, // ‟
+    { 9, 22, 10, 3, 17, 50, 7264 }, // †
+    { 11, 22, 10, 1, 17, 61, 7314 }, // ‡
+    { 11, 10, 8, 0, 12, 28, 7375 }, // •
+    { 5, 6, 7, 2, 8, 8, 7403 }, // ‣
+    { 4, 3, 4, 0, 3, 3, 7411 }, // ․
+    { 4, 3, 4, 0, 3, 3, 7414 }, // ‥
+    { 16, 3, 16, 0, 3, 12, 6577 }, // …
+    { 3, 2, 4, 1, 6, 2, 7417 }, // ‧
+    { 0, 0, 21, 0, 0, 0, 7419 }, //  
+    { 14, 15, 18, 4, 13, 53, 7419 }, // ‰
+    { 6, 5, 5, 3, 14, 8, 7472 }, // ′
+    { 10, 6, 9, 3, 15, 15, 7480 }, // ″
+    { 12, 6, 14, -2, 14, 18, 7495 }, // ‴
+    { 4, 6, 6, 4, 14, 6, 7513 }, // ‵
+    { 8, 6, 9, 3, 14, 12, 7519 }, // ‶
+    { 12, 6, 14, 4, 14, 18, 7531 }, // ‷
+    { 7, 3, 9, 4, 13, 6, 7549 }, // ‸
+    { 6, 8, 7, 2, 8, 12, 7555 }, // ‹
+    { 6, 8, 7, -1, 8, 12, 7567 }, // ›
+    { 22, 17, 22, 0, 15, 94, 7579 }, // ※
+    { 9, 17, 6, 0, 17, 39, 7673 }, // ‼
+    { 12, 21, 12, 3, 20, 63, 7712 }, // ‽
+    { 9, 2, 9, 4, 14, 5, 7775 }, // ‾
+    { 8, 4, 11, 3, 12, 8, 7780 }, // ‿
+    { 12, 12, 13, 3, 16, 36, 7788 }, // ⁂
+    { 14, 14, 18, 4, 13, 49, 7824 }, // ⁄
+    { 20, 19, 21, 4, 19, 95, 7873 }, // ⁇
+    { 14, 19, 17, 4, 19, 67, 7968 }, // ⁈
+    { 17, 20, 13, 0, 19, 85, 8035 }, // ⁉
+    { 17, 26, 12, -1, 18, 111, 8120 }, // ⁒
+    { 0, 0, 80, 0, 0, 0, 8231 }, //  
+    { 6, 7, 5, 2, 14, 11, 8231 }, // ⁰
+    { 5, 6, 5, 2, 14, 8, 8242 }, // ⁴
+    { 6, 7, 5, 2, 14, 11, 8250 }, // ⁵
+    { 6, 7, 5, 2, 14, 11, 8261 }, // ⁶
+    { 5, 7, 6, 3, 14, 9, 8272 }, // ⁷
+    { 6, 7, 6, 2, 14, 11, 8281 }, // ⁸
+    { 6, 7, 6, 2, 14, 11, 8292 }, // ⁹
+    { 11, 10, 12, 0, 10, 28, 8303 }, // ⁿ
+    { 9, 9, 8, 0, 9, 21, 8331 }, // ₀
+    { 5, 7, 5, -1, 4, 9, 8352 }, // ₁
+    { 6, 7, 5, -1, 4, 11, 8361 }, // ₂
+    { 6, 7, 5, -1, 4, 11, 8372 }, // ₃
+    { 6, 7, 6, -1, 4, 11, 8383 }, // ₄
+    { 6, 7, 5, -1, 4, 11, 8394 }, // ₅
+    { 6, 7, 6, -1, 4, 11, 8405 }, // ₆
+    { 6, 7, 5, 0, 4, 11, 8416 }, // ₇
+    { 6, 7, 6, -1, 4, 11, 8427 }, // ₈
+    { 6, 7, 6, -1, 4, 11, 8438 }, // ₉
+    { 9, 23, 7, 2, 17, 52, 8449 }, // ₍
+    { 10, 23, 7, -4, 17, 58, 8501 }, // ₎
+    { 16, 23, 14, 0, 19, 92, 8559 }, // ₡
+    { 14, 17, 14, 1, 16, 60, 8651 }, // ₢
+    { 14, 16, 12, 0, 16, 56, 8711 }, // ₤
+    { 17, 15, 16, 0, 15, 64, 8767 }, // ₦
+    { 15, 15, 13, 0, 15, 57, 8831 }, // ₧
+    { 19, 15, 19, 0, 15, 72, 8888 }, // ₨
+    { 14, 15, 13, -1, 15, 53, 8960 }, // ₩
+    { 17, 13, 18, 2, 13, 56, 9013 }, // ₪
+    { 13, 14, 11, 1, 14, 46, 9069 }, // ₫
+    { 13, 16, 14, 1, 14, 52, 9115 }, // €
+    { 14, 14, 16, 3, 14, 49, 9167 }, // ₮
+    { 17, 15, 11, 0, 15, 64, 9216 }, // ₱
+    { 14, 21, 17, 1, 18, 74, 9280 }, // ₲
+    { 19, 16, 15, 1, 15, 76, 9354 }, // ₴
+    { 9, 14, 11, 1, 13, 32, 9430 }, // ₵
+    { 16, 15, 16, 3, 15, 60, 9462 }, // ₸
+    { 10, 13, 10, 2, 13, 33, 9522 }, // ₹
+    { 10, 13, 11, 2, 12, 33, 9555 }, // ₺
+    { 12, 13, 10, 1, 13, 39, 9588 }, // ₼
+    { 16, 15, 13, -2, 15, 60, 9627 }, // ₽
+    { 11, 11, 13, -2, 8, 31, 9687 }, // ←
+    { 11, 10, 13, 2, 10, 28, 9718 }, // ↑
+    { 11, 11, 13, 4, 8, 31, 9746 }, // →
+    { 11, 10, 13, 5, 10, 28, 9777 }, // ↓
+    { 18, 9, 15, -1, 8, 41, 9805 }, // ↔
+    { 9, 17, 11, 2, 16, 39, 9846 }, // ↕
+    { 10, 7, 11, -2, 7, 18, 9885 }, // ↖
+    { 11, 7, 11, 2, 7, 20, 0 }, // ↗
+    { 8, 10, 11, 4, 9, 20, 20 }, // ↘
+    { 8, 10, 11, -1, 9, 20, 40 }, // ↙
+    { 13, 11, 14, 0, 10, 36, 60 }, // ⇐
+    { 13, 12, 15, 3, 12, 39, 96 }, // ⇑
+    { 13, 11, 14, 2, 10, 36, 135 }, // ⇒
+    { 13, 13, 15, 6, 12, 43, 171 }, // ⇓
+    { 17, 11, 16, 0, 10, 47, 214 }, // ⇔
+    { 11, 16, 13, 4, 10, 44, 261 }, // ⇕
+    { 13, 14, 11, 1, 14, 46, 305 }, // ∂
+    { 17, 17, 17, 0, 16, 73, 351 }, // ∅
+    { 13, 13, 14, 1, 13, 43, 424 }, // ∆
+    { 13, 12, 12, 2, 12, 39, 467 }, // ∏
+    { 13, 12, 12, 5, 12, 39, 506 }, // ∐
+    { 11, 13, 10, 1, 12, 36, 545 }, // ∑
+    { 8, 3, 10, 2, 6, 6, 581 }, // −
+    { 16, 14, 16, 2, 13, 56, 587 }, // √
+    { 15, 8, 15, 2, 10, 30, 643 }, // ∞
+    { 18, 19, 14, 0, 15, 86, 673 }, // ∫
+    { 7, 10, 5, 0, 10, 18, 759 }, // ∶
+    { 12, 9, 13, 3, 9, 27, 777 }, // ≈
+    { 14, 15, 18, 4, 13, 53, 804 }, // ≠
+    { 15, 13, 14, -1, 12, 49, 857 }, // ≤
+    { 14, 13, 14, 1, 12, 46, 906 }, // ≥
+    { 15, 14, 17, 1, 14, 53, 952 }, // ﬀ
+    { 11, 15, 15, 1, 15, 42, 1005 }, // ﬁ
+    { 14, 14, 17, 1, 14, 49, 1047 }, // ﬂ
+    { 17, 15, 21, 1, 15, 64, 1096 }, // ﬃ
+    { 20, 14, 23, 1, 14, 70, 1160 }, // ﬄ
+    { 19, 14, 20, 0, 14, 67, 1230 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_8_italicIntervals[] = {
@@ -1884,30 +1852,98 @@ static const EpdUnicodeInterval opendyslexic_8_italicIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_8_italicGroups[] = {
-    { 0, 2469, 3815, 95, 0 },
-    { 2469, 2358, 4607, 96, 95 },
-    { 4827, 3601, 7469, 126, 191 },
-    { 8428, 400, 478, 61, 317 },
-    { 8828, 5842, 9913, 213, 378 },
-    { 14670, 802, 1181, 63, 591 },
-    { 15472, 278, 328, 20, 654 },
-    { 15750, 802, 1128, 20, 674 },
-    { 16552, 405, 521, 16, 694 },
-    { 16957, 448, 647, 15, 710 },
+    { 0, 3465, 6589, 151, 0 },
+    { 3465, 1761, 2731, 66, 379 },
+    { 5226, 4804, 9912, 235, 96 },
+    { 10030, 5910, 9903, 249, 380 },
+    { 15940, 857, 1297, 30, 701 },
+};
+
+static const uint8_t opendyslexic_8_italicGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const EpdLigaturePair opendyslexic_8_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t opendyslexic_8_italicGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_8_italic = {
     opendyslexic_8_italicBitmaps,
     opendyslexic_8_italicGlyphs,
     opendyslexic_8_italicIntervals,
-    56,
+    58,
     30,
     22,
     -9,
     true,
     opendyslexic_8_italicGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    opendyslexic_8_italicLigatures,
+    5,
+    0x4000000001ull,
+    opendyslexic_8_italicGlyphLookup,
+    opendyslexic_8_italicGlyphGroups,
+    false,
+    nullptr,
 };
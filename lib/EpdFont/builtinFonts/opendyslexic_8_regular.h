@@ -3,959 +3,946 @@
  * name: opendyslexic_8_regular
  * size: 8
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_8_regular 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_8_regular 8 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_regularBitmaps[15152] = {
-    0x5D, 0x56, 0x4F, 0x6C, 0x1D, 0x47, 0x19, 0xFF, 0xCD, 0x4E, 0xED, 0x49, 0xB3, 0x8E, 0x37, 0x48,
-    0x89, 0x54, 0x88, 0xE3, 0xE5, 0x50, 0x24, 0x0B, 0xD9, 0xDE, 0x08, 0xF9, 0xF0, 0xA0, 0xFB, 0xDE,
-    0x6E, 0x1A, 0x55, 0x41, 0x54, 0x88, 0x20, 0x51, 0x8A, 0x54, 0xA4, 0xF4, 0xC4, 0x21, 0x42, 0xE4,
-    0x1D, 0x2C, 0xC5, 0x15, 0x6B, 0xBF, 0x4D, 0x0C, 0x44, 0x22, 0x51, 0x1B, 0x55, 0xED, 0xA5, 0x14,
-    0x25, 0x07, 0xC4, 0x9F, 0xA4, 0x10, 0x1F, 0x7C, 0xF0, 0xE1, 0xD9, 0x3B, 0xB1, 0x0F, 0x3E, 0x04,
-    0xD1, 0x49, 0xA2, 0x88, 0x43, 0x85, 0xD8, 0xE2, 0x40, 0x45, 0x42, 0x95, 0xA9, 0xB3, 0x90, 0x75,
-    0xB2, 0xEF, 0x0D, 0xDF, 0xAC, 0x93, 0x28, 0x30, 0x33, 0x9A, 0x7D, 0x6F, 0xFE, 0xFE, 0xBE, 0xEF,
-    0xFB, 0x7D, 0xDF, 0x37, 0x8C, 0xC9, 0x85, 0x71, 0x97, 0x4B, 0x1D, 0x7A, 0xB6, 0x1B, 0x60, 0x87,
-    0x74, 0x15, 0x61, 0xCF, 0x80, 0x77, 0x66, 0xED, 0xBA, 0xD6, 0x65, 0xB3, 0xB5, 0x73, 0x67, 0x8C,
-    0x11, 0x01, 0xB8, 0x8E, 0x04, 0xAD, 0x00, 0xF2, 0x06, 0x22, 0x63, 0xCC, 0x4B, 0x3F, 0x7A, 0xED,
-    0xDD, 0x58, 0x1C, 0x54, 0x70, 0xD4, 0x34, 0xB0, 0x38, 0x81, 0x81, 0xB9, 0xA3, 0xEF, 0x1E, 0xA6,
-    0x09, 0x6D, 0x57, 0x31, 0x1D, 0x02, 0x89, 0x07, 0x0C, 0xB0, 0x18, 0x40, 0x0C, 0xE7, 0x2C, 0xD0,
-    0x29, 0x69, 0xA7, 0xF4, 0x4A, 0x85, 0xCD, 0xB3, 0xF0, 0xC6, 0x24, 0xCC, 0x59, 0x70, 0x73, 0x0B,
-    0xC2, 0x68, 0x8C, 0x19, 0xE9, 0xBC, 0xD9, 0x1F, 0x18, 0x33, 0x1F, 0x1B, 0xD3, 0xA3, 0xF3, 0x4F,
-    0x19, 0x93, 0x82, 0x96, 0xB0, 0xAF, 0xD3, 0xF6, 0x67, 0x80, 0x03, 0x5E, 0x7A, 0xE1, 0xC0, 0xEB,
-    0xF2, 0xC0, 0x57, 0xE2, 0x03, 0x27, 0x10, 0xFC, 0x05, 0x03, 0x93, 0x39, 0x9A, 0x23, 0xF8, 0xD7,
-    0x10, 0xFB, 0xE3, 0x10, 0xFF, 0xC6, 0x0F, 0x5D, 0x47, 0x3F, 0x8B, 0xBA, 0x04, 0x39, 0xBC, 0x57,
-    0x53, 0x26, 0xC7, 0x31, 0xCA, 0x25, 0xFE, 0xAD, 0xC1, 0x2B, 0xBA, 0x39, 0x85, 0xF7, 0x07, 0x38,
-    0x7A, 0x26, 0x6C, 0xB1, 0x3B, 0xF3, 0x5A, 0xE8, 0xE0, 0xA6, 0x81, 0x31, 0x33, 0x8C, 0x2E, 0xA1,
-    0xB2, 0xA7, 0xD5, 0x0C, 0x43, 0xC8, 0x31, 0x8E, 0x85, 0x5D, 0xB4, 0x93, 0xA7, 0x53, 0x3C, 0x9E,
-    0x16, 0x31, 0xF5, 0x0D, 0x2E, 0xC7, 0x99, 0xF2, 0xB0, 0x20, 0xD2, 0x10, 0xF1, 0x14, 0x93, 0xBB,
-    0xB0, 0x40, 0xA3, 0x8E, 0x1C, 0x81, 0x1A, 0x46, 0x3E, 0x0C, 0x55, 0x6F, 0x90, 0x0D, 0x37, 0xD6,
-    0x74, 0xDF, 0x1E, 0x2B, 0xEA, 0xEB, 0xE2, 0x7B, 0x0B, 0x1D, 0x25, 0x72, 0xF7, 0xC4, 0xEA, 0xD0,
-    0x6E, 0x0E, 0x10, 0x18, 0xAA, 0x2A, 0x33, 0xF5, 0x57, 0x92, 0x4E, 0xC4, 0x35, 0xDD, 0x6D, 0xED,
-    0x8C, 0x8F, 0xFD, 0x2E, 0xEB, 0x3F, 0xD7, 0x6C, 0xD1, 0x0A, 0x8C, 0xC0, 0x49, 0x31, 0x05, 0xD2,
-    0xF3, 0x02, 0x86, 0x01, 0x85, 0x71, 0xF0, 0xA7, 0x06, 0x58, 0x3D, 0x20, 0x69, 0xC0, 0x05, 0xF4,
-    0x53, 0x03, 0x6D, 0x0B, 0x9F, 0x9D, 0xE3, 0x87, 0x79, 0xDA, 0x56, 0xBB, 0xDA, 0x6B, 0x1F, 0x4C,
-    0xDD, 0xD9, 0xF5, 0xB5, 0x2B, 0xC3, 0x33, 0xE2, 0xFC, 0xE1, 0x1B, 0x46, 0x77, 0x4A, 0x51, 0xD0,
-    0xBC, 0x9F, 0xBE, 0x90, 0xF2, 0x27, 0x55, 0x50, 0xDD, 0xF7, 0x4E, 0xD6, 0xCB, 0x7A, 0x2C, 0xF6,
-    0xFB, 0x83, 0x07, 0x73, 0x3A, 0xC9, 0xA5, 0xB3, 0x9C, 0xDC, 0xD1, 0xBC, 0x10, 0x05, 0xDF, 0xFA,
-    0xB6, 0xA9, 0x32, 0x13, 0x07, 0xC5, 0x0E, 0x11, 0xD3, 0x05, 0x43, 0x04, 0xE2, 0xB5, 0x38, 0x8B,
-    0x91, 0xD0, 0x32, 0xE7, 0xFA, 0x7B, 0x9F, 0x99, 0xE2, 0xF8, 0x2D, 0x7B, 0xED, 0x30, 0xDC, 0x54,
-    0xE4, 0xFC, 0x03, 0x7E, 0xD5, 0xB9, 0x7E, 0x25, 0x2F, 0x32, 0xF3, 0xD3, 0xA3, 0xE7, 0xB8, 0x42,
-    0x81, 0x26, 0x4D, 0x7A, 0xE6, 0x30, 0x98, 0xC5, 0xE7, 0x6F, 0x0D, 0x7C, 0x57, 0x21, 0x84, 0x07,
-    0xBE, 0x7E, 0x89, 0xF6, 0x76, 0x72, 0x60, 0x2F, 0x33, 0x57, 0x72, 0xE4, 0x34, 0x3B, 0x69, 0x5E,
-    0x56, 0x9B, 0xF9, 0xF0, 0x34, 0xFF, 0x25, 0x36, 0xAE, 0x15, 0x9D, 0x6A, 0xB0, 0xB4, 0x26, 0x34,
-    0x92, 0x69, 0xDA, 0x32, 0x0C, 0x11, 0x3B, 0x8A, 0xE4, 0x4D, 0x10, 0xC0, 0x4B, 0x79, 0xCE, 0x0A,
-    0x38, 0xB7, 0x98, 0xBA, 0xD0, 0xE0, 0x3C, 0x9E, 0x0A, 0x5D, 0xF6, 0x20, 0x77, 0x2B, 0xAE, 0x8A,
-    0x69, 0x7E, 0x35, 0x0E, 0x97, 0xC4, 0xDA, 0xC3, 0xC2, 0xDD, 0x82, 0x5B, 0xB8, 0x2F, 0x9F, 0xC6,
-    0xA6, 0xDC, 0xBF, 0x20, 0xDE, 0x67, 0x1B, 0x69, 0x99, 0xF5, 0xD9, 0x6F, 0x52, 0x5C, 0x3B, 0x58,
-    0x98, 0x2A, 0x2A, 0x31, 0xD1, 0x6A, 0x59, 0xE8, 0xF4, 0xF1, 0xC4, 0xAA, 0xB6, 0x3F, 0x8F, 0xCC,
-    0xFA, 0xEE, 0x5A, 0xFE, 0x2B, 0xE0, 0x79, 0x38, 0x05, 0x3A, 0xB1, 0xB0, 0x1D, 0x56, 0x62, 0x04,
-    0xBD, 0x9A, 0xB1, 0xAC, 0x5B, 0xF3, 0xAF, 0xD3, 0xDF, 0x5B, 0x33, 0xA5, 0xD3, 0xB7, 0x2B, 0x11,
-    0xC5, 0xB0, 0x50, 0x83, 0x14, 0x4E, 0x05, 0x56, 0xB1, 0xEC, 0x56, 0x67, 0x0B, 0x2B, 0x78, 0x54,
-    0xB2, 0xB4, 0x95, 0x39, 0x58, 0xB2, 0x06, 0x0A, 0x6D, 0x37, 0x43, 0xD2, 0x0B, 0x45, 0xC7, 0xB7,
-    0x40, 0x0A, 0x6A, 0x5A, 0x5B, 0x5B, 0xAB, 0x61, 0x02, 0x3C, 0x7F, 0xC2, 0x5A, 0x71, 0x73, 0x11,
-    0xD3, 0x38, 0xC0, 0x89, 0x40, 0xE3, 0x81, 0x94, 0xF9, 0x3C, 0x17, 0x2F, 0x0D, 0x0D, 0x8D, 0x3E,
-    0xDF, 0x6E, 0x27, 0xD1, 0x7A, 0x5C, 0x7C, 0xAE, 0xE0, 0x84, 0x57, 0x14, 0x83, 0xE4, 0x2E, 0x15,
-    0x1C, 0x43, 0x86, 0x7D, 0x05, 0x98, 0x24, 0x4D, 0x4B, 0x1A, 0x05, 0xFF, 0x13, 0xB0, 0x21, 0xB1,
-    0x38, 0x8D, 0xD0, 0x23, 0xE6, 0x2B, 0x37, 0x9E, 0xE1, 0xCA, 0x67, 0xC6, 0x28, 0x63, 0xAA, 0x04,
-    0x7E, 0x40, 0x57, 0x99, 0x92, 0xDF, 0x5C, 0xF6, 0xD0, 0x08, 0xA1, 0xB5, 0x98, 0x37, 0xA5, 0x77,
-    0xA9, 0x0C, 0xB1, 0xA4, 0x71, 0x4F, 0xF2, 0x0F, 0x11, 0xB4, 0x2E, 0x57, 0xC6, 0xDC, 0x30, 0x5B,
-    0x35, 0x1E, 0xB7, 0x87, 0x4E, 0x8F, 0x00, 0x0B, 0x09, 0x2F, 0x86, 0x5F, 0x5F, 0x34, 0x51, 0xF7,
-    0x11, 0x81, 0x95, 0xF0, 0xFB, 0xCB, 0x9E, 0xE9, 0x71, 0xD3, 0x43, 0xB6, 0xBD, 0x81, 0x3C, 0x3B,
-    0xF5, 0x4C, 0xC5, 0xA5, 0x4F, 0xDE, 0x4F, 0xC7, 0x7A, 0x64, 0x6F, 0xC2, 0xD3, 0xD5, 0x08, 0x42,
-    0xB8, 0x1F, 0x42, 0xDC, 0xBB, 0x7D, 0xB9, 0x24, 0x28, 0x91, 0xA9, 0x3C, 0x63, 0x85, 0x26, 0x29,
-    0x3A, 0xFD, 0xC3, 0x31, 0x16, 0xE1, 0xD6, 0x9D, 0x91, 0x59, 0xE5, 0x3E, 0xFA, 0x6B, 0xCC, 0x5B,
-    0x86, 0xC0, 0x48, 0x4B, 0xA3, 0xB5, 0x7F, 0x1E, 0xD1, 0xA4, 0xC0, 0x51, 0xDA, 0x70, 0xCD, 0xE8,
-    0x25, 0x82, 0xE0, 0xA6, 0x4E, 0x4E, 0xCA, 0x6D, 0x11, 0x25, 0xC8, 0x97, 0xDE, 0x21, 0xBA, 0x68,
-    0xF7, 0x16, 0x83, 0x35, 0x07, 0x40, 0x53, 0x34, 0x53, 0xEB, 0xB5, 0x85, 0xEC, 0x6F, 0x39, 0xEB,
-    0x90, 0xE4, 0x27, 0x7B, 0x14, 0x8B, 0xE8, 0x3C, 0xBA, 0xDC, 0xE2, 0xDD, 0x8D, 0x3D, 0x33, 0x08,
-    0x97, 0x1E, 0xB5, 0xE6, 0x76, 0xEB, 0xA2, 0x99, 0x99, 0x5E, 0xDD, 0xFA, 0x15, 0xE6, 0x2A, 0xB4,
-    0xEA, 0x7E, 0x0E, 0xDD, 0xE4, 0x49, 0xE9, 0x76, 0x97, 0xE9, 0x68, 0xE5, 0xC5, 0x4D, 0x50, 0x94,
-    0xF3, 0xC8, 0xB8, 0xF4, 0xF1, 0x91, 0x30, 0x2D, 0xE4, 0x24, 0x2B, 0xB3, 0xB5, 0xBE, 0x4B, 0x46,
-    0x75, 0xE5, 0x62, 0x93, 0xAF, 0xE6, 0x9E, 0x8F, 0xB0, 0xC4, 0x7D, 0xC9, 0x7B, 0xF0, 0x34, 0x3A,
-    0x92, 0x19, 0x29, 0xEE, 0xA6, 0x41, 0x94, 0x2E, 0x45, 0xA7, 0xF2, 0xEC, 0xAD, 0xD4, 0x50, 0x60,
-    0x24, 0x25, 0x49, 0x96, 0x6F, 0x8B, 0x97, 0x32, 0x2B, 0x55, 0x2D, 0x9E, 0xC2, 0xCA, 0x25, 0x8A,
-    0xA4, 0x84, 0x96, 0x4A, 0x05, 0xFF, 0x50, 0x81, 0x9E, 0xA7, 0x45, 0xD9, 0x91, 0xC1, 0xC7, 0x77,
-    0xD3, 0x87, 0xA7, 0x2F, 0x8B, 0xBB, 0xA3, 0xB3, 0xAD, 0x6E, 0xD2, 0xDB, 0xDC, 0xDC, 0x34, 0x57,
-    0xAF, 0xAE, 0xF5, 0xA3, 0xC0, 0xD5, 0x55, 0xD7, 0x5F, 0xBB, 0xAF, 0x9B, 0xDE, 0x5F, 0xA5, 0x65,
-    0x27, 0xF0, 0x79, 0x8C, 0x46, 0xD4, 0xD2, 0xC9, 0x48, 0x4E, 0x46, 0x6A, 0xB2, 0xA9, 0x9B, 0x61,
-    0xD1, 0x4C, 0x92, 0x66, 0xD2, 0x6C, 0x26, 0x7E, 0xB3, 0xEB, 0x75, 0xBB, 0xA2, 0xEA, 0xF2, 0xAA,
-    0xB2, 0xEC, 0x3D, 0xE7, 0x3C, 0x58, 0x71, 0x0A, 0xA1, 0x0B, 0xCC, 0x26, 0xF0, 0x7E, 0x0F, 0x46,
-    0xE0, 0x22, 0x32, 0x3D, 0xF1, 0xEA, 0x53, 0xB0, 0x3B, 0x0A, 0xA5, 0xB9, 0x54, 0x05, 0xC6, 0x38,
-    0xC6, 0x60, 0x5F, 0xBF, 0x36, 0x77, 0x29, 0x6E, 0x93, 0xE3, 0xAD, 0xC7, 0x13, 0xD3, 0xCE, 0xD5,
-    0x38, 0xC9, 0xCC, 0x19, 0xA3, 0x96, 0x08, 0x3B, 0x99, 0x81, 0x08, 0x59, 0x6D, 0x77, 0xE4, 0xE9,
-    0x31, 0x45, 0x78, 0x85, 0x59, 0x8A, 0x13, 0x92, 0xAB, 0xC9, 0x3A, 0x83, 0x50, 0xA2, 0xC1, 0x04,
-    0x51, 0x6A, 0x31, 0xA1, 0xDC, 0x41, 0x7F, 0x0F, 0xA9, 0x3D, 0xA1, 0x47, 0xB6, 0xF5, 0x0D, 0x05,
-    0x1D, 0x53, 0x62, 0x9F, 0xE5, 0x07, 0x39, 0x04, 0xA2, 0x7C, 0xFB, 0x26, 0xDC, 0xEE, 0x72, 0x4C,
-    0x0F, 0x21, 0x6F, 0x8B, 0x93, 0x7F, 0x5F, 0x16, 0x46, 0xF9, 0x26, 0xED, 0x7A, 0x2F, 0x6A, 0xDF,
-    0x95, 0x61, 0x80, 0xA2, 0x12, 0x1B, 0xDA, 0x97, 0x2C, 0xCB, 0x1D, 0x52, 0x18, 0xB1, 0x31, 0x01,
-    0xA9, 0x93, 0xFC, 0x0D, 0xA0, 0xDC, 0xE2, 0xD2, 0xED, 0x16, 0x71, 0x60, 0xBD, 0xE4, 0x4B, 0xA2,
-    0x47, 0x42, 0xF8, 0x56, 0x8E, 0x9A, 0xB5, 0x56, 0xC7, 0xA6, 0x4F, 0x66, 0xFC, 0xFF, 0x96, 0xFC,
-    0x6F, 0x9B, 0xDD, 0xB6, 0xC3, 0xEC, 0x76, 0x5B, 0x42, 0x52, 0xB7, 0x27, 0x0C, 0x0A, 0x13, 0x24,
-    0x73, 0x8C, 0xA8, 0x5D, 0x46, 0xA6, 0xB0, 0x17, 0x6E, 0xBB, 0x50, 0x6A, 0x27, 0xDC, 0x79, 0x8A,
-    0x88, 0x93, 0xF0, 0x99, 0xE6, 0xB9, 0x17, 0xCF, 0x62, 0xC9, 0x95, 0x42, 0x96, 0x68, 0xFA, 0x31,
-    0xBF, 0xA7, 0xC9, 0x8D, 0x08, 0x84, 0x82, 0x57, 0xD9, 0x98, 0x41, 0xDC, 0x87, 0xF3, 0x11, 0x71,
-    0x9A, 0xB6, 0x41, 0xAC, 0x11, 0xFB, 0x97, 0x9A, 0x4C, 0x7B, 0x2F, 0xE6, 0x51, 0xAC, 0x7D, 0x51,
-    0xF9, 0xD0, 0xE6, 0x7A, 0xEE, 0x1D, 0x3D, 0xDE, 0xC4, 0xC3, 0xCF, 0xEE, 0x4B, 0xB7, 0x4F, 0xBB,
-    0x3A, 0x32, 0x4B, 0x79, 0xC9, 0x0B, 0xB2, 0x78, 0x54, 0xDF, 0x69, 0x15, 0xEC, 0xA8, 0x49, 0x96,
-    0x73, 0xD2, 0x6C, 0x52, 0xC0, 0x2D, 0x2D, 0x70, 0xEB, 0xB4, 0x11, 0x79, 0xE2, 0x1C, 0xFC, 0x33,
-    0xCA, 0x93, 0x95, 0xAB, 0xFC, 0xD3, 0xB9, 0x53, 0x2C, 0xA2, 0x19, 0x22, 0x99, 0x44, 0xE1, 0x31,
-    0xED, 0xAE, 0x29, 0xFE, 0x91, 0x74, 0xC8, 0xEE, 0x06, 0x20, 0x96, 0x77, 0xEB, 0x56, 0xD9, 0xC6,
-    0xC8, 0x9A, 0xC6, 0x1C, 0x22, 0xFF, 0xD9, 0xFB, 0x2A, 0xA5, 0x53, 0xE2, 0x44, 0xF9, 0xB8, 0x55,
-    0x4F, 0x35, 0x73, 0xF1, 0xB7, 0xA4, 0x4D, 0x4A, 0xDD, 0xEA, 0x0B, 0x6F, 0xF7, 0x29, 0x25, 0x86,
-    0x8F, 0x5B, 0x83, 0xA7, 0x0D, 0x91, 0xCE, 0x08, 0x9B, 0x52, 0x17, 0xDD, 0x78, 0xC1, 0xAD, 0x32,
-    0x89, 0x1D, 0xB8, 0x20, 0x28, 0xD8, 0xA5, 0x75, 0x1E, 0x5D, 0x10, 0x71, 0xE8, 0xC8, 0xFD, 0x90,
-    0xCF, 0x1C, 0x7B, 0xB9, 0xA0, 0xA5, 0xB4, 0x81, 0xA7, 0x4F, 0xF6, 0xD3, 0xD4, 0xB8, 0x23, 0x27,
-    0x1C, 0xB5, 0x9F, 0xDD, 0xE8, 0x59, 0x4E, 0x0C, 0xE3, 0xD3, 0x1D, 0xCF, 0x1E, 0xBB, 0xF8, 0x6B,
-    0x7A, 0x6B, 0xD8, 0x90, 0x0C, 0x92, 0xD8, 0xF2, 0xA4, 0xED, 0x5D, 0x3E, 0x24, 0x17, 0xA7, 0xC4,
-    0x61, 0x34, 0xDA, 0xFC, 0x34, 0xBA, 0xAD, 0x6C, 0xD5, 0x54, 0xEE, 0x3F, 0x48, 0x8F, 0x14, 0xC5,
-    0x12, 0xDB, 0xD5, 0xC1, 0xB8, 0xD5, 0xE7, 0x5B, 0x49, 0x8B, 0xDD, 0x50, 0xC3, 0x21, 0x36, 0xD4,
-    0x68, 0xF0, 0x8B, 0x2B, 0xA6, 0xA4, 0x70, 0x67, 0x8B, 0x28, 0x83, 0xEF, 0x84, 0x14, 0x84, 0x6D,
-    0x9D, 0xA1, 0xF8, 0x11, 0x54, 0x83, 0xF5, 0x84, 0xC2, 0xAE, 0xC7, 0x5D, 0xF0, 0x4D, 0xAF, 0x7F,
-    0x5D, 0x76, 0xA7, 0xF8, 0x3A, 0xC2, 0x36, 0x5F, 0x4F, 0x93, 0x28, 0xBB, 0x62, 0xAA, 0xC1, 0x2D,
-    0x42, 0xE0, 0x94, 0x28, 0xDA, 0x63, 0xCE, 0xFC, 0x7B, 0x55, 0xE7, 0xF6, 0x69, 0xA0, 0x41, 0xAA,
-    0x7A, 0xCE, 0x33, 0x32, 0xA0, 0x64, 0xD9, 0xB1, 0x0F, 0x05, 0x61, 0x82, 0x23, 0xB9, 0x7D, 0x34,
-    0xB0, 0x9C, 0xE8, 0x20, 0x36, 0xD6, 0xCD, 0xBD, 0x93, 0x3D, 0xD9, 0x6A, 0xBB, 0xEF, 0x3B, 0x9F,
-    0xA0, 0x7C, 0xD0, 0xF7, 0xCD, 0x49, 0x3A, 0xA6, 0x38, 0xD2, 0x8D, 0xFA, 0xAE, 0xF5, 0x31, 0x7A,
-    0x13, 0x48, 0xCA, 0xCD, 0x75, 0xC7, 0x7F, 0x9E, 0x46, 0x86, 0xE7, 0x33, 0x21, 0x9F, 0x97, 0xE3,
-    0x0D, 0x67, 0x2D, 0x1D, 0x4F, 0xF8, 0xBA, 0x0C, 0x13, 0x2E, 0xC7, 0x12, 0x62, 0xCB, 0xEE, 0x29,
-    0x5B, 0x1A, 0x8D, 0x46, 0x82, 0x45, 0xAE, 0x76, 0x5A, 0xF7, 0x67, 0x52, 0xD0, 0x09, 0x6D, 0x26,
-    0x5D, 0xDA, 0xBE, 0xE0, 0xC8, 0x9D, 0x68, 0x38, 0xB9, 0x71, 0xCE, 0xD1, 0xD4, 0xE3, 0xB4, 0x44,
-    0x08, 0x7F, 0x16, 0x37, 0x34, 0xEF, 0x12, 0x7D, 0xC8, 0xAC, 0x3F, 0x56, 0xE2, 0x7C, 0x3C, 0xB3,
-    0x2C, 0x4E, 0x95, 0x7B, 0x86, 0x79, 0xAA, 0xA6, 0xF7, 0x8B, 0xFA, 0x6D, 0xE8, 0xC8, 0x2C, 0x50,
-    0x23, 0x2B, 0xAE, 0xCA, 0x56, 0x1E, 0xAE, 0xEA, 0x88, 0x7F, 0x2B, 0x5E, 0xDA, 0x19, 0x32, 0xD5,
-    0xD0, 0x2E, 0x25, 0x8E, 0x90, 0x32, 0x87, 0xF6, 0x08, 0x46, 0x33, 0x1F, 0xA5, 0x44, 0xBD, 0x9B,
-    0x9C, 0xBD, 0x45, 0xAF, 0xC9, 0x29, 0x8B, 0xB3, 0x11, 0x6E, 0x43, 0x5C, 0x97, 0xC9, 0x60, 0xC9,
-    0x1E, 0xE8, 0x06, 0x9F, 0x8F, 0xC7, 0xDB, 0x6C, 0x3D, 0x1E, 0x21, 0x01, 0x6E, 0x97, 0xBE, 0xC1,
-    0xF1, 0x74, 0xC7, 0x24, 0x5E, 0xB8, 0x13, 0x57, 0x2E, 0x57, 0x23, 0x1E, 0x0E, 0x84, 0x50, 0xA5,
-    0x20, 0xEB, 0x78, 0x46, 0xBD, 0xD1, 0x27, 0xA3, 0x7A, 0xB5, 0x33, 0xEA, 0x6D, 0x7F, 0x3A, 0x12,
-    0x7B, 0x3D, 0x35, 0xEE, 0xCA, 0x29, 0x21, 0xDB, 0x5C, 0xB6, 0xA9, 0x77, 0x65, 0xF3, 0xB8, 0xF4,
-    0x29, 0xAC, 0xFE, 0x27, 0x05, 0xFF, 0x49, 0x4D, 0xC2, 0x02, 0x0C, 0x13, 0x3A, 0x23, 0x3F, 0x89,
-    0xEB, 0xE0, 0x6C, 0x5D, 0x4E, 0xF4, 0xC4, 0x2B, 0x8E, 0xF5, 0x2E, 0x2F, 0xB7, 0x5E, 0xA6, 0xBF,
-    0x3A, 0x1B, 0x19, 0xD7, 0x46, 0x5F, 0xA7, 0x7E, 0x0D, 0x45, 0x95, 0x88, 0x6D, 0x75, 0x6D, 0x4D,
-    0xDD, 0xCA, 0xAD, 0xDA, 0xFC, 0xFB, 0xF8, 0x73, 0xFC, 0x86, 0x1A, 0x9D, 0x12, 0x6F, 0xB2, 0x0D,
-    0xB9, 0x64, 0xFA, 0x81, 0x39, 0x55, 0x5A, 0x18, 0x8A, 0xAD, 0xCA, 0x61, 0x91, 0x4E, 0x53, 0x08,
-    0x1B, 0xDD, 0x8F, 0x50, 0xDB, 0x87, 0x65, 0x0F, 0xBC, 0x46, 0x38, 0x0A, 0x66, 0x13, 0xB0, 0xFE,
-    0x62, 0x38, 0x11, 0x78, 0xE2, 0xFC, 0x27, 0x29, 0x79, 0x42, 0x70, 0x57, 0x8B, 0xCD, 0x0A, 0x05,
-    0xE5, 0x2A, 0x96, 0x8F, 0x7A, 0x04, 0x0D, 0x51, 0x4A, 0x8E, 0x45, 0x38, 0x5B, 0xDA, 0xD9, 0xCC,
-    0x7D, 0x7A, 0xBD, 0x90, 0x44, 0xEC, 0x86, 0x1C, 0xA7, 0xD7, 0xA3, 0x6E, 0x88, 0x33, 0x71, 0xA8,
-    0x99, 0xB1, 0x48, 0xE7, 0x6C, 0x04, 0xA3, 0xC4, 0x9D, 0x46, 0x9A, 0xDB, 0x47, 0x11, 0xF9, 0xA0,
-    0xBC, 0x58, 0xD9, 0x8C, 0x41, 0xD1, 0xD8, 0x26, 0x3F, 0xE9, 0xD0, 0x61, 0x46, 0x50, 0xC0, 0xA4,
-    0x37, 0x88, 0x48, 0x6B, 0xF8, 0x34, 0xBD, 0x4C, 0xC7, 0x0F, 0xD3, 0x77, 0xBB, 0xBA, 0x9A, 0x5D,
-    0x38, 0x71, 0xE2, 0xC4, 0x0F, 0x8E, 0x5D, 0xBC, 0x68, 0xDF, 0x25, 0x94, 0x65, 0x28, 0x0E, 0x53,
-    0x75, 0x6C, 0x78, 0xEE, 0xB2, 0xDC, 0x51, 0xB6, 0x72, 0x15, 0xC9, 0x2F, 0x63, 0x7A, 0xE2, 0xED,
-    0x55, 0x85, 0xFF, 0x02, 0x9D, 0x57, 0x4D, 0x6C, 0x1B, 0xC7, 0x15, 0xFE, 0x66, 0x47, 0xE6, 0xD8,
-    0x5C, 0x51, 0xAB, 0x83, 0x0B, 0x28, 0x29, 0x4D, 0x0A, 0x85, 0x0F, 0x4A, 0x4B, 0x89, 0x02, 0xCA,
-    0xA0, 0x2C, 0xBA, 0xD4, 0xAE, 0xED, 0xB4, 0x0A, 0xEA, 0x8B, 0x8B, 0xFA, 0x90, 0x43, 0x00, 0x1B,
-    0x69, 0x4F, 0x41, 0x01, 0xF3, 0x40, 0xC0, 0x4A, 0x4B, 0x9B, 0xD3, 0xD8, 0x80, 0x0F, 0x6E, 0x1B,
-    0x05, 0x68, 0x2F, 0x3D, 0x09, 0xFD, 0x01, 0x62, 0x07, 0x85, 0x14, 0x40, 0x07, 0x15, 0xA0, 0xCC,
-    0xB1, 0x75, 0x10, 0x02, 0x07, 0xCD, 0x5A, 0x46, 0x11, 0xA0, 0x05, 0xDA, 0x6D, 0x25, 0xF8, 0x20,
-    0x23, 0xED, 0xB6, 0xD9, 0xA2, 0xB4, 0xBD, 0xE2, 0xF4, 0xCD, 0x52, 0x72, 0x2C, 0xA3, 0x56, 0x53,
-    0xCD, 0x0C, 0x87, 0xB3, 0xE4, 0xCC, 0x7B, 0x6F, 0xDE, 0x7B, 0xDF, 0x7B, 0x6F, 0x3F, 0xE7, 0xAC,
-    0x44, 0x4B, 0xB0, 0x54, 0xE4, 0x3A, 0x9C, 0x26, 0xDB, 0x52, 0x0B, 0x25, 0x01, 0xD3, 0x02, 0xEA,
-    0xCA, 0xEE, 0x96, 0x37, 0x5C, 0xD5, 0x48, 0xFB, 0x8C, 0x9A, 0x52, 0xE5, 0x44, 0x6C, 0x31, 0x05,
-    0x69, 0x36, 0x9C, 0x82, 0xD7, 0xE5, 0x41, 0x23, 0x07, 0x54, 0x80, 0x39, 0xD0, 0xCF, 0xDC, 0xC7,
-    0xB9, 0x6B, 0x4C, 0x27, 0x68, 0xC0, 0x0A, 0x70, 0x11, 0x5C, 0xFF, 0xDA, 0xD1, 0x5B, 0x47, 0x33,
-    0x8E, 0xBE, 0x79, 0x27, 0x5C, 0x70, 0xC7, 0x0B, 0xB6, 0x5E, 0xFD, 0xDB, 0x92, 0x3F, 0x40, 0x87,
-    0x43, 0x7E, 0x33, 0x74, 0xAD, 0xF5, 0x80, 0xF7, 0x20, 0x22, 0x38, 0xB3, 0x42, 0x87, 0x88, 0xC1,
-    0x03, 0x38, 0xA7, 0xB6, 0x97, 0xCA, 0xF0, 0x38, 0x7F, 0xBE, 0x8E, 0xD7, 0xAF, 0x5F, 0x37, 0xCB,
-    0x62, 0xC8, 0x8F, 0xC9, 0xB3, 0x10, 0x3E, 0xBC, 0xC0, 0xB9, 0x7F, 0x53, 0xE5, 0xF2, 0x2C, 0xD0,
-    0x89, 0xA5, 0x7D, 0x24, 0xB0, 0x6F, 0xE9, 0xAE, 0xD7, 0xA3, 0x4D, 0x23, 0x59, 0x67, 0x7A, 0xE5,
-    0xAF, 0x51, 0x56, 0x5E, 0xBE, 0x2C, 0x5F, 0xB3, 0x4E, 0x9E, 0x7E, 0x5B, 0x7E, 0x97, 0x7E, 0x4D,
-    0x46, 0x6F, 0x0D, 0xBE, 0x78, 0xE7, 0x01, 0x8E, 0xB1, 0x3B, 0x37, 0xD7, 0xEE, 0xAC, 0xA9, 0xE6,
-    0x92, 0xB8, 0x2D, 0x1B, 0x0B, 0x03, 0x03, 0xD7, 0x4F, 0x77, 0x7A, 0x18, 0x82, 0x03, 0xE7, 0xF5,
-    0x6B, 0x9D, 0xDE, 0x01, 0xFF, 0x67, 0x97, 0x5F, 0x7A, 0x6D, 0xED, 0xE5, 0x9F, 0xFE, 0xC2, 0x9C,
-    0x62, 0x3A, 0x95, 0x80, 0x6D, 0xB1, 0x7B, 0x41, 0x58, 0xAA, 0xDA, 0x0E, 0xBF, 0xA9, 0x83, 0x62,
-    0x00, 0xC9, 0x14, 0x53, 0x1D, 0x6D, 0x66, 0xF8, 0x40, 0x8B, 0xD8, 0x8E, 0x40, 0x4D, 0x8E, 0x95,
-    0x8A, 0x0A, 0x87, 0x31, 0x3B, 0x30, 0x66, 0xBD, 0xF4, 0xCB, 0x68, 0xEC, 0xF6, 0xB0, 0x8B, 0xBB,
-    0x2A, 0x57, 0x63, 0xEB, 0x41, 0x81, 0xA6, 0xB0, 0xE0, 0x59, 0xEB, 0xBA, 0xF7, 0x35, 0xBD, 0x5E,
-    0x7E, 0x6B, 0x12, 0x8C, 0xC8, 0xB2, 0xF2, 0x37, 0x5B, 0xD9, 0x4E, 0xB6, 0x95, 0xF5, 0x6C, 0xC7,
-    0x2E, 0x8A, 0xA2, 0x98, 0x10, 0x53, 0xD4, 0x2F, 0x8A, 0x0B, 0xA2, 0x54, 0x7B, 0x01, 0xFE, 0x2B,
-    0x07, 0x17, 0xC7, 0x2C, 0xC8, 0xD1, 0x41, 0x22, 0x9B, 0x3D, 0xFE, 0xF2, 0xE4, 0xB7, 0x0F, 0xD1,
-    0xC2, 0x97, 0x25, 0xD7, 0x5A, 0x53, 0x47, 0x4A, 0xCE, 0x19, 0xE7, 0x8C, 0x38, 0x89, 0x63, 0xA9,
-    0xA5, 0x66, 0x88, 0xDC, 0x59, 0xFA, 0x48, 0xEE, 0x67, 0x48, 0x96, 0x31, 0x28, 0xCC, 0x65, 0x61,
-    0x6F, 0xD4, 0xE1, 0xAD, 0xFB, 0x12, 0x25, 0x9B, 0x8C, 0xD9, 0xC4, 0x10, 0x9F, 0x44, 0xBD, 0x12,
-    0x70, 0xA9, 0x83, 0x12, 0x72, 0x98, 0x45, 0xA5, 0x40, 0x67, 0x5F, 0xA1, 0xCF, 0x59, 0x04, 0x4C,
-    0x0A, 0x64, 0x31, 0x89, 0x31, 0x4B, 0x5A, 0x0F, 0x72, 0xCB, 0x4E, 0xF7, 0xF7, 0x39, 0x08, 0xA2,
-    0x54, 0x41, 0x68, 0x29, 0x1B, 0x79, 0x2C, 0x22, 0x74, 0xA4, 0x8D, 0x56, 0x58, 0x61, 0xD7, 0xFD,
-    0x16, 0xDD, 0xDB, 0xC2, 0x00, 0x0E, 0x22, 0x10, 0x61, 0x86, 0x2C, 0x3F, 0x09, 0x7E, 0x5C, 0x66,
-    0xDA, 0x79, 0x94, 0x83, 0x60, 0x14, 0xE4, 0x44, 0xA8, 0x14, 0xC1, 0xE5, 0x07, 0xC8, 0xE7, 0x88,
-    0x82, 0x17, 0xDB, 0xE4, 0x1A, 0x47, 0x89, 0x29, 0x7E, 0x05, 0xC7, 0x47, 0x64, 0x84, 0x1E, 0x36,
-    0xAB, 0x98, 0x26, 0x2B, 0xC6, 0x32, 0x0A, 0xC6, 0xDE, 0x55, 0x63, 0xDC, 0x19, 0x72, 0x82, 0xC3,
-    0xC5, 0x77, 0xE5, 0xB9, 0xC0, 0x28, 0x9F, 0x1C, 0x6D, 0x1C, 0xC6, 0x99, 0xB6, 0x9B, 0x2D, 0xC1,
-    0x23, 0xB2, 0x09, 0xF0, 0x89, 0x44, 0x35, 0xC2, 0xF8, 0x11, 0x90, 0xDF, 0x0A, 0x19, 0x5B, 0x41,
-    0x01, 0xB1, 0x50, 0x2D, 0x1D, 0x7B, 0x5A, 0x17, 0x21, 0x6E, 0x2B, 0x74, 0xC1, 0xE9, 0xA8, 0x34,
-    0x9E, 0x4C, 0xDC, 0x76, 0xB7, 0x09, 0xC0, 0x51, 0x10, 0xE4, 0x66, 0xBF, 0x03, 0xD6, 0x15, 0x16,
-    0x1B, 0x70, 0x1D, 0x14, 0x78, 0x60, 0xFB, 0x33, 0x3C, 0x28, 0x32, 0xAD, 0x03, 0xAD, 0x93, 0x26,
-    0x8A, 0x65, 0xF0, 0xD0, 0x1C, 0x20, 0x4C, 0x88, 0x05, 0x64, 0xC4, 0x0E, 0x01, 0x8B, 0x7E, 0x4D,
-    0xC8, 0xFA, 0x3E, 0xDC, 0x10, 0x43, 0x2E, 0xEC, 0x69, 0x9F, 0xF0, 0xC3, 0xC2, 0x1A, 0x16, 0x85,
-    0xAC, 0xB1, 0xA8, 0xA8, 0xB7, 0x1C, 0xAD, 0x57, 0x15, 0xFB, 0x67, 0x84, 0x29, 0xCC, 0x9D, 0xC2,
-    0x97, 0x47, 0x31, 0xD2, 0xDC, 0xD7, 0x35, 0xAC, 0x20, 0x42, 0xDC, 0xC4, 0x0B, 0xCF, 0xEF, 0x4F,
-    0x09, 0xCF, 0x01, 0x07, 0x65, 0x2A, 0x2F, 0xF6, 0x27, 0x7C, 0x9F, 0xA7, 0xD6, 0x12, 0x9E, 0x7E,
-    0x00, 0x4B, 0xD3, 0xD3, 0x50, 0x9B, 0xA6, 0xF7, 0xC8, 0x8E, 0xE2, 0x0A, 0x81, 0xC4, 0x75, 0xB4,
-    0x64, 0x21, 0xE1, 0xCF, 0x21, 0x83, 0xA2, 0x49, 0x0A, 0xE3, 0x9A, 0xC0, 0x53, 0xD4, 0xA4, 0xC5,
-    0x18, 0x5A, 0x5F, 0x55, 0xF4, 0xFC, 0x98, 0xB9, 0xBD, 0x85, 0xD6, 0x16, 0x19, 0x5D, 0x28, 0xE3,
-    0x01, 0xC5, 0xD4, 0x16, 0xE3, 0xE9, 0xEC, 0x01, 0x65, 0x3A, 0xD6, 0x5B, 0xA6, 0xA0, 0xC1, 0xF5,
-    0x16, 0x3A, 0xC4, 0x8D, 0x84, 0x9D, 0x03, 0x46, 0xC9, 0x99, 0x28, 0x6A, 0x34, 0xC0, 0xFA, 0xD7,
-    0x10, 0x3A, 0x69, 0xF5, 0xA6, 0x7D, 0xF2, 0x4A, 0x3B, 0x9D, 0xB4, 0xEA, 0x24, 0xF6, 0xF6, 0xA3,
-    0xD6, 0x6F, 0xE9, 0x44, 0xA7, 0xE0, 0xA5, 0x78, 0x54, 0x27, 0x78, 0x7F, 0xDA, 0x5A, 0x7A, 0x55,
-    0x6F, 0x34, 0xB0, 0xB3, 0x95, 0x0E, 0x69, 0xB5, 0x4D, 0xC3, 0xD1, 0x5D, 0xAD, 0x3F, 0xA4, 0xD8,
-    0x15, 0xA0, 0xEC, 0x1F, 0xCA, 0xA5, 0x2E, 0xF3, 0x59, 0xD8, 0x64, 0x33, 0x2C, 0x8A, 0xCB, 0x8E,
-    0xFC, 0xAC, 0x62, 0x8D, 0x5A, 0xE4, 0x63, 0xA9, 0x1E, 0x54, 0x53, 0xEC, 0x1A, 0x6D, 0x5B, 0x2D,
-    0x0F, 0x0C, 0x8E, 0x55, 0xFA, 0x98, 0x6E, 0x3E, 0x6E, 0xED, 0xF6, 0x32, 0x08, 0x81, 0x49, 0x3E,
-    0xDF, 0x37, 0x5E, 0x24, 0x54, 0x11, 0x4D, 0xF6, 0xE4, 0x57, 0xDB, 0x8A, 0xEC, 0x60, 0xDC, 0x71,
-    0xA6, 0x6F, 0xBD, 0x3D, 0xB7, 0x7D, 0xD5, 0x32, 0x29, 0x98, 0x45, 0x20, 0x17, 0x7E, 0x6A, 0xD1,
-    0xA6, 0xBF, 0xEC, 0x14, 0x50, 0x5C, 0x77, 0x8D, 0xA5, 0x08, 0x7A, 0x45, 0xC5, 0x15, 0x0F, 0x39,
-    0xFD, 0x4D, 0x30, 0x8C, 0xBF, 0xB4, 0x89, 0x25, 0x4F, 0xA3, 0x4D, 0x6B, 0xFA, 0xB0, 0x84, 0x6F,
-    0xCE, 0x77, 0x69, 0x5F, 0x64, 0xAC, 0x6A, 0xCE, 0x20, 0x9E, 0x65, 0x3F, 0x92, 0xCC, 0x98, 0x9E,
-    0xBC, 0xAB, 0xE0, 0xD1, 0x90, 0x13, 0x9E, 0x9A, 0xF0, 0xC2, 0x89, 0x5A, 0x54, 0x73, 0xE3, 0x5A,
-    0xB3, 0x59, 0x6B, 0xD6, 0x6A, 0xCD, 0x62, 0xAD, 0xED, 0xB4, 0xDB, 0x22, 0x69, 0xF3, 0x24, 0x61,
-    0x09, 0x45, 0x1C, 0x82, 0x39, 0x58, 0x2A, 0x20, 0xEB, 0xCC, 0x5A, 0x0F, 0x6F, 0x58, 0xB1, 0x88,
-    0x62, 0x5C, 0x68, 0xC2, 0xF9, 0x0D, 0x85, 0x5B, 0x0A, 0xEC, 0xE4, 0x12, 0x04, 0xC9, 0x8F, 0xC1,
-    0xEE, 0x07, 0xE8, 0xEA, 0x77, 0x93, 0xB2, 0xD6, 0x16, 0x09, 0xF8, 0xF9, 0x5E, 0x7A, 0x25, 0x82,
-    0x33, 0xC5, 0x5C, 0x84, 0xBB, 0xE1, 0x9C, 0xE9, 0xF9, 0xF6, 0x66, 0xD7, 0x0E, 0x8A, 0x2B, 0x01,
-    0xFB, 0x17, 0xF9, 0xEB, 0x22, 0x04, 0x21, 0x83, 0xFC, 0xCD, 0xA3, 0x64, 0x42, 0x0F, 0xF3, 0x3E,
-    0x5F, 0xEF, 0xCD, 0x47, 0x1D, 0x4D, 0xC6, 0x4E, 0x70, 0xAE, 0xBB, 0x73, 0x8E, 0x62, 0x8D, 0x58,
-    0x44, 0xC6, 0x4A, 0x8D, 0x71, 0x6E, 0x03, 0x37, 0xE6, 0xE5, 0x32, 0x4B, 0x6A, 0x28, 0x9E, 0x01,
-    0xBF, 0xEF, 0xA3, 0x45, 0xA7, 0x23, 0x70, 0x22, 0xF5, 0xC8, 0xC7, 0xF7, 0x63, 0x4C, 0x79, 0x9B,
-    0x9A, 0x40, 0x40, 0x91, 0x5F, 0x65, 0x74, 0x6A, 0x6D, 0x34, 0x08, 0xD5, 0xA7, 0x71, 0xD0, 0xDD,
-    0xEF, 0x85, 0x18, 0x01, 0x7B, 0xC9, 0xC5, 0x17, 0xB3, 0xFB, 0x25, 0x70, 0xF4, 0x70, 0x81, 0xCC,
-    0xEF, 0x84, 0x6E, 0x3F, 0xB0, 0xF8, 0x29, 0x4D, 0xB3, 0x4A, 0x23, 0xEC, 0xC2, 0x76, 0x6E, 0x20,
-    0x80, 0x9A, 0x69, 0xDC, 0x4C, 0x8E, 0xB9, 0xEB, 0xDF, 0x69, 0x63, 0xAF, 0x43, 0x9A, 0x4C, 0x38,
-    0x69, 0xA3, 0x69, 0x10, 0x3D, 0x81, 0x4F, 0x02, 0x03, 0xDF, 0x25, 0x72, 0x86, 0x26, 0x41, 0x31,
-    0xAA, 0x09, 0x09, 0xB7, 0x4C, 0x70, 0x73, 0x1C, 0xF2, 0x5F, 0xAE, 0xE5, 0x05, 0x42, 0xCF, 0x26,
-    0xED, 0xA4, 0xC0, 0xE0, 0x53, 0x10, 0x30, 0x2A, 0x78, 0x44, 0x2B, 0xA4, 0xFA, 0x4C, 0xF9, 0x4F,
-    0xF5, 0xDD, 0xCE, 0xA4, 0x6A, 0x23, 0x49, 0x0A, 0x09, 0xDB, 0x4C, 0xAC, 0x6F, 0x3D, 0x99, 0xCA,
-    0x35, 0xB2, 0xAD, 0xFE, 0x04, 0x17, 0xFA, 0x63, 0x09, 0xCD, 0x74, 0xB8, 0x8F, 0x47, 0x13, 0xCD,
-    0x8B, 0x2C, 0xF1, 0x28, 0xA5, 0xEB, 0xD8, 0xD6, 0xE9, 0x85, 0x72, 0x06, 0x01, 0x94, 0x20, 0x9E,
-    0x0A, 0xE4, 0xFF, 0x1F, 0x91, 0x61, 0xA3, 0x0E, 0xF6, 0x27, 0x58, 0xCC, 0xDF, 0xC7, 0x71, 0x71,
-    0x49, 0xD9, 0x2B, 0x41, 0xF6, 0xCD, 0xD9, 0xFD, 0xB0, 0x7E, 0xF2, 0x0A, 0xBB, 0xDB, 0x22, 0x6A,
-    0x2E, 0x48, 0xE5, 0xB1, 0xC3, 0x22, 0xA2, 0xCF, 0xFF, 0xA8, 0x4C, 0x49, 0x43, 0x8A, 0x26, 0xD0,
-    0xB7, 0xD3, 0x91, 0x98, 0x41, 0xF8, 0xA9, 0x62, 0xC8, 0xA7, 0x72, 0xE9, 0x2F, 0x51, 0xD5, 0x19,
-    0xC2, 0x5D, 0xD9, 0x08, 0xDB, 0x53, 0x5D, 0x27, 0x24, 0xB5, 0x86, 0x86, 0xAA, 0xD8, 0xB0, 0x54,
-    0x50, 0xE1, 0x9C, 0x2D, 0x4C, 0x4E, 0x8A, 0x6F, 0xA0, 0x51, 0x17, 0x27, 0x82, 0x06, 0x05, 0xF6,
-    0xD2, 0x22, 0xBF, 0x3D, 0xDF, 0xFD, 0x6D, 0x8F, 0xD2, 0x35, 0xF1, 0x4A, 0xD3, 0x00, 0xFF, 0x37,
-    0x1E, 0xC6, 0xAE, 0x7D, 0xC2, 0x6F, 0xD4, 0xF9, 0x15, 0x54, 0xEB, 0xF6, 0xCA, 0x7D, 0xF2, 0x2B,
-    0x75, 0xE3, 0x7B, 0x7D, 0x8C, 0xCD, 0x19, 0x51, 0xB7, 0x9B, 0x57, 0x77, 0xE6, 0x4F, 0xA8, 0xC5,
-    0x8A, 0x98, 0xA6, 0x7D, 0xB4, 0xB9, 0x3D, 0xD5, 0xB9, 0x45, 0x40, 0xBA, 0xA7, 0xD2, 0x0B, 0x51,
-    0x16, 0xBA, 0xA3, 0xF6, 0xDA, 0x65, 0x7F, 0x1D, 0x1F, 0xCC, 0xE6, 0xDD, 0xBD, 0x78, 0x3E, 0x97,
-    0xB5, 0xC2, 0x68, 0xAA, 0xB8, 0xD7, 0x16, 0x0A, 0x19, 0x5F, 0x80, 0x35, 0x6A, 0xA2, 0xC7, 0xDE,
-    0x12, 0x11, 0x89, 0x62, 0xE8, 0xCC, 0xC7, 0x63, 0xAE, 0xAD, 0x06, 0x2B, 0xE2, 0x0F, 0xBD, 0x3A,
-    0xEF, 0x5D, 0xAB, 0x93, 0x86, 0xEA, 0xB6, 0xC2, 0x54, 0xE7, 0xC1, 0x01, 0x42, 0xCF, 0x96, 0x7D,
-    0xEF, 0xCF, 0xE4, 0xB3, 0xA2, 0x5B, 0x3E, 0xED, 0x52, 0x42, 0x31, 0x7D, 0x86, 0x5C, 0xD7, 0x14,
-    0xB6, 0x14, 0xA1, 0x0E, 0xE3, 0x30, 0x0B, 0x9F, 0xCC, 0x34, 0x26, 0xE0, 0x76, 0x11, 0xD7, 0xC7,
-    0xAC, 0x4B, 0x3F, 0x4F, 0x5A, 0x9B, 0x57, 0x8C, 0x05, 0x79, 0x3C, 0xE2, 0x68, 0x55, 0xDE, 0xD8,
-    0xC9, 0x30, 0xCE, 0x6E, 0x8B, 0x96, 0xA5, 0x33, 0x6D, 0xC9, 0xB1, 0xAF, 0xCE, 0xAF, 0xF6, 0xDE,
-    0xA9, 0x1B, 0xB7, 0xF7, 0x8E, 0x49, 0x2A, 0x54, 0x7B, 0x3E, 0xD1, 0x2F, 0x23, 0x93, 0x87, 0x3F,
-    0xBC, 0x37, 0xDD, 0x27, 0x53, 0xCA, 0x5E, 0xFB, 0x8E, 0xB2, 0x50, 0x98, 0x4D, 0x15, 0xEE, 0xA7,
-    0x43, 0x56, 0xB9, 0x6C, 0x22, 0x97, 0x4F, 0x7D, 0xAC, 0x62, 0x5A, 0xB5, 0x5A, 0x6D, 0x1A, 0x43,
-    0x7D, 0x9C, 0x4B, 0x4D, 0x5A, 0x41, 0xC0, 0xFD, 0x9C, 0x29, 0xEA, 0xB8, 0x1C, 0x22, 0xD0, 0x52,
-    0xC6, 0xB8, 0xB2, 0x93, 0x31, 0x2A, 0xC6, 0x9E, 0x3E, 0x65, 0xBF, 0x0A, 0x65, 0xCC, 0xD4, 0xA9,
-    0xFA, 0x41, 0x85, 0x4A, 0x72, 0x94, 0x80, 0xF9, 0x77, 0x28, 0xFB, 0x63, 0x78, 0x12, 0xFA, 0x55,
-    0x44, 0x3F, 0x40, 0xC3, 0x96, 0x25, 0x16, 0xD8, 0xA8, 0xB3, 0x78, 0x06, 0x5E, 0x02, 0xEB, 0x01,
-    0xED, 0xBC, 0x85, 0xEF, 0x4C, 0x1E, 0x48, 0x8D, 0x34, 0xCC, 0x75, 0x30, 0x65, 0x73, 0x55, 0x71,
-    0xF9, 0x25, 0x55, 0x75, 0xF9, 0xAA, 0x72, 0x9B, 0x34, 0x35, 0x9F, 0xD2, 0x6C, 0xA6, 0xCB, 0x1E,
-    0x46, 0x55, 0x7E, 0xC9, 0x2F, 0xD5, 0xD9, 0xAA, 0x9F, 0xAF, 0x5A, 0x2B, 0x9B, 0xDD, 0xA2, 0xC6,
-    0x39, 0xF9, 0xDF, 0x72, 0xB7, 0x89, 0x5C, 0xB2, 0x38, 0x4F, 0xB7, 0xAC, 0x58, 0xAB, 0xC8, 0x37,
-    0xD8, 0x8A, 0x2C, 0x4D, 0xCD, 0xFF, 0x50, 0x47, 0x99, 0xAE, 0x29, 0xF1, 0xCA, 0xC8, 0x0E, 0xEE,
-    0x84, 0x87, 0x67, 0xD2, 0x15, 0xC7, 0xF1, 0xFE, 0xE8, 0xE0, 0xF8, 0xFF, 0xE4, 0xFF, 0x94, 0x05,
-    0x9E, 0x2D, 0x67, 0x64, 0xEA, 0xD6, 0x34, 0x7E, 0xE3, 0xC0, 0xB7, 0xFA, 0x45, 0xC7, 0x98, 0x09,
-    0x73, 0xC2, 0xA0, 0x9E, 0x4A, 0x6F, 0xA3, 0xC9, 0x49, 0x53, 0x3C, 0x1A, 0x50, 0x31, 0x95, 0x49,
-    0xD8, 0xA3, 0xA8, 0xFA, 0x95, 0x95, 0x93, 0xA5, 0xFA, 0x3F, 0x56, 0x87, 0xF2, 0x6F, 0xAC, 0xAD,
-    0xF4, 0x96, 0x88, 0x50, 0x8B, 0x2A, 0x6B, 0x3A, 0x34, 0x64, 0xA2, 0x77, 0xC9, 0x50, 0x6C, 0xE0,
-    0xD0, 0x36, 0x6B, 0x3A, 0xEF, 0xA6, 0x91, 0x3D, 0x8F, 0x8F, 0xF0, 0x62, 0x50, 0x68, 0x88, 0x1F,
-    0xB3, 0x75, 0x39, 0x13, 0x4D, 0x78, 0xFA, 0xAA, 0x0E, 0x6F, 0xB8, 0x74, 0xE3, 0x3C, 0x1D, 0x14,
-    0x9F, 0x2A, 0xA9, 0xCE, 0x5F, 0xC5, 0x47, 0xFE, 0x1B, 0x41, 0xA1, 0x22, 0x7E, 0xC2, 0xD6, 0xD5,
-    0x92, 0xEE, 0x95, 0xF5, 0x9B, 0xDD, 0x88, 0xA4, 0xE9, 0x62, 0x4D, 0x1A, 0xDF, 0x7B, 0x06, 0xA9,
-    0xED, 0x77, 0x27, 0x43, 0xE3, 0x59, 0xCC, 0x46, 0xFA, 0x66, 0xD9, 0xDD, 0xB8, 0x7F, 0xC4, 0xB5,
-    0xE8, 0x6D, 0xCE, 0xE1, 0x72, 0x66, 0x91, 0x7F, 0x88, 0x62, 0x04, 0x7A, 0xA9, 0x0B, 0x71, 0xC1,
-    0xD4, 0x1B, 0x54, 0x38, 0xC0, 0xEB, 0xEB, 0x71, 0x21, 0xED, 0x1D, 0xFF, 0xBD, 0x68, 0xA1, 0xBA,
-    0x90, 0xA7, 0x5E, 0x5D, 0x58, 0x38, 0x1F, 0x5C, 0x24, 0x7A, 0xFD, 0xEE, 0x08, 0x19, 0x2D, 0x3D,
-    0x9F, 0xDD, 0x51, 0x7A, 0x85, 0xDD, 0x55, 0xA5, 0x02, 0xD5, 0xA5, 0x55, 0x71, 0xD5, 0x77, 0x23,
-    0xA6, 0xE1, 0x84, 0xF4, 0x4E, 0x49, 0x9A, 0xA5, 0x52, 0x46, 0x7A, 0x11, 0x4F, 0x33, 0xCF, 0x7F,
-    0x00, 0xA5, 0x58, 0x51, 0x6C, 0x1C, 0x57, 0x15, 0x3D, 0xF3, 0x5E, 0xEC, 0x71, 0x76, 0x62, 0x4F,
-    0x3E, 0x1C, 0x28, 0xAD, 0xBD, 0xD3, 0x8F, 0x22, 0x19, 0xE1, 0x78, 0x22, 0xB4, 0x95, 0xB6, 0xED,
-    0xEE, 0xCE, 0x24, 0x11, 0xCA, 0x47, 0x05, 0xCD, 0x47, 0xFB, 0x81, 0x40, 0x10, 0x09, 0x3E, 0x8A,
-    0x84, 0xD4, 0x45, 0x32, 0x62, 0x2B, 0xD6, 0xD9, 0x97, 0x44, 0x25, 0x88, 0x88, 0xDA, 0x1F, 0x85,
-    0x4A, 0xA8, 0x15, 0xFE, 0x44, 0x09, 0x60, 0x4B, 0x58, 0xC2, 0x48, 0x1B, 0xEF, 0x4B, 0xFC, 0x11,
-    0x21, 0x10, 0x99, 0x36, 0x42, 0x95, 0x0A, 0x12, 0xD3, 0x26, 0x10, 0xC9, 0x55, 0xC5, 0xA4, 0x19,
-    0xE8, 0xC6, 0xCC, 0xFA, 0x71, 0xDF, 0xDB, 0x5D, 0xDB, 0x0D, 0x49, 0xEA, 0xA4, 0x6F, 0x9E, 0x77,
-    0x76, 0xE5, 0x79, 0xF7, 0xBE, 0x7B, 0xDF, 0xBD, 0xE7, 0x9E, 0x3B, 0x00, 0xD0, 0xCA, 0xB0, 0x0F,
-    0xFD, 0xE1, 0x08, 0xF0, 0x04, 0x56, 0x07, 0xB8, 0x29, 0x50, 0x4C, 0xB0, 0x7F, 0x1C, 0x2E, 0x97,
-    0xB6, 0x48, 0x59, 0x94, 0x47, 0x6A, 0xCB, 0x86, 0x4A, 0x03, 0xA5, 0x3C, 0xD8, 0x7F, 0x94, 0x68,
-    0x03, 0x4C, 0x25, 0xFB, 0x42, 0x5A, 0xC6, 0x3F, 0xC4, 0x7A, 0x5A, 0x72, 0x0E, 0x87, 0xD3, 0x55,
-    0x7E, 0x1A, 0xC5, 0xAA, 0xB3, 0xFA, 0x5E, 0xE6, 0x2B, 0xB9, 0xF2, 0x1D, 0x2D, 0x73, 0x6E, 0x02,
-    0xDE, 0xAF, 0x8C, 0xCC, 0xAD, 0xB1, 0x0C, 0x04, 0x80, 0x17, 0xC1, 0x2D, 0x82, 0xCF, 0x82, 0xBD,
-    0x11, 0x21, 0x29, 0xA1, 0xE6, 0x86, 0xFB, 0xAD, 0xD8, 0x0D, 0xEB, 0xB6, 0x52, 0x87, 0x95, 0xBA,
-    0x91, 0xA0, 0xDE, 0x84, 0x2B, 0x48, 0x8F, 0x38, 0xE6, 0xFE, 0x1A, 0x8D, 0xD0, 0xAC, 0xBD, 0xBB,
-    0xB2, 0x29, 0xC0, 0x95, 0xB0, 0x53, 0xF0, 0x3F, 0x03, 0x57, 0x25, 0x96, 0xA6, 0x51, 0x72, 0x91,
-    0xE7, 0x91, 0x13, 0xD6, 0x78, 0xE4, 0x59, 0x4A, 0x45, 0x4A, 0x65, 0x75, 0x78, 0x3E, 0x78, 0x0C,
-    0x48, 0x33, 0x0F, 0x00, 0xB6, 0xEC, 0xEE, 0x2A, 0xA8, 0xBA, 0x0B, 0x87, 0xE5, 0x52, 0xC1, 0x3E,
-    0x42, 0x62, 0x49, 0x76, 0xB3, 0xD2, 0xBA, 0xA8, 0x32, 0xE7, 0x9F, 0x12, 0xC7, 0xB0, 0x1B, 0xA8,
-    0xF7, 0x36, 0xCF, 0xC9, 0x4F, 0xC0, 0x30, 0x3E, 0x32, 0x9C, 0x0E, 0x1A, 0x1D, 0x96, 0x6A, 0x59,
-    0x6E, 0x08, 0x0F, 0x7A, 0x33, 0xFB, 0xCD, 0x27, 0x19, 0xEA, 0x4B, 0x78, 0x1B, 0xE7, 0x5D, 0xD5,
-    0xE1, 0xAA, 0x83, 0xD6, 0x2D, 0xFD, 0xFC, 0x01, 0xCC, 0x23, 0x82, 0xB1, 0xC8, 0x6E, 0xFB, 0xCF,
-    0x96, 0x30, 0x6D, 0xAE, 0x1A, 0x2A, 0xF0, 0xB3, 0x41, 0xED, 0xAC, 0x61, 0xB3, 0xF4, 0x0D, 0xF9,
-    0xE0, 0x3A, 0x42, 0x16, 0xE5, 0xA6, 0x47, 0x87, 0xEE, 0xAA, 0x81, 0x6C, 0x22, 0x21, 0xFE, 0x27,
-    0x32, 0x84, 0x45, 0x2C, 0x66, 0xF3, 0xF7, 0x30, 0x83, 0x46, 0x14, 0xE1, 0xA9, 0xF0, 0x13, 0x3A,
-    0x6C, 0x74, 0x57, 0xAE, 0xC0, 0x62, 0x88, 0x7B, 0x6A, 0xB2, 0x4E, 0x48, 0xE4, 0x25, 0xD8, 0x36,
-    0x9F, 0x71, 0xD5, 0x86, 0x52, 0xB2, 0x64, 0x65, 0x2E, 0xDC, 0x53, 0x12, 0x49, 0x82, 0x4A, 0x09,
-    0xCE, 0x65, 0xB0, 0x9B, 0x12, 0xCD, 0x04, 0x8D, 0xCA, 0x59, 0x35, 0xAB, 0xD4, 0x2A, 0x3D, 0xA3,
-    0x36, 0xCC, 0x66, 0x81, 0xC2, 0x51, 0x0C, 0x4F, 0x80, 0x7F, 0x19, 0xB8, 0x22, 0xCE, 0x17, 0xA0,
-    0xDE, 0xC7, 0xA2, 0x8F, 0x02, 0x97, 0x63, 0x48, 0x6C, 0x94, 0xAC, 0xD8, 0x43, 0xD0, 0x92, 0xB6,
-    0x4A, 0xF0, 0xC2, 0xEB, 0xDB, 0xD5, 0x70, 0xA5, 0xC0, 0xA5, 0x27, 0xB9, 0xE4, 0x31, 0x97, 0x56,
-    0xC2, 0x25, 0xD2, 0xCF, 0xAF, 0x61, 0x39, 0x50, 0x68, 0xD2, 0x77, 0xFA, 0xB3, 0x32, 0xBE, 0xB6,
-    0xD0, 0xA6, 0xE7, 0x12, 0xFA, 0x93, 0x7A, 0x4D, 0x57, 0x1F, 0xD8, 0xC2, 0x3C, 0x54, 0xA6, 0x7F,
-    0xEC, 0x48, 0x9F, 0xA5, 0xD2, 0x7D, 0xDD, 0x64, 0xB0, 0x55, 0xD6, 0xD8, 0x38, 0x12, 0x62, 0x09,
-    0x8E, 0xF9, 0x50, 0xB2, 0x95, 0x39, 0xBD, 0x9F, 0x8A, 0x0C, 0xCB, 0x48, 0x0F, 0x06, 0xE8, 0xF9,
-    0xFE, 0x46, 0x7D, 0xE1, 0x1E, 0x61, 0x62, 0xE2, 0x89, 0x85, 0x4B, 0x1B, 0xBF, 0xAC, 0x82, 0x0B,
-    0x04, 0x07, 0x85, 0xCA, 0xD8, 0x06, 0x89, 0xB3, 0xE4, 0x01, 0x77, 0x81, 0x1E, 0xE8, 0x3D, 0xB9,
-    0x13, 0xD1, 0xC3, 0x1C, 0x51, 0xD5, 0xCE, 0x74, 0x24, 0x7D, 0xAC, 0xFC, 0x79, 0xB8, 0xB0, 0x92,
-    0xFE, 0x73, 0x0D, 0x75, 0x49, 0x5D, 0x9B, 0x46, 0x5F, 0x20, 0x89, 0x56, 0xB2, 0xA7, 0xC9, 0x55,
-    0x6D, 0xA5, 0x2E, 0x93, 0x3B, 0x12, 0xBD, 0x62, 0xBE, 0xBF, 0x82, 0xB5, 0x91, 0x56, 0x27, 0xD8,
-    0xA9, 0x9F, 0x67, 0x8D, 0xB5, 0xD3, 0x00, 0x01, 0x47, 0xFA, 0x90, 0xAB, 0xA4, 0x7F, 0x6D, 0x67,
-    0x5B, 0x7D, 0x48, 0xE7, 0xAD, 0x77, 0x17, 0x41, 0xA3, 0x9E, 0x11, 0x74, 0x0C, 0x43, 0x84, 0x35,
-    0x7A, 0x95, 0x19, 0x73, 0xF3, 0x6C, 0x19, 0x23, 0xB8, 0x0F, 0x7F, 0xEC, 0x1E, 0xC4, 0x93, 0x02,
-    0xC9, 0xB6, 0x30, 0xBF, 0x87, 0xBF, 0xA1, 0x75, 0x63, 0x24, 0x06, 0x63, 0x5D, 0x9F, 0x7F, 0x25,
-    0x64, 0x14, 0x42, 0x2B, 0xE1, 0x5E, 0xC2, 0x3C, 0x96, 0x98, 0x5C, 0xD0, 0x38, 0x55, 0xD1, 0x37,
-    0x67, 0x63, 0x0A, 0x9F, 0xFE, 0x20, 0x41, 0xD1, 0x8B, 0x6C, 0x49, 0x28, 0xA6, 0x03, 0xC8, 0x51,
-    0x73, 0x98, 0x23, 0x58, 0xFA, 0xAE, 0xDC, 0xBB, 0x8B, 0x8E, 0xAF, 0x7D, 0x43, 0x65, 0x71, 0xA3,
-    0xEA, 0xBE, 0xC6, 0xAE, 0xE3, 0xF7, 0xB2, 0x52, 0x69, 0x9D, 0x56, 0xF1, 0xF1, 0x69, 0x94, 0x47,
-    0x7D, 0x57, 0x9D, 0x54, 0x46, 0xC5, 0x2E, 0xD8, 0x84, 0x79, 0x15, 0x82, 0xDF, 0x95, 0xCD, 0x1D,
-    0x0E, 0xBC, 0x02, 0x5F, 0x25, 0xCE, 0x35, 0x4B, 0x23, 0x3A, 0x81, 0x01, 0xEB, 0xAB, 0xD4, 0xB7,
-    0xD6, 0xBB, 0xB1, 0xD5, 0x20, 0xB8, 0x3C, 0xD1, 0x41, 0xDD, 0x25, 0x95, 0x01, 0x1D, 0x0B, 0xE5,
-    0xE3, 0x38, 0xE7, 0x07, 0x65, 0x4B, 0x0E, 0x76, 0xAD, 0x38, 0x5E, 0x6A, 0xA8, 0xA2, 0xF7, 0x37,
-    0xAE, 0xD5, 0x4E, 0x55, 0xDD, 0xD9, 0x85, 0x77, 0x54, 0xDB, 0x7B, 0x1D, 0xEE, 0x17, 0x9D, 0x55,
-    0x15, 0xB7, 0x62, 0xE3, 0x73, 0x52, 0x5F, 0xDA, 0x42, 0xDA, 0x07, 0x34, 0x96, 0x0A, 0x02, 0x1E,
-    0xEE, 0x66, 0xC0, 0xC7, 0x1B, 0xFB, 0x20, 0x76, 0xF5, 0xC7, 0x28, 0x6D, 0x35, 0x32, 0x88, 0x4F,
-    0x15, 0x11, 0x94, 0x3C, 0x19, 0xAD, 0x71, 0x43, 0x5B, 0x1A, 0xA8, 0xDB, 0x81, 0xBD, 0x30, 0xE6,
-    0xFE, 0x06, 0xEC, 0x90, 0xDE, 0xCA, 0x5E, 0x8C, 0xD6, 0x50, 0x5A, 0xEE, 0xCD, 0x72, 0x77, 0x36,
-    0x51, 0x6E, 0xA9, 0x8E, 0x99, 0x1B, 0x19, 0x8E, 0x93, 0x06, 0xF3, 0x79, 0x9C, 0x8A, 0x02, 0x01,
-    0x58, 0xAE, 0x8A, 0xC7, 0x86, 0x28, 0x25, 0xF5, 0xF7, 0xCD, 0xC9, 0x7F, 0x2C, 0x38, 0x61, 0x47,
-    0x5C, 0xE3, 0xB2, 0xC8, 0xE5, 0x24, 0x17, 0x7A, 0xDA, 0xB2, 0xD4, 0x9D, 0xBB, 0x31, 0x68, 0xC5,
-    0x48, 0xA6, 0xE0, 0xB2, 0xEE, 0xED, 0x69, 0x72, 0x5D, 0xE3, 0xEC, 0xC2, 0xC9, 0x04, 0xA9, 0xAF,
-    0xD4, 0x21, 0xA5, 0xF4, 0xED, 0x54, 0x62, 0xB5, 0x03, 0x82, 0x42, 0x73, 0xF3, 0x44, 0x57, 0x43,
-    0xD0, 0x31, 0xE2, 0x3F, 0x4E, 0xC3, 0x24, 0xFE, 0xF4, 0x33, 0x6F, 0x97, 0xB1, 0xEE, 0x59, 0x96,
-    0xD8, 0xD2, 0x43, 0xDD, 0xDA, 0x7E, 0x6B, 0xB2, 0xC4, 0x89, 0xC6, 0x77, 0xFD, 0xE1, 0x9B, 0xAE,
-    0x7E, 0x68, 0x80, 0x80, 0x2D, 0xE2, 0xE1, 0x30, 0xDD, 0x62, 0x2E, 0x46, 0x4C, 0xFD, 0x74, 0xD4,
-    0x85, 0xA3, 0x7D, 0x17, 0xFB, 0x14, 0x0E, 0x96, 0x3E, 0x52, 0xEF, 0xB6, 0x2F, 0x4D, 0xFA, 0x97,
-    0x43, 0xEE, 0x6F, 0x74, 0x9E, 0xD5, 0x47, 0x0D, 0x1E, 0x6E, 0x5E, 0x42, 0x5F, 0x14, 0x45, 0xE5,
-    0xCD, 0x51, 0xA9, 0x54, 0x82, 0x47, 0x8F, 0x95, 0x91, 0xB3, 0x2F, 0x24, 0xFA, 0xE1, 0xA8, 0x30,
-    0xCC, 0xC3, 0xA8, 0x38, 0xC2, 0x4F, 0x24, 0x73, 0x07, 0xE8, 0xF4, 0xBE, 0xB5, 0x9C, 0xE9, 0x13,
-    0x68, 0xD6, 0x37, 0x47, 0xB3, 0x79, 0x1E, 0x57, 0xBE, 0x54, 0xB8, 0xF2, 0xF2, 0x13, 0xB4, 0x80,
-    0x25, 0xFC, 0x92, 0x74, 0xC9, 0x82, 0xBA, 0x75, 0x23, 0xB1, 0x2F, 0x49, 0x6F, 0xEB, 0xEB, 0x94,
-    0x87, 0xE5, 0x26, 0x7B, 0x37, 0x71, 0xCE, 0x44, 0x65, 0x58, 0x29, 0x08, 0xB1, 0x37, 0xE0, 0x46,
-    0x98, 0xD0, 0x38, 0x42, 0xAB, 0x74, 0x9E, 0x3F, 0x6F, 0x92, 0x8A, 0x76, 0x88, 0xC5, 0x08, 0x93,
-    0x05, 0xB8, 0xC3, 0xE0, 0xA7, 0x42, 0xC4, 0x31, 0x8A, 0x45, 0x8C, 0x8C, 0x80, 0x1F, 0x91, 0x5D,
-    0x84, 0xD7, 0xB5, 0xAD, 0x45, 0xB3, 0xC7, 0x61, 0xE4, 0xF0, 0xFC, 0xA3, 0x13, 0x14, 0x58, 0xFA,
-    0x4A, 0xB6, 0x2E, 0xAB, 0x77, 0xB1, 0xD8, 0x8E, 0x5B, 0x52, 0x89, 0xDF, 0x03, 0x55, 0x8A, 0xBC,
-    0x03, 0xF3, 0x94, 0xE0, 0x7B, 0x31, 0x46, 0xD9, 0x4B, 0xE7, 0x55, 0xC5, 0x24, 0x11, 0x10, 0x3A,
-    0xAF, 0x45, 0xDA, 0xCA, 0x08, 0x45, 0x68, 0x20, 0x73, 0x21, 0xF6, 0x3B, 0x72, 0xA9, 0xCC, 0x2F,
-    0xC6, 0x64, 0x4B, 0xA9, 0x8D, 0x0F, 0x25, 0xEF, 0xC0, 0xA5, 0xF2, 0x26, 0x2D, 0x25, 0xED, 0x7F,
-    0x09, 0x3F, 0x10, 0xCB, 0xC1, 0xC9, 0xB8, 0x35, 0x2B, 0x54, 0x68, 0x72, 0xC0, 0x0B, 0xC9, 0xDF,
-    0x94, 0x77, 0x39, 0xC3, 0xDF, 0x24, 0x45, 0x2B, 0x7D, 0x10, 0x14, 0xFE, 0x30, 0x2C, 0x26, 0xBC,
-    0x89, 0x20, 0xE4, 0x29, 0x7E, 0x10, 0xD9, 0xBF, 0x08, 0x6B, 0xE7, 0xED, 0x93, 0xED, 0x6E, 0xCE,
-    0x85, 0x74, 0x32, 0x8E, 0x26, 0x7E, 0x54, 0xB0, 0xF7, 0x14, 0xC6, 0x16, 0xC7, 0xA5, 0x2F, 0x7C,
-    0xF8, 0xE1, 0x53, 0x51, 0x31, 0x2D, 0xCE, 0xEC, 0x41, 0x4E, 0xFB, 0x21, 0x34, 0x27, 0xAF, 0xEB,
-    0x1F, 0xD5, 0xE6, 0x3C, 0x6C, 0x41, 0x31, 0x59, 0xA3, 0xEC, 0x76, 0x04, 0x45, 0xE5, 0x12, 0xFC,
-    0xB3, 0x4A, 0x0F, 0xCB, 0x92, 0x51, 0x55, 0x8B, 0x8C, 0x8B, 0xC3, 0xF6, 0xC1, 0xA8, 0x3A, 0xE6,
-    0x30, 0xB9, 0x38, 0xE9, 0x7C, 0x40, 0x75, 0xDC, 0xD5, 0x8B, 0xE3, 0xAD, 0xC5, 0xCB, 0xDD, 0xC5,
-    0x11, 0x56, 0xCE, 0xE9, 0x95, 0x59, 0x2F, 0x7A, 0x28, 0x86, 0x05, 0x8F, 0x48, 0xCB, 0xE8, 0x08,
-    0x17, 0xD1, 0xF4, 0xB8, 0x6D, 0x69, 0x01, 0x4C, 0xB6, 0x7C, 0xF2, 0x77, 0xE0, 0x9E, 0x7A, 0x23,
-    0xD1, 0x67, 0xE3, 0xEA, 0x88, 0x22, 0x61, 0x4E, 0x9E, 0x9D, 0x16, 0xEF, 0xC4, 0x8F, 0xDD, 0x2E,
-    0x6C, 0xA2, 0x10, 0xAF, 0x9E, 0x1E, 0x1E, 0x9A, 0xB6, 0x22, 0x9B, 0xDC, 0xBB, 0xC8, 0xA4, 0x43,
-    0xCE, 0x6D, 0xB1, 0x0E, 0xF9, 0xC3, 0x35, 0xEA, 0x4B, 0x35, 0x37, 0xCF, 0x5E, 0xD5, 0x7B, 0x37,
-    0x4B, 0x43, 0xB6, 0xBE, 0xA0, 0x17, 0x26, 0xA3, 0x3A, 0xA6, 0x87, 0x31, 0xFD, 0xE2, 0x9B, 0xD7,
-    0x73, 0xAF, 0x6D, 0x5F, 0xD8, 0xE5, 0x55, 0x24, 0xCC, 0x9C, 0x3A, 0x9D, 0x11, 0x6E, 0x44, 0x86,
-    0x4E, 0x5B, 0xEF, 0xC1, 0xB0, 0x60, 0x8B, 0x2C, 0xA0, 0x68, 0x02, 0x6D, 0xCB, 0x60, 0x92, 0x4D,
-    0x7F, 0x2E, 0xFD, 0xE9, 0x7D, 0x57, 0xD6, 0x17, 0xF0, 0x5B, 0xF2, 0xCE, 0x55, 0xA5, 0xE8, 0x38,
-    0x4C, 0x21, 0x72, 0xBB, 0x50, 0x42, 0xC7, 0x6F, 0x1C, 0xAB, 0x4B, 0x46, 0xAC, 0xFD, 0x3C, 0x0E,
-    0x62, 0x3F, 0xD6, 0xDB, 0x3A, 0x51, 0x9A, 0x98, 0x5A, 0xB4, 0x4F, 0x4A, 0xCD, 0x4A, 0x89, 0x38,
-    0x51, 0x88, 0x51, 0xA5, 0xCB, 0x19, 0x02, 0xD9, 0xCD, 0x55, 0xEC, 0x9A, 0x42, 0x3E, 0xA0, 0x29,
-    0xA6, 0x02, 0x39, 0x15, 0xC4, 0x53, 0xE5, 0xA4, 0x5C, 0x4A, 0xCB, 0xF5, 0x7A, 0xB9, 0x5E, 0x2E,
-    0xD7, 0xBD, 0x72, 0xD3, 0x6D, 0x36, 0xED, 0xAC, 0xC9, 0xB3, 0x8C, 0xF6, 0xB6, 0x47, 0x63, 0x75,
-    0x81, 0x12, 0xA9, 0x3B, 0xF6, 0x72, 0x15, 0x55, 0x1C, 0x2E, 0x0B, 0x25, 0x7E, 0x4A, 0x16, 0x4B,
-    0x14, 0xF6, 0xA5, 0x3A, 0x7D, 0xE8, 0x5C, 0xFE, 0xCC, 0x76, 0xA1, 0xD1, 0x3D, 0x85, 0xD2, 0x68,
-    0x6A, 0x10, 0xD5, 0x50, 0x9A, 0x98, 0x9A, 0x7E, 0x0F, 0xB9, 0x86, 0x9D, 0x97, 0x75, 0x3C, 0x3E,
-    0x4F, 0xDB, 0x08, 0xF1, 0xA6, 0xD0, 0xB8, 0x3D, 0xD4, 0xDB, 0xD0, 0xCE, 0xB5, 0x0E, 0x30, 0x7C,
-    0x2E, 0xA2, 0x90, 0xDB, 0x81, 0x29, 0x76, 0x68, 0x13, 0xAA, 0x58, 0x9B, 0xF8, 0x7F, 0x74, 0x44,
-    0x1D, 0x8E, 0x92, 0x64, 0xBC, 0x66, 0x7F, 0xDD, 0xBA, 0x2E, 0x5E, 0x8C, 0xF3, 0xCB, 0xF6, 0x82,
-    0xE1, 0x2E, 0x3B, 0xD5, 0xCE, 0x32, 0xF0, 0x36, 0x82, 0x58, 0x57, 0x92, 0xBB, 0xEA, 0xB5, 0x25,
-    0xCF, 0xFA, 0x5D, 0xCD, 0x56, 0x1F, 0x66, 0xB5, 0xE6, 0xD8, 0xFA, 0x0A, 0x4B, 0xED, 0x24, 0xC5,
-    0x4C, 0x1D, 0xD4, 0xF8, 0x58, 0x94, 0xB3, 0x01, 0xD1, 0x64, 0x6A, 0x6C, 0xDE, 0xA7, 0x30, 0x8A,
-    0xD0, 0x56, 0xE7, 0xA8, 0xE5, 0x51, 0xBA, 0x80, 0x3E, 0x62, 0x48, 0xEB, 0xC3, 0xEA, 0xE0, 0x4F,
-    0x8F, 0xF6, 0x37, 0xFF, 0x82, 0xF0, 0x16, 0xB8, 0x28, 0x16, 0xD8, 0x25, 0x8C, 0x4D, 0x5B, 0xAB,
-    0x62, 0xB2, 0xB2, 0x70, 0x42, 0x25, 0x83, 0x6D, 0x13, 0x44, 0xC7, 0xC6, 0x8C, 0xC4, 0xCD, 0x6E,
-    0xEC, 0x91, 0x5B, 0xF0, 0xCF, 0xC5, 0x7E, 0xD8, 0xA0, 0xEA, 0xF6, 0x96, 0xC4, 0x7A, 0x04, 0x8F,
-    0xD4, 0xD0, 0x49, 0x91, 0xCE, 0x4A, 0x84, 0xFC, 0x79, 0xB8, 0xB3, 0xEB, 0xD4, 0x06, 0xA9, 0x84,
-    0x8A, 0xA9, 0xD5, 0x2F, 0x6E, 0xB7, 0x51, 0x45, 0x1A, 0x83, 0x6D, 0x6B, 0x3D, 0x29, 0x12, 0xF6,
-    0x4D, 0x56, 0xAD, 0x4B, 0xE1, 0x58, 0x91, 0xAD, 0xAE, 0xB5, 0x3D, 0x45, 0x7B, 0xC1, 0x51, 0x2B,
-    0xDC, 0x8F, 0x45, 0x27, 0x2C, 0x6D, 0x53, 0xE9, 0xAC, 0xB5, 0xB5, 0x81, 0x65, 0x78, 0x84, 0x8F,
-    0xED, 0x25, 0xD8, 0x97, 0x43, 0x94, 0x12, 0x70, 0x7D, 0xA3, 0x5F, 0x67, 0xC8, 0xC4, 0x60, 0x4D,
-    0xDB, 0x97, 0x38, 0x94, 0xF0, 0x5D, 0x1B, 0xCD, 0x48, 0x08, 0xD6, 0x6D, 0x11, 0x5A, 0xD8, 0xAE,
-    0x19, 0xF6, 0x7B, 0x92, 0x0C, 0x46, 0xE4, 0xA0, 0x6A, 0xC9, 0x71, 0x54, 0xA9, 0x66, 0x61, 0x7D,
-    0x05, 0xA4, 0xDF, 0x5A, 0xD1, 0x0E, 0x7D, 0x9B, 0x76, 0x4F, 0xF9, 0x7E, 0x31, 0xA5, 0xE6, 0x96,
-    0xEC, 0xD4, 0x19, 0xE3, 0x6A, 0x10, 0x08, 0x34, 0x92, 0xA9, 0xB4, 0x44, 0xDC, 0x2E, 0x4A, 0xE1,
-    0x49, 0x4A, 0xC7, 0xE3, 0x94, 0x50, 0x16, 0x21, 0xDC, 0x7A, 0x2B, 0x22, 0xFA, 0x60, 0xCC, 0xA6,
-    0xB6, 0xF1, 0x11, 0xFA, 0x30, 0xE7, 0x64, 0xAD, 0x70, 0x32, 0xF4, 0xC3, 0x13, 0x32, 0x76, 0xC5,
-    0x44, 0x81, 0xAD, 0xB5, 0xC6, 0xD0, 0x38, 0x7B, 0x24, 0x9C, 0xA4, 0xA4, 0xA4, 0x5A, 0x53, 0x39,
-    0xD7, 0x19, 0xB0, 0xD5, 0xDF, 0x95, 0x78, 0x41, 0xB4, 0xE6, 0xF4, 0xE3, 0x26, 0x27, 0x0B, 0xFD,
-    0x16, 0x41, 0x8C, 0x9C, 0x93, 0x07, 0xEC, 0x50, 0x8E, 0xD8, 0xA8, 0xE5, 0xBF, 0x1A, 0x35, 0x3A,
-    0x96, 0x6A, 0x3B, 0x32, 0xF5, 0xAD, 0xA4, 0xC9, 0x2F, 0x26, 0xEE, 0x33, 0xF2, 0x78, 0x60, 0x65,
-    0x2C, 0xDC, 0x83, 0x45, 0x6D, 0xDF, 0xEF, 0x2E, 0xAA, 0xA7, 0x45, 0x99, 0x2C, 0x96, 0x2E, 0xCA,
-    0x04, 0x18, 0x41, 0x1B, 0x6B, 0x4D, 0x8E, 0xE9, 0x3D, 0x88, 0xAB, 0xF6, 0x89, 0x7F, 0x9C, 0xA7,
-    0x3D, 0x7B, 0x4A, 0x34, 0xDD, 0x43, 0x89, 0xE7, 0xC8, 0x92, 0x8F, 0x34, 0xB3, 0xAF, 0x26, 0xDE,
-    0x26, 0xC1, 0x22, 0xA0, 0xA6, 0x46, 0x8A, 0xBA, 0x92, 0x48, 0x53, 0x26, 0xA7, 0xEE, 0x74, 0x1C,
-    0xE1, 0x86, 0xD4, 0x04, 0xE9, 0x2B, 0xF4, 0xC2, 0xFE, 0x73, 0x39, 0xFA, 0xEE, 0x11, 0xB4, 0x95,
-    0xF5, 0x8F, 0x42, 0x41, 0x77, 0x6A, 0xF7, 0xB7, 0xE1, 0x47, 0x87, 0xC6, 0xAB, 0x94, 0x3B, 0xE1,
-    0x1D, 0x95, 0xE4, 0x4C, 0x6D, 0xD4, 0x0D, 0xD9, 0xA6, 0x42, 0x3A, 0x4D, 0x6A, 0xD7, 0xDD, 0x39,
-    0x4D, 0x06, 0x35, 0x06, 0xCE, 0x10, 0xC6, 0x11, 0x1D, 0x6E, 0x75, 0xA0, 0xC3, 0x8B, 0x12, 0x07,
-    0x8D, 0x43, 0x47, 0x1B, 0x6F, 0x52, 0xFF, 0x6F, 0xBC, 0x6F, 0xFC, 0x48, 0xED, 0xF2, 0x18, 0x95,
-    0xBA, 0xDE, 0xB1, 0x37, 0xA2, 0xEF, 0x1D, 0x9D, 0xD0, 0xE0, 0xB8, 0x01, 0x87, 0x8E, 0x8A, 0xBF,
-    0x7A, 0x45, 0x25, 0xAD, 0x54, 0xD7, 0x65, 0x3F, 0xC4, 0xC4, 0x63, 0x9B, 0x79, 0xD0, 0x46, 0x4B,
-    0xA1, 0x62, 0x9A, 0x4B, 0x5B, 0x18, 0xCC, 0x0D, 0x6E, 0x81, 0x51, 0x2F, 0x34, 0x48, 0x04, 0xD1,
-    0xD1, 0xEF, 0x39, 0x76, 0x1F, 0x54, 0x44, 0x92, 0x2E, 0x11, 0x01, 0x6C, 0xF5, 0x18, 0x79, 0x48,
-    0x85, 0xE7, 0xFB, 0xE2, 0xD8, 0x63, 0xBA, 0xC9, 0x3A, 0xF8, 0x97, 0x70, 0x9E, 0xEA, 0x36, 0x25,
-    0xB2, 0x1F, 0xA3, 0x34, 0xF2, 0x8D, 0x67, 0xD4, 0x45, 0x15, 0xD1, 0x26, 0x19, 0xC5, 0xE4, 0x2D,
-    0xC3, 0x0E, 0xF3, 0x5D, 0x9E, 0xA8, 0xAE, 0x11, 0xB1, 0x89, 0x4C, 0x9C, 0xFA, 0xFA, 0x05, 0xC4,
-    0x67, 0xED, 0x0E, 0x85, 0x8D, 0xA7, 0x33, 0xF4, 0x96, 0x41, 0xEE, 0x4F, 0x69, 0x4C, 0xD1, 0x68,
-    0x6F, 0x77, 0xEC, 0xE7, 0x08, 0x5F, 0x97, 0x34, 0xE2, 0xB7, 0xA8, 0x53, 0x78, 0x62, 0x26, 0x50,
-    0x8E, 0x0A, 0x87, 0xB4, 0x97, 0x86, 0xBA, 0x67, 0x80, 0xF9, 0x79, 0x38, 0xB1, 0xA9, 0x1C, 0x5B,
-    0x31, 0xAE, 0x84, 0x43, 0xB4, 0xEC, 0x9A, 0x69, 0xA0, 0x6A, 0xD0, 0xD5, 0x9B, 0x93, 0x67, 0x7C,
-    0x0A, 0x4A, 0xB2, 0x52, 0x13, 0x0B, 0x2F, 0x7A, 0xC5, 0x4B, 0x5B, 0xC4, 0xF7, 0x14, 0x75, 0x52,
-    0xD7, 0x0C, 0xE8, 0x5B, 0xEC, 0x0C, 0x61, 0x29, 0xBB, 0x97, 0xCF, 0x4C, 0x2D, 0xDE, 0xD0, 0xF5,
-    0xE5, 0xB6, 0x59, 0xFF, 0xE8, 0x9C, 0xE9, 0xBE, 0xEF, 0x30, 0xAD, 0x3A, 0xD5, 0x07, 0xA2, 0x60,
-    0x22, 0xC8, 0x08, 0x34, 0xE9, 0x72, 0xF4, 0x25, 0x9C, 0xCC, 0xC9, 0xA8, 0x17, 0x19, 0xD2, 0x5C,
-    0x3B, 0x64, 0x27, 0x43, 0x9C, 0x87, 0x3E, 0x0F, 0x33, 0xEE, 0x43, 0x89, 0x0D, 0x87, 0x9D, 0xE1,
-    0x2F, 0xDD, 0x49, 0xFA, 0xFF, 0x4B, 0xC9, 0x6D, 0xCC, 0xB9, 0x2A, 0xBE, 0x83, 0x14, 0x18, 0x5E,
-    0x64, 0x0B, 0x57, 0x61, 0x9A, 0xB5, 0xE6, 0xA9, 0xDD, 0xD2, 0x65, 0x80, 0xAA, 0x77, 0xC6, 0x08,
-    0x11, 0x22, 0xC1, 0x1F, 0x17, 0xDC, 0xED, 0x17, 0x05, 0x8C, 0x66, 0x98, 0xA1, 0xD9, 0xC4, 0xCC,
-    0x32, 0xEA, 0x66, 0x6E, 0x32, 0xF5, 0x52, 0x1D, 0xF5, 0xE3, 0x56, 0x16, 0xA8, 0x76, 0xA0, 0x52,
-    0x7D, 0xC2, 0x14, 0xAA, 0xBB, 0x07, 0xBF, 0x60, 0x1D, 0x31, 0xC0, 0x37, 0x86, 0xB7, 0xF0, 0x78,
-    0x94, 0x9F, 0xB6, 0x7F, 0x62, 0x5D, 0x15, 0xB5, 0x64, 0x2A, 0x50, 0x67, 0x54, 0xBC, 0x52, 0x32,
-    0xAD, 0x62, 0x34, 0xD0, 0x8F, 0xF7, 0xAE, 0xF4, 0x6C, 0x67, 0xD2, 0xB1, 0x8F, 0x3A, 0x5A, 0x7D,
-    0xAF, 0xF2, 0xAF, 0xE1, 0xAD, 0xF0, 0xC5, 0x28, 0x5F, 0xB0, 0x5F, 0xB6, 0xAE, 0xCA, 0x65, 0xB5,
-    0xE1, 0xAB, 0x93, 0xED, 0x04, 0x61, 0x48, 0x3C, 0x87, 0xD1, 0xB1, 0x7F, 0x7B, 0xB3, 0x53, 0xB9,
-    0xBF, 0xFD, 0x17, 0x07, 0x73, 0x3C, 0x54, 0x62, 0xB0, 0xDB, 0xD2, 0xE2, 0x71, 0x39, 0x3C, 0x6D,
-    0xBF, 0x6E, 0x5D, 0x0D, 0x6B, 0x71, 0xBE, 0xE4, 0xCC, 0xAA, 0x77, 0x55, 0xDB, 0x9F, 0xD5, 0xAC,
-    0xF6, 0x25, 0x33, 0xEB, 0x5B, 0x21, 0x78, 0x5F, 0x76, 0xB0, 0x39, 0xFC, 0x48, 0x77, 0x74, 0xF7,
-    0xD2, 0x62, 0x89, 0x41, 0x16, 0x39, 0x87, 0xE6, 0x72, 0x5B, 0x3A, 0x5C, 0x69, 0x5F, 0x49, 0xAC,
-    0x94, 0x94, 0x4C, 0xC1, 0x73, 0x84, 0x7D, 0x91, 0xFA, 0x18, 0x92, 0x4F, 0xAD, 0x8C, 0x23, 0xF8,
-    0x05, 0xE2, 0xC5, 0xA4, 0xC6, 0x55, 0x1B, 0xD4, 0x0E, 0x86, 0x7E, 0x17, 0x8F, 0xB9, 0x18, 0xCF,
-    0x63, 0x79, 0xD4, 0xEA, 0x15, 0xBF, 0x31, 0x44, 0x34, 0xC7, 0xAD, 0x98, 0xE6, 0xB0, 0x15, 0x8F,
-    0x58, 0x31, 0xF5, 0x42, 0x14, 0x24, 0x8E, 0x8A, 0x59, 0x3B, 0xD9, 0xB1, 0x15, 0x89, 0xB6, 0x62,
-    0xD0, 0xC4, 0xBC, 0xE9, 0x58, 0xEF, 0x78, 0x1A, 0xB7, 0x12, 0x0A, 0xF8, 0x63, 0x14, 0x6A, 0xCC,
-    0x9C, 0x9C, 0x40, 0xF7, 0x55, 0x5A, 0x6E, 0x52, 0xA3, 0xC8, 0xDE, 0x2E, 0x06, 0xD3, 0x1E, 0xF7,
-    0x53, 0xB3, 0xAD, 0x9B, 0x05, 0xD4, 0x29, 0x32, 0x9C, 0x53, 0x91, 0x87, 0x74, 0x8A, 0xA7, 0xAE,
-    0x95, 0x34, 0x2E, 0x24, 0xAE, 0xDB, 0x99, 0xC2, 0xBF, 0xFF, 0x73, 0x33, 0x72, 0x5B, 0x5E, 0x1D,
-    0xAD, 0x98, 0xA8, 0x7A, 0x46, 0xD9, 0x19, 0x08, 0x4D, 0xBF, 0xA9, 0x56, 0x69, 0xD2, 0x43, 0x65,
-    0x25, 0x37, 0x81, 0x01, 0xAB, 0x17, 0x4F, 0x04, 0x64, 0xB5, 0x04, 0xFB, 0x4B, 0x43, 0xAE, 0xF3,
-    0xF4, 0xEA, 0x85, 0xEB, 0xB7, 0x62, 0xED, 0xF3, 0xFF, 0x12, 0xDB, 0x69, 0xA1, 0x4C, 0x9D, 0xF4,
-    0x5E, 0x0D, 0x0F, 0xC4, 0x0A, 0x59, 0xFF, 0xF9, 0x25, 0x94, 0x4B, 0xA8, 0x4F, 0x41, 0x6B, 0x74,
-    0x56, 0x23, 0xFE, 0x57, 0x13, 0x3D, 0x0A, 0x3A, 0x41, 0x9B, 0x7D, 0x56, 0x96, 0xA1, 0xCB, 0xD1,
-    0x5C, 0xFD, 0x6E, 0x64, 0xBE, 0xFF, 0xC6, 0x85, 0x87, 0xE3, 0x25, 0x76, 0x21, 0x2E, 0xB9, 0x5C,
-    0xD4, 0x96, 0xF8, 0x65, 0x78, 0x09, 0x81, 0x07, 0xB1, 0xD5, 0x19, 0xCD, 0xA9, 0xDB, 0x5C, 0xD1,
-    0x3E, 0xF5, 0x51, 0x1F, 0x12, 0xF6, 0x6A, 0x44, 0xA2, 0x37, 0x4F, 0xF1, 0x3E, 0x54, 0x0E, 0x9A,
-    0xF2, 0x40, 0x3D, 0x4D, 0x97, 0xDE, 0x76, 0xD1, 0x22, 0xA5, 0x66, 0xDC, 0x7A, 0xAE, 0x41, 0x68,
-    0x1D, 0x6A, 0x15, 0xBD, 0x29, 0xB7, 0xCD, 0xF5, 0xB3, 0xB3, 0x4A, 0xDD, 0x54, 0xAA, 0x43, 0xDE,
-    0xE7, 0x1A, 0x29, 0x7B, 0x3C, 0x97, 0x92, 0xE7, 0x6C, 0xA6, 0x1B, 0x08, 0xE2, 0x0F, 0xBA, 0x61,
-    0x97, 0xD4, 0xE0, 0x04, 0xCA, 0x56, 0x6D, 0xE2, 0xE6, 0x1A, 0xBA, 0xD8, 0xDC, 0xE6, 0xEB, 0x3A,
-    0xFD, 0x2A, 0x38, 0x19, 0x78, 0x8E, 0xF6, 0x40, 0x54, 0x68, 0xA3, 0x3F, 0xD5, 0xF6, 0xB9, 0x76,
-    0x36, 0xD0, 0xEF, 0xA1, 0x54, 0x6A, 0x5E, 0x44, 0xA1, 0xE7, 0x16, 0x95, 0xE5, 0x16, 0x74, 0xEB,
-    0x57, 0xD6, 0xFD, 0x47, 0x4C, 0x76, 0x10, 0x5D, 0x55, 0x49, 0x43, 0x09, 0x4D, 0x55, 0x0B, 0x91,
-    0xD6, 0x4D, 0x51, 0xF1, 0x20, 0xC6, 0x0C, 0x31, 0x3C, 0x29, 0xB7, 0x5E, 0x1E, 0xDD, 0xDD, 0x18,
-    0x74, 0xA8, 0x2B, 0x2F, 0xF0, 0xB0, 0x48, 0xA4, 0xC7, 0x16, 0x35, 0x33, 0xFF, 0x07, 0x4D, 0x91,
-    0xBF, 0x4B, 0xC3, 0x40, 0x14, 0xC7, 0xBF, 0x49, 0x68, 0xD3, 0x26, 0xC1, 0x74, 0x88, 0x90, 0xA5,
-    0xB5, 0x48, 0x87, 0x0A, 0x15, 0xD7, 0x82, 0xFD, 0x71, 0xE8, 0x90, 0x82, 0x4B, 0x11, 0x0A, 0xCE,
-    0x4E, 0xDA, 0x49, 0xB4, 0x83, 0x60, 0xA5, 0xD1, 0x5A, 0xD0, 0x2D, 0xF8, 0x17, 0x88, 0x74, 0xD1,
-    0x51, 0x1C, 0x04, 0x6B, 0x9B, 0xB6, 0x38, 0x68, 0x97, 0x74, 0x76, 0x09, 0x9D, 0x04, 0x11, 0x6E,
-    0xEC, 0x50, 0x1A, 0x2F, 0xAD, 0x82, 0x07, 0xEF, 0x71, 0xF7, 0xE1, 0xBD, 0xFB, 0x7E, 0xDF, 0x9D,
-    0x06, 0xCA, 0x3B, 0xC9, 0x41, 0x44, 0x20, 0x79, 0x61, 0x13, 0xA8, 0xAC, 0x5E, 0xF7, 0x1C, 0x00,
-    0xF9, 0xE9, 0x22, 0xCB, 0xF0, 0x3C, 0xFF, 0x00, 0xDE, 0x3C, 0xFA, 0x32, 0xC6, 0x80, 0x9E, 0xCD,
-    0xE9, 0x92, 0x6A, 0xF4, 0x47, 0x54, 0x17, 0x15, 0x24, 0x1B, 0x8D, 0x2A, 0x2C, 0x9E, 0x50, 0xF1,
-    0xCC, 0x15, 0x4D, 0xC0, 0xB1, 0x27, 0x70, 0x34, 0x58, 0x82, 0x19, 0x43, 0x8A, 0x73, 0x35, 0xB5,
-    0x4E, 0xAB, 0x2A, 0x59, 0x32, 0xBA, 0x74, 0xBC, 0x82, 0x9C, 0x7A, 0x4E, 0xAB, 0x12, 0xC1, 0x7A,
-    0x1F, 0xFC, 0x56, 0x13, 0xED, 0x66, 0xC9, 0x15, 0x4C, 0x09, 0xF5, 0x84, 0x1E, 0x87, 0xD6, 0x6E,
-    0x6B, 0x80, 0xB6, 0xC7, 0xA2, 0x36, 0xFD, 0xAF, 0xE2, 0x2B, 0x04, 0xC4, 0x21, 0x6D, 0xE5, 0x58,
-    0x27, 0xD9, 0x09, 0x3D, 0x6A, 0x71, 0x2B, 0x8B, 0x93, 0xE7, 0x62, 0xE7, 0x4D, 0x29, 0x9A, 0xF1,
-    0xC4, 0x3A, 0x39, 0xF6, 0xED, 0x45, 0xB9, 0x6F, 0x3D, 0xFC, 0xEB, 0x9C, 0xF3, 0x6C, 0xF8, 0xD9,
-    0xF9, 0x9B, 0xA5, 0x7C, 0xD7, 0x99, 0x6E, 0x5B, 0xC5, 0x2B, 0xA5, 0x63, 0xA3, 0x7C, 0x93, 0x5E,
-    0xF0, 0xF6, 0x0B, 0x85, 0x0B, 0xE6, 0x36, 0x48, 0xEC, 0xCB, 0x79, 0x85, 0xF5, 0xEA, 0x5F, 0xA2,
-    0x40, 0x82, 0x40, 0x18, 0xE7, 0xEB, 0x43, 0x3A, 0x6E, 0xCD, 0x14, 0xE6, 0x7E, 0x80, 0x1A, 0x7B,
-    0x8D, 0x83, 0xC3, 0xEE, 0x40, 0x4E, 0xA5, 0x8A, 0x91, 0xD2, 0x1A, 0xCD, 0xA8, 0x0C, 0x92, 0x10,
-    0x67, 0xEC, 0x7E, 0xA4, 0x4E, 0xC3, 0xB0, 0x43, 0x7E, 0x51, 0x1A, 0x10, 0x4D, 0xE9, 0x33, 0x32,
-    0x72, 0x9F, 0x62, 0x19, 0xAE, 0x63, 0xCB, 0x8C, 0x51, 0x20, 0x00, 0xC8, 0xE6, 0xF2, 0xBB, 0x98,
-    0x4E, 0xDF, 0x92, 0x16, 0x43, 0x93, 0x60, 0xA6, 0xF2, 0x40, 0x5E, 0xFC, 0x0E, 0x84, 0xF9, 0x1E,
-    0x41, 0xDC, 0x04, 0x93, 0xDD, 0x20, 0x48, 0x04, 0xEF, 0x9B, 0x60, 0xC1, 0xB3, 0x2D, 0x23, 0x04,
-    0xF3, 0x15, 0x95, 0x3D, 0xCF, 0x73, 0xD9, 0x4C, 0xB3, 0xAF, 0xC0, 0x0F, 0xAD, 0x5A, 0x7F, 0x6C,
-    0x1B, 0xE7, 0x79, 0x7E, 0xEF, 0x3E, 0xCB, 0x17, 0xEB, 0x24, 0x7E, 0xFE, 0xC3, 0xC1, 0xDC, 0x84,
-    0xE2, 0xE5, 0x0F, 0x0F, 0x60, 0x3C, 0x52, 0x14, 0x30, 0xAE, 0x61, 0xD2, 0x93, 0xEE, 0x1C, 0x61,
-    0x35, 0x30, 0x77, 0x8D, 0x31, 0xD8, 0x1B, 0xB0, 0xAD, 0x8D, 0x31, 0xE4, 0xCF, 0xB4, 0xA1, 0x57,
-    0xB6, 0x51, 0x1A, 0x8A, 0x3C, 0xDB, 0x7F, 0x08, 0x98, 0x81, 0x5A, 0x6D, 0xD1, 0x0E, 0xFB, 0x81,
-    0x4D, 0xE8, 0x02, 0x2C, 0x53, 0xD2, 0x88, 0x49, 0xD9, 0x55, 0x4D, 0x68, 0xF3, 0xB3, 0x39, 0xC0,
-    0x5B, 0x35, 0xD4, 0xE7, 0x64, 0x85, 0x81, 0x1A, 0x88, 0x2F, 0xB1, 0x9B, 0x00, 0x56, 0xDB, 0x9C,
-    0xED, 0xEB, 0x4C, 0xCB, 0x47, 0x7E, 0x7B, 0xBE, 0xA3, 0xE5, 0x28, 0x89, 0x93, 0x25, 0xC3, 0x78,
-    0xDF, 0x77, 0x3C, 0x52, 0x77, 0xDF, 0xAF, 0xF7, 0x79, 0x9F, 0xF7, 0x79, 0x3F, 0x6A, 0x13, 0xE9,
-    0x3E, 0x8D, 0x93, 0x7A, 0x15, 0xE4, 0xCA, 0xFE, 0x3F, 0x12, 0xD4, 0xA0, 0x1C, 0x99, 0xF2, 0xEA,
-    0xCF, 0xF6, 0x25, 0x17, 0x8B, 0xDF, 0x93, 0x71, 0x5B, 0xD2, 0xF6, 0xBB, 0x4C, 0x96, 0xDC, 0xD4,
-    0x96, 0xF9, 0xFD, 0x7B, 0x48, 0x57, 0xB7, 0xDD, 0xBE, 0x7F, 0x7C, 0xF1, 0xA8, 0xBC, 0x2A, 0x63,
-    0xA2, 0x6D, 0x96, 0x94, 0x64, 0x10, 0x69, 0x82, 0xA8, 0x49, 0x94, 0x27, 0x34, 0xE4, 0xE9, 0x37,
-    0xAA, 0xB4, 0xCC, 0xBC, 0x1C, 0x35, 0x4C, 0x4A, 0xEB, 0xC2, 0xA4, 0x86, 0xE5, 0xE5, 0x4D, 0x8F,
-    0xB6, 0x52, 0x9A, 0x52, 0xEA, 0xEE, 0xF5, 0x57, 0x5D, 0x7E, 0x71, 0xFF, 0x6E, 0x17, 0xC3, 0x69,
-    0x62, 0x40, 0xA6, 0xA7, 0x07, 0xB4, 0xAC, 0x2E, 0x84, 0x1E, 0x92, 0xD6, 0x76, 0xCD, 0xEF, 0x06,
-    0x79, 0xAA, 0x94, 0x28, 0x57, 0x21, 0x7A, 0x79, 0x11, 0xE3, 0x40, 0xC7, 0xB8, 0x81, 0x6A, 0xBB,
-    0x8E, 0x3B, 0x32, 0x2E, 0xC8, 0x48, 0x97, 0xF3, 0x68, 0x44, 0x6B, 0x07, 0x3A, 0x86, 0x72, 0x83,
-    0xA8, 0x4A, 0x94, 0x21, 0x32, 0x7C, 0x22, 0x79, 0x09, 0xE3, 0xF0, 0xE9, 0xDE, 0x3E, 0xE6, 0x28,
-    0xC8, 0x88, 0x7E, 0xDB, 0xE8, 0x15, 0xA4, 0xC4, 0x58, 0x75, 0x79, 0x23, 0xE9, 0xB9, 0x55, 0xBD,
-    0xFD, 0x6A, 0xB5, 0x8E, 0xDB, 0x19, 0x7B, 0xFC, 0xFE, 0x9D, 0x83, 0x31, 0xE9, 0xA1, 0x76, 0x87,
-    0x43, 0x57, 0x47, 0x44, 0xC4, 0x7C, 0xEE, 0x4E, 0x52, 0xC8, 0x04, 0x27, 0x5B, 0xBD, 0x59, 0x54,
-    0xD5, 0x42, 0x43, 0x8C, 0x6B, 0xDD, 0x76, 0xA7, 0x6F, 0xCE, 0xD3, 0xD0, 0x7E, 0x8F, 0xB8, 0x0C,
-    0x68, 0x94, 0x7C, 0xD4, 0x80, 0x46, 0x6E, 0x57, 0x19, 0xE2, 0x3D, 0x87, 0x9A, 0x4A, 0x0F, 0xEA,
-    0x97, 0x73, 0x24, 0xE3, 0x2E, 0xC9, 0x60, 0xEF, 0xA0, 0x63, 0xE6, 0x0E, 0xE3, 0x91, 0x2C, 0x15,
-    0x31, 0x4D, 0x5F, 0x17, 0xEC, 0x3B, 0x8F, 0xA2, 0x25, 0xD9, 0xC3, 0xC7, 0x31, 0x7C, 0x2C, 0xB8,
-    0x26, 0x1D, 0xA7, 0xDC, 0xBD, 0x11, 0xC9, 0x9E, 0xCF, 0xA4, 0x2F, 0xA5, 0xC4, 0x5F, 0x03, 0x8C,
-    0x82, 0x18, 0xD6, 0x5E, 0xBD, 0x5D, 0xF0, 0xC9, 0x91, 0x2E, 0x0B, 0x4A, 0x54, 0xD5, 0x85, 0x21,
-    0x72, 0xB7, 0xDF, 0x98, 0x30, 0x7C, 0x5B, 0x75, 0xE1, 0xAB, 0xC5, 0x2F, 0xDD, 0x9A, 0xA7, 0xDF,
-    0x32, 0xA7, 0x7D, 0x7B, 0x9C, 0xAE, 0x84, 0xEC, 0x8C, 0xC7, 0xAB, 0xE4, 0xF8, 0x04, 0x53, 0xC6,
-    0x64, 0xC5, 0x54, 0xEB, 0xEA, 0xD7, 0xBA, 0xE6, 0x91, 0xEE, 0xB8, 0xD9, 0xED, 0xF2, 0x68, 0xB3,
-    0xBA, 0x99, 0xE8, 0x99, 0x5B, 0x46, 0x8B, 0xE8, 0xB1, 0x88, 0xE2, 0xA6, 0x1E, 0x2F, 0xB3, 0x78,
-    0xD9, 0x8C, 0x97, 0x79, 0xB5, 0x5A, 0xB0, 0xAB, 0x93, 0x93, 0xD5, 0xEA, 0x64, 0x35, 0x9A, 0xAC,
-    0x85, 0x53, 0x8E, 0x3F, 0xE5, 0x88, 0x9A, 0xE3, 0xD6, 0x34, 0xF4, 0x58, 0x36, 0xFB, 0x74, 0x8F,
-    0x9B, 0x3C, 0xD8, 0xD0, 0x3B, 0x5E, 0x29, 0x67, 0xB8, 0x41, 0xC3, 0x7C, 0x84, 0xAA, 0x21, 0xEB,
-    0x93, 0xE5, 0x53, 0x0C, 0x73, 0x53, 0x97, 0xEA, 0x54, 0xF7, 0x8D, 0x80, 0x0E, 0xD0, 0xDF, 0xD1,
-    0x58, 0x43, 0x3B, 0xFF, 0x81, 0xD3, 0xCB, 0x8B, 0xE7, 0x65, 0x0F, 0xEB, 0x98, 0x22, 0x9C, 0xF0,
-    0x02, 0x7E, 0xB9, 0x32, 0x2C, 0xB1, 0x9F, 0x12, 0x5D, 0x14, 0xD4, 0xAC, 0x90, 0xCD, 0x29, 0xC3,
-    0x7C, 0xD3, 0x9D, 0x61, 0xBE, 0xA5, 0x49, 0xB5, 0x42, 0x71, 0x95, 0xAC, 0x02, 0xB1, 0x40, 0x01,
-    0xFD, 0xFC, 0x00, 0x66, 0x63, 0x64, 0xC8, 0x43, 0x7E, 0xAE, 0xC2, 0xBE, 0x48, 0x6F, 0x7F, 0x37,
-    0x92, 0xB1, 0xD3, 0xA5, 0x04, 0xB2, 0x8D, 0x94, 0x49, 0xE5, 0x86, 0x61, 0x52, 0xD0, 0xEE, 0x9A,
-    0xFB, 0xC3, 0x06, 0x5B, 0x21, 0xFB, 0x87, 0x8F, 0xAE, 0xC8, 0xA8, 0x7D, 0xE3, 0xA3, 0x50, 0xCA,
-    0x64, 0xC8, 0x7E, 0x16, 0x32, 0xAF, 0xF1, 0x6E, 0x71, 0x55, 0x31, 0xDC, 0x26, 0xA7, 0x66, 0x5D,
-    0xF6, 0x50, 0x00, 0xE0, 0x2C, 0x65, 0x3F, 0xC2, 0x8B, 0xF8, 0xA1, 0x70, 0x12, 0xA3, 0x37, 0xD0,
-    0x60, 0x18, 0x11, 0x7F, 0xA4, 0x40, 0x34, 0x7B, 0x4D, 0xA0, 0x6D, 0x8C, 0xCD, 0x92, 0x18, 0x1F,
-    0xCC, 0x4C, 0x1C, 0x50, 0x4E, 0xBE, 0x69, 0x03, 0xD7, 0xC0, 0xB2, 0x6B, 0x5E, 0x5F, 0xEB, 0x69,
-    0x7D, 0xE7, 0x4C, 0x58, 0xEF, 0xC4, 0x8E, 0x18, 0x72, 0x2D, 0xA9, 0x69, 0x01, 0xFC, 0x97, 0x6B,
-    0x7F, 0xE6, 0x4A, 0x8F, 0x66, 0x60, 0x6A, 0xFD, 0xE7, 0x9F, 0xBD, 0x2A, 0xBB, 0x4F, 0x44, 0x9F,
-    0xCC, 0x6A, 0xA3, 0x8C, 0x46, 0x0D, 0x05, 0x04, 0x52, 0xDE, 0x05, 0xA7, 0xBD, 0xD3, 0xB3, 0x99,
-    0x8D, 0xCF, 0x4E, 0xDE, 0x7E, 0x36, 0x6F, 0x8A, 0xE6, 0x24, 0x3B, 0x15, 0x70, 0x8B, 0xEC, 0x2E,
-    0x5D, 0x17, 0xAC, 0x47, 0x3C, 0xA4, 0xBA, 0xD0, 0xA4, 0x30, 0xDE, 0xF1, 0x0A, 0x8E, 0xB7, 0xEC,
-    0x1C, 0x0E, 0xDA, 0xC7, 0x3C, 0xE9, 0x1A, 0x32, 0xA8, 0xBD, 0x60, 0x78, 0xC1, 0x4C, 0x0A, 0xA7,
-    0x4A, 0xCA, 0xD8, 0x15, 0x34, 0x33, 0xA6, 0x16, 0x84, 0x19, 0xAE, 0x5D, 0x0C, 0x33, 0xDB, 0x94,
-    0x33, 0x4F, 0xD5, 0xA8, 0xF6, 0x34, 0xFD, 0xFA, 0xC9, 0x43, 0xAF, 0xFF, 0xA0, 0xF3, 0xD3, 0x97,
-    0x5E, 0xFB, 0x46, 0xE3, 0xE6, 0xE7, 0x9B, 0x32, 0xD5, 0xAC, 0xA5, 0x9A, 0x76, 0xAA, 0x49, 0x99,
-    0x26, 0x59, 0x5B, 0x69, 0xDB, 0x0C, 0xD9, 0xCB, 0xB7, 0xCA, 0xE4, 0xA0, 0xB4, 0x68, 0xB2, 0x2D,
-    0x7B, 0x49, 0xE9, 0x03, 0xCA, 0x31, 0x4D, 0x25, 0xE7, 0x9A, 0xD6, 0x9E, 0xD7, 0xD7, 0x4E, 0xE8,
-    0x91, 0x81, 0x45, 0x9E, 0xAD, 0x12, 0xFF, 0x3E, 0x69, 0xD2, 0x25, 0x47, 0x10, 0x07, 0x8A, 0x7E,
-    0x45, 0xDA, 0xAA, 0x4F, 0x5D, 0xF9, 0x1C, 0x78, 0x05, 0x24, 0x21, 0x13, 0xEA, 0x18, 0x50, 0xE4,
-    0xCD, 0xEF, 0xD4, 0x04, 0x6F, 0xB0, 0x5F, 0xD2, 0x4D, 0x9A, 0x52, 0x17, 0xBF, 0xA2, 0x9B, 0xEE,
-    0x94, 0xCF, 0x9B, 0x4C, 0x38, 0x5D, 0xE3, 0x72, 0x54, 0x61, 0xA7, 0xDD, 0x7C, 0x45, 0x5F, 0x71,
-    0xAB, 0x6D, 0x79, 0x54, 0xFA, 0xCB, 0x40, 0x08, 0xF0, 0x0C, 0x70, 0xC6, 0x83, 0x53, 0xF2, 0x32,
-    0x7B, 0x54, 0xEF, 0x81, 0x3F, 0x0C, 0xF4, 0xE6, 0x92, 0x95, 0xE0, 0x37, 0x9F, 0x9C, 0x9D, 0x84,
-    0xA1, 0xAC, 0xFE, 0x71, 0x2E, 0x7B, 0x0C, 0x10, 0x6F, 0x2B, 0x7E, 0x92, 0xEA, 0xD5, 0x57, 0x4E,
-    0xFD, 0xBE, 0x52, 0x7D, 0x6F, 0x99, 0xA5, 0x03, 0xDA, 0x9C, 0x5B, 0xB2, 0xD9, 0xA1, 0xA0, 0xC9,
-    0x39, 0xCD, 0xDC, 0xD1, 0xA7, 0x94, 0xAF, 0xA3, 0xED, 0x23, 0xE2, 0x4D, 0x2F, 0x4C, 0x2F, 0xD8,
-    0x46, 0x9E, 0xB3, 0x0E, 0x98, 0xC3, 0x01, 0xAA, 0x26, 0x81, 0xAB, 0x01, 0x7F, 0x84, 0xA4, 0x3E,
-    0xA8, 0x91, 0xE2, 0x63, 0xA8, 0xFB, 0xE3, 0x5A, 0xC0, 0xFC, 0x90, 0xAA, 0x11, 0x99, 0xC0, 0x5C,
-    0x9C, 0x8C, 0xD3, 0x09, 0xA9, 0x50, 0x23, 0xEB, 0xA8, 0xCF, 0x45, 0x6C, 0xFA, 0xD6, 0x5C, 0xA0,
-    0x08, 0xD1, 0xA4, 0x89, 0x06, 0xDB, 0x43, 0xC5, 0xC1, 0xC9, 0xD8, 0x43, 0x95, 0xF5, 0x93, 0xEC,
-    0x2B, 0xA8, 0x8E, 0x29, 0xCC, 0x6F, 0x5B, 0x60, 0x8F, 0xD3, 0x79, 0xFA, 0xB4, 0x18, 0x6D, 0xB0,
-    0xE7, 0xB5, 0xB7, 0x0F, 0x75, 0x65, 0xDF, 0x7C, 0xDB, 0x03, 0x5C, 0x67, 0x14, 0x61, 0x53, 0x23,
-    0x9B, 0x6E, 0xD8, 0x1B, 0x4A, 0x6E, 0x63, 0x19, 0x69, 0xAB, 0x70, 0xA4, 0xD6, 0x31, 0x37, 0x6C,
-    0x9A, 0xEC, 0xE4, 0x29, 0x11, 0x96, 0x71, 0x53, 0x8E, 0x1B, 0xA6, 0x8E, 0x0F, 0x8D, 0x32, 0xEE,
-    0xCA, 0x99, 0xC9, 0x07, 0xA9, 0xBA, 0x04, 0xF6, 0x35, 0xB0, 0x15, 0x42, 0xC5, 0xF6, 0xBA, 0x4F,
-    0xBF, 0x83, 0x4B, 0x91, 0x14, 0x1F, 0xE6, 0x0E, 0x34, 0xDF, 0xD6, 0xFC, 0x11, 0xCD, 0x1F, 0xD5,
-    0xFC, 0xAA, 0x26, 0x63, 0x4D, 0x79, 0x16, 0x6D, 0x9B, 0xC0, 0x62, 0x6E, 0xAC, 0x45, 0x54, 0x10,
-    0x43, 0xB5, 0xC2, 0x51, 0x99, 0xAA, 0x6E, 0xB5, 0x02, 0xA6, 0xAF, 0x4B, 0x9A, 0xAD, 0x77, 0xE9,
-    0xF8, 0x04, 0xE8, 0x9C, 0xA9, 0x46, 0x8B, 0x70, 0x4B, 0xC3, 0xBD, 0xE2, 0x8F, 0x54, 0xD8, 0x17,
-    0x8C, 0xD3, 0xF2, 0x8A, 0x0C, 0x74, 0x18, 0x60, 0x37, 0xC8, 0x36, 0x2C, 0x63, 0x6E, 0x64, 0x6B,
-    0x8B, 0x2D, 0x4D, 0x8D, 0x5D, 0x59, 0xAF, 0xA7, 0x61, 0x1E, 0x91, 0x23, 0x43, 0x53, 0x0E, 0xF8,
-    0x90, 0x6C, 0xA3, 0xC7, 0x8D, 0x43, 0x17, 0x3B, 0x5E, 0xEE, 0x8A, 0x60, 0xD5, 0x06, 0xBD, 0x63,
-    0xD3, 0x67, 0x24, 0xA5, 0xE0, 0x36, 0xCB, 0xCB, 0xFA, 0xEB, 0xD6, 0xEA, 0xB5, 0x23, 0x32, 0x0A,
-    0xAC, 0x4B, 0x18, 0xB8, 0x98, 0x7A, 0x6E, 0x97, 0x0F, 0xAF, 0x2C, 0x66, 0xC8, 0x77, 0xFE, 0xC4,
-    0xAB, 0xF7, 0x35, 0xD9, 0xB5, 0x1E, 0x0E, 0x9A, 0x66, 0xC7, 0x2F, 0x70, 0x37, 0x9E, 0x65, 0x57,
-    0xBB, 0x00, 0x1B, 0x4C, 0x54, 0xE6, 0x4B, 0xD3, 0xA2, 0x59, 0x34, 0x76, 0x53, 0xA9, 0xCC, 0xE6,
-    0xA8, 0x35, 0xD5, 0x3E, 0x25, 0x63, 0xF3, 0x2D, 0xF5, 0xB7, 0xA1, 0x03, 0x66, 0x1F, 0x24, 0x56,
-    0x21, 0x73, 0xB3, 0xFB, 0x8A, 0x34, 0xFD, 0xD6, 0x32, 0x5B, 0x71, 0x27, 0x67, 0x58, 0xE7, 0x8D,
-    0x96, 0x25, 0xDD, 0x82, 0x07, 0x6A, 0x09, 0x1A, 0xD9, 0x46, 0xBA, 0x31, 0xD3, 0x0E, 0x1B, 0x63,
-    0x0D, 0xDE, 0xB0, 0xDA, 0xFD, 0xB6, 0x22, 0x9C, 0x7E, 0x03, 0xCC, 0x37, 0x38, 0x96, 0x93, 0x23,
-    0xA1, 0x4C, 0xCA, 0xDA, 0x14, 0x84, 0x80, 0xD5, 0x28, 0x98, 0xCE, 0x06, 0x68, 0xEA, 0xCF, 0xBD,
-    0x21, 0x65, 0xC7, 0x33, 0xB7, 0xD0, 0x36, 0xBD, 0x4B, 0x51, 0x39, 0xAB, 0x1F, 0xF9, 0xDB, 0xB8,
-    0x7E, 0x79, 0x4E, 0x45, 0x1C, 0x16, 0x6D, 0xE7, 0x52, 0x14, 0x2E, 0x0D, 0x69, 0xAE, 0x6B, 0x1C,
-    0xE9, 0x08, 0xFD, 0xB5, 0xD3, 0x1E, 0x5D, 0x3B, 0x43, 0xF4, 0xF4, 0xAF, 0x30, 0x68, 0x74, 0x02,
-    0x96, 0xA0, 0x02, 0xDE, 0x81, 0x7A, 0x06, 0x13, 0xF2, 0xF3, 0xAB, 0x81, 0x73, 0xF4, 0x62, 0xF7,
-    0x1E, 0x4F, 0x13, 0x3A, 0x8D, 0x98, 0xBE, 0x26, 0xD8, 0x9E, 0x56, 0x01, 0xC6, 0xCC, 0xEA, 0x97,
-    0xB5, 0x35, 0x71, 0xB9, 0xF1, 0xD2, 0xF3, 0x95, 0xD5, 0xD2, 0x43, 0xBF, 0xE4, 0xC7, 0xD9, 0x3B,
-    0x0A, 0xBC, 0xF0, 0xCA, 0x2C, 0x86, 0xB5, 0x60, 0x3E, 0x6B, 0xAC, 0xB2, 0xC5, 0x53, 0x3F, 0x79,
-    0xF1, 0xB5, 0xE7, 0x83, 0xD5, 0xC6, 0x54, 0xC4, 0x5B, 0x4C, 0x6C, 0xCF, 0x9A, 0x19, 0x76, 0x8C,
-    0x56, 0xC9, 0xF1, 0xB8, 0x60, 0xB1, 0x76, 0x5E, 0x54, 0xE2, 0x3C, 0x47, 0x5B, 0xF5, 0xB3, 0x9D,
-    0x3D, 0xA3, 0xD9, 0xE2, 0xC2, 0xAB, 0x47, 0xFE, 0x70, 0xB4, 0x01, 0xA3, 0x67, 0xE9, 0xC0, 0x14,
-    0x45, 0x8E, 0x1E, 0x39, 0xD3, 0xDD, 0xA7, 0xE7, 0x96, 0x9F, 0x5C, 0x99, 0xF9, 0xDA, 0x3B, 0x76,
-    0xA5, 0x57, 0x6D, 0xB6, 0xAA, 0xCB, 0x33, 0xD5, 0x65, 0x6A, 0xED, 0xA0, 0x03, 0x81, 0xDE, 0x11,
-    0x70, 0x35, 0x1B, 0x26, 0x0E, 0x95, 0x1F, 0x3D, 0x22, 0x7B, 0x93, 0xFB, 0x7F, 0x13, 0xB2, 0x73,
-    0x82, 0xBB, 0x46, 0x64, 0xEE, 0x3E, 0xE2, 0x1E, 0x4C, 0x50, 0x4E, 0x6F, 0xBB, 0x33, 0x6B, 0xAD,
-    0x42, 0x5F, 0xEB, 0x25, 0x24, 0xB2, 0x4A, 0x0F, 0x89, 0x94, 0xFA, 0x7A, 0xFD, 0x42, 0x0B, 0xEE,
-    0x1A, 0xA7, 0xCF, 0xAC, 0xBA, 0xB1, 0xC9, 0xFC, 0x34, 0xA7, 0x09, 0x9B, 0xFC, 0xAE, 0xC1, 0x6E,
-    0x54, 0xB9, 0xF4, 0x9F, 0x52, 0x66, 0xE2, 0x09, 0x68, 0xC2, 0x5B, 0x31, 0xD7, 0xE8, 0x16, 0xF6,
-    0xD9, 0x30, 0x9D, 0x3A, 0x66, 0x68, 0x8A, 0x0A, 0xF1, 0xE6, 0x9E, 0x0A, 0x05, 0x62, 0x74, 0x13,
-    0x80, 0x9D, 0x04, 0xC5, 0x14, 0xC1, 0x9F, 0x32, 0xA4, 0x85, 0x54, 0xD4, 0x5E, 0x13, 0xB9, 0x0C,
-    0x2C, 0x52, 0x32, 0x8E, 0xBA, 0x76, 0xA8, 0x49, 0xE2, 0x01, 0xD5, 0x94, 0x2E, 0x42, 0x3C, 0xF4,
-    0x9C, 0x90, 0x75, 0x93, 0x36, 0x73, 0x09, 0x2D, 0x7C, 0xFB, 0xEC, 0x59, 0xA1, 0x68, 0x81, 0x65,
-    0xB9, 0xB6, 0xC2, 0xC4, 0x8B, 0x37, 0xD6, 0x62, 0x47, 0xF6, 0xF0, 0x97, 0x0D, 0xB4, 0x30, 0x94,
-    0xC8, 0x13, 0x61, 0x8F, 0x9A, 0x74, 0xD0, 0x67, 0xE0, 0x35, 0x82, 0x81, 0x5F, 0xF6, 0x2D, 0xBE,
-    0x5B, 0x54, 0x15, 0x03, 0x24, 0x81, 0x13, 0x27, 0x83, 0xCA, 0x65, 0x9C, 0x26, 0xBE, 0xBE, 0x74,
-    0x0E, 0xCF, 0x43, 0x12, 0xE6, 0x92, 0x8E, 0xC4, 0xB7, 0xF5, 0xCF, 0x6D, 0x99, 0x28, 0xBE, 0xF5,
-    0xC6, 0x4D, 0x2F, 0x95, 0xA8, 0x8F, 0xF7, 0xF8, 0xFB, 0xBA, 0xA7, 0xBF, 0x7C, 0xE2, 0xF9, 0x75,
-    0x37, 0x37, 0x36, 0xB8, 0xB9, 0xB9, 0xEE, 0xE6, 0x2F, 0x9F, 0x78, 0xE1, 0x09, 0x44, 0xF5, 0xC4,
-    0xB3, 0x6D, 0xC5, 0x5B, 0x75, 0x57, 0xFB, 0x3E, 0xC1, 0x05, 0x49, 0xCE, 0xB3, 0x5D, 0x41, 0x8A,
-    0x44, 0xC9, 0xA0, 0xB5, 0x98, 0x49, 0x6F, 0x2F, 0x6D, 0x6A, 0x50, 0x1A, 0xA5, 0x49, 0xE9, 0xFA,
-    0xA5, 0x74, 0x65, 0x2C, 0x5D, 0x31, 0xD2, 0x15, 0x33, 0x5D, 0x3B, 0x91, 0x76, 0xBA, 0xB9, 0xBD,
-    0x68, 0x40, 0x1D, 0xED, 0x4B, 0x00, 0xF9, 0x70, 0x23, 0xF5, 0x72, 0xAF, 0x1D, 0x15, 0x82, 0x1D,
-    0xA6, 0x8B, 0xC9, 0xE6, 0x98, 0x74, 0xF5, 0x7F, 0xD3, 0xAE, 0xCA, 0xB0, 0x10, 0x50, 0xB9, 0x70,
-    0xA8, 0x73, 0xF8, 0x74, 0x9A, 0xFD, 0xF9, 0xC2, 0xF0, 0x57, 0xDC, 0xFB, 0x7B, 0xF4, 0xCF, 0x33,
-    0xEC, 0xEF, 0x9B, 0xF9, 0x83, 0xF2, 0xCA, 0xC9, 0x3E, 0xE9, 0x4B, 0x4C, 0x13, 0xA2, 0x5C, 0x4C,
-    0x1B, 0x52, 0x7B, 0x4B, 0xF8, 0x8D, 0x30, 0x57, 0x31, 0x69, 0x73, 0xC2, 0xE9, 0x8F, 0xAD, 0x8B,
-    0xDB, 0x0F, 0x75, 0x82, 0x34, 0xDB, 0x4C, 0xF0, 0x36, 0x2B, 0xC8, 0x99, 0x23, 0x74, 0x4E, 0xAE,
-    0x09, 0x2A, 0x13, 0xDF, 0xFF, 0x2D, 0x19, 0xDD, 0xDB, 0xC5, 0x9A, 0x81, 0x2E, 0x9D, 0x9E, 0x3A,
-    0x63, 0xFD, 0xD9, 0x5F, 0x79, 0x4A, 0x61, 0x04, 0xCB, 0x4C, 0x94, 0x98, 0xC8, 0x41, 0x52, 0xA3,
-    0x18, 0xC2, 0x36, 0xC4, 0xA4, 0x21, 0x6A, 0x04, 0x6C, 0x69, 0x09, 0x42, 0x84, 0xEE, 0x31, 0x57,
-    0xA3, 0x3B, 0xF9, 0xAA, 0x1E, 0x18, 0xBB, 0xA7, 0xDD, 0x03, 0x82, 0xEA, 0x61, 0x9A, 0xD8, 0x37,
-    0x17, 0xC0, 0x06, 0xCA, 0xFC, 0x46, 0xCF, 0xD8, 0xAF, 0x7B, 0xB8, 0x0B, 0xD0, 0x68, 0x7B, 0x14,
-    0x3E, 0x38, 0xEB, 0x48, 0xF0, 0x52, 0xB6, 0x0A, 0x83, 0x6E, 0x2D, 0xAA, 0x57, 0xA9, 0x54, 0xAA,
-    0xE6, 0x39, 0x9F, 0x3B, 0xF5, 0xCD, 0x85, 0x64, 0x3A, 0x45, 0x88, 0x53, 0xE6, 0x02, 0x6D, 0x45,
-    0x40, 0x8D, 0x79, 0x40, 0x1C, 0x6E, 0x6D, 0x32, 0x7F, 0x58, 0x91, 0x99, 0x26, 0x0C, 0x68, 0xFB,
-    0xB2, 0x06, 0xAD, 0x0F, 0xD5, 0xAF, 0x8B, 0x61, 0x2A, 0xE9, 0x81, 0xD4, 0xE7, 0x89, 0xC7, 0x74,
-    0xD7, 0x88, 0x2A, 0xDB, 0x51, 0x78, 0xB8, 0x6D, 0x64, 0x04, 0x65, 0xC7, 0x68, 0xAB, 0xC1, 0xA3,
-    0xC1, 0x22, 0xB9, 0xF3, 0x5B, 0x74, 0x77, 0xC7, 0x16, 0x60, 0xF9, 0x4D, 0x77, 0xFE, 0x6F, 0xF4,
-    0x43, 0xCF, 0x98, 0x2F, 0xCC, 0x17, 0x82, 0x0F, 0x59, 0x87, 0x99, 0x0F, 0xAC, 0x83, 0x2A, 0xB4,
-    0x80, 0x31, 0xA5, 0x93, 0xE6, 0x86, 0x4D, 0x44, 0xE3, 0x8B, 0xE2, 0x21, 0xC1, 0x7D, 0x16, 0x42,
-    0xCE, 0x7E, 0x2D, 0x1C, 0x73, 0xCC, 0xE9, 0x68, 0x8B, 0x72, 0x90, 0xE1, 0xE4, 0x8E, 0x3B, 0xF2,
-    0xC7, 0xA8, 0xEE, 0x06, 0x13, 0xD0, 0x2A, 0x43, 0xEB, 0xB6, 0x63, 0xEE, 0x98, 0xAD, 0x9F, 0x0C,
-    0x6C, 0xCE, 0xBC, 0x99, 0x26, 0x3B, 0x43, 0x56, 0x48, 0x7D, 0x42, 0x2C, 0x9D, 0x45, 0x04, 0xD7,
-    0xBA, 0x4C, 0x82, 0x4A, 0x70, 0xD7, 0x7D, 0x43, 0xC5, 0xE1, 0x8D, 0x87, 0xD3, 0x47, 0x4C, 0x10,
-    0x04, 0xA5, 0x6E, 0xCA, 0xF0, 0x89, 0x45, 0x80, 0xCC, 0x84, 0x49, 0x2E, 0x99, 0x9E, 0xDF, 0x34,
-    0x4C, 0xB7, 0x5C, 0x5B, 0x62, 0x32, 0xB0, 0x14, 0xC4, 0x87, 0x07, 0x0E, 0x8B, 0x14, 0x05, 0x6E,
-    0x7E, 0x83, 0xF8, 0xAA, 0x17, 0x81, 0x45, 0x0F, 0x40, 0x01, 0x21, 0x2E, 0x2B, 0xC2, 0x70, 0x40,
-    0x2C, 0x97, 0x97, 0xCE, 0x46, 0x46, 0x50, 0x60, 0x81, 0xFE, 0x66, 0x40, 0xE3, 0x01, 0x15, 0xFA,
-    0x54, 0xAA, 0x84, 0xB9, 0xB1, 0xB1, 0x94, 0x31, 0x7D, 0x7A, 0x97, 0xFF, 0x03, 0xD1, 0xCC, 0x28,
-    0x49, 0x18, 0xE7, 0x4D, 0xF7, 0xAB, 0x3E, 0xC0, 0xF6, 0x93, 0x72, 0xF6, 0x7B, 0xD3, 0xC3, 0xE9,
-    0xF2, 0x82, 0x28, 0x78, 0xA5, 0xA7, 0xC2, 0x52, 0xA3, 0x54, 0x01, 0x90, 0x2D, 0x19, 0x8C, 0x6B,
-    0x51, 0x95, 0xEC, 0x19, 0x9A, 0x6C, 0x52, 0x1E, 0x05, 0x12, 0x69, 0x96, 0x5A, 0x8E, 0xEC, 0x72,
-    0x19, 0xEA, 0x52, 0xCD, 0xA3, 0xF0, 0xF0, 0xDC, 0x68, 0xF1, 0x5F, 0xA5, 0xB6, 0x16, 0xDA, 0x6C,
-    0xCE, 0xCD, 0x95, 0xB5, 0xD3, 0x6E, 0xBA, 0xA8, 0x77, 0x2E, 0x2F, 0x43, 0x7D, 0x3E, 0xE1, 0xBD,
-    0x9B, 0xAE, 0x29, 0x48, 0x13, 0x96, 0x09, 0xC4, 0x01, 0xA0, 0x47, 0x10, 0x33, 0xCB, 0x70, 0x9A,
-    0x49, 0xF0, 0x91, 0x85, 0x75, 0xE1, 0x1E, 0x45, 0xCC, 0xA7, 0x29, 0xC8, 0x62, 0x43, 0xE0, 0xC6,
-    0x68, 0x16, 0xF3, 0x70, 0x12, 0x75, 0x0D, 0x1F, 0xF5, 0x13, 0xFD, 0x90, 0xA8, 0x89, 0xA4, 0xA5,
-    0x9F, 0x50, 0x3E, 0x4D, 0x61, 0x09, 0x8A, 0x39, 0xA7, 0xF9, 0x21, 0x9B, 0xF3, 0xB8, 0xAD, 0x56,
-    0x19, 0xEB, 0x8A, 0x05, 0x5A, 0x18, 0x6E, 0x07, 0xC3, 0x30, 0xAB, 0xE6, 0xD2, 0xDB, 0xF2, 0xC6,
-    0x2F, 0xF6, 0x55, 0xE0, 0x58, 0xA6, 0xBB, 0x2E, 0xBC, 0x95, 0x02, 0x6F, 0x51, 0x21, 0x69, 0x27,
-    0x45, 0xA9, 0x0F, 0x62, 0xDE, 0x92, 0x67, 0x7F, 0xB1, 0x6F, 0x4C, 0x25, 0x2D, 0x75, 0x79, 0x6E,
-    0xED, 0xD9, 0x71, 0x38, 0x01, 0x25, 0xA7, 0x02, 0xB2, 0x3B, 0x72, 0x22, 0x9F, 0xB9, 0x05, 0xE4,
-    0x55, 0x3E, 0x03, 0x1F, 0xED, 0x5C, 0xFC, 0x6B, 0xD9, 0x2B, 0x2B, 0x43, 0x35, 0xD1, 0x05, 0x41,
-    0xFD, 0xFF, 0x22, 0x6C, 0xB2, 0xA3, 0x94, 0x6B, 0x68, 0x2B, 0x38, 0x59, 0x47, 0x1F, 0x86, 0x44,
-    0x90, 0x0C, 0x11, 0xFF, 0x21, 0xEF, 0x6C, 0x47, 0x1F, 0x19, 0x99, 0x08, 0xF8, 0x2E, 0xE8, 0xF5,
-    0xAA, 0x65, 0x0A, 0xF6, 0x46, 0x10, 0x12, 0xB7, 0xA6, 0x88, 0x7E, 0x7C, 0x5D, 0xE9, 0xF5, 0x48,
-    0x31, 0x3D, 0x0D, 0x26, 0xCB, 0x7B, 0x34, 0xF8, 0x46, 0x71, 0x16, 0xCC, 0x49, 0xD0, 0xEB, 0xB1,
-    0xDE, 0x73, 0x8E, 0x85, 0xED, 0xB9, 0x6E, 0x5D, 0x24, 0x0E, 0xA5, 0x70, 0xA6, 0x26, 0xB1, 0x65,
-    0x7B, 0x56, 0x3F, 0x3D, 0x46, 0x0F, 0x9E, 0x21, 0xE3, 0x15, 0x3C, 0xE0, 0x91, 0x25, 0x54, 0x16,
-    0x06, 0xB2, 0xE0, 0xB5, 0x98, 0x1F, 0x3B, 0x86, 0xBB, 0xEF, 0x23, 0xDA, 0x34, 0xE4, 0x22, 0x1C,
-    0xE7, 0xD5, 0x94, 0x87, 0xAA, 0x56, 0x84, 0x2B, 0x4E, 0xDC, 0x7F, 0x02, 0xEA, 0x28, 0x60, 0x90,
-    0x23, 0xEF, 0x0D, 0x95, 0x8E, 0xEF, 0x6A, 0x07, 0xC8, 0xCB, 0x93, 0x6D, 0x7A, 0x61, 0x95, 0x75,
-    0x12, 0x45, 0x1E, 0xD1, 0x4D, 0x61, 0xF4, 0x40, 0x3C, 0x54, 0xF7, 0x60, 0x79, 0xB3, 0xED, 0x8D,
-    0x3B, 0x6E, 0xB7, 0x3E, 0xED, 0xB7, 0x1F, 0x51, 0x29, 0x03, 0x72, 0xC3, 0xF4, 0x8E, 0x03, 0xC5,
-    0xF0, 0xF7, 0xC4, 0x03, 0x9E, 0x03, 0xA3, 0xD6, 0xDD, 0x27, 0xFD, 0x83, 0x51, 0xE3, 0x38, 0x1A,
-    0xD7, 0x92, 0xA5, 0xB6, 0x99, 0x9B, 0xA1, 0xF3, 0x9C, 0x1E, 0x58, 0x71, 0xC7, 0xAE, 0x09, 0xA3,
-    0x2E, 0x74, 0xE8, 0xA7, 0x1F, 0xF5, 0x28, 0x7F, 0x2D, 0xE0, 0xD5, 0x1A, 0xBB, 0x60, 0x06, 0xCA,
-    0x4D, 0xD4, 0xAC, 0x1A, 0x9F, 0x4E, 0xB3, 0x27, 0xBD, 0x07, 0x1A, 0xD0, 0xA3, 0x4F, 0x2E, 0x1B,
-    0x7F, 0x19, 0x1C, 0xE4, 0xC2, 0x7C, 0x38, 0xAC, 0x5F, 0xF3, 0xF9, 0x1E, 0x0F, 0x23, 0xE1, 0x53,
-    0x84, 0x84, 0x13, 0x14, 0x80, 0xB0, 0x0F, 0xA3, 0x63, 0xAE, 0x56, 0x9B, 0x90, 0x1D, 0x8C, 0xF3,
-    0x00, 0x29, 0xE7, 0x14, 0xEB, 0xC1, 0xF0, 0x70, 0x7B, 0x68, 0xAD, 0xDF, 0xFA, 0x2F, 0xC5, 0x35,
-    0x40, 0x25, 0xFB, 0x07, 0x62, 0x2D, 0x82, 0x53, 0x33, 0xA8, 0xE8, 0xE3, 0x64, 0xFC, 0xA3, 0x6B,
-    0x1C, 0x0D, 0x8C, 0xC3, 0x5D, 0x47, 0x3E, 0x1C, 0xEE, 0x5C, 0x9A, 0x46, 0xC0, 0x84, 0xEE, 0x46,
-    0xD3, 0xAA, 0x6D, 0xD5, 0xB8, 0x6A, 0x3D, 0x51, 0x15, 0x96, 0xAA, 0xC0, 0x14, 0x7A, 0x50, 0x5D,
-    0x10, 0xFA, 0x20, 0x74, 0x42, 0x53, 0x2C, 0xB1, 0xD0, 0x1E, 0x4A, 0x57, 0xE8, 0x77, 0x85, 0xF6,
-    0x4B, 0xE5, 0xDE, 0x16, 0x00, 0x40, 0xFA, 0x05, 0x32, 0x0B, 0x64, 0x3B, 0xB4, 0x97, 0xB6, 0x35,
-    0xC9, 0xBE, 0x5D, 0xBA, 0xEB, 0x05, 0x49, 0xF9, 0xA0, 0xC4, 0x34, 0xBB, 0x5E, 0xEA, 0xA4, 0x96,
-    0x0F, 0x11, 0x20, 0xAD, 0x9D, 0xA6, 0x83, 0x22, 0x57, 0x36, 0xD3, 0xFA, 0x8A, 0x4A, 0xEE, 0x9A,
-    0x66, 0x5E, 0x3F, 0xEF, 0x36, 0xD5, 0x9F, 0x92, 0x57, 0x06, 0x66, 0x7D, 0xDB, 0x63, 0x6B, 0x8B,
-    0x01, 0x5C, 0x07, 0x69, 0x0B, 0x80, 0xC9, 0x5D, 0xD3, 0x63, 0x3E, 0x90, 0x19, 0x81, 0x05, 0x7B,
-    0x83, 0xE4, 0x0E, 0xA8, 0xD1, 0x43, 0xAD, 0x0B, 0x67, 0x98, 0x82, 0xF4, 0xB6, 0x20, 0x5C, 0x30,
-    0xBC, 0x86, 0xD9, 0x6F, 0x98, 0x6A, 0x53, 0xA5, 0xC1, 0x55, 0x69, 0x4B, 0x55, 0x42, 0x7E, 0xAB,
-    0x2C, 0x2E, 0xBA, 0xA4, 0xD4, 0x6F, 0x88, 0x95, 0x7B, 0x6F, 0x7D, 0x07, 0x3A, 0xED, 0x37, 0xD5,
-    0xD0, 0x10, 0x63, 0xA8, 0xA9, 0xD0, 0xF0, 0x52, 0x83, 0x77, 0xD1, 0x42, 0x8D, 0x06, 0x7B, 0x3C,
-    0x1E, 0x21, 0x7B, 0xBD, 0x63, 0x6D, 0x82, 0xB5, 0x9A, 0xE0, 0x5E, 0x52, 0x3B, 0x3A, 0x86, 0x37,
-    0x4A, 0x86, 0x8B, 0xAA, 0xAE, 0x0F, 0x75, 0xE1, 0xA1, 0xC9, 0xEE, 0x85, 0x0A, 0x43, 0x89, 0x84,
-    0x53, 0xAA, 0x16, 0x01, 0xA5, 0x82, 0x8C, 0x44, 0x8D, 0x33, 0x1C, 0x4D, 0x6A, 0x10, 0x8E, 0x32,
-    0x11, 0x71, 0xEE, 0xCD, 0x9A, 0x32, 0x07, 0x67, 0xE8, 0x9B, 0x6A, 0xEB, 0x62, 0xEB, 0xFA, 0x7E,
-    0x82, 0x2A, 0x0D, 0x33, 0x28, 0x8E, 0x8E, 0x8E, 0x0C, 0xEB, 0xBB, 0x99, 0x7B, 0x16, 0x11, 0xB5,
-    0x94, 0x87, 0x4E, 0x96, 0x61, 0x7D, 0x29, 0xA0, 0x4F, 0x9C, 0x42, 0xF5, 0x12, 0x7F, 0xB9, 0x8F,
-    0xC0, 0x46, 0x1F, 0x50, 0x4E, 0x16, 0x9C, 0x90, 0xEE, 0xA2, 0x10, 0x83, 0x78, 0x4F, 0x8A, 0xF5,
-    0xBE, 0xCC, 0xAA, 0xB5, 0x5E, 0x62, 0x95, 0x39, 0x20, 0x13, 0x6E, 0xCB, 0xFD, 0x07, 0xDD, 0x34,
-    0x8C, 0xAC, 0xA9, 0x70, 0x9D, 0x03, 0x61, 0x24, 0xB9, 0xFC, 0x04, 0x68, 0x63, 0xD2, 0xA6, 0xEA,
-    0x38, 0x45, 0x5C, 0x0B, 0x21, 0xC7, 0xD9, 0x79, 0x78, 0x05, 0x0C, 0x41, 0x74, 0x7C, 0x43, 0x13,
-    0x31, 0x69, 0x31, 0x95, 0xD9, 0x37, 0x20, 0x1E, 0xC3, 0x4A, 0x31, 0x95, 0x43, 0x48, 0x79, 0xDA,
-    0xE5, 0xE2, 0x36, 0xA3, 0x7D, 0x58, 0x23, 0x50, 0x83, 0xC3, 0xFD, 0xF9, 0x8D, 0x8D, 0x6C, 0xA7,
-    0x6F, 0xFA, 0x63, 0x5C, 0x17, 0x8D, 0x92, 0x31, 0x07, 0x71, 0xA7, 0xBF, 0x8E, 0x2C, 0x73, 0x67,
-    0xFF, 0x9F, 0x40, 0x30, 0x49, 0xE6, 0xB9, 0x6F, 0x20, 0xD5, 0x28, 0xC8, 0x60, 0x52, 0x4D, 0xD3,
-    0x65, 0x27, 0xE1, 0x5E, 0x76, 0x42, 0x2A, 0xF0, 0x1D, 0x05, 0x53, 0xDE, 0x25, 0xFD, 0xBA, 0x4F,
-    0xB3, 0x05, 0x3C, 0x18, 0xB3, 0xD0, 0x0C, 0x4E, 0xA8, 0x1C, 0x18, 0xFC, 0x96, 0x64, 0x49, 0xB4,
-    0x43, 0xDF, 0x25, 0xCA, 0xA9, 0x51, 0x7A, 0xC0, 0x03, 0x20, 0x2D, 0x82, 0x56, 0xBC, 0x2A, 0xC6,
-    0xB9, 0xA1, 0x84, 0xDE, 0x5E, 0x45, 0x66, 0x34, 0xF4, 0xA5, 0xBD, 0x0B, 0x2A, 0xC0, 0xE7, 0xE8,
-    0x0E, 0x6F, 0x79, 0x42, 0x48, 0x91, 0x41, 0x41, 0x2A, 0x1A, 0x08, 0x14, 0x67, 0xE0, 0xAD, 0x1D,
-    0x7A, 0x23, 0x8C, 0x26, 0x46, 0x48, 0x4C, 0x30, 0x12, 0xB8, 0x7C, 0xE8, 0x05, 0x82, 0x99, 0x14,
-    0x01, 0x62, 0x69, 0xE9, 0x80, 0x7E, 0xD8, 0xE7, 0x06, 0xD9, 0x08, 0x07, 0x65, 0x26, 0x7C, 0xCE,
-    0xCE, 0xC6, 0xAC, 0x1F, 0xAA, 0x49, 0x0C, 0x34, 0x70, 0x40, 0x90, 0xCD, 0x43, 0x0D, 0xB5, 0xDE,
-    0x43, 0x5B, 0x37, 0x8D, 0x1A, 0xCC, 0x85, 0xF2, 0xDA, 0x01, 0xA9, 0x36, 0x30, 0x05, 0x52, 0xB1,
-    0x05, 0x28, 0xF7, 0xA1, 0x32, 0x9D, 0xA3, 0xB1, 0x72, 0xB2, 0x61, 0xB4, 0xEB, 0xDC, 0xE7, 0x26,
-    0x67, 0x57, 0x5E, 0x03, 0xCC, 0xFE, 0x3B, 0x18, 0x19, 0xA7, 0x53, 0xC1, 0xA6, 0x71, 0x70, 0xD8,
-    0x7F, 0xB2, 0x89, 0x91, 0x7F, 0xFF, 0xCA, 0xCD, 0xCE, 0x4D, 0x7D, 0xE4, 0xAE, 0xCA, 0x3C, 0x5A,
-    0xE6, 0xAA, 0x8F, 0x50, 0x5D, 0xB4, 0x3B, 0xD1, 0x4C, 0x68, 0xD8, 0x74, 0x86, 0x1E, 0x50, 0x3E,
-    0x52, 0xD5, 0x82, 0xB4, 0xEA, 0x2E, 0x37, 0x38, 0x41, 0x7D, 0x38, 0x12, 0x0E, 0x60, 0x23, 0xD9,
-    0xC9, 0x95, 0x74, 0xA4, 0x6B, 0x55, 0x76, 0x5A, 0xD8, 0x55, 0x3C, 0xBD, 0x19, 0xE1, 0xEC, 0xC4,
-    0x97, 0xE0, 0x0D, 0x69, 0x24, 0x04, 0xA5, 0xB5, 0xDF, 0xFC, 0xE9, 0x15, 0x24, 0xEE, 0x62, 0xFC,
-    0x3B, 0xC9, 0x66, 0xA8, 0x72, 0x0A, 0x23, 0x82, 0x1C, 0xC0, 0x6A, 0x98, 0xB2, 0x4B, 0x9B, 0x61,
-    0xD2, 0x3A, 0x99, 0xD3, 0xA3, 0x13, 0x66, 0x01, 0x32, 0x6C, 0xAF, 0x92, 0xC7, 0xB3, 0x1A, 0xB5,
-    0xC1, 0x1E, 0x48, 0x4E, 0x4F, 0x00, 0xE2, 0xC8, 0xD3, 0x32, 0xD4, 0x40, 0x53, 0xC5, 0xC9, 0x1F,
-    0xFF, 0x31, 0xB2, 0x32, 0xE8, 0xE1, 0xB5, 0x7D, 0x83, 0x2C, 0x40, 0x65, 0x5D, 0xB5, 0x44, 0x19,
-    0x74, 0x81, 0x0A, 0x38, 0x9E, 0x0A, 0x32, 0x48, 0x56, 0x93, 0x3A, 0x78, 0x1D, 0xA7, 0xD4, 0x70,
-    0x2E, 0x18, 0xA9, 0xCB, 0xEE, 0xD8, 0x5E, 0xB5, 0xB8, 0xD1, 0x26, 0x4D, 0x42, 0xFD, 0x7B, 0xB0,
-    0xAB, 0xF6, 0xFE, 0x1D, 0x4F, 0x1A, 0x52, 0x91, 0xC7, 0xC7, 0xC3, 0x86, 0x8A, 0x58, 0xC3, 0xEE,
-    0xBB, 0x41, 0xFE, 0xFF, 0x63, 0x3B, 0x8A, 0xEE, 0x56, 0x01, 0x6E, 0x74, 0xC0, 0xBC, 0xDA, 0xC2,
-    0xED, 0xB6, 0x91, 0xFF, 0xED, 0x65, 0x9D, 0xF7, 0xE5, 0x7F, 0x85, 0x5B, 0xF9, 0x9F, 0xB3, 0x21,
-    0xFF, 0x5B, 0x1D, 0xE4, 0x7F, 0x5B, 0x87, 0xD8, 0x61, 0xBF, 0x38, 0xC3, 0x1E, 0xA1, 0xAF, 0x06,
-    0x46, 0x15, 0x11, 0xC9, 0x5C, 0xA3, 0x66, 0xCD, 0x74, 0xA3, 0x10, 0x1E, 0x64, 0x2B, 0x76, 0x83,
-    0x6A, 0x70, 0xCD, 0x20, 0x51, 0xDD, 0x9D, 0xE9, 0xDC, 0x88, 0x78, 0x48, 0xBB, 0x61, 0x64, 0x72,
-    0xA3, 0x8D, 0x12, 0xF9, 0xE3, 0xB4, 0x57, 0x5F, 0x9C, 0x37, 0x64, 0x60, 0x78, 0x1B, 0xCA, 0xAE,
-    0xC0, 0x1C, 0x14, 0x2D, 0xE0, 0x5A, 0x60, 0x69, 0xFD, 0x49, 0x95, 0xA2, 0x55, 0x93, 0x15, 0x7E,
-    0x06, 0x03, 0x8E, 0xD2, 0xC5, 0x1C, 0x8E, 0x2C, 0x8E, 0x52, 0xA9, 0x31, 0x09, 0x61, 0x99, 0xDB,
-    0x4A, 0xDB, 0x32, 0x2A, 0xBE, 0xB0, 0x53, 0x20, 0x6D, 0xC8, 0x27, 0x50, 0xF6, 0x1E, 0x8F, 0xBD,
-    0x0A, 0xC2, 0x06, 0x5F, 0x63, 0xF2, 0x7B, 0xA4, 0xBC, 0x08, 0xB2, 0x06, 0x57, 0x83, 0xAA, 0x2F,
-    0x08, 0xD8, 0x5C, 0x39, 0xBF, 0x03, 0x07, 0x86, 0x86, 0x9D, 0x1F, 0x24, 0x5B, 0xFA, 0x51, 0x7A,
-    0x49, 0xE4, 0x1A, 0x3C, 0xC7, 0x92, 0xB0, 0x10, 0x72, 0x9B, 0x5D, 0xA0, 0x2E, 0x9C, 0xDF, 0x71,
-    0x87, 0xE8, 0x13, 0x75, 0x70, 0x4C, 0x85, 0x02, 0x28, 0x51, 0x45, 0xB6, 0xF0, 0x78, 0x45, 0x72,
-    0x0B, 0xAA, 0x83, 0x95, 0xA4, 0x03, 0x73, 0x43, 0x07, 0x67, 0x80, 0x9C, 0x0C, 0xE8, 0x1A, 0x28,
-    0xA6, 0x1D, 0xDA, 0x11, 0x4F, 0x81, 0xD7, 0xCD, 0x41, 0xD9, 0x79, 0x76, 0xFE, 0x5E, 0xD1, 0x6E,
-    0x29, 0xFC, 0xE7, 0x36, 0x00, 0x1D, 0x09, 0x81, 0xEE, 0xFE, 0x07, 0xDB, 0x31, 0x32, 0xFF, 0xE2,
-    0xF9, 0x53, 0x37, 0x29, 0xA7, 0x85, 0xC6, 0x2D, 0x5D, 0xED, 0x20, 0x7B, 0x74, 0x5C, 0xEE, 0x3B,
-    0xC2, 0x0A, 0xEA, 0xA2, 0x10, 0x3C, 0x1D, 0x4C, 0x05, 0x5F, 0x0F, 0x6B, 0xE1, 0x53, 0xD1, 0x5A,
-    0x58, 0xED, 0x5D, 0x0D, 0x5B, 0x6D, 0x54, 0xE7, 0x62, 0xD8, 0x2A, 0x74, 0xC2, 0x96, 0xD5, 0x89,
-    0x62, 0x3E, 0x1D, 0xC5, 0x2A, 0x54, 0x13, 0x28, 0x37, 0x19, 0xAC, 0x5A, 0xE1, 0x04, 0xC4, 0xCF,
-    0xEC, 0xD0, 0x0E, 0x85, 0x7C, 0xB7, 0x3F, 0x8B, 0xDB, 0x5E, 0xF9, 0xFC, 0xAB, 0x3F, 0xFD, 0xD1,
-    0x51, 0xE7, 0x1B, 0xB9, 0xD9, 0x99, 0xF0, 0x0A, 0x14, 0x85, 0x80, 0x27, 0xD1, 0x58, 0x92, 0xE2,
-    0xD1, 0x5F, 0xAC, 0xE4, 0x5E, 0x3A, 0x3D, 0xF6, 0xD5, 0x73, 0x5F, 0x50, 0xFD, 0x2F, 0x6C, 0x27,
-    0xEB, 0xFB, 0xA4, 0xF5, 0x37, 0x68, 0x51, 0xD5, 0x18, 0x98, 0xDF, 0x42, 0xE4, 0x47, 0x6A, 0x75,
-    0x8C, 0xF4, 0xB3, 0x3E, 0x85, 0x36, 0xCD, 0x70, 0x37, 0x0F, 0xCB, 0xBA, 0x55, 0x43, 0xCA, 0x69,
-    0x29, 0xAF, 0x84, 0x54, 0x6D, 0x11, 0xF7, 0x46, 0x19, 0xF9, 0x65, 0x68, 0x9F, 0x2D, 0xB7, 0xF4,
-    0xFD, 0x75, 0x5A, 0x8B, 0x6C, 0x73, 0xDA, 0xAD, 0xA8, 0x5D, 0x92, 0x52, 0xD9, 0xEC, 0xAC, 0xC6,
-    0x05, 0x29, 0x4E, 0x3C, 0xCE, 0x4E, 0x26, 0x16, 0xC8, 0xEE, 0x5C, 0xEF, 0xC5, 0x4C, 0x88, 0x53,
-    0x41, 0xE4, 0x9A, 0x47, 0xA5, 0x90, 0xF2, 0x63, 0xC4, 0x99, 0x30, 0xBC, 0x48, 0xF7, 0x33, 0x4A,
-    0x02, 0xD7, 0xD5, 0x96, 0x8E, 0x84, 0xFE, 0x5D, 0x11, 0xD4, 0xE5, 0xE6, 0xAE, 0x30, 0xBA, 0xE7,
-    0x96, 0x33, 0x7D, 0xD4, 0x5E, 0x4C, 0xB2, 0x83, 0x02, 0xCF, 0x74, 0xE4, 0x0D, 0x88, 0x69, 0x25,
-    0xAE, 0x40, 0xF1, 0xF4, 0xA2, 0x22, 0x8C, 0x39, 0xB5, 0x9B, 0xCF, 0xA5, 0xA7, 0x05, 0x48, 0x27,
-    0xB8, 0x0A, 0x8D, 0x55, 0x16, 0x28, 0xA7, 0x40, 0x88, 0x03, 0xB9, 0xF8, 0x11, 0x48, 0xF8, 0xA8,
-    0xC0, 0xE7, 0xDB, 0x0B, 0xC1, 0xAE, 0x5B, 0x01, 0x5F, 0x8A, 0xB2, 0xB6, 0x29, 0x46, 0x8A, 0xC6,
-    0xCF, 0xFB, 0x65, 0xD6, 0xFF, 0x97, 0x32, 0x02, 0x77, 0xD9, 0x14, 0x34, 0xD5, 0xBE, 0x31, 0x04,
-    0x00, 0xF5, 0xCC, 0xB7, 0x2E, 0xC0, 0xBB, 0xB6, 0xE8, 0x87, 0x2E, 0x0B, 0x4B, 0x0C, 0xBA, 0x5F,
-    0xFF, 0xBD, 0x07, 0x03, 0x88, 0x7F, 0xB8, 0x3F, 0xB9, 0xB8, 0xFC, 0x6C, 0x5B, 0x62, 0x19, 0x54,
-    0x28, 0x98, 0x30, 0x97, 0xA8, 0x70, 0x5B, 0xFB, 0x17, 0x3C, 0xBE, 0x5B, 0xF7, 0xB2, 0x0F, 0x2E,
-    0x9D, 0xEE, 0x3F, 0x5B, 0x56, 0x8A, 0xCC, 0xD9, 0xE5, 0xC9, 0x58, 0xEF, 0xBB, 0x16, 0x92, 0xA1,
-    0x70, 0xC7, 0xA3, 0x1E, 0xFC, 0x50, 0x3B, 0xB9, 0x18, 0x3B, 0x97, 0x3B, 0x6E, 0x69, 0xC4, 0x84,
-    0xBE, 0x54, 0x0F, 0x5D, 0xB2, 0xE4, 0xE1, 0xCF, 0x46, 0x08, 0x02, 0xFA, 0xCF, 0x97, 0x6E, 0x5E,
-    0x9E, 0x11, 0xE9, 0xEC, 0x58, 0xB2, 0x1D, 0x62, 0x67, 0x00, 0xF4, 0xFB, 0x77, 0xBE, 0x6B, 0x4A,
-    0x90, 0x94, 0x23, 0xF5, 0xDF, 0xEF, 0x2A, 0x40, 0xA6, 0xEF, 0x59, 0xEA, 0xF4, 0x9F, 0x2F, 0x32,
-    0x4F, 0x34, 0x8C, 0xEE, 0x07, 0x5B, 0x79, 0x4A, 0xA4, 0x4B, 0x19, 0x2E, 0x8F, 0x9C, 0x0A, 0x16,
-    0x1E, 0xA3, 0x2D, 0x48, 0xA4, 0xF4, 0x40, 0xE9, 0x0E, 0xBE, 0x81, 0xC0, 0xBA, 0x16, 0xF3, 0x99,
-    0x08, 0xAB, 0xF8, 0x16, 0x5F, 0x47, 0x57, 0x91, 0x8F, 0x5C, 0xB0, 0x15, 0x73, 0x7A, 0xE8, 0x28,
-    0x1C, 0x70, 0x57, 0x42, 0x62, 0xEA, 0x1B, 0x13, 0x91, 0x08, 0x21, 0x0B, 0xD2, 0xAB, 0xBE, 0xE4,
-    0x5B, 0x17, 0x63, 0x69, 0xC4, 0x4E, 0x27, 0xA6, 0x1D, 0x59, 0xA2, 0x99, 0x49, 0xB0, 0xE6, 0xE4,
-    0xBB, 0x83, 0xFC, 0xDF, 0xF6, 0xAE, 0xDA, 0xEF, 0xDD, 0xBB, 0x9A, 0xB1, 0xC7, 0xF9, 0x1F, 0x1C,
-    0x86, 0xFB, 0x7F, 0xF4, 0xDE, 0xFC, 0xA7, 0x86, 0xCD, 0x23, 0x9D, 0x37, 0x12, 0x15, 0xB6, 0x79,
-    0x41, 0x89, 0x48, 0x8F, 0x26, 0x94, 0xCC, 0x01, 0x3B, 0x8F, 0x87, 0xA6, 0xFA, 0xBE, 0x1E, 0xDF,
-    0xFD, 0x38, 0xD9, 0xEA, 0x67, 0x26, 0x33, 0x44, 0x23, 0xD0, 0xFF, 0x63, 0x35, 0xA7, 0xA7, 0xFE,
-    0x74, 0xF7, 0xBE, 0x7A, 0x8C, 0x6F, 0x9A, 0xBA, 0x0F, 0xD9, 0xBF, 0x8C, 0x04, 0x3D, 0xB5, 0x7D,
-    0x1C, 0x7F, 0x51, 0xCB, 0x36, 0x04, 0xB4, 0x78, 0xEB, 0x02, 0x6B, 0xDF, 0xFB, 0xB7, 0xEF, 0xAD,
-    0x3B, 0x6F, 0xDF, 0xD3, 0xDD, 0x3C, 0xB1, 0xFE, 0x9D, 0xF7, 0xD1, 0x3E, 0x35, 0x0C, 0xF1, 0x4C,
-    0xCE, 0xFA, 0x52, 0x47, 0xF4, 0xCC, 0xC7, 0xFC, 0x45, 0x21, 0x3B, 0xCC, 0x77, 0x77, 0x5E, 0x0D,
-    0x3F, 0x34, 0xFD, 0xD6, 0x45, 0x40, 0x48, 0x51, 0xEF, 0xBF, 0x27, 0x59, 0xE6, 0xFF, 0xC3, 0x36,
-    0x7D, 0x9E, 0xF3, 0xDD, 0xB7, 0xF6, 0x29, 0xB4, 0x9E, 0x7E, 0x36, 0xF0, 0xD3, 0x65, 0xF6, 0x38,
-    0xAD, 0xD2, 0x83, 0x7E, 0x66, 0x6A, 0x09, 0xF9, 0x67, 0xDD, 0xD5, 0x4E, 0xB8, 0x48, 0x77, 0xC7,
-    0x69, 0x39, 0xC9, 0x84, 0xF3, 0x6D, 0xD9, 0xFF, 0x31, 0xE5, 0x91, 0x12, 0xD7, 0xA8, 0x55, 0xD8,
-    0x90, 0x09, 0x6F, 0xEE, 0x22, 0x09, 0x2E, 0xB1, 0xD3, 0x6E, 0xAE, 0x2E, 0x71, 0x2A, 0xB1, 0xCE,
-    0xE5, 0x2E, 0x62, 0x5E, 0xC1, 0xDB, 0xFC, 0xB0, 0x67, 0x1E, 0x11, 0x7C, 0xCE, 0xDF, 0xC8, 0x40,
-    0x1F, 0xB3, 0xD1, 0x3C, 0x07, 0x46, 0x77, 0xDE, 0xB3, 0xFE, 0xD4, 0x87, 0xF6, 0xF1, 0x58, 0x96,
-    0x96, 0x6D, 0x8A, 0x67, 0xD7, 0x93, 0xED, 0x8F, 0xBD, 0x95, 0xBC, 0x7D, 0x98, 0x9D, 0x0D, 0xA7,
-    0x06, 0x09, 0x31, 0xC4, 0xB7, 0xDA, 0xCB, 0xB2, 0xC1, 0xE8, 0x48, 0x41, 0xF5, 0x93, 0x54, 0x45,
-    0x4A, 0xDA, 0xF6, 0xE8, 0x6E, 0x5D, 0x0E, 0x76, 0x5C, 0x3E, 0xDE, 0x2F, 0x06, 0xB2, 0x3B, 0x74,
-    0xDB, 0xA3, 0x3E, 0xDE, 0x7E, 0xE2, 0xA7, 0x86, 0x31, 0xCB, 0x29, 0x6B, 0xB0, 0x0D, 0x43, 0xD9,
-    0x22, 0xC4, 0x52, 0x25, 0x63, 0xBA, 0x61, 0x68, 0x9C, 0x21, 0x27, 0x80, 0xDF, 0x73, 0x41, 0x8A,
-    0x89, 0x8D, 0x10, 0x34, 0x0C, 0x25, 0x93, 0x32, 0xB5, 0x77, 0xB9, 0xF2, 0xE3, 0x76, 0xA2, 0x79,
-    0x9B, 0x81, 0x75, 0x7D, 0x7E, 0x78, 0x7D, 0x2D, 0x69, 0xBB, 0xE6, 0xAB, 0xC4, 0xD4, 0x33, 0x0E,
-    0x83, 0xFE, 0x11, 0xEE, 0x6C, 0xC2, 0x8C, 0x20, 0x14, 0x54, 0x77, 0x50, 0xB0, 0x98, 0x14, 0x44,
-    0x33, 0x7A, 0xD4, 0xD4, 0xF3, 0xAE, 0x86, 0x8C, 0xE6, 0x24, 0x12, 0xA0, 0x8D, 0x56, 0x44, 0xD7,
-    0x3E, 0xF2, 0x29, 0x2D, 0xB0, 0xC9, 0x4E, 0x11, 0x7A, 0x27, 0xA8, 0x1D, 0x64, 0x8D, 0xAA, 0x47,
-    0x8C, 0x13, 0x39, 0xA1, 0x8A, 0x4B, 0x81, 0xDA, 0xBE, 0xE0, 0x83, 0x64, 0xC4, 0xCE, 0x70, 0xF3,
-    0xD4, 0xB7, 0x16, 0x06, 0x9B, 0xA8, 0xB7, 0x7E, 0xD6, 0x78, 0x5C, 0x5B, 0xA5, 0xA7, 0x82, 0x9A,
-    0x23, 0x0F, 0xDF, 0x18, 0xFC, 0xAC, 0x61, 0x78, 0xD9, 0x2D, 0xB6, 0x35, 0x99, 0x58, 0x65, 0x13,
-    0x8D, 0x6C, 0x49, 0x8E, 0xD1, 0xD4, 0x97, 0x8D, 0x5F, 0x2B, 0x0F, 0xFE, 0xD0, 0xDF, 0x14, 0x23,
-    0xCC, 0x49, 0x53, 0xE3, 0x73, 0xBA, 0x3E, 0x43, 0xA2, 0x55, 0xA4, 0x80, 0x79, 0x1C, 0x19, 0x0B,
-    0x78, 0xFE, 0xA4, 0x4F, 0x4A, 0x21, 0x6C, 0x3E, 0xBC, 0xB0, 0x71, 0xF8, 0x9F, 0xF8, 0xE7, 0x8B,
-    0x75, 0x2C, 0x8B, 0xDB, 0x4D, 0x7C, 0xC4, 0x76, 0x69, 0xE2, 0x5E, 0x6A, 0xA7, 0x01, 0x90, 0x32,
-    0xBD, 0x65, 0x02, 0xD2, 0x48, 0xBB, 0xE6, 0x2B, 0x9C, 0x25, 0xF1, 0x37, 0xA9, 0x20, 0x0D, 0xFD,
-    0x7A, 0x40, 0xC6, 0x9B, 0x91, 0x4A, 0x2A, 0xA8, 0xE0, 0xD6, 0x9B, 0x35, 0x2A, 0x00, 0xAC, 0xE6,
-    0x25, 0xF5, 0xFC, 0x7D, 0x3A, 0x35, 0x72, 0x74, 0x56, 0x68, 0xAF, 0x2B, 0x93, 0x20, 0xA2, 0xD6,
-    0x5D, 0x68, 0x93, 0xBC, 0xA5, 0x05, 0x85, 0xC1, 0x7F, 0x22, 0xFC, 0x0F, 0x5D, 0x53, 0x3D, 0x4C,
-    0x14, 0x41, 0x14, 0xFE, 0x76, 0x86, 0x63, 0x61, 0x57, 0x18, 0x8B, 0x33, 0x41, 0xC3, 0x5F, 0x01,
-    0xE6, 0x30, 0xA7, 0x4B, 0x41, 0x94, 0xE2, 0x7E, 0x16, 0x88, 0x21, 0xD1, 0x18, 0xAF, 0xD0, 0x42,
-    0x0B, 0x25, 0x14, 0xA8, 0x54, 0x67, 0xA4, 0xA0, 0xB8, 0xC0, 0x40, 0x62, 0x6C, 0x2F, 0x56, 0x46,
-    0x2D, 0x2E, 0x16, 0x04, 0xAE, 0xF1, 0x0A, 0x0B, 0x62, 0x30, 0x37, 0x6A, 0x49, 0xE1, 0x52, 0xD9,
-    0x4E, 0x30, 0x56, 0x14, 0x0E, 0xE1, 0x8A, 0x33, 0x1E, 0x8C, 0x33, 0x77, 0x91, 0x20, 0x93, 0xDD,
-    0xF7, 0x66, 0xBE, 0x7D, 0x7F, 0xDF, 0x9B, 0xB7, 0xF3, 0x1B, 0xD5, 0xA3, 0x79, 0xFB, 0x96, 0x37,
-    0xAA, 0xFA, 0x70, 0xBE, 0xBC, 0xA6, 0xB5, 0x02, 0x30, 0x5F, 0x2E, 0x6F, 0x04, 0x5A, 0xEB, 0x08,
-    0xA7, 0x0F, 0xF9, 0xF3, 0xE2, 0x91, 0xF3, 0xD6, 0xCB, 0x8F, 0x88, 0x35, 0xF2, 0xCA, 0x9B, 0xB9,
-    0xC8, 0x5F, 0x93, 0xC7, 0x5D, 0xA5, 0xAB, 0x3C, 0x6A, 0xDA, 0x19, 0x33, 0x81, 0xE6, 0xAA, 0x6A,
-    0x7D, 0xA1, 0x5C, 0xE6, 0x71, 0xF6, 0x45, 0x15, 0xD8, 0x64, 0x31, 0xE6, 0xEE, 0xA8, 0x42, 0xC6,
-    0x0B, 0xAD, 0xDE, 0x32, 0xFA, 0x1F, 0x1E, 0x8F, 0xB3, 0x6F, 0xAB, 0x07, 0xAA, 0xB0, 0xC5, 0x1E,
-    0x92, 0x97, 0xC5, 0x58, 0xCC, 0xFD, 0xBE, 0xB3, 0x6F, 0x4E, 0x99, 0x8C, 0x77, 0xE3, 0xD8, 0x36,
-    0x9B, 0xF5, 0xB7, 0x3F, 0xEF, 0xAB, 0x74, 0xDA, 0x60, 0x10, 0x18, 0xC5, 0x19, 0x50, 0x34, 0x37,
-    0x5D, 0x39, 0xAD, 0xCF, 0x45, 0x18, 0x43, 0x17, 0x68, 0x88, 0x53, 0x1B, 0x12, 0xE2, 0xAC, 0xAD,
-    0x24, 0x32, 0xFB, 0x13, 0xE2, 0xE7, 0x94, 0x6E, 0xC4, 0x4F, 0x62, 0x0F, 0x72, 0x81, 0x46, 0x37,
-    0x20, 0x5B, 0xC2, 0x43, 0xD3, 0xCD, 0xB9, 0x1B, 0x1A, 0x58, 0x37, 0xA8, 0x56, 0x4C, 0x47, 0xCB,
-    0x7A, 0x52, 0x1F, 0x31, 0x5D, 0xCF, 0xEA, 0x7D, 0xCB, 0x30, 0xE1, 0xEF, 0xD6, 0x4B, 0x40, 0x4F,
-    0x3A, 0x63, 0x1F, 0xC2, 0x87, 0x6A, 0xCC, 0xF9, 0x21, 0xD3, 0xBE, 0x98, 0x35, 0xEC, 0x73, 0x39,
-    0xDA, 0x96, 0x4B, 0x0C, 0x87, 0xE2, 0x9E, 0x07, 0x95, 0xB7, 0xF5, 0x24, 0x6D, 0x1A, 0x1F, 0x78,
-    0x7A, 0x9D, 0x3E, 0xBF, 0xD3, 0x3B, 0x5C, 0x92, 0xEF, 0xB8, 0xC9, 0x70, 0xDC, 0x92, 0xFF, 0x48,
-    0xDB, 0x8A, 0x47, 0xC7, 0x13, 0xBE, 0x3B, 0xB5, 0x12, 0x49, 0x95, 0xE8, 0xE9, 0x6D, 0x76, 0xD3,
-    0x73, 0xA2, 0x24, 0xB5, 0xDF, 0x46, 0x4B, 0xA9, 0x4A, 0x5F, 0xAA, 0xBD, 0xAB, 0x89, 0x3A, 0x2B,
-    0x22, 0xBA, 0xDC, 0xC7, 0x50, 0xA9, 0x8C, 0xD1, 0xC9, 0x09, 0xDB, 0x78, 0x1A, 0x5E, 0x9B, 0x7A,
-    0x11, 0x62, 0x62, 0x67, 0x27, 0x2A, 0xB8, 0x62, 0xA1, 0x2D, 0x4C, 0x92, 0xA8, 0x8F, 0xDD, 0x9E,
-    0x0E, 0x8D, 0xEF, 0x0C, 0xB0, 0xC5, 0x26, 0x14, 0x95, 0xF5, 0x02, 0x18, 0x1F, 0x08, 0xB1, 0x44,
-    0x25, 0x9C, 0x5A, 0x03, 0x3D, 0xBE, 0x06, 0x8D, 0xB2, 0x62, 0x31, 0x43, 0x1B, 0x3E, 0x87, 0x56,
-    0xEB, 0x08, 0xDE, 0x0B, 0xF8, 0x4A, 0x83, 0x34, 0x68, 0x1D, 0xD5, 0x90, 0xC9, 0x40, 0xAA, 0x65,
-    0x8E, 0x01, 0x9B, 0xD4, 0x10, 0x77, 0x1C, 0x51, 0x49, 0xFA, 0x54, 0xA8, 0x14, 0xB3, 0x22, 0xE6,
-    0x4C, 0xA9, 0x46, 0xD6, 0xF6, 0xCD, 0x87, 0x5F, 0xA7, 0xBF, 0xD4, 0xE0, 0x1F, 0xCE, 0x52, 0x38,
-    0x10, 0x56, 0x70, 0xA6, 0x70, 0x88, 0x80, 0x13, 0x85, 0x00, 0x46, 0x8C, 0xD8, 0xCA, 0x33, 0x30,
-    0xB9, 0xB3, 0x70, 0x15, 0xEC, 0xF0, 0x81, 0xF0, 0x67, 0x6F, 0xA6, 0x6B, 0x36, 0x78, 0x88, 0xB9,
-    0x22, 0x52, 0xA0, 0x4F, 0x00, 0x8E, 0x5C, 0xC7, 0xFD, 0xB9, 0x4D, 0x46, 0xE4, 0xDE, 0xEC, 0x60,
-    0xAE, 0xAD, 0x35, 0x56, 0xE8, 0x84, 0x63, 0x6F, 0xDE, 0xB3, 0x03, 0x30, 0x0E, 0xD7, 0x76, 0x36,
-    0x09, 0x37, 0x34, 0x17, 0x97, 0x04, 0xE5, 0x2D, 0x9B, 0x40, 0xBA, 0xBF, 0xE9, 0x9E, 0xFA, 0xF8,
-    0xA9, 0x83, 0xEC, 0x86, 0x05, 0x50, 0x81, 0x0F, 0x60, 0x70, 0x22, 0x13, 0xD8, 0x87, 0x23, 0x8D,
-    0x62, 0x20, 0x91, 0x53, 0xC3, 0x12, 0x82, 0xD0, 0x95, 0xD8, 0x34, 0xC4, 0x88, 0x44, 0x01, 0x3E,
-    0x77, 0x14, 0xE2, 0x70, 0x5A, 0x61, 0x5A, 0x0E, 0x16, 0xBA, 0x84, 0xF6, 0x66, 0x68, 0x72, 0x04,
-    0x13, 0x37, 0xCE, 0xAF, 0x74, 0x83, 0x7E, 0xE5, 0x50, 0x26, 0xD4, 0x38, 0xFA, 0xBB, 0xC1, 0x5C,
-    0x3E, 0x30, 0x21, 0x03, 0xBE, 0xE8, 0xF3, 0x7E, 0x22, 0x7D, 0xBE, 0x49, 0x64, 0xC2, 0xC4, 0x41,
-    0xDC, 0x29, 0xB2, 0x70, 0xD3, 0x8D, 0x32, 0xA4, 0xDE, 0x74, 0x3F, 0x84, 0xBB, 0x27, 0x3B, 0x79,
-    0xDA, 0x85, 0xBB, 0x2A, 0x20, 0x2B, 0x58, 0x4C, 0x22, 0xC9, 0xD0, 0x4F, 0xC5, 0x00, 0x54, 0x16,
-    0x29, 0x06, 0xD3, 0x4F, 0xD3, 0x51, 0xA8, 0x21, 0x18, 0xC2, 0x31, 0xC2, 0x99, 0x50, 0x54, 0xA5,
-    0xD1, 0xB0, 0xEE, 0x39, 0x33, 0xAF, 0x86, 0x7C, 0xC2, 0x8E, 0x54, 0xDE, 0xBF, 0x89, 0x9A, 0xF4,
-    0x6E, 0x59, 0x20, 0x65, 0x89, 0xE7, 0xED, 0x80, 0x49, 0xF4, 0x2D, 0x92, 0x6D, 0x91, 0x5A, 0x37,
-    0xC0, 0x82, 0x21, 0x69, 0x01, 0x10, 0x61, 0x7E, 0x07, 0xB3, 0xFE, 0x02, 0x63, 0xE1, 0x70, 0x74,
-    0x4D, 0x2A, 0xEA, 0x3F, 0xE0, 0xC0, 0xC0, 0xD8, 0xB0, 0xA0, 0xA7, 0xBE, 0xE1, 0x80, 0x16, 0x07,
-    0x13, 0xC3, 0x0A, 0xA6, 0xFE, 0x0B, 0x0C, 0x6C, 0x1C, 0x4C, 0x13, 0x8F, 0x19, 0x76, 0x1F, 0x60,
-    0xD0, 0x72, 0x50, 0x90, 0xE0, 0x65, 0x66, 0x3C, 0x90, 0xC0, 0xC2, 0x11, 0x2C, 0x52, 0x63, 0x30,
-    0xA7, 0x70, 0x01, 0x2B, 0xC7, 0x54, 0x8E, 0xE3, 0x72, 0x07, 0x92, 0x3F, 0x30, 0x08, 0x30, 0xFF,
-    0xBF, 0x60, 0xC7, 0xCD, 0x7C, 0xC0, 0xC4, 0x86, 0xB9, 0xF9, 0x80, 0x85, 0x0D, 0xF3, 0xF1, 0x03,
-    0x36, 0x35, 0x40, 0xA2, 0x86, 0xD1, 0x41, 0xB1, 0xC9, 0x89, 0xA7, 0xD5, 0x38, 0xE3, 0xC0, 0xE2,
-    0x76, 0xEF, 0x3F, 0xDC, 0x17, 0x58, 0xB8, 0x19, 0x0E, 0x18, 0xF0, 0xB0, 0xB3, 0x7F, 0x91, 0x64,
-    0x99, 0x20, 0xC1, 0xCB, 0xCD, 0xEF, 0xFC, 0x43, 0x94, 0x21, 0x40, 0x44, 0x87, 0xB1, 0x65, 0xF1,
-    0x07, 0x98, 0xC5, 0x06, 0x5A, 0x2C, 0x8C, 0x40, 0x9B, 0xE3, 0x0F, 0x30, 0xB0, 0x79, 0x00, 0x6D,
-    0x4E, 0x38, 0x93, 0xF8, 0x41, 0xCB, 0x21, 0x41, 0x05, 0x62, 0x33, 0x93, 0x88, 0x61, 0xE3, 0x07,
-    0x83, 0xE3, 0x32, 0x52, 0x0C, 0x08, 0xBB, 0x0F, 0x68, 0x30, 0x33, 0x6C, 0xE0, 0x65, 0x3C, 0xA0,
-    0xC3, 0xDC, 0x60, 0xC2, 0xEC, 0x50, 0xC2, 0xEE, 0x00, 0x24, 0x2D, 0x98, 0x0F, 0xE8, 0x30, 0x5E,
-    0xE0, 0x67, 0xD8, 0xC0, 0xDE, 0x60, 0xC3, 0xE0, 0x60, 0xC2, 0x78, 0x80, 0x97, 0x61, 0x03, 0x50,
-    0x94, 0xE9, 0x80, 0x0C, 0xC3, 0x05, 0x3E, 0x86, 0x07, 0x7C, 0x0C, 0x17, 0xC0, 0x1A, 0x0E, 0x58,
-    0x70, 0x3B, 0x7C, 0x90, 0x63, 0x3E, 0x20, 0xC2, 0x00, 0x00, 0x4D, 0x93, 0x3D, 0x68, 0x1C, 0x47,
-    0x14, 0xC7, 0xFF, 0x3B, 0x23, 0x6B, 0x88, 0xC7, 0x77, 0xAB, 0x26, 0xC6, 0xD8, 0x67, 0xB6, 0x49,
-    0x21, 0xC8, 0x9D, 0x56, 0x01, 0x15, 0x82, 0xD8, 0xDA, 0x89, 0x1B, 0x97, 0x4E, 0x61, 0xD7, 0x22,
-    0x6D, 0x02, 0xC9, 0x06, 0x8E, 0xA0, 0x42, 0xB2, 0xC6, 0x38, 0xE0, 0x32, 0xAA, 0x63, 0x0C, 0x0E,
-    0x38, 0x85, 0xCE, 0x85, 0x6C, 0x70, 0x91, 0xC2, 0xF2, 0x3D, 0xD9, 0xC5, 0x41, 0x9C, 0x62, 0x83,
-    0x0D, 0x2E, 0xB3, 0x18, 0x85, 0x80, 0x15, 0x92, 0x0D, 0x39, 0xF0, 0x4A, 0xDE, 0xBB, 0xE7, 0xB7,
-    0x27, 0x39, 0xE4, 0xCD, 0x7B, 0x3B, 0x1F, 0x3B, 0x6F, 0xDF, 0xBC, 0xDF, 0xBC, 0x05, 0x00, 0xD3,
-    0x80, 0x3D, 0x81, 0x66, 0x1B, 0xE1, 0x08, 0xFD, 0x91, 0xAA, 0x52, 0x53, 0xDE, 0x0B, 0xBB, 0x79,
-    0x94, 0x66, 0x73, 0xF7, 0xA9, 0xF3, 0x92, 0x92, 0x67, 0x3E, 0x79, 0xE2, 0xE2, 0x17, 0x88, 0x78,
-    0x14, 0xF2, 0xC8, 0xF0, 0xC8, 0xF6, 0xF7, 0x65, 0x7B, 0x63, 0x11, 0xAD, 0x05, 0x4C, 0xCD, 0xA0,
-    0x16, 0x3B, 0xC2, 0xFA, 0x48, 0x0D, 0x61, 0x08, 0xA1, 0x43, 0x04, 0xCC, 0x89, 0x06, 0x7F, 0xCE,
-    0x05, 0x65, 0x12, 0x50, 0xFC, 0x98, 0x0E, 0x7D, 0x35, 0x4B, 0x88, 0x7D, 0x1C, 0xCA, 0xA7, 0x48,
-    0x4A, 0x9D, 0x75, 0x1B, 0xC0, 0x02, 0x82, 0x83, 0x3B, 0x96, 0x73, 0xED, 0xF1, 0xD5, 0x66, 0xC0,
-    0x15, 0xBA, 0x50, 0x19, 0xAE, 0x42, 0xF3, 0x8F, 0xE2, 0x24, 0x5B, 0x9D, 0xCA, 0x83, 0x5C, 0x17,
-    0x62, 0xA5, 0xCA, 0x75, 0x25, 0xF6, 0x97, 0xD8, 0x6F, 0x3A, 0x33, 0x4F, 0xAF, 0x67, 0xEB, 0xCC,
-    0x7C, 0xE6, 0x8F, 0xD7, 0xBF, 0xDB, 0x9D, 0x7F, 0x33, 0x4B, 0x6F, 0xC8, 0xD2, 0xBA, 0x58, 0x42,
-    0x21, 0x45, 0xA4, 0x79, 0x23, 0x38, 0x78, 0x84, 0xAE, 0x7E, 0xC2, 0x72, 0x6C, 0x7F, 0x5E, 0x65,
-    0x11, 0xFA, 0xEC, 0x62, 0x76, 0xD6, 0x43, 0xE5, 0x40, 0x09, 0x24, 0x40, 0x48, 0xD0, 0x05, 0x50,
-    0x01, 0xA7, 0x1D, 0x6A, 0x0E, 0xD0, 0x8A, 0x00, 0x9A, 0x07, 0xE6, 0xE5, 0x7C, 0x27, 0x2C, 0xE2,
-    0xEB, 0x4C, 0x1D, 0xC7, 0xF4, 0x1E, 0x92, 0x9F, 0x94, 0x6F, 0x1A, 0x5C, 0x35, 0xD7, 0xB2, 0xE9,
-    0x7F, 0xF2, 0x45, 0x9C, 0x5D, 0x89, 0x82, 0x9B, 0xCB, 0x86, 0xF8, 0xC5, 0x4E, 0x11, 0xE7, 0x0D,
-    0x68, 0x97, 0x61, 0xBE, 0x09, 0x83, 0xDB, 0x48, 0xED, 0xB4, 0xD5, 0xCC, 0xD5, 0x87, 0x5B, 0x7F,
-    0xFB, 0x8F, 0xCA, 0x4C, 0x7F, 0xF9, 0x0B, 0x3E, 0xBE, 0x45, 0xBA, 0xAC, 0x10, 0x5F, 0x22, 0x55,
-    0x94, 0x88, 0xAC, 0x0F, 0xF2, 0x2E, 0xDE, 0x97, 0x4B, 0xE0, 0x6C, 0x6A, 0x6D, 0xF9, 0x93, 0x81,
-    0x6B, 0xB7, 0x52, 0xEC, 0x0C, 0xA6, 0x1B, 0xAD, 0xF4, 0xDE, 0xAF, 0x03, 0x23, 0x5D, 0x1A, 0x0C,
-    0x0C, 0x5A, 0xE9, 0x79, 0x3D, 0x80, 0x90, 0x09, 0xB6, 0x08, 0x81, 0xC3, 0x71, 0x61, 0xE3, 0x8F,
-    0xED, 0xAA, 0xD7, 0xAE, 0xB3, 0x0D, 0x1A, 0x1A, 0x95, 0xB5, 0x2D, 0x56, 0xD6, 0xC0, 0x43, 0x6C,
-    0x6F, 0x5C, 0xB9, 0x72, 0x81, 0xC7, 0x13, 0xC4, 0x9F, 0x7B, 0xCB, 0x58, 0x9B, 0x92, 0x5C, 0xC2,
-    0x19, 0xCD, 0x05, 0x72, 0xE8, 0x6F, 0x03, 0x2E, 0x71, 0x0E, 0x28, 0xA0, 0x0A, 0x89, 0x4A, 0x86,
-    0x81, 0xCB, 0x5C, 0xCB, 0xB8, 0x5E, 0x16, 0x5D, 0x22, 0xF4, 0x9D, 0x91, 0x50, 0x93, 0x81, 0x96,
-    0xC1, 0x2A, 0x70, 0xA8, 0x6B, 0x00, 0xEF, 0xC2, 0xEC, 0x0D, 0x71, 0x16, 0xC5, 0xE9, 0xF1, 0xDD,
-    0xF2, 0x8B, 0x83, 0xAD, 0xDB, 0xD6, 0x3D, 0x44, 0xCC, 0x99, 0xD4, 0xCE, 0x84, 0xA8, 0x80, 0xC5,
-    0x12, 0x26, 0x30, 0x6B, 0xA6, 0x82, 0xB6, 0x26, 0x8C, 0xFA, 0xD4, 0x98, 0x05, 0x94, 0xC7, 0xB4,
-    0xDC, 0x34, 0xEF, 0xA1, 0x9A, 0x45, 0x74, 0xC1, 0xAB, 0x62, 0x16, 0x4B, 0xCA, 0xEB, 0xFC, 0x03,
-    0xE9, 0x9E, 0xAB, 0x3C, 0x1E, 0xC7, 0xEA, 0xE2, 0xCB, 0x62, 0x61, 0x31, 0x7C, 0x76, 0x91, 0x84,
-    0x9D, 0xF0, 0x23, 0xCB, 0x1B, 0x82, 0xB5, 0xAE, 0x93, 0x5A, 0x94, 0xCC, 0x42, 0x89, 0x37, 0x13,
-    0xC9, 0xA7, 0xA5, 0xD8, 0xD0, 0x91, 0xC5, 0x07, 0x56, 0x32, 0xF8, 0xBE, 0xD7, 0xDB, 0x9C, 0x6C,
-    0x60, 0xDE, 0x1B, 0xF7, 0x7A, 0xCB, 0xBB, 0x27, 0x91, 0x48, 0x5A, 0x89, 0xD4, 0xD0, 0x19, 0xCE,
-    0x27, 0xCE, 0x04, 0xB2, 0x65, 0xFC, 0xFC, 0x1C, 0x75, 0x27, 0x6D, 0x85, 0x96, 0xB2, 0xB8, 0x32,
-    0x23, 0x78, 0x3E, 0x42, 0x06, 0x71, 0xEE, 0x6D, 0x6F, 0x1E, 0xB1, 0xF8, 0x4F, 0x57, 0xFF, 0xA7,
-    0x42, 0x01, 0xFD, 0xB1, 0x40, 0xCD, 0xEA, 0x67, 0xDF, 0x09, 0x24, 0x0A, 0xB2, 0xA0, 0x90, 0x36,
-    0x94, 0x57, 0x39, 0x9A, 0xA7, 0xC0, 0x7E, 0xDD, 0x1F, 0x2F, 0x7C, 0x58, 0xA9, 0x7D, 0xF4, 0x15,
-    0x15, 0x0F, 0xC2, 0x6D, 0xEC, 0x1F, 0x95, 0xBD, 0x72, 0x68, 0x22, 0x60, 0x1F, 0xB2, 0xFB, 0xE6,
-    0x3B, 0xF5, 0x73, 0xDB, 0x9E, 0x4A, 0x67, 0x3F, 0xA3, 0x1F, 0x6E, 0xA8, 0x1B, 0x2D, 0xDB, 0x4A,
-    0xDB, 0x5F, 0x93, 0xFC, 0x18, 0x30, 0xAF, 0x86, 0x52, 0xB6, 0x64, 0x5C, 0x07, 0x5D, 0x45, 0xD6,
-    0xAD, 0x46, 0xCC, 0xD7, 0x98, 0xB3, 0x63, 0x25, 0xD4, 0xD6, 0x2B, 0xC9, 0xA9, 0x98, 0xA0, 0xAD,
-    0xF0, 0xAE, 0x7B, 0x0B, 0x4D, 0x90, 0xBF, 0x4F, 0x1B, 0x31, 0x14, 0xC7, 0x3F, 0x3E, 0x0F, 0x77,
-    0x22, 0x21, 0x84, 0xAA, 0x48, 0x0C, 0x17, 0x25, 0xA8, 0x0C, 0xA8, 0x0A, 0x22, 0x0C, 0xAD, 0xB2,
-    0x40, 0x8F, 0xBD, 0x42, 0x30, 0x30, 0xB1, 0x84, 0xFF, 0x20, 0x43, 0xB6, 0x22, 0x61, 0x51, 0x14,
-    0x06, 0xBA, 0x76, 0xAC, 0x94, 0x95, 0x2D, 0x43, 0x07, 0x36, 0x1C, 0x18, 0x90, 0x18, 0x2A, 0x03,
-    0xFF, 0xC0, 0x89, 0x3F, 0x20, 0xBA, 0xA1, 0x43, 0x24, 0x50, 0x8C, 0x6D, 0x18, 0xB0, 0xDE, 0x60,
-    0x7F, 0x7F, 0x3D, 0xBF, 0x87, 0x22, 0x86, 0x1E, 0x52, 0xB1, 0xB1, 0xB7, 0x6B, 0xED, 0xBD, 0xF6,
-    0x57, 0x5F, 0x84, 0xD3, 0x20, 0x2E, 0xF8, 0xF1, 0xB7, 0xF4, 0xBD, 0xD7, 0x6B, 0x75, 0xD1, 0x1E,
-    0x2E, 0x43, 0x0B, 0x77, 0x65, 0x19, 0x86, 0xA1, 0xF2, 0x85, 0xBD, 0x47, 0x6B, 0x35, 0x35, 0x30,
-    0x54, 0x60, 0x10, 0xAC, 0x41, 0xF4, 0xA6, 0x17, 0x7A, 0x74, 0xF5, 0x50, 0x13, 0x63, 0x23, 0x9E,
-    0x41, 0x39, 0x32, 0xC3, 0xA4, 0x98, 0x48, 0x0D, 0x68, 0x1F, 0x59, 0xBB, 0x4D, 0xA4, 0x4C, 0xA4,
-    0xCB, 0x42, 0x07, 0x67, 0xC6, 0x05, 0x63, 0xFD, 0x90, 0x56, 0x47, 0x2E, 0xA4, 0xEC, 0x32, 0x76,
-    0x74, 0x65, 0x5D, 0x4F, 0x75, 0x49, 0x3B, 0xEA, 0xF3, 0xB4, 0xFE, 0x3B, 0xCE, 0xC5, 0x3F, 0x3A,
-    0xF9, 0x4A, 0x65, 0x86, 0x9C, 0xE4, 0xDB, 0xB9, 0xD8, 0xD7, 0xB2, 0x90, 0xBF, 0xE4, 0x4F, 0xA9,
-    0xAE, 0xD5, 0x17, 0x45, 0xD5, 0x7D, 0x65, 0xCB, 0xB4, 0x9A, 0x69, 0x74, 0xC3, 0xA6, 0x92, 0xB9,
-    0xFD, 0xEF, 0x63, 0xC5, 0x47, 0x79, 0x1B, 0x8D, 0x46, 0x7A, 0xDD, 0xCC, 0x1A, 0x99, 0x63, 0x27,
-    0xAF, 0xBD, 0x44, 0x18, 0xB9, 0x04, 0x6B, 0x76, 0xDA, 0x85, 0x36, 0xCC, 0xD9, 0x69, 0xAC, 0x3C,
-    0xEE, 0x58, 0xE6, 0x1D, 0xD4, 0x65, 0xB3, 0xCE, 0x46, 0x7F, 0xD8, 0x5C, 0x3A, 0x4B, 0x93, 0xCE,
-    0x20, 0x5A, 0x84, 0x3E, 0x2C, 0x29, 0x92, 0x0E, 0x6F, 0x0F, 0x81, 0x4F, 0xF1, 0x9E, 0xE1, 0xA5,
-    0x4F, 0x76, 0x6B, 0x68, 0x5E, 0xBA, 0xBE, 0xC2, 0x04, 0xDC, 0xA9, 0xB3, 0x77, 0xEA, 0x60, 0x8D,
-    0xA3, 0xC5, 0xE5, 0xA2, 0xBF, 0x3A, 0x77, 0xF0, 0x87, 0xC9, 0x21, 0x95, 0x14, 0x4E, 0x5E, 0x97,
-    0x9E, 0x55, 0x49, 0xA5, 0x92, 0x2A, 0x75, 0xCB, 0x1D, 0xAE, 0x59, 0x7B, 0xEA, 0xE2, 0xDA, 0x44,
-    0xDA, 0xDA, 0x22, 0x56, 0x35, 0xCF, 0x79, 0x09, 0x1D, 0xE2, 0x9C, 0x5E, 0x51, 0xBA, 0xBA, 0xF8,
-    0x9A, 0x74, 0x93, 0x06, 0x0D, 0xC5, 0x31, 0x1F, 0x92, 0xF9, 0xE7, 0x4F, 0x77, 0xC5, 0x84, 0xA7,
-    0x8C, 0x30, 0xF5, 0x0B, 0x6D, 0x91, 0xBF, 0x6B, 0x14, 0x41, 0x14, 0xC7, 0x3F, 0xB3, 0x23, 0x19,
-    0x92, 0x8D, 0x6E, 0x0A, 0x09, 0xE2, 0x61, 0x0E, 0xAC, 0x2C, 0x4E, 0xAF, 0xDD, 0xE2, 0xEE, 0x32,
-    0x7F, 0x42, 0xCC, 0x3F, 0x92, 0x14, 0x5B, 0xA4, 0x08, 0xC9, 0x68, 0x9B, 0xE6, 0x1A, 0x7B, 0x11,
-    0x2B, 0x8B, 0x24, 0x48, 0x0A, 0x11, 0x73, 0xBB, 0x92, 0x42, 0xB0, 0xDA, 0xFC, 0x01, 0x81, 0x11,
-    0x03, 0x01, 0x09, 0xB8, 0xC2, 0x0A, 0x21, 0x5E, 0x76, 0x7C, 0x7B, 0x88, 0x55, 0x1E, 0xCC, 0x7B,
-    0x6F, 0xDE, 0xAF, 0xEF, 0xFB, 0x01, 0x50, 0x13, 0x15, 0x2C, 0x42, 0x71, 0x67, 0x31, 0xF9, 0x7D,
-    0xF2, 0xF9, 0x32, 0x8B, 0xF7, 0xC8, 0x0E, 0x8D, 0x39, 0xF5, 0xAB, 0x53, 0x26, 0x96, 0x96, 0xE6,
-    0x1A, 0x5B, 0xC6, 0x3F, 0x6E, 0x7C, 0x5C, 0x26, 0x5E, 0x97, 0xAA, 0x56, 0x15, 0x0D, 0x47, 0x5C,
-    0xB8, 0x21, 0xBE, 0x4A, 0xF0, 0x03, 0x5D, 0xF8, 0x84, 0x23, 0x6F, 0x5C, 0xDF, 0x6B, 0xAF, 0x9B,
-    0x83, 0x8A, 0x10, 0xA6, 0xFC, 0x94, 0xE7, 0x37, 0xAE, 0x58, 0xE2, 0x1F, 0x0D, 0x61, 0x07, 0xFE,
-    0xA0, 0x2E, 0x9C, 0x3E, 0x29, 0xCC, 0x0B, 0x9F, 0xD8, 0xAA, 0xCB, 0x87, 0x21, 0x83, 0x6D, 0x46,
-    0x93, 0x77, 0x79, 0x1E, 0x42, 0x1E, 0x7E, 0xF9, 0xAD, 0xBB, 0xDA, 0x95, 0xE9, 0x6D, 0x6C, 0x3E,
-    0xB2, 0xB7, 0x3B, 0x56, 0xCC, 0x9E, 0xE4, 0x36, 0x9B, 0x3C, 0x60, 0x81, 0xC8, 0x31, 0x66, 0xAC,
-    0xDD, 0x3D, 0x52, 0xF2, 0x26, 0x6F, 0x04, 0xF9, 0xFE, 0x6E, 0xCB, 0x55, 0x28, 0x18, 0x80, 0x96,
-    0xA9, 0x0E, 0x21, 0x11, 0x83, 0x87, 0xA7, 0x62, 0x28, 0x60, 0x1B, 0x95, 0x38, 0xB6, 0x6A, 0x74,
-    0x80, 0xAE, 0xD8, 0x6F, 0x20, 0xF6, 0xC7, 0xC9, 0xFE, 0xC7, 0x2F, 0xD4, 0x0F, 0x5D, 0x4F, 0xBF,
-    0x8E, 0x39, 0x33, 0xD7, 0xDF, 0xC3, 0x41, 0xD5, 0x7F, 0x59, 0xB7, 0x3E, 0xF4, 0x29, 0x64, 0xA2,
-    0x49, 0xE5, 0x6A, 0x56, 0x0E, 0x49, 0x7B, 0x24, 0x55, 0x4B, 0xE8, 0xD1, 0xEE, 0x75, 0x86, 0x26,
-    0x22, 0x05, 0x63, 0x59, 0xAB, 0x58, 0x0D, 0x44, 0xA1, 0x24, 0x7A, 0x2B, 0xB8, 0xA3, 0x51, 0xBB,
-    0x13, 0x11, 0xB1, 0x7B, 0xFC, 0xD5, 0xA4, 0xE9, 0x1B, 0xFB, 0x49, 0xFE, 0xD3, 0xB9, 0x41, 0xF6,
-    0xDE, 0x1E, 0xCF, 0xF6, 0xB5, 0x84, 0x86, 0x27, 0x72, 0x1B, 0x56, 0x9E, 0x87, 0x50, 0x48, 0xDF,
-    0x3D, 0xD4, 0xB7, 0x75, 0x51, 0x33, 0xB4, 0x6B, 0x31, 0x3C, 0xFF, 0xE9, 0x19, 0x6A, 0x82, 0xA9,
-    0xE9, 0x96, 0xF4, 0x2D, 0xB1, 0xCC, 0xDB, 0x69, 0x2C, 0x9D, 0xA9, 0x34, 0xA8, 0x64, 0xE0, 0x70,
-    0xBD, 0xC6, 0xF2, 0x7E, 0x1B, 0xA8, 0xC7, 0xB0, 0x6B, 0x51, 0x12, 0x61, 0xAE, 0x64, 0xD6, 0x82,
-    0x8D, 0xAA, 0x13, 0x5C, 0xFF, 0x9C, 0x85, 0xD9, 0xB9, 0xED, 0x72, 0x5E, 0xEF, 0xBC, 0x82, 0xBF,
+static const uint8_t opendyslexic_8_regularBitmaps[14940] = {
+    0x9D, 0x97, 0x51, 0x6C, 0x1C, 0xC7, 0x79, 0x80, 0xBF, 0xD9, 0x11, 0x39, 0x36, 0x57, 0xE4, 0xAA,
+    0x00, 0x0D, 0x38, 0x31, 0xC5, 0xF3, 0x83, 0x0B, 0xA8, 0x01, 0xC9, 0x15, 0x8A, 0x2B, 0x70, 0x69,
+    0xF6, 0x6E, 0x47, 0x16, 0x02, 0x15, 0x31, 0x8A, 0xBA, 0x40, 0xD2, 0x14, 0x48, 0x01, 0x19, 0x28,
+    0xD0, 0x07, 0x23, 0xA8, 0xEE, 0x81, 0x80, 0x99, 0x76, 0xA5, 0x1B, 0x49, 0x6D, 0x05, 0xD4, 0x6E,
+    0xC2, 0x1A, 0xC9, 0x4B, 0x9A, 0xC2, 0x7A, 0x28, 0xDA, 0x44, 0x4A, 0x2B, 0x3E, 0xF0, 0x81, 0x0F,
+    0x27, 0xDD, 0x48, 0x7C, 0xE0, 0x83, 0x8A, 0x7A, 0x24, 0xC3, 0x30, 0xD0, 0xA0, 0xCD, 0x26, 0x54,
+    0x1B, 0x54, 0xAA, 0xE1, 0xB1, 0xB4, 0xA9, 0x4F, 0xF2, 0xDE, 0x4D, 0x1F, 0x28, 0xC9, 0xB2, 0x5A,
+    0x09, 0xB6, 0x67, 0x7F, 0xCC, 0xEE, 0x0E, 0xE6, 0xFF, 0x67, 0xFE, 0x99, 0x7F, 0xFE, 0xFD, 0x56,
+    0x08, 0xBB, 0xB6, 0x10, 0x4B, 0xEB, 0xB3, 0x44, 0x5A, 0x9F, 0x4D, 0x88, 0x83, 0xBE, 0xCE, 0x99,
+    0x9D, 0x48, 0x5E, 0xDD, 0xBC, 0xEA, 0xFD, 0xB0, 0xDD, 0x99, 0x9A, 0xD2, 0xCC, 0x29, 0x88, 0x23,
+    0x8B, 0xB4, 0x1E, 0xCA, 0x16, 0x79, 0x08, 0xE1, 0xCB, 0x7F, 0xFC, 0x8D, 0xEF, 0x69, 0x75, 0xC0,
+    0x11, 0xB9, 0x65, 0x58, 0x5F, 0x64, 0xE2, 0xD8, 0xE1, 0xEF, 0x1D, 0x0A, 0x21, 0x78, 0x69, 0x3D,
+    0xC2, 0x67, 0x50, 0x24, 0x30, 0x21, 0x34, 0xA0, 0x89, 0x5E, 0x83, 0xDE, 0x90, 0x3C, 0xD8, 0x64,
+    0xE8, 0xB8, 0xF9, 0x1A, 0xC9, 0x3E, 0x4B, 0x78, 0x0D, 0x19, 0xAE, 0xA1, 0x82, 0x67, 0x5F, 0xB0,
+    0xD1, 0xB7, 0xC7, 0x13, 0xFB, 0xC2, 0xCF, 0x42, 0x18, 0xE5, 0x21, 0x9C, 0x08, 0xC1, 0xB0, 0xCF,
+    0x22, 0x7E, 0x0B, 0xD8, 0x05, 0xFB, 0x13, 0x73, 0x7A, 0xFF, 0x4B, 0x76, 0xFF, 0xAF, 0xEB, 0xFD,
+    0xAF, 0x90, 0xFE, 0x1B, 0x13, 0x4B, 0x25, 0xED, 0x39, 0xFE, 0x7B, 0xB7, 0xF8, 0xE7, 0xDD, 0xF2,
+    0x2B, 0xDF, 0x8C, 0x23, 0xFF, 0x24, 0x00, 0xA4, 0x25, 0xC9, 0xD7, 0x8D, 0xB0, 0x0B, 0xCC, 0x4B,
+    0xCB, 0x2F, 0x3D, 0xB2, 0x86, 0x9E, 0x21, 0xF9, 0x27, 0x22, 0xBF, 0x92, 0x75, 0xC4, 0x8D, 0x93,
+    0x5E, 0xF9, 0xF4, 0xED, 0x40, 0x08, 0x2B, 0x22, 0x18, 0x80, 0xD9, 0x4E, 0x3B, 0xCB, 0xB0, 0xFB,
+    0x24, 0x6B, 0xD3, 0xC2, 0x2E, 0x48, 0xD3, 0x94, 0x7A, 0x59, 0xE9, 0xA6, 0xD4, 0x2D, 0x69, 0x17,
+    0x84, 0x4B, 0x58, 0x53, 0x26, 0x43, 0x37, 0x85, 0x9D, 0x66, 0x4D, 0xEA, 0x56, 0x64, 0xE7, 0x70,
+    0x33, 0x94, 0x33, 0xB8, 0x69, 0x61, 0x17, 0xA4, 0x6D, 0xC5, 0xDA, 0xCF, 0x4B, 0x3B, 0x0B, 0x9A,
+    0x97, 0xD4, 0xEF, 0xAF, 0xF5, 0x9C, 0x2A, 0xE3, 0x57, 0x2E, 0xED, 0xDE, 0x23, 0xC1, 0x08, 0x2B,
+    0xAC, 0x70, 0x83, 0x20, 0xAC, 0xB0, 0xC2, 0xC2, 0x84, 0xBA, 0xE2, 0xFB, 0x9D, 0x29, 0xFD, 0xF2,
+    0x8F, 0x06, 0xE3, 0xA7, 0xDB, 0x1D, 0x30, 0xCC, 0x11, 0x19, 0x9A, 0x28, 0x58, 0x63, 0x06, 0x1C,
+    0x0B, 0xC8, 0x07, 0x1A, 0x84, 0x63, 0x01, 0x69, 0x69, 0x12, 0x83, 0x7F, 0xA0, 0xA1, 0x0B, 0x20,
+    0x56, 0xE5, 0x21, 0x69, 0xBA, 0x6E, 0xBA, 0xBB, 0xF9, 0xE3, 0xE6, 0x8D, 0xE9, 0xDF, 0xBC, 0x38,
+    0xB3, 0xA2, 0xDE, 0x38, 0xF4, 0x56, 0xF0, 0xBD, 0xA1, 0xAA, 0x80, 0x86, 0xF9, 0x92, 0x91, 0xF7,
+    0x2F, 0x65, 0x94, 0x79, 0xE6, 0xBB, 0x83, 0xD1, 0x60, 0x24, 0x74, 0x63, 0x3C, 0x79, 0xA0, 0x64,
+    0x81, 0x18, 0x69, 0xA3, 0x32, 0xF2, 0xB2, 0x52, 0x95, 0xBC, 0xFD, 0xBB, 0xA1, 0x1E, 0x04, 0x9D,
+    0x56, 0x4F, 0x28, 0x4D, 0x97, 0xDD, 0x28, 0xBE, 0xA1, 0x07, 0x9A, 0x82, 0x98, 0xE8, 0xEA, 0xF7,
+    0xDF, 0x0F, 0xD5, 0x91, 0x6B, 0x00, 0x33, 0xC4, 0x46, 0x95, 0xF2, 0xC7, 0xF2, 0x72, 0x74, 0xF5,
+    0x62, 0x59, 0x0D, 0xC2, 0x9F, 0x1F, 0x5E, 0x95, 0x8E, 0x8A, 0x36, 0x90, 0x84, 0x43, 0x08, 0x4B,
+    0x97, 0xC6, 0xED, 0x89, 0xDF, 0x73, 0x64, 0x24, 0xC8, 0xAD, 0xB3, 0xEF, 0x87, 0xAA, 0x57, 0xC2,
+    0x53, 0x22, 0x5C, 0x2C, 0x29, 0xE9, 0xB2, 0x14, 0x5E, 0x70, 0x37, 0xCB, 0x99, 0x65, 0xF9, 0xB7,
+    0x6C, 0x5F, 0xA9, 0x7A, 0xF5, 0xE4, 0x10, 0x48, 0x83, 0x15, 0x9E, 0x8C, 0x19, 0x94, 0x8E, 0x1C,
+    0x9E, 0x82, 0x94, 0xC4, 0xC8, 0x52, 0x54, 0x44, 0xD7, 0x84, 0x3B, 0xDD, 0x92, 0x52, 0x37, 0xB3,
+    0x58, 0xDC, 0x29, 0xE3, 0x5A, 0xBA, 0x6A, 0x59, 0x5E, 0xD6, 0xD9, 0x86, 0xDA, 0xFC, 0xB0, 0x8A,
+    0x6F, 0x13, 0x57, 0xF1, 0x0B, 0xA7, 0xB8, 0x69, 0xF7, 0xAE, 0xA9, 0x1F, 0x88, 0x6D, 0x33, 0x1C,
+    0x8C, 0xC5, 0x3F, 0x18, 0xAE, 0x1C, 0xA8, 0x42, 0x9D, 0x0F, 0x59, 0xEC, 0x74, 0x00, 0x16, 0x3B,
+    0x9D, 0x44, 0x5D, 0xF2, 0x00, 0x2F, 0x1E, 0x6D, 0xC4, 0x9B, 0xE5, 0xDF, 0xC1, 0x73, 0x44, 0x15,
+    0x3D, 0xAD, 0x2A, 0x7A, 0x9A, 0x0B, 0x9A, 0x74, 0x04, 0xBD, 0x21, 0xA2, 0x0F, 0xBB, 0xA0, 0x37,
+    0x7E, 0x0A, 0x60, 0xB6, 0x37, 0x86, 0xE7, 0x20, 0xD7, 0x4C, 0x0E, 0x21, 0x35, 0x44, 0x35, 0xA2,
+    0x16, 0x83, 0x6B, 0xBD, 0xDB, 0x5C, 0xE0, 0x6E, 0x19, 0x98, 0xCE, 0x20, 0x62, 0x03, 0x69, 0xC9,
+    0x90, 0x96, 0x15, 0x12, 0x94, 0x8B, 0x2A, 0x3A, 0x48, 0x47, 0x9B, 0xC8, 0x00, 0x62, 0x95, 0x45,
+    0x64, 0x79, 0x3F, 0x6A, 0xD5, 0xDB, 0xEB, 0x2C, 0xB3, 0x5F, 0x6A, 0x5E, 0x5A, 0x48, 0xAD, 0x2D,
+    0x4F, 0x4A, 0xF5, 0xE5, 0xDD, 0xBB, 0xE7, 0x9F, 0xEB, 0x76, 0x8B, 0x7C, 0x4B, 0x57, 0xBF, 0x52,
+    0x49, 0x0F, 0xAA, 0x9A, 0x44, 0x85, 0x9A, 0x28, 0x54, 0xF0, 0x35, 0x58, 0x82, 0xC4, 0xA2, 0x2A,
+    0xE4, 0xBF, 0xC0, 0xB6, 0x65, 0x7D, 0x99, 0x2C, 0x61, 0x5E, 0xBA, 0x58, 0xAF, 0x48, 0xD7, 0x10,
+    0x21, 0xB8, 0x10, 0xEA, 0x82, 0x46, 0x8A, 0x2C, 0xC3, 0x50, 0xBE, 0x7D, 0x3E, 0xA1, 0x95, 0xE1,
+    0xBD, 0x3A, 0x19, 0x86, 0xC9, 0xD9, 0x61, 0xC6, 0x86, 0xE7, 0x96, 0x95, 0x6F, 0x92, 0x76, 0xCE,
+    0xD5, 0x21, 0xBC, 0x15, 0x6E, 0x03, 0x10, 0x8F, 0xE8, 0x8D, 0xA2, 0x0A, 0x65, 0x49, 0x34, 0x0D,
+    0x58, 0x82, 0x45, 0x58, 0x82, 0x1C, 0x52, 0x4B, 0x63, 0x7C, 0x3E, 0x09, 0x23, 0x19, 0x46, 0x0C,
+    0x76, 0x14, 0xC8, 0x83, 0x49, 0x42, 0x2D, 0x6D, 0xC3, 0x7A, 0x86, 0x19, 0x49, 0x82, 0xDC, 0xB6,
+    0xF4, 0x3D, 0x69, 0x46, 0xFC, 0x26, 0xEA, 0xD6, 0xF5, 0x73, 0xC3, 0x10, 0xEA, 0x3C, 0xD4, 0x49,
+    0x28, 0x01, 0x15, 0xEA, 0xDE, 0xF8, 0x90, 0x66, 0x9D, 0x58, 0xB3, 0x4E, 0x1C, 0xEC, 0xA0, 0x8E,
+    0xEF, 0xBE, 0x86, 0xF0, 0x9D, 0x50, 0x87, 0x60, 0x21, 0x09, 0x9B, 0xFF, 0xF5, 0xA2, 0x67, 0x85,
+    0x79, 0x54, 0xB8, 0x12, 0xFC, 0x06, 0x4B, 0xC4, 0x26, 0x2A, 0xD9, 0xA0, 0x43, 0x62, 0x60, 0xE2,
+    0xBB, 0xA4, 0xC1, 0xC7, 0xD7, 0x04, 0x43, 0x48, 0x21, 0x2A, 0xA1, 0x03, 0xB2, 0x84, 0x0E, 0x83,
+    0x9F, 0x97, 0xA2, 0x97, 0x22, 0x8F, 0x8F, 0x28, 0x92, 0x10, 0x6C, 0x1E, 0x6A, 0x06, 0xB7, 0xD9,
+    0xC3, 0xEC, 0x0A, 0xD9, 0xC6, 0x5D, 0x69, 0xEF, 0x48, 0x9F, 0xF6, 0x20, 0x8C, 0x06, 0x61, 0x34,
+    0x08, 0xE3, 0x9A, 0x63, 0x35, 0x9D, 0x9A, 0x63, 0x35, 0xC7, 0xE8, 0x17, 0xF7, 0x4B, 0xBF, 0x7F,
+    0x1E, 0xA4, 0x4B, 0x74, 0x1B, 0x2F, 0x6D, 0x42, 0x86, 0x97, 0xB6, 0x41, 0x21, 0xBC, 0xB2, 0x4B,
+    0x62, 0x38, 0xD8, 0x1C, 0xC7, 0xAB, 0x2C, 0xC6, 0x76, 0xBD, 0x2D, 0x2F, 0x95, 0x49, 0x83, 0x6C,
+    0xC8, 0x07, 0x56, 0x8E, 0x48, 0x3C, 0x3D, 0x2B, 0x82, 0x55, 0xEF, 0x99, 0x34, 0x37, 0x1B, 0xF9,
+    0x89, 0x72, 0xF0, 0x1D, 0x13, 0x34, 0x24, 0x48, 0x2B, 0xCA, 0x1D, 0xF7, 0x8C, 0x28, 0xB9, 0xEB,
+    0x9E, 0xE3, 0xC2, 0xD9, 0x10, 0x42, 0xA8, 0x01, 0x6A, 0x1A, 0x07, 0x2B, 0x46, 0x89, 0x57, 0xC3,
+    0x9E, 0x4D, 0x7F, 0xF6, 0x9E, 0xF9, 0xF0, 0xD4, 0x39, 0xF5, 0xDE, 0xFC, 0xD1, 0x4E, 0xBF, 0x18,
+    0xDD, 0xBC, 0x79, 0x33, 0x5C, 0xBE, 0xBC, 0x39, 0xCE, 0xD3, 0xD8, 0xD7, 0xFD, 0xC6, 0xE6, 0x07,
+    0xBE, 0x9D, 0xFC, 0xD4, 0x92, 0x6B, 0xE0, 0x73, 0xCC, 0xE7, 0xCC, 0xE7, 0x66, 0x29, 0xB7, 0x4B,
+    0xB9, 0x5B, 0x6A, 0xFB, 0x76, 0x56, 0xB5, 0x8B, 0xA2, 0x5D, 0xB4, 0xDB, 0x45, 0xA3, 0xDD, 0x4F,
+    0xFA, 0x7D, 0x55, 0xF7, 0x65, 0x5D, 0x8B, 0x5A, 0x0C, 0x56, 0xA3, 0x3B, 0x17, 0xA2, 0x4A, 0xF9,
+    0x8A, 0xA3, 0x05, 0xC9, 0x3F, 0x22, 0x82, 0x26, 0xB7, 0x24, 0x15, 0xF2, 0x5D, 0xC4, 0x0D, 0xC7,
+    0x30, 0x9C, 0xAD, 0xD3, 0x10, 0xA2, 0x10, 0x78, 0x66, 0x0C, 0x90, 0x0F, 0xD5, 0xF5, 0x6A, 0x59,
+    0x6E, 0xE9, 0xC5, 0xE5, 0xE8, 0xB2, 0x2E, 0x06, 0xE1, 0xD5, 0xE0, 0x36, 0x88, 0x0D, 0x43, 0x12,
+    0x4B, 0xBD, 0x53, 0xC1, 0x53, 0x1A, 0x19, 0x1C, 0x47, 0x55, 0x29, 0xAD, 0x74, 0x4B, 0x48, 0xEB,
+    0x49, 0xA4, 0x65, 0xB1, 0x01, 0xEB, 0x05, 0x91, 0xF3, 0x24, 0x07, 0xDD, 0x6C, 0x96, 0x5C, 0x09,
+    0xBE, 0x11, 0x82, 0x4E, 0xC3, 0x90, 0x67, 0x42, 0x09, 0x69, 0x09, 0x79, 0xB9, 0x33, 0x12, 0xD7,
+    0xFB, 0x92, 0xE5, 0xDD, 0x94, 0x5D, 0x75, 0xFC, 0x3F, 0xCE, 0xAB, 0xE0, 0x1A, 0xC1, 0xF4, 0x93,
+    0xE7, 0x7D, 0x23, 0xB6, 0x59, 0x4A, 0x55, 0xAB, 0x6D, 0xDF, 0xB0, 0x62, 0x50, 0x46, 0xA1, 0xE6,
+    0x36, 0x14, 0x30, 0x0F, 0xCA, 0x41, 0xB8, 0x46, 0x1C, 0x1C, 0xCF, 0x8C, 0x21, 0xB5, 0xA8, 0xEA,
+    0x57, 0xD5, 0x28, 0x0D, 0xA1, 0x11, 0x42, 0xB4, 0x13, 0xE6, 0x21, 0x84, 0x10, 0xC6, 0x64, 0x3C,
+    0x2C, 0xC5, 0xC7, 0xE5, 0xE8, 0xCE, 0x3E, 0x1C, 0xDD, 0x91, 0x0D, 0x8A, 0x0D, 0x8A, 0x8D, 0x8F,
+    0x22, 0x28, 0x2B, 0x28, 0x8E, 0x89, 0x3A, 0x0F, 0xC3, 0x3C, 0x54, 0x71, 0x70, 0x3B, 0x07, 0x22,
+    0x36, 0x64, 0x05, 0xF1, 0x49, 0x47, 0xB5, 0x44, 0x43, 0x78, 0x59, 0x26, 0xFA, 0x28, 0x1B, 0xB1,
+    0x55, 0x76, 0x48, 0xBB, 0xA1, 0xE5, 0x2D, 0x4F, 0x63, 0x0C, 0xC1, 0x91, 0xD4, 0x30, 0x30, 0xAC,
+    0x43, 0xF4, 0x13, 0x03, 0x59, 0x01, 0x6A, 0xD3, 0xC2, 0x46, 0x5B, 0xF8, 0xE4, 0xF9, 0x32, 0xD7,
+    0xBE, 0xA1, 0xEA, 0x06, 0x3E, 0x5C, 0x2D, 0x93, 0xC3, 0x47, 0xDA, 0x7C, 0xF8, 0xFE, 0x07, 0x36,
+    0x1E, 0x27, 0x35, 0x3D, 0x3B, 0x30, 0x72, 0x28, 0x2B, 0x72, 0x9D, 0x03, 0xC4, 0x48, 0xEB, 0x23,
+    0xB7, 0x24, 0x4A, 0xE9, 0x3C, 0x45, 0x45, 0x3C, 0x84, 0x1A, 0x72, 0xC8, 0x3D, 0xE9, 0x31, 0x1A,
+    0xAF, 0xBA, 0xC4, 0xD6, 0xB1, 0x6B, 0x9C, 0x2A, 0xA3, 0x6A, 0x9D, 0x76, 0x46, 0xB1, 0x44, 0x95,
+    0x08, 0x1F, 0x6F, 0x3A, 0xF9, 0x13, 0x1B, 0x05, 0x4D, 0x80, 0xF3, 0xD0, 0x87, 0x3E, 0xD4, 0x50,
+    0x23, 0x6A, 0x92, 0x10, 0x0E, 0x86, 0x60, 0x9F, 0xFA, 0xBA, 0x47, 0x56, 0xC8, 0xE1, 0x3D, 0xA9,
+    0x1F, 0x90, 0x70, 0xE6, 0x87, 0x21, 0x84, 0x3C, 0x04, 0xF7, 0xF9, 0xD7, 0xC7, 0x0B, 0xD2, 0x66,
+    0xF7, 0xA4, 0x25, 0x4D, 0x4B, 0x99, 0x15, 0xA5, 0x97, 0x95, 0x5E, 0x8F, 0xF5, 0x5A, 0x5C, 0x0F,
+    0x2C, 0x4F, 0x70, 0x5A, 0xB1, 0x5F, 0x9A, 0x39, 0xDC, 0x0C, 0x6B, 0x4A, 0x67, 0x91, 0xDD, 0x8B,
+    0xDD, 0xF5, 0xF2, 0x0B, 0x95, 0x32, 0x2B, 0xD2, 0xB4, 0xA4, 0xB9, 0xAF, 0x9F, 0x45, 0x76, 0x21,
+    0xB2, 0x8B, 0x91, 0xDB, 0x2B, 0xDE, 0x1A, 0xE5, 0x25, 0xCC, 0xF0, 0xEE, 0x13, 0x4F, 0xBE, 0x7C,
+    0xE6, 0xEF, 0x43, 0xF0, 0xC0, 0x2C, 0x3E, 0x72, 0x40, 0xDE, 0x4D, 0xCE, 0x1D, 0xB4, 0xEB, 0x4D,
+    0x75, 0x88, 0x56, 0x57, 0x9E, 0xA2, 0xDF, 0x19, 0x5C, 0x0A, 0x75, 0xFC, 0x9F, 0x16, 0x94, 0xA5,
+    0x40, 0xDD, 0x4D, 0xC6, 0x9D, 0xB1, 0xBC, 0x5D, 0x74, 0xC4, 0x5B, 0x6E, 0x26, 0x63, 0xDB, 0xCD,
+    0xA7, 0x7F, 0x73, 0x31, 0x0C, 0xE3, 0x11, 0x00, 0x6A, 0x98, 0x7E, 0x35, 0x63, 0x99, 0x65, 0x96,
+    0x59, 0xA1, 0x43, 0x5A, 0x4F, 0x8E, 0x00, 0x1C, 0xD3, 0xF7, 0xAA, 0xF4, 0xB7, 0x93, 0xF1, 0x55,
+    0xDB, 0x6F, 0xCA, 0x2D, 0xB2, 0xAE, 0xDC, 0x32, 0x45, 0x3E, 0xB8, 0x18, 0xEA, 0xC9, 0xDB, 0x0E,
+    0xA2, 0x21, 0x55, 0x77, 0x5F, 0x74, 0xF2, 0xFB, 0x75, 0xEF, 0xFA, 0x29, 0x68, 0x21, 0xAB, 0xA7,
+    0x93, 0x60, 0xD3, 0x6B, 0xD0, 0x9B, 0xC1, 0x4D, 0xAB, 0x90, 0xBE, 0x58, 0xCE, 0x50, 0xCE, 0x88,
+    0xB2, 0x21, 0xBC, 0xDA, 0xDE, 0x0A, 0xB7, 0x8E, 0x8F, 0x6C, 0xA7, 0x1B, 0xFF, 0x20, 0xFA, 0x05,
+    0xC3, 0x3B, 0xE3, 0x46, 0x38, 0x7E, 0xDB, 0x51, 0xBD, 0xD8, 0xCF, 0xC7, 0xF1, 0x18, 0x98, 0x23,
+    0xB2, 0x2C, 0xEC, 0x54, 0xF2, 0x2F, 0x4D, 0x1E, 0x64, 0xB9, 0x92, 0xC9, 0x93, 0x76, 0xA1, 0x15,
+    0x6D, 0x9A, 0x85, 0x42, 0x6E, 0xD9, 0xAC, 0x90, 0x76, 0x5F, 0x51, 0xC0, 0x9E, 0x66, 0xB3, 0xD9,
+    0x6C, 0xB6, 0x5A, 0xAD, 0x82, 0x75, 0xE9, 0xA6, 0x34, 0x20, 0xAC, 0x62, 0x8E, 0xAE, 0xB0, 0x31,
+    0x0B, 0xAC, 0x45, 0x76, 0x8A, 0x56, 0x54, 0x86, 0x68, 0x15, 0xEE, 0x7F, 0x96, 0x5A, 0xC8, 0xBF,
+    0xD0, 0x2D, 0x2F, 0xFB, 0xE4, 0x5A, 0x56, 0xFC, 0xA9, 0x53, 0x6F, 0xE8, 0x95, 0xF3, 0xEA, 0xC4,
+    0x70, 0x76, 0x46, 0x1A, 0xB7, 0xBC, 0x57, 0x09, 0xBB, 0xB6, 0x10, 0x47, 0x76, 0x90, 0xBA, 0xB9,
+    0x0B, 0xB1, 0x1B, 0x5C, 0xF8, 0xF0, 0x92, 0xCF, 0xE5, 0xEF, 0xE8, 0x8D, 0xA9, 0x4C, 0xB8, 0x96,
+    0x8F, 0xB9, 0x65, 0x33, 0xF9, 0x26, 0x3E, 0x29, 0xA4, 0x6D, 0x97, 0xF3, 0x78, 0xF6, 0xC8, 0xE0,
+    0x3A, 0xB1, 0xB4, 0xCD, 0x4C, 0x9E, 0xB4, 0xAD, 0x6C, 0x67, 0x8A, 0x5B, 0xB6, 0x98, 0x1C, 0x8A,
+    0x3B, 0xBE, 0x25, 0x4F, 0xEA, 0x85, 0xAE, 0xD8, 0xD2, 0x73, 0xAD, 0x68, 0xF3, 0xFA, 0xB0, 0x11,
+    0x38, 0x62, 0x9E, 0x58, 0xE2, 0x4B, 0x37, 0x74, 0x1D, 0x4B, 0x37, 0x97, 0xB0, 0x3F, 0xC3, 0x0D,
+    0x95, 0xBC, 0x5D, 0x24, 0xC1, 0x7D, 0x6B, 0x1C, 0x39, 0x12, 0xC8, 0xC0, 0xEF, 0x9C, 0xA7, 0x17,
+    0x75, 0x32, 0x72, 0x0B, 0xB1, 0x6D, 0x2A, 0xDB, 0x95, 0xB6, 0xAB, 0x6C, 0x37, 0xB6, 0xED, 0x23,
+    0xB6, 0x11, 0xAC, 0xFA, 0x1F, 0x83, 0xFC, 0x33, 0x64, 0x8D, 0xAC, 0x10, 0x2C, 0xFA, 0xC1, 0xD5,
+    0x32, 0xD1, 0x19, 0x5E, 0xDA, 0x44, 0x1F, 0x45, 0x8D, 0xD4, 0xD7, 0x22, 0xC3, 0x3A, 0x49, 0xC9,
+    0xC0, 0xE0, 0xBF, 0x78, 0x34, 0x0F, 0x71, 0xD0, 0x10, 0x19, 0x69, 0x94, 0xC9, 0x6B, 0xA5, 0x95,
+    0x56, 0x3A, 0xD6, 0xB1, 0x8E, 0x4D, 0x5C, 0xC7, 0x75, 0x57, 0xFE, 0x01, 0xEF, 0xE8, 0x6F, 0xB9,
+    0xF9, 0xA6, 0xFA, 0xB6, 0xD8, 0xB6, 0x1B, 0x61, 0x9C, 0x86, 0x13, 0x43, 0x0F, 0x38, 0x71, 0xC9,
+    0xCE, 0x28, 0xB3, 0x9C, 0x48, 0x3B, 0xBF, 0x97, 0xCC, 0xD3, 0x33, 0x8C, 0x90, 0x1E, 0x60, 0x1E,
+    0xB1, 0x6D, 0x59, 0xF7, 0xCF, 0x66, 0x8B, 0x69, 0xA2, 0xDE, 0xF8, 0x85, 0x09, 0xC1, 0xA5, 0xEF,
+    0x79, 0x75, 0xB3, 0xA6, 0xEA, 0x90, 0x88, 0x72, 0x3E, 0x61, 0xD1, 0x93, 0x1B, 0xFA, 0xC8, 0x8A,
+    0x8E, 0x8F, 0x6E, 0x96, 0x0D, 0xE9, 0xAA, 0xD8, 0x36, 0xC5, 0x5B, 0x76, 0x61, 0x5E, 0x5A, 0xDF,
+    0x52, 0xAF, 0xEA, 0xCC, 0x8B, 0x40, 0x52, 0x72, 0x0C, 0xE5, 0x28, 0x68, 0x98, 0xDC, 0xCB, 0x21,
+    0x40, 0x12, 0xEC, 0x99, 0x9A, 0x04, 0xE9, 0x18, 0xD2, 0x21, 0xB1, 0x91, 0x27, 0x0F, 0x2A, 0x0C,
+    0x21, 0xAA, 0x95, 0x89, 0x75, 0xAC, 0x63, 0x12, 0xCE, 0xD3, 0x67, 0x86, 0xE4, 0xEE, 0x15, 0x7B,
+    0x71, 0xFA, 0x95, 0x57, 0x5E, 0xF9, 0xA3, 0x97, 0xCF, 0x9C, 0x01, 0x06, 0x28, 0x23, 0xAD, 0xB4,
+    0xD2, 0x46, 0x96, 0x9A, 0xBE, 0x28, 0x23, 0x17, 0xB9, 0xC8, 0x49, 0x97, 0xDB, 0x2F, 0xB0, 0xBC,
+    0xF8, 0xFA, 0x25, 0x07, 0x07, 0xC4, 0x95, 0x8B, 0x57, 0xAF, 0x5C, 0xB5, 0xC5, 0x86, 0xBA, 0x6C,
+    0x96, 0xD7, 0x76, 0xED, 0xD2, 0x66, 0x21, 0x8B, 0xAE, 0xDA, 0xBD, 0x0B, 0xC9, 0xE1, 0xE4, 0xB0,
+    0x7A, 0x81, 0x03, 0x08, 0x03, 0x8B, 0x10, 0xB9, 0x7B, 0xC0, 0x13, 0x1B, 0xA4, 0x47, 0x8C, 0xE0,
+    0x96, 0xA1, 0xE5, 0x59, 0xDC, 0x4B, 0x22, 0xAD, 0x32, 0x55, 0xE4, 0xE6, 0xA9, 0x94, 0xED, 0x85,
+    0x2A, 0x0F, 0xA1, 0x81, 0xBA, 0x6C, 0x19, 0x22, 0x21, 0x32, 0xE0, 0x60, 0x0F, 0x1F, 0x2F, 0x9F,
+    0x0A, 0x67, 0x00, 0x14, 0xA8, 0x35, 0x26, 0xD5, 0x3D, 0x03, 0x51, 0x09, 0x35, 0xF4, 0x34, 0x59,
+    0xC9, 0x4C, 0x46, 0x7C, 0x48, 0x4B, 0xEB, 0x45, 0xD9, 0x66, 0x5D, 0x99, 0xB6, 0xF0, 0x8D, 0x30,
+    0x4A, 0x42, 0xD8, 0xB2, 0xE2, 0xA6, 0xA7, 0x13, 0x39, 0x4F, 0x55, 0xF0, 0x6B, 0x9F, 0xFF, 0x6C,
+    0x6E, 0x7C, 0x5A, 0x4C, 0x8A, 0x20, 0x3A, 0x0D, 0xCF, 0x22, 0xCD, 0x2E, 0x58, 0x46, 0xEC, 0xB0,
+    0xDF, 0x27, 0x03, 0x21, 0xA4, 0xA6, 0xCB, 0xCC, 0x03, 0x6B, 0xD5, 0x0B, 0x5B, 0xE1, 0xDA, 0x32,
+    0xF7, 0xBA, 0x0E, 0xEA, 0x38, 0xD8, 0xBB, 0x36, 0x92, 0x30, 0x0C, 0xE1, 0xCD, 0x50, 0xE3, 0x48,
+    0xF5, 0x93, 0xD3, 0xB0, 0xE7, 0x93, 0x0D, 0x33, 0x35, 0x29, 0x7C, 0x95, 0x26, 0xE6, 0x93, 0x4E,
+    0xEB, 0xD9, 0xC8, 0xC5, 0x1A, 0x20, 0xB6, 0x85, 0xFA, 0x98, 0xF4, 0x63, 0x7B, 0x7E, 0xD7, 0xEE,
+    0x7D, 0x4D, 0x00, 0x56, 0x1E, 0x22, 0xA8, 0x39, 0xEA, 0xB9, 0xB9, 0x9D, 0xED, 0xF2, 0xEA, 0x1E,
+    0x3F, 0xDD, 0xBF, 0xF5, 0x23, 0x1F, 0xBB, 0xC5, 0x24, 0x39, 0x74, 0xE9, 0xAF, 0x4F, 0xDF, 0x75,
+    0x35, 0x45, 0x59, 0xE1, 0x29, 0x68, 0x3C, 0xF4, 0xD0, 0x27, 0x25, 0x76, 0x54, 0xAB, 0xE2, 0x35,
+    0x23, 0x4E, 0xD9, 0x87, 0xA9, 0xA7, 0x7C, 0x1C, 0xF5, 0xB0, 0x0A, 0xF3, 0x20, 0x4E, 0x03, 0x7C,
+    0x16, 0x04, 0x42, 0x82, 0xB0, 0x50, 0x7E, 0x3C, 0x8E, 0x27, 0xC7, 0x3A, 0xBE, 0x3E, 0x8C, 0x5D,
+    0x63, 0xD3, 0x89, 0x5F, 0x7A, 0x3A, 0xEB, 0xA8, 0x11, 0x04, 0xC8, 0x1D, 0xC9, 0x3A, 0xEA, 0x9C,
+    0x96, 0xDB, 0xE3, 0x73, 0x7E, 0x10, 0xEA, 0x38, 0xD4, 0x1C, 0x19, 0xDE, 0xD3, 0x53, 0x1A, 0xB5,
+    0xCE, 0x64, 0xA4, 0x01, 0x8E, 0x5C, 0xE3, 0xC2, 0x39, 0x73, 0x5E, 0xD4, 0x6D, 0x1A, 0x87, 0x91,
+    0x37, 0x34, 0x3D, 0x47, 0xE2, 0x91, 0x23, 0xF8, 0x50, 0xF3, 0x27, 0x15, 0x9D, 0xFC, 0x7A, 0x88,
+    0x43, 0xB0, 0x83, 0x60, 0x27, 0x77, 0xFE, 0x62, 0x85, 0xF3, 0x6C, 0x64, 0x7C, 0x61, 0xEA, 0xB3,
+    0x3A, 0x24, 0x0D, 0x78, 0x78, 0xFA, 0xEE, 0x84, 0x3E, 0x1D, 0xF0, 0x4C, 0xC3, 0x1C, 0xB4, 0x1E,
+    0x3E, 0xD3, 0x9F, 0xCE, 0xC8, 0x1E, 0x58, 0x41, 0xFC, 0x3B, 0x91, 0xD0, 0x9F, 0x41, 0x5D, 0x9D,
+    0xB4, 0xF1, 0xA6, 0x9B, 0x3A, 0xB1, 0xFA, 0x19, 0x74, 0x77, 0xC1, 0x3A, 0x51, 0x09, 0xC8, 0x0F,
+    0xB8, 0x53, 0x65, 0xF1, 0x41, 0xBD, 0xDC, 0x95, 0xA7, 0x68, 0x75, 0xE3, 0xCD, 0x1B, 0x75, 0x1A,
+    0xEC, 0x85, 0x6F, 0xEE, 0xEC, 0xF8, 0x69, 0xA6, 0xEF, 0x3B, 0xF7, 0x18, 0xE4, 0x60, 0x1A, 0xE9,
+    0xB9, 0x62, 0x1F, 0xD7, 0xEB, 0x73, 0x53, 0x51, 0xE9, 0x3B, 0x8D, 0xC7, 0x8F, 0xF9, 0x7F, 0x99,
+    0x44, 0x8D, 0x58, 0x65, 0x96, 0x59, 0x51, 0x3E, 0x98, 0x46, 0x78, 0x2C, 0x80, 0xEC, 0xA4, 0x8F,
+    0xE4, 0xE3, 0xD9, 0x36, 0x35, 0xC9, 0xA1, 0xC8, 0xEC, 0xFB, 0xE2, 0xB9, 0xAD, 0xF1, 0x0F, 0xBB,
+    0x48, 0x43, 0x7E, 0xC0, 0x84, 0x3A, 0x1A, 0x6B, 0x56, 0x49, 0x99, 0x9C, 0x43, 0xEF, 0x79, 0xBC,
+    0xDD, 0x07, 0xF3, 0xC5, 0xE3, 0xFA, 0x3D, 0x27, 0x4A, 0x65, 0x80, 0xA6, 0xD4, 0x4D, 0xA9, 0x9B,
+    0xD2, 0xB4, 0xA4, 0x29, 0x98, 0x9E, 0x6B, 0x01, 0x7C, 0x84, 0x2E, 0x4C, 0xF3, 0xEE, 0xF4, 0x34,
+    0x40, 0x13, 0x27, 0xF5, 0x34, 0x4D, 0x4A, 0x69, 0x66, 0x28, 0x58, 0x4C, 0x92, 0x53, 0xF7, 0xD2,
+    0x41, 0x93, 0x69, 0xA4, 0xC6, 0xD1, 0x64, 0x06, 0x69, 0x28, 0x29, 0x90, 0x97, 0xF8, 0xC3, 0xFD,
+    0x13, 0xF3, 0xC0, 0x23, 0x11, 0xE4, 0xA1, 0xB5, 0x7A, 0x24, 0x91, 0xFC, 0x7F, 0xA9, 0x16, 0x38,
+    0x62, 0x1A, 0xE7, 0xA4, 0x69, 0x35, 0xA3, 0x2D, 0xE6, 0x96, 0xC5, 0xA6, 0x59, 0xE8, 0x9C, 0x3B,
+    0x1E, 0xFC, 0xE4, 0x10, 0x1C, 0x29, 0x53, 0xBB, 0xEF, 0xC5, 0xFD, 0x23, 0xED, 0x3E, 0xB4, 0x56,
+    0x8F, 0x19, 0x5F, 0x1A, 0x32, 0xD0, 0x30, 0xC7, 0x3B, 0xFC, 0x86, 0x9B, 0x5F, 0x56, 0x7F, 0x25,
+    0xB6, 0xCD, 0x8A, 0x5F, 0xCA, 0xC3, 0xAB, 0xA1, 0xBC, 0x90, 0xB1, 0x87, 0x39, 0x66, 0x50, 0x1F,
+    0x4D, 0xEE, 0x51, 0xC0, 0x62, 0x18, 0x72, 0xD5, 0xE8, 0x3D, 0x8F, 0x34, 0xF5, 0xF4, 0x54, 0x72,
+    0x68, 0xF3, 0xE7, 0x1E, 0x1E, 0xD9, 0x43, 0x0C, 0xFE, 0x35, 0xF8, 0xF4, 0x6C, 0x08, 0x97, 0x2A,
+    0xE9, 0x49, 0xB4, 0x72, 0xF4, 0x49, 0x4C, 0xE4, 0xC8, 0x49, 0x34, 0xA1, 0xCA, 0x50, 0xC1, 0x55,
+    0x34, 0x6C, 0x54, 0x72, 0x8C, 0xD8, 0x89, 0x21, 0xC9, 0x9D, 0x81, 0x23, 0x0D, 0x21, 0xF8, 0x34,
+    0x84, 0xE0, 0x9E, 0x09, 0x21, 0x68, 0x00, 0x71, 0x41, 0x0E, 0xC5, 0x9D, 0x0F, 0x8E, 0xDB, 0x32,
+    0x31, 0xFB, 0x9A, 0xD1, 0xF5, 0xC1, 0x1C, 0xBD, 0x33, 0x87, 0xF4, 0x02, 0x94, 0xB1, 0xA1, 0x73,
+    0x76, 0x34, 0xA1, 0xC2, 0x4F, 0x83, 0x39, 0x62, 0x06, 0xAB, 0xF7, 0xE9, 0xFE, 0xE5, 0x33, 0x67,
+    0x7E, 0x94, 0x86, 0xB0, 0x93, 0x1E, 0x66, 0x93, 0x4B, 0xBE, 0x48, 0x9E, 0x5F, 0x9D, 0x50, 0x57,
+    0x7C, 0xD1, 0x99, 0xD2, 0xB3, 0xB3, 0xC9, 0x9B, 0x27, 0x6E, 0xF9, 0xA2, 0x9F, 0x1C, 0x8E, 0x5E,
+    0x5F, 0x9D, 0x98, 0x50, 0xEF, 0x5C, 0x79, 0xDF, 0x17, 0xFD, 0x4E, 0x67, 0xEA, 0x2B, 0xFA, 0xE9,
+    0xC8, 0x3C, 0x57, 0x25, 0x62, 0xBB, 0x6C, 0xC7, 0xF6, 0x7F, 0x01, 0x7D, 0x95, 0x41, 0x88, 0x14,
+    0xD9, 0x19, 0xC7, 0x7F, 0x55, 0x6F, 0xB5, 0x76, 0x2D, 0xA7, 0xDF, 0x1E, 0x3C, 0x48, 0xB6, 0x9D,
+    0xBE, 0xEC, 0x61, 0x42, 0x7A, 0xA6, 0x3D, 0x0C, 0x61, 0xD8, 0xAD, 0x9E, 0x2A, 0xB3, 0x10, 0x0F,
+    0x26, 0xD9, 0x25, 0x44, 0x72, 0x48, 0xB2, 0xEB, 0x21, 0xC7, 0xC0, 0xB6, 0xA4, 0xC9, 0x76, 0x62,
+    0xD9, 0x5D, 0xB3, 0x73, 0xF0, 0x20, 0x64, 0x25, 0x4B, 0x72, 0x08, 0x39, 0x78, 0x4B, 0x50, 0x77,
+    0xAD, 0xDD, 0x74, 0xA0, 0x31, 0xA3, 0xF5, 0x74, 0x02, 0x42, 0x06, 0x76, 0xCB, 0x48, 0x10, 0x22,
+    0x2C, 0x65, 0x14, 0x05, 0x67, 0x8D, 0xA5, 0x56, 0xB0, 0x1C, 0xAB, 0xFB, 0xCB, 0x61, 0x34, 0x31,
+    0x4B, 0x08, 0xEF, 0xF7, 0xFE, 0x3C, 0x1E, 0xFC, 0xE1, 0x7B, 0xBC, 0xEF, 0xFF, 0xDE, 0xCE, 0xE7,
+    0x5D, 0x05, 0x40, 0x22, 0xB3, 0xFB, 0xF7, 0x61, 0x1B, 0x62, 0x5A, 0xB2, 0xB6, 0xFF, 0xDB, 0x86,
+    0x98, 0xB9, 0x13, 0x47, 0xE5, 0xBE, 0x54, 0xCC, 0x81, 0x36, 0x38, 0x05, 0xEA, 0x13, 0xB8, 0x6E,
+    0x18, 0x76, 0xF1, 0x34, 0xD3, 0x2A, 0x75, 0x83, 0x9E, 0x4A, 0x1B, 0x96, 0x48, 0x2A, 0x52, 0x85,
+    0x34, 0x5A, 0xA8, 0x0C, 0x5A, 0x72, 0x35, 0xB0, 0x53, 0x86, 0xEC, 0xC2, 0x91, 0xA5, 0xB4, 0xD9,
+    0x55, 0x6F, 0x72, 0xEB, 0x57, 0x85, 0x54, 0x7E, 0x09, 0xB8, 0x12, 0xC5, 0x35, 0x97, 0x4E, 0xEC,
+    0xB8, 0x64, 0x49, 0xE9, 0xEE, 0xCF, 0x63, 0xB5, 0x86, 0xF7, 0x87, 0xB7, 0xD6, 0xA4, 0x48, 0x1E,
+    0x31, 0x90, 0x37, 0xF7, 0xEF, 0xDD, 0xB4, 0xCF, 0xE1, 0x46, 0x76, 0xC6, 0x88, 0x39, 0x5C, 0x63,
+    0xE7, 0x28, 0xC9, 0xD5, 0x5F, 0x73, 0x15, 0xC5, 0xFF, 0x21, 0x88, 0x55, 0x10, 0x3B, 0xC1, 0x50,
+    0x33, 0x1C, 0xC8, 0x78, 0x20, 0xE3, 0x05, 0x9A, 0x33, 0xCC, 0xFC, 0x9F, 0xC3, 0xE8, 0xA5, 0xBC,
+    0x8D, 0xA7, 0x1D, 0x63, 0xE7, 0x79, 0x81, 0x7E, 0xBD, 0x05, 0x87, 0x1F, 0x18, 0x94, 0x94, 0xD0,
+    0x10, 0x40, 0x32, 0xD0, 0x13, 0x36, 0x77, 0x12, 0x49, 0x69, 0x89, 0x04, 0xEE, 0xC3, 0x8D, 0xB1,
+    0x35, 0xF1, 0x3F, 0xCD, 0x07, 0xAB, 0x95, 0x6F, 0xB6, 0x04, 0x0D, 0xB1, 0xAC, 0x8C, 0x26, 0xDA,
+    0xFA, 0x5E, 0x20, 0x11, 0x3D, 0x1C, 0xEC, 0xBF, 0x7D, 0xFD, 0xBE, 0x94, 0x6F, 0x17, 0x00, 0x05,
+    0x3F, 0x2C, 0xA8, 0x86, 0x76, 0x35, 0x52, 0xD5, 0xC8, 0xAD, 0x46, 0x3A, 0x0C, 0x5B, 0x5E, 0xD8,
+    0x6E, 0x87, 0x61, 0x3B, 0x2C, 0xDA, 0xFD, 0x7C, 0xD1, 0x4F, 0x17, 0x7D, 0xD3, 0xF7, 0x83, 0xFE,
+    0x94, 0x62, 0xCA, 0xC1, 0xA9, 0xE0, 0x18, 0xC0, 0x8B, 0xFF, 0xD3, 0x3B, 0xFD, 0xAC, 0xB7, 0xFD,
+    0x6F, 0xEF, 0xAC, 0x6B, 0x86, 0x6D, 0x75, 0x21, 0xD3, 0x0D, 0xBC, 0x92, 0x87, 0x46, 0x8D, 0xD1,
+    0x39, 0x03, 0x63, 0x89, 0x71, 0xEE, 0x46, 0x2D, 0x3F, 0x1A, 0xF9, 0xEF, 0x66, 0xC9, 0x7B, 0x91,
+    0x04, 0x8E, 0x64, 0xFD, 0x0F, 0x9D, 0x28, 0xEB, 0xD5, 0x9C, 0x28, 0xEB, 0xD6, 0x9C, 0x3D, 0xD9,
+    0x70, 0xDA, 0xB5, 0xB2, 0x7C, 0x5A, 0x5B, 0xD7, 0xF3, 0xE9, 0x1D, 0x10, 0xB2, 0xD8, 0xA7, 0x7F,
+    0x88, 0x7F, 0xBC, 0xB3, 0xF4, 0xD9, 0xEF, 0x57, 0x3F, 0xF9, 0xF8, 0xF2, 0xCF, 0xE3, 0xC7, 0xDF,
+    0x1A, 0x4A, 0x6D, 0xD8, 0xAF, 0x0D, 0xBD, 0xDA, 0x90, 0xE9, 0x21, 0x8D, 0x17, 0xD9, 0xD1, 0xC3,
+    0x1B, 0x3D, 0xA1, 0xBD, 0xC9, 0x0A, 0xED, 0x44, 0xC6, 0x89, 0x8C, 0x13, 0x99, 0x54, 0xF4, 0x2B,
+    0x16, 0x2B, 0xFA, 0x15, 0x7D, 0x2B, 0x39, 0x66, 0x6F, 0x9C, 0xB3, 0x0B, 0x27, 0x2F, 0x38, 0x1C,
+    0xA2, 0x3F, 0xC0, 0x92, 0x00, 0xDF, 0xA0, 0x0B, 0xD4, 0x1D, 0xAC, 0xF5, 0x94, 0x52, 0x4E, 0x56,
+    0x2D, 0x11, 0x5B, 0x84, 0x97, 0x26, 0x00, 0xD0, 0x92, 0xC7, 0xBF, 0xEC, 0x1B, 0x1D, 0xAB, 0xCF,
+    0x79, 0xCC, 0xA2, 0xD1, 0xB1, 0xBA, 0xC3, 0xE3, 0x60, 0x31, 0xD5, 0x43, 0x65, 0xFC, 0xD2, 0xB9,
+    0x5D, 0x74, 0xD5, 0xC5, 0x60, 0xB6, 0x6B, 0xAF, 0x05, 0x61, 0x22, 0x47, 0x25, 0x1D, 0xE1, 0x46,
+    0x94, 0x68, 0x43, 0xB5, 0x29, 0x00, 0xB8, 0x63, 0x06, 0x63, 0xBB, 0xC0, 0x31, 0xE8, 0x80, 0x06,
+    0xCC, 0xC1, 0x2C, 0xCC, 0x81, 0x0F, 0x2D, 0x43, 0x63, 0x72, 0x56, 0xCB, 0x58, 0xC9, 0x98, 0xE4,
+    0x11, 0x20, 0x22, 0x22, 0x13, 0x3C, 0xBE, 0x48, 0xF8, 0xDF, 0x1C, 0xE6, 0x80, 0x75, 0x24, 0x58,
+    0xF0, 0xD4, 0x52, 0x36, 0xD4, 0x9A, 0x5E, 0xAE, 0x26, 0x34, 0x52, 0x2A, 0x5C, 0x43, 0xC9, 0x80,
+    0x41, 0xEA, 0x64, 0x00, 0xB6, 0x8C, 0xD5, 0xB2, 0xF9, 0x7B, 0x94, 0xD7, 0x8F, 0x7B, 0xCE, 0xAC,
+    0x56, 0xAB, 0x22, 0x99, 0x2F, 0x19, 0x6D, 0xD0, 0xA0, 0x0C, 0xE4, 0xD0, 0xDE, 0xAC, 0x14, 0x65,
+    0x72, 0x3B, 0x9D, 0xB3, 0x32, 0x95, 0xE6, 0x84, 0x05, 0x6E, 0x09, 0x15, 0xF8, 0xE0, 0xE7, 0xB4,
+    0xFA, 0x34, 0x8E, 0xA6, 0xDA, 0x54, 0x6E, 0xDA, 0x38, 0x92, 0xD9, 0x05, 0xB8, 0xEC, 0x8E, 0xD5,
+    0x3E, 0xE6, 0x37, 0xC5, 0xD9, 0x47, 0xF7, 0xA9, 0xC8, 0x24, 0x91, 0x94, 0x5D, 0xD8, 0x86, 0x1D,
+    0xC7, 0xD5, 0x8F, 0xB8, 0xCA, 0x57, 0xCD, 0x54, 0xAC, 0x4E, 0x59, 0xB7, 0x96, 0x4A, 0x99, 0xB8,
+    0xB7, 0x22, 0x2B, 0xA3, 0xC7, 0x34, 0x10, 0xCF, 0xD4, 0x63, 0xEF, 0x19, 0x9A, 0xCF, 0xB2, 0x3D,
+    0x91, 0x2A, 0x91, 0x0A, 0x68, 0x6E, 0x73, 0x5D, 0x75, 0xFE, 0x82, 0xC9, 0x3B, 0xB1, 0x57, 0x6F,
+    0x6A, 0xC7, 0xB5, 0xCF, 0x5F, 0x30, 0x71, 0x27, 0x6E, 0xD6, 0x9B, 0xAE, 0xE3, 0xDA, 0xE7, 0x2F,
+    0x88, 0x4C, 0x12, 0x91, 0x08, 0x2B, 0x85, 0x18, 0x76, 0x0E, 0x52, 0xBE, 0x92, 0x82, 0x01, 0x03,
+    0x29, 0x96, 0x64, 0x56, 0xEA, 0x59, 0xE9, 0x76, 0x2B, 0x9D, 0xB2, 0xD2, 0xD0, 0x92, 0xCA, 0x92,
+    0x0C, 0xD8, 0xB1, 0x1B, 0xC2, 0x67, 0xE7, 0x3C, 0x84, 0x7E, 0x49, 0xD8, 0xD5, 0x84, 0x5D, 0x45,
+    0xD8, 0x55, 0x41, 0xD8, 0x6D, 0x10, 0x0E, 0x84, 0xC3, 0x83, 0x92, 0xB3, 0xBB, 0xD9, 0x8E, 0x02,
+    0xC3, 0x3C, 0x7A, 0xE2, 0x04, 0xF7, 0xD2, 0xED, 0x5D, 0xF5, 0x03, 0xE7, 0xA2, 0xDC, 0x93, 0xCC,
+    0x9E, 0xD0, 0xD8, 0x9B, 0x7A, 0xE4, 0x1D, 0x7A, 0xE0, 0x59, 0x27, 0x56, 0x2C, 0xA9, 0x36, 0x6F,
+    0x6F, 0x6C, 0x55, 0x89, 0x14, 0xBE, 0xE4, 0xAE, 0x04, 0x9B, 0x5D, 0xE1, 0x39, 0x63, 0xED, 0x2C,
+    0x5D, 0x5F, 0x8D, 0x9A, 0xF7, 0x8C, 0x0A, 0x63, 0xEE, 0x7A, 0xBC, 0x2A, 0xD4, 0x1E, 0x1A, 0x35,
+    0x1A, 0xD9, 0x9F, 0x35, 0xD6, 0x1F, 0x2C, 0x4B, 0x91, 0x35, 0x6E, 0x60, 0x89, 0x59, 0x3C, 0xB9,
+    0x27, 0x9D, 0x72, 0x98, 0x9F, 0x26, 0xF5, 0xBF, 0x1B, 0x0D, 0x26, 0x96, 0x94, 0x8D, 0xAF, 0x65,
+    0x43, 0x77, 0x35, 0x6D, 0xE9, 0xA0, 0x3A, 0xAC, 0xEE, 0x97, 0xDA, 0x00, 0x7E, 0x47, 0x9F, 0x7E,
+    0xCD, 0x0C, 0xE7, 0x9D, 0xBD, 0x2C, 0x74, 0xD4, 0x11, 0x56, 0x16, 0x93, 0x0B, 0x52, 0xB9, 0x37,
+    0x0D, 0xB0, 0xE5, 0x80, 0x3B, 0xB1, 0x53, 0xBA, 0xB8, 0x5B, 0x83, 0x3F, 0x8A, 0x9B, 0xAE, 0x8C,
+    0xD4, 0x5A, 0xD0, 0xEE, 0xA9, 0xD5, 0x6B, 0x2B, 0x0D, 0x09, 0x5A, 0x11, 0x24, 0x59, 0x3C, 0x13,
+    0xD7, 0xE3, 0x5E, 0x92, 0xC7, 0xBB, 0x62, 0x1D, 0x37, 0x92, 0x49, 0x52, 0x42, 0x32, 0x89, 0x19,
+    0x3E, 0x19, 0x23, 0x46, 0x8C, 0x00, 0x5C, 0x61, 0xC6, 0x23, 0xCB, 0xD5, 0xB2, 0x99, 0xD2, 0x0C,
+    0x3D, 0x65, 0xF2, 0xC1, 0xC9, 0x6B, 0x22, 0xAB, 0x91, 0xFB, 0x02, 0x3B, 0xEC, 0x92, 0xA2, 0x33,
+    0x63, 0x2F, 0xFF, 0xBA, 0x1A, 0xDC, 0x3E, 0x02, 0x0B, 0xA8, 0x62, 0xA7, 0x16, 0xD3, 0xBA, 0xB1,
+    0xC5, 0x0A, 0x02, 0x67, 0x79, 0xD5, 0xD8, 0x97, 0x2F, 0x46, 0x3C, 0xF8, 0x14, 0x0E, 0xDD, 0x01,
+    0xBF, 0x04, 0x9D, 0x43, 0xAB, 0x04, 0x99, 0xA0, 0x44, 0x22, 0x7D, 0x75, 0x3D, 0xF3, 0x8F, 0x5E,
+    0x2F, 0xBF, 0x14, 0x59, 0xC6, 0x66, 0xBB, 0x9B, 0x5A, 0x46, 0xED, 0x5B, 0x69, 0xA5, 0x30, 0x63,
+    0xDF, 0xB6, 0x36, 0xCC, 0xED, 0xF8, 0xE3, 0x53, 0xDD, 0xF5, 0x85, 0x57, 0x3E, 0xD7, 0x67, 0xD5,
+    0x5D, 0x72, 0x50, 0x77, 0x98, 0x01, 0x8E, 0xBB, 0xBF, 0x73, 0xD6, 0xD5, 0x89, 0x0B, 0x7F, 0xFE,
+    0xE8, 0xF2, 0xA9, 0x6C, 0x3D, 0x5E, 0x2C, 0xF4, 0x8A, 0x32, 0x3B, 0x67, 0xDC, 0x69, 0xF5, 0x1E,
+    0xEB, 0xF8, 0x91, 0x36, 0xAA, 0xB2, 0xAE, 0x9A, 0x6E, 0x35, 0xAB, 0x53, 0x18, 0x5C, 0x5A, 0xDD,
+    0x37, 0x35, 0x33, 0x7F, 0xFC, 0x2F, 0xCB, 0xDF, 0x9C, 0x8A, 0xE7, 0x61, 0x86, 0x03, 0x8B, 0x14,
+    0xBE, 0x5D, 0xF8, 0xAF, 0x95, 0x87, 0x8E, 0x8C, 0xDE, 0x59, 0xEB, 0xFD, 0xE4, 0xAE, 0xD7, 0x1D,
+    0x87, 0xC3, 0x95, 0x70, 0xD4, 0x0B, 0x47, 0xAC, 0xBC, 0xCC, 0x81, 0xCC, 0x5E, 0x35, 0x5A, 0xE3,
+    0x79, 0xE4, 0xB9, 0x5A, 0x15, 0x79, 0x5D, 0xC6, 0xED, 0xFD, 0xFF, 0xCC, 0xD5, 0x15, 0xA3, 0x03,
+    0xA7, 0x70, 0xF7, 0x2E, 0x07, 0x07, 0xCD, 0x54, 0xAC, 0x4E, 0x71, 0x2B, 0xE8, 0x6D, 0xAC, 0xB4,
+    0x26, 0xD6, 0x18, 0x68, 0xC9, 0x3A, 0xAF, 0x98, 0x5A, 0xAC, 0x4E, 0xF1, 0x74, 0x61, 0x65, 0xCF,
+    0xCF, 0xF1, 0xEA, 0x7A, 0x50, 0xB9, 0x2A, 0xAD, 0x6B, 0x76, 0x7B, 0xA4, 0xA5, 0xA3, 0x1E, 0x85,
+    0x5A, 0xD2, 0x9F, 0x4E, 0xEC, 0x14, 0x0D, 0x1E, 0xE4, 0x9B, 0x8D, 0x82, 0x53, 0xB6, 0xBE, 0xE3,
+    0xD1, 0xA5, 0x4B, 0x97, 0x1E, 0x8B, 0xB4, 0xAA, 0xAD, 0x63, 0x48, 0xC4, 0x4C, 0x3D, 0x47, 0x4A,
+    0x0D, 0x32, 0x6A, 0x58, 0x19, 0xD3, 0x58, 0x39, 0xF3, 0xD6, 0x65, 0xD3, 0x9C, 0x56, 0x26, 0x5F,
+    0x70, 0x8E, 0x06, 0x5E, 0x6E, 0x09, 0x3A, 0xA3, 0x8F, 0x93, 0x12, 0xD2, 0x88, 0xFC, 0x5C, 0x95,
+    0x00, 0x34, 0xB1, 0x65, 0xAC, 0xDE, 0xBF, 0x74, 0xC9, 0xE4, 0xF5, 0xE3, 0x9E, 0x9A, 0xD1, 0xD6,
+    0x9A, 0x32, 0x1F, 0x3D, 0xDA, 0xA8, 0x7C, 0x19, 0xDB, 0x32, 0x7E, 0xE6, 0x59, 0xD8, 0x02, 0xA0,
+    0x8C, 0x37, 0xE5, 0x72, 0x30, 0x55, 0x15, 0x1A, 0xBB, 0xE4, 0x4C, 0xDA, 0xD0, 0x7B, 0x4D, 0x08,
+    0x4F, 0x3E, 0xCE, 0x4E, 0xEC, 0x38, 0x74, 0x3A, 0x8E, 0xC3, 0xEE, 0x9F, 0x9D, 0xBE, 0x22, 0x63,
+    0x2C, 0x43, 0x13, 0x00, 0xF3, 0xBE, 0xFD, 0x8D, 0x17, 0x76, 0xCF, 0xDF, 0xBC, 0xF6, 0x38, 0xAA,
+    0xB1, 0xF0, 0xC5, 0xBC, 0x3F, 0x4D, 0xFA, 0x99, 0x73, 0xA7, 0x9E, 0xC6, 0xDC, 0x79, 0x26, 0xE6,
+    0xEE, 0xD3, 0x98, 0x9F, 0x39, 0xF7, 0xE1, 0xDB, 0x22, 0x9B, 0xC9, 0xF6, 0x40, 0x33, 0x08, 0xAC,
+    0x0F, 0x60, 0x1E, 0xE4, 0x98, 0xDA, 0x93, 0xD5, 0x30, 0x0B, 0x0E, 0x1B, 0x95, 0x92, 0xE8, 0x0D,
+    0x9E, 0x8B, 0xA9, 0xC7, 0xD4, 0x87, 0xD4, 0x07, 0x37, 0xEA, 0xDD, 0x5D, 0xF5, 0xAE, 0x53, 0xEF,
+    0xBA, 0xF5, 0xFE, 0xB9, 0xBA, 0x5F, 0x36, 0xDF, 0x20, 0x26, 0x26, 0x26, 0xB9, 0x11, 0xEF, 0x8A,
+    0xB7, 0xC5, 0xB5, 0x33, 0xE3, 0xA4, 0x68, 0x65, 0x2F, 0xBB, 0x01, 0x39, 0x4D, 0x25, 0x81, 0xFD,
+    0x27, 0xEB, 0xBE, 0xE4, 0xAD, 0x8C, 0x4E, 0x6B, 0x69, 0xF5, 0xDD, 0x8B, 0x75, 0xF5, 0xFD, 0xE3,
+    0xDB, 0x7E, 0x1C, 0x7C, 0x79, 0xCC, 0x6F, 0x7B, 0xEA, 0x37, 0xC3, 0xD9, 0x83, 0x72, 0xEF, 0xFC,
+    0x04, 0xFB, 0xB4, 0xB2, 0x8C, 0xE9, 0xCC, 0xD7, 0x1D, 0xB1, 0x6E, 0x9A, 0x34, 0xCE, 0x9B, 0x5D,
+    0x97, 0xBA, 0xDA, 0x4A, 0x04, 0x8D, 0xAC, 0xE9, 0x6E, 0xE7, 0x8A, 0x6C, 0x18, 0x3A, 0xE8, 0xFD,
+    0xBF, 0x90, 0xE2, 0xA5, 0xF2, 0x5F, 0xA5, 0x99, 0x7F, 0x8C, 0x5C, 0xD7, 0x55, 0xC7, 0x3F, 0xF7,
+    0x5D, 0x7B, 0xDF, 0x7A, 0x9E, 0x77, 0xDF, 0xFE, 0xB1, 0x01, 0x37, 0xDD, 0xDD, 0x67, 0x55, 0x46,
+    0xDA, 0x8A, 0xD9, 0x9D, 0x15, 0x9D, 0x88, 0x69, 0x33, 0x3F, 0xAE, 0x9D, 0x16, 0x57, 0x44, 0xD0,
+    0xA5, 0x24, 0x52, 0x11, 0x55, 0xB1, 0x4A, 0xFF, 0x48, 0x23, 0xA4, 0x0C, 0x30, 0x28, 0x1B, 0x75,
+    0xEC, 0xB9, 0xB1, 0x13, 0x52, 0x88, 0xA8, 0x17, 0xD4, 0x1F, 0x12, 0x6A, 0xC5, 0xAA, 0x04, 0xA9,
+    0x71, 0x28, 0xBB, 0x85, 0x95, 0xD8, 0xC0, 0xD8, 0x73, 0xED, 0x15, 0xB2, 0x42, 0x2A, 0xF2, 0x12,
+    0xAB, 0xAA, 0xD4, 0x22, 0xF1, 0x1A, 0x9B, 0x06, 0x39, 0x2A, 0x7D, 0x49, 0x06, 0x3A, 0x76, 0xDF,
+    0xCC, 0xE1, 0x8F, 0x99, 0xB5, 0xDD, 0x90, 0xB8, 0x8E, 0x7B, 0xDF, 0x91, 0xDE, 0x7B, 0xD2, 0x7B,
+    0xE7, 0x7B, 0xCE, 0xB9, 0xE7, 0x9E, 0x7B, 0xCE, 0xB9, 0x77, 0x84, 0xDB, 0xE9, 0x16, 0x9E, 0x4B,
+    0xCB, 0xA1, 0x76, 0x69, 0x39, 0xF0, 0xDC, 0x46, 0xDE, 0x07, 0x20, 0x26, 0xC6, 0x05, 0xBD, 0xC2,
+    0xA5, 0xB2, 0x6B, 0xB8, 0x86, 0x6B, 0xB8, 0x15, 0x57, 0x75, 0x85, 0xCC, 0xEF, 0x2B, 0x87, 0x05,
+    0x58, 0xA6, 0xD6, 0xD3, 0x71, 0x63, 0x02, 0x8A, 0xB0, 0x86, 0x72, 0x68, 0xC3, 0x43, 0x4F, 0x2B,
+    0xC9, 0x68, 0xE0, 0xC5, 0x1C, 0x43, 0xCB, 0xDF, 0x84, 0xD2, 0x3F, 0x30, 0x16, 0xCA, 0xD9, 0x17,
+    0x93, 0x8D, 0xF2, 0xC2, 0x5C, 0x20, 0xE7, 0xFF, 0x7B, 0xCB, 0xEC, 0x02, 0x12, 0x7D, 0x36, 0x29,
+    0x7B, 0x17, 0x63, 0x3D, 0xC0, 0x4F, 0x09, 0x57, 0x7D, 0x49, 0xE8, 0xA2, 0x63, 0xC2, 0xE5, 0xD1,
+    0xA3, 0x03, 0x78, 0xF8, 0xE1, 0x3A, 0x0F, 0x9E, 0x3A, 0x05, 0x10, 0x25, 0xFA, 0xA0, 0x3D, 0x82,
+    0x6F, 0xA8, 0xC5, 0xE1, 0xAB, 0x67, 0xDD, 0xC4, 0x8C, 0x8A, 0x25, 0xF3, 0xC4, 0x90, 0x11, 0x9C,
+    0x93, 0x5E, 0x6D, 0x00, 0xEC, 0xCB, 0x85, 0x87, 0xB7, 0x5F, 0x4E, 0x73, 0xF6, 0xB1, 0xC7, 0xEC,
+    0x27, 0xBD, 0x7B, 0xEF, 0xFB, 0x73, 0xFB, 0x29, 0x20, 0xDB, 0x7F, 0x6E, 0xEF, 0x5D, 0x2F, 0x5E,
+    0x39, 0x75, 0x5F, 0x67, 0xC0, 0x24, 0x21, 0xE1, 0x83, 0x4F, 0x77, 0x06, 0xBB, 0xCD, 0x17, 0x1E,
+    0xFB, 0xE0, 0x27, 0x5F, 0xFA, 0xF0, 0xE7, 0xBF, 0x6A, 0x3F, 0x05, 0x4A, 0x1C, 0x80, 0xEA, 0xAB,
+    0xEF, 0xC7, 0x49, 0xBE, 0x14, 0x84, 0xFA, 0xAC, 0xC4, 0x51, 0x8C, 0x55, 0x4E, 0xB9, 0x8E, 0x28,
+    0xA7, 0x1C, 0x06, 0x5A, 0x03, 0xD8, 0x87, 0x5B, 0x9A, 0xCF, 0x47, 0x8E, 0x69, 0x56, 0x77, 0xCD,
+    0x7B, 0x1F, 0xFC, 0xEB, 0x74, 0xFE, 0xF9, 0xA9, 0x32, 0x17, 0xDC, 0x44, 0x45, 0x5D, 0x8C, 0xE7,
+    0x2A, 0xEA, 0x62, 0x32, 0x57, 0xF3, 0x2E, 0xCA, 0xE0, 0x6E, 0xB9, 0x58, 0x38, 0xB9, 0x84, 0x02,
+    0xA5, 0x0A, 0xBF, 0xDA, 0xCA, 0x75, 0x72, 0xAD, 0x5C, 0x2D, 0x08, 0x83, 0xC8, 0x8F, 0xFC, 0x45,
+    0xBF, 0xEA, 0x57, 0xFD, 0x63, 0xFE, 0x51, 0x3F, 0x5F, 0x79, 0x2F, 0xE6, 0x63, 0xE3, 0x9B, 0xF3,
+    0x1E, 0x76, 0xFF, 0xDE, 0xC8, 0x91, 0x3B, 0xF4, 0xE1, 0xA5, 0xDF, 0xDC, 0x13, 0x39, 0x00, 0x56,
+    0x40, 0x1D, 0x01, 0x65, 0xB5, 0x19, 0x63, 0x1F, 0xF3, 0x38, 0xD6, 0x72, 0x04, 0x97, 0xEA, 0xD4,
+    0x2E, 0x1A, 0x4B, 0x3E, 0x80, 0xB8, 0xC9, 0xA4, 0x5E, 0xA2, 0x5E, 0x8C, 0xB5, 0x95, 0x38, 0xCF,
+    0x04, 0xAB, 0x14, 0xE7, 0x80, 0x8F, 0x01, 0x47, 0x88, 0x95, 0xF5, 0xC9, 0xB1, 0xC4, 0xBC, 0x67,
+    0xBD, 0x2B, 0x13, 0xA7, 0xC3, 0xDE, 0xB7, 0x26, 0xF0, 0x99, 0xA7, 0x48, 0xE2, 0xB9, 0x80, 0x19,
+    0x36, 0x49, 0x42, 0x1B, 0xD0, 0x4A, 0x8A, 0xEA, 0x94, 0x69, 0x19, 0xF0, 0xD8, 0xC5, 0x38, 0xB1,
+    0x9F, 0x8C, 0xA1, 0xDC, 0x12, 0xFA, 0x90, 0x1D, 0x6B, 0xCF, 0x50, 0x88, 0xE3, 0xFD, 0x04, 0x9E,
+    0xA3, 0x18, 0xA1, 0xED, 0x37, 0x99, 0x99, 0x28, 0x92, 0xD4, 0xBA, 0x01, 0xDA, 0x1C, 0x60, 0x02,
+    0x9E, 0x22, 0x34, 0xA4, 0x00, 0x53, 0x84, 0x86, 0x2E, 0xA1, 0xF1, 0xBA, 0x9C, 0x66, 0x0E, 0xED,
+    0x28, 0xE1, 0x1B, 0x56, 0xD0, 0xF1, 0x74, 0xF4, 0x8C, 0x7D, 0x28, 0x06, 0x58, 0x5B, 0xE6, 0x7D,
+    0xFB, 0xD9, 0xD7, 0x64, 0x34, 0x02, 0x8B, 0x4E, 0x51, 0x7D, 0x78, 0xC3, 0x52, 0x4A, 0x59, 0x98,
+    0x25, 0xD4, 0xCE, 0xB7, 0x5D, 0x2F, 0x9E, 0xA3, 0xEB, 0xBB, 0x96, 0x74, 0x6B, 0x22, 0x11, 0xFE,
+    0xF3, 0x8E, 0x1E, 0xEF, 0x82, 0x71, 0x8B, 0x97, 0x70, 0x7D, 0x78, 0x09, 0x64, 0xD0, 0x32, 0x94,
+    0x13, 0x26, 0xCB, 0x04, 0x87, 0x8D, 0x76, 0xA9, 0x4A, 0x2A, 0x6C, 0xFA, 0xB6, 0xA2, 0xD2, 0x48,
+    0xFA, 0xA1, 0xC8, 0x79, 0xA7, 0x5E, 0x4F, 0xA9, 0x8E, 0x30, 0x45, 0x2C, 0x35, 0xB9, 0x82, 0x27,
+    0xC0, 0x64, 0x1B, 0xF8, 0x46, 0x0A, 0xFE, 0x13, 0x0E, 0xCA, 0xA1, 0x58, 0x95, 0xD4, 0x06, 0x84,
+    0x74, 0xA1, 0xA9, 0x13, 0xB4, 0x88, 0x23, 0x12, 0x91, 0xB8, 0x8B, 0xC8, 0x93, 0x4E, 0x8B, 0x5C,
+    0x03, 0xD7, 0xD2, 0x43, 0x8B, 0xA0, 0x5D, 0xE4, 0xB4, 0xD3, 0x89, 0x76, 0x2A, 0xD5, 0x8E, 0xEE,
+    0x2F, 0x5E, 0x66, 0xAB, 0x26, 0xB4, 0xB5, 0xA3, 0xAD, 0x9D, 0xCA, 0xF4, 0xE5, 0xF5, 0x9E, 0x16,
+    0x49, 0xB5, 0x88, 0xD3, 0xD2, 0x83, 0xC6, 0x32, 0xEF, 0xBB, 0x8F, 0xF1, 0x32, 0x80, 0xEA, 0xAC,
+    0x7A, 0x57, 0xCF, 0x78, 0x5D, 0x3F, 0xED, 0x72, 0xB4, 0x49, 0xF8, 0x75, 0x94, 0x18, 0x6A, 0x8E,
+    0xB0, 0x8B, 0xFE, 0x01, 0xEA, 0xD5, 0x98, 0x9E, 0x3C, 0x93, 0x15, 0x44, 0x3C, 0x11, 0xDE, 0x3D,
+    0x00, 0x38, 0x30, 0x3D, 0x97, 0xFA, 0x2E, 0x4C, 0xCA, 0x43, 0x43, 0x1A, 0x40, 0xC5, 0xC0, 0x70,
+    0x2A, 0x36, 0x46, 0x4E, 0x04, 0x65, 0x80, 0x05, 0x80, 0x10, 0x78, 0xE8, 0x87, 0x06, 0x06, 0x1D,
+    0x07, 0x99, 0xEE, 0x41, 0xD3, 0x13, 0x58, 0xE4, 0x8D, 0x98, 0x90, 0xEE, 0x16, 0xDA, 0x35, 0x17,
+    0x21, 0xAD, 0xF8, 0x96, 0x72, 0x41, 0x25, 0x84, 0x21, 0x9B, 0x68, 0xB1, 0x47, 0xA1, 0x75, 0x59,
+    0x20, 0x14, 0x31, 0x78, 0x22, 0x16, 0x7E, 0x2C, 0x06, 0x7A, 0x00, 0x4D, 0x60, 0x68, 0xD7, 0x02,
+    0x40, 0x64, 0x80, 0xD0, 0x0E, 0x27, 0x16, 0xD4, 0x35, 0x4B, 0x4D, 0xC0, 0x0C, 0x94, 0x78, 0xD3,
+    0xD8, 0xA4, 0x52, 0xA6, 0xB9, 0x48, 0x37, 0x54, 0x69, 0xB0, 0x1D, 0xEB, 0xEF, 0x3A, 0x4F, 0x0C,
+    0x02, 0xA7, 0xA1, 0x0D, 0x6D, 0xC8, 0x20, 0x43, 0x65, 0x94, 0x98, 0x34, 0x7A, 0xC0, 0xF7, 0xD2,
+    0x52, 0x38, 0xC9, 0x05, 0xDB, 0x48, 0xDA, 0xD5, 0x5E, 0x98, 0x68, 0x4B, 0x42, 0x09, 0xFC, 0x4B,
+    0x9E, 0x8B, 0x8B, 0x5A, 0xAB, 0x8D, 0xA5, 0x25, 0xFF, 0x57, 0x68, 0xD4, 0xFD, 0x7B, 0xE2, 0x46,
+    0x70, 0xD8, 0xE4, 0x37, 0xF5, 0xF3, 0xEB, 0xBD, 0x67, 0x07, 0x04, 0x1F, 0xE2, 0x9B, 0xAB, 0x33,
+    0x65, 0x40, 0xFF, 0x88, 0xAB, 0xDD, 0x72, 0x70, 0x8F, 0x69, 0xD4, 0xF5, 0x13, 0x94, 0xEA, 0xC1,
+    0xF6, 0xAB, 0x59, 0x41, 0xDC, 0x99, 0xDF, 0x53, 0x6B, 0xBC, 0x07, 0x6F, 0x3F, 0x73, 0x00, 0xB5,
+    0x7A, 0xB8, 0x7E, 0x8F, 0xDB, 0x2C, 0xFA, 0x87, 0x29, 0xD5, 0xF5, 0x13, 0xB4, 0xAB, 0x9D, 0x73,
+    0x92, 0x05, 0xDF, 0x77, 0x00, 0xFA, 0x47, 0x51, 0x12, 0xAE, 0x77, 0xE7, 0xCB, 0x81, 0xDB, 0x5B,
+    0xF4, 0xBF, 0x33, 0xA8, 0xEB, 0xC1, 0xD3, 0x75, 0x6D, 0xA9, 0x07, 0x8E, 0x6A, 0xE7, 0xCA, 0xEE,
+    0x82, 0x48, 0x3F, 0xF8, 0xFE, 0x7F, 0xF4, 0x00, 0x74, 0x0C, 0x79, 0x58, 0xFF, 0x1A, 0x35, 0x61,
+    0x6A, 0x09, 0xF9, 0x38, 0xE9, 0x67, 0x68, 0x04, 0x36, 0xAF, 0xE2, 0x80, 0xBA, 0xEA, 0xAE, 0x50,
+    0xCB, 0xF0, 0xAE, 0x80, 0x7F, 0x88, 0xE7, 0xF6, 0xEF, 0x5D, 0xD8, 0x31, 0xCD, 0x58, 0x4F, 0x5D,
+    0x4D, 0x4B, 0xFA, 0x84, 0xC9, 0xD7, 0xD5, 0x79, 0x33, 0x53, 0xF2, 0xB6, 0x2F, 0xF7, 0x22, 0xE1,
+    0x21, 0x4B, 0x8A, 0x76, 0xE4, 0x00, 0xD8, 0xFD, 0x1B, 0x22, 0x0E, 0x98, 0x87, 0x14, 0x3F, 0x06,
+    0x2C, 0x79, 0xB4, 0x65, 0x09, 0x1F, 0xD6, 0x98, 0x40, 0xB9, 0xB1, 0x4C, 0xFD, 0x38, 0x2D, 0xFD,
+    0xF2, 0xF6, 0xBD, 0xF9, 0xFA, 0x6B, 0xE7, 0x27, 0x67, 0x1E, 0x79, 0x69, 0x7B, 0xB0, 0x15, 0x09,
+    0x2D, 0x1B, 0x40, 0xCA, 0x24, 0x2A, 0x26, 0x8F, 0x76, 0x34, 0xD8, 0x33, 0x44, 0xDE, 0x87, 0x36,
+    0xD4, 0xDF, 0x34, 0x53, 0xDA, 0xCC, 0x96, 0xBD, 0xB3, 0x49, 0x39, 0xD4, 0x76, 0x65, 0x53, 0xBF,
+    0x40, 0x94, 0x32, 0xC0, 0x4F, 0x38, 0x8A, 0xEF, 0x54, 0x4F, 0x0B, 0x35, 0xCB, 0xD0, 0xF7, 0x36,
+    0xD8, 0xA0, 0x63, 0xBE, 0x91, 0x6E, 0x94, 0x36, 0x66, 0x36, 0x66, 0x36, 0x4A, 0x1B, 0x1B, 0x0F,
+    0xC7, 0xC7, 0xA8, 0x8F, 0xAE, 0xD0, 0xB7, 0xE9, 0xD6, 0x9D, 0x39, 0x3B, 0x62, 0x5B, 0x54, 0x17,
+    0x5C, 0x7E, 0x4E, 0xBB, 0xB4, 0xE4, 0x3F, 0x69, 0xCA, 0xA9, 0x12, 0xC2, 0x84, 0x63, 0xF8, 0x31,
+    0x4D, 0x22, 0x5B, 0x4B, 0x75, 0x6F, 0x47, 0x80, 0x4E, 0xC6, 0x1D, 0xDC, 0x5E, 0xD8, 0xC0, 0x93,
+    0xF4, 0x0E, 0x73, 0xB3, 0xB9, 0x07, 0x58, 0x9D, 0x27, 0xFA, 0x5B, 0x54, 0xFF, 0x46, 0xAD, 0xB7,
+    0xA0, 0x06, 0x51, 0x4C, 0x58, 0x42, 0x9F, 0xC4, 0x7B, 0x31, 0x26, 0x2D, 0xB3, 0x12, 0x9A, 0x05,
+    0x95, 0x84, 0xA6, 0xE9, 0x8B, 0xDC, 0x23, 0xF2, 0x5A, 0x4A, 0xB3, 0x4D, 0x68, 0xC1, 0xB3, 0x47,
+    0xC2, 0xAF, 0xD3, 0x32, 0x43, 0x8B, 0xBD, 0x2D, 0xD8, 0x22, 0x84, 0x0E, 0xBF, 0x8B, 0xFE, 0x37,
+    0xB8, 0xE8, 0xD8, 0x6C, 0x50, 0x0E, 0x99, 0xD3, 0x71, 0x60, 0x56, 0x74, 0x1C, 0x29, 0x91, 0x58,
+    0x24, 0x6B, 0x12, 0x15, 0xD0, 0x09, 0x38, 0x70, 0xB0, 0x04, 0xFE, 0x70, 0x7B, 0xB8, 0x89, 0x73,
+    0x1E, 0x61, 0xCF, 0x68, 0x4D, 0x02, 0x1A, 0x02, 0x98, 0xF8, 0xC9, 0x79, 0x0C, 0xFA, 0xB4, 0xFA,
+    0x5E, 0x17, 0xDF, 0x11, 0x1A, 0x22, 0x58, 0x84, 0x05, 0x58, 0x84, 0x1A, 0x14, 0x1C, 0xD1, 0xE0,
+    0x74, 0x28, 0x7D, 0x2D, 0x7D, 0x3A, 0x57, 0x00, 0x96, 0x58, 0x23, 0xC6, 0x00, 0xF8, 0xBD, 0xC2,
+    0x7D, 0x65, 0x1A, 0x34, 0x68, 0xB0, 0x42, 0x95, 0x42, 0x36, 0xD6, 0x1F, 0x2E, 0xED, 0x1A, 0xBC,
+    0xE8, 0x6E, 0x1F, 0xC3, 0x78, 0x71, 0xAE, 0x31, 0x3D, 0xFE, 0xB6, 0x08, 0x7B, 0x20, 0x1A, 0x05,
+    0x98, 0xDB, 0x06, 0xF1, 0x62, 0x2F, 0xF1, 0xD6, 0x6E, 0xA2, 0x06, 0x10, 0xC7, 0xDC, 0x6D, 0x7E,
+    0x46, 0x83, 0x4D, 0xEF, 0xCA, 0x15, 0xBD, 0x64, 0x98, 0x2C, 0xBD, 0x2D, 0x92, 0x7A, 0xD4, 0x31,
+    0xE7, 0xF0, 0x6E, 0xB0, 0x99, 0x96, 0x1E, 0x22, 0xAE, 0xAC, 0xB2, 0x90, 0xF0, 0x84, 0x23, 0x4D,
+    0xA9, 0x96, 0x09, 0x5E, 0xC0, 0x7B, 0xC3, 0xD1, 0x4E, 0x69, 0x55, 0x4F, 0xC9, 0x49, 0x91, 0x6D,
+    0x11, 0x27, 0x83, 0x61, 0xAA, 0x46, 0x71, 0x99, 0x89, 0x79, 0xF4, 0xAF, 0xC3, 0x05, 0x7B, 0xBA,
+    0x88, 0xFC, 0x80, 0x8D, 0x02, 0x45, 0xED, 0x66, 0x48, 0x7D, 0xCA, 0x2A, 0x89, 0xA8, 0x75, 0x9C,
+    0x2F, 0x29, 0x0F, 0x7D, 0xE5, 0x67, 0xDE, 0xB1, 0x88, 0xA1, 0x88, 0xB7, 0xBE, 0x86, 0x64, 0x10,
+    0x73, 0x4B, 0x78, 0x4A, 0xBA, 0x77, 0x0C, 0x17, 0x83, 0x2F, 0x59, 0x6B, 0x70, 0xD8, 0xB0, 0x49,
+    0x60, 0xD8, 0x24, 0x10, 0xD7, 0xC9, 0x82, 0xD1, 0xAB, 0xC8, 0x49, 0xC9, 0x44, 0x1C, 0xBB, 0x95,
+    0x74, 0x77, 0x04, 0x2D, 0xD8, 0xF0, 0xB0, 0x67, 0xE7, 0xDF, 0xBF, 0x7E, 0x7E, 0xF0, 0xB5, 0x3A,
+    0xDA, 0x52, 0x3B, 0x68, 0x25, 0xF3, 0x06, 0x06, 0x94, 0x5B, 0x0A, 0xD7, 0x29, 0xEC, 0x84, 0x90,
+    0x5B, 0x61, 0x3D, 0xA1, 0x89, 0xEB, 0x7E, 0xB6, 0x13, 0xE1, 0x6E, 0xCA, 0x7F, 0x8D, 0x10, 0x95,
+    0xEE, 0x7C, 0xD7, 0x92, 0xF3, 0x72, 0xA9, 0xC1, 0x0E, 0xC3, 0x4E, 0x16, 0x88, 0x1B, 0x21, 0x85,
+    0xD2, 0x13, 0x79, 0x41, 0x32, 0x52, 0x42, 0xD4, 0xDA, 0xB5, 0x8C, 0xA4, 0x47, 0xB7, 0x3E, 0xEF,
+    0x9D, 0xF8, 0xCB, 0xAC, 0x75, 0xF9, 0x09, 0x28, 0xA1, 0xBB, 0xFB, 0x42, 0x71, 0x85, 0x4B, 0xB7,
+    0x26, 0xEA, 0x3E, 0x34, 0x44, 0x6F, 0xC3, 0x68, 0x3A, 0x12, 0x57, 0xB8, 0xC4, 0x11, 0xC6, 0xF1,
+    0x2C, 0xC1, 0xD0, 0xB6, 0xAC, 0xAE, 0x79, 0x5B, 0x4C, 0xF2, 0x0E, 0xEC, 0xB1, 0x67, 0x8C, 0x0F,
+    0x58, 0xD2, 0x1B, 0xDC, 0xFC, 0x26, 0xF6, 0x06, 0x4A, 0x30, 0x99, 0xE0, 0x79, 0x43, 0x9B, 0xFF,
+    0x96, 0xF1, 0x44, 0x38, 0x63, 0xA6, 0x42, 0x8B, 0x97, 0xC2, 0x22, 0xE8, 0x04, 0xAA, 0xA0, 0x93,
+    0x60, 0xB0, 0xC8, 0xCF, 0xBF, 0x9E, 0x52, 0x8A, 0x62, 0xDF, 0x89, 0x64, 0x5A, 0xC4, 0x05, 0xB2,
+    0xCA, 0x2A, 0x4D, 0x7E, 0xDF, 0x4D, 0xED, 0x02, 0xD5, 0x7B, 0x4D, 0xB2, 0xA4, 0x55, 0x0F, 0xBF,
+    0xEC, 0xBD, 0xC2, 0xB3, 0xAE, 0x5A, 0xED, 0x3C, 0x21, 0xC9, 0xB1, 0x06, 0x95, 0xE9, 0x42, 0x28,
+    0xC7, 0xC5, 0x02, 0xEC, 0xC2, 0xC7, 0x51, 0xDD, 0x82, 0x33, 0xD7, 0x24, 0xDC, 0xFD, 0x79, 0x0A,
+    0x92, 0x06, 0x97, 0x14, 0x3D, 0x28, 0x0C, 0x33, 0xBF, 0xEA, 0x0E, 0x72, 0xE7, 0xE5, 0x44, 0xB5,
+    0x0A, 0xE8, 0x47, 0xFB, 0x34, 0x43, 0x11, 0x57, 0x93, 0x8C, 0xCE, 0x15, 0x66, 0xB5, 0x3E, 0xE8,
+    0x3A, 0x6E, 0x6C, 0xA8, 0xC5, 0xB1, 0x72, 0x4B, 0x4A, 0xD1, 0xBF, 0xEB, 0x57, 0x78, 0xD6, 0x2D,
+    0xD6, 0xC3, 0x93, 0xEB, 0xDF, 0x93, 0x5E, 0xF4, 0x15, 0xC2, 0x0F, 0x05, 0xDB, 0x92, 0x74, 0x12,
+    0x00, 0xCF, 0x42, 0xF9, 0x7A, 0xA4, 0xBD, 0x4D, 0x65, 0x53, 0x9A, 0xDC, 0x39, 0x5C, 0x01, 0x3F,
+    0x5D, 0xD9, 0xDB, 0xD1, 0x6B, 0x67, 0x4C, 0x83, 0x1F, 0x43, 0x73, 0x98, 0x6F, 0x75, 0x21, 0xA3,
+    0x4A, 0x68, 0x7C, 0xE7, 0xAD, 0xDD, 0x9A, 0xBE, 0xC3, 0x1C, 0xF1, 0xEF, 0xF0, 0x0E, 0x59, 0x60,
+    0x8A, 0xE9, 0x15, 0xCA, 0x5B, 0x23, 0xAA, 0x0C, 0xA9, 0x4D, 0xA5, 0x23, 0xFD, 0x8E, 0xF4, 0x3B,
+    0x32, 0xC8, 0x38, 0x96, 0x51, 0xCD, 0x38, 0x96, 0x71, 0x0C, 0x83, 0xE7, 0xC8, 0xD5, 0x39, 0x30,
+    0x8E, 0x72, 0x78, 0x37, 0x90, 0xFE, 0x53, 0xAB, 0x25, 0xD5, 0xC9, 0x8A, 0x76, 0x25, 0xED, 0xF2,
+    0xDA, 0xE6, 0xB5, 0xCD, 0xFB, 0xAE, 0x3C, 0xA4, 0x3D, 0x8C, 0xA9, 0x84, 0x74, 0x91, 0xD0, 0x1B,
+    0xDE, 0xEE, 0x15, 0xC9, 0x5A, 0xA7, 0xD6, 0x8F, 0xA7, 0x74, 0x0B, 0x22, 0x87, 0x44, 0xBA, 0x05,
+    0x91, 0x13, 0xA9, 0xEA, 0xD5, 0x08, 0x87, 0xB7, 0xC8, 0x0E, 0x11, 0x6A, 0x7D, 0x3C, 0x87, 0xFE,
+    0x69, 0x08, 0x79, 0xBE, 0xF9, 0xC5, 0x68, 0x17, 0x00, 0xF7, 0x79, 0xA9, 0xEF, 0x22, 0x9A, 0xEA,
+    0xC6, 0x5B, 0xDB, 0x4B, 0x83, 0x78, 0x76, 0xD7, 0x73, 0xBF, 0x1B, 0xEE, 0x02, 0x76, 0x53, 0x24,
+    0xD6, 0x66, 0x82, 0x22, 0x89, 0xB6, 0x93, 0x34, 0x81, 0x40, 0xCE, 0x2E, 0xEF, 0x98, 0xB8, 0x80,
+    0xEF, 0x54, 0x4A, 0x93, 0xE8, 0x4D, 0x0F, 0x6D, 0x0A, 0x04, 0x31, 0xB4, 0xFA, 0xF7, 0x01, 0x0A,
+    0x6D, 0xAE, 0x5D, 0x56, 0x5B, 0x6D, 0x7D, 0x47, 0xE5, 0xDA, 0xA8, 0x56, 0xAB, 0xB5, 0xFD, 0x47,
+    0x2A, 0xE4, 0xFC, 0xB3, 0x29, 0x28, 0xE2, 0xE2, 0x84, 0x36, 0x71, 0x69, 0x52, 0x3F, 0x9A, 0xAE,
+    0x2E, 0x05, 0x96, 0x4F, 0x6D, 0x65, 0xC0, 0x54, 0xBB, 0x79, 0x6D, 0xB4, 0xDB, 0xA7, 0xB9, 0xF0,
+    0x6B, 0xC5, 0x0B, 0x9F, 0x7B, 0x7F, 0x0A, 0x5E, 0xAA, 0xCF, 0xBB, 0x30, 0xA2, 0xD9, 0x54, 0xAF,
+    0xA5, 0xFE, 0x79, 0x17, 0x5D, 0x7F, 0x5C, 0x8C, 0xD8, 0x6A, 0x7B, 0x2F, 0xA7, 0xC1, 0x93, 0x71,
+    0x05, 0xD5, 0x45, 0x9C, 0x1E, 0x10, 0xC6, 0xCC, 0x43, 0x84, 0x3E, 0xEF, 0x48, 0xE1, 0x01, 0x60,
+    0x17, 0x68, 0xC3, 0x46, 0x4C, 0xBE, 0x48, 0x38, 0x81, 0x3E, 0x61, 0x48, 0x12, 0x4A, 0x25, 0x26,
+    0x27, 0xD1, 0x87, 0xDD, 0x30, 0xC2, 0xB3, 0x00, 0x1D, 0xE8, 0x8C, 0x72, 0x18, 0x37, 0xB1, 0xB6,
+    0x7F, 0x9E, 0x2E, 0x5D, 0xBA, 0xA4, 0xD7, 0x2F, 0x35, 0xBA, 0xBC, 0xC4, 0x4F, 0x3A, 0x4E, 0xEC,
+    0xB3, 0x50, 0xA7, 0xCA, 0xD2, 0xDA, 0xD4, 0x2E, 0xA6, 0x98, 0xC1, 0x47, 0x39, 0xEA, 0xE4, 0x09,
+    0xF0, 0x1C, 0x1B, 0xCC, 0x33, 0x49, 0x60, 0x6B, 0x2E, 0x67, 0x58, 0x08, 0xDC, 0x66, 0x45, 0x9F,
+    0x4B, 0xC2, 0x88, 0x72, 0x8F, 0x1F, 0x39, 0xDD, 0x27, 0x4C, 0x69, 0x39, 0x25, 0xCE, 0xFF, 0xA1,
+    0x2D, 0xD4, 0xEC, 0x56, 0xED, 0x78, 0xD2, 0x39, 0x69, 0xC5, 0x80, 0x4E, 0x88, 0x0C, 0x4D, 0xBC,
+    0x94, 0x9C, 0x01, 0xB4, 0xA3, 0x3C, 0x2C, 0x2C, 0xF5, 0x1F, 0x9B, 0x52, 0xAA, 0xDB, 0xD4, 0x8C,
+    0xEE, 0xF2, 0x99, 0xD8, 0xFF, 0x2B, 0xB3, 0x72, 0xDA, 0x3F, 0x3E, 0x4C, 0x16, 0x95, 0xA1, 0x4D,
+    0xE0, 0xE8, 0x11, 0x1A, 0xF6, 0x16, 0x67, 0x36, 0x66, 0x5D, 0xC1, 0x16, 0x28, 0x98, 0xBB, 0xE3,
+    0x52, 0xB7, 0x74, 0x74, 0x2F, 0x39, 0xB4, 0xC1, 0x00, 0xBB, 0xD1, 0x4E, 0xA5, 0xAC, 0x30, 0x87,
+    0x6F, 0x55, 0xC2, 0x0A, 0x8B, 0x04, 0xD6, 0x4B, 0xD8, 0xA4, 0x70, 0x4A, 0x44, 0x44, 0x94, 0x72,
+    0x71, 0x1D, 0x94, 0x49, 0x4A, 0x13, 0xFE, 0xC1, 0xB8, 0x3E, 0x13, 0x78, 0x6E, 0x23, 0x1F, 0xBC,
+    0xDE, 0x87, 0x10, 0xED, 0x54, 0x72, 0xFD, 0xE7, 0xAD, 0xE1, 0xCF, 0x31, 0x67, 0x9E, 0x11, 0x11,
+    0xC9, 0x46, 0xDE, 0x53, 0x23, 0xB4, 0x3A, 0x56, 0x29, 0xD3, 0x93, 0xDA, 0xC6, 0x8D, 0x59, 0x5F,
+    0xB9, 0x8D, 0x7C, 0xE0, 0xB9, 0x4E, 0x21, 0x86, 0x5A, 0x78, 0xE2, 0xC5, 0xF4, 0x01, 0x20, 0xC4,
+    0x77, 0x2A, 0x61, 0x25, 0x98, 0xF3, 0x9E, 0xB0, 0xDF, 0x4B, 0x0E, 0xBC, 0x99, 0xD9, 0x7C, 0x31,
+    0xD9, 0x7E, 0x62, 0x62, 0xBC, 0xA1, 0x62, 0x9F, 0x19, 0x36, 0x3C, 0x17, 0x90, 0xA7, 0xE3, 0xF5,
+    0x29, 0x13, 0xE2, 0x5B, 0x95, 0x94, 0x57, 0xC2, 0x39, 0xEF, 0x4B, 0xD6, 0x1B, 0xC9, 0x61, 0xBC,
+    0xAB, 0xEB, 0x22, 0x22, 0xE9, 0x34, 0x89, 0xB6, 0x13, 0x34, 0x1E, 0x79, 0xE9, 0x95, 0xDC, 0x97,
+    0x6F, 0xFC, 0x71, 0x98, 0x57, 0x31, 0x03, 0x14, 0x87, 0x35, 0xE3, 0x6B, 0x31, 0xBC, 0x61, 0x51,
+    0xAF, 0x82, 0xEA, 0x83, 0xCA, 0x40, 0x75, 0x41, 0x25, 0xC3, 0x98, 0xE4, 0x27, 0x10, 0x26, 0x50,
+    0x88, 0xA1, 0x7A, 0x75, 0x9D, 0x7F, 0x10, 0x51, 0x17, 0x45, 0xB4, 0x83, 0xC0, 0x0C, 0x0B, 0xCC,
+    0x32, 0x30, 0x05, 0xB0, 0x1B, 0x4A, 0x90, 0xA0, 0x0D, 0xB3, 0xD0, 0x40, 0x7D, 0x87, 0x20, 0xA6,
+    0xCD, 0xE2, 0x86, 0x7F, 0xDC, 0x11, 0x40, 0xC1, 0xD1, 0x31, 0x68, 0xC8, 0xC1, 0x04, 0x0C, 0xD7,
+    0x2A, 0xBB, 0x16, 0x99, 0xAB, 0x31, 0x57, 0xB3, 0x8B, 0x35, 0xB7, 0x58, 0x4B, 0x16, 0x2B, 0x69,
+    0xA5, 0xDC, 0xAD, 0x34, 0x9B, 0x95, 0x66, 0xA5, 0xD2, 0x8C, 0x2A, 0xED, 0xB0, 0xDD, 0xF6, 0xB3,
+    0xB6, 0xCE, 0x32, 0x95, 0xB1, 0x17, 0xCF, 0x52, 0xBC, 0x56, 0x62, 0x4E, 0x69, 0x89, 0xAB, 0x81,
+    0x76, 0xC5, 0xB2, 0x3E, 0xE1, 0x4A, 0x65, 0x7D, 0xDE, 0x95, 0x9B, 0xFA, 0xBC, 0x6B, 0x02, 0xEF,
+    0xBA, 0x91, 0x69, 0x7C, 0x53, 0xA6, 0xEC, 0xD4, 0x9C, 0x5D, 0x48, 0x51, 0x6B, 0x37, 0xE5, 0x5B,
+    0x40, 0x27, 0x54, 0xD0, 0x8E, 0x07, 0x50, 0x18, 0x5E, 0xB2, 0x54, 0x61, 0x7C, 0x24, 0xD0, 0xAD,
+    0xA3, 0xEE, 0xF6, 0x78, 0x6F, 0xCC, 0xE6, 0xAD, 0xA8, 0xE2, 0x1B, 0xDF, 0xFA, 0xEE, 0x7A, 0x59,
+    0xBD, 0x3C, 0x29, 0xF7, 0xC4, 0x69, 0x3A, 0xBB, 0xE2, 0x7F, 0x42, 0xBD, 0x62, 0x1F, 0x49, 0xE6,
+    0xB6, 0xFC, 0x75, 0x95, 0xBE, 0x03, 0x74, 0x2F, 0x43, 0xF7, 0xA8, 0x25, 0x4C, 0xDF, 0x04, 0xD7,
+    0x77, 0x3A, 0xDB, 0xA9, 0x6A, 0xAE, 0xD7, 0x61, 0xB7, 0xD3, 0xB7, 0xB8, 0x53, 0x0E, 0x7E, 0x61,
+    0x79, 0x47, 0xF8, 0x87, 0x6C, 0xB4, 0xAE, 0x6D, 0xA9, 0xE8, 0x9D, 0x67, 0xA6, 0xA1, 0xB6, 0x6D,
+    0xBE, 0xBA, 0xFE, 0xA8, 0xA4, 0x63, 0x3D, 0x60, 0x8A, 0x23, 0x33, 0x84, 0x5F, 0xBF, 0xA1, 0x1A,
+    0x7B, 0xF7, 0x15, 0x0A, 0xCF, 0x24, 0x05, 0xD3, 0x0A, 0x8D, 0xFF, 0x6D, 0xC7, 0xD5, 0x98, 0xA8,
+    0x8B, 0xCE, 0x40, 0x0C, 0xD5, 0x98, 0xB9, 0xD3, 0x84, 0x27, 0xAF, 0x76, 0xCE, 0x89, 0xA4, 0x05,
+    0x49, 0xD5, 0xCE, 0xE6, 0xF6, 0xA6, 0x54, 0xF1, 0xA6, 0x65, 0xF5, 0xB2, 0x32, 0x0B, 0x6C, 0x04,
+    0xA6, 0x7C, 0x03, 0x64, 0x70, 0xB9, 0xE7, 0x75, 0xFD, 0xB4, 0x42, 0x74, 0xD8, 0xD1, 0xDB, 0xC4,
+    0x7F, 0xC1, 0x50, 0x4E, 0xD1, 0x2F, 0x18, 0xCA, 0x9B, 0xF8, 0x4F, 0xC6, 0xF4, 0x6A, 0x97, 0xC5,
+    0x13, 0x49, 0x03, 0xC9, 0x46, 0x3A, 0x02, 0x90, 0xEA, 0x47, 0x53, 0xDF, 0x1A, 0xC5, 0x8D, 0xC8,
+    0xF8, 0xAF, 0x3A, 0x6D, 0x4B, 0xC4, 0x01, 0x75, 0xE5, 0x66, 0xA9, 0x6B, 0x9B, 0xE7, 0xEA, 0x19,
+    0x22, 0x41, 0x8D, 0xF2, 0x1C, 0x47, 0x30, 0x5C, 0x8F, 0x80, 0x16, 0x3B, 0xF9, 0x8C, 0x5B, 0xF2,
+    0x8D, 0x9B, 0xF4, 0x59, 0x99, 0xFB, 0xED, 0xB8, 0xD5, 0x57, 0xD2, 0x0B, 0x5C, 0xB7, 0xA0, 0xD2,
+    0xB6, 0x3E, 0x97, 0x86, 0x1F, 0x71, 0xC7, 0x6A, 0x2A, 0xF3, 0xCC, 0x5E, 0x36, 0x14, 0xF0, 0x8F,
+    0xE7, 0xE4, 0x5E, 0x5B, 0x21, 0xD5, 0x2E, 0xA4, 0xA2, 0xBA, 0xD4, 0x7A, 0x5C, 0x6E, 0x6B, 0x1A,
+    0x7B, 0x49, 0xEA, 0xFE, 0xA3, 0xFF, 0x79, 0xDA, 0x97, 0x38, 0x12, 0xDB, 0x0E, 0x0F, 0xA5, 0x51,
+    0xE0, 0xCA, 0x05, 0xBA, 0x99, 0x7F, 0x31, 0x8D, 0xAE, 0x65, 0x3A, 0x81, 0xA3, 0x06, 0x3D, 0x74,
+    0xCC, 0x9D, 0x10, 0x34, 0x83, 0x7E, 0x60, 0x43, 0x13, 0x12, 0x12, 0x12, 0x9A, 0xC8, 0xEC, 0x7C,
+    0x97, 0x33, 0x91, 0x89, 0x58, 0xA4, 0x02, 0x50, 0x2C, 0x72, 0xB7, 0x79, 0x87, 0x02, 0xEF, 0x1F,
+    0x9F, 0xAD, 0xFB, 0x4E, 0x99, 0xB7, 0x04, 0xC9, 0x81, 0x36, 0x78, 0x6E, 0xD8, 0xD4, 0x1A, 0xCE,
+    0xC3, 0x80, 0x82, 0xB8, 0x70, 0x15, 0xDF, 0xA1, 0x12, 0x38, 0x0A, 0xE1, 0xC0, 0xD0, 0xE9, 0xA3,
+    0x3A, 0x09, 0x5E, 0x06, 0xAD, 0x43, 0xCB, 0xAD, 0x97, 0x44, 0x5E, 0x13, 0x49, 0x0B, 0xB2, 0xCA,
+    0xB0, 0x6E, 0x9D, 0x61, 0x72, 0x67, 0x49, 0xB5, 0xE2, 0x3F, 0x5A, 0x9E, 0x27, 0x30, 0x0C, 0x08,
+    0x7A, 0x84, 0xFA, 0x4B, 0x17, 0x24, 0xED, 0x74, 0x99, 0x87, 0x82, 0x61, 0xFE, 0xC0, 0x35, 0x87,
+    0xEC, 0xD1, 0x11, 0xAA, 0x86, 0x08, 0x7C, 0x8B, 0xEA, 0x42, 0xED, 0x0A, 0x9E, 0x74, 0x19, 0x13,
+    0x4B, 0x90, 0xA2, 0xFA, 0x7B, 0x0E, 0xCA, 0xBD, 0x22, 0xE7, 0x45, 0x5C, 0x67, 0x94, 0x1A, 0x1B,
+    0x56, 0x78, 0xD8, 0x1E, 0x39, 0x00, 0x4A, 0x0E, 0x7E, 0xCB, 0xAC, 0xB1, 0x80, 0xEE, 0x51, 0x48,
+    0x28, 0x4F, 0xFE, 0xCE, 0x47, 0xE4, 0x9C, 0xC4, 0xAA, 0x93, 0x78, 0x92, 0x71, 0x05, 0x9A, 0x30,
+    0x37, 0x4C, 0xD8, 0xE4, 0x12, 0x81, 0xC4, 0xBC, 0x7B, 0x00, 0x05, 0x87, 0xDF, 0xFD, 0x05, 0xBF,
+    0x5F, 0x10, 0x89, 0x44, 0x3C, 0xB9, 0x02, 0x53, 0xF0, 0x73, 0xC0, 0x32, 0x5E, 0x82, 0xDF, 0xF7,
+    0xEF, 0xF7, 0x2C, 0x9B, 0x84, 0x09, 0x1D, 0x4B, 0xFA, 0xFE, 0xA3, 0x35, 0x09, 0xC4, 0x8C, 0xA3,
+    0x0D, 0xE3, 0xC3, 0x39, 0x60, 0x6D, 0x8D, 0x20, 0x19, 0xB5, 0xFD, 0x76, 0x9C, 0x4D, 0x6C, 0x20,
+    0xA9, 0xBE, 0x84, 0x4A, 0x61, 0x05, 0x22, 0x83, 0x96, 0x55, 0x0A, 0x62, 0x78, 0xA8, 0x07, 0x1D,
+    0x88, 0xE2, 0xCF, 0x47, 0xDD, 0x8E, 0x64, 0x2D, 0xC9, 0x02, 0xB9, 0x04, 0xB0, 0x4B, 0x79, 0x4F,
+    0x52, 0xC0, 0xBB, 0x99, 0xCD, 0x44, 0x44, 0x64, 0x40, 0x99, 0x37, 0x53, 0xF3, 0x27, 0xE9, 0xE8,
+    0xB0, 0xF1, 0xE0, 0x08, 0x0D, 0x78, 0x56, 0x5B, 0xDF, 0xD6, 0x32, 0xDF, 0xF8, 0xC6, 0x37, 0x81,
+    0x09, 0x4C, 0x60, 0x83, 0x2C, 0xC8, 0x58, 0x65, 0x9C, 0x1E, 0x18, 0xEF, 0xB8, 0xE1, 0x34, 0xCC,
+    0x8F, 0x84, 0x7F, 0x07, 0x20, 0x3E, 0x81, 0xF7, 0xA4, 0x7E, 0xFC, 0xAD, 0xB8, 0xFF, 0x7F, 0x2E,
+    0xB9, 0xC1, 0x6A, 0x28, 0xC9, 0x5B, 0x70, 0x81, 0x79, 0x26, 0xF1, 0x6D, 0x28, 0x34, 0xBC, 0xCE,
+    0x9A, 0x64, 0x5E, 0xCC, 0x26, 0x8B, 0x04, 0x99, 0x27, 0xA8, 0xD8, 0xEA, 0xBB, 0xAC, 0x0E, 0x77,
+    0xA2, 0x33, 0xD3, 0x19, 0x47, 0x33, 0x8E, 0xB6, 0x39, 0xBA, 0x45, 0x73, 0x8B, 0xE6, 0xD6, 0xF5,
+    0x94, 0xB9, 0xDC, 0xA4, 0x79, 0x4C, 0x65, 0x35, 0xE9, 0xD5, 0xA4, 0x1B, 0x48, 0x0C, 0x84, 0x7B,
+    0xC6, 0x7E, 0x49, 0x1D, 0xB6, 0x00, 0x33, 0x7C, 0x9B, 0xBB, 0xE2, 0xB9, 0x86, 0xFF, 0x67, 0xEA,
+    0xA2, 0x5D, 0x49, 0x17, 0x6B, 0xF2, 0xA4, 0x24, 0x67, 0xCA, 0x80, 0x2F, 0xF1, 0xEE, 0x1D, 0x7F,
+    0x1F, 0x72, 0xCF, 0x6E, 0x8D, 0x3B, 0x77, 0x84, 0xC3, 0x43, 0x8C, 0xBA, 0xFE, 0x38, 0xDF, 0x36,
+    0x8F, 0xC4, 0x73, 0x45, 0xFF, 0x73, 0xEA, 0xA2, 0xDB, 0x92, 0x41, 0x41, 0x8E, 0xF7, 0x52, 0x8C,
+    0xF1, 0x95, 0xF3, 0xC4, 0xF0, 0xE9, 0x6B, 0x25, 0xC3, 0x3B, 0x93, 0xBF, 0x34, 0x96, 0xD3, 0x46,
+    0xEC, 0xD8, 0xB0, 0xB6, 0xE4, 0x2E, 0x37, 0xD1, 0xF0, 0xBF, 0xA2, 0x2E, 0x9A, 0x95, 0x64, 0xAE,
+    0x1C, 0x9C, 0x94, 0x97, 0xA5, 0x57, 0x38, 0xC9, 0x03, 0xF0, 0x38, 0x3C, 0x7E, 0xBD, 0xF7, 0xF4,
+    0x4E, 0xF5, 0xF0, 0x56, 0xF9, 0x2C, 0x8B, 0x3B, 0x15, 0xEC, 0x5B, 0xA3, 0x28, 0x3B, 0xE6, 0xC5,
+    0xC1, 0xA1, 0xD5, 0xDC, 0x75, 0x8C, 0xD0, 0xF9, 0x17, 0x52, 0xD5, 0xCD, 0x38, 0xBA, 0x48, 0x14,
+    0x58, 0xFF, 0x5C, 0x42, 0xBA, 0x45, 0x79, 0x91, 0x30, 0xB0, 0xFA, 0x6C, 0xAA, 0xD2, 0x63, 0x2A,
+    0x0B, 0x65, 0xA0, 0x45, 0x4C, 0x41, 0x0C, 0x80, 0xB6, 0xB3, 0x73, 0x6C, 0x4D, 0xAB, 0xD1, 0x2E,
+    0x34, 0x43, 0x3C, 0x43, 0x3C, 0xAB, 0x92, 0x59, 0x95, 0x4C, 0xA8, 0x64, 0x52, 0x25, 0xA1, 0x97,
+    0x84, 0x92, 0x04, 0x92, 0x78, 0xBD, 0xF4, 0x96, 0xB5, 0x48, 0x03, 0x89, 0x19, 0x83, 0x89, 0x51,
+    0xE9, 0xF8, 0x96, 0xB3, 0x71, 0x25, 0x65, 0x95, 0x23, 0xCC, 0xE3, 0xC5, 0x00, 0x76, 0xD4, 0x34,
+    0xCF, 0xE5, 0x01, 0x33, 0x35, 0x8C, 0xC1, 0x06, 0x16, 0xB6, 0x40, 0x9F, 0x77, 0xD0, 0x2C, 0x43,
+    0x70, 0x22, 0x8E, 0xE8, 0x2E, 0xEA, 0x6E, 0xA8, 0xD2, 0xD6, 0xD9, 0x34, 0x0C, 0xFB, 0x8B, 0xFC,
+    0xCF, 0xFF, 0xBE, 0x11, 0x87, 0x9D, 0xA8, 0x49, 0x27, 0x11, 0xE7, 0x67, 0x41, 0x8F, 0x9A, 0xAD,
+    0x19, 0xDD, 0xD5, 0x29, 0x8C, 0x43, 0x60, 0xC9, 0xCD, 0xB3, 0x5B, 0x8D, 0xFC, 0xC9, 0xB7, 0xAC,
+    0xA4, 0x2C, 0x94, 0xC7, 0xC3, 0xE0, 0xDE, 0xED, 0xB3, 0xAF, 0x5C, 0x49, 0x6A, 0xD2, 0x0D, 0x7E,
+    0x9C, 0xA9, 0xAC, 0x43, 0x25, 0xB4, 0x4C, 0xC1, 0x0A, 0xEA, 0x3B, 0x78, 0x3B, 0xDF, 0xDF, 0x7A,
+    0x4B, 0x1E, 0x08, 0xF1, 0x7A, 0xAC, 0xAD, 0xBD, 0xA3, 0x1E, 0xB1, 0x77, 0xC8, 0xFA, 0xDB, 0x71,
+    0xB0, 0x1D, 0xDF, 0xC6, 0x29, 0x00, 0x63, 0xA0, 0x0D, 0xCA, 0x8D, 0xF2, 0xCC, 0x61, 0xB4, 0xE8,
+    0xD6, 0x24, 0x53, 0xF7, 0xB7, 0xA0, 0x66, 0xA8, 0xD9, 0x1D, 0x72, 0x37, 0xD0, 0xD5, 0x53, 0x27,
+    0x45, 0xDE, 0x10, 0xE9, 0x33, 0x8F, 0x86, 0x8D, 0x9D, 0x84, 0x33, 0x14, 0x77, 0x2A, 0x23, 0x44,
+    0xC7, 0xF4, 0xA8, 0x12, 0x3A, 0x2F, 0xA5, 0x26, 0xBE, 0xF4, 0xC8, 0x43, 0x68, 0xF0, 0x56, 0xAF,
+    0xF5, 0xCD, 0x24, 0x16, 0x49, 0x77, 0xDF, 0x9F, 0x41, 0x1F, 0x06, 0x3B, 0x24, 0x37, 0xD2, 0xE5,
+    0x53, 0x35, 0x91, 0x17, 0x44, 0xBA, 0xA4, 0x84, 0x30, 0x32, 0x8B, 0x64, 0xB9, 0x75, 0x47, 0x4A,
+    0x85, 0xD0, 0xEA, 0x84, 0x8C, 0x02, 0x5A, 0xD2, 0x96, 0x58, 0x85, 0xA1, 0x18, 0xA3, 0x63, 0x38,
+    0x72, 0x5B, 0xCA, 0x8C, 0x7B, 0x7C, 0xC0, 0x5D, 0xEF, 0xE2, 0xBC, 0xBD, 0x32, 0xF4, 0xF3, 0xDA,
+    0x16, 0xB5, 0x29, 0x69, 0x5B, 0xF2, 0xED, 0x8A, 0x6F, 0x57, 0x7C, 0x3B, 0x4D, 0xEA, 0xC5, 0xF3,
+    0xCF, 0x4F, 0x69, 0x53, 0xD3, 0xF7, 0x40, 0x63, 0xE1, 0x2F, 0xCE, 0xC5, 0x40, 0x6D, 0x70, 0xC7,
+    0x50, 0x8E, 0x78, 0xD8, 0x0E, 0xF9, 0xC3, 0x57, 0x0F, 0xF7, 0x60, 0x5F, 0xA5, 0x3A, 0x3A, 0x65,
+    0xDD, 0xE7, 0xEF, 0x65, 0xFE, 0xF1, 0xC7, 0x9B, 0xAC, 0x7A, 0x26, 0xF5, 0x1F, 0x4D, 0x7C, 0x0B,
+    0xB1, 0xCB, 0x88, 0xA7, 0x59, 0xD5, 0x76, 0x8E, 0xBC, 0x4A, 0xA6, 0xC3, 0x13, 0x69, 0x33, 0x34,
+    0xD1, 0xE1, 0xB3, 0x69, 0xEF, 0xBD, 0x54, 0xC3, 0xE3, 0x69, 0x33, 0x67, 0xB8, 0x7B, 0x1B, 0xEF,
+    0xDE, 0xA7, 0x38, 0xF3, 0xD4, 0xFD, 0x89, 0xB6, 0x39, 0x4E, 0x1C, 0xD8, 0xB7, 0x9F, 0xE9, 0x33,
+    0x67, 0xA6, 0x61, 0xFA, 0x01, 0x98, 0x6E, 0x0D, 0x6E, 0x44, 0x99, 0x7F, 0xFC, 0xF1, 0xE6, 0x6E,
+    0xFF, 0xC5, 0xB4, 0x5D, 0xCD, 0x19, 0xCC, 0xC7, 0xC6, 0x37, 0xA7, 0xF7, 0xAF, 0x56, 0xF8, 0xCC,
+    0x3F, 0x2F, 0x77, 0x9E, 0xDB, 0xBB, 0x6C, 0xF7, 0x1F, 0xB8, 0xDB, 0xAC, 0x00, 0xCC, 0xAA, 0x1F,
+    0xEC, 0xDB, 0x33, 0x92, 0x7C, 0x78, 0x98, 0xAB, 0x24, 0xDE, 0xD1, 0xE5, 0xC1, 0xA7, 0x3B, 0x83,
+    0x8F, 0xAE, 0x2E, 0xFF, 0xC9, 0xDE, 0x8E, 0xE3, 0xC1, 0xB5, 0xD2, 0xA4, 0x7C, 0xFA, 0xC3, 0x1F,
+    0x7E, 0xCC, 0xC2, 0x98, 0x71, 0x9F, 0x1D, 0x7E, 0xB1, 0xFA, 0x2F, 0x00, 0xA3, 0x7A, 0x90, 0x31,
+    0xEF, 0xC4, 0x8B, 0x69, 0xAF, 0xDD, 0x79, 0x6E, 0xEF, 0xB2, 0x1D, 0xCA, 0x03, 0xAD, 0xC1, 0x1D,
+    0xD4, 0xFF, 0xE0, 0xEC, 0xF3, 0x41, 0x3E, 0xBF, 0x3C, 0x75, 0x7F, 0x21, 0x2D, 0x87, 0x80, 0x19,
+    0x57, 0x87, 0x3F, 0xF9, 0xDD, 0xFC, 0xD1, 0x3D, 0xB8, 0xF1, 0x51, 0x73, 0xCC, 0xB7, 0xB9, 0xFF,
+    0x9A, 0x7A, 0x39, 0xD9, 0x9A, 0x2B, 0xAB, 0x8E, 0x0B, 0x86, 0xE7, 0x70, 0xBB, 0x21, 0xB0, 0xEF,
+    0xF9, 0x57, 0xBF, 0x54, 0xFA, 0xAA, 0x69, 0x03, 0xD9, 0x58, 0xB9, 0xF1, 0xF7, 0xE6, 0x34, 0x00,
+    0x7B, 0xBC, 0x73, 0x86, 0xFD, 0x16, 0x03, 0x87, 0x0C, 0x07, 0xC6, 0x4E, 0x3D, 0xC5, 0xD8, 0xA9,
+    0xA7, 0x3C, 0xC3, 0x01, 0x73, 0x3D, 0xF1, 0x99, 0x0D, 0x44, 0x24, 0xD9, 0x39, 0xD9, 0x63, 0x17,
+    0x5E, 0x3C, 0x0A, 0x91, 0x05, 0x79, 0xFE, 0xFE, 0x8F, 0x3A, 0x36, 0xC8, 0x13, 0xC8, 0xEB, 0xDF,
+    0xBA, 0x6F, 0x83, 0x3C, 0xC1, 0xA9, 0xAF, 0x4A, 0xD6, 0x11, 0x60, 0x3A, 0x12, 0xC1, 0x07, 0xE5,
+    0x60, 0x13, 0x16, 0x20, 0x10, 0xEB, 0x5D, 0x69, 0xB2, 0xA5, 0x6D, 0x9E, 0x8D, 0x80, 0x19, 0xCF,
+    0x05, 0x6C, 0x44, 0x76, 0x21, 0xB0, 0x4C, 0x31, 0xC3, 0x24, 0xFE, 0xF5, 0x90, 0xDA, 0x92, 0x4F,
+    0xDC, 0x7F, 0xD8, 0xEC, 0x6C, 0x80, 0xD7, 0x0A, 0x4A, 0xE7, 0xA5, 0xA8, 0x8E, 0x09, 0xBE, 0x98,
+    0x2C, 0xD0, 0x28, 0x91, 0x6F, 0xC0, 0x3F, 0x9D, 0xA2, 0x23, 0x6C, 0xC0, 0x16, 0x1C, 0x3B, 0x78,
+    0xBA, 0x26, 0x59, 0x41, 0xBA, 0x9E, 0xAC, 0x02, 0xFF, 0x07, 0x95, 0x99, 0x7F, 0x8C, 0x9C, 0xC7,
+    0x79, 0xDF, 0x3F, 0xEF, 0x0C, 0x8F, 0x2F, 0x79, 0xEF, 0xED, 0x0E, 0xFF, 0xA0, 0x5A, 0x8A, 0xDA,
+    0xBB, 0x57, 0x05, 0xE8, 0xE2, 0xC4, 0xEE, 0xDD, 0x9E, 0x90, 0x8D, 0xB5, 0x56, 0xDF, 0xBB, 0xF7,
+    0x25, 0x09, 0x87, 0x85, 0x95, 0x46, 0x57, 0x94, 0x2C, 0xD0, 0x04, 0x8D, 0x18, 0x57, 0x48, 0x53,
+    0xD5, 0xB1, 0x56, 0xC9, 0x39, 0x3E, 0xD7, 0x7B, 0xB7, 0x43, 0x31, 0x01, 0x81, 0x30, 0x88, 0x4E,
+    0x05, 0x8C, 0xB6, 0x76, 0x9A, 0x5C, 0x63, 0xB5, 0x10, 0x2F, 0x4E, 0xB8, 0x76, 0xAF, 0xCD, 0x39,
+    0x39, 0x6A, 0x87, 0x3C, 0x20, 0xD7, 0x8A, 0x46, 0xF8, 0xD2, 0x72, 0x21, 0xC0, 0x02, 0xA2, 0x37,
+    0xFA, 0x61, 0x03, 0xA4, 0x63, 0x8F, 0xC4, 0x4D, 0xF5, 0x92, 0x7A, 0x77, 0xA7, 0x7F, 0xEC, 0x91,
+    0x62, 0x2D, 0x1B, 0x70, 0xDF, 0xF7, 0x99, 0x99, 0xDD, 0xC1, 0xBE, 0xCF, 0xF3, 0xCE, 0x33, 0x33,
+    0xDF, 0x79, 0x9E, 0xEF, 0x7A, 0xDD, 0x4C, 0xB8, 0x82, 0x5B, 0xD0, 0x82, 0x09, 0xF0, 0x53, 0x70,
+    0x6F, 0x11, 0xB8, 0x94, 0x07, 0x06, 0x50, 0x33, 0xF8, 0xBD, 0x8F, 0xF8, 0xFD, 0x9A, 0x73, 0xA1,
+    0x73, 0xC2, 0xDD, 0x02, 0x60, 0xB3, 0x75, 0xF7, 0xDA, 0xDC, 0xBC, 0x18, 0x4D, 0x44, 0xD3, 0x0F,
+    0x1D, 0x06, 0x00, 0x61, 0xBD, 0x1F, 0x71, 0x0B, 0x2B, 0xAC, 0xE8, 0x81, 0x4C, 0x55, 0x32, 0x8B,
+    0x95, 0x46, 0x11, 0x61, 0xA5, 0x09, 0x69, 0x79, 0xD6, 0x37, 0xD3, 0x5E, 0xDE, 0xDD, 0x1A, 0x04,
+    0x2B, 0x8C, 0x9C, 0xD4, 0x28, 0x97, 0x51, 0x22, 0xA5, 0x44, 0xC6, 0xD8, 0xDD, 0xE2, 0xEC, 0x18,
+    0x59, 0x75, 0x8C, 0xAC, 0x5C, 0x19, 0x96, 0x4F, 0x57, 0x71, 0x45, 0x8E, 0xCB, 0xE6, 0x87, 0x86,
+    0x65, 0x32, 0x4A, 0x89, 0x49, 0xEA, 0x74, 0x48, 0x85, 0x91, 0x5F, 0x78, 0x02, 0xE5, 0x5C, 0xBF,
+    0x4E, 0x67, 0x3C, 0x15, 0xA6, 0x96, 0x04, 0x5C, 0xA4, 0xFA, 0x40, 0x0F, 0xD7, 0x4F, 0xA5, 0x4B,
+    0x9D, 0x73, 0xCA, 0xB9, 0x8C, 0x08, 0xA4, 0x81, 0x08, 0xE4, 0xEB, 0x29, 0xB1, 0x4B, 0x64, 0xD6,
+    0xA0, 0x25, 0x8C, 0x6F, 0xAA, 0x77, 0x1B, 0x69, 0xFC, 0x34, 0x02, 0x48, 0xF1, 0xA1, 0xB1, 0x33,
+    0xCE, 0x74, 0x33, 0x38, 0x96, 0x46, 0xD3, 0xBC, 0x63, 0xE5, 0x55, 0xAD, 0x5A, 0xC4, 0x29, 0x0E,
+    0xBF, 0x20, 0x2C, 0x58, 0xCE, 0xC5, 0xCD, 0x3C, 0x38, 0x93, 0x4F, 0x07, 0x79, 0xAE, 0x7A, 0xBB,
+    0x41, 0xA4, 0xF0, 0xC2, 0xF0, 0x39, 0x7A, 0x3C, 0xD9, 0xA3, 0x58, 0x17, 0xC5, 0x86, 0x2C, 0x36,
+    0x82, 0x62, 0x43, 0xB5, 0x5A, 0xB5, 0xA8, 0x35, 0x3B, 0xDB, 0x6A, 0xCD, 0xB6, 0x7A, 0xB3, 0xCB,
+    0x76, 0x2E, 0x4E, 0xE7, 0x62, 0xB3, 0x1C, 0x27, 0xCB, 0x1E, 0xA4, 0xCD, 0x60, 0xC0, 0xC1, 0x04,
+    0x80, 0x8E, 0xD8, 0xD2, 0x8D, 0xAA, 0x9F, 0x64, 0x9D, 0xE0, 0x71, 0x5A, 0x56, 0x0E, 0x08, 0x53,
+    0x0A, 0x02, 0x43, 0x4E, 0x9B, 0x76, 0xEA, 0x67, 0x9C, 0xE2, 0x4B, 0x8C, 0x77, 0xBC, 0xD7, 0x3E,
+    0x54, 0xFD, 0xD9, 0xDA, 0x6B, 0xAE, 0x4F, 0x46, 0x19, 0x32, 0x60, 0x37, 0x4C, 0xC1, 0x93, 0x3B,
+    0x6F, 0x84, 0xC8, 0xE9, 0x35, 0x27, 0xC5, 0x99, 0x2F, 0x16, 0xED, 0xEB, 0x67, 0xA1, 0x81, 0xEC,
+    0x1D, 0x50, 0xCE, 0xD4, 0xDE, 0xF2, 0x0C, 0xC2, 0x10, 0xF7, 0x11, 0x06, 0x69, 0x90, 0xBF, 0xAD,
+    0xA5, 0xB3, 0x32, 0xDB, 0x90, 0xA6, 0x21, 0x4D, 0x55, 0xEA, 0xAA, 0xD4, 0x55, 0xDF, 0x44, 0xBE,
+    0x99, 0xF5, 0xCD, 0x32, 0x5E, 0x1F, 0xCF, 0x02, 0x18, 0xA1, 0x65, 0xE2, 0x01, 0xDD, 0x41, 0x87,
+    0xF5, 0x9D, 0x7B, 0x83, 0x0D, 0x36, 0x10, 0x99, 0x7F, 0xFC, 0x58, 0x72, 0xCA, 0xD0, 0xB6, 0x15,
+    0xE4, 0xF3, 0xAB, 0xAE, 0x08, 0x72, 0xC0, 0xEF, 0xFB, 0x27, 0x85, 0x66, 0x1D, 0x95, 0xD1, 0xD5,
+    0xD8, 0x8F, 0x2D, 0xC5, 0x2E, 0x70, 0xC9, 0x64, 0xAB, 0x05, 0xFB, 0xEA, 0xF5, 0x7A, 0xBD, 0xDE,
+    0x68, 0x34, 0x5A, 0x53, 0x4A, 0x9D, 0xBD, 0xFC, 0xFC, 0x2A, 0x00, 0x75, 0x4A, 0xC8, 0x84, 0x94,
+    0x3A, 0x65, 0xA4, 0x26, 0xA3, 0x05, 0xEB, 0x32, 0x1D, 0x4D, 0x00, 0xCF, 0xF8, 0x54, 0x68, 0x7A,
+    0x26, 0xA0, 0x4A, 0x47, 0x98, 0x51, 0x1A, 0x22, 0x73, 0x62, 0x05, 0x55, 0xB0, 0x67, 0x8C, 0x3D,
+    0x63, 0x1C, 0x18, 0xE3, 0x80, 0xB2, 0xFB, 0xC7, 0xC6, 0xF6, 0x8F, 0x8D, 0x1D, 0x2A, 0x6D, 0x76,
+    0x54, 0x6F, 0xE8, 0x89, 0x64, 0x65, 0xAF, 0x48, 0x0E, 0xED, 0xA5, 0xEB, 0xDE, 0x48, 0x56, 0xFE,
+    0xA3, 0x38, 0xFD, 0x42, 0xF0, 0x27, 0x2B, 0xB5, 0xEC, 0xC7, 0xF8, 0x61, 0xF1, 0x43, 0x7E, 0x88,
+    0x7C, 0x13, 0xB1, 0x4A, 0x9D, 0x0A, 0x00, 0xA3, 0x81, 0xDC, 0x4E, 0xDE, 0x34, 0x8F, 0x1A, 0x95,
+    0x4A, 0x8B, 0xE3, 0x37, 0xEC, 0x78, 0x1C, 0x1C, 0xEB, 0xED, 0x85, 0x8C, 0x51, 0x00, 0x26, 0xC5,
+    0x75, 0xEF, 0xB6, 0xB9, 0xDE, 0xF9, 0xDA, 0x57, 0x16, 0x6E, 0x34, 0x1E, 0xFD, 0x9E, 0xBA, 0x28,
+    0x7F, 0x80, 0x2D, 0x89, 0x24, 0x9B, 0x91, 0x7D, 0x46, 0xEE, 0x4C, 0x90, 0x4C, 0xC6, 0x23, 0x71,
+    0x29, 0x8B, 0x94, 0xD4, 0x8B, 0xEB, 0xF2, 0x2A, 0xA1, 0x65, 0x80, 0x9F, 0xB1, 0x84, 0x6F, 0xBC,
+    0x5C, 0x3A, 0x62, 0x0D, 0x3C, 0x38, 0x52, 0x1F, 0xBD, 0xF7, 0x8E, 0x07, 0x18, 0x0C, 0x49, 0x40,
+    0xE0, 0xEC, 0xD3, 0x6B, 0x74, 0x08, 0xA0, 0xFB, 0x56, 0xA0, 0xD3, 0x75, 0x3F, 0x48, 0x9A, 0xCB,
+    0x17, 0xA4, 0xCB, 0xC2, 0x02, 0x18, 0x85, 0x8C, 0x32, 0x81, 0x4B, 0x15, 0xDC, 0x42, 0xDD, 0xD0,
+    0xBD, 0x92, 0xE2, 0xD4, 0xFA, 0x44, 0xE0, 0xB2, 0xB8, 0x0F, 0xC4, 0xCE, 0x3D, 0x7E, 0xFD, 0xC2,
+    0xB5, 0x9E, 0x9F, 0xD5, 0x64, 0x26, 0xDE, 0xC8, 0x98, 0xCE, 0xA8, 0x0D, 0x68, 0x2C, 0xD8, 0xEA,
+    0xF8, 0x78, 0xD9, 0x3F, 0xB6, 0x7D, 0x24, 0xFD, 0x6F, 0x66, 0x7D, 0x02, 0xA4, 0x2B, 0xA6, 0x82,
+    0xE4, 0x33, 0xA9, 0xC8, 0x79, 0xB9, 0x39, 0xF9, 0x87, 0xC7, 0x46, 0x2B, 0xCD, 0x55, 0x53, 0xD3,
+    0x8D, 0xCF, 0xD9, 0x46, 0xA7, 0xB1, 0xF0, 0xAE, 0xB3, 0xA1, 0xCB, 0xA6, 0xBD, 0x5E, 0x8B, 0x68,
+    0x91, 0xD9, 0x75, 0xA6, 0xD6, 0x99, 0xDA, 0x60, 0x76, 0x89, 0xCD, 0xD8, 0xE5, 0xCA, 0x59, 0xE1,
+    0x34, 0x50, 0x3B, 0x7A, 0xB6, 0x54, 0xFF, 0x1F, 0xCE, 0xBB, 0x6D, 0x23, 0x79, 0x36, 0xA9, 0x36,
+    0xBD, 0xED, 0xA4, 0x52, 0x17, 0x5B, 0xD7, 0x37, 0x42, 0xC7, 0xD3, 0x9A, 0x0F, 0x2E, 0x91, 0x83,
+    0xEC, 0x83, 0x70, 0x53, 0xD0, 0xF3, 0x0D, 0x1B, 0x58, 0x66, 0x99, 0x23, 0xC4, 0x37, 0x4A, 0xD3,
+    0x93, 0x29, 0x73, 0xC2, 0xE2, 0x9B, 0x1C, 0x7A, 0x4B, 0x10, 0xC7, 0x10, 0x38, 0x0D, 0x2E, 0x85,
+    0xD8, 0x42, 0x90, 0xEF, 0x68, 0x7A, 0x99, 0xA9, 0x0A, 0xB6, 0x21, 0x75, 0xA7, 0xEA, 0xA5, 0x56,
+    0x9E, 0xD5, 0x2A, 0x22, 0xB4, 0xC4, 0x9A, 0x02, 0x56, 0x47, 0xBB, 0xD9, 0x28, 0xAB, 0x78, 0x09,
+    0xDF, 0x75, 0xB7, 0xDE, 0x3E, 0xB1, 0xC0, 0x14, 0x41, 0x22, 0x32, 0x36, 0x98, 0x26, 0xD0, 0x22,
+    0x63, 0x93, 0x1A, 0x00, 0x65, 0xCA, 0x1F, 0x5E, 0xF3, 0xA1, 0xBB, 0xF6, 0xF6, 0x89, 0x71, 0x44,
+    0x4A, 0xDB, 0xBD, 0x7A, 0xFB, 0xC5, 0x69, 0x44, 0xC6, 0x34, 0x22, 0xA3, 0x86, 0xB0, 0xC4, 0xBD,
+    0x54, 0x26, 0xB5, 0x7E, 0x9D, 0x54, 0xEA, 0x32, 0x87, 0xD7, 0xFE, 0xBD, 0xEB, 0x37, 0x09, 0x60,
+    0x9D, 0x20, 0xA1, 0x9B, 0x07, 0x6F, 0xDB, 0x75, 0x79, 0x8E, 0x6A, 0xC7, 0xBB, 0x42, 0xB5, 0x13,
+    0x9E, 0x3B, 0x9A, 0x81, 0x93, 0x8C, 0xF1, 0xA8, 0xBE, 0xB6, 0x25, 0xC6, 0xC6, 0x66, 0x32, 0x75,
+    0xC4, 0xCE, 0xD2, 0x0A, 0x03, 0x23, 0xFF, 0x3A, 0xB3, 0xA8, 0x70, 0x0E, 0xBE, 0xFE, 0x9E, 0x41,
+    0xBA, 0x1E, 0xD4, 0x1C, 0xC3, 0xC1, 0xAA, 0x3E, 0xC3, 0x1E, 0xE7, 0x52, 0x62, 0xE7, 0x08, 0xDE,
+    0xBB, 0x5D, 0x88, 0x7E, 0xFC, 0x9C, 0xED, 0x9E, 0xCD, 0xDB, 0x06, 0xA8, 0x03, 0x32, 0x01, 0xD8,
+    0x7B, 0x60, 0x52, 0x6C, 0x8F, 0xF3, 0xB1, 0xAB, 0xF8, 0x7F, 0x0E, 0x4E, 0x13, 0x1A, 0xC2, 0x02,
+    0xE5, 0x8C, 0x5A, 0x2E, 0xD4, 0x73, 0xCF, 0x19, 0x78, 0x10, 0x76, 0x8D, 0x24, 0xDD, 0x9C, 0x29,
+    0xCA, 0x94, 0x47, 0x5A, 0x61, 0x8F, 0x29, 0x14, 0x2A, 0x7D, 0xDA, 0x15, 0xDD, 0x4C, 0x22, 0x39,
+    0xA8, 0x3D, 0x23, 0x18, 0x0B, 0x52, 0xCF, 0xC8, 0xC7, 0x36, 0xE3, 0x34, 0xF1, 0x4E, 0xA1, 0xA7,
+    0x88, 0x02, 0x6D, 0x5B, 0x72, 0x2B, 0x53, 0x21, 0x51, 0x8F, 0xF7, 0x8D, 0xDF, 0x27, 0xCC, 0x68,
+    0x6B, 0xE1, 0x74, 0xD0, 0xD5, 0xD3, 0x71, 0x92, 0xB7, 0x8F, 0xA5, 0xDD, 0xC7, 0x13, 0xA7, 0xF1,
+    0xA1, 0x72, 0xE8, 0x54, 0xDD, 0xFE, 0xB4, 0x79, 0x44, 0xC7, 0xCC, 0xD1, 0x4E, 0x3E, 0x9B, 0x3E,
+    0xD3, 0xEB, 0x5C, 0x44, 0xE2, 0x01, 0x65, 0x22, 0x99, 0x4C, 0xF0, 0x9A, 0xE2, 0x91, 0x2B, 0xC9,
+    0xF8, 0x4D, 0xE3, 0xB7, 0x8D, 0x70, 0x19, 0x7F, 0xDA, 0x67, 0xEA, 0x66, 0xA6, 0x5A, 0xCB, 0xF2,
+    0xF5, 0x20, 0xB3, 0x0C, 0x00, 0x99, 0x74, 0x3E, 0x5A, 0x91, 0x9F, 0xD5, 0x8F, 0x74, 0xE4, 0x80,
+    0xCF, 0x6E, 0xF8, 0xBF, 0x96, 0x3D, 0xA3, 0x4C, 0x70, 0xD4, 0xB6, 0x6F, 0xA6, 0xEA, 0x31, 0xAD,
+    0x42, 0xD4, 0x1C, 0xAA, 0x85, 0xEA, 0xA1, 0x2C, 0xA1, 0x25, 0x2C, 0x08, 0xBB, 0xD4, 0x62, 0x3D,
+    0xAD, 0xB2, 0xE9, 0x20, 0x9F, 0x93, 0x7D, 0x2F, 0x41, 0x1A, 0xDA, 0x39, 0x7F, 0xF7, 0x5B, 0x48,
+    0x8D, 0x3C, 0x9B, 0xC8, 0xDF, 0x47, 0x6E, 0x22, 0x2D, 0xB2, 0x87, 0x7F, 0x11, 0xFF, 0x0F, 0x12,
+    0xFF, 0x5C, 0xE6, 0x3F, 0x9B, 0xC7, 0xEE, 0xA8, 0x3D, 0x7C, 0xE1, 0x58, 0x8A, 0x0A, 0x34, 0x2A,
+    0x04, 0x35, 0x07, 0xAA, 0x05, 0xAA, 0x07, 0xCA, 0x42, 0x68, 0x21, 0x2C, 0x20, 0xEC, 0x42, 0x2D,
+    0xD6, 0x4C, 0xAB, 0x8C, 0xE9, 0x20, 0x67, 0x4E, 0xF6, 0x41, 0xBA, 0xC7, 0xA8, 0x2C, 0xF0, 0x53,
+    0xC6, 0xFB, 0x1E, 0x7E, 0x46, 0x98, 0xD0, 0x45, 0xBC, 0x4E, 0x50, 0x23, 0x8A, 0x99, 0x67, 0xFF,
+    0x3A, 0xD1, 0x5D, 0xC9, 0xEF, 0x88, 0x73, 0xFD, 0xA1, 0x14, 0x2C, 0xDD, 0x91, 0x36, 0xF8, 0xB0,
+    0x1B, 0x2A, 0xDE, 0x36, 0xCF, 0x98, 0x6A, 0x33, 0xA8, 0x88, 0x2B, 0xEE, 0x5D, 0x57, 0xAC, 0x07,
+    0x53, 0xE2, 0xB5, 0x64, 0x9D, 0xDD, 0x3B, 0x5B, 0x68, 0x02, 0xE5, 0xBE, 0xAB, 0xE5, 0xED, 0xB5,
+    0x0C, 0xCB, 0x06, 0x11, 0xD3, 0xA8, 0x24, 0xD0, 0x32, 0x15, 0x96, 0x1E, 0x5D, 0xD7, 0xA7, 0xE6,
+    0x5C, 0x12, 0x38, 0x97, 0x0A, 0xEB, 0xE5, 0x14, 0xCC, 0x11, 0x13, 0x6A, 0x65, 0xFC, 0x8C, 0x4E,
+    0x30, 0xE8, 0x04, 0x74, 0x02, 0x3A, 0x8A, 0x8E, 0xA2, 0xEB, 0xE8, 0x3A, 0xAC, 0xDA, 0x91, 0xB5,
+    0xB5, 0x04, 0xE7, 0x34, 0x56, 0x9A, 0x1F, 0x2A, 0x3F, 0xC8, 0xAC, 0xFC, 0xDB, 0x96, 0xF5, 0xCD,
+    0xB8, 0xF5, 0x4D, 0xD9, 0xFA, 0xBA, 0x3C, 0x6C, 0xCD, 0xA6, 0xF5, 0x4D, 0x0F, 0xA0, 0xEB, 0x34,
+    0x1D, 0xF9, 0xA3, 0xCB, 0xBA, 0x74, 0xD9, 0xBA, 0xCC, 0x16, 0x91, 0xBA, 0x8A, 0xAF, 0x4B, 0xF8,
+    0x49, 0x09, 0x5F, 0x57, 0xF1, 0x4F, 0xE7, 0x78, 0xC9, 0x3C, 0x80, 0x67, 0x87, 0xCE, 0xAE, 0x01,
+    0x11, 0x5D, 0xBD, 0x20, 0x4F, 0x67, 0x9D, 0x80, 0x8E, 0x2D, 0xD1, 0xB1, 0x25, 0x32, 0x5B, 0x92,
+    0xA6, 0xA7, 0x94, 0x5E, 0x0A, 0x5C, 0x35, 0x76, 0x6E, 0x10, 0x38, 0x97, 0xB1, 0xEF, 0xCE, 0xF9,
+    0x4C, 0x0F, 0x3A, 0x41, 0x56, 0x2F, 0x95, 0xC6, 0x46, 0xC5, 0x71, 0x99, 0x5C, 0x33, 0x69, 0xA7,
+    0x31, 0x65, 0x03, 0xE7, 0x6C, 0xFB, 0x42, 0xB6, 0xE3, 0xB8, 0xA0, 0x4F, 0xBB, 0x2F, 0x7A, 0xF8,
+    0x06, 0x95, 0x10, 0xC2, 0x34, 0x4C, 0xC1, 0x34, 0xC4, 0x50, 0x33, 0x84, 0x83, 0x8B, 0xCA, 0xF5,
+    0xA5, 0xEB, 0xD3, 0xED, 0xC3, 0x83, 0xF0, 0x20, 0x32, 0x05, 0x3F, 0xAF, 0x9D, 0x88, 0x58, 0x60,
+    0x81, 0x05, 0x16, 0x99, 0x23, 0x2C, 0x44, 0x9F, 0x3D, 0x58, 0xE7, 0x06, 0xCE, 0x0D, 0x88, 0xD8,
+    0x91, 0xD6, 0xFF, 0x2B, 0x9B, 0x77, 0xA4, 0x80, 0x14, 0x56, 0xE8, 0xBA, 0x93, 0xCF, 0x24, 0x15,
+    0x7C, 0x3C, 0x43, 0x93, 0x2A, 0x01, 0xC2, 0xD0, 0x61, 0x86, 0x75, 0x66, 0x23, 0x5A, 0xD3, 0xF4,
+    0x94, 0x67, 0x83, 0xAD, 0x54, 0xBE, 0x66, 0x84, 0x4B, 0x70, 0x70, 0xF1, 0x1E, 0x15, 0x05, 0x5E,
+    0x41, 0x53, 0xFE, 0xAE, 0xD8, 0x32, 0x76, 0xA1, 0x5E, 0xAE, 0xCA, 0xAB, 0x7C, 0x3E, 0x51, 0xE6,
+    0x2E, 0xA2, 0xFD, 0x38, 0x25, 0xCA, 0xA5, 0xA3, 0x83, 0x95, 0x7B, 0x95, 0x1C, 0xE0, 0xF9, 0x74,
+    0x5C, 0x09, 0xD3, 0x69, 0xF8, 0x67, 0x93, 0xC8, 0x8A, 0xBF, 0x42, 0x99, 0xC3, 0x83, 0x2F, 0x3B,
+    0xC7, 0x06, 0x81, 0xE6, 0x04, 0x80, 0x34, 0x64, 0x13, 0x44, 0xAC, 0x07, 0x89, 0xBC, 0x64, 0x09,
+    0x23, 0x70, 0x1A, 0x69, 0xA1, 0x0D, 0x2A, 0x47, 0xBC, 0x97, 0xB2, 0x54, 0x43, 0x99, 0x42, 0xDA,
+    0x20, 0x7B, 0x89, 0xD8, 0xC0, 0x18, 0x60, 0x80, 0x43, 0xE2, 0x88, 0x69, 0x96, 0x4B, 0x3C, 0xA2,
+    0x85, 0x25, 0x44, 0xE6, 0xBC, 0x6B, 0xA6, 0x95, 0x6F, 0x5A, 0x30, 0x0F, 0xCE, 0x31, 0xF2, 0xAB,
+    0xF3, 0xAB, 0xC2, 0x8C, 0x52, 0xE5, 0x47, 0x34, 0x53, 0x58, 0xE1, 0x5C, 0x56, 0x73, 0x03, 0x20,
+    0x83, 0x32, 0x90, 0x75, 0xAD, 0x1E, 0x93, 0xCC, 0x8C, 0x61, 0x66, 0x24, 0x66, 0x4C, 0xF2, 0xE8,
+    0x9F, 0xE0, 0xFA, 0x50, 0x87, 0x14, 0x38, 0x25, 0x9E, 0x4D, 0x95, 0x4F, 0x54, 0xC1, 0x36, 0xA5,
+    0x49, 0x95, 0xBC, 0x56, 0xC8, 0x81, 0x45, 0x1A, 0x14, 0x44, 0x90, 0x21, 0xBF, 0xC2, 0x48, 0x07,
+    0x61, 0x18, 0xD9, 0xB7, 0xAB, 0xE4, 0xCB, 0xC4, 0x98, 0xE6, 0xA1, 0xAA, 0x74, 0xC3, 0xA9, 0x18,
+    0x43, 0xAE, 0x32, 0xC9, 0x48, 0x93, 0x57, 0x19, 0x6F, 0x7A, 0xAF, 0x31, 0xDE, 0x39, 0xF2, 0xEA,
+    0xCF, 0xCE, 0x2E, 0x5D, 0x79, 0xC5, 0x0D, 0x82, 0xFF, 0x93, 0x8D, 0x4D, 0x73, 0x39, 0xDB, 0x35,
+    0x8D, 0xE4, 0x1B, 0x72, 0x66, 0xEC, 0x7F, 0xFE, 0xFA, 0xFB, 0x5B, 0xEF, 0x8B, 0xB1, 0x3D, 0x0B,
+    0x2B, 0x44, 0x28, 0xA4, 0xC1, 0x12, 0xA1, 0xBA, 0x5B, 0xBD, 0x45, 0xEB, 0x47, 0x5C, 0xE5, 0x11,
+    0x33, 0x6E, 0xFD, 0x96, 0x97, 0x55, 0x10, 0x86, 0xEA, 0xB0, 0x92, 0xBF, 0xAD, 0x63, 0x27, 0xB3,
+    0xC5, 0x48, 0x9E, 0x31, 0xD5, 0x86, 0xD8, 0xD2, 0xD5, 0x96, 0xDC, 0x36, 0x51, 0x4B, 0x1A, 0x76,
+    0xE7, 0xF0, 0xD2, 0xAF, 0xE2, 0xEB, 0x4A, 0x14, 0xD1, 0xB8, 0xFD, 0xB7, 0x3F, 0xFF, 0x8E, 0x73,
+    0xCE, 0x4C, 0x7F, 0x01, 0xD6, 0x87, 0x9B, 0xC2, 0xEF, 0x91, 0x04, 0x6E, 0x40, 0xE0, 0x72, 0x76,
+    0xBB, 0x84, 0x36, 0xC1, 0xB1, 0xD2, 0x4C, 0x50, 0x73, 0x45, 0x30, 0x4F, 0x15, 0x96, 0x3C, 0xBA,
+    0x05, 0xED, 0x14, 0xEF, 0x25, 0x08, 0xBE, 0x63, 0x98, 0xA0, 0x13, 0x45, 0xD4, 0x67, 0xBF, 0xFE,
+    0xCF, 0x36, 0x43, 0xE7, 0x0A, 0x6E, 0x9F, 0x00, 0x0B, 0x6C, 0x00, 0xCB, 0x40, 0xEC, 0x72, 0x94,
+    0xCB, 0xF1, 0x5C, 0x0A, 0x33, 0x0C, 0xCB, 0xF0, 0xBA, 0x48, 0x79, 0xB4, 0x9A, 0x8D, 0xB5, 0x5D,
+    0x3E, 0x3E, 0x4F, 0x1D, 0x7A, 0xBB, 0x3C, 0x67, 0x3D, 0xA7, 0x31, 0x78, 0x3F, 0x9C, 0x41, 0x30,
+    0x92, 0x00, 0xE9, 0x0C, 0xF8, 0x0E, 0x18, 0x4D, 0x3E, 0x38, 0xE4, 0xD5, 0x69, 0x3B, 0x4B, 0xA4,
+    0x7C, 0x23, 0xAC, 0xED, 0xA1, 0x1E, 0xAF, 0xC1, 0xD2, 0x4D, 0x83, 0x74, 0x39, 0x84, 0x0E, 0x70,
+    0x19, 0xA8, 0x01, 0xC3, 0x9E, 0xAE, 0x4B, 0x87, 0x88, 0xF5, 0xDE, 0xED, 0xBE, 0x37, 0x88, 0xAF,
+    0xDA, 0xF6, 0x56, 0x11, 0x1B, 0xEE, 0x03, 0xEA, 0xA5, 0x21, 0xF2, 0x7A, 0xAB, 0x77, 0x75, 0x8F,
+    0x78, 0xC9, 0xBC, 0xDC, 0xDA, 0x32, 0xE2, 0x95, 0x6D, 0xCD, 0xCD, 0xAB, 0xF0, 0xF9, 0xBF, 0x81,
+    0x5A, 0x3E, 0x04, 0x8F, 0x38, 0x07, 0x37, 0x40, 0x3A, 0xA7, 0xD5, 0x8D, 0x1B, 0x59, 0x7C, 0xEE,
+    0xCD, 0x7C, 0xDF, 0x88, 0x7C, 0x36, 0xAD, 0x2F, 0xCA, 0xC7, 0xF9, 0x4C, 0xE6, 0xB7, 0x68, 0x27,
+    0xC1, 0x6D, 0xD6, 0x97, 0x83, 0xA4, 0x67, 0xE5, 0x55, 0x22, 0x2B, 0x0D, 0x11, 0x61, 0x12, 0x64,
+    0x3C, 0x09, 0x6C, 0x1D, 0xAB, 0x8E, 0x99, 0x47, 0xBD, 0x5B, 0xFE, 0x44, 0xB5, 0xD4, 0x69, 0x90,
+    0x4E, 0x33, 0x2F, 0xD6, 0x56, 0x7C, 0x97, 0xF9, 0xFA, 0x1E, 0x39, 0x92, 0x05, 0x43, 0xF1, 0x32,
+    0xE5, 0x65, 0xA1, 0x37, 0x98, 0xF5, 0xFA, 0xD0, 0x82, 0x0D, 0x78, 0x01, 0xC2, 0x5E, 0xA5, 0x5E,
+    0xAD, 0x57, 0xEB, 0x93, 0xF5, 0xC9, 0x7A, 0xA3, 0xD1, 0x99, 0xA5, 0x42, 0x75, 0x1F, 0xFB, 0x27,
+    0x50, 0x81, 0x96, 0x97, 0x33, 0xEC, 0x06, 0xB3, 0xD3, 0xA8, 0xC7, 0xB4, 0xFC, 0xA6, 0xA5, 0xD7,
+    0x75, 0xFD, 0x9A, 0x73, 0x8F, 0x39, 0xF7, 0xA6, 0xF5, 0xF2, 0x82, 0xB9, 0x98, 0xF0, 0x75, 0xE3,
+    0xF7, 0xE0, 0x22, 0xC4, 0x09, 0xCE, 0x10, 0xAF, 0x00, 0x50, 0x15, 0xE7, 0xF8, 0x9A, 0xA9, 0x76,
+    0x54, 0x55, 0x5E, 0x71, 0xEF, 0xBA, 0xC2, 0xAA, 0x48, 0xBE, 0x4E, 0xCE, 0x34, 0x71, 0x32, 0xC2,
+    0xFF, 0x97, 0x81, 0xE7, 0x8C, 0x9F, 0xC1, 0x12, 0xD4, 0x20, 0xD0, 0xC8, 0x14, 0x56, 0xA1, 0x2A,
+    0xAE, 0xF0, 0x35, 0x53, 0xED, 0x04, 0xF7, 0x18, 0xB8, 0x8A, 0x65, 0x02, 0x3F, 0x11, 0x06, 0x0E,
+    0x79, 0x67, 0x74, 0xB5, 0x21, 0xB6, 0x92, 0x6A, 0x5D, 0x6C, 0xE9, 0x68, 0xEA, 0x01, 0xD3, 0xDD,
+    0x44, 0xDE, 0x5D, 0xE3, 0xC3, 0x4A, 0x23, 0x92, 0xFF, 0x25, 0x0F, 0x8D, 0xAD, 0x7C, 0xF5, 0xB5,
+    0xCB, 0xEF, 0x53, 0xF5, 0xAC, 0xBF, 0x13, 0x57, 0xC7, 0xF8, 0x69, 0x9C, 0xA8, 0x34, 0x36, 0x61,
+    0xD6, 0x36, 0xB5, 0xEC, 0xF3, 0xD9, 0x5C, 0xF6, 0x6F, 0xED, 0xB2, 0xFD, 0x5C, 0xEF, 0xB6, 0x6D,
+    0xF5, 0xDF, 0xB5, 0x9B, 0xDD, 0x77, 0xED, 0x66, 0xFC, 0xA6, 0xDD, 0xAC, 0x6D, 0xD9, 0xCD, 0x70,
+    0xAB, 0x57, 0xA8, 0x63, 0xBD, 0x02, 0xD9, 0x03, 0xE6, 0x80, 0x25, 0xA0, 0xB5, 0xB3, 0x88, 0x5F,
+    0x38, 0xE4, 0x9D, 0xB6, 0xEA, 0x78, 0xBA, 0x14, 0x6E, 0xF5, 0xFE, 0xFC, 0xE7, 0xBE, 0xF9, 0x97,
+    0x7F, 0x7A, 0x2E, 0xFE, 0xDD, 0xEA, 0xD2, 0xA2, 0x7D, 0xE7, 0xA6, 0xF1, 0x0D, 0xBE, 0x66, 0x1C,
+    0x3A, 0xC0, 0x27, 0xAF, 0x54, 0xBF, 0xB6, 0x3D, 0xFE, 0x99, 0x57, 0xFF, 0x05, 0xC0, 0xEA, 0x01,
+    0xC2, 0x3F, 0xC6, 0x1B, 0xDC, 0x13, 0x8B, 0xB2, 0x01, 0x31, 0x84, 0x29, 0xAA, 0x81, 0x7C, 0x0E,
+    0x71, 0x2D, 0xC5, 0x46, 0x2C, 0xAA, 0x64, 0xCA, 0xCB, 0x54, 0xD2, 0xF2, 0x9D, 0x3B, 0xE6, 0xDC,
+    0x3B, 0x96, 0xD6, 0x26, 0x4A, 0x97, 0x24, 0x69, 0xD3, 0xEF, 0xB3, 0x77, 0x27, 0xBE, 0x7F, 0x8F,
+    0xDB, 0xBD, 0x28, 0x38, 0x96, 0x2C, 0x34, 0xE5, 0x59, 0x1A, 0xCD, 0x60, 0xEB, 0x46, 0x51, 0x73,
+    0xE6, 0xA5, 0x4F, 0xC9, 0x4B, 0x19, 0x76, 0x83, 0xC9, 0xC3, 0x77, 0xAC, 0x04, 0x1A, 0x69, 0xF1,
+    0xFA, 0x70, 0x53, 0xD3, 0xB0, 0x4C, 0x8D, 0xA3, 0xA4, 0xF1, 0x75, 0x4F, 0xA4, 0x13, 0xF4, 0x7C,
+    0xD3, 0x76, 0xBD, 0xD8, 0xB9, 0x10, 0xFF, 0x8A, 0x21, 0x57, 0xC1, 0x11, 0xDB, 0x3B, 0xB8, 0xB3,
+    0x99, 0xE2, 0xA6, 0xBA, 0x70, 0xCC, 0xAC, 0xD7, 0xFD, 0xE3, 0x34, 0x9A, 0xF2, 0x2C, 0x9B, 0x73,
+    0xDD, 0xCB, 0xAE, 0x08, 0xBE, 0x63, 0x76, 0x14, 0x3B, 0xA7, 0x89, 0xDD, 0x2D, 0x84, 0x03, 0xCA,
+    0x9B, 0xC0, 0x57, 0x2D, 0xF8, 0x67, 0x0D, 0x44, 0xCA, 0x69, 0x2F, 0x8B, 0x07, 0x28, 0x7A, 0xD0,
+    0x92, 0x19, 0xD2, 0x39, 0x43, 0xE8, 0x9C, 0x4B, 0x7B, 0x38, 0x77, 0xCE, 0x48, 0xE7, 0xEE, 0x3A,
+    0x42, 0xBE, 0x17, 0x66, 0xEA, 0x42, 0x6F, 0x32, 0x0A, 0xCC, 0x58, 0xDD, 0xFF, 0xF6, 0xA0, 0x29,
+    0x07, 0xE7, 0x9B, 0x52, 0xD3, 0x0C, 0x0C, 0x73, 0xDD, 0x5B, 0x23, 0x35, 0xE7, 0xFA, 0xC1, 0x77,
+    0x5E, 0xCF, 0x61, 0xAF, 0x38, 0x7D, 0xDD, 0x84, 0x66, 0x68, 0xFE, 0xDD, 0xFF, 0x7D, 0xA2, 0x33,
+    0x3C, 0xC8, 0x5C, 0xF1, 0xDF, 0x4F, 0x56, 0x09, 0x10, 0xD7, 0x5F, 0xEC, 0xBA, 0x9A, 0x33, 0x80,
+    0x99, 0x09, 0x2E, 0x50, 0xBB, 0x1B, 0xFB, 0xD7, 0xB4, 0x3A, 0x2E, 0xF4, 0xE4, 0xC7, 0x2E, 0x6C,
+    0x0F, 0x5E, 0x6C, 0x22, 0x35, 0xF1, 0x11, 0xED, 0x0A, 0x31, 0x48, 0xC2, 0x5C, 0x3A, 0x7B, 0xE8,
+    0x09, 0x4D, 0x84, 0x77, 0x69, 0xAD, 0x88, 0xAF, 0x6F, 0x25, 0x8D, 0xB1, 0x80, 0xB6, 0x06, 0x6A,
+    0x6F, 0x85, 0xEE, 0xD9, 0x9F, 0xE9, 0x51, 0x46, 0x7C, 0xFB, 0xC2, 0xFB, 0xD7, 0x17, 0x4D, 0x65,
+    0x72, 0xDC, 0xEB, 0x03, 0xD1, 0x84, 0xBC, 0x9C, 0x3D, 0x74, 0xF8, 0x83, 0xA9, 0xF4, 0x9C, 0x8E,
+    0x9D, 0xF8, 0x78, 0x8E, 0x34, 0x54, 0x0E, 0x5E, 0xD8, 0x1A, 0x7C, 0xA5, 0x2E, 0xB5, 0xE9, 0xF8,
+    0xF9, 0x87, 0xB5, 0x7C, 0xCE, 0x54, 0x1A, 0x13, 0xCA, 0x9D, 0xB9, 0x9C, 0xAD, 0x3E, 0xC9, 0xDE,
+    0x51, 0x10, 0x99, 0x85, 0x9A, 0xBA, 0x07, 0xC0, 0xF2, 0x50, 0xA6, 0xD2, 0xD8, 0x16, 0x35, 0xA5,
+    0x12, 0x7A, 0xEF, 0x5A, 0xFC, 0xD7, 0x23, 0x88, 0x9D, 0xC6, 0x73, 0x76, 0x88, 0x5D, 0xB8, 0x6C,
+    0xD8, 0x13, 0xB8, 0x3E, 0xC2, 0xB9, 0x1E, 0xDD, 0xF6, 0x85, 0x34, 0x7C, 0xB3, 0x70, 0x7E, 0x11,
+    0x6F, 0x15, 0x1C, 0x9A, 0x84, 0xC5, 0x59, 0xD8, 0x9C, 0xFD, 0xE0, 0x25, 0xBD, 0x24, 0xF1, 0xCF,
+    0xFC, 0x10, 0x76, 0xC5, 0x3B, 0xD8, 0x55, 0xCB, 0xA1, 0xBB, 0x83, 0x5D, 0xAF, 0x0D, 0xB1, 0x6B,
+    0x31, 0x9A, 0x56, 0x9F, 0x78, 0x76, 0x05, 0x46, 0x92, 0xD0, 0x79, 0x5E, 0x46, 0x15, 0xE5, 0xFD,
+    0x42, 0xE2, 0x34, 0x8B, 0xF8, 0x88, 0x6F, 0xFF, 0xCC, 0xBB, 0x2E, 0x7F, 0xBA, 0xC7, 0xFD, 0xA3,
+    0xC1, 0x99, 0xAD, 0xBF, 0xEE, 0x01, 0xEC, 0x5E, 0xC5, 0x07, 0xCD, 0x8C, 0xE8, 0xE1, 0x43, 0x3A,
+    0x6D, 0x83, 0x1E, 0xD0, 0x2E, 0xEE, 0xFB, 0x14, 0x91, 0x67, 0x7D, 0x13, 0x58, 0xAA, 0x94, 0x29,
+    0x8F, 0x2F, 0xC7, 0xFD, 0xA0, 0x07, 0xF7, 0x9D, 0x68, 0x17, 0x54, 0x59, 0x17, 0x69, 0x90, 0x7A,
+    0x1B, 0x94, 0x28, 0x1F, 0x98, 0x8E, 0xFB, 0x41, 0x0E, 0x8C, 0x10, 0x3A, 0x7D, 0x27, 0xC0, 0x3A,
+    0xF1, 0xC3, 0x04, 0x48, 0x78, 0x2F, 0x01, 0x32, 0x7B, 0x97, 0x00, 0xE1, 0x3E, 0xE5, 0x0C, 0xC0,
+    0x6A, 0xF0, 0xA2, 0x7F, 0x43, 0xAE, 0x5D, 0x7E, 0xF9, 0xAB, 0xAF, 0x7C, 0x25, 0xBB, 0xD1, 0x99,
+    0xEB, 0xA9, 0x4D, 0x69, 0xEE, 0x1F, 0x65, 0x5A, 0x11, 0xDF, 0x71, 0x75, 0x8F, 0x17, 0x7E, 0x42,
+    0x5E, 0x65, 0x72, 0x54, 0x1D, 0xDF, 0xFA, 0xA6, 0xFD, 0xB1, 0xE9, 0xB7, 0x30, 0x19, 0xBD, 0x16,
+    0x0F, 0x1D, 0x04, 0xF0, 0xBA, 0x2B, 0xE2, 0xF6, 0x4B, 0xA2, 0xE7, 0xDB, 0x1E, 0x4B, 0x2D, 0xD4,
+    0x1F, 0xE3, 0xB9, 0x84, 0xD8, 0xA0, 0x7A, 0xC8, 0xBF, 0xC1, 0xBB, 0x91, 0x92, 0xBB, 0x3F, 0x2A,
+    0x6A, 0xCE, 0x09, 0xE7, 0x78, 0x60, 0x00, 0x30, 0xA5, 0xD4, 0xF1, 0x1D, 0x9E, 0xC2, 0xEB, 0x8B,
+    0x6B, 0x59, 0x5A, 0x69, 0xCA, 0x4F, 0x71, 0x83, 0x8F, 0xA5, 0x13, 0x73, 0x17, 0x02, 0xA7, 0xDB,
+    0x89, 0xF7, 0x52, 0xA2, 0x9C, 0x9D, 0x66, 0xA3, 0x45, 0xB4, 0xC8, 0x54, 0xD7, 0x0D, 0xBE, 0xCE,
+    0xD4, 0x22, 0xB3, 0xCB, 0x6C, 0xD6, 0xEE, 0xC9, 0x84, 0x77, 0xE7, 0xDE, 0x6D, 0xDB, 0x90, 0xDB,
+    0x49, 0xB5, 0xED, 0xB6, 0x93, 0x6A, 0x43, 0x6E, 0x5D, 0xCF, 0x43, 0x47, 0x4D, 0xEF, 0x3E, 0xAA,
+    0x83, 0x33, 0x46, 0x9D, 0x4D, 0xEF, 0x45, 0xA0, 0x9F, 0x50, 0xE9, 0x94, 0x12, 0x99, 0x3D, 0x7C,
+    0xF0, 0xCE, 0x53, 0x3F, 0xD6, 0xC6, 0x93, 0x93, 0x6C, 0x44, 0x14, 0x4B, 0x77, 0x92, 0xED, 0x01,
+    0xE1, 0xF1, 0x34, 0xC2, 0x36, 0x59, 0x84, 0xC8, 0x5B, 0xDB, 0xF4, 0x5C, 0x31, 0x0C, 0x57, 0xFB,
+    0x5E, 0xD1, 0x75, 0xBD, 0xD8, 0xD9, 0xC0, 0x25, 0xC0, 0x81, 0x51, 0x79, 0xCD, 0xCE, 0x0D, 0x13,
+    0x62, 0xBA, 0xFA, 0x50, 0x90, 0x10, 0x21, 0x8C, 0xEA, 0x23, 0x2E, 0xD1, 0xAA, 0x39, 0xBA, 0x9A,
+    0xFB, 0x84, 0x1B, 0x32, 0x2E, 0xA7, 0xBC, 0xB3, 0x49, 0x23, 0x92, 0xA7, 0xB3, 0x75, 0xA5, 0x58,
+    0xFC, 0x91, 0xAC, 0x16, 0xE0, 0xF2, 0x91, 0xBB, 0x3B, 0xAA, 0xEE, 0xBD, 0x62, 0xAA, 0x13, 0xD2,
+    0xD8, 0x86, 0x7F, 0x2E, 0x89, 0xAC, 0xE7, 0x50, 0x19, 0xCB, 0xF8, 0x29, 0x2D, 0x42, 0x1D, 0x5B,
+    0x99, 0x03, 0xDC, 0x3F, 0x2A, 0x32, 0x3B, 0x17, 0x0E, 0x69, 0x18, 0x26, 0xEB, 0xF2, 0x8C, 0x59,
+    0x98, 0x08, 0x12, 0x6B, 0xFD, 0xAB, 0xC4, 0x99, 0xD7, 0x47, 0x19, 0x36, 0x51, 0xDA, 0xB7, 0x7E,
+    0x9F, 0x65, 0x28, 0x07, 0xDE, 0x07, 0x58, 0xF9, 0x93, 0x1A, 0xF1, 0xF4, 0x6E, 0x91, 0x06, 0x62,
+    0x65, 0xF4, 0x8E, 0x2F, 0x39, 0xE0, 0xA5, 0x65, 0x22, 0xA9, 0xFD, 0x67, 0x53, 0xAC, 0x65, 0x22,
+    0x42, 0x0E, 0xA0, 0x9D, 0xA0, 0x0C, 0xC2, 0x42, 0x8E, 0x57, 0xE0, 0xF7, 0xF1, 0x72, 0x20, 0xF1,
+    0xE8, 0xC8, 0x4B, 0xD6, 0xBF, 0x97, 0xD3, 0x80, 0xBA, 0x97, 0x2A, 0x3A, 0x5E, 0x16, 0x11, 0x95,
+    0xF1, 0xCF, 0x25, 0xDC, 0x34, 0x84, 0x16, 0x99, 0xC3, 0x32, 0x84, 0x09, 0xBE, 0xC1, 0xCF, 0x88,
+    0x2D, 0x6A, 0x98, 0x8C, 0x44, 0x13, 0x2A, 0xB8, 0xFC, 0xEF, 0x56, 0x01, 0xAA, 0xBC, 0xC6, 0x47,
+    0x4D, 0xA9, 0x23, 0x3F, 0xE5, 0xDD, 0xE0, 0x73, 0xD9, 0x72, 0xEC, 0x9E, 0xBD, 0x95, 0xB1, 0xC8,
+    0x04, 0xBE, 0x9E, 0xDC, 0x1B, 0x85, 0xB3, 0x35, 0x80, 0x5D, 0x8C, 0xED, 0x1D, 0xDB, 0x3B, 0xB6,
+    0x77, 0xAC, 0x54, 0xFE, 0xB4, 0xFF, 0x7D, 0xCA, 0x94, 0xDB, 0xEE, 0x17, 0x4F, 0x1E, 0x4F, 0x44,
+    0xCA, 0xFA, 0x1D, 0x46, 0x63, 0x83, 0x69, 0x02, 0x23, 0x7A, 0xEC, 0xC6, 0xD3, 0x40, 0x9C, 0xA7,
+    0x32, 0x29, 0x51, 0x27, 0x93, 0x5A, 0xB1, 0x07, 0x90, 0x97, 0x52, 0xE4, 0xE5, 0x8C, 0xDD, 0xCF,
+    0xAE, 0xDE, 0xFB, 0xFA, 0xFB, 0x67, 0xA0, 0x75, 0x6F, 0xA9, 0x43, 0x2B, 0xCE, 0x69, 0x2D, 0x28,
+    0x5A, 0x0B, 0x92, 0xD6, 0x82, 0x4C, 0x5A, 0x0B, 0x21, 0xAD, 0xB6, 0x63, 0xA9, 0x9D, 0x73, 0xF1,
+    0xCE, 0x5A, 0x36, 0x77, 0x55, 0x74, 0xA8, 0x74, 0xA8, 0xAC, 0x53, 0x69, 0xBF, 0x55, 0x59, 0x18,
+    0xAF, 0x2C, 0xF8, 0x95, 0x85, 0xA0, 0xB2, 0xFC, 0x52, 0x25, 0xCE, 0xAB, 0xC0, 0x90, 0x69, 0x20,
+    0x22, 0xD0, 0x1B, 0xC8, 0x6B, 0x16, 0xEF, 0x66, 0x0A, 0x5D, 0x0D, 0x31, 0xC3, 0xE2, 0x0C, 0xE2,
+    0xBD, 0x0C, 0xFF, 0x8D, 0x1E, 0xCA, 0x14, 0xD4, 0x92, 0xF6, 0xFA, 0x32, 0xB5, 0x02, 0x82, 0xB7,
+    0x00, 0x1E, 0x14, 0x74, 0xAA, 0x5C, 0x33, 0xDE, 0x5F, 0x21, 0x2C, 0x81, 0xA6, 0x9D, 0xC8, 0xAB,
+    0x4C, 0x85, 0x5E, 0x56, 0x4B, 0x99, 0x06, 0x9E, 0x3A, 0xDF, 0x1D, 0x3C, 0x75, 0xBE, 0x3B, 0x78,
+    0x6A, 0xED, 0x7C, 0xD7, 0xF5, 0x9F, 0x5A, 0x5B, 0x3B, 0x5F, 0x73, 0xCE, 0xA5, 0x00, 0xCD, 0xFB,
+    0xCD, 0xBF, 0xF2, 0x7E, 0x6F, 0xB4, 0xF9, 0x90, 0xF9, 0xAF, 0xE2, 0x3F, 0x8C, 0x9E, 0xFA, 0xFB,
+    0xFA, 0x8B, 0xE2, 0x57, 0x4A, 0xAB, 0x1F, 0xD5, 0x29, 0x3C, 0xB5, 0xB6, 0x56, 0x73, 0x6E, 0x67,
+    0x14, 0x5D, 0xE7, 0x0E, 0xAE, 0xAD, 0xE9, 0x11, 0xFF, 0x9A, 0xDD, 0x9C, 0x1B, 0x4D, 0xF6, 0xAB,
+    0xCB, 0xB6, 0xA5, 0x8E, 0xAE, 0xDC, 0xF9, 0x1E, 0xC7, 0xC1, 0x95, 0x4B, 0xEF, 0xD8, 0xD9, 0xD9,
+    0xD1, 0x4F, 0x24, 0x18, 0x66, 0x18, 0x43, 0x82, 0x61, 0x86, 0xD2, 0xBC, 0x73, 0xF7, 0xA5, 0xF7,
+    0xD2, 0x9B, 0xF7, 0x7C, 0x10, 0xC9, 0x30, 0x4B, 0x4D, 0x29, 0xDD, 0x5B, 0xBD, 0x7D, 0xCC, 0x15,
+    0xFB, 0xEF, 0xED, 0xFB, 0xC5, 0xF9, 0x9A, 0x1B, 0x72, 0xBD, 0xE5, 0x1D, 0xAA, 0x71, 0x1F, 0xE0,
+    0x9D, 0x4C, 0x6A, 0x0E, 0x57, 0x48, 0x67, 0x95, 0x4B, 0xDB, 0xEE, 0xA8, 0x1B, 0x28, 0x97, 0xC7,
+    0xEE, 0x1D, 0xE7, 0x0C, 0x93, 0xC1, 0x1B, 0xF9, 0x2A, 0x1C, 0x98, 0x9D, 0x3B, 0x30, 0x3B, 0xF7,
+    0x49, 0x03, 0xF3, 0xF3, 0x72, 0xD7, 0xFC, 0xE4, 0x47, 0x12, 0xF3, 0xCF, 0x47, 0xB1, 0x4D, 0x64,
+    0x42, 0x15, 0x52, 0x02, 0x78, 0xE6, 0xE3, 0xF2, 0xB7, 0x4E, 0x54, 0x3E, 0xB2, 0x9A, 0xFD, 0xA1,
+    0x06, 0x46, 0xFC, 0x6B, 0xB6, 0x35, 0x37, 0x9A, 0x8C, 0x8C, 0xF8, 0xAF, 0x5E, 0x7B, 0xC7, 0xB6,
+    0x36, 0xE7, 0xE6, 0x46, 0x3F, 0x91, 0x00, 0xCC, 0x34, 0x26, 0x03, 0xFF, 0xD8, 0xE9, 0x34, 0xB3,
+    0x93, 0x07, 0x76, 0xF8, 0x50, 0x2F, 0xAD, 0xCA, 0x04, 0x98, 0x59, 0x8D, 0x3A, 0xE3, 0xD1, 0xEE,
+    0xD2, 0x10, 0xB7, 0x4E, 0x9B, 0x74, 0x6A, 0x5C, 0xD1, 0xE9, 0xD4, 0xE5, 0xD1, 0x23, 0x06, 0x90,
+    0xC9, 0x23, 0xC7, 0xCE, 0x26, 0x1C, 0xB9, 0x76, 0x2D, 0x6D, 0xF9, 0x66, 0x61, 0x57, 0x52, 0x15,
+    0xE9, 0xB8, 0x7A, 0xFC, 0x78, 0x92, 0xC0, 0x29, 0xD8, 0x54, 0x47, 0xAC, 0xCC, 0xF2, 0x16, 0x4A,
+    0x87, 0x09, 0xCB, 0x32, 0xC3, 0xEB, 0x15, 0x1C, 0x08, 0x1C, 0x32, 0x8D, 0xCD, 0xE2, 0x9C, 0x2C,
+    0x02, 0x8D, 0xB3, 0x2F, 0x52, 0xBB, 0x60, 0x08, 0xAC, 0x43, 0x14, 0x32, 0xA7, 0x9B, 0xA8, 0xAC,
+    0x96, 0xD9, 0xB6, 0x26, 0x64, 0x98, 0x05, 0x78, 0x9E, 0xE9, 0x54, 0x03, 0x69, 0x6C, 0xA4, 0xA4,
+    0xB1, 0xD1, 0x88, 0x77, 0xCC, 0x16, 0x31, 0xEC, 0x23, 0x20, 0xC8, 0xE5, 0x0F, 0xEC, 0x83, 0xEF,
+    0x6B, 0x15, 0x71, 0xD3, 0xA8, 0x88, 0x9B, 0x5A, 0x59, 0xFA, 0xD4, 0xB4, 0xB0, 0x43, 0xDA, 0xEE,
+    0x21, 0x80, 0x39, 0x64, 0x46, 0x8C, 0x6F, 0x79, 0xEA, 0x7C, 0x77, 0x80, 0xD0, 0xBF, 0xFE, 0xA5,
+    0xE3, 0x3D, 0xC0, 0x4B, 0xF8, 0xE5, 0x15, 0x22, 0xE4, 0xBF, 0x06, 0xCD, 0xFC, 0x9E, 0x9F, 0xFF,
+    0xE5, 0x0D, 0x25, 0xB2, 0x1B, 0x9F, 0x7C, 0x70, 0x7E, 0xD7, 0xCE, 0x12, 0xDF, 0x8B, 0x67, 0x98,
+    0x61, 0x14, 0x0C, 0x0D, 0x7C, 0x48, 0xA9, 0xE2, 0x27, 0x64, 0x54, 0x91, 0x3B, 0x78, 0x50, 0xCB,
+    0xFC, 0x5B, 0xF2, 0x86, 0xFD, 0xB3, 0x8B, 0x7B, 0xC4, 0x1B, 0x49, 0x0B, 0x69, 0x58, 0x47, 0xE1,
+    0xA5, 0x44, 0x04, 0x78, 0x19, 0x11, 0x0A, 0x91, 0x7A, 0x3D, 0x96, 0xA9, 0x25, 0x7E, 0xC6, 0x06,
+    0x21, 0x22, 0xA3, 0x45, 0xA0, 0x3D, 0xCB, 0x7E, 0xBC, 0x9D, 0x63, 0x21, 0x25, 0x1A, 0x76, 0x1D,
+    0x66, 0xB7, 0xDE, 0x81, 0x72, 0x79, 0xC3, 0xEE, 0xD7, 0xD3, 0x65, 0xE4, 0x96, 0xC6, 0x66, 0x44,
+    0x0D, 0x26, 0xCA, 0x28, 0x5F, 0x87, 0x47, 0xB2, 0x9A, 0x5E, 0x0C, 0xF4, 0x84, 0xC8, 0x02, 0xBD,
+    0x21, 0xB2, 0x49, 0xF6, 0xC3, 0x7E, 0x6F, 0x45, 0x25, 0x1B, 0x7E, 0x3A, 0x27, 0x72, 0x00, 0xD1,
+    0xC7, 0xBF, 0x91, 0xED, 0xD5, 0xB3, 0x3E, 0xFE, 0xB3, 0x86, 0xAC, 0xC3, 0x62, 0x95, 0xAA, 0x62,
+    0x42, 0x9A, 0x10, 0x1B, 0x13, 0x29, 0x94, 0x34, 0xD2, 0x58, 0xEC, 0x21, 0x76, 0xC1, 0x88, 0xD0,
+    0xCA, 0x58, 0x69, 0x67, 0x29, 0x00, 0xE6, 0x29, 0xE1, 0x19, 0x26, 0x91, 0x09, 0xCD, 0xE0, 0x31,
+    0x7A, 0xD9, 0xE8, 0x3F, 0xC6, 0x33, 0x44, 0x48, 0x4D, 0x93, 0x00, 0x32, 0xC6, 0x17, 0xC5, 0x15,
+    0x13, 0xBD, 0x28, 0x35, 0x0B, 0x28, 0xC8, 0x18, 0x47, 0x18, 0xEA, 0x00, 0xBB, 0xF6, 0x1C, 0xF9,
+    0xF8, 0x27, 0x7F, 0xED, 0x39, 0x93, 0xE0, 0xE9, 0xD5, 0xDF, 0x69, 0x6B, 0x73, 0x78, 0x8F, 0xE0,
+    0x45, 0xF1, 0x5C, 0xCA, 0xEE, 0x3D, 0xE2, 0xF9, 0xBF, 0x78, 0xF8, 0x9C, 0xE1, 0x70, 0xF2, 0xE0,
+    0x81, 0x92, 0xF4, 0xCC, 0xA9, 0x5D, 0x7B, 0xFE, 0xE9, 0xFE, 0xD6, 0xCC, 0xEF, 0x3D, 0xB3, 0x3A,
+    0xB2, 0xE7, 0x0B, 0x7B, 0xB6, 0x27, 0xCC, 0xBF, 0xB4, 0xEC, 0x93, 0x2E, 0x9D, 0x0B, 0xA4, 0xA9,
+    0x47, 0xF2, 0x8C, 0x69, 0x44, 0xC3, 0xCC, 0x79, 0xDB, 0xB4, 0xBC, 0xE4, 0xEF, 0x3D, 0x7B, 0x74,
+    0xEC, 0xB7, 0x7E, 0xEA, 0x57, 0xCC, 0x97, 0xCF, 0x3E, 0x56, 0x04, 0xE9, 0xAE, 0x00, 0x33, 0x33,
+    0xE6, 0xFB, 0xBD, 0xFB, 0x77, 0xAD, 0x1C, 0x28, 0x05, 0xEA, 0x58, 0x7E, 0x1F, 0xF3, 0xFB, 0xAB,
+    0xDE, 0x6F, 0x7E, 0xD9, 0xDE, 0x31, 0x3C, 0x73, 0x78, 0x97, 0xC7, 0x8B, 0xE2, 0x09, 0xC3, 0xEE,
+    0x7F, 0x24, 0x9E, 0xFF, 0x8B, 0x53, 0xDF, 0xF8, 0x25, 0x7B, 0x38, 0x39, 0x75, 0x68, 0x68, 0x59,
+    0xEC, 0x7F, 0xF8, 0xB4, 0x9D, 0xD9, 0xAE, 0x1C, 0xE4, 0x03, 0xDB, 0x66, 0x52, 0xD2, 0x29, 0x79,
+    0xA6, 0x2A, 0x75, 0x5D, 0x26, 0x0B, 0x7E, 0x52, 0x97, 0x49, 0x43, 0x9A, 0xAA, 0x97, 0x2A, 0x3A,
+    0xBE, 0x8E, 0x48, 0xEA, 0x9E, 0x29, 0xD1, 0x91, 0x49, 0x43, 0x98, 0x0A, 0x69, 0x99, 0xAC, 0x4C,
+    0x5A, 0xF2, 0x4C, 0x55, 0x9A, 0x46, 0x90, 0xD8, 0x09, 0x69, 0xF6, 0x03, 0xE0, 0x97, 0x08, 0xC6,
+    0x28, 0x57, 0x51, 0x7D, 0xBA, 0x7D, 0x51, 0x34, 0xFD, 0xBC, 0xA3, 0x16, 0xB2, 0xB0, 0x99, 0x4E,
+    0x7F, 0xD5, 0x4C, 0xBD, 0x61, 0xE2, 0x57, 0x74, 0xBC, 0x95, 0xD4, 0x5E, 0x25, 0x74, 0x7D, 0xE5,
+    0xFA, 0xBE, 0xEB, 0x07, 0xDD, 0x5B, 0xE5, 0x2A, 0xA5, 0x06, 0x95, 0x3A, 0xBB, 0xF6, 0xFD, 0x58,
+    0x06, 0x6B, 0xDA, 0xFB, 0xDE, 0xB4, 0x97, 0xC7, 0x9E, 0xA9, 0x5D, 0x36, 0xC3, 0x67, 0xA5, 0xEB,
+    0xD3, 0xBD, 0xB5, 0xB3, 0x6A, 0xE7, 0x89, 0x73, 0x99, 0x2E, 0x94, 0xA0, 0x8E, 0x77, 0xFB, 0x85,
+    0xC0, 0x65, 0x52, 0xF3, 0xF4, 0x79, 0xCF, 0x15, 0x2C, 0x20, 0x52, 0x96, 0x91, 0xEE, 0xBF, 0x28,
+    0xD7, 0x07, 0x12, 0x91, 0x79, 0x99, 0xB4, 0x5E, 0x26, 0x73, 0x91, 0xC9, 0x42, 0x64, 0xF2, 0xFB,
+    0x22, 0x93, 0xAF, 0xCB, 0xD4, 0xBF, 0x72, 0x26, 0x6D, 0x3B, 0xE7, 0x1E, 0xF8, 0xEE, 0x7B, 0x6F,
+    0x07, 0x97, 0x6E, 0xA6, 0x81, 0x79, 0xDF, 0x04, 0xA6, 0x6D, 0x02, 0x13, 0x1B, 0x65, 0x42, 0x23,
+    0xDD, 0x8A, 0x77, 0xFB, 0x25, 0x16, 0xE4, 0x96, 0x73, 0xFD, 0x40, 0xCF, 0x8A, 0x34, 0xA4, 0xEB,
+    0x92, 0x9A, 0x4B, 0x02, 0x8D, 0xC8, 0x20, 0x87, 0x18, 0x94, 0x41, 0x5A, 0x28, 0xE0, 0x60, 0xB2,
+    0x43, 0x6F, 0x0B, 0x03, 0x66, 0x06, 0x66, 0x4A, 0x30, 0x16, 0x50, 0x3B, 0xE3, 0xCC, 0x54, 0xE2,
+    0xCC, 0x5E, 0xE2, 0x0D, 0xA1, 0xCB, 0x3E, 0xCB, 0xFE, 0xE9, 0x74, 0xF7, 0x3B, 0x59, 0x83, 0xF1,
+    0xC5, 0xD0, 0xFB, 0xD2, 0x13, 0xBE, 0x71, 0xAF, 0x5E, 0xB2, 0xB5, 0xAC, 0x84, 0x4C, 0x52, 0x66,
+    0xCA, 0xF8, 0xAC, 0xD2, 0x0C, 0x76, 0x07, 0xD2, 0xB9, 0xE2, 0x1F, 0x5C, 0xF8, 0x81, 0x7E, 0x38,
+    0x4F, 0xE5, 0xA7, 0xBF, 0xC1, 0x3F, 0xFC, 0x4F, 0x46, 0xE6, 0x05, 0xB5, 0xC7, 0x8D, 0xB0, 0x39,
+    0x61, 0xA0, 0xBD, 0x6C, 0x81, 0xFB, 0xC0, 0x77, 0xE9, 0xAE, 0xA5, 0x27, 0x8E, 0x6C, 0x27, 0xD5,
+    0x4A, 0x93, 0x4B, 0xDB, 0xBB, 0x4B, 0x95, 0x66, 0xE7, 0xDA, 0xB6, 0x5F, 0xAA, 0x34, 0x9B, 0xDE,
+    0xB6, 0x4F, 0xA5, 0x39, 0x2B, 0xB7, 0x71, 0x05, 0xDE, 0x05, 0x83, 0x97, 0x30, 0x8A, 0x74, 0x7A,
+    0xE4, 0x2D, 0xF1, 0x5E, 0x32, 0x75, 0x11, 0xD3, 0xF3, 0x45, 0x5A, 0x0D, 0x58, 0x5C, 0xC2, 0xF5,
+    0xB8, 0xB8, 0x72, 0xF2, 0xE4, 0x51, 0x37, 0xCC, 0x26, 0x9F, 0xD2, 0x81, 0x63, 0x69, 0x97, 0x30,
+    0xA8, 0x7D, 0xD2, 0x59, 0x32, 0xE4, 0x6F, 0x7A, 0x2E, 0x27, 0x02, 0x8B, 0xB0, 0xF8, 0xCE, 0xF8,
+    0x0E, 0x4E, 0x38, 0xE7, 0x3E, 0x20, 0x0C, 0xE7, 0x0C, 0xDD, 0xC4, 0x2F, 0xF0, 0xE6, 0x0C, 0xDD,
+    0x44, 0x16, 0x78, 0x77, 0x99, 0xC3, 0x25, 0x70, 0x6F, 0xE1, 0xDF, 0xE8, 0x31, 0x8E, 0x3D, 0x38,
+    0xF8, 0xA3, 0xFC, 0xDF, 0xDC, 0xBE, 0xB0, 0x1A, 0x24, 0x9B, 0xD4, 0x5C, 0x4A, 0xB7, 0x8F, 0xC8,
+    0x20, 0xD0, 0xC3, 0xBC, 0xB8, 0x00, 0x69, 0x41, 0x99, 0xE1, 0x31, 0x8A, 0x97, 0xC0, 0x24, 0x08,
+    0xCD, 0x6E, 0x97, 0x49, 0x77, 0x83, 0x62, 0x92, 0xF0, 0xA8, 0x16, 0x76, 0x92, 0x39, 0xA1, 0x65,
+    0x76, 0x88, 0x39, 0xF1, 0x2D, 0x91, 0xD5, 0x06, 0x35, 0x71, 0xFC, 0x0D, 0x5B, 0x6F, 0xA8, 0x57,
+    0x8E, 0x1B, 0xE7, 0x0A, 0xE9, 0x9C, 0x09, 0xDC, 0x0A, 0x32, 0x19, 0xFE, 0xAB, 0x00, 0xC2, 0xAD,
+    0xA0, 0x5C, 0xCA, 0xBE, 0xD0, 0x80, 0x4A, 0x60, 0x0A, 0x58, 0x0F, 0x9C, 0x73, 0x5F, 0x5C, 0x5B,
+    0x3B, 0x0F, 0x08, 0xE7, 0xDC, 0x8D, 0xC1, 0xDA, 0xDA, 0x13, 0x6F, 0xFD, 0x1D, 0x62, 0x37, 0x20,
+    0x76, 0x7D, 0x1E, 0x70, 0xC3, 0xF0, 0xC6, 0x60, 0x82, 0xBC, 0xF6, 0xAD, 0xC8, 0x2C, 0x98, 0x05,
+    0xB3, 0x60, 0x16, 0xCD, 0x5C, 0x5A, 0x2B, 0xFC, 0x3E, 0xDA, 0xED, 0xB8, 0x0C, 0xE7, 0xDC, 0xDA,
+    0xC5, 0xF3, 0x1F, 0x90, 0xA7, 0x1F, 0xA6, 0x50, 0x97, 0x80, 0xEE, 0x40, 0x18, 0xD2, 0xEE, 0x40,
+    0x98, 0x6E, 0xD2, 0x4D, 0xA4, 0xF1, 0x52, 0xCF, 0x7A, 0xD6, 0xEB, 0x01, 0x19, 0xE5, 0x03, 0x38,
+    0xDD, 0xD6, 0xA3, 0x56, 0xAB, 0x42, 0xDC, 0xA2, 0x2B, 0x8C, 0x5D, 0x57, 0x17, 0xB9, 0xB5, 0xB3,
+    0xEC, 0x45, 0x42, 0x19, 0xCF, 0x69, 0xE5, 0x92, 0xDF, 0x78, 0x4E, 0xBC, 0x5C, 0x0D, 0x0E, 0x34,
+    0x27, 0x7F, 0xC9, 0xFC, 0xE7, 0xB3, 0xE2, 0x6C, 0x25, 0xA8, 0x34, 0xAB, 0xCF, 0x18, 0xE2, 0x1C,
+    0xFF, 0x7A, 0x8F, 0x05, 0x69, 0xFC, 0x64, 0x8A, 0x05, 0x61, 0x82, 0xA4, 0x15, 0x3A, 0x77, 0xDA,
+    0xB9, 0x74, 0x24, 0x47, 0x5C, 0xB8, 0x4E, 0xEC, 0x2C, 0xCA, 0x40, 0xC1, 0x9D, 0x06, 0x8D, 0x0F,
+    0x0B, 0x48, 0xCD, 0xEC, 0xC9, 0x7F, 0xE2, 0xDC, 0x37, 0x0D, 0x52, 0x23, 0x35, 0x72, 0x38, 0xAE,
+    0x07, 0xF1, 0x2D, 0x9F, 0x5F, 0x0F, 0x7E, 0x76, 0x61, 0x61, 0xA6, 0x89, 0x41, 0xC2, 0x18, 0xCC,
+    0x80, 0x81, 0x43, 0xD0, 0x81, 0x0E, 0x64, 0xF7, 0x9D, 0x7C, 0xC3, 0x39, 0xC3, 0x38, 0xA4, 0x94,
+    0x61, 0x18, 0x8C, 0xCD, 0xF0, 0xC1, 0xEF, 0x3D, 0x73, 0xE9, 0xF2, 0x2B, 0xE3, 0xDE, 0xF7, 0x53,
+    0xAF, 0x00, 0x0D, 0x24, 0xA4, 0x15, 0x52, 0xA1, 0x57, 0x69, 0xB4, 0x9D, 0xFB, 0x39, 0x84, 0x4E,
+    0x85, 0x19, 0xF3, 0x86, 0xA1, 0x4B, 0xC2, 0x06, 0xDF, 0x37, 0xAF, 0x54, 0xF6, 0x5D, 0xDA, 0x09,
+    0x4B, 0xE6, 0x4D, 0xF9, 0x61, 0x33, 0x30, 0x81, 0x21, 0xE1, 0xF0, 0x20, 0xFC, 0x82, 0x9F, 0x79,
+    0x7F, 0xC9, 0xA9, 0x6C, 0xB2, 0x3C, 0x4A, 0xC6, 0x9E, 0xF8, 0xBC, 0xF7, 0x0B, 0x46, 0x5A, 0xF9,
+    0x3B, 0xF2, 0x8C, 0xD4, 0x5B, 0xFA, 0xA7, 0x35, 0xFB, 0x18, 0xE7, 0x48, 0x3A, 0x53, 0xAD, 0x88,
+    0x6D, 0xE6, 0xB4, 0xCC, 0x86, 0x81, 0xBE, 0xB7, 0x5F, 0xBE, 0x2C, 0x2E, 0x5D, 0x32, 0x0F, 0xA7,
+    0xA5, 0x54, 0x66, 0xB8, 0x1C, 0xF8, 0xBF, 0x6D, 0x91, 0xB1, 0x6B, 0x64, 0x55, 0x14, 0xC6, 0x7F,
+    0xF7, 0x1D, 0xC9, 0x1D, 0xF3, 0x66, 0xDE, 0xCB, 0x8A, 0x2C, 0xC1, 0x4C, 0x66, 0x36, 0x6A, 0xB1,
+    0xC5, 0xC4, 0xD9, 0x22, 0xC8, 0x2B, 0x26, 0x93, 0xBB, 0xFF, 0x41, 0x14, 0x7B, 0xE3, 0x5F, 0x90,
+    0x14, 0x53, 0x4C, 0x11, 0x92, 0x9B, 0x65, 0x89, 0x45, 0x9A, 0x14, 0x5A, 0x0A, 0x41, 0xAC, 0x56,
+    0xD8, 0x0C, 0xB2, 0xC5, 0x22, 0x6E, 0xE6, 0xEA, 0x16, 0x82, 0xD5, 0x0B, 0xD8, 0x0A, 0x57, 0x54,
+    0x16, 0x44, 0xF0, 0x2A, 0xB3, 0x30, 0x64, 0x27, 0xEF, 0x5A, 0x24, 0x8A, 0xC5, 0x7E, 0x7C, 0x1C,
+    0x38, 0x9C, 0x73, 0xBE, 0xEF, 0x70, 0x0E, 0x06, 0xE5, 0x10, 0x4B, 0x0A, 0xDD, 0x58, 0xED, 0x40,
+    0x01, 0x79, 0xAC, 0xB4, 0x45, 0x39, 0x30, 0x70, 0x03, 0x8A, 0x1D, 0xFA, 0x6D, 0xD6, 0x0F, 0x47,
+    0x9D, 0x95, 0xA3, 0x66, 0x6D, 0xEB, 0x24, 0x59, 0x84, 0x43, 0x58, 0xB1, 0xD4, 0xB6, 0xB8, 0x4E,
+    0x14, 0xC8, 0xD5, 0xCC, 0x68, 0x1C, 0xA7, 0x90, 0x41, 0x67, 0x1C, 0x27, 0xA8, 0x12, 0xB1, 0x28,
+    0x58, 0x31, 0xFF, 0xEB, 0x5E, 0xB1, 0xD4, 0xB6, 0x74, 0xB2, 0xF8, 0x76, 0x38, 0x5C, 0xCD, 0x3F,
+    0xFA, 0x8C, 0xE9, 0x2E, 0x59, 0x13, 0xEE, 0x03, 0x80, 0x59, 0xA0, 0x29, 0x56, 0x6C, 0x93, 0x11,
+    0xA3, 0x6E, 0x8C, 0x1F, 0x43, 0x56, 0x90, 0xB8, 0x18, 0x83, 0xB6, 0xCB, 0x34, 0xC5, 0x62, 0x16,
+    0x60, 0x0B, 0xED, 0x19, 0x84, 0xF4, 0xBB, 0xC7, 0xEF, 0xD6, 0x76, 0x6A, 0xB7, 0xB8, 0x65, 0xB9,
+    0xC7, 0x6B, 0xB5, 0x1B, 0xB3, 0xB7, 0xCE, 0xC3, 0x94, 0x17, 0x86, 0x09, 0xD7, 0x98, 0x90, 0x38,
+    0xEA, 0xE0, 0x5E, 0xA9, 0xE7, 0xCF, 0x9F, 0x7E, 0xFB, 0xC7, 0x20, 0x3D, 0x62, 0x30, 0xD2, 0xFA,
+    0xDC, 0x6F, 0xCC, 0x38, 0x33, 0x00, 0xCC, 0x55, 0xA6, 0x4C, 0x7F, 0xBF, 0xF4, 0x69, 0x99, 0x7B,
+    0x29, 0xD5, 0x44, 0x05, 0x2A, 0x1E, 0xF1, 0xCC, 0xAE, 0xE3, 0x43, 0x8E, 0xEF, 0x89, 0xF3, 0x39,
+    0x8F, 0xBC, 0xB6, 0x5D, 0x2F, 0x5E, 0xAA, 0xD3, 0x40, 0x8C, 0x33, 0xFE, 0x8C, 0x33, 0xFC, 0xF6,
+    0x94, 0x85, 0x7F, 0xBD, 0xD6, 0x61, 0x0F, 0x5E, 0xA0, 0x9E, 0x59, 0x79, 0xEA, 0xF4, 0x81, 0xCF,
+    0x4D, 0x68, 0xF3, 0x78, 0x9D, 0xDE, 0x2E, 0xFD, 0xB3, 0x07, 0xE3, 0x71, 0x8C, 0xE3, 0xF8, 0x97,
+    0x1F, 0x36, 0xC4, 0x96, 0xC5, 0xCB, 0xC2, 0xAB, 0x89, 0x79, 0x79, 0xA1, 0xA5, 0x8F, 0x62, 0x1C,
+    0x57, 0x3B, 0x2C, 0x32, 0x4F, 0x62, 0x39, 0xE6, 0x58, 0x6C, 0x46, 0xC1, 0xB8, 0x1A, 0x57, 0xC0,
+    0xEB, 0xFB, 0x15, 0xA0, 0xA2, 0xA3, 0x07, 0x62, 0x60, 0x04, 0x39, 0x28, 0x0F, 0xAB, 0x20, 0x0E,
+    0x76, 0x51, 0xB9, 0x65, 0x38, 0x41, 0x22, 0xB4, 0x3D, 0x5C, 0x42, 0xEA, 0x9F, 0xE4, 0x0F, 0xBF,
+    0xFE, 0x9E, 0xC9, 0x1B, 0xB6, 0x23, 0x27, 0x29, 0x3F, 0xE9, 0x8B, 0x5F, 0xE2, 0x69, 0xE8, 0xDE,
+    0x9B, 0x40, 0xEA, 0x91, 0x73, 0x18, 0x40, 0x0A, 0x04, 0xC8, 0x01, 0x0F, 0xCB, 0xA0, 0x4A, 0xE8,
+    0x40, 0xE2, 0xA0, 0x77, 0x25, 0x5E, 0x80, 0x36, 0x6C, 0x06, 0x36, 0x22, 0x49, 0x2C, 0x49, 0xBE,
+    0x80, 0xD5, 0x7E, 0x1F, 0x60, 0xB5, 0xDF, 0x4F, 0xED, 0x9B, 0x3F, 0xE8, 0xA2, 0xF8, 0xDC, 0x7C,
+    0x03, 0xCC, 0xE6, 0x7A, 0x83, 0xAF, 0xCC, 0x13, 0x00, 0x16, 0x10, 0xB8, 0x0D, 0x8E, 0xD6, 0x7B,
+    0x31, 0x3A, 0x31, 0x74, 0x50, 0x3F, 0xBF, 0x1F, 0xA3, 0x1B, 0x20, 0x96, 0x0E, 0x78, 0xFE, 0xC3,
+    0x3B, 0xA8, 0x33, 0xF4, 0x84, 0x76, 0x49, 0xD7, 0x90, 0x56, 0xB0, 0x54, 0x19, 0x96, 0x66, 0x90,
+    0x2A, 0x03, 0xF1, 0x62, 0x93, 0x9B, 0x0F, 0x01, 0xE4, 0x18, 0xF6, 0x0D, 0xAA, 0x02, 0x3D, 0x85,
+    0xB6, 0x63, 0x3B, 0x2C, 0x45, 0xDB, 0xFD, 0x95, 0x79, 0x03, 0x60, 0x6E, 0x8E, 0x27, 0x7B, 0x9F,
+    0x02, 0xA0, 0xFD, 0x7E, 0x86, 0xAF, 0x53, 0x36, 0x28, 0xF7, 0x63, 0xDC, 0x7E, 0xF0, 0x3C, 0xC3,
+    0x67, 0xF8, 0xD6, 0x35, 0x43, 0x8B, 0xD0, 0x52, 0x01, 0x4E, 0xD0, 0x6E, 0xAF, 0x2B, 0x96, 0x3A,
+    0xDC, 0x41, 0xC7, 0x46, 0xFA, 0xC9, 0x5A, 0x46, 0x59, 0xC8, 0x5D, 0xDF, 0xD0, 0x76, 0xAD, 0xA5,
+    0xFC, 0x50, 0x1F, 0xF8, 0x16, 0xB0, 0xA0, 0xA6, 0xCB, 0x78, 0xCD, 0x9D, 0xC4, 0xD5, 0x19, 0xB5,
+    0x67, 0x9D, 0xE4, 0xB7, 0x9C, 0x42, 0x5C, 0x46, 0xD0, 0xB6, 0xA7, 0x7C, 0xCE, 0x50, 0x5C, 0x8B,
+    0xA8, 0xED, 0x86, 0x03, 0xE6, 0x01, 0xED, 0xF6, 0xF4, 0xDF, 0xA1, 0x10, 0x4B, 0x9D, 0x12, 0x31,
+    0x6B, 0xE8, 0x18, 0xC3, 0xF9, 0xD9, 0x97, 0x3F, 0xAE, 0x65, 0xF8, 0x86, 0xD8, 0x42, 0xEE, 0xFA,
+    0x8C, 0x72, 0x28, 0xB6, 0x68, 0x11, 0x32, 0x6D, 0x7B, 0x72, 0xE0, 0xDB, 0x2A, 0x00, 0x8A, 0xF6,
+    0xC1, 0xAC, 0x81, 0xCF, 0x18, 0x08, 0x6B, 0xCA, 0x35, 0x28, 0x53, 0x15, 0xE3, 0xAC, 0x33, 0x77,
+    0x71, 0xBA, 0x39, 0x12, 0x5B, 0x24, 0x2E, 0xC3, 0xE7, 0x0C, 0xC5, 0xF6, 0x94, 0xBF, 0x5A, 0x42,
+    0x5C, 0x8B, 0x90, 0x87, 0xA1, 0x76, 0x1B, 0xEE, 0xFA, 0xB8, 0xF6, 0xEA, 0x9D, 0x89, 0xD3, 0x97,
+    0xDD, 0xB8, 0xFC, 0x81, 0xB8, 0xDB, 0x88, 0x5B, 0x45, 0x5C, 0xEE, 0xC5, 0x25, 0x95, 0x38, 0x72,
+    0x71, 0xCB, 0x1F, 0x4A, 0xB9, 0x11, 0xA5, 0xEA, 0x5E, 0x4A, 0xFC, 0x07,
 };
 
 static const EpdGlyph opendyslexic_8_regularGlyphs[] = {
@@ -1054,7 +1041,7 @@ static const EpdGlyph opendyslexic_8_regularGlyphs[] = {
     { 2, 15, 4, 1, 12, 8, 3043 }, // |
     { 8, 16, 9, 1, 13, 32, 3051 }, // }
     { 6, 4, 8, 1, 13, 6, 3083 }, // ~
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
+    { 0, 0, 14, 0, 0, 0, 3089 }, //  
     { 5, 18, 6, 0, 13, 23, 0 }, // ¡
     { 8, 16, 12, 2, 14, 32, 23 }, // ¢
     { 11, 16, 12, 0, 16, 44, 55 }, // £
@@ -1065,625 +1052,631 @@ static const EpdGlyph opendyslexic_8_regularGlyphs[] = {
     { 9, 3, 9, 0, 13, 7, 207 }, // ¨
     { 7, 7, 9, 1, 16, 13, 214 }, // ©
     { 6, 6, 7, 1, 13, 9, 227 }, // ª
-    { 9, 8, 11, 1, 8, 18, 236 }, // «
-    { 8, 5, 10, 1, 6, 10, 254 }, // ¬
-    { 8, 2, 9, 1, 6, 4, 264 }, // ­
-    { 7, 7, 9, 1, 18, 13, 268 }, // ®
-    { 7, 3, 9, 1, 13, 6, 281 }, // ¯
-    { 9, 8, 9, 0, 14, 18, 287 }, // °
-    { 8, 10, 10, 1, 9, 20, 305 }, // ±
-    { 5, 7, 5, 0, 14, 9, 325 }, // ²
-    { 5, 7, 5, 0, 14, 9, 334 }, // ³
-    { 3, 4, 5, 1, 13, 3, 343 }, // ´
-    { 10, 12, 13, 1, 10, 30, 346 }, // µ
-    { 8, 14, 10, 1, 12, 28, 376 }, // ¶
-    { 4, 3, 4, 0, 7, 3, 404 }, // ·
-    { 4, 5, 5, 1, 1, 5, 407 }, // ¸
-    { 5, 7, 5, 0, 14, 9, 412 }, // ¹
-    { 6, 6, 7, 1, 12, 9, 421 }, // º
-    { 9, 8, 11, 1, 8, 18, 430 }, // »
-    { 15, 16, 18, 2, 15, 60, 448 }, // ¼
-    { 15, 15, 18, 2, 14, 57, 508 }, // ½
-    { 15, 15, 18, 2, 14, 57, 565 }, // ¾
-    { 10, 19, 10, 0, 10, 48, 622 }, // ¿
-    { 13, 19, 19, 3, 19, 62, 670 }, // À
-    { 13, 22, 19, 3, 22, 72, 732 }, // Á
-    { 13, 20, 19, 3, 20, 65, 804 }, // Â
-    { 13, 19, 19, 3, 19, 62, 869 }, // Ã
-    { 13, 19, 19, 3, 19, 62, 931 }, // Ä
-    { 13, 20, 19, 3, 20, 65, 993 }, // Å
-    { 19, 16, 24, 3, 15, 76, 1058 }, // Æ
-    { 12, 20, 17, 2, 16, 60, 1134 }, // Ç
-    { 10, 19, 15, 3, 19, 48, 1194 }, // È
-    { 10, 22, 15, 3, 22, 55, 1242 }, // É
-    { 10, 19, 15, 3, 19, 48, 1297 }, // Ê
-    { 10, 19, 15, 3, 19, 48, 1345 }, // Ë
-    { 6, 20, 8, 0, 20, 30, 1393 }, // Ì
-    { 4, 23, 8, 2, 23, 23, 1423 }, // Í
-    { 7, 21, 8, 0, 21, 37, 1446 }, // Î
-    { 9, 20, 8, -1, 20, 45, 1483 }, // Ï
-    { 16, 15, 18, 0, 15, 60, 1528 }, // Ð
-    { 12, 18, 18, 3, 18, 54, 1588 }, // Ñ
-    { 13, 20, 19, 3, 19, 65, 1642 }, // Ò
-    { 13, 23, 19, 3, 22, 75, 1707 }, // Ó
-    { 13, 21, 19, 3, 20, 69, 1782 }, // Ô
-    { 13, 20, 19, 3, 19, 65, 1851 }, // Õ
-    { 13, 20, 19, 3, 19, 65, 1916 }, // Ö
-    { 8, 5, 10, 1, 7, 10, 1981 }, // ×
-    { 21, 31, 20, -1, 23, 163, 1991 }, // Ø
-    { 12, 20, 18, 3, 19, 60, 2154 }, // Ù
-    { 12, 23, 18, 3, 22, 69, 2214 }, // Ú
-    { 12, 21, 18, 3, 20, 63, 2283 }, // Û
-    { 12, 20, 18, 3, 19, 60, 2346 }, // Ü
-    { 12, 23, 18, 3, 23, 69, 2406 }, // Ý
-    { 9, 13, 9, 0, 13, 30, 2475 }, // Þ
-    { 10, 13, 11, 1, 13, 33, 2505 }, // ß
-    { 10, 14, 14, 2, 14, 35, 2538 }, // à
-    { 10, 17, 14, 2, 17, 43, 2573 }, // á
-    { 10, 15, 14, 2, 15, 38, 2616 }, // â
-    { 10, 14, 14, 2, 14, 35, 2654 }, // ã
-    { 10, 14, 14, 2, 14, 35, 2689 }, // ä
-    { 10, 15, 14, 2, 15, 38, 2724 }, // å
-    { 16, 11, 20, 2, 11, 44, 2762 }, // æ
-    { 8, 15, 12, 2, 11, 30, 2806 }, // ç
-    { 10, 16, 14, 2, 16, 40, 2836 }, // è
-    { 10, 19, 14, 2, 19, 48, 2876 }, // é
-    { 10, 16, 14, 2, 16, 40, 2924 }, // ê
-    { 10, 16, 14, 2, 16, 40, 2964 }, // ë
-    { 6, 14, 8, 0, 14, 21, 3004 }, // ì
-    { 4, 17, 8, 2, 17, 17, 3025 }, // í
-    { 7, 15, 8, 0, 15, 27, 3042 }, // î
-    { 9, 14, 8, -1, 14, 32, 3069 }, // ï
-    { 13, 14, 14, 1, 14, 46, 3101 }, // ð
-    { 10, 14, 14, 2, 14, 35, 3147 }, // ñ
-    { 10, 16, 14, 2, 16, 40, 3182 }, // ò
-    { 10, 19, 14, 2, 19, 48, 3222 }, // ó
-    { 10, 16, 14, 2, 16, 40, 3270 }, // ô
-    { 10, 16, 14, 2, 16, 40, 3310 }, // õ
-    { 10, 16, 14, 2, 16, 40, 3350 }, // ö
-    { 11, 10, 13, 1, 10, 28, 3390 }, // ÷
-    { 10, 27, 14, 2, 18, 68, 3418 }, // ø
-    { 9, 15, 13, 2, 15, 34, 3486 }, // ù
-    { 9, 18, 13, 2, 18, 41, 3520 }, // ú
-    { 9, 15, 13, 2, 15, 34, 3561 }, // û
-    { 9, 15, 13, 2, 15, 34, 3595 }, // ü
-    { 10, 24, 14, 2, 19, 60, 3629 }, // ý
-    { 8, 17, 9, 1, 14, 34, 3689 }, // þ
-    { 10, 21, 14, 2, 16, 53, 3723 }, // ÿ
-    { 13, 19, 19, 3, 19, 62, 0 }, // Ā
-    { 10, 14, 14, 2, 14, 35, 62 }, // ā
-    { 13, 21, 19, 3, 21, 69, 97 }, // Ă
-    { 10, 16, 14, 2, 16, 40, 166 }, // ă
-    { 13, 19, 19, 3, 14, 62, 206 }, // Ą
-    { 10, 15, 14, 2, 11, 38, 268 }, // ą
-    { 12, 24, 17, 2, 23, 72, 306 }, // Ć
-    { 8, 17, 12, 2, 16, 34, 378 }, // ć
-    { 12, 22, 17, 2, 21, 66, 412 }, // Ĉ
-    { 8, 16, 12, 2, 15, 32, 478 }, // ĉ
-    { 12, 23, 17, 2, 22, 69, 510 }, // Ċ
-    { 8, 16, 12, 2, 15, 32, 579 }, // ċ
-    { 12, 24, 17, 2, 23, 72, 611 }, // Č
-    { 8, 17, 12, 2, 16, 34, 683 }, // č
-    { 13, 21, 18, 3, 21, 69, 717 }, // Ď
-    { 13, 16, 14, 2, 15, 52, 786 }, // ď
-    { 16, 15, 18, 0, 15, 60, 838 }, // Đ
-    { 13, 16, 14, 2, 15, 52, 898 }, // đ
-    { 10, 19, 15, 3, 19, 48, 950 }, // Ē
-    { 10, 15, 14, 2, 15, 38, 998 }, // ē
-    { 10, 21, 15, 3, 21, 53, 1036 }, // Ĕ
-    { 10, 17, 14, 2, 17, 43, 1089 }, // ĕ
-    { 10, 20, 15, 3, 20, 50, 1132 }, // Ė
-    { 10, 16, 14, 2, 16, 40, 1182 }, // ė
-    { 10, 19, 15, 3, 15, 48, 1222 }, // Ę
-    { 10, 15, 14, 2, 10, 38, 1270 }, // ę
-    { 10, 21, 15, 3, 21, 53, 1308 }, // Ě
-    { 10, 17, 14, 2, 17, 43, 1361 }, // ě
-    { 14, 20, 19, 2, 20, 70, 1404 }, // Ĝ
-    { 9, 20, 13, 2, 15, 45, 1474 }, // ĝ
-    { 14, 21, 19, 2, 21, 74, 1519 }, // Ğ
-    { 9, 21, 13, 2, 16, 48, 1593 }, // ğ
-    { 14, 20, 19, 2, 20, 70, 1641 }, // Ġ
-    { 9, 20, 13, 2, 15, 45, 1711 }, // ġ
-    { 14, 22, 19, 2, 15, 77, 1756 }, // Ģ
-    { 9, 21, 13, 2, 16, 48, 1833 }, // ģ
-    { 12, 20, 18, 3, 20, 60, 1881 }, // Ĥ
-    { 12, 19, 14, 0, 19, 57, 1941 }, // ĥ
-    { 14, 15, 18, 2, 15, 53, 1998 }, // Ħ
-    { 12, 15, 14, 0, 15, 45, 2051 }, // ħ
-    { 7, 21, 8, 0, 21, 37, 2096 }, // Ĩ
-    { 7, 15, 8, 0, 15, 27, 2133 }, // ĩ
-    { 9, 20, 8, -1, 20, 45, 2160 }, // Ī
-    { 8, 14, 8, 0, 14, 28, 2205 }, // ī
-    { 4, 19, 10, 4, 15, 19, 2233 }, // Į
-    { 5, 19, 8, 1, 15, 24, 2252 }, // į
-    { 4, 21, 8, 2, 21, 21, 2276 }, // İ
-    { 3, 10, 8, 2, 10, 8, 2297 }, // ı
-    { 11, 19, 15, 2, 15, 53, 2305 }, // Ĳ
-    { 13, 20, 8, 2, 15, 65, 2358 }, // ĳ
-    { 8, 22, 13, 3, 18, 44, 2423 }, // Ĵ
-    { 9, 18, 11, 2, 14, 41, 2467 }, // ĵ
-    { 11, 21, 17, 3, 15, 58, 2508 }, // Ķ
-    { 10, 21, 14, 2, 14, 53, 2566 }, // ķ
-    { 8, 9, 11, 1, 9, 18, 2619 }, // ĸ
-    { 9, 20, 15, 3, 20, 45, 2637 }, // Ĺ
-    { 5, 20, 9, 2, 20, 25, 2682 }, // ĺ
-    { 9, 22, 15, 3, 15, 50, 2707 }, // Ļ
-    { 5, 21, 9, 2, 14, 27, 2757 }, // ļ
-    { 9, 15, 15, 3, 15, 34, 2784 }, // Ľ
-    { 7, 14, 9, 2, 14, 25, 2818 }, // ľ
-    { 9, 14, 15, 3, 14, 32, 2843 }, // Ŀ
-    { 7, 14, 9, 2, 14, 25, 2875 }, // ŀ
-    { 16, 23, 15, -4, 18, 92, 2900 }, // Ł
-    { 11, 14, 9, -3, 14, 39, 2992 }, // ł
-    { 12, 20, 18, 3, 20, 60, 3031 }, // Ń
-    { 10, 16, 14, 2, 16, 40, 3091 }, // ń
-    { 12, 21, 18, 3, 15, 63, 3131 }, // Ņ
-    { 10, 16, 14, 2, 10, 40, 3194 }, // ņ
-    { 12, 20, 18, 3, 20, 60, 3234 }, // Ň
-    { 10, 16, 14, 2, 16, 40, 3294 }, // ň
-    { 9, 18, 11, 1, 18, 41, 3334 }, // ŉ
-    { 12, 18, 18, 3, 15, 54, 3375 }, // Ŋ
-    { 10, 14, 14, 2, 10, 35, 3429 }, // ŋ
-    { 13, 20, 19, 3, 19, 65, 3464 }, // Ō
-    { 10, 15, 14, 2, 15, 38, 3529 }, // ō
-    { 13, 22, 19, 3, 21, 72, 3567 }, // Ŏ
-    { 10, 18, 14, 2, 18, 45, 3639 }, // ŏ
-    { 14, 21, 19, 3, 20, 74, 3684 }, // Ő
-    { 13, 17, 14, 1, 17, 56, 3758 }, // ő
-    { 19, 15, 20, 3, 15, 72, 3814 }, // Œ
-    { 17, 11, 18, 2, 11, 47, 3886 }, // œ
-    { 11, 20, 16, 3, 20, 55, 3933 }, // Ŕ
-    { 7, 14, 11, 2, 14, 25, 3988 }, // ŕ
-    { 11, 22, 16, 3, 14, 61, 4013 }, // Ŗ
-    { 8, 18, 11, 1, 9, 36, 4074 }, // ŗ
-    { 11, 20, 16, 3, 20, 55, 4110 }, // Ř
-    { 8, 14, 11, 1, 14, 28, 4165 }, // ř
-    { 13, 22, 19, 3, 21, 72, 4193 }, // Ś
-    { 9, 16, 13, 2, 16, 36, 4265 }, // ś
-    { 13, 21, 19, 3, 20, 69, 4301 }, // Ŝ
-    { 9, 15, 13, 2, 15, 34, 4370 }, // ŝ
-    { 13, 19, 19, 3, 15, 62, 4404 }, // Ş
-    { 9, 14, 13, 2, 10, 32, 4466 }, // ş
-    { 13, 23, 19, 3, 22, 75, 4498 }, // Š
-    { 9, 16, 13, 2, 16, 36, 4573 }, // š
-    { 12, 17, 18, 3, 14, 51, 4609 }, // Ţ
-    { 8, 16, 12, 2, 13, 32, 4660 }, // ţ
-    { 12, 20, 18, 3, 20, 60, 4692 }, // Ť
-    { 8, 14, 12, 2, 14, 28, 4752 }, // ť
-    { 12, 14, 18, 3, 14, 42, 4780 }, // Ŧ
-    { 9, 13, 12, 1, 13, 30, 4822 }, // ŧ
-    { 12, 21, 18, 3, 20, 63, 4852 }, // Ũ
-    { 9, 15, 13, 2, 15, 34, 4915 }, // ũ
-    { 12, 20, 18, 3, 19, 60, 4949 }, // Ū
-    { 9, 14, 13, 2, 14, 32, 5009 }, // ū
-    { 12, 22, 18, 3, 21, 66, 5041 }, // Ŭ
-    { 9, 16, 13, 2, 16, 36, 5107 }, // ŭ
-    { 12, 22, 18, 3, 21, 66, 5143 }, // Ů
-    { 9, 16, 13, 2, 16, 36, 5209 }, // ů
-    { 13, 21, 18, 3, 20, 69, 5245 }, // Ű
-    { 12, 15, 13, 1, 15, 45, 5314 }, // ű
-    { 12, 19, 18, 3, 15, 57, 5359 }, // Ų
-    { 9, 15, 13, 2, 10, 34, 5416 }, // ų
-    { 18, 19, 24, 3, 19, 86, 5450 }, // Ŵ
-    { 13, 15, 17, 2, 15, 49, 5536 }, // ŵ
-    { 12, 20, 18, 3, 20, 60, 5585 }, // Ŷ
-    { 10, 22, 14, 2, 17, 55, 5645 }, // ŷ
-    { 12, 20, 18, 3, 20, 60, 5700 }, // Ÿ
-    { 13, 20, 19, 3, 20, 65, 5760 }, // Ź
-    { 10, 16, 14, 2, 16, 40, 5825 }, // ź
-    { 13, 19, 19, 3, 19, 62, 5865 }, // Ż
-    { 10, 15, 14, 2, 15, 38, 5927 }, // ż
-    { 13, 20, 19, 3, 20, 65, 5965 }, // Ž
-    { 10, 16, 14, 2, 16, 40, 6030 }, // ž
-    { 6, 14, 9, 2, 14, 21, 6070 }, // ſ
-    { 6, 3, 0, 0, 13, 5, 0 }, // ̀
-    { 3, 4, 0, 1, 13, 3, 5 }, // ́
-    { 7, 4, 0, 1, 0, 7, 8 }, // ̂
-    { 6, 4, 0, 1, 13, 6, 15 }, // ̃
-    { 8, 3, 0, 1, 12, 6, 21 }, // ̄
-    { 11, 3, 0, 1, 15, 9, 27 }, // ̅
-    { 7, 5, 0, 1, 13, 9, 36 }, // ̆
-    { 4, 3, 0, 0, 13, 3, 45 }, // ̇
-    { 9, 3, 0, 0, 13, 7, 48 }, // ̈
-    { 4, 4, 0, 0, 11, 4, 55 }, // ̉
-    { 4, 4, 0, 1, 13, 4, 59 }, // ̊
-    { 13, 3, 0, 0, 13, 10, 63 }, // ̋
-    { 7, 4, 0, 1, 13, 7, 73 }, // ̌
-    { 13, 3, 0, -4, 14, 10, 80 }, // ̏
-    { 5, 5, 0, 0, 13, 7, 90 }, // ̒
-    { 5, 5, 0, 0, 12, 7, 97 }, // ̓
-    { 5, 5, 0, 0, 12, 7, 104 }, // ̔
-    { 3, 5, 0, 1, 0, 4, 111 }, // ̘
-    { 3, 5, 0, 1, 0, 4, 115 }, // ̙
-    { 7, 4, 0, 1, 13, 7, 119 }, // ̚
-    { 3, 4, 0, 1, 11, 3, 126 }, // ̛
-    { 2, 3, 0, 1, -1, 2, 129 }, // ̜
-    { 4, 3, 0, 1, 2, 3, 131 }, // ̝
-    { 4, 3, 0, 1, -1, 3, 134 }, // ̞
-    { 4, 4, 0, 1, -1, 4, 137 }, // ̟
-    { 8, 3, 0, 1, -2, 6, 141 }, // ̠
-    { 4, 3, 0, 0, 1, 3, 147 }, // ̣
-    { 9, 3, 0, 0, 0, 7, 150 }, // ̤
-    { 4, 4, 0, 1, 13, 4, 157 }, // ̥
-    { 5, 6, 0, 0, 3, 8, 161 }, // ̦
-    { 4, 5, 0, 1, 1, 5, 169 }, // ̧
-    { 4, 5, 0, 1, 0, 5, 174 }, // ̨
-    { 2, 5, 0, 1, -1, 3, 179 }, // ̩
-    { 6, 3, 0, 1, -1, 5, 182 }, // ̪
-    { 7, 4, 0, 1, 0, 7, 187 }, // ̬
-    { 7, 4, 0, 1, 0, 7, 194 }, // ̭
-    { 6, 4, 0, 1, 13, 6, 201 }, // ̰
-    { 7, 3, 0, 1, 13, 6, 207 }, // ̱
-    { 7, 3, 0, 1, -1, 6, 213 }, // ̲
-    { 6, 4, 0, 1, 13, 6, 219 }, // ̴
-    { 8, 2, 0, 1, 6, 4, 225 }, // ̵
-    { 2, 3, 0, 1, -1, 2, 229 }, // ̹
-    { 6, 4, 0, 1, 0, 6, 231 }, // ̺
-    { 5, 4, 0, 1, 0, 5, 237 }, // ̻
-    { 6, 4, 0, 1, 0, 6, 242 }, // ̼
-    { 5, 4, 0, 1, 13, 5, 248 }, // ̽
-    { 6, 4, 0, 1, 13, 6, 253 }, // ͂
-    { 3, 3, 0, 1, 14, 3, 259 }, // ̓
-    { 9, 8, 0, 0, 18, 18, 262 }, // ̈́
-    { 6, 3, 0, 1, 13, 5, 280 }, // ͆
-    { 8, 6, 0, 1, 0, 12, 285 }, // ͇
-    { 7, 5, 0, 1, 0, 9, 297 }, // ͈
-    { 5, 5, 0, 1, -1, 7, 306 }, // ͉
-    { 6, 10, 0, 1, 16, 15, 313 }, // ͊
-    { 14, 8, 0, 0, 15, 28, 328 }, // ͋
-    { 10, 9, 0, 1, 9, 23, 356 }, // ͌
-    { 9, 3, 0, 1, -2, 7, 379 }, // ͍
-    { 3, 3, 0, 1, 2, 3, 386 }, // ͎
-    { 14, 3, 0, 1, 0, 11, 389 }, // ͜
-    { 14, 3, 0, 1, 13, 11, 400 }, // ͡
-    { 17, 5, 0, 1, -1, 22, 411 }, // ͢
-    { 9, 17, 11, 1, 17, 39, 0 }, // Ѐ
-    { 9, 16, 11, 1, 16, 36, 39 }, // Ё
-    { 13, 14, 17, 2, 14, 46, 75 }, // Ђ
-    { 9, 20, 11, 1, 20, 45, 121 }, // Ѓ
-    { 12, 14, 15, 2, 13, 42, 166 }, // Є
-    { 13, 16, 19, 3, 15, 52, 208 }, // Ѕ
-    { 4, 15, 8, 2, 15, 15, 260 }, // І
-    { 8, 20, 8, -1, 20, 40, 275 }, // Ї
-    { 7, 19, 13, 3, 15, 34, 315 }, // Ј
-    { 16, 14, 19, 2, 13, 56, 349 }, // Љ
-    { 15, 13, 19, 2, 13, 49, 405 }, // Њ
-    { 14, 14, 18, 3, 14, 49, 454 }, // Ћ
-    { 11, 21, 17, 3, 21, 58, 503 }, // Ќ
-    { 12, 19, 18, 3, 19, 57, 561 }, // Ѝ
-    { 10, 20, 12, 1, 19, 50, 618 }, // Ў
-    { 10, 16, 12, 1, 12, 40, 668 }, // Џ
-    { 13, 14, 19, 3, 14, 46, 708 }, // А
-    { 9, 13, 11, 1, 13, 30, 754 }, // Б
-    { 10, 13, 11, 1, 13, 33, 784 }, // В
-    { 9, 12, 11, 1, 12, 27, 817 }, // Г
-    { 12, 14, 14, 1, 12, 42, 844 }, // Д
-    { 9, 12, 11, 1, 12, 27, 886 }, // Е
-    { 18, 15, 24, 3, 15, 68, 913 }, // Ж
-    { 9, 13, 11, 1, 13, 30, 981 }, // З
-    { 12, 15, 18, 3, 15, 45, 1011 }, // И
-    { 12, 20, 18, 3, 20, 60, 1056 }, // Й
-    { 11, 15, 17, 3, 15, 42, 1116 }, // К
-    { 10, 13, 12, 1, 12, 33, 1158 }, // Л
-    { 12, 12, 14, 1, 12, 36, 1191 }, // М
-    { 12, 15, 18, 3, 15, 45, 1227 }, // Н
-    { 13, 16, 19, 3, 15, 52, 1272 }, // О
-    { 9, 13, 11, 1, 13, 30, 1324 }, // П
-    { 10, 15, 15, 3, 15, 38, 1354 }, // Р
-    { 12, 17, 17, 2, 16, 51, 1392 }, // С
-    { 12, 14, 18, 3, 14, 42, 1443 }, // Т
-    { 10, 14, 12, 1, 13, 35, 1485 }, // У
-    { 13, 13, 15, 1, 13, 43, 1520 }, // Ф
-    { 13, 15, 19, 3, 15, 49, 1563 }, // Х
-    { 10, 16, 12, 1, 13, 40, 1612 }, // Ц
-    { 9, 12, 11, 1, 12, 27, 1652 }, // Ч
-    { 12, 13, 14, 1, 13, 39, 1679 }, // Ш
-    { 13, 16, 15, 1, 13, 52, 1718 }, // Щ
-    { 12, 12, 11, -2, 12, 36, 1770 }, // Ъ
-    { 16, 13, 19, 1, 13, 52, 1806 }, // Ы
-    { 9, 12, 11, 1, 12, 27, 1858 }, // Ь
-    { 12, 14, 15, 2, 13, 42, 1885 }, // Э
-    { 13, 13, 17, 2, 13, 43, 1927 }, // Ю
-    { 11, 14, 16, 3, 14, 39, 1970 }, // Я
-    { 10, 11, 14, 2, 11, 28, 2009 }, // а
-    { 10, 14, 12, 1, 14, 35, 2037 }, // б
-    { 8, 11, 12, 2, 11, 22, 2072 }, // в
-    { 8, 10, 10, 1, 10, 20, 2094 }, // г
-    { 11, 12, 13, 1, 10, 33, 2114 }, // д
-    { 10, 10, 14, 2, 10, 25, 2147 }, // е
-    { 16, 12, 20, 2, 12, 48, 2172 }, // ж
-    { 7, 9, 7, 0, 9, 16, 2220 }, // з
-    { 9, 10, 11, 1, 10, 23, 2236 }, // и
-    { 9, 13, 11, 1, 13, 30, 2259 }, // й
-    { 9, 10, 13, 2, 10, 23, 2289 }, // к
-    { 7, 10, 8, 1, 9, 18, 2312 }, // л
-    { 12, 11, 15, 2, 11, 33, 2330 }, // м
-    { 11, 11, 15, 2, 11, 31, 2363 }, // н
-    { 9, 10, 11, 1, 10, 23, 2394 }, // о
-    { 9, 10, 11, 1, 10, 23, 2417 }, // п
-    { 11, 15, 14, 1, 10, 42, 2440 }, // р
-    { 8, 12, 12, 2, 11, 24, 2482 }, // с
-    { 10, 9, 11, 1, 9, 23, 2506 }, // т
-    { 10, 15, 14, 2, 10, 38, 2529 }, // у
-    { 13, 14, 15, 1, 10, 46, 2567 }, // ф
-    { 10, 10, 12, 1, 10, 25, 2613 }, // х
-    { 10, 13, 12, 1, 10, 33, 2638 }, // ц
-    { 7, 9, 8, 0, 9, 16, 2671 }, // ч
-    { 12, 10, 14, 1, 10, 30, 2687 }, // ш
-    { 13, 13, 15, 1, 10, 43, 2717 }, // щ
-    { 11, 9, 13, 1, 9, 25, 2760 }, // ъ
-    { 12, 10, 14, 1, 10, 30, 2785 }, // ы
-    { 8, 10, 10, 1, 10, 20, 2815 }, // ь
-    { 9, 9, 11, 1, 9, 21, 2835 }, // э
-    { 11, 10, 13, 1, 10, 28, 2856 }, // ю
-    { 9, 9, 10, 1, 9, 21, 2884 }, // я
-    { 10, 16, 14, 2, 16, 40, 2905 }, // ѐ
-    { 9, 12, 11, 1, 12, 27, 2945 }, // ё
-    { 12, 18, 14, 0, 15, 54, 2972 }, // ђ
-    { 8, 14, 10, 1, 14, 28, 3026 }, // ѓ
-    { 9, 10, 11, 1, 9, 23, 3054 }, // є
-    { 9, 10, 13, 2, 10, 23, 3077 }, // ѕ
-    { 4, 15, 8, 2, 15, 15, 3100 }, // і
-    { 9, 14, 8, -1, 14, 32, 3115 }, // ї
-    { 7, 19, 11, 2, 15, 34, 3147 }, // ј
-    { 12, 10, 13, 1, 9, 30, 3181 }, // љ
-    { 11, 9, 13, 1, 9, 25, 3211 }, // њ
-    { 12, 15, 14, 0, 15, 45, 3236 }, // ћ
-    { 9, 15, 13, 2, 15, 34, 3281 }, // ќ
-    { 9, 14, 11, 1, 14, 32, 3315 }, // ѝ
-    { 10, 22, 14, 2, 17, 55, 3347 }, // ў
-    { 8, 12, 9, 0, 9, 24, 3402 }, // џ
-    { 10, 13, 14, 2, 12, 33, 3426 }, // Ѣ
-    { 10, 13, 12, 1, 12, 33, 3459 }, // ѣ
-    { 13, 12, 17, 2, 12, 39, 3492 }, // Ѫ
-    { 10, 9, 12, 1, 9, 23, 3531 }, // ѫ
-    { 12, 16, 18, 3, 15, 48, 3554 }, // Ѳ
-    { 10, 12, 14, 2, 12, 30, 3602 }, // ѳ
-    { 17, 19, 19, 3, 19, 81, 3632 }, // Ѵ
-    { 11, 12, 14, 2, 12, 33, 3713 }, // ѵ
-    { 6, 5, 0, 1, 15, 8, 3746 }, // ҆
-    { 9, 14, 11, 1, 14, 32, 3754 }, // Ґ
-    { 8, 12, 10, 1, 12, 24, 3786 }, // ґ
-    { 10, 12, 11, 0, 12, 30, 3810 }, // Ғ
-    { 7, 8, 8, 0, 8, 14, 3840 }, // ғ
-    { 10, 14, 11, 1, 14, 35, 3854 }, // Ҕ
-    { 7, 9, 7, 0, 9, 16, 3889 }, // ҕ
-    { 18, 18, 21, 2, 15, 81, 3905 }, // Җ
-    { 13, 12, 15, 1, 10, 39, 3986 }, // җ
-    { 8, 15, 12, 2, 13, 30, 4025 }, // Ҙ
-    { 7, 13, 7, 0, 9, 23, 4055 }, // ҙ
-    { 11, 17, 15, 2, 15, 47, 4078 }, // Қ
-    { 8, 12, 10, 1, 10, 24, 4125 }, // қ
-    { 13, 13, 16, 2, 13, 43, 4149 }, // Ҝ
-    { 10, 9, 12, 1, 9, 23, 4192 }, // ҝ
-    { 12, 15, 17, 2, 15, 45, 4215 }, // Ҟ
-    { 12, 14, 14, 0, 14, 42, 4260 }, // ҟ
-    { 16, 15, 17, -2, 15, 60, 4302 }, // Ҡ
-    { 11, 11, 12, -1, 11, 31, 4362 }, // ҡ
-    { 12, 17, 16, 2, 15, 51, 4393 }, // Ң
-    { 9, 13, 11, 1, 11, 30, 4444 }, // ң
-    { 17, 15, 18, 3, 15, 64, 4474 }, // Ҥ
-    { 12, 10, 12, 2, 10, 30, 4538 }, // ҥ
-    { 16, 14, 20, 2, 14, 56, 4568 }, // Ҧ
-    { 16, 16, 18, 1, 11, 64, 4624 }, // ҧ
-    { 16, 15, 20, 2, 14, 60, 4688 }, // Ҩ
-    { 13, 12, 16, 1, 11, 39, 4748 }, // ҩ
-    { 12, 19, 17, 2, 16, 57, 4787 }, // Ҫ
-    { 8, 13, 12, 2, 11, 26, 4844 }, // ҫ
-    { 12, 16, 16, 2, 14, 48, 4870 }, // Ҭ
-    { 9, 11, 11, 1, 10, 25, 4918 }, // ҭ
-    { 12, 14, 18, 3, 14, 42, 4943 }, // Ү
-    { 9, 12, 11, 1, 9, 27, 4985 }, // ү
-    { 12, 14, 18, 3, 14, 42, 5012 }, // Ұ
-    { 10, 13, 11, 0, 9, 33, 5054 }, // ұ
-    { 14, 18, 17, 2, 15, 63, 5087 }, // Ҳ
-    { 10, 12, 11, 1, 10, 30, 5150 }, // ҳ
-    { 14, 15, 18, 2, 12, 53, 5180 }, // Ҵ
-    { 11, 11, 13, 1, 8, 31, 5233 }, // ҵ
-    { 11, 16, 14, 1, 12, 44, 5264 }, // Ҷ
-    { 9, 12, 10, 0, 9, 27, 5308 }, // ҷ
-    { 10, 12, 12, 1, 12, 30, 5335 }, // Ҹ
-    { 7, 9, 8, 1, 9, 16, 5365 }, // ҹ
-    { 9, 14, 13, 2, 14, 32, 5381 }, // Һ
-    { 10, 15, 14, 2, 15, 38, 5413 }, // һ
-    { 15, 13, 16, 0, 13, 49, 5451 }, // Ҽ
-    { 11, 9, 12, 0, 9, 25, 5500 }, // ҽ
-    { 16, 16, 18, 1, 13, 64, 5525 }, // Ҿ
-    { 11, 12, 13, 1, 10, 33, 5589 }, // ҿ
-    { 4, 15, 8, 2, 15, 15, 5622 }, // Ӏ
-    { 18, 21, 24, 3, 21, 95, 5637 }, // Ӂ
-    { 16, 18, 20, 2, 18, 72, 5732 }, // ӂ
-    { 10, 17, 13, 2, 13, 43, 5804 }, // Ӄ
-    { 7, 12, 9, 1, 9, 21, 5847 }, // ӄ
-    { 12, 16, 12, 1, 13, 48, 5868 }, // Ӆ
-    { 8, 11, 9, 1, 9, 22, 5916 }, // ӆ
-    { 13, 20, 18, 3, 15, 65, 5938 }, // Ӈ
-    { 9, 14, 12, 2, 11, 32, 6003 }, // ӈ
-    { 13, 20, 18, 3, 15, 65, 6035 }, // Ӊ
-    { 9, 15, 12, 2, 11, 34, 6100 }, // ӊ
-    { 10, 15, 11, 0, 12, 38, 6134 }, // Ӌ
-    { 7, 11, 8, 1, 9, 20, 6172 }, // ӌ
-    { 16, 20, 21, 3, 15, 80, 6192 }, // Ӎ
-    { 11, 14, 14, 2, 10, 39, 6272 }, // ӎ
-    { 3, 12, 5, 1, 12, 9, 6311 }, // ӏ
-    { 13, 21, 19, 3, 21, 69, 6320 }, // Ӑ
-    { 10, 16, 14, 2, 16, 40, 6389 }, // ӑ
-    { 13, 19, 19, 3, 19, 62, 6429 }, // Ӓ
-    { 10, 15, 14, 2, 15, 38, 6491 }, // ӓ
-    { 19, 16, 24, 3, 15, 76, 6529 }, // Ӕ
-    { 16, 11, 20, 2, 11, 44, 6605 }, // ӕ
-    { 9, 18, 11, 1, 18, 41, 6649 }, // Ӗ
-    { 10, 17, 14, 2, 17, 43, 6690 }, // ӗ
-    { 10, 11, 14, 2, 10, 28, 6733 }, // Ә
-    { 9, 11, 14, 3, 10, 25, 6761 }, // ә
-    { 10, 18, 14, 2, 17, 45, 6786 }, // Ӛ
-    { 9, 12, 14, 3, 10, 27, 6831 }, // ӛ
-    { 18, 20, 22, 3, 20, 90, 6858 }, // Ӝ
-    { 16, 17, 20, 2, 17, 68, 6948 }, // ӝ
-    { 9, 17, 11, 1, 17, 39, 7016 }, // Ӟ
-    { 9, 14, 7, 0, 14, 32, 7055 }, // ӟ
-    { 8, 14, 10, 1, 13, 28, 7087 }, // Ӡ
-    { 8, 13, 10, 1, 9, 26, 7115 }, // ӡ
-    { 12, 18, 18, 3, 18, 54, 7141 }, // Ӣ
-    { 9, 13, 11, 1, 13, 30, 7195 }, // ӣ
-    { 12, 19, 18, 3, 19, 57, 7225 }, // Ӥ
-    { 9, 14, 11, 1, 14, 32, 7282 }, // ӥ
-    { 13, 20, 19, 3, 19, 65, 7314 }, // Ӧ
-    { 9, 15, 11, 1, 15, 34, 7379 }, // ӧ
-    { 12, 13, 18, 3, 12, 39, 7413 }, // Ө
-    { 10, 10, 14, 2, 10, 25, 7452 }, // ө
-    { 12, 20, 18, 3, 19, 60, 7477 }, // Ӫ
-    { 10, 16, 14, 2, 16, 40, 7537 }, // ӫ
-    { 12, 19, 15, 2, 18, 57, 7577 }, // Ӭ
-    { 10, 14, 11, 0, 14, 35, 7634 }, // ӭ
-    { 10, 18, 12, 1, 17, 45, 7669 }, // Ӯ
-    { 10, 21, 14, 2, 16, 53, 7714 }, // ӯ
-    { 10, 19, 12, 1, 18, 48, 7767 }, // Ӱ
-    { 10, 21, 14, 2, 16, 53, 7815 }, // ӱ
-    { 13, 19, 12, 0, 18, 62, 7868 }, // Ӳ
-    { 13, 22, 14, 1, 17, 72, 7930 }, // ӳ
-    { 9, 17, 11, 1, 17, 39, 8002 }, // Ӵ
-    { 8, 14, 8, -1, 14, 28, 8041 }, // ӵ
-    { 9, 15, 11, 1, 12, 34, 8069 }, // Ӷ
-    { 7, 10, 8, 0, 8, 18, 8103 }, // ӷ
-    { 16, 18, 19, 1, 18, 72, 8121 }, // Ӹ
-    { 12, 15, 14, 1, 15, 45, 8193 }, // ӹ
-    { 16, 17, 19, 3, 15, 68, 8238 }, // Ӽ
-    { 11, 12, 13, 2, 10, 33, 8306 }, // ӽ
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 22, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 22, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 8, 2, 9, 1, 6, 4, 0 }, // ‐
-    { 8, 2, 9, 1, 6, 4, 4 }, // ‑
-    { 12, 2, 12, 1, 6, 6, 8 }, // ‒
-    { 11, 3, 13, 1, 6, 9, 14 }, // –
-    { 17, 3, 19, 1, 6, 13, 23 }, // —
-    { 17, 3, 19, 1, 6, 13, 36 }, // ―
-    { 7, 15, 9, 1, 12, 27, 49 }, // ‖
-    { 13, 6, 13, 1, -1, 20, 76 }, // ‗
-    { 5, 6, 6, 0, 15, 8, 96 }, // ‘
-    { 5, 6, 6, 0, 15, 8, 104 }, // ’
-    { 5, 6, 5, 0, 3, 8, 112 }, // ‚
-    { 5, 6, 6, 0, 15, 8, 120 }, // ‛
-    { 9, 6, 9, 0, 15, 14, 128 }, // “
-    { 9, 6, 9, 0, 15, 14, 142 }, // ”
-    { 5, 6, 5, 0, 3, 8, 156 }, // „
-    { 9, 5, 9, 0, 15, 12, 164 }, // ‟
-    { 9, 22, 10, 0, 17, 50, 176 }, // †
-    { 10, 22, 10, 0, 17, 55, 226 }, // ‡
-    { 11, 10, 8, -1, 12, 28, 281 }, // •
-    { 5, 6, 7, 1, 8, 8, 309 }, // ‣
-    { 4, 3, 4, 0, 3, 3, 317 }, // ․
-    { 4, 3, 4, 0, 3, 3, 320 }, // ‥
-    { 15, 3, 16, 0, 3, 12, 323 }, // …
-    { 3, 2, 4, 1, 6, 2, 335 }, // ‧
-    { 0, 0, 21, 0, 0, 0, 337 }, //  
-    { 11, 15, 18, 4, 13, 42, 337 }, // ‰
-    { 5, 6, 5, 0, 15, 8, 379 }, // ′
-    { 9, 6, 9, 0, 15, 14, 387 }, // ″
-    { 14, 6, 14, 0, 14, 21, 401 }, // ‴
-    { 5, 6, 6, 0, 14, 8, 422 }, // ‵
-    { 8, 6, 9, 0, 14, 12, 430 }, // ‶
-    { 14, 6, 14, 0, 14, 21, 442 }, // ‷
-    { 7, 3, 9, 1, 13, 6, 463 }, // ‸
-    { 5, 8, 7, 1, 8, 10, 469 }, // ‹
-    { 5, 8, 7, 1, 8, 10, 479 }, // ›
-    { 18, 17, 22, 3, 15, 77, 489 }, // ※
-    { 5, 17, 6, 0, 17, 22, 566 }, // ‼
-    { 10, 21, 12, 1, 20, 53, 588 }, // ‽
-    { 8, 2, 9, 1, 14, 4, 641 }, // ‾
-    { 7, 4, 9, 1, 12, 7, 645 }, // ‿
-    { 11, 12, 13, 1, 16, 33, 652 }, // ⁂
-    { 10, 14, 18, 4, 13, 35, 685 }, // ⁄
-    { 19, 19, 21, 1, 19, 91, 720 }, // ⁇
-    { 13, 19, 17, 1, 19, 62, 811 }, // ⁈
-    { 13, 20, 13, 0, 19, 65, 873 }, // ⁉
-    { 10, 26, 12, 1, 18, 65, 938 }, // ⁒
-    { 0, 0, 80, 0, 0, 0, 1003 }, //  
-    { 5, 7, 5, 0, 14, 9, 0 }, // ⁰
-    { 5, 6, 5, 0, 14, 8, 9 }, // ⁴
-    { 5, 7, 5, 0, 14, 9, 17 }, // ⁵
-    { 5, 7, 5, 0, 14, 9, 26 }, // ⁶
-    { 5, 7, 6, 0, 14, 9, 35 }, // ⁷
-    { 5, 7, 6, 0, 14, 9, 44 }, // ⁸
-    { 5, 7, 6, 0, 14, 9, 53 }, // ⁹
-    { 10, 10, 14, 2, 10, 25, 62 }, // ⁿ
-    { 7, 9, 8, 0, 9, 16, 87 }, // ₀
-    { 5, 7, 5, 0, 4, 9, 103 }, // ₁
-    { 5, 7, 5, 0, 4, 9, 112 }, // ₂
-    { 5, 7, 5, 0, 4, 9, 121 }, // ₃
-    { 5, 7, 6, 0, 4, 9, 130 }, // ₄
-    { 5, 7, 5, 0, 4, 9, 139 }, // ₅
-    { 5, 7, 6, 0, 4, 9, 148 }, // ₆
-    { 5, 7, 5, 0, 4, 9, 157 }, // ₇
-    { 6, 7, 6, 0, 4, 11, 166 }, // ₈
-    { 5, 7, 6, 0, 4, 9, 177 }, // ₉
-    { 6, 23, 7, 1, 17, 35, 186 }, // ₍
-    { 6, 23, 7, 0, 17, 35, 221 }, // ₎
-    { 12, 23, 17, 2, 19, 69, 0 }, // ₡
-    { 12, 17, 17, 2, 16, 51, 69 }, // ₢
-    { 11, 16, 12, 0, 16, 44, 120 }, // ₤
-    { 16, 15, 18, 1, 15, 60, 164 }, // ₦
-    { 13, 15, 15, 1, 15, 49, 224 }, // ₧
-    { 17, 15, 19, 2, 15, 64, 273 }, // ₨
-    { 14, 15, 14, 0, 15, 53, 337 }, // ₩
-    { 14, 13, 18, 2, 13, 46, 390 }, // ₪
-    { 11, 14, 11, 1, 14, 39, 436 }, // ₫
-    { 11, 16, 12, 1, 14, 44, 475 }, // €
-    { 12, 14, 18, 3, 14, 42, 519 }, // ₮
-    { 15, 15, 11, 0, 15, 57, 561 }, // ₱
-    { 14, 21, 19, 2, 18, 74, 618 }, // ₲
-    { 15, 16, 15, 1, 15, 60, 692 }, // ₴
-    { 8, 13, 12, 2, 12, 26, 752 }, // ₵
-    { 12, 15, 18, 3, 15, 45, 778 }, // ₸
-    { 8, 13, 10, 1, 13, 26, 823 }, // ₹
-    { 10, 13, 11, 1, 12, 33, 849 }, // ₺
-    { 11, 13, 10, 0, 13, 36, 882 }, // ₼
-    { 14, 15, 15, -1, 15, 53, 918 }, // ₽
-    { 11, 11, 13, 1, 10, 31, 0 }, // ←
-    { 11, 10, 13, 1, 10, 28, 31 }, // ↑
-    { 11, 11, 13, 1, 10, 31, 59 }, // →
-    { 11, 10, 13, 1, 10, 28, 90 }, // ↓
-    { 13, 9, 15, 1, 9, 30, 118 }, // ↔
-    { 9, 13, 11, 1, 14, 30, 148 }, // ↕
-    { 9, 8, 11, 1, 8, 18, 178 }, // ↖
-    { 9, 8, 11, 1, 8, 18, 196 }, // ↗
-    { 9, 9, 11, 1, 9, 21, 214 }, // ↘
-    { 9, 9, 11, 1, 9, 21, 235 }, // ↙
-    { 12, 11, 14, 1, 10, 33, 256 }, // ⇐
-    { 13, 12, 15, 1, 12, 39, 289 }, // ⇑
-    { 12, 11, 14, 1, 10, 33, 328 }, // ⇒
-    { 13, 13, 15, 1, 12, 43, 361 }, // ⇓
-    { 14, 11, 16, 1, 10, 39, 404 }, // ⇔
-    { 11, 14, 13, 1, 9, 39, 443 }, // ⇕
-    { 10, 14, 11, 1, 14, 35, 0 }, // ∂
-    { 17, 17, 19, 1, 16, 73, 35 }, // ∅
-    { 12, 13, 14, 1, 13, 39, 108 }, // ∆
-    { 10, 12, 12, 1, 12, 30, 147 }, // ∏
-    { 10, 12, 12, 1, 12, 30, 177 }, // ∐
-    { 8, 13, 10, 1, 12, 26, 207 }, // ∑
-    { 8, 3, 10, 1, 6, 6, 233 }, // −
-    { 14, 14, 16, 1, 13, 49, 239 }, // √
-    { 13, 8, 15, 1, 10, 26, 288 }, // ∞
-    { 14, 19, 14, 0, 15, 67, 314 }, // ∫
-    { 4, 10, 5, 0, 10, 10, 381 }, // ∶
-    { 10, 9, 13, 1, 9, 23, 391 }, // ≈
-    { 11, 15, 18, 4, 13, 42, 414 }, // ≠
-    { 13, 13, 14, 1, 12, 43, 456 }, // ≤
-    { 13, 13, 14, 1, 12, 43, 499 }, // ≥
+    { 9, 8, 11, 1, 8, 18, 3089 }, // «
+    { 8, 5, 10, 1, 6, 10, 236 }, // ¬
+    { 8, 2, 9, 1, 6, 4, 246 }, // ­
+    { 7, 7, 9, 1, 18, 13, 250 }, // ®
+    { 7, 3, 9, 1, 13, 6, 263 }, // ¯
+    { 9, 8, 9, 0, 14, 18, 269 }, // °
+    { 8, 10, 10, 1, 9, 20, 287 }, // ±
+    { 5, 7, 5, 0, 14, 9, 307 }, // ²
+    { 5, 7, 5, 0, 14, 9, 316 }, // ³
+    { 3, 4, 5, 1, 13, 3, 325 }, // ´
+    { 10, 12, 13, 1, 10, 30, 328 }, // µ
+    { 8, 14, 10, 1, 12, 28, 358 }, // ¶
+    { 4, 3, 4, 0, 7, 3, 386 }, // ·
+    { 4, 5, 5, 1, 1, 5, 389 }, // ¸
+    { 5, 7, 5, 0, 14, 9, 394 }, // ¹
+    { 6, 6, 7, 1, 12, 9, 403 }, // º
+    { 9, 8, 11, 1, 8, 18, 3107 }, // »
+    { 15, 16, 18, 2, 15, 60, 412 }, // ¼
+    { 15, 15, 18, 2, 14, 57, 472 }, // ½
+    { 15, 15, 18, 2, 14, 57, 529 }, // ¾
+    { 10, 19, 10, 0, 10, 48, 586 }, // ¿
+    { 13, 19, 19, 3, 19, 62, 3125 }, // À
+    { 13, 22, 19, 3, 22, 72, 3187 }, // Á
+    { 13, 20, 19, 3, 20, 65, 3259 }, // Â
+    { 13, 19, 19, 3, 19, 62, 634 }, // Ã
+    { 13, 19, 19, 3, 19, 62, 3324 }, // Ä
+    { 13, 20, 19, 3, 20, 65, 696 }, // Å
+    { 19, 16, 24, 3, 15, 76, 761 }, // Æ
+    { 12, 20, 17, 2, 16, 60, 3386 }, // Ç
+    { 10, 19, 15, 3, 19, 48, 3446 }, // È
+    { 10, 22, 15, 3, 22, 55, 3494 }, // É
+    { 10, 19, 15, 3, 19, 48, 3549 }, // Ê
+    { 10, 19, 15, 3, 19, 48, 3597 }, // Ë
+    { 6, 20, 8, 0, 20, 30, 3645 }, // Ì
+    { 4, 23, 8, 2, 23, 23, 3675 }, // Í
+    { 7, 21, 8, 0, 21, 37, 3698 }, // Î
+    { 9, 20, 8, -1, 20, 45, 3735 }, // Ï
+    { 16, 15, 18, 0, 15, 60, 837 }, // Ð
+    { 12, 18, 18, 3, 18, 54, 3780 }, // Ñ
+    { 13, 20, 19, 3, 19, 65, 3834 }, // Ò
+    { 13, 23, 19, 3, 22, 75, 3899 }, // Ó
+    { 13, 21, 19, 3, 20, 69, 3974 }, // Ô
+    { 13, 20, 19, 3, 19, 65, 897 }, // Õ
+    { 13, 20, 19, 3, 19, 65, 4043 }, // Ö
+    { 8, 5, 10, 1, 7, 10, 962 }, // ×
+    { 21, 31, 20, -1, 23, 163, 972 }, // Ø
+    { 12, 20, 18, 3, 19, 60, 4108 }, // Ù
+    { 12, 23, 18, 3, 22, 69, 4168 }, // Ú
+    { 12, 21, 18, 3, 20, 63, 4237 }, // Û
+    { 12, 20, 18, 3, 19, 60, 4300 }, // Ü
+    { 12, 23, 18, 3, 23, 69, 1135 }, // Ý
+    { 9, 13, 9, 0, 13, 30, 1204 }, // Þ
+    { 10, 13, 11, 1, 13, 33, 1234 }, // ß
+    { 10, 14, 14, 2, 14, 35, 4360 }, // à
+    { 10, 17, 14, 2, 17, 43, 4395 }, // á
+    { 10, 15, 14, 2, 15, 38, 4438 }, // â
+    { 10, 14, 14, 2, 14, 35, 1267 }, // ã
+    { 10, 14, 14, 2, 14, 35, 4476 }, // ä
+    { 10, 15, 14, 2, 15, 38, 1302 }, // å
+    { 16, 11, 20, 2, 11, 44, 1340 }, // æ
+    { 8, 15, 12, 2, 11, 30, 4511 }, // ç
+    { 10, 16, 14, 2, 16, 40, 4541 }, // è
+    { 10, 19, 14, 2, 19, 48, 4581 }, // é
+    { 10, 16, 14, 2, 16, 40, 4629 }, // ê
+    { 10, 16, 14, 2, 16, 40, 4669 }, // ë
+    { 6, 14, 8, 0, 14, 21, 4709 }, // ì
+    { 4, 17, 8, 2, 17, 17, 4730 }, // í
+    { 7, 15, 8, 0, 15, 27, 4747 }, // î
+    { 9, 14, 8, -1, 14, 32, 4774 }, // ï
+    { 13, 14, 14, 1, 14, 46, 1384 }, // ð
+    { 10, 14, 14, 2, 14, 35, 4806 }, // ñ
+    { 10, 16, 14, 2, 16, 40, 4841 }, // ò
+    { 10, 19, 14, 2, 19, 48, 4881 }, // ó
+    { 10, 16, 14, 2, 16, 40, 4929 }, // ô
+    { 10, 16, 14, 2, 16, 40, 1430 }, // õ
+    { 10, 16, 14, 2, 16, 40, 4969 }, // ö
+    { 11, 10, 13, 1, 10, 28, 1470 }, // ÷
+    { 10, 27, 14, 2, 18, 68, 1498 }, // ø
+    { 9, 15, 13, 2, 15, 34, 5009 }, // ù
+    { 9, 18, 13, 2, 18, 41, 5043 }, // ú
+    { 9, 15, 13, 2, 15, 34, 5084 }, // û
+    { 9, 15, 13, 2, 15, 34, 5118 }, // ü
+    { 10, 24, 14, 2, 19, 60, 1566 }, // ý
+    { 8, 17, 9, 1, 14, 34, 1626 }, // þ
+    { 10, 21, 14, 2, 16, 53, 1660 }, // ÿ
+    { 13, 19, 19, 3, 19, 62, 1713 }, // Ā
+    { 10, 14, 14, 2, 14, 35, 1775 }, // ā
+    { 13, 21, 19, 3, 21, 69, 1810 }, // Ă
+    { 10, 16, 14, 2, 16, 40, 1879 }, // ă
+    { 13, 19, 19, 3, 14, 62, 1919 }, // Ą
+    { 10, 15, 14, 2, 11, 38, 1981 }, // ą
+    { 12, 24, 17, 2, 23, 72, 2019 }, // Ć
+    { 8, 17, 12, 2, 16, 34, 2091 }, // ć
+    { 12, 22, 17, 2, 21, 66, 2125 }, // Ĉ
+    { 8, 16, 12, 2, 15, 32, 2191 }, // ĉ
+    { 12, 23, 17, 2, 22, 69, 2223 }, // Ċ
+    { 8, 16, 12, 2, 15, 32, 2292 }, // ċ
+    { 12, 24, 17, 2, 23, 72, 2324 }, // Č
+    { 8, 17, 12, 2, 16, 34, 2396 }, // č
+    { 13, 21, 18, 3, 21, 69, 2430 }, // Ď
+    { 13, 16, 14, 2, 15, 52, 2499 }, // ď
+    { 16, 15, 18, 0, 15, 60, 2551 }, // Đ
+    { 13, 16, 14, 2, 15, 52, 2611 }, // đ
+    { 10, 19, 15, 3, 19, 48, 2663 }, // Ē
+    { 10, 15, 14, 2, 15, 38, 2711 }, // ē
+    { 10, 21, 15, 3, 21, 53, 2749 }, // Ĕ
+    { 10, 17, 14, 2, 17, 43, 2802 }, // ĕ
+    { 10, 20, 15, 3, 20, 50, 2845 }, // Ė
+    { 10, 16, 14, 2, 16, 40, 2895 }, // ė
+    { 10, 19, 15, 3, 15, 48, 2935 }, // Ę
+    { 10, 15, 14, 2, 10, 38, 2983 }, // ę
+    { 10, 21, 15, 3, 21, 53, 3021 }, // Ě
+    { 10, 17, 14, 2, 17, 43, 3074 }, // ě
+    { 14, 20, 19, 2, 20, 70, 3117 }, // Ĝ
+    { 9, 20, 13, 2, 15, 45, 3187 }, // ĝ
+    { 14, 21, 19, 2, 21, 74, 3232 }, // Ğ
+    { 9, 21, 13, 2, 16, 48, 3306 }, // ğ
+    { 14, 20, 19, 2, 20, 70, 3354 }, // Ġ
+    { 9, 20, 13, 2, 15, 45, 3424 }, // ġ
+    { 14, 22, 19, 2, 15, 77, 3469 }, // Ģ
+    { 9, 21, 13, 2, 16, 48, 3546 }, // ģ
+    { 12, 20, 18, 3, 20, 60, 3594 }, // Ĥ
+    { 12, 19, 14, 0, 19, 57, 3654 }, // ĥ
+    { 14, 15, 18, 2, 15, 53, 3711 }, // Ħ
+    { 12, 15, 14, 0, 15, 45, 3764 }, // ħ
+    { 7, 21, 8, 0, 21, 37, 3809 }, // Ĩ
+    { 7, 15, 8, 0, 15, 27, 3846 }, // ĩ
+    { 9, 20, 8, -1, 20, 45, 3873 }, // Ī
+    { 8, 14, 8, 0, 14, 28, 3918 }, // ī
+    { 4, 19, 10, 4, 15, 19, 3946 }, // Į
+    { 5, 19, 8, 1, 15, 24, 3965 }, // į
+    { 4, 21, 8, 2, 21, 21, 3989 }, // İ
+    { 3, 10, 8, 2, 10, 8, 4010 }, // ı
+    { 11, 19, 15, 2, 15, 53, 4018 }, // Ĳ
+    { 13, 20, 8, 2, 15, 65, 4071 }, // ĳ
+    { 8, 22, 13, 3, 18, 44, 4136 }, // Ĵ
+    { 9, 18, 11, 2, 14, 41, 4180 }, // ĵ
+    { 11, 21, 17, 3, 15, 58, 4221 }, // Ķ
+    { 10, 21, 14, 2, 14, 53, 4279 }, // ķ
+    { 8, 9, 11, 1, 9, 18, 4332 }, // ĸ
+    { 9, 20, 15, 3, 20, 45, 4350 }, // Ĺ
+    { 5, 20, 9, 2, 20, 25, 4395 }, // ĺ
+    { 9, 22, 15, 3, 15, 50, 4420 }, // Ļ
+    { 5, 21, 9, 2, 14, 27, 4470 }, // ļ
+    { 9, 15, 15, 3, 15, 34, 4497 }, // Ľ
+    { 7, 14, 9, 2, 14, 25, 4531 }, // ľ
+    { 9, 14, 15, 3, 14, 32, 4556 }, // Ŀ
+    { 7, 14, 9, 2, 14, 25, 4588 }, // ŀ
+    { 16, 23, 15, -4, 18, 92, 4613 }, // Ł
+    { 11, 14, 9, -3, 14, 39, 4705 }, // ł
+    { 12, 20, 18, 3, 20, 60, 4744 }, // Ń
+    { 10, 16, 14, 2, 16, 40, 4804 }, // ń
+    { 12, 21, 18, 3, 15, 63, 4844 }, // Ņ
+    { 10, 16, 14, 2, 10, 40, 4907 }, // ņ
+    { 12, 20, 18, 3, 20, 60, 4947 }, // Ň
+    { 10, 16, 14, 2, 16, 40, 5007 }, // ň
+    { 9, 18, 11, 1, 18, 41, 5047 }, // ŉ
+    { 12, 18, 18, 3, 15, 54, 5088 }, // Ŋ
+    { 10, 14, 14, 2, 10, 35, 5142 }, // ŋ
+    { 13, 20, 19, 3, 19, 65, 5177 }, // Ō
+    { 10, 15, 14, 2, 15, 38, 5242 }, // ō
+    { 13, 22, 19, 3, 21, 72, 5280 }, // Ŏ
+    { 10, 18, 14, 2, 18, 45, 5352 }, // ŏ
+    { 14, 21, 19, 3, 20, 74, 5397 }, // Ő
+    { 13, 17, 14, 1, 17, 56, 5471 }, // ő
+    { 19, 15, 20, 3, 15, 72, 5152 }, // Œ
+    { 17, 11, 18, 2, 11, 47, 5224 }, // œ
+    { 11, 20, 16, 3, 20, 55, 5527 }, // Ŕ
+    { 7, 14, 11, 2, 14, 25, 5582 }, // ŕ
+    { 11, 22, 16, 3, 14, 61, 5607 }, // Ŗ
+    { 8, 18, 11, 1, 9, 36, 5668 }, // ŗ
+    { 11, 20, 16, 3, 20, 55, 5704 }, // Ř
+    { 8, 14, 11, 1, 14, 28, 5759 }, // ř
+    { 13, 22, 19, 3, 21, 72, 5787 }, // Ś
+    { 9, 16, 13, 2, 16, 36, 5859 }, // ś
+    { 13, 21, 19, 3, 20, 69, 5895 }, // Ŝ
+    { 9, 15, 13, 2, 15, 34, 5964 }, // ŝ
+    { 13, 19, 19, 3, 15, 62, 5998 }, // Ş
+    { 9, 14, 13, 2, 10, 32, 6060 }, // ş
+    { 13, 23, 19, 3, 22, 75, 6092 }, // Š
+    { 9, 16, 13, 2, 16, 36, 6167 }, // š
+    { 12, 17, 18, 3, 14, 51, 6203 }, // Ţ
+    { 8, 16, 12, 2, 13, 32, 6254 }, // ţ
+    { 12, 20, 18, 3, 20, 60, 6286 }, // Ť
+    { 8, 14, 12, 2, 14, 28, 6346 }, // ť
+    { 12, 14, 18, 3, 14, 42, 6374 }, // Ŧ
+    { 9, 13, 12, 1, 13, 30, 6416 }, // ŧ
+    { 12, 21, 18, 3, 20, 63, 6446 }, // Ũ
+    { 9, 15, 13, 2, 15, 34, 6509 }, // ũ
+    { 12, 20, 18, 3, 19, 60, 6543 }, // Ū
+    { 9, 14, 13, 2, 14, 32, 6603 }, // ū
+    { 12, 22, 18, 3, 21, 66, 6635 }, // Ŭ
+    { 9, 16, 13, 2, 16, 36, 6701 }, // ŭ
+    { 12, 22, 18, 3, 21, 66, 6737 }, // Ů
+    { 9, 16, 13, 2, 16, 36, 6803 }, // ů
+    { 13, 21, 18, 3, 20, 69, 6839 }, // Ű
+    { 12, 15, 13, 1, 15, 45, 6908 }, // ű
+    { 12, 19, 18, 3, 15, 57, 6953 }, // Ų
+    { 9, 15, 13, 2, 10, 34, 7010 }, // ų
+    { 18, 19, 24, 3, 19, 86, 7044 }, // Ŵ
+    { 13, 15, 17, 2, 15, 49, 7130 }, // ŵ
+    { 12, 20, 18, 3, 20, 60, 7179 }, // Ŷ
+    { 10, 22, 14, 2, 17, 55, 7239 }, // ŷ
+    { 12, 20, 18, 3, 20, 60, 7294 }, // Ÿ
+    { 13, 20, 19, 3, 20, 65, 7354 }, // Ź
+    { 10, 16, 14, 2, 16, 40, 7419 }, // ź
+    { 13, 19, 19, 3, 19, 62, 7459 }, // Ż
+    { 10, 15, 14, 2, 15, 38, 7521 }, // ż
+    { 13, 20, 19, 3, 20, 65, 7559 }, // Ž
+    { 10, 16, 14, 2, 16, 40, 7624 }, // ž
+    { 6, 14, 9, 2, 14, 21, 7664 }, // ſ
+    { 6, 3, 0, 0, 13, 5, 7685 }, // ̀
+    { 3, 4, 0, 1, 13, 3, 7690 }, // ́
+    { 7, 4, 0, 1, 0, 7, 7693 }, // ̂
+    { 6, 4, 0, 1, 13, 6, 7700 }, // ̃
+    { 8, 3, 0, 1, 12, 6, 7706 }, // ̄
+    { 11, 3, 0, 1, 15, 9, 7712 }, // ̅
+    { 7, 5, 0, 1, 13, 9, 7721 }, // ̆
+    { 4, 3, 0, 0, 13, 3, 7730 }, // ̇
+    { 9, 3, 0, 0, 13, 7, 7733 }, // ̈
+    { 4, 4, 0, 0, 11, 4, 7740 }, // ̉
+    { 4, 4, 0, 1, 13, 4, 7744 }, // ̊
+    { 13, 3, 0, 0, 13, 10, 7748 }, // ̋
+    { 7, 4, 0, 1, 13, 7, 7758 }, // ̌
+    { 13, 3, 0, -4, 14, 10, 7765 }, // ̏
+    { 5, 5, 0, 0, 13, 7, 7775 }, // ̒
+    { 5, 5, 0, 0, 12, 7, 7782 }, // ̓
+    { 5, 5, 0, 0, 12, 7, 7789 }, // ̔
+    { 3, 5, 0, 1, 0, 4, 7796 }, // ̘
+    { 3, 5, 0, 1, 0, 4, 7800 }, // ̙
+    { 7, 4, 0, 1, 13, 7, 7804 }, // ̚
+    { 3, 4, 0, 1, 11, 3, 7811 }, // ̛
+    { 2, 3, 0, 1, -1, 2, 7814 }, // ̜
+    { 4, 3, 0, 1, 2, 3, 7816 }, // ̝
+    { 4, 3, 0, 1, -1, 3, 7819 }, // ̞
+    { 4, 4, 0, 1, -1, 4, 7822 }, // ̟
+    { 8, 3, 0, 1, -2, 6, 7826 }, // ̠
+    { 4, 3, 0, 0, 1, 3, 7832 }, // ̣
+    { 9, 3, 0, 0, 0, 7, 7835 }, // ̤
+    { 4, 4, 0, 1, 13, 4, 7842 }, // ̥
+    { 5, 6, 0, 0, 3, 8, 7846 }, // ̦
+    { 4, 5, 0, 1, 1, 5, 7854 }, // ̧
+    { 4, 5, 0, 1, 0, 5, 7859 }, // ̨
+    { 2, 5, 0, 1, -1, 3, 7864 }, // ̩
+    { 6, 3, 0, 1, -1, 5, 7867 }, // ̪
+    { 7, 4, 0, 1, 0, 7, 7872 }, // ̬
+    { 7, 4, 0, 1, 0, 7, 7879 }, // ̭
+    { 6, 4, 0, 1, 13, 6, 7886 }, // ̰
+    { 7, 3, 0, 1, 13, 6, 7892 }, // ̱
+    { 7, 3, 0, 1, -1, 6, 7898 }, // ̲
+    { 6, 4, 0, 1, 13, 6, 7904 }, // ̴
+    { 8, 2, 0, 1, 6, 4, 7910 }, // ̵
+    { 2, 3, 0, 1, -1, 2, 7914 }, // ̹
+    { 6, 4, 0, 1, 0, 6, 7916 }, // ̺
+    { 5, 4, 0, 1, 0, 5, 7922 }, // ̻
+    { 6, 4, 0, 1, 0, 6, 7927 }, // ̼
+    { 5, 4, 0, 1, 13, 5, 7933 }, // ̽
+    { 6, 4, 0, 1, 13, 6, 7938 }, // ͂
+    { 3, 3, 0, 1, 14, 3, 7944 }, // ̓
+    { 9, 8, 0, 0, 18, 18, 7947 }, // ̈́
+    { 6, 3, 0, 1, 13, 5, 7965 }, // ͆
+    { 8, 6, 0, 1, 0, 12, 7970 }, // ͇
+    { 7, 5, 0, 1, 0, 9, 7982 }, // ͈
+    { 5, 5, 0, 1, -1, 7, 7991 }, // ͉
+    { 6, 10, 0, 1, 16, 15, 7998 }, // ͊
+    { 14, 8, 0, 0, 15, 28, 8013 }, // ͋
+    { 10, 9, 0, 1, 9, 23, 8041 }, // ͌
+    { 9, 3, 0, 1, -2, 7, 8064 }, // ͍
+    { 3, 3, 0, 1, 2, 3, 8071 }, // ͎
+    { 14, 3, 0, 1, 0, 11, 8074 }, // ͜
+    { 14, 3, 0, 1, 13, 11, 8085 }, // ͡
+    { 17, 5, 0, 1, -1, 22, 8096 }, // ͢
+    { 9, 17, 11, 1, 17, 39, 8118 }, // Ѐ
+    { 9, 16, 11, 1, 16, 36, 0 }, // Ё
+    { 13, 14, 17, 2, 14, 46, 8157 }, // Ђ
+    { 9, 20, 11, 1, 20, 45, 8203 }, // Ѓ
+    { 12, 14, 15, 2, 13, 42, 8248 }, // Є
+    { 13, 16, 19, 3, 15, 52, 0 }, // Ѕ
+    { 4, 15, 8, 2, 15, 15, 52 }, // І
+    { 8, 20, 8, -1, 20, 40, 67 }, // Ї
+    { 7, 19, 13, 3, 15, 34, 107 }, // Ј
+    { 16, 14, 19, 2, 13, 56, 141 }, // Љ
+    { 15, 13, 19, 2, 13, 49, 197 }, // Њ
+    { 14, 14, 18, 3, 14, 49, 246 }, // Ћ
+    { 11, 21, 17, 3, 21, 58, 295 }, // Ќ
+    { 12, 19, 18, 3, 19, 57, 353 }, // Ѝ
+    { 10, 20, 12, 1, 19, 50, 410 }, // Ў
+    { 10, 16, 12, 1, 12, 40, 460 }, // Џ
+    { 13, 14, 19, 3, 14, 46, 36 }, // А
+    { 9, 13, 11, 1, 13, 30, 82 }, // Б
+    { 10, 13, 11, 1, 13, 33, 112 }, // В
+    { 9, 12, 11, 1, 12, 27, 145 }, // Г
+    { 12, 14, 14, 1, 12, 42, 172 }, // Д
+    { 9, 12, 11, 1, 12, 27, 214 }, // Е
+    { 18, 15, 24, 3, 15, 68, 241 }, // Ж
+    { 9, 13, 11, 1, 13, 30, 309 }, // З
+    { 12, 15, 18, 3, 15, 45, 339 }, // И
+    { 12, 20, 18, 3, 20, 60, 384 }, // Й
+    { 11, 15, 17, 3, 15, 42, 444 }, // К
+    { 10, 13, 12, 1, 12, 33, 486 }, // Л
+    { 12, 12, 14, 1, 12, 36, 519 }, // М
+    { 12, 15, 18, 3, 15, 45, 555 }, // Н
+    { 13, 16, 19, 3, 15, 52, 600 }, // О
+    { 9, 13, 11, 1, 13, 30, 652 }, // П
+    { 10, 15, 15, 3, 15, 38, 682 }, // Р
+    { 12, 17, 17, 2, 16, 51, 720 }, // С
+    { 12, 14, 18, 3, 14, 42, 771 }, // Т
+    { 10, 14, 12, 1, 13, 35, 813 }, // У
+    { 13, 13, 15, 1, 13, 43, 848 }, // Ф
+    { 13, 15, 19, 3, 15, 49, 891 }, // Х
+    { 10, 16, 12, 1, 13, 40, 940 }, // Ц
+    { 9, 12, 11, 1, 12, 27, 980 }, // Ч
+    { 12, 13, 14, 1, 13, 39, 1007 }, // Ш
+    { 13, 16, 15, 1, 13, 52, 1046 }, // Щ
+    { 12, 12, 11, -2, 12, 36, 1098 }, // Ъ
+    { 16, 13, 19, 1, 13, 52, 1134 }, // Ы
+    { 9, 12, 11, 1, 12, 27, 1186 }, // Ь
+    { 12, 14, 15, 2, 13, 42, 1213 }, // Э
+    { 13, 13, 17, 2, 13, 43, 1255 }, // Ю
+    { 11, 14, 16, 3, 14, 39, 1298 }, // Я
+    { 10, 11, 14, 2, 11, 28, 1337 }, // а
+    { 10, 14, 12, 1, 14, 35, 1365 }, // б
+    { 8, 11, 12, 2, 11, 22, 1400 }, // в
+    { 8, 10, 10, 1, 10, 20, 1422 }, // г
+    { 11, 12, 13, 1, 10, 33, 1442 }, // д
+    { 10, 10, 14, 2, 10, 25, 1475 }, // е
+    { 16, 12, 20, 2, 12, 48, 1500 }, // ж
+    { 7, 9, 7, 0, 9, 16, 1548 }, // з
+    { 9, 10, 11, 1, 10, 23, 1564 }, // и
+    { 9, 13, 11, 1, 13, 30, 1587 }, // й
+    { 9, 10, 13, 2, 10, 23, 1617 }, // к
+    { 7, 10, 8, 1, 9, 18, 1640 }, // л
+    { 12, 11, 15, 2, 11, 33, 1658 }, // м
+    { 11, 11, 15, 2, 11, 31, 1691 }, // н
+    { 9, 10, 11, 1, 10, 23, 1722 }, // о
+    { 9, 10, 11, 1, 10, 23, 1745 }, // п
+    { 11, 15, 14, 1, 10, 42, 1768 }, // р
+    { 8, 12, 12, 2, 11, 24, 1810 }, // с
+    { 10, 9, 11, 1, 9, 23, 1834 }, // т
+    { 10, 15, 14, 2, 10, 38, 1857 }, // у
+    { 13, 14, 15, 1, 10, 46, 1895 }, // ф
+    { 10, 10, 12, 1, 10, 25, 1941 }, // х
+    { 10, 13, 12, 1, 10, 33, 1966 }, // ц
+    { 7, 9, 8, 0, 9, 16, 1999 }, // ч
+    { 12, 10, 14, 1, 10, 30, 2015 }, // ш
+    { 13, 13, 15, 1, 10, 43, 2045 }, // щ
+    { 11, 9, 13, 1, 9, 25, 2088 }, // ъ
+    { 12, 10, 14, 1, 10, 30, 2113 }, // ы
+    { 8, 10, 10, 1, 10, 20, 2143 }, // ь
+    { 9, 9, 11, 1, 9, 21, 2163 }, // э
+    { 11, 10, 13, 1, 10, 28, 2184 }, // ю
+    { 9, 9, 10, 1, 9, 21, 2212 }, // я
+    { 10, 16, 14, 2, 16, 40, 500 }, // ѐ
+    { 9, 12, 11, 1, 12, 27, 2233 }, // ё
+    { 12, 18, 14, 0, 15, 54, 540 }, // ђ
+    { 8, 14, 10, 1, 14, 28, 594 }, // ѓ
+    { 9, 10, 11, 1, 9, 23, 622 }, // є
+    { 9, 10, 13, 2, 10, 23, 645 }, // ѕ
+    { 4, 15, 8, 2, 15, 15, 668 }, // і
+    { 9, 14, 8, -1, 14, 32, 683 }, // ї
+    { 7, 19, 11, 2, 15, 34, 715 }, // ј
+    { 12, 10, 13, 1, 9, 30, 749 }, // љ
+    { 11, 9, 13, 1, 9, 25, 779 }, // њ
+    { 12, 15, 14, 0, 15, 45, 804 }, // ћ
+    { 9, 15, 13, 2, 15, 34, 849 }, // ќ
+    { 9, 14, 11, 1, 14, 32, 883 }, // ѝ
+    { 10, 22, 14, 2, 17, 55, 915 }, // ў
+    { 8, 12, 9, 0, 9, 24, 970 }, // џ
+    { 10, 13, 14, 2, 12, 33, 994 }, // Ѣ
+    { 10, 13, 12, 1, 12, 33, 1027 }, // ѣ
+    { 13, 12, 17, 2, 12, 39, 1060 }, // Ѫ
+    { 10, 9, 12, 1, 9, 23, 1099 }, // ѫ
+    { 12, 16, 18, 3, 15, 48, 1122 }, // Ѳ
+    { 10, 12, 14, 2, 12, 30, 1170 }, // ѳ
+    { 17, 19, 19, 3, 19, 81, 1200 }, // Ѵ
+    { 11, 12, 14, 2, 12, 33, 1281 }, // ѵ
+    { 6, 5, 0, 1, 15, 8, 1314 }, // ҆
+    { 9, 14, 11, 1, 14, 32, 1322 }, // Ґ
+    { 8, 12, 10, 1, 12, 24, 1354 }, // ґ
+    { 10, 12, 11, 0, 12, 30, 1378 }, // Ғ
+    { 7, 8, 8, 0, 8, 14, 1408 }, // ғ
+    { 10, 14, 11, 1, 14, 35, 1422 }, // Ҕ
+    { 7, 9, 7, 0, 9, 16, 1457 }, // ҕ
+    { 18, 18, 21, 2, 15, 81, 1473 }, // Җ
+    { 13, 12, 15, 1, 10, 39, 1554 }, // җ
+    { 8, 15, 12, 2, 13, 30, 1593 }, // Ҙ
+    { 7, 13, 7, 0, 9, 23, 1623 }, // ҙ
+    { 11, 17, 15, 2, 15, 47, 1646 }, // Қ
+    { 8, 12, 10, 1, 10, 24, 1693 }, // қ
+    { 13, 13, 16, 2, 13, 43, 1717 }, // Ҝ
+    { 10, 9, 12, 1, 9, 23, 1760 }, // ҝ
+    { 12, 15, 17, 2, 15, 45, 1783 }, // Ҟ
+    { 12, 14, 14, 0, 14, 42, 1828 }, // ҟ
+    { 16, 15, 17, -2, 15, 60, 1870 }, // Ҡ
+    { 11, 11, 12, -1, 11, 31, 1930 }, // ҡ
+    { 12, 17, 16, 2, 15, 51, 1961 }, // Ң
+    { 9, 13, 11, 1, 11, 30, 2012 }, // ң
+    { 17, 15, 18, 3, 15, 64, 2042 }, // Ҥ
+    { 12, 10, 12, 2, 10, 30, 2106 }, // ҥ
+    { 16, 14, 20, 2, 14, 56, 2136 }, // Ҧ
+    { 16, 16, 18, 1, 11, 64, 2192 }, // ҧ
+    { 16, 15, 20, 2, 14, 60, 2256 }, // Ҩ
+    { 13, 12, 16, 1, 11, 39, 2316 }, // ҩ
+    { 12, 19, 17, 2, 16, 57, 2355 }, // Ҫ
+    { 8, 13, 12, 2, 11, 26, 2412 }, // ҫ
+    { 12, 16, 16, 2, 14, 48, 2438 }, // Ҭ
+    { 9, 11, 11, 1, 10, 25, 2486 }, // ҭ
+    { 12, 14, 18, 3, 14, 42, 2511 }, // Ү
+    { 9, 12, 11, 1, 9, 27, 2553 }, // ү
+    { 12, 14, 18, 3, 14, 42, 2580 }, // Ұ
+    { 10, 13, 11, 0, 9, 33, 2622 }, // ұ
+    { 14, 18, 17, 2, 15, 63, 2655 }, // Ҳ
+    { 10, 12, 11, 1, 10, 30, 2718 }, // ҳ
+    { 14, 15, 18, 2, 12, 53, 2748 }, // Ҵ
+    { 11, 11, 13, 1, 8, 31, 2801 }, // ҵ
+    { 11, 16, 14, 1, 12, 44, 2832 }, // Ҷ
+    { 9, 12, 10, 0, 9, 27, 2876 }, // ҷ
+    { 10, 12, 12, 1, 12, 30, 2903 }, // Ҹ
+    { 7, 9, 8, 1, 9, 16, 2933 }, // ҹ
+    { 9, 14, 13, 2, 14, 32, 2949 }, // Һ
+    { 10, 15, 14, 2, 15, 38, 2981 }, // һ
+    { 15, 13, 16, 0, 13, 49, 3019 }, // Ҽ
+    { 11, 9, 12, 0, 9, 25, 3068 }, // ҽ
+    { 16, 16, 18, 1, 13, 64, 3093 }, // Ҿ
+    { 11, 12, 13, 1, 10, 33, 3157 }, // ҿ
+    { 4, 15, 8, 2, 15, 15, 3190 }, // Ӏ
+    { 18, 21, 24, 3, 21, 95, 3205 }, // Ӂ
+    { 16, 18, 20, 2, 18, 72, 3300 }, // ӂ
+    { 10, 17, 13, 2, 13, 43, 3372 }, // Ӄ
+    { 7, 12, 9, 1, 9, 21, 3415 }, // ӄ
+    { 12, 16, 12, 1, 13, 48, 3436 }, // Ӆ
+    { 8, 11, 9, 1, 9, 22, 3484 }, // ӆ
+    { 13, 20, 18, 3, 15, 65, 3506 }, // Ӈ
+    { 9, 14, 12, 2, 11, 32, 3571 }, // ӈ
+    { 13, 20, 18, 3, 15, 65, 3603 }, // Ӊ
+    { 9, 15, 12, 2, 11, 34, 3668 }, // ӊ
+    { 10, 15, 11, 0, 12, 38, 3702 }, // Ӌ
+    { 7, 11, 8, 1, 9, 20, 3740 }, // ӌ
+    { 16, 20, 21, 3, 15, 80, 3760 }, // Ӎ
+    { 11, 14, 14, 2, 10, 39, 3840 }, // ӎ
+    { 3, 12, 5, 1, 12, 9, 3879 }, // ӏ
+    { 13, 21, 19, 3, 21, 69, 3888 }, // Ӑ
+    { 10, 16, 14, 2, 16, 40, 3957 }, // ӑ
+    { 13, 19, 19, 3, 19, 62, 3997 }, // Ӓ
+    { 10, 15, 14, 2, 15, 38, 4059 }, // ӓ
+    { 19, 16, 24, 3, 15, 76, 4097 }, // Ӕ
+    { 16, 11, 20, 2, 11, 44, 4173 }, // ӕ
+    { 9, 18, 11, 1, 18, 41, 4217 }, // Ӗ
+    { 10, 17, 14, 2, 17, 43, 4258 }, // ӗ
+    { 10, 11, 14, 2, 10, 28, 4301 }, // Ә
+    { 9, 11, 14, 3, 10, 25, 4329 }, // ә
+    { 10, 18, 14, 2, 17, 45, 4354 }, // Ӛ
+    { 9, 12, 14, 3, 10, 27, 4399 }, // ӛ
+    { 18, 20, 22, 3, 20, 90, 4426 }, // Ӝ
+    { 16, 17, 20, 2, 17, 68, 4516 }, // ӝ
+    { 9, 17, 11, 1, 17, 39, 4584 }, // Ӟ
+    { 9, 14, 7, 0, 14, 32, 4623 }, // ӟ
+    { 8, 14, 10, 1, 13, 28, 4655 }, // Ӡ
+    { 8, 13, 10, 1, 9, 26, 4683 }, // ӡ
+    { 12, 18, 18, 3, 18, 54, 4709 }, // Ӣ
+    { 9, 13, 11, 1, 13, 30, 4763 }, // ӣ
+    { 12, 19, 18, 3, 19, 57, 4793 }, // Ӥ
+    { 9, 14, 11, 1, 14, 32, 4850 }, // ӥ
+    { 13, 20, 19, 3, 19, 65, 4882 }, // Ӧ
+    { 9, 15, 11, 1, 15, 34, 4947 }, // ӧ
+    { 12, 13, 18, 3, 12, 39, 4981 }, // Ө
+    { 10, 10, 14, 2, 10, 25, 5020 }, // ө
+    { 12, 20, 18, 3, 19, 60, 5045 }, // Ӫ
+    { 10, 16, 14, 2, 16, 40, 5105 }, // ӫ
+    { 12, 19, 15, 2, 18, 57, 5145 }, // Ӭ
+    { 10, 14, 11, 0, 14, 35, 5202 }, // ӭ
+    { 10, 18, 12, 1, 17, 45, 5237 }, // Ӯ
+    { 10, 21, 14, 2, 16, 53, 5282 }, // ӯ
+    { 10, 19, 12, 1, 18, 48, 5335 }, // Ӱ
+    { 10, 21, 14, 2, 16, 53, 5383 }, // ӱ
+    { 13, 19, 12, 0, 18, 62, 5436 }, // Ӳ
+    { 13, 22, 14, 1, 17, 72, 5498 }, // ӳ
+    { 9, 17, 11, 1, 17, 39, 5570 }, // Ӵ
+    { 8, 14, 8, -1, 14, 28, 5609 }, // ӵ
+    { 9, 15, 11, 1, 12, 34, 5637 }, // Ӷ
+    { 7, 10, 8, 0, 8, 18, 5671 }, // ӷ
+    { 16, 18, 19, 1, 18, 72, 5689 }, // Ӹ
+    { 12, 15, 14, 1, 15, 45, 5761 }, // ӹ
+    { 16, 17, 19, 3, 15, 68, 5806 }, // Ӽ
+    { 11, 12, 13, 2, 10, 33, 5874 }, // ӽ
+    { 0, 0, 14, 0, 0, 0, 5907 }, //  
+    { 0, 0, 22, 0, 0, 0, 5907 }, //  
+    { 0, 0, 14, 0, 0, 0, 5907 }, //  
+    { 0, 0, 22, 0, 0, 0, 5907 }, //  
+    { 0, 0, 11, 0, 0, 0, 5907 }, //  
+    { 0, 0, 10, 0, 0, 0, 5907 }, //  
+    { 0, 0, 8, 0, 0, 0, 5907 }, //  
+    { 0, 0, 11, 0, 0, 0, 5907 }, //  
+    { 0, 0, 4, 0, 0, 0, 5907 }, //  
+    { 0, 0, 9, 0, 0, 0, 5907 }, //  
+    { 0, 0, 8, 0, 0, 0, 5907 }, //  
+    { 0, 0, 5, 0, 0, 0, 5907 }, // ​
+    { 0, 0, 0, 0, 0, 0, 5907 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 5907 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 5907 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 5907 }, // ‏
+    { 8, 2, 9, 1, 6, 4, 5907 }, // ‐
+    { 8, 2, 9, 1, 6, 4, 5911 }, // ‑
+    { 12, 2, 12, 1, 6, 6, 5915 }, // ‒
+    { 11, 3, 13, 1, 6, 9, 5271 }, // –
+    { 17, 3, 19, 1, 6, 13, 5280 }, // —
+    { 17, 3, 19, 1, 6, 13, 5921 }, // ―
+    { 7, 15, 9, 1, 12, 27, 5934 }, // ‖
+    { 13, 6, 13, 1, -1, 20, 5961 }, // ‗
+    { 5, 6, 6, 0, 15, 8, 5293 }, // ‘
+    { 5, 6, 6, 0, 15, 8, 5301 }, // ’
+    { 5, 6, 5, 0, 3, 8, 5981 }, // ‚
+    { 5, 6, 6, 0, 15, 8, 5989 }, // ‛
+    { 9, 6, 9, 0, 15, 14, 5309 }, // “
+    { 9, 6, 9, 0, 15, 14, 5323 }, // ”
+    { 5, 6, 5, 0, 3, 8, 5997 }, // „
+    { 9, 5, 9, 0, 15, 12, 6005 }, // ‟
+    { 9, 22, 10, 0, 17, 50, 6017 }, // †
+    { 10, 22, 10, 0, 17, 55, 6067 }, // ‡
+    { 11, 10, 8, -1, 12, 28, 6122 }, // •
+    { 5, 6, 7, 1, 8, 8, 6150 }, // ‣
+    { 4, 3, 4, 0, 3, 3, 6158 }, // ․
+    { 4, 3, 4, 0, 3, 3, 6161 }, // ‥
+    { 15, 3, 16, 0, 3, 12, 5337 }, // …
+    { 3, 2, 4, 1, 6, 2, 6164 }, // ‧
+    { 0, 0, 21, 0, 0, 0, 6166 }, //  
+    { 11, 15, 18, 4, 13, 42, 6166 }, // ‰
+    { 5, 6, 5, 0, 15, 8, 6208 }, // ′
+    { 9, 6, 9, 0, 15, 14, 6216 }, // ″
+    { 14, 6, 14, 0, 14, 21, 6230 }, // ‴
+    { 5, 6, 6, 0, 14, 8, 6251 }, // ‵
+    { 8, 6, 9, 0, 14, 12, 6259 }, // ‶
+    { 14, 6, 14, 0, 14, 21, 6271 }, // ‷
+    { 7, 3, 9, 1, 13, 6, 6292 }, // ‸
+    { 5, 8, 7, 1, 8, 10, 6298 }, // ‹
+    { 5, 8, 7, 1, 8, 10, 6308 }, // ›
+    { 18, 17, 22, 3, 15, 77, 6318 }, // ※
+    { 5, 17, 6, 0, 17, 22, 6395 }, // ‼
+    { 10, 21, 12, 1, 20, 53, 6417 }, // ‽
+    { 8, 2, 9, 1, 14, 4, 6470 }, // ‾
+    { 7, 4, 9, 1, 12, 7, 6474 }, // ‿
+    { 11, 12, 13, 1, 16, 33, 6481 }, // ⁂
+    { 10, 14, 18, 4, 13, 35, 6514 }, // ⁄
+    { 19, 19, 21, 1, 19, 91, 6549 }, // ⁇
+    { 13, 19, 17, 1, 19, 62, 6640 }, // ⁈
+    { 13, 20, 13, 0, 19, 65, 6702 }, // ⁉
+    { 10, 26, 12, 1, 18, 65, 6767 }, // ⁒
+    { 0, 0, 80, 0, 0, 0, 6832 }, //  
+    { 5, 7, 5, 0, 14, 9, 6832 }, // ⁰
+    { 5, 6, 5, 0, 14, 8, 6841 }, // ⁴
+    { 5, 7, 5, 0, 14, 9, 6849 }, // ⁵
+    { 5, 7, 5, 0, 14, 9, 6858 }, // ⁶
+    { 5, 7, 6, 0, 14, 9, 6867 }, // ⁷
+    { 5, 7, 6, 0, 14, 9, 6876 }, // ⁸
+    { 5, 7, 6, 0, 14, 9, 6885 }, // ⁹
+    { 10, 10, 14, 2, 10, 25, 6894 }, // ⁿ
+    { 7, 9, 8, 0, 9, 16, 6919 }, // ₀
+    { 5, 7, 5, 0, 4, 9, 6935 }, // ₁
+    { 5, 7, 5, 0, 4, 9, 6944 }, // ₂
+    { 5, 7, 5, 0, 4, 9, 6953 }, // ₃
+    { 5, 7, 6, 0, 4, 9, 6962 }, // ₄
+    { 5, 7, 5, 0, 4, 9, 6971 }, // ₅
+    { 5, 7, 6, 0, 4, 9, 6980 }, // ₆
+    { 5, 7, 5, 0, 4, 9, 6989 }, // ₇
+    { 6, 7, 6, 0, 4, 11, 6998 }, // ₈
+    { 5, 7, 6, 0, 4, 9, 7009 }, // ₉
+    { 6, 23, 7, 1, 17, 35, 7018 }, // ₍
+    { 6, 23, 7, 0, 17, 35, 7053 }, // ₎
+    { 12, 23, 17, 2, 19, 69, 7088 }, // ₡
+    { 12, 17, 17, 2, 16, 51, 7157 }, // ₢
+    { 11, 16, 12, 0, 16, 44, 7208 }, // ₤
+    { 16, 15, 18, 1, 15, 60, 7252 }, // ₦
+    { 13, 15, 15, 1, 15, 49, 7312 }, // ₧
+    { 17, 15, 19, 2, 15, 64, 7361 }, // ₨
+    { 14, 15, 14, 0, 15, 53, 7425 }, // ₩
+    { 14, 13, 18, 2, 13, 46, 7478 }, // ₪
+    { 11, 14, 11, 1, 14, 39, 7524 }, // ₫
+    { 11, 16, 12, 1, 14, 44, 7563 }, // €
+    { 12, 14, 18, 3, 14, 42, 7607 }, // ₮
+    { 15, 15, 11, 0, 15, 57, 7649 }, // ₱
+    { 14, 21, 19, 2, 18, 74, 7706 }, // ₲
+    { 15, 16, 15, 1, 15, 60, 7780 }, // ₴
+    { 8, 13, 12, 2, 12, 26, 7840 }, // ₵
+    { 12, 15, 18, 3, 15, 45, 7866 }, // ₸
+    { 8, 13, 10, 1, 13, 26, 7911 }, // ₹
+    { 10, 13, 11, 1, 12, 33, 7937 }, // ₺
+    { 11, 13, 10, 0, 13, 36, 7970 }, // ₼
+    { 14, 15, 15, -1, 15, 53, 8006 }, // ₽
+    { 11, 11, 13, 1, 10, 31, 8059 }, // ←
+    { 11, 10, 13, 1, 10, 28, 8090 }, // ↑
+    { 11, 11, 13, 1, 10, 31, 8118 }, // →
+    { 11, 10, 13, 1, 10, 28, 8149 }, // ↓
+    { 13, 9, 15, 1, 9, 30, 8177 }, // ↔
+    { 9, 13, 11, 1, 14, 30, 8207 }, // ↕
+    { 9, 8, 11, 1, 8, 18, 8237 }, // ↖
+    { 9, 8, 11, 1, 8, 18, 8255 }, // ↗
+    { 9, 9, 11, 1, 9, 21, 8273 }, // ↘
+    { 9, 9, 11, 1, 9, 21, 8294 }, // ↙
+    { 12, 11, 14, 1, 10, 33, 0 }, // ⇐
+    { 13, 12, 15, 1, 12, 39, 33 }, // ⇑
+    { 12, 11, 14, 1, 10, 33, 72 }, // ⇒
+    { 13, 13, 15, 1, 12, 43, 105 }, // ⇓
+    { 14, 11, 16, 1, 10, 39, 148 }, // ⇔
+    { 11, 14, 13, 1, 9, 39, 187 }, // ⇕
+    { 10, 14, 11, 1, 14, 35, 226 }, // ∂
+    { 17, 17, 19, 1, 16, 73, 261 }, // ∅
+    { 12, 13, 14, 1, 13, 39, 334 }, // ∆
+    { 10, 12, 12, 1, 12, 30, 373 }, // ∏
+    { 10, 12, 12, 1, 12, 30, 403 }, // ∐
+    { 8, 13, 10, 1, 12, 26, 433 }, // ∑
+    { 8, 3, 10, 1, 6, 6, 459 }, // −
+    { 14, 14, 16, 1, 13, 49, 465 }, // √
+    { 13, 8, 15, 1, 10, 26, 514 }, // ∞
+    { 14, 19, 14, 0, 15, 67, 540 }, // ∫
+    { 4, 10, 5, 0, 10, 10, 607 }, // ∶
+    { 10, 9, 13, 1, 9, 23, 617 }, // ≈
+    { 11, 15, 18, 4, 13, 42, 640 }, // ≠
+    { 13, 13, 14, 1, 12, 43, 682 }, // ≤
+    { 13, 13, 14, 1, 12, 43, 725 }, // ≥
+    { 12, 14, 17, 2, 14, 42, 768 }, // ﬀ
+    { 11, 15, 15, 2, 15, 42, 810 }, // ﬁ
+    { 13, 14, 17, 2, 14, 46, 852 }, // ﬂ
+    { 17, 15, 21, 2, 15, 64, 898 }, // ﬃ
+    { 19, 14, 23, 2, 14, 67, 962 }, // ﬄ
+    { 16, 14, 20, 2, 14, 56, 1029 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_8_regularIntervals[] = {
@@ -1743,30 +1736,90 @@ static const EpdUnicodeInterval opendyslexic_8_regularIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_8_regularGroups[] = {
-    { 0, 2180, 3089, 95, 0 },
-    { 2180, 2061, 3776, 96, 95 },
-    { 4241, 3069, 6091, 126, 191 },
-    { 7310, 366, 433, 61, 317 },
-    { 7676, 5024, 8339, 213, 378 },
-    { 12700, 720, 1003, 63, 591 },
-    { 13420, 238, 256, 20, 654 },
-    { 13658, 730, 971, 20, 674 },
-    { 14388, 368, 482, 16, 694 },
-    { 14756, 396, 542, 15, 710 },
+    { 0, 3003, 5349, 151, 0 },
+    { 3003, 1595, 2260, 66, 379 },
+    { 4598, 4260, 8290, 238, 96 },
+    { 8858, 5341, 8315, 249, 383 },
+    { 14199, 741, 1085, 27, 704 },
+};
+
+static const uint8_t opendyslexic_8_regularGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const uint16_t opendyslexic_8_regularGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_8_regular = {
     opendyslexic_8_regularBitmaps,
     opendyslexic_8_regularGlyphs,
     opendyslexic_8_regularIntervals,
-    56,
+    58,
     30,
     22,
     -9,
     true,
     opendyslexic_8_regularGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    nullptr,
+    0,
+    0,
+    opendyslexic_8_regularGlyphLookup,
+    opendyslexic_8_regularGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,12 +3,12 @@
  * name: ubuntu_12_bold
  * size: 12
  * mode: 1-bit
- * Command used: fontconvert.py ubuntu_12_bold 12 ../builtinFonts/source/Ubuntu/Ubuntu-Bold.ttf
+ * Command used: fontconvert.py ubuntu_12_bold 12 ../builtinFonts/source/Ubuntu/Ubuntu-Bold.ttf --no-kerning
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t ubuntu_12_boldBitmaps[18832] = {
+static const uint8_t ubuntu_12_boldBitmaps[19092] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDC, 0x07, 0x7F, 0xFF, 0x70, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF,
     0xF3, 0xFC, 0xEF, 0x38, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0xFF, 0xFE, 0xFF, 0xFE,
     0xFF, 0xFE, 0x1E, 0x78, 0x1E, 0x78, 0x3C, 0x78, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x3C, 0xF0,
@@ -1186,6 +1186,23 @@ static const uint8_t ubuntu_12_boldBitmaps[18832] = {
     0x03, 0x00, 0x01, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xC0, 0xFF, 0xEF, 0xFF, 0xFF, 0xF3,
     0xFF, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x78, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F,
     0xF0, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x78, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x1F, 0xC7, 0xF1, 0xFE, 0x7F, 0x9F, 0xF3, 0xFC, 0xF9, 0x3F, 0x6F, 0x81, 0xE0, 0x7C, 0x0F, 0x03,
+    0xFE, 0x7F, 0xDF, 0xF3, 0xFE, 0xFF, 0x9F, 0xF7, 0xC0, 0xF0, 0x3E, 0x07, 0x81, 0xF0, 0x3C, 0x0F,
+    0x81, 0xE0, 0x7C, 0x0F, 0x03, 0xE0, 0x78, 0x1F, 0x03, 0xC0, 0xF8, 0x1E, 0x07, 0xC0, 0xF0, 0x3E,
+    0x07, 0x80, 0x1F, 0xDE, 0x3F, 0xDF, 0x7F, 0x9F, 0x7C, 0x9E, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0x9E,
+    0xFF, 0x9E, 0xFF, 0x9E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E,
+    0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0x1F, 0xDE, 0x0F, 0xF7, 0x87, 0xF9, 0xE1, 0xF2,
+    0x78, 0xF8, 0x1E, 0x3E, 0x07, 0x8F, 0xF9, 0xE3, 0xFE, 0x78, 0xFF, 0x9E, 0x3E, 0x07, 0x8F, 0x81,
+    0xE3, 0xE0, 0x78, 0xF8, 0x1E, 0x3E, 0x07, 0x8F, 0x81, 0xE3, 0xE0, 0x7C, 0xF8, 0x1F, 0xBE, 0x03,
+    0xEF, 0x80, 0x78, 0x1F, 0xC7, 0xF3, 0xCF, 0xF3, 0xFD, 0xF7, 0xFC, 0xFF, 0x7D, 0xF2, 0x7E, 0x8F,
+    0xF8, 0x1E, 0x00, 0x3E, 0x07, 0x80, 0x0F, 0xF9, 0xFF, 0x7F, 0xFE, 0x7F, 0xDF, 0xFF, 0x9F, 0xF7,
+    0xFE, 0x07, 0x81, 0xFF, 0x81, 0xE0, 0x7F, 0xE0, 0x78, 0x1F, 0xF8, 0x1E, 0x07, 0xFE, 0x07, 0x81,
+    0xFF, 0x81, 0xE0, 0x7F, 0xE0, 0x78, 0x1F, 0xF8, 0x1E, 0x07, 0xFE, 0x07, 0x81, 0xFF, 0x81, 0xE0,
+    0x7C, 0x1F, 0xC7, 0xF3, 0xC3, 0xFC, 0xFF, 0x7C, 0x7F, 0xCF, 0xF7, 0xC7, 0xC9, 0xFA, 0x7C, 0xF8,
+    0x1E, 0x07, 0xCF, 0x81, 0xE0, 0x7C, 0xFF, 0x9F, 0xF7, 0xCF, 0xF9, 0xFF, 0x7C, 0xFF, 0x9F, 0xF7,
+    0xCF, 0x81, 0xE0, 0x7C, 0xF8, 0x1E, 0x07, 0xCF, 0x81, 0xE0, 0x7C, 0xF8, 0x1E, 0x07, 0xCF, 0x81,
+    0xE0, 0x7C, 0xF8, 0x1E, 0x07, 0xCF, 0x81, 0xE0, 0x7E, 0xF8, 0x1E, 0x03, 0xFF, 0x81, 0xE0, 0x3F,
+    0xF8, 0x1E, 0x01, 0xE0,
 };
 
 static const EpdGlyph ubuntu_12_boldGlyphs[] = {
@@ -1780,6 +1797,11 @@ static const EpdGlyph ubuntu_12_boldGlyphs[] = {
     { 12, 14, 14, 1, 14, 21, 18765 }, // ≠
     { 12, 15, 14, 1, 15, 23, 18786 }, // ≤
     { 12, 15, 14, 1, 15, 23, 18809 }, // ≥
+    { 21, 19, 21, 1, 19, 50, 18832 }, // ﬀ
+    { 16, 19, 18, 1, 19, 38, 18882 }, // ﬁ
+    { 18, 19, 18, 1, 19, 43, 18920 }, // ﬂ
+    { 26, 19, 28, 1, 19, 62, 18963 }, // ﬃ
+    { 28, 19, 29, 1, 19, 67, 19025 }, // ﬄ
 };
 
 static const EpdUnicodeInterval ubuntu_12_boldIntervals[] = {
@@ -1821,17 +1843,63 @@ static const EpdUnicodeInterval ubuntu_12_boldIntervals[] = {
     { 0x2248, 0x2248, 0x24B },
     { 0x2260, 0x2260, 0x24C },
     { 0x2264, 0x2265, 0x24D },
+    { 0xFB00, 0xFB04, 0x24F },
+};
+
+static const EpdLigaturePair ubuntu_12_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t ubuntu_12_boldGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x021B, 0x021C, 0x021D, 0xFFFF, 0xFFFF, 0x021E, 0x021F, 0x0220, 0xFFFF, 0x0221, 0x0222, 0x0223, 0xFFFF,
+    0x0224, 0x0225, 0x0226, 0xFFFF, 0xFFFF, 0xFFFF, 0x0227, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0228, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0229, 0x022A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x022B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData ubuntu_12_bold = {
     ubuntu_12_boldBitmaps,
     ubuntu_12_boldGlyphs,
     ubuntu_12_boldIntervals,
-    38,
+    39,
     29,
     24,
     -5,
     false,
     nullptr,
     0,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    ubuntu_12_boldLigatures,
+    5,
+    0x4000000001ull,
+    ubuntu_12_boldGlyphLookup,
+    nullptr,
+    false,
+    nullptr,
 };
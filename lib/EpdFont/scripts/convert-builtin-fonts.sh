@@ -4,17 +4,31 @@ set -e
 
 cd "$(dirname "$0")"
 
+# With --check the fonts are generated into a temporary directory and compared with the committed headers, which
+# shows that every builtin font is exactly what this script produces
+OUTPUT_DIR="../builtinFonts"
+if [ "$1" == "--check" ]; then
+  OUTPUT_DIR="$(mktemp -d)"
+  trap 'rm -rf "$OUTPUT_DIR"' EXIT
+fi
+
 READER_FONT_STYLES=("Regular" "Italic" "Bold" "BoldItalic")
 BOOKERLY_FONT_SIZES=(12 14 16 18)
 NOTOSANS_FONT_SIZES=(12 14 16 18)
 OPENDYSLEXIC_FONT_SIZES=(8 10 12 14)
 
+# Character frequencies of the hyphenation test corpora, used to group frequently drawn glyphs in compressed fonts
+FREQUENCY_CORPORA=""
+for corpus in $(ls ../../../test/hyphenation_eval/resources/*_hyphenation_tests.txt | LC_ALL=C sort); do
+  FREQUENCY_CORPORA="$FREQUENCY_CORPORA --frequency-corpus $corpus"
+done
+
 for size in ${BOOKERLY_FONT_SIZES[@]}; do
   for style in ${READER_FONT_STYLES[@]}; do
     font_name="bookerly_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
     font_path="../builtinFonts/source/Bookerly/Bookerly-${style}.ttf"
-    output_path="../builtinFonts/${font_name}.h"
-    python fontconvert.py $font_name $size $font_path --2bit --compress > $output_path
+    output_path="$OUTPUT_DIR/${font_name}.h"
+    python fontconvert.py $font_name $size $font_path --2bit --compress $FREQUENCY_CORPORA > $output_path
     echo "Generated $output_path"
   done
 done
@@ -23,22 +37,24 @@ for size in ${NOTOSANS_FONT_SIZES[@]}; do
   for style in ${READER_FONT_STYLES[@]}; do
     font_name="notosans_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
     font_path="../builtinFonts/source/NotoSans/NotoSans-${style}.ttf"
-    output_path="../builtinFonts/${font_name}.h"
-    python fontconvert.py $font_name $size $font_path --2bit --compress > $output_path
+    output_path="$OUTPUT_DIR/${font_name}.h"
+    python fontconvert.py $font_name $size $font_path --2bit --compress $FREQUENCY_CORPORA > $output_path
     echo "Generated $output_path"
   done
 done
 
+# OpenDyslexic's few kerning pairs change the width of none of the corpus words, so its 117 KB of tables are left out
 for size in ${OPENDYSLEXIC_FONT_SIZES[@]}; do
   for style in ${READER_FONT_STYLES[@]}; do
     font_name="opendyslexic_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
     font_path="../builtinFonts/source/OpenDyslexic/OpenDyslexic-${style}.otf"
-    output_path="../builtinFonts/${font_name}.h"
-    python fontconvert.py $font_name $size $font_path --2bit --compress > $output_path
+    output_path="$OUTPUT_DIR/${font_name}.h"
+    python fontconvert.py $font_name $size $font_path --2bit --compress --no-kerning $FREQUENCY_CORPORA > $output_path
     echo "Generated $output_path"
   done
 done
 
+# The UI fonts draw short labels, which go without kerning (54 KB of tables)
 UI_FONT_SIZES=(10 12)
 UI_FONT_STYLES=("Regular" "Bold")
 
@@ -46,14 +62,31 @@ for size in ${UI_FONT_SIZES[@]}; do
   for style in ${UI_FONT_STYLES[@]}; do
     font_name="ubuntu_${size}_$(echo $style | tr '[:upper:]' '[:lower:]')"
     font_path="../builtinFonts/source/Ubuntu/Ubuntu-${style}.ttf"
-    output_path="../builtinFonts/${font_name}.h"
-    python fontconvert.py $font_name $size $font_path > $output_path
+    output_path="$OUTPUT_DIR/${font_name}.h"
+    python fontconvert.py $font_name $size $font_path --no-kerning > $output_path
     echo "Generated $output_path"
   done
 done
 
-python fontconvert.py notosans_8_regular 8 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf > ../builtinFonts/notosans_8_regular.h
+python fontconvert.py notosans_8_regular 8 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --no-kerning > $OUTPUT_DIR/notosans_8_regular.h
+echo "Generated $OUTPUT_DIR/notosans_8_regular.h"
 
 echo ""
 echo "Running compression verification..."
-python verify_compression.py ../builtinFonts/
+python verify_compression.py $OUTPUT_DIR/
+
+if [ "$OUTPUT_DIR" != "../builtinFonts" ]; then
+  echo ""
+  echo "Comparing with the committed fonts..."
+  for header in "$OUTPUT_DIR"/*.h; do
+    if ! cmp -s "$header" "../builtinFonts/$(basename "$header")"; then
+      echo "  DIFFERS: $(basename "$header")"
+      mismatches=1
+    fi
+  done
+  if [ -n "$mismatches" ]; then
+    echo "The committed fonts are not what this script generates"
+    exit 1
+  fi
+  echo "All committed fonts match"
+fi
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+Converts generated font headers (builtinFonts/*.h) into SD card font files (.epf), so fonts left out of the firmware
+with OMIT_FONTS can be copied to /fonts on the SD card. Glyph bitmaps are run-length encoded unless --packed is given,
+and laid out in the order of the compression groups of the header, which keeps frequently drawn glyphs on the same
+pages.
+"""
+import argparse
+import os
+import re
+import sys
+import zlib
+
+from glyph_runs import encode_runs
+from sd_font_file import write_sd_font
+from verify_compression import parse_glyphs, parse_groups, parse_hex_array
+
+
+def parse_array(content, c_type, name):
+    match = re.search(r'static const ' + c_type + r' ' + re.escape(name) + r'\[\d*\]\s*=\s*\{(.+?)\};', content,
+                      re.DOTALL)
+    return match.group(1) if match else None
+
+
+def parse_ints(text):
+    return [int(v, 0) for v in re.findall(r'-?(?:0x[0-9A-Fa-f]+|\d+)', re.sub(r'//[^\n]*', '', text))]
+
+
+def parse_font_data(content, font_name):
+    """Fields of the EpdFontData initializer, in declaration order."""
+    match = re.search(r'static const EpdFontData ' + re.escape(font_name) + r'\s*=\s*\{(.+?)\};', content, re.DOTALL)
+    return [field.strip() for field in match.group(1).split(',') if field.strip()]
+
+
+def export_font(header_path, output_path, rle):
+    with open(header_path, 'r') as f:
+        content = f.read()
+    font_name = re.search(r'static const EpdFontData (\w+)\s*=', content).group(1)
+    fields = parse_font_data(content, font_name)
+    interval_count, advance_y, ascender, descender = (int(v) for v in fields[3:7])
+    is2Bit = fields[7] == 'true'
+    rle_bitmaps = len(fields) > 18 and fields[18] == 'true'
+
+    bitmap_data = parse_hex_array(parse_array(content, 'uint8_t', font_name + 'Bitmaps'))
+    glyphs = parse_glyphs(parse_array(content, 'EpdGlyph', font_name + 'Glyphs'))
+    intervals = [tuple(parse_ints(m)) for m in re.findall(r'\{([^{}]+)\}',
+                                                           parse_array(content, 'EpdUnicodeInterval',
+                                                                       font_name + 'Intervals'))]
+    assert len(intervals) == interval_count
+
+    # Bitmaps of compressed fonts are inflated group by group, their dataOffset is within the group
+    group_of_glyph = [0] * len(glyphs)
+    groups_text = parse_array(content, 'EpdFontGroup', font_name + 'Groups')
+    if groups_text:
+        groups = parse_groups(groups_text)
+        glyph_groups_text = parse_array(content, 'uint8_t', font_name + 'GlyphGroups')
+        if glyph_groups_text:
+            group_of_glyph = parse_ints(glyph_groups_text)
+        else:
+            for gi, group in enumerate(groups):
+                for i in range(group['firstGlyphIndex'], group['firstGlyphIndex'] + group['glyphCount']):
+                    group_of_glyph[i] = gi
+        inflated = [zlib.decompress(bitmap_data[g['compressedOffset']:g['compressedOffset'] + g['compressedSize']], -15)
+                    for g in groups]
+        sources = [inflated[group_of_glyph[i]] for i in range(len(glyphs))]
+    else:
+        sources = [bitmap_data] * len(glyphs)
+
+    bitmaps = []
+    for glyph, source in zip(glyphs, sources):
+        bitmap = source[glyph['dataOffset']:glyph['dataOffset'] + glyph['dataLength']]
+        if rle and not rle_bitmaps:
+            bitmap = encode_runs(bitmap, glyph['width'] * glyph['height'], is2Bit)
+        bitmaps.append(bitmap)
+
+    kern = {}
+    kern_matrix_text = parse_array(content, 'int8_t', font_name + 'KernMatrix')
+    if kern_matrix_text:
+        kern = dict(
+            kern_left_classes=parse_ints(parse_array(content, 'uint8_t', font_name + 'KernLeftClasses')),
+            kern_right_classes=parse_ints(parse_array(content, 'uint8_t', font_name + 'KernRightClasses')),
+            kern_matrix=parse_ints(kern_matrix_text),
+            kern_right_class_count=int(fields[13]),
+        )
+    ligatures_text = parse_array(content, 'EpdLigaturePair', font_name + 'Ligatures')
+    ligatures = [tuple(parse_ints(m)) for m in re.findall(r'\{([^{}]+)\}', ligatures_text)] if ligatures_text else []
+
+    # Glyphs of the same compression group are drawn together, so they share pages as well
+    order = sorted(range(len(glyphs)), key=lambda i: (group_of_glyph[i], i))
+    return write_sd_font(
+        output_path,
+        intervals=intervals,
+        glyphs=[(g['width'], g['height'], g['advanceX'], g['left'], g['top']) for g in glyphs],
+        bitmaps=bitmaps,
+        is2Bit=is2Bit,
+        rle=rle or rle_bitmaps,
+        advance_y=advance_y,
+        ascender=ascender,
+        descender=descender,
+        glyph_lookup=parse_ints(parse_array(content, 'uint16_t', font_name + 'GlyphLookup')),
+        ligatures=ligatures,
+        order=order,
+        **kern,
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert generated font headers into SD card font files (.epf).")
+    parser.add_argument("headers", nargs='+', help="font headers, or directories of font headers")
+    parser.add_argument("--output", required=True, help="directory to write the .epf files to")
+    parser.add_argument("--packed", action="store_true", help="keep packed bitmaps instead of run-length encoding them")
+    args = parser.parse_args()
+
+    paths = []
+    for path in args.headers:
+        if os.path.isdir(path):
+            paths += sorted(os.path.join(path, f) for f in os.listdir(path) if f.endswith('.h') and f != 'all.h')
+        else:
+            paths.append(path)
+
+    os.makedirs(args.output, exist_ok=True)
+    for path in paths:
+        output_path = os.path.join(args.output, os.path.splitext(os.path.basename(path))[0] + '.epf')
+        pages, page_size = export_font(path, output_path, not args.packed)
+        print(f"Generated {output_path} ({os.path.getsize(output_path)} bytes, {pages} pages of {page_size} bytes)")
+
+
+if __name__ == '__main__':
+    sys.exit(main())
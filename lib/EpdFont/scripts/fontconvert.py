@@ -1,11 +1,15 @@
 #!python3
 import freetype
+from fontTools.ttLib import TTFont
 import zlib
 import sys
 import re
 import math
 import argparse
 from collections import namedtuple
+from glyph_groups import group_glyphs, read_corpus
+from glyph_runs import decode_runs, encode_runs, unpack_pixels
+from sd_font_file import write_sd_font
 
 # Originally from https://github.com/vroland/epdiy
 
@@ -16,7 +20,16 @@ parser.add_argument("fontstack", action="store", nargs='+', help="list of font f
 parser.add_argument("--2bit", dest="is2Bit", action="store_true", help="generate 2-bit greyscale bitmap instead of 1-bit black and white.")
 parser.add_argument("--additional-intervals", dest="additional_intervals", action="append", help="Additional code point intervals to export as min,max. This argument can be repeated.")
 parser.add_argument("--compress", dest="compress", action="store_true", help="Compress glyph bitmaps using DEFLATE with group-based compression.")
+parser.add_argument("--rle", dest="rle", action="store_true", help="Run-length encode glyph bitmaps. They are drawn straight from flash without a decompression buffer, at a size between uncompressed and --compress.")
+parser.add_argument("--sd-font", dest="sd_font", metavar="PATH", help="Write an SD card font file (.epf) to PATH instead of printing a header. Glyph bitmaps are read from the card in pages, combine with --rle to keep the file and page reads small.")
+parser.add_argument("--frequency-corpus", dest="frequency_corpora", action="append", help="Word frequency list (word|hyphenated|count per line) used to group frequently drawn glyphs together when compressing. This argument can be repeated, once per language.")
+parser.add_argument("--no-kerning", dest="kerning", action="store_false", help="Do not export GPOS pair kerning.")
+parser.add_argument("--no-ligatures", dest="ligatures", action="store_false", help="Do not export GSUB standard ligatures.")
 args = parser.parse_args()
+if args.compress and args.rle:
+    parser.error("--compress and --rle cannot be combined")
+if args.compress and args.sd_font:
+    parser.error("--compress and --sd-font cannot be combined, SD card fonts are read in pages instead")
 
 GlyphProps = namedtuple("GlyphProps", ["width", "height", "advance_x", "left", "top", "data_length", "data_offset", "code_point"])
 
@@ -102,6 +115,9 @@ intervals = [
     # (0xFE30, 0xFE4F),
     # # CJK Compatibility Ideographs
     # (0xF900, 0xFAFF),
+    ### Alphabetic Presentation Forms (Latin ligatures) ###
+    # ff, fi, fl, ffi, ffl, long st, st - targets of the exported GSUB ligatures
+    (0xFB00, 0xFB06),
     ### Specials
     # Replacement Character
     (0xFFFD, 0xFFFD),
@@ -158,6 +174,7 @@ for face in font_stack:
 
 total_size = 0
 all_glyphs = []
+glyph_is_primary = []  # Whether each glyph comes from the first font of the stack
 
 for i_start, i_end in intervals:
     for code_point in range(i_start, i_end + 1):
@@ -260,6 +277,173 @@ for i_start, i_end in intervals:
         )
         total_size += len(packed)
         all_glyphs.append((glyph, packed))
+        glyph_is_primary.append(face is font_stack[0])
+
+### Kerning and ligatures ###
+# Only the first font of the stack is consulted, glyphs taken from fallback fonts never kern or form ligatures.
+# Adjustments are rounded to whole pixels, like the glyph advances they are added to.
+
+primary_font = TTFont(args.fontstack[0])
+pixels_per_unit = size * 150 / 72 / primary_font['head'].unitsPerEm
+
+glyph_index_by_code_point = {props.code_point: i for i, (props, packed) in enumerate(all_glyphs)}
+# glyph name -> indices into all_glyphs, several code points can share a glyph
+glyph_indices_by_name = {}
+for code_point, glyph_name in primary_font.getBestCmap().items():
+    index = glyph_index_by_code_point.get(code_point)
+    if index is not None and glyph_is_primary[index]:
+        glyph_indices_by_name.setdefault(glyph_name, []).append(index)
+
+def feature_lookups(table_tag, feature_tag):
+    if table_tag not in primary_font:
+        return []
+    table = primary_font[table_tag].table
+    if table.FeatureList is None or table.LookupList is None:
+        return []
+    lookup_indices = set()
+    for record in table.FeatureList.FeatureRecord:
+        if record.FeatureTag == feature_tag:
+            lookup_indices.update(record.Feature.LookupListIndex)
+    return [table.LookupList.Lookup[i] for i in sorted(lookup_indices)]
+
+def lookup_subtables(lookup, lookup_type, extension_type):
+    for subtable in lookup.SubTable:
+        if lookup.LookupType == extension_type:
+            if subtable.ExtensionLookupType != lookup_type:
+                continue
+            subtable = subtable.ExtSubTable
+        elif lookup.LookupType != lookup_type:
+            continue
+        yield subtable
+
+def x_advance(value_record):
+    if value_record is None:
+        return 0
+    return getattr(value_record, "XAdvance", 0) or 0
+
+# (left glyph name, right glyph name) -> adjustment in font units
+kerning_units = {}
+if args.kerning:
+    for lookup in feature_lookups("GPOS", "kern"):
+        # Within a lookup the first subtable that covers a pair wins. A format 2 subtable covers every right glyph
+        # once it covers the left glyph, format 1 only the pairs it lists.
+        claimed_lefts = set()
+        claimed_pairs = set()
+        for subtable in lookup_subtables(lookup, 2, 9):
+            if subtable.Format == 1:
+                for left_name, pair_set in zip(subtable.Coverage.glyphs, subtable.PairSet):
+                    if left_name not in glyph_indices_by_name or left_name in claimed_lefts:
+                        continue
+                    for record in pair_set.PairValueRecord:
+                        pair = (left_name, record.SecondGlyph)
+                        if record.SecondGlyph not in glyph_indices_by_name or pair in claimed_pairs:
+                            continue
+                        claimed_pairs.add(pair)
+                        kerning_units[pair] = kerning_units.get(pair, 0) + x_advance(record.Value1)
+            elif subtable.Format == 2:
+                left_classes = subtable.ClassDef1.classDefs if subtable.ClassDef1 else {}
+                right_classes = subtable.ClassDef2.classDefs if subtable.ClassDef2 else {}
+                right_names_by_class = {}
+                for right_name in glyph_indices_by_name:
+                    right_names_by_class.setdefault(right_classes.get(right_name, 0), []).append(right_name)
+                for left_name in subtable.Coverage.glyphs:
+                    if left_name not in glyph_indices_by_name or left_name in claimed_lefts:
+                        continue
+                    claimed_lefts.add(left_name)
+                    class1_record = subtable.Class1Record[left_classes.get(left_name, 0)]
+                    for right_class, class2_record in enumerate(class1_record.Class2Record):
+                        adjustment = x_advance(class2_record.Value1)
+                        if adjustment == 0:
+                            continue
+                        for right_name in right_names_by_class.get(right_class, []):
+                            pair = (left_name, right_name)
+                            if pair not in claimed_pairs:
+                                kerning_units[pair] = kerning_units.get(pair, 0) + adjustment
+
+# (left glyph index, right glyph index) -> adjustment in pixels
+kerning_pixels = {}
+for (left_name, right_name), units in kerning_units.items():
+    pixels = max(-128, min(127, int(round(units * pixels_per_unit))))
+    if pixels == 0:
+        continue
+    for left_index in glyph_indices_by_name[left_name]:
+        for right_index in glyph_indices_by_name[right_name]:
+            kerning_pixels[(left_index, right_index)] = pixels
+
+def assign_classes(signatures):
+    # Glyphs with identical signatures share a class. Classes are numbered from 1 (0 = no kerning) and only the 255
+    # heaviest are kept so they fit in a uint8_t.
+    weights = {}
+    for signature in signatures.values():
+        weights[signature] = weights.get(signature, 0) + sum(abs(pixels) for _, pixels in signature)
+    kept = sorted(weights, key=lambda signature: (-weights[signature], signature))[:255]
+    if len(weights) > len(kept):
+        print(f"// Kerning: dropped {len(weights) - len(kept)} of {len(weights)} classes", file=sys.stderr)
+    class_ids = {signature: i + 1 for i, signature in enumerate(kept)}
+    return {index: class_ids.get(signature, 0) for index, signature in signatures.items()}, len(kept)
+
+kern_left_classes = [0] * len(all_glyphs)
+kern_right_classes = [0] * len(all_glyphs)
+kern_matrix = []
+kern_right_class_count = 0
+if kerning_pixels:
+    # Right glyphs are grouped by their column of adjustments, left glyphs by their row over those right classes
+    columns = {}
+    for (left_index, right_index), pixels in kerning_pixels.items():
+        columns.setdefault(right_index, []).append((left_index, pixels))
+    right_ids, right_count = assign_classes({i: tuple(sorted(column)) for i, column in columns.items()})
+    rows = {}
+    for (left_index, right_index), pixels in kerning_pixels.items():
+        if right_ids[right_index] != 0:
+            rows.setdefault(left_index, {})[right_ids[right_index]] = pixels
+    left_ids, left_count = assign_classes({i: tuple(sorted(row.items())) for i, row in rows.items()})
+
+    kern_right_class_count = right_count + 1
+    kern_matrix = [0] * ((left_count + 1) * kern_right_class_count)
+    for index, class_id in right_ids.items():
+        kern_right_classes[index] = class_id
+    for index, class_id in left_ids.items():
+        kern_left_classes[index] = class_id
+        if class_id == 0:
+            continue
+        for right_id, pixels in rows[index].items():
+            kern_matrix[class_id * kern_right_class_count + right_id] = pixels
+    print(f"// Kerning: {len(kerning_pixels)} pairs, {left_count} x {right_count} classes", file=sys.stderr)
+
+# (first code point, second code point) -> ligature code point
+ligature_pairs = {}
+if args.ligatures:
+    code_points_by_name = {name: [all_glyphs[i][0].code_point for i in indices]
+                           for name, indices in glyph_indices_by_name.items()}
+    ligatures = []  # (component glyph names, ligature glyph name)
+    for lookup in feature_lookups("GSUB", "liga"):
+        for subtable in lookup_subtables(lookup, 4, 7):
+            for first_name, ligature_set in subtable.ligatures.items():
+                for ligature in ligature_set:
+                    ligatures.append(([first_name] + list(ligature.Component), ligature.LigGlyph))
+    # Longer ligatures are chained through the shorter ones, e.g. "ffi" = ("ff" ligature, "i")
+    for components, ligature_name in sorted(ligatures, key=lambda ligature: len(ligature[0])):
+        if ligature_name not in code_points_by_name:
+            continue
+        ligature_code_point = code_points_by_name[ligature_name][0]
+        prefixes = code_points_by_name.get(components[0], [])
+        for component in components[1:-1]:
+            prefixes = [ligature_pairs[(prefix, code_point)] for prefix in prefixes
+                        for code_point in code_points_by_name.get(component, [])
+                        if (prefix, code_point) in ligature_pairs]
+        for prefix in prefixes:
+            for code_point in code_points_by_name.get(components[-1], []):
+                ligature_pairs.setdefault((prefix, code_point), ligature_code_point)
+    if ligature_pairs:
+        print(f"// Ligatures: {len(ligature_pairs)} pairs", file=sys.stderr)
+
+# Direct-mapped glyph indices for the most common code points, must match GLYPH_LOOKUP_* in EpdFontData.h
+GLYPH_LOOKUP_RANGES = [(0x0000, 0x00FF), (0x2000, 0x206F)]
+GLYPH_LOOKUP_MISSING = 0xFFFF
+glyph_lookup = []
+for start, end in GLYPH_LOOKUP_RANGES:
+    for code_point in range(start, end + 1):
+        glyph_lookup.append(glyph_index_by_code_point.get(code_point, GLYPH_LOOKUP_MISSING))
 
 # pipe seems to be a good heuristic for the "real" descender
 face = load_glyph(ord('|'))
@@ -273,63 +457,39 @@ for index, glyph in enumerate(all_glyphs):
 
 compress = args.compress
 
+if args.rle:
+    # Offsets and lengths now refer to the run-length streams
+    glyph_data = []
+    for index, props in enumerate(glyph_props):
+        pixel_count = props.width * props.height
+        runs = encode_runs(all_glyphs[index][1], pixel_count, is2Bit)
+        # The device draws the runs without a way to check them, so every glyph must decode back to its pixels
+        if decode_runs(runs, pixel_count) != unpack_pixels(all_glyphs[index][1], pixel_count, is2Bit):
+            sys.exit(f"Run-length encoding of U+{props.code_point:04X} does not decode back to its pixels")
+        glyph_props[index] = props._replace(data_length=len(runs), data_offset=len(glyph_data))
+        glyph_data.extend(runs)
+
 # Build groups for compression
 if compress:
-    # Script-based grouping: glyphs that co-occur in typical text rendering
-    # are grouped together for efficient LRU caching on the embedded target.
-    # Since glyphs are in codepoint order, glyphs in the same Unicode block
-    # are contiguous in the array and form natural groups.
-    SCRIPT_GROUP_RANGES = [
-        (0x0000, 0x007F),   # ASCII
-        (0x0080, 0x00FF),   # Latin-1 Supplement
-        (0x0100, 0x017F),   # Latin Extended-A
-        (0x0300, 0x036F),   # Combining Diacritical Marks
-        (0x0400, 0x04FF),   # Cyrillic
-        (0x2000, 0x206F),   # General Punctuation
-        (0x2070, 0x209F),   # Superscripts & Subscripts
-        (0x20A0, 0x20CF),   # Currency Symbols
-        (0x2190, 0x21FF),   # Arrows
-        (0x2200, 0x22FF),   # Math Operators
-        (0xFFFD, 0xFFFD),   # Replacement Character
-    ]
-
-    def get_script_group(code_point):
-        for i, (start, end) in enumerate(SCRIPT_GROUP_RANGES):
-            if start <= code_point <= end:
-                return i
-        return -1
-
-    groups = []  # list of (first_glyph_index, glyph_count)
-    current_group_id = None
-    group_start = 0
-    group_count = 0
-
-    for i, (props, packed) in enumerate(all_glyphs):
-        sg = get_script_group(props.code_point)
-        if sg != current_group_id:
-            if group_count > 0:
-                groups.append((group_start, group_count))
-            current_group_id = sg
-            group_start = i
-            group_count = 1
-        else:
-            group_count += 1
-
-    if group_count > 0:
-        groups.append((group_start, group_count))
+    # Glyphs that are drawn together share a group, so a page only needs a few groups inflated
+    corpora = [read_corpus(path) for path in (args.frequency_corpora or [])]
+    groups = group_glyphs([props.code_point for props in glyph_props], [props.data_length for props in glyph_props],
+                          corpora)
 
     # Compress each group
     compressed_groups = []  # list of (compressed_bytes, uncompressed_size, glyph_count, first_glyph_index)
+    glyph_groups = [0] * len(glyph_props)
     compressed_bitmap_data = []
     compressed_offset = 0
 
     # Also build modified glyph props with within-group offsets
     modified_glyph_props = list(glyph_props)
 
-    for first_idx, count in groups:
+    for group_index, group in enumerate(groups):
         # Concatenate bitmap data for this group
         group_data = b''
-        for gi in range(first_idx, first_idx + count):
+        for gi in group:
+            glyph_groups[gi] = group_index
             props, packed = all_glyphs[gi]
             # Update glyph's dataOffset to be within-group offset
             within_group_offset = len(group_data)
@@ -346,11 +506,12 @@ if compress:
             )
             group_data += packed
 
-        # Compress with raw DEFLATE (no zlib/gzip header)
-        compressor = zlib.compressobj(level=9, wbits=-15)
+        # Compress with raw DEFLATE (no zlib/gzip header). Packed glyph rows repeat little beyond short runs, which
+        # Z_FILTERED codes more tightly than the default string matching
+        compressor = zlib.compressobj(level=9, wbits=-15, memLevel=9, strategy=zlib.Z_FILTERED)
         compressed = compressor.compress(group_data) + compressor.flush()
 
-        compressed_groups.append((compressed, len(group_data), count, first_idx))
+        compressed_groups.append((compressed, len(group_data), len(group), group[0]))
         compressed_bitmap_data.extend(compressed)
         compressed_offset += len(compressed)
 
@@ -359,11 +520,39 @@ if compress:
     total_uncompressed = len(glyph_data)
     print(f"// Compression: {total_uncompressed} -> {total_compressed} bytes ({100*total_compressed/total_uncompressed:.1f}%), {len(groups)} groups", file=sys.stderr)
 
+if args.sd_font:
+    # Glyphs drawn together share pages, like they share compression groups
+    order = None
+    if args.frequency_corpora:
+        corpora = [read_corpus(path) for path in args.frequency_corpora]
+        order = [i for group in group_glyphs([props.code_point for props in glyph_props],
+                                             [props.data_length for props in glyph_props], corpora) for i in group]
+    page_count, page_size = write_sd_font(
+        args.sd_font,
+        intervals=[(i_start, i_end, sum(e - s + 1 for s, e in intervals[:i])) for i, (i_start, i_end) in enumerate(intervals)],
+        glyphs=glyph_props,
+        bitmaps=[bytes(glyph_data[p.data_offset:p.data_offset + p.data_length]) for p in glyph_props],
+        is2Bit=is2Bit,
+        rle=args.rle,
+        advance_y=norm_ceil(face.size.height),
+        ascender=norm_ceil(face.size.ascender),
+        descender=norm_floor(face.size.descender),
+        glyph_lookup=glyph_lookup,
+        kern_left_classes=kern_left_classes,
+        kern_right_classes=kern_right_classes,
+        kern_matrix=kern_matrix,
+        kern_right_class_count=kern_right_class_count,
+        ligatures=[(first, second, ligature) for (first, second), ligature in sorted(ligature_pairs.items())],
+        order=order,
+    )
+    print(f"// SD font: {page_count} pages of {page_size} bytes written to {args.sd_font}", file=sys.stderr)
+    sys.exit(0)
+
 print(f"""/**
  * generated by fontconvert.py
  * name: {font_name}
  * size: {size}
- * mode: {'2-bit' if is2Bit else '1-bit'}{'  compressed: true' if compress else ''}
+ * mode: {'2-bit' if is2Bit else '1-bit'}{'  compressed: true' if compress else ''}{'  run-length encoded: true' if args.rle else ''}
  * Command used: {' '.join(sys.argv)}
  */
 #pragma once
@@ -401,6 +590,38 @@ if compress:
         compressed_offset += len(compressed)
     print("};\n")
 
+    print(f"static const uint8_t {font_name}GlyphGroups[{len(glyph_groups)}] = {{")
+    for c in chunks(glyph_groups, 32):
+        print ("    " + " ".join(f"{g}," for g in c))
+    print("};\n")
+
+if kern_matrix:
+    print(f"static const uint8_t {font_name}KernLeftClasses[{len(kern_left_classes)}] = {{")
+    for c in chunks(kern_left_classes, 16):
+        print ("    " + " ".join(f"{v}," for v in c))
+    print ("};\n");
+
+    print(f"static const uint8_t {font_name}KernRightClasses[{len(kern_right_classes)}] = {{")
+    for c in chunks(kern_right_classes, 16):
+        print ("    " + " ".join(f"{v}," for v in c))
+    print ("};\n");
+
+    print(f"static const int8_t {font_name}KernMatrix[{len(kern_matrix)}] = {{")
+    for c in chunks(kern_matrix, kern_right_class_count):
+        print ("    " + " ".join(f"{v}," for v in c))
+    print ("};\n");
+
+if ligature_pairs:
+    print(f"static const EpdLigaturePair {font_name}Ligatures[] = {{")
+    for (first, second), ligature in sorted(ligature_pairs.items()):
+        print (f"    {{ 0x{first:X}, 0x{second:X}, 0x{ligature:X} }},")
+    print ("};\n");
+
+print(f"static const uint16_t {font_name}GlyphLookup[{len(glyph_lookup)}] = {{")
+for c in chunks(glyph_lookup, 16):
+    print ("    " + " ".join(f"0x{v:04X}," for v in c))
+print ("};\n");
+
 print(f"static const EpdFontData {font_name} = {{")
 print(f"    {font_name}Bitmaps,")
 print(f"    {font_name}Glyphs,")
@@ -416,4 +637,30 @@ if compress:
 else:
     print(f"    nullptr,")
     print(f"    0,")
+if kern_matrix:
+    print(f"    {font_name}KernLeftClasses,")
+    print(f"    {font_name}KernRightClasses,")
+    print(f"    {font_name}KernMatrix,")
+    print(f"    {kern_right_class_count},")
+else:
+    print(f"    nullptr,")
+    print(f"    nullptr,")
+    print(f"    nullptr,")
+    print(f"    0,")
+if ligature_pairs:
+    print(f"    {font_name}Ligatures,")
+    print(f"    {len(ligature_pairs)},")
+    # ligatureStartBit() of EpdFontData.h
+    print(f"    0x{sum({1 << (first & 63) for first, _ in ligature_pairs}):X}ull,")
+else:
+    print(f"    nullptr,")
+    print(f"    0,")
+    print(f"    0,")
+print(f"    {font_name}GlyphLookup,")
+if compress:
+    print(f"    {font_name}GlyphGroups,")
+else:
+    print(f"    nullptr,")
+print(f"    {'true' if args.rle else 'false'},")
+print(f"    nullptr,")
 print("};")
@@ -0,0 +1,134 @@
+"""
+Glyph grouping for compressed fonts.
+
+Every group is DEFLATE-compressed on its own and has to be inflated in full before any of its glyphs can be drawn,
+so glyphs that are drawn together should share a group and rarely drawn glyphs should stay out of the hot ones.
+
+Without frequency data, glyphs are grouped by Unicode block. With character frequency corpora, the glyphs that make
+up nearly all running text of each script are pulled into one small hot group per script (printable ASCII and common
+punctuation go with the first one). The remaining cold glyphs are packed into as few groups as possible, each no
+larger than the largest block group, so fewer streams offset the compression lost by splitting the hot glyphs out.
+"""
+from collections import Counter
+
+# Glyphs are in code point order, so the glyphs of one block are contiguous in the glyph array
+SCRIPT_GROUP_RANGES = [
+    (0x0000, 0x007F),   # ASCII
+    (0x0080, 0x00FF),   # Latin-1 Supplement
+    (0x0100, 0x017F),   # Latin Extended-A
+    (0x0300, 0x036F),   # Combining Diacritical Marks
+    (0x0400, 0x04FF),   # Cyrillic
+    (0x2000, 0x206F),   # General Punctuation
+    (0x2070, 0x209F),   # Superscripts & Subscripts
+    (0x20A0, 0x20CF),   # Currency Symbols
+    (0x2190, 0x21FF),   # Arrows
+    (0x2200, 0x22FF),   # Math Operators
+    (0xFB00, 0xFB4F),   # Alphabetic Presentation Forms
+    (0xFFFD, 0xFFFD),   # Replacement Character
+]
+
+# Printable ASCII and the punctuation used by running text in any language. The corpora are word lists, so they can't
+# tell how common punctuation and capitals are.
+COMMON_GLYPHS = list(range(0x20, 0x7F)) + [0xA0, 0xAB, 0xBB, 0x2013, 0x2014, 0x2018, 0x2019, 0x201C, 0x201D, 0x2026]
+
+# Share of a language's characters that its hot glyphs have to cover
+HOT_COVERAGE = 1.0
+
+
+def get_script_group(code_point):
+    for i, (start, end) in enumerate(SCRIPT_GROUP_RANGES):
+        if start <= code_point <= end:
+            return i
+    return -1
+
+
+def ord_single(s):
+    # Case mappings that expand to several characters (e.g. German sharp s) have no single glyph
+    return ord(s) if len(s) == 1 else -1
+
+
+def read_corpus(path):
+    """Character counts of a word frequency list in the hyphenation test data format (word|hyphenated|count)."""
+    counts = Counter()
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            fields = line.split("|")
+            word = fields[0]
+            frequency = int(fields[2]) if len(fields) > 2 and fields[2].isdigit() else 1
+            for c in word:
+                counts[ord(c)] += frequency
+    return counts
+
+
+def script_groups(code_points):
+    groups = []
+    current_group_id = None
+    for i, code_point in enumerate(code_points):
+        group_id = get_script_group(code_point)
+        if group_id != current_group_id or not groups:
+            groups.append([])
+            current_group_id = group_id
+        groups[-1].append(i)
+    return groups
+
+
+def group_glyphs(code_points, glyph_sizes, corpora=()):
+    """
+    Splits glyphs (given by their code points and bitmap sizes, in glyph array order) into compression groups.
+    Returns a list of groups, each a sorted list of glyph indices.
+    """
+    block_groups = script_groups(code_points)
+    if not corpora:
+        return block_groups
+
+    index_by_code_point = {code_point: i for i, code_point in enumerate(code_points)}
+
+    # The most frequent glyphs of each language that together cover HOT_COVERAGE of its text. Languages written in
+    # the same script (judged by their most frequent character) share one hot group.
+    hot_by_script = {}
+    for counts in corpora:
+        if not counts:
+            continue
+        total = sum(counts.values())
+        covered = 0
+        script = get_script_group(counts.most_common(1)[0][0])
+        hot = hot_by_script.setdefault(script, set())
+        for code_point, count in counts.most_common():
+            if covered >= HOT_COVERAGE * total:
+                break
+            covered += count
+            # Word lists under-count capitals, so a hot letter brings its other case along
+            for variant in {code_point, ord_single(chr(code_point).upper()), ord_single(chr(code_point).lower())}:
+                if variant in index_by_code_point:
+                    hot.add(index_by_code_point[variant])
+
+    # Common glyphs join the hot group of the first script (Latin)
+    common = {index_by_code_point[cp] for cp in COMMON_GLYPHS if cp in index_by_code_point}
+    groups = []
+    assigned = set()
+    for script in sorted(hot_by_script):
+        group = sorted((hot_by_script[script] | (common if not groups else set())) - assigned)
+        if group:
+            groups.append(group)
+            assigned.update(group)
+
+    # Cold glyphs in glyph order, split only where a group would outgrow the largest block group so the peak
+    # decompression buffer stays the same
+    max_group_size = max(sum(glyph_sizes[i] for i in group) for group in block_groups)
+    cold = []
+    cold_size = 0
+    for i in range(len(code_points)):
+        if i in assigned:
+            continue
+        if cold and cold_size + glyph_sizes[i] > max_group_size:
+            groups.append(cold)
+            cold = []
+            cold_size = 0
+        cold.append(i)
+        cold_size += glyph_sizes[i]
+    if cold:
+        groups.append(cold)
+    return groups
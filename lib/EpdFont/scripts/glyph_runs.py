@@ -0,0 +1,52 @@
+"""
+Run-length encoding of glyph bitmaps (EpdFontData::rleBitmaps), drawn straight from flash without a decompression
+buffer. See EpdGlyphRuns.h for the reader on the device.
+
+Pixels are taken in the same row-major order as packed bitmaps and stored as runs of one value, one or more nibbles
+per run (high nibble first). A nibble holds the pixel value in its upper two bits and a length digit of 1-4 in its
+lower two. Neighbouring runs always differ in value, so a nibble that repeats the value of the one before continues
+that run with the next, four times heavier, digit (bijective base 4): 5 = 1 + 1*4, 20 = 4 + 4*4, 21 = 1 + 1*4 + 1*16.
+"""
+
+
+def unpack_pixels(packed, pixel_count, is2Bit):
+    bits = 2 if is2Bit else 1
+    per_byte = 8 // bits
+    mask = (1 << bits) - 1
+    return [(packed[i // per_byte] >> ((per_byte - 1 - i % per_byte) * bits)) & mask for i in range(pixel_count)]
+
+
+def encode_runs(packed, pixel_count, is2Bit):
+    pixels = unpack_pixels(packed, pixel_count, is2Bit)
+    nibbles = []
+    i = 0
+    while i < len(pixels):
+        value = pixels[i]
+        length = 1
+        while i + length < len(pixels) and pixels[i + length] == value:
+            length += 1
+        i += length
+        while length > 0:
+            digit = (length - 1) % 4 + 1
+            nibbles.append((value << 2) | (digit - 1))
+            length = (length - digit) // 4
+    if len(nibbles) % 2:
+        # Padding must not look like a continuation of the last run
+        nibbles.append((nibbles[-1] ^ 0x4) & 0xC)
+    return bytes((nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2))
+
+
+def decode_runs(data, pixel_count):
+    nibbles = [n for b in data for n in (b >> 4, b & 0xF)]
+    pixels = []
+    i = 0
+    while len(pixels) < pixel_count:
+        value = nibbles[i] >> 2
+        length = 0
+        weight = 1
+        while i < len(nibbles) and nibbles[i] >> 2 == value:
+            length += ((nibbles[i] & 3) + 1) * weight
+            weight *= 4
+            i += 1
+        pixels += [value] * length
+    return pixels
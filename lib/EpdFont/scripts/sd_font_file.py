@@ -0,0 +1,89 @@
+"""
+Font files (.epf) that the firmware loads from the SD card instead of flash, see SdFont.h for the reader and
+docs/file-formats.md for the layout.
+
+The header and all tables except the glyph bitmaps are kept in memory on the device. They are stored in the in-memory
+layout of the ESP32-C3 (little endian, natural alignment, each table padded to 4 bytes), so they are read in one go
+and used in place. Bitmaps follow at a sector aligned offset and are read in pages of page_size bytes. No glyph
+crosses a page boundary, so every glyph is drawn from a single cached page.
+"""
+import struct
+
+MAGIC = b"EPDF"
+VERSION = 1
+FLAG_2BIT = 0x01
+FLAG_RLE_BITMAPS = 0x02
+
+# magic, version, flags, advanceY, kernRightClassCount, ascender, descender, intervalCount, glyphCount,
+# ligatureCount, kernLeftClassCount, pageSize, reserved, bitmapOffset, bitmapSize
+HEADER = struct.Struct("<4sBBBBhhHHHHHHII")
+INTERVAL = struct.Struct("<III")  # EpdUnicodeInterval
+GLYPH = struct.Struct("<BBBxhhHxxI")  # EpdGlyph
+LIGATURE = struct.Struct("<III")  # EpdLigaturePair
+
+SECTOR_SIZE = 512
+# Large enough for the hot glyphs of a script to share one or two pages, small enough that a miss is one short read
+DEFAULT_PAGE_SIZE = 2048
+
+
+def align(value, alignment):
+    return (value + alignment - 1) // alignment * alignment
+
+
+def pad(data, alignment=4):
+    return data + bytes(align(len(data), alignment) - len(data))
+
+
+def layout_pages(bitmaps, order, page_size=None):
+    """
+    Places the glyph bitmaps (in glyph array order) into pages, in the given glyph order so glyphs drawn together
+    share pages. Returns (page_size, offsets, data) with the offset of each glyph into data.
+    """
+    largest = max((len(b) for b in bitmaps), default=0)
+    page_size = max(page_size or DEFAULT_PAGE_SIZE, align(largest, SECTOR_SIZE))
+    offsets = [0] * len(bitmaps)
+    data = bytearray()
+    for index in order:
+        bitmap = bitmaps[index]
+        if bitmap and len(data) // page_size != (len(data) + len(bitmap) - 1) // page_size:
+            data += bytes(align(len(data), page_size) - len(data))
+        offsets[index] = len(data)
+        data += bitmap
+    return page_size, offsets, bytes(data)
+
+
+def write_sd_font(path, *, intervals, glyphs, bitmaps, is2Bit, rle, advance_y, ascender, descender, glyph_lookup,
+                  kern_left_classes=None, kern_right_classes=None, kern_matrix=None, kern_right_class_count=0,
+                  ligatures=(), order=None, page_size=None):
+    """
+    Writes a font file. intervals are (first, last, offset) tuples, glyphs (width, height, advanceX, left, top)
+    tuples and bitmaps the packed (or run-length encoded if rle) bitmap of each glyph. ligatures are (first, second,
+    ligature) code point tuples sorted by first, then second code point. order is the order in which the bitmaps are
+    laid out, code point order if not given. Returns the page count and size.
+    """
+    if order is None:
+        order = range(len(glyphs))
+    page_size, offsets, bitmap_data = layout_pages(bitmaps, order, page_size)
+
+    tables = pad(b"".join(INTERVAL.pack(*interval) for interval in intervals))
+    tables += pad(b"".join(GLYPH.pack(*glyph[:5], len(bitmaps[i]), offsets[i]) for i, glyph in enumerate(glyphs)))
+    tables += pad(struct.pack(f"<{len(glyph_lookup)}H", *glyph_lookup))
+    tables += pad(b"".join(LIGATURE.pack(*ligature) for ligature in ligatures))
+    kern_left_class_count = 0
+    if kern_matrix:
+        kern_left_class_count = len(kern_matrix) // kern_right_class_count
+        tables += pad(bytes(kern_left_classes))
+        tables += pad(bytes(kern_right_classes))
+        tables += pad(struct.pack(f"<{len(kern_matrix)}b", *kern_matrix))
+
+    bitmap_offset = align(HEADER.size + len(tables), SECTOR_SIZE)
+    flags = (FLAG_2BIT if is2Bit else 0) | (FLAG_RLE_BITMAPS if rle else 0)
+    header = HEADER.pack(MAGIC, VERSION, flags, advance_y, kern_right_class_count if kern_matrix else 0, ascender,
+                         descender, len(intervals), len(glyphs), len(ligatures), kern_left_class_count, page_size, 0,
+                         bitmap_offset, len(bitmap_data))
+    with open(path, "wb") as f:
+        f.write(header)
+        f.write(tables)
+        f.write(bytes(bitmap_offset - HEADER.size - len(tables)))
+        f.write(bitmap_data)
+    return (len(bitmap_data) + page_size - 1) // page_size, page_size
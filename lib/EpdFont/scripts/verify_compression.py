@@ -82,6 +82,11 @@ def verify_font_file(filepath):
     if not groups:
         return (font_name, False, "Groups array parsed to 0 entries; check format")
 
+    # The EpdFontData initializer lists the group count right after the Groups array
+    group_count_match = re.search(re.escape(font_name) + r'Groups,\s*(\d+),', content)
+    if not group_count_match or int(group_count_match.group(1)) != len(groups):
+        return (font_name, False, f"group count in font data does not match the {len(groups)} entries of the Groups array")
+
     # Extract glyphs
     glyphs_match = re.search(
         r'static const EpdGlyph ' + re.escape(font_name) + r'Glyphs\[\]\s*=\s*\{(.+?)\};',
@@ -92,6 +97,23 @@ def verify_font_file(filepath):
 
     glyphs = parse_glyphs(glyphs_match.group(1))
 
+    # Glyphs of a group are listed by the GlyphGroups array when present, older fonts have contiguous groups
+    glyph_groups_match = re.search(
+        r'static const uint8_t ' + re.escape(font_name) + r'GlyphGroups\[\d+\]\s*=\s*\{([^}]+)\}',
+        content, re.DOTALL
+    )
+    if glyph_groups_match:
+        glyph_groups = [int(v) for v in re.findall(r'\d+', glyph_groups_match.group(1))]
+        if len(glyph_groups) != len(glyphs):
+            return (font_name, False, f"GlyphGroups has {len(glyph_groups)} entries for {len(glyphs)} glyphs")
+        group_glyphs = [[] for _ in groups]
+        for glyph_idx, gi in enumerate(glyph_groups):
+            if gi >= len(groups):
+                return (font_name, False, f"glyph {glyph_idx}: group {gi} out of range")
+            group_glyphs[gi].append(glyph_idx)
+    else:
+        group_glyphs = [list(range(g['firstGlyphIndex'], g['firstGlyphIndex'] + g['glyphCount'])) for g in groups]
+
     # Verify each group
     for gi, group in enumerate(groups):
         # Extract compressed chunk
@@ -109,9 +131,9 @@ def verify_font_file(filepath):
             return (font_name, False, f"group {gi}: size mismatch (expected {group['uncompressedSize']}, got {len(decompressed)})")
 
         # Verify each glyph's data within the group
-        first = group['firstGlyphIndex']
-        for j in range(group['glyphCount']):
-            glyph_idx = first + j
+        if len(group_glyphs[gi]) != group['glyphCount']:
+            return (font_name, False, f"group {gi}: {len(group_glyphs[gi])} glyphs mapped, expected {group['glyphCount']}")
+        for glyph_idx in group_glyphs[gi]:
             if glyph_idx >= len(glyphs):
                 return (font_name, False, f"group {gi}: glyph index {glyph_idx} out of range")
 
@@ -5,6 +5,7 @@
 #include <JpegToBmpConverter.h>
 #include <Logging.h>
 #include <PngToBmpConverter.h>
+#include <ScaledBmpWriter.h>
 #include <ZipFile.h>
 
 #include "Epub/parsers/ContainerParser.h"
@@ -363,7 +364,7 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
 
   const uint32_t indexingStart = millis();
 
-  // Begin building cache - stream entries to disk immediately
+  // Begin building cache - spine is held in RAM, TOC entries stream straight into book.bin
   if (!bookMetadataCache->beginWrite()) {
     LOG_ERR("EBP", "Could not begin writing cache");
     return false;
@@ -380,11 +381,11 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
     LOG_ERR("EBP", "Could not parse content.opf");
     return false;
   }
-  if (!bookMetadataCache->endContentOpfPass()) {
+  if (!bookMetadataCache->endContentOpfPass(bookMetadata)) {
     LOG_ERR("EBP", "Could not end writing content.opf pass");
     return false;
   }
-  LOG_DBG("EBP", "OPF pass completed in %lu ms", millis() - opfStart);
+  const unsigned long opfTime = millis() - opfStart;
 
   // TOC Pass - try EPUB 3 nav first, fall back to NCX
   const uint32_t tocStart = millis();
@@ -416,27 +417,29 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
     LOG_ERR("EBP", "Could not end writing toc pass");
     return false;
   }
-  LOG_DBG("EBP", "TOC pass completed in %lu ms", millis() - tocStart);
+  const unsigned long tocTime = millis() - tocStart;
 
-  // Close the cache files
-  if (!bookMetadataCache->endWrite()) {
-    LOG_ERR("EBP", "Could not end writing cache");
+  // Finish book.bin with the spine entries and lookup table
+  const uint32_t buildStart = millis();
+  if (!bookMetadataCache->buildBookBin(filepath)) {
+    LOG_ERR("EBP", "Could not update mappings and sizes");
     return false;
   }
+  const unsigned long buildTime = millis() - buildStart;
 
-  // Build final book.bin
-  const uint32_t buildStart = millis();
-  if (!bookMetadataCache->buildBookBin(filepath, bookMetadata)) {
-    LOG_ERR("EBP", "Could not update mappings and sizes");
+  if (!bookMetadataCache->endWrite()) {
+    LOG_ERR("EBP", "Could not end writing cache");
     return false;
   }
-  LOG_DBG("EBP", "buildBookBin completed in %lu ms", millis() - buildStart);
-  LOG_DBG("EBP", "Total indexing completed in %lu ms", millis() - indexingStart);
 
   if (!bookMetadataCache->cleanupTmpFiles()) {
     LOG_DBG("EBP", "Could not cleanup tmp files - ignoring");
   }
 
+  LOG_INF("EBP", "Indexed %d spine, %d TOC entries in %lu ms (opf %lu ms, toc %lu ms, book.bin %lu ms)",
+          bookMetadataCache->getSpineCount(), bookMetadataCache->getTocCount(), millis() - indexingStart, opfTime,
+          tocTime, buildTime);
+
   // Reload the cache from disk so it's in the correct state
   bookMetadataCache.reset(new BookMetadataCache(cachePath));
   if (!bookMetadataCache->load()) {
@@ -453,6 +456,18 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
   return true;
 }
 
+bool Epub::loadMetadata(BookMetadataCache::BookMetadata& bookMetadata) {
+  BookMetadataCache cache(cachePath);
+  if (cache.load()) {
+    bookMetadata = cache.coreMetadata;
+    return true;
+  }
+
+  // Without a metadata cache to write to, the OPF parser skips the spine and writes nothing to the SD card
+  bookMetadataCache.reset();
+  return parseContentOpf(bookMetadata);
+}
+
 bool Epub::clearCache() const {
   if (!Storage.exists(cachePath.c_str())) {
     LOG_DBG("EPB", "Cache does not exist, no action needed");
@@ -512,191 +527,100 @@ std::string Epub::getCoverBmpPath(bool cropped) const {
   return cachePath + "/" + coverFileName + ".bmp";
 }
 
-bool Epub::generateCoverBmp(bool cropped) const {
-  // Already generated, return true
-  if (Storage.exists(getCoverBmpPath(cropped).c_str())) {
-    return true;
-  }
-
-  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
-    LOG_ERR("EBP", "Cannot generate cover BMP, cache not loaded");
-    return false;
-  }
-
-  const auto coverImageHref = bookMetadataCache->coreMetadata.coverItemHref;
-  if (coverImageHref.empty()) {
-    LOG_ERR("EBP", "No known cover image");
-    return false;
-  }
-
-  if (coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
-      coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg") {
-    LOG_DBG("EBP", "Generating BMP from JPG cover image (%s mode)", cropped ? "cropped" : "fit");
-    const auto coverJpgTempPath = getCachePath() + "/.cover.jpg";
-
-    FsFile coverJpg;
-    if (!Storage.openFileForWrite("EBP", coverJpgTempPath, coverJpg)) {
-      return false;
-    }
-    readItemContentsToStream(coverImageHref, coverJpg, 1024);
-    coverJpg.close();
-
-    if (!Storage.openFileForRead("EBP", coverJpgTempPath, coverJpg)) {
-      return false;
-    }
-
-    FsFile coverBmp;
-    if (!Storage.openFileForWrite("EBP", getCoverBmpPath(cropped), coverBmp)) {
-      coverJpg.close();
-      return false;
-    }
-    const bool success = JpegToBmpConverter::jpegFileToBmpStream(coverJpg, coverBmp, cropped);
-    coverJpg.close();
-    coverBmp.close();
-    Storage.remove(coverJpgTempPath.c_str());
-
-    if (!success) {
-      LOG_ERR("EBP", "Failed to generate BMP from cover image");
-      Storage.remove(getCoverBmpPath(cropped).c_str());
-    }
-    LOG_DBG("EBP", "Generated BMP from JPG cover image, success: %s", success ? "yes" : "no");
-    return success;
-  }
-
-  if (coverImageHref.substr(coverImageHref.length() - 4) == ".png") {
-    LOG_DBG("EBP", "Generating BMP from PNG cover image (%s mode)", cropped ? "cropped" : "fit");
-    const auto coverPngTempPath = getCachePath() + "/.cover.png";
-
-    FsFile coverPng;
-    if (!Storage.openFileForWrite("EBP", coverPngTempPath, coverPng)) {
-      return false;
-    }
-    readItemContentsToStream(coverImageHref, coverPng, 1024);
-    coverPng.close();
+bool Epub::generateCoverBmp(bool cropped) const { return generateCoverBmps({}, true, cropped); }
 
-    if (!Storage.openFileForRead("EBP", coverPngTempPath, coverPng)) {
-      return false;
-    }
+std::string Epub::getThumbBmpPath() const { return cachePath + "/thumb_[HEIGHT].bmp"; }
+std::string Epub::getThumbBmpPath(int height) const { return cachePath + "/thumb_" + std::to_string(height) + ".bmp"; }
 
-    FsFile coverBmp;
-    if (!Storage.openFileForWrite("EBP", getCoverBmpPath(cropped), coverBmp)) {
-      coverPng.close();
-      return false;
-    }
-    const bool success = PngToBmpConverter::pngFileToBmpStream(coverPng, coverBmp, cropped);
-    coverPng.close();
-    coverBmp.close();
-    Storage.remove(coverPngTempPath.c_str());
+bool Epub::generateThumbBmp(int height) const { return generateCoverBmps({height}, false); }
 
-    if (!success) {
-      LOG_ERR("EBP", "Failed to generate BMP from PNG cover image");
-      Storage.remove(getCoverBmpPath(cropped).c_str());
+bool Epub::generateCoverBmps(const std::vector<int>& thumbHeights, const bool cover, const bool cropped) const {
+  // Only what is not generated yet, the thumbnails and then the cover
+  std::vector<int> missingHeights;
+  for (const int height : thumbHeights) {
+    if (!Storage.exists(getThumbBmpPath(height).c_str())) {
+      missingHeights.push_back(height);
     }
-    LOG_DBG("EBP", "Generated BMP from PNG cover image, success: %s", success ? "yes" : "no");
-    return success;
   }
-
-  LOG_ERR("EBP", "Cover image is not a supported format, skipping");
-  return false;
-}
-
-std::string Epub::getThumbBmpPath() const { return cachePath + "/thumb_[HEIGHT].bmp"; }
-std::string Epub::getThumbBmpPath(int height) const { return cachePath + "/thumb_" + std::to_string(height) + ".bmp"; }
-
-bool Epub::generateThumbBmp(int height) const {
-  // Already generated, return true
-  if (Storage.exists(getThumbBmpPath(height).c_str())) {
+  const bool missingCover = cover && !Storage.exists(getCoverBmpPath(cropped).c_str());
+  if (missingHeights.empty() && !missingCover) {
     return true;
   }
 
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
-    LOG_ERR("EBP", "Cannot generate thumb BMP, cache not loaded");
+    LOG_ERR("EBP", "Cannot generate cover BMPs, cache not loaded");
     return false;
   }
 
   const auto coverImageHref = bookMetadataCache->coreMetadata.coverItemHref;
-  if (coverImageHref.empty()) {
-    LOG_DBG("EBP", "No known cover image for thumbnail");
-  } else if (coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
-             coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg") {
-    LOG_DBG("EBP", "Generating thumb BMP from JPG cover image");
-    const auto coverJpgTempPath = getCachePath() + "/.cover.jpg";
-
-    FsFile coverJpg;
-    if (!Storage.openFileForWrite("EBP", coverJpgTempPath, coverJpg)) {
-      return false;
+  const auto hasExtension = [&coverImageHref](const std::string& extension) {
+    return coverImageHref.length() >= extension.length() &&
+           coverImageHref.compare(coverImageHref.length() - extension.length(), extension.length(), extension) == 0;
+  };
+  const bool isJpeg = hasExtension(".jpg") || hasExtension(".jpeg");
+  const bool isPng = hasExtension(".png");
+  if (!isJpeg && !isPng) {
+    if (coverImageHref.empty()) {
+      LOG_DBG("EBP", "No known cover image");
+    } else {
+      LOG_ERR("EBP", "Cover image is not a supported format, skipping");
     }
-    readItemContentsToStream(coverImageHref, coverJpg, 1024);
-    coverJpg.close();
-
-    if (!Storage.openFileForRead("EBP", coverJpgTempPath, coverJpg)) {
-      return false;
-    }
-
-    FsFile thumbBmp;
-    if (!Storage.openFileForWrite("EBP", getThumbBmpPath(height), thumbBmp)) {
-      coverJpg.close();
-      return false;
-    }
-    // Use smaller target size for Continue Reading card (half of screen: 240x400)
-    // Generate 1-bit BMP for fast home screen rendering (no gray passes needed)
-    int THUMB_TARGET_WIDTH = height * 0.6;
-    int THUMB_TARGET_HEIGHT = height;
-    const bool success = JpegToBmpConverter::jpegFileTo1BitBmpStreamWithSize(coverJpg, thumbBmp, THUMB_TARGET_WIDTH,
-                                                                             THUMB_TARGET_HEIGHT);
-    coverJpg.close();
-    thumbBmp.close();
-    Storage.remove(coverJpgTempPath.c_str());
-
-    if (!success) {
-      LOG_ERR("EBP", "Failed to generate thumb BMP from JPG cover image");
-      Storage.remove(getThumbBmpPath(height).c_str());
-    }
-    LOG_DBG("EBP", "Generated thumb BMP from JPG cover image, success: %s", success ? "yes" : "no");
-    return success;
-  } else if (coverImageHref.substr(coverImageHref.length() - 4) == ".png") {
-    LOG_DBG("EBP", "Generating thumb BMP from PNG cover image");
-    const auto coverPngTempPath = getCachePath() + "/.cover.png";
-
-    FsFile coverPng;
-    if (!Storage.openFileForWrite("EBP", coverPngTempPath, coverPng)) {
-      return false;
+    // Write empty thumbnails to avoid generation attempts in the future
+    for (const int height : missingHeights) {
+      FsFile thumbBmp;
+      Storage.openFileForWrite("EBP", getThumbBmpPath(height), thumbBmp);
+      thumbBmp.close();
     }
-    readItemContentsToStream(coverImageHref, coverPng, 1024);
-    coverPng.close();
+    return false;
+  }
 
-    if (!Storage.openFileForRead("EBP", coverPngTempPath, coverPng)) {
-      return false;
-    }
+  LOG_DBG("EBP", "Generating %d thumb(s)%s from %s cover image", static_cast<int>(missingHeights.size()),
+          missingCover ? (cropped ? " and cropped cover" : " and cover") : "", isJpeg ? "JPG" : "PNG");
+  const auto coverTempPath = getCachePath() + (isJpeg ? "/.cover.jpg" : "/.cover.png");
+  FsFile coverImage;
+  if (!Storage.openFileForWrite("EBP", coverTempPath, coverImage)) {
+    return false;
+  }
+  readItemContentsToStream(coverImageHref, coverImage, 1024);
+  coverImage.close();
+  if (!Storage.openFileForRead("EBP", coverTempPath, coverImage)) {
+    return false;
+  }
 
-    FsFile thumbBmp;
-    if (!Storage.openFileForWrite("EBP", getThumbBmpPath(height), thumbBmp)) {
-      coverPng.close();
-      return false;
-    }
-    int THUMB_TARGET_WIDTH = height * 0.6;
-    int THUMB_TARGET_HEIGHT = height;
-    const bool success =
-        PngToBmpConverter::pngFileTo1BitBmpStreamWithSize(coverPng, thumbBmp, THUMB_TARGET_WIDTH, THUMB_TARGET_HEIGHT);
-    coverPng.close();
-    thumbBmp.close();
-    Storage.remove(coverPngTempPath.c_str());
+  // The cover is decoded once for all BMPs, each is scaled and dithered on its own
+  std::vector<std::string> bmpPaths;
+  for (const int height : missingHeights) {
+    bmpPaths.push_back(getThumbBmpPath(height));
+  }
+  if (missingCover) {
+    bmpPaths.push_back(getCoverBmpPath(cropped));
+  }
+  std::vector<FsFile> bmpFiles(bmpPaths.size());
+  std::vector<BmpTarget> targets;
+  bool success = true;
+  for (size_t i = 0; i < bmpPaths.size() && success; i++) {
+    success = Storage.openFileForWrite("EBP", bmpPaths[i], bmpFiles[i]);
+    targets.push_back(i < missingHeights.size() ? BmpTarget::thumbnail(bmpFiles[i], missingHeights[i])
+                                                : BmpTarget::cover(bmpFiles[i], cropped));
+  }
+  if (success) {
+    success = isJpeg ? JpegToBmpConverter::jpegFileToBmpStreams(coverImage, targets.data(), targets.size())
+                     : PngToBmpConverter::pngFileToBmpStreams(coverImage, targets.data(), targets.size());
+  }
+  coverImage.close();
+  Storage.remove(coverTempPath.c_str());
 
+  for (size_t i = 0; i < bmpPaths.size(); i++) {
+    bmpFiles[i].close();
     if (!success) {
-      LOG_ERR("EBP", "Failed to generate thumb BMP from PNG cover image");
-      Storage.remove(getThumbBmpPath(height).c_str());
+      Storage.remove(bmpPaths[i].c_str());
     }
-    LOG_DBG("EBP", "Generated thumb BMP from PNG cover image, success: %s", success ? "yes" : "no");
-    return success;
-  } else {
-    LOG_ERR("EBP", "Cover image is not a supported format, skipping thumbnail");
   }
-
-  // Write an empty bmp file to avoid generation attempts in the future
-  FsFile thumbBmp;
-  Storage.openFileForWrite("EBP", getThumbBmpPath(height), thumbBmp);
-  thumbBmp.close();
-  return false;
+  if (!success) {
+    LOG_ERR("EBP", "Failed to generate BMPs from cover image");
+  }
+  LOG_DBG("EBP", "Generated BMPs from cover image, success: %s", success ? "yes" : "no");
+  return success;
 }
 
 uint8_t* Epub::readItemContentsToBytes(const std::string& itemHref, size_t* size, const bool trailingNullByte) const {
@@ -738,7 +662,19 @@ int Epub::getSpineItemsCount() const {
   return bookMetadataCache->getSpineCount();
 }
 
-size_t Epub::getCumulativeSpineItemSize(const int spineIndex) const { return getSpineItem(spineIndex).cumulativeSize; }
+size_t Epub::getCumulativeSpineItemSize(const int spineIndex) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    LOG_ERR("EBP", "getCumulativeSpineItemSize called but cache not loaded");
+    return 0;
+  }
+
+  if (spineIndex < 0 || spineIndex >= bookMetadataCache->getSpineCount()) {
+    LOG_ERR("EBP", "getCumulativeSpineItemSize index:%d is out of range", spineIndex);
+    return bookMetadataCache->getCumulativeSize(0);
+  }
+
+  return bookMetadataCache->getCumulativeSize(spineIndex);
+}
 
 BookMetadataCache::SpineEntry Epub::getSpineItem(const int spineIndex) const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
@@ -768,6 +704,27 @@ BookMetadataCache::TocEntry Epub::getTocItem(const int tocIndex) const {
   return bookMetadataCache->getTocEntry(tocIndex);
 }
 
+std::string Epub::getTocTitle(const int tocIndex) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    LOG_DBG("EBP", "getTocTitle called but cache not loaded");
+    return {};
+  }
+
+  if (tocIndex < 0 || tocIndex >= bookMetadataCache->getTocCount()) {
+    LOG_DBG("EBP", "getTocTitle index:%d is out of range", tocIndex);
+    return {};
+  }
+
+  return bookMetadataCache->getTocTitle(tocIndex);
+}
+
+uint8_t Epub::getTocLevel(const int tocIndex) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    return 0;
+  }
+  return bookMetadataCache->getTocLevel(tocIndex);
+}
+
 int Epub::getTocItemsCount() const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
     return 0;
@@ -788,7 +745,7 @@ int Epub::getSpineIndexForTocIndex(const int tocIndex) const {
     return 0;
   }
 
-  const int spineIndex = bookMetadataCache->getTocEntry(tocIndex).spineIndex;
+  const int spineIndex = bookMetadataCache->getSpineIndexForToc(tocIndex);
   if (spineIndex < 0) {
     LOG_DBG("EBP", "Section not found for TOC index %d", tocIndex);
     return 0;
@@ -797,7 +754,19 @@ int Epub::getSpineIndexForTocIndex(const int tocIndex) const {
   return spineIndex;
 }
 
-int Epub::getTocIndexForSpineIndex(const int spineIndex) const { return getSpineItem(spineIndex).tocIndex; }
+int Epub::getTocIndexForSpineIndex(const int spineIndex) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    LOG_ERR("EBP", "getTocIndexForSpineIndex called but cache not loaded");
+    return -1;
+  }
+
+  if (spineIndex < 0 || spineIndex >= bookMetadataCache->getSpineCount()) {
+    LOG_ERR("EBP", "getTocIndexForSpineIndex index:%d is out of range", spineIndex);
+    return bookMetadataCache->getTocIndexForSpine(0);
+  }
+
+  return bookMetadataCache->getTocIndexForSpine(spineIndex);
+}
 
 size_t Epub::getBookSize() const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded() || bookMetadataCache->getSpineCount() == 0) {
@@ -44,6 +44,9 @@ class Epub {
   ~Epub() = default;
   std::string& getBasePath() { return contentBasePath; }
   bool load(bool buildIfMissing = true, bool skipLoadingCss = false);
+  // Reads title, author, language and cover href from the metadata cache if there is one, otherwise from content.opf
+  // without building the cache
+  bool loadMetadata(BookMetadataCache::BookMetadata& bookMetadata);
   bool clearCache() const;
   void setupCacheDir() const;
   const std::string& getCachePath() const;
@@ -56,12 +59,16 @@ class Epub {
   std::string getThumbBmpPath() const;
   std::string getThumbBmpPath(int height) const;
   bool generateThumbBmp(int height) const;
+  // Writes the missing thumbnails and, with `cover`, the missing cover BMP from a single decode of the cover image
+  bool generateCoverBmps(const std::vector<int>& thumbHeights, bool cover, bool cropped = false) const;
   uint8_t* readItemContentsToBytes(const std::string& itemHref, size_t* size = nullptr,
                                    bool trailingNullByte = false) const;
   bool readItemContentsToStream(const std::string& itemHref, Print& out, size_t chunkSize) const;
   bool getItemSize(const std::string& itemHref, size_t* size) const;
   BookMetadataCache::SpineEntry getSpineItem(int spineIndex) const;
   BookMetadataCache::TocEntry getTocItem(int tocIndex) const;
+  std::string getTocTitle(int tocIndex) const;
+  uint8_t getTocLevel(int tocIndex) const;
   int getSpineItemsCount() const;
   int getTocItemsCount() const;
   int getSpineIndexForTocIndex(int tocIndex) const;
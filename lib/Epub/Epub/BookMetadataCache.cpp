@@ -4,164 +4,184 @@
 #include <Serialization.h>
 #include <ZipFile.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "FsHelpers.h"
 
 namespace {
-constexpr uint8_t BOOK_CACHE_VERSION = 5;
+constexpr uint8_t BOOK_CACHE_VERSION = 7;
 constexpr char bookBinFile[] = "/book.bin";
-constexpr char tmpSpineBinFile[] = "/spine.bin.tmp";
-constexpr char tmpTocBinFile[] = "/toc.bin.tmp";
+constexpr char tmpSpineHrefsFile[] = "/spine.bin.tmp";
+
+constexpr uint32_t noTitleLoaded = UINT32_MAX;
+
+bool spineHrefIndexLess(const uint64_t hashA, const uint16_t lenA, const uint64_t hashB, const uint16_t lenB) {
+  return hashA < hashB || (hashA == hashB && lenA < lenB);
+}
 }  // namespace
 
 /* ============= WRITING / BUILDING FUNCTIONS ================ */
 
+// book.bin layout: header, metadata, TOC entries, spine entries, LUT (spine offsets then TOC offsets), followed by
+// the resident tables (spine cumulative sizes and TOC indices, TOC spine indices and levels) that load() reads in bulk.
+// The header is written with version 0 up front and only patched with the real version and LUT offset once
+// everything else is on disk, so an interrupted build is never mistaken for a valid cache.
+
 bool BookMetadataCache::beginWrite() {
   buildMode = true;
   spineCount = 0;
   tocCount = 0;
+  releaseBuildState();
+  spineCumulativeSizes.clear();
+  spineTocIndices.clear();
+  tocSpineIndices.clear();
+  tocLevels.clear();
+  spineHrefOffsets.push_back(0);
   LOG_DBG("BMC", "Entering write mode");
   return true;
 }
 
 bool BookMetadataCache::beginContentOpfPass() {
   LOG_DBG("BMC", "Beginning content opf pass");
-
-  // Open spine file for writing
-  return Storage.openFileForWrite("BMC", cachePath + tmpSpineBinFile, spineFile);
+  return buildMode;
 }
 
-bool BookMetadataCache::endContentOpfPass() {
-  spineFile.close();
-  return true;
-}
+void BookMetadataCache::createSpineEntry(const std::string& href) {
+  if (!buildMode || bookFile) {
+    LOG_DBG("BMC", "createSpineEntry called but not in content opf pass");
+    return;
+  }
 
-bool BookMetadataCache::beginTocPass() {
-  LOG_DBG("BMC", "Beginning toc pass");
+  if (spineSpillFailed) {
+    return;
+  }
 
-  if (!Storage.openFileForRead("BMC", cachePath + tmpSpineBinFile, spineFile)) {
-    return false;
+  if (!spineHrefsSpilled && spineHrefPool.size() + href.size() > MAX_IN_MEMORY_SPINE_HREF_BYTES) {
+    if (!Storage.openFileForWrite("BMC", cachePath + tmpSpineHrefsFile, spineSpillFile)) {
+      LOG_ERR("BMC", "Could not move spine hrefs to SD, dropping the rest of the spine");
+      spineSpillFailed = true;
+      return;
+    }
+    spineSpillFile.write(reinterpret_cast<const uint8_t*>(spineHrefPool.data()), spineHrefPool.size());
+    spineHrefPool.clear();
+    spineHrefPool.shrink_to_fit();
+    spineHrefsSpilled = true;
+    LOG_DBG("BMC", "Spine hrefs exceed %zu bytes, moved to SD", MAX_IN_MEMORY_SPINE_HREF_BYTES);
+  }
+
+  if (spineHrefsSpilled) {
+    spineSpillFile.write(reinterpret_cast<const uint8_t*>(href.data()), href.size());
+  } else {
+    spineHrefPool.append(href);
   }
-  if (!Storage.openFileForWrite("BMC", cachePath + tmpTocBinFile, tocFile)) {
-    spineFile.close();
+  spineHrefOffsets.push_back(spineHrefOffsets.back() + static_cast<uint32_t>(href.size()));
+  spineCount++;
+}
+
+bool BookMetadataCache::endContentOpfPass(const BookMetadata& metadata) {
+  // Spine entries were dropped, so no book.bin is written and the next load builds it again
+  if (spineSpillFailed) {
     return false;
   }
 
-  if (spineCount >= LARGE_SPINE_THRESHOLD) {
-    spineHrefIndex.clear();
-    spineHrefIndex.reserve(spineCount);
-    spineFile.seek(0);
-    for (int i = 0; i < spineCount; i++) {
-      auto entry = readSpineEntry(spineFile);
-      SpineHrefIndexEntry idx;
-      idx.hrefHash = fnvHash64(entry.href);
-      idx.hrefLen = static_cast<uint16_t>(entry.href.size());
-      idx.spineIndex = static_cast<int16_t>(i);
-      spineHrefIndex.push_back(idx);
+  if (spineHrefsSpilled) {
+    spineSpillFile.close();
+    if (!Storage.openFileForRead("BMC", cachePath + tmpSpineHrefsFile, spineSpillFile)) {
+      return false;
     }
-    std::sort(spineHrefIndex.begin(), spineHrefIndex.end(),
-              [](const SpineHrefIndexEntry& a, const SpineHrefIndexEntry& b) {
-                return a.hrefHash < b.hrefHash || (a.hrefHash == b.hrefHash && a.hrefLen < b.hrefLen);
-              });
-    spineFile.seek(0);
-    useSpineHrefIndex = true;
-    LOG_DBG("BMC", "Using fast index for %d spine items", spineCount);
-  } else {
-    useSpineHrefIndex = false;
   }
 
-  return true;
-}
-
-bool BookMetadataCache::endTocPass() {
-  tocFile.close();
-  spineFile.close();
+  if (!Storage.openFileForWrite("BMC", cachePath + bookBinFile, bookFile)) {
+    return false;
+  }
 
-  spineHrefIndex.clear();
-  spineHrefIndex.shrink_to_fit();
-  useSpineHrefIndex = false;
+  // Placeholder header, finalised in buildBookBin
+  constexpr uint8_t incompleteVersion = 0;
+  constexpr uint32_t unknownLutOffset = 0;
+  serialization::writePod(bookFile, incompleteVersion);
+  serialization::writePod(bookFile, unknownLutOffset);
+  serialization::writePod(bookFile, spineCount);
+  serialization::writePod(bookFile, tocCount);
 
+  serialization::writeString(bookFile, metadata.title);
+  serialization::writeString(bookFile, metadata.author);
+  serialization::writeString(bookFile, metadata.language);
+  serialization::writeString(bookFile, metadata.coverItemHref);
+  serialization::writeString(bookFile, metadata.textReferenceHref);
   return true;
 }
 
-bool BookMetadataCache::endWrite() {
-  if (!buildMode) {
-    LOG_DBG("BMC", "endWrite called but not in build mode");
+bool BookMetadataCache::beginTocPass() {
+  LOG_DBG("BMC", "Beginning toc pass");
+
+  if (!bookFile) {
+    LOG_ERR("BMC", "beginTocPass called before book.bin was opened");
     return false;
   }
 
-  buildMode = false;
-  LOG_DBG("BMC", "Wrote %d spine, %d TOC entries", spineCount, tocCount);
+  spineTocIndices.assign(spineCount, -1);
+
+  spineHrefIndex.clear();
+  spineHrefIndex.reserve(spineCount);
+  for (int i = 0; i < spineCount; i++) {
+    const auto href = getBuildSpineHref(i);
+    spineHrefIndex.push_back({fnvHash64(href), static_cast<uint16_t>(href.size()), static_cast<int16_t>(i)});
+  }
+  std::sort(spineHrefIndex.begin(), spineHrefIndex.end(),
+            [](const SpineHrefIndexEntry& a, const SpineHrefIndexEntry& b) {
+              return spineHrefIndexLess(a.hrefHash, a.hrefLen, b.hrefHash, b.hrefLen);
+            });
   return true;
 }
 
-bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMetadata& metadata) {
-  // Open all three files, writing to meta, reading from spine and toc
-  if (!Storage.openFileForWrite("BMC", cachePath + bookBinFile, bookFile)) {
-    return false;
+void BookMetadataCache::createTocEntry(const std::string& title, const std::string& href, const std::string& anchor,
+                                       const uint8_t level) {
+  if (!buildMode || !bookFile) {
+    LOG_DBG("BMC", "createTocEntry called but not in build mode");
+    return;
   }
 
-  if (!Storage.openFileForRead("BMC", cachePath + tmpSpineBinFile, spineFile)) {
-    bookFile.close();
-    return false;
+  int16_t spineIndex = -1;
+
+  const uint64_t targetHash = fnvHash64(href);
+  const auto targetLen = static_cast<uint16_t>(href.size());
+  const SpineHrefIndexEntry target{targetHash, targetLen, 0};
+  auto it = std::lower_bound(spineHrefIndex.begin(), spineHrefIndex.end(), target,
+                             [](const SpineHrefIndexEntry& a, const SpineHrefIndexEntry& b) {
+                               return spineHrefIndexLess(a.hrefHash, a.hrefLen, b.hrefHash, b.hrefLen);
+                             });
+  // Confirm against the stored href in case of a hash collision
+  for (; it != spineHrefIndex.end() && it->hrefHash == targetHash && it->hrefLen == targetLen; ++it) {
+    if (getBuildSpineHref(it->spineIndex) == href) {
+      spineIndex = it->spineIndex;
+      break;
+    }
   }
 
-  if (!Storage.openFileForRead("BMC", cachePath + tmpTocBinFile, tocFile)) {
-    bookFile.close();
-    spineFile.close();
-    return false;
+  if (spineIndex == -1) {
+    LOG_DBG("BMC", "createTocEntry: Could not find spine item for TOC href %s", href.c_str());
+  } else if (spineTocIndices[spineIndex] == -1) {
+    spineTocIndices[spineIndex] = static_cast<int16_t>(tocCount);
   }
 
-  constexpr uint32_t headerASize =
-      sizeof(BOOK_CACHE_VERSION) + /* LUT Offset */ sizeof(uint32_t) + sizeof(spineCount) + sizeof(tocCount);
-  const uint32_t metadataSize = metadata.title.size() + metadata.author.size() + metadata.language.size() +
-                                metadata.coverItemHref.size() + metadata.textReferenceHref.size() +
-                                sizeof(uint32_t) * 5;
-  const uint32_t lutSize = sizeof(uint32_t) * spineCount + sizeof(uint32_t) * tocCount;
-  const uint32_t lutOffset = headerASize + metadataSize;
+  const TocEntry entry(title, href, anchor, level, spineIndex);
+  tocEntryOffsets.push_back(writeTocEntry(bookFile, entry));
+  tocSpineIndices.push_back(spineIndex);
+  tocLevels.push_back(level);
+  tocCount++;
+}
 
-  // Header A
-  serialization::writePod(bookFile, BOOK_CACHE_VERSION);
-  serialization::writePod(bookFile, lutOffset);
-  serialization::writePod(bookFile, spineCount);
-  serialization::writePod(bookFile, tocCount);
-  // Metadata
-  serialization::writeString(bookFile, metadata.title);
-  serialization::writeString(bookFile, metadata.author);
-  serialization::writeString(bookFile, metadata.language);
-  serialization::writeString(bookFile, metadata.coverItemHref);
-  serialization::writeString(bookFile, metadata.textReferenceHref);
+bool BookMetadataCache::endTocPass() {
+  spineHrefIndex.clear();
+  spineHrefIndex.shrink_to_fit();
+  return true;
+}
 
-  // Loop through spine entries, writing LUT positions
-  spineFile.seek(0);
-  for (int i = 0; i < spineCount; i++) {
-    uint32_t pos = spineFile.position();
-    auto spineEntry = readSpineEntry(spineFile);
-    serialization::writePod(bookFile, pos + lutOffset + lutSize);
-  }
-
-  // Loop through toc entries, writing LUT positions
-  tocFile.seek(0);
-  for (int i = 0; i < tocCount; i++) {
-    uint32_t pos = tocFile.position();
-    auto tocEntry = readTocEntry(tocFile);
-    serialization::writePod(bookFile, pos + lutOffset + lutSize + static_cast<uint32_t>(spineFile.position()));
-  }
-
-  // LUTs complete
-  // Loop through spines from spine file matching up TOC indexes, calculating cumulative size and writing to book.bin
-
-  // Build spineIndex->tocIndex mapping in one pass (O(n) instead of O(n*m))
-  std::vector<int16_t> spineToTocIndex(spineCount, -1);
-  tocFile.seek(0);
-  for (int j = 0; j < tocCount; j++) {
-    auto tocEntry = readTocEntry(tocFile);
-    if (tocEntry.spineIndex >= 0 && tocEntry.spineIndex < spineCount) {
-      if (spineToTocIndex[tocEntry.spineIndex] == -1) {
-        spineToTocIndex[tocEntry.spineIndex] = static_cast<int16_t>(j);
-      }
-    }
+bool BookMetadataCache::buildBookBin(const std::string& epubPath) {
+  if (!buildMode || !bookFile) {
+    LOG_ERR("BMC", "buildBookBin called but book.bin is not open");
+    return false;
   }
 
   ZipFile zip(epubPath);
@@ -169,31 +189,25 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
   if (!zip.open()) {
     LOG_ERR("BMC", "Could not open EPUB zip for size calculations");
     bookFile.close();
-    spineFile.close();
-    tocFile.close();
     return false;
   }
   // NOTE: We intentionally skip calling loadAllFileStatSlims() here.
   // For large EPUBs (2000+ chapters), pre-loading all ZIP central directory entries
   // into memory causes OOM crashes on ESP32-C3's limited ~380KB RAM.
-  // Instead, for large books we use a one-pass batch lookup that scans the ZIP
-  // central directory once and matches against spine targets using hash comparison.
+  // Instead we use a one-pass batch lookup that scans the ZIP central directory once
+  // and matches against spine targets using hash comparison, for books of any size.
   // This is O(n*log(m)) instead of O(n*m) while avoiding memory exhaustion.
   // See: https://github.com/crosspoint-reader/crosspoint-reader/issues/134
 
-  std::vector<uint32_t> spineSizes;
-  bool useBatchSizes = false;
-
-  if (spineCount >= LARGE_SPINE_THRESHOLD) {
-    LOG_DBG("BMC", "Using batch size lookup for %d spine items", spineCount);
-
+  const uint32_t sizesStart = millis();
+  std::vector<uint32_t> spineSizes(spineCount, 0);
+  {
+    // Scoped so the targets are freed before the spine entries are written
     std::vector<ZipFile::SizeTarget> targets;
     targets.reserve(spineCount);
 
-    spineFile.seek(0);
     for (int i = 0; i < spineCount; i++) {
-      auto entry = readSpineEntry(spineFile);
-      std::string path = FsHelpers::normalisePath(entry.href);
+      std::string path = FsHelpers::normalisePath(getBuildSpineHref(i));
 
       ZipFile::SizeTarget t;
       t.hash = ZipFile::fnvHash64(path.c_str(), path.size());
@@ -206,23 +220,18 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
       return a.hash < b.hash || (a.hash == b.hash && a.len < b.len);
     });
 
-    spineSizes.resize(spineCount, 0);
-    int matched = zip.fillUncompressedSizes(targets, spineSizes);
+    [[maybe_unused]] const int matched = zip.fillUncompressedSizes(targets, spineSizes);
     LOG_DBG("BMC", "Batch lookup matched %d/%d spine items", matched, spineCount);
-
-    targets.clear();
-    targets.shrink_to_fit();
-
-    useBatchSizes = true;
   }
 
+  // Spine entries follow the TOC entries already streamed into book.bin
+  std::vector<uint32_t> spineEntryOffsets;
+  spineEntryOffsets.reserve(spineCount);
+  spineCumulativeSizes.reserve(spineCount);
   uint32_t cumSize = 0;
-  spineFile.seek(0);
   int lastSpineTocIndex = -1;
   for (int i = 0; i < spineCount; i++) {
-    auto spineEntry = readSpineEntry(spineFile);
-
-    spineEntry.tocIndex = spineToTocIndex[i];
+    SpineEntry spineEntry(getBuildSpineHref(i), 0, spineTocIndices[i]);
 
     // Not a huge deal if we don't fine a TOC entry for the spine entry, this is expected behaviour for EPUBs
     // Logging here is for debugging
@@ -232,17 +241,11 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
       spineEntry.tocIndex = lastSpineTocIndex;
     }
     lastSpineTocIndex = spineEntry.tocIndex;
+    spineTocIndices[i] = spineEntry.tocIndex;
 
-    size_t itemSize = 0;
-    if (useBatchSizes) {
-      itemSize = spineSizes[i];
-      if (itemSize == 0) {
-        const std::string path = FsHelpers::normalisePath(spineEntry.href);
-        if (!zip.getInflatedFileSize(path.c_str(), &itemSize)) {
-          LOG_ERR("BMC", "Warning: Could not get size for spine item: %s", path.c_str());
-        }
-      }
-    } else {
+    // Falls back to a lookup of its own for an item the batch didn't match
+    size_t itemSize = spineSizes[i];
+    if (itemSize == 0) {
       const std::string path = FsHelpers::normalisePath(spineEntry.href);
       if (!zip.getInflatedFileSize(path.c_str(), &itemSize)) {
         LOG_ERR("BMC", "Warning: Could not get size for spine item: %s", path.c_str());
@@ -251,38 +254,92 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
 
     cumSize += itemSize;
     spineEntry.cumulativeSize = cumSize;
+    spineCumulativeSizes.push_back(cumSize);
 
-    // Write out spine data to book.bin
-    writeSpineEntry(bookFile, spineEntry);
+    spineEntryOffsets.push_back(writeSpineEntry(bookFile, spineEntry));
   }
   // Close opened zip file
   zip.close();
+  LOG_DBG("BMC", "Spine sizes and entries written in %lu ms", millis() - sizesStart);
 
-  // Loop through toc entries from toc file writing to book.bin
-  tocFile.seek(0);
-  for (int i = 0; i < tocCount; i++) {
-    auto tocEntry = readTocEntry(tocFile);
-    writeTocEntry(bookFile, tocEntry);
+  // LUT: spine entry positions followed by TOC entry positions
+  const auto lutOffset = static_cast<uint32_t>(bookFile.position());
+  for (const uint32_t pos : spineEntryOffsets) {
+    serialization::writePod(bookFile, pos);
+  }
+  for (const uint32_t pos : tocEntryOffsets) {
+    serialization::writePod(bookFile, pos);
   }
 
+  // Resident tables
+  bookFile.write(reinterpret_cast<const uint8_t*>(spineCumulativeSizes.data()), sizeof(uint32_t) * spineCount);
+  bookFile.write(reinterpret_cast<const uint8_t*>(spineTocIndices.data()), sizeof(int16_t) * spineCount);
+  bookFile.write(reinterpret_cast<const uint8_t*>(tocSpineIndices.data()), sizeof(int16_t) * tocCount);
+  bookFile.write(reinterpret_cast<const uint8_t*>(tocLevels.data()), sizeof(uint8_t) * tocCount);
+
+  // Finalise the header now that everything it points at is on disk
+  bookFile.seek(0);
+  serialization::writePod(bookFile, BOOK_CACHE_VERSION);
+  serialization::writePod(bookFile, lutOffset);
+  serialization::writePod(bookFile, spineCount);
+  serialization::writePod(bookFile, tocCount);
   bookFile.close();
-  spineFile.close();
-  tocFile.close();
 
   LOG_DBG("BMC", "Successfully built book.bin");
   return true;
 }
 
-bool BookMetadataCache::cleanupTmpFiles() const {
-  if (Storage.exists((cachePath + tmpSpineBinFile).c_str())) {
-    Storage.remove((cachePath + tmpSpineBinFile).c_str());
+bool BookMetadataCache::endWrite() {
+  if (!buildMode) {
+    LOG_DBG("BMC", "endWrite called but not in build mode");
+    return false;
   }
-  if (Storage.exists((cachePath + tmpTocBinFile).c_str())) {
-    Storage.remove((cachePath + tmpTocBinFile).c_str());
+
+  buildMode = false;
+  if (bookFile) {
+    bookFile.close();
   }
+  releaseBuildState();
+  LOG_DBG("BMC", "Wrote %d spine, %d TOC entries", spineCount, tocCount);
   return true;
 }
 
+bool BookMetadataCache::cleanupTmpFiles() const {
+  if (Storage.exists((cachePath + tmpSpineHrefsFile).c_str())) {
+    Storage.remove((cachePath + tmpSpineHrefsFile).c_str());
+  }
+  return true;
+}
+
+std::string BookMetadataCache::getBuildSpineHref(const int index) {
+  const uint32_t start = spineHrefOffsets[index];
+  const uint32_t len = spineHrefOffsets[index + 1] - start;
+  if (!spineHrefsSpilled) {
+    return spineHrefPool.substr(start, len);
+  }
+
+  std::string href(len, '\0');
+  spineSpillFile.seek(start);
+  spineSpillFile.read(&href[0], len);
+  return href;
+}
+
+void BookMetadataCache::releaseBuildState() {
+  if (spineSpillFile) {
+    spineSpillFile.close();
+  }
+  spineHrefsSpilled = false;
+  spineSpillFailed = false;
+  spineHrefPool.clear();
+  spineHrefPool.shrink_to_fit();
+  spineHrefOffsets.clear();
+  spineHrefOffsets.shrink_to_fit();
+  tocEntryOffsets.clear();
+  tocEntryOffsets.shrink_to_fit();
+  spineHrefIndex.clear();
+  spineHrefIndex.shrink_to_fit();
+}
+
 uint32_t BookMetadataCache::writeSpineEntry(FsFile& file, const SpineEntry& entry) const {
   const uint32_t pos = file.position();
   serialization::writeString(file, entry.href);
@@ -301,65 +358,6 @@ uint32_t BookMetadataCache::writeTocEntry(FsFile& file, const TocEntry& entry) c
   return pos;
 }
 
-// Note: for the LUT to be accurate, this **MUST** be called for all spine items before `addTocEntry` is ever called
-// this is because in this function we're marking positions of the items
-void BookMetadataCache::createSpineEntry(const std::string& href) {
-  if (!buildMode || !spineFile) {
-    LOG_DBG("BMC", "createSpineEntry called but not in build mode");
-    return;
-  }
-
-  const SpineEntry entry(href, 0, -1);
-  writeSpineEntry(spineFile, entry);
-  spineCount++;
-}
-
-void BookMetadataCache::createTocEntry(const std::string& title, const std::string& href, const std::string& anchor,
-                                       const uint8_t level) {
-  if (!buildMode || !tocFile || !spineFile) {
-    LOG_DBG("BMC", "createTocEntry called but not in build mode");
-    return;
-  }
-
-  int16_t spineIndex = -1;
-
-  if (useSpineHrefIndex) {
-    uint64_t targetHash = fnvHash64(href);
-    uint16_t targetLen = static_cast<uint16_t>(href.size());
-
-    auto it =
-        std::lower_bound(spineHrefIndex.begin(), spineHrefIndex.end(), SpineHrefIndexEntry{targetHash, targetLen, 0},
-                         [](const SpineHrefIndexEntry& a, const SpineHrefIndexEntry& b) {
-                           return a.hrefHash < b.hrefHash || (a.hrefHash == b.hrefHash && a.hrefLen < b.hrefLen);
-                         });
-
-    while (it != spineHrefIndex.end() && it->hrefHash == targetHash && it->hrefLen == targetLen) {
-      spineIndex = it->spineIndex;
-      break;
-    }
-
-    if (spineIndex == -1) {
-      LOG_DBG("BMC", "createTocEntry: Could not find spine item for TOC href %s", href.c_str());
-    }
-  } else {
-    spineFile.seek(0);
-    for (int i = 0; i < spineCount; i++) {
-      auto spineEntry = readSpineEntry(spineFile);
-      if (spineEntry.href == href) {
-        spineIndex = static_cast<int16_t>(i);
-        break;
-      }
-    }
-    if (spineIndex == -1) {
-      LOG_DBG("BMC", "createTocEntry: Could not find spine item for TOC href %s", href.c_str());
-    }
-  }
-
-  const TocEntry entry(title, href, anchor, level, spineIndex);
-  writeTocEntry(tocFile, entry);
-  tocCount++;
-}
-
 /* ============= READING / LOADING FUNCTIONS ================ */
 
 bool BookMetadataCache::load() {
@@ -385,6 +383,26 @@ bool BookMetadataCache::load() {
   serialization::readString(bookFile, coreMetadata.coverItemHref);
   serialization::readString(bookFile, coreMetadata.textReferenceHref);
 
+  // Resident tables sit directly after the LUT
+  spineCumulativeSizes.resize(spineCount);
+  spineTocIndices.resize(spineCount);
+  tocSpineIndices.resize(tocCount);
+  tocLevels.resize(tocCount);
+  tocTitlePool.clear();
+  tocTitleOffsets.clear();
+  const size_t spineTableBytes = sizeof(uint32_t) * spineCount + sizeof(int16_t) * spineCount;
+  const size_t tocTableBytes = sizeof(int16_t) * tocCount + sizeof(uint8_t) * tocCount;
+  bookFile.seek(lutOffset + sizeof(uint32_t) * (spineCount + tocCount));
+  size_t readBytes = bookFile.read(spineCumulativeSizes.data(), sizeof(uint32_t) * spineCount);
+  readBytes += bookFile.read(spineTocIndices.data(), sizeof(int16_t) * spineCount);
+  readBytes += bookFile.read(tocSpineIndices.data(), sizeof(int16_t) * tocCount);
+  readBytes += bookFile.read(tocLevels.data(), sizeof(uint8_t) * tocCount);
+  if (readBytes != spineTableBytes + tocTableBytes) {
+    LOG_ERR("BMC", "Could not read spine/TOC tables");
+    bookFile.close();
+    return false;
+  }
+
   loaded = true;
   LOG_DBG("BMC", "Loaded cache data: %d spine, %d TOC entries", spineCount, tocCount);
   return true;
@@ -428,6 +446,67 @@ BookMetadataCache::TocEntry BookMetadataCache::getTocEntry(const int index) {
   return readTocEntry(bookFile);
 }
 
+uint32_t BookMetadataCache::getCumulativeSize(const int spineIndex) const {
+  if (!loaded || spineIndex < 0 || spineIndex >= static_cast<int>(spineCount)) {
+    return 0;
+  }
+  return spineCumulativeSizes[spineIndex];
+}
+
+int16_t BookMetadataCache::getTocIndexForSpine(const int spineIndex) const {
+  if (!loaded || spineIndex < 0 || spineIndex >= static_cast<int>(spineCount)) {
+    return -1;
+  }
+  return spineTocIndices[spineIndex];
+}
+
+int16_t BookMetadataCache::getSpineIndexForToc(const int tocIndex) const {
+  if (!loaded || tocIndex < 0 || tocIndex >= static_cast<int>(tocCount)) {
+    return -1;
+  }
+  return tocSpineIndices[tocIndex];
+}
+
+uint8_t BookMetadataCache::getTocLevel(const int tocIndex) const {
+  if (!loaded || tocIndex < 0 || tocIndex >= static_cast<int>(tocCount)) {
+    return 0;
+  }
+  return tocLevels[tocIndex];
+}
+
+std::string BookMetadataCache::getTocTitle(const int tocIndex) {
+  if (!loaded) {
+    LOG_ERR("BMC", "getTocTitle called but cache not loaded");
+    return {};
+  }
+
+  if (tocIndex < 0 || tocIndex >= static_cast<int>(tocCount)) {
+    LOG_ERR("BMC", "getTocTitle index %d out of range", tocIndex);
+    return {};
+  }
+
+  if (tocTitleOffsets.empty()) {
+    tocTitleOffsets.assign(tocCount, noTitleLoaded);
+  }
+
+  if (tocTitleOffsets[tocIndex] == noTitleLoaded) {
+    // Title is the first field of the TOC entry
+    bookFile.seek(lutOffset + sizeof(uint32_t) * spineCount + sizeof(uint32_t) * tocIndex);
+    uint32_t tocEntryPos;
+    serialization::readPod(bookFile, tocEntryPos);
+    bookFile.seek(tocEntryPos);
+    std::string title;
+    serialization::readString(bookFile, title);
+
+    tocTitleOffsets[tocIndex] = static_cast<uint32_t>(tocTitlePool.size());
+    tocTitlePool.append(title);
+    tocTitlePool.push_back('\0');
+    return title;
+  }
+
+  return std::string(tocTitlePool.c_str() + tocTitleOffsets[tocIndex]);
+}
+
 BookMetadataCache::SpineEntry BookMetadataCache::readSpineEntry(FsFile& file) const {
   SpineEntry entry;
   serialization::readString(file, entry.href);
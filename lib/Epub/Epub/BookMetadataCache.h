@@ -44,27 +44,42 @@ class BookMetadataCache {
 
  private:
   std::string cachePath;
-  size_t lutOffset;
+  uint32_t lutOffset;
   uint16_t spineCount;
   uint16_t tocCount;
   bool loaded;
   bool buildMode;
 
   FsFile bookFile;
-  // Temp file handles during build
-  FsFile spineFile;
-  FsFile tocFile;
 
-  // Index for fast href→spineIndex lookup (used only for large EPUBs)
+  // Resident tables, loaded once so progress and status bar lookups don't need to touch the SD card
+  std::vector<uint32_t> spineCumulativeSizes;
+  std::vector<int16_t> spineTocIndices;
+  std::vector<int16_t> tocSpineIndices;
+  std::vector<uint8_t> tocLevels;
+  // TOC titles are pulled in on first use, tocTitleOffsets[i] points into the NUL separated pool
+  std::string tocTitlePool;
+  std::vector<uint32_t> tocTitleOffsets;
+
+  // Build state. Spine hrefs are kept in a RAM pool (spilled to SD only for very large books), TOC entries are
+  // streamed straight into book.bin, so book.bin is written in a single sequential pass.
+  std::string spineHrefPool;
+  std::vector<uint32_t> spineHrefOffsets;  // spineCount + 1 entries, href i spans [offsets[i], offsets[i + 1])
+  FsFile spineSpillFile;
+  bool spineHrefsSpilled = false;
+  bool spineSpillFailed = false;  // The spill file couldn't be opened, endContentOpfPass fails the build
+  std::vector<uint32_t> tocEntryOffsets;
+
+  // Index for fast href→spineIndex lookup during the TOC pass
   struct SpineHrefIndexEntry {
     uint64_t hrefHash;  // FNV-1a 64-bit hash
     uint16_t hrefLen;   // length for collision reduction
     int16_t spineIndex;
   };
   std::vector<SpineHrefIndexEntry> spineHrefIndex;
-  bool useSpineHrefIndex = false;
 
-  static constexpr uint16_t LARGE_SPINE_THRESHOLD = 400;
+  // Above this many bytes of spine hrefs the pool is moved to SD rather than held in RAM
+  static constexpr size_t MAX_IN_MEMORY_SPINE_HREF_BYTES = 24 * 1024;
 
   // FNV-1a 64-bit hash function
   static uint64_t fnvHash64(const std::string& s) {
@@ -76,6 +91,8 @@ class BookMetadataCache {
     return hash;
   }
 
+  std::string getBuildSpineHref(int index);
+  void releaseBuildState();
   uint32_t writeSpineEntry(FsFile& file, const SpineEntry& entry) const;
   uint32_t writeTocEntry(FsFile& file, const TocEntry& entry) const;
   SpineEntry readSpineEntry(FsFile& file) const;
@@ -88,24 +105,29 @@ class BookMetadataCache {
       : cachePath(std::move(cachePath)), lutOffset(0), spineCount(0), tocCount(0), loaded(false), buildMode(false) {}
   ~BookMetadataCache() = default;
 
-  // Building phase (stream to disk immediately)
+  // Building phase
   bool beginWrite();
   bool beginContentOpfPass();
   void createSpineEntry(const std::string& href);
-  bool endContentOpfPass();
+  // Opens book.bin and writes the metadata block, TOC entries are streamed in directly after it
+  bool endContentOpfPass(const BookMetadata& metadata);
   bool beginTocPass();
   void createTocEntry(const std::string& title, const std::string& href, const std::string& anchor, uint8_t level);
   bool endTocPass();
+  // Appends spine entries (with sizes and TOC mappings) and the lookup table, then finalises the header
+  bool buildBookBin(const std::string& epubPath);
   bool endWrite();
   bool cleanupTmpFiles() const;
 
-  // Post-processing to update mappings and sizes
-  bool buildBookBin(const std::string& epubPath, const BookMetadata& metadata);
-
   // Reading phase (read mode)
   bool load();
   SpineEntry getSpineEntry(int index);
   TocEntry getTocEntry(int index);
+  uint32_t getCumulativeSize(int spineIndex) const;
+  int16_t getTocIndexForSpine(int spineIndex) const;
+  int16_t getSpineIndexForToc(int tocIndex) const;
+  uint8_t getTocLevel(int tocIndex) const;
+  std::string getTocTitle(int tocIndex);
   int getSpineCount() const { return spineCount; }
   int getTocCount() const { return tocCount; }
   bool isLoaded() const { return loaded; }
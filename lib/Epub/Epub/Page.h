@@ -48,6 +48,7 @@ class PageImage final : public PageElement {
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
   bool serialize(FsFile& file) override;
   PageElementTag getTag() const override { return TAG_PageImage; }
+  const std::shared_ptr<ImageBlock>& getImageBlock() const { return imageBlock; }
   static std::unique_ptr<PageImage> deserialize(FsFile& file);
 };
 
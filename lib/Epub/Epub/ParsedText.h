@@ -11,6 +11,7 @@
 #include "blocks/BlockStyle.h"
 #include "blocks/TextBlock.h"
 
+class FontHandle;
 class GfxRenderer;
 
 class ParsedText {
@@ -22,18 +23,17 @@ class ParsedText {
   bool hyphenationEnabled;
 
   void applyParagraphIndent();
-  std::vector<size_t> computeLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth, int spaceWidth,
+  std::vector<size_t> computeLineBreaks(const FontHandle& font, int pageWidth, int spaceWidth,
                                         std::vector<uint16_t>& wordWidths, std::vector<bool>& continuesVec);
-  std::vector<size_t> computeHyphenatedLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth,
-                                                  int spaceWidth, std::vector<uint16_t>& wordWidths,
-                                                  std::vector<bool>& continuesVec);
-  bool hyphenateWordAtIndex(size_t wordIndex, int availableWidth, const GfxRenderer& renderer, int fontId,
+  std::vector<size_t> computeHyphenatedLineBreaks(const FontHandle& font, int pageWidth, int spaceWidth,
+                                                  std::vector<uint16_t>& wordWidths, std::vector<bool>& continuesVec);
+  bool hyphenateWordAtIndex(size_t wordIndex, int availableWidth, const FontHandle& font,
                             std::vector<uint16_t>& wordWidths, bool allowFallbackBreaks,
                             std::vector<bool>* continuesVec = nullptr);
   void extractLine(size_t breakIndex, int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths,
                    const std::vector<bool>& continuesVec, const std::vector<size_t>& lineBreakIndices,
                    const std::function<void(std::shared_ptr<TextBlock>)>& processLine);
-  std::vector<uint16_t> calculateWordWidths(const GfxRenderer& renderer, int fontId);
+  std::vector<uint16_t> calculateWordWidths(const FontHandle& font);
 
  public:
   explicit ParsedText(const bool extraParagraphSpacing, const bool hyphenationEnabled = false,
@@ -1,15 +1,20 @@
 #include "Section.h"
 
+#include <Arduino.h>
 #include <HalStorage.h>
 #include <Logging.h>
 #include <Serialization.h>
 
+#include <algorithm>
+
 #include "Page.h"
 #include "hyphenation/Hyphenator.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 13;
+constexpr uint8_t SECTION_FILE_VERSION = 15;
+// Background image decodes leave at least this much heap to the page being shown
+constexpr uint32_t MIN_FREE_HEAP_FOR_PREFETCH = 64 * 1024;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(bool) + sizeof(bool) +
                                  sizeof(uint32_t);
@@ -125,6 +130,36 @@ bool Section::clearCache() const {
   return true;
 }
 
+void Section::removeLegacyImages() const {
+  // Older caches extracted images per section as img_<spineIndex>_<n>.<ext> (plus .pxc pixel caches) in the book
+  // cache root, images now live in the shared images directory instead
+  const std::string cachePath = epub->getCachePath();
+  const std::string prefix = "img_" + std::to_string(spineIndex) + "_";
+  std::vector<std::string> legacyFiles;
+  auto dir = Storage.open(cachePath.c_str());
+  if (!dir || !dir.isDirectory()) {
+    return;
+  }
+  char name[64];
+  for (auto entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+    if (!entry.isDirectory()) {
+      entry.getName(name, sizeof(name));
+      if (strncmp(name, prefix.c_str(), prefix.size()) == 0) {
+        legacyFiles.emplace_back(name);
+      }
+    }
+    entry.close();
+  }
+  dir.close();
+
+  for (const auto& legacyFile : legacyFiles) {
+    Storage.remove((cachePath + "/" + legacyFile).c_str());
+  }
+  if (!legacyFiles.empty()) {
+    LOG_DBG("SCT", "Removed %d legacy image files", static_cast<int>(legacyFiles.size()));
+  }
+}
+
 bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                 const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                 const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
@@ -132,11 +167,14 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   const auto localPath = epub->getSpineItem(spineIndex).href;
   const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
 
-  // Create cache directory if it doesn't exist
+  // Create cache directories if they don't exist
   {
     const auto sectionsDir = epub->getCachePath() + "/sections";
     Storage.mkdir(sectionsDir.c_str());
+    const auto imagesDir = epub->getCachePath() + "/images";
+    Storage.mkdir(imagesDir.c_str());
   }
+  removeLegacyImages();
 
   // Retry logic for SD card timing issues
   bool success = false;
@@ -181,10 +219,11 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
                          viewportHeight, hyphenationEnabled, embeddedStyle);
   std::vector<uint32_t> lut = {};
 
-  // Derive the content base directory and image cache path prefix for the parser
+  // Derive the content base directory and image cache path prefix for the parser.
+  // Images are shared across all sections of the book, so the same file is only extracted once.
   size_t lastSlash = localPath.find_last_of('/');
   std::string contentBase = (lastSlash != std::string::npos) ? localPath.substr(0, lastSlash + 1) : "";
-  std::string imageBasePath = epub->getCachePath() + "/img_" + std::to_string(spineIndex) + "_";
+  std::string imageBasePath = epub->getCachePath() + "/images/";
 
   CssParser* cssParser = nullptr;
   if (embeddedStyle) {
@@ -244,7 +283,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   return true;
 }
 
-std::unique_ptr<Page> Section::loadPageFromSectionFile() {
+std::unique_ptr<Page> Section::loadPage(const int pageIndex) {
   if (!Storage.openFileForRead("SCT", filePath, file)) {
     return nullptr;
   }
@@ -252,7 +291,7 @@ std::unique_ptr<Page> Section::loadPageFromSectionFile() {
   file.seek(HEADER_SIZE - sizeof(uint32_t));
   uint32_t lutOffset;
   serialization::readPod(file, lutOffset);
-  file.seek(lutOffset + sizeof(uint32_t) * currentPage);
+  file.seek(lutOffset + sizeof(uint32_t) * pageIndex);
   uint32_t pagePos;
   serialization::readPod(file, pagePos);
   file.seek(pagePos);
@@ -261,3 +300,82 @@ std::unique_ptr<Page> Section::loadPageFromSectionFile() {
   file.close();
   return page;
 }
+
+void Section::materializeImages(const Page& page) const {
+  for (const auto& element : page.elements) {
+    if (element->getTag() != TAG_PageImage) {
+      continue;
+    }
+
+    const auto& imageBlock = static_cast<const PageImage&>(*element).getImageBlock();
+    if (imageBlock->hasPixelCache() || imageBlock->imageExists()) {
+      continue;
+    }
+
+    const auto& imagePath = imageBlock->getImagePath();
+    LOG_DBG("SCT", "Extracting image %s", imageBlock->getItemHref().c_str());
+    FsFile imageFile;
+    if (!Storage.openFileForWrite("SCT", imagePath, imageFile)) {
+      continue;
+    }
+    const bool success = epub->readItemContentsToStream(imageBlock->getItemHref(), imageFile, 4096);
+    imageFile.flush();
+    imageFile.close();
+    if (!success) {
+      // Don't leave a truncated file behind for other pages to pick up
+      LOG_ERR("SCT", "Failed to extract image %s", imageBlock->getItemHref().c_str());
+      Storage.remove(imagePath.c_str());
+    }
+  }
+}
+
+std::unique_ptr<Page> Section::loadPageFromSectionFile() {
+  auto page = loadPage(currentPage);
+  if (page && page->hasImages()) {
+    materializeImages(*page);
+  }
+  return page;
+}
+
+bool Section::prefetchImages(const int fromPage, const int pagesAhead, const std::function<bool()>& cancelled) {
+  const auto stopped = [&cancelled]() {
+    if (cancelled && cancelled()) {
+      return true;
+    }
+    if (ESP.getFreeHeap() < MIN_FREE_HEAP_FOR_PREFETCH) {
+      // Font groups of earlier pages are the cheapest memory to give back
+      renderer.trimFontCache();
+    }
+    if (ESP.getFreeHeap() < MIN_FREE_HEAP_FOR_PREFETCH) {
+      LOG_DBG("SCT", "Not prefetching images, low heap (%u bytes)", ESP.getFreeHeap());
+      return true;
+    }
+    return false;
+  };
+
+  const int lastPage = std::min(fromPage + pagesAhead, pageCount - 1);
+  for (int pageIndex = std::max(fromPage + 1, prefetchedThroughPage + 1); pageIndex <= lastPage; pageIndex++) {
+    if (stopped()) {
+      return false;
+    }
+    const auto page = loadPage(pageIndex);
+    if (page && page->hasImages()) {
+      materializeImages(*page);
+      for (const auto& element : page->elements) {
+        if (element->getTag() != TAG_PageImage) {
+          continue;
+        }
+        if (stopped()) {
+          return false;
+        }
+        static_cast<const PageImage&>(*element).getImageBlock()->buildPixelCache(renderer, cancelled);
+      }
+      // The last decode may have been the one cancelled
+      if (cancelled && cancelled()) {
+        return false;
+      }
+    }
+    prefetchedThroughPage = pageIndex;
+  }
+  return true;
+}
@@ -13,11 +13,18 @@ class Section {
   GfxRenderer& renderer;
   std::string filePath;
   FsFile file;
+  // Highest page whose images have been prefetched into the pixel cache
+  int prefetchedThroughPage = -1;
 
   void writeSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                               uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
                               bool embeddedStyle);
   uint32_t onPageComplete(std::unique_ptr<Page> page);
+  std::unique_ptr<Page> loadPage(int pageIndex);
+  // Extract the source file of any image on the page that isn't cached yet
+  void materializeImages(const Page& page) const;
+  // Remove this section's images left in the cache root by older cache layouts
+  void removeLegacyImages() const;
 
  public:
   uint16_t pageCount = 0;
@@ -36,4 +43,7 @@ class Section {
                          uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
                          const std::function<void()>& popupFn = nullptr);
   std::unique_ptr<Page> loadPageFromSectionFile();
+  // Decode images on the pages following fromPage into the pixel cache, so turning onto them doesn't wait on a decode.
+  // Returns false when stopped early by `cancelled` or low heap, the remaining pages are picked up by the next call.
+  bool prefetchImages(int fromPage, int pagesAhead, const std::function<bool()>& cancelled = nullptr);
 };
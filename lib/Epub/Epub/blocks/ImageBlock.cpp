@@ -5,94 +5,75 @@
 #include <SDCardManager.h>
 #include <Serialization.h>
 
-#include "../converters/DitherUtils.h"
 #include "../converters/ImageDecoderFactory.h"
+#include "../converters/PixelCache.h"
 
-// Cache file format:
-// - uint16_t width
-// - uint16_t height
-// - uint8_t pixels[...] - 2 bits per pixel, packed (4 pixels per byte), row-major order
+// Decoded images are cached at their display size, see PixelCache.h for the file format
 
-ImageBlock::ImageBlock(const std::string& imagePath, int16_t width, int16_t height)
-    : imagePath(imagePath), width(width), height(height) {}
+ImageBlock::ImageBlock(const std::string& imagePath, const std::string& itemHref, int16_t intrinsicWidth,
+                       int16_t intrinsicHeight, int16_t width, int16_t height)
+    : imagePath(imagePath),
+      itemHref(itemHref),
+      intrinsicWidth(intrinsicWidth),
+      intrinsicHeight(intrinsicHeight),
+      width(width),
+      height(height) {}
 
 bool ImageBlock::imageExists() const { return Storage.exists(imagePath.c_str()); }
 
 namespace {
 
-std::string getCachePath(const std::string& imagePath) {
-  // Replace extension with .pxc (pixel cache)
+std::string getCachePath(const std::string& imagePath, const int width, const int height) {
+  // Replace extension with the display size and .pxc (pixel cache). The source image is shared between
+  // sections, so the size is part of the key to allow the same image to be cached at several sizes.
+  const std::string sizeSuffix = "_" + std::to_string(width) + "x" + std::to_string(height) + ".pxc";
   size_t dotPos = imagePath.rfind('.');
   if (dotPos != std::string::npos) {
-    return imagePath.substr(0, dotPos) + ".pxc";
+    return imagePath.substr(0, dotPos) + sizeSuffix;
   }
-  return imagePath + ".pxc";
+  return imagePath + sizeSuffix;
 }
 
-bool renderFromCache(GfxRenderer& renderer, const std::string& cachePath, int x, int y, int expectedWidth,
-                     int expectedHeight) {
-  FsFile cacheFile;
-  if (!Storage.openFileForRead("IMG", cachePath, cacheFile)) {
-    return false;
-  }
+}  // namespace
 
-  uint16_t cachedWidth, cachedHeight;
-  if (cacheFile.read(&cachedWidth, 2) != 2 || cacheFile.read(&cachedHeight, 2) != 2) {
-    cacheFile.close();
-    return false;
-  }
+bool ImageBlock::hasPixelCache() const { return Storage.exists(getCachePath(imagePath, width, height).c_str()); }
 
-  // Verify dimensions are close (allow 1 pixel tolerance for rounding differences)
-  int widthDiff = abs(cachedWidth - expectedWidth);
-  int heightDiff = abs(cachedHeight - expectedHeight);
-  if (widthDiff > 1 || heightDiff > 1) {
-    LOG_ERR("IMG", "Cache dimension mismatch: %dx%d vs %dx%d", cachedWidth, cachedHeight, expectedWidth,
-            expectedHeight);
-    cacheFile.close();
-    return false;
+bool ImageBlock::buildPixelCache(GfxRenderer& renderer, const std::function<bool()>& cancelled) const {
+  const std::string cachePath = getCachePath(imagePath, width, height);
+  if (Storage.exists(cachePath.c_str())) {
+    return true;
   }
 
-  // Use cached dimensions for rendering (they're the actual decoded size)
-  expectedWidth = cachedWidth;
-  expectedHeight = cachedHeight;
-
-  LOG_DBG("IMG", "Loading from cache: %s (%dx%d)", cachePath.c_str(), cachedWidth, cachedHeight);
-
-  // Read and render row by row to minimize memory usage
-  const int bytesPerRow = (cachedWidth + 3) / 4;  // 2 bits per pixel, 4 pixels per byte
-  uint8_t* rowBuffer = (uint8_t*)malloc(bytesPerRow);
-  if (!rowBuffer) {
-    LOG_ERR("IMG", "Failed to allocate row buffer");
-    cacheFile.close();
+  ImageToFramebufferDecoder* decoder = ImageDecoderFactory::getDecoder(imagePath);
+  if (!decoder) {
+    LOG_ERR("IMG", "No decoder found for image: %s", imagePath.c_str());
     return false;
   }
 
-  for (int row = 0; row < cachedHeight; row++) {
-    if (cacheFile.read(rowBuffer, bytesPerRow) != bytesPerRow) {
-      LOG_ERR("IMG", "Cache read error at row %d", row);
-      free(rowBuffer);
-      cacheFile.close();
-      return false;
-    }
+  LOG_DBG("IMG", "Prefetching: %s (%dx%d)", imagePath.c_str(), width, height);
 
-    int destY = y + row;
-    for (int col = 0; col < cachedWidth; col++) {
-      int byteIdx = col / 4;
-      int bitShift = 6 - (col % 4) * 2;  // MSB first within byte
-      uint8_t pixelValue = (rowBuffer[byteIdx] >> bitShift) & 0x03;
-
-      drawPixelWithRenderMode(renderer, x + col, destY, pixelValue);
+  RenderConfig config;
+  config.x = 0;
+  config.y = 0;
+  config.maxWidth = width;
+  config.maxHeight = height;
+  config.useGrayscale = true;
+  config.useDithering = true;
+  config.performanceMode = false;
+  config.useExactDimensions = true;
+  config.cachePath = cachePath;
+  config.cacheOnly = true;
+  config.cancelled = cancelled;
+
+  if (!decoder->decodeToFramebuffer(imagePath, renderer, config)) {
+    if (!cancelled || !cancelled()) {
+      LOG_ERR("IMG", "Failed to prefetch image: %s", imagePath.c_str());
     }
+    return false;
   }
-
-  free(rowBuffer);
-  cacheFile.close();
-  LOG_DBG("IMG", "Cache render complete");
   return true;
 }
 
-}  // namespace
-
 void ImageBlock::render(GfxRenderer& renderer, const int x, const int y) {
   LOG_DBG("IMG", "Rendering image at %d,%d: %s (%dx%d)", x, y, imagePath.c_str(), width, height);
 
@@ -107,8 +88,8 @@ void ImageBlock::render(GfxRenderer& renderer, const int x, const int y) {
   }
 
   // Try to render from cache first
-  std::string cachePath = getCachePath(imagePath);
-  if (renderFromCache(renderer, cachePath, x, y, width, height)) {
+  std::string cachePath = getCachePath(imagePath, width, height);
+  if (PixelCache::render(renderer, cachePath, x, y, width, height)) {
     return;  // Successfully rendered from cache
   }
 
@@ -159,6 +140,9 @@ void ImageBlock::render(GfxRenderer& renderer, const int x, const int y) {
 
 bool ImageBlock::serialize(FsFile& file) {
   serialization::writeString(file, imagePath);
+  serialization::writeString(file, itemHref);
+  serialization::writePod(file, intrinsicWidth);
+  serialization::writePod(file, intrinsicHeight);
   serialization::writePod(file, width);
   serialization::writePod(file, height);
   return true;
@@ -166,9 +150,13 @@ bool ImageBlock::serialize(FsFile& file) {
 
 std::unique_ptr<ImageBlock> ImageBlock::deserialize(FsFile& file) {
   std::string path;
+  std::string href;
   serialization::readString(file, path);
-  int16_t w, h;
+  serialization::readString(file, href);
+  int16_t iw, ih, w, h;
+  serialization::readPod(file, iw);
+  serialization::readPod(file, ih);
   serialization::readPod(file, w);
   serialization::readPod(file, h);
-  return std::unique_ptr<ImageBlock>(new ImageBlock(path, w, h));
+  return std::unique_ptr<ImageBlock>(new ImageBlock(path, href, iw, ih, w, h));
 }
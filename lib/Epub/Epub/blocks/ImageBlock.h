@@ -1,21 +1,32 @@
 #pragma once
 #include <SdFat.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 
 #include "Block.h"
 
+// An image reference recorded during indexing. The image itself is only extracted from the EPUB (to imagePath)
+// and decoded (to its pixel cache) when its page is first shown or prefetched.
 class ImageBlock final : public Block {
  public:
-  ImageBlock(const std::string& imagePath, int16_t width, int16_t height);
+  ImageBlock(const std::string& imagePath, const std::string& itemHref, int16_t intrinsicWidth,
+             int16_t intrinsicHeight, int16_t width, int16_t height);
   ~ImageBlock() override = default;
 
   const std::string& getImagePath() const { return imagePath; }
+  const std::string& getItemHref() const { return itemHref; }
+  int16_t getIntrinsicWidth() const { return intrinsicWidth; }
+  int16_t getIntrinsicHeight() const { return intrinsicHeight; }
   int16_t getWidth() const { return width; }
   int16_t getHeight() const { return height; }
 
   bool imageExists() const;
+  bool hasPixelCache() const;
+  // Decode the image into its pixel cache without drawing it, so the first render of its page is a cache read.
+  // The source image must already be extracted to imagePath. A decode stopped by `cancelled` leaves no cache behind.
+  bool buildPixelCache(GfxRenderer& renderer, const std::function<bool()>& cancelled = nullptr) const;
 
   BlockType getType() override { return IMAGE_BLOCK; }
   bool isEmpty() override { return false; }
@@ -25,7 +36,13 @@ class ImageBlock final : public Block {
   static std::unique_ptr<ImageBlock> deserialize(FsFile& file);
 
  private:
+  // Extracted source image in the book's shared image cache
   std::string imagePath;
+  // Path of the image inside the EPUB
+  std::string itemHref;
+  int16_t intrinsicWidth;
+  int16_t intrinsicHeight;
+  // Display size
   int16_t width;
   int16_t height;
 };
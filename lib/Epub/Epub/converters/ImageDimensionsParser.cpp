@@ -0,0 +1,172 @@
+#include "ImageDimensionsParser.h"
+
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+constexpr uint8_t PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+constexpr uint8_t JPEG_SOF0 = 0xC0;  // Baseline DCT, the only frame type picojpeg can decode
+constexpr uint8_t JPEG_SOS = 0xDA;
+constexpr uint8_t JPEG_EOI = 0xD9;
+
+// SOF0-SOF15, excluding DHT (C4), JPG (C8) and DAC (CC) which share the range
+bool isStartOfFrame(const uint8_t marker) {
+  return marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+}
+
+// Markers that are not followed by a length field
+bool isStandaloneMarker(const uint8_t marker) { return marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8); }
+
+uint16_t readBigEndian16(const uint8_t* p) { return static_cast<uint16_t>((p[0] << 8) | p[1]); }
+
+uint32_t readBigEndian32(const uint8_t* p) {
+  return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+         (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+}  // namespace
+
+void ImageDimensionsParser::finish(const int width, const int height) {
+  state = DONE;
+  if (width <= 0 || height <= 0 || width > INT16_MAX || height > INT16_MAX) {
+    LOG_ERR("IMG", "Unusable image dimensions in header: %dx%d", width, height);
+    return;
+  }
+  dimensions.width = static_cast<int16_t>(width);
+  dimensions.height = static_cast<int16_t>(height);
+  found = true;
+}
+
+void ImageDimensionsParser::processByte(const uint8_t b) {
+  switch (state) {
+    case DETECT_FORMAT:
+      if (b == PNG_SIGNATURE[0]) {
+        header[headerFilled++] = b;
+        state = PNG_HEADER;
+      } else if (b == 0xFF) {
+        state = JPEG_SOI;
+      } else {
+        LOG_ERR("IMG", "Unknown image header byte 0x%02X", b);
+        state = DONE;
+      }
+      break;
+
+    case PNG_HEADER:
+      header[headerFilled++] = b;
+      if (headerFilled == PNG_HEADER_SIZE) {
+        if (memcmp(header, PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) != 0 || memcmp(header + 12, "IHDR", 4) != 0) {
+          LOG_ERR("IMG", "Invalid PNG header");
+          state = DONE;
+          break;
+        }
+        const uint32_t width = readBigEndian32(header + 16);
+        const uint32_t height = readBigEndian32(header + 20);
+        finish(width > INT16_MAX ? -1 : static_cast<int>(width), height > INT16_MAX ? -1 : static_cast<int>(height));
+      }
+      break;
+
+    case JPEG_SOI:
+      if (b != 0xD8) {
+        LOG_ERR("IMG", "Invalid JPEG header");
+        state = DONE;
+        break;
+      }
+      state = JPEG_MARKER_PREFIX;
+      break;
+
+    case JPEG_MARKER_PREFIX:
+      if (b != 0xFF) {
+        LOG_ERR("IMG", "Expected JPEG marker, got 0x%02X", b);
+        state = DONE;
+        break;
+      }
+      state = JPEG_MARKER_CODE;
+      break;
+
+    case JPEG_MARKER_CODE:
+      if (b == 0xFF) {
+        // Fill byte, marker code follows
+        break;
+      }
+      if (b == JPEG_EOI || b == JPEG_SOS) {
+        LOG_ERR("IMG", "No JPEG frame header found");
+        state = DONE;
+        break;
+      }
+      jpegMarker = b;
+      state = isStandaloneMarker(b) ? JPEG_MARKER_PREFIX : JPEG_LENGTH_HIGH;
+      break;
+
+    case JPEG_LENGTH_HIGH:
+      jpegSegmentRemaining = static_cast<uint16_t>(b << 8);
+      state = JPEG_LENGTH_LOW;
+      break;
+
+    case JPEG_LENGTH_LOW:
+      jpegSegmentRemaining |= b;
+      if (jpegSegmentRemaining < 2) {
+        LOG_ERR("IMG", "Invalid JPEG segment length");
+        state = DONE;
+        break;
+      }
+      jpegSegmentRemaining -= 2;  // Length includes itself
+      headerFilled = 0;
+      state = jpegSegmentRemaining > 0 ? JPEG_SEGMENT : JPEG_MARKER_PREFIX;
+      break;
+
+    case JPEG_SEGMENT:
+      jpegSegmentRemaining--;
+      if (isStartOfFrame(jpegMarker)) {
+        // precision (1), height (2), width (2)
+        header[headerFilled++] = b;
+        if (headerFilled == 5) {
+          if (jpegMarker != JPEG_SOF0) {
+            LOG_ERR("IMG", "Unsupported JPEG frame type 0x%02X (only baseline is supported)", jpegMarker);
+            state = DONE;
+            break;
+          }
+          finish(readBigEndian16(header + 3), readBigEndian16(header + 1));
+          break;
+        }
+      }
+      if (jpegSegmentRemaining == 0) {
+        state = JPEG_MARKER_PREFIX;
+      }
+      break;
+
+    case DONE:
+      break;
+  }
+}
+
+size_t ImageDimensionsParser::write(const uint8_t data) { return write(&data, 1); }
+
+size_t ImageDimensionsParser::write(const uint8_t* buffer, const size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    if (state == DONE) {
+      return 0;
+    }
+    // Skip the bulk of large segments (EXIF thumbnails, ICC profiles) without stepping through every byte
+    if (state == JPEG_SEGMENT && !isStartOfFrame(jpegMarker)) {
+      const size_t skip = std::min<size_t>(jpegSegmentRemaining, size - i);
+      jpegSegmentRemaining -= skip;
+      i += skip - 1;
+      if (jpegSegmentRemaining == 0) {
+        state = JPEG_MARKER_PREFIX;
+      }
+      continue;
+    }
+    processByte(buffer[i]);
+  }
+  return state == DONE ? 0 : size;
+}
+
+bool ImageDimensionsParser::getDimensions(ImageDimensions& out) const {
+  if (!found) {
+    return false;
+  }
+  out = dimensions;
+  return true;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <Print.h>
+
+#include "ImageToFramebufferDecoder.h"
+
+// Streaming sink that reads the intrinsic size out of a JPEG or PNG header, so images can be measured straight
+// from the EPUB without extracting them first. Stops accepting data (write returns 0) once the size is known
+// or the header turns out to be unusable, which ends the zip stream early.
+class ImageDimensionsParser final : public Print {
+  enum ParserState : uint8_t {
+    DETECT_FORMAT,
+    // PNG: signature followed by the IHDR chunk
+    PNG_HEADER,
+    // JPEG: walk the marker segments until the start of frame
+    JPEG_SOI,
+    JPEG_MARKER_PREFIX,
+    JPEG_MARKER_CODE,
+    JPEG_LENGTH_HIGH,
+    JPEG_LENGTH_LOW,
+    JPEG_SEGMENT,
+    DONE,
+  };
+
+  static constexpr size_t PNG_HEADER_SIZE = 24;  // 8 byte signature + IHDR length, type, width and height
+
+  ParserState state = DETECT_FORMAT;
+  uint8_t header[PNG_HEADER_SIZE] = {};
+  size_t headerFilled = 0;
+  uint8_t jpegMarker = 0;
+  uint16_t jpegSegmentRemaining = 0;
+  ImageDimensions dimensions = {0, 0};
+  bool found = false;
+
+  void processByte(uint8_t b);
+  void finish(int width, int height);
+
+ public:
+  ImageDimensionsParser() = default;
+  ~ImageDimensionsParser() override = default;
+
+  size_t write(uint8_t) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+
+  // True once the stream has been consumed far enough to give an answer
+  bool isDone() const { return state == DONE; }
+  // Returns false if the header was not a supported JPEG (baseline) or PNG
+  bool getDimensions(ImageDimensions& out) const;
+};
@@ -1,6 +1,7 @@
 #pragma once
 #include <SdFat.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -19,6 +20,9 @@ struct RenderConfig {
   bool performanceMode = false;
   bool useExactDimensions = false;  // If true, use maxWidth/maxHeight as exact output size (no recalculation)
   std::string cachePath;            // If non-empty, decoder will write pixel cache to this path
+  bool cacheOnly = false;           // If true, only write the pixel cache and leave the framebuffer untouched
+  // Polled between rows, the decode is abandoned (and its pixel cache removed) once it returns true
+  std::function<bool()> cancelled;
 };
 
 class ImageToFramebufferDecoder {
@@ -47,6 +47,8 @@ bool JpegToFramebufferConverter::getDimensionsStatic(const std::string& imagePat
 bool JpegToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath, GfxRenderer& renderer,
                                                      const RenderConfig& config) {
   LOG_DBG("JPG", "Decoding JPEG: %s", imagePath.c_str());
+  // The pixel cache band and the file buffer come out of the heap the font cache shares
+  renderer.trimFontCache();
 
   FsFile file;
   if (!Storage.openFileForRead("JPG", imagePath, file)) {
@@ -93,8 +95,22 @@ bool JpegToFramebufferConverter::decodeToFramebuffer(const std::string& imagePat
     destHeight = (int)(imageInfo.m_height * scale);
   }
 
-  LOG_DBG("JPG", "JPEG %dx%d -> %dx%d (scale %.2f), scan type: %d, MCU: %dx%d", imageInfo.m_width, imageInfo.m_height,
-          destWidth, destHeight, scale, imageInfo.m_scanType, imageInfo.m_MCUWidth, imageInfo.m_MCUHeight);
+  // Reduce mode decodes only the DC coefficient (the average) of each 8x8 block, skipping the IDCT and chroma
+  // upsampling. At 1/8 scale or below every block covers at most one destination pixel anyway.
+  const bool reduce = scale <= 1.0f / 8;
+  if (reduce) {
+    context.bufferPos = 0;
+    context.bufferFilled = 0;
+    if (!file.seek(0) || (status = pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, 1)) != 0) {
+      LOG_ERR("JPG", "picojpeg reduced init failed: %d", status);
+      file.close();
+      return false;
+    }
+  }
+
+  LOG_DBG("JPG", "JPEG %dx%d -> %dx%d (scale %.2f%s), scan type: %d, MCU: %dx%d", imageInfo.m_width,
+          imageInfo.m_height, destWidth, destHeight, scale, reduce ? ", reduced" : "", imageInfo.m_scanType,
+          imageInfo.m_MCUWidth, imageInfo.m_MCUHeight);
 
   if (!imageInfo.m_pMCUBufR || !imageInfo.m_pMCUBufG || !imageInfo.m_pMCUBufB) {
     LOG_ERR("JPG", "Null buffer pointers in imageInfo");
@@ -105,15 +121,23 @@ bool JpegToFramebufferConverter::decodeToFramebuffer(const std::string& imagePat
   const int screenWidth = renderer.getScreenWidth();
   const int screenHeight = renderer.getScreenHeight();
 
-  // Allocate pixel cache if cachePath is provided
+  // Write the pixel cache while decoding if cachePath is provided. The MCUs of one MCU row are decoded left to right,
+  // so the cache has to hold all destination rows of an MCU row (plus one shared with the row before) at a time.
   PixelCache cache;
   bool caching = !config.cachePath.empty();
   if (caching) {
-    if (!cache.allocate(destWidth, destHeight, config.x, config.y)) {
-      LOG_ERR("JPG", "Failed to allocate cache buffer, continuing without caching");
+    const int bandRows = static_cast<int>(imageInfo.m_MCUHeight * scale) + 2;
+    if (!cache.begin(config.cachePath, destWidth, destHeight, config.x, config.y, bandRows)) {
+      if (config.cacheOnly) {
+        LOG_ERR("JPG", "Failed to start pixel cache");
+        file.close();
+        return false;
+      }
+      LOG_ERR("JPG", "Failed to start pixel cache, continuing without caching");
       caching = false;
     }
   }
+  const bool drawing = !config.cacheOnly;
 
   int mcuX = 0;
   int mcuY = 0;
@@ -133,132 +157,164 @@ bool JpegToFramebufferConverter::decodeToFramebuffer(const std::string& imagePat
     int srcStartX = mcuX * imageInfo.m_MCUWidth;
     int srcStartY = mcuY * imageInfo.m_MCUHeight;
 
-    switch (imageInfo.m_scanType) {
-      case PJPG_GRAYSCALE:
-        for (int row = 0; row < 8; row++) {
-          int srcY = srcStartY + row;
-          int destY = config.y + (int)(srcY * scale);
-          if (destY >= screenHeight || destY >= config.y + destHeight) continue;
-          for (int col = 0; col < 8; col++) {
-            int srcX = srcStartX + col;
-            int destX = config.x + (int)(srcX * scale);
-            if (destX >= screenWidth || destX >= config.x + destWidth) continue;
-            uint8_t gray = imageInfo.m_pMCUBufR[row * 8 + col];
-            uint8_t dithered = config.useDithering ? applyBayerDither4Level(gray, destX, destY) : gray / 85;
-            if (dithered > 3) dithered = 3;
-            drawPixelWithRenderMode(renderer, destX, destY, dithered);
-            if (caching) cache.setPixel(destX, destY, dithered);
+    if (reduce) {
+      // One pixel per block, blocks at 0, 64 (right) and 128 (below) like the full size pixels
+      for (int blockY = 0; blockY < imageInfo.m_MCUHeight / 8; blockY++) {
+        int srcY = srcStartY + blockY * 8;
+        int destY = config.y + (int)(srcY * scale);
+        if (destY >= screenHeight || destY >= config.y + destHeight) continue;
+        for (int blockX = 0; blockX < imageInfo.m_MCUWidth / 8; blockX++) {
+          int srcX = srcStartX + blockX * 8;
+          int destX = config.x + (int)(srcX * scale);
+          if (destX >= screenWidth || destX >= config.x + destWidth) continue;
+          int blockOffset = blockY * 128 + blockX * 64;
+          uint8_t gray = imageInfo.m_pMCUBufR[blockOffset];
+          if (imageInfo.m_scanType != PJPG_GRAYSCALE) {
+            uint8_t g = imageInfo.m_pMCUBufG[blockOffset];
+            uint8_t b = imageInfo.m_pMCUBufB[blockOffset];
+            gray = (uint8_t)((gray * 77 + g * 150 + b * 29) >> 8);
           }
+          uint8_t dithered = config.useDithering ? applyBayerDither4Level(gray, destX, destY) : gray / 85;
+          if (dithered > 3) dithered = 3;
+          if (drawing) drawPixelWithRenderMode(renderer, destX, destY, dithered);
+          if (caching) cache.setPixel(destX, destY, dithered);
         }
-        break;
-
-      case PJPG_YH1V1:
-        for (int row = 0; row < 8; row++) {
-          int srcY = srcStartY + row;
-          int destY = config.y + (int)(srcY * scale);
-          if (destY >= screenHeight || destY >= config.y + destHeight) continue;
-          for (int col = 0; col < 8; col++) {
-            int srcX = srcStartX + col;
-            int destX = config.x + (int)(srcX * scale);
-            if (destX >= screenWidth || destX >= config.x + destWidth) continue;
-            uint8_t r = imageInfo.m_pMCUBufR[row * 8 + col];
-            uint8_t g = imageInfo.m_pMCUBufG[row * 8 + col];
-            uint8_t b = imageInfo.m_pMCUBufB[row * 8 + col];
-            uint8_t gray = (uint8_t)((r * 77 + g * 150 + b * 29) >> 8);
-            uint8_t dithered = config.useDithering ? applyBayerDither4Level(gray, destX, destY) : gray / 85;
-            if (dithered > 3) dithered = 3;
-            drawPixelWithRenderMode(renderer, destX, destY, dithered);
-            if (caching) cache.setPixel(destX, destY, dithered);
+      }
+    } else {
+      switch (imageInfo.m_scanType) {
+        case PJPG_GRAYSCALE:
+          for (int row = 0; row < 8; row++) {
+            int srcY = srcStartY + row;
+            int destY = config.y + (int)(srcY * scale);
+            if (destY >= screenHeight || destY >= config.y + destHeight) continue;
+            for (int col = 0; col < 8; col++) {
+              int srcX = srcStartX + col;
+              int destX = config.x + (int)(srcX * scale);
+              if (destX >= screenWidth || destX >= config.x + destWidth) continue;
+              uint8_t gray = imageInfo.m_pMCUBufR[row * 8 + col];
+              uint8_t dithered = config.useDithering ? applyBayerDither4Level(gray, destX, destY) : gray / 85;
+              if (dithered > 3) dithered = 3;
+              if (drawing) drawPixelWithRenderMode(renderer, destX, destY, dithered);
+              if (caching) cache.setPixel(destX, destY, dithered);
+            }
           }
-        }
-        break;
-
-      case PJPG_YH2V1:
-        for (int row = 0; row < 8; row++) {
-          int srcY = srcStartY + row;
-          int destY = config.y + (int)(srcY * scale);
-          if (destY >= screenHeight || destY >= config.y + destHeight) continue;
-          for (int col = 0; col < 16; col++) {
-            int srcX = srcStartX + col;
-            int destX = config.x + (int)(srcX * scale);
-            if (destX >= screenWidth || destX >= config.x + destWidth) continue;
-            int blockIndex = (col < 8) ? 0 : 1;
-            int pixelIndex = row * 8 + (col % 8);
-            uint8_t r = imageInfo.m_pMCUBufR[blockIndex * 64 + pixelIndex];
-            uint8_t g = imageInfo.m_pMCUBufG[blockIndex * 64 + pixelIndex];
-            uint8_t b = imageInfo.m_pMCUBufB[blockIndex * 64 + pixelIndex];
-            uint8_t gray = (uint8_t)((r * 77 + g * 150 + b * 29) >> 8);
-            uint8_t dithered = config.useDithering ? applyBayerDither4Level(gray, destX, destY) : gray / 85;
-            if (dithered > 3) dithered = 3;
-            drawPixelWithRenderMode(renderer, destX, destY, dithered);
-            if (caching) cache.setPixel(destX, destY, dithered);
+          break;
+
+        case PJPG_YH1V1:
+          for (int row = 0; row < 8; row++) {
+            int srcY = srcStartY + row;
+            int destY = config.y + (int)(srcY * scale);
+            if (destY >= screenHeight || destY >= config.y + destHeight) continue;
+            for (int col = 0; col < 8; col++) {
+              int srcX = srcStartX + col;
+              int destX = config.x + (int)(srcX * scale);
+              if (destX >= screenWidth || destX >= config.x + destWidth) continue;
+              uint8_t r = imageInfo.m_pMCUBufR[row * 8 + col];
+              uint8_t g = imageInfo.m_pMCUBufG[row * 8 + col];
+              uint8_t b = imageInfo.m_pMCUBufB[row * 8 + col];
+              uint8_t gray = (uint8_t)((r * 77 + g * 150 + b * 29) >> 8);
+              uint8_t dithered = config.useDithering ? applyBayerDither4Level(gray, destX, destY) : gray / 85;
+              if (dithered > 3) dithered = 3;
+              if (drawing) drawPixelWithRenderMode(renderer, destX, destY, dithered);
+              if (caching) cache.setPixel(destX, destY, dithered);
+            }
           }
-        }
-        break;
-
-      case PJPG_YH1V2:
-        for (int row = 0; row < 16; row++) {
-          int srcY = srcStartY + row;
-          int destY = config.y + (int)(srcY * scale);
-          if (destY >= screenHeight || destY >= config.y + destHeight) continue;
-          for (int col = 0; col < 8; col++) {
-            int srcX = srcStartX + col;
-            int destX = config.x + (int)(srcX * scale);
-            if (destX >= screenWidth || destX >= config.x + destWidth) continue;
-            int blockIndex = (row < 8) ? 0 : 1;
-            int pixelIndex = (row % 8) * 8 + col;
-            uint8_t r = imageInfo.m_pMCUBufR[blockIndex * 128 + pixelIndex];
-            uint8_t g = imageInfo.m_pMCUBufG[blockIndex * 128 + pixelIndex];
-            uint8_t b = imageInfo.m_pMCUBufB[blockIndex * 128 + pixelIndex];
-            uint8_t gray = (uint8_t)((r * 77 + g * 150 + b * 29) >> 8);
-            uint8_t dithered = config.useDithering ? applyBayerDither4Level(gray, destX, destY) : gray / 85;
-            if (dithered > 3) dithered = 3;
-            drawPixelWithRenderMode(renderer, destX, destY, dithered);
-            if (caching) cache.setPixel(destX, destY, dithered);
+          break;
+
+        case PJPG_YH2V1:
+          for (int row = 0; row < 8; row++) {
+            int srcY = srcStartY + row;
+            int destY = config.y + (int)(srcY * scale);
+            if (destY >= screenHeight || destY >= config.y + destHeight) continue;
+            for (int col = 0; col < 16; col++) {
+              int srcX = srcStartX + col;
+              int destX = config.x + (int)(srcX * scale);
+              if (destX >= screenWidth || destX >= config.x + destWidth) continue;
+              int blockIndex = (col < 8) ? 0 : 1;
+              int pixelIndex = row * 8 + (col % 8);
+              uint8_t r = imageInfo.m_pMCUBufR[blockIndex * 64 + pixelIndex];
+              uint8_t g = imageInfo.m_pMCUBufG[blockIndex * 64 + pixelIndex];
+              uint8_t b = imageInfo.m_pMCUBufB[blockIndex * 64 + pixelIndex];
+              uint8_t gray = (uint8_t)((r * 77 + g * 150 + b * 29) >> 8);
+              uint8_t dithered = config.useDithering ? applyBayerDither4Level(gray, destX, destY) : gray / 85;
+              if (dithered > 3) dithered = 3;
+              if (drawing) drawPixelWithRenderMode(renderer, destX, destY, dithered);
+              if (caching) cache.setPixel(destX, destY, dithered);
+            }
           }
-        }
-        break;
-
-      case PJPG_YH2V2:
-        for (int row = 0; row < 16; row++) {
-          int srcY = srcStartY + row;
-          int destY = config.y + (int)(srcY * scale);
-          if (destY >= screenHeight || destY >= config.y + destHeight) continue;
-          for (int col = 0; col < 16; col++) {
-            int srcX = srcStartX + col;
-            int destX = config.x + (int)(srcX * scale);
-            if (destX >= screenWidth || destX >= config.x + destWidth) continue;
-            int blockX = (col < 8) ? 0 : 1;
-            int blockY = (row < 8) ? 0 : 1;
-            int blockIndex = blockY * 2 + blockX;
-            int pixelIndex = (row % 8) * 8 + (col % 8);
-            int blockOffset = blockIndex * 64;
-            uint8_t r = imageInfo.m_pMCUBufR[blockOffset + pixelIndex];
-            uint8_t g = imageInfo.m_pMCUBufG[blockOffset + pixelIndex];
-            uint8_t b = imageInfo.m_pMCUBufB[blockOffset + pixelIndex];
-            uint8_t gray = (uint8_t)((r * 77 + g * 150 + b * 29) >> 8);
-            uint8_t dithered = config.useDithering ? applyBayerDither4Level(gray, destX, destY) : gray / 85;
-            if (dithered > 3) dithered = 3;
-            drawPixelWithRenderMode(renderer, destX, destY, dithered);
-            if (caching) cache.setPixel(destX, destY, dithered);
+          break;
+
+        case PJPG_YH1V2:
+          for (int row = 0; row < 16; row++) {
+            int srcY = srcStartY + row;
+            int destY = config.y + (int)(srcY * scale);
+            if (destY >= screenHeight || destY >= config.y + destHeight) continue;
+            for (int col = 0; col < 8; col++) {
+              int srcX = srcStartX + col;
+              int destX = config.x + (int)(srcX * scale);
+              if (destX >= screenWidth || destX >= config.x + destWidth) continue;
+              int blockIndex = (row < 8) ? 0 : 1;
+              int pixelIndex = (row % 8) * 8 + col;
+              uint8_t r = imageInfo.m_pMCUBufR[blockIndex * 128 + pixelIndex];
+              uint8_t g = imageInfo.m_pMCUBufG[blockIndex * 128 + pixelIndex];
+              uint8_t b = imageInfo.m_pMCUBufB[blockIndex * 128 + pixelIndex];
+              uint8_t gray = (uint8_t)((r * 77 + g * 150 + b * 29) >> 8);
+              uint8_t dithered = config.useDithering ? applyBayerDither4Level(gray, destX, destY) : gray / 85;
+              if (dithered > 3) dithered = 3;
+              if (drawing) drawPixelWithRenderMode(renderer, destX, destY, dithered);
+              if (caching) cache.setPixel(destX, destY, dithered);
+            }
           }
-        }
-        break;
+          break;
+
+        case PJPG_YH2V2:
+          for (int row = 0; row < 16; row++) {
+            int srcY = srcStartY + row;
+            int destY = config.y + (int)(srcY * scale);
+            if (destY >= screenHeight || destY >= config.y + destHeight) continue;
+            for (int col = 0; col < 16; col++) {
+              int srcX = srcStartX + col;
+              int destX = config.x + (int)(srcX * scale);
+              if (destX >= screenWidth || destX >= config.x + destWidth) continue;
+              int blockX = (col < 8) ? 0 : 1;
+              int blockY = (row < 8) ? 0 : 1;
+              int blockIndex = blockY * 2 + blockX;
+              int pixelIndex = (row % 8) * 8 + (col % 8);
+              int blockOffset = blockIndex * 64;
+              uint8_t r = imageInfo.m_pMCUBufR[blockOffset + pixelIndex];
+              uint8_t g = imageInfo.m_pMCUBufG[blockOffset + pixelIndex];
+              uint8_t b = imageInfo.m_pMCUBufB[blockOffset + pixelIndex];
+              uint8_t gray = (uint8_t)((r * 77 + g * 150 + b * 29) >> 8);
+              uint8_t dithered = config.useDithering ? applyBayerDither4Level(gray, destX, destY) : gray / 85;
+              if (dithered > 3) dithered = 3;
+              if (drawing) drawPixelWithRenderMode(renderer, destX, destY, dithered);
+              if (caching) cache.setPixel(destX, destY, dithered);
+            }
+          }
+          break;
+      }
     }
 
     mcuX++;
     if (mcuX >= imageInfo.m_MCUSPerRow) {
       mcuX = 0;
       mcuY++;
+      if (config.cancelled && config.cancelled()) {
+        LOG_DBG("JPG", "Decode cancelled at MCU row %d", mcuY);
+        file.close();
+        return false;
+      }
     }
   }
 
   LOG_DBG("JPG", "Decoding complete");
   file.close();
 
-  // Write cache file if caching was enabled
+  // Complete the cache file if caching was enabled
   if (caching) {
-    cache.writeToFile(config.cachePath);
+    if (!cache.finish() && config.cacheOnly) {
+      return false;
+    }
   }
 
   return true;
@@ -0,0 +1,269 @@
+#include "PixelCache.h"
+
+#include <GfxRenderer.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+constexpr char PIXEL_CACHE_MAGIC[4] = {'P', 'X', 'C', '2'};
+constexpr int HEADER_SIZE = 8;
+constexpr int MAX_RUN = 128;
+
+// Literal runs are broken for three or more equal bytes, shorter repeats cost as much as they save
+size_t packBits(const uint8_t* data, const int size, uint8_t* out) {
+  size_t outSize = 0;
+  int i = 0;
+  while (i < size) {
+    int run = 1;
+    while (i + run < size && run < MAX_RUN && data[i + run] == data[i]) run++;
+    if (run >= 3) {
+      out[outSize++] = static_cast<uint8_t>(257 - run);
+      out[outSize++] = data[i];
+      i += run;
+      continue;
+    }
+
+    const int start = i;
+    while (i < size && i - start < MAX_RUN &&
+           !(i + 2 < size && data[i] == data[i + 1] && data[i] == data[i + 2])) {
+      i++;
+    }
+    out[outSize++] = static_cast<uint8_t>(i - start - 1);
+    memcpy(out + outSize, data + start, i - start);
+    outSize += i - start;
+  }
+  return outSize;
+}
+
+// Buffered reads of the PackBits stream, rows are a few dozen bytes and would otherwise cost a card read each
+class PackBitsReader {
+ public:
+  explicit PackBitsReader(FsFile& file) : file(file) {}
+
+  bool readRow(uint8_t* row, const int size) {
+    int pos = 0;
+    while (pos < size) {
+      uint8_t header;
+      if (!read(&header, 1)) return false;
+      if (header < 128) {
+        const int count = header + 1;
+        if (pos + count > size || !read(row + pos, count)) return false;
+        pos += count;
+      } else if (header > 128) {
+        const int count = 257 - header;
+        uint8_t value;
+        if (pos + count > size || !read(&value, 1)) return false;
+        memset(row + pos, value, count);
+        pos += count;
+      }
+    }
+    return true;
+  }
+
+ private:
+  FsFile& file;
+  uint8_t buffer[512];
+  int bufferPos = 0;
+  int bufferFilled = 0;
+
+  bool read(uint8_t* out, int count) {
+    while (count > 0) {
+      if (bufferPos >= bufferFilled) {
+        bufferFilled = file.read(buffer, sizeof(buffer));
+        bufferPos = 0;
+        if (bufferFilled <= 0) return false;
+      }
+      const int chunk = std::min(count, bufferFilled - bufferPos);
+      memcpy(out, buffer + bufferPos, chunk);
+      bufferPos += chunk;
+      out += chunk;
+      count -= chunk;
+    }
+    return true;
+  }
+};
+}  // namespace
+
+PixelCache::~PixelCache() {
+  if (band) {
+    // Never finished, e.g. the decode failed
+    abort();
+  }
+}
+
+bool PixelCache::begin(const std::string& cachePath, const int w, const int h, const int ox, const int oy,
+                       const int rows) {
+  path = cachePath;
+  width = w;
+  height = h;
+  originX = ox;
+  originY = oy;
+  bytesPerRow = (w + 3) / 4;  // 2 bits per pixel, 4 pixels per byte
+  bandRows = std::max(1, std::min(rows, h));
+  firstBandRow = 0;
+  currentRow = -1;
+  failed = false;
+
+  const size_t bandSize = static_cast<size_t>(bytesPerRow) * bandRows;
+  band = static_cast<uint8_t*>(malloc(bandSize));
+  encoded = static_cast<uint8_t*>(malloc(bytesPerRow + (bytesPerRow + MAX_RUN - 1) / MAX_RUN));
+  if (!band || !encoded) {
+    LOG_ERR("IMG", "Failed to allocate cache band: %d bytes for %dx%d", bandSize, w, h);
+    abort();
+    return false;
+  }
+  // Pixels a decoder never writes (such as rows skipped when scaling down) are left white, as when drawing directly
+  memset(band, 0xFF, bandSize);
+
+  if (!Storage.openFileForWrite("IMG", path, file)) {
+    LOG_ERR("IMG", "Failed to open cache file for writing: %s", path.c_str());
+    abort();
+    return false;
+  }
+
+  // The magic stays zero until the file is complete
+  uint8_t header[HEADER_SIZE] = {};
+  const uint16_t dimensions[2] = {static_cast<uint16_t>(w), static_cast<uint16_t>(h)};
+  memcpy(header + sizeof(PIXEL_CACHE_MAGIC), dimensions, sizeof(dimensions));
+  if (file.write(header, HEADER_SIZE) != HEADER_SIZE) {
+    LOG_ERR("IMG", "Failed to write cache header: %s", path.c_str());
+    abort();
+    return false;
+  }
+
+  LOG_DBG("IMG", "Caching %dx%d in a band of %d rows (%d bytes)", w, h, bandRows, bandSize);
+  return true;
+}
+
+bool PixelCache::selectRow(const int localY) {
+  if (failed) return false;
+  if (localY < firstBandRow) {
+    LOG_ERR("IMG", "Cache row %d was already written, band of %d rows is too small", localY, bandRows);
+    failed = true;
+    return false;
+  }
+  if (localY >= firstBandRow + bandRows && !writeRows(localY - bandRows + 1)) {
+    return false;
+  }
+  currentRow = localY;
+  currentRowData = band + (localY % bandRows) * bytesPerRow;
+  return true;
+}
+
+bool PixelCache::writeRows(const int endRow) {
+  currentRow = -1;
+  for (int row = firstBandRow; row < endRow; row++) {
+    uint8_t* rowData = band + (row % bandRows) * bytesPerRow;
+    const size_t size = packBits(rowData, bytesPerRow, encoded);
+    if (file.write(encoded, size) != size) {
+      LOG_ERR("IMG", "Cache write error at row %d", row);
+      failed = true;
+      return false;
+    }
+    memset(rowData, 0xFF, bytesPerRow);
+  }
+  firstBandRow = endRow;
+  return true;
+}
+
+bool PixelCache::finish() {
+  if (!band) return false;
+
+  if (failed || !writeRows(height)) {
+    abort();
+    return false;
+  }
+  LOG_DBG("IMG", "Cache written: %s (%dx%d, %d bytes, %d unpacked)", path.c_str(), width, height,
+          static_cast<int>(file.position()), HEADER_SIZE + bytesPerRow * height);
+  if (!file.seek(0) || file.write(PIXEL_CACHE_MAGIC, sizeof(PIXEL_CACHE_MAGIC)) != sizeof(PIXEL_CACHE_MAGIC)) {
+    LOG_ERR("IMG", "Failed to complete cache file: %s", path.c_str());
+    abort();
+    return false;
+  }
+  file.close();
+  free(band);
+  free(encoded);
+  band = nullptr;
+  encoded = nullptr;
+  return true;
+}
+
+void PixelCache::abort() {
+  if (file) {
+    file.close();
+    Storage.remove(path.c_str());
+  }
+  free(band);
+  free(encoded);
+  band = nullptr;
+  encoded = nullptr;
+}
+
+bool PixelCache::render(GfxRenderer& renderer, const std::string& path, const int x, const int y,
+                        const int expectedWidth, const int expectedHeight) {
+  FsFile cacheFile;
+  if (!Storage.openFileForRead("IMG", path, cacheFile)) {
+    return false;
+  }
+
+  uint8_t header[HEADER_SIZE];
+  if (cacheFile.read(header, HEADER_SIZE) != HEADER_SIZE ||
+      memcmp(header, PIXEL_CACHE_MAGIC, sizeof(PIXEL_CACHE_MAGIC)) != 0) {
+    // Incomplete, or written by an older version
+    LOG_DBG("IMG", "Ignoring invalid cache file: %s", path.c_str());
+    cacheFile.close();
+    return false;
+  }
+  uint16_t dimensions[2];
+  memcpy(dimensions, header + sizeof(PIXEL_CACHE_MAGIC), sizeof(dimensions));
+  const int cachedWidth = dimensions[0];
+  const int cachedHeight = dimensions[1];
+
+  // Verify dimensions are close (allow 1 pixel tolerance for rounding differences)
+  if (abs(cachedWidth - expectedWidth) > 1 || abs(cachedHeight - expectedHeight) > 1) {
+    LOG_ERR("IMG", "Cache dimension mismatch: %dx%d vs %dx%d", cachedWidth, cachedHeight, expectedWidth,
+            expectedHeight);
+    cacheFile.close();
+    return false;
+  }
+
+  LOG_DBG("IMG", "Loading from cache: %s (%dx%d)", path.c_str(), cachedWidth, cachedHeight);
+
+  // Decode and draw a band of rows at a time, aligned to the 8 screen rows drawImage2Bit writes together
+  constexpr int BAND_ROWS = 8;
+  const int bytesPerRow = (cachedWidth + 3) / 4;
+  uint8_t* rowBuffer = static_cast<uint8_t*>(malloc(BAND_ROWS * bytesPerRow));
+  if (!rowBuffer) {
+    LOG_ERR("IMG", "Failed to allocate row buffer");
+    cacheFile.close();
+    return false;
+  }
+
+  PackBitsReader reader(cacheFile);
+  bool ok = true;
+  for (int bandStart = 0; ok && bandStart < cachedHeight;) {
+    const int screenY = y + bandStart;
+    const int rows = std::min(cachedHeight - bandStart, BAND_ROWS - ((screenY % BAND_ROWS) + BAND_ROWS) % BAND_ROWS);
+    for (int row = 0; row < rows; row++) {
+      if (!reader.readRow(rowBuffer + row * bytesPerRow, bytesPerRow)) {
+        LOG_ERR("IMG", "Cache read error at row %d", bandStart + row);
+        ok = false;
+        break;
+      }
+    }
+    if (ok) {
+      renderer.drawImage2Bit(rowBuffer, x, screenY, cachedWidth, rows);
+    }
+    bandStart += rows;
+  }
+
+  free(rowBuffer);
+  cacheFile.close();
+  if (ok) {
+    LOG_DBG("IMG", "Cache render complete");
+  }
+  return ok;
+}
@@ -1,82 +1,68 @@
 #pragma once
 
 #include <HalStorage.h>
-#include <Logging.h>
 #include <stdint.h>
 
-#include <cstring>
 #include <string>
 
-// Cache buffer for storing 2-bit pixels (4 levels) during decode.
-// Packs 4 pixels per byte, MSB first.
-struct PixelCache {
-  uint8_t* buffer;
-  int width;
-  int height;
-  int bytesPerRow;
-  int originX;  // config.x - to convert screen coords to cache coords
-  int originY;  // config.y
+class GfxRenderer;
 
-  PixelCache() : buffer(nullptr), width(0), height(0), bytesPerRow(0), originX(0), originY(0) {}
+// Cache file of a decoded image at its display size (.pxc), so the page can be redrawn without decoding again.
+//
+// Cache file format:
+// - char magic[4] "PXC2", written last so an interrupted write leaves an invalid file
+// - uint16_t width
+// - uint16_t height
+// - rows of 2-bit pixels (4 pixels per byte, MSB first), each PackBits encoded on its own: a header byte n of
+//   0-127 is followed by n + 1 literal bytes, 129-255 by one byte repeated 257 - n times
+//
+// While decoding, the pixels are kept in a band of rows that is written out as the decoder moves down the image,
+// so an image of any size only needs a few rows of memory.
+struct PixelCache {
+  PixelCache() = default;
   PixelCache(const PixelCache&) = delete;
   PixelCache& operator=(const PixelCache&) = delete;
+  ~PixelCache();
 
-  static constexpr size_t MAX_CACHE_BYTES = 256 * 1024;  // 256KB limit for embedded targets
-
-  bool allocate(int w, int h, int ox, int oy) {
-    width = w;
-    height = h;
-    originX = ox;
-    originY = oy;
-    bytesPerRow = (w + 3) / 4;  // 2 bits per pixel, 4 pixels per byte
-    size_t bufferSize = (size_t)bytesPerRow * h;
-    if (bufferSize > MAX_CACHE_BYTES) {
-      LOG_ERR("IMG", "Cache buffer too large: %d bytes for %dx%d (limit %d)", bufferSize, w, h, MAX_CACHE_BYTES);
-      return false;
-    }
-    buffer = (uint8_t*)malloc(bufferSize);
-    if (buffer) {
-      memset(buffer, 0, bufferSize);
-      LOG_DBG("IMG", "Allocated cache buffer: %d bytes for %dx%d", bufferSize, w, h);
-    }
-    return buffer != nullptr;
-  }
+  // Decoders write rows from top to bottom, but may have up to `bandRows` rows in progress at a time (such as the
+  // rows of one JPEG MCU row). originX/Y are config.x/y, to convert screen coords to cache coords.
+  bool begin(const std::string& path, int w, int h, int ox, int oy, int bandRows);
 
   void setPixel(int screenX, int screenY, uint8_t value) {
-    if (!buffer) return;
-    int localX = screenX - originX;
-    int localY = screenY - originY;
+    const int localX = screenX - originX;
+    const int localY = screenY - originY;
     if (localX < 0 || localX >= width || localY < 0 || localY >= height) return;
+    if (localY != currentRow && !selectRow(localY)) return;
 
-    int byteIdx = localY * bytesPerRow + localX / 4;
-    int bitShift = 6 - (localX % 4) * 2;  // MSB first: pixel 0 at bits 6-7
-    buffer[byteIdx] = (buffer[byteIdx] & ~(0x03 << bitShift)) | ((value & 0x03) << bitShift);
+    const int bitShift = 6 - (localX % 4) * 2;  // MSB first: pixel 0 at bits 6-7
+    uint8_t& byte = currentRowData[localX / 4];
+    byte = (byte & ~(0x03 << bitShift)) | ((value & 0x03) << bitShift);
   }
 
-  bool writeToFile(const std::string& cachePath) {
-    if (!buffer) return false;
+  // Writes the remaining rows and completes the file, which is removed if anything went wrong
+  bool finish();
 
-    FsFile cacheFile;
-    if (!Storage.openFileForWrite("IMG", cachePath, cacheFile)) {
-      LOG_ERR("IMG", "Failed to open cache file for writing: %s", cachePath.c_str());
-      return false;
-    }
+  // Draws a cache file at (x, y) if it holds an image of about the expected size
+  static bool render(GfxRenderer& renderer, const std::string& path, int x, int y, int expectedWidth,
+                     int expectedHeight);
 
-    uint16_t w = width;
-    uint16_t h = height;
-    cacheFile.write(&w, 2);
-    cacheFile.write(&h, 2);
-    cacheFile.write(buffer, bytesPerRow * height);
-    cacheFile.close();
+ private:
+  FsFile file;
+  std::string path;
+  uint8_t* band = nullptr;     // bandRows rows, row y is at (y % bandRows)
+  uint8_t* encoded = nullptr;  // One PackBits encoded row
+  int width = 0;
+  int height = 0;
+  int bytesPerRow = 0;
+  int bandRows = 0;
+  int originX = 0;
+  int originY = 0;
+  int firstBandRow = 0;  // Rows above have been written to the file
+  int currentRow = -1;
+  uint8_t* currentRowData = nullptr;
+  bool failed = false;
 
-    LOG_DBG("IMG", "Cache written: %s (%dx%d, %d bytes)", cachePath.c_str(), width, height, 4 + bytesPerRow * height);
-    return true;
-  }
-
-  ~PixelCache() {
-    if (buffer) {
-      free(buffer);
-      buffer = nullptr;
-    }
-  }
+  bool selectRow(int localY);
+  bool writeRows(int endRow);
+  void abort();
 };
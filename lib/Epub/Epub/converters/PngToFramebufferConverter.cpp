@@ -33,6 +33,7 @@ struct PngContext {
 
   PixelCache cache;
   bool caching;
+  bool cancelled;  // config->cancelled() returned true and the draw callback stopped the decode
 
   uint8_t* grayLineBuffer;
 
@@ -48,6 +49,7 @@ struct PngContext {
         dstHeight(0),
         lastDstY(-1),
         caching(false),
+        cancelled(false),
         grayLineBuffer(nullptr) {}
 };
 
@@ -179,6 +181,10 @@ void convertLineToGray(uint8_t* pPixels, uint8_t* grayLine, int width, int pixel
 int pngDrawCallback(PNGDRAW* pDraw) {
   PngContext* ctx = reinterpret_cast<PngContext*>(pDraw->pUser);
   if (!ctx || !ctx->config || !ctx->renderer || !ctx->grayLineBuffer) return 0;
+  if (ctx->config->cancelled && ctx->config->cancelled()) {
+    ctx->cancelled = true;
+    return 0;
+  }
 
   int srcY = pDraw->y;
   int srcWidth = ctx->srcWidth;
@@ -206,6 +212,7 @@ int pngDrawCallback(PNGDRAW* pDraw) {
   int screenWidth = ctx->screenWidth;
   bool useDithering = ctx->config->useDithering;
   bool caching = ctx->caching;
+  bool drawing = !ctx->config->cacheOnly;
 
   int srcX = 0;
   int error = 0;
@@ -222,7 +229,7 @@ int pngDrawCallback(PNGDRAW* pDraw) {
         ditheredGray = gray / 85;
         if (ditheredGray > 3) ditheredGray = 3;
       }
-      drawPixelWithRenderMode(*ctx->renderer, outX, outY, ditheredGray);
+      if (drawing) drawPixelWithRenderMode(*ctx->renderer, outX, outY, ditheredGray);
       if (caching) ctx->cache.setPixel(outX, outY, ditheredGray);
     }
 
@@ -274,6 +281,11 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
   LOG_DBG("PNG", "Decoding PNG: %s", imagePath.c_str());
 
   size_t freeHeap = ESP.getFreeHeap();
+  if (freeHeap < MIN_FREE_HEAP_FOR_PNG) {
+    // Cached font groups are the cheapest memory to give back, they are inflated again on demand
+    renderer.clearFontCache();
+    freeHeap = ESP.getFreeHeap();
+  }
   if (freeHeap < MIN_FREE_HEAP_FOR_PNG) {
     LOG_ERR("PNG", "Not enough heap for PNG decoder (%u free, need %u)", freeHeap, MIN_FREE_HEAP_FOR_PNG);
     return false;
@@ -356,11 +368,18 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
     return false;
   }
 
-  // Allocate cache buffer using SCALED dimensions
+  // Start the cache using SCALED dimensions, rows are drawn one at a time from top to bottom
   ctx.caching = !config.cachePath.empty();
   if (ctx.caching) {
-    if (!ctx.cache.allocate(ctx.dstWidth, ctx.dstHeight, config.x, config.y)) {
-      LOG_ERR("PNG", "Failed to allocate cache buffer, continuing without caching");
+    if (!ctx.cache.begin(config.cachePath, ctx.dstWidth, ctx.dstHeight, config.x, config.y, 1)) {
+      if (config.cacheOnly) {
+        LOG_ERR("PNG", "Failed to start pixel cache");
+        free(ctx.grayLineBuffer);
+        png->close();
+        delete png;
+        return false;
+      }
+      LOG_ERR("PNG", "Failed to start pixel cache, continuing without caching");
       ctx.caching = false;
     }
   }
@@ -372,6 +391,13 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
   free(ctx.grayLineBuffer);
   ctx.grayLineBuffer = nullptr;
 
+  if (ctx.cancelled) {
+    LOG_DBG("PNG", "Decode cancelled at row %d", ctx.lastDstY);
+    png->close();
+    delete png;
+    return false;
+  }
+
   if (rc != PNG_SUCCESS) {
     LOG_ERR("PNG", "Decode failed: %d", rc);
     png->close();
@@ -383,9 +409,11 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
   delete png;
   LOG_DBG("PNG", "PNG decoding complete - render time: %lu ms", decodeTime);
 
-  // Write cache file if caching was enabled and buffer was allocated
+  // Complete the cache file if caching was enabled
   if (ctx.caching) {
-    ctx.cache.writeToFile(config.cachePath);
+    if (!ctx.cache.finish() && config.cacheOnly) {
+      return false;
+    }
   }
 
   return true;
@@ -4,12 +4,13 @@
 #include <GfxRenderer.h>
 #include <HalStorage.h>
 #include <Logging.h>
+#include <ZipFile.h>
 #include <expat.h>
 
 #include "../../Epub.h"
 #include "../Page.h"
 #include "../converters/ImageDecoderFactory.h"
-#include "../converters/ImageToFramebufferDecoder.h"
+#include "../converters/ImageDimensionsParser.h"
 #include "../htmlEntities.h"
 
 const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
@@ -57,6 +58,52 @@ bool isTableStructuralTag(const char* name) {
   return strcmp(name, "table") == 0 || strcmp(name, "tr") == 0 || strcmp(name, "td") == 0 || strcmp(name, "th") == 0;
 }
 
+std::string ChapterHtmlSlimParser::claimImageCachePath(const std::string& itemPath, const std::string& ext) const {
+  // Images are named by a 64-bit FNV-1a hash of their zip path. A <name>.src sidecar records the path that owns the
+  // name, so a hash collision moves on to a suffixed name instead of rendering another image's cached pixels.
+  constexpr int MAX_COLLISION_SUFFIX = 8;
+  char name[24];
+  const uint64_t hash = ZipFile::fnvHash64(itemPath.c_str(), itemPath.size());
+
+  for (int suffix = 0; suffix < MAX_COLLISION_SUFFIX; suffix++) {
+    if (suffix == 0) {
+      snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(hash));
+    } else {
+      snprintf(name, sizeof(name), "%016llx_%d", static_cast<unsigned long long>(hash), suffix);
+    }
+    const std::string basePath = imageBasePath + name;
+    const std::string srcPath = basePath + ".src";
+
+    FsFile srcFile;
+    if (!Storage.exists(srcPath.c_str())) {
+      if (!Storage.openFileForWrite("EHP", srcPath, srcFile)) {
+        return "";
+      }
+      srcFile.write(reinterpret_cast<const uint8_t*>(itemPath.data()), itemPath.size());
+      srcFile.close();
+      return basePath + ext;
+    }
+
+    if (!Storage.openFileForRead("EHP", srcPath, srcFile)) {
+      return "";
+    }
+    bool owned = false;
+    if (srcFile.size() == itemPath.size()) {
+      std::string owner(itemPath.size(), '\0');
+      owned = srcFile.read(reinterpret_cast<uint8_t*>(&owner[0]), owner.size()) == static_cast<int>(owner.size()) &&
+              owner == itemPath;
+    }
+    srcFile.close();
+    if (owned) {
+      return basePath + ext;
+    }
+    LOG_DBG("EHP", "Image cache name %s already belongs to another image", name);
+  }
+
+  LOG_ERR("EHP", "No free image cache name for %s", itemPath.c_str());
+  return "";
+}
+
 // Update effective bold/italic/underline based on block style and inline style stack
 void ChapterHtmlSlimParser::updateEffectiveInlineStyle() {
   // Start with block-level styles
@@ -232,86 +279,77 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
           std::string resolvedPath = FsHelpers::normalisePath(self->contentBase + src);
 
           if (ImageDecoderFactory::isFormatSupported(resolvedPath)) {
-            // Create a unique filename for the cached image
+            // Key the cached image by its zip entry path so images shared between chapters are only extracted once
             std::string ext;
             size_t extPos = resolvedPath.rfind('.');
             if (extPos != std::string::npos) {
               ext = resolvedPath.substr(extPos);
             }
-            std::string cachedImagePath = self->imageBasePath + std::to_string(self->imageCounter++) + ext;
-
-            // Extract image to cache file
-            FsFile cachedImageFile;
-            bool extractSuccess = false;
-            if (Storage.openFileForWrite("EHP", cachedImagePath, cachedImageFile)) {
-              extractSuccess = self->epub->readItemContentsToStream(resolvedPath, cachedImageFile, 4096);
-              cachedImageFile.flush();
-              cachedImageFile.close();
-              delay(50);  // Give SD card time to sync
+            std::string cachedImagePath = self->claimImageCachePath(resolvedPath, ext);
+
+            // Only read far enough into the image to get its size. Extracting and decoding is deferred until the
+            // page is first shown (or prefetched), so indexing time doesn't depend on the number of images.
+            // Without a cache file the image can't be shown, so fall back to its alt text.
+            ImageDimensionsParser dimensionsParser;
+            if (!cachedImagePath.empty()) {
+              self->epub->readItemContentsToStream(resolvedPath, dimensionsParser, 512);
             }
-
-            if (extractSuccess) {
-              // Get image dimensions
-              ImageDimensions dims = {0, 0};
-              ImageToFramebufferDecoder* decoder = ImageDecoderFactory::getDecoder(cachedImagePath);
-              if (decoder && decoder->getDimensions(cachedImagePath, dims)) {
-                LOG_DBG("EHP", "Image dimensions: %dx%d", dims.width, dims.height);
-
-                // Scale to fit viewport while maintaining aspect ratio
-                int maxWidth = self->viewportWidth;
-                int maxHeight = self->viewportHeight;
-                float scaleX = (dims.width > maxWidth) ? (float)maxWidth / dims.width : 1.0f;
-                float scaleY = (dims.height > maxHeight) ? (float)maxHeight / dims.height : 1.0f;
-                float scale = (scaleX < scaleY) ? scaleX : scaleY;
-                if (scale > 1.0f) scale = 1.0f;
-
-                int displayWidth = (int)(dims.width * scale);
-                int displayHeight = (int)(dims.height * scale);
-
-                LOG_DBG("EHP", "Display size: %dx%d (scale %.2f)", displayWidth, displayHeight, scale);
-
-                // Create page for image - only break if image won't fit remaining space
-                if (self->currentPage && !self->currentPage->elements.empty() &&
-                    (self->currentPageNextY + displayHeight > self->viewportHeight)) {
-                  self->completePageFn(std::move(self->currentPage));
-                  self->currentPage.reset(new Page());
-                  if (!self->currentPage) {
-                    LOG_ERR("EHP", "Failed to create new page");
-                    return;
-                  }
-                  self->currentPageNextY = 0;
-                } else if (!self->currentPage) {
-                  self->currentPage.reset(new Page());
-                  if (!self->currentPage) {
-                    LOG_ERR("EHP", "Failed to create initial page");
-                    return;
-                  }
-                  self->currentPageNextY = 0;
-                }
-
-                // Create ImageBlock and add to page
-                auto imageBlock = std::make_shared<ImageBlock>(cachedImagePath, displayWidth, displayHeight);
-                if (!imageBlock) {
-                  LOG_ERR("EHP", "Failed to create ImageBlock");
+            ImageDimensions dims = {0, 0};
+            if (dimensionsParser.getDimensions(dims)) {
+              LOG_DBG("EHP", "Image dimensions: %dx%d", dims.width, dims.height);
+
+              // Scale to fit viewport while maintaining aspect ratio
+              int maxWidth = self->viewportWidth;
+              int maxHeight = self->viewportHeight;
+              float scaleX = (dims.width > maxWidth) ? (float)maxWidth / dims.width : 1.0f;
+              float scaleY = (dims.height > maxHeight) ? (float)maxHeight / dims.height : 1.0f;
+              float scale = (scaleX < scaleY) ? scaleX : scaleY;
+              if (scale > 1.0f) scale = 1.0f;
+
+              int displayWidth = (int)(dims.width * scale);
+              int displayHeight = (int)(dims.height * scale);
+
+              LOG_DBG("EHP", "Display size: %dx%d (scale %.2f)", displayWidth, displayHeight, scale);
+
+              // Create page for image - only break if image won't fit remaining space
+              if (self->currentPage && !self->currentPage->elements.empty() &&
+                  (self->currentPageNextY + displayHeight > self->viewportHeight)) {
+                self->completePageFn(std::move(self->currentPage));
+                self->currentPage.reset(new Page());
+                if (!self->currentPage) {
+                  LOG_ERR("EHP", "Failed to create new page");
                   return;
                 }
-                int xPos = (self->viewportWidth - displayWidth) / 2;
-                auto pageImage = std::make_shared<PageImage>(imageBlock, xPos, self->currentPageNextY);
-                if (!pageImage) {
-                  LOG_ERR("EHP", "Failed to create PageImage");
+                self->currentPageNextY = 0;
+              } else if (!self->currentPage) {
+                self->currentPage.reset(new Page());
+                if (!self->currentPage) {
+                  LOG_ERR("EHP", "Failed to create initial page");
                   return;
                 }
-                self->currentPage->elements.push_back(pageImage);
-                self->currentPageNextY += displayHeight;
+                self->currentPageNextY = 0;
+              }
 
-                self->depth += 1;
+              // Create ImageBlock and add to page
+              auto imageBlock = std::make_shared<ImageBlock>(cachedImagePath, resolvedPath, dims.width, dims.height,
+                                                             displayWidth, displayHeight);
+              if (!imageBlock) {
+                LOG_ERR("EHP", "Failed to create ImageBlock");
                 return;
-              } else {
-                LOG_ERR("EHP", "Failed to get image dimensions");
-                Storage.remove(cachedImagePath.c_str());
               }
+              int xPos = (self->viewportWidth - displayWidth) / 2;
+              auto pageImage = std::make_shared<PageImage>(imageBlock, xPos, self->currentPageNextY);
+              if (!pageImage) {
+                LOG_ERR("EHP", "Failed to create PageImage");
+                return;
+              }
+              self->currentPage->elements.push_back(pageImage);
+              self->currentPageNextY += displayHeight;
+
+              self->depth += 1;
+              return;
             } else {
-              LOG_ERR("EHP", "Failed to extract image");
+              LOG_ERR("EHP", "Failed to get image dimensions");
             }
           }  // isFormatSupported
         }
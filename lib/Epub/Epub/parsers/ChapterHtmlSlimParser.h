@@ -47,8 +47,10 @@ class ChapterHtmlSlimParser {
   const CssParser* cssParser;
   bool embeddedStyle;
   std::string contentBase;
+  // Shared per-book image directory (with trailing slash), images are keyed by zip entry path
   std::string imageBasePath;
-  int imageCounter = 0;
+  // Cache file for the image at a zip entry path, empty if none could be claimed
+  std::string claimImageCachePath(const std::string& itemPath, const std::string& ext) const;
 
   // Style tracking (replaces depth-based approach)
   struct StyleStackEntry {
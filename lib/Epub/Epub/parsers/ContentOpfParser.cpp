@@ -33,15 +33,99 @@ ContentOpfParser::~ContentOpfParser() {
     XML_ParserFree(parser);
     parser = nullptr;
   }
-  if (tempItemStore) {
-    tempItemStore.close();
+  if (itemSpillFile) {
+    itemSpillFile.close();
   }
-  if (Storage.exists((cachePath + itemCacheFile).c_str())) {
+  if (itemsSpilled && Storage.exists((cachePath + itemCacheFile).c_str())) {
     Storage.remove((cachePath + itemCacheFile).c_str());
   }
-  itemIndex.clear();
-  itemIndex.shrink_to_fit();
-  useItemIndex = false;
+}
+
+void ContentOpfParser::storeItem(const std::string& itemId, const std::string& href) {
+  // Items are only looked up to resolve spine idrefs
+  if (!cache) {
+    return;
+  }
+
+  const auto idLen = static_cast<uint16_t>(itemId.size());
+  const auto hrefLen = static_cast<uint16_t>(href.size());
+  const size_t itemSize = sizeof(idLen) + idLen + sizeof(hrefLen) + hrefLen;
+
+  if (!itemsSpilled && itemStore.size() + itemSize > MAX_IN_MEMORY_ITEM_BYTES) {
+    if (!Storage.openFileForWrite("COF", cachePath + itemCacheFile, itemSpillFile)) {
+      LOG_ERR("COF", "Couldn't open temp items file for writing. This is probably going to be a fatal error.");
+      return;
+    }
+    itemSpillFile.write(reinterpret_cast<const uint8_t*>(itemStore.data()), itemStore.size());
+    itemStore.clear();
+    itemStore.shrink_to_fit();
+    itemsSpilled = true;
+    LOG_DBG("COF", "Manifest exceeds %zu bytes, moved items to SD", MAX_IN_MEMORY_ITEM_BYTES);
+  }
+
+  itemIndex.push_back({fnvHash(itemId), idLen, itemStoreSize});
+  itemStoreSize += itemSize;
+
+  if (itemsSpilled) {
+    serialization::writePod(itemSpillFile, idLen);
+    itemSpillFile.write(reinterpret_cast<const uint8_t*>(itemId.data()), idLen);
+    serialization::writePod(itemSpillFile, hrefLen);
+    itemSpillFile.write(reinterpret_cast<const uint8_t*>(href.data()), hrefLen);
+  } else {
+    itemStore.append(reinterpret_cast<const char*>(&idLen), sizeof(idLen));
+    itemStore.append(itemId, 0, idLen);
+    itemStore.append(reinterpret_cast<const char*>(&hrefLen), sizeof(hrefLen));
+    itemStore.append(href, 0, hrefLen);
+  }
+}
+
+bool ContentOpfParser::readItem(const uint32_t offset, std::string& itemId, std::string& href) {
+  uint16_t len;
+  if (!itemsSpilled) {
+    size_t pos = offset;
+    memcpy(&len, itemStore.data() + pos, sizeof(len));
+    itemId.assign(itemStore, pos + sizeof(len), len);
+    pos += sizeof(len) + len;
+    memcpy(&len, itemStore.data() + pos, sizeof(len));
+    href.assign(itemStore, pos + sizeof(len), len);
+    return true;
+  }
+
+  if (!itemSpillFile.seek(offset)) {
+    return false;
+  }
+  serialization::readPod(itemSpillFile, len);
+  itemId.resize(len);
+  itemSpillFile.read(&itemId[0], len);
+  serialization::readPod(itemSpillFile, len);
+  href.resize(len);
+  itemSpillFile.read(&href[0], len);
+  return true;
+}
+
+bool ContentOpfParser::findItemHref(const std::string& itemId, std::string& href) {
+  if (!itemIndexSorted) {
+    std::sort(itemIndex.begin(), itemIndex.end(), [](const ItemIndexEntry& a, const ItemIndexEntry& b) {
+      return a.idHash < b.idHash || (a.idHash == b.idHash && a.idLen < b.idLen);
+    });
+    itemIndexSorted = true;
+  }
+
+  const uint32_t targetHash = fnvHash(itemId);
+  const auto targetLen = static_cast<uint16_t>(itemId.size());
+  auto it = std::lower_bound(itemIndex.begin(), itemIndex.end(), ItemIndexEntry{targetHash, targetLen, 0},
+                             [](const ItemIndexEntry& a, const ItemIndexEntry& b) {
+                               return a.idHash < b.idHash || (a.idHash == b.idHash && a.idLen < b.idLen);
+                             });
+
+  // Check for match (may need to check a few due to hash collisions)
+  std::string storedId;
+  for (; it != itemIndex.end() && it->idHash == targetHash && it->idLen == targetLen; ++it) {
+    if (readItem(it->offset, storedId, href) && storedId == itemId) {
+      return true;
+    }
+  }
+  return false;
 }
 
 size_t ContentOpfParser::write(const uint8_t data) { return write(&data, 1); }
@@ -118,26 +202,18 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
 
   if (self->state == IN_PACKAGE && (strcmp(name, "manifest") == 0 || strcmp(name, "opf:manifest") == 0)) {
     self->state = IN_MANIFEST;
-    if (!Storage.openFileForWrite("COF", self->cachePath + itemCacheFile, self->tempItemStore)) {
-      LOG_ERR("COF", "Couldn't open temp items file for writing. This is probably going to be a fatal error.");
-    }
     return;
   }
 
   if (self->state == IN_PACKAGE && (strcmp(name, "spine") == 0 || strcmp(name, "opf:spine") == 0)) {
     self->state = IN_SPINE;
-    if (!Storage.openFileForRead("COF", self->cachePath + itemCacheFile, self->tempItemStore)) {
-      LOG_ERR("COF", "Couldn't open temp items file for reading. This is probably going to be a fatal error.");
-    }
-
-    // Sort item index for binary search if we have enough items
-    if (self->itemIndex.size() >= LARGE_SPINE_THRESHOLD) {
-      std::sort(self->itemIndex.begin(), self->itemIndex.end(), [](const ItemIndexEntry& a, const ItemIndexEntry& b) {
-        return a.idHash < b.idHash || (a.idHash == b.idHash && a.idLen < b.idLen);
-      });
-      self->useItemIndex = true;
-      LOG_DBG("COF", "Using fast index for %zu manifest items", self->itemIndex.size());
+    if (self->itemsSpilled) {
+      self->itemSpillFile.close();
+      if (!Storage.openFileForRead("COF", self->cachePath + itemCacheFile, self->itemSpillFile)) {
+        LOG_ERR("COF", "Couldn't open temp items file for reading. This is probably going to be a fatal error.");
+      }
     }
+    LOG_DBG("COF", "Indexed %zu manifest items", self->itemIndex.size());
     return;
   }
 
@@ -145,9 +221,6 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
     self->state = IN_GUIDE;
     // TODO Remove print
     LOG_DBG("COF", "Entering guide state.");
-    if (!Storage.openFileForRead("COF", self->cachePath + itemCacheFile, self->tempItemStore)) {
-      LOG_ERR("COF", "Couldn't open temp items file for reading. This is probably going to be a fatal error.");
-    }
     return;
   }
 
@@ -187,18 +260,7 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
       }
     }
 
-    // Record index entry for fast lookup later
-    if (self->tempItemStore) {
-      ItemIndexEntry entry;
-      entry.idHash = fnvHash(itemId);
-      entry.idLen = static_cast<uint16_t>(itemId.size());
-      entry.fileOffset = static_cast<uint32_t>(self->tempItemStore.position());
-      self->itemIndex.push_back(entry);
-    }
-
-    // Write items down to SD card
-    serialization::writeString(self->tempItemStore, itemId);
-    serialization::writeString(self->tempItemStore, href);
+    self->storeItem(itemId, href);
 
     if (itemId == self->coverItemId) {
       self->coverItemHref = href;
@@ -244,46 +306,7 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
         if (strcmp(atts[i], "idref") == 0) {
           const std::string idref = atts[i + 1];
           std::string href;
-          bool found = false;
-
-          if (self->useItemIndex) {
-            // Fast path: binary search
-            uint32_t targetHash = fnvHash(idref);
-            uint16_t targetLen = static_cast<uint16_t>(idref.size());
-
-            auto it = std::lower_bound(self->itemIndex.begin(), self->itemIndex.end(),
-                                       ItemIndexEntry{targetHash, targetLen, 0},
-                                       [](const ItemIndexEntry& a, const ItemIndexEntry& b) {
-                                         return a.idHash < b.idHash || (a.idHash == b.idHash && a.idLen < b.idLen);
-                                       });
-
-            // Check for match (may need to check a few due to hash collisions)
-            while (it != self->itemIndex.end() && it->idHash == targetHash) {
-              self->tempItemStore.seek(it->fileOffset);
-              std::string itemId;
-              serialization::readString(self->tempItemStore, itemId);
-              if (itemId == idref) {
-                serialization::readString(self->tempItemStore, href);
-                found = true;
-                break;
-              }
-              ++it;
-            }
-          } else {
-            // Slow path: linear scan (for small manifests, keeps original behavior)
-            // TODO: This lookup is slow as need to scan through all items each time.
-            //       It can take up to 200ms per item when getting to 1500 items.
-            self->tempItemStore.seek(0);
-            std::string itemId;
-            while (self->tempItemStore.available()) {
-              serialization::readString(self->tempItemStore, itemId);
-              serialization::readString(self->tempItemStore, href);
-              if (itemId == idref) {
-                found = true;
-                break;
-              }
-            }
-          }
+          const bool found = self->findItemHref(idref, href);
 
           if (found && self->cache) {
             self->cache->createSpineEntry(href);
@@ -345,19 +368,16 @@ void XMLCALL ContentOpfParser::endElement(void* userData, const XML_Char* name)
 
   if (self->state == IN_SPINE && (strcmp(name, "spine") == 0 || strcmp(name, "opf:spine") == 0)) {
     self->state = IN_PACKAGE;
-    self->tempItemStore.close();
     return;
   }
 
   if (self->state == IN_GUIDE && (strcmp(name, "guide") == 0 || strcmp(name, "opf:guide") == 0)) {
     self->state = IN_PACKAGE;
-    self->tempItemStore.close();
     return;
   }
 
   if (self->state == IN_MANIFEST && (strcmp(name, "manifest") == 0 || strcmp(name, "opf:manifest") == 0)) {
     self->state = IN_PACKAGE;
-    self->tempItemStore.close();
     return;
   }
 
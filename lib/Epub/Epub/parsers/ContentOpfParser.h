@@ -28,19 +28,25 @@ class ContentOpfParser final : public Print {
   XML_Parser parser = nullptr;
   ParserState state = START;
   BookMetadataCache* cache;
-  FsFile tempItemStore;
   std::string coverItemId;
 
-  // Index for fast idref→href lookup (used only for large EPUBs)
+  // Manifest id/href pairs, packed as [u16 idLen][id][u16 hrefLen][href]. Held in RAM and moved to .items.bin
+  // only when a manifest is too large to keep resident.
+  std::string itemStore;
+  FsFile itemSpillFile;
+  bool itemsSpilled = false;
+  uint32_t itemStoreSize = 0;
+
+  // Sorted index for idref→href lookup
   struct ItemIndexEntry {
-    uint32_t idHash;      // FNV-1a hash of itemId
-    uint16_t idLen;       // length for collision reduction
-    uint32_t fileOffset;  // offset in .items.bin
+    uint32_t idHash;  // FNV-1a hash of itemId
+    uint16_t idLen;   // length for collision reduction
+    uint32_t offset;  // offset of the item in the item store
   };
   std::vector<ItemIndexEntry> itemIndex;
-  bool useItemIndex = false;
+  bool itemIndexSorted = false;
 
-  static constexpr uint16_t LARGE_SPINE_THRESHOLD = 400;
+  static constexpr size_t MAX_IN_MEMORY_ITEM_BYTES = 16 * 1024;
 
   // FNV-1a hash function
   static uint32_t fnvHash(const std::string& s) {
@@ -52,6 +58,10 @@ class ContentOpfParser final : public Print {
     return hash;
   }
 
+  void storeItem(const std::string& itemId, const std::string& href);
+  bool readItem(uint32_t offset, std::string& itemId, std::string& href);
+  bool findItemHref(const std::string& itemId, std::string& href);
+
   static void startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void characterData(void* userData, const XML_Char* s, int len);
   static void endElement(void* userData, const XML_Char* name);
@@ -0,0 +1,107 @@
+#include "AreaScaler.h"
+
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+AreaScaler::~AreaScaler() {
+  free(columns);
+  free(rowAccum);
+  free(outputRow);
+}
+
+bool AreaScaler::begin(const int width, const int height, const int scaledWidth, const int scaledHeight) {
+  // Positions are 16.16 within the image, the scale limit keeps the sums of 8-bit pixels times weights in 32 bits
+  if (width <= 0 || height <= 0 || scaledWidth <= 0 || scaledHeight <= 0 || width > 0xFFFF || height > 0xFFFF ||
+      width > scaledWidth * MAX_SCALE || scaledWidth > width * MAX_SCALE || height > scaledHeight * MAX_SCALE ||
+      scaledHeight > height * MAX_SCALE) {
+    LOG_ERR("SCL", "Can't scale %dx%d to %dx%d", width, height, scaledWidth, scaledHeight);
+    return false;
+  }
+
+  srcWidth = width;
+  srcHeight = height;
+  outWidth = scaledWidth;
+  outHeight = scaledHeight;
+  scaleX_fp = (static_cast<uint32_t>(srcWidth) << 16) / outWidth;
+  scaleY_fp = (static_cast<uint32_t>(srcHeight) << 16) / outHeight;
+  columnScale = (1ULL << 40) / scaleX_fp;
+  srcY = 0;
+  outY = 0;
+  srcYPos = 0;
+  srcYEnd = 0;
+  rowWeight = 0;
+
+  columns = static_cast<uint16_t*>(malloc(outWidth * sizeof(uint16_t)));
+  rowAccum = static_cast<uint32_t*>(calloc(outWidth, sizeof(uint32_t)));
+  outputRow = static_cast<uint8_t*>(malloc(outWidth));
+  if (!columns || !rowAccum || !outputRow) {
+    LOG_ERR("SCL", "Failed to allocate scaler rows for width %d", outWidth);
+    return false;
+  }
+  return true;
+}
+
+void AreaScaler::addRow(const uint8_t* row) {
+  // Output pixel ox covers [ox * scaleX, (ox + 1) * scaleX) of the row: a part of the source pixel it starts in, the
+  // source pixels fully inside it and a part of the one it ends in. Every output pixel covers exactly scaleX_fp, so
+  // its weighted sum scales to the mean with the same factor.
+  uint32_t start = 0;
+  for (int ox = 0; ox < outWidth; ox++) {
+    const uint32_t end = start + scaleX_fp;
+    const int firstFull = (start + 0xFFFF) >> 16;
+    const int endFull = end >> 16;
+    uint32_t sum;
+    if (firstFull > endFull) {
+      // Within a single source pixel (upscaling)
+      sum = row[start >> 16] * scaleX_fp;
+    } else {
+      uint32_t fullSum = 0;
+      for (int sx = firstFull; sx < endFull; sx++) {
+        fullSum += row[sx];
+      }
+      sum = fullSum << 16;
+      if (start & 0xFFFF) sum += row[start >> 16] * ((static_cast<uint32_t>(firstFull) << 16) - start);
+      if (end & 0xFFFF) sum += row[endFull] * (end & 0xFFFF);
+    }
+    columns[ox] = (sum * columnScale + (1ULL << 31)) >> 32;
+    start = end;
+  }
+
+  srcYPos = static_cast<uint32_t>(srcY) << 16;
+  srcYEnd = static_cast<uint32_t>(srcY + 1) << 16;
+  srcY++;
+}
+
+const uint8_t* AreaScaler::nextRow() {
+  // Output row oy covers [oy * scaleY, (oy + 1) * scaleY). Weights are in 1/256 rows, measured between rounded
+  // positions so the parts of a source row still add up to the whole row.
+  while (outY < outHeight && srcYPos < srcYEnd) {
+    const uint32_t boundary = static_cast<uint32_t>(outY + 1) * scaleY_fp;
+    const uint32_t next = std::min(boundary, srcYEnd);
+    const uint32_t weight = (next >> 8) - (srcYPos >> 8);
+    if (weight > 0) {
+      for (int ox = 0; ox < outWidth; ox++) {
+        rowAccum[ox] += columns[ox] * weight;
+      }
+      rowWeight += weight;
+    }
+    srcYPos = next;
+    if (next < boundary) {
+      break;
+    }
+
+    // The output row is complete: weighted sum of 8.8 means to 8-bit mean
+    const uint64_t rowScale = (1ULL << 32) / rowWeight;
+    for (int ox = 0; ox < outWidth; ox++) {
+      outputRow[ox] = (rowAccum[ox] * rowScale + (1ULL << 39)) >> 40;
+    }
+    memset(rowAccum, 0, outWidth * sizeof(uint32_t));
+    rowWeight = 0;
+    outY++;
+    return outputRow;
+  }
+  return nullptr;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+// Streaming area-averaging scaler for rows of 8-bit gray pixels. Each output pixel is the mean of the source area it
+// covers, with the source pixels on its edges weighted by the part they cover, so downscaling doesn't alias the way
+// sampling does. Source rows are consumed once, in order, and only a few rows of output width are kept. All math is
+// fixed point (16.16 positions), the ESP32-C3 has no FPU.
+//
+//   scaler.addRow(srcRow);
+//   while (const uint8_t* row = scaler.nextRow()) { ... }
+class AreaScaler {
+ public:
+  // Scale factors are limited so the weighted sums fit in 32 bits
+  static constexpr int MAX_SCALE = 256;
+
+  AreaScaler() = default;
+  ~AreaScaler();
+  AreaScaler(const AreaScaler&) = delete;
+  AreaScaler& operator=(const AreaScaler&) = delete;
+
+  bool begin(int srcWidth, int srcHeight, int outWidth, int outHeight);
+  int getWidth() const { return outWidth; }
+  int getHeight() const { return outHeight; }
+
+  // Next source row (srcWidth pixels)
+  void addRow(const uint8_t* row);
+  // Next output row (outWidth pixels) the source rows added so far complete, nullptr once there is none. Upscaling
+  // completes several output rows per source row, downscaling at most one.
+  const uint8_t* nextRow();
+
+ private:
+  int srcWidth = 0;
+  int srcHeight = 0;
+  int outWidth = 0;
+  int outHeight = 0;
+  uint32_t scaleX_fp = 0;  // Source pixels per output pixel (16.16)
+  uint32_t scaleY_fp = 0;
+  uint64_t columnScale = 0;  // Turns a weighted sum across an output pixel into its mean (8.8), 2^40 / scaleX_fp
+
+  uint16_t* columns = nullptr;   // Current source row scaled horizontally (8.8)
+  uint32_t* rowAccum = nullptr;  // Weighted sum of the scaled source rows in the current output row
+  uint32_t rowWeight = 0;        // Their total weight (1/256 source rows)
+  uint8_t* outputRow = nullptr;
+
+  int srcY = 0;           // Source rows added
+  int outY = 0;           // Output rows completed
+  uint32_t srcYPos = 0;   // Start of the part of the last source row not yet added to an output row (16.16)
+  uint32_t srcYEnd = 0;   // End of the last source row (16.16)
+};
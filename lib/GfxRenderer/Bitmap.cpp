@@ -1,5 +1,6 @@
 #include "Bitmap.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -13,12 +14,16 @@
 constexpr bool USE_ATKINSON = true;  // Use Atkinson dithering instead of Floyd-Steinberg
 // ============================================================================
 
+// Pixel data read from the file at a time, a whole number of rows (at least one)
+constexpr int READ_BLOCK_SIZE = 4096;
+
 Bitmap::~Bitmap() {
   delete[] errorCurRow;
   delete[] errorNextRow;
 
   delete atkinsonDitherer;
   delete fsDitherer;
+  free(readBlock);
 }
 
 uint16_t Bitmap::readLE16(FsFile& f) {
@@ -177,10 +182,89 @@ BmpReaderError Bitmap::parseHeaders() {
   return BmpReaderError::Ok;
 }
 
+const uint8_t* Bitmap::readRowData(uint8_t* rowBuffer) const {
+  if (!readBlock && readBlockRows == 0) {
+    readBlockRows = std::max(1, READ_BLOCK_SIZE / rowBytes);
+    readBlock = static_cast<uint8_t*>(malloc(readBlockRows * rowBytes));
+    if (!readBlock) {
+      readBlockRows = 1;  // Don't try again, rows are read one at a time into rowBuffer
+    }
+  }
+  if (!readBlock) {
+    return file.read(rowBuffer, rowBytes) == rowBytes ? rowBuffer : nullptr;
+  }
+
+  if (readBlockNext >= readBlockFilled) {
+    // Reading past the pixel data at the end of the image is harmless, only whole rows are handed out
+    const int bytesRead = file.read(readBlock, readBlockRows * rowBytes);
+    readBlockFilled = bytesRead > 0 ? bytesRead / rowBytes : 0;
+    readBlockNext = 0;
+    if (readBlockFilled == 0) {
+      return nullptr;
+    }
+  }
+  return readBlock + rowBytes * readBlockNext++;
+}
+
+// Calls fn(lum) with the luminance of each pixel of the row, false if the bit depth isn't supported
+template <typename LumFn>
+bool Bitmap::forEachLuminance(const uint8_t* rowData, const LumFn& fn) const {
+  switch (bpp) {
+    case 32: {
+      const uint8_t* p = rowData;
+      for (int x = 0; x < width; x++) {
+        fn((77u * p[2] + 150u * p[1] + 29u * p[0]) >> 8);
+        p += 4;
+      }
+      return true;
+    }
+    case 24: {
+      const uint8_t* p = rowData;
+      for (int x = 0; x < width; x++) {
+        fn((77u * p[2] + 150u * p[1] + 29u * p[0]) >> 8);
+        p += 3;
+      }
+      return true;
+    }
+    case 8: {
+      for (int x = 0; x < width; x++) {
+        fn(paletteLum[rowData[x]]);
+      }
+      return true;
+    }
+    case 4: {
+      for (int x = 0; x < width; x++) {
+        const uint8_t nibble = (x & 1) ? (rowData[x >> 1] & 0x0F) : (rowData[x >> 1] >> 4);
+        fn(paletteLum[nibble]);
+      }
+      return true;
+    }
+    case 2: {
+      for (int x = 0; x < width; x++) {
+        fn(paletteLum[(rowData[x >> 2] >> (6 - ((x & 3) * 2))) & 0x03]);
+      }
+      return true;
+    }
+    case 1: {
+      for (int x = 0; x < width; x++) {
+        // Get palette index (0 or 1) from bit at position x
+        const uint8_t palIndex = (rowData[x >> 3] & (0x80 >> (x & 7))) ? 1 : 0;
+        // Use palette lookup for proper black/white mapping
+        fn(paletteLum[palIndex]);
+      }
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
 // packed 2bpp output, 0 = black, 1 = dark gray, 2 = light gray, 3 = white
 BmpReaderError Bitmap::readNextRow(uint8_t* data, uint8_t* rowBuffer) const {
-  // Note: rowBuffer should be pre-allocated by the caller to size 'rowBytes'
-  if (file.read(rowBuffer, rowBytes) != rowBytes) return BmpReaderError::ShortReadRow;
+  // Note: rowBuffer should be pre-allocated by the caller to size 'rowBytes', it is only used if the read block
+  // couldn't be allocated
+  const uint8_t* rowData = readRowData(rowBuffer);
+  if (!rowData) return BmpReaderError::ShortReadRow;
 
   prevRowY += 1;
 
@@ -216,59 +300,8 @@ BmpReaderError Bitmap::readNextRow(uint8_t* data, uint8_t* rowBuffer) const {
     currentX++;
   };
 
-  uint8_t lum;
-
-  switch (bpp) {
-    case 32: {
-      const uint8_t* p = rowBuffer;
-      for (int x = 0; x < width; x++) {
-        lum = (77u * p[2] + 150u * p[1] + 29u * p[0]) >> 8;
-        packPixel(lum);
-        p += 4;
-      }
-      break;
-    }
-    case 24: {
-      const uint8_t* p = rowBuffer;
-      for (int x = 0; x < width; x++) {
-        lum = (77u * p[2] + 150u * p[1] + 29u * p[0]) >> 8;
-        packPixel(lum);
-        p += 3;
-      }
-      break;
-    }
-    case 8: {
-      for (int x = 0; x < width; x++) {
-        packPixel(paletteLum[rowBuffer[x]]);
-      }
-      break;
-    }
-    case 4: {
-      for (int x = 0; x < width; x++) {
-        const uint8_t nibble = (x & 1) ? (rowBuffer[x >> 1] & 0x0F) : (rowBuffer[x >> 1] >> 4);
-        packPixel(paletteLum[nibble]);
-      }
-      break;
-    }
-    case 2: {
-      for (int x = 0; x < width; x++) {
-        lum = paletteLum[(rowBuffer[x >> 2] >> (6 - ((x & 3) * 2))) & 0x03];
-        packPixel(lum);
-      }
-      break;
-    }
-    case 1: {
-      for (int x = 0; x < width; x++) {
-        // Get palette index (0 or 1) from bit at position x
-        const uint8_t palIndex = (rowBuffer[x >> 3] & (0x80 >> (x & 7))) ? 1 : 0;
-        // Use palette lookup for proper black/white mapping
-        lum = paletteLum[palIndex];
-        packPixel(lum);
-      }
-      break;
-    }
-    default:
-      return BmpReaderError::UnsupportedBpp;
+  if (!forEachLuminance(rowData, packPixel)) {
+    return BmpReaderError::UnsupportedBpp;
   }
 
   if (atkinsonDitherer)
@@ -282,10 +315,47 @@ BmpReaderError Bitmap::readNextRow(uint8_t* data, uint8_t* rowBuffer) const {
   return BmpReaderError::Ok;
 }
 
+BmpReaderError Bitmap::readNextRowGray(uint8_t* gray, uint8_t* rowBuffer) const {
+  const uint8_t* rowData = readRowData(rowBuffer);
+  if (!rowData) return BmpReaderError::ShortReadRow;
+
+  prevRowY += 1;
+
+  uint8_t* out = gray;
+  if (!forEachLuminance(rowData, [&out](const uint8_t lum) { *out++ = lum; })) {
+    return BmpReaderError::UnsupportedBpp;
+  }
+  return BmpReaderError::Ok;
+}
+
+BmpReaderError Bitmap::readNextRowMask(uint8_t* mask, uint8_t* rowBuffer) const {
+  if (bpp != 1) return BmpReaderError::UnsupportedBpp;
+  const uint8_t* rowData = readRowData(rowBuffer);
+  if (!rowData) return BmpReaderError::ShortReadRow;
+
+  prevRowY += 1;
+
+  // A 1-bit palette is always native, so readNextRow maps an index to black, dark or light gray (all drawn black)
+  // when its adjusted luminance is below white
+  const uint8_t black0 = (adjustPixel(paletteLum[0]) >> 6) < 3 ? 0xFF : 0x00;
+  const uint8_t black1 = (adjustPixel(paletteLum[1]) >> 6) < 3 ? 0xFF : 0x00;
+  const int maskBytes = (width + 7) / 8;
+  for (int i = 0; i < maskBytes; i++) {
+    mask[i] = (rowData[i] & black1) | (~rowData[i] & black0);
+  }
+  if (width & 7) {
+    mask[maskBytes - 1] &= 0xFF << (8 - (width & 7));
+  }
+
+  return BmpReaderError::Ok;
+}
+
 BmpReaderError Bitmap::rewindToData() const {
   if (!file.seek(bfOffBits)) {
     return BmpReaderError::SeekPixelDataFailed;
   }
+  readBlockFilled = 0;
+  readBlockNext = 0;
 
   // Reset dithering when rewinding
   if (fsDitherer) fsDitherer->reset();
@@ -36,6 +36,11 @@ class Bitmap {
   ~Bitmap();
   BmpReaderError parseHeaders();
   BmpReaderError readNextRow(uint8_t* data, uint8_t* rowBuffer) const;
+  // The next row as 8-bit luminance (width bytes), before any adjustment or dithering, for scaling
+  BmpReaderError readNextRowGray(uint8_t* gray, uint8_t* rowBuffer) const;
+  // 1-bit bitmaps only: the next row as a mask of the pixels readNextRow would make black (MSB first, (width + 7) / 8
+  // bytes), which can be drawn a byte at a time
+  BmpReaderError readNextRowMask(uint8_t* mask, uint8_t* rowBuffer) const;
   BmpReaderError rewindToData() const;
   int getWidth() const { return width; }
   int getHeight() const { return height; }
@@ -48,6 +53,11 @@ class Bitmap {
  private:
   static uint16_t readLE16(FsFile& f);
   static uint32_t readLE32(FsFile& f);
+  // Pixel data of the next row, from the block of rows last read from the file (or read into rowBuffer if the block
+  // couldn't be allocated), nullptr on a short read
+  const uint8_t* readRowData(uint8_t* rowBuffer) const;
+  template <typename LumFn>
+  bool forEachLuminance(const uint8_t* rowData, const LumFn& fn) const;
 
   FsFile& file;
   bool dithering = false;
@@ -68,4 +78,10 @@ class Bitmap {
 
   mutable AtkinsonDitherer* atkinsonDitherer = nullptr;
   mutable FloydSteinbergDitherer* fsDitherer = nullptr;
+
+  // Rows are read from the file a block at a time, a full screen image would otherwise take a card read per row
+  mutable uint8_t* readBlock = nullptr;
+  mutable int readBlockRows = 0;    // Rows the block holds
+  mutable int readBlockFilled = 0;  // Rows read into the block
+  mutable int readBlockNext = 0;    // Next row handed out
 };
@@ -0,0 +1,100 @@
+#include "DamageTracker.h"
+
+#include <Logging.h>
+
+#include <algorithm>
+
+namespace {
+uint32_t hashTile(const uint8_t* frameBuffer, const int tileX, const int tileY) {
+  uint32_t hash = 2166136261u;
+  const uint8_t* row = frameBuffer + tileY * DamageTracker::TILE_HEIGHT * HalDisplay::DISPLAY_WIDTH_BYTES +
+                       tileX * DamageTracker::TILE_WIDTH_BYTES;
+  for (int y = 0; y < DamageTracker::TILE_HEIGHT; y++, row += HalDisplay::DISPLAY_WIDTH_BYTES) {
+    for (int x = 0; x < DamageTracker::TILE_WIDTH_BYTES; x++) {
+      hash ^= row[x];
+      hash *= 16777619u;
+    }
+  }
+  return hash;
+}
+
+// Unused when debug logging is compiled out
+void logDamage([[maybe_unused]] const char* what, [[maybe_unused]] const DamageTracker::Rect& rect) {
+  LOG_DBG("DMG", "%s x=%d y=%d w=%d h=%d", what, rect.x, rect.y, rect.width, rect.height);
+}
+}  // namespace
+
+DamageTracker::Result DamageTracker::update(const uint8_t* frameBuffer, Rect* window) {
+  const bool compare = hasDisplayedFrame;
+  hasDisplayedFrame = true;
+
+  int minColumn = TILE_COLUMNS;
+  int maxColumn = -1;
+  int minRow = TILE_ROWS;
+  int maxRow = -1;
+  // Consecutive tile rows with damage are reported as one band
+  int bandStart = -1;
+  int bandMinColumn = TILE_COLUMNS;
+  int bandMaxColumn = -1;
+
+  for (int tileY = 0; tileY <= TILE_ROWS; tileY++) {
+    int rowMinColumn = TILE_COLUMNS;
+    int rowMaxColumn = -1;
+    if (tileY < TILE_ROWS) {
+      for (int tileX = 0; tileX < TILE_COLUMNS; tileX++) {
+        uint32_t& stored = tileHashes[tileY * TILE_COLUMNS + tileX];
+        const uint32_t hash = hashTile(frameBuffer, tileX, tileY);
+        if (hash != stored) {
+          stored = hash;
+          rowMinColumn = std::min(rowMinColumn, tileX);
+          rowMaxColumn = tileX;
+        }
+      }
+    }
+
+    if (rowMaxColumn >= 0) {
+      if (bandStart < 0) {
+        bandStart = tileY;
+      }
+      bandMinColumn = std::min(bandMinColumn, rowMinColumn);
+      bandMaxColumn = std::max(bandMaxColumn, rowMaxColumn);
+      continue;
+    }
+    if (bandStart >= 0) {
+      if (compare) {
+        logDamage("Band", {static_cast<uint16_t>(bandMinColumn * TILE_WIDTH_BYTES * 8),
+                           static_cast<uint16_t>(bandStart * TILE_HEIGHT),
+                           static_cast<uint16_t>((bandMaxColumn - bandMinColumn + 1) * TILE_WIDTH_BYTES * 8),
+                           static_cast<uint16_t>((tileY - bandStart) * TILE_HEIGHT)});
+      }
+      minColumn = std::min(minColumn, bandMinColumn);
+      maxColumn = std::max(maxColumn, bandMaxColumn);
+      minRow = std::min(minRow, bandStart);
+      maxRow = tileY - 1;
+      bandStart = -1;
+      bandMinColumn = TILE_COLUMNS;
+      bandMaxColumn = -1;
+    }
+  }
+
+  if (!compare) {
+    return FullFrame;
+  }
+  if (maxColumn < 0) {
+    LOG_DBG("DMG", "No damage");
+    return NoChange;
+  }
+
+  window->x = static_cast<uint16_t>(minColumn * TILE_WIDTH_BYTES * 8);
+  window->y = static_cast<uint16_t>(minRow * TILE_HEIGHT);
+  window->width = static_cast<uint16_t>((maxColumn - minColumn + 1) * TILE_WIDTH_BYTES * 8);
+  window->height = static_cast<uint16_t>((maxRow - minRow + 1) * TILE_HEIGHT);
+  logDamage("Window", *window);
+
+  const uint32_t windowArea = static_cast<uint32_t>(window->width) * window->height;
+  const uint32_t panelArea = static_cast<uint32_t>(HalDisplay::DISPLAY_WIDTH) * HalDisplay::DISPLAY_HEIGHT;
+  if (windowArea * 100 > panelArea * MAX_WINDOW_AREA_PERCENT) {
+    return FullFrame;
+  }
+  return Window;
+}
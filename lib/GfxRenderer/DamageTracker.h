@@ -0,0 +1,45 @@
+#pragma once
+
+#include <HalDisplay.h>
+
+#include <cstdint>
+
+// Finds the part of the frame buffer that changed since it was last sent to the panel, so a fast refresh only needs
+// to push and refresh that window. The panel is split into fixed tiles and a hash of every tile is kept for the frame
+// that is currently displayed (~1.2KB), which avoids holding a second 48KB copy of the frame.
+class DamageTracker {
+ public:
+  // All coordinates are physical panel pixels. x and width are always multiples of 8 (whole frame buffer bytes).
+  struct Rect {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+  };
+
+  enum Result {
+    NoChange,   // No tile hash changed. Hashes can collide, so callers still refresh the whole frame
+    Window,     // Only the returned window changed
+    FullFrame,  // Too much changed (or nothing is known about the panel), refresh everything
+  };
+
+  static constexpr int TILE_WIDTH_BYTES = 10;  // 80px
+  static constexpr int TILE_HEIGHT = 16;
+  static constexpr int TILE_COLUMNS = HalDisplay::DISPLAY_WIDTH_BYTES / TILE_WIDTH_BYTES;
+  static constexpr int TILE_ROWS = HalDisplay::DISPLAY_HEIGHT / TILE_HEIGHT;
+  static_assert(TILE_COLUMNS * TILE_WIDTH_BYTES == HalDisplay::DISPLAY_WIDTH_BYTES &&
+                    TILE_ROWS * TILE_HEIGHT == HalDisplay::DISPLAY_HEIGHT,
+                "Damage tiles do not line up with the panel");
+  // Above this share of the panel a windowed update saves too little to be worth it
+  static constexpr int MAX_WINDOW_AREA_PERCENT = 60;
+
+  // Hashes the frame, compares it against the displayed one and records it as the new displayed frame.
+  // Every damaged band of tiles is logged, `window` receives their union.
+  Result update(const uint8_t* frameBuffer, Rect* window);
+  // The panel content is no longer known (e.g. after a grayscale refresh), the next update is a full frame
+  void invalidate() { hasDisplayedFrame = false; }
+
+ private:
+  uint32_t tileHashes[TILE_ROWS * TILE_COLUMNS] = {};
+  bool hasDisplayedFrame = false;
+};
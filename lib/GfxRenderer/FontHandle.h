@@ -0,0 +1,32 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+/// Renderer font resolved once from its id (GfxRenderer::getFontHandle), for code measuring a lot of text in one font
+/// such as chapter layout. Latin text is measured from per-style advance tables. Valid until the font is removed.
+class FontHandle {
+ public:
+  FontHandle() = default;
+
+  bool isValid() const { return family != nullptr; }
+
+  int getTextAdvanceX(const char* text, const EpdFontFamily::Style style) const {
+    if (!family) return 0;
+    return family->getFont(style)->getTextAdvanceX(text, advances[style & STYLE_MASK]);
+  }
+
+  int getSpaceWidth(const EpdFontFamily::Style style = EpdFontFamily::REGULAR) const {
+    if (!family) return 0;
+    const EpdGlyph* spaceGlyph = family->getGlyph(' ', style);
+    return spaceGlyph ? spaceGlyph->advanceX : 0;
+  }
+
+  int getLineHeight() const { return family ? family->getData(EpdFontFamily::REGULAR)->advanceY : 0; }
+
+ private:
+  friend class GfxRenderer;
+  static constexpr uint8_t STYLE_MASK = EpdFontFamily::BOLD | EpdFontFamily::ITALIC;
+
+  const EpdFontFamily* family = nullptr;
+  const EpdAdvance* advances[STYLE_MASK + 1] = {};  // By style without UNDERLINE, NULL entries measure without table
+};
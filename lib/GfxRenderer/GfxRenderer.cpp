@@ -1,9 +1,15 @@
 #include "GfxRenderer.h"
 
+#include <EpdGlyphRuns.h>
 #include <Logging.h>
 #include <Utf8.h>
 
+#include "AreaScaler.h"
+
 const uint8_t* GfxRenderer::getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph) const {
+  if (fontData->bitmapSource != nullptr) {
+    return fontData->bitmapSource->getBitmap(glyph);
+  }
   if (fontData->groups != nullptr) {
     if (!fontDecompressor) {
       LOG_ERR("GFX", "Compressed font but no FontDecompressor set");
@@ -25,6 +31,52 @@ void GfxRenderer::begin() {
 
 void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
 
+void GfxRenderer::removeFont(const int fontId) {
+  const auto fontIt = fontMap.find(fontId);
+  if (fontIt == fontMap.end()) {
+    return;
+  }
+
+  // The fonts of a removed family may be unloaded, their tables would be stale
+  for (uint8_t style = 0; style <= FontHandle::STYLE_MASK; style++) {
+    const auto tableIt = advanceTables.find(fontIt->second.getFont(static_cast<EpdFontFamily::Style>(style)));
+    if (tableIt != advanceTables.end()) {
+      free(tableIt->second);
+      advanceTables.erase(tableIt);
+    }
+  }
+  fontMap.erase(fontIt);
+}
+
+FontHandle GfxRenderer::getFontHandle(const int fontId) const {
+  FontHandle handle;
+  const auto fontIt = fontMap.find(fontId);
+  if (fontIt == fontMap.end()) {
+    LOG_ERR("GFX", "Font %d not found", fontId);
+    return handle;
+  }
+
+  handle.family = &fontIt->second;
+  for (uint8_t style = 0; style <= FontHandle::STYLE_MASK; style++) {
+    const EpdFont* font = fontIt->second.getFont(static_cast<EpdFontFamily::Style>(style));
+    const auto tableIt = advanceTables.find(font);
+    if (tableIt != advanceTables.end()) {
+      handle.advances[style] = tableIt->second;
+      continue;
+    }
+
+    // Without memory or a glyphLookup the handle still measures, just through the glyph lookup
+    auto* table = static_cast<EpdAdvance*>(malloc(GLYPH_LOOKUP_SIZE * sizeof(EpdAdvance)));
+    if (!table || !font->buildAdvanceTable(table)) {
+      free(table);
+      continue;
+    }
+    advanceTables[font] = table;
+    handle.advances[style] = table;
+  }
+  return handle;
+}
+
 // Translate logical (x,y) coordinates to physical panel coordinates based on current orientation
 // This should always be inlined for better performance
 static inline void rotateCoordinates(const GfxRenderer::Orientation orientation, const int x, const int y, int* phyX,
@@ -50,7 +102,8 @@ static inline void rotateCoordinates(const GfxRenderer::Orientation orientation,
       *phyY = x;
       break;
     }
-    case GfxRenderer::LandscapeCounterClockwise: {
+    case GfxRenderer::LandscapeCounterClockwise:
+    default: {
       // Logical landscape (800x480) aligned with panel orientation
       *phyX = x;
       *phyY = y;
@@ -59,30 +112,631 @@ static inline void rotateCoordinates(const GfxRenderer::Orientation orientation,
   }
 }
 
+// True if a packed 2-bit glyph bitmap holds any light or dark gray value (01 or 10)
+static bool hasGrayValues(const uint8_t* bitmap, const int pixelCount) {
+  const int byteCount = (pixelCount + 3) / 4;
+  for (int i = 0; i < byteCount; i++) {
+    if ((bitmap[i] ^ (bitmap[i] >> 1)) & 0x55) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Rows of the contiguous frame buffer, for the kernels that take a panelRow(phyY) accessor
+static inline auto frameBufferRows(uint8_t* frameBuffer) {
+  return [frameBuffer](const int phyY) { return frameBuffer + phyY * HalDisplay::DISPLAY_WIDTH_BYTES; };
+}
+
+static inline void setPhysicalPixel(uint8_t* row, const int phyX, const bool state) {
+  uint8_t* byte = row + (phyX >> 3);
+  const uint8_t bit = 0x80 >> (phyX & 7);  // MSB first
+  if (state) {
+    *byte &= ~bit;  // Clear bit
+  } else {
+    *byte |= bit;  // Set bit
+  }
+}
+
+// Inverse of rotateCoordinates: physical panel coordinates back to logical (x,y)
+static inline void unrotateCoordinates(const GfxRenderer::Orientation orientation, const int phyX, const int phyY,
+                                       int* x, int* y) {
+  switch (orientation) {
+    case GfxRenderer::Portrait:
+      *x = HalDisplay::DISPLAY_HEIGHT - 1 - phyY;
+      *y = phyX;
+      break;
+    case GfxRenderer::LandscapeClockwise:
+      *x = HalDisplay::DISPLAY_WIDTH - 1 - phyX;
+      *y = HalDisplay::DISPLAY_HEIGHT - 1 - phyY;
+      break;
+    case GfxRenderer::PortraitInverted:
+      *x = phyY;
+      *y = HalDisplay::DISPLAY_WIDTH - 1 - phyX;
+      break;
+    case GfxRenderer::LandscapeCounterClockwise:
+    default:
+      *x = phyX;
+      *y = phyY;
+      break;
+  }
+}
+
+// Inclusive run of pixels along one panel row, written as whole bytes with masked edges. `pattern` holds the bit
+// values to store (0 = black, 1 = white) and repeats every byte.
+static void fillPhysicalRow(uint8_t* row, const int phyX1, const int phyX2, const uint8_t pattern) {
+  const int firstByte = phyX1 >> 3;
+  const int lastByte = phyX2 >> 3;
+  const uint8_t firstMask = 0xFF >> (phyX1 & 7);
+  const uint8_t lastMask = 0xFF << (7 - (phyX2 & 7));
+
+  if (firstByte == lastByte) {
+    const uint8_t mask = firstMask & lastMask;
+    row[firstByte] = (row[firstByte] & ~mask) | (pattern & mask);
+    return;
+  }
+  row[firstByte] = (row[firstByte] & ~firstMask) | (pattern & firstMask);
+  memset(row + firstByte + 1, pattern, lastByte - firstByte - 1);
+  row[lastByte] = (row[lastByte] & ~lastMask) | (pattern & lastMask);
+}
+
+static inline uint8_t solidPattern(const bool state) { return state ? 0x00 : 0xFF; }
+
+// Inclusive run of pixels down one panel column: same bit in every row
+template <typename PanelRow>
+static void fillPhysicalColumn(const PanelRow& panelRow, const int phyX, const int phyY1, const int phyY2,
+                               const bool state) {
+  const int byteX = phyX >> 3;
+  const uint8_t bit = 0x80 >> (phyX & 7);
+  for (int phyY = phyY1; phyY <= phyY2; phyY++) {
+    uint8_t* byte = panelRow(phyY) + byteX;
+    if (state) {
+      *byte &= ~bit;
+    } else {
+      *byte |= bit;
+    }
+  }
+}
+
+// Sets (state false) or clears the pixels of a panel row whose bit is set in `bits`, MSB first from phyX. phyX may
+// be negative as long as the bits left of the panel are clear, the same goes for bits past the end of the row.
+static inline void writePhysicalRowBits(uint8_t* row, int phyX, uint8_t bits, const bool state) {
+  if (!bits) {
+    return;
+  }
+  if (phyX < 0) {
+    bits = static_cast<uint8_t>(bits << -phyX);
+    phyX = 0;
+  }
+  uint8_t* byte = row + (phyX >> 3);
+  const int shift = phyX & 7;
+  const uint8_t first = bits >> shift;
+  const uint8_t second = shift ? static_cast<uint8_t>(bits << (8 - shift)) : 0;
+  if (state) {
+    *byte &= ~first;
+    if (second) byte[1] &= ~second;
+  } else {
+    *byte |= first;
+    if (second) byte[1] |= second;
+  }
+}
+
+static inline uint8_t reverseBits(uint8_t bits) {
+  bits = static_cast<uint8_t>((bits & 0xF0) >> 4 | (bits & 0x0F) << 4);
+  bits = static_cast<uint8_t>((bits & 0xCC) >> 2 | (bits & 0x33) << 2);
+  return static_cast<uint8_t>((bits & 0xAA) >> 1 | (bits & 0x55) << 1);
+}
+
+static inline void writePhysicalByte(uint8_t* byte, const uint8_t bits, const bool state) {
+  if (state) {
+    *byte &= ~bits;
+  } else {
+    *byte |= bits;
+  }
+}
+
+// Transposes an 8x8 bit matrix stored one row per byte, first row in the top byte (Hacker's Delight, 7-3)
+static inline uint64_t transpose8x8(uint64_t bits) {
+  uint64_t t = (bits ^ (bits >> 7)) & 0x00AA00AA00AA00AAULL;
+  bits ^= t ^ (t << 7);
+  t = (bits ^ (bits >> 14)) & 0x0000CCCC0000CCCCULL;
+  bits ^= t ^ (t << 14);
+  t = (bits ^ (bits >> 28)) & 0x00000000F0F0F0F0ULL;
+  return bits ^ t ^ (t << 28);
+}
+
+// Gathers bits 6, 4, 2 and 0 into a nibble, in that order
+static inline uint8_t packEvenBits(uint8_t bits) {
+  bits = (bits | bits >> 1) & 0x33;
+  return (bits | bits >> 2) & 0x0F;
+}
+
+template <GfxRenderer::Orientation orientation>
+struct OrientedKernels {
+  // In portrait, logical rows run down panel columns and logical columns run along panel rows
+  static constexpr bool rowsAreColumns =
+      orientation == GfxRenderer::Portrait || orientation == GfxRenderer::PortraitInverted;
+
+  // The primitives below draw into the rows returned by panelRow(phyY), which are those of the frame buffer or of the
+  // chunked gray MSB plane. The kernel table holds the frame buffer versions further down.
+  template <typename PanelRow>
+  static void pixel(const PanelRow& panelRow, const int x, const int y, const bool state) {
+    int phyX, phyY;
+    rotateCoordinates(orientation, x, y, &phyX, &phyY);
+    setPhysicalPixel(panelRow(phyY), phyX, state);
+  }
+
+  template <typename PanelRow>
+  static void horizontalSpan(const PanelRow& panelRow, const int x1, const int x2, const int y, const bool state) {
+    int phyX1, phyY1, phyX2, phyY2;
+    rotateCoordinates(orientation, x1, y, &phyX1, &phyY1);
+    rotateCoordinates(orientation, x2, y, &phyX2, &phyY2);
+    if constexpr (rowsAreColumns) {
+      fillPhysicalColumn(panelRow, phyX1, std::min(phyY1, phyY2), std::max(phyY1, phyY2), state);
+    } else {
+      fillPhysicalRow(panelRow(phyY1), std::min(phyX1, phyX2), std::max(phyX1, phyX2), solidPattern(state));
+    }
+  }
+
+  template <typename PanelRow>
+  static void verticalSpan(const PanelRow& panelRow, const int x, const int y1, const int y2, const bool state) {
+    int phyX1, phyY1, phyX2, phyY2;
+    rotateCoordinates(orientation, x, y1, &phyX1, &phyY1);
+    rotateCoordinates(orientation, x, y2, &phyX2, &phyY2);
+    if constexpr (rowsAreColumns) {
+      fillPhysicalRow(panelRow(phyY1), std::min(phyX1, phyX2), std::max(phyX1, phyX2), solidPattern(state));
+    } else {
+      fillPhysicalColumn(panelRow, phyX1, std::min(phyY1, phyY2), std::max(phyY1, phyY2), state);
+    }
+  }
+
+  // Byte pattern for one panel row of a fill. The dither patterns are defined on logical coordinates and only depend
+  // on their parity, which alternates between neighbouring panel pixels and rows, so every row repeats one byte.
+  static uint8_t rowPattern(const Color color, const int phyY) {
+    if (color == Color::Black || color == Color::White) {
+      return solidPattern(color == Color::Black);
+    }
+    uint8_t pattern = 0xFF;
+    for (int phyX = 0; phyX < 2; phyX++) {
+      int x, y;
+      unrotateCoordinates(orientation, phyX, phyY, &x, &y);
+      const bool black = color == Color::LightGray ? (x % 2 == 0 && y % 2 == 0) : ((x + y) % 2 == 0);
+      if (black) {
+        pattern &= phyX == 0 ? 0x55 : 0xAA;  // Even columns are the 0xAA bits (MSB first)
+      }
+    }
+    return pattern;
+  }
+
+  // Fills whole panel rows, so every orientation writes contiguous byte runs
+  template <typename PanelRow>
+  static void rect(const PanelRow& panelRow, const int x1, const int y1, const int x2, const int y2,
+                   const Color color) {
+    int phyX1, phyY1, phyX2, phyY2;
+    rotateCoordinates(orientation, x1, y1, &phyX1, &phyY1);
+    rotateCoordinates(orientation, x2, y2, &phyX2, &phyY2);
+    if (phyX1 > phyX2) std::swap(phyX1, phyX2);
+    if (phyY1 > phyY2) std::swap(phyY1, phyY2);
+
+    const uint8_t patterns[2] = {rowPattern(color, phyY1), rowPattern(color, phyY1 + 1)};
+    for (int phyY = phyY1; phyY <= phyY2; phyY++) {
+      fillPhysicalRow(panelRow(phyY), phyX1, phyX2, patterns[(phyY - phyY1) & 1]);
+    }
+  }
+
+  // Pixels of `rows` rows from y whose bit is set in their mask (MSB first, maskStride bytes per row)
+  template <typename PanelRow>
+  static void drawMasks(const PanelRow& panelRow, const int x, const int y, const uint8_t* masks, const int maskStride,
+                        const int width, const int rows, const bool state) {
+    const int maskBytes = (width + 7) / 8;
+    if constexpr (rowsAreColumns) {
+      // The rows sharing a panel byte column are transposed 8 pixels at a time, so each write covers up to 8 rows
+      for (int first = 0; first < rows;) {
+        int phyX, phyY;
+        rotateCoordinates(orientation, x, y + first, &phyX, &phyY);
+        const int bit = phyX & 7;
+        const int count = std::min(rows - first, orientation == GfxRenderer::Portrait ? 8 - bit : bit + 1);
+        for (int i = 0; i < maskBytes; i++) {
+          uint64_t bits = 0;
+          for (int r = 0; r < count; r++) {
+            const int rowBit = orientation == GfxRenderer::Portrait ? bit + r : bit - r;
+            bits |= static_cast<uint64_t>(masks[(first + r) * maskStride + i]) << (56 - 8 * rowBit);
+          }
+          if (!bits) {
+            continue;
+          }
+          bits = transpose8x8(bits);
+          for (int k = 0; k < 8; k++) {
+            const uint8_t column = static_cast<uint8_t>(bits >> (56 - 8 * k));
+            if (column) {
+              // In Portrait the row runs up the panel
+              const int rowY = orientation == GfxRenderer::Portrait ? phyY - i * 8 - k : phyY + i * 8 + k;
+              writePhysicalByte(panelRow(rowY) + (phyX >> 3), column, state);
+            }
+          }
+        }
+        first += count;
+      }
+    } else {
+      for (int r = 0; r < rows; r++) {
+        int phyX, phyY;
+        rotateCoordinates(orientation, x, y + r, &phyX, &phyY);
+        uint8_t* row = panelRow(phyY);
+        const uint8_t* mask = masks + r * maskStride;
+        for (int i = 0; i < maskBytes; i++) {
+          if constexpr (orientation == GfxRenderer::LandscapeCounterClockwise) {
+            writePhysicalRowBits(row, phyX + i * 8, mask[i], state);
+          } else {
+            // The row runs right to left on the panel
+            writePhysicalRowBits(row, phyX - i * 8 - 7, reverseBits(mask[i]), state);
+          }
+        }
+      }
+    }
+  }
+
+  static void drawPixel(uint8_t* frameBuffer, const int x, const int y, const bool state) {
+    pixel(frameBufferRows(frameBuffer), x, y, state);
+  }
+
+  static void drawHorizontalSpan(uint8_t* frameBuffer, const int x1, const int x2, const int y, const bool state) {
+    horizontalSpan(frameBufferRows(frameBuffer), x1, x2, y, state);
+  }
+
+  static void drawVerticalSpan(uint8_t* frameBuffer, const int x, const int y1, const int y2, const bool state) {
+    verticalSpan(frameBufferRows(frameBuffer), x, y1, y2, state);
+  }
+
+  static void fillRect(uint8_t* frameBuffer, const int x1, const int y1, const int x2, const int y2,
+                       const Color color) {
+    rect(frameBufferRows(frameBuffer), x1, y1, x2, y2, color);
+  }
+
+  static void drawMaskRows(uint8_t* frameBuffer, const int x, const int y, const uint8_t* masks, const int maskStride,
+                           const int width, const int rows, const bool state) {
+    drawMasks(frameBufferRows(frameBuffer), x, y, masks, maskStride, width, rows, state);
+  }
+};
+
+using PortraitKernels = OrientedKernels<GfxRenderer::Portrait>;
+using LandscapeClockwiseKernels = OrientedKernels<GfxRenderer::LandscapeClockwise>;
+using PortraitInvertedKernels = OrientedKernels<GfxRenderer::PortraitInverted>;
+using LandscapeCounterClockwiseKernels = OrientedKernels<GfxRenderer::LandscapeCounterClockwise>;
+
+// Indexed by Orientation
+const GfxRenderer::OrientationKernels GfxRenderer::orientationKernels[] = {
+    {PortraitKernels::drawPixel, PortraitKernels::drawHorizontalSpan, PortraitKernels::drawVerticalSpan,
+     PortraitKernels::fillRect, PortraitKernels::drawMaskRows},
+    {LandscapeClockwiseKernels::drawPixel, LandscapeClockwiseKernels::drawHorizontalSpan,
+     LandscapeClockwiseKernels::drawVerticalSpan, LandscapeClockwiseKernels::fillRect,
+     LandscapeClockwiseKernels::drawMaskRows},
+    {PortraitInvertedKernels::drawPixel, PortraitInvertedKernels::drawHorizontalSpan,
+     PortraitInvertedKernels::drawVerticalSpan, PortraitInvertedKernels::fillRect,
+     PortraitInvertedKernels::drawMaskRows},
+    {LandscapeCounterClockwiseKernels::drawPixel, LandscapeCounterClockwiseKernels::drawHorizontalSpan,
+     LandscapeCounterClockwiseKernels::drawVerticalSpan, LandscapeCounterClockwiseKernels::fillRect,
+     LandscapeCounterClockwiseKernels::drawMaskRows},
+};
+
+template <typename Draw>
+void GfxRenderer::drawGrayMsb(const Draw& draw) const {
+  const auto msbRow = [this](const int phyY) { return grayMsbRow(phyY); };
+  switch (orientation) {
+    case Portrait:
+      draw(PortraitKernels{}, msbRow);
+      break;
+    case LandscapeClockwise:
+      draw(LandscapeClockwiseKernels{}, msbRow);
+      break;
+    case PortraitInverted:
+      draw(PortraitInvertedKernels{}, msbRow);
+      break;
+    case LandscapeCounterClockwise:
+      draw(LandscapeCounterClockwiseKernels{}, msbRow);
+      break;
+  }
+}
+
+void GfxRenderer::setOrientation(const Orientation o) {
+  orientation = o;
+  kernels = &orientationKernels[o];
+}
+
 // IMPORTANT: This function is in critical rendering path and is called for every pixel. Please keep it as simple and
 // efficient as possible.
 void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
-  int phyX = 0;
-  int phyY = 0;
+  // Bounds checking against logical screen dimensions
+  if (x < 0 || x >= getScreenWidth() || y < 0 || y >= getScreenHeight()) {
+    LOG_ERR("GFX", "!! Outside range (%d, %d)", x, y);
+    return;
+  }
+
+  kernels->drawPixel(frameBuffer, x, y, state);
+  if (renderMode == GRAYSCALE_BOTH) {
+    drawGrayMsb([=](auto kernel, const auto& msbRow) { kernel.pixel(msbRow, x, y, state); });
+  }
+}
+
+void GfxRenderer::drawPixel2Bit(const int x, const int y, const uint8_t value) const {
+  const bool gray = value == 1 || value == 2;
+  switch (renderMode) {
+    case BW:
+      if (value < 3) {
+        drawPixel(x, y, true);
+      }
+      grayPixelsDrawn |= gray;
+      break;
+    case GRAYSCALE_LSB:
+      // Gray buffers flag pixels in reverse: 0 leave alone, 1 update
+      if (value == 1) {
+        drawPixel(x, y, false);
+      }
+      break;
+    case GRAYSCALE_MSB:
+      if (gray) {
+        drawPixel(x, y, false);
+      }
+      break;
+    case GRAYSCALE_BOTH:
+      if (gray) {
+        if (x < 0 || x >= getScreenWidth() || y < 0 || y >= getScreenHeight()) {
+          LOG_ERR("GFX", "!! Outside range (%d, %d)", x, y);
+          return;
+        }
+        int phyX, phyY;
+        rotateCoordinates(orientation, x, y, &phyX, &phyY);
+        if (value == 1) {
+          setPhysicalPixel(frameBuffer + phyY * HalDisplay::DISPLAY_WIDTH_BYTES, phyX, false);
+        }
+        grayMsbRow(phyY)[phyX >> 3] |= 0x80 >> (phyX & 7);
+      }
+      break;
+  }
+}
+
+void GfxRenderer::drawImage2Bit(const uint8_t* pixels, const int x, const int y, const int width,
+                                const int height) const {
+  const int bytesPerRow = (width + 3) / 4;
+  const int firstRow = std::max(0, -y);
+  const int endRow = std::min(height, getScreenHeight() - y);
+  const int drawWidth = std::min(width, getScreenWidth() - x);
+  if (firstRow >= endRow || drawWidth <= 0) {
+    return;
+  }
+
+  // Masks of 8 rows, which share a panel byte in portrait: the pixels drawn in this mode, and the gray ones
+  constexpr int BAND_ROWS = 8;
+  const int maskBytes = (drawWidth + 7) / 8;
+  uint8_t* drawn = x >= 0 ? static_cast<uint8_t*>(malloc(2 * BAND_ROWS * maskBytes)) : nullptr;
+  if (!drawn) {
+    // Starts left of the screen (or out of memory), which the masks don't handle
+    for (int row = firstRow; row < endRow; row++) {
+      const uint8_t* rowPixels = pixels + row * bytesPerRow;
+      for (int col = std::max(0, -x); col < drawWidth; col++) {
+        drawPixel2Bit(x + col, y + row, (rowPixels[col / 4] >> (6 - (col % 4) * 2)) & 0x03);
+      }
+    }
+    return;
+  }
+  uint8_t* gray = drawn + BAND_ROWS * maskBytes;
+
+  for (int bandStart = firstRow; bandStart < endRow;) {
+    const int bandEnd = std::min(endRow, ((y + bandStart) / BAND_ROWS + 1) * BAND_ROWS - y);
+    uint8_t anyGray = 0;
+    for (int row = bandStart; row < bandEnd; row++) {
+      const uint8_t* rowPixels = pixels + row * bytesPerRow;
+      uint8_t* rowDrawn = drawn + (row - bandStart) * maskBytes;
+      uint8_t* rowGray = gray + (row - bandStart) * maskBytes;
+      // Two pixel bytes per mask byte, the 2-bit values are split into their high and low bits
+      for (int i = 0; i < maskBytes; i++) {
+        uint8_t masks[3] = {};
+        for (int half = 0; half < 2; half++) {
+          const uint8_t packed = 2 * i + half < bytesPerRow ? rowPixels[2 * i + half] : 0xFF;
+          const uint8_t high = (packed >> 1) & 0x55;
+          const uint8_t low = packed & 0x55;
+          const int shift = half ? 0 : 4;
+          masks[0] |= packEvenBits(~(high & low) & 0x55) << shift;  // 0, 1 and 2
+          masks[1] |= packEvenBits(~high & low) << shift;           // 1
+          masks[2] |= packEvenBits(high ^ low) << shift;            // 1 and 2
+        }
+        if (i == maskBytes - 1 && (drawWidth & 7)) {
+          const uint8_t valid = 0xFF << (8 - (drawWidth & 7));
+          for (auto& mask : masks) mask &= valid;
+        }
+        rowDrawn[i] = renderMode == BW ? masks[0] : renderMode == GRAYSCALE_MSB ? masks[2] : masks[1];
+        rowGray[i] = masks[2];
+        anyGray |= masks[2];
+      }
+    }
 
-  // Note: this call should be inlined for better performance
-  rotateCoordinates(orientation, x, y, &phyX, &phyY);
+    const int rows = bandEnd - bandStart;
+    kernels->drawMaskRows(frameBuffer, x, y + bandStart, drawn, maskBytes, drawWidth, rows, renderMode == BW);
+    if (renderMode == BW) {
+      grayPixelsDrawn |= anyGray != 0;
+    } else if (renderMode == GRAYSCALE_BOTH && anyGray) {
+      drawGrayMsbMaskRows(x, y + bandStart, gray, maskBytes, drawWidth, rows, false);
+    }
+    bandStart = bandEnd;
+  }
+  free(drawn);
+}
 
-  // Bounds checking against physical panel dimensions
-  if (phyX < 0 || phyX >= HalDisplay::DISPLAY_WIDTH || phyY < 0 || phyY >= HalDisplay::DISPLAY_HEIGHT) {
-    LOG_ERR("GFX", "!! Outside range (%d, %d) -> (%d, %d)", x, y, phyX, phyY);
+void GfxRenderer::drawImage1Bit(const uint8_t* bits, const int x, const int y, const int width,
+                                const int height) const {
+  const int bytesPerRow = (width + 7) / 8;
+  const int firstRow = std::max(0, -y);
+  const int endRow = std::min(height, getScreenHeight() - y);
+  const int drawWidth = std::min(width, getScreenWidth() - x);
+  if (firstRow >= endRow || drawWidth <= 0) {
     return;
   }
+  const int maskBytes = (drawWidth + 7) / 8;
+  const uint8_t lastMaskBits = drawWidth & 7 ? 0xFF << (8 - (drawWidth & 7)) : 0xFF;
 
-  // Calculate byte position and bit position
-  const uint16_t byteIndex = phyY * HalDisplay::DISPLAY_WIDTH_BYTES + (phyX / 8);
-  const uint8_t bitPosition = 7 - (phyX % 8);  // MSB first
+  if (orientation == LandscapeCounterClockwise && x >= 0 && (x & 7) == 0) {
+    // Same bit order and 0 = black as the frame buffer, so each row is ANDed in a byte at a time
+    for (int row = firstRow; row < endRow; row++) {
+      const uint8_t* rowBits = bits + row * bytesPerRow;
+      uint8_t* panelRow = frameBuffer + (y + row) * HalDisplay::DISPLAY_WIDTH_BYTES + (x >> 3);
+      for (int i = 0; i < maskBytes - 1; i++) {
+        panelRow[i] &= rowBits[i];
+      }
+      panelRow[maskBytes - 1] &= rowBits[maskBytes - 1] | static_cast<uint8_t>(~lastMaskBits);
+      if (renderMode == GRAYSCALE_BOTH) {
+        uint8_t* msbRow = grayMsbRow(y + row) + (x >> 3);
+        for (int i = 0; i < maskBytes - 1; i++) {
+          msbRow[i] &= rowBits[i];
+        }
+        msbRow[maskBytes - 1] &= rowBits[maskBytes - 1] | static_cast<uint8_t>(~lastMaskBits);
+      }
+    }
+    return;
+  }
 
-  if (state) {
-    frameBuffer[byteIndex] &= ~(1 << bitPosition);  // Clear bit
-  } else {
-    frameBuffer[byteIndex] |= 1 << bitPosition;  // Set bit
+  // Masks of the black pixels of 8 rows, which share a panel byte in portrait and are transposed together there
+  constexpr int BAND_ROWS = 8;
+  uint8_t* masks = x >= 0 ? static_cast<uint8_t*>(malloc(BAND_ROWS * maskBytes)) : nullptr;
+  if (!masks) {
+    // Starts left of the screen (or out of memory), which the masks don't handle
+    for (int row = firstRow; row < endRow; row++) {
+      const uint8_t* rowBits = bits + row * bytesPerRow;
+      for (int col = std::max(0, -x); col < drawWidth; col++) {
+        if (!(rowBits[col / 8] & (0x80 >> (col % 8)))) {
+          drawPixel(x + col, y + row, true);
+        }
+      }
+    }
+    return;
+  }
+
+  for (int bandStart = firstRow; bandStart < endRow;) {
+    const int bandEnd = std::min(endRow, ((y + bandStart) / BAND_ROWS + 1) * BAND_ROWS - y);
+    for (int row = bandStart; row < bandEnd; row++) {
+      const uint8_t* rowBits = bits + row * bytesPerRow;
+      uint8_t* mask = masks + (row - bandStart) * maskBytes;
+      for (int i = 0; i < maskBytes; i++) {
+        mask[i] = ~rowBits[i];
+      }
+      mask[maskBytes - 1] &= lastMaskBits;
+    }
+    kernels->drawMaskRows(frameBuffer, x, y + bandStart, masks, maskBytes, drawWidth, bandEnd - bandStart, true);
+    if (renderMode == GRAYSCALE_BOTH) {
+      drawGrayMsbMaskRows(x, y + bandStart, masks, maskBytes, drawWidth, bandEnd - bandStart, true);
+    }
+    bandStart = bandEnd;
+  }
+  free(masks);
+}
+
+void GfxRenderer::drawImage2BitPlanes(const uint8_t* highPlane, const uint8_t* lowPlane, const int x, const int y,
+                                      const int width, const int height) const {
+  const int columnBytes = (height + 7) / 8;
+  const int firstRow = std::max(0, -y);
+  const int endRow = std::min(height, getScreenHeight() - y);
+  const int drawWidth = std::min(width, getScreenWidth() - x);
+  if (firstRow >= endRow || drawWidth <= 0) {
+    return;
+  }
+
+  // Pixels of a plane byte pair drawn in this mode, and the gray ones (dark or light, the planes differ)
+  const auto drawnBits = [this](const uint8_t high, const uint8_t low) -> uint8_t {
+    switch (renderMode) {
+      case BW:
+        return high | low;  // All but white
+      case GRAYSCALE_MSB:
+        return high ^ low;
+      default:
+        return ~high & low;  // Dark gray
+    }
+  };
+  const bool state = renderMode == BW;
+  uint8_t anyGray = 0;
+
+  if (orientation == Portrait && x >= 0 && y >= 0 && (y & 7) == 0) {
+    // Logical columns run up the panel in portrait: column c from the right is panel row c (for a full-width image
+    // at x = 0), and its bytes are panel bytes from y / 8 in the same bit order
+    const int byteCount = (endRow + 7) / 8;
+    const uint8_t lastBits = endRow & 7 ? 0xFF << (8 - (endRow & 7)) : 0xFF;
+    for (int column = width - drawWidth; column < width; column++) {
+      const int phyY = HalDisplay::DISPLAY_HEIGHT - x - width + column;
+      uint8_t* panelRow = frameBuffer + phyY * HalDisplay::DISPLAY_WIDTH_BYTES + (y >> 3);
+      uint8_t* msbRow = renderMode == GRAYSCALE_BOTH ? grayMsbRow(phyY) + (y >> 3) : nullptr;
+      const uint8_t* high = highPlane + column * columnBytes;
+      const uint8_t* low = lowPlane + column * columnBytes;
+      for (int i = 0; i < byteCount; i++) {
+        const uint8_t valid = i == byteCount - 1 ? lastBits : 0xFF;
+        const uint8_t gray = (high[i] ^ low[i]) & valid;
+        writePhysicalByte(panelRow + i, drawnBits(high[i], low[i]) & valid, state);
+        if (msbRow) msbRow[i] |= gray;
+        anyGray |= gray;
+      }
+    }
+    if (renderMode == BW) {
+      grayPixelsDrawn |= anyGray != 0;
+    }
+    return;
+  }
+
+  // Masks of the 8 rows of a plane byte: 8 columns of a byte each are transposed into 8 rows of 8 pixels
+  constexpr int BAND_ROWS = 8;
+  const int maskBytes = (drawWidth + 7) / 8;
+  uint8_t* drawn = x >= 0 ? static_cast<uint8_t*>(malloc(2 * BAND_ROWS * maskBytes)) : nullptr;
+  if (!drawn) {
+    // Starts left of the screen (or out of memory), which the masks don't handle
+    static constexpr uint8_t pixel2BitValues[4] = {3, 1, 2, 0};  // From white first to black first
+    for (int row = firstRow; row < endRow; row++) {
+      const int bit = 7 - (row & 7);
+      for (int col = std::max(0, -x); col < drawWidth; col++) {
+        const int offset = (width - 1 - col) * columnBytes + row / 8;
+        const int value = ((highPlane[offset] >> bit) & 1) << 1 | ((lowPlane[offset] >> bit) & 1);
+        drawPixel2Bit(x + col, y + row, pixel2BitValues[value]);
+      }
+    }
+    return;
+  }
+  uint8_t* gray = drawn + BAND_ROWS * maskBytes;
+
+  for (int band = firstRow / BAND_ROWS; band * BAND_ROWS < endRow; band++) {
+    for (int i = 0; i < maskBytes; i++) {
+      uint64_t drawnBlock = 0;
+      uint64_t grayBlock = 0;
+      for (int j = 0; j < 8 && 8 * i + j < drawWidth; j++) {
+        const int offset = (width - 1 - 8 * i - j) * columnBytes + band;
+        const int shift = 56 - 8 * j;
+        drawnBlock |= static_cast<uint64_t>(drawnBits(highPlane[offset], lowPlane[offset])) << shift;
+        grayBlock |= static_cast<uint64_t>(highPlane[offset] ^ lowPlane[offset]) << shift;
+      }
+      drawnBlock = transpose8x8(drawnBlock);
+      grayBlock = transpose8x8(grayBlock);
+      for (int r = 0; r < BAND_ROWS; r++) {
+        drawn[r * maskBytes + i] = static_cast<uint8_t>(drawnBlock >> (56 - 8 * r));
+        gray[r * maskBytes + i] = static_cast<uint8_t>(grayBlock >> (56 - 8 * r));
+      }
+    }
+
+    // Only the rows of the band on screen are drawn
+    const int bandStart = std::max(firstRow, band * BAND_ROWS);
+    const int rows = std::min(endRow, (band + 1) * BAND_ROWS) - bandStart;
+    const int offset = (bandStart - band * BAND_ROWS) * maskBytes;
+    for (int i = 0; i < rows * maskBytes; i++) {
+      anyGray |= gray[offset + i];
+    }
+    kernels->drawMaskRows(frameBuffer, x, y + bandStart, drawn + offset, maskBytes, drawWidth, rows, state);
+    if (renderMode == GRAYSCALE_BOTH) {
+      drawGrayMsbMaskRows(x, y + bandStart, gray + offset, maskBytes, drawWidth, rows, false);
+    }
+  }
+  if (renderMode == BW) {
+    grayPixelsDrawn |= anyGray != 0;
   }
+  free(drawn);
+}
+
+void GfxRenderer::drawGrayMsbMaskRows(const int x, const int y, const uint8_t* masks, const int maskStride,
+                                      const int width, const int rows, const bool state) const {
+  drawGrayMsb([&](auto kernel, const auto& msbRow) {
+    kernel.drawMasks(msbRow, x, y, masks, maskStride, width, rows, state);
+  });
 }
 
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
@@ -118,11 +772,12 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
     LOG_ERR("GFX", "Font %d not found", fontId);
     return;
   }
-  const auto& font = fontIt->second;
+  const EpdFont& font = *fontIt->second.getFont(style);
 
+  const EpdGlyph* previousGlyph = nullptr;
   uint32_t cp;
-  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    renderChar(font, cp, &xpos, &yPos, black, style);
+  while ((cp = font.nextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
+    renderChar(font, cp, &xpos, &yPos, black, &previousGlyph);
   }
 }
 
@@ -131,15 +786,31 @@ void GfxRenderer::drawLine(int x1, int y1, int x2, int y2, const bool state) con
     if (y2 < y1) {
       std::swap(y1, y2);
     }
-    for (int y = y1; y <= y2; y++) {
-      drawPixel(x1, y, state);
+    if (x1 < 0 || x1 >= getScreenWidth()) {
+      return;
+    }
+    y1 = std::max(y1, 0);
+    y2 = std::min(y2, getScreenHeight() - 1);
+    if (y1 <= y2) {
+      kernels->drawVerticalSpan(frameBuffer, x1, y1, y2, state);
+      if (renderMode == GRAYSCALE_BOTH) {
+        drawGrayMsb([&](auto kernel, const auto& msbRow) { kernel.verticalSpan(msbRow, x1, y1, y2, state); });
+      }
     }
   } else if (y1 == y2) {
     if (x2 < x1) {
       std::swap(x1, x2);
     }
-    for (int x = x1; x <= x2; x++) {
-      drawPixel(x, y1, state);
+    if (y1 < 0 || y1 >= getScreenHeight()) {
+      return;
+    }
+    x1 = std::max(x1, 0);
+    x2 = std::min(x2, getScreenWidth() - 1);
+    if (x1 <= x2) {
+      kernels->drawHorizontalSpan(frameBuffer, x1, x2, y1, state);
+      if (renderMode == GRAYSCALE_BOTH) {
+        drawGrayMsb([&](auto kernel, const auto& msbRow) { kernel.horizontalSpan(msbRow, x1, x2, y1, state); });
+      }
     }
   } else {
     // Bresenham's line algorithm — integer arithmetic only
@@ -197,15 +868,20 @@ void GfxRenderer::drawArc(const int maxRadius, const int cx, const int cy, const
   const int innerRadius = std::max(maxRadius - stroke, 0);
   const int outerRadiusSq = maxRadius * maxRadius;
   const int innerRadiusSq = innerRadius * innerRadius;
+  // Each row of the ring is one run [dxMin, dxMax], and both ends only move inwards as dy grows
+  int dxMin = innerRadius;
+  int dxMax = maxRadius;
   for (int dy = 0; dy <= maxRadius; ++dy) {
-    for (int dx = 0; dx <= maxRadius; ++dx) {
-      const int distSq = dx * dx + dy * dy;
-      if (distSq > outerRadiusSq || distSq < innerRadiusSq) {
-        continue;
-      }
-      const int px = cx + xDir * dx;
+    const int dySq = dy * dy;
+    while (dxMax >= 0 && dxMax * dxMax + dySq > outerRadiusSq) {
+      dxMax--;
+    }
+    while (dxMin > 0 && (dxMin - 1) * (dxMin - 1) + dySq >= innerRadiusSq) {
+      dxMin--;
+    }
+    if (dxMin <= dxMax) {
       const int py = cy + yDir * dy;
-      drawPixel(px, py, state);
+      drawLine(cx + xDir * dxMin, py, cx + xDir * dxMax, py, state);
     }
   }
 };
@@ -269,71 +945,39 @@ void GfxRenderer::drawRoundedRect(const int x, const int y, const int width, con
 }
 
 void GfxRenderer::fillRect(const int x, const int y, const int width, const int height, const bool state) const {
-  for (int fillY = y; fillY < y + height; fillY++) {
-    drawLine(x, fillY, x + width - 1, fillY, state);
-  }
-}
-
-// NOTE: Those are in critical path, and need to be templated to avoid runtime checks for every pixel.
-// Any branching must be done outside the loops to avoid performance degradation.
-template <>
-void GfxRenderer::drawPixelDither<Color::Clear>(const int x, const int y) const {
-  // Do nothing
-}
-
-template <>
-void GfxRenderer::drawPixelDither<Color::Black>(const int x, const int y) const {
-  drawPixel(x, y, true);
-}
-
-template <>
-void GfxRenderer::drawPixelDither<Color::White>(const int x, const int y) const {
-  drawPixel(x, y, false);
-}
-
-template <>
-void GfxRenderer::drawPixelDither<Color::LightGray>(const int x, const int y) const {
-  drawPixel(x, y, x % 2 == 0 && y % 2 == 0);
-}
-
-template <>
-void GfxRenderer::drawPixelDither<Color::DarkGray>(const int x, const int y) const {
-  drawPixel(x, y, (x + y) % 2 == 0);  // TODO: maybe find a better pattern?
+  fillRectDither(x, y, width, height, state ? Color::Black : Color::White);
 }
 
 void GfxRenderer::fillRectDither(const int x, const int y, const int width, const int height, Color color) const {
-  if (color == Color::Clear) {
-  } else if (color == Color::Black) {
-    fillRect(x, y, width, height, true);
-  } else if (color == Color::White) {
-    fillRect(x, y, width, height, false);
-  } else if (color == Color::LightGray) {
-    for (int fillY = y; fillY < y + height; fillY++) {
-      for (int fillX = x; fillX < x + width; fillX++) {
-        drawPixelDither<Color::LightGray>(fillX, fillY);
-      }
-    }
-  } else if (color == Color::DarkGray) {
-    for (int fillY = y; fillY < y + height; fillY++) {
-      for (int fillX = x; fillX < x + width; fillX++) {
-        drawPixelDither<Color::DarkGray>(fillX, fillY);
-      }
-    }
+  if (color != Color::Black && color != Color::White && color != Color::LightGray && color != Color::DarkGray) {
+    return;  // Clear
+  }
+
+  // Clip once, the kernel fills whole panel rows
+  const int x1 = std::max(x, 0);
+  const int y1 = std::max(y, 0);
+  const int x2 = std::min(x + width - 1, getScreenWidth() - 1);
+  const int y2 = std::min(y + height - 1, getScreenHeight() - 1);
+  if (x1 > x2 || y1 > y2) {
+    return;
+  }
+  kernels->fillRect(frameBuffer, x1, y1, x2, y2, color);
+  if (renderMode == GRAYSCALE_BOTH) {
+    drawGrayMsb([&](auto kernel, const auto& msbRow) { kernel.rect(msbRow, x1, y1, x2, y2, color); });
   }
 }
 
-template <Color color>
-void GfxRenderer::fillArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir) const {
+// Quarter disc, filled one row at a time
+void GfxRenderer::fillArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir,
+                          const Color color) const {
   const int radiusSq = maxRadius * maxRadius;
+  int dxMax = maxRadius;
   for (int dy = 0; dy <= maxRadius; ++dy) {
-    for (int dx = 0; dx <= maxRadius; ++dx) {
-      const int distSq = dx * dx + dy * dy;
-      const int px = cx + xDir * dx;
-      const int py = cy + yDir * dy;
-      if (distSq <= radiusSq) {
-        drawPixelDither<color>(px, py);
-      }
+    while (dxMax * dxMax + dy * dy > radiusSq) {
+      dxMax--;
     }
+    const int startX = xDir > 0 ? cx : cx - dxMax;
+    fillRectDither(startX, cy + yDir * dy, dxMax + 1, 1, color);
   }
 }
 
@@ -374,39 +1018,20 @@ void GfxRenderer::fillRoundedRect(const int x, const int y, const int width, con
     fillRectDither(x + width - maxRadius - 1, rightFillTop, maxRadius + 1, rightFillBottom - rightFillTop + 1, color);
   }
 
-  auto fillArcTemplated = [this](int maxRadius, int cx, int cy, int xDir, int yDir, Color color) {
-    switch (color) {
-      case Color::Clear:
-        break;
-      case Color::Black:
-        fillArc<Color::Black>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::White:
-        fillArc<Color::White>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::LightGray:
-        fillArc<Color::LightGray>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::DarkGray:
-        fillArc<Color::DarkGray>(maxRadius, cx, cy, xDir, yDir);
-        break;
-    }
-  };
-
   if (roundTopLeft) {
-    fillArcTemplated(maxRadius, x + maxRadius, y + maxRadius, -1, -1, color);
+    fillArc(maxRadius, x + maxRadius, y + maxRadius, -1, -1, color);
   }
 
   if (roundTopRight) {
-    fillArcTemplated(maxRadius, x + width - maxRadius - 1, y + maxRadius, 1, -1, color);
+    fillArc(maxRadius, x + width - maxRadius - 1, y + maxRadius, 1, -1, color);
   }
 
   if (roundBottomRight) {
-    fillArcTemplated(maxRadius, x + width - maxRadius - 1, y + height - maxRadius - 1, 1, 1, color);
+    fillArc(maxRadius, x + width - maxRadius - 1, y + height - maxRadius - 1, 1, 1, color);
   }
 
   if (roundBottomLeft) {
-    fillArcTemplated(maxRadius, x + maxRadius, y + height - maxRadius - 1, -1, 1, color);
+    fillArc(maxRadius, x + maxRadius, y + height - maxRadius - 1, -1, 1, color);
   }
 }
 
@@ -437,6 +1062,49 @@ void GfxRenderer::drawIcon(const uint8_t bitmap[], const int x, const int y, con
   display.drawImageTransparent(bitmap, y, getScreenWidth() - width - x, height, width);
 }
 
+namespace {
+// Collects the rows of a bitmap, which arrive one at a time from the top or from the bottom, into bands of the 8
+// screen rows that share a panel byte in portrait. Each band is drawn once it is complete, a byte at a time.
+class BitmapRowBand {
+ public:
+  BitmapRowBand(uint8_t* rows, const int stride) : rows(rows), stride(stride) {}
+
+  // Buffer for screen row y (>= 0), the band being collected is drawn first if y is outside of it
+  template <typename DrawRows>
+  uint8_t* row(const int y, const DrawRows& drawRows) {
+    const int yBand = y & ~7;
+    if (yBand != bandY) {
+      flush(drawRows);
+      bandY = yBand;
+      firstY = lastY = y;
+    } else {
+      firstY = std::min(firstY, y);
+      lastY = std::max(lastY, y);
+    }
+    return rows + (y - bandY) * stride;
+  }
+
+  // drawRows(rows, y, count) draws the collected rows firstY..lastY
+  template <typename DrawRows>
+  void flush(const DrawRows& drawRows) {
+    if (bandY >= 0) {
+      drawRows(rows + (firstY - bandY) * stride, firstY, lastY - firstY + 1);
+    }
+    bandY = -1;
+  }
+
+ private:
+  uint8_t* rows;
+  int stride;
+  int bandY = -1;
+  int firstY = 0;
+  int lastY = 0;
+};
+
+// Bitmap coordinate to screen offset, 16.16 fixed point so scaling needs no float math per pixel
+inline int scaleCoordinate(const int value, const int32_t scale_fp) { return (value * scale_fp) >> 16; }
+}  // namespace
+
 void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, const int maxWidth, const int maxHeight,
                              const float cropX, const float cropY) const {
   // For 1-bit bitmaps, use optimized 1-bit rendering path (no crop support for 1-bit)
@@ -461,6 +1129,10 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
     isScaled = true;
   }
   LOG_DBG("GFX", "Scaling by %f - %s", scale, isScaled ? "scaled" : "not scaled");
+  const auto scale_fp = static_cast<int32_t>(scale * 65536.0f + 0.5f);
+  if (isScaled && drawBitmapScaled(bitmap, x, y, cropPixX, cropPixY, scale_fp)) {
+    return;
+  }
 
   // Calculate output row size (2 bits per pixel, packed into bytes)
   // IMPORTANT: Use int, not uint8_t, to avoid overflow for images > 1020 pixels wide
@@ -475,23 +1147,38 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
     return;
   }
 
+  // Pixels are clipped below, so they can go straight to the orientation kernel
+  const auto drawPixelKernel = kernels->drawPixel;
+  const int screenWidth = getScreenWidth();
+  const int screenHeight = getScreenHeight();
+
+  // Unscaled rows are copied into bands of 2-bit rows and drawn a panel byte at a time with drawImage2Bit
+  const int drawWidth = std::min(bitmap.getWidth() - 2 * cropPixX, screenWidth - x);
+  const int bandStride = (drawWidth + 3) / 4;
+  uint8_t* bandRows = !isScaled && x >= 0 && drawWidth > 0 ? static_cast<uint8_t*>(malloc(8 * bandStride)) : nullptr;
+  BitmapRowBand band(bandRows, bandStride);
+  const auto drawBand = [this, x, drawWidth](const uint8_t* rows, const int rowY, const int count) {
+    drawImage2Bit(rows, x, rowY, drawWidth, count);
+  };
+  // The crop is a shift of the row by cropPixX pixels
+  const int cropBytes = cropPixX / 4;
+  const int cropShift = (cropPixX % 4) * 2;
+
   for (int bmpY = 0; bmpY < (bitmap.getHeight() - cropPixY); bmpY++) {
     // The BMP's (0, 0) is the bottom-left corner (if the height is positive, top-left if negative).
     // Screen's (0, 0) is the top-left corner.
     int screenY = -cropPixY + (bitmap.isTopDown() ? bmpY : bitmap.getHeight() - 1 - bmpY);
     if (isScaled) {
-      screenY = std::floor(screenY * scale);
+      screenY = scaleCoordinate(screenY, scale_fp);
     }
     screenY += y;  // the offset should not be scaled
-    if (screenY >= getScreenHeight()) {
+    if (screenY >= screenHeight) {
       break;
     }
 
     if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
       LOG_ERR("GFX", "Failed to read row %d from bitmap", bmpY);
-      free(outputRow);
-      free(rowBytes);
-      return;
+      break;
     }
 
     if (screenY < 0) {
@@ -503,13 +1190,23 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
       continue;
     }
 
+    if (bandRows) {
+      uint8_t* row = band.row(screenY, drawBand);
+      for (int i = 0; i < bandStride; i++) {
+        const uint8_t next = cropShift && i + cropBytes + 1 < outputRowSize ? outputRow[i + cropBytes + 1] : 0;
+        row[i] = cropShift ? (outputRow[i + cropBytes] << cropShift) | (next >> (8 - cropShift))
+                           : outputRow[i + cropBytes];
+      }
+      continue;
+    }
+
     for (int bmpX = cropPixX; bmpX < bitmap.getWidth() - cropPixX; bmpX++) {
       int screenX = bmpX - cropPixX;
       if (isScaled) {
-        screenX = std::floor(screenX * scale);
+        screenX = scaleCoordinate(screenX, scale_fp);
       }
       screenX += x;  // the offset should not be scaled
-      if (screenX >= getScreenWidth()) {
+      if (screenX >= screenWidth) {
         break;
       }
       if (screenX < 0) {
@@ -518,16 +1215,19 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
 
       const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
 
-      if (renderMode == BW && val < 3) {
-        drawPixel(screenX, screenY);
-      } else if (renderMode == GRAYSCALE_MSB && (val == 1 || val == 2)) {
-        drawPixel(screenX, screenY, false);
-      } else if (renderMode == GRAYSCALE_LSB && val == 1) {
-        drawPixel(screenX, screenY, false);
+      if (renderMode == BW) {
+        if (val < 3) {
+          drawPixelKernel(frameBuffer, screenX, screenY, true);
+        }
+        grayPixelsDrawn |= val == 1 || val == 2;
+      } else {
+        drawPixel2Bit(screenX, screenY, val);
       }
     }
   }
+  band.flush(drawBand);
 
+  free(bandRows);
   free(outputRow);
   free(rowBytes);
 }
@@ -544,6 +1244,14 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
     scale = std::min(scale, static_cast<float>(maxHeight) / static_cast<float>(bitmap.getHeight()));
     isScaled = true;
   }
+  const auto scale_fp = static_cast<int32_t>(scale * 65536.0f + 0.5f);
+
+  const int screenWidth = getScreenWidth();
+  const int screenHeight = getScreenHeight();
+  const int drawWidth = std::min(bitmap.getWidth(), screenWidth - x);
+  if (!isScaled && x >= 0 && drawWidth > 0 && drawBitmap1BitMasks(bitmap, x, y, drawWidth)) {
+    return;
+  }
 
   // For 1-bit BMP, output is still 2-bit packed (for consistency with readNextRow)
   const int outputRowSize = (bitmap.getWidth() + 3) / 4;
@@ -557,6 +1265,10 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
     return;
   }
 
+  // Pixels are clipped below, so they can go straight to the orientation kernel unless both gray planes are drawn
+  const auto drawPixelKernel = kernels->drawPixel;
+  const bool bothPlanes = renderMode == GRAYSCALE_BOTH;
+
   for (int bmpY = 0; bmpY < bitmap.getHeight(); bmpY++) {
     // Read rows sequentially using readNextRow
     if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
@@ -568,8 +1280,8 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
 
     // Calculate screen Y based on whether BMP is top-down or bottom-up
     const int bmpYOffset = bitmap.isTopDown() ? bmpY : bitmap.getHeight() - 1 - bmpY;
-    int screenY = y + (isScaled ? static_cast<int>(std::floor(bmpYOffset * scale)) : bmpYOffset);
-    if (screenY >= getScreenHeight()) {
+    int screenY = y + (isScaled ? scaleCoordinate(bmpYOffset, scale_fp) : bmpYOffset);
+    if (screenY >= screenHeight) {
       continue;  // Continue reading to keep row counter in sync
     }
     if (screenY < 0) {
@@ -577,8 +1289,8 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
     }
 
     for (int bmpX = 0; bmpX < bitmap.getWidth(); bmpX++) {
-      int screenX = x + (isScaled ? static_cast<int>(std::floor(bmpX * scale)) : bmpX);
-      if (screenX >= getScreenWidth()) {
+      int screenX = x + (isScaled ? scaleCoordinate(bmpX, scale_fp) : bmpX);
+      if (screenX >= screenWidth) {
         break;
       }
       if (screenX < 0) {
@@ -590,8 +1302,10 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
 
       // For 1-bit source: 0 or 1 -> map to black (0,1,2) or white (3)
       // val < 3 means black pixel (draw it)
-      if (val < 3) {
+      if (val < 3 && bothPlanes) {
         drawPixel(screenX, screenY, true);
+      } else if (val < 3) {
+        drawPixelKernel(frameBuffer, screenX, screenY, true);
       }
       // White pixels (val == 3) are not drawn (leave background)
     }
@@ -601,6 +1315,118 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
   free(rowBytes);
 }
 
+bool GfxRenderer::drawBitmapScaled(const Bitmap& bitmap, const int x, const int y, const int cropPixX,
+                                   const int cropPixY, const int32_t scale_fp) const {
+  const int srcWidth = bitmap.getWidth() - 2 * cropPixX;
+  const int srcHeight = bitmap.getHeight() - 2 * cropPixY;
+  const int outWidth = std::max(1, scaleCoordinate(srcWidth, scale_fp));
+  const int outHeight = std::max(1, scaleCoordinate(srcHeight, scale_fp));
+  AreaScaler scaler;
+  if (srcWidth <= 0 || srcHeight <= 0 || !scaler.begin(srcWidth, srcHeight, outWidth, outHeight)) {
+    return false;
+  }
+
+  const int bandStride = (outWidth + 3) / 4;
+  auto* grayRow = static_cast<uint8_t*>(malloc(bitmap.getWidth()));
+  auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
+  auto* bandRows = static_cast<uint8_t*>(malloc(8 * bandStride));
+  if (!grayRow || !rowBytes || !bandRows) {
+    free(grayRow);
+    free(rowBytes);
+    free(bandRows);
+    return false;
+  }
+
+  // The averages fall between the panel's gray levels, so the scaled image is dithered at its own resolution
+  AtkinsonDitherer ditherer(outWidth);
+  BitmapRowBand band(bandRows, bandStride);
+  const auto drawBand = [this, x, outWidth](const uint8_t* rows, const int rowY, const int count) {
+    drawImage2Bit(rows, x, rowY, outWidth, count);
+  };
+  const int screenHeight = getScreenHeight();
+  // Bottom-up rows are scaled in file order too, the output rows then come from the bottom
+  const bool topDown = bitmap.isTopDown();
+  int outY = 0;
+
+  for (int bmpY = 0; bmpY < bitmap.getHeight() - cropPixY; bmpY++) {
+    if (bitmap.readNextRowGray(grayRow, rowBytes) != BmpReaderError::Ok) {
+      LOG_ERR("GFX", "Failed to read row %d from bitmap", bmpY);
+      break;
+    }
+    if (bmpY < cropPixY) {
+      continue;
+    }
+
+    scaler.addRow(grayRow + cropPixX);
+    bool pastScreen = false;
+    while (const uint8_t* scaled = scaler.nextRow()) {
+      const int screenY = y + (topDown ? outY : outHeight - 1 - outY);
+      pastScreen = topDown ? screenY >= screenHeight : screenY < 0;
+      if (screenY >= 0 && screenY < screenHeight) {
+        uint8_t* row = band.row(screenY, drawBand);
+        memset(row, 0, bandStride);
+        for (int i = 0; i < outWidth; i++) {
+          row[i / 4] |= ditherer.processPixel(adjustPixel(scaled[i]), i) << (6 - (i % 4) * 2);
+        }
+      }
+      ditherer.nextRow();
+      outY++;
+    }
+    if (pastScreen) {
+      break;
+    }
+  }
+  band.flush(drawBand);
+
+  free(grayRow);
+  free(rowBytes);
+  free(bandRows);
+  return true;
+}
+
+bool GfxRenderer::drawBitmap1BitMasks(const Bitmap& bitmap, const int x, const int y, const int drawWidth) const {
+  const int maskBytes = (bitmap.getWidth() + 7) / 8;
+  auto* bandRows = static_cast<uint8_t*>(malloc(9 * maskBytes));  // A band of 8 rows and one for rows off screen
+  auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
+  if (!bandRows || !rowBytes) {
+    free(bandRows);
+    free(rowBytes);
+    return false;
+  }
+
+  // The masks hold the whole bitmap row, the bits right of the screen edge are cleared before drawing
+  const uint8_t lastMaskBits = drawWidth & 7 ? 0xFF << (8 - (drawWidth & 7)) : 0xFF;
+  const int lastMaskByte = (drawWidth - 1) / 8;
+  const auto drawBand = [this, x, maskBytes, drawWidth](const uint8_t* rows, const int rowY, const int count) {
+    kernels->drawMaskRows(frameBuffer, x, rowY, rows, maskBytes, drawWidth, count, true);
+    if (renderMode == GRAYSCALE_BOTH) {
+      drawGrayMsbMaskRows(x, rowY, rows, maskBytes, drawWidth, count, true);
+    }
+  };
+  BitmapRowBand band(bandRows, maskBytes);
+  uint8_t* offscreenRow = bandRows + 8 * maskBytes;
+  const int screenHeight = getScreenHeight();
+
+  for (int bmpY = 0; bmpY < bitmap.getHeight(); bmpY++) {
+    const int screenY = y + (bitmap.isTopDown() ? bmpY : bitmap.getHeight() - 1 - bmpY);
+    const bool onScreen = screenY >= 0 && screenY < screenHeight;
+    uint8_t* mask = onScreen ? band.row(screenY, drawBand) : offscreenRow;
+    // Rows off screen are still read, the next one follows in the file
+    if (bitmap.readNextRowMask(mask, rowBytes) != BmpReaderError::Ok) {
+      LOG_ERR("GFX", "Failed to read row %d from 1-bit bitmap", bmpY);
+      // The band's rows from before are complete, this one is left blank
+      if (onScreen) memset(mask, 0, maskBytes);
+      break;
+    }
+    mask[lastMaskByte] &= lastMaskBits;
+  }
+  band.flush(drawBand);
+
+  free(bandRows);
+  free(rowBytes);
+  return true;
+}
+
 void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state) const {
   if (numPoints < 3) return;
 
@@ -660,8 +1486,12 @@ void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoi
       if (endX >= getScreenWidth()) endX = getScreenWidth() - 1;
 
       // Draw horizontal line
-      for (int x = startX; x <= endX; x++) {
-        drawPixel(x, scanY, state);
+      if (startX <= endX) {
+        kernels->drawHorizontalSpan(frameBuffer, startX, endX, scanY, state);
+        if (renderMode == GRAYSCALE_BOTH) {
+          drawGrayMsb(
+              [&](auto kernel, const auto& msbRow) { kernel.horizontalSpan(msbRow, startX, endX, scanY, state); });
+        }
       }
     }
   }
@@ -674,18 +1504,27 @@ static unsigned long start_ms = 0;
 
 void GfxRenderer::clearScreen(const uint8_t color) const {
   start_ms = millis();
+  grayPixelsDrawn = false;
   display.clearScreen(color);
 }
 
 void GfxRenderer::invertScreen() const {
-  for (int i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
+  for (uint32_t i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
     frameBuffer[i] = ~frameBuffer[i];
   }
 }
 
 void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const {
-  auto elapsed = millis() - start_ms;
+  [[maybe_unused]] const auto elapsed = millis() - start_ms;
   LOG_DBG("GFX", "Time = %lu ms from clearScreen to displayBuffer", elapsed);
+
+  DamageTracker::Rect window;
+  const DamageTracker::Result damage = damageTracker.update(frameBuffer, &window);
+  if (refreshMode == HalDisplay::FAST_REFRESH && damage == DamageTracker::Window) {
+    display.displayWindow(window.x, window.y, window.width, window.height, fadingFix);
+    return;
+  }
+  // Tile hashes can collide, so NoChange is only a hint: the whole frame is still sent and refreshed
   display.displayBuffer(refreshMode, fadingFix);
 }
 
@@ -755,15 +1594,7 @@ int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, const EpdFo
     return 0;
   }
 
-  uint32_t cp;
-  int width = 0;
-  const auto& font = fontIt->second;
-  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    const EpdGlyph* glyph = font.getGlyph(cp, style);
-    if (!glyph) glyph = font.getGlyph(REPLACEMENT_GLYPH, style);
-    if (glyph) width += glyph->advanceX;
-  }
-  return width;
+  return fontIt->second.getFont(style)->getTextAdvanceX(text);
 }
 
 int GfxRenderer::getFontAscenderSize(const int fontId) const {
@@ -808,7 +1639,8 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     return;
   }
 
-  const auto& font = fontIt->second;
+  const EpdFont& font = *fontIt->second.getFont(style);
+  const EpdFontData* fontData = font.data;
 
   // For 90° clockwise rotation:
   // Original (glyphX, glyphY) -> Rotated (glyphY, -glyphX)
@@ -816,17 +1648,19 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
 
   int yPos = y;  // Current Y position (decreases as we draw characters)
 
+  const EpdGlyph* previous = nullptr;
   uint32_t cp;
-  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    const EpdGlyph* glyph = font.getGlyph(cp, style);
+  while ((cp = font.nextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
+    const EpdGlyph* glyph = font.getGlyph(cp);
     if (!glyph) {
-      glyph = font.getGlyph(REPLACEMENT_GLYPH, style);
+      glyph = font.getGlyph(REPLACEMENT_GLYPH);
     }
     if (!glyph) {
       continue;
     }
+    yPos -= font.getKerning(previous, glyph);
+    previous = glyph;
 
-    const EpdFontData* fontData = font.getData(style);
     const int is2Bit = fontData->is2Bit;
     const uint8_t width = glyph->width;
     const uint8_t height = glyph->height;
@@ -834,11 +1668,28 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     const int top = glyph->top;
 
     const uint8_t* bitmap = getGlyphBitmap(fontData, glyph);
+    const bool rle = fontData->rleBitmaps;
+    if (bitmap != nullptr && is2Bit && renderMode == BW && !grayPixelsDrawn && !rle) {
+      grayPixelsDrawn = hasGrayValues(bitmap, width * height);
+    }
 
     if (bitmap != nullptr) {
+      // Run-length glyphs are read in the same row-major order the loops below walk
+      EpdGlyphRuns runs(bitmap, glyph->dataLength);
+      uint8_t runValue = 0;
+      int runLeft = 0;
       for (int glyphY = 0; glyphY < height; glyphY++) {
         for (int glyphX = 0; glyphX < width; glyphX++) {
           const int pixelPosition = glyphY * width + glyphX;
+          if (rle) {
+            if (runLeft == 0) {
+              runs.next(&runValue, &runLeft);
+              if (is2Bit && renderMode == BW && (runValue == 1 || runValue == 2)) {
+                grayPixelsDrawn = true;
+              }
+            }
+            runLeft--;
+          }
 
           // 90° clockwise rotation transformation:
           // screenX = x + (ascender - top + glyphY)
@@ -847,20 +1698,18 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
           const int screenY = yPos - left - glyphX;
 
           if (is2Bit) {
-            const uint8_t byte = bitmap[pixelPosition / 4];
-            const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
-            const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
+            const uint8_t byte = rle ? runValue : bitmap[pixelPosition / 4];
+            const uint8_t bit_index = rle ? 0 : (3 - pixelPosition % 4) * 2;
+            const uint8_t bmpVal = (3 - (byte >> bit_index)) & 0x3;
 
             if (renderMode == BW && bmpVal < 3) {
               drawPixel(screenX, screenY, black);
-            } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-              drawPixel(screenX, screenY, false);
-            } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
-              drawPixel(screenX, screenY, false);
+            } else if (renderMode != BW) {
+              drawPixel2Bit(screenX, screenY, bmpVal);
             }
           } else {
-            const uint8_t byte = bitmap[pixelPosition / 8];
-            const uint8_t bit_index = 7 - (pixelPosition % 8);
+            const uint8_t byte = rle ? runValue : bitmap[pixelPosition / 8];
+            const uint8_t bit_index = rle ? 0 : 7 - (pixelPosition % 8);
 
             if ((byte >> bit_index) & 1) {
               drawPixel(screenX, screenY, black);
@@ -882,11 +1731,22 @@ size_t GfxRenderer::getBufferSize() { return HalDisplay::BUFFER_SIZE; }
 // unused
 // void GfxRenderer::grayscaleRevert() const { display.grayscaleRevert(); }
 
-void GfxRenderer::copyGrayscaleLsbBuffers() const { display.copyGrayscaleLsbBuffers(frameBuffer); }
+// The grayscale passes overwrite the panel RAM, so the next BW frame has to be sent in full
+
+void GfxRenderer::copyGrayscaleLsbBuffers() const {
+  damageTracker.invalidate();
+  display.copyGrayscaleLsbBuffers(frameBuffer);
+}
 
-void GfxRenderer::copyGrayscaleMsbBuffers() const { display.copyGrayscaleMsbBuffers(frameBuffer); }
+void GfxRenderer::copyGrayscaleMsbBuffers() const {
+  damageTracker.invalidate();
+  display.copyGrayscaleMsbBuffers(frameBuffer);
+}
 
-void GfxRenderer::displayGrayBuffer() const { display.displayGrayBuffer(fadingFix); }
+void GfxRenderer::displayGrayBuffer() const {
+  damageTracker.invalidate();
+  display.displayGrayBuffer(fadingFix);
+}
 
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
@@ -897,6 +1757,66 @@ void GfxRenderer::freeBwBufferChunks() {
   }
 }
 
+void GfxRenderer::freeGrayMsbChunks() {
+  for (auto& grayMsbChunk : grayMsbChunks) {
+    if (grayMsbChunk) {
+      free(grayMsbChunk);
+      grayMsbChunk = nullptr;
+    }
+  }
+}
+
+bool GfxRenderer::allocateGrayMsbChunks() {
+  for (auto& grayMsbChunk : grayMsbChunks) {
+    if (!grayMsbChunk) {
+      grayMsbChunk = static_cast<uint8_t*>(malloc(BW_BUFFER_CHUNK_SIZE));
+    }
+    if (!grayMsbChunk) {
+      freeGrayMsbChunks();
+      return false;
+    }
+    // Same as clearScreen(0x00) for the frame buffer
+    memset(grayMsbChunk, 0x00, BW_BUFFER_CHUNK_SIZE);
+  }
+  return true;
+}
+
+void GfxRenderer::renderGrayscale(const std::function<void()>& render) {
+  // Save BW buffer for restoration after grayscale pass
+  storeBwBuffer();
+
+  if (allocateGrayMsbChunks()) {
+    // Single pass: LSB plane into the frame buffer, MSB plane into the chunks
+    clearScreen(0x00);
+    setRenderMode(GRAYSCALE_BOTH);
+    render();
+    copyGrayscaleLsbBuffers();
+
+    for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+      memcpy(frameBuffer + i * BW_BUFFER_CHUNK_SIZE, grayMsbChunks[i], BW_BUFFER_CHUNK_SIZE);
+    }
+    freeGrayMsbChunks();
+    copyGrayscaleMsbBuffers();
+  } else {
+    LOG_DBG("GFX", "No memory for a second gray plane, rendering LSB and MSB separately");
+    clearScreen(0x00);
+    setRenderMode(GRAYSCALE_LSB);
+    render();
+    copyGrayscaleLsbBuffers();
+
+    clearScreen(0x00);
+    setRenderMode(GRAYSCALE_MSB);
+    render();
+    copyGrayscaleMsbBuffers();
+  }
+
+  displayGrayBuffer();
+  setRenderMode(BW);
+
+  // Restore BW buffer
+  restoreBwBuffer();
+}
+
 /**
  * This should be called before grayscale buffers are populated.
  * A `restoreBwBuffer` call should always follow the grayscale render if this method was called.
@@ -962,6 +1882,7 @@ void GfxRenderer::restoreBwBuffer() {
     memcpy(frameBuffer + offset, bwBufferChunks[i], BW_BUFFER_CHUNK_SIZE);
   }
 
+  damageTracker.invalidate();
   display.cleanupGrayscaleBuffers(frameBuffer);
 
   freeBwBufferChunks();
@@ -974,15 +1895,28 @@ void GfxRenderer::restoreBwBuffer() {
  */
 void GfxRenderer::cleanupGrayscaleWithFrameBuffer() const {
   if (frameBuffer) {
+    damageTracker.invalidate();
     display.cleanupGrayscaleBuffers(frameBuffer);
   }
 }
 
-void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp, int* x, const int* y,
-                             const bool pixelState, const EpdFontFamily::Style style) const {
-  const EpdGlyph* glyph = fontFamily.getGlyph(cp, style);
+// Reads `count` (1-8) bits starting at `bitPos` from an MSB-first packed bitstream, right-aligned in the result
+static inline uint8_t readBits(const uint8_t* bits, const int bitPos, const int count) {
+  const uint8_t* p = bits + (bitPos >> 3);
+  const int shift = bitPos & 7;
+  uint16_t window = static_cast<uint16_t>(p[0] << 8);
+  // Only touch the following byte when the run actually extends into it, glyph bitmaps are not padded
+  if (shift + count > 8) {
+    window |= p[1];
+  }
+  return static_cast<uint8_t>((window << shift) >> (16 - count)) & static_cast<uint8_t>((1u << count) - 1);
+}
+
+void GfxRenderer::renderChar(const EpdFont& font, const uint32_t cp, int* x, const int* y, const bool pixelState,
+                             const EpdGlyph** previousGlyph) const {
+  const EpdGlyph* glyph = font.getGlyph(cp);
   if (!glyph) {
-    glyph = fontFamily.getGlyph(REPLACEMENT_GLYPH, style);
+    glyph = font.getGlyph(REPLACEMENT_GLYPH);
   }
 
   // no glyph?
@@ -991,48 +1925,164 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
     return;
   }
 
-  const EpdFontData* fontData = fontFamily.getData(style);
-  const int is2Bit = fontData->is2Bit;
-  const uint8_t width = glyph->width;
-  const uint8_t height = glyph->height;
-  const int left = glyph->left;
+  *x += font.getKerning(*previousGlyph, glyph);
+  *previousGlyph = glyph;
 
-  const uint8_t* bitmap = getGlyphBitmap(fontData, glyph);
+  const EpdFontData* fontData = font.data;
+  const int width = glyph->width;
+  const int height = glyph->height;
 
+  const uint8_t* bitmap = (width > 0 && height > 0) ? getGlyphBitmap(fontData, glyph) : nullptr;
   if (bitmap != nullptr) {
-    for (int glyphY = 0; glyphY < height; glyphY++) {
-      const int screenY = *y - glyph->top + glyphY;
-      for (int glyphX = 0; glyphX < width; glyphX++) {
-        const int pixelPosition = glyphY * width + glyphX;
-        const int screenX = *x + left + glyphX;
-
-        if (is2Bit) {
-          const uint8_t byte = bitmap[pixelPosition / 4];
-          const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
-          // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
-          // we swap this to better match the way images and screen think about colors:
-          // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
-
-          if (renderMode == BW && bmpVal < 3) {
-            // Black (also paints over the grays in BW mode)
-            drawPixel(screenX, screenY, pixelState);
-          } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-            // Light gray (also mark the MSB if it's going to be a dark gray too)
-            // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
-            drawPixel(screenX, screenY, false);
-          } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
-            // Dark gray
-            drawPixel(screenX, screenY, false);
+    // Which 2-bit source values produce ink in the current render mode (bit n set = value n is drawn).
+    // The direct value from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black.
+    //   BW:            anything but white is drawn black (also paints over the grays)
+    //   GRAYSCALE_MSB: light and dark gray (marks the MSB for dark gray too)
+    //   GRAYSCALE_LSB: dark gray only
+    // GRAYSCALE_BOTH draws the LSB values into the frame buffer and the MSB values into the second plane.
+    constexpr uint8_t msbInkValues = 0b0110;
+    uint8_t inkValues = 0b0010;
+    if (fontData->is2Bit) {
+      inkValues = renderMode == BW ? 0b1110 : renderMode == GRAYSCALE_MSB ? msbInkValues : 0b0100;
+      if (renderMode == BW && !grayPixelsDrawn && !fontData->rleBitmaps) {
+        grayPixelsDrawn = hasGrayValues(bitmap, width * height);
+      }
+    }
+    const bool bothPlanes = renderMode == GRAYSCALE_BOTH;
+    // Gray buffers flag pixels in reverse: 0 leave alone, 1 update
+    const bool clearBits = fontData->is2Bit && renderMode != BW ? false : pixelState;
+
+    // Glyph top-left in logical coordinates
+    const int originX = *x + glyph->left;
+    const int originY = *y - glyph->top;
+
+    if (fontData->rleBitmaps) {
+      // 1-bit glyphs mark the same pixels in both planes
+      renderGlyphRuns(glyph, bitmap, originX, originY, fontData->is2Bit, inkValues,
+                      fontData->is2Bit ? msbInkValues : inkValues, clearBits);
+      *x += glyph->advanceX;
+      return;
+    }
+
+    // Map the glyph onto physical panel rows once. Each physical row ("line") is a contiguous run of pixels that
+    // walks the glyph bitmap with a fixed step, so the per-pixel orientation transform and bounds check go away.
+    int lineCount, lineLength;  // Number of physical rows covered, pixels per row
+    int phyYStart, phyYStep;    // Physical row of the first line and direction of the following ones
+    int phyXStart;              // Physical column of the first pixel in each line (pixels run left to right)
+    int srcStart, srcLineStep, srcPixelStep;  // Glyph pixel index of the first pixel, per line and per pixel
+    switch (orientation) {
+      case Portrait:
+        // Glyph columns become panel rows, glyph rows run left to right
+        lineCount = width;
+        lineLength = height;
+        phyYStart = HalDisplay::DISPLAY_HEIGHT - 1 - originX;
+        phyYStep = -1;
+        phyXStart = originY;
+        srcStart = 0;
+        srcLineStep = 1;
+        srcPixelStep = width;
+        break;
+      case LandscapeClockwise:
+        lineCount = height;
+        lineLength = width;
+        phyYStart = HalDisplay::DISPLAY_HEIGHT - 1 - originY;
+        phyYStep = -1;
+        phyXStart = HalDisplay::DISPLAY_WIDTH - originX - width;
+        srcStart = width - 1;
+        srcLineStep = width;
+        srcPixelStep = -1;
+        break;
+      case PortraitInverted:
+        lineCount = width;
+        lineLength = height;
+        phyYStart = originX;
+        phyYStep = 1;
+        phyXStart = HalDisplay::DISPLAY_WIDTH - originY - height;
+        srcStart = (height - 1) * width;
+        srcLineStep = 1;
+        srcPixelStep = -width;
+        break;
+      case LandscapeCounterClockwise:
+      default:
+        lineCount = height;
+        lineLength = width;
+        phyYStart = originY;
+        phyYStep = 1;
+        phyXStart = originX;
+        srcStart = 0;
+        srcLineStep = width;
+        srcPixelStep = 1;
+        break;
+    }
+
+    // Clip once against the panel
+    const int firstPixel = std::max(0, -phyXStart);
+    const int endPixel = std::min(lineLength, HalDisplay::DISPLAY_WIDTH - phyXStart);
+    int firstLine = 0;
+    int endLine = lineCount;
+    if (phyYStep > 0) {
+      firstLine = std::max(0, -phyYStart);
+      endLine = std::min(lineCount, HalDisplay::DISPLAY_HEIGHT - phyYStart);
+    } else {
+      firstLine = std::max(0, phyYStart - (HalDisplay::DISPLAY_HEIGHT - 1));
+      endLine = std::min(lineCount, phyYStart + 1);
+    }
+
+    // 1-bit glyph rows that run left to right on the panel can be copied straight from the packed bitstream
+    const bool contiguous = !fontData->is2Bit && srcPixelStep == 1;
+
+    for (int line = firstLine; line < endLine; line++) {
+      const int phyY = phyYStart + line * phyYStep;
+      uint8_t* row = frameBuffer + phyY * HalDisplay::DISPLAY_WIDTH_BYTES;
+      uint8_t* msbRow = bothPlanes ? grayMsbRow(phyY) : nullptr;
+      const int lineSrc = srcStart + line * srcLineStep;
+
+      // Gather each run of pixels that shares a framebuffer byte and write it with a single OR / AND
+      int pixel = firstPixel;
+      while (pixel < endPixel) {
+        const int phyX = phyXStart + pixel;
+        const int bitInByte = phyX & 7;
+        const int count = std::min(8 - bitInByte, endPixel - pixel);
+
+        uint8_t bits = 0;
+        uint8_t msbBits = 0;  // Only used for the second plane in GRAYSCALE_BOTH
+        if (contiguous) {
+          bits = readBits(bitmap, lineSrc + pixel, count);
+          msbBits = bits;
+        } else if (fontData->is2Bit) {
+          int src = lineSrc + pixel * srcPixelStep;
+          for (int i = 0; i < count; i++, src += srcPixelStep) {
+            const uint8_t value = (bitmap[src >> 2] >> ((3 - (src & 3)) * 2)) & 0x3;
+            bits = static_cast<uint8_t>((bits << 1) | ((inkValues >> value) & 1));
+            msbBits = static_cast<uint8_t>((msbBits << 1) | ((msbInkValues >> value) & 1));
           }
         } else {
-          const uint8_t byte = bitmap[pixelPosition / 8];
-          const uint8_t bit_index = 7 - (pixelPosition % 8);
+          int src = lineSrc + pixel * srcPixelStep;
+          for (int i = 0; i < count; i++, src += srcPixelStep) {
+            bits = static_cast<uint8_t>((bits << 1) | ((bitmap[src >> 3] >> (7 - (src & 7))) & 1));
+          }
+          msbBits = bits;
+        }
 
-          if ((byte >> bit_index) & 1) {
-            drawPixel(screenX, screenY, pixelState);
+        // MSB first: align the run to its position within the byte
+        const int shift = 8 - bitInByte - count;
+        if (bits) {
+          const uint8_t mask = static_cast<uint8_t>(bits << shift);
+          if (clearBits) {
+            row[phyX >> 3] &= ~mask;
+          } else {
+            row[phyX >> 3] |= mask;
+          }
+        }
+        if (msbRow && msbBits) {
+          const uint8_t mask = static_cast<uint8_t>(msbBits << shift);
+          if (clearBits) {
+            msbRow[phyX >> 3] &= ~mask;
+          } else {
+            msbRow[phyX >> 3] |= mask;
           }
         }
+        pixel += count;
       }
     }
   }
@@ -1040,6 +2090,96 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
   *x += glyph->advanceX;
 }
 
+void GfxRenderer::renderGlyphRuns(const EpdGlyph* glyph, const uint8_t* runs, const int originX, const int originY,
+                                  const bool is2Bit, const uint8_t inkValues, const uint8_t msbInkValues,
+                                  const bool clearBits) const {
+  const int width = glyph->width;
+  const int pixelCount = width * glyph->height;
+  const int screenWidth = getScreenWidth();
+  const int screenHeight = getScreenHeight();
+  const bool bothPlanes = renderMode == GRAYSCALE_BOTH;
+  const bool trackGray = is2Bit && renderMode == BW;
+
+  // Runs have to be decoded from the start, so skip glyphs that are entirely off screen up front
+  if (originX >= screenWidth || originX + width <= 0 || originY >= screenHeight || originY + glyph->height <= 0) {
+    return;
+  }
+
+  // Draws `length` pixels from glyph pixel `start` on, splitting where the run wraps to the next glyph row. Each
+  // row's share is a single logical horizontal span.
+  const auto drawRun = [&](const int start, int length, const bool ink, const bool msbInk) {
+    int glyphY = start / width;
+    int glyphX = start - glyphY * width;
+    while (length > 0) {
+      const int count = std::min(length, width - glyphX);
+      const int y = originY + glyphY;
+      const int x1 = std::max(originX + glyphX, 0);
+      const int x2 = std::min(originX + glyphX + count - 1, screenWidth - 1);
+      if (y >= 0 && y < screenHeight && x1 <= x2) {
+        int phyX1, phyY1, phyX2, phyY2;
+        rotateCoordinates(orientation, x1, y, &phyX1, &phyY1);
+        rotateCoordinates(orientation, x2, y, &phyX2, &phyY2);
+        if (ink && phyY1 == phyY2) {
+          fillPhysicalRow(frameBuffer + phyY1 * HalDisplay::DISPLAY_WIDTH_BYTES, std::min(phyX1, phyX2),
+                          std::max(phyX1, phyX2), solidPattern(clearBits));
+        } else if (ink) {
+          fillPhysicalColumn(frameBufferRows(frameBuffer), phyX1, std::min(phyY1, phyY2), std::max(phyY1, phyY2),
+                             clearBits);
+        }
+        if (msbInk) {
+          const int phyXStep = phyX2 > phyX1 ? 1 : phyX2 < phyX1 ? -1 : 0;
+          const int phyYStep = phyY2 > phyY1 ? 1 : phyY2 < phyY1 ? -1 : 0;
+          for (int i = 0; i <= x2 - x1; i++) {
+            const int phyX = phyX1 + i * phyXStep;
+            uint8_t* byte = grayMsbRow(phyY1 + i * phyYStep) + (phyX >> 3);
+            const uint8_t bit = 0x80 >> (phyX & 7);
+            *byte = clearBits ? (*byte & ~bit) : (*byte | bit);
+          }
+        }
+      }
+      glyphX = 0;
+      glyphY++;
+      length -= count;
+    }
+  };
+
+  // Neighbouring runs that draw the same way (e.g. black and both grays in BW) are merged into one span
+  EpdGlyphRuns reader(runs, glyph->dataLength);
+  int spanStart = 0;
+  int spanLength = 0;
+  bool spanInk = false;
+  bool spanMsbInk = false;
+  for (int pixel = 0; pixel < pixelCount;) {
+    uint8_t value;
+    int length;
+    reader.next(&value, &length);
+    if (length == 0) {
+      LOG_ERR("GFX", "Run-length glyph data ends early");
+      break;
+    }
+    if (trackGray && (value == 1 || value == 2)) {
+      grayPixelsDrawn = true;
+    }
+
+    const bool ink = (inkValues >> value) & 1;
+    const bool msbInk = bothPlanes && ((msbInkValues >> value) & 1);
+    if (ink != spanInk || msbInk != spanMsbInk) {
+      if (spanInk || spanMsbInk) {
+        drawRun(spanStart, spanLength, spanInk, spanMsbInk);
+      }
+      spanStart = pixel;
+      spanLength = 0;
+      spanInk = ink;
+      spanMsbInk = msbInk;
+    }
+    spanLength += length;
+    pixel += length;
+  }
+  if (spanInk || spanMsbInk) {
+    drawRun(spanStart, std::min(spanLength, pixelCount - spanStart), spanInk, spanMsbInk);
+  }
+}
+
 void GfxRenderer::getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const {
   switch (orientation) {
     case Portrait:
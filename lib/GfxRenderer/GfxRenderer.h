@@ -4,9 +4,12 @@
 #include <FontDecompressor.h>
 #include <HalDisplay.h>
 
+#include <functional>
 #include <map>
 
 #include "Bitmap.h"
+#include "DamageTracker.h"
+#include "FontHandle.h"
 
 // Color representation: uint8_t mapped to 4x4 Bayer matrix dithering levels
 // 0 = transparent, 1-16 = gray levels (white to black)
@@ -14,7 +17,10 @@ enum Color : uint8_t { Clear = 0x00, White = 0x01, LightGray = 0x05, DarkGray =
 
 class GfxRenderer {
  public:
-  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+  // GRAYSCALE_BOTH draws the LSB plane into the frame buffer and the MSB plane into a second buffer in the same
+  // pass, see renderGrayscale. Every primitive that draws into the frame buffer writes both planes, except drawImage
+  // and drawIcon (drawn by the display) and clearScreen / invertScreen, which only touch the frame buffer.
+  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB, GRAYSCALE_BOTH };
 
   // Logical screen orientation from the perspective of callers
   enum Orientation {
@@ -29,28 +35,78 @@ class GfxRenderer {
   static constexpr size_t BW_BUFFER_NUM_CHUNKS = HalDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
   static_assert(BW_BUFFER_CHUNK_SIZE * BW_BUFFER_NUM_CHUNKS == HalDisplay::BUFFER_SIZE,
                 "BW buffer chunking does not line up with display buffer size");
+  static constexpr int ROWS_PER_CHUNK = BW_BUFFER_CHUNK_SIZE / HalDisplay::DISPLAY_WIDTH_BYTES;
+  static_assert(ROWS_PER_CHUNK * HalDisplay::DISPLAY_WIDTH_BYTES == BW_BUFFER_CHUNK_SIZE,
+                "Buffer chunks must hold whole panel rows");
+
+  // Drawing kernels specialized for one orientation, so the logical -> panel transform is resolved once in
+  // setOrientation instead of for every pixel. Coordinates are logical and must already be clipped to the screen.
+  struct OrientationKernels {
+    void (*drawPixel)(uint8_t* frameBuffer, int x, int y, bool state);
+    void (*drawHorizontalSpan)(uint8_t* frameBuffer, int x1, int x2, int y, bool state);
+    void (*drawVerticalSpan)(uint8_t* frameBuffer, int x, int y1, int y2, bool state);
+    void (*fillRect)(uint8_t* frameBuffer, int x1, int y1, int x2, int y2, Color color);  // Black, White or a gray
+    // Pixels x..x+width-1 of `rows` rows from y whose bit is set in their mask (MSB first, maskStride bytes per row)
+    void (*drawMaskRows)(uint8_t* frameBuffer, int x, int y, const uint8_t* masks, int maskStride, int width, int rows,
+                         bool state);
+  };
+  static const OrientationKernels orientationKernels[];
 
   HalDisplay& display;
   RenderMode renderMode;
   Orientation orientation;
+  const OrientationKernels* kernels;
   bool fadingFix;
   uint8_t* frameBuffer = nullptr;
+  // What is on the panel, updated when the frame buffer is displayed (mutable for const methods)
+  mutable DamageTracker damageTracker;
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
+  uint8_t* grayMsbChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};  // MSB plane while rendering in GRAYSCALE_BOTH
+  // Set when a BW draw had gray tones, reset by clearScreen (mutable for const methods)
+  mutable bool grayPixelsDrawn = false;
   std::map<int, EpdFontFamily> fontMap;
+  // Advance tables of the fonts a handle was resolved for, built on first use (mutable for const methods)
+  mutable std::map<const EpdFont*, EpdAdvance*> advanceTables;
   FontDecompressor* fontDecompressor = nullptr;
-  void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, const int* y, bool pixelState,
-                  EpdFontFamily::Style style) const;
+  // Kerns against *previousGlyph (null at the start of a run) and then stores the drawn glyph there
+  void renderChar(const EpdFont& font, uint32_t cp, int* x, const int* y, bool pixelState,
+                  const EpdGlyph** previousGlyph) const;
   void freeBwBufferChunks();
+  bool allocateGrayMsbChunks();
+  void freeGrayMsbChunks();
+  uint8_t* grayMsbRow(int phyY) const {
+    return grayMsbChunks[phyY / ROWS_PER_CHUNK] + (phyY % ROWS_PER_CHUNK) * HalDisplay::DISPLAY_WIDTH_BYTES;
+  }
+  // Calls draw(kernels, msbRow) with the orientation's kernels and the rows of the chunked MSB plane, so a primitive
+  // drawn in GRAYSCALE_BOTH makes the same writes to it as to the frame buffer
+  template <typename Draw>
+  void drawGrayMsb(const Draw& draw) const;
+  // drawMaskRows for the MSB plane of GRAYSCALE_BOTH
+  void drawGrayMsbMaskRows(int x, int y, const uint8_t* masks, int maskStride, int width, int rows, bool state) const;
   const uint8_t* getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph) const;
-  template <Color color>
-  void drawPixelDither(int x, int y) const;
-  template <Color color>
-  void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir) const;
+  // Draws a run-length encoded glyph (EpdFontData::rleBitmaps) straight from flash, one span per run and glyph row
+  void renderGlyphRuns(const EpdGlyph* glyph, const uint8_t* runs, int originX, int originY, bool is2Bit,
+                       uint8_t inkValues, uint8_t msbInkValues, bool clearBits) const;
+  void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir, Color color) const;
+  // Unscaled 1-bit bitmap drawn from masks of its black pixels, false if its buffers couldn't be allocated
+  bool drawBitmap1BitMasks(const Bitmap& bitmap, int x, int y, int drawWidth) const;
+  // Bitmap downscaled by area averaging and dithered at the output size, false if the scaler couldn't be set up
+  bool drawBitmapScaled(const Bitmap& bitmap, int x, int y, int cropPixX, int cropPixY, int32_t scale_fp) const;
 
  public:
   explicit GfxRenderer(HalDisplay& halDisplay)
-      : display(halDisplay), renderMode(BW), orientation(Portrait), fadingFix(false) {}
-  ~GfxRenderer() { freeBwBufferChunks(); }
+      : display(halDisplay),
+        renderMode(BW),
+        orientation(Portrait),
+        kernels(&orientationKernels[Portrait]),
+        fadingFix(false) {}
+  ~GfxRenderer() {
+    freeBwBufferChunks();
+    freeGrayMsbChunks();
+    for (const auto& entry : advanceTables) {
+      free(entry.second);
+    }
+  }
 
   static constexpr int VIEWABLE_MARGIN_TOP = 9;
   static constexpr int VIEWABLE_MARGIN_RIGHT = 3;
@@ -59,14 +115,22 @@ class GfxRenderer {
 
   // Setup
   void begin();  // must be called right after display.begin()
-  void insertFont(int fontId, EpdFontFamily font);
+  void insertFont(int fontId, EpdFontFamily font);  // keeps a font already registered under fontId
+  void removeFont(int fontId);
+  // Resolves a font for measuring a lot of text with it, an invalid handle if the font is not registered
+  FontHandle getFontHandle(int fontId) const;
   void setFontDecompressor(FontDecompressor* d) { fontDecompressor = d; }
+  FontDecompressor* getFontDecompressor() const { return fontDecompressor; }
   void clearFontCache() {
     if (fontDecompressor) fontDecompressor->clearCache();
   }
+  // Gives back all but the most recently used font groups, before an image decoder needs the heap
+  void trimFontCache() {
+    if (fontDecompressor) fontDecompressor->trimCache();
+  }
 
   // Orientation control (affects logical width/height and coordinate transforms)
-  void setOrientation(const Orientation o) { orientation = o; }
+  void setOrientation(Orientation o);
   Orientation getOrientation() const { return orientation; }
 
   // Fading fix control
@@ -75,15 +139,27 @@ class GfxRenderer {
   // Screen ops
   int getScreenWidth() const;
   int getScreenHeight() const;
+  // Fast refreshes only push and refresh the part of the panel that changed since the last displayed frame
   void displayBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH) const;
-  // EXPERIMENTAL: Windowed update - display only a rectangular region
-  // void displayWindow(int x, int y, int width, int height) const;
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
   void getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const;
 
   // Drawing
   void drawPixel(int x, int y, bool state = true) const;
+  // Pixel of a 2-bit image (0 black, 1 dark gray, 2 light gray, 3 white), drawn for the current render mode
+  void drawPixel2Bit(int x, int y, uint8_t value) const;
+  // 2-bit image packed 4 pixels per byte (MSB first, rows start on a byte), drawn like drawPixel2Bit but a panel
+  // byte at a time
+  void drawImage2Bit(const uint8_t* pixels, int x, int y, int width, int height) const;
+  // 1-bit image packed 8 pixels per byte (MSB first, 0 black, 1 white, rows start on a byte), its black pixels drawn
+  // a panel byte at a time. Rows that run along panel rows are ANDed straight into the frame buffer.
+  void drawImage1Bit(const uint8_t* bits, int x, int y, int width, int height) const;
+  // 2-bit image as two bit planes (XTH pages): columns from right to left, each top to bottom 8 pixels per byte (MSB
+  // first). Values are high << 1 | low, 0 white, 1 dark gray, 2 light gray, 3 black, drawn for the current render
+  // mode like drawPixel2Bit. In portrait the columns are panel rows and their bytes are written as they are.
+  void drawImage2BitPlanes(const uint8_t* highPlane, const uint8_t* lowPlane, int x, int y, int width,
+                           int height) const;
   void drawLine(int x1, int y1, int x2, int y2, bool state = true) const;
   void drawLine(int x1, int y1, int x2, int y2, int lineWidth, bool state) const;
   void drawArc(int maxRadius, int cx, int cy, int xDir, int yDir, int lineWidth, bool state) const;
@@ -131,6 +207,12 @@ class GfxRenderer {
   bool storeBwBuffer();    // Returns true if buffer was stored successfully
   void restoreBwBuffer();  // Restore and free the stored buffer
   void cleanupGrayscaleWithFrameBuffer() const;
+  // True if anything drawn in BW mode since the last clearScreen had gray tones, i.e. the grayscale passes would add
+  // something to the displayed frame
+  bool hasGrayPixels() const { return grayPixelsDrawn; }
+  // Draws the grayscale planes of the displayed BW frame with `render` and shows them, then restores the BW buffer.
+  // Renders both planes in a single pass when there is memory for the second plane, otherwise one pass per plane.
+  void renderGrayscale(const std::function<void()>& render);
 
   // Low level functions
   uint8_t* getFrameBuffer() const;
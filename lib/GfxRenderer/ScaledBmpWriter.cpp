@@ -0,0 +1,218 @@
+#include "ScaledBmpWriter.h"
+
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "BitmapHelpers.h"
+
+// ============================================================================
+// IMAGE PROCESSING OPTIONS - Toggle these to test different configurations
+// ============================================================================
+constexpr bool USE_8BIT_OUTPUT = false;  // true: 8-bit grayscale (no quantization), false: 2-bit (4 levels)
+// Dithering method selection (only one should be true, or all false for simple quantization):
+constexpr bool USE_ATKINSON = true;          // Atkinson dithering (cleaner than F-S, less error diffusion)
+constexpr bool USE_FLOYD_STEINBERG = false;  // Floyd-Steinberg error diffusion (can cause "worm" artifacts)
+// ============================================================================
+
+namespace {
+void write16(Print& out, const uint16_t value) {
+  out.write(value & 0xFF);
+  out.write((value >> 8) & 0xFF);
+}
+
+void write32(Print& out, const uint32_t value) {
+  out.write(value & 0xFF);
+  out.write((value >> 8) & 0xFF);
+  out.write((value >> 16) & 0xFF);
+  out.write((value >> 24) & 0xFF);
+}
+
+// Top-down BMP with a gray palette of 2, 4 or 256 entries
+void writeBmpHeader(Print& out, const int width, const int height, const int bitsPerPixel) {
+  const int colors = 1 << bitsPerPixel;
+  const uint32_t bytesPerRow = (width * bitsPerPixel + 31) / 32 * 4;  // Rows are padded to 4 bytes
+  const uint32_t imageSize = bytesPerRow * height;
+  const uint32_t dataOffset = 14 + 40 + colors * 4;
+
+  // BMP File Header (14 bytes)
+  out.write('B');
+  out.write('M');
+  write32(out, dataOffset + imageSize);  // File size
+  write32(out, 0);                       // Reserved
+  write32(out, dataOffset);
+
+  // DIB Header (BITMAPINFOHEADER - 40 bytes)
+  write32(out, 40);
+  write32(out, static_cast<uint32_t>(width));
+  write32(out, static_cast<uint32_t>(-height));  // Negative height = top-down bitmap
+  write16(out, 1);                                // Color planes
+  write16(out, bitsPerPixel);
+  write32(out, 0);  // BI_RGB (no compression)
+  write32(out, imageSize);
+  write32(out, 2835);  // xPixelsPerMeter (72 DPI)
+  write32(out, 2835);  // yPixelsPerMeter (72 DPI)
+  write32(out, colors);
+  write32(out, colors);
+
+  // Palette (BGRA), evenly spaced grays from black to white: 0 = black, last = white
+  for (int i = 0; i < colors; i++) {
+    const auto gray = static_cast<uint8_t>(i * 255 / (colors - 1));
+    out.write(gray);
+    out.write(gray);
+    out.write(gray);
+    out.write(static_cast<uint8_t>(0));
+  }
+}
+}  // namespace
+
+ScaledBmpWriter::~ScaledBmpWriter() {
+  free(rowBuffer);
+  free(previousSrcRow);
+  free(scaledRow);
+  delete atkinsonDitherer;
+  delete fsDitherer;
+  delete atkinson1BitDitherer;
+}
+
+void ScaledBmpWriter::setImageSize(const BmpTarget& bmpTarget, const int imageWidth, const int imageHeight) {
+  target = bmpTarget;
+  outWidth = imageWidth;
+  outHeight = imageHeight;
+  needsScaling = false;
+
+  if (target.maxWidth > 0 && target.maxHeight > 0 &&
+      (imageWidth != target.maxWidth || imageHeight != target.maxHeight)) {
+    // Scale to fill the box when cropping (the overhang is cropped when drawn), or else to fit into it
+    const float scaleToFitWidth = static_cast<float>(target.maxWidth) / imageWidth;
+    const float scaleToFitHeight = static_cast<float>(target.maxHeight) / imageHeight;
+    const float scale = target.crop ? std::max(scaleToFitWidth, scaleToFitHeight)
+                                    : std::min(scaleToFitWidth, scaleToFitHeight);
+    outWidth = std::max(1, static_cast<int>(imageWidth * scale));
+    outHeight = std::max(1, static_cast<int>(imageHeight * scale));
+    needsScaling = true;
+  }
+}
+
+bool ScaledBmpWriter::begin(const int width, const int height, const bool interpolate) {
+  srcWidth = width;
+  srcHeight = height;
+  bilinear = needsScaling && interpolate;
+  scaleX_fp = (static_cast<uint32_t>(srcWidth) << 16) / outWidth;
+  scaleY_fp = (static_cast<uint32_t>(srcHeight) << 16) / outHeight;
+  currentOutY = 0;
+
+  const int bitsPerPixel = target.oneBit ? 1 : (USE_8BIT_OUTPUT ? 8 : 2);
+  bytesPerRow = (outWidth * bitsPerPixel + 31) / 32 * 4;
+  rowBuffer = static_cast<uint8_t*>(malloc(bytesPerRow));
+  bool allocated = rowBuffer != nullptr;
+  if (bilinear) {
+    previousSrcRow = static_cast<uint8_t*>(malloc(srcWidth));
+    scaledRow = static_cast<uint8_t*>(malloc(outWidth));
+    allocated = allocated && previousSrcRow && scaledRow;
+  } else if (needsScaling) {
+    allocated = allocated && areaScaler.begin(srcWidth, srcHeight, outWidth, outHeight);
+  }
+  if (!allocated) {
+    LOG_ERR("BMP", "Failed to allocate scaling buffers for %dx%d", outWidth, outHeight);
+    return false;
+  }
+
+  // Dithering runs at the output size, after scaling
+  if (target.oneBit) {
+    atkinson1BitDitherer = new Atkinson1BitDitherer(outWidth);
+  } else if (!USE_8BIT_OUTPUT) {
+    if (USE_ATKINSON) {
+      atkinsonDitherer = new AtkinsonDitherer(outWidth);
+    } else if (USE_FLOYD_STEINBERG) {
+      fsDitherer = new FloydSteinbergDitherer(outWidth);
+    }
+  }
+
+  writeBmpHeader(*target.out, outWidth, outHeight, bitsPerPixel);
+  return true;
+}
+
+// Dithers and packs one output row of grayscale pixels (gray(x) for x in [0, outWidth)) and writes it
+template <typename GrayFn>
+void ScaledBmpWriter::writeOutputRow(const int outY, const GrayFn& gray) {
+  memset(rowBuffer, 0, bytesPerRow);
+
+  if (USE_8BIT_OUTPUT && !target.oneBit) {
+    for (int x = 0; x < outWidth; x++) {
+      rowBuffer[x] = adjustPixel(gray(x));
+    }
+  } else if (target.oneBit) {
+    // 1-bit output with Atkinson dithering for better quality
+    for (int x = 0; x < outWidth; x++) {
+      const uint8_t bit =
+          atkinson1BitDitherer ? atkinson1BitDitherer->processPixel(gray(x), x) : quantize1bit(gray(x), x, outY);
+      // Pack 1-bit value: MSB first, 8 pixels per byte
+      rowBuffer[x / 8] |= bit << (7 - (x % 8));
+    }
+    if (atkinson1BitDitherer) atkinson1BitDitherer->nextRow();
+  } else {
+    // 2-bit output
+    for (int x = 0; x < outWidth; x++) {
+      const uint8_t adjusted = adjustPixel(gray(x));
+      uint8_t twoBit;
+      if (atkinsonDitherer) {
+        twoBit = atkinsonDitherer->processPixel(adjusted, x);
+      } else if (fsDitherer) {
+        twoBit = fsDitherer->processPixel(adjusted, x);
+      } else {
+        twoBit = quantize(adjusted, x, outY);
+      }
+      rowBuffer[x / 4] |= twoBit << (6 - (x % 4) * 2);
+    }
+    if (atkinsonDitherer)
+      atkinsonDitherer->nextRow();
+    else if (fsDitherer)
+      fsDitherer->nextRow();
+  }
+  target.out->write(rowBuffer, bytesPerRow);
+}
+
+void ScaledBmpWriter::addRow(const int y, const uint8_t* srcRow) {
+  if (!needsScaling) {
+    // No scaling - direct output (1:1 mapping)
+    writeOutputRow(y, [srcRow](const int x) { return srcRow[x]; });
+    return;
+  }
+
+  if (bilinear) {
+    // Sampling at pixel centers: emit every output row whose lower source row is this one
+    if (y == 0) {
+      memcpy(previousSrcRow, srcRow, srcWidth);
+    }
+    while (currentOutY < outHeight) {
+      const int32_t srcY_fp =
+          std::max<int32_t>(0, (static_cast<int32_t>((2 * currentOutY + 1) * scaleY_fp) - 65536) / 2);
+      const int y0 = srcY_fp >> 16;
+      if (std::min(y0 + 1, srcHeight - 1) > y) break;
+      // Rows y0 and y0 + 1 are the previous and current row, or the same row at the image edges
+      const uint8_t* top = y0 == y ? srcRow : previousSrcRow;
+      const uint32_t fy = (srcY_fp >> 8) & 0xFF;
+      for (int outX = 0; outX < outWidth; outX++) {
+        const int32_t srcX_fp = std::max<int32_t>(0, (static_cast<int32_t>((2 * outX + 1) * scaleX_fp) - 65536) / 2);
+        const int x0 = srcX_fp >> 16;
+        const int x1 = std::min(x0 + 1, srcWidth - 1);
+        const uint32_t fx = (srcX_fp >> 8) & 0xFF;
+        const uint32_t upper = top[x0] * (256 - fx) + top[x1] * fx;
+        const uint32_t lower = srcRow[x0] * (256 - fx) + srcRow[x1] * fx;
+        scaledRow[outX] = (upper * (256 - fy) + lower * fy) >> 16;
+      }
+      writeOutputRow(currentOutY, [this](const int x) { return scaledRow[x]; });
+      currentOutY++;
+    }
+    memcpy(previousSrcRow, srcRow, srcWidth);
+    return;
+  }
+
+  areaScaler.addRow(srcRow);
+  while (const uint8_t* scaled = areaScaler.nextRow()) {
+    writeOutputRow(currentOutY++, [scaled](const int x) { return scaled[x]; });
+  }
+}
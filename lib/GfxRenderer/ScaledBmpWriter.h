@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Print.h>
+
+#include <cstdint>
+
+#include "AreaScaler.h"
+
+class Atkinson1BitDitherer;
+class AtkinsonDitherer;
+class FloydSteinbergDitherer;
+
+// One BMP written by an image converter, which can write several from a single decode
+struct BmpTarget {
+  Print* out;
+  int maxWidth;  // Box the image is scaled to fit, or to fill when cropped (the BMP then overhangs the box)
+  int maxHeight;
+  bool oneBit;               // Black and white for fast home screen drawing, otherwise 2-bit
+  bool crop;                 // Fill the box instead of fitting into it
+  bool allowReducedUpscale;  // Thumbnails may be scaled up from a coarse decode (JPEG reduce mode)
+
+  // Full screen 2-bit cover for the sleep screen
+  static BmpTarget cover(Print& out, const bool crop) { return {&out, 480, 800, false, crop, false}; }
+  // 1-bit cover thumbnail of the given height for the home screen
+  static BmpTarget thumbnail(Print& out, const int height) {
+    return {&out, static_cast<int>(height * 0.6), height, true, true, true};
+  }
+};
+
+// Scales grayscale source rows to a BmpTarget, dithers them and writes the BMP row by row. Every writer has its own
+// scaler and dither state, so converters feed the rows of one decode to as many writers as there are targets.
+class ScaledBmpWriter {
+ public:
+  ScaledBmpWriter() = default;
+  ~ScaledBmpWriter();
+  ScaledBmpWriter(const ScaledBmpWriter&) = delete;
+  ScaledBmpWriter& operator=(const ScaledBmpWriter&) = delete;
+
+  // Output size of an imageWidth x imageHeight image for the target
+  void setImageSize(const BmpTarget& target, int imageWidth, int imageHeight);
+  int getWidth() const { return outWidth; }
+  int getHeight() const { return outHeight; }
+  bool isScaled() const { return needsScaling; }
+  const BmpTarget& getTarget() const { return target; }
+
+  // Writes the header for source rows of srcWidth x srcHeight, the image size or that of a reduced decode of it.
+  // Scaling is bilinear (meant for upscaling), or else area averaging.
+  bool begin(int srcWidth, int srcHeight, bool bilinear);
+  // Source rows from top to bottom, output rows are written as soon as their source rows are in
+  void addRow(int y, const uint8_t* row);
+
+ private:
+  BmpTarget target = {};
+  int outWidth = 0;
+  int outHeight = 0;
+  bool needsScaling = false;
+  bool bilinear = false;
+  int srcWidth = 0;
+  int srcHeight = 0;
+  uint32_t scaleX_fp = 0;  // Source pixels per output pixel (16.16)
+  uint32_t scaleY_fp = 0;
+  int bytesPerRow = 0;
+  uint8_t* rowBuffer = nullptr;
+
+  int currentOutY = 0;
+  AreaScaler areaScaler;
+  // Bilinear: interpolates between the previous and the current source row
+  uint8_t* previousSrcRow = nullptr;
+  uint8_t* scaledRow = nullptr;
+
+  AtkinsonDitherer* atkinsonDitherer = nullptr;
+  FloydSteinbergDitherer* fsDitherer = nullptr;
+  Atkinson1BitDitherer* atkinson1BitDitherer = nullptr;
+
+  template <typename GrayFn>
+  void writeOutputRow(int outY, const GrayFn& gray);
+};
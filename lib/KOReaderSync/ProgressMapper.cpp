@@ -21,7 +21,7 @@ KOReaderPosition ProgressMapper::toKOReader(const std::shared_ptr<Epub>& epub, c
 
   // Get chapter info for logging
   const int tocIndex = epub->getTocIndexForSpineIndex(pos.spineIndex);
-  const std::string chapterName = (tocIndex >= 0) ? epub->getTocItem(tocIndex).title : "unknown";
+  const std::string chapterName = (tocIndex >= 0) ? epub->getTocTitle(tocIndex) : "unknown";
 
   LOG_DBG("ProgressMapper", "CrossPoint -> KOReader: chapter='%s', page=%d/%d -> %.2f%% at %s", chapterName.c_str(),
           pos.pageNumber, pos.totalPages, result.percentage * 100, result.xpath.c_str());
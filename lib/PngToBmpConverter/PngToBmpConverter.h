@@ -2,13 +2,13 @@
 
 class FsFile;
 class Print;
+struct BmpTarget;
 
 class PngToBmpConverter {
-  static bool pngFileToBmpStreamInternal(FsFile& pngFile, Print& bmpOut, int targetWidth, int targetHeight, bool oneBit,
-                                         bool crop = true);
-
  public:
   static bool pngFileToBmpStream(FsFile& pngFile, Print& bmpOut, bool crop = true);
   static bool pngFileToBmpStreamWithSize(FsFile& pngFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
   static bool pngFileTo1BitBmpStreamWithSize(FsFile& pngFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
+  // Writes a BMP for every target from a single decode, each scaled and dithered on its own
+  static bool pngFileToBmpStreams(FsFile& pngFile, const BmpTarget* targets, int count);
 };
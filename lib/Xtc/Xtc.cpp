@@ -304,9 +304,17 @@ bool Xtc::generateCoverBmp() const {
 std::string Xtc::getThumbBmpPath() const { return cachePath + "/thumb_[HEIGHT].bmp"; }
 std::string Xtc::getThumbBmpPath(int height) const { return cachePath + "/thumb_" + std::to_string(height) + ".bmp"; }
 
-bool Xtc::generateThumbBmp(int height) const {
+bool Xtc::generateThumbBmp(int height) const { return generateThumbBmps({height}); }
+
+bool Xtc::generateThumbBmps(const std::vector<int>& heights) const {
   // Already generated
-  if (Storage.exists(getThumbBmpPath(height).c_str())) {
+  std::vector<int> missingHeights;
+  for (const int height : heights) {
+    if (!Storage.exists(getThumbBmpPath(height).c_str())) {
+      missingHeights.push_back(height);
+    }
+  }
+  if (missingHeights.empty()) {
     return true;
   }
 
@@ -332,71 +340,83 @@ bool Xtc::generateThumbBmp(int height) const {
 
   // Get bit depth
   const uint8_t bitDepth = parser->getBitDepth();
+  size_t bitmapSize;
+  if (bitDepth == 2) {
+    bitmapSize = ((static_cast<size_t>(pageInfo.width) * pageInfo.height + 7) / 8) * 2;
+  } else {
+    bitmapSize = ((pageInfo.width + 7) / 8) * pageInfo.height;
+  }
 
-  // Calculate target dimensions for thumbnail (fit within 240x400 Continue Reading card)
-  int THUMB_TARGET_WIDTH = height * 0.6;
-  int THUMB_TARGET_HEIGHT = height;
-
-  // Calculate scale factor
-  float scaleX = static_cast<float>(THUMB_TARGET_WIDTH) / pageInfo.width;
-  float scaleY = static_cast<float>(THUMB_TARGET_HEIGHT) / pageInfo.height;
-  float scale = (scaleX > scaleY) ? scaleX : scaleY;  // for cropping
-
-  // Only scale down, never up
-  if (scale >= 1.0f) {
-    // Page is already small enough, just use cover.bmp
-    // Copy cover.bmp to thumb.bmp
-    if (generateCoverBmp()) {
-      FsFile src, dst;
-      if (Storage.openFileForRead("XTC", getCoverBmpPath(), src)) {
-        if (Storage.openFileForWrite("XTC", getThumbBmpPath(height), dst)) {
-          uint8_t buffer[512];
-          while (src.available()) {
-            size_t bytesRead = src.read(buffer, sizeof(buffer));
-            dst.write(buffer, bytesRead);
+  // The cover page is loaded once, for the first thumbnail that is scaled from it
+  uint8_t* pageBuffer = nullptr;
+  bool success = true;
+  for (const int height : missingHeights) {
+    // Calculate target dimensions for thumbnail (fit within 240x400 Continue Reading card)
+    int THUMB_TARGET_WIDTH = height * 0.6;
+    int THUMB_TARGET_HEIGHT = height;
+
+    // Calculate scale factor
+    float scaleX = static_cast<float>(THUMB_TARGET_WIDTH) / pageInfo.width;
+    float scaleY = static_cast<float>(THUMB_TARGET_HEIGHT) / pageInfo.height;
+    float scale = (scaleX > scaleY) ? scaleX : scaleY;  // for cropping
+
+    // Only scale down, never up
+    if (scale >= 1.0f) {
+      // Page is already small enough, just use cover.bmp
+      // Copy cover.bmp to thumb.bmp
+      if (generateCoverBmp()) {
+        FsFile src, dst;
+        if (Storage.openFileForRead("XTC", getCoverBmpPath(), src)) {
+          if (Storage.openFileForWrite("XTC", getThumbBmpPath(height), dst)) {
+            uint8_t buffer[512];
+            while (src.available()) {
+              size_t bytesRead = src.read(buffer, sizeof(buffer));
+              dst.write(buffer, bytesRead);
+            }
+            dst.close();
           }
-          dst.close();
+          src.close();
         }
-        src.close();
+        LOG_DBG("XTC", "Copied cover to thumb (no scaling needed)");
+        success = Storage.exists(getThumbBmpPath(height).c_str()) && success;
+      } else {
+        success = false;
       }
-      LOG_DBG("XTC", "Copied cover to thumb (no scaling needed)");
-      return Storage.exists(getThumbBmpPath(height).c_str());
+      continue;
     }
-    return false;
+
+    if (!pageBuffer) {
+      pageBuffer = static_cast<uint8_t*>(malloc(bitmapSize));
+      if (!pageBuffer) {
+        LOG_ERR("XTC", "Failed to allocate page buffer (%lu bytes)", bitmapSize);
+        return false;
+      }
+      // Load first page (cover)
+      if (const_cast<xtc::XtcParser*>(parser.get())->loadPage(0, pageBuffer, bitmapSize) == 0) {
+        LOG_ERR("XTC", "Failed to load cover page for thumb");
+        free(pageBuffer);
+        return false;
+      }
+    }
+    success = writeThumbBmp(pageBuffer, bitmapSize, pageInfo, height, scale) && success;
   }
+  free(pageBuffer);
+  return success;
+}
 
+bool Xtc::writeThumbBmp(const uint8_t* pageBuffer, const size_t bitmapSize, const xtc::PageInfo& pageInfo,
+                        const int height, const float scale) const {
+  const uint8_t bitDepth = parser->getBitDepth();
   uint16_t thumbWidth = static_cast<uint16_t>(pageInfo.width * scale);
   uint16_t thumbHeight = static_cast<uint16_t>(pageInfo.height * scale);
 
   LOG_DBG("XTC", "Generating thumb BMP: %dx%d -> %dx%d (scale: %.3f)", pageInfo.width, pageInfo.height, thumbWidth,
           thumbHeight, scale);
 
-  // Allocate buffer for page data
-  size_t bitmapSize;
-  if (bitDepth == 2) {
-    bitmapSize = ((static_cast<size_t>(pageInfo.width) * pageInfo.height + 7) / 8) * 2;
-  } else {
-    bitmapSize = ((pageInfo.width + 7) / 8) * pageInfo.height;
-  }
-  uint8_t* pageBuffer = static_cast<uint8_t*>(malloc(bitmapSize));
-  if (!pageBuffer) {
-    LOG_ERR("XTC", "Failed to allocate page buffer (%lu bytes)", bitmapSize);
-    return false;
-  }
-
-  // Load first page (cover)
-  size_t bytesRead = const_cast<xtc::XtcParser*>(parser.get())->loadPage(0, pageBuffer, bitmapSize);
-  if (bytesRead == 0) {
-    LOG_ERR("XTC", "Failed to load cover page for thumb");
-    free(pageBuffer);
-    return false;
-  }
-
   // Create thumbnail BMP file - use 1-bit format for fast home screen rendering (no gray passes)
   FsFile thumbBmp;
   if (!Storage.openFileForWrite("XTC", getThumbBmpPath(height), thumbBmp)) {
     LOG_DBG("XTC", "Failed to create thumb BMP file");
-    free(pageBuffer);
     return false;
   }
 
@@ -447,7 +467,6 @@ bool Xtc::generateThumbBmp(int height) const {
   // Allocate row buffer for 1-bit output
   uint8_t* rowBuffer = static_cast<uint8_t*>(malloc(rowSize));
   if (!rowBuffer) {
-    free(pageBuffer);
     thumbBmp.close();
     return false;
   }
@@ -556,7 +575,6 @@ bool Xtc::generateThumbBmp(int height) const {
 
   free(rowBuffer);
   thumbBmp.close();
-  free(pageBuffer);
 
   LOG_DBG("XTC", "Generated thumb BMP (%dx%d): %s", thumbWidth, thumbHeight, getThumbBmpPath(height).c_str());
   return true;
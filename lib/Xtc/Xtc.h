@@ -26,6 +26,10 @@ class Xtc {
   std::unique_ptr<xtc::XtcParser> parser;
   bool loaded;
 
+  // Thumbnail of the given height, scaled from the cover page in pageBuffer
+  bool writeThumbBmp(const uint8_t* pageBuffer, size_t bitmapSize, const xtc::PageInfo& pageInfo, int height,
+                     float scale) const;
+
  public:
   explicit Xtc(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)), loaded(false) {
     // Create cache key based on filepath (same as Epub)
@@ -67,6 +71,8 @@ class Xtc {
   std::string getThumbBmpPath() const;
   std::string getThumbBmpPath(int height) const;
   bool generateThumbBmp(int height) const;
+  // Thumbnails of every height, all scaled from a single load of the cover page
+  bool generateThumbBmps(const std::vector<int>& heights) const;
 
   // Page access
   uint32_t getPageCount() const;
@@ -518,7 +518,15 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
         return false;
       }
 
-      out.write(buffer, dataRead);
+      if (out.write(buffer, dataRead) != dataRead) {
+        // Output stream stopped accepting data (e.g. a header parser that has what it needs)
+        LOG_DBG("ZIP", "Output stream stopped accepting data");
+        free(buffer);
+        if (!wasOpen) {
+          close();
+        }
+        return false;
+      }
       remaining -= dataRead;
     }
 
@@ -605,7 +613,8 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
       if (outBytes > 0) {
         processedOutputBytes += outBytes;
         if (out.write(outputBuffer + outputCursor, outBytes) != outBytes) {
-          LOG_ERR("ZIP", "Failed to write all output bytes to stream");
+          // Output stream stopped accepting data, it reports its own errors
+          LOG_DBG("ZIP", "Failed to write all output bytes to stream");
           if (!wasOpen) {
             close();
           }
@@ -37,6 +37,18 @@ void HalDisplay::displayBuffer(HalDisplay::RefreshMode mode, bool turnOffScreen)
   einkDisplay.displayBuffer(convertRefreshMode(mode), turnOffScreen);
 }
 
+void HalDisplay::displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen) {
+#ifdef ENABLE_WINDOW_REFRESH
+  einkDisplay.displayWindow(x, y, w, h, turnOffScreen);
+#else
+  (void)x;
+  (void)y;
+  (void)w;
+  (void)h;
+  einkDisplay.displayBuffer(EInkDisplay::FAST_REFRESH, turnOffScreen);
+#endif
+}
+
 void HalDisplay::refreshDisplay(HalDisplay::RefreshMode mode, bool turnOffScreen) {
   einkDisplay.refreshDisplay(convertRefreshMode(mode), turnOffScreen);
 }
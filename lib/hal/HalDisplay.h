@@ -34,6 +34,9 @@ class HalDisplay {
                             bool fromProgmem = false) const;
 
   void displayBuffer(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
+  // Fast refresh of a rectangular region only, x and w must be multiples of 8. Without ENABLE_WINDOW_REFRESH this is a
+  // fast refresh of the whole frame, as EInkDisplay::displayWindow is still experimental in the SDK.
+  void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen = false);
   void refreshDisplay(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
 
   // Power management
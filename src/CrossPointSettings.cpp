@@ -343,7 +343,7 @@ int CrossPointSettings::getRefreshFrequency() const {
   }
 }
 
-int CrossPointSettings::getReaderFontId() const {
+int CrossPointSettings::getSelectedReaderFontId() const {
   switch (fontFamily) {
     case BOOKERLY:
     default:
@@ -384,3 +384,30 @@ int CrossPointSettings::getReaderFontId() const {
       }
   }
 }
+
+const char* CrossPointSettings::getSelectedReaderFontName() const {
+  // Same fallbacks as getSelectedReaderFontId()
+  static constexpr const char* NAMES[FONT_FAMILY_COUNT][FONT_SIZE_COUNT] = {
+      {"bookerly_12", "bookerly_14", "bookerly_16", "bookerly_18"},
+      {"notosans_12", "notosans_14", "notosans_16", "notosans_18"},
+      {"opendyslexic_8", "opendyslexic_10", "opendyslexic_12", "opendyslexic_14"},
+  };
+  const int family = fontFamily < FONT_FAMILY_COUNT ? fontFamily : static_cast<int>(BOOKERLY);
+  const int size = fontSize < FONT_SIZE_COUNT ? fontSize : static_cast<int>(MEDIUM);
+  return NAMES[family][size];
+}
+
+int CrossPointSettings::getReaderFontId() const {
+  const int fontId = getSelectedReaderFontId();
+#ifdef OMIT_FONTS
+  // Only Bookerly 14 is built in, any other font has to come from the SD card
+  if (fontId != BOOKERLY_14_FONT_ID && fontId != sdReaderFontId) {
+    return BOOKERLY_14_FONT_ID;
+  }
+#endif
+  return fontId;
+}
+
+const char* CrossPointSettings::getReaderFontName() const {
+  return getReaderFontId() == getSelectedReaderFontId() ? getSelectedReaderFontName() : "bookerly_14";
+}
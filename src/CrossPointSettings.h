@@ -13,6 +13,9 @@ class CrossPointSettings {
   // Static instance
   static CrossPointSettings instance;
 
+  // Not saved, set by main while an SD card reader font is loaded
+  int sdReaderFontId = 0;
+
  public:
   // Delete copy constructor and assignment
   CrossPointSettings(const CrossPointSettings&) = delete;
@@ -183,7 +186,16 @@ class CrossPointSettings {
   uint16_t getPowerButtonDuration() const {
     return (shortPwrBtn == CrossPointSettings::SHORT_PWRBTN::SLEEP) ? 10 : 400;
   }
+  // Font the reader settings select, whether or not this build has it. The name, e.g. "bookerly_14", is also the name
+  // of its font files on the SD card.
+  int getSelectedReaderFontId() const;
+  const char* getSelectedReaderFontName() const;
+  // Font the reader draws with: the selected one, or Bookerly 14 when the build leaves the selected font out
+  // (OMIT_FONTS) and no SD card font stands in for it
   int getReaderFontId() const;
+  const char* getReaderFontName() const;
+  // Font id an SD card font is registered under, 0 if none is loaded
+  void setSdReaderFontId(const int fontId) { sdReaderFontId = fontId; }
 
   // If count_only is true, returns the number of settings items that would be written.
   uint8_t writeSettings(FsFile& file, bool count_only = false) const;
@@ -0,0 +1,373 @@
+#include "LibraryIndex.h"
+
+#include <Epub.h>
+#include <Logging.h>
+#include <Serialization.h>
+#include <Xtc.h>
+
+#include <algorithm>
+
+#include "util/StringUtils.h"
+
+namespace {
+constexpr uint8_t LIBRARY_INDEX_FILE_VERSION = 1;
+constexpr char LIBRARY_INDEX_FILE[] = "/.crosspoint/library.bin";
+constexpr char LIBRARY_INDEX_TMP_FILE[] = "/.crosspoint/library.bin.tmp";
+
+// Header: version, record count, offset of the record table
+constexpr uint32_t headerSize = sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint32_t);
+
+uint32_t hashPath(const std::string& path) {
+  uint32_t hash = 2166136261u;
+  for (const char c : path) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+void readFileStamp(FsFile& file, LibraryBook& book) {
+  book.fileSize = static_cast<uint32_t>(file.size());
+  if (!file.getModifyDateTime(&book.modifyDate, &book.modifyTime)) {
+    book.modifyDate = 0;
+    book.modifyTime = 0;
+  }
+}
+
+void writeRecord(FsFile& file, const LibraryBook& book) {
+  serialization::writeString(file, book.path);
+  serialization::writeString(file, book.title);
+  serialization::writeString(file, book.author);
+  serialization::writeString(file, book.language);
+  serialization::writeString(file, book.coverBmpPath);
+  serialization::writePod(file, book.fileSize);
+  serialization::writePod(file, book.modifyDate);
+  serialization::writePod(file, book.modifyTime);
+  serialization::writePod(file, book.progressPercent);
+}
+}  // namespace
+
+LibraryIndex LibraryIndex::instance;
+
+bool LibraryIndex::readRecordAt(FsFile& file, const uint32_t offset, LibraryBook& book) const {
+  if (!file.seek(offset)) {
+    return false;
+  }
+  serialization::readString(file, book.path);
+  serialization::readString(file, book.title);
+  serialization::readString(file, book.author);
+  serialization::readString(file, book.language);
+  serialization::readString(file, book.coverBmpPath);
+  serialization::readPod(file, book.fileSize);
+  serialization::readPod(file, book.modifyDate);
+  serialization::readPod(file, book.modifyTime);
+  serialization::readPod(file, book.progressPercent);
+  return true;
+}
+
+bool LibraryIndex::findStoredBook(const std::string& path, LibraryBook& book) const {
+  const uint32_t targetHash = hashPath(path);
+  auto it = std::lower_bound(records.begin(), records.end(), targetHash,
+                             [](const RecordRef& ref, const uint32_t hash) { return ref.pathHash < hash; });
+  if (it == records.end() || it->pathHash != targetHash) {
+    return false;
+  }
+
+  FsFile file;
+  if (!Storage.openFileForRead("LIB", LIBRARY_INDEX_FILE, file)) {
+    return false;
+  }
+  // Check for match (may need to check a few due to hash collisions)
+  bool found = false;
+  for (; it != records.end() && it->pathHash == targetHash; ++it) {
+    if (readRecordAt(file, it->offset, book) && book.path == path) {
+      found = true;
+      break;
+    }
+  }
+  file.close();
+  return found;
+}
+
+bool LibraryIndex::findBook(const std::string& path, LibraryBook& book) const {
+  const auto pending = std::find_if(pendingBooks.begin(), pendingBooks.end(),
+                                    [&](const LibraryBook& pendingBook) { return pendingBook.path == path; });
+  if (pending != pendingBooks.end()) {
+    book = *pending;
+    return true;
+  }
+  if (std::find(removedPaths.begin(), removedPaths.end(), path) != removedPaths.end()) {
+    return false;
+  }
+  return findStoredBook(path, book);
+}
+
+bool LibraryIndex::matchesFile(const LibraryBook& book, FsFile& file) {
+  LibraryBook stamp;
+  readFileStamp(file, stamp);
+  return book.fileSize == stamp.fileSize && book.modifyDate == stamp.modifyDate &&
+         book.modifyTime == stamp.modifyTime;
+}
+
+bool LibraryIndex::indexBook(const std::string& path, FsFile& file) {
+  LibraryBook book;
+  if (findBook(path, book)) {
+    // Keep reading progress across file changes, everything else is refreshed
+    const uint8_t progressPercent = book.progressPercent;
+    book = LibraryBook{};
+    book.progressPercent = progressPercent;
+  }
+  book.path = path;
+  readFileStamp(file, book);
+
+  if (StringUtils::checkFileExtension(path, ".epub")) {
+    Epub epub(path, "/.crosspoint");
+    // Books are listed far more often than opened, so their spine/TOC caches are left to the reader
+    BookMetadataCache::BookMetadata metadata;
+    if (!epub.loadMetadata(metadata)) {
+      LOG_ERR("LIB", "Could not load epub metadata: %s", path.c_str());
+      return false;
+    }
+    book.title = metadata.title;
+    book.author = metadata.author;
+    book.language = metadata.language;
+    book.coverBmpPath = metadata.coverItemHref.empty() ? "" : epub.getThumbBmpPath();
+  } else if (StringUtils::checkFileExtension(path, ".xtch") || StringUtils::checkFileExtension(path, ".xtc")) {
+    Xtc xtc(path, "/.crosspoint");
+    if (!xtc.load()) {
+      LOG_ERR("LIB", "Could not load xtc metadata: %s", path.c_str());
+      return false;
+    }
+    book.title = xtc.getTitle();
+    book.author = xtc.getAuthor();
+    book.coverBmpPath = xtc.getThumbBmpPath();
+  } else {
+    const size_t lastSlash = path.find_last_of('/');
+    book.title = lastSlash == std::string::npos ? path : path.substr(lastSlash + 1);
+  }
+
+  updateBook(book);
+  LOG_DBG("LIB", "Indexed %s", path.c_str());
+  return true;
+}
+
+void LibraryIndex::updateBookMetadata(const std::string& path, const std::string& title, const std::string& author,
+                                      const std::string& language, const std::string& coverBmpPath) {
+  LibraryBook book;
+  if (!findBook(path, book)) {
+    book.path = path;
+  }
+
+  FsFile file;
+  if (Storage.openFileForRead("LIB", path, file)) {
+    readFileStamp(file, book);
+    file.close();
+  }
+
+  book.title = title;
+  book.author = author;
+  book.language = language;
+  book.coverBmpPath = coverBmpPath;
+  updateBook(book);
+}
+
+void LibraryIndex::updateBook(const LibraryBook& book) {
+  removedPaths.erase(std::remove(removedPaths.begin(), removedPaths.end(), book.path), removedPaths.end());
+
+  auto it = std::find_if(pendingBooks.begin(), pendingBooks.end(),
+                         [&](const LibraryBook& pendingBook) { return pendingBook.path == book.path; });
+  if (it != pendingBooks.end()) {
+    *it = book;
+  } else {
+    pendingBooks.push_back(book);
+  }
+}
+
+void LibraryIndex::updateProgress(const std::string& path, const uint8_t progressPercent) {
+  LibraryBook book;
+  if (!findBook(path, book) || book.progressPercent == progressPercent) {
+    return;
+  }
+  book.progressPercent = progressPercent;
+  updateBook(book);
+}
+
+void LibraryIndex::removeBook(const std::string& path) {
+  pendingBooks.erase(std::remove_if(pendingBooks.begin(), pendingBooks.end(),
+                                    [&](const LibraryBook& pendingBook) { return pendingBook.path == path; }),
+                     pendingBooks.end());
+  if (std::find(removedPaths.begin(), removedPaths.end(), path) == removedPaths.end()) {
+    removedPaths.push_back(path);
+  }
+}
+
+void LibraryIndex::removeBooksUnder(const std::string& path) {
+  if (path.empty()) {
+    return;
+  }
+  const std::string folderPrefix = path.back() == '/' ? path : path + "/";
+  const auto isUnder = [&](const std::string& bookPath) {
+    return bookPath == path || bookPath.compare(0, folderPrefix.size(), folderPrefix) == 0;
+  };
+
+  std::vector<std::string> paths = {path};
+  for (const auto& pendingBook : pendingBooks) {
+    if (isUnder(pendingBook.path)) {
+      paths.push_back(pendingBook.path);
+    }
+  }
+  // Records are only found by path hash, so the stored paths have to be read to match the prefix
+  FsFile file;
+  if (!records.empty() && Storage.openFileForRead("LIB", LIBRARY_INDEX_FILE, file)) {
+    std::vector<uint32_t> offsets;
+    offsets.reserve(records.size());
+    for (const auto& ref : records) {
+      offsets.push_back(ref.offset);
+    }
+    std::sort(offsets.begin(), offsets.end());
+
+    LibraryBook book;
+    for (const uint32_t offset : offsets) {
+      if (readRecordAt(file, offset, book) && isUnder(book.path)) {
+        paths.push_back(book.path);
+      }
+    }
+    file.close();
+  }
+
+  for (const auto& bookPath : paths) {
+    removeBook(bookPath);
+  }
+}
+
+bool LibraryIndex::saveToFile() {
+  if (!hasPendingChanges()) {
+    return true;
+  }
+
+  // Make sure the directory exists
+  Storage.mkdir("/.crosspoint");
+
+  FsFile outputFile;
+  if (!Storage.openFileForWrite("LIB", LIBRARY_INDEX_TMP_FILE, outputFile)) {
+    return false;
+  }
+
+  // Header is rewritten once the record count and table offset are known
+  constexpr uint8_t incompleteVersion = 0;
+  constexpr uint16_t unknownCount = 0;
+  constexpr uint32_t unknownTableOffset = 0;
+  serialization::writePod(outputFile, incompleteVersion);
+  serialization::writePod(outputFile, unknownCount);
+  serialization::writePod(outputFile, unknownTableOffset);
+
+  std::vector<RecordRef> newRecords;
+  newRecords.reserve(records.size() + pendingBooks.size());
+
+  // Carry over stored records that have not been replaced or removed, in file order so the old file is read
+  // sequentially
+  FsFile inputFile;
+  if (!records.empty() && Storage.openFileForRead("LIB", LIBRARY_INDEX_FILE, inputFile)) {
+    std::vector<uint32_t> offsets;
+    offsets.reserve(records.size());
+    for (const auto& ref : records) {
+      offsets.push_back(ref.offset);
+    }
+    std::sort(offsets.begin(), offsets.end());
+
+    LibraryBook book;
+    for (const uint32_t offset : offsets) {
+      if (!readRecordAt(inputFile, offset, book)) {
+        continue;
+      }
+      const bool replaced =
+          std::any_of(pendingBooks.begin(), pendingBooks.end(),
+                      [&](const LibraryBook& pendingBook) { return pendingBook.path == book.path; }) ||
+          std::find(removedPaths.begin(), removedPaths.end(), book.path) != removedPaths.end();
+      if (replaced) {
+        continue;
+      }
+      newRecords.push_back({hashPath(book.path), static_cast<uint32_t>(outputFile.position())});
+      writeRecord(outputFile, book);
+    }
+    inputFile.close();
+  }
+
+  for (const auto& book : pendingBooks) {
+    newRecords.push_back({hashPath(book.path), static_cast<uint32_t>(outputFile.position())});
+    writeRecord(outputFile, book);
+  }
+
+  std::sort(newRecords.begin(), newRecords.end(),
+            [](const RecordRef& a, const RecordRef& b) { return a.pathHash < b.pathHash; });
+  const auto tableOffset = static_cast<uint32_t>(outputFile.position());
+  for (const auto& ref : newRecords) {
+    serialization::writePod(outputFile, ref.pathHash);
+    serialization::writePod(outputFile, ref.offset);
+  }
+
+  const auto count = static_cast<uint16_t>(newRecords.size());
+  outputFile.seek(0);
+  serialization::writePod(outputFile, LIBRARY_INDEX_FILE_VERSION);
+  serialization::writePod(outputFile, count);
+  serialization::writePod(outputFile, tableOffset);
+  outputFile.close();
+
+  // Swap the new index into place
+  if (Storage.exists(LIBRARY_INDEX_FILE) && !Storage.remove(LIBRARY_INDEX_FILE)) {
+    LOG_ERR("LIB", "Could not replace library index");
+    return false;
+  }
+  FsFile tmpFile = Storage.open(LIBRARY_INDEX_TMP_FILE, O_RDWR);
+  const bool renamed = tmpFile && tmpFile.rename(LIBRARY_INDEX_FILE);
+  tmpFile.close();
+  if (!renamed) {
+    LOG_ERR("LIB", "Could not move library index into place");
+    records.clear();
+    return false;
+  }
+
+  records = std::move(newRecords);
+  pendingBooks.clear();
+  removedPaths.clear();
+  LOG_DBG("LIB", "Library index saved to file (%d entries)", count);
+  return true;
+}
+
+bool LibraryIndex::loadFromFile() {
+  FsFile inputFile;
+  if (!Storage.openFileForRead("LIB", LIBRARY_INDEX_FILE, inputFile)) {
+    return false;
+  }
+
+  uint8_t version;
+  serialization::readPod(inputFile, version);
+  if (version != LIBRARY_INDEX_FILE_VERSION) {
+    LOG_ERR("LIB", "Deserialization failed: Unknown version %u", version);
+    inputFile.close();
+    return false;
+  }
+
+  uint16_t count;
+  uint32_t tableOffset;
+  serialization::readPod(inputFile, count);
+  serialization::readPod(inputFile, tableOffset);
+  if (tableOffset < headerSize) {
+    LOG_ERR("LIB", "Deserialization failed: Invalid table offset");
+    inputFile.close();
+    return false;
+  }
+
+  records.resize(count);
+  inputFile.seek(tableOffset);
+  for (auto& ref : records) {
+    serialization::readPod(inputFile, ref.pathHash);
+    serialization::readPod(inputFile, ref.offset);
+  }
+  inputFile.close();
+
+  pendingBooks.clear();
+  removedPaths.clear();
+  LOG_DBG("LIB", "Library index loaded from file (%d entries)", count);
+  return true;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <HalStorage.h>
+
+#include <string>
+#include <vector>
+
+struct LibraryBook {
+  std::string path;
+  std::string title;
+  std::string author;
+  std::string language;
+  std::string coverBmpPath;  // Thumbnail path with a [HEIGHT] placeholder, empty if the book has no cover
+  // Size and FAT modify date/time of the file when it was indexed, used to spot changed files
+  uint32_t fileSize = 0;
+  uint16_t modifyDate = 0;
+  uint16_t modifyTime = 0;
+  uint8_t progressPercent = 0;
+};
+
+// Library-wide metadata for every book that has been opened or listed, so the home, recents and library screens
+// never need to open the books themselves. Only a table of path hashes and record offsets is held in RAM, records are
+// read from library.bin on demand. Changes are buffered and merged into a fresh library.bin on save.
+class LibraryIndex {
+  // Static instance
+  static LibraryIndex instance;
+
+  struct RecordRef {
+    uint32_t pathHash;
+    uint32_t offset;
+  };
+  std::vector<RecordRef> records;  // Sorted by path hash
+  std::vector<LibraryBook> pendingBooks;
+  std::vector<std::string> removedPaths;
+
+  bool readRecordAt(FsFile& file, uint32_t offset, LibraryBook& book) const;
+  bool findStoredBook(const std::string& path, LibraryBook& book) const;
+
+ public:
+  ~LibraryIndex() = default;
+
+  // Get singleton instance
+  static LibraryIndex& getInstance() { return instance; }
+
+  bool findBook(const std::string& path, LibraryBook& book) const;
+  // True if the entry was indexed from the given open file, i.e. its size and modify time haven't changed since
+  static bool matchesFile(const LibraryBook& book, FsFile& file);
+  // Reads title/author/cover from the book's metadata (content.opf for epubs, without building their caches) and
+  // records it
+  bool indexBook(const std::string& path, FsFile& file);
+
+  // Records metadata for a book that is currently open, keeping any stored progress
+  void updateBookMetadata(const std::string& path, const std::string& title, const std::string& author,
+                          const std::string& language, const std::string& coverBmpPath);
+  void updateBook(const LibraryBook& book);
+  void updateProgress(const std::string& path, uint8_t progressPercent);
+  void removeBook(const std::string& path);
+  // Removes the book at path, or every book below it if path is a folder
+  void removeBooksUnder(const std::string& path);
+  bool hasPendingChanges() const { return !pendingBooks.empty() || !removedPaths.empty(); }
+
+  bool saveToFile();
+  bool loadFromFile();
+};
+
+// Helper macro to access the library index
+#define LIBRARY_INDEX LibraryIndex::getInstance()
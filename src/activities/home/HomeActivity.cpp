@@ -14,6 +14,7 @@
 #include "Battery.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "LibraryIndex.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "components/UITheme.h"
@@ -47,8 +48,25 @@ void HomeActivity::loadRecentBooks(int maxBooks) {
       continue;
     }
 
-    recentBooks.push_back(book);
+    // Prefer the library index, it is kept up to date when books are opened or change on disk
+    LibraryBook indexed;
+    if (LIBRARY_INDEX.findBook(book.path, indexed)) {
+      recentBooks.push_back({book.path, indexed.title, indexed.author, indexed.coverBmpPath});
+    } else {
+      recentBooks.push_back(book);
+    }
+  }
+}
+
+// The book has no usable cover, so stop trying to generate one for it
+void forgetRecentCover(RecentBook& book) {
+  RECENT_BOOKS.updateBook(book.path, book.title, book.author, "");
+  LibraryBook indexed;
+  if (LIBRARY_INDEX.findBook(book.path, indexed)) {
+    indexed.coverBmpPath = "";
+    LIBRARY_INDEX.updateBook(indexed);
   }
+  book.coverBmpPath = "";
 }
 
 void HomeActivity::loadRecentCovers(int coverHeight) {
@@ -56,6 +74,8 @@ void HomeActivity::loadRecentCovers(int coverHeight) {
   bool showingLoading = false;
   Rect popupRect;
 
+  // Thumbnails are normally generated when a book is opened. Books opened before that, or whose thumbnails were
+  // removed, get theirs here.
   int progress = 0;
   for (RecentBook& book : recentBooks) {
     if (!book.coverBmpPath.empty()) {
@@ -75,8 +95,7 @@ void HomeActivity::loadRecentCovers(int coverHeight) {
           GUI.fillPopupProgress(renderer, popupRect, 10 + progress * (90 / recentBooks.size()));
           bool success = epub.generateThumbBmp(coverHeight);
           if (!success) {
-            RECENT_BOOKS.updateBook(book.path, book.title, book.author, "");
-            book.coverBmpPath = "";
+            forgetRecentCover(book);
           }
           coverRendered = false;
           requestUpdate();
@@ -93,8 +112,7 @@ void HomeActivity::loadRecentCovers(int coverHeight) {
             GUI.fillPopupProgress(renderer, popupRect, 10 + progress * (90 / recentBooks.size()));
             bool success = xtc.generateThumbBmp(coverHeight);
             if (!success) {
-              RECENT_BOOKS.updateBook(book.path, book.title, book.author, "");
-              book.coverBmpPath = "";
+              forgetRecentCover(book);
             }
             coverRendered = false;
             requestUpdate();
@@ -104,6 +122,7 @@ void HomeActivity::loadRecentCovers(int coverHeight) {
     }
     progress++;
   }
+  LIBRARY_INDEX.saveToFile();
 
   recentsLoaded = true;
   recentsLoading = false;
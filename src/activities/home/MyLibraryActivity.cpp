@@ -6,6 +6,7 @@
 
 #include <algorithm>
 
+#include "LibraryIndex.h"
 #include "MappedInputManager.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
@@ -15,60 +16,75 @@ namespace {
 constexpr unsigned long GO_HOME_MS = 1000;
 }  // namespace
 
-void sortFileList(std::vector<std::string>& strs) {
-  std::sort(begin(strs), end(strs), [](const std::string& str1, const std::string& str2) {
-    // Directories first
-    bool isDir1 = str1.back() == '/';
-    bool isDir2 = str2.back() == '/';
-    if (isDir1 != isDir2) return isDir1;
-
-    // Start naive natural sort
-    const char* s1 = str1.c_str();
-    const char* s2 = str2.c_str();
-
-    // Iterate while both strings have characters
-    while (*s1 && *s2) {
-      // Check if both are at the start of a number
-      if (isdigit(*s1) && isdigit(*s2)) {
-        // Skip leading zeros and track them
-        const char* start1 = s1;
-        const char* start2 = s2;
-        while (*s1 == '0') s1++;
-        while (*s2 == '0') s2++;
-
-        // Count digits to compare lengths first
-        int len1 = 0, len2 = 0;
-        while (isdigit(s1[len1])) len1++;
-        while (isdigit(s2[len2])) len2++;
-
-        // Different length so return smaller integer value
-        if (len1 != len2) return len1 < len2;
-
-        // Same length so compare digit by digit
-        for (int i = 0; i < len1; i++) {
-          if (s1[i] != s2[i]) return s1[i] < s2[i];
-        }
-
-        // Numbers equal so advance pointers
-        s1 += len1;
-        s2 += len2;
-      } else {
-        // Regular case-insensitive character comparison
-        char c1 = tolower(*s1);
-        char c2 = tolower(*s2);
-        if (c1 != c2) return c1 < c2;
-        s1++;
-        s2++;
+bool fileNameLess(const std::string& str1, const std::string& str2) {
+  // Directories first
+  bool isDir1 = str1.back() == '/';
+  bool isDir2 = str2.back() == '/';
+  if (isDir1 != isDir2) return isDir1;
+
+  // Start naive natural sort
+  const char* s1 = str1.c_str();
+  const char* s2 = str2.c_str();
+
+  // Iterate while both strings have characters
+  while (*s1 && *s2) {
+    // Check if both are at the start of a number
+    if (isdigit(*s1) && isdigit(*s2)) {
+      // Skip leading zeros and track them
+      const char* start1 = s1;
+      const char* start2 = s2;
+      while (*s1 == '0') s1++;
+      while (*s2 == '0') s2++;
+
+      // Count digits to compare lengths first
+      int len1 = 0, len2 = 0;
+      while (isdigit(s1[len1])) len1++;
+      while (isdigit(s2[len2])) len2++;
+
+      // Different length so return smaller integer value
+      if (len1 != len2) return len1 < len2;
+
+      // Same length so compare digit by digit
+      for (int i = 0; i < len1; i++) {
+        if (s1[i] != s2[i]) return s1[i] < s2[i];
       }
+
+      // Numbers equal so advance pointers
+      s1 += len1;
+      s2 += len2;
+    } else {
+      // Regular case-insensitive character comparison
+      char c1 = tolower(*s1);
+      char c2 = tolower(*s2);
+      if (c1 != c2) return c1 < c2;
+      s1++;
+      s2++;
     }
+  }
 
-    // One string is prefix of other
-    return *s1 == '\0' && *s2 != '\0';
-  });
+  // One string is prefix of other
+  return *s1 == '\0' && *s2 != '\0';
+}
+
+void sortFileList(std::vector<std::string>& strs) { std::sort(begin(strs), end(strs), fileNameLess); }
+
+std::string getFileName(std::string filename) {
+  if (filename.back() == '/') {
+    return filename.substr(0, filename.length() - 1);
+  }
+  const auto pos = filename.rfind('.');
+  return filename.substr(0, pos);
+}
+
+std::string getProgressLabel(const LibraryBook& book) {
+  return book.progressPercent > 0 ? std::to_string(book.progressPercent) + "%" : "";
 }
 
 void MyLibraryActivity::loadFiles() {
   files.clear();
+  titles.clear();
+  progressLabels.clear();
+  unindexedFiles.clear();
 
   auto root = Storage.open(basepath.c_str());
   if (!root || !root.isDirectory()) {
@@ -93,6 +109,11 @@ void MyLibraryActivity::loadFiles() {
       if (StringUtils::checkFileExtension(filename, ".epub") || StringUtils::checkFileExtension(filename, ".xtch") ||
           StringUtils::checkFileExtension(filename, ".xtc") || StringUtils::checkFileExtension(filename, ".txt") ||
           StringUtils::checkFileExtension(filename, ".md")) {
+        // The file is already open here, so check its size and modify time against the index while we have it
+        LibraryBook book;
+        if (!LIBRARY_INDEX.findBook(getFullPath(filename), book) || !LibraryIndex::matchesFile(book, file)) {
+          unindexedFiles.push_back(filename);
+        }
         files.emplace_back(filename);
       }
     }
@@ -100,6 +121,55 @@ void MyLibraryActivity::loadFiles() {
   }
   root.close();
   sortFileList(files);
+
+  titles.reserve(files.size());
+  progressLabels.reserve(files.size());
+  for (const auto& filename : files) {
+    LibraryBook book;
+    if (filename.back() != '/' && LIBRARY_INDEX.findBook(getFullPath(filename), book) && !book.title.empty()) {
+      titles.push_back(book.title);
+      progressLabels.push_back(getProgressLabel(book));
+    } else {
+      titles.push_back(getFileName(filename));
+      progressLabels.emplace_back();
+    }
+  }
+  // Index in display order, from the bottom of the list so pop_back() yields the top entry first
+  std::sort(unindexedFiles.begin(), unindexedFiles.end(),
+            [](const std::string& a, const std::string& b) { return fileNameLess(b, a); });
+}
+
+std::string MyLibraryActivity::getFullPath(const std::string& filename) const {
+  return basepath.back() == '/' ? basepath + filename : basepath + "/" + filename;
+}
+
+void MyLibraryActivity::indexNextFile() {
+  const std::string filename = unindexedFiles.back();
+  unindexedFiles.pop_back();
+
+  const std::string path = getFullPath(filename);
+  FsFile file;
+  if (!Storage.openFileForRead("LIB", path, file)) {
+    return;
+  }
+  const bool indexed = LIBRARY_INDEX.indexBook(path, file);
+  file.close();
+
+  LibraryBook book;
+  if (!indexed || !LIBRARY_INDEX.findBook(path, book) || book.title.empty()) {
+    return;
+  }
+
+  const size_t index = findEntry(filename);
+  if (files.empty() || files[index] != filename) {
+    return;
+  }
+  {
+    RenderLock lock(*this);
+    titles[index] = book.title;
+    progressLabels[index] = getProgressLabel(book);
+  }
+  requestUpdate();
 }
 
 void MyLibraryActivity::onEnter() {
@@ -113,7 +183,11 @@ void MyLibraryActivity::onEnter() {
 
 void MyLibraryActivity::onExit() {
   Activity::onExit();
+  LIBRARY_INDEX.saveToFile();
   files.clear();
+  titles.clear();
+  progressLabels.clear();
+  unindexedFiles.clear();
 }
 
 void MyLibraryActivity::loop() {
@@ -186,14 +260,11 @@ void MyLibraryActivity::loop() {
     selectorIndex = ButtonNavigator::previousPageIndex(static_cast<int>(selectorIndex), listSize, pageItems);
     requestUpdate();
   });
-}
 
-std::string getFileName(std::string filename) {
-  if (filename.back() == '/') {
-    return filename.substr(0, filename.length() - 1);
+  // Fill in titles for new or changed books in the background, one per loop so input stays responsive
+  if (!unindexedFiles.empty() && !mappedInput.isPressed(MappedInputManager::Button::Back)) {
+    indexNextFile();
   }
-  const auto pos = filename.rfind('.');
-  return filename.substr(0, pos);
 }
 
 void MyLibraryActivity::render(Activity::RenderLock&&) {
@@ -213,8 +284,9 @@ void MyLibraryActivity::render(Activity::RenderLock&&) {
   } else {
     GUI.drawList(
         renderer, Rect{0, contentTop, pageWidth, contentHeight}, files.size(), selectorIndex,
-        [this](int index) { return getFileName(files[index]); }, nullptr,
-        [this](int index) { return UITheme::getFileIcon(files[index]); });
+        [this](int index) { return titles[index]; }, nullptr,
+        [this](int index) { return UITheme::getFileIcon(files[index]); },
+        [this](int index) { return progressLabels[index]; });
   }
 
   // Help text
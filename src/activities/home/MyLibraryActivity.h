@@ -16,6 +16,11 @@ class MyLibraryActivity final : public Activity {
   // Files state
   std::string basepath = "/";
   std::vector<std::string> files;
+  // Display title and progress for each entry in files, taken from the library index
+  std::vector<std::string> titles;
+  std::vector<std::string> progressLabels;
+  // Books in this folder that are missing from the library index or changed on disk, indexed one per loop
+  std::vector<std::string> unindexedFiles;
 
   // Callbacks
   const std::function<void(const std::string& path)> onSelectBook;
@@ -23,6 +28,8 @@ class MyLibraryActivity final : public Activity {
 
   // Data loading
   void loadFiles();
+  void indexNextFile();
+  std::string getFullPath(const std::string& filename) const;
   size_t findEntry(const std::string& name) const;
 
  public:
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 
+#include "LibraryIndex.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "components/UITheme.h"
@@ -26,7 +27,14 @@ void RecentBooksActivity::loadRecentBooks() {
     if (!Storage.exists(book.path.c_str())) {
       continue;
     }
-    recentBooks.push_back(book);
+
+    // Prefer the library index, it is kept up to date when books are opened or change on disk
+    LibraryBook indexed;
+    if (LIBRARY_INDEX.findBook(book.path, indexed)) {
+      recentBooks.push_back({book.path, indexed.title, indexed.author, indexed.coverBmpPath});
+    } else {
+      recentBooks.push_back(book);
+    }
   }
 }
 
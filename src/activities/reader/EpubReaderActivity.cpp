@@ -13,6 +13,7 @@
 #include "EpubReaderPercentSelectionActivity.h"
 #include "KOReaderCredentialStore.h"
 #include "KOReaderSyncActivity.h"
+#include "LibraryIndex.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "components/UITheme.h"
@@ -24,6 +25,10 @@ constexpr unsigned long skipChapterMs = 700;
 constexpr unsigned long goHomeMs = 1000;
 constexpr int statusBarMargin = 19;
 constexpr int progressBarMarginTop = 1;
+// Images on pages this far ahead are decoded into the pixel cache after a page is shown
+constexpr int imagePrefetchPages = 2;
+// Below the render and input tasks, so prefetching only gets the CPU while they are idle
+constexpr UBaseType_t imagePrefetchPriority = tskIDLE_PRIORITY;
 
 int clampPercent(int percent) {
   if (percent < 0) {
@@ -61,6 +66,14 @@ void applyReaderOrientation(GfxRenderer& renderer, const uint8_t orientation) {
 void EpubReaderActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
+  xTaskCreate(&imagePrefetchTaskTrampoline, "ImagePrefetch",
+              8192,                     // Stack size, the same decoders run as on the render task
+              this,                     // Parameters
+              imagePrefetchPriority,    // Priority
+              &imagePrefetchTaskHandle  // Task handle
+  );
+  assert(imagePrefetchTaskHandle != nullptr && "Failed to create image prefetch task");
+
   if (!epub) {
     return;
   }
@@ -99,13 +112,33 @@ void EpubReaderActivity::onEnter() {
   // Save current epub as last opened epub and add to recent books
   APP_STATE.openEpubPath = epub->getPath();
   APP_STATE.saveToFile();
-  RECENT_BOOKS.addBook(epub->getPath(), epub->getTitle(), epub->getAuthor(), epub->getThumbBmpPath());
+  // Make sure the home screen has a cover thumbnail without having to open the book itself. The thumbnails of all
+  // themes and the sleep screen cover (when it shows one) are made from a single decode of the cover image.
+  const bool sleepCover = SETTINGS.sleepScreen == CrossPointSettings::SLEEP_SCREEN_MODE::COVER ||
+                          SETTINGS.sleepScreen == CrossPointSettings::SLEEP_SCREEN_MODE::COVER_CUSTOM;
+  // No page has been drawn yet, so no font groups are worth keeping over the cover decoder's buffers
+  renderer.clearFontCache();
+  epub->generateCoverBmps(UITheme::getCoverThumbHeights(), sleepCover,
+                          SETTINGS.sleepScreenCoverMode == CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP);
+  const int thumbHeight = UITheme::getInstance().getMetrics().homeCoverHeight;
+  const bool hasThumb = Storage.exists(epub->getThumbBmpPath(thumbHeight).c_str());
+  const std::string thumbBmpPath = hasThumb ? epub->getThumbBmpPath() : "";
+  RECENT_BOOKS.addBook(epub->getPath(), epub->getTitle(), epub->getAuthor(), thumbBmpPath);
+  LIBRARY_INDEX.updateBookMetadata(epub->getPath(), epub->getTitle(), epub->getAuthor(), epub->getLanguage(),
+                                   thumbBmpPath);
 
   // Trigger first update
   requestUpdate();
 }
 
 void EpubReaderActivity::onExit() {
+  if (imagePrefetchTaskHandle) {
+    cancelImagePrefetch();
+    RenderLock lock(*this);
+    vTaskDelete(imagePrefetchTaskHandle);
+    imagePrefetchTaskHandle = nullptr;
+    imagePrefetchRunning = false;
+  }
   ActivityWithSubactivity::onExit();
 
   // Reset orientation back to portrait for the rest of the UI
@@ -113,6 +146,16 @@ void EpubReaderActivity::onExit() {
 
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+
+  if (epub && section && section->pageCount > 0) {
+    const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(section->pageCount);
+    const float bookProgress = epub->calculateProgress(currentSpineIndex, chapterProgress) * 100.0f;
+    LIBRARY_INDEX.updateProgress(epub->getPath(), clampPercent(static_cast<int>(bookProgress + 0.5f)));
+  }
+  LIBRARY_INDEX.saveToFile();
+
+  // Decompressed reader font groups are kept across pages, hand them back to the rest of the UI
+  renderer.clearFontCache();
   section.reset();
   epub.reset();
 }
@@ -174,6 +217,7 @@ void EpubReaderActivity::loop() {
     }
     const int bookProgressPercent = clampPercent(static_cast<int>(bookProgress + 0.5f));
     exitActivity();
+    cancelImagePrefetch();
     enterNewActivity(new EpubReaderMenuActivity(
         this->renderer, this->mappedInput, epub->getTitle(), currentPage, totalPages, bookProgressPercent,
         SETTINGS.orientation, [this](const uint8_t orientation) { onReaderMenuBack(orientation); },
@@ -223,6 +267,7 @@ void EpubReaderActivity::loop() {
   if (skipChapter) {
     // We don't want to delete the section mid-render, so grab the semaphore
     {
+      cancelImagePrefetch();
       RenderLock lock(*this);
       nextPageNumber = 0;
       currentSpineIndex = nextTriggered ? currentSpineIndex + 1 : currentSpineIndex - 1;
@@ -244,6 +289,7 @@ void EpubReaderActivity::loop() {
     } else if (currentSpineIndex > 0) {
       // We don't want to delete the section mid-render, so grab the semaphore
       {
+        cancelImagePrefetch();
         RenderLock lock(*this);
         nextPageNumber = UINT16_MAX;
         currentSpineIndex--;
@@ -257,6 +303,7 @@ void EpubReaderActivity::loop() {
     } else {
       // We don't want to delete the section mid-render, so grab the semaphore
       {
+        cancelImagePrefetch();
         RenderLock lock(*this);
         nextPageNumber = 0;
         currentSpineIndex++;
@@ -330,6 +377,7 @@ void EpubReaderActivity::jumpToPercent(int percent) {
 
   // Reset state so render() reloads and repositions on the target spine.
   {
+    cancelImagePrefetch();
     RenderLock lock(*this);
     currentSpineIndex = targetSpineIndex;
     nextPageNumber = 0;
@@ -409,6 +457,7 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     }
     case EpubReaderMenuActivity::MenuAction::DELETE_CACHE: {
       {
+        cancelImagePrefetch();
         RenderLock lock(*this);
         if (epub) {
           // 2. BACKUP: Read current progress
@@ -465,6 +514,7 @@ void EpubReaderActivity::applyOrientation(const uint8_t orientation) {
 
   // Preserve current reading position so we can restore after reflow.
   {
+    cancelImagePrefetch();
     RenderLock lock(*this);
     if (section) {
       cachedSpineIndex = currentSpineIndex;
@@ -484,8 +534,15 @@ void EpubReaderActivity::applyOrientation(const uint8_t orientation) {
   }
 }
 
+void EpubReaderActivity::requestUpdate() {
+  cancelImagePrefetch();
+  ActivityWithSubactivity::requestUpdate();
+}
+
 // TODO: Failure handling
 void EpubReaderActivity::render(Activity::RenderLock&& lock) {
+  // Updates requested from here on cancel the prefetch this render starts at its end
+  imagePrefetchCancelled = false;
   if (!epub) {
     return;
   }
@@ -613,9 +670,43 @@ void EpubReaderActivity::render(Activity::RenderLock&& lock) {
     const auto start = millis();
     renderContents(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
     LOG_DBG("ERS", "Rendered page in %dms", millis() - start);
-    renderer.clearFontCache();
+    if (FontDecompressor* fontDecompressor = renderer.getFontDecompressor()) {
+      const auto& stats = fontDecompressor->getStats();
+      LOG_DBG("ERS", "Font cache: %u hits, %u misses, %uus inflating", stats.hits, stats.misses,
+              stats.inflateMicros);
+      fontDecompressor->resetStats();
+    }
   }
   saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
+
+  // Decode upcoming images while the reader is on this page rather than when they turn onto it
+  if (imagePrefetchTaskHandle) {
+    xTaskNotifyGive(imagePrefetchTaskHandle);
+  }
+}
+
+void EpubReaderActivity::imagePrefetchTaskTrampoline(void* param) {
+  auto* self = static_cast<EpubReaderActivity*>(param);
+  self->imagePrefetchTaskLoop();
+}
+
+void EpubReaderActivity::imagePrefetchTaskLoop() {
+  const auto cancelled = [this] { return imagePrefetchCancelled.load(); };
+
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    RenderLock lock(*this);
+    // Sub-activities use the SD card from their own render task, and a render may be waiting for the lock already
+    if (!section || subActivity || imagePrefetchCancelled) {
+      continue;
+    }
+    imagePrefetchRunning = true;
+    const auto start = millis();
+    if (section->prefetchImages(section->currentPage, imagePrefetchPages, cancelled)) {
+      LOG_DBG("ERS", "Prefetched images in %lums", millis() - start);
+    }
+    imagePrefetchRunning = false;
+  }
 }
 
 void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageCount) {
@@ -643,6 +734,8 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
   bool forceFullRefresh = page->hasImages() && SETTINGS.textAntiAliasing;
 
   page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  // Only the page goes through the grayscale passes, so the status bar must not count
+  const bool pageHasGray = renderer.hasGrayPixels();
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
   if (forceFullRefresh || pagesUntilFullRefresh <= 1) {
     renderer.displayBuffer(HalDisplay::HALF_REFRESH);
@@ -652,30 +745,11 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
     pagesUntilFullRefresh--;
   }
 
-  // Save bw buffer to reset buffer state after grayscale data sync
-  renderer.storeBwBuffer();
-
-  // grayscale rendering
-  // TODO: Only do this if font supports it
-  if (SETTINGS.textAntiAliasing) {
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleLsbBuffers();
-
-    // Render and copy to MSB buffer
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleMsbBuffers();
-
-    // display grayscale part
-    renderer.displayGrayBuffer();
-    renderer.setRenderMode(GfxRenderer::BW);
+  // grayscale rendering, skipped for pages without any gray tones (1-bit fonts, no grayscale images)
+  if (SETTINGS.textAntiAliasing && pageHasGray) {
+    renderer.renderGrayscale(
+        [&] { page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop); });
   }
-
-  // restore the bw data
-  renderer.restoreBwBuffer();
 }
 
 void EpubReaderActivity::renderStatusBar(const int orientedMarginRight, const int orientedMarginBottom,
@@ -767,8 +841,7 @@ void EpubReaderActivity::renderStatusBar(const int orientedMarginRight, const in
       title = tr(STR_UNNAMED);
       titleWidth = renderer.getTextWidth(SMALL_FONT_ID, title.c_str());
     } else {
-      const auto tocItem = epub->getTocItem(tocIndex);
-      title = tocItem.title;
+      title = epub->getTocTitle(tocIndex);
       titleWidth = renderer.getTextWidth(SMALL_FONT_ID, title.c_str());
       if (titleWidth > availableTitleSpace) {
         // Not enough space to center on the screen, center it within the remaining space instead
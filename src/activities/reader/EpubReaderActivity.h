@@ -2,6 +2,8 @@
 #include <Epub.h>
 #include <Epub/Section.h>
 
+#include <atomic>
+
 #include "EpubReaderMenuActivity.h"
 #include "activities/ActivityWithSubactivity.h"
 
@@ -24,6 +26,17 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
 
+  // Decodes images of the upcoming pages into the pixel cache while the reader is on a page. It runs below every
+  // other task and holds the render lock (the SD card isn't shared between tasks) only while it has work to do.
+  TaskHandle_t imagePrefetchTaskHandle = nullptr;
+  std::atomic<bool> imagePrefetchRunning{false};
+  // Set before taking the render lock to render, change the section or leave the reader, so a prefetch in progress
+  // gives the lock up at the next decoded row. Cleared when a render starts.
+  std::atomic<bool> imagePrefetchCancelled{false};
+  [[noreturn]] static void imagePrefetchTaskTrampoline(void* param);
+  [[noreturn]] void imagePrefetchTaskLoop();
+  void cancelImagePrefetch() { imagePrefetchCancelled = true; }
+
   void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
                       int orientedMarginBottom, int orientedMarginLeft);
   void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft) const;
@@ -44,5 +57,7 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   void onEnter() override;
   void onExit() override;
   void loop() override;
+  void requestUpdate() override;
   void render(Activity::RenderLock&& lock) override;
+  bool preventAutoSleep() override { return imagePrefetchRunning; }
 };
@@ -8,6 +8,7 @@
 
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "LibraryIndex.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "components/UITheme.h"
@@ -57,6 +58,7 @@ void TxtReaderActivity::onEnter() {
   APP_STATE.openEpubPath = filePath;
   APP_STATE.saveToFile();
   RECENT_BOOKS.addBook(filePath, fileName, "", "");
+  LIBRARY_INDEX.updateBookMetadata(filePath, fileName, "", "", "");
 
   // Trigger first update
   requestUpdate();
@@ -72,6 +74,9 @@ void TxtReaderActivity::onExit() {
   currentPageLines.clear();
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+  LIBRARY_INDEX.saveToFile();
+  // Decompressed reader font groups are kept across pages, hand them back to the rest of the UI
+  renderer.clearFontCache();
   txt.reset();
 }
 
@@ -368,7 +373,6 @@ void TxtReaderActivity::render(Activity::RenderLock&&) {
 
   renderer.clearScreen();
   renderPage();
-  renderer.clearFontCache();
 
   // Save progress
   saveProgress();
@@ -423,6 +427,8 @@ void TxtReaderActivity::renderPage() {
 
   // First pass: BW rendering
   renderLines();
+  // Only the text goes through the grayscale passes, so the status bar must not count
+  const bool pageHasGray = renderer.hasGrayPixels();
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
 
   if (pagesUntilFullRefresh <= 1) {
@@ -433,26 +439,9 @@ void TxtReaderActivity::renderPage() {
     pagesUntilFullRefresh--;
   }
 
-  // Grayscale rendering pass (for anti-aliased fonts)
-  if (SETTINGS.textAntiAliasing) {
-    // Save BW buffer for restoration after grayscale pass
-    renderer.storeBwBuffer();
-
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    renderLines();
-    renderer.copyGrayscaleLsbBuffers();
-
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    renderLines();
-    renderer.copyGrayscaleMsbBuffers();
-
-    renderer.displayGrayBuffer();
-    renderer.setRenderMode(GfxRenderer::BW);
-
-    // Restore BW buffer
-    renderer.restoreBwBuffer();
+  // Grayscale rendering pass (for anti-aliased fonts), skipped when the text has no gray tones
+  if (SETTINGS.textAntiAliasing && pageHasGray) {
+    renderer.renderGrayscale(renderLines);
   }
 }
 
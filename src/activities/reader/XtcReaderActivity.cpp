@@ -12,8 +12,11 @@
 #include <HalStorage.h>
 #include <I18n.h>
 
+#include <algorithm>
+
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "LibraryIndex.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "XtcReaderChapterSelectionActivity.h"
@@ -40,7 +43,13 @@ void XtcReaderActivity::onEnter() {
   // Save current XTC as last opened book and add to recent books
   APP_STATE.openEpubPath = xtc->getPath();
   APP_STATE.saveToFile();
-  RECENT_BOOKS.addBook(xtc->getPath(), xtc->getTitle(), xtc->getAuthor(), xtc->getThumbBmpPath());
+  // Make sure the home screen has a cover thumbnail without having to open the book itself, for every theme
+  xtc->generateThumbBmps(UITheme::getCoverThumbHeights());
+  const int thumbHeight = UITheme::getInstance().getMetrics().homeCoverHeight;
+  const bool hasThumb = Storage.exists(xtc->getThumbBmpPath(thumbHeight).c_str());
+  const std::string thumbBmpPath = hasThumb ? xtc->getThumbBmpPath() : "";
+  RECENT_BOOKS.addBook(xtc->getPath(), xtc->getTitle(), xtc->getAuthor(), thumbBmpPath);
+  LIBRARY_INDEX.updateBookMetadata(xtc->getPath(), xtc->getTitle(), xtc->getAuthor(), "", thumbBmpPath);
 
   // Trigger first update
   requestUpdate();
@@ -51,6 +60,13 @@ void XtcReaderActivity::onExit() {
 
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+
+  if (xtc) {
+    // currentPage can sit one past the last page on the "End of book" screen
+    LIBRARY_INDEX.updateProgress(xtc->getPath(), std::min<uint8_t>(xtc->calculateProgress(currentPage), 100));
+  }
+  LIBRARY_INDEX.saveToFile();
+
   xtc.reset();
 }
 
@@ -192,10 +208,8 @@ void XtcReaderActivity::renderPage() {
   // Clear screen first
   renderer.clearScreen();
 
-  // Copy page bitmap using GfxRenderer's drawPixel
-  // XTC/XTCH pages are pre-rendered with status bar included, so render full page
-  const uint16_t maxSrcY = pageHeight;
-
+  // XTC/XTCH pages are pre-rendered with status bar included, so render full page. They are drawn a panel byte at
+  // a time: rows or columns that run along panel rows are copied in, the others transposed 8x8 pixels at a time.
   if (bitDepth == 2) {
     // XTH 2-bit mode: Two bit planes, column-major order
     // - Columns scanned right to left (x = width-1 down to 0)
@@ -207,40 +221,24 @@ void XtcReaderActivity::renderPage() {
     const size_t planeSize = (static_cast<size_t>(pageWidth) * pageHeight + 7) / 8;
     const uint8_t* plane1 = pageBuffer;              // Bit1 plane
     const uint8_t* plane2 = pageBuffer + planeSize;  // Bit2 plane
-    const size_t colBytes = (pageHeight + 7) / 8;    // Bytes per column (100 for 800 height)
-
-    // Lambda to get pixel value at (x, y)
-    auto getPixelValue = [&](uint16_t x, uint16_t y) -> uint8_t {
-      const size_t colIndex = pageWidth - 1 - x;
-      const size_t byteInCol = y / 8;
-      const size_t bitInByte = 7 - (y % 8);
-      const size_t byteOffset = colIndex * colBytes + byteInCol;
-      const uint8_t bit1 = (plane1[byteOffset] >> bitInByte) & 1;
-      const uint8_t bit2 = (plane2[byteOffset] >> bitInByte) & 1;
-      return (bit1 << 1) | bit2;
-    };
+    const auto drawPage = [&] { renderer.drawImage2BitPlanes(plane1, plane2, 0, 0, pageWidth, pageHeight); };
 
     // Optimized grayscale rendering without storeBwBuffer (saves 48KB peak memory)
     // Flow: BW display → LSB/MSB passes → grayscale display → re-render BW for next frame
 
-    // Count pixel distribution for debugging
+    // Count pixel distribution for debugging, a plane byte (8 pixels) at a time. Padding bits are 0, i.e. white.
     uint32_t pixelCounts[4] = {0, 0, 0, 0};
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        pixelCounts[getPixelValue(x, y)]++;
-      }
+    for (size_t i = 0; i < planeSize; i++) {
+      pixelCounts[1] += __builtin_popcount(~plane1[i] & plane2[i] & 0xFF);
+      pixelCounts[2] += __builtin_popcount(plane1[i] & ~plane2[i] & 0xFF);
+      pixelCounts[3] += __builtin_popcount(plane1[i] & plane2[i]);
     }
+    pixelCounts[0] = static_cast<uint32_t>(pageWidth) * pageHeight - pixelCounts[1] - pixelCounts[2] - pixelCounts[3];
     LOG_DBG("XTR", "Pixel distribution: White=%lu, DarkGrey=%lu, LightGrey=%lu, Black=%lu", pixelCounts[0],
             pixelCounts[1], pixelCounts[2], pixelCounts[3]);
 
     // Pass 1: BW buffer - draw all non-white pixels as black
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) >= 1) {
-          renderer.drawPixel(x, y, true);
-        }
-      }
-    }
+    drawPage();
 
     // Display BW with conditional refresh based on pagesUntilFullRefresh
     if (pagesUntilFullRefresh <= 1) {
@@ -254,40 +252,24 @@ void XtcReaderActivity::renderPage() {
     // Pass 2: LSB buffer - mark DARK gray only (XTH value 1)
     // In LUT: 0 bit = apply gray effect, 1 bit = untouched
     renderer.clearScreen(0x00);
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) == 1) {  // Dark grey only
-          renderer.drawPixel(x, y, false);
-        }
-      }
-    }
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+    drawPage();
     renderer.copyGrayscaleLsbBuffers();
 
     // Pass 3: MSB buffer - mark LIGHT AND DARK gray (XTH value 1 or 2)
     // In LUT: 0 bit = apply gray effect, 1 bit = untouched
     renderer.clearScreen(0x00);
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        const uint8_t pv = getPixelValue(x, y);
-        if (pv == 1 || pv == 2) {  // Dark grey or Light grey
-          renderer.drawPixel(x, y, false);
-        }
-      }
-    }
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+    drawPage();
     renderer.copyGrayscaleMsbBuffers();
 
     // Display grayscale overlay
     renderer.displayGrayBuffer();
 
     // Pass 4: Re-render BW to framebuffer (restore for next frame, instead of restoreBwBuffer)
+    renderer.setRenderMode(GfxRenderer::BW);
     renderer.clearScreen();
-    for (uint16_t y = 0; y < pageHeight; y++) {
-      for (uint16_t x = 0; x < pageWidth; x++) {
-        if (getPixelValue(x, y) >= 1) {
-          renderer.drawPixel(x, y, true);
-        }
-      }
-    }
+    drawPage();
 
     // Cleanup grayscale buffers with current frame buffer
     renderer.cleanupGrayscaleWithFrameBuffer();
@@ -297,23 +279,8 @@ void XtcReaderActivity::renderPage() {
     LOG_DBG("XTR", "Rendered page %lu/%lu (2-bit grayscale)", currentPage + 1, xtc->getPageCount());
     return;
   } else {
-    // 1-bit mode: 8 pixels per byte, MSB first
-    const size_t srcRowBytes = (pageWidth + 7) / 8;  // 60 bytes for 480 width
-
-    for (uint16_t srcY = 0; srcY < maxSrcY; srcY++) {
-      const size_t srcRowStart = srcY * srcRowBytes;
-
-      for (uint16_t srcX = 0; srcX < pageWidth; srcX++) {
-        // Read source pixel (MSB first, bit 7 = leftmost pixel)
-        const size_t srcByte = srcRowStart + srcX / 8;
-        const size_t srcBit = 7 - (srcX % 8);
-        const bool isBlack = !((pageBuffer[srcByte] >> srcBit) & 1);  // XTC: 0 = black, 1 = white
-
-        if (isBlack) {
-          renderer.drawPixel(srcX, srcY, true);
-        }
-      }
-    }
+    // 1-bit mode: row-major, 8 pixels per byte, MSB first (bit 7 = leftmost pixel), 0 = black, 1 = white
+    renderer.drawImage1Bit(pageBuffer, 0, 0, pageWidth, pageHeight);
   }
   // White pixels are already cleared by clearScreen()
 
@@ -3,6 +3,7 @@
 #include <GfxRenderer.h>
 #include <Logging.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "MappedInputManager.h"
@@ -74,6 +75,16 @@ std::string UITheme::getCoverThumbPath(std::string coverBmpPath, int coverHeight
   return coverBmpPath;
 }
 
+std::vector<int> UITheme::getCoverThumbHeights() {
+  std::vector<int> heights;
+  for (const ThemeMetrics* metrics : {&BaseMetrics::values, &LyraMetrics::values, &Lyra3CoversMetrics::values}) {
+    if (std::find(heights.begin(), heights.end(), metrics->homeCoverHeight) == heights.end()) {
+      heights.push_back(metrics->homeCoverHeight);
+    }
+  }
+  return heights;
+}
+
 UIIcon UITheme::getFileIcon(std::string filename) {
   if (filename.back() == '/') {
     return Folder;
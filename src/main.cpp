@@ -9,6 +9,7 @@
 #include <I18n.h>
 #include <Logging.h>
 #include <SPI.h>
+#include <SdFontFamily.h>
 #include <builtinFonts/all.h>
 
 #include <cstring>
@@ -17,6 +18,7 @@
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "KOReaderCredentialStore.h"
+#include "LibraryIndex.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "activities/boot_sleep/BootActivity.h"
@@ -129,15 +131,66 @@ EpdFont ui12RegularFont(&ubuntu_12_regular);
 EpdFont ui12BoldFont(&ubuntu_12_bold);
 EpdFontFamily ui12FontFamily(&ui12RegularFont, &ui12BoldFont);
 
+// Reader fonts in /fonts on the SD card replace the builtin fonts of the same name and stand in for the ones left out
+// of the firmware (OMIT_FONTS); without one, SETTINGS.getReaderFontId() falls back to Bookerly 14. Only the current
+// reader font is loaded, and only while a reader is open.
+constexpr char SD_FONTS_DIRECTORY[] = "/fonts";
+SdFontFamily sdReaderFontFamily;
+int sdReaderFontId = 0;
+
+// Fonts already registered are kept, so this also brings back a builtin font an SD font replaced
+void registerBuiltinReaderFonts() {
+  renderer.insertFont(BOOKERLY_14_FONT_ID, bookerly14FontFamily);
+#ifndef OMIT_FONTS
+  renderer.insertFont(BOOKERLY_12_FONT_ID, bookerly12FontFamily);
+  renderer.insertFont(BOOKERLY_16_FONT_ID, bookerly16FontFamily);
+  renderer.insertFont(BOOKERLY_18_FONT_ID, bookerly18FontFamily);
+
+  renderer.insertFont(NOTOSANS_12_FONT_ID, notosans12FontFamily);
+  renderer.insertFont(NOTOSANS_14_FONT_ID, notosans14FontFamily);
+  renderer.insertFont(NOTOSANS_16_FONT_ID, notosans16FontFamily);
+  renderer.insertFont(NOTOSANS_18_FONT_ID, notosans18FontFamily);
+  renderer.insertFont(OPENDYSLEXIC_8_FONT_ID, opendyslexic8FontFamily);
+  renderer.insertFont(OPENDYSLEXIC_10_FONT_ID, opendyslexic10FontFamily);
+  renderer.insertFont(OPENDYSLEXIC_12_FONT_ID, opendyslexic12FontFamily);
+  renderer.insertFont(OPENDYSLEXIC_14_FONT_ID, opendyslexic14FontFamily);
+#endif  // OMIT_FONTS
+}
+
+void unloadSdReaderFont() {
+  if (!sdReaderFontFamily.isLoaded()) {
+    return;
+  }
+  renderer.removeFont(sdReaderFontId);
+  sdReaderFontFamily.unload();
+  SETTINGS.setSdReaderFontId(0);
+  registerBuiltinReaderFonts();
+}
+
+void loadSdReaderFont() {
+  unloadSdReaderFont();
+  if (!sdReaderFontFamily.load(SD_FONTS_DIRECTORY, SETTINGS.getSelectedReaderFontName())) {
+    return;
+  }
+  sdReaderFontId = SETTINGS.getSelectedReaderFontId();
+  renderer.removeFont(sdReaderFontId);
+  renderer.insertFont(sdReaderFontId, sdReaderFontFamily.getFamily());
+  SETTINGS.setSdReaderFontId(sdReaderFontId);
+}
+
 // measurement of power button press duration calibration value
 unsigned long t1 = 0;
 unsigned long t2 = 0;
 
 void exitActivity() {
   if (currentActivity) {
+    const bool wasReader = currentActivity->isReaderActivity();
     currentActivity->onExit();
     delete currentActivity;
     currentActivity = nullptr;
+    if (wasReader) {
+      unloadSdReaderFont();
+    }
   }
 }
 
@@ -217,6 +270,7 @@ void onGoToMyLibraryWithPath(const std::string& path);
 void onGoToRecentBooks();
 void onGoToReader(const std::string& initialEpubPath) {
   exitActivity();
+  loadSdReaderFont();
   enterNewActivity(
       new ReaderActivity(renderer, mappedInputManager, initialEpubPath, onGoHome, onGoToMyLibraryWithPath));
 }
@@ -267,21 +321,7 @@ void setupDisplayAndFonts() {
     LOG_ERR("MAIN", "Font decompressor init failed");
   }
   renderer.setFontDecompressor(&fontDecompressor);
-  renderer.insertFont(BOOKERLY_14_FONT_ID, bookerly14FontFamily);
-#ifndef OMIT_FONTS
-  renderer.insertFont(BOOKERLY_12_FONT_ID, bookerly12FontFamily);
-  renderer.insertFont(BOOKERLY_16_FONT_ID, bookerly16FontFamily);
-  renderer.insertFont(BOOKERLY_18_FONT_ID, bookerly18FontFamily);
-
-  renderer.insertFont(NOTOSANS_12_FONT_ID, notosans12FontFamily);
-  renderer.insertFont(NOTOSANS_14_FONT_ID, notosans14FontFamily);
-  renderer.insertFont(NOTOSANS_16_FONT_ID, notosans16FontFamily);
-  renderer.insertFont(NOTOSANS_18_FONT_ID, notosans18FontFamily);
-  renderer.insertFont(OPENDYSLEXIC_8_FONT_ID, opendyslexic8FontFamily);
-  renderer.insertFont(OPENDYSLEXIC_10_FONT_ID, opendyslexic10FontFamily);
-  renderer.insertFont(OPENDYSLEXIC_12_FONT_ID, opendyslexic12FontFamily);
-  renderer.insertFont(OPENDYSLEXIC_14_FONT_ID, opendyslexic14FontFamily);
-#endif  // OMIT_FONTS
+  registerBuiltinReaderFonts();
   renderer.insertFont(UI_10_FONT_ID, ui10FontFamily);
   renderer.insertFont(UI_12_FONT_ID, ui12FontFamily);
   renderer.insertFont(SMALL_FONT_ID, smallFontFamily);
@@ -348,6 +388,7 @@ void setup() {
 
   APP_STATE.loadFromFile();
   RECENT_BOOKS.loadFromFile();
+  LIBRARY_INDEX.loadFromFile();
 
   // Boot to home screen if no book is open, last sleep was not from reader, back button is held, or reader activity
   // crashed (indicated by readerActivityLoadCount > 0)
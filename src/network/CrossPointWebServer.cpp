@@ -11,6 +11,7 @@
 #include <algorithm>
 
 #include "CrossPointSettings.h"
+#include "LibraryIndex.h"
 #include "SettingsList.h"
 #include "html/FilesPageHtml.generated.h"
 #include "html/HomePageHtml.generated.h"
@@ -49,6 +50,13 @@ void clearEpubCacheIfNeeded(const String& filePath) {
   }
 }
 
+// Helper function to drop a changed or removed book, or every book in a folder, from the library index. They are
+// re-indexed when next listed.
+void forgetLibraryBooks(const String& path) {
+  LIBRARY_INDEX.removeBooksUnder(path.c_str());
+  LIBRARY_INDEX.saveToFile();
+}
+
 String normalizeWebPath(const String& inputPath) {
   if (inputPath.isEmpty() || inputPath == "/") {
     return "/";
@@ -662,6 +670,7 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += state.fileName;
         clearEpubCacheIfNeeded(filePath);
+        forgetLibraryBooks(filePath);
       }
     }
   } else if (upload.status == UPLOAD_FILE_ABORTED) {
@@ -808,6 +817,7 @@ void CrossPointWebServer::handleRename() const {
   }
 
   clearEpubCacheIfNeeded(itemPath);
+  forgetLibraryBooks(itemPath);
   const bool success = file.rename(newPath.c_str());
   file.close();
 
@@ -901,6 +911,7 @@ void CrossPointWebServer::handleMove() const {
   }
 
   clearEpubCacheIfNeeded(itemPath);
+  forgetLibraryBooks(itemPath);
   const bool success = file.rename(newPath.c_str());
   file.close();
 
@@ -981,9 +992,15 @@ void CrossPointWebServer::handleDelete() const {
       dir.close();
     }
     success = Storage.rmdir(itemPath.c_str());
+    if (success) {
+      forgetLibraryBooks(itemPath);
+    }
   } else {
     // For files, use remove
     success = Storage.remove(itemPath.c_str());
+    if (success) {
+      forgetLibraryBooks(itemPath);
+    }
   }
 
   if (success) {
@@ -1295,6 +1312,7 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += wsUploadFileName;
         clearEpubCacheIfNeeded(filePath);
+        forgetLibraryBooks(filePath);
 
         wsServer->sendTXT(num, "DONE");
         lastProgressSent = 0;
@@ -0,0 +1,135 @@
+// Draws known UI changes (a moving selection bar, a changed page number, a popup, a page turn) and checks the window
+// DamageTracker returns for them, that unchanged frames give NoChange and that large or unknown changes give FullFrame.
+// Then checks what GfxRenderer::displayBuffer sends to the panel for each result, including that NoChange still
+// refreshes the whole frame with the fading fix.
+
+#include <GfxRenderer.h>
+
+#include <cstdio>
+#include <functional>
+#include <string>
+
+#include "DamageTracker.h"
+
+namespace {
+HalDisplay display;
+GfxRenderer renderer(display);
+
+const char* const kResultNames[] = {"NoChange", "Window", "FullFrame"};
+
+int failures = 0;
+
+std::string describe(const DamageTracker::Result result, const DamageTracker::Rect& window) {
+  std::string text = kResultNames[result];
+  if (result == DamageTracker::Window) {
+    text += " x=" + std::to_string(window.x) + " y=" + std::to_string(window.y) +
+            " w=" + std::to_string(window.width) + " h=" + std::to_string(window.height);
+  }
+  return text;
+}
+
+// Draws a change over the previous frame and checks what the tracker reports for it
+void expectDamage(DamageTracker& tracker, const char* name, const std::function<void()>& draw,
+                  const DamageTracker::Result expected, const DamageTracker::Rect expectedWindow = {}) {
+  draw();
+  DamageTracker::Rect window = {};
+  const DamageTracker::Result result = tracker.update(renderer.getFrameBuffer(), &window);
+  const std::string got = describe(result, window);
+  const std::string want = describe(expected, expectedWindow);
+  const bool ok = got == want;
+  failures += !ok;
+  printf("%-44s %-36s %s\n", name, got.c_str(), ok ? "ok" : ("FAILED: expected " + want).c_str());
+}
+
+std::string describe(const HalDisplay::Refresh& refresh) {
+  static const char* const modeNames[] = {"full", "half", "fast"};
+  return std::string(refresh.window ? "window" : "frame") + " " + modeNames[refresh.mode] +
+         " x=" + std::to_string(refresh.x) + " y=" + std::to_string(refresh.y) + " w=" + std::to_string(refresh.width) +
+         " h=" + std::to_string(refresh.height) + (refresh.turnOffScreen ? " off" : "");
+}
+
+// Draws a change, shows it with GfxRenderer::displayBuffer and checks the refresh the panel receives
+void expectRefresh(const char* name, const std::function<void()>& draw, const HalDisplay::RefreshMode mode,
+                   const HalDisplay::Refresh expected) {
+  draw();
+  renderer.displayBuffer(mode);
+  const std::string got = describe(display.getLastRefresh());
+  const std::string want = describe(expected);
+  const bool ok = got == want;
+  failures += !ok;
+  printf("%-44s %-36s %s\n", name, got.c_str(), ok ? "ok" : ("FAILED: expected " + want).c_str());
+}
+
+void drawList(const int selectedRow) {
+  for (int row = 0; row < 10; row++) {
+    if (row == selectedRow) {
+      renderer.fillRect(0, 60 + row * 40, 800, 40, true);
+    } else {
+      renderer.fillRect(0, 60 + row * 40, 800, 40, false);
+      renderer.drawLine(20, 99 + row * 40, 779, 99 + row * 40, true);
+    }
+  }
+}
+}  // namespace
+
+int main() {
+  renderer.begin();
+  // Logical and physical coordinates are the same in this orientation
+  renderer.setOrientation(GfxRenderer::LandscapeCounterClockwise);
+  renderer.clearScreen();
+  DamageTracker tracker;
+
+  printf("%-44s %-36s\n", "change", "result");
+  expectDamage(tracker, "first frame", [] { drawList(0); }, DamageTracker::FullFrame);
+  expectDamage(tracker, "same frame", [] {}, DamageTracker::NoChange);
+  expectDamage(tracker, "same frame drawn again", [] { drawList(0); }, DamageTracker::NoChange);
+  // Rows 0 and 2 cover y 60-99 and 140-179, which is tile rows 3-6 and 8-11
+  expectDamage(tracker, "selection bar moves down", [] { drawList(2); }, DamageTracker::Window, {0, 48, 800, 144});
+  expectDamage(tracker, "page number changes", [] { renderer.fillRect(165, 465, 12, 10, true); },
+               DamageTracker::Window, {160, 464, 80, 16});
+  expectDamage(tracker, "page number changes back", [] { renderer.fillRect(165, 465, 12, 10, false); },
+               DamageTracker::Window, {160, 464, 80, 16});
+  // A single pixel in each of two tiles gives the union of the two
+  expectDamage(tracker, "two distant changes", [] {
+    renderer.drawPixel(85, 130, true);
+    renderer.drawPixel(330, 250, true);
+  }, DamageTracker::Window, {80, 128, 320, 128});
+  // 480x480 is exactly 60% of the panel, which is still worth a window
+  expectDamage(tracker, "popup at the window limit", [] { renderer.fillRect(0, 0, 480, 480, true); },
+               DamageTracker::Window, {0, 0, 480, 480});
+  expectDamage(tracker, "popup over the window limit", [] { renderer.fillRect(0, 0, 481, 480, false); },
+               DamageTracker::FullFrame);
+  expectDamage(tracker, "page turn", [] {
+    renderer.clearScreen();
+    drawList(5);
+  }, DamageTracker::FullFrame);
+  tracker.invalidate();
+  expectDamage(tracker, "unchanged after a grayscale refresh", [] {}, DamageTracker::FullFrame);
+  expectDamage(tracker, "unchanged again", [] {}, DamageTracker::NoChange);
+  // In portrait the logical x runs up the panel: x 10-39 is panel rows 440-469, y 20-24 is panel columns 20-24
+  renderer.setOrientation(GfxRenderer::Portrait);
+  expectDamage(tracker, "portrait checkbox", [] { renderer.fillRect(10, 20, 30, 5, true); }, DamageTracker::Window,
+               {0, 432, 80, 48});
+  renderer.setOrientation(GfxRenderer::LandscapeCounterClockwise);
+
+  printf("\n%-44s %-36s\n", "refresh", "sent to the panel");
+  renderer.setFadingFix(true);
+  renderer.clearScreen();
+  expectRefresh("first frame", [] { drawList(3); }, HalDisplay::FAST_REFRESH,
+                {false, HalDisplay::FAST_REFRESH, 0, 0, 800, 480, true});
+  expectRefresh("unchanged frame", [] {}, HalDisplay::FAST_REFRESH,
+                {false, HalDisplay::FAST_REFRESH, 0, 0, 800, 480, true});
+  expectRefresh("selection bar moves up", [] { drawList(2); }, HalDisplay::FAST_REFRESH,
+                {true, HalDisplay::FAST_REFRESH, 0, 128, 800, 96, true});
+  renderer.setFadingFix(false);
+  expectRefresh("page number changes", [] { renderer.fillRect(165, 465, 12, 10, true); }, HalDisplay::FAST_REFRESH,
+                {true, HalDisplay::FAST_REFRESH, 160, 464, 80, 16, false});
+  expectRefresh("page number changes, half refresh", [] { renderer.fillRect(165, 465, 12, 10, false); },
+                HalDisplay::HALF_REFRESH, {false, HalDisplay::HALF_REFRESH, 0, 0, 800, 480, false});
+  expectRefresh("unchanged frame, full refresh", [] {}, HalDisplay::FULL_REFRESH,
+                {false, HalDisplay::FULL_REFRESH, 0, 0, 800, 480, false});
+
+  printf("\n%s\n", failures == 0 ? "All damage windows and refreshes are as expected"
+                                 : "FAILED: damage windows or refreshes differ from the expected ones");
+  return failures == 0 ? 0 : 1;
+}
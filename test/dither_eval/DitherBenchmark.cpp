@@ -0,0 +1,443 @@
+// Runs the dithering pipeline over the images of the test EPUBs, reports how fast each part is and compares every
+// output with a golden image, so rewrites of the ditherers and converters can be shown to give the same pixels:
+//  - the ditherers of BitmapHelpers and DitherUtils on the decoded images, fed the way their callers feed them
+//  - the JPEG and PNG converters on the image files, writing the sleep cover and both home screen thumbnails from a
+//    single decode, the way Epub::generateCoverBmps does
+//
+// Speeds are in megapixels per second of input (source pixels for the converters). Golden images are 1 or 2-bit
+// grayscale PNG files named after the image and the pipeline, written with --update.
+//
+// Decoded images are PGM files (see extract_images.py). Images larger than the screen are subsampled to fit it before
+// dithering, which keeps the golden images small without depending on the scalers of the reader.
+
+#include <BitmapHelpers.h>
+#include <HalStorage.h>
+#include <JpegToBmpConverter.h>
+#include <PngToBmpConverter.h>
+#include <ScaledBmpWriter.h>
+#include <miniz.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../../lib/Epub/Epub/converters/DitherUtils.h"
+#include "../../lib/Epub/Epub/converters/ImageDimensionsParser.h"
+
+namespace {
+constexpr int kScreenWidth = 480;
+constexpr int kScreenHeight = 800;
+// Each pipeline is repeated until it has run this long, for stable speeds
+constexpr double kMinTimedMs = 100.0;
+
+struct GrayImage {
+  int width = 0;
+  int height = 0;
+  std::vector<uint8_t> pixels;
+};
+
+// Output of a pipeline: one gray level (0 = black) per pixel, of 1 << bits levels
+struct Levels {
+  int width = 0;
+  int height = 0;
+  int bits = 2;
+  std::vector<uint8_t> values;
+
+  bool operator==(const Levels& other) const {
+    return width == other.width && height == other.height && bits == other.bits && values == other.values;
+  }
+};
+
+std::vector<uint8_t> readFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+bool loadPgm(const std::string& path, GrayImage& image) {
+  std::ifstream file(path, std::ios::binary);
+  std::string magic;
+  int maxValue = 0;
+  file >> magic >> image.width >> image.height >> maxValue;
+  file.get();
+  if (!file || magic != "P5" || maxValue != 255) {
+    return false;
+  }
+  image.pixels.resize(static_cast<size_t>(image.width) * image.height);
+  file.read(reinterpret_cast<char*>(image.pixels.data()), static_cast<std::streamsize>(image.pixels.size()));
+  return static_cast<bool>(file);
+}
+
+// Every step-th pixel of every step-th row, with the smallest step that fits the screen
+GrayImage fitScreen(const GrayImage& image) {
+  const int step = std::max({1, (image.width + kScreenWidth - 1) / kScreenWidth,
+                             (image.height + kScreenHeight - 1) / kScreenHeight});
+  if (step == 1) {
+    return image;
+  }
+  GrayImage fitted{image.width / step, image.height / step, {}};
+  fitted.pixels.reserve(static_cast<size_t>(fitted.width) * fitted.height);
+  for (int y = 0; y < fitted.height; y++) {
+    for (int x = 0; x < fitted.width; x++) {
+      fitted.pixels.push_back(image.pixels[y * step * image.width + x * step]);
+    }
+  }
+  return fitted;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Golden images: grayscale PNG files of bit depth 1 or 2, rows unfiltered
+
+void writeChunk(std::vector<uint8_t>& png, const char* type, const uint8_t* data, const size_t size) {
+  const auto append32 = [&png](const uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) png.push_back(value >> shift);
+  };
+  append32(size);
+  const size_t typeStart = png.size();
+  png.insert(png.end(), type, type + 4);
+  png.insert(png.end(), data, data + size);
+  append32(mz_crc32(MZ_CRC32_INIT, png.data() + typeStart, size + 4));
+}
+
+bool savePng(const std::string& path, const Levels& levels) {
+  const int rowBytes = (levels.width * levels.bits + 7) / 8;
+  std::vector<uint8_t> raw(static_cast<size_t>(rowBytes + 1) * levels.height);
+  for (int y = 0; y < levels.height; y++) {
+    uint8_t* row = &raw[static_cast<size_t>(y) * (rowBytes + 1) + 1];  // After the filter type byte (0, none)
+    for (int x = 0; x < levels.width; x++) {
+      const int bit = x * levels.bits;
+      row[bit / 8] |= levels.values[y * levels.width + x] << (8 - levels.bits - bit % 8);
+    }
+  }
+  size_t compressedSize = 0;
+  void* compressed = tdefl_compress_mem_to_heap(raw.data(), raw.size(), &compressedSize,
+                                                static_cast<int>(TDEFL_WRITE_ZLIB_HEADER) | TDEFL_DEFAULT_MAX_PROBES);
+  if (!compressed) {
+    return false;
+  }
+
+  std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  const uint8_t header[13] = {static_cast<uint8_t>(levels.width >> 24),  static_cast<uint8_t>(levels.width >> 16),
+                              static_cast<uint8_t>(levels.width >> 8),   static_cast<uint8_t>(levels.width),
+                              static_cast<uint8_t>(levels.height >> 24), static_cast<uint8_t>(levels.height >> 16),
+                              static_cast<uint8_t>(levels.height >> 8),  static_cast<uint8_t>(levels.height),
+                              static_cast<uint8_t>(levels.bits),         0,  // Grayscale
+                              0,                                         0,
+                              0};
+  writeChunk(png, "IHDR", header, sizeof(header));
+  writeChunk(png, "IDAT", static_cast<const uint8_t*>(compressed), compressedSize);
+  writeChunk(png, "IEND", nullptr, 0);
+  mz_free(compressed);
+
+  std::ofstream file(path, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(png.data()), static_cast<std::streamsize>(png.size()));
+  return static_cast<bool>(file);
+}
+
+bool loadPng(const std::string& path, Levels& levels) {
+  const std::vector<uint8_t> png = readFile(path);
+  const auto read32 = [&png](const size_t pos) {
+    return static_cast<uint32_t>(png[pos]) << 24 | png[pos + 1] << 16 | png[pos + 2] << 8 | png[pos + 3];
+  };
+  if (png.size() < 8 || memcmp(png.data(), "\x89PNG\r\n\x1A\n", 8) != 0) {
+    return false;
+  }
+  std::vector<uint8_t> idat;
+  for (size_t pos = 8; pos + 12 <= png.size();) {
+    const uint32_t size = read32(pos);
+    const char* type = reinterpret_cast<const char*>(&png[pos + 4]);
+    if (pos + 12 + size > png.size()) return false;
+    if (memcmp(type, "IHDR", 4) == 0) {
+      levels.width = static_cast<int>(read32(pos + 8));
+      levels.height = static_cast<int>(read32(pos + 12));
+      levels.bits = png[pos + 16];
+      if (png[pos + 17] != 0 || (levels.bits != 1 && levels.bits != 2)) return false;
+    } else if (memcmp(type, "IDAT", 4) == 0) {
+      idat.insert(idat.end(), &png[pos + 8], &png[pos + 8 + size]);
+    }
+    pos += 12 + size;
+  }
+
+  size_t rawSize = 0;
+  auto* raw = static_cast<uint8_t*>(
+      tinfl_decompress_mem_to_heap(idat.data(), idat.size(), &rawSize, TINFL_FLAG_PARSE_ZLIB_HEADER));
+  const int rowBytes = (levels.width * levels.bits + 7) / 8;
+  bool valid = raw && rawSize == static_cast<size_t>(rowBytes + 1) * levels.height;
+  levels.values.clear();
+  for (int y = 0; valid && y < levels.height; y++) {
+    const uint8_t* row = raw + static_cast<size_t>(y) * (rowBytes + 1);
+    valid = row[0] == 0;  // Golden images are written unfiltered
+    for (int x = 0; valid && x < levels.width; x++) {
+      const int bit = x * levels.bits;
+      levels.values.push_back((row[1 + bit / 8] >> (8 - levels.bits - bit % 8)) & ((1 << levels.bits) - 1));
+    }
+  }
+  mz_free(raw);
+  return valid;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Ditherers, each fed the way the reader feeds it
+
+struct Ditherer {
+  const char* name;
+  int bits;
+  std::function<void(const GrayImage&, Levels&)> run;
+};
+
+// Runs a pixel function over the image in row order, nextRow is called after each row
+template <typename PixelFn, typename NextRowFn>
+void ditherRows(const GrayImage& image, Levels& out, const PixelFn& pixel, const NextRowFn& nextRow) {
+  out.values.resize(image.pixels.size());
+  for (int y = 0; y < image.height; y++) {
+    const uint8_t* row = &image.pixels[y * image.width];
+    uint8_t* outRow = &out.values[y * image.width];
+    for (int x = 0; x < image.width; x++) {
+      outRow[x] = pixel(row[x], x, y);
+    }
+    nextRow();
+  }
+}
+
+const Ditherer kDitherers[] = {
+    // Page images (JpegToFramebufferConverter, PngToFramebufferConverter)
+    {"bayer", 2,
+     [](const GrayImage& image, Levels& out) {
+       ditherRows(
+           image, out,
+           [](const uint8_t gray, const int x, const int y) { return applyBayerDither4Level(gray, x, y); }, [] {});
+     }},
+    // Covers and high-color BMPs (ScaledBmpWriter, Bitmap)
+    {"atkinson", 2,
+     [](const GrayImage& image, Levels& out) {
+       AtkinsonDitherer ditherer(image.width);
+       ditherRows(
+           image, out,
+           [&](const uint8_t gray, const int x, int) { return ditherer.processPixel(adjustPixel(gray), x); },
+           [&] { ditherer.nextRow(); });
+     }},
+    {"floyd_steinberg", 2,
+     [](const GrayImage& image, Levels& out) {
+       FloydSteinbergDitherer ditherer(image.width);
+       ditherRows(
+           image, out,
+           [&](const uint8_t gray, const int x, int) { return ditherer.processPixel(adjustPixel(gray), x); },
+           [&] { ditherer.nextRow(); });
+     }},
+    {"noise", 2,
+     [](const GrayImage& image, Levels& out) {
+       ditherRows(
+           image, out, [](const uint8_t gray, const int x, const int y) { return quantize(adjustPixel(gray), x, y); },
+           [] {});
+     }},
+    // Home screen thumbnails (ScaledBmpWriter)
+    {"atkinson_1bit", 1,
+     [](const GrayImage& image, Levels& out) {
+       Atkinson1BitDitherer ditherer(image.width);
+       ditherRows(
+           image, out, [&](const uint8_t gray, const int x, int) { return ditherer.processPixel(gray, x); },
+           [&] { ditherer.nextRow(); });
+     }},
+    {"noise_1bit", 1,
+     [](const GrayImage& image, Levels& out) {
+       ditherRows(image, out, [](const uint8_t gray, const int x, const int y) { return quantize1bit(gray, x, y); },
+                  [] {});
+     }},
+};
+
+// ---------------------------------------------------------------------------------------------------------------
+// Converters
+
+class MemoryPrint final : public Print {
+ public:
+  std::vector<uint8_t> data;
+  size_t write(const uint8_t b) override {
+    data.push_back(b);
+    return 1;
+  }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    data.insert(data.end(), buffer, buffer + size);
+    return size;
+  }
+};
+
+// The gray levels of a top-down BMP as written by ScaledBmpWriter (palette index = level)
+bool bmpLevels(const std::vector<uint8_t>& bmp, Levels& levels) {
+  const auto read32 = [&bmp](const size_t pos) {
+    return static_cast<int32_t>(bmp[pos] | bmp[pos + 1] << 8 | bmp[pos + 2] << 16 | bmp[pos + 3] << 24);
+  };
+  if (bmp.size() < 54 || bmp[0] != 'B' || bmp[1] != 'M') {
+    return false;
+  }
+  const int32_t dataOffset = read32(10);
+  levels.width = read32(18);
+  levels.height = -read32(22);
+  levels.bits = bmp[28];
+  const int rowBytes = (levels.width * levels.bits + 31) / 32 * 4;
+  if ((levels.bits != 1 && levels.bits != 2) || levels.width <= 0 || levels.height <= 0 ||
+      bmp.size() < static_cast<size_t>(dataOffset) + static_cast<size_t>(rowBytes) * levels.height) {
+    return false;
+  }
+  levels.values.clear();
+  for (int y = 0; y < levels.height; y++) {
+    const uint8_t* row = &bmp[dataOffset + y * rowBytes];
+    for (int x = 0; x < levels.width; x++) {
+      const int bit = x * levels.bits;
+      levels.values.push_back((row[bit / 8] >> (8 - levels.bits - bit % 8)) & ((1 << levels.bits) - 1));
+    }
+  }
+  return true;
+}
+
+const char* const kConverterOutputs[] = {"cover", "thumb400", "thumb226"};
+
+bool convert(const std::string& path, const bool png, MemoryPrint (&outs)[3]) {
+  FsFile file;
+  if (!file.open(path.c_str())) {
+    return false;
+  }
+  const BmpTarget targets[] = {BmpTarget::cover(outs[0], false), BmpTarget::thumbnail(outs[1], 400),
+                               BmpTarget::thumbnail(outs[2], 226)};
+  return png ? PngToBmpConverter::pngFileToBmpStreams(file, targets, 3)
+             : JpegToBmpConverter::jpegFileToBmpStreams(file, targets, 3);
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+
+struct Stats {
+  int passed = 0;
+  int failed = 0;
+};
+
+// Repeats fn until kMinTimedMs have passed, returns the time of one run in ms
+double timeRuns(const std::function<void()>& fn) {
+  int runs = 0;
+  const auto start = std::chrono::steady_clock::now();
+  std::chrono::duration<double, std::milli> elapsed{};
+  do {
+    fn();
+    runs++;
+    elapsed = std::chrono::steady_clock::now() - start;
+  } while (elapsed.count() < kMinTimedMs);
+  return elapsed.count() / runs;
+}
+
+// Compares an output with its golden image (or writes it), prints the result line
+void check(const std::string& goldenDir, const bool update, const std::string& name, const Levels& output,
+           const double inputPixels, const double ms, Stats& stats) {
+  const std::string goldenPath = goldenDir + "/" + name + ".png";
+  std::string result;
+  if (update) {
+    result = savePng(goldenPath, output) ? "updated" : "FAILED to write golden";
+  } else {
+    Levels golden;
+    if (!loadPng(goldenPath, golden)) {
+      result = "FAILED: no golden image";
+    } else if (golden.width != output.width || golden.height != output.height || golden.bits != output.bits) {
+      result = "FAILED: golden is " + std::to_string(golden.width) + "x" + std::to_string(golden.height) + " " +
+               std::to_string(golden.bits) + "-bit";
+    } else {
+      size_t differing = 0;
+      for (size_t i = 0; i < golden.values.size(); i++) differing += golden.values[i] != output.values[i];
+      result = differing == 0 ? "ok" : "FAILED: " + std::to_string(differing) + " pixels differ";
+    }
+  }
+  const bool ok = result.rfind("FAILED", 0) != 0;
+  (ok ? stats.passed : stats.failed)++;
+  const std::string size = std::to_string(output.width) + "x" + std::to_string(output.height);
+  printf("%-56s %-10s %9.2f %s\n", name.c_str(), size.c_str(), inputPixels / ms / 1000.0, result.c_str());
+}
+
+std::string baseName(const std::string& path) {
+  const std::string file = path.substr(path.find_last_of('/') + 1);
+  return file.substr(0, file.find_last_of('.'));
+}
+
+std::string extension(const std::string& path) {
+  const size_t dot = path.find_last_of('.');
+  return dot == std::string::npos ? "" : path.substr(dot + 1);
+}
+
+void runDitherers(const std::string& path, const std::string& goldenDir, const bool update, Stats& stats) {
+  GrayImage source;
+  if (!loadPgm(path, source)) {
+    printf("%-56s FAILED: not an 8-bit PGM file\n", baseName(path).c_str());
+    stats.failed++;
+    return;
+  }
+  const GrayImage image = fitScreen(source);
+  for (const auto& ditherer : kDitherers) {
+    Levels output{image.width, image.height, ditherer.bits, {}};
+    const double ms = timeRuns([&] { ditherer.run(image, output); });
+    check(goldenDir, update, baseName(path) + "_" + ditherer.name, output, image.pixels.size(), ms, stats);
+  }
+}
+
+void runConverter(const std::string& path, const std::string& goldenDir, const bool update, Stats& stats) {
+  const bool png = extension(path) == "png";
+  const std::vector<uint8_t> data = readFile(path);
+  ImageDimensionsParser parser;
+  parser.write(data.data(), data.size());
+  ImageDimensions dims{};
+  MemoryPrint outs[3];
+  const bool converted = parser.getDimensions(dims) && convert(path, png, outs);
+  const double ms = timeRuns([&] {
+    MemoryPrint runOuts[3];
+    convert(path, png, runOuts);
+  });
+  for (int i = 0; i < 3; i++) {
+    Levels output;
+    const std::string name = baseName(path) + "_" + (png ? "png_" : "jpeg_") + kConverterOutputs[i];
+    if (!converted || !bmpLevels(outs[i].data, output)) {
+      printf("%-56s FAILED: not converted\n", name.c_str());
+      stats.failed++;
+      continue;
+    }
+    // The speed is that of the whole conversion, which writes all three
+    check(goldenDir, update, name, output, static_cast<double>(dims.width) * dims.height, ms, stats);
+  }
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  int arg = 1;
+  const bool update = argc > arg && strcmp(argv[arg], "--update") == 0;
+  if (update) arg++;
+  if (argc - arg < 2) {
+    fprintf(stderr, "Usage: %s [--update] <golden directory> <image.pgm|image.jpg|image.png>...\n", argv[0]);
+    return 1;
+  }
+  const std::string goldenDir = argv[arg++];
+
+  printf("%-56s %-10s %9s %s\n", "output", "size", "MP/s", "result");
+  Stats stats;
+  std::vector<std::vector<uint8_t>> seen;  // EPUBs share some images, each is run once
+  for (; arg < argc; arg++) {
+    const std::string path = argv[arg];
+    std::vector<uint8_t> data = readFile(path);
+    if (std::find(seen.begin(), seen.end(), data) != seen.end()) {
+      continue;
+    }
+    seen.push_back(std::move(data));
+
+    const std::string type = extension(path);
+    if (type == "pgm") {
+      runDitherers(path, goldenDir, update, stats);
+    } else if (type == "jpg" || type == "jpeg" || type == "png") {
+      runConverter(path, goldenDir, update, stats);
+    } else {
+      fprintf(stderr, "Skipping %s, not a PGM, JPEG or PNG file\n", path.c_str());
+    }
+  }
+
+  printf("\n%d outputs %s, %d failed\n", stats.passed + stats.failed, update ? "written" : "match their golden image",
+         stats.failed);
+  if (!update && stats.failed == 0) {
+    printf("All outputs match their golden images\n");
+  }
+  return stats.failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,169 @@
+// Replays corpus text through FontDecompressor and reports how many compressed glyph groups each page inflates, and
+// the most decompressed group data the cache held at once.
+// Pages are drawn from the word frequency lists of the hyphenation test corpora, so frequent words show up as often
+// as they do in real text.
+
+#include <EpdFont.h>
+#include <FontDecompressor.h>
+#include <Utf8.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <builtinFonts/notosans_14_regular.h>
+#include <builtinFonts/opendyslexic_10_regular.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr int kPagesPerCorpus = 200;
+constexpr int kWordsPerPage = 250;
+// One word in kItalicEvery is set in italic and one in kBoldEvery in bold
+constexpr int kItalicEvery = 25;
+constexpr int kBoldEvery = 60;
+
+struct Corpus {
+  std::string name;
+  std::vector<std::string> words;
+  std::vector<double> frequencies;
+};
+
+struct ReplayFonts {
+  const char* name;
+  const EpdFontData* regular;
+  const EpdFontData* bold;
+  const EpdFontData* italic;
+};
+
+const ReplayFonts kFonts[] = {
+    {"bookerly_14", &bookerly_14_regular, &bookerly_14_bold, &bookerly_14_italic},
+    {"notosans_14", &notosans_14_regular, &notosans_14_regular, &notosans_14_regular},
+    {"opendyslexic_10", &opendyslexic_10_regular, &opendyslexic_10_regular, &opendyslexic_10_regular},
+};
+
+bool loadCorpus(const std::string& path, Corpus& corpus) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  const size_t slash = path.find_last_of('/');
+  corpus.name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+  corpus.name = corpus.name.substr(0, corpus.name.find('_'));
+
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const size_t first = line.find('|');
+    const size_t second = first == std::string::npos ? std::string::npos : line.find('|', first + 1);
+    corpus.words.push_back(line.substr(0, first));
+    corpus.frequencies.push_back(second == std::string::npos ? 1.0 : std::stod(line.substr(second + 1)));
+  }
+  return !corpus.words.empty();
+}
+
+uint32_t compressedSize(const EpdFontData* font) {
+  uint32_t size = 0;
+  for (uint16_t i = 0; i < font->groupCount; i++) {
+    size += font->groups[i].compressedSize;
+  }
+  return size;
+}
+
+void drawWord(FontDecompressor& decompressor, const EpdFont& font, const std::string& word) {
+  const auto* ptr = reinterpret_cast<const unsigned char*>(word.c_str());
+  uint32_t cp;
+  while ((cp = utf8NextCodepoint(&ptr))) {
+    const EpdGlyph* glyph = font.getGlyph(cp);
+    if (glyph && glyph->dataLength > 0) {
+      decompressor.getBitmap(font.data, glyph, static_cast<uint16_t>(glyph - font.data->glyph));
+    }
+  }
+}
+
+// Cold: the cache is cleared before every page, i.e. the inflates needed to draw one page from scratch.
+// Warm: the cache persists across pages, as in the reader.
+void replay(const ReplayFonts& fonts, const Corpus& corpus) {
+  const EpdFont regular(fonts.regular);
+  const EpdFont bold(fonts.bold);
+  const EpdFont italic(fonts.italic);
+
+  FontDecompressor decompressor;
+  decompressor.init();
+  std::mt19937 rng(1);
+  std::discrete_distribution<size_t> pick(corpus.frequencies.begin(), corpus.frequencies.end());
+
+  uint32_t coldInflates = 0;
+  uint32_t warmInflates = 0;
+  uint32_t inflateMicros = 0;
+  uint32_t peakCachedBytes = 0;
+  for (const bool clearPerPage : {true, false}) {
+    rng.seed(1);
+    decompressor.clearCache();
+    decompressor.resetStats();
+    for (int page = 0; page < kPagesPerCorpus; page++) {
+      if (clearPerPage) {
+        decompressor.clearCache();
+      }
+      for (int i = 0; i < kWordsPerPage; i++) {
+        std::string word = corpus.words[pick(rng)];
+        if (i % 12 == 11) {
+          word += ",";
+        } else if (i % 15 == 14) {
+          word += ".";
+        }
+        const EpdFont& font = i % kItalicEvery == 0 ? italic : i % kBoldEvery == 0 ? bold : regular;
+        drawWord(decompressor, font, word);
+        peakCachedBytes = std::max(peakCachedBytes, decompressor.getCachedBytes());
+      }
+    }
+    if (clearPerPage) {
+      coldInflates = decompressor.getStats().misses;
+      inflateMicros = decompressor.getStats().inflateMicros;
+    } else {
+      warmInflates = decompressor.getStats().misses;
+    }
+  }
+  decompressor.deinit();
+
+  printf("%-16s %-8s %8.2f %8.2f %10.1f %8u\n", fonts.name, corpus.name.c_str(),
+         static_cast<double>(coldInflates) / kPagesPerCorpus, static_cast<double>(warmInflates) / kPagesPerCorpus,
+         static_cast<double>(inflateMicros) / kPagesPerCorpus / 1000.0, peakCachedBytes / 1024);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <corpus.txt>...\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<Corpus> corpora;
+  for (int i = 1; i < argc; i++) {
+    Corpus corpus;
+    if (!loadCorpus(argv[i], corpus)) {
+      fprintf(stderr, "Could not read corpus %s\n", argv[i]);
+      return 1;
+    }
+    corpora.push_back(std::move(corpus));
+  }
+
+  printf("%-16s %-8s %8s %8s %10s %8s\n", "font", "corpus", "cold/pg", "warm/pg", "inflate ms", "peak KB");
+  for (const auto& fonts : kFonts) {
+    for (const auto& corpus : corpora) {
+      replay(fonts, corpus);
+    }
+  }
+
+  printf("\nCompressed size:");
+  for (const auto& fonts : kFonts) {
+    printf(" %s %u", fonts.name, compressedSize(fonts.regular));
+  }
+  printf("\n");
+  return 0;
+}
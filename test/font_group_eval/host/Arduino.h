@@ -0,0 +1,30 @@
+#pragma once
+// Minimal Arduino API for building font code on the host
+
+#include <HardwareSerial.h>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+inline unsigned long millis() {
+  return static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                        std::chrono::steady_clock::now().time_since_epoch())
+                                        .count());
+}
+
+inline unsigned long micros() {
+  return static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                        std::chrono::steady_clock::now().time_since_epoch())
+                                        .count());
+}
+
+struct EspClass {
+  // Enough for the largest font cache
+  uint32_t getFreeHeap() const { return 200000; }
+};
+inline EspClass ESP;
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <Print.h>
+
+class HWCDC {
+ public:
+  void begin(unsigned long) {}
+  operator bool() const { return false; }
+};
+inline HWCDC Serial;
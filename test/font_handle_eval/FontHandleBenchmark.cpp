@@ -0,0 +1,180 @@
+// Measures corpus words with a FontHandle, the way chapter layout does, and with GfxRenderer::getTextAdvanceX for
+// every style of every builtin font family, and checks that both give the same width for every word. Each language
+// contributes 5000 corpus words in three forms: as they are, capitalized, and in curly quotes followed by a comma, so
+// the General Punctuation part of the advance tables is measured too. Also reports how long measuring a word takes
+// either way.
+
+#include <GfxRenderer.h>
+#include <builtinFonts/all.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr size_t kWordsPerCorpus = 5000;
+constexpr int kTimedRuns = 3;
+constexpr int kFontId = 1;
+
+// UNDERLINE only changes drawing, a handle must measure it like the style without it
+const EpdFontFamily::Style kStyles[] = {
+    EpdFontFamily::REGULAR, EpdFontFamily::BOLD, EpdFontFamily::ITALIC, EpdFontFamily::BOLD_ITALIC,
+    static_cast<EpdFontFamily::Style>(EpdFontFamily::BOLD | EpdFontFamily::UNDERLINE)};
+
+struct TestFamily {
+  const char* name;
+  const EpdFontData* styles[4];  // Regular, bold, italic, bold italic; missing styles fall back like main.cpp
+};
+
+const TestFamily kFamilies[] = {
+    {"bookerly_12", {&bookerly_12_regular, &bookerly_12_bold, &bookerly_12_italic, &bookerly_12_bolditalic}},
+    {"bookerly_14", {&bookerly_14_regular, &bookerly_14_bold, &bookerly_14_italic, &bookerly_14_bolditalic}},
+    {"bookerly_16", {&bookerly_16_regular, &bookerly_16_bold, &bookerly_16_italic, &bookerly_16_bolditalic}},
+    {"bookerly_18", {&bookerly_18_regular, &bookerly_18_bold, &bookerly_18_italic, &bookerly_18_bolditalic}},
+    {"notosans_12", {&notosans_12_regular, &notosans_12_bold, &notosans_12_italic, &notosans_12_bolditalic}},
+    {"notosans_14", {&notosans_14_regular, &notosans_14_bold, &notosans_14_italic, &notosans_14_bolditalic}},
+    {"notosans_16", {&notosans_16_regular, &notosans_16_bold, &notosans_16_italic, &notosans_16_bolditalic}},
+    {"notosans_18", {&notosans_18_regular, &notosans_18_bold, &notosans_18_italic, &notosans_18_bolditalic}},
+    {"opendyslexic_8",
+     {&opendyslexic_8_regular, &opendyslexic_8_bold, &opendyslexic_8_italic, &opendyslexic_8_bolditalic}},
+    {"opendyslexic_10",
+     {&opendyslexic_10_regular, &opendyslexic_10_bold, &opendyslexic_10_italic, &opendyslexic_10_bolditalic}},
+    {"opendyslexic_12",
+     {&opendyslexic_12_regular, &opendyslexic_12_bold, &opendyslexic_12_italic, &opendyslexic_12_bolditalic}},
+    {"opendyslexic_14",
+     {&opendyslexic_14_regular, &opendyslexic_14_bold, &opendyslexic_14_italic, &opendyslexic_14_bolditalic}},
+    {"notosans_8", {&notosans_8_regular, nullptr, nullptr, nullptr}},
+    {"ubuntu_10", {&ubuntu_10_regular, &ubuntu_10_bold, nullptr, nullptr}},
+    {"ubuntu_12", {&ubuntu_12_regular, &ubuntu_12_bold, nullptr, nullptr}},
+};
+
+HalDisplay display;
+GfxRenderer renderer(display);
+
+struct Corpus {
+  std::string name;
+  std::vector<std::string> words;
+};
+
+bool loadCorpus(const std::string& path, Corpus& corpus) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  const size_t slash = path.find_last_of('/');
+  corpus.name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+  corpus.name = corpus.name.substr(0, corpus.name.find('_'));
+
+  std::vector<std::string> words;
+  std::string line;
+  while (words.size() < kWordsPerCorpus && std::getline(file, line)) {
+    if (!line.empty() && line[0] != '#') {
+      words.push_back(line.substr(0, line.find('|')));
+    }
+  }
+  for (const auto& word : words) {
+    corpus.words.push_back(word);
+    std::string capitalized = word;
+    if (!capitalized.empty() && capitalized[0] >= 'a' && capitalized[0] <= 'z') {
+      capitalized[0] = static_cast<char>(capitalized[0] - 'a' + 'A');
+    }
+    corpus.words.push_back(capitalized);
+    corpus.words.push_back("“" + word + "”,");
+  }
+  return !words.empty();
+}
+
+struct Timing {
+  double rendererNs = 0;
+  double handleNs = 0;
+  size_t words = 0;
+};
+
+// Nanoseconds spent measuring all words once, the fastest of several runs
+template <typename Measure>
+double timeWords(const std::vector<std::string>& words, const Measure& measure, long long& checksum) {
+  double fastest = 0;
+  for (int run = 0; run < kTimedRuns; run++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& word : words) {
+      checksum += measure(word.c_str());
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    fastest = run == 0 ? ns : std::min(fastest, ns);
+  }
+  return fastest;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <hyphenation test file>...\n", argv[0]);
+    return 1;
+  }
+  std::vector<Corpus> corpora(argc - 1);
+  for (int i = 1; i < argc; i++) {
+    if (!loadCorpus(argv[i], corpora[i - 1])) {
+      fprintf(stderr, "Could not read %s\n", argv[i]);
+      return 1;
+    }
+  }
+  renderer.begin();
+
+  std::vector<Timing> corpusTimings(corpora.size());
+  long long checksum = 0;
+  int failures = 0;
+  printf("%-16s %8s %8s %12s %10s %8s\n", "family", "words", "differ", "renderer ns", "handle ns", "speedup");
+  for (const auto& testFamily : kFamilies) {
+    const EpdFont regular(testFamily.styles[0]);
+    const EpdFont bold(testFamily.styles[1] ? testFamily.styles[1] : testFamily.styles[0]);
+    const EpdFont italic(testFamily.styles[2] ? testFamily.styles[2] : testFamily.styles[0]);
+    const EpdFont boldItalic(testFamily.styles[3] ? testFamily.styles[3] : testFamily.styles[0]);
+    const EpdFontFamily family(&regular, testFamily.styles[1] ? &bold : nullptr,
+                               testFamily.styles[2] ? &italic : nullptr, testFamily.styles[3] ? &boldItalic : nullptr);
+    renderer.insertFont(kFontId, family);
+    const FontHandle handle = renderer.getFontHandle(kFontId);
+
+    Timing familyTiming;
+    int differing = 0;
+    for (size_t c = 0; c < corpora.size(); c++) {
+      const auto& words = corpora[c].words;
+      for (const auto style : kStyles) {
+        for (const auto& word : words) {
+          differing += handle.getTextAdvanceX(word.c_str(), style) !=
+                       renderer.getTextAdvanceX(kFontId, word.c_str(), style);
+        }
+        const double rendererNs = timeWords(
+            words, [style](const char* word) { return renderer.getTextAdvanceX(kFontId, word, style); }, checksum);
+        const double handleNs =
+            timeWords(words, [&handle, style](const char* word) { return handle.getTextAdvanceX(word, style); },
+                      checksum);
+        for (Timing* timing : {&familyTiming, &corpusTimings[c]}) {
+          timing->rendererNs += rendererNs;
+          timing->handleNs += handleNs;
+          timing->words += words.size();
+        }
+      }
+    }
+    renderer.removeFont(kFontId);
+
+    failures += differing != 0;
+    printf("%-16s %8zu %8d %12.1f %10.1f %7.2fx\n", testFamily.name, familyTiming.words, differing,
+           familyTiming.rendererNs / familyTiming.words, familyTiming.handleNs / familyTiming.words,
+           familyTiming.rendererNs / familyTiming.handleNs);
+  }
+
+  printf("\n%-16s %8s %21s %10s %8s\n", "corpus", "words", "renderer ns", "handle ns", "speedup");
+  for (size_t c = 0; c < corpora.size(); c++) {
+    const Timing& timing = corpusTimings[c];
+    printf("%-16s %8zu %21.1f %10.1f %7.2fx\n", corpora[c].name.c_str(), timing.words,
+           timing.rendererNs / timing.words, timing.handleNs / timing.words, timing.rendererNs / timing.handleNs);
+  }
+  printf("\n(checksum %lld)\n", checksum);
+
+  printf("%s\n", failures == 0 ? "FontHandle widths match GfxRenderer::getTextAdvanceX for every word and style"
+                               : "FAILED: FontHandle widths differ from GfxRenderer::getTextAdvanceX");
+  return failures == 0 ? 0 : 1;
+}
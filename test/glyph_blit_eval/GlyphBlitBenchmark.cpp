@@ -0,0 +1,355 @@
+// Renders dense pages of corpus text with GfxRenderer::drawText and checks that the frame buffer comes out byte for
+// byte the same as drawing every glyph pixel with drawPixel, the way renderChar did before it blitted packed runs.
+// Every page is drawn in every orientation and render mode, with 2-bit compressed and 1-bit fonts, black and white
+// text, and lines that run past every edge of the screen. Some words are underlined, struck through or shaded with
+// drawLine and fillRectDither, which must write both gray planes the same way in GRAYSCALE_BOTH as in two passes.
+// Also reports how long drawing a page takes on either path.
+
+#include <EpdGlyphRuns.h>
+#include <FontDecompressor.h>
+#include <GfxRenderer.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <builtinFonts/notosans_16_regular.h>
+#include <builtinFonts/ubuntu_12_bold.h>
+#include <builtinFonts/ubuntu_12_regular.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr int kPagesPerCorpus = 4;
+// Lines start this far left of the screen and run this far past its right edge, the first line starts above the top
+constexpr int kOverhang = 9;
+// One word in kBoldEvery is set in bold, one in kItalicEvery in italic and one in kWhiteEvery in white
+constexpr int kBoldEvery = 23;
+constexpr int kItalicEvery = 17;
+constexpr int kWhiteEvery = 31;
+// One word in kUnderlineEvery is underlined, one in kStrikeEvery struck through and one in kShadeEvery shaded
+constexpr int kUnderlineEvery = 7;
+constexpr int kStrikeEvery = 19;
+constexpr int kShadeEvery = 29;
+
+const GfxRenderer::Orientation kOrientations[] = {GfxRenderer::Portrait, GfxRenderer::LandscapeClockwise,
+                                                  GfxRenderer::PortraitInverted,
+                                                  GfxRenderer::LandscapeCounterClockwise};
+const char* const kOrientationNames[] = {"portrait", "landscape cw", "portrait inverted", "landscape ccw"};
+
+const GfxRenderer::RenderMode kModes[] = {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB, GfxRenderer::GRAYSCALE_MSB,
+                                          GfxRenderer::GRAYSCALE_BOTH};
+const char* const kModeNames[] = {"BW", "LSB", "MSB", "both"};
+
+struct TestFont {
+  const char* name;
+  const EpdFontData* regular;
+  const EpdFontData* bold;
+  const EpdFontData* italic;
+};
+
+const TestFont kFonts[] = {
+    {"bookerly_14", &bookerly_14_regular, &bookerly_14_bold, &bookerly_14_italic},
+    {"notosans_16", &notosans_16_regular, &notosans_16_regular, &notosans_16_regular},
+    {"ubuntu_12", &ubuntu_12_regular, &ubuntu_12_bold, &ubuntu_12_regular},
+};
+
+constexpr int kFontId = 1;
+
+HalDisplay display;
+GfxRenderer renderer(display);
+FontDecompressor decompressor;
+
+struct Corpus {
+  std::string name;
+  std::vector<std::string> words;
+  std::vector<double> frequencies;
+};
+
+bool loadCorpus(const std::string& path, Corpus& corpus) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  const size_t slash = path.find_last_of('/');
+  corpus.name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+  corpus.name = corpus.name.substr(0, corpus.name.find('_'));
+
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const size_t first = line.find('|');
+    const size_t second = first == std::string::npos ? std::string::npos : line.find('|', first + 1);
+    corpus.words.push_back(line.substr(0, first));
+    corpus.frequencies.push_back(second == std::string::npos ? 1.0 : std::stod(line.substr(second + 1)));
+  }
+  return !corpus.words.empty();
+}
+
+struct Word {
+  std::string text;
+  EpdFontFamily::Style style;
+  bool black;
+};
+
+// Same lookup as GfxRenderer::getGlyphBitmap
+const uint8_t* glyphBitmap(const EpdFontData* data, const EpdGlyph* glyph) {
+  if (data->bitmapSource) {
+    return data->bitmapSource->getBitmap(glyph);
+  }
+  if (data->groups) {
+    return decompressor.getBitmap(data, glyph, static_cast<uint16_t>(glyph - data->glyph));
+  }
+  return &data->bitmap[glyph->dataOffset];
+}
+
+// renderChar before it blitted packed runs: every glyph pixel through drawPixel, which clips it
+void drawGlyphPerPixel(const EpdFontData* data, const EpdGlyph* glyph, const int x, const int y,
+                       const bool pixelState) {
+  const uint8_t* bitmap = glyphBitmap(data, glyph);
+  if (bitmap == nullptr) {
+    return;
+  }
+  const GfxRenderer::RenderMode mode = renderer.getRenderMode();
+  EpdGlyphRuns runs(bitmap, glyph->dataLength);
+  uint8_t runValue = 0;
+  int runLeft = 0;
+  for (int glyphY = 0; glyphY < glyph->height; glyphY++) {
+    const int screenY = y - glyph->top + glyphY;
+    for (int glyphX = 0; glyphX < glyph->width; glyphX++) {
+      const int pixelPosition = glyphY * glyph->width + glyphX;
+      const int screenX = x + glyph->left + glyphX;
+      uint8_t value;
+      if (data->rleBitmaps) {
+        if (runLeft == 0) {
+          runs.next(&runValue, &runLeft);
+        }
+        runLeft--;
+        value = runValue;
+      } else if (data->is2Bit) {
+        value = (bitmap[pixelPosition / 4] >> ((3 - pixelPosition % 4) * 2)) & 0x3;
+      } else {
+        value = (bitmap[pixelPosition / 8] >> (7 - pixelPosition % 8)) & 0x1;
+      }
+
+      if (data->is2Bit) {
+        // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
+        const uint8_t bmpVal = 3 - value;
+        if (mode == GfxRenderer::BW && bmpVal < 3) {
+          renderer.drawPixel(screenX, screenY, pixelState);
+        } else if (mode == GfxRenderer::GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
+          renderer.drawPixel(screenX, screenY, false);
+        } else if (mode == GfxRenderer::GRAYSCALE_LSB && bmpVal == 1) {
+          renderer.drawPixel(screenX, screenY, false);
+        }
+      } else if (value) {
+        renderer.drawPixel(screenX, screenY, pixelState);
+      }
+    }
+  }
+}
+
+// drawText with drawGlyphPerPixel, placing glyphs the same way (ligatures and kerning included)
+void drawTextPerPixel(const EpdFontFamily& family, const int x, const int y, const Word& word) {
+  const EpdFont& font = *family.getFont(word.style);
+  const int yPos = y + renderer.getFontAscenderSize(kFontId);
+  int xPos = x;
+  const auto* text = reinterpret_cast<const unsigned char*>(word.text.c_str());
+  const EpdGlyph* previous = nullptr;
+  uint32_t cp;
+  while ((cp = font.nextCodepoint(&text))) {
+    const EpdGlyph* glyph = font.getGlyph(cp);
+    if (!glyph) {
+      glyph = font.getGlyph(REPLACEMENT_GLYPH);
+    }
+    if (!glyph) {
+      continue;
+    }
+    xPos += font.getKerning(previous, glyph);
+    previous = glyph;
+    if (glyph->width > 0 && glyph->height > 0) {
+      drawGlyphPerPixel(font.data, glyph, xPos, yPos, word.black);
+    }
+    xPos += glyph->advanceX;
+  }
+}
+
+using DrawWord = std::function<void(int x, int y, const Word& word)>;
+
+// Fills the screen in the current orientation, lines overhang every edge so glyphs are clipped on all sides
+void drawPage(const std::vector<Word>& words, const DrawWord& drawWord) {
+  const int lineHeight = renderer.getLineHeight(kFontId);
+  const int spaceWidth = renderer.getSpaceWidth(kFontId);
+  const int screenWidth = renderer.getScreenWidth();
+  const int screenHeight = renderer.getScreenHeight();
+  int x = -kOverhang;
+  int y = -kOverhang;
+  for (size_t i = 0; y < screenHeight; i = (i + 1) % words.size()) {
+    const Word& word = words[i];
+    const int advance = renderer.getTextAdvanceX(kFontId, word.text.c_str(), word.style);
+    if (i % kShadeEvery == kShadeEvery - 1) {
+      renderer.fillRectDither(x, y, advance, lineHeight, i % 2 ? Color::LightGray : Color::DarkGray);
+    }
+    drawWord(x, y, word);
+    if (i % kUnderlineEvery == kUnderlineEvery - 1) {
+      // Like TextBlock, just below the baseline where it crosses the descenders
+      const int underlineY = y + renderer.getFontAscenderSize(kFontId) + 2;
+      renderer.drawLine(x, underlineY, x + advance - 1, underlineY, word.black);
+    }
+    if (i % kStrikeEvery == kStrikeEvery - 1) {
+      renderer.drawLine(x, y + lineHeight - 1, x + advance - 1, y, word.black);
+      renderer.drawLine(x + advance - 1, y, x + advance - 1, y + lineHeight - 1, !word.black);
+    }
+    x += advance + spaceWidth;
+    if (x > screenWidth + kOverhang) {
+      x = -kOverhang;
+      y += lineHeight;
+    }
+  }
+}
+
+struct Planes {
+  std::vector<uint8_t> frame;
+  std::vector<uint8_t> msb;  // GRAYSCALE_BOTH only
+};
+
+// Draws in one render mode onto a cleared screen. GRAYSCALE_BOTH goes through renderGrayscale, the per-pixel path
+// has no such mode and draws the LSB and MSB planes one after the other instead.
+Planes renderPlanes(const GfxRenderer::RenderMode mode, const std::function<void()>& draw) {
+  Planes planes;
+  if (mode == GfxRenderer::GRAYSCALE_BOTH) {
+    renderer.renderGrayscale(draw);
+    planes.frame.assign(display.getGrayLsb(), display.getGrayLsb() + HalDisplay::BUFFER_SIZE);
+    planes.msb.assign(display.getGrayMsb(), display.getGrayMsb() + HalDisplay::BUFFER_SIZE);
+    return planes;
+  }
+  renderer.setRenderMode(mode);
+  renderer.clearScreen(mode == GfxRenderer::BW ? 0xFF : 0x00);
+  draw();
+  planes.frame.assign(renderer.getFrameBuffer(), renderer.getFrameBuffer() + HalDisplay::BUFFER_SIZE);
+  renderer.setRenderMode(GfxRenderer::BW);
+  return planes;
+}
+
+Planes renderPlanesPerPixel(const GfxRenderer::RenderMode mode, const std::function<void()>& draw) {
+  if (mode != GfxRenderer::GRAYSCALE_BOTH) {
+    return renderPlanes(mode, draw);
+  }
+  Planes planes;
+  planes.frame = renderPlanes(GfxRenderer::GRAYSCALE_LSB, draw).frame;
+  planes.msb = renderPlanes(GfxRenderer::GRAYSCALE_MSB, draw).frame;
+  return planes;
+}
+
+struct Timing {
+  double blitMs = 0;
+  double perPixelMs = 0;
+};
+
+// Times a draw, adding the milliseconds it took to `total`
+std::function<void()> timed(const std::function<void()>& draw, double& total) {
+  return [&draw, &total]() {
+    const auto start = std::chrono::steady_clock::now();
+    draw();
+    total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  };
+}
+
+// Compares every orientation and render mode of one page, adding up the time each path spent drawing
+int comparePage(const EpdFontFamily& family, const std::vector<Word>& words, Timing& timing) {
+  const std::function<void()> blit = [&]() {
+    drawPage(words, [](const int x, const int y, const Word& word) {
+      renderer.drawText(kFontId, x, y, word.text.c_str(), word.black, word.style);
+    });
+  };
+  const std::function<void()> perPixel = [&]() {
+    drawPage(words, [&family](const int x, const int y, const Word& word) { drawTextPerPixel(family, x, y, word); });
+  };
+
+  int failures = 0;
+  for (size_t o = 0; o < std::size(kOrientations); o++) {
+    renderer.setOrientation(kOrientations[o]);
+    for (size_t m = 0; m < std::size(kModes); m++) {
+      const Planes actual = renderPlanes(kModes[m], timed(blit, timing.blitMs));
+      const Planes expected = renderPlanesPerPixel(kModes[m], timed(perPixel, timing.perPixelMs));
+      if (actual.frame != expected.frame || actual.msb != expected.msb) {
+        fprintf(stderr, "  differs in %s, %s\n", kOrientationNames[o], kModeNames[m]);
+        failures++;
+      }
+    }
+  }
+  renderer.setOrientation(GfxRenderer::Portrait);
+  return failures;
+}
+
+bool run(const TestFont& testFont, const Corpus& corpus) {
+  const EpdFont regular(testFont.regular);
+  const EpdFont bold(testFont.bold);
+  const EpdFont italic(testFont.italic);
+  const EpdFontFamily family(&regular, &bold, &italic);
+  renderer.insertFont(kFontId, family);
+
+  std::mt19937 rng(1);
+  std::discrete_distribution<size_t> pick(corpus.frequencies.begin(), corpus.frequencies.end());
+  Timing timing;
+  int failures = 0;
+  for (int page = 0; page < kPagesPerCorpus; page++) {
+    // More words than fit a page, the page wraps around them if not
+    std::vector<Word> words;
+    for (int i = 1; i <= 400; i++) {
+      const EpdFontFamily::Style style = i % kBoldEvery == 0     ? EpdFontFamily::BOLD
+                                         : i % kItalicEvery == 0 ? EpdFontFamily::ITALIC
+                                                                 : EpdFontFamily::REGULAR;
+      words.push_back({corpus.words[pick(rng)] + (i % 12 == 11 ? "," : i % 15 == 14 ? "." : ""), style,
+                       i % kWhiteEvery != 0});
+    }
+    failures += comparePage(family, words, timing);
+  }
+  renderer.removeFont(kFontId);
+
+  const int renders = kPagesPerCorpus * static_cast<int>(std::size(kOrientations) * std::size(kModes));
+  printf("%-12s %-8s %8d %10.2f %10.2f %7.2fx\n", testFont.name, corpus.name.c_str(), failures,
+         timing.blitMs / renders, timing.perPixelMs / renders, timing.perPixelMs / timing.blitMs);
+  return failures == 0;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <corpus.txt>...\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<Corpus> corpora;
+  for (int i = 1; i < argc; i++) {
+    Corpus corpus;
+    if (!loadCorpus(argv[i], corpus)) {
+      fprintf(stderr, "Could not read corpus %s\n", argv[i]);
+      return 1;
+    }
+    corpora.push_back(std::move(corpus));
+  }
+
+  renderer.begin();
+  decompressor.init();
+  renderer.setFontDecompressor(&decompressor);
+
+  printf("%-12s %-8s %8s %10s %10s %8s\n", "font", "corpus", "differ", "blit ms", "pixel ms", "speedup");
+  bool passed = true;
+  for (const auto& font : kFonts) {
+    for (const auto& corpus : corpora) {
+      passed = run(font, corpus) && passed;
+    }
+  }
+  decompressor.deinit();
+
+  printf("\n%s\n", passed ? "All pages match the per-pixel path" : "FAILED: blitted glyphs differ from drawPixel");
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,238 @@
+// Compares the three ways fontconvert.py stores glyph bitmaps: uncompressed, run-length encoded (--rle, drawn straight
+// from flash by renderGlyphRuns) and DEFLATE compressed in frequency groups (--compress, inflated by
+// FontDecompressor). run_glyph_encoding_eval.sh generates each test font in all three encodings.
+//
+// Pages of corpus text are drawn with every encoding in every orientation and render mode, and the run-length and
+// DEFLATE pages are checked byte for byte against the uncompressed ones. Reports the flash size of the bitmaps, the
+// RAM each encoding needs to draw, and how long drawing a page takes.
+
+#include <FontDecompressor.h>
+#include <GfxRenderer.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bookerly_14_regular_compressed.h"
+#include "bookerly_14_regular_rle.h"
+#include "bookerly_14_regular_uncompressed.h"
+#include "notosans_14_regular_compressed.h"
+#include "notosans_14_regular_rle.h"
+#include "notosans_14_regular_uncompressed.h"
+#include "ubuntu_12_regular_compressed.h"
+#include "ubuntu_12_regular_rle.h"
+#include "ubuntu_12_regular_uncompressed.h"
+
+namespace {
+constexpr int kPagesPerCorpus = 3;
+constexpr int kFontId = 1;
+
+const GfxRenderer::Orientation kOrientations[] = {GfxRenderer::Portrait, GfxRenderer::LandscapeClockwise,
+                                                  GfxRenderer::PortraitInverted,
+                                                  GfxRenderer::LandscapeCounterClockwise};
+const char* const kOrientationNames[] = {"portrait", "landscape cw", "portrait inverted", "landscape ccw"};
+
+const GfxRenderer::RenderMode kModes[] = {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB, GfxRenderer::GRAYSCALE_MSB,
+                                          GfxRenderer::GRAYSCALE_BOTH};
+const char* const kModeNames[] = {"BW", "LSB", "MSB", "both"};
+
+enum Encoding { Uncompressed, RunLength, Deflate, EncodingCount };
+const char* const kEncodingNames[] = {"uncompressed", "run-length", "deflate"};
+
+struct TestFont {
+  const char* name;
+  const EpdFontData* encodings[EncodingCount];
+};
+
+const TestFont kFonts[] = {
+    {"bookerly_14", {&bookerly_14_regular_uncompressed, &bookerly_14_regular_rle, &bookerly_14_regular_compressed}},
+    {"notosans_14", {&notosans_14_regular_uncompressed, &notosans_14_regular_rle, &notosans_14_regular_compressed}},
+    {"ubuntu_12", {&ubuntu_12_regular_uncompressed, &ubuntu_12_regular_rle, &ubuntu_12_regular_compressed}},
+};
+
+HalDisplay display;
+GfxRenderer renderer(display);
+FontDecompressor decompressor;
+
+struct Corpus {
+  std::string name;
+  std::vector<std::string> words;
+  std::vector<double> frequencies;
+};
+
+bool loadCorpus(const std::string& path, Corpus& corpus) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  const size_t slash = path.find_last_of('/');
+  corpus.name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+  corpus.name = corpus.name.substr(0, corpus.name.find('_'));
+
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const size_t first = line.find('|');
+    const size_t second = first == std::string::npos ? std::string::npos : line.find('|', first + 1);
+    corpus.words.push_back(line.substr(0, first));
+    corpus.frequencies.push_back(second == std::string::npos ? 1.0 : std::stod(line.substr(second + 1)));
+  }
+  return !corpus.words.empty();
+}
+
+struct Sizes {
+  uint32_t flash = 0;  // Bitmaps and the tables that only exist to find them
+  uint32_t ram = 0;    // Buffer needed while drawing
+};
+
+Sizes encodingSizes(const EpdFontData* data) {
+  const uint32_t glyphCount = data->intervals[data->intervalCount - 1].offset +
+                              (data->intervals[data->intervalCount - 1].last -
+                               data->intervals[data->intervalCount - 1].first + 1);
+  Sizes sizes;
+  if (data->groups) {
+    for (uint16_t i = 0; i < data->groupCount; i++) {
+      sizes.flash += data->groups[i].compressedSize;
+      sizes.ram = std::max(sizes.ram, data->groups[i].uncompressedSize);
+    }
+    sizes.flash += data->groupCount * sizeof(EpdFontGroup) + glyphCount;  // Groups and glyphGroups
+    return sizes;
+  }
+  for (uint32_t i = 0; i < glyphCount; i++) {
+    sizes.flash = std::max(sizes.flash, data->glyph[i].dataOffset + data->glyph[i].dataLength);
+  }
+  return sizes;
+}
+
+// Lays words out over the whole screen in the current orientation
+void drawPage(const std::vector<std::string>& words) {
+  const int lineHeight = renderer.getLineHeight(kFontId);
+  const int spaceWidth = renderer.getSpaceWidth(kFontId);
+  const int screenWidth = renderer.getScreenWidth();
+  const int screenHeight = renderer.getScreenHeight();
+  int x = 0;
+  int y = 0;
+  for (size_t i = 0; y < screenHeight; i = (i + 1) % words.size()) {
+    const int width = renderer.getTextAdvanceX(kFontId, words[i].c_str(), EpdFontFamily::REGULAR);
+    if (x > 0 && x + width > screenWidth) {
+      x = 0;
+      y += lineHeight;
+    }
+    renderer.drawText(kFontId, x, y, words[i].c_str());
+    x += width + spaceWidth;
+  }
+}
+
+struct Planes {
+  std::vector<uint8_t> frame;
+  std::vector<uint8_t> msb;  // GRAYSCALE_BOTH only
+};
+
+Planes renderPlanes(const GfxRenderer::RenderMode mode, const std::function<void()>& draw) {
+  Planes planes;
+  if (mode == GfxRenderer::GRAYSCALE_BOTH) {
+    renderer.renderGrayscale(draw);
+    planes.frame.assign(display.getGrayLsb(), display.getGrayLsb() + HalDisplay::BUFFER_SIZE);
+    planes.msb.assign(display.getGrayMsb(), display.getGrayMsb() + HalDisplay::BUFFER_SIZE);
+    return planes;
+  }
+  renderer.setRenderMode(mode);
+  renderer.clearScreen(mode == GfxRenderer::BW ? 0xFF : 0x00);
+  draw();
+  planes.frame.assign(renderer.getFrameBuffer(), renderer.getFrameBuffer() + HalDisplay::BUFFER_SIZE);
+  renderer.setRenderMode(GfxRenderer::BW);
+  return planes;
+}
+
+struct Result {
+  int failures[EncodingCount] = {};
+  double ms[EncodingCount] = {};
+  int renders = 0;
+};
+
+// Draws one page in every orientation and render mode with each encoding of the font
+void comparePage(const TestFont& testFont, const std::vector<std::string>& words, Result& result) {
+  for (size_t o = 0; o < std::size(kOrientations); o++) {
+    renderer.setOrientation(kOrientations[o]);
+    for (size_t m = 0; m < std::size(kModes); m++) {
+      Planes expected;
+      for (int e = 0; e < EncodingCount; e++) {
+        const EpdFont font(testFont.encodings[e]);
+        const EpdFontFamily family(&font);
+        renderer.insertFont(kFontId, family);
+        const auto start = std::chrono::steady_clock::now();
+        const Planes planes = renderPlanes(kModes[m], [&words] { drawPage(words); });
+        result.ms[e] += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        renderer.removeFont(kFontId);
+
+        if (e == Uncompressed) {
+          expected = planes;
+        } else if (planes.frame != expected.frame || planes.msb != expected.msb) {
+          fprintf(stderr, "  %s %s differs from uncompressed in %s, %s\n", testFont.name, kEncodingNames[e],
+                  kOrientationNames[o], kModeNames[m]);
+          result.failures[e]++;
+        }
+      }
+      result.renders++;
+    }
+  }
+  renderer.setOrientation(GfxRenderer::Portrait);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <corpus.txt>...\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<Corpus> corpora;
+  for (int i = 1; i < argc; i++) {
+    Corpus corpus;
+    if (!loadCorpus(argv[i], corpus)) {
+      fprintf(stderr, "Could not read corpus %s\n", argv[i]);
+      return 1;
+    }
+    corpora.push_back(std::move(corpus));
+  }
+
+  renderer.begin();
+  decompressor.init();
+  renderer.setFontDecompressor(&decompressor);
+
+  printf("%-12s %-13s %9s %7s %9s %8s %10s\n", "font", "encoding", "flash B", "flash", "RAM B", "differ", "page ms");
+  bool passed = true;
+  for (const auto& testFont : kFonts) {
+    Result result;
+    for (const auto& corpus : corpora) {
+      std::mt19937 rng(1);
+      std::discrete_distribution<size_t> pick(corpus.frequencies.begin(), corpus.frequencies.end());
+      for (int page = 0; page < kPagesPerCorpus; page++) {
+        std::vector<std::string> words;
+        for (int i = 0; i < 400; i++) {
+          words.push_back(corpus.words[pick(rng)]);
+        }
+        comparePage(testFont, words, result);
+      }
+    }
+
+    const uint32_t uncompressedFlash = encodingSizes(testFont.encodings[Uncompressed]).flash;
+    for (int e = 0; e < EncodingCount; e++) {
+      const Sizes sizes = encodingSizes(testFont.encodings[e]);
+      printf("%-12s %-13s %9u %6.1f%% %9u %8d %10.2f\n", testFont.name, kEncodingNames[e], sizes.flash,
+             100.0 * sizes.flash / uncompressedFlash, sizes.ram, result.failures[e], result.ms[e] / result.renders);
+      passed = passed && result.failures[e] == 0;
+    }
+  }
+  decompressor.deinit();
+
+  printf("\n%s\n", passed ? "Run-length and DEFLATE pages match the uncompressed glyphs"
+                          : "FAILED: pages differ from the uncompressed glyphs");
+  return passed ? 0 : 1;
+}
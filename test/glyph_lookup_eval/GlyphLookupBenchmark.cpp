@@ -0,0 +1,208 @@
+// Checks the direct-mapped glyphLookup table of every builtin font against the binary search over its unicode
+// intervals for every code point, then looks up the glyphs of the hyphenation corpora text and reports how many
+// lookups per second either path does.
+
+#include <EpdFont.h>
+#include <Utf8.h>
+#include <builtinFonts/all.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr uint32_t kLastCodepoint = 0x10FFFF;
+constexpr int kTimedPasses = 10;
+constexpr int kTimedRuns = 3;
+
+struct TestFont {
+  const char* name;
+  const EpdFontData* data;
+};
+
+const TestFont kFonts[] = {
+    {"bookerly_12_bold", &bookerly_12_bold},
+    {"bookerly_12_bolditalic", &bookerly_12_bolditalic},
+    {"bookerly_12_italic", &bookerly_12_italic},
+    {"bookerly_12_regular", &bookerly_12_regular},
+    {"bookerly_14_bold", &bookerly_14_bold},
+    {"bookerly_14_bolditalic", &bookerly_14_bolditalic},
+    {"bookerly_14_italic", &bookerly_14_italic},
+    {"bookerly_14_regular", &bookerly_14_regular},
+    {"bookerly_16_bold", &bookerly_16_bold},
+    {"bookerly_16_bolditalic", &bookerly_16_bolditalic},
+    {"bookerly_16_italic", &bookerly_16_italic},
+    {"bookerly_16_regular", &bookerly_16_regular},
+    {"bookerly_18_bold", &bookerly_18_bold},
+    {"bookerly_18_bolditalic", &bookerly_18_bolditalic},
+    {"bookerly_18_italic", &bookerly_18_italic},
+    {"bookerly_18_regular", &bookerly_18_regular},
+    {"notosans_8_regular", &notosans_8_regular},
+    {"notosans_12_bold", &notosans_12_bold},
+    {"notosans_12_bolditalic", &notosans_12_bolditalic},
+    {"notosans_12_italic", &notosans_12_italic},
+    {"notosans_12_regular", &notosans_12_regular},
+    {"notosans_14_bold", &notosans_14_bold},
+    {"notosans_14_bolditalic", &notosans_14_bolditalic},
+    {"notosans_14_italic", &notosans_14_italic},
+    {"notosans_14_regular", &notosans_14_regular},
+    {"notosans_16_bold", &notosans_16_bold},
+    {"notosans_16_bolditalic", &notosans_16_bolditalic},
+    {"notosans_16_italic", &notosans_16_italic},
+    {"notosans_16_regular", &notosans_16_regular},
+    {"notosans_18_bold", &notosans_18_bold},
+    {"notosans_18_bolditalic", &notosans_18_bolditalic},
+    {"notosans_18_italic", &notosans_18_italic},
+    {"notosans_18_regular", &notosans_18_regular},
+    {"opendyslexic_10_bold", &opendyslexic_10_bold},
+    {"opendyslexic_10_bolditalic", &opendyslexic_10_bolditalic},
+    {"opendyslexic_10_italic", &opendyslexic_10_italic},
+    {"opendyslexic_10_regular", &opendyslexic_10_regular},
+    {"opendyslexic_12_bold", &opendyslexic_12_bold},
+    {"opendyslexic_12_bolditalic", &opendyslexic_12_bolditalic},
+    {"opendyslexic_12_italic", &opendyslexic_12_italic},
+    {"opendyslexic_12_regular", &opendyslexic_12_regular},
+    {"opendyslexic_14_bold", &opendyslexic_14_bold},
+    {"opendyslexic_14_bolditalic", &opendyslexic_14_bolditalic},
+    {"opendyslexic_14_italic", &opendyslexic_14_italic},
+    {"opendyslexic_14_regular", &opendyslexic_14_regular},
+    {"opendyslexic_8_bold", &opendyslexic_8_bold},
+    {"opendyslexic_8_bolditalic", &opendyslexic_8_bolditalic},
+    {"opendyslexic_8_italic", &opendyslexic_8_italic},
+    {"opendyslexic_8_regular", &opendyslexic_8_regular},
+    {"ubuntu_10_bold", &ubuntu_10_bold},
+    {"ubuntu_10_regular", &ubuntu_10_regular},
+    {"ubuntu_12_bold", &ubuntu_12_bold},
+    {"ubuntu_12_regular", &ubuntu_12_regular},
+};
+
+// Timed on the corpus text: a compressed reader font of each family and a 1-bit UI font
+const char* const kTimedFonts[] = {"bookerly_14_regular", "notosans_14_regular", "opendyslexic_10_regular",
+                                   "ubuntu_12_regular"};
+
+struct Corpus {
+  std::string name;
+  std::vector<uint32_t> codepoints;
+};
+
+// The words of a corpus as running text, one space between words
+bool loadCorpus(const std::string& path, Corpus& corpus) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  const size_t slash = path.find_last_of('/');
+  corpus.name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+  corpus.name = corpus.name.substr(0, corpus.name.find('_'));
+
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const std::string word = line.substr(0, line.find('|'));
+    const auto* text = reinterpret_cast<const unsigned char*>(word.c_str());
+    for (uint32_t cp; (cp = utf8NextCodepoint(&text)) != 0;) {
+      corpus.codepoints.push_back(cp);
+    }
+    corpus.codepoints.push_back(' ');
+  }
+  return true;
+}
+
+// The same font without its glyphLookup table, as getGlyph searched before the table existed
+EpdFontData withoutLookup(const EpdFontData* data) {
+  EpdFontData plain = *data;
+  plain.glyphLookup = nullptr;
+  return plain;
+}
+
+// Code points whose glyph differs between the table and the interval search
+int checkFont(const EpdFontData* data) {
+  const EpdFont font(data);
+  const EpdFontData plainData = withoutLookup(data);
+  const EpdFont plainFont(&plainData);
+  int differing = 0;
+  for (uint32_t cp = 0; cp <= kLastCodepoint; cp++) {
+    differing += font.getGlyph(cp) != plainFont.getGlyph(cp);
+  }
+  return differing;
+}
+
+// Millions of lookups per second of the fastest of several runs
+double lookupRate(const EpdFont& font, const std::vector<uint32_t>& codepoints, uintptr_t& checksum) {
+  double fastest = 0;
+  for (int run = 0; run < kTimedRuns; run++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < kTimedPasses; pass++) {
+      for (const uint32_t cp : codepoints) {
+        checksum += reinterpret_cast<uintptr_t>(font.getGlyph(cp));
+      }
+    }
+    const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    fastest = run == 0 ? us : std::min(fastest, us);
+  }
+  return static_cast<double>(codepoints.size()) * kTimedPasses / fastest;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <hyphenation test file>...\n", argv[0]);
+    return 1;
+  }
+  std::vector<Corpus> corpora(argc - 1);
+  for (int i = 1; i < argc; i++) {
+    if (!loadCorpus(argv[i], corpora[i - 1])) {
+      fprintf(stderr, "Could not read %s\n", argv[i]);
+      return 1;
+    }
+  }
+
+  int failures = 0;
+  int fontsWithoutLookup = 0;
+  for (const auto& testFont : kFonts) {
+    if (!testFont.data->glyphLookup) {
+      printf("%-28s FAILED: no glyphLookup table\n", testFont.name);
+      fontsWithoutLookup++;
+      continue;
+    }
+    const int differing = checkFont(testFont.data);
+    if (differing != 0) {
+      printf("%-28s FAILED: %d code points differ from the interval search\n", testFont.name, differing);
+      failures++;
+    }
+  }
+  printf("Checked U+0000-%X in %zu fonts: %d differ from the interval search, %d have no table\n\n", kLastCodepoint,
+         std::size(kFonts), failures, fontsWithoutLookup);
+
+  printf("%-24s %-10s %10s %8s %13s %13s %8s\n", "font", "corpus", "code pts", "direct", "search M/s", "table M/s",
+         "speedup");
+  uintptr_t checksum = 0;
+  for (const char* name : kTimedFonts) {
+    const auto* testFont = std::find_if(std::begin(kFonts), std::end(kFonts),
+                                        [name](const TestFont& font) { return std::string(name) == font.name; });
+    const EpdFont font(testFont->data);
+    const EpdFontData plainData = withoutLookup(testFont->data);
+    const EpdFont plainFont(&plainData);
+    for (const auto& corpus : corpora) {
+      const auto direct = std::count_if(corpus.codepoints.begin(), corpus.codepoints.end(),
+                                        [](const uint32_t cp) { return glyphLookupSlot(cp) < GLYPH_LOOKUP_SIZE; });
+      const double searchRate = lookupRate(plainFont, corpus.codepoints, checksum);
+      const double tableRate = lookupRate(font, corpus.codepoints, checksum);
+      printf("%-24s %-10s %10zu %7.1f%% %13.1f %13.1f %7.2fx\n", name, corpus.name.c_str(), corpus.codepoints.size(),
+             100.0 * static_cast<double>(direct) / static_cast<double>(corpus.codepoints.size()), searchRate, tableRate,
+             tableRate / searchRate);
+    }
+  }
+  printf("\n(checksum %zu)\n", static_cast<size_t>(checksum));
+
+  const bool passed = failures == 0 && fontsWithoutLookup == 0;
+  printf("%s\n", passed ? "All glyphLookup tables match the interval search"
+                        : "FAILED: glyphLookup tables are missing or differ from the interval search");
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+// Measures the words of the hyphenation corpora with EpdFont::getTextAdvanceX in every builtin reader style and the
+// UI fonts, and checks every width against a straightforward reference: code points folded into ligatures by a linear
+// search of the ligature table, glyphs found by a linear search of the intervals, kerning read from the class arrays.
+// Also reports how many words the kerning and ligature tables change, and how long measuring a word takes with the
+// tables against the same font without them, both glyph by glyph and through an advance table as layout does.
+
+#include <EpdFont.h>
+#include <builtinFonts/all.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr int kTimedPasses = 10;
+constexpr int kTimedRuns = 3;
+
+struct TestFont {
+  const char* name;
+  const EpdFontData* data;
+  bool kerned;  // Converted with kerning tables, see convert-builtin-fonts.sh
+};
+
+const TestFont kFonts[] = {
+    {"bookerly_12_regular", &bookerly_12_regular, true},
+    {"bookerly_14_regular", &bookerly_14_regular, true},
+    {"bookerly_14_bold", &bookerly_14_bold, true},
+    {"bookerly_14_italic", &bookerly_14_italic, true},
+    {"bookerly_14_bolditalic", &bookerly_14_bolditalic, true},
+    {"bookerly_18_regular", &bookerly_18_regular, true},
+    {"notosans_12_regular", &notosans_12_regular, true},
+    {"notosans_14_regular", &notosans_14_regular, true},
+    {"notosans_14_bold", &notosans_14_bold, true},
+    {"notosans_14_italic", &notosans_14_italic, true},
+    {"notosans_14_bolditalic", &notosans_14_bolditalic, true},
+    {"notosans_18_regular", &notosans_18_regular, true},
+    {"opendyslexic_10_regular", &opendyslexic_10_regular, false},
+    {"opendyslexic_10_bold", &opendyslexic_10_bold, false},
+    {"notosans_8_regular", &notosans_8_regular, false},
+    {"ubuntu_10_regular", &ubuntu_10_regular, false},
+    {"ubuntu_12_bold", &ubuntu_12_bold, false},
+};
+
+bool loadWords(const std::string& path, std::vector<std::string>& words) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    words.push_back(line.substr(0, line.find('|')));
+    // Capitalized forms exercise the uppercase kerning pairs ("To", "Va", "AV")
+    std::string capitalized = words.back();
+    if (!capitalized.empty() && capitalized[0] >= 'a' && capitalized[0] <= 'z') {
+      capitalized[0] = static_cast<char>(capitalized[0] - 'a' + 'A');
+      words.push_back(capitalized);
+    }
+  }
+  return true;
+}
+
+const EpdGlyph* referenceGlyph(const EpdFontData* data, const uint32_t cp) {
+  for (uint32_t i = 0; i < data->intervalCount; i++) {
+    const EpdUnicodeInterval& interval = data->intervals[i];
+    if (cp >= interval.first && cp <= interval.last) {
+      return &data->glyph[interval.offset + (cp - interval.first)];
+    }
+  }
+  return nullptr;
+}
+
+uint32_t referenceLigature(const EpdFontData* data, const uint32_t first, const uint32_t second) {
+  for (uint32_t i = 0; i < data->ligatureCount; i++) {
+    if (data->ligatures[i].first == first && data->ligatures[i].second == second) {
+      return data->ligatures[i].ligature;
+    }
+  }
+  return 0;
+}
+
+int referenceAdvanceX(const EpdFontData* data, const std::string& word) {
+  std::vector<uint32_t> codepoints;
+  const auto* text = reinterpret_cast<const unsigned char*>(word.c_str());
+  for (uint32_t cp; (cp = utf8NextCodepoint(&text)) != 0;) {
+    codepoints.push_back(cp);
+  }
+
+  int width = 0;
+  const EpdGlyph* previous = nullptr;
+  for (size_t i = 0; i < codepoints.size(); i++) {
+    uint32_t cp = codepoints[i];
+    while (i + 1 < codepoints.size()) {
+      const uint32_t ligature = referenceLigature(data, cp, codepoints[i + 1]);
+      if (ligature == 0) {
+        break;
+      }
+      cp = ligature;
+      i++;
+    }
+    const EpdGlyph* glyph = referenceGlyph(data, cp);
+    if (!glyph) glyph = referenceGlyph(data, REPLACEMENT_GLYPH);
+    if (!glyph) continue;
+    if (previous && data->kernMatrix) {
+      const uint8_t leftClass = data->kernLeftClasses[previous - data->glyph];
+      const uint8_t rightClass = data->kernRightClasses[glyph - data->glyph];
+      width += data->kernMatrix[leftClass * data->kernRightClassCount + rightClass];
+    }
+    width += glyph->advanceX;
+    previous = glyph;
+  }
+  return width;
+}
+
+// Nanoseconds per word of the fastest of several runs, each over several passes so the words are measured from cache
+// like on a page
+double timeWords(const EpdFont& font, const EpdAdvance* advances, const std::vector<std::string>& words,
+                 long long& checksum) {
+  double fastest = 0;
+  for (int run = 0; run < kTimedRuns; run++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < kTimedPasses; pass++) {
+      for (const auto& word : words) {
+        checksum += font.getTextAdvanceX(word.c_str(), advances);
+      }
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    fastest = run == 0 ? ns : std::min(fastest, ns);
+  }
+  return fastest / (static_cast<double>(words.size()) * kTimedPasses);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <hyphenation test file>...\n", argv[0]);
+    return 1;
+  }
+  std::vector<std::string> words;
+  for (int i = 1; i < argc; i++) {
+    if (!loadWords(argv[i], words)) {
+      fprintf(stderr, "Could not read %s\n", argv[i]);
+      return 1;
+    }
+  }
+
+  printf("%-24s %6s %7s %7s %7s | %-24s | %-24s\n", "font", "words", "differ", "kerned", "ligated",
+         "   glyph by glyph, ns", "   advance table, ns");
+  printf("%-24s %6s %7s %7s %7s | %7s %7s %8s | %7s %7s %8s\n", "", "", "", "", "", "plain", "tables", "cost", "plain",
+         "tables", "cost");
+  int failures = 0;
+  int unexpectedTables = 0;
+  long long checksum = 0;
+  for (const auto& testFont : kFonts) {
+    const EpdFont font(testFont.data);
+    // The same font as it was before the tables were exported
+    EpdFontData plainData = *testFont.data;
+    plainData.kernLeftClasses = nullptr;
+    plainData.kernRightClasses = nullptr;
+    plainData.kernMatrix = nullptr;
+    plainData.kernRightClassCount = 0;
+    plainData.ligatures = nullptr;
+    plainData.ligatureCount = 0;
+    plainData.ligatureStartMask = 0;
+    const EpdFont plainFont(&plainData);
+
+    static EpdAdvance advances[GLYPH_LOOKUP_SIZE];
+    static EpdAdvance plainAdvances[GLYPH_LOOKUP_SIZE];
+    font.buildAdvanceTable(advances);
+    plainFont.buildAdvanceTable(plainAdvances);
+
+    int differing = 0;
+    int kerned = 0;
+    int ligated = 0;
+    for (const auto& word : words) {
+      const int width = font.getTextAdvanceX(word.c_str());
+      const int reference = referenceAdvanceX(testFont.data, word);
+      differing += width != reference || font.getTextAdvanceX(word.c_str(), advances) != reference;
+      if (width != plainFont.getTextAdvanceX(word.c_str())) {
+        kerned++;
+      }
+      const auto* text = reinterpret_cast<const unsigned char*>(word.c_str());
+      for (uint32_t cp; (cp = font.nextCodepoint(&text)) != 0;) {
+        if (cp >= 0xFB00 && cp <= 0xFB06) {
+          ligated++;
+          break;
+        }
+      }
+    }
+    failures += differing != 0;
+    unexpectedTables += (testFont.data->kernMatrix != nullptr) != testFont.kerned;
+
+    const double plainNs = timeWords(plainFont, nullptr, words, checksum);
+    const double tablesNs = timeWords(font, nullptr, words, checksum);
+    const double plainTableNs = timeWords(plainFont, plainAdvances, words, checksum);
+    const double tablesTableNs = timeWords(font, advances, words, checksum);
+    printf("%-24s %6zu %7d %7d %7d | %7.1f %7.1f %7.0f%% | %7.1f %7.1f %7.0f%%\n", testFont.name, words.size(),
+           differing, kerned, ligated, plainNs, tablesNs, 100.0 * (tablesNs - plainNs) / plainNs, plainTableNs,
+           tablesTableNs, 100.0 * (tablesTableNs - plainTableNs) / plainTableNs);
+  }
+  printf("\n(checksum %lld)\n", checksum);
+
+  if (unexpectedTables != 0) {
+    printf("FAILED: %d fonts have kerning tables other than convert-builtin-fonts.sh exports\n", unexpectedTables);
+    return 1;
+  }
+  printf("%s\n", failures == 0 ? "All widths match the reference" : "FAILED: widths differ from the reference");
+  return failures == 0 ? 0 : 1;
+}
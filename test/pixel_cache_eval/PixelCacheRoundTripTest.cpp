@@ -0,0 +1,383 @@
+// Decodes the images of the test EPUBs into pixel cache files (.pxc), the way pages with images are prefetched, and
+// checks that the files hold the decoded pixels in the documented format. Then draws every cache file with
+// PixelCache::render and checks that it gives the same frame buffer, pixel for pixel, as drawing its pixels one at a
+// time with drawPixel2Bit, in every render mode and orientation. Also reports the size of the cache files against raw
+// 2-bit pixels, and how long a redraw takes compared to reading raw pixels and drawing them one at a time.
+//
+// JPEG files are decoded with JpegToFramebufferConverter. PNG decoding needs PNGdec, which is not available on the
+// host, so PNG images are passed in as PGM files and drawn the way PngToFramebufferConverter draws them.
+
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../../lib/Epub/Epub/converters/DitherUtils.h"
+#include "../../lib/Epub/Epub/converters/JpegToFramebufferConverter.h"
+#include "../../lib/Epub/Epub/converters/PixelCache.h"
+
+namespace {
+// Images are scaled to fit this like a page does, so they fit the screen in every orientation
+constexpr int kMaxWidth = 440;
+constexpr int kMaxHeight = 440;
+constexpr int kTimedRedraws = 20;
+
+struct Position {
+  int x;
+  int y;
+};
+// Byte aligned, and with the image rows starting in the middle of a panel byte
+const Position kPositions[] = {{0, 0}, {13, 21}};
+
+const GfxRenderer::Orientation kOrientations[] = {GfxRenderer::Portrait, GfxRenderer::LandscapeClockwise,
+                                                  GfxRenderer::PortraitInverted,
+                                                  GfxRenderer::LandscapeCounterClockwise};
+const char* const kOrientationNames[] = {"portrait", "landscape cw", "portrait inverted", "landscape ccw"};
+
+const GfxRenderer::RenderMode kModes[] = {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB, GfxRenderer::GRAYSCALE_MSB,
+                                          GfxRenderer::GRAYSCALE_BOTH};
+const char* const kModeNames[] = {"BW", "LSB", "MSB", "both"};
+
+HalDisplay display;
+GfxRenderer renderer(display);
+
+struct GrayImage {
+  int width = 0;
+  int height = 0;
+  std::vector<uint8_t> pixels;
+};
+
+bool loadPgm(const std::string& path, GrayImage& image) {
+  std::ifstream file(path, std::ios::binary);
+  std::string magic;
+  int maxValue = 0;
+  file >> magic >> image.width >> image.height >> maxValue;
+  file.get();
+  if (!file || magic != "P5" || maxValue != 255) {
+    return false;
+  }
+  image.pixels.resize(static_cast<size_t>(image.width) * image.height);
+  file.read(reinterpret_cast<char*>(image.pixels.data()), static_cast<std::streamsize>(image.pixels.size()));
+  return static_cast<bool>(file);
+}
+
+// Decodes an image at the position and size of the config, drawing it unless config.cacheOnly
+using Decoder = std::function<bool(const RenderConfig& config)>;
+
+// Nearest neighbour scaling with the Bresenham stepping and the dithering of PngToFramebufferConverter
+bool drawGrayImage(const GrayImage& image, const RenderConfig& config) {
+  PixelCache cache;
+  const bool caching = !config.cachePath.empty() && cache.begin(config.cachePath, config.maxWidth, config.maxHeight,
+                                                                 config.x, config.y, 1);
+  const float scale = static_cast<float>(config.maxWidth) / image.width;
+  int lastDstY = -1;
+  for (int srcY = 0; srcY < image.height; srcY++) {
+    const int dstY = static_cast<int>(srcY * scale);
+    if (dstY == lastDstY) continue;
+    lastDstY = dstY;
+    if (dstY >= config.maxHeight) break;
+
+    const int outY = config.y + dstY;
+    int srcX = 0;
+    int error = 0;
+    for (int dstX = 0; dstX < config.maxWidth; dstX++) {
+      const int outX = config.x + dstX;
+      const uint8_t value = applyBayerDither4Level(image.pixels[srcY * image.width + srcX], outX, outY);
+      if (!config.cacheOnly) renderer.drawPixel2Bit(outX, outY, value);
+      if (caching) cache.setPixel(outX, outY, value);
+      error += image.width;
+      while (error >= config.maxWidth) {
+        error -= config.maxWidth;
+        srcX++;
+      }
+    }
+  }
+  return !caching || cache.finish();
+}
+
+struct Planes {
+  std::vector<uint8_t> frame;
+  std::vector<uint8_t> msb;  // GRAYSCALE_BOTH only
+  bool grayPixels = false;   // BW only
+};
+
+// Draws in one render mode onto a cleared screen
+Planes renderPlanes(const GfxRenderer::RenderMode mode, const std::function<void()>& draw) {
+  Planes planes;
+  if (mode == GfxRenderer::GRAYSCALE_BOTH) {
+    renderer.renderGrayscale(draw);
+    planes.frame.assign(display.getGrayLsb(), display.getGrayLsb() + HalDisplay::BUFFER_SIZE);
+    planes.msb.assign(display.getGrayMsb(), display.getGrayMsb() + HalDisplay::BUFFER_SIZE);
+    return planes;
+  }
+  renderer.setRenderMode(mode);
+  renderer.clearScreen(mode == GfxRenderer::BW ? 0xFF : 0x00);
+  draw();
+  planes.frame.assign(renderer.getFrameBuffer(), renderer.getFrameBuffer() + HalDisplay::BUFFER_SIZE);
+  planes.grayPixels = renderer.hasGrayPixels();
+  renderer.setRenderMode(GfxRenderer::BW);
+  return planes;
+}
+
+// Values of the cached image, read back from the BW, LSB and MSB planes drawn without rotation
+std::vector<uint8_t> readBackPixels(const Planes& bw, const Planes& lsb, const Planes& msb, const RenderConfig& config) {
+  std::vector<uint8_t> pixels;
+  for (int y = config.y; y < config.y + config.maxHeight; y++) {
+    for (int x = config.x; x < config.x + config.maxWidth; x++) {
+      const int byte = y * HalDisplay::DISPLAY_WIDTH_BYTES + x / 8;
+      const uint8_t bit = 0x80 >> (x % 8);
+      if (lsb.frame[byte] & bit) {
+        pixels.push_back(1);
+      } else if (msb.frame[byte] & bit) {
+        pixels.push_back(2);
+      } else {
+        pixels.push_back((bw.frame[byte] & bit) ? 3 : 0);
+      }
+    }
+  }
+  return pixels;
+}
+
+// The cache file layout before PackBits: width, height and raw rows, drawn a pixel at a time
+bool writeRawCache(const std::string& path, const std::vector<uint8_t>& pixels, const int width, const int height) {
+  FsFile file;
+  if (!Storage.openFileForWrite("TST", path, file)) return false;
+  const uint16_t dimensions[2] = {static_cast<uint16_t>(width), static_cast<uint16_t>(height)};
+  file.write(dimensions, sizeof(dimensions));
+  const int bytesPerRow = (width + 3) / 4;
+  std::vector<uint8_t> row(bytesPerRow);
+  for (int y = 0; y < height; y++) {
+    std::fill(row.begin(), row.end(), 0);
+    for (int x = 0; x < width; x++) {
+      row[x / 4] |= pixels[y * width + x] << (6 - (x % 4) * 2);
+    }
+    file.write(row.data(), bytesPerRow);
+  }
+  return true;
+}
+
+void renderRawCache(const std::string& path, const int x, const int y) {
+  FsFile file;
+  if (!Storage.openFileForRead("TST", path, file)) return;
+  uint16_t dimensions[2];
+  file.read(dimensions, sizeof(dimensions));
+  const int bytesPerRow = (dimensions[0] + 3) / 4;
+  std::vector<uint8_t> row(bytesPerRow);
+  for (int rowY = 0; rowY < dimensions[1]; rowY++) {
+    file.read(row.data(), bytesPerRow);
+    for (int col = 0; col < dimensions[0]; col++) {
+      renderer.drawPixel2Bit(x + col, y + rowY, (row[col / 4] >> (6 - (col % 4) * 2)) & 0x03);
+    }
+  }
+}
+
+double timeRedraws(const GfxRenderer::RenderMode mode, const std::function<void()>& draw) {
+  renderer.setRenderMode(mode);
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kTimedRedraws; i++) {
+    draw();
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  renderer.setRenderMode(GfxRenderer::BW);
+  return std::chrono::duration<double, std::milli>(elapsed).count() / kTimedRedraws;
+}
+
+long fileSize(const std::string& path) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  return file ? static_cast<long>(file.tellg()) : -1;
+}
+
+// Reads a cache file as PixelCache.h describes it, independently of PixelCache
+bool readCacheFile(const std::string& path, const int width, const int height, std::vector<uint8_t>& pixels) {
+  std::ifstream file(path, std::ios::binary);
+  std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  if (data.size() < 8 || memcmp(data.data(), "PXC2", 4) != 0 || (data[4] | data[5] << 8) != width ||
+      (data[6] | data[7] << 8) != height) {
+    return false;
+  }
+  const size_t bytesPerRow = (width + 3) / 4;
+  size_t pos = 8;
+  pixels.clear();
+  for (int y = 0; y < height; y++) {
+    std::vector<uint8_t> row;
+    while (row.size() < bytesPerRow) {
+      if (pos >= data.size()) return false;
+      const uint8_t header = data[pos++];
+      if (header < 128) {
+        if (pos + header + 1 > data.size()) return false;
+        row.insert(row.end(), data.begin() + pos, data.begin() + pos + header + 1);
+        pos += header + 1;
+      } else if (header > 128) {
+        if (pos >= data.size()) return false;
+        row.insert(row.end(), 257 - header, data[pos++]);
+      }
+    }
+    if (row.size() != bytesPerRow) return false;
+    for (int x = 0; x < width; x++) {
+      pixels.push_back((row[x / 4] >> (6 - (x % 4) * 2)) & 0x03);
+    }
+  }
+  return pos == data.size();
+}
+
+void drawPixels(const std::vector<uint8_t>& pixels, const int x, const int y, const int width) {
+  for (size_t i = 0; i < pixels.size(); i++) {
+    renderer.drawPixel2Bit(x + static_cast<int>(i) % width, y + static_cast<int>(i) / width, pixels[i]);
+  }
+}
+
+bool runImage(const std::string& workDir, const std::string& imagePath) {
+  const size_t slash = imagePath.find_last_of('/');
+  const std::string name = imagePath.substr(slash == std::string::npos ? 0 : slash + 1);
+  const std::string extension = name.substr(name.find_last_of('.') + 1);
+
+  int sourceWidth = 0;
+  int sourceHeight = 0;
+  Decoder decode;
+  GrayImage grayImage;
+  JpegToFramebufferConverter jpegConverter;
+  if (extension == "jpg" || extension == "jpeg") {
+    ImageDimensions dimensions;
+    if (!JpegToFramebufferConverter::getDimensionsStatic(imagePath, dimensions)) {
+      fprintf(stderr, "%s: could not read the JPEG header\n", name.c_str());
+      return false;
+    }
+    sourceWidth = dimensions.width;
+    sourceHeight = dimensions.height;
+    decode = [&](const RenderConfig& config) {
+      return jpegConverter.decodeToFramebuffer(imagePath, renderer, config);
+    };
+  } else {
+    if (!loadPgm(imagePath, grayImage)) {
+      fprintf(stderr, "%s: could not read the PGM file\n", name.c_str());
+      return false;
+    }
+    sourceWidth = grayImage.width;
+    sourceHeight = grayImage.height;
+    decode = [&](const RenderConfig& config) { return drawGrayImage(grayImage, config); };
+  }
+
+  // Display size as ChapterHtmlSlimParser computes it
+  const float scaleX = sourceWidth > kMaxWidth ? static_cast<float>(kMaxWidth) / sourceWidth : 1.0f;
+  const float scaleY = sourceHeight > kMaxHeight ? static_cast<float>(kMaxHeight) / sourceHeight : 1.0f;
+  const float scale = std::min(1.0f, std::min(scaleX, scaleY));
+  const int width = static_cast<int>(sourceWidth * scale);
+  const int height = static_cast<int>(sourceHeight * scale);
+
+  // As ImageBlock::buildPixelCache caches an image
+  RenderConfig config;
+  config.x = 0;
+  config.y = 0;
+  config.maxWidth = width;
+  config.maxHeight = height;
+  config.useGrayscale = true;
+  config.useDithering = true;
+  config.performanceMode = false;
+  config.useExactDimensions = true;
+  config.cachePath = workDir + "/" + name + ".pxc";
+  config.cacheOnly = true;
+  const std::string& cachePath = config.cachePath;
+  const std::string rawPath = workDir + "/" + name + ".raw";
+
+  std::vector<uint8_t> pixels;
+  if (!decode(config) || !readCacheFile(cachePath, width, height, pixels)) {
+    fprintf(stderr, "%s: no valid cache file written\n", name.c_str());
+    return false;
+  }
+
+  bool passed = true;
+  renderer.setOrientation(GfxRenderer::LandscapeCounterClockwise);
+  if (scale == 1.0f || !grayImage.pixels.empty()) {
+    // Drawing while decoding draws every pixel once (scaled JPEGs draw source pixels over each other), so the decoded
+    // pixels can be read back from the planes drawn without rotation
+    config.cacheOnly = false;
+    config.cachePath.clear();
+    const Planes bw = renderPlanes(GfxRenderer::BW, [&] { decode(config); });
+    const Planes lsb = renderPlanes(GfxRenderer::GRAYSCALE_LSB, [&] { decode(config); });
+    const Planes msb = renderPlanes(GfxRenderer::GRAYSCALE_MSB, [&] { decode(config); });
+    config.cachePath = workDir + "/" + name + ".pxc";
+    if (readBackPixels(bw, lsb, msb, config) != pixels) {
+      fprintf(stderr, "%s: the cache file holds other pixels than were decoded\n", name.c_str());
+      passed = false;
+    }
+  }
+
+  int differences = 0;
+  for (const auto& position : kPositions) {
+    for (size_t o = 0; o < std::size(kOrientations); o++) {
+      renderer.setOrientation(kOrientations[o]);
+      for (size_t m = 0; m < std::size(kModes); m++) {
+        const Planes expected = renderPlanes(kModes[m], [&] { drawPixels(pixels, position.x, position.y, width); });
+        bool rendered = false;
+        const Planes actual = renderPlanes(kModes[m], [&] {
+          rendered = PixelCache::render(renderer, cachePath, position.x, position.y, width, height);
+        });
+        if (!rendered || expected.frame != actual.frame || expected.msb != actual.msb ||
+            expected.grayPixels != actual.grayPixels) {
+          fprintf(stderr, "%s: %s at %d,%d in %s differs from drawing every pixel\n", name.c_str(), kModeNames[m],
+                  position.x, position.y, kOrientationNames[o]);
+          differences++;
+        }
+      }
+    }
+  }
+  if (differences) {
+    fprintf(stderr, "%s: %d of %zu renders differ\n", name.c_str(), differences,
+            std::size(kPositions) * std::size(kOrientations) * std::size(kModes));
+    passed = false;
+  }
+
+  // Redraws of a page in the default orientation, from the card and of the pixels alone
+  writeRawCache(rawPath, pixels, width, height);
+  renderer.setOrientation(GfxRenderer::Portrait);
+  FsFile::bytesRead = 0;
+  const double rawMs = timeRedraws(GfxRenderer::BW, [&] { renderRawCache(rawPath, 0, 0); });
+  const uint64_t rawRead = FsFile::bytesRead / kTimedRedraws;
+  FsFile::bytesRead = 0;
+  const double packedMs =
+      timeRedraws(GfxRenderer::BW, [&] { PixelCache::render(renderer, cachePath, 0, 0, width, height); });
+  const uint64_t packedRead = FsFile::bytesRead / kTimedRedraws;
+
+  const int bytesPerRow = (width + 3) / 4;
+  std::vector<uint8_t> rows(static_cast<size_t>(bytesPerRow) * height, 0);
+  for (size_t i = 0; i < pixels.size(); i++) {
+    rows[(i / width) * bytesPerRow + (i % width) / 4] |= pixels[i] << (6 - (i % width % 4) * 2);
+  }
+  const auto drawRows = [&] { renderer.drawImage2Bit(rows.data(), 0, 0, width, height); };
+  const auto drawEveryPixel = [&] { drawPixels(pixels, 0, 0, width); };
+  const double drawSpeedup = timeRedraws(GfxRenderer::BW, drawEveryPixel) / timeRedraws(GfxRenderer::BW, drawRows);
+  const double grayDrawSpeedup =
+      timeRedraws(GfxRenderer::GRAYSCALE_LSB, drawEveryPixel) / timeRedraws(GfxRenderer::GRAYSCALE_LSB, drawRows);
+
+  printf("%-40s %4dx%-4d %6ld %6ld %5.1f%% %6llu %6llu %6.2f %6.2f %5.1fx %5.1fx %5.1fx %s\n", name.c_str(), width,
+         height, fileSize(rawPath), fileSize(cachePath), 100.0 * fileSize(cachePath) / fileSize(rawPath),
+         static_cast<unsigned long long>(rawRead), static_cast<unsigned long long>(packedRead), rawMs, packedMs,
+         rawMs / packedMs, drawSpeedup, grayDrawSpeedup, passed ? "ok" : "FAILED");
+  return passed;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s <work directory> <image.jpg|image.pgm>...\n", argv[0]);
+    return 1;
+  }
+
+  renderer.begin();
+  // Sizes and bytes read per redraw, redraw times in ms, how much faster redraws and drawing the pixels alone are
+  printf("%-40s %9s %6s %6s %6s %6s %6s %6s %6s %6s %6s %6s\n", "image", "size", "raw B", "pxc B", "pxc", "raw rd",
+         "pxc rd", "raw ms", "pxc ms", "redraw", "BW", "gray");
+  bool passed = true;
+  for (int i = 2; i < argc; i++) {
+    passed = runImage(argv[1], argv[i]) && passed;
+  }
+  printf("\n%s\n", passed ? "All cached images hold the decoded pixels and draw the same as pixel by pixel"
+                          : "FAILED: cached images differ");
+  return passed ? 0 : 1;
+}
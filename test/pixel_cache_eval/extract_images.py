@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Extracts the images of EPUB files for PixelCacheRoundTripTest and DitherBenchmark.
+
+JPEG files are written as they are. PNG files are decoded to 8-bit grayscale PGM files (only non-interlaced 8-bit
+PNGs are supported), as the PNG decoder of the reader is not available on the host. With --keep-png the PNG files
+are written as they are too, for the converters that decode PNG with miniz.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zipfile
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+CHANNELS = {0: 1, 2: 3, 4: 2, 6: 4}  # Color type -> samples per pixel
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def decode_png(data):
+    if not data.startswith(PNG_SIGNATURE):
+        raise ValueError("not a PNG file")
+    pos = len(PNG_SIGNATURE)
+    idat = b""
+    header = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos : pos + 8])
+        chunk = data[pos + 8 : pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+    width, height, depth, color_type, _, _, interlace = header
+    if depth != 8 or color_type not in CHANNELS or interlace:
+        raise ValueError(f"unsupported PNG (depth {depth}, color type {color_type}, interlace {interlace})")
+
+    channels = CHANNELS[color_type]
+    stride = width * channels
+    raw = zlib.decompress(idat)
+    previous = bytearray(stride)
+    gray = bytearray()
+    for y in range(height):
+        filter_type = raw[y * (stride + 1)]
+        row = bytearray(raw[y * (stride + 1) + 1 : (y + 1) * (stride + 1)])
+        for i in range(stride):
+            left = row[i - channels] if i >= channels else 0
+            up = previous[i]
+            up_left = previous[i - channels] if i >= channels else 0
+            if filter_type == 1:
+                row[i] = (row[i] + left) & 0xFF
+            elif filter_type == 2:
+                row[i] = (row[i] + up) & 0xFF
+            elif filter_type == 3:
+                row[i] = (row[i] + (left + up) // 2) & 0xFF
+            elif filter_type == 4:
+                row[i] = (row[i] + paeth(left, up, up_left)) & 0xFF
+        for x in range(width):
+            pixel = row[x * channels : (x + 1) * channels]
+            if channels >= 3:
+                # Same weights as the reader's converters
+                gray.append((pixel[0] * 77 + pixel[1] * 150 + pixel[2] * 29) >> 8)
+            else:
+                gray.append(pixel[0])
+        previous = row
+    return width, height, bytes(gray)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--output", required=True, help="directory to write the images to")
+    parser.add_argument("--keep-png", action="store_true", help="also write the PNG files as they are")
+    parser.add_argument("epubs", nargs="+")
+    args = parser.parse_args()
+
+    os.makedirs(args.output, exist_ok=True)
+    for epub in args.epubs:
+        prefix = os.path.splitext(os.path.basename(epub))[0]
+        with zipfile.ZipFile(epub) as archive:
+            for name in archive.namelist():
+                base, extension = os.path.splitext(os.path.basename(name))
+                extension = extension.lower()
+                if extension in (".jpg", ".jpeg"):
+                    with open(os.path.join(args.output, f"{prefix}_{base}{extension}"), "wb") as out:
+                        out.write(archive.read(name))
+                elif extension == ".png":
+                    if args.keep_png:
+                        with open(os.path.join(args.output, f"{prefix}_{base}.png"), "wb") as out:
+                            out.write(archive.read(name))
+                    try:
+                        width, height, gray = decode_png(archive.read(name))
+                    except ValueError as error:
+                        print(f"Skipping {name}: {error}", file=sys.stderr)
+                        continue
+                    with open(os.path.join(args.output, f"{prefix}_{base}.pgm"), "wb") as out:
+                        out.write(f"P5\n{width} {height}\n255\n".encode())
+                        out.write(gray)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,60 @@
+#pragma once
+// Panel of the reader on the host: drawing goes to a frame buffer in memory, the gray planes sent to the panel are
+// kept to compare grayscale renders and the last refresh is recorded
+
+#include <Arduino.h>
+
+#include <cstdint>
+#include <cstring>
+
+class HalDisplay {
+ public:
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+  static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+  static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+
+  void begin() {}
+  void clearScreen(const uint8_t color = 0xFF) const { memset(frameBuffer, color, BUFFER_SIZE); }
+  void drawImage(const uint8_t*, uint16_t, uint16_t, uint16_t, uint16_t, bool = false) const {}
+  void drawImageTransparent(const uint8_t*, uint16_t, uint16_t, uint16_t, uint16_t, bool = false) const {}
+  // A refresh as the panel would receive it. Whole frame refreshes are reported as a window over the full panel
+  struct Refresh {
+    bool window;
+    RefreshMode mode;
+    uint16_t x, y, width, height;
+    bool turnOffScreen;
+  };
+
+  void displayBuffer(const RefreshMode mode = FAST_REFRESH, const bool turnOffScreen = false) {
+    lastRefresh = {false, mode, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, turnOffScreen};
+  }
+  void displayWindow(const uint16_t x, const uint16_t y, const uint16_t w, const uint16_t h,
+                     const bool turnOffScreen = false) {
+    lastRefresh = {true, FAST_REFRESH, x, y, w, h, turnOffScreen};
+  }
+  void refreshDisplay(RefreshMode = FAST_REFRESH, bool = false) {}
+  void deepSleep() {}
+  uint8_t* getFrameBuffer() const { return frameBuffer; }
+  void copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer) {
+    copyGrayscaleLsbBuffers(lsbBuffer);
+    copyGrayscaleMsbBuffers(msbBuffer);
+  }
+  void copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) { memcpy(grayLsb, lsbBuffer, BUFFER_SIZE); }
+  void copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) { memcpy(grayMsb, msbBuffer, BUFFER_SIZE); }
+  void cleanupGrayscaleBuffers(const uint8_t*) {}
+  void displayGrayBuffer(bool = false) {}
+
+  // Planes of the last grayscale render
+  const uint8_t* getGrayLsb() const { return grayLsb; }
+  const uint8_t* getGrayMsb() const { return grayMsb; }
+  const Refresh& getLastRefresh() const { return lastRefresh; }
+
+ private:
+  static inline uint8_t frameBuffer[BUFFER_SIZE];
+  static inline uint8_t grayLsb[BUFFER_SIZE];
+  static inline uint8_t grayMsb[BUFFER_SIZE];
+  static inline Refresh lastRefresh = {};
+};
@@ -0,0 +1,4 @@
+#pragma once
+// SD card access on the host goes through HalStorage
+
+#include <HalStorage.h>
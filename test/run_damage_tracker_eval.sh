@@ -0,0 +1,45 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/damage_tracker_eval"
+BINARY="$BUILD_DIR/DamageTrackerTest"
+
+mkdir -p "$BUILD_DIR"
+
+cc -O2 -ffunction-sections -c "$ROOT_DIR/lib/uzlib/src/tinflate.c" -I"$ROOT_DIR/lib/uzlib/src" -o "$BUILD_DIR/tinflate.o"
+
+SOURCES=(
+  "$ROOT_DIR/test/damage_tracker_eval/DamageTrackerTest.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/AreaScaler.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/DamageTracker.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+  "$BUILD_DIR/tinflate.o"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -Wno-bidi-chars
+  -Wl,--gc-sections
+  -I"$ROOT_DIR/test/pixel_cache_eval/host"
+  -I"$ROOT_DIR/test/sd_font_eval/host"
+  -I"$ROOT_DIR/test/font_group_eval/host"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/uzlib/src"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+"$BINARY"
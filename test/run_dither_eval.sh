@@ -0,0 +1,63 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/dither_eval"
+BINARY="$BUILD_DIR/DitherBenchmark"
+IMAGE_DIR="$BUILD_DIR/images"
+GOLDEN_DIR="$ROOT_DIR/test/dither_eval/golden"
+
+mkdir -p "$BUILD_DIR"
+
+# --update rewrites the golden images from the current output
+UPDATE=()
+if [ "${1:-}" = "--update" ]; then
+  UPDATE=(--update)
+  mkdir -p "$GOLDEN_DIR"
+  shift
+fi
+
+if [ "$#" -eq 0 ]; then
+  set -- "$ROOT_DIR"/test/epubs/*.epub
+fi
+rm -rf "$IMAGE_DIR"
+python3 "$ROOT_DIR/test/pixel_cache_eval/extract_images.py" --keep-png --output "$IMAGE_DIR" "$@"
+
+cc -O2 -ffunction-sections -c "$ROOT_DIR/lib/picojpeg/picojpeg.c" -I"$ROOT_DIR/lib/picojpeg" -o "$BUILD_DIR/picojpeg.o"
+cc -O2 -ffunction-sections -c "$ROOT_DIR/lib/miniz/miniz.c" -I"$ROOT_DIR/lib/miniz" -o "$BUILD_DIR/miniz.o"
+
+SOURCES=(
+  "$ROOT_DIR/test/dither_eval/DitherBenchmark.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/converters/ImageDimensionsParser.cpp"
+  "$ROOT_DIR/lib/JpegToBmpConverter/JpegToBmpConverter.cpp"
+  "$ROOT_DIR/lib/PngToBmpConverter/PngToBmpConverter.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/AreaScaler.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/ScaledBmpWriter.cpp"
+  "$BUILD_DIR/picojpeg.o"
+  "$BUILD_DIR/miniz.o"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -Wl,--gc-sections
+  -I"$ROOT_DIR/test/pixel_cache_eval/host"
+  -I"$ROOT_DIR/test/sd_font_eval/host"
+  -I"$ROOT_DIR/test/font_group_eval/host"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/JpegToBmpConverter"
+  -I"$ROOT_DIR/lib/PngToBmpConverter"
+  -I"$ROOT_DIR/lib/picojpeg"
+  -I"$ROOT_DIR/lib/miniz"
+  -I"$ROOT_DIR/lib/uzlib/src"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+"$BINARY" "${UPDATE[@]}" "$GOLDEN_DIR" "$IMAGE_DIR"/*
@@ -0,0 +1,73 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/glyph_encoding_eval"
+FONT_DIR="$BUILD_DIR/fonts"
+BINARY="$BUILD_DIR/GlyphEncodingBenchmark"
+SCRIPTS_DIR="$ROOT_DIR/lib/EpdFont/scripts"
+SOURCE_DIR="$ROOT_DIR/lib/EpdFont/builtinFonts/source"
+
+mkdir -p "$FONT_DIR"
+
+if [ "$#" -eq 0 ]; then
+  set -- "$ROOT_DIR"/test/hyphenation_eval/resources/*_hyphenation_tests.txt
+fi
+FREQUENCY_CORPORA=()
+for corpus in "$@"; do
+  FREQUENCY_CORPORA+=(--frequency-corpus "$corpus")
+done
+
+# Every test font in the three glyph encodings, with the options convert-builtin-fonts.sh uses otherwise. The
+# converter's notes on missing code points go to a log.
+LOG="$FONT_DIR/fontconvert.log"
+rm -f "$LOG"
+convert() {
+  local name="$1"
+  shift
+  python3 "$SCRIPTS_DIR/fontconvert.py" "${name}_uncompressed" "$@" > "$FONT_DIR/${name}_uncompressed.h" 2>> "$LOG"
+  python3 "$SCRIPTS_DIR/fontconvert.py" "${name}_rle" "$@" --rle > "$FONT_DIR/${name}_rle.h" 2>> "$LOG"
+  python3 "$SCRIPTS_DIR/fontconvert.py" "${name}_compressed" "$@" --compress "${FREQUENCY_CORPORA[@]}" \
+    > "$FONT_DIR/${name}_compressed.h" 2>> "$LOG"
+}
+convert bookerly_14_regular 14 "$SOURCE_DIR/Bookerly/Bookerly-Regular.ttf" --2bit
+convert notosans_14_regular 14 "$SOURCE_DIR/NotoSans/NotoSans-Regular.ttf" --2bit
+convert ubuntu_12_regular 12 "$SOURCE_DIR/Ubuntu/Ubuntu-Regular.ttf"
+
+cc -O2 -ffunction-sections -c "$ROOT_DIR/lib/uzlib/src/tinflate.c" -I"$ROOT_DIR/lib/uzlib/src" -o "$BUILD_DIR/tinflate.o"
+
+SOURCES=(
+  "$ROOT_DIR/test/glyph_encoding_eval/GlyphEncodingBenchmark.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/AreaScaler.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/DamageTracker.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+  "$BUILD_DIR/tinflate.o"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -Wno-bidi-chars
+  -Wl,--gc-sections
+  -I"$FONT_DIR"
+  -I"$ROOT_DIR/test/pixel_cache_eval/host"
+  -I"$ROOT_DIR/test/sd_font_eval/host"
+  -I"$ROOT_DIR/test/font_group_eval/host"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/uzlib/src"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+"$BINARY" "$@"
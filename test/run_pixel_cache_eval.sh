@@ -0,0 +1,57 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/pixel_cache_eval"
+BINARY="$BUILD_DIR/PixelCacheRoundTripTest"
+IMAGE_DIR="$BUILD_DIR/images"
+
+mkdir -p "$BUILD_DIR"
+
+if [ "$#" -eq 0 ]; then
+  set -- "$ROOT_DIR"/test/epubs/test_jpeg_images.epub "$ROOT_DIR"/test/epubs/test_png_images.epub
+fi
+rm -rf "$IMAGE_DIR"
+python3 "$ROOT_DIR/test/pixel_cache_eval/extract_images.py" --output "$IMAGE_DIR" "$@"
+
+cc -O2 -ffunction-sections -c "$ROOT_DIR/lib/uzlib/src/tinflate.c" -I"$ROOT_DIR/lib/uzlib/src" -o "$BUILD_DIR/tinflate.o"
+cc -O2 -ffunction-sections -c "$ROOT_DIR/lib/picojpeg/picojpeg.c" -I"$ROOT_DIR/lib/picojpeg" -o "$BUILD_DIR/picojpeg.o"
+
+SOURCES=(
+  "$ROOT_DIR/test/pixel_cache_eval/PixelCacheRoundTripTest.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/converters/ImageToFramebufferDecoder.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/converters/JpegToFramebufferConverter.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/converters/PixelCache.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/AreaScaler.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/DamageTracker.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+  "$BUILD_DIR/tinflate.o"
+  "$BUILD_DIR/picojpeg.o"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -Wl,--gc-sections
+  -I"$ROOT_DIR/test/pixel_cache_eval/host"
+  -I"$ROOT_DIR/test/sd_font_eval/host"
+  -I"$ROOT_DIR/test/font_group_eval/host"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/picojpeg"
+  -I"$ROOT_DIR/lib/uzlib/src"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+"$BINARY" "$BUILD_DIR" "$IMAGE_DIR"/*
@@ -0,0 +1,36 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/scaler_eval"
+BINARY="$BUILD_DIR/AreaScalerQualityTest"
+IMAGE_DIR="$BUILD_DIR/images"
+
+mkdir -p "$BUILD_DIR"
+
+# The PNG images of the test EPUBs as PGM files, besides the built-in patterns
+if [ "$#" -eq 0 ]; then
+  rm -rf "$IMAGE_DIR"
+  python3 "$ROOT_DIR/test/pixel_cache_eval/extract_images.py" --output "$IMAGE_DIR" \
+    "$ROOT_DIR"/test/epubs/test_png_images.epub "$ROOT_DIR"/test/epubs/test_mixed_images.epub
+  set -- "$IMAGE_DIR"/*.pgm
+fi
+
+SOURCES=(
+  "$ROOT_DIR/test/scaler_eval/AreaScalerQualityTest.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/AreaScaler.cpp"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -I"$ROOT_DIR/test/font_group_eval/host"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/Logging"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+"$BINARY" "$@"
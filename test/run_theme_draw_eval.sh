@@ -0,0 +1,72 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+EVAL_DIR="$ROOT_DIR/test/theme_draw_eval"
+BUILD_DIR="$ROOT_DIR/build/theme_draw_eval"
+BINARY="$BUILD_DIR/ThemeDrawBenchmark"
+PER_PIXEL_BINARY="$BUILD_DIR/ThemeDrawBenchmarkPerPixel"
+
+mkdir -p "$BUILD_DIR"
+
+cc -O2 -ffunction-sections -c "$ROOT_DIR/lib/uzlib/src/tinflate.c" -I"$ROOT_DIR/lib/uzlib/src" -o "$BUILD_DIR/tinflate.o"
+
+THEME_SOURCES=(
+  "$EVAL_DIR/ThemeDrawBenchmark.cpp"
+  "$ROOT_DIR/src/components/themes/BaseTheme.cpp"
+  "$ROOT_DIR/src/components/themes/lyra/LyraTheme.cpp"
+)
+
+RENDERER_SOURCES=(
+  "$ROOT_DIR/lib/GfxRenderer/AreaScaler.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/DamageTracker.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$EVAL_DIR/host/I18n.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+)
+
+# The host stubs come first so they stand in for the firmware headers of the same name. BaseTheme.h gets <string>
+# from Arduino.h on the device, so it is included up front here
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -Wno-bidi-chars
+  -Wno-unused-parameter
+  -include string
+  -I"$EVAL_DIR/host"
+  -I"$ROOT_DIR/test/pixel_cache_eval/host"
+  -I"$ROOT_DIR/test/sd_font_eval/host"
+  -I"$ROOT_DIR/test/font_group_eval/host"
+  -I"$ROOT_DIR/src"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/I18n"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/uzlib/src"
+)
+
+c++ "${CXXFLAGS[@]}" -Wl,--gc-sections "${THEME_SOURCES[@]}" "${RENDERER_SOURCES[@]}" "$BUILD_DIR/tinflate.o" \
+  -o "$BINARY"
+
+# Per-pixel build: the themes see per_pixel/GfxRenderer.h, which builds on the real renderer renamed to GfxRendererBase
+mkdir -p "$BUILD_DIR/per_pixel"
+PER_PIXEL_OBJECTS=()
+for source in "${RENDERER_SOURCES[@]}"; do
+  object="$BUILD_DIR/per_pixel/$(basename "${source%.cpp}").o"
+  c++ "${CXXFLAGS[@]}" -ffunction-sections -DGfxRenderer=GfxRendererBase -c "$source" -o "$object"
+  PER_PIXEL_OBJECTS+=("$object")
+done
+c++ -I"$EVAL_DIR/per_pixel" "${CXXFLAGS[@]}" -Wl,--gc-sections "${THEME_SOURCES[@]}" "${PER_PIXEL_OBJECTS[@]}" \
+  "$BUILD_DIR/tinflate.o" -o "$PER_PIXEL_BINARY"
+
+"$PER_PIXEL_BINARY" "$BUILD_DIR/per_pixel.bin"
+"$BINARY" --compare "$BUILD_DIR/per_pixel.bin"
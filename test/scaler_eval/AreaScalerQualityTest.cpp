@@ -0,0 +1,282 @@
+// Scales gray images with AreaScaler and with the scalers it replaces, and compares them against an exact area average
+// computed in double precision: PSNR of each against the reference, and how long a scale takes. The replaced scalers
+// are the nearest sampling drawBitmap did (the last source pixel mapped to an output pixel wins) and the box average
+// of ScaledBmpWriter (whole source pixels, each counted in a single output pixel). Also checks that AreaScaler passes
+// images through unchanged when not scaling, and that it is within a rounding error of the reference.
+//
+// Images are synthetic test patterns (a zone plate, which shows aliasing as moire, fine stripes and a gradient) and
+// any PGM files given, see run_scaler_eval.sh.
+
+#include <AreaScaler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace {
+// AreaScaler must be within rounding of the exact average, the sampled scalers are far from it
+constexpr double kMinPsnr = 45.0;
+constexpr int kTimedRuns = 5;
+
+struct GrayImage {
+  std::string name;
+  int width = 0;
+  int height = 0;
+  std::vector<uint8_t> pixels;
+};
+
+bool loadPgm(const std::string& path, GrayImage& image) {
+  std::ifstream file(path, std::ios::binary);
+  std::string magic;
+  int maxValue = 0;
+  file >> magic >> image.width >> image.height >> maxValue;
+  file.get();
+  if (!file || magic != "P5" || maxValue != 255) {
+    return false;
+  }
+  image.name = path.substr(path.find_last_of('/') + 1);
+  image.pixels.resize(static_cast<size_t>(image.width) * image.height);
+  file.read(reinterpret_cast<char*>(image.pixels.data()), static_cast<std::streamsize>(image.pixels.size()));
+  return static_cast<bool>(file);
+}
+
+GrayImage makePattern(const std::string& name, const int width, const int height,
+                      const std::function<double(int, int)>& value) {
+  GrayImage image{name, width, height, {}};
+  image.pixels.resize(static_cast<size_t>(width) * height);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      image.pixels[y * width + x] = static_cast<uint8_t>(std::lround(std::clamp(value(x, y), 0.0, 255.0)));
+    }
+  }
+  return image;
+}
+
+std::vector<GrayImage> makePatterns() {
+  std::vector<GrayImage> patterns;
+  // Rings whose frequency rises to the pixel rate at the corners
+  patterns.push_back(makePattern("zoneplate", 1200, 1600, [](const int x, const int y) {
+    const double dx = x - 600.0;
+    const double dy = y - 800.0;
+    return 127.5 + 127.5 * std::cos(M_PI * (dx * dx + dy * dy) / 2000.0);
+  }));
+  patterns.push_back(makePattern("stripes", 1237, 1651, [](const int x, const int y) {
+    return ((x / 2 + y / 3) & 1) ? 255.0 : 0.0;
+  }));
+  patterns.push_back(makePattern("gradient", 1000, 1500, [](const int x, const int y) {
+    return (x * 255.0 / 999.0 + y * 255.0 / 1499.0) / 2;
+  }));
+  return patterns;
+}
+
+struct Scaled {
+  int width = 0;
+  int height = 0;
+  std::vector<uint8_t> pixels;
+};
+
+// Mean of the area each output pixel covers, with exact (rational) pixel edges
+std::vector<double> referenceScale(const GrayImage& image, const int outWidth, const int outHeight) {
+  const double scaleX = static_cast<double>(image.width) / outWidth;
+  const double scaleY = static_cast<double>(image.height) / outHeight;
+  // Weights of the source pixels covered by each output pixel along one axis
+  const auto spans = [](const int outSize, const double scale) {
+    std::vector<std::vector<std::pair<int, double>>> result(outSize);
+    for (int o = 0; o < outSize; o++) {
+      const double start = o * scale;
+      const double end = (o + 1) * scale;
+      for (int s = static_cast<int>(start); s < end; s++) {
+        const double covered = std::min<double>(end, s + 1) - std::max<double>(start, s);
+        if (covered > 0) result[o].emplace_back(s, covered / scale);
+      }
+    }
+    return result;
+  };
+  const auto spansX = spans(outWidth, scaleX);
+  const auto spansY = spans(outHeight, scaleY);
+
+  std::vector<double> out(static_cast<size_t>(outWidth) * outHeight);
+  for (int oy = 0; oy < outHeight; oy++) {
+    for (int ox = 0; ox < outWidth; ox++) {
+      double sum = 0;
+      for (const auto& [sy, wy] : spansY[oy]) {
+        for (const auto& [sx, wx] : spansX[ox]) {
+          sum += image.pixels[sy * image.width + sx] * wx * wy;
+        }
+      }
+      out[oy * outWidth + ox] = sum;
+    }
+  }
+  return out;
+}
+
+// drawBitmap before AreaScaler: every source pixel is written to the output pixel its scaled position falls on
+Scaled nearestScale(const GrayImage& image, const int outWidth, const int outHeight) {
+  const float scale =
+      std::min(static_cast<float>(outWidth) / image.width, static_cast<float>(outHeight) / image.height);
+  const auto scale_fp = static_cast<int32_t>(scale * 65536.0f + 0.5f);
+  Scaled out{outWidth, outHeight, std::vector<uint8_t>(static_cast<size_t>(outWidth) * outHeight)};
+  for (int y = 0; y < image.height; y++) {
+    const int outY = (y * scale_fp) >> 16;
+    if (outY >= outHeight) break;
+    for (int x = 0; x < image.width; x++) {
+      const int outX = (x * scale_fp) >> 16;
+      if (outX >= outWidth) break;
+      out.pixels[outY * outWidth + outX] = image.pixels[y * image.width + x];
+    }
+  }
+  return out;
+}
+
+// ScaledBmpWriter before AreaScaler: the average of the whole source pixels starting in each output pixel
+Scaled boxScale(const GrayImage& image, const int outWidth, const int outHeight) {
+  const uint32_t scaleX_fp = (static_cast<uint32_t>(image.width) << 16) / outWidth;
+  const uint32_t scaleY_fp = (static_cast<uint32_t>(image.height) << 16) / outHeight;
+  Scaled out{outWidth, outHeight, std::vector<uint8_t>(static_cast<size_t>(outWidth) * outHeight)};
+  std::vector<uint32_t> rowAccum(outWidth);
+  std::vector<uint16_t> rowCount(outWidth);
+  int currentOutY = 0;
+  uint32_t nextOutY_srcStart = scaleY_fp;
+  for (int y = 0; y < image.height; y++) {
+    const uint8_t* srcRow = &image.pixels[y * image.width];
+    for (int outX = 0; outX < outWidth; outX++) {
+      const int srcXStart = (static_cast<uint32_t>(outX) * scaleX_fp) >> 16;
+      const int srcXEnd = (static_cast<uint32_t>(outX + 1) * scaleX_fp) >> 16;
+      int sum = 0;
+      int count = 0;
+      for (int srcX = srcXStart; srcX < srcXEnd && srcX < image.width; srcX++) {
+        sum += srcRow[srcX];
+        count++;
+      }
+      if (count == 0 && srcXStart < image.width) {
+        sum = srcRow[srcXStart];
+        count = 1;
+      }
+      rowAccum[outX] += sum;
+      rowCount[outX] += count;
+    }
+    const uint32_t srcY_fp = static_cast<uint32_t>(y + 1) << 16;
+    while (srcY_fp >= nextOutY_srcStart && currentOutY < outHeight) {
+      for (int x = 0; x < outWidth; x++) {
+        out.pixels[currentOutY * outWidth + x] = rowCount[x] > 0 ? rowAccum[x] / rowCount[x] : 0;
+      }
+      currentOutY++;
+      nextOutY_srcStart = static_cast<uint32_t>(currentOutY + 1) * scaleY_fp;
+      if (srcY_fp >= nextOutY_srcStart) continue;
+      std::fill(rowAccum.begin(), rowAccum.end(), 0);
+      std::fill(rowCount.begin(), rowCount.end(), 0);
+    }
+  }
+  return out;
+}
+
+Scaled areaScale(const GrayImage& image, const int outWidth, const int outHeight) {
+  Scaled out{outWidth, outHeight, {}};
+  AreaScaler scaler;
+  if (!scaler.begin(image.width, image.height, outWidth, outHeight)) {
+    return out;
+  }
+  out.pixels.reserve(static_cast<size_t>(outWidth) * outHeight);
+  for (int y = 0; y < image.height; y++) {
+    scaler.addRow(&image.pixels[y * image.width]);
+    while (const uint8_t* row = scaler.nextRow()) {
+      out.pixels.insert(out.pixels.end(), row, row + outWidth);
+    }
+  }
+  return out;
+}
+
+double psnr(const Scaled& scaled, const std::vector<double>& reference) {
+  if (scaled.pixels.size() != reference.size()) {
+    return 0;
+  }
+  double squares = 0;
+  for (size_t i = 0; i < reference.size(); i++) {
+    const double diff = scaled.pixels[i] - reference[i];
+    squares += diff * diff;
+  }
+  const double mse = squares / reference.size();
+  return mse == 0 ? 99.0 : 10 * std::log10(255.0 * 255.0 / mse);
+}
+
+using ScaleFn = Scaled (*)(const GrayImage&, int, int);
+
+// Scales kTimedRuns times, returns the result and the average time in ms
+Scaled timeScale(const ScaleFn scale, const GrayImage& image, const int outWidth, const int outHeight, double& ms) {
+  Scaled result;
+  const auto start = std::chrono::steady_clock::now();
+  for (int run = 0; run < kTimedRuns; run++) {
+    result = scale(image, outWidth, outHeight);
+  }
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  ms = elapsed.count() / kTimedRuns;
+  return result;
+}
+
+bool runImage(const GrayImage& image) {
+  bool passed = true;
+
+  // Not scaling passes the image through unchanged
+  const Scaled same = areaScale(image, image.width, image.height);
+  if (same.pixels != image.pixels) {
+    printf("%-28s FAILED: changed when not scaled\n", image.name.c_str());
+    passed = false;
+  }
+
+  // Fit into the sleep cover box and a cover thumbnail, a downscale with no small ratio, and an upscale (which
+  // ScaledBmpWriter does for small PNG covers, drawBitmap never upscales)
+  const double scales[] = {std::min({1.0, 480.0 / image.width, 800.0 / image.height}),
+                           std::min(90.0 / image.width, 150.0 / image.height), 3.0 / 7.0, 5.0 / 3.0};
+  for (const double scale : scales) {
+    const int outWidth = std::max(1, static_cast<int>(image.width * scale));
+    const int outHeight = std::max(1, static_cast<int>(image.height * scale));
+    if (scale == 1.0 || (scale > 1.0 && outWidth * outHeight > 1000000)) continue;
+    const auto reference = referenceScale(image, outWidth, outHeight);
+    double nearestMs = 0;
+    double boxMs = 0;
+    double areaMs = 0;
+    const Scaled nearest = timeScale(nearestScale, image, outWidth, outHeight, nearestMs);
+    const Scaled box = timeScale(boxScale, image, outWidth, outHeight, boxMs);
+    const Scaled area = timeScale(areaScale, image, outWidth, outHeight, areaMs);
+    const double areaPsnr = psnr(area, reference);
+    const bool ok = areaPsnr >= kMinPsnr;
+    passed = passed && ok;
+
+    const std::string size = std::to_string(image.width) + "x" + std::to_string(image.height) + ">" +
+                             std::to_string(outWidth) + "x" + std::to_string(outHeight);
+    char nearestPsnr[16] = "-";
+    if (scale < 1.0) snprintf(nearestPsnr, sizeof(nearestPsnr), "%.1f", psnr(nearest, reference));
+    printf("%-28s %-20s %8s %8.1f %8.1f %8.2f %8.2f %8.2f %s\n", image.name.c_str(), size.c_str(), nearestPsnr,
+           psnr(box, reference), areaPsnr, nearestMs, boxMs, areaMs, ok ? "ok" : "FAILED");
+  }
+  return passed;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::vector<GrayImage> images = makePatterns();
+  for (int i = 1; i < argc; i++) {
+    GrayImage image;
+    if (!loadPgm(argv[i], image)) {
+      fprintf(stderr, "Skipping %s, not an 8-bit PGM file\n", argv[i]);
+      continue;
+    }
+    images.push_back(std::move(image));
+  }
+
+  // PSNR in dB against the exact area average, and time per scale in ms
+  printf("%-28s %-20s %8s %8s %8s %8s %8s %8s\n", "image", "size", "nearest", "box", "area", "near ms", "box ms",
+         "area ms");
+  bool passed = true;
+  for (const auto& image : images) {
+    passed = runImage(image) && passed;
+  }
+  printf("\n%s\n", passed ? "AreaScaler matches the exact area average within rounding"
+                          : "FAILED: AreaScaler differs from the exact area average");
+  return passed ? 0 : 1;
+}
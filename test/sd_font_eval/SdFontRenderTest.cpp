@@ -0,0 +1,310 @@
+// Renders corpus text with fonts read from SD card font files (.epf) and with the builtin fonts they were exported
+// from, and checks that every page comes out pixel for pixel the same. Also reports how many bitmap pages a page of
+// text reads from the card once the page cache is warm. Pages are drawn from the word frequency lists of the
+// hyphenation test corpora, so frequent words show up as often as they do in real text.
+
+#include <EpdFont.h>
+#include <EpdGlyphRuns.h>
+#include <FontDecompressor.h>
+#include <SdFont.h>
+#include <Utf8.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <builtinFonts/notosans_16_regular.h>
+#include <builtinFonts/opendyslexic_10_regular.h>
+#include <builtinFonts/ubuntu_12_bold.h>
+#include <builtinFonts/ubuntu_12_regular.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr int kPagesPerCorpus = 100;
+constexpr int kWordsPerPage = 250;
+// One word in kItalicEvery is set in italic and one in kBoldEvery in bold
+constexpr int kItalicEvery = 25;
+constexpr int kBoldEvery = 60;
+constexpr int kCanvasWidth = 480;
+constexpr int kCanvasHeight = 800;
+// Lines are broken once the cursor passes this, glyphs beyond the canvas are clipped
+constexpr int kLineWidth = kCanvasWidth - 80;
+
+struct Corpus {
+  std::string name;
+  std::vector<std::string> words;
+  std::vector<double> frequencies;
+};
+
+struct Style {
+  const char* file;  // Without the .epf extension
+  const EpdFontData* builtin;
+};
+
+struct TestFont {
+  const char* name;
+  Style regular;
+  Style bold;
+  Style italic;
+};
+
+const TestFont kFonts[] = {
+    {"bookerly_14",
+     {"bookerly_14_regular", &bookerly_14_regular},
+     {"bookerly_14_bold", &bookerly_14_bold},
+     {"bookerly_14_italic", &bookerly_14_italic}},
+    {"notosans_16",
+     {"notosans_16_regular", &notosans_16_regular},
+     {"notosans_16_regular", &notosans_16_regular},
+     {"notosans_16_regular", &notosans_16_regular}},
+    {"opendyslexic_10",
+     {"opendyslexic_10_regular", &opendyslexic_10_regular},
+     {"opendyslexic_10_regular", &opendyslexic_10_regular},
+     {"opendyslexic_10_regular", &opendyslexic_10_regular}},
+    {"ubuntu_12",
+     {"ubuntu_12_regular", &ubuntu_12_regular},
+     {"ubuntu_12_bold", &ubuntu_12_bold},
+     {"ubuntu_12_regular", &ubuntu_12_regular}},
+};
+
+bool loadCorpus(const std::string& path, Corpus& corpus) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  const size_t slash = path.find_last_of('/');
+  corpus.name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+  corpus.name = corpus.name.substr(0, corpus.name.find('_'));
+
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const size_t first = line.find('|');
+    const size_t second = first == std::string::npos ? std::string::npos : line.find('|', first + 1);
+    corpus.words.push_back(line.substr(0, first));
+    corpus.frequencies.push_back(second == std::string::npos ? 1.0 : std::stod(line.substr(second + 1)));
+  }
+  return !corpus.words.empty();
+}
+
+// Everything but the bitmaps has to match exactly, bitmaps may be stored differently
+bool compareTables(const EpdFontData* builtin, const EpdFontData* sd, const char* name) {
+  const auto fail = [name](const char* what) {
+    fprintf(stderr, "%s: %s differs\n", name, what);
+    return false;
+  };
+  if (sd->intervalCount != builtin->intervalCount ||
+      memcmp(sd->intervals, builtin->intervals, builtin->intervalCount * sizeof(EpdUnicodeInterval)) != 0) {
+    return fail("intervals");
+  }
+  if (sd->advanceY != builtin->advanceY || sd->ascender != builtin->ascender || sd->descender != builtin->descender ||
+      sd->is2Bit != builtin->is2Bit) {
+    return fail("font metrics");
+  }
+  const EpdUnicodeInterval& last = builtin->intervals[builtin->intervalCount - 1];
+  const uint32_t glyphCount = last.offset + last.last - last.first + 1;
+  for (uint32_t i = 0; i < glyphCount; i++) {
+    const EpdGlyph& a = builtin->glyph[i];
+    const EpdGlyph& b = sd->glyph[i];
+    if (a.width != b.width || a.height != b.height || a.advanceX != b.advanceX || a.left != b.left ||
+        a.top != b.top) {
+      return fail("glyph metrics");
+    }
+  }
+  if (memcmp(sd->glyphLookup, builtin->glyphLookup, GLYPH_LOOKUP_SIZE * sizeof(uint16_t)) != 0) {
+    return fail("glyph lookup");
+  }
+  if (sd->ligatureCount != builtin->ligatureCount || sd->ligatureStartMask != builtin->ligatureStartMask ||
+      (builtin->ligatureCount != 0 &&
+       memcmp(sd->ligatures, builtin->ligatures, builtin->ligatureCount * sizeof(EpdLigaturePair)) != 0)) {
+    return fail("ligatures");
+  }
+  const EpdFont builtinFont(builtin);
+  const EpdFont sdFont(sd);
+  for (uint32_t left = 0; left < glyphCount; left++) {
+    for (uint32_t right = 0; right < glyphCount; right++) {
+      if (builtinFont.getKerning(&builtin->glyph[left], &builtin->glyph[right]) !=
+          sdFont.getKerning(&sd->glyph[left], &sd->glyph[right])) {
+        return fail("kerning");
+      }
+    }
+  }
+  return true;
+}
+
+struct Canvas {
+  std::vector<uint8_t> pixels = std::vector<uint8_t>(kCanvasWidth * kCanvasHeight);
+  bool operator==(const Canvas& other) const { return pixels == other.pixels; }
+};
+
+// Same lookup as GfxRenderer::getGlyphBitmap
+const uint8_t* glyphBitmap(FontDecompressor& decompressor, const EpdFontData* data, const EpdGlyph* glyph) {
+  if (data->bitmapSource) {
+    return data->bitmapSource->getBitmap(glyph);
+  }
+  if (data->groups) {
+    return decompressor.getBitmap(data, glyph, static_cast<uint16_t>(glyph - data->glyph));
+  }
+  return &data->bitmap[glyph->dataOffset];
+}
+
+void drawGlyph(Canvas& canvas, const EpdFontData* data, const EpdGlyph* glyph, const uint8_t* bitmap, const int x,
+               const int y) {
+  EpdGlyphRuns runs(bitmap, glyph->dataLength);
+  uint8_t runValue = 0;
+  int runLeft = 0;
+  for (int glyphY = 0; glyphY < glyph->height; glyphY++) {
+    for (int glyphX = 0; glyphX < glyph->width; glyphX++) {
+      uint8_t value;
+      if (data->rleBitmaps) {
+        if (runLeft == 0) {
+          runs.next(&runValue, &runLeft);
+        }
+        runLeft--;
+        value = runValue;
+      } else {
+        const int pixel = glyphY * glyph->width + glyphX;
+        value = data->is2Bit ? (bitmap[pixel / 4] >> ((3 - pixel % 4) * 2)) & 0x3
+                             : (bitmap[pixel / 8] >> (7 - pixel % 8)) & 0x1;
+      }
+      const int canvasX = x + glyph->left + glyphX;
+      const int canvasY = y - glyph->top + glyphY;
+      if (value != 0 && canvasX >= 0 && canvasX < kCanvasWidth && canvasY >= 0 && canvasY < kCanvasHeight) {
+        canvas.pixels[canvasY * kCanvasWidth + canvasX] = value;
+      }
+    }
+  }
+}
+
+void drawWord(Canvas& canvas, FontDecompressor& decompressor, const EpdFont& font, const std::string& word, int* x,
+              const int y) {
+  const auto* ptr = reinterpret_cast<const unsigned char*>(word.c_str());
+  const EpdGlyph* previous = nullptr;
+  uint32_t cp;
+  while ((cp = font.nextCodepoint(&ptr))) {
+    const EpdGlyph* glyph = font.getGlyph(cp);
+    if (!glyph) {
+      glyph = font.getGlyph(REPLACEMENT_GLYPH);
+    }
+    if (!glyph) {
+      continue;
+    }
+    *x += font.getKerning(previous, glyph);
+    previous = glyph;
+    if (glyph->dataLength > 0) {
+      drawGlyph(canvas, font.data, glyph, glyphBitmap(decompressor, font.data, glyph), *x, y);
+    }
+    *x += glyph->advanceX;
+  }
+}
+
+struct PageFonts {
+  EpdFont regular;
+  EpdFont bold;
+  EpdFont italic;
+};
+
+void drawPage(Canvas& canvas, FontDecompressor& decompressor, const PageFonts& fonts,
+              const std::vector<std::string>& words) {
+  canvas.pixels.assign(canvas.pixels.size(), 0);
+  const int lineHeight = fonts.regular.data->advanceY;
+  const int spaceWidth = fonts.regular.getGlyph(' ')->advanceX;
+  int x = 0;
+  int y = fonts.regular.data->ascender;
+  for (size_t i = 0; i < words.size() && y < kCanvasHeight; i++) {
+    const EpdFont& font = i % kItalicEvery == 0 ? fonts.italic : i % kBoldEvery == 0 ? fonts.bold : fonts.regular;
+    drawWord(canvas, decompressor, font, words[i], &x, y);
+    x += spaceWidth;
+    if (x > kLineWidth) {
+      x = 0;
+      y += lineHeight;
+    }
+  }
+}
+
+bool loadSdFont(SdFont& font, const std::string& directory, const Style& style) {
+  if (!font.load((directory + "/" + style.file + ".epf").c_str())) {
+    fprintf(stderr, "Could not load %s/%s.epf\n", directory.c_str(), style.file);
+    return false;
+  }
+  return compareTables(style.builtin, font.getData(), style.file);
+}
+
+bool replay(const TestFont& testFont, const std::string& directory, const Corpus& corpus) {
+  SdFont sdRegular;
+  SdFont sdBold;
+  SdFont sdItalic;
+  if (!loadSdFont(sdRegular, directory, testFont.regular) || !loadSdFont(sdBold, directory, testFont.bold) ||
+      !loadSdFont(sdItalic, directory, testFont.italic)) {
+    return false;
+  }
+  const PageFonts builtinFonts{EpdFont(testFont.regular.builtin), EpdFont(testFont.bold.builtin),
+                               EpdFont(testFont.italic.builtin)};
+  const PageFonts sdFonts{EpdFont(sdRegular.getData()), EpdFont(sdBold.getData()), EpdFont(sdItalic.getData())};
+
+  FontDecompressor decompressor;
+  decompressor.init();
+  std::mt19937 rng(1);
+  std::discrete_distribution<size_t> pick(corpus.frequencies.begin(), corpus.frequencies.end());
+
+  Canvas builtinCanvas;
+  Canvas sdCanvas;
+  int differingPages = 0;
+  uint32_t firstPageMisses = 0;
+  const uint64_t bytesReadBefore = FsFile::bytesRead;
+  for (int page = 0; page < kPagesPerCorpus; page++) {
+    std::vector<std::string> words;
+    for (int i = 0; i < kWordsPerPage; i++) {
+      words.push_back(corpus.words[pick(rng)] + (i % 12 == 11 ? "," : i % 15 == 14 ? "." : ""));
+    }
+    drawPage(builtinCanvas, decompressor, builtinFonts, words);
+    drawPage(sdCanvas, decompressor, sdFonts, words);
+    if (!(builtinCanvas == sdCanvas)) {
+      differingPages++;
+    }
+    if (page == 0) {
+      firstPageMisses = sdRegular.getStats().misses + sdBold.getStats().misses + sdItalic.getStats().misses;
+    }
+  }
+  decompressor.deinit();
+
+  const uint32_t misses = sdRegular.getStats().misses + sdBold.getStats().misses + sdItalic.getStats().misses;
+  printf("%-16s %-8s %6d %8u %8.2f %8.1f\n", testFont.name, corpus.name.c_str(), differingPages, firstPageMisses,
+         static_cast<double>(misses - firstPageMisses) / (kPagesPerCorpus - 1),
+         static_cast<double>(FsFile::bytesRead - bytesReadBefore) / kPagesPerCorpus / 1024.0);
+  return differingPages == 0;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s <font directory> <corpus.txt>...\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<Corpus> corpora;
+  for (int i = 2; i < argc; i++) {
+    Corpus corpus;
+    if (!loadCorpus(argv[i], corpus)) {
+      fprintf(stderr, "Could not read corpus %s\n", argv[i]);
+      return 1;
+    }
+    corpora.push_back(std::move(corpus));
+  }
+
+  printf("%-16s %-8s %6s %8s %8s %8s\n", "font", "corpus", "differ", "1st pg", "reads/pg", "KB/pg");
+  bool passed = true;
+  for (const auto& font : kFonts) {
+    for (const auto& corpus : corpora) {
+      passed = replay(font, argv[1], corpus) && passed;
+    }
+  }
+  printf("\n%s\n", passed ? "All pages match the builtin fonts" : "FAILED: SD fonts differ from the builtin fonts");
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+#pragma once
+// Minimal SD card API for reading and writing files on the host, paths are taken relative to the working directory
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+class FsFile {
+ public:
+  FsFile() = default;
+  ~FsFile() { close(); }
+  FsFile(const FsFile&) = delete;
+  FsFile& operator=(const FsFile&) = delete;
+
+  bool open(const char* path, const char* mode = "rb") {
+    close();
+    file = fopen(path, mode);
+    return file != nullptr;
+  }
+  int read(void* buffer, const size_t size) {
+    bytesRead += size;
+    return file ? static_cast<int>(fread(buffer, 1, size, file)) : -1;
+  }
+  int read() {
+    uint8_t byte;
+    return read(&byte, 1) == 1 ? byte : -1;
+  }
+  size_t write(const void* buffer, const size_t size) { return file ? fwrite(buffer, 1, size, file) : 0; }
+  bool seekSet(const uint64_t position) { return file && fseek(file, static_cast<long>(position), SEEK_SET) == 0; }
+  bool seek(const uint64_t position) { return seekSet(position); }
+  bool seekCur(const int64_t offset) { return file && fseek(file, static_cast<long>(offset), SEEK_CUR) == 0; }
+  uint64_t position() const { return file ? static_cast<uint64_t>(ftell(file)) : 0; }
+  bool close() {
+    if (file) {
+      fclose(file);
+      file = nullptr;
+    }
+    return true;
+  }
+  explicit operator bool() const { return file != nullptr; }
+
+  // Bytes requested from all files, to compare how much each font reads from the card
+  static inline uint64_t bytesRead = 0;
+
+ private:
+  FILE* file = nullptr;
+};
+
+class HalStorage {
+ public:
+  bool exists(const char* path) {
+    FsFile file;
+    return file.open(path);
+  }
+  bool remove(const char* path) { return ::remove(path) == 0; }
+  bool openFileForRead(const char*, const char* path, FsFile& file) { return file.open(path); }
+  bool openFileForRead(const char* moduleName, const std::string& path, FsFile& file) {
+    return openFileForRead(moduleName, path.c_str(), file);
+  }
+  bool openFileForWrite(const char*, const char* path, FsFile& file) { return file.open(path, "w+b"); }
+  bool openFileForWrite(const char* moduleName, const std::string& path, FsFile& file) {
+    return openFileForWrite(moduleName, path.c_str(), file);
+  }
+
+  static HalStorage& getInstance() {
+    static HalStorage instance;
+    return instance;
+  }
+};
+
+#define Storage HalStorage::getInstance()
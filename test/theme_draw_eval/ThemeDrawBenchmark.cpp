@@ -0,0 +1,240 @@
+// Draws the menu screens of BaseTheme and LyraTheme (headers, tab bars, lists with their selection bars, button menus,
+// progress bars, popups, button hints and keyboard keys) in every orientation, and reports how long each screen takes.
+//
+// Built twice by run_theme_draw_eval.sh: once with the real GfxRenderer, and once with per_pixel/GfxRenderer.h, which
+// draws shapes one pixel at a time the way GfxRenderer did before rows were filled as whole frame buffer bytes. The
+// per-pixel build writes its frame buffers and timings to a file, the real build compares its own against them.
+
+#include <GfxRenderer.h>
+#include <builtinFonts/notosans_8_regular.h>
+#include <builtinFonts/ubuntu_10_bold.h>
+#include <builtinFonts/ubuntu_10_regular.h>
+#include <builtinFonts/ubuntu_12_bold.h>
+#include <builtinFonts/ubuntu_12_regular.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "RecentBooksStore.h"
+#include "components/UITheme.h"
+#include "components/themes/BaseTheme.h"
+#include "components/themes/lyra/LyraTheme.h"
+#include "fontIds.h"
+
+RecentBooksStore RecentBooksStore::instance;
+
+namespace {
+constexpr int kTimedDraws = 50;
+
+const GfxRenderer::Orientation kOrientations[] = {GfxRenderer::Portrait, GfxRenderer::LandscapeClockwise,
+                                                  GfxRenderer::PortraitInverted,
+                                                  GfxRenderer::LandscapeCounterClockwise};
+const char* const kOrientationNames[] = {"portrait", "landscape cw", "portrait inverted", "landscape ccw"};
+
+HalDisplay display;
+GfxRenderer renderer(display);
+
+EpdFont smallFont(&notosans_8_regular);
+EpdFontFamily smallFontFamily(&smallFont);
+EpdFont ui10RegularFont(&ubuntu_10_regular);
+EpdFont ui10BoldFont(&ubuntu_10_bold);
+EpdFontFamily ui10FontFamily(&ui10RegularFont, &ui10BoldFont);
+EpdFont ui12RegularFont(&ubuntu_12_regular);
+EpdFont ui12BoldFont(&ubuntu_12_bold);
+EpdFontFamily ui12FontFamily(&ui12RegularFont, &ui12BoldFont);
+
+const char* const kTitles[] = {"Recently opened",          "The Count of Monte Cristo",
+                               "Settings",                 "A Tale of Two Cities",
+                               "File transfer",            "Pride and Prejudice",
+                               "Library",                  "Moby Dick; or, The Whale",
+                               "Dune",                     "War and Peace",
+                               "Wi-Fi",                    "Les Misérables",
+                               "Crime and Punishment"};
+constexpr int kTitleCount = sizeof(kTitles) / sizeof(kTitles[0]);
+const UIIcon kIcons[] = {Folder, Text, Image, Book, File, Recent, Settings, Transfer, Library, Wifi, Hotspot};
+constexpr int kIconCount = sizeof(kIcons) / sizeof(kIcons[0]);
+
+std::string title(const int index) { return kTitles[index % kTitleCount]; }
+std::string subtitle(const int index) { return "Chapter " + std::to_string(index + 1) + " of 42"; }
+std::string value(const int index) { return index % 2 ? "On" : "Off"; }
+UIIcon icon(const int index) { return kIcons[index % kIconCount]; }
+
+struct Theme {
+  const char* name;
+  const BaseTheme& theme;
+  const ThemeMetrics& metrics;
+};
+
+// Library: header, tab bar, a list with a selection bar and scroll bar, button hints
+void drawLibraryScreen(const Theme& theme, const int selectedIndex, const bool tabBarSelected) {
+  const ThemeMetrics& metrics = theme.metrics;
+  const int width = renderer.getScreenWidth();
+  const int height = renderer.getScreenHeight();
+  int y = metrics.topPadding;
+  theme.theme.drawHeader(renderer, Rect{0, y, width, metrics.headerHeight}, "Library", "128 books");
+  y += metrics.headerHeight;
+  const std::vector<TabInfo> tabs = {{"Recent", false}, {"Books", true}, {"Files", false}};
+  theme.theme.drawTabBar(renderer, Rect{0, y, width, metrics.tabBarHeight}, tabs, tabBarSelected);
+  y += metrics.tabBarHeight + metrics.verticalSpacing;
+  theme.theme.drawList(renderer, Rect{0, y, width, height - y - metrics.buttonHintsHeight}, 40, selectedIndex, title,
+                       subtitle, icon, nullptr, false);
+  theme.theme.drawButtonHints(renderer, "Back", "Open", "Up", "Down");
+  theme.theme.drawSideButtonHints(renderer, "+", "-");
+}
+
+// Settings: sub header, a list of values with the selected value highlighted, a progress bar and a popup over it
+void drawSettingsScreen(const Theme& theme, const int selectedIndex) {
+  const ThemeMetrics& metrics = theme.metrics;
+  const int width = renderer.getScreenWidth();
+  int y = metrics.topPadding;
+  theme.theme.drawHeader(renderer, Rect{0, y, width, metrics.headerHeight}, "Settings", nullptr);
+  y += metrics.headerHeight;
+  theme.theme.drawSubHeader(renderer, Rect{0, y, width, metrics.tabBarHeight}, "Display", "Page 1/3");
+  y += metrics.tabBarHeight;
+  theme.theme.drawList(renderer, Rect{0, y, width, 8 * metrics.listRowHeight}, 8, selectedIndex, title, nullptr,
+                       nullptr, value, true);
+  y += 8 * metrics.listRowHeight + metrics.verticalSpacing;
+  theme.theme.drawProgressBar(renderer, Rect{metrics.contentSidePadding, y, width - 2 * metrics.contentSidePadding,
+                                             metrics.progressBarHeight},
+                              37, 100);
+  const Rect popup = theme.theme.drawPopup(renderer, "Indexing chapter 7...");
+  theme.theme.fillPopupProgress(renderer, popup, 60);
+  theme.theme.drawReadingProgressBar(renderer, 42);
+}
+
+// Home: button menu and an on-screen keyboard
+void drawHomeScreen(const Theme& theme, const int selectedIndex) {
+  const ThemeMetrics& metrics = theme.metrics;
+  const int width = renderer.getScreenWidth();
+  const int height = renderer.getScreenHeight();
+  const int menuHeight = 6 * (metrics.menuRowHeight + metrics.menuSpacing);
+  theme.theme.drawButtonMenu(renderer, Rect{0, metrics.homeTopPadding, width, menuHeight}, 6, selectedIndex, title,
+                             icon);
+  const int keyWidth = metrics.keyboardKeyWidth + metrics.keyboardKeySpacing;
+  const int keyY = height - metrics.buttonHintsHeight - 3 * metrics.keyboardKeyHeight;
+  const char* const keys = "qwertyuiopasdfghjklzxcvbnm";
+  for (int i = 0; keys[i]; i++) {
+    const char label[2] = {keys[i], '\0'};
+    const Rect key{metrics.contentSidePadding + (i % 10) * keyWidth, keyY + (i / 10) * metrics.keyboardKeyHeight,
+                   metrics.keyboardKeyWidth, metrics.keyboardKeyHeight};
+    theme.theme.drawKeyboardKey(renderer, key, label, i == selectedIndex);
+  }
+  theme.theme.drawTextField(renderer, Rect{metrics.contentSidePadding, keyY - 60, width / 2, 40}, width / 2);
+  theme.theme.drawHelpText(renderer, Rect{0, keyY - 90, width, 20}, "Press and hold to delete");
+}
+
+struct Screen {
+  const char* name;
+  std::function<void(const Theme& theme)> draw;
+};
+
+const Screen kScreens[] = {
+    {"library", [](const Theme& theme) { drawLibraryScreen(theme, 5, false); }},
+    {"library tabs", [](const Theme& theme) { drawLibraryScreen(theme, 17, true); }},
+    {"settings", [](const Theme& theme) { drawSettingsScreen(theme, 3); }},
+    {"home", [](const Theme& theme) { drawHomeScreen(theme, 2); }},
+};
+
+struct Result {
+  std::string name;
+  double ms = 0;
+  std::vector<uint8_t> frame;
+};
+
+Result drawScreen(const Theme& theme, const Screen& screen, const size_t orientation) {
+  Result result;
+  result.name = std::string(theme.name) + " " + screen.name + ", " + kOrientationNames[orientation];
+  UITheme::getInstance().setMetrics(theme.metrics);
+  renderer.setOrientation(kOrientations[orientation]);
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kTimedDraws; i++) {
+    renderer.clearScreen();
+    screen.draw(theme);
+  }
+  result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kTimedDraws;
+  result.frame.assign(renderer.getFrameBuffer(), renderer.getFrameBuffer() + HalDisplay::BUFFER_SIZE);
+  renderer.setOrientation(GfxRenderer::Portrait);
+  return result;
+}
+
+bool writeResults(const char* path, const std::vector<Result>& results) {
+  std::ofstream file(path, std::ios::binary);
+  for (const auto& result : results) {
+    file.write(reinterpret_cast<const char*>(&result.ms), sizeof(result.ms));
+    file.write(reinterpret_cast<const char*>(result.frame.data()), static_cast<std::streamsize>(result.frame.size()));
+  }
+  return static_cast<bool>(file);
+}
+
+bool readResults(const char* path, std::vector<Result>& results) {
+  std::ifstream file(path, std::ios::binary);
+  for (auto& result : results) {
+    result.frame.resize(HalDisplay::BUFFER_SIZE);
+    file.read(reinterpret_cast<char*>(&result.ms), sizeof(result.ms));
+    file.read(reinterpret_cast<char*>(result.frame.data()), static_cast<std::streamsize>(result.frame.size()));
+  }
+  return file && file.peek() == EOF;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  const bool compare = argc == 3 && strcmp(argv[1], "--compare") == 0;
+  if (argc != 2 && !compare) {
+    fprintf(stderr, "Usage: %s <output file> | --compare <per-pixel output file>\n", argv[0]);
+    return 1;
+  }
+
+  renderer.begin();
+  renderer.insertFont(UI_10_FONT_ID, ui10FontFamily);
+  renderer.insertFont(UI_12_FONT_ID, ui12FontFamily);
+  renderer.insertFont(SMALL_FONT_ID, smallFontFamily);
+
+  const BaseTheme baseTheme;
+  const LyraTheme lyraTheme;
+  const Theme themes[] = {{"classic", baseTheme, BaseMetrics::values}, {"lyra", lyraTheme, LyraMetrics::values}};
+
+  std::vector<Result> results;
+  for (const auto& theme : themes) {
+    for (const auto& screen : kScreens) {
+      for (size_t o = 0; o < std::size(kOrientations); o++) {
+        results.push_back(drawScreen(theme, screen, o));
+      }
+    }
+  }
+
+  if (!compare) {
+    return writeResults(argv[1], results) ? 0 : 1;
+  }
+
+  std::vector<Result> expected(results.size());
+  if (!readResults(argv[2], expected)) {
+    fprintf(stderr, "Could not read %s\n", argv[2]);
+    return 1;
+  }
+  printf("%-40s %8s %10s %10s %8s\n", "screen", "differ", "rows ms", "pixel ms", "speedup");
+  int failures = 0;
+  double totalMs = 0;
+  double totalExpectedMs = 0;
+  for (size_t i = 0; i < results.size(); i++) {
+    int differingBytes = 0;
+    for (size_t b = 0; b < HalDisplay::BUFFER_SIZE; b++) {
+      differingBytes += results[i].frame[b] != expected[i].frame[b];
+    }
+    failures += differingBytes != 0;
+    totalMs += results[i].ms;
+    totalExpectedMs += expected[i].ms;
+    printf("%-40s %8d %10.3f %10.3f %7.2fx\n", results[i].name.c_str(), differingBytes, results[i].ms, expected[i].ms,
+           expected[i].ms / results[i].ms);
+  }
+  printf("%-40s %8d %10.3f %10.3f %7.2fx\n", "total", failures, totalMs, totalExpectedMs, totalExpectedMs / totalMs);
+
+  printf("\n%s\n", failures == 0 ? "All screens match the per-pixel shapes"
+                                 : "FAILED: screens differ from the per-pixel shapes");
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,10 @@
+#pragma once
+// Battery of the reader on the host: always the same charge, so every draw of a theme header is the same
+
+#include <cstdint>
+
+struct HostBattery {
+  uint16_t readPercentage() const { return 73; }
+};
+
+static HostBattery battery;
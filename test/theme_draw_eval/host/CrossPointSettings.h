@@ -0,0 +1,18 @@
+#pragma once
+// The settings the themes read, at their defaults
+
+#include <cstdint>
+
+class CrossPointSettings {
+ public:
+  enum HIDE_BATTERY_PERCENTAGE { HIDE_NEVER = 0, HIDE_READER = 1, HIDE_ALWAYS = 2, HIDE_BATTERY_PERCENTAGE_COUNT };
+
+  uint8_t hideBatteryPercentage = HIDE_NEVER;
+
+  static CrossPointSettings& getInstance() {
+    static CrossPointSettings instance;
+    return instance;
+  }
+};
+
+#define SETTINGS CrossPointSettings::getInstance()
@@ -0,0 +1,23 @@
+#pragma once
+// The part of UITheme the themes call back into, with the metrics of the theme being drawn
+
+#include <string>
+
+#include "CrossPointSettings.h"
+#include "components/themes/BaseTheme.h"
+
+class UITheme {
+ public:
+  static UITheme& getInstance() {
+    static UITheme instance;
+    return instance;
+  }
+
+  const ThemeMetrics& getMetrics() { return *metrics; }
+  void setMetrics(const ThemeMetrics& themeMetrics) { metrics = &themeMetrics; }
+  // Covers are not drawn on the host
+  static std::string getCoverThumbPath(std::string coverBmpPath, int) { return coverBmpPath; }
+
+ private:
+  const ThemeMetrics* metrics = &BaseMetrics::values;
+};
@@ -0,0 +1,223 @@
+#pragma once
+// GfxRenderer with the shape drawing it had before rows were filled as whole frame buffer bytes: lines, rects,
+// rounded rects, arcs and dither fills set one pixel at a time through drawPixel. Everything else (text, icons,
+// bitmaps) is the real renderer, which is built as GfxRendererBase next to this header.
+
+#define GfxRenderer GfxRendererBase
+#include "../../../lib/GfxRenderer/GfxRenderer.h"
+#undef GfxRenderer
+
+#include <algorithm>
+
+class GfxRenderer : public GfxRendererBase {
+ public:
+  using GfxRendererBase::GfxRendererBase;
+
+  void drawLine(int x1, int y1, const int x2, const int y2, const bool state = true) const {
+    // Bresenham's line algorithm, drawPixel clips
+    int dx = x2 - x1;
+    int dy = y2 - y1;
+    const int sx = dx > 0 ? 1 : -1;
+    const int sy = dy > 0 ? 1 : -1;
+    dx = sx * dx;
+    dy = sy * dy;
+    int err = dx - dy;
+    while (true) {
+      drawPixel(x1, y1, state);
+      if (x1 == x2 && y1 == y2) break;
+      const int e2 = 2 * err;
+      if (e2 > -dy) {
+        err -= dy;
+        x1 += sx;
+      }
+      if (e2 < dx) {
+        err += dx;
+        y1 += sy;
+      }
+    }
+  }
+
+  void drawLine(const int x1, const int y1, const int x2, const int y2, const int lineWidth, const bool state) const {
+    for (int i = 0; i < lineWidth; i++) {
+      drawLine(x1, y1 + i, x2, y2 + i, state);
+    }
+  }
+
+  void drawRect(const int x, const int y, const int width, const int height, const bool state = true) const {
+    drawLine(x, y, x + width - 1, y, state);
+    drawLine(x + width - 1, y, x + width - 1, y + height - 1, state);
+    drawLine(x + width - 1, y + height - 1, x, y + height - 1, state);
+    drawLine(x, y, x, y + height - 1, state);
+  }
+
+  void drawRect(const int x, const int y, const int width, const int height, const int lineWidth,
+                const bool state) const {
+    for (int i = 0; i < lineWidth; i++) {
+      drawLine(x + i, y + i, x + width - i, y + i, state);
+      drawLine(x + width - i, y + i, x + width - i, y + height - i, state);
+      drawLine(x + width - i, y + height - i, x + i, y + height - i, state);
+      drawLine(x + i, y + height - i, x + i, y + i, state);
+    }
+  }
+
+  void drawArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir, const int lineWidth,
+               const bool state) const {
+    const int stroke = std::min(lineWidth, maxRadius);
+    const int innerRadius = std::max(maxRadius - stroke, 0);
+    const int outerRadiusSq = maxRadius * maxRadius;
+    const int innerRadiusSq = innerRadius * innerRadius;
+    for (int dy = 0; dy <= maxRadius; ++dy) {
+      for (int dx = 0; dx <= maxRadius; ++dx) {
+        const int distSq = dx * dx + dy * dy;
+        if (distSq <= outerRadiusSq && distSq >= innerRadiusSq) {
+          drawPixel(cx + xDir * dx, cy + yDir * dy, state);
+        }
+      }
+    }
+  }
+
+  void drawRoundedRect(const int x, const int y, const int width, const int height, const int lineWidth,
+                       const int cornerRadius, const bool state) const {
+    drawRoundedRect(x, y, width, height, lineWidth, cornerRadius, true, true, true, true, state);
+  }
+
+  void drawRoundedRect(const int x, const int y, const int width, const int height, const int lineWidth,
+                       const int cornerRadius, const bool roundTopLeft, const bool roundTopRight,
+                       const bool roundBottomLeft, const bool roundBottomRight, const bool state) const {
+    if (lineWidth <= 0 || width <= 0 || height <= 0) {
+      return;
+    }
+    const int maxRadius = std::min({cornerRadius, width / 2, height / 2});
+    if (maxRadius <= 0) {
+      drawRect(x, y, width, height, lineWidth, state);
+      return;
+    }
+    const int stroke = std::min(lineWidth, maxRadius);
+    const int right = x + width - 1;
+    const int bottom = y + height - 1;
+
+    const int horizontalWidth = width - 2 * maxRadius;
+    if (horizontalWidth > 0) {
+      if (roundTopLeft || roundTopRight) {
+        fillRect(x + maxRadius, y, horizontalWidth, stroke, state);
+      }
+      if (roundBottomLeft || roundBottomRight) {
+        fillRect(x + maxRadius, bottom - stroke + 1, horizontalWidth, stroke, state);
+      }
+    }
+    const int verticalHeight = height - 2 * maxRadius;
+    if (verticalHeight > 0) {
+      if (roundTopLeft || roundBottomLeft) {
+        fillRect(x, y + maxRadius, stroke, verticalHeight, state);
+      }
+      if (roundTopRight || roundBottomRight) {
+        fillRect(right - stroke + 1, y + maxRadius, stroke, verticalHeight, state);
+      }
+    }
+    if (roundTopLeft) {
+      drawArc(maxRadius, x + maxRadius, y + maxRadius, -1, -1, lineWidth, state);
+    }
+    if (roundTopRight) {
+      drawArc(maxRadius, right - maxRadius, y + maxRadius, 1, -1, lineWidth, state);
+    }
+    if (roundBottomRight) {
+      drawArc(maxRadius, right - maxRadius, bottom - maxRadius, 1, 1, lineWidth, state);
+    }
+    if (roundBottomLeft) {
+      drawArc(maxRadius, x + maxRadius, bottom - maxRadius, -1, 1, lineWidth, state);
+    }
+  }
+
+  void fillRect(const int x, const int y, const int width, const int height, const bool state = true) const {
+    fillRectDither(x, y, width, height, state ? Color::Black : Color::White);
+  }
+
+  void fillRectDither(const int x, const int y, const int width, const int height, const Color color) const {
+    for (int fillY = y; fillY < y + height; fillY++) {
+      for (int fillX = x; fillX < x + width; fillX++) {
+        drawPixelDither(fillX, fillY, color);
+      }
+    }
+  }
+
+  void fillRoundedRect(const int x, const int y, const int width, const int height, const int cornerRadius,
+                       const Color color) const {
+    fillRoundedRect(x, y, width, height, cornerRadius, true, true, true, true, color);
+  }
+
+  void fillRoundedRect(const int x, const int y, const int width, const int height, const int cornerRadius,
+                       const bool roundTopLeft, const bool roundTopRight, const bool roundBottomLeft,
+                       const bool roundBottomRight, const Color color) const {
+    if (width <= 0 || height <= 0) {
+      return;
+    }
+    // Assume if we're not rounding all corners then we are only rounding one side
+    const int roundedSides = (!roundTopLeft || !roundTopRight || !roundBottomLeft || !roundBottomRight) ? 1 : 2;
+    const int maxRadius = std::min({cornerRadius, width / roundedSides, height / roundedSides});
+    if (maxRadius <= 0) {
+      fillRectDither(x, y, width, height, color);
+      return;
+    }
+
+    const int horizontalWidth = width - 2 * maxRadius;
+    if (horizontalWidth > 0) {
+      fillRectDither(x + maxRadius + 1, y, horizontalWidth - 2, height, color);
+    }
+    const int leftFillTop = y + (roundTopLeft ? (maxRadius + 1) : 0);
+    const int leftFillBottom = y + height - 1 - (roundBottomLeft ? (maxRadius + 1) : 0);
+    if (leftFillBottom >= leftFillTop) {
+      fillRectDither(x, leftFillTop, maxRadius + 1, leftFillBottom - leftFillTop + 1, color);
+    }
+    const int rightFillTop = y + (roundTopRight ? (maxRadius + 1) : 0);
+    const int rightFillBottom = y + height - 1 - (roundBottomRight ? (maxRadius + 1) : 0);
+    if (rightFillBottom >= rightFillTop) {
+      fillRectDither(x + width - maxRadius - 1, rightFillTop, maxRadius + 1, rightFillBottom - rightFillTop + 1,
+                     color);
+    }
+
+    if (roundTopLeft) {
+      fillArc(maxRadius, x + maxRadius, y + maxRadius, -1, -1, color);
+    }
+    if (roundTopRight) {
+      fillArc(maxRadius, x + width - maxRadius - 1, y + maxRadius, 1, -1, color);
+    }
+    if (roundBottomRight) {
+      fillArc(maxRadius, x + width - maxRadius - 1, y + height - maxRadius - 1, 1, 1, color);
+    }
+    if (roundBottomLeft) {
+      fillArc(maxRadius, x + maxRadius, y + height - maxRadius - 1, -1, 1, color);
+    }
+  }
+
+ private:
+  void drawPixelDither(const int x, const int y, const Color color) const {
+    switch (color) {
+      case Color::Clear:
+        break;
+      case Color::Black:
+        drawPixel(x, y, true);
+        break;
+      case Color::White:
+        drawPixel(x, y, false);
+        break;
+      case Color::LightGray:
+        drawPixel(x, y, x % 2 == 0 && y % 2 == 0);
+        break;
+      case Color::DarkGray:
+        drawPixel(x, y, (x + y) % 2 == 0);
+        break;
+    }
+  }
+
+  void fillArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir,
+               const Color color) const {
+    const int radiusSq = maxRadius * maxRadius;
+    for (int dy = 0; dy <= maxRadius; ++dy) {
+      for (int dx = 0; dx <= maxRadius; ++dx) {
+        if (dx * dx + dy * dy <= radiusSq) {
+          drawPixelDither(cx + xDir * dx, cy + yDir * dy, color);
+        }
+      }
+    }
+  }
+};